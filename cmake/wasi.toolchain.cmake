@@ -0,0 +1,42 @@
+# Cross compiling to WebAssembly (WASI) with wasi-sdk
+#
+#   cmake .. -DCMAKE_TOOLCHAIN_FILE=../cmake/wasi.toolchain.cmake -DWASI_SDK_PREFIX=/opt/wasi-sdk
+#
+# For the browsers build with Emscripten, its own toolchain file is set by emcmake:
+#
+#   emcmake cmake ..
+#
+# Both set the WebAssembly SIMD128 backends (ENABLE_SM4_WASM, ENABLE_SM3_WASM,
+# ENABLE_GHASH_WASM) ON by default, the module then requires SIMD128.
+
+set(CMAKE_SYSTEM_NAME WASI)
+set(CMAKE_SYSTEM_VERSION 1)
+set(CMAKE_SYSTEM_PROCESSOR wasm32)
+
+if (NOT WASI_SDK_PREFIX)
+	if (DEFINED ENV{WASI_SDK_PREFIX})
+		set(WASI_SDK_PREFIX $ENV{WASI_SDK_PREFIX})
+	else()
+		set(WASI_SDK_PREFIX /opt/wasi-sdk)
+	endif()
+endif()
+# the try_compile projects get the prefix too
+list(APPEND CMAKE_TRY_COMPILE_PLATFORM_VARIABLES WASI_SDK_PREFIX)
+
+set(triple wasm32-wasi)
+
+set(CMAKE_C_COMPILER ${WASI_SDK_PREFIX}/bin/clang)
+set(CMAKE_AR ${WASI_SDK_PREFIX}/bin/llvm-ar CACHE STRING "wasi-sdk ar")
+set(CMAKE_RANLIB ${WASI_SDK_PREFIX}/bin/llvm-ranlib CACHE STRING "wasi-sdk ranlib")
+set(CMAKE_C_COMPILER_TARGET ${triple})
+set(CMAKE_SYSROOT ${WASI_SDK_PREFIX}/share/wasi-sysroot)
+
+set(CMAKE_EXECUTABLE_SUFFIX ".wasm")
+
+# there is no dynamic linking in WASI
+set(BUILD_SHARED_LIBS OFF CACHE BOOL "Build shared libraries")
+
+set(CMAKE_FIND_ROOT_PATH_MODE_PROGRAM NEVER)
+set(CMAKE_FIND_ROOT_PATH_MODE_LIBRARY ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_INCLUDE ONLY)
+set(CMAKE_FIND_ROOT_PATH_MODE_PACKAGE ONLY)
@@ -46,6 +46,28 @@ int aes_set_decrypt_key(AES_KEY *key, const uint8_t *raw_key, size_t raw_key_len
 void aes_encrypt(const AES_KEY *key, const uint8_t in[AES_BLOCK_SIZE], uint8_t out[AES_BLOCK_SIZE]);
 void aes_decrypt(const AES_KEY *key, const uint8_t in[AES_BLOCK_SIZE], uint8_t out[AES_BLOCK_SIZE]);
 
+void aes_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+// inc32() of nist-sp800-38d, only the last 32 bits of `ctr` are incremented
+void aes_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[AES_BLOCK_SIZE],
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+
+// Kernels of the optional backends, the functions above dispatch to the fastest one, see `gmssl_cpu_features`
+#ifdef ENABLE_AES_AESNI
+void aes_aesni_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_aesni_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_aesni_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_AES_VAES
+void aes_vaes_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_vaes_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_AES_CE
+void aes_ce_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_ce_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void aes_ce_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+
 
 void aes_cbc_encrypt(const AES_KEY *key, const uint8_t iv[AES_BLOCK_SIZE],
 	const uint8_t *in, size_t nblocks, uint8_t *out);
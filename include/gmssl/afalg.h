@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_AFALG_H
+#define GMSSL_AFALG_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * SM3 and SM4 on the Linux kernel crypto API (ENABLE_AFALG), for the crypto
+ * engines of SoCs (HiSilicon SEC, CCP, ...) that have a kernel driver and no
+ * SDF library. The algorithms "sm3", "cbc(sm4)", "ctr(sm4)" and "xts(sm4)"
+ * are opened as AF_ALG sockets by the init functions. Inputs of at least
+ * `threshold` bytes go to the kernel in operations of at most
+ * AFALG_MAX_OP_SIZE bytes, moved without a copy with vmsplice() and splice()
+ * when they do not overlap the output, and the smaller ones run on the CPU.
+ * Where the kernel has no such algorithm, or an operation fails, the CPU
+ * does the work, so the results never depend on the backend.
+ *
+ * SM4-GCM runs the keystream on "ctr(sm4)" and GHASH on the CPU, with 12-byte
+ * IVs only, other IVs stay on the CPU. SM4-XTS is one data unit per call and
+ * only data units up to AFALG_MAX_OP_SIZE are offloaded. A context is used
+ * by one thread at a time.
+ */
+#define AFALG_DEFAULT_THRESHOLD		(16 * 1024)
+#define AFALG_MAX_OP_SIZE		(64 * 1024) // 16 pages, the pages of one splice
+#define AFALG_SPLICE_MIN_SIZE		4096
+
+typedef struct {
+	int tfm_fd; // -1 if the kernel has no such algorithm
+	int op_fd;
+	int pipe_fd[2]; // for vmsplice(), -1 if not available
+	size_t threshold;
+} AFALG_CTX;
+
+// return 1 with the socket open, 0 if the kernel can not do it
+int afalg_open(AFALG_CTX *ctx, const char *type, const char *name, const uint8_t *key, size_t keylen);
+void afalg_set_threshold(AFALG_CTX *ctx, size_t threshold);
+int afalg_is_offloaded(const AFALG_CTX *ctx);
+void afalg_close(AFALG_CTX *ctx);
+
+
+typedef struct {
+	AFALG_CTX alg;
+} SM3_AFALG_CTX;
+
+int sm3_afalg_init(SM3_AFALG_CTX *ctx);
+int sm3_afalg_digest(SM3_AFALG_CTX *ctx, const uint8_t *data, size_t datalen, uint8_t dgst[SM3_DIGEST_SIZE]);
+void sm3_afalg_cleanup(SM3_AFALG_CTX *ctx);
+
+
+enum {
+	SM4_AFALG_cbc,
+	SM4_AFALG_ctr,
+	SM4_AFALG_gcm,
+	SM4_AFALG_xts,
+};
+
+typedef struct {
+	AFALG_CTX alg;
+	int mode;
+	SM4_KEY enc_key;
+	SM4_KEY dec_key; // cbc, xts
+	SM4_KEY tweak_key; // xts
+} SM4_AFALG_CTX;
+
+// `keylen` is 32 for SM4_AFALG_xts (key1 || key2) and 16 for the other modes
+int sm4_afalg_init(SM4_AFALG_CTX *ctx, int mode, const uint8_t *key, size_t keylen);
+void sm4_afalg_cleanup(SM4_AFALG_CTX *ctx);
+
+// the same results and `iv`, `ctr` updates as sm4_cbc_encrypt_blocks(), sm4_ctr_encrypt(), ...
+int sm4_afalg_cbc_encrypt_blocks(SM4_AFALG_CTX *ctx, uint8_t iv[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+int sm4_afalg_cbc_decrypt_blocks(SM4_AFALG_CTX *ctx, uint8_t iv[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+int sm4_afalg_ctr_encrypt(SM4_AFALG_CTX *ctx, uint8_t ctr[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t inlen, uint8_t *out);
+int sm4_afalg_gcm_encrypt(SM4_AFALG_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag);
+int sm4_afalg_gcm_decrypt(SM4_AFALG_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	const uint8_t *tag, size_t taglen, uint8_t *out);
+#ifdef ENABLE_SM4_XTS
+int sm4_afalg_xts_encrypt(SM4_AFALG_CTX *ctx, const uint8_t tweak[16],
+	const uint8_t *in, size_t inlen, uint8_t *out);
+int sm4_afalg_xts_decrypt(SM4_AFALG_CTX *ctx, const uint8_t tweak[16],
+	const uint8_t *in, size_t inlen, uint8_t *out);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,57 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_ARENA_H
+#define GMSSL_ARENA_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Bump allocator for temporaries of one operation, e.g. a handshake.
+
+Memory is taken from blocks of `block_size` bytes, a larger request gets a block
+of its own. Allocations are ARENA_ALIGN aligned and not freed one by one:
+arena_release() frees everything allocated after an arena_get_mark(), so a
+function can scope its temporaries, arena_reset() frees all but keeps the
+first block for the next operation, arena_cleanup() frees the blocks. Released
+memory is wiped, as it may hold secrets. A zeroed ARENA is ready to use with
+ARENA_DEFAULT_BLOCK_SIZE blocks. An arena is not thread-safe.
+*/
+#define ARENA_DEFAULT_BLOCK_SIZE	(16 * 1024)
+#define ARENA_ALIGN			16
+
+typedef struct ARENA_BLOCK_st ARENA_BLOCK;
+
+typedef struct {
+	ARENA_BLOCK *block; // current block, linked to the earlier ones
+	size_t block_size;
+} ARENA;
+
+typedef struct {
+	ARENA_BLOCK *block;
+	size_t used;
+} ARENA_MARK;
+
+void arena_init(ARENA *arena, size_t block_size);
+void *arena_alloc(ARENA *arena, size_t size);
+void arena_get_mark(const ARENA *arena, ARENA_MARK *mark);
+void arena_release(ARENA *arena, const ARENA_MARK *mark);
+void arena_reset(ARENA *arena);
+void arena_cleanup(ARENA *arena);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
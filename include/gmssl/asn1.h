@@ -180,6 +180,13 @@ typedef struct {
 	char *description;
 } ASN1_OID_INFO;
 
+/*
+ * The lookups by `oid` and by the DER nodes index a table at its first use,
+ * keyed by its address. A table is expected to live as long as the process,
+ * a freed one only slows down the lookups of a table at the same address.
+ * asn1_oid_index_cleanup() frees all the indexes, not with lookups running.
+ */
+void asn1_oid_index_cleanup(void);
 const ASN1_OID_INFO *asn1_oid_info_from_name(const ASN1_OID_INFO *infos, size_t count, const char *name);
 const ASN1_OID_INFO *asn1_oid_info_from_oid(const ASN1_OID_INFO *infos, size_t count, int oid);
 
@@ -281,6 +288,22 @@ int asn1_header_to_der(int tag, size_t dlen, uint8_t **out, size_t *outlen);
 
 #define asn1_explicit_header_to_der(i,dlen,out,outlen) asn1_header_to_der(ASN1_TAG_EXPLICIT(i),dlen,out,outlen)
 
+// Single-pass encoding of a constructed type: asn1_header_begin writes the tag
+// and a one-byte length, the content is encoded once, asn1_header_end sets
+// the length and moves a long content up to make room for it. Nothing is
+// written beyond the final encoding, and with out == NULL only the lengths
+// are summed, so every nested level is encoded or sized once.
+typedef struct {
+	uint8_t *p; // the tag, NULL when only the length is computed
+	size_t outlen; // *outlen before the content
+} ASN1_HEADER;
+
+int asn1_header_begin(ASN1_HEADER *hdr, int tag, uint8_t **out, size_t *outlen);
+int asn1_header_end(ASN1_HEADER *hdr, uint8_t **out, size_t *outlen);
+#define asn1_sequence_begin(hdr,out,outlen) asn1_header_begin(hdr,ASN1_TAG_SEQUENCE,out,outlen)
+#define asn1_set_begin(hdr,out,outlen) asn1_header_begin(hdr,ASN1_TAG_SET,out,outlen)
+#define asn1_explicit_begin(hdr,i,out,outlen) asn1_header_begin(hdr,ASN1_TAG_EXPLICIT(i),out,outlen)
+
 #define asn1_explicit_to_der(i,d,dlen,out,outlen) asn1_nonempty_type_to_der(ASN1_TAG_EXPLICIT(i),d,dlen,out,outlen)
 #define asn1_explicit_from_der(i,d,dlen,in,inlen) asn1_nonempty_type_from_der(ASN1_TAG_EXPLICIT(i),d,dlen,in,inlen)
 
@@ -289,6 +312,63 @@ int asn1_types_get_count(const uint8_t *d, size_t dlen, int tag, size_t *cnt);
 int asn1_types_get_item_by_index(const uint8_t *d, size_t dlen, int tag,
 	int index, const uint8_t **item_d, size_t *item_dlen);
 
+// Offsets of the TLVs in d,dlen (the V of a SEQUENCE), indexed once and then
+// accessed without decoding or copying, fields are parsed only when needed
+#define ASN1_CURSOR_MAX_FIELDS 16
+
+typedef struct {
+	int tag;
+	const uint8_t *a; // the TLV
+	const uint8_t *d; // the V
+	size_t dlen;
+} ASN1_FIELD;
+
+typedef struct {
+	ASN1_FIELD fields[ASN1_CURSOR_MAX_FIELDS];
+	size_t fields_cnt;
+} ASN1_CURSOR;
+
+int asn1_cursor_init(ASN1_CURSOR *cur, const uint8_t *d, size_t dlen);
+// return 0 if index >= fields_cnt
+int asn1_cursor_get(const ASN1_CURSOR *cur, size_t index, int *tag, const uint8_t **d, size_t *dlen);
+int asn1_cursor_get_tlv(const ASN1_CURSOR *cur, size_t index, const uint8_t **a, size_t *alen);
+
+/*
+Parsing budget of untrusted input
+
+While a context is set on the calling thread, every element decoded by the
+asn1_*_from_der() functions, and so by the X.509, CMS and TLS decoders on top
+of them, is charged one element and its length in bytes, and its depth is the
+number of constructed elements still open around it. Exceeding a limit fails
+this decoding and all the later ones until the context is reset, so a hostile
+input costs at most the budget. Limits of 0 are replaced by the defaults.
+*/
+#define ASN1_PARSE_MAX_DEPTH		32
+#define ASN1_PARSE_DEFAULT_DEPTH	16
+#define ASN1_PARSE_DEFAULT_ELEMENTS	8192
+#define ASN1_PARSE_DEFAULT_BYTES	(4 * 1024 * 1024)
+
+typedef struct {
+	size_t max_depth;
+	size_t max_elements;
+	size_t max_bytes;
+	size_t depth;
+	size_t elements;
+	size_t bytes;
+	int exhausted;
+	struct {
+		const uint8_t *d;
+		const uint8_t *end;
+	} open[ASN1_PARSE_MAX_DEPTH];
+} ASN1_PARSE_CTX;
+
+int asn1_parse_ctx_init(ASN1_PARSE_CTX *ctx, size_t max_depth, size_t max_elements, size_t max_bytes);
+void asn1_parse_ctx_reset(ASN1_PARSE_CTX *ctx);
+// return the context set before, NULL removes the budget
+ASN1_PARSE_CTX *asn1_parse_ctx_set(ASN1_PARSE_CTX *ctx);
+// return 1 if a decoding failed on the budget
+int asn1_parse_ctx_exhausted(const ASN1_PARSE_CTX *ctx);
+
 
 
 
@@ -52,6 +52,22 @@ int  base64_decode_finish(BASE64_CTX *ctx, uint8_t *out, int *outlen);
 int base64_encode_block(unsigned char *t, const unsigned char *f, int dlen);
 int base64_decode_block(unsigned char *t, const unsigned char *f, int n);
 
+// Decode the leading groups of 4 alphabet characters (no padding, no whitespace) of `in`,
+// return the number of characters consumed, 3 bytes are output for every 4 of them
+size_t base64_decode_run(uint8_t *out, const uint8_t *in, size_t inlen);
+
+// Bulk kernels of the optional backends, `base64_encode_block`, `base64_decode_block` and
+// `base64_decode_run` dispatch to them when supported by the CPU, see `gmssl_cpu_features`.
+// The decoders stop before the first block with a character out of the alphabet.
+#ifdef ENABLE_BASE64_AVX2
+void base64_avx2_encode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks); // 24 bytes to 32 chars
+size_t base64_avx2_decode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks);
+#endif
+#ifdef ENABLE_BASE64_NEON
+void base64_neon_encode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks); // 48 bytes to 64 chars
+size_t base64_neon_decode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -18,6 +18,9 @@
 #ifdef ENABLE_AES
 #include <gmssl/aes.h>
 #endif
+#ifdef ENABLE_CHACHA20
+#include <gmssl/chacha20.h>
+#endif
 
 
 #ifdef __cplusplus
@@ -38,6 +41,9 @@ struct BLOCK_CIPHER_KEY {
 		SM4_KEY sm4_key;
 #ifdef ENABLE_AES
 		AES_KEY aes_key;
+#endif
+#ifdef ENABLE_CHACHA20
+		uint8_t chacha20_key[CHACHA20_KEY_SIZE];
 #endif
 	} u;
 	const BLOCK_CIPHER *cipher;
@@ -47,6 +53,13 @@ typedef void (*block_cipher_set_encrypt_key_func)(BLOCK_CIPHER_KEY *key, const u
 typedef void (*block_cipher_set_decrypt_key_func)(BLOCK_CIPHER_KEY *key, const uint8_t *raw_key);
 typedef void (*block_cipher_encrypt_func)(const BLOCK_CIPHER_KEY *key, const uint8_t *in, uint8_t *out);
 typedef void (*block_cipher_decrypt_func)(const BLOCK_CIPHER_KEY *key, const uint8_t *in, uint8_t *out);
+// the AEAD of the cipher (GCM, or Poly1305 for ChaCha20), keyed with the encryption key
+typedef int (*block_cipher_aead_encrypt_func)(const BLOCK_CIPHER_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag);
+typedef int (*block_cipher_aead_decrypt_func)(const BLOCK_CIPHER_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	const uint8_t *tag, size_t taglen, uint8_t *out);
 
 struct BLOCK_CIPHER {
 	int oid;
@@ -56,12 +69,18 @@ struct BLOCK_CIPHER {
 	block_cipher_set_decrypt_key_func set_decrypt_key;
 	block_cipher_encrypt_func encrypt;
 	block_cipher_decrypt_func decrypt;
+	block_cipher_aead_encrypt_func aead_encrypt;
+	block_cipher_aead_decrypt_func aead_decrypt;
 };
 
 const BLOCK_CIPHER *BLOCK_CIPHER_sm4(void);
 #ifdef ENABLE_AES
 const BLOCK_CIPHER *BLOCK_CIPHER_aes128(void);
 #endif
+#ifdef ENABLE_CHACHA20
+// a stream cipher without `encrypt`/`decrypt`, only the key is kept for the ChaCha20-Poly1305 AEAD
+const BLOCK_CIPHER *BLOCK_CIPHER_chacha20(void);
+#endif
 
 const BLOCK_CIPHER *block_cipher_from_name(const char *name);
 const char *block_cipher_name(const BLOCK_CIPHER *cipher);
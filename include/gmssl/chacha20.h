@@ -27,6 +27,7 @@
 #define CHACHA20_KEY_SIZE	(CHACHA20_KEY_BITS/8)
 #define CHACHA20_NONCE_SIZE	(CHACHA20_NONCE_BITS/8)
 #define CHACHA20_COUNTER_SIZE	(CHACHA20_COUNTER_BITS/8)
+#define CHACHA20_BLOCK_SIZE	64
 
 #define CHACHA20_KEY_WORDS	(CHACHA20_KEY_SIZE/sizeof(uint32_t))
 #define CHACHA20_NONCE_WORDS	(CHACHA20_NONCE_SIZE/sizeof(uint32_t))
@@ -50,6 +51,33 @@ void chacha20_init(CHACHA20_STATE *state,
 void chacha20_generate_keystream(CHACHA20_STATE *state,
 	size_t counts, uint8_t *out);
 
+// xor `inlen` bytes of keystream, the counter advances by every started block
+void chacha20_encrypt(CHACHA20_STATE *state,
+	const uint8_t *in, size_t inlen, uint8_t *out);
+
+#ifdef ENABLE_CHACHA20_AVX2
+void chacha20_avx2_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out);
+#endif
+#ifdef ENABLE_CHACHA20_NEON
+void chacha20_neon_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out);
+#endif
+
+
+/*
+ChaCha20-Poly1305 AEAD (RFC 8439)
+
+	* `iv` is the 96-bit nonce, `ivlen` must be CHACHA20_NONCE_SIZE
+	* the tag may be truncated to `taglen` bytes
+*/
+#define CHACHA20_POLY1305_MAX_TAG_SIZE	16
+
+int chacha20_poly1305_encrypt(const uint8_t key[CHACHA20_KEY_SIZE],
+	const uint8_t *iv, size_t ivlen, const uint8_t *aad, size_t aadlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t taglen, uint8_t *tag);
+int chacha20_poly1305_decrypt(const uint8_t key[CHACHA20_KEY_SIZE],
+	const uint8_t *iv, size_t ivlen, const uint8_t *aad, size_t aadlen,
+	const uint8_t *in, size_t inlen, const uint8_t *tag, size_t taglen, uint8_t *out);
+
 
 #ifdef __cplusplus
 }
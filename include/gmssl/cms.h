@@ -22,6 +22,7 @@ References:
 #include <string.h>
 #include <stdint.h>
 #include <sys/types.h>
+#include <gmssl/sm4.h>
 #include <gmssl/x509.h>
 
 
@@ -494,6 +495,21 @@ int cms_envelop(
 	const uint8_t *shared_info1, size_t shared_info1_len,
 	const uint8_t *shared_info2, size_t shared_info2_len);
 
+/*
+ * cms_envelop() for many recipients: the content is encrypted once and the
+ * per-recipient SM2 key wrapping is split across `threads`, <= 0 for one per
+ * online CPU, at most CMS_MAX_THREADS. Only OID_sm4_cbc is supported.
+ */
+#define CMS_MAX_THREADS	64
+int cms_envelop_multi(
+	uint8_t *cms, size_t *cms_len,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	int content_type, const uint8_t *content, size_t content_len,
+	const uint8_t *shared_info1, size_t shared_info1_len,
+	const uint8_t *shared_info2, size_t shared_info2_len,
+	int threads);
+
 int cms_deenvelop(
 	const uint8_t *cms, size_t cms_len,
 	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len,
@@ -532,6 +548,115 @@ int cms_set_key_agreement_info(
 	const uint8_t *user_cert, size_t user_cert_len,
 	const uint8_t *user_id, size_t user_id_len);
 
+/*
+Streaming SignedData and EnvelopedData of OID_cms_data content
+
+The content length is given to (or parsed by) `init`, so the output is plain DER
+and matches `cms_sign` and `cms_envelop`: a header from `init`, the content
+(raw for SignedData, encrypted by `update` for EnvelopedData), then a trailer
+from `finish`. The content is limited to the DER lengths of asn1.c (INT_MAX).
+
+The `*_init` of verify and deenvelop parse the header from a prefix of the
+input, `header_len` bytes are consumed, followed by `content_len` bytes of
+content and `trailer_len` bytes to be given to `*_finish`.
+*/
+typedef struct {
+	SM3_CTX sm3_ctx;
+	const CMS_CERTS_AND_KEY *signers;
+	size_t signers_cnt;
+	const uint8_t *crls;
+	size_t crls_len;
+	size_t content_len;
+	size_t content_nbytes;
+	size_t trailer_len;
+} CMS_SIGN_CTX;
+
+int cms_sign_init(CMS_SIGN_CTX *ctx,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	const uint8_t *crls, size_t crls_len, size_t content_len,
+	uint8_t *header, size_t *header_len, size_t maxlen);
+int cms_sign_update(CMS_SIGN_CTX *ctx, const uint8_t *content, size_t content_len);
+int cms_sign_finish(CMS_SIGN_CTX *ctx, uint8_t *trailer, size_t *trailer_len, size_t maxlen);
+
+typedef struct {
+	SM3_CTX sm3_ctx;
+	size_t content_len;
+	size_t content_nbytes;
+	size_t trailer_len;
+} CMS_VERIFY_CTX;
+
+int cms_verify_init(CMS_VERIFY_CTX *ctx, const uint8_t *in, size_t inlen,
+	size_t *header_len, size_t *content_len, size_t *trailer_len);
+int cms_verify_update(CMS_VERIFY_CTX *ctx, const uint8_t *content, size_t content_len);
+int cms_verify_finish(CMS_VERIFY_CTX *ctx, const uint8_t *trailer, size_t trailer_len,
+	const uint8_t **certs, size_t *certs_len,
+	const uint8_t **crls, size_t *crls_len,
+	const uint8_t **signer_infos, size_t *signer_infos_len);
+
+/*
+Detached SignedData over a precomputed digest
+
+The signatures of `cms_sign` are over SM3(ContentInfo header || content), the
+header depends on the content type and length. `cms_content_digest_init` hashes
+that header, the content can then be hashed anywhere with `sm3_update`, and
+`sm3_finish` gives the `dgst` of `cms_sign_digest` and `cms_verify_digest`.
+
+`cms_sign_digest` outputs SignedData without content. `cms_verify_digest` does
+not read any content, it checks every SignerInfo against `dgst`, split across
+`threads` (<= 0 for one per online CPU, at most CMS_MAX_THREADS). SignerInfos
+with authenticated attributes are not supported.
+*/
+int cms_content_digest_init(SM3_CTX *ctx, int content_type, size_t content_len);
+int cms_sign_digest(uint8_t *cms, size_t *cms_len,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int content_type, const uint8_t dgst[SM3_DIGEST_SIZE],
+	const uint8_t *crls, size_t crls_len);
+int cms_verify_digest(const uint8_t *cms, size_t cms_len,
+	const uint8_t *extra_certs, size_t extra_certs_len,
+	int content_type, const uint8_t dgst[SM3_DIGEST_SIZE],
+	const uint8_t **certs, size_t *certs_len,
+	const uint8_t **crls, size_t *crls_len,
+	const uint8_t **signer_infos, size_t *signer_infos_len,
+	int threads);
+
+typedef struct {
+	SM4_CBC_CTX cbc_ctx;
+	const uint8_t *shared_info1;
+	size_t shared_info1_len;
+	const uint8_t *shared_info2;
+	size_t shared_info2_len;
+	size_t content_len;
+	size_t content_nbytes;
+	size_t trailer_len;
+} CMS_ENVELOP_CTX;
+
+// `update` outputs at most inlen + 15 bytes, `finish` a trailer of ctx->trailer_len bytes
+int cms_envelop_init(CMS_ENVELOP_CTX *ctx,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *shared_info1, size_t shared_info1_len,
+	const uint8_t *shared_info2, size_t shared_info2_len,
+	size_t content_len, uint8_t *header, size_t *header_len, size_t maxlen);
+int cms_envelop_update(CMS_ENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int cms_envelop_finish(CMS_ENVELOP_CTX *ctx, uint8_t *trailer, size_t *trailer_len, size_t maxlen);
+
+typedef struct {
+	SM4_CBC_CTX cbc_ctx;
+	size_t content_len; // of the encrypted content
+	size_t content_nbytes;
+	size_t trailer_len;
+} CMS_DEENVELOP_CTX;
+
+// `update` outputs at most inlen + 15 bytes, `finish` at most 16
+int cms_deenvelop_init(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen,
+	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len,
+	size_t *header_len, size_t *content_len, size_t *trailer_len);
+int cms_deenvelop_update(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int cms_deenvelop_finish(CMS_DEENVELOP_CTX *ctx, const uint8_t *trailer, size_t trailer_len,
+	uint8_t *out, size_t *outlen,
+	const uint8_t **shared_info1, size_t *shared_info1_len,
+	const uint8_t **shared_info2, size_t *shared_info2_len);
+
 #define PEM_CMS "CMS"
 int cms_to_pem(const uint8_t *cms, size_t cms_len, FILE *fp);
 int cms_from_pem(uint8_t *cms, size_t *cms_len, size_t maxlen, FILE *fp);
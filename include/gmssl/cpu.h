@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_CPU_H
+#define GMSSL_CPU_H
+
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// x86/x86_64, detected with cpuid and xgetbv (OS support of the register state)
+#define GMSSL_CPU_SSSE3		((uint64_t)1 << 0)
+#define GMSSL_CPU_AESNI		((uint64_t)1 << 1)
+#define GMSSL_CPU_PCLMUL	((uint64_t)1 << 2)
+#define GMSSL_CPU_AVX		((uint64_t)1 << 3)
+#define GMSSL_CPU_AVX2		((uint64_t)1 << 4)
+#define GMSSL_CPU_BMI2		((uint64_t)1 << 5)
+#define GMSSL_CPU_ADX		((uint64_t)1 << 6)
+#define GMSSL_CPU_SHA		((uint64_t)1 << 7)
+#define GMSSL_CPU_AVX512F	((uint64_t)1 << 8)
+#define GMSSL_CPU_AVX512BW	((uint64_t)1 << 9)
+#define GMSSL_CPU_AVX512VL	((uint64_t)1 << 10)
+#define GMSSL_CPU_AVX512IFMA	((uint64_t)1 << 11)
+#define GMSSL_CPU_GFNI		((uint64_t)1 << 12)
+#define GMSSL_CPU_VAES		((uint64_t)1 << 13)
+#define GMSSL_CPU_VPCLMULQDQ	((uint64_t)1 << 14)
+
+// AArch64, detected with getauxval(AT_HWCAP) on Linux
+#define GMSSL_CPU_NEON		((uint64_t)1 << 32)
+#define GMSSL_CPU_ARM_AES	((uint64_t)1 << 33)
+#define GMSSL_CPU_ARM_PMULL	((uint64_t)1 << 34)
+#define GMSSL_CPU_ARM_SHA2	((uint64_t)1 << 35)
+#define GMSSL_CPU_ARM_SHA512	((uint64_t)1 << 36)
+#define GMSSL_CPU_ARM_SM3	((uint64_t)1 << 37)
+#define GMSSL_CPU_ARM_SM4	((uint64_t)1 << 38)
+
+// RISC-V, detected with riscv_hwprobe(2) on Linux
+#define GMSSL_CPU_RISCV_V	((uint64_t)1 << 48)
+#define GMSSL_CPU_RISCV_ZKSED	((uint64_t)1 << 49)
+#define GMSSL_CPU_RISCV_ZKSH	((uint64_t)1 << 50)
+
+// WebAssembly, SIMD128 is a property of the module, set when it is built with -msimd128
+#define GMSSL_CPU_WASM_SIMD128	((uint64_t)1 << 56)
+
+/*
+ * Features of the running CPU, probed once and cached.
+ * Backends selected at runtime (SM4, GHASH, ...) use this to pick the
+ * fastest kernel compiled into the library.
+ */
+uint64_t gmssl_cpu_features(void);
+
+/*
+ * Mask off features before the first call of any dispatched function,
+ * e.g. to avoid AVX-512 frequency throttling or to test fallback paths.
+ * Kernels already resolved are not changed.
+ */
+void gmssl_cpu_disable_features(uint64_t features);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
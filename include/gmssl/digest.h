@@ -30,6 +30,7 @@ extern "C" {
 
 typedef struct DIGEST DIGEST;
 typedef struct DIGEST_CTX DIGEST_CTX;
+typedef SM3_IOVEC DIGEST_IOVEC;
 
 
 #define DIGEST_MAX_SIZE		64
@@ -60,6 +61,7 @@ struct DIGEST {
 	int (*init)(DIGEST_CTX *ctx);
 	int (*update)(DIGEST_CTX *ctx, const uint8_t *data, size_t datalen);
 	int (*finish)(DIGEST_CTX *ctx, uint8_t *dgst);
+	int (*updatev)(DIGEST_CTX *ctx, const DIGEST_IOVEC *iov, size_t iovcnt); // NULL for update() per buffer
 };
 
 const DIGEST *DIGEST_sm3(void);
@@ -79,6 +81,7 @@ const DIGEST *digest_from_name(const char *name);
 const char *digest_name(const DIGEST *digest);
 int digest_init(DIGEST_CTX *ctx, const DIGEST *algor);
 int digest_update(DIGEST_CTX *ctx, const uint8_t *data, size_t datalen);
+int digest_updatev(DIGEST_CTX *ctx, const DIGEST_IOVEC *iov, size_t iovcnt);
 int digest_finish(DIGEST_CTX *ctx, uint8_t *dgst, size_t *dgstlen);
 int digest(const DIGEST *digest, const uint8_t *data, size_t datalen, uint8_t *dgst, size_t *dgstlen);
 
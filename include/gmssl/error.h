@@ -32,6 +32,34 @@ extern "C" {
 
 #define DEBUG 1
 
+/*
+ * Error sites write to stderr by default. With ENABLE_ERROR_QUEUE they are
+ * recorded in a queue of the thread without any I/O, the location is only
+ * formatted by error_queue_print(), the newest ERROR_QUEUE_SIZE errors are
+ * kept. With ENABLE_ERROR_COUNT they only add to error_count(), e.g. for
+ * servers under malformed traffic where a failed handshake should cost no
+ * more than the crypto it tried.
+ */
+#if defined(ENABLE_ERROR_COUNT)
+
+#define warning_print()			error_count_add()
+#define error_print()			error_count_add()
+#define error_print_msg(fmt, ...)	error_count_add()
+#define error_puts(str)			error_count_add()
+
+#elif defined(ENABLE_ERROR_QUEUE)
+
+#define warning_print() \
+	error_queue_push(__FILE__, __LINE__, __FUNCTION__, NULL)
+#define error_print() \
+	error_queue_push(__FILE__, __LINE__, __FUNCTION__, NULL)
+#define error_print_msg(fmt, ...) \
+	error_queue_push_msg(__FILE__, __LINE__, __FUNCTION__, fmt, __VA_ARGS__)
+#define error_puts(str) \
+	error_queue_push(__FILE__, __LINE__, __FUNCTION__, str)
+
+#else
+
 #define warning_print() \
 	do { if (DEBUG) fprintf(stderr, "%s:%d:%s():\n",__FILE__, __LINE__, __FUNCTION__); } while (0)
 
@@ -44,6 +72,25 @@ extern "C" {
 #define error_puts(str) \
             do { if (DEBUG) fprintf(stderr, "%s: %d: %s: %s\n", __FILE__, __LINE__, __FUNCTION__, str); } while (0)
 
+#endif
+
+#define ERROR_QUEUE_SIZE	16
+#define ERROR_MSG_SIZE		128
+
+// `str` is kept by reference, the message of error_queue_push_msg() is copied
+void error_queue_push(const char *file, int line, const char *func, const char *str);
+void error_queue_push_msg(const char *file, int line, const char *func, const char *fmt, ...);
+// take the oldest error of the thread, return 0 if there is none, `*msg` may be
+// NULL and is valid until the next error of the thread
+int error_queue_get(const char **file, int *line, const char **func, const char **msg);
+void error_queue_clear(void);
+// print and remove the errors of the thread
+int error_queue_print(FILE *fp);
+
+// errors of the thread since it started, counted in the queue and count modes
+void error_count_add(void);
+uint64_t error_count(void);
+
 
 void print_der(const uint8_t *in, size_t inlen);
 void print_bytes(const uint8_t *in, size_t inlen);
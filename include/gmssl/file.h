@@ -21,6 +21,53 @@ extern "C" {
 
 int file_size(FILE *fp, size_t *size);
 int file_read_all(const char *file, uint8_t **out, size_t *outlen);
+// read-only mapping of the whole file, `*data` is NULL for an empty file
+int file_map(const char *file, const uint8_t **data, size_t *datalen);
+void file_unmap(const uint8_t *data, size_t datalen);
+
+/*
+Streaming input of the command line tools
+
+	* a regular file is mapped in FILE_READ_MAP_SIZE windows with sequential
+	  read-ahead advice, a window is unmapped when the next one is mapped
+	* pipes and terminals are read into one page-aligned buffer, a read
+	  returns only when FILE_READ_CHUNK_SIZE bytes or the end of input are
+	  reached, on Linux the pipe buffer is enlarged so the writer can run ahead
+	* with FILE_READ_DIRECT a regular file is read with O_DIRECT into the
+	  aligned buffer, bypassing the page cache, if the file system refuses
+	  O_DIRECT the file is mapped as usual
+	* `file_read_next` returns 1 with at most FILE_READ_CHUNK_SIZE bytes valid
+	  until the next call, 0 at the end of input and -1 on error
+*/
+#define FILE_READ_CHUNK_SIZE	(4 * 1024 * 1024)
+#define FILE_READ_MAP_SIZE	(64 * 1024 * 1024)
+#define FILE_READ_DIRECT	1
+
+/*
+ * Output buffer of the cipher tools for one chunk: an update may also output
+ * the blocks (or the partial ZUC word) it kept from the previous call, and
+ * the finish adds at most the padding or the tag.
+ */
+#define FILE_CIPHER_OVERHEAD	256
+#define FILE_CIPHER_OUTBUF_SIZE	(FILE_READ_CHUNK_SIZE + FILE_CIPHER_OVERHEAD)
+
+typedef struct {
+	FILE *fp;
+	int fd;
+	int flags;
+	int eof;
+	uint64_t size; // of a mapped regular file
+	uint64_t offset; // file offset of the next window
+	const uint8_t *map;
+	size_t maplen;
+	size_t mapskip; // window bytes before the start of input
+	size_t mappos;
+	uint8_t *buf;
+} FILE_READER;
+
+int file_read_init(FILE_READER *rd, FILE *fp, int flags);
+int file_read_next(FILE_READER *rd, const uint8_t **data, size_t *datalen);
+void file_read_cleanup(FILE_READER *rd);
 
 
 #ifdef __cplusplus
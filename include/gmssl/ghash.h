@@ -23,6 +23,7 @@ extern "C" {
 
 
 #define GHASH_SIZE		(16)
+#define GHASH_TABLE_SIZE	(8)
 
 
 // h = ENC_k(0^128)
@@ -36,12 +37,36 @@ typedef struct {
 	size_t clen;
 	uint8_t block[16];
 	size_t num;
+	int clmul; // H_table is set and a carry-less multiply kernel is used
+	uint64_t H_table[GHASH_TABLE_SIZE][2]; // H^1, ..., H^8
+	uint64_t H_table4[16][2]; // 4-bit Shoup table H * i of the portable path, set when no faster path is taken
+#ifdef ENABLE_GHASH_WASM
+	int table8; // H_table8 is set and the SIMD128 kernel is used
+	uint8_t H_table8[256][16];
+#endif
 } GHASH_CTX;
 
 void ghash_init(GHASH_CTX *ctx, const uint8_t h[16], const uint8_t *aad, size_t aadlen);
 void ghash_update(GHASH_CTX *ctx, const uint8_t *c, size_t clen);
 void ghash_finish(GHASH_CTX *ctx, uint8_t out[16]);
 
+#ifdef ENABLE_GHASH_PCLMUL
+void ghash_pclmul_init_table(uint64_t H_table[GHASH_TABLE_SIZE][2], const uint8_t h[16]);
+void ghash_pclmul_update_blocks(const uint64_t H_table[GHASH_TABLE_SIZE][2],
+	uint8_t X[16], const uint8_t *in, size_t nblocks);
+#endif
+
+#ifdef ENABLE_GHASH_PMULL
+void ghash_pmull_init_table(uint64_t H_table[GHASH_TABLE_SIZE][2], const uint8_t h[16]);
+void ghash_pmull_update_blocks(const uint64_t H_table[GHASH_TABLE_SIZE][2],
+	uint8_t X[16], const uint8_t *in, size_t nblocks);
+#endif
+
+#ifdef ENABLE_GHASH_WASM
+void ghash_wasm_init_table(uint8_t T[256][16], const uint8_t h[16]);
+void ghash_wasm_update_blocks(const uint8_t T[256][16], uint8_t X[16], const uint8_t *in, size_t nblocks);
+#endif
+
 
 #ifdef __cplusplus
 }
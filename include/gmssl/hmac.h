@@ -33,6 +33,7 @@ typedef struct hmac_ctx_st {
 size_t hmac_size(const HMAC_CTX *ctx);
 
 int hmac_init(HMAC_CTX *ctx, const DIGEST *digest, const uint8_t *key, size_t keylen);
+int hmac_reset(HMAC_CTX *ctx);
 int hmac_update(HMAC_CTX *ctx, const uint8_t *data, size_t datalen);
 int hmac_finish(HMAC_CTX *ctx, uint8_t *mac, size_t *maclen);
 
@@ -12,6 +12,7 @@
 #define GMSSL_HTTP_H
 
 #include <stdint.h>
+#include <stdlib.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,6 +24,54 @@ int http_parse_response(char *buf, size_t buflen, uint8_t **content, size_t *con
 int http_get(const char *uri, uint8_t *buf, size_t *contentlen, size_t buflen);
 
 
+#define HTTP_MAX_CONTENT_SIZE	(64 * 1024 * 1024)
+
+// validators of a previous response, empty strings if not sent by the server
+typedef struct {
+	char etag[128];
+	char last_modified[64];
+} HTTP_VALIDATORS;
+
+/*
+ * GET into a malloc'ed buffer. With non-empty `validators` the request is
+ * conditional and 0 is returned on 304 Not Modified, on 200 OK `validators` is
+ * updated from the response headers.
+ */
+int http_get_new(const char *uri, HTTP_VALIDATORS *validators, uint8_t **content, size_t *contentlen);
+
+/*
+ * HTTP/1.1 client keeping the connections to each host:port open for the next
+ * GETs, so the CRLs of many CAs on a few servers are fetched over a few
+ * connections. http_get_new() uses a client shared by the process.
+ *
+ * The body, framed by Content-Length, chunked transfer coding or the end of
+ * the connection, is passed to `body_cb` as it is received. `content_length`
+ * is the announced length or HTTP_LENGTH_UNKNOWN, so the receiver can size
+ * its buffer once. `timeout` in seconds bounds each send and recv, and the
+ * connect on Linux. Idle connections are closed after HTTP_CLIENT_IDLE_SECONDS.
+ * A client can be used by several threads. A NULL client makes one connection
+ * per GET.
+ */
+#define HTTP_CLIENT_MAX_IDLE_CONNS	16
+#define HTTP_CLIENT_IDLE_SECONDS	30
+#define HTTP_CLIENT_DEFAULT_TIMEOUT	30
+#define HTTP_LENGTH_UNKNOWN		((size_t)-1)
+
+typedef int (*HTTP_BODY_CALLBACK)(void *arg, size_t content_length, const uint8_t *data, size_t datalen);
+
+typedef struct HTTP_CLIENT_st HTTP_CLIENT;
+
+HTTP_CLIENT *http_client_new(int timeout);
+void http_client_free(HTTP_CLIENT *client);
+// return 1 on 200 OK, 0 on 304 Not Modified, see http_get_new
+int http_client_get(HTTP_CLIENT *client, const char *uri, HTTP_VALIDATORS *validators,
+	HTTP_BODY_CALLBACK body_cb, void *cb_arg);
+int http_client_get_new(HTTP_CLIENT *client, const char *uri, HTTP_VALIDATORS *validators,
+	uint8_t **content, size_t *contentlen);
+size_t http_client_idle_count(HTTP_CLIENT *client);
+size_t http_client_connect_count(HTTP_CLIENT *client);
+
+
 #ifdef __cplusplus
 }
 #endif
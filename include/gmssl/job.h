@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_JOB_H
+#define GMSSL_JOB_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Asynchronous jobs
+ *
+ * A GMSSL_JOB describes one call of a crypto function. gmssl_job_submit()
+ * queues it and returns at once, a thread of the queue takes the queued jobs
+ * in batches of up to `max_batch` and runs them together: SM3 digests on the
+ * multi-buffer engine (sm3_digest_batch), SM2 verifications with
+ * sm2_do_verify_batch(), and the other jobs on the library thread pool (see
+ * thread_pool.h). GMSSL_JOB_custom runs func(arg), for an SDF device, an
+ * OpenCL queue or any other backend the application drives itself.
+ *
+ * A finished job has `ret` set to the return value of the function it
+ * stands for. Its callback, if any, is called from the thread of the queue
+ * and must not block. Finished jobs without callback are returned by
+ * gmssl_job_poll() in the order they finish. On POSIX systems
+ * gmssl_job_queue_fd() is readable while such jobs are waiting, for
+ * select(), poll() or epoll in an event loop.
+ *
+ * The job and all the buffers it points to belong to the caller and must
+ * stay valid until the job is returned or its callback is called.
+ */
+enum {
+	GMSSL_JOB_sm3_digest = 1,	// in, inlen -> out (32 bytes)
+	GMSSL_JOB_sm2_sign,		// key (SM2_KEY), dgst -> out, outlen (DER, SM2_MAX_SIGNATURE_SIZE)
+	GMSSL_JOB_sm2_verify,		// key (SM2_KEY), dgst, in, inlen (DER signature)
+	GMSSL_JOB_sm4_gcm_encrypt,	// key (SM4_KEY), iv, aad, in -> out, tag, taglen
+	GMSSL_JOB_sm4_gcm_decrypt,	// key (SM4_KEY), iv, aad, in, tag, taglen -> out
+	GMSSL_JOB_sm9_encrypt,		// key (SM9_ENC_MASTER_KEY), id, in -> out, outlen (DER)
+	GMSSL_JOB_sm9_decrypt,		// key (SM9_ENC_KEY), id, in (DER) -> out, outlen
+	GMSSL_JOB_custom,		// func(arg)
+	GMSSL_JOB_sm2_decrypt,		// key (SM2_KEY), in (DER) -> out, outlen (SM2_MAX_PLAINTEXT_SIZE)
+	GMSSL_JOB_sm2_ecdh,		// key (SM2_KEY), in (peer public key, 64 or 65 bytes) -> out (64 bytes)
+	GMSSL_JOB_sm4_cbc_encrypt,	// key (16 bytes), iv, in -> out, inlen a multiple of 16
+	GMSSL_JOB_sm4_cbc_decrypt,	// key (16 bytes), iv, in -> out, inlen a multiple of 16
+	GMSSL_JOB_sm4_ctr_encrypt,	// key (16 bytes), iv (initial counter), in -> out
+};
+
+typedef struct GMSSL_JOB_st GMSSL_JOB;
+typedef void (*GMSSL_JOB_CALLBACK)(GMSSL_JOB *job);
+
+struct GMSSL_JOB_st {
+	int op;
+	const void *key;
+	const char *id;
+	size_t idlen;
+	const uint8_t *dgst;
+	const uint8_t *iv;
+	size_t ivlen;
+	const uint8_t *aad;
+	size_t aadlen;
+	const uint8_t *in;
+	size_t inlen;
+	uint8_t *tag;
+	size_t taglen;
+	uint8_t *out;
+	size_t outlen;
+	int (*func)(void *arg);
+	void *arg;
+	GMSSL_JOB_CALLBACK callback;
+	void *callback_arg;
+	int ret;
+
+	// used by the queue
+	GMSSL_JOB *next;
+};
+
+typedef struct GMSSL_JOB_QUEUE_st GMSSL_JOB_QUEUE;
+
+#define GMSSL_JOB_QUEUE_DEFAULT_BATCH	256
+#define GMSSL_JOB_QUEUE_MAX_BATCH	4096
+
+// max_batch 0 for GMSSL_JOB_QUEUE_DEFAULT_BATCH
+GMSSL_JOB_QUEUE *gmssl_job_queue_new(size_t max_batch);
+// the jobs submitted are finished first, and the ones not polled are dropped
+void gmssl_job_queue_free(GMSSL_JOB_QUEUE *queue);
+int gmssl_job_submit(GMSSL_JOB_QUEUE *queue, GMSSL_JOB *job);
+// return 0 if no job is finished, gmssl_job_wait() blocks until one is,
+// and returns 0 if all the jobs submitted have been returned or have callbacks
+int gmssl_job_poll(GMSSL_JOB_QUEUE *queue, GMSSL_JOB **job);
+int gmssl_job_wait(GMSSL_JOB_QUEUE *queue, GMSSL_JOB **job);
+// -1 where there is no such descriptor
+int gmssl_job_queue_fd(const GMSSL_JOB_QUEUE *queue);
+// run `job` in the calling thread, its callback is not called, return and set job->ret
+int gmssl_job_run(GMSSL_JOB *job);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
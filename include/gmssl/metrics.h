@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_METRICS_H
+#define GMSSL_METRICS_H
+
+
+#include <stdio.h>
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Hot path counters of the library, built with ENABLE_METRICS. Every thread
+ * adds to its own counters without locking, metrics_snapshot() sums up the
+ * live threads and the threads that have exited. The `_nsec` counters are the
+ * total time of the operations counted by the counter before them, e.g. the
+ * mean SM2 signing latency is sm2_sign_nsec / sm2_signs. The record bytes are
+ * the plaintext of the encrypted and the ciphertext of the decrypted records.
+ */
+enum {
+	METRICS_tlcp_full_handshakes,
+	METRICS_tlcp_resumed_handshakes,
+	METRICS_tls12_full_handshakes,
+	METRICS_tls12_resumed_handshakes,
+	METRICS_tls13_full_handshakes,
+	METRICS_tls13_resumed_handshakes,
+	METRICS_tls_handshake_failures,
+	METRICS_tls_key_exchange_nsec, // in the order of the TLS_phase_* values
+	METRICS_tls_signature_nsec,
+	METRICS_tls_certificate_verify_nsec,
+	METRICS_tls_key_schedule_nsec,
+	METRICS_tls_sm4_cbc_sm3_encrypt_bytes,
+	METRICS_tls_sm4_cbc_sm3_decrypt_bytes,
+	METRICS_tls_sm4_gcm_encrypt_bytes,
+	METRICS_tls_sm4_gcm_decrypt_bytes,
+	METRICS_sm2_signs,
+	METRICS_sm2_sign_nsec,
+	METRICS_sm2_verifies,
+	METRICS_sm2_verify_nsec,
+	METRICS_x509_verify_cache_hits,
+	METRICS_x509_verify_cache_misses,
+	METRICS_sm2_verify_cache_hits,
+	METRICS_sm2_verify_cache_misses,
+	METRICS_tls_session_cache_hits,
+	METRICS_tls_session_cache_misses,
+	METRICS_rand_reseeds,
+	METRICS_errors, // error sites reached, in the ENABLE_ERROR_QUEUE and ENABLE_ERROR_COUNT modes
+	METRICS_COUNT,
+};
+
+typedef struct {
+	uint64_t values[METRICS_COUNT];
+} METRICS;
+
+// return 0 with all zeros when built without ENABLE_METRICS
+int metrics_snapshot(METRICS *metrics);
+const char *metrics_name(int id);
+int metrics_print(FILE *fp, int fmt, int ind, const char *label, const METRICS *metrics);
+
+void metrics_add(int id, uint64_t val);
+uint64_t metrics_nsec(void); // monotonic clock
+
+
+/*
+ * USDT probes of the `gmssl` provider when <sys/sdt.h> is found, e.g. for
+ * `bpftrace -e 'usdt:libgmssl.so:gmssl:tls_phase_end { @[arg1] = hist(arg2); }'`
+ *
+ *   tls_phase_begin(conn)
+ *   tls_phase_end(conn, phase, nsec)		phase is a TLS_phase_* value
+ *   tls_handshake_done(conn, protocol, resumed)
+ *   tls_handshake_failed(conn, protocol)
+ */
+#ifdef ENABLE_METRICS
+# define METRICS_ADD(id,val)		metrics_add(id,val)
+# define METRICS_NSEC()			metrics_nsec()
+// adds 1 to `id` and the time since `begin` to the next counter
+# define METRICS_LATENCY(id,begin)	do { metrics_add(id,1); metrics_add((id)+1,metrics_nsec()-(begin)); } while (0)
+# ifdef HAVE_SYS_SDT_H
+#  include <sys/sdt.h>
+#  define METRICS_PROBE1(name,a)	DTRACE_PROBE1(gmssl,name,a)
+#  define METRICS_PROBE2(name,a,b)	DTRACE_PROBE2(gmssl,name,a,b)
+#  define METRICS_PROBE3(name,a,b,c)	DTRACE_PROBE3(gmssl,name,a,b,c)
+# endif
+#else
+# define METRICS_ADD(id,val)
+# define METRICS_NSEC()			0
+# define METRICS_LATENCY(id,begin)	((void)(begin))
+#endif
+
+#ifndef METRICS_PROBE1
+# define METRICS_PROBE1(name,a)
+# define METRICS_PROBE2(name,a,b)
+# define METRICS_PROBE3(name,a,b,c)
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,56 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_NUMA_H
+#define GMSSL_NUMA_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * NUMA placement of read-mostly data
+ *
+ * The topology is read once from /sys/devices/system/node on Linux, other
+ * systems are seen as a single node. A thread declares its node with
+ * gmssl_numa_bind_thread(), which also restricts it to the CPUs of the node,
+ * or with gmssl_numa_set_thread_node() if it is already pinned to a CPU.
+ *
+ * gmssl_numa_replica() returns the copy of `data` on the node of the calling
+ * thread. The copy is made at the first call from that node, by that thread,
+ * so the first-touch policy of the kernel puts its pages on the node. Copies
+ * live until the process exits. Unbound threads and single node systems get
+ * `data` itself, so the replica costs a thread-local read where it is unused.
+ *
+ * The SM2 and SM9 generator tables are read through replicas.
+ */
+#define GMSSL_NUMA_MAX_NODES	64
+
+typedef struct {
+	void *copies[GMSSL_NUMA_MAX_NODES];
+} GMSSL_NUMA_REPLICA; // zero initialized, usually static
+
+int gmssl_numa_nodes(void);
+int gmssl_numa_node_of_cpu(int cpu); // 0 if unknown
+int gmssl_numa_bind_thread(int node);
+int gmssl_numa_set_thread_node(int node); // -1 to unbind
+int gmssl_numa_thread_node(void); // -1 if not bound
+const void *gmssl_numa_replica(GMSSL_NUMA_REPLICA *replica, const void *data, size_t datalen);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
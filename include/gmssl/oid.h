@@ -148,6 +148,7 @@ enum {
 	OID_aes256_cbc,
 
 	OID_aes128, // No OID
+	OID_chacha20, // No OID
 
 	OID_ecdsa_with_sha1,
 	OID_ecdsa_with_sha224,
@@ -25,6 +25,26 @@ extern "C" {
 
 int pem_read(FILE *fp, const char *name, uint8_t *out, size_t *outlen, size_t maxlen);
 int pem_write(FILE *fp, const char *name, const uint8_t *in, size_t inlen);
+// decode the next `name` block in memory, text between blocks is skipped,
+// return 0 and consume all of *in when no block is left
+int pem_decode(const char *name, const uint8_t **in, size_t *inlen, uint8_t *out, size_t *outlen, size_t maxlen);
+
+// PEM of unbounded length, one base64 line at a time
+typedef struct {
+	FILE *fp;
+	const char *name;
+	BASE64_CTX base64_ctx;
+	int end;
+} PEM_CTX;
+
+#define PEM_READ_MIN_SIZE 128
+
+int pem_write_init(PEM_CTX *ctx, FILE *fp, const char *name);
+int pem_write_update(PEM_CTX *ctx, const uint8_t *in, size_t inlen);
+int pem_write_finish(PEM_CTX *ctx);
+int pem_read_init(PEM_CTX *ctx, FILE *fp, const char *name);
+// return 0 when the END line has been read, `maxlen` at least PEM_READ_MIN_SIZE
+int pem_read_update(PEM_CTX *ctx, uint8_t *out, size_t *outlen, size_t maxlen);
 
 
 #ifdef __cplusplus
@@ -162,6 +162,28 @@ int pkcs8_enced_private_key_info_from_der(
 	const uint8_t **in, size_t *inlen);
 int pkcs8_enced_private_key_info_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen);
 
+/*
+Process-wide cache of PBKDF2 derived keys of EncryptedPrivateKeyInfo, keyed by
+the salt, the iteration count and the SM3 digest of the password. The cache is
+disabled by default, disabling or clearing it wipes the cached keys.
+*/
+#define PKCS8_KEY_CACHE_SETS		64
+#define PKCS8_KEY_CACHE_WAYS		4
+#define PKCS8_KEY_CACHE_MAX_KEY_SIZE	32
+
+int pkcs8_key_cache_lookup(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, int iter, uint8_t *key, size_t keylen);
+int pkcs8_key_cache_add(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, int iter, const uint8_t *key, size_t keylen);
+void pkcs8_key_cache_clear(void);
+void pkcs8_key_cache_set_enabled(int enabled);
+void pkcs8_key_cache_get_stats(size_t *hits, size_t *misses);
+
+// keylen bytes into keys[i] with SM3-PBKDF2, the cache misses with the same
+// iteration count are derived together by sm3_pbkdf2_batch
+int pkcs8_derive_keys(const char *const *passes, const uint8_t *const *salts, const size_t *saltlens,
+	const int *iters, size_t num, size_t keylen, uint8_t *const *keys);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,51 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_POLY1305_H
+#define GMSSL_POLY1305_H
+
+
+#include <string.h>
+#include <stdint.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#define POLY1305_KEY_SIZE	32
+#define POLY1305_BLOCK_SIZE	16
+#define POLY1305_TAG_SIZE	16
+
+/*
+Poly1305 one-time authenticator (RFC 8439)
+
+	* the accumulator is kept in three 44-bit limbs when the compiler has a
+	  128-bit integer type, otherwise in five 26-bit limbs
+	* a key must never authenticate two messages
+*/
+typedef struct {
+	uint64_t r[5];
+	uint64_t h[5];
+	uint64_t pad[2];
+	uint8_t block[POLY1305_BLOCK_SIZE];
+	size_t num;
+} POLY1305_CTX;
+
+void poly1305_init(POLY1305_CTX *ctx, const uint8_t key[POLY1305_KEY_SIZE]);
+void poly1305_update(POLY1305_CTX *ctx, const uint8_t *data, size_t datalen);
+void poly1305_finish(POLY1305_CTX *ctx, uint8_t tag[POLY1305_TAG_SIZE]);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
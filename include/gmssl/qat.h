@@ -0,0 +1,73 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_QAT_H
+#define GMSSL_QAT_H
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <gmssl/job.h>
+#include <gmssl/tls.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Intel QuickAssist engine (ENABLE_QAT), on the crypto instances of qatlib.
+ *
+ * The engine takes GMSSL_JOB descriptors (see job.h) of the operations QAT
+ * accelerates: GMSSL_JOB_sm3_digest, GMSSL_JOB_sm2_sign, GMSSL_JOB_sm2_verify,
+ * GMSSL_JOB_sm2_decrypt, GMSSL_JOB_sm2_ecdh and the SM4 CBC and CTR jobs.
+ * qat_job_submit() only queues a job, the queued jobs are posted to the rings
+ * of the instances, spread round-robin, QAT_SUBMIT_BATCH at a time or by the
+ * next poll, with at most `max_inflight` requests on the device. The device
+ * does not interrupt, qat_engine_poll() reads the responses of all the
+ * instances and finishes their jobs: a job with a callback has it called
+ * from the polling thread, the others are returned by qat_job_poll().
+ *
+ * Jobs the instances can not run (an instance without SM2, an empty or an
+ * over-sized message) run on the CPU when they are posted. SM2 decryption
+ * and ECDH take d * P from the device and the KDF and hash from the CPU.
+ */
+#define QAT_DEFAULT_SECTION		"SSL"
+#define QAT_DEFAULT_MAX_INFLIGHT	1024
+#define QAT_SUBMIT_BATCH		32
+#define QAT_MAX_INSTANCES		64
+#define QAT_MAX_BUFFER_SIZE		(4 * 1024 * 1024)
+
+typedef struct QAT_ENGINE_st QAT_ENGINE;
+
+// `section` NULL for QAT_DEFAULT_SECTION, `max_inflight` 0 for QAT_DEFAULT_MAX_INFLIGHT,
+// return NULL if there is no crypto instance
+QAT_ENGINE *qat_engine_new(const char *section, size_t max_inflight);
+// the jobs submitted are finished first, and the ones not polled are dropped
+void qat_engine_free(QAT_ENGINE *qat);
+size_t qat_engine_instances(const QAT_ENGINE *qat);
+int qat_job_submit(QAT_ENGINE *qat, GMSSL_JOB *job);
+// post the queued jobs, read the responses and finish their jobs, return the number finished
+int qat_engine_poll(QAT_ENGINE *qat);
+// return 0 if no job is finished, qat_job_wait() polls until one is,
+// and returns 0 if all the jobs submitted have been returned or have callbacks
+int qat_job_poll(QAT_ENGINE *qat, GMSSL_JOB **job);
+int qat_job_wait(QAT_ENGINE *qat, GMSSL_JOB **job);
+
+/*
+ * TLS_PRIVATE_KEY_METHOD of the TLCP server signing and decrypting the
+ * ClientKeyExchange on the engine, complete() polls the engine. The keys of
+ * the context must hold the private keys.
+ */
+void qat_key_method(QAT_ENGINE *qat, TLS_PRIVATE_KEY_METHOD *method);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -19,10 +19,43 @@ extern "C" {
 #endif
 
 
-#define RAND_BYTES_MAX_SIZE	(256)
+// rand_bytes() output comes from a per-thread SM4_RNG (GM/T 0105 CTR-DRBG), reseeded
+// from rand_get_entropy() after fork(), RAND_DRBG_RESEED_BYTES or SM4_RNG_MAX_RESEED_SECONDS
+#define RAND_DRBG_RESEED_BYTES		(1 << 24)
 
 int rand_bytes(uint8_t *buf, size_t buflen);
 
+// the OS entropy source, at most RAND_BYTES_MAX_SIZE bytes per call
+#define RAND_BYTES_MAX_SIZE	(256)
+
+int rand_get_entropy(uint8_t *buf, size_t buflen);
+
+/*
+ * Random pool of a hardware RNG, e.g. sdf_rand_bytes() of a crypto card, which
+ * costs a device round trip per call. A background thread fills
+ * RAND_POOL_SLOTS slots of RAND_POOL_SLOT_SIZE bytes with `fill`, readers take
+ * bytes from the slots without locks and call `fill` themselves only when the
+ * pool is empty. `fill` must not call rand_bytes().
+ *
+ * With rand_set_pool(), every seeding of the rand_bytes() DRBG of any thread,
+ * and every generate call of it (one per 1 KB of short requests), mixes
+ * RAND_POOL_MIX_SIZE bytes of the pool in, so the output
+ * keeps the hardware entropy while short requests are still served from
+ * memory. The pool must not be freed while it is set.
+ */
+#define RAND_POOL_SLOTS		4
+#define RAND_POOL_SLOT_SIZE	(16 * 1024)
+#define RAND_POOL_MIX_SIZE	32
+
+typedef int (*RAND_POOL_FILL)(void *fill_arg, uint8_t *buf, size_t len);
+typedef struct RAND_POOL_st RAND_POOL;
+
+RAND_POOL *rand_pool_new(RAND_POOL_FILL fill, void *fill_arg);
+int rand_pool_get(RAND_POOL *pool, uint8_t *buf, size_t len);
+void rand_pool_free(RAND_POOL *pool);
+// NULL to stop mixing
+int rand_set_pool(RAND_POOL *pool);
+
 
 #ifdef __cplusplus
 }
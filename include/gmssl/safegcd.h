@@ -0,0 +1,40 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SAFEGCD_H
+#define GMSSL_SAFEGCD_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+Constant-time modular inversion with the Bernstein-Yang divsteps
+("Fast constant-time gcd computation and modular inversion", 2019).
+
+The operands are 256-bit little-endian uint64_t[4] values, the modulus must
+be odd and a < modulus. 590 divsteps are always executed (10 rounds of 59),
+the bound for 256-bit inputs, so the running time does not depend on a.
+The inverse of 0 is 0.
+
+The implementation needs the 128-bit integer of the compiler, without it
+the callers keep the Fermat exponentiation.
+*/
+#if defined(__SIZEOF_INT128__)
+void safegcd_z256_inv(uint64_t r[4], const uint64_t a[4], const uint64_t modulus[4]);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -60,6 +60,8 @@ int sdf_load_library(const char *so_path, const char *vendor);
 int sdf_open_device(SDF_DEVICE *dev);
 int sdf_print_device_info(FILE *fp, int fmt, int ind, const char *lable, SDF_DEVICE *dev);
 int sdf_rand_bytes(SDF_DEVICE *dev, uint8_t *buf, size_t len);
+// RAND_POOL_FILL of `dev`, e.g. rand_pool_new(sdf_rand_pool_fill, &dev)
+int sdf_rand_pool_fill(void *dev, uint8_t *buf, size_t len);
 int sdf_load_sign_key(SDF_DEVICE *dev, SDF_KEY *key, int index, const char *pass);
 int sdf_sign(SDF_KEY *key, const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
 int sdf_release_key(SDF_KEY *key);
@@ -67,6 +69,115 @@ int sdf_close_device(SDF_DEVICE *dev);
 void sdf_unload_library(void);
 
 
+/*
+ * Session pool of the private key `index` for multi-threaded callers. Every
+ * session holds the access right of the key and the optional SM4 key, a call
+ * takes an idle session (or waits for one) so that up to `sessions` calls run
+ * in parallel on the device. A session failing an operation is probed and
+ * reopened, the operation is retried once on the new session.
+ */
+#define SDF_POOL_MAX_SESSIONS	256
+#define SDF_POOL_MAX_PASS_SIZE	64
+
+typedef struct SDF_POOL_st SDF_POOL;
+
+// `sm4_key` can be NULL, the SM4 key is imported under the encryption key pair of `index`
+SDF_POOL *sdf_pool_new(SDF_DEVICE *dev, int index, const char *pass, const uint8_t sm4_key[16], size_t sessions);
+int sdf_pool_get_public_key(const SDF_POOL *pool, SM2_KEY *public_key);
+int sdf_pool_sign(SDF_POOL *pool, const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
+int sdf_pool_decrypt(SDF_POOL *pool, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sdf_pool_sm4_cbc_encrypt_blocks(SDF_POOL *pool, const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+int sdf_pool_sm4_cbc_decrypt_blocks(SDF_POOL *pool, const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+// probe the idle sessions and reopen the failed ones, return -1 if any of them can not be reopened
+int sdf_pool_check(SDF_POOL *pool);
+void sdf_pool_free(SDF_POOL *pool);
+
+
+/*
+ * Asynchronous SM4-CBC jobs over a session pool. The `depth` worker threads
+ * of a queue each keep one job in flight on a session of the pool, so the
+ * device is busy while the submitting thread goes on. A job gathers its input
+ * buffers into one device call and scatters the output, the total input length
+ * is a multiple of 16 and the output buffers are at least as long. A job is
+ * either reported to its callback (on a worker thread) or returned by
+ * sdf_job_queue_poll(), `status` is 1 on success and -1 on failure.
+ */
+#define SDF_JOB_QUEUE_MAX_DEPTH	SDF_POOL_MAX_SESSIONS
+#define SDF_JOB_MAX_SIZE	(16 * 1024 * 1024)
+
+enum {
+	SDF_JOB_sm4_cbc_encrypt = 1,
+	SDF_JOB_sm4_cbc_decrypt = 2,
+};
+
+typedef struct {
+	uint8_t *base;
+	size_t len;
+} SDF_IOVEC;
+
+typedef struct SDF_JOB_st {
+	int op;
+	uint8_t iv[16];
+	const SDF_IOVEC *in;
+	size_t in_cnt;
+	const SDF_IOVEC *out;
+	size_t out_cnt;
+	void (*callback)(struct SDF_JOB_st *job);
+	void *arg;
+	int status; // 0 until completed
+	struct SDF_JOB_st *next;
+} SDF_JOB;
+
+typedef struct SDF_JOB_QUEUE_st SDF_JOB_QUEUE;
+
+SDF_JOB_QUEUE *sdf_job_queue_new(SDF_POOL *pool, size_t depth);
+// the job and its buffers must be kept until completed
+int sdf_job_submit(SDF_JOB_QUEUE *queue, SDF_JOB *job);
+// return the number of completed jobs without callback, wait for at least one if `wait` is set
+int sdf_job_queue_poll(SDF_JOB_QUEUE *queue, SDF_JOB **jobs, size_t maxjobs, int wait);
+// complete the submitted jobs and stop the workers
+void sdf_job_queue_free(SDF_JOB_QUEUE *queue);
+
+
+/*
+ * Dispatch policy of the ENABLE_CRYPTO_SDF build. A device call costs a round
+ * trip, so SM3 and SM4-CBC messages shorter than the minimum sizes (decided
+ * by the first update) and the SM2 operations without a private key (verify
+ * and encrypt) run on the CPU. The SM2 sign and decrypt keys are on the
+ * device and always go there. An operation that would go to the device runs
+ * on the CPU instead when `device_max_inflight` operations are on the device
+ * already, 0 means no limit.
+ */
+#define SDF_DISPATCH_DEFAULT_SM3_MIN_SIZE	4096
+#define SDF_DISPATCH_DEFAULT_SM4_MIN_SIZE	4096
+#define SDF_DISPATCH_DEFAULT_MAX_INFLIGHT	64
+
+enum {
+	SDF_DISPATCH_sm3 = 1,
+	SDF_DISPATCH_sm4_cbc = 2,
+	SDF_DISPATCH_sm2_verify = 3,
+	SDF_DISPATCH_sm2_encrypt = 4,
+	SDF_DISPATCH_sm2_sign = 5,
+	SDF_DISPATCH_sm2_decrypt = 6,
+};
+
+typedef struct {
+	size_t sm3_device_min_size;
+	size_t sm4_device_min_size;
+	int sm2_public_on_device;
+	size_t device_max_inflight;
+} SDF_DISPATCH_POLICY;
+
+int sdf_dispatch_set_policy(const SDF_DISPATCH_POLICY *policy);
+void sdf_dispatch_get_policy(SDF_DISPATCH_POLICY *policy);
+// return 1 if `op` of `len` bytes goes to the device, sdf_dispatch_end() when it is done, or 0 for the CPU
+int sdf_dispatch_begin(int op, size_t len);
+void sdf_dispatch_end(void);
+// any of the outputs can be NULL, `spilled` is counted in `cpu` too
+void sdf_dispatch_get_stats(size_t *cpu, size_t *device, size_t *spilled);
+void sdf_dispatch_reset_stats(void);
+
+
 #ifdef __cplusplus
 }
 #endif
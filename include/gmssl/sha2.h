@@ -55,6 +55,13 @@ void sha256_init(SHA256_CTX *ctx);
 void sha256_update(SHA256_CTX *ctx, const uint8_t* data, size_t datalen);
 void sha256_finish(SHA256_CTX *ctx, uint8_t dgst[SHA256_DIGEST_SIZE]);
 
+#ifdef ENABLE_SHA2_SHANI
+void sha256_shani_compress_blocks(uint32_t state[8], const uint8_t *data, size_t blocks);
+#endif
+#ifdef ENABLE_SHA2_CE
+void sha256_ce_compress_blocks(uint32_t state[8], const uint8_t *data, size_t blocks);
+#endif
+
 
 #define SHA384_DIGEST_SIZE	48
 #define SHA384_BLOCK_SIZE	128
@@ -87,6 +94,10 @@ void sha512_init(SHA512_CTX *ctx);
 void sha512_update(SHA512_CTX *ctx, const uint8_t* data, size_t datalen);
 void sha512_finish(SHA512_CTX *ctx, uint8_t dgst[SHA512_DIGEST_SIZE]);
 
+#ifdef ENABLE_SHA2_CE
+void sha512_ce_compress_blocks(uint64_t state[8], const uint8_t *data, size_t blocks);
+#endif
+
 
 #ifdef __cplusplus
 }
@@ -69,11 +69,37 @@ int skf_import_sign_cert(SKF_DEVICE *dev, const char *appname, const char *pin,
 int skf_export_sign_cert(SKF_DEVICE *dev, const char *appname, const char *pin, const char *container_name, uint8_t *cert, size_t *certlen);
 
 int skf_rand_bytes(SKF_DEVICE *dev, uint8_t *buf, size_t len);
+// RAND_POOL_FILL of `dev`, e.g. rand_pool_new(skf_rand_pool_fill, &dev)
+int skf_rand_pool_fill(void *dev, uint8_t *buf, size_t len);
 int skf_load_sign_key(SKF_DEVICE *dev, const char *appname, const char *pin, const char *container_name, SKF_KEY *key);
 int skf_sign(SKF_KEY *key, const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
 int skf_release_key(SKF_KEY *key);
 
 
+/*
+ * Signing keys of the containers in one application, kept open across calls.
+ * The application is opened and the user PIN verified once, a container is
+ * opened by the first call naming it. The PIN is kept by the cache, a sign
+ * failing because the token dropped the login verifies the PIN again, any
+ * other failure reopens the application and the containers, and the sign is
+ * retried once. A cache is used by one thread at a time, like the device.
+ */
+#define SKF_KEY_CACHE_SIZE	16
+#define SKF_MAX_PIN_SIZE	64
+
+typedef struct SKF_KEY_CACHE_st SKF_KEY_CACHE;
+
+// `dev` is kept open by the caller until the cache is freed
+SKF_KEY_CACHE *skf_key_cache_new(SKF_DEVICE *dev, const char *appname, const char *pin);
+int skf_key_cache_get_public_key(SKF_KEY_CACHE *cache, const char *container_name, SM2_KEY *public_key);
+int skf_key_cache_sign(SKF_KEY_CACHE *cache, const char *container_name,
+	const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
+// digest Z(id) || msgs[i] on the host and sign on the token, the DER signature i is at sigs + i * SM2_MAX_SIGNATURE_SIZE
+int skf_key_cache_sign_messages(SKF_KEY_CACHE *cache, const char *container_name, const char *id, size_t idlen,
+	const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *sigs, size_t *siglens);
+void skf_key_cache_free(SKF_KEY_CACHE *cache);
+
+
 #ifdef __cplusplus
 }
 #endif
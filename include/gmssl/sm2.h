@@ -23,12 +23,48 @@ extern "C" {
 #endif
 
 
+/*
+ * fast_private caches (d + 1)^-1 (mod n) of the private key d, so signing does
+ * not invert. It is set by sm2_key_generate, sm2_key_set_private_key and the
+ * private key decoders, a key whose private_key is written directly still
+ * signs, sm2_fast_sign_compute_key() checks the cache and inverts if it is
+ * stale.
+ */
 typedef struct {
 	SM2_Z256_POINT public_key;
 	sm2_z256_t private_key;
+	sm2_z256_t fast_private;
 } SM2_KEY;
 
 int sm2_key_generate(SM2_KEY *key);
+
+/*
+ * Generate num keys. Every SM2_KEY_GENERATE_BATCH_SIZE keys share one rand_bytes()
+ * call and one inversion to make the public keys affine, the keys are split across
+ * `threads`, <= 0 for one per online CPU, at most SM2_KEY_GENERATE_MAX_THREADS,
+ * 1 to run in the calling thread only.
+ */
+#define SM2_KEY_GENERATE_BATCH_SIZE	64
+#define SM2_KEY_GENERATE_MAX_THREADS	64
+int sm2_key_generate_batch(SM2_KEY *keys, size_t num, int threads);
+
+#ifdef ENABLE_SM2_KEY_POOL
+/*
+ * Thread-safe pool of single-use key pairs, e.g. the ephemeral ECDHE keys of
+ * TLS handshakes. Keys are generated SM2_KEY_GENERATE_BATCH_SIZE at a time
+ * sharing one inversion. With `background` a thread keeps the pool full,
+ * otherwise call `sm2_key_pool_refill` at idle time. An empty pool generates
+ * the key inline.
+ */
+typedef struct SM2_KEY_POOL_st SM2_KEY_POOL;
+
+SM2_KEY_POOL *sm2_key_pool_new(size_t capacity, int background);
+void sm2_key_pool_free(SM2_KEY_POOL *pool);
+int sm2_key_pool_get(SM2_KEY_POOL *pool, SM2_KEY *key);
+int sm2_key_pool_refill(SM2_KEY_POOL *pool);
+size_t sm2_key_pool_count(SM2_KEY_POOL *pool);
+#endif
+
 int sm2_key_print(FILE *fp, int fmt, int ind, const char *label, const SM2_KEY *key);
 int sm2_key_set_private_key(SM2_KEY *key, const sm2_z256_t private_key);
 int sm2_key_set_public_key(SM2_KEY *key, const SM2_Z256_POINT *public_key);
@@ -111,6 +147,9 @@ int sm2_private_key_info_encrypt_to_der(const SM2_KEY *key,
 	const char *pass, uint8_t **out, size_t *outlen);
 int sm2_private_key_info_decrypt_from_der(SM2_KEY *key, const uint8_t **attrs, size_t *attrs_len,
 	const char *pass, const uint8_t **in, size_t *inlen);
+// each ins[i] holds exactly one EncryptedPrivateKeyInfo, the PBKDF2 keys are derived in parallel
+int sm2_private_key_info_decrypt_from_der_batch(SM2_KEY *keys,
+	const char *const *passes, const uint8_t *const *ins, const size_t *inlens, size_t num);
 int sm2_private_key_info_encrypt_to_pem(const SM2_KEY *key, const char *pass, FILE *fp);
 // FIXME: #define default buffer size
 int sm2_private_key_info_decrypt_from_pem(SM2_KEY *key, const char *pass, FILE *fp);
@@ -124,7 +163,11 @@ typedef struct {
 
 int sm2_do_sign(const SM2_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig);
 int sm2_do_verify(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATURE *sig);
+// return 1 if all signatures are valid, 0 if any is not, results[i] (optional) is 1 or -1
+int sm2_do_verify_batch(const SM2_KEY *const *keys, const uint8_t (*dgsts)[32],
+	const SM2_SIGNATURE *sigs, size_t count, int *results);
 
+// the cached key->fast_private if it is valid
 int sm2_fast_sign_compute_key(const SM2_KEY *key, sm2_z256_t fast_private);
 
 typedef struct {
@@ -135,6 +178,7 @@ typedef struct {
 #define SM2_SIGN_PRE_COMP_COUNT 32
 
 int sm2_fast_sign_pre_compute(SM2_SIGN_PRE_COMP pre_comp[32]);
+// return 0 if r == 0, r + k == n or s == 0, sign again with another pre_comp
 int sm2_fast_sign(const sm2_z256_t fast_private, SM2_SIGN_PRE_COMP *pre_comp,
 	const uint8_t dgst[32], SM2_SIGNATURE *sig);
 int sm2_fast_verify(const SM2_Z256_POINT point_table[16],
@@ -149,6 +193,30 @@ int sm2_signature_print(FILE *fp, int fmt, int ind, const char *label, const uin
 int sm2_sign(const SM2_KEY *key, const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
 int sm2_verify(const SM2_KEY *key, const uint8_t dgst[32], const uint8_t *sig, size_t siglen);
 
+/*
+ * Process-wide cache of the positive results of sm2_verify() and
+ * sm2_verify_finish(), which also serves the certificate signatures checked by
+ * chain verification. It is off until sm2_verify_cache_set_ttl() sets a TTL,
+ * a result is then kept for `seconds`. The cache key is
+ * SM3(public key x || y || dgst || DER signature), it is split into
+ * SM2_VERIFY_CACHE_SHARDS shards with a lock each, a shard is a set
+ * associative table and the least recently used way of a set is replaced.
+ * Failed verifications are never cached.
+ */
+#define SM2_VERIFY_CACHE_SHARDS		16
+#define SM2_VERIFY_CACHE_SETS		64
+#define SM2_VERIFY_CACHE_WAYS		4
+
+// `seconds` <= 0 turns the cache off and empties it
+void sm2_verify_cache_set_ttl(int seconds);
+int sm2_verify_cache_enabled(void);
+// return 1 on a hit, 0 with `cache_key` set for sm2_verify_cache_add() on a miss
+int sm2_verify_cache_lookup(const SM2_KEY *key, const uint8_t dgst[32], const uint8_t *sig, size_t siglen,
+	uint8_t cache_key[32]);
+void sm2_verify_cache_add(const uint8_t cache_key[32]);
+void sm2_verify_cache_clear(void);
+void sm2_verify_cache_get_stats(size_t *hits, size_t *misses);
+
 enum {
 	SM2_signature_compact_size = 70,
 	SM2_signature_typical_size = 71,
@@ -178,6 +246,8 @@ typedef struct {
 
 	// verify public point table, P, 2P, ..., 16P
 	SM2_Z256_POINT public_point_table[16];
+
+	struct SM2_SIGN_POOL_st *pool; // optional, shared (k, x1) source set by sm2_sign_init_ex
 } SM2_SIGN_CTX;
 
 int sm2_sign_init(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t idlen);
@@ -186,14 +256,89 @@ int sm2_sign_finish(SM2_SIGN_CTX *ctx, uint8_t *sig, size_t *siglen);
 int sm2_sign_reset(SM2_SIGN_CTX *ctx);
 int sm2_sign_finish_fixlen(SM2_SIGN_CTX *ctx, size_t siglen, uint8_t *sig);
 
+/*
+ * Sign everything read from `fp` as sm2_sign_init/update/finish would. The
+ * file is read into a ring of SM2_SIGN_FILE_BUFS buffers that a second
+ * thread hashes, while the signing pre-computation runs on the calling
+ * thread. Inputs of one buffer or less are hashed on the calling thread.
+ */
+#define SM2_SIGN_FILE_BUF_SIZE	(4 * 1024 * 1024)
+#define SM2_SIGN_FILE_BUFS	4
+
+int sm2_sign_file(const SM2_KEY *key, const char *id, size_t idlen, FILE *fp,
+	uint8_t *sig, size_t *siglen);
+
+#ifdef ENABLE_SM2_SIGN_POOL
+/*
+ * Thread-safe pool of (k, x1 mod n) pairs for sm2_fast_sign, so signing
+ * only costs a few modular operations. With `background` a thread keeps
+ * the pool full, otherwise call `sm2_sign_pool_refill` at idle time. An
+ * empty pool computes the pair inline.
+ */
+typedef struct SM2_SIGN_POOL_st SM2_SIGN_POOL;
+
+SM2_SIGN_POOL *sm2_sign_pool_new(size_t capacity, int background);
+void sm2_sign_pool_free(SM2_SIGN_POOL *pool);
+int sm2_sign_pool_get(SM2_SIGN_POOL *pool, SM2_SIGN_PRE_COMP *pre_comp);
+int sm2_sign_pool_refill(SM2_SIGN_POOL *pool);
+size_t sm2_sign_pool_count(SM2_SIGN_POOL *pool);
+
+int sm2_sign_init_ex(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t idlen,
+	SM2_SIGN_POOL *pool);
+
+/*
+ * With a default pool sm2_do_sign, sm2_sign and sm2_sign_init without a pool
+ * take their (k, x1) pairs from it, so TLS, CMS and the tools sign with a few
+ * modular operations. NULL restores the per-call computation. Set it to NULL
+ * and let the signing threads finish before freeing the pool.
+ */
+void sm2_sign_pool_set_default(SM2_SIGN_POOL *pool);
+SM2_SIGN_POOL *sm2_sign_pool_get_default(void);
+#endif
+
+/*
+ * SM2_VERIFY_KEY keeps a 37 x 64 point comb table (148 KiB) of a long-lived
+ * public key, so t * P costs as much as the fixed-base s * G. The table is
+ * built on the first verification, call `sm2_verify_key_pre_compute` first
+ * if the key is shared between threads.
+ *
+ * It also keeps the SM3 state after Z for up to SM2_VERIFY_KEY_MAX_IDS
+ * signer IDs, so `sm2_verify_init_ex` with one of them is a state copy. The
+ * default ID is added by `sm2_verify_key_init`, others with
+ * `sm2_verify_key_add_id` before the key is shared. Other IDs compute Z.
+ */
+#define SM2_VERIFY_KEY_MAX_IDS		4
+#define SM2_VERIFY_KEY_MAX_ID_LENGTH	64
+
+typedef struct {
+	char id[SM2_VERIFY_KEY_MAX_ID_LENGTH];
+	size_t idlen;
+	SM3_CTX sm3_ctx; // SM3 of Z
+} SM2_VERIFY_KEY_ID;
+
+typedef struct {
+	SM2_KEY key;
+	SM2_Z256_AFFINE_POINT (*point_table)[64];
+	SM2_VERIFY_KEY_ID ids[SM2_VERIFY_KEY_MAX_IDS];
+	size_t num_ids;
+} SM2_VERIFY_KEY;
+
+int sm2_verify_key_init(SM2_VERIFY_KEY *vkey, const SM2_KEY *key);
+int sm2_verify_key_add_id(SM2_VERIFY_KEY *vkey, const char *id, size_t idlen);
+int sm2_verify_key_pre_compute(SM2_VERIFY_KEY *vkey);
+int sm2_verify_key_do_verify(SM2_VERIFY_KEY *vkey, const uint8_t dgst[32], const SM2_SIGNATURE *sig);
+void sm2_verify_key_cleanup(SM2_VERIFY_KEY *vkey);
+
 typedef struct {
 	SM3_CTX sm3_ctx;
 	SM3_CTX saved_sm3_ctx;
 	SM2_KEY key;
 	SM2_Z256_POINT public_point_table[16];
+	SM2_VERIFY_KEY *verify_key; // optional, set by sm2_verify_init_ex
 } SM2_VERIFY_CTX;
 
 int sm2_verify_init(SM2_VERIFY_CTX *ctx, const SM2_KEY *key, const char *id, size_t idlen);
+int sm2_verify_init_ex(SM2_VERIFY_CTX *ctx, SM2_VERIFY_KEY *vkey, const char *id, size_t idlen);
 int sm2_verify_update(SM2_VERIFY_CTX *ctx, const uint8_t *data, size_t datalen);
 int sm2_verify_finish(SM2_VERIFY_CTX *ctx, const uint8_t *sig, size_t siglen);
 int sm2_verify_reset(SM2_VERIFY_CTX *ctx);
@@ -235,6 +380,17 @@ int sm2_ciphertext_print(FILE *fp, int fmt, int ind, const char *label, const ui
 int sm2_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm2_decrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 
+/*
+ * Decrypt many ciphertexts under one key, e.g. the TLCP ClientKeyExchanges of
+ * concurrent handshakes. The d * C1 of up to SM2_DECRYPT_BATCH_SIZE entries are
+ * made affine with one shared inversion, their KDFs and C3 hashes are computed
+ * in the SM3 multi-buffer lanes. outs[i] has room for SM2_MAX_PLAINTEXT_SIZE bytes.
+ * Returns 1 if all are decrypted, 0 if any is not, results[i] is 1 or -1.
+ */
+#define SM2_DECRYPT_BATCH_SIZE	16
+int sm2_decrypt_batch(const SM2_KEY *key, const uint8_t *const *ins, const size_t *inlens, size_t count,
+	uint8_t *const *outs, size_t *outlens, int *results);
+
 enum {
 	SM2_ciphertext_compact_point_size = 68,
 	SM2_ciphertext_typical_point_size = 69,
@@ -247,6 +403,27 @@ int sm2_encrypt_fixlen(const SM2_KEY *key, const uint8_t *in, size_t inlen, int
 int sm2_do_ecdh(const SM2_KEY *key, const SM2_Z256_POINT *peer_public, SM2_Z256_POINT *out);
 int sm2_ecdh(const SM2_KEY *key, const uint8_t *peer_public, size_t peer_public_len, uint8_t out[64]);
 
+/*
+ * ECDH of one private key with count peers, e.g. a server agreeing keys with
+ * many clients. The Booth digits of the private key are computed once, the
+ * tables of every SM2_ECDH_BATCH_SIZE peers are made affine with one inversion
+ * so that the multiplications take mixed additions, and the shared points of
+ * the batch share another inversion. The peers are split across `threads`,
+ * <= 0 for one per online CPU, at most SM2_ECDH_MAX_THREADS, every thread takes
+ * at least SM2_ECDH_THREAD_MIN_PEERS peers.
+ *
+ * Peers at infinity, not on the curve or not decodable set results[i]
+ * (optional) to -1 and outs[i] to zero, and make the return value 0.
+ */
+#define SM2_ECDH_BATCH_SIZE		16
+#define SM2_ECDH_MAX_THREADS		64
+#define SM2_ECDH_THREAD_MIN_PEERS	64
+
+int sm2_do_ecdh_batch(const SM2_KEY *key, const SM2_Z256_POINT *peer_publics, size_t count,
+	SM2_Z256_POINT *outs, int *results, int threads);
+int sm2_ecdh_batch(const SM2_KEY *key, const uint8_t *const *peer_publics, const size_t *peer_public_lens,
+	size_t count, uint8_t (*outs)[64], int *results, int threads);
+
 
 typedef struct {
 	sm2_z256_t k;
@@ -270,6 +447,26 @@ int sm2_encrypt_update(SM2_ENC_CTX *ctx, const uint8_t *in, size_t inlen);
 int sm2_encrypt_finish(SM2_ENC_CTX *ctx, const SM2_KEY *public_key, uint8_t *out, size_t *outlen);
 int sm2_encrypt_reset(SM2_ENC_CTX *ctx);
 
+/*
+ * SM2_ENC_KEY keeps the same 37 x 64 point comb table as SM2_VERIFY_KEY for
+ * a recipient public key, so k * P_B costs as much as k * G. The table is
+ * built on the first encryption, call `sm2_enc_key_pre_compute` first if
+ * the key is shared between threads.
+ */
+typedef struct {
+	SM2_KEY key;
+	SM2_Z256_AFFINE_POINT (*point_table)[64];
+} SM2_ENC_KEY;
+
+int sm2_enc_key_init(SM2_ENC_KEY *ekey, const SM2_KEY *public_key);
+int sm2_enc_key_pre_compute(SM2_ENC_KEY *ekey);
+int sm2_enc_key_do_encrypt(SM2_ENC_KEY *ekey, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out);
+int sm2_enc_key_do_encrypt_ex(SM2_ENC_KEY *ekey, const SM2_ENC_PRE_COMP *pre_comp,
+	const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out);
+int sm2_enc_key_encrypt(SM2_ENC_KEY *ekey, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sm2_encrypt_finish_ex(SM2_ENC_CTX *ctx, SM2_ENC_KEY *ekey, uint8_t *out, size_t *outlen);
+void sm2_enc_key_cleanup(SM2_ENC_KEY *ekey);
+
 typedef struct {
 	uint8_t buf[SM2_MAX_CIPHERTEXT_SIZE];
 	size_t buf_size;
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
 #include <gmssl/mem.h>
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
@@ -35,13 +36,31 @@ typedef struct {
 
 #define SM2_BLIND_SIGN_MAX_COMMITLEN	65
 
-int sm2_blind_sign_commit(SM2_Fn k, uint8_t *commit, size_t *commitlen);
+int sm2_blind_sign_commit(sm2_z256_t k, uint8_t *commit, size_t *commitlen);
 int sm2_blind_sign_init(SM2_BLIND_SIGN_CTX *ctx, const SM2_KEY *public_key, const char *id, size_t idlen);
 int sm2_blind_sign_update(SM2_BLIND_SIGN_CTX *ctx, const uint8_t *data, size_t datalen);
 int sm2_blind_sign_finish(SM2_BLIND_SIGN_CTX *ctx, const uint8_t *commit, size_t commitlen, uint8_t blinded_sig_r[32]);
-int sm2_blind_sign(const SM2_KEY *key, const SM2_Fn k, const uint8_t blinded_sig_r[32], uint8_t blinded_sig_s[32]);
+int sm2_blind_sign(const SM2_KEY *key, const sm2_z256_t k, const uint8_t blinded_sig_r[32], uint8_t blinded_sig_s[32]);
 int sm2_blind_sign_unblind(SM2_BLIND_SIGN_CTX *ctx, const uint8_t blinded_sig_s[32], uint8_t *sig, size_t *siglen);
 
+/*
+ * Signer side of many requests. sm2_blind_sign_commit_batch() draws the nonces
+ * k[i] and writes the 33-byte compressed commitments k[i] * G, every
+ * SM2_BLIND_SIGN_BATCH_SIZE of them share one rand_bytes() call and one
+ * inversion to make the points affine. sm2_blind_sign_batch() inverts (1 + d)
+ * once and answers blinded_r[i] with k[i]. Both split the vectors across
+ * `threads`, <= 0 for one per online CPU, at most SM2_BLIND_SIGN_MAX_THREADS,
+ * 1 to run in the calling thread only. A thread commits at least one full
+ * batch and signs at least SM2_BLIND_SIGN_THREAD_MIN_SIGNS requests.
+ */
+#define SM2_BLIND_SIGN_BATCH_SIZE		64
+#define SM2_BLIND_SIGN_MAX_THREADS		64
+#define SM2_BLIND_SIGN_THREAD_MIN_SIGNS	4096
+
+int sm2_blind_sign_commit_batch(sm2_z256_t *k, uint8_t (*commits)[33], size_t count, int threads);
+int sm2_blind_sign_batch(const SM2_KEY *key, const sm2_z256_t *k,
+	const uint8_t (*blinded_r)[32], uint8_t (*blinded_s)[32], size_t count, int threads);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,58 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM2_CL_H
+#define GMSSL_SM2_CL_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm4_cl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Batch SM2 verification on the OpenCL device, one work item per signature.
+ * The host checks r and s, reduces the digest and passes s, t = r + s and
+ * r - e (mod n) with the public key in the Montgomery form of SM2_Z256_POINT.
+ * The work item computes R = s * G + t * P with 32-bit limbs and compares
+ * x(R) mod n without an inversion. The batch is sent in parts of
+ * SM2_CL_VERIFY_CHUNK signatures.
+ */
+#define SM2_CL_VERIFY_CHUNK	65536
+
+typedef struct {
+	cl_context context;
+	cl_device_id device;
+	cl_command_queue queue;
+	cl_program program;
+	cl_kernel kernel;
+	cl_mem mem_in; // kept for the next calls
+	size_t mem_in_size;
+	cl_mem mem_out;
+	size_t mem_out_size;
+} SM2_CL_CTX;
+
+// share == NULL opens the device as sm4_cl does, or the context and queue of `share` are used
+int sm2_cl_init(SM2_CL_CTX *ctx, const SM4_CL_CTX *share);
+// bit i % 8 of bitmap[i / 8] is set if sigs[i] is valid, same return value as sm2_do_verify_batch
+int sm2_cl_verify_batch(SM2_CL_CTX *ctx, const SM2_KEY *const *keys, const uint8_t (*dgsts)[32],
+	const SM2_SIGNATURE *sigs, size_t count, uint8_t *bitmap);
+void sm2_cl_cleanup(SM2_CL_CTX *ctx);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
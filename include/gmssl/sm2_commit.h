@@ -28,10 +28,20 @@ extern "C" {
 #endif
 
 
+/*
+ * Pedersen commitments C = rG + x[0]H[0] + ... + x[count-1]H[count-1], the
+ * generators are a hash chain from a fixed seed. The first
+ * SM2_COMMIT_TABLE_GENERATORS of them are derived once per process and get a
+ * fixed-base comb table (SM2_COMMIT_TABLE_WINDOW-bit windows, 52 KiB) at the
+ * first commitment using them. Opening is a multi-scalar multiplication.
+ */
+#define SM2_COMMIT_TABLE_GENERATORS	64
+#define SM2_COMMIT_TABLE_WINDOW		5
+
 int sm2_commit_generate(const uint8_t x[32], uint8_t r[32], uint8_t commit[65], size_t *commitlen);
 int sm2_commit_open(const uint8_t x[32], const uint8_t r[32], const uint8_t *commit, size_t commitlen);
-int sm2_commit_vector_generate(const sm2_bn_t *x, size_t count, uint8_t r[32], uint8_t commit[65], size_t *commitlen);
-int sm2_commit_vector_open(const sm2_bn_t *x, size_t count, const uint8_t r[32], const uint8_t *commit, size_t commitlen);
+int sm2_commit_vector_generate(const uint8_t (*x)[32], size_t count, uint8_t r[32], uint8_t commit[65], size_t *commitlen);
+int sm2_commit_vector_open(const uint8_t (*x)[32], size_t count, const uint8_t r[32], const uint8_t *commit, size_t commitlen);
 
 
 #ifdef __cplusplus
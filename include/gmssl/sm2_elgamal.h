@@ -11,6 +11,7 @@
 #define GMSSL_SM2_ELGAMAL_H
 
 
+#include <stdio.h>
 #include <string.h>
 #include <stdint.h>
 #include <gmssl/sm2.h>
@@ -21,25 +22,42 @@ extern "C" {
 #endif
 
 
-#define SM2_PRE_COMPUTE_MAX_OFFSETS	6
+/*
+ * Baby-step table of x(j*G), j = 1..SM2_ELGAMAL_BABY_STEPS, as an open addressing
+ * hash index. Every slot is a 64-bit word (x[0] >> 17 | 1) << 16 | (j - 1) of the
+ * x-coordinate in the slot x[0] mod SM2_ELGAMAL_TABLE_SLOTS, 0 for an empty slot.
+ * The table holds no pointers, it can be written to a file and mmap'ed back on a
+ * host of the same byte order, sm2_elgamal_table_check() checks the header.
+ */
+#define SM2_ELGAMAL_BABY_STEPS		(1 << 16)
+#define SM2_ELGAMAL_TABLE_SLOTS		(1 << 17)
+#define SM2_ELGAMAL_TABLE_MAGIC		"SM2EGT01"
 
 typedef struct {
-	uint16_t offset[SM2_PRE_COMPUTE_MAX_OFFSETS];
-	uint8_t offset_count;
-	uint8_t x_coordinate[32];
-} SM2_PRE_COMPUTE;
+	uint8_t magic[8];
+	uint64_t byte_order; // 0x0102030405060708 in the host order
+	uint64_t slots[SM2_ELGAMAL_TABLE_SLOTS];
+} SM2_ELGAMAL_TABLE;
 
-int sm2_elgamal_decrypt_pre_compute(SM2_PRE_COMPUTE table[1<<16]);
-int sm2_elgamal_solve_ecdlp(const SM2_PRE_COMPUTE table[1<<16], const SM2_POINT *point, uint32_t *private);
+int sm2_elgamal_table_generate(SM2_ELGAMAL_TABLE *table);
+int sm2_elgamal_table_check(const SM2_ELGAMAL_TABLE *table);
+int sm2_elgamal_table_to_file(const SM2_ELGAMAL_TABLE *table, FILE *fp);
+int sm2_elgamal_table_from_file(SM2_ELGAMAL_TABLE *table, FILE *fp);
+
+// m with M = m*G and m in [0, 2^32), giant steps of 2 * SM2_ELGAMAL_BABY_STEPS
+int sm2_elgamal_solve_ecdlp(const SM2_ELGAMAL_TABLE *table, const SM2_Z256_POINT *M, uint32_t *m);
 
 
 typedef struct {
-	SM2_POINT C1;
-	SM2_POINT C2;
+	SM2_Z256_POINT C1;
+	SM2_Z256_POINT C2;
 } SM2_ELGAMAL_CIPHERTEXT;
 
 int sm2_elgamal_do_encrypt(const SM2_KEY *pub_key, uint32_t in, SM2_ELGAMAL_CIPHERTEXT *out);
+// the table is generated at the first call
 int sm2_elgamal_do_decrypt(const SM2_KEY *key, const SM2_ELGAMAL_CIPHERTEXT *in, uint32_t *out);
+int sm2_elgamal_do_decrypt_ex(const SM2_KEY *key, const SM2_ELGAMAL_TABLE *table,
+	const SM2_ELGAMAL_CIPHERTEXT *in, uint32_t *out);
 
 int sm2_elgamal_ciphertext_add(SM2_ELGAMAL_CIPHERTEXT *r,
 	const SM2_ELGAMAL_CIPHERTEXT *a,
@@ -54,6 +72,19 @@ int sm2_elgamal_ciphertext_scalar_mul(SM2_ELGAMAL_CIPHERTEXT *R,
 	const uint8_t scalar[32], const SM2_ELGAMAL_CIPHERTEXT *A,
 	const SM2_KEY *pub_key);
 
+/*
+ * r = c[0] + ... + c[num - 1], re-randomized once and returned in affine form.
+ * The sum is split over `threads` (<= 0 for one per online CPU, at most
+ * SM2_ELGAMAL_SUM_MAX_THREADS, every thread gets SM2_ELGAMAL_SUM_MIN_PER_THREAD
+ * ciphertexts at least) and the partial sums are added pairwise.
+ */
+#define SM2_ELGAMAL_SUM_MAX_THREADS	64
+#define SM2_ELGAMAL_SUM_MIN_PER_THREAD	1024
+
+int sm2_elgamal_ciphertext_sum(SM2_ELGAMAL_CIPHERTEXT *r,
+	const SM2_ELGAMAL_CIPHERTEXT *c, size_t num,
+	const SM2_KEY *pub_key, int threads);
+
 int sm2_elgamal_ciphertext_to_der(const SM2_ELGAMAL_CIPHERTEXT *c, uint8_t **out, size_t *outlen);
 int sm2_elgamal_ciphertext_from_der(SM2_ELGAMAL_CIPHERTEXT *c, const uint8_t **in, size_t *inlen);
 
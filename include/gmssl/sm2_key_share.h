@@ -23,9 +23,14 @@ extern "C" {
 #endif
 
 
-#define SM2_KEY_MAX_SHARES 12 // 12! = 479001600 < 2^31 = 2147483648
+#define SM2_KEY_MAX_SHARES 255
 
 
+/*
+ * Shamir sharing of the private key d with a random polynomial
+ * f(x) = d + a[1]*x + ... + a[k-1]*x^(k-1) (mod n), the share `index` holds
+ * f(index + 1). Any k = recover_cnt shares recover d.
+ */
 typedef struct {
 	SM2_KEY key;
 	size_t index;
@@ -34,6 +39,16 @@ typedef struct {
 
 int sm2_key_split(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt, SM2_KEY_SHARE *shares);
 int sm2_key_recover(SM2_KEY *key, const SM2_KEY_SHARE *shares, size_t shares_cnt);
+
+/*
+ * Feldman verifiable sharing, commits[j] = a[j]*G for the recover_cnt
+ * coefficients (commits[0] is the public key) are published with the shares.
+ * A share is valid if f(x)*G = commits[0] + x*commits[1] + ... + x^(k-1)*commits[k-1].
+ */
+int sm2_key_split_ex(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt,
+	SM2_KEY_SHARE *shares, SM2_Z256_POINT *commits);
+int sm2_key_share_verify(const SM2_KEY_SHARE *share, const SM2_Z256_POINT *commits, size_t recover_cnt);
+
 int sm2_key_share_encrypt_to_file(const SM2_KEY_SHARE *share, const char *pass, const char *path_prefix);
 int sm2_key_share_decrypt_from_file(SM2_KEY_SHARE *share, const char *pass, const char *file);
 int sm2_key_share_print(FILE *fp, int fmt, int ind, const char *label, const SM2_KEY_SHARE *share);
@@ -16,15 +16,86 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <gmssl/sm3.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/*
+ * Public key recovery. The signature (r, s) of R = kG only tells x1 = r - e
+ * (mod n), so R is one of (x1, y1), (x1, -y1), and the same two points of
+ * x1 + n when x1 < p - n. The recovery id of R is
+ *	(x1 >= n ? 2 : 0) | (y1 & 1)
+ * and points[id] = (r + s)^-1 * (R - s * G) is the candidate of each R, the
+ * ones of x1 + n are only given if points_cnt is 4. points[id] is at infinity
+ * if there is no such R. Return 0 if there is no candidate at all.
+ *
+ * The digest of SM2 signatures usually hashes Z = SM3(ID || public key), the
+ * key is not known before it is recovered, so recovery only works with `dgst`
+ * computed without Z, e.g. sm2_sign_init() with a NULL id.
+ */
 int sm2_signature_to_public_key_points(const SM2_SIGNATURE *sig, const uint8_t dgst[32],
-	SM2_POINT points[4], size_t *points_cnt);
+	SM2_Z256_POINT points[4], size_t *points_cnt);
 int sm2_signature_conjugate(const SM2_SIGNATURE *sig, SM2_SIGNATURE *new_sig);
 
+/*
+ * Compact signature r || s || recovery id, 65 bytes without DER, the
+ * verifier recovers the one candidate of the id.
+ */
+#define SM2_COMPACT_SIGNATURE_SIZE	65
+
+int sm2_sign_compact(const SM2_KEY *key, const uint8_t dgst[32], uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE]);
+// return 0 if the signature gives no key
+int sm2_compact_signature_recover(const uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE], const uint8_t dgst[32],
+	SM2_Z256_POINT *public_key);
+
+/*
+ * Read-only index of public key fingerprints, SM3 of the 65-byte uncompressed
+ * point, so that a verifier keeps 32 bytes per signer instead of the keys or
+ * certificates. key_id is the position of the fingerprint given to
+ * sm2_key_index_init(), the first one wins if there are duplicates. An
+ * initialized index can be shared by any number of threads without locking.
+ */
+#define SM2_KEY_FINGERPRINT_SIZE	32
+
+int sm2_public_key_fingerprint(const SM2_Z256_POINT *P, uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE]);
+
+typedef struct {
+	uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE];
+	size_t next; // next entry of the bucket plus one, 0 for the end
+} SM2_KEY_INDEX_ENTRY;
+
+typedef struct {
+	SM2_KEY_INDEX_ENTRY *entries;
+	size_t entries_cnt;
+	size_t *buckets; // first entry plus one, 0 for empty
+	size_t buckets_cnt;
+} SM2_KEY_INDEX;
+
+int sm2_key_index_init(SM2_KEY_INDEX *index, const uint8_t (*fingerprints)[SM2_KEY_FINGERPRINT_SIZE], size_t cnt);
+void sm2_key_index_cleanup(SM2_KEY_INDEX *index);
+// return 0 if not found
+int sm2_key_index_find(const SM2_KEY_INDEX *index, const uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE],
+	size_t *key_id);
+
+/*
+ * Recover-then-match verification, return 1 and the key_id of the signer if
+ * a recovered key is in the index, 0 if not. The candidates of a signature,
+ * and the keys of up to SM2_RECOVER_BATCH_SIZE compact signatures, are made
+ * affine with one inversion, the (r + s)^-1 of the batch share another one.
+ * results[i] (optional) is 1 or -1, key_ids[i] is only set if results[i] is 1.
+ */
+#define SM2_RECOVER_BATCH_SIZE	64
+
+int sm2_verify_recover(const SM2_KEY_INDEX *index, const uint8_t dgst[32], const SM2_SIGNATURE *sig,
+	size_t *key_id);
+int sm2_verify_compact(const SM2_KEY_INDEX *index, const uint8_t dgst[32],
+	const uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE], size_t *key_id);
+int sm2_verify_compact_batch(const SM2_KEY_INDEX *index, const uint8_t (*dgsts)[32],
+	const uint8_t (*sigs)[SM2_COMPACT_SIGNATURE_SIZE], size_t count, size_t *key_ids, int *results);
+
 #ifdef __cplusplus
 }
 #endif
@@ -24,24 +24,45 @@ extern "C" {
 
 typedef uint8_t sm2_bn_t[32];
 
-int sm2_ring_do_sign(const SM2_KEY *sign_key, const SM2_POINT *public_keys, size_t public_keys_cnt,
+int sm2_ring_do_sign(const SM2_KEY *sign_key, const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], uint8_t r[32], sm2_bn_t *s);
-int sm2_ring_do_verify(const SM2_POINT *public_keys, size_t public_keys_cnt,
+int sm2_ring_do_verify(const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], const uint8_t r[32], const sm2_bn_t *s);
 int sm2_ring_signature_to_der(const sm2_bn_t r, const sm2_bn_t *s, size_t s_cnt, uint8_t **out, size_t *outlen);
 int sm2_ring_signature_from_der(sm2_bn_t r, sm2_bn_t *s, size_t *s_cnt, const uint8_t **in, size_t *inlen);
-int sm2_ring_sign(const SM2_KEY *sign_key, const SM2_POINT *public_keys, size_t public_keys_cnt,
+int sm2_ring_sign(const SM2_KEY *sign_key, const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], uint8_t *sig, size_t *siglen);
-int sm2_ring_verify(const SM2_POINT *public_keys, size_t public_keys_cnt,
+int sm2_ring_verify(const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], const uint8_t *sig, size_t siglen);
 
+/*
+ * SM2_RING keeps a comb table of SM2_Z256_COMB_POINTS(SM2_RING_TABLE_WINDOW)
+ * affine points (52 KiB) for every member of a fixed ring, so each ring step
+ * (s + r) * P[i] + s * G needs no doublings. Build it once and reuse it for
+ * all the signatures over the same ring; it is read-only after init.
+ */
+#define SM2_RING_TABLE_WINDOW	5
+
+typedef struct {
+	SM2_Z256_POINT *public_keys;
+	size_t public_keys_cnt;
+	SM2_Z256_AFFINE_POINT *point_tables;
+} SM2_RING;
+
+int sm2_ring_init(SM2_RING *ring, const SM2_Z256_POINT *public_keys, size_t public_keys_cnt);
+int sm2_ring_do_sign_ex(const SM2_KEY *sign_key, const SM2_RING *ring,
+	const uint8_t dgst[32], uint8_t r[32], sm2_bn_t *s);
+int sm2_ring_do_verify_ex(const SM2_RING *ring,
+	const uint8_t dgst[32], const uint8_t r[32], const sm2_bn_t *s);
+void sm2_ring_cleanup(SM2_RING *ring);
+
 
 #define SM2_RING_SIGN_MAX_SIGNERS  32
 typedef struct {
 	int state;
 	SM3_CTX sm3_ctx;
 	SM2_KEY sign_key;
-	SM2_POINT public_keys[SM2_RING_SIGN_MAX_SIGNERS];
+	SM2_Z256_POINT public_keys[SM2_RING_SIGN_MAX_SIGNERS];
 	size_t public_keys_count;
 	char *id;
 	size_t idlen;
@@ -57,8 +57,12 @@ void sm2_z256_modp_from_mont(sm2_z256_t r, const sm2_z256_t a);
 void sm2_z256_modp_mont_mul(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b);
 void sm2_z256_modp_mont_sqr(sm2_z256_t r, const sm2_z256_t a);
 void sm2_z256_modp_mont_exp(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t e);
-void sm2_z256_modp_mont_inv(sm2_z256_t r, const sm2_z256_t a);
+void sm2_z256_modp_mont_inv(sm2_z256_t r, const sm2_z256_t a); // safegcd if __int128 is supported
+void sm2_z256_modp_mont_inv_exp(sm2_z256_t r, const sm2_z256_t a); // a^(p - 2)
 int  sm2_z256_modp_mont_sqrt(sm2_z256_t r, const sm2_z256_t a);
+// variable time, for public values only
+void sm2_z256_modp_mont_inv_vartime(sm2_z256_t r, const sm2_z256_t a);
+int  sm2_z256_modp_mont_jacobi_vartime(const sm2_z256_t a); // 1, -1, or 0 if a == 0
 
 void sm2_z256_modn_add(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b);
 void sm2_z256_modn_sub(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b);
@@ -67,13 +71,22 @@ void sm2_z256_modn_mul(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b);
 void sm2_z256_modn_sqr(sm2_z256_t r, const sm2_z256_t a);
 void sm2_z256_modn_exp(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t e);
 void sm2_z256_modn_inv(sm2_z256_t r, const sm2_z256_t a);
+// r[i] = a[i]^-1 with one inversion, r and a do not overlap, every a[i] != 0
+void sm2_z256_modn_inv_batch(sm2_z256_t *r, const sm2_z256_t *a, size_t n);
 
 void sm2_z256_modn_to_mont(const sm2_z256_t a, sm2_z256_t r);
 void sm2_z256_modn_from_mont(sm2_z256_t r, const sm2_z256_t a);
 void sm2_z256_modn_mont_mul(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b);
 void sm2_z256_modn_mont_sqr(sm2_z256_t r, const sm2_z256_t a);
 void sm2_z256_modn_mont_exp(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t e);
-void sm2_z256_modn_mont_inv(sm2_z256_t r, const sm2_z256_t a);
+void sm2_z256_modn_mont_inv(sm2_z256_t r, const sm2_z256_t a); // safegcd if __int128 is supported
+void sm2_z256_modn_mont_inv_exp(sm2_z256_t r, const sm2_z256_t a); // a^(n - 2)
+
+// src/sm2_z256_amd64.S: 1 for the MULX/ADCX/ADOX multiplications (BMI2 and ADX), 0 for MUL/ADC.
+// Set when the library is loaded, tests switch it to compare the two.
+#ifdef ENABLE_SM2_AMD64
+void sm2_z256_amd64_set_mulx(int mulx);
+#endif
 
 
 typedef struct {
@@ -109,12 +122,50 @@ void sm2_z256_point_copy_affine(SM2_Z256_POINT *R, const SM2_Z256_AFFINE_POINT *
 void sm2_z256_point_add_affine(SM2_Z256_POINT *r, const SM2_Z256_POINT *a, const SM2_Z256_AFFINE_POINT *b);
 void sm2_z256_point_sub_affine(SM2_Z256_POINT *R, const SM2_Z256_POINT *A, const SM2_Z256_AFFINE_POINT *B);
 int sm2_z256_point_affine_print(FILE *fp, int fmt, int ind, const char *label, const SM2_Z256_AFFINE_POINT *P);
-
+// one inversion for all the points, R in Montgomery form, returns 0 if any P[i] is at infinity
+int sm2_z256_points_get_affine_batch(const SM2_Z256_POINT *P, size_t n, SM2_Z256_AFFINE_POINT *R);
+int sm2_z256_points_get_affine_batch_vartime(const SM2_Z256_POINT *P, size_t n, SM2_Z256_AFFINE_POINT *R);
+
+// Booth window of the generator comb table, the table has (256 + w)/w x 2^(w-1) affine points.
+// The built-in table is w = 7 (148 KiB), the others (4..8) are computed at the first use.
+#ifndef SM2_Z256_GENERATOR_WINDOW
+#define SM2_Z256_GENERATOR_WINDOW 7
+#endif
 void sm2_z256_point_mul_generator(SM2_Z256_POINT *R, const sm2_z256_t k);
 void sm2_z256_point_mul_pre_compute(const SM2_Z256_POINT *P, SM2_Z256_POINT T[16]);
 void sm2_z256_point_mul_ex(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_POINT P_table[16]);
 void sm2_z256_point_mul(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_POINT *P);
+// fixed-base comb with 7-bit Booth windows, T is 37 x 64 affine points (148 KiB)
+void sm2_z256_point_mul_comb_pre_compute(const SM2_Z256_POINT *P, SM2_Z256_AFFINE_POINT T[37][64]);
+void sm2_z256_point_mul_comb(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_AFFINE_POINT T[37][64]);
+// the same with w-bit windows (4..8), T is SM2_Z256_COMB_POINTS(w) affine points
+#define SM2_Z256_COMB_POINTS(w)	(((256 + (w)) / (w)) << ((w) - 1))
+void sm2_z256_point_mul_comb_w_pre_compute(const SM2_Z256_POINT *P, int w, SM2_Z256_AFFINE_POINT *T);
+void sm2_z256_point_mul_comb_w(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_AFFINE_POINT *T, int w);
 void sm2_z256_point_mul_sum(SM2_Z256_POINT *R, const sm2_z256_t t, const SM2_Z256_POINT *P, const sm2_z256_t s);
+// width-5 NAF, variable time, for public scalars and points, e.g. of signature verification
+void sm2_z256_point_mul_vartime(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_POINT *P);
+void sm2_z256_point_mul_sum_vartime(SM2_Z256_POINT *R, const sm2_z256_t t, const SM2_Z256_POINT *P, const sm2_z256_t s);
+
+/*
+ * R = k[0] * P[0] + ... + k[n-1] * P[n-1], variable time, for public scalars.
+ * Straus interleaves the 5-bit windows of all the points after a 16-point table
+ * of each, Pippenger adds the points of every c-bit window into 2^(c-1)
+ * buckets of their signed digits, which is cheaper from a few hundred points.
+ * sm2_z256_point_multi_mul() picks the method and the window from the cost of
+ * each, the _threads() variant splits the points across `threads` (<= 0 for
+ * one per online CPU), at least SM2_Z256_MSM_THREAD_MIN_POINTS each.
+ */
+#define SM2_Z256_MSM_MAX_WINDOW_SIZE	16
+#define SM2_Z256_MSM_MAX_THREADS	64
+#define SM2_Z256_MSM_THREAD_MIN_POINTS	1024
+int sm2_z256_point_multi_mul(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n);
+int sm2_z256_point_multi_mul_straus(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n);
+// window_size in 2..SM2_Z256_MSM_MAX_WINDOW_SIZE, or 0 to choose it from n
+int sm2_z256_point_multi_mul_pippenger(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n,
+	int window_size);
+int sm2_z256_point_multi_mul_threads(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n,
+	int threads);
 
 
 const uint64_t *sm2_z256_prime(void);
@@ -136,6 +187,15 @@ int sm2_z256_point_from_x_bytes(SM2_Z256_POINT *P, const uint8_t x_bytes[32], in
 int sm2_z256_point_from_hash(SM2_Z256_POINT *R, const uint8_t *data, size_t datalen, int y_is_odd);
 int sm2_z256_point_from_octets(SM2_Z256_POINT *P, const uint8_t *in, size_t inlen);
 
+/*
+ * Decode n points, e.g. the compressed public keys of a device registry.
+ * Invalid encodings and points not on the curve set ok[i] = 0 (if `ok` is not
+ * NULL) and P[i] to infinity, and make the return value 0. Compressed points
+ * take a fixed addition chain for the square root, several at a time.
+ */
+int sm2_z256_points_from_octets_batch(SM2_Z256_POINT *P, const uint8_t *const *in, const size_t *inlen,
+	size_t n, int *ok);
+
 int sm2_z256_point_to_uncompressed_octets(const SM2_Z256_POINT *P, uint8_t out[65]);
 int sm2_z256_point_to_compressed_octets(const SM2_Z256_POINT *P, uint8_t out[33]);
 int sm2_z256_point_from_octets(SM2_Z256_POINT *P, const uint8_t *in, size_t inlen);
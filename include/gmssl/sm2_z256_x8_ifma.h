@@ -0,0 +1,36 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM2_Z256_X8_IFMA_H
+#define GMSSL_SM2_Z256_X8_IFMA_H
+
+#include <stdint.h>
+#include <gmssl/sm2_z256.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * R[i] = s[i] * G + t[i] * P[i] for the 8 lanes, G_table and P_tables[i] are the
+ * sm2_z256_point_mul_pre_compute() tables of G and P[i]. Variable time, for public
+ * scalars only. Returns the mask of the lanes that hit an exceptional addition
+ * (doubling or a point plus its negation), R[i] of these lanes must be recomputed.
+ * Needs AVX512F and AVX512IFMA.
+ */
+unsigned int sm2_z256_point_mul_sum_x8(SM2_Z256_POINT R[8],
+	const uint64_t s[8][4], const uint64_t t[8][4],
+	const SM2_Z256_POINT G_table[16], const SM2_Z256_POINT *const P_tables[8]);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -24,7 +24,7 @@ extern "C" {
 #define SM3_STATE_WORDS		8
 
 
-typedef struct {
+typedef struct SM3_CTX_st {
 	uint32_t digest[SM3_STATE_WORDS];
 	uint64_t nblocks;
 	uint8_t block[SM3_BLOCK_SIZE];
@@ -33,21 +33,131 @@ typedef struct {
 
 void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks);
 
+// ARMv8.2 SM3 instructions, `sm3_compress_blocks` dispatches to it when the CPU has them
+#ifdef ENABLE_SM3_CE
+void sm3_ce_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks);
+#endif
+
+// single stream with the message expansion of two blocks in AVX2, the AVX-512VL one is dispatched to
+#ifdef ENABLE_SM3_AVX2
+void sm3_avx2_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks);
+#ifdef ENABLE_SM3_AVX512
+void sm3_avx512_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks);
+#endif
+#endif
+
+// WebAssembly SIMD128 4-lane compression, the multi-buffer lanes below run on it in two halves
+#ifdef ENABLE_SM3_WASM
+void sm3_x4_compress_lanes(uint32_t digest[8][4], const uint8_t *data[4], size_t nblocks);
+#endif
+
 void sm3_init(SM3_CTX *ctx);
 void sm3_update(SM3_CTX *ctx, const uint8_t *data, size_t datalen);
 void sm3_finish(SM3_CTX *ctx, uint8_t dgst[SM3_DIGEST_SIZE]);
 
+/*
+ * Scatter-gather update, the same as one sm3_update() per buffer. Small
+ * buffers are gathered into a stack buffer of SM3_UPDATEV_BLOCKS blocks and
+ * compressed together, a block-aligned run of a buffer is compressed in place,
+ * so sm3_compress_blocks() gets the longest runs the layout allows.
+ * The layout is the one of TLS_IOVEC.
+ */
+#define SM3_UPDATEV_BLOCKS	16
+
+typedef struct {
+	const void *base;
+	size_t len;
+} SM3_IOVEC;
+
+void sm3_updatev(SM3_CTX *ctx, const SM3_IOVEC *iov, size_t iovcnt);
+
+/*
+ * One-shot SM3 of 32, 64 and 96-byte messages, the sizes of node, pair and
+ * prefixed-pair hashes. The padding is a precomputed tail or block, no
+ * context is set up. `sm3_finish32` ends a hash of `nblocks` compressed
+ * blocks with `digest` as state by 32 more bytes, as the outer hash of HMAC.
+ * The x8 ones hash 8 messages in the AVX2 lanes when the CPU has them.
+ */
+void sm3_digest32(const uint8_t in[32], uint8_t dgst[SM3_DIGEST_SIZE]);
+void sm3_digest64(const uint8_t in[64], uint8_t dgst[SM3_DIGEST_SIZE]);
+void sm3_digest96(const uint8_t in[96], uint8_t dgst[SM3_DIGEST_SIZE]);
+void sm3_finish32(const uint32_t digest[SM3_STATE_WORDS], uint64_t nblocks, const uint8_t in[32],
+	uint8_t dgst[SM3_DIGEST_SIZE]);
+void sm3_digest32_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE]);
+void sm3_digest64_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE]);
+void sm3_digest96_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE]);
+
+
+/*
+ * Multi-buffer SM3
+ *
+ * Up to SM3_MB_LANES independent messages are hashed in parallel, one per
+ * SIMD lane. `sm3_mb_submit` assigns a job to a free lane and returns a
+ * finished job, or NULL if it only filled a lane. A lane is refilled as soon
+ * as its job is done, so messages of mixed lengths keep every lane busy.
+ * `sm3_mb_flush` runs the remaining jobs and returns them one by one, NULL
+ * when the manager is empty. At most SM3_MB_LANES jobs are held, a job and
+ * its data must stay valid until it is returned.
+ */
+#define SM3_MB_LANES		8
+
+typedef struct {
+	const uint8_t *data;
+	size_t datalen;
+	uint8_t *dgst; // SM3_DIGEST_SIZE bytes, written when the job is returned
+	const struct SM3_CTX_st *prefix; // NULL, or a context with no buffered bytes (num == 0) continued by `data`
+} SM3_MB_JOB;
+
+typedef struct {
+	SM3_MB_JOB *job;
+	const uint8_t *data;
+	size_t nblocks;
+	size_t padblocks;
+	uint8_t pad[SM3_BLOCK_SIZE * 2];
+} SM3_MB_LANE;
+
+typedef struct {
+	uint32_t digest[SM3_STATE_WORDS][SM3_MB_LANES]; // word-major, lane i in column i
+	SM3_MB_LANE lanes[SM3_MB_LANES];
+	SM3_MB_JOB *done[SM3_MB_LANES];
+	size_t done_num;
+	size_t busy_num;
+	int simd;
+} SM3_MB_CTX;
+
+void sm3_mb_init(SM3_MB_CTX *ctx);
+SM3_MB_JOB *sm3_mb_submit(SM3_MB_CTX *ctx, SM3_MB_JOB *job);
+SM3_MB_JOB *sm3_mb_flush(SM3_MB_CTX *ctx);
+
+void sm3_digest_batch(const uint8_t *const *datas, const size_t *datalens, size_t count,
+	uint8_t (*dgsts)[SM3_DIGEST_SIZE]);
+
 
 #define SM3_HMAC_SIZE		(SM3_DIGEST_SIZE)
 
+/*
+ * The (K ^ ipad) and (K ^ opad) blocks are compressed once into a SM3_HMAC_KEY,
+ * `sm3_hmac_init_with_key` starts a MAC from it without any compression.
+ */
+typedef struct {
+	uint32_t ipad_digest[SM3_STATE_WORDS];
+	uint32_t opad_digest[SM3_STATE_WORDS];
+} SM3_HMAC_KEY;
+
 typedef struct {
 	SM3_CTX sm3_ctx;
-	uint8_t key[SM3_BLOCK_SIZE];
+	uint32_t opad_digest[SM3_STATE_WORDS];
 } SM3_HMAC_CTX;
 
+void sm3_hmac_set_key(SM3_HMAC_KEY *hmac_key, const uint8_t *key, size_t keylen);
+void sm3_hmac_init_with_key(SM3_HMAC_CTX *ctx, const SM3_HMAC_KEY *hmac_key);
 void sm3_hmac_init(SM3_HMAC_CTX *ctx, const uint8_t *key, size_t keylen);
 void sm3_hmac_update(SM3_HMAC_CTX *ctx, const uint8_t *data, size_t datalen);
+void sm3_hmac_updatev(SM3_HMAC_CTX *ctx, const SM3_IOVEC *iov, size_t iovcnt);
 void sm3_hmac_finish(SM3_HMAC_CTX *ctx, uint8_t mac[SM3_HMAC_SIZE]);
+// macs[i] = the MAC of ctxs[i] (inited, no data yet) over datas[i], in the multi-buffer lanes
+void sm3_hmac_batch(const SM3_HMAC_CTX *const *ctxs, const uint8_t *const *datas, const size_t *datalens,
+	size_t count, uint8_t (*macs)[SM3_HMAC_SIZE]);
 
 
 typedef struct {
@@ -55,6 +165,7 @@ typedef struct {
 	size_t outlen;
 } SM3_KDF_CTX;
 
+// outputs longer than one digest are generated SM3_MB_LANES counter blocks at a time
 void sm3_kdf_init(SM3_KDF_CTX *ctx, size_t outlen);
 void sm3_kdf_update(SM3_KDF_CTX *ctx, const uint8_t *in, size_t inlen);
 void sm3_kdf_finish(SM3_KDF_CTX *ctx, uint8_t *out);
@@ -69,6 +180,12 @@ int sm3_pbkdf2(const char *pass, size_t passlen,
 	const uint8_t *salt, size_t saltlen, size_t count,
 	size_t outlen, uint8_t *out);
 
+// derive outlen bytes into outs[i] from passes[i] and salts[i] for i < num, the
+// output blocks of all passwords run SM3_MB_LANES at a time in the SIMD lanes
+int sm3_pbkdf2_batch(const char *const *passes, const size_t *passlens,
+	const uint8_t *const *salts, const size_t *saltlens, size_t count,
+	size_t outlen, uint8_t *const *outs, size_t num);
+
 
 typedef struct {
 	union {
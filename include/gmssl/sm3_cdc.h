@@ -0,0 +1,88 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM3_CDC_H
+#define GMSSL_SM3_CDC_H
+
+#include <string.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Content-defined chunking with SM3 fingerprints
+ *
+ * The stream is cut with the FastCDC rule: the 64-bit Gear hash
+ * h = (h << 1) + GEAR[byte] starts `min_size` bytes into a chunk, and a chunk
+ * ends after the first byte where the top bits of h are zero, log2(avg_size)
+ * + 2 bits before `avg_size` bytes and log2(avg_size) - 2 bits after, or at
+ * `max_size` bytes. Only the last chunk of a stream may be shorter than
+ * `min_size`. The GEAR table is fixed, so the same data is cut at the same
+ * places by every version.
+ *
+ * The chunks found by one sm3_cdc_update() are fingerprinted together in the
+ * SM3_MB_LANES multi-buffer lanes, SM3_CDC_BATCH at a time, and passed to the
+ * callback in stream order with their data, valid only during the call. The
+ * callback returns 1 to go on. A chunk still open at the end of the input of
+ * sm3_cdc_update() is kept in the context, at most `max_size` bytes, and
+ * sm3_cdc_finish() ends the last one and readies the context for a new stream.
+ */
+#define SM3_CDC_MIN_AVG_SIZE		256
+#define SM3_CDC_MAX_SIZE		(16 * 1024 * 1024)
+#define SM3_CDC_DEFAULT_MIN_SIZE	2048
+#define SM3_CDC_DEFAULT_AVG_SIZE	8192
+#define SM3_CDC_DEFAULT_MAX_SIZE	65536
+#define SM3_CDC_BATCH			(SM3_MB_LANES * 4)
+
+typedef struct {
+	uint64_t offset;
+	size_t len;
+	uint8_t fingerprint[SM3_DIGEST_SIZE];
+} SM3_CDC_CHUNK;
+
+typedef int (*SM3_CDC_CALLBACK)(void *arg, const SM3_CDC_CHUNK *chunk, const uint8_t *data);
+
+typedef struct {
+	uint64_t gear[256];
+	uint64_t mask_small; // before avg_size
+	uint64_t mask_large;
+	size_t min_size;
+	size_t avg_size;
+	size_t max_size;
+	SM3_CDC_CALLBACK callback;
+	void *callback_arg;
+
+	uint64_t offset; // of the next chunk
+	size_t scan_pos; // of the open chunk, Gear hash of its bytes from min_size to scan_pos
+	uint64_t scan_hash;
+	uint8_t *buf; // open chunk carried between updates
+	size_t buflen;
+
+	const uint8_t *batch_data[SM3_CDC_BATCH];
+	size_t batch_lens[SM3_CDC_BATCH];
+	uint8_t batch_dgsts[SM3_CDC_BATCH][SM3_DIGEST_SIZE];
+	size_t batch_cnt;
+} SM3_CDC_CTX;
+
+// sizes 0 for the defaults, `avg_size` is a power of two, min_size < avg_size < max_size
+int sm3_cdc_init(SM3_CDC_CTX *ctx, size_t min_size, size_t avg_size, size_t max_size,
+	SM3_CDC_CALLBACK callback, void *callback_arg);
+int sm3_cdc_update(SM3_CDC_CTX *ctx, const uint8_t *data, size_t datalen);
+int sm3_cdc_finish(SM3_CDC_CTX *ctx);
+void sm3_cdc_cleanup(SM3_CDC_CTX *ctx);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,59 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM3_CL_H
+#define GMSSL_SM3_CL_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4_cl.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Batch SM3 on the OpenCL device, one work item per message. The batches are
+ * independent messages of the same length: chunk fingerprints, Merkle tree
+ * leaves and nodes, and the WOTS+ chains of sm3_xmss.
+ */
+
+typedef struct {
+	cl_context context;
+	cl_device_id device;
+	cl_command_queue queue;
+	cl_program program;
+	cl_kernel kernel_digest;
+	cl_kernel kernel_wots;
+	cl_mem mem_in; // kept for the next calls
+	size_t mem_in_size;
+	cl_mem mem_out;
+	size_t mem_out_size;
+} SM3_CL_CTX;
+
+// share == NULL opens the device as sm4_cl does, or the context and queue of `share` are used
+int sm3_cl_init(SM3_CL_CTX *ctx, const SM4_CL_CTX *share);
+// dgsts[i] = SM3(msgs + msglen * i, msglen), blocking
+int sm3_cl_digest_batch(SM3_CL_CTX *ctx, const uint8_t *msgs, size_t msglen, size_t nmsgs,
+	uint8_t (*dgsts)[SM3_DIGEST_SIZE]);
+// the chain steps start .. start + steps - 1 of sm3_xmss (w = 16) on x[i], in place.
+// adrs[i] carries the chain address of x[i], the hash address and key_and_mask are set here
+int sm3_cl_wots_chains(SM3_CL_CTX *ctx, const uint8_t seed[32], const uint8_t (*adrs)[32],
+	uint8_t (*x)[32], size_t n, int start, int steps);
+void sm3_cl_cleanup(SM3_CL_CTX *ctx);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
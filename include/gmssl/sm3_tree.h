@@ -0,0 +1,138 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM3_TREE_H
+#define GMSSL_SM3_TREE_H
+
+#include <string.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * SM3 tree hash
+ *
+ * The input is cut into leaves of `leaf_size` bytes, the last one may be
+ * shorter, an empty input is one empty leaf. With one-byte domain prefixes
+ *
+ *	leaf(i)   = SM3(0x00 || SM3(data of leaf i))
+ *	node(l,r) = SM3(0x01 || l || r)
+ *	root      = SM3(0x02 || leaf_size (uint32) || n (uint64) || MTH(leaf(0..n-1)))
+ *
+ * where MTH is the Merkle tree hash of RFC 6962: a tree of n > 1 leaves is
+ * split after the largest power of two below n. Integers are big-endian.
+ * The inner SM3 of the leaves runs in the SM3_MB_LANES multi-buffer lanes on
+ * `threads` threads (<= 0 for one per online CPU, at most SM3_TREE_MAX_THREADS).
+ *
+ * A leaf is checked against a known root with its audit path of at most
+ * SM3_TREE_MAX_HEIGHT sibling hashes, or against the list of all leaf hashes
+ * once that list matches the root, without hashing any other data.
+ */
+#define SM3_TREE_MIN_LEAF_SIZE		SM3_BLOCK_SIZE
+#define SM3_TREE_MAX_LEAF_SIZE		(1 << 30)
+#define SM3_TREE_DEFAULT_LEAF_SIZE	(1024 * 1024)
+#define SM3_TREE_MAX_HEIGHT		64
+#define SM3_TREE_MAX_THREADS		64
+
+typedef struct {
+	uint8_t subtrees[SM3_TREE_MAX_HEIGHT][SM3_DIGEST_SIZE]; // subtrees[i] is set when bit i of count is
+	uint64_t count;
+	size_t leaf_size;
+	int threads;
+	SM3_CTX leaf_ctx;
+	size_t leaf_len;
+} SM3_TREE_CTX;
+
+void sm3_tree_leaf_hash(const uint8_t *data, size_t datalen, uint8_t hash[SM3_DIGEST_SIZE]);
+void sm3_tree_node_hash(const uint8_t left[SM3_DIGEST_SIZE], const uint8_t right[SM3_DIGEST_SIZE],
+	uint8_t hash[SM3_DIGEST_SIZE]);
+// leaf hashes of the ceil(datalen / leaf_size) leaves of `data`, only the last one may be short
+int sm3_tree_hash_leaves(const uint8_t *data, size_t datalen, size_t leaf_size,
+	uint8_t (*hashes)[SM3_DIGEST_SIZE], int threads);
+
+int sm3_tree_init(SM3_TREE_CTX *ctx, size_t leaf_size, int threads);
+int sm3_tree_update(SM3_TREE_CTX *ctx, const uint8_t *data, size_t datalen);
+// add the next `count` leaf hashes, all leaves so far must be full
+int sm3_tree_append_leaves(SM3_TREE_CTX *ctx, const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count);
+int sm3_tree_finish(SM3_TREE_CTX *ctx, uint8_t root[SM3_DIGEST_SIZE]);
+
+int sm3_tree_root(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, size_t leaf_size,
+	uint8_t root[SM3_DIGEST_SIZE]);
+int sm3_tree_prove(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, size_t index,
+	uint8_t (*path)[SM3_DIGEST_SIZE], size_t *pathlen);
+// 1 if leaf `index` of a `count`-leaf tree with `root` has `leaf_hash`, 0 if not
+int sm3_tree_verify(const uint8_t root[SM3_DIGEST_SIZE], size_t leaf_size, uint64_t count,
+	uint64_t index, const uint8_t leaf_hash[SM3_DIGEST_SIZE],
+	const uint8_t (*path)[SM3_DIGEST_SIZE], size_t pathlen);
+
+
+/*
+ * SM3 Merkle log (RFC 6962 / RFC 9162 over SM3)
+ *
+ * The entries of an append-only log are the leaves, of any length, with
+ *
+ *	leaf      = SM3(0x00 || entry)
+ *	node(l,r) = SM3(0x01 || l || r)
+ *	root      = MTH(leaf(0..n-1)), SM3("") for the empty log
+ *
+ * so the inclusion and consistency proofs are the ones of RFC 9162 2.1.3
+ * and 2.1.4. SM3_LOG keeps the frontier, the roots of the complete subtrees
+ * of the log, so an append costs O(log n) hashes and the root is folded from
+ * at most SM3_TREE_MAX_HEIGHT hashes. Leaf hashes are computed in the
+ * multi-buffer lanes. The proofs are built from the list of all leaf hashes.
+ *
+ * A batch proof of the leaves at the ascending `indexes` holds each hash
+ * needed by any of them once, the roots of the subtrees without any of these
+ * leaves, left to right. The verifier computes each node above the leaves
+ * once, at most count * SM3_TREE_MAX_HEIGHT hashes are in a batch proof.
+ */
+#define SM3_LOG_MAX_PROOF_SIZE		(SM3_TREE_MAX_HEIGHT * 2)
+
+typedef struct {
+	uint8_t frontier[SM3_TREE_MAX_HEIGHT][SM3_DIGEST_SIZE]; // frontier[i] is set when bit i of size is
+	uint64_t size;
+} SM3_LOG;
+
+void sm3_log_leaf_hash(const uint8_t *entry, size_t entrylen, uint8_t hash[SM3_DIGEST_SIZE]);
+int sm3_log_hash_leaves(const uint8_t *const *entries, const size_t *entrylens, size_t count,
+	uint8_t (*hashes)[SM3_DIGEST_SIZE]);
+
+void sm3_log_init(SM3_LOG *log);
+int sm3_log_append(SM3_LOG *log, const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count);
+int sm3_log_root(const SM3_LOG *log, uint8_t root[SM3_DIGEST_SIZE]);
+int sm3_log_tree_root(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, uint8_t root[SM3_DIGEST_SIZE]);
+
+int sm3_log_prove_inclusion(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, size_t index,
+	uint8_t (*path)[SM3_DIGEST_SIZE], size_t *pathlen);
+int sm3_log_verify_inclusion(const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	uint64_t index, const uint8_t leaf_hash[SM3_DIGEST_SIZE],
+	const uint8_t (*path)[SM3_DIGEST_SIZE], size_t pathlen);
+// the log of `size` leaves extends the one of the first `old_size` leaves, 0 < old_size <= size
+int sm3_log_prove_consistency(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, size_t old_size,
+	uint8_t (*proof)[SM3_DIGEST_SIZE], size_t *prooflen);
+int sm3_log_verify_consistency(const uint8_t old_root[SM3_DIGEST_SIZE], uint64_t old_size,
+	const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	const uint8_t (*proof)[SM3_DIGEST_SIZE], size_t prooflen);
+
+int sm3_log_prove_batch(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size,
+	const uint64_t *indexes, size_t count,
+	uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t *nodes_cnt);
+int sm3_log_verify_batch(const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	const uint64_t *indexes, const uint8_t (*leaf_hashes)[SM3_DIGEST_SIZE], size_t count,
+	const uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t nodes_cnt);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
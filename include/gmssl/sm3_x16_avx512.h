@@ -0,0 +1,28 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM3_X16_AVX512_H
+#define GMSSL_SM3_X16_AVX512_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// the i-th lane hashes nblocks from data[i], digest[word][lane], needs AVX512F and AVX512BW
+void sm3_x16_compress_lanes(uint32_t digest[8][16], const uint8_t *data[16], size_t nblocks);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
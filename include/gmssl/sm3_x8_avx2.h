@@ -24,6 +24,7 @@ typedef struct {
 
 void sm3_x8_init(SM3_X8_CTX *ctx);
 void sm3_x8_compress_blocks(__m256i digest[8], const uint8_t *data, size_t datalen);
+void sm3_x8_compress_lanes(uint32_t digest[8][8], const uint8_t *data[8], size_t nblocks);
 void sm3_x8_digest(const uint8_t *data, size_t datalen, uint8_t dgst[8][32]);
 
 
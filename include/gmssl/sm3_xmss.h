@@ -54,9 +54,15 @@ void sm3_wots_sig_to_pk(const hash256_bytes_t sig[67], const uint8_t dgst[32],
 	const  HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32],
 	hash256_bytes_t pk[67]);
 
+// The leaves are derived by one thread per online CPU
 void sm3_xmss_derive_root(const uint8_t xmss_secret[32], int height,
 	const uint8_t seed[32],
 	hash256_bytes_t *tree, uint8_t xmss_root[32]);
+// `threads` <= 0 for one per online CPU, at most XMSS_MAX_THREADS
+#define XMSS_MAX_THREADS	64
+void sm3_xmss_derive_root_ex(const uint8_t xmss_secret[32], int height,
+	const uint8_t seed[32], int threads,
+	hash256_bytes_t *tree, uint8_t xmss_root[32]);
 void sm3_xmss_do_sign(const uint8_t xmss_secret[32], int index,
 	const uint8_t seed[32], const uint8_t in_adrs[32], int height,
 	const hash256_bytes_t *tree,
@@ -69,6 +75,40 @@ void sm3_xmss_sig_to_root(const hash256_bytes_t wots_sig[67], int index, const h
 	const uint8_t dgst[32],
 	uint8_t xmss_root[32]);
 
+/*
+ * BDS traversal (Buchmann, Dahmen, Schneider, "Merkle Tree Traversal Revisited")
+ * keeps O(h) nodes instead of the 2^(h+1) - 1 nodes of the tree, every
+ * sm3_xmss_bds_next() derives at most h/2 + 1 leaves.
+ */
+typedef struct {
+	uint32_t next_index;
+	uint8_t stack_usage;
+	uint8_t completed;
+	hash256_bytes_t node;
+} SM3_XMSS_TREEHASH;
+
+typedef struct {
+	int height;
+	uint32_t index; // auth is the auth path of this leaf
+	hash256_bytes_t auth[20];
+	hash256_bytes_t keep[10];
+	SM3_XMSS_TREEHASH treehash[20]; // treehash[h] computes the next right node of height h
+	hash256_bytes_t stack[21]; // shared by the treehash instances
+	uint8_t stack_levels[21];
+	uint8_t stack_size;
+} SM3_XMSS_BDS;
+
+// `threads` as sm3_xmss_derive_root_ex(), bds->index = 0
+int sm3_xmss_bds_init(SM3_XMSS_BDS *bds, const uint8_t xmss_secret[32], int height,
+	const uint8_t seed[32], int threads, uint8_t xmss_root[32]);
+// move the auth path to bds->index + 1
+int sm3_xmss_bds_next(SM3_XMSS_BDS *bds, const uint8_t xmss_secret[32], const uint8_t seed[32]);
+void sm3_xmss_bds_do_sign(const uint8_t xmss_secret[32], const uint8_t seed[32],
+	const uint8_t in_adrs[32], const SM3_XMSS_BDS *bds,
+	const uint8_t dgst[32],
+	hash256_bytes_t wots_sig[67],
+	hash256_bytes_t *auth_path);
+
 enum {
 	XMSS_SM3_10	= 0x10000001,
 	XMSS_SM3_16	= 0x10000002,
@@ -87,10 +127,14 @@ typedef struct {
 	uint8_t secret[32];
 	uint8_t prf_key[32];
 	uint32_t index;
-	hash256_bytes_t *tree;
+	hash256_bytes_t *tree; // NULL if bds is used
+	SM3_XMSS_BDS *bds;
 } SM3_XMSS_KEY;
 
 int sm3_xmss_key_generate(SM3_XMSS_KEY *key, uint32_t oid);
+int sm3_xmss_key_generate_bds(SM3_XMSS_KEY *key, uint32_t oid);
+// index++ after a signature, the key is used up when index == 2^h
+int sm3_xmss_key_update(SM3_XMSS_KEY *key);
 int sm3_xmss_key_print(FILE *fp, int fmt, int ind, const char *label, const SM3_XMSS_KEY *key);
 int sm3_xmss_key_get_height(const SM3_XMSS_KEY *key, uint32_t *height);
 int sm3_xmss_key_to_bytes(const SM3_XMSS_KEY *key, uint8_t *out, size_t *outlen);
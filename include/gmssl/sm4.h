@@ -34,6 +34,7 @@ void sm4_set_decrypt_key(SM4_KEY *key, const uint8_t raw_key[SM4_KEY_SIZE]);
 void sm4_encrypt(const SM4_KEY *key, const uint8_t in[SM4_BLOCK_SIZE], uint8_t out[SM4_BLOCK_SIZE]);
 
 void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+// CBC encryption and decryption can be done in place, `in` == `out`
 void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[SM4_BLOCK_SIZE],
 	const uint8_t *in, size_t nblocks, uint8_t *out);
 void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[SM4_BLOCK_SIZE],
@@ -41,6 +42,70 @@ void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[SM4_BLOCK_SIZE],
 void sm4_ctr_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
 void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
 
+/*
+ * Multi-key batches, every job has its own key. The blocks of all the jobs are
+ * encrypted together in the SIMD lanes of the backend (8 with AVX2, 16 with
+ * AVX-512), which pays off when there are many jobs of a few blocks each.
+ * `in` == `out` is supported.
+ */
+typedef struct {
+	const SM4_KEY *key;
+	const uint8_t *in;
+	uint8_t *out;
+	size_t nblocks;
+} SM4_MULTI_KEY_JOB;
+
+void sm4_encrypt_multi_key(const SM4_MULTI_KEY_JOB *jobs, size_t njobs);
+// expand `nkeys` keys, `user_keys` is `nkeys` raw keys of SM4_KEY_SIZE bytes
+void sm4_set_encrypt_key_multi(SM4_KEY *keys, const uint8_t *user_keys, size_t nkeys);
+
+// Bulk kernels of the optional backends, `sm4_encrypt_blocks`, `sm4_ctr32_encrypt_blocks` and
+// `sm4_cbc_decrypt_blocks` dispatch to the fastest of them supported by the CPU, see `gmssl_cpu_features`
+#ifdef ENABLE_SM4_BITSLICE
+void sm4_bitslice_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_bitslice_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_bitslice_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_SM4_AESNI
+void sm4_aesni_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_aesni_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_aesni_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_SM4_AVX2
+void sm4_avx2_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx2_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx2_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx2_encrypt_multi_key(const SM4_KEY *const keys[8], const uint8_t *const in[8], uint8_t *const out[8]);
+void sm4_avx2_set_encrypt_key_multi(SM4_KEY *const keys[8], const uint8_t *const user_keys[8]);
+#endif
+#ifdef ENABLE_SM4_AVX512
+void sm4_avx512_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx512_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx512_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_avx512_encrypt_multi_key(const SM4_KEY *const keys[16], const uint8_t *const in[16], uint8_t *const out[16]);
+void sm4_avx512_set_encrypt_key_multi(SM4_KEY *const keys[16], const uint8_t *const user_keys[16]);
+#endif
+#ifdef ENABLE_SM4_ARM64
+void sm4_arm64_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_arm64_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_arm64_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_SM4_CE
+void sm4_ce_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_ce_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_ce_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_SM4_RISCV
+void sm4_riscv_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_riscv_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_riscv_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+#ifdef ENABLE_SM4_WASM
+void sm4_wasm_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_wasm_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+void sm4_wasm_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+#endif
+
 int  sm4_cbc_padding_encrypt(const SM4_KEY *key, const uint8_t iv[SM4_BLOCK_SIZE],
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int  sm4_cbc_padding_decrypt(const SM4_KEY *key, const uint8_t iv[SM4_BLOCK_SIZE],
@@ -69,11 +134,16 @@ void sm4_ctr_encrypt(const SM4_KEY *key, uint8_t ctr[SM4_BLOCK_SIZE],
 void sm4_ctr32_encrypt(const SM4_KEY *key, uint8_t ctr[SM4_BLOCK_SIZE],
 	const uint8_t *in, size_t inlen, uint8_t *out);
 
+// the CTR32 streaming functions generate the keystream this many blocks ahead
+#define SM4_CTR_KEYSTREAM_BLOCKS	16
+
 typedef struct {
 	SM4_KEY sm4_key;
 	uint8_t ctr[SM4_BLOCK_SIZE];
 	uint8_t block[SM4_BLOCK_SIZE];
 	size_t block_nbytes;
+	uint8_t keystream[SM4_BLOCK_SIZE * SM4_CTR_KEYSTREAM_BLOCKS];
+	size_t keystream_nbytes; // unused bytes at the end of `keystream`, `ctr` is past them
 } SM4_CTR_CTX;
 
 int sm4_ctr_encrypt_init(SM4_CTR_CTX *ctx, const uint8_t key[SM4_KEY_SIZE], const uint8_t ctr[SM4_BLOCK_SIZE]);
@@ -174,6 +244,24 @@ int sm4_ofb_encrypt_init(SM4_OFB_CTX *ctx,
 int sm4_ofb_encrypt_update(SM4_OFB_CTX *ctx,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
 int sm4_ofb_encrypt_finish(SM4_OFB_CTX *ctx, uint8_t *out, size_t *outlen);
+
+/*
+ * Thread-safe OFB keystream ring of `nblocks` blocks. The OFB keystream does not
+ * depend on the data, so it is generated ahead and `sm4_ofb_stream_encrypt` is
+ * only a XOR. With `background` a thread keeps the ring full, otherwise call
+ * `sm4_ofb_stream_refill` at idle time. A drained ring generates inline.
+ * The output is not block aligned, `outlen` is always `inlen`.
+ */
+#define SM4_OFB_STREAM_MIN_BLOCKS	16
+
+typedef struct SM4_OFB_STREAM_st SM4_OFB_STREAM;
+
+SM4_OFB_STREAM *sm4_ofb_stream_new(const uint8_t key[SM4_KEY_SIZE], const uint8_t iv[SM4_BLOCK_SIZE],
+	size_t nblocks, int background);
+void sm4_ofb_stream_free(SM4_OFB_STREAM *stream);
+int sm4_ofb_stream_refill(SM4_OFB_STREAM *stream);
+size_t sm4_ofb_stream_available(SM4_OFB_STREAM *stream);
+int sm4_ofb_stream_encrypt(SM4_OFB_STREAM *stream, const uint8_t *in, size_t inlen, uint8_t *out);
 #endif // ENABLE_SM4_OFB
 
 
@@ -229,6 +317,37 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 int sm4_ccm_decrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out);
+
+// CCM needs the payload length `inlen` before the first block
+typedef struct {
+	SM4_KEY sm4_key;
+	uint8_t ctr[16];
+	size_t ctr_size;
+	uint8_t mac[16];
+	uint8_t S0[16]; // E(K, A_0)
+	size_t inlen;
+	size_t processed;
+	uint8_t block[16];
+	size_t block_nbytes;
+	size_t taglen;
+	uint8_t tag[16];
+	size_t tag_nbytes;
+} SM4_CCM_CTX;
+
+int sm4_ccm_encrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen);
+int sm4_ccm_encrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sm4_ccm_encrypt_finish(SM4_CCM_CTX *ctx,
+	uint8_t *out, size_t *outlen);
+int sm4_ccm_decrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen);
+int sm4_ccm_decrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+int sm4_ccm_decrypt_finish(SM4_CCM_CTX *ctx,
+	uint8_t *out, size_t *outlen);
 #endif // ENABLE_SM4_CCM
 
 
@@ -240,6 +359,21 @@ int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 int sm4_xts_decrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
 	const uint8_t *in, size_t inlen, uint8_t *out);
 
+/*
+ * Data unit i of the `nsectors` units of `sector_size` bytes uses the tweak
+ * `tweak` + i (little-endian, as SM4_XTS_CTX increments it), for the sectors
+ * of a block device. `sector_size` is a multiple of 16. The tweaks are
+ * computed in batches and every batch goes through one `sm4_encrypt_blocks`
+ * call of the widest backend. `threads` <= 0 for one per online CPU, at most
+ * SM4_XTS_MAX_THREADS, 1 to run in the calling thread only.
+ */
+#define SM4_XTS_MAX_THREADS	64
+
+int sm4_xts_encrypt_sectors(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int threads);
+int sm4_xts_decrypt_sectors(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int threads);
+
 typedef struct {
 	SM4_KEY key1;
 	SM4_KEY key2;
@@ -31,6 +31,36 @@ void sm4_cbc_mac_update(SM4_CBC_MAC_CTX *ctx, const uint8_t *data, size_t datale
 void sm4_cbc_mac_finish(SM4_CBC_MAC_CTX *ctx, uint8_t mac[16]);
 
 
+typedef struct {
+	SM4_KEY key;
+	uint8_t k1[16];
+	uint8_t k2[16];
+	uint8_t iv[16];
+	uint8_t block[16];
+	size_t block_nbytes;
+} SM4_CMAC_CTX;
+
+#define SM4_CMAC_SIZE		(SM4_BLOCK_SIZE)
+
+// SM4-CMAC, the CMAC mode of NIST SP 800-38B over SM4
+void sm4_cmac_init(SM4_CMAC_CTX *ctx, const uint8_t key[16]);
+void sm4_cmac_update(SM4_CMAC_CTX *ctx, const uint8_t *data, size_t datalen);
+void sm4_cmac_finish(SM4_CMAC_CTX *ctx, uint8_t mac[16]);
+
+
+/*
+ * MACs of `cnt` independent messages under one key, `macs` is `cnt` * 16
+ * bytes. The chains of up to SM4_MAC_BATCH_LANES messages advance together,
+ * one block of each per sm4_encrypt_blocks() call, so the MACs run on the
+ * multi-block SM4 backends. Messages under different keys are grouped by key
+ * by the caller, one call per key.
+ */
+#define SM4_MAC_BATCH_LANES	16
+
+void sm4_cbc_mac_batch(const SM4_KEY *key, const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *macs);
+void sm4_cmac_batch(const SM4_CMAC_CTX *ctx, const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *macs);
+
+
 #ifdef __cplusplus
 }
 #endif
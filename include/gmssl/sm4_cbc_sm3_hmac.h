@@ -45,6 +45,34 @@ int sm4_cbc_sm3_hmac_decrypt_update(SM4_CBC_SM3_HMAC_CTX *ctx,
 int sm4_cbc_sm3_hmac_decrypt_finish(SM4_CBC_SM3_HMAC_CTX *ctx,
 	uint8_t *out, size_t *outlen);
 
+/*
+ * Stitched SM4-CBC and SM3
+ *
+ * `sm4_cbc_encrypt_sm3_compress` CBC-encrypts `nchunks` 64-byte chunks from `in`
+ * to `out` and compresses the same number of SM3 blocks from `sm3_data` into
+ * `digest`, interleaving the rounds of both serial chains. Each chunk is read
+ * in full before it is written, so `out` may equal `in`, and `sm3_data` may
+ * point to output of earlier chunks.
+ *
+ * `sm4_cbc_encrypt_sm3_update` hashes the plaintext (TLCP MAC-then-encrypt),
+ * `sm4_cbc_encrypt_then_sm3_update` hashes the ciphertext (encrypt-then-MAC),
+ * both as `sm3_update` would, with ENABLE_SM4_CBC_SM3_STITCH they are stitched,
+ * otherwise they run the two passes. `sm4_cbc_decrypt_sm3_update` decrypts in chunks
+ * and hashes the first `sm3_len` bytes of the plaintext while it is cache-hot.
+ */
+#define SM4_CBC_SM3_STITCH_MIN_SIZE	192
+#define SM4_CBC_SM3_DECRYPT_CHUNK	1024
+
+void sm4_cbc_encrypt_sm3_compress(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nchunks, uint8_t *out,
+	uint32_t digest[8], const uint8_t *sm3_data);
+void sm4_cbc_encrypt_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx);
+void sm4_cbc_encrypt_then_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx);
+void sm4_cbc_decrypt_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx, size_t sm3_len);
+
 
 #ifdef __cplusplus
 }
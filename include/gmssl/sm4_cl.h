@@ -26,23 +26,163 @@ extern "C" {
 #endif
 
 
+// shared by the OpenCL modules: the first GPU, its context and an in-order queue
+int gmssl_cl_open_device(cl_context *context, cl_device_id *device, cl_command_queue *queue);
+int gmssl_cl_build_program(cl_context context, cl_device_id device, const char *src, cl_program *program);
+const char *gmssl_cl_error_string(cl_int err);
+
+/*
+ * gmssl_cl_build_program() keeps the program binaries in `dir`, one file per
+ * device, driver version and source, and later builds load the binary with
+ * clCreateProgramWithBinary() instead of compiling the source. A binary the
+ * driver rejects is rebuilt from the source and replaced. The directory must
+ * only be writable by the user, the binaries are loaded without any check.
+ * NULL (the default) disables the cache. Set it before opening any device,
+ * it is not locked against concurrent builds.
+ */
+int gmssl_cl_set_cache_dir(const char *dir);
+
+#define cl_error_print(e) \
+	do { fprintf(stderr, "%s: %d: %s()\n",__FILE__,__LINE__,gmssl_cl_error_string(e)); } while (0)
+
+
 typedef struct {
 	uint32_t rk[32];
 	//size_t workgroup_size;
 	cl_context context;
+	cl_device_id device;
 	cl_command_queue queue;
 	cl_program program;
 	cl_kernel kernel;
 	cl_mem mem_rk;
-	cl_mem mem_io;
+	cl_mem mem_io; // kept by sm4_cl_ctr32_encrypt_blocks() for the next calls
+	size_t mem_io_size;
 } SM4_CL_CTX;
 
 
 int sm4_cl_set_encrypt_key(SM4_CL_CTX *ctx, const uint8_t key[16]);
 int sm4_cl_set_decrypt_key(SM4_CL_CTX *ctx, const uint8_t key[16]);
+// another key on the context, device and program of `share`, with its own queue and kernel
+int sm4_cl_set_encrypt_key_share(SM4_CL_CTX *ctx, const uint8_t key[16], const SM4_CL_CTX *share);
+int sm4_cl_set_decrypt_key_share(SM4_CL_CTX *ctx, const uint8_t key[16], const SM4_CL_CTX *share);
+// any nblocks, blocking
 int sm4_cl_ctr32_encrypt_blocks(SM4_CL_CTX *ctx, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
 void sm4_cl_cleanup(SM4_CL_CTX *ctx);
 
+/*
+ * Pipelined CTR32 of a long stream. The input is cut into chunks of
+ * SM4_CL_STREAM_SLOTS slots, every slot has a pinned host buffer, a device
+ * buffer and its own command queue, so the host-to-device copy, the kernel
+ * and the device-to-host copy of different chunks overlap.
+ *
+ * update() copies the input into the pinned buffers and returns as soon as a
+ * slot is free. The output is passed to `callback` in the stream order when
+ * a chunk is completed, from update(), poll() or finish(). The `out` pointer
+ * is only valid during the callback.
+ */
+#define SM4_CL_STREAM_SLOTS		3
+#define SM4_CL_STREAM_CHUNK_SIZE	(8 * 1024 * 1024)
+
+typedef int (*SM4_CL_STREAM_CALLBACK)(void *cb_arg, const uint8_t *out, size_t outlen);
+
+typedef struct {
+	cl_command_queue queue;
+	cl_mem host_mem; // CL_MEM_ALLOC_HOST_PTR, mapped to host_buf
+	cl_mem dev_mem;
+	uint8_t *host_buf;
+	size_t len;
+	cl_event done;
+} SM4_CL_STREAM_SLOT;
+
+typedef struct {
+	SM4_CL_CTX *ctx;
+	SM4_CL_STREAM_SLOT slots[SM4_CL_STREAM_SLOTS];
+	size_t chunk_size;
+	uint32_t ctr[4]; // counter of the next chunk
+	size_t head; // the oldest submitted slot
+	size_t pending; // submitted slots not delivered
+	size_t fill; // bytes in the slot (head + pending) % SM4_CL_STREAM_SLOTS
+	SM4_CL_STREAM_CALLBACK callback;
+	void *cb_arg;
+} SM4_CL_STREAM;
+
+// `chunk_size` is a multiple of 16, 0 for SM4_CL_STREAM_CHUNK_SIZE
+int sm4_cl_ctr32_stream_init(SM4_CL_STREAM *stream, SM4_CL_CTX *ctx, const uint8_t ctr[16],
+	size_t chunk_size, SM4_CL_STREAM_CALLBACK callback, void *cb_arg);
+int sm4_cl_ctr32_stream_update(SM4_CL_STREAM *stream, const uint8_t *in, size_t inlen);
+// deliver the completed chunks without waiting
+int sm4_cl_ctr32_stream_poll(SM4_CL_STREAM *stream);
+// the last chunk might end with a partial block, `ctr` (can be NULL) is the next counter
+int sm4_cl_ctr32_stream_finish(SM4_CL_STREAM *stream, uint8_t ctr[16]);
+void sm4_cl_ctr32_stream_cleanup(SM4_CL_STREAM *stream);
+
+/*
+ * SM4-XTS and SM4-GCM on all the GPUs and the CPU
+ *
+ * XTS runs one work-item per sector, with the sectors and tweaks of
+ * sm4_xts_encrypt_sectors(). GCM runs the CTR32 kernel and a GHASH kernel,
+ * every GHASH work-item hashes SM4_CL_GHASH_CHUNK_BLOCKS blocks from a zero
+ * state and the host joins the chunks as X = X * H^m + P, with m the blocks
+ * of the chunk, so the tag is the one of sm4_gcm_encrypt().
+ *
+ * sm4_cl_multi_init() opens every GPU of every platform and measures the
+ * throughput of each device and of the CPU on a calibration job. A job is
+ * split in proportion to these rates: the devices take the first parts, the
+ * CPU the last one, all of them run at the same time. The rates are updated
+ * after every job with a weight of SM4_CL_MULTI_EWMA, from the profiling
+ * events of the device queues (transfers included) and the CPU time.
+ * Device parts below SM4_CL_MULTI_MIN_PART_SIZE go to the CPU, so small jobs
+ * do not leave the CPU. Without a GPU everything runs on the CPU.
+ *
+ * An SM4_CL_MULTI is used by one thread at a time.
+ */
+#define SM4_CL_MAX_DEVICES		8
+#define SM4_CL_MAX_PLATFORMS		8
+#define SM4_CL_GHASH_CHUNK_BLOCKS	256
+#define SM4_CL_GHASH_CHUNK_SIZE		(16 * SM4_CL_GHASH_CHUNK_BLOCKS)
+#define SM4_CL_MULTI_MIN_PART_SIZE	(1024 * 1024)
+#define SM4_CL_MULTI_CALIBRATE_SIZE	(4 * 1024 * 1024)
+#define SM4_CL_MULTI_EWMA		0.25
+
+enum {
+	SM4_CL_MULTI_XTS = 0,
+	SM4_CL_MULTI_GCM = 1,
+	SM4_CL_MULTI_OPS = 2,
+};
+
+typedef struct {
+	cl_context context;
+	cl_device_id device;
+	cl_command_queue queue; // in-order, profiling enabled
+	cl_program program;
+	cl_kernel ctr32_kernel;
+	cl_kernel xts_kernel;
+	cl_kernel ghash_kernel;
+	size_t max_alloc; // CL_DEVICE_MAX_MEM_ALLOC_SIZE
+	double rate[SM4_CL_MULTI_OPS]; // bytes per nanosecond
+} SM4_CL_DEVICE;
+
+typedef struct {
+	SM4_CL_DEVICE devices[SM4_CL_MAX_DEVICES];
+	size_t num_devices;
+	int cpu_threads; // of sm4_xts_encrypt_sectors(), GCM runs in the calling thread
+	double cpu_rate[SM4_CL_MULTI_OPS];
+} SM4_CL_MULTI;
+
+int sm4_cl_multi_init(SM4_CL_MULTI *multi, int cpu_threads);
+void sm4_cl_multi_cleanup(SM4_CL_MULTI *multi);
+// `key1` is an encryption key of encrypt_sectors() and a decryption key of decrypt_sectors()
+int sm4_cl_multi_xts_encrypt_sectors(SM4_CL_MULTI *multi, const SM4_KEY *key1, const SM4_KEY *key2,
+	const uint8_t tweak[16], size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out);
+int sm4_cl_multi_xts_decrypt_sectors(SM4_CL_MULTI *multi, const SM4_KEY *key1, const SM4_KEY *key2,
+	const uint8_t tweak[16], size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out);
+int sm4_cl_multi_gcm_encrypt(SM4_CL_MULTI *multi, const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag);
+int sm4_cl_multi_gcm_decrypt(SM4_CL_MULTI *multi, const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	const uint8_t *tag, size_t taglen, uint8_t *out);
+
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_SM4_GCM_STREAM_H
+#define GMSSL_SM4_GCM_STREAM_H
+
+#include <string.h>
+#include <stdint.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm3.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+ * Segmented SM4-GCM container
+ *
+ *	header  = magic "SGCM" || version (1) || 0x000000 || segment_size (uint32)
+ *	          || 0x00000000 || salt (32) || SM3-HMAC (32) of the preceding 48 bytes
+ *	segment = SM4-GCM ciphertext || tag (16)
+ *
+ * The plaintext is cut into segments of `segment_size` bytes, only the last
+ * one may be shorter (or empty). The SM4 key, the HMAC key and a 7-byte nonce
+ * prefix are derived with SM3-HKDF from the user key, the salt and the first
+ * 48 header bytes, so a modified header also changes every segment key.
+ * Segment i is sealed with the nonce prefix || i (uint32) || last (1 byte),
+ * where `last` is 1 for the final segment only (STREAM construction): dropping,
+ * reordering or appending whole segments is detected. Integers are big-endian.
+ *
+ * Segments are independent, so `sm4_gcm_stream_encrypt_segments` and
+ * `sm4_gcm_stream_decrypt_segments` process a run of consecutive segments
+ * starting at `index` on `threads` threads (<= 0 for one per online CPU, at
+ * most SM4_GCM_STREAM_MAX_THREADS), and a reader can decrypt any range of
+ * segments after the header. Every run but the final one holds whole segments,
+ * `is_last` marks the run that ends the stream.
+ */
+#define SM4_GCM_STREAM_VERSION			1
+#define SM4_GCM_STREAM_SALT_SIZE		32
+#define SM4_GCM_STREAM_HEADER_SIZE		(16 + SM4_GCM_STREAM_SALT_SIZE + SM3_HMAC_SIZE)
+#define SM4_GCM_STREAM_TAG_SIZE			16
+#define SM4_GCM_STREAM_NONCE_PREFIX_SIZE	7
+#define SM4_GCM_STREAM_MIN_SEGMENT_SIZE		1024
+#define SM4_GCM_STREAM_MAX_SEGMENT_SIZE		(16 * 1024 * 1024)
+#define SM4_GCM_STREAM_DEFAULT_SEGMENT_SIZE	(64 * 1024)
+#define SM4_GCM_STREAM_MAX_SEGMENTS		((uint64_t)1 << 32)
+#define SM4_GCM_STREAM_MAX_THREADS		64
+
+typedef struct {
+	SM4_KEY sm4_key;
+	uint8_t nonce_prefix[SM4_GCM_STREAM_NONCE_PREFIX_SIZE];
+	size_t segment_size;
+} SM4_GCM_STREAM_CTX;
+
+// a new random salt is written into `header`
+int sm4_gcm_stream_encrypt_init(SM4_GCM_STREAM_CTX *ctx, const uint8_t key[SM4_KEY_SIZE],
+	size_t segment_size, uint8_t header[SM4_GCM_STREAM_HEADER_SIZE]);
+int sm4_gcm_stream_decrypt_init(SM4_GCM_STREAM_CTX *ctx, const uint8_t key[SM4_KEY_SIZE],
+	const uint8_t header[SM4_GCM_STREAM_HEADER_SIZE]);
+
+// `out` has room for `inlen` plus a tag for every started segment (one if `inlen` is 0)
+int sm4_gcm_stream_encrypt_segments(const SM4_GCM_STREAM_CTX *ctx, uint64_t index,
+	const uint8_t *in, size_t inlen, int is_last, uint8_t *out, size_t *outlen, int threads);
+// nothing is left in `out` if any segment fails to verify
+int sm4_gcm_stream_decrypt_segments(const SM4_GCM_STREAM_CTX *ctx, uint64_t index,
+	const uint8_t *in, size_t inlen, int is_last, uint8_t *out, size_t *outlen, int threads);
+
+// plaintext length of a container whose segments (after the header) take `ciphertext_size` bytes
+int sm4_gcm_stream_plaintext_size(size_t segment_size, uint64_t ciphertext_size, uint64_t *plaintext_size);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -20,6 +20,7 @@ extern "C" {
 
 #define SM4_RNG_MAX_RESEED_COUNTER (1<<20)
 #define SM4_RNG_MAX_RESEED_SECONDS 600
+#define SM4_RNG_MAX_GENERATE_SIZE 4096
 
 typedef struct {
 	uint8_t V[16];
@@ -33,6 +34,7 @@ int sm4_rng_init(SM4_RNG *rng, const uint8_t *nonce, size_t nonce_len,
 	const uint8_t *label, size_t label_len);
 int sm4_rng_update(SM4_RNG *rng, const uint8_t seed[32]);
 int sm4_rng_reseed(SM4_RNG *rng, const uint8_t *addin, size_t addin_len);
+// outlen <= SM4_RNG_MAX_GENERATE_SIZE, the output is the keystream of sm4_ctr32_encrypt_blocks written into `out`
 int sm4_rng_generate(SM4_RNG *rng, const uint8_t *addin, size_t addin_len,
 	uint8_t *out, size_t outlen);
 
@@ -67,16 +67,49 @@ SM9SignPrivateKey ::= SEQUENCE {
 typedef struct {
 	SM9_Z256_TWIST_POINT Ppubs; // Ppubs = ks * P2
 	sm9_z256_t ks;
+
+	// comb table of g = e(P1, Ppubs), valid while g_Ppubs == Ppubs
+	SM9_Z256_TWIST_POINT g_Ppubs;
+	sm9_z256_fp12_t g_table[SM9_Z256_FP12_COMB_TABLE_SIZE];
+
+	// not owned, valid while id_cache_Ppubs == Ppubs, see sm9_id_cache_new
+	struct SM9_ID_CACHE_st *id_cache;
+	SM9_Z256_TWIST_POINT id_cache_Ppubs;
 } SM9_SIGN_MASTER_KEY;
 
 typedef struct {
 	SM9_Z256_TWIST_POINT Ppubs;
 	SM9_Z256_POINT ds;
+
+	SM9_Z256_TWIST_POINT g_Ppubs;
+	sm9_z256_fp12_t g_table[SM9_Z256_FP12_COMB_TABLE_SIZE];
 } SM9_SIGN_KEY;
 
+/*
+ * The pairing g = e(P1, Ppubs) only depends on the master public key. It is
+ * cached with a comb table of g by generate, extract and the from_der/pem
+ * functions, so sign and verify skip one pairing and use a fixed-base g^r.
+ * Call the `pre_compute` functions again if Ppubs is set by other means,
+ * otherwise g is computed on every operation.
+ */
+int sm9_sign_master_key_pre_compute(SM9_SIGN_MASTER_KEY *mpk);
+int sm9_sign_key_pre_compute(SM9_SIGN_KEY *key);
+
 int sm9_sign_master_key_generate(SM9_SIGN_MASTER_KEY *master);
 int sm9_sign_master_key_extract_key(SM9_SIGN_MASTER_KEY *master, const char *id, size_t idlen, SM9_SIGN_KEY *key);
 
+/*
+ * Extract the keys of ids[0..num-1] for a KGC. The modular inversions of every
+ * SM9_EXTRACT_BATCH_SIZE identities are shared with Montgomery's trick and the
+ * identities are split across `threads`, <= 0 for one per online CPU, at most
+ * SM9_EXTRACT_MAX_THREADS, 1 to run in the calling thread only. Returns -1 if
+ * any identity fails, as sm9_sign_master_key_extract_key() would.
+ */
+#define SM9_EXTRACT_BATCH_SIZE	64
+#define SM9_EXTRACT_MAX_THREADS	64
+int sm9_sign_master_key_extract_keys(SM9_SIGN_MASTER_KEY *master,
+	const char *const *ids, const size_t *idlens, size_t num, SM9_SIGN_KEY *keys, int threads);
+
 // algorthm,parameters = sm9,sm9sign
 #define SM9_SIGN_MASTER_KEY_MAX_SIZE 171
 int sm9_sign_master_key_to_der(const SM9_SIGN_MASTER_KEY *msk, uint8_t **out, size_t *outlen);
@@ -117,6 +150,9 @@ typedef struct {
 
 int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *sig);
 int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen, const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig);
+// sigs[i] by ids[i] of the message hashed into sm3_ctxs[i], same return and results as sm2_do_verify_batch
+int sm9_do_verify_batch(const SM9_SIGN_MASTER_KEY *mpk, const char *const *ids, const size_t *idlens,
+	const SM3_CTX *sm3_ctxs, const SM9_SIGNATURE *sigs, size_t count, int *results);
 
 #define SM9_SIGNATURE_SIZE 104
 int sm9_signature_to_der(const SM9_SIGNATURE *sig, uint8_t **out, size_t *outlen);
@@ -153,15 +189,34 @@ SM9EncPrivateKey ::= SEQUENCE {
 typedef struct {
 	SM9_Z256_POINT Ppube; // Ppube = ke * P1
 	sm9_z256_t ke;
+
+	// comb table of g = e(Ppube, P2), valid while g_Ppube == Ppube
+	SM9_Z256_POINT g_Ppube;
+	sm9_z256_fp12_t g_table[SM9_Z256_FP12_COMB_TABLE_SIZE];
+
+	// not owned, valid while id_cache_Ppube == Ppube, see sm9_id_cache_new
+	struct SM9_ID_CACHE_st *id_cache;
+	SM9_Z256_POINT id_cache_Ppube;
 } SM9_ENC_MASTER_KEY;
 
 typedef struct {
 	SM9_Z256_POINT Ppube;
 	SM9_Z256_TWIST_POINT de;
+
+	// Miller loop lines of de for decryption and key exchange, valid while prepared_de == de
+	SM9_Z256_TWIST_POINT prepared_de;
+	SM9_Z256_PREPARED_TWIST_POINT de_lines;
 } SM9_ENC_KEY;
 
+// cache g = e(Ppube, P2) for encryption and key exchange, see sm9_sign_master_key_pre_compute
+int sm9_enc_master_key_pre_compute(SM9_ENC_MASTER_KEY *mpk);
+int sm9_enc_key_pre_compute(SM9_ENC_KEY *key);
+
 int sm9_enc_master_key_generate(SM9_ENC_MASTER_KEY *master);
 int sm9_enc_master_key_extract_key(SM9_ENC_MASTER_KEY *master, const char *id, size_t idlen, SM9_ENC_KEY *key);
+// see sm9_sign_master_key_extract_keys
+int sm9_enc_master_key_extract_keys(SM9_ENC_MASTER_KEY *master,
+	const char *const *ids, const size_t *idlens, size_t num, SM9_ENC_KEY *keys, int threads);
 
 // algorithm,parameters = sm9,sm9encrypt
 #define SM9_ENC_MASTER_KEY_MAX_SIZE 105
@@ -210,6 +265,66 @@ int sm9_do_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 int sm9_do_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen,
 	const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len, const uint8_t c3[SM3_HMAC_SIZE], uint8_t *out);
 
+/*
+ * The public point of an identity, Q = H1(ID || hid, N) * P + Ppub, depends on
+ * the master public key and the identity only. SM9_ID_PUBLIC keeps it in affine
+ * form for the verifications of signatures from, and the encryptions to, an
+ * identity seen before. With `pre_compute` the Miller loop lines of Qs, or the
+ * window table of Qe, are also kept, about 15KB or 1.5KB more.
+ *
+ * The init functions set an object of the sign (SM9_HID_SIGN) or encryption
+ * (SM9_HID_ENC) kind, it is valid with the master public key it is created by.
+ */
+typedef struct {
+	uint8_t hid;
+	int pre_computed;
+
+	// SM9_HID_SIGN, Qs = h1 * P2 + Ppubs in E'(F_p^2)
+	SM9_Z256_TWIST_POINT Ppubs;
+	SM9_Z256_TWIST_POINT Qs;
+	SM9_Z256_PREPARED_TWIST_POINT Qs_lines;
+
+	// SM9_HID_ENC, Qe = h1 * P1 + Ppube in E(F_p)
+	SM9_Z256_POINT Ppube;
+	SM9_Z256_POINT Qe;
+	SM9_Z256_POINT Qe_table[16];
+} SM9_ID_PUBLIC;
+
+int sm9_sign_id_public_init(SM9_ID_PUBLIC *pub, const SM9_SIGN_MASTER_KEY *mpk,
+	const char *id, size_t idlen, int pre_compute);
+int sm9_enc_id_public_init(SM9_ID_PUBLIC *pub, const SM9_ENC_MASTER_KEY *mpk,
+	const char *id, size_t idlen, int pre_compute);
+int sm9_do_verify_id_public(const SM9_SIGN_MASTER_KEY *mpk, const SM9_ID_PUBLIC *pub,
+	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig);
+int sm9_kem_encrypt_id_public(const SM9_ENC_MASTER_KEY *mpk, const SM9_ID_PUBLIC *pub,
+	const char *id, size_t idlen, size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C);
+
+/*
+ * LRU cache of SM9_ID_PUBLIC keyed by (hid, ID), sharded by the hash of the key
+ * like the TLS session cache. The get functions return the cached object or
+ * create and add it, identities longer than SM9_ID_CACHE_MAX_ID_SIZE are not
+ * added. An entry made with another master public key is replaced.
+ *
+ * Once set to a master public key with the set_id_cache functions, the cache
+ * is used by sm9_do_verify, sm9_kem_encrypt and sm9_do_encrypt. Set it after
+ * Ppubs/Ppube, and free the cache after the last use of the master key.
+ */
+#define SM9_ID_CACHE_SHARDS		16
+#define SM9_ID_CACHE_MAX_ID_SIZE	256
+
+typedef struct SM9_ID_CACHE_st SM9_ID_CACHE;
+
+SM9_ID_CACHE *sm9_id_cache_new(size_t max_entries, int pre_compute);
+void sm9_id_cache_free(SM9_ID_CACHE *cache);
+int sm9_sign_id_cache_get(SM9_ID_CACHE *cache, const SM9_SIGN_MASTER_KEY *mpk,
+	const char *id, size_t idlen, SM9_ID_PUBLIC *pub);
+int sm9_enc_id_cache_get(SM9_ID_CACHE *cache, const SM9_ENC_MASTER_KEY *mpk,
+	const char *id, size_t idlen, SM9_ID_PUBLIC *pub);
+size_t sm9_id_cache_count(SM9_ID_CACHE *cache);
+
+int sm9_sign_master_key_set_id_cache(SM9_SIGN_MASTER_KEY *mpk, SM9_ID_CACHE *cache); // NULL to unset
+int sm9_enc_master_key_set_id_cache(SM9_ENC_MASTER_KEY *mpk, SM9_ID_CACHE *cache);
+
 #define SM9_MAX_PLAINTEXT_SIZE 255
 #define SM9_MAX_CIPHERTEXT_SIZE 367 // calculated in test_sm9_ciphertext()
 int sm9_ciphertext_to_der(const SM9_Z256_POINT *C1, const uint8_t *c2, size_t c2len,
@@ -58,7 +58,8 @@ void sm9_z256_modp_from_mont(sm9_z256_t r, const sm9_z256_t a);
 void sm9_z256_modp_mont_mul(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
 void sm9_z256_modp_mont_sqr(sm9_z256_t r, const sm9_z256_t a);
 void sm9_z256_modp_mont_pow(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t e);
-void sm9_z256_modp_mont_inv(sm9_z256_t r, const sm9_z256_t a);
+void sm9_z256_modp_mont_inv(sm9_z256_t r, const sm9_z256_t a); // safegcd if __int128 is supported
+void sm9_z256_modp_mont_inv_exp(sm9_z256_t r, const sm9_z256_t a); // a^(p - 2)
 
 const uint64_t *sm9_z256_order(void);
 
@@ -66,7 +67,8 @@ void sm9_z256_modn_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
 void sm9_z256_modn_sub(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
 void sm9_z256_modn_mul(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
 void sm9_z256_modn_pow(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t e);
-void sm9_z256_modn_inv(sm9_z256_t r, const sm9_z256_t a);
+void sm9_z256_modn_inv(sm9_z256_t r, const sm9_z256_t a); // safegcd if __int128 is supported
+void sm9_z256_modn_inv_exp(sm9_z256_t r, const sm9_z256_t a); // a^(n - 2)
 void sm9_z256_modn_from_hash(sm9_z256_t h, const uint8_t Ha[40]);
 
 
@@ -153,6 +155,15 @@ void sm9_z256_fp12_mul(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z25
 void sm9_z256_fp12_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
 void sm9_z256_fp12_inv(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
 void sm9_z256_fp12_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z256_t k);
+// only for elements of the cyclotomic subgroup such as pairing values
+void sm9_z256_fp12_cyclotomic_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a);
+void sm9_z256_fp12_cyclotomic_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z256_t k);
+
+// fixed-base 4-teeth comb, T[i] = prod g^(2^(64*j)) for each bit j set in i
+#define SM9_Z256_FP12_COMB_TABLE_SIZE 16
+void sm9_z256_fp12_pow_comb_pre_compute(sm9_z256_fp12_t T[16], const sm9_z256_fp12_t g);
+void sm9_z256_fp12_pow_comb(sm9_z256_fp12_t r, const sm9_z256_fp12_t T[16], const sm9_z256_t k);
+void sm9_z256_fp12_cyclotomic_pow_comb(sm9_z256_fp12_t r, const sm9_z256_fp12_t T[16], const sm9_z256_t k);
 void sm9_z256_fp12_frobenius(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
 void sm9_z256_fp12_frobenius2(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
 void sm9_z256_fp12_frobenius3(sm9_z256_fp12_t r, const sm9_z256_fp12_t x);
@@ -180,6 +191,8 @@ void sm9_z256_point_neg(SM9_Z256_POINT *R, const SM9_Z256_POINT *P);
 void sm9_z256_point_add(SM9_Z256_POINT *R, const SM9_Z256_POINT *P, const SM9_Z256_POINT *Q);
 void sm9_z256_point_sub(SM9_Z256_POINT *R, const SM9_Z256_POINT *P, const SM9_Z256_POINT *Q);
 void sm9_z256_point_mul(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_POINT *P);
+void sm9_z256_point_mul_pre_compute(const SM9_Z256_POINT *P, SM9_Z256_POINT T[16]);
+void sm9_z256_point_mul_ex(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_POINT T[16]);
 void sm9_z256_point_mul_generator(SM9_Z256_POINT *R, const sm9_z256_t k);
 int  sm9_z256_point_print(FILE *fp, int fmt, int ind, const char *label, const SM9_Z256_POINT *P);
 int  sm9_z256_point_to_uncompressed_octets(const SM9_Z256_POINT *P, uint8_t octets[65]);
@@ -202,6 +215,11 @@ typedef struct {
 	sm9_z256_fp2_t Z;
 } SM9_Z256_TWIST_POINT;
 
+typedef struct {
+	sm9_z256_fp2_t X;
+	sm9_z256_fp2_t Y;
+} SM9_Z256_TWIST_AFFINE_POINT;
+
 const SM9_Z256_TWIST_POINT *sm9_z256_twist_generator(void);
 
 int sm9_z256_twist_point_to_uncompressed_octets(const SM9_Z256_TWIST_POINT *P, uint8_t octets[129]);
@@ -219,6 +237,8 @@ void sm9_z256_twist_point_dbl(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q);
 void sm9_z256_twist_point_sub(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q);
 void sm9_z256_twist_point_add_full(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q);
+void sm9_z256_twist_point_add_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_AFFINE_POINT *Q);
+void sm9_z256_twist_point_sub_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_AFFINE_POINT *Q);
 void sm9_z256_twist_point_mul(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k, const SM9_Z256_TWIST_POINT *P);
 void sm9_z256_twist_point_mul_generator(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k);
 
@@ -240,6 +260,26 @@ void sm9_z256_final_exponent_hard_part(sm9_z256_fp12_t r, const sm9_z256_fp12_t
 void sm9_z256_final_exponent(sm9_z256_fp12_t r, const sm9_z256_fp12_t f);
 void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P);
 
+// pairing = final exponentiation of the Miller loop, the batch shares the inversions of the easy part
+#define SM9_Z256_FINAL_EXPONENT_BATCH 16
+void sm9_z256_miller_loop(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P);
+void sm9_z256_final_exponent_batch(sm9_z256_fp12_t *r, const sm9_z256_fp12_t *f, size_t n);
+
+// product of n pairings sharing the Miller loop squarings and the final exponentiation
+#define SM9_Z256_PAIRING_MULTI_MAX 4
+void sm9_z256_pairing_multi(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P, size_t n);
+
+// the line coefficients of the Miller loop of a fixed Q, for the pairings of a long-lived key
+#define SM9_Z256_PAIRING_LINES	77 // 65 tangents, 10 additions and the pi1, -pi2 lines
+
+typedef struct {
+	sm9_z256_fp2_t lines[SM9_Z256_PAIRING_LINES][3];
+} SM9_Z256_PREPARED_TWIST_POINT;
+
+void sm9_z256_twist_point_prepare(SM9_Z256_PREPARED_TWIST_POINT *prep, const SM9_Z256_TWIST_POINT *Q);
+void sm9_z256_pairing_prepared(sm9_z256_fp12_t r, const SM9_Z256_PREPARED_TWIST_POINT *Q, const SM9_Z256_POINT *P);
+void sm9_z256_miller_loop_prepared(sm9_z256_fp12_t r, const SM9_Z256_PREPARED_TWIST_POINT *Q, const SM9_Z256_POINT *P);
+
 
 #ifdef  __cplusplus
 }
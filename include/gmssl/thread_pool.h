@@ -0,0 +1,65 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_THREAD_POOL_H
+#define GMSSL_THREAD_POOL_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+ * Library thread pool
+ *
+ * All the parallel functions of the library (batch verification, key
+ * generation, XMSS leaves, SM9 extraction, CMS recipients, GCM and XTS
+ * streams, tree hashing, multi-scalar multiplication) run their work items
+ * on one process wide pool instead of creating threads of their own, so the
+ * library never uses more threads than the pool has, however many of these
+ * calls run at once.
+ *
+ * gmssl_thread_pool_run() puts `n` items on the pool and the calling thread
+ * works on them too. Idle workers take items from the newest call with items
+ * left, so the items of a call made from inside an item are done first, and
+ * a call never waits for an item no thread is working on. The `threads`
+ * argument of the parallel functions is the number of items they split the
+ * work into, <= 0 is gmssl_thread_pool_size().
+ *
+ * The pool starts at the first call with one thread per online CPU, the
+ * calling thread counted. gmssl_thread_pool_init() sets the number of
+ * threads and the CPUs they are pinned to, worker i to cpus[i % cpus_cnt],
+ * which also sets their NUMA node (see numa.h). An application with an
+ * executor of its own can take the workers' place with
+ * gmssl_thread_pool_set_executor(): the helpers of a call are submitted to
+ * `executor`, `threads` of them run at most, and an item not taken by a
+ * helper is done by the calling thread. The configuration must not change
+ * while calls are running.
+ */
+#define GMSSL_THREAD_POOL_MAX_THREADS	256
+
+typedef void (*GMSSL_TASK)(void *arg);
+// return 1 if task(arg) will be run by some thread, which may be later
+typedef int (*GMSSL_EXECUTOR)(void *executor_arg, GMSSL_TASK task, void *arg);
+
+int gmssl_thread_pool_init(int threads, const int *cpus, size_t cpus_cnt);
+int gmssl_thread_pool_set_executor(GMSSL_EXECUTOR executor, void *executor_arg, int threads);
+void gmssl_thread_pool_cleanup(void);
+int gmssl_thread_pool_size(void);
+
+// task(args + arg_size * i) for i in [0, n), return when all are done
+int gmssl_thread_pool_run(GMSSL_TASK task, void *args, size_t arg_size, size_t n);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -13,13 +13,17 @@
 #define GMSSL_TLS_H
 
 
+#include <time.h>
+#include <errno.h>
 #include <stdint.h>
 #include <gmssl/sm2.h>
 #include <gmssl/sm3.h>
 #include <gmssl/sm4.h>
 #include <gmssl/digest.h>
 #include <gmssl/block_cipher.h>
+#include <gmssl/x509.h>
 #include <gmssl/socket.h>
+#include <gmssl/arena.h>
 
 
 #ifdef __cplusplus
@@ -217,7 +221,7 @@ typedef enum {
 	TLS_extension_early_data		= 42,
 	TLS_extension_supported_versions	= 43,
 	TLS_extension_cookie			= 44,
-	TLS_extension_psk_key_exchange_modes	= 46,
+	TLS_extension_psk_key_exchange_modes	= 45,
 	TLS_extension_certificate_authorities	= 47,
 	TLS_extension_oid_filters		= 48,
 	TLS_extension_post_handshake_auth	= 49,
@@ -341,6 +345,8 @@ typedef enum {
 	TLS_alert_user_canceled			= 90,
 	TLS_alert_no_renegotiation		= 100,
 	TLS_alert_unsupported_extension		= 110,
+	TLS_alert_unrecognized_name		= 112,
+	TLS_alert_bad_certificate_status_response = 113,
 	TLS_alert_unsupported_site2site		= 200,
 	TLS_alert_no_area			= 201,
 	TLS_alert_unsupported_areatype		= 202,
@@ -360,7 +366,14 @@ int tls13_hkdf_extract(const DIGEST *digest, const uint8_t salt[32], const uint8
 int tls13_hkdf_expand_label(const DIGEST *digest, const uint8_t secret[32],
 	const char *label, const uint8_t *context, size_t context_len,
 	size_t outlen, uint8_t *out);
+int tls13_hkdf_expand_label_with_key(const SM3_HMAC_KEY *key,
+	const char *label, const uint8_t *context, size_t context_len,
+	size_t outlen, uint8_t *out);
+int tls13_hkdf_expand_key_iv(const DIGEST *digest, const uint8_t secret[32],
+	size_t key_len, uint8_t *key, uint8_t iv[12]);
+int tls13_transcript_hash(const DIGEST_CTX *dgst_ctx, uint8_t dgst[DIGEST_MAX_SIZE], size_t *dgstlen);
 int tls13_derive_secret(const uint8_t secret[32], const char *label, const DIGEST_CTX *dgst_ctx, uint8_t out[32]);
+int tls13_cipher_suite_get(int cipher_suite, const DIGEST **digest, const BLOCK_CIPHER **cipher);
 
 int tls_cbc_encrypt(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *enc_key,
 	const uint8_t seq_num[8], const uint8_t header[5],
@@ -375,6 +388,20 @@ int tls_record_decrypt(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
 	const uint8_t seq_num[8], const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t *outlen);
 
+/*
+ * In-place records, the plaintext is at `record + TLS_CBC_HEADROOM` with
+ * TLS_CBC_TAILROOM free bytes after it. The header and the explicit IV are
+ * written in front of it, the MAC and the padding behind it.
+ */
+#define TLS_CBC_HEADROOM	(TLS_RECORD_HEADER_SIZE + 16) // header, IV
+#define TLS_CBC_TAILROOM	(32 + 16) // HMAC-SM3, padding
+
+int tls_record_encrypt_in_place(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
+	const uint8_t seq_num[8], uint8_t *record, size_t datalen, size_t *recordlen);
+int tls_record_decrypt_in_place(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
+	const uint8_t seq_num[8], uint8_t *record, size_t recordlen,
+	uint8_t **data, size_t *datalen);
+
 int tls_seq_num_incr(uint8_t seq_num[8]);
 int tls_random_generate(uint8_t random[32]);
 int tls_random_print(FILE *fp, const uint8_t random[32], int format, int indent);
@@ -507,8 +534,71 @@ int tls13_server_key_share_ext_to_bytes(const SM2_Z256_POINT *point, uint8_t **o
 int tls13_process_client_key_share(const uint8_t *ext_data, size_t ext_datalen,
 	const SM2_KEY *server_ecdhe_key, SM2_Z256_POINT *client_ecdhe_public,
 	uint8_t **out, size_t *outlen);
+// return 1 if the key_share of ClientHello has an entry of `group`, 0 if not
+int tls13_client_key_share_has_group(const uint8_t *ext_data, size_t ext_datalen, int group);
+int tls13_hello_retry_request_key_share_ext_to_bytes(int group, uint8_t **out, size_t *outlen);
+int tls13_process_hello_retry_request_key_share(const uint8_t *ext_data, size_t ext_datalen, int *group);
 int tls13_process_server_key_share(const uint8_t *ext_data, size_t ext_datalen, SM2_Z256_POINT *point);
 
+typedef enum {
+	TLS_psk_ke = 0,
+	TLS_psk_dhe_ke = 1,
+} TLS_PSK_KEY_EXCHANGE_MODE;
+
+int tls13_psk_key_exchange_modes_ext_to_bytes(const int *modes, size_t modes_cnt, uint8_t **out, size_t *outlen);
+int tls13_process_client_psk_key_exchange_modes(const uint8_t *ext_data, size_t ext_datalen, int mode);
+int tls13_client_pre_shared_key_ext_to_bytes(const uint8_t *identity, size_t identitylen,
+	uint32_t obfuscated_ticket_age, const uint8_t *binder, size_t binderlen,
+	uint8_t **out, size_t *outlen);
+int tls13_process_client_pre_shared_key(const uint8_t *ext_data, size_t ext_datalen,
+	const uint8_t **identity, size_t *identitylen, uint32_t *obfuscated_ticket_age,
+	const uint8_t **binder, size_t *binderlen, size_t *binders_size);
+int tls13_server_pre_shared_key_ext_to_bytes(int selected_identity, uint8_t **out, size_t *outlen);
+int tls13_process_server_pre_shared_key(const uint8_t *ext_data, size_t ext_datalen, int *selected_identity);
+int tls13_early_data_ext_to_bytes(const uint32_t *max_early_data_size, uint8_t **out, size_t *outlen);
+int tls13_process_early_data(const uint8_t *ext_data, size_t ext_datalen, uint32_t *max_early_data_size);
+#define TLS13_MAX_COOKIE_SIZE	256 // kept by the client, larger cookies are refused
+int tls13_cookie_ext_to_bytes(const uint8_t *cookie, size_t cookielen, uint8_t **out, size_t *outlen);
+int tls13_process_cookie(const uint8_t *ext_data, size_t ext_datalen, const uint8_t **cookie, size_t *cookielen);
+
+enum {
+	TLS_certificate_status_ocsp = 1,
+};
+
+int tls_status_request_ext_to_bytes(uint8_t **out, size_t *outlen); // client, empty server ext is a NULL ext_data
+int tls_process_status_request(const uint8_t *ext_data, size_t ext_datalen); // return 1 for OCSP, 0 otherwise
+int tls_certificate_status_to_bytes(const uint8_t *ocsp_resp, size_t ocsp_resp_len, uint8_t **out, size_t *outlen);
+int tls_certificate_status_from_bytes(const uint8_t **ocsp_resp, size_t *ocsp_resp_len, const uint8_t **in, size_t *inlen);
+int tls13_certificate_status_ext_to_bytes(const uint8_t *ocsp_resp, size_t ocsp_resp_len, uint8_t **out, size_t *outlen);
+
+int tls13_compress_certificate_ext_to_bytes(const int *algors, size_t algors_cnt, uint8_t **out, size_t *outlen);
+// the first of `algors` offered by the client, 0 if none
+int tls13_process_compress_certificate(const uint8_t *ext_data, size_t ext_datalen,
+	const int *algors, size_t algors_cnt, int *algor);
+
+enum {
+	TLS_server_name_host_name = 0,
+};
+
+#define TLS_MAX_SERVER_NAME_SIZE	255
+
+int tls_server_name_ext_to_bytes(const char *host, uint8_t **out, size_t *outlen); // NULL `host` for the server
+int tls_process_server_name(const uint8_t *ext_data, size_t ext_datalen, char host[TLS_MAX_SERVER_NAME_SIZE + 1]);
+
+enum {
+	TLS_max_fragment_length_512	= 1,
+	TLS_max_fragment_length_1024	= 2,
+	TLS_max_fragment_length_2048	= 3,
+	TLS_max_fragment_length_4096	= 4,
+};
+
+#define TLS_MIN_RECORD_SIZE_LIMIT	64
+
+int tls_max_fragment_length_ext_to_bytes(int code, uint8_t **out, size_t *outlen);
+int tls_process_max_fragment_length(const uint8_t *ext_data, size_t ext_datalen, int *code);
+int tls_record_size_limit_ext_to_bytes(uint16_t limit, uint8_t **out, size_t *outlen);
+int tls_process_record_size_limit(const uint8_t *ext_data, size_t ext_datalen, uint16_t *limit);
+
 
 int tls13_certificate_authorities_ext_to_bytes(const uint8_t *ca_names, size_t ca_names_len,
 	uint8_t **out, size_t *outlen);
@@ -526,6 +616,13 @@ int tls_record_set_handshake_certificate(uint8_t *record, size_t *recordlen,
 // a standalone cert-chain parsing function should be given			
 int tls_record_get_handshake_certificate(const uint8_t *record, uint8_t *certs, size_t *certslen);
 
+// CertificateStatus
+int tls_record_set_handshake_certificate_status(uint8_t *record, size_t *recordlen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len);
+int tls_record_get_handshake_certificate_status(const uint8_t *record,
+	const uint8_t **ocsp_resp, size_t *ocsp_resp_len);
+int tls_certificate_status_print(FILE *fp, const uint8_t *data, size_t datalen, int format, int indent);
+
 // ServerKeyExchange
 int tls_server_key_exchange_print(FILE *fp, const uint8_t *ske, size_t skelen, int format, int indent);
 
@@ -671,68 +768,566 @@ enum {
 
 #define TLS_MAX_CIPHER_SUITES_COUNT	64
 
+/*
+ * TLS 1.3 session tickets are sealed by the server with SM4-GCM under a
+ * ticket key of key_name[16] || sm4_key[16]. Servers behind one address
+ * share the key, a replaced key name makes old tickets fall back to a full
+ * handshake.
+ */
+#define TLS13_SESSION_TICKET_KEY_SIZE	32
+#define TLS13_SESSION_TICKET_LIFETIME	7200 // seconds
+#define TLS13_SESSION_TICKET_SIZE	(16 + 12 + 42 + 16)
+#define TLS13_MAX_SESSION_TICKET_SIZE	256
+
+// resumption state, a TLS 1.3 ticket or a TLCP/TLS 1.2 session ID
+typedef struct {
+	int protocol;
+	int cipher_suite;
+	uint8_t session_id[32]; // tlcp, tls12
+	size_t session_id_len;
+	uint8_t master_secret[48]; // tlcp, tls12
+	uint8_t psk[32]; // tls13
+	uint8_t ticket[TLS13_MAX_SESSION_TICKET_SIZE];
+	size_t ticketlen;
+	uint32_t ticket_lifetime;
+	uint32_t ticket_age_add;
+	uint32_t max_early_data_size; // tls13, 0 if the ticket does not allow 0-RTT
+	time_t time; // when the session was established
+} TLS_SESSION;
+
+/*
+ * Server side cache of TLCP and TLS 1.2 sessions, looked up by the session
+ * ID of ClientHello. Entries are spread over TLS_SESSION_CACHE_SHARDS shards,
+ * each with its own lock and a bounded LRU list, and expire `timeout`
+ * seconds after the full handshake. An optional external store, e.g. shared
+ * by the servers behind one address, is consulted on a local miss.
+ */
+#define TLS_SESSION_CACHE_SHARDS	16
+#define TLS_SESSION_CACHE_TIMEOUT	7200 // seconds
+
+typedef struct {
+	int (*get)(void *arg, const uint8_t *session_id, size_t session_id_len, TLS_SESSION *session); // 1 found, 0 not found
+	int (*put)(void *arg, const TLS_SESSION *session);
+	int (*remove)(void *arg, const uint8_t *session_id, size_t session_id_len);
+	void *arg;
+} TLS_SESSION_STORE;
+
+typedef struct TLS_SESSION_CACHE_st TLS_SESSION_CACHE;
+
+TLS_SESSION_CACHE *tls_session_cache_new(size_t max_entries, time_t timeout);
+void tls_session_cache_free(TLS_SESSION_CACHE *cache);
+int tls_session_cache_set_store(TLS_SESSION_CACHE *cache, const TLS_SESSION_STORE *store);
+int tls_session_cache_add(TLS_SESSION_CACHE *cache, const TLS_SESSION *session);
+int tls_session_cache_get(TLS_SESSION_CACHE *cache, const uint8_t *session_id, size_t session_id_len,
+	TLS_SESSION *session); // return 0 if not found or expired
+int tls_session_cache_remove(TLS_SESSION_CACHE *cache, const uint8_t *session_id, size_t session_id_len);
+size_t tls_session_cache_count(TLS_SESSION_CACHE *cache);
+
+/*
+ * TLS 1.3 0-RTT. A server with a max_early_data_size announces it in its
+ * session tickets and accepts early data of a resumed ClientHello when the
+ * ticket age reported by the client is within TLS13_EARLY_DATA_AGE_WINDOW
+ * milliseconds of the age seen by the server, and the PSK binder of the
+ * ClientHello is not in the replay cache. Otherwise the early data is
+ * skipped and the handshake goes on without it, the client has to send it
+ * again after the handshake.
+ *
+ * The replay cache is a pair of bloom filters sized for `max_entries`
+ * ClientHellos, the older one is dropped every TLS13_EARLY_DATA_REPLAY_WINDOW
+ * seconds, a binder is remembered as long as its ticket age can pass the
+ * window check. A false positive or a full filter only costs a round trip.
+ * If the clock goes back the filters are kept and every ClientHello is
+ * refused for a window.
+ */
+#define TLS13_MAX_EARLY_DATA_SIZE	(4 * TLS_MAX_PLAINTEXT_SIZE)
+#define TLS13_EARLY_DATA_AGE_WINDOW	10000 // milliseconds
+#define TLS13_EARLY_DATA_REPLAY_WINDOW	(2 * TLS13_EARLY_DATA_AGE_WINDOW / 1000 + 2) // seconds
+
+typedef struct TLS_REPLAY_CACHE_st TLS_REPLAY_CACHE;
+
+TLS_REPLAY_CACHE *tls_replay_cache_new(size_t max_entries);
+void tls_replay_cache_free(TLS_REPLAY_CACHE *cache);
+int tls_replay_cache_add(TLS_REPLAY_CACHE *cache, const uint8_t *id, size_t idlen); // 1 if new, 0 if (maybe) seen or full
+int tls_replay_cache_add_at(TLS_REPLAY_CACHE *cache, const uint8_t *id, size_t idlen, time_t now);
+
+/*
+ * OCSP stapling (status_request) of TLS 1.3 and TLCP. A server with a
+ * stapler sends the OCSP response of its certificate to a client asking for
+ * it, in the first CertificateEntry of TLS 1.3 or a CertificateStatus
+ * message of TLCP. The stapler keeps the last valid response and fetches a
+ * new one on a background thread once the last quarter of its validity has
+ * begun, so no handshake waits for the responder. A failed fetch is tried
+ * again after TLS_OCSP_RETRY_SECONDS, an expired response is not sent.
+ * `fetch` defaults to the HTTP GET of x509_ocsp_response_new_from_cert().
+ *
+ * A client with stapling enabled verifies the stapled response with the
+ * issuer of the server certificate from the server chain or the CA
+ * certificates, a revoked certificate fails the handshake with a
+ * certificate_revoked alert. TLS_ocsp_stapling_require also fails the
+ * handshake without a good response.
+ */
+#define TLS_OCSP_MAX_RESPONSE_SIZE	4096
+#define TLS_OCSP_RETRY_SECONDS		60
+#define TLS_OCSP_DEFAULT_TTL		3600 // seconds a response without nextUpdate is used
+
+typedef int (*TLS_OCSP_FETCH)(void *arg, const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, uint8_t **resp, size_t *resplen); // *resp is malloc-ed
+
+typedef struct TLS_OCSP_STAPLER_st TLS_OCSP_STAPLER;
+
+TLS_OCSP_STAPLER *tls_ocsp_stapler_new(const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, TLS_OCSP_FETCH fetch, void *fetch_arg);
+void tls_ocsp_stapler_free(TLS_OCSP_STAPLER *stapler);
+int tls_ocsp_stapler_set_response(TLS_OCSP_STAPLER *stapler, const uint8_t *resp, size_t resplen);
+int tls_ocsp_stapler_refresh(TLS_OCSP_STAPLER *stapler); // fetch in the calling thread
+int tls_ocsp_stapler_get(TLS_OCSP_STAPLER *stapler, uint8_t *resp, size_t *resplen, size_t maxlen); // return 0 if none
+
+enum {
+	TLS_ocsp_stapling_off = 0,
+	TLS_ocsp_stapling_request,
+	TLS_ocsp_stapling_require,
+};
+
+/*
+ * TLS 1.3 certificate compression (RFC 8879). The client offers its
+ * algorithms in compress_certificate, the server takes the first of its own
+ * list offered by the client and sends a CompressedCertificate in place of
+ * the Certificate, unless the compressed message is not smaller. The server
+ * compresses its chain once in tls_ctx_set_certificate_compression(), a chain
+ * with a stapled OCSP response is compressed in the handshake.
+ *
+ * zlib and brotli are the libraries of the system (ENABLE_TLS_CERT_COMPRESSION).
+ * TLS_cert_compression_zlib_sm is zlib with a preset dictionary of the DER
+ * fragments of SM2 certificates and frequent words of Chinese names, under a
+ * private use codepoint understood by GmSSL peers only.
+ */
+enum {
+	TLS_cert_compression_zlib	= 1,
+	TLS_cert_compression_brotli	= 2,
+	TLS_cert_compression_zstd	= 3,
+	TLS_cert_compression_zlib_sm	= 0xff01,
+};
+
+#define TLS_MAX_CERT_COMPRESSION_ALGORS	4
+#define TLS_MAX_CERTIFICATE_MESSAGE_SIZE	(1 << 16) // uncompressed_length accepted by the client
+
+const char *tls_cert_compression_name(int algor);
+int tls_cert_compression_supported(int algor);
+int tls_cert_compress(int algor, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, size_t maxlen); // 0 if not fit
+int tls_cert_decompress(int algor, const uint8_t *in, size_t inlen, uint8_t *out, size_t outlen); // exactly `outlen` bytes
+
+int tls13_certificate_list_to_bytes(const uint8_t *certs, size_t certslen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len, uint8_t **out, size_t *outlen);
+int tls13_record_set_handshake_certificate(uint8_t *record, size_t *recordlen,
+	const uint8_t *request_context, size_t request_context_len,
+	const uint8_t *certs, size_t certslen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len);
+int tls13_record_set_handshake_certificate_request_default(uint8_t *record, size_t *recordlen);
+// CompressedCertificate of the Certificate message body `cert_msg`, return 0 if it is not smaller
+int tls13_compress_certificate(int algor, const uint8_t *cert_msg, size_t cert_msg_len,
+	uint8_t *out, size_t *outlen, size_t maxlen);
+// `*cert_msg` is malloc-ed
+int tls13_decompress_certificate(const uint8_t *data, size_t datalen, const int *algors, size_t algors_cnt,
+	uint8_t **cert_msg, size_t *cert_msg_len);
+
+/*
+ * Private key operations of the TLCP server, e.g. for a worker pool or an
+ * HSM queue. `sign` signs the SM3 digest of Z and the message, `decrypt`
+ * decrypts the ClientKeyExchange. Each returns 1 with the result, -1 on
+ * error, or TLS_ERROR_WANT_ASYNC with a handle in `*job` after submitting
+ * it. tls_do_handshake() then returns TLS_ERROR_WANT_ASYNC too, call it
+ * again when the job is done and it collects the result from `complete`,
+ * which may return TLS_ERROR_WANT_ASYNC again. `out` has room for
+ * SM2_MAX_SIGNATURE_SIZE or SM2_MAX_PLAINTEXT_SIZE bytes. The optional
+ * `cancel` is called by tls_cleanup() for a job never completed. `key` may
+ * hold only the public key.
+ */
 typedef struct {
+	int (*sign)(void *arg, const SM2_KEY *key, const uint8_t dgst[32], uint8_t *sig, size_t *siglen, void **job);
+	int (*decrypt)(void *arg, const SM2_KEY *key, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, void **job);
+	int (*complete)(void *arg, void *job, uint8_t *out, size_t *outlen);
+	void (*cancel)(void *arg, void *job);
+	void *arg;
+} TLS_PRIVATE_KEY_METHOD;
+
+/*
+ * A private key method decrypting the ClientKeyExchanges of concurrent TLCP
+ * handshakes together with sm2_decrypt_batch(). decrypt() queues the job and
+ * returns TLS_ERROR_WANT_ASYNC, the queue is decrypted when it holds
+ * `max_jobs`, when a connection polls with complete() `window_nsec` after the
+ * oldest job was queued, or by tls_decrypt_batch_run(), e.g. once per event
+ * loop iteration before retrying the connections. The signatures are computed
+ * at once. The keys of the context must hold the private keys. One batch may
+ * be shared by the threads, each call holds its lock.
+ */
+typedef struct TLS_DECRYPT_BATCH_st TLS_DECRYPT_BATCH;
+
+TLS_DECRYPT_BATCH *tls_decrypt_batch_new(size_t max_jobs, uint64_t window_nsec);
+void tls_decrypt_batch_free(TLS_DECRYPT_BATCH *batch);
+void tls_decrypt_batch_key_method(TLS_DECRYPT_BATCH *batch, TLS_PRIVATE_KEY_METHOD *method);
+size_t tls_decrypt_batch_run(TLS_DECRYPT_BATCH *batch); // returns the number of jobs decrypted
+
+/*
+ * Server name indication (RFC 6066) of TLS 1.3 and TLCP. The callback of the
+ * server gets the requested host name in lower case and returns 1 with a
+ * reference of a server TLS_CTX of the same protocol, whose certificates,
+ * keys and OCSP stapler replace the ones of the connection's context, 0 to
+ * keep them, or -1 to abort with an unrecognized_name alert. The other
+ * settings always come from the connection's context.
+ */
+/*
+ * Admission of handshakes on a loaded server. A ClientHello costs the client
+ * nothing while the server answers it with SM2 private-key operations, the
+ * TLS 1.3 CertificateVerify, the TLCP ServerKeyExchange and the decryption of
+ * the ClientKeyExchange. The guard, shared by the contexts of a server, bounds
+ * the full handshakes doing them at the same time to `max_key_ops` (0 for no
+ * bound), a handshake beyond it is refused with a handshake_failure alert
+ * before any of this work. With a cookie mode the TLS 1.3 server first answers
+ * a ClientHello by a stateless HelloRetryRequest, the cookie is MAC-ed under a
+ * key rotated every TLS_HANDSHAKE_COOKIE_LIFETIME seconds, so only a client
+ * receiving at its address gets to the ECDHE and the signature. TLCP has no
+ * retry message, the bound is its check before the ServerKeyExchange.
+ */
+enum {
+	TLS_cookie_off = 0,
+	TLS_cookie_always,
+	TLS_cookie_under_load, // half of `max_key_ops` are in progress
+};
+
+#define TLS_HANDSHAKE_COOKIE_LIFETIME	30 // seconds, a cookie is accepted for one to two lifetimes
+
+typedef struct TLS_HANDSHAKE_GUARD_st TLS_HANDSHAKE_GUARD;
+
+TLS_HANDSHAKE_GUARD *tls_handshake_guard_new(int cookie_mode, size_t max_key_ops);
+void tls_handshake_guard_free(TLS_HANDSHAKE_GUARD *guard);
+
+int tls_handshake_guard_cookie_required(TLS_HANDSHAKE_GUARD *guard);
+int tls_handshake_guard_seal_cookie(TLS_HANDSHAKE_GUARD *guard, const uint8_t *data, size_t datalen,
+	uint8_t *cookie, size_t *cookielen, size_t maxlen);
+// return 0 for a cookie forged or expired
+int tls_handshake_guard_open_cookie(TLS_HANDSHAKE_GUARD *guard, const uint8_t *cookie, size_t cookielen,
+	const uint8_t **data, size_t *datalen);
+int tls_handshake_guard_admit(TLS_HANDSHAKE_GUARD *guard); // return 0 if `max_key_ops` are in progress
+void tls_handshake_guard_release(TLS_HANDSHAKE_GUARD *guard);
+
+struct TLS_CTX_st;
+typedef int (*TLS_SERVER_NAME_CALLBACK)(void *arg, const char *host, struct TLS_CTX_st **ctx);
+
+typedef struct TLS_CTX_st {
 	int protocol;
 	int is_client;
 	int cipher_suites[TLS_MAX_CIPHER_SUITES_COUNT];
 	size_t cipher_suites_cnt;
 	uint8_t *cacerts;
 	size_t cacertslen;
+	X509_STORE ca_store; // index of cacerts
+	const uint8_t *ca_snapshot; // mapped file holding cacerts, see tls_ctx_set_ca_snapshot()
+	size_t ca_snapshot_len;
 	uint8_t *certs;
 	size_t certslen;
 	SM2_KEY signkey;
 	SM2_KEY kenckey;
 	int verify_depth;
+	// encoded by tls_ctx_cache_handshake_messages(), shared with the connections
+	uint8_t *certificate_msg;
+	size_t certificate_msg_len;
+	uint8_t *certificate_request_msg; // server
+	size_t certificate_request_msg_len;
+	uint8_t session_ticket_key[TLS13_SESSION_TICKET_KEY_SIZE];
+	int session_ticket_key_set;
+	TLS_SESSION_CACHE *session_cache; // not owned
+	int ktls;
+	TLS_PRIVATE_KEY_METHOD key_method;
+	int key_method_set;
+	struct SM2_KEY_POOL_st *ecdhe_key_pool; // not owned
+	uint32_t max_early_data_size;
+	TLS_REPLAY_CACHE *replay_cache; // not owned
+	TLS_OCSP_STAPLER *ocsp_stapler; // not owned
+	int ocsp_stapling;
+	int cert_compression_algors[TLS_MAX_CERT_COMPRESSION_ALGORS];
+	size_t cert_compression_algors_cnt;
+	uint8_t *compressed_certs[TLS_MAX_CERT_COMPRESSION_ALGORS]; // server, CompressedCertificate or NULL
+	size_t compressed_certs_len[TLS_MAX_CERT_COMPRESSION_ALGORS];
+
+	TLS_SERVER_NAME_CALLBACK server_name_callback;
+	void *server_name_callback_arg;
+	size_t record_size_limit; // largest plaintext to receive, 0 if not sent
+	int max_fragment_length; // client, TLS_max_fragment_length_*, 0 if not sent
+	int dynamic_record_sizing;
+	int read_ahead;
+	TLS_HANDSHAKE_GUARD *handshake_guard; // not owned
 
 	int quiet;
+	int refs; // 0 if not from tls_ctx_new()
 } TLS_CTX;
 
 int tls_ctx_init(TLS_CTX *ctx, int protocol, int is_client);
 int tls_ctx_set_cipher_suites(TLS_CTX *ctx, const int *cipher_suites, size_t cipher_suites_cnt);
 int tls_ctx_set_ca_certificates(TLS_CTX *ctx, const char *cacertsfile, int depth);
+// a store snapshot from `gmssl castore`, mapped read-only until tls_ctx_cleanup()
+int tls_ctx_set_ca_snapshot(TLS_CTX *ctx, const char *snapshotfile, int depth);
 int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
 	const char *keyfile, const char *keypass);
 int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chainfile,
 	const char *signkeyfile, const char *signkeypass,
 	const char *kenckeyfile, const char *kenckeypass);
+int tls_ctx_set_session_ticket_key(TLS_CTX *ctx, const uint8_t *key, size_t keylen);
+int tls_ctx_set_session_cache(TLS_CTX *ctx, TLS_SESSION_CACHE *cache);
+int tls_ctx_enable_ktls(TLS_CTX *ctx, int enable);
+int tls_ctx_set_early_data(TLS_CTX *ctx, uint32_t max_early_data_size, TLS_REPLAY_CACHE *replay_cache); // TLS 1.3 server only
+int tls_ctx_set_private_key_method(TLS_CTX *ctx, const TLS_PRIVATE_KEY_METHOD *method); // TLCP server only
+int tls_ctx_set_ocsp_stapler(TLS_CTX *ctx, TLS_OCSP_STAPLER *stapler); // TLS 1.3 and TLCP server
+int tls_ctx_set_ocsp_stapling(TLS_CTX *ctx, int mode); // TLS 1.3 and TLCP client
+// TLS 1.3, the server compresses the certificates already set
+int tls_ctx_set_certificate_compression(TLS_CTX *ctx, const int *algors, size_t algors_cnt);
+/*
+ * The bodies of the Certificate message of the own chain and of the
+ * CertificateRequest, with the CA names of the trust anchors, are the same in
+ * every handshake, they are encoded once and copied into the flights. The
+ * certificate loaders call it, call it again after setting the certs or
+ * cacerts fields directly. A stapled OCSP response is encoded per handshake.
+ */
+int tls_ctx_cache_handshake_messages(TLS_CTX *ctx);
+int tls_ctx_set_server_name_callback(TLS_CTX *ctx, TLS_SERVER_NAME_CALLBACK callback, void *arg); // TLS 1.3 and TLCP server
+/*
+ * Smaller records for clients with little memory and for interactive traffic.
+ * `limit` is the largest plaintext the endpoint accepts in a record, 64 to
+ * TLS_MAX_PLAINTEXT_SIZE, sent as record_size_limit. The client may also ask
+ * for a max_fragment_length of 512, 1024, 2048 or 4096 bytes, the peer's
+ * record_size_limit is preferred if both are offered. The limits are applied
+ * to the application data. TLS 1.3 and TLCP.
+ */
+int tls_ctx_set_record_size_limit(TLS_CTX *ctx, size_t limit);
+int tls_ctx_set_max_fragment_length(TLS_CTX *ctx, size_t len); // client
+/*
+ * The application data is sent in records of TLS_DYNAMIC_RECORD_SMALL_SIZE
+ * bytes, fitting a TCP segment, until TLS_DYNAMIC_RECORD_RAMP_BYTES are sent,
+ * then in full records. An idle connection starts over with small records.
+ */
+#define TLS_DYNAMIC_RECORD_SMALL_SIZE	1360
+#define TLS_DYNAMIC_RECORD_RAMP_BYTES	(1024 * 1024)
+#define TLS_DYNAMIC_RECORD_IDLE_TIMEOUT	1 // seconds
+int tls_ctx_set_dynamic_record_sizing(TLS_CTX *ctx, int enable);
+/*
+ * With read-ahead (the default) one recv() takes all the bytes available, up
+ * to TLS_MAX_RECORD_SIZE, and the records are cut from this buffer, so a
+ * burst of small records costs one syscall instead of two per record. The
+ * buffered bytes are not seen by poll(), see tls_pending(). Disable it when
+ * the socket is handed over to other code after the TLS connection.
+ */
+int tls_ctx_set_read_ahead(TLS_CTX *ctx, int enable);
+int tls_ctx_set_handshake_guard(TLS_CTX *ctx, TLS_HANDSHAKE_GUARD *guard); // TLS 1.3 and TLCP server
+#ifdef ENABLE_SM2_KEY_POOL
+// ECDHE keys of TLS 1.2 and TLS 1.3 handshakes are taken from the pool, which may be shared by contexts
+int tls_ctx_set_ecdhe_key_pool(TLS_CTX *ctx, SM2_KEY_POOL *pool);
+#endif
 void tls_ctx_cleanup(TLS_CTX *ctx);
 
+/*
+ * Connections point to the certificates and keys of their TLS_CTX instead of
+ * copying them, so the context must outlive its connections. A TLS_CTX from
+ * tls_ctx_new() is reference counted, tls_init() takes a reference and
+ * tls_cleanup() gives it back, so it can be released while the connections
+ * are still running. Such a context is treated as immutable once shared, to
+ * rotate the certificates and keys build a new one and publish it in a
+ * TLS_CTX_SLOT. New connections get the new context, the running ones keep
+ * the old context until they are done.
+ */
+TLS_CTX *tls_ctx_new(int protocol, int is_client);
+TLS_CTX *tls_ctx_up_ref(TLS_CTX *ctx);
+void tls_ctx_free(TLS_CTX *ctx); // cleanup and free with the last reference
 
+typedef struct TLS_CTX_SLOT_st TLS_CTX_SLOT;
 
-#define TLS_MAX_CERTIFICATES_SIZE	2048
+TLS_CTX_SLOT *tls_ctx_slot_new(TLS_CTX *ctx); // takes over the reference of the caller
+TLS_CTX *tls_ctx_slot_get(TLS_CTX_SLOT *slot); // a new reference, tls_ctx_free() it
+int tls_ctx_slot_set(TLS_CTX_SLOT *slot, TLS_CTX *ctx); // takes over the reference of the caller
+void tls_ctx_slot_free(TLS_CTX_SLOT *slot);
+
+/*
+ * Host name table for virtual hosting, tls_sni_table_lookup() is the
+ * TLS_SERVER_NAME_CALLBACK with the table as `arg`. Entries keep the file
+ * names and the password, the certificates and the keys are loaded in a
+ * TLS_CTX on the first lookup of the host, at most `max_loaded` contexts stay
+ * loaded and the least recently used one is released first. A host
+ * "*.example.com" matches one more label on the left. Unknown hosts keep the
+ * default certificates of the connection's context.
+ */
+typedef struct TLS_SNI_TABLE_st TLS_SNI_TABLE;
+
+TLS_SNI_TABLE *tls_sni_table_new(int protocol, size_t max_hosts, size_t max_loaded);
+int tls_sni_table_add(TLS_SNI_TABLE *table, const char *host,
+	const char *chainfile, const char *keyfile, const char *keypass);
+int tls_sni_table_add_tlcp(TLS_SNI_TABLE *table, const char *host, const char *chainfile,
+	const char *signkeyfile, const char *signkeypass,
+	const char *kenckeyfile, const char *kenckeypass);
+int tls_sni_table_lookup(void *table, const char *host, TLS_CTX **ctx);
+size_t tls_sni_table_loaded_count(TLS_SNI_TABLE *table);
+void tls_sni_table_evict(TLS_SNI_TABLE *table, size_t max_loaded); // e.g. under memory pressure
+void tls_sni_table_free(TLS_SNI_TABLE *table);
+
+
+
+#define TLS_MAX_CERTIFICATES_SIZE	8192 // one record with a stapled OCSP response
 #define TLS_DEFAULT_VERIFY_DEPTH	4
 #define TLS_MAX_VERIFY_DEPTH		5
 
 
+/*
+ * tls_do_handshake(), tls_send(), tls_recv(), tls13_send() and tls13_recv()
+ * return TLS_ERROR_WANT_READ or TLS_ERROR_WANT_WRITE when a non-blocking
+ * socket is not ready, call again with the same arguments once it is.
+ * TLS_ERROR_WANT_READ keeps the old -EAGAIN value. TLS 1.2 handshakes still
+ * need a blocking socket. TLS_ERROR_WANT_ASYNC waits for a job of the
+ * TLS_PRIVATE_KEY_METHOD.
+ */
+#define TLS_ERROR_WANT_READ		(-EAGAIN)
+#define TLS_ERROR_WANT_WRITE		(-EAGAIN - 1)
+#define TLS_ERROR_WANT_ASYNC		(-EAGAIN - 2)
+
+// the next handshake message to process
+enum {
+	TLS_state_client_hello = 0,
+	TLS_state_early_data, // tls13 client sending 0-RTT
+	TLS_state_server_hello,
+	TLS_state_encrypted_extensions,
+	TLS_state_server_certificate,
+	TLS_state_certificate_status, // tlcp
+	TLS_state_server_key_exchange,
+	TLS_state_certificate_request,
+	TLS_state_server_hello_done,
+	TLS_state_client_certificate,
+	TLS_state_client_key_exchange,
+	TLS_state_client_key_exchange_decrypt, // tlcp async decryption
+	TLS_state_certificate_verify,
+	TLS_state_change_cipher_spec,
+	TLS_state_end_of_early_data, // tls13 server receiving 0-RTT
+	TLS_state_finished,
+	TLS_state_handshake_done,
+};
+
+// handshake values kept between the resumed calls of tls_do_handshake()
+typedef struct {
+	int state;
+	uint8_t client_random[32];
+	uint8_t server_random[32];
+	SM3_CTX sm3_ctx; // tlcp
+	SM2_KEY server_enc_key; // tlcp
+	SM2_KEY ecdhe_key; // tls13
+	SM2_KEY peer_sign_key; // tls13
+	const DIGEST *digest;
+	const BLOCK_CIPHER *cipher;
+	DIGEST_CTX dgst_ctx;
+	DIGEST_CTX null_dgst_ctx;
+	uint8_t master_secret[32];
+	uint8_t client_handshake_traffic_secret[32];
+	uint8_t server_handshake_traffic_secret[32];
+	uint8_t client_application_traffic_secret[32];
+	uint8_t server_application_traffic_secret[32];
+	int psk_offered; // tls13
+	int psk_accepted; // tls13
+	int early_data_offered; // tls13
+	uint8_t client_early_traffic_secret[32];
+	uint8_t early_seq_num[8]; // client, to send EndOfEarlyData
+	size_t early_data_sent; // client
+	size_t early_data_skipped; // server, records of a rejected 0-RTT
+	int ocsp_requested; // asked by the client, or acknowledged by the tlcp server
+	int cert_compression_algor; // tls13 server, 0 if the certificate is not compressed
+	uint16_t record_size_limit; // server, acknowledged record_size_limit, 0 if none
+	int max_fragment_length; // server, echoed max_fragment_length, 0 if none
+	uint8_t client_write_key[16]; // tls13 application keys for ktls
+	uint8_t server_write_key[16];
+	int async_pending; // a TLS_PRIVATE_KEY_METHOD job is submitted
+	void *async_job;
+	int key_op_admitted; // server, holds a slot of the TLS_HANDSHAKE_GUARD
+	int hello_retry; // tls13, a HelloRetryRequest is sent or received
+	uint8_t cookie[TLS13_MAX_COOKIE_SIZE]; // client, from the HelloRetryRequest
+	size_t cookie_len;
+	uint8_t hello_retry_state[4 + DIGEST_MAX_SIZE]; // server, of a HelloRetryRequest without a cookie
+	size_t hello_retry_state_len;
+} TLS_HANDSHAKE;
+
+
+/*
+ * Byte stream under the records, e.g. an event loop, a userspace TCP stack or
+ * a datagram transport with its own framing, `arg` is the user context. `send`
+ * and `recv` return the number of bytes transferred, 0 when the peer has
+ * closed, or -1 with errno set, EAGAIN when a non-blocking transport can not
+ * make progress now (tls_do_handshake() then returns TLS_ERROR_WANT_READ or
+ * TLS_ERROR_WANT_WRITE as for a non-blocking socket). A socket is the built-in
+ * transport of tls_set_socket().
+ */
+typedef struct {
+	tls_ret_t (*send)(void *arg, const uint8_t *buf, size_t len);
+	tls_ret_t (*recv)(void *arg, uint8_t *buf, size_t len);
+	void *arg;
+} TLS_TRANSPORT;
+
+int tls_transport_init_socket(TLS_TRANSPORT *transport, tls_socket_t sock);
+int tls_transport_is_socket(const TLS_TRANSPORT *transport);
+
+/*
+ * Nanoseconds spent in the handshake phases, added up over the handshakes of
+ * the connections given the same TLS_HANDSHAKE_STATS. The key exchange is the
+ * (EC)DHE key generation and agreement or the TLCP pre-master encryption, the
+ * signature is signing and verifying the handshake messages, the certificate
+ * verify is the peer certificate chain validation, the key schedule is the PRF
+ * or HKDF derivation of the keys and the Finished verify data.
+ */
+enum {
+	TLS_phase_key_exchange,
+	TLS_phase_signature,
+	TLS_phase_certificate_verify,
+	TLS_phase_key_schedule,
+	TLS_HANDSHAKE_PHASES,
+};
+
+typedef struct {
+	uint64_t nsec[TLS_HANDSHAKE_PHASES];
+} TLS_HANDSHAKE_STATS;
+
+const char *tls_handshake_phase_name(int phase);
+
 typedef struct {
 	int protocol;
 	int is_client;
 	int cipher_suites[TLS_MAX_CIPHER_SUITES_COUNT];
 	size_t cipher_suites_cnt;
-	tls_socket_t sock;
+	tls_socket_t sock; // kTLS needs the socket under the socket transport
+	TLS_TRANSPORT transport;
+	TLS_HANDSHAKE_STATS *stats;
 
-	uint8_t enced_record[TLS_MAX_RECORD_SIZE];
+	// TLS_MAX_RECORD_SIZE buffers from the buffer pool, NULL while idle
+	uint8_t *enced_record; // tls13 handshake
 	size_t enced_record_len;
-
-
-	uint8_t record[TLS_MAX_RECORD_SIZE];
-
-	uint8_t databuf[TLS_MAX_RECORD_SIZE];
+	uint8_t *record;
+	uint8_t *databuf;
 	uint8_t *data;
 	size_t datalen;
 
 	int cipher_suite;
 	uint8_t session_id[32];
 	size_t session_id_len;
-	uint8_t server_certs[TLS_MAX_CERTIFICATES_SIZE]; // TODO: use ptr and malloc			
+	// the own chain is shared with the TLS_CTX, the peer's one is malloc-ed and sized to the chain
+	uint8_t *server_certs;
 	size_t server_certs_len;
-	uint8_t client_certs[TLS_MAX_CERTIFICATES_SIZE];
+	uint8_t *client_certs;
 	size_t client_certs_len;
-	uint8_t ca_certs[2048];
+	const uint8_t *ca_certs; // shared with the TLS_CTX
 	size_t ca_certs_len;
-
-	SM2_KEY sign_key;
-	SM2_KEY kenc_key;
+	const X509_STORE *ca_store;
+	const uint8_t *certificate_msg; // shared with the TLS_CTX, NULL if encoded in the handshake
+	size_t certificate_msg_len;
+	const uint8_t *certificate_request_msg;
+	size_t certificate_request_msg_len;
+
+	const SM2_KEY *sign_key; // shared with the TLS_CTX, NULL if not used
+	const SM2_KEY *kenc_key;
+	const TLS_CTX *ctx; // referenced if from tls_ctx_new()
+	char server_name[TLS_MAX_SERVER_NAME_SIZE + 1]; // sent by the client, empty if none
+	TLS_SERVER_NAME_CALLBACK server_name_callback;
+	void *server_name_callback_arg;
+	const TLS_CTX *host_ctx; // referenced, certificates and keys of the server_name
 
 	int verify_result;
 
@@ -748,24 +1343,256 @@ typedef struct {
 
 	uint8_t client_write_iv[12]; // tls13
 	uint8_t server_write_iv[12]; // tls13
+	uint8_t client_application_traffic_secret[32]; // tls13, ratcheted by KeyUpdate
+	uint8_t server_application_traffic_secret[32];
 	BLOCK_CIPHER_KEY client_write_key;
 	BLOCK_CIPHER_KEY server_write_key;
 
+	// non-blocking I/O, records are queued in sendbuf and flushed by tls_flush()
+	uint8_t *sendbuf;
+	size_t sendbuf_len;
+	size_t sendbuf_offset;
+	size_t send_pending; // accepted by tls_send()/tls13_send() before TLS_ERROR_WANT_WRITE
+	size_t recv_offset; // bytes of the current record received
+	int read_ahead;
+	uint8_t *readbuf; // received bytes of the next records
+	size_t readbuf_len;
+	size_t readbuf_offset;
+	size_t readbuf_size; // 0 for a pool buffer, or the size of the tls_recv_pipelined() buffer
+
+	TLS_HANDSHAKE hs;
+	ARENA arena; // temporaries of the handshake, freed when it ends
+
+	// resumption
+	uint8_t session_ticket_key[TLS13_SESSION_TICKET_KEY_SIZE];
+	int session_ticket_key_set;
+	uint8_t resumption_master_secret[32];
+	TLS_SESSION_CACHE *session_cache;
+	struct SM2_KEY_POOL_st *ecdhe_key_pool;
+	TLS_SESSION session;
+	int session_reused;
+
+	// tls13 0-RTT, early_data is malloc-ed, sent by the client or received by the server
+	uint32_t max_early_data_size;
+	TLS_REPLAY_CACHE *replay_cache;
+	uint8_t *early_data;
+	size_t early_data_len;
+	int early_data_status;
+
+	TLS_OCSP_STAPLER *ocsp_stapler;
+	int ocsp_stapling;
+	int ocsp_status; // X509_ocsp_cert_* of the stapled response, -1 if none
+	int cert_compression_algors[TLS_MAX_CERT_COMPRESSION_ALGORS];
+	size_t cert_compression_algors_cnt;
+	const uint8_t *compressed_certs[TLS_MAX_CERT_COMPRESSION_ALGORS]; // shared with the TLS_CTX
+	size_t compressed_certs_len[TLS_MAX_CERT_COMPRESSION_ALGORS];
+
+	// largest plaintext of a record, TLS_MAX_PLAINTEXT_SIZE unless negotiated
+	size_t max_send_fragment;
+	size_t max_recv_fragment;
+	size_t record_size_limit; // copied from the TLS_CTX
+	int max_fragment_length;
+	int dynamic_record_sizing;
+	uint64_t dynamic_record_bytes; // sent since the connection was idle
+	time_t dynamic_record_time;
+
+	int ktls_requested;
+	const TLS_PRIVATE_KEY_METHOD *key_method; // points into the TLS_CTX
+	TLS_HANDSHAKE_GUARD *handshake_guard;
+	int ktls; // TLS_KTLS_TX|TLS_KTLS_RX
+	struct TLS_QUIC_st *quic; // handshake messages carried by QUIC, not in records
+
 	int quiet;
 } TLS_CONNECT;
 
 
-#define TLS_MAX_EXTENSIONS_SIZE 512 // FIXME: no reason to give fixed max length			
+#define TLS_MAX_EXTENSIONS_SIZE 1024 // FIXME: no reason to give fixed max length			
 
 
 int tls_init(TLS_CONNECT *conn, const TLS_CTX *ctx);
 int tls_set_socket(TLS_CONNECT *conn, tls_socket_t sock);
+int tls_set_transport(TLS_CONNECT *conn, const TLS_TRANSPORT *transport);
+int tls_set_handshake_stats(TLS_CONNECT *conn, TLS_HANDSHAKE_STATS *stats);
 int tls_do_handshake(TLS_CONNECT *conn);
 int tls_send(TLS_CONNECT *conn, const uint8_t *in, size_t inlen, size_t *sentlen);
 int tls_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen);
 int tls_shutdown(TLS_CONNECT *conn);
+/*
+ * Bytes received but not returned yet, decrypted or still in the read-ahead
+ * buffer. Call tls_recv()/tls13_recv() before waiting in poll() while not 0.
+ */
+size_t tls_pending(const TLS_CONNECT *conn);
+/*
+ * Receive the data of the next record and of the following application data
+ * records already in the read-ahead buffer, up to `outlen` bytes, so one
+ * wakeup drains a burst of records. Only the first record may wait for the
+ * socket or return TLS_ERROR_WANT_READ. Any protocol.
+ */
+int tls_recv_batch(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen);
+
+/*
+ * Pipelined receive of one busy connection. The read-ahead buffer grows to
+ * TLS_RECV_PIPELINE_RECORDS records, the whole application data records in
+ * it are decrypted and MAC-checked at once on the library thread pool (see
+ * thread_pool.h), one record per item, and their data is returned in order,
+ * up to `outlen` bytes. Each record needs its ciphertext length in `out`
+ * while it is decrypted. A record that fails, or a TLS 1.3 record that is not
+ * application data, is left to the tls_recv_batch() path, which also takes
+ * the calls without read-ahead or with decrypted data left. Any protocol.
+ */
+#define TLS_RECV_PIPELINE_RECORDS	8
+
+int tls_recv_pipelined(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen);
+
+/*
+ * Zero-copy application data. The plaintext to send is at
+ * `buf + TLS_RECORD_HEADROOM` followed by TLS_RECORD_TAILROOM free bytes, it
+ * is encrypted in `buf` and sent from there, only an unsent tail is copied.
+ * `datalen` is at most tls_get_max_send_fragment(). The received record is decrypted in `buf` (at least TLS_MAX_RECORD_SIZE
+ * bytes, pass the same buffer after TLS_ERROR_WANT_READ), `*data` points into
+ * it. Do not mix them with tls_recv()/tls13_recv() while data is buffered.
+ */
+#define TLS_RECORD_HEADROOM	TLS_CBC_HEADROOM
+#define TLS_RECORD_TAILROOM	TLS_CBC_TAILROOM
+
+int tls_send_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t datalen, size_t *sentlen);
+int tls_recv_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, uint8_t **data, size_t *datalen);
+
+/*
+ * Vectored send. The buffers are packed into as few records as possible,
+ * sealed back to back in sendbuf and flushed with one send() per buffer, so
+ * many small messages cost one record and one syscall. `*sentlen` may be
+ * less than the total, e.g. after TLS_ERROR_WANT_WRITE has been retried.
+ */
+typedef struct {
+	const void *base;
+	size_t len;
+} TLS_IOVEC;
+
+size_t tls_iovec_copy(const TLS_IOVEC **iov, size_t *iovcnt, size_t *offset, uint8_t *out, size_t outlen);
+int tls_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen);
+
+/*
+ * Send on many connections at once, e.g. a message fanned out to the clients
+ * in one event loop tick. Each job sends one record as tls_send()/tls13_send()
+ * do and gets its own result in `ret` and `sentlen`. The SM3-HMACs of the
+ * TLCP and TLS 1.2 records are computed together in the SM3 multi-buffer
+ * lanes, then each record is CBC encrypted under its own key. TLS 1.3 records
+ * are sealed one by one, there are no SM4-GCM lanes across keys. Returns 1
+ * when every job has run, whatever its result.
+ */
+typedef struct {
+	TLS_CONNECT *conn;
+	const uint8_t *data;
+	size_t datalen;
+	size_t sentlen;
+	int ret;
+} TLS_SEND_JOB;
+
+#define TLS_SEND_BATCH_SIZE	(SM3_MB_LANES * 4) // records sealed together
+
+int tls_send_batch(TLS_SEND_JOB *jobs, size_t jobs_cnt);
 void tls_cleanup(TLS_CONNECT *conn);
 
+int tls_set_session(TLS_CONNECT *conn, const TLS_SESSION *session);
+int tls_get_session(const TLS_CONNECT *conn, TLS_SESSION *session);
+int tls_session_reused(const TLS_CONNECT *conn);
+int tls_session_resume(TLS_CONNECT *conn, const uint8_t *session_id, size_t session_id_len);
+int tls_session_save(TLS_CONNECT *conn);
+
+/*
+ * 0-RTT. The client sets the early data after tls_set_session() with a
+ * ticket allowing at least `datalen` bytes, it is sent right after
+ * ClientHello. After the handshake tls13_early_data_status() tells whether
+ * the server took it, a rejected one has to be sent again with tls13_send().
+ * The server gets the accepted early data with tls13_get_early_data().
+ */
+enum {
+	TLS_early_data_none = 0,
+	TLS_early_data_accepted,
+	TLS_early_data_rejected,
+};
+
+int tls13_set_early_data(TLS_CONNECT *conn, const uint8_t *data, size_t datalen);
+int tls13_early_data_status(const TLS_CONNECT *conn);
+int tls13_get_early_data(const TLS_CONNECT *conn, const uint8_t **data, size_t *datalen); // return 0 if not accepted
+
+int tls_get_ocsp_status(const TLS_CONNECT *conn); // X509_ocsp_cert_* of the stapled response, -1 if none
+// client, check the stapled response (NULL if none), return -1 with the alert to send
+int tls_process_ocsp_response(TLS_CONNECT *conn, const uint8_t *ocsp_resp, size_t ocsp_resp_len, int *alert);
+
+int tls_set_server_name(TLS_CONNECT *conn, const char *host); // client, TLS 1.3 and TLCP
+const char *tls_get_server_name(const TLS_CONNECT *conn); // NULL if none
+// server, select the certificates with the server_name in ClientHello `exts`, return 1 if switched
+int tls_select_server_name(TLS_CONNECT *conn, const uint8_t *exts, size_t extslen, int *alert);
+
+// client, the record_size_limit and max_fragment_length to offer
+int tls_record_size_exts_to_bytes(const TLS_CONNECT *conn, uint8_t **out, size_t *outlen);
+// server, apply the limits of the ClientHello `exts` and set the ones to acknowledge in `conn->hs`
+int tls_select_record_size(TLS_CONNECT *conn, const uint8_t *exts, size_t extslen, int *alert);
+// client, apply the acknowledged limits, 0 if not present
+int tls_process_record_size(TLS_CONNECT *conn, uint16_t record_size_limit, int max_fragment_length);
+// plaintext length of the next record to send, at most `len`
+size_t tls_send_fragment_size(TLS_CONNECT *conn, size_t len);
+size_t tls_get_max_send_fragment(const TLS_CONNECT *conn);
+
+/*
+ * The record buffers of TLS_CONNECT come from a process-wide pool. The
+ * handshake, send, recv and shutdown calls take them on entry and give them
+ * back when no partial record, queued output or unread data is left, so an
+ * idle keep-alive connection holds none. At most TLS_BUFFER_POOL_MAX_FREE
+ * free buffers are kept.
+ */
+#define TLS_BUFFER_POOL_MAX_FREE	256
+
+uint8_t *tls_buffer_get(void);
+void tls_buffer_put(uint8_t *buf);
+size_t tls_buffer_pool_free_count(void);
+void tls_buffer_pool_cleanup(void);
+int tls_conn_buffers_get(TLS_CONNECT *conn);
+void tls_conn_buffers_put(TLS_CONNECT *conn);
+void tls_conn_readbuf_put(TLS_CONNECT *conn);
+int tls_conn_certs_reserve(uint8_t **certs, size_t len);
+void tls_conn_arena_begin(TLS_CONNECT *conn, ARENA_MARK *mark);
+void tls_conn_arena_end(TLS_CONNECT *conn, const ARENA_MARK *mark, int done);
+
+/*
+ * Transport pair in memory, the bytes sent on one end are received on the
+ * other, e.g. for benchmarks and tests without sockets. The recv of a
+ * non-blocking pair returns -1 with EAGAIN when nothing is buffered, a
+ * blocking pair waits for the peer, the two ends then run in two threads.
+ * Closing an end makes the recv of the other return 0 once it is drained.
+ */
+typedef struct TLS_MEMORY_PAIR_st TLS_MEMORY_PAIR;
+
+TLS_MEMORY_PAIR *tls_memory_pair_new(int blocking);
+int tls_memory_pair_get_transport(TLS_MEMORY_PAIR *pair, int end, TLS_TRANSPORT *transport);
+void tls_memory_pair_close(TLS_MEMORY_PAIR *pair, int end);
+void tls_memory_pair_free(TLS_MEMORY_PAIR *pair);
+
+tls_ret_t tls_conn_transport_send(TLS_CONNECT *conn, const uint8_t *buf, size_t len);
+tls_ret_t tls_conn_transport_recv(TLS_CONNECT *conn, uint8_t *buf, size_t len);
+int tls_conn_record_write(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen);
+int tls_conn_record_read(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen);
+int tls_conn_record_flush(TLS_CONNECT *conn);
+// the own Certificate without OCSP response and the CertificateRequest, from the TLS_CTX if cached
+int tls_conn_set_handshake_certificate(const TLS_CONNECT *conn, uint8_t *record, size_t *recordlen);
+int tls_conn_set_handshake_certificate_request(const TLS_CONNECT *conn, uint8_t *record, size_t *recordlen);
+
+uint64_t tls_handshake_phase_begin(const TLS_CONNECT *conn);
+void tls_handshake_phase_end(TLS_CONNECT *conn, int phase, uint64_t begin);
+int tls_ecdhe_key_generate(TLS_CONNECT *conn, SM2_KEY *key);
+// a slot of the handshake guard for the private-key operations, 0 if all are taken
+int tls_handshake_key_op_begin(TLS_CONNECT *conn);
+void tls_handshake_key_op_end(TLS_CONNECT *conn);
+
+int tls_flush(TLS_CONNECT *conn);
+int tls_conn_record_send(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen);
+int tls_conn_record_send_direct(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen);
+uint8_t *tls_conn_record_reserve(TLS_CONNECT *conn, size_t len);
+int tls_conn_record_recv(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen);
+int tls_handshake_recv(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen);
+
 int tlcp_do_connect(TLS_CONNECT *conn);
 int tlcp_do_accept(TLS_CONNECT *conn);
 int tls12_do_connect(TLS_CONNECT *conn);
@@ -781,8 +1608,352 @@ int tls13_do_accept(TLS_CONNECT *conn);
 int tls_send_alert(TLS_CONNECT *conn, int alert);
 int tls_send_warning(TLS_CONNECT *conn, int alert);
 
+int tls13_session_ticket_encrypt(const uint8_t key[TLS13_SESSION_TICKET_KEY_SIZE],
+	int cipher_suite, uint32_t issue_time, uint32_t ticket_age_add, const uint8_t psk[32],
+	uint8_t *ticket, size_t *ticketlen);
+int tls13_session_ticket_decrypt(const uint8_t key[TLS13_SESSION_TICKET_KEY_SIZE],
+	const uint8_t *ticket, size_t ticketlen,
+	int *cipher_suite, uint32_t *issue_time, uint32_t *ticket_age_add, uint8_t psk[32]);
+int tls13_record_set_handshake_new_session_ticket(uint8_t *record, size_t *recordlen,
+	uint32_t ticket_lifetime, uint32_t ticket_age_add,
+	const uint8_t *ticket_nonce, size_t ticket_nonce_len,
+	const uint8_t *ticket, size_t ticketlen, uint32_t max_early_data_size);
+int tls13_record_get_handshake_new_session_ticket(const uint8_t *record,
+	uint32_t *ticket_lifetime, uint32_t *ticket_age_add,
+	const uint8_t **ticket_nonce, size_t *ticket_nonce_len,
+	const uint8_t **ticket, size_t *ticketlen, uint32_t *max_early_data_size);
+
+enum {
+	TLS_key_update_not_requested	= 0,
+	TLS_key_update_requested	= 1,
+};
+
+int tls13_record_set_handshake_key_update(uint8_t *record, size_t *recordlen, int request_update);
+int tls13_record_get_handshake_key_update(const uint8_t *record, int *request_update);
+
+/*
+ * KeyUpdate ratchets the application traffic secret, the sequence number
+ * starts over under the new key. tls13_key_update() updates the sending key,
+ * TLS_key_update_requested asks the peer to update its own one. The KeyUpdate
+ * is queued even if TLS_ERROR_WANT_WRITE is returned, tls_flush() sends it.
+ * The sending key is also updated before TLS13_KEY_UPDATE_RECORDS records,
+ * below the 2^24.5 full-size records an SM4-GCM key may protect, and a
+ * requested update of the peer is answered from the recv calls. Not with kTLS.
+ */
+#define TLS13_KEY_UPDATE_RECORDS	((uint64_t)1 << 24)
+int tls13_key_update(TLS_CONNECT *conn, int request_update);
+
 int tls13_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen);
 int tls13_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen);
+int tls13_send_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t datalen, size_t *sentlen);
+int tls13_recv_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, uint8_t **data, size_t *datalen);
+int tls13_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen);
+
+/*
+ * Linux kTLS offload (ENABLE_KTLS). With tls_ctx_enable_ktls() the TLS 1.3
+ * SM4-GCM application keys, IVs and sequence numbers are handed to the kernel
+ * once the handshake is done, tls13_send()/tls13_recv() then pass plaintext
+ * through the socket and tls13_sendfile() sends files without copying them
+ * into the process. A direction the kernel refuses stays in user space,
+ * tls_ktls_enabled() tells which ones are offloaded. kTLS needs a TCP socket.
+ */
+#define TLS_KTLS_TX	1
+#define TLS_KTLS_RX	2
+
+int tls_ktls_enabled(const TLS_CONNECT *conn);
+#ifdef ENABLE_KTLS
+#include <sys/types.h>
+int tls13_ktls_enable(TLS_CONNECT *conn, const uint8_t client_write_key[16], const uint8_t server_write_key[16]);
+int tls13_ktls_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen);
+int tls13_ktls_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen);
+int tls13_ktls_recv(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, int *record_type, size_t *recvlen);
+int tls13_sendfile(TLS_CONNECT *conn, int fd, off_t *offset, size_t count, size_t *sentlen);
+#endif
+
+/*
+ * Client connection pool, shared by any number of threads. Connections are
+ * keyed by (host, port, ctx), tls_client_pool_connect() gives a live idle one
+ * if there is, or connects and handshakes with the last session of the key,
+ * so a connection closed by the server comes back as an abbreviated
+ * handshake. The caller owns the connection until tls_client_pool_release(),
+ * `reusable` tells if it is still at a record boundary with no pending reply.
+ * Idle ones expire after TLS_CLIENT_POOL_IDLE_SECONDS, the oldest is closed
+ * when more than `max_idle` are kept. `timeout` is the socket timeout in
+ * seconds. The ctx must outlive the pool.
+ */
+#define TLS_CLIENT_POOL_MAX_IDLE	64
+#define TLS_CLIENT_POOL_IDLE_SECONDS	60
+#define TLS_CLIENT_POOL_MAX_SESSIONS	64
+
+typedef struct TLS_CLIENT_POOL_st TLS_CLIENT_POOL;
+
+typedef struct {
+	uint64_t connects; // full or abbreviated handshakes
+	uint64_t resumed;
+	uint64_t reused; // idle connections taken
+} TLS_CLIENT_POOL_STATS;
+
+TLS_CLIENT_POOL *tls_client_pool_new(size_t max_idle, int timeout);
+void tls_client_pool_free(TLS_CLIENT_POOL *pool);
+int tls_client_pool_connect(TLS_CLIENT_POOL *pool, const TLS_CTX *ctx, const char *host, int port,
+	TLS_CONNECT **conn);
+void tls_client_pool_release(TLS_CLIENT_POOL *pool, TLS_CONNECT *conn, int reusable);
+size_t tls_client_pool_idle_count(TLS_CLIENT_POOL *pool);
+int tls_client_pool_get_stats(TLS_CLIENT_POOL *pool, TLS_CLIENT_POOL_STATS *stats);
+
+/*
+ * Datagram record layer (DTLS 1.3 and TLCP over UDP)
+ *
+ * Records carry the full DTLSPlaintext header, type, version, an explicit
+ * 16-bit epoch, a 48-bit sequence number and the length, so each one is
+ * opened on its own whatever was lost or reordered before it. Epoch 0 is in
+ * the clear, the others are SM4-GCM with nonce = iv xor (epoch || seq) and the
+ * header as AAD. The keys come from the TLS 1.3 traffic secrets
+ * (dtls13_record_set_traffic_secret) or from the TLCP key block
+ * (dtls_record_set_read_key, dtls_record_set_write_key).
+ *
+ * The current and the previous epoch are kept in each direction, so records
+ * of the last flight sent under the old keys are still accepted, each with its
+ * own sliding window of DTLS_REPLAY_WINDOW_SIZE sequence numbers. Records
+ * that are replayed, too old, of an unknown epoch or not authentic are
+ * dropped: dtls_record_open() returns 0 for them and the peer is not told.
+ *
+ * A DTLS_FLIGHT keeps the handshake messages of the last flight sent and
+ * seals them again, with new sequence numbers, when its timer expires. The
+ * timer starts at DTLS_FLIGHT_INITIAL_TIMEOUT milliseconds and doubles at
+ * each retransmission up to DTLS_FLIGHT_MAX_TIMEOUT. Times are given by the
+ * caller in milliseconds of any monotonic clock.
+ *
+ * The server answers a ClientHello without a valid cookie with a cookie
+ * bound to the client address and random, which the second ClientHello
+ * repeats, and keeps no state: dtls_cookie_verify() accepts it back for
+ * `max_age` seconds.
+ */
+#define DTLS_RECORD_HEADER_SIZE		13
+#define DTLS_RECORD_TAG_SIZE		16
+#define DTLS_MAX_DATAGRAM_SIZE		1500
+#define DTLS_MAX_RECORD_DATA_SIZE	(DTLS_MAX_DATAGRAM_SIZE - DTLS_RECORD_HEADER_SIZE - DTLS_RECORD_TAG_SIZE)
+#define DTLS_MAX_SEQ			((((uint64_t)1) << 48) - 1)
+#define DTLS_REPLAY_WINDOW_SIZE		64
+
+typedef struct {
+	uint64_t top; // highest sequence number accepted
+	uint64_t bitmap; // bit i is set if top - i was accepted
+	int empty;
+} DTLS_REPLAY_WINDOW;
+
+void dtls_replay_window_init(DTLS_REPLAY_WINDOW *window);
+// return 1 if seq is new, 0 if it is a replay or older than the window
+int dtls_replay_window_check(const DTLS_REPLAY_WINDOW *window, uint64_t seq);
+void dtls_replay_window_update(DTLS_REPLAY_WINDOW *window, uint64_t seq);
+
+typedef struct {
+	int valid;
+	uint16_t epoch;
+	SM4_KEY key;
+	uint8_t iv[12];
+	uint64_t seq; // write, the next sequence number
+	DTLS_REPLAY_WINDOW window; // read
+} DTLS_EPOCH;
+
+typedef struct {
+	int protocol; // TLS_protocol_dtls12 for DTLS 1.3, TLS_protocol_tlcp
+	DTLS_EPOCH write[2]; // current, previous
+	DTLS_EPOCH read[2];
+} DTLS_RECORD_CTX;
+
+int dtls_record_init(DTLS_RECORD_CTX *ctx, int protocol);
+void dtls_record_cleanup(DTLS_RECORD_CTX *ctx);
+// the new epoch is after the current one, which becomes the previous one
+int dtls_record_set_write_key(DTLS_RECORD_CTX *ctx, uint16_t epoch, const uint8_t key[16], const uint8_t iv[12]);
+int dtls_record_set_read_key(DTLS_RECORD_CTX *ctx, uint16_t epoch, const uint8_t key[16], const uint8_t iv[12]);
+int dtls13_record_set_traffic_secret(DTLS_RECORD_CTX *ctx, int is_write, uint16_t epoch, const uint8_t secret[32]);
+// `epoch` is the current or the previous write epoch, `out` has DTLS_RECORD_HEADER_SIZE + inlen + DTLS_RECORD_TAG_SIZE bytes
+int dtls_record_seal(DTLS_RECORD_CTX *ctx, uint16_t epoch, int type,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+// return 0 if the record is dropped, `out` is the record data or does not overlap the record
+int dtls_record_open(DTLS_RECORD_CTX *ctx, const uint8_t *record, size_t recordlen,
+	int *type, uint16_t *epoch, uint64_t *seq, uint8_t *out, size_t *outlen);
+// the first record of a datagram, return 0 if empty
+int dtls_record_next(const uint8_t **datagram, size_t *datagramlen, const uint8_t **record, size_t *recordlen);
+
+#define DTLS_FLIGHT_INITIAL_TIMEOUT	1000
+#define DTLS_FLIGHT_MAX_TIMEOUT		60000
+#define DTLS_FLIGHT_MAX_SIZE		(16 * 1024)
+#define DTLS_FLIGHT_MAX_MESSAGES	16
+
+typedef struct {
+	uint8_t buf[DTLS_FLIGHT_MAX_SIZE];
+	size_t buflen;
+	struct {
+		int type;
+		uint16_t epoch;
+		size_t offset;
+		size_t len;
+	} messages[DTLS_FLIGHT_MAX_MESSAGES];
+	size_t messages_cnt;
+	int sent;
+	uint64_t deadline; // 0 if the timer is stopped
+	uint32_t timeout;
+	size_t retransmissions;
+} DTLS_FLIGHT;
+
+void dtls_flight_init(DTLS_FLIGHT *flight);
+// a message of the flight being built, the flight sent before is dropped first
+int dtls_flight_add(DTLS_FLIGHT *flight, uint16_t epoch, int type, const uint8_t *msg, size_t msglen);
+// seal the messages in datagrams of at most `mtu` bytes, send them and start the timer
+int dtls_flight_send(DTLS_FLIGHT *flight, DTLS_RECORD_CTX *ctx, size_t mtu,
+	const TLS_TRANSPORT *transport, uint64_t now);
+// milliseconds until the timer expires, 0 if it has, -1 if it is stopped
+int64_t dtls_flight_timeout(const DTLS_FLIGHT *flight, uint64_t now);
+// send the flight again if the timer has expired, return 0 if not
+int dtls_flight_retransmit(DTLS_FLIGHT *flight, DTLS_RECORD_CTX *ctx, size_t mtu,
+	const TLS_TRANSPORT *transport, uint64_t now);
+// the peer answered, stop the timer and reset the timeout
+void dtls_flight_ack(DTLS_FLIGHT *flight);
+
+#define DTLS_COOKIE_SIZE	(4 + 16) // time, truncated HMAC-SM3
+
+int dtls_cookie_generate(const uint8_t secret[32], const uint8_t *addr, size_t addrlen,
+	const uint8_t client_random[32], uint32_t now, uint8_t cookie[DTLS_COOKIE_SIZE]);
+// return 1 if the cookie is valid for the client, 0 if not or if it is expired
+int dtls_cookie_verify(const uint8_t secret[32], const uint8_t *addr, size_t addrlen,
+	const uint8_t client_random[32], uint32_t now, uint32_t max_age,
+	const uint8_t *cookie, size_t cookielen);
+
+/*
+ * TLS 1.3 handshake under QUIC (RFC 9001). The handshake messages travel in
+ * the CRYPTO frames of the QUIC packets of three encryption levels instead of
+ * TLS records, and QUIC protects its packets with keys derived from the
+ * traffic secrets of the handshake.
+ *
+ * tls_quic_init() attaches a TLS_QUIC to a TLS 1.3 connection, the handshake
+ * then fails unless it selects TLS_cipher_sm4_gcm_sm3. The QUIC stack passes
+ * the CRYPTO data received at each level to tls_quic_provide_data() and calls
+ * tls_quic_do_handshake() until it returns 1, TLS_ERROR_WANT_READ asks for
+ * more data. After each call it sends what tls_quic_get_data() returns at
+ * each level and installs the secrets of tls_quic_get_secret() that have
+ * become available. The Initial level is protected with keys of the QUIC
+ * version, not from TLS. After the handshake, CRYPTO data of the application
+ * level (NewSessionTicket) is processed by tls_quic_process_post_handshake().
+ * tls_quic_get_alert() gives the alert to report in CONNECTION_CLOSE (0x100 +
+ * alert) when the handshake fails. Early data and the
+ * quic_transport_parameters extension are not supported.
+ *
+ * A TLS_QUIC_KEY protects the packets of one level and direction: SM4-GCM
+ * of the payload with the packet number in the nonce and the header as AAD,
+ * then header protection, the first byte and the packet number masked with
+ * one SM4 block of a 16-byte sample of the ciphertext.
+ * tls_quic_packets_seal() seals a batch of packets and computes all their
+ * masks in one multi-block SM4 call.
+ */
+enum {
+	TLS_QUIC_initial,
+	TLS_QUIC_handshake,
+	TLS_QUIC_application,
+	TLS_QUIC_LEVELS,
+};
+
+#define TLS_QUIC_MAX_DATA_SIZE	(2 * TLS_MAX_PLAINTEXT_SIZE) // buffered per level and direction
+
+typedef struct TLS_QUIC_st {
+	TLS_CONNECT *conn;
+	int write_level; // of the next encrypted handshake message sent
+	uint8_t *in[TLS_QUIC_LEVELS]; // received, not yet passed to the handshake
+	size_t inlen[TLS_QUIC_LEVELS];
+	uint8_t *out[TLS_QUIC_LEVELS]; // to send in CRYPTO frames
+	size_t outlen[TLS_QUIC_LEVELS];
+	uint8_t *record; // the record being read by the handshake
+	size_t recordlen;
+	size_t record_offset;
+	uint8_t secrets[TLS_QUIC_LEVELS][2][32]; // [level][is_write]
+	int secrets_set[TLS_QUIC_LEVELS][2];
+	int alert;
+} TLS_QUIC;
+
+int tls_quic_init(TLS_QUIC *quic, TLS_CONNECT *conn);
+void tls_quic_cleanup(TLS_QUIC *quic);
+int tls_quic_provide_data(TLS_QUIC *quic, int level, const uint8_t *data, size_t datalen);
+int tls_quic_do_handshake(TLS_QUIC *quic);
+int tls_quic_process_post_handshake(TLS_QUIC *quic);
+// up to `outlen` bytes to send at `level`, *len is 0 if none
+int tls_quic_get_data(TLS_QUIC *quic, int level, uint8_t *out, size_t outlen, size_t *len);
+// return 0 if the secret is not yet known
+int tls_quic_get_secret(const TLS_QUIC *quic, int level, int is_write, uint8_t secret[32]);
+// -1 if no alert is sent
+int tls_quic_get_alert(const TLS_QUIC *quic);
+// called by tls_conn_record_send() for the records of the handshake
+int tls_quic_record_send(TLS_QUIC *quic, const uint8_t *record, size_t recordlen);
+
+#define TLS_QUIC_TAG_SIZE		16
+#define TLS_QUIC_SAMPLE_SIZE		16
+#define TLS_QUIC_MAX_PN_SIZE		4
+
+typedef struct {
+	SM4_KEY key;
+	uint8_t iv[12];
+	SM4_KEY hp_key;
+} TLS_QUIC_KEY;
+
+int tls_quic_key_init(TLS_QUIC_KEY *key, const uint8_t secret[32]);
+// key update ("quic ku"), `secret` is replaced by the next one, the header protection key is kept
+int tls_quic_key_update(TLS_QUIC_KEY *key, uint8_t secret[32]);
+void tls_quic_key_cleanup(TLS_QUIC_KEY *key);
+
+typedef struct {
+	uint8_t *packet; // header || payload, with TLS_QUIC_TAG_SIZE bytes of room after the payload
+	size_t header_len; // the header ends with the packet number
+	size_t pn_len; // 1 to 4, as encoded in the first byte
+	size_t payload_len; // pn_len + payload_len at least 4 for the sample
+	uint64_t pn;
+} TLS_QUIC_PACKET;
+
+// sealed in place, the packet grows by TLS_QUIC_TAG_SIZE
+int tls_quic_packet_seal(const TLS_QUIC_KEY *key, TLS_QUIC_PACKET *packet);
+int tls_quic_packets_seal(const TLS_QUIC_KEY *key, TLS_QUIC_PACKET *packets, size_t packets_cnt);
+// opened in place, `pn_offset` from the unprotected part of the header, `largest_pn`
+// the largest packet number received in the space or -1, return 0 if the packet is dropped
+int tls_quic_packet_open(const TLS_QUIC_KEY *key, uint8_t *packet, size_t packetlen, size_t pn_offset,
+	int64_t largest_pn, uint64_t *pn, uint8_t **payload, size_t *payload_len);
+
+#ifdef ENABLE_TLS_SERVER
+/*
+ * Multi-threaded server engine (ENABLE_TLS_SERVER, Linux and Windows). Every
+ * thread has its own SO_REUSEPORT listening socket and an edge-triggered epoll
+ * loop driving non-blocking TLCP or TLS 1.3 connections, so TLS 1.2 is rejected.
+ * On Windows the threads share an I/O completion port, the connections run
+ * over a TLS_TRANSPORT fed by overlapped WSARecv() and WSASend().
+ * The handler maps each received record to a response of at most
+ * TLS_MAX_PLAINTEXT_SIZE bytes and returns 1, or 0 to close the connection.
+ * Without a handler the data is echoed. `threads` 0 means one per online CPU.
+ * Every loop is pinned to a core and reads the SM2 and SM9 generator tables
+ * from a copy on the NUMA node of that core, see <gmssl/numa.h>.
+ */
+typedef int (*TLS_SERVER_HANDLER)(void *arg, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen);
+
+typedef struct {
+	size_t connections;
+	size_t connections_active;
+	size_t handshakes;
+	size_t records_received;
+	size_t records_sent;
+	uint64_t bytes_received;
+	uint64_t bytes_sent;
+	size_t errors;
+} TLS_SERVER_STATS;
+
+typedef struct TLS_SERVER_st TLS_SERVER;
+
+TLS_SERVER *tls_server_new(const TLS_CTX *ctx, int port, size_t threads);
+int tls_server_set_handler(TLS_SERVER *server, TLS_SERVER_HANDLER handler, void *arg);
+// new connections take the current TLS_CTX of the slot, for certificate rotation without a restart
+int tls_server_set_ctx_slot(TLS_SERVER *server, TLS_CTX_SLOT *slot);
+int tls_server_get_port(const TLS_SERVER *server);
+int tls_server_start(TLS_SERVER *server);
+int tls_server_stop(TLS_SERVER *server);
+int tls_server_get_stats(const TLS_SERVER *server, TLS_SERVER_STATS *stats);
+void tls_server_free(TLS_SERVER *server);
+#endif
 
 
 int tls13_connect(TLS_CONNECT *conn, const char *hostname, int port, FILE *server_cacerts_fp,
@@ -809,11 +1980,15 @@ int tls13_extensions_print(FILE *fp, int fmt, int ind,
 	int handshake_type, const uint8_t *exts, size_t extslen);
 
 int tls13_certificate_print(FILE *fp, int fmt, int ind, const uint8_t *cert, size_t certlen);
+int tls13_compressed_certificate_print(FILE *fp, int fmt, int ind, const uint8_t *d, size_t dlen);
 int tls13_certificate_request_print(FILE *fp, int fmt, int ind, const uint8_t *cert, size_t certlen);
 int tls13_certificate_verify_print(FILE *fp, int fmt, int ind, const uint8_t *d, size_t dlen);
 int tls13_record_print(FILE *fp, int format, int indent, const uint8_t *record, size_t recordlen);
 
 
+// `in` might be `out`, the content type, padding and tag are appended to the content
+#define TLS13_GCM_TAILROOM	(1 + 16) // content type, tag
+
 int tls13_gcm_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	const uint8_t seq_num[8], int record_type,
 	const uint8_t *in, size_t inlen, size_t padding_len, // TLSInnerPlaintext.content
@@ -821,6 +1996,12 @@ int tls13_gcm_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 int tls13_gcm_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	const uint8_t seq_num[8], const uint8_t *in, size_t inlen,
 	int *record_type, uint8_t *out, size_t *outlen);
+int tls13_record_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
+	const uint8_t seq_num[8], const uint8_t *record, size_t recordlen, size_t padding_len,
+	uint8_t *enced_record, size_t *enced_recordlen);
+int tls13_record_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
+	const uint8_t seq_num[8], const uint8_t *enced_record, size_t enced_recordlen,
+	uint8_t *record, size_t *recordlen);
 
 
 #ifdef ENABLE_TLS_DEBUG
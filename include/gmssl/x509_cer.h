@@ -299,6 +299,59 @@ int x509_cert_sign_to_der(
 	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
 	uint8_t **out, size_t *outlen);
 
+/*
+ * Issue many v3 certificates under one CA key. The invariant parts of the
+ * TBSCertificate (signature algorithm, issuer name, extensions) and the SM3
+ * state after Z of the signer are prepared once by `x509_cert_issuer_init`,
+ * `x509_cert_issuer_issue` only encodes the serial number, validity, subject
+ * and public key of each certificate and signs with sm2_fast_sign on
+ * `threads` threads (<= 0 for one per CPU, capped at
+ * X509_CERT_ISSUER_MAX_THREADS). Certificate i is written to
+ * `certs + i * maxcertlen`, a failed certificate gets `certlens[i] = 0`.
+ * With `subject_key_identifier` a SubjectKeyIdentifier of the subject public
+ * key is appended to `exts` of every certificate.
+ */
+#define X509_CERT_ISSUER_MAX_NAME_SIZE	512
+#define X509_CERT_ISSUER_MAX_EXTS_SIZE	4096
+#define X509_CERT_ISSUER_MAX_THREADS	64
+
+typedef struct {
+	uint8_t alg_and_issuer[32 + X509_CERT_ISSUER_MAX_NAME_SIZE];
+	size_t alg_and_issuer_len;
+	uint8_t exts[X509_CERT_ISSUER_MAX_EXTS_SIZE];
+	size_t exts_len;
+	int subject_key_identifier;
+	SM3_CTX sm3_ctx; // after Z of the signer
+	sm2_z256_t fast_sign_private;
+	struct SM2_SIGN_POOL_st *pool; // optional, set by x509_cert_issuer_init_ex
+} X509_CERT_ISSUER;
+
+typedef struct {
+	const uint8_t *serial;
+	size_t serial_len;
+	time_t not_before;
+	time_t not_after;
+	const uint8_t *subject;
+	size_t subject_len;
+	const SM2_KEY *subject_public_key;
+} X509_CERT_ISSUE_ITEM;
+
+int x509_cert_issuer_init(X509_CERT_ISSUER *issuer,
+	const uint8_t *issuer_name, size_t issuer_name_len,
+	const uint8_t *exts, size_t exts_len, int subject_key_identifier,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len);
+#ifdef ENABLE_SM2_SIGN_POOL
+int x509_cert_issuer_init_ex(X509_CERT_ISSUER *issuer,
+	const uint8_t *issuer_name, size_t issuer_name_len,
+	const uint8_t *exts, size_t exts_len, int subject_key_identifier,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	SM2_SIGN_POOL *pool);
+#endif
+int x509_cert_issuer_issue(const X509_CERT_ISSUER *issuer,
+	const X509_CERT_ISSUE_ITEM *items, size_t count,
+	uint8_t *certs, size_t maxcertlen, size_t *certlens, int threads);
+void x509_cert_issuer_cleanup(X509_CERT_ISSUER *issuer);
+
 int x509_cert_to_der(const uint8_t *a, size_t alen, uint8_t **out, size_t *outlen);
 int x509_cert_from_der(const uint8_t **a, size_t *alen, const uint8_t **in, size_t *inlen);
 int x509_cert_to_pem(const uint8_t *a, size_t alen, FILE *fp);
@@ -323,6 +376,21 @@ int x509_cert_get_details(const uint8_t *a, size_t alen,
 	int *signature_algor,
 	const uint8_t **signature, size_t *signature_len);
 
+// TBSCertificate fields are indexed once by x509_cert_index_init() and decoded
+// only when asked for, the returned pointers refer to the certificate
+typedef struct {
+	ASN1_CURSOR tbs;
+	size_t serial_number; // index of serialNumber, 1 when version is present
+} X509_CERT_INDEX;
+
+int x509_cert_index_init(X509_CERT_INDEX *idx, const uint8_t *a, size_t alen);
+int x509_cert_index_get_serial_number(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen);
+int x509_cert_index_get_issuer(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen);
+int x509_cert_index_get_validity(const X509_CERT_INDEX *idx, time_t *not_before, time_t *not_after);
+int x509_cert_index_get_subject(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen);
+int x509_cert_index_get_subject_public_key(const X509_CERT_INDEX *idx, SM2_KEY *public_key);
+int x509_cert_index_get_exts(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen); // return 0 if no extensions
+
 
 typedef enum {
 	X509_cert_server_auth,
@@ -348,6 +416,7 @@ int x509_cert_get_issuer(const uint8_t *a, size_t alen, const uint8_t **name, si
 int x509_cert_get_subject(const uint8_t *a, size_t alen, const uint8_t **subj, size_t *subj_len);
 int x509_cert_get_subject_public_key(const uint8_t *a, size_t alen, SM2_KEY *public_key);
 int x509_cert_get_exts(const uint8_t *a, size_t alen, const uint8_t **d, size_t *dlen);
+int x509_cert_get_subject_key_identifier(const uint8_t *a, size_t alen, const uint8_t **key_id, size_t *key_id_len); // return 0 if no such extension
 
 int x509_certs_to_pem(const uint8_t *d, size_t dlen, FILE *fp);
 int x509_certs_from_pem(uint8_t *d, size_t *dlen, size_t maxlen, FILE *fp);
@@ -376,6 +445,110 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result);
 int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type,
 	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result);
+
+/*
+Read-only index of a certificate list. The subject, subjectKeyIdentifier and
+issuer+serialNumber of every certificate are hashed once by x509_store_init(),
+lookups then cost one bucket walk. The store refers to `certs`, which must be
+kept unchanged until x509_store_cleanup(). An initialized store can be shared
+by any number of threads without locking.
+*/
+typedef struct {
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *subject;
+	size_t subject_len;
+	const uint8_t *key_id; // NULL without subjectKeyIdentifier
+	size_t key_id_len;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	const uint8_t *public_key; // x || y of the SM2 key, NULL if not decoded yet
+	size_t subject_next; // index + 1 of the next entry in the bucket, 0 for the last
+	size_t key_id_next;
+	size_t issuer_serial_next;
+} X509_STORE_ENTRY;
+
+typedef struct {
+	X509_STORE_ENTRY *entries;
+	size_t entries_cnt;
+	size_t *subject_buckets; // index + 1 of the first entry, 0 for an empty bucket
+	size_t *key_id_buckets;
+	size_t *issuer_serial_buckets;
+	size_t buckets_cnt; // power of 2
+} X509_STORE;
+
+int x509_store_init(X509_STORE *store, const uint8_t *certs, size_t certslen);
+size_t x509_store_get_count(const X509_STORE *store);
+// return 0 if not found, the first certificate of the list is returned on duplicates
+int x509_store_get_cert_by_subject(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len,
+	const uint8_t **cert, size_t *certlen);
+int x509_store_get_cert_by_subject_and_key_identifier(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len,
+	const uint8_t *key_id, size_t key_id_len,
+	const uint8_t **cert, size_t *certlen);
+int x509_store_get_cert_by_issuer_and_serial_number(const X509_STORE *store,
+	const uint8_t *issuer, size_t issuer_len,
+	const uint8_t *serial, size_t serial_len,
+	const uint8_t **cert, size_t *certlen);
+// the pre-decoded key of a snapshot entry, otherwise parsed from the certificate
+int x509_store_get_public_key_by_subject(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len, SM2_KEY *public_key);
+void x509_store_cleanup(X509_STORE *store);
+
+/*
+Snapshot of a store, for the processes that load a large trust store at every
+start. The certificates are written after the entries of the index, with the
+offsets of their fields, the hash buckets and the decoded SM2 public keys, and
+an SM3 digest of the whole. x509_store_init_from_snapshot() checks the digest
+and the bounds and builds the store without any DER, PEM or key parsing, the
+store and `*certs` then refer to `snapshot`, which is usually a read-only
+mapping of the file (see file_map()). All integers are big-endian, the format
+is the same on every platform.
+
+	magic "GMSSLCAS", version, count, buckets_cnt, certslen (uint32)
+	entries[count]: cert, subject, key_id, issuer, serial (offset, length),
+		subject_next, key_id_next, issuer_serial_next, has_public_key
+		(uint32), public_key (64 bytes)
+	subject, key_id, issuer_serial buckets (uint32 each)
+	certs
+	SM3 digest of all above
+*/
+#define X509_STORE_SNAPSHOT_VERSION	1
+#define X509_STORE_SNAPSHOT_MAX_CERTS	(1 << 20)
+
+// `out` NULL to get the length only
+int x509_store_snapshot(const uint8_t *certs, size_t certslen, uint8_t *out, size_t *outlen);
+int x509_store_init_from_snapshot(X509_STORE *store, const uint8_t *snapshot, size_t snapshot_len,
+	const uint8_t **certs, size_t *certslen);
+
+// the root CA certificate is looked up in `store`, or in `rootcerts` if `store` is NULL
+int x509_certs_verify_ex(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, const X509_STORE *store,
+	int depth, int *verify_result);
+int x509_certs_verify_tlcp_ex(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, const X509_STORE *store,
+	int depth, int *verify_result);
+
+/*
+Process-wide cache of verified (certificate, issuer certificate) links, keyed by
+the SM3 digests of the two DER encodings. Only positive results signed with the
+default SM2 ID are cached, a hit is valid within both validity periods.
+*/
+#define X509_VERIFY_CACHE_SETS	256
+#define X509_VERIFY_CACHE_WAYS	4
+
+int x509_verify_cache_lookup(const uint8_t cert_dgst[32], const uint8_t cacert_dgst[32], time_t now);
+int x509_verify_cache_add(const uint8_t cert_dgst[32], const uint8_t cacert_dgst[32],
+	time_t not_before, time_t not_after);
+void x509_verify_cache_clear(void);
+void x509_verify_cache_set_enabled(int enabled);
+void x509_verify_cache_get_stats(size_t *hits, size_t *misses);
+int x509_cert_verify_by_ca_cert_cached(const uint8_t *a, size_t alen, const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len);
+
 int x509_certs_get_subjects(const uint8_t *certs, size_t certslen, uint8_t *names, size_t *nameslen);
 int x509_certs_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen);
 
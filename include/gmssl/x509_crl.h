@@ -16,6 +16,7 @@
 #include <time.h>
 #include <stdint.h>
 #include <gmssl/sm2.h>
+#include <gmssl/x509_cer.h>
 
 
 #ifdef __cplusplus
@@ -212,6 +213,8 @@ int x509_crl_exts_add_authority_info_acess(
 #define x509_crl_exts_from_der(d,dlen,in,inlen) x509_explicit_exts_from_der(0,d,dlen,in,inlen)
 int x509_crl_exts_check(const uint8_t *d, size_t dlen);
 int x509_crl_exts_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen);
+// -1 for an absent extension
+int x509_crl_exts_get_crl_number(const uint8_t *d, size_t dlen, int *crl_number, int *delta_crl_indicator);
 
 /*
 TBSCertList ::= SEQUENCE {
@@ -294,15 +297,161 @@ int x509_crl_get_revoked_certs(const uint8_t *a, size_t alen, const uint8_t **d,
 int x509_crl_find_revoked_cert_by_serial_number(const uint8_t *a, size_t alen,
 	const uint8_t *serial, size_t serial_len, time_t *revoke_date,
 	const uint8_t **entry_exts, size_t *entry_exts_len);
+int x509_crl_get_crl_number(const uint8_t *a, size_t alen, int *crl_number, int *delta_crl_indicator);
+
+
+/*
+Incremental builder of the revokedCertificates of a CRL. The RevokedCertificate
+DER are kept sorted by serial number and never re-encoded, adding an entry costs
+a copy of it, plus a memmove of the tail unless its serial number is the largest.
+`revoked_certs` is passed to x509_crl_sign_to_der as is. An unsorted initial list
+is sorted once by x509_crl_builder_init.
+*/
+typedef struct {
+	uint8_t *revoked_certs;
+	size_t revoked_certs_len;
+	size_t revoked_certs_maxlen;
+	size_t *offsets; // of every RevokedCertificate in `revoked_certs`
+	size_t entries_cnt;
+	size_t entries_maxcnt;
+} X509_CRL_BUILDER;
+
+int x509_crl_builder_init(X509_CRL_BUILDER *builder, const uint8_t *revoked_certs, size_t revoked_certs_len);
+// return 0 if the serial number is already revoked
+int x509_crl_builder_add_revoked_cert(X509_CRL_BUILDER *builder, const uint8_t *revoked_cert, size_t revoked_cert_len);
+void x509_crl_builder_cleanup(X509_CRL_BUILDER *builder);
+
+
+/*
+Sorted index over the revokedCertificates of a CRL, for many lookups against a
+large CRL. The entries point into the CRL DER, which must outlive the index.
+*/
+typedef struct {
+	const uint8_t *serial;
+	size_t serial_len;
+	const uint8_t *revoked_cert; // RevokedCertificate DER
+	size_t revoked_cert_len;
+} X509_CRL_INDEX_ENTRY;
+
+typedef struct {
+	const uint8_t *crl;
+	size_t crl_len;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	int crl_number; // -1 if not present
+	const uint8_t *delta_crl; // merged by x509_crl_index_add_delta
+	size_t delta_crl_len;
+	int delta_crl_number;
+	X509_CRL_INDEX_ENTRY *entries;
+	size_t entries_cnt;
+} X509_CRL_INDEX;
+
+int x509_crl_index_init(X509_CRL_INDEX *index, const uint8_t *crl, size_t crl_len);
+/*
+Merge a delta CRL of the indexed complete CRL. The delta must be of the same
+issuer and its BaseCRLNumber no greater than the CRLNumber of the complete CRL.
+Entries of the delta replace the entries of the same serial number, entries with
+reason removeFromCRL delete them. Delta CRLs are cumulative, only one delta can
+be merged, re-init the index for a newer delta. The delta DER must outlive the
+index. The signature of the delta is not verified.
+*/
+int x509_crl_index_add_delta(X509_CRL_INDEX *index, const uint8_t *delta_crl, size_t delta_crl_len);
+int x509_crl_index_find_revoked_cert_by_serial_number(const X509_CRL_INDEX *index,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date,
+	const uint8_t **entry_exts, size_t *entry_exts_len);
+int x509_cert_check_crl_index(const uint8_t *cert, size_t certlen, const X509_CRL_INDEX *index);
+void x509_crl_index_cleanup(X509_CRL_INDEX *index);
+
+
+/*
+Process-wide cache of the CRLs fetched from the distribution points, keyed by
+the URI. An entry is used until the nextUpdate of its CRL (X509_CRL_CACHE_TTL
+seconds after the fetch if there is no nextUpdate). A lookup in the last
+quarter of the lifetime starts a background refresh with a conditional GET, so
+only a miss or an expired entry waits for the network. The CRL is not fetched
+again within X509_CRL_CACHE_RETRY_SECONDS (or the value set) after a fetch, as
+the CRL is unlikely updated since then.
+
+x509_crl_cache_get() returns a reference to the indexed CRL, which stays valid
+until x509_crl_cache_put() even if the entry is replaced meanwhile.
+*/
+#define X509_CRL_CACHE_SIZE		32
+#define X509_CRL_CACHE_TTL		3600
+#define X509_CRL_CACHE_RETRY_SECONDS	60
+
+int x509_crl_cache_get(const char *uri, size_t urilen, const X509_CRL_INDEX **index);
+void x509_crl_cache_put(const X509_CRL_INDEX *index);
+// the result for the last CA certificate is kept with the cached CRL
+int x509_crl_cache_verify_by_ca_cert(const X509_CRL_INDEX *index, const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len);
+void x509_crl_cache_clear(void);
+void x509_crl_cache_set_enabled(int enabled);
+void x509_crl_cache_set_retry_seconds(int seconds);
+void x509_crl_cache_get_stats(size_t *hits, size_t *misses, size_t *refreshes);
 
 int x509_crls_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen);
 
+// PEM (X509 CRL) or DER encoded file
+int x509_crl_new_from_file(uint8_t **crl, size_t *crl_len, const char *file);
 int x509_crl_new_from_uri(uint8_t **crl, size_t *crl_len, const char *uri, size_t urilen);
 int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert, size_t certlen);
 int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
 	const char *ca_signer_id, size_t ca_signer_id_len);
 
 
+/*
+Batch verification of many certificate chains against one set of CA certificates.
+
+x509_batch_verifier_init() indexes `cacerts` in an X509_STORE and, with a CRL,
+indexes the CRL and verifies it by the CA certificate of its issuer, once. The
+DER buffers must be kept until x509_batch_verifier_cleanup().
+
+A chain is an entity certificate followed by its CA certificates,
+x509_chain_from_der() takes the next chain of a certificate list, a chain ends
+at a certificate not followed by its issuer. Each certificate is verified by
+the next one and the last by the store certificate of its issuer, the entity
+certificate is checked against the CRL if it is of the same issuer. Links go
+through x509_cert_verify_by_ca_cert_cached(), so intermediate CA certificates
+shared by many chains are verified once.
+
+x509_batch_verify() splits `certs` into chains, verifies them on `threads`
+threads (<= 0 for one per CPU, capped at X509_BATCH_MAX_THREADS) and sets one
+result per chain. With `results` NULL only the number of chains is returned.
+*/
+enum {
+	X509_BATCH_VERIFIED = 0,
+	X509_BATCH_PARSE_ERROR,
+	X509_BATCH_UNKNOWN_ISSUER,
+	X509_BATCH_BAD_SIGNATURE,
+	X509_BATCH_REVOKED,
+};
+
+#define X509_BATCH_MAX_THREADS	64
+
+typedef struct {
+	X509_STORE store;
+	X509_CRL_INDEX crl_index;
+	int has_crl;
+	char signer_id[SM2_MAX_ID_LENGTH + 1];
+	size_t signer_id_len;
+} X509_BATCH_VERIFIER;
+
+typedef struct {
+	const uint8_t *chain;
+	size_t chainlen;
+	int result;
+} X509_BATCH_RESULT;
+
+int x509_chain_from_der(const uint8_t **chain, size_t *chainlen, const uint8_t **in, size_t *inlen);
+int x509_batch_verifier_init(X509_BATCH_VERIFIER *verifier,
+	const uint8_t *cacerts, size_t cacertslen, const uint8_t *crl, size_t crl_len,
+	const char *signer_id, size_t signer_id_len);
+int x509_batch_verify(const X509_BATCH_VERIFIER *verifier, const uint8_t *certs, size_t certslen,
+	X509_BATCH_RESULT *results, size_t *results_cnt, size_t max_results, int threads);
+const char *x509_batch_result_name(int result);
+void x509_batch_verifier_cleanup(X509_BATCH_VERIFIER *verifier);
+
+
 #ifdef  __cplusplus
 }
 #endif
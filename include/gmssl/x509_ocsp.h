@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+
+#ifndef GMSSL_X509_OCSP_H
+#define GMSSL_X509_OCSP_H
+
+
+#include <time.h>
+#include <stdint.h>
+#include <gmssl/sm2.h>
+
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/*
+RFC 6960 OCSP, only what a TLS server needs to staple a response and a client
+to check the stapled one.
+
+CertID ::= SEQUENCE {
+	hashAlgorithm		AlgorithmIdentifier, -- sm3 (sha1 accepted with ENABLE_SHA1)
+	issuerNameHash		OCTET STRING,
+	issuerKeyHash		OCTET STRING, -- of the subjectPublicKey BIT STRING value
+	serialNumber		CertificateSerialNumber }
+
+OCSPRequest ::= SEQUENCE {
+	tbsRequest		SEQUENCE {
+		requestList		SEQUENCE OF Request { reqCert CertID } } }
+
+OCSPResponse ::= SEQUENCE {
+	responseStatus		ENUMERATED, -- successful(0)
+	responseBytes		[0] EXPLICIT SEQUENCE {
+		responseType		OBJECT IDENTIFIER, -- id-pkix-ocsp-basic
+		response		OCTET STRING } } -- BasicOCSPResponse
+
+BasicOCSPResponse ::= SEQUENCE {
+	tbsResponseData		ResponseData,
+	signatureAlgorithm	AlgorithmIdentifier,
+	signature		BIT STRING,
+	certs			[0] EXPLICIT SEQUENCE OF Certificate OPTIONAL }
+
+ResponseData ::= SEQUENCE {
+	version			[0] EXPLICIT Version DEFAULT v1,
+	responderID		CHOICE { byName [1] Name, byKey [2] KeyHash },
+	producedAt		GeneralizedTime,
+	responses		SEQUENCE OF SingleResponse,
+	responseExtensions	[1] EXPLICIT Extensions OPTIONAL }
+
+SingleResponse ::= SEQUENCE {
+	certID			CertID,
+	certStatus		CHOICE {
+		good			[0] IMPLICIT NULL,
+		revoked			[1] IMPLICIT RevokedInfo,
+		unknown			[2] IMPLICIT NULL },
+	thisUpdate		GeneralizedTime,
+	nextUpdate		[0] EXPLICIT GeneralizedTime OPTIONAL,
+	singleExtensions	[1] EXPLICIT Extensions OPTIONAL }
+
+The response is signed by the CA of the certificate, or by a responder
+certificate in `certs` issued by the CA for id-kp-OCSPSigning.
+*/
+enum {
+	X509_ocsp_cert_good	= 0,
+	X509_ocsp_cert_revoked	= 1,
+	X509_ocsp_cert_unknown	= 2,
+};
+
+#define X509_OCSP_MAX_CLOCK_SKEW	300 // seconds a thisUpdate may be ahead of the local clock
+
+const char *x509_ocsp_cert_status_name(int status);
+
+int x509_ocsp_cert_id_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	uint8_t **out, size_t *outlen);
+int x509_ocsp_request_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	uint8_t **out, size_t *outlen);
+
+// a response signed with the CA key, next_update -1 if not included
+int x509_ocsp_response_sign_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	int cert_status, time_t revocation_time, time_t this_update, time_t next_update,
+	const SM2_KEY *ca_key, const char *signer_id, size_t signer_id_len,
+	uint8_t **out, size_t *outlen);
+
+/*
+Verify the response for `cert` issued by `cacert` at `now`, return 1 with the
+status of the certificate and the validity of the response (next_update -1 if
+not given), -1 if the response is not for the certificate, badly signed or out
+of date.
+*/
+int x509_ocsp_response_verify(const uint8_t *resp, size_t resplen,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len, time_t now,
+	int *cert_status, time_t *this_update, time_t *next_update);
+
+// GET from the OCSP URI in the AuthorityInfoAccess, return 0 if there is no URI
+int x509_ocsp_response_new_from_cert(uint8_t **resp, size_t *resplen,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2014-2023 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_X509_SCAN_H
+#define GMSSL_X509_SCAN_H
+
+#include <stdio.h>
+#include <string.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*
+Certificate corpus scanning
+
+`x509_certs_scan` reads DER or PEM certificates concatenated in memory and
+writes one line per certificate with the selected fields, as CSV or JSON lines.
+The certificates are grouped into chunks of about X509_SCAN_CHUNK_SIZE bytes.
+The calling thread splits the input and writes the lines in input order. Up
+to `threads` workers (<= 0 for one per online CPU, at most X509_SCAN_MAX_THREADS)
+each take the next chunk as soon as they finish one. Fields are read through
+X509_CERT_INDEX, and only the selected ones are decoded.
+
+Only complete certificates are scanned. `*consumed` is where the next call
+continues, so a stream is scanned chunk by chunk with the tail carried over,
+as `x509_certs_scan_fp` does. A malformed certificate is counted in `*errors`
+and skipped. Broken DER framing stops the scan.
+
+Algorithms are output as dotted OIDs, `gm` is set if the signature or public
+key algorithm or the curve is under the GM/T arc 1.2.156.10197.
+*/
+#define X509_SCAN_SERIAL_NUMBER		0x0001
+#define X509_SCAN_ISSUER		0x0002
+#define X509_SCAN_SUBJECT		0x0004
+#define X509_SCAN_NOT_BEFORE		0x0008
+#define X509_SCAN_NOT_AFTER		0x0010
+#define X509_SCAN_SIGNATURE_ALGOR	0x0020
+#define X509_SCAN_PUBLIC_KEY_ALGOR	0x0040
+#define X509_SCAN_PUBLIC_KEY_PARAM	0x0080
+#define X509_SCAN_GM			0x0100
+#define X509_SCAN_ALL_FIELDS		0x01ff
+
+enum {
+	X509_SCAN_DER,
+	X509_SCAN_PEM,
+};
+
+enum {
+	X509_SCAN_CSV,
+	X509_SCAN_JSON,
+};
+
+#define X509_SCAN_CHUNK_SIZE		(64 * 1024)
+#define X509_SCAN_MAX_CERT_SIZE		(64 * 1024) // of a PEM certificate after decoding
+#define X509_SCAN_MAX_THREADS		64
+
+// comma separated names: serial, issuer, subject, not_before, not_after,
+// sig_alg, key_alg, key_param, gm, or all
+int x509_scan_fields_from_names(const char *names, int *fields);
+int x509_scan_print_header(FILE *fp, int fields, int out_format); // CSV only
+
+int x509_certs_scan(const uint8_t *in, size_t inlen, int in_format,
+	int fields, int out_format, FILE *out, int threads,
+	size_t *consumed, size_t *certs_cnt, size_t *errors_cnt);
+int x509_certs_scan_fp(FILE *in, int in_format,
+	int fields, int out_format, FILE *out, int threads,
+	size_t *certs_cnt, size_t *errors_cnt);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -37,6 +37,8 @@ typedef struct {
 } ZUC_STATE;
 
 void zuc_init(ZUC_STATE *state, const uint8_t key[ZUC_KEY_SIZE], const uint8_t iv[ZUC_IV_SIZE]);
+// load the LFSR only, the 32 initialisation rounds are left to the multi-lane kernels
+void zuc_load_key(ZUC_STATE *state, const uint8_t key[ZUC_KEY_SIZE], const uint8_t iv[ZUC_IV_SIZE]);
 void zuc_generate_keystream(ZUC_STATE *state, size_t nwords, ZUC_UINT32 *words);
 ZUC_UINT32 zuc_generate_keyword(ZUC_STATE *state);
 void zuc_encrypt(ZUC_STATE *state, const uint8_t *in, size_t inlen, uint8_t *out);
@@ -55,6 +57,18 @@ void zuc_mac_init(ZUC_MAC_CTX *ctx, const uint8_t key[ZUC_KEY_SIZE], const uint8
 void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len);
 void zuc_mac_finish(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t mac[ZUC_MAC_SIZE]);
 
+// xor of the 32-bit keystream windows at the set bits of nwords big-endian message
+// words, keystream[j] is aligned with the j-th word, nwords + 1 keystream words
+ZUC_UINT32 zuc_mac_words(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream);
+
+#ifdef ENABLE_ZUC_PCLMUL
+ZUC_UINT32 zuc_mac_words_pclmul(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream);
+#endif
+
+#ifdef ENABLE_ZUC_PMULL
+ZUC_UINT32 zuc_mac_words_pmull(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream);
+#endif
+
 #define ZUC_EEA_ENCRYPT_NWORDS(nbits) ((nbits + 31)/32)
 #define ZUC_EEA_ENCRYPT_NBYTES(nbits) (ZUC_EEA_ENCRYPT_NWORDS(nbits)*4)
 void zuc_eea_encrypt(const ZUC_UINT32 *in, ZUC_UINT32 *out, size_t nbits,
@@ -64,6 +78,25 @@ ZUC_UINT32 zuc_eia_generate_mac(const ZUC_UINT32 *data, size_t nbits,
 	const uint8_t key[ZUC_KEY_SIZE], ZUC_UINT32 count, ZUC_UINT5 bearer,
 	ZUC_BIT direction);
 
+/*
+Batch EEA3/EIA3 of independent packets, each with its own key, count, bearer and
+direction. The ZUC states of up to 16 packets run in lockstep in the SIMD lanes.
+zuc_eea_encrypt_packets writes out = EEA3(in), zuc_eia_generate_mac_packets
+writes the EIA3 MAC of in to macs[i] and ignores out.
+*/
+typedef struct {
+	const uint8_t *key;
+	ZUC_UINT32 count;
+	ZUC_UINT5 bearer;
+	ZUC_BIT direction;
+	const ZUC_UINT32 *in;
+	ZUC_UINT32 *out;
+	size_t nbits;
+} ZUC_PACKET;
+
+void zuc_eea_encrypt_packets(const ZUC_PACKET *packets, size_t npackets);
+void zuc_eia_generate_mac_packets(const ZUC_PACKET *packets, size_t npackets, ZUC_UINT32 *macs);
+
 
 # define ZUC256_KEY_SIZE	32
 # define ZUC256_IV_SIZE		23
@@ -76,8 +109,12 @@ ZUC_UINT32 zuc_eia_generate_mac(const ZUC_UINT32 *data, size_t nbits,
 typedef ZUC_STATE ZUC256_STATE;
 
 void zuc256_init(ZUC256_STATE *state, const uint8_t key[ZUC256_KEY_SIZE], const uint8_t iv[ZUC256_IV_SIZE]);
+void zuc256_load_key(ZUC256_STATE *state, const uint8_t key[ZUC256_KEY_SIZE], const uint8_t iv[ZUC256_IV_SIZE]);
 void zuc256_generate_keystream(ZUC_STATE *state, size_t nwords, ZUC_UINT32 *words);
 ZUC_UINT32 zuc256_generate_keyword(ZUC_STATE *state);
+// outs[i] = ZUC-256(keys[i], ivs[i]) xor ins[i] as zuc_encrypt, in the SIMD lanes
+void zuc256_encrypt_batch(const uint8_t *const *keys, const uint8_t *const *ivs,
+	const uint8_t *const *ins, const size_t *inlens, uint8_t *const *outs, size_t num);
 
 
 typedef struct ZUC256_MAC_CTX_st {
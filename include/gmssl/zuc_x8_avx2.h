@@ -0,0 +1,31 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifndef GMSSL_ZUC_X8_AVX2_H
+#define GMSSL_ZUC_X8_AVX2_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <gmssl/zuc.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// the i-th lane runs state[i], with init the 32 initialisation rounds of a state
+// set by zuc_load_key or zuc256_load_key run first, keystream[word * 8 + lane], needs AVX2
+void zuc_x8_generate_keystream_lanes(ZUC_STATE state[8], int init, size_t nwords, uint32_t *keystream);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
@@ -15,6 +15,7 @@
 #include <gmssl/aes.h>
 #include <gmssl/endian.h>
 #include <gmssl/mem.h>
+#include <gmssl/cpu.h>
 
 
 static const uint8_t S[256] = {
@@ -362,7 +363,7 @@ static void print_state(const uint8_t S[4][4])
 }
 #endif
 
-void aes_encrypt(const AES_KEY *key, const uint8_t in[16], uint8_t out[16])
+static void aes_generic_encrypt(const AES_KEY *key, const uint8_t in[16], uint8_t out[16])
 {
 	uint8_t state[4][4];
 	size_t i;
@@ -402,7 +403,7 @@ void aes_encrypt(const AES_KEY *key, const uint8_t in[16], uint8_t out[16])
 	memset(state, 0, sizeof(state));
 }
 
-void aes_decrypt(const AES_KEY *aes_key, const uint8_t in[16], uint8_t out[16])
+static void aes_generic_decrypt(const AES_KEY *aes_key, const uint8_t in[16], uint8_t out[16])
 {
 	uint8_t state[4][4];
 	size_t i;
@@ -441,3 +442,129 @@ void aes_decrypt(const AES_KEY *aes_key, const uint8_t in[16], uint8_t out[16])
 
 	memset(state, 0, sizeof(state));
 }
+
+static void aes_generic_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	while (nblocks--) {
+		aes_generic_encrypt(key, in, out);
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+}
+
+static void aes_generic_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	while (nblocks--) {
+		aes_generic_decrypt(key, in, out);
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+}
+
+static void aes_generic_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16];
+	uint32_t c3 = GETU32(ctr + 12);
+
+	while (nblocks--) {
+		aes_generic_encrypt(key, ctr, block);
+		gmssl_memxor(out, in, block, AES_BLOCK_SIZE);
+		c3++;
+		PUTU32(ctr + 12, c3);
+		in += AES_BLOCK_SIZE;
+		out += AES_BLOCK_SIZE;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+
+/*
+ * Runtime selection of the block kernels
+ *
+ * The backends enabled at build time (ENABLE_AES_AESNI, ENABLE_AES_VAES,
+ * ENABLE_AES_CE) are chosen once by `gmssl_cpu_features`, the code above is
+ * the fallback. `aes_encrypt` and `aes_decrypt` go through the same kernels
+ * with one block, so CBC encryption and the other modes use them too.
+ */
+
+typedef void (*aes_encrypt_blocks_func)(const AES_KEY *key,
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+typedef void (*aes_ctr32_encrypt_blocks_func)(const AES_KEY *key,
+	uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+
+static aes_encrypt_blocks_func aes_encrypt_blocks_impl = NULL;
+static aes_encrypt_blocks_func aes_decrypt_blocks_impl = NULL;
+static aes_ctr32_encrypt_blocks_func aes_ctr32_encrypt_blocks_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void aes_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	aes_encrypt_blocks_func encrypt_blocks = aes_generic_encrypt_blocks;
+	aes_encrypt_blocks_func decrypt_blocks = aes_generic_decrypt_blocks;
+	aes_ctr32_encrypt_blocks_func ctr32_encrypt_blocks = aes_generic_ctr32_encrypt_blocks;
+
+	(void)cpu;
+
+#ifdef ENABLE_AES_CE
+	if (cpu & GMSSL_CPU_ARM_AES) {
+		encrypt_blocks = aes_ce_encrypt_blocks;
+		decrypt_blocks = aes_ce_decrypt_blocks;
+		ctr32_encrypt_blocks = aes_ce_ctr32_encrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_AES_AESNI
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) {
+		encrypt_blocks = aes_aesni_encrypt_blocks;
+		decrypt_blocks = aes_aesni_decrypt_blocks;
+		ctr32_encrypt_blocks = aes_aesni_ctr32_encrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_AES_VAES
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_VAES))
+		== (GMSSL_CPU_AESNI|GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_VAES)) {
+		encrypt_blocks = aes_vaes_encrypt_blocks;
+		ctr32_encrypt_blocks = aes_vaes_ctr32_encrypt_blocks;
+	}
+#endif
+
+	aes_ctr32_encrypt_blocks_impl = ctr32_encrypt_blocks;
+	aes_decrypt_blocks_impl = decrypt_blocks;
+	aes_encrypt_blocks_impl = encrypt_blocks;
+}
+
+void aes_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!aes_encrypt_blocks_impl) {
+		aes_dispatch_init();
+	}
+	aes_encrypt_blocks_impl(key, in, nblocks, out);
+}
+
+void aes_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!aes_decrypt_blocks_impl) {
+		aes_dispatch_init();
+	}
+	aes_decrypt_blocks_impl(key, in, nblocks, out);
+}
+
+void aes_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!aes_ctr32_encrypt_blocks_impl) {
+		aes_dispatch_init();
+	}
+	aes_ctr32_encrypt_blocks_impl(key, ctr, in, nblocks, out);
+}
+
+void aes_encrypt(const AES_KEY *key, const uint8_t in[16], uint8_t out[16])
+{
+	aes_encrypt_blocks(key, in, 1, out);
+}
+
+void aes_decrypt(const AES_KEY *key, const uint8_t in[16], uint8_t out[16])
+{
+	aes_decrypt_blocks(key, in, 1, out);
+}
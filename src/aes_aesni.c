@@ -0,0 +1,234 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * AES with AES-NI
+ *
+ * The round keys of AES_KEY are big-endian words, they are byte-swapped into
+ * the AES-NI layout once per call. aesenc/aesdec have a latency of several
+ * cycles but a throughput of one or two per cycle, so eight independent
+ * blocks are kept in flight. aesdec expects the round keys of the equivalent
+ * inverse cipher, the inner keys of the decryption key are passed through
+ * aesimc.
+ */
+
+#include <gmssl/aes.h>
+#include <gmssl/mem.h>
+#include <immintrin.h>
+
+
+#define BSWAP32_MASK	_mm_set_epi8(12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3)
+#define BSWAP128_MASK	_mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)
+
+static void aes_aesni_load_key(const AES_KEY *key, __m128i rk[AES_MAX_ROUNDS + 1])
+{
+	size_t i;
+
+	for (i = 0; i <= key->rounds; i++) {
+		rk[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(key->rk + 4 * i)), BSWAP32_MASK);
+	}
+}
+
+static void aes_aesni_load_decrypt_key(const AES_KEY *key, __m128i rk[AES_MAX_ROUNDS + 1])
+{
+	size_t i;
+
+	aes_aesni_load_key(key, rk);
+	for (i = 1; i < key->rounds; i++) {
+		rk[i] = _mm_aesimc_si128(rk[i]);
+	}
+}
+
+#define AESNI_ROUND8(op, k)			\
+	b0 = op(b0, k); b1 = op(b1, k);		\
+	b2 = op(b2, k); b3 = op(b3, k);		\
+	b4 = op(b4, k); b5 = op(b5, k);		\
+	b6 = op(b6, k); b7 = op(b7, k)
+
+#define AESNI_XOR8(k)				\
+	b0 = _mm_xor_si128(b0, k); b1 = _mm_xor_si128(b1, k);	\
+	b2 = _mm_xor_si128(b2, k); b3 = _mm_xor_si128(b3, k);	\
+	b4 = _mm_xor_si128(b4, k); b5 = _mm_xor_si128(b5, k);	\
+	b6 = _mm_xor_si128(b6, k); b7 = _mm_xor_si128(b7, k)
+
+#define AESNI_ENCRYPT8(rk, rounds)				\
+	do {							\
+		size_t r_;					\
+		AESNI_XOR8(rk[0]);				\
+		for (r_ = 1; r_ < (rounds); r_++) {		\
+			AESNI_ROUND8(_mm_aesenc_si128, rk[r_]);	\
+		}						\
+		AESNI_ROUND8(_mm_aesenclast_si128, rk[r_]);	\
+	} while (0)
+
+#define AESNI_DECRYPT8(rk, rounds)				\
+	do {							\
+		size_t r_;					\
+		AESNI_XOR8(rk[0]);				\
+		for (r_ = 1; r_ < (rounds); r_++) {		\
+			AESNI_ROUND8(_mm_aesdec_si128, rk[r_]);	\
+		}						\
+		AESNI_ROUND8(_mm_aesdeclast_si128, rk[r_]);	\
+	} while (0)
+
+#define AESNI_LOAD8(p)						\
+	b0 = _mm_loadu_si128((const __m128i *)((p)      ));	\
+	b1 = _mm_loadu_si128((const __m128i *)((p) +  16));	\
+	b2 = _mm_loadu_si128((const __m128i *)((p) +  32));	\
+	b3 = _mm_loadu_si128((const __m128i *)((p) +  48));	\
+	b4 = _mm_loadu_si128((const __m128i *)((p) +  64));	\
+	b5 = _mm_loadu_si128((const __m128i *)((p) +  80));	\
+	b6 = _mm_loadu_si128((const __m128i *)((p) +  96));	\
+	b7 = _mm_loadu_si128((const __m128i *)((p) + 112))
+
+#define AESNI_STORE8(p)					\
+	_mm_storeu_si128((__m128i *)((p)      ), b0);	\
+	_mm_storeu_si128((__m128i *)((p) +  16), b1);	\
+	_mm_storeu_si128((__m128i *)((p) +  32), b2);	\
+	_mm_storeu_si128((__m128i *)((p) +  48), b3);	\
+	_mm_storeu_si128((__m128i *)((p) +  64), b4);	\
+	_mm_storeu_si128((__m128i *)((p) +  80), b5);	\
+	_mm_storeu_si128((__m128i *)((p) +  96), b6);	\
+	_mm_storeu_si128((__m128i *)((p) + 112), b7)
+
+static __m128i aes_aesni_encrypt1(const __m128i rk[AES_MAX_ROUNDS + 1], size_t rounds, __m128i b)
+{
+	size_t r;
+
+	b = _mm_xor_si128(b, rk[0]);
+	for (r = 1; r < rounds; r++) {
+		b = _mm_aesenc_si128(b, rk[r]);
+	}
+	return _mm_aesenclast_si128(b, rk[r]);
+}
+
+static __m128i aes_aesni_decrypt1(const __m128i rk[AES_MAX_ROUNDS + 1], size_t rounds, __m128i b)
+{
+	size_t r;
+
+	b = _mm_xor_si128(b, rk[0]);
+	for (r = 1; r < rounds; r++) {
+		b = _mm_aesdec_si128(b, rk[r]);
+	}
+	return _mm_aesdeclast_si128(b, rk[r]);
+}
+
+void aes_aesni_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	__m128i rk[AES_MAX_ROUNDS + 1];
+	__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+
+	aes_aesni_load_key(key, rk);
+
+	while (nblocks >= 8) {
+		AESNI_LOAD8(in);
+		AESNI_ENCRYPT8(rk, key->rounds);
+		AESNI_STORE8(out);
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		b0 = _mm_loadu_si128((const __m128i *)in);
+		b0 = aes_aesni_encrypt1(rk, key->rounds, b0);
+		_mm_storeu_si128((__m128i *)out, b0);
+		in += 16;
+		out += 16;
+	}
+	gmssl_secure_clear(rk, sizeof(rk));
+}
+
+// `key` is the decryption key of `aes_set_decrypt_key`
+void aes_aesni_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	__m128i rk[AES_MAX_ROUNDS + 1];
+	__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+
+	aes_aesni_load_decrypt_key(key, rk);
+
+	while (nblocks >= 8) {
+		AESNI_LOAD8(in);
+		AESNI_DECRYPT8(rk, key->rounds);
+		AESNI_STORE8(out);
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		b0 = _mm_loadu_si128((const __m128i *)in);
+		b0 = aes_aesni_decrypt1(rk, key->rounds, b0);
+		_mm_storeu_si128((__m128i *)out, b0);
+		in += 16;
+		out += 16;
+	}
+	gmssl_secure_clear(rk, sizeof(rk));
+}
+
+/*
+ * The counter block is kept byte-reversed, so the big-endian 32-bit counter
+ * of bytes 12..15 is lane 0 and inc32() is a 32-bit add.
+ */
+void aes_aesni_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	const __m128i bswap = BSWAP128_MASK;
+	const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+	const __m128i eight = _mm_set_epi32(0, 0, 0, 8);
+	__m128i rk[AES_MAX_ROUNDS + 1];
+	__m128i b0, b1, b2, b3, b4, b5, b6, b7;
+	__m128i c, c1, c2, c3, c4, c5, c6, c7;
+
+	aes_aesni_load_key(key, rk);
+	c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ctr), bswap);
+
+	while (nblocks >= 8) {
+		c1 = _mm_add_epi32(c, one);
+		c2 = _mm_add_epi32(c1, one);
+		c3 = _mm_add_epi32(c2, one);
+		c4 = _mm_add_epi32(c3, one);
+		c5 = _mm_add_epi32(c4, one);
+		c6 = _mm_add_epi32(c5, one);
+		c7 = _mm_add_epi32(c6, one);
+		b0 = _mm_shuffle_epi8(c, bswap);
+		b1 = _mm_shuffle_epi8(c1, bswap);
+		b2 = _mm_shuffle_epi8(c2, bswap);
+		b3 = _mm_shuffle_epi8(c3, bswap);
+		b4 = _mm_shuffle_epi8(c4, bswap);
+		b5 = _mm_shuffle_epi8(c5, bswap);
+		b6 = _mm_shuffle_epi8(c6, bswap);
+		b7 = _mm_shuffle_epi8(c7, bswap);
+		c = _mm_add_epi32(c, eight);
+
+		AESNI_ENCRYPT8(rk, key->rounds);
+
+		b0 = _mm_xor_si128(b0, _mm_loadu_si128((const __m128i *)(in      )));
+		b1 = _mm_xor_si128(b1, _mm_loadu_si128((const __m128i *)(in +  16)));
+		b2 = _mm_xor_si128(b2, _mm_loadu_si128((const __m128i *)(in +  32)));
+		b3 = _mm_xor_si128(b3, _mm_loadu_si128((const __m128i *)(in +  48)));
+		b4 = _mm_xor_si128(b4, _mm_loadu_si128((const __m128i *)(in +  64)));
+		b5 = _mm_xor_si128(b5, _mm_loadu_si128((const __m128i *)(in +  80)));
+		b6 = _mm_xor_si128(b6, _mm_loadu_si128((const __m128i *)(in +  96)));
+		b7 = _mm_xor_si128(b7, _mm_loadu_si128((const __m128i *)(in + 112)));
+		AESNI_STORE8(out);
+
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		b0 = aes_aesni_encrypt1(rk, key->rounds, _mm_shuffle_epi8(c, bswap));
+		b0 = _mm_xor_si128(b0, _mm_loadu_si128((const __m128i *)in));
+		_mm_storeu_si128((__m128i *)out, b0);
+		c = _mm_add_epi32(c, one);
+		in += 16;
+		out += 16;
+	}
+
+	_mm_storeu_si128((__m128i *)ctr, _mm_shuffle_epi8(c, bswap));
+	gmssl_secure_clear(rk, sizeof(rk));
+}
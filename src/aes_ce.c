@@ -0,0 +1,212 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * AES with the ARMv8 Crypto Extensions
+ *
+ * AESE is AddRoundKey + SubBytes + ShiftRows and AESMC is MixColumns, so a
+ * round is AESE(k_i) + AESMC and the last key is a plain xor. AESD + AESIMC
+ * do the equivalent inverse cipher, the inner keys of the decryption key are
+ * passed through AESIMC. Eight blocks are kept in flight, as in aes_aesni.c.
+ */
+
+#include <arm_neon.h>
+#include <gmssl/aes.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+
+
+static void aes_ce_load_key(const AES_KEY *key, uint8x16_t rk[AES_MAX_ROUNDS + 1])
+{
+	size_t i;
+
+	for (i = 0; i <= key->rounds; i++) {
+		rk[i] = vrev32q_u8(vreinterpretq_u8_u32(vld1q_u32(key->rk + 4 * i)));
+	}
+}
+
+static void aes_ce_load_decrypt_key(const AES_KEY *key, uint8x16_t rk[AES_MAX_ROUNDS + 1])
+{
+	size_t i;
+
+	aes_ce_load_key(key, rk);
+	for (i = 1; i < key->rounds; i++) {
+		rk[i] = vaesimcq_u8(rk[i]);
+	}
+}
+
+#define AES_CE_ROUND8(aes, mc, k)						\
+	b0 = mc(aes(b0, k)); b1 = mc(aes(b1, k));				\
+	b2 = mc(aes(b2, k)); b3 = mc(aes(b3, k));				\
+	b4 = mc(aes(b4, k)); b5 = mc(aes(b5, k));				\
+	b6 = mc(aes(b6, k)); b7 = mc(aes(b7, k))
+
+#define AES_CE_LAST8(aes, k, kn)						\
+	b0 = veorq_u8(aes(b0, k), kn); b1 = veorq_u8(aes(b1, k), kn);		\
+	b2 = veorq_u8(aes(b2, k), kn); b3 = veorq_u8(aes(b3, k), kn);		\
+	b4 = veorq_u8(aes(b4, k), kn); b5 = veorq_u8(aes(b5, k), kn);		\
+	b6 = veorq_u8(aes(b6, k), kn); b7 = veorq_u8(aes(b7, k), kn)
+
+#define AES_CE_ENCRYPT8(rk, rounds)					\
+	do {								\
+		size_t r_;						\
+		for (r_ = 0; r_ < (rounds) - 1; r_++) {			\
+			AES_CE_ROUND8(vaeseq_u8, vaesmcq_u8, rk[r_]);	\
+		}							\
+		AES_CE_LAST8(vaeseq_u8, rk[r_], rk[r_ + 1]);		\
+	} while (0)
+
+#define AES_CE_DECRYPT8(rk, rounds)					\
+	do {								\
+		size_t r_;						\
+		for (r_ = 0; r_ < (rounds) - 1; r_++) {			\
+			AES_CE_ROUND8(vaesdq_u8, vaesimcq_u8, rk[r_]);	\
+		}							\
+		AES_CE_LAST8(vaesdq_u8, rk[r_], rk[r_ + 1]);		\
+	} while (0)
+
+#define AES_CE_LOAD8(p)				\
+	b0 = vld1q_u8((p)      );		\
+	b1 = vld1q_u8((p) +  16);		\
+	b2 = vld1q_u8((p) +  32);		\
+	b3 = vld1q_u8((p) +  48);		\
+	b4 = vld1q_u8((p) +  64);		\
+	b5 = vld1q_u8((p) +  80);		\
+	b6 = vld1q_u8((p) +  96);		\
+	b7 = vld1q_u8((p) + 112)
+
+#define AES_CE_STORE8(p)			\
+	vst1q_u8((p)      , b0);		\
+	vst1q_u8((p) +  16, b1);		\
+	vst1q_u8((p) +  32, b2);		\
+	vst1q_u8((p) +  48, b3);		\
+	vst1q_u8((p) +  64, b4);		\
+	vst1q_u8((p) +  80, b5);		\
+	vst1q_u8((p) +  96, b6);		\
+	vst1q_u8((p) + 112, b7)
+
+static uint8x16_t aes_ce_encrypt1(const uint8x16_t rk[AES_MAX_ROUNDS + 1], size_t rounds, uint8x16_t b)
+{
+	size_t r;
+
+	for (r = 0; r < rounds - 1; r++) {
+		b = vaesmcq_u8(vaeseq_u8(b, rk[r]));
+	}
+	return veorq_u8(vaeseq_u8(b, rk[r]), rk[r + 1]);
+}
+
+static uint8x16_t aes_ce_decrypt1(const uint8x16_t rk[AES_MAX_ROUNDS + 1], size_t rounds, uint8x16_t b)
+{
+	size_t r;
+
+	for (r = 0; r < rounds - 1; r++) {
+		b = vaesimcq_u8(vaesdq_u8(b, rk[r]));
+	}
+	return veorq_u8(vaesdq_u8(b, rk[r]), rk[r + 1]);
+}
+
+void aes_ce_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8x16_t rk[AES_MAX_ROUNDS + 1];
+	uint8x16_t b0, b1, b2, b3, b4, b5, b6, b7;
+
+	aes_ce_load_key(key, rk);
+
+	while (nblocks >= 8) {
+		AES_CE_LOAD8(in);
+		AES_CE_ENCRYPT8(rk, key->rounds);
+		AES_CE_STORE8(out);
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		vst1q_u8(out, aes_ce_encrypt1(rk, key->rounds, vld1q_u8(in)));
+		in += 16;
+		out += 16;
+	}
+	gmssl_secure_clear(rk, sizeof(rk));
+}
+
+// `key` is the decryption key of `aes_set_decrypt_key`
+void aes_ce_decrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8x16_t rk[AES_MAX_ROUNDS + 1];
+	uint8x16_t b0, b1, b2, b3, b4, b5, b6, b7;
+
+	aes_ce_load_decrypt_key(key, rk);
+
+	while (nblocks >= 8) {
+		AES_CE_LOAD8(in);
+		AES_CE_DECRYPT8(rk, key->rounds);
+		AES_CE_STORE8(out);
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		vst1q_u8(out, aes_ce_decrypt1(rk, key->rounds, vld1q_u8(in)));
+		in += 16;
+		out += 16;
+	}
+	gmssl_secure_clear(rk, sizeof(rk));
+}
+
+// the 32-bit counter is kept in a general register, lane 3 of the block is its big-endian form
+void aes_ce_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8x16_t rk[AES_MAX_ROUNDS + 1];
+	uint8x16_t b0, b1, b2, b3, b4, b5, b6, b7;
+	uint32x4_t c = vld1q_u32((const uint32_t *)ctr);
+	uint32_t n = GETU32(ctr + 12);
+
+#define AES_CE_CTR(i) \
+	vreinterpretq_u8_u32(vsetq_lane_u32(__builtin_bswap32(n + (i)), c, 3))
+
+	aes_ce_load_key(key, rk);
+
+	while (nblocks >= 8) {
+		b0 = AES_CE_CTR(0);
+		b1 = AES_CE_CTR(1);
+		b2 = AES_CE_CTR(2);
+		b3 = AES_CE_CTR(3);
+		b4 = AES_CE_CTR(4);
+		b5 = AES_CE_CTR(5);
+		b6 = AES_CE_CTR(6);
+		b7 = AES_CE_CTR(7);
+		n += 8;
+
+		AES_CE_ENCRYPT8(rk, key->rounds);
+
+		b0 = veorq_u8(b0, vld1q_u8(in      ));
+		b1 = veorq_u8(b1, vld1q_u8(in +  16));
+		b2 = veorq_u8(b2, vld1q_u8(in +  32));
+		b3 = veorq_u8(b3, vld1q_u8(in +  48));
+		b4 = veorq_u8(b4, vld1q_u8(in +  64));
+		b5 = veorq_u8(b5, vld1q_u8(in +  80));
+		b6 = veorq_u8(b6, vld1q_u8(in +  96));
+		b7 = veorq_u8(b7, vld1q_u8(in + 112));
+		AES_CE_STORE8(out);
+
+		in += 128;
+		out += 128;
+		nblocks -= 8;
+	}
+	while (nblocks--) {
+		b0 = aes_ce_encrypt1(rk, key->rounds, AES_CE_CTR(0));
+		vst1q_u8(out, veorq_u8(b0, vld1q_u8(in)));
+		n++;
+		in += 16;
+		out += 16;
+	}
+#undef AES_CE_CTR
+
+	PUTU32(ctr + 12, n);
+	gmssl_secure_clear(rk, sizeof(rk));
+}
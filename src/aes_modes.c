@@ -30,16 +30,33 @@ void aes_cbc_encrypt(const AES_KEY *key, const uint8_t iv[16],
 	}
 }
 
+// the blocks are decrypted in batches, the chaining runs backwards so that `in` == `out` works
 void aes_cbc_decrypt(const AES_KEY *key, const uint8_t iv[16],
 	const uint8_t *in, size_t nblocks, uint8_t *out)
 {
-	while (nblocks--) {
-		aes_decrypt(key, in, out);
-		memxor(out, iv, 16);
-		iv = in;
-		in += 16;
-		out += 16;
+	uint8_t block[16 * 8];
+	uint8_t prev[16];
+	size_t nb, len, i;
+
+	memcpy(prev, iv, 16);
+
+	while (nblocks) {
+		nb = nblocks < 8 ? nblocks : 8;
+		len = 16 * nb;
+
+		aes_decrypt_blocks(key, in, nb, block);
+		for (i = len; i > 16; i--) {
+			block[i - 1] ^= in[i - 17];
+		}
+		gmssl_memxor(block, block, prev, 16);
+		memcpy(prev, in + len - 16, 16);
+		memcpy(out, block, len);
+
+		in += len;
+		out += len;
+		nblocks -= nb;
 	}
+	gmssl_secure_clear(block, sizeof(block));
 }
 
 int aes_cbc_padding_encrypt(const AES_KEY *key, const uint8_t iv[16],
@@ -122,6 +139,7 @@ void aes_ctr_encrypt(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, siz
 }
 
 
+// inc32() in nist-sp800-38d
 static void ctr32_incr(uint8_t a[16])
 {
 	int i;
@@ -134,13 +152,42 @@ static void ctr32_incr(uint8_t a[16])
 static void aes_ctr32_encrypt(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t inlen, uint8_t *out)
 {
 	uint8_t block[16];
-	size_t len;
+	size_t nblocks = inlen / 16;
 
-	while (inlen) {
-		len = inlen < 16 ? inlen : 16;
+	aes_ctr32_encrypt_blocks(key, ctr, in, nblocks, out);
+	in += 16 * nblocks;
+	out += 16 * nblocks;
+	inlen %= 16;
+
+	if (inlen) {
 		aes_encrypt(key, ctr, block);
-		gmssl_memxor(out, in, block, len);
+		gmssl_memxor(out, in, block, inlen);
 		ctr32_incr(ctr);
+		gmssl_secure_clear(block, sizeof(block));
+	}
+}
+
+/*
+ * CTR and GHASH are stitched over chunks of AES_GCM_STITCH_SIZE bytes, as in
+ * sm4_gcm.c, so the data is streamed from memory only once. The chunk is
+ * large enough for the 8/16-block AES and 8-block GHASH kernels.
+ */
+#define AES_GCM_STITCH_SIZE	1024
+
+static void aes_gcm_ctr32_ghash(const AES_KEY *key, uint8_t ctr[16], GHASH_CTX *ghash_ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, int enc)
+{
+	while (inlen) {
+		size_t len = inlen < AES_GCM_STITCH_SIZE ? inlen : AES_GCM_STITCH_SIZE;
+
+		if (enc) {
+			aes_ctr32_encrypt(key, ctr, in, len, out);
+			ghash_update(ghash_ctx, out, len);
+		} else {
+			// hash the ciphertext first, `in` might be `out`
+			ghash_update(ghash_ctx, in, len);
+			aes_ctr32_encrypt(key, ctr, in, len, out);
+		}
 		in += len;
 		out += len;
 		inlen -= len;
@@ -151,9 +198,7 @@ int aes_gcm_encrypt(const AES_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t taglen, uint8_t *tag)
 {
-	const uint8_t *pin = in;
-	uint8_t *pout = out;
-	size_t left = inlen;
+	GHASH_CTX ghash_ctx;
 	uint8_t H[16] = {0};
 	uint8_t Y[16];
 	uint8_t T[16];
@@ -175,11 +220,15 @@ int aes_gcm_encrypt(const AES_KEY *key, const uint8_t *iv, size_t ivlen,
 
 	aes_encrypt(key, Y, T);
 
+	ghash_init(&ghash_ctx, H, aad, aadlen);
 	ctr32_incr(Y);
-	aes_ctr32_encrypt(key, Y, in, inlen, out);
+	aes_gcm_ctr32_ghash(key, Y, &ghash_ctx, in, inlen, out, 1);
+	ghash_finish(&ghash_ctx, H);
 
-	ghash(H, aad, aadlen, out, inlen, H);
 	gmssl_memxor(tag, T, H, taglen);
+
+	gmssl_secure_clear(H, sizeof(H));
+	gmssl_secure_clear(T, sizeof(T));
 	return 1;
 }
 
@@ -187,13 +236,16 @@ int aes_gcm_decrypt(const AES_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out)
 {
-	const uint8_t *pin = in;
-	uint8_t *pout = out;
-	size_t left = inlen;
+	GHASH_CTX ghash_ctx;
 	uint8_t H[16] = {0};
 	uint8_t Y[16];
 	uint8_t T[16];
 
+	if (taglen > AES_GCM_MAX_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+
 	aes_encrypt(key, H, H);
 
 	if (ivlen == 12) {
@@ -204,16 +256,21 @@ int aes_gcm_decrypt(const AES_KEY *key, const uint8_t *iv, size_t ivlen,
 		ghash(H, NULL, 0, iv, ivlen, Y);
 	}
 
-	ghash(H, aad, aadlen, in, inlen, H);
 	aes_encrypt(key, Y, T);
+
+	ghash_init(&ghash_ctx, H, aad, aadlen);
+	ctr32_incr(Y);
+	aes_gcm_ctr32_ghash(key, Y, &ghash_ctx, in, inlen, out, 0);
+	ghash_finish(&ghash_ctx, H);
+
 	gmssl_memxor(T, T, H, taglen);
+	gmssl_secure_clear(H, sizeof(H));
 	if (memcmp(T, tag, taglen) != 0) {
+		// never release unauthenticated plaintext
+		gmssl_secure_clear(out, inlen);
 		error_print();
 		return -1;
 	}
 
-	ctr32_incr(Y);
-	aes_ctr32_encrypt(key, Y, in, inlen, out);
-
 	return 1;
 }
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * AES with VAES on 512-bit registers
+ *
+ * Every zmm register holds four blocks and every vaesenc does four rounds,
+ * four registers (16 blocks) are kept in flight. The round keys are
+ * broadcast to the four lanes. The remaining blocks use 128-bit AES-NI.
+ */
+
+#include <gmssl/aes.h>
+#include <gmssl/mem.h>
+#include <immintrin.h>
+
+
+#define BSWAP32_MASK	_mm_set_epi8(12,13,14,15, 8,9,10,11, 4,5,6,7, 0,1,2,3)
+#define BSWAP128_MASK	_mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)
+
+static void aes_vaes_load_key(const AES_KEY *key, __m128i rk[AES_MAX_ROUNDS + 1], __m512i rk4[AES_MAX_ROUNDS + 1])
+{
+	size_t i;
+
+	for (i = 0; i <= key->rounds; i++) {
+		rk[i] = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(key->rk + 4 * i)), BSWAP32_MASK);
+		rk4[i] = _mm512_broadcast_i32x4(rk[i]);
+	}
+}
+
+#define VAES_ENCRYPT16(rk4, rounds)						\
+	do {									\
+		size_t r_;							\
+		b0 = _mm512_xor_si512(b0, rk4[0]);				\
+		b1 = _mm512_xor_si512(b1, rk4[0]);				\
+		b2 = _mm512_xor_si512(b2, rk4[0]);				\
+		b3 = _mm512_xor_si512(b3, rk4[0]);				\
+		for (r_ = 1; r_ < (rounds); r_++) {				\
+			b0 = _mm512_aesenc_epi128(b0, rk4[r_]);			\
+			b1 = _mm512_aesenc_epi128(b1, rk4[r_]);			\
+			b2 = _mm512_aesenc_epi128(b2, rk4[r_]);			\
+			b3 = _mm512_aesenc_epi128(b3, rk4[r_]);			\
+		}								\
+		b0 = _mm512_aesenclast_epi128(b0, rk4[r_]);			\
+		b1 = _mm512_aesenclast_epi128(b1, rk4[r_]);			\
+		b2 = _mm512_aesenclast_epi128(b2, rk4[r_]);			\
+		b3 = _mm512_aesenclast_epi128(b3, rk4[r_]);			\
+	} while (0)
+
+static __m128i aes_vaes_encrypt1(const __m128i rk[AES_MAX_ROUNDS + 1], size_t rounds, __m128i b)
+{
+	size_t r;
+
+	b = _mm_xor_si128(b, rk[0]);
+	for (r = 1; r < rounds; r++) {
+		b = _mm_aesenc_si128(b, rk[r]);
+	}
+	return _mm_aesenclast_si128(b, rk[r]);
+}
+
+void aes_vaes_encrypt_blocks(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	__m128i rk[AES_MAX_ROUNDS + 1];
+	__m512i rk4[AES_MAX_ROUNDS + 1];
+	__m512i b0, b1, b2, b3;
+	__m128i b;
+
+	aes_vaes_load_key(key, rk, rk4);
+
+	while (nblocks >= 16) {
+		b0 = _mm512_loadu_si512((const void *)(in      ));
+		b1 = _mm512_loadu_si512((const void *)(in +  64));
+		b2 = _mm512_loadu_si512((const void *)(in + 128));
+		b3 = _mm512_loadu_si512((const void *)(in + 192));
+		VAES_ENCRYPT16(rk4, key->rounds);
+		_mm512_storeu_si512((void *)(out      ), b0);
+		_mm512_storeu_si512((void *)(out +  64), b1);
+		_mm512_storeu_si512((void *)(out + 128), b2);
+		_mm512_storeu_si512((void *)(out + 192), b3);
+		in += 256;
+		out += 256;
+		nblocks -= 16;
+	}
+	while (nblocks--) {
+		b = aes_vaes_encrypt1(rk, key->rounds, _mm_loadu_si128((const __m128i *)in));
+		_mm_storeu_si128((__m128i *)out, b);
+		in += 16;
+		out += 16;
+	}
+	gmssl_secure_clear(rk, sizeof(rk));
+	gmssl_secure_clear(rk4, sizeof(rk4));
+}
+
+// the counters are byte-reversed as in aes_aesni.c, lane i of c0 holds counter + i
+void aes_vaes_ctr32_encrypt_blocks(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	const __m128i bswap = BSWAP128_MASK;
+	const __m512i bswap4 = _mm512_broadcast_i32x4(bswap);
+	const __m512i four = _mm512_broadcast_i32x4(_mm_set_epi32(0, 0, 0, 4));
+	const __m128i one = _mm_set_epi32(0, 0, 0, 1);
+	__m128i rk[AES_MAX_ROUNDS + 1];
+	__m512i rk4[AES_MAX_ROUNDS + 1];
+	__m512i b0, b1, b2, b3, c0, c1, c2, c3;
+	__m128i c, b;
+
+	aes_vaes_load_key(key, rk, rk4);
+	c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)ctr), bswap);
+
+	if (nblocks >= 16) {
+		c0 = _mm512_add_epi32(_mm512_broadcast_i32x4(c),
+			_mm512_set_epi32(0, 0, 0, 3, 0, 0, 0, 2, 0, 0, 0, 1, 0, 0, 0, 0));
+
+		while (nblocks >= 16) {
+			c1 = _mm512_add_epi32(c0, four);
+			c2 = _mm512_add_epi32(c1, four);
+			c3 = _mm512_add_epi32(c2, four);
+			b0 = _mm512_shuffle_epi8(c0, bswap4);
+			b1 = _mm512_shuffle_epi8(c1, bswap4);
+			b2 = _mm512_shuffle_epi8(c2, bswap4);
+			b3 = _mm512_shuffle_epi8(c3, bswap4);
+			c0 = _mm512_add_epi32(c3, four);
+
+			VAES_ENCRYPT16(rk4, key->rounds);
+
+			b0 = _mm512_xor_si512(b0, _mm512_loadu_si512((const void *)(in      )));
+			b1 = _mm512_xor_si512(b1, _mm512_loadu_si512((const void *)(in +  64)));
+			b2 = _mm512_xor_si512(b2, _mm512_loadu_si512((const void *)(in + 128)));
+			b3 = _mm512_xor_si512(b3, _mm512_loadu_si512((const void *)(in + 192)));
+			_mm512_storeu_si512((void *)(out      ), b0);
+			_mm512_storeu_si512((void *)(out +  64), b1);
+			_mm512_storeu_si512((void *)(out + 128), b2);
+			_mm512_storeu_si512((void *)(out + 192), b3);
+
+			in += 256;
+			out += 256;
+			nblocks -= 16;
+		}
+		c = _mm512_castsi512_si128(c0);
+	}
+	while (nblocks--) {
+		b = aes_vaes_encrypt1(rk, key->rounds, _mm_shuffle_epi8(c, bswap));
+		b = _mm_xor_si128(b, _mm_loadu_si128((const __m128i *)in));
+		_mm_storeu_si128((__m128i *)out, b);
+		c = _mm_add_epi32(c, one);
+		in += 16;
+		out += 16;
+	}
+
+	_mm_storeu_si128((__m128i *)ctr, _mm_shuffle_epi8(c, bswap));
+	gmssl_secure_clear(rk, sizeof(rk));
+	gmssl_secure_clear(rk4, sizeof(rk4));
+}
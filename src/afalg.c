@@ -0,0 +1,511 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/uio.h>
+#include <sys/socket.h>
+#include <linux/if_alg.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/ghash.h>
+#include <gmssl/afalg.h>
+#include <gmssl/error.h>
+
+#ifndef SOL_ALG
+#define SOL_ALG 279
+#endif
+
+
+int afalg_open(AFALG_CTX *ctx, const char *type, const char *name, const uint8_t *key, size_t keylen)
+{
+	struct sockaddr_alg sa;
+
+	ctx->tfm_fd = -1;
+	ctx->op_fd = -1;
+	ctx->pipe_fd[0] = ctx->pipe_fd[1] = -1;
+	ctx->threshold = AFALG_DEFAULT_THRESHOLD;
+
+	if (strlen(type) >= sizeof(sa.salg_type) || strlen(name) >= sizeof(sa.salg_name)) {
+		error_print();
+		return -1;
+	}
+	memset(&sa, 0, sizeof(sa));
+	sa.salg_family = AF_ALG;
+	strcpy((char *)sa.salg_type, type);
+	strcpy((char *)sa.salg_name, name);
+
+	// no AF_ALG in the kernel, or no driver of the algorithm
+	if ((ctx->tfm_fd = socket(AF_ALG, SOCK_SEQPACKET | SOCK_CLOEXEC, 0)) < 0) {
+		return 0;
+	}
+	if (bind(ctx->tfm_fd, (struct sockaddr *)&sa, sizeof(sa)) != 0
+		|| (key && setsockopt(ctx->tfm_fd, SOL_ALG, ALG_SET_KEY, key, (socklen_t)keylen) != 0)
+		|| (ctx->op_fd = accept4(ctx->tfm_fd, NULL, NULL, SOCK_CLOEXEC)) < 0) {
+		afalg_close(ctx);
+		return 0;
+	}
+	if (pipe2(ctx->pipe_fd, O_CLOEXEC) != 0) {
+		ctx->pipe_fd[0] = ctx->pipe_fd[1] = -1;
+	}
+	return 1;
+}
+
+void afalg_set_threshold(AFALG_CTX *ctx, size_t threshold)
+{
+	ctx->threshold = threshold ? threshold : 1;
+}
+
+int afalg_is_offloaded(const AFALG_CTX *ctx)
+{
+	return ctx->op_fd >= 0;
+}
+
+void afalg_close(AFALG_CTX *ctx)
+{
+	if (ctx->op_fd >= 0) close(ctx->op_fd);
+	if (ctx->tfm_fd >= 0) close(ctx->tfm_fd);
+	if (ctx->pipe_fd[0] >= 0) close(ctx->pipe_fd[0]);
+	if (ctx->pipe_fd[1] >= 0) close(ctx->pipe_fd[1]);
+	ctx->tfm_fd = -1;
+	ctx->op_fd = -1;
+	ctx->pipe_fd[0] = ctx->pipe_fd[1] = -1;
+}
+
+static int afalg_use(const AFALG_CTX *ctx, size_t len)
+{
+	return ctx->op_fd >= 0 && len >= ctx->threshold;
+}
+
+// the pages of `data` are moved into the pipe and from the pipe to the socket
+static int afalg_splice(const AFALG_CTX *ctx, const uint8_t *data, size_t len, int more)
+{
+	struct iovec iov;
+	ssize_t n, m;
+
+	while (len) {
+		iov.iov_base = (void *)data;
+		iov.iov_len = len;
+		if ((n = vmsplice(ctx->pipe_fd[1], &iov, 1, 0)) <= 0) {
+			return -1;
+		}
+		data += n;
+		len -= (size_t)n;
+		while (n) {
+			if ((m = splice(ctx->pipe_fd[0], NULL, ctx->op_fd, NULL, (size_t)n,
+				(more || len) ? SPLICE_F_MORE : 0)) <= 0) {
+				return -1;
+			}
+			n -= m;
+		}
+	}
+	return 1;
+}
+
+static int afalg_send(const AFALG_CTX *ctx, const uint8_t *data, size_t len, int more, int zero_copy)
+{
+	ssize_t n;
+
+	if (zero_copy && ctx->pipe_fd[0] >= 0 && len >= AFALG_SPLICE_MIN_SIZE) {
+		return afalg_splice(ctx, data, len, more);
+	}
+	while (len) {
+		if ((n = send(ctx->op_fd, data, len, more ? MSG_MORE : 0)) <= 0) {
+			return -1;
+		}
+		data += n;
+		len -= (size_t)n;
+	}
+	return 1;
+}
+
+static int afalg_read(const AFALG_CTX *ctx, uint8_t *out, size_t len)
+{
+	ssize_t n;
+
+	while (len) {
+		if ((n = read(ctx->op_fd, out, len)) <= 0) {
+			return -1;
+		}
+		out += n;
+		len -= (size_t)n;
+	}
+	return 1;
+}
+
+// one skcipher operation, at most AFALG_MAX_OP_SIZE bytes, return -1 to fall back to the CPU
+static int afalg_cipher(AFALG_CTX *ctx, int encrypt, const uint8_t iv[16],
+	const uint8_t *in, size_t len, uint8_t *out)
+{
+	uint8_t cbuf[CMSG_SPACE(sizeof(uint32_t)) + CMSG_SPACE(sizeof(struct af_alg_iv) + 16)];
+	struct msghdr msg;
+	struct cmsghdr *cmsg;
+	struct af_alg_iv *alg_iv;
+	uint32_t op = encrypt ? ALG_OP_ENCRYPT : ALG_OP_DECRYPT;
+
+	memset(cbuf, 0, sizeof(cbuf));
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+
+	cmsg = CMSG_FIRSTHDR(&msg);
+	cmsg->cmsg_level = SOL_ALG;
+	cmsg->cmsg_type = ALG_SET_OP;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(uint32_t));
+	memcpy(CMSG_DATA(cmsg), &op, sizeof(op));
+
+	cmsg = CMSG_NXTHDR(&msg, cmsg);
+	cmsg->cmsg_level = SOL_ALG;
+	cmsg->cmsg_type = ALG_SET_IV;
+	cmsg->cmsg_len = CMSG_LEN(sizeof(struct af_alg_iv) + 16);
+	alg_iv = (struct af_alg_iv *)CMSG_DATA(cmsg);
+	alg_iv->ivlen = 16;
+	memcpy(alg_iv->iv, iv, 16);
+
+	// the data follows the control message, in place the pages are copied
+	if (sendmsg(ctx->op_fd, &msg, MSG_MORE) < 0
+		|| afalg_send(ctx, in, len, 0, in != out) != 1
+		|| afalg_read(ctx, out, len) != 1) {
+		// a broken operation leaves the socket in an unknown state
+		afalg_close(ctx);
+		return -1;
+	}
+	return 1;
+}
+
+int sm3_afalg_init(SM3_AFALG_CTX *ctx)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (afalg_open(&ctx->alg, "hash", "sm3", NULL, 0) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm3_afalg_digest(SM3_AFALG_CTX *ctx, const uint8_t *data, size_t datalen, uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	SM3_CTX sm3_ctx;
+
+	if (!ctx || (!data && datalen) || !dgst) {
+		error_print();
+		return -1;
+	}
+	if (afalg_use(&ctx->alg, datalen)) {
+		size_t len;
+		const uint8_t *p = data;
+		size_t left = datalen;
+
+		while (left) {
+			len = left < AFALG_MAX_OP_SIZE ? left : AFALG_MAX_OP_SIZE;
+			if (afalg_send(&ctx->alg, p, len, left > len, 1) != 1) {
+				break;
+			}
+			p += len;
+			left -= len;
+		}
+		if (!left && afalg_read(&ctx->alg, dgst, SM3_DIGEST_SIZE) == 1) {
+			return 1;
+		}
+		// a broken operation leaves the socket in an unknown state
+		afalg_close(&ctx->alg);
+	}
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, data, datalen);
+	sm3_finish(&sm3_ctx, dgst);
+	gmssl_secure_clear(&sm3_ctx, sizeof(sm3_ctx));
+	return 1;
+}
+
+void sm3_afalg_cleanup(SM3_AFALG_CTX *ctx)
+{
+	if (ctx) {
+		afalg_close(&ctx->alg);
+	}
+}
+
+int sm4_afalg_init(SM4_AFALG_CTX *ctx, int mode, const uint8_t *key, size_t keylen)
+{
+	const char *name;
+
+	if (!ctx || !key) {
+		error_print();
+		return -1;
+	}
+	switch (mode) {
+	case SM4_AFALG_cbc: name = "cbc(sm4)"; break;
+	case SM4_AFALG_ctr: name = "ctr(sm4)"; break;
+	case SM4_AFALG_gcm: name = "ctr(sm4)"; break;
+#ifdef ENABLE_SM4_XTS
+	case SM4_AFALG_xts: name = "xts(sm4)"; break;
+#endif
+	default:
+		error_print();
+		return -1;
+	}
+	if (keylen != (mode == SM4_AFALG_xts ? 32 : 16)) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(SM4_AFALG_CTX));
+	ctx->mode = mode;
+	sm4_set_encrypt_key(&ctx->enc_key, key);
+	sm4_set_decrypt_key(&ctx->dec_key, key);
+	if (mode == SM4_AFALG_xts) {
+		sm4_set_encrypt_key(&ctx->tweak_key, key + 16);
+	}
+	if (afalg_open(&ctx->alg, "skcipher", name, key, keylen) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+void sm4_afalg_cleanup(SM4_AFALG_CTX *ctx)
+{
+	if (ctx) {
+		afalg_close(&ctx->alg);
+		gmssl_secure_clear(&ctx->enc_key, sizeof(SM4_KEY));
+		gmssl_secure_clear(&ctx->dec_key, sizeof(SM4_KEY));
+		gmssl_secure_clear(&ctx->tweak_key, sizeof(SM4_KEY));
+	}
+}
+
+int sm4_afalg_cbc_encrypt_blocks(SM4_AFALG_CTX *ctx, uint8_t iv[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	size_t len;
+
+	if (!ctx || !iv || (!in && nblocks) || (!out && nblocks) || ctx->mode != SM4_AFALG_cbc) {
+		error_print();
+		return -1;
+	}
+	if (afalg_use(&ctx->alg, nblocks * 16)) {
+		while (nblocks) {
+			len = nblocks * 16 < AFALG_MAX_OP_SIZE ? nblocks * 16 : AFALG_MAX_OP_SIZE;
+			if (afalg_cipher(&ctx->alg, 1, iv, in, len, out) != 1) {
+				break;
+			}
+			memcpy(iv, out + len - 16, 16);
+			in += len;
+			out += len;
+			nblocks -= len / 16;
+		}
+	}
+	sm4_cbc_encrypt_blocks(&ctx->enc_key, iv, in, nblocks, out);
+	return 1;
+}
+
+int sm4_afalg_cbc_decrypt_blocks(SM4_AFALG_CTX *ctx, uint8_t iv[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t next_iv[16];
+	size_t len;
+
+	if (!ctx || !iv || (!in && nblocks) || (!out && nblocks) || ctx->mode != SM4_AFALG_cbc) {
+		error_print();
+		return -1;
+	}
+	if (afalg_use(&ctx->alg, nblocks * 16)) {
+		while (nblocks) {
+			len = nblocks * 16 < AFALG_MAX_OP_SIZE ? nblocks * 16 : AFALG_MAX_OP_SIZE;
+			// the last ciphertext block might be decrypted in place
+			memcpy(next_iv, in + len - 16, 16);
+			if (afalg_cipher(&ctx->alg, 0, iv, in, len, out) != 1) {
+				break;
+			}
+			memcpy(iv, next_iv, 16);
+			in += len;
+			out += len;
+			nblocks -= len / 16;
+		}
+	}
+	sm4_cbc_decrypt_blocks(&ctx->dec_key, iv, in, nblocks, out);
+	return 1;
+}
+
+// ctr += nblocks, as a 128-bit big-endian integer
+static void ctr_add(uint8_t ctr[16], uint64_t nblocks)
+{
+	int i;
+	for (i = 15; i >= 0 && nblocks; i--) {
+		nblocks += ctr[i];
+		ctr[i] = (uint8_t)nblocks;
+		nblocks >>= 8;
+	}
+}
+
+// the kernel ctr(sm4) increments the whole 128-bit counter as sm4_ctr_encrypt()
+static void sm4_afalg_ctr(SM4_AFALG_CTX *ctx, uint8_t ctr[16], const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	size_t len;
+
+	if (afalg_use(&ctx->alg, inlen)) {
+		while (inlen) {
+			len = inlen < AFALG_MAX_OP_SIZE ? inlen : AFALG_MAX_OP_SIZE;
+			if (afalg_cipher(&ctx->alg, 1, ctr, in, len, out) != 1) {
+				break;
+			}
+			ctr_add(ctr, (len + 15) / 16);
+			in += len;
+			out += len;
+			inlen -= len;
+		}
+	}
+	sm4_ctr_encrypt(&ctx->enc_key, ctr, in, inlen, out);
+}
+
+int sm4_afalg_ctr_encrypt(SM4_AFALG_CTX *ctx, uint8_t ctr[SM4_BLOCK_SIZE],
+	const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	if (!ctx || !ctr || (!in && inlen) || (!out && inlen) || ctx->mode != SM4_AFALG_ctr) {
+		error_print();
+		return -1;
+	}
+	sm4_afalg_ctr(ctx, ctr, in, inlen, out);
+	return 1;
+}
+
+/*
+ * With a 12-byte IV the counter blocks are IV || 2, IV || 3, ... and the low
+ * 32 bits can not wrap within the longest GCM message, so ctr(sm4) gives the
+ * keystream of the 32-bit GCM counter.
+ */
+static int sm4_afalg_gcm_init(SM4_AFALG_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, GHASH_CTX *ghash_ctx, uint8_t ctr[16], uint8_t T[16])
+{
+	uint8_t H[16] = {0};
+
+	sm4_encrypt(&ctx->enc_key, H, H);
+	ghash_init(ghash_ctx, H, aad, aadlen);
+	gmssl_secure_clear(H, sizeof(H));
+
+	memcpy(ctr, iv, 12);
+	ctr[12] = ctr[13] = ctr[14] = 0;
+	ctr[15] = 1;
+	sm4_encrypt(&ctx->enc_key, ctr, T);
+	ctr[15] = 2;
+	return 1;
+}
+
+int sm4_afalg_gcm_encrypt(SM4_AFALG_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag)
+{
+	GHASH_CTX ghash_ctx;
+	uint8_t ctr[16];
+	uint8_t T[16];
+	uint8_t S[16];
+
+	if (!ctx || !iv || (!aad && aadlen) || (!in && inlen) || (!out && inlen) || !tag
+		|| ctx->mode != SM4_AFALG_gcm) {
+		error_print();
+		return -1;
+	}
+	if (ivlen != 12 || !afalg_use(&ctx->alg, inlen)) {
+		return sm4_gcm_encrypt(&ctx->enc_key, iv, ivlen, aad, aadlen, in, inlen, out, taglen, tag);
+	}
+	if (taglen < SM4_GCM_MIN_TAG_SIZE || taglen > SM4_GCM_MAX_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+	sm4_afalg_gcm_init(ctx, iv, ivlen, aad, aadlen, &ghash_ctx, ctr, T);
+	sm4_afalg_ctr(ctx, ctr, in, inlen, out);
+	ghash_update(&ghash_ctx, out, inlen);
+	ghash_finish(&ghash_ctx, S);
+	gmssl_memxor(T, T, S, 16);
+	memcpy(tag, T, taglen);
+
+	gmssl_secure_clear(&ghash_ctx, sizeof(ghash_ctx));
+	gmssl_secure_clear(T, sizeof(T));
+	return 1;
+}
+
+int sm4_afalg_gcm_decrypt(SM4_AFALG_CTX *ctx, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	const uint8_t *tag, size_t taglen, uint8_t *out)
+{
+	GHASH_CTX ghash_ctx;
+	uint8_t ctr[16];
+	uint8_t T[16];
+	uint8_t S[16];
+
+	if (!ctx || !iv || (!aad && aadlen) || (!in && inlen) || (!out && inlen) || !tag
+		|| ctx->mode != SM4_AFALG_gcm) {
+		error_print();
+		return -1;
+	}
+	if (ivlen != 12 || !afalg_use(&ctx->alg, inlen)) {
+		return sm4_gcm_decrypt(&ctx->enc_key, iv, ivlen, aad, aadlen, in, inlen, tag, taglen, out);
+	}
+	if (taglen < SM4_GCM_MIN_TAG_SIZE || taglen > SM4_GCM_MAX_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+	// the tag is checked before anything is decrypted
+	sm4_afalg_gcm_init(ctx, iv, ivlen, aad, aadlen, &ghash_ctx, ctr, T);
+	ghash_update(&ghash_ctx, in, inlen);
+	ghash_finish(&ghash_ctx, S);
+	gmssl_memxor(T, T, S, 16);
+	gmssl_secure_clear(&ghash_ctx, sizeof(ghash_ctx));
+	if (gmssl_secure_memcmp(T, tag, taglen) != 0) {
+		gmssl_secure_clear(T, sizeof(T));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(T, sizeof(T));
+	sm4_afalg_ctr(ctx, ctr, in, inlen, out);
+	return 1;
+}
+
+#ifdef ENABLE_SM4_XTS
+static int sm4_afalg_xts(SM4_AFALG_CTX *ctx, int encrypt, const uint8_t tweak[16],
+	const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	if (!ctx || !tweak || !in || !out || ctx->mode != SM4_AFALG_xts) {
+		error_print();
+		return -1;
+	}
+	if (inlen < SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (afalg_use(&ctx->alg, inlen) && inlen <= AFALG_MAX_OP_SIZE
+		&& afalg_cipher(&ctx->alg, encrypt, tweak, in, inlen, out) == 1) {
+		return 1;
+	}
+	if (encrypt) {
+		return sm4_xts_encrypt(&ctx->enc_key, &ctx->tweak_key, tweak, in, inlen, out);
+	} else {
+		return sm4_xts_decrypt(&ctx->dec_key, &ctx->tweak_key, tweak, in, inlen, out);
+	}
+}
+
+int sm4_afalg_xts_encrypt(SM4_AFALG_CTX *ctx, const uint8_t tweak[16],
+	const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	return sm4_afalg_xts(ctx, 1, tweak, in, inlen, out);
+}
+
+int sm4_afalg_xts_decrypt(SM4_AFALG_CTX *ctx, const uint8_t tweak[16],
+	const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	return sm4_afalg_xts(ctx, 0, tweak, in, inlen, out);
+}
+#endif
@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/arena.h>
+#include <gmssl/error.h>
+
+
+struct ARENA_BLOCK_st {
+	ARENA_BLOCK *prev;
+	size_t size;
+	size_t used;
+};
+
+#define ARENA_BLOCK_HEADER_SIZE	((sizeof(ARENA_BLOCK) + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1))
+#define arena_block_data(b)	((uint8_t *)(b) + ARENA_BLOCK_HEADER_SIZE)
+
+void arena_init(ARENA *arena, size_t block_size)
+{
+	memset(arena, 0, sizeof(ARENA));
+	arena->block_size = block_size;
+}
+
+void *arena_alloc(ARENA *arena, size_t size)
+{
+	ARENA_BLOCK *block = arena->block;
+	size_t block_size = arena->block_size ? arena->block_size : ARENA_DEFAULT_BLOCK_SIZE;
+	void *p;
+
+	if (!size) {
+		size = 1;
+	}
+	if (size > SIZE_MAX - ARENA_BLOCK_HEADER_SIZE - ARENA_ALIGN) {
+		error_print();
+		return NULL;
+	}
+	size = (size + ARENA_ALIGN - 1) & ~(size_t)(ARENA_ALIGN - 1);
+
+	if (!block || block->size - block->used < size) {
+		if (block_size < size) {
+			block_size = size;
+		}
+		if (!(block = (ARENA_BLOCK *)malloc(ARENA_BLOCK_HEADER_SIZE + block_size))) {
+			error_print();
+			return NULL;
+		}
+		block->prev = arena->block;
+		block->size = block_size;
+		block->used = 0;
+		arena->block = block;
+	}
+	p = arena_block_data(block) + block->used;
+	block->used += size;
+	return p;
+}
+
+void arena_get_mark(const ARENA *arena, ARENA_MARK *mark)
+{
+	mark->block = arena->block;
+	mark->used = arena->block ? arena->block->used : 0;
+}
+
+void arena_release(ARENA *arena, const ARENA_MARK *mark)
+{
+	ARENA_BLOCK *block;
+
+	while (arena->block && arena->block != mark->block) {
+		block = arena->block;
+		arena->block = block->prev;
+		gmssl_secure_clear(arena_block_data(block), block->used);
+		free(block);
+	}
+	if ((block = arena->block) != NULL && block->used > mark->used) {
+		gmssl_secure_clear(arena_block_data(block) + mark->used, block->used - mark->used);
+		block->used = mark->used;
+	}
+}
+
+void arena_reset(ARENA *arena)
+{
+	ARENA_BLOCK *block;
+
+	while ((block = arena->block) != NULL && block->prev) {
+		arena->block = block->prev;
+		gmssl_secure_clear(arena_block_data(block), block->used);
+		free(block);
+	}
+	if (block) {
+		gmssl_secure_clear(arena_block_data(block), block->used);
+		block->used = 0;
+	}
+}
+
+void arena_cleanup(ARENA *arena)
+{
+	if (arena) {
+		arena_reset(arena);
+		free(arena->block);
+		arena->block = NULL;
+	}
+}
@@ -21,6 +21,11 @@
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 
 static const char *asn1_tag_index[] = {
@@ -173,6 +178,82 @@ int asn1_length_to_der(size_t len, uint8_t **out, size_t *outlen)
 	return 1;
 }
 
+
+#ifdef _WIN32
+#define ASN1_THREAD_LOCAL __declspec(thread)
+#else
+#define ASN1_THREAD_LOCAL __thread
+#endif
+
+static ASN1_THREAD_LOCAL ASN1_PARSE_CTX *asn1_parse_ctx = NULL;
+
+int asn1_parse_ctx_init(ASN1_PARSE_CTX *ctx, size_t max_depth, size_t max_elements, size_t max_bytes)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (max_depth > ASN1_PARSE_MAX_DEPTH) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->max_depth = max_depth ? max_depth : ASN1_PARSE_DEFAULT_DEPTH;
+	ctx->max_elements = max_elements ? max_elements : ASN1_PARSE_DEFAULT_ELEMENTS;
+	ctx->max_bytes = max_bytes ? max_bytes : ASN1_PARSE_DEFAULT_BYTES;
+	return 1;
+}
+
+void asn1_parse_ctx_reset(ASN1_PARSE_CTX *ctx)
+{
+	if (ctx) {
+		ctx->depth = 0;
+		ctx->elements = 0;
+		ctx->bytes = 0;
+		ctx->exhausted = 0;
+	}
+}
+
+ASN1_PARSE_CTX *asn1_parse_ctx_set(ASN1_PARSE_CTX *ctx)
+{
+	ASN1_PARSE_CTX *prev = asn1_parse_ctx;
+	asn1_parse_ctx = ctx;
+	return prev;
+}
+
+int asn1_parse_ctx_exhausted(const ASN1_PARSE_CTX *ctx)
+{
+	return ctx && ctx->exhausted;
+}
+
+// charge the element (tag, d, dlen) just decoded to the budget of this thread
+static int asn1_parse_charge(int tag, const uint8_t *d, size_t dlen)
+{
+	ASN1_PARSE_CTX *ctx = asn1_parse_ctx;
+
+	if (ctx->exhausted) {
+		return -1;
+	}
+	// close the constructed elements this one is not inside of
+	while (ctx->depth && (d < ctx->open[ctx->depth - 1].d || d > ctx->open[ctx->depth - 1].end)) {
+		ctx->depth--;
+	}
+	if (ctx->elements >= ctx->max_elements
+		|| dlen > ctx->max_bytes - ctx->bytes
+		|| ctx->depth >= ctx->max_depth) {
+		ctx->exhausted = 1;
+		return -1;
+	}
+	ctx->elements++;
+	ctx->bytes += dlen;
+	if (tag & ASN1_TAG_CONSTRUCTED) {
+		ctx->open[ctx->depth].d = d;
+		ctx->open[ctx->depth].end = d + dlen;
+		ctx->depth++;
+	}
+	return 1;
+}
+
 int asn1_length_from_der(size_t *len, const uint8_t **in, size_t *inlen)
 {
 	if (!len || !in || !(*in) || !inlen) {
@@ -272,6 +353,56 @@ int asn1_header_to_der(int tag, size_t dlen, uint8_t **out, size_t *outlen)
 	return 1;
 }
 
+int asn1_header_begin(ASN1_HEADER *hdr, int tag, uint8_t **out, size_t *outlen)
+{
+	if (!hdr || !outlen) {
+		error_print();
+		return -1;
+	}
+	hdr->outlen = *outlen;
+	hdr->p = NULL;
+	if (out && *out) {
+		hdr->p = *out;
+		*(*out)++ = (uint8_t)tag;
+		*(*out)++ = 0;
+	}
+	return 1;
+}
+
+int asn1_header_end(ASN1_HEADER *hdr, uint8_t **out, size_t *outlen)
+{
+	size_t dlen;
+	size_t hlen = 0;
+	size_t len = 0;
+	uint8_t *p;
+
+	if (!hdr || !outlen || *outlen < hdr->outlen) {
+		error_print();
+		return -1;
+	}
+	dlen = *outlen - hdr->outlen;
+	if (asn1_length_to_der(dlen, NULL, &hlen) != 1) {
+		error_print();
+		return -1;
+	}
+	hlen++;
+
+	if (hdr->p) {
+		if (!out || *out != hdr->p + 2 + dlen) {
+			error_print();
+			return -1;
+		}
+		if (hlen > 2) {
+			memmove(hdr->p + hlen, hdr->p + 2, dlen);
+		}
+		p = hdr->p + 1;
+		(void)asn1_length_to_der(dlen, &p, &len);
+		*out = hdr->p + hlen + dlen;
+	}
+	*outlen += hlen;
+	return 1;
+}
+
 int asn1_type_to_der(int tag, const uint8_t *d, size_t dlen, uint8_t **out, size_t *outlen)
 {
 	if (!outlen) {
@@ -327,6 +458,10 @@ int asn1_type_from_der(int tag, const uint8_t **d, size_t *dlen, const uint8_t *
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, *dlen) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// data
 	*d = *in;
@@ -386,6 +521,10 @@ int asn1_any_type_from_der(int *tag, const uint8_t **d, size_t *dlen, const uint
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(*tag, *in, *dlen) != 1) {
+		error_print();
+		return -1;
+	}
 
 	*d = *in;
 	*in += *dlen;
@@ -580,6 +719,10 @@ int asn1_integer_from_der_ex(int tag, const uint8_t **a, size_t *alen, const uin
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, len) != 1) {
+		error_print();
+		return -1;
+	}
 	if (len == 0) {
 		error_print();
 		return -1;
@@ -744,6 +887,10 @@ int asn1_bit_string_from_der_ex(int tag, const uint8_t **bits, size_t *nbits, co
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, len) != 1) {
+		error_print();
+		return -1;
+	}
 	if (len < 2) {
 		error_print();
 		return -1;
@@ -1109,6 +1256,10 @@ int asn1_object_identifier_from_der_ex(int tag, uint32_t *nodes, size_t *nodes_c
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, len) != 1) {
+		error_print();
+		return -1;
+	}
 	if (len < ASN1_OID_MIN_OCTETS) {
 		error_print();
 		return -1;
@@ -1154,6 +1305,174 @@ int asn1_object_identifier_print(FILE *fp, int format, int indent, const char *l
 	return 1;
 }
 
+/*
+Hash index of the ASN1_OID_INFO tables
+
+Every table is indexed at its first lookup, keyed by (infos, count), with one
+open addressing array over the nodes and one over the `oid` values. The slots
+keep index + 1 of the entry, 0 is empty. An index is built under the lock and
+published by a release store of `infos`, the lookups only do acquire loads.
+Tables beyond ASN1_OID_INDEX_TABLES, or when malloc fails, are scanned linearly.
+
+The key is only the address, a table freed by the caller and another one
+allocated at the same place would find the old index. So an entry of the
+index is always compared with the table, and a miss is confirmed by the
+linear scan: a stale index costs time but never gives a wrong entry.
+asn1_oid_index_cleanup() frees the indexes.
+*/
+#define ASN1_OID_INDEX_TABLES	64 // power of 2, the library has about 20 tables
+#define ASN1_OID_INDEX_MAX_INFOS	0x7fff
+
+typedef struct {
+	const ASN1_OID_INFO *infos;
+	size_t infos_cnt;
+	size_t mask;
+	uint16_t *nodes_slots;
+	uint16_t *oid_slots;
+} ASN1_OID_INDEX;
+
+static ASN1_OID_INDEX asn1_oid_indexes[ASN1_OID_INDEX_TABLES];
+
+#ifdef _WIN32
+static SRWLOCK asn1_oid_index_lock = SRWLOCK_INIT;
+#define asn1_oid_index_lock()	AcquireSRWLockExclusive(&asn1_oid_index_lock)
+#define asn1_oid_index_unlock()	ReleaseSRWLockExclusive(&asn1_oid_index_lock)
+#define asn1_oid_index_load(p)	((const ASN1_OID_INFO *)InterlockedCompareExchangePointer((PVOID volatile *)(p), NULL, NULL))
+#define asn1_oid_index_store(p,v) InterlockedExchangePointer((PVOID volatile *)(p), (PVOID)(v))
+#else
+static pthread_mutex_t asn1_oid_index_lock = PTHREAD_MUTEX_INITIALIZER;
+#define asn1_oid_index_lock()	pthread_mutex_lock(&asn1_oid_index_lock)
+#define asn1_oid_index_unlock()	pthread_mutex_unlock(&asn1_oid_index_lock)
+#define asn1_oid_index_load(p)	__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define asn1_oid_index_store(p,v) __atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+static size_t asn1_oid_nodes_hash(const uint32_t *nodes, size_t nodes_cnt)
+{
+	uint32_t h = 0x811c9dc5; // FNV-1a over the nodes
+	size_t i;
+
+	for (i = 0; i < nodes_cnt; i++) {
+		h ^= nodes[i];
+		h *= 0x01000193;
+	}
+	return h ^ (h >> 15);
+}
+
+static size_t asn1_oid_hash(int oid)
+{
+	uint32_t h = (uint32_t)oid * 0x9e3779b1;
+	return h ^ (h >> 15);
+}
+
+static size_t asn1_oid_table_hash(const ASN1_OID_INFO *infos)
+{
+	size_t h = (size_t)infos;
+	return (h >> 4) ^ (h >> 10);
+}
+
+static int asn1_oid_index_build(ASN1_OID_INDEX *index, const ASN1_OID_INFO *infos, size_t infos_cnt)
+{
+	size_t size = 8;
+	size_t i, j;
+
+	while (size < infos_cnt * 2) {
+		size <<= 1;
+	}
+	if (!(index->nodes_slots = (uint16_t *)calloc(size * 2, sizeof(uint16_t)))) {
+		return -1;
+	}
+	index->oid_slots = index->nodes_slots + size;
+	index->mask = size - 1;
+	index->infos_cnt = infos_cnt;
+
+	// insert in reverse order, a duplicated entry is overwritten by the first one as the linear scan
+	for (i = infos_cnt; i > 0; i--) {
+		const ASN1_OID_INFO *info = &infos[i - 1];
+
+		j = asn1_oid_nodes_hash(info->nodes, info->nodes_cnt) & index->mask;
+		while (index->nodes_slots[j]
+			&& !asn1_object_identifier_equ(infos[index->nodes_slots[j] - 1].nodes,
+				infos[index->nodes_slots[j] - 1].nodes_cnt, info->nodes, info->nodes_cnt)) {
+			j = (j + 1) & index->mask;
+		}
+		index->nodes_slots[j] = (uint16_t)i;
+
+		j = asn1_oid_hash(info->oid) & index->mask;
+		while (index->oid_slots[j] && infos[index->oid_slots[j] - 1].oid != info->oid) {
+			j = (j + 1) & index->mask;
+		}
+		index->oid_slots[j] = (uint16_t)i;
+	}
+	return 1;
+}
+
+// return NULL if the table can not be indexed
+static const ASN1_OID_INDEX *asn1_oid_index_get(const ASN1_OID_INFO *infos, size_t infos_cnt)
+{
+	ASN1_OID_INDEX *index = NULL;
+	const ASN1_OID_INFO *p;
+	size_t start, i;
+
+	if (infos_cnt > ASN1_OID_INDEX_MAX_INFOS) {
+		return NULL;
+	}
+
+	start = asn1_oid_table_hash(infos);
+	for (i = 0; i < ASN1_OID_INDEX_TABLES; i++) {
+		index = &asn1_oid_indexes[(start + i) & (ASN1_OID_INDEX_TABLES - 1)];
+		if (!(p = asn1_oid_index_load(&index->infos))) {
+			break;
+		}
+		if (p == infos && index->infos_cnt == infos_cnt) {
+			return index;
+		}
+	}
+	if (i == ASN1_OID_INDEX_TABLES) {
+		return NULL;
+	}
+
+	asn1_oid_index_lock();
+	// another thread might have indexed the table or taken the slot
+	for (; i < ASN1_OID_INDEX_TABLES; i++) {
+		index = &asn1_oid_indexes[(start + i) & (ASN1_OID_INDEX_TABLES - 1)];
+		if (!index->infos) {
+			if (asn1_oid_index_build(index, infos, infos_cnt) != 1) {
+				index = NULL;
+				break;
+			}
+			asn1_oid_index_store(&index->infos, infos);
+			break;
+		}
+		if (index->infos == infos && index->infos_cnt == infos_cnt) {
+			break;
+		}
+	}
+	if (i == ASN1_OID_INDEX_TABLES) {
+		index = NULL;
+	}
+	asn1_oid_index_unlock();
+
+	return index;
+}
+
+void asn1_oid_index_cleanup(void)
+{
+	size_t i;
+
+	asn1_oid_index_lock();
+	for (i = 0; i < ASN1_OID_INDEX_TABLES; i++) {
+		ASN1_OID_INDEX *index = &asn1_oid_indexes[i];
+
+		if (index->infos) {
+			asn1_oid_index_store(&index->infos, NULL);
+			free(index->nodes_slots);
+			memset(index, 0, sizeof(*index));
+		}
+	}
+	asn1_oid_index_unlock();
+}
+
 const ASN1_OID_INFO *asn1_oid_info_from_name(const ASN1_OID_INFO *infos, size_t infos_cnt, const char *name)
 {
 	size_t i;
@@ -1172,12 +1491,23 @@ const ASN1_OID_INFO *asn1_oid_info_from_name(const ASN1_OID_INFO *infos, size_t
 
 const ASN1_OID_INFO *asn1_oid_info_from_oid(const ASN1_OID_INFO *infos, size_t infos_cnt, int oid)
 {
+	const ASN1_OID_INDEX *index;
 	size_t i;
 
 	if (!infos || !infos_cnt || oid < 0) {
 		error_print();
 		return NULL;
 	}
+	if ((index = asn1_oid_index_get(infos, infos_cnt)) != NULL) {
+		i = asn1_oid_hash(oid) & index->mask;
+		while (index->oid_slots[i]) {
+			if (infos[index->oid_slots[i] - 1].oid == oid) {
+				return &infos[index->oid_slots[i] - 1];
+			}
+			i = (i + 1) & index->mask;
+		}
+	}
+
 	for (i = 0; i < infos_cnt; i++) {
 		if (infos[i].oid == oid) {
 			return &infos[i];
@@ -1189,6 +1519,7 @@ const ASN1_OID_INFO *asn1_oid_info_from_oid(const ASN1_OID_INFO *infos, size_t i
 int asn1_oid_info_from_der_ex(const ASN1_OID_INFO **info, uint32_t *nodes, size_t *nodes_cnt,
 	const ASN1_OID_INFO *infos, size_t infos_cnt, const uint8_t **in, size_t *inlen)
 {
+	const ASN1_OID_INDEX *index;
 	int ret;
 	size_t i;
 
@@ -1202,6 +1533,19 @@ int asn1_oid_info_from_der_ex(const ASN1_OID_INFO **info, uint32_t *nodes, size_
 		return ret;
 	}
 
+	if (infos && (index = asn1_oid_index_get(infos, infos_cnt)) != NULL) {
+		i = asn1_oid_nodes_hash(nodes, *nodes_cnt) & index->mask;
+		while (index->nodes_slots[i]) {
+			const ASN1_OID_INFO *p = &infos[index->nodes_slots[i] - 1];
+			if (*nodes_cnt == p->nodes_cnt
+				&& memcmp(nodes, p->nodes, (*nodes_cnt) * sizeof(uint32_t)) == 0) {
+				*info = p;
+				return 1;
+			}
+			i = (i + 1) & index->mask;
+		}
+	}
+
 	for (i = 0; i < infos_cnt; i++) {
 		if (*nodes_cnt == infos[i].nodes_cnt
 			&& memcmp(nodes, infos[i].nodes, (*nodes_cnt) * sizeof(int)) == 0) {
@@ -1486,11 +1830,49 @@ static int is_leap_year(int year) {
 
 #define val(c)	((c)-'0')
 
+/*
+ * Days since 1970-01-01 of a Gregorian date in closed form, the year starts in
+ * March so that the leap day is the last one (H. Hinnant, chrono-Compatible
+ * Low-Level Date Algorithms). Only dates from 1970 are used.
+ */
+static time_t days_from_civil(int year, int month, int day)
+{
+	int era, yoe, doy, doe;
+
+	year -= month <= 2;
+	era = year / 400;
+	yoe = year - era * 400;
+	doy = (153 * (month > 2 ? month - 3 : month + 9) + 2) / 5 + day - 1;
+	doe = yoe * 365 + yoe / 4 - yoe / 100 + doy;
+	return (time_t)era * 146097 + doe - 719468;
+}
+
+static void civil_from_days(time_t days, int *year, int *month, int *day)
+{
+	time_t z = days + 719468;
+	int era = (int)(z / 146097);
+	int doe = (int)(z - (time_t)era * 146097);
+	int yoe = (doe - doe / 1460 + doe / 36524 - doe / 146096) / 365;
+	int doy = doe - (365 * yoe + yoe / 4 - yoe / 100);
+	int mp = (5 * doy + 2) / 153;
+
+	*day = doy - (153 * mp + 2) / 5 + 1;
+	*month = mp < 10 ? mp + 3 : mp - 9;
+	*year = yoe + era * 400 + (*month <= 2);
+}
+
+static int days_in_month(int year, int month)
+{
+	if (month == 2) {
+		return 28 + is_leap_year(year);
+	}
+	// 31 days in odd months up to July and in even months from August
+	return 30 + ((month + (month >> 3)) & 1);
+}
+
 int asn1_time_from_str(int utc_time, time_t *timestamp, const char *str)
 {
 	int time_str_len[2] = { 15, 13 };
-	int days_per_year[2] = { 365, 366 };
-	int days_per_month[] = { 0,31,28,31,30,31,30,31,31,30,31,30,31 };
 	int year, month, day, hour, minute, second;
 	const char *p = str;
 	int i;
@@ -1509,19 +1891,12 @@ int asn1_time_from_str(int utc_time, time_t *timestamp, const char *str)
 
 	if (utc_time) {
 		year = val(p[0]) * 10 + val(p[1]);
-		if (year <= 50) {
-			year += 2000;
-		} else {
-			year += 1900;
-		}
+		year += year <= 50 ? 2000 : 1900;
 		p += 2;
 	} else {
-		year = val(p[0]) * 1000 + val(str[1]) * 100 + val(str[2]) * 10 + val(str[3]);
+		year = val(p[0]) * 1000 + val(p[1]) * 100 + val(p[2]) * 10 + val(p[3]);
 		p += 4;
 	}
-	if (is_leap_year(year)) {
-		days_per_month[2] = 29;
-	}
 	month	= val(p[0]) * 10 + val(p[1]); p += 2;
 	day	= val(p[0]) * 10 + val(p[1]); p += 2;
 	hour	= val(p[0]) * 10 + val(p[1]); p += 2;
@@ -1530,65 +1905,39 @@ int asn1_time_from_str(int utc_time, time_t *timestamp, const char *str)
 
 	if (year < 1970
 		|| month < 1 || month > 12
-		|| day < 1 || day > days_per_month[month]
-		|| hour < 0 || hour > 23
-		|| minute < 0 || minute > 59
-		|| second < 0 || second > 59) {
+		|| day < 1 || day > days_in_month(year, month)
+		|| hour > 23
+		|| minute > 59
+		|| second > 59) {
 		error_print();
 		return -1;
 	}
 
-	day--;
-
-	while (year-- > 1970) {
-		day += days_per_year[is_leap_year(year)];
-	}
-	while (month-- > 1) {
-		day += days_per_month[month];
-	}
-	*timestamp = (time_t)day * 86400 + hour * 3600 + minute * 60 + second;
-
+	*timestamp = days_from_civil(year, month, day) * 86400 + hour * 3600 + minute * 60 + second;
 	return 1;
 }
 
 int asn1_time_to_str(int utc_time, time_t timestamp, char *str)
 {
-	int days_per_month[] = { 0,31,28,31,30,31,30,31,31,30,31,30,31 };
-	int days_per_year[2] = { 365, 366 };
 	int max_year[2] = { 9999, 2050 };
-	int year, month, second, hour, minute;
-	time_t day;
+	int year, month, day, second, hour, minute;
 	char *p = str;
 
 	utc_time &= 1;
-	day = timestamp / 86400;
-	second = timestamp % 86400;
+	if (timestamp < 0) {
+		error_print();
+		return -1;
+	}
+	second = (int)(timestamp % 86400);
 
 	// In UTCTime, year in [1951, 2050], YY <= 50, year = 20YY; YY > 50, year = 19YY
 	// For Validity, year SHOULD <= 2049 (NOT 2050)
-	for (year = 1970; year <= max_year[utc_time]; year++) {
-		if (day < days_per_year[is_leap_year(year)]) {
-			break;
-		}
-		day -= days_per_year[is_leap_year(year)];
-	}
+	civil_from_days(timestamp / 86400, &year, &month, &day);
 	if (year > max_year[utc_time]) {
 		error_print();
 		return -1;
 	}
 
-	day++;
-
-	if (is_leap_year(year)) {
-		days_per_month[2] = 29;
-	}
-	for (month = 1; month <= 12; month++) {
-		if (day <= days_per_month[month]) {
-			break;
-		}
-		day -= days_per_month[month];
-	}
-
 	hour = second / 3600;
 	second %= 3600;
 	minute = second / 60;
@@ -1675,11 +2024,14 @@ int asn1_utc_time_from_der_ex(int tag, time_t *t, const uint8_t **in, size_t *in
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, len) != 1) {
+		error_print();
+		return -1;
+	}
 
 	if (len == sizeof("YYMMDDHHMMSSZ")-1) {
-		char buf[sizeof("YYMMDDHHMMSSZ")-1];
-		memcpy(buf, *in, len);
-		if (asn1_time_from_str(1, t, buf) != 1) {
+		// parsed in place, the length is already checked against inlen
+		if (asn1_time_from_str(1, t, (const char *)*in) != 1) {
 			error_print();
 			return -1;
 		}
@@ -1752,11 +2104,14 @@ int asn1_generalized_time_from_der_ex(int tag, time_t *t, const uint8_t **in, si
 		error_print();
 		return -1;
 	}
+	if (asn1_parse_ctx && asn1_parse_charge(tag, *in, len) != 1) {
+		error_print();
+		return -1;
+	}
 
 	if (len == sizeof("YYYYMMDDHHMMSSZ")-1) {
-		char buf[sizeof("YYYYMMDDHHMMSSZ")-1];
-		memcpy(buf, *in, len);
-		if (asn1_time_from_str(0, t, buf) != 1) {
+		// parsed in place, the length is already checked against inlen
+		if (asn1_time_from_str(0, t, (const char *)*in) != 1) {
 			error_print();
 			return -1;
 		}
@@ -1777,7 +2132,7 @@ int asn1_generalized_time_from_der_ex(int tag, time_t *t, const uint8_t **in, si
 
 int asn1_sequence_of_int_to_der(const int *nums, size_t nums_cnt, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	size_t i;
 
 	if (!nums || !nums_cnt || !outlen) {
@@ -1785,13 +2140,7 @@ int asn1_sequence_of_int_to_der(const int *nums, size_t nums_cnt, uint8_t **out,
 		return -1;
 	}
 
-	for (i = 0; i < nums_cnt; i++) {
-		if (asn1_int_to_der(nums[i], NULL, &len) != 1) {
-			error_print();
-			return -1;
-		}
-	}
-	if (asn1_sequence_header_to_der(len, out, outlen) != 1) {
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1801,6 +2150,10 @@ int asn1_sequence_of_int_to_der(const int *nums, size_t nums_cnt, uint8_t **out,
 			return -1;
 		}
 	}
+	if (asn1_header_end(&hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
@@ -1909,6 +2262,65 @@ int asn1_types_get_item_by_index(const uint8_t *d, size_t dlen, int tag,
 	return -1;
 }
 
+int asn1_cursor_init(ASN1_CURSOR *cur, const uint8_t *d, size_t dlen)
+{
+	ASN1_FIELD *field;
+
+	if (!cur || (!d && dlen)) {
+		error_print();
+		return -1;
+	}
+	cur->fields_cnt = 0;
+	while (dlen) {
+		if (cur->fields_cnt >= ASN1_CURSOR_MAX_FIELDS) {
+			error_print();
+			return -1;
+		}
+		field = &cur->fields[cur->fields_cnt];
+		field->a = d;
+		if (asn1_any_type_from_der(&field->tag, &field->d, &field->dlen, &d, &dlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cur->fields_cnt++;
+	}
+	return 1;
+}
+
+int asn1_cursor_get(const ASN1_CURSOR *cur, size_t index, int *tag, const uint8_t **d, size_t *dlen)
+{
+	if (!cur || !tag || !d || !dlen) {
+		error_print();
+		return -1;
+	}
+	if (index >= cur->fields_cnt) {
+		*tag = -1;
+		*d = NULL;
+		*dlen = 0;
+		return 0;
+	}
+	*tag = cur->fields[index].tag;
+	*d = cur->fields[index].d;
+	*dlen = cur->fields[index].dlen;
+	return 1;
+}
+
+int asn1_cursor_get_tlv(const ASN1_CURSOR *cur, size_t index, const uint8_t **a, size_t *alen)
+{
+	if (!cur || !a || !alen) {
+		error_print();
+		return -1;
+	}
+	if (index >= cur->fields_cnt) {
+		*a = NULL;
+		*alen = 0;
+		return 0;
+	}
+	*a = cur->fields[index].a;
+	*alen = (size_t)(cur->fields[index].d + cur->fields[index].dlen - cur->fields[index].a);
+	return 1;
+}
+
 int asn1_check(int expr)
 {
 	if (expr)
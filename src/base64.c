@@ -13,6 +13,7 @@
 #include <string.h>
 #include <limits.h>
 #include <assert.h>
+#include <gmssl/cpu.h>
 #include <gmssl/base64.h>
 #include <gmssl/error.h>
 
@@ -155,6 +156,28 @@ int base64_encode_block(unsigned char *t, const unsigned char *f, int dlen)
 {
     int i, ret = 0;
     unsigned long l;
+    int nblocks = 0;
+
+#if defined(ENABLE_BASE64_AVX2)
+    if (dlen >= 24 && (gmssl_cpu_features() & GMSSL_CPU_AVX2)) {
+        nblocks = dlen / 24;
+        base64_avx2_encode_blocks(t, f, (size_t)nblocks);
+        t += nblocks * 32;
+        f += nblocks * 24;
+        dlen -= nblocks * 24;
+        ret += nblocks * 32;
+    }
+#elif defined(ENABLE_BASE64_NEON)
+    if (dlen >= 48 && (gmssl_cpu_features() & GMSSL_CPU_NEON)) {
+        nblocks = dlen / 48;
+        base64_neon_encode_blocks(t, f, (size_t)nblocks);
+        t += nblocks * 64;
+        f += nblocks * 48;
+        dlen -= nblocks * 48;
+        ret += nblocks * 64;
+    }
+#endif
+    (void)nblocks;
 
     for (i = dlen; i > 0; i -= 3) {
         if (i >= 3) {
@@ -232,6 +255,19 @@ int base64_decode_update(BASE64_CTX *ctx, const uint8_t *in, int inl, uint8_t *o
     }
 
     for (i = 0; i < inl; i++) {
+        /*
+         * Whole groups of alphabet characters at a group boundary are decoded
+         * in place, they do not need the per character checks below.
+         */
+        if (n == 0 && eof == 0 && inl - i >= 4) {
+            decoded_len = (int)base64_decode_run(out, in, (size_t)(inl - i));
+            in += decoded_len;
+            i += decoded_len;
+            out += decoded_len / 4 * 3;
+            ret += decoded_len / 4 * 3;
+            if (i == inl)
+                break;
+        }
         tmp = *(in++);
         v = conv_ascii2bin(tmp);
         if (v == B64_ERROR) {
@@ -341,7 +377,13 @@ int base64_decode_block(unsigned char *t, const unsigned char *f, int n)
     if (n % 4 != 0)
         return (-1);
 
-    for (i = 0; i < n; i += 4) {
+    /* the bulk without padding, the scalar loop does the rest */
+    i = (int)base64_decode_run(t, f, n);
+    t += i / 4 * 3;
+    f += i;
+    ret = i / 4 * 3;
+
+    for (; i < n; i += 4) {
         a = conv_ascii2bin(*(f++));
         b = conv_ascii2bin(*(f++));
         c = conv_ascii2bin(*(f++));
@@ -359,6 +401,43 @@ int base64_decode_block(unsigned char *t, const unsigned char *f, int n)
     return (ret);
 }
 
+size_t base64_decode_run(uint8_t *out, const uint8_t *in, size_t inlen)
+{
+    size_t n = 0;
+    size_t nblocks;
+    unsigned char a, b, c, d;
+
+    (void)nblocks;
+#if defined(ENABLE_BASE64_AVX2)
+    if (inlen >= 32 && (gmssl_cpu_features() & GMSSL_CPU_AVX2)) {
+        nblocks = base64_avx2_decode_blocks(out, in, inlen / 32);
+        n = nblocks * 32;
+        out += nblocks * 24;
+    }
+#elif defined(ENABLE_BASE64_NEON)
+    if (inlen >= 64 && (gmssl_cpu_features() & GMSSL_CPU_NEON)) {
+        nblocks = base64_neon_decode_blocks(out, in, inlen / 64);
+        n = nblocks * 64;
+        out += nblocks * 48;
+    }
+#endif
+
+    /* '=' is the only non-alphabet character mapped to a value */
+    for (; inlen - n >= 4; n += 4) {
+        a = conv_ascii2bin(in[n]);
+        b = conv_ascii2bin(in[n + 1]);
+        c = conv_ascii2bin(in[n + 2]);
+        d = conv_ascii2bin(in[n + 3]);
+        if (((a | b | c | d) & 0x80)
+            || in[n] == '=' || in[n + 1] == '=' || in[n + 2] == '=' || in[n + 3] == '=')
+            break;
+        *(out++) = (unsigned char)((a << 2) | (b >> 4));
+        *(out++) = (unsigned char)((b << 4) | (c >> 2));
+        *(out++) = (unsigned char)((c << 6) | d);
+    }
+    return n;
+}
+
 int base64_decode_finish(BASE64_CTX *ctx, uint8_t *out, int *outl)
 {
     int i;
@@ -0,0 +1,102 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <gmssl/base64.h>
+#include <immintrin.h>
+
+
+/*
+ * Base64 with AVX2, the vpshufb based encoder and decoder of W. Mula and
+ * D. Lemire, "Faster Base64 Encoding and Decoding Using AVX2 Instructions".
+ * Every block is 24 bytes and 32 characters, the two 128-bit lanes hold
+ * 12 bytes and 16 characters each.
+ */
+
+void base64_avx2_encode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+	// bytes [b1 b0 b2 b1] of every 3-byte group in a 32-bit word
+	const __m256i shuf = _mm256_setr_epi8(
+		1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+		5, 4, 6, 5, 8, 7, 9, 8, 11, 10, 12, 11, 14, 13, 15, 14);
+	const __m256i shift_lut = _mm256_setr_epi8(
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0,
+		'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+		'0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+	__m256i x, t0, t1, t2, t3, r;
+
+	while (nblocks--) {
+		// the high lane is loaded from in + 8, so no byte after in + 24 is read
+		x = _mm256_inserti128_si256(_mm256_castsi128_si256(_mm_loadu_si128((const __m128i *)in)),
+			_mm_loadu_si128((const __m128i *)(in + 8)), 1);
+		x = _mm256_shuffle_epi8(x, shuf);
+
+		// split every 24 bits into four 6-bit indexes, one per byte
+		t0 = _mm256_and_si256(x, _mm256_set1_epi32(0x0fc0fc00));
+		t1 = _mm256_mulhi_epu16(t0, _mm256_set1_epi32(0x04000040));
+		t2 = _mm256_and_si256(x, _mm256_set1_epi32(0x003f03f0));
+		t3 = _mm256_mullo_epi16(t2, _mm256_set1_epi32(0x01000010));
+		x = _mm256_or_si256(t1, t3);
+
+		// 0 for 26..51, 1..12 for 52..63, 13 for 0..25
+		r = _mm256_subs_epu8(x, _mm256_set1_epi8(51));
+		r = _mm256_or_si256(r, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), x), _mm256_set1_epi8(13)));
+		x = _mm256_add_epi8(x, _mm256_shuffle_epi8(shift_lut, r));
+
+		_mm256_storeu_si256((__m256i *)out, x);
+		in += 24;
+		out += 32;
+	}
+}
+
+size_t base64_avx2_decode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+	// a character is in the alphabet iff the lut_lo and lut_hi entries share no bit
+	const __m256i lut_lo = _mm256_setr_epi8(
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a,
+		0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+	const __m256i lut_hi = _mm256_setr_epi8(
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+		0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+	const __m256i lut_roll = _mm256_setr_epi8(
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+		0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+	const __m256i mask_2f = _mm256_set1_epi8(0x2f);
+	const __m256i pack = _mm256_setr_epi8(
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+		2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	__m256i x, hi, lo, roll;
+	size_t i;
+
+	for (i = 0; i < nblocks; i++) {
+		x = _mm256_loadu_si256((const __m256i *)in);
+
+		hi = _mm256_and_si256(_mm256_srli_epi32(x, 4), mask_2f);
+		lo = _mm256_and_si256(x, mask_2f);
+		if (!_mm256_testz_si256(_mm256_shuffle_epi8(lut_lo, lo), _mm256_shuffle_epi8(lut_hi, hi))) {
+			break;
+		}
+		roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(_mm256_cmpeq_epi8(x, mask_2f), hi));
+		x = _mm256_add_epi8(x, roll);
+
+		// four 6-bit values to 24 bits in every 32-bit word, then 12 bytes per lane
+		x = _mm256_maddubs_epi16(x, _mm256_set1_epi32(0x01400140));
+		x = _mm256_madd_epi16(x, _mm256_set1_epi32(0x00011000));
+		x = _mm256_shuffle_epi8(x, pack);
+		x = _mm256_permutevar8x32_epi32(x, _mm256_setr_epi32(0, 1, 2, 4, 5, 6, 3, 7));
+
+		_mm_storeu_si128((__m128i *)out, _mm256_castsi256_si128(x));
+		_mm_storel_epi64((__m128i *)(out + 16), _mm256_extracti128_si256(x, 1));
+		in += 32;
+		out += 24;
+	}
+	return i;
+}
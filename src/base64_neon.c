@@ -0,0 +1,112 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <gmssl/base64.h>
+#include <arm_neon.h>
+
+
+/*
+ * Base64 with AArch64 NEON. Every block is 48 bytes and 64 characters,
+ * vld3q/vst4q (vld4q/vst3q) do the (de)interleaving and the 64-entry
+ * table lookups are single TBL instructions.
+ */
+
+static const uint8_t enc_table[64] = {
+	'A', 'B', 'C', 'D', 'E', 'F', 'G', 'H', 'I', 'J', 'K', 'L', 'M', 'N', 'O', 'P',
+	'Q', 'R', 'S', 'T', 'U', 'V', 'W', 'X', 'Y', 'Z', 'a', 'b', 'c', 'd', 'e', 'f',
+	'g', 'h', 'i', 'j', 'k', 'l', 'm', 'n', 'o', 'p', 'q', 'r', 's', 't', 'u', 'v',
+	'w', 'x', 'y', 'z', '0', '1', '2', '3', '4', '5', '6', '7', '8', '9', '+', '/',
+};
+
+// values of the characters 0..127, 0xff for the others
+static const uint8_t dec_table[128] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+void base64_neon_encode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+	uint8x16x4_t table;
+	uint8x16x3_t x;
+	uint8x16x4_t y;
+
+	table.val[0] = vld1q_u8(enc_table);
+	table.val[1] = vld1q_u8(enc_table + 16);
+	table.val[2] = vld1q_u8(enc_table + 32);
+	table.val[3] = vld1q_u8(enc_table + 48);
+
+	while (nblocks--) {
+		x = vld3q_u8(in);
+		y.val[0] = vshrq_n_u8(x.val[0], 2);
+		y.val[1] = vandq_u8(vorrq_u8(vshlq_n_u8(x.val[0], 4), vshrq_n_u8(x.val[1], 4)), vdupq_n_u8(0x3f));
+		y.val[2] = vandq_u8(vorrq_u8(vshlq_n_u8(x.val[1], 2), vshrq_n_u8(x.val[2], 6)), vdupq_n_u8(0x3f));
+		y.val[3] = vandq_u8(x.val[2], vdupq_n_u8(0x3f));
+
+		y.val[0] = vqtbl4q_u8(table, y.val[0]);
+		y.val[1] = vqtbl4q_u8(table, y.val[1]);
+		y.val[2] = vqtbl4q_u8(table, y.val[2]);
+		y.val[3] = vqtbl4q_u8(table, y.val[3]);
+		vst4q_u8(out, y);
+		in += 48;
+		out += 64;
+	}
+}
+
+// TBL gives 0 for the indexes >= 64 and TBX keeps them, the characters >= 128 are caught by `err`
+#define DECODE(c, v, err)								\
+	v = vqtbx4q_u8(vqtbl4q_u8(table_lo, c), table_hi, vsubq_u8(c, vdupq_n_u8(64)));	\
+	err = vorrq_u8(err, vorrq_u8(v, c))
+
+size_t base64_neon_decode_blocks(uint8_t *out, const uint8_t *in, size_t nblocks)
+{
+	uint8x16x4_t table_lo;
+	uint8x16x4_t table_hi;
+	uint8x16x4_t x;
+	uint8x16x4_t v;
+	uint8x16x3_t y;
+	uint8x16_t err;
+	size_t i;
+
+	table_lo.val[0] = vld1q_u8(dec_table);
+	table_lo.val[1] = vld1q_u8(dec_table + 16);
+	table_lo.val[2] = vld1q_u8(dec_table + 32);
+	table_lo.val[3] = vld1q_u8(dec_table + 48);
+	table_hi.val[0] = vld1q_u8(dec_table + 64);
+	table_hi.val[1] = vld1q_u8(dec_table + 80);
+	table_hi.val[2] = vld1q_u8(dec_table + 96);
+	table_hi.val[3] = vld1q_u8(dec_table + 112);
+
+	for (i = 0; i < nblocks; i++) {
+		x = vld4q_u8(in);
+		err = vdupq_n_u8(0);
+		DECODE(x.val[0], v.val[0], err);
+		DECODE(x.val[1], v.val[1], err);
+		DECODE(x.val[2], v.val[2], err);
+		DECODE(x.val[3], v.val[3], err);
+		if (vmaxvq_u8(err) & 0x80) {
+			break;
+		}
+
+		y.val[0] = vorrq_u8(vshlq_n_u8(v.val[0], 2), vshrq_n_u8(v.val[1], 4));
+		y.val[1] = vorrq_u8(vshlq_n_u8(v.val[1], 4), vshrq_n_u8(v.val[2], 2));
+		y.val[2] = vorrq_u8(vshlq_n_u8(v.val[2], 6), v.val[3]);
+		vst3q_u8(out, y);
+		in += 64;
+		out += 48;
+	}
+	return i;
+}
@@ -15,6 +15,7 @@
 #include <gmssl/oid.h>
 #include <gmssl/block_cipher.h>
 #include <gmssl/endian.h>
+#include <gmssl/error.h>
 
 
 int block_cipher_set_encrypt_key(BLOCK_CIPHER_KEY *key, const BLOCK_CIPHER *cipher, const uint8_t *raw_key)
@@ -35,12 +36,20 @@ int block_cipher_set_decrypt_key(BLOCK_CIPHER_KEY *key, const BLOCK_CIPHER *ciph
 
 int block_cipher_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t *in, uint8_t *out)
 {
+	if (!key->cipher->encrypt) {
+		error_print();
+		return -1;
+	}
 	key->cipher->encrypt(key, in, out);
 	return 1;
 }
 
 int block_cipher_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t *in, uint8_t *out)
 {
+	if (!key->cipher->decrypt) {
+		error_print();
+		return -1;
+	}
 	key->cipher->decrypt(key, in, out);
 	return 1;
 }
@@ -53,6 +62,8 @@ static const BLOCK_CIPHER sm4_block_cipher_object = {
 	(block_cipher_set_decrypt_key_func)sm4_set_decrypt_key,
 	(block_cipher_encrypt_func)sm4_encrypt,
 	(block_cipher_decrypt_func)sm4_encrypt,
+	(block_cipher_aead_encrypt_func)sm4_gcm_encrypt,
+	(block_cipher_aead_decrypt_func)sm4_gcm_decrypt,
 };
 
 const BLOCK_CIPHER *BLOCK_CIPHER_sm4(void) {
@@ -60,25 +71,49 @@ const BLOCK_CIPHER *BLOCK_CIPHER_sm4(void) {
 }
 
 #ifdef ENABLE_AES
-static int aes128_set_encrypt_key(AES_KEY *aes_key, const uint8_t key[16]) {
-	return aes_set_encrypt_key(aes_key, key, 16);
+static void aes128_set_encrypt_key(BLOCK_CIPHER_KEY *key, const uint8_t raw_key[AES128_KEY_SIZE]) {
+	aes_set_encrypt_key(&key->u.aes_key, raw_key, AES128_KEY_SIZE);
 }
 
-static int aes128_set_decrypt_key(AES_KEY *aes_key, const uint8_t key[16]) {
-	return aes_set_decrypt_key(aes_key, key, 16);
+static void aes128_set_decrypt_key(BLOCK_CIPHER_KEY *key, const uint8_t raw_key[AES128_KEY_SIZE]) {
+	aes_set_decrypt_key(&key->u.aes_key, raw_key, AES128_KEY_SIZE);
 }
 
 static const BLOCK_CIPHER aes128_block_cipher_object = {
 	OID_aes128,
 	AES128_KEY_SIZE,
 	AES_BLOCK_SIZE,
-	(block_cipher_set_encrypt_key_func)aes128_set_encrypt_key,
-	(block_cipher_set_decrypt_key_func)aes128_set_decrypt_key,
+	aes128_set_encrypt_key,
+	aes128_set_decrypt_key,
 	(block_cipher_encrypt_func)aes_encrypt,
 	(block_cipher_decrypt_func)aes_encrypt,
+	(block_cipher_aead_encrypt_func)aes_gcm_encrypt,
+	(block_cipher_aead_decrypt_func)aes_gcm_decrypt,
 };
 
 const BLOCK_CIPHER *BLOCK_CIPHER_aes128(void) {
 	return &aes128_block_cipher_object;
 }
 #endif // ENABLE_AES
+
+#ifdef ENABLE_CHACHA20
+static void chacha20_set_key(BLOCK_CIPHER_KEY *key, const uint8_t raw_key[CHACHA20_KEY_SIZE]) {
+	memcpy(key->u.chacha20_key, raw_key, CHACHA20_KEY_SIZE);
+}
+
+static const BLOCK_CIPHER chacha20_block_cipher_object = {
+	OID_chacha20,
+	CHACHA20_KEY_SIZE,
+	CHACHA20_BLOCK_SIZE,
+	chacha20_set_key,
+	chacha20_set_key,
+	NULL,
+	NULL,
+	(block_cipher_aead_encrypt_func)chacha20_poly1305_encrypt,
+	(block_cipher_aead_decrypt_func)chacha20_poly1305_decrypt,
+};
+
+const BLOCK_CIPHER *BLOCK_CIPHER_chacha20(void) {
+	return &chacha20_block_cipher_object;
+}
+#endif // ENABLE_CHACHA20
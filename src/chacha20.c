@@ -13,6 +13,8 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/chacha20.h>
+#include <gmssl/mem.h>
+#include <gmssl/cpu.h>
 #include <gmssl/endian.h>
 
 
@@ -65,7 +67,7 @@ void chacha20_init(CHACHA20_STATE *state,
 	QR(S[2], S[7], S[ 8], S[13]);  \
 	QR(S[3], S[4], S[ 9], S[14])
 
-void chacha20_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out)
+static void chacha20_generic_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out)
 {
 	uint32_t working_state[16];
 	int i;
@@ -83,3 +85,74 @@ void chacha20_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *
 		state->d[12]++;
 	}
 }
+
+/*
+ * Runtime selection of the keystream function
+ *
+ * With ENABLE_CHACHA20_AVX2 eight blocks and with ENABLE_CHACHA20_NEON four
+ * blocks are generated in parallel, one block per vector lane, when the CPU
+ * reports the extension, see `gmssl_cpu_features`. The code above is the
+ * fallback.
+ */
+
+typedef void (*chacha20_generate_keystream_func)(CHACHA20_STATE *state, size_t counts, uint8_t *out);
+
+static chacha20_generate_keystream_func chacha20_generate_keystream_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void chacha20_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	chacha20_generate_keystream_func generate_keystream = chacha20_generic_generate_keystream;
+
+	(void)cpu;
+
+#ifdef ENABLE_CHACHA20_AVX2
+	if (cpu & GMSSL_CPU_AVX2) {
+		generate_keystream = chacha20_avx2_generate_keystream;
+	}
+#endif
+#ifdef ENABLE_CHACHA20_NEON
+	if (cpu & GMSSL_CPU_NEON) {
+		generate_keystream = chacha20_neon_generate_keystream;
+	}
+#endif
+
+	chacha20_generate_keystream_impl = generate_keystream;
+}
+
+void chacha20_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out)
+{
+	if (!chacha20_generate_keystream_impl) {
+		chacha20_dispatch_init();
+	}
+	chacha20_generate_keystream_impl(state, counts, out);
+}
+
+#define CHACHA20_BATCH_BLOCKS	8
+
+// a trailing partial block consumes a whole counter, so only the last call may be partial
+void chacha20_encrypt(CHACHA20_STATE *state, const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	uint8_t keystream[CHACHA20_BLOCK_SIZE * CHACHA20_BATCH_BLOCKS];
+	size_t counts, len;
+
+	while (inlen) {
+		counts = (inlen + CHACHA20_BLOCK_SIZE - 1) / CHACHA20_BLOCK_SIZE;
+		if (counts > CHACHA20_BATCH_BLOCKS) {
+			counts = CHACHA20_BATCH_BLOCKS;
+		}
+		len = counts * CHACHA20_BLOCK_SIZE;
+		if (len > inlen) {
+			len = inlen;
+		}
+		chacha20_generate_keystream(state, counts, keystream);
+		gmssl_memxor(out, in, keystream, len);
+		in += len;
+		out += len;
+		inlen -= len;
+	}
+	gmssl_secure_clear(keystream, sizeof(keystream));
+}
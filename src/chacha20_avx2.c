@@ -0,0 +1,114 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * ChaCha20 with AVX2
+ *
+ * Register i holds state word i of eight blocks, lane j is the block with
+ * counter + j, so a quarter round is the scalar one on eight lanes. The
+ * 16- and 8-bit rotations are byte shuffles. The words are transposed back
+ * into blocks with an 8x8 transpose of 32-bit lanes on words 0..7 and 8..15.
+ */
+
+#include <gmssl/chacha20.h>
+#include <gmssl/mem.h>
+#include <immintrin.h>
+
+
+#define ROTL16(x) _mm256_shuffle_epi8(x, rot16)
+#define ROTL8(x)  _mm256_shuffle_epi8(x, rot8)
+#define ROTL(x, n) _mm256_or_si256(_mm256_slli_epi32(x, n), _mm256_srli_epi32(x, 32 - (n)))
+
+#define QR(a, b, c, d)							\
+	a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = ROTL16(d);	\
+	c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = ROTL(b, 12);	\
+	a = _mm256_add_epi32(a, b); d = _mm256_xor_si256(d, a); d = ROTL8(d);	\
+	c = _mm256_add_epi32(c, d); b = _mm256_xor_si256(b, c); b = ROTL(b, 7)
+
+// 4x4 transpose of 32-bit words inside both 128-bit halves
+#define TRANSPOSE4(x0, x1, x2, x3)					\
+	t0 = _mm256_unpacklo_epi32(x0, x1);				\
+	t1 = _mm256_unpackhi_epi32(x0, x1);				\
+	t2 = _mm256_unpacklo_epi32(x2, x3);				\
+	t3 = _mm256_unpackhi_epi32(x2, x3);				\
+	x0 = _mm256_unpacklo_epi64(t0, t2);				\
+	x1 = _mm256_unpackhi_epi64(t0, t2);				\
+	x2 = _mm256_unpacklo_epi64(t1, t3);				\
+	x3 = _mm256_unpackhi_epi64(t1, t3)
+
+// the 32-byte halves of blocks j and j + 4 from words 0..3 in `a` and words 4..7 in `b`
+#define STORE2(p, j, a, b)								\
+	_mm256_storeu_si256((__m256i *)((p) + 64 * (j)), _mm256_permute2x128_si256(a, b, 0x20));	\
+	_mm256_storeu_si256((__m256i *)((p) + 64 * ((j) + 4)), _mm256_permute2x128_si256(a, b, 0x31))
+
+static void chacha20_avx2_blocks8(const CHACHA20_STATE *state, uint8_t out[CHACHA20_BLOCK_SIZE * 8])
+{
+	const __m256i rot16 = _mm256_set_epi8(
+		13,12,15,14, 9,8,11,10, 5,4,7,6, 1,0,3,2,
+		13,12,15,14, 9,8,11,10, 5,4,7,6, 1,0,3,2);
+	const __m256i rot8 = _mm256_set_epi8(
+		14,13,12,15, 10,9,8,11, 6,5,4,7, 2,1,0,3,
+		14,13,12,15, 10,9,8,11, 6,5,4,7, 2,1,0,3);
+	__m256i s[16], x[16];
+	__m256i t0, t1, t2, t3;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		s[i] = _mm256_set1_epi32((int)state->d[i]);
+	}
+	s[12] = _mm256_add_epi32(s[12], _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0));
+
+	for (i = 0; i < 16; i++) {
+		x[i] = s[i];
+	}
+	for (i = 0; i < 10; i++) {
+		QR(x[0], x[4], x[ 8], x[12]);
+		QR(x[1], x[5], x[ 9], x[13]);
+		QR(x[2], x[6], x[10], x[14]);
+		QR(x[3], x[7], x[11], x[15]);
+		QR(x[0], x[5], x[10], x[15]);
+		QR(x[1], x[6], x[11], x[12]);
+		QR(x[2], x[7], x[ 8], x[13]);
+		QR(x[3], x[4], x[ 9], x[14]);
+	}
+	for (i = 0; i < 16; i++) {
+		x[i] = _mm256_add_epi32(x[i], s[i]);
+	}
+
+	TRANSPOSE4(x[ 0], x[ 1], x[ 2], x[ 3]);
+	TRANSPOSE4(x[ 4], x[ 5], x[ 6], x[ 7]);
+	TRANSPOSE4(x[ 8], x[ 9], x[10], x[11]);
+	TRANSPOSE4(x[12], x[13], x[14], x[15]);
+
+	for (i = 0; i < 4; i++) {
+		STORE2(out, i, x[i], x[i + 4]);
+		STORE2(out + 32, i, x[i + 8], x[i + 12]);
+	}
+
+	gmssl_secure_clear(x, sizeof(x));
+	gmssl_secure_clear(s, sizeof(s));
+}
+
+void chacha20_avx2_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out)
+{
+	uint8_t buf[CHACHA20_BLOCK_SIZE * 8];
+
+	while (counts >= 8) {
+		chacha20_avx2_blocks8(state, out);
+		state->d[12] += 8;
+		out += sizeof(buf);
+		counts -= 8;
+	}
+	if (counts) {
+		chacha20_avx2_blocks8(state, buf);
+		memcpy(out, buf, CHACHA20_BLOCK_SIZE * counts);
+		state->d[12] += (uint32_t)counts;
+		gmssl_secure_clear(buf, sizeof(buf));
+	}
+}
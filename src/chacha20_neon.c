@@ -0,0 +1,100 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * ChaCha20 with AArch64 NEON
+ *
+ * Register i holds state word i of four blocks, lane j is the block with
+ * counter + j, as in chacha20_avx2.c. The 16-bit rotation is a REV32 of the
+ * halfwords, the others are a shift and a shift-right-insert.
+ */
+
+#include <arm_neon.h>
+#include <gmssl/chacha20.h>
+#include <gmssl/mem.h>
+
+
+#define ROTL16(x) vreinterpretq_u32_u16(vrev32q_u16(vreinterpretq_u16_u32(x)))
+#define ROTL(x, n) vsriq_n_u32(vshlq_n_u32(x, n), x, 32 - (n))
+
+#define QR(a, b, c, d)						\
+	a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL16(d);	\
+	c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 12);	\
+	a = vaddq_u32(a, b); d = veorq_u32(d, a); d = ROTL(d, 8);	\
+	c = vaddq_u32(c, d); b = veorq_u32(b, c); b = ROTL(b, 7)
+
+// words 4i..4i+3 of the four blocks, block j goes to offset 64 * j + 16 * i
+#define STORE4(p, i, x0, x1, x2, x3)						\
+	do {									\
+		uint32x4x2_t a_ = vtrnq_u32(x0, x1);				\
+		uint32x4x2_t b_ = vtrnq_u32(x2, x3);				\
+		vst1q_u8((p) +       16 * (i), vreinterpretq_u8_u32(		\
+			vcombine_u32(vget_low_u32(a_.val[0]), vget_low_u32(b_.val[0]))));	\
+		vst1q_u8((p) +  64 + 16 * (i), vreinterpretq_u8_u32(		\
+			vcombine_u32(vget_low_u32(a_.val[1]), vget_low_u32(b_.val[1]))));	\
+		vst1q_u8((p) + 128 + 16 * (i), vreinterpretq_u8_u32(		\
+			vcombine_u32(vget_high_u32(a_.val[0]), vget_high_u32(b_.val[0]))));	\
+		vst1q_u8((p) + 192 + 16 * (i), vreinterpretq_u8_u32(		\
+			vcombine_u32(vget_high_u32(a_.val[1]), vget_high_u32(b_.val[1]))));	\
+	} while (0)
+
+static void chacha20_neon_blocks4(const CHACHA20_STATE *state, uint8_t out[CHACHA20_BLOCK_SIZE * 4])
+{
+	const uint32_t lanes[4] = { 0, 1, 2, 3 };
+	uint32x4_t s[16], x[16];
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		s[i] = vdupq_n_u32(state->d[i]);
+	}
+	s[12] = vaddq_u32(s[12], vld1q_u32(lanes));
+
+	for (i = 0; i < 16; i++) {
+		x[i] = s[i];
+	}
+	for (i = 0; i < 10; i++) {
+		QR(x[0], x[4], x[ 8], x[12]);
+		QR(x[1], x[5], x[ 9], x[13]);
+		QR(x[2], x[6], x[10], x[14]);
+		QR(x[3], x[7], x[11], x[15]);
+		QR(x[0], x[5], x[10], x[15]);
+		QR(x[1], x[6], x[11], x[12]);
+		QR(x[2], x[7], x[ 8], x[13]);
+		QR(x[3], x[4], x[ 9], x[14]);
+	}
+	for (i = 0; i < 16; i++) {
+		x[i] = vaddq_u32(x[i], s[i]);
+	}
+
+	STORE4(out, 0, x[ 0], x[ 1], x[ 2], x[ 3]);
+	STORE4(out, 1, x[ 4], x[ 5], x[ 6], x[ 7]);
+	STORE4(out, 2, x[ 8], x[ 9], x[10], x[11]);
+	STORE4(out, 3, x[12], x[13], x[14], x[15]);
+
+	gmssl_secure_clear(x, sizeof(x));
+	gmssl_secure_clear(s, sizeof(s));
+}
+
+void chacha20_neon_generate_keystream(CHACHA20_STATE *state, size_t counts, uint8_t *out)
+{
+	uint8_t buf[CHACHA20_BLOCK_SIZE * 4];
+
+	while (counts >= 4) {
+		chacha20_neon_blocks4(state, out);
+		state->d[12] += 4;
+		out += sizeof(buf);
+		counts -= 4;
+	}
+	if (counts) {
+		chacha20_neon_blocks4(state, buf);
+		memcpy(out, buf, CHACHA20_BLOCK_SIZE * counts);
+		state->d[12] += (uint32_t)counts;
+		gmssl_secure_clear(buf, sizeof(buf));
+	}
+}
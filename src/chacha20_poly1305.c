@@ -0,0 +1,111 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <gmssl/chacha20.h>
+#include <gmssl/poly1305.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+/*
+ * The one-time Poly1305 key is the first half of keystream block 0, the
+ * payload is encrypted from block 1 on. The MAC input is
+ * aad || pad16 || ciphertext || pad16 || le64(aadlen) || le64(inlen).
+ */
+
+static const uint8_t zeros[POLY1305_BLOCK_SIZE] = {0};
+
+static void chacha20_poly1305_init(CHACHA20_STATE *state, POLY1305_CTX *poly_ctx,
+	const uint8_t key[CHACHA20_KEY_SIZE], const uint8_t iv[CHACHA20_NONCE_SIZE],
+	const uint8_t *aad, size_t aadlen)
+{
+	uint8_t block[CHACHA20_BLOCK_SIZE];
+
+	chacha20_init(state, key, iv, 0);
+	chacha20_generate_keystream(state, 1, block);
+	poly1305_init(poly_ctx, block);
+	gmssl_secure_clear(block, sizeof(block));
+
+	poly1305_update(poly_ctx, aad, aadlen);
+	poly1305_update(poly_ctx, zeros, (POLY1305_BLOCK_SIZE - aadlen % POLY1305_BLOCK_SIZE) % POLY1305_BLOCK_SIZE);
+}
+
+static void chacha20_poly1305_finish(POLY1305_CTX *poly_ctx, size_t aadlen, size_t inlen,
+	uint8_t tag[POLY1305_TAG_SIZE])
+{
+	uint8_t lens[16];
+
+	poly1305_update(poly_ctx, zeros, (POLY1305_BLOCK_SIZE - inlen % POLY1305_BLOCK_SIZE) % POLY1305_BLOCK_SIZE);
+	PUTU64_LE(lens, (uint64_t)aadlen);
+	PUTU64_LE(lens + 8, (uint64_t)inlen);
+	poly1305_update(poly_ctx, lens, sizeof(lens));
+	poly1305_finish(poly_ctx, tag);
+}
+
+int chacha20_poly1305_encrypt(const uint8_t key[CHACHA20_KEY_SIZE],
+	const uint8_t *iv, size_t ivlen, const uint8_t *aad, size_t aadlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t taglen, uint8_t *tag)
+{
+	CHACHA20_STATE state;
+	POLY1305_CTX poly_ctx;
+	uint8_t T[POLY1305_TAG_SIZE];
+
+	if (ivlen != CHACHA20_NONCE_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (taglen > CHACHA20_POLY1305_MAX_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	chacha20_poly1305_init(&state, &poly_ctx, key, iv, aad, aadlen);
+	chacha20_encrypt(&state, in, inlen, out);
+	poly1305_update(&poly_ctx, out, inlen);
+	chacha20_poly1305_finish(&poly_ctx, aadlen, inlen, T);
+	memcpy(tag, T, taglen);
+
+	gmssl_secure_clear(&state, sizeof(state));
+	return 1;
+}
+
+int chacha20_poly1305_decrypt(const uint8_t key[CHACHA20_KEY_SIZE],
+	const uint8_t *iv, size_t ivlen, const uint8_t *aad, size_t aadlen,
+	const uint8_t *in, size_t inlen, const uint8_t *tag, size_t taglen, uint8_t *out)
+{
+	CHACHA20_STATE state;
+	POLY1305_CTX poly_ctx;
+	uint8_t T[POLY1305_TAG_SIZE];
+
+	if (ivlen != CHACHA20_NONCE_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (taglen > CHACHA20_POLY1305_MAX_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// the ciphertext is authenticated before anything is written to `out`
+	chacha20_poly1305_init(&state, &poly_ctx, key, iv, aad, aadlen);
+	poly1305_update(&poly_ctx, in, inlen);
+	chacha20_poly1305_finish(&poly_ctx, aadlen, inlen, T);
+	if (gmssl_secure_memcmp(T, tag, taglen) != 0) {
+		gmssl_secure_clear(&state, sizeof(state));
+		error_print();
+		return -1;
+	}
+	chacha20_encrypt(&state, in, inlen, out);
+
+	gmssl_secure_clear(&state, sizeof(state));
+	return 1;
+}
@@ -12,6 +12,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <limits.h>
+#include <gmssl/mem.h>
 #include <gmssl/asn1.h>
 #include <gmssl/aes.h>
 #include <gmssl/sm4.h>
@@ -26,6 +28,7 @@
 #include <gmssl/rand.h>
 #include <gmssl/pem.h>
 #include <gmssl/cms.h>
+#include <gmssl/thread_pool.h>
 
 
 
@@ -159,15 +162,14 @@ int cms_content_info_to_der(
 	int content_type, const uint8_t *content, size_t content_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (content_type == OID_cms_data) {
 		return cms_content_info_data_to_der(content, content_len, out, outlen);
 	}
-	if (cms_content_type_to_der(content_type, NULL, &len) != 1
-		|| asn1_explicit_to_der(0, content, content_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| cms_content_type_to_der(content_type, out, outlen) != 1
-		|| asn1_explicit_to_der(0, content, content_len, out, outlen) < 0) {
+		|| asn1_explicit_to_der(0, content, content_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -222,7 +224,11 @@ int cms_content_info_print(FILE *fp, int fmt, int ind, const char *label, const
 	//format_bytes(stderr, 0, 0, "content", d, dlen);
 
 	if ((ret = asn1_explicit_from_der(0, &content, &content_len, &d, &dlen)) < 0) { error_print(); goto err; }
-	if (ret == 0) { error_print(); goto err; }
+	if (ret == 0) {
+		// detached content, as in the SignedData of cms_sign_digest()
+		if (asn1_length_is_zero(dlen) != 1) goto err;
+		return 1;
+	}
 
 	if (content_type == OID_cms_data) {
 		if (asn1_octet_string_from_der(&p, &len, &content, &content_len) != 1
@@ -263,18 +269,14 @@ int cms_enced_content_info_to_der(
 	const uint8_t *shared_info2, size_t shared_info2_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (cms_content_type_to_der(content_type, NULL, &len) != 1
-		|| x509_encryption_algor_to_der(enc_algor, enc_iv, enc_iv_len, NULL, &len) != 1
-		|| asn1_implicit_octet_string_to_der(0, enced_content, enced_content_len, NULL, &len) < 0
-		|| asn1_implicit_octet_string_to_der(1, shared_info1, shared_info1_len, NULL, &len) < 0
-		|| asn1_implicit_octet_string_to_der(2, shared_info2, shared_info2_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| cms_content_type_to_der(content_type, out, outlen) != 1
 		|| x509_encryption_algor_to_der(enc_algor, enc_iv, enc_iv_len, out, outlen) != 1
 		|| asn1_implicit_octet_string_to_der(0, enced_content, enced_content_len, out, outlen) < 0
 		|| asn1_implicit_octet_string_to_der(1, shared_info1, shared_info1_len, out, outlen) < 0
-		|| asn1_implicit_octet_string_to_der(2, shared_info2, shared_info2_len, out, outlen) < 0) {
+		|| asn1_implicit_octet_string_to_der(2, shared_info2, shared_info2_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -431,20 +433,12 @@ int cms_encrypted_data_to_der(
 	const uint8_t *shared_info2, size_t shared_info2_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (version != 1) {
 		error_print();
 		return -1;
 	}
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| cms_enced_content_info_to_der(
-			content_type,
-			enc_algor, iv, ivlen,
-			enced_content, enced_content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| cms_enced_content_info_to_der(
 			content_type,
@@ -452,7 +446,8 @@ int cms_encrypted_data_to_der(
 			enced_content, enced_content_len,
 			shared_info1, shared_info1_len,
 			shared_info2, shared_info2_len,
-			NULL, &len) != 1) {
+			out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -522,22 +517,16 @@ int cms_encrypted_data_encrypt_to_der(
 	const uint8_t *shared_info2, size_t shared_info2_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(CMS_version_v1, NULL, &len) != 1
-		|| cms_enced_content_info_encrypt_to_der(
-			enc_algor, key, keylen, iv, ivlen,
-			content_type, content, content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
 		|| cms_enced_content_info_encrypt_to_der(
 			enc_algor, key, keylen, iv, ivlen,
 			content_type, content, content_len,
 			shared_info1, shared_info1_len,
 			shared_info2, shared_info2_len,
-			out, outlen) != 1) {
+			out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -579,12 +568,11 @@ int cms_issuer_and_serial_number_to_der(
 	const uint8_t *serial_number, size_t serial_number_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_sequence_to_der(issuer, issuer_len, NULL, &len) != 1
-		|| asn1_integer_to_der(serial_number, serial_number_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_sequence_to_der(issuer, issuer_len, out, outlen) != 1
-		|| asn1_integer_to_der(serial_number, serial_number_len, out, outlen) != 1) {
+		|| asn1_integer_to_der(serial_number, serial_number_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -643,22 +631,13 @@ int cms_signer_info_to_der(
 	const uint8_t *unauthed_attrs, size_t unauthed_attrs_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (version != 1) {
 		error_print();
 		return -1;
 	}
 
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| cms_issuer_and_serial_number_to_der(
-			issuer, issuer_len,
-			serial_number, serial_number_len, NULL, &len) != 1
-		|| x509_digest_algor_to_der(digest_algor, NULL, &len) != 1
-		|| asn1_implicit_set_to_der(0, authed_attrs, authed_attrs_len, NULL, &len) < 0
-		|| x509_signature_algor_to_der(signature_algor, NULL, &len) != 1
-		|| asn1_octet_string_to_der(enced_digest, enced_digest_len, NULL, &len) != 1
-		|| asn1_implicit_set_to_der(1, unauthed_attrs, unauthed_attrs_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| cms_issuer_and_serial_number_to_der(
 			issuer, issuer_len,
@@ -667,7 +646,8 @@ int cms_signer_info_to_der(
 		|| asn1_implicit_set_to_der(0, authed_attrs, authed_attrs_len, out, outlen) < 0
 		|| x509_signature_algor_to_der(signature_algor, out, outlen) != 1
 		|| asn1_octet_string_to_der(enced_digest, enced_digest_len, out, outlen) != 1
-		|| asn1_implicit_set_to_der(1, unauthed_attrs, unauthed_attrs_len, out, outlen) < 0) {
+		|| asn1_implicit_set_to_der(1, unauthed_attrs, unauthed_attrs_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -866,14 +846,10 @@ int cms_signer_infos_print(FILE *fp, int fmt, int ind, const char *label, const
 int cms_digest_algors_to_der(const int *digest_algors, size_t digest_algors_cnt,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0, i;
-	for (i = 0; i < digest_algors_cnt; i++) {
-		if (x509_digest_algor_to_der(digest_algors[i], NULL, &len) != 1) {
-			error_print();
-			return -1;
-		}
-	}
-	if (asn1_set_header_to_der(len, out, outlen) != 1) {
+	ASN1_HEADER hdr;
+	size_t i;
+
+	if (asn1_set_begin(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -883,6 +859,10 @@ int cms_digest_algors_to_der(const int *digest_algors, size_t digest_algors_cnt,
 			return -1;
 		}
 	}
+	if (asn1_header_end(&hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
@@ -940,20 +920,15 @@ int cms_signed_data_to_der(
 	const uint8_t *signer_infos, size_t signer_infos_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &len) != 1
-		|| cms_content_info_to_der(content_type, content, content_len, NULL, &len) != 1
-		|| asn1_implicit_set_to_der(0, certs, certs_len, NULL, &len) < 0
-		|| asn1_implicit_set_to_der(1, crls, crls_len, NULL, &len) < 0
-		|| cms_signer_infos_to_der(signer_infos, signer_infos_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1
 		|| cms_content_info_to_der(content_type, content, content_len, out, outlen) != 1
 		|| asn1_implicit_set_to_der(0, certs, certs_len, out, outlen) < 0
 		|| asn1_implicit_set_to_der(1, crls, crls_len, out, outlen) < 0
-		|| cms_signer_infos_to_der(signer_infos, signer_infos_len, out, outlen) != 1) {
+		|| cms_signer_infos_to_der(signer_infos, signer_infos_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1065,7 +1040,7 @@ int cms_signed_data_sign_to_der(
 	const uint8_t *serial;
 	size_t serial_len;
 	uint8_t *p;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	size_t i;
 
 
@@ -1107,19 +1082,14 @@ int cms_signed_data_sign_to_der(
 		}
 	}
 
-	if (asn1_int_to_der(CMS_version_v1, NULL, &len) != 1
-		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &len) != 1
-		|| cms_content_info_to_der(content_type, data, datalen, NULL, &len) != 1
-		|| cms_implicit_signers_certs_to_der(0, signers, signers_cnt, NULL, &len) < 0
-		|| asn1_implicit_set_to_der(1, crls, crls_len, NULL, &len) < 0
-		|| asn1_set_to_der(signer_infos, signer_infos_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
 		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1
 		|| cms_content_info_to_der(content_type, data, datalen, out, outlen) != 1
 		|| cms_implicit_signers_certs_to_der(0, signers, signers_cnt, out, outlen) < 0
 		|| asn1_implicit_set_to_der(1, crls, crls_len, out, outlen) < 0
-		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1) {
+		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1209,22 +1179,18 @@ int cms_recipient_info_to_der(
 	const uint8_t *enced_key, size_t enced_key_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (version != 1) {
 		error_print();
 		return -1;
 	}
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| cms_issuer_and_serial_number_to_der(issuer, issuer_len,
-			serial_number, serial_number_len, NULL, &len) != 1
-		|| x509_public_key_encryption_algor_to_der(public_key_enc_algor, NULL, &len) != 1
-		|| asn1_octet_string_to_der(enced_key, enced_key_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| cms_issuer_and_serial_number_to_der(issuer, issuer_len,
 			serial_number, serial_number_len, out, outlen) != 1
 		|| x509_public_key_encryption_algor_to_der(public_key_enc_algor, out, outlen) != 1
-		|| asn1_octet_string_to_der(enced_key, enced_key_len, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(enced_key, enced_key_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1435,16 +1401,8 @@ int cms_enveloped_data_to_der(
 	const uint8_t *shared_info2, size_t shared_info2_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, &len) != 1
-		|| cms_enced_content_info_to_der(content_type,
-			enc_algor, iv, ivlen,
-			enced_content, enced_content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, out, outlen) != 1
 		|| cms_enced_content_info_to_der(content_type,
@@ -1452,7 +1410,8 @@ int cms_enveloped_data_to_der(
 			enced_content, enced_content_len,
 			shared_info1, shared_info1_len,
 			shared_info2, shared_info2_len,
-			out, outlen) != 1) {
+			out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1517,6 +1476,7 @@ int cms_enveloped_data_encrypt_to_der(
 	size_t rcpt_infos_len = 0;
 	uint8_t *p = rcpt_infos;
 	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	while (rcpt_certs_len) {
 		const uint8_t *cert;
@@ -1545,16 +1505,7 @@ int cms_enveloped_data_encrypt_to_der(
 			return -1;
 		}
 	}
-	len = 0;
-	if (asn1_int_to_der(CMS_version_v1, NULL, &len) != 1
-		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, &len) != 1
-		|| cms_enced_content_info_encrypt_to_der(
-			enc_algor, key, keylen, iv, ivlen,
-			content_type, content, content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
 		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, out, outlen) != 1
 		|| cms_enced_content_info_encrypt_to_der(
@@ -1562,7 +1513,8 @@ int cms_enveloped_data_encrypt_to_der(
 			content_type, content, content_len,
 			shared_info1, shared_info1_len,
 			shared_info2, shared_info2_len,
-			out, outlen) != 1) {
+			out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1643,20 +1595,8 @@ int cms_signed_and_enveloped_data_to_der(
 	const uint8_t *signer_infos, size_t signer_infos_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, &len) != 1
-		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &len) != 1
-		|| cms_enced_content_info_to_der(content_type,
-			enc_algor, iv, ivlen,
-			enced_content, enced_content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| asn1_implicit_set_to_der(0, certs, certs_len, NULL, &len) < 0
-		|| asn1_implicit_set_to_der(1, crls, crls_len, NULL, &len) < 0
-		|| asn1_set_to_der(signer_infos, signer_infos_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, out, outlen) != 1
 		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1
@@ -1668,7 +1608,8 @@ int cms_signed_and_enveloped_data_to_der(
 			out, outlen) != 1
 		|| asn1_implicit_set_to_der(0, certs, certs_len, out, outlen) < 0
 		|| asn1_implicit_set_to_der(1, crls, crls_len, out, outlen) < 0
-		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1) {
+		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1762,6 +1703,7 @@ int cms_signed_and_enveloped_data_encipher_to_der(
 	size_t serial_len;
 	uint8_t *p;
 	size_t len = 0;
+	ASN1_HEADER hdr;
 	size_t i;
 
 	p = rcpt_infos;
@@ -1810,20 +1752,7 @@ int cms_signed_and_enveloped_data_encipher_to_der(
 		}
 	}
 
-	len = 0;
-	if (asn1_int_to_der(CMS_version_v1, NULL, &len) != 1
-		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, &len) != 1
-		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &len) != 1
-		|| cms_enced_content_info_encrypt_to_der(
-			enc_algor, key, keylen, iv, ivlen,
-			content_type, content, content_len,
-			shared_info1, shared_info1_len,
-			shared_info2, shared_info2_len,
-			NULL, &len) != 1
-		|| cms_implicit_signers_certs_to_der(0, signers, signers_cnt, NULL, &len) != 1
-		|| asn1_implicit_set_to_der(1, signers_crls, signers_crls_len, NULL, &len) < 0
-		|| asn1_set_to_der(signer_infos, signer_infos_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
 		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, out, outlen) != 1
 		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1
@@ -1834,8 +1763,9 @@ int cms_signed_and_enveloped_data_encipher_to_der(
 			shared_info2, shared_info2_len,
 			out, outlen) != 1
 		|| cms_implicit_signers_certs_to_der(0, signers, signers_cnt, out, outlen) != 1
-		|| asn1_implicit_set_to_der(1, signers_crls, signers_crls_len, out, outlen) != 1
-		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1) {
+		|| asn1_implicit_set_to_der(1, signers_crls, signers_crls_len, out, outlen) < 0
+		|| asn1_set_to_der(signer_infos, signer_infos_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1966,16 +1896,13 @@ int cms_key_agreement_info_to_der(
 	const uint8_t *user_id, size_t user_id_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| sm2_public_key_info_to_der(temp_public_key_r, NULL, &len) != 1
-		|| x509_cert_to_der(user_cert, user_cert_len, NULL, &len) != 1
-		|| asn1_octet_string_to_der(user_id, user_id_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| sm2_public_key_info_to_der(temp_public_key_r, out, outlen) != 1
 		|| x509_cert_to_der(user_cert, user_cert_len, out, outlen) != 1
-		|| asn1_octet_string_to_der(user_id, user_id_len, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(user_id, user_id_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2251,6 +2178,278 @@ int cms_envelop(
 	return 1;
 }
 
+typedef struct {
+	SM2_KEY public_key;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	uint8_t enced_key[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t enced_key_len;
+} CMS_ENVELOP_RECIPIENT;
+
+typedef struct {
+	int (*func)(void *arg, size_t i);
+	void *arg;
+	size_t first;
+	size_t last;
+	int ret;
+} CMS_JOB;
+
+static void cms_job_run(CMS_JOB *job)
+{
+	size_t i;
+
+	for (i = job->first; i < job->last; i++) {
+		if (job->func(job->arg, i) != 1) {
+			error_print();
+			job->ret = -1;
+			break;
+		}
+	}
+}
+
+static void cms_job_task(void *arg)
+{
+	cms_job_run((CMS_JOB *)arg);
+}
+
+// func(arg, i) for i in [0, num), split into ranges across `threads`
+static int cms_parallel_for(size_t num, int threads, int (*func)(void *arg, size_t i), void *arg)
+{
+	CMS_JOB jobs[CMS_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (!num) {
+		return 1;
+	}
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > CMS_MAX_THREADS) {
+		threads = CMS_MAX_THREADS;
+	}
+	if ((size_t)threads > num) {
+		threads = (int)num;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i].func = func;
+		jobs[i].arg = arg;
+		jobs[i].first = (num * i) / threads;
+		jobs[i].last = (num * (i + 1)) / threads;
+		jobs[i].ret = 1;
+	}
+	gmssl_thread_pool_run(cms_job_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+typedef struct {
+	CMS_ENVELOP_RECIPIENT *rcpts;
+	const uint8_t *key;
+	size_t keylen;
+} CMS_ENVELOP_WRAP;
+
+// DER size of the sm2_encrypt_fixlen() output with SM2_ciphertext_typical_point_size
+static size_t cms_sm2_fixlen_ciphertext_size(size_t inlen)
+{
+	size_t dlen = SM2_ciphertext_typical_point_size + 2 + SM3_DIGEST_SIZE;
+	size_t len = 0;
+
+	(void)asn1_length_to_der(inlen, NULL, &len);
+	dlen += 1 + len + inlen;
+	len = 0;
+	(void)asn1_length_to_der(dlen, NULL, &len);
+	return 1 + len + dlen;
+}
+
+static int cms_envelop_wrap_key(void *arg, size_t i)
+{
+	CMS_ENVELOP_WRAP *wrap = (CMS_ENVELOP_WRAP *)arg;
+	CMS_ENVELOP_RECIPIENT *rcpt = &wrap->rcpts[i];
+
+	if (sm2_encrypt_fixlen(&rcpt->public_key, wrap->key, wrap->keylen,
+			SM2_ciphertext_typical_point_size, rcpt->enced_key, &rcpt->enced_key_len) != 1
+		|| rcpt->enced_key_len != cms_sm2_fixlen_ciphertext_size(wrap->keylen)) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int cms_enveloped_data_multi_to_der(
+	const CMS_ENVELOP_RECIPIENT *rcpts, size_t num,
+	int enc_algor, const uint8_t *iv, size_t ivlen,
+	int content_type, const uint8_t *enced_content, size_t enced_content_len,
+	const uint8_t *shared_info1, size_t shared_info1_len,
+	const uint8_t *shared_info2, size_t shared_info2_len,
+	uint8_t **out, size_t *outlen)
+{
+	ASN1_HEADER hdr;
+	ASN1_HEADER set;
+	size_t i;
+
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
+		|| asn1_set_begin(&set, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < num; i++) {
+		if (cms_recipient_info_to_der(CMS_version_v1,
+			rcpts[i].issuer, rcpts[i].issuer_len, rcpts[i].serial, rcpts[i].serial_len,
+			OID_sm2encrypt, rcpts[i].enced_key, rcpts[i].enced_key_len,
+			out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_header_end(&set, out, outlen) != 1
+		|| cms_enced_content_info_to_der(content_type,
+			enc_algor, iv, ivlen,
+			enced_content, enced_content_len,
+			shared_info1, shared_info1_len,
+			shared_info2, shared_info2_len,
+			out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// the content is encrypted once and the key is wrapped once per recipient, the
+// wrapped keys have a fixed length so the size query does no SM2 encryption
+int cms_envelop_multi(
+	uint8_t *cms, size_t *cmslen,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	int content_type, const uint8_t *content, size_t content_len,
+	const uint8_t *shared_info1, size_t shared_info1_len,
+	const uint8_t *shared_info2, size_t shared_info2_len,
+	int threads)
+{
+	int ret = -1;
+	int oid = OID_cms_enveloped_data;
+	CMS_ENVELOP_RECIPIENT *rcpts = NULL;
+	size_t num = 0;
+	CMS_ENVELOP_WRAP wrap;
+	uint8_t *enced_content = NULL;
+	size_t enced_content_len;
+	SM4_KEY sm4_key;
+	const uint8_t *certs;
+	size_t certs_len;
+	const uint8_t *cert;
+	size_t certlen;
+	size_t len = 0;
+	size_t i;
+
+	if (!cmslen || !rcpt_certs || !rcpt_certs_len || !key || !iv || (!content && content_len)) {
+		error_print();
+		return -1;
+	}
+	if (enc_algor != OID_sm4_cbc || keylen != SM4_KEY_SIZE || ivlen != SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	certs = rcpt_certs;
+	certs_len = rcpt_certs_len;
+	while (certs_len) {
+		if (asn1_any_from_der(&cert, &certlen, &certs, &certs_len) != 1) {
+			error_print();
+			return -1;
+		}
+		num++;
+	}
+	enced_content_len = (content_len / SM4_BLOCK_SIZE + 1) * SM4_BLOCK_SIZE;
+	if (!(rcpts = (CMS_ENVELOP_RECIPIENT *)calloc(num, sizeof(CMS_ENVELOP_RECIPIENT)))
+		|| !(enced_content = (uint8_t *)calloc(1, enced_content_len))) {
+		error_print();
+		goto end;
+	}
+
+	certs = rcpt_certs;
+	certs_len = rcpt_certs_len;
+	for (i = 0; i < num; i++) {
+		if (asn1_any_from_der(&cert, &certlen, &certs, &certs_len) != 1
+			|| x509_cert_get_issuer_and_serial_number(cert, certlen,
+				&rcpts[i].issuer, &rcpts[i].issuer_len,
+				&rcpts[i].serial, &rcpts[i].serial_len) != 1
+			|| x509_cert_get_subject_public_key(cert, certlen, &rcpts[i].public_key) != 1) {
+			error_print();
+			goto end;
+		}
+		rcpts[i].enced_key_len = cms_sm2_fixlen_ciphertext_size(keylen);
+	}
+
+	if (cms) {
+		sm4_set_encrypt_key(&sm4_key, key);
+		if (sm4_cbc_padding_encrypt(&sm4_key, iv, content, content_len,
+				enced_content, &len) != 1
+			|| len != enced_content_len) {
+			gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+			error_print();
+			goto end;
+		}
+		gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+		wrap.rcpts = rcpts;
+		wrap.key = key;
+		wrap.keylen = keylen;
+		if (cms_parallel_for(num, threads, cms_envelop_wrap_key, &wrap) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	len = 0;
+	if (cms_enveloped_data_multi_to_der(rcpts, num,
+		enc_algor, iv, ivlen,
+		content_type, enced_content, enced_content_len,
+		shared_info1, shared_info1_len,
+		shared_info2, shared_info2_len,
+		NULL, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	*cmslen = 0;
+	if (!cms) {
+		uint8_t data[1];
+		if (cms_content_info_to_der(oid, data, len, NULL, cmslen) != 1) {
+			error_print();
+			goto end;
+		}
+		ret = 1;
+		goto end;
+	}
+	if (cms_content_info_header_to_der(oid, len, &cms, cmslen) != 1
+		|| cms_enveloped_data_multi_to_der(rcpts, num,
+			enc_algor, iv, ivlen,
+			content_type, enced_content, enced_content_len,
+			shared_info1, shared_info1_len,
+			shared_info2, shared_info2_len,
+			&cms, cmslen) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	if (rcpts) {
+		gmssl_secure_clear(rcpts, sizeof(CMS_ENVELOP_RECIPIENT) * num);
+		free(rcpts);
+	}
+	if (enced_content) free(enced_content);
+	return ret;
+}
+
 int cms_deenvelop(const uint8_t *cms, size_t cmslen,
 	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len,
 	int *content_type, uint8_t *content, size_t *content_len,
@@ -2282,7 +2481,7 @@ int cms_deenvelop(const uint8_t *cms, size_t cmslen,
 		error_print();
 		return -1;
 	}
-	if (memcmp(&public_key, rcpt_key, sizeof(SM2_POINT)) != 0) {
+	if (sm2_public_key_equ(rcpt_key, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2387,7 +2586,7 @@ int cms_deenvelop_and_verify(const uint8_t *cms, size_t cmslen,
 		error_print();
 		return -1;
 	}
-	if (memcmp(&public_key, rcpt_key, sizeof(SM2_POINT)) != 0) {
+	if (sm2_public_key_equ(rcpt_key, &public_key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2445,6 +2644,931 @@ int cms_set_key_agreement_info(
 	return 1;
 }
 
+// read a TLV header only, the value may be beyond the input
+static int cms_header_from_der(int tag, size_t *dlen, const uint8_t **in, size_t *inlen)
+{
+	size_t nbytes;
+	size_t i;
+
+	if (*inlen < 2 || (*in)[0] != tag) {
+		error_print();
+		return -1;
+	}
+	if ((*in)[1] < 128) {
+		*dlen = (*in)[1];
+		*in += 2;
+		*inlen -= 2;
+		return 1;
+	}
+	nbytes = (*in)[1] & 0x7f;
+	if (nbytes < 1 || nbytes > 4 || *inlen < 2 + nbytes) {
+		error_print();
+		return -1;
+	}
+	*dlen = 0;
+	for (i = 0; i < nbytes; i++) {
+		*dlen = (*dlen << 8) | (*in)[2 + i];
+	}
+	*in += 2 + nbytes;
+	*inlen -= 2 + nbytes;
+	return 1;
+}
+
+static int cms_sign_signer_infos_len(const CMS_CERTS_AND_KEY *signers, size_t signers_cnt, size_t *len)
+{
+	uint8_t sig[SM2_signature_typical_size] = {0};
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	size_t i;
+
+	*len = 0;
+	for (i = 0; i < signers_cnt; i++) {
+		if (x509_cert_get_issuer_and_serial_number(signers[i].certs, signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| cms_signer_info_to_der(CMS_version_v1, issuer, issuer_len, serial, serial_len,
+				OID_sm3, NULL, 0, OID_sm2sign_with_sm3, sig, sizeof(sig), NULL, 0, NULL, len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int cms_sign_init(CMS_SIGN_CTX *ctx,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	const uint8_t *crls, size_t crls_len, size_t content_len,
+	uint8_t *header, size_t *header_len, size_t maxlen)
+{
+	int digest_algors[] = { OID_sm3 };
+	size_t digest_algors_cnt = sizeof(digest_algors)/sizeof(int);
+	uint8_t content_header[64];
+	size_t content_header_len = 0;
+	size_t signer_infos_len;
+	size_t signed_data_len = 0;
+	size_t len = 0;
+	size_t octets_len = 0;
+	uint8_t *p;
+
+	if (!ctx || !signers || !signers_cnt || !header || !header_len) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	// the same ContentInfo header cms_signed_data_sign_to_der() digests
+	p = content_header;
+	if (asn1_octet_string_header_to_der(content_len, NULL, &octets_len) != 1
+		|| cms_content_info_header_to_der(OID_cms_data, octets_len + content_len, &p, &content_header_len) != 1
+		|| asn1_octet_string_header_to_der(content_len, &p, &content_header_len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (cms_implicit_signers_certs_to_der(0, signers, signers_cnt, NULL, &ctx->trailer_len) < 0
+		|| asn1_implicit_set_to_der(1, crls, crls_len, NULL, &ctx->trailer_len) < 0
+		|| cms_sign_signer_infos_len(signers, signers_cnt, &signer_infos_len) != 1
+		|| asn1_set_header_to_der(signer_infos_len, NULL, &ctx->trailer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->trailer_len += signer_infos_len;
+
+	if (asn1_int_to_der(CMS_version_v1, NULL, &signed_data_len) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, &signed_data_len) != 1) {
+		error_print();
+		return -1;
+	}
+	signed_data_len += content_header_len + content_len + ctx->trailer_len;
+	if (signed_data_len > INT_MAX - 64) {
+		error_print();
+		return -1;
+	}
+
+	if (asn1_sequence_header_to_der(signed_data_len, NULL, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	*header_len = 0;
+	if (cms_content_info_header_to_der(OID_cms_signed_data, len + signed_data_len, NULL, header_len) != 1
+		|| asn1_sequence_header_to_der(signed_data_len, NULL, header_len) != 1
+		|| asn1_int_to_der(CMS_version_v1, NULL, header_len) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, NULL, header_len) != 1
+		|| asn1_length_le(*header_len + content_header_len, maxlen) != 1) {
+		error_print();
+		return -1;
+	}
+	*header_len = 0;
+	p = header;
+	if (cms_content_info_header_to_der(OID_cms_signed_data, len + signed_data_len, &p, header_len) != 1
+		|| asn1_sequence_header_to_der(signed_data_len, &p, header_len) != 1
+		|| asn1_int_to_der(CMS_version_v1, &p, header_len) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, &p, header_len) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, content_header, content_header_len);
+	*header_len += content_header_len;
+
+	sm3_init(&ctx->sm3_ctx);
+	sm3_update(&ctx->sm3_ctx, content_header, content_header_len);
+
+	ctx->signers = signers;
+	ctx->signers_cnt = signers_cnt;
+	ctx->crls = crls;
+	ctx->crls_len = crls_len;
+	ctx->content_len = content_len;
+	return 1;
+}
+
+int cms_sign_update(CMS_SIGN_CTX *ctx, const uint8_t *content, size_t content_len)
+{
+	if (!ctx || (!content && content_len)) {
+		error_print();
+		return -1;
+	}
+	if (content_len > ctx->content_len - ctx->content_nbytes) {
+		error_print();
+		return -1;
+	}
+	sm3_update(&ctx->sm3_ctx, content, content_len);
+	ctx->content_nbytes += content_len;
+	return 1;
+}
+
+int cms_sign_finish(CMS_SIGN_CTX *ctx, uint8_t *trailer, size_t *trailer_len, size_t maxlen)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	size_t signer_infos_len;
+	uint8_t *p = trailer;
+	size_t i;
+
+	if (!ctx || !trailer || !trailer_len) {
+		error_print();
+		return -1;
+	}
+	if (ctx->content_nbytes != ctx->content_len || ctx->trailer_len > maxlen) {
+		error_print();
+		return -1;
+	}
+
+	*trailer_len = 0;
+	if (cms_implicit_signers_certs_to_der(0, ctx->signers, ctx->signers_cnt, &p, trailer_len) < 0
+		|| asn1_implicit_set_to_der(1, ctx->crls, ctx->crls_len, &p, trailer_len) < 0
+		|| cms_sign_signer_infos_len(ctx->signers, ctx->signers_cnt, &signer_infos_len) != 1
+		|| asn1_set_header_to_der(signer_infos_len, &p, trailer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < ctx->signers_cnt; i++) {
+		if (x509_cert_get_issuer_and_serial_number(ctx->signers[i].certs, ctx->signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| cms_signer_info_sign_to_der(&ctx->sm3_ctx, ctx->signers[i].sign_key,
+				issuer, issuer_len, serial, serial_len, NULL, 0, NULL, 0, &p, trailer_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (*trailer_len != ctx->trailer_len) {
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&ctx->sm3_ctx, sizeof(SM3_CTX));
+	return 1;
+}
+
+int cms_verify_init(CMS_VERIFY_CTX *ctx, const uint8_t *in, size_t inlen,
+	size_t *header_len, size_t *content_len, size_t *trailer_len)
+{
+	const uint8_t *p = in;
+	size_t len = inlen;
+	int content_type;
+	int version;
+	int digest_algors[4];
+	size_t digest_algors_cnt;
+	size_t dlen;
+	size_t signed_data_len;
+	size_t signed_data_offset;
+	size_t explicit_len;
+	uint8_t content_header[64];
+	size_t content_header_len = 0;
+	uint8_t *hp = content_header;
+
+	if (!ctx || !in || !header_len || !content_len || !trailer_len) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (cms_header_from_der(ASN1_TAG_SEQUENCE, &dlen, &p, &len) != 1
+		|| cms_content_type_from_der(&content_type, &p, &len) != 1
+		|| asn1_check(content_type == OID_cms_signed_data) != 1
+		|| cms_header_from_der(ASN1_TAG_EXPLICIT(0), &dlen, &p, &len) != 1
+		|| cms_header_from_der(ASN1_TAG_SEQUENCE, &signed_data_len, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	signed_data_offset = p - in;
+
+	if (asn1_int_from_der(&version, &p, &len) != 1
+		|| asn1_check(version == CMS_version_v1) != 1
+		|| cms_digest_algors_from_der(digest_algors, &digest_algors_cnt,
+			sizeof(digest_algors)/sizeof(int), &p, &len) != 1
+		|| asn1_check(digest_algors_cnt == 1 && digest_algors[0] == OID_sm3) != 1
+		|| cms_header_from_der(ASN1_TAG_SEQUENCE, &dlen, &p, &len) != 1
+		|| cms_content_type_from_der(&content_type, &p, &len) != 1
+		|| asn1_check(content_type == OID_cms_data) != 1
+		|| cms_header_from_der(ASN1_TAG_EXPLICIT(0), &explicit_len, &p, &len) != 1
+		|| cms_header_from_der(ASN1_TAG_OCTET_STRING, content_len, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	*header_len = p - in;
+
+	if (*header_len - signed_data_offset + *content_len > signed_data_len) {
+		error_print();
+		return -1;
+	}
+	*trailer_len = signed_data_len - (*header_len - signed_data_offset) - *content_len;
+
+	if (asn1_octet_string_header_to_der(*content_len, NULL, &content_header_len) != 1
+		|| asn1_check(explicit_len == content_header_len + *content_len) != 1) {
+		error_print();
+		return -1;
+	}
+	content_header_len = 0;
+	if (cms_content_info_header_to_der(OID_cms_data, explicit_len, &hp, &content_header_len) != 1
+		|| asn1_octet_string_header_to_der(*content_len, &hp, &content_header_len) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&ctx->sm3_ctx);
+	sm3_update(&ctx->sm3_ctx, content_header, content_header_len);
+
+	ctx->content_len = *content_len;
+	ctx->trailer_len = *trailer_len;
+	return 1;
+}
+
+int cms_verify_update(CMS_VERIFY_CTX *ctx, const uint8_t *content, size_t content_len)
+{
+	if (!ctx || (!content && content_len)) {
+		error_print();
+		return -1;
+	}
+	if (content_len > ctx->content_len - ctx->content_nbytes) {
+		error_print();
+		return -1;
+	}
+	sm3_update(&ctx->sm3_ctx, content, content_len);
+	ctx->content_nbytes += content_len;
+	return 1;
+}
+
+int cms_verify_finish(CMS_VERIFY_CTX *ctx, const uint8_t *trailer, size_t trailer_len,
+	const uint8_t **certs, size_t *certs_len,
+	const uint8_t **crls, size_t *crls_len,
+	const uint8_t **signer_infos, size_t *signer_infos_len)
+{
+	const uint8_t *p;
+	size_t len;
+
+	if (!ctx || !trailer || !certs || !certs_len || !crls || !crls_len
+		|| !signer_infos || !signer_infos_len) {
+		error_print();
+		return -1;
+	}
+	if (ctx->content_nbytes != ctx->content_len || trailer_len != ctx->trailer_len) {
+		error_print();
+		return -1;
+	}
+	if (asn1_implicit_set_from_der(0, certs, certs_len, &trailer, &trailer_len) < 0
+		|| asn1_implicit_set_from_der(1, crls, crls_len, &trailer, &trailer_len) < 0
+		|| asn1_set_from_der(signer_infos, signer_infos_len, &trailer, &trailer_len) != 1
+		|| asn1_length_is_zero(trailer_len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	p = *signer_infos;
+	len = *signer_infos_len;
+	while (len) {
+		const uint8_t *cert;
+		size_t certlen;
+		const uint8_t *issuer;
+		size_t issuer_len;
+		const uint8_t *serial;
+		size_t serial_len;
+		const uint8_t *authed_attrs;
+		size_t authed_attrs_len;
+		const uint8_t *unauthed_attrs;
+		size_t unauthed_attrs_len;
+
+		if (cms_signer_info_verify_from_der(
+			&ctx->sm3_ctx, *certs, *certs_len,
+			&cert, &certlen,
+			&issuer, &issuer_len,
+			&serial, &serial_len,
+			&authed_attrs, &authed_attrs_len,
+			&unauthed_attrs, &unauthed_attrs_len,
+			&p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int cms_content_digest_init(SM3_CTX *ctx, int content_type, size_t content_len)
+{
+	uint8_t content_header[64];
+	size_t content_header_len = 0;
+	size_t octets_len = 0;
+	uint8_t *p = content_header;
+
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	// the same ContentInfo header cms_signed_data_sign_to_der() digests
+	if (content_type == OID_cms_data) {
+		if (asn1_octet_string_header_to_der(content_len, NULL, &octets_len) != 1
+			|| cms_content_info_header_to_der(content_type, octets_len + content_len, &p, &content_header_len) != 1
+			|| asn1_octet_string_header_to_der(content_len, &p, &content_header_len) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (cms_content_info_header_to_der(content_type, content_len, &p, &content_header_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	sm3_init(ctx);
+	sm3_update(ctx, content_header, content_header_len);
+	return 1;
+}
+
+// the signatures have a fixed length, so with out == NULL nothing is signed
+static int cms_signed_data_digest_sign_to_der(
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int content_type, const uint8_t dgst[SM3_DIGEST_SIZE],
+	const uint8_t *crls, size_t crls_len,
+	uint8_t **out, size_t *outlen)
+{
+	int digest_algors[] = { OID_sm3 };
+	size_t digest_algors_cnt = sizeof(digest_algors)/sizeof(int);
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE] = {0};
+	size_t siglen = SM2_signature_typical_size;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	ASN1_HEADER hdr;
+	ASN1_HEADER content_info;
+	ASN1_HEADER set;
+	size_t i;
+
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| asn1_int_to_der(CMS_version_v1, out, outlen) != 1
+		|| cms_digest_algors_to_der(digest_algors, digest_algors_cnt, out, outlen) != 1
+		|| asn1_sequence_begin(&content_info, out, outlen) != 1
+		|| cms_content_type_to_der(content_type, out, outlen) != 1
+		|| asn1_header_end(&content_info, out, outlen) != 1
+		|| cms_implicit_signers_certs_to_der(0, signers, signers_cnt, out, outlen) < 0
+		|| asn1_implicit_set_to_der(1, crls, crls_len, out, outlen) < 0
+		|| asn1_set_begin(&set, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < signers_cnt; i++) {
+		if (x509_cert_get_issuer_and_serial_number(signers[i].certs, signers[i].certs_len,
+				&issuer, &issuer_len, &serial, &serial_len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (out && *out) {
+			if (sm2_sign_fixlen(signers[i].sign_key, dgst, siglen, sig) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+		if (cms_signer_info_to_der(CMS_version_v1, issuer, issuer_len, serial, serial_len,
+				OID_sm3, NULL, 0, OID_sm2sign_with_sm3, sig, siglen, NULL, 0, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_header_end(&set, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_sign_digest(uint8_t *cms, size_t *cmslen,
+	const CMS_CERTS_AND_KEY *signers, size_t signers_cnt,
+	int content_type, const uint8_t dgst[SM3_DIGEST_SIZE],
+	const uint8_t *crls, size_t crls_len)
+{
+	int oid = OID_cms_signed_data;
+	size_t len = 0;
+
+	if (!cmslen || !signers || !signers_cnt || !dgst) {
+		error_print();
+		return -1;
+	}
+	if (cms_signed_data_digest_sign_to_der(signers, signers_cnt,
+		content_type, dgst, crls, crls_len, NULL, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	*cmslen = 0;
+	if (!cms) {
+		uint8_t data[1];
+		if (cms_content_info_to_der(oid, data, len, NULL, cmslen) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+	if (cms_content_info_header_to_der(oid, len, &cms, cmslen) != 1
+		|| cms_signed_data_digest_sign_to_der(signers, signers_cnt,
+			content_type, dgst, crls, crls_len, &cms, cmslen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+typedef struct {
+	SM2_KEY public_key;
+	const uint8_t *sig;
+	size_t siglen;
+} CMS_VERIFY_SIGNER;
+
+typedef struct {
+	const CMS_VERIFY_SIGNER *signers;
+	const uint8_t *dgst;
+} CMS_VERIFY_DIGEST;
+
+static int cms_verify_signer(void *arg, size_t i)
+{
+	const CMS_VERIFY_DIGEST *verify = (const CMS_VERIFY_DIGEST *)arg;
+	const CMS_VERIFY_SIGNER *signer = &verify->signers[i];
+
+	if (sm2_verify(&signer->public_key, verify->dgst, signer->sig, signer->siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int cms_verify_digest(const uint8_t *cms, size_t cmslen,
+	const uint8_t *extra_certs, size_t extra_certs_len,
+	int content_type, const uint8_t dgst[SM3_DIGEST_SIZE],
+	const uint8_t **certs, size_t *certs_len,
+	const uint8_t **crls, size_t *crls_len,
+	const uint8_t **signer_infos, size_t *signer_infos_len,
+	int threads)
+{
+	int ret = -1;
+	int cms_type;
+	const uint8_t *d;
+	size_t dlen;
+	int version;
+	int digest_algors[4];
+	size_t digest_algors_cnt;
+	int signed_content_type;
+	const uint8_t *content;
+	size_t content_len;
+	const uint8_t *p;
+	size_t len;
+	CMS_VERIFY_SIGNER *signers = NULL;
+	CMS_VERIFY_DIGEST verify;
+	size_t num = 0;
+	size_t i;
+
+	if (!cms || !cmslen || !dgst || !certs || !certs_len || !crls || !crls_len
+		|| !signer_infos || !signer_infos_len) {
+		error_print();
+		return -1;
+	}
+	if (cms_content_info_from_der(&cms_type, &d, &dlen, &cms, &cmslen) != 1
+		|| asn1_check(cms_type == OID_cms_signed_data) != 1
+		|| asn1_length_is_zero(cmslen) != 1
+		|| cms_signed_data_from_der(&version,
+			digest_algors, &digest_algors_cnt, sizeof(digest_algors)/sizeof(int),
+			&signed_content_type, &content, &content_len,
+			certs, certs_len, crls, crls_len,
+			signer_infos, signer_infos_len,
+			&d, &dlen) != 1
+		|| asn1_length_is_zero(dlen) != 1
+		|| asn1_check(version == CMS_version_v1) != 1
+		|| asn1_check(digest_algors_cnt == 1 && digest_algors[0] == OID_sm3) != 1
+		|| asn1_check(signed_content_type == content_type) != 1) {
+		error_print();
+		return -1;
+	}
+
+	p = *signer_infos;
+	len = *signer_infos_len;
+	while (len) {
+		if (asn1_any_from_der(&d, &dlen, &p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		num++;
+	}
+	if (!num) {
+		error_print();
+		return -1;
+	}
+	if (!(signers = (CMS_VERIFY_SIGNER *)calloc(num, sizeof(CMS_VERIFY_SIGNER)))) {
+		error_print();
+		return -1;
+	}
+
+	// certificates are looked up in the calling thread, only sm2_verify() runs in parallel
+	p = *signer_infos;
+	len = *signer_infos_len;
+	for (i = 0; i < num; i++) {
+		int signer_version;
+		int digest_algor;
+		int signature_algor;
+		const uint8_t *issuer;
+		size_t issuer_len;
+		const uint8_t *serial;
+		size_t serial_len;
+		const uint8_t *authed_attrs;
+		size_t authed_attrs_len;
+		const uint8_t *unauthed_attrs;
+		size_t unauthed_attrs_len;
+		const uint8_t *cert;
+		size_t certlen;
+		int found;
+
+		if (cms_signer_info_from_der(&signer_version,
+				&issuer, &issuer_len, &serial, &serial_len,
+				&digest_algor, &authed_attrs, &authed_attrs_len,
+				&signature_algor, &signers[i].sig, &signers[i].siglen,
+				&unauthed_attrs, &unauthed_attrs_len,
+				&p, &len) != 1
+			|| asn1_check(signer_version == CMS_version_v1) != 1
+			|| asn1_check(digest_algor == OID_sm3) != 1
+			|| asn1_check(signature_algor == OID_sm2sign_with_sm3) != 1
+			|| asn1_check(authed_attrs_len == 0) != 1) {
+			error_print();
+			goto end;
+		}
+		if ((found = x509_certs_get_cert_by_issuer_and_serial_number(*certs, *certs_len,
+				issuer, issuer_len, serial, serial_len, &cert, &certlen)) == 0 && extra_certs) {
+			found = x509_certs_get_cert_by_issuer_and_serial_number(extra_certs, extra_certs_len,
+				issuer, issuer_len, serial, serial_len, &cert, &certlen);
+		}
+		if (found != 1
+			|| x509_cert_get_subject_public_key(cert, certlen, &signers[i].public_key) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	verify.signers = signers;
+	verify.dgst = dgst;
+	if (cms_parallel_for(num, threads, cms_verify_signer, &verify) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	free(signers);
+	return ret;
+}
+
+int cms_envelop_init(CMS_ENVELOP_CTX *ctx,
+	const uint8_t *rcpt_certs, size_t rcpt_certs_len,
+	int enc_algor, const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *shared_info1, size_t shared_info1_len,
+	const uint8_t *shared_info2, size_t shared_info2_len,
+	size_t content_len, uint8_t *header, size_t *header_len, size_t maxlen)
+{
+	uint8_t *rcpt_infos = NULL;
+	size_t rcpt_infos_len = 0;
+	size_t enced_content_len;
+	size_t enced_content_info_len = 0;
+	size_t enveloped_data_len = 0;
+	size_t len = 0;
+	uint8_t *p;
+	int ret = -1;
+
+	if (!ctx || !rcpt_certs || !rcpt_certs_len || !key || !iv || !header || !header_len) {
+		error_print();
+		return -1;
+	}
+	if (enc_algor != OID_sm4_cbc || keylen != SM4_KEY_SIZE || ivlen != SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	enced_content_len = (content_len/SM4_BLOCK_SIZE + 1) * SM4_BLOCK_SIZE;
+
+	// a RecipientInfo is smaller than the certificate it is made from
+	if (!(rcpt_infos = (uint8_t *)malloc(rcpt_certs_len + 256))) {
+		error_print();
+		return -1;
+	}
+	p = rcpt_infos;
+	while (rcpt_certs_len) {
+		const uint8_t *cert;
+		size_t certlen;
+		SM2_KEY public_key;
+		const uint8_t *issuer;
+		size_t issuer_len;
+		const uint8_t *serial;
+		size_t serial_len;
+
+		if (asn1_any_from_der(&cert, &certlen, &rcpt_certs, &rcpt_certs_len) != 1
+			|| x509_cert_get_issuer_and_serial_number(cert, certlen,
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+			|| cms_recipient_info_encrypt_to_der(&public_key,
+				issuer, issuer_len, serial, serial_len,
+				key, keylen, &p, &rcpt_infos_len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// the last block from sm4_cbc_encrypt_finish() leads the trailer
+	ctx->trailer_len = SM4_BLOCK_SIZE;
+	if (asn1_implicit_octet_string_to_der(1, shared_info1, shared_info1_len, NULL, &ctx->trailer_len) < 0
+		|| asn1_implicit_octet_string_to_der(2, shared_info2, shared_info2_len, NULL, &ctx->trailer_len) < 0
+		|| cms_content_type_to_der(OID_cms_data, NULL, &enced_content_info_len) != 1
+		|| x509_encryption_algor_to_der(enc_algor, iv, ivlen, NULL, &enced_content_info_len) != 1
+		|| asn1_header_to_der(ASN1_TAG_IMPLICIT(0), enced_content_len, NULL, &enced_content_info_len) != 1) {
+		error_print();
+		goto end;
+	}
+	enced_content_info_len += enced_content_len + ctx->trailer_len - SM4_BLOCK_SIZE;
+	if (enced_content_info_len > INT_MAX - 64 - rcpt_infos_len) {
+		error_print();
+		goto end;
+	}
+	if (asn1_int_to_der(CMS_version_v1, NULL, &enveloped_data_len) != 1
+		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, &enveloped_data_len) != 1
+		|| asn1_sequence_header_to_der(enced_content_info_len, NULL, &enveloped_data_len) != 1
+		|| asn1_sequence_header_to_der(enveloped_data_len + enced_content_info_len, NULL, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	enveloped_data_len += enced_content_info_len;
+
+	*header_len = 0;
+	if (cms_content_info_header_to_der(OID_cms_enveloped_data, len + enveloped_data_len, NULL, header_len) != 1
+		|| asn1_sequence_header_to_der(enveloped_data_len, NULL, header_len) != 1
+		|| asn1_int_to_der(CMS_version_v1, NULL, header_len) != 1
+		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, NULL, header_len) != 1
+		|| asn1_sequence_header_to_der(enced_content_info_len, NULL, header_len) != 1
+		|| cms_content_type_to_der(OID_cms_data, NULL, header_len) != 1
+		|| x509_encryption_algor_to_der(enc_algor, iv, ivlen, NULL, header_len) != 1
+		|| asn1_header_to_der(ASN1_TAG_IMPLICIT(0), enced_content_len, NULL, header_len) != 1
+		|| asn1_length_le(*header_len, maxlen) != 1) {
+		error_print();
+		goto end;
+	}
+	*header_len = 0;
+	p = header;
+	if (cms_content_info_header_to_der(OID_cms_enveloped_data, len + enveloped_data_len, &p, header_len) != 1
+		|| asn1_sequence_header_to_der(enveloped_data_len, &p, header_len) != 1
+		|| asn1_int_to_der(CMS_version_v1, &p, header_len) != 1
+		|| asn1_set_to_der(rcpt_infos, rcpt_infos_len, &p, header_len) != 1
+		|| asn1_sequence_header_to_der(enced_content_info_len, &p, header_len) != 1
+		|| cms_content_type_to_der(OID_cms_data, &p, header_len) != 1
+		|| x509_encryption_algor_to_der(enc_algor, iv, ivlen, &p, header_len) != 1
+		|| asn1_header_to_der(ASN1_TAG_IMPLICIT(0), enced_content_len, &p, header_len) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (sm4_cbc_encrypt_init(&ctx->cbc_ctx, key, iv) != 1) {
+		error_print();
+		goto end;
+	}
+	ctx->shared_info1 = shared_info1;
+	ctx->shared_info1_len = shared_info1_len;
+	ctx->shared_info2 = shared_info2;
+	ctx->shared_info2_len = shared_info2_len;
+	ctx->content_len = content_len;
+	ret = 1;
+end:
+	free(rcpt_infos);
+	return ret;
+}
+
+int cms_envelop_update(CMS_ENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (inlen > ctx->content_len - ctx->content_nbytes) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (inlen && sm4_cbc_encrypt_update(&ctx->cbc_ctx, in, inlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->content_nbytes += inlen;
+	return 1;
+}
+
+int cms_envelop_finish(CMS_ENVELOP_CTX *ctx, uint8_t *trailer, size_t *trailer_len, size_t maxlen)
+{
+	uint8_t *p;
+
+	if (!ctx || !trailer || !trailer_len) {
+		error_print();
+		return -1;
+	}
+	if (ctx->content_nbytes != ctx->content_len || ctx->trailer_len > maxlen) {
+		error_print();
+		return -1;
+	}
+	if (sm4_cbc_encrypt_finish(&ctx->cbc_ctx, trailer, trailer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	p = trailer + *trailer_len;
+	if (asn1_implicit_octet_string_to_der(1, ctx->shared_info1, ctx->shared_info1_len, &p, trailer_len) < 0
+		|| asn1_implicit_octet_string_to_der(2, ctx->shared_info2, ctx->shared_info2_len, &p, trailer_len) < 0
+		|| asn1_check(*trailer_len == ctx->trailer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&ctx->cbc_ctx, sizeof(SM4_CBC_CTX));
+	return 1;
+}
+
+int cms_deenvelop_init(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen,
+	const SM2_KEY *rcpt_key, const uint8_t *rcpt_cert, size_t rcpt_cert_len,
+	size_t *header_len, size_t *content_len, size_t *trailer_len)
+{
+	const uint8_t *p = in;
+	size_t len = inlen;
+	int content_type;
+	int version;
+	size_t dlen;
+	const uint8_t *rcpt_infos;
+	size_t rcpt_infos_len;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	SM2_KEY public_key;
+	uint8_t key[32];
+	size_t keylen;
+	int enc_algor;
+	const uint8_t *iv;
+	size_t ivlen;
+	size_t enced_content_info_len;
+	size_t enced_content_info_offset;
+	int ret = 0;
+
+	if (!ctx || !in || !rcpt_key || !rcpt_cert || !header_len || !content_len || !trailer_len) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (x509_cert_get_issuer_and_serial_number(rcpt_cert, rcpt_cert_len,
+			&issuer, &issuer_len, &serial, &serial_len) != 1
+		|| x509_cert_get_subject_public_key(rcpt_cert, rcpt_cert_len, &public_key) != 1
+		|| sm2_public_key_equ(rcpt_key, &public_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (cms_header_from_der(ASN1_TAG_SEQUENCE, &dlen, &p, &len) != 1
+		|| cms_content_type_from_der(&content_type, &p, &len) != 1
+		|| asn1_check(content_type == OID_cms_enveloped_data) != 1
+		|| cms_header_from_der(ASN1_TAG_EXPLICIT(0), &dlen, &p, &len) != 1
+		|| cms_header_from_der(ASN1_TAG_SEQUENCE, &dlen, &p, &len) != 1
+		|| asn1_int_from_der(&version, &p, &len) != 1
+		|| asn1_check(version == CMS_version_v1) != 1
+		|| asn1_set_from_der(&rcpt_infos, &rcpt_infos_len, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	while (rcpt_infos_len) {
+		if ((ret = cms_recipient_info_decrypt_from_der(rcpt_key,
+			issuer, issuer_len, serial, serial_len,
+			key, &keylen, sizeof(key), &rcpt_infos, &rcpt_infos_len)) < 0) {
+			error_print();
+			return -1;
+		} else if (ret) {
+			break;
+		}
+	}
+	if (!ret) {
+		error_print();
+		return -1;
+	}
+
+	if (cms_header_from_der(ASN1_TAG_SEQUENCE, &enced_content_info_len, &p, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	enced_content_info_offset = p - in;
+	if (cms_content_type_from_der(&content_type, &p, &len) != 1
+		|| asn1_check(content_type == OID_cms_data) != 1
+		|| x509_encryption_algor_from_der(&enc_algor, &iv, &ivlen, &p, &len) != 1
+		|| asn1_check(enc_algor == OID_sm4_cbc) != 1
+		|| asn1_check(ivlen == SM4_BLOCK_SIZE) != 1
+		|| asn1_check(keylen == SM4_KEY_SIZE) != 1
+		|| cms_header_from_der(ASN1_TAG_IMPLICIT(0), content_len, &p, &len) != 1
+		|| asn1_check(*content_len && *content_len % SM4_BLOCK_SIZE == 0) != 1) {
+		error_print();
+		goto end;
+	}
+	*header_len = p - in;
+	if (*header_len - enced_content_info_offset + *content_len > enced_content_info_len) {
+		error_print();
+		goto end;
+	}
+	*trailer_len = enced_content_info_len - (*header_len - enced_content_info_offset) - *content_len;
+
+	if (sm4_cbc_decrypt_init(&ctx->cbc_ctx, key, iv) != 1) {
+		error_print();
+		goto end;
+	}
+	ctx->content_len = *content_len;
+	ctx->trailer_len = *trailer_len;
+	ret = 1;
+end:
+	gmssl_secure_clear(key, sizeof(key));
+	return ret == 1 ? 1 : -1;
+}
+
+int cms_deenvelop_update(CMS_DEENVELOP_CTX *ctx, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (inlen > ctx->content_len - ctx->content_nbytes) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (inlen && sm4_cbc_decrypt_update(&ctx->cbc_ctx, in, inlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->content_nbytes += inlen;
+	return 1;
+}
+
+int cms_deenvelop_finish(CMS_DEENVELOP_CTX *ctx, const uint8_t *trailer, size_t trailer_len,
+	uint8_t *out, size_t *outlen,
+	const uint8_t **shared_info1, size_t *shared_info1_len,
+	const uint8_t **shared_info2, size_t *shared_info2_len)
+{
+	if (!ctx || (!trailer && trailer_len) || !out || !outlen
+		|| !shared_info1 || !shared_info1_len || !shared_info2 || !shared_info2_len) {
+		error_print();
+		return -1;
+	}
+	if (ctx->content_nbytes != ctx->content_len || trailer_len != ctx->trailer_len) {
+		error_print();
+		return -1;
+	}
+	if (sm4_cbc_decrypt_finish(&ctx->cbc_ctx, out, outlen) != 1) {
+		gmssl_secure_clear(&ctx->cbc_ctx, sizeof(SM4_CBC_CTX));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&ctx->cbc_ctx, sizeof(SM4_CBC_CTX));
+
+	*shared_info1 = *shared_info2 = NULL;
+	*shared_info1_len = *shared_info2_len = 0;
+	if (trailer_len
+		&& (asn1_implicit_octet_string_from_der(1, shared_info1, shared_info1_len, &trailer, &trailer_len) < 0
+		|| asn1_implicit_octet_string_from_der(2, shared_info2, shared_info2_len, &trailer, &trailer_len) < 0
+		|| asn1_length_is_zero(trailer_len) != 1)) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int cms_to_pem(const uint8_t *cms, size_t cms_len, FILE *fp)
 {
 	if (pem_write(fp, PEM_CMS, cms, cms_len) != 1) {
@@ -0,0 +1,202 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <gmssl/cpu.h>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+# define CPU_X86
+# if defined(_MSC_VER)
+#  include <intrin.h>
+# else
+#  include <cpuid.h>
+# endif
+#elif defined(__aarch64__) || defined(_M_ARM64)
+# define CPU_AARCH64
+# if defined(__linux__)
+#  include <sys/auxv.h>
+# endif
+#elif defined(__riscv) && (__riscv_xlen == 64)
+# define CPU_RISCV64
+# if defined(__linux__)
+#  include <unistd.h>
+#  include <sys/syscall.h>
+# endif
+#elif defined(__wasm__)
+# define CPU_WASM
+#endif
+
+
+#ifdef CPU_X86
+static void cpuid(uint32_t leaf, uint32_t subleaf, uint32_t r[4])
+{
+#if defined(_MSC_VER)
+	__cpuidex((int *)r, (int)leaf, (int)subleaf);
+#else
+	__cpuid_count(leaf, subleaf, r[0], r[1], r[2], r[3]);
+#endif
+}
+
+static uint64_t xgetbv(void)
+{
+#if defined(_MSC_VER)
+	return _xgetbv(0);
+#else
+	uint32_t eax, edx;
+	__asm__ volatile ("xgetbv" : "=a"(eax), "=d"(edx) : "c"(0));
+	return ((uint64_t)edx << 32) | eax;
+#endif
+}
+
+static uint64_t cpu_probe(void)
+{
+	uint64_t features = 0;
+	uint64_t xcr0 = 0;
+	uint32_t r[4];
+	uint32_t max_leaf;
+	int os_avx = 0;
+	int os_avx512 = 0;
+
+	cpuid(0, 0, r);
+	max_leaf = r[0];
+	if (max_leaf < 1) {
+		return 0;
+	}
+
+	cpuid(1, 0, r);
+	if (r[2] & (1u << 9))  features |= GMSSL_CPU_SSSE3;
+	if (r[2] & (1u << 25)) features |= GMSSL_CPU_AESNI;
+	if (r[2] & (1u << 1))  features |= GMSSL_CPU_PCLMUL;
+
+	// OSXSAVE, then check the OS saves XMM/YMM (and opmask/ZMM) state
+	if (r[2] & (1u << 27)) {
+		xcr0 = xgetbv();
+		os_avx = (xcr0 & 0x06) == 0x06;
+		os_avx512 = os_avx && (xcr0 & 0xe0) == 0xe0;
+	}
+	if (os_avx && (r[2] & (1u << 28))) {
+		features |= GMSSL_CPU_AVX;
+	}
+
+	if (max_leaf >= 7) {
+		cpuid(7, 0, r);
+		if (os_avx && (r[1] & (1u << 5))) features |= GMSSL_CPU_AVX2;
+		if (r[1] & (1u << 8))  features |= GMSSL_CPU_BMI2;
+		if (r[1] & (1u << 19)) features |= GMSSL_CPU_ADX;
+		if (r[1] & (1u << 29)) features |= GMSSL_CPU_SHA;
+		if (r[2] & (1u << 8))  features |= GMSSL_CPU_GFNI;
+		if (os_avx) {
+			if (r[2] & (1u << 9))  features |= GMSSL_CPU_VAES;
+			if (r[2] & (1u << 10)) features |= GMSSL_CPU_VPCLMULQDQ;
+		}
+		if (os_avx512) {
+			if (r[1] & (1u << 16)) features |= GMSSL_CPU_AVX512F;
+			if (r[1] & (1u << 30)) features |= GMSSL_CPU_AVX512BW;
+			if (r[1] & (1u << 31)) features |= GMSSL_CPU_AVX512VL;
+			if (r[1] & (1u << 21)) features |= GMSSL_CPU_AVX512IFMA;
+		}
+	}
+
+	return features;
+}
+
+#elif defined(CPU_AARCH64)
+static uint64_t cpu_probe(void)
+{
+	uint64_t features = GMSSL_CPU_NEON; // Advanced SIMD is mandatory on AArch64
+
+#if defined(__linux__)
+	unsigned long hwcap = getauxval(AT_HWCAP);
+
+	// bits of HWCAP_AES, HWCAP_PMULL, ... in <asm/hwcap.h>
+	if (hwcap & (1u << 3))  features |= GMSSL_CPU_ARM_AES;
+	if (hwcap & (1u << 4))  features |= GMSSL_CPU_ARM_PMULL;
+	if (hwcap & (1u << 6))  features |= GMSSL_CPU_ARM_SHA2;
+	if (hwcap & (1u << 18)) features |= GMSSL_CPU_ARM_SM3;
+	if (hwcap & (1u << 19)) features |= GMSSL_CPU_ARM_SM4;
+	if (hwcap & (1u << 21)) features |= GMSSL_CPU_ARM_SHA512;
+#elif defined(__APPLE__)
+	// every Apple Silicon core has the AES/PMULL/SHA2/SHA512 extensions
+	features |= GMSSL_CPU_ARM_AES | GMSSL_CPU_ARM_PMULL | GMSSL_CPU_ARM_SHA2 | GMSSL_CPU_ARM_SHA512;
+#endif
+	return features;
+}
+
+#elif defined(CPU_RISCV64)
+#if defined(__linux__)
+// riscv_hwprobe(2) of Linux 6.4, the Zk* bits are reported since Linux 6.8, see <asm/hwprobe.h>
+#ifndef __NR_riscv_hwprobe
+#define __NR_riscv_hwprobe		258
+#endif
+#define RISCV_HWPROBE_KEY_IMA_EXT_0	4
+#define RISCV_HWPROBE_IMA_V		(1u << 2)
+#define RISCV_HWPROBE_EXT_ZKSED		(1u << 14)
+#define RISCV_HWPROBE_EXT_ZKSH		(1u << 15)
+
+struct riscv_hwprobe_pair {
+	int64_t key;
+	uint64_t value;
+};
+#endif
+
+static uint64_t cpu_probe(void)
+{
+	uint64_t features = 0;
+
+#if defined(__linux__)
+	struct riscv_hwprobe_pair pair = { RISCV_HWPROBE_KEY_IMA_EXT_0, 0 };
+
+	// older kernels fail with ENOSYS, unknown keys are returned with key = -1
+	if (syscall(__NR_riscv_hwprobe, &pair, 1, 0, NULL, 0) == 0 && pair.key != -1) {
+		if (pair.value & RISCV_HWPROBE_IMA_V)       features |= GMSSL_CPU_RISCV_V;
+		if (pair.value & RISCV_HWPROBE_EXT_ZKSED)   features |= GMSSL_CPU_RISCV_ZKSED;
+		if (pair.value & RISCV_HWPROBE_EXT_ZKSH)    features |= GMSSL_CPU_RISCV_ZKSH;
+	}
+#endif
+	return features;
+}
+
+#elif defined(CPU_WASM)
+// a runtime without SIMD128 rejects the module, there is nothing to probe
+static uint64_t cpu_probe(void)
+{
+#if defined(__wasm_simd128__)
+	return GMSSL_CPU_WASM_SIMD128;
+#else
+	return 0;
+#endif
+}
+
+#else
+static uint64_t cpu_probe(void)
+{
+	return 0;
+}
+#endif
+
+
+static volatile int cpu_features_ready = 0;
+static uint64_t cpu_features = 0;
+static uint64_t cpu_features_disabled = 0;
+
+uint64_t gmssl_cpu_features(void)
+{
+	// probing is idempotent, concurrent first calls just do it twice
+	if (!cpu_features_ready) {
+		cpu_features = cpu_probe();
+		cpu_features_ready = 1;
+	}
+	return cpu_features & ~cpu_features_disabled;
+}
+
+void gmssl_cpu_disable_features(uint64_t features)
+{
+	cpu_features_disabled |= features;
+}
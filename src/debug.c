@@ -13,6 +13,13 @@
 #include <stdlib.h>
 #include <stdint.h>
 #include <gmssl/error.h>
+#include <gmssl/metrics.h>
+
+#ifdef _WIN32
+#define ERROR_THREAD_LOCAL __declspec(thread)
+#else
+#define ERROR_THREAD_LOCAL __thread
+#endif
 
 void print_der(const uint8_t *in, size_t inlen)
 {
@@ -110,3 +117,109 @@ int tls_trace(int format, int indent, const char *str, ...)
 	return 1;
 }
 
+
+
+typedef struct {
+	const char *file;
+	int line;
+	const char *func;
+	const char *str;
+	char msg[ERROR_MSG_SIZE];
+} ERROR_ENTRY;
+
+// ring of the newest errors, entries[head] is the oldest of `len`
+typedef struct {
+	ERROR_ENTRY entries[ERROR_QUEUE_SIZE];
+	size_t head;
+	size_t len;
+	uint64_t count;
+} ERROR_QUEUE;
+
+static ERROR_THREAD_LOCAL ERROR_QUEUE error_queue;
+
+void error_count_add(void)
+{
+	error_queue.count++;
+	METRICS_ADD(METRICS_errors, 1);
+}
+
+uint64_t error_count(void)
+{
+	return error_queue.count;
+}
+
+static ERROR_ENTRY *error_queue_new_entry(const char *file, int line, const char *func)
+{
+	ERROR_QUEUE *q = &error_queue;
+	ERROR_ENTRY *e;
+
+	if (q->len == ERROR_QUEUE_SIZE) {
+		q->head = (q->head + 1) % ERROR_QUEUE_SIZE;
+		q->len--;
+	}
+	e = &q->entries[(q->head + q->len) % ERROR_QUEUE_SIZE];
+	q->len++;
+	e->file = file;
+	e->line = line;
+	e->func = func;
+	e->str = NULL;
+	error_count_add();
+	return e;
+}
+
+void error_queue_push(const char *file, int line, const char *func, const char *str)
+{
+	ERROR_ENTRY *e = error_queue_new_entry(file, line, func);
+	e->str = str;
+}
+
+void error_queue_push_msg(const char *file, int line, const char *func, const char *fmt, ...)
+{
+	ERROR_ENTRY *e = error_queue_new_entry(file, line, func);
+	va_list args;
+
+	va_start(args, fmt);
+	vsnprintf(e->msg, sizeof(e->msg), fmt, args);
+	va_end(args);
+	e->str = e->msg;
+}
+
+int error_queue_get(const char **file, int *line, const char **func, const char **msg)
+{
+	ERROR_QUEUE *q = &error_queue;
+	ERROR_ENTRY *e;
+
+	if (!q->len) {
+		return 0;
+	}
+	e = &q->entries[q->head];
+	q->head = (q->head + 1) % ERROR_QUEUE_SIZE;
+	q->len--;
+	if (file) *file = e->file;
+	if (line) *line = e->line;
+	if (func) *func = e->func;
+	if (msg) *msg = e->str;
+	return 1;
+}
+
+void error_queue_clear(void)
+{
+	error_queue.head = 0;
+	error_queue.len = 0;
+}
+
+int error_queue_print(FILE *fp)
+{
+	const char *file;
+	const char *func;
+	const char *msg;
+	int line;
+
+	while (error_queue_get(&file, &line, &func, &msg) == 1) {
+		size_t len = msg ? strlen(msg) : 0;
+		// messages of error_print_msg() end with a newline
+		fprintf(fp, "%s:%d:%s(): %s%s", file, line, func, msg ? msg : "",
+			(len && msg[len - 1] == '\n') ? "" : "\n");
+	}
+	return 1;
+}
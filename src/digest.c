@@ -67,6 +67,26 @@ int digest_update(DIGEST_CTX *ctx, const uint8_t *data, size_t datalen)
 	return 1;
 }
 
+int digest_updatev(DIGEST_CTX *ctx, const DIGEST_IOVEC *iov, size_t iovcnt)
+{
+	size_t i;
+
+	if (!ctx || (!iov && iovcnt)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->digest->updatev) {
+		return ctx->digest->updatev(ctx, iov, iovcnt);
+	}
+	for (i = 0; i < iovcnt; i++) {
+		if (ctx->digest->update(ctx, (const uint8_t *)iov[i].base, iov[i].len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
 int digest_finish(DIGEST_CTX *ctx, uint8_t *dgst, size_t *dgstlen)
 {
 	if (dgst == NULL || dgstlen == NULL) {
@@ -138,6 +158,12 @@ static int _sm3_digest_update(DIGEST_CTX *ctx, const uint8_t *in, size_t inlen)
 	return 1;
 }
 
+static int _sm3_digest_updatev(DIGEST_CTX *ctx, const DIGEST_IOVEC *iov, size_t iovcnt)
+{
+	sm3_updatev(&ctx->u.sm3_ctx, iov, iovcnt);
+	return 1;
+}
+
 static int _sm3_digest_finish(DIGEST_CTX *ctx, uint8_t *dgst)
 {
 	if (!ctx || !dgst) {
@@ -156,6 +182,7 @@ static const DIGEST sm3_digest_object = {
 	_sm3_digest_init,
 	_sm3_digest_update,
 	_sm3_digest_finish,
+	_sm3_digest_updatev,
 };
 
 const DIGEST *DIGEST_sm3(void)
@@ -204,6 +231,7 @@ static const DIGEST sha1_digest_object = {
 	sha1_digest_init,
 	sha1_digest_update,
 	sha1_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha1(void)
@@ -253,6 +281,7 @@ static const DIGEST sha224_digest_object = {
 	sha224_digest_init,
 	sha224_digest_update,
 	sha224_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha224(void)
@@ -298,6 +327,7 @@ static const DIGEST sha256_digest_object = {
 	sha256_digest_init,
 	sha256_digest_update,
 	sha256_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha256(void)
@@ -344,6 +374,7 @@ static const DIGEST sha384_digest_object = {
 	sha384_digest_init,
 	sha384_digest_update,
 	sha384_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha384(void)
@@ -390,6 +421,7 @@ static const DIGEST sha512_digest_object = {
 	sha512_digest_init,
 	sha512_digest_update,
 	sha512_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha512(void)
@@ -419,6 +451,7 @@ static const DIGEST sha512_224_digest_object = {
 	sha512_digest_init,
 	sha512_digest_update,
 	sha512_224_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha512_224(void)
@@ -449,6 +482,7 @@ static const DIGEST sha512_256_digest_object = {
 	sha512_digest_init,
 	sha512_digest_update,
 	sha512_256_digest_finish,
+	NULL, // digest_updatev() calls update() per buffer
 };
 
 const DIGEST *DIGEST_sha512_256(void)
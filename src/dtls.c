@@ -0,0 +1,487 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/tls.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+void dtls_replay_window_init(DTLS_REPLAY_WINDOW *window)
+{
+	window->top = 0;
+	window->bitmap = 0;
+	window->empty = 1;
+}
+
+int dtls_replay_window_check(const DTLS_REPLAY_WINDOW *window, uint64_t seq)
+{
+	if (window->empty || seq > window->top) {
+		return 1;
+	}
+	if (window->top - seq >= DTLS_REPLAY_WINDOW_SIZE) {
+		return 0;
+	}
+	return (window->bitmap >> (window->top - seq)) & 1 ? 0 : 1;
+}
+
+// only called for authentic records
+void dtls_replay_window_update(DTLS_REPLAY_WINDOW *window, uint64_t seq)
+{
+	if (window->empty) {
+		window->top = seq;
+		window->bitmap = 1;
+		window->empty = 0;
+	} else if (seq > window->top) {
+		uint64_t shift = seq - window->top;
+		window->bitmap = shift < DTLS_REPLAY_WINDOW_SIZE ? (window->bitmap << shift) | 1 : 1;
+		window->top = seq;
+	} else if (window->top - seq < DTLS_REPLAY_WINDOW_SIZE) {
+		window->bitmap |= (uint64_t)1 << (window->top - seq);
+	}
+}
+
+int dtls_record_init(DTLS_RECORD_CTX *ctx, int protocol)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (protocol != TLS_protocol_dtls12 && protocol != TLS_protocol_tlcp) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->protocol = protocol;
+	// epoch 0 is in the clear
+	ctx->write[0].valid = 1;
+	ctx->read[0].valid = 1;
+	dtls_replay_window_init(&ctx->read[0].window);
+	return 1;
+}
+
+void dtls_record_cleanup(DTLS_RECORD_CTX *ctx)
+{
+	if (ctx) {
+		gmssl_secure_clear(ctx, sizeof(DTLS_RECORD_CTX));
+	}
+}
+
+// the new epoch becomes the current one, the current one the previous one
+static int dtls_epoch_set(DTLS_EPOCH epochs[2], uint16_t epoch, const uint8_t key[16], const uint8_t iv[12])
+{
+	if (epoch <= epochs[0].epoch) {
+		error_print();
+		return -1;
+	}
+	epochs[1] = epochs[0];
+	gmssl_secure_clear(&epochs[0], sizeof(DTLS_EPOCH));
+	epochs[0].valid = 1;
+	epochs[0].epoch = epoch;
+	sm4_set_encrypt_key(&epochs[0].key, key);
+	memcpy(epochs[0].iv, iv, 12);
+	dtls_replay_window_init(&epochs[0].window);
+	return 1;
+}
+
+int dtls_record_set_write_key(DTLS_RECORD_CTX *ctx, uint16_t epoch, const uint8_t key[16], const uint8_t iv[12])
+{
+	if (!ctx || !key || !iv) {
+		error_print();
+		return -1;
+	}
+	if (dtls_epoch_set(ctx->write, epoch, key, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int dtls_record_set_read_key(DTLS_RECORD_CTX *ctx, uint16_t epoch, const uint8_t key[16], const uint8_t iv[12])
+{
+	if (!ctx || !key || !iv) {
+		error_print();
+		return -1;
+	}
+	if (dtls_epoch_set(ctx->read, epoch, key, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int dtls13_record_set_traffic_secret(DTLS_RECORD_CTX *ctx, int is_write, uint16_t epoch, const uint8_t secret[32])
+{
+	uint8_t key[16];
+	uint8_t iv[12];
+	int ret;
+
+	if (!ctx || !secret) {
+		error_print();
+		return -1;
+	}
+	if (tls13_hkdf_expand_key_iv(DIGEST_sm3(), secret, sizeof(key), key, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = is_write ? dtls_record_set_write_key(ctx, epoch, key, iv)
+		: dtls_record_set_read_key(ctx, epoch, key, iv);
+	gmssl_secure_clear(key, sizeof(key));
+	gmssl_secure_clear(iv, sizeof(iv));
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static DTLS_EPOCH *dtls_epoch_get(DTLS_EPOCH epochs[2], uint16_t epoch)
+{
+	int i;
+
+	for (i = 0; i < 2; i++) {
+		if (epochs[i].valid && epochs[i].epoch == epoch) {
+			return &epochs[i];
+		}
+	}
+	return NULL;
+}
+
+// nonce = iv xor (0 || epoch || seq)
+static void dtls_nonce(const DTLS_EPOCH *ep, const uint8_t *epoch_seq, uint8_t nonce[12])
+{
+	memset(nonce, 0, 4);
+	memcpy(nonce + 4, epoch_seq, 8);
+	gmssl_memxor(nonce, nonce, ep->iv, 12);
+}
+
+int dtls_record_seal(DTLS_RECORD_CTX *ctx, uint16_t epoch, int type,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	DTLS_EPOCH *ep;
+	uint8_t nonce[12];
+	size_t len;
+
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (inlen > TLS_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!(ep = dtls_epoch_get(ctx->write, epoch))) {
+		error_print();
+		return -1;
+	}
+	if (ep->seq > DTLS_MAX_SEQ) {
+		// the epoch has to change first
+		error_print();
+		return -1;
+	}
+	len = epoch ? inlen + DTLS_RECORD_TAG_SIZE : inlen;
+
+	if (inlen) {
+		memmove(out + DTLS_RECORD_HEADER_SIZE, in, inlen);
+	}
+	out[0] = (uint8_t)type;
+	PUTU16(out + 1, (uint16_t)ctx->protocol);
+	PUTU16(out + 3, epoch);
+	PUTU16(out + 5, (uint16_t)(ep->seq >> 32));
+	PUTU32(out + 7, (uint32_t)ep->seq);
+	PUTU16(out + 11, (uint16_t)len);
+
+	if (epoch) {
+		dtls_nonce(ep, out + 3, nonce);
+		if (sm4_gcm_encrypt(&ep->key, nonce, sizeof(nonce), out, DTLS_RECORD_HEADER_SIZE,
+			out + DTLS_RECORD_HEADER_SIZE, inlen, out + DTLS_RECORD_HEADER_SIZE,
+			DTLS_RECORD_TAG_SIZE, out + DTLS_RECORD_HEADER_SIZE + inlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	ep->seq++;
+	*outlen = DTLS_RECORD_HEADER_SIZE + len;
+	return 1;
+}
+
+int dtls_record_open(DTLS_RECORD_CTX *ctx, const uint8_t *record, size_t recordlen,
+	int *type, uint16_t *epoch, uint64_t *seq, uint8_t *out, size_t *outlen)
+{
+	DTLS_EPOCH *ep;
+	uint8_t header[DTLS_RECORD_HEADER_SIZE];
+	uint8_t nonce[12];
+	size_t len;
+
+	if (!ctx || !record || !type || !epoch || !seq || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	// anything not from the peer is dropped without an error
+	if (recordlen < DTLS_RECORD_HEADER_SIZE
+		|| GETU16(record + 1) != ctx->protocol
+		|| (len = GETU16(record + 11)) != recordlen - DTLS_RECORD_HEADER_SIZE) {
+		return 0;
+	}
+	memcpy(header, record, DTLS_RECORD_HEADER_SIZE);
+	*type = header[0];
+	*epoch = GETU16(header + 3);
+	*seq = ((uint64_t)GETU16(header + 5) << 32) | GETU32(header + 7);
+
+	if (!(ep = dtls_epoch_get(ctx->read, *epoch))
+		|| !dtls_replay_window_check(&ep->window, *seq)) {
+		return 0;
+	}
+	if (*epoch) {
+		if (len < DTLS_RECORD_TAG_SIZE) {
+			return 0;
+		}
+		len -= DTLS_RECORD_TAG_SIZE;
+		dtls_nonce(ep, header + 3, nonce);
+		if (sm4_gcm_decrypt(&ep->key, nonce, sizeof(nonce), header, sizeof(header),
+			record + DTLS_RECORD_HEADER_SIZE, len, record + DTLS_RECORD_HEADER_SIZE + len,
+			DTLS_RECORD_TAG_SIZE, out) != 1) {
+			gmssl_secure_clear(out, len);
+			return 0;
+		}
+	} else if (len) {
+		memmove(out, record + DTLS_RECORD_HEADER_SIZE, len);
+	}
+	dtls_replay_window_update(&ep->window, *seq);
+	*outlen = len;
+	return 1;
+}
+
+int dtls_record_next(const uint8_t **datagram, size_t *datagramlen, const uint8_t **record, size_t *recordlen)
+{
+	size_t len;
+
+	if (!datagram || !(*datagram) || !datagramlen || !record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	if (!(*datagramlen)) {
+		return 0;
+	}
+	if (*datagramlen < DTLS_RECORD_HEADER_SIZE
+		|| (len = DTLS_RECORD_HEADER_SIZE + GETU16(*datagram + 11)) > *datagramlen) {
+		error_print();
+		return -1;
+	}
+	*record = *datagram;
+	*recordlen = len;
+	*datagram += len;
+	*datagramlen -= len;
+	return 1;
+}
+
+void dtls_flight_init(DTLS_FLIGHT *flight)
+{
+	memset(flight, 0, sizeof(*flight));
+	flight->timeout = DTLS_FLIGHT_INITIAL_TIMEOUT;
+}
+
+int dtls_flight_add(DTLS_FLIGHT *flight, uint16_t epoch, int type, const uint8_t *msg, size_t msglen)
+{
+	if (!flight || !msg || !msglen) {
+		error_print();
+		return -1;
+	}
+	if (flight->sent) {
+		flight->buflen = 0;
+		flight->messages_cnt = 0;
+		flight->sent = 0;
+		flight->deadline = 0;
+		flight->retransmissions = 0;
+	}
+	if (flight->messages_cnt >= DTLS_FLIGHT_MAX_MESSAGES
+		|| msglen > sizeof(flight->buf) - flight->buflen
+		|| msglen > DTLS_MAX_RECORD_DATA_SIZE) {
+		error_print();
+		return -1;
+	}
+	memcpy(flight->buf + flight->buflen, msg, msglen);
+	flight->messages[flight->messages_cnt].type = type;
+	flight->messages[flight->messages_cnt].epoch = epoch;
+	flight->messages[flight->messages_cnt].offset = flight->buflen;
+	flight->messages[flight->messages_cnt].len = msglen;
+	flight->messages_cnt++;
+	flight->buflen += msglen;
+	return 1;
+}
+
+static int dtls_datagram_send(const TLS_TRANSPORT *transport, const uint8_t *buf, size_t len)
+{
+	if (transport->send(transport->arg, buf, len) != (tls_ret_t)len) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// every transmission is sealed again, a record number is never sent twice
+static int dtls_flight_transmit(DTLS_FLIGHT *flight, DTLS_RECORD_CTX *ctx, size_t mtu,
+	const TLS_TRANSPORT *transport, uint64_t now)
+{
+	uint8_t datagram[DTLS_MAX_DATAGRAM_SIZE];
+	size_t datagramlen = 0;
+	size_t i;
+
+	if (mtu < DTLS_RECORD_HEADER_SIZE + DTLS_RECORD_TAG_SIZE + 1 || mtu > sizeof(datagram)) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < flight->messages_cnt; i++) {
+		size_t msglen = flight->messages[i].len;
+		size_t reclen = DTLS_RECORD_HEADER_SIZE + msglen
+			+ (flight->messages[i].epoch ? DTLS_RECORD_TAG_SIZE : 0);
+
+		// the handshake layer fragments the messages to fit the MTU
+		if (reclen > mtu) {
+			error_print();
+			return -1;
+		}
+		if (datagramlen + reclen > mtu) {
+			if (dtls_datagram_send(transport, datagram, datagramlen) != 1) {
+				error_print();
+				return -1;
+			}
+			datagramlen = 0;
+		}
+		if (dtls_record_seal(ctx, flight->messages[i].epoch, flight->messages[i].type,
+			flight->buf + flight->messages[i].offset, msglen,
+			datagram + datagramlen, &reclen) != 1) {
+			error_print();
+			return -1;
+		}
+		datagramlen += reclen;
+	}
+	if (datagramlen && dtls_datagram_send(transport, datagram, datagramlen) != 1) {
+		error_print();
+		return -1;
+	}
+	flight->sent = 1;
+	flight->deadline = now + flight->timeout;
+	return 1;
+}
+
+int dtls_flight_send(DTLS_FLIGHT *flight, DTLS_RECORD_CTX *ctx, size_t mtu,
+	const TLS_TRANSPORT *transport, uint64_t now)
+{
+	if (!flight || !ctx || !transport || !transport->send) {
+		error_print();
+		return -1;
+	}
+	if (!flight->messages_cnt) {
+		error_print();
+		return -1;
+	}
+	flight->timeout = DTLS_FLIGHT_INITIAL_TIMEOUT;
+	flight->retransmissions = 0;
+	if (dtls_flight_transmit(flight, ctx, mtu, transport, now) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int64_t dtls_flight_timeout(const DTLS_FLIGHT *flight, uint64_t now)
+{
+	if (!flight || !flight->deadline) {
+		return -1;
+	}
+	return now >= flight->deadline ? 0 : (int64_t)(flight->deadline - now);
+}
+
+int dtls_flight_retransmit(DTLS_FLIGHT *flight, DTLS_RECORD_CTX *ctx, size_t mtu,
+	const TLS_TRANSPORT *transport, uint64_t now)
+{
+	if (!flight || !ctx || !transport || !transport->send) {
+		error_print();
+		return -1;
+	}
+	if (!flight->deadline || now < flight->deadline) {
+		return 0;
+	}
+	flight->timeout = flight->timeout * 2 < DTLS_FLIGHT_MAX_TIMEOUT ?
+		flight->timeout * 2 : DTLS_FLIGHT_MAX_TIMEOUT;
+	flight->retransmissions++;
+	if (dtls_flight_transmit(flight, ctx, mtu, transport, now) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+void dtls_flight_ack(DTLS_FLIGHT *flight)
+{
+	if (flight) {
+		flight->deadline = 0;
+		flight->timeout = DTLS_FLIGHT_INITIAL_TIMEOUT;
+	}
+}
+
+static void dtls_cookie_mac(const uint8_t secret[32], const uint8_t *addr, size_t addrlen,
+	const uint8_t client_random[32], const uint8_t time[4], uint8_t mac[SM3_HMAC_SIZE])
+{
+	SM3_HMAC_CTX hmac_ctx;
+
+	sm3_hmac_init(&hmac_ctx, secret, 32);
+	sm3_hmac_update(&hmac_ctx, time, 4);
+	sm3_hmac_update(&hmac_ctx, client_random, 32);
+	sm3_hmac_update(&hmac_ctx, addr, addrlen);
+	sm3_hmac_finish(&hmac_ctx, mac);
+	gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+}
+
+int dtls_cookie_generate(const uint8_t secret[32], const uint8_t *addr, size_t addrlen,
+	const uint8_t client_random[32], uint32_t now, uint8_t cookie[DTLS_COOKIE_SIZE])
+{
+	uint8_t mac[SM3_HMAC_SIZE];
+
+	if (!secret || !addr || !addrlen || !client_random || !cookie) {
+		error_print();
+		return -1;
+	}
+	PUTU32(cookie, now);
+	dtls_cookie_mac(secret, addr, addrlen, client_random, cookie, mac);
+	memcpy(cookie + 4, mac, DTLS_COOKIE_SIZE - 4);
+	return 1;
+}
+
+int dtls_cookie_verify(const uint8_t secret[32], const uint8_t *addr, size_t addrlen,
+	const uint8_t client_random[32], uint32_t now, uint32_t max_age,
+	const uint8_t *cookie, size_t cookielen)
+{
+	uint8_t mac[SM3_HMAC_SIZE];
+	uint32_t time;
+
+	if (!secret || !addr || !addrlen || !client_random || (!cookie && cookielen)) {
+		error_print();
+		return -1;
+	}
+	if (cookielen != DTLS_COOKIE_SIZE) {
+		return 0;
+	}
+	time = GETU32(cookie);
+	if (time > now || now - time > max_age) {
+		return 0;
+	}
+	dtls_cookie_mac(secret, addr, addrlen, client_random, cookie, mac);
+	if (gmssl_secure_memcmp(mac, cookie + 4, DTLS_COOKIE_SIZE - 4) != 0) {
+		return 0;
+	}
+	return 1;
+}
@@ -8,11 +8,21 @@
  */
 
 
+#ifdef __linux__
+#define _GNU_SOURCE // O_DIRECT, F_SETPIPE_SZ
+#endif
 #include <errno.h>
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <sys/stat.h>
+#ifndef WIN32
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#endif
+#include <gmssl/mem.h>
+#include <gmssl/file.h>
 #include <gmssl/error.h>
 
 
@@ -61,3 +71,274 @@ end:
 	return ret;
 }
 
+
+#ifndef WIN32
+int file_map(const char *file, const uint8_t **data, size_t *datalen)
+{
+	int fd;
+	struct stat st;
+	void *p;
+
+	if (!file || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if ((fd = open(file, O_RDONLY)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (fstat(fd, &st) < 0) {
+		close(fd);
+		error_print();
+		return -1;
+	}
+	if (st.st_size == 0) {
+		close(fd);
+		*data = NULL;
+		*datalen = 0;
+		return 1;
+	}
+	// private read-only pages are shared by every process mapping the same file
+	p = mmap(NULL, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd);
+	if (p == MAP_FAILED) {
+		error_print();
+		return -1;
+	}
+	*data = (const uint8_t *)p;
+	*datalen = (size_t)st.st_size;
+	return 1;
+}
+
+void file_unmap(const uint8_t *data, size_t datalen)
+{
+	if (data && datalen) {
+		munmap((void *)data, datalen);
+	}
+}
+#else
+int file_map(const char *file, const uint8_t **data, size_t *datalen)
+{
+	uint8_t *buf;
+
+	if (!data || file_read_all(file, &buf, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	*data = buf;
+	return 1;
+}
+
+void file_unmap(const uint8_t *data, size_t datalen)
+{
+	free((void *)data);
+}
+#endif
+
+
+#ifndef WIN32
+
+// O_DIRECT wants the buffer, the offset and the length aligned to the logical block size
+#define FILE_READ_ALIGN		4096
+#define FILE_READ_PIPE_SIZE	(1024 * 1024)
+
+int file_read_init(FILE_READER *rd, FILE *fp, int flags)
+{
+	struct stat st;
+	off_t pos;
+	void *buf;
+
+	if (!rd || !fp) {
+		error_print();
+		return -1;
+	}
+	memset(rd, 0, sizeof(*rd));
+	rd->fp = fp;
+	rd->fd = fileno(fp);
+	rd->flags = flags;
+
+	if (fstat(rd->fd, &st) < 0) {
+		error_print();
+		return -1;
+	}
+
+	if (S_ISREG(st.st_mode)) {
+		if ((pos = lseek(rd->fd, 0, SEEK_CUR)) < 0) {
+			error_print();
+			return -1;
+		}
+		rd->offset = (uint64_t)pos;
+		rd->size = (uint64_t)st.st_size;
+#ifdef O_DIRECT
+		if ((flags & FILE_READ_DIRECT) && pos % FILE_READ_ALIGN == 0) {
+			int fl = fcntl(rd->fd, F_GETFL);
+			if (fl >= 0 && fcntl(rd->fd, F_SETFL, fl | O_DIRECT) == 0) {
+				goto buffered;
+			}
+		}
+#endif
+		rd->flags &= ~FILE_READ_DIRECT;
+		return 1;
+	}
+	rd->flags &= ~FILE_READ_DIRECT;
+#if defined(__linux__) && defined(F_SETPIPE_SZ)
+	if (S_ISFIFO(st.st_mode)) {
+		// best effort, capped by /proc/sys/fs/pipe-max-size
+		(void)fcntl(rd->fd, F_SETPIPE_SZ, FILE_READ_PIPE_SIZE);
+	}
+#endif
+
+#ifdef O_DIRECT
+buffered:
+#endif
+	if (posix_memalign(&buf, FILE_READ_ALIGN, FILE_READ_CHUNK_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+	rd->buf = buf;
+	return 1;
+}
+
+static int file_read_map_next(FILE_READER *rd, const uint8_t **data, size_t *datalen)
+{
+	uint64_t base;
+	size_t len;
+	void *p;
+
+	if (!rd->map || rd->mappos == rd->maplen) {
+		if (rd->map) {
+			munmap((void *)rd->map, rd->maplen);
+			rd->map = NULL;
+		}
+		if (rd->offset >= rd->size) {
+			return 0;
+		}
+		base = rd->offset & ~((uint64_t)sysconf(_SC_PAGESIZE) - 1);
+		len = rd->size - base < FILE_READ_MAP_SIZE ? (size_t)(rd->size - base) : FILE_READ_MAP_SIZE;
+		p = mmap(NULL, len, PROT_READ, MAP_PRIVATE, rd->fd, (off_t)base);
+		if (p == MAP_FAILED) {
+			error_print();
+			return -1;
+		}
+#ifdef MADV_SEQUENTIAL
+		(void)madvise(p, len, MADV_SEQUENTIAL);
+#endif
+		rd->map = (const uint8_t *)p;
+		rd->maplen = len;
+		rd->mappos = (size_t)(rd->offset - base);
+		rd->offset = base + len;
+	}
+
+	len = rd->maplen - rd->mappos;
+	if (len > FILE_READ_CHUNK_SIZE) {
+		len = FILE_READ_CHUNK_SIZE;
+	}
+	*data = rd->map + rd->mappos;
+	*datalen = len;
+	rd->mappos += len;
+	return 1;
+}
+
+int file_read_next(FILE_READER *rd, const uint8_t **data, size_t *datalen)
+{
+	size_t n = 0;
+	ssize_t r;
+
+	if (!rd || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (!rd->buf) {
+		return file_read_map_next(rd, data, datalen);
+	}
+
+	while (!rd->eof && n < FILE_READ_CHUNK_SIZE) {
+		r = read(rd->fd, rd->buf + n, FILE_READ_CHUNK_SIZE - n);
+		if (r < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			error_print();
+			return -1;
+		}
+		if (r == 0) {
+			rd->eof = 1;
+			break;
+		}
+		n += (size_t)r;
+		// only the last O_DIRECT read is short, the next one would be unaligned
+		if ((rd->flags & FILE_READ_DIRECT) && r % FILE_READ_ALIGN) {
+			rd->eof = 1;
+		}
+	}
+	if (!n) {
+		return 0;
+	}
+	*data = rd->buf;
+	*datalen = n;
+	return 1;
+}
+
+void file_read_cleanup(FILE_READER *rd)
+{
+	if (rd) {
+		if (rd->map) {
+			munmap((void *)rd->map, rd->maplen);
+		}
+		if (rd->buf) {
+			gmssl_secure_clear(rd->buf, FILE_READ_CHUNK_SIZE);
+			free(rd->buf);
+		}
+		memset(rd, 0, sizeof(*rd));
+	}
+}
+
+#else
+
+int file_read_init(FILE_READER *rd, FILE *fp, int flags)
+{
+	if (!rd || !fp) {
+		error_print();
+		return -1;
+	}
+	memset(rd, 0, sizeof(*rd));
+	rd->fp = fp;
+	rd->flags = flags;
+	if (!(rd->buf = malloc(FILE_READ_CHUNK_SIZE))) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int file_read_next(FILE_READER *rd, const uint8_t **data, size_t *datalen)
+{
+	size_t n;
+
+	if (!rd || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (!(n = fread(rd->buf, 1, FILE_READ_CHUNK_SIZE, rd->fp))) {
+		if (ferror(rd->fp)) {
+			error_print();
+			return -1;
+		}
+		return 0;
+	}
+	*data = rd->buf;
+	*datalen = n;
+	return 1;
+}
+
+void file_read_cleanup(FILE_READER *rd)
+{
+	if (rd) {
+		if (rd->buf) {
+			gmssl_secure_clear(rd->buf, FILE_READ_CHUNK_SIZE);
+			free(rd->buf);
+		}
+		memset(rd, 0, sizeof(*rd));
+	}
+}
+#endif
@@ -16,6 +16,7 @@
 #include <gmssl/ghash.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 
 
 /*
@@ -33,83 +34,187 @@
  */
 void ghash(const uint8_t h[16], const uint8_t *aad, size_t aadlen, const uint8_t *c, size_t clen, uint8_t out[16])
 {
-	gf128_t H;
-	gf128_t X;
-	gf128_t L;
-
-	gf128_from_bytes(H, h);
-	gf128_set_zero(X);
-
-	PUTU64(out, (uint64_t)aadlen << 3);
-	PUTU64(out + 8, (uint64_t)clen << 3);
-	gf128_from_bytes(L, out);
-
-	while (aadlen) {
-		gf128_t A;
-		if (aadlen >= 16) {
-			gf128_from_bytes(A, aad);
-			aad += 16;
-			aadlen -= 16;
-		} else {
-			memset(out, 0, 16);
-			memcpy(out, aad, aadlen);
-			gf128_from_bytes(A, out);
-			aadlen = 0;
+	GHASH_CTX ctx;
+
+	// `out` might be `h`, ghash_init copies h first
+	ghash_init(&ctx, h, aad, aadlen);
+	ghash_update(&ctx, c, clen);
+	ghash_finish(&ctx, out);
+}
+
+#ifndef ENABLE_GMUL_ARM64
+/*
+ * 4-bit Shoup table in the GCM bit order, (hi, lo) = GETU64(X) || GETU64(X + 8)
+ * and the multiply by x is a right shift. T[i] = H * i for the 4-bit values i,
+ * the bit 8 of i is x^0. X * H is computed nibble by nibble from the last byte,
+ * the 4 bits shifted out of every step are reduced with ghash_rem_4bit.
+ * The table lookups are indexed by the data, as in the other table based GHASH.
+ */
+static const uint64_t ghash_rem_4bit[16] = {
+	(uint64_t)0x0000 << 48, (uint64_t)0x1C20 << 48, (uint64_t)0x3840 << 48, (uint64_t)0x2460 << 48,
+	(uint64_t)0x7080 << 48, (uint64_t)0x6CA0 << 48, (uint64_t)0x48C0 << 48, (uint64_t)0x54E0 << 48,
+	(uint64_t)0xE100 << 48, (uint64_t)0xFD20 << 48, (uint64_t)0xD940 << 48, (uint64_t)0xC560 << 48,
+	(uint64_t)0x9180 << 48, (uint64_t)0x8DA0 << 48, (uint64_t)0xA9C0 << 48, (uint64_t)0xB5E0 << 48,
+};
+
+static void ghash_4bit_init_table(uint64_t T[16][2], const uint8_t h[16])
+{
+	uint64_t hi = GETU64(h);
+	uint64_t lo = GETU64(h + 8);
+	uint64_t t;
+	int i, j;
+
+	T[0][0] = 0;
+	T[0][1] = 0;
+	// T[8] = H, T[4] = H * x, T[2] = H * x^2, T[1] = H * x^3
+	for (i = 8; i > 0; i >>= 1) {
+		T[i][0] = hi;
+		T[i][1] = lo;
+		t = (uint64_t)0xe100000000000000 & (0 - (lo & 1));
+		lo = (hi << 63) | (lo >> 1);
+		hi = (hi >> 1) ^ t;
+	}
+	for (i = 2; i < 16; i <<= 1) {
+		for (j = 1; j < i; j++) {
+			T[i + j][0] = T[i][0] ^ T[j][0];
+			T[i + j][1] = T[i][1] ^ T[j][1];
 		}
-		gf128_add(X, X, A);
-		gf128_mul(X, X, H);
 	}
+}
 
-	while (clen) {
-		gf128_t C;
-		if (clen >= 16) {
-			gf128_from_bytes(C, c);
-			c += 16;
-			clen -= 16;
-		} else {
-			memset(out, 0, 16);
-			memcpy(out, c, clen);
-			gf128_from_bytes(C, out);
-			clen = 0;
+static void ghash_4bit_update_blocks(const uint64_t T[16][2], uint8_t X[16], const uint8_t *in, size_t nblocks)
+{
+	uint64_t hi, lo;
+	uint8_t b;
+	int i, rem;
+
+	while (nblocks--) {
+		hi = GETU64(X) ^ GETU64(in);
+		lo = GETU64(X + 8) ^ GETU64(in + 8);
+		PUTU64(X, hi);
+		PUTU64(X + 8, lo);
+
+		hi = lo = 0;
+		for (i = 15; i >= 0; i--) {
+			b = X[i];
+
+			// Z = Z * x^4 + T[low nibble], then the high nibble
+			rem = (int)(lo & 0xf);
+			lo = (hi << 60) | (lo >> 4);
+			hi = (hi >> 4) ^ ghash_rem_4bit[rem];
+			hi ^= T[b & 0xf][0];
+			lo ^= T[b & 0xf][1];
+
+			rem = (int)(lo & 0xf);
+			lo = (hi << 60) | (lo >> 4);
+			hi = (hi >> 4) ^ ghash_rem_4bit[rem];
+			hi ^= T[b >> 4][0];
+			lo ^= T[b >> 4][1];
 		}
-		gf128_add(X, X, C);
-		gf128_mul(X, X, H);
+
+		PUTU64(X, hi);
+		PUTU64(X + 8, lo);
+		in += 16;
+	}
+}
+#endif
+
+static void ghash_blocks(GHASH_CTX *ctx, const uint8_t *in, size_t nblocks)
+{
+#ifdef ENABLE_GMUL_ARM64
+	gf128_t C;
+#endif
+
+	if (ctx->clmul && nblocks) {
+		uint8_t X[16];
+		gf128_to_bytes(ctx->X, X);
+#if defined(ENABLE_GHASH_PCLMUL)
+		ghash_pclmul_update_blocks(ctx->H_table, X, in, nblocks);
+#elif defined(ENABLE_GHASH_PMULL)
+		ghash_pmull_update_blocks(ctx->H_table, X, in, nblocks);
+#endif
+		gf128_from_bytes(ctx->X, X);
+		gmssl_secure_clear(X, sizeof(X));
+		return;
+	}
+#ifdef ENABLE_GHASH_WASM
+	if (ctx->table8 && nblocks) {
+		uint8_t X[16];
+		gf128_to_bytes(ctx->X, X);
+		ghash_wasm_update_blocks((const uint8_t (*)[16])ctx->H_table8, X, in, nblocks);
+		gf128_from_bytes(ctx->X, X);
+		gmssl_secure_clear(X, sizeof(X));
+		return;
 	}
+#endif
 
-	gf128_add(X, X, L);
-	gf128_mul(H, X, H); // clear secrets in H
-	gf128_to_bytes(H, out);
+#ifdef ENABLE_GMUL_ARM64
+	while (nblocks--) {
+		gf128_from_bytes(C, in);
+		gf128_add(ctx->X, ctx->X, C);
+		gf128_mul(ctx->X, ctx->X, ctx->H);
+		in += 16;
+	}
+#else
+	if (nblocks) {
+		uint8_t X[16];
+		gf128_to_bytes(ctx->X, X);
+		ghash_4bit_update_blocks(ctx->H_table4, X, in, nblocks);
+		gf128_from_bytes(ctx->X, X);
+		gmssl_secure_clear(X, sizeof(X));
+	}
+#endif
 }
 
 void ghash_init(GHASH_CTX *ctx, const uint8_t h[16], const uint8_t *aad, size_t aadlen)
 {
-	gf128_t A;
-
 	memset(ctx, 0, sizeof(*ctx));
 	gf128_from_bytes(ctx->H, h);
 	gf128_set_zero(ctx->X);
 	ctx->aadlen = aadlen;
 	ctx->clen = 0;
 
-	while (aadlen) {
-		if (aadlen >= 16) {
-			gf128_from_bytes(A, aad);
-			aad += 16;
-			aadlen -= 16;
-		} else {
-			memset(ctx->block, 0, 16);
-			memcpy(ctx->block, aad, aadlen);
-			gf128_from_bytes(A, ctx->block);
-			aadlen = 0;
-		}
-		gf128_add(ctx->X, ctx->X, A);
-		gf128_mul(ctx->X, ctx->X, ctx->H);
+#if defined(ENABLE_GHASH_PCLMUL)
+	if ((gmssl_cpu_features() & (GMSSL_CPU_PCLMUL|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_PCLMUL|GMSSL_CPU_SSSE3)) {
+		ghash_pclmul_init_table(ctx->H_table, h);
+		ctx->clmul = 1;
+	}
+#elif defined(ENABLE_GHASH_PMULL)
+	if (gmssl_cpu_features() & GMSSL_CPU_ARM_PMULL) {
+		ghash_pmull_init_table(ctx->H_table, h);
+		ctx->clmul = 1;
+	}
+#endif
+#ifdef ENABLE_GHASH_WASM
+	if (gmssl_cpu_features() & GMSSL_CPU_WASM_SIMD128) {
+		ghash_wasm_init_table(ctx->H_table8, h);
+		ctx->table8 = 1;
+	}
+#endif
+#ifndef ENABLE_GMUL_ARM64
+	// the portable table only if no faster path is taken
+#ifdef ENABLE_GHASH_WASM
+	if (!ctx->clmul && !ctx->table8)
+#else
+	if (!ctx->clmul)
+#endif
+		ghash_4bit_init_table(ctx->H_table4, h);
+#endif
+
+	ghash_blocks(ctx, aad, aadlen / 16);
+	aad += aadlen - aadlen % 16;
+	aadlen %= 16;
+
+	if (aadlen) {
+		memset(ctx->block, 0, 16);
+		memcpy(ctx->block, aad, aadlen);
+		ghash_blocks(ctx, ctx->block, 1);
 	}
 }
 
 void ghash_update(GHASH_CTX *ctx, const uint8_t *c, size_t clen)
 {
-	gf128_t C;
+	size_t nblocks;
 
 	assert(ctx->num < 16);
 
@@ -123,21 +228,16 @@ void ghash_update(GHASH_CTX *ctx, const uint8_t *c, size_t clen)
 			return;
 		} else {
 			memcpy(ctx->block + ctx->num, c, left);
-			gf128_from_bytes(C, ctx->block);
-			gf128_add(ctx->X, ctx->X, C);
-			gf128_mul(ctx->X, ctx->X, ctx->H);
+			ghash_blocks(ctx, ctx->block, 1);
 			c += left;
 			clen -= left;
 		}
 	}
 
-	while (clen >= 16) {
-		gf128_from_bytes(C, c);
-		gf128_add(ctx->X, ctx->X, C);
-		gf128_mul(ctx->X, ctx->X, ctx->H);
-		c += 16;
-		clen -= 16;
-	}
+	nblocks = clen / 16;
+	ghash_blocks(ctx, c, nblocks);
+	c += 16 * nblocks;
+	clen -= 16 * nblocks;
 
 	ctx->num = clen;
 	if (clen) {
@@ -147,23 +247,16 @@ void ghash_update(GHASH_CTX *ctx, const uint8_t *c, size_t clen)
 
 void ghash_finish(GHASH_CTX *ctx, uint8_t out[16])
 {
-	gf128_t C;
-	gf128_t L;
-
 	if (ctx->num) {
 		memset(ctx->block + ctx->num, 0, 16 - ctx->num);
-		gf128_from_bytes(C, ctx->block);
-		gf128_add(ctx->X, ctx->X, C);
-		gf128_mul(ctx->X, ctx->X, ctx->H);
+		ghash_blocks(ctx, ctx->block, 1);
 	}
 
 	PUTU64(ctx->block, (uint64_t)ctx->aadlen << 3);
 	PUTU64(ctx->block + 8, (uint64_t)ctx->clen << 3);
-	gf128_from_bytes(L, ctx->block);
+	ghash_blocks(ctx, ctx->block, 1);
 
-	gf128_add(ctx->X, ctx->X, L);
-	gf128_mul(ctx->H, ctx->X, ctx->H);
-	gf128_to_bytes(ctx->H, out);
+	gf128_to_bytes(ctx->X, out);
 
 	gmssl_secure_clear(ctx, sizeof(*ctx));
 }
@@ -0,0 +1,157 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+#include <gmssl/ghash.h>
+#include <immintrin.h>
+
+
+/*
+ * GHASH with PCLMULQDQ, Intel white paper "Intel Carry-Less Multiplication
+ * Instruction and its Usage for Computing the GCM Mode"
+ *
+ * Blocks are byte-reflected so the 256-bit carry-less product only needs a
+ * 1-bit left shift before the reduction. Eight blocks are aggregated:
+ *
+ *	X = (X + C_1) * H^8 + C_2 * H^7 + ... + C_8 * H
+ *
+ * the 8 products are xor-ed unreduced and reduced once.
+ */
+
+#define BSWAP_MASK _mm_set_epi8(0,1,2,3,4,5,6,7,8,9,10,11,12,13,14,15)
+
+#define CLMUL_ACC(a, b)							\
+	lo  = _mm_xor_si128(lo, _mm_clmulepi64_si128(a, b, 0x00));	\
+	hi  = _mm_xor_si128(hi, _mm_clmulepi64_si128(a, b, 0x11));	\
+	mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x01));	\
+	mid = _mm_xor_si128(mid, _mm_clmulepi64_si128(a, b, 0x10))
+
+static inline __m128i gf128_reduce(__m128i lo, __m128i mid, __m128i hi)
+{
+	__m128i T0, T1, T2, T3, T4, T5;
+
+	T0 = _mm_xor_si128(lo, _mm_slli_si128(mid, 8));
+	T3 = _mm_xor_si128(hi, _mm_srli_si128(mid, 8));
+
+	// shift the 256-bit T3:T0 left by 1
+	T4 = _mm_srli_epi32(T0, 31);
+	T0 = _mm_slli_epi32(T0, 1);
+	T5 = _mm_srli_epi32(T3, 31);
+	T3 = _mm_slli_epi32(T3, 1);
+	T2 = _mm_srli_si128(T4, 12);
+	T5 = _mm_slli_si128(T5, 4);
+	T4 = _mm_slli_si128(T4, 4);
+	T0 = _mm_or_si128(T0, T4);
+	T3 = _mm_or_si128(T3, T5);
+	T3 = _mm_or_si128(T3, T2);
+
+	// reduce modulo x^128 + x^7 + x^2 + x + 1
+	T4 = _mm_slli_epi32(T0, 31);
+	T5 = _mm_slli_epi32(T0, 30);
+	T2 = _mm_slli_epi32(T0, 25);
+	T4 = _mm_xor_si128(T4, T5);
+	T4 = _mm_xor_si128(T4, T2);
+	T5 = _mm_srli_si128(T4, 4);
+	T3 = _mm_xor_si128(T3, T5);
+	T4 = _mm_slli_si128(T4, 12);
+	T0 = _mm_xor_si128(T0, T4);
+	T3 = _mm_xor_si128(T3, T0);
+
+	T4 = _mm_srli_epi32(T0, 1);
+	T1 = _mm_srli_epi32(T0, 2);
+	T2 = _mm_srli_epi32(T0, 7);
+	T3 = _mm_xor_si128(T3, T1);
+	T3 = _mm_xor_si128(T3, T2);
+	T3 = _mm_xor_si128(T3, T4);
+
+	return T3;
+}
+
+static inline __m128i gf128_mul_reflected(__m128i a, __m128i b)
+{
+	__m128i lo = _mm_setzero_si128();
+	__m128i mid = _mm_setzero_si128();
+	__m128i hi = _mm_setzero_si128();
+
+	CLMUL_ACC(a, b);
+	return gf128_reduce(lo, mid, hi);
+}
+
+void ghash_pclmul_init_table(uint64_t H_table[GHASH_TABLE_SIZE][2], const uint8_t h[16])
+{
+	__m128i H, Hi;
+	int i;
+
+	H = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)h), BSWAP_MASK);
+	Hi = H;
+	_mm_storeu_si128((__m128i *)H_table[0], Hi);
+	for (i = 1; i < GHASH_TABLE_SIZE; i++) {
+		Hi = gf128_mul_reflected(Hi, H);
+		_mm_storeu_si128((__m128i *)H_table[i], Hi);
+	}
+}
+
+void ghash_pclmul_update_blocks(const uint64_t H_table[GHASH_TABLE_SIZE][2],
+	uint8_t X[16], const uint8_t *in, size_t nblocks)
+{
+	const __m128i mask = BSWAP_MASK;
+	const __m128i H1 = _mm_loadu_si128((const __m128i *)H_table[0]);
+	__m128i x;
+
+	x = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)X), mask);
+
+	if (nblocks >= 8) {
+		const __m128i H2 = _mm_loadu_si128((const __m128i *)H_table[1]);
+		const __m128i H3 = _mm_loadu_si128((const __m128i *)H_table[2]);
+		const __m128i H4 = _mm_loadu_si128((const __m128i *)H_table[3]);
+		const __m128i H5 = _mm_loadu_si128((const __m128i *)H_table[4]);
+		const __m128i H6 = _mm_loadu_si128((const __m128i *)H_table[5]);
+		const __m128i H7 = _mm_loadu_si128((const __m128i *)H_table[6]);
+		const __m128i H8 = _mm_loadu_si128((const __m128i *)H_table[7]);
+
+		while (nblocks >= 8) {
+			__m128i lo = _mm_setzero_si128();
+			__m128i mid = _mm_setzero_si128();
+			__m128i hi = _mm_setzero_si128();
+			__m128i c;
+
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in      )), mask);
+			c = _mm_xor_si128(c, x);
+			CLMUL_ACC(c, H8);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  16)), mask);
+			CLMUL_ACC(c, H7);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  32)), mask);
+			CLMUL_ACC(c, H6);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  48)), mask);
+			CLMUL_ACC(c, H5);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  64)), mask);
+			CLMUL_ACC(c, H4);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  80)), mask);
+			CLMUL_ACC(c, H3);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in +  96)), mask);
+			CLMUL_ACC(c, H2);
+			c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(in + 112)), mask);
+			CLMUL_ACC(c, H1);
+
+			x = gf128_reduce(lo, mid, hi);
+			in += 128;
+			nblocks -= 8;
+		}
+	}
+
+	while (nblocks--) {
+		__m128i c = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)in), mask);
+		x = gf128_mul_reflected(_mm_xor_si128(x, c), H1);
+		in += 16;
+	}
+
+	_mm_storeu_si128((__m128i *)X, _mm_shuffle_epi8(x, mask));
+}
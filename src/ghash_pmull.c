@@ -0,0 +1,163 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+#include <gmssl/ghash.h>
+#include <arm_neon.h>
+
+
+/*
+ * GHASH with ARMv8 PMULL, the same byte-reflected algorithm and 8-block
+ * aggregation as ghash_pclmul.c, PMULL/PMULL2 replace PCLMULQDQ.
+ */
+
+#define U32(x)		vreinterpretq_u32_u8(x)
+#define U8(x)		vreinterpretq_u8_u32(x)
+#define SHL32(x, n)	U8(vshlq_n_u32(U32(x), n))
+#define SHR32(x, n)	U8(vshrq_n_u32(U32(x), n))
+#define SHL128(x, n)	vextq_u8(zero, (x), 16 - (n)) // _mm_slli_si128
+#define SHR128(x, n)	vextq_u8((x), zero, (n)) // _mm_srli_si128
+
+static inline uint8x16_t bswap128(uint8x16_t x)
+{
+	x = vrev64q_u8(x);
+	return vextq_u8(x, x, 8);
+}
+
+static inline uint8x16_t pmull_lo(uint8x16_t a, uint8x16_t b)
+{
+	return vreinterpretq_u8_p128(vmull_p64(
+		(poly64_t)vgetq_lane_u64(vreinterpretq_u64_u8(a), 0),
+		(poly64_t)vgetq_lane_u64(vreinterpretq_u64_u8(b), 0)));
+}
+
+static inline uint8x16_t pmull_hi(uint8x16_t a, uint8x16_t b)
+{
+	return vreinterpretq_u8_p128(vmull_high_p64(
+		vreinterpretq_p64_u8(a), vreinterpretq_p64_u8(b)));
+}
+
+static inline uint8x16_t pmull_mid(uint8x16_t a, uint8x16_t b)
+{
+	// a.hi * b.lo + a.lo * b.hi
+	return veorq_u8(pmull_lo(vextq_u8(a, a, 8), b), pmull_lo(a, vextq_u8(b, b, 8)));
+}
+
+#define PMULL_ACC(a, b)				\
+	lo  = veorq_u8(lo, pmull_lo(a, b));	\
+	hi  = veorq_u8(hi, pmull_hi(a, b));	\
+	mid = veorq_u8(mid, pmull_mid(a, b))
+
+static inline uint8x16_t gf128_reduce(uint8x16_t lo, uint8x16_t mid, uint8x16_t hi)
+{
+	const uint8x16_t zero = vdupq_n_u8(0);
+	uint8x16_t T0, T1, T2, T3, T4, T5;
+
+	T0 = veorq_u8(lo, SHL128(mid, 8));
+	T3 = veorq_u8(hi, SHR128(mid, 8));
+
+	// shift the 256-bit T3:T0 left by 1
+	T4 = SHR32(T0, 31);
+	T0 = SHL32(T0, 1);
+	T5 = SHR32(T3, 31);
+	T3 = SHL32(T3, 1);
+	T2 = SHR128(T4, 12);
+	T5 = SHL128(T5, 4);
+	T4 = SHL128(T4, 4);
+	T0 = vorrq_u8(T0, T4);
+	T3 = vorrq_u8(T3, T5);
+	T3 = vorrq_u8(T3, T2);
+
+	// reduce modulo x^128 + x^7 + x^2 + x + 1
+	T4 = SHL32(T0, 31);
+	T5 = SHL32(T0, 30);
+	T2 = SHL32(T0, 25);
+	T4 = veorq_u8(T4, T5);
+	T4 = veorq_u8(T4, T2);
+	T5 = SHR128(T4, 4);
+	T3 = veorq_u8(T3, T5);
+	T4 = SHL128(T4, 12);
+	T0 = veorq_u8(T0, T4);
+	T3 = veorq_u8(T3, T0);
+
+	T4 = SHR32(T0, 1);
+	T1 = SHR32(T0, 2);
+	T2 = SHR32(T0, 7);
+	T3 = veorq_u8(T3, T1);
+	T3 = veorq_u8(T3, T2);
+	T3 = veorq_u8(T3, T4);
+
+	return T3;
+}
+
+static inline uint8x16_t gf128_mul_reflected(uint8x16_t a, uint8x16_t b)
+{
+	uint8x16_t lo = vdupq_n_u8(0);
+	uint8x16_t mid = vdupq_n_u8(0);
+	uint8x16_t hi = vdupq_n_u8(0);
+
+	PMULL_ACC(a, b);
+	return gf128_reduce(lo, mid, hi);
+}
+
+void ghash_pmull_init_table(uint64_t H_table[GHASH_TABLE_SIZE][2], const uint8_t h[16])
+{
+	uint8x16_t H, Hi;
+	int i;
+
+	H = bswap128(vld1q_u8(h));
+	Hi = H;
+	vst1q_u8((uint8_t *)H_table[0], Hi);
+	for (i = 1; i < GHASH_TABLE_SIZE; i++) {
+		Hi = gf128_mul_reflected(Hi, H);
+		vst1q_u8((uint8_t *)H_table[i], Hi);
+	}
+}
+
+void ghash_pmull_update_blocks(const uint64_t H_table[GHASH_TABLE_SIZE][2],
+	uint8_t X[16], const uint8_t *in, size_t nblocks)
+{
+	uint8x16_t H[GHASH_TABLE_SIZE];
+	uint8x16_t x;
+	int i;
+
+	for (i = 0; i < GHASH_TABLE_SIZE; i++) {
+		H[i] = vld1q_u8((const uint8_t *)H_table[i]);
+	}
+
+	x = bswap128(vld1q_u8(X));
+
+	while (nblocks >= 8) {
+		uint8x16_t lo = vdupq_n_u8(0);
+		uint8x16_t mid = vdupq_n_u8(0);
+		uint8x16_t hi = vdupq_n_u8(0);
+		uint8x16_t c;
+
+		c = veorq_u8(bswap128(vld1q_u8(in)), x);
+		PMULL_ACC(c, H[7]);
+		for (i = 1; i < 8; i++) {
+			c = bswap128(vld1q_u8(in + 16 * i));
+			PMULL_ACC(c, H[7 - i]);
+		}
+
+		x = gf128_reduce(lo, mid, hi);
+		in += 128;
+		nblocks -= 8;
+	}
+
+	while (nblocks--) {
+		uint8x16_t c = bswap128(vld1q_u8(in));
+		x = gf128_mul_reflected(veorq_u8(x, c), H[0]);
+		in += 16;
+	}
+
+	vst1q_u8(X, bswap128(x));
+}
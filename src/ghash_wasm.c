@@ -0,0 +1,109 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * GHASH in WebAssembly SIMD128, without a carry-less multiply
+ *
+ * 8-bit Shoup table in the GCM byte order, T[b] = H * b, the bit 0x80 of b is
+ * x^0. X * H is computed byte by byte from the last one, Z = Z * x^8 + T[X_i]:
+ * the multiply by x^8 is a byte shift of the vector and the byte shifted out
+ * is reduced with ghash_wasm_rem_8bit. Half the steps and a quarter of the
+ * table arithmetic of the 4-bit table of ghash.c. The table lookups are
+ * indexed by the data, as in the other table based GHASH.
+ */
+
+#include <string.h>
+#include <wasm_simd128.h>
+#include <gmssl/mem.h>
+#include <gmssl/ghash.h>
+#include <gmssl/endian.h>
+
+
+// b * x^128 mod (x^128 + x^7 + x^2 + x + 1), the 2 bytes in the order of a u16x8 lane
+static const uint16_t ghash_wasm_rem_8bit[256] = {
+	0x0000, 0xC201, 0x8403, 0x4602, 0x0807, 0xCA06, 0x8C04, 0x4E05,
+	0x100E, 0xD20F, 0x940D, 0x560C, 0x1809, 0xDA08, 0x9C0A, 0x5E0B,
+	0x201C, 0xE21D, 0xA41F, 0x661E, 0x281B, 0xEA1A, 0xAC18, 0x6E19,
+	0x3012, 0xF213, 0xB411, 0x7610, 0x3815, 0xFA14, 0xBC16, 0x7E17,
+	0x4038, 0x8239, 0xC43B, 0x063A, 0x483F, 0x8A3E, 0xCC3C, 0x0E3D,
+	0x5036, 0x9237, 0xD435, 0x1634, 0x5831, 0x9A30, 0xDC32, 0x1E33,
+	0x6024, 0xA225, 0xE427, 0x2626, 0x6823, 0xAA22, 0xEC20, 0x2E21,
+	0x702A, 0xB22B, 0xF429, 0x3628, 0x782D, 0xBA2C, 0xFC2E, 0x3E2F,
+	0x8070, 0x4271, 0x0473, 0xC672, 0x8877, 0x4A76, 0x0C74, 0xCE75,
+	0x907E, 0x527F, 0x147D, 0xD67C, 0x9879, 0x5A78, 0x1C7A, 0xDE7B,
+	0xA06C, 0x626D, 0x246F, 0xE66E, 0xA86B, 0x6A6A, 0x2C68, 0xEE69,
+	0xB062, 0x7263, 0x3461, 0xF660, 0xB865, 0x7A64, 0x3C66, 0xFE67,
+	0xC048, 0x0249, 0x444B, 0x864A, 0xC84F, 0x0A4E, 0x4C4C, 0x8E4D,
+	0xD046, 0x1247, 0x5445, 0x9644, 0xD841, 0x1A40, 0x5C42, 0x9E43,
+	0xE054, 0x2255, 0x6457, 0xA656, 0xE853, 0x2A52, 0x6C50, 0xAE51,
+	0xF05A, 0x325B, 0x7459, 0xB658, 0xF85D, 0x3A5C, 0x7C5E, 0xBE5F,
+	0x00E1, 0xC2E0, 0x84E2, 0x46E3, 0x08E6, 0xCAE7, 0x8CE5, 0x4EE4,
+	0x10EF, 0xD2EE, 0x94EC, 0x56ED, 0x18E8, 0xDAE9, 0x9CEB, 0x5EEA,
+	0x20FD, 0xE2FC, 0xA4FE, 0x66FF, 0x28FA, 0xEAFB, 0xACF9, 0x6EF8,
+	0x30F3, 0xF2F2, 0xB4F0, 0x76F1, 0x38F4, 0xFAF5, 0xBCF7, 0x7EF6,
+	0x40D9, 0x82D8, 0xC4DA, 0x06DB, 0x48DE, 0x8ADF, 0xCCDD, 0x0EDC,
+	0x50D7, 0x92D6, 0xD4D4, 0x16D5, 0x58D0, 0x9AD1, 0xDCD3, 0x1ED2,
+	0x60C5, 0xA2C4, 0xE4C6, 0x26C7, 0x68C2, 0xAAC3, 0xECC1, 0x2EC0,
+	0x70CB, 0xB2CA, 0xF4C8, 0x36C9, 0x78CC, 0xBACD, 0xFCCF, 0x3ECE,
+	0x8091, 0x4290, 0x0492, 0xC693, 0x8896, 0x4A97, 0x0C95, 0xCE94,
+	0x909F, 0x529E, 0x149C, 0xD69D, 0x9898, 0x5A99, 0x1C9B, 0xDE9A,
+	0xA08D, 0x628C, 0x248E, 0xE68F, 0xA88A, 0x6A8B, 0x2C89, 0xEE88,
+	0xB083, 0x7282, 0x3480, 0xF681, 0xB884, 0x7A85, 0x3C87, 0xFE86,
+	0xC0A9, 0x02A8, 0x44AA, 0x86AB, 0xC8AE, 0x0AAF, 0x4CAD, 0x8EAC,
+	0xD0A7, 0x12A6, 0x54A4, 0x96A5, 0xD8A0, 0x1AA1, 0x5CA3, 0x9EA2,
+	0xE0B5, 0x22B4, 0x64B6, 0xA6B7, 0xE8B2, 0x2AB3, 0x6CB1, 0xAEB0,
+	0xF0BB, 0x32BA, 0x74B8, 0xB6B9, 0xF8BC, 0x3ABD, 0x7CBF, 0xBEBE,
+};
+
+void ghash_wasm_init_table(uint8_t T[256][16], const uint8_t h[16])
+{
+	uint64_t hi = GETU64(h);
+	uint64_t lo = GETU64(h + 8);
+	uint64_t t;
+	int i, j;
+
+	memset(T[0], 0, 16);
+	// T[0x80] = H, T[0x40] = H * x, ..., T[0x01] = H * x^7
+	for (i = 0x80; i > 0; i >>= 1) {
+		PUTU64(T[i], hi);
+		PUTU64(T[i] + 8, lo);
+		t = (uint64_t)0xe100000000000000 & (0 - (lo & 1));
+		lo = (hi << 63) | (lo >> 1);
+		hi = (hi >> 1) ^ t;
+	}
+	for (i = 2; i < 256; i <<= 1) {
+		for (j = 1; j < i; j++) {
+			wasm_v128_store(T[i + j], wasm_v128_xor(wasm_v128_load(T[i]), wasm_v128_load(T[j])));
+		}
+	}
+}
+
+void ghash_wasm_update_blocks(const uint8_t T[256][16], uint8_t X[16], const uint8_t *in, size_t nblocks)
+{
+	const v128_t zero = wasm_i64x2_splat(0);
+	uint8_t x[16];
+	v128_t Z = wasm_v128_load(X);
+	int i;
+
+	while (nblocks--) {
+		wasm_v128_store(x, wasm_v128_xor(Z, wasm_v128_load(in)));
+
+		Z = wasm_v128_load(T[x[15]]);
+		for (i = 14; i >= 0; i--) {
+			uint16_t rem = ghash_wasm_rem_8bit[wasm_u8x16_extract_lane(Z, 15)];
+			Z = wasm_i8x16_shuffle(Z, zero, 16, 0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14);
+			Z = wasm_v128_xor(Z, wasm_u16x8_make(rem, 0, 0, 0, 0, 0, 0, 0));
+			Z = wasm_v128_xor(Z, wasm_v128_load(T[x[i]]));
+		}
+		in += 16;
+	}
+
+	wasm_v128_store(X, Z);
+	gmssl_secure_clear(x, sizeof(x));
+}
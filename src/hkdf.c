@@ -104,7 +104,7 @@ int hkdf_expand(const DIGEST *digest, const uint8_t *prk, size_t prklen,
 			error_print();
 			return -1;
 		}
-		if (hmac_init(&hmac_ctx, digest, prk, prklen) != 1
+		if (hmac_reset(&hmac_ctx) != 1
 			|| hmac_update(&hmac_ctx, T, len) != 1
 			|| hmac_update(&hmac_ctx, opt_info, opt_infolen) < 0
 			|| hmac_update(&hmac_ctx, &counter, 1) != 1
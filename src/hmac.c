@@ -57,6 +57,17 @@ int hmac_init(HMAC_CTX *ctx, const DIGEST *digest, const uint8_t *key, size_t ke
 	return 1;
 }
 
+// start a new MAC with the key of `ctx`, the keyed states are not hashed again
+int hmac_reset(HMAC_CTX *ctx)
+{
+	if (!ctx || !ctx->digest) {
+		error_print();
+		return -1;
+	}
+	memcpy(&ctx->digest_ctx, &ctx->i_ctx, sizeof(DIGEST_CTX));
+	return 1;
+}
+
 int hmac_update(HMAC_CTX *ctx, const uint8_t *data, size_t datalen)
 {
 	if (ctx == NULL) {
@@ -0,0 +1,743 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <limits.h>
+#include <time.h>
+#include <gmssl/socket.h>
+#include <gmssl/http.h>
+#include <gmssl/error.h>
+
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION http_mutex_t;
+#define http_mutex_init(m)	InitializeCriticalSection(m)
+#define http_mutex_destroy(m)	DeleteCriticalSection(m)
+#define http_mutex_lock(m)	EnterCriticalSection(m)
+#define http_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+#include <sys/time.h>
+typedef pthread_mutex_t http_mutex_t;
+#define http_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define http_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define http_mutex_lock(m)	pthread_mutex_lock(m)
+#define http_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+#define HTTP_MAX_HEADER_SIZE	8192
+#define HTTP_MAX_LINE_SIZE	256
+
+#define HTTP_GET_TEMPLATE "GET %s HTTP/1.1\r\n" "Host: %s\r\n"
+
+
+// header names are case-insensitive, return the trimmed value of the header `name` or NULL
+static const char *http_header_value(const char *header, const char *name, size_t *valuelen)
+{
+	size_t namelen = strlen(name);
+	const char *p = header;
+	const char *end;
+	size_t i;
+
+	while ((p = strstr(p, "\r\n")) != NULL) {
+		p += 2;
+		for (i = 0; i < namelen; i++) {
+			char c = p[i];
+			if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+			if (c != name[i]) break;
+		}
+		if (i < namelen || p[namelen] != ':') {
+			continue;
+		}
+		p += namelen + 1;
+		while (*p == ' ' || *p == '\t') p++;
+		if (!(end = strstr(p, "\r\n"))) {
+			end = p + strlen(p);
+		}
+		while (end > p && (end[-1] == ' ' || end[-1] == '\t')) end--;
+		*valuelen = end - p;
+		return p;
+	}
+	return NULL;
+}
+
+static int http_header_copy(const char *header, const char *name, char *buf, size_t buflen)
+{
+	const char *value;
+	size_t len;
+
+	buf[0] = 0;
+	if (!(value = http_header_value(header, name, &len))) {
+		return 0;
+	}
+	if (len >= buflen) {
+		// a validator not fitting is not sent back, the next GET is not conditional
+		return 0;
+	}
+	memcpy(buf, value, len);
+	buf[len] = 0;
+	return 1;
+}
+
+
+// `timeout` in seconds bounds the connect (on Linux), each send and each recv
+static int http_socket_set_timeout(tls_socket_t sock, int timeout)
+{
+#ifdef _WIN32
+	DWORD tv = (DWORD)timeout * 1000;
+#else
+	struct timeval tv;
+	tv.tv_sec = timeout;
+	tv.tv_usec = 0;
+#endif
+	if (setsockopt(sock, SOL_SOCKET, SO_RCVTIMEO, (const char *)&tv, sizeof(tv)) != 0
+		|| setsockopt(sock, SOL_SOCKET, SO_SNDTIMEO, (const char *)&tv, sizeof(tv)) != 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int http_connect(const char *host, int port, int timeout, tls_socket_t *sock)
+{
+	struct hostent *hp;
+	struct sockaddr_in server;
+
+	if (!(hp = gethostbyname(host))) {
+		error_print();
+		return -1;
+	}
+	memset(&server, 0, sizeof(server));
+	server.sin_addr = *((struct in_addr *)hp->h_addr_list[0]);
+	server.sin_family = AF_INET;
+	server.sin_port = htons(port);
+
+	if (tls_socket_create(sock, AF_INET, SOCK_STREAM, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (http_socket_set_timeout(*sock, timeout) != 1
+		|| tls_socket_connect(*sock, &server) != 1) {
+		error_print();
+		tls_socket_close(*sock);
+		return -1;
+	}
+	return 1;
+}
+
+
+typedef struct {
+	char host[128];
+	int port;
+	tls_socket_t sock;
+	time_t idle_since;
+} HTTP_CONN;
+
+// idle connections, the most recently used last
+struct HTTP_CLIENT_st {
+	http_mutex_t mutex;
+	int timeout;
+	HTTP_CONN idle[HTTP_CLIENT_MAX_IDLE_CONNS];
+	size_t idle_cnt;
+	size_t connects;
+};
+
+HTTP_CLIENT *http_client_new(int timeout)
+{
+	HTTP_CLIENT *client;
+
+	if (timeout <= 0) {
+		error_print();
+		return NULL;
+	}
+	if (tls_socket_lib_init() != 1) {
+		error_print();
+		return NULL;
+	}
+	if (!(client = (HTTP_CLIENT *)calloc(1, sizeof(*client)))) {
+		tls_socket_lib_cleanup();
+		error_print();
+		return NULL;
+	}
+	client->timeout = timeout;
+	http_mutex_init(&client->mutex);
+	return client;
+}
+
+void http_client_free(HTTP_CLIENT *client)
+{
+	size_t i;
+
+	if (!client) {
+		return;
+	}
+	for (i = 0; i < client->idle_cnt; i++) {
+		tls_socket_close(client->idle[i].sock);
+	}
+	http_mutex_destroy(&client->mutex);
+	free(client);
+	tls_socket_lib_cleanup();
+}
+
+size_t http_client_idle_count(HTTP_CLIENT *client)
+{
+	size_t cnt;
+
+	http_mutex_lock(&client->mutex);
+	cnt = client->idle_cnt;
+	http_mutex_unlock(&client->mutex);
+	return cnt;
+}
+
+size_t http_client_connect_count(HTTP_CLIENT *client)
+{
+	size_t cnt;
+
+	http_mutex_lock(&client->mutex);
+	cnt = client->connects;
+	http_mutex_unlock(&client->mutex);
+	return cnt;
+}
+
+// with the lock held
+static void http_client_remove_idle(HTTP_CLIENT *client, size_t i)
+{
+	memmove(&client->idle[i], &client->idle[i + 1], sizeof(HTTP_CONN) * (client->idle_cnt - i - 1));
+	client->idle_cnt--;
+}
+
+// return 1 with a pooled connection, 0 if there is none
+static int http_client_take(HTTP_CLIENT *client, const char *host, int port, tls_socket_t *sock)
+{
+	time_t now = time(NULL);
+	size_t i;
+	int ret = 0;
+
+	http_mutex_lock(&client->mutex);
+	i = client->idle_cnt;
+	while (i--) {
+		HTTP_CONN *conn = &client->idle[i];
+
+		if (now - conn->idle_since >= HTTP_CLIENT_IDLE_SECONDS || now < conn->idle_since) {
+			tls_socket_close(conn->sock);
+			http_client_remove_idle(client, i);
+			continue;
+		}
+		if (!ret && conn->port == port && strcmp(conn->host, host) == 0) {
+			*sock = conn->sock;
+			http_client_remove_idle(client, i);
+			ret = 1;
+		}
+	}
+	http_mutex_unlock(&client->mutex);
+	return ret;
+}
+
+// return -1 if the host does not fit, the caller closes the socket
+static int http_client_put(HTTP_CLIENT *client, const char *host, int port, tls_socket_t sock)
+{
+	HTTP_CONN *conn;
+	size_t hostlen = strlen(host);
+
+	if (hostlen >= sizeof(conn->host)) {
+		error_print();
+		return -1;
+	}
+
+	http_mutex_lock(&client->mutex);
+	if (client->idle_cnt == HTTP_CLIENT_MAX_IDLE_CONNS) {
+		tls_socket_close(client->idle[0].sock);
+		http_client_remove_idle(client, 0);
+	}
+	conn = &client->idle[client->idle_cnt++];
+	memcpy(conn->host, host, hostlen + 1);
+	conn->port = port;
+	conn->sock = sock;
+	conn->idle_since = time(NULL);
+	http_mutex_unlock(&client->mutex);
+	return 1;
+}
+
+
+typedef struct {
+	tls_socket_t sock;
+	uint8_t buf[4096];
+	size_t pos;
+	size_t len;
+} HTTP_READER;
+
+// return 1, or 0 on end of stream
+static int http_reader_fill(HTTP_READER *r)
+{
+	tls_ret_t n;
+
+	if ((n = tls_socket_recv(r->sock, r->buf, sizeof(r->buf), 0)) < 0) {
+		error_print();
+		return -1;
+	}
+	r->pos = 0;
+	r->len = (size_t)n;
+	return n ? 1 : 0;
+}
+
+// a line without "\r\n", for the chunk sizes and trailers
+static int http_reader_read_line(HTTP_READER *r, char *line, size_t maxlen)
+{
+	size_t len = 0;
+
+	for (;;) {
+		char c;
+
+		if (r->pos == r->len && http_reader_fill(r) != 1) {
+			error_print();
+			return -1;
+		}
+		c = (char)r->buf[r->pos++];
+		if (c == '\n') {
+			break;
+		}
+		if (len + 1 >= maxlen) {
+			error_print();
+			return -1;
+		}
+		line[len++] = c;
+	}
+	if (len && line[len - 1] == '\r') {
+		len--;
+	}
+	line[len] = 0;
+	return 1;
+}
+
+// pass the next `len` bytes to the callback
+static int http_reader_read_body(HTTP_READER *r, size_t len, size_t content_length,
+	HTTP_BODY_CALLBACK body_cb, void *cb_arg)
+{
+	while (len) {
+		size_t n;
+
+		if (r->pos == r->len && http_reader_fill(r) != 1) {
+			error_print();
+			return -1;
+		}
+		n = r->len - r->pos;
+		if (n > len) {
+			n = len;
+		}
+		if (body_cb(cb_arg, content_length, r->buf + r->pos, n) != 1) {
+			error_print();
+			return -1;
+		}
+		r->pos += n;
+		len -= n;
+	}
+	return 1;
+}
+
+static int http_reader_read_chunked(HTTP_READER *r, HTTP_BODY_CALLBACK body_cb, void *cb_arg)
+{
+	char line[HTTP_MAX_LINE_SIZE];
+	unsigned long chunk_len;
+	char *end;
+
+	for (;;) {
+		if (http_reader_read_line(r, line, sizeof(line)) != 1) {
+			error_print();
+			return -1;
+		}
+		// chunk extensions after ';' are ignored
+		chunk_len = strtoul(line, &end, 16);
+		if (end == line || (*end && *end != ';' && *end != ' ')
+			|| chunk_len > HTTP_MAX_CONTENT_SIZE) {
+			error_print();
+			return -1;
+		}
+		if (!chunk_len) {
+			break;
+		}
+		if (http_reader_read_body(r, chunk_len, HTTP_LENGTH_UNKNOWN, body_cb, cb_arg) != 1
+			|| http_reader_read_line(r, line, sizeof(line)) != 1
+			|| line[0]) {
+			error_print();
+			return -1;
+		}
+	}
+	// trailer fields end with an empty line
+	do {
+		if (http_reader_read_line(r, line, sizeof(line)) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (line[0]);
+	return 1;
+}
+
+static int http_reader_read_to_close(HTTP_READER *r, HTTP_BODY_CALLBACK body_cb, void *cb_arg)
+{
+	int ret;
+
+	for (;;) {
+		if (r->pos < r->len) {
+			if (body_cb(cb_arg, HTTP_LENGTH_UNKNOWN, r->buf + r->pos, r->len - r->pos) != 1) {
+				error_print();
+				return -1;
+			}
+			r->pos = r->len;
+		}
+		if ((ret = http_reader_fill(r)) != 1) {
+			if (ret < 0) error_print();
+			return ret < 0 ? -1 : 1;
+		}
+	}
+}
+
+// return 1 with the header, 0 if the connection is closed before the first byte
+static int http_reader_read_header(HTTP_READER *r, char *header, size_t maxlen)
+{
+	size_t len = 0;
+	int ret;
+
+	for (;;) {
+		if (r->pos == r->len) {
+			if ((ret = http_reader_fill(r)) != 1) {
+				if (ret == 0 && len == 0) {
+					return 0;
+				}
+				error_print();
+				return -1;
+			}
+		}
+		if (len + 1 >= maxlen) {
+			error_print();
+			return -1;
+		}
+		header[len++] = (char)r->buf[r->pos++];
+		if (len >= 4 && memcmp(header + len - 4, "\r\n\r\n", 4) == 0) {
+			break;
+		}
+	}
+	header[len - 2] = 0; // header lines end with "\r\n"
+	return 1;
+}
+
+static int http_header_has_token(const char *header, const char *name, const char *token)
+{
+	const char *value;
+	size_t len;
+	size_t toklen = strlen(token);
+	size_t i;
+
+	if (!(value = http_header_value(header, name, &len))) {
+		return 0;
+	}
+	for (i = 0; i + toklen <= len; i++) {
+		size_t j;
+		for (j = 0; j < toklen; j++) {
+			char c = value[i + j];
+			if (c >= 'A' && c <= 'Z') c += 'a' - 'A';
+			if (c != token[j]) break;
+		}
+		if (j == toklen) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+ * One request on `sock`. Return 1 on 200 OK, 0 on 304 Not Modified and -2 if
+ * the pooled connection was closed by the server before the response.
+ * `keep_alive` is set if the connection can serve the next request.
+ */
+static int http_client_request(tls_socket_t sock, const char *req, size_t reqlen,
+	HTTP_VALIDATORS *validators, HTTP_BODY_CALLBACK body_cb, void *cb_arg, int *keep_alive)
+{
+	HTTP_READER *r = NULL;
+	char header[HTTP_MAX_HEADER_SIZE];
+	int minor;
+	int status;
+	const char *value;
+	size_t valuelen;
+	int ret = -1;
+
+	*keep_alive = 0;
+
+	if (tls_socket_send(sock, req, reqlen, 0) != (tls_ret_t)reqlen) {
+		return -2;
+	}
+	if (!(r = (HTTP_READER *)malloc(sizeof(HTTP_READER)))) {
+		error_print();
+		return -1;
+	}
+	r->sock = sock;
+	r->pos = r->len = 0;
+
+	if ((ret = http_reader_read_header(r, header, sizeof(header))) != 1) {
+		if (ret == 0) {
+			ret = -2;
+		} else {
+			error_print();
+		}
+		goto end;
+	}
+	ret = -1;
+	if (sscanf(header, "HTTP/1.%d %d", &minor, &status) != 2) {
+		error_print();
+		goto end;
+	}
+
+	if (status == 304) {
+		*keep_alive = minor >= 1 ? !http_header_has_token(header, "connection", "close")
+			: http_header_has_token(header, "connection", "keep-alive");
+		ret = 0;
+		goto end;
+	}
+	if (status != 200) {
+		error_print_msg("HTTP status %d\n", status);
+		goto end;
+	}
+
+	if (http_header_has_token(header, "transfer-encoding", "chunked")) {
+		if (http_reader_read_chunked(r, body_cb, cb_arg) != 1) {
+			error_print();
+			goto end;
+		}
+	} else if ((value = http_header_value(header, "content-length", &valuelen)) != NULL) {
+		char *end;
+		unsigned long len = strtoul(value, &end, 10);
+		if (end == value || len > HTTP_MAX_CONTENT_SIZE) {
+			error_print();
+			goto end;
+		}
+		if (http_reader_read_body(r, len, len, body_cb, cb_arg) != 1) {
+			error_print();
+			goto end;
+		}
+	} else {
+		// the body ends with the connection
+		if (http_reader_read_to_close(r, body_cb, cb_arg) != 1) {
+			error_print();
+			goto end;
+		}
+		goto done;
+	}
+	*keep_alive = minor >= 1 ? !http_header_has_token(header, "connection", "close")
+		: http_header_has_token(header, "connection", "keep-alive");
+	// bytes after the response, e.g. a pipelined answer we did not ask for
+	if (r->pos != r->len) {
+		*keep_alive = 0;
+	}
+done:
+	if (validators) {
+		http_header_copy(header, "etag", validators->etag, sizeof(validators->etag));
+		http_header_copy(header, "last-modified", validators->last_modified, sizeof(validators->last_modified));
+	}
+	ret = 1;
+end:
+	free(r);
+	return ret;
+}
+
+int http_client_get(HTTP_CLIENT *client, const char *uri, HTTP_VALIDATORS *validators,
+	HTTP_BODY_CALLBACK body_cb, void *cb_arg)
+{
+	char host[128];
+	int port;
+	char path[256];
+	char req[sizeof(HTTP_GET_TEMPLATE) + sizeof(host) + sizeof(path) + 256];
+	size_t reqlen;
+	int timeout = client ? client->timeout : HTTP_CLIENT_DEFAULT_TIMEOUT;
+	tls_socket_t sock;
+	int reused;
+	int keep_alive;
+	int ret;
+
+	if (!uri || !body_cb) {
+		error_print();
+		return -1;
+	}
+	if (http_parse_uri(uri, host, &port, path) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((reqlen = snprintf(req, sizeof(req), HTTP_GET_TEMPLATE, path, host)) >= sizeof(req)) {
+		error_print();
+		return -1;
+	}
+	if (validators && validators->etag[0]) {
+		reqlen += snprintf(req + reqlen, sizeof(req) - reqlen, "If-None-Match: %s\r\n", validators->etag);
+	}
+	if (validators && validators->last_modified[0] && reqlen < sizeof(req)) {
+		reqlen += snprintf(req + reqlen, sizeof(req) - reqlen, "If-Modified-Since: %s\r\n", validators->last_modified);
+	}
+	if (!client && reqlen < sizeof(req)) {
+		reqlen += snprintf(req + reqlen, sizeof(req) - reqlen, "Connection: close\r\n");
+	}
+	if (reqlen + 2 >= sizeof(req)) {
+		error_print();
+		return -1;
+	}
+	memcpy(req + reqlen, "\r\n", 3);
+	reqlen += 2;
+
+	if (!client && tls_socket_lib_init() != 1) {
+		error_print();
+		return -1;
+	}
+
+	// a GET on a pooled connection the server has closed meanwhile is sent again
+	for (;;) {
+		reused = client && http_client_take(client, host, port, &sock);
+		if (!reused) {
+			if (http_connect(host, port, timeout, &sock) != 1) {
+				error_print();
+				ret = -1;
+				break;
+			}
+			if (client) {
+				http_mutex_lock(&client->mutex);
+				client->connects++;
+				http_mutex_unlock(&client->mutex);
+			}
+		}
+		ret = http_client_request(sock, req, reqlen, validators, body_cb, cb_arg, &keep_alive);
+		if (ret >= 0 && keep_alive && client
+			&& http_client_put(client, host, port, sock) == 1) {
+			break;
+		}
+		tls_socket_close(sock);
+		if (ret != -2 || !reused) {
+			break;
+		}
+	}
+	if (ret == -2) {
+		error_print();
+		ret = -1;
+	}
+
+	if (!client) {
+		tls_socket_lib_cleanup();
+	}
+	return ret;
+}
+
+
+typedef struct {
+	uint8_t *buf;
+	size_t len;
+	size_t size;
+} HTTP_BODY_BUFFER;
+
+static int http_body_buffer_append(void *arg, size_t content_length, const uint8_t *data, size_t datalen)
+{
+	HTTP_BODY_BUFFER *body = (HTTP_BODY_BUFFER *)arg;
+
+	if (datalen > HTTP_MAX_CONTENT_SIZE - body->len) {
+		error_print();
+		return -1;
+	}
+	if (body->size - body->len < datalen) {
+		uint8_t *p;
+		size_t size;
+
+		// one allocation when the length is known
+		if (content_length != HTTP_LENGTH_UNKNOWN && content_length >= body->len + datalen) {
+			size = content_length;
+		} else {
+			size = body->size ? body->size : 4096;
+			while (size - body->len < datalen) {
+				size *= 2;
+			}
+		}
+		if (!(p = (uint8_t *)realloc(body->buf, size))) {
+			error_print();
+			return -1;
+		}
+		body->buf = p;
+		body->size = size;
+	}
+	memcpy(body->buf + body->len, data, datalen);
+	body->len += datalen;
+	return 1;
+}
+
+int http_client_get_new(HTTP_CLIENT *client, const char *uri, HTTP_VALIDATORS *validators,
+	uint8_t **content, size_t *contentlen)
+{
+	HTTP_BODY_BUFFER body;
+	int ret;
+
+	if (!uri || !content || !contentlen) {
+		error_print();
+		return -1;
+	}
+	memset(&body, 0, sizeof(body));
+
+	if ((ret = http_client_get(client, uri, validators, http_body_buffer_append, &body)) != 1) {
+		if (ret < 0) error_print();
+		free(body.buf);
+		return ret;
+	}
+	if (!body.len) {
+		error_print();
+		free(body.buf);
+		return -1;
+	}
+	*content = body.buf;
+	*contentlen = body.len;
+	return 1;
+}
+
+
+static HTTP_CLIENT *http_shared_client = NULL;
+
+static void http_shared_client_init(void)
+{
+	// without the shared client every GET has its own connection
+	http_shared_client = http_client_new(HTTP_CLIENT_DEFAULT_TIMEOUT);
+}
+
+#ifdef _WIN32
+static INIT_ONCE http_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK http_shared_client_init_once(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+	http_shared_client_init();
+	return TRUE;
+}
+
+static HTTP_CLIENT *http_get_shared_client(void)
+{
+	InitOnceExecuteOnce(&http_once, http_shared_client_init_once, NULL, NULL);
+	return http_shared_client;
+}
+#else
+static pthread_once_t http_once = PTHREAD_ONCE_INIT;
+
+static HTTP_CLIENT *http_get_shared_client(void)
+{
+	pthread_once(&http_once, http_shared_client_init);
+	return http_shared_client;
+}
+#endif
+
+int http_get_new(const char *uri, HTTP_VALIDATORS *validators, uint8_t **content, size_t *contentlen)
+{
+	int ret;
+
+	if ((ret = http_client_get_new(http_get_shared_client(), uri, validators, content, contentlen)) < 0) {
+		error_print();
+	}
+	return ret;
+}
@@ -0,0 +1,572 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm9.h>
+#include <gmssl/job.h>
+#include <gmssl/mem.h>
+#include <gmssl/thread_pool.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION job_mutex_t;
+typedef CONDITION_VARIABLE job_cond_t;
+typedef HANDLE job_thread_t;
+#define job_mutex_init(m)	InitializeCriticalSection(m)
+#define job_mutex_destroy(m)	DeleteCriticalSection(m)
+#define job_mutex_lock(m)	EnterCriticalSection(m)
+#define job_mutex_unlock(m)	LeaveCriticalSection(m)
+#define job_cond_init(c)	InitializeConditionVariable(c)
+#define job_cond_destroy(c)
+#define job_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define job_cond_signal(c)	WakeConditionVariable(c)
+#define job_cond_broadcast(c)	WakeAllConditionVariable(c)
+#else
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+typedef pthread_mutex_t job_mutex_t;
+typedef pthread_cond_t job_cond_t;
+typedef pthread_t job_thread_t;
+#define job_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define job_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define job_mutex_lock(m)	pthread_mutex_lock(m)
+#define job_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define job_cond_init(c)	pthread_cond_init(c, NULL)
+#define job_cond_destroy(c)	pthread_cond_destroy(c)
+#define job_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define job_cond_signal(c)	pthread_cond_signal(c)
+#define job_cond_broadcast(c)	pthread_cond_broadcast(c)
+#endif
+
+
+// a work item of the thread pool: one job, or all the SM3 or SM2 verify jobs of a batch
+enum {
+	JOB_TASK_one,
+	JOB_TASK_sm3_batch,
+	JOB_TASK_sm2_verify_batch,
+};
+
+typedef struct {
+	GMSSL_JOB_QUEUE *queue;
+	int type;
+	GMSSL_JOB *job;
+} JOB_TASK;
+
+struct GMSSL_JOB_QUEUE_st {
+	size_t max_batch;
+	GMSSL_JOB *pending;
+	GMSSL_JOB **pending_tail;
+	GMSSL_JOB *finished;
+	GMSSL_JOB **finished_tail;
+	size_t waiting; // submitted without callback and not returned yet
+	int stop;
+	job_mutex_t mutex;
+	job_cond_t work;
+	job_cond_t done;
+	job_thread_t thread;
+	int fds[2];
+
+	// the batch being run, only used by the thread of the queue
+	GMSSL_JOB **batch;
+	JOB_TASK *tasks;
+	GMSSL_JOB **sm3_jobs;
+	const uint8_t **sm3_datas;
+	size_t *sm3_datalens;
+	uint8_t (*sm3_dgsts)[SM3_DIGEST_SIZE];
+	size_t sm3_cnt;
+	GMSSL_JOB **verify_jobs;
+	const SM2_KEY **verify_keys;
+	uint8_t (*verify_dgsts)[32];
+	SM2_SIGNATURE *verify_sigs;
+	int *verify_results;
+	size_t verify_cnt;
+};
+
+static void sm3_digest(const uint8_t *data, size_t datalen, uint8_t dgst[32])
+{
+	SM3_CTX sm3_ctx;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, data, datalen);
+	sm3_finish(&sm3_ctx, dgst);
+}
+
+// the SM4 jobs carry the raw key, the iv of the job is not updated
+static int job_run_sm4(GMSSL_JOB *job)
+{
+	SM4_KEY sm4_key;
+	uint8_t iv[16];
+
+	if (!job->key || !job->iv || (!job->in && job->inlen) || (!job->out && job->inlen)) {
+		error_print();
+		return -1;
+	}
+	if (job->op != GMSSL_JOB_sm4_ctr_encrypt && job->inlen % SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	memcpy(iv, job->iv, 16);
+	if (job->op == GMSSL_JOB_sm4_cbc_decrypt) {
+		sm4_set_decrypt_key(&sm4_key, (const uint8_t *)job->key);
+		sm4_cbc_decrypt_blocks(&sm4_key, iv, job->in, job->inlen / SM4_BLOCK_SIZE, job->out);
+	} else {
+		sm4_set_encrypt_key(&sm4_key, (const uint8_t *)job->key);
+		if (job->op == GMSSL_JOB_sm4_cbc_encrypt) {
+			sm4_cbc_encrypt_blocks(&sm4_key, iv, job->in, job->inlen / SM4_BLOCK_SIZE, job->out);
+		} else {
+			sm4_ctr_encrypt(&sm4_key, iv, job->in, job->inlen, job->out);
+		}
+	}
+	job->outlen = job->inlen;
+	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+	return 1;
+}
+
+static int job_run(GMSSL_JOB *job)
+{
+	switch (job->op) {
+	case GMSSL_JOB_sm3_digest:
+		if (!job->out || (!job->in && job->inlen)) {
+			error_print();
+			return -1;
+		}
+		sm3_digest(job->in, job->inlen, job->out);
+		return 1;
+	case GMSSL_JOB_sm2_verify:
+		if (!job->key || !job->dgst || !job->in) {
+			error_print();
+			return -1;
+		}
+		return sm2_verify((const SM2_KEY *)job->key, job->dgst, job->in, job->inlen);
+	case GMSSL_JOB_sm2_sign:
+		if (!job->key || !job->dgst || !job->out) {
+			error_print();
+			return -1;
+		}
+		return sm2_sign((const SM2_KEY *)job->key, job->dgst, job->out, &job->outlen);
+	case GMSSL_JOB_sm4_gcm_encrypt:
+		if (!job->key) {
+			error_print();
+			return -1;
+		}
+		return sm4_gcm_encrypt((const SM4_KEY *)job->key, job->iv, job->ivlen,
+			job->aad, job->aadlen, job->in, job->inlen, job->out, job->taglen, job->tag);
+	case GMSSL_JOB_sm4_gcm_decrypt:
+		if (!job->key) {
+			error_print();
+			return -1;
+		}
+		return sm4_gcm_decrypt((const SM4_KEY *)job->key, job->iv, job->ivlen,
+			job->aad, job->aadlen, job->in, job->inlen, job->tag, job->taglen, job->out);
+	case GMSSL_JOB_sm9_encrypt:
+		return sm9_encrypt((const SM9_ENC_MASTER_KEY *)job->key, job->id, job->idlen,
+			job->in, job->inlen, job->out, &job->outlen);
+	case GMSSL_JOB_sm9_decrypt:
+		return sm9_decrypt((const SM9_ENC_KEY *)job->key, job->id, job->idlen,
+			job->in, job->inlen, job->out, &job->outlen);
+	case GMSSL_JOB_custom:
+		return job->func(job->arg);
+	case GMSSL_JOB_sm2_decrypt:
+		if (!job->key || !job->out) {
+			error_print();
+			return -1;
+		}
+		return sm2_decrypt((const SM2_KEY *)job->key, job->in, job->inlen, job->out, &job->outlen);
+	case GMSSL_JOB_sm2_ecdh:
+		if (!job->key || !job->in || !job->out) {
+			error_print();
+			return -1;
+		}
+		job->outlen = 64;
+		return sm2_ecdh((const SM2_KEY *)job->key, job->in, job->inlen, job->out);
+	case GMSSL_JOB_sm4_cbc_encrypt:
+	case GMSSL_JOB_sm4_cbc_decrypt:
+	case GMSSL_JOB_sm4_ctr_encrypt:
+		return job_run_sm4(job);
+	}
+	error_print();
+	return -1;
+}
+
+static void job_task(void *arg)
+{
+	JOB_TASK *task = (JOB_TASK *)arg;
+	GMSSL_JOB_QUEUE *queue = task->queue;
+	size_t i;
+
+	switch (task->type) {
+	case JOB_TASK_one:
+		task->job->ret = job_run(task->job);
+		break;
+	case JOB_TASK_sm3_batch:
+		sm3_digest_batch(queue->sm3_datas, queue->sm3_datalens, queue->sm3_cnt, queue->sm3_dgsts);
+		for (i = 0; i < queue->sm3_cnt; i++) {
+			memcpy(queue->sm3_jobs[i]->out, queue->sm3_dgsts[i], SM3_DIGEST_SIZE);
+			queue->sm3_jobs[i]->ret = 1;
+		}
+		break;
+	case JOB_TASK_sm2_verify_batch:
+		sm2_do_verify_batch(queue->verify_keys, (const uint8_t (*)[32])queue->verify_dgsts,
+			queue->verify_sigs, queue->verify_cnt, queue->verify_results);
+		for (i = 0; i < queue->verify_cnt; i++) {
+			queue->verify_jobs[i]->ret = queue->verify_results[i] == 1 ? 1 : -1;
+		}
+		break;
+	}
+}
+
+// the SM3 and SM2 verify jobs are gathered for their batch functions
+static void job_queue_run_batch(GMSSL_JOB_QUEUE *queue, size_t cnt)
+{
+	size_t tasks_cnt = 0;
+	size_t i;
+
+	queue->sm3_cnt = 0;
+	queue->verify_cnt = 0;
+
+	for (i = 0; i < cnt; i++) {
+		GMSSL_JOB *job = queue->batch[i];
+
+		if (job->op == GMSSL_JOB_sm3_digest) {
+			if (!job->out || (!job->in && job->inlen)) {
+				error_print();
+				job->ret = -1;
+				continue;
+			}
+			queue->sm3_jobs[queue->sm3_cnt] = job;
+			queue->sm3_datas[queue->sm3_cnt] = job->in;
+			queue->sm3_datalens[queue->sm3_cnt] = job->inlen;
+			queue->sm3_cnt++;
+
+		} else if (job->op == GMSSL_JOB_sm2_verify) {
+			const uint8_t *p = job->in;
+			size_t len = job->inlen;
+
+			if (!job->key || !job->dgst || !p
+				|| sm2_signature_from_der(&queue->verify_sigs[queue->verify_cnt], &p, &len) != 1
+				|| len) {
+				error_print();
+				job->ret = -1;
+				continue;
+			}
+			queue->verify_jobs[queue->verify_cnt] = job;
+			queue->verify_keys[queue->verify_cnt] = (const SM2_KEY *)job->key;
+			memcpy(queue->verify_dgsts[queue->verify_cnt], job->dgst, 32);
+			queue->verify_cnt++;
+
+		} else {
+			queue->tasks[tasks_cnt].queue = queue;
+			queue->tasks[tasks_cnt].type = JOB_TASK_one;
+			queue->tasks[tasks_cnt].job = job;
+			tasks_cnt++;
+		}
+	}
+	if (queue->sm3_cnt) {
+		queue->tasks[tasks_cnt].queue = queue;
+		queue->tasks[tasks_cnt].type = JOB_TASK_sm3_batch;
+		tasks_cnt++;
+	}
+	if (queue->verify_cnt) {
+		queue->tasks[tasks_cnt].queue = queue;
+		queue->tasks[tasks_cnt].type = JOB_TASK_sm2_verify_batch;
+		tasks_cnt++;
+	}
+	gmssl_thread_pool_run(job_task, queue->tasks, sizeof(JOB_TASK), tasks_cnt);
+}
+
+static void job_queue_finish(GMSSL_JOB_QUEUE *queue, GMSSL_JOB *job)
+{
+	if (job->callback) {
+		job->callback(job);
+		return;
+	}
+	job_mutex_lock(&queue->mutex);
+	job->next = NULL;
+	if (!queue->finished) {
+#ifndef _WIN32
+		uint8_t b = 0;
+		if (write(queue->fds[1], &b, 1) != 1) {
+			error_print();
+		}
+#endif
+	}
+	*queue->finished_tail = job;
+	queue->finished_tail = &job->next;
+	job_cond_broadcast(&queue->done);
+	job_mutex_unlock(&queue->mutex);
+}
+
+static void job_queue_run(GMSSL_JOB_QUEUE *queue)
+{
+	size_t cnt, i;
+
+	job_mutex_lock(&queue->mutex);
+	for (;;) {
+		while (!queue->pending && !queue->stop) {
+			job_cond_wait(&queue->work, &queue->mutex);
+		}
+		if (!queue->pending) {
+			break;
+		}
+		for (cnt = 0; queue->pending && cnt < queue->max_batch; cnt++) {
+			queue->batch[cnt] = queue->pending;
+			queue->pending = queue->pending->next;
+		}
+		if (!queue->pending) {
+			queue->pending_tail = &queue->pending;
+		}
+		job_mutex_unlock(&queue->mutex);
+
+		job_queue_run_batch(queue, cnt);
+		for (i = 0; i < cnt; i++) {
+			job_queue_finish(queue, queue->batch[i]);
+		}
+		job_mutex_lock(&queue->mutex);
+	}
+	job_mutex_unlock(&queue->mutex);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall job_queue_thread(void *arg)
+{
+	job_queue_run((GMSSL_JOB_QUEUE *)arg);
+	return 0;
+}
+#else
+static void *job_queue_thread(void *arg)
+{
+	job_queue_run((GMSSL_JOB_QUEUE *)arg);
+	return NULL;
+}
+#endif
+
+static void job_queue_free_buffers(GMSSL_JOB_QUEUE *queue)
+{
+	free(queue->batch);
+	free(queue->tasks);
+	free(queue->sm3_jobs);
+	free(queue->sm3_datas);
+	free(queue->sm3_datalens);
+	free(queue->sm3_dgsts);
+	free(queue->verify_jobs);
+	free(queue->verify_keys);
+	free(queue->verify_dgsts);
+	free(queue->verify_sigs);
+	free(queue->verify_results);
+}
+
+GMSSL_JOB_QUEUE *gmssl_job_queue_new(size_t max_batch)
+{
+	GMSSL_JOB_QUEUE *queue;
+	size_t n;
+
+	if (!max_batch) {
+		max_batch = GMSSL_JOB_QUEUE_DEFAULT_BATCH;
+	}
+	if (max_batch > GMSSL_JOB_QUEUE_MAX_BATCH) {
+		error_print();
+		return NULL;
+	}
+	if (!(queue = (GMSSL_JOB_QUEUE *)calloc(1, sizeof(*queue)))) {
+		error_print();
+		return NULL;
+	}
+	n = queue->max_batch = max_batch;
+	queue->pending_tail = &queue->pending;
+	queue->finished_tail = &queue->finished;
+	queue->fds[0] = queue->fds[1] = -1;
+
+	if (!(queue->batch = (GMSSL_JOB **)calloc(n, sizeof(GMSSL_JOB *)))
+		|| !(queue->tasks = (JOB_TASK *)calloc(n, sizeof(JOB_TASK)))
+		|| !(queue->sm3_jobs = (GMSSL_JOB **)calloc(n, sizeof(GMSSL_JOB *)))
+		|| !(queue->sm3_datas = (const uint8_t **)calloc(n, sizeof(uint8_t *)))
+		|| !(queue->sm3_datalens = (size_t *)calloc(n, sizeof(size_t)))
+		|| !(queue->sm3_dgsts = (uint8_t (*)[SM3_DIGEST_SIZE])calloc(n, SM3_DIGEST_SIZE))
+		|| !(queue->verify_jobs = (GMSSL_JOB **)calloc(n, sizeof(GMSSL_JOB *)))
+		|| !(queue->verify_keys = (const SM2_KEY **)calloc(n, sizeof(SM2_KEY *)))
+		|| !(queue->verify_dgsts = (uint8_t (*)[32])calloc(n, 32))
+		|| !(queue->verify_sigs = (SM2_SIGNATURE *)calloc(n, sizeof(SM2_SIGNATURE)))
+		|| !(queue->verify_results = (int *)calloc(n, sizeof(int)))) {
+		error_print();
+		goto err;
+	}
+#ifndef _WIN32
+	if (pipe(queue->fds) != 0) {
+		queue->fds[0] = queue->fds[1] = -1;
+		error_print();
+		goto err;
+	}
+	fcntl(queue->fds[0], F_SETFL, fcntl(queue->fds[0], F_GETFL) | O_NONBLOCK);
+	fcntl(queue->fds[1], F_SETFL, fcntl(queue->fds[1], F_GETFL) | O_NONBLOCK);
+#endif
+
+	job_mutex_init(&queue->mutex);
+	job_cond_init(&queue->work);
+	job_cond_init(&queue->done);
+#ifdef _WIN32
+	if (!(queue->thread = (HANDLE)_beginthreadex(NULL, 0, job_queue_thread, queue, 0, NULL))) {
+#else
+	if (pthread_create(&queue->thread, NULL, job_queue_thread, queue) != 0) {
+#endif
+		job_cond_destroy(&queue->done);
+		job_cond_destroy(&queue->work);
+		job_mutex_destroy(&queue->mutex);
+		error_print();
+		goto err;
+	}
+	return queue;
+
+err:
+#ifndef _WIN32
+	if (queue->fds[0] >= 0) {
+		close(queue->fds[0]);
+		close(queue->fds[1]);
+	}
+#endif
+	job_queue_free_buffers(queue);
+	free(queue);
+	return NULL;
+}
+
+void gmssl_job_queue_free(GMSSL_JOB_QUEUE *queue)
+{
+	if (!queue) {
+		return;
+	}
+	job_mutex_lock(&queue->mutex);
+	queue->stop = 1;
+	job_cond_signal(&queue->work);
+	job_mutex_unlock(&queue->mutex);
+#ifdef _WIN32
+	WaitForSingleObject(queue->thread, INFINITE);
+	CloseHandle(queue->thread);
+#else
+	pthread_join(queue->thread, NULL);
+	close(queue->fds[0]);
+	close(queue->fds[1]);
+#endif
+	job_cond_destroy(&queue->done);
+	job_cond_destroy(&queue->work);
+	job_mutex_destroy(&queue->mutex);
+	job_queue_free_buffers(queue);
+	free(queue);
+}
+
+int gmssl_job_run(GMSSL_JOB *job)
+{
+	if (!job) {
+		error_print();
+		return -1;
+	}
+	if (job->op < GMSSL_JOB_sm3_digest || job->op > GMSSL_JOB_sm4_ctr_encrypt
+		|| (job->op == GMSSL_JOB_custom && !job->func)) {
+		error_print();
+		return -1;
+	}
+	job->ret = job_run(job);
+	return job->ret;
+}
+
+int gmssl_job_submit(GMSSL_JOB_QUEUE *queue, GMSSL_JOB *job)
+{
+	if (!queue || !job) {
+		error_print();
+		return -1;
+	}
+	if (job->op < GMSSL_JOB_sm3_digest || job->op > GMSSL_JOB_sm4_ctr_encrypt
+		|| (job->op == GMSSL_JOB_custom && !job->func)) {
+		error_print();
+		return -1;
+	}
+	job->ret = 0;
+	job->next = NULL;
+
+	job_mutex_lock(&queue->mutex);
+	if (!job->callback) {
+		queue->waiting++;
+	}
+	*queue->pending_tail = job;
+	queue->pending_tail = &job->next;
+	job_cond_signal(&queue->work);
+	job_mutex_unlock(&queue->mutex);
+	return 1;
+}
+
+// under queue->mutex
+static void job_queue_pop(GMSSL_JOB_QUEUE *queue, GMSSL_JOB **job)
+{
+	*job = queue->finished;
+	if (!(queue->finished = (*job)->next)) {
+		queue->finished_tail = &queue->finished;
+#ifndef _WIN32
+		{
+			uint8_t buf[64];
+			while (read(queue->fds[0], buf, sizeof(buf)) > 0) {
+			}
+		}
+#endif
+	}
+	(*job)->next = NULL;
+	queue->waiting--;
+}
+
+int gmssl_job_poll(GMSSL_JOB_QUEUE *queue, GMSSL_JOB **job)
+{
+	int ret = 0;
+
+	if (!queue || !job) {
+		error_print();
+		return -1;
+	}
+	job_mutex_lock(&queue->mutex);
+	if (queue->finished) {
+		job_queue_pop(queue, job);
+		ret = 1;
+	}
+	job_mutex_unlock(&queue->mutex);
+	return ret;
+}
+
+int gmssl_job_wait(GMSSL_JOB_QUEUE *queue, GMSSL_JOB **job)
+{
+	int ret = 0;
+
+	if (!queue || !job) {
+		error_print();
+		return -1;
+	}
+	job_mutex_lock(&queue->mutex);
+	// no job to wait for if all the submitted ones have a callback
+	while (!queue->finished && queue->waiting) {
+		job_cond_wait(&queue->done, &queue->mutex);
+	}
+	if (queue->finished) {
+		job_queue_pop(queue, job);
+		ret = 1;
+	}
+	job_mutex_unlock(&queue->mutex);
+	return ret;
+}
+
+int gmssl_job_queue_fd(const GMSSL_JOB_QUEUE *queue)
+{
+	if (!queue) {
+		error_print();
+		return -1;
+	}
+	return queue->fds[0];
+}
@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/metrics.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define METRICS_THREAD_LOCAL __declspec(thread)
+static SRWLOCK metrics_lock = SRWLOCK_INIT;
+#define metrics_mutex_lock()	AcquireSRWLockExclusive(&metrics_lock)
+#define metrics_mutex_unlock()	ReleaseSRWLockExclusive(&metrics_lock)
+#else
+#include <time.h>
+#include <pthread.h>
+#define METRICS_THREAD_LOCAL __thread
+static pthread_mutex_t metrics_lock = PTHREAD_MUTEX_INITIALIZER;
+#define metrics_mutex_lock()	pthread_mutex_lock(&metrics_lock)
+#define metrics_mutex_unlock()	pthread_mutex_unlock(&metrics_lock)
+#endif
+
+
+static const char *metrics_names[METRICS_COUNT] = {
+	"tlcp_full_handshakes",
+	"tlcp_resumed_handshakes",
+	"tls12_full_handshakes",
+	"tls12_resumed_handshakes",
+	"tls13_full_handshakes",
+	"tls13_resumed_handshakes",
+	"tls_handshake_failures",
+	"tls_key_exchange_nsec",
+	"tls_signature_nsec",
+	"tls_certificate_verify_nsec",
+	"tls_key_schedule_nsec",
+	"tls_sm4_cbc_sm3_encrypt_bytes",
+	"tls_sm4_cbc_sm3_decrypt_bytes",
+	"tls_sm4_gcm_encrypt_bytes",
+	"tls_sm4_gcm_decrypt_bytes",
+	"sm2_signs",
+	"sm2_sign_nsec",
+	"sm2_verifies",
+	"sm2_verify_nsec",
+	"x509_verify_cache_hits",
+	"x509_verify_cache_misses",
+	"sm2_verify_cache_hits",
+	"sm2_verify_cache_misses",
+	"tls_session_cache_hits",
+	"tls_session_cache_misses",
+	"rand_reseeds",
+	"errors",
+};
+
+/*
+ * The counters of a thread are only written by the thread itself, a snapshot
+ * reads them without a lock and may miss the latest updates. On exit a thread
+ * moves its counters to metrics_retired (no exit hook on Windows, the block
+ * of an exited thread stays in the list).
+ */
+typedef struct METRICS_THREAD_st {
+	uint64_t values[METRICS_COUNT];
+	struct METRICS_THREAD_st *prev;
+	struct METRICS_THREAD_st *next;
+} METRICS_THREAD;
+
+static METRICS_THREAD_LOCAL METRICS_THREAD *metrics_thread = NULL;
+static METRICS_THREAD *metrics_threads = NULL;
+static uint64_t metrics_retired[METRICS_COUNT];
+
+#ifndef _WIN32
+static pthread_key_t metrics_key;
+static pthread_once_t metrics_key_once = PTHREAD_ONCE_INIT;
+
+static void metrics_thread_exit(void *arg)
+{
+	METRICS_THREAD *t = (METRICS_THREAD *)arg;
+	int i;
+
+	metrics_mutex_lock();
+	for (i = 0; i < METRICS_COUNT; i++) {
+		metrics_retired[i] += t->values[i];
+	}
+	if (t->prev) t->prev->next = t->next;
+	else metrics_threads = t->next;
+	if (t->next) t->next->prev = t->prev;
+	metrics_mutex_unlock();
+
+	metrics_thread = NULL;
+	free(t);
+}
+
+static void metrics_key_init(void)
+{
+	pthread_key_create(&metrics_key, metrics_thread_exit);
+}
+#endif
+
+static METRICS_THREAD *metrics_thread_new(void)
+{
+	METRICS_THREAD *t;
+
+	if (!(t = (METRICS_THREAD *)calloc(1, sizeof(*t)))) {
+		return NULL;
+	}
+#ifndef _WIN32
+	pthread_once(&metrics_key_once, metrics_key_init);
+	pthread_setspecific(metrics_key, t);
+#endif
+	metrics_mutex_lock();
+	t->next = metrics_threads;
+	if (metrics_threads) metrics_threads->prev = t;
+	metrics_threads = t;
+	metrics_mutex_unlock();
+
+	metrics_thread = t;
+	return t;
+}
+
+// the counts are dropped if the counters can not be allocated
+void metrics_add(int id, uint64_t val)
+{
+	METRICS_THREAD *t = metrics_thread;
+
+	if (!t && !(t = metrics_thread_new())) {
+		return;
+	}
+	t->values[id] += val;
+}
+
+uint64_t metrics_nsec(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return (uint64_t)((double)counter.QuadPart * 1e9 / (double)freq.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (uint64_t)ts.tv_sec * 1000000000 + (uint64_t)ts.tv_nsec;
+#endif
+}
+
+int metrics_snapshot(METRICS *metrics)
+{
+	METRICS_THREAD *t;
+	int i;
+
+	if (!metrics) {
+		error_print();
+		return -1;
+	}
+	metrics_mutex_lock();
+	memcpy(metrics->values, metrics_retired, sizeof(metrics_retired));
+	for (t = metrics_threads; t; t = t->next) {
+		for (i = 0; i < METRICS_COUNT; i++) {
+			metrics->values[i] += t->values[i];
+		}
+	}
+	metrics_mutex_unlock();
+#ifdef ENABLE_METRICS
+	return 1;
+#else
+	return 0;
+#endif
+}
+
+const char *metrics_name(int id)
+{
+	if (id < 0 || id >= METRICS_COUNT) {
+		return NULL;
+	}
+	return metrics_names[id];
+}
+
+int metrics_print(FILE *fp, int fmt, int ind, const char *label, const METRICS *metrics)
+{
+	int i;
+
+	format_print(fp, fmt, ind, "%s\n", label);
+	ind += 4;
+	for (i = 0; i < METRICS_COUNT; i++) {
+		format_print(fp, fmt, ind, "%s: %llu\n", metrics_names[i], (unsigned long long)metrics->values[i]);
+	}
+	return 1;
+}
@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/numa.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define NUMA_THREAD_LOCAL __declspec(thread)
+static SRWLOCK numa_lock = SRWLOCK_INIT;
+#define numa_mutex_lock()	AcquireSRWLockExclusive(&numa_lock)
+#define numa_mutex_unlock()	ReleaseSRWLockExclusive(&numa_lock)
+#define numa_load(p)		InterlockedCompareExchangePointer((PVOID volatile *)(p), NULL, NULL)
+#define numa_store(p,v)		InterlockedExchangePointer((PVOID volatile *)(p), (PVOID)(v))
+#else
+#include <pthread.h>
+#define NUMA_THREAD_LOCAL __thread
+static pthread_mutex_t numa_lock = PTHREAD_MUTEX_INITIALIZER;
+#define numa_mutex_lock()	pthread_mutex_lock(&numa_lock)
+#define numa_mutex_unlock()	pthread_mutex_unlock(&numa_lock)
+#define numa_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define numa_store(p,v)		__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+#define NUMA_MAX_CPUS		1024
+#define NUMA_PAGE_SIZE		4096
+
+
+static int numa_nodes_cnt = 1;
+static uint8_t numa_cpu_node[NUMA_MAX_CPUS];
+static NUMA_THREAD_LOCAL int numa_node = -1;
+
+#ifdef __linux__
+static cpu_set_t numa_node_cpus[GMSSL_NUMA_MAX_NODES];
+
+// cpulist format of sysfs, e.g. "0-3,8-11"
+static void numa_read_cpulist(FILE *fp, int node)
+{
+	char buf[1024];
+	char *p = buf;
+	long first, last, cpu;
+
+	if (!fgets(buf, sizeof(buf), fp)) {
+		return;
+	}
+	while (*p >= '0' && *p <= '9') {
+		first = last = strtol(p, &p, 10);
+		if (*p == '-') {
+			last = strtol(p + 1, &p, 10);
+		}
+		for (cpu = first; cpu <= last && cpu < NUMA_MAX_CPUS; cpu++) {
+			numa_cpu_node[cpu] = (uint8_t)node;
+			CPU_SET((int)cpu, &numa_node_cpus[node]);
+		}
+		if (*p == ',') {
+			p++;
+		}
+	}
+}
+#endif
+
+static void numa_init(void)
+{
+#ifdef __linux__
+	char path[64];
+	FILE *fp;
+	int node;
+
+	// node numbers may have gaps, those nodes are left without CPUs
+	for (node = 0; node < GMSSL_NUMA_MAX_NODES; node++) {
+		CPU_ZERO(&numa_node_cpus[node]);
+		snprintf(path, sizeof(path), "/sys/devices/system/node/node%d/cpulist", node);
+		if (!(fp = fopen(path, "r"))) {
+			continue;
+		}
+		numa_read_cpulist(fp, node);
+		fclose(fp);
+		numa_nodes_cnt = node + 1;
+	}
+#endif
+}
+
+#ifdef _WIN32
+static INIT_ONCE numa_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK numa_init_once(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+	numa_init();
+	return TRUE;
+}
+
+static void numa_topology(void)
+{
+	InitOnceExecuteOnce(&numa_once, numa_init_once, NULL, NULL);
+}
+#else
+static pthread_once_t numa_once = PTHREAD_ONCE_INIT;
+
+static void numa_topology(void)
+{
+	pthread_once(&numa_once, numa_init);
+}
+#endif
+
+int gmssl_numa_nodes(void)
+{
+	numa_topology();
+	return numa_nodes_cnt;
+}
+
+int gmssl_numa_node_of_cpu(int cpu)
+{
+	numa_topology();
+	if (cpu < 0 || cpu >= NUMA_MAX_CPUS) {
+		return 0;
+	}
+	return numa_cpu_node[cpu];
+}
+
+int gmssl_numa_bind_thread(int node)
+{
+	if (node < 0 || node >= gmssl_numa_nodes()) {
+		error_print();
+		return -1;
+	}
+#ifdef __linux__
+	// a node without CPUs (memory only) is kept, the thread runs anywhere
+	if (CPU_COUNT(&numa_node_cpus[node])
+		&& sched_setaffinity(0, sizeof(cpu_set_t), &numa_node_cpus[node]) != 0) {
+		error_print();
+		return -1;
+	}
+#endif
+	numa_node = node;
+	return 1;
+}
+
+int gmssl_numa_set_thread_node(int node)
+{
+	if (node < -1 || node >= gmssl_numa_nodes()) {
+		error_print();
+		return -1;
+	}
+	numa_node = node;
+	return 1;
+}
+
+int gmssl_numa_thread_node(void)
+{
+	return numa_node;
+}
+
+const void *gmssl_numa_replica(GMSSL_NUMA_REPLICA *replica, const void *data, size_t datalen)
+{
+	int node = numa_node;
+	void *copy;
+
+	// numa_node is only set after the topology is read
+	if (node < 0 || numa_nodes_cnt < 2) {
+		return data;
+	}
+	if ((copy = numa_load(&replica->copies[node])) != NULL) {
+		return copy;
+	}
+
+	numa_mutex_lock();
+	if (!(copy = replica->copies[node])) {
+#ifdef __linux__
+		if (posix_memalign(&copy, NUMA_PAGE_SIZE, datalen) != 0) {
+			copy = NULL;
+		}
+#else
+		copy = malloc(datalen);
+#endif
+		if (copy) {
+			memcpy(copy, data, datalen);
+			numa_store(&replica->copies[node], copy);
+		}
+	}
+	numa_mutex_unlock();
+
+	// out of memory, the shared data still works
+	return copy ? copy : data;
+}
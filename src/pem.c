@@ -36,6 +36,148 @@ static int remove_newline(char *line)
 	return 0; // No newline found, might not be an error
 }
 
+// 0xff for invalid characters, 0xfe for whitespace
+static const uint8_t pem_base64_table[256] = {
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xfe, 0xfe, 0xff, 0xff, 0xfe, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xfe, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x3e, 0xff, 0xff, 0xff, 0x3f,
+	0x34, 0x35, 0x36, 0x37, 0x38, 0x39, 0x3a, 0x3b, 0x3c, 0x3d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x00, 0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08, 0x09, 0x0a, 0x0b, 0x0c, 0x0d, 0x0e,
+	0x0f, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17, 0x18, 0x19, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0x1a, 0x1b, 0x1c, 0x1d, 0x1e, 0x1f, 0x20, 0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28,
+	0x29, 0x2a, 0x2b, 0x2c, 0x2d, 0x2e, 0x2f, 0x30, 0x31, 0x32, 0x33, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+	0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+};
+
+static const uint8_t *pem_find_line(const uint8_t *p, const uint8_t *end, const char *line, size_t linelen)
+{
+	while ((size_t)(end - p) >= linelen) {
+		if (!(p = memchr(p, line[0], (size_t)(end - p) - linelen + 1))) {
+			return NULL;
+		}
+		if (memcmp(p, line, linelen) == 0) {
+			return p;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+int pem_decode(const char *name, const uint8_t **in, size_t *inlen, uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	char begin_line[80];
+	char end_line[80];
+	size_t begin_len, end_len;
+	const uint8_t *p;
+	const uint8_t *end;
+	uint32_t acc = 0;
+	size_t nchars = 0;
+	size_t npad = 0;
+	size_t n;
+	uint8_t c;
+
+	if (!name || !in || !(*in) || !inlen || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	begin_len = snprintf(begin_line, sizeof(begin_line), "-----BEGIN %s-----", name);
+	end_len = snprintf(end_line, sizeof(end_line), "-----END %s-----", name);
+	if (begin_len >= sizeof(begin_line) || end_len >= sizeof(end_line)) {
+		error_print();
+		return -1;
+	}
+	end = *in + *inlen;
+
+	if (!(p = pem_find_line(*in, end, begin_line, begin_len))) {
+		*in = end;
+		*inlen = 0;
+		*outlen = 0;
+		return 0;
+	}
+	p += begin_len;
+
+	// one pass over the base64 text, the lines are decoded in bulk by base64_decode_run
+	// and the line breaks, padding and errors are left to the per character loop
+	*outlen = 0;
+	for (; p < end && *p != '-'; p++) {
+		if (nchars % 4 == 0 && !npad) {
+			if ((n = (size_t)(end - p)) > (maxlen - *outlen) / 3 * 4) {
+				n = (maxlen - *outlen) / 3 * 4;
+			}
+			n = base64_decode_run(out + *outlen, p, n);
+			*outlen += n / 4 * 3;
+			nchars += n;
+			if ((p += n) == end || *p == '-') {
+				break;
+			}
+		}
+		if (*p == '=') {
+			npad++;
+			continue;
+		}
+		if ((c = pem_base64_table[*p]) == 0xfe) {
+			continue;
+		}
+		if (c == 0xff || npad) {
+			error_print();
+			return -1;
+		}
+		acc = (acc << 6) | c;
+		if (++nchars % 4 == 0) {
+			if (*outlen + 3 > maxlen) {
+				error_print();
+				return -1;
+			}
+			out[(*outlen)++] = (uint8_t)(acc >> 16);
+			out[(*outlen)++] = (uint8_t)(acc >> 8);
+			out[(*outlen)++] = (uint8_t)acc;
+			acc = 0;
+		}
+	}
+	switch (nchars % 4) {
+	case 0:
+		if (npad) {
+			error_print();
+			return -1;
+		}
+		break;
+	case 2:
+		if (npad != 2 || *outlen + 1 > maxlen) {
+			error_print();
+			return -1;
+		}
+		out[(*outlen)++] = (uint8_t)(acc >> 4);
+		break;
+	case 3:
+		if (npad != 1 || *outlen + 2 > maxlen) {
+			error_print();
+			return -1;
+		}
+		out[(*outlen)++] = (uint8_t)(acc >> 10);
+		out[(*outlen)++] = (uint8_t)(acc >> 2);
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+
+	if ((size_t)(end - p) < end_len || memcmp(p, end_line, end_len) != 0) {
+		error_print();
+		return -1;
+	}
+	p += end_len;
+	*inlen = (size_t)(end - p);
+	*in = p;
+	return 1;
+}
+
 int pem_write(FILE *fp, const char *name, const uint8_t *data, size_t datalen)
 {
 	BASE64_CTX ctx;
@@ -67,6 +209,131 @@ int pem_write(FILE *fp, const char *name, const uint8_t *data, size_t datalen)
 	return 1;
 }
 
+int pem_write_init(PEM_CTX *ctx, FILE *fp, const char *name)
+{
+	if (!ctx || !fp || !name) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->fp = fp;
+	ctx->name = name;
+	base64_encode_init(&ctx->base64_ctx);
+	if (fprintf(fp, "-----BEGIN %s-----\n", name) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int pem_write_update(PEM_CTX *ctx, const uint8_t *in, size_t inlen)
+{
+	uint8_t out[168];
+	int len, outlen;
+
+	if (!ctx || (!in && inlen)) {
+		error_print();
+		return -1;
+	}
+	while (inlen) {
+		len = inlen < 48 ? (int)inlen : 48;
+		base64_encode_update(&ctx->base64_ctx, in, len, out, &outlen);
+		if (fwrite(out, 1, outlen, ctx->fp) != (size_t)outlen) {
+			error_print();
+			return -1;
+		}
+		in += len;
+		inlen -= len;
+	}
+	return 1;
+}
+
+int pem_write_finish(PEM_CTX *ctx)
+{
+	uint8_t out[168];
+	int outlen;
+
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	base64_encode_finish(&ctx->base64_ctx, out, &outlen);
+	if (fwrite(out, 1, outlen, ctx->fp) != (size_t)outlen
+		|| fprintf(ctx->fp, "-----END %s-----\n", ctx->name) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int pem_read_init(PEM_CTX *ctx, FILE *fp, const char *name)
+{
+	char line[80];
+	char begin_line[80];
+
+	if (!ctx || !fp || !name) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	snprintf(begin_line, sizeof(begin_line), "-----BEGIN %s-----", name);
+
+	if (!fgets(line, sizeof(line), fp)) {
+		error_print();
+		return -1;
+	}
+	remove_newline(line);
+	if (strcmp(line, begin_line) != 0) {
+		error_print();
+		return -1;
+	}
+	ctx->fp = fp;
+	ctx->name = name;
+	base64_decode_init(&ctx->base64_ctx);
+	return 1;
+}
+
+int pem_read_update(PEM_CTX *ctx, uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	char line[80];
+	char end_line[80];
+	int len;
+
+	if (!ctx || !out || !outlen || maxlen < PEM_READ_MIN_SIZE) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (ctx->end) {
+		return 0;
+	}
+	snprintf(end_line, sizeof(end_line), "-----END %s-----", ctx->name);
+
+	// a line of 76 base64 characters is at most 57 bytes, plus the buffered ones
+	while (*outlen + 64 <= maxlen) {
+		if (!fgets(line, sizeof(line), ctx->fp)) {
+			error_print();
+			return -1;
+		}
+		remove_newline(line);
+		if (strcmp(line, end_line) == 0) {
+			if (base64_decode_finish(&ctx->base64_ctx, out + *outlen, &len) < 0) {
+				error_print();
+				return -1;
+			}
+			*outlen += len;
+			ctx->end = 1;
+			break;
+		}
+		if (base64_decode_update(&ctx->base64_ctx, (uint8_t *)line, (int)strlen(line), out + *outlen, &len) < 0) {
+			error_print();
+			return -1;
+		}
+		*outlen += len;
+	}
+	return 1;
+}
+
 int pem_read(FILE *fp, const char *name, uint8_t *data, size_t *datalen, size_t maxlen)
 {
 	char line[80];
@@ -0,0 +1,276 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/pkcs8.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK cache_lock = SRWLOCK_INIT;
+#define cache_mutex_lock()	AcquireSRWLockExclusive(&cache_lock)
+#define cache_mutex_unlock()	ReleaseSRWLockExclusive(&cache_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define cache_mutex_lock()	pthread_mutex_lock(&cache_lock)
+#define cache_mutex_unlock()	pthread_mutex_unlock(&cache_lock)
+#endif
+
+
+typedef struct {
+	uint8_t id[SM3_DIGEST_SIZE]; // SM3(iter || saltlen || salt || SM3(pass))
+	uint8_t key[PKCS8_KEY_CACHE_MAX_KEY_SIZE];
+	size_t keylen;
+	uint64_t used; // 0 for a free way
+} KEY_CACHE_ENTRY;
+
+static KEY_CACHE_ENTRY cache[PKCS8_KEY_CACHE_SETS][PKCS8_KEY_CACHE_WAYS];
+static uint64_t cache_clock = 0;
+static size_t cache_hits = 0;
+static size_t cache_misses = 0;
+static int cache_enabled = 0;
+
+static void cache_entry_id(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, int iter, uint8_t id[SM3_DIGEST_SIZE])
+{
+	SM3_CTX sm3_ctx;
+	uint8_t pass_dgst[SM3_DIGEST_SIZE];
+	uint8_t buf[8];
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, (const uint8_t *)pass, passlen);
+	sm3_finish(&sm3_ctx, pass_dgst);
+
+	PUTU32(buf, (uint32_t)iter);
+	PUTU32(buf + 4, (uint32_t)saltlen);
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, buf, sizeof(buf));
+	sm3_update(&sm3_ctx, salt, saltlen);
+	sm3_update(&sm3_ctx, pass_dgst, sizeof(pass_dgst));
+	sm3_finish(&sm3_ctx, id);
+
+	gmssl_secure_clear(pass_dgst, sizeof(pass_dgst));
+	gmssl_secure_clear(&sm3_ctx, sizeof(sm3_ctx));
+}
+
+static KEY_CACHE_ENTRY *cache_set(const uint8_t id[SM3_DIGEST_SIZE])
+{
+	return cache[((uint32_t)id[0] << 8 | id[1]) % PKCS8_KEY_CACHE_SETS];
+}
+
+int pkcs8_key_cache_lookup(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, int iter, uint8_t *key, size_t keylen)
+{
+	uint8_t id[SM3_DIGEST_SIZE];
+	KEY_CACHE_ENTRY *set;
+	int ret = 0;
+	int i;
+
+	if (!pass || !salt || !key || !keylen || keylen > PKCS8_KEY_CACHE_MAX_KEY_SIZE) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock();
+	if (!cache_enabled) {
+		cache_mutex_unlock();
+		return 0;
+	}
+	cache_mutex_unlock();
+
+	// hashed outside of the lock, the cache may be disabled meanwhile
+	cache_entry_id(pass, passlen, salt, saltlen, iter, id);
+	set = cache_set(id);
+
+	cache_mutex_lock();
+	if (cache_enabled) {
+		for (i = 0; i < PKCS8_KEY_CACHE_WAYS; i++) {
+			if (set[i].used
+				&& set[i].keylen == keylen
+				&& memcmp(set[i].id, id, sizeof(id)) == 0) {
+				memcpy(key, set[i].key, keylen);
+				set[i].used = ++cache_clock;
+				ret = 1;
+				break;
+			}
+		}
+		if (ret) cache_hits++;
+		else cache_misses++;
+	}
+	cache_mutex_unlock();
+	return ret;
+}
+
+int pkcs8_key_cache_add(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, int iter, const uint8_t *key, size_t keylen)
+{
+	uint8_t id[SM3_DIGEST_SIZE];
+	KEY_CACHE_ENTRY *set;
+	KEY_CACHE_ENTRY *e;
+	int i;
+
+	if (!pass || !salt || !key || !keylen || keylen > PKCS8_KEY_CACHE_MAX_KEY_SIZE) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock();
+	if (!cache_enabled) {
+		cache_mutex_unlock();
+		return 1;
+	}
+	cache_mutex_unlock();
+
+	cache_entry_id(pass, passlen, salt, saltlen, iter, id);
+	set = cache_set(id);
+
+	cache_mutex_lock();
+	if (cache_enabled) {
+		e = &set[0];
+		for (i = 0; i < PKCS8_KEY_CACHE_WAYS; i++) {
+			if (set[i].used && memcmp(set[i].id, id, sizeof(id)) == 0) {
+				e = &set[i];
+				break;
+			}
+			if (set[i].used < e->used) {
+				e = &set[i];
+			}
+		}
+		gmssl_secure_clear(e->key, sizeof(e->key));
+		memcpy(e->id, id, sizeof(id));
+		memcpy(e->key, key, keylen);
+		e->keylen = keylen;
+		e->used = ++cache_clock;
+	}
+	cache_mutex_unlock();
+	return 1;
+}
+
+void pkcs8_key_cache_clear(void)
+{
+	cache_mutex_lock();
+	gmssl_secure_clear(cache, sizeof(cache));
+	cache_hits = 0;
+	cache_misses = 0;
+	cache_mutex_unlock();
+}
+
+void pkcs8_key_cache_set_enabled(int enabled)
+{
+	cache_mutex_lock();
+	cache_enabled = enabled ? 1 : 0;
+	if (!cache_enabled) {
+		gmssl_secure_clear(cache, sizeof(cache));
+	}
+	cache_mutex_unlock();
+}
+
+void pkcs8_key_cache_get_stats(size_t *hits, size_t *misses)
+{
+	cache_mutex_lock();
+	if (hits) *hits = cache_hits;
+	if (misses) *misses = cache_misses;
+	cache_mutex_unlock();
+}
+
+int pkcs8_derive_keys(const char *const *passes, const uint8_t *const *salts, const size_t *saltlens,
+	const int *iters, size_t num, size_t keylen, uint8_t *const *keys)
+{
+	const char **miss_passes = NULL;
+	size_t *miss_passlens = NULL;
+	const uint8_t **miss_salts = NULL;
+	size_t *miss_saltlens = NULL;
+	uint8_t **miss_keys = NULL;
+	size_t *misses = NULL;
+	size_t nmisses = 0;
+	size_t i, j, n;
+	int ret = -1;
+
+	if (!passes || !salts || !saltlens || !iters || !keys || !keylen
+		|| keylen > PKCS8_KEY_CACHE_MAX_KEY_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!num) {
+		return 1;
+	}
+	if (!(miss_passes = (const char **)malloc(num * sizeof(*miss_passes)))
+		|| !(miss_passlens = (size_t *)malloc(num * sizeof(*miss_passlens)))
+		|| !(miss_salts = (const uint8_t **)malloc(num * sizeof(*miss_salts)))
+		|| !(miss_saltlens = (size_t *)malloc(num * sizeof(*miss_saltlens)))
+		|| !(miss_keys = (uint8_t **)malloc(num * sizeof(*miss_keys)))
+		|| !(misses = (size_t *)malloc(num * sizeof(*misses)))) {
+		error_print();
+		goto end;
+	}
+
+	for (i = 0; i < num; i++) {
+		int r;
+		if (!passes[i] || !salts[i] || !keys[i] || iters[i] <= 0) {
+			error_print();
+			goto end;
+		}
+		if ((r = pkcs8_key_cache_lookup(passes[i], strlen(passes[i]),
+			salts[i], saltlens[i], iters[i], keys[i], keylen)) < 0) {
+			error_print();
+			goto end;
+		}
+		if (r == 0) {
+			misses[nmisses++] = i;
+		}
+	}
+
+	// the misses sharing an iteration count are derived in one batch
+	while (nmisses) {
+		int iter = iters[misses[0]];
+
+		for (n = 0, i = 0, j = 0; j < nmisses; j++) {
+			size_t k = misses[j];
+			if (iters[k] == iter) {
+				miss_passes[n] = passes[k];
+				miss_passlens[n] = strlen(passes[k]);
+				miss_salts[n] = salts[k];
+				miss_saltlens[n] = saltlens[k];
+				miss_keys[n] = keys[k];
+				n++;
+			} else {
+				misses[i++] = k;
+			}
+		}
+		nmisses = i;
+
+		if (sm3_pbkdf2_batch(miss_passes, miss_passlens, miss_salts, miss_saltlens,
+			(size_t)iter, keylen, miss_keys, n) != 1) {
+			error_print();
+			goto end;
+		}
+		for (j = 0; j < n; j++) {
+			if (pkcs8_key_cache_add(miss_passes[j], miss_passlens[j],
+				miss_salts[j], miss_saltlens[j], iter, miss_keys[j], keylen) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+	ret = 1;
+
+end:
+	free(miss_passes);
+	free(miss_passlens);
+	free(miss_salts);
+	free(miss_saltlens);
+	free(miss_keys);
+	free(misses);
+	return ret;
+}
@@ -0,0 +1,276 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <gmssl/poly1305.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+
+
+/*
+ * h = (h + m) * r mod 2^130 - 5
+ *
+ * r is clamped, so the limbs of r * 5 stay small and the reduction folds the
+ * product limbs above 2^130 back with a multiplication by 5. `hibit` is the
+ * 2^128 bit of a full block, the last partial block is padded with a 1 byte
+ * instead.
+ */
+
+#if defined(__SIZEOF_INT128__)
+
+typedef unsigned __int128 uint128_t;
+
+#define M44	((uint64_t)0xfffffffffff)
+#define M42	((uint64_t)0x3ffffffffff)
+
+void poly1305_init(POLY1305_CTX *ctx, const uint8_t key[POLY1305_KEY_SIZE])
+{
+	uint64_t t0 = GETU64_LE(key);
+	uint64_t t1 = GETU64_LE(key + 8);
+
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->r[0] = t0 & 0xffc0fffffff;
+	ctx->r[1] = ((t0 >> 44) | (t1 << 20)) & 0xfffffc0ffff;
+	ctx->r[2] = (t1 >> 24) & 0x00ffffffc0f;
+	ctx->pad[0] = GETU64_LE(key + 16);
+	ctx->pad[1] = GETU64_LE(key + 24);
+}
+
+static void poly1305_blocks(POLY1305_CTX *ctx, const uint8_t *m, size_t nblocks, uint64_t hibit)
+{
+	const uint64_t r0 = ctx->r[0];
+	const uint64_t r1 = ctx->r[1];
+	const uint64_t r2 = ctx->r[2];
+	const uint64_t s1 = r1 * (5 << 2);
+	const uint64_t s2 = r2 * (5 << 2);
+	uint64_t h0 = ctx->h[0];
+	uint64_t h1 = ctx->h[1];
+	uint64_t h2 = ctx->h[2];
+	uint64_t t0, t1, c;
+	uint128_t d0, d1, d2;
+
+	hibit <<= 40;
+
+	while (nblocks--) {
+		t0 = GETU64_LE(m);
+		t1 = GETU64_LE(m + 8);
+
+		h0 += t0 & M44;
+		h1 += ((t0 >> 44) | (t1 << 20)) & M44;
+		h2 += ((t1 >> 24) & M42) | hibit;
+
+		d0 = (uint128_t)h0 * r0 + (uint128_t)h1 * s2 + (uint128_t)h2 * s1;
+		d1 = (uint128_t)h0 * r1 + (uint128_t)h1 * r0 + (uint128_t)h2 * s2;
+		d2 = (uint128_t)h0 * r2 + (uint128_t)h1 * r1 + (uint128_t)h2 * r0;
+
+		c = (uint64_t)(d0 >> 44); h0 = (uint64_t)d0 & M44;
+		d1 += c; c = (uint64_t)(d1 >> 44); h1 = (uint64_t)d1 & M44;
+		d2 += c; c = (uint64_t)(d2 >> 42); h2 = (uint64_t)d2 & M42;
+		h0 += c * 5; c = h0 >> 44; h0 &= M44;
+		h1 += c;
+
+		m += POLY1305_BLOCK_SIZE;
+	}
+
+	ctx->h[0] = h0;
+	ctx->h[1] = h1;
+	ctx->h[2] = h2;
+}
+
+static void poly1305_final(POLY1305_CTX *ctx, uint8_t tag[POLY1305_TAG_SIZE])
+{
+	uint64_t h0 = ctx->h[0];
+	uint64_t h1 = ctx->h[1];
+	uint64_t h2 = ctx->h[2];
+	uint64_t g0, g1, g2, c, mask;
+
+	// fully carry h
+	c = h1 >> 44; h1 &= M44;
+	h2 += c; c = h2 >> 42; h2 &= M42;
+	h0 += c * 5; c = h0 >> 44; h0 &= M44;
+	h1 += c; c = h1 >> 44; h1 &= M44;
+	h2 += c; c = h2 >> 42; h2 &= M42;
+	h0 += c * 5; c = h0 >> 44; h0 &= M44;
+	h1 += c;
+
+	// g = h - (2^130 - 5), select h if g is negative
+	g0 = h0 + 5; c = g0 >> 44; g0 &= M44;
+	g1 = h1 + c; c = g1 >> 44; g1 &= M44;
+	g2 = h2 + c - ((uint64_t)1 << 42);
+
+	mask = (g2 >> 63) - 1;
+	h0 = (h0 & ~mask) | (g0 & mask);
+	h1 = (h1 & ~mask) | (g1 & mask);
+	h2 = (h2 & ~mask) | (g2 & mask);
+
+	// tag = (h + pad) mod 2^128
+	h0 += ctx->pad[0] & M44; c = h0 >> 44; h0 &= M44;
+	h1 += (((ctx->pad[0] >> 44) | (ctx->pad[1] << 20)) & M44) + c; c = h1 >> 44; h1 &= M44;
+	h2 += ((ctx->pad[1] >> 24) & M42) + c;
+
+	PUTU64_LE(tag, h0 | (h1 << 44));
+	PUTU64_LE(tag + 8, (h1 >> 20) | (h2 << 24));
+}
+
+#else // 26-bit limbs for targets without a 64x64 -> 128 multiplication
+
+#define M26	((uint32_t)0x3ffffff)
+
+void poly1305_init(POLY1305_CTX *ctx, const uint8_t key[POLY1305_KEY_SIZE])
+{
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->r[0] = (GETU32_LE(key     )     ) & 0x3ffffff;
+	ctx->r[1] = (GETU32_LE(key +  3) >> 2) & 0x3ffff03;
+	ctx->r[2] = (GETU32_LE(key +  6) >> 4) & 0x3ffc0ff;
+	ctx->r[3] = (GETU32_LE(key +  9) >> 6) & 0x3f03fff;
+	ctx->r[4] = (GETU32_LE(key + 12) >> 8) & 0x00fffff;
+	ctx->pad[0] = GETU64_LE(key + 16);
+	ctx->pad[1] = GETU64_LE(key + 24);
+}
+
+static void poly1305_blocks(POLY1305_CTX *ctx, const uint8_t *m, size_t nblocks, uint64_t hibit)
+{
+	const uint32_t r0 = (uint32_t)ctx->r[0];
+	const uint32_t r1 = (uint32_t)ctx->r[1];
+	const uint32_t r2 = (uint32_t)ctx->r[2];
+	const uint32_t r3 = (uint32_t)ctx->r[3];
+	const uint32_t r4 = (uint32_t)ctx->r[4];
+	const uint32_t s1 = r1 * 5;
+	const uint32_t s2 = r2 * 5;
+	const uint32_t s3 = r3 * 5;
+	const uint32_t s4 = r4 * 5;
+	uint32_t h0 = (uint32_t)ctx->h[0];
+	uint32_t h1 = (uint32_t)ctx->h[1];
+	uint32_t h2 = (uint32_t)ctx->h[2];
+	uint32_t h3 = (uint32_t)ctx->h[3];
+	uint32_t h4 = (uint32_t)ctx->h[4];
+	uint32_t hb = (uint32_t)hibit << 24;
+	uint64_t d0, d1, d2, d3, d4;
+	uint32_t c;
+
+	while (nblocks--) {
+		h0 += (GETU32_LE(m     )     ) & M26;
+		h1 += (GETU32_LE(m +  3) >> 2) & M26;
+		h2 += (GETU32_LE(m +  6) >> 4) & M26;
+		h3 += (GETU32_LE(m +  9) >> 6) & M26;
+		h4 += (GETU32_LE(m + 12) >> 8) | hb;
+
+		d0 = (uint64_t)h0 * r0 + (uint64_t)h1 * s4 + (uint64_t)h2 * s3 + (uint64_t)h3 * s2 + (uint64_t)h4 * s1;
+		d1 = (uint64_t)h0 * r1 + (uint64_t)h1 * r0 + (uint64_t)h2 * s4 + (uint64_t)h3 * s3 + (uint64_t)h4 * s2;
+		d2 = (uint64_t)h0 * r2 + (uint64_t)h1 * r1 + (uint64_t)h2 * r0 + (uint64_t)h3 * s4 + (uint64_t)h4 * s3;
+		d3 = (uint64_t)h0 * r3 + (uint64_t)h1 * r2 + (uint64_t)h2 * r1 + (uint64_t)h3 * r0 + (uint64_t)h4 * s4;
+		d4 = (uint64_t)h0 * r4 + (uint64_t)h1 * r3 + (uint64_t)h2 * r2 + (uint64_t)h3 * r1 + (uint64_t)h4 * r0;
+
+		c = (uint32_t)(d0 >> 26); h0 = (uint32_t)d0 & M26;
+		d1 += c; c = (uint32_t)(d1 >> 26); h1 = (uint32_t)d1 & M26;
+		d2 += c; c = (uint32_t)(d2 >> 26); h2 = (uint32_t)d2 & M26;
+		d3 += c; c = (uint32_t)(d3 >> 26); h3 = (uint32_t)d3 & M26;
+		d4 += c; c = (uint32_t)(d4 >> 26); h4 = (uint32_t)d4 & M26;
+		h0 += c * 5; c = h0 >> 26; h0 &= M26;
+		h1 += c;
+
+		m += POLY1305_BLOCK_SIZE;
+	}
+
+	ctx->h[0] = h0;
+	ctx->h[1] = h1;
+	ctx->h[2] = h2;
+	ctx->h[3] = h3;
+	ctx->h[4] = h4;
+}
+
+static void poly1305_final(POLY1305_CTX *ctx, uint8_t tag[POLY1305_TAG_SIZE])
+{
+	uint32_t h0 = (uint32_t)ctx->h[0];
+	uint32_t h1 = (uint32_t)ctx->h[1];
+	uint32_t h2 = (uint32_t)ctx->h[2];
+	uint32_t h3 = (uint32_t)ctx->h[3];
+	uint32_t h4 = (uint32_t)ctx->h[4];
+	uint32_t g0, g1, g2, g3, g4, c, mask;
+	uint64_t f;
+
+	// fully carry h
+	c = h1 >> 26; h1 &= M26;
+	h2 += c; c = h2 >> 26; h2 &= M26;
+	h3 += c; c = h3 >> 26; h3 &= M26;
+	h4 += c; c = h4 >> 26; h4 &= M26;
+	h0 += c * 5; c = h0 >> 26; h0 &= M26;
+	h1 += c;
+
+	// g = h - (2^130 - 5), select h if g is negative
+	g0 = h0 + 5; c = g0 >> 26; g0 &= M26;
+	g1 = h1 + c; c = g1 >> 26; g1 &= M26;
+	g2 = h2 + c; c = g2 >> 26; g2 &= M26;
+	g3 = h3 + c; c = g3 >> 26; g3 &= M26;
+	g4 = h4 + c - ((uint32_t)1 << 26);
+
+	mask = (g4 >> 31) - 1;
+	h0 = (h0 & ~mask) | (g0 & mask);
+	h1 = (h1 & ~mask) | (g1 & mask);
+	h2 = (h2 & ~mask) | (g2 & mask);
+	h3 = (h3 & ~mask) | (g3 & mask);
+	h4 = (h4 & ~mask) | (g4 & mask);
+
+	// h mod 2^128 in 32-bit words
+	h0 = h0 | (h1 << 26);
+	h1 = (h1 >>  6) | (h2 << 20);
+	h2 = (h2 >> 12) | (h3 << 14);
+	h3 = (h3 >> 18) | (h4 <<  8);
+
+	// tag = (h + pad) mod 2^128
+	f = (uint64_t)h0 + (uint32_t)ctx->pad[0];		PUTU32_LE(tag     , (uint32_t)f);
+	f = (uint64_t)h1 + (uint32_t)(ctx->pad[0] >> 32) + (f >> 32);	PUTU32_LE(tag +  4, (uint32_t)f);
+	f = (uint64_t)h2 + (uint32_t)ctx->pad[1] + (f >> 32);	PUTU32_LE(tag +  8, (uint32_t)f);
+	f = (uint64_t)h3 + (uint32_t)(ctx->pad[1] >> 32) + (f >> 32);	PUTU32_LE(tag + 12, (uint32_t)f);
+}
+
+#endif
+
+void poly1305_update(POLY1305_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	size_t nblocks, len;
+
+	if (ctx->num) {
+		len = POLY1305_BLOCK_SIZE - ctx->num;
+		if (datalen < len) {
+			memcpy(ctx->block + ctx->num, data, datalen);
+			ctx->num += datalen;
+			return;
+		}
+		memcpy(ctx->block + ctx->num, data, len);
+		poly1305_blocks(ctx, ctx->block, 1, 1);
+		data += len;
+		datalen -= len;
+	}
+
+	nblocks = datalen / POLY1305_BLOCK_SIZE;
+	if (nblocks) {
+		poly1305_blocks(ctx, data, nblocks, 1);
+		len = nblocks * POLY1305_BLOCK_SIZE;
+		data += len;
+		datalen -= len;
+	}
+
+	ctx->num = datalen;
+	if (datalen) {
+		memcpy(ctx->block, data, datalen);
+	}
+}
+
+void poly1305_finish(POLY1305_CTX *ctx, uint8_t tag[POLY1305_TAG_SIZE])
+{
+	if (ctx->num) {
+		ctx->block[ctx->num] = 1;
+		memset(ctx->block + ctx->num + 1, 0, POLY1305_BLOCK_SIZE - ctx->num - 1);
+		poly1305_blocks(ctx, ctx->block, 1, 0);
+	}
+	poly1305_final(ctx, tag);
+	gmssl_secure_clear(ctx, sizeof(*ctx));
+}
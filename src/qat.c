@@ -0,0 +1,1021 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sched.h>
+#include <pthread.h>
+#include <qat/cpa.h>
+#include <qat/cpa_cy_im.h>
+#include <qat/cpa_cy_sym.h>
+#include <qat/cpa_cy_ecsm2.h>
+#include <qat/icp_sal_user.h>
+#include <qat/icp_sal_poll.h>
+#include <qat/qae_mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+#include <gmssl/job.h>
+#include <gmssl/tls.h>
+#include <gmssl/qat.h>
+#include <gmssl/error.h>
+
+
+typedef struct {
+	CpaInstanceHandle handle;
+	int node;
+	int sm2;
+	int sm3;
+	int sm4;
+	Cpa32U meta_size; // of a one-buffer list
+} QAT_INSTANCE;
+
+typedef struct QAT_REQUEST_st QAT_REQUEST;
+
+// a job on the device, with the device memory of its operands
+struct QAT_REQUEST_st {
+	QAT_ENGINE *qat;
+	QAT_INSTANCE *inst;
+	GMSSL_JOB *job;
+	CpaStatus status;
+	CpaBoolean result; // sign, verify or multiply status
+	uint8_t *dma; // 32-byte operands of SM2, or iv and digest of SM3 and SM4
+	size_t dma_size;
+	uint8_t *data;
+	uint8_t *meta;
+	void *session;
+	CpaFlatBuffer flat[5];
+	CpaBufferList list;
+	union {
+		CpaCyEcsm2SignOpData sign;
+		CpaCyEcsm2VerifyOpData verify;
+		CpaCyEcsm2PointMultiplyOpData mul;
+		CpaCySymOpData sym;
+	} op;
+	SM2_CIPHERTEXT ciphertext; // GMSSL_JOB_sm2_decrypt
+	QAT_REQUEST *next;
+};
+
+struct QAT_ENGINE_st {
+	QAT_INSTANCE instances[QAT_MAX_INSTANCES];
+	size_t instances_cnt;
+	size_t next_instance;
+	size_t max_inflight;
+	size_t inflight;
+	GMSSL_JOB *queued;
+	GMSSL_JOB **queued_tail;
+	size_t queued_cnt;
+	QAT_REQUEST *responses; // by the callbacks of the last poll
+	QAT_REQUEST **responses_tail;
+	GMSSL_JOB *finished;
+	GMSSL_JOB **finished_tail;
+	size_t waiting; // submitted without callback and not returned yet
+	pthread_mutex_t mutex;
+	pthread_mutex_t poll_mutex; // an instance is polled by one thread at a time
+};
+
+// icp_sal_userStart() once for the process
+static pthread_mutex_t qat_process_mutex = PTHREAD_MUTEX_INITIALIZER;
+static size_t qat_process_engines = 0;
+
+
+static void *qat_dma_alloc(size_t size, int node)
+{
+	void *ptr;
+	if (!(ptr = qaeMemAllocNUMA(size, node, 64))) {
+		return NULL;
+	}
+	memset(ptr, 0, size);
+	return ptr;
+}
+
+static void qat_dma_free(void *ptr, size_t size)
+{
+	if (ptr) {
+		gmssl_secure_clear(ptr, size);
+		qaeMemFreeNUMA(&ptr);
+	}
+}
+
+static void qat_request_free(QAT_REQUEST *req)
+{
+	if (req->session) {
+		cpaCySymRemoveSession(req->inst->handle, req->session);
+		qaeMemFreeNUMA(&req->session);
+	}
+	qat_dma_free(req->dma, req->dma_size);
+	qat_dma_free(req->data, req->job->inlen);
+	if (req->meta) {
+		qaeMemFreeNUMA((void **)&req->meta);
+	}
+	gmssl_secure_clear(req, sizeof(QAT_REQUEST));
+	free(req);
+}
+
+static void qat_response(QAT_REQUEST *req, CpaStatus status, CpaBoolean result)
+{
+	QAT_ENGINE *qat = req->qat;
+
+	req->status = status;
+	req->result = result;
+	req->next = NULL;
+	pthread_mutex_lock(&qat->mutex);
+	*qat->responses_tail = req;
+	qat->responses_tail = &req->next;
+	pthread_mutex_unlock(&qat->mutex);
+}
+
+static void qat_sm2_sign_cb(void *tag, CpaStatus status, void *op_data, CpaBoolean sign_status,
+	CpaFlatBuffer *r, CpaFlatBuffer *s)
+{
+	qat_response((QAT_REQUEST *)tag, status, sign_status);
+}
+
+static void qat_sm2_verify_cb(void *tag, CpaStatus status, void *op_data, CpaBoolean verify_status)
+{
+	qat_response((QAT_REQUEST *)tag, status, verify_status);
+}
+
+static void qat_sm2_point_mul_cb(void *tag, CpaStatus status, void *op_data, CpaBoolean multiply_status,
+	CpaFlatBuffer *x, CpaFlatBuffer *y)
+{
+	qat_response((QAT_REQUEST *)tag, status, multiply_status);
+}
+
+static void qat_sym_cb(void *tag, CpaStatus status, const CpaCySymOp op_type, void *op_data,
+	CpaBufferList *dst, CpaBoolean verify_result)
+{
+	qat_response((QAT_REQUEST *)tag, status, CPA_TRUE);
+}
+
+static QAT_INSTANCE *qat_select_instance(QAT_ENGINE *qat, int op)
+{
+	size_t i;
+
+	for (i = 0; i < qat->instances_cnt; i++) {
+		QAT_INSTANCE *inst = &qat->instances[(qat->next_instance + i) % qat->instances_cnt];
+		int supported;
+
+		switch (op) {
+		case GMSSL_JOB_sm3_digest:
+			supported = inst->sm3;
+			break;
+		case GMSSL_JOB_sm4_cbc_encrypt:
+		case GMSSL_JOB_sm4_cbc_decrypt:
+		case GMSSL_JOB_sm4_ctr_encrypt:
+			supported = inst->sm4;
+			break;
+		default:
+			supported = inst->sm2;
+		}
+		if (supported) {
+			qat->next_instance = (qat->next_instance + i + 1) % qat->instances_cnt;
+			return inst;
+		}
+	}
+	return NULL;
+}
+
+static void qat_flat(CpaFlatBuffer *flat, uint8_t *data, size_t len)
+{
+	flat->dataLenInBytes = (Cpa32U)len;
+	flat->pData = data;
+}
+
+static int qat_post_sm2_sign(QAT_REQUEST *req)
+{
+	const SM2_KEY *key = (const SM2_KEY *)req->job->key;
+	CpaCyEcsm2SignOpData *op = &req->op.sign;
+	sm2_z256_t k;
+
+	if (!key || !req->job->dgst || !req->job->out) {
+		error_print();
+		return -1;
+	}
+	// k in [1, n - 1]
+	if (sm2_z256_rand_range(k, sm2_z256_order_minus_one()) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_add(k, k, sm2_z256_one());
+	sm2_z256_to_bytes(k, req->dma);
+	memcpy(req->dma + 32, req->job->dgst, 32);
+	sm2_z256_to_bytes(key->private_key, req->dma + 64);
+	gmssl_secure_clear(k, sizeof(k));
+
+	qat_flat(&op->k, req->dma, 32);
+	qat_flat(&op->e, req->dma + 32, 32);
+	qat_flat(&op->d, req->dma + 64, 32);
+	op->fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+	qat_flat(&req->flat[0], req->dma + 96, 32);
+	qat_flat(&req->flat[1], req->dma + 128, 32);
+
+	return cpaCyEcsm2Sign(req->inst->handle, qat_sm2_sign_cb, req, op,
+		&req->result, &req->flat[0], &req->flat[1]);
+}
+
+static int qat_post_sm2_verify(QAT_REQUEST *req)
+{
+	const SM2_KEY *key = (const SM2_KEY *)req->job->key;
+	CpaCyEcsm2VerifyOpData *op = &req->op.verify;
+	SM2_SIGNATURE sig;
+	const uint8_t *p = req->job->in;
+	size_t len = req->job->inlen;
+
+	if (!key || !req->job->dgst || !p
+		|| sm2_signature_from_der(&sig, &p, &len) != 1
+		|| len) {
+		error_print();
+		return -1;
+	}
+	memcpy(req->dma, req->job->dgst, 32);
+	memcpy(req->dma + 32, sig.r, 32);
+	memcpy(req->dma + 64, sig.s, 32);
+	sm2_z256_point_to_bytes(&key->public_key, req->dma + 96);
+
+	qat_flat(&op->e, req->dma, 32);
+	qat_flat(&op->r, req->dma + 32, 32);
+	qat_flat(&op->s, req->dma + 64, 32);
+	qat_flat(&op->xP, req->dma + 96, 32);
+	qat_flat(&op->yP, req->dma + 128, 32);
+	op->fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+
+	return cpaCyEcsm2Verify(req->inst->handle, qat_sm2_verify_cb, req, op, &req->result);
+}
+
+// d * P of the decryption (P = C1) and of the ECDH (P the peer public key)
+static int qat_post_sm2_point_mul(QAT_REQUEST *req)
+{
+	GMSSL_JOB *job = req->job;
+	const SM2_KEY *key = (const SM2_KEY *)job->key;
+	CpaCyEcsm2PointMultiplyOpData *op = &req->op.mul;
+	SM2_Z256_POINT P;
+	const uint8_t *point;
+
+	if (!key || !job->in || !job->out) {
+		error_print();
+		return -1;
+	}
+	if (job->op == GMSSL_JOB_sm2_decrypt) {
+		const uint8_t *p = job->in;
+		size_t len = job->inlen;
+		if (sm2_ciphertext_from_der(&req->ciphertext, &p, &len) != 1 || len) {
+			error_print();
+			return -1;
+		}
+		point = (const uint8_t *)&req->ciphertext.point;
+	} else {
+		if (job->inlen == 65 && job->in[0] == 0x04) {
+			point = job->in + 1;
+		} else if (job->inlen == 64) {
+			point = job->in;
+		} else {
+			error_print();
+			return -1;
+		}
+	}
+	// the device is not given a point off the curve
+	if (sm2_z256_point_from_bytes(&P, point) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_to_bytes(key->private_key, req->dma);
+	memcpy(req->dma + 32, point, 64);
+
+	qat_flat(&op->k, req->dma, 32);
+	qat_flat(&op->x, req->dma + 32, 32);
+	qat_flat(&op->y, req->dma + 64, 32);
+	op->fieldType = CPA_CY_EC_FIELD_TYPE_PRIME;
+	qat_flat(&req->flat[0], req->dma + 96, 32);
+	qat_flat(&req->flat[1], req->dma + 128, 32);
+
+	return cpaCyEcsm2PointMultiply(req->inst->handle, qat_sm2_point_mul_cb, req, op,
+		&req->result, &req->flat[0], &req->flat[1]);
+}
+
+static int qat_post_sym(QAT_REQUEST *req)
+{
+	GMSSL_JOB *job = req->job;
+	CpaCySymSessionSetupData setup;
+	CpaCySymOpData *op = &req->op.sym;
+	Cpa32U session_size;
+	CpaStatus status;
+
+	if (!job->out || !job->in) {
+		error_print();
+		return -1;
+	}
+	memset(&setup, 0, sizeof(setup));
+	setup.sessionPriority = CPA_CY_PRIORITY_NORMAL;
+	if (job->op == GMSSL_JOB_sm3_digest) {
+		setup.symOperation = CPA_CY_SYM_OP_HASH;
+		setup.hashSetupData.hashAlgorithm = CPA_CY_SYM_HASH_SM3;
+		setup.hashSetupData.hashMode = CPA_CY_SYM_HASH_MODE_PLAIN;
+		setup.hashSetupData.digestResultLenInBytes = 32;
+	} else {
+		if (!job->key || !job->iv) {
+			error_print();
+			return -1;
+		}
+		if (job->op != GMSSL_JOB_sm4_ctr_encrypt && job->inlen % SM4_BLOCK_SIZE) {
+			error_print();
+			return -1;
+		}
+		setup.symOperation = CPA_CY_SYM_OP_CIPHER;
+		setup.cipherSetupData.cipherAlgorithm = job->op == GMSSL_JOB_sm4_ctr_encrypt
+			? CPA_CY_SYM_CIPHER_SM4_CTR : CPA_CY_SYM_CIPHER_SM4_CBC;
+		setup.cipherSetupData.cipherKeyLenInBytes = 16;
+		setup.cipherSetupData.pCipherKey = (Cpa8U *)job->key;
+		setup.cipherSetupData.cipherDirection = job->op == GMSSL_JOB_sm4_cbc_decrypt
+			? CPA_CY_SYM_CIPHER_DIRECTION_DECRYPT : CPA_CY_SYM_CIPHER_DIRECTION_ENCRYPT;
+	}
+	if (cpaCySymSessionCtxGetSize(req->inst->handle, &setup, &session_size) != CPA_STATUS_SUCCESS
+		|| !(req->session = qat_dma_alloc(session_size, req->inst->node))) {
+		error_print();
+		return -1;
+	}
+	if (cpaCySymInitSession(req->inst->handle, qat_sym_cb, &setup, req->session) != CPA_STATUS_SUCCESS) {
+		qaeMemFreeNUMA(&req->session);
+		error_print();
+		return -1;
+	}
+	if (!(req->data = qat_dma_alloc(job->inlen, req->inst->node))
+		|| (req->inst->meta_size && !(req->meta = qat_dma_alloc(req->inst->meta_size, req->inst->node)))) {
+		error_print();
+		return -1;
+	}
+	memcpy(req->data, job->in, job->inlen);
+	qat_flat(&req->flat[0], req->data, job->inlen);
+	req->list.numBuffers = 1;
+	req->list.pBuffers = &req->flat[0];
+	req->list.pUserData = NULL;
+	req->list.pPrivateMetaData = req->meta;
+
+	op->sessionCtx = req->session;
+	op->packetType = CPA_CY_SYM_PACKET_TYPE_FULL;
+	if (job->op == GMSSL_JOB_sm3_digest) {
+		op->hashStartSrcOffsetInBytes = 0;
+		op->messageLenToHashInBytes = (Cpa32U)job->inlen;
+		op->pDigestResult = req->dma + 16;
+	} else {
+		memcpy(req->dma, job->iv, 16);
+		op->pIv = req->dma;
+		op->ivLenInBytes = 16;
+		op->cryptoStartSrcOffsetInBytes = 0;
+		op->messageLenToCipherInBytes = (Cpa32U)job->inlen;
+	}
+
+	status = cpaCySymPerformOp(req->inst->handle, req, op, &req->list, &req->list, &req->result);
+	return status;
+}
+
+// return 1 if the job is on the device, 0 if it is to run on the CPU, or CPA_STATUS_RETRY if the rings are full
+static int qat_post(QAT_ENGINE *qat, GMSSL_JOB *job, QAT_INSTANCE *inst)
+{
+	QAT_REQUEST *req;
+	CpaStatus status;
+
+	if (!(req = (QAT_REQUEST *)calloc(1, sizeof(QAT_REQUEST)))) {
+		error_print();
+		return 0;
+	}
+	req->qat = qat;
+	req->inst = inst;
+	req->job = job;
+	req->dma_size = 32 * 5;
+	if (!(req->dma = qat_dma_alloc(req->dma_size, inst->node))) {
+		error_print();
+		free(req);
+		return 0;
+	}
+
+	switch (job->op) {
+	case GMSSL_JOB_sm2_sign:
+		status = qat_post_sm2_sign(req);
+		break;
+	case GMSSL_JOB_sm2_verify:
+		status = qat_post_sm2_verify(req);
+		break;
+	case GMSSL_JOB_sm2_decrypt:
+	case GMSSL_JOB_sm2_ecdh:
+		status = qat_post_sm2_point_mul(req);
+		break;
+	default:
+		status = qat_post_sym(req);
+	}
+	if (status != CPA_STATUS_SUCCESS) {
+		qat_request_free(req);
+		// the CPU tells the malformed jobs from the device errors
+		return status == CPA_STATUS_RETRY ? CPA_STATUS_RETRY : 0;
+	}
+	return 1;
+}
+
+static int qat_result_sm2_decrypt(QAT_REQUEST *req)
+{
+	GMSSL_JOB *job = req->job;
+	const SM2_CIPHERTEXT *c = &req->ciphertext;
+	uint8_t *x2y2 = req->dma + 96; // x2, y2 of d * C1
+	SM3_CTX sm3_ctx;
+	uint8_t hash[32];
+	size_t i;
+	uint8_t nonzero = 0;
+
+	// t = KDF(x2 || y2, klen), not all zeros
+	sm2_kdf(x2y2, 64, c->ciphertext_size, job->out);
+	for (i = 0; i < c->ciphertext_size; i++) {
+		nonzero |= job->out[i];
+	}
+	if (!nonzero) {
+		error_print();
+		return -1;
+	}
+	gmssl_memxor(job->out, job->out, c->ciphertext, c->ciphertext_size);
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, x2y2, 32);
+	sm3_update(&sm3_ctx, job->out, c->ciphertext_size);
+	sm3_update(&sm3_ctx, x2y2 + 32, 32);
+	sm3_finish(&sm3_ctx, hash);
+	if (gmssl_secure_memcmp(hash, c->hash, 32) != 0) {
+		gmssl_secure_clear(job->out, c->ciphertext_size);
+		error_print();
+		return -1;
+	}
+	job->outlen = c->ciphertext_size;
+	return 1;
+}
+
+// the return value of the job, or 0 to run it again on the CPU
+static int qat_result(QAT_REQUEST *req)
+{
+	GMSSL_JOB *job = req->job;
+	SM2_SIGNATURE sig;
+	uint8_t *out;
+
+	if (req->status != CPA_STATUS_SUCCESS) {
+		return 0;
+	}
+	switch (job->op) {
+	case GMSSL_JOB_sm2_sign:
+		if (req->result != CPA_TRUE) {
+			return 0;
+		}
+		memcpy(sig.r, req->dma + 96, 32);
+		memcpy(sig.s, req->dma + 128, 32);
+		out = job->out;
+		job->outlen = 0;
+		if (sm2_signature_to_der(&sig, &out, &job->outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	case GMSSL_JOB_sm2_verify:
+		return req->result == CPA_TRUE ? 1 : -1;
+	case GMSSL_JOB_sm2_decrypt:
+		if (req->result != CPA_TRUE) {
+			return 0;
+		}
+		return qat_result_sm2_decrypt(req);
+	case GMSSL_JOB_sm2_ecdh:
+		if (req->result != CPA_TRUE) {
+			return 0;
+		}
+		memcpy(job->out, req->dma + 96, 64);
+		job->outlen = 64;
+		return 1;
+	case GMSSL_JOB_sm3_digest:
+		memcpy(job->out, req->dma + 16, 32);
+		return 1;
+	}
+	memcpy(job->out, req->data, job->inlen);
+	job->outlen = job->inlen;
+	return 1;
+}
+
+static void qat_finish(QAT_ENGINE *qat, GMSSL_JOB *job)
+{
+	if (job->callback) {
+		job->callback(job);
+		return;
+	}
+	pthread_mutex_lock(&qat->mutex);
+	job->next = NULL;
+	*qat->finished_tail = job;
+	qat->finished_tail = &job->next;
+	pthread_mutex_unlock(&qat->mutex);
+}
+
+// post the queued jobs while there is room on the device, return the number run on the CPU
+static int qat_post_queued(QAT_ENGINE *qat)
+{
+	int finished = 0;
+
+	for (;;) {
+		GMSSL_JOB *jobs = NULL;
+		GMSSL_JOB **jobs_tail = &jobs;
+		GMSSL_JOB *job;
+		size_t room;
+
+		pthread_mutex_lock(&qat->mutex);
+		room = qat->max_inflight - qat->inflight;
+		if (room > QAT_SUBMIT_BATCH) {
+			room = QAT_SUBMIT_BATCH;
+		}
+		while (room && qat->queued) {
+			job = qat->queued;
+			qat->queued = job->next;
+			qat->queued_cnt--;
+			job->next = NULL;
+			*jobs_tail = job;
+			jobs_tail = &job->next;
+			qat->inflight++;
+			room--;
+		}
+		if (!qat->queued) {
+			qat->queued_tail = &qat->queued;
+		}
+		pthread_mutex_unlock(&qat->mutex);
+
+		if (!jobs) {
+			break;
+		}
+		while (jobs) {
+			QAT_INSTANCE *inst;
+			int ret = 0;
+
+			job = jobs;
+			jobs = job->next;
+
+			pthread_mutex_lock(&qat->mutex);
+			inst = qat_select_instance(qat, job->op);
+			pthread_mutex_unlock(&qat->mutex);
+
+			if (inst && job->inlen <= QAT_MAX_BUFFER_SIZE
+				&& !(job->op == GMSSL_JOB_sm3_digest && !job->inlen)) {
+				ret = qat_post(qat, job, inst);
+			}
+			if (ret == 1) {
+				continue;
+			}
+			if (ret == CPA_STATUS_RETRY) {
+				// the rings are full, this job and the rest go back to the head of the queue
+				GMSSL_JOB **tail = &job->next;
+				size_t cnt = 1;
+
+				while (*tail) {
+					tail = &(*tail)->next;
+					cnt++;
+				}
+				pthread_mutex_lock(&qat->mutex);
+				*tail = qat->queued;
+				if (!qat->queued) {
+					qat->queued_tail = tail;
+				}
+				qat->queued = job;
+				qat->queued_cnt += cnt;
+				qat->inflight -= cnt;
+				pthread_mutex_unlock(&qat->mutex);
+				return finished;
+			}
+			job->next = NULL;
+			pthread_mutex_lock(&qat->mutex);
+			qat->inflight--;
+			pthread_mutex_unlock(&qat->mutex);
+			gmssl_job_run(job);
+			qat_finish(qat, job);
+			finished++;
+		}
+	}
+	return finished;
+}
+
+QAT_ENGINE *qat_engine_new(const char *section, size_t max_inflight)
+{
+	QAT_ENGINE *qat;
+	CpaInstanceHandle handles[QAT_MAX_INSTANCES];
+	Cpa16U num = 0;
+	Cpa16U i;
+
+	if (!section) {
+		section = QAT_DEFAULT_SECTION;
+	}
+	if (!max_inflight) {
+		max_inflight = QAT_DEFAULT_MAX_INFLIGHT;
+	}
+	if (!(qat = (QAT_ENGINE *)calloc(1, sizeof(QAT_ENGINE)))) {
+		error_print();
+		return NULL;
+	}
+
+	pthread_mutex_lock(&qat_process_mutex);
+	if (!qat_process_engines && icp_sal_userStart(section) != CPA_STATUS_SUCCESS) {
+		pthread_mutex_unlock(&qat_process_mutex);
+		error_print();
+		free(qat);
+		return NULL;
+	}
+	qat_process_engines++;
+	pthread_mutex_unlock(&qat_process_mutex);
+
+	if (cpaCyGetNumInstances(&num) != CPA_STATUS_SUCCESS || !num) {
+		error_print();
+		goto err;
+	}
+	if (num > QAT_MAX_INSTANCES) {
+		num = QAT_MAX_INSTANCES;
+	}
+	if (cpaCyGetInstances(num, handles) != CPA_STATUS_SUCCESS) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < num; i++) {
+		QAT_INSTANCE *inst = &qat->instances[qat->instances_cnt];
+		CpaInstanceInfo2 info;
+		CpaCyCapabilitiesInfo caps;
+		CpaCySymCapabilitiesInfo sym_caps;
+
+		memset(inst, 0, sizeof(QAT_INSTANCE));
+		inst->handle = handles[i];
+		if (cpaCySetAddressTranslation(inst->handle, qaeVirtToPhysNUMA) != CPA_STATUS_SUCCESS
+			|| cpaCyStartInstance(inst->handle) != CPA_STATUS_SUCCESS) {
+			continue;
+		}
+		if (cpaCyInstanceGetInfo2(inst->handle, &info) == CPA_STATUS_SUCCESS) {
+			inst->node = (int)info.nodeAffinity;
+		}
+		if (cpaCyQueryCapabilities(inst->handle, &caps) == CPA_STATUS_SUCCESS) {
+			inst->sm2 = caps.ecSm2Supported == CPA_TRUE;
+			if (caps.symSupported == CPA_TRUE
+				&& cpaCySymQueryCapabilities(inst->handle, &sym_caps) == CPA_STATUS_SUCCESS) {
+				inst->sm3 = CPA_BITMAP_BIT_TEST(sym_caps.hashes, CPA_CY_SYM_HASH_SM3) ? 1 : 0;
+				inst->sm4 = CPA_BITMAP_BIT_TEST(sym_caps.ciphers, CPA_CY_SYM_CIPHER_SM4_CBC)
+					&& CPA_BITMAP_BIT_TEST(sym_caps.ciphers, CPA_CY_SYM_CIPHER_SM4_CTR) ? 1 : 0;
+			}
+		}
+		if ((inst->sm3 || inst->sm4)
+			&& cpaCyBufferListGetMetaSize(inst->handle, 1, &inst->meta_size) != CPA_STATUS_SUCCESS) {
+			inst->sm3 = inst->sm4 = 0;
+		}
+		if (!inst->sm2 && !inst->sm3 && !inst->sm4) {
+			cpaCyStopInstance(inst->handle);
+			continue;
+		}
+		qat->instances_cnt++;
+	}
+	if (!qat->instances_cnt) {
+		error_print();
+		goto err;
+	}
+
+	qat->max_inflight = max_inflight;
+	qat->queued_tail = &qat->queued;
+	qat->responses_tail = &qat->responses;
+	qat->finished_tail = &qat->finished;
+	pthread_mutex_init(&qat->mutex, NULL);
+	pthread_mutex_init(&qat->poll_mutex, NULL);
+	return qat;
+
+err:
+	pthread_mutex_lock(&qat_process_mutex);
+	if (--qat_process_engines == 0) {
+		icp_sal_userStop();
+	}
+	pthread_mutex_unlock(&qat_process_mutex);
+	free(qat);
+	return NULL;
+}
+
+void qat_engine_free(QAT_ENGINE *qat)
+{
+	GMSSL_JOB *job;
+	size_t i;
+
+	if (!qat) {
+		return;
+	}
+	// finish the jobs in flight so that no response comes after the instances are stopped
+	for (;;) {
+		size_t busy;
+		qat_engine_poll(qat);
+		pthread_mutex_lock(&qat->mutex);
+		busy = qat->inflight + qat->queued_cnt;
+		while ((job = qat->finished) != NULL) {
+			qat->finished = job->next;
+		}
+		qat->finished_tail = &qat->finished;
+		pthread_mutex_unlock(&qat->mutex);
+		if (!busy) {
+			break;
+		}
+		sched_yield();
+	}
+	for (i = 0; i < qat->instances_cnt; i++) {
+		cpaCyStopInstance(qat->instances[i].handle);
+	}
+	pthread_mutex_lock(&qat_process_mutex);
+	if (--qat_process_engines == 0) {
+		icp_sal_userStop();
+	}
+	pthread_mutex_unlock(&qat_process_mutex);
+
+	pthread_mutex_destroy(&qat->mutex);
+	pthread_mutex_destroy(&qat->poll_mutex);
+	free(qat);
+}
+
+size_t qat_engine_instances(const QAT_ENGINE *qat)
+{
+	return qat ? qat->instances_cnt : 0;
+}
+
+int qat_job_submit(QAT_ENGINE *qat, GMSSL_JOB *job)
+{
+	size_t queued;
+
+	if (!qat || !job) {
+		error_print();
+		return -1;
+	}
+	switch (job->op) {
+	case GMSSL_JOB_sm3_digest:
+	case GMSSL_JOB_sm2_sign:
+	case GMSSL_JOB_sm2_verify:
+	case GMSSL_JOB_sm2_decrypt:
+	case GMSSL_JOB_sm2_ecdh:
+	case GMSSL_JOB_sm4_cbc_encrypt:
+	case GMSSL_JOB_sm4_cbc_decrypt:
+	case GMSSL_JOB_sm4_ctr_encrypt:
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+	job->ret = 0;
+	job->next = NULL;
+
+	pthread_mutex_lock(&qat->mutex);
+	if (!job->callback) {
+		qat->waiting++;
+	}
+	*qat->queued_tail = job;
+	qat->queued_tail = &job->next;
+	queued = ++qat->queued_cnt;
+	pthread_mutex_unlock(&qat->mutex);
+
+	if (queued >= QAT_SUBMIT_BATCH) {
+		qat_post_queued(qat);
+	}
+	return 1;
+}
+
+int qat_engine_poll(QAT_ENGINE *qat)
+{
+	QAT_REQUEST *responses;
+	QAT_REQUEST *req;
+	int finished;
+	size_t i;
+
+	if (!qat) {
+		error_print();
+		return -1;
+	}
+	finished = qat_post_queued(qat);
+
+	if (pthread_mutex_trylock(&qat->poll_mutex) == 0) {
+		for (i = 0; i < qat->instances_cnt; i++) {
+			icp_sal_CyPollInstance(qat->instances[i].handle, 0);
+		}
+		pthread_mutex_unlock(&qat->poll_mutex);
+	}
+
+	pthread_mutex_lock(&qat->mutex);
+	responses = qat->responses;
+	qat->responses = NULL;
+	qat->responses_tail = &qat->responses;
+	pthread_mutex_unlock(&qat->mutex);
+
+	while ((req = responses) != NULL) {
+		GMSSL_JOB *job = req->job;
+		int ret;
+
+		responses = req->next;
+		ret = qat_result(req);
+		qat_request_free(req);
+		pthread_mutex_lock(&qat->mutex);
+		qat->inflight--;
+		pthread_mutex_unlock(&qat->mutex);
+
+		if (ret) {
+			job->ret = ret;
+		} else {
+			gmssl_job_run(job);
+		}
+		qat_finish(qat, job);
+		finished++;
+	}
+
+	// the room freed by the responses
+	finished += qat_post_queued(qat);
+	return finished;
+}
+
+int qat_job_poll(QAT_ENGINE *qat, GMSSL_JOB **job)
+{
+	if (!qat || !job) {
+		error_print();
+		return -1;
+	}
+	pthread_mutex_lock(&qat->mutex);
+	if (!qat->finished) {
+		pthread_mutex_unlock(&qat->mutex);
+		qat_engine_poll(qat);
+		pthread_mutex_lock(&qat->mutex);
+	}
+	if (!(*job = qat->finished)) {
+		pthread_mutex_unlock(&qat->mutex);
+		return 0;
+	}
+	qat->finished = (*job)->next;
+	if (!qat->finished) {
+		qat->finished_tail = &qat->finished;
+	}
+	(*job)->next = NULL;
+	qat->waiting--;
+	pthread_mutex_unlock(&qat->mutex);
+	return 1;
+}
+
+int qat_job_wait(QAT_ENGINE *qat, GMSSL_JOB **job)
+{
+	int ret;
+
+	if (!qat || !job) {
+		error_print();
+		return -1;
+	}
+	for (;;) {
+		size_t waiting;
+
+		if ((ret = qat_job_poll(qat, job)) != 0) {
+			return ret;
+		}
+		pthread_mutex_lock(&qat->mutex);
+		waiting = qat->waiting;
+		pthread_mutex_unlock(&qat->mutex);
+		if (!waiting) {
+			return 0;
+		}
+		sched_yield();
+	}
+}
+
+
+// TLS_PRIVATE_KEY_METHOD
+
+typedef struct {
+	GMSSL_JOB job;
+	QAT_ENGINE *qat;
+	SM2_KEY key; // the job outlives a cancelled connection
+	uint8_t in[SM2_MAX_CIPHERTEXT_SIZE];
+	uint8_t dgst[32];
+	uint8_t out[SM2_MAX_SIGNATURE_SIZE > SM2_MAX_PLAINTEXT_SIZE ? SM2_MAX_SIGNATURE_SIZE : SM2_MAX_PLAINTEXT_SIZE];
+	int done;
+	int cancelled;
+} QAT_KEY_JOB;
+
+static void qat_key_job_done(GMSSL_JOB *job)
+{
+	QAT_KEY_JOB *j = (QAT_KEY_JOB *)job->callback_arg;
+	QAT_ENGINE *qat = j->qat;
+	int cancelled;
+
+	pthread_mutex_lock(&qat->mutex);
+	j->done = 1;
+	cancelled = j->cancelled;
+	pthread_mutex_unlock(&qat->mutex);
+
+	if (cancelled) {
+		gmssl_secure_clear(j, sizeof(QAT_KEY_JOB));
+		free(j);
+	}
+}
+
+static int qat_key_job_submit(QAT_ENGINE *qat, QAT_KEY_JOB *j, const SM2_KEY *key, int op, void **job)
+{
+	j->qat = qat;
+	j->key = *key;
+	j->job.op = op;
+	j->job.key = &j->key;
+	j->job.out = j->out;
+	j->job.callback = qat_key_job_done;
+	j->job.callback_arg = j;
+	if (qat_job_submit(qat, &j->job) != 1) {
+		gmssl_secure_clear(j, sizeof(QAT_KEY_JOB));
+		free(j);
+		error_print();
+		return -1;
+	}
+	// a handshake waits for its own job, post it now
+	qat_engine_poll(qat);
+	*job = j;
+	return TLS_ERROR_WANT_ASYNC;
+}
+
+static int qat_key_sign(void *arg, const SM2_KEY *key, const uint8_t dgst[32],
+	uint8_t *sig, size_t *siglen, void **job)
+{
+	QAT_KEY_JOB *j;
+
+	if (!(j = (QAT_KEY_JOB *)calloc(1, sizeof(QAT_KEY_JOB)))) {
+		error_print();
+		return -1;
+	}
+	memcpy(j->dgst, dgst, 32);
+	j->job.dgst = j->dgst;
+	return qat_key_job_submit((QAT_ENGINE *)arg, j, key, GMSSL_JOB_sm2_sign, job);
+}
+
+static int qat_key_decrypt(void *arg, const SM2_KEY *key, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t *outlen, void **job)
+{
+	QAT_KEY_JOB *j;
+
+	if (inlen > SM2_MAX_CIPHERTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!(j = (QAT_KEY_JOB *)calloc(1, sizeof(QAT_KEY_JOB)))) {
+		error_print();
+		return -1;
+	}
+	memcpy(j->in, in, inlen);
+	j->job.in = j->in;
+	j->job.inlen = inlen;
+	return qat_key_job_submit((QAT_ENGINE *)arg, j, key, GMSSL_JOB_sm2_decrypt, job);
+}
+
+static int qat_key_complete(void *arg, void *job, uint8_t *out, size_t *outlen)
+{
+	QAT_ENGINE *qat = (QAT_ENGINE *)arg;
+	QAT_KEY_JOB *j = (QAT_KEY_JOB *)job;
+	int done;
+	int ret;
+
+	qat_engine_poll(qat);
+	pthread_mutex_lock(&qat->mutex);
+	done = j->done;
+	pthread_mutex_unlock(&qat->mutex);
+	if (!done) {
+		return TLS_ERROR_WANT_ASYNC;
+	}
+
+	if ((ret = j->job.ret) == 1) {
+		memcpy(out, j->out, j->job.outlen);
+		*outlen = j->job.outlen;
+	} else {
+		error_print();
+		ret = -1;
+	}
+	gmssl_secure_clear(j, sizeof(QAT_KEY_JOB));
+	free(j);
+	return ret;
+}
+
+static void qat_key_cancel(void *arg, void *job)
+{
+	QAT_ENGINE *qat = (QAT_ENGINE *)arg;
+	QAT_KEY_JOB *j = (QAT_KEY_JOB *)job;
+	int done;
+
+	pthread_mutex_lock(&qat->mutex);
+	done = j->done;
+	j->cancelled = 1;
+	pthread_mutex_unlock(&qat->mutex);
+
+	// otherwise freed by qat_key_job_done()
+	if (done) {
+		gmssl_secure_clear(j, sizeof(QAT_KEY_JOB));
+		free(j);
+	}
+}
+
+void qat_key_method(QAT_ENGINE *qat, TLS_PRIVATE_KEY_METHOD *method)
+{
+	memset(method, 0, sizeof(*method));
+	method->sign = qat_key_sign;
+	method->decrypt = qat_key_decrypt;
+	method->complete = qat_key_complete;
+	method->cancel = qat_key_cancel;
+	method->arg = qat;
+}
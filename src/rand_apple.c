@@ -16,7 +16,7 @@
 #include <Security/Security.h> // clang -framework Security
 
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_get_entropy(uint8_t *buf, size_t len)
 {
 	int errCode;
 	if ((errCode = SecRandomCopyBytes(kSecRandomDefault, len, buf)) != errSecSuccess) {
@@ -0,0 +1,206 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/mem.h>
+#include <gmssl/rand.h>
+#include <gmssl/sm4_rng.h>
+#include <gmssl/error.h>
+#include <gmssl/metrics.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#define RAND_THREAD_LOCAL __declspec(thread)
+#define rand_pool_load(p)	InterlockedCompareExchangePointer((PVOID volatile *)(p), NULL, NULL)
+#define rand_pool_store(p,v)	InterlockedExchangePointer((PVOID volatile *)(p), (PVOID)(v))
+#else
+#include <pthread.h>
+#define RAND_THREAD_LOCAL __thread
+#define rand_pool_load(p)	__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define rand_pool_store(p,v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+
+/*
+ * Every thread has its own SM4_RNG, rand_bytes() only takes entropy from
+ * the OS at (re)seeding. Short requests are served from the output of one
+ * generate call, the served bytes are cleared at once.
+ */
+
+#define RAND_DRBG_BUF_SIZE	1024
+
+typedef struct {
+	SM4_RNG rng;
+	uint8_t buf[RAND_DRBG_BUF_SIZE];
+	size_t buf_left; // unused bytes at the tail of buf
+	uint64_t generated;
+	unsigned int fork_generation;
+	int seeded;
+} RAND_DRBG_STATE;
+
+static RAND_THREAD_LOCAL RAND_DRBG_STATE rand_state;
+
+static volatile unsigned int rand_fork_generation = 0;
+
+static RAND_POOL *rand_hw_pool = NULL;
+
+int rand_set_pool(RAND_POOL *pool)
+{
+	rand_pool_store(&rand_hw_pool, pool);
+	return 1;
+}
+
+// RAND_POOL_MIX_SIZE bytes of the hardware pool, return 0 without a pool
+static int rand_drbg_pool_bytes(uint8_t buf[RAND_POOL_MIX_SIZE])
+{
+	RAND_POOL *pool = (RAND_POOL *)rand_pool_load(&rand_hw_pool);
+
+	if (!pool) {
+		return 0;
+	}
+	if (rand_pool_get(pool, buf, RAND_POOL_MIX_SIZE) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+#ifndef _WIN32
+static void rand_atfork_child(void)
+{
+	rand_fork_generation++;
+}
+
+static pthread_once_t rand_atfork_once = PTHREAD_ONCE_INIT;
+
+static void rand_atfork_init(void)
+{
+	pthread_atfork(NULL, NULL, rand_atfork_child);
+}
+#endif
+
+static int rand_drbg_seed(RAND_DRBG_STATE *state)
+{
+	const char *label = "GmSSL rand_bytes";
+	struct {
+		const void *state;
+		time_t now;
+		unsigned int fork_generation;
+		uint8_t pool_bytes[RAND_POOL_MIX_SIZE];
+	} nonce;
+	int ret;
+
+#ifndef _WIN32
+	pthread_once(&rand_atfork_once, rand_atfork_init);
+#endif
+	memset(&nonce, 0, sizeof(nonce));
+	nonce.state = state;
+	nonce.now = time(NULL);
+	nonce.fork_generation = rand_fork_generation;
+	if (rand_drbg_pool_bytes(nonce.pool_bytes) < 0) {
+		error_print();
+		return -1;
+	}
+
+	// a child process of fork() starts from a new seed, not from the state of the parent
+	if (state->seeded && state->fork_generation == nonce.fork_generation) {
+		ret = sm4_rng_reseed(&state->rng, (uint8_t *)&nonce, sizeof(nonce));
+		METRICS_ADD(METRICS_rand_reseeds, 1);
+	} else {
+		ret = sm4_rng_init(&state->rng, (uint8_t *)&nonce, sizeof(nonce),
+			(uint8_t *)label, strlen(label));
+	}
+	gmssl_secure_clear(nonce.pool_bytes, sizeof(nonce.pool_bytes));
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+
+	gmssl_secure_clear(state->buf, sizeof(state->buf));
+	state->buf_left = 0;
+	state->generated = 0;
+	state->fork_generation = nonce.fork_generation;
+	state->seeded = 1;
+	return 1;
+}
+
+static int rand_drbg_generate(RAND_DRBG_STATE *state, uint8_t *out, size_t outlen)
+{
+	uint8_t addin[RAND_POOL_MIX_SIZE];
+	int addin_ret;
+	int ret;
+
+	if (state->generated >= RAND_DRBG_RESEED_BYTES) {
+		if (rand_drbg_seed(state) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if ((addin_ret = rand_drbg_pool_bytes(addin)) < 0) {
+		error_print();
+		return -1;
+	}
+	ret = sm4_rng_generate(&state->rng, addin_ret ? addin : NULL, addin_ret ? sizeof(addin) : 0, out, outlen);
+	gmssl_secure_clear(addin, sizeof(addin));
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	state->generated += outlen;
+	return 1;
+}
+
+int rand_bytes(uint8_t *buf, size_t len)
+{
+	RAND_DRBG_STATE *state = &rand_state;
+
+	if (!buf || !len) {
+		error_print();
+		return -1;
+	}
+
+	if (!state->seeded || state->fork_generation != rand_fork_generation) {
+		if (rand_drbg_seed(state) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	while (len) {
+		size_t n;
+
+		if (state->buf_left) {
+			uint8_t *p = state->buf + RAND_DRBG_BUF_SIZE - state->buf_left;
+			n = len < state->buf_left ? len : state->buf_left;
+			memcpy(buf, p, n);
+			gmssl_secure_clear(p, n);
+			state->buf_left -= n;
+		} else if (len >= RAND_DRBG_BUF_SIZE) {
+			n = len < SM4_RNG_MAX_GENERATE_SIZE ? len : SM4_RNG_MAX_GENERATE_SIZE;
+			if (rand_drbg_generate(state, buf, n) != 1) {
+				error_print();
+				return -1;
+			}
+		} else {
+			if (rand_drbg_generate(state, state->buf, RAND_DRBG_BUF_SIZE) != 1) {
+				error_print();
+				return -1;
+			}
+			state->buf_left = RAND_DRBG_BUF_SIZE;
+			continue;
+		}
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
@@ -0,0 +1,253 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+typedef HANDLE pool_thread_t;
+typedef LONG64 pool_atomic_t;
+#define pool_mutex_init(m)	InitializeCriticalSection(m)
+#define pool_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pool_mutex_lock(m)	EnterCriticalSection(m)
+#define pool_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pool_cond_init(c)	InitializeConditionVariable(c)
+#define pool_cond_destroy(c)
+#define pool_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pool_cond_signal(c)	WakeConditionVariable(c)
+#define pool_load(p)		InterlockedCompareExchange64((p), 0, 0)
+#define pool_store(p,v)		InterlockedExchange64((p), (v))
+#define pool_fetch_add(p,v)	InterlockedExchangeAdd64((p), (v))
+#define pool_cas(p,e,v)		(InterlockedCompareExchange64((p), (v), (e)) == (e))
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+typedef pthread_t pool_thread_t;
+typedef int64_t pool_atomic_t;
+#define pool_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pool_mutex_lock(m)	pthread_mutex_lock(m)
+#define pool_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pool_cond_init(c)	pthread_cond_init(c, NULL)
+#define pool_cond_destroy(c)	pthread_cond_destroy(c)
+#define pool_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define pool_cond_signal(c)	pthread_cond_signal(c)
+#define pool_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define pool_store(p,v)		__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#define pool_fetch_add(p,v)	__atomic_fetch_add((p), (v), __ATOMIC_ACQ_REL)
+#define pool_cas(p,e,v)		__atomic_compare_exchange_n((p), &(int64_t){(e)}, (v), 0, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE)
+#endif
+
+
+/*
+ * The slots are filled in order by the background thread and read in the
+ * same order. A reader claims its bytes with one atomic add on `taken`, bytes
+ * are cleared as soon as they are copied, and the reader that makes `done`
+ * reach the slot size hands the slot back to the filler. `taken` stays at or
+ * above the slot size while a slot is being filled, so late readers of the
+ * previous round only skip to the next slot, and `round` keeps the readers
+ * from taking a slot left over from the previous round.
+ */
+typedef struct {
+	uint8_t buf[RAND_POOL_SLOT_SIZE];
+	pool_atomic_t taken;
+	pool_atomic_t done;
+	pool_atomic_t full;
+	pool_atomic_t round; // the slot number it was filled as
+} RAND_POOL_SLOT;
+
+struct RAND_POOL_st {
+	RAND_POOL_SLOT slots[RAND_POOL_SLOTS];
+	pool_atomic_t read; // the slot being read, counted from 0
+	int64_t write; // the next slot to fill, only used by the filler
+	RAND_POOL_FILL fill;
+	void *fill_arg;
+	pool_mutex_t mutex;
+	pool_cond_t not_full;
+	int stop;
+	pool_thread_t thread;
+};
+
+static void rand_pool_wake(RAND_POOL *pool)
+{
+	pool_mutex_lock(&pool->mutex);
+	pool_cond_signal(&pool->not_full);
+	pool_mutex_unlock(&pool->mutex);
+}
+
+static void rand_pool_release(RAND_POOL *pool, RAND_POOL_SLOT *slot, size_t len)
+{
+	if (pool_fetch_add(&slot->done, (int64_t)len) + (int64_t)len == RAND_POOL_SLOT_SIZE) {
+		pool_store(&slot->full, 0);
+		rand_pool_wake(pool);
+	}
+}
+
+// return 0 if the pool is empty
+static int rand_pool_take(RAND_POOL *pool, uint8_t *buf, size_t len)
+{
+	for (;;) {
+		int64_t r = pool_load(&pool->read);
+		RAND_POOL_SLOT *slot = &pool->slots[r % RAND_POOL_SLOTS];
+		int64_t claim;
+
+		if (!pool_load(&slot->full) || pool_load(&slot->round) != r) {
+			return 0;
+		}
+		claim = pool_fetch_add(&slot->taken, (int64_t)len);
+		if (claim + (int64_t)len <= RAND_POOL_SLOT_SIZE) {
+			memcpy(buf, slot->buf + claim, len);
+			gmssl_secure_clear(slot->buf + claim, len);
+			rand_pool_release(pool, slot, len);
+			return 1;
+		}
+		// the tail too short for this request is dropped
+		if (claim < RAND_POOL_SLOT_SIZE) {
+			gmssl_secure_clear(slot->buf + claim, RAND_POOL_SLOT_SIZE - (size_t)claim);
+			rand_pool_release(pool, slot, RAND_POOL_SLOT_SIZE - (size_t)claim);
+		}
+		pool_cas(&pool->read, r, r + 1);
+	}
+}
+
+static void rand_pool_run(RAND_POOL *pool)
+{
+	for (;;) {
+		RAND_POOL_SLOT *slot = &pool->slots[pool->write % RAND_POOL_SLOTS];
+
+		pool_mutex_lock(&pool->mutex);
+		while (!pool->stop && pool_load(&slot->full)) {
+			pool_cond_wait(&pool->not_full, &pool->mutex);
+		}
+		if (pool->stop) {
+			pool_mutex_unlock(&pool->mutex);
+			break;
+		}
+		pool_mutex_unlock(&pool->mutex);
+
+		if (pool->fill(pool->fill_arg, slot->buf, RAND_POOL_SLOT_SIZE) != 1) {
+			// wait for the next reader falling back to the device
+			error_print();
+			pool_mutex_lock(&pool->mutex);
+			if (!pool->stop) {
+				pool_cond_wait(&pool->not_full, &pool->mutex);
+			}
+			pool_mutex_unlock(&pool->mutex);
+			continue;
+		}
+		pool_store(&slot->done, 0);
+		pool_store(&slot->taken, 0);
+		pool_store(&slot->round, pool->write);
+		pool_store(&slot->full, 1);
+		pool->write++;
+	}
+}
+
+#ifdef _WIN32
+static unsigned __stdcall rand_pool_thread(void *arg)
+{
+	rand_pool_run((RAND_POOL *)arg);
+	return 0;
+}
+#else
+static void *rand_pool_thread(void *arg)
+{
+	rand_pool_run((RAND_POOL *)arg);
+	return NULL;
+}
+#endif
+
+RAND_POOL *rand_pool_new(RAND_POOL_FILL fill, void *fill_arg)
+{
+	RAND_POOL *pool;
+	size_t i;
+
+	if (!fill) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (RAND_POOL *)calloc(1, sizeof(*pool)))) {
+		error_print();
+		return NULL;
+	}
+	for (i = 0; i < RAND_POOL_SLOTS; i++) {
+		pool->slots[i].taken = RAND_POOL_SLOT_SIZE;
+	}
+	pool->fill = fill;
+	pool->fill_arg = fill_arg;
+	pool_mutex_init(&pool->mutex);
+	pool_cond_init(&pool->not_full);
+
+#ifdef _WIN32
+	if (!(pool->thread = (HANDLE)_beginthreadex(NULL, 0, rand_pool_thread, pool, 0, NULL))) {
+#else
+	if (pthread_create(&pool->thread, NULL, rand_pool_thread, pool) != 0) {
+#endif
+		pool_cond_destroy(&pool->not_full);
+		pool_mutex_destroy(&pool->mutex);
+		free(pool);
+		error_print();
+		return NULL;
+	}
+	return pool;
+}
+
+void rand_pool_free(RAND_POOL *pool)
+{
+	if (!pool) {
+		return;
+	}
+	pool_mutex_lock(&pool->mutex);
+	pool->stop = 1;
+	pool_cond_signal(&pool->not_full);
+	pool_mutex_unlock(&pool->mutex);
+#ifdef _WIN32
+	WaitForSingleObject(pool->thread, INFINITE);
+	CloseHandle(pool->thread);
+#else
+	pthread_join(pool->thread, NULL);
+#endif
+	pool_cond_destroy(&pool->not_full);
+	pool_mutex_destroy(&pool->mutex);
+	gmssl_secure_clear(pool, sizeof(*pool));
+	free(pool);
+}
+
+int rand_pool_get(RAND_POOL *pool, uint8_t *buf, size_t len)
+{
+	if (!pool || !buf || !len) {
+		error_print();
+		return -1;
+	}
+	while (len) {
+		size_t n = len < RAND_POOL_SLOT_SIZE ? len : RAND_POOL_SLOT_SIZE;
+
+		if (rand_pool_take(pool, buf, n) != 1) {
+			// empty, the bytes come from the device in the calling thread
+			rand_pool_wake(pool);
+			if (pool->fill(pool->fill_arg, buf, n) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+		buf += n;
+		len -= n;
+	}
+	return 1;
+}
@@ -16,7 +16,7 @@
 #include <gmssl/error.h>
 
 
-int rand_bytes(uint8_t *buf, size_t len)
+int rand_get_entropy(uint8_t *buf, size_t len)
 {
 	HCRYPTPROV hCryptProv;
 	int ret = -1;
@@ -0,0 +1,263 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <gmssl/safegcd.h>
+
+
+#if defined(__SIZEOF_INT128__)
+
+typedef __int128 int128_t;
+
+#define M62	((uint64_t)0x3fffffffffffffff)
+
+// signed 62-bit limbs, v[4] keeps the sign
+typedef struct {
+	int64_t v[5];
+} SIGNED62;
+
+// transition matrix of 59 divsteps scaled by 2^62
+typedef struct {
+	int64_t u, v, q, r;
+} TRANS2X2;
+
+static void signed62_from_z256(SIGNED62 *r, const uint64_t a[4])
+{
+	r->v[0] = (int64_t)(a[0] & M62);
+	r->v[1] = (int64_t)(((a[0] >> 62) | (a[1] << 2)) & M62);
+	r->v[2] = (int64_t)(((a[1] >> 60) | (a[2] << 4)) & M62);
+	r->v[3] = (int64_t)(((a[2] >> 58) | (a[3] << 6)) & M62);
+	r->v[4] = (int64_t)(a[3] >> 56);
+}
+
+// a should be normalized to [0, modulus)
+static void signed62_to_z256(uint64_t r[4], const SIGNED62 *a)
+{
+	const uint64_t a0 = a->v[0], a1 = a->v[1], a2 = a->v[2], a3 = a->v[3], a4 = a->v[4];
+
+	r[0] = a0 | (a1 << 62);
+	r[1] = (a1 >> 2) | (a2 << 60);
+	r[2] = (a2 >> 4) | (a3 << 58);
+	r[3] = (a3 >> 6) | (a4 << 56);
+}
+
+// zeta = -(delta + 1/2), the divsteps only look at the low bits of f and g
+static int64_t divsteps_59(int64_t zeta, uint64_t f, uint64_t g, TRANS2X2 *t)
+{
+	// identity matrix times 2^3, as 59 steps scale it to 2^62
+	uint64_t u = 8, v = 0, q = 0, r = 8;
+	volatile uint64_t c1, c2;
+	uint64_t mask1, mask2, x, y, z;
+	int i;
+
+	for (i = 3; i < 62; i++) {
+		c1 = (uint64_t)(zeta >> 63);
+		mask1 = c1;
+		c2 = g & 1;
+		mask2 = -c2;
+
+		// conditionally negated f, u, v
+		x = (f ^ mask1) - mask1;
+		y = (u ^ mask1) - mask1;
+		z = (v ^ mask1) - mask1;
+
+		// g, q, r += x, y, z if g is odd
+		g += x & mask2;
+		q += y & mask2;
+		r += z & mask2;
+
+		// swap case: zeta < 0 and g odd
+		mask1 &= mask2;
+		zeta = (zeta ^ (int64_t)mask1) - 1;
+
+		f += g & mask1;
+		u += q & mask1;
+		v += r & mask1;
+
+		g >>= 1;
+		u <<= 1;
+		v <<= 1;
+	}
+
+	t->u = (int64_t)u;
+	t->v = (int64_t)v;
+	t->q = (int64_t)q;
+	t->r = (int64_t)r;
+	return zeta;
+}
+
+// [d, e] = (t * [d, e] + modulus * [md, me]) / 2^62, with md, me making the division exact
+static void update_de_62(SIGNED62 *d, SIGNED62 *e, const TRANS2X2 *t,
+	const SIGNED62 *modulus, uint64_t modulus_inv62)
+{
+	const int64_t d0 = d->v[0], d1 = d->v[1], d2 = d->v[2], d3 = d->v[3], d4 = d->v[4];
+	const int64_t e0 = e->v[0], e1 = e->v[1], e2 = e->v[2], e3 = e->v[3], e4 = e->v[4];
+	const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+	int64_t md, me, sd, se;
+	int128_t cd, ce;
+
+	// add the modulus for the negative d, e to keep the range (-2 * modulus, modulus)
+	sd = d4 >> 63;
+	se = e4 >> 63;
+	md = (u & sd) + (v & se);
+	me = (q & sd) + (r & se);
+
+	cd = (int128_t)u * d0 + (int128_t)v * e0;
+	ce = (int128_t)q * d0 + (int128_t)r * e0;
+
+	md -= (int64_t)((modulus_inv62 * (uint64_t)cd + (uint64_t)md) & M62);
+	me -= (int64_t)((modulus_inv62 * (uint64_t)ce + (uint64_t)me) & M62);
+
+	cd += (int128_t)modulus->v[0] * md;
+	ce += (int128_t)modulus->v[0] * me;
+	cd >>= 62;
+	ce >>= 62;
+
+	cd += (int128_t)u * d1 + (int128_t)v * e1 + (int128_t)modulus->v[1] * md;
+	ce += (int128_t)q * d1 + (int128_t)r * e1 + (int128_t)modulus->v[1] * me;
+	d->v[0] = (int64_t)((uint64_t)cd & M62); cd >>= 62;
+	e->v[0] = (int64_t)((uint64_t)ce & M62); ce >>= 62;
+
+	cd += (int128_t)u * d2 + (int128_t)v * e2 + (int128_t)modulus->v[2] * md;
+	ce += (int128_t)q * d2 + (int128_t)r * e2 + (int128_t)modulus->v[2] * me;
+	d->v[1] = (int64_t)((uint64_t)cd & M62); cd >>= 62;
+	e->v[1] = (int64_t)((uint64_t)ce & M62); ce >>= 62;
+
+	cd += (int128_t)u * d3 + (int128_t)v * e3 + (int128_t)modulus->v[3] * md;
+	ce += (int128_t)q * d3 + (int128_t)r * e3 + (int128_t)modulus->v[3] * me;
+	d->v[2] = (int64_t)((uint64_t)cd & M62); cd >>= 62;
+	e->v[2] = (int64_t)((uint64_t)ce & M62); ce >>= 62;
+
+	cd += (int128_t)u * d4 + (int128_t)v * e4 + (int128_t)modulus->v[4] * md;
+	ce += (int128_t)q * d4 + (int128_t)r * e4 + (int128_t)modulus->v[4] * me;
+	d->v[3] = (int64_t)((uint64_t)cd & M62); cd >>= 62;
+	e->v[3] = (int64_t)((uint64_t)ce & M62); ce >>= 62;
+
+	d->v[4] = (int64_t)cd;
+	e->v[4] = (int64_t)ce;
+}
+
+// [f, g] = t * [f, g] / 2^62, the low 62 bits are zero by the divsteps
+static void update_fg_62(SIGNED62 *f, SIGNED62 *g, const TRANS2X2 *t)
+{
+	const int64_t f0 = f->v[0], f1 = f->v[1], f2 = f->v[2], f3 = f->v[3], f4 = f->v[4];
+	const int64_t g0 = g->v[0], g1 = g->v[1], g2 = g->v[2], g3 = g->v[3], g4 = g->v[4];
+	const int64_t u = t->u, v = t->v, q = t->q, r = t->r;
+	int128_t cf, cg;
+
+	cf = (int128_t)u * f0 + (int128_t)v * g0;
+	cg = (int128_t)q * f0 + (int128_t)r * g0;
+	cf >>= 62;
+	cg >>= 62;
+
+	cf += (int128_t)u * f1 + (int128_t)v * g1;
+	cg += (int128_t)q * f1 + (int128_t)r * g1;
+	f->v[0] = (int64_t)((uint64_t)cf & M62); cf >>= 62;
+	g->v[0] = (int64_t)((uint64_t)cg & M62); cg >>= 62;
+
+	cf += (int128_t)u * f2 + (int128_t)v * g2;
+	cg += (int128_t)q * f2 + (int128_t)r * g2;
+	f->v[1] = (int64_t)((uint64_t)cf & M62); cf >>= 62;
+	g->v[1] = (int64_t)((uint64_t)cg & M62); cg >>= 62;
+
+	cf += (int128_t)u * f3 + (int128_t)v * g3;
+	cg += (int128_t)q * f3 + (int128_t)r * g3;
+	f->v[2] = (int64_t)((uint64_t)cf & M62); cf >>= 62;
+	g->v[2] = (int64_t)((uint64_t)cg & M62); cg >>= 62;
+
+	cf += (int128_t)u * f4 + (int128_t)v * g4;
+	cg += (int128_t)q * f4 + (int128_t)r * g4;
+	f->v[3] = (int64_t)((uint64_t)cf & M62); cf >>= 62;
+	g->v[3] = (int64_t)((uint64_t)cg & M62); cg >>= 62;
+
+	f->v[4] = (int64_t)cf;
+	g->v[4] = (int64_t)cg;
+}
+
+// bring r from (-2 * modulus, modulus) to [0, modulus), negated if sign < 0
+static void normalize_62(SIGNED62 *r, int64_t sign, const SIGNED62 *modulus)
+{
+	const int64_t m62 = (int64_t)M62;
+	int64_t r0 = r->v[0], r1 = r->v[1], r2 = r->v[2], r3 = r->v[3], r4 = r->v[4];
+	volatile int64_t cond_add, cond_negate;
+
+	cond_add = r4 >> 63;
+	r0 += modulus->v[0] & cond_add;
+	r1 += modulus->v[1] & cond_add;
+	r2 += modulus->v[2] & cond_add;
+	r3 += modulus->v[3] & cond_add;
+	r4 += modulus->v[4] & cond_add;
+
+	cond_negate = sign >> 63;
+	r0 = (r0 ^ cond_negate) - cond_negate;
+	r1 = (r1 ^ cond_negate) - cond_negate;
+	r2 = (r2 ^ cond_negate) - cond_negate;
+	r3 = (r3 ^ cond_negate) - cond_negate;
+	r4 = (r4 ^ cond_negate) - cond_negate;
+
+	r1 += r0 >> 62; r0 &= m62;
+	r2 += r1 >> 62; r1 &= m62;
+	r3 += r2 >> 62; r2 &= m62;
+	r4 += r3 >> 62; r3 &= m62;
+
+	cond_add = r4 >> 63;
+	r0 += modulus->v[0] & cond_add;
+	r1 += modulus->v[1] & cond_add;
+	r2 += modulus->v[2] & cond_add;
+	r3 += modulus->v[3] & cond_add;
+	r4 += modulus->v[4] & cond_add;
+
+	r1 += r0 >> 62; r0 &= m62;
+	r2 += r1 >> 62; r1 &= m62;
+	r3 += r2 >> 62; r2 &= m62;
+	r4 += r3 >> 62; r3 &= m62;
+
+	r->v[0] = r0;
+	r->v[1] = r1;
+	r->v[2] = r2;
+	r->v[3] = r3;
+	r->v[4] = r4;
+}
+
+void safegcd_z256_inv(uint64_t r[4], const uint64_t a[4], const uint64_t modulus[4])
+{
+	SIGNED62 m;
+	SIGNED62 d = {{0, 0, 0, 0, 0}};
+	SIGNED62 e = {{1, 0, 0, 0, 0}};
+	SIGNED62 f;
+	SIGNED62 g;
+	TRANS2X2 t;
+	uint64_t modulus_inv62;
+	int64_t zeta = -1;
+	int i;
+
+	// modulus^-1 mod 2^64 by Newton iteration, each step doubles the correct bits
+	modulus_inv62 = modulus[0];
+	for (i = 0; i < 5; i++) {
+		modulus_inv62 *= 2 - modulus[0] * modulus_inv62;
+	}
+	modulus_inv62 &= M62;
+
+	signed62_from_z256(&m, modulus);
+	f = m;
+	signed62_from_z256(&g, a);
+
+	for (i = 0; i < 10; i++) {
+		zeta = divsteps_59(zeta, (uint64_t)f.v[0], (uint64_t)g.v[0], &t);
+		update_de_62(&d, &e, &t, &m, modulus_inv62);
+		update_fg_62(&f, &g, &t);
+	}
+
+	// g = 0 and f = +/- gcd = +/- 1, d = +/- a^-1
+	normalize_62(&d, f.v[4], &m);
+	signed62_to_z256(r, &d);
+}
+
+#endif
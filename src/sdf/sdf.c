@@ -13,11 +13,40 @@
 #include <stdlib.h>
 #include <gmssl/sdf.h>
 #include <gmssl/sm2.h>
+#include <gmssl/mem.h>
+#include <gmssl/asn1.h>
 #include <gmssl/error.h>
 #include "sdf.h"
 #include "sdf_ext.h"
 
 
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+#define pool_mutex_init(m)	InitializeCriticalSection(m)
+#define pool_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pool_mutex_lock(m)	EnterCriticalSection(m)
+#define pool_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pool_cond_init(c)	InitializeConditionVariable(c)
+#define pool_cond_destroy(c)
+#define pool_cond_wait(c,m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pool_cond_signal(c)	WakeConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+#define pool_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pool_mutex_lock(m)	pthread_mutex_lock(m)
+#define pool_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pool_cond_init(c)	pthread_cond_init(c, NULL)
+#define pool_cond_destroy(c)	pthread_cond_destroy(c)
+#define pool_cond_wait(c,m)	pthread_cond_wait(c, m)
+#define pool_cond_signal(c)	pthread_cond_signal(c)
+#endif
+
+
 
 static const uint8_t zeros[ECCref_MAX_LEN - 32] = {0};
 
@@ -144,6 +173,11 @@ end:
 	return ret;
 }
 
+int sdf_rand_pool_fill(void *dev, uint8_t *buf, size_t len)
+{
+	return sdf_rand_bytes((SDF_DEVICE *)dev, buf, len);
+}
+
 int sdf_load_sign_key(SDF_DEVICE *dev, SDF_KEY *key, int index, const char *pass)
 {
 	int ret = -1;
@@ -220,3 +254,400 @@ int sdf_close_device(SDF_DEVICE *dev)
 	memset(dev, 0, sizeof(SDF_DEVICE));
 	return 1;
 }
+
+
+// session == NULL if the session is closed and not reopened yet
+typedef struct {
+	void *session;
+	void *sm4_key;
+} SDF_POOL_SESSION;
+
+/*
+ * The idle sessions are a stack idle[0..idle_count), a session taken from the
+ * stack is only used by the taking thread until it is pushed back, so the
+ * device calls run without the lock.
+ */
+struct SDF_POOL_st {
+	void *device;
+	unsigned int index;
+	unsigned char pass[SDF_POOL_MAX_PASS_SIZE];
+	unsigned int passlen;
+	SM2_KEY public_key;
+	int has_sm4_key;
+	ECCCipher sm4_key; // wrapped by the encryption public key
+	SDF_POOL_SESSION *sessions;
+	size_t sessions_count;
+	size_t *idle;
+	size_t idle_count;
+	pool_mutex_t mutex;
+	pool_cond_t cond;
+};
+
+static void sdf_pool_session_close(SDF_POOL *pool, SDF_POOL_SESSION *s)
+{
+	if (s->session) {
+		if (s->sm4_key) {
+			SDF_DestroyKey(s->session, s->sm4_key);
+		}
+		SDF_ReleasePrivateKeyAccessRight(s->session, pool->index);
+		SDF_CloseSession(s->session);
+	}
+	s->session = NULL;
+	s->sm4_key = NULL;
+}
+
+static int sdf_pool_session_open(SDF_POOL *pool, SDF_POOL_SESSION *s)
+{
+	int rv;
+
+	if ((rv = SDF_OpenSession(pool->device, &s->session)) != SDR_OK) {
+		error_print_msg("SDF library: 0x%08X\n", rv);
+		s->session = NULL;
+		return -1;
+	}
+	if ((rv = SDF_GetPrivateKeyAccessRight(s->session, pool->index, pool->pass, pool->passlen)) != SDR_OK
+		|| (pool->has_sm4_key
+			&& (rv = SDF_ImportKeyWithISK_ECC(s->session, pool->index, &pool->sm4_key, &s->sm4_key)) != SDR_OK)) {
+		error_print_msg("SDF library: 0x%08X\n", rv);
+		sdf_pool_session_close(pool, s);
+		return -1;
+	}
+	return 1;
+}
+
+// the device info query is the cheapest call expected to work on every device
+static int sdf_pool_session_alive(SDF_POOL_SESSION *s)
+{
+	DEVICEINFO devInfo;
+
+	if (!s->session || SDF_GetDeviceInfo(s->session, &devInfo) != SDR_OK) {
+		return 0;
+	}
+	return 1;
+}
+
+static SDF_POOL_SESSION *sdf_pool_acquire(SDF_POOL *pool)
+{
+	SDF_POOL_SESSION *s;
+
+	pool_mutex_lock(&pool->mutex);
+	while (!pool->idle_count) {
+		pool_cond_wait(&pool->cond, &pool->mutex);
+	}
+	s = &pool->sessions[pool->idle[--pool->idle_count]];
+	pool_mutex_unlock(&pool->mutex);
+	return s;
+}
+
+static void sdf_pool_release(SDF_POOL *pool, SDF_POOL_SESSION *s)
+{
+	pool_mutex_lock(&pool->mutex);
+	pool->idle[pool->idle_count++] = (size_t)(s - pool->sessions);
+	pool_cond_signal(&pool->cond);
+	pool_mutex_unlock(&pool->mutex);
+}
+
+typedef int (*SDF_POOL_FUNC)(SDF_POOL *pool, SDF_POOL_SESSION *s, void *args);
+
+// run `func` on an idle session, reopen the session and retry once if the session is dead
+static int sdf_pool_call(SDF_POOL *pool, SDF_POOL_FUNC func, void *args)
+{
+	SDF_POOL_SESSION *s = sdf_pool_acquire(pool);
+	int rv = -1;
+
+	if (!s->session && sdf_pool_session_open(pool, s) != 1) {
+		error_print();
+		goto end;
+	}
+	if ((rv = func(pool, s, args)) == SDR_OK) {
+		goto end;
+	}
+	if (sdf_pool_session_alive(s)) {
+		error_print_msg("SDF library: 0x%08X\n", rv);
+		goto end;
+	}
+	sdf_pool_session_close(pool, s);
+	if (sdf_pool_session_open(pool, s) != 1) {
+		error_print();
+		rv = -1;
+		goto end;
+	}
+	if ((rv = func(pool, s, args)) != SDR_OK) {
+		error_print_msg("SDF library: 0x%08X\n", rv);
+	}
+end:
+	sdf_pool_release(pool, s);
+	return rv == SDR_OK ? 1 : -1;
+}
+
+SDF_POOL *sdf_pool_new(SDF_DEVICE *dev, int index, const char *pass, const uint8_t sm4_key[16], size_t sessions)
+{
+	SDF_POOL *pool = NULL;
+	void *hSession = NULL;
+	ECCrefPublicKey eccPublicKey;
+	size_t passlen;
+	size_t i;
+	int rv;
+
+	if (!dev || !pass) {
+		error_print();
+		return NULL;
+	}
+	if (index < 0 || (passlen = strlen(pass)) > SDF_POOL_MAX_PASS_SIZE) {
+		error_print();
+		return NULL;
+	}
+	if (!sessions || sessions > SDF_POOL_MAX_SESSIONS) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (SDF_POOL *)calloc(1, sizeof(SDF_POOL)))) {
+		error_print();
+		return NULL;
+	}
+	pool_mutex_init(&pool->mutex);
+	pool_cond_init(&pool->cond);
+	if (!(pool->sessions = (SDF_POOL_SESSION *)calloc(sessions, sizeof(SDF_POOL_SESSION)))
+		|| !(pool->idle = (size_t *)calloc(sessions, sizeof(size_t)))) {
+		error_print();
+		goto err;
+	}
+	pool->device = dev->handle;
+	pool->index = (unsigned int)index;
+	memcpy(pool->pass, pass, passlen);
+	pool->passlen = (unsigned int)passlen;
+	pool->sessions_count = sessions;
+
+	if ((rv = SDF_OpenSession(pool->device, &hSession)) != SDR_OK
+		|| (rv = SDF_ExportSignPublicKey_ECC(hSession, pool->index, &eccPublicKey)) != SDR_OK
+		|| (sm4_key && (rv = SDF_InternalEncrypt_ECC(hSession, pool->index, SGD_SM2_3,
+			(unsigned char *)sm4_key, 16, &pool->sm4_key)) != SDR_OK)) {
+		error_print_msg("SDF library: 0x%08X\n", rv);
+		goto err;
+	}
+	if (SDF_ECCrefPublicKey_to_SM2_KEY(&eccPublicKey, &pool->public_key) != SDR_OK) {
+		error_print();
+		goto err;
+	}
+	pool->has_sm4_key = sm4_key ? 1 : 0;
+	SDF_CloseSession(hSession);
+	hSession = NULL;
+
+	for (i = 0; i < sessions; i++) {
+		if (sdf_pool_session_open(pool, &pool->sessions[i]) != 1) {
+			error_print();
+			goto err;
+		}
+		pool->idle[i] = i;
+	}
+	pool->idle_count = sessions;
+	return pool;
+
+err:
+	if (hSession) SDF_CloseSession(hSession);
+	sdf_pool_free(pool);
+	return NULL;
+}
+
+int sdf_pool_get_public_key(const SDF_POOL *pool, SM2_KEY *public_key)
+{
+	if (!pool || !public_key) {
+		error_print();
+		return -1;
+	}
+	*public_key = pool->public_key;
+	return 1;
+}
+
+static int sdf_pool_sign_func(SDF_POOL *pool, SDF_POOL_SESSION *s, void *args)
+{
+	void **argv = (void **)args;
+	return SDF_InternalSign_ECC(s->session, pool->index, (unsigned char *)argv[0], 32, (ECCSignature *)argv[1]);
+}
+
+int sdf_pool_sign(SDF_POOL *pool, const uint8_t dgst[32], uint8_t *sig, size_t *siglen)
+{
+	ECCSignature ecc_sig;
+	SM2_SIGNATURE sm2_sig;
+	void *args[2];
+
+	if (!pool || !dgst || !sig || !siglen) {
+		error_print();
+		return -1;
+	}
+	args[0] = (void *)dgst;
+	args[1] = &ecc_sig;
+	if (sdf_pool_call(pool, sdf_pool_sign_func, args) != 1
+		|| SDF_ECCSignature_to_SM2_SIGNATURE(&ecc_sig, &sm2_sig) != SDR_OK) {
+		error_print();
+		return -1;
+	}
+	*siglen = 0;
+	if (sm2_signature_to_der(&sm2_sig, &sig, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int sdf_pool_decrypt_func(SDF_POOL *pool, SDF_POOL_SESSION *s, void *args)
+{
+	void **argv = (void **)args;
+	return SDF_InternalDecrypt_ECC(s->session, pool->index, SGD_SM2_3,
+		(ECCCipher *)argv[0], (unsigned char *)argv[1], (unsigned int *)argv[2]);
+}
+
+int sdf_pool_decrypt(SDF_POOL *pool, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	SM2_CIPHERTEXT c;
+	ECCCipher eccCipher;
+	unsigned int len = SM2_MAX_PLAINTEXT_SIZE;
+	void *args[3];
+
+	if (!pool || !in || !inlen || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (sm2_ciphertext_from_der(&c, &in, &inlen) != 1
+		|| asn1_length_is_zero(inlen) != 1) {
+		error_print();
+		return -1;
+	}
+	memset(&eccCipher, 0, sizeof(eccCipher));
+	memcpy(eccCipher.x + ECCref_MAX_LEN - 32, c.point.x, 32);
+	memcpy(eccCipher.y + ECCref_MAX_LEN - 32, c.point.y, 32);
+	memcpy(eccCipher.M, c.hash, 32);
+	memcpy(eccCipher.C, c.ciphertext, c.ciphertext_size);
+	eccCipher.L = (unsigned int)c.ciphertext_size;
+
+	args[0] = &eccCipher;
+	args[1] = out;
+	args[2] = &len;
+	if (sdf_pool_call(pool, sdf_pool_decrypt_func, args) != 1) {
+		error_print();
+		return -1;
+	}
+	*outlen = len;
+	return 1;
+}
+
+static int sdf_pool_sm4_encrypt_func(SDF_POOL *pool, SDF_POOL_SESSION *s, void *args)
+{
+	void **argv = (void **)args;
+	size_t *nbytes = (size_t *)argv[3];
+	unsigned int outlen = (unsigned int)*nbytes;
+	return SDF_Encrypt(s->session, s->sm4_key, SGD_SM4_CBC, (unsigned char *)argv[0],
+		(unsigned char *)argv[1], (unsigned int)*nbytes, (unsigned char *)argv[2], &outlen);
+}
+
+static int sdf_pool_sm4_decrypt_func(SDF_POOL *pool, SDF_POOL_SESSION *s, void *args)
+{
+	void **argv = (void **)args;
+	size_t *nbytes = (size_t *)argv[3];
+	unsigned int outlen = (unsigned int)*nbytes;
+	return SDF_Decrypt(s->session, s->sm4_key, SGD_SM4_CBC, (unsigned char *)argv[0],
+		(unsigned char *)argv[1], (unsigned int)*nbytes, (unsigned char *)argv[2], &outlen);
+}
+
+// the device may update the IV, a copy is passed so that a retry starts from the caller's IV
+static int sdf_pool_sm4_cbc_blocks(SDF_POOL *pool, SDF_POOL_FUNC func,
+	const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t ivbuf[16];
+	size_t nbytes = nblocks * 16;
+	void *args[4];
+	int ret;
+
+	if (!pool || !iv || !in || !nblocks || !out) {
+		error_print();
+		return -1;
+	}
+	if (!pool->has_sm4_key) {
+		error_print();
+		return -1;
+	}
+	if (nblocks > UINT32_MAX / 16) {
+		error_print();
+		return -1;
+	}
+	memcpy(ivbuf, iv, 16);
+	args[0] = ivbuf;
+	args[1] = (void *)in;
+	args[2] = out;
+	args[3] = &nbytes;
+	ret = sdf_pool_call(pool, func, args);
+	gmssl_secure_clear(ivbuf, sizeof(ivbuf));
+	return ret;
+}
+
+int sdf_pool_sm4_cbc_encrypt_blocks(SDF_POOL *pool, const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	return sdf_pool_sm4_cbc_blocks(pool, sdf_pool_sm4_encrypt_func, iv, in, nblocks, out);
+}
+
+int sdf_pool_sm4_cbc_decrypt_blocks(SDF_POOL *pool, const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	return sdf_pool_sm4_cbc_blocks(pool, sdf_pool_sm4_decrypt_func, iv, in, nblocks, out);
+}
+
+int sdf_pool_check(SDF_POOL *pool)
+{
+	size_t *idle;
+	size_t count;
+	size_t i;
+	int ret = 1;
+
+	if (!pool) {
+		error_print();
+		return -1;
+	}
+	if (!(idle = (size_t *)malloc(pool->sessions_count * sizeof(size_t)))) {
+		error_print();
+		return -1;
+	}
+
+	// take out the idle sessions, the busy ones are checked by their next call
+	pool_mutex_lock(&pool->mutex);
+	count = pool->idle_count;
+	memcpy(idle, pool->idle, count * sizeof(size_t));
+	pool->idle_count = 0;
+	pool_mutex_unlock(&pool->mutex);
+
+	for (i = 0; i < count; i++) {
+		SDF_POOL_SESSION *s = &pool->sessions[idle[i]];
+		if (!sdf_pool_session_alive(s)) {
+			sdf_pool_session_close(pool, s);
+			if (sdf_pool_session_open(pool, s) != 1) {
+				error_print();
+				ret = -1;
+			}
+		}
+	}
+
+	for (i = 0; i < count; i++) {
+		sdf_pool_release(pool, &pool->sessions[idle[i]]);
+	}
+	free(idle);
+	return ret;
+}
+
+// all the sessions must be idle
+void sdf_pool_free(SDF_POOL *pool)
+{
+	size_t i;
+
+	if (!pool) {
+		return;
+	}
+	if (pool->sessions) {
+		for (i = 0; i < pool->sessions_count; i++) {
+			sdf_pool_session_close(pool, &pool->sessions[i]);
+		}
+		free(pool->sessions);
+	}
+	if (pool->idle) free(pool->idle);
+	pool_cond_destroy(&pool->cond);
+	pool_mutex_destroy(&pool->mutex);
+	gmssl_secure_clear(pool, sizeof(SDF_POOL));
+	free(pool);
+}
@@ -0,0 +1,127 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sdf.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK dispatch_lock = SRWLOCK_INIT;
+#define dispatch_mutex_lock()	AcquireSRWLockExclusive(&dispatch_lock)
+#define dispatch_mutex_unlock()	ReleaseSRWLockExclusive(&dispatch_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t dispatch_lock = PTHREAD_MUTEX_INITIALIZER;
+#define dispatch_mutex_lock()	pthread_mutex_lock(&dispatch_lock)
+#define dispatch_mutex_unlock()	pthread_mutex_unlock(&dispatch_lock)
+#endif
+
+
+static SDF_DISPATCH_POLICY dispatch_policy = {
+	SDF_DISPATCH_DEFAULT_SM3_MIN_SIZE,
+	SDF_DISPATCH_DEFAULT_SM4_MIN_SIZE,
+	0,
+	SDF_DISPATCH_DEFAULT_MAX_INFLIGHT,
+};
+static size_t dispatch_inflight = 0;
+static size_t dispatch_cpu = 0;
+static size_t dispatch_device = 0;
+static size_t dispatch_spilled = 0;
+
+
+int sdf_dispatch_set_policy(const SDF_DISPATCH_POLICY *policy)
+{
+	if (!policy) {
+		error_print();
+		return -1;
+	}
+	dispatch_mutex_lock();
+	dispatch_policy = *policy;
+	dispatch_mutex_unlock();
+	return 1;
+}
+
+void sdf_dispatch_get_policy(SDF_DISPATCH_POLICY *policy)
+{
+	dispatch_mutex_lock();
+	*policy = dispatch_policy;
+	dispatch_mutex_unlock();
+}
+
+int sdf_dispatch_begin(int op, size_t len)
+{
+	int device;
+	int keep = 0; // the key is on the device
+
+	dispatch_mutex_lock();
+	switch (op) {
+	case SDF_DISPATCH_sm3:
+		device = len >= dispatch_policy.sm3_device_min_size;
+		break;
+	case SDF_DISPATCH_sm4_cbc:
+		device = len >= dispatch_policy.sm4_device_min_size;
+		break;
+	case SDF_DISPATCH_sm2_verify:
+	case SDF_DISPATCH_sm2_encrypt:
+		device = dispatch_policy.sm2_public_on_device;
+		break;
+	case SDF_DISPATCH_sm2_sign:
+	case SDF_DISPATCH_sm2_decrypt:
+		device = keep = 1;
+		break;
+	default:
+		dispatch_mutex_unlock();
+		error_print();
+		return -1;
+	}
+	if (device && !keep && dispatch_policy.device_max_inflight
+		&& dispatch_inflight >= dispatch_policy.device_max_inflight) {
+		dispatch_spilled++;
+		device = 0;
+	}
+	if (device) {
+		dispatch_inflight++;
+		dispatch_device++;
+	} else {
+		dispatch_cpu++;
+	}
+	dispatch_mutex_unlock();
+	return device ? 1 : 0;
+}
+
+void sdf_dispatch_end(void)
+{
+	dispatch_mutex_lock();
+	if (dispatch_inflight) {
+		dispatch_inflight--;
+	}
+	dispatch_mutex_unlock();
+}
+
+void sdf_dispatch_get_stats(size_t *cpu, size_t *device, size_t *spilled)
+{
+	dispatch_mutex_lock();
+	if (cpu) *cpu = dispatch_cpu;
+	if (device) *device = dispatch_device;
+	if (spilled) *spilled = dispatch_spilled;
+	dispatch_mutex_unlock();
+}
+
+void sdf_dispatch_reset_stats(void)
+{
+	dispatch_mutex_lock();
+	dispatch_cpu = 0;
+	dispatch_device = 0;
+	dispatch_spilled = 0;
+	dispatch_mutex_unlock();
+}
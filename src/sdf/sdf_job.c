@@ -0,0 +1,360 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sdf.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION job_mutex_t;
+typedef CONDITION_VARIABLE job_cond_t;
+typedef HANDLE job_thread_t;
+#define job_mutex_init(m)	InitializeCriticalSection(m)
+#define job_mutex_destroy(m)	DeleteCriticalSection(m)
+#define job_mutex_lock(m)	EnterCriticalSection(m)
+#define job_mutex_unlock(m)	LeaveCriticalSection(m)
+#define job_cond_init(c)	InitializeConditionVariable(c)
+#define job_cond_destroy(c)
+#define job_cond_wait(c,m)	SleepConditionVariableCS(c, m, INFINITE)
+#define job_cond_signal(c)	WakeConditionVariable(c)
+#define job_cond_broadcast(c)	WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t job_mutex_t;
+typedef pthread_cond_t job_cond_t;
+typedef pthread_t job_thread_t;
+#define job_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define job_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define job_mutex_lock(m)	pthread_mutex_lock(m)
+#define job_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define job_cond_init(c)	pthread_cond_init(c, NULL)
+#define job_cond_destroy(c)	pthread_cond_destroy(c)
+#define job_cond_wait(c,m)	pthread_cond_wait(c, m)
+#define job_cond_signal(c)	pthread_cond_signal(c)
+#define job_cond_broadcast(c)	pthread_cond_broadcast(c)
+#endif
+
+
+// staging buffers of a worker for the jobs with more than one input or output buffer
+typedef struct {
+	SDF_JOB_QUEUE *queue;
+	job_thread_t thread;
+	int started;
+	uint8_t *in;
+	uint8_t *out;
+	size_t size;
+} SDF_JOB_WORKER;
+
+struct SDF_JOB_QUEUE_st {
+	SDF_POOL *pool;
+	job_mutex_t mutex;
+	job_cond_t submitted;
+	job_cond_t completed;
+	SDF_JOB *head; // submitted, first in first out
+	SDF_JOB *tail;
+	SDF_JOB *done_head; // completed without callback
+	SDF_JOB *done_tail;
+	size_t pending; // submitted and not completed
+	int stopping;
+	SDF_JOB_WORKER *workers;
+	size_t workers_cnt;
+};
+
+static size_t sdf_iovec_total(const SDF_IOVEC *iov, size_t cnt)
+{
+	size_t len = 0;
+	size_t i;
+	for (i = 0; i < cnt; i++) {
+		len += iov[i].len;
+	}
+	return len;
+}
+
+static int sdf_job_run(SDF_JOB_WORKER *worker, SDF_JOB *job)
+{
+	size_t len = sdf_iovec_total(job->in, job->in_cnt);
+	uint8_t *in;
+	uint8_t *out;
+	size_t i;
+	int ret;
+
+	if (!len || len % 16 || len > SDF_JOB_MAX_SIZE
+		|| sdf_iovec_total(job->out, job->out_cnt) < len) {
+		error_print();
+		return -1;
+	}
+	if ((job->in_cnt > 1 || job->out_cnt > 1) && worker->size < len) {
+		uint8_t *p;
+		if (!(p = (uint8_t *)realloc(worker->in, len))) {
+			error_print();
+			return -1;
+		}
+		worker->in = p;
+		if (!(p = (uint8_t *)realloc(worker->out, len))) {
+			error_print();
+			return -1;
+		}
+		worker->out = p;
+		worker->size = len;
+	}
+
+	// gather
+	if (job->in_cnt == 1) {
+		in = job->in[0].base;
+	} else {
+		uint8_t *p = worker->in;
+		for (i = 0; i < job->in_cnt; i++) {
+			memcpy(p, job->in[i].base, job->in[i].len);
+			p += job->in[i].len;
+		}
+		in = worker->in;
+	}
+	out = job->out_cnt == 1 ? job->out[0].base : worker->out;
+
+	switch (job->op) {
+	case SDF_JOB_sm4_cbc_encrypt:
+		ret = sdf_pool_sm4_cbc_encrypt_blocks(worker->queue->pool, job->iv, in, len/16, out);
+		break;
+	case SDF_JOB_sm4_cbc_decrypt:
+		ret = sdf_pool_sm4_cbc_decrypt_blocks(worker->queue->pool, job->iv, in, len/16, out);
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+
+	// scatter, the staging buffers may hold plaintext
+	if (out == worker->out) {
+		const uint8_t *p = worker->out;
+		size_t left = len;
+		for (i = 0; i < job->out_cnt && left; i++) {
+			size_t n = job->out[i].len < left ? job->out[i].len : left;
+			memcpy(job->out[i].base, p, n);
+			p += n;
+			left -= n;
+		}
+		gmssl_secure_clear(worker->out, len);
+	}
+	if (in == worker->in) {
+		gmssl_secure_clear(worker->in, len);
+	}
+	return 1;
+}
+
+static void sdf_job_worker(SDF_JOB_WORKER *worker)
+{
+	SDF_JOB_QUEUE *queue = worker->queue;
+	SDF_JOB *job;
+	int callback;
+
+	for (;;) {
+		job_mutex_lock(&queue->mutex);
+		while (!queue->head && !queue->stopping) {
+			job_cond_wait(&queue->submitted, &queue->mutex);
+		}
+		if (!(job = queue->head)) {
+			job_mutex_unlock(&queue->mutex);
+			break;
+		}
+		if (!(queue->head = job->next)) {
+			queue->tail = NULL;
+		}
+		job->next = NULL;
+		job_mutex_unlock(&queue->mutex);
+
+		// the callback may release the job
+		job->status = sdf_job_run(worker, job) == 1 ? 1 : -1;
+		if ((callback = job->callback ? 1 : 0) != 0) {
+			job->callback(job);
+		}
+
+		job_mutex_lock(&queue->mutex);
+		if (!callback) {
+			if (queue->done_tail) queue->done_tail->next = job;
+			else queue->done_head = job;
+			queue->done_tail = job;
+		}
+		queue->pending--;
+		job_cond_broadcast(&queue->completed);
+		job_mutex_unlock(&queue->mutex);
+	}
+}
+
+#ifdef _WIN32
+static DWORD WINAPI sdf_job_thread(LPVOID arg)
+{
+	sdf_job_worker((SDF_JOB_WORKER *)arg);
+	return 0;
+}
+
+static int sdf_job_thread_start(SDF_JOB_WORKER *worker)
+{
+	if (!(worker->thread = CreateThread(NULL, 0, sdf_job_thread, worker, 0, NULL))) {
+		return -1;
+	}
+	return 1;
+}
+
+static void sdf_job_thread_join(SDF_JOB_WORKER *worker)
+{
+	WaitForSingleObject(worker->thread, INFINITE);
+	CloseHandle(worker->thread);
+}
+#else
+static void *sdf_job_thread(void *arg)
+{
+	sdf_job_worker((SDF_JOB_WORKER *)arg);
+	return NULL;
+}
+
+static int sdf_job_thread_start(SDF_JOB_WORKER *worker)
+{
+	if (pthread_create(&worker->thread, NULL, sdf_job_thread, worker) != 0) {
+		return -1;
+	}
+	return 1;
+}
+
+static void sdf_job_thread_join(SDF_JOB_WORKER *worker)
+{
+	pthread_join(worker->thread, NULL);
+}
+#endif
+
+SDF_JOB_QUEUE *sdf_job_queue_new(SDF_POOL *pool, size_t depth)
+{
+	SDF_JOB_QUEUE *queue;
+	size_t i;
+
+	if (!pool || !depth || depth > SDF_JOB_QUEUE_MAX_DEPTH) {
+		error_print();
+		return NULL;
+	}
+	if (!(queue = (SDF_JOB_QUEUE *)calloc(1, sizeof(SDF_JOB_QUEUE)))) {
+		error_print();
+		return NULL;
+	}
+	job_mutex_init(&queue->mutex);
+	job_cond_init(&queue->submitted);
+	job_cond_init(&queue->completed);
+	queue->pool = pool;
+	if (!(queue->workers = (SDF_JOB_WORKER *)calloc(depth, sizeof(SDF_JOB_WORKER)))) {
+		error_print();
+		sdf_job_queue_free(queue);
+		return NULL;
+	}
+	queue->workers_cnt = depth;
+	for (i = 0; i < depth; i++) {
+		queue->workers[i].queue = queue;
+		if (sdf_job_thread_start(&queue->workers[i]) != 1) {
+			error_print();
+			sdf_job_queue_free(queue);
+			return NULL;
+		}
+		queue->workers[i].started = 1;
+	}
+	return queue;
+}
+
+int sdf_job_submit(SDF_JOB_QUEUE *queue, SDF_JOB *job)
+{
+	if (!queue || !job) {
+		error_print();
+		return -1;
+	}
+	if (!job->in || !job->in_cnt || !job->out || !job->out_cnt) {
+		error_print();
+		return -1;
+	}
+	job->status = 0;
+	job->next = NULL;
+
+	job_mutex_lock(&queue->mutex);
+	if (queue->stopping) {
+		job_mutex_unlock(&queue->mutex);
+		error_print();
+		return -1;
+	}
+	if (queue->tail) queue->tail->next = job;
+	else queue->head = job;
+	queue->tail = job;
+	queue->pending++;
+	job_cond_signal(&queue->submitted);
+	job_mutex_unlock(&queue->mutex);
+	return 1;
+}
+
+int sdf_job_queue_poll(SDF_JOB_QUEUE *queue, SDF_JOB **jobs, size_t maxjobs, int wait)
+{
+	int n = 0;
+
+	if (!queue || !jobs || !maxjobs) {
+		error_print();
+		return -1;
+	}
+	job_mutex_lock(&queue->mutex);
+	if (wait) {
+		while (!queue->done_head && queue->pending) {
+			job_cond_wait(&queue->completed, &queue->mutex);
+		}
+	}
+	while (queue->done_head && (size_t)n < maxjobs) {
+		jobs[n++] = queue->done_head;
+		if (!(queue->done_head = queue->done_head->next)) {
+			queue->done_tail = NULL;
+		}
+		jobs[n - 1]->next = NULL;
+	}
+	job_mutex_unlock(&queue->mutex);
+	return n;
+}
+
+void sdf_job_queue_free(SDF_JOB_QUEUE *queue)
+{
+	size_t i;
+
+	if (!queue) {
+		return;
+	}
+	job_mutex_lock(&queue->mutex);
+	queue->stopping = 1;
+	job_cond_broadcast(&queue->submitted);
+	job_mutex_unlock(&queue->mutex);
+
+	if (queue->workers) {
+		for (i = 0; i < queue->workers_cnt; i++) {
+			SDF_JOB_WORKER *worker = &queue->workers[i];
+			if (worker->started) {
+				sdf_job_thread_join(worker);
+			}
+			if (worker->in) {
+				gmssl_secure_clear(worker->in, worker->size);
+				free(worker->in);
+			}
+			if (worker->out) {
+				gmssl_secure_clear(worker->out, worker->size);
+				free(worker->out);
+			}
+		}
+		free(queue->workers);
+	}
+	job_cond_destroy(&queue->completed);
+	job_cond_destroy(&queue->submitted);
+	job_mutex_destroy(&queue->mutex);
+	free(queue);
+}
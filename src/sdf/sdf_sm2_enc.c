@@ -24,7 +24,7 @@ extern void *globalDeviceHandle;
 
 static const uint8_t zeros[ECCref_MAX_LEN - 32] = {0};
 
-int sm2_do_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+static int sdf_sm2_do_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
 {
 	void *hSession = NULL;
 	SM2_POINT point;
@@ -136,7 +136,7 @@ int sdf_load_sm2_enc_key(SM2_KEY *key, unsigned int uiISKIndex, const char *pass
 	return 1;
 }
 
-int sm2_do_decrypt(const SM2_KEY *key, const SM2_CIPHERTEXT *in, uint8_t *out, size_t *outlen)
+static int sdf_sm2_do_decrypt(const SM2_KEY *key, const SM2_CIPHERTEXT *in, uint8_t *out, size_t *outlen)
 {
 	SDF_PRIVATE_KEY *sk = (SDF_PRIVATE_KEY *)&key->private_key;
 	void *hSession = NULL;
@@ -356,8 +356,7 @@ int sm2_do_encrypt_ex(const SM2_KEY *key, const SM2_ENC_PRE_COMP *pre_comp,
 }
 
 // key->public_key will not be point_at_infinity when decoded from_bytes/octets/der
-/*
-int sm2_do_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+static int sm2_do_encrypt_cpu(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
 {
 	sm2_z256_t k;
 	SM2_Z256_POINT C1;
@@ -411,7 +410,29 @@ retry:
 	gmssl_secure_clear(x2y2, sizeof(x2y2));
 	return 1;
 }
-*/
+
+// the public key encryption runs on the CPU unless the dispatch policy sends it to the device
+int sm2_do_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+{
+	int ret;
+
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm2_encrypt, inlen) != 1) {
+		return sm2_do_encrypt_cpu(key, in, inlen, out);
+	}
+	ret = sdf_sm2_do_encrypt(key, in, inlen, out);
+	sdf_dispatch_end();
+	return ret;
+}
+
+int sm2_do_decrypt(const SM2_KEY *key, const SM2_CIPHERTEXT *in, uint8_t *out, size_t *outlen)
+{
+	int ret;
+
+	sdf_dispatch_begin(SDF_DISPATCH_sm2_decrypt, in->ciphertext_size);
+	ret = sdf_sm2_do_decrypt(key, in, out, outlen);
+	sdf_dispatch_end();
+	return ret;
+}
 
 int sm2_do_encrypt_fixlen(const SM2_KEY *key, const uint8_t *in, size_t inlen, int point_size, SM2_CIPHERTEXT *out)
 {
@@ -168,8 +168,9 @@ int sm2_sign_init(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t
 		return -1;
 	}
 
-	// save session
+	// save session, the device is busy with the key until sm2_sign_finish()
 	sdf_sm3_ctx->hSession = hSession;
+	sdf_dispatch_begin(SDF_DISPATCH_sm2_sign, 0);
 
 	return 1;
 }
@@ -194,32 +195,34 @@ int sm2_sign_finish(SM2_SIGN_CTX *ctx, uint8_t *sig, size_t *siglen)
 	uint8_t dgst[32];
 	unsigned int uiLength;
 	SM2_SIGNATURE signature;
-	int ret;
+	int ret = -1;
 
 	// get hSession from ctx
-	ret = SDF_HashFinal(sdf_sm3_ctx->hSession, dgst, &uiLength);
-	if (ret != SDR_OK) {
+	if (SDF_HashFinal(sdf_sm3_ctx->hSession, dgst, &uiLength) != SDR_OK) {
 		error_print();
-		return -1;
+		goto end;
 	}
 
 	// get uiISKIndex from ctx
 	if (sdf_sm2_do_sign(sdf_sm3_ctx->hSession, sk->index, dgst, &signature) != 1) {
 		error_print();
-		return -1;
+		goto end;
 	}
 
 	*siglen = 0;
 	if (sm2_signature_to_der(&signature, &sig, siglen) != 1) {
 		error_print();
-		return -1;
+		goto end;
 	}
+	ret = 1;
 
+end:
 	// CloseSession
 	SDF_CloseSession(sdf_sm3_ctx->hSession);
+	sdf_dispatch_end();
 	// TODO: add sm2_sign_ctx_cleanup() to resue the hSession
 
-	return 1;
+	return ret;
 }
 
 int sm2_sign_finish_fixlen(SM2_SIGN_CTX *ctx, size_t siglen, uint8_t *sig)
@@ -235,16 +238,41 @@ int sm2_sign_reset(SM2_SIGN_CTX *ctx)
 	return -1;
 }
 
+// the verify needs no private key and runs on the CPU unless the dispatch policy sends it to the device,
+// the device route keeps its session in public_point_table, which is not used here
 int sm2_verify_init(SM2_VERIFY_CTX *ctx, const SM2_KEY *key, const char *id, size_t idlen)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)ctx->public_point_table;
 	void *hSession = NULL;
 	SM2_POINT point;
 	ECCrefPublicKey eccPublicKey;
 	int ret;
 
+	if (!ctx || !key) {
+		error_print();
+		return -1;
+	}
+	if (id && (idlen <= 0 || idlen > SM2_MAX_ID_LENGTH)) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->key.public_key = key->public_key;
+
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm2_verify, 0) != 1) {
+		sm3_init(&ctx->sm3_ctx);
+		if (id) {
+			uint8_t z[SM3_DIGEST_SIZE];
+			sm2_compute_z(z, &key->public_key, id, idlen);
+			sm3_update(&ctx->sm3_ctx, z, sizeof(z));
+		}
+		ctx->saved_sm3_ctx = ctx->sm3_ctx;
+		return 1;
+	}
+
 	ret = SDF_OpenSession(globalDeviceHandle, &hSession);
 	if (ret != SDR_OK) {
+		sdf_dispatch_end();
 		error_print();
 		return -1;
 	}
@@ -259,6 +287,7 @@ int sm2_verify_init(SM2_VERIFY_CTX *ctx, const SM2_KEY *key, const char *id, siz
 	ret = SDF_HashInit(hSession, SGD_SM3, &eccPublicKey, (unsigned char *)id, (unsigned int)idlen);
 	if (ret != SDR_OK) {
 		SDF_CloseSession(hSession);
+		sdf_dispatch_end();
 		error_print();
 		return -1;
 	}
@@ -269,9 +298,13 @@ int sm2_verify_init(SM2_VERIFY_CTX *ctx, const SM2_KEY *key, const char *id, siz
 
 int sm2_verify_update(SM2_VERIFY_CTX *ctx, const uint8_t *data, size_t datalen)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)ctx->public_point_table;
 	int ret;
 
+	if (!sdf_sm3_ctx->hSession) {
+		sm3_update(&ctx->sm3_ctx, data, datalen);
+		return 1;
+	}
 	ret = SDF_HashUpdate(sdf_sm3_ctx->hSession, (unsigned char *)data, (unsigned int)datalen);
 	if (ret != SDR_OK) {
 		error_print();
@@ -282,36 +315,56 @@ int sm2_verify_update(SM2_VERIFY_CTX *ctx, const uint8_t *data, size_t datalen)
 
 int sm2_verify_finish(SM2_VERIFY_CTX *ctx, const uint8_t *sigbuf, size_t siglen)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)ctx->public_point_table;
 	uint8_t dgst[32];
 	unsigned int uiLength;
 	SM2_SIGNATURE sig;
 	int ret;
 
-	ret = SDF_HashFinal(sdf_sm3_ctx->hSession, dgst, &uiLength);
-	if (ret != SDR_OK) {
-		error_print();
-		return -1;
+	if (!sdf_sm3_ctx->hSession) {
+		sm3_finish(&ctx->sm3_ctx, dgst);
+		if (sm2_signature_from_der(&sig, &sigbuf, &siglen) != 1
+			|| asn1_length_is_zero(siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_do_verify(&ctx->key, dgst, &sig) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
 	}
 
-	if (sm2_signature_from_der(&sig, &sigbuf, &siglen) != 1
-		|| asn1_length_is_zero(siglen) != 1) {
-		error_print();
-		return -1;
+	ret = SDF_HashFinal(sdf_sm3_ctx->hSession, dgst, &uiLength);
+	if (ret == SDR_OK
+		&& sm2_signature_from_der(&sig, &sigbuf, &siglen) == 1
+		&& asn1_length_is_zero(siglen) == 1) {
+		ret = sdf_sm2_do_verify(sdf_sm3_ctx->hSession, &ctx->key, dgst, &sig);
+	} else {
+		ret = -1;
 	}
+	SDF_CloseSession(sdf_sm3_ctx->hSession);
+	sdf_sm3_ctx->hSession = NULL;
+	sdf_dispatch_end();
 
-	if (sdf_sm2_do_verify(sdf_sm3_ctx->hSession, &ctx->key, dgst, &sig) != 1) {
+	if (ret != 1) {
 		error_print();
 		return -1;
 	}
-
 	return 1;
 }
 
+// only the CPU route can be reset
 int sm2_verify_reset(SM2_VERIFY_CTX *ctx)
 {
-	error_print();
-	return -1;
+	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)ctx->public_point_table;
+
+	if (sdf_sm3_ctx->hSession) {
+		error_print();
+		return -1;
+	}
+	ctx->sm3_ctx = ctx->saved_sm3_ctx;
+	return 1;
 }
 
 
@@ -13,6 +13,8 @@
 #include <stdlib.h>
 #include <gmssl/sdf.h>
 #include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 #include "sdf.h"
 #include "sdf_ext.h"
@@ -27,9 +29,21 @@
 void *globalDeviceHandle = NULL;
 
 
-int sm3_digest_init(SM3_DIGEST_CTX *ctx, const uint8_t *key, size_t keylen)
+enum {
+	SDF_SM3_ROUTE_none = 0, // decided by the first update
+	SDF_SM3_ROUTE_cpu,
+	SDF_SM3_ROUTE_device,
+};
+
+// overlay of the SM3_DIGEST_CTX union
+typedef struct {
+	SM3_CTX sm3_ctx; // the CPU route
+	void *hSession; // the device route
+	int route;
+} SDF_SM3_DIGEST_CTX;
+
+static int sdf_sm3_open(SDF_SM3_DIGEST_CTX *sdf_ctx)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
 	void *hSession = NULL;
 	int ret;
 
@@ -50,20 +64,63 @@ int sm3_digest_init(SM3_DIGEST_CTX *ctx, const uint8_t *key, size_t keylen)
 	}
 
 	if ((ret = SDF_HashInit(hSession, SGD_SM3, NULL, NULL, 0)) != SDR_OK) {
+		SDF_CloseSession(hSession);
 		error_print_msg("SDFerror: 0x%08X\n", ret);
 		return -1;
 	}
 
-	sdf_sm3_ctx->hSession = hSession;
+	sdf_ctx->hSession = hSession;
+	return 1;
+}
+
+static int sdf_sm3_route(SDF_SM3_DIGEST_CTX *sdf_ctx, size_t datalen)
+{
+	if (sdf_ctx->route != SDF_SM3_ROUTE_none) {
+		return 1;
+	}
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm3, datalen) == 1) {
+		if (sdf_sm3_open(sdf_ctx) != 1) {
+			sdf_dispatch_end();
+			error_print();
+			return -1;
+		}
+		sdf_ctx->route = SDF_SM3_ROUTE_device;
+	} else {
+		sdf_ctx->route = SDF_SM3_ROUTE_cpu;
+	}
+	return 1;
+}
+
+int sm3_digest_init(SM3_DIGEST_CTX *ctx, const uint8_t *key, size_t keylen)
+{
+	SDF_SM3_DIGEST_CTX *sdf_ctx = (SDF_SM3_DIGEST_CTX *)&ctx->hmac_ctx;
+
+	if (sizeof(SDF_SM3_DIGEST_CTX) > sizeof(SM3_HMAC_CTX)) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	sm3_init(&sdf_ctx->sm3_ctx);
 	return 1;
 }
 
 int sm3_digest_update(SM3_DIGEST_CTX *ctx, const uint8_t *data, size_t datalen)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_DIGEST_CTX *sdf_ctx = (SDF_SM3_DIGEST_CTX *)&ctx->hmac_ctx;
 	int ret;
 
-	if ((ret = SDF_HashUpdate(sdf_sm3_ctx->hSession, (uint8_t *)data, (unsigned int)datalen)) != SDR_OK) {
+	if (!datalen) {
+		return 1;
+	}
+	if (sdf_sm3_route(sdf_ctx, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sdf_ctx->route == SDF_SM3_ROUTE_cpu) {
+		sm3_update(&sdf_ctx->sm3_ctx, data, datalen);
+		return 1;
+	}
+	if ((ret = SDF_HashUpdate(sdf_ctx->hSession, (uint8_t *)data, (unsigned int)datalen)) != SDR_OK) {
 		error_print_msg("SDFerror: 0x%08X\n", ret);
 		return -1;
 	}
@@ -72,36 +129,49 @@ int sm3_digest_update(SM3_DIGEST_CTX *ctx, const uint8_t *data, size_t datalen)
 
 int sm3_digest_finish(SM3_DIGEST_CTX *ctx, uint8_t dgst[SM3_DIGEST_SIZE])
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_DIGEST_CTX *sdf_ctx = (SDF_SM3_DIGEST_CTX *)&ctx->hmac_ctx;
 	unsigned int dgstlen;
 	int ret;
 
-	if ((ret = SDF_HashFinal(sdf_sm3_ctx->hSession, dgst, &dgstlen)) != SDR_OK) {
+	if (sdf_ctx->route != SDF_SM3_ROUTE_device) {
+		sm3_finish(&sdf_ctx->sm3_ctx, dgst);
+		return 1;
+	}
+	if ((ret = SDF_HashFinal(sdf_ctx->hSession, dgst, &dgstlen)) != SDR_OK) {
 		error_print_msg("SDFerror: 0x%08X\n", ret);
 		return -1;
 	}
 	return 1;
 }
 
+// the device session is kept for the next message
 int sm3_digest_reset(SM3_DIGEST_CTX *ctx)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_DIGEST_CTX *sdf_ctx = (SDF_SM3_DIGEST_CTX *)&ctx->hmac_ctx;
 	int ret;
 
-	if ((ret = SDF_HashInit(sdf_sm3_ctx->hSession, SGD_SM3, NULL, NULL, 0)) != SDR_OK) {
-		error_print_msg("SDFerror: 0x%08X\n", ret);
-		return -1;
+	sm3_init(&sdf_ctx->sm3_ctx);
+	if (sdf_ctx->hSession) {
+		if ((ret = SDF_HashInit(sdf_ctx->hSession, SGD_SM3, NULL, NULL, 0)) != SDR_OK) {
+			error_print_msg("SDFerror: 0x%08X\n", ret);
+			return -1;
+		}
+		return 1;
 	}
+	sdf_ctx->route = SDF_SM3_ROUTE_none;
 	return 1;
 }
 
 void sm3_digest_cleanup(SM3_DIGEST_CTX *ctx)
 {
-	SDF_SM3_CTX *sdf_sm3_ctx = (SDF_SM3_CTX *)&ctx->sm3_ctx;
+	SDF_SM3_DIGEST_CTX *sdf_ctx = (SDF_SM3_DIGEST_CTX *)&ctx->hmac_ctx;
 	int ret;
 
-	if ((ret = SDF_CloseSession(sdf_sm3_ctx->hSession)) != SDR_OK) {
-		error_print_msg("SDFerror: 0x%08X\n", ret);
+	if (sdf_ctx->hSession) {
+		if ((ret = SDF_CloseSession(sdf_ctx->hSession)) != SDR_OK) {
+			error_print_msg("SDFerror: 0x%08X\n", ret);
+		}
+		sdf_dispatch_end();
 	}
-	memset(ctx, 0, sizeof(*ctx));
+	gmssl_secure_clear(ctx, sizeof(*ctx));
 }
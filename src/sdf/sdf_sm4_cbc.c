@@ -20,35 +20,141 @@ extern void *globalDeviceHandle;
 
 
 
-static int sdf_sm4_cbc_encrypt_blocks(SDF_SM4_KEY *key,
-	const uint8_t iv[16], const uint8_t *in, size_t inlen, uint8_t *out)
+enum {
+	SDF_SM4_ROUTE_none = 0, // decided by the first update of a full block
+	SDF_SM4_ROUTE_cpu,
+	SDF_SM4_ROUTE_device,
+};
+
+// overlay of SM4_CBC_CTX.sm4_key
+typedef struct {
+	SDF_SM4_KEY sdf_key; // the device route
+	uint8_t key[16]; // the CPU route, cleared when imported to the device
+	int route;
+} SDF_SM4_CBC_KEY;
+
+static int sdf_sm4_cbc_import_key(SDF_SM4_CBC_KEY *key)
 {
+	void *hSession = NULL;
+	void *hKey = NULL;
+	unsigned int uiIPKIndex = 1;
+	ECCCipher eccCipher;
+	int ret;
+
+	// OpenDevice
+	if (globalDeviceHandle == NULL) {
+		if ((ret = SDF_OpenDevice(&globalDeviceHandle)) != SDR_OK) {
+			error_print_msg("SDFerror: 0x%08X\n", ret);
+			return -1;
+		}
+		if (globalDeviceHandle == NULL) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if ((ret = SDF_OpenSession(globalDeviceHandle, &hSession)) != SDR_OK) {
+		error_print_msg("SDFerror: 0x%08X\n", ret);
+		return -1;
+	}
+
+	// ImportKey
+	ret = SDF_InternalEncrypt_ECC(hSession, uiIPKIndex, SGD_SM2_3, key->key, 16, &eccCipher);
+	if (ret != SDR_OK) {
+		SDF_CloseSession(hSession);
+		error_print_msg("SDF library: 0x%08X\n", ret);
+		return -1;
+	}
+
+	ret = SDF_ImportKeyWithISK_ECC(hSession, uiIPKIndex, &eccCipher, &hKey);
+	if (ret != SDR_OK) {
+		SDF_CloseSession(hSession);
+		error_print_msg("SDF library: 0x%08X\n", ret);
+		return -1;
+	}
+
+	key->sdf_key.hSession = hSession;
+	key->sdf_key.hKey = hKey;
+	gmssl_secure_clear(key->key, sizeof(key->key));
+	return 1;
+}
+
+static int sdf_sm4_cbc_route(SDF_SM4_CBC_KEY *key, size_t len)
+{
+	if (key->route != SDF_SM4_ROUTE_none) {
+		return 1;
+	}
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm4_cbc, len) == 1) {
+		if (sdf_sm4_cbc_import_key(key) != 1) {
+			sdf_dispatch_end();
+			error_print();
+			return -1;
+		}
+		key->route = SDF_SM4_ROUTE_device;
+	} else {
+		key->route = SDF_SM4_ROUTE_cpu;
+	}
+	return 1;
+}
+
+static void sdf_sm4_cbc_cleanup(SDF_SM4_CBC_KEY *key)
+{
+	if (key->route == SDF_SM4_ROUTE_device) {
+		SDF_CloseSession(key->sdf_key.hSession);
+		sdf_dispatch_end();
+	}
+	gmssl_secure_clear(key, sizeof(*key));
+}
+
+static int sdf_sm4_cbc_encrypt_blocks(SDF_SM4_CBC_KEY *key,
+	const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t ivbuf[16];
 	unsigned int outlen;
 	int ret;
 
-	if ((ret = SDF_Encrypt(key->hSession, key->hKey, SGD_SM4_CBC,
-		(unsigned char *)iv, (unsigned char *)in, (unsigned int)inlen, out, &outlen)) != SDR_OK) {
+	// the device may update the IV, which can be the last output block
+	memcpy(ivbuf, iv, 16);
+	if (key->route == SDF_SM4_ROUTE_cpu) {
+		SM4_KEY sm4_key;
+		sm4_set_encrypt_key(&sm4_key, key->key);
+		sm4_cbc_encrypt_blocks(&sm4_key, ivbuf, in, nblocks, out);
+		gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+		return 1;
+	}
+	if ((ret = SDF_Encrypt(key->sdf_key.hSession, key->sdf_key.hKey, SGD_SM4_CBC,
+		ivbuf, (unsigned char *)in, (unsigned int)(nblocks * 16), out, &outlen)) != SDR_OK) {
 		error_print();
 		return -1;
 	}
 	return 1;
 }
 
-static int sdf_sm4_cbc_decrypt_blocks(SDF_SM4_KEY *key,
-	const uint8_t iv[16], const uint8_t *in, size_t inlen, uint8_t *out)
+static int sdf_sm4_cbc_decrypt_blocks(SDF_SM4_CBC_KEY *key,
+	const uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
+	uint8_t ivbuf[16];
 	unsigned int outlen;
 	int ret;
 
-	if ((ret = SDF_Decrypt(key->hSession, key->hKey, SGD_SM4_CBC,
-		(unsigned char *)iv, (unsigned char *)in, (unsigned int)inlen, out, &outlen)) != SDR_OK) {
+	// the device may update the IV, which can be the last output block
+	memcpy(ivbuf, iv, 16);
+	if (key->route == SDF_SM4_ROUTE_cpu) {
+		SM4_KEY sm4_key;
+		sm4_set_decrypt_key(&sm4_key, key->key);
+		sm4_cbc_decrypt_blocks(&sm4_key, ivbuf, in, nblocks, out);
+		gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+		return 1;
+	}
+	if ((ret = SDF_Decrypt(key->sdf_key.hSession, key->sdf_key.hKey, SGD_SM4_CBC,
+		ivbuf, (unsigned char *)in, (unsigned int)(nblocks * 16), out, &outlen)) != SDR_OK) {
 		error_print();
 		return -1;
 	}
 	return 1;
 }
 
-static int sdf_sm4_cbc_padding_encrypt(SDF_SM4_KEY *key,
+static int sdf_sm4_cbc_padding_encrypt(SDF_SM4_CBC_KEY *key,
 	const uint8_t iv[16], const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t *outlen)
 {
@@ -76,7 +182,7 @@ static int sdf_sm4_cbc_padding_encrypt(SDF_SM4_KEY *key,
 	return 1;
 }
 
-static int sdf_sm4_cbc_padding_decrypt(SDF_SM4_KEY *key,
+static int sdf_sm4_cbc_padding_decrypt(SDF_SM4_CBC_KEY *key,
 	const uint8_t iv[16], const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t *outlen)
 {
@@ -115,54 +221,18 @@ static int sdf_sm4_cbc_padding_decrypt(SDF_SM4_KEY *key,
 	return 1;
 }
 
+// the key is imported to the device by the first update of a full block if the message goes there
 int sm4_cbc_encrypt_init(SM4_CBC_CTX *ctx,
 	const uint8_t key[SM4_BLOCK_SIZE], const uint8_t iv[SM4_BLOCK_SIZE])
 {
-	SDF_SM4_KEY *sdf_sm4_key = (SDF_SM4_KEY *)&ctx->sm4_key;
-	void *hSession = NULL;
-	void *hKey = NULL;
-	unsigned int uiIPKIndex = 1;
-	ECCCipher eccCipher;
-	int ret;
+	SDF_SM4_CBC_KEY *sdf_sm4_key = (SDF_SM4_CBC_KEY *)&ctx->sm4_key;
 
 	if (!ctx || !key || !iv) {
 		error_print();
 		return -1;
 	}
-
-	// OpenDevice
-	if (globalDeviceHandle == NULL) {
-		if ((ret = SDF_OpenDevice(&globalDeviceHandle)) != SDR_OK) {
-			error_print_msg("SDFerror: 0x%08X\n", ret);
-			return -1;
-		}
-		if (globalDeviceHandle == NULL) {
-			error_print();
-			return -1;
-		}
-	}
-
-	if ((ret = SDF_OpenSession(globalDeviceHandle, &hSession)) != SDR_OK) {
-		error_print_msg("SDFerror: 0x%08X\n", ret);
-		return -1;
-	}
-
-	// ImportKey
-	ret = SDF_InternalEncrypt_ECC(hSession, uiIPKIndex, SGD_SM2_3, (unsigned char *)key, 16, &eccCipher);
-	if (ret != SDR_OK) {
-		error_print_msg("SDF library: 0x%08X\n", ret);
-		return -1;
-	}
-
-	ret = SDF_ImportKeyWithISK_ECC(hSession, uiIPKIndex, &eccCipher, &hKey);
-	if (ret != SDR_OK) {
-		error_print_msg("SDF library: 0x%08X\n", ret);
-		return -1;
-	}
-
-	// save hSession and hKey into CTX
-	sdf_sm4_key->hSession = hSession;
-	sdf_sm4_key->hKey = hKey;
+	memset(sdf_sm4_key, 0, sizeof(*sdf_sm4_key));
+	memcpy(sdf_sm4_key->key, key, SM4_BLOCK_SIZE);
 	memcpy(ctx->iv, iv, SM4_BLOCK_SIZE);
 	memset(ctx->block, 0, SM4_BLOCK_SIZE);
 	ctx->block_nbytes = 0;
@@ -172,7 +242,7 @@ int sm4_cbc_encrypt_init(SM4_CBC_CTX *ctx,
 int sm4_cbc_encrypt_update(SM4_CBC_CTX *ctx,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
 {
-	SDF_SM4_KEY *sdf_sm4_key = (SDF_SM4_KEY *)&ctx->sm4_key;
+	SDF_SM4_CBC_KEY *sdf_sm4_key = (SDF_SM4_CBC_KEY *)&ctx->sm4_key;
 	size_t left;
 	size_t nblocks;
 	size_t len;
@@ -185,6 +255,11 @@ int sm4_cbc_encrypt_update(SM4_CBC_CTX *ctx,
 		error_print();
 		return -1;
 	}
+	if (ctx->block_nbytes + inlen >= SM4_BLOCK_SIZE
+		&& sdf_sm4_cbc_route(sdf_sm4_key, ctx->block_nbytes + inlen) != 1) {
+		error_print();
+		return -1;
+	}
 	*outlen = 0;
 	if (ctx->block_nbytes) {
 		left = SM4_BLOCK_SIZE - ctx->block_nbytes;
@@ -226,7 +301,7 @@ int sm4_cbc_encrypt_update(SM4_CBC_CTX *ctx,
 
 int sm4_cbc_encrypt_finish(SM4_CBC_CTX *ctx, uint8_t *out, size_t *outlen)
 {
-	SDF_SM4_KEY *sdf_sm4_key = (SDF_SM4_KEY *)&ctx->sm4_key;
+	SDF_SM4_CBC_KEY *sdf_sm4_key = (SDF_SM4_CBC_KEY *)&ctx->sm4_key;
 
 	if (!ctx || !out || !outlen) {
 		error_print();
@@ -236,12 +311,16 @@ int sm4_cbc_encrypt_finish(SM4_CBC_CTX *ctx, uint8_t *out, size_t *outlen)
 		error_print();
 		return -1;
 	}
+	if (sdf_sm4_cbc_route(sdf_sm4_key, ctx->block_nbytes) != 1) {
+		error_print();
+		return -1;
+	}
 	if (sdf_sm4_cbc_padding_encrypt(sdf_sm4_key, ctx->iv, ctx->block, ctx->block_nbytes, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
 
-	SDF_CloseSession(sdf_sm4_key->hSession);
+	sdf_sm4_cbc_cleanup(sdf_sm4_key);
 	return 1;
 }
 
@@ -259,7 +338,7 @@ int sm4_cbc_decrypt_init(SM4_CBC_CTX *ctx,
 int sm4_cbc_decrypt_update(SM4_CBC_CTX *ctx,
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
 {
-	SDF_SM4_KEY *sdf_sm4_key = (SDF_SM4_KEY *)&ctx->sm4_key;
+	SDF_SM4_CBC_KEY *sdf_sm4_key = (SDF_SM4_CBC_KEY *)&ctx->sm4_key;
 	size_t left, len, nblocks;
 
 	if (!ctx || !in || !out || !outlen) {
@@ -271,6 +350,11 @@ int sm4_cbc_decrypt_update(SM4_CBC_CTX *ctx,
 		return -1;
 	}
 
+	if (ctx->block_nbytes + inlen >= SM4_BLOCK_SIZE
+		&& sdf_sm4_cbc_route(sdf_sm4_key, ctx->block_nbytes + inlen) != 1) {
+		error_print();
+		return -1;
+	}
 	*outlen = 0;
 	if (ctx->block_nbytes) {
 		left = SM4_BLOCK_SIZE - ctx->block_nbytes;
@@ -310,7 +394,7 @@ int sm4_cbc_decrypt_update(SM4_CBC_CTX *ctx,
 
 int sm4_cbc_decrypt_finish(SM4_CBC_CTX *ctx, uint8_t *out, size_t *outlen)
 {
-	SDF_SM4_KEY *sdf_sm4_key = (SDF_SM4_KEY *)&ctx->sm4_key;
+	SDF_SM4_CBC_KEY *sdf_sm4_key = (SDF_SM4_CBC_KEY *)&ctx->sm4_key;
 
 	if (!ctx || !out || !outlen) {
 		error_print();
@@ -320,12 +404,16 @@ int sm4_cbc_decrypt_finish(SM4_CBC_CTX *ctx, uint8_t *out, size_t *outlen)
 		error_print();
 		return -1;
 	}
+	if (sdf_sm4_cbc_route(sdf_sm4_key, ctx->block_nbytes) != 1) {
+		error_print();
+		return -1;
+	}
 	if (sdf_sm4_cbc_padding_decrypt(sdf_sm4_key, ctx->iv, ctx->block, SM4_BLOCK_SIZE, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
 
-	SDF_CloseSession(sdf_sm4_key->hSession);
+	sdf_sm4_cbc_cleanup(sdf_sm4_key);
 	return 1;
 }
 
@@ -11,6 +11,7 @@
 #include <string.h>
 #include <gmssl/sha2.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 
 
 #define Ch(X, Y, Z)	(((X) & (Y)) ^ ((~(X)) & (Z)))
@@ -39,7 +40,7 @@ static const uint32_t K[64] = {
 	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
 };
 
-static void sha256_compress_blocks(uint32_t state[8],
+static void sha256_generic_compress_blocks(uint32_t state[8],
 	const unsigned char *data, size_t blocks)
 {
 	uint32_t A;
@@ -98,6 +99,51 @@ static void sha256_compress_blocks(uint32_t state[8],
 }
 
 
+/*
+ * Runtime selection of the compression function
+ *
+ * With ENABLE_SHA2_SHANI the x86 SHA extensions and with ENABLE_SHA2_CE the
+ * ARMv8 SHA2 instructions are used when the CPU reports them, see
+ * `gmssl_cpu_features`, the code above is the fallback. SHA-224 shares it.
+ */
+
+typedef void (*sha256_compress_blocks_func)(uint32_t state[8], const unsigned char *data, size_t blocks);
+
+static sha256_compress_blocks_func sha256_compress_blocks_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sha256_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	sha256_compress_blocks_func compress_blocks = sha256_generic_compress_blocks;
+
+	(void)cpu;
+
+#ifdef ENABLE_SHA2_SHANI
+	// every CPU with the SHA extensions also has SSE4.1
+	if ((cpu & GMSSL_CPU_SHA) && (cpu & GMSSL_CPU_SSSE3)) {
+		compress_blocks = sha256_shani_compress_blocks;
+	}
+#endif
+#ifdef ENABLE_SHA2_CE
+	if (cpu & GMSSL_CPU_ARM_SHA2) {
+		compress_blocks = sha256_ce_compress_blocks;
+	}
+#endif
+
+	sha256_compress_blocks_impl = compress_blocks;
+}
+
+static void sha256_compress_blocks(uint32_t state[8], const unsigned char *data, size_t blocks)
+{
+	if (!sha256_compress_blocks_impl) {
+		sha256_dispatch_init();
+	}
+	sha256_compress_blocks_impl(state, data, blocks);
+}
+
 void sha256_init(SHA256_CTX *ctx)
 {
 	memset(ctx, 0, sizeof(*ctx));
@@ -0,0 +1,93 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SHA-256 with the ARMv8 SHA2 instructions
+ *
+ * The state is kept as (A, B, C, D) and (E, F, G, H). SHA256H/SHA256H2 do
+ * four rounds on the two halves, SHA256SU0/SU1 expand four message words.
+ */
+
+#include <arm_neon.h>
+#include <gmssl/sha2.h>
+
+
+static const uint32_t K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// rounds 4*i..4*i+3 with s0 = W[4i..], s0 is replaced by W[4i+16..]
+#define SHA256_CE_QROUND(i, s0, s1, s2, s3)			\
+	wk = vaddq_u32(s0, vld1q_u32(K + 4 * (i)));		\
+	if ((i) < 12) {						\
+		s0 = vsha256su0q_u32(s0, s1);			\
+		s0 = vsha256su1q_u32(s0, s2, s3);		\
+	}							\
+	t = abcd;						\
+	abcd = vsha256hq_u32(abcd, efgh, wk);			\
+	efgh = vsha256h2q_u32(efgh, t, wk)
+
+void sha256_ce_compress_blocks(uint32_t state[8], const unsigned char *data, size_t blocks)
+{
+	uint32x4_t abcd, efgh, abcd0, efgh0;
+	uint32x4_t w0, w1, w2, w3, wk, t;
+
+	abcd = vld1q_u32(state);
+	efgh = vld1q_u32(state + 4);
+
+	while (blocks--) {
+		abcd0 = abcd;
+		efgh0 = efgh;
+
+		w0 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data)));
+		w1 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 16)));
+		w2 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 32)));
+		w3 = vreinterpretq_u32_u8(vrev32q_u8(vld1q_u8(data + 48)));
+
+		SHA256_CE_QROUND( 0, w0, w1, w2, w3);
+		SHA256_CE_QROUND( 1, w1, w2, w3, w0);
+		SHA256_CE_QROUND( 2, w2, w3, w0, w1);
+		SHA256_CE_QROUND( 3, w3, w0, w1, w2);
+		SHA256_CE_QROUND( 4, w0, w1, w2, w3);
+		SHA256_CE_QROUND( 5, w1, w2, w3, w0);
+		SHA256_CE_QROUND( 6, w2, w3, w0, w1);
+		SHA256_CE_QROUND( 7, w3, w0, w1, w2);
+		SHA256_CE_QROUND( 8, w0, w1, w2, w3);
+		SHA256_CE_QROUND( 9, w1, w2, w3, w0);
+		SHA256_CE_QROUND(10, w2, w3, w0, w1);
+		SHA256_CE_QROUND(11, w3, w0, w1, w2);
+		SHA256_CE_QROUND(12, w0, w1, w2, w3);
+		SHA256_CE_QROUND(13, w1, w2, w3, w0);
+		SHA256_CE_QROUND(14, w2, w3, w0, w1);
+		SHA256_CE_QROUND(15, w3, w0, w1, w2);
+
+		abcd = vaddq_u32(abcd, abcd0);
+		efgh = vaddq_u32(efgh, efgh0);
+
+		data += 64;
+	}
+
+	vst1q_u32(state, abcd);
+	vst1q_u32(state + 4, efgh);
+}
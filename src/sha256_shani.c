@@ -0,0 +1,107 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SHA-256 with the x86 SHA extensions
+ *
+ * sha256rnds2 does two rounds on the state kept as (A, B, E, F) and
+ * (C, D, G, H), sha256msg1/sha256msg2 expand four message words at a time.
+ */
+
+#include <gmssl/sha2.h>
+#include <immintrin.h>
+
+
+static const uint32_t K[64] = {
+	0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+	0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+	0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+	0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+	0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+	0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+	0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+	0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+	0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+	0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+	0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+	0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+	0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+	0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+	0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+	0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2,
+};
+
+// rounds 4*i..4*i+3 with cur = W[4i..], the schedule updates next = W[4i+4..] and prev = W[4i-4..]
+#define SHA256_QROUND(i, cur, next, prev)					\
+	msg = _mm_add_epi32(cur, _mm_loadu_si128((const __m128i *)(K + 4 * (i))));\
+	state1 = _mm_sha256rnds2_epu32(state1, state0, msg);			\
+	if ((i) >= 3 && (i) <= 14) {						\
+		tmp = _mm_alignr_epi8(cur, prev, 4);				\
+		next = _mm_add_epi32(next, tmp);				\
+		next = _mm_sha256msg2_epu32(next, cur);				\
+	}									\
+	msg = _mm_shuffle_epi32(msg, 0x0e);					\
+	state0 = _mm_sha256rnds2_epu32(state0, state1, msg);			\
+	if ((i) >= 1 && (i) <= 12) {						\
+		prev = _mm_sha256msg1_epu32(prev, cur);				\
+	}
+
+void sha256_shani_compress_blocks(uint32_t state[8], const unsigned char *data, size_t blocks)
+{
+	const __m128i bswap = _mm_set_epi64x(0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+	__m128i state0, state1, save0, save1;
+	__m128i msg, tmp, w0, w1, w2, w3;
+
+	tmp = _mm_loadu_si128((const __m128i *)state);
+	state1 = _mm_loadu_si128((const __m128i *)(state + 4));
+	tmp = _mm_shuffle_epi32(tmp, 0xb1);			// C D A B
+	state1 = _mm_shuffle_epi32(state1, 0x1b);		// H G F E
+	state0 = _mm_alignr_epi8(tmp, state1, 8);		// A B E F
+	state1 = _mm_blend_epi16(state1, tmp, 0xf0);		// C D G H
+
+	while (blocks--) {
+		save0 = state0;
+		save1 = state1;
+
+		w0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data)), bswap);
+		w1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), bswap);
+		w2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), bswap);
+		w3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), bswap);
+
+		SHA256_QROUND( 0, w0, w1, w3);
+		SHA256_QROUND( 1, w1, w2, w0);
+		SHA256_QROUND( 2, w2, w3, w1);
+		SHA256_QROUND( 3, w3, w0, w2);
+		SHA256_QROUND( 4, w0, w1, w3);
+		SHA256_QROUND( 5, w1, w2, w0);
+		SHA256_QROUND( 6, w2, w3, w1);
+		SHA256_QROUND( 7, w3, w0, w2);
+		SHA256_QROUND( 8, w0, w1, w3);
+		SHA256_QROUND( 9, w1, w2, w0);
+		SHA256_QROUND(10, w2, w3, w1);
+		SHA256_QROUND(11, w3, w0, w2);
+		SHA256_QROUND(12, w0, w1, w3);
+		SHA256_QROUND(13, w1, w2, w0);
+		SHA256_QROUND(14, w2, w3, w1);
+		SHA256_QROUND(15, w3, w0, w2);
+
+		state0 = _mm_add_epi32(state0, save0);
+		state1 = _mm_add_epi32(state1, save1);
+
+		data += 64;
+	}
+
+	tmp = _mm_shuffle_epi32(state0, 0x1b);			// F E B A
+	state1 = _mm_shuffle_epi32(state1, 0xb1);		// D C H G
+	state0 = _mm_blend_epi16(tmp, state1, 0xf0);		// D C B A
+	state1 = _mm_alignr_epi8(state1, tmp, 8);		// H G F E
+
+	_mm_storeu_si128((__m128i *)state, state0);
+	_mm_storeu_si128((__m128i *)(state + 4), state1);
+}
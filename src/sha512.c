@@ -13,6 +13,7 @@
 #include <string.h>
 #include <gmssl/sha2.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 
 
 static void sha512_compress_blocks(uint64_t state[8],
@@ -117,7 +118,7 @@ static const uint64_t K[80] = {
 	0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
 };
 
-static void sha512_compress_blocks(uint64_t state[8],
+static void sha512_generic_compress_blocks(uint64_t state[8],
 	const unsigned char *data, size_t blocks)
 {
 	uint64_t A;
@@ -176,6 +177,46 @@ static void sha512_compress_blocks(uint64_t state[8],
 }
 
 
+/*
+ * Runtime selection of the compression function
+ *
+ * With ENABLE_SHA2_CE the ARMv8.2 SHA512 instructions are used when the CPU
+ * reports them, see `gmssl_cpu_features`, the code above is the fallback.
+ * SHA-384 shares it.
+ */
+
+typedef void (*sha512_compress_blocks_func)(uint64_t state[8], const unsigned char *data, size_t blocks);
+
+static sha512_compress_blocks_func sha512_compress_blocks_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sha512_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	sha512_compress_blocks_func compress_blocks = sha512_generic_compress_blocks;
+
+	(void)cpu;
+
+#ifdef ENABLE_SHA2_CE
+	if (cpu & GMSSL_CPU_ARM_SHA512) {
+		compress_blocks = sha512_ce_compress_blocks;
+	}
+#endif
+
+	sha512_compress_blocks_impl = compress_blocks;
+}
+
+static void sha512_compress_blocks(uint64_t state[8],
+	const unsigned char *data, size_t blocks)
+{
+	if (!sha512_compress_blocks_impl) {
+		sha512_dispatch_init();
+	}
+	sha512_compress_blocks_impl(state, data, blocks);
+}
+
 void sha384_init(SHA384_CTX *ctx)
 {
 	memset(ctx, 0, sizeof(*ctx));
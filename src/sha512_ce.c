@@ -0,0 +1,110 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SHA-512 with the ARMv8.2 SHA512 instructions
+ *
+ * The state is kept as (A, B), (C, D), (E, F), (G, H), lane 0 first.
+ * SHA512H gives T1 of two rounds, SHA512H2 the two new A words and the two
+ * new E words are (C, D) + T1, then the pairs shift by one. SHA512SU0/SU1
+ * expand two message words at a time.
+ */
+
+#include <arm_neon.h>
+#include <gmssl/sha2.h>
+
+
+static const uint64_t K[80] = {
+	0x428a2f98d728ae22, 0x7137449123ef65cd, 0xb5c0fbcfec4d3b2f, 0xe9b5dba58189dbbc,
+	0x3956c25bf348b538, 0x59f111f1b605d019, 0x923f82a4af194f9b, 0xab1c5ed5da6d8118,
+	0xd807aa98a3030242, 0x12835b0145706fbe, 0x243185be4ee4b28c, 0x550c7dc3d5ffb4e2,
+	0x72be5d74f27b896f, 0x80deb1fe3b1696b1, 0x9bdc06a725c71235, 0xc19bf174cf692694,
+	0xe49b69c19ef14ad2, 0xefbe4786384f25e3, 0x0fc19dc68b8cd5b5, 0x240ca1cc77ac9c65,
+	0x2de92c6f592b0275, 0x4a7484aa6ea6e483, 0x5cb0a9dcbd41fbd4, 0x76f988da831153b5,
+	0x983e5152ee66dfab, 0xa831c66d2db43210, 0xb00327c898fb213f, 0xbf597fc7beef0ee4,
+	0xc6e00bf33da88fc2, 0xd5a79147930aa725, 0x06ca6351e003826f, 0x142929670a0e6e70,
+	0x27b70a8546d22ffc, 0x2e1b21385c26c926, 0x4d2c6dfc5ac42aed, 0x53380d139d95b3df,
+	0x650a73548baf63de, 0x766a0abb3c77b2a8, 0x81c2c92e47edaee6, 0x92722c851482353b,
+	0xa2bfe8a14cf10364, 0xa81a664bbc423001, 0xc24b8b70d0f89791, 0xc76c51a30654be30,
+	0xd192e819d6ef5218, 0xd69906245565a910, 0xf40e35855771202a, 0x106aa07032bbd1b8,
+	0x19a4c116b8d2d0c8, 0x1e376c085141ab53, 0x2748774cdf8eeb99, 0x34b0bcb5e19b48a8,
+	0x391c0cb3c5c95a63, 0x4ed8aa4ae3418acb, 0x5b9cca4f7763e373, 0x682e6ff3d6b2b8a3,
+	0x748f82ee5defb2fc, 0x78a5636f43172f60, 0x84c87814a1f0ab72, 0x8cc702081a6439ec,
+	0x90befffa23631e28, 0xa4506cebde82bde9, 0xbef9a3f7b2c67915, 0xc67178f2e372532b,
+	0xca273eceea26619c, 0xd186b8c721c0c207, 0xeada7dd6cde0eb1e, 0xf57d4f7fee6ed178,
+	0x06f067aa72176fba, 0x0a637dc5a2c898a6, 0x113f9804bef90dae, 0x1b710b35131c471b,
+	0x28db77f523047d84, 0x32caab7b40c72493, 0x3c9ebe0a15c9bebc, 0x431d67c49c100d4c,
+	0x4cc5d4becb3e42b6, 0x597f299cfc657e2a, 0x5fcb6fab3ad6faec, 0x6c44198c4a475817,
+};
+
+// rounds 2*i, 2*i+1 with s0 = W[2i, 2i+1], s0 is replaced by W[2i+16, 2i+17]
+#define SHA512_CE_DROUND(i, s0, s1, s4, s5, s7)				\
+	wk = vaddq_u64(s0, vld1q_u64(K + 2 * (i)));			\
+	if ((i) < 32) {							\
+		s0 = vsha512su0q_u64(s0, s1);				\
+		s0 = vsha512su1q_u64(s0, s7, vextq_u64(s4, s5, 1));	\
+	}								\
+	t = vaddq_u64(gh, vextq_u64(wk, wk, 1));			\
+	t = vsha512hq_u64(t, vextq_u64(ef, gh, 1), vextq_u64(cd, ef, 1));\
+	gh = ef;							\
+	ef = vaddq_u64(cd, t);						\
+	t = vsha512h2q_u64(t, cd, ab);					\
+	cd = ab;							\
+	ab = t
+
+void sha512_ce_compress_blocks(uint64_t state[8], const unsigned char *data, size_t blocks)
+{
+	uint64x2_t ab, cd, ef, gh, ab0, cd0, ef0, gh0;
+	uint64x2_t w0, w1, w2, w3, w4, w5, w6, w7, wk, t;
+	int i;
+
+	ab = vld1q_u64(state);
+	cd = vld1q_u64(state + 2);
+	ef = vld1q_u64(state + 4);
+	gh = vld1q_u64(state + 6);
+
+	while (blocks--) {
+		ab0 = ab;
+		cd0 = cd;
+		ef0 = ef;
+		gh0 = gh;
+
+		w0 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data)));
+		w1 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 16)));
+		w2 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 32)));
+		w3 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 48)));
+		w4 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 64)));
+		w5 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 80)));
+		w6 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 96)));
+		w7 = vreinterpretq_u64_u8(vrev64q_u8(vld1q_u8(data + 112)));
+
+		for (i = 0; i < 40; i += 8) {
+			SHA512_CE_DROUND(i    , w0, w1, w4, w5, w7);
+			SHA512_CE_DROUND(i + 1, w1, w2, w5, w6, w0);
+			SHA512_CE_DROUND(i + 2, w2, w3, w6, w7, w1);
+			SHA512_CE_DROUND(i + 3, w3, w4, w7, w0, w2);
+			SHA512_CE_DROUND(i + 4, w4, w5, w0, w1, w3);
+			SHA512_CE_DROUND(i + 5, w5, w6, w1, w2, w4);
+			SHA512_CE_DROUND(i + 6, w6, w7, w2, w3, w5);
+			SHA512_CE_DROUND(i + 7, w7, w0, w3, w4, w6);
+		}
+
+		ab = vaddq_u64(ab, ab0);
+		cd = vaddq_u64(cd, cd0);
+		ef = vaddq_u64(ef, ef0);
+		gh = vaddq_u64(gh, gh0);
+
+		data += 128;
+	}
+
+	vst1q_u64(state, ab);
+	vst1q_u64(state + 2, cd);
+	vst1q_u64(state + 4, ef);
+	vst1q_u64(state + 6, gh);
+}
@@ -11,6 +11,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
 #include <gmssl/skf.h>
 #include <gmssl/error.h>
 #include "../sgd.h"
@@ -62,7 +64,8 @@ static const uint8_t zeros[ECC_MAX_XCOORDINATE_BITS_LEN/8 - 32] = {0};
 
 static int SKF_ECCPUBLICKEYBLOB_to_SM2_KEY(const ECCPUBLICKEYBLOB *blob, SM2_KEY *sm2_key)
 {
-	SM2_POINT point;
+	uint8_t point[64];
+	SM2_Z256_POINT P;
 
 	if (blob->BitLen != 256) {
 		error_print();
@@ -73,10 +76,10 @@ static int SKF_ECCPUBLICKEYBLOB_to_SM2_KEY(const ECCPUBLICKEYBLOB *blob, SM2_KEY
 		error_print();
 		return -1;
 	}
-	if (sm2_point_from_xy(&point,
-			blob->XCoordinate + ECC_MAX_XCOORDINATE_BITS_LEN/8 - 32,
-			blob->YCoordinate + ECC_MAX_YCOORDINATE_BITS_LEN/8 - 32) != 1
-		|| sm2_key_set_public_key(sm2_key, &point) != 1) {
+	memcpy(point, blob->XCoordinate + ECC_MAX_XCOORDINATE_BITS_LEN/8 - 32, 32);
+	memcpy(point + 32, blob->YCoordinate + ECC_MAX_YCOORDINATE_BITS_LEN/8 - 32, 32);
+	if (sm2_z256_point_from_bytes(&P, point) != 1
+		|| sm2_key_set_public_key(sm2_key, &P) != 1) {
 		error_print();
 		return -1;
 	}
@@ -105,21 +108,21 @@ int skf_rand_bytes(SKF_DEVICE *dev, uint8_t *buf, size_t len)
 	return 1;
 }
 
-int skf_load_sign_key(SKF_DEVICE *dev, const char *appname, const char *pin, const char *container_name, SKF_KEY *key)
+int skf_rand_pool_fill(void *dev, uint8_t *buf, size_t len)
+{
+	return skf_rand_bytes((SKF_DEVICE *)dev, buf, len);
+}
+
+static int skf_open_sign_container(HAPPLICATION hApp, const char *container_name,
+	HCONTAINER *phContainer, SM2_KEY *public_key)
 {
 	int ret = -1;
-	HAPPLICATION hApp = NULL;
 	HCONTAINER hContainer = NULL;
 	ULONG containerType = 0;
 	BOOL bSign = SGD_TRUE;
 	ECCPUBLICKEYBLOB publicKeyBlob;
 	ULONG ulBlobLen = sizeof(ECCPUBLICKEYBLOB);
-	SM2_KEY public_key;
 
-	if (skf_open_app(dev, appname, pin, &hApp) != 1) {
-		error_print();
-		return -1;
-	}
 	if (SKF_OpenContainer(hApp, (LPSTR)container_name, &hContainer) != SAR_OK
 		|| SKF_GetContainerType(hContainer, &containerType) != SAR_OK) {
 		error_print();
@@ -137,7 +140,30 @@ int skf_load_sign_key(SKF_DEVICE *dev, const char *appname, const char *pin, con
 		error_print();
 		goto end;
 	}
-	if (SKF_ECCPUBLICKEYBLOB_to_SM2_KEY(&publicKeyBlob, &public_key) != SAR_OK) {
+	if (SKF_ECCPUBLICKEYBLOB_to_SM2_KEY(&publicKeyBlob, public_key) != SAR_OK) {
+		error_print();
+		goto end;
+	}
+	*phContainer = hContainer;
+	hContainer = NULL;
+	ret = 1;
+end:
+	if (hContainer) SKF_CloseContainer(hContainer);
+	return ret;
+}
+
+int skf_load_sign_key(SKF_DEVICE *dev, const char *appname, const char *pin, const char *container_name, SKF_KEY *key)
+{
+	int ret = -1;
+	HAPPLICATION hApp = NULL;
+	HCONTAINER hContainer = NULL;
+	SM2_KEY public_key;
+
+	if (skf_open_app(dev, appname, pin, &hApp) != 1) {
+		error_print();
+		return -1;
+	}
+	if (skf_open_sign_container(hApp, container_name, &hContainer, &public_key) != 1) {
 		error_print();
 		goto end;
 	}
@@ -152,7 +178,6 @@ int skf_load_sign_key(SKF_DEVICE *dev, const char *appname, const char *pin, con
 	ret = 1;
 end:
 	if (hApp) SKF_CloseApplication(hApp);
-	if (hContainer) SKF_CloseContainer(hContainer);
 	return ret;
 }
 
@@ -209,6 +234,254 @@ int skf_close_device(SKF_DEVICE *dev)
 }
 
 
+struct SKF_KEY_CACHE_st {
+	SKF_DEVICE *dev;
+	char app_name[65];
+	char pin[SKF_MAX_PIN_SIZE + 1];
+	HAPPLICATION hApp;
+	SKF_KEY keys[SKF_KEY_CACHE_SIZE]; // the app_handle of the keys is hApp
+	size_t keys_cnt;
+};
+
+static void skf_key_cache_close(SKF_KEY_CACHE *cache)
+{
+	size_t i;
+
+	for (i = 0; i < cache->keys_cnt; i++) {
+		if (cache->keys[i].container_handle) {
+			SKF_CloseContainer(cache->keys[i].container_handle);
+			cache->keys[i].container_handle = NULL;
+		}
+		cache->keys[i].app_handle = NULL;
+	}
+	if (cache->hApp) {
+		SKF_ClearSecureState(cache->hApp);
+		SKF_CloseApplication(cache->hApp);
+		cache->hApp = NULL;
+	}
+}
+
+// reopen the application and the containers opened before
+static int skf_key_cache_reopen(SKF_KEY_CACHE *cache)
+{
+	SM2_KEY public_key;
+	size_t i;
+
+	skf_key_cache_close(cache);
+	if (skf_open_app(cache->dev, cache->app_name, cache->pin, &cache->hApp) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < cache->keys_cnt; i++) {
+		SKF_KEY *key = &cache->keys[i];
+		if (skf_open_sign_container(cache->hApp, key->container_name, &key->container_handle, &public_key) != 1) {
+			error_print();
+			return -1;
+		}
+		// the key of a container must not change while it is cached
+		if (memcmp(&public_key.public_key, &key->public_key.public_key, sizeof(SM2_Z256_POINT)) != 0) {
+			error_print();
+			return -1;
+		}
+		key->app_handle = cache->hApp;
+	}
+	return 1;
+}
+
+static SKF_KEY *skf_key_cache_find(SKF_KEY_CACHE *cache, const char *container_name)
+{
+	SKF_KEY *key;
+	size_t i;
+
+	if (!container_name || strlen(container_name) > 64) {
+		error_print();
+		return NULL;
+	}
+	for (i = 0; i < cache->keys_cnt; i++) {
+		if (strcmp(cache->keys[i].container_name, container_name) == 0) {
+			return &cache->keys[i];
+		}
+	}
+	if (cache->keys_cnt >= SKF_KEY_CACHE_SIZE) {
+		error_print();
+		return NULL;
+	}
+	if (!cache->hApp && skf_key_cache_reopen(cache) != 1) {
+		error_print();
+		return NULL;
+	}
+	key = &cache->keys[cache->keys_cnt];
+	memset(key, 0, sizeof(SKF_KEY));
+	if (skf_open_sign_container(cache->hApp, container_name, &key->container_handle, &key->public_key) != 1) {
+		error_print();
+		return NULL;
+	}
+	key->app_handle = cache->hApp;
+	strncpy(key->app_name, cache->app_name, 64);
+	strncpy(key->container_name, container_name, 64);
+	cache->keys_cnt++;
+	return key;
+}
+
+static int skf_key_cache_do_sign(SKF_KEY_CACHE *cache, SKF_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig)
+{
+	ECCSIGNATUREBLOB sigBlob;
+	ULONG numRetry;
+	ULONG rv;
+
+	if ((rv = SKF_ECCSignData(key->container_handle, (BYTE *)dgst, 32, &sigBlob)) != SAR_OK) {
+		if (rv == SAR_USER_NOT_LOGGED_IN) {
+			if (SKF_VerifyPIN(cache->hApp, USER_TYPE, (CHAR *)cache->pin, &numRetry) != SAR_OK) {
+				fprintf(stderr, "Invalid user PIN, retry count = %u\n", numRetry);
+				error_print();
+				return -1;
+			}
+		} else if (skf_key_cache_reopen(cache) != 1) {
+			error_print();
+			return -1;
+		}
+		if (SKF_ECCSignData(key->container_handle, (BYTE *)dgst, 32, &sigBlob) != SAR_OK) {
+			error_print();
+			return -1;
+		}
+	}
+	if (SKF_ECCSIGNATUREBLOB_to_SM2_SIGNATURE(&sigBlob, sig) != SAR_OK) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+SKF_KEY_CACHE *skf_key_cache_new(SKF_DEVICE *dev, const char *appname, const char *pin)
+{
+	SKF_KEY_CACHE *cache;
+
+	if (!dev || !appname || !pin) {
+		error_print();
+		return NULL;
+	}
+	if (strlen(appname) > 64 || strlen(pin) > SKF_MAX_PIN_SIZE) {
+		error_print();
+		return NULL;
+	}
+	if (!(cache = (SKF_KEY_CACHE *)calloc(1, sizeof(SKF_KEY_CACHE)))) {
+		error_print();
+		return NULL;
+	}
+	cache->dev = dev;
+	strcpy(cache->app_name, appname);
+	strcpy(cache->pin, pin);
+	if (skf_key_cache_reopen(cache) != 1) {
+		error_print();
+		skf_key_cache_free(cache);
+		return NULL;
+	}
+	return cache;
+}
+
+int skf_key_cache_get_public_key(SKF_KEY_CACHE *cache, const char *container_name, SM2_KEY *public_key)
+{
+	SKF_KEY *key;
+
+	if (!cache || !public_key) {
+		error_print();
+		return -1;
+	}
+	if (!(key = skf_key_cache_find(cache, container_name))) {
+		error_print();
+		return -1;
+	}
+	*public_key = key->public_key;
+	return 1;
+}
+
+int skf_key_cache_sign(SKF_KEY_CACHE *cache, const char *container_name,
+	const uint8_t dgst[32], uint8_t *sig, size_t *siglen)
+{
+	SKF_KEY *key;
+	SM2_SIGNATURE sm2_sig;
+
+	if (!cache || !dgst || !sig || !siglen) {
+		error_print();
+		return -1;
+	}
+	if (!(key = skf_key_cache_find(cache, container_name))) {
+		error_print();
+		return -1;
+	}
+	if (skf_key_cache_do_sign(cache, key, dgst, &sm2_sig) != 1) {
+		error_print();
+		return -1;
+	}
+	*siglen = 0;
+	if (sm2_signature_to_der(&sm2_sig, &sig, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int skf_key_cache_sign_messages(SKF_KEY_CACHE *cache, const char *container_name, const char *id, size_t idlen,
+	const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *sigs, size_t *siglens)
+{
+	SKF_KEY *key;
+	SM3_CTX z_ctx;
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[32];
+	SM2_SIGNATURE sm2_sig;
+	size_t i;
+
+	if (!cache || !msgs || !msglens || !sigs || !siglens) {
+		error_print();
+		return -1;
+	}
+	if (id && (!idlen || idlen > SM2_MAX_ID_LENGTH)) {
+		error_print();
+		return -1;
+	}
+	if (!(key = skf_key_cache_find(cache, container_name))) {
+		error_print();
+		return -1;
+	}
+
+	// Z is the same for all the messages
+	sm3_init(&z_ctx);
+	if (id) {
+		uint8_t z[SM3_DIGEST_SIZE];
+		sm2_compute_z(z, &key->public_key.public_key, id, idlen);
+		sm3_update(&z_ctx, z, sizeof(z));
+	}
+
+	for (i = 0; i < cnt; i++) {
+		uint8_t *sig = sigs + i * SM2_MAX_SIGNATURE_SIZE;
+
+		sm3_ctx = z_ctx;
+		sm3_update(&sm3_ctx, msgs[i], msglens[i]);
+		sm3_finish(&sm3_ctx, dgst);
+
+		if (skf_key_cache_do_sign(cache, key, dgst, &sm2_sig) != 1) {
+			error_print();
+			return -1;
+		}
+		siglens[i] = 0;
+		if (sm2_signature_to_der(&sm2_sig, &sig, &siglens[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+void skf_key_cache_free(SKF_KEY_CACHE *cache)
+{
+	if (cache) {
+		skf_key_cache_close(cache);
+		gmssl_secure_clear(cache->pin, sizeof(cache->pin));
+		free(cache);
+	}
+}
+
+
 
 
 
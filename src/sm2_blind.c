@@ -12,28 +12,49 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
 #include <gmssl/mem.h>
+#include <gmssl/rand.h>
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
 #include <gmssl/sm2_blind.h>
+#include <gmssl/thread_pool.h>
 
 
-extern SM2_BN SM2_N;
-extern SM2_BN SM2_ONE;
 
-int sm2_blind_sign_commit(SM2_Fn k, uint8_t *commit, size_t *commitlen)
+// rand k in [1, n - 1]
+static int sm2_blind_rand(sm2_z256_t k)
 {
-	SM2_POINT K;
-	uint8_t k_bytes[32];
+	do {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(k));
+	return 1;
+}
+
+int sm2_blind_sign_commit(sm2_z256_t k, uint8_t *commit, size_t *commitlen)
+{
+	SM2_Z256_POINT K;
 
-	sm2_fn_rand(k); // FIXME: check return
-	sm2_bn_to_bytes(k, k_bytes);
+	if (!k || !commit || !commitlen) {
+		error_print();
+		return -1;
+	}
+	if (sm2_blind_rand(k) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// commitment = k * G
-	sm2_point_mul_generator(&K, k_bytes);
-	sm2_point_to_compressed_octets(&K, commit);
+	sm2_z256_point_mul_generator(&K, k);
+	if (sm2_z256_point_to_compressed_octets(&K, commit) != 1) {
+		gmssl_secure_clear(k, sizeof(sm2_z256_t));
+		error_print();
+		return -1;
+	}
 	*commitlen = 33;
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
 
 	return 1;
 }
@@ -71,49 +92,52 @@ int sm2_blind_sign_finish(SM2_BLIND_SIGN_CTX *ctx,
 	uint8_t blinded_sig_r[32])
 {
 	int ret = -1;
-	SM2_Fn a;
-	SM2_Fn b;
-	SM2_POINT K;
-	SM2_Fn e;
-	SM2_Fn r;
+	sm2_z256_t a;
+	sm2_z256_t b;
+	SM2_Z256_POINT K;
+	SM2_Z256_POINT R;
+	sm2_z256_t e;
+	sm2_z256_t r;
 	uint8_t dgst[32];
 
 	sm3_finish(&ctx->sm3_ctx, dgst);
-	sm2_bn_from_bytes(e, dgst);
-	if (sm2_bn_cmp(e, SM2_N) >= 0) {
-		sm2_bn_sub(e, e, SM2_N);
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
 	}
 
-	//FIXME: return value of sm2_fn_rand()
-	sm2_fn_rand(a);
-	sm2_bn_to_bytes(a, ctx->blind_factor_a);
-	sm2_fn_rand(b);
-	sm2_bn_to_bytes(b, ctx->blind_factor_b);
+	if (sm2_blind_rand(a) != 1
+		|| sm2_blind_rand(b) != 1) {
+		error_print();
+		goto end;
+	}
+	sm2_z256_to_bytes(a, ctx->blind_factor_a);
+	sm2_z256_to_bytes(b, ctx->blind_factor_b);
 
-	if (sm2_point_from_octets(&K, commit, commitlen) != 1) {
+	if (sm2_z256_point_from_octets(&K, commit, commitlen) != 1) {
 		error_print();
 		goto end;
 	}
 	// K'(x1, y1) = a * K + b * G
-	if (sm2_point_mul_sum(&K, ctx->blind_factor_a, &K, ctx->blind_factor_b) != 1) {
+	sm2_z256_point_mul_sum(&R, a, &K, b);
+	if (sm2_z256_point_get_xy(&R, r, NULL) != 1) {
 		error_print();
 		goto end;
 	}
-	sm2_bn_from_bytes(r, K.x);
-	if (sm2_bn_cmp(r, SM2_N) >= 0) {
-		sm2_bn_sub(r, r, SM2_N);
+	if (sm2_z256_cmp(r, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(r, r, sm2_z256_order());
 	}
 
 	// r = x1 + e (mod n)
-	sm2_fn_add(r, r, e);
-	sm2_bn_to_bytes(r, ctx->sig_r);
+	sm2_z256_modn_add(r, r, e);
+	sm2_z256_to_bytes(r, ctx->sig_r);
 
 	// r' = a^-1 * (r + b)
-	sm2_fn_add(r, r, b);
-	sm2_fn_inv(a, a);
-	sm2_fn_mul(r, r, a);
+	sm2_z256_modn_add(r, r, b);
+	sm2_z256_modn_inv(a, a);
+	sm2_z256_modn_mul(r, r, a);
 
-	sm2_bn_to_bytes(r, blinded_sig_r);
+	sm2_z256_to_bytes(r, blinded_sig_r);
 	ret = 1;
 
 end:
@@ -122,46 +146,63 @@ end:
 	return ret;
 }
 
-int sm2_blind_sign(const SM2_KEY *key, const SM2_Fn k, const uint8_t blinded_r[32], uint8_t blinded_s[32])
+// s = (1 + x)^-1 * (k - r * x) = (k + r) * x' - r (mod n), x' = (1 + x)^-1
+static void sm2_blind_sign_with_key(const sm2_z256_t fast_private, const sm2_z256_t k,
+	const uint8_t blinded_r[32], uint8_t blinded_s[32])
 {
-	SM2_Fn x;
-	SM2_Fn r;
-	SM2_Fn s;
+	sm2_z256_t r;
+	sm2_z256_t s;
 
-	sm2_bn_from_bytes(x, key->private_key);
-	sm2_bn_from_bytes(r, blinded_r);
+	sm2_z256_from_bytes(r, blinded_r);
+	if (sm2_z256_cmp(r, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(r, r, sm2_z256_order());
+	}
+	sm2_z256_modn_add(s, k, r);
+	sm2_z256_modn_mul(s, s, fast_private);
+	sm2_z256_modn_sub(s, s, r);
+	sm2_z256_to_bytes(s, blinded_s);
 
-	// s = (1 + x)^-1 * (k - r * x) (mod n)
-	sm2_fn_mul(r, r, x);
-	sm2_fn_sub(s, k, r);
-	sm2_fn_add(x, x, SM2_ONE);
-	sm2_fn_inv(x, x);
-	sm2_fn_mul(s, s, x);
-	sm2_bn_to_bytes(s, blinded_s);
+	gmssl_secure_clear(s, sizeof(s));
+}
+
+int sm2_blind_sign(const SM2_KEY *key, const sm2_z256_t k, const uint8_t blinded_r[32], uint8_t blinded_s[32])
+{
+	sm2_z256_t x;
+
+	if (!key || !k || !blinded_r || !blinded_s) {
+		error_print();
+		return -1;
+	}
+	if (sm2_fast_sign_compute_key(key, x) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_blind_sign_with_key(x, k, blinded_r, blinded_s);
 
 	gmssl_secure_clear(x, sizeof(x));
-	gmssl_secure_clear(r, sizeof(r));
-	gmssl_secure_clear(s, sizeof(s));
 	return 1;
 }
 
 int sm2_blind_sign_unblind(SM2_BLIND_SIGN_CTX *ctx, const uint8_t blinded_sig_s[32], uint8_t *sig, size_t *siglen)
 {
-	SM2_Fn a;
-	SM2_Fn b;
-	SM2_Fn s;
+	sm2_z256_t a;
+	sm2_z256_t b;
+	sm2_z256_t s;
 	SM2_SIGNATURE signature;
 
-	sm2_bn_from_bytes(a, ctx->blind_factor_a);
-	sm2_bn_from_bytes(b, ctx->blind_factor_b);
-	sm2_bn_from_bytes(s, blinded_sig_s);
+	sm2_z256_from_bytes(a, ctx->blind_factor_a);
+	sm2_z256_from_bytes(b, ctx->blind_factor_b);
+	sm2_z256_from_bytes(s, blinded_sig_s);
+	if (sm2_z256_cmp(s, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(s, s, sm2_z256_order());
+	}
 
 	// s = a * s' + b
-	sm2_fn_mul(s, s, a);
-	sm2_fn_add(s, s, b);
+	sm2_z256_modn_mul(s, s, a);
+	sm2_z256_modn_add(s, s, b);
 
 	memcpy(signature.r, ctx->sig_r, 32);
-	sm2_bn_to_bytes(s, signature.s);
+	sm2_z256_to_bytes(s, signature.s);
 
 
 	*siglen = 0;
@@ -172,3 +213,174 @@ int sm2_blind_sign_unblind(SM2_BLIND_SIGN_CTX *ctx, const uint8_t blinded_sig_s[
 	gmssl_secure_clear(ctx, sizeof(*ctx));
 	return 1;
 }
+
+typedef struct {
+	// commit
+	sm2_z256_t *k;
+	uint8_t (*commits)[33];
+	// sign
+	const uint64_t *fast_private;
+	const sm2_z256_t *sign_k;
+	const uint8_t (*blinded_r)[32];
+	uint8_t (*blinded_s)[32];
+
+	size_t first;
+	size_t last;
+	int ret;
+} SM2_BLIND_SIGN_JOB;
+
+static int sm2_blind_sign_commit_range(sm2_z256_t *k, uint8_t (*commits)[33], size_t n)
+{
+	SM2_Z256_POINT P[SM2_BLIND_SIGN_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT A[SM2_BLIND_SIGN_BATCH_SIZE];
+	size_t i;
+	int ret = -1;
+
+	// rand k in [1, n - 1], redraw the rare out of range ones one by one
+	if (rand_bytes((uint8_t *)k, sizeof(sm2_z256_t) * n) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < n; i++) {
+		while (sm2_z256_is_zero(k[i]) || sm2_z256_cmp(k[i], sm2_z256_order()) >= 0) {
+			if (sm2_blind_rand(k[i]) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		sm2_z256_point_mul_generator(&P[i], k[i]);
+	}
+
+	// Z = 1 after the shared inversion, the encoding does not invert again
+	sm2_z256_points_get_affine_batch(P, n, A);
+	for (i = 0; i < n; i++) {
+		sm2_z256_point_copy_affine(&P[i], &A[i]);
+		if (sm2_z256_point_to_compressed_octets(&P[i], commits[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+
+end:
+	gmssl_secure_clear(P, sizeof(P));
+	gmssl_secure_clear(A, sizeof(A));
+	return ret;
+}
+
+static void sm2_blind_sign_job(SM2_BLIND_SIGN_JOB *job)
+{
+	size_t first, n;
+
+	for (first = job->first; first < job->last; first += n) {
+		n = job->last - first < SM2_BLIND_SIGN_BATCH_SIZE ? job->last - first : SM2_BLIND_SIGN_BATCH_SIZE;
+		if (job->k) {
+			if (sm2_blind_sign_commit_range(job->k + first, job->commits + first, n) != 1) {
+				error_print();
+				job->ret = -1;
+				break;
+			}
+		} else {
+			size_t i;
+			for (i = first; i < first + n; i++) {
+				sm2_blind_sign_with_key(job->fast_private, job->sign_k[i],
+					job->blinded_r[i], job->blinded_s[i]);
+			}
+		}
+	}
+}
+
+static void sm2_blind_sign_task(void *arg)
+{
+	sm2_blind_sign_job((SM2_BLIND_SIGN_JOB *)arg);
+}
+
+// split [0, num) of `job` across threads, each with at least min_per_thread entries
+static int sm2_blind_sign_run(const SM2_BLIND_SIGN_JOB *job, size_t num, size_t min_per_thread, int threads)
+{
+	SM2_BLIND_SIGN_JOB jobs[SM2_BLIND_SIGN_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM2_BLIND_SIGN_MAX_THREADS) {
+		threads = SM2_BLIND_SIGN_MAX_THREADS;
+	}
+	if ((size_t)threads > num / min_per_thread) {
+		threads = num / min_per_thread ? (int)(num / min_per_thread) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i] = *job;
+		jobs[i].first = (num * i) / threads;
+		jobs[i].last = (num * (i + 1)) / threads;
+		jobs[i].ret = 1;
+	}
+	gmssl_thread_pool_run(sm2_blind_sign_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+int sm2_blind_sign_commit_batch(sm2_z256_t *k, uint8_t (*commits)[33], size_t count, int threads)
+{
+	SM2_BLIND_SIGN_JOB job;
+
+	if (!k || !commits) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+
+	memset(&job, 0, sizeof(job));
+	job.k = k;
+	job.commits = commits;
+	if (sm2_blind_sign_run(&job, count, SM2_BLIND_SIGN_BATCH_SIZE, threads) != 1) {
+		gmssl_secure_clear(k, sizeof(sm2_z256_t) * count);
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm2_blind_sign_batch(const SM2_KEY *key, const sm2_z256_t *k,
+	const uint8_t (*blinded_r)[32], uint8_t (*blinded_s)[32], size_t count, int threads)
+{
+	SM2_BLIND_SIGN_JOB job;
+	sm2_z256_t x;
+	int ret;
+
+	if (!key || !k || !blinded_r || !blinded_s) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+
+	// one inversion of (1 + x) for all the requests
+	if (sm2_fast_sign_compute_key(key, x) != 1) {
+		error_print();
+		return -1;
+	}
+	memset(&job, 0, sizeof(job));
+	job.fast_private = x;
+	job.sign_k = k;
+	job.blinded_r = blinded_r;
+	job.blinded_s = blinded_s;
+	ret = sm2_blind_sign_run(&job, count, SM2_BLIND_SIGN_THREAD_MIN_SIGNS, threads);
+
+	gmssl_secure_clear(x, sizeof(x));
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
@@ -0,0 +1,574 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2_cl.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/error.h>
+
+
+// uint words of one item: X, Y, Z of the public key, s, t, r - e (mod n)
+#define SM2_CL_ITEM_WORDS	48
+
+static const char *sm2_cl_src;
+
+
+void sm2_cl_cleanup(SM2_CL_CTX *ctx)
+{
+	if (ctx->mem_out) clReleaseMemObject(ctx->mem_out);
+	if (ctx->mem_in) clReleaseMemObject(ctx->mem_in);
+	if (ctx->kernel) clReleaseKernel(ctx->kernel);
+	if (ctx->program) clReleaseProgram(ctx->program);
+	if (ctx->queue) clReleaseCommandQueue(ctx->queue);
+	if (ctx->context) clReleaseContext(ctx->context);
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+int sm2_cl_init(SM2_CL_CTX *ctx, const SM4_CL_CTX *share)
+{
+	cl_int err;
+
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (share) {
+		if ((err = clRetainContext(share->context)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+		ctx->context = share->context;
+		if ((err = clRetainCommandQueue(share->queue)) != CL_SUCCESS) {
+			cl_error_print(err);
+			goto end;
+		}
+		ctx->queue = share->queue;
+		ctx->device = share->device;
+	} else {
+		if (gmssl_cl_open_device(&ctx->context, &ctx->device, &ctx->queue) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (gmssl_cl_build_program(ctx->context, ctx->device, sm2_cl_src, &ctx->program) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(ctx->kernel = clCreateKernel(ctx->program, "sm2_cl_verify", &err))) {
+		cl_error_print(err);
+		goto end;
+	}
+	return 1;
+
+end:
+	sm2_cl_cleanup(ctx);
+	return -1;
+}
+
+// grow the device buffer `*mem` to at least `len` bytes, the content is not kept
+static int sm2_cl_reserve(SM2_CL_CTX *ctx, cl_mem *mem, size_t *size, size_t len)
+{
+	cl_int err;
+
+	if (*size >= len && *mem) {
+		return 1;
+	}
+	if (*mem) {
+		clReleaseMemObject(*mem);
+		*mem = NULL;
+		*size = 0;
+	}
+	if (!(*mem = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE, len, NULL, &err))) {
+		cl_error_print(err);
+		return -1;
+	}
+	*size = len;
+	return 1;
+}
+
+static void sm2_cl_set_words(uint32_t w[8], const sm2_z256_t a)
+{
+	int i;
+	for (i = 0; i < 4; i++) {
+		w[2*i] = (uint32_t)a[i];
+		w[2*i + 1] = (uint32_t)(a[i] >> 32);
+	}
+}
+
+// an invalid r or s gets s = t = 0, then R is the point at infinity and the item fails
+static void sm2_cl_set_item(uint32_t w[SM2_CL_ITEM_WORDS], const SM2_KEY *key,
+	const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+{
+	sm2_z256_t r;
+	sm2_z256_t s;
+	sm2_z256_t t;
+	sm2_z256_t e;
+
+	sm2_cl_set_words(w, key->public_key.X);
+	sm2_cl_set_words(w + 8, key->public_key.Y);
+	sm2_cl_set_words(w + 16, key->public_key.Z);
+
+	sm2_z256_from_bytes(r, sig->r);
+	sm2_z256_from_bytes(s, sig->s);
+	sm2_z256_modn_add(t, r, s);
+	if (sm2_z256_is_zero(r) || sm2_z256_cmp(r, sm2_z256_order()) >= 0
+		|| sm2_z256_is_zero(s) || sm2_z256_cmp(s, sm2_z256_order()) >= 0
+		|| sm2_z256_is_zero(t)) {
+		memset(w + 24, 0, sizeof(uint32_t) * 24);
+		return;
+	}
+
+	// r == e + x (mod n) <=> x == r - e (mod n)
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
+	}
+	sm2_z256_modn_sub(e, r, e);
+
+	sm2_cl_set_words(w + 24, s);
+	sm2_cl_set_words(w + 32, t);
+	sm2_cl_set_words(w + 40, e);
+}
+
+int sm2_cl_verify_batch(SM2_CL_CTX *ctx, const SM2_KEY *const *keys, const uint8_t (*dgsts)[32],
+	const SM2_SIGNATURE *sigs, size_t count, uint8_t *bitmap)
+{
+	uint32_t *words = NULL;
+	uint8_t *oks = NULL;
+	size_t chunk = count < SM2_CL_VERIFY_CHUNK ? count : SM2_CL_VERIFY_CHUNK;
+	size_t done;
+	cl_int err;
+	int ret = -1;
+
+	if (!ctx || !keys || !dgsts || !sigs || !bitmap) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+	memset(bitmap, 0, (count + 7)/8);
+
+	if (!(words = (uint32_t *)malloc(sizeof(uint32_t) * SM2_CL_ITEM_WORDS * chunk))
+		|| !(oks = (uint8_t *)malloc(chunk))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_cl_reserve(ctx, &ctx->mem_in, &ctx->mem_in_size, sizeof(uint32_t) * SM2_CL_ITEM_WORDS * chunk) != 1
+		|| sm2_cl_reserve(ctx, &ctx->mem_out, &ctx->mem_out_size, chunk) != 1) {
+		error_print();
+		goto end;
+	}
+	if ((err = clSetKernelArg(ctx->kernel, 0, sizeof(cl_mem), &ctx->mem_in)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel, 2, sizeof(cl_mem), &ctx->mem_out)) != CL_SUCCESS) {
+		cl_error_print(err);
+		goto end;
+	}
+
+	ret = 1;
+	for (done = 0; done < count; done += chunk) {
+		size_t n = count - done < chunk ? count - done : chunk;
+		cl_uint n32 = (cl_uint)n;
+		size_t local_work_size = 32;
+		size_t global_work_size = (n + local_work_size - 1)/local_work_size * local_work_size;
+		size_t i;
+
+		for (i = 0; i < n; i++) {
+			sm2_cl_set_item(words + SM2_CL_ITEM_WORDS * i, keys[done + i], dgsts[done + i], &sigs[done + i]);
+		}
+
+		// the blocking read of the last part keeps `words` from being refilled too early
+		if ((err = clEnqueueWriteBuffer(ctx->queue, ctx->mem_in, CL_FALSE, 0,
+			sizeof(uint32_t) * SM2_CL_ITEM_WORDS * n, words, 0, NULL, NULL)) != CL_SUCCESS
+			|| (err = clSetKernelArg(ctx->kernel, 1, sizeof(cl_uint), &n32)) != CL_SUCCESS
+			|| (err = clEnqueueNDRangeKernel(ctx->queue, ctx->kernel,
+				1, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS
+			|| (err = clEnqueueReadBuffer(ctx->queue, ctx->mem_out, CL_TRUE, 0,
+				n, oks, 0, NULL, NULL)) != CL_SUCCESS) {
+			cl_error_print(err);
+			ret = -1;
+			goto end;
+		}
+
+		for (i = 0; i < n; i++) {
+			if (oks[i]) {
+				bitmap[(done + i)/8] |= (uint8_t)(1 << ((done + i) % 8));
+			} else {
+				ret = 0;
+			}
+		}
+	}
+
+end:
+	if (words) free(words);
+	if (oks) free(oks);
+	return ret;
+}
+
+
+/*
+ * The field elements are 8 uint limbs, little-endian, in the Montgomery form
+ * of sm2_z256 (R = 2^256). As p = -1 (mod 2^32), the Montgomery factor of
+ * each round is the lowest limb itself. The points are Jacobian, Z = 0 is the
+ * point at infinity.
+ */
+#define KERNEL(...) #__VA_ARGS__
+static const char *sm2_cl_src = KERNEL(
+
+__constant uint SM2_P[8] = {
+	0xFFFFFFFF, 0xFFFFFFFF, 0x00000000, 0xFFFFFFFF,
+	0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE,
+};
+
+__constant uint SM2_N[8] = {
+	0x39D54123, 0x53BBF409, 0x21C6052B, 0x7203DF6B,
+	0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFE,
+};
+
+// R^2 mod p
+__constant uint SM2_R2[8] = {
+	0x00000003, 0x00000002, 0xFFFFFFFF, 0x00000002,
+	0x00000001, 0x00000001, 0x00000002, 0x00000004,
+};
+
+// the generator, Z = R mod p
+__constant uint SM2_G[24] = {
+	0xF418029E, 0x61328990, 0xDCA6C050, 0x3E7981ED,
+	0xAC24C3C3, 0xD6A1ED99, 0xE1C13B05, 0x91167A5E,
+	0x3C2D0DDD, 0xC1354E59, 0x8D3295FA, 0xC1F5E578,
+	0x6E2A48F8, 0x8D4CFB06, 0x81D735BD, 0x63CD65D4,
+	0x00000001, 0x00000000, 0xFFFFFFFF, 0x00000000,
+	0x00000000, 0x00000000, 0x00000000, 0x00000001,
+};
+
+typedef struct {
+	uint X[8];
+	uint Y[8];
+	uint Z[8];
+} sm2_cl_point;
+
+int sm2_cl_fp_is_zero(const uint a[8])
+{
+	uint r = 0;
+	int i;
+	for (i = 0; i < 8; i++) {
+		r |= a[i];
+	}
+	return r == 0;
+}
+
+int sm2_cl_fp_equ(const uint a[8], const uint b[8])
+{
+	uint r = 0;
+	int i;
+	for (i = 0; i < 8; i++) {
+		r |= a[i] ^ b[i];
+	}
+	return r == 0;
+}
+
+// r = a - p if a >= p or carry is set, a < 2p
+void sm2_cl_fp_reduce_once(uint r[8], const uint a[8], uint carry)
+{
+	uint d[8];
+	ulong borrow = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		ulong v = (ulong)a[i] - SM2_P[i] - borrow;
+		d[i] = (uint)v;
+		borrow = (v >> 32) & 1;
+	}
+	if (carry || !borrow) {
+		for (i = 0; i < 8; i++) r[i] = d[i];
+	} else {
+		for (i = 0; i < 8; i++) r[i] = a[i];
+	}
+}
+
+void sm2_cl_fp_add(uint r[8], const uint a[8], const uint b[8])
+{
+	uint c[8];
+	ulong carry = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		carry += (ulong)a[i] + b[i];
+		c[i] = (uint)carry;
+		carry >>= 32;
+	}
+	sm2_cl_fp_reduce_once(r, c, (uint)carry);
+}
+
+void sm2_cl_fp_sub(uint r[8], const uint a[8], const uint b[8])
+{
+	uint c[8];
+	ulong borrow = 0;
+	ulong carry = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		ulong v = (ulong)a[i] - b[i] - borrow;
+		c[i] = (uint)v;
+		borrow = (v >> 32) & 1;
+	}
+	if (borrow) {
+		for (i = 0; i < 8; i++) {
+			carry += (ulong)c[i] + SM2_P[i];
+			c[i] = (uint)carry;
+			carry >>= 32;
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		r[i] = c[i];
+	}
+}
+
+// r = a * b * R^-1 (mod p), operand scanning (CIOS)
+void sm2_cl_fp_mul(uint r[8], const uint a[8], const uint b[8])
+{
+	uint t[10];
+	ulong c;
+	uint m;
+	int i, j;
+
+	for (j = 0; j < 10; j++) {
+		t[j] = 0;
+	}
+	for (i = 0; i < 8; i++) {
+		c = 0;
+		for (j = 0; j < 8; j++) {
+			c += (ulong)a[j] * b[i] + t[j];
+			t[j] = (uint)c;
+			c >>= 32;
+		}
+		c += t[8];
+		t[8] = (uint)c;
+		t[9] = (uint)(c >> 32);
+
+		m = t[0];
+		c = ((ulong)m * SM2_P[0] + t[0]) >> 32;
+		for (j = 1; j < 8; j++) {
+			c += (ulong)m * SM2_P[j] + t[j];
+			t[j - 1] = (uint)c;
+			c >>= 32;
+		}
+		c += t[8];
+		t[7] = (uint)c;
+		t[8] = t[9] + (uint)(c >> 32);
+	}
+	sm2_cl_fp_reduce_once(r, t, t[8]);
+}
+
+void sm2_cl_fp_sqr(uint r[8], const uint a[8])
+{
+	sm2_cl_fp_mul(r, a, a);
+}
+
+// dbl-2001-b, a = -3
+void sm2_cl_point_dbl(sm2_cl_point *R, const sm2_cl_point *A)
+{
+	uint delta[8], gamma[8], beta[8], alpha[8], t0[8], t1[8];
+	uint X3[8], Y3[8], Z3[8];
+	int i;
+
+	sm2_cl_fp_sqr(delta, A->Z);
+	sm2_cl_fp_sqr(gamma, A->Y);
+	sm2_cl_fp_mul(beta, A->X, gamma);
+
+	sm2_cl_fp_sub(t0, A->X, delta);
+	sm2_cl_fp_add(t1, A->X, delta);
+	sm2_cl_fp_mul(t0, t0, t1);
+	sm2_cl_fp_add(alpha, t0, t0);
+	sm2_cl_fp_add(alpha, alpha, t0);
+
+	// X3 = alpha^2 - 8 * beta
+	sm2_cl_fp_add(beta, beta, beta);
+	sm2_cl_fp_add(beta, beta, beta);
+	sm2_cl_fp_sqr(X3, alpha);
+	sm2_cl_fp_add(t0, beta, beta);
+	sm2_cl_fp_sub(X3, X3, t0);
+
+	// Z3 = (Y + Z)^2 - gamma - delta
+	sm2_cl_fp_add(Z3, A->Y, A->Z);
+	sm2_cl_fp_sqr(Z3, Z3);
+	sm2_cl_fp_sub(Z3, Z3, gamma);
+	sm2_cl_fp_sub(Z3, Z3, delta);
+
+	// Y3 = alpha * (4 * beta - X3) - 8 * gamma^2
+	sm2_cl_fp_sub(Y3, beta, X3);
+	sm2_cl_fp_mul(Y3, alpha, Y3);
+	sm2_cl_fp_sqr(t0, gamma);
+	sm2_cl_fp_add(t0, t0, t0);
+	sm2_cl_fp_add(t0, t0, t0);
+	sm2_cl_fp_add(t0, t0, t0);
+	sm2_cl_fp_sub(Y3, Y3, t0);
+
+	for (i = 0; i < 8; i++) {
+		R->X[i] = X3[i];
+		R->Y[i] = Y3[i];
+		R->Z[i] = Z3[i];
+	}
+}
+
+// add-2007-bl, the inputs are public, so the special cases branch
+void sm2_cl_point_add(sm2_cl_point *R, const sm2_cl_point *A, const sm2_cl_point *B)
+{
+	uint Z1Z1[8], Z2Z2[8], U1[8], U2[8], S1[8], S2[8], H[8], I[8], J[8], r[8], V[8];
+	uint X3[8], Y3[8], Z3[8];
+	int i;
+
+	if (sm2_cl_fp_is_zero(A->Z)) {
+		*R = *B;
+		return;
+	}
+	if (sm2_cl_fp_is_zero(B->Z)) {
+		*R = *A;
+		return;
+	}
+
+	sm2_cl_fp_sqr(Z1Z1, A->Z);
+	sm2_cl_fp_sqr(Z2Z2, B->Z);
+	sm2_cl_fp_mul(U1, A->X, Z2Z2);
+	sm2_cl_fp_mul(U2, B->X, Z1Z1);
+	sm2_cl_fp_mul(S1, A->Y, B->Z);
+	sm2_cl_fp_mul(S1, S1, Z2Z2);
+	sm2_cl_fp_mul(S2, B->Y, A->Z);
+	sm2_cl_fp_mul(S2, S2, Z1Z1);
+	sm2_cl_fp_sub(H, U2, U1);
+	sm2_cl_fp_sub(r, S2, S1);
+
+	if (sm2_cl_fp_is_zero(H)) {
+		if (sm2_cl_fp_is_zero(r)) {
+			sm2_cl_point_dbl(R, A);
+		} else {
+			for (i = 0; i < 8; i++) {
+				R->Z[i] = 0;
+			}
+		}
+		return;
+	}
+
+	sm2_cl_fp_add(I, H, H);
+	sm2_cl_fp_sqr(I, I);
+	sm2_cl_fp_mul(J, H, I);
+	sm2_cl_fp_add(r, r, r);
+	sm2_cl_fp_mul(V, U1, I);
+
+	// X3 = r^2 - J - 2 * V
+	sm2_cl_fp_sqr(X3, r);
+	sm2_cl_fp_sub(X3, X3, J);
+	sm2_cl_fp_sub(X3, X3, V);
+	sm2_cl_fp_sub(X3, X3, V);
+
+	// Y3 = r * (V - X3) - 2 * S1 * J
+	sm2_cl_fp_sub(Y3, V, X3);
+	sm2_cl_fp_mul(Y3, r, Y3);
+	sm2_cl_fp_mul(S1, S1, J);
+	sm2_cl_fp_add(S1, S1, S1);
+	sm2_cl_fp_sub(Y3, Y3, S1);
+
+	// Z3 = ((Z1 + Z2)^2 - Z1Z1 - Z2Z2) * H
+	sm2_cl_fp_add(Z3, A->Z, B->Z);
+	sm2_cl_fp_sqr(Z3, Z3);
+	sm2_cl_fp_sub(Z3, Z3, Z1Z1);
+	sm2_cl_fp_sub(Z3, Z3, Z2Z2);
+	sm2_cl_fp_mul(Z3, Z3, H);
+
+	for (i = 0; i < 8; i++) {
+		R->X[i] = X3[i];
+		R->Y[i] = Y3[i];
+		R->Z[i] = Z3[i];
+	}
+}
+
+// x(R) == c (mod n) with x(R) = X/Z^2, c < n, so x(R) is c or c + n when c + n < p
+int sm2_cl_point_x_modn_equ(const sm2_cl_point *R, const uint c[8])
+{
+	uint zz[8], u[8], v[8], cn[8];
+	ulong carry = 0;
+	ulong borrow = 0;
+	int i;
+
+	if (sm2_cl_fp_is_zero(R->Z)) {
+		return 0;
+	}
+	sm2_cl_fp_sqr(zz, R->Z);
+
+	for (i = 0; i < 8; i++) {
+		u[i] = SM2_R2[i];
+	}
+	sm2_cl_fp_mul(v, c, u);
+	sm2_cl_fp_mul(v, v, zz);
+	if (sm2_cl_fp_equ(v, R->X)) {
+		return 1;
+	}
+
+	for (i = 0; i < 8; i++) {
+		carry += (ulong)c[i] + SM2_N[i];
+		cn[i] = (uint)carry;
+		carry >>= 32;
+	}
+	for (i = 0; i < 8; i++) {
+		ulong d = (ulong)cn[i] - SM2_P[i] - borrow;
+		borrow = (d >> 32) & 1;
+	}
+	if (carry || !borrow) {
+		return 0;
+	}
+	sm2_cl_fp_mul(v, cn, u);
+	sm2_cl_fp_mul(v, v, zz);
+	return sm2_cl_fp_equ(v, R->X);
+}
+
+// out[i] = 1 if s * G + t * P has x == r - e (mod n), Shamir's trick over {G, P, G + P}
+__kernel void sm2_cl_verify(__global const uint *in, uint n, __global uchar *out)
+{
+	uint gid = get_global_id(0);
+	__global const uint *item = in + 48 * gid;
+	sm2_cl_point T[3];
+	sm2_cl_point R;
+	uint s[8], t[8], c[8];
+	int i;
+
+	if (gid >= n) {
+		return;
+	}
+
+	for (i = 0; i < 8; i++) {
+		T[0].X[i] = SM2_G[i];
+		T[0].Y[i] = SM2_G[8 + i];
+		T[0].Z[i] = SM2_G[16 + i];
+		T[1].X[i] = item[i];
+		T[1].Y[i] = item[8 + i];
+		T[1].Z[i] = item[16 + i];
+		s[i] = item[24 + i];
+		t[i] = item[32 + i];
+		c[i] = item[40 + i];
+		R.X[i] = 0;
+		R.Y[i] = 0;
+		R.Z[i] = 0;
+	}
+	sm2_cl_point_add(&T[2], &T[0], &T[1]);
+
+	for (i = 255; i >= 0; i--) {
+		uint k = ((s[i >> 5] >> (i & 31)) & 1) | (((t[i >> 5] >> (i & 31)) & 1) << 1);
+		sm2_cl_point_dbl(&R, &R);
+		if (k) {
+			sm2_cl_point_add(&R, &R, &T[k - 1]);
+		}
+	}
+
+	out[gid] = (uchar)sm2_cl_point_x_modn_equ(&R, c);
+}
+
+);
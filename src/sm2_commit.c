@@ -19,61 +19,183 @@
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
 #include <gmssl/sm2_commit.h>
+#ifdef _WIN32
+#include <windows.h>
+#else
+#include <pthread.h>
+#endif
 
 
 #define SM2_COMMIT_SEED "GmSSL SM2 Pederson Commitment Generator H"
 
 
-// C = rG + xH
-int sm2_commit_generate(const uint8_t x[32], uint8_t r[32], uint8_t commit[65], size_t *commitlen)
+// H = hash_to_point(H), or of the seed for H[0]
+static int sm2_commit_next_generator(SM2_Z256_POINT *H, int first)
 {
-	SM2_POINT H;
-	SM2_POINT C;
-	SM2_BN r_;
+	uint8_t buf[64];
 
-	if (sm2_point_from_hash(&H, (uint8_t *)SM2_COMMIT_SEED, sizeof(SM2_COMMIT_SEED)-1) != 1) {
+	if (first) {
+		if (sm2_z256_point_from_hash(H, (uint8_t *)SM2_COMMIT_SEED, sizeof(SM2_COMMIT_SEED)-1, 0) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+	sm2_z256_point_to_bytes(H, buf);
+	if (sm2_z256_point_from_hash(H, buf, sizeof(buf), 0) != 1) {
 		error_print();
 		return -1;
 	}
+	return 1;
+}
 
-	do {
-		sm2_fn_rand(r_);
-	} while (sm2_bn_is_zero(r_));
+/*
+ * The cache of the first SM2_COMMIT_TABLE_GENERATORS generators and their
+ * comb tables, tables are built in order at the first commitment needing them.
+ * Both are written under the lock and never changed, callers read them after
+ * sm2_commit_cache() returns.
+ */
+#define SM2_COMMIT_TABLE_POINTS	SM2_Z256_COMB_POINTS(SM2_COMMIT_TABLE_WINDOW)
+
+static SM2_Z256_POINT g_generators[SM2_COMMIT_TABLE_GENERATORS];
+static SM2_Z256_AFFINE_POINT *g_tables[SM2_COMMIT_TABLE_GENERATORS];
+static size_t g_generators_cnt = 0;
+static size_t g_tables_cnt = 0;
+
+#ifdef _WIN32
+static SRWLOCK g_cache_lock = SRWLOCK_INIT;
+#define cache_lock()	AcquireSRWLockExclusive(&g_cache_lock)
+#define cache_unlock()	ReleaseSRWLockExclusive(&g_cache_lock)
+#else
+static pthread_mutex_t g_cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define cache_lock()	pthread_mutex_lock(&g_cache_lock)
+#define cache_unlock()	pthread_mutex_unlock(&g_cache_lock)
+#endif
+
+// the generators and the first `tables` comb tables, tables <= SM2_COMMIT_TABLE_GENERATORS
+static int sm2_commit_cache(size_t tables)
+{
+	int ret = -1;
 
-	sm2_bn_to_bytes(r_, r);
-	gmssl_secure_clear(r_, sizeof(r_));
+	cache_lock();
+	while (g_generators_cnt < SM2_COMMIT_TABLE_GENERATORS) {
+		if (g_generators_cnt) {
+			g_generators[g_generators_cnt] = g_generators[g_generators_cnt - 1];
+		}
+		if (sm2_commit_next_generator(&g_generators[g_generators_cnt], g_generators_cnt == 0) != 1) {
+			error_print();
+			goto end;
+		}
+		g_generators_cnt++;
+	}
+	while (g_tables_cnt < tables) {
+		SM2_Z256_AFFINE_POINT *T;
+
+		if (!(T = (SM2_Z256_AFFINE_POINT *)malloc(sizeof(SM2_Z256_AFFINE_POINT) * SM2_COMMIT_TABLE_POINTS))) {
+			error_print();
+			goto end;
+		}
+		sm2_z256_point_mul_comb_w_pre_compute(&g_generators[g_tables_cnt], SM2_COMMIT_TABLE_WINDOW, T);
+		g_tables[g_tables_cnt++] = T;
+	}
+	ret = 1;
+end:
+	cache_unlock();
+	return ret;
+}
 
-	// C = xH + rG
-	sm2_point_mul_sum(&C, x, &H, r);
+// H[0..count-1], the cached ones and the hash chain after them
+static int sm2_commit_generators(SM2_Z256_POINT *H, size_t count)
+{
+	size_t cached = count < SM2_COMMIT_TABLE_GENERATORS ? count : SM2_COMMIT_TABLE_GENERATORS;
+	size_t i;
 
-	sm2_point_to_compressed_octets(&C, commit);
-	*commitlen = 33;
+	if (sm2_commit_cache(0) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(H, g_generators, sizeof(SM2_Z256_POINT) * cached);
+	for (i = cached; i < count; i++) {
+		H[i] = H[i - 1];
+		if (sm2_commit_next_generator(&H[i], 0) != 1) {
+			error_print();
+			return -1;
+		}
+	}
 	return 1;
 }
 
-int sm2_commit_open(const uint8_t x[32], const uint8_t r[32], const uint8_t *commit, size_t commitlen)
+static int sm2_commit_rand(uint8_t r[32])
+{
+	sm2_z256_t r_;
+
+	do {
+		if (sm2_z256_rand_range(r_, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(r_));
+
+	sm2_z256_to_bytes(r_, r);
+	gmssl_secure_clear(r_, sizeof(r_));
+	return 1;
+}
+
+// C = rG + xH
+int sm2_commit_generate(const uint8_t x[32], uint8_t r[32], uint8_t commit[65], size_t *commitlen)
 {
-	SM2_POINT H;
-	SM2_POINT C;
-	SM2_POINT C_;
+	SM2_Z256_POINT C;
+	SM2_Z256_POINT xH;
+	sm2_z256_t x_;
+	sm2_z256_t r_;
 
-	if (sm2_point_from_octets(&C, commit, commitlen) != 1) {
+	if (sm2_commit_cache(1) != 1
+		|| sm2_commit_rand(r) != 1) {
 		error_print();
 		return -1;
 	}
+	sm2_z256_from_bytes(x_, x);
+	sm2_z256_from_bytes(r_, r);
+
+	// C = xH + rG, both fixed-base
+	sm2_z256_point_mul_generator(&C, r_);
+	sm2_z256_point_mul_comb_w(&xH, x_, g_tables[0], SM2_COMMIT_TABLE_WINDOW);
+	sm2_z256_point_add(&C, &C, &xH);
+	gmssl_secure_clear(x_, sizeof(x_));
+	gmssl_secure_clear(r_, sizeof(r_));
+	gmssl_secure_clear(&xH, sizeof(xH));
 
-	if (sm2_point_from_hash(&H, (uint8_t *)SM2_COMMIT_SEED, sizeof(SM2_COMMIT_SEED)-1) != 1) {
+	if (sm2_z256_point_to_compressed_octets(&C, commit) != 1) {
 		error_print();
 		return -1;
 	}
+	*commitlen = 33;
+	return 1;
+}
+
+int sm2_commit_open(const uint8_t x[32], const uint8_t r[32], const uint8_t *commit, size_t commitlen)
+{
+	SM2_Z256_POINT H;
+	SM2_Z256_POINT C;
+	SM2_Z256_POINT C_;
+	sm2_z256_t x_;
+	sm2_z256_t r_;
 
-	// C' = xH + rG
-	if (sm2_point_mul_sum(&C_, x, &H, r) != 1) {
+	if (sm2_z256_point_from_octets(&C, commit, commitlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_commit_generators(&H, 1) != 1) {
 		error_print();
 		return -1;
 	}
 
-	if (memcmp(&C, &C_, sizeof(SM2_POINT)) != 0) {
+	// C' = xH + rG, the opened values are public
+	sm2_z256_from_bytes(x_, x);
+	sm2_z256_from_bytes(r_, r);
+	sm2_z256_point_mul_sum_vartime(&C_, x_, &H, r_);
+
+	if (sm2_z256_point_equ(&C, &C_) != 1) {
 		error_print();
 		return 0;
 	}
@@ -81,92 +203,109 @@ int sm2_commit_open(const uint8_t x[32], const uint8_t r[32], const uint8_t *com
 }
 
 // C = r*G + x1*H1 + x2*H2 + ...
-int sm2_commit_vector_generate(const sm2_bn_t *x, size_t count, uint8_t r[32], uint8_t commit[65], size_t *commitlen)
+int sm2_commit_vector_generate(const uint8_t (*x)[32], size_t count, uint8_t r[32], uint8_t commit[65], size_t *commitlen)
 {
-	SM2_POINT H;
-	SM2_POINT C;
-	SM2_Fn r_;
+	size_t tables = count < SM2_COMMIT_TABLE_GENERATORS ? count : SM2_COMMIT_TABLE_GENERATORS;
+	SM2_Z256_POINT H;
+	SM2_Z256_POINT C;
+	SM2_Z256_POINT xH;
+	sm2_z256_t x_;
+	sm2_z256_t r_;
 	size_t i;
 
 	if (count < 1) {
 		error_print();
 		return -1;
 	}
-
-	if (sm2_point_from_hash(&H, (uint8_t *)SM2_COMMIT_SEED, sizeof(SM2_COMMIT_SEED)-1) != 1) {
+	if (sm2_commit_cache(tables) != 1
+		|| sm2_commit_rand(r) != 1) {
 		error_print();
 		return -1;
 	}
 
-	do {
-		sm2_fn_rand(r_);
-	} while (sm2_bn_is_zero(r_));
-
-	sm2_bn_to_bytes(r_, r);
-	gmssl_secure_clear(r_, sizeof(r_));
+	sm2_z256_from_bytes(r_, r);
+	sm2_z256_point_mul_generator(&C, r_);
 
-	if (sm2_point_mul_sum(&C, x[0], &H, r) != 1) {
-		error_print();
-		return -1;
+	// x[i] are secret, the fixed-base combs and the constant time point multiplication are used
+	for (i = 0; i < tables; i++) {
+		sm2_z256_from_bytes(x_, x[i]);
+		sm2_z256_point_mul_comb_w(&xH, x_, g_tables[i], SM2_COMMIT_TABLE_WINDOW);
+		sm2_z256_point_add(&C, &C, &xH);
 	}
-
-	for (i = 1; i < count; i++) {
-		SM2_POINT xH;
-
-		if (sm2_point_from_hash(&H, (uint8_t *)&H, sizeof(H)) != 1
-			|| sm2_point_mul(&xH, x[i], &H) != 1
-			|| sm2_point_add(&C, &C, &xH) != 1) {
+	if (count > tables) {
+		H = g_generators[tables - 1];
+	}
+	for (; i < count; i++) {
+		if (sm2_commit_next_generator(&H, 0) != 1) {
 			error_print();
 			return -1;
 		}
+		sm2_z256_from_bytes(x_, x[i]);
+		sm2_z256_point_mul(&xH, x_, &H);
+		sm2_z256_point_add(&C, &C, &xH);
 	}
+	gmssl_secure_clear(x_, sizeof(x_));
+	gmssl_secure_clear(r_, sizeof(r_));
+	gmssl_secure_clear(&xH, sizeof(xH));
 
-	sm2_point_to_compressed_octets(&C, commit);
+	if (sm2_z256_point_to_compressed_octets(&C, commit) != 1) {
+		error_print();
+		return -1;
+	}
 	*commitlen = 33;
 	return 1;
 }
 
-int sm2_commit_vector_open(const sm2_bn_t *x, size_t count, const uint8_t r[32], const uint8_t *commit, size_t commitlen)
+// the opened x[i] are public, so C' is a multi-scalar multiplication
+int sm2_commit_vector_open(const uint8_t (*x)[32], size_t count, const uint8_t r[32], const uint8_t *commit, size_t commitlen)
 {
-	SM2_POINT H;
-	SM2_POINT C;
-	SM2_POINT C_;
+	SM2_Z256_POINT *H = NULL;
+	sm2_z256_t *k = NULL;
+	SM2_Z256_POINT C;
+	SM2_Z256_POINT C_;
+	SM2_Z256_POINT rG;
+	sm2_z256_t r_;
 	size_t i;
+	int ret = -1;
 
-	if (count < 1) {
+	if (count < 1 || count > SIZE_MAX / sizeof(SM2_Z256_POINT)) {
 		error_print();
 		return -1;
 	}
-
-	if (sm2_point_from_octets(&C, commit, commitlen) != 1) {
+	if (sm2_z256_point_from_octets(&C, commit, commitlen) != 1) {
 		error_print();
 		return -1;
 	}
-
-	if (sm2_point_from_hash(&H, (uint8_t *)SM2_COMMIT_SEED, sizeof(SM2_COMMIT_SEED)-1) != 1) {
+	if (!(H = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * count))
+		|| !(k = (sm2_z256_t *)malloc(sizeof(sm2_z256_t) * count))) {
 		error_print();
-		return -1;
+		goto end;
 	}
-
-	if (sm2_point_mul_sum(&C_, x[0], &H, r) != 1) {
+	if (sm2_commit_generators(H, count) != 1) {
 		error_print();
-		return -1;
+		goto end;
+	}
+	for (i = 0; i < count; i++) {
+		sm2_z256_from_bytes(k[i], x[i]);
 	}
 
-	for (i = 1; i< count; i++) {
-		SM2_POINT xH;
-
-		if (sm2_point_from_hash(&H, (uint8_t *)&H, sizeof(H)) != 1
-			|| sm2_point_mul(&xH, x[i], &H) != 1
-			|| sm2_point_add(&C_, &C_, &xH) != 1) {
-			error_print();
-			return -1;
-		}
+	// C' = rG + x[0]*H[0] + ... + x[count-1]*H[count-1]
+	if (sm2_z256_point_multi_mul(&C_, k, H, count) != 1) {
+		error_print();
+		goto end;
 	}
+	sm2_z256_from_bytes(r_, r);
+	sm2_z256_point_mul_generator(&rG, r_);
+	sm2_z256_point_add(&C_, &C_, &rG);
 
-	if (memcmp(&C, &C_, sizeof(SM2_POINT)) != 0) {
+	if (sm2_z256_point_equ(&C, &C_) != 1) {
 		error_print();
-		return -1;
+		ret = 0;
+		goto end;
 	}
-	return 1;
+	ret = 1;
+end:
+	if (H) free(H);
+	if (k) free(k);
+	return ret;
 }
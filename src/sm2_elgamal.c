@@ -12,174 +12,332 @@
 #include <stdlib.h>
 #include <limits.h>
 #include <stdint.h>
-#include <assert.h>
 #include <gmssl/mem.h>
 #include <gmssl/sm2_elgamal.h>
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <unistd.h>
+#include <pthread.h>
+#endif
 
 
-extern const SM2_JACOBIAN_POINT *SM2_G;
+#define SM2_ELGAMAL_BYTE_ORDER	0x0102030405060708ULL
 
+// points made affine with one inversion
+#define SM2_ELGAMAL_BATCH_SIZE	256
 
+// m = 2 * B * i + j with j in [-B, B], i <= (2^32 - 1 + B)/(2 * B)
+#define SM2_ELGAMAL_GIANT_STEPS	((uint32_t)((0xffffffffULL + SM2_ELGAMAL_BABY_STEPS) / (2 * SM2_ELGAMAL_BABY_STEPS)))
 
-// generate baby-step table
-int sm2_elgamal_decrypt_pre_compute(SM2_PRE_COMPUTE table[1<<16])
+
+static int sm2_elgamal_rand_k(sm2_z256_t k)
+{
+	do {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(k));
+	return 1;
+}
+
+static void sm2_elgamal_generator_multiple(SM2_Z256_AFFINE_POINT *A, uint64_t k)
 {
-	SM2_JACOBIAN_POINT P;
-	SM2_BN x;
-	uint32_t i, j;
+	SM2_Z256_POINT P;
+	sm2_z256_t s = {0};
 
-	memset(table, 0, sizeof(SM2_PRE_COMPUTE) * (1<<16));
+	s[0] = k;
+	sm2_z256_point_mul_generator(&P, s);
+	sm2_z256_points_get_affine_batch(&P, 1, A);
+}
+
+static void sm2_elgamal_table_insert(SM2_ELGAMAL_TABLE *table, const sm2_z256_t x, uint32_t j)
+{
+	size_t h = x[0] & (SM2_ELGAMAL_TABLE_SLOTS - 1);
 
-	sm2_jacobian_point_set_infinity(&P);
-	for (i = 0; i < (1<<16); i++) {
-		sm2_jacobian_point_add(&P, &P, SM2_G);
-		sm2_jacobian_point_get_xy(&P, x, NULL);
-		sm2_bn_to_bytes(x, table[i].x_coordinate);
+	while (table->slots[h]) {
+		h = (h + 1) & (SM2_ELGAMAL_TABLE_SLOTS - 1);
+	}
+	table->slots[h] = (((x[0] >> 17) | 1) << 16) | (j - 1);
+}
 
-		j = ((uint16_t)table[i].x_coordinate[30] << 8) | table[i].x_coordinate[31];
-		assert(table[j].offset_count <= SM2_PRE_COMPUTE_MAX_OFFSETS);
+int sm2_elgamal_table_generate(SM2_ELGAMAL_TABLE *table)
+{
+	SM2_Z256_POINT P[SM2_ELGAMAL_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT A[SM2_ELGAMAL_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT G;
+	SM2_Z256_POINT J;
+	sm2_z256_t x;
+	uint32_t j, k;
 
-		table[j].offset[ table[j].offset_count ] = (uint16_t)i;
-		(table[j].offset_count)++;
+	if (!table) {
+		error_print();
+		return -1;
+	}
+	memset(table, 0, sizeof(SM2_ELGAMAL_TABLE));
+	memcpy(table->magic, SM2_ELGAMAL_TABLE_MAGIC, sizeof(table->magic));
+	table->byte_order = SM2_ELGAMAL_BYTE_ORDER;
+
+	sm2_elgamal_generator_multiple(&G, 1);
+	sm2_z256_point_copy_affine(&J, &G);
+
+	for (j = 1; j <= SM2_ELGAMAL_BABY_STEPS; j += SM2_ELGAMAL_BATCH_SIZE) {
+		for (k = 0; k < SM2_ELGAMAL_BATCH_SIZE; k++) {
+			P[k] = J;
+			// point_add_affine() has no doubling case
+			if (j + k == 1) {
+				sm2_z256_point_dbl(&J, &J);
+			} else {
+				sm2_z256_point_add_affine(&J, &J, &G);
+			}
+		}
+		sm2_z256_points_get_affine_batch(P, SM2_ELGAMAL_BATCH_SIZE, A);
+		for (k = 0; k < SM2_ELGAMAL_BATCH_SIZE; k++) {
+			sm2_z256_modp_from_mont(x, A[k].x);
+			sm2_elgamal_table_insert(table, x, j + k);
+		}
 	}
 	return 1;
 }
 
-static int sm2_pre_compute_get_offset(const SM2_PRE_COMPUTE table[1<<16], const uint8_t x[32], uint16_t *offset)
+/*
+ * M = +-j*G if x(M) = x(j*G). The x fingerprints of 47 bits may collide, so
+ * every candidate is checked on j*G. Returns j, -j or 0.
+ */
+static int64_t sm2_elgamal_table_lookup(const SM2_ELGAMAL_TABLE *table, const sm2_z256_t x, const sm2_z256_t y)
 {
-	uint32_t i = ((uint16_t)x[30] << 8) | x[31];
-	uint16_t j;
-	uint8_t w;
-
-	for (w = 0; w < table[i].offset_count; w++) {
-		j = table[i].offset[w];
-		if (memcmp(x, table[j].x_coordinate, 32) == 0) {
-			*offset = j;
-			return 1;
+	uint64_t fp = (x[0] >> 17) | 1;
+	size_t h = x[0] & (SM2_ELGAMAL_TABLE_SLOTS - 1);
+
+	for (; table->slots[h]; h = (h + 1) & (SM2_ELGAMAL_TABLE_SLOTS - 1)) {
+		if ((table->slots[h] >> 16) == fp) {
+			uint32_t j = (uint32_t)(table->slots[h] & 0xffff) + 1;
+			SM2_Z256_AFFINE_POINT T;
+			sm2_z256_t t;
+
+			sm2_elgamal_generator_multiple(&T, j);
+			sm2_z256_modp_from_mont(t, T.x);
+			if (sm2_z256_cmp(t, x) != 0) {
+				continue;
+			}
+			sm2_z256_modp_from_mont(t, T.y);
+			return sm2_z256_cmp(t, y) == 0 ? (int64_t)j : -(int64_t)j;
 		}
 	}
 	return 0;
 }
 
-// run gaint-step
-int sm2_elgamal_solve_ecdlp(const SM2_PRE_COMPUTE table[1<<16], const SM2_POINT *point, uint32_t *private)
+int sm2_elgamal_table_check(const SM2_ELGAMAL_TABLE *table)
 {
-	int ret = 0;
-	SM2_JACOBIAN_POINT P;
-	SM2_JACOBIAN_POINT Q;
-	SM2_BN k;
-	SM2_BN x;
-	uint8_t x_bytes[32];
-	uint8_t Q_bytes[64];
-	uint32_t i;
-	uint16_t j;
-
-	sm2_jacobian_point_from_bytes(&P, (uint8_t *)point);
-
-	// Q = -[2^16]G
-	sm2_bn_set_word(k, 65536);
-	sm2_jacobian_point_mul_generator(&Q, k);
-	sm2_jacobian_point_neg(&Q, &Q);
-
-	// Q to Affine
-	sm2_jacobian_point_to_bytes(&Q, Q_bytes);
-	sm2_jacobian_point_from_bytes(&Q, Q_bytes);
-
-	for (i = 0; i < (1<<16); i++) {
-		// P - i*(kG) == O ==> d = i*k
-		if (sm2_jacobian_point_is_at_infinity(&P)) {
-			*private = (i << 16);
-			ret = 1;
-			goto ok;
-		}
+	SM2_Z256_AFFINE_POINT G;
+	sm2_z256_t x, y;
 
-		sm2_jacobian_point_get_xy(&P, x, NULL);
-		sm2_bn_to_bytes(x, x_bytes);
-		if (sm2_pre_compute_get_offset(table, x_bytes, &j) == 1) {
-			// P - i*(kG) == j*G ==> d = j + i*k
-			*private = (i<<16) + j + 1; // table[0] is 1*G, so j + 1
-			ret = 1;
-			goto ok;
-		}
-		sm2_jacobian_point_add(&P, &P, &Q);
+	if (!table) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(table->magic, SM2_ELGAMAL_TABLE_MAGIC, sizeof(table->magic)) != 0
+		|| table->byte_order != SM2_ELGAMAL_BYTE_ORDER) {
+		error_print();
+		return -1;
+	}
+	sm2_elgamal_generator_multiple(&G, 1);
+	sm2_z256_modp_from_mont(x, G.x);
+	sm2_z256_modp_from_mont(y, G.y);
+	if (sm2_elgamal_table_lookup(table, x, y) != 1) {
+		error_print();
+		return -1;
 	}
-	printf("gaint steps failed\n");
+	return 1;
+}
 
-ok:
-	i = j = 0;
-	gmssl_secure_clear(x, sizeof(x));
-	return ret;
+int sm2_elgamal_table_to_file(const SM2_ELGAMAL_TABLE *table, FILE *fp)
+{
+	if (!table || !fp) {
+		error_print();
+		return -1;
+	}
+	if (fwrite(table, sizeof(SM2_ELGAMAL_TABLE), 1, fp) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
-int sm2_elgamal_do_encrypt(const SM2_KEY *pub_key, uint32_t in, SM2_ELGAMAL_CIPHERTEXT *out)
+int sm2_elgamal_table_from_file(SM2_ELGAMAL_TABLE *table, FILE *fp)
+{
+	if (!table || !fp) {
+		error_print();
+		return -1;
+	}
+	if (fread(table, sizeof(SM2_ELGAMAL_TABLE), 1, fp) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_elgamal_table_check(table) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+/*
+ * Giant steps Q_i = M - 2*B*i*G, SM2_ELGAMAL_BATCH_SIZE of them are made affine
+ * together. x(Q_i) = x(j*G) gives m = 2*B*i +- j, so a giant step covers 2*B.
+ */
+int sm2_elgamal_solve_ecdlp(const SM2_ELGAMAL_TABLE *table, const SM2_Z256_POINT *M, uint32_t *m)
 {
-	int ret = -1;
-	SM2_Fn k;
-	SM2_Fn m;
-	uint8_t k_bytes[32];
-	uint8_t m_bytes[32];
+	SM2_Z256_POINT P[SM2_ELGAMAL_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT A[SM2_ELGAMAL_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT S;
+	SM2_Z256_POINT Q;
+	uint32_t i, k;
 
-	if (!pub_key || !out) {
+	if (!table || !M || !m) {
 		error_print();
 		return -1;
 	}
 
-	do {
-		if (sm2_fn_rand(k) != 1) {
-			error_print();
-			return -1;
+	// S = -2*B*G
+	sm2_elgamal_generator_multiple(&S, 2 * SM2_ELGAMAL_BABY_STEPS);
+	sm2_z256_modp_neg(S.y, S.y);
+
+	Q = *M;
+	for (i = 0; i <= SM2_ELGAMAL_GIANT_STEPS; i += SM2_ELGAMAL_BATCH_SIZE) {
+		for (k = 0; k < SM2_ELGAMAL_BATCH_SIZE; k++) {
+			P[k] = Q;
+			sm2_z256_point_add_affine(&Q, &Q, &S);
 		}
-	} while (sm2_bn_is_zero(k));
-	sm2_bn_to_bytes(k, k_bytes);
+		sm2_z256_points_get_affine_batch(P, SM2_ELGAMAL_BATCH_SIZE, A);
+
+		for (k = 0; k < SM2_ELGAMAL_BATCH_SIZE && i + k <= SM2_ELGAMAL_GIANT_STEPS; k++) {
+			uint64_t base = (uint64_t)2 * SM2_ELGAMAL_BABY_STEPS * (i + k);
+			sm2_z256_t x, y;
+			int64_t j;
+
+			if (sm2_z256_is_zero(P[k].Z)) {
+				j = 0;
+			} else {
+				sm2_z256_modp_from_mont(x, A[k].x);
+				sm2_z256_modp_from_mont(y, A[k].y);
+				if (!(j = sm2_elgamal_table_lookup(table, x, y))) {
+					continue;
+				}
+			}
+			if ((int64_t)base + j >= 0 && (uint64_t)((int64_t)base + j) <= 0xffffffff) {
+				*m = (uint32_t)((int64_t)base + j);
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
 
-	// C1 = k * G
-	if (sm2_point_mul_generator(&out->C1, k_bytes) != 1) {
+int sm2_elgamal_do_encrypt(const SM2_KEY *pub_key, uint32_t in, SM2_ELGAMAL_CIPHERTEXT *out)
+{
+	sm2_z256_t k;
+	sm2_z256_t m = {0};
+
+	if (!pub_key || !out) {
 		error_print();
-		goto end;
+		return -1;
 	}
-
-	// C2 = k * P + m * G
-	sm2_bn_set_word(m, in);
-	sm2_bn_to_bytes(m, m_bytes);
-	if (sm2_point_mul_sum(&out->C2, k_bytes, &pub_key->public_key, m_bytes) != 1) {
+	if (sm2_elgamal_rand_k(k) != 1) {
 		error_print();
-		goto end;
+		return -1;
 	}
-	ret = 1;
 
-end:
+	// C1 = k * G
+	sm2_z256_point_mul_generator(&out->C1, k);
+
+	// C2 = k * P + m * G
+	m[0] = in;
+	sm2_z256_point_mul_sum(&out->C2, k, &pub_key->public_key, m);
+
 	gmssl_secure_clear(k, sizeof(k));
 	gmssl_secure_clear(m, sizeof(m));
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
-	gmssl_secure_clear(m_bytes, sizeof(m_bytes));
-	return ret;
+	return 1;
 }
 
-// M = m*G = -x*C1 + C2
-int sm2_elgamal_do_decrypt(const SM2_KEY *key, const SM2_ELGAMAL_CIPHERTEXT *in, uint32_t *out)
+// M = m*G = -d*C1 + C2
+int sm2_elgamal_do_decrypt_ex(const SM2_KEY *key, const SM2_ELGAMAL_TABLE *table,
+	const SM2_ELGAMAL_CIPHERTEXT *in, uint32_t *out)
 {
-	static SM2_PRE_COMPUTE *table = NULL;
-	SM2_POINT M;
+	SM2_Z256_POINT M;
 
-	if (!key || !in || !out) {
+	if (!key || !table || !in || !out) {
 		error_print();
 		return -1;
 	}
 
-	sm2_point_mul(&M, key->private_key, &in->C1);
-	sm2_point_sub(&M, &in->C2, &M);
+	sm2_z256_point_mul(&M, key->private_key, &in->C1);
+	sm2_z256_point_sub(&M, &in->C2, &M);
 
-	if (!table) {
-		if (!(table = malloc(sizeof(SM2_PRE_COMPUTE) * (1<<16)))) {
-			error_print();
-			return -1;
-		}
-		sm2_elgamal_decrypt_pre_compute(table);
+	if (sm2_elgamal_solve_ecdlp(table, &M, out) != 1) {
+		gmssl_secure_clear(&M, sizeof(M));
+		error_print();
+		return -1;
 	}
+	gmssl_secure_clear(&M, sizeof(M));
+	return 1;
+}
 
-	if (sm2_elgamal_solve_ecdlp(table, &M, out) != 1) {
+static SM2_ELGAMAL_TABLE *g_table = NULL;
+
+static void sm2_elgamal_default_table_init(void)
+{
+	SM2_ELGAMAL_TABLE *table;
+
+	if (!(table = (SM2_ELGAMAL_TABLE *)malloc(sizeof(SM2_ELGAMAL_TABLE)))) {
+		error_print();
+		return;
+	}
+	if (sm2_elgamal_table_generate(table) != 1) {
+		error_print();
+		free(table);
+		return;
+	}
+	g_table = table;
+}
+
+#ifdef _WIN32
+static INIT_ONCE g_table_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK sm2_elgamal_default_table_init_once(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+	sm2_elgamal_default_table_init();
+	return TRUE;
+}
+
+static const SM2_ELGAMAL_TABLE *sm2_elgamal_default_table(void)
+{
+	InitOnceExecuteOnce(&g_table_once, sm2_elgamal_default_table_init_once, NULL, NULL);
+	return g_table;
+}
+#else
+static pthread_once_t g_table_once = PTHREAD_ONCE_INIT;
+
+static const SM2_ELGAMAL_TABLE *sm2_elgamal_default_table(void)
+{
+	pthread_once(&g_table_once, sm2_elgamal_default_table_init);
+	return g_table;
+}
+#endif
+
+int sm2_elgamal_do_decrypt(const SM2_KEY *key, const SM2_ELGAMAL_CIPHERTEXT *in, uint32_t *out)
+{
+	const SM2_ELGAMAL_TABLE *table;
+
+	if (!(table = sm2_elgamal_default_table())) {
+		error_print();
+		return -1;
+	}
+	if (sm2_elgamal_do_decrypt_ex(key, table, in, out) != 1) {
 		error_print();
 		return -1;
 	}
@@ -194,35 +352,31 @@ int sm2_elgamal_ciphertext_add(SM2_ELGAMAL_CIPHERTEXT *r,
 	const SM2_ELGAMAL_CIPHERTEXT *b,
 	const SM2_KEY *pub_key)
 {
-	SM2_Fn k;
-	uint8_t k_bytes[32];
-	SM2_POINT R;
+	sm2_z256_t k;
+	SM2_Z256_POINT R;
+	SM2_ELGAMAL_CIPHERTEXT c;
 
 	if (!r || !a || !b || !pub_key) {
 		error_print();
 		return -1;
 	}
-
-	do {
-		if (sm2_fn_rand(k) != 1) {
-			error_print();
-			return -1;
-		}
-	} while (sm2_bn_is_zero(k));
-	sm2_bn_to_bytes(k, k_bytes);
+	if (sm2_elgamal_rand_k(k) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// R1 = A1 + B1 + k*G
-	sm2_point_add(&r->C1, &a->C1, &b->C1);
-	sm2_point_mul_generator(&R, k_bytes);
-	sm2_point_add(&r->C1, &r->C1, &R);
+	sm2_z256_point_add(&c.C1, &a->C1, &b->C1);
+	sm2_z256_point_mul_generator(&R, k);
+	sm2_z256_point_add(&c.C1, &c.C1, &R);
 
 	// R2 = A2 + B2 + k*P
-	sm2_point_add(&r->C2, &a->C2, &b->C2);
-	sm2_point_mul(&R, k_bytes, &pub_key->public_key);
-	sm2_point_add(&r->C2, &r->C2, &R);
+	sm2_z256_point_add(&c.C2, &a->C2, &b->C2);
+	sm2_z256_point_mul(&R, k, &pub_key->public_key);
+	sm2_z256_point_add(&c.C2, &c.C2, &R);
 
+	*r = c;
 	gmssl_secure_clear(k, sizeof(k));
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
 	return 1;
 }
 
@@ -230,68 +384,60 @@ int sm2_elgamal_cipehrtext_sub(SM2_ELGAMAL_CIPHERTEXT *r,
 	const SM2_ELGAMAL_CIPHERTEXT *a, const SM2_ELGAMAL_CIPHERTEXT *b,
 	const SM2_KEY *pub_key)
 {
-	SM2_Fn k;
-	uint8_t k_bytes[32];
-	SM2_POINT R;
+	sm2_z256_t k;
+	SM2_Z256_POINT R;
+	SM2_ELGAMAL_CIPHERTEXT c;
 
 	if (!r || !a || !b || !pub_key) {
 		error_print();
 		return -1;
 	}
-
-	do {
-		if (sm2_fn_rand(k) != 1) {
-			error_print();
-			return -1;
-		}
-	} while (sm2_bn_is_zero(k));
-	sm2_bn_to_bytes(k, k_bytes);
+	if (sm2_elgamal_rand_k(k) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// R1 = A1 - B1 + k*G
-	sm2_point_sub(&r->C1, &a->C1, &b->C1);
-	sm2_point_mul_generator(&R, k_bytes);
-	sm2_point_add(&r->C1, &a->C1, &R);
+	sm2_z256_point_sub(&c.C1, &a->C1, &b->C1);
+	sm2_z256_point_mul_generator(&R, k);
+	sm2_z256_point_add(&c.C1, &c.C1, &R);
 
 	// R2 = A2 - B2 + k*P
-	sm2_point_sub(&r->C2, &a->C2, &b->C2);
-	sm2_point_mul(&R, k_bytes, &pub_key->public_key);
-	sm2_point_add(&r->C2, &r->C2, &R);
+	sm2_z256_point_sub(&c.C2, &a->C2, &b->C2);
+	sm2_z256_point_mul(&R, k, &pub_key->public_key);
+	sm2_z256_point_add(&c.C2, &c.C2, &R);
 
+	*r = c;
 	gmssl_secure_clear(k, sizeof(k));
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
 	return 1;
 }
 
 int sm2_elgamal_cipehrtext_neg(SM2_ELGAMAL_CIPHERTEXT *r,
 	const SM2_ELGAMAL_CIPHERTEXT *a, const SM2_KEY *pub_key)
 {
-	SM2_Fn k;
-	uint8_t k_bytes[32];
-	SM2_POINT R;
+	sm2_z256_t k;
+	SM2_Z256_POINT R;
+	SM2_ELGAMAL_CIPHERTEXT c;
 
 	if (!r || !a || !pub_key) {
 		error_print();
 		return -1;
 	}
-
-	do {
-		if (sm2_fn_rand(k) != 1) {
-			error_print();
-			return -1;
-		}
-	} while (sm2_bn_is_zero(k));
-	sm2_bn_to_bytes(k, k_bytes);
+	if (sm2_elgamal_rand_k(k) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// R1 = -A1 + k*G = -r*G + k*G
-	sm2_point_mul_generator(&R, k_bytes);
-	sm2_point_sub(&r->C1, &R, &a->C1);
+	sm2_z256_point_mul_generator(&R, k);
+	sm2_z256_point_sub(&c.C1, &R, &a->C1);
 
 	// R2 = -A2 + k*P = -m*G -r*P + k*P
-	sm2_point_mul(&R, k_bytes, &pub_key->public_key);
-	sm2_point_sub(&r->C2, &R, &a->C2);
+	sm2_z256_point_mul(&R, k, &pub_key->public_key);
+	sm2_z256_point_sub(&c.C2, &R, &a->C2);
 
+	*r = c;
 	gmssl_secure_clear(k, sizeof(k));
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
 	return 1;
 }
 
@@ -300,33 +446,115 @@ int sm2_elgamal_ciphertext_scalar_mul(SM2_ELGAMAL_CIPHERTEXT *R,
 	const uint8_t scalar[32], const SM2_ELGAMAL_CIPHERTEXT *A,
 	const SM2_KEY *pub_key)
 {
-	SM2_Fn k;
-	uint8_t k_bytes[32];
-	SM2_POINT kP;
+	sm2_z256_t k;
+	sm2_z256_t s;
+	SM2_Z256_POINT kP;
+	SM2_ELGAMAL_CIPHERTEXT c;
 
 	if (!R || !scalar || !A || !pub_key) {
 		error_print();
 		return -1;
 	}
-
-	do {
-		if (sm2_fn_rand(k) != 1) {
-			error_print();
-			return -1;
-		}
-	} while (sm2_bn_is_zero(k));
-	sm2_bn_to_bytes(k, k_bytes);
+	if (sm2_elgamal_rand_k(k) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_from_bytes(s, scalar);
 
 	// R1 = s*C1 + k*G
-	sm2_point_mul_sum(&R->C1, scalar, &A->C1, k_bytes);
+	sm2_z256_point_mul_sum(&c.C1, s, &A->C1, k);
+
+	// R2 = s*C2 + k*P
+	sm2_z256_point_mul(&kP, k, &pub_key->public_key);
+	sm2_z256_point_mul(&c.C2, s, &A->C2);
+	sm2_z256_point_add(&c.C2, &c.C2, &kP);
+
+	*R = c;
+	gmssl_secure_clear(k, sizeof(k));
+	gmssl_secure_clear(s, sizeof(s));
+	return 1;
+}
+
+typedef struct {
+	const SM2_ELGAMAL_CIPHERTEXT *c;
+	size_t num;
+	SM2_ELGAMAL_CIPHERTEXT sum; // jacobian
+} SM2_ELGAMAL_SUM_JOB;
+
+static void sm2_elgamal_sum_job(SM2_ELGAMAL_SUM_JOB *job)
+{
+	size_t i;
+
+	memset(&job->sum, 0, sizeof(job->sum));
+	for (i = 0; i < job->num; i++) {
+		sm2_z256_point_add(&job->sum.C1, &job->sum.C1, &job->c[i].C1);
+		sm2_z256_point_add(&job->sum.C2, &job->sum.C2, &job->c[i].C2);
+	}
+}
+
+static void sm2_elgamal_sum_task(void *arg)
+{
+	sm2_elgamal_sum_job((SM2_ELGAMAL_SUM_JOB *)arg);
+}
+
+int sm2_elgamal_ciphertext_sum(SM2_ELGAMAL_CIPHERTEXT *r,
+	const SM2_ELGAMAL_CIPHERTEXT *c, size_t num,
+	const SM2_KEY *pub_key, int threads)
+{
+	SM2_ELGAMAL_SUM_JOB jobs[SM2_ELGAMAL_SUM_MAX_THREADS];
+	SM2_Z256_POINT P[2];
+	SM2_Z256_AFFINE_POINT A[2];
+	sm2_z256_t k;
+	int i, step;
 
-	// R2 = s*C2 + r*P
-	sm2_point_mul(&kP, k_bytes, &pub_key->public_key);
-	sm2_point_mul(&R->C2, scalar, &A->C2);
-	sm2_point_add(&R->C2, &R->C2, &kP);
+	if (!r || (!c && num) || !pub_key) {
+		error_print();
+		return -1;
+	}
+	if (sm2_elgamal_rand_k(k) != 1) {
+		error_print();
+		return -1;
+	}
 
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM2_ELGAMAL_SUM_MAX_THREADS) {
+		threads = SM2_ELGAMAL_SUM_MAX_THREADS;
+	}
+	if ((size_t)threads > num / SM2_ELGAMAL_SUM_MIN_PER_THREAD) {
+		threads = num / SM2_ELGAMAL_SUM_MIN_PER_THREAD ? (int)(num / SM2_ELGAMAL_SUM_MIN_PER_THREAD) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i].c = c + (num * i) / threads;
+		jobs[i].num = (num * (i + 1)) / threads - (num * i) / threads;
+	}
+	gmssl_thread_pool_run(sm2_elgamal_sum_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	// pairwise reduction of the partial sums into jobs[0]
+	for (step = 1; step < threads; step *= 2) {
+		for (i = 0; i + step < threads; i += 2 * step) {
+			sm2_z256_point_add(&jobs[i].sum.C1, &jobs[i].sum.C1, &jobs[i + step].sum.C1);
+			sm2_z256_point_add(&jobs[i].sum.C2, &jobs[i].sum.C2, &jobs[i + step].sum.C2);
+		}
+	}
+
+	// (C1 + k*G, C2 + k*P), both made affine with one inversion
+	sm2_z256_point_mul_generator(&P[0], k);
+	sm2_z256_point_add(&P[0], &P[0], &jobs[0].sum.C1);
+	sm2_z256_point_mul(&P[1], k, &pub_key->public_key);
+	sm2_z256_point_add(&P[1], &P[1], &jobs[0].sum.C2);
 	gmssl_secure_clear(k, sizeof(k));
-	gmssl_secure_clear(k_bytes, sizeof(k_bytes));
+
+	if (sm2_z256_points_get_affine_batch(P, 2, A) != 1) {
+		// a point at infinity, only with a negligible probability
+		r->C1 = P[0];
+		r->C2 = P[1];
+		return 1;
+	}
+	sm2_z256_point_copy_affine(&r->C1, &A[0]);
+	sm2_z256_point_copy_affine(&r->C2, &A[1]);
 	return 1;
 }
 
@@ -334,10 +562,13 @@ int sm2_elgamal_ciphertext_to_der(const SM2_ELGAMAL_CIPHERTEXT *c, uint8_t **out
 {
 	uint8_t c1[65];
 	uint8_t c2[65];
-	size_t len;
+	size_t len = 0;
 
-	sm2_point_to_uncompressed_octets(&c->C1, c1);
-	sm2_point_to_uncompressed_octets(&c->C2, c2);
+	if (sm2_z256_point_to_uncompressed_octets(&c->C1, c1) != 1
+		|| sm2_z256_point_to_uncompressed_octets(&c->C2, c2) != 1) {
+		error_print();
+		return -1;
+	}
 
 	if (asn1_octet_string_to_der(c1, sizeof(c1), NULL, &len) != 1
 		|| asn1_octet_string_to_der(c2, sizeof(c2), NULL, &len) != 1
@@ -371,8 +602,8 @@ int sm2_elgamal_ciphertext_from_der(SM2_ELGAMAL_CIPHERTEXT *c, const uint8_t **i
 		error_print();
 		return -1;
 	}
-	if (sm2_point_from_octets(&c->C1, c1, c1len) != 1
-		|| sm2_point_from_octets(&c->C2, c2, c2len) != 1) {
+	if (sm2_z256_point_from_octets(&c->C1, c1, c1len) != 1
+		|| sm2_z256_point_from_octets(&c->C2, c2, c2len) != 1) {
 		error_print();
 		return -1;
 	}
@@ -32,38 +32,22 @@ static int all_zero(const uint8_t *buf, size_t len)
 
 int sm2_kdf(const uint8_t *in, size_t inlen, size_t outlen, uint8_t *out)
 {
-	SM3_CTX ctx;
-	uint8_t counter_be[4];
-	uint8_t dgst[SM3_DIGEST_SIZE];
-	uint32_t counter = 1;
-	size_t len;
+	SM3_KDF_CTX ctx;
 
-	while (outlen) {
-		PUTU32(counter_be, counter);
-		counter++;
+	sm3_kdf_init(&ctx, outlen);
+	sm3_kdf_update(&ctx, in, inlen);
+	sm3_kdf_finish(&ctx, out);
 
-		sm3_init(&ctx);
-		sm3_update(&ctx, in, inlen);
-		sm3_update(&ctx, counter_be, sizeof(counter_be));
-		sm3_finish(&ctx, dgst);
-
-		len = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
-		memcpy(out, dgst, len);
-		out += len;
-		outlen -= len;
-	}
-
-	memset(&ctx, 0, sizeof(SM3_CTX));
-	memset(dgst, 0, sizeof(dgst));
+	gmssl_secure_clear(&ctx, sizeof(ctx));
 	return 1;
 }
 
-// use Montgomery's Trick to inverse Z coordinates on multiple (x1, y1) = [k]G
+// (x1, y1) = [k]G of all the entries with one inversion
 int sm2_encrypt_pre_compute(SM2_ENC_PRE_COMP pre_comp[SM2_ENC_PRE_COMP_NUM])
 {
 	SM2_Z256_POINT P[SM2_ENC_PRE_COMP_NUM];
-	sm2_z256_t f[SM2_ENC_PRE_COMP_NUM];
-	sm2_z256_t g[SM2_ENC_PRE_COMP_NUM];
+	SM2_Z256_AFFINE_POINT A[SM2_ENC_PRE_COMP_NUM];
+	sm2_z256_t t;
 	int i;
 
 	for (i = 0; i < SM2_ENC_PRE_COMP_NUM; i++) {
@@ -80,85 +64,31 @@ int sm2_encrypt_pre_compute(SM2_ENC_PRE_COMP pre_comp[SM2_ENC_PRE_COMP_NUM])
 		sm2_z256_point_mul_generator(&P[i], pre_comp[i].k);
 	}
 
-	// f[0] = Z[0]
-	// f[1] = Z[0] * Z[1]
-	// ...
-	// f[31] = Z[0] * Z[1] * ... * Z[31]
-	sm2_z256_copy(f[0], P[0].Z);
-	for (i = 1; i < SM2_ENC_PRE_COMP_NUM; i++) {
-		sm2_z256_modp_mont_mul(f[i], f[i - 1], P[i].Z);
-	}
-
-	// f[31]^-1 = (Z[0] * ... * Z[31])^-1
-	sm2_z256_modp_mont_inv(f[SM2_ENC_PRE_COMP_NUM - 1], f[SM2_ENC_PRE_COMP_NUM - 1]);
-
-	// g[31] = Z[31]
-	// g[30] = Z[30] * Z[31]
-	// ...
-	// g[1] = Z[1] * Z[2] * ... * Z[31]
-	//
-	sm2_z256_copy(g[SM2_ENC_PRE_COMP_NUM - 1], P[SM2_ENC_PRE_COMP_NUM - 1].Z);
-	for (i = SM2_ENC_PRE_COMP_NUM - 2; i >= 1; i--) {
-		sm2_z256_modp_mont_mul(g[i], g[i + 1], P[i].Z);
-	}
-
-	// Z[0]^-1 = g[1] * f[31]^-1
-	// Z[1]^-1 = g[2] * f[0] * f[31]^-1
-	// Z[2]^-1 = g[3] * f[1] * f[31]^-1
-	// ...
-	// Z[30]^-1 = g[31] * f[29] * f[31]^-1
-	// Z[31]^-1 = f[30] * f[31]^-1
-	sm2_z256_modp_mont_mul(P[0].Z, g[1], f[SM2_ENC_PRE_COMP_NUM - 1]);
-	for (i = 1; i < SM2_ENC_PRE_COMP_NUM - 1; i++) {
-		sm2_z256_modp_mont_mul(P[i].Z, g[i + 1], f[i - 1]);
-		sm2_z256_modp_mont_mul(P[i].Z, P[i].Z, f[SM2_ENC_PRE_COMP_NUM - 1]);
-	}
-	sm2_z256_modp_mont_mul(P[SM2_ENC_PRE_COMP_NUM - 1].Z,
-		f[SM2_ENC_PRE_COMP_NUM - 2], f[SM2_ENC_PRE_COMP_NUM - 1]);
-
-	// y[i] = Y[i] * Z[i]^-3 (mod n)
-	// x[i] = X[i] * Z[i]^-2 (mod n)
-	for (i = 0; i < SM2_ENC_PRE_COMP_NUM; i++) {
-
-		sm2_z256_modp_mont_mul(P[i].Y, P[i].Y, P[i].Z);
-		sm2_z256_modp_mont_sqr(P[i].Z, P[i].Z);
-		sm2_z256_modp_mont_mul(P[i].Y, P[i].Y, P[i].Z);
-		sm2_z256_modp_mont_mul(P[i].X, P[i].X, P[i].Z);
-
-		sm2_z256_modp_from_mont(P[i].X, P[i].X);
-		sm2_z256_modp_from_mont(P[i].Y, P[i].Y);
+	sm2_z256_points_get_affine_batch(P, SM2_ENC_PRE_COMP_NUM, A);
 
-		sm2_z256_to_bytes(P[i].X, pre_comp[i].C1.x);
-		sm2_z256_to_bytes(P[i].Y, pre_comp[i].C1.y);
+	for (i = 0; i < SM2_ENC_PRE_COMP_NUM; i++) {
+		sm2_z256_modp_from_mont(t, A[i].x);
+		sm2_z256_to_bytes(t, pre_comp[i].C1.x);
+		sm2_z256_modp_from_mont(t, A[i].y);
+		sm2_z256_to_bytes(t, pre_comp[i].C1.y);
 	}
 
 	return 1;
 }
 
-int sm2_do_encrypt_ex(const SM2_KEY *key, const SM2_ENC_PRE_COMP *pre_comp,
-	const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+// C2 and C3 from (x2, y2) = k * P, return 0 if t is all zero, out->point is set by the caller
+static int sm2_do_encrypt_with_kP(const SM2_Z256_POINT *kP, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
 {
-	SM2_Z256_POINT kP;
 	uint8_t x2y2[64];
 	SM3_CTX sm3_ctx;
 
-	if (inlen < 1 || inlen > SM2_MAX_PLAINTEXT_SIZE) {
-		error_print();
-		return -1;
-	}
-
-	// output C1
-	out->point = pre_comp->C1;
-
-	// k * P = (x2, y2)
-	sm2_z256_point_mul(&kP, pre_comp->k, &key->public_key);
-	sm2_z256_point_to_bytes(&kP, x2y2);
+	sm2_z256_point_to_bytes(kP, x2y2);
 
 	// t = KDF(x2 || y2, inlen)
 	sm2_kdf(x2y2, 64, inlen, out->ciphertext);
 
-	// if t is all zero, return 0, caller should change pre_comp and retry
 	if (all_zero(out->ciphertext, inlen)) {
+		gmssl_secure_clear(x2y2, sizeof(x2y2));
 		return 0;
 	}
 
@@ -173,19 +103,40 @@ int sm2_do_encrypt_ex(const SM2_KEY *key, const SM2_ENC_PRE_COMP *pre_comp,
 	sm3_update(&sm3_ctx, x2y2 + 32, 32);
 	sm3_finish(&sm3_ctx, out->hash);
 
-	gmssl_secure_clear(&kP, sizeof(SM2_Z256_POINT));
 	gmssl_secure_clear(x2y2, sizeof(x2y2));
 	return 1;
 }
 
+int sm2_do_encrypt_ex(const SM2_KEY *key, const SM2_ENC_PRE_COMP *pre_comp,
+	const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+{
+	SM2_Z256_POINT kP;
+	int ret;
+
+	if (inlen < 1 || inlen > SM2_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	// output C1
+	out->point = pre_comp->C1;
+
+	// k * P = (x2, y2)
+	sm2_z256_point_mul(&kP, pre_comp->k, &key->public_key);
+
+	// if t is all zero, return 0, caller should change pre_comp and retry
+	ret = sm2_do_encrypt_with_kP(&kP, in, inlen, out);
+
+	gmssl_secure_clear(&kP, sizeof(SM2_Z256_POINT));
+	return ret;
+}
+
 // key->public_key will not be point_at_infinity when decoded from_bytes/octets/der
 int sm2_do_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
 {
 	sm2_z256_t k;
 	SM2_Z256_POINT C1;
 	SM2_Z256_POINT kP;
-	uint8_t x2y2[64];
-	SM3_CTX sm3_ctx;
 
 	if (inlen < 1 || inlen > SM2_MAX_PLAINTEXT_SIZE) {
 		error_print();
@@ -207,33 +158,118 @@ retry:
 
 	// k * P = (x2, y2)
 	sm2_z256_point_mul(&kP, k, &key->public_key);
-	sm2_z256_point_to_bytes(&kP, x2y2);
-
-	// t = KDF(x2 || y2, inlen)
-	sm2_kdf(x2y2, 64, inlen, out->ciphertext);
 
 	// if t is all zero, retry
-	if (all_zero(out->ciphertext, inlen)) {
+	if (sm2_do_encrypt_with_kP(&kP, in, inlen, out) != 1) {
 		goto retry;
 	}
 
-	// output C2 = M xor t
-	gmssl_memxor(out->ciphertext, out->ciphertext, in, inlen);
-	out->ciphertext_size = (uint8_t)inlen;
+	gmssl_secure_clear(k, sizeof(k));
+	gmssl_secure_clear(&kP, sizeof(SM2_Z256_POINT));
+	return 1;
+}
 
-	// output C3 = Hash(x2 || m || y2)
-	sm3_init(&sm3_ctx);
-	sm3_update(&sm3_ctx, x2y2, 32);
-	sm3_update(&sm3_ctx, in, inlen);
-	sm3_update(&sm3_ctx, x2y2 + 32, 32);
-	sm3_finish(&sm3_ctx, out->hash);
+int sm2_enc_key_init(SM2_ENC_KEY *ekey, const SM2_KEY *public_key)
+{
+	if (!ekey || !public_key) {
+		error_print();
+		return -1;
+	}
+	memset(ekey, 0, sizeof(*ekey));
+	if (sm2_key_set_public_key(&ekey->key, &public_key->public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm2_enc_key_pre_compute(SM2_ENC_KEY *ekey)
+{
+	if (!ekey) {
+		error_print();
+		return -1;
+	}
+	if (ekey->point_table) {
+		return 1;
+	}
+	if (!(ekey->point_table = (SM2_Z256_AFFINE_POINT (*)[64])malloc(sizeof(SM2_Z256_AFFINE_POINT) * 37 * 64))) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_point_mul_comb_pre_compute(&ekey->key.public_key, ekey->point_table);
+	return 1;
+}
+
+int sm2_enc_key_do_encrypt_ex(SM2_ENC_KEY *ekey, const SM2_ENC_PRE_COMP *pre_comp,
+	const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+{
+	SM2_Z256_POINT kP;
+	int ret;
+
+	if (inlen < 1 || inlen > SM2_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (sm2_enc_key_pre_compute(ekey) != 1) {
+		error_print();
+		return -1;
+	}
+
+	out->point = pre_comp->C1;
+
+	sm2_z256_point_mul_comb(&kP, pre_comp->k, (const SM2_Z256_AFFINE_POINT (*)[64])ekey->point_table);
+	ret = sm2_do_encrypt_with_kP(&kP, in, inlen, out);
+
+	gmssl_secure_clear(&kP, sizeof(SM2_Z256_POINT));
+	return ret;
+}
+
+int sm2_enc_key_do_encrypt(SM2_ENC_KEY *ekey, const uint8_t *in, size_t inlen, SM2_CIPHERTEXT *out)
+{
+	sm2_z256_t k;
+	SM2_Z256_POINT C1;
+	SM2_Z256_POINT kP;
+
+	if (inlen < 1 || inlen > SM2_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (sm2_enc_key_pre_compute(ekey) != 1) {
+		error_print();
+		return -1;
+	}
+
+retry:
+	do {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(k));
+
+	sm2_z256_point_mul_generator(&C1, k);
+	sm2_z256_point_to_bytes(&C1, (uint8_t *)&out->point);
+
+	sm2_z256_point_mul_comb(&kP, k, (const SM2_Z256_AFFINE_POINT (*)[64])ekey->point_table);
+	if (sm2_do_encrypt_with_kP(&kP, in, inlen, out) != 1) {
+		goto retry;
+	}
 
 	gmssl_secure_clear(k, sizeof(k));
 	gmssl_secure_clear(&kP, sizeof(SM2_Z256_POINT));
-	gmssl_secure_clear(x2y2, sizeof(x2y2));
 	return 1;
 }
 
+void sm2_enc_key_cleanup(SM2_ENC_KEY *ekey)
+{
+	if (ekey) {
+		if (ekey->point_table) {
+			free(ekey->point_table);
+		}
+		memset(ekey, 0, sizeof(*ekey));
+	}
+}
+
 int sm2_do_encrypt_fixlen(const SM2_KEY *key, const uint8_t *in, size_t inlen, int point_size, SM2_CIPHERTEXT *out)
 {
 	unsigned int trys = 200;
@@ -479,6 +515,31 @@ int sm2_encrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, uint8_t *ou
 	return 1;
 }
 
+int sm2_enc_key_encrypt(SM2_ENC_KEY *ekey, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	SM2_CIPHERTEXT C;
+
+	if (!ekey || !in || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!inlen) {
+		error_print();
+		return -1;
+	}
+
+	if (sm2_enc_key_do_encrypt(ekey, in, inlen, &C) != 1) {
+		error_print();
+		return -1;
+	}
+	*outlen = 0;
+	if (sm2_ciphertext_to_der(&C, &out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int sm2_encrypt_fixlen(const SM2_KEY *key, const uint8_t *in, size_t inlen, int point_size, uint8_t *out, size_t *outlen)
 {
 	SM2_CIPHERTEXT C;
@@ -523,6 +584,136 @@ int sm2_decrypt(const SM2_KEY *key, const uint8_t *in, size_t inlen, uint8_t *ou
 	}
 	return 1;
 }
+
+#define SM2_KDF_MAX_BLOCKS	((SM2_MAX_PLAINTEXT_SIZE + SM3_DIGEST_SIZE - 1) / SM3_DIGEST_SIZE)
+
+// the d * C1 of the chunk are made affine with one inversion, the KDF blocks and the C3 hashes
+// of all the entries are computed in the SM3 multi-buffer lanes
+static int sm2_decrypt_batch_chunk(const SM2_KEY *key, const uint8_t *const *ins, const size_t *inlens,
+	size_t count, uint8_t *const *outs, size_t *outlens, int *results)
+{
+	SM2_CIPHERTEXT C[SM2_DECRYPT_BATCH_SIZE];
+	SM2_Z256_POINT P[SM2_DECRYPT_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT A[SM2_DECRYPT_BATCH_SIZE];
+	uint8_t x2y2[SM2_DECRYPT_BATCH_SIZE][64];
+	uint8_t kdf_in[SM2_DECRYPT_BATCH_SIZE * SM2_KDF_MAX_BLOCKS][64 + 4];
+	uint8_t hash_in[SM2_DECRYPT_BATCH_SIZE][64 + SM2_MAX_PLAINTEXT_SIZE];
+	const uint8_t *datas[SM2_DECRYPT_BATCH_SIZE * SM2_KDF_MAX_BLOCKS];
+	size_t datalens[SM2_DECRYPT_BATCH_SIZE * SM2_KDF_MAX_BLOCKS];
+	uint8_t dgsts[SM2_DECRYPT_BATCH_SIZE * SM2_KDF_MAX_BLOCKS][SM3_DIGEST_SIZE];
+	sm2_z256_t t;
+	size_t n, i, j;
+	int ret = 1;
+
+	for (i = 0; i < count; i++) {
+		const uint8_t *in = ins[i];
+		size_t inlen = inlens[i];
+
+		results[i] = -1;
+		if (!in || !outs[i]
+			|| sm2_ciphertext_from_der(&C[i], &in, &inlen) != 1
+			|| asn1_length_is_zero(inlen) != 1
+			|| sm2_z256_point_from_bytes(&P[i], (uint8_t *)&C[i].point) != 1) {
+			error_print();
+			sm2_z256_point_set_infinity(&P[i]);
+			continue;
+		}
+		// d * C1 = (x2, y2)
+		sm2_z256_point_mul(&P[i], key->private_key, &P[i]);
+		if (!sm2_z256_point_is_at_infinity(&P[i])) {
+			results[i] = 1;
+		}
+	}
+	sm2_z256_points_get_affine_batch(P, count, A);
+
+	// t = KDF(x2 || y2, klen)
+	for (i = 0, n = 0; i < count; i++) {
+		if (results[i] != 1) {
+			continue;
+		}
+		sm2_z256_modp_from_mont(t, A[i].x);
+		sm2_z256_to_bytes(t, x2y2[i]);
+		sm2_z256_modp_from_mont(t, A[i].y);
+		sm2_z256_to_bytes(t, x2y2[i] + 32);
+
+		for (j = 0; j * SM3_DIGEST_SIZE < C[i].ciphertext_size; j++, n++) {
+			memcpy(kdf_in[n], x2y2[i], 64);
+			PUTU32(kdf_in[n] + 64, (uint32_t)(j + 1));
+			datas[n] = kdf_in[n];
+			datalens[n] = sizeof(kdf_in[n]);
+		}
+	}
+	sm3_digest_batch(datas, datalens, n, dgsts);
+
+	// M = C2 xor t, u = Hash(x2 || M || y2)
+	for (i = 0, n = 0, j = 0; i < count; i++) {
+		size_t len = C[i].ciphertext_size;
+		size_t k;
+
+		if (results[i] != 1) {
+			continue;
+		}
+		for (k = 0; k < len; k += SM3_DIGEST_SIZE) {
+			memcpy(outs[i] + k, dgsts[n++], len - k < SM3_DIGEST_SIZE ? len - k : SM3_DIGEST_SIZE);
+		}
+		if (all_zero(outs[i], len)) {
+			error_print();
+			results[i] = -1;
+			continue;
+		}
+		gmssl_memxor(outs[i], outs[i], C[i].ciphertext, len);
+		outlens[i] = len;
+
+		memcpy(hash_in[i], x2y2[i], 32);
+		memcpy(hash_in[i] + 32, outs[i], len);
+		memcpy(hash_in[i] + 32 + len, x2y2[i] + 32, 32);
+		datas[j] = hash_in[i];
+		datalens[j] = 64 + len;
+		j++;
+	}
+	sm3_digest_batch(datas, datalens, j, dgsts);
+
+	// check if u == C3
+	for (i = 0, j = 0; i < count; i++) {
+		if (results[i] != 1) {
+			ret = 0;
+			continue;
+		}
+		if (memcmp(C[i].hash, dgsts[j++], SM3_DIGEST_SIZE) != 0) {
+			error_print();
+			results[i] = -1;
+			ret = 0;
+		}
+	}
+
+	gmssl_secure_clear(P, sizeof(P));
+	gmssl_secure_clear(A, sizeof(A));
+	gmssl_secure_clear(t, sizeof(t));
+	gmssl_secure_clear(x2y2, sizeof(x2y2));
+	gmssl_secure_clear(kdf_in, sizeof(kdf_in));
+	gmssl_secure_clear(hash_in, sizeof(hash_in));
+	gmssl_secure_clear(dgsts, sizeof(dgsts));
+	return ret;
+}
+
+int sm2_decrypt_batch(const SM2_KEY *key, const uint8_t *const *ins, const size_t *inlens, size_t count,
+	uint8_t *const *outs, size_t *outlens, int *results)
+{
+	size_t i, n;
+	int ret = 1;
+
+	if (!key || !ins || !inlens || !outs || !outlens || !results) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < count; i += n) {
+		n = count - i < SM2_DECRYPT_BATCH_SIZE ? count - i : SM2_DECRYPT_BATCH_SIZE;
+		if (sm2_decrypt_batch_chunk(key, ins + i, inlens + i, n, outs + i, outlens + i, results + i) != 1) {
+			ret = 0;
+		}
+	}
+	return ret;
+}
 int sm2_encrypt_init(SM2_ENC_CTX *ctx)
 {
 	if (!ctx) {
@@ -621,6 +812,59 @@ int sm2_encrypt_finish(SM2_ENC_CTX *ctx, const SM2_KEY *public_key, uint8_t *out
 	return 1;
 }
 
+int sm2_encrypt_finish_ex(SM2_ENC_CTX *ctx, SM2_ENC_KEY *ekey, uint8_t *out, size_t *outlen)
+{
+	SM2_CIPHERTEXT ciphertext;
+
+	if (!ctx || !ekey || !outlen) {
+		error_print();
+		return -1;
+	}
+
+	if (ctx->buf_size > SM2_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (ctx->buf_size == 0) {
+		error_print();
+		return -1;
+	}
+
+	if (!out) {
+		*outlen = SM2_MAX_CIPHERTEXT_SIZE;
+		return 1;
+	}
+
+#if ENABLE_SM2_ENC_PRE_COMPUTE
+	if (ctx->pre_comp_num == 0) {
+		if (sm2_encrypt_pre_compute(ctx->pre_comp) != 1) {
+			error_print();
+			return -1;
+		}
+		ctx->pre_comp_num = SM2_ENC_PRE_COMP_NUM;
+	}
+
+	ctx->pre_comp_num--;
+	if (sm2_enc_key_do_encrypt_ex(ekey, &ctx->pre_comp[ctx->pre_comp_num], ctx->buf, ctx->buf_size, &ciphertext) != 1) {
+		error_print();
+		return -1;
+	}
+
+	*outlen = 0;
+	if (sm2_ciphertext_to_der(&ciphertext, &out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+#else
+	if (sm2_enc_key_encrypt(ekey, ctx->buf, ctx->buf_size, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+
+	return 1;
+}
+
 int sm2_encrypt_reset(SM2_ENC_CTX *ctx)
 {
 	if (!ctx) {
@@ -18,6 +18,7 @@
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#include <gmssl/thread_pool.h>
 
 
 int sm2_do_ecdh(const SM2_KEY *key, const SM2_Z256_POINT *peer_public, SM2_Z256_POINT *out)
@@ -47,3 +48,218 @@ int sm2_ecdh(const SM2_KEY *key, const uint8_t *peer_public, size_t peer_public_
 	sm2_z256_point_to_bytes(&point, out);
 	return 1;
 }
+
+
+typedef struct {
+	const SM2_KEY *key;
+	const SM2_Z256_POINT *peers;
+	const uint8_t *const *peer_octets;
+	const size_t *peer_octets_lens;
+	SM2_Z256_POINT *outs;
+	uint8_t (*out_bytes)[64];
+	int *results;
+	size_t first;
+	size_t last;
+	size_t invalid_cnt;
+} SM2_ECDH_JOB;
+
+#define SM2_ECDH_WINDOWS	((256 + 5 - 1)/5)
+
+// R = k * P with the 5-bit Booth digits of k and the affine table of P, see sm2_z256_point_mul()
+static void sm2_ecdh_point_mul(SM2_Z256_POINT *R, const int booth[SM2_ECDH_WINDOWS],
+	const SM2_Z256_AFFINE_POINT T[16])
+{
+	int R_infinity = 1;
+	int i;
+
+	for (i = SM2_ECDH_WINDOWS - 1; i >= 0; i--) {
+		if (R_infinity) {
+			if (booth[i] != 0) {
+				sm2_z256_point_copy_affine(R, &T[booth[i] - 1]);
+				R_infinity = 0;
+			}
+		} else {
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+
+			if (booth[i] > 0) {
+				sm2_z256_point_add_affine(R, R, &T[booth[i] - 1]);
+			} else if (booth[i] < 0) {
+				sm2_z256_point_sub_affine(R, R, &T[-booth[i] - 1]);
+			}
+		}
+	}
+
+	if (R_infinity) {
+		memset(R, 0, sizeof(*R));
+	}
+}
+
+// return the number of invalid peers
+static size_t sm2_ecdh_range(const SM2_ECDH_JOB *job, const int booth[SM2_ECDH_WINDOWS], size_t first, size_t n)
+{
+	SM2_Z256_POINT P[SM2_ECDH_BATCH_SIZE];
+	SM2_Z256_POINT J[SM2_ECDH_BATCH_SIZE][16];
+	SM2_Z256_AFFINE_POINT T[SM2_ECDH_BATCH_SIZE][16];
+	SM2_Z256_AFFINE_POINT A[SM2_ECDH_BATCH_SIZE];
+	int ok[SM2_ECDH_BATCH_SIZE];
+	size_t invalid_cnt = 0;
+	size_t i;
+
+	if (job->peer_octets) {
+		sm2_z256_points_from_octets_batch(P, job->peer_octets + first, job->peer_octets_lens + first, n, ok);
+	} else {
+		for (i = 0; i < n; i++) {
+			P[i] = job->peers[first + i];
+			ok[i] = !sm2_z256_point_is_at_infinity(&P[i]) && sm2_z256_point_is_on_curve(&P[i]) == 1;
+		}
+	}
+
+	// the tables only depend on the public peers, one variable-time inversion for all of them
+	for (i = 0; i < n; i++) {
+		if (ok[i]) {
+			sm2_z256_point_mul_pre_compute(&P[i], J[i]);
+		} else {
+			memset(J[i], 0, sizeof(J[i]));
+		}
+	}
+	sm2_z256_points_get_affine_batch_vartime(&J[0][0], 16 * n, &T[0][0]);
+
+	for (i = 0; i < n; i++) {
+		if (ok[i]) {
+			sm2_ecdh_point_mul(&P[i], booth, T[i]);
+		} else {
+			memset(&P[i], 0, sizeof(P[i]));
+		}
+	}
+	// the shared secrets take the constant-time inversion
+	sm2_z256_points_get_affine_batch(P, n, A);
+
+	for (i = 0; i < n; i++) {
+		if (ok[i] && sm2_z256_is_zero(A[i].x) && sm2_z256_is_zero(A[i].y)) {
+			ok[i] = 0;
+		}
+		if (!ok[i]) {
+			memset(&A[i], 0, sizeof(A[i]));
+			invalid_cnt++;
+		}
+		if (job->outs) {
+			if (ok[i]) {
+				sm2_z256_point_copy_affine(&job->outs[first + i], &A[i]);
+			} else {
+				memset(&job->outs[first + i], 0, sizeof(SM2_Z256_POINT));
+			}
+		}
+		if (job->out_bytes) {
+			sm2_z256_modp_from_mont(A[i].x, A[i].x);
+			sm2_z256_modp_from_mont(A[i].y, A[i].y);
+			sm2_z256_to_bytes(A[i].x, job->out_bytes[first + i]);
+			sm2_z256_to_bytes(A[i].y, job->out_bytes[first + i] + 32);
+		}
+		if (job->results) {
+			job->results[first + i] = ok[i] ? 1 : -1;
+		}
+	}
+
+	gmssl_secure_clear(P, sizeof(P));
+	gmssl_secure_clear(A, sizeof(A));
+	return invalid_cnt;
+}
+
+static void sm2_ecdh_job(SM2_ECDH_JOB *job)
+{
+	int booth[SM2_ECDH_WINDOWS];
+	size_t first, n;
+	int i;
+
+	// the digits of the private key are shared by all the peers
+	for (i = 0; i < SM2_ECDH_WINDOWS; i++) {
+		booth[i] = sm2_z256_get_booth(job->key->private_key, 5, i);
+	}
+	for (first = job->first; first < job->last; first += n) {
+		n = job->last - first < SM2_ECDH_BATCH_SIZE ? job->last - first : SM2_ECDH_BATCH_SIZE;
+		job->invalid_cnt += sm2_ecdh_range(job, booth, first, n);
+	}
+	gmssl_secure_clear(booth, sizeof(booth));
+}
+
+static void sm2_ecdh_task(void *arg)
+{
+	sm2_ecdh_job((SM2_ECDH_JOB *)arg);
+}
+
+static int sm2_ecdh_run(const SM2_ECDH_JOB *job, size_t count, int threads)
+{
+	SM2_ECDH_JOB jobs[SM2_ECDH_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM2_ECDH_MAX_THREADS) {
+		threads = SM2_ECDH_MAX_THREADS;
+	}
+	if ((size_t)threads > count / SM2_ECDH_THREAD_MIN_PEERS) {
+		threads = count / SM2_ECDH_THREAD_MIN_PEERS ? (int)(count / SM2_ECDH_THREAD_MIN_PEERS) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i] = *job;
+		jobs[i].first = (count * i) / threads;
+		jobs[i].last = (count * (i + 1)) / threads;
+		jobs[i].invalid_cnt = 0;
+	}
+	gmssl_thread_pool_run(sm2_ecdh_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].invalid_cnt) {
+			ret = 0;
+		}
+	}
+	return ret;
+}
+
+int sm2_do_ecdh_batch(const SM2_KEY *key, const SM2_Z256_POINT *peer_publics, size_t count,
+	SM2_Z256_POINT *outs, int *results, int threads)
+{
+	SM2_ECDH_JOB job;
+
+	if (!key || !peer_publics || !outs) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+	memset(&job, 0, sizeof(job));
+	job.key = key;
+	job.peers = peer_publics;
+	job.outs = outs;
+	job.results = results;
+	return sm2_ecdh_run(&job, count, threads);
+}
+
+int sm2_ecdh_batch(const SM2_KEY *key, const uint8_t *const *peer_publics, const size_t *peer_public_lens,
+	size_t count, uint8_t (*outs)[64], int *results, int threads)
+{
+	SM2_ECDH_JOB job;
+
+	if (!key || !peer_publics || !peer_public_lens || !outs) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+	memset(&job, 0, sizeof(job));
+	job.key = key;
+	job.peer_octets = peer_publics;
+	job.peer_octets_lens = peer_public_lens;
+	job.out_bytes = outs;
+	job.results = results;
+	return sm2_ecdh_run(&job, count, threads);
+}
@@ -9,6 +9,7 @@
 
 
 #include <string.h>
+#include <stdlib.h>
 #include <gmssl/sm2_z256.h>
 #include <gmssl/oid.h>
 #include <gmssl/asn1.h>
@@ -21,8 +22,16 @@
 #include <gmssl/ec.h>
 #include <gmssl/mem.h>
 #include <gmssl/x509_alg.h>
+#include <gmssl/thread_pool.h>
 
 
+// d in [1, n-2], so d + 1 is invertible
+static void sm2_key_set_fast_private(SM2_KEY *key)
+{
+	sm2_z256_modn_add(key->fast_private, key->private_key, sm2_z256_one());
+	sm2_z256_modn_inv(key->fast_private, key->fast_private);
+}
+
 int sm2_key_generate(SM2_KEY *key)
 {
 	if (!key) {
@@ -39,10 +48,126 @@ int sm2_key_generate(SM2_KEY *key)
 	} while (sm2_z256_is_zero(key->private_key));
 
 	sm2_z256_point_mul_generator(&key->public_key, key->private_key);
+	sm2_key_set_fast_private(key);
 
 	return 1;
 }
 
+typedef struct {
+	SM2_KEY *keys;
+	size_t first;
+	size_t last;
+	int ret;
+} SM2_KEY_GENERATE_JOB;
+
+static int sm2_key_generate_range(SM2_KEY *keys, size_t n)
+{
+	SM2_Z256_POINT P[SM2_KEY_GENERATE_BATCH_SIZE];
+	SM2_Z256_AFFINE_POINT A[SM2_KEY_GENERATE_BATCH_SIZE];
+	uint64_t d[SM2_KEY_GENERATE_BATCH_SIZE][4];
+	sm2_z256_t d_plus_one[SM2_KEY_GENERATE_BATCH_SIZE];
+	sm2_z256_t fast_private[SM2_KEY_GENERATE_BATCH_SIZE];
+	size_t i;
+	int ret = -1;
+
+	// rand sk in [1, n-2], redraw the rare out of range ones one by one
+	if (rand_bytes((uint8_t *)d, sizeof(d[0]) * n) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < n; i++) {
+		while (sm2_z256_is_zero(d[i]) || sm2_z256_cmp(d[i], sm2_z256_order_minus_one()) >= 0) {
+			if (sm2_z256_rand_range(d[i], sm2_z256_order_minus_one()) < 0) {
+				error_print();
+				goto end;
+			}
+		}
+		sm2_z256_point_mul_generator(&P[i], d[i]);
+		sm2_z256_modn_add(d_plus_one[i], d[i], sm2_z256_one());
+	}
+
+	// one inversion for the public keys, another one for all the (d + 1)^-1
+	sm2_z256_points_get_affine_batch(P, n, A);
+	sm2_z256_modn_inv_batch(fast_private, (const sm2_z256_t *)d_plus_one, n);
+	for (i = 0; i < n; i++) {
+		sm2_z256_copy(keys[i].private_key, d[i]);
+		sm2_z256_copy(keys[i].fast_private, fast_private[i]);
+		sm2_z256_point_copy_affine(&keys[i].public_key, &A[i]);
+	}
+	ret = 1;
+
+end:
+	gmssl_secure_clear(d, sizeof(d));
+	gmssl_secure_clear(d_plus_one, sizeof(d_plus_one));
+	gmssl_secure_clear(fast_private, sizeof(fast_private));
+	gmssl_secure_clear(P, sizeof(P));
+	return ret;
+}
+
+static void sm2_key_generate_job(SM2_KEY_GENERATE_JOB *job)
+{
+	size_t first, n;
+
+	for (first = job->first; first < job->last; first += n) {
+		n = job->last - first < SM2_KEY_GENERATE_BATCH_SIZE ? job->last - first : SM2_KEY_GENERATE_BATCH_SIZE;
+		if (sm2_key_generate_range(job->keys + first, n) != 1) {
+			error_print();
+			job->ret = -1;
+			break;
+		}
+	}
+}
+
+static void sm2_key_generate_task(void *arg)
+{
+	sm2_key_generate_job((SM2_KEY_GENERATE_JOB *)arg);
+}
+
+// every thread gets at least one full batch, rand_bytes() has a DRBG per thread
+int sm2_key_generate_batch(SM2_KEY *keys, size_t num, int threads)
+{
+	SM2_KEY_GENERATE_JOB jobs[SM2_KEY_GENERATE_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (!keys) {
+		error_print();
+		return -1;
+	}
+	if (!num) {
+		return 1;
+	}
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM2_KEY_GENERATE_MAX_THREADS) {
+		threads = SM2_KEY_GENERATE_MAX_THREADS;
+	}
+	if ((size_t)threads > num / SM2_KEY_GENERATE_BATCH_SIZE) {
+		threads = num / SM2_KEY_GENERATE_BATCH_SIZE ? (int)(num / SM2_KEY_GENERATE_BATCH_SIZE) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i].keys = keys;
+		jobs[i].first = (num * i) / threads;
+		jobs[i].last = (num * (i + 1)) / threads;
+		jobs[i].ret = 1;
+	}
+	gmssl_thread_pool_run(sm2_key_generate_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	if (ret != 1) {
+		gmssl_secure_clear(keys, sizeof(SM2_KEY) * num);
+		error_print();
+	}
+	return ret;
+}
+
 int sm2_key_set_private_key(SM2_KEY *key, const sm2_z256_t private_key)
 {
 	if (!key || !private_key) {
@@ -60,6 +185,7 @@ int sm2_key_set_private_key(SM2_KEY *key, const sm2_z256_t private_key)
 	}
 	sm2_z256_copy(key->private_key, private_key);
 	sm2_z256_point_mul_generator(&key->public_key, private_key);
+	sm2_key_set_fast_private(key);
 
 	return 1;
 }
@@ -73,6 +199,7 @@ int sm2_key_set_public_key(SM2_KEY *key, const SM2_Z256_POINT *public_key)
 
 	key->public_key = *public_key;
 	sm2_z256_set_zero(key->private_key);
+	sm2_z256_set_zero(key->fast_private);
 
 	return 1;
 }
@@ -123,6 +250,7 @@ int sm2_public_key_from_der(SM2_KEY *key, const uint8_t **in, size_t *inlen)
 		return -1;
 	}
 	sm2_z256_set_zero(key->private_key);
+	sm2_z256_set_zero(key->fast_private);
 
 	return 1;
 }
@@ -172,7 +300,7 @@ int sm2_private_key_to_der(const SM2_KEY *key, uint8_t **out, size_t *outlen)
 	size_t params_len = 0;
 	size_t pubkey_len = 0;
 	uint8_t prikey[32];
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (!key) {
 		error_print();
@@ -184,15 +312,12 @@ int sm2_private_key_to_der(const SM2_KEY *key, uint8_t **out, size_t *outlen)
 		return -1;
 	}
 	sm2_z256_to_bytes(key->private_key, prikey);
-	if (asn1_int_to_der(EC_private_key_version, NULL, &len) != 1
-		|| asn1_octet_string_to_der(prikey, 32, NULL, &len) != 1
-		|| asn1_explicit_to_der(0, params, params_len, NULL, &len) != 1
-		|| asn1_explicit_to_der(1, pubkey, pubkey_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(EC_private_key_version, out, outlen) != 1
 		|| asn1_octet_string_to_der(prikey, 32, out, outlen) != 1
 		|| asn1_explicit_to_der(0, params, params_len, out, outlen) != 1
-		|| asn1_explicit_to_der(1, pubkey, pubkey_len, out, outlen) != 1) {
+		|| asn1_explicit_to_der(1, pubkey, pubkey_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		gmssl_secure_clear(prikey, 32);
 		error_print();
 		return -1;
@@ -272,7 +397,7 @@ int sm2_private_key_print(FILE *fp, int fmt, int ind, const char *label, const u
 
 int sm2_private_key_info_to_der(const SM2_KEY *sm2_key, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	uint8_t prikey[SM2_PRIVATE_KEY_DER_SIZE];
 	uint8_t *p = prikey;
 	size_t prikey_len = 0;
@@ -281,13 +406,11 @@ int sm2_private_key_info_to_der(const SM2_KEY *sm2_key, uint8_t **out, size_t *o
 		error_print();
 		return -1;
 	}
-	if (asn1_int_to_der(PKCS8_private_key_info_version, NULL, &len) != 1
-		|| sm2_public_key_algor_to_der(NULL, &len) != 1
-		|| asn1_octet_string_to_der(prikey, prikey_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(PKCS8_private_key_info_version, out, outlen) != 1
 		|| sm2_public_key_algor_to_der(out, outlen) != 1
-		|| asn1_octet_string_to_der(prikey, prikey_len, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(prikey, prikey_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		memset(prikey, 0, sizeof(prikey));
 		error_print();
 		return -1;
@@ -407,12 +530,11 @@ int sm2_private_key_info_from_pem(SM2_KEY *sm2_key, FILE *fp)
 
 int sm2_public_key_info_to_der(const SM2_KEY *pub_key, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (sm2_public_key_algor_to_der(NULL, &len) != 1
-		|| sm2_public_key_to_der(pub_key, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| sm2_public_key_algor_to_der(out, outlen) != 1
-		|| sm2_public_key_to_der(pub_key, out, outlen) != 1) {
+		|| sm2_public_key_to_der(pub_key, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -584,58 +706,158 @@ end:
 	return ret;
 }
 
-int sm2_private_key_info_decrypt_from_der(SM2_KEY *sm2,
-	const uint8_t **attrs, size_t *attrs_len,
-	const char *pass, const uint8_t **in, size_t *inlen)
-{
-	int ret = -1;
+typedef struct {
 	const uint8_t *salt;
 	size_t saltlen;
 	int iter;
+	const uint8_t *iv;
+	const uint8_t *enced_pkey_info;
+	size_t enced_pkey_info_len;
+} SM2_ENCED_PRIVATE_KEY_INFO;
+
+static int sm2_enced_private_key_info_from_der(SM2_ENCED_PRIVATE_KEY_INFO *info,
+	const uint8_t **in, size_t *inlen)
+{
 	int keylen;
 	int prf;
 	int cipher;
-	const uint8_t *iv;
 	size_t ivlen;
-	uint8_t key[16];
+
+	if (pkcs8_enced_private_key_info_from_der(&info->salt, &info->saltlen, &info->iter, &keylen, &prf,
+		&cipher, &info->iv, &ivlen, &info->enced_pkey_info, &info->enced_pkey_info_len, in, inlen) != 1
+		|| asn1_check(keylen == -1 || keylen == 16) != 1
+		|| asn1_check(prf == - 1 || prf == OID_hmac_sm3) != 1
+		|| asn1_check(cipher == OID_sm4_cbc) != 1
+		|| asn1_check(ivlen == 16) != 1
+		|| asn1_length_le(info->enced_pkey_info_len, 256) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int sm2_enced_private_key_info_decrypt(SM2_KEY *sm2,
+	const uint8_t **attrs, size_t *attrs_len,
+	const SM2_ENCED_PRIVATE_KEY_INFO *info, const uint8_t key[16])
+{
+	int ret = -1;
 	SM4_KEY sm4_key;
-	const uint8_t *enced_pkey_info;
-	size_t enced_pkey_info_len;
 	uint8_t pkey_info[256];
 	const uint8_t *cp = pkey_info;
 	size_t pkey_info_len;
 
+	sm4_set_decrypt_key(&sm4_key, key);
+	if (sm4_cbc_padding_decrypt(&sm4_key, info->iv, info->enced_pkey_info, info->enced_pkey_info_len,
+			pkey_info, &pkey_info_len) != 1
+		|| sm2_private_key_info_from_der(sm2, attrs, attrs_len, &cp, &pkey_info_len) != 1
+		|| asn1_length_is_zero(pkey_info_len) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+end:
+	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+	gmssl_secure_clear(pkey_info, sizeof(pkey_info));
+	return ret;
+}
+
+int sm2_private_key_info_decrypt_from_der(SM2_KEY *sm2,
+	const uint8_t **attrs, size_t *attrs_len,
+	const char *pass, const uint8_t **in, size_t *inlen)
+{
+	int ret = -1;
+	SM2_ENCED_PRIVATE_KEY_INFO info;
+	uint8_t key[16];
+	uint8_t *keyp = key;
+
 	if (!sm2 || !attrs || !attrs_len || !pass || !in || !(*in) || !inlen) {
 		error_print();
 		return -1;
 	}
-	if (pkcs8_enced_private_key_info_from_der(&salt, &saltlen, &iter, &keylen, &prf,
-		&cipher, &iv, &ivlen, &enced_pkey_info, &enced_pkey_info_len, in, inlen) != 1
-		|| asn1_check(keylen == -1 || keylen == 16) != 1
-		|| asn1_check(prf == - 1 || prf == OID_hmac_sm3) != 1
-		|| asn1_check(cipher == OID_sm4_cbc) != 1
-		|| asn1_check(ivlen == 16) != 1
-		|| asn1_length_le(enced_pkey_info_len, sizeof(pkey_info)) != 1) {
+	if (sm2_enced_private_key_info_from_der(&info, in, inlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (sm3_pbkdf2(pass, strlen(pass), salt, saltlen, iter, sizeof(key), key) != 1) {
+	if (pkcs8_derive_keys(&pass, &info.salt, &info.saltlen, &info.iter, 1, sizeof(key), &keyp) != 1
+		|| sm2_enced_private_key_info_decrypt(sm2, attrs, attrs_len, &info, key) != 1) {
 		error_print();
 		goto end;
 	}
-	sm4_set_decrypt_key(&sm4_key, key);
-	if (sm4_cbc_padding_decrypt(&sm4_key, iv, enced_pkey_info, enced_pkey_info_len,
-			pkey_info, &pkey_info_len) != 1
-		|| sm2_private_key_info_from_der(sm2, attrs, attrs_len, &cp, &pkey_info_len) != 1
-		|| asn1_length_is_zero(pkey_info_len) != 1) {
+	ret = 1;
+end:
+	gmssl_secure_clear(key, sizeof(key));
+	return ret;
+}
+
+int sm2_private_key_info_decrypt_from_der_batch(SM2_KEY *sm2_keys,
+	const char *const *passes, const uint8_t *const *ins, const size_t *inlens, size_t num)
+{
+	int ret = -1;
+	SM2_ENCED_PRIVATE_KEY_INFO *infos = NULL;
+	const uint8_t **salts = NULL;
+	size_t *saltlens = NULL;
+	int *iters = NULL;
+	uint8_t (*keys)[16] = NULL;
+	uint8_t **keyps = NULL;
+	const uint8_t *attrs;
+	size_t attrs_len;
+	size_t i;
+
+	if (!sm2_keys || !passes || !ins || !inlens) {
+		error_print();
+		return -1;
+	}
+	if (!num) {
+		return 1;
+	}
+	if (!(infos = (SM2_ENCED_PRIVATE_KEY_INFO *)malloc(num * sizeof(*infos)))
+		|| !(salts = (const uint8_t **)malloc(num * sizeof(*salts)))
+		|| !(saltlens = (size_t *)malloc(num * sizeof(*saltlens)))
+		|| !(iters = (int *)malloc(num * sizeof(*iters)))
+		|| !(keys = (uint8_t (*)[16])malloc(num * sizeof(*keys)))
+		|| !(keyps = (uint8_t **)malloc(num * sizeof(*keyps)))) {
 		error_print();
 		goto end;
 	}
+	for (i = 0; i < num; i++) {
+		const uint8_t *cp = ins[i];
+		size_t len = inlens[i];
+
+		if (!passes[i] || !cp
+			|| sm2_enced_private_key_info_from_der(&infos[i], &cp, &len) != 1
+			|| asn1_length_is_zero(len) != 1) {
+			error_print();
+			goto end;
+		}
+		salts[i] = infos[i].salt;
+		saltlens[i] = infos[i].saltlen;
+		iters[i] = infos[i].iter;
+		keyps[i] = keys[i];
+	}
+	if (pkcs8_derive_keys(passes, salts, saltlens, iters, num, sizeof(keys[0]), keyps) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < num; i++) {
+		if (sm2_enced_private_key_info_decrypt(&sm2_keys[i], &attrs, &attrs_len, &infos[i], keys[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
 	ret = 1;
 end:
-	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
-	gmssl_secure_clear(key, sizeof(key));
-	gmssl_secure_clear(pkey_info, sizeof(pkey_info));
+	if (keys) {
+		gmssl_secure_clear(keys, num * sizeof(*keys));
+		free(keys);
+	}
+	free(infos);
+	free(salts);
+	free(saltlens);
+	free(iters);
+	free(keyps);
+	if (ret != 1) {
+		gmssl_secure_clear(sm2_keys, num * sizeof(SM2_KEY));
+	}
 	return ret;
 }
 
@@ -0,0 +1,235 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+typedef HANDLE pool_thread_t;
+#define pool_mutex_init(m)	InitializeCriticalSection(m)
+#define pool_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pool_mutex_lock(m)	EnterCriticalSection(m)
+#define pool_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pool_cond_init(c)	InitializeConditionVariable(c)
+#define pool_cond_destroy(c)
+#define pool_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pool_cond_signal(c)	WakeConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+typedef pthread_t pool_thread_t;
+#define pool_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pool_mutex_lock(m)	pthread_mutex_lock(m)
+#define pool_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pool_cond_init(c)	pthread_cond_init(c, NULL)
+#define pool_cond_destroy(c)	pthread_cond_destroy(c)
+#define pool_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define pool_cond_signal(c)	pthread_cond_signal(c)
+#endif
+
+
+struct SM2_KEY_POOL_st {
+	pool_mutex_t mutex;
+	pool_cond_t not_full;
+	SM2_KEY *keys;
+	size_t capacity;
+	size_t count;
+	int stop;
+	int background;
+	pool_thread_t thread;
+};
+
+// add up to `num` keys, return the number added
+static size_t sm2_key_pool_push(SM2_KEY_POOL *pool, const SM2_KEY *keys, size_t num)
+{
+	size_t n;
+
+	pool_mutex_lock(&pool->mutex);
+	n = pool->capacity - pool->count;
+	if (n > num) {
+		n = num;
+	}
+	memcpy(pool->keys + pool->count, keys, sizeof(SM2_KEY) * n);
+	pool->count += n;
+	pool_mutex_unlock(&pool->mutex);
+	return n;
+}
+
+// keys are generated without the lock, in batches sharing one inversion
+static int sm2_key_pool_fill(SM2_KEY_POOL *pool, int background)
+{
+	SM2_KEY keys[SM2_KEY_GENERATE_BATCH_SIZE];
+	int ret = 1;
+
+	for (;;) {
+		pool_mutex_lock(&pool->mutex);
+		if (background) {
+			while (!pool->stop && pool->count == pool->capacity) {
+				pool_cond_wait(&pool->not_full, &pool->mutex);
+			}
+		}
+		if (pool->stop || pool->count == pool->capacity) {
+			pool_mutex_unlock(&pool->mutex);
+			break;
+		}
+		pool_mutex_unlock(&pool->mutex);
+
+		if (sm2_key_generate_batch(keys, SM2_KEY_GENERATE_BATCH_SIZE, 1) != 1) {
+			error_print();
+			ret = -1;
+			break;
+		}
+		sm2_key_pool_push(pool, keys, SM2_KEY_GENERATE_BATCH_SIZE);
+	}
+
+	gmssl_secure_clear(keys, sizeof(keys));
+	return ret;
+}
+
+#ifdef _WIN32
+static unsigned __stdcall sm2_key_pool_thread(void *arg)
+{
+	sm2_key_pool_fill((SM2_KEY_POOL *)arg, 1);
+	return 0;
+}
+#else
+static void *sm2_key_pool_thread(void *arg)
+{
+	sm2_key_pool_fill((SM2_KEY_POOL *)arg, 1);
+	return NULL;
+}
+#endif
+
+SM2_KEY_POOL *sm2_key_pool_new(size_t capacity, int background)
+{
+	SM2_KEY_POOL *pool;
+
+	if (!capacity) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (SM2_KEY_POOL *)calloc(1, sizeof(*pool)))) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool->keys = (SM2_KEY *)calloc(capacity, sizeof(SM2_KEY)))) {
+		free(pool);
+		error_print();
+		return NULL;
+	}
+	pool->capacity = capacity;
+	pool_mutex_init(&pool->mutex);
+	pool_cond_init(&pool->not_full);
+
+	if (background) {
+#ifdef _WIN32
+		pool->thread = (HANDLE)_beginthreadex(NULL, 0, sm2_key_pool_thread, pool, 0, NULL);
+		if (pool->thread) {
+			pool->background = 1;
+		}
+#else
+		if (pthread_create(&pool->thread, NULL, sm2_key_pool_thread, pool) == 0) {
+			pool->background = 1;
+		}
+#endif
+		if (!pool->background) {
+			sm2_key_pool_free(pool);
+			error_print();
+			return NULL;
+		}
+	}
+	return pool;
+}
+
+void sm2_key_pool_free(SM2_KEY_POOL *pool)
+{
+	if (!pool) {
+		return;
+	}
+	if (pool->background) {
+		pool_mutex_lock(&pool->mutex);
+		pool->stop = 1;
+		pool_cond_signal(&pool->not_full);
+		pool_mutex_unlock(&pool->mutex);
+#ifdef _WIN32
+		WaitForSingleObject(pool->thread, INFINITE);
+		CloseHandle(pool->thread);
+#else
+		pthread_join(pool->thread, NULL);
+#endif
+	}
+	pool_cond_destroy(&pool->not_full);
+	pool_mutex_destroy(&pool->mutex);
+
+	gmssl_secure_clear(pool->keys, sizeof(SM2_KEY) * pool->capacity);
+	free(pool->keys);
+	free(pool);
+}
+
+int sm2_key_pool_refill(SM2_KEY_POOL *pool)
+{
+	if (!pool) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_pool_fill(pool, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+size_t sm2_key_pool_count(SM2_KEY_POOL *pool)
+{
+	size_t count;
+
+	pool_mutex_lock(&pool->mutex);
+	count = pool->count;
+	pool_mutex_unlock(&pool->mutex);
+	return count;
+}
+
+int sm2_key_pool_get(SM2_KEY_POOL *pool, SM2_KEY *key)
+{
+	if (!pool || !key) {
+		error_print();
+		return -1;
+	}
+
+	// every key is handed out once and wiped from the pool
+	pool_mutex_lock(&pool->mutex);
+	if (pool->count) {
+		pool->count--;
+		*key = pool->keys[pool->count];
+		gmssl_secure_clear(&pool->keys[pool->count], sizeof(SM2_KEY));
+		pool_cond_signal(&pool->not_full);
+		pool_mutex_unlock(&pool->mutex);
+		return 1;
+	}
+	pool_cond_signal(&pool->not_full);
+	pool_mutex_unlock(&pool->mutex);
+
+	// pool drained, generate a single key on the caller
+	if (sm2_key_generate(key) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
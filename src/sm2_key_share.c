@@ -15,8 +15,6 @@
 #include <gmssl/mem.h>
 #include <gmssl/error.h>
 
-extern SM2_BN SM2_N;
-
 int sm2_key_share_print(FILE *fp, int fmt, int ind, const char *label, const SM2_KEY_SHARE *share)
 {
 	format_print(fp, fmt, ind, "%s\n", label);
@@ -27,22 +25,25 @@ int sm2_key_share_print(FILE *fp, int fmt, int ind, const char *label, const SM2
 }
 
 
-// y = f(x)
-static void eval_univariate_poly(SM2_Fn y, const SM2_Fn *coeffs, size_t coeffs_cnt, uint32_t x)
+// x in Montgomery form
+static void sm2_key_share_x(sm2_z256_t x, size_t index)
 {
-	sm2_bn_set_zero(y);
-	while (coeffs_cnt--) {
-		sm2_fn_mul_word(y, y, x);
-		sm2_fn_add(y, y, coeffs[coeffs_cnt]);
-	}
+	sm2_z256_t t = {0};
+
+	t[0] = (uint64_t)index + 1;
+	sm2_z256_modn_to_mont(t, x);
 }
 
-int sm2_key_split(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt, SM2_KEY_SHARE *shares)
+int sm2_key_split_ex(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt,
+	SM2_KEY_SHARE *shares, SM2_Z256_POINT *commits)
 {
-	SM2_Fn coeffs[SM2_KEY_MAX_SHARES];
-	SM2_Fn y;
-	uint8_t y_bytes[32];
-	size_t i;
+	sm2_z256_t coeffs[SM2_KEY_MAX_SHARES];
+	sm2_z256_t x[SM2_KEY_MAX_SHARES];
+	sm2_z256_t y[SM2_KEY_MAX_SHARES];
+	SM2_Z256_POINT P[SM2_KEY_MAX_SHARES];
+	SM2_Z256_AFFINE_POINT A[SM2_KEY_MAX_SHARES];
+	size_t i, j;
+	int ret = -1;
 
 	if (!key || !shares) {
 		error_print();
@@ -59,36 +60,129 @@ int sm2_key_split(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt, SM2_
 	// try to access mem
 	memset(shares, 0, sizeof(SM2_KEY_SHARE) * total_cnt);
 
-	for (i = 1; i < recover_cnt; i++) {
-		if (sm2_fn_rand(coeffs[i]) != 1) {
-			error_print();
-			return -1;
+	for (i = 0; i < total_cnt; i++) {
+		sm2_key_share_x(x[i], i);
+	}
+
+retry:
+	// coeffs in Montgomery form
+	sm2_z256_modn_to_mont(key->private_key, coeffs[0]);
+	for (j = 1; j < recover_cnt; j++) {
+		do {
+			if (sm2_z256_rand_range(coeffs[j], sm2_z256_order()) != 1) {
+				error_print();
+				goto end;
+			}
+		} while (sm2_z256_is_zero(coeffs[j]));
+		sm2_z256_modn_to_mont(coeffs[j], coeffs[j]);
+	}
+
+	// Horner's rule for all the shares together, every share costs the same
+	for (i = 0; i < total_cnt; i++) {
+		sm2_z256_copy(y[i], coeffs[recover_cnt - 1]);
+	}
+	for (j = recover_cnt - 1; j > 0; j--) {
+		for (i = 0; i < total_cnt; i++) {
+			sm2_z256_modn_mont_mul(y[i], y[i], x[i]);
+			sm2_z256_modn_add(y[i], y[i], coeffs[j - 1]);
+		}
+	}
+	for (i = 0; i < total_cnt; i++) {
+		sm2_z256_modn_from_mont(y[i], y[i]);
+		// a share out of [1, n-2] is not a valid private key
+		if (sm2_z256_is_zero(y[i]) || sm2_z256_cmp(y[i], sm2_z256_order_minus_one()) >= 0) {
+			goto retry;
 		}
 	}
-	sm2_bn_from_bytes(coeffs[0], key->private_key);
 
 	for (i = 0; i < total_cnt; i++) {
-		uint32_t x = (uint32_t)(i + 1);
-		eval_univariate_poly(y, coeffs, recover_cnt, x);
-		sm2_bn_to_bytes(y, y_bytes);
-		sm2_key_set_private_key(&(shares[i].key), y_bytes);
+		sm2_z256_point_mul_generator(&P[i], y[i]);
+	}
+	sm2_z256_points_get_affine_batch(P, total_cnt, A);
+	for (i = 0; i < total_cnt; i++) {
+		sm2_z256_copy(shares[i].key.private_key, y[i]);
+		sm2_z256_set_zero(shares[i].key.fast_private);
+		sm2_z256_point_copy_affine(&shares[i].key.public_key, &A[i]);
 		shares[i].index = i;
 		shares[i].total_cnt = total_cnt;
 	}
 
+	if (commits) {
+		commits[0] = key->public_key;
+		for (j = 1; j < recover_cnt; j++) {
+			sm2_z256_modn_from_mont(y[0], coeffs[j]);
+			sm2_z256_point_mul_generator(&P[j], y[0]);
+		}
+		sm2_z256_points_get_affine_batch(P + 1, recover_cnt - 1, A);
+		for (j = 1; j < recover_cnt; j++) {
+			sm2_z256_point_copy_affine(&commits[j], &A[j - 1]);
+		}
+	}
+	ret = 1;
+
+end:
 	gmssl_secure_clear(coeffs, sizeof(coeffs));
 	gmssl_secure_clear(y, sizeof(y));
-	gmssl_secure_clear(y_bytes, sizeof(y_bytes));
+	gmssl_secure_clear(P, sizeof(P));
+	return ret;
+}
+
+int sm2_key_split(const SM2_KEY *key, size_t recover_cnt, size_t total_cnt, SM2_KEY_SHARE *shares)
+{
+	return sm2_key_split_ex(key, recover_cnt, total_cnt, shares, NULL);
+}
+
+int sm2_key_share_verify(const SM2_KEY_SHARE *share, const SM2_Z256_POINT *commits, size_t recover_cnt)
+{
+	sm2_z256_t k[SM2_KEY_MAX_SHARES];
+	sm2_z256_t x;
+	SM2_Z256_POINT R;
+	size_t j;
+
+	if (!share || !commits || !recover_cnt || recover_cnt > SM2_KEY_MAX_SHARES) {
+		error_print();
+		return -1;
+	}
+	if (share->index >= share->total_cnt || recover_cnt > share->total_cnt) {
+		error_print();
+		return -1;
+	}
+
+	// k[j] = x^j, in Montgomery form first
+	sm2_key_share_x(x, share->index);
+	sm2_z256_modn_to_mont(sm2_z256_one(), k[0]);
+	for (j = 1; j < recover_cnt; j++) {
+		sm2_z256_modn_mont_mul(k[j], k[j - 1], x);
+	}
+	for (j = 0; j < recover_cnt; j++) {
+		sm2_z256_modn_from_mont(k[j], k[j]);
+	}
+
+	if (sm2_z256_point_multi_mul(&R, k, commits, recover_cnt) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_z256_point_equ(&R, &share->key.public_key) != 1) {
+		return 0;
+	}
 	return 1;
 }
 
+/*
+ * d = sum(y[i] * l[i]), l[i] = prod(x[j]/(x[j] - x[i]), j != i), the
+ * denominators are inverted together with a single modular inversion.
+ */
 int sm2_key_recover(SM2_KEY *key, const SM2_KEY_SHARE *shares, size_t shares_cnt)
 {
-	SM2_Fn s;
-	uint8_t s_bytes[32];
-	int x_i;
-	SM2_Fn y_i;
+	sm2_z256_t x[SM2_KEY_MAX_SHARES];
+	sm2_z256_t num[SM2_KEY_MAX_SHARES];
+	sm2_z256_t den[SM2_KEY_MAX_SHARES];
+	sm2_z256_t pre[SM2_KEY_MAX_SHARES];
+	sm2_z256_t acc;
+	sm2_z256_t t;
+	sm2_z256_t s;
 	size_t i, j, k, n;
+	int ret = -1;
 
 	if (!shares || !shares_cnt || !key) {
 		error_print();
@@ -98,7 +192,7 @@ int sm2_key_recover(SM2_KEY *key, const SM2_KEY_SHARE *shares, size_t shares_cnt
 	k = shares_cnt;
 	n = shares[0].total_cnt;
 
-	if (n > SM2_KEY_MAX_SHARES) {
+	if (n > SM2_KEY_MAX_SHARES || k > n) {
 		error_print();
 		return -1;
 	}
@@ -108,62 +202,63 @@ int sm2_key_recover(SM2_KEY *key, const SM2_KEY_SHARE *shares, size_t shares_cnt
 			error_print();
 			return -1;
 		}
+		if (sm2_z256_cmp(shares[i].key.private_key, sm2_z256_order()) >= 0) {
+			error_print();
+			return -1;
+		}
+		sm2_key_share_x(x[i], shares[i].index);
 	}
 
-	sm2_bn_set_zero(s);
-
 	for (i = 0; i < k; i++) {
-		// delta_i
-		SM2_Fn d;
-		int num = 1;
-		int den = 1;
-		int sign = 1;
-
-		x_i = (int)(shares[i].index + 1);
-
+		sm2_z256_modn_to_mont(sm2_z256_one(), num[i]);
+		sm2_z256_copy(den[i], num[i]);
 		for (j = 0; j < k; j++) {
-			if (i != j) {
-				int x_j = (int)(shares[j].index + 1);
-				num *= -x_j;
-				den *= x_i - x_j;
+			if (j != i) {
+				sm2_z256_modn_mont_mul(num[i], num[i], x[j]);
+				sm2_z256_modn_sub(t, x[j], x[i]);
+				sm2_z256_modn_mont_mul(den[i], den[i], t);
 			}
 		}
-		if (num < 0) {
-			num = -num;
-			sign = -sign;
-		}
-		if (den < 0) {
-			den = -den;
-			sign = -sign;
-		}
-
-		// delta_i = Fn( num / den )
-		sm2_bn_set_word(d, den);
-		sm2_fn_inv(d, d);
-		sm2_fn_mul_word(d, d, num);
-		if (sign < 0) {
-			sm2_fn_neg(d, d);
-		}
-
-		// s += delta_i * y_i
-		sm2_bn_from_bytes(y_i, shares[i].key.private_key);
-		if (sm2_bn_cmp(y_i, SM2_N) >= 0) {
-			gmssl_secure_clear(y_i, sizeof(y_i));
-			gmssl_secure_clear(s, sizeof(s));
+		// the same share twice
+		if (sm2_z256_is_zero(den[i])) {
 			error_print();
 			return -1;
 		}
-		sm2_fn_mul(y_i, y_i, d);
-		sm2_fn_add(s, s, y_i);
 	}
 
-	sm2_bn_to_bytes(s, s_bytes);
-	sm2_key_set_private_key(key, s_bytes);
+	// Montgomery's trick, num[i] = num[i]/den[i], pre[i] = den[0] * ... * den[i]
+	sm2_z256_copy(pre[0], den[0]);
+	for (i = 1; i < k; i++) {
+		sm2_z256_modn_mont_mul(pre[i], pre[i - 1], den[i]);
+	}
+	sm2_z256_modn_mont_inv(acc, pre[k - 1]);
+	for (i = k - 1; i > 0; i--) {
+		// acc = 1/pre[i]
+		sm2_z256_modn_mont_mul(t, acc, pre[i - 1]);
+		sm2_z256_modn_mont_mul(num[i], num[i], t);
+		sm2_z256_modn_mont_mul(acc, acc, den[i]);
+	}
+	sm2_z256_modn_mont_mul(num[0], num[0], acc);
+
+	// s = sum(y[i] * num[i])
+	sm2_z256_set_zero(s);
+	for (i = 0; i < k; i++) {
+		sm2_z256_modn_to_mont(shares[i].key.private_key, t);
+		sm2_z256_modn_mont_mul(t, t, num[i]);
+		sm2_z256_modn_add(s, s, t);
+	}
+	sm2_z256_modn_from_mont(s, s);
+
+	if (sm2_key_set_private_key(key, s) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
 
-	gmssl_secure_clear(y_i, sizeof(y_i));
+end:
+	gmssl_secure_clear(t, sizeof(t));
 	gmssl_secure_clear(s, sizeof(s));
-	gmssl_secure_clear(s_bytes, sizeof(s_bytes));
-	return 1;
+	return ret;
 }
 
 int sm2_key_share_encrypt_to_file(const SM2_KEY_SHARE *share, const char *pass, const char *path_prefix)
@@ -177,7 +272,7 @@ int sm2_key_share_encrypt_to_file(const SM2_KEY_SHARE *share, const char *pass,
 		error_print();
 		return -1;
 	}
-	if (!share->total_cnt || share->total_cnt > 12 || share->index >= share->total_cnt) {
+	if (!share->total_cnt || share->total_cnt > SM2_KEY_MAX_SHARES || share->index >= share->total_cnt) {
 		sm2_key_share_print(stderr, 0, 0, "share", share);
 		error_print();
 		return -1;
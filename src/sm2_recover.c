@@ -12,127 +12,456 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/sm2_recover.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 
 
-extern SM2_BN SM2_P;
-extern SM2_BN SM2_B;
-extern SM2_BN SM2_N;
-extern SM2_BN SM2_THREE;
+// r, s in [1, n-1], t = r + s (mod n) != 0, x1 = r - e (mod n), return 0 if invalid
+static int recover_prepare(const uint8_t r_bytes[32], const uint8_t s_bytes[32], const uint8_t dgst[32],
+	sm2_z256_t s, sm2_z256_t t, sm2_z256_t x1)
+{
+	sm2_z256_t r;
+	sm2_z256_t e;
+
+	sm2_z256_from_bytes(r, r_bytes);
+	sm2_z256_from_bytes(s, s_bytes);
+	if (sm2_z256_is_zero(r) || sm2_z256_cmp(r, sm2_z256_order()) >= 0
+		|| sm2_z256_is_zero(s) || sm2_z256_cmp(s, sm2_z256_order()) >= 0) {
+		return 0;
+	}
+	sm2_z256_modn_add(t, r, s);
+	if (sm2_z256_is_zero(t)) {
+		return 0;
+	}
+
+	// e = H(M) (mod n)
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
+	}
+	sm2_z256_modn_sub(x1, r, e);
+	return 1;
+}
+
+// R of the recovery id, return 0 if there is no such point
+static int recover_point_r(SM2_Z256_POINT *R, const sm2_z256_t x1, int recid)
+{
+	sm2_z256_t x;
+	sm2_z256_t p_sub_n;
+	uint8_t x_bytes[32];
+
+	sm2_z256_copy(x, x1);
+	if (recid & 2) {
+		// if x1 in [n, p-1], x1 (mod n) in [0, p-n-1]
+		sm2_z256_sub(p_sub_n, sm2_z256_prime(), sm2_z256_order());
+		if (sm2_z256_cmp(x, p_sub_n) >= 0) {
+			return 0;
+		}
+		sm2_z256_add(x, x, sm2_z256_order());
+	}
+	sm2_z256_to_bytes(x, x_bytes);
+	return sm2_z256_point_from_x_bytes(R, x_bytes, recid & 1) == 1 ? 1 : 0;
+}
+
+// P = u * R + v * G, u = t^-1, v = -u * s
+static void recover_point_p(SM2_Z256_POINT *P, const sm2_z256_t t_inv, const sm2_z256_t s,
+	const SM2_Z256_POINT *R)
+{
+	sm2_z256_t v;
+
+	sm2_z256_modn_mul(v, t_inv, s);
+	sm2_z256_modn_neg(v, v);
+	sm2_z256_point_mul_sum_vartime(P, t_inv, R, v);
+}
 
-// r = H(Z||M) + x1 (mod n)
-// x1 = r - H(Z||M) (mod n) or (r - H(Z||M) (mod n)) + n
-// y1 = sqrt(x1^3 + a*x1 + b)
-// R = (x1, y1) or (x1, -y1)
-// P = (r + s)^-1 * R - (r + s)^-1 * s * G
 int sm2_signature_to_public_key_points(const SM2_SIGNATURE *sig, const uint8_t dgst[32],
-	SM2_POINT points[4], size_t *points_cnt)
-{
-	SM2_BN SM2_P_SUB_N;
-	SM2_JACOBIAN_POINT P;
-	SM2_JACOBIAN_POINT R;
-
-	SM2_Fp r;
-	SM2_Fp s;
-	SM2_Fp e;
-	SM2_Fn u;
-	SM2_Fn v;
-	SM2_Fp x1;
-	SM2_Fp y1;
-
-	// FIXME: check r, s
-	sm2_bn_from_bytes(r, sig->r);
-	sm2_bn_from_bytes(s, sig->s);
-
-	// u = (r + s)^-1, v = -(r + s)^-1 * s
-	sm2_fn_add(u, r, s);
-	sm2_fn_inv(u, u);
-	sm2_fn_mul(v, u, s);
-	sm2_fn_neg(v, v);
-
-	// e = H(Z||M) (mod n)
-	sm2_bn_from_bytes(e, dgst);
-	if (sm2_bn_cmp(e, SM2_N) >= 0) {
-		sm2_bn_sub(e, e, SM2_N);
-	}
-
-	// x1 = r - e (mod n)
-	sm2_fn_sub(x1, r, e);
-
-	// y1 = sqrt(x1^3 + a*x + b) = sqrt((x1^2 + a)*x1 + b)
-	sm2_fp_sqr(y1, x1);
-	sm2_fp_sub(y1, y1, SM2_THREE);
-	sm2_fp_mul(y1, y1, x1);
-	sm2_fp_add(y1, y1, SM2_B);
-
-	if (sm2_fp_sqrt(y1, y1) != 1) {
+	SM2_Z256_POINT points[4], size_t *points_cnt)
+{
+	SM2_Z256_POINT R;
+	sm2_z256_t s;
+	sm2_z256_t t;
+	sm2_z256_t x1;
+	sm2_z256_t p_sub_n;
+	int recid;
+	int ret = 0;
+
+	if (!sig || !dgst || !points || !points_cnt) {
 		error_print();
 		return -1;
 	}
-	sm2_jacobian_point_set_xy(&R, x1, y1);
+	if (recover_prepare(sig->r, sig->s, dgst, s, t, x1) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_modn_inv(t, t);
 
-	// P = u * R + v * G
-	sm2_jacobian_point_mul_sum(&P, u, &R, v);
-	sm2_jacobian_point_to_bytes(&P, (uint8_t *)&points[0]);
+	sm2_z256_sub(p_sub_n, sm2_z256_prime(), sm2_z256_order());
+	*points_cnt = sm2_z256_cmp(x1, p_sub_n) < 0 ? 4 : 2;
 
-	// P' = u * (-R) + v * G
-	sm2_jacobian_point_neg(&R, &R);
-	sm2_jacobian_point_mul_sum(&P, u, &R, v);
-	sm2_jacobian_point_to_bytes(&P, (uint8_t *)&points[1]);
-	*points_cnt = 2;
+	for (recid = 0; recid < (int)*points_cnt; recid++) {
+		if (recid & 1) {
+			// (x1, -y1) if (x1, y1) is a point
+			if (sm2_z256_point_is_at_infinity(&points[recid - 1])) {
+				sm2_z256_point_set_infinity(&points[recid]);
+				continue;
+			}
+			sm2_z256_point_neg(&R, &R);
+		} else if (recover_point_r(&R, x1, recid) != 1) {
+			sm2_z256_point_set_infinity(&points[recid]);
+			continue;
+		}
+		recover_point_p(&points[recid], t, s, &R);
+		if (!sm2_z256_point_is_at_infinity(&points[recid])) {
+			ret = 1;
+		}
+	}
+	return ret;
+}
 
-	// if x1 in [n, p-1], x1 (mod n) in [0, p-n-1]
-	// ==> if x1 (mod n) in [0, p-n-1], x1 == (x1 (mod n) + n) (mod p)
-	sm2_bn_sub(SM2_P_SUB_N, SM2_P, SM2_N);
+// verify the xR of R = s * G + (s + r) * P
+// so (-r, -s) is also a valid SM2 signature
+int sm2_signature_conjugate(const SM2_SIGNATURE *sig, SM2_SIGNATURE *new_sig)
+{
+	sm2_z256_t r;
+	sm2_z256_t s;
 
-	if (sm2_bn_cmp(x1, SM2_P_SUB_N) < 0) {
+	sm2_z256_from_bytes(r, sig->r);
+	sm2_z256_from_bytes(s, sig->s);
+	if (sm2_z256_is_zero(r) || sm2_z256_cmp(r, sm2_z256_order()) >= 0
+		|| sm2_z256_is_zero(s) || sm2_z256_cmp(s, sm2_z256_order()) >= 0) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_modn_neg(r, r);
+	sm2_z256_modn_neg(s, s);
+	sm2_z256_to_bytes(r, new_sig->r);
+	sm2_z256_to_bytes(s, new_sig->s);
 
-		// x1' = x1 (mod n) + n
-		sm2_bn_add(x1, x1, SM2_N);
+	return 1;
+}
 
-		// y1' = sqrt(x1'^3 + a*x' + b)
-		sm2_fp_sqr(y1, x1);
-		sm2_fp_sub(y1, y1, SM2_THREE);
-		sm2_fp_mul(y1, y1, x1);
-		sm2_fp_add(y1, y1, SM2_B);
-		if (sm2_fp_sqrt(y1, y1) != 1) {
+int sm2_sign_compact(const SM2_KEY *key, const uint8_t dgst[32], uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE])
+{
+	SM2_Z256_POINT P;
+	sm2_z256_t d_inv;
+	sm2_z256_t e;
+	sm2_z256_t k;
+	sm2_z256_t x;
+	sm2_z256_t y;
+	sm2_z256_t t;
+	sm2_z256_t r;
+	sm2_z256_t s;
+	int recid;
+
+	if (!key || !dgst || !sig) {
+		error_print();
+		return -1;
+	}
+
+	// compute (d + 1)^-1 (mod n)
+	sm2_z256_modn_add(d_inv, key->private_key, sm2_z256_one());
+	if (sm2_z256_is_zero(d_inv)) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_modn_inv(d_inv, d_inv);
+
+	// e = H(M)
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
+	}
+
+retry:
+	// rand k in [1, n - 1]
+	do {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
 			error_print();
 			return -1;
 		}
-		sm2_jacobian_point_set_xy(&R, x1, y1);
+	} while (sm2_z256_is_zero(k));
+
+	// (x, y) = kG
+	sm2_z256_point_mul_generator(&P, k);
+	sm2_z256_point_get_xy(&P, x, y);
+
+	// r = e + x (mod n)
+	recid = (int)(y[0] & 1);
+	if (sm2_z256_cmp(x, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(x, x, sm2_z256_order());
+		recid |= 2;
+	}
+	sm2_z256_modn_add(r, e, x);
 
-		// P = u * R + v * G
-		sm2_jacobian_point_mul_sum(&P, u, &R, v);
-		sm2_jacobian_point_to_bytes(&P, (uint8_t *)&points[2]);
-		// P' = u * (-R) + v * G
-		sm2_jacobian_point_neg(&R, &R);
-		sm2_jacobian_point_mul_sum(&P, u, &R, v);
-		sm2_jacobian_point_to_bytes(&P, (uint8_t *)&points[3]);
-		*points_cnt = 4;
+	// if r == 0 or r + k == n re-generate k
+	sm2_z256_add(t, r, k);
+	if (sm2_z256_is_zero(r) || sm2_z256_cmp(t, sm2_z256_order()) == 0) {
+		goto retry;
 	}
 
+	// s = ((1 + d)^-1 * (k - r * d)) mod n
+	sm2_z256_modn_mul(t, r, key->private_key);
+	sm2_z256_modn_sub(k, k, t);
+	sm2_z256_modn_mul(s, d_inv, k);
+	if (sm2_z256_is_zero(s)) {
+		goto retry;
+	}
+
+	sm2_z256_to_bytes(r, sig);
+	sm2_z256_to_bytes(s, sig + 32);
+	sig[64] = (uint8_t)recid;
+
+	gmssl_secure_clear(d_inv, sizeof(d_inv));
+	gmssl_secure_clear(k, sizeof(k));
+	gmssl_secure_clear(t, sizeof(t));
 	return 1;
 }
 
-// verify the xR of R = s * G + (s + r) * P
-// so (-r, -s) is also a valid SM2 signature
-int sm2_signature_conjugate(const SM2_SIGNATURE *sig, SM2_SIGNATURE *new_sig)
+// R of the signature, s and t = r + s (mod n), return 0 if invalid
+static int compact_prepare(const uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE], const uint8_t dgst[32],
+	SM2_Z256_POINT *R, sm2_z256_t s, sm2_z256_t t)
 {
-	SM2_Fn r;
-	SM2_Fn s;
+	sm2_z256_t x1;
 
-	// FIXME: check r,s
-	sm2_bn_from_bytes(r, sig->r);
-	sm2_bn_from_bytes(s, sig->s);
-	sm2_fn_neg(r, r);
-	sm2_fn_neg(s, s);
-	sm2_bn_to_bytes(r, new_sig->r);
-	sm2_bn_to_bytes(s, new_sig->s);
+	if (sig[64] > 3) {
+		return 0;
+	}
+	if (recover_prepare(sig, sig + 32, dgst, s, t, x1) != 1
+		|| recover_point_r(R, x1, sig[64]) != 1) {
+		return 0;
+	}
+	return 1;
+}
+
+int sm2_compact_signature_recover(const uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE], const uint8_t dgst[32],
+	SM2_Z256_POINT *public_key)
+{
+	SM2_Z256_POINT R;
+	sm2_z256_t s;
+	sm2_z256_t t;
 
+	if (!sig || !dgst || !public_key) {
+		error_print();
+		return -1;
+	}
+	if (compact_prepare(sig, dgst, &R, s, t) != 1) {
+		return 0;
+	}
+	sm2_z256_modn_inv(t, t);
+	recover_point_p(public_key, t, s, &R);
+	if (sm2_z256_point_is_at_infinity(public_key)) {
+		return 0;
+	}
 	return 1;
 }
 
-// TODO: Add API to support sig,siglen
+int sm2_public_key_fingerprint(const SM2_Z256_POINT *P, uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE])
+{
+	SM3_CTX sm3_ctx;
+	uint8_t octets[65];
 
+	if (!P || !fingerprint) {
+		error_print();
+		return -1;
+	}
+	if (sm2_z256_point_to_uncompressed_octets(P, octets) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, octets, sizeof(octets));
+	sm3_finish(&sm3_ctx, fingerprint);
+	return 1;
+}
+
+// the fingerprints are SM3 digests, any 8 bytes of them are a good hash
+static size_t key_index_hash(const uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE])
+{
+	uint64_t h;
+	memcpy(&h, fingerprint, sizeof(h));
+	return (size_t)h;
+}
+
+int sm2_key_index_init(SM2_KEY_INDEX *index, const uint8_t (*fingerprints)[SM2_KEY_FINGERPRINT_SIZE], size_t cnt)
+{
+	size_t mask, h;
+	size_t i;
+
+	if (!index || (!fingerprints && cnt)) {
+		error_print();
+		return -1;
+	}
+	memset(index, 0, sizeof(*index));
+
+	index->buckets_cnt = 16;
+	while (index->buckets_cnt < cnt) {
+		index->buckets_cnt <<= 1;
+	}
+	if (!(index->entries = (SM2_KEY_INDEX_ENTRY *)calloc(cnt ? cnt : 1, sizeof(SM2_KEY_INDEX_ENTRY)))
+		|| !(index->buckets = (size_t *)calloc(index->buckets_cnt, sizeof(size_t)))) {
+		sm2_key_index_cleanup(index);
+		error_print();
+		return -1;
+	}
+	index->entries_cnt = cnt;
+
+	// pushed to the bucket heads in reverse order, so the first fingerprint wins a tie
+	mask = index->buckets_cnt - 1;
+	for (i = cnt; i > 0; i--) {
+		SM2_KEY_INDEX_ENTRY *e = &index->entries[i - 1];
+
+		memcpy(e->fingerprint, fingerprints[i - 1], SM2_KEY_FINGERPRINT_SIZE);
+		h = key_index_hash(e->fingerprint) & mask;
+		e->next = index->buckets[h];
+		index->buckets[h] = i;
+	}
+	return 1;
+}
+
+void sm2_key_index_cleanup(SM2_KEY_INDEX *index)
+{
+	if (index) {
+		free(index->entries);
+		free(index->buckets);
+		memset(index, 0, sizeof(*index));
+	}
+}
+
+int sm2_key_index_find(const SM2_KEY_INDEX *index, const uint8_t fingerprint[SM2_KEY_FINGERPRINT_SIZE],
+	size_t *key_id)
+{
+	size_t i;
+
+	if (!index || !fingerprint || !key_id) {
+		error_print();
+		return -1;
+	}
+	if (!index->buckets_cnt) {
+		return 0;
+	}
+	for (i = index->buckets[key_index_hash(fingerprint) & (index->buckets_cnt - 1)]; i;
+		i = index->entries[i - 1].next) {
+		if (memcmp(index->entries[i - 1].fingerprint, fingerprint, SM2_KEY_FINGERPRINT_SIZE) == 0) {
+			*key_id = i - 1;
+			return 1;
+		}
+	}
+	return 0;
+}
+
+// fingerprints of n points with one inversion and a multi-buffer SM3, skipped[i] for points at infinity
+static void recover_fingerprints(const SM2_Z256_POINT *P, size_t n,
+	uint8_t (*fingerprints)[SM2_KEY_FINGERPRINT_SIZE], int *skipped)
+{
+	SM2_Z256_AFFINE_POINT A[SM2_RECOVER_BATCH_SIZE];
+	SM2_Z256_POINT Q;
+	uint8_t octets[SM2_RECOVER_BATCH_SIZE][65];
+	const uint8_t *datas[SM2_RECOVER_BATCH_SIZE];
+	size_t datalens[SM2_RECOVER_BATCH_SIZE];
+	size_t i;
+
+	sm2_z256_points_get_affine_batch_vartime(P, n, A);
+	for (i = 0; i < n; i++) {
+		// Z = 1, the encoding does not invert again
+		sm2_z256_point_copy_affine(&Q, &A[i]);
+		skipped[i] = sm2_z256_point_is_at_infinity(&P[i])
+			|| sm2_z256_point_to_uncompressed_octets(&Q, octets[i]) != 1;
+		datas[i] = octets[i];
+		datalens[i] = skipped[i] ? 0 : sizeof(octets[i]);
+	}
+	sm3_digest_batch(datas, datalens, n, fingerprints);
+}
+
+int sm2_verify_recover(const SM2_KEY_INDEX *index, const uint8_t dgst[32], const SM2_SIGNATURE *sig,
+	size_t *key_id)
+{
+	SM2_Z256_POINT points[4];
+	uint8_t fingerprints[4][SM2_KEY_FINGERPRINT_SIZE];
+	int skipped[4];
+	size_t points_cnt;
+	size_t i;
+	int ret;
+
+	if (!index || !dgst || !sig || !key_id) {
+		error_print();
+		return -1;
+	}
+	if ((ret = sm2_signature_to_public_key_points(sig, dgst, points, &points_cnt)) != 1) {
+		return ret < 0 ? 0 : ret;
+	}
+	recover_fingerprints(points, points_cnt, fingerprints, skipped);
+	for (i = 0; i < points_cnt; i++) {
+		if (!skipped[i] && sm2_key_index_find(index, fingerprints[i], key_id) == 1) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int sm2_verify_compact(const SM2_KEY_INDEX *index, const uint8_t dgst[32],
+	const uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE], size_t *key_id)
+{
+	int result;
 
+	if (!key_id) {
+		error_print();
+		return -1;
+	}
+	return sm2_verify_compact_batch(index, (const uint8_t (*)[32])dgst,
+		(const uint8_t (*)[SM2_COMPACT_SIGNATURE_SIZE])sig, 1, key_id, &result);
+}
+
+int sm2_verify_compact_batch(const SM2_KEY_INDEX *index, const uint8_t (*dgsts)[32],
+	const uint8_t (*sigs)[SM2_COMPACT_SIGNATURE_SIZE], size_t count, size_t *key_ids, int *results)
+{
+	SM2_Z256_POINT R[SM2_RECOVER_BATCH_SIZE];
+	SM2_Z256_POINT P[SM2_RECOVER_BATCH_SIZE];
+	sm2_z256_t s[SM2_RECOVER_BATCH_SIZE];
+	sm2_z256_t t[SM2_RECOVER_BATCH_SIZE];
+	sm2_z256_t t_inv[SM2_RECOVER_BATCH_SIZE];
+	int valid[SM2_RECOVER_BATCH_SIZE];
+	int skipped[SM2_RECOVER_BATCH_SIZE];
+	uint8_t fingerprints[SM2_RECOVER_BATCH_SIZE][SM2_KEY_FINGERPRINT_SIZE];
+	size_t first, n, i;
+	int ret = 1;
+
+	if (!index || !dgsts || !sigs || !key_ids) {
+		error_print();
+		return -1;
+	}
+
+	for (first = 0; first < count; first += n) {
+		n = count - first < SM2_RECOVER_BATCH_SIZE ? count - first : SM2_RECOVER_BATCH_SIZE;
 
+		for (i = 0; i < n; i++) {
+			valid[i] = compact_prepare(sigs[first + i], dgsts[first + i], &R[i], s[i], t[i]);
+			if (!valid[i]) {
+				// keeps the shared inversion defined
+				sm2_z256_copy(t[i], sm2_z256_one());
+			}
+		}
+		sm2_z256_modn_inv_batch(t_inv, (const sm2_z256_t *)t, n);
+
+		for (i = 0; i < n; i++) {
+			if (valid[i]) {
+				recover_point_p(&P[i], t_inv[i], s[i], &R[i]);
+			} else {
+				sm2_z256_point_set_infinity(&P[i]);
+			}
+		}
+		recover_fingerprints(P, n, fingerprints, skipped);
+
+		for (i = 0; i < n; i++) {
+			int ok = !skipped[i] && sm2_key_index_find(index, fingerprints[i], &key_ids[first + i]) == 1;
+			if (results) {
+				results[first + i] = ok ? 1 : -1;
+			}
+			if (!ok) {
+				ret = 0;
+			}
+		}
+	}
+	return ret;
+}
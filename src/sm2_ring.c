@@ -11,21 +11,19 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
+#include <stdint.h>
+#include <gmssl/mem.h>
 #include <gmssl/sm2_ring.h>
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
 
 
-extern SM2_BN SM2_N;
-extern SM2_BN SM2_ONE;
-
-
 static int compare_point(const void *P, const void *Q)
 {
 	const uint8_t *p = (uint8_t *)P;
 	const uint8_t *q = (uint8_t *)Q;
 	int i, r;
-	for (i = 0; i < sizeof(SM2_POINT); i++) {
+	for (i = 0; i < sizeof(SM2_Z256_POINT); i++) {
 		r = p[i] - q[i];
 		if (r) {
 			return r;
@@ -34,16 +32,15 @@ static int compare_point(const void *P, const void *Q)
 	return 0;
 }
 
-static int sm2_ring_sort_public_keys(SM2_POINT *points, size_t points_cnt)
+static int sm2_ring_sort_public_keys(SM2_Z256_POINT *points, size_t points_cnt)
 {
-	qsort(points, points_cnt, sizeof(SM2_POINT), compare_point);
+	qsort(points, points_cnt, sizeof(SM2_Z256_POINT), compare_point);
 	return 1;
 }
 
 int sm2_ring_signature_to_der(const sm2_bn_t r, const sm2_bn_t *s, size_t s_cnt, uint8_t **out, size_t *outlen)
 {
 	size_t i, len = 0;
-	uint8_t *p = *out;
 
 	if (asn1_integer_to_der(r, 32, NULL, &len) != 1) {
 		error_print();
@@ -107,32 +104,79 @@ int sm2_ring_signature_from_der(sm2_bn_t r0, sm2_bn_t *s_vec, size_t *s_cnt, con
 	return 1;
 }
 
-int sm2_ring_do_sign(const SM2_KEY *sign_key,
-	const SM2_POINT *public_keys, size_t public_keys_cnt,
+// R = (s + r) * P + s * G, with the comb table of P if there is one
+static void sm2_ring_step(SM2_Z256_POINT *R, const SM2_Z256_POINT *P, const SM2_Z256_AFFINE_POINT *P_table,
+	const sm2_z256_t r, const sm2_z256_t s)
+{
+	SM2_Z256_POINT T;
+	sm2_z256_t t;
+
+	sm2_z256_modn_add(t, s, r);
+	if (P_table) {
+		sm2_z256_point_mul_generator(R, s);
+		sm2_z256_point_mul_comb_w(&T, t, P_table, SM2_RING_TABLE_WINDOW);
+		sm2_z256_point_add(R, R, &T);
+	} else {
+		sm2_z256_point_mul_sum(R, t, P, s);
+	}
+}
+
+// r = x(R) + e (mod n), e < n
+static int sm2_ring_next_r(sm2_z256_t r, const SM2_Z256_POINT *R, const sm2_z256_t e)
+{
+	sm2_z256_t x;
+
+	if (sm2_z256_point_get_xy(R, x, NULL) != 1) {
+		return 0;
+	}
+	if (sm2_z256_cmp(x, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(x, x, sm2_z256_order());
+	}
+	sm2_z256_modn_add(r, x, e);
+	return 1;
+}
+
+static int sm2_ring_rand(sm2_z256_t k)
+{
+	do {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(k));
+	return 1;
+}
+
+static int sm2_ring_sign_tables(const SM2_KEY *sign_key,
+	const SM2_Z256_POINT *public_keys, const SM2_Z256_AFFINE_POINT *point_tables, size_t public_keys_cnt,
 	const uint8_t dgst[32], uint8_t r0[32], sm2_bn_t *s_vec)
 {
+	size_t table_size = SM2_Z256_COMB_POINTS(SM2_RING_TABLE_WINDOW);
 	size_t i;
 	size_t sign_index = public_keys_cnt; // assign an invalid value
 
-	SM2_JACOBIAN_POINT R;
-	SM2_JACOBIAN_POINT P;
-	SM2_Fn e;
-	SM2_Fn k;
-	SM2_Fp x;
-	SM2_Fn r;
-	SM2_Fn s;
-	SM2_Fn t;
-	SM2_Fn d;
+	SM2_Z256_POINT R;
+	sm2_z256_t e;
+	sm2_z256_t k;
+	sm2_z256_t r;
+	sm2_z256_t s;
+	sm2_z256_t d;
+	int ret = -1;
+
+	if (!sign_key || !public_keys || !public_keys_cnt || !dgst || !r0 || !s_vec) {
+		error_print();
+		return -1;
+	}
 
 	// e = H(M) (mod n)
-	sm2_bn_from_bytes(e, dgst);
-	if (sm2_bn_cmp(e, SM2_N) >= 0) {
-		sm2_bn_sub(e, e, SM2_N);
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
 	}
 
 	// find signer's index
 	for (i = 0; i < public_keys_cnt; i++) {
-		if (memcmp(&public_keys[i], &(sign_key->public_key), sizeof(SM2_POINT)) == 0) {
+		if (sm2_z256_point_equ(&public_keys[i], &sign_key->public_key) == 1) {
 			sign_index = i;
 			break;
 		}
@@ -143,98 +187,199 @@ int sm2_ring_do_sign(const SM2_KEY *sign_key,
 	}
 
 	// k[i] = rand(1, n-1), r[i], s[i] will be computed at the last step
-	sm2_fn_rand(k);
+	if (sm2_ring_rand(k) != 1) {
+		error_print();
+		return -1;
+	}
 
 	// R[i+1] = k[i] * G
-	sm2_jacobian_point_mul_generator(&R, k);
-	sm2_jacobian_point_get_xy(&R, x, NULL);
+	sm2_z256_point_mul_generator(&R, k);
 
 	// i = i + 1 (mod N)
 	for (i = (i + 1) % public_keys_cnt; i != sign_index; i = (i + 1) % public_keys_cnt) {
 
 		// r[i] = x[i] + e (mod n)
-		sm2_fn_add(r, x, e);
+		if (sm2_ring_next_r(r, &R, e) != 1) {
+			error_print();
+			goto end;
+		}
 
 		// output r[0]
 		if (i == 0) {
-			sm2_bn_to_bytes(r, r0);
+			sm2_z256_to_bytes(r, r0);
 		}
 
 		// s[i] = rand(1, n-1)
-		sm2_fn_rand(s);
-		sm2_bn_to_bytes(s, s_vec[i]);
+		if (sm2_ring_rand(s) != 1) {
+			error_print();
+			goto end;
+		}
+		sm2_z256_to_bytes(s, s_vec[i]);
 
 		// R[i+1] = k[i] * G = (s[i] + r[i]) * P[i] + s[i] * G
-		sm2_fn_add(t, s, r);
-		sm2_jacobian_point_from_bytes(&P, (const uint8_t *)&public_keys[i]);
-		sm2_jacobian_point_mul_sum(&R, t, &P, s);
-		sm2_jacobian_point_get_xy(&R, x, NULL);
+		sm2_ring_step(&R, &public_keys[i], point_tables ? point_tables + table_size * i : NULL, r, s);
 	}
 
 	// r[i] = x[i] + e (mod n)
-	sm2_fn_add(r, x, e);
+	if (sm2_ring_next_r(r, &R, e) != 1) {
+		error_print();
+		goto end;
+	}
 	if (i == 0) {
-		sm2_bn_to_bytes(r, r0);
+		sm2_z256_to_bytes(r, r0);
 	}
 
 	// s[i] = (k[i] - r[i] * d)/(1 + d)
-	sm2_bn_from_bytes(d, sign_key->private_key);
-	sm2_fn_mul(r, r, d);
-	sm2_fn_sub(s, k, r);
-	sm2_fn_add(d, d, SM2_ONE);
-	sm2_fn_inv(d, d);
-	sm2_fn_mul(s, s, d);
-	sm2_bn_to_bytes(s, s_vec[i]);
-
-	// cleanup
-	memset(d, 0, sizeof(d));
-	memset(k, 0, sizeof(k));
-	memset(r, 0, sizeof(r));
-	return 1;
+	sm2_z256_modn_mul(r, r, sign_key->private_key);
+	sm2_z256_modn_sub(s, k, r);
+	sm2_z256_modn_add(d, sign_key->private_key, sm2_z256_one());
+	sm2_z256_modn_inv(d, d);
+	sm2_z256_modn_mul(s, s, d);
+	sm2_z256_to_bytes(s, s_vec[i]);
+	ret = 1;
+
+end:
+	gmssl_secure_clear(d, sizeof(d));
+	gmssl_secure_clear(k, sizeof(k));
+	gmssl_secure_clear(r, sizeof(r));
+	gmssl_secure_clear(s, sizeof(s));
+	return ret;
 }
 
-int sm2_ring_do_verify(const SM2_POINT *public_keys, size_t public_keys_cnt,
+static int sm2_ring_verify_tables(
+	const SM2_Z256_POINT *public_keys, const SM2_Z256_AFFINE_POINT *point_tables, size_t public_keys_cnt,
 	const uint8_t dgst[32], const uint8_t r0[32], const sm2_bn_t *s_vec)
 {
-	SM2_JACOBIAN_POINT P;
-	SM2_JACOBIAN_POINT R;
-	SM2_Fn r;
-	SM2_Fn r_;
-	SM2_Fn s;
-	SM2_Fn e;
-	SM2_Fn t;
-	SM2_Fn x;
+	size_t table_size = SM2_Z256_COMB_POINTS(SM2_RING_TABLE_WINDOW);
+	SM2_Z256_POINT R;
+	sm2_z256_t r;
+	sm2_z256_t r_;
+	sm2_z256_t s;
+	sm2_z256_t e;
 	size_t i;
 
-	sm2_bn_from_bytes(e, dgst);
-	if (sm2_bn_cmp(e, SM2_N) >= 0) {
-		sm2_bn_sub(e, e, SM2_N);
+	if (!public_keys || !public_keys_cnt || !dgst || !r0 || !s_vec) {
+		error_print();
+		return -1;
+	}
+
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
 	}
 
-	sm2_bn_from_bytes(r, r0);
+	sm2_z256_from_bytes(r, r0);
+	if (sm2_z256_cmp(r, sm2_z256_order()) >= 0) {
+		error_print();
+		return -1;
+	}
 
 	for (i = 0; i < public_keys_cnt; i++) {
-		sm2_bn_from_bytes(s, s_vec[i]);
+		sm2_z256_from_bytes(s, s_vec[i]);
+		if (sm2_z256_cmp(s, sm2_z256_order()) >= 0) {
+			error_print();
+			return -1;
+		}
 
 		// R(x, y) = k * G = s * G + (s + r) * P
-		sm2_fn_add(t, s, r);
-		sm2_jacobian_point_from_bytes(&P, (const uint8_t *)&public_keys[i]);
-		sm2_jacobian_point_mul_sum(&R, t, &P, s);
-		sm2_jacobian_point_get_xy(&R, x, NULL);
+		sm2_ring_step(&R, &public_keys[i], point_tables ? point_tables + table_size * i : NULL, r, s);
 
 		// r = e + x (mod n)
-		sm2_fn_add(r, x, e);
+		if (sm2_ring_next_r(r, &R, e) != 1) {
+			return 0;
+		}
 	}
 
-	sm2_bn_from_bytes(r_, r0);
-	if (sm2_bn_cmp(r_, r) != 0) {
+	sm2_z256_from_bytes(r_, r0);
+	if (sm2_z256_cmp(r_, r) != 0) {
 		return 0;
 	}
 	return 1;
 }
 
+int sm2_ring_do_sign(const SM2_KEY *sign_key,
+	const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
+	const uint8_t dgst[32], uint8_t r0[32], sm2_bn_t *s_vec)
+{
+	return sm2_ring_sign_tables(sign_key, public_keys, NULL, public_keys_cnt, dgst, r0, s_vec);
+}
+
+int sm2_ring_do_verify(const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
+	const uint8_t dgst[32], const uint8_t r0[32], const sm2_bn_t *s_vec)
+{
+	return sm2_ring_verify_tables(public_keys, NULL, public_keys_cnt, dgst, r0, s_vec);
+}
+
+int sm2_ring_init(SM2_RING *ring, const SM2_Z256_POINT *public_keys, size_t public_keys_cnt)
+{
+	size_t table_size = SM2_Z256_COMB_POINTS(SM2_RING_TABLE_WINDOW);
+	size_t i;
+
+	if (!ring || !public_keys || !public_keys_cnt) {
+		error_print();
+		return -1;
+	}
+	memset(ring, 0, sizeof(*ring));
+
+	if (public_keys_cnt > SIZE_MAX / (sizeof(SM2_Z256_AFFINE_POINT) * table_size)
+		|| !(ring->public_keys = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * public_keys_cnt))
+		|| !(ring->point_tables = (SM2_Z256_AFFINE_POINT *)malloc(sizeof(SM2_Z256_AFFINE_POINT) * table_size * public_keys_cnt))) {
+		sm2_ring_cleanup(ring);
+		error_print();
+		return -1;
+	}
+	memcpy(ring->public_keys, public_keys, sizeof(SM2_Z256_POINT) * public_keys_cnt);
+	ring->public_keys_cnt = public_keys_cnt;
+
+	for (i = 0; i < public_keys_cnt; i++) {
+		if (sm2_z256_point_is_at_infinity(&public_keys[i])) {
+			sm2_ring_cleanup(ring);
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_comb_w_pre_compute(&public_keys[i], SM2_RING_TABLE_WINDOW,
+			ring->point_tables + table_size * i);
+	}
+	return 1;
+}
+
+int sm2_ring_do_sign_ex(const SM2_KEY *sign_key, const SM2_RING *ring,
+	const uint8_t dgst[32], uint8_t r0[32], sm2_bn_t *s_vec)
+{
+	if (!ring) {
+		error_print();
+		return -1;
+	}
+	return sm2_ring_sign_tables(sign_key, ring->public_keys, ring->point_tables, ring->public_keys_cnt,
+		dgst, r0, s_vec);
+}
+
+int sm2_ring_do_verify_ex(const SM2_RING *ring,
+	const uint8_t dgst[32], const uint8_t r0[32], const sm2_bn_t *s_vec)
+{
+	if (!ring) {
+		error_print();
+		return -1;
+	}
+	return sm2_ring_verify_tables(ring->public_keys, ring->point_tables, ring->public_keys_cnt,
+		dgst, r0, s_vec);
+}
+
+void sm2_ring_cleanup(SM2_RING *ring)
+{
+	if (ring) {
+		if (ring->public_keys) {
+			free(ring->public_keys);
+		}
+		if (ring->point_tables) {
+			free(ring->point_tables);
+		}
+		memset(ring, 0, sizeof(*ring));
+	}
+}
+
 int sm2_ring_sign(const SM2_KEY *sign_key,
-	const SM2_POINT *public_keys, size_t public_keys_cnt,
+	const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], uint8_t *sig, size_t *siglen)
 {
 	sm2_bn_t r;
@@ -257,7 +402,7 @@ int sm2_ring_sign(const SM2_KEY *sign_key,
 	return 1;
 }
 
-int sm2_ring_verify(const SM2_POINT *public_keys, size_t public_keys_cnt,
+int sm2_ring_verify(const SM2_Z256_POINT *public_keys, size_t public_keys_cnt,
 	const uint8_t dgst[32], const uint8_t *sig, size_t siglen)
 {
 	int ret;
@@ -320,12 +465,12 @@ int sm2_ring_sign_add_signer(SM2_RING_SIGN_CTX *ctx, const SM2_KEY *public_key)
 int sm2_ring_sign_update(SM2_RING_SIGN_CTX *ctx, const uint8_t *data, size_t datalen)
 {
 	if (!ctx->state) {
-		SM2_POINT point = ctx->public_keys[0];
+		SM2_Z256_POINT point = ctx->public_keys[0];
 		uint8_t z[32];
 		size_t i;
 
 		for (i = 1; i < ctx->public_keys_count; i++) {
-			sm2_point_add(&point, &point, &ctx->public_keys[i]);
+			sm2_z256_point_add(&point, &point, &ctx->public_keys[i]);
 		}
 		sm2_compute_z(z, &point, ctx->id, ctx->idlen);
 		sm3_update(&ctx->sm3_ctx, z, sizeof(z));
@@ -386,12 +531,12 @@ int sm2_ring_verify_add_signer(SM2_RING_SIGN_CTX *ctx, const SM2_KEY *public_key
 int sm2_ring_verify_update(SM2_RING_SIGN_CTX *ctx, const uint8_t *data, size_t datalen)
 {
 	if (!ctx->state) {
-		SM2_POINT point = ctx->public_keys[0];
+		SM2_Z256_POINT point = ctx->public_keys[0];
 		uint8_t z[32];
 		size_t i;
 
 		for (i = 1; i < ctx->public_keys_count; i++) {
-			sm2_point_add(&point, &point, &ctx->public_keys[i]);
+			sm2_z256_point_add(&point, &point, &ctx->public_keys[i]);
 		}
 		sm2_compute_z(z, &point, ctx->id, ctx->idlen);
 		sm3_update(&ctx->sm3_ctx, z, sizeof(z));
@@ -424,7 +569,7 @@ int sm2_ring_verify_finish(SM2_RING_SIGN_CTX *ctx, uint8_t *sig, size_t siglen)
 static int test_sm2_ring_do_sign(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_keys[5];
+	SM2_Z256_POINT public_keys[5];
 	size_t public_keys_count = sizeof(public_keys)/sizeof(public_keys[0]);
 	size_t sign_index, i;
 	uint8_t dgst[32];
@@ -436,7 +581,7 @@ static int test_sm2_ring_do_sign(void)
 		for (i = 0; i < public_keys_count; i++) {
 			SM2_KEY key;
 			sm2_key_generate(&key);
-			memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_POINT));
+			memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_Z256_POINT));
 
 			if (i == sign_index) {
 				memcpy(&sign_key, &key, sizeof(SM2_KEY));
@@ -459,7 +604,7 @@ static int test_sm2_ring_do_sign(void)
 int test_sm2_ring_sign(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_keys[5];
+	SM2_Z256_POINT public_keys[5];
 	size_t public_keys_count = sizeof(public_keys)/sizeof(public_keys[0]);
 	size_t sign_index = 2, i;
 	uint8_t dgst[32];
@@ -469,7 +614,7 @@ int test_sm2_ring_sign(void)
 	for (i = 0; i < public_keys_count; i++) {
 		SM2_KEY key;
 		sm2_key_generate(&key);
-		memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_POINT));
+		memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_Z256_POINT));
 
 		if (i == sign_index) {
 			memcpy(&sign_key, &key, sizeof(SM2_KEY));
@@ -491,7 +636,7 @@ int test_sm2_ring_sign(void)
 int test_sm2_ring_sign_crosscheck(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_key;
+	SM2_Z256_POINT public_key;
 	uint8_t dgst[32];
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen = 0;
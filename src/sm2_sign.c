@@ -16,10 +16,15 @@
 #include <gmssl/sm3.h>
 #include <gmssl/asn1.h>
 #include <gmssl/error.h>
+#include <gmssl/metrics.h>
 #include <gmssl/endian.h>
+#ifdef ENABLE_SM2_IFMA
+#include <gmssl/cpu.h>
+#include <gmssl/sm2_z256_x8_ifma.h>
+#endif
 
 
-int sm2_do_sign(const SM2_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig)
+static int sm2_do_sign_internal(const SM2_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig)
 {
 	SM2_Z256_POINT P;
 	sm2_z256_t d_inv;
@@ -30,13 +35,38 @@ int sm2_do_sign(const SM2_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig)
 	sm2_z256_t r;
 	sm2_z256_t s;
 
-	// compute (d + 1)^-1 (mod n)
-	sm2_z256_modn_add(d_inv, key->private_key, sm2_z256_one());
-	if (sm2_z256_is_zero(d_inv)) {
+	// (d + 1)^-1 (mod n), cached in the key
+	if (sm2_fast_sign_compute_key(key, d_inv) != 1) {
 		error_print();
 		return -1;
 	}
-	sm2_z256_modn_inv(d_inv, d_inv);
+
+#ifdef ENABLE_SM2_SIGN_POOL
+	{
+		SM2_SIGN_POOL *pool;
+		SM2_SIGN_PRE_COMP pre_comp;
+		int ret;
+
+		if ((pool = sm2_sign_pool_get_default()) != NULL) {
+			// take another (k, x1) if r == 0, r + k == n or s == 0
+			do {
+				if (sm2_sign_pool_get(pool, &pre_comp) != 1) {
+					gmssl_secure_clear(d_inv, sizeof(d_inv));
+					error_print();
+					return -1;
+				}
+				ret = sm2_fast_sign(d_inv, &pre_comp, dgst, sig);
+				gmssl_secure_clear(&pre_comp, sizeof(pre_comp));
+			} while (ret == 0);
+			gmssl_secure_clear(d_inv, sizeof(d_inv));
+			if (ret != 1) {
+				error_print();
+				return -1;
+			}
+			return 1;
+		}
+	}
+#endif
 
 	// e = H(M)
 	sm2_z256_from_bytes(e, dgst);
@@ -89,15 +119,33 @@ retry:
 	return 1;
 }
 
-// d' = (d + 1)^-1 (mod n)
+int sm2_do_sign(const SM2_KEY *key, const uint8_t dgst[32], SM2_SIGNATURE *sig)
+{
+	uint64_t begin = METRICS_NSEC();
+	int ret = sm2_do_sign_internal(key, dgst, sig);
+	METRICS_LATENCY(METRICS_sm2_signs, begin);
+	return ret;
+}
+
+// d' = (d + 1)^-1 (mod n), one multiplication checks the cached d' against d
 int sm2_fast_sign_compute_key(const SM2_KEY *key, sm2_z256_t fast_private)
 {
+	sm2_z256_t d_plus_one;
+	sm2_z256_t t;
+
 	if (sm2_z256_cmp(key->private_key, sm2_z256_order_minus_one()) >= 0) {
 		error_print();
 		return -1;
 	}
-	sm2_z256_modn_add(fast_private, key->private_key, sm2_z256_one());
-	sm2_z256_modn_inv(fast_private, fast_private);
+	sm2_z256_modn_add(d_plus_one, key->private_key, sm2_z256_one());
+	sm2_z256_modn_mul(t, key->fast_private, d_plus_one);
+	if (sm2_z256_equ(t, sm2_z256_one())) {
+		sm2_z256_copy(fast_private, key->fast_private);
+	} else {
+		sm2_z256_modn_inv(fast_private, d_plus_one);
+	}
+	gmssl_secure_clear(d_plus_one, sizeof(d_plus_one));
+	gmssl_secure_clear(t, sizeof(t));
 	return 1;
 }
 
@@ -105,8 +153,7 @@ int sm2_fast_sign_compute_key(const SM2_KEY *key, sm2_z256_t fast_private)
 int sm2_fast_sign_pre_compute(SM2_SIGN_PRE_COMP pre_comp[32])
 {
 	SM2_Z256_POINT P[32];
-	sm2_z256_t f[32];
-	sm2_z256_t g[32];
+	SM2_Z256_AFFINE_POINT A[32];
 	int i;
 
 	for (i = 0; i < 32; i++) {
@@ -123,50 +170,17 @@ int sm2_fast_sign_pre_compute(SM2_SIGN_PRE_COMP pre_comp[32])
 		sm2_z256_point_mul_generator(&P[i], pre_comp[i].k);
 	}
 
-	// f[0] = Z[0]
-	// f[1] = Z[0] * Z[1]
-	// ...
-	// f[31] = Z[0] * Z[1] * ... * Z[31]
-	sm2_z256_copy(f[0], P[0].Z);
-	for (i = 1; i < 32; i++) {
-		sm2_z256_modp_mont_mul(f[i], f[i - 1], P[i].Z);
-	}
-
-	// f[31]^-1 = (Z[0] * ... * Z[31])^-1
-	sm2_z256_modp_mont_inv(f[31], f[31]);
-
-	// g[31] = Z[31]
-	// g[30] = Z[30] * Z[31]
-	// ...
-	// g[1] = Z[1] * Z[2] * ... * Z[31]
-	//
-	sm2_z256_copy(g[31], P[31].Z);
-	for (i = 30; i >= 1; i--) {
-		sm2_z256_modp_mont_mul(g[i], g[i + 1], P[i].Z);
-	}
-
-	// Z[0]^-1 = g[1] * f[31]^-1
-	// Z[1]^-1 = g[2] * f[0] * f[31]^-1
-	// Z[2]^-1 = g[3] * f[1] * f[31]^-1
-	// ...
-	// Z[30]^-1 = g[31] * f[29] * f[31]^-1
-	// Z[31]^-1 = f[30] * f[31]^-1
-	sm2_z256_modp_mont_mul(P[0].Z, g[1], f[31]);
-	for (i = 1; i <= 30; i++) {
-		sm2_z256_modp_mont_mul(P[i].Z, g[i + 1], f[i - 1]);
-		sm2_z256_modp_mont_mul(P[i].Z, P[i].Z, f[31]);
-	}
-	sm2_z256_modp_mont_mul(P[31].Z, f[30], f[31]);
+	// x1 of all the points with one inversion
+	sm2_z256_points_get_affine_batch(P, 32, A);
 
-	// x[i] = X[i] * Z[i]^-2 (mod n)
 	for (i = 0; i < 32; i++) {
-		sm2_z256_modp_mont_sqr(P[i].Z, P[i].Z);
-		sm2_z256_modp_mont_mul(pre_comp[i].x1_modn, P[i].X, P[i].Z);
-		sm2_z256_modp_from_mont(pre_comp[i].x1_modn, pre_comp[i].x1_modn);
+		sm2_z256_modp_from_mont(pre_comp[i].x1_modn, A[i].x);
 		if (sm2_z256_cmp(pre_comp[i].x1_modn, sm2_z256_order()) >= 0) {
 			sm2_z256_sub(pre_comp[i].x1_modn, pre_comp[i].x1_modn, sm2_z256_order());
 		}
 	}
+	gmssl_secure_clear(P, sizeof(P));
+	gmssl_secure_clear(A, sizeof(A));
 
 	return 1;
 }
@@ -181,6 +195,7 @@ int sm2_fast_sign(const sm2_z256_t fast_private, SM2_SIGN_PRE_COMP *pre_comp,
 	sm2_z256_t e;
 	sm2_z256_t r;
 	sm2_z256_t s;
+	uint64_t begin = METRICS_NSEC();
 
 	// e = H(M)
 	sm2_z256_from_bytes(e, dgst);
@@ -191,18 +206,33 @@ int sm2_fast_sign(const sm2_z256_t fast_private, SM2_SIGN_PRE_COMP *pre_comp,
 	// r = e + x1 (mod n)
 	sm2_z256_modn_add(r, e, pre_comp->x1_modn);
 
+	// r == 0 or r + k == n, the caller has to use another pre_comp
+	sm2_z256_add(s, r, pre_comp->k);
+	if (sm2_z256_is_zero(r) || sm2_z256_cmp(s, sm2_z256_order()) == 0) {
+		return 0;
+	}
+
 	// s = (k + r) * d' - r
 	sm2_z256_modn_add(s, pre_comp->k, r);
 	sm2_z256_modn_mul(s, s, fast_private);
 	sm2_z256_modn_sub(s, s, r);
 
+	// check s != 0
+	if (sm2_z256_is_zero(s)) {
+		return 0;
+	}
+
 	sm2_z256_to_bytes(r, sig->r);
 	sm2_z256_to_bytes(s, sig->s);
 
+	METRICS_LATENCY(METRICS_sm2_signs, begin);
 	return 1;
 }
 
-int sm2_fast_verify(const SM2_Z256_POINT point_table[16], const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+// R = s * G + t * P, with t * P from a 16-point window table or a comb table
+static int sm2_do_verify_table(const SM2_Z256_POINT point_table[16],
+	const SM2_Z256_AFFINE_POINT comb_table[37][64],
+	const uint8_t dgst[32], const SM2_SIGNATURE *sig)
 {
 	SM2_Z256_POINT R;
 	SM2_Z256_POINT T;
@@ -241,7 +271,11 @@ int sm2_fast_verify(const SM2_Z256_POINT point_table[16], const uint8_t dgst[32]
 
 	// Q(x,y) = s * G + t * P
 	sm2_z256_point_mul_generator(&R, s);
-	sm2_z256_point_mul_ex(&T, t, point_table);
+	if (comb_table) {
+		sm2_z256_point_mul_comb(&T, t, comb_table);
+	} else {
+		sm2_z256_point_mul_ex(&T, t, point_table);
+	}
 	sm2_z256_point_add(&R, &R, &T);
 	sm2_z256_point_get_xy(&R, x, NULL);
 
@@ -265,10 +299,149 @@ int sm2_fast_verify(const SM2_Z256_POINT point_table[16], const uint8_t dgst[32]
 	return 1;
 }
 
-int sm2_do_verify(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+int sm2_fast_verify(const SM2_Z256_POINT point_table[16], const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+{
+	uint64_t begin = METRICS_NSEC();
+	int ret = sm2_do_verify_table(point_table, NULL, dgst, sig);
+	METRICS_LATENCY(METRICS_sm2_verifies, begin);
+	return ret;
+}
+
+static const SM3_CTX *sm2_verify_key_find_id(const SM2_VERIFY_KEY *vkey, const char *id, size_t idlen)
+{
+	size_t i;
+
+	for (i = 0; i < vkey->num_ids; i++) {
+		if (vkey->ids[i].idlen == idlen && memcmp(vkey->ids[i].id, id, idlen) == 0) {
+			return &vkey->ids[i].sm3_ctx;
+		}
+	}
+	return NULL;
+}
+
+int sm2_verify_key_init(SM2_VERIFY_KEY *vkey, const SM2_KEY *key)
+{
+	if (!vkey || !key) {
+		error_print();
+		return -1;
+	}
+	memset(vkey, 0, sizeof(*vkey));
+	if (sm2_key_set_public_key(&vkey->key, &key->public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_verify_key_add_id(vkey, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm2_verify_key_add_id(SM2_VERIFY_KEY *vkey, const char *id, size_t idlen)
+{
+	SM2_VERIFY_KEY_ID *vid;
+	uint8_t z[SM3_DIGEST_SIZE];
+
+	if (!vkey || !id) {
+		error_print();
+		return -1;
+	}
+	if (idlen <= 0 || idlen > SM2_VERIFY_KEY_MAX_ID_LENGTH) {
+		error_print();
+		return -1;
+	}
+	if (sm2_verify_key_find_id(vkey, id, idlen)) {
+		return 1;
+	}
+	if (vkey->num_ids >= SM2_VERIFY_KEY_MAX_IDS) {
+		error_print();
+		return -1;
+	}
+
+	vid = &vkey->ids[vkey->num_ids];
+	memcpy(vid->id, id, idlen);
+	vid->idlen = idlen;
+	sm2_compute_z(z, &vkey->key.public_key, id, idlen);
+	sm3_init(&vid->sm3_ctx);
+	sm3_update(&vid->sm3_ctx, z, sizeof(z));
+	vkey->num_ids++;
+	return 1;
+}
+
+int sm2_verify_key_pre_compute(SM2_VERIFY_KEY *vkey)
+{
+	if (!vkey) {
+		error_print();
+		return -1;
+	}
+	if (vkey->point_table) {
+		return 1;
+	}
+	if (!(vkey->point_table = (SM2_Z256_AFFINE_POINT (*)[64])malloc(sizeof(SM2_Z256_AFFINE_POINT) * 37 * 64))) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_point_mul_comb_pre_compute(&vkey->key.public_key, vkey->point_table);
+	return 1;
+}
+
+int sm2_verify_key_do_verify(SM2_VERIFY_KEY *vkey, const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+{
+	uint64_t begin;
+	int ret;
+
+	if (sm2_verify_key_pre_compute(vkey) != 1) {
+		error_print();
+		return -1;
+	}
+	begin = METRICS_NSEC();
+	ret = sm2_do_verify_table(NULL, (const SM2_Z256_AFFINE_POINT (*)[64])vkey->point_table, dgst, sig);
+	METRICS_LATENCY(METRICS_sm2_verifies, begin);
+	return ret;
+}
+
+void sm2_verify_key_cleanup(SM2_VERIFY_KEY *vkey)
+{
+	if (vkey) {
+		if (vkey->point_table) {
+			free(vkey->point_table);
+		}
+		memset(vkey, 0, sizeof(*vkey));
+	}
+}
+
+// check x(R) mod n == c projectively, x(R) may be c or c + n as n < p
+static int sm2_z256_point_x_modn_equ(const SM2_Z256_POINT *R, const sm2_z256_t c)
+{
+	sm2_z256_t x;
+	sm2_z256_t z2;
+	sm2_z256_t t;
+
+	if (sm2_z256_point_is_at_infinity(R)) {
+		return 0;
+	}
+	sm2_z256_modp_mont_sqr(z2, R->Z);
+
+	sm2_z256_modp_to_mont(c, x);
+	sm2_z256_modp_mont_mul(t, x, z2);
+	if (sm2_z256_cmp(t, R->X) == 0) {
+		return 1;
+	}
+
+	if (sm2_z256_add(x, c, sm2_z256_order()) == 0
+		&& sm2_z256_cmp(x, sm2_z256_prime()) < 0) {
+		sm2_z256_modp_to_mont(x, x);
+		sm2_z256_modp_mont_mul(t, x, z2);
+		if (sm2_z256_cmp(t, R->X) == 0) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+static int sm2_do_verify_internal(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATURE *sig)
 {
 	SM2_Z256_POINT R;
-	SM2_Z256_POINT T;
 	sm2_z256_t r;
 	sm2_z256_t s;
 	sm2_z256_t e;
@@ -302,11 +475,8 @@ int sm2_do_verify(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATUR
 		return -1;
 	}
 
-	// Q(x,y) = s * G + t * P
-	sm2_z256_point_mul_generator(&R, s);
-	sm2_z256_point_mul(&T, t, &key->public_key);
-	sm2_z256_point_add(&R, &R, &T);
-	sm2_z256_point_get_xy(&R, x, NULL);
+	// Q(x,y) = s * G + t * P, all public, in variable time
+	sm2_z256_point_mul_sum_vartime(&R, t, &key->public_key, s);
 
 	// e = H(M)
 	sm2_z256_from_bytes(e, dgst);
@@ -314,18 +484,245 @@ int sm2_do_verify(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATUR
 		sm2_z256_sub(e, e, sm2_z256_order());
 	}
 
-	// r' = e + x (mod n)
-	if (sm2_z256_cmp(x, sm2_z256_order()) >= 0) {
-		sm2_z256_sub(x, x, sm2_z256_order());
+	// r == e + x (mod n) <=> x == r - e (mod n), checked without making Q affine
+	sm2_z256_modn_sub(x, r, e);
+	if (!sm2_z256_point_x_modn_equ(&R, x)) {
+		error_print();
+		return -1;
 	}
-	sm2_z256_modn_add(e, e, x);
+	return 1;
+}
 
-	// check if r == r'
-	if (sm2_z256_cmp(e, r) != 0) {
+int sm2_do_verify(const SM2_KEY *key, const uint8_t dgst[32], const SM2_SIGNATURE *sig)
+{
+	uint64_t begin = METRICS_NSEC();
+	int ret = sm2_do_verify_internal(key, dgst, sig);
+	METRICS_LATENCY(METRICS_sm2_verifies, begin);
+	return ret;
+}
+
+/*
+ * Batch verification
+ *
+ * SM2 signatures do not carry R, so the N checks can not be merged into one
+ * random linear combination as Schnorr batches do. Instead the work that
+ * does not depend on the signature is shared:
+ *   - the 16-point window table of every distinct public key is computed
+ *     once per batch, keys are found with a hash on the public point,
+ *   - R = s*G + t*P is never converted to affine, x(R) = r - e (mod n) is
+ *     checked as X == x * Z^2 (mod p) in Jacobian coordinates, which needs
+ *     no inversion at all.
+ * With AVX-512 IFMA the signatures are collected in groups of 8 and their
+ * s*G + t*P are computed in the lanes of sm2_z256_point_mul_sum_x8().
+ */
+typedef struct {
+	const SM2_Z256_POINT *public_key;
+	SM2_Z256_POINT table[16];
+} SM2_VERIFY_BATCH_TABLE;
+
+#ifdef ENABLE_SM2_IFMA
+typedef struct {
+	size_t index;
+	size_t table;
+	sm2_z256_t s;
+	sm2_z256_t t;
+	sm2_z256_t c; // r - e (mod n)
+} SM2_VERIFY_BATCH_LANE;
+#endif
+
+static size_t sm2_verify_batch_hash(const SM2_Z256_POINT *P, size_t mask)
+{
+	uint64_t h = P->X[0] ^ (P->Y[0] * 0x9e3779b97f4a7c15ULL);
+	return (size_t)(h ^ (h >> 29)) & mask;
+}
+
+#ifdef ENABLE_SM2_IFMA
+// the unused lanes repeat lanes[0], returns 0 if any signature is invalid
+static int sm2_verify_batch_x8(const SM2_VERIFY_BATCH_TABLE *tables, const SM2_Z256_POINT G_table[16],
+	const SM2_VERIFY_BATCH_LANE *lanes, size_t nlanes,
+	const SM2_KEY *const *keys, const uint8_t (*dgsts)[32], const SM2_SIGNATURE *sigs, int *results)
+{
+	SM2_Z256_POINT R[8];
+	uint64_t s[8][4];
+	uint64_t t[8][4];
+	const SM2_Z256_POINT *P_tables[8];
+	unsigned int bad;
+	size_t i;
+	int ret = 1;
+
+	for (i = 0; i < 8; i++) {
+		const SM2_VERIFY_BATCH_LANE *lane = &lanes[i < nlanes ? i : 0];
+		sm2_z256_copy(s[i], lane->s);
+		sm2_z256_copy(t[i], lane->t);
+		P_tables[i] = tables[lane->table].table;
+	}
+	bad = sm2_z256_point_mul_sum_x8(R, s, t, G_table, P_tables);
+
+	for (i = 0; i < nlanes; i++) {
+		size_t j = lanes[i].index;
+		int ok;
+
+		if (bad & (1 << i)) {
+			ok = (sm2_do_verify(keys[j], dgsts[j], &sigs[j]) == 1);
+		} else {
+			ok = sm2_z256_point_x_modn_equ(&R[i], lanes[i].c);
+		}
+		if (results) {
+			results[j] = ok ? 1 : -1;
+		}
+		if (!ok) {
+			ret = 0;
+		}
+	}
+	return ret;
+}
+#endif
+
+int sm2_do_verify_batch(const SM2_KEY *const *keys, const uint8_t (*dgsts)[32],
+	const SM2_SIGNATURE *sigs, size_t count, int *results)
+{
+	SM2_VERIFY_BATCH_TABLE *tables = NULL;
+	size_t *slots = NULL;
+	size_t tables_num = 0;
+	size_t tables_max = 0;
+	size_t mask;
+	size_t i;
+	int ret = 1;
+#ifdef ENABLE_SM2_IFMA
+	SM2_VERIFY_BATCH_LANE lanes[8];
+	SM2_Z256_POINT G_table[16];
+	size_t nlanes = 0;
+	int x8 = 0;
+#endif
+
+	if (!keys || !dgsts || !sigs) {
 		error_print();
 		return -1;
 	}
-	return 1;
+	if (!count) {
+		return 1;
+	}
+
+	// open addressing, slots keep `index + 1` into tables
+	for (mask = 16; mask < 2 * count && mask < ((size_t)1 << 20); mask <<= 1) {
+	}
+	if (!(slots = (size_t *)calloc(mask, sizeof(size_t)))) {
+		error_print();
+		return -1;
+	}
+	mask--;
+
+#ifdef ENABLE_SM2_IFMA
+	if ((gmssl_cpu_features() & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512IFMA))
+		== (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512IFMA) && count >= 4) {
+		SM2_Z256_POINT G;
+		sm2_z256_point_mul_generator(&G, sm2_z256_one());
+		sm2_z256_point_mul_pre_compute(&G, G_table);
+		x8 = 1;
+	}
+#endif
+
+	for (i = 0; i < count; i++) {
+		const SM2_Z256_POINT *P = &keys[i]->public_key;
+		SM2_VERIFY_BATCH_TABLE *table = NULL;
+		SM2_Z256_POINT R;
+		SM2_Z256_POINT T;
+		sm2_z256_t r;
+		sm2_z256_t s;
+		sm2_z256_t e;
+		sm2_z256_t t;
+		size_t h;
+		int ok = 0;
+
+		// check r, s in [1, n-1] and t = r + s (mod n) != 0
+		sm2_z256_from_bytes(r, sigs[i].r);
+		sm2_z256_from_bytes(s, sigs[i].s);
+		sm2_z256_modn_add(t, r, s);
+		if (sm2_z256_is_zero(r) || sm2_z256_cmp(r, sm2_z256_order()) >= 0
+			|| sm2_z256_is_zero(s) || sm2_z256_cmp(s, sm2_z256_order()) >= 0
+			|| sm2_z256_is_zero(t)) {
+			goto next;
+		}
+
+		for (h = sm2_verify_batch_hash(P, mask); slots[h]; h = (h + 1) & mask) {
+			if (memcmp(tables[slots[h] - 1].public_key, P, sizeof(SM2_Z256_POINT)) == 0) {
+				table = &tables[slots[h] - 1];
+				break;
+			}
+		}
+		if (!table) {
+			if (tables_num >= mask / 2) {
+				// too many distinct keys, verify the rest of them one by one
+				ok = (sm2_do_verify(keys[i], dgsts[i], &sigs[i]) == 1);
+				goto next;
+			}
+			if (tables_num == tables_max) {
+				SM2_VERIFY_BATCH_TABLE *p;
+				tables_max = tables_max ? 2 * tables_max : 16;
+				if (!(p = (SM2_VERIFY_BATCH_TABLE *)realloc(tables, tables_max * sizeof(*tables)))) {
+					error_print();
+					ret = -1;
+					goto end;
+				}
+				tables = p;
+			}
+			table = &tables[tables_num++];
+			table->public_key = P;
+			sm2_z256_point_mul_pre_compute(P, table->table);
+			slots[h] = tables_num;
+		}
+
+		// r == e + x (mod n) <=> x == r - e (mod n)
+		sm2_z256_from_bytes(e, dgsts[i]);
+		if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+			sm2_z256_sub(e, e, sm2_z256_order());
+		}
+		sm2_z256_modn_sub(e, r, e);
+
+#ifdef ENABLE_SM2_IFMA
+		if (x8) {
+			lanes[nlanes].index = i;
+			lanes[nlanes].table = (size_t)(table - tables);
+			sm2_z256_copy(lanes[nlanes].s, s);
+			sm2_z256_copy(lanes[nlanes].t, t);
+			sm2_z256_copy(lanes[nlanes].c, e);
+			if (++nlanes == 8) {
+				if (sm2_verify_batch_x8(tables, G_table, lanes, nlanes, keys, dgsts, sigs, results) != 1) {
+					ret = 0;
+				}
+				nlanes = 0;
+			}
+			continue;
+		}
+#endif
+
+		// R = s * G + t * P
+		sm2_z256_point_mul_generator(&R, s);
+		sm2_z256_point_mul_ex(&T, t, table->table);
+		sm2_z256_point_add(&R, &R, &T);
+		ok = sm2_z256_point_x_modn_equ(&R, e);
+
+	next:
+		if (results) {
+			results[i] = ok ? 1 : -1;
+		}
+		if (!ok) {
+			ret = 0;
+		}
+	}
+
+#ifdef ENABLE_SM2_IFMA
+	if (nlanes) {
+		if (sm2_verify_batch_x8(tables, G_table, lanes, nlanes, keys, dgsts, sigs, results) != 1) {
+			ret = 0;
+		}
+	}
+#endif
+
+end:
+	if (tables) free(tables);
+	free(slots);
+	return ret;
 }
 
 int sm2_signature_to_der(const SM2_SIGNATURE *sig, uint8_t **out, size_t *outlen)
@@ -445,12 +842,18 @@ int sm2_sign_fixlen(const SM2_KEY *key, const uint8_t dgst[32], size_t siglen, u
 int sm2_verify(const SM2_KEY *key, const uint8_t dgst[32], const uint8_t *sigbuf, size_t siglen)
 {
 	SM2_SIGNATURE sig;
+	uint8_t cache_key[32];
+	int cached;
 
 	if (!key || !dgst || !sigbuf || !siglen) {
 		error_print();
 		return -1;
 	}
 
+	if ((cached = sm2_verify_cache_enabled()) != 0
+		&& sm2_verify_cache_lookup(key, dgst, sigbuf, siglen, cache_key) == 1) {
+		return 1;
+	}
 	if (sm2_signature_from_der(&sig, &sigbuf, &siglen) != 1
 		|| asn1_length_is_zero(siglen) != 1) {
 		error_print();
@@ -460,6 +863,9 @@ int sm2_verify(const SM2_KEY *key, const uint8_t dgst[32], const uint8_t *sigbuf
 		error_print();
 		return -1;
 	}
+	if (cached) {
+		sm2_verify_cache_add(cache_key);
+	}
 	return 1;
 }
 
@@ -521,11 +927,53 @@ int sm2_sign_init(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t
 	}
 	ctx->saved_sm3_ctx = ctx->sm3_ctx;
 
-	if (sm2_fast_sign_pre_compute(ctx->pre_comp) != 1) {
+#ifdef ENABLE_SM2_SIGN_POOL
+	// (k, x1) pairs are taken from the default pool by sm2_sign_finish
+	if ((ctx->pool = sm2_sign_pool_get_default()) != NULL) {
+		ctx->num_pre_comp = 0;
+	} else
+#endif
+	{
+		if (sm2_fast_sign_pre_compute(ctx->pre_comp) != 1) {
+			error_print();
+			return -1;
+		}
+		ctx->num_pre_comp = SM2_SIGN_PRE_COMP_COUNT;
+		ctx->pool = NULL;
+	}
+
+	// copy private key at last
+	ctx->key = *key;
+	sm2_fast_sign_compute_key(key, ctx->fast_sign_private);
+
+	return 1;
+}
+
+#ifdef ENABLE_SM2_SIGN_POOL
+int sm2_sign_init_ex(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t idlen,
+	SM2_SIGN_POOL *pool)
+{
+	if (!ctx || !key || !pool) {
 		error_print();
 		return -1;
 	}
-	ctx->num_pre_comp = SM2_SIGN_PRE_COMP_COUNT;
+
+	sm3_init(&ctx->sm3_ctx);
+	if (id) {
+		uint8_t z[SM3_DIGEST_SIZE];
+
+		if (idlen <= 0 || idlen > SM2_MAX_ID_LENGTH) {
+			error_print();
+			return -1;
+		}
+		sm2_compute_z(z, &key->public_key, id, idlen);
+		sm3_update(&ctx->sm3_ctx, z, sizeof(z));
+	}
+	ctx->saved_sm3_ctx = ctx->sm3_ctx;
+
+	// (k, x1) pairs are taken from the pool by sm2_sign_finish
+	ctx->num_pre_comp = 0;
+	ctx->pool = pool;
 
 	// copy private key at last
 	ctx->key = *key;
@@ -533,6 +981,7 @@ int sm2_sign_init(SM2_SIGN_CTX *ctx, const SM2_KEY *key, const char *id, size_t
 
 	return 1;
 }
+#endif
 
 int sm2_sign_reset(SM2_SIGN_CTX *ctx)
 {
@@ -564,19 +1013,38 @@ int sm2_sign_finish(SM2_SIGN_CTX *ctx, uint8_t *sig, size_t *siglen)
 
 	sm3_finish(&ctx->sm3_ctx, dgst);
 
-	if (ctx->num_pre_comp == 0) {
-		if (sm2_fast_sign_pre_compute(ctx->pre_comp) != 1) {
+#ifdef ENABLE_SM2_SIGN_POOL
+	if (ctx->pool) {
+		SM2_SIGN_PRE_COMP pre_comp;
+		int ret;
+
+		if (sm2_sign_pool_get(ctx->pool, &pre_comp) != 1) {
 			error_print();
 			return -1;
 		}
-		ctx->num_pre_comp = SM2_SIGN_PRE_COMP_COUNT;
-	}
+		ret = sm2_fast_sign(ctx->fast_sign_private, &pre_comp, dgst, &signature);
+		gmssl_secure_clear(&pre_comp, sizeof(pre_comp));
+		if (ret != 1) {
+			error_print();
+			return -1;
+		}
+	} else
+#endif
+	{
+		if (ctx->num_pre_comp == 0) {
+			if (sm2_fast_sign_pre_compute(ctx->pre_comp) != 1) {
+				error_print();
+				return -1;
+			}
+			ctx->num_pre_comp = SM2_SIGN_PRE_COMP_COUNT;
+		}
 
-	ctx->num_pre_comp--;
-	if (sm2_fast_sign(ctx->fast_sign_private, &ctx->pre_comp[ctx->num_pre_comp],
-		dgst, &signature) != 1) {
-		error_print();
-		return -1;
+		ctx->num_pre_comp--;
+		if (sm2_fast_sign(ctx->fast_sign_private, &ctx->pre_comp[ctx->num_pre_comp],
+			dgst, &signature) != 1) {
+			error_print();
+			return -1;
+		}
 	}
 
 	*siglen = 0;
@@ -630,6 +1098,39 @@ int sm2_verify_init(SM2_VERIFY_CTX *ctx, const SM2_KEY *key, const char *id, siz
 	}
 
 	sm2_z256_point_mul_pre_compute(&key->public_key, ctx->public_point_table);
+	ctx->verify_key = NULL;
+
+	return 1;
+}
+
+int sm2_verify_init_ex(SM2_VERIFY_CTX *ctx, SM2_VERIFY_KEY *vkey, const char *id, size_t idlen)
+{
+	if (!ctx || !vkey) {
+		error_print();
+		return -1;
+	}
+
+	sm3_init(&ctx->sm3_ctx);
+	if (id) {
+		const SM3_CTX *id_ctx;
+		uint8_t z[SM3_DIGEST_SIZE];
+
+		if (idlen <= 0 || idlen > SM2_MAX_ID_LENGTH) {
+			error_print();
+			return -1;
+		}
+		if ((id_ctx = sm2_verify_key_find_id(vkey, id, idlen)) != NULL) {
+			ctx->sm3_ctx = *id_ctx;
+		} else {
+			sm2_compute_z(z, &vkey->key.public_key, id, idlen);
+			sm3_update(&ctx->sm3_ctx, z, sizeof(z));
+		}
+	}
+	ctx->saved_sm3_ctx = ctx->sm3_ctx;
+
+	// the comb table of vkey replaces public_point_table
+	ctx->key = vkey->key;
+	ctx->verify_key = vkey;
 
 	return 1;
 }
@@ -650,6 +1151,10 @@ int sm2_verify_finish(SM2_VERIFY_CTX *ctx, const uint8_t *sigbuf, size_t siglen)
 {
 	uint8_t dgst[SM3_DIGEST_SIZE];
 	SM2_SIGNATURE sig;
+	const uint8_t *der = sigbuf;
+	size_t derlen = siglen;
+	uint8_t cache_key[32];
+	int cached;
 
 	if (!ctx || !sigbuf) {
 		error_print();
@@ -664,11 +1169,22 @@ int sm2_verify_finish(SM2_VERIFY_CTX *ctx, const uint8_t *sigbuf, size_t siglen)
 
 	sm3_finish(&ctx->sm3_ctx, dgst);
 
-	if (sm2_fast_verify(ctx->public_point_table, dgst, &sig) != 1) {
+	if ((cached = sm2_verify_cache_enabled()) != 0
+		&& sm2_verify_cache_lookup(&ctx->key, dgst, der, derlen, cache_key) == 1) {
+		return 1;
+	}
+	if (ctx->verify_key) {
+		if (sm2_verify_key_do_verify(ctx->verify_key, dgst, &sig) != 1) {
+			error_print();
+			return -1;
+		}
+	} else if (sm2_fast_verify(ctx->public_point_table, dgst, &sig) != 1) {
 		error_print();
 		return -1;
 	}
-
+	if (cached) {
+		sm2_verify_cache_add(cache_key);
+	}
 	return 1;
 }
 
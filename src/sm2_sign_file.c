@@ -0,0 +1,259 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION pipe_mutex_t;
+typedef CONDITION_VARIABLE pipe_cond_t;
+typedef HANDLE pipe_thread_t;
+#define pipe_mutex_init(m)	InitializeCriticalSection(m)
+#define pipe_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pipe_mutex_lock(m)	EnterCriticalSection(m)
+#define pipe_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pipe_cond_init(c)	InitializeConditionVariable(c)
+#define pipe_cond_destroy(c)
+#define pipe_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pipe_cond_signal(c)	WakeConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pipe_mutex_t;
+typedef pthread_cond_t pipe_cond_t;
+typedef pthread_t pipe_thread_t;
+#define pipe_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pipe_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pipe_mutex_lock(m)	pthread_mutex_lock(m)
+#define pipe_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pipe_cond_init(c)	pthread_cond_init(c, NULL)
+#define pipe_cond_destroy(c)	pthread_cond_destroy(c)
+#define pipe_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define pipe_cond_signal(c)	pthread_cond_signal(c)
+#endif
+
+
+// a ring of filled buffers between the reading and the hashing thread
+typedef struct {
+	pipe_mutex_t mutex;
+	pipe_cond_t not_empty;
+	pipe_cond_t not_full;
+	uint8_t *bufs[SM2_SIGN_FILE_BUFS];
+	size_t lens[SM2_SIGN_FILE_BUFS];
+	size_t head;
+	size_t count;
+	int eof;
+	SM3_CTX sm3_ctx;
+} SM2_SIGN_FILE_PIPE;
+
+static void sm2_sign_file_hash(SM2_SIGN_FILE_PIPE *pipe)
+{
+	const uint8_t *buf;
+	size_t len;
+
+	for (;;) {
+		pipe_mutex_lock(&pipe->mutex);
+		while (!pipe->count && !pipe->eof) {
+			pipe_cond_wait(&pipe->not_empty, &pipe->mutex);
+		}
+		if (!pipe->count) {
+			pipe_mutex_unlock(&pipe->mutex);
+			break;
+		}
+		buf = pipe->bufs[pipe->head];
+		len = pipe->lens[pipe->head];
+		pipe_mutex_unlock(&pipe->mutex);
+
+		sm3_update(&pipe->sm3_ctx, buf, len);
+
+		pipe_mutex_lock(&pipe->mutex);
+		pipe->head = (pipe->head + 1) % SM2_SIGN_FILE_BUFS;
+		pipe->count--;
+		pipe_cond_signal(&pipe->not_full);
+		pipe_mutex_unlock(&pipe->mutex);
+	}
+}
+
+#ifdef _WIN32
+static unsigned __stdcall sm2_sign_file_thread(void *arg)
+{
+	sm2_sign_file_hash((SM2_SIGN_FILE_PIPE *)arg);
+	return 0;
+}
+#else
+static void *sm2_sign_file_thread(void *arg)
+{
+	sm2_sign_file_hash((SM2_SIGN_FILE_PIPE *)arg);
+	return NULL;
+}
+#endif
+
+// fill `buf` unless the input ends first
+static size_t read_full(FILE *fp, uint8_t *buf, size_t len)
+{
+	size_t rlen = 0;
+	size_t n;
+
+	while (rlen < len && (n = fread(buf + rlen, 1, len - rlen, fp)) > 0) {
+		rlen += n;
+	}
+	return rlen;
+}
+
+int sm2_sign_file(const SM2_KEY *key, const char *id, size_t idlen, FILE *fp,
+	uint8_t *sig, size_t *siglen)
+{
+	int ret = -1;
+	SM2_SIGN_FILE_PIPE *pipe = NULL;
+	pipe_thread_t thread;
+	int threaded = 0;
+	SM2_SIGN_PRE_COMP pre_comp[SM2_SIGN_PRE_COMP_COUNT];
+	sm2_z256_t fast_private;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	SM2_SIGNATURE signature;
+	size_t tail = 0;
+	size_t len;
+	int i;
+
+	if (!key || !fp || !sig || !siglen) {
+		error_print();
+		return -1;
+	}
+	if (id && (!idlen || idlen > SM2_MAX_ID_LENGTH)) {
+		error_print();
+		return -1;
+	}
+
+	if (!(pipe = (SM2_SIGN_FILE_PIPE *)malloc(sizeof(*pipe)))) {
+		error_print();
+		return -1;
+	}
+	memset(pipe, 0, sizeof(*pipe));
+	for (i = 0; i < SM2_SIGN_FILE_BUFS; i++) {
+		if (!(pipe->bufs[i] = (uint8_t *)malloc(SM2_SIGN_FILE_BUF_SIZE))) {
+			error_print();
+			goto end;
+		}
+	}
+	pipe_mutex_init(&pipe->mutex);
+	pipe_cond_init(&pipe->not_empty);
+	pipe_cond_init(&pipe->not_full);
+
+	sm3_init(&pipe->sm3_ctx);
+	if (id) {
+		uint8_t z[SM3_DIGEST_SIZE];
+		sm2_compute_z(z, &key->public_key, id, idlen);
+		sm3_update(&pipe->sm3_ctx, z, sizeof(z));
+	}
+
+	// an input of one buffer is hashed on the calling thread
+	len = read_full(fp, pipe->bufs[0], SM2_SIGN_FILE_BUF_SIZE);
+	if (len == SM2_SIGN_FILE_BUF_SIZE) {
+		pipe->lens[0] = len;
+		pipe->count = 1;
+		tail = 1;
+#ifdef _WIN32
+		threaded = (thread = (HANDLE)_beginthreadex(NULL, 0, sm2_sign_file_thread, pipe, 0, NULL)) != NULL;
+#else
+		threaded = pthread_create(&thread, NULL, sm2_sign_file_thread, pipe) == 0;
+#endif
+	}
+	if (!threaded) {
+		sm3_update(&pipe->sm3_ctx, pipe->bufs[0], len);
+		pipe->count = 0;
+	}
+
+	// the nonce points while the first buffer is hashed
+	if (sm2_fast_sign_pre_compute(pre_comp) != 1) {
+		error_print();
+		goto join;
+	}
+	sm2_fast_sign_compute_key(key, fast_private);
+
+	while (len == SM2_SIGN_FILE_BUF_SIZE) {
+		if (threaded) {
+			pipe_mutex_lock(&pipe->mutex);
+			while (pipe->count == SM2_SIGN_FILE_BUFS) {
+				pipe_cond_wait(&pipe->not_full, &pipe->mutex);
+			}
+			pipe_mutex_unlock(&pipe->mutex);
+		}
+
+		// the slot at `tail` is not read by the hashing thread until it is counted
+		len = read_full(fp, pipe->bufs[tail], SM2_SIGN_FILE_BUF_SIZE);
+		if (!len) {
+			break;
+		}
+		if (threaded) {
+			pipe_mutex_lock(&pipe->mutex);
+			pipe->lens[tail] = len;
+			pipe->count++;
+			pipe_cond_signal(&pipe->not_empty);
+			pipe_mutex_unlock(&pipe->mutex);
+			tail = (tail + 1) % SM2_SIGN_FILE_BUFS;
+		} else {
+			sm3_update(&pipe->sm3_ctx, pipe->bufs[tail], len);
+		}
+	}
+	if (!ferror(fp)) {
+		ret = 1;
+	}
+
+join:
+	if (threaded) {
+		pipe_mutex_lock(&pipe->mutex);
+		pipe->eof = 1;
+		pipe_cond_signal(&pipe->not_empty);
+		pipe_mutex_unlock(&pipe->mutex);
+#ifdef _WIN32
+		WaitForSingleObject(thread, INFINITE);
+		CloseHandle(thread);
+#else
+		pthread_join(thread, NULL);
+#endif
+	}
+	if (ret != 1) {
+		error_print();
+		goto clear;
+	}
+	ret = -1;
+
+	sm3_finish(&pipe->sm3_ctx, dgst);
+	if (sm2_fast_sign(fast_private, &pre_comp[0], dgst, &signature) != 1) {
+		error_print();
+		goto clear;
+	}
+	*siglen = 0;
+	if (sm2_signature_to_der(&signature, &sig, siglen) != 1) {
+		error_print();
+		goto clear;
+	}
+	ret = 1;
+
+clear:
+	gmssl_secure_clear(pre_comp, sizeof(pre_comp));
+	gmssl_secure_clear(fast_private, sizeof(fast_private));
+	pipe_cond_destroy(&pipe->not_full);
+	pipe_cond_destroy(&pipe->not_empty);
+	pipe_mutex_destroy(&pipe->mutex);
+end:
+	for (i = 0; i < SM2_SIGN_FILE_BUFS; i++) {
+		free(pipe->bufs[i]);
+	}
+	gmssl_secure_clear(pipe, sizeof(*pipe));
+	free(pipe);
+	return ret;
+}
@@ -0,0 +1,261 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION pool_mutex_t;
+typedef CONDITION_VARIABLE pool_cond_t;
+typedef HANDLE pool_thread_t;
+#define pool_mutex_init(m)	InitializeCriticalSection(m)
+#define pool_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pool_mutex_lock(m)	EnterCriticalSection(m)
+#define pool_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pool_cond_init(c)	InitializeConditionVariable(c)
+#define pool_cond_destroy(c)
+#define pool_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pool_cond_signal(c)	WakeConditionVariable(c)
+#define pool_load(p)		InterlockedCompareExchangePointer((PVOID volatile *)(p), NULL, NULL)
+#define pool_store(p,v)		InterlockedExchangePointer((PVOID volatile *)(p), (PVOID)(v))
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pool_mutex_t;
+typedef pthread_cond_t pool_cond_t;
+typedef pthread_t pool_thread_t;
+#define pool_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pool_mutex_lock(m)	pthread_mutex_lock(m)
+#define pool_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pool_cond_init(c)	pthread_cond_init(c, NULL)
+#define pool_cond_destroy(c)	pthread_cond_destroy(c)
+#define pool_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define pool_cond_signal(c)	pthread_cond_signal(c)
+#define pool_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define pool_store(p,v)		__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+
+struct SM2_SIGN_POOL_st {
+	pool_mutex_t mutex;
+	pool_cond_t not_full;
+	SM2_SIGN_PRE_COMP *pre_comps;
+	size_t capacity;
+	size_t count;
+	int stop;
+	int background;
+	pool_thread_t thread;
+};
+
+static SM2_SIGN_POOL *default_pool = NULL;
+
+// add up to `num` pairs, return the number added
+static size_t sm2_sign_pool_push(SM2_SIGN_POOL *pool, const SM2_SIGN_PRE_COMP *pre_comps, size_t num)
+{
+	size_t n;
+
+	pool_mutex_lock(&pool->mutex);
+	n = pool->capacity - pool->count;
+	if (n > num) {
+		n = num;
+	}
+	memcpy(pool->pre_comps + pool->count, pre_comps, sizeof(SM2_SIGN_PRE_COMP) * n);
+	pool->count += n;
+	pool_mutex_unlock(&pool->mutex);
+	return n;
+}
+
+// pairs are computed without the lock, in batches sharing one inversion
+static int sm2_sign_pool_fill(SM2_SIGN_POOL *pool, int background)
+{
+	SM2_SIGN_PRE_COMP pre_comps[SM2_SIGN_PRE_COMP_COUNT];
+	int ret = 1;
+
+	for (;;) {
+		pool_mutex_lock(&pool->mutex);
+		if (background) {
+			while (!pool->stop && pool->count == pool->capacity) {
+				pool_cond_wait(&pool->not_full, &pool->mutex);
+			}
+		}
+		if (pool->stop || pool->count == pool->capacity) {
+			pool_mutex_unlock(&pool->mutex);
+			break;
+		}
+		pool_mutex_unlock(&pool->mutex);
+
+		if (sm2_fast_sign_pre_compute(pre_comps) != 1) {
+			error_print();
+			ret = -1;
+			break;
+		}
+		sm2_sign_pool_push(pool, pre_comps, SM2_SIGN_PRE_COMP_COUNT);
+	}
+
+	gmssl_secure_clear(pre_comps, sizeof(pre_comps));
+	return ret;
+}
+
+#ifdef _WIN32
+static unsigned __stdcall sm2_sign_pool_thread(void *arg)
+{
+	sm2_sign_pool_fill((SM2_SIGN_POOL *)arg, 1);
+	return 0;
+}
+#else
+static void *sm2_sign_pool_thread(void *arg)
+{
+	sm2_sign_pool_fill((SM2_SIGN_POOL *)arg, 1);
+	return NULL;
+}
+#endif
+
+SM2_SIGN_POOL *sm2_sign_pool_new(size_t capacity, int background)
+{
+	SM2_SIGN_POOL *pool;
+
+	if (!capacity) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (SM2_SIGN_POOL *)calloc(1, sizeof(*pool)))) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool->pre_comps = (SM2_SIGN_PRE_COMP *)calloc(capacity, sizeof(SM2_SIGN_PRE_COMP)))) {
+		free(pool);
+		error_print();
+		return NULL;
+	}
+	pool->capacity = capacity;
+	pool_mutex_init(&pool->mutex);
+	pool_cond_init(&pool->not_full);
+
+	if (background) {
+#ifdef _WIN32
+		pool->thread = (HANDLE)_beginthreadex(NULL, 0, sm2_sign_pool_thread, pool, 0, NULL);
+		if (pool->thread) {
+			pool->background = 1;
+		}
+#else
+		if (pthread_create(&pool->thread, NULL, sm2_sign_pool_thread, pool) == 0) {
+			pool->background = 1;
+		}
+#endif
+		if (!pool->background) {
+			sm2_sign_pool_free(pool);
+			error_print();
+			return NULL;
+		}
+	}
+	return pool;
+}
+
+void sm2_sign_pool_free(SM2_SIGN_POOL *pool)
+{
+	if (!pool) {
+		return;
+	}
+	if (pool->background) {
+		pool_mutex_lock(&pool->mutex);
+		pool->stop = 1;
+		pool_cond_signal(&pool->not_full);
+		pool_mutex_unlock(&pool->mutex);
+#ifdef _WIN32
+		WaitForSingleObject(pool->thread, INFINITE);
+		CloseHandle(pool->thread);
+#else
+		pthread_join(pool->thread, NULL);
+#endif
+	}
+	pool_cond_destroy(&pool->not_full);
+	pool_mutex_destroy(&pool->mutex);
+
+	gmssl_secure_clear(pool->pre_comps, sizeof(SM2_SIGN_PRE_COMP) * pool->capacity);
+	free(pool->pre_comps);
+	free(pool);
+}
+
+int sm2_sign_pool_refill(SM2_SIGN_POOL *pool)
+{
+	if (!pool) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_pool_fill(pool, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+size_t sm2_sign_pool_count(SM2_SIGN_POOL *pool)
+{
+	size_t count;
+
+	pool_mutex_lock(&pool->mutex);
+	count = pool->count;
+	pool_mutex_unlock(&pool->mutex);
+	return count;
+}
+
+int sm2_sign_pool_get(SM2_SIGN_POOL *pool, SM2_SIGN_PRE_COMP *pre_comp)
+{
+	SM2_Z256_POINT P;
+
+	if (!pool || !pre_comp) {
+		error_print();
+		return -1;
+	}
+
+	pool_mutex_lock(&pool->mutex);
+	if (pool->count) {
+		pool->count--;
+		*pre_comp = pool->pre_comps[pool->count];
+		gmssl_secure_clear(&pool->pre_comps[pool->count], sizeof(SM2_SIGN_PRE_COMP));
+		pool_cond_signal(&pool->not_full);
+		pool_mutex_unlock(&pool->mutex);
+		return 1;
+	}
+	pool_cond_signal(&pool->not_full);
+	pool_mutex_unlock(&pool->mutex);
+
+	// pool drained, compute a single pair on the caller
+	do {
+		if (sm2_z256_rand_range(pre_comp->k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	} while (sm2_z256_is_zero(pre_comp->k));
+
+	sm2_z256_point_mul_generator(&P, pre_comp->k);
+	sm2_z256_point_get_xy(&P, pre_comp->x1_modn, NULL);
+	if (sm2_z256_cmp(pre_comp->x1_modn, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(pre_comp->x1_modn, pre_comp->x1_modn, sm2_z256_order());
+	}
+	gmssl_secure_clear(&P, sizeof(P));
+	return 1;
+}
+
+void sm2_sign_pool_set_default(SM2_SIGN_POOL *pool)
+{
+	pool_store(&default_pool, pool);
+}
+
+SM2_SIGN_POOL *sm2_sign_pool_get_default(void)
+{
+	return (SM2_SIGN_POOL *)pool_load(&default_pool);
+}
@@ -0,0 +1,189 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <time.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/metrics.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef SRWLOCK cache_mutex_t;
+#define CACHE_MUTEX_INITIALIZER	SRWLOCK_INIT
+#define cache_mutex_lock(m)	AcquireSRWLockExclusive(m)
+#define cache_mutex_unlock(m)	ReleaseSRWLockExclusive(m)
+#define cache_load(p)		InterlockedCompareExchange((LONG volatile *)(p), 0, 0)
+#define cache_store(p,v)	InterlockedExchange((LONG volatile *)(p), (LONG)(v))
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define CACHE_MUTEX_INITIALIZER	PTHREAD_MUTEX_INITIALIZER
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define cache_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define cache_store(p,v)	__atomic_store_n((p), (v), __ATOMIC_RELEASE)
+#endif
+
+
+typedef struct {
+	uint8_t key[SM3_DIGEST_SIZE];
+	time_t expires;
+	uint64_t used; // 0 for a free way
+} SM2_VERIFY_CACHE_ENTRY;
+
+typedef struct {
+	cache_mutex_t lock;
+	SM2_VERIFY_CACHE_ENTRY sets[SM2_VERIFY_CACHE_SETS][SM2_VERIFY_CACHE_WAYS];
+	uint64_t clock;
+	size_t hits;
+	size_t misses;
+} SM2_VERIFY_CACHE_SHARD;
+
+#define SHARD_INIT	{ .lock = CACHE_MUTEX_INITIALIZER }
+
+static SM2_VERIFY_CACHE_SHARD shards[SM2_VERIFY_CACHE_SHARDS] = {
+	SHARD_INIT, SHARD_INIT, SHARD_INIT, SHARD_INIT,
+	SHARD_INIT, SHARD_INIT, SHARD_INIT, SHARD_INIT,
+	SHARD_INIT, SHARD_INIT, SHARD_INIT, SHARD_INIT,
+	SHARD_INIT, SHARD_INIT, SHARD_INIT, SHARD_INIT,
+};
+static int cache_ttl = 0;
+
+
+// the keys are uniform, the first bytes pick the shard and the set
+static SM2_VERIFY_CACHE_SHARD *cache_shard(const uint8_t key[32])
+{
+	return &shards[key[0] % SM2_VERIFY_CACHE_SHARDS];
+}
+
+static SM2_VERIFY_CACHE_ENTRY *cache_set(SM2_VERIFY_CACHE_SHARD *shard, const uint8_t key[32])
+{
+	return shard->sets[(((uint32_t)key[1] << 8) | key[2]) % SM2_VERIFY_CACHE_SETS];
+}
+
+static void cache_shard_clear(SM2_VERIFY_CACHE_SHARD *shard)
+{
+	cache_mutex_lock(&shard->lock);
+	memset(shard->sets, 0, sizeof(shard->sets));
+	shard->clock = 0;
+	shard->hits = 0;
+	shard->misses = 0;
+	cache_mutex_unlock(&shard->lock);
+}
+
+void sm2_verify_cache_set_ttl(int seconds)
+{
+	cache_store(&cache_ttl, seconds > 0 ? seconds : 0);
+	if (seconds <= 0) {
+		sm2_verify_cache_clear();
+	}
+}
+
+int sm2_verify_cache_enabled(void)
+{
+	return cache_load(&cache_ttl) > 0;
+}
+
+int sm2_verify_cache_lookup(const SM2_KEY *key, const uint8_t dgst[32], const uint8_t *sig, size_t siglen,
+	uint8_t cache_key[32])
+{
+	SM2_VERIFY_CACHE_SHARD *shard;
+	SM2_VERIFY_CACHE_ENTRY *set;
+	SM3_CTX sm3_ctx;
+	uint8_t point[64];
+	time_t now;
+	int ret = 0;
+	int i;
+
+	sm2_z256_point_to_bytes(&key->public_key, point);
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, point, sizeof(point));
+	sm3_update(&sm3_ctx, dgst, 32);
+	sm3_update(&sm3_ctx, sig, siglen);
+	sm3_finish(&sm3_ctx, cache_key);
+
+	shard = cache_shard(cache_key);
+	set = cache_set(shard, cache_key);
+	time(&now);
+
+	cache_mutex_lock(&shard->lock);
+	for (i = 0; i < SM2_VERIFY_CACHE_WAYS; i++) {
+		if (set[i].used && memcmp(set[i].key, cache_key, 32) == 0) {
+			if (now < set[i].expires) {
+				set[i].used = ++shard->clock;
+				ret = 1;
+			} else {
+				set[i].used = 0;
+			}
+			break;
+		}
+	}
+	if (ret) shard->hits++;
+	else shard->misses++;
+	cache_mutex_unlock(&shard->lock);
+
+	METRICS_ADD(ret ? METRICS_sm2_verify_cache_hits : METRICS_sm2_verify_cache_misses, 1);
+	return ret;
+}
+
+void sm2_verify_cache_add(const uint8_t cache_key[32])
+{
+	SM2_VERIFY_CACHE_SHARD *shard = cache_shard(cache_key);
+	SM2_VERIFY_CACHE_ENTRY *set = cache_set(shard, cache_key);
+	SM2_VERIFY_CACHE_ENTRY *e;
+	int ttl;
+	int i;
+
+	if ((ttl = cache_load(&cache_ttl)) <= 0) {
+		return;
+	}
+
+	cache_mutex_lock(&shard->lock);
+	e = &set[0];
+	for (i = 0; i < SM2_VERIFY_CACHE_WAYS; i++) {
+		if (set[i].used && memcmp(set[i].key, cache_key, 32) == 0) {
+			e = &set[i];
+			break;
+		}
+		if (set[i].used < e->used) {
+			e = &set[i];
+		}
+	}
+	memcpy(e->key, cache_key, 32);
+	e->expires = time(NULL) + ttl;
+	e->used = ++shard->clock;
+	cache_mutex_unlock(&shard->lock);
+}
+
+void sm2_verify_cache_clear(void)
+{
+	int i;
+
+	for (i = 0; i < SM2_VERIFY_CACHE_SHARDS; i++) {
+		cache_shard_clear(&shards[i]);
+	}
+}
+
+void sm2_verify_cache_get_stats(size_t *hits, size_t *misses)
+{
+	size_t h = 0, m = 0;
+	int i;
+
+	for (i = 0; i < SM2_VERIFY_CACHE_SHARDS; i++) {
+		cache_mutex_lock(&shards[i].lock);
+		h += shards[i].hits;
+		m += shards[i].misses;
+		cache_mutex_unlock(&shards[i].lock);
+	}
+	if (hits) *hits = h;
+	if (misses) *misses = m;
+}
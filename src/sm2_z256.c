@@ -52,8 +52,18 @@
 #include <gmssl/rand.h>
 #include <gmssl/endian.h>
 #include <gmssl/sm2_z256.h>
+#include <gmssl/safegcd.h>
 #include <gmssl/sm3.h>
 #include <gmssl/asn1.h>
+#include <gmssl/numa.h>
+#include <gmssl/cpu.h>
+#if SM2_Z256_GENERATOR_WINDOW != 7
+# ifdef _WIN32
+#  include <windows.h>
+# else
+#  include <pthread.h>
+# endif
+#endif
 
 /*
 SM2 parameters
@@ -480,8 +490,18 @@ const uint64_t SM2_Z256_P_PRIME[4] = {
 // mont(1) (mod p) = 2^256 mod p = 2^256 - p
 const uint64_t *SM2_Z256_MODP_MONT_ONE = SM2_Z256_NEG_P;
 
-#if defined(ENABLE_SM2_ARM64) || defined(ENABLE_SM2_AMD64)
+#if defined(ENABLE_SM2_ARM64)
 	// src/sm2_z256_armv8.S
+#elif defined(ENABLE_SM2_AMD64)
+// src/sm2_z256_amd64.S, MULX/ADCX/ADOX if the CPU has BMI2 and ADX
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sm2_z256_amd64_init(void)
+{
+	const uint64_t mulx = GMSSL_CPU_BMI2|GMSSL_CPU_ADX;
+	sm2_z256_amd64_set_mulx((gmssl_cpu_features() & mulx) == mulx);
+}
 #elif defined(ENABLE_SM2_Z256_NEON)
 #include <arm_neon.h>
 
@@ -686,7 +706,7 @@ void sm2_z256_modp_mont_exp(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t e
 }
 
 // caller should check a != 0
-void sm2_z256_modp_mont_inv(sm2_z256_t r, const sm2_z256_t a)
+void sm2_z256_modp_mont_inv_exp(sm2_z256_t r, const sm2_z256_t a)
 {
 	sm2_z256_t a1;
 	sm2_z256_t a2;
@@ -768,32 +788,195 @@ void sm2_z256_modp_mont_inv(sm2_z256_t r, const sm2_z256_t a)
 	sm2_z256_modp_mont_mul(r, a4, a5);
 }
 
+#if defined(__SIZEOF_INT128__)
+// 2^768 (mod p), mont(a^-1 * R^-1, R^3) = a^-1 * R
+static const uint64_t SM2_Z256_2e768modp[4] = {
+	0x0000001200000016, 0x0000000efffffff8, 0x0000000a0000000c, 0x0000001b00000009,
+};
+#endif
+
+// caller should check a != 0
+void sm2_z256_modp_mont_inv(sm2_z256_t r, const sm2_z256_t a)
+{
+#if defined(__SIZEOF_INT128__)
+	safegcd_z256_inv(r, a, SM2_Z256_P);
+	sm2_z256_modp_mont_mul(r, r, SM2_Z256_2e768modp);
+#else
+	sm2_z256_modp_mont_inv_exp(r, a);
+#endif
+}
+
 // (p+1)/4 = 3fffffffbfffffffffffffffffffffffffffffffc00000004000000000000000
 const uint64_t SM2_Z256_SQRT_EXP[4] = {
 	0x4000000000000000, 0xffffffffc0000000, 0xffffffffffffffff, 0x3fffffffbfffffff,
 };
 
+// r[i] = a[i]^(2^k), interleaved over the lanes so that independent multiplications overlap
+static void modp_mont_sqr_n_lanes(sm2_z256_t *r, const sm2_z256_t *a, int k, size_t lanes)
+{
+	size_t i;
+
+	for (i = 0; i < lanes; i++) {
+		sm2_z256_modp_mont_sqr(r[i], a[i]);
+	}
+	while (--k > 0) {
+		for (i = 0; i < lanes; i++) {
+			sm2_z256_modp_mont_sqr(r[i], r[i]);
+		}
+	}
+}
+
+static void modp_mont_mul_lanes(sm2_z256_t *r, const sm2_z256_t *a, const sm2_z256_t *b, size_t lanes)
+{
+	size_t i;
+
+	for (i = 0; i < lanes; i++) {
+		sm2_z256_modp_mont_mul(r[i], a[i], b[i]);
+	}
+}
+
+/*
+ * r = a^((p+1)/4) with a fixed addition chain, 253 squarings and 14 multiplications
+ * against 160 multiplications of the binary method. The exponent is the bits
+ * 1^31 0 1^128 0^31 1 0^62, the runs of ones are appended from x_k = a^(2^k - 1).
+ */
+#define SQRT_MAX_LANES	4
+
+static void modp_mont_sqrt_exp_lanes(sm2_z256_t *r, const sm2_z256_t *a, size_t lanes)
+{
+	sm2_z256_t x2[SQRT_MAX_LANES];
+	sm2_z256_t x3[SQRT_MAX_LANES];
+	sm2_z256_t x6[SQRT_MAX_LANES];
+	sm2_z256_t x15[SQRT_MAX_LANES];
+	sm2_z256_t x31[SQRT_MAX_LANES];
+	sm2_z256_t t[SQRT_MAX_LANES];
+	int i;
+
+	modp_mont_sqr_n_lanes(t, a, 1, lanes);
+	modp_mont_mul_lanes(x2, t, a, lanes);
+	modp_mont_sqr_n_lanes(t, x2, 1, lanes);
+	modp_mont_mul_lanes(x3, t, a, lanes);
+	modp_mont_sqr_n_lanes(t, x3, 3, lanes);
+	modp_mont_mul_lanes(x6, t, x3, lanes);
+	modp_mont_sqr_n_lanes(t, x6, 6, lanes);
+	modp_mont_mul_lanes(t, t, x6, lanes); // x12
+	modp_mont_sqr_n_lanes(t, t, 3, lanes);
+	modp_mont_mul_lanes(x15, t, x3, lanes);
+	modp_mont_sqr_n_lanes(t, x15, 15, lanes);
+	modp_mont_mul_lanes(t, t, x15, lanes); // x30
+	modp_mont_sqr_n_lanes(t, t, 1, lanes);
+	modp_mont_mul_lanes(x31, t, a, lanes);
+
+	// 1^31 0 1^124
+	modp_mont_sqr_n_lanes(t, x31, 1 + 31, lanes);
+	modp_mont_mul_lanes(t, t, x31, lanes);
+	for (i = 0; i < 3; i++) {
+		modp_mont_sqr_n_lanes(t, t, 31, lanes);
+		modp_mont_mul_lanes(t, t, x31, lanes);
+	}
+	// 1^128
+	modp_mont_sqr_n_lanes(t, t, 3, lanes);
+	modp_mont_mul_lanes(t, t, x3, lanes);
+	modp_mont_sqr_n_lanes(t, t, 1, lanes);
+	modp_mont_mul_lanes(t, t, a, lanes);
+	// 0^31 1 0^62
+	modp_mont_sqr_n_lanes(t, t, 31 + 1, lanes);
+	modp_mont_mul_lanes(t, t, a, lanes);
+	modp_mont_sqr_n_lanes(r, t, 62, lanes);
+}
+
 // -r (mod p), i.e. (p - r) is also a square root of a
 int sm2_z256_modp_mont_sqrt(sm2_z256_t r, const sm2_z256_t a)
 {
 	sm2_z256_t a_;
-	sm2_z256_t r_; // temp result, prevent call sm2_fp_sqrt(a, a)
+	sm2_z256_t r_[1]; // temp result, prevent call sm2_fp_sqrt(a, a)
 
 	// r = a^((p + 1)/4) when p = 3 (mod 4)
-	sm2_z256_modp_mont_exp(r_, a, SM2_Z256_SQRT_EXP);
+	modp_mont_sqrt_exp_lanes(r_, (const sm2_z256_t *)a, 1);
 
 	// check r^2 == a
-	sm2_z256_modp_mont_sqr(a_, r_);
+	sm2_z256_modp_mont_sqr(a_, r_[0]);
 	if (sm2_z256_cmp(a_, a) != 0) {
 		// not every number has a square root, so it is not an error
 		// `sm2_z256_point_from_hash` need a non-negative return value
 		return 0;
 	}
 
-	sm2_z256_copy(r, r_);
+	sm2_z256_copy(r, r_[0]);
 	return 1;
 }
 
+/*
+ * Variable time GF(p) operations for public values only, e.g. of signature
+ * verification and point decoding.
+ */
+
+// a^-1 in Montgomery form, a != 0, binary extended Euclid keeps x1 * a == R^2 * u (mod p)
+void sm2_z256_modp_mont_inv_vartime(sm2_z256_t r, const sm2_z256_t a)
+{
+	sm2_z256_t u;
+	sm2_z256_t v;
+	sm2_z256_t x1;
+	sm2_z256_t x2;
+
+	sm2_z256_copy(u, a);
+	sm2_z256_copy(v, SM2_Z256_P);
+	sm2_z256_modp_to_mont(SM2_Z256_MODP_MONT_ONE, x1);
+	sm2_z256_set_zero(x2);
+
+	while (sm2_z256_cmp(u, SM2_Z256_ONE) != 0 && sm2_z256_cmp(v, SM2_Z256_ONE) != 0) {
+		while (!(u[0] & 1)) {
+			sm2_z256_rshift(u, u, 1);
+			sm2_z256_modp_haf(x1, x1);
+		}
+		while (!(v[0] & 1)) {
+			sm2_z256_rshift(v, v, 1);
+			sm2_z256_modp_haf(x2, x2);
+		}
+		if (sm2_z256_cmp(u, v) >= 0) {
+			sm2_z256_sub(u, u, v);
+			sm2_z256_modp_sub(x1, x1, x2);
+		} else {
+			sm2_z256_sub(v, v, u);
+			sm2_z256_modp_sub(x2, x2, x1);
+		}
+	}
+	sm2_z256_copy(r, sm2_z256_cmp(u, SM2_Z256_ONE) == 0 ? x1 : x2);
+}
+
+// the Jacobi symbol (a/p) of a Montgomery form a, which is the one of a as (2/p) = 1 for p = 7 (mod 8)
+int sm2_z256_modp_mont_jacobi_vartime(const sm2_z256_t a)
+{
+	sm2_z256_t x;
+	sm2_z256_t n;
+	sm2_z256_t t;
+	int sign = 1;
+
+	sm2_z256_copy(x, a);
+	sm2_z256_copy(n, SM2_Z256_P);
+
+	while (!sm2_z256_is_zero(x)) {
+		// (2/n) = -1 for n = 3, 5 (mod 8)
+		while (!(x[0] & 1)) {
+			sm2_z256_rshift(x, x, 1);
+			if ((n[0] & 7) == 3 || (n[0] & 7) == 5) {
+				sign = -sign;
+			}
+		}
+		// quadratic reciprocity of the odd x and n
+		if (sm2_z256_cmp(x, n) < 0) {
+			sm2_z256_copy(t, x);
+			sm2_z256_copy(x, n);
+			sm2_z256_copy(n, t);
+			if ((x[0] & 3) == 3 && (n[0] & 3) == 3) {
+				sign = -sign;
+			}
+		}
+		sm2_z256_sub(x, x, n);
+	}
+	return sm2_z256_cmp(n, SM2_Z256_ONE) == 0 ? sign : 0;
+}
+
 // GF(n)
 
 // n = 0xfffffffeffffffffffffffffffffffff7203df6b21c6052b53bbf40939d54123
@@ -867,7 +1050,7 @@ const uint64_t *sm2_z256_order_minus_one(void) {
 const uint64_t *SM2_Z256_MODN_MONT_ONE = SM2_Z256_NEG_N;
 
 
-#if !defined(ENABLE_SM2_ARM64) 
+#if !defined(ENABLE_SM2_ARM64) && !defined(ENABLE_SM2_AMD64)
 void sm2_z256_modn_mont_mul(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b)
 {
 	sm2_z512_t z;
@@ -916,7 +1099,7 @@ void sm2_z256_modn_mul(sm2_z256_t r, const sm2_z256_t a, const sm2_z256_t b)
 	sm2_z256_modn_from_mont(r, r);
 }
 
-#if !defined(ENABLE_SM2_ARM64)
+#if !defined(ENABLE_SM2_ARM64) && !defined(ENABLE_SM2_AMD64)
 void sm2_z256_modn_mont_sqr(sm2_z256_t r, const sm2_z256_t a)
 {
 	sm2_z256_modn_mont_mul(r, a, a);
@@ -970,7 +1153,7 @@ const uint64_t SM2_Z256_N_MINUS_TWO[4] = {
 };
 // TODO: use the special form of SM2_Z256_N_MINUS_TWO[2, 3]		
 
-void sm2_z256_modn_mont_inv(sm2_z256_t r, const sm2_z256_t a)
+void sm2_z256_modn_mont_inv_exp(sm2_z256_t r, const sm2_z256_t a)
 {
 	// expand sm2_z256_modn_mont_exp(r, a, SM2_Z256_N_MINUS_TWO)
 	sm2_z256_t t;
@@ -1009,13 +1192,57 @@ void sm2_z256_modn_mont_inv(sm2_z256_t r, const sm2_z256_t a)
 	sm2_z256_copy(r, t);
 }
 
+#if defined(__SIZEOF_INT128__)
+// 2^768 (mod n)
+static const uint64_t SM2_Z256_2e768modn[4] = {
+	0x6ff874c70eaa0b85, 0x87d0c315aabe8d32, 0x4c4fbbb397185afc, 0xc813249cd574ea14,
+};
+#endif
+
+void sm2_z256_modn_mont_inv(sm2_z256_t r, const sm2_z256_t a)
+{
+#if defined(__SIZEOF_INT128__)
+	safegcd_z256_inv(r, a, SM2_Z256_N);
+	sm2_z256_modn_mont_mul(r, r, SM2_Z256_2e768modn);
+#else
+	sm2_z256_modn_mont_inv_exp(r, a);
+#endif
+}
+
 void sm2_z256_modn_inv(sm2_z256_t r, const sm2_z256_t a)
 {
+#if defined(__SIZEOF_INT128__)
+	safegcd_z256_inv(r, a, SM2_Z256_N);
+#else
 	sm2_z256_t mont_a;
 
 	sm2_z256_modn_to_mont(a, mont_a);
 	sm2_z256_modn_mont_inv(r, mont_a);
 	sm2_z256_modn_from_mont(r, r);
+#endif
+}
+
+// Montgomery's trick, r[i] holds a[0] * ... * a[i-1] until the way back
+void sm2_z256_modn_inv_batch(sm2_z256_t *r, const sm2_z256_t *a, size_t n)
+{
+	sm2_z256_t acc;
+	sm2_z256_t t;
+	size_t i;
+
+	if (!n) {
+		return;
+	}
+	sm2_z256_set_one(acc);
+	for (i = 0; i < n; i++) {
+		sm2_z256_copy(r[i], acc);
+		sm2_z256_modn_mul(acc, acc, a[i]);
+	}
+	sm2_z256_modn_inv(acc, acc);
+	for (i = n; i > 0; i--) {
+		sm2_z256_modn_mul(t, acc, r[i - 1]);
+		sm2_z256_modn_mul(acc, acc, a[i - 1]);
+		sm2_z256_copy(r[i - 1], t);
+	}
 }
 
 
@@ -1583,30 +1810,111 @@ int sm2_z256_point_affine_print(FILE *fp, int fmt, int ind, const char *label, c
 	return 1;
 }
 
-extern const uint64_t sm2_z256_pre_comp[37][64 * 4 * 2];
-static SM2_Z256_AFFINE_POINT (*g_pre_comp)[64] = (SM2_Z256_AFFINE_POINT (*)[64])sm2_z256_pre_comp;
 
-// FIXME: remove if/else
-void sm2_z256_point_mul_generator(SM2_Z256_POINT *R, const sm2_z256_t k)
+/*
+ * Montgomery's trick, one inversion and about 3 multiplications per point.
+ * R[i] is in Montgomery form as the SM2_Z256_AFFINE_POINT tables. Points at
+ * infinity are set to (0, 0) and make the return value 0.
+ */
+static int points_get_affine_batch(const SM2_Z256_POINT *P, size_t n, SM2_Z256_AFFINE_POINT *R,
+	void (*mont_inv)(sm2_z256_t r, const sm2_z256_t a))
+{
+	sm2_z256_t acc;
+	sm2_z256_t z_inv;
+	sm2_z256_t z_inv2;
+	size_t i;
+	int ret = 1;
+
+	// R[i].x = Z_0 * ... * Z_{i-1}, the Z of points at infinity are skipped
+	sm2_z256_copy(acc, SM2_Z256_MODP_MONT_ONE);
+	for (i = 0; i < n; i++) {
+		sm2_z256_copy(R[i].x, acc);
+		if (!sm2_z256_is_zero(P[i].Z)) {
+			sm2_z256_modp_mont_mul(acc, acc, P[i].Z);
+		}
+	}
+	mont_inv(acc, acc);
+
+	for (i = n; i > 0; i--) {
+		if (sm2_z256_is_zero(P[i - 1].Z)) {
+			sm2_z256_set_zero(R[i - 1].x);
+			sm2_z256_set_zero(R[i - 1].y);
+			ret = 0;
+			continue;
+		}
+
+		// z_inv = 1/Z_{i-1}, acc = 1/(Z_0 * ... * Z_{i-2})
+		sm2_z256_modp_mont_mul(z_inv, acc, R[i - 1].x);
+		sm2_z256_modp_mont_mul(acc, acc, P[i - 1].Z);
+
+		sm2_z256_modp_mont_sqr(z_inv2, z_inv);
+		sm2_z256_modp_mont_mul(R[i - 1].x, P[i - 1].X, z_inv2);
+		sm2_z256_modp_mont_mul(z_inv2, z_inv2, z_inv);
+		sm2_z256_modp_mont_mul(R[i - 1].y, P[i - 1].Y, z_inv2);
+	}
+	return ret;
+}
+
+int sm2_z256_points_get_affine_batch(const SM2_Z256_POINT *P, size_t n, SM2_Z256_AFFINE_POINT *R)
+{
+	return points_get_affine_batch(P, n, R, sm2_z256_modp_mont_inv);
+}
+
+int sm2_z256_points_get_affine_batch_vartime(const SM2_Z256_POINT *P, size_t n, SM2_Z256_AFFINE_POINT *R)
+{
+	return points_get_affine_batch(P, n, R, sm2_z256_modp_mont_inv_vartime);
+}
+
+#define COMB_ROWS(w)	((256 + (w)) / (w))
+#define COMB_COLS(w)	(1 << ((w) - 1))
+
+// T[i * 2^(w-1) + j] = (j + 1) * 2^(w*i) * P, 4 <= w <= 8
+static void point_mul_comb_pre_compute_w(const SM2_Z256_POINT *P, int w, SM2_Z256_AFFINE_POINT *T)
+{
+	SM2_Z256_POINT J[COMB_COLS(8) + 1];
+	SM2_Z256_AFFINE_POINT A[COMB_COLS(8) + 1];
+	SM2_Z256_AFFINE_POINT Q;
+	int rows = COMB_ROWS(w);
+	int cols = COMB_COLS(w);
+	int i, j;
+
+	sm2_z256_points_get_affine_batch(P, 1, &Q);
+
+	for (i = 0; i < rows; i++) {
+		sm2_z256_point_copy_affine(&J[0], &Q);
+		sm2_z256_point_dbl(&J[1], &J[0]);
+		for (j = 2; j < cols; j++) {
+			sm2_z256_point_add_affine(&J[j], &J[j - 1], &Q);
+		}
+		// next base 2^w * Q = 2 * (2^(w-1) * Q)
+		sm2_z256_point_dbl(&J[cols], &J[cols - 1]);
+
+		sm2_z256_points_get_affine_batch(J, cols + 1, A);
+		memcpy(T + i * cols, A, sizeof(SM2_Z256_AFFINE_POINT) * cols);
+		Q = A[cols];
+	}
+}
+
+static void point_mul_comb_w(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_AFFINE_POINT *T, int w)
 {
-	size_t window_size = 7;
 	int R_infinity = 1;
-	int n = (256 + window_size - 1)/window_size;
+	int n = COMB_ROWS(w); // the top window takes the carry of the Booth recoding
+	int cols = COMB_COLS(w);
 	int i;
 
 	for (i = n - 1; i >= 0; i--) {
-		int booth = sm2_z256_get_booth(k, window_size, i);
+		int booth = sm2_z256_get_booth(k, w, i);
 
 		if (R_infinity) {
 			if (booth != 0) {
-				sm2_z256_point_copy_affine(R, &g_pre_comp[i][booth - 1]);
+				sm2_z256_point_copy_affine(R, &T[i * cols + booth - 1]);
 				R_infinity = 0;
 			}
 		} else {
 			if (booth > 0) {
-				sm2_z256_point_add_affine(R, R, &g_pre_comp[i][booth - 1]);
+				sm2_z256_point_add_affine(R, R, &T[i * cols + booth - 1]);
 			} else if (booth < 0) {
-				sm2_z256_point_sub_affine(R, R, &g_pre_comp[i][-booth - 1]);
+				sm2_z256_point_sub_affine(R, R, &T[i * cols - booth - 1]);
 			}
 		}
 	}
@@ -1616,6 +1924,87 @@ void sm2_z256_point_mul_generator(SM2_Z256_POINT *R, const sm2_z256_t k)
 	}
 }
 
+// T[i][j] = (j + 1) * 2^(7*i) * P, the same layout as the default generator table
+void sm2_z256_point_mul_comb_pre_compute(const SM2_Z256_POINT *P, SM2_Z256_AFFINE_POINT T[37][64])
+{
+	point_mul_comb_pre_compute_w(P, 7, &T[0][0]);
+}
+
+void sm2_z256_point_mul_comb(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_AFFINE_POINT T[37][64])
+{
+	point_mul_comb_w(R, k, &T[0][0], 7);
+}
+
+void sm2_z256_point_mul_comb_w_pre_compute(const SM2_Z256_POINT *P, int w, SM2_Z256_AFFINE_POINT *T)
+{
+	point_mul_comb_pre_compute_w(P, w, T);
+}
+
+void sm2_z256_point_mul_comb_w(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_AFFINE_POINT *T, int w)
+{
+	point_mul_comb_w(R, k, T, w);
+}
+
+#if SM2_Z256_GENERATOR_WINDOW == 7
+
+extern const uint64_t sm2_z256_pre_comp[37][64 * 4 * 2];
+static GMSSL_NUMA_REPLICA g_pre_comp_replica;
+
+static const SM2_Z256_AFFINE_POINT *generator_table(void)
+{
+	return (const SM2_Z256_AFFINE_POINT *)gmssl_numa_replica(&g_pre_comp_replica,
+		sm2_z256_pre_comp, sizeof(sm2_z256_pre_comp));
+}
+
+#elif SM2_Z256_GENERATOR_WINDOW >= 4 && SM2_Z256_GENERATOR_WINDOW <= 8
+
+// other windows than the built-in table are computed at the first use
+static SM2_Z256_AFFINE_POINT g_pre_comp[COMB_ROWS(SM2_Z256_GENERATOR_WINDOW) * COMB_COLS(SM2_Z256_GENERATOR_WINDOW)];
+static GMSSL_NUMA_REPLICA g_pre_comp_replica;
+
+static void generator_table_init(void)
+{
+	SM2_Z256_POINT G;
+
+	sm2_z256_point_from_hex(&G,
+		"32c4ae2c1f1981195f9904466a39c9948fe30bbff2660be1715a4589334c74c7"
+		"bc3736a2f4f6779c59bdcee36b692153d0a9877cc62a474002df32e52139f0a0");
+	point_mul_comb_pre_compute_w(&G, SM2_Z256_GENERATOR_WINDOW, g_pre_comp);
+}
+
+#ifdef _WIN32
+static INIT_ONCE g_pre_comp_once = INIT_ONCE_STATIC_INIT;
+
+static BOOL CALLBACK generator_table_init_once(PINIT_ONCE once, PVOID param, PVOID *ctx)
+{
+	generator_table_init();
+	return TRUE;
+}
+
+static const SM2_Z256_AFFINE_POINT *generator_table(void)
+{
+	InitOnceExecuteOnce(&g_pre_comp_once, generator_table_init_once, NULL, NULL);
+	return gmssl_numa_replica(&g_pre_comp_replica, g_pre_comp, sizeof(g_pre_comp));
+}
+#else
+static pthread_once_t g_pre_comp_once = PTHREAD_ONCE_INIT;
+
+static const SM2_Z256_AFFINE_POINT *generator_table(void)
+{
+	pthread_once(&g_pre_comp_once, generator_table_init);
+	return gmssl_numa_replica(&g_pre_comp_replica, g_pre_comp, sizeof(g_pre_comp));
+}
+#endif
+
+#else
+# error "SM2_Z256_GENERATOR_WINDOW should be in 4..8"
+#endif
+
+void sm2_z256_point_mul_generator(SM2_Z256_POINT *R, const sm2_z256_t k)
+{
+	point_mul_comb_w(R, k, generator_table(), SM2_Z256_GENERATOR_WINDOW);
+}
+
 // R = t*P + s*G
 void sm2_z256_point_mul_sum(SM2_Z256_POINT *R, const uint64_t t[4], const SM2_Z256_POINT *P, const uint64_t s[4])
 {
@@ -1625,6 +2014,202 @@ void sm2_z256_point_mul_sum(SM2_Z256_POINT *R, const uint64_t t[4], const SM2_Z2
 	sm2_z256_point_add(R, R, &Q);
 }
 
+// width-w NAF of k, the digits are odd in (-2^(w-1), 2^(w-1)) or 0, returns the number of digits
+static int sm2_z256_wnaf(const sm2_z256_t k, int w, int8_t naf[257])
+{
+	uint64_t t[5]; // t[4] takes the carry of the negative digits
+	int len = 0;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		t[i] = k[i];
+	}
+	t[4] = 0;
+
+	while (t[0] | t[1] | t[2] | t[3] | t[4]) {
+		int d = 0;
+
+		if (t[0] & 1) {
+			d = (int)(t[0] & ((1 << w) - 1));
+			if (d >= (1 << (w - 1))) {
+				d -= 1 << w;
+			}
+			// t -= d
+			if (d > 0) {
+				uint64_t b = (uint64_t)d;
+				for (i = 0; i < 5 && b; i++) {
+					uint64_t x = t[i];
+					t[i] = x - b;
+					b = x < b;
+				}
+			} else {
+				uint64_t c = (uint64_t)(-d);
+				for (i = 0; i < 5 && c; i++) {
+					t[i] += c;
+					c = t[i] < c;
+				}
+			}
+		}
+		naf[len++] = (int8_t)d;
+
+		for (i = 0; i < 4; i++) {
+			t[i] = (t[i] >> 1) | (t[i + 1] << 63);
+		}
+		t[4] >>= 1;
+	}
+	return len;
+}
+
+// R +/-= A, R not at infinity, with the doubling and the opposite points add_affine does not handle,
+// returns 1 if R is at infinity
+static int point_add_affine_vartime(SM2_Z256_POINT *R, const SM2_Z256_AFFINE_POINT *A, int neg)
+{
+	SM2_Z256_POINT prev = *R;
+	SM2_Z256_POINT Q;
+
+	if (neg) {
+		sm2_z256_point_sub_affine(R, R, A);
+	} else {
+		sm2_z256_point_add_affine(R, R, A);
+	}
+	if (!sm2_z256_is_zero(R->Z)) {
+		return 0;
+	}
+
+	// Z3 = Z1 * H, R and +/-A have the same x
+	sm2_z256_point_copy_affine(&Q, A);
+	if (neg) {
+		sm2_z256_point_neg(&Q, &Q);
+	}
+	if (sm2_z256_point_equ(&prev, &Q) == 1) {
+		sm2_z256_point_dbl(R, &prev);
+		return 0;
+	}
+	sm2_z256_point_set_infinity(R);
+	return 1;
+}
+
+// wNAF with the odd multiples P, 3P, .., 15P made affine with one inversion, for mixed additions
+void sm2_z256_point_mul_vartime(SM2_Z256_POINT *R, const sm2_z256_t k, const SM2_Z256_POINT *P)
+{
+	int window_size = 5;
+	SM2_Z256_POINT T[8];
+	SM2_Z256_AFFINE_POINT A[8];
+	SM2_Z256_POINT P2;
+	int8_t naf[257];
+	int R_infinity = 1;
+	int len, i;
+
+	if (sm2_z256_point_is_at_infinity(P)) {
+		sm2_z256_point_set_infinity(R);
+		return;
+	}
+	T[0] = *P;
+	sm2_z256_point_dbl(&P2, P);
+	for (i = 1; i < 8; i++) {
+		sm2_z256_point_add(&T[i], &T[i - 1], &P2);
+	}
+	sm2_z256_points_get_affine_batch_vartime(T, 8, A);
+
+	len = sm2_z256_wnaf(k, window_size, naf);
+	for (i = len - 1; i >= 0; i--) {
+		int d = naf[i];
+
+		if (!R_infinity) {
+			sm2_z256_point_dbl(R, R);
+		}
+		if (!d) {
+			continue;
+		}
+		if (R_infinity) {
+			sm2_z256_point_copy_affine(R, &A[(d > 0 ? d : -d) / 2]);
+			if (d < 0) {
+				sm2_z256_point_neg(R, R);
+			}
+			R_infinity = 0;
+		} else {
+			R_infinity = point_add_affine_vartime(R, &A[(d > 0 ? d : -d) / 2], d < 0);
+		}
+	}
+
+	if (R_infinity) {
+		sm2_z256_point_set_infinity(R);
+	}
+}
+
+// R = t*P + s*G, the generator comb is indexed by the digits of s, which is variable time too
+void sm2_z256_point_mul_sum_vartime(SM2_Z256_POINT *R, const sm2_z256_t t, const SM2_Z256_POINT *P, const sm2_z256_t s)
+{
+	SM2_Z256_POINT Q;
+	sm2_z256_point_mul_generator(R, s);
+	sm2_z256_point_mul_vartime(&Q, t, P);
+	sm2_z256_point_add(R, R, &Q);
+}
+
+// interleaved 5-bit Booth windows, the 5 doublings of every window are shared by all the points
+int sm2_z256_point_multi_mul_straus(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n)
+{
+	int window_size = 5;
+	int R_infinity = 1;
+	int windows = (256 + window_size - 1)/window_size;
+	SM2_Z256_POINT (*T)[16];
+	size_t j;
+	int i;
+
+	if (!R || (n && (!k || !P))) {
+		error_print();
+		return -1;
+	}
+	if (n > SIZE_MAX / sizeof(*T)) {
+		error_print();
+		return -1;
+	}
+	if (!n) {
+		sm2_z256_point_set_infinity(R);
+		return 1;
+	}
+	if (!(T = (SM2_Z256_POINT (*)[16])malloc(sizeof(*T) * n))) {
+		error_print();
+		return -1;
+	}
+	for (j = 0; j < n; j++) {
+		sm2_z256_point_mul_pre_compute(&P[j], T[j]);
+	}
+
+	for (i = windows - 1; i >= 0; i--) {
+		if (!R_infinity) {
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+			sm2_z256_point_dbl(R, R);
+		}
+		for (j = 0; j < n; j++) {
+			int booth = sm2_z256_get_booth(k[j], window_size, i);
+
+			if (R_infinity) {
+				if (booth > 0) {
+					*R = T[j][booth - 1];
+					R_infinity = 0;
+				} else if (booth < 0) {
+					sm2_z256_point_neg(R, &T[j][-booth - 1]);
+					R_infinity = 0;
+				}
+			} else if (booth > 0) {
+				sm2_z256_point_add(R, R, &T[j][booth - 1]);
+			} else if (booth < 0) {
+				sm2_z256_point_sub(R, R, &T[j][-booth - 1]);
+			}
+		}
+	}
+
+	if (R_infinity) {
+		sm2_z256_point_set_infinity(R);
+	}
+	free(T);
+	return 1;
+}
+
 // point_at_infinity can not be encoded/decoded to/from bytes
 int sm2_z256_point_from_bytes(SM2_Z256_POINT *P, const uint8_t in[64])
 {
@@ -1760,22 +2345,18 @@ int sm2_z256_is_odd(const sm2_z256_t a)
 	return a[0] & 0x01;
 }
 
-// return 0 if no point for given x coordinate
-int sm2_z256_point_from_x_bytes(SM2_Z256_POINT *P, const uint8_t x_bytes[32], int y_is_odd)
-{
-	// mont(3), i.e. mont(-b)
-	const uint64_t SM2_Z256_MODP_MONT_THREE[4] = {
-		0x0000000000000003, 0x00000002fffffffd, 0x0000000000000000, 0x0000000300000000
-	};
+// mont(3), i.e. mont(-b)
+static const uint64_t SM2_Z256_MODP_MONT_THREE[4] = {
+	0x0000000000000003, 0x00000002fffffffd, 0x0000000000000000, 0x0000000300000000
+};
 
+// P->X = mont(x), y_sqr = mont(x^3 - 3x + b), -1 if x >= p
+static int point_set_x_bytes(SM2_Z256_POINT *P, sm2_z256_t y_sqr, const uint8_t x_bytes[32])
+{
 	sm2_z256_t x;
-	sm2_z256_t y;
-	sm2_z256_t y_sqr;
-	int ret;
 
 	sm2_z256_from_bytes(x, x_bytes);
 	if (sm2_z256_cmp(x, SM2_Z256_P) >= 0) {
-		error_print();
 		return -1;
 	}
 	sm2_z256_modp_to_mont(x, x);
@@ -1786,28 +2367,46 @@ int sm2_z256_point_from_x_bytes(SM2_Z256_POINT *P, const uint8_t x_bytes[32], in
 	sm2_z256_modp_sub(y_sqr, y_sqr, SM2_Z256_MODP_MONT_THREE);
 	sm2_z256_modp_mont_mul(y_sqr, y_sqr, x);
 	sm2_z256_modp_add(y_sqr, y_sqr, SM2_Z256_MODP_MONT_B);
+	return 1;
+}
 
-	// y = sqrt(y^2)
-	if ((ret = sm2_z256_modp_mont_sqrt(y, y_sqr)) != 1) {
-		if (ret < 0) error_print();
-		return ret;
+// P->Y = mont(y) or -mont(y) of the given parity
+static void point_set_y_parity(SM2_Z256_POINT *P, const sm2_z256_t y, int y_is_odd)
+{
+	sm2_z256_t t;
+
+	sm2_z256_copy(P->Y, y);
+	sm2_z256_modp_from_mont(t, y);
+	if ((sm2_z256_is_odd(t) != 0) != (y_is_odd != 0)) {
+		sm2_z256_modp_neg(P->Y, P->Y);
 	}
+	sm2_z256_copy(P->Z, SM2_Z256_MODP_MONT_ONE);
+}
+
+// return 0 if no point for given x coordinate
+int sm2_z256_point_from_x_bytes(SM2_Z256_POINT *P, const uint8_t x_bytes[32], int y_is_odd)
+{
+	sm2_z256_t y;
+	sm2_z256_t y_sqr;
+	int ret;
 
-	sm2_z256_copy(P->Y , y); // mont(y)
+	if (point_set_x_bytes(P, y_sqr, x_bytes) != 1) {
+		error_print();
+		return -1;
+	}
 
-	sm2_z256_modp_from_mont(y, y);
-	if (y_is_odd) {
-		if (!sm2_z256_is_odd(y)) {
-			sm2_z256_modp_neg(P->Y, P->Y);
-		}
-	} else {
-		if (sm2_z256_is_odd(y)) {
-			sm2_z256_modp_neg(P->Y, P->Y);
-		}
+	// the encoding is public, most x without a point are rejected before the exponentiation
+	if (sm2_z256_modp_mont_jacobi_vartime(y_sqr) < 0) {
+		return 0;
 	}
 
-	sm2_z256_copy(P->Z, SM2_Z256_MODP_MONT_ONE);
+	// y = sqrt(y^2)
+	if ((ret = sm2_z256_modp_mont_sqrt(y, y_sqr)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
 
+	point_set_y_parity(P, y, y_is_odd);
 	return 1;
 }
 
@@ -1865,7 +2464,7 @@ int sm2_z256_point_to_compressed_octets(const SM2_Z256_POINT *P, uint8_t out[33]
 	} else {
 		out[0] = SM2_point_compressed_y_even;
 	}
-	sm2_z256_to_bytes(y, out + 1);
+	sm2_z256_to_bytes(x, out + 1);
 
 	return 1;
 }
@@ -1931,6 +2530,81 @@ int sm2_z256_point_from_octets(SM2_Z256_POINT *P, const uint8_t *in, size_t inle
 	return 1;
 }
 
+/*
+ * Up to SQRT_MAX_LANES compressed points are decompressed together, their
+ * square roots share the passes of the addition chain. The check of the root
+ * against x^3 - 3x + b is the on-curve check, uncompressed points are checked
+ * with Z = 1. No inversion is needed. The Jacobi pre-check of
+ * sm2_z256_point_from_x_bytes() is skipped, as bulk input is expected to be
+ * valid and the check would only add to every point.
+ */
+int sm2_z256_points_from_octets_batch(SM2_Z256_POINT *P, const uint8_t *const *in, const size_t *inlen,
+	size_t n, int *ok)
+{
+	sm2_z256_t y_sqr[SQRT_MAX_LANES];
+	sm2_z256_t y[SQRT_MAX_LANES];
+	sm2_z256_t t;
+	size_t idx[SQRT_MAX_LANES];
+	int y_is_odd[SQRT_MAX_LANES];
+	size_t lanes = 0;
+	size_t i, j;
+	int valid;
+	int ret = 1;
+
+	if (n && (!P || !in || !inlen)) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < n; i++) {
+		valid = 0;
+		if (!in[i] || !inlen[i]) {
+			// invalid
+		} else if (in[i][0] == SM2_point_at_infinity) {
+			if (inlen[i] == 1) {
+				sm2_z256_point_set_infinity(&P[i]);
+				valid = 1;
+			}
+		} else if (in[i][0] == SM2_point_compressed_y_even || in[i][0] == SM2_point_compressed_y_odd) {
+			// valid until the square root is checked
+			if (inlen[i] == 33 && point_set_x_bytes(&P[i], y_sqr[lanes], in[i] + 1) == 1) {
+				idx[lanes] = i;
+				y_is_odd[lanes] = in[i][0] == SM2_point_compressed_y_odd;
+				lanes++;
+				valid = 1;
+			}
+		} else if (in[i][0] == SM2_point_uncompressed) {
+			if (inlen[i] == 65) {
+				// also checks the point is on the curve
+				valid = sm2_z256_point_from_bytes(&P[i], in[i] + 1) == 1;
+			}
+		}
+		if (!valid) {
+			sm2_z256_point_set_infinity(&P[i]);
+			ret = 0;
+		}
+		if (ok) {
+			ok[i] = valid;
+		}
+
+		if (lanes == SQRT_MAX_LANES || (lanes && i + 1 == n)) {
+			modp_mont_sqrt_exp_lanes(y, (const sm2_z256_t *)y_sqr, lanes);
+			for (j = 0; j < lanes; j++) {
+				sm2_z256_modp_mont_sqr(t, y[j]);
+				if (sm2_z256_cmp(t, y_sqr[j]) != 0) {
+					sm2_z256_point_set_infinity(&P[idx[j]]);
+					if (ok) ok[idx[j]] = 0;
+					ret = 0;
+					continue;
+				}
+				point_set_y_parity(&P[idx[j]], y[j], y_is_odd[j]);
+			}
+			lanes = 0;
+		}
+	}
+	return ret;
+}
+
 int sm2_z256_point_to_der(const SM2_Z256_POINT *P, uint8_t **out, size_t *outlen)
 {
 	uint8_t octets[65];
@@ -0,0 +1,464 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <immintrin.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/sm2_z256_x8_ifma.h>
+
+
+/*
+ * SM2 field arithmetic in the 8 lanes of AVX-512 IFMA
+ *
+ * An element is 5 limbs of 52 bits, v[j] holds limb j of the 8 lanes, and is
+ * kept in Montgomery form with R = 2^260. VPMADD52LUQ/VPMADD52HUQ add the low
+ * and high 52 bits of the 104-bit limb products to 64-bit accumulators, so
+ * the carries are propagated once at the end of a multiplication.
+ *
+ * All the values are kept in [0, 2p) with normalized limbs: a Montgomery
+ * product of inputs below 2p is below (2p)^2/2^260 + p < 2p, additions and
+ * subtractions subtract 2p when the result is not below 2p.
+ *
+ * The 64-bit limb Montgomery form x * 2^256 of sm2_z256 is converted with a
+ * multiplication by 2^264 mod p, and back with a multiplication by 2^256 mod p.
+ */
+
+#define MASK52		_mm512_set1_epi64(0xfffffffffffff)
+#define MADDLO(a,b,c)	_mm512_madd52lo_epu64((a), (b), (c))
+#define MADDHI(a,b,c)	_mm512_madd52hi_epu64((a), (b), (c))
+
+typedef __m512i fe8_t[5];
+
+typedef struct {
+	fe8_t X;
+	fe8_t Y;
+	fe8_t Z;
+} SM2_Z256_POINT_X8;
+
+static const uint64_t P52[5] = {
+	0xfffffffffffff, 0xff00000000fff, 0xfffffffffffff, 0xfffffffffffff, 0x0fffffffeffff,
+};
+static const uint64_t P52_2[5] = { // 2p
+	0xffffffffffffe, 0xfe00000001fff, 0xfffffffffffff, 0xfffffffffffff, 0x1fffffffdffff,
+};
+#define P(j)	_mm512_set1_epi64((long long)P52[j])
+#define P2(j)	_mm512_set1_epi64((long long)P52_2[j])
+
+
+static void fe_from_z256(uint64_t r[5], const uint64_t a[4])
+{
+	r[0] = a[0] & 0xfffffffffffff;
+	r[1] = ((a[0] >> 52) | (a[1] << 12)) & 0xfffffffffffff;
+	r[2] = ((a[1] >> 40) | (a[2] << 24)) & 0xfffffffffffff;
+	r[3] = ((a[2] >> 28) | (a[3] << 36)) & 0xfffffffffffff;
+	r[4] = a[3] >> 16;
+}
+
+static void fe_to_z256(uint64_t r[4], const uint64_t a[5])
+{
+	r[0] = a[0] | (a[1] << 52);
+	r[1] = (a[1] >> 12) | (a[2] << 40);
+	r[2] = (a[2] >> 24) | (a[3] << 28);
+	r[3] = (a[3] >> 36) | (a[4] << 16);
+}
+
+static void fe_set1(fe8_t r, const uint64_t a[4])
+{
+	uint64_t t[5];
+	int j;
+
+	fe_from_z256(t, a);
+	for (j = 0; j < 5; j++) {
+		r[j] = _mm512_set1_epi64((long long)t[j]);
+	}
+}
+
+// signed limbs to [0, 2^52), the top limb keeps the rest
+static void fe_normalize(fe8_t r)
+{
+	const __m512i mask = MASK52;
+	int j;
+
+	for (j = 0; j < 4; j++) {
+		r[j + 1] = _mm512_add_epi64(r[j + 1], _mm512_srai_epi64(r[j], 52));
+		r[j] = _mm512_and_si512(r[j], mask);
+	}
+}
+
+// r = a < 2p ? a : a - 2p, a normalized and in [0, 4p)
+static void fe_reduce_2p(fe8_t r, const fe8_t a)
+{
+	fe8_t t;
+	__mmask8 borrow;
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		t[j] = _mm512_sub_epi64(a[j], P2(j));
+	}
+	fe_normalize(t);
+	borrow = _mm512_cmplt_epi64_mask(t[4], _mm512_setzero_si512());
+	for (j = 0; j < 5; j++) {
+		r[j] = _mm512_mask_blend_epi64(borrow, t[j], a[j]);
+	}
+}
+
+static void fe_add(fe8_t r, const fe8_t a, const fe8_t b)
+{
+	fe8_t t;
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		t[j] = _mm512_add_epi64(a[j], b[j]);
+	}
+	fe_normalize(t);
+	fe_reduce_2p(r, t);
+}
+
+static void fe_sub(fe8_t r, const fe8_t a, const fe8_t b)
+{
+	fe8_t t;
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		t[j] = _mm512_add_epi64(_mm512_sub_epi64(a[j], b[j]), P2(j));
+	}
+	fe_normalize(t);
+	fe_reduce_2p(r, t);
+}
+
+/*
+ * Operand scanning Montgomery multiplication. As p = -1 mod 2^64 the
+ * multiplier of each step m = t0 * (-p^-1) mod 2^52 is just t0 mod 2^52.
+ */
+static void fe_mul(fe8_t r, const fe8_t a, const fe8_t b)
+{
+	const __m512i mask = MASK52;
+	__m512i t0, t1, t2, t3, t4, t5, m;
+	int i;
+
+	t0 = t1 = t2 = t3 = t4 = t5 = _mm512_setzero_si512();
+
+	for (i = 0; i < 5; i++) {
+		t0 = MADDLO(t0, a[0], b[i]);
+		t1 = MADDHI(t1, a[0], b[i]);
+		t1 = MADDLO(t1, a[1], b[i]);
+		t2 = MADDHI(t2, a[1], b[i]);
+		t2 = MADDLO(t2, a[2], b[i]);
+		t3 = MADDHI(t3, a[2], b[i]);
+		t3 = MADDLO(t3, a[3], b[i]);
+		t4 = MADDHI(t4, a[3], b[i]);
+		t4 = MADDLO(t4, a[4], b[i]);
+		t5 = MADDHI(t5, a[4], b[i]);
+
+		m = _mm512_and_si512(t0, mask);
+		t0 = MADDLO(t0, m, P(0));
+		t1 = MADDHI(t1, m, P(0));
+		t1 = MADDLO(t1, m, P(1));
+		t2 = MADDHI(t2, m, P(1));
+		t2 = MADDLO(t2, m, P(2));
+		t3 = MADDHI(t3, m, P(2));
+		t3 = MADDLO(t3, m, P(3));
+		t4 = MADDHI(t4, m, P(3));
+		t4 = MADDLO(t4, m, P(4));
+		t5 = MADDHI(t5, m, P(4));
+
+		// t0 is a multiple of 2^52 now
+		t0 = _mm512_add_epi64(t1, _mm512_srli_epi64(t0, 52));
+		t1 = t2;
+		t2 = t3;
+		t3 = t4;
+		t4 = t5;
+		t5 = _mm512_setzero_si512();
+	}
+
+	r[0] = t0;
+	r[1] = t1;
+	r[2] = t2;
+	r[3] = t3;
+	r[4] = t4;
+	fe_normalize(r);
+}
+
+// lanes where a = 0 (mod p), i.e. a is 0 or p
+static __mmask8 fe_is_zero(const fe8_t a)
+{
+	__mmask8 zero = 0xff;
+	__mmask8 is_p = 0xff;
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		zero &= _mm512_cmpeq_epi64_mask(a[j], _mm512_setzero_si512());
+		is_p &= _mm512_cmpeq_epi64_mask(a[j], P(j));
+	}
+	return zero | is_p;
+}
+
+static void fe_blend(fe8_t r, __mmask8 k, const fe8_t a, const fe8_t b)
+{
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		r[j] = _mm512_mask_blend_epi64(k, a[j], b[j]);
+	}
+}
+
+// dbl-2001-b with a = -3, Z3 = 2 * Y * Z
+static void point_dbl_x8(SM2_Z256_POINT_X8 *R, const SM2_Z256_POINT_X8 *A)
+{
+	fe8_t delta, gamma, beta, alpha, t;
+
+	fe_mul(delta, A->Z, A->Z);
+	fe_mul(gamma, A->Y, A->Y);
+	fe_mul(beta, A->X, gamma);
+
+	// alpha = 3 * (X - delta) * (X + delta)
+	fe_sub(t, A->X, delta);
+	fe_add(alpha, A->X, delta);
+	fe_mul(alpha, alpha, t);
+	fe_add(t, alpha, alpha);
+	fe_add(alpha, alpha, t);
+
+	// Z3 = 2 * Y * Z
+	fe_mul(t, A->Y, A->Z);
+	fe_add(R->Z, t, t);
+
+	// X3 = alpha^2 - 8 * beta
+	fe_add(beta, beta, beta);
+	fe_add(beta, beta, beta);
+	fe_mul(t, alpha, alpha);
+	fe_sub(t, t, beta);
+	fe_sub(R->X, t, beta);
+
+	// Y3 = alpha * (4 * beta - X3) - 8 * gamma^2
+	fe_sub(beta, beta, R->X);
+	fe_mul(gamma, gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_add(gamma, gamma, gamma);
+	fe_mul(t, alpha, beta);
+	fe_sub(R->Y, t, gamma);
+}
+
+/*
+ * R = A + B for the lanes in k, the other lanes keep A. Lanes of A in inf are
+ * the point at infinity and take B. Returns the lanes where A = +-B, for which
+ * the addition formulas do not hold.
+ */
+static __mmask8 point_add_x8(SM2_Z256_POINT_X8 *R, const SM2_Z256_POINT_X8 *A,
+	const SM2_Z256_POINT_X8 *B, __mmask8 k, __mmask8 inf)
+{
+	fe8_t Z1Z1, Z2Z2, U1, U2, S1, S2, H, HH, HHH, r, V, t;
+	fe8_t X3, Y3, Z3;
+	__mmask8 bad;
+
+	fe_mul(Z1Z1, A->Z, A->Z);
+	fe_mul(Z2Z2, B->Z, B->Z);
+	fe_mul(U1, A->X, Z2Z2);
+	fe_mul(U2, B->X, Z1Z1);
+	fe_mul(S1, A->Y, B->Z);
+	fe_mul(S1, S1, Z2Z2);
+	fe_mul(S2, B->Y, A->Z);
+	fe_mul(S2, S2, Z1Z1);
+	fe_sub(H, U2, U1);
+	fe_sub(r, S2, S1);
+
+	bad = fe_is_zero(H) & k & ~inf;
+
+	fe_mul(HH, H, H);
+	fe_mul(HHH, HH, H);
+	fe_mul(V, U1, HH);
+
+	// X3 = r^2 - H^3 - 2 * V
+	fe_mul(t, r, r);
+	fe_sub(t, t, HHH);
+	fe_sub(t, t, V);
+	fe_sub(X3, t, V);
+
+	// Y3 = r * (V - X3) - S1 * H^3
+	fe_sub(t, V, X3);
+	fe_mul(t, r, t);
+	fe_mul(S1, S1, HHH);
+	fe_sub(Y3, t, S1);
+
+	// Z3 = Z1 * Z2 * H
+	fe_mul(t, A->Z, B->Z);
+	fe_mul(Z3, t, H);
+
+	fe_blend(X3, inf, X3, B->X);
+	fe_blend(Y3, inf, Y3, B->Y);
+	fe_blend(Z3, inf, Z3, B->Z);
+	fe_blend(R->X, k, A->X, X3);
+	fe_blend(R->Y, k, A->Y, Y3);
+	fe_blend(R->Z, k, A->Z, Z3);
+
+	return bad;
+}
+
+#define TABLE_ENTRY	15 // X, Y, Z of 5 limbs
+
+// entries of 8 tables, index[i] = (lane * 16 + |digit| - 1) * TABLE_ENTRY, Y negated where neg
+static void table_select_x8(SM2_Z256_POINT_X8 *R, const uint64_t *table, __m512i index,
+	__mmask8 neg)
+{
+	const fe8_t zero = {0};
+	int j;
+
+	for (j = 0; j < 5; j++) {
+		R->X[j] = _mm512_i64gather_epi64(_mm512_add_epi64(index, _mm512_set1_epi64(j)), table, 8);
+		R->Y[j] = _mm512_i64gather_epi64(_mm512_add_epi64(index, _mm512_set1_epi64(5 + j)), table, 8);
+		R->Z[j] = _mm512_i64gather_epi64(_mm512_add_epi64(index, _mm512_set1_epi64(10 + j)), table, 8);
+	}
+	if (neg) {
+		fe8_t Y;
+		fe_sub(Y, zero, R->Y);
+		fe_blend(R->Y, neg, R->Y, Y);
+	}
+}
+
+// multiply the 5-limb elements in place by c, n a multiple of 8
+static void table_mul_x8(uint64_t *table, size_t n, const fe8_t c)
+{
+	const __m512i stride = _mm512_set_epi64(35, 30, 25, 20, 15, 10, 5, 0);
+	fe8_t a;
+	size_t i;
+	int j;
+
+	for (i = 0; i < n; i += 8) {
+		for (j = 0; j < 5; j++) {
+			a[j] = _mm512_i64gather_epi64(_mm512_add_epi64(stride, _mm512_set1_epi64(j)), table + 5 * i, 8);
+		}
+		fe_mul(a, a, c);
+		for (j = 0; j < 5; j++) {
+			_mm512_i64scatter_epi64(table + 5 * i, _mm512_add_epi64(stride, _mm512_set1_epi64(j)), a[j], 8);
+		}
+	}
+}
+
+static void table_load(uint64_t *table, const SM2_Z256_POINT T[16])
+{
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		fe_from_z256(table + i * TABLE_ENTRY, T[i].X);
+		fe_from_z256(table + i * TABLE_ENTRY + 5, T[i].Y);
+		fe_from_z256(table + i * TABLE_ENTRY + 10, T[i].Z);
+	}
+}
+
+static void fe_store_lanes(uint64_t r[8][4], const fe8_t a)
+{
+	uint64_t limbs[5][8];
+	uint64_t t[5];
+	int i, j;
+
+	for (j = 0; j < 5; j++) {
+		_mm512_storeu_si512((__m512i *)limbs[j], a[j]);
+	}
+	for (i = 0; i < 8; i++) {
+		for (j = 0; j < 5; j++) {
+			t[j] = limbs[j][i];
+		}
+		fe_to_z256(r[i], t);
+		if (sm2_z256_cmp(r[i], sm2_z256_prime()) >= 0) {
+			sm2_z256_sub(r[i], r[i], sm2_z256_prime());
+		}
+	}
+}
+
+unsigned int sm2_z256_point_mul_sum_x8(SM2_Z256_POINT R[8],
+	const uint64_t s[8][4], const uint64_t t[8][4],
+	const SM2_Z256_POINT G_table[16], const SM2_Z256_POINT *const P_tables[8])
+{
+	const int window_size = 5;
+	const int n = (256 + window_size - 1)/window_size;
+	uint64_t g_table[16 * TABLE_ENTRY];
+	uint64_t p_table[8 * 16 * TABLE_ENTRY];
+	SM2_Z256_POINT_X8 acc, T;
+	fe8_t c;
+	uint64_t x[8][4], y[8][4], z[8][4];
+	__mmask8 inf = 0xff;
+	__mmask8 bad = 0;
+	sm2_z256_t one;
+	int i, j, w;
+
+	memset(&acc, 0, sizeof(acc));
+
+	// to Montgomery form of R = 2^260, c = 2^264 mod p
+	sm2_z256_modp_to_mont(sm2_z256_one(), one);
+	for (i = 0; i < 8; i++) {
+		sm2_z256_modp_dbl(one, one);
+	}
+	fe_set1(c, one);
+	table_load(g_table, G_table);
+	table_mul_x8(g_table, 16 * 3, c);
+	for (i = 0; i < 8; i++) {
+		table_load(p_table + i * 16 * TABLE_ENTRY, P_tables[i]);
+	}
+	table_mul_x8(p_table, 8 * 16 * 3, c);
+
+	for (w = n - 1; w >= 0; w--) {
+		int64_t g_index[8], p_index[8];
+		__mmask8 g_mask = 0, g_neg = 0, p_mask = 0, p_neg = 0;
+
+		if (inf != 0xff) {
+			for (j = 0; j < window_size; j++) {
+				point_dbl_x8(&acc, &acc);
+			}
+		}
+
+		for (i = 0; i < 8; i++) {
+			int booth = sm2_z256_get_booth(s[i], window_size, w);
+			if (booth) {
+				g_mask |= 1 << i;
+				g_neg |= (booth < 0) << i;
+			}
+			g_index[i] = booth ? ((booth < 0 ? -booth : booth) - 1) * TABLE_ENTRY : 0;
+
+			booth = sm2_z256_get_booth(t[i], window_size, w);
+			if (booth) {
+				p_mask |= 1 << i;
+				p_neg |= (booth < 0) << i;
+			}
+			p_index[i] = (i * 16 + (booth ? (booth < 0 ? -booth : booth) - 1 : 0)) * TABLE_ENTRY;
+		}
+
+		if (g_mask) {
+			table_select_x8(&T, g_table, _mm512_loadu_si512((const __m512i *)g_index), g_neg);
+			bad |= point_add_x8(&acc, &acc, &T, g_mask, inf);
+			inf &= ~g_mask;
+		}
+		if (p_mask) {
+			table_select_x8(&T, p_table, _mm512_loadu_si512((const __m512i *)p_index), p_neg);
+			bad |= point_add_x8(&acc, &acc, &T, p_mask, inf);
+			inf &= ~p_mask;
+		}
+	}
+
+	// back to 2^256 Montgomery form
+	sm2_z256_modp_to_mont(sm2_z256_one(), one);
+	fe_set1(c, one);
+	fe_mul(acc.X, acc.X, c);
+	fe_mul(acc.Y, acc.Y, c);
+	fe_mul(acc.Z, acc.Z, c);
+	fe_store_lanes(x, acc.X);
+	fe_store_lanes(y, acc.Y);
+	fe_store_lanes(z, acc.Z);
+
+	for (i = 0; i < 8; i++) {
+		if (inf & (1 << i)) {
+			memset(&R[i], 0, sizeof(SM2_Z256_POINT));
+		} else {
+			sm2_z256_copy(R[i].X, x[i]);
+			sm2_z256_copy(R[i].Y, y[i]);
+			sm2_z256_copy(R[i].Z, z[i]);
+		}
+	}
+	return bad;
+}
@@ -0,0 +1,231 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
+
+
+// point additions of the 16-point table and the 52 windows of every point
+#define STRAUS_POINT_COST	67
+
+// the window of the fewest additions, a bucket costs 2 additions when the window is summed
+static int pippenger_window_size(size_t n, size_t *cost)
+{
+	size_t best = SIZE_MAX;
+	int best_c = 2;
+	int c;
+
+	for (c = 2; c <= SM2_Z256_MSM_MAX_WINDOW_SIZE; c++) {
+		size_t windows = (256 + c) / c;
+		size_t adds = windows * (n + ((size_t)1 << c));
+		if (adds < best) {
+			best = adds;
+			best_c = c;
+		}
+	}
+	if (cost) {
+		*cost = best;
+	}
+	return best_c;
+}
+
+int sm2_z256_point_multi_mul_pippenger(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n,
+	int window_size)
+{
+	SM2_Z256_POINT *buckets;
+	uint8_t *used;
+	SM2_Z256_POINT running;
+	SM2_Z256_POINT sum;
+	size_t buckets_num;
+	size_t j, b;
+	int R_infinity = 1;
+	int windows;
+	int i, c;
+
+	if (!R || (n && (!k || !P))) {
+		error_print();
+		return -1;
+	}
+	if (window_size && (window_size < 2 || window_size > SM2_Z256_MSM_MAX_WINDOW_SIZE)) {
+		error_print();
+		return -1;
+	}
+	if (!n) {
+		sm2_z256_point_set_infinity(R);
+		return 1;
+	}
+	window_size = window_size ? window_size : pippenger_window_size(n, NULL);
+	windows = (256 + window_size) / window_size;
+	buckets_num = (size_t)1 << (window_size - 1);
+
+	if (!(buckets = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * buckets_num))) {
+		error_print();
+		return -1;
+	}
+	if (!(used = (uint8_t *)malloc(buckets_num))) {
+		free(buckets);
+		error_print();
+		return -1;
+	}
+
+	for (i = windows - 1; i >= 0; i--) {
+		int running_infinity = 1;
+		int sum_infinity = 1;
+
+		// bucket d - 1 holds the points of the digit +/-d
+		memset(used, 0, buckets_num);
+		for (j = 0; j < n; j++) {
+			int booth = sm2_z256_get_booth(k[j], window_size, i);
+
+			if (booth > 0) {
+				b = booth - 1;
+				if (used[b]) {
+					sm2_z256_point_add(&buckets[b], &buckets[b], &P[j]);
+				} else {
+					buckets[b] = P[j];
+					used[b] = 1;
+				}
+			} else if (booth < 0) {
+				b = -booth - 1;
+				if (used[b]) {
+					sm2_z256_point_sub(&buckets[b], &buckets[b], &P[j]);
+				} else {
+					sm2_z256_point_neg(&buckets[b], &P[j]);
+					used[b] = 1;
+				}
+			}
+		}
+
+		// sum = 1*B[0] + 2*B[1] + ..., the running sum from the top bucket is added once per bucket
+		for (b = buckets_num; b > 0; b--) {
+			if (used[b - 1]) {
+				if (running_infinity) {
+					running = buckets[b - 1];
+					running_infinity = 0;
+				} else {
+					sm2_z256_point_add(&running, &running, &buckets[b - 1]);
+				}
+			}
+			if (!running_infinity) {
+				if (sum_infinity) {
+					sum = running;
+					sum_infinity = 0;
+				} else {
+					sm2_z256_point_add(&sum, &sum, &running);
+				}
+			}
+		}
+
+		if (!R_infinity) {
+			for (c = 0; c < window_size; c++) {
+				sm2_z256_point_dbl(R, R);
+			}
+		}
+		if (!sum_infinity) {
+			if (R_infinity) {
+				*R = sum;
+				R_infinity = 0;
+			} else {
+				sm2_z256_point_add(R, R, &sum);
+			}
+		}
+	}
+
+	if (R_infinity) {
+		sm2_z256_point_set_infinity(R);
+	}
+	free(buckets);
+	free(used);
+	return 1;
+}
+
+int sm2_z256_point_multi_mul(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n)
+{
+	size_t cost;
+	int window_size;
+
+	window_size = pippenger_window_size(n, &cost);
+	if (n < SIZE_MAX / STRAUS_POINT_COST && cost < STRAUS_POINT_COST * n) {
+		return sm2_z256_point_multi_mul_pippenger(R, k, P, n, window_size);
+	}
+	return sm2_z256_point_multi_mul_straus(R, k, P, n);
+}
+
+typedef struct {
+	SM2_Z256_POINT R;
+	const uint64_t (*k)[4];
+	const SM2_Z256_POINT *P;
+	size_t n;
+	int ret;
+} SM2_Z256_MSM_JOB;
+
+static void sm2_z256_msm_job(SM2_Z256_MSM_JOB *job)
+{
+	job->ret = sm2_z256_point_multi_mul(&job->R, job->k, job->P, job->n);
+}
+
+static void sm2_z256_msm_task(void *arg)
+{
+	sm2_z256_msm_job((SM2_Z256_MSM_JOB *)arg);
+}
+
+// the partial sums of the ranges of points are added at the end
+int sm2_z256_point_multi_mul_threads(SM2_Z256_POINT *R, const sm2_z256_t *k, const SM2_Z256_POINT *P, size_t n,
+	int threads)
+{
+	SM2_Z256_MSM_JOB jobs[SM2_Z256_MSM_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (!R || (n && (!k || !P))) {
+		error_print();
+		return -1;
+	}
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM2_Z256_MSM_MAX_THREADS) {
+		threads = SM2_Z256_MSM_MAX_THREADS;
+	}
+	if ((size_t)threads > n / SM2_Z256_MSM_THREAD_MIN_POINTS) {
+		threads = n / SM2_Z256_MSM_THREAD_MIN_POINTS ? (int)(n / SM2_Z256_MSM_THREAD_MIN_POINTS) : 1;
+	}
+	if (threads == 1) {
+		return sm2_z256_point_multi_mul(R, k, P, n);
+	}
+
+	for (i = 0; i < threads; i++) {
+		size_t first = (n * i) / threads;
+		size_t last = (n * (i + 1)) / threads;
+		jobs[i].k = k + first;
+		jobs[i].P = P + first;
+		jobs[i].n = last - first;
+		jobs[i].ret = -1;
+	}
+	gmssl_thread_pool_run(sm2_z256_msm_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	*R = jobs[0].R;
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		} else if (i) {
+			sm2_z256_point_add(R, R, &jobs[i].R);
+		}
+	}
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
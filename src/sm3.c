@@ -10,8 +10,10 @@
 
 #include <string.h>
 #include <gmssl/sm3.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 
 
 #define P0(x) ((x) ^ ROL32((x), 9) ^ ROL32((x),17))
@@ -43,7 +45,7 @@ static uint32_t K[64] = {
 };
 
 #if ENABLE_SMALL_FOOTPRINT
-void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+static void sm3_generic_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 {
 	uint32_t A;
 	uint32_t B;
@@ -154,7 +156,7 @@ void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 	H = P0(SS1);					\
 	F = ROL32(F, 19);
 
-void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+static void sm3_generic_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 {
 	uint32_t A;
 	uint32_t B;
@@ -262,6 +264,54 @@ void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 }
 #endif
 
+
+/*
+ * Runtime selection of the compression function
+ *
+ * With ENABLE_SM3_CE the ARMv8.2 SM3 instructions are used when the CPU
+ * reports them, see `gmssl_cpu_features`, the code above is the fallback.
+ * On x86 the AVX-512VL variant of sm3_avx2_x1.c is used, it moves the message
+ * expansion out of the rounds. The AVX2 variant pays three instructions for a
+ * vector rotation and is not faster than the code above, it is not selected.
+ */
+
+typedef void (*sm3_compress_blocks_func)(uint32_t digest[8], const uint8_t *data, size_t blocks);
+
+static sm3_compress_blocks_func sm3_compress_blocks_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sm3_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	sm3_compress_blocks_func compress_blocks = sm3_generic_compress_blocks;
+
+	(void)cpu;
+
+#ifdef ENABLE_SM3_CE
+	if (cpu & GMSSL_CPU_ARM_SM3) {
+		compress_blocks = sm3_ce_compress_blocks;
+	}
+#endif
+#if defined(ENABLE_SM3_AVX2) && defined(ENABLE_SM3_AVX512)
+	if ((cpu & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512VL|GMSSL_CPU_BMI2))
+		== (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512VL|GMSSL_CPU_BMI2)) {
+		compress_blocks = sm3_avx512_compress_blocks;
+	}
+#endif
+
+	sm3_compress_blocks_impl = compress_blocks;
+}
+
+void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+	if (!sm3_compress_blocks_impl) {
+		sm3_dispatch_init();
+	}
+	sm3_compress_blocks_impl(digest, data, blocks);
+}
+
 void sm3_init(SM3_CTX *ctx)
 {
 	memset(ctx, 0, sizeof(*ctx));
@@ -309,6 +359,67 @@ void sm3_update(SM3_CTX *ctx, const uint8_t *data, size_t data_len)
 	}
 }
 
+void sm3_updatev(SM3_CTX *ctx, const SM3_IOVEC *iov, size_t iovcnt)
+{
+	uint8_t buf[SM3_BLOCK_SIZE * SM3_UPDATEV_BLOCKS];
+	size_t buflen;
+	const uint8_t *data;
+	size_t datalen;
+	size_t blocks;
+	size_t len;
+
+	// the buffered bytes start the staged blocks
+	ctx->num &= 0x3f;
+	memcpy(buf, ctx->block, ctx->num);
+	buflen = ctx->num;
+
+	for (; iovcnt; iov++, iovcnt--) {
+		data = (const uint8_t *)iov->base;
+		datalen = iov->len;
+
+		while (datalen) {
+			// at a block boundary, the whole blocks of the buffer are compressed in place
+			if (buflen % SM3_BLOCK_SIZE == 0 && datalen >= SM3_BLOCK_SIZE) {
+				if (buflen) {
+					sm3_compress_blocks(ctx->digest, buf, buflen / SM3_BLOCK_SIZE);
+					ctx->nblocks += buflen / SM3_BLOCK_SIZE;
+					buflen = 0;
+				}
+				blocks = datalen / SM3_BLOCK_SIZE;
+				sm3_compress_blocks(ctx->digest, data, blocks);
+				ctx->nblocks += blocks;
+				data += SM3_BLOCK_SIZE * blocks;
+				datalen -= SM3_BLOCK_SIZE * blocks;
+				continue;
+			}
+
+			len = sizeof(buf) - buflen;
+			if (len > datalen) {
+				len = datalen;
+			}
+			memcpy(buf + buflen, data, len);
+			buflen += len;
+			data += len;
+			datalen -= len;
+
+			if (buflen == sizeof(buf)) {
+				sm3_compress_blocks(ctx->digest, buf, SM3_UPDATEV_BLOCKS);
+				ctx->nblocks += SM3_UPDATEV_BLOCKS;
+				buflen = 0;
+			}
+		}
+	}
+
+	blocks = buflen / SM3_BLOCK_SIZE;
+	if (blocks) {
+		sm3_compress_blocks(ctx->digest, buf, blocks);
+		ctx->nblocks += blocks;
+	}
+	ctx->num = buflen % SM3_BLOCK_SIZE;
+	memcpy(ctx->block, buf + SM3_BLOCK_SIZE * blocks, ctx->num);
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
 void sm3_finish(SM3_CTX *ctx, uint8_t *digest)
 {
 	int i;
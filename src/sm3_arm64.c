@@ -12,6 +12,7 @@
 #include <gmssl/sm3.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 #include <arm_neon.h>
 
 
@@ -98,7 +99,7 @@ static uint32_t K[64] = {
 	vst1q_u32(W + j, words)
 
 
-void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+static void sm3_arm64_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 {
 	uint32_t A;
 	uint32_t B;
@@ -210,6 +211,45 @@ void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
 	}
 }
 
+
+/*
+ * Runtime selection of the compression function
+ *
+ * With ENABLE_SM3_CE the ARMv8.2 SM3 instructions are used when the CPU
+ * reports them, see `gmssl_cpu_features`, the code above is the fallback.
+ */
+
+typedef void (*sm3_compress_blocks_func)(uint32_t digest[8], const uint8_t *data, size_t blocks);
+
+static sm3_compress_blocks_func sm3_compress_blocks_impl = NULL;
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sm3_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	sm3_compress_blocks_func compress_blocks = sm3_arm64_compress_blocks;
+
+	(void)cpu;
+
+#ifdef ENABLE_SM3_CE
+	if (cpu & GMSSL_CPU_ARM_SM3) {
+		compress_blocks = sm3_ce_compress_blocks;
+	}
+#endif
+
+	sm3_compress_blocks_impl = compress_blocks;
+}
+
+void sm3_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+	if (!sm3_compress_blocks_impl) {
+		sm3_dispatch_init();
+	}
+	sm3_compress_blocks_impl(digest, data, blocks);
+}
+
 void sm3_init(SM3_CTX *ctx)
 {
 	memset(ctx, 0, sizeof(*ctx));
@@ -0,0 +1,213 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * Single-stream SM3 with AVX2 message expansion
+ *
+ * The expansion does not depend on the state, so W and W' = W[j] ^ W[j+4] of
+ * two blocks are computed in the two 128-bit lanes, four words per step. The
+ * last word of a step needs the first one (W[j+3] uses W[j]), as P1 is linear
+ * it is fixed with P1(W[j] <<< 15) after the step. The rounds are scalar, with
+ * -mbmi2 every rotation is a rorx that leaves its source alive. With AVX-512VL
+ * the rotations of the expansion are vprold.
+ */
+
+#include <string.h>
+#include <immintrin.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/endian.h>
+
+
+#define P0(x) ((x) ^ ROL32((x), 9) ^ ROL32((x),17))
+
+#define FF00(x,y,z)  ((x) ^ (y) ^ (z))
+#define FF16(x,y,z)  (((x)&(y)) | ((x)&(z)) | ((y)&(z)))
+#define GG00(x,y,z)  ((x) ^ (y) ^ (z))
+#define GG16(x,y,z)  ((((y)^(z)) & (x)) ^ (z))
+
+static const uint32_t K[64] = {
+	0x79cc4519U, 0xf3988a32U, 0xe7311465U, 0xce6228cbU,
+	0x9cc45197U, 0x3988a32fU, 0x7311465eU, 0xe6228cbcU,
+	0xcc451979U, 0x988a32f3U, 0x311465e7U, 0x6228cbceU,
+	0xc451979cU, 0x88a32f39U, 0x11465e73U, 0x228cbce6U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+	0x7a879d8aU, 0xf50f3b14U, 0xea1e7629U, 0xd43cec53U,
+	0xa879d8a7U, 0x50f3b14fU, 0xa1e7629eU, 0x43cec53dU,
+	0x879d8a7aU, 0x0f3b14f5U, 0x1e7629eaU, 0x3cec53d4U,
+	0x79d8a7a8U, 0xf3b14f50U, 0xe7629ea1U, 0xcec53d43U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+};
+
+/*
+ * W[4 * r + i] of the first block is in W[r][i], of the second block in
+ * W[r][4 + i], the same for W'. 17 rows hold W[0..67].
+ */
+typedef struct {
+	uint32_t W[17][8];
+	uint32_t Wp[16][8];
+} SM3_AVX2_SCHEDULE;
+
+#define VXOR(a,b)	_mm256_xor_si256((a), (b))
+
+// W[j..j+3] from x0..x3 = W[j-16..j-1]
+#define SM3_AVX2_W4(x0,x1,x2,x3,x4,VROL) do {					\
+		__m256i t, u;								\
+		t = VXOR(VXOR(x0, _mm256_alignr_epi8(x2, x1, 12)),			\
+			VROL(_mm256_srli_si256(x3, 4), 15));				\
+		t = VXOR(t, VXOR(VROL(t, 15), VROL(t, 23)));				\
+		x4 = VXOR(t, VXOR(VROL(_mm256_alignr_epi8(x1, x0, 12), 7),		\
+			_mm256_alignr_epi8(x3, x2, 8)));				\
+		u = VROL(_mm256_slli_si256(x4, 12), 15);				\
+		x4 = VXOR(x4, VXOR(u, VXOR(VROL(u, 15), VROL(u, 23))));		\
+	} while (0)
+
+#define SM3_AVX2_EXPAND(S,b0,b1,VROL) do {						\
+		const __m256i bswap = _mm256_setr_epi8(					\
+			3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12,			\
+			3,2,1,0, 7,6,5,4, 11,10,9,8, 15,14,13,12);			\
+		__m256i x[17];								\
+		int r;									\
+		for (r = 0; r < 4; r++) {						\
+			x[r] = _mm256_inserti128_si256(_mm256_castsi128_si256(		\
+				_mm_loadu_si128((const __m128i *)((b0) + 16 * r))),	\
+				_mm_loadu_si128((const __m128i *)((b1) + 16 * r)), 1);	\
+			x[r] = _mm256_shuffle_epi8(x[r], bswap);			\
+		}									\
+		for (r = 4; r < 17; r++) {						\
+			SM3_AVX2_W4(x[r - 4], x[r - 3], x[r - 2], x[r - 1], x[r], VROL);\
+		}									\
+		for (r = 0; r < 16; r++) {						\
+			_mm256_storeu_si256((__m256i *)(S)->W[r], x[r]);		\
+			_mm256_storeu_si256((__m256i *)(S)->Wp[r], VXOR(x[r], x[r + 1]));\
+		}									\
+		_mm256_storeu_si256((__m256i *)(S)->W[16], x[16]);			\
+	} while (0)
+
+#define VROL_AVX2(x,n)	_mm256_or_si256(_mm256_slli_epi32((x), (n)), _mm256_srli_epi32((x), 32 - (n)))
+
+static void sm3_avx2_expand(SM3_AVX2_SCHEDULE *S, const uint8_t *b0, const uint8_t *b1)
+{
+	SM3_AVX2_EXPAND(S, b0, b1, VROL_AVX2);
+}
+
+#ifdef ENABLE_SM3_AVX512
+#define VROL_AVX512(x,n)	_mm256_rol_epi32((x), (n))
+
+__attribute__((target("avx512f,avx512vl")))
+static void sm3_avx512_expand(SM3_AVX2_SCHEDULE *S, const uint8_t *b0, const uint8_t *b1)
+{
+	SM3_AVX2_EXPAND(S, b0, b1, VROL_AVX512);
+}
+#endif
+
+// W[j] and W'[j] of the lane `l` (0 or 4), added before A and E of the round are ready
+#define SM3_AVX2_ROUND(j,A,B,C,D,E,F,G,H,FF,GG)				\
+	D += S->Wp[(j) / 4][l + (j) % 4];					\
+	H += S->W[(j) / 4][l + (j) % 4];					\
+	SS0 = ROL32(A, 12);							\
+	SS1 = ROL32(SS0 + K[j] + E, 7);						\
+	D += FF(A, B, C);							\
+	H += GG(E, F, G);							\
+	D += SS1 ^ SS0;								\
+	H = P0(H + SS1);							\
+	B = ROL32(B, 9);							\
+	F = ROL32(F, 19)
+
+#define SM3_AVX2_ROUNDS4(j,FF,GG)						\
+	SM3_AVX2_ROUND((j) + 0, A,B,C,D, E,F,G,H, FF, GG);			\
+	SM3_AVX2_ROUND((j) + 1, D,A,B,C, H,E,F,G, FF, GG);			\
+	SM3_AVX2_ROUND((j) + 2, C,D,A,B, G,H,E,F, FF, GG);			\
+	SM3_AVX2_ROUND((j) + 3, B,C,D,A, F,G,H,E, FF, GG)
+
+// inlined with a constant `l`
+static inline __attribute__((always_inline)) void sm3_avx2_rounds(uint32_t digest[8], const SM3_AVX2_SCHEDULE *S, int l)
+{
+	uint32_t A = digest[0];
+	uint32_t B = digest[1];
+	uint32_t C = digest[2];
+	uint32_t D = digest[3];
+	uint32_t E = digest[4];
+	uint32_t F = digest[5];
+	uint32_t G = digest[6];
+	uint32_t H = digest[7];
+	uint32_t SS0, SS1;
+
+	SM3_AVX2_ROUNDS4( 0, FF00, GG00);
+	SM3_AVX2_ROUNDS4( 4, FF00, GG00);
+	SM3_AVX2_ROUNDS4( 8, FF00, GG00);
+	SM3_AVX2_ROUNDS4(12, FF00, GG00);
+	SM3_AVX2_ROUNDS4(16, FF16, GG16);
+	SM3_AVX2_ROUNDS4(20, FF16, GG16);
+	SM3_AVX2_ROUNDS4(24, FF16, GG16);
+	SM3_AVX2_ROUNDS4(28, FF16, GG16);
+	SM3_AVX2_ROUNDS4(32, FF16, GG16);
+	SM3_AVX2_ROUNDS4(36, FF16, GG16);
+	SM3_AVX2_ROUNDS4(40, FF16, GG16);
+	SM3_AVX2_ROUNDS4(44, FF16, GG16);
+	SM3_AVX2_ROUNDS4(48, FF16, GG16);
+	SM3_AVX2_ROUNDS4(52, FF16, GG16);
+	SM3_AVX2_ROUNDS4(56, FF16, GG16);
+	SM3_AVX2_ROUNDS4(60, FF16, GG16);
+
+	digest[0] ^= A;
+	digest[1] ^= B;
+	digest[2] ^= C;
+	digest[3] ^= D;
+	digest[4] ^= E;
+	digest[5] ^= F;
+	digest[6] ^= G;
+	digest[7] ^= H;
+}
+
+// an odd last block is expanded in both lanes
+void sm3_avx2_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+	SM3_AVX2_SCHEDULE S;
+
+	while (blocks >= 2) {
+		sm3_avx2_expand(&S, data, data + 64);
+		sm3_avx2_rounds(digest, &S, 0);
+		sm3_avx2_rounds(digest, &S, 4);
+		data += 128;
+		blocks -= 2;
+	}
+	if (blocks) {
+		sm3_avx2_expand(&S, data, data);
+		sm3_avx2_rounds(digest, &S, 0);
+	}
+	gmssl_secure_clear(&S, sizeof(S));
+}
+
+#ifdef ENABLE_SM3_AVX512
+__attribute__((target("avx512f,avx512vl")))
+void sm3_avx512_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+	SM3_AVX2_SCHEDULE S;
+
+	while (blocks >= 2) {
+		sm3_avx512_expand(&S, data, data + 64);
+		sm3_avx2_rounds(digest, &S, 0);
+		sm3_avx2_rounds(digest, &S, 4);
+		data += 128;
+		blocks -= 2;
+	}
+	if (blocks) {
+		sm3_avx512_expand(&S, data, data);
+		sm3_avx2_rounds(digest, &S, 0);
+	}
+	gmssl_secure_clear(&S, sizeof(S));
+}
+#endif
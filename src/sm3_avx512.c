@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <immintrin.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm3_x16_avx512.h>
+
+
+/*
+ * SM3 in the 16 lanes of AVX-512, VPROLD does the rotations and VPTERNLOGD
+ * the three input boolean functions.
+ */
+
+#define ROL(x,n)	_mm512_rol_epi32((x), (n))
+#define XOR3(x,y,z)	_mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+#define P0(x)		XOR3((x), ROL((x),  9), ROL((x), 17))
+#define P1(x)		XOR3((x), ROL((x), 15), ROL((x), 23))
+
+#define FF00(x,y,z)	XOR3((x), (y), (z))
+#define FF16(x,y,z)	_mm512_ternarylogic_epi32((x), (y), (z), 0xe8) // majority
+#define GG00(x,y,z)	XOR3((x), (y), (z))
+#define GG16(x,y,z)	_mm512_ternarylogic_epi32((x), (y), (z), 0xca) // x ? y : z
+
+
+static const uint32_t K[64] = {
+	0x79cc4519U, 0xf3988a32U, 0xe7311465U, 0xce6228cbU,
+	0x9cc45197U, 0x3988a32fU, 0x7311465eU, 0xe6228cbcU,
+	0xcc451979U, 0x988a32f3U, 0x311465e7U, 0x6228cbceU,
+	0xc451979cU, 0x88a32f39U, 0x11465e73U, 0x228cbce6U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+	0x7a879d8aU, 0xf50f3b14U, 0xea1e7629U, 0xd43cec53U,
+	0xa879d8a7U, 0x50f3b14fU, 0xa1e7629eU, 0x43cec53dU,
+	0x879d8a7aU, 0x0f3b14f5U, 0x1e7629eaU, 0x3cec53d4U,
+	0x79d8a7a8U, 0xf3b14f50U, 0xe7629ea1U, 0xcec53d43U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+};
+
+#define ROUND(j, FF, GG)						\
+	do {								\
+		SS2 = ROL(A, 12);					\
+		SS1 = ROL(_mm512_add_epi32(_mm512_add_epi32(SS2, E),	\
+			_mm512_set1_epi32(K[j])), 7);			\
+		SS2 = _mm512_xor_si512(SS2, SS1);			\
+		TT1 = _mm512_add_epi32(_mm512_add_epi32(FF(A, B, C), D), \
+			_mm512_add_epi32(SS2, _mm512_xor_si512(W[j], W[(j) + 4]))); \
+		TT2 = _mm512_add_epi32(_mm512_add_epi32(GG(E, F, G), H), \
+			_mm512_add_epi32(SS1, W[j]));			\
+		D = C;							\
+		C = ROL(B, 9);						\
+		B = A;							\
+		A = TT1;						\
+		H = G;							\
+		G = ROL(F, 19);						\
+		F = E;							\
+		E = P0(TT2);						\
+	} while (0)
+
+// W[0..15] hold the message words of the 16 lanes
+static void sm3_x16_compress_W(__m512i V[8], __m512i W[68])
+{
+	__m512i A = V[0], B = V[1], C = V[2], D = V[3];
+	__m512i E = V[4], F = V[5], G = V[6], H = V[7];
+	__m512i SS1, SS2, TT1, TT2;
+	int j;
+
+	for (j = 16; j < 68; j++) {
+		W[j] = XOR3(P1(XOR3(W[j - 16], W[j - 9], ROL(W[j - 3], 15))),
+			ROL(W[j - 13], 7), W[j - 6]);
+	}
+	for (j = 0; j < 16; j++) {
+		ROUND(j, FF00, GG00);
+	}
+	for (; j < 64; j++) {
+		ROUND(j, FF16, GG16);
+	}
+
+	V[0] = _mm512_xor_si512(V[0], A);
+	V[1] = _mm512_xor_si512(V[1], B);
+	V[2] = _mm512_xor_si512(V[2], C);
+	V[3] = _mm512_xor_si512(V[3], D);
+	V[4] = _mm512_xor_si512(V[4], E);
+	V[5] = _mm512_xor_si512(V[5], F);
+	V[6] = _mm512_xor_si512(V[6], G);
+	V[7] = _mm512_xor_si512(V[7], H);
+}
+
+// the 16x16 word transpose of the blocks, then the big endian words
+static void sm3_x16_load_block(__m512i W[16], const uint8_t *data[16], size_t off)
+{
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12));
+	__m512i r[16], t[16];
+	int i, c;
+
+	for (i = 0; i < 16; i++) {
+		r[i] = _mm512_loadu_si512((const void *)(data[i] + off));
+	}
+	for (i = 0; i < 16; i += 2) {
+		t[i    ] = _mm512_unpacklo_epi32(r[i], r[i + 1]);
+		t[i + 1] = _mm512_unpackhi_epi32(r[i], r[i + 1]);
+	}
+	// the 128-bit lane L of r[4g + c] holds word 4L + c of the rows 4g..4g+3
+	for (i = 0; i < 16; i += 4) {
+		r[i    ] = _mm512_unpacklo_epi64(t[i    ], t[i + 2]);
+		r[i + 1] = _mm512_unpackhi_epi64(t[i    ], t[i + 2]);
+		r[i + 2] = _mm512_unpacklo_epi64(t[i + 1], t[i + 3]);
+		r[i + 3] = _mm512_unpackhi_epi64(t[i + 1], t[i + 3]);
+	}
+	// and a 4x4 transpose of the 128-bit lanes
+	for (c = 0; c < 4; c++) {
+		__m512i v0 = _mm512_shuffle_i32x4(r[c], r[4 + c], 0x44);
+		__m512i v1 = _mm512_shuffle_i32x4(r[c], r[4 + c], 0xee);
+		__m512i v2 = _mm512_shuffle_i32x4(r[8 + c], r[12 + c], 0x44);
+		__m512i v3 = _mm512_shuffle_i32x4(r[8 + c], r[12 + c], 0xee);
+		W[c     ] = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(v0, v2, 0x88), bswap);
+		W[c +  4] = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(v0, v2, 0xdd), bswap);
+		W[c +  8] = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(v1, v3, 0x88), bswap);
+		W[c + 12] = _mm512_shuffle_epi8(_mm512_shuffle_i32x4(v1, v3, 0xdd), bswap);
+	}
+}
+
+void sm3_x16_compress_lanes(uint32_t digest[8][16], const uint8_t *data[16], size_t nblocks)
+{
+	__m512i V[8];
+	__m512i W[68];
+	size_t off = 0;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		V[i] = _mm512_loadu_si512((const void *)digest[i]);
+	}
+	while (nblocks--) {
+		sm3_x16_load_block(W, data, off);
+		sm3_x16_compress_W(V, W);
+		off += SM3_BLOCK_SIZE;
+	}
+	for (i = 0; i < 8; i++) {
+		_mm512_storeu_si512((void *)digest[i], V[i]);
+	}
+	gmssl_secure_clear(W, sizeof(W));
+}
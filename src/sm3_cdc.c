@@ -0,0 +1,243 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#include <gmssl/sm3_cdc.h>
+
+
+// seed of the splitmix64 sequence filling the GEAR table, changing it moves every cut point
+#define SM3_CDC_GEAR_SEED	0x534d3343444331ULL
+
+static void sm3_cdc_gear_init(uint64_t gear[256])
+{
+	uint64_t x = SM3_CDC_GEAR_SEED;
+	uint64_t z;
+	int i;
+
+	for (i = 0; i < 256; i++) {
+		x += 0x9E3779B97F4A7C15ULL;
+		z = x;
+		z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+		z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+		gear[i] = z ^ (z >> 31);
+	}
+}
+
+// the top bits, the low bits of h only depend on the last few bytes
+static uint64_t sm3_cdc_mask(int bits)
+{
+	return ((((uint64_t)1) << bits) - 1) << (64 - bits);
+}
+
+int sm3_cdc_init(SM3_CDC_CTX *ctx, size_t min_size, size_t avg_size, size_t max_size,
+	SM3_CDC_CALLBACK callback, void *callback_arg)
+{
+	int bits = 0;
+
+	if (!ctx || !callback) {
+		error_print();
+		return -1;
+	}
+	if (!min_size) min_size = SM3_CDC_DEFAULT_MIN_SIZE;
+	if (!avg_size) avg_size = SM3_CDC_DEFAULT_AVG_SIZE;
+	if (!max_size) max_size = SM3_CDC_DEFAULT_MAX_SIZE;
+	if (avg_size < SM3_CDC_MIN_AVG_SIZE
+		|| (avg_size & (avg_size - 1))
+		|| min_size >= avg_size
+		|| max_size <= avg_size
+		|| max_size > SM3_CDC_MAX_SIZE) {
+		error_print();
+		return -1;
+	}
+	while (((size_t)1 << bits) < avg_size) {
+		bits++;
+	}
+
+	memset(ctx, 0, sizeof(*ctx));
+	if (!(ctx->buf = (uint8_t *)malloc(max_size))) {
+		error_print();
+		return -1;
+	}
+	sm3_cdc_gear_init(ctx->gear);
+	ctx->mask_small = sm3_cdc_mask(bits + 2);
+	ctx->mask_large = sm3_cdc_mask(bits - 2);
+	ctx->min_size = min_size;
+	ctx->avg_size = avg_size;
+	ctx->max_size = max_size;
+	ctx->callback = callback;
+	ctx->callback_arg = callback_arg;
+	ctx->scan_pos = min_size;
+	return 1;
+}
+
+// return the length of the chunk starting at `data`, or 0 if the `datalen` bytes do not end it,
+// the scan state is kept for the next call on the same chunk with more bytes
+static size_t sm3_cdc_scan(SM3_CDC_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	const uint64_t *gear = ctx->gear;
+	size_t end = datalen < ctx->max_size ? datalen : ctx->max_size;
+	size_t normal = ctx->avg_size < end ? ctx->avg_size : end;
+	size_t i = ctx->scan_pos;
+	uint64_t h = ctx->scan_hash;
+
+	if (end <= i) {
+		return 0;
+	}
+	for (; i < normal; i++) {
+		h = (h << 1) + gear[data[i]];
+		if (!(h & ctx->mask_small)) {
+			goto cut;
+		}
+	}
+	for (; i < end; i++) {
+		h = (h << 1) + gear[data[i]];
+		if (!(h & ctx->mask_large)) {
+			goto cut;
+		}
+	}
+	if (end == ctx->max_size) {
+		ctx->scan_pos = ctx->min_size;
+		ctx->scan_hash = 0;
+		return end;
+	}
+	ctx->scan_pos = i;
+	ctx->scan_hash = h;
+	return 0;
+
+cut:
+	ctx->scan_pos = ctx->min_size;
+	ctx->scan_hash = 0;
+	return i + 1;
+}
+
+static int sm3_cdc_flush(SM3_CDC_CTX *ctx)
+{
+	SM3_CDC_CHUNK chunk;
+	size_t i;
+
+	if (!ctx->batch_cnt) {
+		return 1;
+	}
+	sm3_digest_batch(ctx->batch_data, ctx->batch_lens, ctx->batch_cnt, ctx->batch_dgsts);
+
+	for (i = 0; i < ctx->batch_cnt; i++) {
+		chunk.offset = ctx->offset;
+		chunk.len = ctx->batch_lens[i];
+		memcpy(chunk.fingerprint, ctx->batch_dgsts[i], SM3_DIGEST_SIZE);
+		ctx->offset += chunk.len;
+		if (ctx->callback(ctx->callback_arg, &chunk, ctx->batch_data[i]) != 1) {
+			ctx->batch_cnt = 0;
+			error_print();
+			return -1;
+		}
+	}
+	ctx->batch_cnt = 0;
+	return 1;
+}
+
+static int sm3_cdc_add(SM3_CDC_CTX *ctx, const uint8_t *data, size_t len)
+{
+	ctx->batch_data[ctx->batch_cnt] = data;
+	ctx->batch_lens[ctx->batch_cnt] = len;
+	if (++ctx->batch_cnt == SM3_CDC_BATCH) {
+		return sm3_cdc_flush(ctx);
+	}
+	return 1;
+}
+
+int sm3_cdc_update(SM3_CDC_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	size_t take, cut;
+
+	if (!ctx || (!data && datalen)) {
+		error_print();
+		return -1;
+	}
+
+	// the chunk carried from the last call is ended first, ctx->buf is only
+	// refilled after the batch holding it is flushed
+	if (ctx->buflen && datalen) {
+		take = ctx->max_size - ctx->buflen;
+		if (take > datalen) {
+			take = datalen;
+		}
+		memcpy(ctx->buf + ctx->buflen, data, take);
+		ctx->buflen += take;
+		if (!(cut = sm3_cdc_scan(ctx, ctx->buf, ctx->buflen))) {
+			return 1;
+		}
+		take -= ctx->buflen - cut;
+		data += take;
+		datalen -= take;
+		ctx->buflen = 0;
+		if (sm3_cdc_add(ctx, ctx->buf, cut) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	while (datalen) {
+		if (!(cut = sm3_cdc_scan(ctx, data, datalen))) {
+			break;
+		}
+		if (sm3_cdc_add(ctx, data, cut) != 1) {
+			error_print();
+			return -1;
+		}
+		data += cut;
+		datalen -= cut;
+	}
+	if (sm3_cdc_flush(ctx) != 1) {
+		error_print();
+		return -1;
+	}
+	if (datalen) {
+		memcpy(ctx->buf, data, datalen);
+		ctx->buflen = datalen;
+	}
+	return 1;
+}
+
+int sm3_cdc_finish(SM3_CDC_CTX *ctx)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (ctx->buflen) {
+		ctx->batch_data[0] = ctx->buf;
+		ctx->batch_lens[0] = ctx->buflen;
+		ctx->batch_cnt = 1;
+		if (sm3_cdc_flush(ctx) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	ctx->offset = 0;
+	ctx->scan_pos = ctx->min_size;
+	ctx->scan_hash = 0;
+	ctx->buflen = 0;
+	return 1;
+}
+
+void sm3_cdc_cleanup(SM3_CDC_CTX *ctx)
+{
+	if (ctx) {
+		if (ctx->buf) {
+			gmssl_secure_clear(ctx->buf, ctx->max_size);
+			free(ctx->buf);
+		}
+		memset(ctx, 0, sizeof(*ctx));
+	}
+}
@@ -0,0 +1,105 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SM3 with the ARMv8.2 SM3 instructions
+ *
+ * The state is kept as x = (D, C, B, A) and y = (H, G, F, E), lane 3 first.
+ * SM3SS1 gives SS1 in lane 3, SM3TT1A/B and SM3TT2A/B do the A..D and E..H
+ * halves of one round with the word of W' / W in the selected lane, and
+ * SM3PARTW1/2 expand four message words at a time. The round constant
+ * T_j <<< j is kept in lane 3 and rotated by one bit per round.
+ */
+
+#include <arm_neon.h>
+#include <gmssl/sm3.h>
+#include <gmssl/endian.h>
+
+
+#define SM3_CE_ROUND(ab, s0, k0, k1, i)				\
+	ss1 = vsm3ss1q_u32(x, k0, y);				\
+	k1 = vorrq_u32(vshlq_n_u32(k0, 1), vshrq_n_u32(k0, 31));\
+	x = vsm3tt1##ab##q_u32(x, ss1, w, i);			\
+	y = vsm3tt2##ab##q_u32(y, ss1, s0, i)
+
+// rounds j..j+3 with s0 = W[j..j+3], s1 = W[j+4..j+7]
+#define SM3_CE_QROUND(ab, s0, s1)				\
+	w = veorq_u32(s0, s1);					\
+	SM3_CE_ROUND(ab, s0, k0, k1, 0);			\
+	SM3_CE_ROUND(ab, s0, k1, k0, 1);			\
+	SM3_CE_ROUND(ab, s0, k0, k1, 2);			\
+	SM3_CE_ROUND(ab, s0, k1, k0, 3)
+
+// also expand s4 = W[j+16..j+19] from s0..s3 = W[j..j+15]
+#define SM3_CE_QROUND_W(ab, s0, s1, s2, s3, s4)			\
+	s4 = vextq_u32(s1, s2, 3);				\
+	t6 = vextq_u32(s0, s1, 3);				\
+	t7 = vextq_u32(s2, s3, 2);				\
+	s4 = vsm3partw1q_u32(s4, s0, s3);			\
+	SM3_CE_QROUND(ab, s0, s1);				\
+	s4 = vsm3partw2q_u32(s4, t7, t6)
+
+
+void sm3_ce_compress_blocks(uint32_t digest[8], const uint8_t *data, size_t blocks)
+{
+	static const uint32_t T00[4] = { 0, 0, 0, 0x79cc4519 };
+	static const uint32_t T16[4] = { 0, 0, 0, 0x9d8a7a87 };
+	uint32x4_t x, y, x0, y0;
+	uint32x4_t w0, w1, w2, w3, w4;
+	uint32x4_t w, t6, t7, ss1, k0, k1;
+
+	x = vld1q_u32(digest);
+	y = vld1q_u32(digest + 4);
+	x = vrev64q_u32(x);
+	y = vrev64q_u32(y);
+	x = vextq_u32(x, x, 2);
+	y = vextq_u32(y, y, 2);
+
+	while (blocks--) {
+		x0 = x;
+		y0 = y;
+
+		w0 = (uint32x4_t)vrev32q_u8(vld1q_u8(data));
+		w1 = (uint32x4_t)vrev32q_u8(vld1q_u8(data + 16));
+		w2 = (uint32x4_t)vrev32q_u8(vld1q_u8(data + 32));
+		w3 = (uint32x4_t)vrev32q_u8(vld1q_u8(data + 48));
+
+		k0 = vld1q_u32(T00);
+		SM3_CE_QROUND_W(a, w0, w1, w2, w3, w4);
+		SM3_CE_QROUND_W(a, w1, w2, w3, w4, w0);
+		SM3_CE_QROUND_W(a, w2, w3, w4, w0, w1);
+		SM3_CE_QROUND_W(a, w3, w4, w0, w1, w2);
+
+		k0 = vld1q_u32(T16);
+		SM3_CE_QROUND_W(b, w4, w0, w1, w2, w3);
+		SM3_CE_QROUND_W(b, w0, w1, w2, w3, w4);
+		SM3_CE_QROUND_W(b, w1, w2, w3, w4, w0);
+		SM3_CE_QROUND_W(b, w2, w3, w4, w0, w1);
+		SM3_CE_QROUND_W(b, w3, w4, w0, w1, w2);
+		SM3_CE_QROUND_W(b, w4, w0, w1, w2, w3);
+		SM3_CE_QROUND_W(b, w0, w1, w2, w3, w4);
+		SM3_CE_QROUND_W(b, w1, w2, w3, w4, w0);
+		SM3_CE_QROUND_W(b, w2, w3, w4, w0, w1);
+		SM3_CE_QROUND(b, w3, w4);
+		SM3_CE_QROUND(b, w4, w0);
+		SM3_CE_QROUND(b, w0, w1);
+
+		x = veorq_u32(x, x0);
+		y = veorq_u32(y, y0);
+
+		data += 64;
+	}
+
+	x = vrev64q_u32(x);
+	y = vrev64q_u32(y);
+	x = vextq_u32(x, x, 2);
+	y = vextq_u32(y, y, 2);
+	vst1q_u32(digest, x);
+	vst1q_u32(digest + 4, y);
+}
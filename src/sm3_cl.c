@@ -0,0 +1,459 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3_cl.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+static const char *sm3_cl_src;
+
+
+void sm3_cl_cleanup(SM3_CL_CTX *ctx)
+{
+	if (ctx->mem_out) clReleaseMemObject(ctx->mem_out);
+	if (ctx->mem_in) clReleaseMemObject(ctx->mem_in);
+	if (ctx->kernel_wots) clReleaseKernel(ctx->kernel_wots);
+	if (ctx->kernel_digest) clReleaseKernel(ctx->kernel_digest);
+	if (ctx->program) clReleaseProgram(ctx->program);
+	if (ctx->queue) clReleaseCommandQueue(ctx->queue);
+	if (ctx->context) clReleaseContext(ctx->context);
+	memset(ctx, 0, sizeof(*ctx));
+}
+
+int sm3_cl_init(SM3_CL_CTX *ctx, const SM4_CL_CTX *share)
+{
+	cl_int err;
+
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (share) {
+		if ((err = clRetainContext(share->context)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+		ctx->context = share->context;
+		if ((err = clRetainCommandQueue(share->queue)) != CL_SUCCESS) {
+			cl_error_print(err);
+			goto end;
+		}
+		ctx->queue = share->queue;
+		ctx->device = share->device;
+	} else {
+		if (gmssl_cl_open_device(&ctx->context, &ctx->device, &ctx->queue) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (gmssl_cl_build_program(ctx->context, ctx->device, sm3_cl_src, &ctx->program) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(ctx->kernel_digest = clCreateKernel(ctx->program, "sm3_cl_digest", &err))
+		|| !(ctx->kernel_wots = clCreateKernel(ctx->program, "sm3_cl_wots", &err))) {
+		cl_error_print(err);
+		goto end;
+	}
+	return 1;
+
+end:
+	sm3_cl_cleanup(ctx);
+	return -1;
+}
+
+// grow the device buffer `*mem` to at least `len` bytes, the content is not kept
+static int sm3_cl_reserve(SM3_CL_CTX *ctx, cl_mem *mem, size_t *size, size_t len)
+{
+	cl_int err;
+
+	if (*size >= len && *mem) {
+		return 1;
+	}
+	if (*mem) {
+		clReleaseMemObject(*mem);
+		*mem = NULL;
+		*size = 0;
+	}
+	if (!(*mem = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE, len, NULL, &err))) {
+		cl_error_print(err);
+		return -1;
+	}
+	*size = len;
+	return 1;
+}
+
+// same work group size as sm4_cl, the items >= n do nothing
+static int sm3_cl_enqueue(SM3_CL_CTX *ctx, cl_kernel kernel, size_t n)
+{
+	cl_int err;
+	size_t local_work_size = 32;
+	size_t global_work_size = (n + local_work_size - 1)/local_work_size * local_work_size;
+
+	if ((err = clEnqueueNDRangeKernel(ctx->queue, kernel,
+		1, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+int sm3_cl_digest_batch(SM3_CL_CTX *ctx, const uint8_t *msgs, size_t msglen, size_t nmsgs,
+	uint8_t (*dgsts)[SM3_DIGEST_SIZE])
+{
+	cl_int err;
+	cl_uint msglen32 = (cl_uint)msglen;
+	cl_uint nmsgs32 = (cl_uint)nmsgs;
+	size_t inlen = msglen * nmsgs;
+
+	if (!nmsgs) {
+		return 1;
+	}
+	if (msglen > 0xffffffff || nmsgs > 0xffffffff || inlen / nmsgs != msglen) {
+		error_print();
+		return -1;
+	}
+
+	// empty messages still need a buffer to bind
+	if (sm3_cl_reserve(ctx, &ctx->mem_in, &ctx->mem_in_size, inlen ? inlen : 1) != 1
+		|| sm3_cl_reserve(ctx, &ctx->mem_out, &ctx->mem_out_size, SM3_DIGEST_SIZE * nmsgs) != 1) {
+		error_print();
+		return -1;
+	}
+	if (inlen) {
+		if ((err = clEnqueueWriteBuffer(ctx->queue, ctx->mem_in, CL_FALSE, 0, inlen, msgs, 0, NULL, NULL)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+	}
+	if ((err = clSetKernelArg(ctx->kernel_digest, 0, sizeof(cl_mem), &ctx->mem_in)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_digest, 1, sizeof(cl_uint), &msglen32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_digest, 2, sizeof(cl_uint), &nmsgs32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_digest, 3, sizeof(cl_mem), &ctx->mem_out)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if (sm3_cl_enqueue(ctx, ctx->kernel_digest, nmsgs) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((err = clEnqueueReadBuffer(ctx->queue, ctx->mem_out, CL_TRUE, 0,
+		SM3_DIGEST_SIZE * nmsgs, dgsts, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+int sm3_cl_wots_chains(SM3_CL_CTX *ctx, const uint8_t seed[32], const uint8_t (*adrs)[32],
+	uint8_t (*x)[32], size_t n, int start, int steps)
+{
+	static const uint32_t sm3_iv[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	uint32_t prf_midstate[8];
+	uint8_t block[64];
+	cl_int err;
+	cl_uint n32 = (cl_uint)n;
+	cl_uint start32 = (cl_uint)start;
+	cl_uint steps32 = (cl_uint)steps;
+	int i;
+
+	if (start < 0 || steps < 0 || start + steps > 15 || n > 0xffffffff) {
+		error_print();
+		return -1;
+	}
+	if (!n || !steps) {
+		return 1;
+	}
+
+	// the first block of PRF, toByte(3, 32) || SEED, is the same for every chain
+	memset(block, 0, 32);
+	block[31] = 3;
+	memcpy(block + 32, seed, 32);
+	memcpy(prf_midstate, sm3_iv, sizeof(sm3_iv));
+	sm3_compress_blocks(prf_midstate, block, 1);
+	gmssl_secure_clear(block, sizeof(block));
+
+	if (sm3_cl_reserve(ctx, &ctx->mem_in, &ctx->mem_in_size, 32 * n) != 1
+		|| sm3_cl_reserve(ctx, &ctx->mem_out, &ctx->mem_out_size, 32 * n) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((err = clEnqueueWriteBuffer(ctx->queue, ctx->mem_in, CL_FALSE, 0, 32 * n, adrs, 0, NULL, NULL)) != CL_SUCCESS
+		|| (err = clEnqueueWriteBuffer(ctx->queue, ctx->mem_out, CL_FALSE, 0, 32 * n, x, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	for (i = 0; i < 8; i++) {
+		cl_uint d = prf_midstate[i];
+		if ((err = clSetKernelArg(ctx->kernel_wots, i, sizeof(cl_uint), &d)) != CL_SUCCESS) {
+			cl_error_print(err);
+			gmssl_secure_clear(prf_midstate, sizeof(prf_midstate));
+			return -1;
+		}
+	}
+	gmssl_secure_clear(prf_midstate, sizeof(prf_midstate));
+
+	if ((err = clSetKernelArg(ctx->kernel_wots, 8, sizeof(cl_mem), &ctx->mem_in)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_wots, 9, sizeof(cl_mem), &ctx->mem_out)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_wots, 10, sizeof(cl_uint), &n32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_wots, 11, sizeof(cl_uint), &start32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(ctx->kernel_wots, 12, sizeof(cl_uint), &steps32)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if (sm3_cl_enqueue(ctx, ctx->kernel_wots, n) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((err = clEnqueueReadBuffer(ctx->queue, ctx->mem_out, CL_TRUE, 0, 32 * n, x, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+#define KERNEL(...) #__VA_ARGS__
+static const char *sm3_cl_src = KERNEL(
+
+__constant uint SM3_IV[8] = {
+	0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+	0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+};
+
+uint sm3_p0(uint x)
+{
+	return x ^ rotate(x, 9u) ^ rotate(x, 17u);
+}
+
+uint sm3_p1(uint x)
+{
+	return x ^ rotate(x, 15u) ^ rotate(x, 23u);
+}
+
+void sm3_compress(uint digest[8], const uchar block[64])
+{
+	uint W[68];
+	uint A, B, C, D, E, F, G, H;
+	uint SS1, SS2, TT1, TT2, T;
+	int j;
+
+	for (j = 0; j < 16; j++) {
+		W[j] = ((uint)block[4*j] << 24) | ((uint)block[4*j + 1] << 16)
+			| ((uint)block[4*j + 2] << 8) | (uint)block[4*j + 3];
+	}
+	for (; j < 68; j++) {
+		W[j] = sm3_p1(W[j - 16] ^ W[j - 9] ^ rotate(W[j - 3], 15u))
+			^ rotate(W[j - 13], 7u) ^ W[j - 6];
+	}
+
+	A = digest[0];
+	B = digest[1];
+	C = digest[2];
+	D = digest[3];
+	E = digest[4];
+	F = digest[5];
+	G = digest[6];
+	H = digest[7];
+
+	for (j = 0; j < 64; j++) {
+		T = j < 16 ? 0x79CC4519 : 0x7A879D8A;
+		SS1 = rotate(rotate(A, 12u) + E + rotate(T, (uint)(j % 32)), 7u);
+		SS2 = SS1 ^ rotate(A, 12u);
+		if (j < 16) {
+			TT1 = (A ^ B ^ C) + D + SS2 + (W[j] ^ W[j + 4]);
+			TT2 = (E ^ F ^ G) + H + SS1 + W[j];
+		} else {
+			TT1 = ((A & B) | (A & C) | (B & C)) + D + SS2 + (W[j] ^ W[j + 4]);
+			TT2 = ((E & F) | (~E & G)) + H + SS1 + W[j];
+		}
+		D = C;
+		C = rotate(B, 9u);
+		B = A;
+		A = TT1;
+		H = G;
+		G = rotate(F, 19u);
+		F = E;
+		E = sm3_p0(TT2);
+	}
+
+	digest[0] ^= A;
+	digest[1] ^= B;
+	digest[2] ^= C;
+	digest[3] ^= D;
+	digest[4] ^= E;
+	digest[5] ^= F;
+	digest[6] ^= G;
+	digest[7] ^= H;
+}
+
+// the 96-byte messages of F and PRF: the second block is m[32] and the padding of 768 bits
+void sm3_finish_96(uint digest[8], const uchar m[32])
+{
+	uchar block[64];
+	int i;
+
+	for (i = 0; i < 32; i++) {
+		block[i] = m[i];
+	}
+	block[32] = 0x80;
+	for (i = 33; i < 62; i++) {
+		block[i] = 0;
+	}
+	block[62] = 0x03;
+	block[63] = 0x00;
+	sm3_compress(digest, block);
+}
+
+void sm3_digest_to_bytes(const uint digest[8], uchar out[32])
+{
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		out[4*i] = (uchar)(digest[i] >> 24);
+		out[4*i + 1] = (uchar)(digest[i] >> 16);
+		out[4*i + 2] = (uchar)(digest[i] >> 8);
+		out[4*i + 3] = (uchar)digest[i];
+	}
+}
+
+__kernel void sm3_cl_digest(__global const uchar *msgs, uint msglen, uint nmsgs,
+	__global uchar *dgsts)
+{
+	uint global_id = get_global_id(0);
+	__global const uchar *in = msgs + (size_t)msglen * global_id;
+	uint digest[8];
+	uchar block[64];
+	ulong nbits = (ulong)msglen * 8;
+	uint len = msglen;
+	uint i;
+
+	if (global_id >= nmsgs) {
+		return;
+	}
+	for (i = 0; i < 8; i++) {
+		digest[i] = SM3_IV[i];
+	}
+	for (; len >= 64; len -= 64, in += 64) {
+		for (i = 0; i < 64; i++) {
+			block[i] = in[i];
+		}
+		sm3_compress(digest, block);
+	}
+
+	for (i = 0; i < len; i++) {
+		block[i] = in[i];
+	}
+	block[len] = 0x80;
+	for (i = len + 1; i < 64; i++) {
+		block[i] = 0;
+	}
+	if (len >= 56) {
+		sm3_compress(digest, block);
+		for (i = 0; i < 56; i++) {
+			block[i] = 0;
+		}
+	}
+	for (i = 0; i < 8; i++) {
+		block[56 + i] = (uchar)(nbits >> (56 - 8*i));
+	}
+	sm3_compress(digest, block);
+
+	for (i = 0; i < 8; i++) {
+		dgsts[32*global_id + 4*i] = (uchar)(digest[i] >> 24);
+		dgsts[32*global_id + 4*i + 1] = (uchar)(digest[i] >> 16);
+		dgsts[32*global_id + 4*i + 2] = (uchar)(digest[i] >> 8);
+		dgsts[32*global_id + 4*i + 3] = (uchar)digest[i];
+	}
+}
+
+// the chain steps of sm3_xmss with w = 16, one chain per work item:
+// key = PRF(SEED, adrs), bm = PRF(SEED, adrs'), x = F(key, x ^ bm)
+__kernel void sm3_cl_wots(
+	uint prf0, uint prf1, uint prf2, uint prf3, uint prf4, uint prf5, uint prf6, uint prf7,
+	__global const uchar *adrs, __global uchar *x, uint n, uint start, uint steps)
+{
+	uint global_id = get_global_id(0);
+	uint prf_midstate[8];
+	uint digest[8];
+	uchar a[32];
+	uchar m[32];
+	uchar key[32];
+	uchar block[64];
+	uint s, i;
+
+	if (global_id >= n) {
+		return;
+	}
+	prf_midstate[0] = prf0;
+	prf_midstate[1] = prf1;
+	prf_midstate[2] = prf2;
+	prf_midstate[3] = prf3;
+	prf_midstate[4] = prf4;
+	prf_midstate[5] = prf5;
+	prf_midstate[6] = prf6;
+	prf_midstate[7] = prf7;
+
+	for (i = 0; i < 32; i++) {
+		a[i] = adrs[32*global_id + i];
+		m[i] = x[32*global_id + i];
+	}
+
+	for (s = start; s < start + steps; s++) {
+		a[24] = (uchar)(s >> 24);
+		a[25] = (uchar)(s >> 16);
+		a[26] = (uchar)(s >> 8);
+		a[27] = (uchar)s;
+		a[28] = 0;
+		a[29] = 0;
+		a[30] = 0;
+
+		a[31] = 0;
+		for (i = 0; i < 8; i++) {
+			digest[i] = prf_midstate[i];
+		}
+		sm3_finish_96(digest, a);
+		sm3_digest_to_bytes(digest, key);
+
+		a[31] = 1;
+		for (i = 0; i < 8; i++) {
+			digest[i] = prf_midstate[i];
+		}
+		sm3_finish_96(digest, a);
+		sm3_digest_to_bytes(digest, block);
+		for (i = 0; i < 32; i++) {
+			m[i] ^= block[i];
+		}
+
+		// F: toByte(0, 32) || key || m
+		for (i = 0; i < 32; i++) {
+			block[i] = 0;
+			block[32 + i] = key[i];
+		}
+		for (i = 0; i < 8; i++) {
+			digest[i] = SM3_IV[i];
+		}
+		sm3_compress(digest, block);
+		sm3_finish_96(digest, m);
+		sm3_digest_to_bytes(digest, m);
+	}
+
+	for (i = 0; i < 32; i++) {
+		x[32*global_id + i] = m[i];
+	}
+}
+
+);
@@ -0,0 +1,173 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
+#ifdef ENABLE_SM3_AVX2
+#include <gmssl/sm3_x8_avx2.h>
+#endif
+
+
+static const uint32_t SM3_IV[8] = {
+	0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+	0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+};
+
+// second half of the last block of a 32-byte and of a 96-byte message
+static const uint8_t SM3_PAD_TAIL_32[32] = {
+	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x01, 0x00,
+};
+
+static const uint8_t SM3_PAD_TAIL_96[32] = {
+	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x03, 0x00,
+};
+
+// the padding block of a 64-byte message
+static const uint8_t SM3_PAD_BLOCK_64[SM3_BLOCK_SIZE] = {
+	0x80, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+	0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0x02, 0x00,
+};
+
+
+static void sm3_fixed_output(const uint32_t digest[8], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	int i;
+	for (i = 0; i < 8; i++) {
+		PUTU32(dgst + 4*i, digest[i]);
+	}
+}
+
+// inlen is 32, 64 or 96, the full blocks are hashed in place and only a 32-byte tail is copied
+static void sm3_fixed_digest(const uint8_t *in, size_t inlen, uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	uint32_t digest[8];
+	uint8_t block[SM3_BLOCK_SIZE];
+	size_t nblocks = inlen / SM3_BLOCK_SIZE;
+
+	memcpy(digest, SM3_IV, sizeof(digest));
+	if (nblocks) {
+		sm3_compress_blocks(digest, in, nblocks);
+	}
+	if (inlen % SM3_BLOCK_SIZE) {
+		memcpy(block, in + SM3_BLOCK_SIZE * nblocks, 32);
+		memcpy(block + 32, nblocks ? SM3_PAD_TAIL_96 : SM3_PAD_TAIL_32, 32);
+		sm3_compress_blocks(digest, block, 1);
+		gmssl_secure_clear(block, sizeof(block));
+	} else {
+		sm3_compress_blocks(digest, SM3_PAD_BLOCK_64, 1);
+	}
+	sm3_fixed_output(digest, dgst);
+	gmssl_secure_clear(digest, sizeof(digest));
+}
+
+void sm3_digest32(const uint8_t in[32], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest(in, 32, dgst);
+}
+
+void sm3_digest64(const uint8_t in[64], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest(in, 64, dgst);
+}
+
+void sm3_digest96(const uint8_t in[96], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest(in, 96, dgst);
+}
+
+void sm3_finish32(const uint32_t digest[8], uint64_t nblocks, const uint8_t in[32], uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	uint32_t state[8];
+	uint8_t block[SM3_BLOCK_SIZE];
+
+	memcpy(state, digest, sizeof(state));
+	memcpy(block, in, 32);
+	memcpy(block + 32, SM3_PAD_TAIL_32, 24);
+	PUTU64(block + 56, (nblocks * SM3_BLOCK_SIZE + 32) << 3);
+	sm3_compress_blocks(state, block, 1);
+	sm3_fixed_output(state, dgst);
+
+	gmssl_secure_clear(state, sizeof(state));
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+static void sm3_fixed_digest_x8(const uint8_t *const in[8], size_t inlen, uint8_t dgst[8][SM3_DIGEST_SIZE])
+{
+#ifdef ENABLE_SM3_AVX2
+	if (gmssl_cpu_features() & GMSSL_CPU_AVX2) {
+		uint32_t lanes[8][8];
+		uint8_t blocks[8][SM3_BLOCK_SIZE];
+		const uint8_t *data[8];
+		size_t nblocks = inlen / SM3_BLOCK_SIZE;
+		int i, w;
+
+		for (w = 0; w < 8; w++) {
+			for (i = 0; i < 8; i++) {
+				lanes[w][i] = SM3_IV[w];
+			}
+		}
+		if (nblocks) {
+			for (i = 0; i < 8; i++) {
+				data[i] = in[i];
+			}
+			sm3_x8_compress_lanes(lanes, data, nblocks);
+		}
+		// the last block is the constant padding block, or the message tail and the padding
+		for (i = 0; i < 8; i++) {
+			if (inlen % SM3_BLOCK_SIZE) {
+				memcpy(blocks[i], in[i] + SM3_BLOCK_SIZE * nblocks, 32);
+				memcpy(blocks[i] + 32, nblocks ? SM3_PAD_TAIL_96 : SM3_PAD_TAIL_32, 32);
+				data[i] = blocks[i];
+			} else {
+				data[i] = SM3_PAD_BLOCK_64;
+			}
+		}
+		sm3_x8_compress_lanes(lanes, data, 1);
+
+		for (i = 0; i < 8; i++) {
+			for (w = 0; w < 8; w++) {
+				PUTU32(dgst[i] + 4*w, lanes[w][i]);
+			}
+		}
+		gmssl_secure_clear(lanes, sizeof(lanes));
+		gmssl_secure_clear(blocks, sizeof(blocks));
+		return;
+	}
+#endif
+	{
+		int i;
+		for (i = 0; i < 8; i++) {
+			sm3_fixed_digest(in[i], inlen, dgst[i]);
+		}
+	}
+}
+
+void sm3_digest32_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest_x8(in, 32, dgst);
+}
+
+void sm3_digest64_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest_x8(in, 64, dgst);
+}
+
+void sm3_digest96_x8(const uint8_t *const in[8], uint8_t dgst[8][SM3_DIGEST_SIZE])
+{
+	sm3_fixed_digest_x8(in, 96, dgst);
+}
@@ -11,6 +11,7 @@
 
 #include <string.h>
 #include <gmssl/sm3.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 
 /**
@@ -34,26 +35,55 @@
 #define IPAD	0x36
 #define OPAD	0x5C
 
-void sm3_hmac_init(SM3_HMAC_CTX *ctx, const uint8_t *key, size_t key_len)
+void sm3_hmac_set_key(SM3_HMAC_KEY *hmac_key, const uint8_t *key, size_t key_len)
 {
+	SM3_CTX sm3_ctx;
+	uint8_t block[SM3_BLOCK_SIZE];
 	int i;
 
 	if (key_len <= SM3_BLOCK_SIZE) {
-		memcpy(ctx->key, key, key_len);
-		memset(ctx->key + key_len, 0, SM3_BLOCK_SIZE - key_len);
+		memcpy(block, key, key_len);
+		memset(block + key_len, 0, SM3_BLOCK_SIZE - key_len);
 	} else {
-		sm3_init(&ctx->sm3_ctx);
-		sm3_update(&ctx->sm3_ctx, key, key_len);
-		sm3_finish(&ctx->sm3_ctx, ctx->key);
-		memset(ctx->key + SM3_DIGEST_SIZE, 0,
+		sm3_init(&sm3_ctx);
+		sm3_update(&sm3_ctx, key, key_len);
+		sm3_finish(&sm3_ctx, block);
+		memset(block + SM3_DIGEST_SIZE, 0,
 			SM3_BLOCK_SIZE - SM3_DIGEST_SIZE);
 	}
 	for (i = 0; i < SM3_BLOCK_SIZE; i++) {
-		ctx->key[i] ^= IPAD;
+		block[i] ^= IPAD;
 	}
+	sm3_init(&sm3_ctx);
+	sm3_compress_blocks(sm3_ctx.digest, block, 1);
+	memcpy(hmac_key->ipad_digest, sm3_ctx.digest, sizeof(hmac_key->ipad_digest));
+
+	for (i = 0; i < SM3_BLOCK_SIZE; i++) {
+		block[i] ^= (IPAD ^ OPAD);
+	}
+	sm3_init(&sm3_ctx);
+	sm3_compress_blocks(sm3_ctx.digest, block, 1);
+	memcpy(hmac_key->opad_digest, sm3_ctx.digest, sizeof(hmac_key->opad_digest));
+
+	gmssl_secure_clear(block, sizeof(block));
+	gmssl_secure_clear(&sm3_ctx, sizeof(sm3_ctx));
+}
+
+void sm3_hmac_init_with_key(SM3_HMAC_CTX *ctx, const SM3_HMAC_KEY *hmac_key)
+{
+	memcpy(ctx->sm3_ctx.digest, hmac_key->ipad_digest, sizeof(ctx->sm3_ctx.digest));
+	ctx->sm3_ctx.nblocks = 1;
+	ctx->sm3_ctx.num = 0;
+	memcpy(ctx->opad_digest, hmac_key->opad_digest, sizeof(ctx->opad_digest));
+}
+
+void sm3_hmac_init(SM3_HMAC_CTX *ctx, const uint8_t *key, size_t key_len)
+{
+	SM3_HMAC_KEY hmac_key;
 
-	sm3_init(&ctx->sm3_ctx);
-	sm3_update(&ctx->sm3_ctx, ctx->key, SM3_BLOCK_SIZE);
+	sm3_hmac_set_key(&hmac_key, key, key_len);
+	sm3_hmac_init_with_key(ctx, &hmac_key);
+	gmssl_secure_clear(&hmac_key, sizeof(hmac_key));
 }
 
 void sm3_hmac_update(SM3_HMAC_CTX *ctx, const uint8_t *data, size_t data_len)
@@ -61,15 +91,15 @@ void sm3_hmac_update(SM3_HMAC_CTX *ctx, const uint8_t *data, size_t data_len)
 	sm3_update(&ctx->sm3_ctx, data, data_len);
 }
 
+void sm3_hmac_updatev(SM3_HMAC_CTX *ctx, const SM3_IOVEC *iov, size_t iovcnt)
+{
+	sm3_updatev(&ctx->sm3_ctx, iov, iovcnt);
+}
+
 void sm3_hmac_finish(SM3_HMAC_CTX *ctx, uint8_t mac[SM3_HMAC_SIZE])
 {
-	int i;
-	for (i = 0; i < SM3_BLOCK_SIZE; i++) {
-		ctx->key[i] ^= (IPAD ^ OPAD);
-	}
-	sm3_finish(&ctx->sm3_ctx, mac);
-	sm3_init(&ctx->sm3_ctx);
-	sm3_update(&ctx->sm3_ctx, ctx->key, SM3_BLOCK_SIZE);
-	sm3_update(&ctx->sm3_ctx, mac, SM3_DIGEST_SIZE);
 	sm3_finish(&ctx->sm3_ctx, mac);
+
+	// continue from the (K ^ opad) block
+	sm3_finish32(ctx->opad_digest, 1, mac, mac);
 }
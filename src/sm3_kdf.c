@@ -10,6 +10,7 @@
 
 #include <string.h>
 #include <gmssl/sm3.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
 
@@ -25,29 +26,107 @@ void sm3_kdf_update(SM3_KDF_CTX *ctx, const uint8_t *data, size_t datalen)
 	sm3_update(&ctx->sm3_ctx, data, datalen);
 }
 
+// the counter blocks share the prefix state and run SM3_MB_LANES at a time
+static void sm3_kdf_finish_lanes(SM3_KDF_CTX *ctx, uint8_t *out)
+{
+	SM3_MB_CTX mb_ctx;
+	SM3_MB_JOB jobs[SM3_MB_LANES];
+	SM3_CTX prefix;
+	uint8_t data[SM3_MB_LANES][SM3_BLOCK_SIZE + 4];
+	uint8_t dgsts[SM3_MB_LANES][SM3_DIGEST_SIZE];
+	size_t outlen = ctx->outlen;
+	size_t num = ctx->sm3_ctx.num;
+	uint32_t counter = 1;
+	size_t n, i, len;
+
+	// the buffered bytes of the context are moved to the head of every job
+	memcpy(prefix.digest, ctx->sm3_ctx.digest, sizeof(prefix.digest));
+	prefix.nblocks = ctx->sm3_ctx.nblocks;
+	prefix.num = 0;
+
+	sm3_mb_init(&mb_ctx);
+
+	while (outlen) {
+		n = (outlen + SM3_DIGEST_SIZE - 1) / SM3_DIGEST_SIZE;
+		if (n > SM3_MB_LANES) {
+			n = SM3_MB_LANES;
+		}
+
+		for (i = 0; i < n; i++) {
+			memcpy(data[i], ctx->sm3_ctx.block, num);
+			PUTU32(data[i] + num, counter);
+			counter++;
+
+			jobs[i].data = data[i];
+			jobs[i].datalen = num + 4;
+			jobs[i].dgst = dgsts[i];
+			jobs[i].prefix = &prefix;
+			(void)sm3_mb_submit(&mb_ctx, &jobs[i]);
+		}
+		while (sm3_mb_flush(&mb_ctx) != NULL) {
+		}
+
+		for (i = 0; i < n; i++) {
+			len = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
+			memcpy(out, dgsts[i], len);
+			out += len;
+			outlen -= len;
+		}
+	}
+
+	gmssl_secure_clear(&mb_ctx, sizeof(mb_ctx));
+	gmssl_secure_clear(&prefix, sizeof(prefix));
+	gmssl_secure_clear(data, sizeof(data));
+	gmssl_secure_clear(dgsts, sizeof(dgsts));
+}
+
 void sm3_kdf_finish(SM3_KDF_CTX *ctx, uint8_t *out)
 {
 	SM3_CTX sm3_ctx;
 	size_t outlen = ctx->outlen;
+	size_t num = ctx->sm3_ctx.num;
 	uint8_t counter_be[4];
+	uint8_t block[SM3_BLOCK_SIZE];
+	uint32_t digest[SM3_STATE_WORDS];
 	uint8_t dgst[SM3_DIGEST_SIZE];
-	uint32_t counter = 1;
-	size_t len;
+	int i;
 
-	while (outlen) {
-		PUTU32(counter_be, counter);
-		counter++;
+	if (outlen > SM3_DIGEST_SIZE) {
+		sm3_kdf_finish_lanes(ctx, out);
+		return;
+	}
+	if (!outlen) {
+		return;
+	}
 
-		sm3_ctx = ctx->sm3_ctx;
-		sm3_update(&sm3_ctx, counter_be, sizeof(counter_be));
-		sm3_finish(&sm3_ctx, dgst);
+	// a single counter, the buffered bytes, the counter and the padding are built into one
+	// block when they fit, as for the 64-byte (x2, y2) of SM2 encryption
+	if (num + 4 < SM3_BLOCK_SIZE - 8) {
+		memcpy(block, ctx->sm3_ctx.block, num);
+		PUTU32(block + num, 1);
+		memset(block + num + 4, 0, SM3_BLOCK_SIZE - num - 4);
+		block[num + 4] = 0x80;
+		PUTU64(block + SM3_BLOCK_SIZE - 8, (ctx->sm3_ctx.nblocks * SM3_BLOCK_SIZE + num + 4) << 3);
 
-		len = outlen < SM3_DIGEST_SIZE ? outlen : SM3_DIGEST_SIZE;
-		memcpy(out, dgst, len);
-		out += len;
-		outlen -= len;
+		memcpy(digest, ctx->sm3_ctx.digest, sizeof(digest));
+		sm3_compress_blocks(digest, block, 1);
+		for (i = 0; i < SM3_STATE_WORDS; i++) {
+			PUTU32(dgst + 4*i, digest[i]);
+		}
+		memcpy(out, dgst, outlen);
+
+		gmssl_secure_clear(block, sizeof(block));
+		gmssl_secure_clear(digest, sizeof(digest));
+		gmssl_secure_clear(dgst, sizeof(dgst));
+		return;
 	}
 
+	PUTU32(counter_be, 1);
+	sm3_ctx = ctx->sm3_ctx;
+	sm3_update(&sm3_ctx, counter_be, sizeof(counter_be));
+	sm3_finish(&sm3_ctx, dgst);
+	memcpy(out, dgst, outlen);
+
 	memset(&sm3_ctx, 0, sizeof(SM3_CTX));
 	memset(dgst, 0, sizeof(dgst));
 }
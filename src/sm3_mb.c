@@ -0,0 +1,301 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
+#ifdef ENABLE_SM3_AVX2
+#include <gmssl/sm3_x8_avx2.h>
+#endif
+
+
+static const uint32_t SM3_IV[8] = {
+	0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+	0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+};
+
+// idle lanes hash this block, their state is discarded
+static const uint8_t SM3_MB_ZERO_BLOCK[SM3_BLOCK_SIZE] = {0};
+
+
+void sm3_mb_init(SM3_MB_CTX *ctx)
+{
+	memset(ctx, 0, sizeof(*ctx));
+#if defined(ENABLE_SM3_AVX2)
+	if (gmssl_cpu_features() & GMSSL_CPU_AVX2) {
+		ctx->simd = 1;
+	}
+#elif defined(ENABLE_SM3_WASM)
+	if (gmssl_cpu_features() & GMSSL_CPU_WASM_SIMD128) {
+		ctx->simd = 1;
+	}
+#endif
+}
+
+// message blocks are hashed in place, the padded tail (1 or 2 blocks) is copied to lane->pad
+static void sm3_mb_lane_set(SM3_MB_CTX *ctx, int i, SM3_MB_JOB *job)
+{
+	SM3_MB_LANE *lane = &ctx->lanes[i];
+	size_t rem = job->datalen % SM3_BLOCK_SIZE;
+	uint64_t prefix_len = job->prefix ? job->prefix->nblocks * SM3_BLOCK_SIZE : 0;
+	int w;
+
+	lane->job = job;
+	lane->data = job->data;
+	lane->nblocks = job->datalen / SM3_BLOCK_SIZE;
+
+	memset(lane->pad, 0, sizeof(lane->pad));
+	if (rem) {
+		memcpy(lane->pad, job->data + job->datalen - rem, rem);
+	}
+	lane->pad[rem] = 0x80;
+	lane->padblocks = (rem < SM3_BLOCK_SIZE - 8) ? 1 : 2;
+	PUTU64(lane->pad + SM3_BLOCK_SIZE * lane->padblocks - 8, (prefix_len + job->datalen) << 3);
+
+	if (!lane->nblocks) {
+		lane->data = lane->pad;
+		lane->nblocks = lane->padblocks;
+		lane->padblocks = 0;
+	}
+
+	for (w = 0; w < SM3_STATE_WORDS; w++) {
+		ctx->digest[w][i] = job->prefix ? job->prefix->digest[w] : SM3_IV[w];
+	}
+}
+
+static void sm3_mb_lane_finish(SM3_MB_CTX *ctx, int i)
+{
+	SM3_MB_LANE *lane = &ctx->lanes[i];
+	int w;
+
+	for (w = 0; w < SM3_STATE_WORDS; w++) {
+		PUTU32(lane->job->dgst + 4*w, ctx->digest[w][i]);
+	}
+	ctx->done[ctx->done_num++] = lane->job;
+	ctx->busy_num--;
+
+	gmssl_secure_clear(lane, sizeof(*lane));
+}
+
+// run all busy lanes until at least one job is done
+static void sm3_mb_process(SM3_MB_CTX *ctx)
+{
+	const uint8_t *data[SM3_MB_LANES];
+	size_t nblocks = SIZE_MAX;
+	int i, w;
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		if (ctx->lanes[i].job && ctx->lanes[i].nblocks < nblocks) {
+			nblocks = ctx->lanes[i].nblocks;
+		}
+	}
+
+	if (ctx->simd) {
+#if defined(ENABLE_SM3_AVX2)
+		size_t n;
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			data[i] = ctx->lanes[i].job ? ctx->lanes[i].data : SM3_MB_ZERO_BLOCK;
+		}
+		// an idle lane reads the same zero block for every block of the run
+		for (n = 0; n < nblocks; n++) {
+			sm3_x8_compress_lanes(ctx->digest, data, 1);
+			for (i = 0; i < SM3_MB_LANES; i++) {
+				if (ctx->lanes[i].job) {
+					data[i] += SM3_BLOCK_SIZE;
+				}
+			}
+		}
+#elif defined(ENABLE_SM3_WASM)
+		uint32_t digest[SM3_STATE_WORDS][4];
+		size_t n;
+		int h;
+
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			data[i] = ctx->lanes[i].job ? ctx->lanes[i].data : SM3_MB_ZERO_BLOCK;
+		}
+		// the 8 lanes run as two halves of 4, a half without a job is skipped
+		for (h = 0; h < SM3_MB_LANES; h += 4) {
+			if (!ctx->lanes[h].job && !ctx->lanes[h + 1].job
+				&& !ctx->lanes[h + 2].job && !ctx->lanes[h + 3].job) {
+				continue;
+			}
+			for (w = 0; w < SM3_STATE_WORDS; w++) {
+				memcpy(digest[w], &ctx->digest[w][h], sizeof(digest[w]));
+			}
+			for (n = 0; n < nblocks; n++) {
+				sm3_x4_compress_lanes(digest, data + h, 1);
+				for (i = h; i < h + 4; i++) {
+					if (ctx->lanes[i].job) {
+						data[i] += SM3_BLOCK_SIZE;
+					}
+				}
+			}
+			for (w = 0; w < SM3_STATE_WORDS; w++) {
+				memcpy(&ctx->digest[w][h], digest[w], sizeof(digest[w]));
+			}
+		}
+#endif
+	} else {
+		for (i = 0; i < SM3_MB_LANES; i++) {
+			uint32_t digest[SM3_STATE_WORDS];
+
+			if (!ctx->lanes[i].job) {
+				continue;
+			}
+			for (w = 0; w < SM3_STATE_WORDS; w++) {
+				digest[w] = ctx->digest[w][i];
+			}
+			sm3_compress_blocks(digest, ctx->lanes[i].data, nblocks);
+			for (w = 0; w < SM3_STATE_WORDS; w++) {
+				ctx->digest[w][i] = digest[w];
+			}
+		}
+	}
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		SM3_MB_LANE *lane = &ctx->lanes[i];
+
+		if (!lane->job) {
+			continue;
+		}
+		lane->data += SM3_BLOCK_SIZE * nblocks;
+		lane->nblocks -= nblocks;
+		if (lane->nblocks) {
+			continue;
+		}
+		if (lane->padblocks) {
+			lane->data = lane->pad;
+			lane->nblocks = lane->padblocks;
+			lane->padblocks = 0;
+		} else {
+			sm3_mb_lane_finish(ctx, i);
+		}
+	}
+}
+
+SM3_MB_JOB *sm3_mb_submit(SM3_MB_CTX *ctx, SM3_MB_JOB *job)
+{
+	int i;
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		if (!ctx->lanes[i].job) {
+			break;
+		}
+	}
+	// there is always a free lane, the manager is processed as soon as all lanes are busy
+	sm3_mb_lane_set(ctx, i, job);
+	ctx->busy_num++;
+
+	if (!ctx->done_num && ctx->busy_num == SM3_MB_LANES) {
+		while (!ctx->done_num) {
+			sm3_mb_process(ctx);
+		}
+	}
+	if (ctx->done_num) {
+		return ctx->done[--ctx->done_num];
+	}
+	return NULL;
+}
+
+SM3_MB_JOB *sm3_mb_flush(SM3_MB_CTX *ctx)
+{
+	while (!ctx->done_num) {
+		if (!ctx->busy_num) {
+			return NULL;
+		}
+		sm3_mb_process(ctx);
+	}
+	return ctx->done[--ctx->done_num];
+}
+
+void sm3_digest_batch(const uint8_t *const *datas, const size_t *datalens, size_t count,
+	uint8_t (*dgsts)[SM3_DIGEST_SIZE])
+{
+	SM3_MB_CTX ctx;
+	SM3_MB_JOB jobs[SM3_MB_LANES];
+	SM3_MB_JOB *free_jobs[SM3_MB_LANES];
+	SM3_MB_JOB *job;
+	size_t free_num;
+	size_t i;
+
+	sm3_mb_init(&ctx);
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		free_jobs[i] = &jobs[i];
+	}
+	free_num = SM3_MB_LANES;
+
+	for (i = 0; i < count; i++) {
+		job = free_jobs[--free_num];
+		job->data = datas[i];
+		job->datalen = datalens[i];
+		job->dgst = dgsts[i];
+		job->prefix = NULL;
+		if ((job = sm3_mb_submit(&ctx, job)) != NULL) {
+			free_jobs[free_num++] = job;
+		}
+	}
+	while (sm3_mb_flush(&ctx) != NULL) {
+	}
+
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+}
+
+void sm3_hmac_batch(const SM3_HMAC_CTX *const *ctxs, const uint8_t *const *datas, const size_t *datalens,
+	size_t count, uint8_t (*macs)[SM3_HMAC_SIZE])
+{
+	SM3_MB_CTX ctx;
+	SM3_MB_JOB jobs[SM3_MB_LANES];
+	SM3_MB_JOB *free_jobs[SM3_MB_LANES];
+	SM3_MB_JOB *job;
+	SM3_CTX outer;
+	size_t free_num;
+	size_t i;
+	int pass;
+
+	sm3_mb_init(&ctx);
+
+	for (i = 0; i < SM3_MB_LANES; i++) {
+		free_jobs[i] = &jobs[i];
+	}
+	free_num = SM3_MB_LANES;
+
+	// the inner hashes go to macs[i], the outer hashes are over them, the data is copied when submitted
+	for (pass = 0; pass < 2; pass++) {
+		for (i = 0; i < count; i++) {
+			job = free_jobs[--free_num];
+			if (pass == 0) {
+				job->prefix = &ctxs[i]->sm3_ctx;
+				job->data = datas[i];
+				job->datalen = datalens[i];
+			} else {
+				memcpy(outer.digest, ctxs[i]->opad_digest, sizeof(outer.digest));
+				outer.nblocks = 1;
+				outer.num = 0;
+				job->prefix = &outer;
+				job->data = macs[i];
+				job->datalen = SM3_DIGEST_SIZE;
+			}
+			job->dgst = macs[i];
+			if ((job = sm3_mb_submit(&ctx, job)) != NULL) {
+				free_jobs[free_num++] = job;
+			}
+		}
+		while ((job = sm3_mb_flush(&ctx)) != NULL) {
+			free_jobs[free_num++] = job;
+		}
+	}
+
+	gmssl_secure_clear(&outer, sizeof(outer));
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+}
@@ -81,53 +81,177 @@
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
 #include <gmssl/mem.h>
+#include <gmssl/cpu.h>
+#ifdef ENABLE_SM3_AVX2
+#include <gmssl/sm3_x8_avx2.h>
+#endif
 
 
-int sm3_pbkdf2(const char *pass, size_t passlen,
-	const uint8_t *salt, size_t saltlen, size_t count,
-	size_t outlen, uint8_t *out)
+/*
+ * U_2 .. U_c are HMACs of 32 bytes, both the inner and the outer hash are a
+ * single padded block compressed from the chaining values of a SM3_HMAC_KEY.
+ * Every (password, block index) is a job, SM3_MB_LANES jobs run the chains
+ * at once in the sm3_x8 lanes when AVX2 is there.
+ */
+typedef struct {
+	const SM3_HMAC_KEY *hmac_key;
+	uint8_t block[SM3_BLOCK_SIZE]; // U_i || SM3 padding
+	uint8_t key_block[SM3_DIGEST_SIZE];
+	uint8_t *out;
+	size_t outlen;
+} SM3_PBKDF2_LANE;
+
+static void sm3_pbkdf2_lane_set(SM3_PBKDF2_LANE *lane, const SM3_HMAC_KEY *hmac_key,
+	const uint8_t *salt, size_t saltlen, uint32_t iter, uint8_t *out, size_t outlen)
 {
 	SM3_HMAC_CTX ctx;
-	SM3_HMAC_CTX ctx_tmpl;
-	uint32_t iter = 1;
 	uint8_t iter_be[4];
-	uint8_t tmp_block[SM3_DIGEST_SIZE];
-	uint8_t key_block[SM3_DIGEST_SIZE];
 
-	sm3_hmac_init(&ctx_tmpl, (uint8_t *)pass, passlen);
+	PUTU32(iter_be, iter);
+	sm3_hmac_init_with_key(&ctx, hmac_key);
+	sm3_hmac_update(&ctx, salt, saltlen);
+	sm3_hmac_update(&ctx, iter_be, sizeof(iter_be));
+	sm3_hmac_finish(&ctx, lane->block);
+	memcpy(lane->key_block, lane->block, SM3_DIGEST_SIZE);
 
-	while (outlen > 0) {
-		size_t i;
+	memset(lane->block + SM3_DIGEST_SIZE, 0, SM3_BLOCK_SIZE - SM3_DIGEST_SIZE);
+	lane->block[SM3_DIGEST_SIZE] = 0x80;
+	PUTU32(lane->block + SM3_BLOCK_SIZE - 4, (SM3_BLOCK_SIZE + SM3_DIGEST_SIZE) * 8);
+
+	lane->hmac_key = hmac_key;
+	lane->out = out;
+	lane->outlen = outlen;
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+}
 
-		PUTU32(iter_be, iter);
-		iter++;
+static void sm3_pbkdf2_lanes(SM3_PBKDF2_LANE *lanes, size_t n, size_t count)
+{
+	uint32_t digest[SM3_STATE_WORDS];
+	size_t i, k;
+	int j;
 
-		ctx = ctx_tmpl;
-		sm3_hmac_update(&ctx, salt, saltlen);
-		sm3_hmac_update(&ctx, iter_be, sizeof(iter_be));
-		sm3_hmac_finish(&ctx, tmp_block);
-		memcpy(key_block, tmp_block, SM3_DIGEST_SIZE);
+#ifdef ENABLE_SM3_AVX2
+	if (n > 1 && (gmssl_cpu_features() & GMSSL_CPU_AVX2)) {
+		uint32_t ipad[SM3_STATE_WORDS][SM3_MB_LANES];
+		uint32_t opad[SM3_STATE_WORDS][SM3_MB_LANES];
+		uint32_t digests[SM3_STATE_WORDS][SM3_MB_LANES];
+		const uint8_t *data[SM3_MB_LANES];
 
+		// idle lanes repeat the last job, their output is not used
+		for (k = 0; k < SM3_MB_LANES; k++) {
+			SM3_PBKDF2_LANE *lane = &lanes[k < n ? k : n - 1];
+			for (j = 0; j < SM3_STATE_WORDS; j++) {
+				ipad[j][k] = lane->hmac_key->ipad_digest[j];
+				opad[j][k] = lane->hmac_key->opad_digest[j];
+			}
+			data[k] = lane->block;
+		}
 		for (i = 1; i < count; i++) {
-			ctx = ctx_tmpl;
-			sm3_hmac_update(&ctx, tmp_block, SM3_DIGEST_SIZE);
-			sm3_hmac_finish(&ctx, tmp_block);
-			memxor(key_block, tmp_block, SM3_DIGEST_SIZE);
+			memcpy(digests, ipad, sizeof(digests));
+			sm3_x8_compress_lanes(digests, data, 1);
+			for (k = 0; k < n; k++) {
+				for (j = 0; j < SM3_STATE_WORDS; j++) {
+					PUTU32(lanes[k].block + 4 * j, digests[j][k]);
+				}
+			}
+			memcpy(digests, opad, sizeof(digests));
+			sm3_x8_compress_lanes(digests, data, 1);
+			for (k = 0; k < n; k++) {
+				for (j = 0; j < SM3_STATE_WORDS; j++) {
+					PUTU32(lanes[k].block + 4 * j, digests[j][k]);
+				}
+				memxor(lanes[k].key_block, lanes[k].block, SM3_DIGEST_SIZE);
+			}
 		}
+		gmssl_secure_clear(digests, sizeof(digests));
+		n = 0;
+	}
+#endif
 
-		if (outlen < SM3_DIGEST_SIZE) {
-			memcpy(out, key_block, outlen);
-			out += outlen;
-			outlen = 0;
-		} else {
-			memcpy(out, key_block, SM3_DIGEST_SIZE);
-			out += SM3_DIGEST_SIZE;
-			outlen -= SM3_DIGEST_SIZE;
+	for (k = 0; k < n; k++) {
+		uint8_t *block = lanes[k].block;
+
+		for (i = 1; i < count; i++) {
+			memcpy(digest, lanes[k].hmac_key->ipad_digest, sizeof(digest));
+			sm3_compress_blocks(digest, block, 1);
+			for (j = 0; j < SM3_STATE_WORDS; j++) {
+				PUTU32(block + 4 * j, digest[j]);
+			}
+			memcpy(digest, lanes[k].hmac_key->opad_digest, sizeof(digest));
+			sm3_compress_blocks(digest, block, 1);
+			for (j = 0; j < SM3_STATE_WORDS; j++) {
+				PUTU32(block + 4 * j, digest[j]);
+			}
+			memxor(lanes[k].key_block, block, SM3_DIGEST_SIZE);
 		}
 	}
+	gmssl_secure_clear(digest, sizeof(digest));
+}
+
+static void sm3_pbkdf2_lanes_finish(SM3_PBKDF2_LANE *lanes, size_t n, size_t count)
+{
+	size_t k;
 
-	memset(&ctx, 0, sizeof(ctx));
-	memset(key_block, 0, sizeof(key_block));
-	memset(tmp_block, 0, sizeof(key_block));
+	sm3_pbkdf2_lanes(lanes, n, count);
+	for (k = 0; k < n; k++) {
+		memcpy(lanes[k].out, lanes[k].key_block, lanes[k].outlen);
+	}
+	gmssl_secure_clear(lanes, sizeof(SM3_PBKDF2_LANE) * n);
+}
+
+int sm3_pbkdf2_batch(const char *const *passes, const size_t *passlens,
+	const uint8_t *const *salts, const size_t *saltlens, size_t count,
+	size_t outlen, uint8_t *const *outs, size_t num)
+{
+	SM3_HMAC_KEY hmac_keys[SM3_MB_LANES];
+	SM3_PBKDF2_LANE lanes[SM3_MB_LANES];
+	size_t nlanes = 0;
+	size_t nkeys = 0;
+	size_t p;
+
+	if (!passes || !passlens || !salts || !saltlens || !outs) {
+		error_print();
+		return -1;
+	}
+
+	for (p = 0; p < num; p++) {
+		uint8_t *out = outs[p];
+		size_t len = outlen;
+		uint32_t iter = 1;
+
+		// a key is referenced by the lanes until they are run
+		if (nkeys == SM3_MB_LANES) {
+			sm3_pbkdf2_lanes_finish(lanes, nlanes, count);
+			nlanes = 0;
+			nkeys = 0;
+		}
+		sm3_hmac_set_key(&hmac_keys[nkeys], (const uint8_t *)passes[p], passlens[p]);
+
+		while (len > 0) {
+			size_t n = len < SM3_DIGEST_SIZE ? len : SM3_DIGEST_SIZE;
+
+			if (nlanes == SM3_MB_LANES) {
+				sm3_pbkdf2_lanes_finish(lanes, nlanes, count);
+				nlanes = 0;
+			}
+			sm3_pbkdf2_lane_set(&lanes[nlanes++], &hmac_keys[nkeys],
+				salts[p], saltlens[p], iter++, out, n);
+			out += n;
+			len -= n;
+		}
+		nkeys++;
+	}
+	if (nlanes) {
+		sm3_pbkdf2_lanes_finish(lanes, nlanes, count);
+	}
+
+	gmssl_secure_clear(hmac_keys, sizeof(hmac_keys));
 	return 1;
 }
+
+int sm3_pbkdf2(const char *pass, size_t passlen,
+	const uint8_t *salt, size_t saltlen, size_t count,
+	size_t outlen, uint8_t *out)
+{
+	return sm3_pbkdf2_batch(&pass, &passlen, &salt, &saltlen, count, outlen, &out, 1);
+}
@@ -63,8 +63,8 @@ int sm3_rng_init(SM3_RNG *rng, const uint8_t *nonce, size_t nonce_len,
 	uint8_t entropy[512];
 
 	// get_entropy, 512-byte might be too long for some system RNGs
-	if (rand_bytes(entropy, 256) != 1
-		|| rand_bytes(entropy + 256, 256) != 1) {
+	if (rand_get_entropy(entropy, 256) != 1
+		|| rand_get_entropy(entropy + 256, 256) != 1) {
 		error_print();
 		return -1;
 	}
@@ -97,8 +97,8 @@ int sm3_rng_reseed(SM3_RNG *rng, const uint8_t *addin, size_t addin_len)
 	uint8_t entropy[512];
 
 	// get_entropy, 512-byte might be too long for some system RNGs
-	if (rand_bytes(entropy, 256) != 1
-		|| rand_bytes(entropy + 256, 256) != 1) {
+	if (rand_get_entropy(entropy, 256) != 1
+		|| rand_get_entropy(entropy + 256, 256) != 1) {
 		error_print();
 		return -1;
 	}
@@ -0,0 +1,828 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+#include <gmssl/sm3_tree.h>
+#include <gmssl/thread_pool.h>
+
+
+#define SM3_TREE_LEAF_PREFIX	0x00
+#define SM3_TREE_NODE_PREFIX	0x01
+#define SM3_TREE_ROOT_PREFIX	0x02
+
+// leaves passed to one sm3_digest_batch() call, a few per multi-buffer lane
+#define SM3_TREE_BATCH		(SM3_MB_LANES * 4)
+
+// leaves hashed per sm3_tree_hash_leaves() call of sm3_tree_update()
+#define SM3_TREE_UPDATE_LEAVES	256
+
+
+static void sm3_tree_leaf_from_digest(const uint8_t dgst[SM3_DIGEST_SIZE], uint8_t hash[SM3_DIGEST_SIZE])
+{
+	const uint8_t prefix = SM3_TREE_LEAF_PREFIX;
+	SM3_CTX ctx;
+
+	sm3_init(&ctx);
+	sm3_update(&ctx, &prefix, 1);
+	sm3_update(&ctx, dgst, SM3_DIGEST_SIZE);
+	sm3_finish(&ctx, hash);
+}
+
+void sm3_tree_leaf_hash(const uint8_t *data, size_t datalen, uint8_t hash[SM3_DIGEST_SIZE])
+{
+	SM3_CTX ctx;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+
+	sm3_init(&ctx);
+	sm3_update(&ctx, data, datalen);
+	sm3_finish(&ctx, dgst);
+	sm3_tree_leaf_from_digest(dgst, hash);
+}
+
+void sm3_tree_node_hash(const uint8_t left[SM3_DIGEST_SIZE], const uint8_t right[SM3_DIGEST_SIZE],
+	uint8_t hash[SM3_DIGEST_SIZE])
+{
+	const uint8_t prefix = SM3_TREE_NODE_PREFIX;
+	SM3_CTX ctx;
+
+	sm3_init(&ctx);
+	sm3_update(&ctx, &prefix, 1);
+	sm3_update(&ctx, left, SM3_DIGEST_SIZE);
+	sm3_update(&ctx, right, SM3_DIGEST_SIZE);
+	sm3_finish(&ctx, hash);
+}
+
+static void sm3_tree_root_from_top(const uint8_t top[SM3_DIGEST_SIZE], size_t leaf_size, uint64_t count,
+	uint8_t root[SM3_DIGEST_SIZE])
+{
+	uint8_t prefix[13];
+	SM3_CTX ctx;
+
+	prefix[0] = SM3_TREE_ROOT_PREFIX;
+	PUTU32(prefix + 1, (uint32_t)leaf_size);
+	PUTU64(prefix + 5, count);
+	sm3_init(&ctx);
+	sm3_update(&ctx, prefix, sizeof(prefix));
+	sm3_update(&ctx, top, SM3_DIGEST_SIZE);
+	sm3_finish(&ctx, root);
+}
+
+typedef struct {
+	const uint8_t *data;
+	size_t datalen;
+	size_t leaf_size;
+	uint8_t (*hashes)[SM3_DIGEST_SIZE];
+} SM3_TREE_JOB;
+
+static void sm3_tree_leaves(SM3_TREE_JOB *job)
+{
+	const uint8_t *datas[SM3_TREE_BATCH];
+	size_t datalens[SM3_TREE_BATCH];
+	const uint8_t *data = job->data;
+	size_t datalen = job->datalen;
+	uint8_t (*hashes)[SM3_DIGEST_SIZE] = job->hashes;
+	size_t n, i;
+
+	while (datalen) {
+		for (n = 0; n < SM3_TREE_BATCH && datalen; n++) {
+			datas[n] = data;
+			datalens[n] = datalen < job->leaf_size ? datalen : job->leaf_size;
+			data += datalens[n];
+			datalen -= datalens[n];
+		}
+		sm3_digest_batch(datas, datalens, n, hashes);
+		for (i = 0; i < n; i++) {
+			sm3_tree_leaf_from_digest(hashes[i], hashes[i]);
+		}
+		hashes += n;
+	}
+}
+
+static void sm3_tree_task(void *arg)
+{
+	sm3_tree_leaves((SM3_TREE_JOB *)arg);
+}
+
+// every thread gets at least SM3_TREE_THREAD_MIN_SIZE bytes, below that a thread costs more than it saves
+#define SM3_TREE_THREAD_MIN_SIZE	(1024 * 1024)
+
+int sm3_tree_hash_leaves(const uint8_t *data, size_t datalen, size_t leaf_size,
+	uint8_t (*hashes)[SM3_DIGEST_SIZE], int threads)
+{
+	SM3_TREE_JOB jobs[SM3_TREE_MAX_THREADS];
+	size_t nleaves;
+	size_t max_threads;
+	size_t first, end;
+	int i;
+
+	if ((!data && datalen) || !hashes) {
+		error_print();
+		return -1;
+	}
+	if (leaf_size < SM3_TREE_MIN_LEAF_SIZE || leaf_size > SM3_TREE_MAX_LEAF_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!datalen) {
+		return 1;
+	}
+	nleaves = (datalen + leaf_size - 1) / leaf_size;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM3_TREE_MAX_THREADS) {
+		threads = SM3_TREE_MAX_THREADS;
+	}
+	max_threads = nleaves / (SM3_TREE_THREAD_MIN_SIZE / leaf_size + 1);
+	if ((size_t)threads > max_threads) {
+		threads = max_threads ? (int)max_threads : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		first = nleaves * i / threads;
+		end = nleaves * (i + 1) / threads;
+		jobs[i].data = data + leaf_size * first;
+		jobs[i].datalen = (end == nleaves) ? datalen - leaf_size * first : leaf_size * (end - first);
+		jobs[i].leaf_size = leaf_size;
+		jobs[i].hashes = hashes + first;
+	}
+	gmssl_thread_pool_run(sm3_tree_task, jobs, sizeof(jobs[0]), (size_t)threads);
+	return 1;
+}
+
+int sm3_tree_init(SM3_TREE_CTX *ctx, size_t leaf_size, int threads)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (leaf_size < SM3_TREE_MIN_LEAF_SIZE || leaf_size > SM3_TREE_MAX_LEAF_SIZE) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+	ctx->leaf_size = leaf_size;
+	ctx->threads = threads;
+	return 1;
+}
+
+// merge the new leaf with the complete subtrees of its size, like a binary counter
+static void sm3_tree_push(SM3_TREE_CTX *ctx, const uint8_t leaf[SM3_DIGEST_SIZE])
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+	int i;
+
+	memcpy(hash, leaf, SM3_DIGEST_SIZE);
+	for (i = 0; (ctx->count >> i) & 1; i++) {
+		sm3_tree_node_hash(ctx->subtrees[i], hash, hash);
+	}
+	memcpy(ctx->subtrees[i], hash, SM3_DIGEST_SIZE);
+	ctx->count++;
+}
+
+int sm3_tree_append_leaves(SM3_TREE_CTX *ctx, const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count)
+{
+	size_t i;
+
+	if (!ctx || (!hashes && count)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->leaf_len) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		sm3_tree_push(ctx, hashes[i]);
+	}
+	return 1;
+}
+
+int sm3_tree_update(SM3_TREE_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	uint8_t hashes[SM3_TREE_UPDATE_LEAVES][SM3_DIGEST_SIZE];
+	size_t len;
+
+	if (!ctx || (!data && datalen)) {
+		error_print();
+		return -1;
+	}
+
+	if (ctx->leaf_len) {
+		len = ctx->leaf_size - ctx->leaf_len;
+		if (len > datalen) {
+			len = datalen;
+		}
+		sm3_update(&ctx->leaf_ctx, data, len);
+		ctx->leaf_len += len;
+		data += len;
+		datalen -= len;
+		if (ctx->leaf_len < ctx->leaf_size) {
+			return 1;
+		}
+		sm3_finish(&ctx->leaf_ctx, hashes[0]);
+		sm3_tree_leaf_from_digest(hashes[0], hashes[0]);
+		sm3_tree_push(ctx, hashes[0]);
+		ctx->leaf_len = 0;
+	}
+
+	while (datalen >= ctx->leaf_size) {
+		size_t n = datalen / ctx->leaf_size;
+		size_t i;
+
+		if (n > SM3_TREE_UPDATE_LEAVES) {
+			n = SM3_TREE_UPDATE_LEAVES;
+		}
+		len = ctx->leaf_size * n;
+		if (sm3_tree_hash_leaves(data, len, ctx->leaf_size, hashes, ctx->threads) != 1) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < n; i++) {
+			sm3_tree_push(ctx, hashes[i]);
+		}
+		data += len;
+		datalen -= len;
+	}
+
+	if (datalen) {
+		sm3_init(&ctx->leaf_ctx);
+		sm3_update(&ctx->leaf_ctx, data, datalen);
+		ctx->leaf_len = datalen;
+	}
+	return 1;
+}
+
+int sm3_tree_finish(SM3_TREE_CTX *ctx, uint8_t root[SM3_DIGEST_SIZE])
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+	int i;
+
+	if (!ctx || !root) {
+		error_print();
+		return -1;
+	}
+
+	// the short last leaf, or the one empty leaf of an empty input
+	if (ctx->leaf_len || !ctx->count) {
+		if (!ctx->leaf_len) {
+			sm3_init(&ctx->leaf_ctx);
+		}
+		sm3_finish(&ctx->leaf_ctx, hash);
+		sm3_tree_leaf_from_digest(hash, hash);
+		sm3_tree_push(ctx, hash);
+		ctx->leaf_len = 0;
+	}
+
+	// fold the subtrees from the smallest (rightmost) one up
+	for (i = 0; !((ctx->count >> i) & 1); i++) {
+	}
+	memcpy(hash, ctx->subtrees[i], SM3_DIGEST_SIZE);
+	for (i++; i < SM3_TREE_MAX_HEIGHT; i++) {
+		if ((ctx->count >> i) & 1) {
+			sm3_tree_node_hash(ctx->subtrees[i], hash, hash);
+		}
+	}
+	sm3_tree_root_from_top(hash, ctx->leaf_size, ctx->count, root);
+
+	gmssl_secure_clear(ctx, sizeof(*ctx));
+	return 1;
+}
+
+// largest power of two less than n, n > 1
+static uint64_t sm3_tree_split(uint64_t n)
+{
+	uint64_t k = 1;
+
+	while (k < n - k) {
+		k <<= 1;
+	}
+	return k;
+}
+
+static void sm3_tree_mth(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, uint8_t hash[SM3_DIGEST_SIZE])
+{
+	uint8_t left[SM3_DIGEST_SIZE];
+	size_t k;
+
+	if (count == 1) {
+		memcpy(hash, hashes[0], SM3_DIGEST_SIZE);
+		return;
+	}
+	k = (size_t)sm3_tree_split(count);
+	sm3_tree_mth(hashes, k, left);
+	sm3_tree_mth(hashes + k, count - k, hash);
+	sm3_tree_node_hash(left, hash, hash);
+}
+
+int sm3_tree_root(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, size_t leaf_size,
+	uint8_t root[SM3_DIGEST_SIZE])
+{
+	uint8_t top[SM3_DIGEST_SIZE];
+
+	if (!hashes || !count || !root) {
+		error_print();
+		return -1;
+	}
+	if (leaf_size < SM3_TREE_MIN_LEAF_SIZE || leaf_size > SM3_TREE_MAX_LEAF_SIZE) {
+		error_print();
+		return -1;
+	}
+	sm3_tree_mth(hashes, count, top);
+	sm3_tree_root_from_top(top, leaf_size, count, root);
+	return 1;
+}
+
+// the audit path of RFC 6962, the sibling next to the leaf first
+static void sm3_tree_path(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, size_t index,
+	uint8_t (*path)[SM3_DIGEST_SIZE], size_t *pathlen)
+{
+	size_t k;
+
+	if (count <= 1) {
+		return;
+	}
+	k = (size_t)sm3_tree_split(count);
+	if (index < k) {
+		sm3_tree_path(hashes, k, index, path, pathlen);
+		sm3_tree_mth(hashes + k, count - k, path[(*pathlen)++]);
+	} else {
+		sm3_tree_path(hashes + k, count - k, index - k, path, pathlen);
+		sm3_tree_mth(hashes, k, path[(*pathlen)++]);
+	}
+}
+
+int sm3_tree_prove(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count, size_t index,
+	uint8_t (*path)[SM3_DIGEST_SIZE], size_t *pathlen)
+{
+	if (!hashes || !path || !pathlen) {
+		error_print();
+		return -1;
+	}
+	if (index >= count) {
+		error_print();
+		return -1;
+	}
+	*pathlen = 0;
+	sm3_tree_path(hashes, count, index, path, pathlen);
+	return 1;
+}
+
+// RFC 9162 2.1.3.2, return 1 and the MTH of the tree in `top` if the path fits `index` and `count`
+static int sm3_tree_path_top(uint64_t count, uint64_t index, const uint8_t leaf_hash[SM3_DIGEST_SIZE],
+	const uint8_t (*path)[SM3_DIGEST_SIZE], size_t pathlen, uint8_t top[SM3_DIGEST_SIZE])
+{
+	uint64_t fn = index;
+	uint64_t sn = count - 1;
+	size_t i;
+
+	memcpy(top, leaf_hash, SM3_DIGEST_SIZE);
+
+	for (i = 0; i < pathlen; i++) {
+		if (sn == 0) {
+			return 0;
+		}
+		if ((fn & 1) || fn == sn) {
+			sm3_tree_node_hash(path[i], top, top);
+			while (!(fn & 1) && fn) {
+				fn >>= 1;
+				sn >>= 1;
+			}
+		} else {
+			sm3_tree_node_hash(top, path[i], top);
+		}
+		fn >>= 1;
+		sn >>= 1;
+	}
+	if (sn != 0) {
+		return 0;
+	}
+	return 1;
+}
+
+int sm3_tree_verify(const uint8_t root[SM3_DIGEST_SIZE], size_t leaf_size, uint64_t count,
+	uint64_t index, const uint8_t leaf_hash[SM3_DIGEST_SIZE],
+	const uint8_t (*path)[SM3_DIGEST_SIZE], size_t pathlen)
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+
+	if (!root || !leaf_hash || (!path && pathlen)) {
+		error_print();
+		return -1;
+	}
+	if (leaf_size < SM3_TREE_MIN_LEAF_SIZE || leaf_size > SM3_TREE_MAX_LEAF_SIZE
+		|| index >= count || pathlen > SM3_TREE_MAX_HEIGHT) {
+		error_print();
+		return -1;
+	}
+	if (sm3_tree_path_top(count, index, leaf_hash, path, pathlen, hash) != 1) {
+		return 0;
+	}
+	sm3_tree_root_from_top(hash, leaf_size, count, hash);
+	if (memcmp(hash, root, SM3_DIGEST_SIZE) != 0) {
+		return 0;
+	}
+	return 1;
+}
+
+
+void sm3_log_leaf_hash(const uint8_t *entry, size_t entrylen, uint8_t hash[SM3_DIGEST_SIZE])
+{
+	const uint8_t prefix = SM3_TREE_LEAF_PREFIX;
+	SM3_CTX ctx;
+
+	sm3_init(&ctx);
+	sm3_update(&ctx, &prefix, 1);
+	sm3_update(&ctx, entry, entrylen);
+	sm3_finish(&ctx, hash);
+}
+
+// the prefixed entries of a batch are copied together, a one-byte prefix can not be a SM3_MB_JOB prefix
+int sm3_log_hash_leaves(const uint8_t *const *entries, const size_t *entrylens, size_t count,
+	uint8_t (*hashes)[SM3_DIGEST_SIZE])
+{
+	const uint8_t *datas[SM3_TREE_BATCH];
+	size_t datalens[SM3_TREE_BATCH];
+	uint8_t *buf = NULL;
+	size_t bufsize = 0;
+	size_t len, n, i;
+	uint8_t *p;
+
+	if ((!entries || !entrylens || !hashes) && count) {
+		error_print();
+		return -1;
+	}
+	while (count) {
+		n = count < SM3_TREE_BATCH ? count : SM3_TREE_BATCH;
+		for (len = 0, i = 0; i < n; i++) {
+			if (!entries[i] && entrylens[i]) {
+				free(buf);
+				error_print();
+				return -1;
+			}
+			len += 1 + entrylens[i];
+		}
+		if (len > bufsize) {
+			free(buf);
+			if (!(buf = (uint8_t *)malloc(len))) {
+				error_print();
+				return -1;
+			}
+			bufsize = len;
+		}
+		for (p = buf, i = 0; i < n; i++) {
+			datas[i] = p;
+			datalens[i] = 1 + entrylens[i];
+			*p++ = SM3_TREE_LEAF_PREFIX;
+			if (entrylens[i]) {
+				memcpy(p, entries[i], entrylens[i]);
+				p += entrylens[i];
+			}
+		}
+		sm3_digest_batch(datas, datalens, n, hashes);
+		entries += n;
+		entrylens += n;
+		hashes += n;
+		count -= n;
+	}
+	free(buf);
+	return 1;
+}
+
+void sm3_log_init(SM3_LOG *log)
+{
+	memset(log, 0, sizeof(*log));
+}
+
+int sm3_log_append(SM3_LOG *log, const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t count)
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+	size_t i;
+	int j;
+
+	if (!log || (!hashes && count)) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		memcpy(hash, hashes[i], SM3_DIGEST_SIZE);
+		for (j = 0; (log->size >> j) & 1; j++) {
+			sm3_tree_node_hash(log->frontier[j], hash, hash);
+		}
+		memcpy(log->frontier[j], hash, SM3_DIGEST_SIZE);
+		log->size++;
+	}
+	return 1;
+}
+
+int sm3_log_root(const SM3_LOG *log, uint8_t root[SM3_DIGEST_SIZE])
+{
+	SM3_CTX ctx;
+	int i;
+
+	if (!log || !root) {
+		error_print();
+		return -1;
+	}
+	if (!log->size) {
+		sm3_init(&ctx);
+		sm3_finish(&ctx, root);
+		return 1;
+	}
+	for (i = 0; !((log->size >> i) & 1); i++) {
+	}
+	memcpy(root, log->frontier[i], SM3_DIGEST_SIZE);
+	for (i++; i < SM3_TREE_MAX_HEIGHT; i++) {
+		if ((log->size >> i) & 1) {
+			sm3_tree_node_hash(log->frontier[i], root, root);
+		}
+	}
+	return 1;
+}
+
+int sm3_log_tree_root(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, uint8_t root[SM3_DIGEST_SIZE])
+{
+	SM3_CTX ctx;
+
+	if ((!hashes && size) || !root) {
+		error_print();
+		return -1;
+	}
+	if (!size) {
+		sm3_init(&ctx);
+		sm3_finish(&ctx, root);
+		return 1;
+	}
+	sm3_tree_mth(hashes, size, root);
+	return 1;
+}
+
+int sm3_log_prove_inclusion(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, size_t index,
+	uint8_t (*path)[SM3_DIGEST_SIZE], size_t *pathlen)
+{
+	if (!hashes || !path || !pathlen) {
+		error_print();
+		return -1;
+	}
+	if (index >= size) {
+		error_print();
+		return -1;
+	}
+	*pathlen = 0;
+	sm3_tree_path(hashes, size, index, path, pathlen);
+	return 1;
+}
+
+int sm3_log_verify_inclusion(const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	uint64_t index, const uint8_t leaf_hash[SM3_DIGEST_SIZE],
+	const uint8_t (*path)[SM3_DIGEST_SIZE], size_t pathlen)
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+
+	if (!root || !leaf_hash || (!path && pathlen)) {
+		error_print();
+		return -1;
+	}
+	if (index >= size || pathlen > SM3_TREE_MAX_HEIGHT) {
+		error_print();
+		return -1;
+	}
+	if (sm3_tree_path_top(size, index, leaf_hash, path, pathlen, hash) != 1
+		|| memcmp(hash, root, SM3_DIGEST_SIZE) != 0) {
+		return 0;
+	}
+	return 1;
+}
+
+// SUBPROOF(m, D[n], b) of RFC 6962 2.1.2
+static void sm3_log_subproof(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t n, size_t m, int b,
+	uint8_t (*proof)[SM3_DIGEST_SIZE], size_t *prooflen)
+{
+	size_t k;
+
+	if (m == n) {
+		if (!b) {
+			sm3_tree_mth(hashes, n, proof[(*prooflen)++]);
+		}
+		return;
+	}
+	k = (size_t)sm3_tree_split(n);
+	if (m <= k) {
+		sm3_log_subproof(hashes, k, m, b, proof, prooflen);
+		sm3_tree_mth(hashes + k, n - k, proof[(*prooflen)++]);
+	} else {
+		sm3_log_subproof(hashes + k, n - k, m - k, 0, proof, prooflen);
+		sm3_tree_mth(hashes, k, proof[(*prooflen)++]);
+	}
+}
+
+int sm3_log_prove_consistency(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, size_t old_size,
+	uint8_t (*proof)[SM3_DIGEST_SIZE], size_t *prooflen)
+{
+	if (!hashes || !proof || !prooflen) {
+		error_print();
+		return -1;
+	}
+	if (!old_size || old_size > size) {
+		error_print();
+		return -1;
+	}
+	*prooflen = 0;
+	sm3_log_subproof(hashes, size, old_size, 1, proof, prooflen);
+	return 1;
+}
+
+// RFC 9162 2.1.4.2
+int sm3_log_verify_consistency(const uint8_t old_root[SM3_DIGEST_SIZE], uint64_t old_size,
+	const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	const uint8_t (*proof)[SM3_DIGEST_SIZE], size_t prooflen)
+{
+	uint8_t fr[SM3_DIGEST_SIZE];
+	uint8_t sr[SM3_DIGEST_SIZE];
+	uint64_t fn, sn;
+	size_t i;
+
+	if (!old_root || !root || (!proof && prooflen)) {
+		error_print();
+		return -1;
+	}
+	if (!old_size || old_size > size || prooflen > SM3_LOG_MAX_PROOF_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (old_size == size) {
+		return (!prooflen && memcmp(old_root, root, SM3_DIGEST_SIZE) == 0) ? 1 : 0;
+	}
+	if (!prooflen) {
+		return 0;
+	}
+
+	// the old tree is a complete subtree, its root is the first node of the path
+	if (!(old_size & (old_size - 1))) {
+		memcpy(fr, old_root, SM3_DIGEST_SIZE);
+		i = 0;
+	} else {
+		memcpy(fr, proof[0], SM3_DIGEST_SIZE);
+		i = 1;
+	}
+	memcpy(sr, fr, SM3_DIGEST_SIZE);
+	fn = old_size - 1;
+	sn = size - 1;
+	while (fn & 1) {
+		fn >>= 1;
+		sn >>= 1;
+	}
+
+	for (; i < prooflen; i++) {
+		if (sn == 0) {
+			return 0;
+		}
+		if ((fn & 1) || fn == sn) {
+			sm3_tree_node_hash(proof[i], fr, fr);
+			sm3_tree_node_hash(proof[i], sr, sr);
+			while (!(fn & 1) && fn) {
+				fn >>= 1;
+				sn >>= 1;
+			}
+		} else {
+			sm3_tree_node_hash(sr, proof[i], sr);
+		}
+		fn >>= 1;
+		sn >>= 1;
+	}
+	if (sn != 0
+		|| memcmp(fr, old_root, SM3_DIGEST_SIZE) != 0
+		|| memcmp(sr, root, SM3_DIGEST_SIZE) != 0) {
+		return 0;
+	}
+	return 1;
+}
+
+// number of the ascending indexes below `end`
+static size_t sm3_log_indexes_below(const uint64_t *indexes, size_t count, uint64_t end)
+{
+	size_t m = 0;
+
+	while (m < count && indexes[m] < end) {
+		m++;
+	}
+	return m;
+}
+
+// the subtree of `size` leaves from leaf `base` holds the leaves at `indexes`
+static void sm3_log_batch_nodes(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size, uint64_t base,
+	const uint64_t *indexes, size_t count, uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t *nodes_cnt)
+{
+	size_t k, m;
+
+	if (!count) {
+		sm3_tree_mth(hashes, size, nodes[(*nodes_cnt)++]);
+		return;
+	}
+	if (size == 1) {
+		return;
+	}
+	k = (size_t)sm3_tree_split(size);
+	m = sm3_log_indexes_below(indexes, count, base + k);
+	sm3_log_batch_nodes(hashes, k, base, indexes, m, nodes, nodes_cnt);
+	sm3_log_batch_nodes(hashes + k, size - k, base + k, indexes + m, count - m, nodes, nodes_cnt);
+}
+
+static int sm3_log_check_indexes(const uint64_t *indexes, size_t count, uint64_t size)
+{
+	size_t i;
+
+	if (!count || indexes[count - 1] >= size) {
+		return 0;
+	}
+	for (i = 1; i < count; i++) {
+		if (indexes[i] <= indexes[i - 1]) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+int sm3_log_prove_batch(const uint8_t (*hashes)[SM3_DIGEST_SIZE], size_t size,
+	const uint64_t *indexes, size_t count,
+	uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t *nodes_cnt)
+{
+	if (!hashes || !indexes || !nodes || !nodes_cnt) {
+		error_print();
+		return -1;
+	}
+	if (sm3_log_check_indexes(indexes, count, size) != 1) {
+		error_print();
+		return -1;
+	}
+	*nodes_cnt = 0;
+	sm3_log_batch_nodes(hashes, size, 0, indexes, count, nodes, nodes_cnt);
+	return 1;
+}
+
+static int sm3_log_batch_root(uint64_t size, uint64_t base,
+	const uint64_t *indexes, const uint8_t (*leaf_hashes)[SM3_DIGEST_SIZE], size_t count,
+	const uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t nodes_cnt, size_t *pos,
+	uint8_t hash[SM3_DIGEST_SIZE])
+{
+	uint8_t left[SM3_DIGEST_SIZE];
+	uint64_t k;
+	size_t m;
+
+	if (!count) {
+		if (*pos >= nodes_cnt) {
+			return 0;
+		}
+		memcpy(hash, nodes[(*pos)++], SM3_DIGEST_SIZE);
+		return 1;
+	}
+	if (size == 1) {
+		memcpy(hash, leaf_hashes[0], SM3_DIGEST_SIZE);
+		return 1;
+	}
+	k = sm3_tree_split(size);
+	m = sm3_log_indexes_below(indexes, count, base + k);
+	if (sm3_log_batch_root(k, base, indexes, leaf_hashes, m, nodes, nodes_cnt, pos, left) != 1
+		|| sm3_log_batch_root(size - k, base + k, indexes + m, leaf_hashes + m, count - m,
+			nodes, nodes_cnt, pos, hash) != 1) {
+		return 0;
+	}
+	sm3_tree_node_hash(left, hash, hash);
+	return 1;
+}
+
+int sm3_log_verify_batch(const uint8_t root[SM3_DIGEST_SIZE], uint64_t size,
+	const uint64_t *indexes, const uint8_t (*leaf_hashes)[SM3_DIGEST_SIZE], size_t count,
+	const uint8_t (*nodes)[SM3_DIGEST_SIZE], size_t nodes_cnt)
+{
+	uint8_t hash[SM3_DIGEST_SIZE];
+	size_t pos = 0;
+
+	if (!root || !indexes || !leaf_hashes || (!nodes && nodes_cnt)) {
+		error_print();
+		return -1;
+	}
+	if (sm3_log_check_indexes(indexes, count, size) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm3_log_batch_root(size, 0, indexes, leaf_hashes, count, nodes, nodes_cnt, &pos, hash) != 1
+		|| pos != nodes_cnt
+		|| memcmp(hash, root, SM3_DIGEST_SIZE) != 0) {
+		return 0;
+	}
+	return 1;
+}
@@ -0,0 +1,124 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <wasm_simd128.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+
+
+#define ROLT(x,n)	wasm_v128_or(wasm_i32x4_shl((x), (n)), wasm_u32x4_shr((x), 32 - (n)))
+#define P0(x)		wasm_v128_xor((x), wasm_v128_xor(ROLT((x),  9), ROLT((x), 17)))
+#define P1(x)		wasm_v128_xor((x), wasm_v128_xor(ROLT((x), 15), ROLT((x), 23)))
+
+#define FF00(x,y,z)	wasm_v128_xor((x), wasm_v128_xor((y), (z)))
+#define FF16(x,y,z)	wasm_v128_or(wasm_v128_and((x), (y)), wasm_v128_and(wasm_v128_or((x), (y)), (z)))
+#define GG00(x,y,z)	wasm_v128_xor((x), wasm_v128_xor((y), (z)))
+#define GG16(x,y,z)	wasm_v128_bitselect((y), (z), (x))
+
+#define BSWAP32(x) \
+	wasm_i8x16_shuffle(x, x, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+
+
+static const uint32_t K[64] = {
+	0x79cc4519U, 0xf3988a32U, 0xe7311465U, 0xce6228cbU,
+	0x9cc45197U, 0x3988a32fU, 0x7311465eU, 0xe6228cbcU,
+	0xcc451979U, 0x988a32f3U, 0x311465e7U, 0x6228cbceU,
+	0xc451979cU, 0x88a32f39U, 0x11465e73U, 0x228cbce6U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+	0x7a879d8aU, 0xf50f3b14U, 0xea1e7629U, 0xd43cec53U,
+	0xa879d8a7U, 0x50f3b14fU, 0xa1e7629eU, 0x43cec53dU,
+	0x879d8a7aU, 0x0f3b14f5U, 0x1e7629eaU, 0x3cec53d4U,
+	0x79d8a7a8U, 0xf3b14f50U, 0xe7629ea1U, 0xcec53d43U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+};
+
+#define ROUND(j, FF, GG)								\
+	SS0 = ROLT(A, 12);								\
+	SS1 = ROLT(wasm_i32x4_add(wasm_i32x4_add(SS0, E), wasm_i32x4_splat((int32_t)K[j])), 7);	\
+	SS2 = wasm_v128_xor(SS1, SS0);							\
+	TT1 = wasm_i32x4_add(wasm_i32x4_add(FF(A, B, C), D),				\
+		wasm_i32x4_add(SS2, wasm_v128_xor(W[j], W[j + 4])));			\
+	TT2 = wasm_i32x4_add(wasm_i32x4_add(GG(E, F, G), H), wasm_i32x4_add(SS1, W[j]));	\
+	D = C;										\
+	C = ROLT(B, 9);									\
+	B = A;										\
+	A = TT1;									\
+	H = G;										\
+	G = ROLT(F, 19);								\
+	F = E;										\
+	E = P0(TT2)
+
+// the i-th lane hashes nblocks from data[i], the 4 blocks are transposed with word shuffles
+void sm3_x4_compress_lanes(uint32_t digest[8][4], const uint8_t *data[4], size_t nblocks)
+{
+	v128_t V[8];
+	v128_t W[68];
+	v128_t r0, r1, r2, r3, t0, t1, t2, t3;
+	v128_t A, B, C, D, E, F, G, H;
+	v128_t SS0, SS1, SS2, TT1, TT2;
+	size_t off = 0;
+	int i, j;
+
+	for (i = 0; i < 8; i++) {
+		V[i] = wasm_v128_load(digest[i]);
+	}
+
+	while (nblocks--) {
+		for (i = 0; i < 4; i++) {
+			r0 = BSWAP32(wasm_v128_load(data[0] + off + 16*i));
+			r1 = BSWAP32(wasm_v128_load(data[1] + off + 16*i));
+			r2 = BSWAP32(wasm_v128_load(data[2] + off + 16*i));
+			r3 = BSWAP32(wasm_v128_load(data[3] + off + 16*i));
+			t0 = wasm_i32x4_shuffle(r0, r1, 0, 4, 1, 5);
+			t1 = wasm_i32x4_shuffle(r2, r3, 0, 4, 1, 5);
+			t2 = wasm_i32x4_shuffle(r0, r1, 2, 6, 3, 7);
+			t3 = wasm_i32x4_shuffle(r2, r3, 2, 6, 3, 7);
+			W[4*i    ] = wasm_i64x2_shuffle(t0, t1, 0, 2);
+			W[4*i + 1] = wasm_i64x2_shuffle(t0, t1, 1, 3);
+			W[4*i + 2] = wasm_i64x2_shuffle(t2, t3, 0, 2);
+			W[4*i + 3] = wasm_i64x2_shuffle(t2, t3, 1, 3);
+		}
+		for (j = 16; j < 68; j++) {
+			v128_t x = wasm_v128_xor(wasm_v128_xor(W[j - 16], W[j - 9]), ROLT(W[j - 3], 15));
+			W[j] = wasm_v128_xor(wasm_v128_xor(P1(x), ROLT(W[j - 13], 7)), W[j - 6]);
+		}
+
+		A = V[0]; B = V[1]; C = V[2]; D = V[3];
+		E = V[4]; F = V[5]; G = V[6]; H = V[7];
+		for (j = 0; j < 16; j++) {
+			ROUND(j, FF00, GG00);
+		}
+		for (; j < 64; j++) {
+			ROUND(j, FF16, GG16);
+		}
+		V[0] = wasm_v128_xor(V[0], A);
+		V[1] = wasm_v128_xor(V[1], B);
+		V[2] = wasm_v128_xor(V[2], C);
+		V[3] = wasm_v128_xor(V[3], D);
+		V[4] = wasm_v128_xor(V[4], E);
+		V[5] = wasm_v128_xor(V[5], F);
+		V[6] = wasm_v128_xor(V[6], G);
+		V[7] = wasm_v128_xor(V[7], H);
+
+		off += SM3_BLOCK_SIZE;
+	}
+
+	for (i = 0; i < 8; i++) {
+		wasm_v128_store(digest[i], V[i]);
+	}
+	gmssl_secure_clear(W, sizeof(W));
+}
@@ -18,7 +18,15 @@
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
+#include <gmssl/cpu.h>
 #include <gmssl/sm3_xmss.h>
+#ifdef ENABLE_SM3_AVX2
+#include <gmssl/sm3_x8_avx2.h>
+#endif
+#ifdef ENABLE_SM3_AVX512
+#include <gmssl/sm3_x16_avx512.h>
+#include <gmssl/thread_pool.h>
+#endif
 
 
 #define uint32_from_bytes(ptr) \
@@ -79,6 +87,20 @@ static void adrs_print(const uint8_t adrs[32])
 */
 
 
+/*
+ * The F, H and PRF calls of a WOTS+ chain step, an L-tree level or a hash
+ * tree level are independent, they are hashed in batches. With SM3 the
+ * batches run 16 messages at a time in the sm3_x16 AVX-512 lanes or 8 in
+ * the sm3_x8 AVX2 lanes, and PRF and PRF_keygen start from the midstate of
+ * their constant first block.
+ */
+#define XMSS_BATCH	32
+
+#if !defined(ENABLE_SM3_XMSS_CROSSCHECK) || !defined(ENABLE_SHA2)
+#define XMSS_SM3_BATCH
+#endif
+
+#ifndef XMSS_SM3_BATCH
 // F: HASH256(toByte(0, 32) || KEY || M)
 static void hash256_f_init(HASH256_CTX *hash256_ctx, const uint8_t key[32])
 {
@@ -99,6 +121,7 @@ static void hash256_h_init(HASH256_CTX *hash256_ctx, const uint8_t key[32])
 	hash256_update(hash256_ctx, hash_id, 32);
 	hash256_update(hash256_ctx, key, 32);
 }
+#endif
 
 // H_msg: HASH256(toByte(2, 32) || KEY || M), u[64] KEY = r[32] || XMSS_ROOT[32] || toByte(idx_sig, 32)
 static void hash256_h_msg_init(HASH256_CTX *hash256_ctx, const uint8_t key[96])
@@ -134,81 +157,304 @@ static void hash256_prf_keygen_init(HASH256_CTX *hash256_ctx, const uint8_t key[
 	hash256_update(hash256_ctx, key, 32);
 }
 
-static void wots_chain(const uint8_t x[32], int start, int steps,
-	const HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32], uint8_t pk[32])
+#ifdef XMSS_SM3_BATCH
+// n messages of nblocks padded blocks each, every message from its own initial state
+static void sm3_batch_finish(uint32_t (*digest)[8], const uint8_t *blocks, size_t nblocks, size_t n,
+	hash256_bytes_t *out)
 {
-	HASH256_CTX hash256_ctx;
-	uint8_t state[32];
-	uint8_t adrs[32];
-	uint8_t key[32];
-	uint8_t bitmask[32];
-	int i;
+	size_t i = 0, j;
+	int w;
+
+#ifdef ENABLE_SM3_AVX512
+	// 16 lanes while more than 8 messages are left
+	if ((gmssl_cpu_features() & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW))
+		== (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW)) {
+		uint32_t lanes[8][16];
+		const uint8_t *data[16];
+
+		for (; i + 8 < n; i += 16) {
+			for (j = 0; j < 16; j++) {
+				size_t k = i + j < n ? i + j : i;
+				for (w = 0; w < 8; w++) {
+					lanes[w][j] = digest[k][w];
+				}
+				data[j] = blocks + 64 * nblocks * k;
+			}
+			sm3_x16_compress_lanes(lanes, data, nblocks);
+			for (j = 0; j < 16 && i + j < n; j++) {
+				for (w = 0; w < 8; w++) {
+					digest[i + j][w] = lanes[w][j];
+				}
+			}
+		}
+	}
+#endif
+#ifdef ENABLE_SM3_AVX2
+	if (gmssl_cpu_features() & GMSSL_CPU_AVX2) {
+		uint32_t lanes[8][8];
+		const uint8_t *data[8];
+
+		for (; i < n; i += 8) {
+			// the idle lanes of the last group hash the first message again
+			for (j = 0; j < 8; j++) {
+				size_t k = i + j < n ? i + j : i;
+				for (w = 0; w < 8; w++) {
+					lanes[w][j] = digest[k][w];
+				}
+				data[j] = blocks + 64 * nblocks * k;
+			}
+			sm3_x8_compress_lanes(lanes, data, nblocks);
+			for (j = 0; j < 8 && i + j < n; j++) {
+				for (w = 0; w < 8; w++) {
+					digest[i + j][w] = lanes[w][j];
+				}
+			}
+		}
+	}
+#endif
+	for (; i < n; i++) {
+		sm3_compress_blocks(digest[i], blocks + 64 * nblocks * i, nblocks);
+	}
 
-	memcpy(adrs, in_adrs, 32);
-	memcpy(state, x, 32);
-	assert(start + steps <= 15);
+	for (i = 0; i < n; i++) {
+		for (w = 0; w < 8; w++) {
+			uint32_to_bytes(digest[i][w], out[i] + 4*w);
+		}
+	}
+}
+
+// the padding of a message of `len` bytes ending at offset `off` of the last block
+static void sm3_pad_block(uint8_t *block, size_t off, size_t len)
+{
+	memset(block + off, 0, 64 - off);
+	block[off] = 0x80;
+	uint32_to_bytes((uint32_t)(len >> 29), block + 56);
+	uint32_to_bytes((uint32_t)(len << 3), block + 60);
+}
+#endif
 
-	for (i = start; i < start + steps; i++) {
-		adrs_set_hash_address(adrs, i);
+// out[i] = PRF(SEED, adrs[i]), prf_seed_ctx has absorbed toByte(3, 32) || SEED
+static void prf_batch(const HASH256_CTX *prf_seed_ctx, const uint8_t (*adrs)[32], size_t n,
+	hash256_bytes_t *out)
+{
+#ifdef XMSS_SM3_BATCH
+	uint32_t digest[XMSS_BATCH][8];
+	uint8_t blocks[XMSS_BATCH][64];
+	size_t i, k;
+
+	while (n) {
+		k = n < XMSS_BATCH ? n : XMSS_BATCH;
+		for (i = 0; i < k; i++) {
+			memcpy(digest[i], prf_seed_ctx->digest, 32);
+			memcpy(blocks[i], adrs[i], 32);
+			sm3_pad_block(blocks[i], 32, 96);
+		}
+		sm3_batch_finish(digest, blocks[0], 1, k, out);
+		adrs += k;
+		out += k;
+		n -= k;
+	}
+#else
+	HASH256_CTX ctx;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		ctx = *prf_seed_ctx;
+		hash256_update(&ctx, adrs[i], 32);
+		hash256_finish(&ctx, out[i]);
+	}
+#endif
+}
+
+// out[i] = PRF_keygen(SECRET, SEED || adrs[i]), prf_keygen_ctx has absorbed toByte(4, 32) || SECRET
+static void prf_keygen_batch(const HASH256_CTX *prf_keygen_ctx, const uint8_t seed[32],
+	const uint8_t (*adrs)[32], size_t n, hash256_bytes_t *out)
+{
+#ifdef XMSS_SM3_BATCH
+	uint32_t digest[XMSS_BATCH][8];
+	uint8_t blocks[XMSS_BATCH][2][64];
+	size_t i, k;
+
+	while (n) {
+		k = n < XMSS_BATCH ? n : XMSS_BATCH;
+		for (i = 0; i < k; i++) {
+			memcpy(digest[i], prf_keygen_ctx->digest, 32);
+			memcpy(blocks[i][0], seed, 32);
+			memcpy(blocks[i][0] + 32, adrs[i], 32);
+			sm3_pad_block(blocks[i][1], 0, 128);
+		}
+		sm3_batch_finish(digest, blocks[0][0], 2, k, out);
+		adrs += k;
+		out += k;
+		n -= k;
+	}
+#else
+	HASH256_CTX ctx;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		ctx = *prf_keygen_ctx;
+		hash256_update(&ctx, seed, 32);
+		hash256_update(&ctx, adrs[i], 32);
+		hash256_finish(&ctx, out[i]);
+	}
+#endif
+}
+
+// out[i] = F(key[i], m[i])
+static void f_batch(const hash256_bytes_t *key, const hash256_bytes_t *m, size_t n, hash256_bytes_t *out)
+{
+#ifdef XMSS_SM3_BATCH
+	static const uint32_t sm3_iv[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	uint32_t digest[XMSS_BATCH][8];
+	uint8_t blocks[XMSS_BATCH][2][64];
+	size_t i, k;
+
+	while (n) {
+		k = n < XMSS_BATCH ? n : XMSS_BATCH;
+		for (i = 0; i < k; i++) {
+			memcpy(digest[i], sm3_iv, 32);
+			memset(blocks[i][0], 0, 32);
+			memcpy(blocks[i][0] + 32, key[i], 32);
+			memcpy(blocks[i][1], m[i], 32);
+			sm3_pad_block(blocks[i][1], 32, 96);
+		}
+		sm3_batch_finish(digest, blocks[0][0], 2, k, out);
+		key += k;
+		m += k;
+		out += k;
+		n -= k;
+	}
+#else
+	HASH256_CTX ctx;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		hash256_f_init(&ctx, key[i]);
+		hash256_update(&ctx, m[i], 32);
+		hash256_finish(&ctx, out[i]);
+	}
+#endif
+}
 
-		// key = prf(seed, adrs)
-		hash256_ctx = *prf_seed_ctx;
-		adrs_set_key_and_mask(adrs, 0);
-		hash256_update(&hash256_ctx, adrs, sizeof(adrs));
-		hash256_finish(&hash256_ctx, key);
+// out[i] = H(key[i], m[i]), m[i] is 64 bytes
+static void h_batch(const hash256_bytes_t *key, const uint8_t (*m)[64], size_t n, hash256_bytes_t *out)
+{
+#ifdef XMSS_SM3_BATCH
+	static const uint32_t sm3_iv[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	uint32_t digest[XMSS_BATCH][8];
+	uint8_t blocks[XMSS_BATCH][3][64];
+	size_t i, k;
+
+	while (n) {
+		k = n < XMSS_BATCH ? n : XMSS_BATCH;
+		for (i = 0; i < k; i++) {
+			memcpy(digest[i], sm3_iv, 32);
+			memset(blocks[i][0], 0, 32);
+			blocks[i][0][31] = 1;
+			memcpy(blocks[i][0] + 32, key[i], 32);
+			memcpy(blocks[i][1], m[i], 64);
+			sm3_pad_block(blocks[i][2], 0, 128);
+		}
+		sm3_batch_finish(digest, blocks[0][0], 3, k, out);
+		key += k;
+		m += k;
+		out += k;
+		n -= k;
+	}
+#else
+	HASH256_CTX ctx;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		hash256_h_init(&ctx, key[i]);
+		hash256_update(&ctx, m[i], 64);
+		hash256_finish(&ctx, out[i]);
+	}
+#endif
+}
 
-		// bitmask = prf(seed, adrs)
-		hash256_ctx = *prf_seed_ctx;
-		adrs_set_key_and_mask(adrs, 1);
-		hash256_update(&hash256_ctx, adrs, sizeof(adrs));
-		hash256_finish(&hash256_ctx, bitmask);
+// the 67 WOTS+ chains together, chain i is advanced from start[i] by steps[i] in place
+static void wots_chains(hash256_bytes_t x[67], const uint8_t start[67], const uint8_t steps[67],
+	const HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32])
+{
+	uint8_t adrs[67 * 2][32];
+	hash256_bytes_t prf[67 * 2];
+	hash256_bytes_t key[67];
+	hash256_bytes_t state[67];
+	int chain[67];
+	int s, i, n;
+
+	for (s = 0; s < 15; s++) {
+		n = 0;
+		for (i = 0; i < 67; i++) {
+			if (s < start[i] || s >= start[i] + steps[i]) {
+				continue;
+			}
+			memcpy(adrs[2*n], in_adrs, 32);
+			adrs_set_chain_address(adrs[2*n], i);
+			adrs_set_hash_address(adrs[2*n], s);
+			adrs_set_key_and_mask(adrs[2*n], 0);
+			memcpy(adrs[2*n + 1], adrs[2*n], 32);
+			adrs_set_key_and_mask(adrs[2*n + 1], 1);
+			chain[n++] = i;
+		}
+		if (!n) {
+			continue;
+		}
 
-		// state = f(key, state xor bitmask)
-		gmssl_memxor(state, state, bitmask, 32);
-		hash256_f_init(&hash256_ctx, key);
-		hash256_update(&hash256_ctx, state, 32);
-		hash256_finish(&hash256_ctx, state);
+		// key = prf(seed, adrs), bitmask = prf(seed, adrs), x = f(key, x xor bitmask)
+		prf_batch(prf_seed_ctx, (const uint8_t (*)[32])adrs, 2 * n, prf);
+		for (i = 0; i < n; i++) {
+			memcpy(key[i], prf[2*i], 32);
+			gmssl_memxor(state[i], x[chain[i]], prf[2*i + 1], 32);
+		}
+		f_batch(key, state, n, state);
+		for (i = 0; i < n; i++) {
+			memcpy(x[chain[i]], state[i], 32);
+		}
 	}
 
-	memcpy(pk, state, 32);
+	gmssl_secure_clear(key, sizeof(key));
+	gmssl_secure_clear(state, sizeof(state));
 }
 
 void sm3_wots_derive_sk(const uint8_t secret[32], const uint8_t seed[32], const uint8_t in_adrs[32], hash256_bytes_t sk[67])
 {
 	HASH256_CTX prf_keygen_ctx;
-	HASH256_CTX prf_ctx;
-	uint8_t adrs[32];
+	uint8_t adrs[67][32];
 	int i;
 
 	hash256_prf_keygen_init(&prf_keygen_ctx, secret);
 
-	memcpy(adrs, in_adrs, 32);
-	adrs_set_hash_address(adrs, 0);
-	adrs_set_key_and_mask(adrs, 0);
-
+	// sk[i] = prf(secret, seed || adrs), follow github.com/XMSS/xmss-reference
 	for (i = 0; i < 67; i++) {
-		// sk[i] = prf(secret, toBytes(i,32))
-		prf_ctx = prf_keygen_ctx;
-		adrs_set_chain_address(adrs, i);
-		hash256_update(&prf_ctx, seed, 32);
-		hash256_update(&prf_ctx, adrs, 32);
-		hash256_finish(&prf_ctx, sk[i]);
+		memcpy(adrs[i], in_adrs, 32);
+		adrs_set_hash_address(adrs[i], 0);
+		adrs_set_key_and_mask(adrs[i], 0);
+		adrs_set_chain_address(adrs[i], i);
 	}
+	prf_keygen_batch(&prf_keygen_ctx, seed, (const uint8_t (*)[32])adrs, 67, sk);
+
+	gmssl_secure_clear(&prf_keygen_ctx, sizeof(prf_keygen_ctx));
 }
 
 void sm3_wots_derive_pk(const hash256_bytes_t sk[67],
 	const HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32],
 	hash256_bytes_t pk[67])
 {
-	uint8_t adrs[32];
-	int i;
-
-	memcpy(adrs, in_adrs, 32);
+	uint8_t start[67] = {0};
+	uint8_t steps[67];
 
-	for (i = 0; i < 67; i++) {
-		adrs_set_chain_address(adrs, i);
-		wots_chain(sk[i], 0, 15, prf_seed_ctx, adrs, pk[i]);
-	}
+	memset(steps, 15, sizeof(steps));
+	memcpy(pk, sk, 32 * 67);
+	wots_chains(pk, start, steps, prf_seed_ctx, in_adrs);
 }
 
 static void base_w_and_checksum(const uint8_t dgst[32], uint8_t msg[67])
@@ -242,73 +488,71 @@ void sm3_wots_do_sign(const hash256_bytes_t sk[67],
 	const HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32],
 	const uint8_t dgst[32], hash256_bytes_t sig[67])
 {
-	uint8_t adrs[32];
+	uint8_t start[67] = {0};
 	uint8_t msg[67];
-	uint32_t i;
-
-	memcpy(adrs, in_adrs, 32);
 
 	base_w_and_checksum(dgst, msg);
 
-	for (i = 0; i < 67; i++) {
-		adrs_set_chain_address(adrs, i);
-		wots_chain(sk[i], 0, msg[i], prf_seed_ctx, adrs, sig[i]);
-	}
+	memcpy(sig, sk, 32 * 67);
+	wots_chains(sig, start, msg, prf_seed_ctx, in_adrs);
 }
 
 void sm3_wots_sig_to_pk(const hash256_bytes_t sig[67], const uint8_t dgst[32],
 	const  HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32],
 	hash256_bytes_t pk[67])
 {
-	uint8_t adrs[32];
 	uint8_t msg[67];
+	uint8_t steps[67];
 	int i;
 
-	memcpy(adrs, in_adrs, 32);
-
 	base_w_and_checksum(dgst, msg);
-
 	for (i = 0; i < 67; i++) {
-		adrs_set_chain_address(adrs, i);
-		wots_chain(sig[i], msg[i], 15 - msg[i], prf_seed_ctx, adrs, pk[i]);
+		steps[i] = 15 - msg[i];
 	}
+
+	memcpy(pk, sig, 32 * 67);
+	wots_chains(pk, msg, steps, prf_seed_ctx, in_adrs);
 }
 
-static void randomized_hash(const uint8_t left[32], const uint8_t right[32],
+// out[i] = RAND_HASH(nodes[2i], nodes[2i + 1]) with tree index index + i, out may be nodes
+static void randomized_hash_batch(const hash256_bytes_t *nodes, size_t n, uint32_t index,
 	const HASH256_CTX *prf_seed_ctx, const uint8_t in_adrs[32],
-	uint8_t out[32])
+	hash256_bytes_t *out)
 {
-	HASH256_CTX hash256_ctx;
-	uint8_t adrs[32];
-	uint8_t key[32];
-	uint8_t bitmask[64];
-
-	memcpy(adrs, in_adrs, 32);
-
-	// key = prf(seed, adrs)
-	hash256_ctx = *prf_seed_ctx;
-	adrs_set_key_and_mask(adrs, 0);
-	hash256_update(&hash256_ctx, adrs, 32);
-	hash256_finish(&hash256_ctx, key);
-
-	// bm_0 = prf(seed, adrs)
-	hash256_ctx = *prf_seed_ctx;
-	adrs_set_key_and_mask(adrs, 1);
-	hash256_update(&hash256_ctx, adrs, 32);
-	hash256_finish(&hash256_ctx, bitmask);
+	uint8_t adrs[XMSS_BATCH * 3][32];
+	hash256_bytes_t prf[XMSS_BATCH * 3];
+	hash256_bytes_t key[XMSS_BATCH];
+	uint8_t m[XMSS_BATCH][64];
+	size_t i, k;
+
+	while (n) {
+		k = n < XMSS_BATCH ? n : XMSS_BATCH;
+
+		// key = prf(seed, adrs), bm_0 = prf(seed, adrs), bm_1 = prf(seed, adrs)
+		for (i = 0; i < k; i++) {
+			memcpy(adrs[3*i], in_adrs, 32);
+			adrs_set_tree_index(adrs[3*i], index + (uint32_t)i);
+			adrs_set_key_and_mask(adrs[3*i], 0);
+			memcpy(adrs[3*i + 1], adrs[3*i], 32);
+			adrs_set_key_and_mask(adrs[3*i + 1], 1);
+			memcpy(adrs[3*i + 2], adrs[3*i], 32);
+			adrs_set_key_and_mask(adrs[3*i + 2], 2);
+		}
+		prf_batch(prf_seed_ctx, (const uint8_t (*)[32])adrs, 3 * k, prf);
 
-	// bm_1 = prf(seed, adrs)
-	hash256_ctx = *prf_seed_ctx;
-	adrs_set_key_and_mask(adrs, 2);
-	hash256_update(&hash256_ctx, adrs, 32);
-	hash256_finish(&hash256_ctx, bitmask + 32);
+		// h(key, (left xor bm_0) || (right xor bm_1))
+		for (i = 0; i < k; i++) {
+			memcpy(key[i], prf[3*i], 32);
+			gmssl_memxor(m[i], nodes[2*i], prf[3*i + 1], 32);
+			gmssl_memxor(m[i] + 32, nodes[2*i + 1], prf[3*i + 2], 32);
+		}
+		h_batch(key, (const uint8_t (*)[64])m, k, out);
 
-	// return h(key, (left xor bm_0) || (right xor bm_1))
-	hash256_h_init(&hash256_ctx, key);
-	gmssl_memxor(bitmask, bitmask, left, 32);
-	gmssl_memxor(bitmask + 32, bitmask + 32, right, 32);
-	hash256_update(&hash256_ctx, bitmask, 64);
-	hash256_finish(&hash256_ctx, out);
+		nodes += 2 * k;
+		out += k;
+		index += (uint32_t)k;
+		n -= k;
+	}
 }
 
 static void build_ltree(const hash256_bytes_t in_pk[67],
@@ -319,7 +563,6 @@ static void build_ltree(const hash256_bytes_t in_pk[67],
 	uint8_t adrs[32];
 	uint32_t tree_height = 0;
 	int len = 67;
-	uint32_t i;
 
 	memcpy(pk, in_pk, sizeof(pk));
 	memcpy(adrs, in_adrs, 32);
@@ -327,10 +570,7 @@ static void build_ltree(const hash256_bytes_t in_pk[67],
 	adrs_set_tree_height(adrs, tree_height++);
 
 	while (len > 1) {
-		for (i = 0; i < (uint32_t)len/2; i++) {
-			adrs_set_tree_index(adrs, i);
-			randomized_hash(pk[2 * i], pk[2 * i + 1], prf_seed_ctx, adrs, pk[i]);
-		}
+		randomized_hash_batch(pk, len/2, 0, prf_seed_ctx, adrs, pk);
 		if (len % 2) {
 			memcpy(pk[len/2], pk[len-1], 32); //pk[len/2] = pk[len - 1];
 		}
@@ -350,7 +590,7 @@ static void build_hash_tree(const hash256_bytes_t *leaves, int height,
 {
 	uint8_t adrs[32];
 	int n = 1 << height;
-	int h, i;
+	int h;
 
 	memcpy(adrs, in_adrs, 32);
 	adrs_set_type(adrs, 2);
@@ -359,52 +599,100 @@ static void build_hash_tree(const hash256_bytes_t *leaves, int height,
 		adrs_set_tree_height(adrs, h);
 
 		n >>= 1;
-		for (i = 0; i < n; i++) {
-			adrs_set_tree_index(adrs, i);
-			randomized_hash(leaves[2*i], leaves[2*i + 1], prf_seed_ctx, adrs, tree[i]);
-		}
+		randomized_hash_batch(leaves, n, 0, prf_seed_ctx, adrs, tree);
 		leaves = tree;
 		tree += n;
 	}
 }
 
-void sm3_xmss_derive_root(const uint8_t xmss_secret[32], int height,
-	const uint8_t seed[32],
-	hash256_bytes_t *tree, uint8_t xmss_root[32])
+typedef struct {
+	const uint8_t *xmss_secret;
+	const uint8_t *seed;
+	const HASH256_CTX *prf_seed_ctx;
+	hash256_bytes_t *leaves;
+	uint32_t first;
+	uint32_t last;
+} XMSS_LEAVES_JOB;
+
+// xmss_secret => wots_sk[0..67] => wots_pk[0..67] => wots_root, of the leaves in [first, last) to leaves[0..]
+static void derive_leaves(XMSS_LEAVES_JOB *job)
 {
-	HASH256_CTX prf_keygen_ctx;
-	HASH256_CTX prf_seed_ctx;
+	hash256_bytes_t wots_sk[67];
+	hash256_bytes_t wots_pk[67];
 	uint8_t adrs[32] = {0};
 	uint32_t i;
 
-	hash256_prf_keygen_init(&prf_keygen_ctx, xmss_secret);
-	hash256_prf_init(&prf_seed_ctx, seed);
-
-	// generate all the wots pk[]
-	for (i = 0; i < (uint32_t)(1<<height); i++) {
-		//HASH256_CTX prf_ctx = prf_keygen_ctx;
-		hash256_bytes_t wots_sk[67];
-		hash256_bytes_t wots_pk[67];
-
-		// xmss_secret => wots_sk[0..67] => wots_pk[0..67]
-		//	follow github.com/XMSS/xmss-reference
+	for (i = job->first; i < job->last; i++) {
 		adrs_set_type(adrs, 0);
 		adrs_set_ots_address(adrs, i);
-		sm3_wots_derive_sk(xmss_secret, seed, adrs, wots_sk);
-		sm3_wots_derive_pk(wots_sk, &prf_seed_ctx, adrs, wots_pk);
+		sm3_wots_derive_sk(job->xmss_secret, job->seed, adrs, wots_sk);
+		sm3_wots_derive_pk(wots_sk, job->prf_seed_ctx, adrs, wots_pk);
 
-		// wots_pk[0..67] => wots_root
 		adrs_set_type(adrs, 1);
 		adrs_set_ltree_address(adrs, i);
-		build_ltree(wots_pk, &prf_seed_ctx, adrs, tree[i]);
+		build_ltree(wots_pk, job->prf_seed_ctx, adrs, job->leaves[i - job->first]);
+	}
+	gmssl_secure_clear(wots_sk, sizeof(wots_sk));
+}
+
+static void derive_leaves_task(void *arg)
+{
+	derive_leaves((XMSS_LEAVES_JOB *)arg);
+}
+
+// the leaves [first, last) to leaves[0..last - first), every thread gets at least 16 leaves
+static void derive_leaves_range(const uint8_t xmss_secret[32], const uint8_t seed[32],
+	const HASH256_CTX *prf_seed_ctx, int threads, uint32_t first, uint32_t last,
+	hash256_bytes_t *leaves)
+{
+	XMSS_LEAVES_JOB jobs[XMSS_MAX_THREADS];
+	uint32_t nleaves = last - first;
+	int i;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > XMSS_MAX_THREADS) {
+		threads = XMSS_MAX_THREADS;
+	}
+	if ((uint32_t)threads > nleaves / 16) {
+		threads = nleaves / 16 ? (int)(nleaves / 16) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i].xmss_secret = xmss_secret;
+		jobs[i].seed = seed;
+		jobs[i].prf_seed_ctx = prf_seed_ctx;
+		jobs[i].first = first + (uint32_t)(((uint64_t)nleaves * i) / threads);
+		jobs[i].last = first + (uint32_t)(((uint64_t)nleaves * (i + 1)) / threads);
+		jobs[i].leaves = leaves + (jobs[i].first - first);
 	}
+	gmssl_thread_pool_run(derive_leaves_task, jobs, sizeof(jobs[0]), (size_t)threads);
+}
+
+void sm3_xmss_derive_root_ex(const uint8_t xmss_secret[32], int height,
+	const uint8_t seed[32], int threads,
+	hash256_bytes_t *tree, uint8_t xmss_root[32])
+{
+	HASH256_CTX prf_seed_ctx;
+	uint32_t nleaves = (uint32_t)1 << height;
+	uint8_t adrs[32] = {0};
+
+	hash256_prf_init(&prf_seed_ctx, seed);
+	derive_leaves_range(xmss_secret, seed, &prf_seed_ctx, threads, 0, nleaves, tree);
 
 	// build full hash_tree
-	memset(adrs, 0, sizeof(adrs));
-	build_hash_tree(tree, height, &prf_seed_ctx, adrs, tree + (1<<height));
+	build_hash_tree(tree, height, &prf_seed_ctx, adrs, tree + nleaves);
 	memcpy(xmss_root, tree + (1 << (height + 1)) - 2, 32);
 }
 
+void sm3_xmss_derive_root(const uint8_t xmss_secret[32], int height,
+	const uint8_t seed[32],
+	hash256_bytes_t *tree, uint8_t xmss_root[32])
+{
+	sm3_xmss_derive_root_ex(xmss_secret, height, seed, 0, tree, xmss_root);
+}
+
 static void build_auth_path(const hash256_bytes_t *tree, int height, int index, hash256_bytes_t *path)
 {
 	int h;
@@ -415,12 +703,10 @@ static void build_auth_path(const hash256_bytes_t *tree, int height, int index,
 	}
 }
 
-void sm3_xmss_do_sign(const uint8_t xmss_secret[32], int index,
-	const uint8_t seed[32], const uint8_t in_adrs[32], int height,
-	const hash256_bytes_t *tree,
+static void xmss_wots_sign(const uint8_t xmss_secret[32], int index,
+	const uint8_t seed[32], const uint8_t in_adrs[32],
 	const uint8_t dgst[32],
-	hash256_bytes_t wots_sig[67],
-	hash256_bytes_t *auth_path)
+	hash256_bytes_t wots_sig[67])
 {
 	HASH256_CTX prf_seed_ctx;
 	uint8_t adrs[32];
@@ -435,7 +721,17 @@ void sm3_xmss_do_sign(const uint8_t xmss_secret[32], int index,
 	sm3_wots_derive_sk(xmss_secret, seed, adrs, wots_sk);
 
 	sm3_wots_do_sign(wots_sk, &prf_seed_ctx, adrs, dgst, wots_sig);
+	gmssl_secure_clear(wots_sk, sizeof(wots_sk));
+}
 
+void sm3_xmss_do_sign(const uint8_t xmss_secret[32], int index,
+	const uint8_t seed[32], const uint8_t in_adrs[32], int height,
+	const hash256_bytes_t *tree,
+	const uint8_t dgst[32],
+	hash256_bytes_t wots_sig[67],
+	hash256_bytes_t *auth_path)
+{
+	xmss_wots_sign(xmss_secret, index, seed, in_adrs, dgst, wots_sig);
 	build_auth_path(tree, height, index, auth_path);
 }
 
@@ -447,7 +743,7 @@ void sm3_xmss_sig_to_root(const hash256_bytes_t wots_sig[67], int index, const h
 	HASH256_CTX prf_seed_ctx;
 	uint8_t adrs[32];
 	hash256_bytes_t wots_pk[67];
-	uint8_t *node = xmss_root;
+	hash256_bytes_t pair[2];
 	int h;
 
 	hash256_prf_init(&prf_seed_ctx, seed);
@@ -460,21 +756,217 @@ void sm3_xmss_sig_to_root(const hash256_bytes_t wots_sig[67], int index, const h
 
 	adrs_set_type(adrs, 1);
 	adrs_set_ltree_address(adrs, index);
-	build_ltree(wots_pk, &prf_seed_ctx, adrs, node);
+	build_ltree(wots_pk, &prf_seed_ctx, adrs, xmss_root);
 
 	adrs_set_type(adrs, 2);
-	adrs_set_tree_index(adrs, index);
 	for (h = 0; h < height; h++) {
 		int right = index & 1;
 		index >>= 1;
 		adrs_set_tree_height(adrs, h);
-		adrs_set_tree_index(adrs, index);
-		if (right)
-			randomized_hash(auth_path[h], node, &prf_seed_ctx, adrs, node);
-		else	randomized_hash(node, auth_path[h], &prf_seed_ctx, adrs, node);
+		memcpy(pair[right], xmss_root, 32);
+		memcpy(pair[!right], auth_path[h], 32);
+		randomized_hash_batch(pair, 1, (uint32_t)index, &prf_seed_ctx, adrs, pair);
+		memcpy(xmss_root, pair[0], 32);
 	}
 }
 
+// leaves derived per round of sm3_xmss_bds_init()
+#define XMSS_BDS_CHUNK	1024
+
+int sm3_xmss_bds_init(SM3_XMSS_BDS *bds, const uint8_t xmss_secret[32], int height,
+	const uint8_t seed[32], int threads, uint8_t xmss_root[32])
+{
+	HASH256_CTX prf_seed_ctx;
+	hash256_bytes_t *leaves;
+	uint32_t nleaves = (uint32_t)1 << height;
+	uint32_t first, last, i;
+	uint8_t adrs[32] = {0};
+	int n = 0;
+	int h;
+
+	if (height < 1 || height > 20) {
+		error_print();
+		return -1;
+	}
+	if (!(leaves = malloc(sizeof(hash256_bytes_t) * XMSS_BDS_CHUNK))) {
+		error_print();
+		return -1;
+	}
+	memset(bds, 0, sizeof(*bds));
+	bds->height = height;
+	for (h = 0; h < height; h++) {
+		bds->treehash[h].completed = 1;
+	}
+
+	hash256_prf_init(&prf_seed_ctx, seed);
+	adrs_set_type(adrs, 2);
+
+	// treehash over all the leaves, collecting node(h, 1) as auth[h] and node(h, 3) for treehash[h]
+	for (first = 0; first < nleaves; first = last) {
+		last = nleaves - first < XMSS_BDS_CHUNK ? nleaves : first + XMSS_BDS_CHUNK;
+		derive_leaves_range(xmss_secret, seed, &prf_seed_ctx, threads, first, last, leaves);
+
+		for (i = first; i < last; i++) {
+			memcpy(bds->stack[n], leaves[i - first], 32);
+			bds->stack_levels[n++] = 0;
+
+			while (n > 1 && bds->stack_levels[n - 1] == bds->stack_levels[n - 2]) {
+				h = bds->stack_levels[n - 1];
+				if ((i >> h) == 1) {
+					memcpy(bds->auth[h], bds->stack[n - 1], 32);
+				} else if ((i >> h) == 3) {
+					memcpy(bds->treehash[h].node, bds->stack[n - 1], 32);
+				}
+				adrs_set_tree_height(adrs, h);
+				randomized_hash_batch(bds->stack + n - 2, 1, i >> (h + 1), &prf_seed_ctx, adrs, bds->stack + n - 2);
+				bds->stack_levels[n - 2]++;
+				n--;
+			}
+		}
+	}
+	memcpy(xmss_root, bds->stack[0], 32);
+
+	memset(bds->stack, 0, sizeof(bds->stack));
+	memset(bds->stack_levels, 0, sizeof(bds->stack_levels));
+	free(leaves);
+	return 1;
+}
+
+static void bds_derive_leaf(const uint8_t xmss_secret[32], const uint8_t seed[32],
+	const HASH256_CTX *prf_seed_ctx, uint32_t index, uint8_t leaf[32])
+{
+	XMSS_LEAVES_JOB job;
+
+	job.xmss_secret = xmss_secret;
+	job.seed = seed;
+	job.prf_seed_ctx = prf_seed_ctx;
+	job.leaves = (hash256_bytes_t *)leaf;
+	job.first = index;
+	job.last = index + 1;
+	derive_leaves(&job);
+}
+
+// one leaf of treehash[h], the nodes of an unfinished instance are on the top of the stack
+static void bds_treehash_update(SM3_XMSS_BDS *bds, int h,
+	const uint8_t xmss_secret[32], const uint8_t seed[32], const HASH256_CTX *prf_seed_ctx)
+{
+	SM3_XMSS_TREEHASH *treehash = &bds->treehash[h];
+	hash256_bytes_t pair[2];
+	uint8_t adrs[32] = {0};
+	int level = 0;
+
+	bds_derive_leaf(xmss_secret, seed, prf_seed_ctx, treehash->next_index, pair[1]);
+
+	adrs_set_type(adrs, 2);
+	while (treehash->stack_usage > 0 && bds->stack_levels[bds->stack_size - 1] == level) {
+		memcpy(pair[0], bds->stack[bds->stack_size - 1], 32);
+		adrs_set_tree_height(adrs, level);
+		randomized_hash_batch(pair, 1, treehash->next_index >> (level + 1), prf_seed_ctx, adrs, pair + 1);
+		level++;
+		treehash->stack_usage--;
+		bds->stack_size--;
+	}
+
+	if (level == h) {
+		memcpy(treehash->node, pair[1], 32);
+		treehash->completed = 1;
+	} else {
+		memcpy(bds->stack[bds->stack_size], pair[1], 32);
+		bds->stack_levels[bds->stack_size++] = (uint8_t)level;
+		treehash->stack_usage++;
+		treehash->next_index++;
+	}
+}
+
+int sm3_xmss_bds_next(SM3_XMSS_BDS *bds, const uint8_t xmss_secret[32], const uint8_t seed[32])
+{
+	HASH256_CTX prf_seed_ctx;
+	hash256_bytes_t pair[2];
+	uint8_t adrs[32] = {0};
+	uint32_t leaf = bds->index;
+	uint32_t start;
+	int height = bds->height;
+	int tau, low, min_low, h, i, j, k;
+
+	if (leaf + 1 >= ((uint32_t)1 << height)) {
+		error_print();
+		return -1;
+	}
+	hash256_prf_init(&prf_seed_ctx, seed);
+
+	// the lowest 0 bit of leaf, auth[0..tau] change
+	for (tau = 0; (leaf >> tau) & 1; tau++) {
+	}
+
+	if (tau > 0) {
+		memcpy(pair[0], bds->auth[tau - 1], 32);
+		memcpy(pair[1], bds->keep[(tau - 1) >> 1], 32);
+	}
+	if (tau < height - 1 && !((leaf >> (tau + 1)) & 1)) {
+		memcpy(bds->keep[tau >> 1], bds->auth[tau], 32);
+	}
+
+	if (tau == 0) {
+		bds_derive_leaf(xmss_secret, seed, &prf_seed_ctx, leaf, bds->auth[0]);
+	} else {
+		adrs_set_type(adrs, 2);
+		adrs_set_tree_height(adrs, tau - 1);
+		randomized_hash_batch(pair, 1, leaf >> tau, &prf_seed_ctx, adrs, bds->auth + tau);
+
+		for (h = 0; h < tau; h++) {
+			memcpy(bds->auth[h], bds->treehash[h].node, 32);
+
+			start = leaf + 1 + 3 * ((uint32_t)1 << h);
+			if (start < ((uint32_t)1 << height)) {
+				bds->treehash[h].next_index = start;
+				bds->treehash[h].stack_usage = 0;
+				bds->treehash[h].completed = 0;
+			}
+		}
+	}
+
+	// h/2 leaves for the unfinished instance with the lowest node
+	for (j = 0; j < height / 2; j++) {
+		min_low = height;
+		i = height;
+		for (h = 0; h < height; h++) {
+			if (bds->treehash[h].completed) {
+				low = height;
+			} else if (bds->treehash[h].stack_usage == 0) {
+				low = h;
+			} else {
+				low = height;
+				for (k = 0; k < bds->treehash[h].stack_usage; k++) {
+					if (bds->stack_levels[bds->stack_size - 1 - k] < low) {
+						low = bds->stack_levels[bds->stack_size - 1 - k];
+					}
+				}
+			}
+			if (low < min_low) {
+				min_low = low;
+				i = h;
+			}
+		}
+		if (i == height) {
+			break;
+		}
+		bds_treehash_update(bds, i, xmss_secret, seed, &prf_seed_ctx);
+	}
+
+	bds->index++;
+	return 1;
+}
+
+void sm3_xmss_bds_do_sign(const uint8_t xmss_secret[32], const uint8_t seed[32],
+	const uint8_t in_adrs[32], const SM3_XMSS_BDS *bds,
+	const uint8_t dgst[32],
+	hash256_bytes_t wots_sig[67],
+	hash256_bytes_t *auth_path)
+{
+	xmss_wots_sign(xmss_secret, (int)bds->index, seed, in_adrs, dgst, wots_sig);
+	memcpy(auth_path, bds->auth, 32 * bds->height);
+}
+
 int sm3_xmss_height_from_oid(uint32_t *height, uint32_t id)
 {
 	switch (id) {
@@ -509,16 +1001,73 @@ int sm3_xmss_key_generate(SM3_XMSS_KEY *key, uint32_t oid)
 		error_print();
 		return -1;
 	}
+	key->bds = NULL;
 	sm3_xmss_derive_root(key->secret, height, key->seed, key->tree, key->root);
 
 	return 1;
 }
 
+int sm3_xmss_key_generate_bds(SM3_XMSS_KEY *key, uint32_t oid)
+{
+	uint32_t height;
+
+	if (sm3_xmss_height_from_oid(&height, oid) != 1) {
+		error_print();
+		return -1;
+	}
+
+	key->oid = oid;
+	key->index = 0;
+	key->tree = NULL;
+	if (rand_bytes(key->seed, 32) != 1
+		|| rand_bytes(key->secret, 32) != 1
+		|| rand_bytes(key->prf_key, 32) != 1
+		|| !(key->bds = malloc(sizeof(SM3_XMSS_BDS)))) {
+		error_print();
+		return -1;
+	}
+	if (sm3_xmss_bds_init(key->bds, key->secret, height, key->seed, 0, key->root) != 1) {
+		free(key->bds);
+		key->bds = NULL;
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm3_xmss_key_update(SM3_XMSS_KEY *key)
+{
+	uint32_t height;
+
+	if (sm3_xmss_height_from_oid(&height, key->oid) != 1) {
+		error_print();
+		return -1;
+	}
+	if (key->index >= ((uint32_t)1 << height)) {
+		error_print();
+		return -1;
+	}
+	// the last leaf has no next auth path
+	if (key->bds && key->index + 1 < ((uint32_t)1 << height)) {
+		if (key->bds->index != key->index
+			|| sm3_xmss_bds_next(key->bds, key->secret, key->seed) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	key->index++;
+	return 1;
+}
+
 void sm3_xmss_key_cleanup(SM3_XMSS_KEY *key)
 {
 	if (key->tree) {
 		free(key->tree);
 	}
+	if (key->bds) {
+		gmssl_secure_clear(key->bds, sizeof(SM3_XMSS_BDS));
+		free(key->bds);
+	}
 	gmssl_secure_clear(key, sizeof(*key));
 }
 
@@ -544,6 +1093,70 @@ int sm3_xmss_key_get_height(const SM3_XMSS_KEY *key, uint32_t *height)
 	return 1;
 }
 
+// auth || keep || treehash (next_index, stack_usage, completed, node) || stack_size || stack || stack_levels
+static size_t bds_bytes_size(uint32_t height)
+{
+	return 32 * height + 32 * (height / 2) + (4 + 1 + 1 + 32) * height + 1 + (32 + 1) * (height + 1);
+}
+
+static void bds_to_bytes(const SM3_XMSS_BDS *bds, uint8_t *out)
+{
+	uint32_t height = (uint32_t)bds->height;
+	uint32_t h;
+
+	memcpy(out, bds->auth, 32 * height); out += 32 * height;
+	memcpy(out, bds->keep, 32 * (height / 2)); out += 32 * (height / 2);
+	for (h = 0; h < height; h++) {
+		uint32_to_bytes(bds->treehash[h].next_index, out); out += 4;
+		*out++ = bds->treehash[h].stack_usage;
+		*out++ = bds->treehash[h].completed;
+		memcpy(out, bds->treehash[h].node, 32); out += 32;
+	}
+	*out++ = bds->stack_size;
+	memcpy(out, bds->stack, 32 * (height + 1)); out += 32 * (height + 1);
+	memcpy(out, bds->stack_levels, height + 1);
+}
+
+static int bds_from_bytes(SM3_XMSS_BDS *bds, uint32_t height, uint32_t index, const uint8_t *in)
+{
+	size_t stack_usage = 0;
+	uint32_t h;
+
+	memset(bds, 0, sizeof(*bds));
+	bds->height = (int)height;
+	bds->index = index;
+
+	memcpy(bds->auth, in, 32 * height); in += 32 * height;
+	memcpy(bds->keep, in, 32 * (height / 2)); in += 32 * (height / 2);
+	for (h = 0; h < height; h++) {
+		bds->treehash[h].next_index = uint32_from_bytes(in); in += 4;
+		bds->treehash[h].stack_usage = *in++;
+		bds->treehash[h].completed = *in++;
+		memcpy(bds->treehash[h].node, in, 32); in += 32;
+		if (bds->treehash[h].completed > 1
+			|| bds->treehash[h].stack_usage > h
+			|| bds->treehash[h].next_index >= ((uint32_t)1 << height)) {
+			error_print();
+			return -1;
+		}
+		stack_usage += bds->treehash[h].stack_usage;
+	}
+	bds->stack_size = *in++;
+	memcpy(bds->stack, in, 32 * (height + 1)); in += 32 * (height + 1);
+	memcpy(bds->stack_levels, in, height + 1);
+	if (bds->stack_size != stack_usage) {
+		error_print();
+		return -1;
+	}
+	for (h = 0; h < bds->stack_size; h++) {
+		if (bds->stack_levels[h] >= height) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
 int sm3_xmss_key_to_bytes(const SM3_XMSS_KEY *key, uint8_t *out, size_t *outlen)
 {
 	uint32_t height;
@@ -559,8 +1172,12 @@ int sm3_xmss_key_to_bytes(const SM3_XMSS_KEY *key, uint8_t *out, size_t *outlen)
 		error_print();
 		return -1;
 	}
-	tree_size = 32 * ((1 << (height + 1)) - 1);
-	if (!key->tree) {
+	// the tree or the BDS state
+	if (key->tree) {
+		tree_size = 32 * ((1 << (height + 1)) - 1);
+	} else if (key->bds && key->bds->height == (int)height && key->bds->index == key->index) {
+		tree_size = bds_bytes_size(height);
+	} else {
 		error_print();
 		return -1;
 	}
@@ -577,7 +1194,12 @@ int sm3_xmss_key_to_bytes(const SM3_XMSS_KEY *key, uint8_t *out, size_t *outlen)
 	memcpy(p, key->secret, 32); p += 32;
 	memcpy(p, key->prf_key, 32); p += 32;
 	uint32_to_bytes(key->index, p); p += 4;
-	memcpy(p, key->tree, tree_size); p += tree_size;
+	if (key->tree) {
+		memcpy(p, key->tree, tree_size);
+	} else {
+		bds_to_bytes(key->bds, p);
+	}
+	p += tree_size;
 	*outlen = p - out;
 
 	return 1;
@@ -601,7 +1223,8 @@ int sm3_xmss_key_from_bytes(SM3_XMSS_KEY *key, const uint8_t *in, size_t inlen)
 		return -1;
 	}
 	tree_size = 32 * ((1 << (height + 1)) - 1);
-	if (inlen != (4 + 32 * 4 + 4 + tree_size)) {
+	if (inlen != (4 + 32 * 4 + 4 + tree_size)
+		&& inlen != (4 + 32 * 4 + 4 + bds_bytes_size(height))) {
 		error_print();
 		return -1;
 	}
@@ -616,6 +1239,22 @@ int sm3_xmss_key_from_bytes(SM3_XMSS_KEY *key, const uint8_t *in, size_t inlen)
 		return -1;
 	}
 
+	key->tree = NULL;
+	key->bds = NULL;
+	if (inlen != (4 + 32 * 4 + 4 + tree_size)) {
+		if (!(key->bds = malloc(sizeof(SM3_XMSS_BDS)))) {
+			error_print();
+			return -1;
+		}
+		if (bds_from_bytes(key->bds, height, key->index, p) != 1) {
+			free(key->bds);
+			key->bds = NULL;
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+
 	if (!(key->tree = malloc(tree_size))) {
 		error_print();
 		return -1;
@@ -713,8 +1352,12 @@ int sm3_xmss_sign_init(SM3_XMSS_SIGN_CTX *ctx, const SM3_XMSS_KEY *key)
 	// r = PRF(SK_PRF, toByte(idx_sig, 32));
 	hash256_prf_init(&prf_ctx, key->prf_key);
 	uint32_to_bytes(key->index, index_buf + 28);
+#ifdef XMSS_SM3_BATCH
+	sm3_finish32(prf_ctx.digest, prf_ctx.nblocks, index_buf, ctx->random);
+#else
 	hash256_update(&prf_ctx, index_buf, 32);
 	hash256_finish(&prf_ctx, ctx->random);
+#endif
 
 	// H_msg(M) := HASH256(toByte(2, 32) || r || XMSS_ROOT || toByte(idx_sig, 32) || M)
 	hash256_init(&ctx->hash256_ctx);
@@ -744,9 +1387,21 @@ int sm3_xmss_sign_finish(SM3_XMSS_SIGN_CTX *ctx, const SM3_XMSS_KEY *key, uint8_
 
 	hash256_finish(&ctx->hash256_ctx, dgst);
 
-	sm3_xmss_key_get_height(key, &height);
-	sm3_xmss_do_sign(key->secret, key->index, key->seed, adrs, height, key->tree, dgst,
-		sig->wots_sig, sig->auth_path);
+	if (sm3_xmss_key_get_height(key, &height) != 1
+		|| key->index >= ((uint32_t)1 << height)) {
+		error_print();
+		return -1;
+	}
+	if (key->tree) {
+		sm3_xmss_do_sign(key->secret, key->index, key->seed, adrs, height, key->tree, dgst,
+			sig->wots_sig, sig->auth_path);
+	} else if (key->bds && key->bds->index == key->index) {
+		sm3_xmss_bds_do_sign(key->secret, key->seed, adrs, key->bds, dgst,
+			sig->wots_sig, sig->auth_path);
+	} else {
+		error_print();
+		return -1;
+	}
 
 	uint32_to_bytes(key->index, sig->index);
 	memcpy(sig->random, ctx->random, 32);
@@ -9,6 +9,7 @@
 
 #include <gmssl/sm4.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
 
 
 static uint32_t FK[4] = {
@@ -159,7 +160,7 @@ void sm4_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
 	PUTU32(out + 12, X0);
 }
 
-void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+static void sm4_generic_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	while (nblocks--) {
 		sm4_encrypt(key, in, out);
@@ -187,23 +188,23 @@ void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
 	memcpy(iv, piv, 16);
 }
 
-void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
+// `in` might be `out`, the ciphertext block is saved before it is overwritten
+static void sm4_generic_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
 	const uint8_t *in, size_t nblocks, uint8_t *out)
 {
-	const uint8_t *piv = iv;
+	uint8_t block[16];
 
 	while (nblocks--) {
 		size_t i;
+		memcpy(block, in, 16);
 		sm4_encrypt(key, in, out);
 		for (i = 0; i < 16; i++) {
-			out[i] ^= piv[i];
+			out[i] ^= iv[i];
 		}
-		piv = in;
+		memcpy(iv, block, 16);
 		in += 16;
 		out += 16;
 	}
-
-	memcpy(iv, piv, 16);
 }
 
 static void ctr_incr(uint8_t a[16]) {
@@ -239,7 +240,7 @@ static void ctr32_incr(uint8_t a[16]) {
 	}
 }
 
-void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+static void sm4_generic_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	uint8_t block[16];
 	int i;
@@ -584,7 +585,7 @@ void sm4_encrypt(const SM4_KEY *key, const unsigned char in[16], unsigned char o
 	PUTU32(out,               X0);
 }
 
-void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+static void sm4_generic_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	const uint32_t *rk = key->rk;
 	uint32_t X0, X1, X2, X3, X4;
@@ -702,10 +703,10 @@ void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *i
 	PUTU32(iv     , X0);
 	PUTU32(iv +  4, X4);
 	PUTU32(iv +  8, X3);
-	PUTU32(iv + 12, X2);
+	PUTU32(iv + 12, X5);
 }
 
-void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+static void sm4_generic_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	const uint32_t *rk = key->rk;
 	uint32_t IV0, IV1, IV2, IV3;
@@ -846,7 +847,7 @@ void sm4_ctr_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *
 	PUTU64(ctr + 8, C1);
 }
 
-void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+static void sm4_generic_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	const uint32_t *rk = key->rk;
 	uint32_t X0, X1, X2, X3, X4;
@@ -914,3 +915,216 @@ void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t
 	PUTU32(ctr + 12, C3);
 }
 #endif //ENABLE_SMALL_FOOTPRINT
+
+
+/*
+ * Runtime selection of the bulk kernels
+ *
+ * All the backends enabled at build time (ENABLE_SM4_AESNI, ENABLE_SM4_AVX2,
+ * ENABLE_SM4_AVX512, ENABLE_SM4_ARM64, ENABLE_SM4_CE, ENABLE_SM4_RISCV, ENABLE_SM4_WASM) are compiled into the library with their
+ * own target flags, the widest one supported by the running CPU is chosen
+ * once, at library load time when the compiler supports constructors and
+ * on the first call otherwise. The generic code is always the fallback,
+ * replaced by the constant-time bit-sliced kernels when ENABLE_SM4_BITSLICE
+ * is set.
+ */
+
+typedef void (*sm4_encrypt_blocks_func)(const SM4_KEY *key,
+	const uint8_t *in, size_t nblocks, uint8_t *out);
+typedef void (*sm4_ctr32_encrypt_blocks_func)(const SM4_KEY *key,
+	uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+typedef void (*sm4_cbc_decrypt_blocks_func)(const SM4_KEY *key,
+	uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+
+static sm4_encrypt_blocks_func sm4_encrypt_blocks_impl = NULL;
+static sm4_ctr32_encrypt_blocks_func sm4_ctr32_encrypt_blocks_impl = NULL;
+static sm4_cbc_decrypt_blocks_func sm4_cbc_decrypt_blocks_impl = NULL;
+
+// the multi-key kernels take `sm4_multi_key_lanes` blocks with their own keys
+typedef void (*sm4_encrypt_multi_key_func)(const SM4_KEY *const *keys,
+	const uint8_t *const *in, uint8_t *const *out);
+typedef void (*sm4_set_encrypt_key_multi_func)(SM4_KEY *const *keys,
+	const uint8_t *const *user_keys);
+
+#define SM4_MULTI_KEY_MAX_LANES	16
+
+static sm4_encrypt_multi_key_func sm4_encrypt_multi_key_impl = NULL;
+static sm4_set_encrypt_key_multi_func sm4_set_encrypt_key_multi_impl = NULL;
+static size_t sm4_multi_key_lanes = 1;
+
+static void sm4_generic_encrypt_multi_key(const SM4_KEY *const *keys,
+	const uint8_t *const *in, uint8_t *const *out)
+{
+	sm4_encrypt(keys[0], in[0], out[0]);
+}
+
+static void sm4_generic_set_encrypt_key_multi(SM4_KEY *const *keys,
+	const uint8_t *const *user_keys)
+{
+	sm4_set_encrypt_key(keys[0], user_keys[0]);
+}
+
+#if defined(__GNUC__) || defined(__clang__)
+__attribute__((constructor))
+#endif
+static void sm4_dispatch_init(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+	sm4_encrypt_blocks_func encrypt_blocks = sm4_generic_encrypt_blocks;
+	sm4_ctr32_encrypt_blocks_func ctr32_encrypt_blocks = sm4_generic_ctr32_encrypt_blocks;
+	sm4_cbc_decrypt_blocks_func cbc_decrypt_blocks = sm4_generic_cbc_decrypt_blocks;
+	sm4_encrypt_multi_key_func encrypt_multi_key = sm4_generic_encrypt_multi_key;
+	sm4_set_encrypt_key_multi_func set_encrypt_key_multi = sm4_generic_set_encrypt_key_multi;
+	size_t multi_key_lanes = 1;
+
+	(void)cpu;
+
+#ifdef ENABLE_SM4_BITSLICE
+	encrypt_blocks = sm4_bitslice_encrypt_blocks;
+	ctr32_encrypt_blocks = sm4_bitslice_ctr32_encrypt_blocks;
+	cbc_decrypt_blocks = sm4_bitslice_cbc_decrypt_blocks;
+#endif
+#ifdef ENABLE_SM4_ARM64
+	if (cpu & GMSSL_CPU_NEON) {
+		encrypt_blocks = sm4_arm64_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_arm64_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_arm64_cbc_decrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_SM4_CE
+	if (cpu & GMSSL_CPU_ARM_SM4) {
+		encrypt_blocks = sm4_ce_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_ce_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_ce_cbc_decrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_SM4_RISCV
+	if (cpu & GMSSL_CPU_RISCV_ZKSED) {
+		encrypt_blocks = sm4_riscv_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_riscv_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_riscv_cbc_decrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_SM4_WASM
+	if (cpu & GMSSL_CPU_WASM_SIMD128) {
+		encrypt_blocks = sm4_wasm_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_wasm_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_wasm_cbc_decrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_SM4_AESNI
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) {
+		encrypt_blocks = sm4_aesni_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_aesni_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_aesni_cbc_decrypt_blocks;
+	}
+#endif
+#ifdef ENABLE_SM4_AVX2
+	if (cpu & GMSSL_CPU_AVX2) {
+		encrypt_blocks = sm4_avx2_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_avx2_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_avx2_cbc_decrypt_blocks;
+		encrypt_multi_key = sm4_avx2_encrypt_multi_key;
+		set_encrypt_key_multi = sm4_avx2_set_encrypt_key_multi;
+		multi_key_lanes = 8;
+	}
+#endif
+#ifdef ENABLE_SM4_AVX512
+	if ((cpu & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_GFNI))
+		== (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_GFNI)) {
+		encrypt_blocks = sm4_avx512_encrypt_blocks;
+		ctr32_encrypt_blocks = sm4_avx512_ctr32_encrypt_blocks;
+		cbc_decrypt_blocks = sm4_avx512_cbc_decrypt_blocks;
+		encrypt_multi_key = sm4_avx512_encrypt_multi_key;
+		set_encrypt_key_multi = sm4_avx512_set_encrypt_key_multi;
+		multi_key_lanes = 16;
+	}
+#endif
+
+	sm4_multi_key_lanes = multi_key_lanes;
+	sm4_set_encrypt_key_multi_impl = set_encrypt_key_multi;
+	sm4_encrypt_multi_key_impl = encrypt_multi_key;
+	sm4_cbc_decrypt_blocks_impl = cbc_decrypt_blocks;
+	sm4_ctr32_encrypt_blocks_impl = ctr32_encrypt_blocks;
+	sm4_encrypt_blocks_impl = encrypt_blocks;
+}
+
+void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!sm4_encrypt_blocks_impl) {
+		sm4_dispatch_init();
+	}
+	sm4_encrypt_blocks_impl(key, in, nblocks, out);
+}
+
+void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!sm4_ctr32_encrypt_blocks_impl) {
+		sm4_dispatch_init();
+	}
+	sm4_ctr32_encrypt_blocks_impl(key, ctr, in, nblocks, out);
+}
+
+void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (!sm4_cbc_decrypt_blocks_impl) {
+		sm4_dispatch_init();
+	}
+	sm4_cbc_decrypt_blocks_impl(key, iv, in, nblocks, out);
+}
+
+// blocks that do not fill all the lanes are left to `sm4_encrypt`
+void sm4_encrypt_multi_key(const SM4_MULTI_KEY_JOB *jobs, size_t njobs)
+{
+	const SM4_KEY *keys[SM4_MULTI_KEY_MAX_LANES];
+	const uint8_t *in[SM4_MULTI_KEY_MAX_LANES];
+	uint8_t *out[SM4_MULTI_KEY_MAX_LANES];
+	size_t lanes, n = 0, i, j;
+
+	if (!sm4_encrypt_multi_key_impl) {
+		sm4_dispatch_init();
+	}
+	lanes = sm4_multi_key_lanes;
+
+	for (i = 0; i < njobs; i++) {
+		for (j = 0; j < jobs[i].nblocks; j++) {
+			keys[n] = jobs[i].key;
+			in[n] = jobs[i].in + 16 * j;
+			out[n] = jobs[i].out + 16 * j;
+			if (++n == lanes) {
+				sm4_encrypt_multi_key_impl(keys, in, out);
+				n = 0;
+			}
+		}
+	}
+	for (i = 0; i < n; i++) {
+		sm4_encrypt(keys[i], in[i], out[i]);
+	}
+}
+
+void sm4_set_encrypt_key_multi(SM4_KEY *keys, const uint8_t *user_keys, size_t nkeys)
+{
+	SM4_KEY *key_ptrs[SM4_MULTI_KEY_MAX_LANES];
+	const uint8_t *user_key_ptrs[SM4_MULTI_KEY_MAX_LANES];
+	size_t lanes, i;
+
+	if (!sm4_set_encrypt_key_multi_impl) {
+		sm4_dispatch_init();
+	}
+	lanes = sm4_multi_key_lanes;
+
+	while (nkeys >= lanes) {
+		for (i = 0; i < lanes; i++) {
+			key_ptrs[i] = keys + i;
+			user_key_ptrs[i] = user_keys + 16 * i;
+		}
+		sm4_set_encrypt_key_multi_impl(key_ptrs, user_key_ptrs);
+		keys += lanes;
+		user_keys += 16 * lanes;
+		nkeys -= lanes;
+	}
+	while (nkeys--) {
+		sm4_set_encrypt_key(keys++, user_keys);
+		user_keys += 16;
+	}
+}
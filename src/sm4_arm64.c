@@ -9,26 +9,12 @@
 
 
 #include <gmssl/sm4.h>
+#include <gmssl/mem.h>
 #include <gmssl/endian.h>
 #include <arm_neon.h>
 
 
-static uint32_t FK[4] = {
-	0xa3b1bac6, 0x56aa3350, 0x677d9197, 0xb27022dc,
-};
-
-static uint32_t CK[32] = {
-	0x00070e15, 0x1c232a31, 0x383f464d, 0x545b6269,
-	0x70777e85, 0x8c939aa1, 0xa8afb6bd, 0xc4cbd2d9,
-	0xe0e7eef5, 0xfc030a11, 0x181f262d, 0x343b4249,
-	0x50575e65, 0x6c737a81, 0x888f969d, 0xa4abb2b9,
-	0xc0c7ced5, 0xdce3eaf1, 0xf8ff060d, 0x141b2229,
-	0x30373e45, 0x4c535a61, 0x686f767d, 0x848b9299,
-	0xa0a7aeb5, 0xbcc3cad1, 0xd8dfe6ed, 0xf4fb0209,
-	0x10171e25, 0x2c333a41, 0x484f565d, 0x646b7279,
-};
-
-const uint8_t S[256] = {
+static const uint8_t S[256] = {
 	0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7,
 	0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
 	0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3,
@@ -71,70 +57,9 @@ const uint8_t S[256] = {
 	ROL32((X), 18) ^			\
 	ROL32((X), 24))
 
-#define L32_(X)					\
-	((X) ^ 					\
-	ROL32((X), 13) ^			\
-	ROL32((X), 23))
-
-#define S32(A)					\
-	((S[((A) >> 24)       ] << 24) |	\
-	 (S[((A) >> 16) & 0xff] << 16) |	\
-	 (S[((A) >>  8) & 0xff] <<  8) |	\
-	 (S[((A))       & 0xff]))
-
-
-void sm4_set_encrypt_key(SM4_KEY *key, const uint8_t user_key[16])
-{
-	uint32_t X0, X1, X2, X3, X4;
-	int i;
-
-	X0 = GETU32(user_key     ) ^ FK[0];
-	X1 = GETU32(user_key  + 4) ^ FK[1];
-	X2 = GETU32(user_key  + 8) ^ FK[2];
-	X3 = GETU32(user_key + 12) ^ FK[3];
-
-	for (i = 0; i < 32; i++) {
-
-		X4 = X1 ^ X2 ^ X3 ^ CK[i];
-		X4 = S32(X4);
-		X4 = X0 ^ L32_(X4);
-
-		key->rk[i] = X4;
-
-		X0 = X1;
-		X1 = X2;
-		X2 = X3;
-		X3 = X4;
-	}
-}
-
-void sm4_set_decrypt_key(SM4_KEY *key, const uint8_t user_key[16])
-{
-	uint32_t X0, X1, X2, X3, X4;
-	int i;
-
-	X0 = GETU32(user_key     ) ^ FK[0];
-	X1 = GETU32(user_key  + 4) ^ FK[1];
-	X2 = GETU32(user_key  + 8) ^ FK[2];
-	X3 = GETU32(user_key + 12) ^ FK[3];
-
-	for (i = 0; i < 32; i++) {
-
-		X4 = X1 ^ X2 ^ X3 ^ CK[i];
-		X4 = S32(X4);
-		X4 = X0 ^ L32_(X4);
-
-		key->rk[31 - i] = X4;
-
-		X0 = X1;
-		X1 = X2;
-		X2 = X3;
-		X3 = X4;
-	}
-}
 
 // const time sbox with neon tbl/tbx
-void sm4_encrypt(const SM4_KEY *key, const unsigned char in[16], unsigned char out[16])
+static void sm4_arm64_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
 {
 	uint8x16x4_t S0 = vld1q_u8_x4(S);
 	uint8x16x4_t S1 = vld1q_u8_x4(S + 64);
@@ -175,81 +100,10 @@ void sm4_encrypt(const SM4_KEY *key, const unsigned char in[16], unsigned char o
 	PUTU32(out + 12, X0);
 }
 
-void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	while (nblocks--) {
-		sm4_encrypt(key, in, out);
-		in += 16;
-		out += 16;
-	}
-}
-
-void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
-	const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	const uint8_t *piv = iv;
-
-	while (nblocks--) {
-		size_t i;
-		for (i = 0; i < 16; i++) {
-			out[i] = in[i] ^ piv[i];
-		}
-		sm4_encrypt(key, out, out);
-		piv = out;
-		in += 16;
-		out += 16;
-	}
-
-	memcpy(iv, piv, 16);
-}
-
-void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
-	const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	const uint8_t *piv = iv;
-
-	while (nblocks--) {
-		size_t i;
-		sm4_encrypt(key, in, out);
-		for (i = 0; i < 16; i++) {
-			out[i] ^= piv[i];
-		}
-		piv = in;
-		in += 16;
-		out += 16;
-	}
-
-	memcpy(iv, piv, 16);
-}
-
-static void ctr_incr(uint8_t a[16]) {
-	int i;
-	for (i = 15; i >= 0; i--) {
-		a[i]++;
-		if (a[i]) break;
-	}
-}
-
-void sm4_ctr_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	uint8_t block[16];
-	int i;
-
-	while (nblocks--) {
-		sm4_encrypt(key, ctr, block);
-		ctr_incr(ctr);
-		for (i = 0; i < 16; i++) {
-			out[i] = in[i] ^ block[i];
-		}
-		in += 16;
-		out += 16;
-	}
-}
-
 #define vrolq_n_u32(words, nbits) \
 	vorrq_u32(vshlq_n_u32((words), (nbits)), vshrq_n_u32((words), 32 - (nbits)))
 
-void sm4_ctr32_encrypt_4blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t n4blks, uint8_t *out)
+static void sm4_arm64_ctr32_encrypt_4blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t n4blks, uint8_t *out)
 {
 	uint8x16x4_t S0 = vld1q_u8_x4(S);
 	uint8x16x4_t S1 = vld1q_u8_x4(S + 64);
@@ -351,6 +205,78 @@ void sm4_ctr32_encrypt_4blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t
 	PUTU32(iv + 12, n);
 }
 
+static void sm4_arm64_encrypt_4blocks(const SM4_KEY *key, const uint8_t *in, size_t n4blks, uint8_t *out)
+{
+	uint8x16x4_t S0 = vld1q_u8_x4(S);
+	uint8x16x4_t S1 = vld1q_u8_x4(S + 64);
+	uint8x16x4_t S2 = vld1q_u8_x4(S + 128);
+	uint8x16x4_t S3 = vld1q_u8_x4(S + 192);
+	uint32x4_t x0, x1, x2, x3, x4;
+	uint32x4_t rk, xt;
+	uint32x4x4_t blks;
+	int i;
+
+	while (n4blks--) {
+
+		// transpose, x0 holds the first words of the 4 blocks
+		blks = vld4q_u32((const uint32_t *)in);
+		x0 = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(blks.val[0])));
+		x1 = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(blks.val[1])));
+		x2 = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(blks.val[2])));
+		x3 = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(blks.val[3])));
+
+		for (i = 0; i < 32; i++) {
+			rk = vdupq_n_u32(key->rk[i]);
+			x4 = veorq_u32(veorq_u32(x1, x2), veorq_u32(x3, rk));
+
+			xt = vreinterpretq_u32_u8(vqtbl4q_u8(S0, vreinterpretq_u8_u32(x4)));
+			xt = vreinterpretq_u32_u8(vqtbx4q_u8(vreinterpretq_u8_u32(xt), S1,
+				veorq_u8(vreinterpretq_u8_u32(x4), vdupq_n_u8(0x40))));
+			xt = vreinterpretq_u32_u8(vqtbx4q_u8(vreinterpretq_u8_u32(xt), S2,
+				veorq_u8(vreinterpretq_u8_u32(x4), vdupq_n_u8(0x80))));
+			x4 = vreinterpretq_u32_u8(vqtbx4q_u8(vreinterpretq_u8_u32(xt), S3,
+				veorq_u8(vreinterpretq_u8_u32(x4), vdupq_n_u8(0xc0))));
+
+			xt = veorq_u32(x4, vrolq_n_u32(x4,  2));
+			xt = veorq_u32(xt, vrolq_n_u32(x4, 10));
+			xt = veorq_u32(xt, vrolq_n_u32(x4, 18));
+			x4 = veorq_u32(xt, vrolq_n_u32(x4, 24));
+
+			x4 = veorq_u32(x0, x4);
+			x0 = x1;
+			x1 = x2;
+			x2 = x3;
+			x3 = x4;
+		}
+
+		// output x3,x2,x1,x0
+		blks.val[0] = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(x3)));
+		blks.val[1] = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(x2)));
+		blks.val[2] = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(x1)));
+		blks.val[3] = vreinterpretq_u32_u8(vrev32q_u8(vreinterpretq_u8_u32(x0)));
+		vst4q_u32((uint32_t *)out, blks);
+
+		in += 64;
+		out += 64;
+	}
+}
+
+void sm4_arm64_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	if (nblocks >= 4) {
+		sm4_arm64_encrypt_4blocks(key, in, nblocks/4, out);
+		in += 64 * (nblocks/4);
+		out += 64 * (nblocks/4);
+		nblocks %= 4;
+	}
+
+	while (nblocks--) {
+		sm4_arm64_encrypt(key, in, out);
+		in += 16;
+		out += 16;
+	}
+}
+
 static void ctr32_incr(uint8_t a[16]) {
 	int i;
 	for (i = 15; i >= 12; i--) {
@@ -359,20 +285,20 @@ static void ctr32_incr(uint8_t a[16]) {
 	}
 }
 
-void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+void sm4_arm64_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	uint8_t block[16];
 	int i;
 
 	if (nblocks >= 4) {
-		sm4_ctr32_encrypt_4blocks(key, ctr, in, nblocks/4, out);
+		sm4_arm64_ctr32_encrypt_4blocks(key, ctr, in, nblocks/4, out);
 		in += 64 * (nblocks/4);
 		out += 64 * (nblocks/4);
 		nblocks %= 4;
 	}
 
 	while (nblocks--) {
-		sm4_encrypt(key, ctr, block);
+		sm4_arm64_encrypt(key, ctr, block);
 		ctr32_incr(ctr);
 		for (i = 0; i < 16; i++) {
 			out[i] = in[i] ^ block[i];
@@ -381,3 +307,32 @@ void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t
 		out += 16;
 	}
 }
+
+// the blocks are decrypted 16 at a time, the XOR runs backwards so that `in` == `out` works
+void sm4_arm64_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16 * 16];
+	uint8_t next_iv[16];
+	size_t len, i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 16 ? nblocks : 16;
+
+		len = 16 * nb;
+		memcpy(next_iv, in + len - 16, 16);
+		sm4_arm64_encrypt_blocks(key, in, nb, block);
+
+		for (i = len; i > 16; i--) {
+			out[i - 1] = block[i - 1] ^ in[i - 17];
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = block[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+
+		in += len;
+		out += len;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
@@ -9,159 +9,11 @@
 
 #include <stdint.h>
 #include <gmssl/sm4.h>
+#include <gmssl/mem.h>
 #include <gmssl/endian.h>
 #include <immintrin.h>
 
 
-static uint32_t FK[4] = {
-	0xa3b1bac6, 0x56aa3350, 0x677d9197, 0xb27022dc,
-};
-
-static uint32_t CK[32] = {
-	0x00070e15, 0x1c232a31, 0x383f464d, 0x545b6269,
-	0x70777e85, 0x8c939aa1, 0xa8afb6bd, 0xc4cbd2d9,
-	0xe0e7eef5, 0xfc030a11, 0x181f262d, 0x343b4249,
-	0x50575e65, 0x6c737a81, 0x888f969d, 0xa4abb2b9,
-	0xc0c7ced5, 0xdce3eaf1, 0xf8ff060d, 0x141b2229,
-	0x30373e45, 0x4c535a61, 0x686f767d, 0x848b9299,
-	0xa0a7aeb5, 0xbcc3cad1, 0xd8dfe6ed, 0xf4fb0209,
-	0x10171e25, 0x2c333a41, 0x484f565d, 0x646b7279,
-};
-
-const uint8_t S[256] = {
-	0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7,
-	0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
-	0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3,
-	0xaa, 0x44, 0x13, 0x26, 0x49, 0x86, 0x06, 0x99,
-	0x9c, 0x42, 0x50, 0xf4, 0x91, 0xef, 0x98, 0x7a,
-	0x33, 0x54, 0x0b, 0x43, 0xed, 0xcf, 0xac, 0x62,
-	0xe4, 0xb3, 0x1c, 0xa9, 0xc9, 0x08, 0xe8, 0x95,
-	0x80, 0xdf, 0x94, 0xfa, 0x75, 0x8f, 0x3f, 0xa6,
-	0x47, 0x07, 0xa7, 0xfc, 0xf3, 0x73, 0x17, 0xba,
-	0x83, 0x59, 0x3c, 0x19, 0xe6, 0x85, 0x4f, 0xa8,
-	0x68, 0x6b, 0x81, 0xb2, 0x71, 0x64, 0xda, 0x8b,
-	0xf8, 0xeb, 0x0f, 0x4b, 0x70, 0x56, 0x9d, 0x35,
-	0x1e, 0x24, 0x0e, 0x5e, 0x63, 0x58, 0xd1, 0xa2,
-	0x25, 0x22, 0x7c, 0x3b, 0x01, 0x21, 0x78, 0x87,
-	0xd4, 0x00, 0x46, 0x57, 0x9f, 0xd3, 0x27, 0x52,
-	0x4c, 0x36, 0x02, 0xe7, 0xa0, 0xc4, 0xc8, 0x9e,
-	0xea, 0xbf, 0x8a, 0xd2, 0x40, 0xc7, 0x38, 0xb5,
-	0xa3, 0xf7, 0xf2, 0xce, 0xf9, 0x61, 0x15, 0xa1,
-	0xe0, 0xae, 0x5d, 0xa4, 0x9b, 0x34, 0x1a, 0x55,
-	0xad, 0x93, 0x32, 0x30, 0xf5, 0x8c, 0xb1, 0xe3,
-	0x1d, 0xf6, 0xe2, 0x2e, 0x82, 0x66, 0xca, 0x60,
-	0xc0, 0x29, 0x23, 0xab, 0x0d, 0x53, 0x4e, 0x6f,
-	0xd5, 0xdb, 0x37, 0x45, 0xde, 0xfd, 0x8e, 0x2f,
-	0x03, 0xff, 0x6a, 0x72, 0x6d, 0x6c, 0x5b, 0x51,
-	0x8d, 0x1b, 0xaf, 0x92, 0xbb, 0xdd, 0xbc, 0x7f,
-	0x11, 0xd9, 0x5c, 0x41, 0x1f, 0x10, 0x5a, 0xd8,
-	0x0a, 0xc1, 0x31, 0x88, 0xa5, 0xcd, 0x7b, 0xbd,
-	0x2d, 0x74, 0xd0, 0x12, 0xb8, 0xe5, 0xb4, 0xb0,
-	0x89, 0x69, 0x97, 0x4a, 0x0c, 0x96, 0x77, 0x7e,
-	0x65, 0xb9, 0xf1, 0x09, 0xc5, 0x6e, 0xc6, 0x84,
-	0x18, 0xf0, 0x7d, 0xec, 0x3a, 0xdc, 0x4d, 0x20,
-	0x79, 0xee, 0x5f, 0x3e, 0xd7, 0xcb, 0x39, 0x48,
-};
-
-#define L32(X)					\
-	((X) ^					\
-	ROL32((X),  2) ^			\
-	ROL32((X), 10) ^			\
-	ROL32((X), 18) ^			\
-	ROL32((X), 24))
-
-#define L32_(X)					\
-	((X) ^ 					\
-	ROL32((X), 13) ^			\
-	ROL32((X), 23))
-
-#define S32(A)					\
-	((S[((A) >> 24)       ] << 24) |	\
-	 (S[((A) >> 16) & 0xff] << 16) |	\
-	 (S[((A) >>  8) & 0xff] <<  8) |	\
-	 (S[((A))       & 0xff]))
-
-
-void sm4_set_encrypt_key(SM4_KEY *key, const uint8_t user_key[16])
-{
-	uint32_t X0, X1, X2, X3, X4;
-	int i;
-
-	X0 = GETU32(user_key     ) ^ FK[0];
-	X1 = GETU32(user_key  + 4) ^ FK[1];
-	X2 = GETU32(user_key  + 8) ^ FK[2];
-	X3 = GETU32(user_key + 12) ^ FK[3];
-
-	for (i = 0; i < 32; i++) {
-
-		X4 = X1 ^ X2 ^ X3 ^ CK[i];
-		X4 = S32(X4);
-		X4 = X0 ^ L32_(X4);
-
-		key->rk[i] = X4;
-
-		X0 = X1;
-		X1 = X2;
-		X2 = X3;
-		X3 = X4;
-	}
-}
-
-void sm4_set_decrypt_key(SM4_KEY *key, const uint8_t user_key[16])
-{
-	uint32_t X0, X1, X2, X3, X4;
-	int i;
-
-	X0 = GETU32(user_key     ) ^ FK[0];
-	X1 = GETU32(user_key  + 4) ^ FK[1];
-	X2 = GETU32(user_key  + 8) ^ FK[2];
-	X3 = GETU32(user_key + 12) ^ FK[3];
-
-	for (i = 0; i < 32; i++) {
-
-		X4 = X1 ^ X2 ^ X3 ^ CK[i];
-		X4 = S32(X4);
-		X4 = X0 ^ L32_(X4);
-
-		key->rk[31 - i] = X4;
-
-		X0 = X1;
-		X1 = X2;
-		X2 = X3;
-		X3 = X4;
-	}
-}
-
-void sm4_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
-{
-	uint32_t X0, X1, X2, X3, X4;
-	int i;
-
-	X0 = GETU32(in     );
-	X1 = GETU32(in +  4);
-	X2 = GETU32(in +  8);
-	X3 = GETU32(in + 12);
-
-	for (i = 0; i < 32; i++) {
-
-		X4 = X1 ^ X2 ^ X3 ^ key->rk[i];
-		X4 = S32(X4);
-		X4 = X0 ^ L32(X4);
-
-		X0 = X1;
-		X1 = X2;
-		X2 = X3;
-		X3 = X4;
-	}
-
-	PUTU32(out     , X3);
-	PUTU32(out +  4, X2);
-	PUTU32(out +  8, X1);
-	PUTU32(out + 12, X0);
-}
-
-
-
 #define GET_BLKS(x0, x1, x2, x3, in)					\
 	t0 = _mm256_i32gather_epi32((int *)(in+4*0), vindex_4i, 4);	\
 	t1 = _mm256_i32gather_epi32((int *)(in+4*1), vindex_4i, 4);	\
@@ -196,7 +48,11 @@ void sm4_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
 
 
 #define ROUND(i, x0, x1, x2, x3, x4)					\
-	t0 = _mm256_set1_epi32(*(rk + i));				\
+	ROUND_K(_mm256_set1_epi32(*(rk + i)), x0, x1, x2, x3, x4)
+
+// one round with the round keys `k` of the 8 lanes
+#define ROUND_K(k, x0, x1, x2, x3, x4)					\
+	t0 = k;								\
 	t1 = _mm256_xor_si256(x1, x2);					\
 	t2 = _mm256_xor_si256(x3, t0);					\
 	x4 = _mm256_xor_si256(t1, t2);					\
@@ -220,7 +76,7 @@ void sm4_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
 
 
 // T0[i] = L32(S[i] << 24)
-const uint32_t SM4_T[256] = {
+static const uint32_t SM4_T[256] = {
 	0x8ed55b5b, 0xd0924242, 0x4deaa7a7, 0x06fdfbfb,
 	0xfccf3333, 0x65e28787, 0xc93df4f4, 0x6bb5dede,
 	0x4e165858, 0x6eb4dada, 0x44145050, 0xcac10b0b,
@@ -288,7 +144,7 @@ const uint32_t SM4_T[256] = {
 };
 
 
-void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+void sm4_avx2_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	const int *rk = (int *)key->rk;
 	__m256i x0, x1, x2, x3, x4;
@@ -353,70 +209,6 @@ void sm4_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, u
 	}
 }
 
-void sm4_cbc_encrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
-	const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	const uint8_t *piv = iv;
-
-	while (nblocks--) {
-		size_t i;
-		for (i = 0; i < 16; i++) {
-			out[i] = in[i] ^ piv[i];
-		}
-		sm4_encrypt(key, out, out);
-		piv = out;
-		in += 16;
-		out += 16;
-	}
-
-	memcpy(iv, piv, 16);
-}
-
-void sm4_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
-	const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	const uint8_t *piv = iv;
-
-	while (nblocks--) {
-		size_t i;
-		sm4_encrypt(key, in, out);
-		for (i = 0; i < 16; i++) {
-			out[i] ^= piv[i];
-		}
-		piv = in;
-		in += 16;
-		out += 16;
-	}
-
-	memcpy(iv, piv, 16);
-}
-
-
-
-static void ctr_incr(uint8_t a[16]) {
-	int i;
-	for (i = 15; i >= 0; i--) {
-		a[i]++;
-		if (a[i]) break;
-	}
-}
-
-void sm4_ctr_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
-{
-	uint8_t block[16];
-	int i;
-
-	while (nblocks--) {
-		sm4_encrypt(key, ctr, block);
-		ctr_incr(ctr);
-		for (i = 0; i < 16; i++) {
-			out[i] = in[i] ^ block[i];
-		}
-		in += 16;
-		out += 16;
-	}
-}
-
 // inc32() in nist-sp800-38d
 static void ctr32_incr(uint8_t a[16]) {
 	int i;
@@ -426,7 +218,7 @@ static void ctr32_incr(uint8_t a[16]) {
 	}
 }
 
-void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+void sm4_avx2_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
 {
 	const int *rk = (int *)key->rk;
 	__m256i x0, x1, x2, x3, x4;
@@ -517,64 +309,203 @@ void sm4_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t
 	}
 }
 
+// the blocks are decrypted 16 at a time, the XOR runs backwards so that `in` == `out` works
+void sm4_avx2_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16 * 16];
+	uint8_t next_iv[16];
+	size_t len, i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 16 ? nblocks : 16;
+
+		len = 16 * nb;
+		memcpy(next_iv, in + len - 16, 16);
+		sm4_avx2_encrypt_blocks(key, in, nb, block);
+
+		for (i = len; i > 16; i--) {
+			out[i - 1] = block[i - 1] ^ in[i - 17];
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = block[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+
+		in += len;
+		out += len;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+
 /*
-int main(void)
+ * Multi-key kernels, lane j runs with its own key `keys[j]`. The round keys
+ * are transposed into `rks[i * 8 + j]` so that every round loads the 8 lane
+ * keys with one vector load.
+ */
+
+#define RK(i) _mm256_loadu_si256((const __m256i *)(rks + 8 * (i)))
+
+void sm4_avx2_encrypt_multi_key(const SM4_KEY *const keys[8], const uint8_t *const in[8], uint8_t *const out[8])
 {
-	const uint8_t key[16] = {
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-	};
-	const uint8_t plaintext[16 * 8] = {
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-	};
-	const uint8_t ciphertext[16 * 8] = {
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-	};
-
-	SM4_KEY sm4_key;
-	unsigned char buf[16 * 8];
-	int i;
+	uint32_t rks[32 * 8];
+	uint8_t buf[16 * 8];
+	__m256i x0, x1, x2, x3, x4;
+	__m256i t0, t1, t2, t3;
+	__m256i vindex_4i = _mm256_setr_epi32(0,4,8,12,16,20,24,28);
+	__m256i vindex_mask = _mm256_set1_epi32(0xff);
+	__m256i vindex_read = _mm256_setr_epi32(0,8,16,24,1,9,17,25);
+	__m256i vindex_swap = _mm256_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12
+	);
+	int i, j;
+
+	for (j = 0; j < 8; j++) {
+		for (i = 0; i < 32; i++) {
+			rks[8 * i + j] = keys[j]->rk[i];
+		}
+		memcpy(buf + 16 * j, in[j], 16);
+	}
+
+	GET_BLKS(x0, x1, x2, x3, buf);
+
+	ROUND_K(RK( 0), x0, x1, x2, x3, x4);
+	ROUND_K(RK( 1), x1, x2, x3, x4, x0);
+	ROUND_K(RK( 2), x2, x3, x4, x0, x1);
+	ROUND_K(RK( 3), x3, x4, x0, x1, x2);
+	ROUND_K(RK( 4), x4, x0, x1, x2, x3);
+	ROUND_K(RK( 5), x0, x1, x2, x3, x4);
+	ROUND_K(RK( 6), x1, x2, x3, x4, x0);
+	ROUND_K(RK( 7), x2, x3, x4, x0, x1);
+	ROUND_K(RK( 8), x3, x4, x0, x1, x2);
+	ROUND_K(RK( 9), x4, x0, x1, x2, x3);
+	ROUND_K(RK(10), x0, x1, x2, x3, x4);
+	ROUND_K(RK(11), x1, x2, x3, x4, x0);
+	ROUND_K(RK(12), x2, x3, x4, x0, x1);
+	ROUND_K(RK(13), x3, x4, x0, x1, x2);
+	ROUND_K(RK(14), x4, x0, x1, x2, x3);
+	ROUND_K(RK(15), x0, x1, x2, x3, x4);
+	ROUND_K(RK(16), x1, x2, x3, x4, x0);
+	ROUND_K(RK(17), x2, x3, x4, x0, x1);
+	ROUND_K(RK(18), x3, x4, x0, x1, x2);
+	ROUND_K(RK(19), x4, x0, x1, x2, x3);
+	ROUND_K(RK(20), x0, x1, x2, x3, x4);
+	ROUND_K(RK(21), x1, x2, x3, x4, x0);
+	ROUND_K(RK(22), x2, x3, x4, x0, x1);
+	ROUND_K(RK(23), x3, x4, x0, x1, x2);
+	ROUND_K(RK(24), x4, x0, x1, x2, x3);
+	ROUND_K(RK(25), x0, x1, x2, x3, x4);
+	ROUND_K(RK(26), x1, x2, x3, x4, x0);
+	ROUND_K(RK(27), x2, x3, x4, x0, x1);
+	ROUND_K(RK(28), x3, x4, x0, x1, x2);
+	ROUND_K(RK(29), x4, x0, x1, x2, x3);
+	ROUND_K(RK(30), x0, x1, x2, x3, x4);
+	ROUND_K(RK(31), x1, x2, x3, x4, x0);
+
+	PUT_BLKS(buf, x0, x4, x3, x2);
+
+	for (j = 0; j < 8; j++) {
+		memcpy(out[j], buf + 16 * j, 16);
+	}
+	gmssl_secure_clear(rks, sizeof(rks));
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
+// the S-box, padded so that a 32-bit gather at any index stays in the table
+static const uint8_t SM4_S[256 + 3] = {
+	0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7,
+	0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
+	0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3,
+	0xaa, 0x44, 0x13, 0x26, 0x49, 0x86, 0x06, 0x99,
+	0x9c, 0x42, 0x50, 0xf4, 0x91, 0xef, 0x98, 0x7a,
+	0x33, 0x54, 0x0b, 0x43, 0xed, 0xcf, 0xac, 0x62,
+	0xe4, 0xb3, 0x1c, 0xa9, 0xc9, 0x08, 0xe8, 0x95,
+	0x80, 0xdf, 0x94, 0xfa, 0x75, 0x8f, 0x3f, 0xa6,
+	0x47, 0x07, 0xa7, 0xfc, 0xf3, 0x73, 0x17, 0xba,
+	0x83, 0x59, 0x3c, 0x19, 0xe6, 0x85, 0x4f, 0xa8,
+	0x68, 0x6b, 0x81, 0xb2, 0x71, 0x64, 0xda, 0x8b,
+	0xf8, 0xeb, 0x0f, 0x4b, 0x70, 0x56, 0x9d, 0x35,
+	0x1e, 0x24, 0x0e, 0x5e, 0x63, 0x58, 0xd1, 0xa2,
+	0x25, 0x22, 0x7c, 0x3b, 0x01, 0x21, 0x78, 0x87,
+	0xd4, 0x00, 0x46, 0x57, 0x9f, 0xd3, 0x27, 0x52,
+	0x4c, 0x36, 0x02, 0xe7, 0xa0, 0xc4, 0xc8, 0x9e,
+	0xea, 0xbf, 0x8a, 0xd2, 0x40, 0xc7, 0x38, 0xb5,
+	0xa3, 0xf7, 0xf2, 0xce, 0xf9, 0x61, 0x15, 0xa1,
+	0xe0, 0xae, 0x5d, 0xa4, 0x9b, 0x34, 0x1a, 0x55,
+	0xad, 0x93, 0x32, 0x30, 0xf5, 0x8c, 0xb1, 0xe3,
+	0x1d, 0xf6, 0xe2, 0x2e, 0x82, 0x66, 0xca, 0x60,
+	0xc0, 0x29, 0x23, 0xab, 0x0d, 0x53, 0x4e, 0x6f,
+	0xd5, 0xdb, 0x37, 0x45, 0xde, 0xfd, 0x8e, 0x2f,
+	0x03, 0xff, 0x6a, 0x72, 0x6d, 0x6c, 0x5b, 0x51,
+	0x8d, 0x1b, 0xaf, 0x92, 0xbb, 0xdd, 0xbc, 0x7f,
+	0x11, 0xd9, 0x5c, 0x41, 0x1f, 0x10, 0x5a, 0xd8,
+	0x0a, 0xc1, 0x31, 0x88, 0xa5, 0xcd, 0x7b, 0xbd,
+	0x2d, 0x74, 0xd0, 0x12, 0xb8, 0xe5, 0xb4, 0xb0,
+	0x89, 0x69, 0x97, 0x4a, 0x0c, 0x96, 0x77, 0x7e,
+	0x65, 0xb9, 0xf1, 0x09, 0xc5, 0x6e, 0xc6, 0x84,
+	0x18, 0xf0, 0x7d, 0xec, 0x3a, 0xdc, 0x4d, 0x20,
+	0x79, 0xee, 0x5f, 0x3e, 0xd7, 0xcb, 0x39, 0x48,
+	0x00, 0x00, 0x00,
+};
 
-	sm4_set_encrypt_key(&sm4_key, key);
+void sm4_avx2_set_encrypt_key_multi(SM4_KEY *const keys[8], const uint8_t *const user_keys[8])
+{
+	uint32_t rk[8];
+	uint8_t buf[16 * 8];
+	__m256i x0, x1, x2, x3, x4;
+	__m256i t0, t1, t2, t3;
+	__m256i vindex_4i = _mm256_setr_epi32(0,4,8,12,16,20,24,28);
+	__m256i vindex_mask = _mm256_set1_epi32(0xff);
+	__m256i vindex_swap = _mm256_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12,
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12
+	);
+	int i, j;
+
+	for (j = 0; j < 8; j++) {
+		memcpy(buf + 16 * j, user_keys[j], 16);
+	}
+	GET_BLKS(x0, x1, x2, x3, buf);
 
-	sm4_encrypt_blocks(&sm4_key, plaintext, 8, buf);
+	x0 = _mm256_xor_si256(x0, _mm256_set1_epi32((int)0xa3b1bac6));
+	x1 = _mm256_xor_si256(x1, _mm256_set1_epi32((int)0x56aa3350));
+	x2 = _mm256_xor_si256(x2, _mm256_set1_epi32((int)0x677d9197));
+	x3 = _mm256_xor_si256(x3, _mm256_set1_epi32((int)0xb27022dc));
+
+	for (i = 0; i < 32; i++) {
+		// CK[i] has the bytes 28i + 7k mod 256, k = 0..3
+		uint8_t c = (uint8_t)(28 * i);
+		uint32_t ck = ((uint32_t)c << 24) | ((uint32_t)(uint8_t)(c + 7) << 16)
+			| ((uint32_t)(uint8_t)(c + 14) << 8) | (uint8_t)(c + 21);
+
+		t0 = _mm256_xor_si256(_mm256_xor_si256(x1, x2),
+			_mm256_xor_si256(x3, _mm256_set1_epi32((int)ck)));
+
+		t1 = _mm256_i32gather_epi32((const int *)SM4_S, _mm256_and_si256(t0, vindex_mask), 1);
+		t1 = _mm256_and_si256(t1, vindex_mask);
+		t2 = _mm256_i32gather_epi32((const int *)SM4_S, _mm256_and_si256(_mm256_srli_epi32(t0, 8), vindex_mask), 1);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(_mm256_and_si256(t2, vindex_mask), 8));
+		t2 = _mm256_i32gather_epi32((const int *)SM4_S, _mm256_and_si256(_mm256_srli_epi32(t0, 16), vindex_mask), 1);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(_mm256_and_si256(t2, vindex_mask), 16));
+		t2 = _mm256_i32gather_epi32((const int *)SM4_S, _mm256_srli_epi32(t0, 24), 1);
+		t1 = _mm256_or_si256(t1, _mm256_slli_epi32(t2, 24));
+
+		t3 = _mm256_xor_si256(_mm256_rotl_epi32(t1, 13), _mm256_rotl_epi32(t1, 23));
+		x4 = _mm256_xor_si256(x0, _mm256_xor_si256(t1, t3));
+
+		_mm256_storeu_si256((__m256i *)rk, x4);
+		for (j = 0; j < 8; j++) {
+			keys[j]->rk[i] = rk[j];
+		}
 
-	if (memcmp(buf, ciphertext, 16) != 0) {
-		fprintf(stderr, "sm4 encrypt not pass!\n");
-		return -1;
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = x4;
 	}
 
-	printf("%s() ok\n", __FUNCTION__);
-	return 1;
+	gmssl_secure_clear(rk, sizeof(rk));
+	gmssl_secure_clear(buf, sizeof(buf));
 }
-*/
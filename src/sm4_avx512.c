@@ -0,0 +1,349 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <stdint.h>
+#include <string.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm4.h>
+#include <gmssl/endian.h>
+#include <immintrin.h>
+
+
+/*
+ * SM4 S-box with GFNI
+ *
+ * The SM4 S-box is S(x) = A * inv(A * x + C) + C with the inversion in
+ * GF(2^8) mod x^8 + x^7 + x^6 + x^5 + x^4 + x^2 + 1. Mapping this field to
+ * the AES field by an isomorphism T folds into the affine transforms:
+ *
+ *	S(x) = (A * T^-1) * inv_aes((T * A) * x + T * C) + C
+ *
+ * so one vgf2p8affineqb and one vgf2p8affineinvqb compute 64 S-boxes.
+ */
+#define SM4_GFNI_PRE_MATRIX	0x4c287db91a22505dULL // T * A
+#define SM4_GFNI_PRE_CONST	0x3e // T * C
+#define SM4_GFNI_POST_MATRIX	0xf3ab34a974a6b589ULL // A * T^-1
+#define SM4_GFNI_POST_CONST	0xd3 // C
+
+#define SM4_SBOX(x)									\
+	_mm512_gf2p8affineinv_epi64_epi8(						\
+		_mm512_gf2p8affine_epi64_epi8((x), pre_matrix, SM4_GFNI_PRE_CONST),	\
+		post_matrix, SM4_GFNI_POST_CONST)
+
+#define SM4_L(x)									\
+	_mm512_xor_si512(_mm512_xor_si512(						\
+		_mm512_xor_si512((x), _mm512_rol_epi32((x), 2)),			\
+		_mm512_xor_si512(_mm512_rol_epi32((x), 10), _mm512_rol_epi32((x), 18))),\
+		_mm512_rol_epi32((x), 24))
+
+#define ROUND(i, x0, x1, x2, x3)							\
+	ROUND_K(_mm512_set1_epi32((int)rk[i]), x0, x1, x2, x3)
+
+// one round with the round keys `k` of the 16 lanes
+#define ROUND_K(k, x0, x1, x2, x3)							\
+	t = _mm512_xor_si512(_mm512_xor_si512(x1, x2), _mm512_xor_si512(x3, k));	\
+	t = SM4_SBOX(t);								\
+	x0 = _mm512_xor_si512(x0, SM4_L(t))
+
+// transpose 4x4 words in every 128-bit lane, it is an involution
+#define TRANSPOSE(x0, x1, x2, x3)							\
+	t0 = _mm512_unpacklo_epi32(x0, x1);						\
+	t1 = _mm512_unpacklo_epi32(x2, x3);						\
+	t2 = _mm512_unpackhi_epi32(x0, x1);						\
+	t3 = _mm512_unpackhi_epi32(x2, x3);						\
+	x0 = _mm512_unpacklo_epi64(t0, t1);						\
+	x1 = _mm512_unpackhi_epi64(t0, t1);						\
+	x2 = _mm512_unpacklo_epi64(t2, t3);						\
+	x3 = _mm512_unpackhi_epi64(t2, t3)
+
+
+/*
+ * Encrypt the 16 blocks in `b[0..3]` (4 blocks per register, in memory order).
+ * Word i of each block is moved to register i, after the 32 rounds the output
+ * words (X35, X34, X33, X32) are transposed back.
+ */
+static inline void sm4_avx512_encrypt_16blocks(const uint32_t *rk, __m512i b[4])
+{
+	const __m512i pre_matrix = _mm512_set1_epi64(SM4_GFNI_PRE_MATRIX);
+	const __m512i post_matrix = _mm512_set1_epi64(SM4_GFNI_POST_MATRIX);
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12));
+	__m512i x0 = b[0], x1 = b[1], x2 = b[2], x3 = b[3];
+	__m512i t, t0, t1, t2, t3;
+	int i;
+
+	TRANSPOSE(x0, x1, x2, x3);
+	x0 = _mm512_shuffle_epi8(x0, bswap);
+	x1 = _mm512_shuffle_epi8(x1, bswap);
+	x2 = _mm512_shuffle_epi8(x2, bswap);
+	x3 = _mm512_shuffle_epi8(x3, bswap);
+
+	for (i = 0; i < 32; i += 4) {
+		ROUND(i    , x0, x1, x2, x3);
+		ROUND(i + 1, x1, x2, x3, x0);
+		ROUND(i + 2, x2, x3, x0, x1);
+		ROUND(i + 3, x3, x0, x1, x2);
+	}
+
+	b[0] = _mm512_shuffle_epi8(x3, bswap);
+	b[1] = _mm512_shuffle_epi8(x2, bswap);
+	b[2] = _mm512_shuffle_epi8(x1, bswap);
+	b[3] = _mm512_shuffle_epi8(x0, bswap);
+	TRANSPOSE(b[0], b[1], b[2], b[3]);
+}
+
+void sm4_avx512_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	__m512i b[4];
+	int i;
+
+	while (nblocks >= 16) {
+		for (i = 0; i < 4; i++) {
+			b[i] = _mm512_loadu_si512((const void *)(in + 64 * i));
+		}
+		sm4_avx512_encrypt_16blocks(key->rk, b);
+		for (i = 0; i < 4; i++) {
+			_mm512_storeu_si512((void *)(out + 64 * i), b[i]);
+		}
+		in += 256;
+		out += 256;
+		nblocks -= 16;
+	}
+
+	if (nblocks) {
+		uint8_t buf[256] = {0};
+
+		memcpy(buf, in, 16 * nblocks);
+		for (i = 0; i < 4; i++) {
+			b[i] = _mm512_loadu_si512((const void *)(buf + 64 * i));
+		}
+		sm4_avx512_encrypt_16blocks(key->rk, b);
+		for (i = 0; i < 4; i++) {
+			_mm512_storeu_si512((void *)(buf + 64 * i), b[i]);
+		}
+		memcpy(out, buf, 16 * nblocks);
+		gmssl_secure_clear(buf, sizeof(buf));
+	}
+}
+
+void sm4_avx512_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12));
+	// the 16 low words of the counter blocks, in the order of the 4 registers
+	const __m512i incr = _mm512_setr_epi32(0,0,0,0, 1,1,1,1, 2,2,2,2, 3,3,3,3);
+	__m512i base, b[4];
+	uint32_t n = GETU32(ctr + 12);
+	int i;
+
+	// block_{i} = ctr[0..11] || n + i, stored big-endian, 4 blocks per register
+	base = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)ctr));
+	base = _mm512_shuffle_epi8(base, bswap);
+
+	while (nblocks) {
+		size_t nb = nblocks < 16 ? nblocks : 16;
+
+		for (i = 0; i < 4; i++) {
+			__m512i c = _mm512_add_epi32(incr, _mm512_set1_epi32((int)(n + 4 * i)));
+			b[i] = _mm512_mask_mov_epi32(base, 0x8888, c);
+			b[i] = _mm512_shuffle_epi8(b[i], bswap);
+		}
+		sm4_avx512_encrypt_16blocks(key->rk, b);
+
+		if (nb == 16) {
+			for (i = 0; i < 4; i++) {
+				__m512i d = _mm512_loadu_si512((const void *)(in + 64 * i));
+				_mm512_storeu_si512((void *)(out + 64 * i), _mm512_xor_si512(b[i], d));
+			}
+		} else {
+			uint8_t buf[256];
+			size_t j;
+
+			for (i = 0; i < 4; i++) {
+				_mm512_storeu_si512((void *)(buf + 64 * i), b[i]);
+			}
+			for (j = 0; j < 16 * nb; j++) {
+				out[j] = in[j] ^ buf[j];
+			}
+			gmssl_secure_clear(buf, sizeof(buf));
+		}
+
+		n += (uint32_t)nb;
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+
+	PUTU32(ctr + 12, n);
+}
+
+void sm4_avx512_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	__m512i c[4], b[4];
+	__m512i last;
+	int i;
+
+	// top 128-bit lane of `last` is always the previous ciphertext block
+	last = _mm512_broadcast_i32x4(_mm_loadu_si128((const __m128i *)iv));
+
+	while (nblocks >= 16) {
+		for (i = 0; i < 4; i++) {
+			b[i] = c[i] = _mm512_loadu_si512((const void *)(in + 64 * i));
+		}
+		sm4_avx512_encrypt_16blocks(key->rk, b);
+
+		for (i = 0; i < 4; i++) {
+			__m512i prev = _mm512_alignr_epi32(c[i], i ? c[i - 1] : last, 12);
+			_mm512_storeu_si512((void *)(out + 64 * i), _mm512_xor_si512(b[i], prev));
+		}
+		last = c[3];
+
+		in += 256;
+		out += 256;
+		nblocks -= 16;
+	}
+
+	_mm_storeu_si128((__m128i *)iv, _mm512_extracti32x4_epi32(last, 3));
+
+	if (nblocks) {
+		uint8_t buf[256];
+		uint8_t cbuf[256];
+		size_t j;
+
+		memcpy(cbuf, in, 16 * nblocks);
+		sm4_avx512_encrypt_blocks(key, cbuf, nblocks, buf);
+		for (j = 0; j < 16; j++) {
+			out[j] = buf[j] ^ iv[j];
+		}
+		for (j = 16; j < 16 * nblocks; j++) {
+			out[j] = buf[j] ^ cbuf[j - 16];
+		}
+		memcpy(iv, cbuf + 16 * (nblocks - 1), 16);
+		gmssl_secure_clear(buf, sizeof(buf));
+	}
+}
+
+
+/*
+ * Multi-key kernels, block j runs with its own key `keys[j]`. After TRANSPOSE
+ * dword p of the registers belongs to block 4 * (p % 4) + p / 4, so the round
+ * keys are transposed into `rks[i * 16 + p]` in this order.
+ */
+#define LANE_BLOCK(p)	(4 * ((p) & 3) + ((p) >> 2))
+
+void sm4_avx512_encrypt_multi_key(const SM4_KEY *const keys[16], const uint8_t *const in[16], uint8_t *const out[16])
+{
+	const __m512i pre_matrix = _mm512_set1_epi64(SM4_GFNI_PRE_MATRIX);
+	const __m512i post_matrix = _mm512_set1_epi64(SM4_GFNI_POST_MATRIX);
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12));
+	uint32_t rks[32 * 16];
+	uint8_t buf[256];
+	__m512i x0, x1, x2, x3;
+	__m512i t, t0, t1, t2, t3;
+	int i, p;
+
+	for (p = 0; p < 16; p++) {
+		const uint32_t *rk = keys[LANE_BLOCK(p)]->rk;
+		for (i = 0; i < 32; i++) {
+			rks[16 * i + p] = rk[i];
+		}
+		memcpy(buf + 16 * p, in[p], 16);
+	}
+
+	x0 = _mm512_loadu_si512((const void *)(buf));
+	x1 = _mm512_loadu_si512((const void *)(buf + 64));
+	x2 = _mm512_loadu_si512((const void *)(buf + 128));
+	x3 = _mm512_loadu_si512((const void *)(buf + 192));
+	TRANSPOSE(x0, x1, x2, x3);
+	x0 = _mm512_shuffle_epi8(x0, bswap);
+	x1 = _mm512_shuffle_epi8(x1, bswap);
+	x2 = _mm512_shuffle_epi8(x2, bswap);
+	x3 = _mm512_shuffle_epi8(x3, bswap);
+
+	for (i = 0; i < 32; i += 4) {
+		ROUND_K(_mm512_loadu_si512((const void *)(rks + 16 * i)), x0, x1, x2, x3);
+		ROUND_K(_mm512_loadu_si512((const void *)(rks + 16 * (i + 1))), x1, x2, x3, x0);
+		ROUND_K(_mm512_loadu_si512((const void *)(rks + 16 * (i + 2))), x2, x3, x0, x1);
+		ROUND_K(_mm512_loadu_si512((const void *)(rks + 16 * (i + 3))), x3, x0, x1, x2);
+	}
+
+	t0 = _mm512_shuffle_epi8(x3, bswap);
+	t1 = _mm512_shuffle_epi8(x2, bswap);
+	t2 = _mm512_shuffle_epi8(x1, bswap);
+	t3 = _mm512_shuffle_epi8(x0, bswap);
+	x0 = t0;
+	x1 = t1;
+	x2 = t2;
+	x3 = t3;
+	TRANSPOSE(x0, x1, x2, x3);
+	_mm512_storeu_si512((void *)(buf), x0);
+	_mm512_storeu_si512((void *)(buf + 64), x1);
+	_mm512_storeu_si512((void *)(buf + 128), x2);
+	_mm512_storeu_si512((void *)(buf + 192), x3);
+
+	for (p = 0; p < 16; p++) {
+		memcpy(out[p], buf + 16 * p, 16);
+	}
+	gmssl_secure_clear(rks, sizeof(rks));
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
+void sm4_avx512_set_encrypt_key_multi(SM4_KEY *const keys[16], const uint8_t *const user_keys[16])
+{
+	const __m512i pre_matrix = _mm512_set1_epi64(SM4_GFNI_PRE_MATRIX);
+	const __m512i post_matrix = _mm512_set1_epi64(SM4_GFNI_POST_MATRIX);
+	const __m512i bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(
+		3,2,1,0,7,6,5,4,11,10,9,8,15,14,13,12));
+	uint32_t rk[16];
+	uint8_t buf[256];
+	__m512i x0, x1, x2, x3, x4;
+	__m512i t, t0, t1, t2, t3;
+	int i, p;
+
+	for (p = 0; p < 16; p++) {
+		memcpy(buf + 16 * p, user_keys[p], 16);
+	}
+	x0 = _mm512_loadu_si512((const void *)(buf));
+	x1 = _mm512_loadu_si512((const void *)(buf + 64));
+	x2 = _mm512_loadu_si512((const void *)(buf + 128));
+	x3 = _mm512_loadu_si512((const void *)(buf + 192));
+	TRANSPOSE(x0, x1, x2, x3);
+	x0 = _mm512_xor_si512(_mm512_shuffle_epi8(x0, bswap), _mm512_set1_epi32((int)0xa3b1bac6));
+	x1 = _mm512_xor_si512(_mm512_shuffle_epi8(x1, bswap), _mm512_set1_epi32((int)0x56aa3350));
+	x2 = _mm512_xor_si512(_mm512_shuffle_epi8(x2, bswap), _mm512_set1_epi32((int)0x677d9197));
+	x3 = _mm512_xor_si512(_mm512_shuffle_epi8(x3, bswap), _mm512_set1_epi32((int)0xb27022dc));
+
+	for (i = 0; i < 32; i++) {
+		// CK[i] has the bytes 28i + 7k mod 256, k = 0..3
+		uint8_t c = (uint8_t)(28 * i);
+		uint32_t ck = ((uint32_t)c << 24) | ((uint32_t)(uint8_t)(c + 7) << 16)
+			| ((uint32_t)(uint8_t)(c + 14) << 8) | (uint8_t)(c + 21);
+
+		t = _mm512_xor_si512(_mm512_xor_si512(x1, x2),
+			_mm512_xor_si512(x3, _mm512_set1_epi32((int)ck)));
+		t = SM4_SBOX(t);
+		x4 = _mm512_xor_si512(_mm512_xor_si512(x0, t),
+			_mm512_xor_si512(_mm512_rol_epi32(t, 13), _mm512_rol_epi32(t, 23)));
+
+		_mm512_storeu_si512((void *)rk, x4);
+		for (p = 0; p < 16; p++) {
+			keys[LANE_BLOCK(p)]->rk[i] = rk[p];
+		}
+
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = x4;
+	}
+
+	gmssl_secure_clear(rk, sizeof(rk));
+	gmssl_secure_clear(buf, sizeof(buf));
+}
@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * Bit-sliced SM4, 64 blocks at a time
+ *
+ * Every block word is kept as 32 uint64_t slices, slice i holds bit i of the
+ * word of all the 64 blocks, bit b of a slice belongs to block b. The round
+ * function then only uses AND/XOR/NOT on whole slices: the rotations of L
+ * are index permutations and the S-box is computed algebraically,
+ *
+ *   S(x) = A * (A * x + 0xd3)^-1 + 0xd3
+ *
+ * with the inversion in GF(2^8) = GF(2)[x]/(x^8+x^7+x^6+x^5+x^4+x^2+1)
+ * done as x^254 with 4 multiplications and 7 squarings. There are no table
+ * lookups and no secret dependent branches or addresses.
+ *
+ * A partial batch is padded with zero blocks, so the cost of any call is
+ * ceil(nblocks/64) batches. This backend is meant for CPUs without a SIMD
+ * backend (RISC-V, older ARM servers), the dispatcher prefers the SIMD ones.
+ */
+
+#include <string.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+
+
+#define SM4_BS_BLOCKS	64
+
+
+// a[i] bit b <=> a[b] bit i
+static void transpose64(uint64_t a[64])
+{
+	uint64_t m = 0x00000000ffffffffULL;
+	uint64_t t;
+	int j, k;
+
+	for (j = 32; j; j >>= 1, m ^= m << j) {
+		for (k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+			t = ((a[k] >> j) ^ a[k | j]) & m;
+			a[k | j] ^= t;
+			a[k] ^= t << j;
+		}
+	}
+}
+
+// X[j][i] = bit i of the j-th (big-endian) word of all blocks
+static void sm4_bs_load(uint64_t X[4][32], const uint8_t *in, size_t nblocks)
+{
+	uint64_t t[64];
+	size_t i, j;
+
+	for (j = 0; j < 4; j += 2) {
+		for (i = 0; i < nblocks; i++) {
+			t[i] = ((uint64_t)GETU32(in + 16 * i + 4 * j) << 32) | GETU32(in + 16 * i + 4 * j + 4);
+		}
+		for (; i < SM4_BS_BLOCKS; i++) {
+			t[i] = 0;
+		}
+		transpose64(t);
+		memcpy(X[j], t + 32, sizeof(X[j]));
+		memcpy(X[j + 1], t, sizeof(X[j + 1]));
+	}
+}
+
+static void sm4_bs_store(uint64_t X[4][32], uint8_t *out, size_t nblocks)
+{
+	uint64_t t[64];
+	size_t i, j;
+
+	for (j = 0; j < 4; j += 2) {
+		memcpy(t + 32, X[j], sizeof(X[j]));
+		memcpy(t, X[j + 1], sizeof(X[j + 1]));
+		transpose64(t);
+		for (i = 0; i < nblocks; i++) {
+			PUTU32(out + 16 * i + 4 * j, (uint32_t)(t[i] >> 32));
+			PUTU32(out + 16 * i + 4 * j + 4, (uint32_t)t[i]);
+		}
+	}
+	gmssl_secure_clear(t, sizeof(t));
+}
+
+// y = A * x + 0xd3
+static void sm4_bs_affine(uint64_t y[8], const uint64_t x[8])
+{
+	uint64_t t[8];
+
+	t[0] = ~(x[0] ^ x[1] ^ x[2] ^ x[5] ^ x[7]);
+	t[1] = ~(x[0] ^ x[1] ^ x[2] ^ x[3] ^ x[6]);
+	t[2] =   x[1] ^ x[2] ^ x[3] ^ x[4] ^ x[7];
+	t[3] =   x[0] ^ x[2] ^ x[3] ^ x[4] ^ x[5];
+	t[4] = ~(x[1] ^ x[3] ^ x[4] ^ x[5] ^ x[6]);
+	t[5] =   x[2] ^ x[4] ^ x[5] ^ x[6] ^ x[7];
+	t[6] = ~(x[0] ^ x[3] ^ x[5] ^ x[6] ^ x[7]);
+	t[7] = ~(x[0] ^ x[1] ^ x[4] ^ x[6] ^ x[7]);
+
+	memcpy(y, t, sizeof(t));
+}
+
+// y = x^2 mod (x^8+x^7+x^6+x^5+x^4+x^2+1), `y` might be `x`
+static void sm4_bs_sqr(uint64_t y[8], const uint64_t x[8])
+{
+	uint64_t t[8];
+
+	t[0] = x[0] ^ x[4];
+	t[1] = x[5] ^ x[7];
+	t[2] = x[1] ^ x[4] ^ x[5];
+	t[3] = x[5] ^ x[6] ^ x[7];
+	t[4] = x[2] ^ x[4] ^ x[5] ^ x[6];
+	t[5] = x[4] ^ x[5] ^ x[6];
+	t[6] = x[3] ^ x[4] ^ x[6];
+	t[7] = x[4] ^ x[6];
+
+	memcpy(y, t, sizeof(t));
+}
+
+// r = a * b mod (x^8+x^7+x^6+x^5+x^4+x^2+1), `r` might be `a` or `b`
+static void sm4_bs_mul(uint64_t r[8], const uint64_t a[8], const uint64_t b[8])
+{
+	uint64_t t[15] = {0};
+	int i, j;
+
+	for (i = 0; i < 8; i++) {
+		for (j = 0; j < 8; j++) {
+			t[i + j] ^= a[i] & b[j];
+		}
+	}
+	// x^8 = x^7 + x^6 + x^5 + x^4 + x^2 + 1
+	for (i = 14; i >= 8; i--) {
+		t[i - 1] ^= t[i];
+		t[i - 2] ^= t[i];
+		t[i - 3] ^= t[i];
+		t[i - 4] ^= t[i];
+		t[i - 6] ^= t[i];
+		t[i - 8] ^= t[i];
+	}
+	memcpy(r, t, sizeof(uint64_t) * 8);
+}
+
+static void sm4_bs_sbox(uint64_t x[8])
+{
+	uint64_t y[8], y2[8], y3[8], y12[8], y15[8];
+
+	sm4_bs_affine(y, x);
+	sm4_bs_sqr(y2, y);
+	sm4_bs_mul(y3, y2, y);
+	sm4_bs_sqr(y12, y3);
+	sm4_bs_sqr(y12, y12);
+	sm4_bs_mul(y15, y12, y3);
+	sm4_bs_sqr(y15, y15);
+	sm4_bs_sqr(y15, y15);
+	sm4_bs_sqr(y15, y15);
+	sm4_bs_sqr(y15, y15);		// y^240
+	sm4_bs_mul(y15, y15, y12);	// y^252
+	sm4_bs_mul(y15, y15, y2);	// y^254 = y^-1
+	sm4_bs_affine(x, y15);
+}
+
+static void sm4_bs_encrypt(const uint32_t rk[32], uint64_t X[4][32])
+{
+	uint64_t T[32];
+	uint64_t *X0, *X1, *X2, *X3;
+	int r, i;
+
+	for (r = 0; r < 32; r++) {
+		X0 = X[r & 3];
+		X1 = X[(r + 1) & 3];
+		X2 = X[(r + 2) & 3];
+		X3 = X[(r + 3) & 3];
+
+		// every round key bit is broadcast to a whole slice with a mask, no branch
+		for (i = 0; i < 32; i++) {
+			T[i] = X1[i] ^ X2[i] ^ X3[i] ^ (0 - (uint64_t)((rk[r] >> i) & 1));
+		}
+		for (i = 0; i < 32; i += 8) {
+			sm4_bs_sbox(T + i);
+		}
+		// X4 = X0 ^ L(T), ROL32(T, n) moves bit i - n to bit i
+		for (i = 0; i < 32; i++) {
+			X0[i] ^= T[i]
+				^ T[(i -  2) & 31]
+				^ T[(i - 10) & 31]
+				^ T[(i - 18) & 31]
+				^ T[(i - 24) & 31];
+		}
+	}
+
+	// X32..X35 are in X[0..3], the output is (X35, X34, X33, X32)
+	memcpy(T, X[0], sizeof(T));
+	memcpy(X[0], X[3], sizeof(T));
+	memcpy(X[3], T, sizeof(T));
+	memcpy(T, X[1], sizeof(T));
+	memcpy(X[1], X[2], sizeof(T));
+	memcpy(X[2], T, sizeof(T));
+
+	gmssl_secure_clear(T, sizeof(T));
+}
+
+void sm4_bitslice_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint64_t X[4][32];
+
+	while (nblocks) {
+		size_t nb = nblocks < SM4_BS_BLOCKS ? nblocks : SM4_BS_BLOCKS;
+
+		sm4_bs_load(X, in, nb);
+		sm4_bs_encrypt(key->rk, X);
+		sm4_bs_store(X, out, nb);
+
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(X, sizeof(X));
+}
+
+void sm4_bitslice_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16 * SM4_BS_BLOCKS];
+	uint32_t c3 = GETU32(ctr + 12);
+	size_t len, i;
+
+	while (nblocks) {
+		size_t nb = nblocks < SM4_BS_BLOCKS ? nblocks : SM4_BS_BLOCKS;
+
+		len = 16 * nb;
+		for (i = 0; i < nb; i++) {
+			memcpy(block + 16 * i, ctr, 12);
+			PUTU32(block + 16 * i + 12, c3);
+			c3++;
+		}
+		sm4_bitslice_encrypt_blocks(key, block, nb, block);
+		for (i = 0; i < len; i++) {
+			out[i] = in[i] ^ block[i];
+		}
+
+		in += len;
+		out += len;
+		nblocks -= nb;
+	}
+	PUTU32(ctr + 12, c3);
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+// the XOR runs backwards so that `in` == `out` works
+void sm4_bitslice_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16 * SM4_BS_BLOCKS];
+	uint8_t next_iv[16];
+	size_t len, i;
+
+	while (nblocks) {
+		size_t nb = nblocks < SM4_BS_BLOCKS ? nblocks : SM4_BS_BLOCKS;
+
+		len = 16 * nb;
+		memcpy(next_iv, in + len - 16, 16);
+		sm4_bitslice_encrypt_blocks(key, in, nb, block);
+
+		for (i = len; i > 16; i--) {
+			out[i - 1] = block[i - 1] ^ in[i - 17];
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = block[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+
+		in += len;
+		out += len;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
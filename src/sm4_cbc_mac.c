@@ -47,3 +47,147 @@ void sm4_cbc_mac_finish(SM4_CBC_MAC_CTX *ctx, uint8_t mac[16])
 	}
 	memcpy(mac, ctx->iv, 16);
 }
+
+static void sm4_cmac_dbl(uint8_t out[16], const uint8_t in[16])
+{
+	uint8_t carry = in[0] >> 7;
+	int i;
+	for (i = 0; i < 15; i++) {
+		out[i] = (in[i] << 1) | (in[i + 1] >> 7);
+	}
+	out[15] = (in[15] << 1) ^ (carry ? 0x87 : 0);
+}
+
+void sm4_cmac_init(SM4_CMAC_CTX *ctx, const uint8_t key[16])
+{
+	uint8_t L[16] = {0};
+
+	sm4_set_encrypt_key(&ctx->key, key);
+	sm4_encrypt(&ctx->key, L, L);
+	sm4_cmac_dbl(ctx->k1, L);
+	sm4_cmac_dbl(ctx->k2, ctx->k1);
+	memset(ctx->iv, 0, 16);
+	ctx->block_nbytes = 0;
+	gmssl_secure_clear(L, sizeof(L));
+}
+
+// the last block is kept until more data comes or finish
+void sm4_cmac_update(SM4_CMAC_CTX *ctx, const uint8_t *data, size_t datalen)
+{
+	while (datalen) {
+		size_t len;
+		if (ctx->block_nbytes == 16) {
+			gmssl_memxor(ctx->iv, ctx->iv, ctx->block, 16);
+			sm4_encrypt(&ctx->key, ctx->iv, ctx->iv);
+			ctx->block_nbytes = 0;
+		}
+		len = datalen < 16 - ctx->block_nbytes ? datalen : 16 - ctx->block_nbytes;
+		memcpy(ctx->block + ctx->block_nbytes, data, len);
+		ctx->block_nbytes += len;
+		data += len;
+		datalen -= len;
+	}
+}
+
+void sm4_cmac_finish(SM4_CMAC_CTX *ctx, uint8_t mac[16])
+{
+	if (ctx->block_nbytes == 16) {
+		gmssl_memxor(ctx->iv, ctx->iv, ctx->k1, 16);
+	} else {
+		ctx->block[ctx->block_nbytes] = 0x80;
+		memset(ctx->block + ctx->block_nbytes + 1, 0, 16 - ctx->block_nbytes - 1);
+		gmssl_memxor(ctx->iv, ctx->iv, ctx->k2, 16);
+	}
+	gmssl_memxor(ctx->iv, ctx->iv, ctx->block, 16);
+	sm4_encrypt(&ctx->key, ctx->iv, ctx->iv);
+	memcpy(mac, ctx->iv, 16);
+}
+
+typedef struct {
+	size_t idx;
+	const uint8_t *p;
+	size_t left;
+	int done;
+} SM4_MAC_LANE;
+
+// CBC-MAC if `k1` is NULL, else CMAC with the subkeys `k1` and `k2`
+static void sm4_mac_batch(const SM4_KEY *key, const uint8_t *k1, const uint8_t *k2,
+	const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *macs)
+{
+	SM4_MAC_LANE lanes[SM4_MAC_BATCH_LANES];
+	uint8_t state[SM4_MAC_BATCH_LANES * 16];
+	uint8_t last[16];
+	size_t next = 0;
+	size_t n = 0;
+	size_t i;
+
+	for (;;) {
+		// keep the lanes full
+		while (n < SM4_MAC_BATCH_LANES && next < cnt) {
+			if (!k1 && !msglens[next]) {
+				memset(macs + 16 * next, 0, 16);
+				next++;
+				continue;
+			}
+			lanes[n].idx = next;
+			lanes[n].p = msgs[next];
+			lanes[n].left = msglens[next];
+			lanes[n].done = 0;
+			memset(state + 16 * n, 0, 16);
+			next++;
+			n++;
+		}
+		if (!n) {
+			break;
+		}
+
+		for (i = 0; i < n; i++) {
+			SM4_MAC_LANE *lane = &lanes[i];
+			if (lane->left > 16) {
+				gmssl_memxor(state + 16 * i, state + 16 * i, lane->p, 16);
+				lane->p += 16;
+				lane->left -= 16;
+				continue;
+			}
+			memset(last, 0, 16);
+			memcpy(last, lane->p, lane->left);
+			if (k1) {
+				if (lane->left == 16) {
+					gmssl_memxor(last, last, k1, 16);
+				} else {
+					last[lane->left] = 0x80;
+					gmssl_memxor(last, last, k2, 16);
+				}
+			}
+			gmssl_memxor(state + 16 * i, state + 16 * i, last, 16);
+			lane->left = 0;
+			lane->done = 1;
+		}
+		sm4_encrypt_blocks(key, state, n, state);
+
+		for (i = 0; i < n; ) {
+			if (!lanes[i].done) {
+				i++;
+				continue;
+			}
+			memcpy(macs + 16 * lanes[i].idx, state + 16 * i, 16);
+			n--;
+			if (i < n) {
+				lanes[i] = lanes[n];
+				memcpy(state + 16 * i, state + 16 * n, 16);
+			}
+		}
+	}
+	gmssl_secure_clear(state, sizeof(state));
+	gmssl_secure_clear(last, sizeof(last));
+}
+
+void sm4_cbc_mac_batch(const SM4_KEY *key, const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *macs)
+{
+	sm4_mac_batch(key, NULL, NULL, msgs, msglens, cnt, macs);
+}
+
+void sm4_cmac_batch(const SM4_CMAC_CTX *ctx, const uint8_t *const *msgs, const size_t *msglens, size_t cnt, uint8_t *macs)
+{
+	sm4_mac_batch(&ctx->key, ctx->k1, ctx->k2, msgs, msglens, cnt, macs);
+}
@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <gmssl/sm4_cbc_sm3_hmac.h>
 #include <gmssl/mem.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
 
 
@@ -42,6 +43,19 @@ int sm4_cbc_sm3_hmac_encrypt_update(SM4_CBC_SM3_HMAC_CTX *ctx, const uint8_t *in
 		error_print();
 		return -1;
 	}
+#ifndef ENABLE_CRYPTO_SDF
+	// with no partial block buffered the full blocks are encrypted and hashed in one pass
+	if (ctx->enc_ctx.block_nbytes == 0 && inlen >= SM4_CBC_SM3_STITCH_MIN_SIZE) {
+		size_t len = inlen - inlen % SM4_BLOCK_SIZE;
+
+		sm4_cbc_encrypt_then_sm3_update(&ctx->enc_ctx.sm4_key, ctx->enc_ctx.iv,
+			in, len / SM4_BLOCK_SIZE, out, &ctx->mac_ctx.sm3_ctx);
+		memcpy(ctx->enc_ctx.block, in + len, inlen - len);
+		ctx->enc_ctx.block_nbytes = inlen - len;
+		*outlen = len;
+		return 1;
+	}
+#endif
 	if (sm4_cbc_encrypt_update(&ctx->enc_ctx, in, inlen, out, outlen) != 1) {
 		error_print();
 		return -1;
@@ -133,13 +147,20 @@ int sm4_cbc_sm3_hmac_decrypt_update(SM4_CBC_SM3_HMAC_CTX *ctx, const uint8_t *in
 		out += *outlen;
 
 		inlen -= SM3_HMAC_SIZE;
-		sm3_hmac_update(&ctx->mac_ctx, in, inlen);
-		if (sm4_cbc_decrypt_update(&ctx->enc_ctx, in, inlen, out, &len) != 1) {
-			error_print();
-			return -1;
-		}
-		*outlen += len;
 		memcpy(ctx->mac, in + inlen, SM3_HMAC_SIZE);
+		// hash and decrypt chunk by chunk so the ciphertext is read once from memory
+		while (inlen) {
+			size_t n = inlen < SM4_CBC_SM3_DECRYPT_CHUNK ? inlen : SM4_CBC_SM3_DECRYPT_CHUNK;
+			sm3_hmac_update(&ctx->mac_ctx, in, n);
+			if (sm4_cbc_decrypt_update(&ctx->enc_ctx, in, n, out, &len) != 1) {
+				error_print();
+				return -1;
+			}
+			in += n;
+			inlen -= n;
+			out += len;
+			*outlen += len;
+		}
 	}
 	return 1;
 }
@@ -169,3 +190,318 @@ int sm4_cbc_sm3_hmac_decrypt_finish(SM4_CBC_SM3_HMAC_CTX *ctx, uint8_t *out, siz
 	ctx->maclen = 0;
 	return 1;
 }
+
+
+/*
+ * Stitched SM4-CBC encryption and SM3
+ *
+ * CBC encryption is one long dependency chain, every block waits for the
+ * previous one, and so is the SM3 compression. A 64-byte chunk is four
+ * SM4 blocks (128 rounds) and one SM3 block (64 rounds), the rounds of both
+ * are interleaved, eight SM4 rounds then four SM3 rounds, in one function so
+ * the out-of-order core runs the two chains in parallel.
+ *
+ * This only pays where the table based SM4 round is latency bound, on cores
+ * with a small window the separate passes are as fast, so the update functions
+ * take the stitched path only with ENABLE_SM4_CBC_SM3_STITCH.
+ */
+
+// T0[i] = L32(S[i] << 24)
+static const uint32_t SM4_T[256] = {
+	0x8ed55b5b, 0xd0924242, 0x4deaa7a7, 0x06fdfbfb,
+	0xfccf3333, 0x65e28787, 0xc93df4f4, 0x6bb5dede,
+	0x4e165858, 0x6eb4dada, 0x44145050, 0xcac10b0b,
+	0x8828a0a0, 0x17f8efef, 0x9c2cb0b0, 0x11051414,
+	0x872bacac, 0xfb669d9d, 0xf2986a6a, 0xae77d9d9,
+	0x822aa8a8, 0x46bcfafa, 0x14041010, 0xcfc00f0f,
+	0x02a8aaaa, 0x54451111, 0x5f134c4c, 0xbe269898,
+	0x6d482525, 0x9e841a1a, 0x1e061818, 0xfd9b6666,
+	0xec9e7272, 0x4a430909, 0x10514141, 0x24f7d3d3,
+	0xd5934646, 0x53ecbfbf, 0xf89a6262, 0x927be9e9,
+	0xff33cccc, 0x04555151, 0x270b2c2c, 0x4f420d0d,
+	0x59eeb7b7, 0xf3cc3f3f, 0x1caeb2b2, 0xea638989,
+	0x74e79393, 0x7fb1cece, 0x6c1c7070, 0x0daba6a6,
+	0xedca2727, 0x28082020, 0x48eba3a3, 0xc1975656,
+	0x80820202, 0xa3dc7f7f, 0xc4965252, 0x12f9ebeb,
+	0xa174d5d5, 0xb38d3e3e, 0xc33ffcfc, 0x3ea49a9a,
+	0x5b461d1d, 0x1b071c1c, 0x3ba59e9e, 0x0cfff3f3,
+	0x3ff0cfcf, 0xbf72cdcd, 0x4b175c5c, 0x52b8eaea,
+	0x8f810e0e, 0x3d586565, 0xcc3cf0f0, 0x7d196464,
+	0x7ee59b9b, 0x91871616, 0x734e3d3d, 0x08aaa2a2,
+	0xc869a1a1, 0xc76aadad, 0x85830606, 0x7ab0caca,
+	0xb570c5c5, 0xf4659191, 0xb2d96b6b, 0xa7892e2e,
+	0x18fbe3e3, 0x47e8afaf, 0x330f3c3c, 0x674a2d2d,
+	0xb071c1c1, 0x0e575959, 0xe99f7676, 0xe135d4d4,
+	0x661e7878, 0xb4249090, 0x360e3838, 0x265f7979,
+	0xef628d8d, 0x38596161, 0x95d24747, 0x2aa08a8a,
+	0xb1259494, 0xaa228888, 0x8c7df1f1, 0xd73becec,
+	0x05010404, 0xa5218484, 0x9879e1e1, 0x9b851e1e,
+	0x84d75353, 0x00000000, 0x5e471919, 0x0b565d5d,
+	0xe39d7e7e, 0x9fd04f4f, 0xbb279c9c, 0x1a534949,
+	0x7c4d3131, 0xee36d8d8, 0x0a020808, 0x7be49f9f,
+	0x20a28282, 0xd4c71313, 0xe8cb2323, 0xe69c7a7a,
+	0x42e9abab, 0x43bdfefe, 0xa2882a2a, 0x9ad14b4b,
+	0x40410101, 0xdbc41f1f, 0xd838e0e0, 0x61b7d6d6,
+	0x2fa18e8e, 0x2bf4dfdf, 0x3af1cbcb, 0xf6cd3b3b,
+	0x1dfae7e7, 0xe5608585, 0x41155454, 0x25a38686,
+	0x60e38383, 0x16acbaba, 0x295c7575, 0x34a69292,
+	0xf7996e6e, 0xe434d0d0, 0x721a6868, 0x01545555,
+	0x19afb6b6, 0xdf914e4e, 0xfa32c8c8, 0xf030c0c0,
+	0x21f6d7d7, 0xbc8e3232, 0x75b3c6c6, 0x6fe08f8f,
+	0x691d7474, 0x2ef5dbdb, 0x6ae18b8b, 0x962eb8b8,
+	0x8a800a0a, 0xfe679999, 0xe2c92b2b, 0xe0618181,
+	0xc0c30303, 0x8d29a4a4, 0xaf238c8c, 0x07a9aeae,
+	0x390d3434, 0x1f524d4d, 0x764f3939, 0xd36ebdbd,
+	0x81d65757, 0xb7d86f6f, 0xeb37dcdc, 0x51441515,
+	0xa6dd7b7b, 0x09fef7f7, 0xb68c3a3a, 0x932fbcbc,
+	0x0f030c0c, 0x03fcffff, 0xc26ba9a9, 0xba73c9c9,
+	0xd96cb5b5, 0xdc6db1b1, 0x375a6d6d, 0x15504545,
+	0xb98f3636, 0x771b6c6c, 0x13adbebe, 0xda904a4a,
+	0x57b9eeee, 0xa9de7777, 0x4cbef2f2, 0x837efdfd,
+	0x55114444, 0xbdda6767, 0x2c5d7171, 0x45400505,
+	0x631f7c7c, 0x50104040, 0x325b6969, 0xb8db6363,
+	0x220a2828, 0xc5c20707, 0xf531c4c4, 0xa88a2222,
+	0x31a79696, 0xf9ce3737, 0x977aeded, 0x49bff6f6,
+	0x992db4b4, 0xa475d1d1, 0x90d34343, 0x5a124848,
+	0x58bae2e2, 0x71e69797, 0x64b6d2d2, 0x70b2c2c2,
+	0xad8b2626, 0xcd68a5a5, 0xcb955e5e, 0x624b2929,
+	0x3c0c3030, 0xce945a5a, 0xab76dddd, 0x867ff9f9,
+	0xf1649595, 0x5dbbe6e6, 0x35f2c7c7, 0x2d092424,
+	0xd1c61717, 0xd66fb9b9, 0xdec51b1b, 0x94861212,
+	0x78186060, 0x30f3c3c3, 0x897cf5f5, 0x5cefb3b3,
+	0xd23ae8e8, 0xacdf7373, 0x794c3535, 0xa0208080,
+	0x9d78e5e5, 0x56edbbbb, 0x235e7d7d, 0xc63ef8f8,
+	0x8bd45f5f, 0xe7c82f2f, 0xdd39e4e4, 0x68492121,
+};
+
+
+static const uint32_t SM3_K[64] = {
+	0x79cc4519U, 0xf3988a32U, 0xe7311465U, 0xce6228cbU,
+	0x9cc45197U, 0x3988a32fU, 0x7311465eU, 0xe6228cbcU,
+	0xcc451979U, 0x988a32f3U, 0x311465e7U, 0x6228cbceU,
+	0xc451979cU, 0x88a32f39U, 0x11465e73U, 0x228cbce6U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+	0x7a879d8aU, 0xf50f3b14U, 0xea1e7629U, 0xd43cec53U,
+	0xa879d8a7U, 0x50f3b14fU, 0xa1e7629eU, 0x43cec53dU,
+	0x879d8a7aU, 0x0f3b14f5U, 0x1e7629eaU, 0x3cec53d4U,
+	0x79d8a7a8U, 0xf3b14f50U, 0xe7629ea1U, 0xcec53d43U,
+	0x9d8a7a87U, 0x3b14f50fU, 0x7629ea1eU, 0xec53d43cU,
+	0xd8a7a879U, 0xb14f50f3U, 0x629ea1e7U, 0xc53d43ceU,
+	0x8a7a879dU, 0x14f50f3bU, 0x29ea1e76U, 0x53d43cecU,
+	0xa7a879d8U, 0x4f50f3b1U, 0x9ea1e762U, 0x3d43cec5U,
+};
+
+#define SM4_T_ROUND(X0, X1, X2, X3, rk)				\
+	t = X1 ^ X2 ^ X3 ^ (rk);				\
+	X0 ^= SM4_T[t >> 24]					\
+		^ ROL32(SM4_T[(t >> 16) & 0xff], 24)		\
+		^ ROL32(SM4_T[(t >>  8) & 0xff], 16)		\
+		^ ROL32(SM4_T[t & 0xff], 8)
+
+#define SM3_P0(x) ((x) ^ ROL32((x), 9) ^ ROL32((x),17))
+#define SM3_P1(x) ((x) ^ ROL32((x),15) ^ ROL32((x),23))
+#define SM3_FF00(x,y,z)  ((x) ^ (y) ^ (z))
+#define SM3_FF16(x,y,z)  (((x)&(y)) | ((x)&(z)) | ((y)&(z)))
+#define SM3_GG00(x,y,z)  ((x) ^ (y) ^ (z))
+#define SM3_GG16(x,y,z)  ((((y)^(z)) & (x)) ^ (z))
+
+// the new A is left in D and the new E in H, the next round renames the registers
+#define SM3_ROUND(j, FF, GG, A, B, C, D, E, F, G, H)		\
+	SS0 = ROL32(A, 12);					\
+	SS1 = ROL32(SS0 + E + SM3_K[j], 7);			\
+	SS2 = SS1 ^ SS0;					\
+	D += FF(A, B, C) + SS2 + (W[j] ^ W[j + 4]);		\
+	SS1 += GG(E, F, G) + H + W[j];				\
+	B = ROL32(B, 9);					\
+	H = SM3_P0(SS1);					\
+	F = ROL32(F, 19)
+
+// SM4 rounds k .. k+7 and SM3 rounds j .. j+3, independent of each other
+#define STITCH_ROUNDS(k, j, FF, GG)					\
+	SM4_T_ROUND(X0, X1, X2, X3, rk[k]);				\
+	SM4_T_ROUND(X1, X2, X3, X0, rk[k + 1]);				\
+	SM4_T_ROUND(X2, X3, X0, X1, rk[k + 2]);				\
+	SM4_T_ROUND(X3, X0, X1, X2, rk[k + 3]);				\
+	SM4_T_ROUND(X0, X1, X2, X3, rk[k + 4]);				\
+	SM4_T_ROUND(X1, X2, X3, X0, rk[k + 5]);				\
+	SM4_T_ROUND(X2, X3, X0, X1, rk[k + 6]);				\
+	SM4_T_ROUND(X3, X0, X1, X2, rk[k + 7]);				\
+	SM3_ROUND((j), FF, GG, A, B, C, D, E, F, G, H);			\
+	SM3_ROUND((j) + 1, FF, GG, D, A, B, C, H, E, F, G);		\
+	SM3_ROUND((j) + 2, FF, GG, C, D, A, B, G, H, E, F);		\
+	SM3_ROUND((j) + 3, FF, GG, B, C, D, A, F, G, H, E)
+
+void sm4_cbc_encrypt_sm3_compress(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nchunks, uint8_t *out,
+	uint32_t digest[8], const uint8_t *sm3_data)
+{
+	const uint32_t *rk = key->rk;
+	uint32_t P[16];
+	uint32_t Y[16];
+	uint32_t X0, X1, X2, X3, t;
+	uint32_t A, B, C, D, E, F, G, H, SS0, SS1, SS2;
+	uint32_t W[68];
+	uint32_t iv0, iv1, iv2, iv3;
+	int i, b, j;
+
+	iv0 = GETU32(iv);
+	iv1 = GETU32(iv + 4);
+	iv2 = GETU32(iv + 8);
+	iv3 = GETU32(iv + 12);
+
+	while (nchunks--) {
+		// load everything of the chunk before storing, so out may alias in
+		for (i = 0; i < 16; i++) {
+			P[i] = GETU32(in + 4 * i);
+			W[i] = GETU32(sm3_data + 4 * i);
+		}
+		for (; i < 68; i++) {
+			W[i] = SM3_P1(W[i - 16] ^ W[i - 9] ^ ROL32(W[i - 3], 15))
+				^ ROL32(W[i - 13], 7) ^ W[i - 6];
+		}
+
+		A = digest[0];
+		B = digest[1];
+		C = digest[2];
+		D = digest[3];
+		E = digest[4];
+		F = digest[5];
+		G = digest[6];
+		H = digest[7];
+
+		for (b = 0; b < 4; b++) {
+			X0 = P[4 * b] ^ iv0;
+			X1 = P[4 * b + 1] ^ iv1;
+			X2 = P[4 * b + 2] ^ iv2;
+			X3 = P[4 * b + 3] ^ iv3;
+
+			j = 16 * b;
+			if (b == 0) {
+				STITCH_ROUNDS( 0, j,      SM3_FF00, SM3_GG00);
+				STITCH_ROUNDS( 8, j + 4,  SM3_FF00, SM3_GG00);
+				STITCH_ROUNDS(16, j + 8,  SM3_FF00, SM3_GG00);
+				STITCH_ROUNDS(24, j + 12, SM3_FF00, SM3_GG00);
+			} else {
+				STITCH_ROUNDS( 0, j,      SM3_FF16, SM3_GG16);
+				STITCH_ROUNDS( 8, j + 4,  SM3_FF16, SM3_GG16);
+				STITCH_ROUNDS(16, j + 8,  SM3_FF16, SM3_GG16);
+				STITCH_ROUNDS(24, j + 12, SM3_FF16, SM3_GG16);
+			}
+
+			iv0 = X3;
+			iv1 = X2;
+			iv2 = X1;
+			iv3 = X0;
+			Y[4 * b] = iv0;
+			Y[4 * b + 1] = iv1;
+			Y[4 * b + 2] = iv2;
+			Y[4 * b + 3] = iv3;
+		}
+
+		digest[0] ^= A;
+		digest[1] ^= B;
+		digest[2] ^= C;
+		digest[3] ^= D;
+		digest[4] ^= E;
+		digest[5] ^= F;
+		digest[6] ^= G;
+		digest[7] ^= H;
+
+		for (i = 0; i < 16; i++) {
+			PUTU32(out + 4 * i, Y[i]);
+		}
+		in += 64;
+		out += 64;
+		sm3_data += 64;
+	}
+
+	PUTU32(iv, iv0);
+	PUTU32(iv + 4, iv1);
+	PUTU32(iv + 8, iv2);
+	PUTU32(iv + 12, iv3);
+	gmssl_secure_clear(P, sizeof(P));
+	gmssl_secure_clear(W, sizeof(W));
+}
+
+void sm4_cbc_encrypt_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx)
+{
+	size_t len = nblocks * SM4_BLOCK_SIZE;
+
+#ifdef ENABLE_SM4_CBC_SM3_STITCH
+	if (len >= SM4_CBC_SM3_STITCH_MIN_SIZE) {
+		size_t r, n;
+
+		// fill the buffered SM3 block, the chunks are hashed at this offset
+		r = (SM3_BLOCK_SIZE - (sm3_ctx->num & 0x3f)) % SM3_BLOCK_SIZE;
+		sm3_update(sm3_ctx, in, r);
+
+		n = (len - r) / 64;
+		sm4_cbc_encrypt_sm3_compress(key, iv, in, n, out, sm3_ctx->digest, in + r);
+		sm3_ctx->nblocks += n;
+
+		// hash the rest before the tail is encrypted over it
+		sm3_update(sm3_ctx, in + r + 64 * n, len - r - 64 * n);
+		sm4_cbc_encrypt_blocks(key, iv, in + 64 * n, nblocks - 4 * n, out + 64 * n);
+		return;
+	}
+#endif
+	sm3_update(sm3_ctx, in, len);
+	sm4_cbc_encrypt_blocks(key, iv, in, nblocks, out);
+}
+
+void sm4_cbc_encrypt_then_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx)
+{
+	size_t len = nblocks * SM4_BLOCK_SIZE;
+
+#ifdef ENABLE_SM4_CBC_SM3_STITCH
+	if (len >= SM4_CBC_SM3_STITCH_MIN_SIZE) {
+		size_t enced, hashed, n;
+
+		// the hashed ciphertext trails the encryption by at least one chunk
+		sm4_cbc_encrypt_blocks(key, iv, in, 8, out);
+		enced = 128;
+		hashed = (SM3_BLOCK_SIZE - (sm3_ctx->num & 0x3f)) % SM3_BLOCK_SIZE;
+		sm3_update(sm3_ctx, out, hashed);
+
+		n = (len - enced) / 64;
+		sm4_cbc_encrypt_sm3_compress(key, iv, in + enced, n, out + enced, sm3_ctx->digest, out + hashed);
+		sm3_ctx->nblocks += n;
+		enced += 64 * n;
+		hashed += 64 * n;
+
+		sm4_cbc_encrypt_blocks(key, iv, in + enced, (len - enced) / SM4_BLOCK_SIZE, out + enced);
+		sm3_update(sm3_ctx, out + hashed, len - hashed);
+		return;
+	}
+#endif
+	sm4_cbc_encrypt_blocks(key, iv, in, nblocks, out);
+	sm3_update(sm3_ctx, out, len);
+}
+
+void sm4_cbc_decrypt_sm3_update(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out, SM3_CTX *sm3_ctx, size_t sm3_len)
+{
+	size_t len = nblocks * SM4_BLOCK_SIZE;
+	size_t n;
+
+	if (sm3_len > len) {
+		sm3_len = len;
+	}
+	// hash each chunk of plaintext while it is still in L1
+	while (len) {
+		n = len < SM4_CBC_SM3_DECRYPT_CHUNK ? len : SM4_CBC_SM3_DECRYPT_CHUNK;
+		sm4_cbc_decrypt_blocks(key, iv, in, n / SM4_BLOCK_SIZE, out);
+		if (sm3_len) {
+			sm3_update(sm3_ctx, out, n < sm3_len ? n : sm3_len);
+			sm3_len -= n < sm3_len ? n : sm3_len;
+		}
+		in += n;
+		out += n;
+		len -= n;
+	}
+}
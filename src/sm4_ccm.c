@@ -10,10 +10,15 @@
 
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
-#include <gmssl/sm4_cbc_mac.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
 
 
+// the CBC-MAC and the CTR of a batch run while it is in the L1 cache,
+// the CTR blocks of a batch go to the widest sm4_ctr32_encrypt_blocks backend
+#define SM4_CCM_BATCH_BLOCKS	64
+
+
 static void length_to_bytes(size_t len, size_t nbytes, uint8_t *out)
 {
 	uint8_t *p = out + nbytes - 1;
@@ -23,44 +28,104 @@ static void length_to_bytes(size_t len, size_t nbytes, uint8_t *out)
 	}
 }
 
-static void ctr_n_incr(uint8_t a[16], size_t n)
+// CBC-MAC of the B_0 and the AAD blocks, `num` bytes of the last block are absorbed
+static void sm4_ccm_mac_update(const SM4_KEY *key, uint8_t mac[16], size_t *num, const uint8_t *data, size_t datalen)
 {
-	size_t i;
-	for (i = 15; i >= 16 - n; i--) {
-		a[i]++;
-		if (a[i]) break;
+	while (datalen) {
+		size_t len = datalen < 16 - *num ? datalen : 16 - *num;
+		gmssl_memxor(mac + *num, mac + *num, data, len);
+		*num += len;
+		if (*num == 16) {
+			sm4_encrypt(key, mac, mac);
+			*num = 0;
+		}
+		data += len;
+		datalen -= len;
+	}
+}
+
+// the payload length is checked, so the n-byte counter never wraps, but it can be longer than 32 bits
+static void sm4_ccm_ctr_blocks(SM4_CCM_CTX *ctx, const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	while (nblocks) {
+		uint64_t room = ((uint64_t)1 << 32) - GETU32(ctx->ctr + 12);
+		size_t n = (uint64_t)nblocks < room ? nblocks : (size_t)room;
+		size_t i;
+
+		sm4_ctr32_encrypt_blocks(key, ctx->ctr, in, n, out);
+		if ((uint64_t)n == room) {
+			for (i = 11; i >= 16 - ctx->ctr_size; i--) {
+				if (++ctx->ctr[i]) break;
+			}
+		}
+		in += n * 16;
+		out += n * 16;
+		nblocks -= n;
 	}
 }
 
-// TODO: add test vectors for counter overflow
-static void sm4_ctr_n_encrypt(const SM4_KEY *key, uint8_t ctr[16], size_t n, const uint8_t *in, size_t inlen, uint8_t *out)
+static void sm4_ccm_encrypt_blocks(SM4_CCM_CTX *ctx, const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t buf[16 * SM4_CCM_BATCH_BLOCKS];
+
+	while (nblocks) {
+		size_t n = nblocks < SM4_CCM_BATCH_BLOCKS ? nblocks : SM4_CCM_BATCH_BLOCKS;
+
+		// CBC-MAC of the plaintext before CTR, `in` can be `out`
+		sm4_cbc_encrypt_blocks(key, ctx->mac, in, n, buf);
+		sm4_ccm_ctr_blocks(ctx, key, in, n, out);
+		in += n * 16;
+		out += n * 16;
+		nblocks -= n;
+	}
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
+static void sm4_ccm_decrypt_blocks(SM4_CCM_CTX *ctx, const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t buf[16 * SM4_CCM_BATCH_BLOCKS];
+
+	while (nblocks) {
+		size_t n = nblocks < SM4_CCM_BATCH_BLOCKS ? nblocks : SM4_CCM_BATCH_BLOCKS;
+
+		sm4_ccm_ctr_blocks(ctx, key, in, n, out);
+		sm4_cbc_encrypt_blocks(key, ctx->mac, out, n, buf);
+		in += n * 16;
+		out += n * 16;
+		nblocks -= n;
+	}
+	gmssl_secure_clear(buf, sizeof(buf));
+}
+
+// the last partial block, zero padded in the CBC-MAC
+static void sm4_ccm_last_block(SM4_CCM_CTX *ctx, const SM4_KEY *key, int enc, const uint8_t *in, size_t len, uint8_t *out)
 {
 	uint8_t block[16];
-	size_t len;
 
-	while (inlen) {
-		len = inlen < 16 ? inlen : 16;
-		sm4_encrypt(key, ctr, block);
+	if (!len) {
+		return;
+	}
+	sm4_encrypt(key, ctx->ctr, block);
+	if (enc) {
+		gmssl_memxor(ctx->mac, ctx->mac, in, len);
 		gmssl_memxor(out, in, block, len);
-		ctr_n_incr(ctr, n);
-		in += len;
-		out += len;
-		inlen -= len;
+	} else {
+		gmssl_memxor(out, in, block, len);
+		gmssl_memxor(ctx->mac, ctx->mac, out, len);
 	}
+	sm4_encrypt(key, ctx->mac, ctx->mac);
+	gmssl_secure_clear(block, sizeof(block));
 }
 
-int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
-	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
-	uint8_t *out, size_t taglen, uint8_t *tag)
+static int sm4_ccm_init(SM4_CCM_CTX *ctx, const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
 {
-	SM4_CBC_MAC_CTX mac_ctx;
 	const uint8_t zeros[16] = {0};
 	uint8_t block[16] = {0};
-	uint8_t ctr[16] = {0};
-	uint8_t mac[16];
 	size_t inlen_size;
+	size_t num = 0;
 
-	if (ivlen < 7 || ivlen > 13) {
+	if (ivlen < SM4_CCM_MIN_IV_SIZE || ivlen > SM4_CCM_MAX_IV_SIZE) {
 		error_print();
 		return -1;
 	}
@@ -68,27 +133,33 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 		error_print();
 		return -1;
 	}
-	if (taglen < 4 || taglen > 16 || taglen & 1) {
+	if (taglen < SM4_CCM_MIN_TAG_SIZE || taglen > SM4_CCM_MAX_TAG_SIZE || taglen & 1) {
 		error_print();
 		return -1;
 	}
 
 	inlen_size = 15 - ivlen;
-	if (inlen_size < 8 && inlen >= ((size_t)1 << (inlen_size * 8))) {
+	if (inlen_size < 8 && (uint64_t)inlen >= ((uint64_t)1 << (inlen_size * 8))) {
 		error_print();
 		return -1;
 	}
 
-	// sm4_cbc_mac_init with SM4_KEY
-	memset(&mac_ctx, 0, sizeof(mac_ctx));
-	mac_ctx.key = *sm4_key;
+	memset(ctx->ctr, 0, sizeof(ctx->ctr));
+	ctx->ctr_size = inlen_size;
+	ctx->inlen = inlen;
+	ctx->processed = 0;
+	ctx->block_nbytes = 0;
+	ctx->taglen = taglen;
+	ctx->tag_nbytes = 0;
+
+	memset(ctx->mac, 0, sizeof(ctx->mac));
 
 	block[0] |= ((aadlen > 0) & 0x1) << 6;
 	block[0] |= (((taglen - 2)/2) & 0x7) << 3;
 	block[0] |= (inlen_size - 1) & 0x7;
 	memcpy(block + 1, iv, ivlen);
 	length_to_bytes(inlen, inlen_size, block + 1 + ivlen);
-	sm4_cbc_mac_update(&mac_ctx, block, 16);
+	sm4_ccm_mac_update(sm4_key, ctx->mac, &num, block, 16);
 
 	if (aad && aadlen) {
 		size_t alen;
@@ -107,30 +178,37 @@ int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 			length_to_bytes(aadlen, 8, block + 2);
 			alen = 10;
 		}
-		sm4_cbc_mac_update(&mac_ctx, block, alen);
-		sm4_cbc_mac_update(&mac_ctx, aad, aadlen);
-		if (alen + aadlen % 16) {
-			sm4_cbc_mac_update(&mac_ctx, zeros, 16 - (alen + aadlen)%16);
+		sm4_ccm_mac_update(sm4_key, ctx->mac, &num, block, alen);
+		sm4_ccm_mac_update(sm4_key, ctx->mac, &num, aad, aadlen);
+		if (num) {
+			sm4_ccm_mac_update(sm4_key, ctx->mac, &num, zeros, 16 - num);
 		}
 	}
 
-	ctr[0] = 0;
-	ctr[0] |= (inlen_size - 1) & 0x7;
-	memcpy(ctr + 1, iv, ivlen);
-	memset(ctr + 1 + ivlen, 0, 15 - ivlen);
-	sm4_encrypt(sm4_key, ctr, block);
+	// S_0 = E(K, A_0), the payload starts with the counter 1
+	ctx->ctr[0] = (inlen_size - 1) & 0x7;
+	memcpy(ctx->ctr + 1, iv, ivlen);
+	sm4_encrypt(sm4_key, ctx->ctr, ctx->S0);
+	ctx->ctr[15] = 1;
+	return 1;
+}
 
-	ctr[15] = 1;
-	sm4_ctr_n_encrypt(sm4_key, ctr, 15 - ivlen, in, inlen, out);
+int sm4_ccm_encrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag)
+{
+	SM4_CCM_CTX ctx;
+	size_t len = inlen - inlen % 16;
 
-	sm4_cbc_mac_update(&mac_ctx, in, inlen);
-	if (inlen % 16) {
-		sm4_cbc_mac_update(&mac_ctx, zeros, 16 - inlen % 16);
+	if (sm4_ccm_init(&ctx, sm4_key, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
+		error_print();
+		return -1;
 	}
-	sm4_cbc_mac_finish(&mac_ctx, mac);
-	gmssl_memxor(tag, mac, block, taglen);
+	sm4_ccm_encrypt_blocks(&ctx, sm4_key, in, inlen / 16, out);
+	sm4_ccm_last_block(&ctx, sm4_key, 1, in + len, inlen - len, out + len);
+	gmssl_memxor(tag, ctx.mac, ctx.S0, taglen);
 
-	gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
+	gmssl_secure_clear(ctx.mac, sizeof(ctx.mac));
 	return 1;
 }
 
@@ -138,90 +216,204 @@ int sm4_ccm_decrypt(const SM4_KEY *sm4_key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out)
 {
-	SM4_CBC_MAC_CTX mac_ctx;
-	const uint8_t zeros[16] = {0};
-	uint8_t block[16] = {0};
-	uint8_t ctr[16] = {0};
+	SM4_CCM_CTX ctx;
+	size_t len = inlen - inlen % 16;
 	uint8_t mac[16];
-	size_t inlen_size;
 
-	if (ivlen < 7 || ivlen > 13) {
+	if (sm4_ccm_init(&ctx, sm4_key, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (!aad && aadlen) {
+	sm4_ccm_decrypt_blocks(&ctx, sm4_key, in, inlen / 16, out);
+	sm4_ccm_last_block(&ctx, sm4_key, 0, in + len, inlen - len, out + len);
+	gmssl_memxor(mac, ctx.mac, ctx.S0, taglen);
+
+	gmssl_secure_clear(ctx.mac, sizeof(ctx.mac));
+	if (memcmp(mac, tag, taglen) != 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_ccm_encrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
+{
+	if (!ctx || !key || !iv) {
 		error_print();
 		return -1;
 	}
-	if (taglen < 4 || taglen > 16 || taglen & 1) {
+	if (keylen != 16) {
 		error_print();
 		return -1;
 	}
-
-	inlen_size = 15 - ivlen;
-	if (inlen_size < 8 && inlen >= (size_t)(1 << (inlen_size * 8))) {
+	sm4_set_encrypt_key(&ctx->sm4_key, key);
+	if (sm4_ccm_init(ctx, &ctx->sm4_key, iv, ivlen, aad, aadlen, inlen, taglen) != 1) {
+		gmssl_secure_clear(ctx, sizeof(*ctx));
 		error_print();
 		return -1;
 	}
+	return 1;
+}
 
-	// sm4_cbc_mac_init with SM4_KEY
-	memset(&mac_ctx, 0, sizeof(mac_ctx));
-	mac_ctx.key = *sm4_key;
-
-	block[0] |= ((aadlen > 0) & 0x1) << 6;
-	block[0] |= (((taglen - 2)/2) & 0x7) << 3;
-	block[0] |= (inlen_size - 1) & 0x7;
-	memcpy(block + 1, iv, ivlen);
-	length_to_bytes(inlen, inlen_size, block + 1 + ivlen);
-	sm4_cbc_mac_update(&mac_ctx, block, 16);
+int sm4_ccm_encrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	size_t nblocks;
+	size_t len;
 
-	if (aad && aadlen) {
-		size_t alen;
+	if (!ctx || !in || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = 16 * ((ctx->block_nbytes + inlen)/16);
+		return 1;
+	}
+	if (inlen > ctx->inlen - ctx->processed) {
+		error_print();
+		return -1;
+	}
+	ctx->processed += inlen;
 
-		if (aadlen < ((1<<16) - (1<<8))) {
-			length_to_bytes(aadlen, 2, block);
-			alen = 2;
-		} else if ((uint64_t)aadlen < ((uint64_t)1<<32)) {
-			block[0] = 0xff;
-			block[1] = 0xfe;
-			length_to_bytes(aadlen, 4, block + 2);
-			alen = 6;
-		} else {
-			block[0] = 0xff;
-			block[1] = 0xff;
-			length_to_bytes(aadlen, 8, block + 2);
-			alen = 10;
-		}
-		sm4_cbc_mac_update(&mac_ctx, block, alen);
-		sm4_cbc_mac_update(&mac_ctx, aad, aadlen);
-		if (alen + aadlen % 16) {
-			sm4_cbc_mac_update(&mac_ctx, zeros, 16 - (alen + aadlen)%16);
+	*outlen = 0;
+	if (ctx->block_nbytes) {
+		len = 16 - ctx->block_nbytes;
+		if (inlen < len) {
+			memcpy(ctx->block + ctx->block_nbytes, in, inlen);
+			ctx->block_nbytes += inlen;
+			return 1;
 		}
+		memcpy(ctx->block + ctx->block_nbytes, in, len);
+		sm4_ccm_encrypt_blocks(ctx, &ctx->sm4_key, ctx->block, 1, out);
+		in += len;
+		inlen -= len;
+		out += 16;
+		*outlen += 16;
 	}
+	nblocks = inlen / 16;
+	sm4_ccm_encrypt_blocks(ctx, &ctx->sm4_key, in, nblocks, out);
+	len = nblocks * 16;
+	in += len;
+	inlen -= len;
+	*outlen += len;
+	memcpy(ctx->block, in, inlen);
+	ctx->block_nbytes = inlen;
+	return 1;
+}
 
-	ctr[0] = 0;
-	ctr[0] |= (inlen_size - 1) & 0x7;
-	memcpy(ctr + 1, iv, ivlen);
-	memset(ctr + 1 + ivlen, 0, 15 - ivlen);
-	sm4_encrypt(sm4_key, ctr, block);
+// output the last partial block and the tag
+int sm4_ccm_encrypt_finish(SM4_CCM_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = SM4_BLOCK_SIZE + ctx->taglen;
+		return 1;
+	}
+	if (ctx->processed != ctx->inlen) {
+		error_print();
+		return -1;
+	}
+	sm4_ccm_last_block(ctx, &ctx->sm4_key, 1, ctx->block, ctx->block_nbytes, out);
+	gmssl_memxor(out + ctx->block_nbytes, ctx->mac, ctx->S0, ctx->taglen);
+	*outlen = ctx->block_nbytes + ctx->taglen;
+	gmssl_secure_clear(ctx, sizeof(*ctx));
+	return 1;
+}
 
-	ctr[15] = 1;
-	sm4_ctr_n_encrypt(sm4_key, ctr, 15 - ivlen, in, inlen, out);
+int sm4_ccm_decrypt_init(SM4_CCM_CTX *ctx,
+	const uint8_t *key, size_t keylen, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, size_t inlen, size_t taglen)
+{
+	return sm4_ccm_encrypt_init(ctx, key, keylen, iv, ivlen, aad, aadlen, inlen, taglen);
+}
 
-	sm4_cbc_mac_update(&mac_ctx, out, inlen); // diff from encrypt
-	if (inlen % 16) {
-		sm4_cbc_mac_update(&mac_ctx, zeros, 16 - inlen % 16);
-	}
-	sm4_cbc_mac_finish(&mac_ctx, mac);
+// the input is the `inlen` bytes ciphertext followed by the tag
+int sm4_ccm_decrypt_update(SM4_CCM_CTX *ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	size_t nblocks;
+	size_t len;
 
-	// diff from encrypt
-	gmssl_memxor(mac, mac, block, taglen);
-	if (memcmp(mac, tag, taglen) != 0) {
+	if (!ctx || !in || !outlen) {
 		error_print();
-		gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
 		return -1;
 	}
+	if (!out) {
+		*outlen = 16 * ((ctx->block_nbytes + inlen)/16);
+		return 1;
+	}
+
+	*outlen = 0;
+	if (inlen > ctx->inlen - ctx->processed) {
+		len = inlen - (ctx->inlen - ctx->processed);
+		if (len > ctx->taglen - ctx->tag_nbytes) {
+			error_print();
+			return -1;
+		}
+		memcpy(ctx->tag + ctx->tag_nbytes, in + inlen - len, len);
+		ctx->tag_nbytes += len;
+		inlen -= len;
+	}
+	ctx->processed += inlen;
 
-	gmssl_secure_clear(&mac_ctx, sizeof(mac_ctx));
+	if (ctx->block_nbytes) {
+		len = 16 - ctx->block_nbytes;
+		if (inlen < len) {
+			memcpy(ctx->block + ctx->block_nbytes, in, inlen);
+			ctx->block_nbytes += inlen;
+			return 1;
+		}
+		memcpy(ctx->block + ctx->block_nbytes, in, len);
+		sm4_ccm_decrypt_blocks(ctx, &ctx->sm4_key, ctx->block, 1, out);
+		in += len;
+		inlen -= len;
+		out += 16;
+		*outlen += 16;
+	}
+	nblocks = inlen / 16;
+	sm4_ccm_decrypt_blocks(ctx, &ctx->sm4_key, in, nblocks, out);
+	len = nblocks * 16;
+	in += len;
+	inlen -= len;
+	*outlen += len;
+	memcpy(ctx->block, in, inlen);
+	ctx->block_nbytes = inlen;
 	return 1;
 }
+
+// output the last partial block, the plaintext from the updates is not authenticated until this returns 1
+int sm4_ccm_decrypt_finish(SM4_CCM_CTX *ctx, uint8_t *out, size_t *outlen)
+{
+	uint8_t mac[16];
+	int ret = -1;
+
+	if (!ctx || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!out) {
+		*outlen = SM4_BLOCK_SIZE;
+		return 1;
+	}
+	if (ctx->processed != ctx->inlen || ctx->tag_nbytes != ctx->taglen) {
+		error_print();
+		return -1;
+	}
+	sm4_ccm_last_block(ctx, &ctx->sm4_key, 0, ctx->block, ctx->block_nbytes, out);
+	gmssl_memxor(mac, ctx->mac, ctx->S0, ctx->taglen);
+	if (memcmp(mac, ctx->tag, ctx->taglen) != 0) {
+		gmssl_secure_clear(out, ctx->block_nbytes);
+		error_print();
+		goto end;
+	}
+	*outlen = ctx->block_nbytes;
+	ret = 1;
+end:
+	gmssl_secure_clear(ctx, sizeof(*ctx));
+	return ret;
+}
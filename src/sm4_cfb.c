@@ -39,12 +39,53 @@ void sm4_cfb_encrypt(const SM4_KEY *key, size_t sbytes, uint8_t iv[16],
 	}
 }
 
+/*
+ * With 128-bit segments the inputs of the block cipher are the IV and the
+ * previous ciphertext blocks, all known before decryption, so they are
+ * encrypted by the bulk `sm4_encrypt_blocks` kernels, SM4_CFB_DECRYPT_BLOCKS
+ * at a time.
+ */
+#define SM4_CFB_DECRYPT_BLOCKS	64
+
+static void sm4_cfb128_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16],
+	const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[16 * SM4_CFB_DECRYPT_BLOCKS];
+
+	while (nblocks) {
+		size_t nb = nblocks < SM4_CFB_DECRYPT_BLOCKS ? nblocks : SM4_CFB_DECRYPT_BLOCKS;
+		size_t len = 16 * nb;
+
+		memcpy(block, iv, 16);
+		memcpy(block + 16, in, len - 16);
+		// update before output, `in` might be `out`
+		memcpy(iv, in + len - 16, 16);
+
+		sm4_encrypt_blocks(key, block, nb, block);
+		gmssl_memxor(out, in, block, len);
+
+		in += len;
+		out += len;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
+
 void sm4_cfb_decrypt(const SM4_KEY *key, size_t sbytes, uint8_t iv[16],
 	const uint8_t *in, size_t inlen, uint8_t *out)
 {
 	uint8_t block[16];
 	size_t len, i;
 
+	if (sbytes == SM4_BLOCK_SIZE && inlen >= SM4_BLOCK_SIZE) {
+		size_t nblocks = inlen / SM4_BLOCK_SIZE;
+
+		sm4_cfb128_decrypt_blocks(key, iv, in, nblocks, out);
+		in += SM4_BLOCK_SIZE * nblocks;
+		out += SM4_BLOCK_SIZE * nblocks;
+		inlen -= SM4_BLOCK_SIZE * nblocks;
+	}
+
 	while (inlen) {
 		len = inlen < sbytes ? inlen : sbytes;
 
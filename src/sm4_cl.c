@@ -12,12 +12,18 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
 #include <gmssl/sm4_cl.h>
+#include <gmssl/rand.h>
+#include <gmssl/gf128.h>
+#include <gmssl/ghash.h>
+#include <gmssl/metrics.h>
 #include <gmssl/endian.h>
 #include <gmssl/error.h>
 
 
-static char *clErrorString(cl_uint err)
+const char *gmssl_cl_error_string(cl_int err)
 {
 	switch (err) {
         case CL_SUCCESS:			return "CL_SUCCESS!";
@@ -73,16 +79,18 @@ static char *clErrorString(cl_uint err)
 static const char *sm4_cl_src;
 
 
-#define cl_error_print(e) \
-	do { fprintf(stderr, "%s: %d: %s()\n",__FILE__,__LINE__,clErrorString(e)); } while (0)
 
 
 void sm4_cl_cleanup(SM4_CL_CTX *ctx)
 {
-	clReleaseContext(ctx->context);
-	clReleaseCommandQueue(ctx->queue);
-	clReleaseProgram(ctx->program);
-	clReleaseKernel(ctx->kernel);
+	if (ctx->mem_io) clReleaseMemObject(ctx->mem_io);
+	if (ctx->mem_rk) clReleaseMemObject(ctx->mem_rk);
+	if (ctx->kernel) clReleaseKernel(ctx->kernel);
+	if (ctx->program) clReleaseProgram(ctx->program);
+	if (ctx->queue) clReleaseCommandQueue(ctx->queue);
+	if (ctx->context) clReleaseContext(ctx->context);
+	gmssl_secure_clear(ctx->rk, sizeof(ctx->rk));
+	memset(ctx, 0, sizeof(*ctx));
 }
 
 static void clPrintDeviceInfo(cl_device_id device)
@@ -141,62 +149,243 @@ static void clPrintDeviceInfo(cl_device_id device)
 	printf("  Extensions: %s\n", extensions);
 }
 
-static int sm4_cl_set_key(SM4_CL_CTX *ctx, const uint8_t key[16], int enc)
+int gmssl_cl_open_device(cl_context *context, cl_device_id *device, cl_command_queue *queue)
 {
 	cl_platform_id platform;
-	cl_device_id device;
 	cl_uint device_cnt;
-	cl_int err;
-	char sval[256];
-	size_t slen;
 	cl_command_queue_properties queue_prop = 0;
-	const char *build_opts = NULL;
+	cl_int err;
 
-	memset(ctx, 0, sizeof(*ctx));
+	*context = NULL;
+	*queue = NULL;
 
 	if ((err = clGetPlatformIDs(1, &platform, NULL)) != CL_SUCCESS) {
 		cl_error_print(err);
 		return -1;
 	}
-	if ((err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, &device, &device_cnt)) != CL_SUCCESS) {
+	if ((err = clGetDeviceIDs(platform, CL_DEVICE_TYPE_GPU, 1, device, &device_cnt)) != CL_SUCCESS) {
 		cl_error_print(err);
 		return -1;
 	}
-	//clPrintDeviceInfo(device);
+	//clPrintDeviceInfo(*device);
 
-	if (!(ctx->context = clCreateContext(NULL, 1, &device, NULL, NULL, &err))) {
+	if (!(*context = clCreateContext(NULL, 1, device, NULL, NULL, &err))) {
 		cl_error_print(err);
 		return -1;
 	}
-	if (!(ctx->queue = clCreateCommandQueue(ctx->context, device, queue_prop, &err))) {
+	if (!(*queue = clCreateCommandQueue(*context, *device, queue_prop, &err))) {
 		cl_error_print(err);
-		goto end;
+		clReleaseContext(*context);
+		*context = NULL;
+		return -1;
 	}
-	if (!(ctx->program = clCreateProgramWithSource(ctx->context, 1, (const char **)&sm4_cl_src, NULL, &err))) {
+	return 1;
+}
+
+static int gmssl_cl_build_source(cl_context context, cl_device_id device, const char *src, cl_program *program)
+{
+	const char *build_opts = NULL;
+	cl_int err;
+
+	if (!(*program = clCreateProgramWithSource(context, 1, &src, NULL, &err))) {
 		cl_error_print(err);
-		goto end;
+		return -1;
 	}
-	if ((err = clBuildProgram(ctx->program, 1, &device, build_opts, NULL, NULL)) != CL_SUCCESS) {
+	if ((err = clBuildProgram(*program, 1, &device, build_opts, NULL, NULL)) != CL_SUCCESS) {
 		char *log = NULL;
 		size_t loglen;
 
 		cl_error_print(err);
 
-		if ((err = clGetProgramBuildInfo(ctx->program, device, CL_PROGRAM_BUILD_LOG, sizeof(log), NULL, &loglen)) != CL_SUCCESS) {
+		if ((err = clGetProgramBuildInfo(*program, device, CL_PROGRAM_BUILD_LOG, 0, NULL, &loglen)) == CL_SUCCESS
+			&& (log = (char *)malloc(loglen)) != NULL
+			&& (err = clGetProgramBuildInfo(*program, device, CL_PROGRAM_BUILD_LOG, loglen, log, NULL)) == CL_SUCCESS) {
+			fprintf(stderr, "%s %d: %s\n", __FILE__, __LINE__, log);
+		}
+		if (log) free(log);
+		clReleaseProgram(*program);
+		*program = NULL;
+		return -1;
+	}
+	return 1;
+}
+
+static char gmssl_cl_cache_dir[512] = {0};
+
+int gmssl_cl_set_cache_dir(const char *dir)
+{
+	if (!dir) {
+		gmssl_cl_cache_dir[0] = 0;
+		return 1;
+	}
+	if (!dir[0] || strlen(dir) >= sizeof(gmssl_cl_cache_dir)) {
+		error_print();
+		return -1;
+	}
+	strcpy(gmssl_cl_cache_dir, dir);
+	return 1;
+}
+
+// the file name is SM3 of the device, the driver version and the source
+static int gmssl_cl_cache_path(cl_device_id device, const char *src, char *path, size_t pathlen)
+{
+	const cl_device_info names[] = {
+		CL_DEVICE_NAME, CL_DEVICE_VENDOR, CL_DEVICE_VERSION, CL_DRIVER_VERSION,
+	};
+	char info[1024];
+	size_t infolen;
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	char hex[SM3_DIGEST_SIZE * 2 + 1];
+	size_t i;
+
+	sm3_init(&sm3_ctx);
+	for (i = 0; i < sizeof(names)/sizeof(names[0]); i++) {
+		if (clGetDeviceInfo(device, names[i], sizeof(info), info, &infolen) != CL_SUCCESS) {
+			return -1;
+		}
+		sm3_update(&sm3_ctx, (uint8_t *)info, infolen);
+	}
+	sm3_update(&sm3_ctx, (const uint8_t *)src, strlen(src) + 1);
+	sm3_finish(&sm3_ctx, dgst);
+
+	for (i = 0; i < sizeof(dgst); i++) {
+		snprintf(hex + i * 2, 3, "%02x", dgst[i]);
+	}
+	if (snprintf(path, pathlen, "%s/gmssl-cl-%s.bin", gmssl_cl_cache_dir, hex) >= (int)pathlen) {
+		return -1;
+	}
+	return 1;
+}
+
+// return 0 if there is no usable binary, the caller builds the source
+static int gmssl_cl_cache_load(cl_context context, cl_device_id device, const char *path, cl_program *program)
+{
+	FILE *fp;
+	long len;
+	unsigned char *bin = NULL;
+	size_t binlen;
+	cl_int status;
+	cl_int err;
+	int ret = 0;
+
+	*program = NULL;
+
+	if (!(fp = fopen(path, "rb"))) {
+		return 0;
+	}
+	if (fseek(fp, 0, SEEK_END) != 0
+		|| (len = ftell(fp)) <= 0
+		|| fseek(fp, 0, SEEK_SET) != 0
+		|| !(bin = (unsigned char *)malloc(len))
+		|| fread(bin, 1, len, fp) != (size_t)len) {
+		goto end;
+	}
+	binlen = (size_t)len;
+
+	if (!(*program = clCreateProgramWithBinary(context, 1, &device, &binlen,
+		(const unsigned char **)&bin, &status, &err)) || status != CL_SUCCESS) {
+		goto end;
+	}
+	if (clBuildProgram(*program, 1, &device, NULL, NULL, NULL) != CL_SUCCESS) {
+		goto end;
+	}
+	ret = 1;
+
+end:
+	if (ret != 1 && *program) {
+		clReleaseProgram(*program);
+		*program = NULL;
+	}
+	if (bin) free(bin);
+	fclose(fp);
+	return ret;
+}
+
+// written to a temporary file and renamed, so a concurrent loader never reads a partial binary
+static void gmssl_cl_cache_store(cl_program program, const char *path)
+{
+	size_t binlen;
+	unsigned char *bin = NULL;
+	char tmp_path[600];
+	uint8_t suffix[4];
+	FILE *fp = NULL;
+
+	if (clGetProgramInfo(program, CL_PROGRAM_BINARY_SIZES, sizeof(binlen), &binlen, NULL) != CL_SUCCESS
+		|| !binlen
+		|| !(bin = (unsigned char *)malloc(binlen))
+		|| clGetProgramInfo(program, CL_PROGRAM_BINARIES, sizeof(bin), &bin, NULL) != CL_SUCCESS
+		|| rand_bytes(suffix, sizeof(suffix)) != 1) {
+		goto end;
+	}
+	if (snprintf(tmp_path, sizeof(tmp_path), "%s.%02x%02x%02x%02x", path,
+		suffix[0], suffix[1], suffix[2], suffix[3]) >= (int)sizeof(tmp_path)) {
+		goto end;
+	}
+	if (!(fp = fopen(tmp_path, "wb"))) {
+		goto end;
+	}
+	if (fwrite(bin, 1, binlen, fp) != binlen) {
+		fclose(fp);
+		remove(tmp_path);
+		goto end;
+	}
+	fclose(fp);
+	if (rename(tmp_path, path) != 0) {
+		remove(tmp_path);
+	}
+end:
+	if (bin) free(bin);
+}
+
+int gmssl_cl_build_program(cl_context context, cl_device_id device, const char *src, cl_program *program)
+{
+	char path[600];
+	int cached;
+
+	cached = gmssl_cl_cache_dir[0] && gmssl_cl_cache_path(device, src, path, sizeof(path)) == 1;
+
+	if (cached && gmssl_cl_cache_load(context, device, path, program) == 1) {
+		return 1;
+	}
+	if (gmssl_cl_build_source(context, device, src, program) != 1) {
+		error_print();
+		return -1;
+	}
+	if (cached) {
+		gmssl_cl_cache_store(*program, path);
+	}
+	return 1;
+}
+
+static int sm4_cl_set_key(SM4_CL_CTX *ctx, const uint8_t key[16], int enc, const SM4_CL_CTX *share)
+{
+	cl_int err;
+
+	memset(ctx, 0, sizeof(*ctx));
+
+	if (share) {
+		if ((err = clRetainContext(share->context)) != CL_SUCCESS) {
 			cl_error_print(err);
-			goto end;
+			return -1;
 		}
-		if (!(log = (char *)malloc(loglen))) {
+		ctx->context = share->context;
+		ctx->device = share->device;
+		if ((err = clRetainProgram(share->program)) != CL_SUCCESS) {
+			cl_error_print(err);
 			goto end;
 		}
-		if ((err = clGetProgramBuildInfo(ctx->program, device, CL_PROGRAM_BUILD_LOG, sizeof(log), NULL, &loglen)) != CL_SUCCESS) {
+		ctx->program = share->program;
+		if (!(ctx->queue = clCreateCommandQueue(ctx->context, ctx->device, 0, &err))) {
 			cl_error_print(err);
-			free(log);
 			goto end;
 		}
-		fprintf(stderr, "%s %d: %s\n", __FILE__, __LINE__, log);
-		free(log);
-		goto end;
+	} else {
+		if (gmssl_cl_open_device(&ctx->context, &ctx->device, &ctx->queue) != 1
+			|| gmssl_cl_build_program(ctx->context, ctx->device, sm4_cl_src, &ctx->program) != 1) {
+			error_print();
+			goto end;
+		}
 	}
 	if (!(ctx->kernel = clCreateKernel(ctx->program, "sm4_ctr32_encrypt_blocks", &err))) {
 		cl_error_print(err);
@@ -217,7 +406,7 @@ static int sm4_cl_set_key(SM4_CL_CTX *ctx, const uint8_t key[16], int enc)
 		sm4_set_decrypt_key((SM4_KEY *)ctx->rk, key);
 	}
 
-	if (!(ctx->mem_rk = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE|CL_MEM_USE_HOST_PTR, sizeof(SM4_KEY), ctx->rk, &err))) {
+	if (!(ctx->mem_rk = clCreateBuffer(ctx->context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR, sizeof(SM4_KEY), ctx->rk, &err))) {
 		cl_error_print(err);
 		goto end;
 	}
@@ -230,165 +419,1288 @@ static int sm4_cl_set_key(SM4_CL_CTX *ctx, const uint8_t key[16], int enc)
 
 
 end:
+	sm4_cl_cleanup(ctx);
 	return -1;
 }
 
 int sm4_cl_set_encrypt_key(SM4_CL_CTX *ctx, const uint8_t key[16])
 {
-	return sm4_cl_set_key(ctx, key, 1);
+	return sm4_cl_set_key(ctx, key, 1, NULL);
 }
 
 int sm4_cl_set_decrypt_key(SM4_CL_CTX *ctx, const uint8_t key[16])
 {
-	return sm4_cl_set_key(ctx, key, 0);
+	return sm4_cl_set_key(ctx, key, 0, NULL);
 }
 
-int sm4_cl_ctr32_encrypt_blocks(SM4_CL_CTX *ctx, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+int sm4_cl_set_encrypt_key_share(SM4_CL_CTX *ctx, const uint8_t key[16], const SM4_CL_CTX *share)
+{
+	if (!share) {
+		error_print();
+		return -1;
+	}
+	return sm4_cl_set_key(ctx, key, 1, share);
+}
+
+int sm4_cl_set_decrypt_key_share(SM4_CL_CTX *ctx, const uint8_t key[16], const SM4_CL_CTX *share)
+{
+	if (!share) {
+		error_print();
+		return -1;
+	}
+	return sm4_cl_set_key(ctx, key, 0, share);
+}
+
+// the kernel arguments are copied at the enqueue, one kernel object serves all the queues
+static int sm4_cl_enqueue_ctr32(cl_kernel kernel, cl_command_queue queue,
+	const uint32_t ctr[4], size_t nblocks, cl_mem mem)
 {
-	int ret = -1;
 	cl_int err;
-	uint32_t ctr[4];
-	cl_mem mem_ctr = NULL;
-	size_t inlen = SM4_BLOCK_SIZE * nblocks;
-	cl_mem mem_buf = NULL;
+	cl_uint nblocks32 = (cl_uint)nblocks;
 	cl_uint dim = 1;
-	size_t global_work_size = nblocks;
+	// on Apple M2, CL_KERNEL_WORK_GROUP_SIZE = 256
+	// but kernel will fail when local_work_size > 32.
+	// local_work_size might be restricted by the resources the kernel used.
 	size_t local_work_size = 32;
+	size_t global_work_size = (nblocks + local_work_size - 1)/local_work_size * local_work_size;
+	int i;
 
-	if (global_work_size % local_work_size) {
+	if (nblocks > 0xffffffff) {
 		error_print();
 		return -1;
 	}
+	for (i = 0; i < 4; i++) {
+		cl_uint c = ctr[i];
+		if ((err = clSetKernelArg(kernel, 1 + i, sizeof(cl_uint), &c)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+	}
+	if ((err = clSetKernelArg(kernel, 5, sizeof(cl_uint), &nblocks32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(kernel, 6, sizeof(cl_mem), &mem)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueNDRangeKernel(queue, kernel,
+		dim, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_cl_ctr32_encrypt_blocks(SM4_CL_CTX *ctx, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	cl_int err;
+	uint32_t ctr[4];
+	size_t inlen = SM4_BLOCK_SIZE * nblocks;
+
+	if (!nblocks) {
+		return 1;
+	}
 
 	ctr[0] = GETU32(iv);
 	ctr[1] = GETU32(iv + 4);
 	ctr[2] = GETU32(iv + 8);
 	ctr[3] = GETU32(iv + 12);
 
-	if (!(mem_ctr = clCreateBuffer(ctx->context, CL_MEM_READ_ONLY|CL_MEM_USE_HOST_PTR, sizeof(ctr), ctr, &err))) {
-		cl_error_print(err);
-		return -1;
-	}
-	if ((err = clSetKernelArg(ctx->kernel, 1, sizeof(cl_mem), &mem_ctr)) != CL_SUCCESS) {
-		cl_error_print(err);
-		goto end;
+	// the device buffer is kept for the next calls
+	if (ctx->mem_io_size < inlen) {
+		if (ctx->mem_io) {
+			clReleaseMemObject(ctx->mem_io);
+			ctx->mem_io = NULL;
+			ctx->mem_io_size = 0;
+		}
+		if (!(ctx->mem_io = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE, inlen, NULL, &err))) {
+			cl_error_print(err);
+			return -1;
+		}
+		ctx->mem_io_size = inlen;
 	}
 
-	if (out != in) {
-		memcpy(out, in, inlen);
-	}
-	if (!(mem_buf = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE|CL_MEM_USE_HOST_PTR, inlen, out, &err))) {
+	if ((err = clEnqueueWriteBuffer(ctx->queue, ctx->mem_io, CL_FALSE, 0, inlen, in, 0, NULL, NULL)) != CL_SUCCESS) {
 		cl_error_print(err);
 		return -1;
 	}
-	if ((err = clSetKernelArg(ctx->kernel, 2, sizeof(cl_mem), &mem_buf)) != CL_SUCCESS) {
-		cl_error_print(err);
-		goto end;
-	}
-
-	// on Apple M2, CL_KERNEL_WORK_GROUP_SIZE = 256
-	// but kernel will fail when local_work_size > 32.
-	// local_work_size might be restricted by the resources the kernel used.
-	if ((err = clEnqueueNDRangeKernel(ctx->queue, ctx->kernel,
-		dim, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS) {
-		cl_error_print(err);
-		goto end;
+	if (sm4_cl_enqueue_ctr32(ctx->kernel, ctx->queue, ctr, nblocks, ctx->mem_io) != 1) {
+		error_print();
+		return -1;
 	}
-	if (!clEnqueueMapBuffer(ctx->queue, mem_buf, CL_TRUE, 0, 0, inlen, 0, NULL, NULL, &err)) {
+	if ((err = clEnqueueReadBuffer(ctx->queue, ctx->mem_io, CL_TRUE, 0, inlen, out, 0, NULL, NULL)) != CL_SUCCESS) {
 		cl_error_print(err);
-		goto end;
+		return -1;
 	}
 
 	ctr[3] += (uint32_t)nblocks;
 	PUTU32(iv + 12, ctr[3]);
-	ret = 1;
-end:
-	if (mem_ctr) clReleaseMemObject(mem_ctr);
-	if (mem_buf) clReleaseMemObject(mem_buf);
-	return ret;
+	return 1;
 }
 
-#define KERNEL(...) #__VA_ARGS__
-static const char *sm4_cl_src = KERNEL(
-
-__constant unsigned char SBOX[256] = {
-	0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7, 0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
-	0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3, 0xaa, 0x44, 0x13, 0x26, 0x49, 0x86, 0x06, 0x99,
-	0x9c, 0x42, 0x50, 0xf4, 0x91, 0xef, 0x98, 0x7a, 0x33, 0x54, 0x0b, 0x43, 0xed, 0xcf, 0xac, 0x62,
-	0xe4, 0xb3, 0x1c, 0xa9, 0xc9, 0x08, 0xe8, 0x95, 0x80, 0xdf, 0x94, 0xfa, 0x75, 0x8f, 0x3f, 0xa6,
-	0x47, 0x07, 0xa7, 0xfc, 0xf3, 0x73, 0x17, 0xba, 0x83, 0x59, 0x3c, 0x19, 0xe6, 0x85, 0x4f, 0xa8,
-	0x68, 0x6b, 0x81, 0xb2, 0x71, 0x64, 0xda, 0x8b, 0xf8, 0xeb, 0x0f, 0x4b, 0x70, 0x56, 0x9d, 0x35,
-	0x1e, 0x24, 0x0e, 0x5e, 0x63, 0x58, 0xd1, 0xa2, 0x25, 0x22, 0x7c, 0x3b, 0x01, 0x21, 0x78, 0x87,
-	0xd4, 0x00, 0x46, 0x57, 0x9f, 0xd3, 0x27, 0x52, 0x4c, 0x36, 0x02, 0xe7, 0xa0, 0xc4, 0xc8, 0x9e,
-	0xea, 0xbf, 0x8a, 0xd2, 0x40, 0xc7, 0x38, 0xb5, 0xa3, 0xf7, 0xf2, 0xce, 0xf9, 0x61, 0x15, 0xa1,
-	0xe0, 0xae, 0x5d, 0xa4, 0x9b, 0x34, 0x1a, 0x55, 0xad, 0x93, 0x32, 0x30, 0xf5, 0x8c, 0xb1, 0xe3,
-	0x1d, 0xf6, 0xe2, 0x2e, 0x82, 0x66, 0xca, 0x60, 0xc0, 0x29, 0x23, 0xab, 0x0d, 0x53, 0x4e, 0x6f,
-	0xd5, 0xdb, 0x37, 0x45, 0xde, 0xfd, 0x8e, 0x2f, 0x03, 0xff, 0x6a, 0x72, 0x6d, 0x6c, 0x5b, 0x51,
-	0x8d, 0x1b, 0xaf, 0x92, 0xbb, 0xdd, 0xbc, 0x7f, 0x11, 0xd9, 0x5c, 0x41, 0x1f, 0x10, 0x5a, 0xd8,
-	0x0a, 0xc1, 0x31, 0x88, 0xa5, 0xcd, 0x7b, 0xbd, 0x2d, 0x74, 0xd0, 0x12, 0xb8, 0xe5, 0xb4, 0xb0,
-	0x89, 0x69, 0x97, 0x4a, 0x0c, 0x96, 0x77, 0x7e, 0x65, 0xb9, 0xf1, 0x09, 0xc5, 0x6e, 0xc6, 0x84,
-	0x18, 0xf0, 0x7d, 0xec, 0x3a, 0xdc, 0x4d, 0x20, 0x79, 0xee, 0x5f, 0x3e, 0xd7, 0xcb, 0x39, 0x48,
-};
-
-__kernel void sm4_ctr32_encrypt_blocks(__global const unsigned int *rkey, __global const unsigned int *ctr, __global unsigned char *data)
+void sm4_cl_ctr32_stream_cleanup(SM4_CL_STREAM *stream)
 {
-	unsigned int x0, x1, x2, x3, x4, i, t;
-	uint global_id = get_global_id(0);
-	__global unsigned int *out = (__global unsigned int *)(data + 16 * global_id);
+	size_t i;
 
-#if 0
-	// use local mem is little slower on Apple M2
-	__local unsigned char S[256];
-	__local unsigned int rk[32];
+	for (i = 0; i < SM4_CL_STREAM_SLOTS; i++) {
+		SM4_CL_STREAM_SLOT *slot = &stream->slots[i];
 
-	if (get_local_id(0) == 0) {
-		for (i = 0; i < 256; i++) {
-			S[i] = SBOX[i];
+		if (slot->queue) {
+			clFinish(slot->queue);
 		}
-		for (i = 0; i < 32; i++) {
-			rk[i] = rkey[i];
+		if (slot->done) {
+			clReleaseEvent(slot->done);
+		}
+		if (slot->host_buf) {
+			gmssl_secure_clear(slot->host_buf, stream->chunk_size);
+			clEnqueueUnmapMemObject(slot->queue, slot->host_mem, slot->host_buf, 0, NULL, NULL);
+			clFinish(slot->queue);
 		}
+		if (slot->host_mem) clReleaseMemObject(slot->host_mem);
+		if (slot->dev_mem) clReleaseMemObject(slot->dev_mem);
+		if (slot->queue) clReleaseCommandQueue(slot->queue);
 	}
-#else
-	__constant unsigned char *S = SBOX;
-	__global const unsigned int *rk = rkey;
-#endif
+	memset(stream, 0, sizeof(*stream));
+}
 
-	x0 = ctr[0];
-	x1 = ctr[1];
-	x2 = ctr[2];
-	x3 = ctr[3] + global_id;
+int sm4_cl_ctr32_stream_init(SM4_CL_STREAM *stream, SM4_CL_CTX *ctx, const uint8_t ctr[16],
+	size_t chunk_size, SM4_CL_STREAM_CALLBACK callback, void *cb_arg)
+{
+	cl_int err;
+	size_t i;
 
-	for (i = 0; i < 31; i++) {
-		x4 = x1 ^ x2 ^ x3 ^ rk[i];
-		x4 = (S[x4 >> 24] << 24) ^ (S[(x4 >> 16) & 0xff] << 16) ^ (S[(x4 >> 8) & 0xff] <<  8) ^ S[x4 & 0xff];
+	if (!stream || !ctx || !ctr || !callback) {
+		error_print();
+		return -1;
+	}
+	if (!chunk_size) {
+		chunk_size = SM4_CL_STREAM_CHUNK_SIZE;
+	}
+	if (chunk_size % SM4_BLOCK_SIZE || chunk_size / SM4_BLOCK_SIZE > 0xffffffff) {
+		error_print();
+		return -1;
+	}
+	memset(stream, 0, sizeof(*stream));
+	stream->ctx = ctx;
+	stream->chunk_size = chunk_size;
+	stream->ctr[0] = GETU32(ctr);
+	stream->ctr[1] = GETU32(ctr + 4);
+	stream->ctr[2] = GETU32(ctr + 8);
+	stream->ctr[3] = GETU32(ctr + 12);
+	stream->callback = callback;
+	stream->cb_arg = cb_arg;
 
-		x4 = x0 ^ (x4 ^
-			((x4 <<  2) | (x4 >> (32 -  2))) ^
-			((x4 << 10) | (x4 >> (32 - 10))) ^
-			((x4 << 18) | (x4 >> (32 - 18))) ^
-			((x4 << 24) | (x4 >> (32 - 24))));
+	for (i = 0; i < SM4_CL_STREAM_SLOTS; i++) {
+		SM4_CL_STREAM_SLOT *slot = &stream->slots[i];
 
-		t = x0;
-		x0 = x1;
-		x1 = x2;
-		x2 = x3;
-		x3 = x4;
-		x4 = t;
+		if (!(slot->queue = clCreateCommandQueue(ctx->context, ctx->device, 0, &err))
+			|| !(slot->host_mem = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE|CL_MEM_ALLOC_HOST_PTR, chunk_size, NULL, &err))
+			|| !(slot->dev_mem = clCreateBuffer(ctx->context, CL_MEM_READ_WRITE, chunk_size, NULL, &err))
+			|| !(slot->host_buf = (uint8_t *)clEnqueueMapBuffer(slot->queue, slot->host_mem, CL_TRUE,
+				CL_MAP_READ|CL_MAP_WRITE, 0, chunk_size, 0, NULL, NULL, &err))) {
+			cl_error_print(err);
+			sm4_cl_ctr32_stream_cleanup(stream);
+			return -1;
+		}
 	}
-	x4 = x1 ^ x2 ^ x3 ^ rk[i];
-	x4 = (S[x4 >> 24] << 24) ^ (S[(x4 >> 16) & 0xff] << 16) ^ (S[(x4 >> 8) & 0xff] <<  8) ^ S[x4 & 0xff];
+	return 1;
+}
 
-	x4 = x0 ^ (x4 ^
-		((x4 <<  2) | (x4 >> (32 -  2))) ^
-		((x4 << 10) | (x4 >> (32 - 10))) ^
-		((x4 << 18) | (x4 >> (32 - 18))) ^
-		((x4 << 24) | (x4 >> (32 - 24))));
+static int sm4_cl_stream_submit(SM4_CL_STREAM *stream)
+{
+	SM4_CL_STREAM_SLOT *slot = &stream->slots[(stream->head + stream->pending) % SM4_CL_STREAM_SLOTS];
+	size_t nblocks = (stream->fill + SM4_BLOCK_SIZE - 1) / SM4_BLOCK_SIZE;
+	size_t len = nblocks * SM4_BLOCK_SIZE;
+	cl_int err;
 
-	out[0] ^= (x4 >> 24) | ((x4 >> 8) & 0xff00) | ((x4 << 8) & 0xff0000) | (x4 << 24);
-	out[1] ^= (x3 >> 24) | ((x3 >> 8) & 0xff00) | ((x3 << 8) & 0xff0000) | (x3 << 24);
-	out[2] ^= (x2 >> 24) | ((x2 >> 8) & 0xff00) | ((x2 << 8) & 0xff0000) | (x2 << 24);
-	out[3] ^= (x1 >> 24) | ((x1 >> 8) & 0xff00) | ((x1 << 8) & 0xff0000) | (x1 << 24);
+	// the padding of a partial block is encrypted but not returned
+	memset(slot->host_buf + stream->fill, 0, len - stream->fill);
+
+	if ((err = clEnqueueWriteBuffer(slot->queue, slot->dev_mem, CL_FALSE, 0, len, slot->host_buf, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if (sm4_cl_enqueue_ctr32(stream->ctx->kernel, slot->queue, stream->ctr, nblocks, slot->dev_mem) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((err = clEnqueueReadBuffer(slot->queue, slot->dev_mem, CL_FALSE, 0, len, slot->host_buf, 0, NULL, &slot->done)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clFlush(slot->queue)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+
+	stream->ctr[3] += (uint32_t)nblocks;
+	slot->len = stream->fill;
+	stream->pending++;
+	stream->fill = 0;
+	return 1;
+}
+
+// returns 0 if the oldest chunk is not completed and `wait` is 0
+static int sm4_cl_stream_deliver(SM4_CL_STREAM *stream, int wait)
+{
+	SM4_CL_STREAM_SLOT *slot = &stream->slots[stream->head];
+	cl_int status;
+	cl_int err;
+
+	if (!stream->pending) {
+		return 0;
+	}
+	if (wait) {
+		if ((err = clWaitForEvents(1, &slot->done)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+	} else {
+		if ((err = clGetEventInfo(slot->done, CL_EVENT_COMMAND_EXECUTION_STATUS,
+			sizeof(status), &status, NULL)) != CL_SUCCESS) {
+			cl_error_print(err);
+			return -1;
+		}
+		if (status < 0) {
+			cl_error_print(status);
+			return -1;
+		}
+		if (status != CL_COMPLETE) {
+			return 0;
+		}
+	}
+	clReleaseEvent(slot->done);
+	slot->done = NULL;
+
+	if (stream->callback(stream->cb_arg, slot->host_buf, slot->len) != 1) {
+		error_print();
+		return -1;
+	}
+	stream->head = (stream->head + 1) % SM4_CL_STREAM_SLOTS;
+	stream->pending--;
+	return 1;
+}
+
+int sm4_cl_ctr32_stream_poll(SM4_CL_STREAM *stream)
+{
+	int ret;
+
+	while ((ret = sm4_cl_stream_deliver(stream, 0)) == 1) {
+	}
+	if (ret < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_cl_ctr32_stream_update(SM4_CL_STREAM *stream, const uint8_t *in, size_t inlen)
+{
+	while (inlen) {
+		SM4_CL_STREAM_SLOT *slot;
+		size_t len;
+
+		// all the slots are in flight, wait for the oldest one
+		if (stream->pending == SM4_CL_STREAM_SLOTS) {
+			if (sm4_cl_stream_deliver(stream, 1) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+		slot = &stream->slots[(stream->head + stream->pending) % SM4_CL_STREAM_SLOTS];
+
+		len = stream->chunk_size - stream->fill;
+		if (len > inlen) {
+			len = inlen;
+		}
+		memcpy(slot->host_buf + stream->fill, in, len);
+		stream->fill += len;
+		in += len;
+		inlen -= len;
+
+		if (stream->fill == stream->chunk_size) {
+			if (sm4_cl_stream_submit(stream) != 1
+				|| sm4_cl_ctr32_stream_poll(stream) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+	return 1;
+}
+
+int sm4_cl_ctr32_stream_finish(SM4_CL_STREAM *stream, uint8_t ctr[16])
+{
+	if (stream->fill) {
+		if (sm4_cl_stream_submit(stream) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	while (stream->pending) {
+		if (sm4_cl_stream_deliver(stream, 1) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (ctr) {
+		PUTU32(ctr, stream->ctr[0]);
+		PUTU32(ctr + 4, stream->ctr[1]);
+		PUTU32(ctr + 8, stream->ctr[2]);
+		PUTU32(ctr + 12, stream->ctr[3]);
+	}
+	return 1;
+}
+
+/*
+ * 4-bit Shoup table of H in the GCM bit order, as the portable GHASH of
+ * ghash.c, T[i] = (hi, lo) at table[2 * i], table[2 * i + 1]
+ */
+static void sm4_cl_ghash_table(const uint8_t h[16], cl_ulong table[32])
+{
+	uint64_t hi = GETU64(h);
+	uint64_t lo = GETU64(h + 8);
+	uint64_t t;
+	int i, j;
+
+	table[0] = 0;
+	table[1] = 0;
+	for (i = 8; i > 0; i >>= 1) {
+		table[2 * i] = hi;
+		table[2 * i + 1] = lo;
+		t = (uint64_t)0xe100000000000000 & (0 - (lo & 1));
+		lo = (hi << 63) | (lo >> 1);
+		hi = (hi >> 1) ^ t;
+	}
+	for (i = 2; i < 16; i <<= 1) {
+		for (j = 1; j < i; j++) {
+			table[2 * (i + j)] = table[2 * i] ^ table[2 * j];
+			table[2 * (i + j) + 1] = table[2 * i + 1] ^ table[2 * j + 1];
+		}
+	}
+}
+
+static void sm4_cl_gf128_pow(gf128_t r, const gf128_t h, size_t e)
+{
+	gf128_t a;
+
+	gf128_set_one(r);
+	a[0] = h[0];
+	a[1] = h[1];
+	while (e) {
+		if (e & 1) {
+			gf128_mul(r, r, a);
+		}
+		gf128_mul(a, a, a);
+		e >>= 1;
+	}
+}
+
+// the first measurement is taken as it is
+static void sm4_cl_rate_update(double *rate, size_t len, uint64_t nsec)
+{
+	double r;
+
+	if (!len) {
+		return;
+	}
+	r = (double)len / (double)(nsec ? nsec : 1);
+	*rate = *rate > 0 ? *rate * (1 - SM4_CL_MULTI_EWMA) + r * SM4_CL_MULTI_EWMA : r;
+}
+
+static void sm4_cl_device_cleanup(SM4_CL_DEVICE *dev)
+{
+	if (dev->ghash_kernel) clReleaseKernel(dev->ghash_kernel);
+	if (dev->xts_kernel) clReleaseKernel(dev->xts_kernel);
+	if (dev->ctr32_kernel) clReleaseKernel(dev->ctr32_kernel);
+	if (dev->program) clReleaseProgram(dev->program);
+	if (dev->queue) clReleaseCommandQueue(dev->queue);
+	if (dev->context) clReleaseContext(dev->context);
+	memset(dev, 0, sizeof(*dev));
+}
+
+static int sm4_cl_device_open(SM4_CL_DEVICE *dev, cl_device_id device)
+{
+	cl_ulong max_alloc;
+	cl_int err;
+
+	memset(dev, 0, sizeof(*dev));
+	dev->device = device;
+
+	if (!(dev->context = clCreateContext(NULL, 1, &device, NULL, NULL, &err))
+		|| !(dev->queue = clCreateCommandQueue(dev->context, device, CL_QUEUE_PROFILING_ENABLE, &err))) {
+		cl_error_print(err);
+		goto end;
+	}
+	if (gmssl_cl_build_program(dev->context, device, sm4_cl_src, &dev->program) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(dev->ctr32_kernel = clCreateKernel(dev->program, "sm4_ctr32_encrypt_blocks", &err))
+		|| !(dev->xts_kernel = clCreateKernel(dev->program, "sm4_xts_encrypt_sectors", &err))
+		|| !(dev->ghash_kernel = clCreateKernel(dev->program, "sm4_ghash_chunks", &err))) {
+		cl_error_print(err);
+		goto end;
+	}
+	if ((err = clGetDeviceInfo(device, CL_DEVICE_MAX_MEM_ALLOC_SIZE, sizeof(max_alloc), &max_alloc, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		goto end;
+	}
+	dev->max_alloc = max_alloc < SIZE_MAX ? (size_t)max_alloc : SIZE_MAX;
+	return 1;
+
+end:
+	sm4_cl_device_cleanup(dev);
+	return -1;
+}
+
+// the share of a device, enqueued without waiting
+typedef struct {
+	size_t len;
+	cl_mem mem_data;
+	cl_mem mem_rk1;
+	cl_mem mem_rk2; // the GHASH table of GCM
+	cl_mem mem_partials;
+	cl_ulong *partials; // GCM, (hi, lo) of every chunk
+	size_t nchunks;
+	cl_event begin; // the input transfer
+	cl_event end; // the last output transfer
+} SM4_CL_PART;
+
+static void sm4_cl_part_cleanup(SM4_CL_DEVICE *dev, SM4_CL_PART *part)
+{
+	// the output transfers write to the caller buffers
+	if (part->mem_data) {
+		clFinish(dev->queue);
+	}
+	if (part->begin) clReleaseEvent(part->begin);
+	if (part->end) clReleaseEvent(part->end);
+	if (part->mem_partials) clReleaseMemObject(part->mem_partials);
+	if (part->mem_rk2) clReleaseMemObject(part->mem_rk2);
+	if (part->mem_rk1) clReleaseMemObject(part->mem_rk1);
+	if (part->mem_data) clReleaseMemObject(part->mem_data);
+	if (part->partials) {
+		gmssl_secure_clear(part->partials, sizeof(cl_ulong) * 2 * part->nchunks);
+		free(part->partials);
+	}
+	memset(part, 0, sizeof(*part));
+}
+
+static int sm4_cl_part_finish(SM4_CL_PART *part, double *rate)
+{
+	cl_ulong begin, end;
+	cl_int err;
+
+	if ((err = clWaitForEvents(1, &part->end)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if (clGetEventProfilingInfo(part->begin, CL_PROFILING_COMMAND_START, sizeof(begin), &begin, NULL) == CL_SUCCESS
+		&& clGetEventProfilingInfo(part->end, CL_PROFILING_COMMAND_END, sizeof(end), &end, NULL) == CL_SUCCESS
+		&& end > begin) {
+		sm4_cl_rate_update(rate, part->len, end - begin);
+	}
+	return 1;
+}
+
+static int sm4_cl_part_xts(SM4_CL_DEVICE *dev, SM4_CL_PART *part,
+	const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out)
+{
+	cl_ulong tweak_lo = 0;
+	cl_ulong tweak_hi = 0;
+	cl_uint sector_size32 = (cl_uint)sector_size;
+	cl_uint nsectors32 = (cl_uint)nsectors;
+	size_t local_work_size = 32;
+	size_t global_work_size = (nsectors + local_work_size - 1)/local_work_size * local_work_size;
+	cl_int err;
+	int i;
+
+	if (nsectors > 0xffffffff) {
+		error_print();
+		return -1;
+	}
+	// the tweak is a little-endian integer
+	for (i = 7; i >= 0; i--) {
+		tweak_lo = (tweak_lo << 8) | tweak[i];
+		tweak_hi = (tweak_hi << 8) | tweak[8 + i];
+	}
+	part->len = sector_size * nsectors;
+
+	if (!(part->mem_data = clCreateBuffer(dev->context, CL_MEM_READ_WRITE, part->len, NULL, &err))
+		|| !(part->mem_rk1 = clCreateBuffer(dev->context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR,
+			sizeof(SM4_KEY), (void *)key1->rk, &err))
+		|| !(part->mem_rk2 = clCreateBuffer(dev->context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR,
+			sizeof(SM4_KEY), (void *)key2->rk, &err))) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueWriteBuffer(dev->queue, part->mem_data, CL_FALSE, 0, part->len, in, 0, NULL, &part->begin)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clSetKernelArg(dev->xts_kernel, 0, sizeof(cl_mem), &part->mem_rk1)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 1, sizeof(cl_mem), &part->mem_rk2)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 2, sizeof(cl_ulong), &tweak_lo)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 3, sizeof(cl_ulong), &tweak_hi)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 4, sizeof(cl_uint), &sector_size32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 5, sizeof(cl_uint), &nsectors32)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->xts_kernel, 6, sizeof(cl_mem), &part->mem_data)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueNDRangeKernel(dev->queue, dev->xts_kernel,
+		1, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueReadBuffer(dev->queue, part->mem_data, CL_FALSE, 0, part->len, out, 0, NULL, &part->end)) != CL_SUCCESS
+		|| (err = clFlush(dev->queue)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+static int sm4_cl_enqueue_ghash(SM4_CL_DEVICE *dev, SM4_CL_PART *part)
+{
+	cl_uint chunk_blocks = SM4_CL_GHASH_CHUNK_BLOCKS;
+	cl_ulong len = part->len;
+	size_t local_work_size = 32;
+	size_t global_work_size = (part->nchunks + local_work_size - 1)/local_work_size * local_work_size;
+	cl_int err;
+
+	if ((err = clSetKernelArg(dev->ghash_kernel, 0, sizeof(cl_mem), &part->mem_rk2)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->ghash_kernel, 1, sizeof(cl_uint), &chunk_blocks)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->ghash_kernel, 2, sizeof(cl_ulong), &len)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->ghash_kernel, 3, sizeof(cl_mem), &part->mem_data)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->ghash_kernel, 4, sizeof(cl_mem), &part->mem_partials)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueNDRangeKernel(dev->queue, dev->ghash_kernel,
+		1, NULL, &global_work_size, &local_work_size, 0, NULL, NULL)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+// `ctr` is the counter of the first block, `table` the GHASH table of H, `len` is a multiple of the chunk size
+static int sm4_cl_part_gcm(SM4_CL_DEVICE *dev, SM4_CL_PART *part, const SM4_KEY *key,
+	const uint32_t ctr[4], const cl_ulong table[32], const uint8_t *in, size_t len, uint8_t *out, int enc)
+{
+	cl_int err;
+
+	part->len = len;
+	part->nchunks = len / SM4_CL_GHASH_CHUNK_SIZE;
+	if (!(part->partials = (cl_ulong *)malloc(sizeof(cl_ulong) * 2 * part->nchunks))) {
+		error_print();
+		return -1;
+	}
+	if (!(part->mem_data = clCreateBuffer(dev->context, CL_MEM_READ_WRITE, len, NULL, &err))
+		|| !(part->mem_rk1 = clCreateBuffer(dev->context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR,
+			sizeof(SM4_KEY), (void *)key->rk, &err))
+		|| !(part->mem_rk2 = clCreateBuffer(dev->context, CL_MEM_READ_ONLY|CL_MEM_COPY_HOST_PTR,
+			sizeof(cl_ulong) * 32, (void *)table, &err))
+		|| !(part->mem_partials = clCreateBuffer(dev->context, CL_MEM_WRITE_ONLY,
+			sizeof(cl_ulong) * 2 * part->nchunks, NULL, &err))) {
+		cl_error_print(err);
+		return -1;
+	}
+	if ((err = clEnqueueWriteBuffer(dev->queue, part->mem_data, CL_FALSE, 0, len, in, 0, NULL, &part->begin)) != CL_SUCCESS
+		|| (err = clSetKernelArg(dev->ctr32_kernel, 0, sizeof(cl_mem), &part->mem_rk1)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+
+	// GHASH of the ciphertext, the queue is in-order
+	if (enc) {
+		if (sm4_cl_enqueue_ctr32(dev->ctr32_kernel, dev->queue, ctr, len / SM4_BLOCK_SIZE, part->mem_data) != 1
+			|| sm4_cl_enqueue_ghash(dev, part) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (sm4_cl_enqueue_ghash(dev, part) != 1
+			|| sm4_cl_enqueue_ctr32(dev->ctr32_kernel, dev->queue, ctr, len / SM4_BLOCK_SIZE, part->mem_data) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if ((err = clEnqueueReadBuffer(dev->queue, part->mem_data, CL_FALSE, 0, len, out, 0, NULL, NULL)) != CL_SUCCESS
+		|| (err = clEnqueueReadBuffer(dev->queue, part->mem_partials, CL_FALSE, 0,
+			sizeof(cl_ulong) * 2 * part->nchunks, part->partials, 0, NULL, &part->end)) != CL_SUCCESS
+		|| (err = clFlush(dev->queue)) != CL_SUCCESS) {
+		cl_error_print(err);
+		return -1;
+	}
+	return 1;
+}
+
+// the units of the devices in the order of multi->devices, parts[num_devices] of the CPU takes the rest
+static void sm4_cl_multi_partition(const SM4_CL_MULTI *multi, int op, size_t nunits, size_t unit_size,
+	size_t parts[SM4_CL_MAX_DEVICES + 1])
+{
+	double total = multi->cpu_rate[op];
+	size_t rest = nunits;
+	size_t max_units;
+	size_t i;
+
+	for (i = 0; i < multi->num_devices; i++) {
+		total += multi->devices[i].rate[op];
+	}
+	for (i = 0; i < multi->num_devices; i++) {
+		parts[i] = total > 0 ? (size_t)((double)nunits * multi->devices[i].rate[op] / total) : 0;
+		max_units = multi->devices[i].max_alloc / unit_size;
+		if (parts[i] > max_units) {
+			parts[i] = max_units;
+		}
+		// a small part costs more in the transfers than it saves
+		if (parts[i] * unit_size < SM4_CL_MULTI_MIN_PART_SIZE) {
+			parts[i] = 0;
+		}
+		if (parts[i] > rest) {
+			parts[i] = rest;
+		}
+		rest -= parts[i];
+	}
+	parts[multi->num_devices] = rest;
+}
+
+static void xts_tweak_add(uint8_t a[16], size_t n)
+{
+	uint64_t carry = n;
+	int i;
+
+	for (i = 0; i < 16 && carry; i++) {
+		carry += a[i];
+		a[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+static int sm4_cl_multi_xts(SM4_CL_MULTI *multi, const size_t parts[SM4_CL_MAX_DEVICES + 1],
+	const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, uint8_t *out, int enc)
+{
+	SM4_CL_PART jobs[SM4_CL_MAX_DEVICES];
+	uint8_t cpu_tweak[16];
+	size_t first = 0;
+	size_t cpu_sectors = parts[multi->num_devices];
+	uint64_t begin;
+	int ret = -1;
+	size_t i;
+
+	memset(jobs, 0, sizeof(jobs));
+
+	for (i = 0; i < multi->num_devices; i++) {
+		if (!parts[i]) {
+			continue;
+		}
+		memcpy(cpu_tweak, tweak, 16);
+		xts_tweak_add(cpu_tweak, first);
+		if (sm4_cl_part_xts(&multi->devices[i], &jobs[i], key1, key2, cpu_tweak, sector_size,
+			in + sector_size * first, parts[i], out + sector_size * first) != 1) {
+			error_print();
+			goto end;
+		}
+		first += parts[i];
+	}
+
+	// the share of the CPU while the devices run
+	if (cpu_sectors) {
+		memcpy(cpu_tweak, tweak, 16);
+		xts_tweak_add(cpu_tweak, first);
+		begin = metrics_nsec();
+		if ((enc ? sm4_xts_encrypt_sectors : sm4_xts_decrypt_sectors)(key1, key2, cpu_tweak, sector_size,
+			in + sector_size * first, cpu_sectors, out + sector_size * first, multi->cpu_threads) != 1) {
+			error_print();
+			goto end;
+		}
+		sm4_cl_rate_update(&multi->cpu_rate[SM4_CL_MULTI_XTS], sector_size * cpu_sectors, metrics_nsec() - begin);
+	}
+
+	for (i = 0; i < multi->num_devices; i++) {
+		if (parts[i] && sm4_cl_part_finish(&jobs[i], &multi->devices[i].rate[SM4_CL_MULTI_XTS]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+
+end:
+	for (i = 0; i < multi->num_devices; i++) {
+		sm4_cl_part_cleanup(&multi->devices[i], &jobs[i]);
+	}
+	return ret;
+}
+
+// parts[] count the chunks of SM4_CL_GHASH_CHUNK_SIZE bytes, the CPU also takes the tail of `in`
+static int sm4_cl_multi_gcm(SM4_CL_MULTI *multi, const size_t parts[SM4_CL_MAX_DEVICES + 1],
+	const SM4_KEY *key, const uint8_t *iv, size_t ivlen, const uint8_t *aad, size_t aadlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, uint8_t mac[16], int enc)
+{
+	SM4_CL_PART jobs[SM4_CL_MAX_DEVICES];
+	GHASH_CTX ghash_ctx;
+	cl_ulong table[32];
+	uint8_t H[16] = {0};
+	uint8_t Y[16];
+	uint8_t T[16];
+	uint8_t buf[16];
+	uint32_t ctr[4];
+	gf128_t h, hm, acc, p;
+	size_t off = 0;
+	size_t cpu_len;
+	size_t len, j;
+	uint64_t begin;
+	int ret = -1;
+	size_t i;
+
+	memset(jobs, 0, sizeof(jobs));
+
+	sm4_encrypt(key, H, H);
+	if (ivlen == 12) {
+		memcpy(Y, iv, 12);
+		Y[12] = Y[13] = Y[14] = 0;
+		Y[15] = 1;
+	} else {
+		ghash(H, NULL, 0, iv, ivlen, Y);
+	}
+	sm4_encrypt(key, Y, T);
+	ctr[0] = GETU32(Y);
+	ctr[1] = GETU32(Y + 4);
+	ctr[2] = GETU32(Y + 8);
+	ctr[3] = GETU32(Y + 12) + 1;
+	sm4_cl_ghash_table(H, table);
+
+	for (i = 0; i < multi->num_devices; i++) {
+		uint32_t part_ctr[4];
+
+		if (!parts[i]) {
+			continue;
+		}
+		part_ctr[0] = ctr[0];
+		part_ctr[1] = ctr[1];
+		part_ctr[2] = ctr[2];
+		part_ctr[3] = ctr[3] + (uint32_t)(off / SM4_BLOCK_SIZE);
+		len = SM4_CL_GHASH_CHUNK_SIZE * parts[i];
+		if (sm4_cl_part_gcm(&multi->devices[i], &jobs[i], key, part_ctr, table, in + off, len, out + off, enc) != 1) {
+			error_print();
+			goto end;
+		}
+		off += len;
+	}
+
+	// the share of the CPU while the devices run, hashed from a zero state as the chunks
+	cpu_len = inlen - off;
+	gf128_from_bytes(h, H);
+	gf128_set_zero(p);
+	if (cpu_len) {
+		begin = metrics_nsec();
+		PUTU32(Y + 12, ctr[3] + (uint32_t)(off / SM4_BLOCK_SIZE));
+		ghash_init(&ghash_ctx, H, NULL, 0);
+		for (j = off; j < inlen; j += len) {
+			len = inlen - j < SM4_CL_GHASH_CHUNK_SIZE ? inlen - j : SM4_CL_GHASH_CHUNK_SIZE;
+			if (enc) {
+				sm4_ctr32_encrypt(key, Y, in + j, len, out + j);
+				ghash_update(&ghash_ctx, out + j, len);
+			} else {
+				// `in` might be `out`
+				ghash_update(&ghash_ctx, in + j, len);
+				sm4_ctr32_encrypt(key, Y, in + j, len, out + j);
+			}
+		}
+		if (cpu_len % 16) {
+			memset(buf, 0, sizeof(buf));
+			ghash_update(&ghash_ctx, buf, 16 - cpu_len % 16);
+		}
+		p[0] = ghash_ctx.X[0];
+		p[1] = ghash_ctx.X[1];
+		gmssl_secure_clear(&ghash_ctx, sizeof(ghash_ctx));
+		sm4_cl_rate_update(&multi->cpu_rate[SM4_CL_MULTI_GCM], cpu_len, metrics_nsec() - begin);
+	}
+
+	// X = X * H^m + P over the AAD, the chunks of the devices and the part of the CPU
+	ghash_init(&ghash_ctx, H, aad, aadlen);
+	acc[0] = ghash_ctx.X[0];
+	acc[1] = ghash_ctx.X[1];
+	gmssl_secure_clear(&ghash_ctx, sizeof(ghash_ctx));
+
+	sm4_cl_gf128_pow(hm, h, SM4_CL_GHASH_CHUNK_BLOCKS);
+	for (i = 0; i < multi->num_devices; i++) {
+		if (!parts[i]) {
+			continue;
+		}
+		if (sm4_cl_part_finish(&jobs[i], &multi->devices[i].rate[SM4_CL_MULTI_GCM]) != 1) {
+			error_print();
+			goto end;
+		}
+		for (j = 0; j < jobs[i].nchunks; j++) {
+			gf128_t c;
+			PUTU64(buf, (uint64_t)jobs[i].partials[2 * j]);
+			PUTU64(buf + 8, (uint64_t)jobs[i].partials[2 * j + 1]);
+			gf128_from_bytes(c, buf);
+			gf128_mul(acc, acc, hm);
+			gf128_add(acc, acc, c);
+		}
+	}
+	if (cpu_len) {
+		sm4_cl_gf128_pow(hm, h, (cpu_len + 15) / 16);
+		gf128_mul(acc, acc, hm);
+		gf128_add(acc, acc, p);
+	}
+
+	PUTU64(buf, (uint64_t)aadlen << 3);
+	PUTU64(buf + 8, (uint64_t)inlen << 3);
+	gf128_from_bytes(p, buf);
+	gf128_add(acc, acc, p);
+	gf128_mul(acc, acc, h);
+	gf128_to_bytes(acc, buf);
+	gmssl_memxor(mac, T, buf, 16);
+	ret = 1;
+
+end:
+	for (i = 0; i < multi->num_devices; i++) {
+		sm4_cl_part_cleanup(&multi->devices[i], &jobs[i]);
+	}
+	gmssl_secure_clear(table, sizeof(table));
+	gmssl_secure_clear(H, sizeof(H));
+	gmssl_secure_clear(T, sizeof(T));
+	gmssl_secure_clear(h, sizeof(h));
+	gmssl_secure_clear(hm, sizeof(hm));
+	gmssl_secure_clear(acc, sizeof(acc));
+	gmssl_secure_clear(p, sizeof(p));
+	return ret;
+}
+
+// every backend alone on the same job
+static int sm4_cl_multi_calibrate(SM4_CL_MULTI *multi)
+{
+	size_t parts[SM4_CL_MAX_DEVICES + 1];
+	size_t sector_size = 4096;
+	SM4_KEY key;
+	uint8_t zero[16] = {0};
+	uint8_t mac[16];
+	uint8_t *buf;
+	int ret = -1;
+	size_t i;
+
+	if (!(buf = (uint8_t *)calloc(1, SM4_CL_MULTI_CALIBRATE_SIZE))) {
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&key, zero);
+
+	for (i = 0; i <= multi->num_devices; i++) {
+		memset(parts, 0, sizeof(parts));
+		parts[i] = SM4_CL_MULTI_CALIBRATE_SIZE / sector_size;
+		if (sm4_cl_multi_xts(multi, parts, &key, &key, zero, sector_size, buf, buf, 1) != 1) {
+			error_print();
+			goto end;
+		}
+		parts[i] = SM4_CL_MULTI_CALIBRATE_SIZE / SM4_CL_GHASH_CHUNK_SIZE;
+		if (sm4_cl_multi_gcm(multi, parts, &key, zero, 12, NULL, 0,
+			buf, SM4_CL_MULTI_CALIBRATE_SIZE, buf, mac, 1) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+end:
+	gmssl_secure_clear(&key, sizeof(key));
+	free(buf);
+	return ret;
+}
+
+void sm4_cl_multi_cleanup(SM4_CL_MULTI *multi)
+{
+	size_t i;
+
+	for (i = 0; i < multi->num_devices; i++) {
+		sm4_cl_device_cleanup(&multi->devices[i]);
+	}
+	memset(multi, 0, sizeof(*multi));
+}
+
+int sm4_cl_multi_init(SM4_CL_MULTI *multi, int cpu_threads)
+{
+	cl_platform_id platforms[SM4_CL_MAX_PLATFORMS];
+	cl_device_id devices[SM4_CL_MAX_DEVICES];
+	cl_uint num_platforms = 0;
+	cl_uint num_devices;
+	cl_uint i, j;
+	cl_int err;
+
+	if (!multi) {
+		error_print();
+		return -1;
+	}
+	memset(multi, 0, sizeof(*multi));
+	multi->cpu_threads = cpu_threads;
+
+	// no OpenCL platform, the CPU does all the work
+	if (clGetPlatformIDs(SM4_CL_MAX_PLATFORMS, platforms, &num_platforms) != CL_SUCCESS) {
+		num_platforms = 0;
+	}
+	if (num_platforms > SM4_CL_MAX_PLATFORMS) {
+		num_platforms = SM4_CL_MAX_PLATFORMS;
+	}
+	for (i = 0; i < num_platforms && multi->num_devices < SM4_CL_MAX_DEVICES; i++) {
+		cl_uint max = (cl_uint)(SM4_CL_MAX_DEVICES - multi->num_devices);
+
+		if ((err = clGetDeviceIDs(platforms[i], CL_DEVICE_TYPE_GPU, max, devices, &num_devices)) != CL_SUCCESS) {
+			if (err != CL_DEVICE_NOT_FOUND) {
+				cl_error_print(err);
+			}
+			continue;
+		}
+		if (num_devices > max) {
+			num_devices = max;
+		}
+		// a device failing to build the kernels is skipped
+		for (j = 0; j < num_devices; j++) {
+			if (sm4_cl_device_open(&multi->devices[multi->num_devices], devices[j]) == 1) {
+				multi->num_devices++;
+			}
+		}
+	}
+
+	if (sm4_cl_multi_calibrate(multi) != 1) {
+		error_print();
+		sm4_cl_multi_cleanup(multi);
+		return -1;
+	}
+	return 1;
+}
+
+static int sm4_cl_multi_xts_sectors(SM4_CL_MULTI *multi, const SM4_KEY *key1, const SM4_KEY *key2,
+	const uint8_t tweak[16], size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int enc)
+{
+	size_t parts[SM4_CL_MAX_DEVICES + 1];
+
+	if (!multi || !key1 || !key2 || !tweak || (nsectors && (!in || !out))) {
+		error_print();
+		return -1;
+	}
+	if (sector_size < SM4_BLOCK_SIZE || sector_size % SM4_BLOCK_SIZE || sector_size > 0xffffffff) {
+		error_print();
+		return -1;
+	}
+	if (!nsectors) {
+		return 1;
+	}
+	sm4_cl_multi_partition(multi, SM4_CL_MULTI_XTS, nsectors, sector_size, parts);
+	if (sm4_cl_multi_xts(multi, parts, key1, key2, tweak, sector_size, in, out, enc) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_cl_multi_xts_encrypt_sectors(SM4_CL_MULTI *multi, const SM4_KEY *key1, const SM4_KEY *key2,
+	const uint8_t tweak[16], size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out)
+{
+	return sm4_cl_multi_xts_sectors(multi, key1, key2, tweak, sector_size, in, nsectors, out, 1);
+}
+
+int sm4_cl_multi_xts_decrypt_sectors(SM4_CL_MULTI *multi, const SM4_KEY *key1, const SM4_KEY *key2,
+	const uint8_t tweak[16], size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out)
+{
+	return sm4_cl_multi_xts_sectors(multi, key1, key2, tweak, sector_size, in, nsectors, out, 0);
+}
+
+int sm4_cl_multi_gcm_encrypt(SM4_CL_MULTI *multi, const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t taglen, uint8_t *tag)
+{
+	size_t parts[SM4_CL_MAX_DEVICES + 1];
+	uint8_t mac[16];
+
+	if (!multi || !key || !iv || !ivlen || (!aad && aadlen) || (inlen && (!in || !out)) || !tag) {
+		error_print();
+		return -1;
+	}
+	if (taglen > SM4_GCM_MAX_TAG_SIZE || inlen > SM4_GCM_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	sm4_cl_multi_partition(multi, SM4_CL_MULTI_GCM, inlen / SM4_CL_GHASH_CHUNK_SIZE, SM4_CL_GHASH_CHUNK_SIZE, parts);
+	if (sm4_cl_multi_gcm(multi, parts, key, iv, ivlen, aad, aadlen, in, inlen, out, mac, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(tag, mac, taglen);
+	gmssl_secure_clear(mac, sizeof(mac));
+	return 1;
+}
+
+int sm4_cl_multi_gcm_decrypt(SM4_CL_MULTI *multi, const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
+	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
+	const uint8_t *tag, size_t taglen, uint8_t *out)
+{
+	size_t parts[SM4_CL_MAX_DEVICES + 1];
+	uint8_t mac[16];
+
+	if (!multi || !key || !iv || !ivlen || (!aad && aadlen) || (inlen && (!in || !out)) || !tag) {
+		error_print();
+		return -1;
+	}
+	if (taglen > SM4_GCM_MAX_TAG_SIZE || inlen > SM4_GCM_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	sm4_cl_multi_partition(multi, SM4_CL_MULTI_GCM, inlen / SM4_CL_GHASH_CHUNK_SIZE, SM4_CL_GHASH_CHUNK_SIZE, parts);
+	if (sm4_cl_multi_gcm(multi, parts, key, iv, ivlen, aad, aadlen, in, inlen, out, mac, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(mac, tag, taglen) != 0) {
+		// never release unauthenticated plaintext
+		gmssl_secure_clear(out, inlen);
+		gmssl_secure_clear(mac, sizeof(mac));
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(mac, sizeof(mac));
+	return 1;
+}
+
+#define KERNEL(...) #__VA_ARGS__
+static const char *sm4_cl_src = KERNEL(
+
+__constant unsigned char SBOX[256] = {
+	0xd6, 0x90, 0xe9, 0xfe, 0xcc, 0xe1, 0x3d, 0xb7, 0x16, 0xb6, 0x14, 0xc2, 0x28, 0xfb, 0x2c, 0x05,
+	0x2b, 0x67, 0x9a, 0x76, 0x2a, 0xbe, 0x04, 0xc3, 0xaa, 0x44, 0x13, 0x26, 0x49, 0x86, 0x06, 0x99,
+	0x9c, 0x42, 0x50, 0xf4, 0x91, 0xef, 0x98, 0x7a, 0x33, 0x54, 0x0b, 0x43, 0xed, 0xcf, 0xac, 0x62,
+	0xe4, 0xb3, 0x1c, 0xa9, 0xc9, 0x08, 0xe8, 0x95, 0x80, 0xdf, 0x94, 0xfa, 0x75, 0x8f, 0x3f, 0xa6,
+	0x47, 0x07, 0xa7, 0xfc, 0xf3, 0x73, 0x17, 0xba, 0x83, 0x59, 0x3c, 0x19, 0xe6, 0x85, 0x4f, 0xa8,
+	0x68, 0x6b, 0x81, 0xb2, 0x71, 0x64, 0xda, 0x8b, 0xf8, 0xeb, 0x0f, 0x4b, 0x70, 0x56, 0x9d, 0x35,
+	0x1e, 0x24, 0x0e, 0x5e, 0x63, 0x58, 0xd1, 0xa2, 0x25, 0x22, 0x7c, 0x3b, 0x01, 0x21, 0x78, 0x87,
+	0xd4, 0x00, 0x46, 0x57, 0x9f, 0xd3, 0x27, 0x52, 0x4c, 0x36, 0x02, 0xe7, 0xa0, 0xc4, 0xc8, 0x9e,
+	0xea, 0xbf, 0x8a, 0xd2, 0x40, 0xc7, 0x38, 0xb5, 0xa3, 0xf7, 0xf2, 0xce, 0xf9, 0x61, 0x15, 0xa1,
+	0xe0, 0xae, 0x5d, 0xa4, 0x9b, 0x34, 0x1a, 0x55, 0xad, 0x93, 0x32, 0x30, 0xf5, 0x8c, 0xb1, 0xe3,
+	0x1d, 0xf6, 0xe2, 0x2e, 0x82, 0x66, 0xca, 0x60, 0xc0, 0x29, 0x23, 0xab, 0x0d, 0x53, 0x4e, 0x6f,
+	0xd5, 0xdb, 0x37, 0x45, 0xde, 0xfd, 0x8e, 0x2f, 0x03, 0xff, 0x6a, 0x72, 0x6d, 0x6c, 0x5b, 0x51,
+	0x8d, 0x1b, 0xaf, 0x92, 0xbb, 0xdd, 0xbc, 0x7f, 0x11, 0xd9, 0x5c, 0x41, 0x1f, 0x10, 0x5a, 0xd8,
+	0x0a, 0xc1, 0x31, 0x88, 0xa5, 0xcd, 0x7b, 0xbd, 0x2d, 0x74, 0xd0, 0x12, 0xb8, 0xe5, 0xb4, 0xb0,
+	0x89, 0x69, 0x97, 0x4a, 0x0c, 0x96, 0x77, 0x7e, 0x65, 0xb9, 0xf1, 0x09, 0xc5, 0x6e, 0xc6, 0x84,
+	0x18, 0xf0, 0x7d, 0xec, 0x3a, 0xdc, 0x4d, 0x20, 0x79, 0xee, 0x5f, 0x3e, 0xd7, 0xcb, 0x39, 0x48,
+};
+
+// the global work size is rounded up to the work group size, the items >= nblocks do nothing
+__kernel void sm4_ctr32_encrypt_blocks(__global const unsigned int *rkey,
+	unsigned int ctr0, unsigned int ctr1, unsigned int ctr2, unsigned int ctr3,
+	unsigned int nblocks, __global unsigned char *data)
+{
+	unsigned int x0, x1, x2, x3, x4, i, t;
+	uint global_id = get_global_id(0);
+	__global unsigned int *out = (__global unsigned int *)(data + 16 * global_id);
+
+	if (global_id >= nblocks) {
+		return;
+	}
+
+#if 0
+	// use local mem is little slower on Apple M2
+	__local unsigned char S[256];
+	__local unsigned int rk[32];
+
+	if (get_local_id(0) == 0) {
+		for (i = 0; i < 256; i++) {
+			S[i] = SBOX[i];
+		}
+		for (i = 0; i < 32; i++) {
+			rk[i] = rkey[i];
+		}
+	}
+#else
+	__constant unsigned char *S = SBOX;
+	__global const unsigned int *rk = rkey;
+#endif
+
+	x0 = ctr0;
+	x1 = ctr1;
+	x2 = ctr2;
+	x3 = ctr3 + global_id;
+
+	for (i = 0; i < 31; i++) {
+		x4 = x1 ^ x2 ^ x3 ^ rk[i];
+		x4 = (S[x4 >> 24] << 24) ^ (S[(x4 >> 16) & 0xff] << 16) ^ (S[(x4 >> 8) & 0xff] <<  8) ^ S[x4 & 0xff];
+
+		x4 = x0 ^ (x4 ^
+			((x4 <<  2) | (x4 >> (32 -  2))) ^
+			((x4 << 10) | (x4 >> (32 - 10))) ^
+			((x4 << 18) | (x4 >> (32 - 18))) ^
+			((x4 << 24) | (x4 >> (32 - 24))));
+
+		t = x0;
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = x4;
+		x4 = t;
+	}
+	x4 = x1 ^ x2 ^ x3 ^ rk[i];
+	x4 = (S[x4 >> 24] << 24) ^ (S[(x4 >> 16) & 0xff] << 16) ^ (S[(x4 >> 8) & 0xff] <<  8) ^ S[x4 & 0xff];
+
+	x4 = x0 ^ (x4 ^
+		((x4 <<  2) | (x4 >> (32 -  2))) ^
+		((x4 << 10) | (x4 >> (32 - 10))) ^
+		((x4 << 18) | (x4 >> (32 - 18))) ^
+		((x4 << 24) | (x4 >> (32 - 24))));
+
+	out[0] ^= (x4 >> 24) | ((x4 >> 8) & 0xff00) | ((x4 << 8) & 0xff0000) | (x4 << 24);
+	out[1] ^= (x3 >> 24) | ((x3 >> 8) & 0xff00) | ((x3 << 8) & 0xff0000) | (x3 << 24);
+	out[2] ^= (x2 >> 24) | ((x2 >> 8) & 0xff00) | ((x2 << 8) & 0xff0000) | (x2 << 24);
+	out[3] ^= (x1 >> 24) | ((x1 >> 8) & 0xff00) | ((x1 << 8) & 0xff0000) | (x1 << 24);
+}
+
+__constant ulong GHASH_REM_4BIT[16] = {
+	0x0000000000000000UL, 0x1C20000000000000UL, 0x3840000000000000UL, 0x2460000000000000UL,
+	0x7080000000000000UL, 0x6CA0000000000000UL, 0x48C0000000000000UL, 0x54E0000000000000UL,
+	0xE100000000000000UL, 0xFD20000000000000UL, 0xD940000000000000UL, 0xC560000000000000UL,
+	0x9180000000000000UL, 0x8DA0000000000000UL, 0xA9C0000000000000UL, 0xB5E0000000000000UL,
+};
+
+uint sm4_cl_load_be32(__global const uchar *p)
+{
+	return ((uint)p[0] << 24) | ((uint)p[1] << 16) | ((uint)p[2] << 8) | p[3];
+}
+
+void sm4_cl_store_be32(__global uchar *p, uint x)
+{
+	p[0] = (uchar)(x >> 24);
+	p[1] = (uchar)(x >> 16);
+	p[2] = (uchar)(x >> 8);
+	p[3] = (uchar)x;
+}
+
+uint sm4_cl_bswap32(uint x)
+{
+	return (x >> 24) | ((x >> 8) & 0xff00) | ((x << 8) & 0xff0000) | (x << 24);
+}
+
+// one block as big-endian words, the schedule `rk` decides the direction
+void sm4_cl_encrypt(__global const uint *rk, uint *x)
+{
+	uint x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4, i;
+
+	for (i = 0; i < 32; i++) {
+		x4 = x1 ^ x2 ^ x3 ^ rk[i];
+		x4 = (SBOX[x4 >> 24] << 24) ^ (SBOX[(x4 >> 16) & 0xff] << 16) ^ (SBOX[(x4 >> 8) & 0xff] <<  8) ^ SBOX[x4 & 0xff];
+
+		x4 = x0 ^ (x4 ^
+			((x4 <<  2) | (x4 >> (32 -  2))) ^
+			((x4 << 10) | (x4 >> (32 - 10))) ^
+			((x4 << 18) | (x4 >> (32 - 18))) ^
+			((x4 << 24) | (x4 >> (32 - 24))));
+
+		x0 = x1;
+		x1 = x2;
+		x2 = x3;
+		x3 = x4;
+	}
+	x[0] = x3;
+	x[1] = x2;
+	x[2] = x1;
+	x[3] = x0;
+}
+
+// one work-item per sector, the sector i uses the tweak (tweak_hi, tweak_lo) + i,
+// `rk1` is the encryption or the decryption schedule of key1
+__kernel void sm4_xts_encrypt_sectors(__global const uint *rk1, __global const uint *rk2,
+	ulong tweak_lo, ulong tweak_hi, uint sector_size, uint nsectors, __global uchar *data)
+{
+	uint global_id = get_global_id(0);
+	__global uchar *p = data + (size_t)sector_size * global_id;
+	ulong lo, hi, carry;
+	uint t[4], x[4];
+	uint i, j;
+
+	if (global_id >= nsectors) {
+		return;
+	}
+
+	lo = tweak_lo + global_id;
+	hi = tweak_hi + (lo < tweak_lo ? 1 : 0);
+	t[0] = sm4_cl_bswap32((uint)lo);
+	t[1] = sm4_cl_bswap32((uint)(lo >> 32));
+	t[2] = sm4_cl_bswap32((uint)hi);
+	t[3] = sm4_cl_bswap32((uint)(hi >> 32));
+	sm4_cl_encrypt(rk2, t);
+	hi = ((ulong)t[0] << 32) | t[1];
+	lo = ((ulong)t[2] << 32) | t[3];
+
+	for (i = 0; i < sector_size; i += 16) {
+		t[0] = (uint)(hi >> 32);
+		t[1] = (uint)hi;
+		t[2] = (uint)(lo >> 32);
+		t[3] = (uint)lo;
+		for (j = 0; j < 4; j++) {
+			x[j] = sm4_cl_load_be32(p + i + 4 * j) ^ t[j];
+		}
+		sm4_cl_encrypt(rk1, x);
+		for (j = 0; j < 4; j++) {
+			sm4_cl_store_be32(p + i + 4 * j, x[j] ^ t[j]);
+		}
+
+		// T = T * x, as xts_tweak_double() of sm4_xts.c
+		carry = lo & 1;
+		lo = (lo >> 1) | (hi << 63);
+		hi = (hi >> 1) ^ (carry ? 0xe100000000000000UL : 0);
+	}
+}
+
+// the work-item i hashes the blocks of data[chunk_blocks * 16 * i, len) in the chunk i
+// from a zero state, the last block is padded with zeros. `table` is the 4-bit table of H
+__kernel void sm4_ghash_chunks(__global const ulong *table, uint chunk_blocks, ulong len,
+	__global const uchar *data, __global ulong *partials)
+{
+	uint global_id = get_global_id(0);
+	ulong off = (ulong)chunk_blocks * 16 * global_id;
+	ulong end = off + (ulong)chunk_blocks * 16;
+	ulong xhi = 0, xlo = 0, zhi, zlo;
+	uchar b[16];
+	uint k, n, rem;
+
+	if (off >= len) {
+		return;
+	}
+	if (end > len) {
+		end = len;
+	}
+
+	for (; off < end; off += 16) {
+		for (k = 0; k < 8; k++) {
+			xhi ^= (ulong)(off + k < end ? data[off + k] : 0) << (56 - 8 * k);
+			xlo ^= (ulong)(off + 8 + k < end ? data[off + 8 + k] : 0) << (56 - 8 * k);
+		}
+		for (k = 0; k < 8; k++) {
+			b[k] = (uchar)(xhi >> (56 - 8 * k));
+			b[8 + k] = (uchar)(xlo >> (56 - 8 * k));
+		}
+
+		zhi = zlo = 0;
+		for (k = 16; k > 0; k--) {
+			n = b[k - 1] & 0xf;
+			rem = (uint)(zlo & 0xf);
+			zlo = (zhi << 60) | (zlo >> 4);
+			zhi = (zhi >> 4) ^ GHASH_REM_4BIT[rem];
+			zhi ^= table[2 * n];
+			zlo ^= table[2 * n + 1];
+
+			n = b[k - 1] >> 4;
+			rem = (uint)(zlo & 0xf);
+			zlo = (zhi << 60) | (zlo >> 4);
+			zhi = (zhi >> 4) ^ GHASH_REM_4BIT[rem];
+			zhi ^= table[2 * n];
+			zlo ^= table[2 * n + 1];
+		}
+		xhi = zhi;
+		xlo = zlo;
+	}
+	partials[2 * global_id] = xhi;
+	partials[2 * global_id + 1] = xlo;
 }
 
 );
@@ -60,6 +60,7 @@ int sm4_ctr_encrypt_init(SM4_CTR_CTX *ctx,
 	memcpy(ctx->ctr, ctr, SM4_BLOCK_SIZE);
 	memset(ctx->block, 0, SM4_BLOCK_SIZE);
 	ctx->block_nbytes = 0;
+	ctx->keystream_nbytes = 0;
 	return 1;
 }
 
@@ -133,6 +134,41 @@ int sm4_ctr_encrypt_finish(SM4_CTR_CTX *ctx, uint8_t *out, size_t *outlen)
 	return 1;
 }
 
+/*
+ * Small updates would reach `sm4_ctr32_encrypt_blocks` one or a few blocks at a
+ * time and never use the wide SIMD kernels. The keystream is generated
+ * SM4_CTR_KEYSTREAM_BLOCKS blocks ahead and consumed across the updates, only
+ * long runs of blocks with no keystream left go to the bulk function directly.
+ */
+static void sm4_ctr32_ctx_encrypt_blocks(SM4_CTR_CTX *ctx, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	while (nblocks) {
+		if (ctx->keystream_nbytes) {
+			const uint8_t *keystream = ctx->keystream + sizeof(ctx->keystream) - ctx->keystream_nbytes;
+			size_t len = nblocks * SM4_BLOCK_SIZE;
+
+			if (len > ctx->keystream_nbytes) {
+				len = ctx->keystream_nbytes;
+			}
+			gmssl_memxor(out, in, keystream, len);
+			ctx->keystream_nbytes -= len;
+			in += len;
+			out += len;
+			nblocks -= len / SM4_BLOCK_SIZE;
+
+		} else if (nblocks >= SM4_CTR_KEYSTREAM_BLOCKS) {
+			sm4_ctr32_encrypt_blocks(&ctx->sm4_key, ctx->ctr, in, nblocks, out);
+			return;
+
+		} else {
+			memset(ctx->keystream, 0, sizeof(ctx->keystream));
+			sm4_ctr32_encrypt_blocks(&ctx->sm4_key, ctx->ctr, ctx->keystream,
+				SM4_CTR_KEYSTREAM_BLOCKS, ctx->keystream);
+			ctx->keystream_nbytes = sizeof(ctx->keystream);
+		}
+	}
+}
+
 int sm4_ctr32_encrypt_init(SM4_CTR_CTX *ctx,
 	const uint8_t key[SM4_BLOCK_SIZE], const uint8_t ctr[SM4_BLOCK_SIZE])
 {
@@ -144,6 +180,7 @@ int sm4_ctr32_encrypt_init(SM4_CTR_CTX *ctx,
 	memcpy(ctx->ctr, ctr, SM4_BLOCK_SIZE);
 	memset(ctx->block, 0, SM4_BLOCK_SIZE);
 	ctx->block_nbytes = 0;
+	ctx->keystream_nbytes = 0;
 	return 1;
 }
 
@@ -175,7 +212,7 @@ int sm4_ctr32_encrypt_update(SM4_CTR_CTX *ctx,
 			return 1;
 		}
 		memcpy(ctx->block + ctx->block_nbytes, in, left);
-		sm4_ctr32_encrypt_blocks(&ctx->sm4_key, ctx->ctr, ctx->block, 1, out);
+		sm4_ctr32_ctx_encrypt_blocks(ctx, ctx->block, 1, out);
 		in += left;
 		inlen -= left;
 		out += SM4_BLOCK_SIZE;
@@ -184,7 +221,7 @@ int sm4_ctr32_encrypt_update(SM4_CTR_CTX *ctx,
 	if (inlen >= SM4_BLOCK_SIZE) {
 		nblocks = inlen / SM4_BLOCK_SIZE;
 		len = nblocks * SM4_BLOCK_SIZE;
-		sm4_ctr32_encrypt_blocks(&ctx->sm4_key, ctx->ctr, in, nblocks, out);
+		sm4_ctr32_ctx_encrypt_blocks(ctx, in, nblocks, out);
 		in += len;
 		inlen -= len;
 		out += len;
@@ -211,7 +248,7 @@ int sm4_ctr32_encrypt_finish(SM4_CTR_CTX *ctx, uint8_t *out, size_t *outlen)
 		error_print();
 		return -1;
 	}
-	sm4_ctr32_encrypt_blocks(&ctx->sm4_key, ctx->ctr, ctx->block, 1, ctx->block);
+	sm4_ctr32_ctx_encrypt_blocks(ctx, ctx->block, 1, ctx->block);
 	memcpy(out, ctx->block, ctx->block_nbytes);
 	*outlen = ctx->block_nbytes;
 	return 1;
@@ -25,10 +25,39 @@ static void ctr32_incr(uint8_t a[16])
 	}
 }
 
+/*
+ * CTR and GHASH are stitched over chunks of SM4_GCM_STITCH_SIZE bytes: each
+ * chunk is hashed right after (encrypt) or before (decrypt) the CTR pass,
+ * while it is still in L1, so the data is streamed from memory only once.
+ * The chunk is large enough for the 16-block SM4 and 8-block GHASH kernels.
+ */
+#define SM4_GCM_STITCH_SIZE	1024
+
+static void sm4_gcm_ctr32_ghash(const SM4_KEY *key, uint8_t ctr[16], GHASH_CTX *ghash_ctx,
+	const uint8_t *in, size_t inlen, uint8_t *out, int enc)
+{
+	while (inlen) {
+		size_t len = inlen < SM4_GCM_STITCH_SIZE ? inlen : SM4_GCM_STITCH_SIZE;
+
+		if (enc) {
+			sm4_ctr32_encrypt(key, ctr, in, len, out);
+			ghash_update(ghash_ctx, out, len);
+		} else {
+			// hash the ciphertext first, `in` might be `out`
+			ghash_update(ghash_ctx, in, len);
+			sm4_ctr32_encrypt(key, ctr, in, len, out);
+		}
+		in += len;
+		out += len;
+		inlen -= len;
+	}
+}
+
 int sm4_gcm_encrypt(const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t taglen, uint8_t *tag)
 {
+	GHASH_CTX ghash_ctx;
 	uint8_t H[16] = {0};
 	uint8_t Y[16];
 	uint8_t T[16];
@@ -50,12 +79,15 @@ int sm4_gcm_encrypt(const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
 
 	sm4_encrypt(key, Y, T);
 
+	ghash_init(&ghash_ctx, H, aad, aadlen);
 	ctr32_incr(Y);
-	sm4_ctr32_encrypt(key, Y, in, inlen, out);
+	sm4_gcm_ctr32_ghash(key, Y, &ghash_ctx, in, inlen, out, 1);
+	ghash_finish(&ghash_ctx, H);
 
-	ghash(H, aad, aadlen, out, inlen, H);
 	gmssl_memxor(tag, T, H, taglen);
 
+	gmssl_secure_clear(H, sizeof(H));
+	gmssl_secure_clear(T, sizeof(T));
 	return 1;
 }
 
@@ -63,6 +95,7 @@ int sm4_gcm_decrypt(const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out)
 {
+	GHASH_CTX ghash_ctx;
 	uint8_t H[16] = {0};
 	uint8_t Y[16];
 	uint8_t T[16];
@@ -77,18 +110,22 @@ int sm4_gcm_decrypt(const SM4_KEY *key, const uint8_t *iv, size_t ivlen,
 		ghash(H, NULL, 0, iv, ivlen, Y);
 	}
 
-	ghash(H, aad, aadlen, in, inlen, H);
-
 	sm4_encrypt(key, Y, T);
+
+	ghash_init(&ghash_ctx, H, aad, aadlen);
+	ctr32_incr(Y);
+	sm4_gcm_ctr32_ghash(key, Y, &ghash_ctx, in, inlen, out, 0);
+	ghash_finish(&ghash_ctx, H);
+
 	gmssl_memxor(T, T, H, taglen);
+	gmssl_secure_clear(H, sizeof(H));
 	if (memcmp(T, tag, taglen) != 0) {
+		// never release unauthenticated plaintext
+		gmssl_secure_clear(out, inlen);
 		error_print();
 		return -1;
 	}
 
-	ctr32_incr(Y);
-	sm4_ctr32_encrypt(key, Y, in, inlen, out);
-
 	return 1;
 }
 
@@ -156,11 +193,21 @@ int sm4_gcm_encrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 		*outlen = 16 * ((inlen + 15)/16);
 		return 1;
 	}
-	if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, inlen, out, outlen) != 1) {
-		error_print();
-		return -1;
+	*outlen = 0;
+	while (inlen) {
+		size_t len = inlen < SM4_GCM_STITCH_SIZE ? inlen : SM4_GCM_STITCH_SIZE;
+		size_t nbytes;
+
+		if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, len, out, &nbytes) != 1) {
+			error_print();
+			return -1;
+		}
+		ghash_update(&ctx->mac_ctx, out, nbytes);
+		in += len;
+		inlen -= len;
+		out += nbytes;
+		*outlen += nbytes;
 	}
-	ghash_update(&ctx->mac_ctx, out, *outlen);
 	return 1;
 }
 
@@ -248,13 +295,21 @@ int sm4_gcm_decrypt_update(SM4_GCM_CTX *ctx, const uint8_t *in, size_t inlen, ui
 		out += *outlen;
 
 		inlen -= ctx->taglen;
-		ghash_update(&ctx->mac_ctx, in, inlen);
-		if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, inlen, out, &len) != 1) {
-			error_print();
-			return -1;
-		}
-		*outlen += len;
 		memcpy(ctx->mac, in + inlen, GHASH_SIZE);
+		while (inlen) {
+			size_t nbytes;
+
+			len = inlen < SM4_GCM_STITCH_SIZE ? inlen : SM4_GCM_STITCH_SIZE;
+			ghash_update(&ctx->mac_ctx, in, len);
+			if (sm4_ctr32_encrypt_update(&ctx->enc_ctx, in, len, out, &nbytes) != 1) {
+				error_print();
+				return -1;
+			}
+			in += len;
+			inlen -= len;
+			out += nbytes;
+			*outlen += nbytes;
+		}
 	}
 	return 1;
 }
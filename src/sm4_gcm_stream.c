@@ -0,0 +1,340 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm3.h>
+#include <gmssl/hkdf.h>
+#include <gmssl/digest.h>
+#include <gmssl/mem.h>
+#include <gmssl/rand.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+#include <gmssl/sm4_gcm_stream.h>
+#include <gmssl/thread_pool.h>
+
+
+static const uint8_t sm4_gcm_stream_magic[4] = { 'S', 'G', 'C', 'M' };
+
+static const char *sm4_gcm_stream_label = "GmSSL SM4-GCM stream";
+
+#define SM4_GCM_STREAM_HEADER_MAC_OFFSET	(SM4_GCM_STREAM_HEADER_SIZE - SM3_HMAC_SIZE)
+
+// okm = sm4_key (16) || mac_key (32) || nonce_prefix (7)
+#define SM4_GCM_STREAM_OKM_SIZE	(SM4_KEY_SIZE + SM3_HMAC_SIZE + SM4_GCM_STREAM_NONCE_PREFIX_SIZE)
+
+static int sm4_gcm_stream_set_key(SM4_GCM_STREAM_CTX *ctx, const uint8_t key[SM4_KEY_SIZE],
+	const uint8_t header[SM4_GCM_STREAM_HEADER_SIZE], uint8_t mac[SM3_HMAC_SIZE])
+{
+	uint8_t prk[SM3_DIGEST_SIZE];
+	size_t prklen;
+	uint8_t info[32 + 16];
+	size_t infolen = strlen(sm4_gcm_stream_label);
+	uint8_t okm[SM4_GCM_STREAM_OKM_SIZE];
+	SM3_HMAC_CTX hmac_ctx;
+
+	memcpy(info, sm4_gcm_stream_label, infolen);
+	memcpy(info + infolen, header, 16);
+	infolen += 16;
+
+	if (hkdf_extract(DIGEST_sm3(), header + 16, SM4_GCM_STREAM_SALT_SIZE, key, SM4_KEY_SIZE, prk, &prklen) != 1
+		|| hkdf_expand(DIGEST_sm3(), prk, prklen, info, infolen, sizeof(okm), okm) != 1) {
+		gmssl_secure_clear(prk, sizeof(prk));
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&ctx->sm4_key, okm);
+	sm3_hmac_init(&hmac_ctx, okm + SM4_KEY_SIZE, SM3_HMAC_SIZE);
+	sm3_hmac_update(&hmac_ctx, header, SM4_GCM_STREAM_HEADER_MAC_OFFSET);
+	sm3_hmac_finish(&hmac_ctx, mac);
+	memcpy(ctx->nonce_prefix, okm + SM4_KEY_SIZE + SM3_HMAC_SIZE, SM4_GCM_STREAM_NONCE_PREFIX_SIZE);
+
+	gmssl_secure_clear(prk, sizeof(prk));
+	gmssl_secure_clear(okm, sizeof(okm));
+	gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+	return 1;
+}
+
+int sm4_gcm_stream_encrypt_init(SM4_GCM_STREAM_CTX *ctx, const uint8_t key[SM4_KEY_SIZE],
+	size_t segment_size, uint8_t header[SM4_GCM_STREAM_HEADER_SIZE])
+{
+	if (!ctx || !key || !header) {
+		error_print();
+		return -1;
+	}
+	if (segment_size < SM4_GCM_STREAM_MIN_SEGMENT_SIZE
+		|| segment_size > SM4_GCM_STREAM_MAX_SEGMENT_SIZE) {
+		error_print();
+		return -1;
+	}
+
+	memset(header, 0, SM4_GCM_STREAM_HEADER_SIZE);
+	memcpy(header, sm4_gcm_stream_magic, sizeof(sm4_gcm_stream_magic));
+	header[4] = SM4_GCM_STREAM_VERSION;
+	PUTU32(header + 8, (uint32_t)segment_size);
+	if (rand_bytes(header + 16, SM4_GCM_STREAM_SALT_SIZE) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm4_gcm_stream_set_key(ctx, key, header, header + SM4_GCM_STREAM_HEADER_MAC_OFFSET) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->segment_size = segment_size;
+	return 1;
+}
+
+int sm4_gcm_stream_decrypt_init(SM4_GCM_STREAM_CTX *ctx, const uint8_t key[SM4_KEY_SIZE],
+	const uint8_t header[SM4_GCM_STREAM_HEADER_SIZE])
+{
+	uint8_t mac[SM3_HMAC_SIZE];
+	size_t segment_size;
+
+	if (!ctx || !key || !header) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(header, sm4_gcm_stream_magic, sizeof(sm4_gcm_stream_magic)) != 0
+		|| header[4] != SM4_GCM_STREAM_VERSION) {
+		error_print();
+		return -1;
+	}
+	segment_size = GETU32(header + 8);
+	if (segment_size < SM4_GCM_STREAM_MIN_SEGMENT_SIZE
+		|| segment_size > SM4_GCM_STREAM_MAX_SEGMENT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (sm4_gcm_stream_set_key(ctx, key, header, mac) != 1) {
+		error_print();
+		return -1;
+	}
+	// a wrong key or a modified header
+	if (gmssl_secure_memcmp(mac, header + SM4_GCM_STREAM_HEADER_MAC_OFFSET, SM3_HMAC_SIZE) != 0) {
+		gmssl_secure_clear(ctx, sizeof(SM4_GCM_STREAM_CTX));
+		error_print();
+		return -1;
+	}
+	ctx->segment_size = segment_size;
+	return 1;
+}
+
+typedef struct {
+	const SM4_GCM_STREAM_CTX *ctx;
+	int enc;
+	uint64_t index;		// stream index of the first segment
+	size_t nsegs;
+	const uint8_t *in;
+	uint8_t *out;
+	size_t last_len;	// plaintext length of the final segment of the job
+	int is_last;		// the final segment of the job ends the stream
+	int ret;
+} SM4_GCM_STREAM_JOB;
+
+static void sm4_gcm_stream_segments(SM4_GCM_STREAM_JOB *job)
+{
+	const SM4_GCM_STREAM_CTX *ctx = job->ctx;
+	uint8_t nonce[SM4_GCM_STREAM_NONCE_PREFIX_SIZE + 5];
+	const uint8_t *in = job->in;
+	uint8_t *out = job->out;
+	size_t len;
+	size_t i;
+
+	memcpy(nonce, ctx->nonce_prefix, SM4_GCM_STREAM_NONCE_PREFIX_SIZE);
+	job->ret = 1;
+
+	for (i = 0; i < job->nsegs; i++) {
+		len = (i == job->nsegs - 1) ? job->last_len : ctx->segment_size;
+		PUTU32(nonce + SM4_GCM_STREAM_NONCE_PREFIX_SIZE, (uint32_t)(job->index + i));
+		nonce[sizeof(nonce) - 1] = (i == job->nsegs - 1) ? (uint8_t)job->is_last : 0;
+
+		if (job->enc) {
+			if (sm4_gcm_encrypt(&ctx->sm4_key, nonce, sizeof(nonce), NULL, 0, in, len,
+				out, SM4_GCM_STREAM_TAG_SIZE, out + len) != 1) {
+				job->ret = -1;
+				return;
+			}
+			in += len;
+			out += len + SM4_GCM_STREAM_TAG_SIZE;
+		} else {
+			if (sm4_gcm_decrypt(&ctx->sm4_key, nonce, sizeof(nonce), NULL, 0, in, len,
+				in + len, SM4_GCM_STREAM_TAG_SIZE, out) != 1) {
+				job->ret = -1;
+				return;
+			}
+			in += len + SM4_GCM_STREAM_TAG_SIZE;
+			out += len;
+		}
+	}
+}
+
+static void sm4_gcm_stream_task(void *arg)
+{
+	sm4_gcm_stream_segments((SM4_GCM_STREAM_JOB *)arg);
+}
+
+// every thread gets at least SM4_GCM_STREAM_THREAD_MIN_SIZE bytes, below that a thread costs more than it saves
+#define SM4_GCM_STREAM_THREAD_MIN_SIZE	(256 * 1024)
+
+// `nsegs` segments, all of `segment_size` plaintext bytes but the final one of `last_len`
+static int sm4_gcm_stream_segments_ex(const SM4_GCM_STREAM_CTX *ctx, int enc, uint64_t index,
+	const uint8_t *in, size_t nsegs, size_t last_len, int is_last, uint8_t *out, int threads)
+{
+	SM4_GCM_STREAM_JOB jobs[SM4_GCM_STREAM_MAX_THREADS];
+	size_t seglen = ctx->segment_size + SM4_GCM_STREAM_TAG_SIZE;
+	size_t in_seglen = enc ? ctx->segment_size : seglen;
+	size_t out_seglen = enc ? seglen : ctx->segment_size;
+	size_t max_threads;
+	size_t first, end;
+	int ret = 1;
+	int i;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM4_GCM_STREAM_MAX_THREADS) {
+		threads = SM4_GCM_STREAM_MAX_THREADS;
+	}
+	max_threads = nsegs / (SM4_GCM_STREAM_THREAD_MIN_SIZE / ctx->segment_size + 1);
+	if ((size_t)threads > max_threads) {
+		threads = max_threads ? (int)max_threads : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		first = nsegs * i / threads;
+		end = nsegs * (i + 1) / threads;
+		jobs[i].ctx = ctx;
+		jobs[i].enc = enc;
+		jobs[i].index = index + first;
+		jobs[i].nsegs = end - first;
+		jobs[i].in = in + in_seglen * first;
+		jobs[i].out = out + out_seglen * first;
+		jobs[i].last_len = (end == nsegs) ? last_len : ctx->segment_size;
+		jobs[i].is_last = (end == nsegs) ? is_last : 0;
+	}
+	gmssl_thread_pool_run(sm4_gcm_stream_task, jobs, sizeof(jobs[0]), (size_t)threads);
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+int sm4_gcm_stream_encrypt_segments(const SM4_GCM_STREAM_CTX *ctx, uint64_t index,
+	const uint8_t *in, size_t inlen, int is_last, uint8_t *out, size_t *outlen, int threads)
+{
+	size_t nsegs;
+	size_t last_len;
+
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (!is_last) {
+		if (inlen % ctx->segment_size) {
+			error_print();
+			return -1;
+		}
+		if (!inlen) {
+			*outlen = 0;
+			return 1;
+		}
+		nsegs = inlen / ctx->segment_size;
+		last_len = ctx->segment_size;
+	} else if (!inlen) {
+		// an empty stream still has its final segment
+		nsegs = 1;
+		last_len = 0;
+	} else {
+		nsegs = (inlen + ctx->segment_size - 1) / ctx->segment_size;
+		last_len = inlen - ctx->segment_size * (nsegs - 1);
+	}
+	if (index > SM4_GCM_STREAM_MAX_SEGMENTS - nsegs) {
+		error_print();
+		return -1;
+	}
+
+	if (sm4_gcm_stream_segments_ex(ctx, 1, index, in, nsegs, last_len, is_last, out, threads) != 1) {
+		error_print();
+		return -1;
+	}
+	*outlen = inlen + SM4_GCM_STREAM_TAG_SIZE * nsegs;
+	return 1;
+}
+
+int sm4_gcm_stream_decrypt_segments(const SM4_GCM_STREAM_CTX *ctx, uint64_t index,
+	const uint8_t *in, size_t inlen, int is_last, uint8_t *out, size_t *outlen, int threads)
+{
+	size_t seglen;
+	size_t nsegs;
+	size_t last_len;
+
+	if (!ctx || (!in && inlen) || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	seglen = ctx->segment_size + SM4_GCM_STREAM_TAG_SIZE;
+	if (!is_last) {
+		if (inlen % seglen) {
+			error_print();
+			return -1;
+		}
+		if (!inlen) {
+			*outlen = 0;
+			return 1;
+		}
+		nsegs = inlen / seglen;
+		last_len = ctx->segment_size;
+	} else {
+		if (!inlen) {
+			error_print();
+			return -1;
+		}
+		nsegs = (inlen + seglen - 1) / seglen;
+		if (inlen - seglen * (nsegs - 1) < SM4_GCM_STREAM_TAG_SIZE) {
+			error_print();
+			return -1;
+		}
+		last_len = inlen - seglen * (nsegs - 1) - SM4_GCM_STREAM_TAG_SIZE;
+	}
+	if (index > SM4_GCM_STREAM_MAX_SEGMENTS - nsegs) {
+		error_print();
+		return -1;
+	}
+
+	if (sm4_gcm_stream_segments_ex(ctx, 0, index, in, nsegs, last_len, is_last, out, threads) != 1) {
+		gmssl_secure_clear(out, inlen - SM4_GCM_STREAM_TAG_SIZE * nsegs);
+		error_print();
+		return -1;
+	}
+	*outlen = inlen - SM4_GCM_STREAM_TAG_SIZE * nsegs;
+	return 1;
+}
+
+int sm4_gcm_stream_plaintext_size(size_t segment_size, uint64_t ciphertext_size, uint64_t *plaintext_size)
+{
+	uint64_t seglen = (uint64_t)segment_size + SM4_GCM_STREAM_TAG_SIZE;
+	uint64_t nsegs;
+
+	if (segment_size < SM4_GCM_STREAM_MIN_SEGMENT_SIZE
+		|| segment_size > SM4_GCM_STREAM_MAX_SEGMENT_SIZE || !plaintext_size) {
+		error_print();
+		return -1;
+	}
+	nsegs = (ciphertext_size + seglen - 1) / seglen;
+	if (!nsegs || nsegs > SM4_GCM_STREAM_MAX_SEGMENTS
+		|| ciphertext_size - seglen * (nsegs - 1) < SM4_GCM_STREAM_TAG_SIZE) {
+		error_print();
+		return -1;
+	}
+	*plaintext_size = ciphertext_size - SM4_GCM_STREAM_TAG_SIZE * nsegs;
+	return 1;
+}
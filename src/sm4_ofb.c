@@ -8,10 +8,40 @@
  */
 
 
+#include <stdlib.h>
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
 #include <gmssl/error.h>
 
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION ofb_mutex_t;
+typedef CONDITION_VARIABLE ofb_cond_t;
+typedef HANDLE ofb_thread_t;
+#define ofb_mutex_init(m)	InitializeCriticalSection(m)
+#define ofb_mutex_destroy(m)	DeleteCriticalSection(m)
+#define ofb_mutex_lock(m)	EnterCriticalSection(m)
+#define ofb_mutex_unlock(m)	LeaveCriticalSection(m)
+#define ofb_cond_init(c)	InitializeConditionVariable(c)
+#define ofb_cond_destroy(c)
+#define ofb_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define ofb_cond_signal(c)	WakeConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t ofb_mutex_t;
+typedef pthread_cond_t ofb_cond_t;
+typedef pthread_t ofb_thread_t;
+#define ofb_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define ofb_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define ofb_mutex_lock(m)	pthread_mutex_lock(m)
+#define ofb_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define ofb_cond_init(c)	pthread_cond_init(c, NULL)
+#define ofb_cond_destroy(c)	pthread_cond_destroy(c)
+#define ofb_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define ofb_cond_signal(c)	pthread_cond_signal(c)
+#endif
+
 
 // sm4_ofb_encrypt iv type is not compatible with sm4_cbc_encrypt, careful if inlen % 16 != 0
 void sm4_ofb_encrypt(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t inlen, uint8_t *out)
@@ -111,3 +141,261 @@ int sm4_ofb_encrypt_finish(SM4_OFB_CTX *ctx, uint8_t *out, size_t *outlen)
 	return 1;
 }
 
+
+/*
+ * `mutex` guards the ring, `gen_mutex` the OFB state `iv` and is taken first.
+ * The keystream is generated holding only `gen_mutex`, so the readers of the
+ * ring are never blocked by the block cipher. `count` is in bytes and is not
+ * always a multiple of the block size.
+ */
+#define SM4_OFB_STREAM_BATCH_BLOCKS	16
+
+struct SM4_OFB_STREAM_st {
+	ofb_mutex_t mutex;
+	ofb_mutex_t gen_mutex;
+	ofb_cond_t not_full;
+	SM4_KEY sm4_key;
+	uint8_t iv[SM4_BLOCK_SIZE];
+	uint8_t *ring;
+	size_t size;
+	size_t head;
+	size_t count;
+	int stop;
+	int background;
+	ofb_thread_t thread;
+};
+
+// copy `len` bytes into the ring, the caller holds `mutex` and checked the room
+static void sm4_ofb_stream_push(SM4_OFB_STREAM *stream, const uint8_t *keystream, size_t len)
+{
+	size_t tail = (stream->head + stream->count) % stream->size;
+	size_t n = stream->size - tail;
+
+	if (n > len) {
+		n = len;
+	}
+	memcpy(stream->ring + tail, keystream, n);
+	memcpy(stream->ring, keystream + n, len - n);
+	stream->count += len;
+}
+
+// XOR with up to `len` bytes of the ring, return the number of bytes done
+static size_t sm4_ofb_stream_pop_xor(SM4_OFB_STREAM *stream, const uint8_t *in, size_t len, uint8_t *out)
+{
+	size_t done = 0;
+
+	ofb_mutex_lock(&stream->mutex);
+	if (len > stream->count) {
+		len = stream->count;
+	}
+	while (done < len) {
+		size_t n = stream->size - stream->head;
+
+		if (n > len - done) {
+			n = len - done;
+		}
+		gmssl_memxor(out + done, in + done, stream->ring + stream->head, n);
+		gmssl_secure_clear(stream->ring + stream->head, n);
+		stream->head = (stream->head + n) % stream->size;
+		stream->count -= n;
+		done += n;
+	}
+	if (done) {
+		ofb_cond_signal(&stream->not_full);
+	}
+	ofb_mutex_unlock(&stream->mutex);
+	return done;
+}
+
+static void sm4_ofb_stream_fill(SM4_OFB_STREAM *stream, int background)
+{
+	uint8_t keystream[SM4_BLOCK_SIZE * SM4_OFB_STREAM_BATCH_BLOCKS];
+	size_t nblocks;
+	size_t i;
+
+	for (;;) {
+		ofb_mutex_lock(&stream->mutex);
+		if (background) {
+			// wake up for whole batches only
+			while (!stream->stop && stream->size - stream->count < sizeof(keystream)) {
+				ofb_cond_wait(&stream->not_full, &stream->mutex);
+			}
+		}
+		if (stream->stop) {
+			ofb_mutex_unlock(&stream->mutex);
+			break;
+		}
+		ofb_mutex_unlock(&stream->mutex);
+
+		ofb_mutex_lock(&stream->gen_mutex);
+		ofb_mutex_lock(&stream->mutex);
+		// the room only grows while `gen_mutex` is held
+		nblocks = (stream->size - stream->count) / SM4_BLOCK_SIZE;
+		ofb_mutex_unlock(&stream->mutex);
+		if (nblocks > SM4_OFB_STREAM_BATCH_BLOCKS) {
+			nblocks = SM4_OFB_STREAM_BATCH_BLOCKS;
+		}
+		if (!nblocks) {
+			ofb_mutex_unlock(&stream->gen_mutex);
+			if (background) {
+				continue;
+			}
+			break;
+		}
+		for (i = 0; i < nblocks; i++) {
+			sm4_encrypt(&stream->sm4_key, stream->iv, stream->iv);
+			memcpy(keystream + SM4_BLOCK_SIZE * i, stream->iv, SM4_BLOCK_SIZE);
+		}
+		ofb_mutex_lock(&stream->mutex);
+		sm4_ofb_stream_push(stream, keystream, SM4_BLOCK_SIZE * nblocks);
+		ofb_mutex_unlock(&stream->mutex);
+		ofb_mutex_unlock(&stream->gen_mutex);
+	}
+
+	gmssl_secure_clear(keystream, sizeof(keystream));
+}
+
+#ifdef _WIN32
+static unsigned __stdcall sm4_ofb_stream_thread(void *arg)
+{
+	sm4_ofb_stream_fill((SM4_OFB_STREAM *)arg, 1);
+	return 0;
+}
+#else
+static void *sm4_ofb_stream_thread(void *arg)
+{
+	sm4_ofb_stream_fill((SM4_OFB_STREAM *)arg, 1);
+	return NULL;
+}
+#endif
+
+SM4_OFB_STREAM *sm4_ofb_stream_new(const uint8_t key[SM4_KEY_SIZE], const uint8_t iv[SM4_BLOCK_SIZE],
+	size_t nblocks, int background)
+{
+	SM4_OFB_STREAM *stream;
+
+	if (!key || !iv) {
+		error_print();
+		return NULL;
+	}
+	if (nblocks < SM4_OFB_STREAM_MIN_BLOCKS) {
+		error_print();
+		return NULL;
+	}
+	if (!(stream = (SM4_OFB_STREAM *)calloc(1, sizeof(*stream)))) {
+		error_print();
+		return NULL;
+	}
+	if (!(stream->ring = (uint8_t *)calloc(nblocks, SM4_BLOCK_SIZE))) {
+		free(stream);
+		error_print();
+		return NULL;
+	}
+	stream->size = SM4_BLOCK_SIZE * nblocks;
+	sm4_set_encrypt_key(&stream->sm4_key, key);
+	memcpy(stream->iv, iv, SM4_BLOCK_SIZE);
+	ofb_mutex_init(&stream->mutex);
+	ofb_mutex_init(&stream->gen_mutex);
+	ofb_cond_init(&stream->not_full);
+
+	if (background) {
+#ifdef _WIN32
+		stream->thread = (HANDLE)_beginthreadex(NULL, 0, sm4_ofb_stream_thread, stream, 0, NULL);
+		if (stream->thread) {
+			stream->background = 1;
+		}
+#else
+		if (pthread_create(&stream->thread, NULL, sm4_ofb_stream_thread, stream) == 0) {
+			stream->background = 1;
+		}
+#endif
+		if (!stream->background) {
+			sm4_ofb_stream_free(stream);
+			error_print();
+			return NULL;
+		}
+	}
+	return stream;
+}
+
+void sm4_ofb_stream_free(SM4_OFB_STREAM *stream)
+{
+	if (!stream) {
+		return;
+	}
+	if (stream->background) {
+		ofb_mutex_lock(&stream->mutex);
+		stream->stop = 1;
+		ofb_cond_signal(&stream->not_full);
+		ofb_mutex_unlock(&stream->mutex);
+#ifdef _WIN32
+		WaitForSingleObject(stream->thread, INFINITE);
+		CloseHandle(stream->thread);
+#else
+		pthread_join(stream->thread, NULL);
+#endif
+	}
+	ofb_cond_destroy(&stream->not_full);
+	ofb_mutex_destroy(&stream->gen_mutex);
+	ofb_mutex_destroy(&stream->mutex);
+
+	gmssl_secure_clear(stream->ring, stream->size);
+	free(stream->ring);
+	gmssl_secure_clear(stream, sizeof(*stream));
+	free(stream);
+}
+
+int sm4_ofb_stream_refill(SM4_OFB_STREAM *stream)
+{
+	if (!stream) {
+		error_print();
+		return -1;
+	}
+	sm4_ofb_stream_fill(stream, 0);
+	return 1;
+}
+
+size_t sm4_ofb_stream_available(SM4_OFB_STREAM *stream)
+{
+	size_t count;
+
+	ofb_mutex_lock(&stream->mutex);
+	count = stream->count;
+	ofb_mutex_unlock(&stream->mutex);
+	return count;
+}
+
+int sm4_ofb_stream_encrypt(SM4_OFB_STREAM *stream, const uint8_t *in, size_t inlen, uint8_t *out)
+{
+	size_t len;
+
+	if (!stream || (!in && inlen) || (!out && inlen)) {
+		error_print();
+		return -1;
+	}
+
+	while (inlen) {
+		if ((len = sm4_ofb_stream_pop_xor(stream, in, inlen, out)) == 0) {
+			uint8_t block[SM4_BLOCK_SIZE];
+
+			// ring drained, generate the keystream of the next block inline
+			ofb_mutex_lock(&stream->gen_mutex);
+			ofb_mutex_lock(&stream->mutex);
+			if (stream->count == 0) {
+				sm4_encrypt(&stream->sm4_key, stream->iv, stream->iv);
+				len = inlen < SM4_BLOCK_SIZE ? inlen : SM4_BLOCK_SIZE;
+				gmssl_memxor(out, in, stream->iv, len);
+				// the rest of the block is kept for the next call
+				memcpy(block, stream->iv, SM4_BLOCK_SIZE);
+				sm4_ofb_stream_push(stream, block + len, SM4_BLOCK_SIZE - len);
+				gmssl_secure_clear(block, sizeof(block));
+			}
+			ofb_mutex_unlock(&stream->mutex);
+			ofb_mutex_unlock(&stream->gen_mutex);
+		}
+		in += len;
+		out += len;
+		inlen -= len;
+	}
+	return 1;
+}
@@ -0,0 +1,180 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SM4 with the RISC-V Zksed scalar extension
+ *
+ * sm4ed rd, rs1, rs2, bs computes rs1 ^ L(S(byte bs of rs2) << 8*bs), four
+ * of them with bs = 0..3 make one round X4 = X0 ^ L(S(X1 ^ X2 ^ X3 ^ rk)).
+ * Two blocks are interleaved to hide the latency of the dependent chain.
+ * The kernels are selected by the dispatcher in sm4.c when the CPU reports
+ * Zksed, see `gmssl_cpu_features`.
+ */
+
+#include <string.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+
+
+#define SM4ED(x, t, bs) \
+	__asm__ ("sm4ed %0, %0, %1, " #bs : "+r"(x) : "r"(t))
+
+#define ROUND(r, X0, X1, X2, X3)		\
+	T = X1 ^ X2 ^ X3 ^ rk[r];		\
+	SM4ED(X0, T, 0);			\
+	SM4ED(X0, T, 1);			\
+	SM4ED(X0, T, 2);			\
+	SM4ED(X0, T, 3)
+
+#define ROUND2(r, X0, X1, X2, X3, Y0, Y1, Y2, Y3)	\
+	T = X1 ^ X2 ^ X3 ^ rk[r];			\
+	U = Y1 ^ Y2 ^ Y3 ^ rk[r];			\
+	SM4ED(X0, T, 0);				\
+	SM4ED(Y0, U, 0);				\
+	SM4ED(X0, T, 1);				\
+	SM4ED(Y0, U, 1);				\
+	SM4ED(X0, T, 2);				\
+	SM4ED(Y0, U, 2);				\
+	SM4ED(X0, T, 3);				\
+	SM4ED(Y0, U, 3)
+
+
+// the registers are XLEN wide, only the lower 32 bits are used
+static void sm4_riscv_encrypt(const SM4_KEY *key, const uint8_t in[16], uint8_t out[16])
+{
+	const uint32_t *rk = key->rk;
+	unsigned long X0, X1, X2, X3, T;
+	int i;
+
+	X0 = GETU32(in     );
+	X1 = GETU32(in +  4);
+	X2 = GETU32(in +  8);
+	X3 = GETU32(in + 12);
+
+	for (i = 0; i < 32; i += 4, rk += 4) {
+		ROUND(0, X0, X1, X2, X3);
+		ROUND(1, X1, X2, X3, X0);
+		ROUND(2, X2, X3, X0, X1);
+		ROUND(3, X3, X0, X1, X2);
+	}
+
+	PUTU32(out     , (uint32_t)X3);
+	PUTU32(out +  4, (uint32_t)X2);
+	PUTU32(out +  8, (uint32_t)X1);
+	PUTU32(out + 12, (uint32_t)X0);
+}
+
+static void sm4_riscv_encrypt2(const SM4_KEY *key, const uint8_t in[32], uint8_t out[32])
+{
+	const uint32_t *rk = key->rk;
+	unsigned long X0, X1, X2, X3, T;
+	unsigned long Y0, Y1, Y2, Y3, U;
+	int i;
+
+	X0 = GETU32(in     );
+	X1 = GETU32(in +  4);
+	X2 = GETU32(in +  8);
+	X3 = GETU32(in + 12);
+	Y0 = GETU32(in + 16);
+	Y1 = GETU32(in + 20);
+	Y2 = GETU32(in + 24);
+	Y3 = GETU32(in + 28);
+
+	for (i = 0; i < 32; i += 4, rk += 4) {
+		ROUND2(0, X0, X1, X2, X3, Y0, Y1, Y2, Y3);
+		ROUND2(1, X1, X2, X3, X0, Y1, Y2, Y3, Y0);
+		ROUND2(2, X2, X3, X0, X1, Y2, Y3, Y0, Y1);
+		ROUND2(3, X3, X0, X1, X2, Y3, Y0, Y1, Y2);
+	}
+
+	PUTU32(out     , (uint32_t)X3);
+	PUTU32(out +  4, (uint32_t)X2);
+	PUTU32(out +  8, (uint32_t)X1);
+	PUTU32(out + 12, (uint32_t)X0);
+	PUTU32(out + 16, (uint32_t)Y3);
+	PUTU32(out + 20, (uint32_t)Y2);
+	PUTU32(out + 24, (uint32_t)Y1);
+	PUTU32(out + 28, (uint32_t)Y0);
+}
+
+void sm4_riscv_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	while (nblocks >= 2) {
+		sm4_riscv_encrypt2(key, in, out);
+		in += 32;
+		out += 32;
+		nblocks -= 2;
+	}
+	if (nblocks) {
+		sm4_riscv_encrypt(key, in, out);
+	}
+}
+
+void sm4_riscv_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[32];
+	uint32_t c3 = GETU32(ctr + 12);
+	size_t i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 2 ? nblocks : 2;
+
+		memcpy(block, ctr, 12);
+		memcpy(block + 16, ctr, 12);
+		PUTU32(block + 12, c3);
+		c3++;
+		if (nb == 2) {
+			PUTU32(block + 28, c3);
+			c3++;
+			sm4_riscv_encrypt2(key, block, block);
+		} else {
+			sm4_riscv_encrypt(key, block, block);
+		}
+		for (i = 0; i < 16 * nb; i++) {
+			out[i] = in[i] ^ block[i];
+		}
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+	PUTU32(ctr + 12, c3);
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+// `in` might be `out`, the ciphertext blocks are saved before they are overwritten
+void sm4_riscv_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[32];
+	uint8_t next_iv[16];
+	size_t i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 2 ? nblocks : 2;
+
+		memcpy(next_iv, in + 16 * (nb - 1), 16);
+		if (nb == 2) {
+			sm4_riscv_encrypt2(key, in, block);
+			for (i = 16; i < 32; i++) {
+				out[i] = block[i] ^ in[i - 16];
+			}
+		} else {
+			sm4_riscv_encrypt(key, in, block);
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = block[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
@@ -15,6 +15,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
+#include <gmssl/endian.h>
 #include <gmssl/sm4_cbc_mac.h>
 #include <gmssl/sm4_rng.h>
 
@@ -111,6 +112,48 @@ static void be_incr(uint8_t a[16])
 	}
 }
 
+static void be_add(uint8_t a[16], size_t n)
+{
+	uint64_t carry = n;
+	int i;
+	for (i = 15; i >= 0 && carry; i--) {
+		carry += a[i];
+		a[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+// out = sm4(K, V + 1) || ... || sm4(K, V + nblocks) over the zeros of out, V = V + nblocks
+// the 32-bit counter of sm4_ctr32_encrypt_blocks is split at its wrap and carried into the upper 96 bits
+static void sm4_rng_ctr_blocks(const SM4_KEY *sm4_key, uint8_t V[16], uint8_t *out, size_t nblocks)
+{
+	uint8_t ctr[16];
+	uint64_t left;
+	size_t n;
+	int i;
+
+	memcpy(ctr, V, 16);
+	be_incr(ctr);
+	be_add(V, nblocks);
+
+	while (nblocks) {
+		left = 0x100000000 - (uint64_t)GETU32(ctr + 12);
+		n = (uint64_t)nblocks < left ? nblocks : (size_t)left;
+
+		sm4_ctr32_encrypt_blocks(sm4_key, ctr, out, n, out);
+		out += 16 * n;
+		nblocks -= n;
+
+		if ((uint64_t)n == left) {
+			for (i = 11; i >= 0; i--) {
+				ctr[i]++;
+				if (ctr[i]) break;
+			}
+		}
+	}
+	gmssl_secure_clear(ctr, sizeof(ctr));
+}
+
 
 int sm4_rng_update(SM4_RNG *rng, const uint8_t seed[32])
 {
@@ -136,8 +179,8 @@ int sm4_rng_init(SM4_RNG *rng, const uint8_t *nonce, size_t nonce_len,
 	uint8_t seed[32];
 
 	// get_entropy, 512-byte might be too long for some system RNGs
-	if (rand_bytes(entropy, 256) != 1
-		|| rand_bytes(entropy + 256, 256) != 1) {
+	if (rand_get_entropy(entropy, 256) != 1
+		|| rand_get_entropy(entropy + 256, 256) != 1) {
 		error_print();
 		return -1;
 	}
@@ -172,8 +215,8 @@ int sm4_rng_reseed(SM4_RNG *rng, const uint8_t *addin, size_t addin_len)
 	uint8_t seed[32];
 
 	// get_entropy, 512-byte might be too long for some system RNGs
-	if (rand_bytes(entropy, 256) != 1
-		|| rand_bytes(entropy + 256, 256) != 1) {
+	if (rand_get_entropy(entropy, 256) != 1
+		|| rand_get_entropy(entropy + 256, 256) != 1) {
 		error_print();
 		return -1;
 	}
@@ -202,9 +245,11 @@ int sm4_rng_generate(SM4_RNG *rng, const uint8_t *addin, size_t addin_len,
 	uint8_t *out, size_t outlen)
 {
 	uint8_t seed[32] = {0};
+	uint8_t block[16];
+	size_t nblocks;
 	SM4_KEY sm4_key;
 
-	if (!outlen || outlen > 16) {
+	if (!outlen || outlen > SM4_RNG_MAX_GENERATE_SIZE) {
 		error_print();
 		return -1;
 	}
@@ -232,17 +277,19 @@ int sm4_rng_generate(SM4_RNG *rng, const uint8_t *addin, size_t addin_len,
 		sm4_rng_update(rng, seed);
 	}
 
-	// V = (V + 1) mod 2^128
-	be_incr(rng->V);
-
-	// output sm4(K, V)[0:outlen]
+	// output sm4(K, V + 1) || sm4(K, V + 2) || ..., V = V + nblocks
+	// the full blocks are the CTR keystream written into `out` in place
 	sm4_set_encrypt_key(&sm4_key, rng->K);
-	if (outlen < 16) {
-		uint8_t buf[16];
-		sm4_encrypt(&sm4_key, rng->V, buf);
-		memcpy(out, buf, outlen);
-	} else {
-		sm4_encrypt(&sm4_key, rng->V, out);
+	nblocks = outlen / 16;
+	if (nblocks) {
+		memset(out, 0, nblocks * 16);
+		sm4_rng_ctr_blocks(&sm4_key, rng->V, out, nblocks);
+	}
+	if (outlen % 16) {
+		memset(block, 0, sizeof(block));
+		sm4_rng_ctr_blocks(&sm4_key, rng->V, block, 1);
+		memcpy(out + nblocks * 16, block, outlen % 16);
+		gmssl_secure_clear(block, sizeof(block));
 	}
 
 	// (K, V) = update(seed, (K, V))
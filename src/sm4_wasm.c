@@ -0,0 +1,197 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * SM4 in WebAssembly SIMD128, 4 blocks at a time
+ *
+ * The state is kept as 4 vectors X0..X3, lane j of Xi is word i of block j.
+ * The S-box is a vector permute: the 256-byte table is split into 16 slices
+ * of 16 bytes and every slice is looked up with i8x16.swizzle on the input
+ * minus 16 * slice. swizzle returns 0 for the indexes >= 16, so exactly one
+ * slice contributes to every byte and the lookups are constant-time. The
+ * rotations of L by multiples of 8 are byte shuffles.
+ */
+
+#include <string.h>
+#include <wasm_simd128.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+#include <gmssl/endian.h>
+
+
+// the S-box of sm4.c
+extern const uint8_t S[256];
+
+
+#define BSWAP32(x) \
+	wasm_i8x16_shuffle(x, x, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12)
+
+#define ROL8(x) \
+	wasm_i8x16_shuffle(x, x, 3, 0, 1, 2, 7, 4, 5, 6, 11, 8, 9, 10, 15, 12, 13, 14)
+#define ROL16(x) \
+	wasm_i8x16_shuffle(x, x, 2, 3, 0, 1, 6, 7, 4, 5, 10, 11, 8, 9, 14, 15, 12, 13)
+#define ROL24(x) \
+	wasm_i8x16_shuffle(x, x, 1, 2, 3, 0, 5, 6, 7, 4, 9, 10, 11, 8, 13, 14, 15, 12)
+#define ROTL(x, n) \
+	wasm_v128_or(wasm_i32x4_shl(x, n), wasm_u32x4_shr(x, 32 - (n)))
+
+// (b0, b1, b2, b3) = (x0, x1, x2, x3) with the words transposed
+#define TRANSPOSE(b0, b1, b2, b3, x0, x1, x2, x3) do {	\
+	v128_t t0 = wasm_i32x4_shuffle(x0, x1, 0, 4, 1, 5);	\
+	v128_t t1 = wasm_i32x4_shuffle(x2, x3, 0, 4, 1, 5);	\
+	v128_t t2 = wasm_i32x4_shuffle(x0, x1, 2, 6, 3, 7);	\
+	v128_t t3 = wasm_i32x4_shuffle(x2, x3, 2, 6, 3, 7);	\
+	b0 = wasm_i64x2_shuffle(t0, t1, 0, 2);			\
+	b1 = wasm_i64x2_shuffle(t0, t1, 1, 3);			\
+	b2 = wasm_i64x2_shuffle(t2, t3, 0, 2);			\
+	b3 = wasm_i64x2_shuffle(t2, t3, 1, 3);			\
+} while (0)
+
+
+static v128_t sm4_wasm_sbox(const v128_t sbox[16], v128_t x)
+{
+	const v128_t c16 = wasm_i8x16_splat(16);
+	v128_t y = wasm_i8x16_swizzle(sbox[0], x);
+	int i;
+
+	for (i = 1; i < 16; i++) {
+		x = wasm_i8x16_sub(x, c16);
+		y = wasm_v128_xor(y, wasm_i8x16_swizzle(sbox[i], x));
+	}
+	return y;
+}
+
+// L(B) = B ^ (B <<< 2) ^ (B <<< 10) ^ (B <<< 18) ^ (B <<< 24)
+static v128_t sm4_wasm_l(v128_t b)
+{
+	v128_t t = wasm_v128_xor(wasm_v128_xor(b, ROL8(b)), ROL16(b));
+	return wasm_v128_xor(wasm_v128_xor(b, ROL24(b)), ROTL(t, 2));
+}
+
+#define ROUND(r, X0, X1, X2, X3)						\
+	t = wasm_v128_xor(wasm_v128_xor(X1, X2), wasm_v128_xor(X3, wasm_i32x4_splat((int32_t)rk[r])));	\
+	X0 = wasm_v128_xor(X0, sm4_wasm_l(sm4_wasm_sbox(sbox, t)))
+
+static void sm4_wasm_encrypt4(const SM4_KEY *key, const uint8_t in[64], uint8_t out[64])
+{
+	const uint32_t *rk = key->rk;
+	v128_t sbox[16];
+	v128_t b0, b1, b2, b3;
+	v128_t x0, x1, x2, x3;
+	v128_t t;
+	int i;
+
+	for (i = 0; i < 16; i++) {
+		sbox[i] = wasm_v128_load(S + 16 * i);
+	}
+
+	b0 = BSWAP32(wasm_v128_load(in));
+	b1 = BSWAP32(wasm_v128_load(in + 16));
+	b2 = BSWAP32(wasm_v128_load(in + 32));
+	b3 = BSWAP32(wasm_v128_load(in + 48));
+	TRANSPOSE(x0, x1, x2, x3, b0, b1, b2, b3);
+
+	for (i = 0; i < 32; i += 4) {
+		ROUND(i,     x0, x1, x2, x3);
+		ROUND(i + 1, x1, x2, x3, x0);
+		ROUND(i + 2, x2, x3, x0, x1);
+		ROUND(i + 3, x3, x0, x1, x2);
+	}
+
+	// the output is (X35, X34, X33, X32)
+	TRANSPOSE(b0, b1, b2, b3, x3, x2, x1, x0);
+	wasm_v128_store(out, BSWAP32(b0));
+	wasm_v128_store(out + 16, BSWAP32(b1));
+	wasm_v128_store(out + 32, BSWAP32(b2));
+	wasm_v128_store(out + 48, BSWAP32(b3));
+}
+
+void sm4_wasm_encrypt_blocks(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[64];
+
+	while (nblocks >= 4) {
+		sm4_wasm_encrypt4(key, in, out);
+		in += 64;
+		out += 64;
+		nblocks -= 4;
+	}
+	if (nblocks) {
+		memset(block, 0, sizeof(block));
+		memcpy(block, in, 16 * nblocks);
+		sm4_wasm_encrypt4(key, block, block);
+		memcpy(out, block, 16 * nblocks);
+		gmssl_secure_clear(block, sizeof(block));
+	}
+}
+
+void sm4_wasm_ctr32_encrypt_blocks(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[64];
+	uint32_t c3 = GETU32(ctr + 12);
+	size_t i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 4 ? nblocks : 4;
+
+		for (i = 0; i < 4; i++) {
+			memcpy(block + 16 * i, ctr, 12);
+			PUTU32(block + 16 * i + 12, c3 + (uint32_t)i);
+		}
+		c3 += (uint32_t)nb;
+		sm4_wasm_encrypt4(key, block, block);
+		if (nb == 4) {
+			for (i = 0; i < 64; i += 16) {
+				wasm_v128_store(out + i, wasm_v128_xor(wasm_v128_load(in + i), wasm_v128_load(block + i)));
+			}
+		} else {
+			for (i = 0; i < 16 * nb; i++) {
+				out[i] = in[i] ^ block[i];
+			}
+		}
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+	PUTU32(ctr + 12, c3);
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+// `in` might be `out`, a block is written after the ciphertext it is chained with is read
+void sm4_wasm_cbc_decrypt_blocks(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t block[64];
+	uint8_t next_iv[16];
+	size_t i;
+
+	while (nblocks) {
+		size_t nb = nblocks < 4 ? nblocks : 4;
+
+		memcpy(next_iv, in + 16 * (nb - 1), 16);
+		if (nb == 4) {
+			sm4_wasm_encrypt4(key, in, block);
+		} else {
+			memset(block, 0, sizeof(block));
+			memcpy(block, in, 16 * nb);
+			sm4_wasm_encrypt4(key, block, block);
+		}
+		for (i = 16 * nb; i > 16; i--) {
+			out[i - 1] = block[i - 1] ^ in[i - 17];
+		}
+		for (i = 0; i < 16; i++) {
+			out[i] = block[i] ^ iv[i];
+		}
+		memcpy(iv, next_iv, 16);
+
+		in += 16 * nb;
+		out += 16 * nb;
+		nblocks -= nb;
+	}
+	gmssl_secure_clear(block, sizeof(block));
+}
@@ -8,10 +8,63 @@
  */
 
 
+#include <stdlib.h>
 #include <gmssl/sm4.h>
 #include <gmssl/mem.h>
-#include <gmssl/gf128.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
+
+
+// blocks whitened together and passed to one sm4_encrypt_blocks() call
+#define SM4_XTS_BATCH	32
+
+// T = T * x, same as gf128_mul_by_2() between gf128_from_bytes() and gf128_to_bytes(),
+// with T held as two big-endian words
+#define xts_tweak_double(hi, lo) do { \
+		uint64_t carry = (lo) & 1; \
+		(lo) = ((lo) >> 1) | ((hi) << 63); \
+		(hi) = ((hi) >> 1) ^ (((uint64_t)0 - carry) & ((uint64_t)0xe1 << 56)); \
+	} while (0)
+
+// nblocks full blocks under the tweaks T, T*x, ..., T is updated to the next tweak.
+// `key` decides the direction, `in` == `out` is allowed
+static void sm4_xts_blocks(const SM4_KEY *key, uint8_t T[16], const uint8_t *in, size_t nblocks, uint8_t *out)
+{
+	uint8_t tweaks[16 * SM4_XTS_BATCH];
+	uint64_t hi = GETU64(T);
+	uint64_t lo = GETU64(T + 8);
+	size_t n, i;
+
+	while (nblocks) {
+		n = nblocks < SM4_XTS_BATCH ? nblocks : SM4_XTS_BATCH;
+		for (i = 0; i < n; i++) {
+			PUTU64(tweaks + 16 * i, hi);
+			PUTU64(tweaks + 16 * i + 8, lo);
+			xts_tweak_double(hi, lo);
+		}
+		gmssl_memxor(out, in, tweaks, 16 * n);
+		sm4_encrypt_blocks(key, out, n, out);
+		gmssl_memxor(out, out, tweaks, 16 * n);
+
+		in += 16 * n;
+		out += 16 * n;
+		nblocks -= n;
+	}
+	PUTU64(T, hi);
+	PUTU64(T + 8, lo);
+	gmssl_secure_clear(tweaks, sizeof(tweaks));
+}
+
+static void xts_tweak_double_bytes(const uint8_t in[16], uint8_t out[16])
+{
+	uint64_t hi = GETU64(in);
+	uint64_t lo = GETU64(in + 8);
+
+	xts_tweak_double(hi, lo);
+	PUTU64(out, hi);
+	PUTU64(out + 8, lo);
+}
 
 
 int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
@@ -19,8 +72,7 @@ int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 {
 	uint8_t T[16];
 	uint8_t block[16];
-	size_t nblocks, i;
-	gf128_t a;
+	size_t nblocks;
 
 	if (inlen < 16) {
 		error_print();
@@ -31,19 +83,10 @@ int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 	memcpy(T, tweak, 16);
 	sm4_encrypt(key2, T, T);
 
-	for (i = 0; i < nblocks - 2; i++) {
-		gmssl_memxor(block, in, T, 16);
-		sm4_encrypt(key1, block, block);
-		gmssl_memxor(out, block, T, 16);
-
-		gf128_from_bytes(a, T);
-		gf128_mul_by_2(a, a);
-		gf128_to_bytes(a, T);
-
-		in += 16;
-		inlen -= 16;
-		out += 16;
-	}
+	sm4_xts_blocks(key1, T, in, nblocks - 2, out);
+	in += 16 * (nblocks - 2);
+	inlen -= 16 * (nblocks - 2);
+	out += 16 * (nblocks - 2);
 
 	if (inlen % 16 == 0) {
 		gmssl_memxor(block, in, T, 16);
@@ -55,9 +98,7 @@ int sm4_xts_encrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 		sm4_encrypt(key1, block, block);
 		gmssl_memxor(block, block, T, 16);
 
-		gf128_from_bytes(a, T);
-		gf128_mul_by_2(a, a);
-		gf128_to_bytes(a, T);
+		xts_tweak_double_bytes(T, T);
 
 		in += 16;
 		inlen -= 16;
@@ -78,8 +119,7 @@ int sm4_xts_decrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 {
 	uint8_t T[16];
 	uint8_t block[16];
-	size_t nblocks, i;
-	gf128_t a;
+	size_t nblocks;
 
 	if (inlen < 16) {
 		error_print();
@@ -90,19 +130,10 @@ int sm4_xts_decrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 	memcpy(T, tweak, 16);
 	sm4_encrypt(key2, T, T);
 
-	for (i = 0; i < nblocks - 2; i++) {
-		gmssl_memxor(block, in, T, 16);
-		sm4_encrypt(key1, block, block);
-		gmssl_memxor(out, block, T, 16);
-
-		gf128_from_bytes(a, T);
-		gf128_mul_by_2(a, a);
-		gf128_to_bytes(a, T);
-
-		in += 16;
-		inlen -= 16;
-		out += 16;
-	}
+	sm4_xts_blocks(key1, T, in, nblocks - 2, out);
+	in += 16 * (nblocks - 2);
+	inlen -= 16 * (nblocks - 2);
+	out += 16 * (nblocks - 2);
 
 	if (inlen % 16 == 0) {
 		gmssl_memxor(block, in, T, 16);
@@ -112,9 +143,7 @@ int sm4_xts_decrypt(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t twea
 	} else  {
 		uint8_t T1[16];
 
-		gf128_from_bytes(a, T);
-		gf128_mul_by_2(a, a);
-		gf128_to_bytes(a, T1);
+		xts_tweak_double_bytes(T, T1);
 
 		gmssl_memxor(block, in, T1, 16);
 		sm4_encrypt(key1, block, block);
@@ -143,6 +172,130 @@ static void tweak_incr(uint8_t a[16])
 	}
 }
 
+// a += n, as n calls of tweak_incr()
+static void tweak_add(uint8_t a[16], size_t n)
+{
+	uint64_t carry = n;
+	int i;
+
+	for (i = 0; i < 16 && carry; i++) {
+		carry += a[i];
+		a[i] = (uint8_t)carry;
+		carry >>= 8;
+	}
+}
+
+typedef struct {
+	const SM4_KEY *key1;
+	const SM4_KEY *key2;
+	uint8_t tweak[16];
+	size_t sector_size;
+	const uint8_t *in;
+	size_t nsectors;
+	uint8_t *out;
+} SM4_XTS_SECTORS_JOB;
+
+// the first tweaks of SM4_XTS_BATCH sectors are encrypted together
+static void sm4_xts_sectors(SM4_XTS_SECTORS_JOB *job)
+{
+	uint8_t T[16 * SM4_XTS_BATCH];
+	uint8_t tweak[16];
+	const uint8_t *in = job->in;
+	uint8_t *out = job->out;
+	size_t nsectors = job->nsectors;
+	size_t nblocks = job->sector_size / 16;
+	size_t n, i;
+
+	memcpy(tweak, job->tweak, 16);
+
+	while (nsectors) {
+		n = nsectors < SM4_XTS_BATCH ? nsectors : SM4_XTS_BATCH;
+		for (i = 0; i < n; i++) {
+			memcpy(T + 16 * i, tweak, 16);
+			tweak_incr(tweak);
+		}
+		sm4_encrypt_blocks(job->key2, T, n, T);
+		for (i = 0; i < n; i++) {
+			sm4_xts_blocks(job->key1, T + 16 * i, in, nblocks, out);
+			in += job->sector_size;
+			out += job->sector_size;
+		}
+		nsectors -= n;
+	}
+	gmssl_secure_clear(T, sizeof(T));
+}
+
+static void sm4_xts_sectors_task(void *arg)
+{
+	sm4_xts_sectors((SM4_XTS_SECTORS_JOB *)arg);
+}
+
+// every thread gets at least SM4_XTS_THREAD_MIN_SIZE bytes, below that a thread costs more than it saves
+#define SM4_XTS_THREAD_MIN_SIZE	(256 * 1024)
+
+static int sm4_xts_sectors_ex(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int threads)
+{
+	SM4_XTS_SECTORS_JOB jobs[SM4_XTS_MAX_THREADS];
+	size_t max_threads;
+	size_t first;
+	int i;
+
+	if (sector_size < SM4_BLOCK_SIZE || sector_size % SM4_BLOCK_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!nsectors) {
+		return 1;
+	}
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM4_XTS_MAX_THREADS) {
+		threads = SM4_XTS_MAX_THREADS;
+	}
+	max_threads = nsectors / (SM4_XTS_THREAD_MIN_SIZE / sector_size + 1);
+	if ((size_t)threads > max_threads) {
+		threads = max_threads ? (int)max_threads : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		first = nsectors * i / threads;
+		jobs[i].key1 = key1;
+		jobs[i].key2 = key2;
+		memcpy(jobs[i].tweak, tweak, 16);
+		tweak_add(jobs[i].tweak, first);
+		jobs[i].sector_size = sector_size;
+		jobs[i].in = in + sector_size * first;
+		jobs[i].nsectors = nsectors * (i + 1) / threads - first;
+		jobs[i].out = out + sector_size * first;
+	}
+	gmssl_thread_pool_run(sm4_xts_sectors_task, jobs, sizeof(jobs[0]), (size_t)threads);
+	return 1;
+}
+
+int sm4_xts_encrypt_sectors(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int threads)
+{
+	if (sm4_xts_sectors_ex(key1, key2, tweak, sector_size, in, nsectors, out, threads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm4_xts_decrypt_sectors(const SM4_KEY *key1, const SM4_KEY *key2, const uint8_t tweak[16],
+	size_t sector_size, const uint8_t *in, size_t nsectors, uint8_t *out, int threads)
+{
+	// key1 is a decryption key, the rest is the same as encryption without ciphertext stealing
+	if (sm4_xts_sectors_ex(key1, key2, tweak, sector_size, in, nsectors, out, threads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int sm4_xts_encrypt_init(SM4_XTS_CTX *ctx, const uint8_t key[32], const uint8_t iv[16], size_t data_unit_size)
 {
 	if (data_unit_size < SM4_BLOCK_SIZE) {
@@ -190,6 +343,21 @@ int sm4_xts_encrypt_update(SM4_XTS_CTX *ctx,
 		out += DATA_UNIT_SIZE;
 		*outlen += DATA_UNIT_SIZE;
 	}
+	// whole data units of whole blocks are done together
+	if (DATA_UNIT_SIZE % SM4_BLOCK_SIZE == 0 && inlen >= DATA_UNIT_SIZE) {
+		size_t nsectors = inlen / DATA_UNIT_SIZE;
+
+		if (sm4_xts_encrypt_sectors(&ctx->key1, &ctx->key2, ctx->tweak,
+			DATA_UNIT_SIZE, in, nsectors, out, 1) != 1) {
+			error_print();
+			return -1;
+		}
+		tweak_add(ctx->tweak, nsectors);
+		in += DATA_UNIT_SIZE * nsectors;
+		inlen -= DATA_UNIT_SIZE * nsectors;
+		out += DATA_UNIT_SIZE * nsectors;
+		*outlen += DATA_UNIT_SIZE * nsectors;
+	}
 	while (inlen >= DATA_UNIT_SIZE) {
 		if (sm4_xts_encrypt(&ctx->key1, &ctx->key2, ctx->tweak, in, DATA_UNIT_SIZE, out) != 1) {
 			error_print();
@@ -275,6 +443,21 @@ int sm4_xts_decrypt_update(SM4_XTS_CTX *ctx,
 		out += DATA_UNIT_SIZE;
 		*outlen += DATA_UNIT_SIZE;
 	}
+	// whole data units of whole blocks are done together
+	if (DATA_UNIT_SIZE % SM4_BLOCK_SIZE == 0 && inlen >= DATA_UNIT_SIZE) {
+		size_t nsectors = inlen / DATA_UNIT_SIZE;
+
+		if (sm4_xts_decrypt_sectors(&ctx->key1, &ctx->key2, ctx->tweak,
+			DATA_UNIT_SIZE, in, nsectors, out, 1) != 1) {
+			error_print();
+			return -1;
+		}
+		tweak_add(ctx->tweak, nsectors);
+		in += DATA_UNIT_SIZE * nsectors;
+		inlen -= DATA_UNIT_SIZE * nsectors;
+		out += DATA_UNIT_SIZE * nsectors;
+		*outlen += DATA_UNIT_SIZE * nsectors;
+	}
 	while (inlen >= DATA_UNIT_SIZE) {
 		if (sm4_xts_decrypt(&ctx->key1, &ctx->key2, ctx->tweak, in, DATA_UNIT_SIZE, out) != 1) {
 			error_print();
@@ -21,6 +21,36 @@
 
 int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 	size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
+{
+	SM9_ID_PUBLIC pub;
+
+	if (!mpk || !id || !kbuf || !C) {
+		error_print();
+		return -1;
+	}
+
+	// A1: Q = H1(ID||hid,N) * P1 + Ppube
+	if (mpk->id_cache
+		&& memcmp(&mpk->id_cache_Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) == 0) {
+		if (sm9_enc_id_cache_get(mpk->id_cache, mpk, id, idlen, &pub) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (sm9_enc_id_public_init(&pub, mpk, id, idlen, 0) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (sm9_kem_encrypt_id_public(mpk, &pub, id, idlen, klen, kbuf, C) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm9_kem_encrypt_id_public(const SM9_ENC_MASTER_KEY *mpk, const SM9_ID_PUBLIC *pub,
+	const char *id, size_t idlen, size_t klen, uint8_t *kbuf, SM9_Z256_POINT *C)
 {
 	sm9_z256_t r;
 	sm9_z256_fp12_t w;
@@ -28,10 +58,15 @@ int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 	uint8_t cbuf[65];
 	SM3_KDF_CTX kdf_ctx;
 
-	// A1: Q = H1(ID||hid,N) * P1 + Ppube
-	sm9_z256_hash1(r, id, idlen, SM9_HID_ENC);
-	sm9_z256_point_mul(C, r, sm9_z256_generator());
-	sm9_z256_point_add(C, C, &mpk->Ppube);
+	if (!mpk || !pub || !id || !kbuf || !C) {
+		error_print();
+		return -1;
+	}
+	if (pub->hid != SM9_HID_ENC
+		|| memcmp(&pub->Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) != 0) {
+		error_print();
+		return -1;
+	}
 
 	do {
 		// A2: rand r in [1, N-1]
@@ -41,14 +76,21 @@ int sm9_kem_encrypt(const SM9_ENC_MASTER_KEY *mpk, const char *id, size_t idlen,
 		}
 
 		// A3: C1 = r * Q
-		sm9_z256_point_mul(C, r, C);
+		if (pub->pre_computed) {
+			sm9_z256_point_mul_ex(C, r, pub->Qe_table);
+		} else {
+			sm9_z256_point_mul(C, r, &pub->Qe);
+		}
 		sm9_z256_point_to_uncompressed_octets(C, cbuf);
 
 		// A4: g = e(Ppube, P2)
-		sm9_z256_pairing(w, sm9_z256_twist_generator(), &mpk->Ppube);
-
 		// A5: w = g^r
-		sm9_z256_fp12_pow(w, w, r);
+		if (memcmp(&mpk->g_Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) == 0) {
+			sm9_z256_fp12_cyclotomic_pow_comb(w, mpk->g_table, r);
+		} else {
+			sm9_z256_pairing(w, sm9_z256_twist_generator(), &mpk->Ppube);
+			sm9_z256_fp12_cyclotomic_pow(w, w, r);
+		}
 		sm9_z256_fp12_to_bytes(w, wbuf);
 
 		// A6: K = KDF(C || w || ID_B, klen), if K == 0, goto A2
@@ -81,7 +123,11 @@ int sm9_kem_decrypt(const SM9_ENC_KEY *key, const char *id, size_t idlen, const
 	sm9_z256_point_to_uncompressed_octets(C, cbuf);
 
 	// B2: w = e(C, de);
-	sm9_z256_pairing(w, &key->de, C);
+	if (memcmp(&key->prepared_de, &key->de, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		sm9_z256_pairing_prepared(w, &key->de_lines, C);
+	} else {
+		sm9_z256_pairing(w, &key->de, C);
+	}
 	sm9_z256_fp12_to_bytes(w, wbuf);
 
 	// B3: K = KDF(C || w || ID, klen)
@@ -74,10 +74,18 @@ int sm9_exch_step_1B(const SM9_EXCH_MASTER_KEY *mpk, const char *idA, size_t idA
 			error_print();
 			return -1;
 		}
-		sm9_z256_pairing(G1, &key->de, RA);
-		sm9_z256_pairing(G2, sm9_z256_twist_generator(), &mpk->Ppube);
-		sm9_z256_fp12_pow(G2, G2, rB);
-		sm9_z256_fp12_pow(G3, G1, rB);
+		if (memcmp(&key->prepared_de, &key->de, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+			sm9_z256_pairing_prepared(G1, &key->de_lines, RA);
+		} else {
+			sm9_z256_pairing(G1, &key->de, RA);
+		}
+		if (memcmp(&mpk->g_Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) == 0) {
+			sm9_z256_fp12_cyclotomic_pow_comb(G2, mpk->g_table, rB);
+		} else {
+			sm9_z256_pairing(G2, sm9_z256_twist_generator(), &mpk->Ppube);
+			sm9_z256_fp12_cyclotomic_pow(G2, G2, rB);
+		}
+		sm9_z256_fp12_cyclotomic_pow(G3, G1, rB);
 
 		sm9_z256_point_to_uncompressed_octets(RA, ta);
 		sm9_z256_point_to_uncompressed_octets(RB, tb);
@@ -130,10 +138,18 @@ int sm9_exch_step_2A(const SM9_EXCH_MASTER_KEY *mpk, const char *idA, size_t idA
 			error_print();
 			return -1;
 		}
-		sm9_z256_pairing(G1, sm9_z256_twist_generator(), &mpk->Ppube);
-		sm9_z256_fp12_pow(G1, G1, rA);
-		sm9_z256_pairing(G2, &key->de, RB);
-		sm9_z256_fp12_pow(G3, G2, rA);
+		if (memcmp(&mpk->g_Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) == 0) {
+			sm9_z256_fp12_cyclotomic_pow_comb(G1, mpk->g_table, rA);
+		} else {
+			sm9_z256_pairing(G1, sm9_z256_twist_generator(), &mpk->Ppube);
+			sm9_z256_fp12_cyclotomic_pow(G1, G1, rA);
+		}
+		if (memcmp(&key->prepared_de, &key->de, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+			sm9_z256_pairing_prepared(G2, &key->de_lines, RB);
+		} else {
+			sm9_z256_pairing(G2, &key->de, RB);
+		}
+		sm9_z256_fp12_cyclotomic_pow(G3, G2, rA);
 
 		sm9_z256_point_to_uncompressed_octets(RA, ta);
 		sm9_z256_point_to_uncompressed_octets(RB, tb);
@@ -0,0 +1,419 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm9.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+int sm9_sign_id_public_init(SM9_ID_PUBLIC *pub, const SM9_SIGN_MASTER_KEY *mpk,
+	const char *id, size_t idlen, int pre_compute)
+{
+	sm9_z256_t h1;
+	SM9_Z256_TWIST_POINT Q;
+
+	if (!pub || !mpk || !id) {
+		error_print();
+		return -1;
+	}
+
+	// Qs = H1(ID || hid, N) * P2 + Ppubs
+	sm9_z256_hash1(h1, id, idlen, SM9_HID_SIGN);
+	sm9_z256_twist_point_mul_generator(&Q, h1);
+	sm9_z256_twist_point_add_full(&Q, &Q, &mpk->Ppubs);
+	if (sm9_z256_twist_point_is_at_infinity(&Q)) {
+		error_print();
+		return -1;
+	}
+
+	memset(pub, 0, sizeof(*pub));
+	pub->hid = SM9_HID_SIGN;
+	pub->Ppubs = mpk->Ppubs;
+	sm9_z256_twist_point_get_xy(&Q, pub->Qs.X, pub->Qs.Y);
+	sm9_z256_fp2_set_one(pub->Qs.Z);
+	if (pre_compute) {
+		sm9_z256_twist_point_prepare(&pub->Qs_lines, &pub->Qs);
+		pub->pre_computed = 1;
+	}
+	return 1;
+}
+
+int sm9_enc_id_public_init(SM9_ID_PUBLIC *pub, const SM9_ENC_MASTER_KEY *mpk,
+	const char *id, size_t idlen, int pre_compute)
+{
+	sm9_z256_t h1;
+	SM9_Z256_POINT Q;
+	SM9_Z256_AFFINE_POINT A;
+
+	if (!pub || !mpk || !id) {
+		error_print();
+		return -1;
+	}
+
+	// Qe = H1(ID || hid, N) * P1 + Ppube
+	sm9_z256_hash1(h1, id, idlen, SM9_HID_ENC);
+	sm9_z256_point_mul_generator(&Q, h1);
+	sm9_z256_point_add(&Q, &Q, &mpk->Ppube);
+	if (sm9_z256_point_is_at_infinity(&Q)) {
+		error_print();
+		return -1;
+	}
+
+	memset(pub, 0, sizeof(*pub));
+	pub->hid = SM9_HID_ENC;
+	pub->Ppube = mpk->Ppube;
+	sm9_z256_point_get_xy(&Q, A.X, A.Y);
+	sm9_z256_modp_to_mont(A.X, A.X);
+	sm9_z256_modp_to_mont(A.Y, A.Y);
+	sm9_z256_point_copy_affine(&pub->Qe, &A);
+	if (pre_compute) {
+		sm9_z256_point_mul_pre_compute(&pub->Qe, pub->Qe_table);
+		pub->pre_computed = 1;
+	}
+	return 1;
+}
+
+
+#define NIL	((size_t)-1)
+
+typedef struct {
+	char id[SM9_ID_CACHE_MAX_ID_SIZE];
+	size_t idlen;
+	SM9_ID_PUBLIC pub;
+	size_t hash_next;
+	size_t lru_prev;
+	size_t lru_next; // also links the free list
+} ID_ENTRY;
+
+// see tls_session_cache.c
+typedef struct {
+	cache_mutex_t mutex;
+	ID_ENTRY *entries;
+	size_t capacity;
+	size_t count;
+	size_t *buckets;
+	size_t buckets_mask;
+	size_t lru_head;
+	size_t lru_tail;
+	size_t free_head;
+} ID_SHARD;
+
+struct SM9_ID_CACHE_st {
+	ID_SHARD shards[SM9_ID_CACHE_SHARDS];
+	int pre_compute;
+};
+
+// FNV-1a over hid || ID
+static uint32_t id_hash(uint8_t hid, const char *id, size_t idlen)
+{
+	uint32_t h = 2166136261U;
+
+	h ^= hid;
+	h *= 16777619U;
+	while (idlen--) {
+		h ^= (uint8_t)*id++;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+static ID_SHARD *id_cache_shard(SM9_ID_CACHE *cache, uint32_t hash)
+{
+	return &cache->shards[hash % SM9_ID_CACHE_SHARDS];
+}
+
+static size_t *shard_bucket(ID_SHARD *shard, uint32_t hash)
+{
+	return &shard->buckets[(hash / SM9_ID_CACHE_SHARDS) & shard->buckets_mask];
+}
+
+static size_t shard_find(ID_SHARD *shard, uint32_t hash, uint8_t hid, const char *id, size_t idlen)
+{
+	size_t i = *shard_bucket(shard, hash);
+
+	while (i != NIL) {
+		const ID_ENTRY *e = &shard->entries[i];
+		if (e->pub.hid == hid && e->idlen == idlen && memcmp(e->id, id, idlen) == 0) {
+			return i;
+		}
+		i = e->hash_next;
+	}
+	return NIL;
+}
+
+static void shard_lru_unlink(ID_SHARD *shard, size_t i)
+{
+	ID_ENTRY *e = &shard->entries[i];
+
+	if (e->lru_prev != NIL) shard->entries[e->lru_prev].lru_next = e->lru_next;
+	else shard->lru_head = e->lru_next;
+	if (e->lru_next != NIL) shard->entries[e->lru_next].lru_prev = e->lru_prev;
+	else shard->lru_tail = e->lru_prev;
+}
+
+static void shard_lru_push_front(ID_SHARD *shard, size_t i)
+{
+	ID_ENTRY *e = &shard->entries[i];
+
+	e->lru_prev = NIL;
+	e->lru_next = shard->lru_head;
+	if (shard->lru_head != NIL) shard->entries[shard->lru_head].lru_prev = i;
+	else shard->lru_tail = i;
+	shard->lru_head = i;
+}
+
+static void shard_remove(ID_SHARD *shard, size_t i)
+{
+	ID_ENTRY *e = &shard->entries[i];
+	uint32_t hash = id_hash(e->pub.hid, e->id, e->idlen);
+	size_t *link = shard_bucket(shard, hash);
+
+	while (*link != i) {
+		link = &shard->entries[*link].hash_next;
+	}
+	*link = e->hash_next;
+	shard_lru_unlink(shard, i);
+
+	e->lru_next = shard->free_head;
+	shard->free_head = i;
+	shard->count--;
+}
+
+static void shard_insert(ID_SHARD *shard, uint32_t hash, const char *id, size_t idlen, const SM9_ID_PUBLIC *pub)
+{
+	size_t *bucket;
+	size_t i;
+
+	if ((i = shard_find(shard, hash, pub->hid, id, idlen)) != NIL) {
+		shard->entries[i].pub = *pub;
+		shard_lru_unlink(shard, i);
+		shard_lru_push_front(shard, i);
+		return;
+	}
+	if (shard->free_head == NIL) {
+		shard_remove(shard, shard->lru_tail);
+	}
+	i = shard->free_head;
+	shard->free_head = shard->entries[i].lru_next;
+
+	memcpy(shard->entries[i].id, id, idlen);
+	shard->entries[i].idlen = idlen;
+	shard->entries[i].pub = *pub;
+	bucket = shard_bucket(shard, hash);
+	shard->entries[i].hash_next = *bucket;
+	*bucket = i;
+	shard_lru_push_front(shard, i);
+	shard->count++;
+}
+
+SM9_ID_CACHE *sm9_id_cache_new(size_t max_entries, int pre_compute)
+{
+	SM9_ID_CACHE *cache;
+	size_t capacity;
+	size_t nbuckets;
+	size_t i, j;
+
+	if (!max_entries) {
+		error_print();
+		return NULL;
+	}
+	if (!(cache = (SM9_ID_CACHE *)calloc(1, sizeof(*cache)))) {
+		error_print();
+		return NULL;
+	}
+	cache->pre_compute = pre_compute;
+
+	capacity = (max_entries + SM9_ID_CACHE_SHARDS - 1) / SM9_ID_CACHE_SHARDS;
+	nbuckets = 1;
+	while (nbuckets < capacity) {
+		nbuckets <<= 1;
+	}
+
+	for (i = 0; i < SM9_ID_CACHE_SHARDS; i++) {
+		ID_SHARD *shard = &cache->shards[i];
+
+		if (!(shard->entries = (ID_ENTRY *)calloc(capacity, sizeof(ID_ENTRY)))
+			|| !(shard->buckets = (size_t *)malloc(nbuckets * sizeof(size_t)))) {
+			free(shard->entries);
+			while (i--) {
+				cache_mutex_destroy(&cache->shards[i].mutex);
+				free(cache->shards[i].entries);
+				free(cache->shards[i].buckets);
+			}
+			free(cache);
+			error_print();
+			return NULL;
+		}
+		shard->capacity = capacity;
+		shard->buckets_mask = nbuckets - 1;
+		for (j = 0; j < nbuckets; j++) {
+			shard->buckets[j] = NIL;
+		}
+		for (j = 0; j < capacity; j++) {
+			shard->entries[j].lru_next = j + 1 < capacity ? j + 1 : NIL;
+		}
+		shard->free_head = 0;
+		shard->lru_head = shard->lru_tail = NIL;
+		cache_mutex_init(&shard->mutex);
+	}
+	return cache;
+}
+
+void sm9_id_cache_free(SM9_ID_CACHE *cache)
+{
+	size_t i;
+
+	if (!cache) {
+		return;
+	}
+	for (i = 0; i < SM9_ID_CACHE_SHARDS; i++) {
+		ID_SHARD *shard = &cache->shards[i];
+
+		cache_mutex_destroy(&shard->mutex);
+		free(shard->entries);
+		free(shard->buckets);
+	}
+	free(cache);
+}
+
+// copy out the entry of (hid, ID), the caller checks the master public key
+static int id_cache_lookup(SM9_ID_CACHE *cache, uint8_t hid, const char *id, size_t idlen,
+	SM9_ID_PUBLIC *pub)
+{
+	ID_SHARD *shard;
+	uint32_t hash;
+	size_t i;
+
+	if (idlen > SM9_ID_CACHE_MAX_ID_SIZE) {
+		return 0;
+	}
+	hash = id_hash(hid, id, idlen);
+	shard = id_cache_shard(cache, hash);
+
+	cache_mutex_lock(&shard->mutex);
+	if ((i = shard_find(shard, hash, hid, id, idlen)) != NIL) {
+		*pub = shard->entries[i].pub;
+		shard_lru_unlink(shard, i);
+		shard_lru_push_front(shard, i);
+		cache_mutex_unlock(&shard->mutex);
+		return 1;
+	}
+	cache_mutex_unlock(&shard->mutex);
+	return 0;
+}
+
+static void id_cache_add(SM9_ID_CACHE *cache, const char *id, size_t idlen, const SM9_ID_PUBLIC *pub)
+{
+	ID_SHARD *shard;
+	uint32_t hash;
+
+	if (idlen > SM9_ID_CACHE_MAX_ID_SIZE) {
+		return;
+	}
+	hash = id_hash(pub->hid, id, idlen);
+	shard = id_cache_shard(cache, hash);
+
+	cache_mutex_lock(&shard->mutex);
+	shard_insert(shard, hash, id, idlen, pub);
+	cache_mutex_unlock(&shard->mutex);
+}
+
+int sm9_sign_id_cache_get(SM9_ID_CACHE *cache, const SM9_SIGN_MASTER_KEY *mpk,
+	const char *id, size_t idlen, SM9_ID_PUBLIC *pub)
+{
+	if (!cache || !mpk || !id || !pub) {
+		error_print();
+		return -1;
+	}
+	if (id_cache_lookup(cache, SM9_HID_SIGN, id, idlen, pub) == 1
+		&& memcmp(&pub->Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		return 1;
+	}
+	// computed without the lock, a concurrent miss of the same ID adds the same object
+	if (sm9_sign_id_public_init(pub, mpk, id, idlen, cache->pre_compute) != 1) {
+		error_print();
+		return -1;
+	}
+	id_cache_add(cache, id, idlen, pub);
+	return 1;
+}
+
+int sm9_enc_id_cache_get(SM9_ID_CACHE *cache, const SM9_ENC_MASTER_KEY *mpk,
+	const char *id, size_t idlen, SM9_ID_PUBLIC *pub)
+{
+	if (!cache || !mpk || !id || !pub) {
+		error_print();
+		return -1;
+	}
+	if (id_cache_lookup(cache, SM9_HID_ENC, id, idlen, pub) == 1
+		&& memcmp(&pub->Ppube, &mpk->Ppube, sizeof(SM9_Z256_POINT)) == 0) {
+		return 1;
+	}
+	if (sm9_enc_id_public_init(pub, mpk, id, idlen, cache->pre_compute) != 1) {
+		error_print();
+		return -1;
+	}
+	id_cache_add(cache, id, idlen, pub);
+	return 1;
+}
+
+size_t sm9_id_cache_count(SM9_ID_CACHE *cache)
+{
+	size_t count = 0;
+	size_t i;
+
+	for (i = 0; i < SM9_ID_CACHE_SHARDS; i++) {
+		cache_mutex_lock(&cache->shards[i].mutex);
+		count += cache->shards[i].count;
+		cache_mutex_unlock(&cache->shards[i].mutex);
+	}
+	return count;
+}
+
+int sm9_sign_master_key_set_id_cache(SM9_SIGN_MASTER_KEY *mpk, SM9_ID_CACHE *cache)
+{
+	if (!mpk) {
+		error_print();
+		return -1;
+	}
+	mpk->id_cache = cache;
+	mpk->id_cache_Ppubs = mpk->Ppubs;
+	return 1;
+}
+
+int sm9_enc_master_key_set_id_cache(SM9_ENC_MASTER_KEY *mpk, SM9_ID_CACHE *cache)
+{
+	if (!mpk) {
+		error_print();
+		return -1;
+	}
+	mpk->id_cache = cache;
+	mpk->id_cache_Ppube = mpk->Ppube;
+	return 1;
+}
@@ -20,6 +20,7 @@
 #include <gmssl/asn1.h>
 #include <gmssl/pkcs8.h>
 #include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
 
 
 // generate h1 in [1, n-1]
@@ -99,7 +100,8 @@ int sm9_sign_master_key_from_der(SM9_SIGN_MASTER_KEY *msk, const uint8_t **in, s
 		error_print();
 		return -1;
 	}
-	if (sm9_z256_twist_point_from_uncompressed_octets(&msk->Ppubs, Ppubs) != 1) {
+	if (sm9_z256_twist_point_from_uncompressed_octets(&msk->Ppubs, Ppubs) != 1
+		|| sm9_sign_master_key_pre_compute(msk) != 1) {
 		error_print();
 		return -1;
 	}
@@ -140,7 +142,8 @@ int sm9_sign_master_public_key_from_der(SM9_SIGN_MASTER_KEY *mpk, const uint8_t
 		return -1;
 	}
 	memset(mpk, 0, sizeof(*mpk));
-	if (sm9_z256_twist_point_from_uncompressed_octets(&mpk->Ppubs, Ppubs) != 1) {
+	if (sm9_z256_twist_point_from_uncompressed_octets(&mpk->Ppubs, Ppubs) != 1
+		|| sm9_sign_master_key_pre_compute(mpk) != 1) {
 		error_print();
 		return -1;
 	}
@@ -193,7 +196,8 @@ int sm9_sign_key_from_der(SM9_SIGN_KEY *key, const uint8_t **in, size_t *inlen)
 	}
 	memset(key, 0, sizeof(*key));
 	if (sm9_z256_point_from_uncompressed_octets(&key->ds, ds) != 1
-		|| sm9_z256_twist_point_from_uncompressed_octets(&key->Ppubs, Ppubs) != 1) {
+		|| sm9_z256_twist_point_from_uncompressed_octets(&key->Ppubs, Ppubs) != 1
+		|| sm9_sign_key_pre_compute(key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -251,7 +255,8 @@ int sm9_enc_master_key_from_der(SM9_ENC_MASTER_KEY *msk, const uint8_t **in, siz
 		error_print();
 		return -1;
 	}
-	if (sm9_z256_point_from_uncompressed_octets(&msk->Ppube, Ppube) != 1) {
+	if (sm9_z256_point_from_uncompressed_octets(&msk->Ppube, Ppube) != 1
+		|| sm9_enc_master_key_pre_compute(msk) != 1) {
 		error_print();
 		return -1;
 	}
@@ -293,7 +298,8 @@ int sm9_enc_master_public_key_from_der(SM9_ENC_MASTER_KEY *mpk, const uint8_t **
 		return -1;
 	}
 	memset(mpk, 0, sizeof(*mpk));
-	if (sm9_z256_point_from_uncompressed_octets(&mpk->Ppube, Ppube) != 1) {
+	if (sm9_z256_point_from_uncompressed_octets(&mpk->Ppube, Ppube) != 1
+		|| sm9_enc_master_key_pre_compute(mpk) != 1) {
 		error_print();
 		return -1;
 	}
@@ -346,19 +352,77 @@ int sm9_enc_key_from_der(SM9_ENC_KEY *key, const uint8_t **in, size_t *inlen)
 	}
 	memset(key, 0, sizeof(*key));
 	if (sm9_z256_twist_point_from_uncompressed_octets(&key->de, de) != 1
-		|| sm9_z256_point_from_uncompressed_octets(&key->Ppube, Ppube) != 1) {
+		|| sm9_z256_point_from_uncompressed_octets(&key->Ppube, Ppube) != 1
+		|| sm9_enc_key_pre_compute(key) != 1) {
 		error_print();
 		return -1;
 	}
 	return 1;
 }
 
+int sm9_sign_master_key_pre_compute(SM9_SIGN_MASTER_KEY *mpk)
+{
+	sm9_z256_fp12_t g;
+
+	if (!mpk) {
+		error_print();
+		return -1;
+	}
+	// g = e(P1, Ppubs)
+	sm9_z256_pairing(g, &mpk->Ppubs, sm9_z256_generator());
+	sm9_z256_fp12_pow_comb_pre_compute(mpk->g_table, g);
+	mpk->g_Ppubs = mpk->Ppubs;
+	return 1;
+}
+
+int sm9_sign_key_pre_compute(SM9_SIGN_KEY *key)
+{
+	sm9_z256_fp12_t g;
+
+	if (!key) {
+		error_print();
+		return -1;
+	}
+	sm9_z256_pairing(g, &key->Ppubs, sm9_z256_generator());
+	sm9_z256_fp12_pow_comb_pre_compute(key->g_table, g);
+	key->g_Ppubs = key->Ppubs;
+	return 1;
+}
+
+int sm9_enc_master_key_pre_compute(SM9_ENC_MASTER_KEY *mpk)
+{
+	sm9_z256_fp12_t g;
+
+	if (!mpk) {
+		error_print();
+		return -1;
+	}
+	// g = e(Ppube, P2)
+	sm9_z256_pairing(g, sm9_z256_twist_generator(), &mpk->Ppube);
+	sm9_z256_fp12_pow_comb_pre_compute(mpk->g_table, g);
+	mpk->g_Ppube = mpk->Ppube;
+	return 1;
+}
+
+int sm9_enc_key_pre_compute(SM9_ENC_KEY *key)
+{
+	if (!key) {
+		error_print();
+		return -1;
+	}
+	sm9_z256_twist_point_prepare(&key->de_lines, &key->de);
+	key->prepared_de = key->de;
+	return 1;
+}
+
 int sm9_sign_master_key_generate(SM9_SIGN_MASTER_KEY *msk)
 {
 	if (!msk) {
 		error_print();
 		return -1;
 	}
+	memset(msk, 0, sizeof(*msk));
+
 	// k = rand(1, n-1)
 	if (sm9_z256_rand_range(msk->ks, sm9_z256_order()) != 1) {
 		error_print();
@@ -366,11 +430,21 @@ int sm9_sign_master_key_generate(SM9_SIGN_MASTER_KEY *msk)
 	}
 	// Ppubs = k * P2 in E'(F_p^2)
 	sm9_z256_twist_point_mul_generator(&msk->Ppubs, msk->ks);
+	if (sm9_sign_master_key_pre_compute(msk) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
 int sm9_enc_master_key_generate(SM9_ENC_MASTER_KEY *msk)
 {
+	if (!msk) {
+		error_print();
+		return -1;
+	}
+	memset(msk, 0, sizeof(*msk));
+
 	// k = rand(1, n-1)
 	if (sm9_z256_rand_range(msk->ke, sm9_z256_order()) != 1) {
 		error_print();
@@ -378,6 +452,10 @@ int sm9_enc_master_key_generate(SM9_ENC_MASTER_KEY *msk)
 	}
 	// Ppube = ke * P1 in E(F_p)
 	sm9_z256_point_mul_generator(&msk->Ppube, msk->ke);
+	if (sm9_enc_master_key_pre_compute(msk) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
@@ -402,6 +480,14 @@ int sm9_sign_master_key_extract_key(SM9_SIGN_MASTER_KEY *msk, const char *id, si
 	sm9_z256_point_mul_generator(&key->ds, t);
 	key->Ppubs = msk->Ppubs;
 
+	if (memcmp(&msk->g_Ppubs, &msk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		memcpy(key->g_table, msk->g_table, sizeof(key->g_table));
+		key->g_Ppubs = key->Ppubs;
+	} else if (sm9_sign_key_pre_compute(key) != 1) {
+		error_print();
+		return -1;
+	}
+
 	return 1;
 }
 
@@ -426,6 +512,199 @@ int sm9_enc_master_key_extract_key(SM9_ENC_MASTER_KEY *msk, const char *id, size
 	sm9_z256_twist_point_mul_generator(&key->de, t);
 	key->Ppube = msk->Ppube;
 
+	if (sm9_enc_key_pre_compute(key) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+typedef struct {
+	const SM9_SIGN_MASTER_KEY *sign_msk;
+	SM9_SIGN_KEY *sign_keys;
+	const SM9_ENC_MASTER_KEY *enc_msk;
+	SM9_ENC_KEY *enc_keys;
+	const char *const *ids;
+	const size_t *idlens;
+	size_t first;
+	size_t last;
+	int ret;
+} SM9_EXTRACT_JOB;
+
+// t2[i] = s * (H1(ID_i || hid, N) + s)^-1 with one inversion for all the n <= SM9_EXTRACT_BATCH_SIZE ids
+static int sm9_extract_scalars(const sm9_z256_t s, uint8_t hid,
+	const char *const *ids, const size_t *idlens, size_t n, sm9_z256_t *t2)
+{
+	sm9_z256_t prod[SM9_EXTRACT_BATCH_SIZE];
+	sm9_z256_t inv, t;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		sm9_z256_hash1(t2[i], ids[i], idlens[i], hid);
+		sm9_z256_modn_add(t2[i], t2[i], s);
+		if (sm9_z256_is_zero(t2[i])) {
+			error_print();
+			return -1;
+		}
+		if (i == 0) {
+			sm9_z256_copy(prod[0], t2[0]);
+		} else {
+			sm9_z256_modn_mul(prod[i], prod[i - 1], t2[i]);
+		}
+	}
+
+	// inv = (t1[0] * ... * t1[i])^-1, t1[i]^-1 = inv * prod[i - 1]
+	sm9_z256_modn_inv(inv, prod[n - 1]);
+	for (i = n - 1; i > 0; i--) {
+		sm9_z256_modn_mul(t, inv, prod[i - 1]);
+		sm9_z256_modn_mul(inv, inv, t2[i]);
+		sm9_z256_modn_mul(t2[i], t, s);
+	}
+	sm9_z256_modn_mul(t2[0], inv, s);
+
+	gmssl_secure_clear(prod, sizeof(prod));
+	gmssl_secure_clear(inv, sizeof(inv));
+	gmssl_secure_clear(t, sizeof(t));
+	return 1;
+}
+
+static void sm9_extract(SM9_EXTRACT_JOB *job)
+{
+	sm9_z256_t t2[SM9_EXTRACT_BATCH_SIZE];
+	size_t first, n, i;
+
+	for (first = job->first; first < job->last; first += n) {
+		n = job->last - first < SM9_EXTRACT_BATCH_SIZE ? job->last - first : SM9_EXTRACT_BATCH_SIZE;
+
+		if (job->sign_msk) {
+			const SM9_SIGN_MASTER_KEY *msk = job->sign_msk;
+			SM9_SIGN_KEY *key = job->sign_keys + first;
+
+			if (sm9_extract_scalars(msk->ks, SM9_HID_SIGN, job->ids + first, job->idlens + first, n, t2) != 1) {
+				error_print();
+				job->ret = -1;
+				break;
+			}
+			for (i = 0; i < n; i++) {
+				// ds = t2 * P1
+				sm9_z256_point_mul_generator(&key[i].ds, t2[i]);
+				key[i].Ppubs = msk->Ppubs;
+				memcpy(key[i].g_table, msk->g_table, sizeof(key[i].g_table));
+				key[i].g_Ppubs = key[i].Ppubs;
+			}
+		} else {
+			const SM9_ENC_MASTER_KEY *msk = job->enc_msk;
+			SM9_ENC_KEY *key = job->enc_keys + first;
+
+			if (sm9_extract_scalars(msk->ke, SM9_HID_ENC, job->ids + first, job->idlens + first, n, t2) != 1) {
+				error_print();
+				job->ret = -1;
+				break;
+			}
+			for (i = 0; i < n; i++) {
+				// de = t2 * P2
+				sm9_z256_twist_point_mul_generator(&key[i].de, t2[i]);
+				key[i].Ppube = msk->Ppube;
+				sm9_enc_key_pre_compute(&key[i]);
+			}
+		}
+	}
+	gmssl_secure_clear(t2, sizeof(t2));
+}
+
+static void sm9_extract_task(void *arg)
+{
+	sm9_extract((SM9_EXTRACT_JOB *)arg);
+}
+
+// every thread gets at least one full batch
+static int sm9_extract_run(const SM9_EXTRACT_JOB *job, size_t num, int threads)
+{
+	SM9_EXTRACT_JOB jobs[SM9_EXTRACT_MAX_THREADS];
+	int ret = 1;
+	int i;
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > SM9_EXTRACT_MAX_THREADS) {
+		threads = SM9_EXTRACT_MAX_THREADS;
+	}
+	if ((size_t)threads > num / SM9_EXTRACT_BATCH_SIZE) {
+		threads = num / SM9_EXTRACT_BATCH_SIZE ? (int)(num / SM9_EXTRACT_BATCH_SIZE) : 1;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i] = *job;
+		jobs[i].first = (num * i) / threads;
+		jobs[i].last = (num * (i + 1)) / threads;
+		jobs[i].ret = 1;
+	}
+	gmssl_thread_pool_run(sm9_extract_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+int sm9_sign_master_key_extract_keys(SM9_SIGN_MASTER_KEY *msk,
+	const char *const *ids, const size_t *idlens, size_t num, SM9_SIGN_KEY *keys, int threads)
+{
+	SM9_EXTRACT_JOB job;
+
+	if (!msk || !ids || !idlens || !keys) {
+		error_print();
+		return -1;
+	}
+	if (!num) {
+		return 1;
+	}
+	// the keys copy the comb table of g = e(P1, Ppubs)
+	if (memcmp(&msk->g_Ppubs, &msk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) != 0
+		&& sm9_sign_master_key_pre_compute(msk) != 1) {
+		error_print();
+		return -1;
+	}
+
+	memset(&job, 0, sizeof(job));
+	job.sign_msk = msk;
+	job.sign_keys = keys;
+	job.ids = ids;
+	job.idlens = idlens;
+
+	if (sm9_extract_run(&job, num, threads) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int sm9_enc_master_key_extract_keys(SM9_ENC_MASTER_KEY *msk,
+	const char *const *ids, const size_t *idlens, size_t num, SM9_ENC_KEY *keys, int threads)
+{
+	SM9_EXTRACT_JOB job;
+
+	if (!msk || !ids || !idlens || !keys) {
+		error_print();
+		return -1;
+	}
+	if (!num) {
+		return 1;
+	}
+
+	memset(&job, 0, sizeof(job));
+	job.enc_msk = msk;
+	job.enc_keys = keys;
+	job.ids = ids;
+	job.idlens = idlens;
+
+	if (sm9_extract_run(&job, num, threads) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
@@ -661,6 +940,7 @@ static int sm9_private_key_info_decrypt_from_der(int *alg, int *params, uint8_t
 	const uint8_t *iv;
 	size_t ivlen;
 	uint8_t key[16];
+	uint8_t *keyp = key;
 	SM4_KEY sm4_key;
 	const uint8_t *enced_pkey_info;
 	size_t enced_pkey_info_len;
@@ -679,7 +959,7 @@ static int sm9_private_key_info_decrypt_from_der(int *alg, int *params, uint8_t
 		error_print();
 		return -1;
 	}
-	if (sm3_pbkdf2(pass, strlen(pass), salt, saltlen, iter, sizeof(key), key) != 1) {
+	if (pkcs8_derive_keys(&pass, &salt, &saltlen, &iter, 1, sizeof(key), &keyp) != 1) {
 		error_print();
 		goto end;
 	}
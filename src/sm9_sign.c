@@ -109,15 +109,19 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 {
 	sm9_z256_t r;
 	sm9_z256_fp12_t g;
+	sm9_z256_fp12_t w;
 	uint8_t wbuf[32 * 12];
 	SM3_CTX ctx = *sm3_ctx;
 	SM3_CTX tmp_ctx;
 	uint8_t ct1[4] = {0,0,0,1};
 	uint8_t ct2[4] = {0,0,0,2};
 	uint8_t Ha[64];
+	int cached = memcmp(&key->g_Ppubs, &key->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0;
 
 	// A1: g = e(P1, Ppubs)
-	sm9_z256_pairing(g, &key->Ppubs, sm9_z256_generator());
+	if (!cached) {
+		sm9_z256_pairing(g, &key->Ppubs, sm9_z256_generator());
+	}
 
 	do {
 		// A2: rand r in [1, N-1]
@@ -130,8 +134,12 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 		//sm9_z256_from_hex(r, "00033C8616B06704813203DFD00965022ED15975C662337AED648835DC4B1CBE");
 
 		// A3: w = g^r
-		sm9_z256_fp12_pow(g, g, r);
-		sm9_z256_fp12_to_bytes(g, wbuf);
+		if (cached) {
+			sm9_z256_fp12_cyclotomic_pow_comb(w, key->g_table, r);
+		} else {
+			sm9_z256_fp12_cyclotomic_pow(w, g, r);
+		}
+		sm9_z256_fp12_to_bytes(w, wbuf);
 
 		// A4: h = H2(M || w, N)
 		sm3_update(&ctx, wbuf, sizeof(wbuf));
@@ -151,7 +159,7 @@ int sm9_do_sign(const SM9_SIGN_KEY *key, const SM3_CTX *sm3_ctx, SM9_SIGNATURE *
 	sm9_z256_point_mul(&sig->S, r, &key->ds);
 
 	gmssl_secure_clear(&r, sizeof(r));
-	gmssl_secure_clear(&g, sizeof(g));
+	gmssl_secure_clear(&w, sizeof(w));
 	gmssl_secure_clear(wbuf, sizeof(wbuf));
 	gmssl_secure_clear(&tmp_ctx, sizeof(tmp_ctx));
 	gmssl_secure_clear(Ha, sizeof(Ha));
@@ -195,13 +203,39 @@ int sm9_verify_finish(SM9_SIGN_CTX *ctx, const uint8_t *sig, size_t siglen,
 int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
 	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
 {
-	sm9_z256_t h1;
+	SM9_ID_PUBLIC pub;
+	int ret;
+
+	if (!mpk || !id || !sm3_ctx || !sig) {
+		error_print();
+		return -1;
+	}
+
+	// B5: h1 = H1(ID || hid, N)
+	// B6: P = h1 * P2 + Ppubs
+	if (mpk->id_cache
+		&& memcmp(&mpk->id_cache_Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		if (sm9_sign_id_cache_get(mpk->id_cache, mpk, id, idlen, &pub) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (sm9_sign_id_public_init(&pub, mpk, id, idlen, 0) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if ((ret = sm9_do_verify_id_public(mpk, &pub, sm3_ctx, sig)) < 0) {
+		error_print();
+		return -1;
+	}
+	return ret;
+}
+
+// h2 = H2(M || w, N), return 1 if h2 == h
+static int sm9_verify_h2_equ(const SM3_CTX *sm3_ctx, const sm9_z256_fp12_t w, const sm9_z256_t h)
+{
 	sm9_z256_t h2;
-	sm9_z256_fp12_t g;
-	sm9_z256_fp12_t t;
-	sm9_z256_fp12_t u;
-	sm9_z256_fp12_t w;
-	SM9_Z256_TWIST_POINT P;
 	uint8_t wbuf[32 * 12];
 	SM3_CTX ctx = *sm3_ctx;
 	SM3_CTX tmp_ctx;
@@ -209,41 +243,242 @@ int sm9_do_verify(const SM9_SIGN_MASTER_KEY *mpk, const char *id, size_t idlen,
 	uint8_t ct2[4] = {0,0,0,2};
 	uint8_t Ha[64];
 
+	sm9_z256_fp12_to_bytes(w, wbuf);
+	sm3_update(&ctx, wbuf, sizeof(wbuf));
+	tmp_ctx = ctx;
+	sm3_update(&ctx, ct1, sizeof(ct1));
+	sm3_finish(&ctx, Ha);
+	sm3_update(&tmp_ctx, ct2, sizeof(ct2));
+	sm3_finish(&tmp_ctx, Ha + 32);
+	sm9_z256_modn_from_hash(h2, Ha);
+	if (sm9_z256_equ(h2, h) != 1) {
+		return 0;
+	}
+	return 1;
+}
+
+int sm9_do_verify_id_public(const SM9_SIGN_MASTER_KEY *mpk, const SM9_ID_PUBLIC *pub,
+	const SM3_CTX *sm3_ctx, const SM9_SIGNATURE *sig)
+{
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t u;
+	sm9_z256_fp12_t w;
+	SM9_Z256_TWIST_POINT Q[2];
+	SM9_Z256_POINT S[2];
+
+	if (!mpk || !pub || !sm3_ctx || !sig) {
+		error_print();
+		return -1;
+	}
+	if (pub->hid != SM9_HID_SIGN
+		|| memcmp(&pub->Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) != 0) {
+		error_print();
+		return -1;
+	}
+
 	// B1: check h in [1, N-1]
 
 	// B2: check S in G1
 
-	// B3: g = e(P1, Ppubs)
-	sm9_z256_pairing(g, &mpk->Ppubs, sm9_z256_generator());
+	// B5, B6: P = Qs of the identity
+	Q[0] = pub->Qs;
+	S[0] = sig->S;
 
+	// B3: g = e(P1, Ppubs)
 	// B4: t = g^h
-	sm9_z256_fp12_pow(t, g, sig->h);
+	// B7: u = e(S, P)
+	// B8: w = u * t
+	if (memcmp(&mpk->g_Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		sm9_z256_fp12_cyclotomic_pow_comb(t, mpk->g_table, sig->h);
+		if (pub->pre_computed) {
+			sm9_z256_pairing_prepared(u, &pub->Qs_lines, &S[0]);
+		} else {
+			sm9_z256_pairing(u, &Q[0], &S[0]);
+		}
+		sm9_z256_fp12_mul(w, u, t);
+	} else {
+		// w = e(S, P) * e(h * P1, Ppubs)
+		Q[1] = mpk->Ppubs;
+		sm9_z256_point_mul_generator(&S[1], sig->h);
+		sm9_z256_pairing_multi(w, Q, S, 2);
+	}
 
-	// B5: h1 = H1(ID || hid, N)
-	sm9_z256_hash1(h1, id, idlen, SM9_HID_SIGN);
+	// B9: h2 = H2(M || w, N), check h2 == h
+	return sm9_verify_h2_equ(sm3_ctx, w, sig->h);
+}
 
-	// B6: P = h1 * P2 + Ppubs
-	sm9_z256_twist_point_mul_generator(&P, h1);
-	sm9_z256_twist_point_add_full(&P, &P, &mpk->Ppubs);
+typedef struct {
+	const char *id;
+	size_t idlen;
+	size_t count;
+	SM9_ID_PUBLIC *pub; // with the Miller loop lines, for an identity of more than one signature
+} SM9_VERIFY_BATCH_ID;
 
-	// B7: u = e(S, P)
-	sm9_z256_pairing(u, &P, &sig->S);
+static size_t sm9_verify_batch_hash(const char *id, size_t idlen, size_t mask)
+{
+	uint32_t h = 2166136261U;
 
-	// B8: w = u * t
-	sm9_z256_fp12_mul(w, u, t);
-	sm9_z256_fp12_to_bytes(w, wbuf);
+	while (idlen--) {
+		h ^= (uint8_t)*id++;
+		h *= 16777619U;
+	}
+	return h & mask;
+}
 
-	// B9: h2 = H2(M || w, N), check h2 == h
-	sm3_update(&ctx, wbuf, sizeof(wbuf));
-	tmp_ctx = ctx;
-	sm3_update(&ctx, ct1, sizeof(ct1));
-	sm3_finish(&ctx, Ha);
-	sm3_update(&tmp_ctx, ct2, sizeof(ct2));
-	sm3_finish(&tmp_ctx, Ha + 32);
-	sm9_z256_modn_from_hash(h2, Ha);
-	if (sm9_z256_equ(h2, sig->h) != 1) {
-		return 0;
+/*
+ * The check of a signature is h == H2(M || w, N) with w = e(S, Qs) * g^h, every
+ * w is hashed, so the pairings of a batch can not be merged into one product.
+ * What is shared is the work around them: Qs is computed once per identity and
+ * prepared when the identity signs more than once, g or its comb table once
+ * per batch, and the inversions of the final exponentiations of every
+ * SM9_Z256_FINAL_EXPONENT_BATCH signatures.
+ */
+int sm9_do_verify_batch(const SM9_SIGN_MASTER_KEY *mpk, const char *const *ids, const size_t *idlens,
+	const SM3_CTX *sm3_ctxs, const SM9_SIGNATURE *sigs, size_t count, int *results)
+{
+	SM9_VERIFY_BATCH_ID *idents = NULL;
+	size_t idents_num = 0;
+	size_t *item_idents = NULL;
+	size_t *slots = NULL;
+	size_t mask = 0;
+	sm9_z256_fp12_t g_table_buf[SM9_Z256_FP12_COMB_TABLE_SIZE];
+	const sm9_z256_fp12_t *g_table;
+	sm9_z256_fp12_t f[SM9_Z256_FINAL_EXPONENT_BATCH];
+	sm9_z256_fp12_t t;
+	SM9_ID_PUBLIC pub;
+	int use_cache;
+	size_t i, j, m, h;
+	int ret = 1;
+
+	if (!mpk || !ids || !idlens || !sm3_ctxs || !sigs) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
 	}
 
-	return 1;
+	// B3: g = e(P1, Ppubs)
+	if (memcmp(&mpk->g_Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0) {
+		g_table = (const sm9_z256_fp12_t *)mpk->g_table;
+	} else {
+		sm9_z256_pairing(t, &mpk->Ppubs, sm9_z256_generator());
+		sm9_z256_fp12_pow_comb_pre_compute(g_table_buf, t);
+		g_table = (const sm9_z256_fp12_t *)g_table_buf;
+	}
+
+	// B5, B6: the identities, from the cache of the master key if it has one
+	use_cache = mpk->id_cache
+		&& memcmp(&mpk->id_cache_Ppubs, &mpk->Ppubs, sizeof(SM9_Z256_TWIST_POINT)) == 0;
+	if (!use_cache) {
+		// open addressing, slots keep `index + 1` into idents
+		for (mask = 16; mask < 2 * count; mask <<= 1) {
+		}
+		if (!(slots = (size_t *)calloc(mask, sizeof(size_t)))
+			|| !(idents = (SM9_VERIFY_BATCH_ID *)calloc(count, sizeof(SM9_VERIFY_BATCH_ID)))
+			|| !(item_idents = (size_t *)malloc(count * sizeof(size_t)))) {
+			error_print();
+			ret = -1;
+			goto end;
+		}
+		mask--;
+		for (i = 0; i < count; i++) {
+			if (!ids[i]) {
+				error_print();
+				ret = -1;
+				goto end;
+			}
+			for (h = sm9_verify_batch_hash(ids[i], idlens[i], mask); slots[h]; h = (h + 1) & mask) {
+				const SM9_VERIFY_BATCH_ID *ident = &idents[slots[h] - 1];
+				if (ident->idlen == idlens[i] && memcmp(ident->id, ids[i], idlens[i]) == 0) {
+					break;
+				}
+			}
+			if (!slots[h]) {
+				idents[idents_num].id = ids[i];
+				idents[idents_num].idlen = idlens[i];
+				slots[h] = ++idents_num;
+			}
+			item_idents[i] = slots[h] - 1;
+			idents[item_idents[i]].count++;
+		}
+	}
+
+	for (i = 0; i < count; i += m) {
+		m = count - i < SM9_Z256_FINAL_EXPONENT_BATCH ? count - i : SM9_Z256_FINAL_EXPONENT_BATCH;
+
+		// B7: the Miller loops of u = e(S, Qs)
+		for (j = 0; j < m; j++) {
+			const SM9_ID_PUBLIC *p = &pub;
+			size_t k = i + j;
+
+			if (use_cache) {
+				if (sm9_sign_id_cache_get(mpk->id_cache, mpk, ids[k], idlens[k], &pub) != 1) {
+					error_print();
+					ret = -1;
+					goto end;
+				}
+			} else {
+				SM9_VERIFY_BATCH_ID *ident = &idents[item_idents[k]];
+
+				if (ident->count > 1 && !ident->pub) {
+					if (!(ident->pub = (SM9_ID_PUBLIC *)malloc(sizeof(SM9_ID_PUBLIC)))) {
+						error_print();
+						ret = -1;
+						goto end;
+					}
+					if (sm9_sign_id_public_init(ident->pub, mpk, ids[k], idlens[k], 1) != 1) {
+						error_print();
+						ret = -1;
+						goto end;
+					}
+				}
+				if (ident->pub) {
+					p = ident->pub;
+				} else if (sm9_sign_id_public_init(&pub, mpk, ids[k], idlens[k], 0) != 1) {
+					error_print();
+					ret = -1;
+					goto end;
+				}
+			}
+
+			if (p->pre_computed) {
+				sm9_z256_miller_loop_prepared(f[j], &p->Qs_lines, &sigs[k].S);
+			} else {
+				sm9_z256_miller_loop(f[j], &p->Qs, &sigs[k].S);
+			}
+		}
+		sm9_z256_final_exponent_batch(f, (const sm9_z256_fp12_t *)f, m);
+
+		for (j = 0; j < m; j++) {
+			size_t k = i + j;
+			int ok;
+
+			// B4: t = g^h, B8: w = u * t, B9: h2 = H2(M || w, N), check h2 == h
+			sm9_z256_fp12_cyclotomic_pow_comb(t, g_table, sigs[k].h);
+			sm9_z256_fp12_mul(f[j], f[j], t);
+			ok = sm9_verify_h2_equ(&sm3_ctxs[k], f[j], sigs[k].h);
+
+			if (results) {
+				results[k] = ok ? 1 : -1;
+			}
+			if (!ok) {
+				ret = 0;
+			}
+		}
+	}
+
+end:
+	if (idents) {
+		for (i = 0; i < idents_num; i++) {
+			if (idents[i].pub) {
+				gmssl_secure_clear(idents[i].pub, sizeof(SM9_ID_PUBLIC));
+				free(idents[i].pub);
+			}
+		}
+		free(idents);
+	}
+	if (item_idents) free(item_idents);
+	if (slots) free(slots);
+	return ret;
 }
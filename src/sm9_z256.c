@@ -16,8 +16,11 @@
 #include <gmssl/hex.h>
 #include <gmssl/mem.h>
 #include <gmssl/sm9_z256.h>
+#include <gmssl/safegcd.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#include <gmssl/cpu.h>
+#include <gmssl/numa.h>
 #include <gmssl/rand.h>
 
 
@@ -46,6 +49,10 @@ const sm9_z256_t SM9_Z256_N = {
 	0xe56ee19cd69ecf25, 0x49f2934b18ea8bee, 0xd603ab4ff58ec744, 0xb640000002a3a6f1
 };
 
+const uint64_t *sm9_z256_prime(void) {
+	return &SM9_Z256_P[0];
+}
+
 const uint64_t *sm9_z256_order(void) {
 	return &SM9_Z256_N[0];
 }
@@ -414,7 +421,7 @@ int sm9_z256_print(FILE *fp, int ind, int fmt, const char *label, const sm9_z256
 }
 
 
-#ifndef ENABLE_SM9_ARM64
+#if !defined(ENABLE_SM9_ARM64) && !defined(ENABLE_SM9_AMD64)
 void sm9_z256_modp_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b)
 {
 	uint64_t c;
@@ -489,6 +496,19 @@ const uint64_t SM9_Z256_P_PRIME[4] = {
 
 #if defined(ENABLE_SM9_ARM64)
 	// src/sm9_z256_armv8.S
+#elif defined(ENABLE_SM9_AMD64)
+// src/sm9_z256_amd64.S
+void sm9_z256_modp_mont_mul_mulq(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
+void sm9_z256_modp_mont_mul_mulx(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b);
+
+void sm9_z256_modp_mont_mul(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b)
+{
+	if ((gmssl_cpu_features() & (GMSSL_CPU_BMI2|GMSSL_CPU_ADX)) == (GMSSL_CPU_BMI2|GMSSL_CPU_ADX)) {
+		sm9_z256_modp_mont_mul_mulx(r, a, b);
+	} else {
+		sm9_z256_modp_mont_mul_mulq(r, a, b);
+	}
+}
 #elif defined(ENABLE_SM9_Z256_NEON)
 #include <arm_neon.h>
 
@@ -724,11 +744,28 @@ void sm9_z256_modp_mont_pow(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t e
 	sm9_z256_copy(r, t);
 }
 
-void sm9_z256_modp_mont_inv(sm9_z256_t r, const sm9_z256_t a)
+void sm9_z256_modp_mont_inv_exp(sm9_z256_t r, const sm9_z256_t a)
 {
 	sm9_z256_modp_mont_pow(r, a, SM9_Z256_P_MINUS_TWO);
 }
 
+#if defined(__SIZEOF_INT128__)
+// 2^768 (mod p), mont(a^-1 * R^-1, R^3) = a^-1 * R
+static const sm9_z256_t SM9_Z256_MODP_2e768 = {
+	0x130257769df5827e, 0x36920fc0837ec76e, 0xcbec24519c22a142, 0x219be84a7c687090,
+};
+#endif
+
+void sm9_z256_modp_mont_inv(sm9_z256_t r, const sm9_z256_t a)
+{
+#if defined(__SIZEOF_INT128__)
+	safegcd_z256_inv(r, a, SM9_Z256_P);
+	sm9_z256_modp_mont_mul(r, r, SM9_Z256_MODP_2e768);
+#else
+	sm9_z256_modp_mont_inv_exp(r, a);
+#endif
+}
+
 static const sm9_z256_fp2_t SM9_Z256_FP2_MONT_5U = {{0,0,0,0},{0xb9f2c1e8c8c71995, 0x125df8f246a377fc, 0x25e650d049188d1c, 0x43fffffed866f63}};
 
 
@@ -1614,6 +1651,159 @@ void sm9_z256_fp12_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z25
 	sm9_z256_fp12_copy(r, t);
 }
 
+void sm9_z256_fp12_pow_comb_pre_compute(sm9_z256_fp12_t T[16], const sm9_z256_fp12_t g)
+{
+	int i, j;
+
+	sm9_z256_fp12_set_one(T[0]);
+	sm9_z256_fp12_copy(T[1], g);
+
+	// T[2^j] = g^(2^(64*j))
+	for (i = 2; i < 16; i <<= 1) {
+		sm9_z256_fp12_copy(T[i], T[i >> 1]);
+		for (j = 0; j < 64; j++) {
+			sm9_z256_fp12_sqr(T[i], T[i]);
+		}
+	}
+	for (i = 3; i < 16; i++) {
+		if (i & (i - 1)) {
+			sm9_z256_fp12_mul(T[i], T[i & (i - 1)], T[i & -i]);
+		}
+	}
+}
+
+// r = T[w] without a secret-dependent branch or memory access: every entry is read and masked
+static void sm9_z256_fp12_table_select(sm9_z256_fp12_t r, const sm9_z256_fp12_t T[16], unsigned int w)
+{
+	uint64_t *out = &r[0][0][0][0];
+	const uint64_t *in;
+	uint64_t mask;
+	unsigned int i, j;
+
+	for (j = 0; j < 48; j++) {
+		out[j] = 0;
+	}
+	for (i = 0; i < 16; i++) {
+		mask = 0 - ((((uint64_t)(i ^ w)) - 1) >> 63);
+		in = &T[i][0][0][0][0];
+		for (j = 0; j < 48; j++) {
+			out[j] |= in[j] & mask;
+		}
+	}
+}
+
+// 64 squarings and 64 multiplications, vs 256 and 128 for fp12_pow
+void sm9_z256_fp12_pow_comb(sm9_z256_fp12_t r, const sm9_z256_fp12_t T[16], const sm9_z256_t k)
+{
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t s;
+	unsigned int w;
+	int i;
+
+	sm9_z256_fp12_set_one(t);
+
+	for (i = 63; i >= 0; i--) {
+		sm9_z256_fp12_sqr(t, t);
+		w = (unsigned int)((k[0] >> i) & 1)
+			| (unsigned int)((k[1] >> i) & 1) << 1
+			| (unsigned int)((k[2] >> i) & 1) << 2
+			| (unsigned int)((k[3] >> i) & 1) << 3;
+		sm9_z256_fp12_table_select(s, T, w);
+		sm9_z256_fp12_mul(t, t, s);
+	}
+	sm9_z256_fp12_copy(r, t);
+}
+
+/*
+ * Granger-Scott squaring in the cyclotomic subgroup G_{Phi_12(p)}, where
+ * a^(p^6) = a^-1. With a = a0 + a1*w + a2*w^2, w^3 = v and conj() the p^2
+ * Frobenius of Fp4:
+ *
+ *	a^2 = (3*a0^2 - 2*conj(a0)) + (3*a2^2*v + 2*conj(a1))*w + (3*a1^2 - 2*conj(a2))*w^2
+ *
+ * 3 fp4_sqr instead of the 2 fp4_sqr and 2 fp4_mul of fp12_sqr. Only valid for
+ * pairing values and the results of the easy part of the final exponentiation.
+ */
+void sm9_z256_fp12_cyclotomic_sqr(sm9_z256_fp12_t r, const sm9_z256_fp12_t a)
+{
+	sm9_z256_fp4_t r0, r1, r2, t;
+
+	sm9_z256_fp4_sqr(r0, a[0]);
+	sm9_z256_fp4_conjugate(t, a[0]);
+	sm9_z256_fp4_sub(t, r0, t);
+	sm9_z256_fp4_dbl(t, t);
+	sm9_z256_fp4_add(r0, r0, t);
+
+	sm9_z256_fp4_sqr(r1, a[2]);
+	sm9_z256_fp4_a_mul_v(r1, r1);
+	sm9_z256_fp4_conjugate(t, a[1]);
+	sm9_z256_fp4_add(t, r1, t);
+	sm9_z256_fp4_dbl(t, t);
+	sm9_z256_fp4_add(r1, r1, t);
+
+	sm9_z256_fp4_sqr(r2, a[1]);
+	sm9_z256_fp4_conjugate(t, a[2]);
+	sm9_z256_fp4_sub(t, r2, t);
+	sm9_z256_fp4_dbl(t, t);
+	sm9_z256_fp4_add(r2, r2, t);
+
+	sm9_z256_fp4_copy(r[0], r0);
+	sm9_z256_fp4_copy(r[1], r1);
+	sm9_z256_fp4_copy(r[2], r2);
+}
+
+// a^k for a in the cyclotomic subgroup, fixed 4-bit windows: 256 squarings and 64 multiplications
+void sm9_z256_fp12_cyclotomic_pow(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm9_z256_t k)
+{
+	sm9_z256_fp12_t T[16];
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t s;
+	unsigned int w;
+	int i;
+
+	assert(sm9_z256_cmp(k, SM9_Z256_N_MINUS_ONE) < 0);
+
+	sm9_z256_fp12_set_one(T[0]);
+	sm9_z256_fp12_copy(T[1], a);
+	for (i = 2; i < 16; i++) {
+		sm9_z256_fp12_mul(T[i], T[i - 1], a);
+	}
+
+	sm9_z256_fp12_set_one(t);
+	for (i = 63; i >= 0; i--) {
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		w = (unsigned int)(k[i / 16] >> ((i % 16) * 4)) & 0xf;
+		sm9_z256_fp12_table_select(s, (const sm9_z256_fp12_t *)T, w);
+		sm9_z256_fp12_mul(t, t, s);
+	}
+	sm9_z256_fp12_copy(r, t);
+}
+
+// sm9_z256_fp12_pow_comb with a table of a pairing value
+void sm9_z256_fp12_cyclotomic_pow_comb(sm9_z256_fp12_t r, const sm9_z256_fp12_t T[16], const sm9_z256_t k)
+{
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t s;
+	unsigned int w;
+	int i;
+
+	sm9_z256_fp12_set_one(t);
+
+	for (i = 63; i >= 0; i--) {
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		w = (unsigned int)((k[0] >> i) & 1)
+			| (unsigned int)((k[1] >> i) & 1) << 1
+			| (unsigned int)((k[2] >> i) & 1) << 2
+			| (unsigned int)((k[3] >> i) & 1) << 3;
+		sm9_z256_fp12_table_select(s, T, w);
+		sm9_z256_fp12_mul(t, t, s);
+	}
+	sm9_z256_fp12_copy(r, t);
+}
+
 void sm9_z256_fp2_conjugate(sm9_z256_fp2_t r, const sm9_z256_fp2_t a)
 {
 	sm9_z256_copy(r[0], a[0]);
@@ -1996,14 +2186,8 @@ void sm9_z256_point_dbl_x5(SM9_Z256_POINT *R, const SM9_Z256_POINT *A)
 	sm9_z256_point_dbl(R, R);
 }
 
-void sm9_z256_point_mul(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_POINT *P)
+void sm9_z256_point_mul_pre_compute(const SM9_Z256_POINT *P, SM9_Z256_POINT T[16])
 {
-	uint64_t window_size = 5;
-	SM9_Z256_POINT T[16];
-	int R_infinity = 1;
-	int n = (int)((256 + window_size - 1)/window_size);
-	int i;
-
 	// T[i] = (i + 1) * P
 	T[0] = *P;
 
@@ -2022,7 +2206,14 @@ void sm9_z256_point_mul(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_PO
 	sm9_z256_point_add(&T[11-1], &T[6-1], &T[5-1]);
 	sm9_z256_point_add(&T[13-1], &T[7-1], &T[6-1]);
 	sm9_z256_point_add(&T[15-1], &T[8-1], &T[7-1]);
+}
 
+void sm9_z256_point_mul_ex(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_POINT T[16])
+{
+	uint64_t window_size = 5;
+	int R_infinity = 1;
+	int n = (int)((256 + window_size - 1)/window_size);
+	int i;
 
 	for (i = n - 1; i >= 0; i--) {
 		int booth = sm9_z256_get_booth(k, window_size, i);
@@ -2048,6 +2239,14 @@ void sm9_z256_point_mul(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_PO
 	}
 }
 
+void sm9_z256_point_mul(SM9_Z256_POINT *R, const sm9_z256_t k, const SM9_Z256_POINT *P)
+{
+	SM9_Z256_POINT T[16];
+
+	sm9_z256_point_mul_pre_compute(P, T);
+	sm9_z256_point_mul_ex(R, k, T);
+}
+
 void sm9_z256_point_copy_affine(SM9_Z256_POINT *R, const SM9_Z256_AFFINE_POINT *P)
 {
 	sm9_z256_copy(R->X, P->X);
@@ -2105,10 +2304,12 @@ void sm9_z256_point_sub_affine(SM9_Z256_POINT *R, const SM9_Z256_POINT *P, const
 }
 
 extern const uint64_t sm9_z256_pre_comp[37][64 * 4 * 2];
-static SM9_Z256_AFFINE_POINT (*g_pre_comp)[64] = (SM9_Z256_AFFINE_POINT (*)[64])sm9_z256_pre_comp;
+static GMSSL_NUMA_REPLICA g_pre_comp_replica;
 
 void sm9_z256_point_mul_generator(SM9_Z256_POINT *R, const sm9_z256_t k)
 {
+	const SM9_Z256_AFFINE_POINT (*g_pre_comp)[64] = (const SM9_Z256_AFFINE_POINT (*)[64])
+		gmssl_numa_replica(&g_pre_comp_replica, sm9_z256_pre_comp, sizeof(sm9_z256_pre_comp));
 	size_t window_size = 7;
 	int R_infinity = 1;
 	int n = (int)(256 + window_size - 1) / window_size;
@@ -2271,21 +2472,19 @@ void sm9_z256_twist_point_dbl(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_copy(R->Z, Z3);
 }
 
-void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
+// R = P + (x2, y2), (x2, y2) in affine form
+static void twist_point_add_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P,
+	const sm9_z256_fp2_t x2, const sm9_z256_fp2_t y2)
 {
 	const sm9_z256_t *X1 = P->X;
 	const sm9_z256_t *Y1 = P->Y;
 	const sm9_z256_t *Z1 = P->Z;
-	const sm9_z256_t *x2 = Q->X;
-	const sm9_z256_t *y2 = Q->Y;
 	sm9_z256_fp2_t X3, Y3, Z3, T1, T2, T3, T4;
 
-	if (sm9_z256_twist_point_is_at_infinity(Q)) {
-		*R = *P;
-		return;
-	}
 	if (sm9_z256_twist_point_is_at_infinity(P)) {
-		*R = *Q;
+		sm9_z256_fp2_copy(R->X, x2);
+		sm9_z256_fp2_copy(R->Y, y2);
+		sm9_z256_fp2_set_one(R->Z);
 		return;
 	}
 
@@ -2297,7 +2496,7 @@ void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_sub(T2, T2, Y1);
 	if (sm9_z256_fp2_is_zero(T1)) {
 		if (sm9_z256_fp2_is_zero(T2)) {
-			sm9_z256_twist_point_dbl(R, Q);
+			sm9_z256_twist_point_dbl(R, P);
 			return;
 		} else {
 			sm9_z256_twist_point_set_infinity(R);
@@ -2322,6 +2521,35 @@ void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POIN
 	sm9_z256_fp2_copy(R->Z, Z3);
 }
 
+// Q->Z should be one
+void sm9_z256_twist_point_add(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
+{
+	if (sm9_z256_twist_point_is_at_infinity(Q)) {
+		*R = *P;
+		return;
+	}
+	if (sm9_z256_twist_point_is_at_infinity(P)) {
+		*R = *Q;
+		return;
+	}
+	twist_point_add_affine(R, P, Q->X, Q->Y);
+}
+
+void sm9_z256_twist_point_add_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P,
+	const SM9_Z256_TWIST_AFFINE_POINT *Q)
+{
+	twist_point_add_affine(R, P, Q->X, Q->Y);
+}
+
+void sm9_z256_twist_point_sub_affine(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P,
+	const SM9_Z256_TWIST_AFFINE_POINT *Q)
+{
+	sm9_z256_fp2_t y;
+
+	sm9_z256_fp2_neg(y, Q->Y);
+	twist_point_add_affine(R, P, Q->X, y);
+}
+
 void sm9_z256_twist_point_sub(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_POINT *P, const SM9_Z256_TWIST_POINT *Q)
 {
 	SM9_Z256_TWIST_POINT _T, *T = &_T;
@@ -2405,9 +2633,29 @@ void sm9_z256_twist_point_mul(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k, const
 	*R = *Q;
 }
 
+extern const uint64_t sm9_z256_twist_pre_comp[37][64 * 4 * 4];
+static GMSSL_NUMA_REPLICA g_twist_pre_comp_replica;
+
+// fixed-base 7-bit Booth windows as sm9_z256_point_mul_generator, 37 mixed additions and no doublings
 void sm9_z256_twist_point_mul_generator(SM9_Z256_TWIST_POINT *R, const sm9_z256_t k)
 {
-	sm9_z256_twist_point_mul(R, k, &SM9_Z256_MONT_P2);
+	const SM9_Z256_TWIST_AFFINE_POINT (*T)[64] = (const SM9_Z256_TWIST_AFFINE_POINT (*)[64])
+		gmssl_numa_replica(&g_twist_pre_comp_replica, sm9_z256_twist_pre_comp, sizeof(sm9_z256_twist_pre_comp));
+	size_t window_size = 7;
+	int n = (int)(256 + window_size - 1) / window_size;
+	int i;
+
+	sm9_z256_twist_point_set_infinity(R);
+
+	for (i = n - 1; i >= 0; i--) {
+		int booth = sm9_z256_get_booth(k, window_size, i);
+
+		if (booth > 0) {
+			sm9_z256_twist_point_add_affine(R, R, &T[i][booth - 1]);
+		} else if (booth < 0) {
+			sm9_z256_twist_point_sub_affine(R, R, &T[i][-booth - 1]);
+		}
+	}
 }
 
 #if 0
@@ -2726,35 +2974,60 @@ void sm9_z256_twist_point_neg_pi2(SM9_Z256_TWIST_POINT *R, const SM9_Z256_TWIST_
 }
 
 
+// a^k for a public exponent in NAF, '1' for +1 and '2' for -1, the inverse is the p^6 Frobenius
+static void sm9_z256_fp12_cyclotomic_pow_naf(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const char *naf)
+{
+	sm9_z256_fp12_t t;
+	sm9_z256_fp12_t a_inv;
+
+	sm9_z256_fp12_frobenius6(a_inv, a);
+	sm9_z256_fp12_copy(t, a);
+
+	// the leading digit is always 1
+	for (naf++; *naf; naf++) {
+		sm9_z256_fp12_cyclotomic_sqr(t, t);
+		if (*naf == '1') {
+			sm9_z256_fp12_mul(t, t, a);
+		} else if (*naf == '2') {
+			sm9_z256_fp12_mul(t, t, a_inv);
+		}
+	}
+	sm9_z256_fp12_copy(r, t);
+}
+
 void sm9_z256_final_exponent_hard_part(sm9_z256_fp12_t r, const sm9_z256_fp12_t f)
 {
-	// a2 = 0xd8000000019062ed0000b98b0cb27659
-	// a3 = 0x2400000000215d941
-	const sm9_z256_t a2 = {0x0000b98b0cb27659, 0xd8000000019062ed, 0, 0};
-	const sm9_z256_t a3 = {0x400000000215d941, 0x2, 0, 0};
-	const sm9_z256_t nine = {9,0,0,0};
-	sm9_z256_fp12_t t0, t1, t2, t3;
+	// a2 = 0xd8000000019062ed0000b98b0cb27659 = 6*u^2 + 1, 34 nonzero NAF digits vs 40 bits
+	// a3 = 0x2400000000215d941 = 6*u + 5, 11 nonzero NAF digits vs 13 bits
+	const char *a2 = "100202000000000000000000000000000000000102001000010200102000202010000000000000001020020102001020200010201020200101000202010202001";
+	const char *a3 = "100100000000000000000000000000000000000010001020200020200101000001";
+	sm9_z256_fp12_t t0, t1, t2, t3, t4;
 
-	sm9_z256_fp12_pow(t0, f, a3);
-	sm9_z256_fp12_inv(t0, t0);
+	// t0 = f^-a3
+	sm9_z256_fp12_cyclotomic_pow_naf(t0, f, a3);
+	sm9_z256_fp12_frobenius6(t0, t0);
 	sm9_z256_fp12_frobenius(t1, t0);
 	sm9_z256_fp12_mul(t1, t0, t1);
 
 	sm9_z256_fp12_mul(t0, t0, t1);
 	sm9_z256_fp12_frobenius(t2, f);
 	sm9_z256_fp12_mul(t3, t2, f);
-	sm9_z256_fp12_pow(t3, t3, nine);
+	// t3 = t3^9
+	sm9_z256_fp12_cyclotomic_sqr(t4, t3);
+	sm9_z256_fp12_cyclotomic_sqr(t4, t4);
+	sm9_z256_fp12_cyclotomic_sqr(t4, t4);
+	sm9_z256_fp12_mul(t3, t3, t4);
 
 	sm9_z256_fp12_mul(t0, t0, t3);
-	sm9_z256_fp12_sqr(t3, f);
-	sm9_z256_fp12_sqr(t3, t3);
+	sm9_z256_fp12_cyclotomic_sqr(t3, f);
+	sm9_z256_fp12_cyclotomic_sqr(t3, t3);
 	sm9_z256_fp12_mul(t0, t0, t3);
-	sm9_z256_fp12_sqr(t2, t2);
+	sm9_z256_fp12_cyclotomic_sqr(t2, t2);
 	sm9_z256_fp12_mul(t2, t2, t1);
 	sm9_z256_fp12_frobenius2(t1, f);
 	sm9_z256_fp12_mul(t1, t1, t2);
 
-	sm9_z256_fp12_pow(t2, t1, a2);
+	sm9_z256_fp12_cyclotomic_pow_naf(t2, t1, a2);
 	sm9_z256_fp12_mul(t0, t2, t0);
 	sm9_z256_fp12_frobenius3(t1, f);
 	sm9_z256_fp12_mul(t1, t1, t0);
@@ -2777,6 +3050,64 @@ void sm9_z256_final_exponent(sm9_z256_fp12_t r, const sm9_z256_fp12_t f)
 	sm9_z256_fp12_copy(r, t0);
 }
 
+/*
+ * The easy part f^((p^6 - 1)(p^2 + 1)) needs f^-1, the inversions of a batch are
+ * replaced by one with Montgomery's trick. A zero f, which has no inverse, is
+ * left out of the product and exponentiated alone.
+ */
+void sm9_z256_final_exponent_batch(sm9_z256_fp12_t *r, const sm9_z256_fp12_t *f, size_t n)
+{
+	sm9_z256_fp12_t acc[SM9_Z256_FINAL_EXPONENT_BATCH];
+	sm9_z256_fp12_t inv[SM9_Z256_FINAL_EXPONENT_BATCH];
+	sm9_z256_fp12_t zero;
+	sm9_z256_fp12_t t0;
+	sm9_z256_fp12_t t1;
+	int is_zero[SM9_Z256_FINAL_EXPONENT_BATCH];
+	size_t m, i;
+
+	memset(zero, 0, sizeof(zero));
+
+	while (n) {
+		m = n < SM9_Z256_FINAL_EXPONENT_BATCH ? n : SM9_Z256_FINAL_EXPONENT_BATCH;
+
+		// acc[i] = f[0] * ... * f[i]
+		for (i = 0; i < m; i++) {
+			is_zero[i] = sm9_z256_fp12_equ(f[i], zero);
+			if (i == 0) {
+				sm9_z256_fp12_set_one(acc[0]);
+			} else {
+				sm9_z256_fp12_copy(acc[i], acc[i - 1]);
+			}
+			if (!is_zero[i]) {
+				sm9_z256_fp12_mul(acc[i], acc[i], f[i]);
+			}
+		}
+		sm9_z256_fp12_inv(t0, acc[m - 1]);
+		for (i = m - 1; i > 0; i--) {
+			if (!is_zero[i]) {
+				sm9_z256_fp12_mul(inv[i], t0, acc[i - 1]);
+				sm9_z256_fp12_mul(t0, t0, f[i]);
+			}
+		}
+		sm9_z256_fp12_copy(inv[0], t0);
+
+		for (i = 0; i < m; i++) {
+			if (is_zero[i]) {
+				sm9_z256_final_exponent(r[i], f[i]);
+				continue;
+			}
+			sm9_z256_fp12_frobenius6(t0, f[i]);
+			sm9_z256_fp12_mul(t0, t0, inv[i]);
+			sm9_z256_fp12_frobenius2(t1, t0);
+			sm9_z256_fp12_mul(t0, t0, t1);
+			sm9_z256_final_exponent_hard_part(r[i], t0);
+		}
+		r += m;
+		f += m;
+		n -= m;
+	}
+}
+
 #if 0
 void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P)
 {
@@ -2891,7 +3222,7 @@ void sm9_z256_fp12_line_mul(sm9_z256_fp12_t r, const sm9_z256_fp12_t a, const sm
 	sm9_z256_fp4_copy(r[2], r2);
 }
 
-void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P)
+void sm9_z256_miller_loop(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P)
 {
 	const char *abits = "00100000000000000000000000000000000000010000101100020200101000020";
 
@@ -2947,10 +3278,190 @@ void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM
 
 	sm9_z256_eval_g_line_no_pre(&T, lw, &T, &Q2, &P_);
 	sm9_z256_fp12_line_mul(r, r, lw);
+}
+
+void sm9_z256_pairing(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P)
+{
+	sm9_z256_miller_loop(r, Q, P);
+	sm9_z256_final_exponent(r, r);
+}
+
+// Miller loop of up to SM9_Z256_PAIRING_MULTI_MAX pairs sharing the squarings of f
+static void sm9_z256_miller_loop_multi(sm9_z256_fp12_t f,
+	const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P, size_t n)
+{
+	const char *abits = "00100000000000000000000000000000000000010000101100020200101000020";
+
+	SM9_Z256_TWIST_POINT T[SM9_Z256_PAIRING_MULTI_MAX];
+	SM9_Z256_TWIST_POINT Q1[SM9_Z256_PAIRING_MULTI_MAX];
+	SM9_Z256_TWIST_POINT Q2;
+	SM9_Z256_AFFINE_POINT P_[SM9_Z256_PAIRING_MULTI_MAX];
+	sm9_z256_fp2_t pre[SM9_Z256_PAIRING_MULTI_MAX][5];
+	sm9_z256_fp2_t lw[3];
+	size_t i, j;
+
+	for (j = 0; j < n; j++) {
+		sm9_z256_fp2_copy(T[j].X, Q[j].X);
+		sm9_z256_fp2_copy(T[j].Y, Q[j].Y);
+		sm9_z256_fp2_copy(T[j].Z, Q[j].Z);
+
+		sm9_z256_point_to_affine(&P_[j], &P[j]);
+		sm9_z256_twist_point_neg(&Q1[j], &Q[j]);
+
+		sm9_z256_fp2_sqr(pre[j][0], Q[j].Y);
+		sm9_z256_fp2_mul(pre[j][4], Q[j].X, Q[j].Z);
+		sm9_z256_fp2_dbl(pre[j][4], pre[j][4]);
+		sm9_z256_fp2_sqr(pre[j][1], Q[j].Z);
+		sm9_z256_fp2_mul(pre[j][1], pre[j][1], Q[j].Z);
+		sm9_z256_fp2_mul_fp(pre[j][2], pre[j][1], P_[j].Y);
+		sm9_z256_fp2_dbl(pre[j][2], pre[j][2]);
+		sm9_z256_fp2_mul_fp(pre[j][3], pre[j][1], P_[j].X);
+		sm9_z256_fp2_dbl(pre[j][3], pre[j][3]);
+		sm9_z256_fp2_neg(pre[j][3], pre[j][3]);
+	}
+
+	sm9_z256_fp12_set_one(f);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_fp12_sqr(f, f);
+
+		for (j = 0; j < n; j++) {
+			sm9_z256_eval_g_tangent(&T[j], lw, &T[j], &P_[j]);
+			sm9_z256_fp12_line_mul(f, f, lw);
+
+			if (abits[i] == '1') {
+				sm9_z256_eval_g_line(&T[j], lw, pre[j], &T[j], &Q[j], &P_[j]);
+				sm9_z256_fp12_line_mul(f, f, lw);
+			} else if (abits[i] == '2') {
+				sm9_z256_eval_g_line(&T[j], lw, pre[j], &T[j], &Q1[j], &P_[j]);
+				sm9_z256_fp12_line_mul(f, f, lw);
+			}
+		}
+	}
+
+	for (j = 0; j < n; j++) {
+		sm9_z256_twist_point_pi1(&Q1[j], &Q[j]);
+		sm9_z256_twist_point_neg_pi2(&Q2, &Q[j]);
+
+		sm9_z256_eval_g_line_no_pre(&T[j], lw, &T[j], &Q1[j], &P_[j]);
+		sm9_z256_fp12_line_mul(f, f, lw);
+
+		sm9_z256_eval_g_line_no_pre(&T[j], lw, &T[j], &Q2, &P_[j]);
+		sm9_z256_fp12_line_mul(f, f, lw);
+	}
+}
+
+// r = e(Q[0], P[0]) * ... * e(Q[n-1], P[n-1]) with a single final exponentiation
+void sm9_z256_pairing_multi(sm9_z256_fp12_t r, const SM9_Z256_TWIST_POINT *Q, const SM9_Z256_POINT *P, size_t n)
+{
+	sm9_z256_fp12_t f;
+	size_t len;
+
+	sm9_z256_fp12_set_one(r);
+
+	while (n) {
+		len = n < SM9_Z256_PAIRING_MULTI_MAX ? n : SM9_Z256_PAIRING_MULTI_MAX;
+		sm9_z256_miller_loop_multi(f, Q, P, len);
+		sm9_z256_fp12_mul(r, r, f);
+		Q += len;
+		P += len;
+		n -= len;
+	}
 
 	sm9_z256_final_exponent(r, r);
 }
 
+/*
+ * The lines of the Miller loop only depend on Q, the tangent and line functions
+ * are linear in the coordinates of P:
+ *
+ *	lw = lw[0] + (l1 * xP) * w^2 + (l2 * yP) * w^3
+ *
+ * so they are evaluated once with P = (1, 1) and scaled by xP and yP later.
+ */
+void sm9_z256_twist_point_prepare(SM9_Z256_PREPARED_TWIST_POINT *prep, const SM9_Z256_TWIST_POINT *Q)
+{
+	const char *abits = "00100000000000000000000000000000000000010000101100020200101000020";
+
+	SM9_Z256_TWIST_POINT T;
+	SM9_Z256_TWIST_POINT Q1;
+	SM9_Z256_TWIST_POINT Q2;
+	SM9_Z256_AFFINE_POINT one;
+	sm9_z256_fp2_t pre[5];
+	size_t i, k = 0;
+
+	sm9_z256_copy(one.X, SM9_Z256_MODP_MONT_ONE);
+	sm9_z256_copy(one.Y, SM9_Z256_MODP_MONT_ONE);
+
+	sm9_z256_fp2_copy(T.X, Q->X);
+	sm9_z256_fp2_copy(T.Y, Q->Y);
+	sm9_z256_fp2_copy(T.Z, Q->Z);
+	sm9_z256_twist_point_neg(&Q1, Q);
+
+	sm9_z256_fp2_sqr(pre[0], Q->Y);
+	sm9_z256_fp2_mul(pre[4], Q->X, Q->Z);
+	sm9_z256_fp2_dbl(pre[4], pre[4]);
+	sm9_z256_fp2_sqr(pre[1], Q->Z);
+	sm9_z256_fp2_mul(pre[1], pre[1], Q->Z);
+	sm9_z256_fp2_dbl(pre[2], pre[1]);
+	sm9_z256_fp2_neg(pre[3], pre[2]);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_eval_g_tangent(&T, prep->lines[k++], &T, &one);
+		if (abits[i] == '1') {
+			sm9_z256_eval_g_line(&T, prep->lines[k++], pre, &T, Q, &one);
+		} else if (abits[i] == '2') {
+			sm9_z256_eval_g_line(&T, prep->lines[k++], pre, &T, &Q1, &one);
+		}
+	}
+
+	sm9_z256_twist_point_pi1(&Q1, Q);
+	sm9_z256_twist_point_neg_pi2(&Q2, Q);
+	sm9_z256_eval_g_line_no_pre(&T, prep->lines[k++], &T, &Q1, &one);
+	sm9_z256_eval_g_line_no_pre(&T, prep->lines[k++], &T, &Q2, &one);
+
+	assert(k == SM9_Z256_PAIRING_LINES);
+}
+
+static void sm9_z256_fp12_prepared_line_mul(sm9_z256_fp12_t r, const sm9_z256_fp2_t line[3],
+	const SM9_Z256_AFFINE_POINT *P)
+{
+	sm9_z256_fp2_t lw[3];
+
+	sm9_z256_fp2_copy(lw[0], line[0]);
+	sm9_z256_fp2_mul_fp(lw[1], line[1], P->X);
+	sm9_z256_fp2_mul_fp(lw[2], line[2], P->Y);
+	sm9_z256_fp12_line_mul(r, r, (const sm9_z256_fp2_t *)lw);
+}
+
+void sm9_z256_miller_loop_prepared(sm9_z256_fp12_t r, const SM9_Z256_PREPARED_TWIST_POINT *Q, const SM9_Z256_POINT *P)
+{
+	const char *abits = "00100000000000000000000000000000000000010000101100020200101000020";
+
+	SM9_Z256_AFFINE_POINT P_;
+	size_t i, k = 0;
+
+	sm9_z256_point_to_affine(&P_, P);
+
+	sm9_z256_fp12_set_one(r);
+
+	for (i = 0; i < strlen(abits); i++) {
+		sm9_z256_fp12_sqr(r, r);
+		sm9_z256_fp12_prepared_line_mul(r, Q->lines[k++], &P_);
+		if (abits[i] != '0') {
+			sm9_z256_fp12_prepared_line_mul(r, Q->lines[k++], &P_);
+		}
+	}
+	sm9_z256_fp12_prepared_line_mul(r, Q->lines[k++], &P_);
+	sm9_z256_fp12_prepared_line_mul(r, Q->lines[k++], &P_);
+}
+
+void sm9_z256_pairing_prepared(sm9_z256_fp12_t r, const SM9_Z256_PREPARED_TWIST_POINT *Q, const SM9_Z256_POINT *P)
+{
+	sm9_z256_miller_loop_prepared(r, Q, P);
+	sm9_z256_final_exponent(r, r);
+}
+
 void sm9_z256_modn_add(sm9_z256_t r, const sm9_z256_t a, const sm9_z256_t b)
 {
 	uint64_t c;
@@ -3083,11 +3594,20 @@ static const sm9_z256_t SM9_Z256_N_MINUS_TWO = {
 	0xe56ee19cd69ecf23, 0x49f2934b18ea8bee, 0xd603ab4ff58ec744, 0xb640000002a3a6f1
 };
 
-void sm9_z256_modn_inv(sm9_z256_t r, const sm9_z256_t a)
+void sm9_z256_modn_inv_exp(sm9_z256_t r, const sm9_z256_t a)
 {
 	sm9_z256_modn_pow(r, a, SM9_Z256_N_MINUS_TWO);
 }
 
+void sm9_z256_modn_inv(sm9_z256_t r, const sm9_z256_t a)
+{
+#if defined(__SIZEOF_INT128__)
+	safegcd_z256_inv(r, a, SM9_Z256_N);
+#else
+	sm9_z256_modn_inv_exp(r, a);
+#endif
+}
+
 const sm9_z256_t SM9_Z256_N_MINUS_ONE_BARRETT_MU = {
 	0x74df4fd4dfc97c31, 0x9c95d85ec9c073b0, 0x55f73aebdcd1312c, 0x67980e0beb5759a6
 };
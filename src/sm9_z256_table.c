@@ -4833,3 +4833,9561 @@ const uint64_t sm9_z256_pre_comp[37][64 * 4 * 2] = {
 	 0x68deb51804832377, 0xc000dab001d679d2, 0xd314ad76b56014dc, 0x170aae15e9896258,
 	},
 };
+
+
+// (j + 1) * 2^(7*i) * P2 in affine form, X and Y over Fp2
+#if defined(__GNUC__)
+__attribute((aligned(4096)))
+#elif defined(_MSC_VER)
+__declspec(align(4096))
+#endif
+
+
+const uint64_t sm9_z256_twist_pre_comp[37][64 * 4 * 4] = {
+	{
+	 0x260226a68ce2da8f, 0x7ee5645edbf6c06b, 0xf8f57c82b1495444, 0x61fcf018bc47c4d1,
+	 0xdb6db4822750a8a6, 0x84c6135a5121f134, 0x1874032f88791d41, 0x905112f2b85f3a37,
+	 0xc03f138f9171c24a, 0x92fbab45a15a3ca7, 0x2445561e2ff77cdb, 0x108495e0c0f62ece,
+	 0xf7b82dac4c89bfbb, 0x3706f3f6a49dc12f, 0x1e29de93d3eef769, 0x81e448c3c76a5d53,
+	 0x814e681a70c32949, 0x14c6a2bfb140479a, 0x95cc9ed999e0b315, 0x4372300772daace1,
+	 0xfb7eb8a0dcf3d8c2, 0xf03b823f276fcf4e, 0xf72e796b76822ac0, 0x50406b3e354177c4,
+	 0x9aedf94af5f34a70, 0xc073ddfd668e95d3, 0x4c5edf11042acc9a, 0x80a5ea228ff6ae1d,
+	 0x6b979082a9a03880, 0x0052ae25cd2ce885, 0x600df0a6126b4f55, 0x07e0d5a3f4373fac,
+	 0xedfd06d2ec68eb44, 0x669ab2a49646567c, 0x94b3ba8d638609dd, 0x9d50967a8c01677a,
+	 0xca225be55d140878, 0x1586c4331c659f63, 0xaa31b77e22b49b59, 0x42f0e62accc63dd3,
+	 0xac327b9ed843b2cd, 0x2bc00eea73cc2db2, 0xa96c47607fa0fd47, 0x895f20d4ff905ad1,
+	 0x695a425b3273c79e, 0x0d8c1038b510dd45, 0x8698c724d1a48767, 0x2d07046d33f2fd2a,
+	 0x9721c1af682c9b1b, 0x569a67a0efca89a3, 0xe48f94d3d095bde3, 0x13fdef912578d104,
+	 0xdd219d4807c8e15d, 0xa52c8e11d52d05a3, 0x1fa24dacd5b1d64f, 0x9ab16b2f5f170056,
+	 0x9cd4ce974e8cb09a, 0xc6037fb134ee7e0c, 0xbda5e99828535dd8, 0xb10337dba1b1b2ab,
+	 0x02491b9338419138, 0x98c91d4df2d9aab7, 0xe51345f24e258191, 0x15fbd27e3c81136a,
+	 0x6fec562730f4f660, 0x34d8179e51059d9f, 0x43d51964b5bf8a48, 0x49a13b6cdca51b8e,
+	 0xae8daa69a4a89872, 0x202cca7ee2d8df6d, 0x5d308bfd705ac938, 0x7f7786ddec6f5405,
+	 0xe71205ae0667d863, 0xffc50f456957595f, 0x96b6c42c5bd3a05c, 0x2017b791807be8f8,
+	 0x20e34e9bd85afee7, 0x37f0e7d8ee251a07, 0xdd018478c2abf040, 0x3b0fb93533ef9a9b,
+	 0xbf776996e0fa8cb8, 0x57b61e1b0bec625c, 0xee4f9041b32ea710, 0x7346c7be01c781b3,
+	 0xd7ec57ac55300d96, 0x7439b1dfedcaa8f3, 0x348bf67f26061d43, 0x28ce0cf83144e229,
+	 0xb711677b1b9c5dce, 0xdb0f4fb1afbec611, 0xd058d3ef7eaebced, 0x4c510cdd9d450de9,
+	 0xa4655113e7ccb0b9, 0xd1b01ed49fc1cb6e, 0x6d12f2f92f3d18de, 0x15739c38f53b0ffc,
+	 0x53d2c2acf0082426, 0x08847671a9670b3c, 0x9401a0d47ac45e24, 0x13d6f89bc9536677,
+	 0xde5cd41e903a302c, 0x5470222ef59b70b9, 0xe0ca4915d33cadc0, 0x428e39a44ebf9ecd,
+	 0x62428cd55d030c3e, 0x10e48596aa2154bd, 0x75f4e38795d2b8c7, 0xb4ab281ffae4ae5c,
+	 0x6a70ae8e34eff734, 0xa98fc38663888d30, 0xe54c2a035083a5e7, 0x3b9ff7c8bb467496,
+	 0x542546e637ac4682, 0x25ad2aa2b8b09243, 0xca327d0c4e4a52b3, 0x1991fade272535e9,
+	 0x27d2c01e845a0151, 0x8511758313f7b336, 0x011e689a9781ed30, 0x6e67a970a19b9a02,
+	 0x5897612984368fa9, 0xcdaf4bc6f1279e45, 0xfa6b7d872a666c16, 0x7d5bb92933974dee,
+	 0x9e2f86e0bcda833a, 0xd9c07ae0255bb3a8, 0x98e5c6a80b5f3bc9, 0x7f5188e66d076d28,
+	 0x97d81c1fb38fb3bf, 0x6ac1dd19ab8c4c8e, 0x11ee3a1653ff95c8, 0xa1292a33ac62fe23,
+	 0xfa9f28bfa7c0546a, 0x045cbe8c200bab12, 0x0d56301649c9a50c, 0x44d2e4db6f310b9d,
+	 0x4e546bfb379e2c9c, 0x6bcbdeeac59cb041, 0xfe1c5faa0b8d496f, 0x1c8e356633227a1f,
+	 0x899cdc6fcbd8b34c, 0x0c92e81ef5148852, 0x5345909a7b40215b, 0x00cd010cc5e9cfd3,
+	 0xbfe0b7086defbf8e, 0x495075de57e58c02, 0xad76c02f9751dc73, 0x5b62930130df0293,
+	 0x62016c6915a99cab, 0x911b2c032e0cdd7e, 0x0ec930180354b791, 0x434628f67d8c7b8d,
+	 0x67b5281f746d3d90, 0xeecdbd9a17d978b6, 0xdec74199551999e4, 0x9e92827352b66e53,
+	 0x457f61454f34a1b7, 0x2ecaec6d386b92d5, 0xe929c7d31be2a0ce, 0x55d287923317ff76,
+	 0x0b479bfcb3e8b41c, 0x8eb5d2d97500712e, 0x09aed2a4caf0d886, 0xb58f3182883cb283,
+	 0x8ac1fcfe643e2958, 0xd99dfb638325d87e, 0x8315128fd43ae18c, 0x55baa9fee2a22ef5,
+	 0xd447dcf0b18a5f32, 0xf81c2407a33c45e0, 0xc45d790a19474bbc, 0x6aa2ac00b7461ea7,
+	 0xe2b62bbf8f0f3622, 0x1a04464bcf1ee625, 0x9f467ef5b2626b11, 0x4ccab10fb72ec805,
+	 0xa305cbb340fdc391, 0x993c3aa3f8bc120b, 0x918d878d51341b24, 0x627083593b7d063a,
+	 0xfbb233beff3846a2, 0xff90d41da065420f, 0xcad409dd4299385f, 0x231c3c7198f4d246,
+	 0xc6d2ad58faaa2ba4, 0xb047b064064dfc9d, 0xf2bf4fbf659cea96, 0x668203b7b017b368,
+	 0xaab632adf9157b1c, 0x68bf0cda9592ce6d, 0x9b77eb7f180eedff, 0x048b673bdca41bbb,
+	 0xba5d5b6d38759136, 0x66a79dccea58b432, 0x954d1cf9a016ebce, 0x83a8b43ebfaa7eca,
+	 0x0fadb5c463a70bab, 0x4058e6cc9fca0289, 0xb16465654ad5554f, 0x6a39b677c8f626be,
+	 0x3e859fc8b14d8bf7, 0x1fb29572fa241766, 0xb225b5a4880670e8, 0x8f9c20be746cf430,
+	 0x5a23008bdec58073, 0x03b96837064f6bf8, 0x05a7050ad35f21b9, 0x8568707af666e74b,
+	 0xa8f4f5935254044e, 0x3bb01bd6b7850137, 0x488573198988b23a, 0x31e149e049443b82,
+	 0x4cc04496e3517429, 0x453468cd20963e9a, 0xa9e45ba899ebff1d, 0x8938b9050ec12fab,
+	 0x2d164f147c78f96d, 0xff0d1ee344658002, 0x7a03f4efbacd695d, 0x3788d4d103c265e1,
+	 0x09d781a4f7d82c4d, 0xb108f7f088100d55, 0x9c52524355fb88cd, 0x677fb96d079e5248,
+	 0x03f988117056acfe, 0x8ff8f58fe0796489, 0xea4f514720312a20, 0x89727c3bd5ac2085,
+	 0x883a3f2ccac3dfe7, 0x4e407d1af5c05fbd, 0x042c30b9823c59c8, 0xa4b121b5ea414f8d,
+	 0x9030e284f7c3794f, 0xcb17014fae811c32, 0x64a92921feab90e2, 0x5b425722a4f609a2,
+	 0xeb2bee7344328fda, 0xd4c5e2b015873574, 0x38f551e47e407746, 0x0a920ed66fa50106,
+	 0xd4c4cf27191dd9ed, 0x1a7d144ead7ccab3, 0xfc318deef992271d, 0x6fb8e29f60460969,
+	 0xe7218dd51f7ce21d, 0xf4e68b92fd3b5cc7, 0x15f5f02c375a0e25, 0x2156d4b38548b288,
+	 0xe964d9c5b7f47ba2, 0x97606490e04b9199, 0x2da3c296d799e319, 0x4a910bb920303cbc,
+	 0xab6b8410b89834a5, 0x772376db19e32a94, 0x99cd9f945f0e0126, 0x3009ecfba9b4a41c,
+	 0x5fcc945e8905617f, 0xd57fd89d730d4134, 0xca94ddb20820a251, 0x72ea42bbe5d236cd,
+	 0x9ef49f4bcd0a831b, 0xe335b3ce32e85cf5, 0xdf9f48f4444a5d4f, 0x802af49f070d878d,
+	 0xc0d33f7d657341f7, 0xab9741a1bfdd40f2, 0x9845d4f29877b905, 0xa69dda0fc3d385b8,
+	 0x88ee25c6087f0f81, 0xca8d94e7c06d85d2, 0xf9dfbf78001bd80b, 0x4cf722f4ee1fab84,
+	 0x011c5cb5dfae210f, 0xdad0ec0022c22613, 0x9fcd57af2c9eda2e, 0xa28d271c91e08373,
+	 0xb749bc2e1bec8781, 0x0f42adeb79c0a26f, 0x45a24cc4c947f9b3, 0x2a356ae1d7451693,
+	 0x4067b7c23b75eebb, 0xae4b1d95413aa2d1, 0x43ad00ea24378e15, 0xae904310a8c8068a,
+	 0xdc032dcdf380e464, 0x36ba7d8bdd9e14b9, 0x0b7121aa78595ca4, 0x75b5e98e99713b55,
+	 0x358d14483a4e2060, 0x3b19a868dfd00959, 0x66c62188672b7ee9, 0xaa975a0807b30460,
+	 0x6b63726803eb84be, 0x7ff281a247cf5c59, 0xc06291b1ce61c152, 0x37d0b290e2b2dae5,
+	 0x59df7ef61344a443, 0x61cb2e4d3e96d29c, 0x4daf33f6fa87b813, 0x9daeea9795d5fbea,
+	 0xcd38ff106537a205, 0x6c130d64e9fc968b, 0x4cc8995e7ba61256, 0x09d24a8caea080f8,
+	 0xe030cdb7ff46246e, 0xebf79d9c221ba249, 0x87d3d87de92a6bf3, 0x849724c764314699,
+	 0xe84eb22478606248, 0xfe8b85d93d343945, 0x49dd5b9368a93d65, 0x4156a5757a4af603,
+	 0x55cc18c86258f68a, 0xadfb9cf86979d3eb, 0xe5d4dd535005f32b, 0x417a164be0d52d95,
+	 0x5263115d9c6f9c34, 0x9ebb4595a1f8a055, 0xc75ad9168c23635c, 0x8b4ed9b5c445dd14,
+	 0x971c755bcd62d17b, 0x9db31efefadac882, 0x5c5d10656bebdd37, 0x921273732989a683,
+	 0x50cd2e6cbd382b19, 0x18405d629d32ddb0, 0x64fd7a56ce98b68f, 0x50b963e3ebd52e37,
+	 0x5482c65c9272d406, 0x83354e483fe4099d, 0x80e618b3b73d46a4, 0x0d6924816fbfe712,
+	 0x8558e7c022960df0, 0xb496fcaf959e989e, 0x71c3508e23238ece, 0x6eef1c646a9af1b7,
+	 0xc6e68aa10b8fee7d, 0x16b67dbdaba47c92, 0x80de2a9a364ea4bf, 0x5e06670780067c84,
+	 0xf4c3f79951c80005, 0x9655c581b469831f, 0x65aba1f9d00eec8d, 0x30a15fbb2ab3c5ad,
+	 0xdda0960eb462dd88, 0x9907d3b1bd95c06d, 0xb800f94d095108f2, 0x484eff1f56abf2cf,
+	 0xed32344d05c0c616, 0x50103988f482fdb2, 0x77d5995d1839ddc6, 0x9919dcd1a3caa929,
+	 0x545fe3af9a810523, 0x853d34a20cb0f776, 0xc5490c7d3617f071, 0x8eb8fd745e4d985b,
+	 0x4ca31bdbd4f43455, 0xaaf4644f7ed9e46b, 0x18a5cc136055deae, 0x9e1372872f54bf5d,
+	 0xdd51186003409340, 0xa12a73835bcb93b9, 0x5202cf788df129a2, 0x490dd9d685b44a54,
+	 0x6db242daf7ea1a4e, 0x5e24847357180d8e, 0x4dfd01a6fef0ca03, 0x410a427f925f5b20,
+	 0x91b9139c01216a45, 0x9e1682cf4a3cfcd1, 0xccbe5f30c9379b0e, 0x43898280477e4cb2,
+	 0xe213828cc97d7628, 0xb0500e1a1e6433a9, 0xcc41dbcbf2988ef5, 0x406e54ccee42a039,
+	 0x7b69ab741bbfd39b, 0xca5ef1d300efe993, 0x4a2062be80a97c99, 0x78910703755c7284,
+	 0x5ce15391e647500c, 0x8f2cef5a7760a76b, 0x2761ac000185aad9, 0x52d408f5d1f74bc3,
+	 0xd40e8df90d7c0e56, 0xf6c738e0a645e708, 0xa6d08aab956a9b0a, 0x8627f41e72a4c44a,
+	 0xe9faa366cf928b38, 0x8b6c86fb17128980, 0x8134229dec917f73, 0x28e553c0e309b1a6,
+	 0xd33dab4e5b56b9b8, 0xe917093eb4dd0323, 0x32942446309fcf00, 0xa6dce3d5c71661dc,
+	 0x5af560c1177d48cc, 0xbf6dd6b2a30c3e07, 0xacf6dc79891e04f8, 0x17ea053970e1b2a1,
+	 0x1a05740c61b438a7, 0xc97d21e7a25f566c, 0x4080c0035ee6377c, 0x159b8cb6d4ed2e6d,
+	 0x9158e63233748ca3, 0xa1f01ca7f251c80c, 0x136569e22008e5e4, 0x803451fe84752b8c,
+	 0xcda59146d8e48dce, 0xe9911d0313b35ef7, 0x883cecad96769891, 0x59d1ce7d442cca43,
+	 0xea19cf69682b6837, 0x9f1d9b463bf50b2c, 0xd137b08627534b28, 0x94917a3f7d93b8c1,
+	 0x9238faede7e4049a, 0x2a8d964e03c48b3f, 0xe1b2305a844c337f, 0x46b49b3d7d2b831c,
+	 0x425bc5ecd7fe8480, 0x149250e7c4a88711, 0x23d93b29474580b0, 0x8b1337eed79ca50c,
+	 0x9cdf61a02f1b8e6a, 0x7d28583604d6803e, 0xdf8c793af46032bd, 0x0cca947eae69d7a4,
+	 0x6c47b1e186bf619a, 0x76209009354f0e3e, 0x7f6b391e08d2db87, 0x98a40769c2d25fc4,
+	 0x918e43a320120ca0, 0x62b100b29b26d856, 0x9982dfde57a3d22a, 0x22a8c64d79b6885a,
+	 0x7e3718e9772a616c, 0x9d07bcfbaced559b, 0x40ff4e87c049e44c, 0x5da1ca63c3a2d3b6,
+	 0x92edc6db3f3ce200, 0x761b43084058d61a, 0x322b47dfb5759c03, 0x376ca9d988c68c58,
+	 0x9393a745f15c901c, 0x841ba8019d2c06b5, 0xc794d611eeb51e66, 0xa94437a474bdb8e7,
+	 0xd675a48efa5f3833, 0x22dd83072e4206c6, 0xd512ff75ad24c7bb, 0x10118217ca625c65,
+	 0x1aed54c7fe200cd5, 0x046fbf5c845a931c, 0x10d1a22cc746c5d3, 0x81c8f3211a963346,
+	 0xbbcf271ebe9caa87, 0x70e509ffa8eb195b, 0xfb1b9dd9e327b0be, 0x6573b7f18d11746b,
+	 0x7798e181e82fd48a, 0x97ab808bdef3a480, 0x9f973580418be001, 0x0d76c36ceb88238d,
+	 0xae06f6e3070ac292, 0x7016ffe77f94f282, 0x892538b6c6651478, 0xb4383191962a5d04,
+	 0xebe6694855b6314f, 0x76f13721301486ce, 0x1ca61425ed635176, 0x25a5fd9a9120ccd4,
+	 0x348ae60833eba150, 0x25ed705de008a226, 0x9d2337ee0a74baa0, 0x15df79fae8bbafc2,
+	 0x7f59fc887b6a4aac, 0x3d09456b20476996, 0x9635ee98bae05381, 0x4960ca324d2a807c,
+	 0xe077cec45e54bb11, 0x91a446f5d9d54e23, 0x8851f017da724925, 0x8e246be71717b8be,
+	 0x19572e1ad7f44e1e, 0x2f5956cb7ce63687, 0x2836705f45758e97, 0x6413666a62b313f8,
+	 0x86bcbefe59f14286, 0x5f1d0fcd949a58af, 0x38b204e049ce3413, 0x836545949d89e3db,
+	 0xaad7eb54cc2ee990, 0x72fe6cc02c8b11d4, 0x894b02b0c4cd147d, 0x90c5a21c2f99f898,
+	 0x6e581b2cf2161075, 0x1fe4b16726a28f16, 0x51a20561cde15339, 0x3a869091a6ad7ea6,
+	 0x381d47d590233103, 0x7e80c0b61e1bbbfb, 0x32c4b14a6068371e, 0x1c075b96b9012d58,
+	 0x25cd56f05d9cdc1f, 0x3c66398c9a25d48a, 0x1bb449f912f94398, 0x6a532c16cf9e8f7f,
+	 0x0a41429716003c22, 0xd2ffa263533da1a4, 0xdad1be17895dded8, 0x3d367bdfcc840175,
+	 0x7c7d19c2bb0f74f6, 0x862d2b61a9b93519, 0x4306d16720c2eb26, 0x1dc9add954f1ab86,
+	 0x2364ceef3e1836ee, 0xc08df6f23066b24a, 0x0a4a74afebd3f620, 0x6f41b4f3c7080311,
+	 0x3cf9b025d0637329, 0x342b1cfcea4999ca, 0x1651c5a237b1211f, 0x3c38584345ad211a,
+	 0x27101d13e10aad7a, 0x1797fbb024366635, 0xff4d28419773abd2, 0x3195b8431dea6bed,
+	 0xaefe736ee68e44e3, 0xec1817288779f378, 0xc9f9a45254199c00, 0x00e99c63f0891928,
+	 0x7f335e2d841bc5b0, 0xe647b68ca180cd9f, 0x845f3814a515ad4f, 0xa5209ee509d012af,
+	 0x814e34d6577179a5, 0x8a6b6d1caf122f8f, 0x750abaf1297fb098, 0x647f68ec7907bacc,
+	 0xd3e7c8365260b1d2, 0x91ccd7c0594f1f02, 0xc0d7b618b9344871, 0x060e9db7dc49e1a8,
+	 0x55eebe7421b42193, 0xa4c0601a55612ff0, 0x5ddafaa5c8d3b438, 0x8ea1521a906204da,
+	 0x269b136cc518ca43, 0x6d37e8aa62a3dda3, 0x6dd10c47fed00ed7, 0x3b2e62f85da9dd66,
+	 0x6dba448ada854b2e, 0x2c733e0ec2053b21, 0x7737a2290e3f7501, 0xb52121b3b4ef7edc,
+	 0xbf699a871f86974a, 0xfee5770f28a78b1e, 0xdff7bbfc2de723bd, 0x0108f564d7410727,
+	 0x45969f30890b99d5, 0xc0186a9854cc8e9d, 0x46c86555d95317fa, 0x44d63a997c54fff7,
+	 0x56399fc014c8d588, 0x815f1c3aa27fa8dc, 0x2ef5151459fa3196, 0x2523beb870b5de03,
+	 0xca866ae79001103e, 0x23b0a3e33101614a, 0xe2f6781e7c3af2c7, 0xad6ecff7e8f1b6f0,
+	 0xe907dc79cd227649, 0xb9bfee3a767f341e, 0x52f4e88c1a65c652, 0x72ab2d59a84eeb1d,
+	 0x1c71d35f05521fc1, 0xe0f04ef0fc639e00, 0x209df7fff7eb9b75, 0x0b349325753c2752,
+	 0x54c3ea51d7095f22, 0x7bf8c3b19c995fa0, 0x3cb17dca3a597e4e, 0x9aeb4c7f313c8f65,
+	 0x7c530c43769a9ae9, 0xaee10f7a2a6ca664, 0x2c30e6316fd3e0b3, 0x2a8ea170a8940b23,
+	 0x696bcf839e12085b, 0x8a00124ff2196e21, 0xe888ff60a1e8c0eb, 0x0063a22e8edb57f2,
+	 0xd7e37b98c43b1063, 0xec7200feac74b014, 0x62b47b55fd113591, 0x1eb379ec5978619f,
+	 0xaf8a147d83109c51, 0xde190132c27df681, 0x5d7918710195645c, 0x3d7e2ad9b7ed97fa,
+	 0x5b7b2e44f27deef1, 0x73f1a09d5580c023, 0xb0a095cc082f05c6, 0xaf9ea5c98f74db57,
+	 0xf804e52bf0e692aa, 0xab0f9c759264cbf5, 0x9d08297895355e27, 0x6ffd5cdaa21bdbc6,
+	 0x9d509673e57bb265, 0x43057d9b9601a30d, 0xd65d75f493e351e6, 0x0dd0508c5ec15efb,
+	 0x2fffb2fd17c3f7d9, 0xfa2e942c6c38cae3, 0xa8122ef9295e17c7, 0x469416ad42d8bd7a,
+	 0x9a49157d35889b11, 0x7083dd15df733750, 0x8ab03a8c7ba9123c, 0xb30e4df4af4339c0,
+	 0x4374bf4edd32b904, 0xae72f618660abce5, 0x87e1d8b41833ad36, 0x528d171c16e1ece4,
+	 0xf1c77653e20e2911, 0x348800c00d719235, 0x5cf74ce7191435e9, 0x063f66c081a34222,
+	 0x8a7769c655fda55c, 0x7a0e54f95cf18bce, 0xc782f70fb0e14773, 0x85fe22c16579ee74,
+	 0x5d696a64be0c214c, 0x7bc195d3069b7079, 0x7d635bbeed881a6f, 0xa4741ae4a70eaaad,
+	 0x0ca7373230144d74, 0x3c5a938855735ff8, 0xe2e06cde69dfb712, 0xa2feadfeceab7075,
+	 0xd74b971773b0c6a0, 0x0ce2c8fb37ff9a78, 0xc8b6f33d3897777f, 0x1d8a2fed0c01953a,
+	 0x55a990dd476852f2, 0x72e5c144d34d17d7, 0x25e4f254d9c002c4, 0x3dd5b6d7aa3e5fad,
+	 0xd50cef90d2f4c04d, 0x11ed006af84ed673, 0x5c1741caa696ef67, 0x902aee6906db5db4,
+	 0x46f5f586228f57d8, 0x0f1723e08e5c51cf, 0xa8f09a1d14e68b31, 0x443c65e3a6777f7f,
+	 0xaa5d9cb3df24ec0f, 0x81f79a6b2c526196, 0xa9d2c8a5f2a1e9cf, 0x9dad3086fc37a157,
+	 0xbcd51fe8100894d4, 0x9482178b26ef0f0b, 0x407863a151b800ba, 0x9b35d0acfcbc2c77,
+	 0x83bb8722519a0923, 0x9d34671eab794f63, 0x07e63165c808239d, 0x254911d7945b5c85,
+	 0x877622d1b3005cb1, 0x34b7d2afe6f7a7ef, 0xe60673461ef48615, 0xa9f3aeb05d705e16,
+	 0x873cd7624756b373, 0x8efdc4cf3e9cd926, 0x0f072ed54c5f1f3b, 0x9214b94f4c842c06,
+	 0x7a3014eaa8c151e1, 0xa802001a78b92a8a, 0x15e7f8296f8ab0e2, 0x018c3eae99ebc6a9,
+	 0xe6b98aeb3003f0fb, 0x96c57f53cfdf29e9, 0x71bd6a7ef6296922, 0x2e85b30ebb8e4b36,
+	 0x64733bdfc0330ee2, 0x1ba2c4dc742d03c2, 0xb3805ccfb662c66a, 0x937b56cd77169e3e,
+	 0x3c2a5b0051434ec1, 0xd123f3f8aeec629a, 0x83c03e19a1385d19, 0x4316060117cfe532,
+	 0xcd9ca3314af7c4ec, 0xbf6b0f56dbb932be, 0x3e797b1c97245e81, 0x605196664ab59576,
+	 0xa854429dcfe7160a, 0xa74778209488e868, 0x36135dd2a4e19085, 0x8143ff80da076807,
+	 0x40612e3b270de03f, 0xf82db6f8926dda48, 0x0ef2ba89c2290f40, 0x7c12a370a4cf8054,
+	 0x5e65bb7f9f0b5a1c, 0x8cccc25b365d5cff, 0x849ccf2bb30db95b, 0xb274a087538ebd55,
+	 0x39320bb91ac1e4ee, 0xe11eecc8fe1310fa, 0x713bffd2587bf9fe, 0x8df1e4f746430a43,
+	 0xbcb64e0d85d34778, 0xee0d289c2e965f34, 0x73ddf69966801e95, 0x9f6f015d18aba889,
+	 0x13097fe7f372a983, 0x199e05cb734d5363, 0xbe971d8136ed0222, 0x4609ab0f2e3acd34,
+	 0x83b742ba9e466421, 0xa11edd35d9510b2c, 0xd5f1deba5e143cff, 0x921625c9dc51c959,
+	 0x5ce2df91cf0acfd9, 0x498a00eebd4349c7, 0x3a631d58129abb70, 0x3ad58e009c14440b,
+	 0xd3d68356fcc5c20a, 0x70ed03947a4cd365, 0x0e47273306507f26, 0x36f5b04f96032b2f,
+	 0xf860c0efa7eee291, 0xf15abdb52a8106e1, 0x94f62cecf673ea69, 0xaa24ed9e879b3b07,
+	 0x95eda910402648f4, 0x8c8acb518d6cc035, 0xa52689d62e31a59b, 0x5d6cd77b5497b50a,
+	 0x8791bcafd35742c4, 0xd26cf8c58541804c, 0x075ad1ef3644f700, 0x191b6a84bfd7b520,
+	 0xc3982901d2fb33ad, 0x97bb218e4101e77c, 0xb79b408a3320ccca, 0x121e875a9e576470,
+	 0x4fe752628bbdbb5a, 0xb3a691258b8c2467, 0xdf1140b0146f777a, 0x802b9b6425b7bb29,
+	 0x62e267e5fd620186, 0x2af367c21da32478, 0x78b1df7a31e48f07, 0x16512c6cd2caad23,
+	 0xf15fa2c26c38654d, 0xca1bdd0b06681412, 0x00a2e9b11035b32e, 0x80f7093bdf50f726,
+	 0xa357557f78ba50cb, 0xde6721ba071e321c, 0xfc0f2c0cd3bd0a77, 0x9222dbe83efa02e2,
+	 0xb2a6e6b189f1863e, 0x60b944c612f2b041, 0xe05f774d3301b350, 0xac04ae33744fc367,
+	 0x898272809973d9fb, 0x481b256ce294bcc1, 0xe2fbbc97ed8dbe7a, 0x18384bd44e9bab7b,
+	 0xa3d977436ec6b764, 0x1c989c5de687269f, 0xbad69358a7b5292c, 0x6fe1d2dcfe955614,
+	 0x22f4bf4a35e0d47c, 0x34fbf2fcd099e7ae, 0x5f028c8c4b84da3c, 0xb1ca224b53871b37,
+	 0x00720c35e2380470, 0x31bf2f5a84b3c2c1, 0xdf527d1b036f1820, 0x909b5173830e3b4c,
+	 0xb1feab4bb1e20eb3, 0x6a409b67246bcbe2, 0xe84126a0c8614457, 0x8a2d2fd437985876,
+	 0x7ef22d296d767e78, 0x9de4a08d0d1f3c07, 0x3091071114dc4193, 0x5db94450f84c4aed,
+	 0x77b83786e36c8059, 0x9c8698a3387b413b, 0x8f34b2a30bfb27ec, 0x30808ca80aac52fb,
+	 0x80d197ece5780309, 0x900d2ce0cdeb60fb, 0xc2630dcc31678dcf, 0x5e135884d6246d31,
+	 0xd23805599b5b8e6c, 0xe180d85ca9329949, 0x8e84fbf25ee6364a, 0x17cbfe17fc4ff1df,
+	 0x46a0f3f2ba0b31b1, 0x119959efa24bf8a5, 0x10265e4c0cd0dd93, 0x5e91516475d798e8,
+	 0x16089746a70ca80b, 0xb0e928def3f4f9e2, 0x76d067a27bb12d63, 0xa7c507ce2fa27c47,
+	 0xd1a9c142d7553396, 0xad89f44515b2c701, 0x009272679df0dca5, 0x7c08e1a26afa7a19,
+	 0x15e330dbfa268d8f, 0xc796f7134441fce0, 0x2c96823fd3c58743, 0x52e2582f6bc3bf7a,
+	 0x5a66f709d0a9aea9, 0xcf6118da76561b3a, 0x73eeb37dd9f64f88, 0x4ab29da4e6f18588,
+	 0xd531a0b2c21e7210, 0xf4c8a6b72f9184ba, 0xd60ac7f5fb31f3f6, 0x04fe95efd64aff39,
+	 0x1fbbf40e416d207f, 0x59979f42d53931c5, 0x4c9fda49af67012c, 0xacfe5ac25b6c68a2,
+	 0xa9b5775da8a55415, 0x262f8786f62c5467, 0x7e3addc5fea8732b, 0x9b14a50762e01380,
+	 0xba7d26f5c113c4be, 0x468305f801a3141b, 0x845f4df847f9417d, 0x9cf60c620aa44af8,
+	 0xf6b7c80630803858, 0xfe35fe78e8a15bee, 0xddbdcaf162a82061, 0x96e155f990d324f6,
+	 0x547260a0912f563d, 0xd825eef34b59a843, 0x3f8523138a7e40f1, 0xb19a626625e7a69c,
+	 0x408dec824ddb1cf1, 0x85ab27cabb39a250, 0x8a5cb002a5638788, 0xa931e2ba3a18b6e9,
+	 0x5cd69a37ee9174f8, 0x0a9dad3c642a0c44, 0xbf38be72af4e947d, 0x0d2014fcffd4e2d5,
+	 0x3064739dfefcea08, 0x3f89f0f6442e6808, 0xcbfb210a3c731090, 0xad2306f95cf00bd3,
+	 0x8ee0a0e7fbfe1501, 0x85c46ecf1923b692, 0xb37744905f2eee3f, 0x21591453e3e60d1a,
+	 0x39f1b330a5d59486, 0x76c454cc625b38fb, 0xf9a81bf3ae41b75b, 0x8e98e9b938493f04,
+	 0x3bfd41a71f5b070f, 0xb3e978bd0c2a9c50, 0xdaeedcf8d02fcdd3, 0x715145a0fac33c1d,
+	 0xe5da7a1bb853208f, 0x53bb16293d9cc8a9, 0xd971718418baac94, 0x8fd1884bc90fefaf,
+	 0x08dd464040fb53c5, 0x8029d5a813085684, 0x8a423a184bef30e0, 0x24a5b4cc14ecf6b2,
+	 0xc02a00ca0cc63015, 0xe09d6339e7a8f8fe, 0x1dd40a06efa89469, 0x27edbba9492a6c75,
+	 0xdb5d195be0f49250, 0xa7bdb5d8631a24f6, 0x501c9c84802f3cde, 0x318fca526c8abb45,
+	 0xa098b32b40d02e78, 0x256e2a1727a483d4, 0x997cec9f349ee2ce, 0x53d3b18813fe397d,
+	 0x25d27622329686f9, 0x333c7b162cb0f97d, 0x81c9d3252dab0017, 0x33b6618abab3e4c3,
+	 0x83916989e92ae916, 0xa6680bc06ae33f74, 0x0ca12b503acf8f68, 0x1328c6177eb5498a,
+	 0x54a5a3728c27af44, 0x099f3f33d34c0255, 0x83780c0150a23a91, 0x8346ff4d19118ff5,
+	 0x0fbc06e675809402, 0x1bdb4aba394da382, 0x4069e13b75c9cfb8, 0xaeac074b5ec799df,
+	 0x75d29aa871eae3b1, 0x04e4d5536f43d47a, 0xf1301a4c7b0cc483, 0x391d9a8e4f9f04d7,
+	 0xed64fe3ec88a6092, 0xc2c0d77e2e87e317, 0x77b058b3b2615f8d, 0x2e6988d7528f4087,
+	 0x8b1902ed058f6377, 0xb41fe6678f7ec539, 0x83e34abf5c9299d2, 0x2221c38e6151bfb8,
+	 0x0a41725229b83170, 0x7590a3371e6f6072, 0x852b5c8f7e25ffc0, 0x0d4106bc306cc022,
+	 0x0850ecf3ff380081, 0xc656f96b247286fa, 0x16d9045cee8cc8f5, 0x9251e40f4dfcdb4c,
+	 0x975476146ed5654d, 0x02ef4cd3484dc536, 0xc43f84aafce860a8, 0x0bd99974233db901,
+	 0xbedd6927f876e2e4, 0xe72dbfc50b2435c9, 0xcdd10cc147790154, 0x7cbd6788c889da8e,
+	 0xc37cde2b162452c4, 0x85064aacf085eb89, 0x2d39c97675e71b36, 0x2e6109e8df843210,
+	 0x259105e3865f48ed, 0xc636d3827fe0d31e, 0x5d76f68c3b7720ed, 0x29c6307e44bec982,
+	 0x5e1deae86b9c7706, 0x67357806c903821e, 0xf4422e5145fef799, 0x77b3aaef80515166,
+	 0x07fd09a39ec89ca9, 0xb13fc9461376d490, 0x49e19e9e5f3a0898, 0x520c524ee8816d5c,
+	 0x4aa68e9061f6a76c, 0xff2c7c1d4487eb4e, 0x158809cfa8955e16, 0xa828f0388bf2f9bb,
+	 0x89a8e0457651d94d, 0xe69aa9fe40a999f2, 0xcb777ab4486ec869, 0x20b59f4f7dffddd6,
+	 0x9e65121905664309, 0xc48a8f07398f8ce9, 0x613fb00903a73f75, 0x02b06811060ac3e7,
+	 0xfa4afe8cf2e990fb, 0xa38b9bd825739e6b, 0x85a3c69f92257f37, 0x45962426dbd02bca,
+	 0x80422e5c2d4d6fe2, 0x92239f3971e42a1e, 0x9191a9eaaf067c26, 0x886c6cdf3f6f9f75,
+	 0x8af177b6b82bdbc9, 0x97a8deb830b705c5, 0x4dc496fd535cd97c, 0x9f5106e2b65d46b9,
+	 0xac282e7cb1f87bbe, 0x47b4507cb528491a, 0x7d453d13a4b45113, 0x01ad617d77e12f16,
+	 0x9a38f9894eba4036, 0xc05d558b60765fc4, 0xad0064c4f8efeb61, 0x4651fbcc4631e607,
+	 0xd399911cc5d520e1, 0xfbfa96aae2b03afa, 0x84f88f8749d47aba, 0x6867e8d10615acf7,
+	 0xabe9221fe9f72cb1, 0x0b96eb192ada45c4, 0x1d656dd976a9c74b, 0xa8af7c6d0a9c04b4,
+	 0xc907b07444e7797e, 0xbeccc579c48e5bd6, 0x7c92f7215e64871f, 0x9a3f10fd4d32ad81,
+	 0xee22e3fe432ae112, 0xfd105423ff99687e, 0x3b4584e9001fffa1, 0x87ccf3cd7a3bf2f5,
+	 0x2c67d8fe7da49539, 0xfc268dce5e67ba07, 0x07dffe1cac3f38f2, 0x5e0bf9932250f8ba,
+	 0xf85e2ba0bfca9077, 0xd9a3f5441b387f65, 0xf0bc7ccf45ed0ce0, 0x9a689920a3457fb7,
+	 0x6ed2c733275c8944, 0xe23d4da97f1726e2, 0xd1a9c5eca8067b9d, 0x34e442ca9ee432d6,
+	 0x80605b05588c0494, 0xc0769951805ed101, 0x26d35a50b8eece11, 0x719a5f32968e3bde,
+	 0xa33e9782bf91819f, 0x37f94c493630b98d, 0x51229c8140159e68, 0x0067f659257a2a01,
+	 0xb194cb6fa65dca3c, 0x89e4a60a3bd8c20e, 0x9740b14469c2c6e3, 0x4eb3e763fb686cb1,
+	},
+	{
+	 0x97d6ffd857ff6d5d, 0xa0f5fee637591854, 0x6ec6ca1e5749e61b, 0x8791c2149e96a1bc,
+	 0x38a63c4c9c4ce9fb, 0x39ffbf2c27be5e89, 0x96a543728f1b47ae, 0x26ddabe00a7e1e56,
+	 0xe56be7428cc35d21, 0x6a72b7fed695ffb0, 0x97b9576f640a2d75, 0x54d116bd8347bb22,
+	 0x3bfdbbd1e1c94d48, 0x29a58ed074783ab6, 0x3a513fc59cfa8905, 0x6fac9dc351e633f3,
+	 0x923484a0ba24fcb8, 0xbefde60a7d1a9193, 0x57c36c023fd8c6d9, 0xb19366457832613e,
+	 0xad6e079436ed0281, 0x0878db2afe757d7a, 0xb5bf1685d0793320, 0x5b0c80eb4b7bd1f6,
+	 0xddfb38e88f3f0572, 0x5cb636a15ce25e05, 0xcad27714969a9306, 0x649258f4a5889805,
+	 0x32c7ba5b4d291e29, 0xa1d9579b1674ee5d, 0x689452cdd349c905, 0x67df9a358ff6a4af,
+	 0x307b257251c9ac1a, 0x326e72d7a0f736b7, 0x5463fea6aad2e187, 0xb1727cf0d49e5f31,
+	 0x2547c427cfce7110, 0x6ae36e01f18bf741, 0x83b53972598ca00f, 0x90acd9daa32e89c7,
+	 0x2455fd529526c664, 0xadf9be75acd5c936, 0x2a345efde685ccfb, 0x74878fa2e4d6e309,
+	 0x1e365dff0202491e, 0x4842e2c65b182c63, 0x827f026c568e46c4, 0x057d80e4811cfd1c,
+	 0xe1299d6bdae25ece, 0x41a55d67d5bd57d6, 0xbf2c9147b196f9c9, 0x6e9a5071677ba074,
+	 0x0d2312656397ce51, 0x9ecb80a3008e7ecf, 0x42b11512572da917, 0x9973dd7af418436b,
+	 0xd0649f21aee4fba9, 0xa9eba738edec24cd, 0xaa384a77f4718785, 0x2ce0e267629b3060,
+	 0xe220e909d00320bf, 0x91c2a084948c5e64, 0xb0ae5e6785c5397e, 0x539fca31609e54f0,
+	 0x141de98595054bf5, 0x06213e4a6267f751, 0x148466050eb0652c, 0x4c86cf2d280c5b6d,
+	 0x955e9b867884ad44, 0x16d2fa025d0402d6, 0xad69adea0d624abf, 0x715ca5117849deca,
+	 0x531f76246786b58b, 0xcb3f34f46ea8e92f, 0x7419cb4833c301fe, 0x4c3a26d8e78b9b1b,
+	 0xa4c3b8bb2c3c0b7c, 0x0de5a3f49dda41d0, 0x9429d552057cc3c2, 0xab55e692a79f9a59,
+	 0xf63f1e80989bfa11, 0xb45803edb681a2f9, 0x6c521ee4faf46873, 0x8f497910cdd3dc62,
+	 0xebad7797b7c129d6, 0xef1e7b750d17dee6, 0x8197b40b05871f2c, 0x934e2bfe819ea619,
+	 0x93b124ea98add51e, 0x6cca2e15e88712a8, 0xa571b2663d6648fc, 0x763d96ba7623304a,
+	 0x8fa13a585f848a9a, 0xeceee20d8349c87f, 0x66d88dc7ab00f79f, 0x278835b5b36f47f4,
+	 0x2b042f32d17b280a, 0x006b0175ed3a325b, 0x62aa47379856decc, 0x766aa232dcc54fee,
+	 0x20f858c23c52e931, 0x79ea963cb80efd10, 0x3c94cc2425b0befa, 0x8e726aa56aedc79b,
+	 0x12c5e97ad3042977, 0x520de96691ae53a4, 0x5b39560e13d02fa0, 0x952a25b94b39542c,
+	 0x22b6d14bc15064f8, 0xc0449ca48eef52bb, 0xcc83b0f698936617, 0x683941814f6e9219,
+	 0xd7f62fcc4e42aaa3, 0x09efbbf668890fef, 0xd3af66d67bae991c, 0x38cc384da68251f9,
+	 0xa81bd9e98902cd04, 0x9419b1a737d45fd0, 0x1f3f27969b1883df, 0xa228135636cd34ce,
+	 0x9af0ca1e6d9b4e85, 0x4eae8fcd1ec058d1, 0x1e972d60671a8bd7, 0x143573b789b9bb3d,
+	 0x25b72dec7fb4223e, 0xecb9d3e35cd54e39, 0xca4d55cb7d4c5e74, 0x50f5119a9a00d82c,
+	 0x42fefb51b865a236, 0x57aa31f95d44ddea, 0x0d8bf0b16d2ca4db, 0x5e2e5a60596d3b8d,
+	 0xd600fa8c55a8cd7a, 0x54424a70751d357b, 0x4586268196a2c56b, 0x4814b31e9399f972,
+	 0x851d961d8ea5af79, 0xccfecb2ac57f5639, 0xe46c9068c3fa47a7, 0xad0f9dca70798e6f,
+	 0x9776e291f38590f4, 0xabc1efb69790d482, 0xfc464e694986b98b, 0x8754298e92b5cedc,
+	 0xe0f9c55e2dcbe2a7, 0x2015d88c2a65a021, 0x04e93ca2dd7a40d1, 0x0308ab18d13b01e0,
+	 0x24e240319c94f2fd, 0xa70b13a4694806c8, 0x88e57a68b5382361, 0xa65e73b56f9e37b0,
+	 0xb7e53a8eeed8df2d, 0x34ff38f0aedea85d, 0xc3b580ae09d9ce2e, 0x205fda65d2ec7929,
+	 0x7ec981d995ff307c, 0x3ba212b736275dc4, 0xa98deb396b583035, 0x652b80ab5e093487,
+	 0x9970c9f2e8300f5a, 0xd009707a859f9bf3, 0xf8d80d746ba59632, 0x811b9b73e62c8957,
+	 0xdea48310ea314d42, 0x9872193c3629d702, 0x2b7d3604cdb17b9b, 0x5a1620c15096a8f0,
+	 0xee16a38c96a8300e, 0x84d9f235d7c9ef65, 0xc01d952199435b42, 0x52f4c49d2eb80917,
+	 0x3bfb8d53cf87d9cd, 0x68a93fa02879e913, 0x045da4468d543219, 0x02237e41dcfe8e67,
+	 0x2ccb6ab6cd5196e4, 0xcb3bb55dd947b866, 0xdf152019cb52d320, 0x55def735fdb2a898,
+	 0x950616600267ced5, 0x5e26d00ae7bcc4a2, 0x7adf9b896c02af29, 0x1ba2c40cfb60d0e0,
+	 0x99761ff685b0c1d1, 0x9137bab365b56300, 0x9f6059b80ea98668, 0x857a262b6ad59738,
+	 0x6ed717f0b13505c7, 0x1f14374930824c56, 0x46b51a4bcbce25ae, 0x183a67f961cccf0c,
+	 0xfb5d622d54f655a4, 0xb5d8d06d8b45766d, 0xe83cf6c7f3556392, 0x002d083049abcc28,
+	 0x73517250577487a7, 0x5753137f9ad986f6, 0x192a9c0e4a0b0097, 0x60c923b836234b37,
+	 0x9d046c4294b9217e, 0xf473bc66a244c4bd, 0xea1d214e6901e6e4, 0xa72876248234cb22,
+	 0xc5534b9fa6095160, 0xbf0133c619d1441b, 0x1588bfe1c90c0965, 0x2777b81cae6cc80b,
+	 0x9445317d9eff380f, 0xa86ccd8dd56833f4, 0x28f014a373a183e1, 0x93ca43e51a1fb596,
+	 0xea6d4b96f2685ae0, 0x0f073c6594ec20f2, 0x15b07b8fe7bf3119, 0x7e9fd379731e3d65,
+	 0x05cc5afb66d232d8, 0xc968e9aed724453c, 0x0b8349dd0a20f0ea, 0x80f769663eefea19,
+	 0x175539b1385eba3f, 0x36c268b25a6eab8a, 0xff5f87495e508d90, 0x7c459746e59dc417,
+	 0x2b420729aca977a9, 0x91621d8bf370184a, 0x6adc9ae995c7de1b, 0x80db2d12b2745a7c,
+	 0x586aba9855ebe412, 0xfb1184562c0cbed6, 0x3d3022be1bc8ce83, 0x2a76af3beaafef92,
+	 0xf184839d2657e81c, 0xeabbd298490a3467, 0xa02c476494a71ff9, 0xb341a2b966d42110,
+	 0xd42811b005decc15, 0xa9b765bdfb2b9e43, 0xa48e84234d130504, 0x70013aed47b34681,
+	 0x70c6eb1f61696006, 0x97d5b74cf6485005, 0xdb66269aa7eff81b, 0x3c2aaa31b2b1e3e6,
+	 0x8518ca5676ce8462, 0x008d29e5fa0b2f62, 0x441f45a67dfab683, 0x0d04ca4d2729d487,
+	 0xc416a25841ce6872, 0x265a6bf334c68dda, 0xa46354702541d710, 0x8257ce329a0bd383,
+	 0x20ad044dc4d9119d, 0x4a13682db81cb137, 0x1fb3dfa9b0a042e6, 0x27d5f33026c24117,
+	 0xf9f1711cd25b3765, 0x4239295a7c80ebb6, 0x05351b4ab22d7f40, 0x67925d67fc160739,
+	 0x53c9a1fbe81501e1, 0xbbe273ef4669939c, 0x92132cda41676394, 0x171ed8df4f85b3db,
+	 0xd603a0c3dbef3d6c, 0xd941850e49f9d03e, 0xa79459328879a944, 0x9a8b1416e48dd91e,
+	 0xbd9a7bc487f2a16a, 0x3b3c1cf423d25df6, 0x548ca8ac0fe60341, 0x0a780236cca0ee7a,
+	 0xf428e9337c4ac738, 0x21de0f1014b82c6c, 0xaf8ed453caa9727a, 0x095d673ddec891c2,
+	 0xc953c9dae787f2f6, 0x77afabc436268cc1, 0xf53865e70dc5f0f4, 0x242661248cc69384,
+	 0x6b855e1042676247, 0x041057ffa2beaefd, 0x0846c43e98d6cc7f, 0x2677ab930088493f,
+	 0x65c6f953019d84b0, 0xa93e8684fc5a0604, 0x5f4fe0dab3659f0e, 0x75b4c61ff1f62155,
+	 0xa9f5183c62d079c6, 0x7826e2696f6a3810, 0xfc7ed09b8bfc4a74, 0x8352daf7f541f21d,
+	 0xdc2861d7a6cbddd4, 0x12c0cb25bdb103fe, 0x0bdc9abd502a531d, 0x6a9ad3f3b8ebea12,
+	 0x09338e0081970c30, 0xe065d2e09b440e2c, 0x546fd6de10b96eb7, 0xaae8f32093fb105d,
+	 0x947c526e7515580a, 0xd0e750ca07bc6585, 0x47a08d5d5800d247, 0x79100cdcd0c9fffd,
+	 0xd227d56ca2d2ea68, 0xa434e3c51b3447a6, 0xd030fe45c42900cc, 0x1a9a7f8a9f49039e,
+	 0xf52abaa3714ab7d5, 0x1be770ecaade8bdf, 0x2edfc188bb689aab, 0x5d2976d896c38e56,
+	 0xb6b6b6e4f801ec7c, 0x8534ef8526c67a95, 0xe1ec4cb91c0b1c4d, 0xa848b85ed1dc7829,
+	 0x823316456a2ba68b, 0xa36f78d8ab89d551, 0x9e30bab9511ee242, 0x3495b12c31be34b3,
+	 0xd8460f7647e86ceb, 0xd4543eb7a5a0d543, 0xc0877ab4cc3fa765, 0x956efcc7f5003e8d,
+	 0xe746cde598cee007, 0x1751d49a1d711096, 0x8794c8ae1925a5e0, 0x4529596a0c5ae265,
+	 0x8fda3aceca1a4739, 0x8aa0946b06e488d4, 0xcbf3dcefc9933c17, 0x8a7c0987ed1e6c31,
+	 0x02dbebfebf006d2f, 0x51b4244c43c944a3, 0x0c640dc3a80316b2, 0x9a3be59c3c99d440,
+	 0x7d3933021299a751, 0x8a9ebae06c62ed9e, 0x9a5c426fc7429d81, 0x98839bdda8fe1bfc,
+	 0xbcbf13c1e8dee94c, 0x4b8329655e64d000, 0xe51fe5660704cffe, 0x2e61cfb1fbcbf983,
+	 0x6a95202a218a2a3b, 0x4ff84591c8df70cd, 0xc5ab959b97330297, 0x0c5dfc4b3d1b3cbc,
+	 0x1465bdee66186a5c, 0x36e67d04f32c3706, 0x7b43f5f8413baf45, 0x2021b13197351f7d,
+	 0x568778b3a8f84124, 0xf10e7d7ac4543a7c, 0x3fa01affdc28ae1d, 0x8da0cf4b1d4120af,
+	 0x61faed665112ee0f, 0x553ba611d671e631, 0xeff067248170bdfd, 0x32a5e1a32f6e1261,
+	 0xd0e05e3e22fb3dd2, 0x2066a2ee321604db, 0x6a8c9ceb6a16a950, 0x37a16ef02aadf8e4,
+	 0x32669bf2d2ad8898, 0xf9284120c692c05b, 0x433ded676d3a2a4e, 0x6791d71c4a443d9e,
+	 0x9fe44e9867b9f084, 0x9ee711fadbd849b6, 0x122b51933249c8fb, 0x413be4ff0715781c,
+	 0x527347c0b02b9a80, 0xdaecd289bfb285da, 0xd115e1a9833ad264, 0x0cf15d6151b28e2f,
+	 0x8764448bc2dcd745, 0x4eeb277cb7359212, 0xa765a3d746cdbd63, 0x2e4134807f248870,
+	 0x43752bfa5a25d994, 0xd8f3c1d6fbdc8582, 0x2df14d2e2ba35021, 0x32a3a3b0b67f7c6c,
+	 0x3252b34c50a53121, 0x45d95565299ef22d, 0x1c352dabaa74a0d8, 0x8b6f8ef0a99ee7ce,
+	 0xc36746b762120999, 0x5e0ce8a28b68dac3, 0x42a2c313afcdf567, 0x4035ac93aa2801e0,
+	 0x47fec0d0684dcebe, 0x52669cacb0291031, 0xd857bae07d1ab0cc, 0x1011367393eeb6e8,
+	 0x2e7ea7237fd7327a, 0xb565144a9a197085, 0xe1374680dd565ba5, 0x7a5fea2762ef28aa,
+	 0xd6b9f7215f4b33f3, 0x4f3739ed4bcd3bb0, 0x99f6d2282994c7a5, 0x01797128aae53046,
+	 0x72e918f745a7c2b9, 0x4d8a3d445e7b3649, 0xa5bae25863122b13, 0x5275908a261184b2,
+	 0x2b29665f9a5c3f08, 0x00bf331152ec6bc7, 0x528f5bcba1684cb8, 0x80ace61443cec3a7,
+	 0xb69ebb383258c0c8, 0x38bfb8bd88962524, 0x70869e7be80020a9, 0x640511cb3f9bb98f,
+	 0xa5578b2232895fe0, 0x2595db28025edcbb, 0xf4b2f0748f9e804a, 0xad84503cba61d7e0,
+	 0x420400ad415bf184, 0xcd3efaca11e4ee3b, 0x8159e21678e7c331, 0x573b700b1a808779,
+	 0x1e7f868db2d0dcbf, 0x530a5bae8255fcc2, 0xa0462b8fcd680c8c, 0x3d83db1613b7e56c,
+	 0x6790fe5e1eb5d475, 0xabbfd82839720c43, 0x117dd161df456a27, 0x0c26c92ecab71250,
+	 0x050fbd09ece5c187, 0x9252efbfe1ace82c, 0x3af96b490ed8aab3, 0x873828e7a8feb284,
+	 0x9f5c509c92a0eb0a, 0x699687cef9e7d4bd, 0x0b6a69298dcbf026, 0x2c6002762066f834,
+	 0x7b6e00f4830659d6, 0xfe878485e4e5c9e3, 0x0ba8ea4b53437299, 0x60ca85da5de15d83,
+	 0xb397100a53195871, 0xf8e0ea5f1fb5f144, 0xf8abe3cdff04ecef, 0xac737139a4b8befc,
+	 0xef0b565377e1a60d, 0x7f4ec17feb6ac9f5, 0x37556746d85be0dc, 0x238285802236139d,
+	 0xc638155afa8b0fa2, 0xd067badb3417cf35, 0xb261fc3826a39e0c, 0x2079353e921cbbfd,
+	 0x1536bf213063b9d4, 0xd722786182523a00, 0x2a92d8dfdd17301e, 0x54ae30619673fa3b,
+	 0x4adf08c615069e9e, 0x7bb9a3bf1ef21bdc, 0x8423f7c66549a2ef, 0xa18597eb4b583dfb,
+	 0x995c3d0372967a4e, 0xb7bf0203d177bdef, 0xc5a1122325674006, 0xa051c953948e766a,
+	 0xc564ea12c17143fa, 0x1e2abf89273fad57, 0xd07df57e1d198f5f, 0x8d3a97f700831ff4,
+	 0x70891116b7f6ee4e, 0xba835dbd4628ee35, 0xe348d513d4ff3b0d, 0x39e5ca0884ea8b6d,
+	 0xee5c292bb06c2ba4, 0x3720f0d9de25359d, 0x33f8a306cb1d1e1c, 0x6bc0a85eab34dce9,
+	 0x2fc1dba5c56c4cbd, 0xdc382c486dc2476a, 0x811ba71d75dc353c, 0x9e01b365d5aa083d,
+	 0xd0fca937036fbef2, 0xcde0ebc5f6067691, 0x48b57b414d63a84c, 0x30ab77cccdafa7b0,
+	 0xbab3d02469750000, 0xeff812a9f3a0a601, 0xda3836cd6c36669c, 0x8d9f7eb148119f92,
+	 0x67d1bd06e0fc8f20, 0x26a58b282a406cc1, 0xa8f3d3193bb4c2c6, 0x120fe945515bfa83,
+	 0x6045f681f4119da3, 0x654570a5a8449d07, 0xdf6b942a2310029a, 0x7a19a87aa42c0ebe,
+	 0x17245006fcccccaa, 0xa8a704c1b847a08a, 0xd204900cdd3a0d25, 0x906a391f30b27ba9,
+	 0x723c84d760bcf773, 0xf309ad7f3767f051, 0x125d0535aa52510a, 0x6236cad527547d5b,
+	 0xeb899ad13a88dc7e, 0x39545c1761a67cb9, 0xaeec3e35e8ac669e, 0x4ff31290dee9ca46,
+	 0xb323a6e7d1e5ce84, 0x7a8b83c8f25d64c1, 0xfabed53820705cf4, 0x58edd7e80dfbc40d,
+	 0xc4a98932ce54c915, 0xad863aeb0c825bca, 0xcbc043828f123ab2, 0xac394fcc14fc15fe,
+	 0xd372f6382aa5762c, 0x6567bcd36c1d9eb7, 0xb82d802bdecf306f, 0x3beeb26ac719f1d5,
+	 0x7f2f9cc8ed65e440, 0x69742a558a7eb851, 0xc70d5eb22e8312a9, 0x036fd1cf09ccef93,
+	 0x00df27061f9ef5f2, 0x966fa1150f230b28, 0x779274ded3986f57, 0x1365d1d000b19d40,
+	 0xa849d545687ec24f, 0xf6c686dabeabb76b, 0x2076ba7e7326e7b6, 0xabead9c889bfafdc,
+	 0xb3af0ced13c67b40, 0xa2101a1ea872470e, 0x3e798f34a3afa10c, 0x84c1bc2a4bb33add,
+	 0x4b166a5abb6832e2, 0x225ef0f3b218168b, 0x8fd3172561acef2f, 0x52d93d16d0a6741a,
+	 0xd9fcfabbcb47b473, 0x688c6036ef077ae4, 0x2e68d10514c8fb36, 0x6f80af1f7927ee76,
+	 0x623d9ea269c344f6, 0xa11f4c5d9b5b4f01, 0x37e14e948228e7e6, 0x415d9c1632c4eeda,
+	 0xe3e7f1fd2455d7a6, 0xd44fa28057b10931, 0x681281fcf224a2ae, 0x9b9d7699aa32e8e9,
+	 0x0524b82c211a5120, 0xef79d5765b85436e, 0x8618ed510d005636, 0x2d73ab9ffa01320d,
+	 0xabc8fc7cb643a65d, 0x351c9f3b9665769b, 0xbadb8d903806de6c, 0xaa4029591ae94789,
+	 0xf17167c1c630d707, 0xadbc8871cdb7edbc, 0x30bde5e3f87f2bc6, 0x155dd9346f8c0cb3,
+	 0x58d52bd8dcd5ab28, 0x6845127b6be74ad9, 0x2e37f8b6796ee6fc, 0xaa5ab40a59f9c6c8,
+	 0xd9842b8982efc9b7, 0x1dc0f6b3dab8c7fa, 0xf3dd253a05acd359, 0x56f662b261ed9a83,
+	 0x2fdf0adfcf257814, 0xa637a72930b6042b, 0x2c0059b48396e99d, 0x5b4efad70b3f29c9,
+	 0x3664b39a8fb3b457, 0x30b826484b3c468f, 0xa0725dc2c371ce53, 0xaad1af271a475334,
+	 0x66c0847393b4e09b, 0x3a36d6ca7494d26e, 0xce0fc3112d3837f3, 0x4ac0e7e9d00a8229,
+	 0xcdd09ada2ddcb51b, 0x6d820b38d1f1554c, 0x7361c5bc046872c3, 0x316946b5f8414a2a,
+	 0x435612ac41c5eb89, 0x98095a16064b5789, 0x33f364c0f5ed5cff, 0x5d286bac88ba8e7a,
+	 0xdb25aec3908ab3c4, 0xb373c8d4d1fe2285, 0x53a8692cb4710d47, 0xae1c0a25875fe801,
+	 0xcfe0e985353f28cc, 0x9ae1244da2a79ace, 0x5eb790d896361e0c, 0x47fab20f48b5993f,
+	 0x51a8c35df11022b5, 0xd0479d689f3f47d7, 0x0e84a49ef65679ff, 0x997fd2fba53f9d7e,
+	 0x162e202c3358d340, 0x5e9b6fae83492172, 0x5d0852ac232af13b, 0x5f7d1c2b06460331,
+	 0xc5d3a86eeb89f2b0, 0x85e175a8223ad2ca, 0x10bbb3b2cea10979, 0x215860b411de9d67,
+	 0xa4197c8b1bf25b29, 0xdd1620b0a420ba0c, 0xaf6035f4e1c01ef4, 0x52b6fb913a6d2fab,
+	 0xff3fca644069d667, 0x3b64d2bcd87a8728, 0x4b39d0bff3c697a5, 0x5fce9794953c1a7c,
+	 0x7af968041f39736c, 0x452a2d91334b5781, 0xf32c7beb4809c8bf, 0x137790352630f0a2,
+	 0x70f3e0dcd9b199e4, 0x86fe3d63b24a18dc, 0x12e1328ff629ef40, 0x9a0825b55ef45d10,
+	 0xc5b154d4cc84ca16, 0xa3ac23dca87554be, 0x560ef9fa2e453f3c, 0x61e99cf5de4f1818,
+	 0xf89901fe3ccabad8, 0x30f3967a68573c96, 0x939cfb6fd123cc76, 0x2a16fd1fa64f3802,
+	 0xdb4d514c1e3f4f03, 0x24e351e23f7758fd, 0x72dd11eaa724786c, 0x4f4a87b7bfd7871b,
+	 0x02f1a67033a0c6aa, 0x793e3b93283efeb0, 0xcd425694a67cf63d, 0x2362cdfbdcd72bae,
+	 0x39ddcc1da679804f, 0xa797c975e0fa71bd, 0x8c1a2075bf4c1868, 0xad95d5d5f7ecf25e,
+	 0x0b25898f3bc864dd, 0x57b8e95a0bdf6e17, 0xcec31cc7df5f7085, 0x624274776a0e13b8,
+	 0xa75e3a755ec809d6, 0x188397db1803b74f, 0x5cff0e9e01419858, 0x0f68c86964b7a2b9,
+	 0x45ac2bd73cc79363, 0xc5e798d47832295a, 0x77f792dffc5cb99e, 0x940148fe9d5a8b23,
+	 0x1f0a3cdc74db037e, 0xf37351679c7d157f, 0x587b65030984b663, 0x553870147cd950b1,
+	 0x25d21b10f2a77bc2, 0xa5edd020c8f62a72, 0x75daa84b944aaede, 0x04294fbbfe70d563,
+	 0x09516e7420a7137f, 0x9ec598e5730dbb57, 0xc18ba42248172abb, 0x98db937317d449fc,
+	 0x02826577e616c842, 0x6950e7c764ac398a, 0x34fc6545d47c7ffa, 0x4dee67373e095fde,
+	 0x1c85c9990176de44, 0x0f0b694a80fdd9c3, 0x81327584e4233502, 0x92a73fa95c841e89,
+	 0x7deee92efc7da78c, 0xfeb321f8e7d40468, 0x833be4ab39ddc548, 0x99a0aed4eb72496d,
+	 0x9525161ce1e844f2, 0x6eb47df303b96289, 0x9b13f403f0b86ea5, 0x8a3b5bad17b4dfea,
+	 0x6af9cae76a5d79f7, 0xaf2cb923e54b4476, 0x7ca5c52a4f670ed7, 0x53b011f80263acca,
+	 0x8a89a61039ec6d6a, 0x3ca605ef288504a4, 0x03404162dad723bf, 0x4676289aa04b16db,
+	 0x707dcf0a061086ed, 0x2eaa1024c6f767c9, 0x4af0013d947213c5, 0x5bc2a82e21c23e16,
+	 0x78b1cb8e69a7d9c0, 0x23a4180a7db0edc8, 0x7100daae58c76fb1, 0x0d521668e0fc271d,
+	 0xae2c9834baa35bc2, 0xeeec487fd99979ab, 0x98b4d991cf29bb1b, 0x16f26e6486ab45a0,
+	 0x8740026bb6361d69, 0x5c925620469375a8, 0xa498b041d98c60b0, 0x04b94bbfb2d5786b,
+	 0x7057a29e2e743979, 0xddb52093d1454383, 0x4d1929109741fd28, 0xac2568d9f9f6545c,
+	 0x03de0ca3d7ca232a, 0x73a4bbc2db4fb95d, 0x8b2568d2e534e872, 0x35c00816bf99efcb,
+	 0xb4fd71ec6cd74f4a, 0x7707f6115a053d63, 0x015e52b18b10db31, 0x4641cd1bfa19e2de,
+	 0xa9e4ebf6e06bd1a3, 0x15ea97bb90da68b2, 0x51f6172c08e56b4a, 0x0210eebe9e959811,
+	 0x9bd6d1cfe9c37a48, 0x545783973c7da56e, 0x4fda99e29827a50e, 0x9920a4df5cfdebc5,
+	 0x1cf03607126fc9a7, 0xfa27531e2b5ee32c, 0xa504f976f5f238b6, 0x58b1d39f51a625d6,
+	 0xf6029967c6ccafc9, 0x6fa0ed1355432d13, 0x099a63692c628483, 0x088100d43f8e8539,
+	 0x54b8760db94c5bff, 0x6e72e5a70b55a69a, 0x86b079e189dfd336, 0x5d19cd452810e6e3,
+	 0xa0d25ab7962c8c29, 0x645e25b0cc727387, 0xd0e940b99df7dbca, 0x393a124f0969a79a,
+	 0x7a155c7ea3edbe2a, 0x2a78773fe7125e63, 0x17ba60df2129779d, 0x1be3396a8bed029a,
+	 0xe77d96865b8b8013, 0x636c5491d36f8968, 0xc232679f93726f3f, 0xab538574ce897f71,
+	 0xc6ff17a976e2ce37, 0x2f5b88fcad681b94, 0x0488ab22f3d837f1, 0x1aa9ec38d5341a31,
+	 0x20c6929cae2ae225, 0xa64cf73a247e5a3f, 0xd107957457a30290, 0xa83da667e5756a6a,
+	 0x323ab19b6866dde8, 0xe98691eee24518a4, 0x82c9c67f5a96113c, 0x80aaf135b187e9ef,
+	 0x1ccf9d5f09fa4e1f, 0xc7515e9ac69e1a45, 0x1cf91172a1c10f06, 0x662b0b572d9ca164,
+	 0xa06c49ea94a4c06c, 0x8234087ccf434d47, 0xc01b2cd4f4321086, 0x93ac3ba11f011bcd,
+	 0x2a4c945770a7ed16, 0x2882178872fb525e, 0x3beccfd9129a83ae, 0x3f1f76431cf64b8e,
+	 0x489d94d293683f59, 0x0e7b573c805c0a90, 0x53fdf7569951c9a9, 0x352c96507e62176e,
+	 0x6c77e720d4e90c88, 0x8fe7621e20e67f03, 0xc50dcb03cce609fc, 0x057e0436faac50d7,
+	 0xbea6fa245f5ba622, 0x5617014c04565ede, 0xd8525b2a36a6d10f, 0xa77a6ca132ea425a,
+	 0x05e77a98eba76427, 0xda4a1ee6d054a6fc, 0x0a34580ecc8f6e37, 0x72d0c9bb38cf2827,
+	 0x3bc7c8ff1b42b12c, 0xaed82d40b3e1ec77, 0xb64bc523073c7156, 0x212125cac8a175c5,
+	 0x9ab5197d1c9c24db, 0x8fc291b186ac5807, 0x60e916043c2fa26d, 0xb03f24ea71f1646a,
+	 0x8635173b4730a044, 0x60711679cf9aabea, 0x5511a166fb06ec90, 0x52a10d6e3d7dfafe,
+	 0xb8881fccbaed34c5, 0xb6b898c4dea85e42, 0xaa6724bd0b19f6cd, 0xb4aa61ec46fac429,
+	 0x6a44f3a2833f8acf, 0x82d20f5fa9c742a0, 0xe18e5b4ee17b72a1, 0x3a76acb26b507f46,
+	 0x61894a192f1312d4, 0x0f458a648df472a6, 0xa61935070466b339, 0x42778974bd7e4c7f,
+	 0x21550c2e8d79882a, 0xe1e54d65c96a20ec, 0x9af727829cbd073d, 0x49aebab94f0aa592,
+	 0xdd151285e8110638, 0x922bcab37d11cbd6, 0xe6ad12ac61b1b8b7, 0x5019e515625b9d94,
+	 0x8a64e2fefd23b6e8, 0x4aa8d0e671745545, 0xf5dcc1fbcb27c379, 0x11e91718dfc2bb77,
+	 0xe217dc63c0c80aab, 0xd2e3aa46fb8b698e, 0x4c6f9bcc544141de, 0x0054b210539b6830,
+	 0xc7974e4b439040ac, 0xfc50021fc3b663b2, 0x9ed7f54aa73f5b61, 0xaeae07b94cbd40ec,
+	 0x9948af03e353acb0, 0x6e1f02c07f9768f3, 0xb3746c04f671937a, 0x0f5dcd9e697b4d28,
+	 0x2cf9669dbfaeb056, 0x927cefc0a8542ded, 0x9e59f080a3b5876e, 0xa6e18fe416522666,
+	 0x800a7fc2208068d2, 0x4e1c07592677ed5b, 0xa9a987a9fe2f2e4e, 0x33fca64735234f13,
+	 0xaf6088e95a377ced, 0xd089d08b37226272, 0x5d57db92de603ba4, 0x887346cb2316a4eb,
+	 0x86eebdeb05c9f720, 0x5257e5338f7feb59, 0x9f743b5edcc3a2aa, 0x81d5d3b10601d939,
+	 0xa518369523d39085, 0xde9c6e6022bea614, 0xfb36e354342254db, 0x9f66f105ccc184be,
+	 0x340c15309bb3efdb, 0x4e2bf0ba21645e8f, 0x09708aacf7dc31de, 0xa915a5c5482afc32,
+	 0xe73751f93073f8cb, 0x693f043d299880a5, 0xcaa6266c188f014c, 0x1cfb78ab29050764,
+	 0xa1291221d82b2a3b, 0x34a3653c3a185326, 0x1a9a7a05c701b311, 0x625d36187da75fd3,
+	 0x97bcb805c3dab759, 0x7cce50103d16f8a3, 0xfce762d8a7d46796, 0x294783f02e4027c3,
+	 0xf905c88bdd32ebb9, 0xb36d820b816d2990, 0x29fc1281a242eb06, 0x6f401a6311b2e9c2,
+	 0x59d93c975abb490c, 0xe4fee14eefadddd0, 0x7ff965d46ad4bbd0, 0x167e34b808540159,
+	 0xc182ae063055d198, 0x88e001bb9fc498ef, 0x62b5c8b2edcf13fd, 0x4c201759c0b68bb9,
+	 0x964821eb0d2e5ef8, 0x3e0a8039550cbc27, 0x0b5e06acf1173f1d, 0x3ded13164264496a,
+	 0x923b7649200702d8, 0xa793fb5dca8e21c2, 0xf69af5939dd6298f, 0xaddca6fc33b3d027,
+	 0xeba6dc19aebde860, 0x8bf6472c4832e2b9, 0xa521a03774070bda, 0x9e4c1fcf84502053,
+	 0x21551ba6d847203a, 0x2350a6eedb4a7bf2, 0x0ed8db571ff81bdc, 0x52010dd958bae611,
+	 0x4a74a12fa269a55e, 0xb91beb894769dbe2, 0x1d7ebb688ac24c3a, 0x8d6f8ff6a63edbcb,
+	 0x158578bddecb724b, 0x8357036541f9b2e9, 0xf02f434d1d9b2e79, 0x319bf68d915c90a1,
+	 0xb0fee1906d150525, 0x3ac905456261fa5f, 0x61cd20f2509a944c, 0x39b1487d7d5be1df,
+	 0x1f6fcd9095cd2fa7, 0x3ff75f6c9836b9ce, 0x4e2dc80fc746a267, 0x762484b043b65ca2,
+	 0x9c74ee23d0a69890, 0x384c64418df2e6cf, 0x1f00aaa7d0973d8d, 0x07a8315c98a47ba3,
+	 0x0b118c89f6742ff9, 0xd8647891471115f7, 0x61e82c3ffbdddf57, 0x3a3a26c684956592,
+	 0x996d45e862c960c0, 0xf0e46ef9677b422f, 0xdeeaa5e3e3a4d2cf, 0x884bea996d29b4b9,
+	 0x96e4166e6580f458, 0x31c07eb5f5c78b02, 0xa5350f1957989307, 0x9d015cd78cea9667,
+	 0x3970001663075c78, 0xde3ca80ce0d2e1e4, 0x0ea5f65e68a6ec57, 0x895220d507bf0ddc,
+	 0x55f776118be4000f, 0x35948e0f4491fff8, 0x327b32c5a0a4b0b7, 0x3e891febc8ed17f5,
+	 0x3288ffaba1980100, 0xaf77afadb9ef8a19, 0xa74701a67a044bf9, 0x6a20a6333752c543,
+	 0xc7d59720a60cf3fc, 0x368d75abf4dc704d, 0x25f80848c741f3b2, 0x1fa1a485580d5f6e,
+	 0xab56571e9c2bf269, 0x41796bcf7e378d94, 0x6dfd06c3cd5a012a, 0x5c8f26639ba5745d,
+	 0x538e61bcd163bc34, 0x1234ed573c2938da, 0x85a9fcac2d797f51, 0x750bc9ab635c9869,
+	 0x7a76964e860680f6, 0x7f4f0835dc62da17, 0x27c834ea8e709c25, 0x9bef84ad2333bd23,
+	 0xf591e257bc790576, 0x19b62ddce928bd1f, 0xdf90807a2f7be398, 0xa5e02c3557218c1d,
+	 0x6863dfcd0ac1870e, 0xcda3ee02a1c8dcbd, 0x67f36635eab97b5a, 0x176328d31db59d89,
+	 0xe7cf1d1bc9130137, 0xeb966dc8a22691e4, 0xb348161f5ee15f32, 0x35e727f8a37ec268,
+	 0x83c42c7dd1176dbd, 0xecd787b730977f0b, 0xd5f8442550c2a5c8, 0x812a387cbd0a01fb,
+	 0x9886770e8d08c0da, 0x16a52ece6f86fc1f, 0xa0fbeb7353ab3a52, 0x610ac76d2cc9162d,
+	 0x833bdb2641b5300f, 0x3bee6d31b8c86f38, 0x84b3cfaf6529cb6c, 0xaaee371a0789f43c,
+	 0x266850c3292573d4, 0x18f7e772ceeed122, 0xd6b37838a1d38da9, 0x374a14769dac4efb,
+	 0x00c3483b9db6af1d, 0x6543c80cd9ca2fcc, 0xbd87ac58705eec31, 0x98da8189bc84ad19,
+	 0xec9f3216470e9247, 0xd0349a3d914d32e0, 0xe02318f655f0a781, 0x613e5f3ded9f1612,
+	 0x57f42e2444685be0, 0x33339eeffb550930, 0xea766c8baaff8bcc, 0x84b9521193a74b41,
+	 0xc86f4987b0def0ec, 0x77029e619b91f553, 0xd0e9a2b5b07001c6, 0xb59bff525785db3a,
+	 0x91446b341c8f75ae, 0x732561e7ab7addff, 0x923813ea5ddc13c3, 0x69bb6d7b10fe69df,
+	 0x7aa5ce5bea8506dc, 0x24b72c16173e4881, 0x3d7b8902a0b240b4, 0x9a0423b49f0b2308,
+	},
+	{
+	 0xf4a1bc13665f5416, 0xc00b92ef5f7ee5ed, 0x175f55508b582d61, 0x5762f7353a97e3da,
+	 0x0ad637b82cf8f96e, 0x4a15247d8406df4f, 0x1bb4bdd4a595fcd6, 0x79023b8bbc72269b,
+	 0xed0a15e4925ba039, 0x94c8a55ec86f895d, 0x25bd3cdbe2fed828, 0x7fe339499c0bab88,
+	 0xb9ce9139f61a290b, 0x79e41a7b94ccbeca, 0x1815c615468d4849, 0x96d3abf273d2c0c8,
+	 0x0a8185d8d905473d, 0x802a228ec304467a, 0x32dd414e922af83a, 0x88733a5a8b32fb7a,
+	 0x8accd56bdc8e6d07, 0x3b66c73c38a7c64d, 0x7413c07ba5550e43, 0x54138dee6e352e9c,
+	 0xa7e56fd7ffe23375, 0x2ab0e9d57f0e968f, 0x86a94da9cb9dc979, 0x5bafc3c108ca0c1e,
+	 0xeb1bc3f1d1a9dd90, 0x315d962693d176cb, 0x10b3d35c2e3172e5, 0x8d913a4b788505cd,
+	 0xa58bdedbe4832300, 0x4f37b95e67370459, 0x47a5c537890ab8b0, 0x7e879a8c51b519bb,
+	 0x3f7a19114ab1d01c, 0x2e8d58722987253b, 0x4b8b3cc7913b5388, 0xb433b4d89b19c799,
+	 0x2f3611a331d4a948, 0xe1aa92a7b1e0c13e, 0xf5dcd88a69191fc7, 0x35f2d245c3f017aa,
+	 0x2d7c28581d278698, 0x85f47037ae890375, 0x284f47e48463d656, 0x49fb92ccd3321e9d,
+	 0xbce7c3ce5cd522a0, 0x4aa4db01b217a5a1, 0x8973dd313c644d01, 0xb56a8deeb8b8e7cc,
+	 0xe56376978dd21ca1, 0xe920e434b770a15c, 0xacb817cb45217ad1, 0x7ffe03ac774fa264,
+	 0xdaef70987bedeeea, 0x370238e540985f6f, 0xe48bae325c221df3, 0x6bbbfd3c7add0f89,
+	 0x195f22227804735d, 0x7896b2bcf42ab749, 0xfeaeb1eaf32bec8f, 0x6a9fd3a3af6484e0,
+	 0x252df507eec3f526, 0xd4788aa3de336fa4, 0xa8a8e0dec105c411, 0x61d0818d2a0b9d2c,
+	 0xc5671469cc8cf65a, 0xf91cd885bd803a46, 0x665b13cbf157ca71, 0x64d74ad48efee4e9,
+	 0x9f39bad6d210aff6, 0x7fc757427fadd6b1, 0x42b2777ba9c43360, 0x1851380214709b6e,
+	 0x6dc000032fa6f49c, 0x967e879edf72aaac, 0x20b80c55710370ae, 0x8e7603cbfff318ae,
+	 0xbab45c66609794c0, 0x12b99e5ee747a00c, 0x0daa17819fb12f7e, 0x4e5be0fd24e31092,
+	 0xd783d75e9387e81e, 0x22f32921636ab179, 0xe426c45366c8e46b, 0x382799f3c988fc10,
+	 0x6348fea7b46e2ed1, 0x2c03ee005d09deca, 0x875c955a0cc48c6e, 0x08b2636cc89e491a,
+	 0xc70d40de94bb52c3, 0x4ee51aa2e292182a, 0x6d71fa62732a317e, 0x811ded62058ac077,
+	 0x347c2cae5cfbc2e8, 0x880e9d82e8e24e51, 0xd7a817bda3e05d45, 0x88cec9dda80239bd,
+	 0x3a06c1d27dab4d09, 0x03920114963dc970, 0xa405a4c4124bfe31, 0x06a87663aae3f4f5,
+	 0x4e2b11e88a92a103, 0xd2c720b719df9cb9, 0x3dab733145290589, 0x75f2d3ee7856ead8,
+	 0x879502c23785bdaf, 0x240c64379c23a0d3, 0x0628f6a9f8e4373d, 0x14f9d2817cc006ed,
+	 0x2a7bdbf7d6d1224b, 0xa440360fd1f548cc, 0x072e091af0ed5bd5, 0x252accec9a93f878,
+	 0xe32af41da5b0a8b4, 0xc7d3707bac1f1920, 0x1b0ffa1a75133cef, 0x8c455e7d4d129e52,
+	 0xf920fffe4a4740e2, 0xf5707ccd4bfb348b, 0x9b3490987713c91e, 0x2064f8056069d14d,
+	 0x49ed2d8e751fe4ab, 0xf822cc6f22e30413, 0xd93bffbc297c25e4, 0x705f32147082d719,
+	 0x7546a74dd63fd955, 0xaa35ae6bcbef47c8, 0x993886824063d47f, 0xab89fdb2bf1bf8b0,
+	 0x790224eacdc81afc, 0x8e28cb0282d045bb, 0x34959a43bdae0a21, 0x86e6a25cb148d263,
+	 0x19792730aa14a34d, 0x46951db7945e8909, 0xf417c6e570c7c5cc, 0x786ab742776084d2,
+	 0x0c577e23b712d4ca, 0xf7299a6749169b64, 0xd43b62ed5b443daf, 0x41ee9d581bd80c44,
+	 0x3cfc881f3249e018, 0x514969996853e523, 0xf3a41ef0c3fc1e75, 0x84f7995ad4aa5069,
+	 0x4a66617441a21ae7, 0xf6728a880929ec02, 0xd60d72d410044eb5, 0xa908d81eb32c29b5,
+	 0xc4ce15932207667b, 0xa86df4bec5bdad97, 0xfa5ea7bf878b27d2, 0x5a8743d87cf2c006,
+	 0xe99eb1b84cedeb7b, 0xb50976ea501abbc0, 0x979028a4033f85d0, 0x53f4918be27d02cf,
+	 0xe355143d239b26fe, 0x40f02578c3010673, 0x93bead37a6721a80, 0x17f05090def59ff2,
+	 0x0eefb0b5ff2b3af0, 0xce0cbb47a5c8ee31, 0xfd9be064836f342c, 0x2816f76434296619,
+	 0xb87f183818442554, 0x4699e4585daecf78, 0x4ebe6d2947fda3c6, 0x70a817f936400dfc,
+	 0x237e6296557391fb, 0xef7bba82ff99fc80, 0xfd2269a8329f50d6, 0xb634694dcd2700f3,
+	 0xe960dcbd74c1ee1f, 0x858be0d9a0d8ae80, 0x40cc62eac7c9fe1b, 0x11a4b102e48f1562,
+	 0xbd0d5effde389523, 0x50840f204ea2aa22, 0x2ae957531e1e5491, 0x745ee41ec93b6087,
+	 0x9ebae87a343cd08d, 0xe24452f9ff9d193e, 0x43f32b385b90fc99, 0xb2afa5204d437722,
+	 0xc3fdbee77163ace6, 0xa1e9e3bffdae75b0, 0xff75f91cdd62aa26, 0x50a14c2e878f824e,
+	 0xa247aeb7d0af6e87, 0xba36b302236167e5, 0xa6ed97c99fcde5c8, 0x4a26e2eef95a14ae,
+	 0x7102bd369aa821a8, 0x2bf4a242dd16b6bc, 0xbfdd2e3fea149428, 0xb2df7087048f45bd,
+	 0xf8c70e44186dad22, 0x6ba70e1a69c2f63b, 0xedcee4663cb608b7, 0x99fb7faa55836641,
+	 0x51f6b0841112a0ef, 0xe1b9a137f9d93386, 0x12a50b6ef5649586, 0x6ee128b02aa6e0f0,
+	 0x5955575360e7f749, 0x5934bcf35bb40e84, 0xb62c8cf28c745ee0, 0x4fc88b019b10484a,
+	 0xaef0fe739bf0e488, 0xef66d01d26b9eead, 0x1c7bcb1ede34bd83, 0x1a48ff12a02a6bba,
+	 0x6a555cb583561b6f, 0x59be5cfb9c543d3f, 0xfa86e3b7af583bfa, 0x66f40732a8f4f708,
+	 0xc8cbd834df6f47d9, 0xad08c2c6eb873eb2, 0xcec28d849018ff63, 0x38868c69cf06dc0a,
+	 0x7ea5ff6b0c30eee1, 0xec41eb494ad3cc0a, 0x44c03a70ac5cb92a, 0x4c49fb45828bffbe,
+	 0x4ecb8aebc3fbf775, 0xce2185b9812038dc, 0x5330eb5e81ab7cb3, 0x7a45f52b5ff0254a,
+	 0xa614459c2fa977c6, 0xc0b7dc7a486acb3b, 0xb7411bce36b2e359, 0x7ceddb85da234aa1,
+	 0x83b8e2e2b117fed6, 0xbcf4e76fe6292664, 0xabe061416ce9a642, 0x5bfbb87c16878215,
+	 0x480eeb7c4f5225c0, 0xb5763373f361f69c, 0x8032a47760bdeca4, 0x1c56d757452b04c1,
+	 0x193457fd306f3f5f, 0x6a393edad6aab324, 0x78f3a474c2f826a4, 0xa9df4672ac1bb0ec,
+	 0x5c23466007ef345f, 0xe8a4dd1595167a67, 0xa2d9a0b776cc84d6, 0x32a2d6986b306d36,
+	 0x113bffca3b7b8f8c, 0xd9531fedc0e2f67a, 0x978aa9cfdadeafe6, 0x77f0cc3a8372f5e4,
+	 0x943e0d41bf1396f6, 0xd3fb978d2e2ce0ca, 0x279381dccbc814b3, 0xa35d048f0d7e80c4,
+	 0x94ff2dbd38a44ed0, 0x0845c9cc80a43c82, 0xd8b53145a8ea3cef, 0x64c00adf8992f261,
+	 0xed65abcc907f1e96, 0x820ffe27611225d6, 0xc6e09f66a6aef6d5, 0x48ac1dda45005df6,
+	 0xe450828d5fdb8e20, 0xc2a4d3829a295c96, 0x810401140521f9e7, 0x7501ef4f6ad2e746,
+	 0xac4268f584143945, 0xdf85913ed0a80de8, 0x2d1233aa6257c61f, 0x2c399c871d28a5d5,
+	 0x3a1846e9b874cb06, 0xd44103379b83075e, 0x89cbc93e00249298, 0x41d85401aa63d3df,
+	 0x6f0a6441813dcd02, 0x1b28d52b05669ee1, 0xd8f7e873fe63547c, 0x2a6d5dda01bce6e4,
+	 0x892413749c42c764, 0xb247f68bba3fee8c, 0x1ca2b30dec4860dd, 0x379999cf3971f169,
+	 0xef40ca0da80ada7d, 0x3c914070f5e1c3a9, 0x878511721d0ff8cd, 0x5c57703a66b6e5c8,
+	 0x81d43a9b72f19a4b, 0xea3465381f6b2614, 0xd887e1879996a0ea, 0xa6ce8c0a6f254630,
+	 0x46a8bcab574272eb, 0xfebd7e7640247b9e, 0x48cc910c2f6cfc0a, 0x308138fe0ecb2bde,
+	 0x3af792419911cfc5, 0xdbfd8d46d965baac, 0x47d8ca758fd6f7bc, 0x9a0e92982975889b,
+	 0xb8e0c8da009be04f, 0x1ba1c0096d5f1f91, 0xe0c8b97377159925, 0x6f858b4f033b4d5e,
+	 0xfdba19f9fc625a35, 0x92865934ff87ac05, 0x30c40a4527b1314b, 0x5c01ea4eec878b88,
+	 0x7b23eec989aef4b5, 0xb9a9cadf4758821e, 0xcbc9d9889eea0123, 0x201b1bdc102f8585,
+	 0xa37c185abfc495aa, 0xd4c9ca93850c7a87, 0x9bf3314ba04bbab7, 0x6668b4c44eefc063,
+	 0x1d8a9f83669a92eb, 0xee571b285bfc74cd, 0xa94635c7204adb02, 0x2cdd6aac39d58d31,
+	 0xb97e284e0c4c8b5b, 0xd18917b558c6dfea, 0x3b97170c4d563ef7, 0xaacbf5c844d2d135,
+	 0xa9de47b238e20ca2, 0x8a97c7e4541d1cb7, 0x14aaa35243298f18, 0x996de6314f5cf0e9,
+	 0xd92de023024377d6, 0x81f47033f3a258f3, 0x4a3d7d36d38a6671, 0x5152acc2fb50db24,
+	 0x2303115328b88c20, 0x7e9c1e921a590ef9, 0xe6d2c77c9e6f52aa, 0x44ba02245ae101a7,
+	 0x6ce6445a4dc6c4c5, 0x3566bd14c64d8d1a, 0x3de59d78fc5f061f, 0x7a0783657e12b0db,
+	 0xc36bc9c76f535559, 0xf3ac13276d91f820, 0x1baa123704ebdc30, 0xaea0e3cf452ebcf0,
+	 0x8772c94eaf869241, 0xfacca218c003f70c, 0x907f32d850da3fa1, 0xb1a336d106f92d5d,
+	 0x0e601d82756ad59e, 0x2b24231a56da6324, 0x8b8f9e52eeefef50, 0x279ddeb6f75376da,
+	 0x3b0c345f7440754c, 0xcb26ce90647ed12b, 0xa55469ccdb73d1bf, 0xb14d8c1df131c9f0,
+	 0xe58d7d2575767944, 0x40114e6122f8bd1c, 0x4f4da25a2334c6dd, 0x8fbe3c9def2e2a71,
+	 0xac21b18740e013f7, 0xe8d501818046d255, 0x71136184da8c6b34, 0x1b868dee0e188484,
+	 0x7aaefaff2055692f, 0xa24bc9abc87b0d77, 0xd232c0c52cda721e, 0x8cc1dac483db0cec,
+	 0x63e7673a0aa10095, 0x7a2ee72860e0a7a8, 0x76637619247eeecc, 0x683b61dbf60f2293,
+	 0x9cfde7adcf767a04, 0x13f8c2adfad97022, 0x0b00504242856920, 0x7a66fa24c0e1ae81,
+	 0x4019f7cb18b9c245, 0xab2ec9f45022391a, 0xabb403fa8a0e6671, 0x157d06ebab7570b8,
+	 0xc55c1e1588756699, 0x5d94c380666da966, 0x3fff390938549b62, 0x7eb57d91591402f5,
+	 0xde6b4f736227e202, 0x2b2fbb45d8d14464, 0x8c9a3ab5067bedc0, 0x3f1460315a8594aa,
+	 0x9aec6ba994c951fc, 0xbc7efb3d0fabfe29, 0xf879afe13a000972, 0x7b47d5ed6edf8a40,
+	 0x4bbfa4084da27452, 0xe3101176d827e3b1, 0xe6658fcd2452e4d1, 0xb2b2af3919979b05,
+	 0x8229944b056bd618, 0x2f39e75b829ce379, 0xd8b120ec17aa8cad, 0x529e474380bc8579,
+	 0xb217e22c412d5708, 0xf76a94815868effb, 0xb5454188d7badeb2, 0x6263cb9d5fd611b4,
+	 0xece094d3de3a6af2, 0x65e5235d4b36dc62, 0x3d716b3b2e00e01f, 0x9df0c99e8755140f,
+	 0x8b810180d10b5446, 0x9f9c88b0eebe95fc, 0x7097339bf23efe46, 0x3c3bbf975096b105,
+	 0x1e6687a1513cc99b, 0xf5f486659c83a4d6, 0x7d4104d8837f3ed4, 0x8260291cb0c1622a,
+	 0x618896cf37485c18, 0x477f8f9998c766a2, 0x71715ee834cef9e2, 0x0d39c8f194bab27d,
+	 0x872c4404aadead67, 0x864c80d179d07a57, 0x3bae399d6803ea83, 0x1716a97f5d99abce,
+	 0xa53a31006247781f, 0x660697980deb296c, 0xb0a0ff4d4372db6b, 0x0b48d670266b9446,
+	 0xeb1e356de272bb98, 0x1ed33c79e952d717, 0x7e3b6ad8ef1d0ff5, 0x2e25cc4f7eabb49c,
+	 0xa68359439ae7398a, 0x33f2c7289ca6d811, 0x5be49e2902db52a0, 0x20de3b6344443d4c,
+	 0x10e7cd66febc41fb, 0xca4dd2f0d039de55, 0x89de24fa860cb24c, 0x14fe303f833a230a,
+	 0x4ef0c444930e0176, 0xd3b06bc0f9996c36, 0x5d297d69fa8eb640, 0x16fe5fb14afb6b23,
+	 0x4557ae5a30022347, 0x53e43e80c5a14352, 0xe2ddcf0048ebe2a3, 0x3e01a9e35aebb225,
+	 0xd72f850f1f1263c3, 0x0e85539890690b4a, 0xd4b533426e775b60, 0x542806d2e12f7c08,
+	 0x4d47dea8427df893, 0x87800659dc3af0df, 0x0dc5ac573443731f, 0xb1ca534e886419f9,
+	 0xac9396847014999f, 0x2b709e2c9c6d179e, 0x1ada2eb3ce562e80, 0x771e262c696696f0,
+	 0xa3780ad25629eee0, 0x2bda890d16b16f68, 0xbdffd6ca2f315a4a, 0x1aa27e49fbdc4112,
+	 0x8cf1aa2ad4d6eaa2, 0xe495f009025f5a57, 0x0ffe9f6b9af16072, 0x937d3a158fabcb9d,
+	 0x0ff5f7859e9d6f0e, 0xe8c40b0b12586a19, 0x0c0fe82314b04bc3, 0x632cf5c751dea233,
+	 0xaf95e63f20ba3e3e, 0x9a9c2c09f542b8a9, 0x5971631e338049bd, 0x427f96e413cc31ff,
+	 0xd859abbb1d1cd786, 0xacd5bc5989c4b698, 0x30b754fd49c41658, 0x604574645105a111,
+	 0x6eab44d44c94c3ab, 0x523dae6071232043, 0x6f416540ad25f8cd, 0x3acb6cdd3b489bfd,
+	 0xd747094f76a1c86c, 0x246164873c0f004b, 0xbd10b3173994ee76, 0x437245d5597fb406,
+	 0xc95bf9a24a71a37a, 0x742fe6fe1f6b1ff4, 0x9b93e79e2f65b775, 0x4f617a85866095f4,
+	 0x5bead1291425b6d1, 0x528266a52e9ddca6, 0x7f4305686539bbe6, 0x404d660c72aa8fc6,
+	 0xc0eeee0e516b9f54, 0x7c81f959b54b9bcd, 0xc7fada03b9fae61c, 0x93f4d6d756b912a4,
+	 0x30733d83eca74db1, 0xaac98b893bdd8efe, 0xbaae3b650d1759e0, 0x19925f4e15a690c8,
+	 0x5542bc6d42a4c7d4, 0x1e1b9db4d6660148, 0x737009d38dcabcfa, 0x4eed42250524f3cd,
+	 0x8c1758d8d7c13959, 0x382c19f4ee335e22, 0x5d4e0da301ce82f3, 0x6155f9c22f3eea7f,
+	 0x11053d1bc91274fd, 0xaae6560defdd4348, 0x653a45ab344ee9b4, 0xb476d970cd79093a,
+	 0x889dc77662f37127, 0xbaea76c1ea9a9aa3, 0xc2a66f90ae04dd6a, 0x1817ce7d38022be4,
+	 0x4b6b82ebafc52eb8, 0x81f0d78a6d1def51, 0x1c52eae869dd389d, 0x8aaa1417d5c8ebe5,
+	 0x8eb41f0245b96362, 0xec4513a818c26395, 0x19573e4c5e20dfa8, 0x126462fc33d4aad6,
+	 0x9771f0b65654a714, 0x049e77087f9bf660, 0xb484db028f71e1c6, 0x507eb8a8cd1a8ea9,
+	 0xe676889a90309ad9, 0x34d906bac1c03ac6, 0x76ee055fc021ace2, 0x25c38079c536e29d,
+	 0x72389ea071bf873a, 0x6203f344d036010c, 0xdc4188a3218fe4b6, 0x67b05fda1a43e961,
+	 0xa07da35d799d7a37, 0xfad7de9d59ccac0d, 0x5ded56effbefbe66, 0x49e4b8b7a88482e5,
+	 0xe9951c5539ceadb9, 0xc9181ac93f672f45, 0xf7e1dcbf6ef9f560, 0x410ed000e5421df5,
+	 0x26f8dfc2cac3de73, 0xe505f8c5f763b98b, 0xca0e7ead37b132ec, 0x15e1f41dcea7ce4c,
+	 0x3f867e55f9e82c8b, 0x476d8dc26cfb66b5, 0x87547095619bd925, 0x22931912c7b5ed39,
+	 0x0501c3f705042e22, 0xee85599c89c231d4, 0x262099e087d24e91, 0x5a2068b6d9629c0f,
+	 0xd3fa737ab074364a, 0x1e22a10e9f06f9b3, 0xd2aff39b975e938d, 0x4cf454c6428a4635,
+	 0x6475c3ff9bc2642d, 0xe0d53a46cd4046f0, 0xefacaaf456e1ed77, 0x8dcf4948494424b0,
+	 0x320e85ec8cc5cb6f, 0x5948343a00abe40d, 0x850dbbf1d13ff52c, 0xaf84dfdc9bf9d86e,
+	 0x41e14a06e5106cc8, 0x668f31971f5b44b0, 0x8d2e611ef8222404, 0x7713b705f5e855c2,
+	 0x4d35c23e32330ff5, 0x90c39262dd5174b7, 0xad2e25130a9a2da7, 0x452a388610d73bd5,
+	 0x79f4c1a8445ff22e, 0xbb19fb5d7645ff8e, 0xdc18920a81f45036, 0x048112014236b09e,
+	 0xdbcc6efa4cefded9, 0xcfa4386a518bf93d, 0x9a2e5f3ca5766a36, 0x001cbe5c598a58d9,
+	 0x2d5045012f921cee, 0x62069f3aa40f2c5a, 0x8a64b1c1e55c6e46, 0x454fb4889729ddee,
+	 0xea3bddef060ab32b, 0x20c3b01cdba613c3, 0x8da42b9aa68188f3, 0x646b601b36a55267,
+	 0x1d635688c4adec1e, 0x29c55f42993c50a1, 0xa8ec56134949ff6b, 0x0f6928b6e4011ddc,
+	 0x287f50e8cf6becfa, 0x157a59c8b6ac9a48, 0x64afcaa36521201e, 0x7f000cd7b43102b9,
+	 0x838009c27828e376, 0xdbd912f036fe79a5, 0xe62a512bfe309fa8, 0x469ce29bdc48c176,
+	 0xfa956cb58fe53f93, 0xeb21fb6e93eb79c4, 0x93b20a055c3105db, 0x23586970701b1979,
+	 0x9beec7de56484ba7, 0x4222c23f89cc9d69, 0x69790ebd648b62cb, 0x862357384b728815,
+	 0x018bf287d6046b68, 0x2820ca4a1031fa60, 0xc0f644c6269b24ac, 0x502ae2ee6ac2576d,
+	 0x2fbe107a52a95333, 0xa0422b65bfb0a406, 0xd3ee58d79fe920f7, 0x8b07335bda10b296,
+	 0x11b45cca336f8005, 0x6a67d31df94058a1, 0x9ecf95d5b4d19b00, 0x7ea16cf215d9f695,
+	 0xc00f533f07240986, 0xe1d0c5fefa2eedb4, 0x885e04b4abb14e81, 0x0e963047aa9f1618,
+	 0xa2089d7ff2563487, 0x396032a61d7b3475, 0xc7324362e3d8ffc0, 0x57b2b5a5c896f77d,
+	 0x31a1c94045b34edb, 0xb7a3d1296527e8c0, 0x2fa77d37609d76bb, 0x3e9ba4ead4b43f67,
+	 0xe4445f0c0e18cf6d, 0x99a6f727a4eb3a6e, 0x84eef13dd83373d8, 0x6479d136e590c2f0,
+	 0x1e1e15719501f117, 0x05137360bdcb7db4, 0xcb2eae1c5c763e2c, 0x9abaa181b2eb2c66,
+	 0x3edd776f1c10a556, 0x7bf4a8e744ea0c82, 0xc3062e8fc0efe15c, 0x6d89d4f9046d121d,
+	 0xe3b7c5854a960222, 0xfea1318b2fe306b4, 0x7b18290215003b54, 0x76f49c1a841d2b90,
+	 0x3d7ec36d241ac5f4, 0x57bbce41d3178f02, 0x19ae6ab0ff032107, 0x8e19fbf04bc32931,
+	 0x17233e12165882a5, 0x195349973592a255, 0x1ff4fec089c8e3d9, 0x0ab4d19a9ac1de02,
+	 0xd51803212698839c, 0xebb39bcf5a1a1410, 0x4077772ba4126999, 0x7d7abc1c8571423c,
+	 0xdee464aa56cce148, 0xe52ac1724db58f5c, 0x66adc8425c5efc1d, 0x0ffe7542dd0d0e18,
+	 0xb7bdbbff2e4e5ca6, 0x7d1746b2e1884cba, 0x2577893f10fb75fa, 0x6ee47ce37ce1637e,
+	 0x0722bdfa78aab1a4, 0x7d33f51823039a21, 0xec95bdf5c26876de, 0x31fc1e21f9c78eb1,
+	 0x5f3a1558a9ecf919, 0x6bfc99f68d5ca454, 0x716c660a93b1db26, 0x079c1612e11f9dc0,
+	 0xd0ac4befd043b429, 0x0cbec6f39c2f80c5, 0x0de9a4d6997837d0, 0xa776f275df8259bf,
+	 0x7f44d3bf441af8ab, 0xf56cd2e9a5ccec8b, 0x662f9cec00aeb9a4, 0x2a6aa14f0852f8bf,
+	 0x2c75371f200f393a, 0x7e4d16ef07689298, 0x289eb608b99b8aad, 0x86f46214acc97db9,
+	 0x10b31f207ed0c542, 0xa9d666d47e547b54, 0x7783a3cc764f4569, 0x01c04b2c8d7bb47a,
+	 0x05ac4167514c87f4, 0xfa83c5af9724b92d, 0x4d82f646fa208268, 0x5e953c65f002d6e1,
+	 0x36cbf8e527320710, 0xf6f014410ad49071, 0x0da4992c6c5f4653, 0x7ce762967b1f62a1,
+	 0x4473ac22c7602e5d, 0xf9bde3a7df2aa67c, 0xb21f0eff2abd01db, 0x910c2ffa653063c8,
+	 0x554a50a49ac467ec, 0x32b2e6da524acca8, 0xfc3e3feca45a8681, 0x9b6fd8334bfe0932,
+	 0x129fe8eb9a9a9ebf, 0x97fa5d6450acf3ae, 0x2cf4ab58352b0fe5, 0x89b2d4e9e54a58fe,
+	 0xe5b5be9f68dd5aac, 0x76f3b1f17af405f9, 0x71ea22a51b973d80, 0x42621546217b6c6a,
+	 0xab302964d21bfd74, 0xbd35dd8dfc3cbc04, 0xacbd056b28eebf1d, 0x1c362add38fc84be,
+	 0x51d8bc51d5cc7e92, 0xe78724b003f823ae, 0x430912c6a4e79cd7, 0x42122b2d63ee4fd3,
+	 0xf7af1b281d628a56, 0xfaec3dc5454a550d, 0xa0d031818376682a, 0x589397cb50f561c8,
+	 0xff8b77c3500a57e9, 0x30d346533a7f2572, 0xf5611a002da1daba, 0x2079f7e39e795942,
+	 0x915ae6a9a2c0667b, 0xb9422fea92290dc1, 0xac7f1ae27a8c2bf8, 0x905444700f38a861,
+	 0x1e747b3b0080fc3e, 0x69f222158ab4f6a3, 0x45cc3d2c778263b8, 0x1eae66bb96efb096,
+	 0x44289ce031187f53, 0x7494b06658848ceb, 0x90e45b3c4bef364c, 0x600e8a0bcdf85231,
+	 0x4426540537cf715e, 0x46b414a09d152749, 0x5abca8103daf8dc6, 0x21b8861bfa2abfb9,
+	 0xb6b2d9c08bec885c, 0x311f9da4166725ed, 0x8588f4ddc8250f39, 0x16b598acbadf34ab,
+	 0xf0c584658678cab6, 0x72c9c7e09e5c563b, 0x3db5ec76cbcfa6ad, 0xa1c0ebec5eaf7826,
+	 0xad22b89dd58349ac, 0xa09b1e97ae621c85, 0xa0d44bc5033e7e8f, 0x0bd5e90874571289,
+	 0x5243a88cd05ecb46, 0x9e89c02defdbeeb7, 0xaac3f37f890bfc5f, 0xb503c1435b85f3f7,
+	 0x53625f80f971ca4d, 0x7fbbf99fbf9756d9, 0x6bcd222fb60ff8e6, 0x83d52096bb1ae3cf,
+	 0x7fe321b679810d29, 0x9b63536ef3294290, 0x9a88ba8d6969e18c, 0xad4e21727bfdce3c,
+	 0x5a218584068e9749, 0x792a70bfb6fddb01, 0xdb562c681e86fc8f, 0x080c6691152d761d,
+	 0x74af0f1fc06a41d5, 0x55629319ec516b3f, 0x0d57b06693199020, 0x829fe39aa135a909,
+	 0x2121f4aa564bbba8, 0xf794faf8affeb0d4, 0x5fa2c00215781c64, 0x56484b36f970b2fe,
+	 0x0b43605329a7ba7d, 0xeb6bdc05f089062e, 0xb1bded9f55bd7a2a, 0x4a1eecc0a7a433be,
+	 0xe5870a72a9c167e9, 0x07ce8fcf325a0bab, 0x2a9da1ada34419d3, 0x94be834595412a7a,
+	 0xfad66979365d40ca, 0xc1943ad80943e47c, 0xd56aedac7074d208, 0x3be9d0ac984e496b,
+	 0xa2e7cca545fa726b, 0x44c9fdd417ac5637, 0x35a0d3dfc541ccfd, 0x77a8ad09bc728ee5,
+	 0x0849bbc37e21dec8, 0x2fe040e7b2056faf, 0xa948911548d6e3eb, 0x644494bffb0c7c4f,
+	 0x02d382aa5795f7a0, 0x3996ecb218afdc8c, 0x503ab9abef892b95, 0xa1297ca9e2c0fe4b,
+	 0x36b46f9115b525bd, 0xdd4c86449dedca2e, 0x1936aa0f4afbc289, 0x3e877ad31d50bd3c,
+	 0x2f1b950ab42cbea2, 0xfbb5773a31526869, 0xf4cc4a6fbdef6f2e, 0x8c0d4b1a382696b2,
+	 0x0e2e851a6601bd50, 0xc6d00ba74fd55f2a, 0x0c65f56c4aa860c0, 0xa0d72196e267dbdf,
+	 0x8c131cb18784a41d, 0x54fe97680ab8e3fa, 0x8ef39d006f769119, 0xa63e055c1927a242,
+	 0x8853d1f6412a8c99, 0x7c377a3df70dcebf, 0x2c758b87f24c0539, 0x3413344d805297f2,
+	 0xe4d73648a95a0b1b, 0xb35a377345a0ce4c, 0xef2d46d2885e03e0, 0xa7a3dd65c1a9d0ec,
+	 0x3a22d49a980eca7f, 0x1b6f6973558464dd, 0x9791eeff555efd72, 0x4c630f3d4549ec1a,
+	 0x22b8aa7b0c78c058, 0x96deed4cfdd422dd, 0x4520a86f1b1aa064, 0x1e68a3adc7e30cf5,
+	 0x1e49896d5e2741ce, 0x62a413dc0870642b, 0x4f3ad3acb388a12a, 0x3435f05dbc73c220,
+	 0x048c88203f044b29, 0xb7616e6fce2ad81f, 0xef3f15373be7eb61, 0x1f3807b3740aff44,
+	 0x84d89621e36c6939, 0xf001a031b7fca0da, 0x77df5ed5bdd779c3, 0x41689fff618eb1dc,
+	 0xa55c4ad1e0529684, 0x3cd62eef21b68112, 0x1a54160478a8fdcc, 0xa29de39fc1cd5406,
+	 0x3cff3fe93af4bea8, 0x4ab48460f0d32e47, 0x2488d0d0d6ae19ef, 0x34aa1b710a190a00,
+	 0xe27cf69f920a2caa, 0xfe2a616f6d7419c8, 0x0e9abc53a71f7dc9, 0x51cc4f4bd961dc54,
+	 0x76e6eb69c8e8ff5a, 0xb972a00726ae108f, 0xb698e6e624356723, 0xa55f3f989801c2bd,
+	 0xd3de03accbafcc2f, 0xa3e405e4431858a7, 0xb25356d31a8659ef, 0x21ad425ed856a2ce,
+	 0xc9e55f3aaf6d0c45, 0x07291f0b547474d8, 0xc41313cda39cee3b, 0x4ad8ee75250f5b36,
+	 0x84a662544f3a7e79, 0x32cd5620b636368b, 0x15d0bee5b6bf938b, 0x7ea10f9d92684105,
+	 0x38b6acece7dcfe66, 0x988ef354c9802198, 0xd5d5aa243ce552a2, 0x930df8848b3c8d2c,
+	 0x959bc540958ba8de, 0x05d6511e656ae40e, 0x9459fca350cd5d98, 0x50cf92189f6a5255,
+	 0xad7a21670983c7ea, 0x9b29f73c11e86368, 0x5fedafbbaa1c7972, 0x3e4d4d1aa267135f,
+	 0xc3fcb2766257ff17, 0xb643942e370501b1, 0x953ae71e984d232c, 0x86538e4430727a02,
+	 0x7619680c6ba7c72e, 0x82c1c1ed40eb9702, 0xad234d69d58cc0c7, 0x7e065fc1f1e2d33a,
+	 0xd82ad84f79faee07, 0xad855413f6e52aeb, 0x80052c91bb1e1549, 0x10d62fd67622be07,
+	 0x77cd4a5da49534eb, 0x429f81d18a785b39, 0xd73825dbb5727f92, 0x30c828da75be5f95,
+	 0x694125b4b1c852a8, 0xc4d7aef2f35cba33, 0x5d56f12189f8880e, 0x3fe28af74cb2f676,
+	 0x355f6263db73c17d, 0x6eafad2a9cdf0e91, 0x90c84b6e61d3057c, 0xa576d2deec2ded4e,
+	 0x199073f859d5be98, 0x822cd2973fca250a, 0x0438c4e23e31cb90, 0x97114cb8dd9e93d6,
+	 0xf672963d7be4a366, 0x905aec1a762887e8, 0x01c1cfe5fc12aca4, 0x2820ecbf77a0160c,
+	 0xfda0d66590bef344, 0x38cb0f205dc6127a, 0xdda65552e040420f, 0x72b44843ed396956,
+	 0xa385f12e3e653f3d, 0x4862bcad1654467f, 0x9f2381e16058442f, 0x64780d5f2c6c0463,
+	 0x1bafe746f4717151, 0x59a16373e4068b8c, 0x499873f61658955a, 0x59e633f22a16a4be,
+	 0x68f6245742dfbbf0, 0x0886271446bfb5e6, 0x534bbf99c38e3c66, 0x36458408e8d3f379,
+	 0xf262dd8cf3a45c33, 0xbcb5e78bbc871f34, 0xfd1cbaefd15585aa, 0x1432d27ffe57bafb,
+	 0x7fc7d9fb75e1e7c7, 0xa8185201c04b6f45, 0xcfbc1f3d8378d0cb, 0x4499e331cc71652c,
+	 0xe2fd7b701a4f2519, 0x5ea5ad27c1791790, 0x3b80ad063a297b8b, 0x604ceb6f776163de,
+	 0xefde59d296d66484, 0x6731094d66010c18, 0x38ef211cf2e47fd9, 0x761ed32d7056d492,
+	 0xb11aea1c70211ac5, 0xb394d39450da3039, 0x1c467e4ed458fbe7, 0x8c5f64f6cce4d2a3,
+	 0x8d898d90db4da861, 0x355886dcb3f82a18, 0xd0637a68ec644bd7, 0x1d93ef8dd65406fe,
+	 0xab88e6bf99f66292, 0xe53658ba42167d88, 0x8bd2bd21527fd0f0, 0x7ab65d17cb583b50,
+	 0xd916a5430768edf6, 0xc2eb7a5027d8708c, 0xe4de1eabad1d1c91, 0x21594067ec68b86f,
+	 0xde23ef6dad58bc03, 0xe24f8bbd518a84c5, 0x2a62555feebdcaea, 0x7e12cf9b75cc03d9,
+	 0x255f30fe7d96be5f, 0x017097ab368108d3, 0x0af9d254cc3d3493, 0x0dde98f4f0c12dc5,
+	 0x46211782ee025401, 0x4d3fb47811302fc0, 0x36359e645fd9085a, 0x9283f1c21e92eb89,
+	 0xce5941403bb92f5e, 0x1d194852befb2069, 0xa3b3e930c1dfc486, 0x9bf3b549bfd91361,
+	 0x79e4a2b01ca1c4f5, 0x5a736ce4082383cd, 0xde56ebfa9313d8cd, 0xaab40e019ae9c5cf,
+	 0x8c4acf9fed38efd9, 0x97d92d1f0d88e391, 0x294147c7c58f9c7a, 0x18ddb6d0205138e8,
+	 0xa6da1b3cfefd0144, 0xdc43ec8e9e861942, 0xa13acaa8c78372bf, 0xb13994478a672136,
+	 0xdd0ff7b33f0cd319, 0x383f286465521c8b, 0x18285bd3c4f2a845, 0x5759315059722d58,
+	 0xaa343b53be3a672f, 0xad3075b58c78a6ad, 0x8742e89e2ddde94f, 0x7557736e1becaa1e,
+	 0xc0f570d86f3805d5, 0x962c312bb78a7960, 0x685ccceeb7efa678, 0xb185deb619fcc785,
+	},
+	{
+	 0xaef87b457554451e, 0x3493bccd0c605554, 0x7dfe52244a6b8c9b, 0x668a3f45f0749aa3,
+	 0x53ca6d4e44db54ca, 0x14e3b23f82c0d732, 0x12e0c4f91affbfdf, 0x9ac14944a0975586,
+	 0xfa2d2f6b92e55d22, 0xa16af746a3c50ec5, 0xf0d551abf4e78ce4, 0x1676e9a9a9c0fae4,
+	 0x6670bca3c6af9125, 0x39b157b01cc77d49, 0x5d1df970b174302f, 0x4f2ceb2e3393d80e,
+	 0x79faf1376107fd49, 0xe7bab46bb9e84bc4, 0x46ce48b6e8558259, 0x518417791b032eea,
+	 0xa420edc48ee82afb, 0xcd1ce6ec42111a12, 0xb273cc25b39bd711, 0x45216291f5de833d,
+	 0x3026c34d3b5da7ff, 0x837ee4cd71bcacf8, 0x322736435d0efe5f, 0x254e036ded735ba1,
+	 0xef0262ae4388b80b, 0x7c3b4674e4487cef, 0xcb70e33d815fd130, 0x7ee13c4fd21e088f,
+	 0x5382713618f4a3ca, 0x5822a44feed9a33e, 0xfce8a710ea5d1fa2, 0x6f20ecec97aa7501,
+	 0xe8d909c70cbd74b2, 0x1f8f7751dd55b4c5, 0xe80562f2a44836e9, 0x429c55e58739eee8,
+	 0xb21afb8b966815aa, 0xf6b3affbd51f64a7, 0x970ab52af46d1967, 0x10b33886da2a499a,
+	 0x1ea65c17a3ee7765, 0x37337e7a6f046be6, 0xe8ac36d39f3bde52, 0x5aa40ac02ae8b796,
+	 0x282a838f47628910, 0x6076df08edfcb2f9, 0xe083c298a613a339, 0x6289c1e0add856f7,
+	 0xcb9e7f47a4386eb1, 0xd49334663e084352, 0xe86ece484caf07ec, 0x9c4902b1231a744b,
+	 0x842de5964da86027, 0x4a12ce46124b2f5d, 0xcece0c35bc67daeb, 0x21d416e53d520aa6,
+	 0x3ac10a73581d4e67, 0x1be4f7f17be0e169, 0x805c433f6c4b2622, 0x81c1889933f533f4,
+	 0xc7560d0d68cf75f8, 0x83ef534cacd3f278, 0x4bf211eedbc600ba, 0x0de2c8645ca190cf,
+	 0x784efe59a6824f79, 0xc9f702f97f5c30a6, 0x858f617f481b8ea2, 0x3f14d5dc079a55ec,
+	 0x6c989a530ee91800, 0x6d3f52b6b394598d, 0xc6e21fdb33656f4b, 0xa909790071bc02cf,
+	 0xdba0cc99a8981dd9, 0x208825494bc3dda1, 0x037892e60899364a, 0x3dc232118bfd39e7,
+	 0x47e8cd593bc41b08, 0xc82f1f4a82be351c, 0x1b24ae3b34baf6e1, 0x1fc0f5835df17a18,
+	 0xbb407e7f76ff3b3f, 0x5c3119ee7f31d167, 0x12dc1bd64fe732bf, 0x4a5a5ab60b825e82,
+	 0x0ea6ba09d76ed0c0, 0xc772e37a3103f29b, 0x6a27b7d2409830e9, 0xa5d1dcbaac5e4512,
+	 0x1b98b42bd7b8b543, 0xa47e7d8c9afca053, 0x3462801250bb0ec2, 0x70db3c7e7d0291a3,
+	 0x76f219ec1f9b0a6b, 0xb57750bc9da3574b, 0x8b11dfc9c6e48023, 0x451492556c4eee76,
+	 0xfb9f6603ad62cd2f, 0x1b545eef8db80cb4, 0xadd3f77a42363493, 0x136de7e69c5b0d0a,
+	 0x51aa3d263bc2927e, 0x04e6672677b839f0, 0x8f69c80e4e5154a8, 0x326132efefe8f1e1,
+	 0xb2bb8d5fe7f1433c, 0x4c14411687805ec8, 0x99c8cd45197af0fd, 0x9c4caf30d205055e,
+	 0xec125f481c823101, 0xe23baa55288b4178, 0xb63a66baf85af479, 0x8b6486184ebc7910,
+	 0xd522851d93014717, 0xfc172c0f9f1f77aa, 0x013c7dcebda25a67, 0x9e6ad4fda4c0884a,
+	 0x009541979c452220, 0xae7d98f54bf6f501, 0x8b0a5640bef64319, 0xab4feafc0bac2faf,
+	 0x530e6be87e8dfb61, 0x18906caa4f3a4557, 0xe07d0aae85232269, 0x6ad77ab5e97d8630,
+	 0xa17645872d2f8b37, 0x935456829459e16c, 0x66f9b2242877b8bd, 0x63046c01653e96d7,
+	 0x716378ece505d369, 0xa1ac75e73b7a85dc, 0x085780626f41bb3d, 0x9747a24e3ddf5205,
+	 0x1614af6de10a1c8b, 0x0a33b229c3a00f10, 0xa3e5ac184561136b, 0x4cdd6cfcfe478d9b,
+	 0x94c864ebd0e6e3ef, 0x3330ab337b2a6149, 0xfa3bcd7c9525fcdf, 0xb1ba77e09ff9caa4,
+	 0xf2f7f81d759d2e04, 0x2cd286fdff207a20, 0xd3d59f643da3f319, 0x70ac7802910a9a2e,
+	 0x7cd235dd135d9b86, 0xe5876c175479618b, 0x44f75905e959449c, 0x26849746f9ec834b,
+	 0xb46bc1f4e222f934, 0xcf99699e20693adc, 0x136fc3fe36ff79f9, 0xacaec779a0b22621,
+	 0x4979ff87a0a7ba7c, 0xb260e79454437315, 0xacc39a9236ef3c74, 0x286d46f75ec239c2,
+	 0xc1fce312fe1fb6df, 0x11225f49907ea574, 0x5f90489a24343844, 0xac35c75f8b5d0655,
+	 0x1828dc33f91c02bc, 0xeeae2261168f0ccb, 0x06dc968214cdf2ac, 0x5f1dbfc4253b0ee4,
+	 0xbb5cb971ca04ddd2, 0xc3a4999c794df589, 0x5644e1f7ffba0739, 0x0572897f68da13c2,
+	 0x01ca103355d4939b, 0x2fb7d3ab6b2c0e5a, 0x459c04f8a01726e4, 0xa38e00ad680d401f,
+	 0xede743b50af2c4ca, 0xc29a89f1154d9b17, 0xa0435d205bafbf56, 0x2a4ddffa5ec0351b,
+	 0x88866343b3fbff9f, 0xa6477f3c2bf49398, 0x6388a1c3c90239a4, 0x6bbda3eb34abd8fc,
+	 0xfb34d70e1124cbb7, 0x0ce64d61e35a302a, 0x9e0332dd3ecb88fd, 0x7736112bdf3e192b,
+	 0x89a6353bc0fd6032, 0xdff68f4403d02f5f, 0xc2e5851dc29a138e, 0x3453372a7d217101,
+	 0x24e457a26288a99e, 0xd83b4a173e9ef47f, 0x7b13df6163cf92e7, 0x3492c1890eed554c,
+	 0x7356e284db148fca, 0x2c49045c3276a0e7, 0x10b9d85a0f6d0b77, 0x2a37c22005bd416c,
+	 0xf795f70c885838d0, 0x580656efd1e1ab63, 0x0a5049b8beedae83, 0x901be0a3a9f7db53,
+	 0x2364f354ad467666, 0x46af36c7eb92667b, 0x47980a29bf90fbed, 0x8a4b2a1f1cc8e446,
+	 0x39c8223d92c25f2b, 0x6d22f5fee33eaaf1, 0x18bd8c588b31138f, 0x71de8053c2e60c64,
+	 0x8a497d422d158b0b, 0xfecaf4367283a4de, 0xb428c4281d518d3d, 0x6a878d925ffeeadf,
+	 0x39ee653d1c239207, 0x8ce23889e74f0067, 0x7d171e7030f4334c, 0x7295969d51ac3fc7,
+	 0x228fd9bd4bf5405d, 0x3c31854cb631185b, 0xeb0c1a5687a99576, 0x690ebe0a5c1346dd,
+	 0x833c3d7145e7e4eb, 0x3fbc0f6c55d95bfe, 0x3bee81b48c295651, 0x949859847d93de73,
+	 0xb60f42230355b145, 0x2e7ad8741c7338bd, 0xf5210b8e1fb72649, 0x26f933f63138fcab,
+	 0xa0bdfa3474764ab9, 0xbff7a71154d63c43, 0x82dec3413f641538, 0x047855549a78dba9,
+	 0x23e17531b96d1081, 0x636276cd941f5f67, 0x5d5eafbbee9fce89, 0x155447b32ad1978e,
+	 0x9a72be25a26754f8, 0xbe675b026f0340dc, 0xf1904130a65f66ed, 0xa785a8756b2c3d79,
+	 0x4ec1821b223eb85e, 0x6ad662757334430d, 0x3500efe5544099ff, 0x738e1ccb585e07e9,
+	 0xf66880f5c1196227, 0x09faf3b4ceed0910, 0x0e8c16cc279bfaff, 0x8678a17ea175716d,
+	 0xaab9fe6e66a408e0, 0xd86a97b871189409, 0x614bcc502bcd2c8d, 0x752823e04d619800,
+	 0xe4d2f348537f340f, 0xd1395a61e6d71a40, 0x78d09fff66369459, 0x2fc9380b08e73496,
+	 0x6a6778b544f17553, 0x392b3e2af926b8e3, 0x9d09b2d07fb782cc, 0xb58c98f723793b87,
+	 0x516d9fba10ef4891, 0xa969909ac39bb9a6, 0x6c2b8e016e325e88, 0x3efbd574210bd56c,
+	 0x9fda42a9670ea8de, 0x2115281bbc37ce59, 0xdfa783665b80bf9b, 0x6dca25408a5cf8c6,
+	 0x03ae12b01d2160c0, 0xd1449001cff32ff5, 0x5f27e9c64b65699f, 0x66dba2af95f095da,
+	 0x3f393200793f7e91, 0x1a07f32296ab38b2, 0x13ebe9323d7a91c6, 0x992a38ff08a1ee7a,
+	 0x75c1a3bbeda77ea3, 0x9240fe2a2f17d1f3, 0xc754b9f4e1b52552, 0x33c3041b0c611fce,
+	 0x0f8fd652718deb7a, 0xba80b21aadddfaf1, 0x7ce4d3065077dbfa, 0x62de49da1373181f,
+	 0x0187029169c2f55d, 0x57222a09754751bc, 0x691dd145178272a4, 0xb5487e59e1f96774,
+	 0x18e37926960cd0e0, 0xfdca7182c787f9b1, 0x3040469d3d048877, 0x45180942c6cdcece,
+	 0x967f65c8b128b7a8, 0xc3ec7396c4553b35, 0xba314304c4f81899, 0x6cba3a9345ba71f5,
+	 0x10cf675caf5ed842, 0x781aa0b560d2ff5a, 0x04647356ef115bc8, 0x09dea89850a455df,
+	 0x934a21aabcd75b0c, 0xd6cebacdd396a354, 0x11181091b1311fc3, 0x3d325b6b837c31dd,
+	 0xfec817330d867897, 0xf19c234ae772915c, 0x6627502e8e73d54e, 0x16cf1c1c016413b4,
+	 0x10768cd06cd36b3f, 0x8719652bfbd7243d, 0xeb40cb2d6fb715e6, 0x8b20986b5a76cf92,
+	 0x37639771facc0b6f, 0xd9e9d49b967d27fa, 0xaca683d621ba5b25, 0x236e7e5200a593e3,
+	 0x11adf37cca2049fd, 0xb9efc67131346858, 0x4a4b7487debde07d, 0x3bc705cd44cb3b1b,
+	 0x91ad93bb487cbb4c, 0x7c7266467f21c1ae, 0x4d7e47679c9b33e0, 0x10b08beb000e8276,
+	 0xa0b3af3de109d432, 0x728e0fcd1a5c53f5, 0x18cd784839df17b6, 0x4f21c9b2d3cddb8b,
+	 0xda6cb516bc570aae, 0xde425c897e074847, 0x981f27f5d4562279, 0x2cf2bb5fd5e0a2c2,
+	 0x201d91d4d3f2dc91, 0x3230cab88e2e6394, 0x1107e62465c5ec32, 0xa809deb12205f2ac,
+	 0xc233ad6d4fd55e55, 0xd905b64997e999e8, 0xaa568a482303a613, 0x18725f9b916bb632,
+	 0xafc17f90d092b332, 0xe051e45e44750f60, 0x520e656474674e78, 0x06c253fea58e3111,
+	 0x31cf5ebbde645d74, 0x09eb7da2693170c3, 0x0c8e745bc414b2e4, 0xa207709dc3dfc5e5,
+	 0x475acce4d2f33555, 0xb5bd27283de2bec8, 0xa21e6c0b15818d32, 0xac836a72b1bf8b89,
+	 0x7a9b9f9eb3bbc01c, 0x448e86071674ef60, 0xff0360a4e99a54b5, 0x58b68673351ca896,
+	 0xdae1b8a4424b1a1c, 0x61fc43f6ab46e893, 0x1d1efa8ae03f323b, 0x5bf33262d8426883,
+	 0xa18d3f217a1a4edc, 0x7aaf2bc6f21daef3, 0x5740e7324e698d77, 0x029a2cf9edd6596f,
+	 0xe309b90afcfd6dbe, 0x3636542e7bc1ae59, 0x859484479b3f82ee, 0xa46493548f0b1696,
+	 0x687b04830cdf87c2, 0x53cea2b27b25c97e, 0xa52baee6516ee397, 0x9d812d38949a06ed,
+	 0x8dd209d7ce81855f, 0x809b5e4f34c06b9f, 0x691390406aef35dd, 0x2a93da2f9c8b771f,
+	 0xadd9a0f30d047ade, 0x4d94e59b630bc38e, 0x1f089d25365b4976, 0x57fbe98494706137,
+	 0xbae516846aca2c58, 0xf3c150d4108ccded, 0x1147343690fd4b10, 0x3626bfdb41ee39b8,
+	 0x5f9767d7296bd873, 0x2a437f0494aaa055, 0xfe9f4f893998e369, 0x9f509676829b4b96,
+	 0x4b2eb7e552d83029, 0xe9dbc6dafcc3d315, 0xf70ac8c48aa12258, 0x6f47faec9cb2304c,
+	 0xcfd388210b9f7f76, 0x24a7753d8bb450c7, 0x0a117d904c80b205, 0x08bd18f774fd16ce,
+	 0x612e0cdaf6dcc200, 0x526163bb44ecf7fc, 0x9c06f13e3aba90f0, 0x74a7114afbb04709,
+	 0x1de6232f15255609, 0x01abc6d291ba9615, 0x0f864eba4edaec12, 0x39e05a62d91ecb45,
+	 0xc396cd1c3adfc36b, 0x2b21544a805cee7f, 0x44d3aab4439ef8ac, 0xa2ada6c29945cdf6,
+	 0xef27769352f46bc8, 0x50d320eaf23a7413, 0xab35de15160b83ec, 0x06c85dc03d6f9a40,
+	 0x0f53f3931790dad1, 0xa06c9c666d1a15f2, 0x1147b326a036b50c, 0x32010711905c4306,
+	 0x73a683297be36c76, 0xeb2085c27a0a4dc9, 0x4dfbf494636464a2, 0x135df329dbe0fc79,
+	 0x244bce5248d54e3a, 0x82ff4e04b47f717c, 0x42f7d37306b9e61e, 0xafc4f6232dc7fcab,
+	 0xcbe166d81860420b, 0x710b2429df1079d3, 0x05cd7c2f0d8305e7, 0x784dabf63d3d42fc,
+	 0x187043e7ff7b3e2c, 0xfcd4050860b5756b, 0x6f8ad85653252c64, 0x389f470342585e11,
+	 0x4ec3d50f1718e495, 0x4f18259a8a8bd820, 0x4709246ec19ec587, 0xae52e09f0c5b00f6,
+	 0x06e3353122a0e6f1, 0xd436d027a4c7387b, 0x170c05fc1c6bb61f, 0x5e947e9ea888c5aa,
+	 0x90f330548f314297, 0x794351b60f4caf98, 0x6c88ff73948b0b60, 0x45b34bb5333e35cc,
+	 0x8e6552e8da31c86d, 0x76f2efc5167d7135, 0x37f29c44e76531c1, 0x261df118e0d5846b,
+	 0xa11383b858a233ca, 0xa5375eb9f9246527, 0xb0881fe7c8ddb37b, 0xb51ea84889b5022a,
+	 0xad731e923e02b0eb, 0xb79f8ea9b7bc2ef3, 0xe1e46dab729c92c6, 0x30e59319ca00ff4b,
+	 0x139183a0ff6b73aa, 0x9c3166cc1e6c8cbd, 0xc0952e0948f5bac2, 0xad952c4d9abd08e7,
+	 0xb87b5fcd951dfe1e, 0x2788d7c1d80d7fc4, 0x621cdf5dbea2b9af, 0x22e8622fb688440a,
+	 0xc1b1314fe0bdb576, 0x9790cdf88c93f0c3, 0xb0fb1b2cd5d17536, 0x29fdbb44dc012616,
+	 0x9d1704782cc0cccc, 0x5277c32f65298fb8, 0xe94a00d43bfa7a7a, 0x449aa3bd037f02e9,
+	 0x9e2a46ccbdb0784c, 0x21b7175b94a049c8, 0x6cbc1801d07364b4, 0x48c5d9aad22239e8,
+	 0xb0eee0ab0611183b, 0x9f12d320bf57d626, 0x2cdd3f5b5d2df4a6, 0x1117a24f3afec492,
+	 0x1f8ba2851ba86f07, 0x2a565a7203546a7d, 0x281b7ee0d3212cbe, 0x4b96fc80540f57ff,
+	 0xe3a49dd251e28f98, 0xd599a49e5309a7f2, 0xebbd5b03d523c443, 0x5375cc4544530c46,
+	 0xf6f71cc488a8cc50, 0x271290cbe1437dd5, 0x3e199f75b2505654, 0x9f2c9244540ff7d1,
+	 0x9e7cd4bcd2ab5fd3, 0x6a763f8392a4a2b9, 0xbbc1d382275e641a, 0x77b28a9d63924a47,
+	 0x4f3533b97ace4755, 0x9cd4f6d9d4b18bea, 0x86de44bdf0915bca, 0x743612f1814eab52,
+	 0x3a90c49c89baec59, 0x10ff25526dcf42ec, 0x6a290a710456acc7, 0xb0e4315ef38008ef,
+	 0x80445bd3bb69529d, 0x05cff63ea0043021, 0x8cafac025ec02086, 0x5f76d9aad101b012,
+	 0xdf29e26947a6baa4, 0x825a1c1366ffd11c, 0xf1122df057a895f0, 0x18458d595ba28013,
+	 0xfb5e5dcc55dfef33, 0xaa9abdf7fa008f3c, 0xff4900b42628f5d7, 0x19953af67372c2ad,
+	 0xbcedeb050332c3c5, 0x83382bb60b0a27cc, 0x9c9babb9523eceda, 0xb04b6838fc5f9094,
+	 0x4ac2b3a7aba3e766, 0x1f65ba90e957b8b6, 0x288c309b03ca8ab0, 0x34c0d9c41ccd3f7b,
+	 0x9e3259255f0d7df8, 0x67e5e359b0b38037, 0xcff68f79afc2ce12, 0x8b9a2b1ea31b4605,
+	 0x25a4b2af4bcdf529, 0x11215cb0b58723d2, 0x389d8bacb30c3510, 0xb3b53e179815fb73,
+	 0xdb0936248b47eb8f, 0x312e5ce1a059e969, 0x68ce0c9f96630c00, 0x5b2832bbe6eb791f,
+	 0x44e88f1a4bfb323f, 0x820ea7fa9f1f9841, 0xe641300dad1a2471, 0x9c60b953f0bf78fc,
+	 0x64758c500d8b3920, 0x8a1fc96833758532, 0xab91d8ff74b7f6c7, 0x8013b1c293264072,
+	 0x209b2825431a5cc1, 0x66f30f8942f86051, 0x551c19dc62625d04, 0x2cdf1525b6b4b62b,
+	 0x2272de348d9aecca, 0xe19c650ec635e607, 0x307dc2a806d98ef9, 0x8ba1941027d33dab,
+	 0x5c4b80bb8775c948, 0x26bfea7e8651e024, 0x946e9a19757712a2, 0x0eb7c6c584b49f5a,
+	 0xb3d5dcd3a0484cbc, 0x554dc4d09de0c8c9, 0xe5d4c91e0a7b84f3, 0x8fbefb5c573242af,
+	 0x7731c3262763e2fa, 0xb996a23988106efc, 0xf211dbbddfcdf585, 0xb497aa1d8956209e,
+	 0xb3c69f9fad47888e, 0x29589dee2a016850, 0xd99df565d47c96b5, 0x02cb852922598e61,
+	 0xd4a8f1154db604db, 0x20138151a71ab189, 0x09342876f3232c49, 0x7c9de0c8e5d9c648,
+	 0x61f79dd67bac2572, 0x499981fa1176e872, 0xa8d5c6328be3e4b0, 0xae8b64bc39ff934a,
+	 0xd407e1d348eecd23, 0x1db35f122634f1b4, 0xda044c8b2186deee, 0x7fb3a1546454fa7a,
+	 0xc7adb2b7bd06ef9e, 0x63cb3dcd7e0158a7, 0xaa2037b57bb0ff11, 0x00724ed1ae007eed,
+	 0x85bd3a05c3adaba0, 0xe792cce8e77c40d8, 0x7dbc5546c9925a05, 0x004e40fd6d893d67,
+	 0x2496f46388d2f953, 0xd6ebf34e17d2f1c7, 0xc52489e23e61059b, 0x7c5e24b5afc3d466,
+	 0x30f749f8fa500584, 0xa3817bd3d89c15b0, 0x325b1bc9b36b1249, 0x823b4b613c21ef21,
+	 0xc790fd847d85cb5a, 0x7b7189acffdbb843, 0x21024e9e6bbe5393, 0x8b9bb8e9ba5741db,
+	 0x4a26cc36283d24f1, 0xa48d87f4eb0ab4f2, 0xac12ac3fb355f632, 0x995b559f7d0e6e3c,
+	 0xafc3e2a533f162e6, 0x709c90d1cd2279f8, 0x04c367ac76925b94, 0xa20cadb040d4d2c9,
+	 0x3bad4a63c5f2365c, 0xc103dd51c0c281ce, 0xc284e34305512ed1, 0x2199e65897a9e20b,
+	 0x16e731c4176db4aa, 0xdacc3c3049add810, 0x27d52ca50c2ca093, 0x57c07677c8f26530,
+	 0x82b735081fc7e963, 0xe7ff3aa8e397b6cd, 0xcf52e0271deaf263, 0x19d47b02c65a3048,
+	 0x183f01f5229b9c5d, 0x57062995026f2be7, 0x0e5a74036d65a1ed, 0x9c379cc571516c9b,
+	 0xc2944a66a4f0af1d, 0x555dddfdadf70b28, 0xe01268c54fde3a14, 0x29e4fb96b6a3bc4e,
+	 0xf9f61cae4c380074, 0x64d34d56fad39e04, 0x55965d259d4f199b, 0x0c60ab9abaa4e823,
+	 0x5eb685d5df4e5aa6, 0x7f7c72e39302d838, 0xd5468e22d66b3be0, 0x38e038d8f5009641,
+	 0x470ac280902242f1, 0x804e2729a00aefd6, 0x549276feb3331bea, 0xa5a6ffeda235adb3,
+	 0xd3719f12d5a5e29a, 0x82499396456d3fa0, 0x76e62811b29b6102, 0x743c407e3b040859,
+	 0x88d988a121081aa0, 0x25cd41b8b9ab4286, 0xfeef6bc67e9374de, 0x7c4b9a5e7bd4d0e6,
+	 0x2810abc9aec5c0bd, 0xfdfa37858bd5ebcd, 0x61c821193cd80458, 0x4ab14bc86ad8979a,
+	 0x376aed2f6192347b, 0x86ee5367759a9088, 0x4f39e21223b9b11d, 0xab79659330e315a5,
+	 0x46f4196de6179493, 0x3daf908b5b4235cf, 0x1971187fc6cf1854, 0x90b7e71119e9e9b9,
+	 0x890711ae64d886de, 0xae7a44c3344d9078, 0xcc04b400ce33aea2, 0x62a1c08417c1d662,
+	 0x8d49e7ee1412cb5c, 0xa112e76f316557d1, 0xf65f9e6a4814d2f5, 0x1ac19e1ee82631ff,
+	 0x1f0be3912907ea04, 0xc27c7bf2d48d71d5, 0xfa27028683eea46e, 0x2692f07cc9b42a55,
+	 0xa6b7772742db31f4, 0x64517a78e47934da, 0x3ba8a98c5dfce5cd, 0x379a46f23ce5afae,
+	 0x778be214b3a9e92c, 0xe121775030b78461, 0xfbebbe0a47f6c0be, 0x62aa9e295d73b578,
+	 0x571ec5fe4b6f22d3, 0xcad7d137aeff46f8, 0xf30407108fff382b, 0x4a73ea6f387c2cc2,
+	 0xa49ff679593a8cf8, 0x7e0f45c5812c0301, 0x64680467b7652641, 0x379cd9461ee588d1,
+	 0x66f6c73777df36a8, 0x2ff80a1e20aebcda, 0xa741dc3284950f8c, 0x0187e653dc96c57e,
+	 0xea8873d85d0a6372, 0x1c86d3bfa0db84af, 0xdab99c07c3e66790, 0x9cde5c7d854e7ba1,
+	 0x7d75fbb9072f6a43, 0x2fe9a94373ad025c, 0xce5a050bb2bfa716, 0x6ee18e0634a2cc18,
+	 0x50f0d93c57f116fc, 0xfc730ae15955c19a, 0x0d777b2e228b9440, 0x9b054cd85236fd53,
+	 0xdaaccaa895654910, 0x901f5db57de41efd, 0xb986b467d21fc3f2, 0x653684f83c88316b,
+	 0x3af36aed115a6812, 0x165890063a79c03e, 0xb627c718fc556f69, 0xa5ad45a033d5121f,
+	 0x390fa9243a0d598e, 0x90be13bc48e6c75e, 0x8e921947012df402, 0x614c494947ee4b7f,
+	 0xd114b47b21ab6802, 0x9e1519a8499bfa29, 0xc8bfa9f4d2c907af, 0x46774cde835e1305,
+	 0x7b84dce4d4ad27f4, 0x8baa80a46cf424f1, 0xd64b23daeaeac5e0, 0x5923aa64d5debbe1,
+	 0xa4179131df3684fb, 0x03275b6fe1d5da66, 0x1e991910bd7100b6, 0x1b1f00c8c4cdd2a5,
+	 0x80a64647e49d70a6, 0xa00c759b4266a1f1, 0xf39b88d9eae2a246, 0x8a5e8135ab54c53a,
+	 0x8c6f355011eb9489, 0xe80aa80f00d4fc49, 0xa6dd8665c199073d, 0x3802ba097c373e25,
+	 0x0562cad8ebf1cf21, 0xb715655ce63427b9, 0x803bca91b3723eb1, 0x29b3aeb8f4aec6fa,
+	 0xab9e998b1d02d41d, 0xaa5d1afa3b59724b, 0x49dbc62bc017fcc8, 0x12482a7633569587,
+	 0x54b46890fd1700fb, 0xf77ee7891eeaef4a, 0x5771f898e4b8fdbe, 0x53cabf891bffc051,
+	 0x47fa3b6d6e867d5f, 0xffb5454156baa815, 0x65e9b4d3a1704e9c, 0x6ed41b53697f2772,
+	 0x0704008bc8c680f3, 0x34a7180794534574, 0xeaac73748a5492e6, 0x039f2297a3eb7c36,
+	 0x3c920e99c0e2af5d, 0xb0bfddada87057d4, 0x44e2798aa926fb22, 0x7526a21ffa424973,
+	 0x93b7d8c31d26c892, 0xe6f0b8da92c92c40, 0xaff9b7877c49ba7e, 0x9f3a436d23b644e9,
+	 0xb83a2dec1a659e92, 0xaec80364af1b5895, 0xf1fcd5a352876fb8, 0x1c70855fb54a4e08,
+	 0xfe93272f705971ba, 0xbd95a526c29ea529, 0xb077164ece048793, 0xa3c01d872a68d696,
+	 0x1f80f78152051f47, 0x2ada8a8d989aa87b, 0x820466000d743f31, 0x8a0de100252e0e62,
+	 0x0f976682004f0cd5, 0x9802715bf320f2ec, 0xc65b13d6f59da131, 0x116bd70c95bb684c,
+	 0xb3c98d9fb690218d, 0xd675841a62a8da35, 0xe8557a0cf61511ce, 0x44ac73cff72b8dc4,
+	 0xd6afb355138d70aa, 0x37182817e7702151, 0x24f39ae99c2dc22d, 0x207174db1a5f2e0c,
+	 0xdcd6157fc89f21df, 0xf1f3456867a61a57, 0xf0261da826736fcd, 0x40346bd823a02a01,
+	 0x0a0b706735941710, 0xe6e5a655cac9505a, 0x9eec532af1b99c56, 0x44898fe57ec0332e,
+	 0xe36ccc7a421ab683, 0x07448012e401db13, 0x7f085629a017374a, 0x783658986fe33c98,
+	 0x08edd209f0185f1a, 0x5a347a6386c4fb5e, 0x6416a4a593aac2ab, 0xa606cf4d67413603,
+	 0x17c7abd8c98bcefd, 0x1529fd4934d46798, 0x72a118ece964c820, 0x25085218cf483cb2,
+	 0x5188d37f86fd49b3, 0xfbd9d9e82d654756, 0x0026c27201ce172b, 0x59994f4865b856c6,
+	 0xbca0a5d4d720e8d1, 0xdb3380f45f122e7b, 0x35958c7e13f2a950, 0x4a9880fa89f13330,
+	 0x3c279c45d7497ba1, 0x7c43454d944e797d, 0xf54b6da0850b6e1f, 0x0e01233b0bfe4504,
+	 0xe01276e0d23fb82d, 0x77527f97aca9ea3d, 0x5f1d71a174523492, 0x29757a41f36b75cd,
+	 0x7396d1d0a9ea1916, 0x85780ba22b36cd1f, 0x6543faaa367efb57, 0x1440cdfde9355aaa,
+	 0x7895cfc690712114, 0x245df4023250891d, 0x2c9e9a570523ee79, 0x0c8ced1fd8504169,
+	 0x2bf9df3c6a048c31, 0x2ce2c24f5e67f516, 0x5a38030de5519e1f, 0x89b39c29b34d565b,
+	 0x6cb32474a1d1e7af, 0xdb597169e697eb97, 0x3a2639a67213f672, 0x4ca7692e3ac402fd,
+	 0xafdfb4b82efea717, 0xe5891f096c1280b0, 0xa99b5f085230448c, 0xa30d4629d7c160eb,
+	 0x66e9f5ed7b249a10, 0x0220489bd49d4f76, 0x1482e41dd3787bcc, 0x847f900d8f6a7815,
+	 0x27b801b7456232b1, 0x40ecefccb32e45c0, 0xbfcb2da8eb124e41, 0xa1d5abc24e15f677,
+	 0xd409615facb4b499, 0x63f8ae3375b23c3a, 0x429a9af8b0fcda9e, 0x2ecc13de38dff01d,
+	 0x84412fef7ebd3ef5, 0x31ff45f11ac8f855, 0xc9a91a1a37670a87, 0x2e518f764a9bb194,
+	 0x9caed6fb7f65f560, 0x94b98f532cac89a3, 0xfb4e5940d00473f6, 0x182d6b325d2deed6,
+	 0x195f5e8c99f39daa, 0x09b5f4ca390e880d, 0xa14bbca5276341b6, 0x9309d627f79ed7e4,
+	 0xd8fba3423ef83a93, 0x872a44a14bd2bcf3, 0x1d039ee84e01409e, 0x2c103516365da7b5,
+	 0xc1614781eae69c1d, 0x77bb8b624ee1ccf2, 0x8e3029712cc63051, 0x7e67b283f701a4bc,
+	 0x7b88079c0c3c970e, 0x5e2a5ac68936c236, 0xbe115a2fa697bceb, 0x9e6dc99216bb6bba,
+	 0x6de580810d402e06, 0x1907c446987b8a57, 0xef7e9317d76ff562, 0x4718acc9fc9bc31d,
+	 0x330a53b3fa7ee4b6, 0xc0a004a4fae514c5, 0x050b33affe128663, 0x1c65ae8bd2042dbe,
+	 0xa39b2181a885776b, 0xfb5947137b86305d, 0xb79ee1cf87d4dd33, 0x1d02a069668d6807,
+	 0xc3d9a18f35d55e88, 0x03186da70630a2c6, 0xa564d42564784d4d, 0x71cf6c33295d77a3,
+	 0x3fd9d02748e5b3bb, 0x91844dc307792bc8, 0x36b4e1b8ca9f87e3, 0x3155ce500f2d8b86,
+	 0xbf2fb00c4a594a2b, 0xeca786c0fc343d34, 0xfd3a89007774e885, 0x230548b33590549c,
+	 0xff865fe43e3be296, 0xb4f6a9574254aaca, 0x9f9ffc296a8e567e, 0x9afcddadd8c3f080,
+	 0x32c919e5c3a22e31, 0xa9a605d668a1ebbb, 0xd42417a59edfa41f, 0x04b0736b6e1d9242,
+	 0x6c8fb7ef9db8fff9, 0x902fb1458a5a463a, 0xe6efdd283c937a78, 0x11d275419f4d7173,
+	 0xc3d3cd250be07da2, 0x68588c7f7c0250f3, 0x950116ddc28ddfee, 0x29db56407071aaa4,
+	 0x42740b23071487d8, 0xf4605f7f8f19966c, 0xa48f480044658975, 0x80b99f3f3c07c0e6,
+	 0x2b922cc3abbfe672, 0xc6104b6fde2ad674, 0x6f96a987dde906e4, 0x41f4c155283adf4a,
+	 0x1ebe0434a2e442fc, 0x6d46c0b8e676f330, 0x66cc0c5915e2c75b, 0x78325d863f012342,
+	 0x3e148de4cf694ea0, 0x3db409a2975b4020, 0xec1b3673ff5f7431, 0x2c66384ad699560f,
+	 0xc596c734263ba37b, 0xf3cddda040d81e8a, 0xfee133a2a4188e62, 0x4713b1cfae2560d6,
+	 0x505dc51f3b14395e, 0xdb235246fe92d175, 0xa72b54a5f01d6f25, 0xa520e2b923b82d95,
+	 0x72355f87129e96e0, 0x7948b3cc7786a07a, 0x9af8ceb29efea69a, 0xa0ea06212cd3702d,
+	 0x2e440b63f799f85e, 0xc0d58414646e0058, 0x8d482a915fd86f50, 0x840f988c3be28240,
+	 0x7acf1595968fb7ba, 0xa1bd765ec071b8e5, 0x56e08dde86799233, 0x41b665bab6176028,
+	 0x5b22776ff9af3fb2, 0x064df05e8bf97faf, 0xfce125b243a2d2a0, 0x7a58ebc562dc4d42,
+	 0x368c23d08e9d1bd7, 0x39379fbc7f096840, 0x1ae51df7f906ee37, 0x8ae08113a6d9dba3,
+	 0x8e3a9c7507b3f5d4, 0x6f5eec5f03dd7097, 0x10859a8753bdf75b, 0x852e4f44a7332994,
+	 0xbade1c26616eb25b, 0xcd0e2ca00c7a4a8c, 0x0c6d10827ba79ab2, 0x35ed4e5006f8cc40,
+	 0x43d57a802ed898f0, 0x9bada7ff1196f42e, 0x73a41df8d93b48ad, 0xa4966b4fcfea6c3b,
+	 0x03247ebb3109701e, 0x04c8c129222d0aea, 0x908c3bc729c6d296, 0x555dfceaa54e822a,
+	 0xc601cd9c2973d28b, 0x606ce5d4b9ab5f45, 0xaa321e7436e20ec8, 0x1b81133695e58e0b,
+	 0x79c8e8b82aba53c9, 0x6659c280ae3f3e0d, 0x63faf166e1508b83, 0x2891d42a149ddb70,
+	 0x5d638f7c0b988e38, 0xdafedf6e21cfc11c, 0xc55c7db843458903, 0xa8bf251521f2284c,
+	 0x77a2155a758bdf57, 0x3a7fbabaee2f6cff, 0x997c5f17d57c76ac, 0x118029bbab87a887,
+	 0x8a9f3f4e42d013e3, 0xe73b7eafc0fe53d3, 0xdd778f56194f31b3, 0x829bc868553a8f18,
+	 0x799aa38b0bb8192e, 0xdce18738d3383770, 0x5a2b065ef24cbd76, 0x987dbdf6e80dbba6,
+	 0x5e1436f5cf8f72a0, 0x8522d0560482aa09, 0x73e21ea414544e78, 0x3d130adc38202fcf,
+	 0xece682faf01c3061, 0x51f5c45ff82e210c, 0xd7c97d0935da649d, 0x4ff59ae98936e1fc,
+	 0x04801eb2ff58d99e, 0x85667474deb50cf7, 0x084f9a6e7fdcf5de, 0xaa1d37332ac4e1e7,
+	 0x986c14da842e3382, 0x4b4f85a721ff2b82, 0x49c6b911377233b0, 0x81cfdfc174fd695c,
+	},
+	{
+	 0x225e5b5f572bda7a, 0xbc398fef8aeb1c61, 0x914a395a48219026, 0x0b6b712632f7eca8,
+	 0xdb8b254549fb3b70, 0x6f6294f7e22ed357, 0x051c1d49f981924d, 0x4db01449773d0c90,
+	 0xac3e4aaeba047d3f, 0xe40910916bff8266, 0xb0bca1bdef16470d, 0xa54cbf23505469f6,
+	 0xfbab840278e59d6b, 0x15eb0e0ec6876f47, 0x32fd068f85da0a3d, 0x9e1788e9c6ec7c6e,
+	 0x378f4fd280464a4e, 0xa986eeb5aa8e0777, 0xf298ace7abd4b8c3, 0x30def6b167c3ce53,
+	 0x920d6346935c13fc, 0xc0eceab82fe78cee, 0x7703025b4cf46978, 0x19119667be147f79,
+	 0x83008ed8c7dd6c99, 0x23d7feaaafaa1837, 0x6b4b07340aabe482, 0xaecfe00d2f8bc902,
+	 0x24880b5428b8e2b2, 0x82dfd4616a1f9d92, 0x428ae0f2e66a15b4, 0xaa38a219cd278f25,
+	 0xf797be5efa99f001, 0x1cb9ceff97a7f99b, 0x33eb8167228311f7, 0x6f737379090a0731,
+	 0x2ccd3fbe9fbb769e, 0x68b4c3ea6db257e4, 0xc580e6cf67aaf8ff, 0x9ece4b9c2c3cd4f1,
+	 0xf7799d86010e3b95, 0x0aadfbd7dc4066d8, 0x583c3cccf986f5f1, 0x495d93c1f24844b7,
+	 0x441e3babc3868e01, 0x71cf37d2c28ea331, 0x8e3bc1427ba278dd, 0x785e542e6053826b,
+	 0x0e19790b35bde8da, 0x493a0379518f654a, 0xb6e5033598c4b699, 0x2143c5a1588ed2e4,
+	 0xd86e7c058dc1db05, 0xadf8d5db44e2e79b, 0xeb29cbda67d53be9, 0xaf2df9cea55080e0,
+	 0x7b0e7c32230fb4a4, 0x34d3ae72f24912ad, 0xc662de75f91af6d4, 0x525b854365f4854b,
+	 0xcd189f8b2bd9b29e, 0xaffc9e52cbe53066, 0x3c8b6c167c7e75d6, 0x9c5b3f28377a2d34,
+	 0x68cd2b54eea5df1c, 0x77138643583c8344, 0x242967bc3fe41a09, 0x91ad4d2026b3a24c,
+	 0x7ef62d837a4f40a2, 0x8c18d709c22b39b1, 0x298b86d201300950, 0x83b50f9d4a4727cc,
+	 0x9a77679218a1c0e7, 0x9cf0523b6eb45356, 0x9167ac8ccea24dfd, 0x3d7f521b92a940b0,
+	 0x1454a8ef54fa94f2, 0xe9b26fa0c941b901, 0xce827bfe8ba65db7, 0xae682f2f32a6be60,
+	 0x02b8416115c0f732, 0x62272d8babe87013, 0x58f482d1db3ca3a6, 0x6f5f57e2a8fd9035,
+	 0x47e34f71f208f237, 0x08ac251a0a4bacc3, 0x95a74f70c74611b6, 0x990bc11ded1f40bd,
+	 0x4ddff82b0e0710ad, 0x3ba1ad4d486eb923, 0xb22e55b6361f6ff8, 0x0c0e6c2a41b197d5,
+	 0x01d882a618714154, 0x96f1a8e7f3f38b4e, 0x71dea90fae1fcbd8, 0x671151f6828e7f9a,
+	 0xc2b6f1c72827669a, 0xbc694ee98aab226b, 0x2c1f7ff8df2f74fd, 0x984306f4512b5020,
+	 0x8a49bdf153311a9a, 0x78c14eeadab0cf65, 0x28f7fe9ddca3c278, 0x7d3c49fbef5a464a,
+	 0x2d2419dd4e9417df, 0x0b1c944e0904d024, 0xaa8ba72829048851, 0x117413104d6b8beb,
+	 0x3bcf3d61eb766602, 0x6b5164bed0423686, 0x697f796e4d90215a, 0x522186806de850e6,
+	 0x4b99b66bcf78ba7f, 0xcdeb443f007b7c99, 0x467e5a9dd83d5a4f, 0x4d7f8e55984884b8,
+	 0xeb9ba060985e2c2e, 0xbbcac57f04974a12, 0x4c6778b6465e57a8, 0x5dbbe9b43cc48950,
+	 0xa72761c35a0a73d5, 0x5335e2ab34dad6b8, 0xa8c6a95b1c7d90e5, 0x1c518780cf30f57d,
+	 0xe5f084de13177850, 0x0a609fc6fe5d4e13, 0x91402337bf810ce5, 0x52d49ad91df9e0a8,
+	 0xaea7a40dd1308c74, 0x890bf1b5d13bbfc3, 0xbe4cb5defa5d3af4, 0x49649907dffbbe1b,
+	 0x891bf486a2d34844, 0x593df60a4d8ca7de, 0xa78c27e930aff2a4, 0x722c16762345cd58,
+	 0xe7b4ca9670592df4, 0x107f321e27f14155, 0x1dd94154bcb602fe, 0x4191c7a643a42bf8,
+	 0x3795ac5cc1262729, 0x56c73958ee2ecb05, 0x148c407de570316f, 0x5ddf4e1bbd284055,
+	 0x43829df9820bee30, 0x492b8761d697b047, 0x74e04f23f6c8241f, 0x9691189fc4e33e1a,
+	 0xf522bf85f61457d3, 0x9e286ab25a1c7e85, 0x7ae328f461f9d845, 0x3ee20a92d728b2f9,
+	 0xb7a533a5e523baed, 0x219acaa0f69374af, 0xd69699ff9180e865, 0x2e41289d9c9d7b3d,
+	 0xeafc726c6fd207f7, 0x9e1df0a1aab6b180, 0x3ee4a3e46da9e289, 0xb607f27a51522db1,
+	 0x4488e5601a3a55e1, 0x5150d5d9a9638281, 0x947a9fab599dc154, 0x914abdb46e3b2155,
+	 0x52086193b5eae7b1, 0xe41763c3fbcd9218, 0x69300b56c37b6e51, 0x5287a149216ce048,
+	 0x1f202609baf535bd, 0xf9e90958c3dc1ff7, 0xdb23ec733c5c9c6e, 0x9c566916ab0748a5,
+	 0x0a0517b4651f73eb, 0x1ec44cac04a6b0cd, 0x8c7f474c57bc44a7, 0x11e0dce89370f1b5,
+	 0x816cb9ea9d2689c6, 0xe2489cad0fcfddd4, 0x5bf35fa9eed9bf70, 0x349a2986279411aa,
+	 0x39c70846d334aeec, 0x4b62d9a6ed0777df, 0x81a33bec15b3fece, 0xab4bedb941e4389d,
+	 0xed234e9cc1d42ee1, 0x4da538595fe24c40, 0xe11fa4d8458848a6, 0x75f15ec2658b69ad,
+	 0xc959eb7940f19ba9, 0x09dd8610af34e25f, 0x34410e7f3d230c18, 0x85b8b8275abd455b,
+	 0x86ccb3934d890fce, 0xf5362896269b5962, 0x1d2b4807adc8d393, 0x70ec7b515cd0c440,
+	 0x90d0e22cbd5a0938, 0xbafd8fed946fb90c, 0x53a208a735f5f9cb, 0x711b2f82a30a076d,
+	 0x52defa838d58098f, 0x2ae40118c586801a, 0xd844a6adce78b621, 0x3a9c37766670d8a6,
+	 0xbbad5a7fe8ebebaa, 0x5a0fe44f8c25e5f8, 0x233ce8c0d25260b2, 0x34c8a550460e25d8,
+	 0xda2e657407f9327d, 0xf64eec3e6592c840, 0xaaa4f858dd50bcc5, 0x0fc5c759e9b58b45,
+	 0x0b422669b94526fb, 0x445ed059499a9bd8, 0x9248a0d1576732f4, 0xa351017e4a74640a,
+	 0x0c44a23243522c60, 0x38a612dfadcecf93, 0xa5047b141d7b429d, 0x683cc839c71f562e,
+	 0xee1764414d61d43b, 0x1238e663798e6b2d, 0x586711555ce04fe9, 0x43897b5e1aa15866,
+	 0x3b6316ab79a59aa1, 0x1789931d8bfdf750, 0xfd451161c85f4ff1, 0xa375806adb00140b,
+	 0xe6f4f0c5ed41e21f, 0x5f8392f180fc0816, 0x3da5724b490e66ce, 0x7cfeb2da873cce0a,
+	 0x16d7cca2bf6e829e, 0xdf8868e4502d46d2, 0xd44fbbaf6e946796, 0x5ce58c3167072db1,
+	 0x1c764a9d4bc3ec23, 0xf0ba2c080342624d, 0x3fd9fa07adedb444, 0x4d75d5ff4099efcc,
+	 0x4ec5ae6de6e7e3f5, 0x579d6192cb5f4010, 0x762f8798b8c86c1e, 0x43f0d2bfdd7632d0,
+	 0xc5fb644bdf2354c6, 0xcdfd499ef173fbbc, 0xbcfe70472ea2973d, 0x6ac85071a7badcbc,
+	 0xe8e4bd6709e420f8, 0x27683ca35be109ad, 0x3441f6ec4dd878d5, 0x4e9fdca6652eef04,
+	 0xaf675938a99f7c75, 0x7691c8ef47d6d36e, 0x0d3ae60adc7fda33, 0x606bd3d09c3cdd6a,
+	 0x91116e6cf8aeb96e, 0xe875940629e5f604, 0x6baba13e6a2a2fbd, 0x267c840c2edf333f,
+	 0xe5143f8a3302354d, 0x1ab332981fcc8d01, 0x8fedf7bf8f9ef71d, 0x91dac632351df88a,
+	 0xc5190a67ed63cb26, 0x46c5e907a6d9ade2, 0x9bb32df5c816658f, 0xa2a9f629dabeccb6,
+	 0xe821e103a3ec9ffa, 0xe08d906b4449a622, 0x22e3006a566f3b3a, 0x66830537a1902ffe,
+	 0x3a58ccb8e118747e, 0x5117da2183a882ef, 0xa9fadd10cf510dd9, 0x54c3f52b0e8c7e33,
+	 0x8432eefa13057274, 0x2174ac0b9394eaec, 0xe4e482593aab3d22, 0x075abf70f31d34b3,
+	 0x7c6ac65de3ba34e1, 0x380c9f890e2acd8a, 0x07c14fa52beaa19f, 0x1e7dc0e710c3fabd,
+	 0x44a93163ba4fdbdd, 0x93d0eea7f319f3b7, 0x7bd24bf4db3bc7d8, 0x01f6e9fd1fff668e,
+	 0xbae2493c2ff76ed7, 0x7bc374921fc7ca8a, 0xcca1a76cb1d9d23f, 0x025c071072d69fa1,
+	 0x73fc21d46bd80245, 0xd22601738b5b1981, 0xbf0a30a4f5443812, 0x9909e86993ea0c4e,
+	 0x41d34d8c48d18a30, 0xaebe82019d6dc49f, 0x9d18d3c3f304c708, 0x5b088ee82dc756f8,
+	 0xea52eb941aaddf41, 0xd63dd6f7b624d7ab, 0xc9da3a5fac2d1bee, 0x3a143fd6e172464a,
+	 0x6b8ee729b8437bf9, 0x685320e912f49a8f, 0x34b93d6f0cfae31a, 0x8408075718390696,
+	 0x9caebc5b1a26db56, 0x8d4f744b72d080c9, 0x17edad323d153a6a, 0x2fd51538c23cfeab,
+	 0xe62ee9debb7faf8f, 0xd1767a2e15931a14, 0x39a07cd854c45fee, 0x440d2ee251d7fcd1,
+	 0x5fc47e52f1b07c41, 0x9629ac07574a50c2, 0x40c017179a98b0e6, 0x52ff637b78ffd5e0,
+	 0x19847289b9c80a02, 0x4d6666cf6c1c33ec, 0xe7f4d052c22e5de2, 0x731b68d9ccd8565a,
+	 0x52058dae943e7379, 0x4b30119c48e46e59, 0xc69a8d6dcf9cd8f5, 0x498e9287fe3ce522,
+	 0x1290eec7fd3bc448, 0xc0fd4ac4aa3be0a9, 0x9a9e907009957d08, 0x3954e8fc6723b7b5,
+	 0x158b7cba4784fb9e, 0x60c57d49fea4a59f, 0xff31fa6e1014551a, 0x00d1ac77e0bd1c26,
+	 0x6ff78bf6f4f47cde, 0xdeda86c41396ff06, 0x2b0ba96dfb0f62ce, 0x1f6cc61701815814,
+	 0xfa6a0ee4199f3495, 0x189d7371848869a6, 0x6ded2e453ba1459e, 0x585d29a52ca7476c,
+	 0xd58783df28a41d4c, 0xd8fa7b2fa8e6a986, 0x25b58a3d5352d9ec, 0x70c234dc58bdc683,
+	 0x69f3cda60fb78af2, 0x06499c0845778782, 0xc61c13d0a86e09e8, 0x9541601e4c1e1273,
+	 0x25e1466ea13a6164, 0xe12cef1d4f87db44, 0x002cc64a6d6e3126, 0x7e6be556d6da5c1b,
+	 0xe461349c4fdf213f, 0x25ee0b67bd9e480d, 0x3e4b52eba3995dba, 0x4a21b8a8ce592089,
+	 0x31e2ac26abfa39fd, 0xb15f396501a3300b, 0xb9e98062e65f0652, 0x9a1849d9d823433c,
+	 0x579817a0f0d448b4, 0x8ccdb8df8afa7654, 0x6bdc40a6ec4883e1, 0x998751e31f48cdb2,
+	 0x7b137f91b9cc574f, 0xdd13e0e3acf3e408, 0x1c1580135b0fbf20, 0x73c5419911e095ba,
+	 0x6e3e16122e18fe44, 0x1728467158933e42, 0xfbf5d80ec0a7f9ba, 0x63619365ac829c53,
+	 0x79d8ccf1af0fb818, 0x413ee54da0f45208, 0x80a38d55a128ce62, 0x92f8bb6c5fa60de0,
+	 0x7f923ab7a2503a52, 0xa4d6a4c349cc9489, 0x26d4f540072e24cc, 0xa2f48f1392b29b81,
+	 0xd4d768afc72cf337, 0x97ce3182ed8bf1a3, 0x21233bea4ebb06c9, 0x7051ceef671cbc2e,
+	 0xa4c480bc673987b5, 0xeca2ad139f588b5c, 0x57b19e9fdfaf1a58, 0xaf22b2dbe1a9985b,
+	 0xaa571ded9cb46113, 0x233f5a12155fc64e, 0xf9a08ec05142009a, 0x4790ff2672f397ed,
+	 0xd48c83eb71afc420, 0xf15ae391cc2959e6, 0xd49670e70bb17024, 0x48415c67d5269f76,
+	 0x73f2a77d335a13a2, 0x24f64960d3823326, 0xdb0f0da469e9ebaf, 0x618004aa1b9e03fa,
+	 0x5e2a9869cb9bd666, 0xe7eb377112e15796, 0x6d50939299bf0706, 0x72480fa354bb68f8,
+	 0xe513629db6264845, 0x5bd20f5a3a879829, 0xcbb62dfa1d874348, 0x49b39f83bdedd6a1,
+	 0xebf05490e1265388, 0xde69e9bb0d02fe22, 0x696aa50f016928f7, 0xaaa8dd4cc55b06c9,
+	 0x4cc4500b39336d23, 0xb73c35898ec59b2f, 0x33e0f97d669a0345, 0x69f58ca7b716aae3,
+	 0xaf19a55494d66f32, 0xbaabd84565604e9d, 0x73674062afb6509a, 0x07ba455c909e6d6d,
+	 0x0e8a34861032931d, 0x99026107787916f2, 0xc75b3aa5b017745f, 0x7a0c6c8e33502a37,
+	 0x47fafdb77a0e1ee3, 0x2222d1f85775731d, 0xc42bd2a24a1d7648, 0x11843a4f24250731,
+	 0x9d941832b92c5022, 0x56357b63dd6b8960, 0x85d65e00bd0a7998, 0x509717505983d865,
+	 0x740d0dba0bc098cf, 0x3e894b126be8a11e, 0x3442f2fdb7c9fa8f, 0x10d79f17f76f76ca,
+	 0x6fab3ac53aa6a667, 0x6e47589a666e1503, 0x91ad58a80b674cd5, 0x3a51bceff9f15e32,
+	 0x86b08265803b05dd, 0x9cbc12e54d8ddc26, 0x4bde948c8d807bf3, 0xa4bb047df3c32ea9,
+	 0x08fb7f3db163e89a, 0xf091f0fd7a757f88, 0xc23fa6e32e854f7a, 0x9dd0e5c8ef2aa689,
+	 0x74d43f4c8ec31441, 0xa24b071344f2cf4c, 0x2e6ab6754953c800, 0x118b6add50b76105,
+	 0xbc299c7b63e60b6a, 0xb2f56d0a48681d07, 0x407b9ae4afcf7451, 0x41cdd2faef6d348a,
+	 0xabdc64861ce87b6e, 0x19ea6830fd928542, 0x1e38c3e5aa3de95c, 0x73c40fc855c08576,
+	 0x3e6b28e406d06d7a, 0xfb16a7c59976781a, 0xe207d136d545eee8, 0x463bee816b2a395a,
+	 0xdafd1da9fa512a7d, 0xc14a12f30dbe8e26, 0x33278dcf6c225cb7, 0x2f30de218922c97b,
+	 0x4d0a4fc33ef8e365, 0x994a7f245323b498, 0x133da7eb6cd95f5a, 0x0201b3f10b56aabc,
+	 0x47dddb4be3de76f6, 0xbfc1f59dbf5bf690, 0xa49e28390f386d2e, 0x6b8c7f9ece28e5fd,
+	 0x3f540b25f6eb25f8, 0x471a2f1de39dc99e, 0x8405c757f60ced5a, 0x66d2cf7bea6e42d5,
+	 0xc86f0902bdff3ee9, 0xa3e127e546fe39e4, 0x095173bb6cdd1817, 0x1d9ea28ded2e050c,
+	 0xc6690bc82b9eacf3, 0x994dfacbd0595193, 0xe0c2076fe79b14f3, 0x19844867a1bdb86f,
+	 0x1f32e16aab0ea636, 0x5590c1b2566106eb, 0x045f52ac649b97ab, 0x44a84ef4952242d6,
+	 0x36c27854acc7e596, 0x30483896e78c8e7d, 0x78df6ebb1b5e8c4d, 0x4614331a7b2326c2,
+	 0x30a696df3464d78c, 0x9b8502841c2d3955, 0xebf20c90b26b68f1, 0x5986a1bef3955d18,
+	 0x0d2ab1ecad957ed7, 0x86dda0018d74e29e, 0x142cf99854543e37, 0x0f05edf7a5d470de,
+	 0x4699632495b88f54, 0xe290fcf2d4601398, 0xaf06b4f2811022dd, 0x8ebe855f9de2d44f,
+	 0xc7d6b02bfc3cafaf, 0x68a514891127670c, 0x8db23a3ae7ceb0a1, 0x2dfce96c600dffb3,
+	 0x101aff6ebf5137b5, 0xa19241de96063fcc, 0x83ad04984969e7ca, 0x3ad4c747331636cd,
+	 0x7e8d8b618de2c5db, 0x931b64b297cde931, 0xdf4153e64f6c87c8, 0x3cd5ee22ff8d04f7,
+	 0x1c2e2719942d65ee, 0x19d1838bba631a2c, 0x42be8867793fc5b3, 0x2c358bdd5c6a5cb6,
+	 0xbc225fbece0d2a0e, 0x38556cdb6df156fb, 0x1e29a6a3737b1a94, 0x14fbae9b52867d23,
+	 0xcf72bdc0c1af728c, 0x305b338a0d2300eb, 0x6743cac6a74eb0c4, 0xb5892b6084eb0073,
+	 0xbc90ad57f5e0add7, 0x0b5985a183fec242, 0x2a0623401a04d75d, 0x06ade454b26ed2c3,
+	 0x5621c0570c95f5fe, 0xdae6e0165c12d421, 0x6d58222de11827c2, 0x5effc7197ee31ed9,
+	 0xd61d7dc74ba79134, 0x9d14e0509eff3e11, 0x8c80e6e67eeac9da, 0x65e8fcb94c29628b,
+	 0x65bbfed419dfb7a0, 0x02cccab7caebcf3e, 0x8dc818d9497a5e81, 0x72471d92d08f11a2,
+	 0x278b8e59703d94df, 0xe20a2d20f9a40dcc, 0xbd9cec2249363e96, 0x571b5c0f94f81352,
+	 0xe8730564294e09c0, 0x151fba6d33b62096, 0xd3397e1c3b148184, 0x1a94513aaa012f3d,
+	 0x88a181023e65815c, 0x86931d796ed90aa9, 0xfe463255b822c5fc, 0x0453f186ecabb479,
+	 0xd36fb495673019f7, 0x05cdfdb73bfd4605, 0xf14082b0f4ada12a, 0x965b52c861c0f834,
+	 0xd59b542eb7065086, 0xf337c655b5ade21f, 0x391d3d1ecdf85ca4, 0x3bd763fe6542deae,
+	 0x06ea217e0e4aaf22, 0xe9f5e6525a223b14, 0xb90c5c7ca688f166, 0x683da863cdfde45c,
+	 0x97a8dff152aefd65, 0x93371b7b7a3f1c3c, 0x3b5f773a081c5815, 0xaa4212133ff0cac8,
+	 0x2aabb226b8bdf1a5, 0x15dfb537f221bd2d, 0x5e2a63a1b8bff769, 0x3432092c68378a30,
+	 0x70231c2acf254550, 0x83e892a79482ca75, 0x02123e07603329b1, 0x9833a7aea01bd011,
+	 0xcc56b2464ddcaa7a, 0xe85f1aff5ecbf335, 0xc840ff4c4eea94e2, 0xadfc925ecdf70ea5,
+	 0x5a5e12df22b6b31d, 0x4bfd772dceb76c1b, 0x888b0b1ba8bd0fa1, 0xa9702df69fc5232a,
+	 0x68ab198b6cffdc96, 0xac27b1529d991a6b, 0x24d27c730ac128c9, 0x3d47d77f79ebcc25,
+	 0x400b92cca20758eb, 0xaf9fd8d32bf51f40, 0xf719f3c01960929c, 0x8346e2db7d7009ce,
+	 0x6c441982d986541b, 0x8e5e9cc70f36d49a, 0x5c1afb4e923ad366, 0x1969bacd5b343c30,
+	 0xa9bcc27c0d3f4d33, 0x4cd8d5b48e36b094, 0x95219a71cd12fc2d, 0xab0fc90e3ac39bf7,
+	 0xed5f559d296929de, 0x7d45797b29e4f45a, 0x2e3257f4bac14882, 0x78985ba904e261af,
+	 0xeb50ad7624c0bde6, 0xf79fbaae39d752d9, 0x4a86f4b1d49feca7, 0x05d3c740bc944e70,
+	 0x5d96a7af6a2d2845, 0xded9d24499bd93dc, 0x2408e14db7013f86, 0x747730ffdd0ee1dc,
+	 0xa22f1673b0725eb9, 0x86569787d90816ab, 0x26dee0ecfa21ba31, 0x531b1f066c289f12,
+	 0x3442d87d6e1837e7, 0x783df8d35615a4ca, 0xed069aa9ed2e4ba6, 0x0b09f5844f3e3f28,
+	 0x74b4502bab5c2dd8, 0x39330947ec13e478, 0x3e6b3a5348a959b6, 0x9f0307cb463d186c,
+	 0x886cbea23f48c3d7, 0xcc906834a2dbdd56, 0x9244d605943209d0, 0x8906184f30b743c7,
+	 0x7b7ac1aff33ec961, 0x4e86488224379eee, 0xe29ed5b2d0d29f9e, 0x11e4111b56f1e230,
+	 0xc9c61ff55ff1f002, 0x4954dcfba1ee043c, 0xf2abca25948cfe27, 0x40192a456b36b209,
+	 0xebd2ba07ab34159c, 0xb4dc8364aea75551, 0x690677c3bf043614, 0x022f679ee1d95d7e,
+	 0x7932d6a5cc83e252, 0x69239a06fba80a29, 0x82df5ef5fb278d67, 0xa4f2bea332bb87f0,
+	 0xa5102b5b23bb21a3, 0xafba752ef258bd6b, 0xdbbb4fee8ebeefc3, 0x42496e94f59c2b31,
+	 0xed4b1da1c651c150, 0x9942630e81283bbf, 0xe9b8af12f93e57f5, 0x993984d4d6983c89,
+	 0x448e168ab55d95fc, 0x979308252ab5ae42, 0x494b6b588be40254, 0x6cda03fead3fc977,
+	 0x0e7fbb19331cc78b, 0x99376ba10dbfa9de, 0xc1afeebf742140b4, 0x0a8f1a30c3798af4,
+	 0x256169e05fb04067, 0x17a077b40d3e150c, 0x139203b175164237, 0x0888649067b934f9,
+	 0xc1c0c0ae945f972b, 0xe96e62998388d632, 0x232dc82fe1313d5f, 0xb17a5d87fd0fb432,
+	 0xc0f403827f0b8a2f, 0xfc13c48a2b0948a3, 0x2e438d595df2fa39, 0x52ad1e93e15b6933,
+	 0x026b88371c946766, 0x31de7e8ccae53b8f, 0x200883575013908b, 0x04a6ca1a0ed66d12,
+	 0x3e9c277ec5895b27, 0xb2b9b01c3b904c44, 0xbfdde9254002f449, 0x4128eb5a559873bd,
+	 0x6a1c81202c27e7fc, 0xdba46efbe70f685d, 0x1e80b4b78ac606f1, 0x3c2c86f9f164bdfd,
+	 0x6a9db7bd3bc30baf, 0xd92654e75f84eba4, 0x5cd38c82e654214b, 0x6125627e7855914c,
+	 0x10ee598446008072, 0x9f8100b3bf210538, 0xd3c9d6ac17e19866, 0x7beab541d9ee573f,
+	 0xf45a64fcb6308e0c, 0x15e67122a8b58dde, 0x31814086c51e46e8, 0x13079fbccb4336f9,
+	 0xb6dcded107a94ec0, 0x03551fe678861d56, 0xe338cc1e12a33b97, 0xa74a07b417e85365,
+	 0x94b71f636b039edb, 0x0cba503da06895a4, 0x80f6b2011f7648e7, 0x011c43c79514c553,
+	 0xa9fc00445cab7af5, 0x57174c2f692c0023, 0xc48b59003b0760ec, 0x3f9118578ae1a3c2,
+	 0x8e37183b3990f631, 0x0e57aec174556cc9, 0xfa36165f393d52a2, 0xa95e1d13c661bffb,
+	 0x1d00b2ec1e808808, 0x011e85e8a193b8be, 0xcfc119a6a00ffea9, 0x673fae10b01a9f6b,
+	 0x3d674857a83af77d, 0x362da2616f8ff886, 0x126c75a95b53781b, 0x70442bb0800a9163,
+	 0x015b715f76f2bc84, 0xe69e9dc56dfd9627, 0xbc1328fe9c1b6396, 0xa942a1284b4da6b4,
+	 0x874cbc9a37d02708, 0x5a63d43d790a9207, 0x7abc3da7b757d7a2, 0x636ec2ff2cb522ad,
+	 0x4dba2b1cfc8371e0, 0x9edec003e6f05c1c, 0xf3f318734d1081e8, 0x4a147bd457717914,
+	 0x4b07c60476d8f123, 0x0a255aa88cdf067d, 0x5f90717ddca26ddd, 0x97460f02a9c5ce1c,
+	 0x31ce82722a5e695d, 0xb378740436fcdd27, 0x623a9905c4f12020, 0x5c494df6cf602fea,
+	 0xbb69d0668943970a, 0x5879e41352d649ff, 0x1f79a7ac94053496, 0x668e6e82d38bcc57,
+	 0xab7fb59f31a94e72, 0x82f3d58e4ea30625, 0xf349358747d1dc59, 0x3f5681f3e2672d0a,
+	 0xa51d46c9db50f942, 0x8ea18568955896e3, 0x5225686554c0c456, 0x33f35b9d0f135ae5,
+	 0x1192cef9222a1694, 0xa8b6f8714203669e, 0x36f778a0a84ce54e, 0x63415e8517686fa7,
+	 0xdab2917233879a84, 0x2512026f4d825bb2, 0x4533853e94574afc, 0x47eb249e2f21306e,
+	 0x55ddf4858b10bf47, 0x7523c071a8986f06, 0x9d814a0ed18ffb80, 0x69f10d4c69619843,
+	 0x3a7462c488010a6c, 0x15b788c975157d62, 0x169873d0b9f6a852, 0x828d08abd0a70cf3,
+	 0xb333dba170dd9ee5, 0x5ac7f38cc591a6ec, 0x27601664047c101b, 0x644d1a43d83aa988,
+	 0xa7e2f2bdc547e4b5, 0x9366a0a1280d1228, 0x6af7e18698153577, 0x3004b3e1b3de9425,
+	 0x042e63356f65988b, 0x75849be87ed88c93, 0xb43096d081b771f8, 0x6ba12dbdfac1074d,
+	 0x9b4e4399078e9cca, 0x291a851896bfae3f, 0xb3c0a0fe214082af, 0x4147dbd1a4fb7a8b,
+	 0x5bec22da41bd0376, 0xfad8c349574b2ec7, 0x833455a52ec09420, 0x2398b6724e79344a,
+	 0xe7157ae1c1bcbb58, 0xe9ce702c4da0579b, 0xb30142a547e554d5, 0x4ed8955285c78a18,
+	 0x71badcfac1627867, 0x3a6a35b69bfe4e10, 0x9eb81647f349955c, 0xa179638e89c4f074,
+	 0xb61261791bf50bda, 0xc9bb486bbc048ce9, 0x048e873ab4b0d96e, 0x986e83dfa33091a4,
+	 0xaf4b2b4caa4249ba, 0xe07cc5270a0e0040, 0xb2e9bd1d2efd455a, 0x1a185104dca7f50d,
+	 0x5ac18b192c4fb2fc, 0x51c1af2a8d62bb5d, 0x28e9fc361a219440, 0xac2a916fe984f79b,
+	 0x9233aeec42b5b4ed, 0x68b3b3873ce4b377, 0x07f4ba1bda4d73d2, 0xb114f210c9c9e1e5,
+	 0x9a71729f492442d0, 0xe4ec1b67cff05aab, 0xacda9a509425e579, 0x6842938d1f642dce,
+	 0x58834dbfa02abf4d, 0xe2aa432497cf496c, 0xf79d410a08919b95, 0x3aca5f50f109a255,
+	 0xcb94699bbf1bc208, 0x4e7d5b0ea2995719, 0x9a29aa5e5ea1d48e, 0x4ac0272a9939c9c9,
+	 0x9b36f89aba43b62e, 0x0f308ba043d4188c, 0xa6e1cab5bc90cb21, 0x2828c2cdd17b2760,
+	 0x1c53dc8023f93967, 0x9d701f3a55f03d70, 0x7431aac95b33c52b, 0x1f945f51898371de,
+	 0x83843d831d2d3874, 0xf0a10bcc38f8a95a, 0xbb97319a286e25e5, 0x18cb83192298e98b,
+	 0x3eaad43f08bfa7b8, 0xf35490b0145b3fba, 0xb259bd7339290896, 0x1967be8accdaf5ab,
+	 0x7d675633d31418d0, 0xe13d9a8eb9b29e3e, 0x99d9e21b355d26a6, 0x59e0e4f97c70c486,
+	 0x02ef47bf710f6c44, 0x9b744427f74b1430, 0x1533c22a9373177f, 0x2a3dba8e262b3b7f,
+	 0x56a64d6dec652c90, 0x8d5ac1a3ff882c3f, 0xbc4919bead06364b, 0xaada618ca17538de,
+	 0x17a19de4a7a0d36c, 0x0f64b21ced9d60ef, 0x59354cc3202d1bf4, 0x5cf2f9ddc647da3d,
+	 0xe3e9bdeebcf9d061, 0xaf7fecf1f073b020, 0xa47d3e5f8c9ede6b, 0x6b261f35fad25e3d,
+	 0x32c2856cb07d0839, 0xd53f1174eca1c2d1, 0x1b5b3a06318c84a2, 0x6d4e540894f957c6,
+	 0x4b0b97b1f681e5da, 0x1a415c975dafe111, 0xbc455c742a2ae436, 0x0bcd999e82df529f,
+	 0x55a756d5d6f87e7e, 0xaf5bd6428b887f29, 0x36d6eba1b8602131, 0x0b009d2f169305b1,
+	 0xad46e5bb8bbf99ea, 0x6809f47aa03a493d, 0x7f9bfc0732f541d7, 0x9e149b39a4477894,
+	 0x4f619033cc69d58a, 0xb61f5c397734b719, 0x222efcdd1e954b10, 0x6859db3975bcb776,
+	 0x109b279027706392, 0x485c6396c78856e8, 0x56f2ce5a08674a8d, 0x182ebd4b8f6d4ddd,
+	 0xae206fad6028ffe0, 0xff78732c76cd3416, 0x4d7cb597eb17299e, 0x50d7a10a154579c7,
+	 0x8928b784ecbb2fd7, 0xebf308103f81723a, 0x19a46eb1e94ddd08, 0x6f05240a3fd1080d,
+	 0x0aef992443ea7fdd, 0xfb91efefd328b121, 0xec90b709ef955ab5, 0x555ca56d942dad74,
+	 0x4eaec0eda814da89, 0xe9eecb7bb3f62ac6, 0xfb528534ace7609e, 0x2fe9d69670776c9b,
+	 0x66ac30dc4ab005b9, 0xd76a3c76bcedda0a, 0xf159a4a181e6b3e0, 0x28acd68785eab4d8,
+	 0x79cd5409da715c03, 0x633c28ed96701a7b, 0x0a7d919f2e700f5c, 0x8d93921cdcece47a,
+	 0x6ea54e5720aee055, 0xc7b2686cbc18635e, 0xf048c517417a9470, 0x9e2ceb86ac5d44a2,
+	 0x67843858d2f0ec64, 0xdc3a008f2c326790, 0x662a42231ba692eb, 0x8ef5caffea770eef,
+	 0x6a2c81b998fc0813, 0x48b1e3bcb27dc111, 0xda74535fe969118a, 0x3c8fd7e3f21b473f,
+	 0xe207132f5bd8801e, 0xdad9c536e318feb6, 0x1ea18980563214af, 0x317156ef2ce8841b,
+	 0xada20f891df1657d, 0x77abe668d525e2dc, 0x2e75ff8b40a5c823, 0x12a23d016cc67e06,
+	 0x0da01efcfc766c60, 0xc2907a52df967051, 0xed89d50f50b8382f, 0x030ae69476761e3b,
+	 0x9649a969fd22eb1c, 0x77811b46a47994c5, 0x139e42d9b051b3c7, 0x76a82c8e94707c44,
+	 0x1c61991e85e22047, 0xdc676e2a65f41d6e, 0x20efef7daee79fce, 0x79da85f0c2dbf30d,
+	 0xb5e5fbef5b01e4ae, 0x716b51e306f449af, 0x7f50fe5c7acb8d79, 0x9a96bba5ca5a1008,
+	 0x7eff912688d76af4, 0x48e4cd1cb19977d9, 0xb46bb69bd95b5469, 0x0463ddfd11dc6d71,
+	 0x13b7282f94186713, 0x06e0a1a5dbd393c8, 0x508ae93568614525, 0x6c8bb437d58180ec,
+	 0x68ee8cc59886fa33, 0xad2e59024e02d180, 0xcd0327218af5080a, 0x9dcc5164686b67ad,
+	 0x519389526a442ea2, 0x3fdaa4dc189533b3, 0x1f907bc29558bdd2, 0x83f044a8a81811fc,
+	 0x750cfbe809304f9f, 0x898039001fc4140f, 0x7d7e7fb85da89596, 0x9a2f9416115dbdad,
+	 0xdf49960e644d5a5d, 0x2605650877070da8, 0xc0a55fe40417f342, 0x882a50d6b8c71c03,
+	 0xfb81ddea31b37711, 0xbb58e36d588c988c, 0xea835189214feb28, 0x85180c1d6f622b8b,
+	 0xb10140ad81406273, 0x4a8757aa3256a7fa, 0x6dc1d2a3cd614368, 0x20c02df6e761e696,
+	 0x0e496a3bb4ca95ff, 0xec44040cf4d732aa, 0xe1505ff8927e16e4, 0x3e6390046e9eb3d9,
+	 0xf49781085d5e0a5a, 0x1bad5bf78a325467, 0x3046c80ae7cbe9ae, 0x349f7cda0d0df857,
+	 0xdce5a4785d5e78db, 0x520de63cf99d8583, 0x53367c14bb53c5f9, 0x7cb078735a36938a,
+	 0xbd6bf83b7cd5819a, 0x13bc78871edcfa99, 0x83e2a84086530c55, 0x3871d4207f32a998,
+	 0x44310171fda63482, 0xe199b5ba99dcab3e, 0x7059164c3249ee6b, 0x99a5e0aa85f5555f,
+	 0x41fee945b97783e8, 0xca4230467c64d181, 0x6c33812b7d5a38b7, 0x62a0f5e65d74e9a1,
+	 0xcfa62d70edcac994, 0x5e3ed19659a20c63, 0xe033360ad4695c29, 0x2f6c1bb8ca4dde68,
+	 0x65ab0976a57e83a0, 0xa9e980016d7f5e56, 0xd9a4207e3c120919, 0x0d8055dc7e4d1bb5,
+	 0xb63097e1ce913fd2, 0xfcf6d88a5b81371e, 0x44369ceaaf7d5212, 0x5a0d384f76f8cc1b,
+	},
+	{
+	 0xd0f8479396d854ff, 0xa2a23a2a59f78ba0, 0x7c198a7b016c2705, 0x094ce233c42a41f9,
+	 0xd06e476c821e92ae, 0x950816b577b0403f, 0x68fd77a2af2da96c, 0x5a756edebd055bb5,
+	 0x99f45a2a951c8f68, 0xe73b0aabc3b57bb8, 0x97911df5e2333929, 0x2ccc6947d084d3c2,
+	 0xea9321f51b14358a, 0xd6bfafcc092bbe76, 0x7d44162205511e42, 0x941fed4f72101338,
+	 0x435da0d07788a345, 0x4bb51f6557997bc0, 0x3fa1d4550c7eb3d5, 0x4081acfd2029208f,
+	 0x61506095516952bc, 0x7b76e2d5cc94a64b, 0x81fc3a96c51de901, 0x27b46a119214755c,
+	 0xfc1c8ae5883b47e2, 0xed16b8db509fd3a8, 0x996b958d504ebf55, 0xa9203dcd8b1b20a5,
+	 0x2142174f14dad1e3, 0xcbcb73220fd8b344, 0xcd0ea5dc34250eb5, 0x18290671e96d4aa2,
+	 0x9432aa9a5838428a, 0x2f7b3b251f954017, 0xba01416e060614e4, 0x976229ea81a71f7e,
+	 0x9f7fbc3c96d83ba7, 0xb9ff9397905b5ca8, 0x36054b8fd70f0fd6, 0x5119ccaa94efe58c,
+	 0x8334f6b56e3595be, 0xa920ba17c567e3e0, 0xae22c0ebd0188891, 0x465089c4d17d4e16,
+	 0x22f694d463b96513, 0x8329a6d0c5d98232, 0x79d53724802f5554, 0xac7a50af6d3354c3,
+	 0xf3902869088be09e, 0x8d040891e7cb64a2, 0xb4d5a80e277d6b57, 0x03b60b63fd1d308b,
+	 0x081714353206e7e6, 0x9f1b3b45e9ba54ef, 0x8a45e7556dd4ef2a, 0xa4e17c0f71ead316,
+	 0x09eda40b5e8d9070, 0x965a811f2aa282f4, 0xbc936a346aedf9e6, 0x6764420175182ba0,
+	 0x3e9c426028f89bd8, 0xd6b69bc8cea6a3ff, 0x744ce423f8f43541, 0x89e68e892ad69c30,
+	 0xfa1c4f57f4af8efd, 0x2df353e405a4c189, 0xdd563e26bb0f509d, 0x5fe25e7ada07c71f,
+	 0xc8d4f8f702450107, 0xfc476c0f3ac8d378, 0x42d13e5f3e3f102b, 0x316b6dc041d3eab3,
+	 0xdce74c823c64c00c, 0xf68383c0342304fc, 0xfbaac52791aed07e, 0x3d0a13789065caee,
+	 0xef4612dd0938087b, 0x2eb89361b119b2dc, 0xa8b9726ee3c12542, 0xa831d9fb540400bf,
+	 0x03d573de0f6aa526, 0x158b390ad8418165, 0x131d6c04ba2e969e, 0x4dac54f9060a1b1c,
+	 0x8a58345d2389ff5d, 0xb1ba4ce9303b04ca, 0x28bc87212d7bb212, 0x8859e394bd51cae0,
+	 0x2e9603b418a30af1, 0xfed8e3388a24cb64, 0x42c5a2863d2ff272, 0x774938db6c771792,
+	 0xb609e4341fcae510, 0x9af4a780119f9177, 0x2ee27517e83709b2, 0x1ae3d5872c62fe90,
+	 0x667451a7808cb01f, 0x02d8b1d34b80221d, 0xd43f5fad694ff4a6, 0x06ab8b066c8273c9,
+	 0xfde50d5c49b41bde, 0xd963a46f422fde61, 0xecfaae0bf68634bc, 0x271e2c84d13a61df,
+	 0xe7d107ae956f7935, 0x12772ac09f072563, 0x478b6663e7edc0e4, 0x6f1250afd2c4c518,
+	 0x9f65a326399565b6, 0x6f61a25655437e21, 0x0fdcece18b8b69a5, 0xa098c4e6c73e4373,
+	 0x4fdd86594527e2db, 0xbc0c09d97b0bbc59, 0xb2516103c3173dc0, 0x74b1c78650298f4d,
+	 0x2cf283c2fcd7dd96, 0xf23b650acd12ab4a, 0x86c254a592e2cbb7, 0x364b5769a4b2bb60,
+	 0x9dd7d8c0a29cc45c, 0x9c688872f4da1dcd, 0xc90a49c6dee1d5e6, 0x046daf8ed69ae3bb,
+	 0x0813f617bf4e0034, 0xdb66780da9356634, 0xdfaca95b663f2e39, 0x74670aa9ee31dd14,
+	 0x4db4846a378bb5ac, 0x0ba9a24d78c35c75, 0x7ea50c9f0c55357f, 0x2fa472da9c07a1ef,
+	 0xbc010f1e6a359f3f, 0x7cbec20d42cee380, 0x531217166090309f, 0x5cc1d00f5f2d00e8,
+	 0x68df8db70b0001cc, 0xe7f9576586c423c9, 0xea07690d0a665bc1, 0x40b1081de53490e1,
+	 0x02bca0788b356e0f, 0x50a255365d5175dc, 0x0a6c8b2380f4bc1f, 0x4eb3e4afd0b366e2,
+	 0x62ac1454867a3a09, 0x05532287aa0bd720, 0x5c3eee30f6e5ab43, 0x4c66f2367993d865,
+	 0xfeeba799dcd76392, 0xfe1add715fac4db3, 0x380c6c0008c6d6dd, 0x54fd0519c69e140d,
+	 0x5d4a0be6ae2e0f99, 0xd0648147657a6e2a, 0x700ca9d018784609, 0x305894ff93b6da34,
+	 0x15130237191315e7, 0xec769b6cfcef86d8, 0x8e4148bcd7a60cb0, 0x37ffc520311af0ec,
+	 0xfbae72d9a9cf4e28, 0xb144442140f66743, 0xb48877c6f0aac9c4, 0x6f67c3c918d4371b,
+	 0xec5ab0fa50601a60, 0x254ca7faa6e88191, 0xcb8a9f7744aee4e2, 0x4d2e5bce3e912fbf,
+	 0x63d04ec093d52a66, 0x6ca33689dc2ceaae, 0x53dfda74f51c5041, 0x1af9bbb75f1b9df2,
+	 0x86ba98b6d00a89bb, 0x06a3dff335f4e94a, 0x53199a812ae4e924, 0x815e8c821ab94c25,
+	 0x05c9b57d2ee87eae, 0x6e9da80924116034, 0xf9facd9869798b1f, 0x714be77e0446cdfd,
+	 0xbadacb3493fb12db, 0xa3d0a315718a3b16, 0x4e3964042786a889, 0x17b15b65f0036922,
+	 0x8b2b4a7177657d17, 0x168fa27c7d948451, 0x094e00341e578baa, 0x17adc0bac5e5f62b,
+	 0xa5f84e839adb0ab0, 0x9b18c61be31a7770, 0xdf45615e191d4de6, 0xb099910a3f840d52,
+	 0x9c6ece43e530dbc1, 0x6ee3d7b31496aadc, 0x2c70a0da9699570b, 0x80db0aaf64f2e6bf,
+	 0xd473e82f69dbba5a, 0xaf2f155a165caaa0, 0x20b5f559b0b465bd, 0x262ea7d5659d5625,
+	 0x6b8bc0f625ca6a3e, 0xc299549c3cccc902, 0x6df5441abfebfb84, 0xb58b54d493cd9fbd,
+	 0x2627e47aaa2e8f30, 0x0d106272c861ae2d, 0xe9b8a14e09738d38, 0x1051506c3d587e3c,
+	 0x12ee15068eecb907, 0xc0b0b51cd148b0c1, 0x04841b387c9aab83, 0x6c92b5e9a3c0acbe,
+	 0xfc09c9a34bf4fef0, 0x4b0582f2e5b7ce53, 0x7517e77d2380134e, 0x51a27544e959b906,
+	 0x00e63817a2f9d74b, 0x00f790f730d6ab8b, 0xd14fae7916ce7484, 0xa1206e1aa9b1538b,
+	 0x19f6d9755f21ef90, 0xf99d212aad15e781, 0x286a88da1b3f996d, 0x9032900f21f28ebb,
+	 0x40111b708b814cc3, 0x32ebaa6c00bdab4d, 0x1b8e955766202685, 0x9cac4fee42c9376a,
+	 0xe7be0533011a63b1, 0x0603884ac8ad63c5, 0x00cf8af56b7e5d5d, 0x05b690bd1395a8f5,
+	 0xd6f4d36ca42c2bdf, 0x82998d49a209bafd, 0x026e6a855700902d, 0xb5cb7388d1096e55,
+	 0x87bb73752b4ed4cc, 0x227d57305c271c28, 0x4594dc351f96f295, 0x91bbdbaa3961079a,
+	 0x6d2372e9c249dfb8, 0x878a2309a092db30, 0x6698a393862b8038, 0xa2739e77c0b5fa88,
+	 0xbdf80796cad19067, 0xdffe6fed9f382dc0, 0xa195673b4b64c3bc, 0x8bb57a099e36ee62,
+	 0x97eaad5dc195ec29, 0x42fda81cd695d746, 0xe9ea94e37608061b, 0xa246589c8da71de1,
+	 0xf20e2fcde37e2621, 0xf1dd8ba23ac02fbf, 0x3b59410dedeb4b3c, 0x9ebe9270dcb91ff9,
+	 0x83510361f2e16b9e, 0x908a49acc159638a, 0x22bcf3b720bcbee7, 0x01f99608db448e12,
+	 0x787cc54a217fb3d0, 0xd73cd8953e582af0, 0x7165b8f2ddc15128, 0x3eb98fa6b047293e,
+	 0x333271d7410afd1f, 0xed722a1f46c0790c, 0xcd6d1b77ef409cf3, 0x7af80c1abcb37223,
+	 0x8ce910aca4e9ef48, 0x2f0a26c5c60cd0df, 0x8a8033079b59f201, 0x9a189b3b91a59805,
+	 0xdc1685d60d0ceb8b, 0x51c37be804e115a7, 0x72f047a7dcc0b948, 0x7153fd25ec0b74bc,
+	 0x4d84b5db3ec3f9bb, 0xd31eba33c73975aa, 0x67c8bb2b0164cdd5, 0xafb857ccbfa29005,
+	 0x78d479138c70460c, 0xea035af5dcac8e4f, 0x57fa539e4d82d9e2, 0x27b40fe17e74fa4e,
+	 0x37108f263d82e789, 0xcf8e20fc3cc7aaa3, 0x3aea128a0c8eecbb, 0x4cacd22109b56634,
+	 0x4d68016ed4aa8942, 0x1c4c039dcf6aef1b, 0x3336f385dafc7f25, 0x116ba4b4ed304952,
+	 0x54fe99efeb7d0e5b, 0x13ada3aafa5b6f5f, 0xfbf1897e97f63b25, 0x12f989fbfea30c90,
+	 0x49f2617492cf1872, 0x9f475e3a840d8676, 0x36d725edec207242, 0x08174ac3a1a2ebdb,
+	 0x83ac7da68fd326f0, 0xeb483cd8b017a32b, 0x345a44a36cf49102, 0x9bfa4087d20e01d0,
+	 0x45b5b07573df1295, 0x67b236b3053df7e5, 0xf60fc6a8bdb66b2e, 0x742e5aebf24e65db,
+	 0x07984e86008e5191, 0x3fbe3ee4b732c946, 0xde1a8842163ca435, 0x5f84d5636640e231,
+	 0x11352b33a4f31edf, 0x7fbaff73f64be14c, 0xe2fa5f70dbbd67f7, 0x1fdcf49a9d8c2b74,
+	 0x2ff55755c9b2347f, 0x1c1a84e28837688f, 0x55f80a63a364ed64, 0x1ab217f9fe78a6f9,
+	 0xa621615d2644971d, 0xfdb21d174b3607be, 0xf7af30297f41dded, 0x78a5a8ddd3832ec4,
+	 0xb20f6790a419db43, 0x72430960480a4e55, 0xd12698b29bfc10de, 0x7338d88f4fdbe489,
+	 0xd72c91c6e38ed38d, 0x22b8ddad2ebe5da8, 0xd5d482588a5451cc, 0x628fb854d5114b1f,
+	 0x6f2daea8fff3f147, 0xa1989acc9d264ec3, 0xb1697d4cbfbae9f2, 0x676c2fea50b8ac9d,
+	 0xf6490a992aa77904, 0xac54cbc02ae35dd5, 0xfbf6bcd63143b91b, 0x536384d9f25e97d4,
+	 0x35d4a65f830cfe18, 0xa8a88c89dfa1e0fb, 0xcfab8e24744044a5, 0x8fab738ed87151f9,
+	 0x2e173309ddd04608, 0xbd29340922c97333, 0xefe824d48fb395bf, 0x4454289131ef01d5,
+	 0x9268bf89aa2c7bd9, 0xd0209f0dff91f4ec, 0x888b151bd83741f8, 0xa8026a94511b7022,
+	 0xf1da287076c08f77, 0x8aef3c19114c791f, 0x970ca055221bd8f7, 0x944aa681bfb5a1f8,
+	 0x9dfe74f294497292, 0x08074f0502e3e6f7, 0x9e95eced42d82521, 0x18ba96740b6d3a9c,
+	 0xc42d8ec5c052a100, 0x60a7cd3651f14514, 0x07d4c72dd3097852, 0x3de05feaf524567f,
+	 0x05475ea145af9616, 0xaa2636d7666a4184, 0x1ae6bd089851876d, 0x72ec282be93601d4,
+	 0x94c910c9ceb9a224, 0x3557928297a241ff, 0xe0d2433c45158c61, 0x5dfe25b070a1fa1f,
+	 0x17ba0e41f56431a2, 0xae4439cee083f16d, 0x67cb0db8ad5207f8, 0x68d47081a1cf4c96,
+	 0xd626da59733e4d60, 0x2e493cd27edf32a4, 0xfd7ffa1459cbd853, 0x9c91a088829feaae,
+	 0x64e23bf5560fa2b1, 0xe87cbec2f675d375, 0x9d67a2bd9fc7df36, 0x8182cca921471f10,
+	 0x95f1646678a63ddd, 0xc8c58e5ee31d0e8d, 0x9839e307c6467b33, 0x787923f7947597d5,
+	 0xbba7ce6ea3dcc69d, 0x00e2a1aecc737071, 0x454621521174eef0, 0x686c57cceddae3db,
+	 0x728f7c8a18a0a62f, 0xf510dbe4ce32eba5, 0x26af08475ba07c29, 0x5e6b1c7c2cbd9852,
+	 0xf55fea51cb2dad64, 0x2d7ff3f16a369829, 0xaba59cba54e66c97, 0x9e0a65ae03834f5a,
+	 0x1e0c97e0933c5146, 0x7ffd1511e84b2cff, 0x97dd7895d786d617, 0x6e2afd021c1a83c3,
+	 0xf0cb8032f55b83b4, 0x2ace5e3b058877bd, 0xb4a50f52fbcc7d35, 0x5a3e0118faadbcda,
+	 0x62f3bc44f6614336, 0x5172ac28891a9a14, 0x96f19c0b14e91e32, 0x2126d1892b20c0d4,
+	 0x023de091a7b8fba3, 0xa8b8d991837868dd, 0xae60f9a979ec4a42, 0x3175ab5939e58c38,
+	 0x180a55c570bf07d4, 0xf558729deab7fa89, 0x0c86275d58f0ac51, 0x3ac5583bd764a89e,
+	 0x9cfeeff95682f19f, 0x260fe0002bd32818, 0x59e7d76e1162b076, 0xaefde84ae17bba23,
+	 0xd723af51d03574bf, 0x73f125eecc2a953e, 0xc2e18c3bffd43ab9, 0x977425f33ad54382,
+	 0x603ffbe31390acee, 0xdfedd1a612507c04, 0x31b857d02a7378c8, 0x699754bdd169d052,
+	 0x769b59f644765367, 0x3284d5992afaa97f, 0x1630473826a9196a, 0xb58d97fd3f027784,
+	 0x6055740079f50993, 0xb02ff4a40ec17bb7, 0x808e1d4436b02fb7, 0x9d05d7676bfb3b3d,
+	 0x9893462975033c41, 0x89e99eed13036488, 0xa577056c25be9c30, 0x513445237259d579,
+	 0x05825885ae0d879e, 0xf49d9e2c1c6309c1, 0xc319377175784fc0, 0x14913fd690041e30,
+	 0x1811862ac437fcb4, 0x2db5c221f97c6ec2, 0xe6192217acc09059, 0x830a85b2b534391a,
+	 0x65deb5c82b9ce631, 0xf94a6f63f0633650, 0x4a009c92c0d2a04c, 0x42f9cd54cc261ae9,
+	 0xb979b96d67addbe3, 0x4d31fb1f1b893d18, 0x6e3cefa17c174003, 0x806d3af116577cdf,
+	 0x589a603406ac870f, 0xabb8f6446505f9bf, 0xf114680a3fae4289, 0x13cc7e9e416f7d3a,
+	 0x1203dffb17ac8b6f, 0xb3fa71e031153de3, 0xd7d5ea894b2df24c, 0x8da1c002e2581082,
+	 0xdaad5006ffd9c9b9, 0xdbe11f93252f23f7, 0x70a8f7ae4cf1a08c, 0xa02ace185e0a4da4,
+	 0x54908753870b5bc6, 0xd6f72babfa7f2763, 0x636add83864d7ed3, 0x76fdead345994be9,
+	 0xbc85fb646e7b79f8, 0xfebeb385dde6447c, 0x0526c58c6ca2c3ab, 0x566dd034a934a224,
+	 0xb728878d130f274f, 0x6f2f2a5750efa66e, 0x54f97b80d4304938, 0xa3b7ba3021a7d703,
+	 0x62278e383c1d1c8b, 0x084139f3eada11b5, 0x6aef45064cd781bd, 0x0f4fc2481f2c7845,
+	 0x246c9f773d6fc3bf, 0x625d2e73cfb281d2, 0xf6bc4453a37571bd, 0x02591fe9ddd0b50b,
+	 0x42fdfd452d243e77, 0x722d825740ecdb0c, 0xff77fa7407c5a9e0, 0xb61732fce9fec2f1,
+	 0xac8c8478534e0963, 0xd06036470e0e691c, 0x2d3d975d5b0a8590, 0x73cc7bc8963f427e,
+	 0xd51456ce8b546f3e, 0xd719a60f0c3270a0, 0xd2fbfcf05fdeefd1, 0x41f664523fe0ccfe,
+	 0xc2fd7e6fc255700f, 0x616536334904539b, 0xa67f4bf20f3fbe0d, 0x2d7ada5a311a227c,
+	 0xe8a95c2beba07d84, 0x49d703384e061dc4, 0xf9e353d94ba6ca4e, 0x40965ae7a98587a5,
+	 0xae70952778384cd3, 0x26e3f56197a144d3, 0xc2ae9918423fa1b8, 0x57e9e67d13a2c36a,
+	 0xc223a0d277fd23b8, 0x4fccffb75fd1d28c, 0xebfce57b81102d74, 0xa2c8138a9969a31a,
+	 0xd5fa5188b252fc66, 0xfddd984812203be6, 0x2d7c82cd2fcf95b4, 0x40c78d6b80907853,
+	 0x1008f33c8b38d272, 0x4404c491d00ca522, 0x52beb0797e9ee0f6, 0x1cfd863b9aeae361,
+	 0x391adad873880e49, 0xf573f336d3e8658b, 0xecc18e52bb4600a8, 0xa85e33f07430b6c0,
+	 0xff46fb641db2f531, 0x61327b7e8f2ccd2a, 0x2f12f2539099f290, 0x67d6924ece73017d,
+	 0xa53d64e30201a05f, 0x9a257725bbc8cbc9, 0xe83cfb0a823e1420, 0x37a94712d4af0caa,
+	 0x9fb80e9af7818ea7, 0xe14934387e6592b1, 0x2085de949d56e280, 0xaf7c46da98c9b247,
+	 0xff546619c4e089e0, 0x3415755365e81e85, 0x728a4140d96d5f26, 0x98c02011f16bde93,
+	 0x35f405bb7b3e32ff, 0x3d080cf94ab5fc87, 0x2be2d8fd0c2d8c57, 0x869ab442e583c36c,
+	 0xe18f5ff4239cb09d, 0xd9a7280f17501655, 0x178d688cd11e9d86, 0x2a8395d8f844b4ee,
+	 0xf65cb6ac68ea56f6, 0x587ca0e95083ca73, 0x1beb6c0ad3eaafbc, 0x8e1b7232d5d87eb3,
+	 0xfaf44a07606f5e7c, 0xaaed5faf8546105e, 0x603b4532db1041ff, 0x439a3509a040312e,
+	 0x41e71d6f66ace2f5, 0x079e39520b6779a8, 0x75b4d22476b305fb, 0x46fdc59a5c25a7aa,
+	 0x32f6396014165d3e, 0x45c964e4715faa60, 0x8308225a571d461d, 0x71e6e5c7322163b0,
+	 0x1aaa2bea2c8446b7, 0x6b397e32fbcd2f5c, 0x8c050fa94c43e778, 0x052c68e016ddbfb3,
+	 0xe65e09918fbaab4c, 0x296d988d001141aa, 0x6f05b0f940b9d083, 0x95045f5a2daa1396,
+	 0x0a812d43ea859069, 0x93e8d842ea56998a, 0x077fc3d66ea66191, 0xac45190734685f21,
+	 0x72bcf2fe7e858af4, 0xe7a745704d5e07f7, 0x9302c12f94094d20, 0x7539ccbee87b08bf,
+	 0xc22b94f3374d6373, 0xe32cf0cf73a797d1, 0x3284231cd222b209, 0x368e7a100b333fd3,
+	 0x68a721f04e9db69b, 0xac296871842271fd, 0xb0f3c8218932daa1, 0x913efa1d0d2b107f,
+	 0xa5bd6f8c35aeda0f, 0xc5688c4ed8255175, 0x87ae1f05528e3e7f, 0x060fb2415851e6c5,
+	 0x26eb4681fa3c0ce8, 0xc583aa96086a4716, 0x18a72420b6f5f02a, 0x9e793cdc90b75bbf,
+	 0x5f571b546d0893ce, 0xa89bad03203f36ce, 0x09038454e58999a2, 0x70e98e8633ffba7c,
+	 0x5e1f38ce777ba9aa, 0x08779a158119e4f6, 0xfd7b012066e208cd, 0x43a3647573df55a8,
+	 0x0a2de2c7f75ca6ee, 0xa49f9835d51ae8e1, 0x067086f72a104240, 0x0f022605c039c291,
+	 0x88d5386350f83613, 0x2c917582f20f2823, 0xd08ee19509d8748d, 0x8f6b6daa10c7ef12,
+	 0x364267ad54a05ff8, 0xb31cdb5ce68ad5a3, 0x9aadc5c4544584dc, 0x79aba1b9594dd2e8,
+	 0xa5ab88b23f5be9f0, 0xf71e958ebdc78396, 0xf69f82abb554f7b6, 0x90d00df98788de36,
+	 0xa743bf8329318561, 0xe0a32ac9df5b88f5, 0x41e77f0eec621996, 0x3105ab88cab18fcb,
+	 0x54e48b652037ca63, 0x2da011316db8faea, 0x902760e1931fe712, 0x572cb828e644176b,
+	 0x83378c3012f83688, 0xbe0c926d9ce5cf1d, 0xc344c79bfc0f8a6e, 0x694cc0587fe37a06,
+	 0x6909ac2b7db1ac0d, 0x5e0cfdced23b2268, 0x737f330ec11fa9c5, 0x8c478ffd1a97ef4b,
+	 0xa5489481f8558ce6, 0x3e700315ade9c035, 0xbc67f890dc1b67e5, 0x497f7c686684f8e9,
+	 0x55506ec36acbbf1f, 0x0556c4f9bad42b95, 0x77d96ca1b4bf7fd8, 0xa7546f93d92d88b0,
+	 0x521a0d923a057c37, 0xf6748901daf609e4, 0xe0c4975e4d44f9bd, 0x19a03f90ec48859e,
+	 0x86202da070e2a3b4, 0xbba9d3d772609d75, 0x7238867e9c69accc, 0x7b2d1725ea633ce3,
+	 0x4a43874f64747e9e, 0x9197964845329f5d, 0x4f388704af4cb958, 0x6733674d34f3df45,
+	 0xbabf24e052837bea, 0xc35b17635cf2b51e, 0xeb6c342004032070, 0x82a4f6a23bce85a4,
+	 0xe417f6e22fd93e7b, 0xee9d95332c66013b, 0x7f3c59b9659e97d8, 0x78cf0dc0f7e81a6d,
+	 0x19704a568c646ec5, 0x78c59af759799924, 0xfe85ac52b0ca1893, 0x6a26e7a0aa5b9872,
+	 0x6015ccb7cb7db61d, 0x380d00ffa26b21f6, 0xc553d86716a689ec, 0x3b064851594e9104,
+	 0xb0754ca2f8b30e8e, 0x2037331b260ccc3b, 0x0dcd5e6c677459aa, 0x38af18d4181fdd28,
+	 0xb34c5708fdb45bc8, 0xa6b61c14dbec30f6, 0xfe6ac08e4cc6d9fc, 0x8ea38642d6577c4f,
+	 0x3f2a6a587249eae9, 0x85a9d7a28fec1662, 0x7b27c8ef69488219, 0x69e5705307c9ff68,
+	 0x315fdf18c9d31190, 0xe45611eb5260333e, 0xce9d1923ef2244a8, 0x299f6cfe8a487d68,
+	 0x085d300135fc0730, 0x3c9910cac9ae2f68, 0xbdb11067c91aec3b, 0x5d90b10f9ea123c1,
+	 0x820e797abba3a6a6, 0xe45d9b3bd1c639b5, 0xe41205008135ad93, 0x18fb07f171a51711,
+	 0x25a32bf922bc82d6, 0xc5874f28f637b105, 0xaae9371ac19047f6, 0x376c054c6e12ab9f,
+	 0x903f460b1aa68e11, 0x23226a7dce97bfd2, 0xfba5f8fbfe4f94a1, 0x48712ce22da25438,
+	 0x755706062fea36f6, 0x2a04f13038893d95, 0xc112909cba79dc08, 0x4779262e4d580017,
+	 0x925d46c1bb2ad06b, 0x943b7ad89f12d3fa, 0x98593495fbbec183, 0x7765fb3fafd386dd,
+	 0xa464cd31090c4c6b, 0x12676222e0b83aa4, 0x704cf002fc3f07fb, 0x5383eb805c5ba8bd,
+	 0x37c1b971bfd1e969, 0x28bdc21752a87154, 0x37e373b4afd4337d, 0x30c648222e66c331,
+	 0xdd78d63cbaa045ae, 0x4640441164bc25cd, 0x4f57e5727f20aca3, 0x3f695094316bf60b,
+	 0x347ec6609934109a, 0x3781de19cbfbd881, 0x412f397fa801e7b5, 0x11dc65b064f33560,
+	 0x6da1c0fd0aa906c2, 0x84725f77b7726972, 0xeb1730c42064dc53, 0x381d725e797e3386,
+	 0x9f4519cd9c56163d, 0xd5841fc1ad138340, 0x0ab2e5b9b7b940cd, 0x2649ade23c84a7e1,
+	 0x939f137f6ad3f5ef, 0x03cc4720312c1d6a, 0x779df61924545c18, 0x41a0f6b568780774,
+	 0x6b2bbf9764570aa9, 0x0a19e3b56f33ab5b, 0x6592b0f00f4ee2b1, 0x77a0efbec2853395,
+	 0x14f78cbecbdd6355, 0x3a02f1e615d4042a, 0xecea7ad9ab7c18bc, 0x69c3cf77ea320514,
+	 0x43795b1b41212d50, 0x912a8937d150e857, 0x868ab06dd5a913c7, 0x93d58fd7ecc0f27a,
+	 0xb036273c0cb2e422, 0x38fd05de8c2e00c5, 0x65d71e7e62f73917, 0xa35f6db89ab4e49f,
+	 0x61e2d38ece34a34a, 0xdcde3da75a3692c7, 0x3c7b5f69a3056d95, 0x9358c63ba7c3590e,
+	 0xa06a2ad28217bd19, 0x3a56144b899f85c8, 0x2010102c308e6509, 0x2f5fe74aa38c5f45,
+	 0x92284d4a15524ce8, 0xc8f247e3f6a41182, 0xeaff51c9b16103ea, 0x3c49efa1207a563a,
+	 0x6a537f6e59044bb4, 0x2591a3bd81f4793c, 0xdb20199bc638d94c, 0x55433efcfbd742c0,
+	 0xa0dacbad6e969555, 0xad07392e68acae9f, 0x6584c908f9fa7c04, 0xa41bf23b2fc191a1,
+	 0xa29595839ffd52cb, 0xc03bc602ea85a064, 0xd5686ec452d29379, 0x7c431588127ac507,
+	 0xef1fe5fa6937ad13, 0x49059baf80ce89db, 0x97bad67146f2c5de, 0x59b73979e195ea49,
+	 0x081729759e36b0e8, 0x3864074942cded60, 0xe83b36fc20563760, 0x40dfcf3528a9eeb4,
+	 0x077007b336902461, 0x6ce49ce21a1347c9, 0x38c7e34026e270fe, 0x29371f9c73ddb043,
+	 0x51bccb60fb6edfc2, 0x13af60fd2e9120ef, 0x5dbbcc139132574f, 0x87b67f3bd9d50515,
+	 0x5b0e55ba5fd3512b, 0xdd8ba9df0156e208, 0x15fb0431dd7a6243, 0x6bbfd5f2e6b4e094,
+	 0x7559bdd4cff24d40, 0xc3df7c95bc397b69, 0xe323ecdc1ab80bc7, 0x57f1b074b647b07d,
+	 0x0074a28d9f7f4fe9, 0xeee1eaf24466880e, 0xde486d632f307e1c, 0x4c75586f3c44c036,
+	 0xe6f5729225d6bbbb, 0x5cac01584b62e9cb, 0x5f3e00a85aed64c1, 0x6e4fbc89debb92d9,
+	 0x83d44ca8b40a3913, 0xad49672c8e90c002, 0xe49afd6c6ed1fb56, 0x6c9fd4ef25c6e1fa,
+	 0xdf7dace2ea3953ba, 0x0d0994b674e6d7df, 0x94b46c77576ed593, 0x21c96fa530ab1bc8,
+	 0x9ad0d8b924fc28c3, 0x0c6cb9042f892663, 0x902efff70143441c, 0x8c47be1f17df3358,
+	 0xb99437cc162e8c9b, 0x94c0a227b8f4fb0f, 0x0286dac7f053efac, 0x1dc75015a6839b8a,
+	 0xf72f44190bd43fbc, 0x39004f66a7e7248c, 0x643f19de049ce553, 0x939af46862eea405,
+	 0x759a5dbd8ba3f167, 0x85d424beb4b5f2ce, 0x25c41935263934e0, 0x7a4ee4499b950567,
+	 0xa0b36020878473d0, 0x1fb91de762b47f41, 0xf9ef0c01e918e658, 0x3643ac5bd89ad111,
+	 0xe684952f4631df84, 0x6f1c290b43cbebbc, 0x7d38d4d9c3ce8582, 0x185bac2f00ede6f5,
+	 0x8ad72e0908763a2a, 0x9a8c2840bfec8f74, 0x9570b9a7b909d3a8, 0x9d804246bbf69e73,
+	 0x9d98bb861263f79b, 0xb599abc9024e50c9, 0xf9fe07bf72d96872, 0x27e8c8681c3a5959,
+	 0x675c49cae0a1aa77, 0xe6e622fa8c67146c, 0xe33c8a2d9201dc40, 0x2e2ba0fa65f04270,
+	 0x93d6756e7875c511, 0xc4f464602db342a4, 0x74bd0ccb267106d3, 0x0166184429dc5e99,
+	 0xc3c6fcfd322d6a83, 0x42facd7db7b4aa0d, 0x4d8c58f190faf40f, 0x7a2f684073d6170a,
+	 0x3de50a8461b36cb6, 0x7e6e4b326febc4df, 0x85cb3c919a38eef4, 0x39eed495564e0701,
+	 0x49f8796cdd3d2aa3, 0xb27ca1ab351a5fd8, 0x862336825b3f7c90, 0x4ec6cac27d9eca27,
+	 0xcaca83451fa11396, 0xdf1c794059e026d9, 0xf2c7f2855f2ac9c1, 0x754fab68e4f8ab8a,
+	 0xb786194d28291585, 0x6e60b647dcfb9109, 0x6d6e1424095af31a, 0x7b3f2c9ad0882bae,
+	 0x9468527a45c59cec, 0xdd74141548f733e5, 0x25a98cf9401c5a81, 0x9907e47c83edef05,
+	 0xc39dc744a9b4bfda, 0x9e9ee1b85daa326e, 0x7cd1aee198eda489, 0x90bc883db59ab823,
+	 0x8d543f08b9651f9e, 0x9034b24482d1966e, 0xd9d20efb5a0024cd, 0x5a621d8c4e44bff1,
+	 0x82af8484b191bb08, 0x5e5ba2e0e7347f4d, 0x55db30917d7c7e05, 0x2b17b6c101810cc7,
+	 0xf1acc877ec91c736, 0x9db2ee3103180b97, 0xc7f00cee2b5581a9, 0x8a009445ad35c211,
+	 0xe3a0e172fadf088b, 0xf221b2671befd146, 0xad100ddb7479b8f5, 0x898021a03ff4772c,
+	 0x1ac15fe67b4a2f40, 0xb4e32d83f4d00c6e, 0xdd50314984a42468, 0x516853570f52df08,
+	 0x46f92abb69094bc5, 0xe3421fbb55c79eea, 0xcd61c39d095f191a, 0x7cc5a16e616440f1,
+	 0x4ee4aa8c0b929d9b, 0x5ffd19014f58158d, 0x539d391cdb02b00d, 0x265712d3a5c66e51,
+	 0xc968ff12a2affc96, 0x480d0159135ae11e, 0xc6456e52f8f408c4, 0x9ceba2ebb0070641,
+	 0x7a5c52da87b197ce, 0x8a8c7daa48807345, 0x353ddeca15b05b37, 0x5601038aa477174f,
+	 0x015761afcd37bff3, 0x23b1c514f0531e89, 0x45ca0e946c64e55a, 0x8eb63d8e9416e65f,
+	 0x507e363ba1444a0c, 0x5ed741b928ff3f8c, 0x68b885259956ba50, 0x3517c8144112ac88,
+	 0xe39892a69462ed56, 0xcf6c9666c810b3d7, 0x75dd15389a3145d2, 0x7ab70e76083753b6,
+	 0x1863fbef5911ef05, 0xaf9b769cb2ba90d0, 0x8280199be4c3efb4, 0x4701387f2bfe60d6,
+	 0x68655051ff40f87c, 0x979071ec73dc7d6a, 0xc3ed774e5b22685c, 0x823962308f9056df,
+	 0x04d0d6dd08533ee4, 0x5a3e95af03c2708e, 0x5659c64e95d5124f, 0x67b138b666804666,
+	 0xe0c724e67fcb7453, 0x0f5bb69270918f5b, 0x5903d77f2076e7d9, 0x6977aa13de1b31be,
+	 0xfdc24c7a9bbc9407, 0x4c27bce41d0b594f, 0x4c966da8b3c10563, 0x03c2b44764b351ee,
+	 0x8e653c9efd893dc4, 0xdeeb1764b9626731, 0x581bcace3478357f, 0x7fc92fb0fcf0f3db,
+	 0x097f3f5a5b65c8d8, 0xb9624c885cd9241f, 0x2cd47014a7250215, 0x732b6c3be793933a,
+	 0x84f9dba34def1ee5, 0xcdd00306434c8c5d, 0x5e38d4cd31bcc58a, 0x6b3a98e5b3645fe7,
+	 0x95bbcb24cbfc2aeb, 0x02930ea7834c100c, 0x49a4b15640ecf2b4, 0xafe563bdd17a16da,
+	 0xb7d034b801455284, 0xb23f15bf1274cc29, 0x38c05643252d5981, 0xa24ab47d6cae52c0,
+	 0x87c5d48ac235dedf, 0x74bd54a56f44c5c9, 0x65d07b16a07f40a7, 0x6172365dd62cb4fd,
+	 0x63ae20a95e3baa9c, 0x74f1b575c58ac052, 0xe0d27aadbeb764d6, 0x87084e0d956c24dd,
+	 0xd27dd58a816dea41, 0x57ea6eb868ad15b7, 0xcd4991b43098e812, 0x02f19c359d551629,
+	 0x3e484f01c72f1ab5, 0xa03d5e2308e85317, 0x192aa41d1d989c45, 0x0598621f0bc47837,
+	 0x26f8e950d196712e, 0xca9c41105f8ee6bd, 0x364baeac0393315b, 0x6686c5f0c6ccba39,
+	 0xbae1f63c1cfb3217, 0x41154060059053ee, 0x88ce63bc2d42d5d4, 0x4d06bcdade134538,
+	 0x0f7d97fd564f2f4d, 0xd842c693eaff9a80, 0xe6b9c3b489639d84, 0x6168e56c7806009a,
+	 0x079d61b124b71799, 0x87e1435d17abd743, 0x6a83ec5343635177, 0xa9c55b2bde73867b,
+	 0xecab76754179b6e3, 0xa0033d38b1300f8a, 0x57e865d4bcc70b44, 0x806f893a1b5a79ab,
+	 0x12f75416cf9184b3, 0x912b56054673a0a0, 0xc7f25f43fccf56ea, 0x9430516d4d5f9f67,
+	},
+	{
+	 0x41796beb7ad02e04, 0x4bfe966fca6a5fec, 0xde82c5367aed3f3f, 0xa4062b08df03353a,
+	 0x473d10e97a56c3cf, 0xb62f5ea17b6b9e82, 0xa2c61d50425cc7d9, 0x9992cc57ad325606,
+	 0xeb589f28adc5f966, 0x12a8117cf765947c, 0x00244155b0842eff, 0x1f3330e2c51619c6,
+	 0x13500bde1af075c2, 0xe518cdfa24a7e6df, 0x55ee2dbd4780ae3d, 0x8f796442f130d4ce,
+	 0x0e13e802360c85c2, 0x1f8715b8b0aef3e6, 0x367b76ad00fc9e76, 0x574469a494202ef8,
+	 0x3120e72487f72bce, 0x71b51610b3f30ff9, 0x29d2d4e98da1bd33, 0x282db58fe2d7ef06,
+	 0x88cf1ade7081d454, 0xd2729f2dcc84529c, 0x86a5757b6e02d4dd, 0x8587f01e96fadbf2,
+	 0xdc7fad436165acca, 0xa94fafd1ad14015e, 0x73f473a535fe3add, 0x1267b6e88223fb1c,
+	 0x807f1ca2f36e231e, 0x73bc7524160a8e6b, 0x6c63e9eb3b1ed530, 0x2d8a2f519b30727c,
+	 0x09e98709d2d897c5, 0xd2e310fb08c69895, 0xa968a20d58dc2397, 0x0f23b7fdcbe4b79f,
+	 0xd07c7df6bbafece9, 0x2e11933919406d75, 0x1d4b33b2543516dd, 0x943ae8518ee39885,
+	 0xc31f6f909a0154ee, 0x295c951e11f3e42d, 0xe0708a0780af790b, 0x842bf975497f9cd3,
+	 0x0c77f5198180c4ec, 0x1759e9d6b949e419, 0xfe82af6969825f0c, 0x8c21d809d73dec43,
+	 0x97ea00fe8b62dda8, 0xd8aeed7d9e85df3e, 0xf694f81ad905868d, 0xb1bb64efeacf2c86,
+	 0xc984c998cf633c24, 0xf5d9c10cbdd619b1, 0x12d8d71ffc5da09c, 0x4abe08f39accbc28,
+	 0x2ec78a2cebba7c43, 0xc94c310adbeacf2b, 0x43b97b46158e299b, 0x9394306bd2117efd,
+	 0x9733d682bebffbcb, 0x0a4060905963426f, 0x7b118ad460c5676a, 0x1edb50f0792e3699,
+	 0x2a2c9bd7185c155c, 0x9c0abb35f3c2967b, 0x5c87740d5ba9e5e4, 0x5cc5eb8091d7505c,
+	 0xd9c9d8ad8047d588, 0x1b005219677bd218, 0xe61da7a2926fc4f2, 0x27cc0597ac58eb16,
+	 0x27ba8458fc8cda7b, 0x4e4ee8bcf6d1c490, 0x100ec8040d5aff66, 0x99e66e66879cbb24,
+	 0x7a0e346d0596a75b, 0xf24f7f546156d309, 0x37968ee19aca1551, 0x94e428ea549897f8,
+	 0x37e2e3f141473d04, 0x7a5a29472240d459, 0xb81f10c919289f98, 0xb3616f73f3a733d0,
+	 0xe0240bec5648a315, 0xabb9df153b502a37, 0x495c820fe29c4a50, 0x9cff884b4c44cf5c,
+	 0x7bee1124844bc753, 0x5ebe1741c582e712, 0x33f6c949671edfa3, 0x7dc88802184d537d,
+	 0x34044b664b47c0ed, 0x90ccac7048a5c71f, 0x9dca3353f91b0168, 0x0393eeff7f74847e,
+	 0x25a2a8d2f880a859, 0xc72eb2f3e7d62cd8, 0xd971a563779f6411, 0x41f298ac7e590092,
+	 0x0ffc9d55f9f972eb, 0xb0f416039aa7417f, 0x2fad3825571f6e3d, 0x94ab545c1c67770e,
+	 0x7234b4c3a525f2a4, 0x2369082cf50a556e, 0xc0447ed28ecfc1f9, 0x3aae3398c39c4139,
+	 0xca30553b17dde0b3, 0xd99e04972b401370, 0xb09599a45ef01d82, 0x212d5a9372cdc03f,
+	 0x62dcc804851ab442, 0x61b87a5343a71fcc, 0xf7c9d87ef6e9f308, 0xa3d6b5dad7114a0c,
+	 0x7bf83712c1bde50c, 0xd9c251cff63b16f1, 0xe76f3ca75770c1a0, 0x1495b584210fafb3,
+	 0x0373f89333eff8d2, 0x18f3426f2fe06a1a, 0xbcf03674b132f0bc, 0x107bc3e80de95882,
+	 0x4156009f56131bba, 0xac5cced9b1cd2fb3, 0x2ddf2e536dedfe7b, 0x67a63f6e7d66d7d9,
+	 0x241235cb91336150, 0x2cd32a80e3d4b77a, 0xa4b6246bdad861e8, 0x4aeab2bb3e51a101,
+	 0x3e50fa858aa073b5, 0xff1c8cfbbe99699d, 0x1e9125acf244769a, 0x9ebf8615c488bc15,
+	 0xe132a9af2e8f2f2c, 0x5f72a806aae373fe, 0xddba2d73d0e97b82, 0x2c713ea0969712d5,
+	 0x7e9aaae3c56160cd, 0x8d2d5a9943268612, 0xa48ccc8771be4e21, 0x1021756ab7caaafe,
+	 0x4fb6dac9fa82e824, 0x5b32dc7e229c7778, 0x300d90bc9e7876b5, 0xafebe27ab37a4ad4,
+	 0xe1d27265f28b18ca, 0x17f5830ca824182a, 0x2a2062d5bbd8e6d2, 0x1a037d9ac784e015,
+	 0x311809826bdff790, 0xaa3e640cde6f4ee0, 0xc3a53c019926324f, 0x535ce92539dc174f,
+	 0x7436f4375378ac2f, 0xa5054013ae5841b6, 0xd008f9bcdef28aef, 0x8b3dd59dda9b9c93,
+	 0x1a15c65069be8027, 0x43c7e4195fada176, 0xc52b2135d88525ed, 0x1f0766ea1addc10e,
+	 0x5c708dd7476e9c75, 0x42ee64184f57260f, 0xd73ac64d8a817f7c, 0x5d76967e9676b23f,
+	 0xf0d8e6addd68692d, 0x73ba4b83ce667ec9, 0xea6e2ecce33a5427, 0x120904d180c163b4,
+	 0x6a72b00ffb89125f, 0x1f93a80daf50625f, 0x6ea210956c2a3180, 0x10894d796f30eb40,
+	 0xb32edfa31aff9325, 0x461d9d1fb02b79b1, 0xb9e289d9f5a09a6d, 0x0b5c1d41c7a67fe1,
+	 0xac252b4157c24962, 0xb6a7df1626bfc23a, 0x9de54ffb0d0d4e02, 0x9bc153c12bf560f5,
+	 0xfc6cd28955ed28c6, 0xb0a5099d61ef0d80, 0x4b2839a349a95790, 0x9a74ba9f7aa85912,
+	 0xc87a927c6f7e0c02, 0xd816b77859cf7b57, 0xecc9574612d8a51d, 0x71fae1fd291b7b21,
+	 0xf83f31a62de15270, 0x37488ee21fa95338, 0x18843c2904cdda0e, 0x9e6a119b842c300e,
+	 0x5d5823488874e94d, 0x2c9f8450b2131f52, 0x827507489f19ebca, 0x7fe5183611570952,
+	 0xbba11f9ae991e715, 0xfa2758013d8aa65c, 0xc01f5cd2a0784bbf, 0x3a9782f3e9279e93,
+	 0xedf0c01400b46a45, 0x6ab8f96a9e46b2e6, 0x20b68c69057a3c7b, 0x30aa3cc57a444384,
+	 0x623c1b864fdfaef3, 0x6368a8dfb9f3b47a, 0x1b8ea4a94d1f3bc9, 0x69601e16d1161894,
+	 0xbca2a3888fc2f8d0, 0x2511b3c497ee8988, 0xe2ba657d378259e3, 0x3fd50932a277eee0,
+	 0x7bd51f1a8b7edd67, 0x931d25682ee262b3, 0x092a926f12be413c, 0x8ac0cc6e6f5163bc,
+	 0x2cd1ce3ae11d75d5, 0x90284032466f1e0c, 0x203232315f1c657c, 0x2f1d223d9410b00d,
+	 0x64c301177fe264b2, 0x1671d53f47e31637, 0xddbf3b27b2540f49, 0x704acb9ce57add4e,
+	 0x0f00c8f392f3c246, 0xd6b67fdc01a5ae62, 0xa467c6740ab76618, 0x3027fa07daf5a36d,
+	 0x37c9e70eecaf95d5, 0x4a532022977db418, 0x164217ed8d811909, 0x1cb5d17bf1402e23,
+	 0x1ced72c7dc8d9f05, 0x627c9931cdc374f1, 0x0c6526340bb1bf2b, 0xb24358fd655607d9,
+	 0xa9192e0cd7e5715f, 0x4124b9dc9231d970, 0x17821cb5c888b69b, 0x342527cd4982d0ac,
+	 0xd45fb98bee49fc91, 0x38c4ebf7f2ea759d, 0xc9a02a96861dc7ac, 0xaa9a55f4a6d31fbb,
+	 0xf9c12e6c8527b6df, 0xb99b1805873c88aa, 0xc70786c7fb49f489, 0x09b0c98f06227a74,
+	 0x38013a3c4c2fd161, 0x1c7cc5ca8c0a8089, 0x171b95805aa1dc8a, 0x50b6ae1f8ce6c611,
+	 0x152dc7b49774ffc6, 0x4365bd270239d665, 0x10793bdfce51f5c0, 0x351c9698aa6a0422,
+	 0x9331b40fb0ae4f1e, 0xa111a2a9cf9b24cb, 0x1567179aac87e820, 0x455871a52fb5a44b,
+	 0x18a4aec0b5e84a71, 0x9d722d534e961fa0, 0x2b8d08322a8f078b, 0x900a92e370637d49,
+	 0x0849372443d5e205, 0xb1f3de6410ca2adc, 0x6e8341b8da32a1b7, 0x0859e1d84bd0a3e7,
+	 0xa374d30b522c43f7, 0x1239948b5844b0dc, 0x72059a12e822b324, 0x062a9320a86c61bd,
+	 0xdd8c25ef38ae325c, 0xc164ab7a46cfda51, 0xbbe4985ef59cbd16, 0x97b7b339616db928,
+	 0xe7f7e5647171e5eb, 0x2d1a3d437cb0bd2f, 0x9e132c178623320d, 0x89f001fba48fe835,
+	 0x50f5686652c30e30, 0x6363d349e12cfc34, 0x3f6f6b83b519bf43, 0x55a11fc0ae56c578,
+	 0x4d078a65f61b3077, 0x6fe770a82a8a6ebd, 0xaf34d0bbe30d3830, 0x8148d0380f64048d,
+	 0x0ca027aa0dfc81ee, 0x1503be574d077ce5, 0xb328aabda25a285d, 0x1d69dd14b3898253,
+	 0xbee845a7416aaacf, 0x69de9af8b096e8c0, 0xac98ae8c3532e712, 0x109aa2a98b7e279b,
+	 0x98ab028e77338546, 0xf452e31b87f0ef8a, 0x3e70457bf5d66680, 0x887be59b998dea8f,
+	 0xef10b81f6ab1de38, 0xb37be52b46fe82b5, 0x63c8c5e499868f3a, 0x4f6765ad847323bf,
+	 0x6c491a27d8d56241, 0xe206e9c9f273197e, 0xf2bb5c4c10d7bd67, 0x2100130c8db86e8c,
+	 0x7d8155ace585becc, 0x86c0ed623cc5b467, 0x9e7b2306d4757a15, 0x9c281b766bc06c98,
+	 0x206acae8010dbaf3, 0xc98115bbaa17e841, 0x1684e5e1be7bc64f, 0x8b97b468f776ecec,
+	 0xa6703ece1d1e3f9a, 0x08e7a26a82ae3db9, 0x98565d52e43f1eb5, 0xb4b40a84e4499ae5,
+	 0x3f1c6da224ae465b, 0x43fdf01f89023fa8, 0x663344a39e3924e4, 0x7352a9fb00f477b8,
+	 0x6f08d63578d20915, 0xa5f95f71fac02b8e, 0xbbf96cd888d510c3, 0x5089bbc9e35568c9,
+	 0xcd0ca853a7923eb8, 0xfe8327e8333b61a1, 0x78dcd69183fea0b3, 0xa110d7eae762b24d,
+	 0x0dfb2188c5191880, 0xf9f58f4084bbb7a8, 0xe612d67cd9964e71, 0x83a259eec1049148,
+	 0xc4bc211f6204e73b, 0x7d9febed58822323, 0x580e3828575c6191, 0x5fa5c677f44e73cf,
+	 0x64c660a4fdfe73ce, 0x7b2a56193d8f5aee, 0x8b2fe15f989af755, 0x612f76a08d401704,
+	 0x35854b2a342b6315, 0x14f5ae6eb3ccaf4c, 0x0a400365f7cf806c, 0x7ab1c7a70ce3b77d,
+	 0xc4f0af5923dee4aa, 0xb6eb5d21e8865291, 0x896be31a0a6e48f4, 0x6c04cdd9a5a13364,
+	 0xc25e8f9bbcd79f8b, 0x0d3545038110ae5b, 0x5d8cee5e18ea5343, 0x7b9ab12a13b80dc2,
+	 0x740264355ec5a122, 0x553419d4e0f0ef54, 0x8dce02eb5ee0161c, 0x94b9da3d45a912d3,
+	 0x737301c1b3b54b1c, 0xe3023cf503addb61, 0x56df3f41273e027d, 0x819246dbb6cebcce,
+	 0x1c90fc5291e278b0, 0xe7804ade41277a07, 0x17d1468b7e659f87, 0x02a2a6b48a9dfabd,
+	 0x2c70e5fa88c2acc5, 0x0e9bf04ec0d26a30, 0x7df45bb4f485d7cc, 0x09534257073ec905,
+	 0x64713f2aac330007, 0xfc59a10e885c99a2, 0x9ca9c0a32c601f93, 0x99f9f8d433c1518b,
+	 0x03e5d5ffd5aa47dc, 0x2e5a7f9a34d47307, 0x9c52854e8cf02ce2, 0x04aff3f9384a2a77,
+	 0x21c5f0b5074188fb, 0x0a3c14ae7e1084b0, 0xff640f136b1897a2, 0x06e2f0e76ae0f35d,
+	 0x436e4f6ecb7e14d1, 0x657ac5dcd2acebe0, 0xa871a3e8b09e4307, 0x32e9b3823a7c4e4a,
+	 0x28f699d747b995ee, 0x07db55bc0866dd49, 0x230f8aee0dac3f9e, 0x699ba7311ec8fed5,
+	 0x64b85509c9a38e28, 0x1ba08283b6b9205d, 0x4438d65abd8fc6b6, 0x204a819269ba6cc1,
+	 0x370b9f6026573824, 0xbb0e2feaed989e0d, 0x47594e36ad775f69, 0x3bfdbafda0265657,
+	 0xfe5b03056ccde115, 0x9cf94d6261f7f4dc, 0x1557a68e297bee66, 0x88f7e5325d8abd97,
+	 0xdbdbbc8298a9750a, 0x0cfac6a6be9bf9f1, 0x7eddf1ea42188c88, 0x5073deb055910df3,
+	 0x4b5e0a38f400507c, 0x80a7be5256285400, 0x61efa021e07b99e7, 0x76d7b2ee98bf99e9,
+	 0x6bf644173d5ddb96, 0xf17ba736d498a03b, 0x9425ec0992192a90, 0x132f6b96b685882b,
+	 0xb7c539b06fffdf5d, 0x021de7fa3e39b88c, 0xacb5e9e8c62bf8ec, 0x19422dfe0b996422,
+	 0xb2d2e20611a58ca1, 0x3a9b84aab6feec52, 0x53f1e236b0c472ff, 0x15120cde9f9778cc,
+	 0x66aed1def4475062, 0x13a0aa40d38fd48b, 0x0ca9eadb094536b8, 0xa1ef16cc63c343ca,
+	 0xa3aa02ad62c1b912, 0x62633e6b2789304a, 0xbb9d4c471e9d60d1, 0x84e1e96907de7ddd,
+	 0x4ae552598be50942, 0x05b0736f9b3a2c82, 0x58fefba9f5cfa19a, 0x1e922949755947af,
+	 0x4a10254a18533446, 0xa5137de15c650fc8, 0xc3327d8d80b19627, 0x3e14c23c95526765,
+	 0xf4da1e3490bb6b0f, 0x77cb6f4f9c133648, 0x93944fc9db0c9c1f, 0x9c154671f6c5ccc7,
+	 0x5ac05c58d9e63b81, 0xbee876905749d8bc, 0x60de46e9e857a7de, 0x51dc4b37d532149b,
+	 0x8e164c430c27cf29, 0x2639b902c276a80a, 0xe66333a305243c84, 0x6a9b439319bb1813,
+	 0xc8447179c16aac02, 0x661501af523ded58, 0x29a9aa0b297e93d6, 0xa9be1ddb726b39ab,
+	 0x1f130136520c421d, 0x4c56ef7d5b91908c, 0x76d1f8767283c014, 0x99b78f889a267573,
+	 0xaf591a05a3e4ab0d, 0x5e734f42f1882a30, 0x7cd8b9e74127e7fb, 0x4576c8ae302c06b6,
+	 0x2642845d7736b567, 0x4e189965c8064a7a, 0x99181c037bdce4ce, 0x723d148e799e03fc,
+	 0x121e0b83556fbba8, 0x1d350347eb3e9385, 0xe84108f8b8f25bc6, 0x0f37bbaccfc5011c,
+	 0x080c0d5a71e36359, 0xffa3a23d52d15668, 0xa33798c1581f0e42, 0x3bd1aabbb06ce840,
+	 0x52bb094ed2364ca9, 0x88617071fc2772f7, 0xbe8a8e25418edd0a, 0x8cfefee41d5118f2,
+	 0xc7ad38c77ea5b273, 0x8f8f2b17c28141bf, 0x7fed908658ba4289, 0x2972baec42722f87,
+	 0xd2521faa7a14105a, 0xe192d66a401040c4, 0xdf1d117289123646, 0x4f6c6de9dfc61c81,
+	 0xccfcafc96c62b0c8, 0xc86aa1eda8a741e6, 0xf2be02329c755659, 0x5f12dc7195e867dd,
+	 0xed80152b9dd2c015, 0xffe7411793014829, 0xcc3585a86fe753d8, 0x41774e1374312336,
+	 0x55d4b9c0ef6d6355, 0x1ffda7beed8f7ba4, 0x95b2e8a78548a7e6, 0x41d1c93664bfba3a,
+	 0xfdd349ba14f1002a, 0xdad7f6a28f92c6df, 0x26ed7ead0fc79d0a, 0x9975e969f08b2360,
+	 0xe66bcf2a60002463, 0xaa2bcde0d9a01fcd, 0xe01b3c99beb3a75d, 0x69e16ec345113215,
+	 0x76b5489631912d38, 0x27a7d1dc734cdc98, 0xa09e081891390963, 0x5d827d544afd428e,
+	 0xc55305de21433e6c, 0x5213dea9d6b52124, 0xf9feff58540df726, 0x3ccf39be93ccb3bd,
+	 0xc4175cef776deb36, 0xb0198fccade1d385, 0x0c2782e31695944f, 0x50f64342d6787d32,
+	 0xfcda75fce40b74e4, 0x06615e4ed399a2d2, 0x4ee30d2779d1ed50, 0x3c606cd06e88e364,
+	 0x3ec93a4a9a28c866, 0x5d5e4d71154ebbd7, 0x3554fa4a32f3da45, 0x7d3a5e6f39433b66,
+	 0x3179624a514b1c75, 0xd2d7e001f04b2c4b, 0x6ce23451503f78a2, 0x57d1f078ac8046d9,
+	 0x1e0877d8a787a4b2, 0x09e994a75f103287, 0x1751512494c171bc, 0xa70072f0d6fc64e6,
+	 0x57329f3e441f9e2b, 0x93ee200a91636f1d, 0x4827134c633f6555, 0x7c2f33694d879be8,
+	 0x7bfb6b74e7252b2f, 0x118afc7b4e425c24, 0x8baa32c32e974d62, 0x62ee03477bcfde9d,
+	 0x08f406e36df75f75, 0xbe7b8375e8a52e1a, 0x5292c464da273d0d, 0x4dbc4dc169e63127,
+	 0x006071c075a944b3, 0x065beef2aff119a4, 0x9965504a9125dc96, 0x17db88ba223fcbb1,
+	 0xc48ded858fc5209a, 0xdb2f9ede3646c3ed, 0x5ac610eb99d86310, 0x53292cd845e383bc,
+	 0x0d91c56e91e874b6, 0x9d71a0a455f62bf8, 0x244c61fe62143160, 0x877086b45986c108,
+	 0x92cfd88272e87c1d, 0x824c427db639da93, 0x61a2e26f9b6be782, 0x3bf4aaad0e0def58,
+	 0x38569a5291d546fd, 0xec27bc4580599c14, 0x3b8ad5e43c132e91, 0x256df6f0a31f5994,
+	 0x68ffab1a693225db, 0x2fd799fcf6659b85, 0x3fb3debc7affc897, 0x8d5c80ada8b96b1a,
+	 0xfccfe04edb3f679b, 0xaa7859ea618d99ff, 0x0878f73b95bc3f41, 0x237e34ff366c40b4,
+	 0x95b8c2d95a8b4e83, 0x0f3cb5e5102f62a9, 0xc6d051163ff465f5, 0x47de2a2b37722abf,
+	 0x09bce23e296f0277, 0x17e387d9ddabee4f, 0x738ff63486648195, 0xa17eedb1c0220c89,
+	 0x6a2a2c1741e71db7, 0x431a44108921604b, 0xd537f01fd02f5937, 0x2a383ff2b79ef285,
+	 0x5fff7f2c20d4ed33, 0x55834c1055c392e1, 0x86865b910e634b7d, 0x2bc8d329e1a63cf0,
+	 0x271c53182c1c85bc, 0xa5de060c245c0401, 0xb60574f2318b4992, 0x4991678e6c1ed769,
+	 0x93ba85c0087d4e1a, 0x68b320a79cafe356, 0x59726bcc3bb1a4a2, 0x6e4b618e8cfc9c86,
+	 0x8fbf73166cc45cd0, 0x7590c80c6a047a15, 0xed8e9c5ee3556188, 0x8efe65d3725e6f25,
+	 0xdc7fbda166456d59, 0xaf1725ce5771e1eb, 0xb8ce3ee33223adc9, 0x94d32d89f591fc93,
+	 0x50e33a0cda724f0d, 0x4b57468e7072d2a2, 0xa8ff35a59fe462f9, 0x89cfb999e04773e0,
+	 0x3c8818a51303c1d8, 0x1ea325bd4edadf7c, 0xf351c22e7eb33664, 0x82053b0f1658fb07,
+	 0xf881461372b98548, 0xd5a4004f3f1c23aa, 0x00366e1bee086a9c, 0x5b46ccdd94e20e80,
+	 0xacf76908af36754a, 0xca705e461041ce61, 0x3ea627c15aadd958, 0xa623be5923b918ac,
+	 0x3d23937499a99af3, 0x3b8934cbf3ca68a7, 0xeb9b5b6738a43de1, 0x9971a1147880f165,
+	 0x205c2a903d9b8a55, 0xd843f891d824e26e, 0x62db25d83ad4e034, 0x4f0c49fa2273b1e7,
+	 0x9b3192bb5d0b8b5c, 0x42cfbd1370ddf678, 0xc31db0207c5081dc, 0xb0dd9f3d8c1c3e24,
+	 0x8b1c5ea859d4b4ac, 0xf58006a3aae32ce0, 0x91eb573508d19eee, 0x8db1975d09eb5e2f,
+	 0x1858d23473f40943, 0xb5a899efa3159410, 0x9bc7009c96f9b78c, 0xa259956e0ea71f79,
+	 0x30edcb10fa9bcc04, 0xdffd5cc9d9f11ff5, 0x939fa69e90600401, 0x1a7ab428e4c6c302,
+	 0x3f58deb7039c5491, 0xa9fea8916bcce459, 0xb5b19ad815814672, 0x92b9bfa0bc78e508,
+	 0xb134f88947a845e2, 0xcffde13628139448, 0xbf7f722d75a207d5, 0x0f396b7f43946f31,
+	 0x5fb78abaf069d7c6, 0x7caede7f66d0d725, 0xcf55f2a616d3c897, 0x0f7f7e01b628334c,
+	 0xd08c420dcbe06a88, 0xc09b7243b1d8b965, 0x47132b414a8eebca, 0x9fe8b0907bff8fde,
+	 0x79f145c700e0d084, 0x925d3aa506572e66, 0x5526a669ee01f913, 0x99c1f8635e5ca39e,
+	 0xcc75b8936f7a08ad, 0xb7e96e3a3b0bc2f2, 0x2e915200f57be757, 0x7a85689762916e94,
+	 0xb3c0544dddf8f69b, 0x9ca62b438b17eb09, 0xfd924d46784e03ed, 0x4036e856b69fafec,
+	 0x128fab403f2c178c, 0x3dc3f26cac03d7cf, 0xe37e657d5c854e6a, 0x490c2c567ebb9341,
+	 0x3d37bd5f8c81bdd3, 0x1aa76a25717fe0ff, 0x87f8b189bd7f642d, 0x0bc345d7626a5f98,
+	 0x6adbd66f9e1db621, 0xde9a74853f702956, 0xc7b7e8c97bc57b13, 0xaa597d550239cb1b,
+	 0x1723b02cdd4d25e2, 0x65baf7c637f5b447, 0x32176dc6824b0eb0, 0x62cb1c39c7cbb0d3,
+	 0x4200e5d053809f10, 0x31759ddd1a54f5b4, 0x6717c5979ae1b473, 0x72c60c5d431b21e6,
+	 0xeb8c0f0357ba1639, 0xa64df6e6367337dc, 0x54f7230cfd0c956b, 0x331c91472e1ed638,
+	 0x3c83696781d10588, 0x15d71459ce82bb1e, 0x6f4ceee4a47fde84, 0xaf1e39b8f1dfdaea,
+	 0xb6182ccfa2d7c415, 0xe739cd6e7adef45a, 0x892a6ea5f6876d36, 0xad90b80acf82f08e,
+	 0x84db96c063d6d5af, 0xad5fbdb5201c5226, 0x2ac24a9bccd6804a, 0x844e71f9c04a5063,
+	 0x75f46d24759d71c1, 0x048a40dd13bfd4dc, 0xf4b7aecf631d1ff7, 0x9bb8bd84d3ec1f41,
+	 0x3a467a89bca72da1, 0xd034deeb74695ae9, 0x74c6ceb5721f6294, 0x9372132974c14512,
+	 0x03cfe7fd99cb46ae, 0xa08d7133eb2ec3a9, 0xedbfeb7d8e634806, 0xa546e43463b5ce04,
+	 0x3e47af1b868dffac, 0xe7bbf8eb0af0a8b3, 0x91651321c8b6f491, 0x914b983eb930d7e0,
+	 0x3754e0c5cdd58909, 0x097c55745e820c69, 0x2d675f73095a493c, 0x92f323308962990f,
+	 0x9895ea4a009cc1b4, 0xd0aff0ea15a5f3b3, 0x7a0ac1282e4f213d, 0x25d006c397328210,
+	 0xc43db798f949334e, 0xa9444921cd799485, 0xdb3a9037cdae886c, 0x5bd00ec6c218821c,
+	 0x5f12a3a2072e94c2, 0x1c95ecfec18ede86, 0x9ddd21202160107b, 0x8ae6819629d38c97,
+	 0xd1d23f6ef58e8181, 0x36f6e538ea16f4c2, 0x2595b617bb270cc1, 0x5e2ea3784bdfc08f,
+	 0x720010729e4942b1, 0xa265ce5ea0c3f289, 0xdf87fc1fbf02e68c, 0x5c5e97249054a92f,
+	 0x329293957e8c7da5, 0xe964821f3ec98adb, 0xa252febade603297, 0x0a0b32dbcc93b986,
+	 0x4b3765f53e2f2fb8, 0xd69004543ddd8441, 0x0fc60b7e39e7ad4e, 0x31cf3a4eeacb9d93,
+	 0x4c770a3301247851, 0x55695887652701bf, 0x8343bdbc60feb698, 0x0d9c16cc7d3cd671,
+	 0x6465bed95909a5c0, 0xc638c76785f44a8e, 0x4d88b9e4f9caa98b, 0x718b9ebbe458e6f6,
+	 0x76c3c8d199a4ed27, 0x99bd057dd88905aa, 0xd7186960e3f0b033, 0x701d1fd15afb1e19,
+	 0x07a14847816dbbb1, 0x0d93cac9ea577f24, 0x740baa0a42b8d83c, 0x63fd7e633171c9e2,
+	 0x0a1f66d4f0133f4c, 0x977892ce42876fae, 0x38ea8152cb88d90a, 0x90dff570dce5ea2e,
+	 0x5e49b0d4dbb09571, 0x851b3b090e501b02, 0xd4f811ceb4acd8b3, 0x2f152b3283cd4c28,
+	 0x7f0307159a02e0c9, 0x2ebdd9526737d611, 0x426d1560939f999b, 0x6c5f9d5a972197ea,
+	 0xdd453e9d6accb728, 0x59cdfcddd13cc9f2, 0x8e469106bc76da71, 0x9e2c35b8afdec0e9,
+	 0xa3ef70c6ce44e48d, 0x6b9f2719b07bb848, 0xfe8ce42071133b48, 0x1f529edea164b215,
+	 0xfdfdf29ac073bc64, 0xad89a705b8a51389, 0x2d3595a4228c9369, 0x145d3fb03ae526f2,
+	 0x31b85f1b3bb69cd2, 0x362001321aa41cd8, 0x3aa8b0e9f53f750a, 0x6b9e058da136bfab,
+	 0x87346fe77176390f, 0xcdbbee105c711d82, 0x3ff0423bdace5c54, 0x8da94d6230278f65,
+	 0x28b7212cfc79c861, 0x67b6362d9f77d0b0, 0x13dcbf44c0e950f9, 0x9a4e24650b5fdbed,
+	 0x8413d58b28f05d36, 0x2f5852af7c26d295, 0x7e136b5d932b04e2, 0x652f9a70af7e39f9,
+	 0x4473eb5fc7cf25f7, 0x5e4926f2c73ea472, 0x4c82a7f7f0f54563, 0x005fcb4e20c92976,
+	 0x86571be5dca62e67, 0xd75bd51a02ccf1e7, 0xb6d4910d678c0540, 0xa6fef602cde19e36,
+	 0xa3dd7a9931b37fa7, 0x8e63a687f7d6b7c9, 0x9dc05fc5e2dd48a6, 0x92de7eb44bf792c1,
+	 0x7b82ed5c053310c2, 0xa8fc70e731b7cde5, 0xf0300379688f7e7e, 0x10103d06c1f20a73,
+	 0xec821d488207d6b2, 0xdf7ffe55f4753b2b, 0xa8d905a2c2c662fe, 0x9f493686e673f0ba,
+	 0xbb18f2ed4d0ba01b, 0xf8bbc1e900cadce6, 0x9865dbb75acb4bde, 0xa5b897df2c20890d,
+	 0xf77108d3beba2b5a, 0xae52beab9b59b48d, 0x46c9812e85e730ed, 0x352854955920b668,
+	 0xe834d5733393bc50, 0x90cde7aae4cfcd7b, 0xe8605ffe638bf090, 0x1752c6d81699235e,
+	 0xbe758e860f6d5317, 0x0f840276e5bf01b4, 0xd0c49dd7b027541a, 0x7b7565819189f5f5,
+	 0xf464f5ba97442322, 0x73a663085bb3a20d, 0xaade88c89fbd51a6, 0x7d8f0dde69bdfc41,
+	 0x2d0c361e76995a60, 0xd99b5424eb43d02e, 0xa5266c2e662a5c5c, 0xa79a8428ca88df30,
+	 0x0094c8b45ee88d15, 0xb85198c6e2b63d3b, 0xe972104af57e9c4b, 0x4b7556aed1b18f28,
+	 0x6694c83660ea723f, 0x808b7d49f9e008bb, 0xc70ccd41525da7a5, 0x874ffd8afa2ee8cc,
+	 0x258e7eec9486576c, 0xd0f791c4f17f7c10, 0xc540f997b053bc0e, 0x0da50237a8fe70f0,
+	 0x737516b17f71cf82, 0x28d2d8cebfdfc9c8, 0xcb64ef3dc0b41dc9, 0x48394048c9c9d974,
+	 0x6f91265e37b10db7, 0xae5a2bd4f3f3a315, 0xd07fff0382440bfa, 0x394e109198d4c024,
+	 0x5edb3258c5233ba4, 0x8760f688fd40d0c0, 0xa7dd35a4a1baa56d, 0xafe8befe579aef24,
+	 0x430af9802cd50bd2, 0xb1e9fe46aa7f3a18, 0xc81ce9d91a35f08a, 0x2fee972a24d7d238,
+	 0xe55ec4328ee22156, 0x6052c13bfc74ff17, 0xc596cd97c6139427, 0x34c3455721bfde83,
+	 0xe380b9c1eaef5585, 0xac9e0902acfc0bac, 0x9373c8c67282f59b, 0x22ebb21bbbb9dd03,
+	 0xb60718d98eaf0a91, 0x33c8eaf1cd5012cf, 0xe24d3fc7cd22774b, 0x26b82f3ec6201895,
+	 0xf0cd76b1d6b768ee, 0xf2ad959f2b5b98ff, 0x54a17bc0e7a78a2c, 0x538f3afaffbcc673,
+	 0x17605e643478da99, 0xf924327e502290a5, 0x178e94aebb2cd961, 0x7f116b0c76595d5d,
+	 0x428adc163ea8c156, 0x970797129223aa04, 0x1f00701b6e044c23, 0x9ee4cd1a2036d3d5,
+	 0xaa3b86cfaf815173, 0xe2afd425f546c8eb, 0xb1f4003ffa8b8bfb, 0x9d9ca1f96c59eb7b,
+	 0x3a3082d8d8fe7621, 0x6152fddfb87052f8, 0x5983bb0340faa288, 0x042d077414125f57,
+	 0x8d0696cdf63c0d98, 0xf0fe651b26b54ae3, 0x2abf60f9bb3de038, 0x8e70d020d016fe60,
+	 0xb4c587edb382c650, 0x7dbc2dff7a0346c9, 0x7c68d17ce39a9816, 0x71a985a150dab349,
+	 0x16c964c31dc7fbb1, 0x0257db0cc09d7eb4, 0x2ac219c0b9ea2db7, 0x345388f5cc23334f,
+	 0x955cd656e2da8d61, 0xb118c55bc6193832, 0xed35d042704a28c8, 0x4aec940d3acd5e2a,
+	 0xa1dcf8bbbca3b24d, 0x93471d076102f988, 0x65a3148ab8688be2, 0xb0ca2f2d2e7b45c7,
+	 0x797060d0b23d1c2b, 0x49f70d9b84a035b8, 0x5a9e5eff877922a0, 0x2ee07ef1214de5b0,
+	 0xd53a5095dd0d39ab, 0x6e2a63c772924055, 0x34dfaf925b29b17f, 0x2ddea70925d24702,
+	 0xe19c101ac7653493, 0xbdde979c81de9293, 0xdae11b31d8c56794, 0x63c0a56b3891b289,
+	 0xe818457936765ef9, 0x8afd88675bd49093, 0x058c961073344d17, 0x6c2e2a2696499a84,
+	 0xa356101882f6832b, 0x5685a0121f8854b9, 0xe50f4614fdc162fd, 0x22650c2bb7fca688,
+	 0x7acc1186ce516363, 0xf940e08a6eb92f5b, 0x3768216b52010d77, 0x1831f86113dd973f,
+	 0x6fda27759410b9eb, 0x2e05e1fa59bdf214, 0x8ecdbe55d7b28163, 0x5542abd0e5712a75,
+	 0x8d23c9509b8da8e9, 0x8f965aebf22534c6, 0x7de6563a8be1d0d9, 0x8073916870bc1d96,
+	 0x80b37087735823de, 0xa7210dabc3b9cb1a, 0xa2ceda8bad479498, 0x40fe9ee579aef4c3,
+	 0x70a28bcdec247580, 0x0db97273c4df7459, 0x01df345402c77f52, 0x6453e9f7151c88f3,
+	 0xc74e569ca9a1c874, 0x8989f3b7a824097b, 0x45b57e182facb556, 0x4c673adb1e4d0152,
+	 0xd4b257d2da6777f6, 0x36e4abf2253e4e99, 0x317546c2d151856c, 0xaab7ae8af2c50e44,
+	 0x75b95598b93dd141, 0x208ccad4ba77ef1c, 0x58786fa8de034b6d, 0x75d8b1c02279c26d,
+	 0xacac7addf1159ea1, 0x69274b77e2a20f6a, 0x79b2ddd30def6311, 0x3f0eaa85fc1d1684,
+	 0x3bf8269279f345d3, 0x366b0cb6476d6cdc, 0x36cf296401218a33, 0xa027aa54e725ed69,
+	 0x6e64f050aa51a7e1, 0x6448161cd7a6ba5a, 0xa08327a11c39a574, 0x56d3ae21fa110ad3,
+	 0x598e48584f4fc8c5, 0xf05d75a880312c07, 0x926d06133b14c8cb, 0x016b1babe319e3f4,
+	 0x5ee88ac0037affc1, 0x34f0da566c4fff88, 0x6278f10eeded45d5, 0x2548cae1e160b198,
+	 0x7e11c7600c82b0e3, 0x4ce85ea408618238, 0x3cf1fe3f5ab142d7, 0x48a31e33cbacfbfe,
+	},
+	{
+	 0xca8d98947f57ac28, 0x64548148abfdd38f, 0x3094e98f4515275d, 0x10f320074a2fb7a9,
+	 0x1134d7f6ccd8083b, 0xbbea4f9bd23e302f, 0x5e212787c5234abf, 0x34afc38a709543ea,
+	 0x3bb866f587cf6712, 0x41b195b68f4654f8, 0x59b1dca57d8617a6, 0x0ce69013a84fdb62,
+	 0x441b49e0eee1aebf, 0x100fdc71d270ac48, 0xd088804c443d4bdc, 0x15feaa5a6813097e,
+	 0xa8ac8c2d74a86dbf, 0xe25a0da0ea433847, 0xdb8d21c6544bf698, 0x756d437fa63233c1,
+	 0xc7a3ce4b6b1cb665, 0x95cbb83e8e2d0e4c, 0x6619478a0273be7f, 0x5ba9540a9f5fc304,
+	 0x7cd5bf487149fbd2, 0xf449489cec249398, 0x7217570921e31c2d, 0x597df8fa3bb2a9bd,
+	 0xc8dfe52b10f34b95, 0x89667667b953e823, 0xbbc00ce2a00a6558, 0x8defc5d69d9d42da,
+	 0x55f0084b395fd6f9, 0x114318b51f6d61df, 0x74cfa7606af8f661, 0x33301c1afada8c15,
+	 0x03d33c8d67f6c163, 0x555ebfd6583bd089, 0x5a0af6b0faa84d91, 0x208f2e69c1d0b8cf,
+	 0x0e9773b9473550e6, 0x4b54406742b457ec, 0x08b75b07a105166f, 0x51251e2d825c7c00,
+	 0xb0c739f80d1a8811, 0x99bac4621a921eb7, 0xdb27995e425d0eb7, 0x7bea83519f0274eb,
+	 0xd0dcf0f31278003e, 0xf24342257f5b6876, 0x59d63280caf4828b, 0x88aa7c9c5da28422,
+	 0x61ab10f39377d1fa, 0xef647ec2cb65fa74, 0x68b6c82928a2dacd, 0xa885834899823fda,
+	 0x568dd3d5cadc42cb, 0xe7a13255b28c71df, 0x47bc450db8f4f5b4, 0x4f0987079fa6542c,
+	 0x3939edfc5c5039c1, 0x4401baca1916d775, 0x8293a09c287a063d, 0x5a3a50586695e834,
+	 0xd4740e45d1116854, 0x86e7e1075b9287c5, 0xf4f766b987c62a2d, 0x25fcc2cb29925f5b,
+	 0x9b64d1c033fe6905, 0x1d3289fed7245750, 0x828761ba61192267, 0x2825dd70504613b1,
+	 0x05b10ee4782e8b63, 0x00225d317cedcc72, 0x0dcb206b81bef519, 0x461b901614872335,
+	 0xddaa426af31f4f61, 0x843b7a7e821defa9, 0x9816ba4b4581b366, 0x93adc023fc6016fd,
+	 0x53f184a590b701a1, 0xbc0c9c57ada02bc2, 0x3813ecdc678b0b77, 0x7e5803ada91b28de,
+	 0xe4bc5daf56647fd4, 0x215957c9ecf8edf3, 0xe35b1c4084d43ccb, 0xa369c71c3ac835aa,
+	 0x6c4b2c85267fa7b4, 0x39ca0fc76567016b, 0xf3816610f19c6122, 0x19b456b3e91d6955,
+	 0x09a8ad6f23d693b0, 0xc4b17a09b48f4f48, 0x10ab2f43c69e905e, 0x369512619a05e80f,
+	 0x9ec9d4bb32f6304b, 0xbf223fb9ba54a7e6, 0x850997477b432d3c, 0x7f8ae7aabf96d2bb,
+	 0x4d2d6ca617606dd6, 0x65cdaee7afcc90f6, 0x2940612c5cd30ba9, 0x92aeda8d6d0d7340,
+	 0x4faf6a5224788961, 0x6a571fadc050f03d, 0xacc688561db1f842, 0xb0b2a6fa08caa30a,
+	 0x432c34afbf6828cd, 0xed5b55e9839ee889, 0x9a9eecaaade70379, 0xb3ab48efb91db0b9,
+	 0x7390fc5865a8cceb, 0xefa1d3447f119961, 0xf69d60b73d33a9d4, 0xa4f94495eccec7ba,
+	 0xc38ada0b0853ec68, 0xb1287b089f64bd8f, 0x6be6aa748dc8f00c, 0x8b5e20473ef5ed96,
+	 0x6acf7e70f2a33c7b, 0x3c2d057282f6a13a, 0x01a0e4fea70e2874, 0xae5cdca1906a5aed,
+	 0xfbc491d123911b45, 0xf59d97da7287b1f2, 0xd0237dcf2fd18138, 0x917ade395c1ecf80,
+	 0xa4b2cb6fec5d3dd8, 0x7d8004d0ebb8c757, 0x9bfc6a793b53c318, 0x070bf2b37f89ad6e,
+	 0x782e3732550f2bdb, 0xb1817d0ac24476c7, 0x91f222fa6e041438, 0x61b6e103211ba5bf,
+	 0xf7ab22f330342b68, 0x5ec9b923c98f8da8, 0xbdfa37b6b46e0242, 0x9c15b83f6405667a,
+	 0xbf01c9efa863d9cf, 0xdfd3cc1de94272e2, 0x65b5c69787ef5725, 0x82ab03aef791f838,
+	 0x1dac320066b6379f, 0x6801d0e6cb191908, 0x1cb4b13c343c0937, 0x1acb274a57a30fcf,
+	 0xa3e352424bfac887, 0xd18b887cadc0ee0b, 0x42f48a509dab7bbf, 0xb524d6c0fa1eefca,
+	 0xb047076be50cc61c, 0x3f59f1d26d855550, 0x49d78139955c3fad, 0x1c0f5b3cbe1d8c08,
+	 0x889a8b91872b315a, 0x8bc4e471a6d00c98, 0x4f7a411e5c8b9909, 0x525234f6e6bb503d,
+	 0xc98ecca027ce4c36, 0x687edb2fa2d066c3, 0xb2552fe7eceeb554, 0x2fa3b7634f2d1e32,
+	 0xa5f192610bfb658b, 0x39aeaa2e761f0ee5, 0x37c91364eb7531a2, 0x0364ef1a1f6a0adc,
+	 0x4df4500da88591ab, 0x590b88deecaa65fd, 0x11b18b9a98afa5e0, 0x26094dc8e75b8fa2,
+	 0xfc61706a28377827, 0xb19821c7b25d8e29, 0xd639e49890f078ad, 0x61059681718219c3,
+	 0x757794436f6af8c8, 0xd0f1f0da8e109f77, 0x13a83a8a8a7c5f56, 0x9100ab4ac6ce2c91,
+	 0x0537f93cadccdacd, 0xf0e6a7293f9d5469, 0xc99ef2228dbc2dc3, 0x2ddcb834962d8f2d,
+	 0x444574a777207742, 0x7d636afe349f62c9, 0xb326e7e3fc67065a, 0xa9b3bef8c13b8315,
+	 0x8816673c94ca30ca, 0xb449f99db6ab399b, 0x92e66622a23f9872, 0x042e1e1976b0c40c,
+	 0x6fec98f82f783ca7, 0xe2c5653a6f7adb01, 0xf633d4a1a7489e14, 0x0ed290a5802df1ca,
+	 0x958999c75ed26746, 0xf21541b343267d7e, 0xf75c0ca5c94bc1d2, 0x3dc32842dd2b7463,
+	 0x354a392de23a08e2, 0x69d823a683208618, 0x621b15b1fddc778f, 0x62f4cc9a73987fc5,
+	 0x6a82851348189eca, 0x1b76e73bbc2dfded, 0x96cd796683d971cc, 0x417cf72d30c7be5a,
+	 0x04df708de92795af, 0x41024eac6148eccd, 0x55104ca29f2d1703, 0x75ab18dab0ef01b0,
+	 0x46c185ce7a99ba2f, 0xab85f82b082aabb4, 0x34d425ad4f6a3da4, 0x5b928c3de4aa665d,
+	 0x9fa05a947eeaf2b4, 0xb10e06b245a206c9, 0x4291c8e2123469ff, 0x77864245703d9c61,
+	 0x9271a52839bf632e, 0xbf6efff1f5a8df42, 0x65074d1d84472bf0, 0x327620874a3c3ef6,
+	 0x3b375913590d27bb, 0x1baeb5238f139e88, 0x027627ec731aba4d, 0x8d1f912ea6daee87,
+	 0x04357ae41366b6b9, 0x50191b09de0674f5, 0x4d76355ce174c79d, 0x04832f78098854cf,
+	 0x41605419e1488948, 0x5f985fcce8bfc305, 0x84154dc3a32fecad, 0x94f2775a6cdb11f7,
+	 0x4cf62f52f50fc5c5, 0xe61347b60c508322, 0x381691a531aa3533, 0x863dc0639b073cf9,
+	 0x21ce0f0d160c3a97, 0xe0c028233f95b7db, 0xfed730693123cc47, 0x5b78b472e65c7d68,
+	 0x1344bc37ae179685, 0x934f400ade1b5ec4, 0x5fbd4b356ac72535, 0x9286353bdfcc458e,
+	 0x7c6e83e4eda9a0e5, 0x6b761f79284dd89b, 0x262c803154a808b9, 0x6064f52431cffe49,
+	 0x3b6039d01246502d, 0x04834d26d4f6b492, 0x2052888378f80916, 0x9794134a71ff56a7,
+	 0xc74116bc13a495ad, 0xf5813a193c2deaf5, 0x5fa64517bf346f93, 0x39674fdf80fa3e3a,
+	 0x58445c4dbb5c667d, 0xf52f5966d27b384d, 0xd991d215c1c417d9, 0x01c7e4d6887820c0,
+	 0x28c0d3380ad0caaa, 0xcd001270e2ae7837, 0x7dfc35e01393c193, 0x1981d7878f19facb,
+	 0x8f9483d956e15be2, 0x396e303b43272267, 0x2f2479b112474b90, 0x5311a55d4325f712,
+	 0x0c0fddf7369aaf74, 0x113fea831553baeb, 0x9a00eed1818ef8d4, 0x9ddc9fec4a18215a,
+	 0x98bac943f049c3c5, 0xd4fa5119208ff941, 0x444877ffe1d0d0c1, 0x8878e4918d19e116,
+	 0xf6ba59d4c7ace80b, 0xa94cb8c24de08b5e, 0x1768783040c49658, 0x0da1fd7733a2e42d,
+	 0x60aecc4c4b3e764c, 0x90ec49fc46ac9fb8, 0x5a837571d509d306, 0x5899feb9a3c1f6ae,
+	 0xacb5b8a9c1bba7d1, 0x643851c713a36965, 0x5aeb1a8cf35c9ac9, 0x25175b26833d9199,
+	 0xee17169a1f5bee03, 0x0b0d79c1035600f1, 0x74f21152f75169f6, 0x10aa2522781d6c30,
+	 0xe8d421c9b21ebb74, 0x98636a3e2937b58d, 0xc330998f2b5ac539, 0x4fe7ec3de871b827,
+	 0x31496cb9566c952b, 0x5d5619ea72c4a08e, 0x05ed43a36eb7c53e, 0x08d898699c5717dd,
+	 0x1226beb4df05920d, 0xc6f0a19f7c257855, 0x5340e3a33bf107cd, 0x405c73cbd1be7356,
+	 0x90cbb616592027b0, 0x023834b6cbbba9bf, 0x67309303aa77f770, 0x459b50fc91d3eb15,
+	 0x6aa644c9f7581bdf, 0x50f112359452c276, 0x21ccdfbc33ec0bc9, 0x2ef306f6fbe80942,
+	 0x1e1e65eef17df6d1, 0x15fa4985ebd7a9d9, 0x6b6b9d3859b3bba9, 0x2ce3e43d76a408a9,
+	 0x08e8185e38d0ab3b, 0xd435de5b1399a3a6, 0x90b81b93f9b85a9d, 0x47786483950da27a,
+	 0xe4ed1d74960bffe1, 0x4ece7634658c1805, 0x50a1b70f765a6c25, 0x249131117c4018ec,
+	 0x3a79e85fba997bc2, 0x9e8a0c5353f3f033, 0x261f12a5b0fbd03f, 0x72854e232cec78c1,
+	 0x25aae026b9305352, 0xea614f0553dbe03f, 0xeb34dd8fd9717046, 0x117af6734f384a33,
+	 0xd2d2c1e13a111aab, 0x63953cca62c4cb65, 0xd2d1f7ad7306ab13, 0x1061c9cd419819b5,
+	 0xf94b99e7456deba0, 0xce32c36ab1fab3ad, 0x5d05a77f56d7639c, 0x61cac7507d30ec87,
+	 0x2141f963f418db96, 0xc15085d5737ab55e, 0xb1fd9610a0c30caa, 0xb26bc601cfd01472,
+	 0xdd48afc754adc522, 0x323e2295ac09bf61, 0x8bbff3f73e51deaf, 0x2bc0f724ba74d151,
+	 0xdb96eca5069b89b4, 0x96ce2507a0d045eb, 0x2f533267da9c46d5, 0x12293026b24b94d6,
+	 0xaf0faa784416b1b6, 0x2453cb173f63517f, 0x46799d1d162cb60d, 0x462761c1fc2ffd7b,
+	 0xa4d82c05b79213ec, 0x8738095169171b12, 0x90f0ed316f388764, 0x1e5de3354d1c5dd7,
+	 0xa94484a7e79bca8e, 0x21cf8a8e648594f5, 0xe8b115b60dbd76c9, 0x10c70bb527629189,
+	 0x8bef1ab7e0782937, 0x252b1efa8ef662d1, 0x65a4634275b913f8, 0x57ba30411816cbf2,
+	 0x49d5fedfd561626a, 0xe8421559cc76caf8, 0x735661fcc816a9d8, 0x351bf6de5ac0b9f9,
+	 0x5829a7afa9ed2b2a, 0xa20ce3c4ee7dc53a, 0x2139d6f5d95fee82, 0x6153deeb384e0f89,
+	 0xe5c0971d685661f8, 0x48d4d8dc544447ce, 0x0f6198e0b8412d93, 0x531c4c1483e6eb9f,
+	 0x87557c2018fef6e9, 0xfc5596da30e79406, 0xf696526c7e62089d, 0x06f6d1515f6194bb,
+	 0xbad278941b828dad, 0xaec93b23c41ad2f4, 0x23a09b999c3ff322, 0xabec3db6c820863a,
+	 0x55174898c1c69f47, 0x0c3b1e92dfc983d7, 0x34727d15930a828c, 0x77e4130ce17d7e9b,
+	 0xd3a6d2d1c834d4a5, 0xcb8c5607266e558b, 0x9f66e97bab43820e, 0x9ae8ded55a04ee0d,
+	 0xcb402b7669086e7c, 0xb02c12b007079551, 0xcc682b422fd80f23, 0x87d989679da41988,
+	 0xb8eb607762391858, 0x0f95ef31fd1499d2, 0xd5748debc76663d4, 0xac7e952aa32c5858,
+	 0x036c39e8ca1fcc81, 0x36c95a8d8e99df1f, 0x059cccec0a7c1e1e, 0x041c67e015b4511d,
+	 0xaa606108bb927fe7, 0xf3747d7aebe0cc7c, 0x73649477ce06348e, 0x333a7db5c04b79e3,
+	 0xed80c75f3336fc03, 0xe27cf43ffb0c416a, 0xf8a03bf19b1bbd48, 0x693bc97b913036ed,
+	 0xe804ff93ff5a2a77, 0x671c2dfd10214fce, 0x70d066b3034acce4, 0x4abd19bd7958c0fb,
+	 0x1524cbf5a51d2963, 0xcb57944615c4dc1e, 0x8be3972262b8f2a6, 0x2ef216b8c980e295,
+	 0xe0a41e268e70a49d, 0x705594d048ac5b30, 0x7780b4ae33eab4d5, 0x28c32b478376604a,
+	 0x8654205f36355762, 0x7329cb4dee0869f9, 0xd1edde249df5f862, 0x3350423acd4d4c48,
+	 0x83b05055efd98c40, 0x03b5f9c9dcac5a1a, 0x059ed410a4ffe863, 0x90005cc8af68b018,
+	 0xe50be6ab9bb6bf98, 0xeb8ff1237dc8b801, 0xc5d39a12a0658d27, 0x4bd5c03885d85ef1,
+	 0xf6748f025ade59a1, 0x62e7c8f43f5eae45, 0xf16edef5555000f0, 0x57d24082f41ad236,
+	 0xcb335c0df21bf6b2, 0x5f5a84a61d117e31, 0xcbdcccaa378b5b85, 0x23b14f8614e01377,
+	 0x18352716e09ed0f0, 0xeb8a067f451a3b82, 0x9a867be48e4a4d0a, 0x0d6fbc3edd1cc5e8,
+	 0x5f8055e169db4a1b, 0xb0250b165983673f, 0x698ba42fa8ba1399, 0x25a5ad54d8771283,
+	 0xbe5614df5c8b8af9, 0x2692a126de7cc8f5, 0x10c6c8bd7b14e8b1, 0x2606064f41c2dea0,
+	 0xb2a29f459ac32008, 0x1bb88b1c21a9e287, 0xa52ba2e072d03fb0, 0x8f685b73773c2619,
+	 0x028c94d87217d168, 0x4e32525df355aaec, 0xd7781df0fa948c60, 0x18a51c6f5fe82433,
+	 0xd371eeb254bf4211, 0xe9afdea75608746c, 0xf04fd216e0dc10a1, 0x6d0fe35f40b54564,
+	 0x8db6af6d8ec25fc0, 0x8b61cc7856236e34, 0x234b1e522291b783, 0x4391abe34a1523d6,
+	 0xcc20cc4ffbb8ac49, 0x0b80d555c240c194, 0x1730309cdf02aa5c, 0x58fcb653709e0f92,
+	 0xa44337fbe265d144, 0x7d11031921a7d3c7, 0xe0afbb90579114b3, 0x932ee6a9342f036d,
+	 0xc13ed2b2d9732954, 0x1ed33a591fd88b5c, 0xcd2fff4e4f128bf3, 0x7640ae5f67da91fc,
+	 0x17732306c7d440c4, 0xd555592197dc3a76, 0x98770d35d4df1f3c, 0xad1044484ee2430e,
+	 0x6531cd2d9ccc901b, 0x05a553a8096e735c, 0xb62697d093fbc412, 0x6213e2b38f8ebf09,
+	 0xa1b5a235e3074613, 0x5e5fd1874d36d9f9, 0x12ae2bf172b12a67, 0x381a137274245576,
+	 0xeacb1baa242fee23, 0x860e325c4d381a27, 0x74163a9b06726787, 0xad22907f6386d521,
+	 0x5b601e2c95416582, 0x8edd369b8e8dbeb2, 0x877db301f12f90ab, 0x1a44b68c91f1b068,
+	 0xc405dec9a4f3b992, 0x502a68cca60b952d, 0x57d4d92900773041, 0x5210ffcc13e70cb7,
+	 0xa7ed0038f1c6edef, 0x460cdc9ba4b4aea6, 0xbd9d88a9b5ed23ac, 0x8982952d5cbebce4,
+	 0xb94a30696c415946, 0x09d02c2a7329900c, 0xdafcf3d73eaa67ef, 0x9dcbed4267e05b0d,
+	 0xd3da42b7fc0eb4e7, 0xadb82d9aec8facf8, 0x478bf37bf97a4dff, 0x9cd82156de031b9c,
+	 0x5b061c8ddf7d4cb9, 0x8f54bd5f7c9afba0, 0xf087e1a49a05dc4b, 0x6e1d1e413cff9514,
+	 0x4d746a34b6281131, 0xdbbb37810f5e58fc, 0xa49238d3da80d1ed, 0x909510598fe79044,
+	 0x0a86cf89e90b6261, 0x95b1b8b8043432ce, 0xb9682f6fe25b8a3a, 0x36533ada68b38719,
+	 0x322c061b900e137c, 0x6757b7fc84546c3a, 0x112c65f9d434df73, 0x1ce7d4eb4f49cabd,
+	 0x9e49ef3b1f420f9f, 0x24749ee5025890fe, 0x22473741924e42cf, 0x7e92ce005a06eae8,
+	 0x41450389c11b58c6, 0x4d3c2b527571725c, 0xfe7f9370a5f90c02, 0x0d5b4cb265a94bed,
+	 0x75be21f9c99978a9, 0x3e616b80e6c3f37a, 0x9ad1b0f94798902d, 0x6784e592b9462b2a,
+	 0x461fb27cc17a9444, 0xf7e7025040db622d, 0x269beb6cde670681, 0x0e33631b612dee71,
+	 0x6803ab781d1f5dca, 0x9998dbf6d8e747a6, 0x81662cfab73f3d19, 0x2611cdcd8bbe36f6,
+	 0xb038df9c233c113e, 0x4ff7b6cb8dbff1d8, 0x9abbc3e8c3e6adcb, 0x9431ee3a98cc4f68,
+	 0x463eb7e60ab18104, 0x1c6cdf531affed9c, 0xac5b6c2d23024d73, 0x5a51578adfda7b5d,
+	 0x4f2e36c34da5228f, 0xf372a4662bd121dd, 0x02afb45b649f9bdf, 0x6a28e53a9591a0d6,
+	 0x528efe76c5f91edd, 0x3c4bbf0b7cd33360, 0x30495a7efa4c3629, 0x13d16da255fb4331,
+	 0xf4c4dcd48a977e3c, 0x2c29934f344b6004, 0x38604485100a73d3, 0x9a6a2daa1ba02438,
+	 0xbef6dd2f14d3d282, 0x87b2781a987668ed, 0x07ac6d753b18e563, 0xa19c22e30354fbd5,
+	 0x7e43f31ff23cdf13, 0x87e9dcc332d4fa41, 0x5a75d1321e208873, 0x0e7a797c588a1607,
+	 0xaf1bb056986797d4, 0x94c96ea0fb7fea0f, 0x03bc3496ee037c57, 0x7bc06d3472879070,
+	 0x634df4145456ee86, 0x587fb38717fbf3a5, 0x942a0824d7a1ddec, 0x076ccdd50f3713a0,
+	 0x4914d9c85e3af79a, 0x1b17b780d9bd10d3, 0x13a8100673bcd68c, 0x9db394682ad7007b,
+	 0x1951117177c05cb8, 0x6eeb568301f1a671, 0xaeda0be377617b5e, 0x2358959deb7bc801,
+	 0x1f15289e37f92f35, 0xc2210df0e58434d2, 0x4bcb4c0008ac9364, 0x0fa03508c5103a10,
+	 0x843e2cba4bc17d3b, 0x1c926d2457726be3, 0xce52ad94d644c8c5, 0x27e9ab6a9b98f809,
+	 0x8c102277c2922a2a, 0x59955e29017eb37f, 0xb7b37ef3f2cbe907, 0x9e7ca477d7d24022,
+	 0x4aa29c3da15260aa, 0xa338a883ac638d2c, 0x2b4be06398347669, 0xb23d52c20f8d55bf,
+	 0x3aa9a889a740c3a3, 0x441a1019fdf69dfe, 0xf2e6af64a9b98d9c, 0xb1ba4d49ccf50c0d,
+	 0x996936781aa587b2, 0x0751de1651cd866d, 0x7e12595a48c4f3b8, 0x21249bc64804b9c4,
+	 0xa3426e42034abc8f, 0x3d67e418526361c5, 0xcf0ec0957be4011a, 0x354aae6c0101d79c,
+	 0x482fa6d7e58dfda7, 0x9a250dcceaa34371, 0x137aa7bd32d2b12d, 0x8285f802a3bee57a,
+	 0x1ddc568f5ea90bc5, 0x26b9a93fa9b8cd17, 0xd0daf01b6eeb4c70, 0xa4af1cf475936314,
+	 0xaa4c8890106781db, 0xec5f5be5e2fedeb0, 0x5239b7be8b8aa96d, 0x17d52da146fd152b,
+	 0x213b3dae995f6807, 0xfbca8e2029ab14eb, 0x1f8fc3fda0b181f7, 0x628b8bcfa577369a,
+	 0xa5e8d77d64e2aa79, 0x17a2f988abdf8405, 0xc6c7dcee8535a7bb, 0x9c883e13a473c04a,
+	 0x1cfcffd9c3b0a63a, 0xa2a3df7c8910e581, 0xc751a7d6420214dc, 0x84f889ac160f61d6,
+	 0xc5e034b39fb3656c, 0xb2e1fbc5e9623f77, 0x361d2c21bc40531d, 0x589b7883847c7fb0,
+	 0xe57ec46ef8fcb06a, 0x32349ee7cfd9d198, 0xe3074799dbc8a6c1, 0x7a624733e8d3dd09,
+	 0xb31db61543f78b1c, 0x0c31fda7d3fae7e0, 0xfe02b7c55a758ef0, 0x28bc4ba2d65aec29,
+	 0xf017d7c10a8cc0b7, 0xcbb64fe18cef7414, 0xcf0f31698e14f50b, 0x1cf492bdb11b5d6a,
+	 0xe215758e419252aa, 0xa81a869ce352ac3f, 0xe416f916dcf2b775, 0x389829e99e43016d,
+	 0x043792251e6f470d, 0xa98c1d9d8f200fe1, 0x79682b11908166ab, 0x04caed1fa3553bdc,
+	 0x553de66dc0846f99, 0x633543131fe24947, 0xd075c091e0b3c388, 0x0a3257821b35ef43,
+	 0x0fa43bbfccdf3378, 0x9ef15bd49565a886, 0x511af018859bf2ed, 0x03c937ec512a7ccc,
+	 0x6b14e604bf395b4f, 0x9030ecd10b3fa5ff, 0x4ae9002b43c1d4dd, 0x0df951e8ced1ca93,
+	 0x2b7f84ff85007fb7, 0x8fd77423c4233364, 0x381605214ef6e318, 0x4d79834b6ea5d8e5,
+	 0x638b0733db7b26c8, 0xab02619c55035750, 0x4fd3e144a882cb2a, 0x6b8da27f421c6969,
+	 0xcc73ed91065fd7a7, 0x68576ef9809690ed, 0x2a1b005c025dfbf6, 0x0d2ac41562b4c7ba,
+	 0x4f5b83df0dddc7c9, 0xa03b1a575cebde68, 0xa4e074f6751be799, 0x67f8750a20f05c32,
+	 0xe8d0ad8e78c6e489, 0xf88172c7869b8edc, 0xd4163ff1dee9663a, 0x6352add46b66e176,
+	 0xbfd5783d4e731502, 0x0a1c0c782c3a49ba, 0x1d02fdf0043deed8, 0x9efbdb55d8a52712,
+	 0xabc7b9645a015a2b, 0xc5b11ed52290fef1, 0x2732e5ba36f5074f, 0x200deabe94fcc815,
+	 0x728e4ae4b6e9bea2, 0xdb9db468b7ffef85, 0xf26bbd8206c2f2e1, 0x7d49bd8be098013a,
+	 0x9549d81f1667e866, 0x7a6b2cdb34aa41f1, 0xc11790505c01a851, 0x8417ad5015091e66,
+	 0x47813afaa23360c5, 0x38f67b8038b0ab73, 0xe1e3c9e11267a45b, 0x1a618e9482843f26,
+	 0x53c6b7037f6534d3, 0xba06565fa4c005d6, 0xd55c178b9205483e, 0x71c264320cec3099,
+	 0xb5bdd5a8cc4bd9db, 0x40a29faea5edae48, 0x04ac173380404c89, 0x93f2f4c6ee1b002c,
+	 0x24c7c70a778c5230, 0x69778b1a38d0d32f, 0x31ec5d0cdbdf2447, 0x65feec5f04b6dbfe,
+	 0x7f8967225b8e010e, 0x8d292d5ac0248e72, 0xf4d472e145472912, 0x58bfcbb61f7e80de,
+	 0x37ff824462a0a4ee, 0xebdec4c0c92e94c3, 0x8a395fe5b9fea2ee, 0xaf84282c15d1c73c,
+	 0xccf3b5e7d2dd17d5, 0x154de9a51f208260, 0x9dc6c0ad20cdd210, 0x696561410a232a75,
+	 0xf1f7784bf0ec4e23, 0x5a3e93f046b20a5a, 0x895d1be23a7d6cae, 0x53a42d61d5ba011c,
+	 0xc79c4bbf10cc1bf9, 0xec8f6df61641e85b, 0xfaf0835c166ab036, 0x9a3de172f5a81b32,
+	 0x0fe619f7c6411794, 0xd65efcfbc009616c, 0x00adbed9a6db986f, 0x16d751616751c9e3,
+	 0x4430dff2b0130879, 0x0afbcc4152a5f928, 0xcd7a2f72116ee102, 0x5de3af2cef2060cf,
+	 0x888ef09a4751dfba, 0xbac6aeb89915ef7d, 0x9a1543ce4c9acf48, 0x6bf0834f0a0faaea,
+	 0x41374e9863a6e51a, 0x9c4387a69c69a9ad, 0x190dc4c0943804af, 0x4c0995edafb6f574,
+	 0x68be975acc47cb9a, 0x774d7d8490724bee, 0x5399ce6b6995ac99, 0x9c30924b61e921dd,
+	 0x0fc027b5b7322d2a, 0xf23d366b8da27f02, 0x1a3a3b86ece4c84c, 0x9c8f9b286e08919d,
+	 0x39c66be1c52ef75e, 0xf7041a48d219a0b5, 0x5beb1613acf2a756, 0x8c1ad212a3c46544,
+	 0x5823b5a69e4bda21, 0x5d2b8a6211f3a011, 0x17ed1b212aa8a908, 0x139b8eda55f46931,
+	 0x7a7d652ede381d9f, 0x52e0c317268d7b22, 0xb3050c8aefc3b5bb, 0x2110ae8bd2c8c53f,
+	 0xf9652ecf17cb16d4, 0xbbf876c1b0ee0a7e, 0xe620d0416fc129d8, 0x859b923d9563a78f,
+	 0xff3de54dcf57acee, 0xa26f1fec229f5975, 0x650b6bc13e43efa8, 0x35ea8f73c45dd08c,
+	 0x681508826a13ad14, 0xf8c699b9af1ae266, 0xe2f0d981cfe0730f, 0x5a97eb0858f6c465,
+	 0xca28be20a2766bc6, 0xb843c3e3233a078f, 0x13525b753b7d5f5e, 0x842b4d1d7bb6d10d,
+	 0xf9d4d0e81797dea7, 0xaa0eb5304ea0f508, 0xe459ea86f06f4fa8, 0x7558ada2bbd32513,
+	 0x8755a917a6e7b52d, 0xc2bc951d8e6c78f0, 0xc198831a3172bc6d, 0xb34b4600f2006eca,
+	 0xcd4e8f5327cbba11, 0xb1b651b464f7a060, 0x454047232de83bb0, 0x3ada92139f2bdf9d,
+	 0xe845a4ea2c2f3c36, 0xb47b85a9ba4d5174, 0xbdff55efad270334, 0x2a28e8c26ec8ff1b,
+	 0x3ca993bf06ddf36f, 0x0392af74f124c4eb, 0xa44b04ecdece1b6c, 0x8e3f60b51dacb2c5,
+	 0xa2387e28a2623ebb, 0xcb33db98f28f4045, 0x7802f974c07f4cb5, 0x118e0d4d306897be,
+	 0x3d4ebf31b9e76171, 0x1940fd28eeb88788, 0x23bf4ca836bf9890, 0x518ca53b7112ffee,
+	 0x011ea6b2fa7c75fb, 0x8049e4d91bd497c0, 0x2cceab1a9e1812de, 0x008d82d09c0c3d63,
+	 0x1b0470f59def1c8c, 0x342ebbdecaa3fc0d, 0x9a9dee6e07965416, 0x416b7713f2ea219a,
+	 0x82f4a633a6f6f52f, 0xd098d344ac01ac2e, 0x9a21bbd873a5d29b, 0x21b3454913657087,
+	 0xf8b4055ff128ec8e, 0xe38c3eea5820f743, 0xae12006a67737506, 0x08bdc44b88967f38,
+	 0xe4b9d7ddc9fcb7d9, 0x989ea56e679113cd, 0x58b41a7f391a8438, 0xa05bcd55ec85eddf,
+	 0x683b30e75b66bddc, 0xd58d4f52f1d4d379, 0xa5a38fb31158fbb0, 0xab40f9dcbff4cbfc,
+	 0x01cde254f110c3c6, 0xc4711555792f4985, 0x5b1f525da21a36cf, 0x7ef0d10dd1558d4c,
+	 0xf78bc0ac338e5f3e, 0x5438340a5c2b7cde, 0xae97a8faa1ed852b, 0x600b878b0e3ddfc2,
+	 0x9fc7040c5fa7c650, 0xa49719d4c1f33e22, 0xe8eb368a63ecd7fd, 0x025da224f6e13188,
+	 0xc0fc7e6557e9d8d4, 0x235cae513da3f947, 0x2642177fd9cad6f2, 0x2712c5e4af23297d,
+	 0xdef5567bf96e4b19, 0xc8dff864e6bbdfc5, 0xd7773e009239ae81, 0x63dfb25fc7fbcf77,
+	 0xc510b72474f6feb5, 0x9c1ffb9cc4d40543, 0x7c577cf80859497a, 0x644469639d9dfbf3,
+	 0x83335aff80941d5c, 0x78ae6a62664ec958, 0xa5cc3e52b42d2f8c, 0x4ed7c060ccacd581,
+	 0x55170d5a9ce185aa, 0x828053585d80d835, 0xaf6dd058d5ed740b, 0x503383c9b4044385,
+	 0x07975bd9006a38d2, 0xf4d0d19e9628dbe3, 0x41f787061f586fb5, 0xae51365e4ebcaced,
+	 0x94e480ba766dd2a7, 0xa5baad69f7681ad7, 0x86263dff1cdc51cf, 0x1ff85a705fec189d,
+	 0x464924ec762531c8, 0xedd21f70850bd727, 0x7a0a71b545e32f42, 0x8913aec85e344977,
+	 0x1aee0be97248b2d3, 0x400ab211fe009a8a, 0x1e978b46024c0ba8, 0x65af57629ef6025b,
+	 0x6d8b400345827501, 0xad5a9fc0d9bdaeb6, 0x4275a8d26d1d744e, 0x022f73166fc60646,
+	 0x59a15475c8157c35, 0x19bb11a97b047830, 0xad850d9320bce321, 0x8070766e98117d88,
+	 0x53f2ba0ec05ff492, 0x3015ef8d7ea5bdd0, 0xdab69206c282eca9, 0xabb81635dfb16ddf,
+	 0x524af477cdd1afda, 0xe3776bcebce9aae1, 0xc4aaf0827d4c7c90, 0x1f6d052838abd5b2,
+	 0x95291f97ca0fcacd, 0x6830b3f6b98acbf4, 0x4d216c53a2d4d16b, 0x8fa9d1dc3eb96325,
+	 0x1ef3f89edc27040c, 0x196ae0032c6b034c, 0x357c5747d02115ac, 0x18a727fe23476372,
+	 0xb5a22c276a9e2d61, 0x595933c9ead92ae2, 0xe114dd0f8b49e26a, 0x17ff0a41008b38cd,
+	 0x592a6105b66c7fcf, 0xb756a9d5827a3de3, 0x7940730de5b2df41, 0x81077f1320a254fa,
+	 0xfc6aef097e697637, 0xc5d72edcc6d27691, 0x1bc9aecae8ecff80, 0x57a75dead853ee4f,
+	 0xccafa48347de6291, 0x1c7c01aa40792e8e, 0xf1f3c1bfc399b2a1, 0x4e02aec62b2dc30f,
+	 0x6ffd41cffcda46de, 0x626976ee4fb7002d, 0xc790ef44f82add21, 0x77449f7548206128,
+	 0x1426f47da86873ee, 0x0569b28e6654c73b, 0x4e14da967b07981a, 0xa46f97251f821db6,
+	 0xfed897f930f585d8, 0xe5b65c4238cd75cc, 0xb72611764d7e8925, 0x0f848ddf6c61b300,
+	 0x3e34c9293afeeb26, 0xf9619ffc78ed7655, 0xb52e15d36e1f16c9, 0x1cf85b2071db14de,
+	 0xed72f072da2ad505, 0xea1398b297445c2f, 0x26b7b75dd8d7da6c, 0x622834697a63eb2d,
+	 0x686b8a73b688018e, 0x1bea9c08139062fd, 0x30a7df170377962d, 0x1ad19397b587f36f,
+	 0x4b2890f1fd963e31, 0x745c335156d93c94, 0xe0d09d42dca662ba, 0x3893173f6c606542,
+	 0x1077c43db47a0961, 0xaf9b9a1e32221087, 0x6301cead2c3ba357, 0x4044a48a22921615,
+	 0xc2c9684c98361d27, 0xe2c5a0c51ee4e2c7, 0x61189c77bc735d32, 0xb054e12bb99cb79a,
+	 0xf9329470258414b2, 0x32c429d75dc46615, 0x3f3fde6a08f711b4, 0x05266b8d1407a74c,
+	 0x8edaf36f30d8dd98, 0x0626d75ac037735f, 0x216ddd2cb6de6de3, 0x00e9b6662a16ead0,
+	 0x79f94d8d890e444f, 0xbbede22006f92f35, 0x4b40b185bba149b8, 0x3360d65ed348b1e7,
+	 0x4018d72a6614f766, 0x1fe0a9f830f77f50, 0x917378eb0ca5e262, 0x648cd5543b4ac44d,
+	 0x3790f40de27e522f, 0x09f192f13e84fa21, 0x156ba559d9755146, 0x9598eb09e018a95b,
+	 0x6fa00939bb4f16f7, 0x91d193fdb5ef7695, 0xb1176157ba61de28, 0x5f659fb2715cf84a,
+	 0xe47dfc8bafab9ece, 0x230e989f66015bf7, 0x5ec9100a81590e23, 0x094a981620112cbf,
+	},
+	{
+	 0x694018dba0cf1da8, 0x1d2b728749e2cae5, 0x253f42e03b874f9f, 0x6aa6635d3631a23b,
+	 0x1f7d29ff2f96436d, 0x0f87324a511f3687, 0x6e022bc852540c4e, 0x51f0e03493945295,
+	 0xf2757e72401f0937, 0xe7d8e03c76fe1918, 0x5bc7302260f83699, 0x5d68a2c7900be9d8,
+	 0xb4299320053e5630, 0xe243f560a0346109, 0x152ddcd8bfed708f, 0xad83e98b54fd446a,
+	 0xe4a113391d8f182f, 0x5fb913ca0bddaf01, 0x99ed00479cf31153, 0xa5ab3ae597a429f9,
+	 0x78c18a49594afdf0, 0x7c0afef754da8f9f, 0x0f4d08636e168758, 0x8bd5e41a2ed3b925,
+	 0x90df204e862d07ad, 0x8f25052fe2176f1c, 0xdf84af6f1d738fff, 0x071c757c08c6c2d5,
+	 0x01f8e176033b7e47, 0xd0431b6e38f1035c, 0x1f2cab6ff375f6a1, 0x53f07fba8f43e343,
+	 0x07d9983ea11b83de, 0x72d4626d97e7222e, 0x99d8ff8b9f324618, 0x9d3f249e4744420c,
+	 0x6b7b8627e872f01a, 0xe2faeeaea7d6d877, 0x2fdb250c53896b00, 0x63569c22cc4337e3,
+	 0x743b2204ae6e8f2c, 0x4f1d28f95163ffeb, 0x07e52b3c150fffcd, 0x78284b388c94a1c7,
+	 0x0e681ce6b9024802, 0x42f5db3c76a403e7, 0xe726d93d651d4618, 0xb20e1964b7bb214e,
+	 0xe11294d0a77c7b45, 0xb9b71494171d920a, 0x8a6afda05106dc1e, 0x364125595fcf1138,
+	 0x608286d404279fdb, 0x5635f8a5d1155670, 0x8047c36c85849144, 0x269b8afba7b648c9,
+	 0x6e91e8fb98d05e7c, 0x7449ff7120f47061, 0x118defc862c5289e, 0x1cbff048b3870962,
+	 0x8cd3563ff6bb05c5, 0x8612e591949c3003, 0xbdb6f7035ac233bf, 0xa293c5ce58c1ff48,
+	 0x8deab17a2700c5c3, 0x638de41443511e5a, 0x73b105aa5bb35a0f, 0x6b8a6a06abf31db5,
+	 0x97df0c905eea94b2, 0x74a61e77b6965c2f, 0xa2bdd769778155ec, 0x3b5d975174396768,
+	 0x31e44f9a2626cb2f, 0x72d3e90e9500fe2c, 0x53d64da0658830b2, 0xb61fc4e3ccb5bcf8,
+	 0x63ea05a78f7cdcd7, 0xa9a78516440a240e, 0x32bc9c990c7a204d, 0x26224b94f4e074af,
+	 0xe1ab3528a961600c, 0x4fb2b0eea8425942, 0x9c4523d77c1b921e, 0x6fb43697d7a337ba,
+	 0xe6ff2b3e9ce074ff, 0x1a0997965f018150, 0x3951bd65a45d78b7, 0xa3c6c5dd7af3eea7,
+	 0x3134b50ec9dd1a4c, 0x6b1cedc11adebf54, 0xda2c26b22149bae3, 0x401b3bfaa9f3ddd6,
+	 0x40593d54ac299d5c, 0x43c5835a45600762, 0xf0b3e0d28d1354ab, 0x08524db0c669e172,
+	 0x8571f01a5d7fd255, 0xb5d2a15395720b39, 0x9e08a10280723c89, 0x21a9ed2d91e1b3cd,
+	 0xae46fc86f6eccd99, 0x581e84f55a398652, 0x633228cd04910a8c, 0x720a9b5832f47c78,
+	 0xb54ee8a4d535e404, 0x6e1d2cd72068edcf, 0x924cfc81302539c5, 0xa944ab3065851130,
+	 0xd8d5234ea5c2af56, 0x5dcc30cee34e8b47, 0x184f22135cd3354a, 0x2a9a6326422e4b49,
+	 0xfbc777552ccb5fb4, 0x5b5590d30f3a6cfe, 0x1bf7e2f021c42cc0, 0x013a56b2dbc2b089,
+	 0x0e108933cd46281f, 0xb4e86391d499be4b, 0xe7d520e047f00cf8, 0x0591186e5064c507,
+	 0x032d78c6e174c259, 0x3da987b6eaa962a0, 0xddb3bf8591abfc5f, 0x4ac2106db8491e9c,
+	 0x65aaf45e44276aec, 0x58dda900e360f45c, 0x21d5deae04016f15, 0x9ec9946a1320bac7,
+	 0x1859a0744eb0a94f, 0xaede102e752ecf98, 0xe80b544fe2dbeef6, 0x188617574632f090,
+	 0x6609d22c23861306, 0xbfef15c1b8ae7860, 0xd88e57151059c5cb, 0x1ea0c9a39dab2699,
+	 0xfd2c6ff059c05064, 0x03200680a535d284, 0xb42fe2129cb17afc, 0x89b3566c5b5dd0bb,
+	 0xf8d9fe9b3388c88f, 0xd614e6d0327f30c6, 0x0971fca21c986887, 0x33034af2d651daa5,
+	 0xad888150ea3b1119, 0xbe40071985a877cb, 0x09d893539449f909, 0x42397f598ed8ebb9,
+	 0x36c1967f370d6d63, 0xecb70bc484219ce3, 0xa288b692821ea700, 0x882c37edaa607269,
+	 0x9e83556195c70b43, 0x4173db124d615147, 0x4a3b6e65e3106704, 0x91890f9362ff8ee7,
+	 0x2e4c00b06ec4d262, 0x474bac78c521fe9f, 0xeb4e4ae0b167d90a, 0x75c61f4b37723997,
+	 0x70fee9e38d4616ad, 0x9f1985ecf431574a, 0x68d72566ee3debf5, 0x499103ba7035e6fa,
+	 0x02593e5e74cf3997, 0x1a640769b9935218, 0xf525fa06c033d3ae, 0x5c30c876e24ae3fb,
+	 0xf964d6d2163ea452, 0x8e2986ccd1df68ad, 0x9a5b0f046b5df50e, 0x3826e37d6fbc630c,
+	 0xbd35188a6deb0897, 0xe18a61cf5c2e1bba, 0x3803f26fde0cbeed, 0x425c55c704c32b7f,
+	 0xa995fea0ff008506, 0x512e1a254fbaf588, 0xe408676cdfaa1041, 0x3251a62e92bbab43,
+	 0xe37fe450cb87b734, 0x00316058762f4df5, 0xc78f6de02114a2b5, 0xad31699bb0b6bc91,
+	 0x0ff8beb7d18f0e75, 0x418b0b3214a82e29, 0xeb4651f6e8438354, 0x160771d146c47195,
+	 0x79ddbd31a8c60826, 0x1a9ddb77b3aeba6c, 0x661054dc63bb4d3b, 0x767691f70c30ab50,
+	 0xfb3bb12546aca678, 0x6bf3cb2828ba799b, 0x0bab8ce2785032df, 0x8cd4f1f63946dfdc,
+	 0xcd4cbaa846d8e2e2, 0x9169a63ad8efab42, 0x296f39ce4c60bbc6, 0x0dc82346cdeca7d1,
+	 0xae166783b3aedd87, 0x2e389f0f12ede6df, 0xf88a40fa802a8d0c, 0x6112322bf43d8557,
+	 0xe16327644dde24b9, 0xbc2d81f1f78c3511, 0x20380d095525d31d, 0x6ea9e81aa65175fd,
+	 0xbc9c03ac91ec1cd4, 0x2c3855328cf4276d, 0x8c3075312be6669d, 0x48974e3061dbae3a,
+	 0xdcc777d4ec341f1d, 0x0074c60d000fd9ab, 0xb88700099a328390, 0x677422b29e24f542,
+	 0xe051348add7dcc65, 0x0444c776a942cb59, 0x659a698917321f60, 0x91470da2550883e5,
+	 0xecd96c9b1bd08be5, 0xbbd358e4fe308f42, 0x1ba8776a43e22161, 0x449d89b8a6c5e9b7,
+	 0xd139318c6e8955c3, 0xab4331341218dbe1, 0xb17b25d916d1adb2, 0x08815327e1a1341e,
+	 0x1759534573b60bab, 0x82eaa151213cd780, 0xcb53c61404fadc73, 0x4708d6c2b35d38ae,
+	 0xf16fd67b31db2ba1, 0x5bcf78bc58430467, 0xfda40dbfbff555f9, 0x31f73968d12c556c,
+	 0x6e6f3bd95cb45eee, 0xd752b01d70137d4d, 0x637986bffd610ab2, 0x1857e195b6c17267,
+	 0x2ac8c3263890d6eb, 0xa8117e7dcf103936, 0x3b603e32c55413ea, 0x32018d8995782335,
+	 0x225e081957011a8a, 0x37c343617111aa9e, 0xa41d9525b232e9fa, 0x8c9f66e896698889,
+	 0x1666e1f74f643ee1, 0x9798f96d466a632c, 0x716ed8aeb13701ac, 0x15b20479f108ed75,
+	 0x987f1c0aaa95e896, 0x569e4f832725143c, 0xbcf6e9f6e0365fa5, 0x79671cac5c6bdaab,
+	 0xf11fafd807b11601, 0xf1eecd345b27872f, 0x9204170c142df29d, 0x9bfc587ac611d741,
+	 0x4964d81ea84ffc39, 0xcc4620815b8df3ed, 0x592dc7ba1b99c2cb, 0x1a5f602ddb960908,
+	 0xd5d4a3721afe7fdd, 0xfc17ab461c70f1ce, 0x36215a04a5121a96, 0x1411b77cad25d099,
+	 0x98353329c2a1d55e, 0xbe115969277d713d, 0x2b2cfa5860834a2b, 0xac88daf723bb6cf9,
+	 0x2a921f2c09a4c982, 0x2af556c38d49d5b9, 0x0f882c81b98cf044, 0x578a77add442a2e1,
+	 0x27cb0171c12dd7c2, 0xe877605bf053a05a, 0xf183f644e5998fde, 0xb4fa885ec70ac070,
+	 0x6e065b6f66fe6317, 0xf11fe6dc2f45c34d, 0x322b02606a23f62d, 0x1eb8e953ccc3ae88,
+	 0x96348782dd80e271, 0xd90e5a803711cfba, 0x199ef94e914114c5, 0x43b7c46346a8c31e,
+	 0xec014333780a6a1e, 0x8902e39a7604efa8, 0x61846a9d57a6a896, 0x82e1c7d956477718,
+	 0x41382b135cd10fcf, 0x85a0d81f75abcccf, 0x2a38837111079b70, 0x11df1299a4773de3,
+	 0x2afe61edcce26419, 0xe7eff7e836575a44, 0xdca8f1b3660969d4, 0x44e7d6f585ac49e8,
+	 0x3799d39a9f3e3a11, 0x79d2e3febdeb603f, 0x91d2362239668c3f, 0x4315091a9692eae5,
+	 0xcb988db83b923075, 0xc6a4ef2a2c026ff3, 0x9dccda8d4ab697d6, 0x133f6d8c55f26b75,
+	 0x04c9c7d06bafc8e6, 0x01c4f38182b4f0a7, 0x2068960a5ddbe89c, 0x2a87cdd3cbd221b1,
+	 0x53461dc3a0ab7212, 0x7041bc01eda73913, 0x2924ebbb52d7c08a, 0x22a8ecb97b7a2fa9,
+	 0x6548bb7056944762, 0xc464b87d15463825, 0x0b2f16bd4316c703, 0x468515a14e504022,
+	 0x84070351338337d8, 0x11c92ee3ed88c192, 0xebfcf2f10fb29708, 0x65e90431516d986b,
+	 0xe60190ac9fe9fcd4, 0x40b34f849b7e6913, 0x6fae2fed6f70d568, 0x31b1d4984c9c2f41,
+	 0xc77d70e296c5ff7d, 0xadd6dd1f22d8ee0a, 0x4bf1a13ca47a2578, 0x2096ab8a66c3cfab,
+	 0xbe2a6b09bd8595f0, 0x8cc1f16d7ff3aba3, 0x90de38f94900cac1, 0x092b55c0a0391123,
+	 0x8dddc78146152126, 0x3ad4260c8b4f501b, 0xfb3edaf68cdc3efb, 0x2775b06909065b8f,
+	 0x7b9f1d51d07759ee, 0x02546539d1404aa2, 0xdee00007770820b8, 0x1470d2ba3ff4237d,
+	 0xb01b51d18206630b, 0x29a4f1a76fb31016, 0xc2053c3ffc123fbd, 0x590133dff74328c1,
+	 0x0bc9bc29733ba7a2, 0x6f38c2f8150b6233, 0x66c99631e07df1b2, 0x255884a98765b1ef,
+	 0x7641829c53b965b3, 0x45c78c088ec1b4a2, 0xdff42131c40c410e, 0xb44e1938626a86df,
+	 0x6ebfc5915f4537fe, 0xb2e4930e2df3b313, 0x4e5796b40720f3ec, 0x8eab1e8538357e28,
+	 0xaecfe108153896f9, 0xd5c5b309c60445a8, 0x2ebba57cdc3d6757, 0x5754cfd9412be8d1,
+	 0x70111b3e2c07039d, 0xd2af7123d22b1a52, 0x40a8e4aec8a836da, 0x094bd3bffb446233,
+	 0x66101c7d0a3993d2, 0xede26c1633aabb23, 0x5c637412bb6071fc, 0x5252ba3bef92f775,
+	 0x7f18ad9b4c598820, 0x9ddfae5e4071aeb5, 0xa0d3c42a4ff7d264, 0x1b98ebdb93beda23,
+	 0x387174191edb14ad, 0x997c571c8fccbdfb, 0x57eb739f6cbe78cd, 0x734c1250fb36c7e8,
+	 0x16ff50cd137f64e5, 0x5e6caa14130fc7bd, 0x3bf772ac44ea33f8, 0x2aca543db5f43906,
+	 0x43053470a709a3f8, 0x3d5b4567558ce808, 0x7c1e209880b14a15, 0x5b9c34e60a7ed34e,
+	 0x2579396cfb227afc, 0x23bd2646b7a476b7, 0x4842999d48831d18, 0x391d9d7cbbba9645,
+	 0xfd3e94077527ed03, 0x77a5e0e0a5714192, 0x54dd9b2f656c2c16, 0x54c51b0c8dae38ce,
+	 0xd4aea76abd6a9e15, 0x10ec121012892f1b, 0x20472a87422aab2d, 0x95794e3c6c67ba64,
+	 0xdbf823652aea1cb7, 0x78d0afede8a2bef2, 0x8b43815f0754e9aa, 0x4b8abb9da45de94e,
+	 0x93e5cf3782bd447f, 0xc743ee422a8f1703, 0x481f58aec248fc71, 0x2fe3ea404b54088b,
+	 0xd00d6307b9d9cbd0, 0xfee169b88090b9c4, 0xf2c1f2b18eec92fe, 0x4184e7507c4e1240,
+	 0xc771b5fed121b744, 0x892b9f9c6a9b8edf, 0x5f9802f9be77be8f, 0x85a0c60d011c6c9d,
+	 0x554c49edd66f4fc6, 0x45c8daad4340e198, 0x77db24b3c7d218e5, 0x34232f1c4afbc618,
+	 0x91e26c46c8926b3e, 0xaee379df1a92afbf, 0x1c5cf7c741f211c6, 0xa1753df766af80ba,
+	 0x327a8914d8f044ec, 0x7ef12377089d5ad1, 0xb0eb0ad29f63a86a, 0x5e6a7034f2e75d00,
+	 0x38ba080ca3277acb, 0x9495fa039bf78b11, 0xc5c7b66f21a3a34e, 0xa5c05ecae54db9dc,
+	 0x9478cb2ffb2ff186, 0xd115db68871c7b21, 0x19a7b8340b085f9d, 0x313ce1add56e7393,
+	 0xf53874c765406ea2, 0xcac23c5dbf704956, 0xd8ca84a9a1dbd6ee, 0x54ac3951e0958d39,
+	 0x0985b5d3091989c9, 0x329a00b149821b4c, 0x1e9820d88ac887bd, 0x590e1189339b43bd,
+	 0x325eafc336770f59, 0x26ea51925654a4de, 0x5624f9922b11b7fc, 0x9704d92e38846a35,
+	 0x1bec4d488af43cd5, 0xfe1412029208b358, 0x2468f0f28db4b82f, 0x6af807062a9000a1,
+	 0xe4a434963951957d, 0x97e6aa05eab87b2e, 0xab79f94cd036871e, 0x37a36941be73e1fc,
+	 0x43b94e7c7e71d6ac, 0x53778fd07dcb6f63, 0x27c8e0f79804a833, 0x906250854199ec40,
+	 0xd084a693b50dc80a, 0x36d7410a933711fd, 0xca183de06d73c840, 0x16e080ea3e5be7e6,
+	 0x51fbe3e0346dea29, 0x731b6ff509764da1, 0x29fe95be2ea326b8, 0x1cbf2a061ade5ea3,
+	 0x3c97436786ab1a34, 0x0e0166d36ffd0f39, 0xa81d72252f7dc48d, 0x26af023dd981b90d,
+	 0xd7e2bce2f7cdb3a3, 0xf87b8743b940a866, 0x8e623ceda5a643f3, 0x1db5da899321dcc9,
+	 0x9ce3896681d41110, 0x75e65ae043e0b3c6, 0x38cb9d45400c5542, 0xb4dd4cd295013e9f,
+	 0xabfba8f6aa707996, 0xfea9e42611b783ed, 0x30fbb3e3559af665, 0xaa36d9b4e23e07e1,
+	 0xf37baaed7daeb8cf, 0x5ea4780ccd725ff0, 0x35fc1e951c1005e3, 0x4df75769bcdd5d12,
+	 0x965b9890a734a694, 0xaa24fa966f3d091a, 0x80bbf0c48e8eaa9f, 0x2d79c44d4ac923f5,
+	 0x037404ead25e4c3a, 0xe51f03596240ada5, 0xb1a4aa048f760cfe, 0x9e269e16d040ae66,
+	 0xf1468d91e95b20e0, 0xd5d00c665fe08967, 0x3166d54546a3aff9, 0x2536a0750de535f1,
+	 0x7d9903f0788ac6b9, 0x3c1b1af10f39e000, 0xf6c0f366bddce4af, 0x31ced0b5e727056a,
+	 0xe512a3d0da0beb47, 0x0b7393d134396ead, 0x46985587cfc76bcc, 0x77b206728b75981c,
+	 0xafbcf275c105420f, 0x586e015f76b80f31, 0x9d7bab6d972996ba, 0x74dc5307da179fb7,
+	 0x81a0ddef6931fd66, 0xd1ca524b4407e5df, 0xb28ada0cc360c13a, 0x87e124df6ba207fc,
+	 0xdd7a1d0af12022ae, 0x139d83f4ad5302cb, 0xd2e25acfc38337ff, 0x6984ffb85e6709ad,
+	 0x0ea81bac66c87f08, 0xb479f7c359313ca6, 0x170283feb7c2bb20, 0xb60d6187e2da0bed,
+	 0x87be244806454b25, 0x750fd21c750909ea, 0x95121b6e679c9a9d, 0x8d267d2e3b51f911,
+	 0x4c7a1a8a7d9af2b8, 0x42d6cd65a2b7698a, 0x1c1ab8532cacfe07, 0x7e461360562ef4c8,
+	 0x8b5c4c94fa9ee1cf, 0x21319e7fd69b45d4, 0xb2d95b77da31ef10, 0x2e68355184ecf3cd,
+	 0x0cc5a0667b0fa082, 0x15f9d4ac6213f9d0, 0x56b6a0575f4ed1c6, 0x6dae67802590d27c,
+	 0xa75272fa6ffafe9c, 0x4c02f17bf9317f6b, 0x187d711e6d96681d, 0x6e08c105ab9dc81f,
+	 0x4096b555a1edcb69, 0x4a15ee999dba2a46, 0x4434c2bbbed3d134, 0x6769442bd2e256d1,
+	 0xe7e6e9a8ff98a853, 0x57f774d8c4790b29, 0x676171e0e5bc26f7, 0x1e18905bfcc0780d,
+	 0x9320ad5c045ba413, 0x304ac7345b378c84, 0x31be7f0fedf3b401, 0x05181f56e10f3ffb,
+	 0x988662d25561c781, 0x4e82176d07bf6623, 0x5f4e667fdff3f78c, 0x4d762bfe972ee577,
+	 0x4995b05004525e1f, 0x13394f5333dca886, 0x84e6a8587e802abf, 0x8b0a6f3baf4bf3f1,
+	 0xc68cea8181bbd525, 0xd8543705fcdea00c, 0x77ea2ed22846c72c, 0x19063aeacd453e96,
+	 0x156025dd7b085f22, 0x509d1871c6cf0916, 0xf4fe24c4348018da, 0x2910fef845cc0a20,
+	 0xf18a94a367fe9567, 0xcda8b9684b2dde4d, 0xa61fef4dd2d49ebc, 0x501380f52977676a,
+	 0x5cd96528612fa46b, 0x8db4d2b1f6ea2871, 0xe8ddc92e17dc971d, 0x111cce2ae6a62a31,
+	 0x4c823a7ac1eab47f, 0x6d02f7ed0a6327c6, 0x0961fc16eb693876, 0xa9b30f26034ea8ef,
+	 0x7f0529abdbd69358, 0x032297c7f6f0861c, 0x2ef26da6bcd4ebc8, 0x5bc59277070c445a,
+	 0xac60daaf1d66d093, 0x14a78ee3721823a6, 0x4b8f6cedefb347ea, 0x35dbb80b33504fa4,
+	 0x990e0d68f572cdac, 0xf61db352097c0541, 0x971186f391ea2942, 0x3c88e8eb2d3cd29e,
+	 0xfd4fc7fe6620b637, 0x2573ad27a57817cd, 0x104b57aa1d83902f, 0x49ed9d6237e68e60,
+	 0x226162d1c2729815, 0xb7a3eaae8ce08526, 0xa4fb4a4f9590bc00, 0x903f494fdfff9b1e,
+	 0xb0d549c01cec20f2, 0x928ddeadc6771c95, 0xe369bad1bd4d4673, 0x32d9f37598333553,
+	 0x106079ac07d5cd80, 0xd7e240710881ca5a, 0xdad11002dc492b1b, 0x9c8d365947047174,
+	 0xe2549167e5fdaddd, 0xbe2b0fa701f60635, 0x852270847e21af17, 0x5b28adf292a6c33a,
+	 0x1fb7f8a880a3584a, 0xb65b93a9053d88d4, 0x5e9bb39bee2f3dee, 0xa429489b21f279b3,
+	 0x9acebb4827863c48, 0xbc06b8fc7e73a199, 0xc55382c230038326, 0x74f11f6c0cb50a44,
+	 0xf5a814d19b78e9e4, 0x7edb4e6477a8b016, 0x9a171ebf94da4d1b, 0x92b6504e97f8df2c,
+	 0xde6ae563ace04735, 0xb21a84332f75b279, 0x5ba1ff540ef63919, 0xac5bb7d4ae1606ed,
+	 0x07131bb04792a14b, 0x864809746b764287, 0xe83f7221d1684d77, 0xa58ff61075a6ce53,
+	 0x27f11d535535c42a, 0x9dd5357890bbaf37, 0xb9498195492b4042, 0x82c3b7a312604d3a,
+	 0x7f94d34cd22d3209, 0x62407b3c0c4d4c48, 0x0fc4b631202eab35, 0x73061820c665047b,
+	 0xbb652e9b165e83e9, 0x701c2c8bd8210ad8, 0x7e776c8820711049, 0x0c180a842845803e,
+	 0x4fb000761b79eb11, 0x91a35535c45992b5, 0xf16c9697d9674768, 0xb632b6f29d68fca4,
+	 0xf24683a9c561a0b2, 0x75ae33b9b46446b8, 0xdd6f52880626dba6, 0x3cf1f71c2b4f39d8,
+	 0x180b5bdfc4757721, 0x389592c0472c6863, 0x1b384799f3ed55af, 0x4e16d04fb8c0f003,
+	 0x5f6586e30b922490, 0xfd91c4f388c8979e, 0x9d32228d628def3c, 0xabebd1b8fdbd1b8d,
+	 0xa9b29bfe236c147c, 0x085a624c2c745ea9, 0x0f7ba4a6909316f5, 0x57e8a9742a69bb37,
+	 0x9b784c2c18995923, 0x1ce994c052a47b7b, 0x7f2812b789911d07, 0x62e3e4c2c47340cb,
+	 0xebadabc9353a1aec, 0x180142852ddd4a6e, 0x32ad08b9e178c78e, 0x3bd5db652e4689f4,
+	 0x9d64917de21be6d1, 0x832ffd305892cf94, 0x5ca7bea0f5bb7189, 0xb59f1643a17a0793,
+	 0xc7de91adcc3af2f1, 0xb4abd750486538d3, 0x8151ac1c7abed9b7, 0xa18f145eea965900,
+	 0x410e6a476b0d801b, 0x6165038214adde31, 0xbf4df51e2c89841d, 0x2222067fe0df269b,
+	 0x5efe274f3c6cbd42, 0x2dd080311e923d47, 0x5c82fdffe479b174, 0x49f6bdedb51dabbf,
+	 0xabf1e1bc973e6763, 0x8e887b9a0cd6ac54, 0xf27b6363a2ed069b, 0x6f17eadd226dda9e,
+	 0xa15af3ab04e4680a, 0x06efab6e5a9feb16, 0x62f55e4adbeb2976, 0x23c673b91fa76ae3,
+	 0x17a8cc6082160b3d, 0xd632cd8d367ac895, 0xf1656fa686fe6147, 0x19c218d2df807a96,
+	 0x70444802f3996dd7, 0x5d9db4cf6bc1563c, 0xd119a1b8e812f21a, 0x74e1bda3c63d1d87,
+	 0xa2d46173cec0a8ca, 0x32e62ac7253c15d2, 0x1a9ae46f6e3d1f8f, 0x456fbfb258dca044,
+	 0xc94c69dd8b56393b, 0x001c533d299c2616, 0x4855103e6ee4ac78, 0x3bc419813da47a6f,
+	 0x9f5e540586346423, 0x56804b2df1d18b01, 0x22e00e4e18df1f4c, 0xaad52cc10da005e1,
+	 0xedb51dab29c48d2c, 0x2e0cc6d1f1200d1e, 0xc597ca52160817aa, 0x669c07b7ed32409a,
+	 0x5e786488c99e3a49, 0xf4df6916a4369dd2, 0x93064bc2506c1785, 0x9a43c5969a9df646,
+	 0xa7e33a80735f5a1c, 0xcdccfb11f7c25a0b, 0x052207dd9ebd7cbd, 0x645ee3f20ef10d4d,
+	 0xb68556aa9de2a5e3, 0xb84067b7e581ff93, 0x7a0a509360f31e11, 0x094f1057452688cf,
+	 0x873079dca7d3ec8b, 0xc9425deecd010c45, 0x0b520f4f92c59d6b, 0x2d71da5bf45c4c67,
+	 0x87535d57d1d01c6f, 0x7a402ed45ab0301a, 0xc2c4d21beda58947, 0x4072ccb6ffca22cb,
+	 0x21fe707f543175b9, 0x252bcef512743ad8, 0xcc588a18a8302491, 0x84f439770526a57a,
+	 0xed70308152f7ebbe, 0x7dd70b97a0d2d1d3, 0x950cc1569e52edce, 0x15e2ab963bf4d58d,
+	 0x28cb8010109e7fc5, 0x4824c25bb852a978, 0x0235c6a98bac7b37, 0x2efe01ac4beb1d12,
+	 0xcef2c1a91614e3d2, 0x24de4c5ea2e9a480, 0xd61ea8547108f8d3, 0x4f40e3baabd4c7d2,
+	 0x5a5e0dc84391716b, 0x0a23c0e523400ceb, 0x13d0737add2df222, 0x9e7e16841f635b7a,
+	 0x2baab2c918bc2863, 0xfffa1572305ef267, 0x51cce903fe83e22e, 0x0b14246196644549,
+	 0x6fd0a789646f4aaa, 0xd3578244baab01fb, 0x4a86cccbe355e30f, 0x2a8e0cb57aba56b1,
+	 0xc38f7b8f1c6676fd, 0x7f59728f82359945, 0x38ec39d4f6ac81a2, 0x2d45ca2e5b5ffab4,
+	 0x6ce99edd236c6433, 0x938e0579871b5173, 0xb4640182749961f3, 0x240547503a9e630c,
+	 0x5bafde2a18052ab6, 0x6485037a36699ea0, 0xb7d72c3736b5c670, 0x8108d1f47b89b0df,
+	 0x23c3e21b99ae61c6, 0x21d6bc9a290ab69c, 0xd959d0c8fd7e5d7c, 0x27af1fecb9025531,
+	 0xf140d3b6cc9e0ab5, 0x1397d65f68796b31, 0xb4921359228e2331, 0x29c4b14e9d14ec58,
+	 0xc33ea13523b55bf5, 0x64595434822713c3, 0x601ea4763fff2ada, 0x11d64c1413c64bd6,
+	 0xde79e843435d7048, 0x41c73e493e20072a, 0x248ae84a5095ab28, 0x58631a87c17a21ee,
+	 0xb118f83268fc2004, 0x4ae0c7a2476314de, 0xd1f806d76c6a9e17, 0x5788f60d615687eb,
+	 0xd9140572807ebaf7, 0x99161907e016468b, 0x40b619242a08d5a7, 0x1923d1918c5e60f8,
+	 0x537bc883ce30829d, 0x3760a8a14ddaff4c, 0xf925a35c09ca507d, 0x7bd1154f752f4c00,
+	 0x3a6dabb6f3066dc2, 0xb7fd573921ad6de4, 0x9b7faedf074216ca, 0x8316c6c776972db1,
+	 0xf0c51e97de6225b9, 0xd851a69fdd4d9711, 0xd9c7397704e07110, 0x873421d4f9156756,
+	 0x269fcf680ebd3fa6, 0xa64b0f045e67c718, 0x11a382419b129a9e, 0x67c503496546353c,
+	 0x7185d8272d0fc972, 0x4080a8d876adc119, 0x2481eb8214d13efb, 0x9a96c1b0574279ee,
+	 0x22d0b39e4d7d53a6, 0x5c2df3d8dcbd58dd, 0x4b7df34b69f7b28b, 0x0c4709afba7d6edf,
+	 0xe094e07f6fd96f88, 0x149541b1f6ef354f, 0x4afd48651c3fa245, 0x504f1131e0316512,
+	 0x3ad65f979ba932be, 0x1404fd176a867160, 0xbd668f0cb35dc5f8, 0x9cc57fcf586d87ca,
+	 0x66701829c9e8d8ef, 0xd6dc7c8377c667bf, 0x6587ab1b58743531, 0x93f33aac0e6f2b6a,
+	 0x16f7cc3845531b98, 0xa7014868a92b11de, 0x81041e2c8a541bab, 0x521480d43f28dd6a,
+	 0x52a98ae009e9d9b7, 0xe1678c755c63a64c, 0x32a16e5b913c0bf0, 0x6d6878194c436597,
+	 0xa8122f7d06926a20, 0x93505f0b730a8cc1, 0xfe38797646f7f067, 0x2885b6274a9d02ba,
+	 0x70c97ad81f9478fe, 0xe474bf578ff4d937, 0x0979ca0489744d45, 0xa3d55fb1362131f5,
+	 0xa07a3bcb738d910e, 0xaa9b49e0d38cd4ca, 0x99cc236a92325d92, 0x261b2f9f86135ad7,
+	 0xc47b3f12004a42ce, 0xa05e6a2c3e90ca3f, 0x514db95258a2a706, 0xb46862cbe28f7922,
+	 0xbd0997937a5b02aa, 0xcb1313ed68333132, 0x997b54a2f16adec8, 0x10f92ac04c6a56e7,
+	 0x60b64b154de36642, 0xd49ca410a3a1774d, 0x2a418e357da18ea2, 0x4ebc5934f65d3955,
+	 0xd340093f9360e454, 0xf502980775880057, 0xcd5cb99c16daae07, 0x76b46c146d82a211,
+	 0x532b81a33641c01c, 0x94c7d00f9a70c2a7, 0x3902e1b6bcbba7bc, 0x3dcaad46ff4bde7b,
+	 0x4a14a63bcea83a5f, 0xed8fa82c2259b78a, 0xbc8cd68f19db8840, 0x98b290bf76a59abe,
+	 0xb41188b4c6abf256, 0xabb76c20a30b791a, 0x64c0641e3bb1bed7, 0x670565e61a114b3c,
+	 0x9f6f1f93eb935b87, 0xe310d2a21525c4d9, 0xbee9187a142f789f, 0x0762ada1e9da92f9,
+	 0x8306f46e468fd3fc, 0x5d2699573cccc91e, 0x0ffc2ca482375e2f, 0xa9e9cb650726317a,
+	 0x4ee781d3595141a8, 0x2aa45d4d8def6413, 0xd21522cb7948db5a, 0x719899d3f8d40de8,
+	 0xec7bae39407a7935, 0x5803b50fdf57b9b0, 0xc9d9eb6b9c224669, 0x5110c9ea77780644,
+	 0x2bc7e0d2d93d135f, 0xd797ef7725c8e9e4, 0x8061e72743b2069d, 0x6fced9c51f99cf39,
+	 0xe5bceafa6e32ffcf, 0xe10e41a781a06911, 0xf4332423117199d3, 0x532ed8fa1f0aeef3,
+	 0x89fbc3e7408bac5e, 0x7e282d6428ae384b, 0x6fbdc86240ce75eb, 0x690fc1a498c5b5c8,
+	 0xd475607d234a128f, 0x3ca05a592b751c96, 0xdcb6a4be343f2f3e, 0x21c0010bd6ee270d,
+	 0x71e51621a58427ec, 0xa43e665f8aab6c45, 0x424358478c95ad97, 0x6a4221e6f5bc17f0,
+	 0x6bd9047e4c69c205, 0xe930b83d15625d72, 0x1015be6bf3ddb257, 0x557afa5145cd3614,
+	 0xef6aeef0bedc21e3, 0xd77d0696a3e611fe, 0xbdda52bbb3f5b06c, 0x9407777d188747b0,
+	 0x58a1108abea16040, 0xf54b507658d2ec08, 0x0bc628a4754b8fb0, 0xa6812143ba23701a,
+	 0x3c9a178c6df754f5, 0x6ab7f52bb079c4ca, 0x68dbdae3a7574401, 0x705ca7fde7ada451,
+	 0x77b695fe5927074b, 0x2f230a00c23db66d, 0xc65e43be8ab7e3f8, 0x73086f65ee770fc5,
+	 0xadb5e9d4894d4660, 0x837030b641561ca5, 0x7e0544ff63584e64, 0x868d1389d3545e14,
+	 0x07194ab0183b3ae3, 0xf938f0f24bb64f6c, 0xbe3cc400959f8092, 0x75e4d6ac4e2deb37,
+	 0x26a6140c4b24c453, 0xe11acd7fe87c7a1b, 0xca9057dea81d77f6, 0xb267e4a857f0355b,
+	 0xf3e231d45d8b7dc1, 0xd831f616509f2ec7, 0x4c8bbfecdee22b21, 0x81b49ca4243e4af0,
+	 0x8a494de0263972f4, 0x1331242550834d4d, 0x371336d2fc15db0e, 0x2cd1cb2505ad1d49,
+	 0xefdd05bd7d10932c, 0x17d40192a4fe0590, 0x25249657f331642f, 0x24252d85696e016c,
+	 0x7f8b64800a14ad42, 0xddbcdd091612692f, 0x6aff1b4fb4835a32, 0x7ca53d528f6ced42,
+	 0x7b09ec01d18dec6d, 0xb805f003e9ceab81, 0x11e8906f3182fdef, 0x6a50572a6c31449b,
+	 0x54d4cb6b0357171e, 0x51866baa5ce17804, 0x06d43f1193cd40e4, 0xabdff794dd8ae74e,
+	 0x8fa2a5566f591ba2, 0xb6e9b549b1d84003, 0x66427e00213d612f, 0x5b611dade5165c30,
+	 0x57a0c16a4292ecf9, 0x4cd69427796406e7, 0xc265a85935e478af, 0x9a4fc7bb564573e8,
+	 0x56940b2867860217, 0xe44a889139feb684, 0x9d0760daeae4bebe, 0x27f1c6de418d2454,
+	 0xc7911c08147205c8, 0x3b107a5a4e68ae55, 0x7d1aab9a6775c028, 0x1fbdf00e105db43e,
+	 0xc3d9a1025a161160, 0xe474e3e7667a2835, 0x80a7a1d1253084b2, 0x7b62fbb875e72a4a,
+	 0xbd0f8b0aca3900c4, 0xe0a21fa751b12005, 0x71ece05d28d6f3f1, 0x33850444e6e648a9,
+	 0x6402f680fadf8719, 0x5d44e4137995a350, 0xd04ab3fa22891eba, 0x5009bc4514f0599a,
+	 0x072a56d290c88f95, 0x69879dbe6bb661ab, 0xf8a7c5c19427d029, 0x43cf0f918296d9f7,
+	 0xb3677e99b51e0de5, 0x6bd2f2ba48228358, 0xdea936789cdeabdb, 0x464b8825b2dcc9e8,
+	 0xda9228ec5f94b13f, 0x6f8a86bce9cba30c, 0x73382176707894d5, 0x5ebadfa7a610a777,
+	},
+	{
+	 0xa352a2035f6eb2d8, 0x4cc81eb691304540, 0x2e349e45b09763b3, 0x584ffa6b0bc33b06,
+	 0x3f04cf6491a5e7dc, 0x962e22a0eadf9877, 0xa2607d0f16f6442a, 0x4691ee88a97d34fe,
+	 0x9babf89a78f29d49, 0x0405be5a0ddc9fa1, 0xe933465229766387, 0x8d56bfc110026556,
+	 0x8ae219fd994f4bc8, 0xdee3ba0fc778c5af, 0x02875c1fd16790dd, 0x085ed1b04b769675,
+	 0x60f8bd0c3ad98738, 0xc6f9453399138d5d, 0xd9f8f4158eac1ae3, 0x382cec3b0d7f2db2,
+	 0x6463feec3c8bdbab, 0x64dc842b9bcee33b, 0xa3e6c43761abbfe7, 0x85559a3d0b1f130e,
+	 0xca527cf183587ced, 0xf89c3824adc81a59, 0x9bd5d8fb8c02195c, 0xa19141e277c74cbc,
+	 0x2c731b1525ad3c11, 0xb670090152839463, 0x9501f0a64010993c, 0xad858308fdc04a95,
+	 0x9ab5ad2c84c90608, 0x005b56b6f001c97c, 0xf5e635ef468b2bfc, 0x93bf9dd1ef4daed4,
+	 0x9bbaff4a07723810, 0x7608427902a9748e, 0xbfcfc31e734e8559, 0xaa5880e4cd62244c,
+	 0xa226b8d5066c57a2, 0x287d6c59bdb34fbc, 0xedfb72eaad5ccd05, 0x531919fac2cfec58,
+	 0x34408ad4c5d97cae, 0xd2b634c76270819c, 0x3fe5cae8e024bd5b, 0x7cd7c4f49fa9eec3,
+	 0xa901e7db4233ea06, 0xdf0888f3180302dd, 0xe705185fafc9b823, 0x1e4d60528e321c54,
+	 0xdc421cae7efebc11, 0xb199871cda84405f, 0xbaa7815344c63186, 0x43cb37c1089103b7,
+	 0x833e2c4a516b82d8, 0x5d35108eab858b8d, 0x648890c1392c15ba, 0x483de8d2655971db,
+	 0xa601d706de5a5a78, 0x39a92541457b9272, 0xbe1a48a53ffeb703, 0x70518ffa8aaf2b83,
+	 0x9594376ce95116b8, 0x4125f98af1f0ec94, 0xc786b79f626a2f6d, 0x3b2b8acdfb4c1cb2,
+	 0xd1fc17f60873923d, 0x0e99a0bc744488b4, 0xc20cfa9c41f7239a, 0x12f66cf6d6fa1cfb,
+	 0xfb32cda35c9d3f57, 0x8f832ea1479c19db, 0x5249a65f46f5b3e7, 0xa96e38a6b91a10ba,
+	 0x9ac8a7bb4321cea1, 0x91d192c60723e43a, 0x2a63e538b3c14ddc, 0x753d6cd8f4a8d8f8,
+	 0x69efc58c2387b6a5, 0x8bc89a4de5a70117, 0x0566436ee466c2bd, 0x0e7b414859b26df6,
+	 0xbd8d78428b9d6748, 0x42adbaa4d143ab3f, 0x61a03b5e8889339a, 0x79e7cf50c778f787,
+	 0xec947be7f4c8818a, 0x98f7fdd4b36de1ab, 0x2a6b7c55509e8ae0, 0x9d6686c028cbffe0,
+	 0xa3bb116d8c1898a7, 0x73a5ef7a9be8358b, 0xcac70c555e81b587, 0x3560081a781253f4,
+	 0x2f5c2be7aefe8883, 0xd4c8a9b9757d80c6, 0x1de1020a352aa676, 0x4cdfd80945d6a72c,
+	 0x95d88f65b939af45, 0xa2114eb694d26b4b, 0x30017f3941af8f8c, 0x6ffa0c495c73498d,
+	 0xa7265fd19b1340e8, 0x3614383ab2448d71, 0x24e49fe7f568cf3b, 0x64df13219befdf6b,
+	 0xd21903c6f40e29e5, 0xa7f5d709e395d144, 0xff9b89c772c5ab5a, 0x031432f1154cbf4b,
+	 0x69349f9fa4c4dd7d, 0x98789f5745e00837, 0x65284e671dfd2236, 0x2750ece951481fec,
+	 0xcc827763772b8afc, 0xbf1f9f1001b9e4c1, 0xa5863070bc913571, 0x6d029e25eee2de58,
+	 0x91f47aa4df5cc2eb, 0x361b6f3d38a70c81, 0x32a013272b91d426, 0x7592f9a5afc1cdeb,
+	 0xabb0337beb6c19f5, 0x4a9f9fedbe248558, 0x3eb7db9ba5815b98, 0x4b13115376b774e8,
+	 0xe8c9d3f979a85ee2, 0x5c5efd01d6112592, 0x4988a68acb0cf0d4, 0xa5be5b1b2dcb6553,
+	 0x0d67cafae2bf47da, 0x90949ddcac64a64c, 0x2833d2a10a7f729f, 0x9e9ff7f4d43d62b7,
+	 0x903eeb1bff3ec8df, 0x521aad248221226e, 0xe11051b223e8c2f7, 0x80e6e0c4a7da5947,
+	 0x68d8ec89c3146882, 0x61e6953a8bd3ff03, 0x4aae78437c5801c2, 0x1e6d32b6b635e304,
+	 0x996975b7f888183c, 0x96939f6793054ba9, 0xb80e0b3517a6c44d, 0x01230476865c0502,
+	 0xb25b92437529b2e5, 0x559e04267fa084cf, 0x6f26afb9214e8337, 0x8d3f83b7ae560d1d,
+	 0xb324549ebdf559bf, 0x92a36a83e9d0b188, 0x11657131f4d93965, 0x0b9df1f20467e5c1,
+	 0xbb2cdeedff1e7baf, 0x462dcc71a3bc2518, 0x09d22d30f599811f, 0x42c4cad25cf8662a,
+	 0x43cb65adc6610a74, 0x0ff5796ca680a3cf, 0x9bccedb9c2b55a3a, 0xb3f560d1b05dd961,
+	 0xf98d7a69d95fee86, 0x4085de5de9b40cde, 0xea9f814f74c025a5, 0x92108c8c4d4f7668,
+	 0xd82bc23855e449eb, 0x57d41c55952a8239, 0x2d85801dffa3f85a, 0x510899657d82a7d0,
+	 0x591418efb675b3b9, 0xc8fcd49aa3fa3c6c, 0xda189d071cfffdae, 0x401feb7c07165504,
+	 0x63928b0335fd809e, 0x4a7efd5f0d24614a, 0x8b96e06536d1ccc4, 0x6b8cde068fd2d4eb,
+	 0x5d0e6d1c9e02ffd6, 0x4d2661eebaadb183, 0xff53bb0600d8c43e, 0x13e5e14ceb290b64,
+	 0xcc548b8838555ec3, 0x80880983962c5701, 0xaa6e16ad05c990bd, 0x0d482e5540e9b5c7,
+	 0x5520b02456b7f70c, 0x183214229fad6c78, 0xdbce9b3db8a63377, 0x8a17ff78c91f9038,
+	 0xb136b5c493f53b1e, 0xb6b35c65dd8c8e98, 0xaaaefb3579ffe177, 0x50a4a24b20c2ead9,
+	 0xc06fb131a9a9fdd9, 0xe2147fd4f7880a2d, 0x624c67df9397b57f, 0x196b253709d3fad4,
+	 0x2a34d01db8ceb29b, 0x17dd3cb2a801c483, 0xc3f4dca77fa7fb2d, 0x38b631bf40d16324,
+	 0x7d2b5ec3c753778d, 0xc7a28e6622d10f9f, 0xe03f04ebd41aee10, 0x70f5107b30088734,
+	 0x9ea21e7b7bdaba9f, 0x1713300ff2769a2d, 0x979ffb272fd03016, 0x7611b93a323c52a2,
+	 0x28c9d8497865b044, 0x8d80554214c258ba, 0xc095d379f5eba58b, 0x4c2a0b68265e3c0e,
+	 0x588ade255de2ab34, 0xba3783dd2959696a, 0xb81690ca3269769c, 0x20473a3a9bda049c,
+	 0x4140fbb9cceecdb6, 0x2372c72eaa5fde3c, 0x5edbfa169f83a2fc, 0x2db6a7dac62ca306,
+	 0x354c87fd48e11d1d, 0xd312ad137a442d28, 0x3d27198f15034871, 0xa8bc2dc0cddd2a97,
+	 0xb786eb801884276a, 0x42b357cd7099eb5f, 0x29f6c1d2a792a962, 0x62565950f12e7a02,
+	 0x07d74cab642857db, 0x453473c66a05f3f3, 0x8fe9b42486fec2b3, 0x6e6b4f78a5b6d1d2,
+	 0xbb3f84a99ea9aac9, 0x49dc92009ed7f248, 0x911963447ca248c0, 0x2d411b9bc2631217,
+	 0x2b2bb73e6ecd0bb4, 0xbff9ac46753ac211, 0x0aeeaddaa2b9a17e, 0x99bf0f7fb462d1a5,
+	 0xdf0c9a03ec4f89cb, 0x46cfecad3f45d7b9, 0xa5cbe673ee3df64e, 0x9cc0e6c2b7d5e070,
+	 0x8f9ac3b8ef5cd36d, 0x879939db43b4a1cd, 0x8e0512db84e0dc01, 0x42cdd77694f3fd69,
+	 0x3f61d22400395aaa, 0x572e5db698c31bcf, 0xef3797b966cf7ca1, 0xafe3567eb7b214d5,
+	 0x51d3f94639838320, 0xe2a0efe2c962a5cd, 0x4e022ad3215ca84e, 0x98baa240971a597f,
+	 0x2fa546b719cb85a4, 0xd094b59eef998ee6, 0x968bb9d8946403ed, 0x506d8f73978f9f3b,
+	 0x988ff2de728922a6, 0x65101d4176da7407, 0xf03fa9d15dcb2e05, 0x1c2d032dbbc5ee86,
+	 0x1ed37b8914e2f951, 0x238a7277d88e108f, 0xed2b9183df1b2611, 0x6fba337b1e9d5b93,
+	 0x49d6831b9087e378, 0x5af4bcfb29df69bd, 0x76c8903317f070b8, 0x779180a084dc6eb7,
+	 0xd301fe6ea4a4b011, 0x9dd3dc49a8f822d9, 0xff6eb3467beb183c, 0x0705fd47c0a7fb5e,
+	 0x777f7fd05984ae98, 0xe33b99477621d958, 0x2d7f69588fd800a3, 0x8066675c12333f8b,
+	 0x80df1dcd45c22ad3, 0xd56e3c9ce81f4260, 0xbd02d2c344483d06, 0x73b9bdce2d80c536,
+	 0x291711631e18636e, 0x30450a9b4224c901, 0xced2272267ad59c7, 0x006a01a2f6f73176,
+	 0x6ff204d5741a8e9d, 0x1ae346dd77633066, 0x71d99d73e6236ee0, 0x787578849c673212,
+	 0xd037e02d24aee299, 0x52932e5aa4ac1cc3, 0x5dcac7d1863279d2, 0x541a603d69f8cd1a,
+	 0xff5ad3084a73638a, 0xaf4716764b5d3eff, 0xa23bc04b64e89f21, 0x43aaf3549fd173a6,
+	 0x81e50e79544304b1, 0xa85cc10dc7d95b5b, 0x2f4ebf9a696b60db, 0x4b735bd284bd803f,
+	 0xbd8f578f27900d0a, 0x0621ffad4e723959, 0xd38bddb108001da3, 0x5994cfa6a44243d7,
+	 0x210227d57e93896c, 0x1908d15c335c0bcd, 0x8be4d06afb8c8f2b, 0x0b3af0ab51c86838,
+	 0x25cc65683e2548e0, 0x7fb4f528daf83b8b, 0x1a59c9e3f7e5b323, 0x0eb1776abe0e9265,
+	 0x392fec32369152b3, 0x75d29cc6d3899439, 0x16f5ce3c1f681c11, 0x3b35961479954bed,
+	 0x894da0cfc3ca014a, 0xf8d35d924ed84ab6, 0x9ff12541509ade4b, 0x9e4d8be6af1963fd,
+	 0x35bb9b1d9527ac46, 0x999d8391753031e1, 0x7cdf84375d4de35b, 0x6b538fcfb95b4daa,
+	 0xb521fa5d1e0fb470, 0xf4a1c55902a8f346, 0x355d68a89fb4d712, 0x47d9dd41a0e4917c,
+	 0xd19213ca0f0dbf48, 0x5077b33b75c53d38, 0xea23bd207c55076b, 0x59e588c9f70054f6,
+	 0xb1e0d6730b846255, 0xb6434398e1054019, 0x4b2308cc2992ea74, 0xb00426b653ed032c,
+	 0x5fb7692fd5809a32, 0x1f629beebd9e492d, 0xd40261be5b0cb2dd, 0x7b088ee56d7c09ec,
+	 0xa80be009f475be23, 0xdd828d57bbc8cda8, 0x8671670e4182e178, 0x1962d5ad5d1d7900,
+	 0x66bc6dae0b2b9480, 0xf7542382df526537, 0xed37a143b571efa9, 0x282874c0bf347db6,
+	 0xb23b3876dfed75e4, 0xdbb0d27fa337c8c0, 0xc92f424f60791a44, 0x0319522849094c6f,
+	 0x925bc3458e091a41, 0xa7581e83a61324b8, 0x85859219cd0c17a3, 0x2b3ec95e100f973e,
+	 0x45a90bf99b979dbd, 0x03a3ab053785af98, 0x1631575d347b10ba, 0x8ce3de51a48ccfe4,
+	 0x6ecfa294ea9ef61d, 0xc39adafb13768983, 0x53747bdd5b27fcae, 0x62a57079257573e1,
+	 0x721a61db4ee90e77, 0xbde365eddc55ac23, 0x5e1f244df80b15ee, 0x21bcf0eb3277db02,
+	 0xf10d7c8a58fd02ee, 0xb796b492698c2c04, 0xb96a2e5f98d651cf, 0x68846ba03c9bda84,
+	 0xd88b383a1fdb89e4, 0x48c91d40b4f90cbe, 0x2f6244e016836ec0, 0x3abe6f8d5c0f8502,
+	 0x5d30821568090d8c, 0xe6c2173e94b2af51, 0x5747509f9d1fde8e, 0x6b79f230e2ab8269,
+	 0x57e9e625a857511a, 0x68b07e844fa8b0fd, 0x45c2274114f20e88, 0x9c71b987cfb38a00,
+	 0x9e22e4058e0fd646, 0xcd2c26237262c351, 0xf2906ab543dfa057, 0x2878427148941c4a,
+	 0x65f47df11cb8a566, 0x23e7ea1fb25e8f29, 0x13b9900073450621, 0x74c98e9823f1cf16,
+	 0x0c8f2e6e99da5bb5, 0xfa72f47a87ea0c6c, 0x4e0dfa6c4f662865, 0x6ca3dd7e05f4aa75,
+	 0x99e50f9ca92c881e, 0xd0d3872b955f232c, 0x2ccfda45c05043db, 0xaaf2421ad25a094e,
+	 0x13aacdf36bd05077, 0x096493ef10aa69f5, 0xd59fc068d32c8e13, 0x6df78a28821e89aa,
+	 0x118b318c1c2a4e87, 0x2469297236bead3a, 0x9c7948c70642055c, 0x94a1dd13ebbf0b2c,
+	 0x3d72ff280f3ac532, 0xaddcdb09754fca27, 0xc11a891403affdcd, 0xb01b1031217594e0,
+	 0x42dc5f84da130ada, 0x3ea47a29a8fdad88, 0xad1ac26666c5eb88, 0x7dc9d029eb63e63b,
+	 0xc47e46a4846552ff, 0x730980f12df15292, 0xb4c5c44195e9e7ea, 0x6979ebf84f8a5385,
+	 0x6d8d68b76960dce0, 0x6d69c6f280736631, 0x0fbacfd3501b1a89, 0xaca0d0df5ab05304,
+	 0xf65d458b6e95c685, 0xa67511ede0187649, 0x206ec4d323798da6, 0x2d2b09d03a8deb54,
+	 0xb0d6d6d3cd83fb4a, 0x0098dd99a5323d05, 0xb7d1f6170f0e5d49, 0xa7930d4dcfff4505,
+	 0x006608fb5938f540, 0x6ccb9ce707000fb9, 0xdd624614ff2bbb4b, 0x96d958306da32dc6,
+	 0x4eaed7b61c7f0cae, 0x620678a765fee832, 0x3c6c3ea23ebb80bb, 0x241de5f30a070601,
+	 0x3a28946bb4e373eb, 0xc359370f65f1502a, 0xe32ae1fb9d364d30, 0x89f46278b80941b9,
+	 0x607f9daeb9076b4b, 0x9ea31b68784af58b, 0x3028375e3259d06e, 0x44986899ae07b958,
+	 0x287f99f0951e2653, 0xdde365d87c8e7bc1, 0xbdb9f66c25a2d404, 0x1d9cc9d537b3fe09,
+	 0xbe4178eadc5106d3, 0xa88de0807299b441, 0xa185f7ee9e6c5918, 0x43df3c59c6b9dae7,
+	 0x52e80ee5135b17d8, 0xe97290734060edac, 0x2110971e1710b5c9, 0x5845de64aa309b97,
+	 0xdd9ff011a53ff5ff, 0xd4770b8d6f276e73, 0x549a1830a0f92e51, 0xa18725e659e32b96,
+	 0x9c6a67cccb03d97e, 0x38ef16e6690530f0, 0xbc52bc9931ed43b9, 0xacf77dc807b4bd1a,
+	 0x97e7d62b1177d8b2, 0x4ecde7667677d484, 0x95b1423f4196be09, 0x58f8ef6e99985524,
+	 0xd22c31b09109f121, 0xcda914b85781cf02, 0x065b49b205c91cfa, 0x2b2291615d282bf3,
+	 0x8ba66ef1e1af8438, 0x00f29b31f89bf734, 0x12178df5c599a2c5, 0x2a53f16e95eca2d4,
+	 0x7bc023a1ee97df86, 0x6c316ed3091abd72, 0x4dd140044994c152, 0xa86745457302db0e,
+	 0x15fecbd4317afd64, 0x20a0b3b446fff637, 0xb4a3e710ff986eff, 0x05499f88838fc8bd,
+	 0xa42089c66972378a, 0x49863cbbd4a850a2, 0x5acf085ac761c3e4, 0x6b854e0ce4fb67fc,
+	 0x8dc73e0402dd703d, 0x2dea32f42b2d2184, 0x07027e7ebf22db3d, 0x0bef3a2b7b7d3cea,
+	 0x79e2db85302d745e, 0x9fb979ce233b3541, 0x158b1dec9d82e1f0, 0x8ef194fb32910c4f,
+	 0xa47ebb9b382537fb, 0x9c1edba9a0596e55, 0x8ced5992c762ee44, 0x82ba77351a6ce75d,
+	 0xb0a6352ae4ed98a8, 0xa78eab31a288a47a, 0xe2a9bd8dc2a14b5d, 0x098ebe4192a03a9b,
+	 0x391f652a8d44e195, 0x7aef847230934ad2, 0x193ee95cf6d52f67, 0x5b0f44bfa4129586,
+	 0x9d0742d37ae89700, 0xc39c81e70f52d7b6, 0x43cdaacef8332f0b, 0x6ee8305f2d0d3c87,
+	 0x11c08385211d415c, 0x153000663bc6fd45, 0x5cbdcc77c701024e, 0x84d927339fbed15a,
+	 0x2e6f274ba7e57c90, 0xf5b9817429b69a97, 0xb00484d210bde850, 0x37b7207db3beec16,
+	 0xb110960ff365dc00, 0xd18d12cfb4cb7a18, 0x78b1f9199ff55a4b, 0x8af4bb098a87e5f7,
+	 0x3aaa0d1a8ea4f2fd, 0x6c3a15385f18ef63, 0x9c033f75d9513a28, 0x9ab7b6e157ff3a3f,
+	 0xbd103fdc3a7b5736, 0xdb43f8412eeb2fed, 0x299c28e603c25d3e, 0xb4149ac1ce9dfad3,
+	 0x396ab18469df5c09, 0x5ccf145db91c28ac, 0x04658b9abba1d0c0, 0x6a3e03e49300cee4,
+	 0x4cfcc8a37e82cab1, 0xebaf5470a8d273fd, 0x6ed7578c33cb867c, 0xad8c619bd1271ce5,
+	 0x102db6834af2497b, 0x04d86e61027e2a9e, 0xec20259229d90cf5, 0x39b713b14eec8f32,
+	 0x2a3f11e221391bbe, 0xc5f6721299e9c04e, 0xc88abed1fa1246ca, 0x8913197a2897b45e,
+	 0xd79ba27c9dadc7e5, 0xf1c59c9fca05abf7, 0x829c8020fbb52298, 0x3f2e69a2f645b2a1,
+	 0x2e1597f91128814b, 0xb58f9548b48eec04, 0x1eeb0c57a6f29517, 0x3b3a5a4f61a6790f,
+	 0x165e59ab9ba69f56, 0x13aad0370c355459, 0x93de85a0c3f79af0, 0xaf562eb49b962b0c,
+	 0x3087ea24597b259f, 0x0ea820140f23d3c7, 0x6372c6c3a549c0ae, 0x6b364357ec05ebd2,
+	 0x376170d1a65c7bdf, 0x3e782735cb00fa10, 0xda2787812e065dd0, 0x40c755d637beb0b7,
+	 0x58c0b01461fe7ecf, 0x21c073872147cabb, 0xfb3b0804b16a2c68, 0x043c418f0774a2aa,
+	 0xde160a16499a4cb3, 0x344233c30549dfe8, 0x5c7c251bf90fe92f, 0x28be0748f032295e,
+	 0x39826437a82dce56, 0x2d384239f4699a05, 0xa82c8b1c364ccc2d, 0x8f762596f9e49ad9,
+	 0xacfcf18d91a181aa, 0x37d1042c45ba56f3, 0xb21264f59f7122aa, 0x31d13d128ef86f6d,
+	 0x4f572cf0f20530e2, 0xcbfbeb70cead28d5, 0x14beda1bef0df105, 0xa5858462c361d787,
+	 0xb0a8a433970c4d0f, 0xf22a188ae1c65aa6, 0x8d958ddc9a318ed4, 0x50cde473a073afd7,
+	 0xe2619721e51db98c, 0xa0ed5c13a501dc29, 0xd46787b57afeb0e6, 0x837fa2227c163107,
+	 0x5542fef0b00f2e92, 0x6b4c0e672b71ea51, 0x4b5d40dd6299138a, 0xb45b9e40da93143e,
+	 0x8000d677be6662a0, 0x4accb90c2edeab55, 0x570dc065436f97d9, 0x6673efc9381196c3,
+	 0xd550b1bae1c8c070, 0xf975304954220af8, 0x3330a8e5d4e67153, 0x4a54dfddd561f77a,
+	 0x3ea5e11362c47cf9, 0xdd3cff85b019e7b6, 0xf6f7a199daf1d29e, 0x02130a4aa2c5ed36,
+	 0xfa4b90c388a1006b, 0x17137f6e7f69cce4, 0xb974562eefb5c993, 0x9e6180e646e6e268,
+	 0x3b4dbe4d8d05afd8, 0x133e6979705e52d4, 0x07c95cafa46ab6df, 0x3ac1dabb19f5f92a,
+	 0xdf5828f5ced6e22c, 0x5b02ebf1655e3c50, 0xed4c635b7e79bb74, 0x15f82833b9486809,
+	 0x3724c14a00b6526a, 0xac835a793abbd848, 0xf6f62b39313353df, 0x7425069963496e3e,
+	 0xcbe226c00fdaed2b, 0x1c86970b26498bd8, 0x33bf721908d74632, 0x4b03cd44fa4bf1fd,
+	 0xda86e9a1317d9f02, 0xc65d1a5468dc5f3a, 0x9021fc8233f51d74, 0x059c26dcd968f42f,
+	 0x190a0604975ab5b3, 0x997f4f71487b80bb, 0x27d35394a6738ac7, 0x1527346abdf66b4c,
+	 0x446a7cb88957647c, 0x0213e00cf6843260, 0x57876bb09f4b841b, 0x1a0caa98990be925,
+	 0x803f9cc07e149b16, 0x2fa23a3177b9f767, 0x04af38ac16cba0f6, 0x99c4c8ba0c46a79e,
+	 0x0fb6ad70b1cc9c1d, 0x192b18e8cf0b9c27, 0xbc7f623655ff3c5c, 0x80a2aab8ed867242,
+	 0x34ee08d9c9b443b6, 0x52275ac7846564b7, 0xb2f4b7feb8ff595a, 0x6c5ea2444ff43ae7,
+	 0x5199d72c2cd0e1ee, 0x802ebb072ab203d7, 0x934cc13885494630, 0xaaa632c8f7b5771a,
+	 0xe0bf887c1fe69149, 0x7d56b33a6735e3da, 0xa3e8e736b46cde4a, 0x59bc1119f3487305,
+	 0xbf647b5474b38f5e, 0xadb5fed1f6f6535d, 0xae97df8e29692939, 0xab764aee54dc5fe9,
+	 0xf6390936fdd96584, 0x839b8672823d6a74, 0xed9bb48d14d502d7, 0xa5fdcb8a0c185597,
+	 0x8f1aa37a81ec974d, 0x54bbf0c8e72e3690, 0xb86d1d125d89effc, 0x344c83003f597329,
+	 0x073208078b9ce8fa, 0xc43dca0c817d2aef, 0xa19364a1c24b6aba, 0x98a251e6a0edb6c4,
+	 0x928c38a588617b53, 0x4288c00a39fd1689, 0x050cde51bbe2d77c, 0xb00257919d57ade7,
+	 0xe73bea14b956f068, 0x997182e2fa3d34a6, 0xcfb8aedc881c1e6a, 0x97655912394ab99f,
+	 0x1bcdc9cc202be895, 0xa9251f193e35acc1, 0xb0f068422e08b321, 0x7aa785c109f93dcc,
+	 0x797806ad64ea5838, 0x9dc97fcf21dcad5a, 0x4800ea39297d5844, 0x858076f3321f0997,
+	 0x67cc8c01ab8bb086, 0x63485946e6835821, 0x8ca8d5e623a4b7d0, 0x9f821b66fe2800bd,
+	 0xec07b72dbeb25f68, 0x769e93e3564db3b5, 0x2a685f87ee4a643d, 0x555c77f58f5b0e7a,
+	 0xec977fde96f75c47, 0x80a8a937116d407e, 0xae6ee0436ab803d6, 0x7976946426119dc1,
+	 0x69ad092e60f6c125, 0x5156131f89372939, 0x8a90c5fdb6c23ddd, 0x9e6eb71329cc48bb,
+	 0x10d5854d8e59ce76, 0xf8c41fdf2e50f3de, 0x1159ae321c81c890, 0x0f03a6d3b3585a9d,
+	 0xfc7f1a97059400a5, 0xf51c9204a4e8fc90, 0x04fbd51defe0e02e, 0x7cc14e91d3ec1add,
+	 0xc84be793794957c1, 0x14c6a052095dba04, 0xcb6939e664a7c9e6, 0x65cfbb20a728ec4d,
+	 0x0fc1f0298e23ef91, 0xbf622337427ccf52, 0x5a3c1a4255a4d2ef, 0x5a4d6a86a320c12a,
+	 0x1c159284db3796e0, 0x5c2be29684fa9448, 0x969d71a5d6050a1d, 0xb12d1573955b75d4,
+	 0x28709118c46dc9d1, 0x83db42568b74bde0, 0x710bf734048022fb, 0x011981d08ae87fa8,
+	 0xa1eb86d5fbba8c3f, 0x70e5f6520338ce8c, 0x4f5e53bdb9627c62, 0x34413c364b85ae8d,
+	 0x265942f107137a53, 0x6125eb70dfef8fc4, 0x13b06a04bf9c734c, 0x7ab89e073ac282df,
+	 0x1bc03ddab10dd79f, 0xe4f838aa984d74d1, 0x1544068e56afc331, 0x57763d0fdda55c12,
+	 0x7df8e28133f739e5, 0x0676ea89530d266e, 0xb463e70999c9fdc7, 0x89f3c76756fb3323,
+	 0xefcc6903001e0031, 0xa772b316165c114a, 0x17b9cec686e8a85c, 0x3b6dbb6ceaf68ae2,
+	 0x671837dfede6834f, 0x2ac255c4fda7550c, 0xe58f9e2812e00174, 0x0602cf70264a0d7a,
+	 0x3d43676e948167be, 0x230cf0f24ea58f5c, 0xba0e71140031bf45, 0x8ee88f9d6d4a1071,
+	 0xe552c0d455222e2c, 0x5f5287a762ced61f, 0x3ee0d20b30f338d8, 0x07f534e50558ff6b,
+	 0x142293cddff42967, 0x5801229cceb84582, 0x6eb2963d9cfd0cb4, 0x0c32a4deb424ca39,
+	 0xd4fda086632fa94b, 0x169f7b968803f64d, 0xb2dc7a30a3c6ad3e, 0xa451d84377618305,
+	 0x5ab30da8d957fee8, 0x8594fab310a385c0, 0x2ce52984fc6da71f, 0x85e05c93cc81e322,
+	 0x55c6b859f4e96827, 0x48a7e2325adf9a86, 0x49fa2b8203d6d2d5, 0x01d78c8dbb2e7ccf,
+	 0x363be674c03a9ecd, 0x8655146fa8c0382e, 0x40825187f73e1a03, 0x635893642bdaf42d,
+	 0x7296cf7d08c27875, 0xfaaf77cef95238e4, 0xb71ab86966528877, 0x3d5fcb213a662599,
+	 0x0530f70b71f855f9, 0xd2042c55b7abaab3, 0x5f524b2854d888b3, 0x7bda2dbfcd53cfc9,
+	 0x22dd68e09fd6919b, 0xbeb7bdbfd0f286af, 0x0f2494888584efff, 0x56d04a26a53a27d5,
+	 0xa99ae89dde017122, 0xe1adcd8d9c1685f5, 0x741c33e2e592ac9c, 0x19b9b9f5c671b85c,
+	 0xf09f39f446c44932, 0x559fff9bb2ef101f, 0x88604824222c9e1a, 0x3bc7225bf5102f78,
+	 0xcb63b5dfa21bc522, 0xde7db26c11517dbc, 0x4f91eb5e9bbbfbc9, 0x894914c1d1b9fa89,
+	 0xe01395319f3d6660, 0x63106f00cc7349d7, 0xec076ab15998dbb4, 0xa2249faebabc9a06,
+	 0xd5eb58bd803e29c4, 0x8e59536b1751764d, 0xa64e6c793540e2dd, 0x0ac8f828a3ae5914,
+	 0xadd74696ba812d79, 0x0d45d8962f3f124f, 0x45de8fc93702b60d, 0xa69b3ed218e0f5b2,
+	 0x6727c9b9e1e57dd0, 0xe4aa0b8a59135a76, 0x55390008a6a22cc7, 0x016bcbaac5da09bd,
+	 0x6c48ac4dff0e9995, 0xc5983e0dc2985fcd, 0xc7a7f5eaf190608c, 0x5bf2fb77fe5d8fa5,
+	 0x5f853847f0042816, 0x16b2b6d5cfe8fb91, 0xf12106f1b544593d, 0xa41f14c85ec147bd,
+	 0xb363feb537623ba2, 0xdb1e430ed75bc3a5, 0x1918722936c5f813, 0x594e3bbcea65be09,
+	 0xed278ae4ecfc2064, 0x14e6c63101458a43, 0xceeb0962da2af5f6, 0x672444fb9398ca04,
+	 0xa1a67702bf424e72, 0x0257089d6cacf778, 0x582f73b236b088d4, 0x322fc8a3fea5853b,
+	 0x06252266b0069238, 0x0ba5d39128e11e85, 0x61e8dfc3ca020a2e, 0x55963f86e6044174,
+	 0xd93b09ee8facf9b4, 0xe889e54ae71a8ff5, 0xf5b9334b152fe5b7, 0x74a8637137d78c7a,
+	 0x0a773af6b0b1d726, 0x503479fbfb75a2ed, 0x38a620db7944f26f, 0x3ec5b50cb3aaf587,
+	 0xf8037bc316cfe321, 0x768afa419490379d, 0xab6470ed5f3f0189, 0x45395c44fa088e10,
+	 0x4303b035a545ef4a, 0x2931b9267d719116, 0x9305bec83cd8e9af, 0x99266a24fdd8feb6,
+	 0x4d603a43d146bfdb, 0x7c49dbd3c232270c, 0x67c73b0f81b978c1, 0x3a5e462f192da08d,
+	 0xa1acd65cc3c6e9c9, 0x94a8e462cc3a30fe, 0xc77d56367bff8465, 0x4ceaa020ae6eab78,
+	 0x4ab9f511dd64e385, 0xa415636fffb01e20, 0x10ec3b16ef1cb76b, 0x8014d60904b07c66,
+	 0xd8a47e24f14580f5, 0xdb85bf5590d6fa7c, 0xe9e3f6f3f2f97c1f, 0x6afbffcdadc728f6,
+	 0x08af1b971727d66f, 0xbf15bc7a4a59bac0, 0x207fd7840de8b7d1, 0x6e944ef575658629,
+	 0x75a465468b05babb, 0x722b6ba62ca683c5, 0x1c69cb7dc5054c28, 0x8d9d76434e58d160,
+	 0x4d3f603132dc09dc, 0xde87509c4e51ab81, 0x6a384e7c95b071c4, 0x6b168e0c07e4a456,
+	 0x5fbc457ed74efcd6, 0x656c414ffd9e3dfc, 0x31e2994377938bfd, 0x30fc89beae109ccc,
+	 0x81bb7ad4928bbe94, 0xb71d4dcbe3157707, 0xb3cdda9f26f44c03, 0x2c4a92d1f7eef789,
+	 0xf9010ef171065866, 0x94ee74903cbf152a, 0x74b26aaefceadb26, 0x71379825d6572f3d,
+	 0x9d03b08cd8566d43, 0x6f885082f4eb52da, 0x2319afadf1c90610, 0x66f288c1f97b7416,
+	 0xf4826cd3d4882da2, 0x79d6c6e16868fce0, 0x0e4b1d00c77750c5, 0x9c1d0a6b0c13b938,
+	 0x0e05f6babfb06ebd, 0xaca093521e6fdda4, 0x1053730fada2d551, 0x738603e7074ad5a6,
+	 0x70607eb5d7e54206, 0xbe9c5bf2aa06af41, 0x46f21ce0facb48c9, 0x9f925cdb3234edb6,
+	 0xc4cc06dea8a767bd, 0xf2d9cd12ddcba0ed, 0xfbad54bba2af5a2e, 0x2ff2ca726902db81,
+	 0xeb8f063843295903, 0x2c35c78a61d21abf, 0x57e723dd9164ec43, 0x58b5acf99eaadfa8,
+	 0x383eceb44d70d5e4, 0x47f18a2d16c08146, 0x0f359da7bbce116f, 0x943e3345c4a7c205,
+	 0xab53cb84b0e45e80, 0xcf1c23c7f7b21696, 0xa97bcd552b84833e, 0x59b79ca2100fbef7,
+	 0x540d1adfa2737e44, 0x216bb5622320619d, 0xf992e722ad26ef1b, 0xb3c4ce4faaab8866,
+	 0x603b370bcaedea46, 0x8ddb62cefa608961, 0xff24848832b9c1a6, 0x6407da5779bd6982,
+	 0xeb1cddd26b4f313a, 0x5b7c6a2c04dddd48, 0xa610f61d2defaee0, 0x6100cc25dba7b8db,
+	 0xf4446fea2284ddb4, 0x6e7204458d6a2790, 0x0d675daed8a8e376, 0x71442eb246edf256,
+	 0xcd82514651200062, 0xc41ce6890b0bdb37, 0x8d6f28b4859b7db0, 0xafe389a671297045,
+	 0x318cdb6c8abbda5b, 0x5ed5e56bd7030a8f, 0x62054e8e7a267d26, 0x5d43834d15b3942c,
+	 0xc2dfa98f6f90cc5b, 0xadb46e6cd70bf816, 0x82540ebc1543f579, 0xac38789e8ad7cbab,
+	 0x312559e33d5060fa, 0x6128f4ec18684d36, 0x945dc0b8abcf8e80, 0xa898f76d6032c02e,
+	 0x1aded8f2af18a8df, 0x9386f25dba5bebc6, 0x90e7e4f76a990e82, 0x2716619c771663bb,
+	 0x90e1d1124c1f4e09, 0x31c4f276e754d710, 0xfdf2bb22cff8797e, 0x42ebe6ad1e49a0d0,
+	 0x585fb9e26050ef99, 0x82cb19d76cadfdad, 0xd51aa8de9f5c652b, 0x1479aa616ef53850,
+	 0xd619c83bf3025ecb, 0x4cadd263195812f5, 0x7b2c56c08bb97f19, 0x05722a545c7796c2,
+	 0x9eed9b82a1e83229, 0x2e6d1dc8ad167b7b, 0x74a8252acc050e93, 0x88377e1e89d2dd03,
+	 0x238d61f7c52e9b11, 0x84765dd9b5fef61b, 0xa985c8cdfd20701c, 0x4dd2094e1ee92d20,
+	 0xad2fefc25993cb3f, 0x886c63ba55d95e7a, 0x61d5516ba476937f, 0x2a8950ac9b6258cc,
+	 0x4f2a1371bfd4d895, 0xed05a03f688d7a46, 0x4b0510e7cc50f258, 0xa9693dff92f8fb5c,
+	 0x6481efb748b57f42, 0x1e4ac37e4fefb952, 0x90d1a2291ee96cc3, 0x0be8dfaf0cd8bdf5,
+	 0x123d21b9977d3705, 0x82cfcfb917595a53, 0x8da65bbf8227e387, 0x3a0b27d8a041ec07,
+	},
+	{
+	 0x8bda1d70f821097b, 0xf5ca8af2860850c8, 0xe572e515a2a345e9, 0x070ac9b308c0b0c4,
+	 0x2dc34d2791a91368, 0x1a9e274f1dcc02c8, 0xd7af846d08553330, 0x2cd5016b4031777d,
+	 0x0c7d668edddd4869, 0xc31fbdc695023de2, 0x08f46ab8affd8889, 0x5177ffdf14dffafe,
+	 0xa473fe3862f952cb, 0x25a2ab452cf274b8, 0xd9d593ddce68177b, 0x8aebc300460861d7,
+	 0x35392da3b4a3651f, 0x322a18d124b52ed4, 0xd47f22b27d32e0a8, 0xa73b534d83fe89ed,
+	 0xa7b1603c2ddf9f9e, 0xdb3a1e649d1b619d, 0x7679ffa1ff036278, 0x8456ad0555d7a5c2,
+	 0x6f1094531105c1c2, 0xf78e65bc3fb2ef89, 0xd51f51c1fe2da1da, 0x51986ca3515aaf08,
+	 0x44a13c6bce2ffde2, 0xfbd7ddf51dde3da2, 0xc0f00ca5ad69d006, 0x88a7f9ffcfd43142,
+	 0xa0028cf13693c3a9, 0x26730235d4e965f8, 0x16051b0132261388, 0x1b256348f3b4a106,
+	 0xae10105658752ace, 0x2cdad1162a6f1d3c, 0x9de77235f9ae7a47, 0x2c0ad6dfb6c80d7c,
+	 0xeb3966564fe05b22, 0xa2a007baab63d92b, 0x63b29c3bd2de0513, 0x2ad74f55f508749d,
+	 0x38ff6c3e669dcb4b, 0x1f00b46923a3c1f0, 0x7e22f62ed78274f2, 0x4b00c9dc413dd1bc,
+	 0x638dc1d69e55972a, 0xe1ecac510f19a772, 0x8972299fb1065f4d, 0xad68d6bb57b170d6,
+	 0x959885c4e6df4683, 0xc016b65fba9859e7, 0xd1aa3657323067e4, 0x1b0133642d9e99e5,
+	 0x1e03448e0982b29b, 0xc0f2c6060676607b, 0x40c432bbfbe30131, 0x78a4a92db7d97096,
+	 0x7f4b6c7cf8d9cb37, 0xf7c12bebc27727d7, 0xcf15c694ecb92121, 0x441db7a17bde7576,
+	 0xf0ccf9129e11849d, 0x96c8053ed8e5d008, 0x7951b40e1a309d13, 0xa2e873412940b8bd,
+	 0x2436d6a71fca83d3, 0xae4e4f438af46647, 0xcc82e2d742ce3d44, 0x77b77ccf38d81a4f,
+	 0x5ad60659469d7399, 0x9e0f51b9e5333521, 0xb7fc5fc9ece06b45, 0x8480eeba2266e2c0,
+	 0xd6431b728598387e, 0x4ef2ed9e095b7d12, 0x7b658d1aee1aad44, 0x6dff5b921e9b82f0,
+	 0x3c73aed0a0fbe24d, 0x3d1afe33507b4911, 0x8953871068d5e11f, 0x9e81ad74e2c973bb,
+	 0xa2e7ea9336236a9b, 0x5948f9240f2879a5, 0xcf6b3a916ad1205b, 0x678ed3a90cf81f73,
+	 0x83e38bb06ea17f1a, 0x1443240787470c38, 0x8a1fedf8c3e8a5b4, 0x11b0d5982baec44a,
+	 0xe36f227e44fc66e1, 0x56f1eff2d1c183c6, 0x6a73f553e68e0636, 0x25d013626247e98f,
+	 0xa0cf2f481f3d4677, 0xb4ae409d94208366, 0xcfbe07cdb6643d0b, 0x82d43cbd3ecf28ec,
+	 0x97bed8df7db03bdd, 0x4f5c5028ea024c34, 0x948e1aa24bbea7b8, 0x4d585aa8704dfa9d,
+	 0xfeafab0082e975d1, 0x8780652c070b7c7e, 0x1755dd31fbdf482a, 0x348e5374b39aa1f3,
+	 0x1dcc7d09618aafe9, 0x0fdd60f5f0d4fa5f, 0xba02138abfb5762d, 0x2c91d550de8b0159,
+	 0x9e67324c759f4266, 0x4a4ab5d17b1857f4, 0xb3cd934df517307a, 0x57df5c597fb289a9,
+	 0xd453f6334c1dead2, 0x8647938a5d480286, 0xe895c2dba462a21b, 0x4fa739c3d7350cfd,
+	 0xb8895fdbd8393875, 0x1feba5ed6477e568, 0xc5e94ac8a7939991, 0x99073ac5f5291ab2,
+	 0x7a68ac6d00149212, 0xc1471e4e403014c8, 0x0c7bc51bbf3a3ecb, 0x21b8dff28b046f32,
+	 0xe91611fbb72edaed, 0x4883fec163b56a0b, 0x6e2a2f95b82e63f1, 0x5fd7c0c760cf3b2e,
+	 0xadfb3587bbcccb91, 0x42dc0bea449e4f1f, 0x6fb37537cf20f3d5, 0x54382743e7b1e099,
+	 0x3054a80e4f0e145e, 0x53a55b250fa16a0b, 0xd917326a2e553924, 0xaca12eea79625371,
+	 0xd5bd6b6b51405468, 0x3f230c1aa4135238, 0x1cfe7836fdeb9306, 0x6c8a07cae66d40e8,
+	 0x129ff02d9ebc93b2, 0xea18e330aaafaa6d, 0xf9ed37eb6905ae52, 0x96e5ae56358c8972,
+	 0x7c52cda7cc738d72, 0xd69ba12eb61833bb, 0x33781fdc9f1a8436, 0x34e596ba6e2b3103,
+	 0x7fad5cedf8221afa, 0x0687fe2f42ca529c, 0x23e53df8b42bd34a, 0x4c3def6e700768ba,
+	 0x0549265a5c58da4f, 0x31c15b9769ba33d7, 0xf0b04ac63beef7e6, 0x025e195871eef6a7,
+	 0xea0f0c0b5553bfa0, 0x5bd0e3b3a21e8bcd, 0x2dbb6cbd63aa4b24, 0x252497c5c6b1b503,
+	 0xa9c03155543a0c52, 0x8d369754acabdc50, 0xe5c0e5180f460a83, 0x5c8afcbb991858f4,
+	 0xf667127983416e84, 0x7a6556655954c07a, 0xd3cc1fb96da1210b, 0xb1d82b2017628fd5,
+	 0xcfc2d95edf09406d, 0x5894db3e1723b05a, 0x1c85d4d9822a3ac3, 0x1eac4db990874c24,
+	 0x2364feebca2b7f79, 0xcc160379e9e74c0b, 0x528c5e9dd675b6eb, 0x50c5845118c72f7e,
+	 0x8aa6f0e47b54c838, 0xde761240d4d0873a, 0x8401ae8821a7aa39, 0x533be3b6a805d8c6,
+	 0x8489f433a26c6f83, 0xb060cb7fb7893c5d, 0x0b8452ec41bad309, 0x7d1487debbeb53a0,
+	 0x6659010aca31dabb, 0x0a163d511ab5fd9e, 0x62c7ade7237e31ea, 0x3e71d86b10c5c61f,
+	 0xb2e1946ed395e94d, 0x7eb6aff007b1ee44, 0xce54fe850debc68a, 0x3fa8eadeaf5b4d54,
+	 0x79b4964959edb62a, 0x97925465dbbd3a1f, 0x22e48215fba73513, 0x5361bf1481d55ece,
+	 0x468a518313691384, 0x658d8c7fd803979d, 0xea7ad0c865a41179, 0x8f2c73627ca70a99,
+	 0xae23197e7fe94733, 0x0ec8a20d98ef4900, 0x24cb0f23282d731e, 0x54a55fb81cf416b0,
+	 0x6b48615b6bdd7584, 0x7122f7090e82f2fc, 0x1c2cd10957bcb116, 0x3473fa9e64371089,
+	 0x604967f7ba4b81f1, 0x87340c70731b207f, 0xfbc35e71ec423261, 0x00485c556f07a9bf,
+	 0xca7140cbd195c707, 0xeea41e40c98753fb, 0x0d24db8c0db58c99, 0x529db1e3d126c117,
+	 0x39ced3aa562312d5, 0xb031bade1cf26542, 0x9cfece59bf6bb288, 0x01fbd3d5e2c95408,
+	 0xde6b038f87c79dfa, 0x978efb3149d081d1, 0xe12caab91caf50b5, 0xb55c894637a62d36,
+	 0x1520536b26ffdb6a, 0x5b0c2c6b3ea2f9fd, 0xbf4e78b55f896138, 0x18891af88b411dc9,
+	 0xdce34084623c6610, 0xdf5929d7fb36242e, 0x41dbed120d0f2388, 0x1eacce715e256ff6,
+	 0xd68cbc51a4b9b5b2, 0x97d86593c7baeadd, 0xd33b72a1e62835e6, 0x6e1f46c665e6c89a,
+	 0x940a79f102e3079a, 0x125f5e101d957ed6, 0x2d2a6111f11f588a, 0xb5aa42c7779f4d95,
+	 0xc6923c0999de3cd5, 0xd7d175ae9f979e78, 0x4a947f194e2d0907, 0x032882954a5224c0,
+	 0x62bd8a34ef8576fb, 0x2d2bfc35a3ea168a, 0xae4799ff62a9bdff, 0x1f7d141fe0c6c91d,
+	 0xca87fc14ff014fef, 0x92bf89df9220e860, 0x0e08a42404e41c45, 0x37217c8a6b489abd,
+	 0x18e7a0d94b86942e, 0xcee071496ee803b9, 0x88d4d1bc7c872965, 0x3e1027722c230b6a,
+	 0x450c2fdc5fa2fe6c, 0x1a1ee0a74868d0e5, 0x847b0d18ab68ac78, 0xaae29f63d0ab0b4f,
+	 0xfadfef8a06a98b4a, 0x6ab2e5d67b52ec98, 0x2e3562ee7d76e066, 0x4f3639f4fbfe8f9c,
+	 0x70dc0c86aee61a28, 0xacb2a4e6e8f36589, 0x23050b1991f59648, 0x5c08fea7bf3955cc,
+	 0x882bee41f0b14a08, 0xc78932e63e6684e7, 0xcbafc5e218d4cd42, 0x2a9e87e6e834ca26,
+	 0xa73b2c2440cca318, 0x40bc37f1e341551a, 0x9c1c5a7788ba2f5e, 0x56a09b91c9a3a17e,
+	 0xf6b317636d509e48, 0x3420e19ab8c8465b, 0xc5693aaca3d6bb45, 0x0c2472488db417cf,
+	 0x16d617cb984be11e, 0xf76d19d994893645, 0x078987e017a7aa39, 0x492102cc773a968f,
+	 0xd817cb2813ff8fbd, 0xef5c10e296a1f112, 0xab75152b26c35454, 0x4ac8e6292cc2e7d3,
+	 0xda8680d60b6ac677, 0xf191706dd8976052, 0xf33928adcc2ea376, 0x9731206fea4afd9e,
+	 0xca25cfbc483b7b6b, 0x1785610e130d3e43, 0x5ce92ff9253d7d94, 0xa5de3256e75c153f,
+	 0xedd8501118fac735, 0x00ef7f5f77be9def, 0xd9db60b6ab66ccc0, 0x93434ade5d57ec1e,
+	 0x31d4e93feabd4514, 0x6e9f451e40112578, 0x14a85c1bae7e486c, 0x6492aee8c27e80f4,
+	 0x8d48fdabf4a171e6, 0x8a15e943270a7df0, 0x6737acc11ef7af7b, 0x2eac9480d3d0cb9f,
+	 0xc4a61e1018327ab8, 0xbed8f217c1a9b3fd, 0x61ee1e10748218cf, 0x770493a49b35629b,
+	 0x9692cdd762c34b1c, 0xec610b5759d5891f, 0xc81b66bfca500d14, 0x4316cbd78b2d2288,
+	 0xb31ed966d6bb10c9, 0x6f73a19e198e0b04, 0x416c04d6216d983b, 0x1fe4e0721e5bfe59,
+	 0x98608327e7217230, 0x385cbd86df878435, 0xf1d31bfaf4624a8f, 0x932705c1dc119eef,
+	 0x44d57e594f8d5d8f, 0x97b485f939858b85, 0xb0104c5717b09378, 0x328eae771a1fb22c,
+	 0xa2e42e562ee1496b, 0x42251ff5063a7211, 0xa6cb31553a4eae42, 0x57df63a41336deef,
+	 0x7cb4bf4f928d29e6, 0x8f42ca5eed2bb32c, 0x6c1f104c2504f263, 0x7f5856053d32a2ba,
+	 0x4051989ec2e73a80, 0x37cd5da211e9db45, 0xd01216b489ffa12f, 0x40688c6f99f251e5,
+	 0x16c1cd2a5491ad30, 0x44f0cfa907ebc46f, 0xe815e63b35297e51, 0x77df75d021d104a8,
+	 0x664585de7f183920, 0x4efcb0bc9e62ec04, 0x3a15e953923a43dd, 0x976d140676daa5d8,
+	 0x50d433eadbb77754, 0x2b277a67d41e8499, 0x84ada4cb48284653, 0xa9fc64949c02bebc,
+	 0x1c72e7627fc8d37d, 0xbe340e80d65ced7c, 0xc596187d86949226, 0xb052f459682406bd,
+	 0xd4fdc64994fc19d1, 0x00ec057b2a3ea746, 0x037f851551a68213, 0x8c0e38f32579db6e,
+	 0x430debc97a614ca6, 0xc19dc384a8f416d9, 0x30565f64e70e4342, 0xaf97a66fa1192cc5,
+	 0x0221da86282dfd3b, 0xb1b5bb13fbf89128, 0x8abc40c156952028, 0x355a1c95b86a3501,
+	 0x846f252c55299c64, 0x6721c8bdea0e1b92, 0x38f28bf3af85f8f7, 0x570dd8b57fac23fe,
+	 0x9f7c0622f6909208, 0x6680b79ce524702d, 0x791cd4f3b7ec703d, 0x32eb06e907007978,
+	 0xdd9aa3a0ef5e73b8, 0x0d50f4e25ec63fe4, 0xa89bb0caa768a733, 0x586c6e8884f3ecce,
+	 0x8a7b8059549a4c77, 0x6c50029d31d9d939, 0x74d00f6eec8fc551, 0x717e9de6c882bf9d,
+	 0x258517a49d58b9bb, 0xd386ae0a248e55ae, 0x7d7d2458dc1724fd, 0x3717a33a9f24142e,
+	 0xc169c5b1aade7242, 0x0bd05e438332f520, 0x4ba9b49dd2f5a143, 0x899e8f0509ace075,
+	 0x84ed4d8a988626b1, 0x12387f416bf89332, 0x566eb655d845cd67, 0x43190caf1ede4c67,
+	 0x43fabccbf87e4ff4, 0x483607453de26ad4, 0x13c34de56411f175, 0xa4861c4960000c7f,
+	 0xdc2f84953d27c663, 0x160284b6eb93e27e, 0x0689ad99bd1a3c62, 0x6463fe3131a70a58,
+	 0xd7ec11d649d7340a, 0x2df305c75b40c212, 0x4f29b568c9f66999, 0x917d9d6a7fd1638f,
+	 0x90bfb79894838b52, 0xf12dd3068e9427fe, 0xaf239f639583be7d, 0x5bf35843dc728e91,
+	 0x4cec8bebcbf80eb2, 0xe5d2609765178102, 0x41085ddbcf537088, 0xae5ec2aca19a11a0,
+	 0x9f5d61a5b28b11ba, 0x9ed0b889f77ffd0a, 0xac99438bc355057a, 0xa38f17bd4e7b3dc4,
+	 0x0acf956593f532f3, 0xe28b7e041f2971ae, 0xcc625b537e89184b, 0x269b85c4efdce95f,
+	 0x8740e73ad280c3d6, 0x440bb1733958d1e9, 0x0fb27b6ddc363f5c, 0x6c811beb5e671663,
+	 0xbafe32ccfff0d0c3, 0x26719809d1646dfc, 0x63afc67fff39563b, 0x41c36a8e4ce7624c,
+	 0x356c62941b8aa07a, 0x024cd9e6cc431359, 0x4941c6ad0d2af5aa, 0x44a7a0b3e20a6da8,
+	 0x3efdc265df2fccbc, 0x84b053b328a20dd4, 0x5c7231b99cf7b10b, 0x9da019f967b56c02,
+	 0x46c517a7f494f59a, 0x6302e444123c8efa, 0x5f8d11aa42b0d723, 0x01639ebf3cd0240a,
+	 0xb3444529356a6336, 0xa3fc079e302dce81, 0xc5cfce612d164c4f, 0xa31ba2aab596ae4a,
+	 0xd0239d605f19f3f5, 0xa0a39f03d78e6cb9, 0x05428dc0f53ad098, 0xb6369623f0bcd9ff,
+	 0x5852907bf6723c5e, 0x8b9c167c2be76e18, 0xd0d1c0d848206bb5, 0xb00c1711dd190049,
+	 0x98c5b32047034a03, 0x9ad56687c4d9df63, 0x81ee65b4ec8c04d2, 0x591ff2199a9bc73f,
+	 0x29a778ef9781b110, 0x48b7e6b7561da945, 0x09e09a00c6dfe4ba, 0x003d7e1b715c9d4b,
+	 0xa838fce02e013e47, 0x3a263e4ac828be93, 0x98e315653228a785, 0x02d4f907d73a8e03,
+	 0x35d112a2574c9e82, 0x689d3047521927e4, 0x1dbb5a075ce147c4, 0x1c69321743bca744,
+	 0xf5c8b1d7f26ab9ee, 0xdeb754a0b9aece54, 0x34b17e31344acc6e, 0x66d62c057c45838b,
+	 0x21ec670797928083, 0x0b6f852fa38573fd, 0x4aa9ea0872aef673, 0x9564fa4eff0c77d0,
+	 0x86ca6f58a520a388, 0x5eb6132bc5b2cced, 0x235c8605b42650b4, 0x70e70c26f9de21d0,
+	 0x049cdd1356667e72, 0x061b80c386d44900, 0x16b7c91df4731dd7, 0x12d2e90e55fada20,
+	 0x401a054eeb66f0d9, 0x2390ee6fffb8d911, 0x0074dcf372d8813f, 0x81da1bae27ee44ac,
+	 0xe0ef0f3b8b0dda03, 0x5b08f02d2bfda707, 0x65bbb6267c1545e0, 0x2167d5a770169329,
+	 0xb4d0339d76942dfe, 0xac9c679bf036b163, 0x5fbbb574d3c69a90, 0x5e3b8759a941228d,
+	 0xb91ad0cc1da52060, 0x70174fd6295292b4, 0x2287747ab7b09298, 0xb24e59c0b20c7363,
+	 0xc20ac2f61a7909d8, 0xcf314fa2f67ab8db, 0xf5d835fb0521b1e2, 0x643c42cd4d08e860,
+	 0xa5ce618229e71a1e, 0x6bcacef9fd857cad, 0x638ec2f078f04c65, 0x766aa6fc435d717c,
+	 0x5e0b04fb07414aa8, 0xcf6898e0dd798da9, 0x14220857ae0ba8b0, 0x7973f0360af1d9dc,
+	 0x0ad9cb8ac5ecd559, 0x8301ad2a5bcfc0b9, 0xdac84d069772bf0d, 0x98a38d2a9265cd26,
+	 0x9b72e8c9f583d814, 0x678e8285d082951f, 0xa5fc8da9d848ecb7, 0x13d0fcc8f77f7661,
+	 0x8e4cf924da779ed4, 0xfd1f43b515aefa6a, 0x8f5f6d722e6324a3, 0x42e6c8636dcfbf50,
+	 0xc7852ec58328f12d, 0xccc7fe1344541ecc, 0x9aea748036320cb2, 0x9a49f15277e7cb73,
+	 0xd176434a6e215b43, 0xcf59848c99c8c623, 0xeacf9257c8cfc5aa, 0x349682918c1043e3,
+	 0xa04c27c80ccd91da, 0x65781c198a308898, 0x89ab03006c4ee4f8, 0x556a98ac39fa294b,
+	 0x5c7e0cc2c2f4d3f0, 0x05ae6a784967fcb9, 0x96c02c44488a16ce, 0xabb42870d03edede,
+	 0xdc2b35cce7056c77, 0x28bb5dfa2adb61a6, 0x280348abd15770bb, 0x10438b566bfbe529,
+	 0xb0af4da875e51f24, 0xc93e59de289f7139, 0x4937cef6330c403f, 0x4d62681af115fa19,
+	 0xf0e28b10030ebec2, 0x15b39c363c6138e8, 0x83dcb3b182c73ebd, 0x24e8db068f908c68,
+	 0xb85be138b1108aea, 0x56c4e99930352b26, 0xd0a772e5c58694ed, 0x262e743bd098283a,
+	 0x5b61df3ad4d8156c, 0x8b8a6e057ed6b8ce, 0x95f1fef896781a5b, 0x59b6d63a7943afea,
+	 0x4b98272c54d76999, 0xbbb4e40d470ffd54, 0xb1e5ffef5ab39246, 0xa7ada9dd6e238823,
+	 0xa83c433ac314b8d1, 0xc3ac2365ff2fe365, 0x5415ac666cefc379, 0x1f7f66253b7976e4,
+	 0xb088350a4c09de6f, 0xefea517e2ba6dea7, 0x511c4015bb7d9a33, 0x8d8dbd2597cb4460,
+	 0x37509dd0ee6aa9ed, 0x83fd4cbab424f5f6, 0x6b7f9d363211c0e3, 0x7f10c3aa42581015,
+	 0xd63d0dea67831967, 0x73e6ccabdcdf102c, 0x0ad2e325591240c7, 0x045af6d8e2fcdabe,
+	 0x1aca9745319f5826, 0xcdd9e8ef47a6863c, 0x854e790dd0b87c70, 0x5e22983ada98b5ca,
+	 0xb16d428832c112f5, 0xdc04b4783da72c92, 0xb83a06c4528bd9b8, 0x267dfb3cd25c659f,
+	 0x14b92d2c217ba5fd, 0xadda06831c9e8aff, 0xf8d06aac96e7d2fb, 0x758cebecf5276f5a,
+	 0x749a1c949156e24a, 0x9edce91f4d9a7924, 0xa55674d1e5afb624, 0x09ebe6802df436fe,
+	 0x02d94089b7e1ad50, 0x457a048878c0da34, 0x599e04b0956798ee, 0x09d7dfe48bc59a2d,
+	 0xe0ed5e0b27613929, 0x5edc94811cd29fba, 0xf6ea6b33cb81a407, 0xa413de4cc85a3dae,
+	 0x313c9875656527c9, 0x97f45586d428f31f, 0x67208705018ef60c, 0x65ad0d677bdc5deb,
+	 0x5034236484b07154, 0x048db91254facd7a, 0xd78da10f0adaffb1, 0x960fe0e96651f57d,
+	 0xaf8d1235f1296364, 0xb0b689dea85aa012, 0x31b0beee6567f891, 0x6cd37412adf50cd1,
+	 0x664e95ae693b8b38, 0x8a289c687852ce64, 0x38b674345f74a3ca, 0x3b7a2631c193e23d,
+	 0xb2154f17759e6be1, 0x6360659e77b5d4e8, 0x7e8cb7a3d5b00eb9, 0x008b645a484f0b5b,
+	 0xd07d383b83d5dcc6, 0x193518861180061e, 0xd8abf558b828bd4f, 0xa132a7f9c01b2b01,
+	 0xe05d784dfa41ad0a, 0x2b2bd71ff2e56b4e, 0x57f7050322425d66, 0x78c8a84eeaadc8c5,
+	 0x5d5de06b85b22fc0, 0xbad7f6b1daf94ff6, 0xd015a457bb4219b3, 0x2946cefbefa14b37,
+	 0x5de4dc095f6a3943, 0x5f66b9c57fa98112, 0x45c41515c0ce10fc, 0xb2c016fd80933555,
+	 0x6bf3df10704c9ecd, 0xedfff22eaa6d927c, 0xc2be5b53b028a3c6, 0x5ffe160f1c4cdf30,
+	 0x3453593aae2e9721, 0x763ef82eb10b6506, 0xa4cf96c2d15c56c4, 0x59d76f991e612d80,
+	 0x78858a316db0053a, 0x48688051cef02889, 0x2a6dd8a5a1fa8932, 0x10aded2bc9fd01e7,
+	 0x64874d0492cef827, 0xdd0eacca758c9d56, 0xce15df83300e8316, 0x00a91c139393134c,
+	 0x383656100db6fffa, 0x8a0739295f3e903d, 0xbb90ca9973c34986, 0x0546b788c602825b,
+	 0xec1469c7815dc6a1, 0x199c260decd1f976, 0xb3f10a086f86a71a, 0x65eedc72ed81e4a4,
+	 0xda39cd9e7c95df3e, 0x43f44f5384e1e7cf, 0xff93cfbdc605a1be, 0x20587f74a095c93e,
+	 0x334124fdbf50516a, 0xdf6f82059a0dd314, 0x55e0fb3f0f3be3c0, 0x5267c2753a57f37a,
+	 0xb03cb40ae63a0916, 0x536216f88b3e3de1, 0x447796110b6809c7, 0x9cb2d284d984ae2a,
+	 0xa166b97ccb7cb40d, 0x0bfa3c5c4e9977ea, 0x195ada61fcca9fae, 0x8ed334d427081e00,
+	 0x8c54e5b6e7e08ac8, 0xb0aae6615575cb24, 0x3e7e35beedec395f, 0x92eb5788b534ac6e,
+	 0x377e68d3fe3da170, 0xdb4dd4a7e8e39317, 0x81cca4945fd25f5a, 0x3424d9df9cd0c13e,
+	 0x87dace7d66904b30, 0xedbe8450b96f3a03, 0x39b79150b635195e, 0x244c8b85474121fd,
+	 0x5fcbfd9a4fff3984, 0x4189d86e72c217cd, 0xdbecbaeb0243dbda, 0x674b2b4f4ba3496a,
+	 0xc8d1ae793010e5ce, 0x5614569e126b40c1, 0x96e5d11f7f1fd462, 0x4a7e1350dcdf4608,
+	 0xd3f8c5593960617f, 0x7d18a11af7a3bfec, 0x71caa64754a3a096, 0x5122e784dcfea891,
+	 0x27025c59fc61ec50, 0xc31a2ada35caa808, 0x41227321c5f16714, 0x2682f600f7277257,
+	 0x7e5d794e1b577608, 0x0c2419749b651c55, 0xc54f24499f093830, 0x6c17efce5c759934,
+	 0x1ed279efec602842, 0xde7258d94fdb9e8b, 0xb27cfa061b944b9d, 0x4d1aef5da000480d,
+	 0x136023324a5846a7, 0xa6cacb8f540cac39, 0xaa13eccc60c18c86, 0xa10687b749100291,
+	 0x58ec08320e4cd3eb, 0x9872a21aba77ff08, 0xd6342252d0190180, 0x3b271c942e90153f,
+	 0xfd5cb571774a1936, 0x6cba03e6a7f05ae2, 0xc9392b5d247e4d6b, 0x3f93bf96283e1eb8,
+	 0xa014338b403ed5b5, 0x4761333bd3250e66, 0x4115b31e59f26599, 0x0856804e82007208,
+	 0xae7f85ca0395800d, 0xffe2f720e1b85d71, 0x2f7d60feb63195b9, 0x0e99180c036d0fee,
+	 0xe0f0b12667856650, 0x1758f8187562684c, 0x3e1abb18eb73f48a, 0x6894c40f9cb2bc12,
+	 0x801869fe0aee73a6, 0x7a6644d716761b1d, 0x95368bcfa8b6ff8d, 0x1e088307be060925,
+	 0x14bfcd8eb6dba5d2, 0x053fca86f73970bd, 0x0ddf7b32bc022e82, 0xa18df46780d5d727,
+	 0x57ad6bdf383f1192, 0x25ed297ab1268cb3, 0x769b9fff10cb3879, 0x33ab716fe6821c2d,
+	 0x7d731f181c7ba56b, 0x1652fc82910f571f, 0x727a023d8fe1d6fc, 0x0b9aab629f4ab3ef,
+	 0xdb6bbbc743868767, 0x06f124558a35125a, 0xf0bbf18f3e640817, 0x17a82fc91e56a845,
+	 0x07c4737c007dc553, 0xee41fb19a25ee268, 0x737b1196d374acb5, 0x06314654916794bf,
+	 0x95484806658d725d, 0xfa7961aff657ea5f, 0x22cfe1a80bfa500b, 0x757156e8389fcc3f,
+	 0x9513f03836302a7a, 0x7fef72ee50fb7302, 0x5774f24fe6be3a03, 0x04035e59cc1aa7f3,
+	 0x81d0bfe627b0dfa7, 0x92e48d9d2edb842e, 0xcb3b8c8fbcfc475f, 0xb079855f5a30d567,
+	 0xf6984d40df8a9044, 0xb6e277a8ee4a5e4c, 0xaa937cbb5b6ac311, 0xa39a657caca55776,
+	 0x082161d691559f4b, 0x42456083ff87c293, 0xc00393267a4b6ff3, 0x380e9899890c7f6d,
+	 0x6b164b277fb45819, 0xd5522a7cf00a42ac, 0x5f3e9f2e6fc752e4, 0x3b0a8b7fd168f2c2,
+	 0x6ad4fef649302fbf, 0x46fe3b7a62d27428, 0xe8df021c917fc6b0, 0x73aa60f16afc1ca2,
+	 0xbd74c025854f7cfd, 0x4a3cbc98f8a4d47e, 0x4b2c97a03f15c779, 0x9e719580484b5a72,
+	 0xb7adfd4439e0cd2a, 0xbe9cfcddbfea93d0, 0x03ff90ce453e2ca6, 0x5950293ee018a5f1,
+	 0xfd36978fa3b89171, 0xeb4fbdecddfaa4d5, 0x9e885ccda2029ff6, 0x323cd5e4d7f1a0dc,
+	 0xe492b861f266fc74, 0x3dcd7faa216d6041, 0x3b97bc41f6676ab7, 0x462c1325458521bd,
+	 0x1e88661abdab94ff, 0xb91add57e87704cf, 0x9b7a78683ef5d866, 0x82494c2f734a9339,
+	 0x113b725c6d130056, 0x59e211b8271aae2a, 0x210e8dd10a0211ae, 0x84287e66e0c580c6,
+	 0x8f9fd155c6d47017, 0xf3e29c32c18e98ae, 0x5ea913d90c32b25f, 0xb475dc100a4a8922,
+	 0x4e127d0dee7f9b4a, 0x1fae348014123c9c, 0xf1bea07e800451f6, 0x37ea71a00b815c22,
+	 0xb8963c8885ebd7c6, 0x5255974a37794300, 0x7a95001beea48e73, 0x6adac8328ef85cdf,
+	 0xa0ddf2c308bf3e31, 0xfcc0ca0d58e9f292, 0x2374be76568d35e9, 0xa48d1e4ed78af3b2,
+	 0x8fe445e6d57c751c, 0xb5945b94d33a2cbc, 0xa0b2bbcd2c8968bf, 0x01e71c8414c5118a,
+	 0x45f3a6ba937ce8ce, 0x0002c195e01cfed9, 0xcaa1ef8439cb2b65, 0x9b5f9f58b2a035b6,
+	 0xc24680b799415a6d, 0x693ac080f42319fd, 0xb44c9aa64e0c5ad9, 0x61f73e1dbc7a8406,
+	 0x644bcacbe6df9973, 0x50d71b603405a544, 0xa5203d7e815c4d77, 0x0dbe25849f1d2051,
+	 0xac9b5dc461b093ca, 0x798c74bfc545a65c, 0xd8cbe933ca3b11c3, 0xa0245178266cb291,
+	 0xf46e84e2f377ae70, 0x9221ff7113d0f4f5, 0x01c9f7b9a9ff8ca9, 0x18c354680258ad90,
+	 0x556524e237d1a6ef, 0x5f9a4a9d9a6e84c6, 0xb05f69067d77074f, 0x1ddb91f0c7e2f672,
+	 0x5cd6a5db92dfaa6e, 0xed191598e2a87960, 0x6e6d3ad76925d1ea, 0xa7d7ce35c211ce16,
+	 0x215c7bebd342353e, 0xa912728dca032741, 0x82bde055a4aa9218, 0xb433e4203f3f0394,
+	 0xf84c5fb2f79134ad, 0xdcc830b3e71bd3bb, 0x1d5ae91d31eb664a, 0xa7af98cae718557d,
+	 0xabdaa0d739a64145, 0x6e91db3533c05bc5, 0x7f41cf85e7e02928, 0x5e622967d03350c0,
+	 0xcb9ae194cec13961, 0x41b4d3968ce9cac3, 0x16905492cf92b985, 0x9aec7e2ac5c24236,
+	 0xb50a2264720fe398, 0x07f32f71e67cf337, 0xdd0e2a24daeb8fae, 0x4977f9369f3834dd,
+	 0xf37ea9823e91d36f, 0xe3e6c10435cba2a6, 0xcaa8c6a38be71083, 0x2599af0d5a50b621,
+	 0x44eea661195c695e, 0x906d302055650725, 0xb2a05c4dc2b8ce15, 0x9aee9e1094b46d0c,
+	 0xf9fad1396fc80acd, 0x0869d3266a53bcfd, 0x3e647a70f81ff95f, 0x172a30b06f3288d7,
+	 0x2d7996b4238da52d, 0x42bf1216f248bd07, 0x94d3ad5b6553e1ba, 0x77f289dabe156748,
+	 0xfc5d3d2c33d44e15, 0x554bd6d1ead78384, 0x69b5d82b44519896, 0x4f7f9c188472d721,
+	 0xf412a1c5a9c8727a, 0x7a4104310181ad9d, 0x1c0796fd65297fb4, 0xb4cd0199a46b4b90,
+	 0xf57849bc5cee2a96, 0x437bd107a88598e4, 0xa2af0fc407ba53d2, 0xac197cc876d4c67d,
+	 0x03742cd8ec994001, 0x400f054d9aa38f10, 0x1993b86e2f9505a3, 0x2fa2ad4b0954d9e2,
+	 0xc4028b0794376d1d, 0xb7f3bd05333ec9e1, 0xd35ddf153de3f9ee, 0x2c2b728baad72b1f,
+	 0x4a39ee265d6d50ee, 0xeb5658dd6ea793c6, 0xbae42b4db8e3f89a, 0xaffbda1b8c73edea,
+	 0x19cc2d5a94bc8137, 0xb7a7e79a3691e945, 0x54b079ffd346c0ca, 0x0561761b9cd6c759,
+	 0x03d93f8ea0f7c254, 0x70cd0f221fc729f4, 0xc5d0734fed30dd29, 0xa1b2e7c6e8e6ed50,
+	 0x23a56b4f4bc9138a, 0xcb976a38121ac201, 0x78aadb5911daefbf, 0x57506dd2f059925e,
+	 0x766d5ad85c1beea7, 0x2397cd73f2d8c553, 0xa8273a0be6954d62, 0x70c2bb4c488d9217,
+	 0x89a9027bdbdcc529, 0xdfc813976bbf16fa, 0x089d7afbdb38c356, 0x52356554a4628bce,
+	 0x711c11a18ba91721, 0x83afb5458551fa03, 0xb589e5f6be51f283, 0x7aab534016915d66,
+	 0xe8891c6981264195, 0xff7e43ab79c635f6, 0xaa3fb2fdf68d8e15, 0x0db11b402df9d9e9,
+	 0x066a4b4ba67d1f34, 0xfa1aade042789bb2, 0xb209c10eb4edac18, 0x0401544f46771fa3,
+	 0x28526f1def1a5dee, 0x1a780283fe27f136, 0xc8daa95affe7d100, 0x08d4e984c0d12604,
+	 0x4d3262d6cf9a890b, 0x4aa849906096dafe, 0x5b9343a3c6b5fbbb, 0xa82168f196dd4481,
+	 0xf758cfa8025768ef, 0xd4d3eddf9b75bd90, 0x5721eea11a3c42a8, 0x932c377db58bef38,
+	 0x4216e44707eb5783, 0xb81889ed27d84d8a, 0x5637d239faa1c56d, 0x395cf39d2bdfd492,
+	 0x899db84c4baeb515, 0xf249eb18be4bf199, 0x6a2998f11843263b, 0xa57b6be543dd6503,
+	 0x15c7fdb4e1a04294, 0x8f7da960f800fdb8, 0xcbf5b9107b4d4a66, 0x1a8efeaefa198e72,
+	 0x8ba3949b7754fca4, 0x990a85d2e7e9f486, 0xab5c3332110aef6d, 0x52ba697497bc94c5,
+	 0x7ec9713007aeb210, 0x33a0cf387ba59abe, 0x9ddab1d5451ced1d, 0x6d9ed1253dd5ad9a,
+	 0x3b259c115677d3d8, 0x8f560fdfecfc8263, 0x476ab2c5ec7c7a12, 0x6052bf5772aa94db,
+	 0x2c2bc7efc280f9ab, 0xf84cd33938534079, 0x8ba3566abc409b7d, 0xacd2987fc939d7a5,
+	 0x3fee3b5f425176a6, 0xc2da70b96e35ed55, 0x8a01ab558715565a, 0x4aa33e6e5519b911,
+	 0x7cf8381b1d306c37, 0x37ca2695246e9c59, 0x66def9e81bb8b65e, 0x7d0846bebe9d784a,
+	 0x7f17a66385a64289, 0xa85ffafa2463a3f7, 0x9e410bbc66b0f8e1, 0x48017a279913e6ed,
+	 0x7641c771bd1ac19d, 0x77952790f54f2cc4, 0xebf6156638d100ae, 0x14bd776674da2bbe,
+	 0xd6ed384f589cf068, 0xb478937ab4af2eb1, 0x34b549d0b34f17cd, 0xac4f302e268fdc6e,
+	},
+	{
+	 0xc2e05fab45402f4c, 0x9d540d6a98352203, 0xb8a5a60fdc25b0e3, 0x4269d60888dbaf38,
+	 0xc61e867073d645de, 0x12498ab3208bffbb, 0x1e02a62587fec5cc, 0xa2821201f1e31bc1,
+	 0x2ed8de1797c7f096, 0x32fbaeaba395385a, 0xef9e2478fadab511, 0x471b69ddd00b90ca,
+	 0x724d3185238961c4, 0x78ae3b9f569efa7f, 0xa1ecff9e5b4ef82b, 0xb1498169bd37a5b8,
+	 0xd3297c60cdb314e4, 0xc08b1dbffa70e0e0, 0x7d1fc3114186d338, 0x3d4b4bf52bab8cc5,
+	 0x2139a54927562c61, 0xa844daae87dbbc2f, 0x2f670f63b0102d07, 0x60ed79cc4f672d1e,
+	 0xa718bf65153109d2, 0x3d307e35c46f2f56, 0xc07cd12b9419bc73, 0x39831e1d057bdd85,
+	 0xd88c7d6c16138067, 0xf3553e1113dfa3a8, 0x0c71bde0b8d2fe9e, 0x17ad6096fc474f0b,
+	 0xa7ac0903869f3ed4, 0x378a789d6426e9c3, 0x3b155767d566ce13, 0x044a96c5b9b9f340,
+	 0xd68f9b628504bc1f, 0xd08cb30a87350987, 0xc6eab48893903f19, 0x8f079c7ea690df26,
+	 0xccc6dcda0c76c478, 0x701b05c4a250e60e, 0xdc56ab1bb4bde5cd, 0x0b4ba11a919c6e13,
+	 0x16cb76ed75cb390f, 0xed5919b92edaeb3d, 0x53e9dc12cd81dfaf, 0x77a7408426792b8a,
+	 0x8d488c1b6f430543, 0x139847e1ed27dd45, 0x57cd03669ebaf016, 0x54547ba3eb8e1861,
+	 0xda74476e121c8355, 0x7c16f3f92d519b82, 0xb4d6abe5185f81c6, 0x6966e0f00dbe5abe,
+	 0x78c5a9aa4786c7af, 0x7f431a556aa45687, 0xcacf90a5b359488e, 0x2d6d0d5e34c504fa,
+	 0xb4500c094becf4a7, 0x983b7e64fbf3836d, 0xdb68aa1b84ccce58, 0x4c08623d3155c1ce,
+	 0x9bfcbae21fac9667, 0x0072582263ce607b, 0xc89e994c22526afe, 0x13041e987d0bdc2a,
+	 0x8b67c30d5312fce3, 0x911616671f5fb688, 0xb3dff00ded1888ab, 0x56b41dd8224ca422,
+	 0xef5bf25041e51cb6, 0xad286651adb638a4, 0xb13584aa3b02b49b, 0x867460673bca10b6,
+	 0x29f4428be7e88705, 0xd8fbc8bdd95b3e76, 0xc2e1392266b01360, 0xa200053d7db5af16,
+	 0xc7c46dbe677693ae, 0xee50c9b19c866da5, 0x5dae2b851767fb0c, 0x2c2237152cb4074b,
+	 0x4eb8ce8c0b828276, 0x55fc5fbc29db6378, 0xf6fe5eace9948549, 0x5d3cfba07297aaa6,
+	 0xb41ea3db0d1b9bce, 0x7485a7d961e129c4, 0x23bcc0d1ddd56ee5, 0x4792d3706f1e8dd4,
+	 0x35e7c9ea77ca6820, 0x1d6429b3d556c6eb, 0x676af49a76eb8c3e, 0x04b746f0feaaef02,
+	 0x914502128c3a46d9, 0x76e78a13f7aa520b, 0xcb21b08cb45d9c27, 0x176ea6127a70368b,
+	 0x946aab251e5d3556, 0xb23b0f55b2d22c9c, 0xbdb6342a0090dc64, 0x767618793b06f89d,
+	 0x356651d53385e306, 0x139530244263909e, 0x9c1c4175ea588a43, 0x4f94b9047280d597,
+	 0xa39380de5704a07f, 0x4b358f81fe6c8d40, 0x7b2205a37cbde7ff, 0x7fcb29778f6187c7,
+	 0x533e4efe94d0185e, 0x4b11b49f68d7d690, 0xd223d1628dae6577, 0x721b4a245ea067d7,
+	 0x7b39106b0d24e559, 0xb6388253fa940ee7, 0x2446846a393614b1, 0x2f6ffdd915bf66aa,
+	 0x842b050a68f79d35, 0x7f08a316c16f991d, 0x2940e78542d2890a, 0x63013c44fbe47c67,
+	 0x67a87edcc247f1ee, 0xa10960ce834bee54, 0x3cf2ef1ba75f3320, 0x966bb8ceb2d093d6,
+	 0xbb4bd802d5537047, 0xe334d0739a0decff, 0xfbf4ab7ff159932e, 0x65111ebc6659d3da,
+	 0x5eacc3ea5746e589, 0x8a979b37042e28fb, 0x59b8c0f041d906d6, 0x55bc93769b84f87b,
+	 0x86195cce656515bd, 0x9da932bbb8741e71, 0xaaf0954986f9b991, 0x4d1b14910c5aac96,
+	 0x09f00b1db5584fbc, 0x839b559195318692, 0x4e479e5dd5c025ce, 0x21234b4fe8c2101a,
+	 0x016c80d47f605958, 0xc85620cab860708b, 0x6d55d5a9042e16e0, 0x447ab105c3b16ce1,
+	 0xa83e1443fe9b3fc8, 0x1ff9ad5a795cf690, 0x4f9b92be505ce36e, 0x09efe7d3271f93d4,
+	 0xa788c93a2b94d68b, 0xed65d3dd4cff797b, 0x92c989f85639c30d, 0xa274bb4dfcef94e0,
+	 0x144492153f340ead, 0xa044bbdec1e26f58, 0x1c6a5b2dba3c8021, 0x9ccf7fb0d4263218,
+	 0xd76d5be90bdbea04, 0xdae3e0cc3489c99e, 0xac2f0946a5a6aa06, 0x1ac7dcdbbaf44569,
+	 0x74620b4c3e08781e, 0x42181c2c1c7cd37d, 0x4a717d42c9bcad80, 0x9b7fa46171e8c07b,
+	 0x4d988c4849517217, 0xfb756e75c2df1711, 0xffc2880450d6bbd8, 0x479c0b33a90d3afb,
+	 0xd96723649df0048a, 0xf948dca0d88177fa, 0x07d7e807bc18076e, 0xb04dcbaf1aa5d86c,
+	 0x3de49a0ab275817a, 0x5fb4a19bc1ef3476, 0xc9aaa92e17a3b22f, 0x2b7390881b008967,
+	 0x79ca2aa09ef16c5f, 0x109dcc71a64c4704, 0xf6f5deacfc810b95, 0x39fa0f188ddc5591,
+	 0x7f2d7f8be74dd32c, 0xa55c0ed2a0bca0c5, 0x157c91786858e89e, 0x0b1882d7ea64f30a,
+	 0x40c00eb7aef1ec47, 0x66710a552868e187, 0x9092965af945d2b2, 0x11ade9376c53907e,
+	 0xc61a42a5413602ea, 0x62890c6a9a0979f2, 0x6e8362e834811727, 0x10774c64dc2eaa31,
+	 0x552daa6d3e49ac57, 0x4ba12a0018050389, 0xe4f2de37e4e01ebf, 0x425d808ac9280761,
+	 0xed879d4eadf76c04, 0x111e8d5538650a2c, 0x6f6cc098ebfcc8b2, 0x397c042a2301c434,
+	 0x7de4b2a46f3d2f1b, 0x14ac6a15b8d4d9f8, 0x9e2edc8d379676ca, 0x93d8cadfc5ad8d47,
+	 0x7b3fb087873b5cad, 0x28bceee34dcf968f, 0x5b33f99edf35120d, 0x0ece8a85077f66bb,
+	 0x0352550ffb6ae4f9, 0xcca2078e7f9d5768, 0xaa30d1784a8cb31e, 0x5131bee0840c685f,
+	 0x2030bea4b5c93542, 0x894448b48d26ad59, 0x439284debd223e6b, 0x56d1d02dd29411ed,
+	 0x6d6bfb6a090c42ff, 0x851d7ffaaed64354, 0xcd397a1383fd3ed8, 0x463cd4f7a0756def,
+	 0x53e2822ce97e1ff7, 0x5c3b9084d824a952, 0x2b4235bb7b70d32e, 0x794b388cc8a4cfc9,
+	 0xd466647abd25757e, 0x5aa5f1293f048ee5, 0xd9acb633b9f9a856, 0x3eccc553a408c3f7,
+	 0xfd01ef7e7769843a, 0x703144801416bd43, 0x75ad5044e829fda3, 0x4990d3409ce63565,
+	 0x680b19ccdb1d95e8, 0x87396c33869c1781, 0x1872a5856c005c33, 0x6544103d225ff018,
+	 0x7c6e9e6315e68f46, 0x49687cd2000731f2, 0x7df50e8883b8179e, 0x56d300af601d57c3,
+	 0x8452c61788e7c3b8, 0x56f1b678a6aaef2c, 0x512a97e9300ae1cf, 0x76b4cd03faab0aee,
+	 0xe6443238a7b73695, 0x6ccbcadfa8dce51c, 0xb526a0440ba285c8, 0xa36e01450c03c335,
+	 0x840b67fa5cb44dfc, 0x4a2dafc71ab5aa06, 0x267ef91e60557873, 0x48433d4f15e63a35,
+	 0x24233f9546635c26, 0x025d243e79cb727d, 0xfb7054f23c95ff2c, 0x7857d7070a4c5350,
+	 0xc203eae860948602, 0x260efb8b451155c4, 0xfa9c876003cfbc52, 0x631f7ec974a3b85d,
+	 0x4c082143ab1a8e6a, 0x9bea29753d9246d4, 0x9e8924da46808914, 0x1b2a07c8d7310138,
+	 0xa109ebb57186149e, 0xfbf6e2213cfda2b1, 0xf32f52d53f99c21d, 0x28e85b66bf8c3907,
+	 0x1f60445e633797ec, 0x0f59068aa26b57cf, 0x641f1304ea624178, 0x4860f5c18fbd3f07,
+	 0x304ea31c7963c720, 0xbcf40640fdab4b51, 0xc16454d6a5d36988, 0x5189069ba600aea0,
+	 0x3b176e904747c1f6, 0x531f3efe9997caf7, 0x3c9405fc0e5e625f, 0xb1e51bbef8230671,
+	 0x355d5cf961999a5c, 0xfbf6b39ae10cff40, 0x75b0d5a720187c95, 0xb4b26bcd90d5ab09,
+	 0xb5fb6f171fdfbda7, 0x72b4081b68ad16e0, 0x5809e09ee85baef4, 0x0c46746131832712,
+	 0xc1682a52ac697cbf, 0x073680b120263dae, 0x97e4f76a4eee526f, 0x2e5d070f184adc27,
+	 0x52fc29a3e821478c, 0x1cd274f3c5a345d2, 0xe9253d609bae57f4, 0x766f226fbda3f520,
+	 0xd779618e85282578, 0x758314d86f22f17a, 0x3b50a65d53f49992, 0x4e6a8d84a8017b57,
+	 0xc2dba250ffbd2a66, 0x1f4c504f543ccc3e, 0x2fafe1fd41a62c73, 0x4ca7ce149b424f01,
+	 0xcf2ee4a01f52d15f, 0x02d79d4ec93f004e, 0x7d173f52cd921955, 0x04a6accfe64e2091,
+	 0x6cae5df1da5c9a08, 0x7684d7059db1ca7f, 0xcba56096703c5423, 0xabcbd90881971e5a,
+	 0xecc1c222bcb860ae, 0x222cb27aa65b56ad, 0x288c81d381d2685a, 0x8ff70b99a0cb9855,
+	 0x3dc57a442c19d61b, 0x67e9ee8bb10ad1f7, 0x604279b8a78fb63b, 0x45138060b1166fdb,
+	 0x0e6d02d80b928702, 0x674325836cc01492, 0x3fc5573a93fb7190, 0x08b9eb5b33773fd4,
+	 0xd9f9099a48dc0a29, 0xe7f171a59c1ecad6, 0x656f30580956f1c8, 0x8a22cac93309818b,
+	 0x280be62646afaf78, 0xce2dc1903c0f89eb, 0x7401a97bd9bec211, 0x19469f447fa77467,
+	 0x67969b0171c516a8, 0x01fe3c3e6b216bba, 0x5cb0dba71b557441, 0x790f0cd9ddb76679,
+	 0x2627b6ec263222e6, 0xb423c98f59ad989d, 0xacbb5880c9a391af, 0x6582daaaabdd56a8,
+	 0xc5f8d0f48d4d9bec, 0x0517e0c6087ad3ae, 0xb534e221060e4325, 0xa3b563bf11559f81,
+	 0xab92e3e65d64811d, 0x4296d5c2756d5269, 0x22afc362278c7d4f, 0x647ad8de90fbfdd5,
+	 0xc458f3d7c913b1e2, 0xdbe7a465b20bb5b7, 0xc71a448b60e7c313, 0x8f83ef2bcc2477a1,
+	 0x42d2c9bd4080cac3, 0x6d7cf84a59decce1, 0x3165cc0294481d5d, 0x09f1f014ff68c6d4,
+	 0xb783ce9493c8e5c5, 0x1d04791dd408848e, 0x60a2a6cffc99ab18, 0x69e05a5c76e5aedd,
+	 0xde8f02100586de19, 0x5ad4364ec9a072f1, 0xf1c02fadbe3a4ce2, 0x513a3c31c47cb73d,
+	 0xd9dd74162d1ae9dc, 0x1199850b1c88d7aa, 0x624d5662cb6971e0, 0x7adc432710f1176c,
+	 0x392a816caeecb1dd, 0xffdd465a9a681433, 0xbe836d8674c9c214, 0x1917e2b62c504dba,
+	 0x807ba14c209e46ce, 0x95767afb4cae78a6, 0xc4eb96eda61c9e1a, 0x925b88c3adb4728a,
+	 0x1baed827e004e1f7, 0x66a22bda9643fcfb, 0x0aea474e3662f5ca, 0x7e516f526e3c8ec4,
+	 0x3be661cdc4af8f72, 0xfedc0390171c27a6, 0xcee922be6e91b1f1, 0x97c8af9b8526577e,
+	 0x85f484a8a0596b73, 0x62ed4e440ff8b2e3, 0x2c5234819835be09, 0x31fedb81b8d90ddc,
+	 0xa9f5c1b18ae2e1d9, 0x799d24fab730f497, 0xa424b6199d2e4f9e, 0x9d7519bc44b67eb5,
+	 0x26991c673bd5508b, 0xe8e44d3eef04734d, 0x8c10de8d40592eb7, 0xaf426249c86527a7,
+	 0x1b40b4fc9984a7dc, 0x8737b2e9781dfa36, 0x1c0b216f1f3acabb, 0x6491bcb9f6e65975,
+	 0x39e34e0818aa8588, 0xc42b9f807b74eb82, 0x9b30b5760a1d2415, 0x2a823e4fc108b19a,
+	 0xd7d47ace695d2ab2, 0xd081c0f2ba05c778, 0xffcb5c978ab802ec, 0x8a83d3944d67f485,
+	 0x8fcebb83a5e81924, 0x617219567021b54c, 0x2392521d7a08eebd, 0x71a27798b0fbac5d,
+	 0xbed6c66be3d592ae, 0x3987b2554cfe251f, 0xca7816626f7f0922, 0x5dce8dec717139b4,
+	 0x0d75b88eb1b27478, 0x08cb4b3d76386625, 0x25fd55a27bfee711, 0x73358c21daa142e3,
+	 0xce44bbb4011c26f2, 0x4616af8a890f5190, 0x2de8b8c87ed00d12, 0x9979386fed01d4ff,
+	 0x42807fcc81b457f3, 0x03492e17b922a6b6, 0xa2fb74e7cd0b6d18, 0x35ac335ed430a69c,
+	 0x9376feeb60fce611, 0xeb6278bd5a9bcc21, 0x400770b85d40824a, 0x3dacbb8cf751de7c,
+	 0x3892d7c55cfb9988, 0x760eb1813c0bab75, 0x1654d96a135a83e0, 0xb40a6fb937490e45,
+	 0xd3f6d905626f7fac, 0x651be01607d1cbef, 0xda02d903e236fd4b, 0x50417ac5bb74bd54,
+	 0xacbfedb6c5c766c0, 0xcd3c5e64ed2d55dd, 0x4b97986e3c7699f6, 0x6e31bdd3a55a92ec,
+	 0xca40ba53269b5efd, 0x9d0c34dd6723f6c2, 0x9abd8650410ea2bc, 0x0e678b838ddf6e55,
+	 0xfd90494f4ccb218b, 0x80cd43ec0c9e3069, 0x57b6b7dbfd8d1c9a, 0x1537f8260333c89b,
+	 0xb346c9e011dc8a5c, 0xccd654d03e2053ab, 0xaf95d0d25c34490e, 0x776678085eace6a5,
+	 0xa2a7b729444ce499, 0x7605a9b47c6ab8bf, 0xbc0de2dc8fdbe824, 0x11d24f76fa32b22e,
+	 0x909925f9efe93623, 0x312efcb2eca2b605, 0x3235ff66044a8b04, 0x35848a173b76b3ab,
+	 0x75ab3d0432acc00c, 0x4087abba472b560a, 0x0329619b9f90b09c, 0x7993d344982280d4,
+	 0xb24e9dced5ad95cc, 0x063c95a0a29a7b8d, 0x8f9fe0455b8ab164, 0xabfe913fea4d7577,
+	 0xaa16f8ac5cac6649, 0x0a252a35a866e4e0, 0x6f7581af7614dfd4, 0x60d5eea1224132a1,
+	 0x675f7b6f893aab07, 0xd51285cb4c3ec56f, 0xa4e1d203c6cb37b1, 0x5c1662d8c6e50fcc,
+	 0x5855adb7def07410, 0x9a846658d1f1502b, 0xde92a282d45fd07d, 0xaf8dbb7f1bf052a9,
+	 0x74260dd4944d6432, 0xa69c54d6602593ab, 0x903bdb95271ad651, 0x1b69b18369a1b105,
+	 0xc91ec1e00dd876cc, 0x3d6a947720273c93, 0xa3229eb3cc2370b2, 0x65ccaceb3002e529,
+	 0x98578bef7b51dbb2, 0x5678bb5856607e84, 0x54e521ac943ca61c, 0x37ffbc36658bedb5,
+	 0x80cf391787f88a90, 0x389bc6d90939b586, 0xf70a42e6bdf32087, 0x91a9c4482c9b77e6,
+	 0x4c1a658299030105, 0xf7ef2df0e206feb5, 0x509d68a23adea1e9, 0xa4777a50f4bef325,
+	 0x68027306b464e46b, 0x37d03ad11ed71282, 0xb619978faed8f33a, 0x3be4e3418f7ed483,
+	 0x240fa46718e9b951, 0x35611881df3fc51a, 0xd05ca8a08153d0b1, 0x873e1c7f4e0fc61a,
+	 0x97dd3a786118f192, 0x57b9f1c9d2274443, 0x707f67357a0e3994, 0x423ce98ba234d369,
+	 0x6d0920a9ddb2b588, 0x7ad43753d4f962ce, 0x624b4be6ed026a54, 0x8d9943ec8db0468c,
+	 0xa9c73d6b2e81e758, 0x8c7c1b473a6bdb16, 0x7ad596094a062534, 0x3fd9c308ec73878b,
+	 0x25eef5179ccd688c, 0xcf5e03eb52d7bf91, 0xbec9fadebcd051c8, 0x10de39d6eae76c01,
+	 0x5926e8cee225cae5, 0x6e9c4f4a88debed9, 0xf6f6c8fd10466119, 0x6c65ddfa43070bdd,
+	 0x124e4f9f54d95f1c, 0xc8fb1462f04009a3, 0x0eb98acd0d1b6334, 0x2e5d68c35bb5eacc,
+	 0x0f4a6b2a2af12c44, 0x8351e028d545c424, 0x7f35e64865bf3074, 0x9ab5e6c025a89cc7,
+	 0xae1547e4f4b03121, 0xe80d3ba11504e335, 0x4c916583c0f7d563, 0xa12c24dc0b9b93dc,
+	 0xea589c05fccc0776, 0x11cb76451b5f8c35, 0xf2637cfea931a279, 0x28ea2a964c85f8a1,
+	 0xd9de46e101e3b93c, 0xb5536e5f3fdfdd63, 0xf64630d0e0622a0e, 0x4a90cbb8a28a29f5,
+	 0x243ada2b6d3ced2d, 0xfd4116057acb066e, 0x3fc45025e22ed3f6, 0xa1a02c4c6d48c51b,
+	 0x8f1624ed6a6a6394, 0x7a7b2597eb1f1bc4, 0x9b7e5d9accc931cf, 0x4fa24d686528261b,
+	 0x5d928ae6f7ba956b, 0xce6dd3121a1e0168, 0x45e7acced0186a3b, 0x75c957759cbde0de,
+	 0xdd612bf1541b15be, 0xbdbc1390b7a3e889, 0x2fd0d13588acd1c1, 0x9e29287b177d17ad,
+	 0x29b5e7b5db46f3e5, 0x589ba8257dc92744, 0x6b81c81f76d7cfaf, 0x572b302c727cb274,
+	 0x212a6ee581e09989, 0x6b3d8c275836bd30, 0x0ed36b78f92ae2d9, 0xa3a680ce0bc4cef2,
+	 0x551d71e669c07baa, 0xd0ba2f24039a77f4, 0xf3dd70e4ae7744df, 0xa05d3287984ed078,
+	 0x61580687dbbc018a, 0x573ee48e450561e9, 0x5dfde6771513293c, 0x5d66fd0bb8a8170c,
+	 0x9f9b6b1bdb587bd9, 0x5af9ac3f1390d8cb, 0x5ca68072a41e984b, 0x2a5ec73c3f0987b0,
+	 0x70ef6ffe2cbf786f, 0x9eb9fcfc00d90432, 0x7d324e5973998860, 0x7c26a502a9b33f9a,
+	 0xa9a1a8be45fefa14, 0xcf6aba165b2d2d1d, 0x270f07c927b1251c, 0x52245af8c5ca054d,
+	 0x71d840187d9fa633, 0x38cc9408f11edc1f, 0x162f2f53cb79badb, 0x734e17a98634c024,
+	 0x179d294b63d1bf97, 0xc4445bca102d543c, 0x17a303e5506621f4, 0x5bad4a57a63fd16c,
+	 0xb2f1cc18c66dfb84, 0xeaa21e5f8c77f451, 0x7ffcbcc38df040bb, 0x00247442f5ba605b,
+	 0x54e63e6701021756, 0x6b2c7a88f5438ebe, 0x81571888a8d0151b, 0x1d9b256e0ff21e5f,
+	 0xe2e9a7e532759fad, 0x054e6e1f7bd18983, 0xfc1bb07c542cefb1, 0x2b3467d783565684,
+	 0x926c2916ffeeafa8, 0xf3e596f81c5578b8, 0xdf490f8da4571bee, 0x6c35c900bb670c31,
+	 0x4295816e38da44c9, 0x57c5aa841cccf277, 0x09135d112a9d0c4c, 0x8a8a0396c4de8b7f,
+	 0x45af80dee5f5620b, 0x92761ecaa4d5fbe9, 0xb7d8a67abe3418d2, 0x02cabc83efa5ef0b,
+	 0xf489e865d05a337e, 0xc2850b761e63e4e1, 0x9ab7ff668eb8fbc5, 0x0ccd2fcc5505513a,
+	 0x3549ffc54c031f45, 0x545aba383ef542e0, 0x612c01d02b85ffd4, 0x09d93bcae8e0e560,
+	 0x4eb12c35fe53b96b, 0x4a62c1519ace8ed4, 0x01f35ad72a33631b, 0x268b287e3a9353b6,
+	 0x01ab384b7f386d98, 0xce40f94d1ab3980e, 0x89adb8f3713f8ca5, 0x9162c2351a891dd2,
+	 0x2555a77238b3d0d9, 0x6220798b55162858, 0x980d7d0544c2f12d, 0x18579b03dd6e71fd,
+	 0xc20220ca755a0743, 0xc1d2991fd90f7835, 0x197efffa3ddb38a9, 0x9734be69aed9d891,
+	 0x43ae4464d0f39dae, 0xae1c1817d81601b0, 0x4a2b7c0285d995b1, 0x5ccff119c9b6ac37,
+	 0x93bde0b0a547bbb0, 0x15695184acd0d354, 0x31d029176402054b, 0x46df11af8486b5df,
+	 0xedf90b3dd4206863, 0x1c79aff9f8236f2e, 0x9e6db0bd08f8f4a8, 0x7e69c4811df72c29,
+	 0x2fe93bac2383d9af, 0x16c3b8ff884fab58, 0x0d25f78ba1576d19, 0x3c557b6140f66346,
+	 0x5f7712b3c935ca62, 0x48f5c9c86b55952d, 0x77c1629591096c2b, 0x6118b225a7b05262,
+	 0x1a40d708d2e0e359, 0x20e0e85038444acf, 0xb02bcd09f37f397a, 0x5a17ebf92cd5351e,
+	 0x829e58820f715f68, 0x11e45093175a8714, 0x1de56357e39a5fce, 0x393a2a4dbe289ec2,
+	 0x8987102650b2599f, 0x84e0b31b1bb14d77, 0xaa4d7143b4ea3609, 0x60edf1dc8e3623af,
+	 0x709ce2663a5e345b, 0x516f79a9cf653154, 0xf930a26d155d2bb4, 0x91256c89190d88e0,
+	 0xb4fee3994def5e38, 0x934863dd646b2814, 0x26f51ea544938f8b, 0x92007f6692b774ac,
+	 0x34e56625d9d620c0, 0x682f715ec081971c, 0x1deb7ead091d4757, 0xb0355bde0c5f2913,
+	 0x5c88ee9b6b9514e1, 0x0ff66ce4f84ec3e4, 0x58ba06cd4fbcd018, 0x91720be0042ba1dc,
+	 0x1b1bb728702e5862, 0x0e756c5d7ff75d3f, 0x0e90d0f636c25a93, 0x3967dbbc49bcdbc4,
+	 0x91e03a2ada862cf9, 0x2eed80f216d04fc2, 0xbfc6c0b7b0601d44, 0xb08e72912f06c931,
+	 0x4b0f23aca0c83aa2, 0x1158b78af0a648e9, 0xcb9d02a2cc87a1c4, 0x0f84676bf7af2f27,
+	 0xfa9730c899c88272, 0x7a711602d18cfe50, 0x067375733db699dc, 0x7c3a6c5aacc26a8e,
+	 0x256278e7a5e7feaf, 0x80bc57ca9c8b4f08, 0x3ca425286e6e4c79, 0x92f9d3c7c578583a,
+	 0x75b80a8f64a2b389, 0x10ff74d1d03034b0, 0x647a38e9ba1bbaa7, 0x5b0ba2bc1d84e118,
+	 0x16f87c582efdd89c, 0x26644e3b9465863c, 0x77c5cc9fa97f18c0, 0x1bc657ad2d2c5c48,
+	 0x038b5afac5165942, 0xefce7c4fa91dfda1, 0x037102cb652c6c4d, 0xab2d5b496acb20ed,
+	 0x5fb5bc80ec07eee2, 0xda5bb30cad65fc8d, 0xab89e236b553c295, 0x0da7d01712acb58a,
+	 0xfdae4630039991f8, 0x33d87095622776f7, 0x4a79a56c3597a826, 0x1b61e769f0cf972e,
+	 0xbc015dd49e8c593e, 0x9ac01a12f647fc9e, 0xa4735c1825115b9d, 0x199877defbbe32da,
+	 0x5a890e97c8b2a972, 0xfb8e285433194d32, 0x58717a790e0cec2a, 0x71e4df02cd4b1eb3,
+	 0x0e1b20ab75e70789, 0x1dd1b1e976d9382c, 0x34f23ee32dddaa2f, 0x2ff816e0d9462441,
+	 0xca8b7b297a1010a9, 0xa02950e80e79ce9e, 0x5781c737113a6dad, 0x3f52cfc12a3c95c6,
+	 0x23b6950d470b4cc4, 0xdcb3de142d1df2ea, 0x2cb6cbcd3c0a4719, 0x5ce33dba7f07c030,
+	 0x29161cb272e2cd64, 0xa9941e692794c66e, 0x6d9884c993367748, 0x771c43eb161b4d53,
+	 0x6b400a217a9b4ba2, 0x3d1fc7649f4b83a3, 0xbd45d0fc6cdbfea7, 0x8b16a9bf9489aa0a,
+	 0x1cbd7d8714da4f86, 0x817e470a094ddcb4, 0x8612abf2ea194e1f, 0x2d0ac08ae73e9061,
+	 0x4d5c17cac225619e, 0x148041e05a129edc, 0x6c87699c3605496f, 0x5de5c309fad1ed70,
+	 0xad831fb1d2a958f0, 0xb53d83044d7670de, 0x6f38d32037215317, 0x227e7b76fe83aab8,
+	 0xc5116490e3e10078, 0x0375b9baaac7f580, 0x21dc235225348f2e, 0x132da0229bfd5663,
+	 0x88cf96b4ebfb5f7c, 0xc1ee1a029eabe766, 0x8c091398317d762e, 0x3c668f080e5732bf,
+	 0xe5a447dfc247aca7, 0x6d50d87034b9f8fe, 0xffd9d38bb54ce304, 0x0873555f223b78ce,
+	 0x3f25f042244594c0, 0x579899025978912c, 0x464b675d5febfbf8, 0x65f86663999b58a2,
+	 0xfc3a985c81310e77, 0xfedd114c4baaba68, 0x39012759f178ba97, 0x9f84487c6256715c,
+	 0x19ceda239a7ad792, 0x12ff6326df8b0f4b, 0x8c47896a42eb82ad, 0x4c7b71e745cdbc6e,
+	 0x2fcffae861933b8a, 0xf066fba144099559, 0xa86d4ca761bf770a, 0xa1ecf71d1f0273e0,
+	 0x78308cb98ed1c1fe, 0xf448ba5068bd28e3, 0x42ced8e8b7e2e1af, 0x8ecc95c9740c29fa,
+	 0xc2b325eed2e67825, 0x5b5ea963fe93fc46, 0x10c347dbbc0b6cf4, 0x29da1849331e79e6,
+	 0x228cc752670dc859, 0xb2e9f6b9adf5b992, 0x55e8579bd9126d7b, 0x745c5fb7a9a06ec8,
+	 0xe1ec1d73ad2e647f, 0x11a59c32570c1857, 0xe692d25e49df5781, 0x8018ecb44737304e,
+	 0xc55df2bc7ebe2fe5, 0x186bb823e11ecd85, 0x0bf2653aa1e7c94f, 0x874a8d1082d5b56c,
+	 0x2762010ade59a448, 0xb5a4447925ca87c2, 0x44652f169ab996e7, 0x18a599caba79a7e3,
+	 0xab89d0e721d7ea47, 0xdeafb0c3bcaa60b7, 0xf0ec1b55ebfa89c5, 0x7b09275fd88737f7,
+	 0xa82b7768e422bdf5, 0xb41ac26c09a2e0f3, 0x0092c4f30870f924, 0x71852a698d9b29b8,
+	 0x130a6cdce04a958f, 0x7bd0721b5c119fd0, 0xfc6e465ea8c49f37, 0x2eda0db35aa95f71,
+	 0x322757726bfc0bf9, 0x1892208c4331a260, 0xfdc8ecc525dc7f29, 0x05efab98edd207a0,
+	 0xfdb7161141c26cb0, 0x80fe488e60dc0f94, 0x5881e264b5e527e2, 0x365e65a89b0b6e24,
+	 0x28c37c9d3ff818de, 0xf206ecbabc94a5f6, 0xd291abc6015811d4, 0x73c3201309a3488b,
+	 0x091357c726b7e0a8, 0x5bbbc63e808290fc, 0x2e2cfe2fb806f904, 0x59228f616da65587,
+	 0xb7c1d6a92be6a63f, 0x74c140bb38b3238c, 0x24d0724f3fce37d0, 0x8593a4b79004bf8c,
+	 0x10ea8e3734850979, 0x0dc50e9ec2076859, 0x0096f13ee8ef7ad1, 0x899680fa292f6bc0,
+	 0x73ef4ab7423de8a2, 0xa21a2bbb7e15b5eb, 0x5d14ffdc96df1cc6, 0x5779b4c1eced5dce,
+	 0x6f7e70db404196ab, 0x4d2a06362c7feacf, 0x03ec433f66b1d797, 0x2b03fc6c5ea80a9c,
+	 0xd02cd9b561d793ec, 0xfe4ce295fcc1f583, 0x93c84d26450b7657, 0x51cf8397cc3007cf,
+	 0x735c74c034de2af8, 0xe2a29569ec5f357a, 0x5c1c4cd6d236cec3, 0x1a266a4069f2950d,
+	 0x44ab56865eadc196, 0x421ea32986ac59dc, 0xa8b5e1e6146883d1, 0x521659367897006d,
+	 0x718444962492ad60, 0xf1190f4f6e7ad544, 0x7fe0de6dc1fadb5a, 0x510cf5f128410370,
+	 0xe9a4320d47c07f28, 0xe3d7a9203d50c863, 0xddf93aa653e3e22e, 0x6307f9764593fa6c,
+	 0xbeb7700f90acfdf3, 0x38502ac3128990ce, 0xedf66707246af8a5, 0x767fe53cf43347e6,
+	 0x347ce0cfa73caf45, 0xcee3cc4d8b6cdeee, 0x4f57235820ee86a0, 0x2ba266c53fde203e,
+	 0x9657bc20fe9f977a, 0xda6b285096c4ca48, 0x2a81218fa1a18dd1, 0x50229a890f0caf3a,
+	 0x3db9b6c773dfa57d, 0xac90a46d102116d6, 0xf248ded187e3569c, 0x120dec122ebefd94,
+	 0x355046e52b313298, 0x71267c784bd3a281, 0xe0090408b621feb8, 0xb41f1d40ef938414,
+	 0x6bab6efd54ae70c3, 0xc37f291316f38af4, 0x12a7e7a1f4faa0e1, 0xafffb15c39a6bf10,
+	 0xb6ccb46c06939785, 0xb64fe513e2d408bd, 0xe94c544de5405c76, 0x4b3f2ac814653b85,
+	 0x83fc4bc6c5d69fa8, 0x94dead30d2e2138e, 0x0541441db77bb0e2, 0x4f86cfa13610e9dc,
+	 0xb915ea679a799a9f, 0xaf61c26089539a56, 0x3f49079416e86627, 0x5f0c68892c9c342c,
+	 0xaa36aef14666f3c5, 0xa448c3938fe18814, 0x148d41d3a72c587b, 0xa37679b4c2517dac,
+	 0x92d99e5f6a6b264f, 0x9cb6e4c0e8a8fc89, 0xf77701468e4fb681, 0x9334352568771497,
+	 0xe08cdc20fd6e6252, 0x5354bf1661743361, 0xd8682344df5a479b, 0x328574bb9cce1d2c,
+	 0x123b04034d122056, 0x8dee76e5829006a5, 0xf7247fe5a4598d8d, 0xb60ed776fe09952e,
+	 0x149888a29c47ec95, 0x728a842848f077a2, 0xa8cc887eee40638b, 0x2f2e370225111f40,
+	 0x3b2aeb7081d33ed1, 0x769af3b034b65137, 0x541a0962253aaaa5, 0x429bcfd1c25f06a7,
+	 0xdcca5efddd75ae6a, 0xe54e5775eb7c4569, 0x36fdd242da6458f3, 0x0fc5e755dfe041ac,
+	 0x9c46d7f56d897336, 0x3d9e527ac84bdcf5, 0xb9c8b45fefbfa108, 0xa573eed858c1eabe,
+	 0x4ebc746aca689368, 0xdc3f1d82c4351cb7, 0xc7bd4ceb20c2e138, 0x5a4f1c466d7f8355,
+	 0x3e2a48854d8c9343, 0x509c9e3362f6eb44, 0x08cde34517e2b253, 0x518d6d95fb8eaff3,
+	 0xdeedac686da23209, 0x11b450bfc953d9fa, 0x4de57a2ecee71c7d, 0x3a39cbb177780a0e,
+	 0x1e4fd128f0751c6c, 0x57039ba6fb3914a5, 0x29ca6a2199c14628, 0x456e32d05c6ebebf,
+	 0x28c9de5eaeeed46b, 0x6ff75ac434860710, 0x7159776a13d73b32, 0x9b26c924b29b723b,
+	 0x8ff86d74614ea647, 0x9bd1fea790956323, 0x36f3d48124f7c911, 0x722c341777923626,
+	 0xaf903c13aec752f6, 0x74c026b8c8554e88, 0x48c8c1eceffc81f3, 0x412f57d67df5f1e6,
+	 0x52801289d06a2921, 0x48a88b97107969b5, 0x2ecff9c86fab829f, 0x1f2e7290c1b10ea0,
+	 0x2a5c60593f15db00, 0x68ac8c7df36da416, 0x8e0332178f7b956c, 0x3a43274be467b076,
+	 0xab6e6f0044b49c35, 0x6b3e2ec28eb2b690, 0xccfee5b4952f6fdc, 0x395aa5c0b888ea2a,
+	 0xde06a505b85332cb, 0xbc5a27810ffdf389, 0x99e4cc88fdabd22c, 0x4bc9d8933f5c38f8,
+	 0x6279dc81bdf7c02f, 0x4f05ba842aa4630f, 0x5a68c30638e93d53, 0x7cae1e025fa4c46d,
+	 0x0bbc2ead9e2cdce7, 0x21fe9767e41bf7a3, 0x050c6a07ed45bec9, 0x935e0c597766ac61,
+	 0x7620b3a726f35f24, 0x8d1830f29aa1505d, 0x6838c446b8ab3a3a, 0x6ac5a625b3fda31b,
+	},
+	{
+	 0x0ac009e6e11f4f2e, 0x35986fc96d26b8d0, 0xfaa799368f7fac92, 0xa20861d3453fd39a,
+	 0x187507ff767bab5e, 0x6487ffe31be2530c, 0xd68e5b82e915dea7, 0xb221c74041de1689,
+	 0x0b2bfe8a7a1358b4, 0xa3df4c144fa36d6a, 0x5d17997f35115a1e, 0x7e5f959c5d55f69e,
+	 0xaf0cacae0f833e21, 0x9299911596d8b782, 0xf705e06e4162d016, 0x2653f2c77efa8a80,
+	 0x7b3acd94b5140626, 0x3e1ae8cb6c7bd969, 0x86c80481e7edfd5a, 0x72b449afdbcd3d5e,
+	 0x49f66a16fb0d7b6a, 0x019541f23378c0ed, 0x5a89434b650d064e, 0x37408c3d833e9bb0,
+	 0xaa8ef8b3ef9cfbac, 0xb49a191cda380690, 0x34f5709da54c0fce, 0x696f8ec9cb3b0711,
+	 0x41556c40049d79f0, 0x132026eec00c8ea0, 0x26e143a940c0cb22, 0x44d445b6da2a59cf,
+	 0x43f53e70fa77f8df, 0x3b4c14b3e14ab027, 0xc39096622a2fc018, 0x72b305ba1fa42f5e,
+	 0xb65107d0b7bb3a72, 0x8e2b3dbf0250d26f, 0x4c5ca4856fb00314, 0x83b6900a9395aa31,
+	 0xae82d9b754d3709e, 0xcd83a30bc8e82be8, 0x1c57ab758929a7a2, 0x7b6e47f692bbc007,
+	 0x3dccc0aa776a81b1, 0xad4fb7d9eefb0de5, 0x622b72a3f98452ab, 0x8223eb4f423a23aa,
+	 0x2b2685d01f664528, 0x5024838f70f0b0f6, 0xc303b7bcaae96f04, 0x7f2a4b9eb2ee5b9e,
+	 0x1ecf735bb002cd18, 0xa675b8ce4a30ffee, 0x1eab3831ed037b5b, 0x9995c8dc3633929a,
+	 0x4c6e0cbc21525ebb, 0x82efcc2467baf407, 0xfa9c443072cbcbbc, 0x0186a8059dcb93c5,
+	 0x51140c4302949336, 0x224b2c67570afc2b, 0x972413878cf4e026, 0x7b98844242b073ed,
+	 0xab8ec0054537b207, 0x4cce0dfe9aad2fee, 0x203307f885526db2, 0x25775ddb0b506735,
+	 0xb9b518c3c41681a5, 0x606358034dc987fa, 0x8ef0dbbd520060b5, 0x45915d65ddbf842e,
+	 0xd9a5ec1439ca1f33, 0xef3f5399b568abc2, 0xcf73ddef09a70e06, 0x0c5f7972d7b80ebd,
+	 0x241fac3ef92e3d35, 0xa98bd4e03bb9f2bb, 0xaa2b2eceb0bc19eb, 0x063c07de064622d5,
+	 0x4da33d207e9e4738, 0x28783069ec07cf1a, 0x6260006e2f4ea573, 0x5d54fe383e9b553c,
+	 0x2e4dc08511ca9bcf, 0x2a28ec8e8b2e1a10, 0x93bd3f57416ae041, 0x8ca5910dc3345a13,
+	 0x6d32c7ae8a4c00a5, 0x1572337c4a6e7066, 0x076170fcfb24d1a1, 0x7649f69db80c8ab6,
+	 0x5c5fa71832955eb5, 0x18adec1e2dacd18e, 0xa5495c3e7b20f8ca, 0x89ce637a0de5f8cb,
+	 0x3697cc5517cf59db, 0x6c3c5c7b5de9839d, 0x0e3800c06c7518a1, 0x18322cdb435efedf,
+	 0x8e37d2a222ba9f57, 0xa519109ba44fe24a, 0x5a32cfe8cf94c81a, 0x7667ffcf2f692e7e,
+	 0x49ce7a65a84992f4, 0xfe5b3f5f782a46b5, 0xd423c5c26a47de7a, 0x25395df787e6e409,
+	 0x5a1f4d2763296320, 0xd2b8ade8c477c38b, 0x8c22a313534742b8, 0x2335c595ffec39be,
+	 0xfd143992d91c7fe6, 0x0febca51627983d5, 0x2afa92ee58902ca3, 0x3e36e94c08d19fa6,
+	 0x9a3d2e11c600b4db, 0x0333a6c8e0e8ac77, 0x8d6c85825e4954bb, 0x03a8f588695df147,
+	 0xf1cfa8fbbb718fa2, 0x899faea8d16ca7fa, 0x86740f2afd956e3c, 0x45313162374925fb,
+	 0xdc34caa359900476, 0xa036a4399206028d, 0x5e92eed12a1d95fc, 0xab652ba3c6a31e86,
+	 0xd2566c0358e74826, 0x183a3703a4f0598c, 0x2aa05fa422b84528, 0x0c1f187bdce4225a,
+	 0x29a13b6dfd401d9c, 0x9ed7bf68926edaf0, 0xb2ef2049f82ed9ce, 0x9f6561fa599124e0,
+	 0x7b94b360c17d548f, 0x650c195e677d7288, 0x261b56fd459b188c, 0x369d053bfbc272aa,
+	 0xe59316c179215b59, 0x1908facc25be8bf3, 0x7cb442d840ce1ecf, 0x591592c489ccf2b5,
+	 0xd070102c7eb2729f, 0xc97d642de6c1fb77, 0xa811544752eca66a, 0x3570f67c30c86abe,
+	 0xc3149341c24d2b93, 0x2d7296e4bfe36a45, 0x3a2a99bb8b6a94a0, 0x5c77e80ee4c08034,
+	 0x490da343cbb2011e, 0xa8bb35cfe3fe34c7, 0x50c74687bf440c86, 0x534e113c39e8ddd6,
+	 0x7cd088cb66fe86f8, 0x25660f4617170a8e, 0x490fb51f69ce4408, 0x4d335e42c6d125ca,
+	 0x200d819eb77e102d, 0xe71ba0e2bea2ca2a, 0xb419c1fe1917f9a6, 0x2c3947a52bfe6126,
+	 0x6f7e16a95124ec17, 0x2544525fad3fa538, 0xa817e1b693799dfb, 0x6befae0b9e91b268,
+	 0xf6825ebfd31a6224, 0x4ae6e0a5a477d5df, 0xfaac2bef25bd6f06, 0x5b9266e6a9528eb5,
+	 0x7ac9eab8e45258d4, 0x279cb8ac3082bf67, 0x9e643eeb064e1b7e, 0x7a7d12f768e822a3,
+	 0x24fae7fed78023d0, 0xdca05eaea44cbf42, 0xea07b608130044ea, 0x072ae10bc740799a,
+	 0x7fbc013e4aa8c827, 0xde649f35cafb12a8, 0x4784cd231fe4aa77, 0x8cf4aec275f0c6b5,
+	 0x4ebaec3493433851, 0x331d082e80180556, 0xc04378f7f73e5314, 0x2d9dd4904c3f997d,
+	 0x41da0b2a812fad99, 0x57ae6ade25423319, 0xf6b6590c7beae3ab, 0x8e12fb8e179ab51a,
+	 0x145ba00a5dca70fe, 0x72d4303a688fd720, 0xdc582ce2edc63a1f, 0x1cb418bff1714fb4,
+	 0x9798cb12f34162fa, 0xbf9b6efc5704b9e6, 0x667247d98dc3c286, 0x1e7c89d075a27881,
+	 0xebf3bb8fd748ed4c, 0x2ceebee7640b686b, 0x974e2365e9b837b1, 0x6e4de7e403b9508e,
+	 0xa00fca787985c9e4, 0x1457622c5b80fe8e, 0x98805d6663601faa, 0x131375c819f9b146,
+	 0x8b921adf585b0f9a, 0xb8f5d41358a57722, 0x4becd2aba379a106, 0x92dd979b65d17d5f,
+	 0xd0e2484661334ca8, 0x620128f9cc16b4de, 0x807a609b09b6e7bd, 0xa67c05760d0b2a95,
+	 0xf294a47bcb9cf991, 0x9ab8d9a2a5d829e2, 0x8550f0ab215ddd99, 0x400bce7f88bb45b0,
+	 0x1400681c22eb5871, 0xa55c83c75268c56b, 0xdc3df75ce0ee7062, 0x551fc94c0d7c7c6e,
+	 0xf480750fb115cff2, 0xd9648a8888fd5ce6, 0x1b5bada4f1bd6a00, 0x4cf844cdc600ed87,
+	 0x846db30272834d35, 0x731c1e4fec52db6a, 0x3f0d8fa266d0531a, 0x8f46730d47ca2e96,
+	 0x9f0e95df95880af2, 0x21d18a806166a10c, 0xbff989af9ecb99fe, 0x3ea36ea1083703d9,
+	 0x08323962243b872f, 0x645d79c0fdd37a21, 0x3f908f2046d3cd23, 0x294ef320c99e0604,
+	 0x72ba2ca35df5c480, 0x9e6f215f6fa764c2, 0xcdd811e83a92d943, 0xa6e33069f4e1138c,
+	 0x54a715d7520d62cc, 0xfc5df29eeedac426, 0x4abd2b9b93c1221d, 0x3a1fbe962fb83443,
+	 0xf68a70901ebab1da, 0x6bcfa2651722c6c9, 0x6cc001300bb8577e, 0x9b3b28f051a1d134,
+	 0x0c6453281ef186dd, 0x1c4523cb3e9b4cd0, 0xa726be10be52c376, 0x791cfea85f4e5279,
+	 0x6490f5b8292d696e, 0xa5e0e38727044074, 0x0f001d5b9fc81acb, 0xa9510c355d2f9613,
+	 0x7bcbf90f713e3fde, 0x11f4de7b64ddbf5b, 0x047c504e101c568b, 0x67d4129298f5ca1c,
+	 0x962e313f7f61cbf2, 0x3d157b840484fd02, 0x365ceaa1673e14d3, 0x35e5789fefe377d2,
+	 0x90b224c7ccf2b149, 0x95ba44d08e0236c0, 0xe4a9b41628960d4a, 0x0033a4dbf0c2b24d,
+	 0x5016f064790a6145, 0x1dec584c9b7b7f69, 0x060d7b2f7440e1b0, 0x15e993e8269e137f,
+	 0x6547c793ded6cf2e, 0x1652e03a4c7291e6, 0x1761bbbd18f7937d, 0x7540ebf61fe5cf63,
+	 0xf7acdafaffe4c71e, 0x314d21fb573c786f, 0xee49ec02c021c05b, 0x3a67b483d63b2b1c,
+	 0x23ba385f0e512233, 0x4b655676e78dd91d, 0x698d096dbdc6123a, 0x90fc85fc95225122,
+	 0xe0125f4c5dcd7d10, 0x737b0a4a456da5f1, 0xa9be1370f70c723e, 0xa33d9412f3126eb1,
+	 0xa93478df1c50cb0b, 0x8261a9523966571a, 0xc562dc5df1371f0c, 0x05772dc3b1b1d878,
+	 0x4546c6396a94ca46, 0xa319b1261388f864, 0x61788a406d22236a, 0xa616dfc3805bd560,
+	 0x0e3cc02f1dc62388, 0x9a12803d0a445f86, 0xaddf06420b392e7f, 0xb2522182c9c9d152,
+	 0x9fa460cdf59c7ad7, 0x79424da9ba1f29a1, 0x5c25406715d50eee, 0x6eb854f65da929cf,
+	 0x264fea997c1ddfeb, 0xb92580c24a4aa85f, 0x384ed7856b6d8df9, 0x0ed26adc9bd05009,
+	 0xaf9b0787660eeda9, 0xf9b325fd512e7a41, 0x71b7a79a336b9623, 0x84bb00c8c7dc0eca,
+	 0x5826c620007bdc13, 0x987352c1f06ca818, 0xd3a9af18999d2d9f, 0x6766bd554e8de7de,
+	 0xc16d7b29787db6e5, 0xbf34c02454ec10e8, 0x92d62ab46cc31fcd, 0x4f2e1dbee15d51f3,
+	 0x69596945755ffcd5, 0x8c7af5cc6f8c3f77, 0x37048f0b9f080175, 0xa690f8c2aa933870,
+	 0x61155622fe393ce6, 0x974c2725d4ce5734, 0xdffe4ffbce70a8fa, 0x645d8664c44404e6,
+	 0x95f7ded7e9447aef, 0x1b0522263c536426, 0x8afb01213b1cbbbd, 0x3909b52f5e5000ec,
+	 0x97dd72a3e1940799, 0x4d7346367f338ac0, 0x0d188c8063263e1b, 0x18f58a871746a1b3,
+	 0x25cacf4c76caf9f1, 0x28d5e5f1359f5b05, 0x2b192f244304d850, 0x40235926a02c21cd,
+	 0x720c1a439a94e17f, 0x6c87628ea1f6e8e6, 0xfe693d606619a843, 0x016d761514647bb5,
+	 0x1f075c544ca8c03a, 0x82f8199ad8f1035f, 0xf5d8934a331afa77, 0x37c9b26f9701fd5d,
+	 0x1ef9f03b5735569a, 0x5b7bc48aa40d1cbc, 0x4b741f15a2d16f67, 0x4b66429af2cfd144,
+	 0x0cc748b686c0453c, 0x8b2c865d688db5c0, 0xa0158cb386ee8b73, 0x2ec3521490d0527b,
+	 0x6cec6d91cdfd3264, 0x85c14212dc754592, 0x94fc2d8baa0e3a3d, 0x468a06c5cf0fd16d,
+	 0xe41848125f987cd6, 0x1ef99a5f1de5f82b, 0x667fd7aae5762f38, 0x8037b360daddcfd9,
+	 0xceb2f23e9cf6bb9b, 0x77e374d7233ddcbc, 0xd5c5cec9094d5725, 0x98a06994ba0d8d85,
+	 0x953ff7b933ee8f71, 0x97a44929e7af3581, 0x0586b830c2ec4865, 0x46c94770d7431786,
+	 0xf5f0f6128c407ad3, 0xb818c3cec7989399, 0xf97818b22320f080, 0x72a3a3dc53175622,
+	 0xf43e8957a773fc67, 0x7b6461495e4eb5c7, 0x38c0b2d8fc719a62, 0x79ac8ee6c290cadc,
+	 0xc3b4c2ba2d3cd0a7, 0x3c77a8498412daf5, 0x28f69e6b77e1b7fc, 0x9096f213a8c45949,
+	 0x8f44338517b6bb7d, 0x8ef98b8fae250df3, 0x27531fb4a31d1513, 0x283aab8e5cad0eca,
+	 0x216de1d3889e6f72, 0x49b571305ebf1028, 0x22d64ff8e748c8b3, 0x315e30336504b223,
+	 0xa13bd4cabc4312f8, 0x11a7c2714e7d65e6, 0x51b19d8c49c3b2ee, 0x2d931105827b8c3f,
+	 0xd114d7b9557f3709, 0x5b6f9a233bbee114, 0xb122bb9cb329d7f1, 0x949a813586c51ffe,
+	 0x07714a936d545f40, 0xf50e2a0c2e9edb8d, 0xd300e1687933dfc7, 0x7b6fd3eaf92b8f74,
+	 0x68eb6ccebbc56984, 0xd8574a47db4c74fa, 0xffa09c77a8c00165, 0x090aec6bfa4f3307,
+	 0xd2825e462311711b, 0x32c265b1b6afef98, 0x1f09c1242dcc3d1c, 0x6ab413af43ec350f,
+	 0xbbecea985bbfe39c, 0x9d549fafa7efa057, 0x9031dbd2219cbcc9, 0x4123aac1b54bfc8a,
+	 0x99b6967beb250ddc, 0xeeb920986a9d67ec, 0xde466ed3dace89d7, 0x2717aef2a1be2ff4,
+	 0x59720118c52d4381, 0x51549f0a0261555d, 0x25b4a7e8a01a7253, 0x9a7261d021b07bb3,
+	 0xe12503869f80f9ff, 0x02cb3ba444d2d24d, 0x751324bbc371f0ac, 0x980000e4119a2f51,
+	 0x717683d371900821, 0x0f491a3c41bb8ff0, 0x6672ba7edc880053, 0x89997d4585fcd968,
+	 0xca1488801714fbb3, 0xb71100ded2c20a54, 0x72293270e529a297, 0x9d86a07839e4963f,
+	 0x27f73764751445fb, 0x56af56462148a57a, 0xd6236136637654d7, 0xb5e9560ed2c345dc,
+	 0xf29f1db1e838a19d, 0x016ec666424f4373, 0x608b93f3fa5581d2, 0x8a702fb7dd69c908,
+	 0x34db02b7f86aa4c0, 0x80eae56b93cf2738, 0x497fb747b4c2ec0a, 0x1550d08390aa5ee0,
+	 0x554c7b4b05583988, 0x20731893e9489c62, 0x698cdec3e2e0485a, 0x075754d22d3bf61e,
+	 0x6976e005c2715857, 0x48d89452ad92e10b, 0x59e4b5cdc39688b1, 0x2f679dd2b68e6faa,
+	 0x389b7d2dd37ebc86, 0xfb12caa656173cae, 0x7b0a6e7390ebf5d1, 0xb5472cb2842e5245,
+	 0x1d8f4f83381668a7, 0x75167b2de38864ff, 0xb150d7ee3d7fcbe2, 0x06b4179f54c1cff7,
+	 0xc63f179cd4570cb1, 0x9ba9469d15dabff6, 0xfa6faf809f348eb6, 0xb37675557dddb3d1,
+	 0xcd14ce7afc7733db, 0xf05b7868c83eb6f0, 0x845ba76843dbb14e, 0x48792fa1f06920b7,
+	 0x01a98c8115a3a729, 0x908a78ca018c2e65, 0x753b28e8c8604568, 0xafd1c8347de283b5,
+	 0x1aeec3092c35b83b, 0x842a9e4f20362a5e, 0x1f34868e874f91da, 0x1571c3ea4b129042,
+	 0x96ecf8126b4720cb, 0x758be2e88a5ac204, 0x62b6acc6fa976186, 0xacdfa7df658c35ca,
+	 0xf3e15804cbfeb9a7, 0xa0e170195333b68a, 0x1f75b86b28fca690, 0x4148f3d044ffdd65,
+	 0x2e879b2451a74f83, 0x7ef319d77854d30c, 0xfba54f208749bbf6, 0xa837b74dbafec31a,
+	 0x5981c95c2c4fd37a, 0x638754ccf20cec98, 0xc74a274ebadd84b6, 0x2ebbc7db14f76789,
+	 0x9085f295e2fb4c96, 0xe9e462bd4b2b1ef5, 0xdee4bf2e0aa1415a, 0x3c9e26b4d83fa052,
+	 0xf32d51dee787c77e, 0x29a65e04b2a005d6, 0xa64fae5f90f67541, 0x0c7922197a2b9273,
+	 0xd8f36830bc0becb4, 0xc10db77ddf1f189a, 0xf9cfa28afa7efecc, 0xa6023b2b9a02d16b,
+	 0x3f5e08c03226174f, 0x81679371a0fe0f77, 0x3a101d2d66b0a34a, 0x376472e6c35a81c1,
+	 0x4a67e5968f628675, 0xb87162f7e065c2d9, 0x6e425a932dce9276, 0x534c62282d621a99,
+	 0xba90e51b676f836f, 0xa2386980fcb6533d, 0x57cda8a64a8af5e5, 0x60c51b64449f43f0,
+	 0x04fd6a8dbef36cab, 0x4ea599fe9264cf35, 0xfc0c72c8c2bea71e, 0x45b0059e3b848848,
+	 0x2a1020308b8fd015, 0xf8186854c0fbfb85, 0x05fe70c04572c6e3, 0x2cc05a111b5bed98,
+	 0x05fd43778ccf320b, 0xf5dd54cc55b214dc, 0x0d2c74f16f0a512e, 0x60a868f5403fa2cb,
+	 0x6ca99f6e06ee51a6, 0x47956adafb55e27f, 0xa1e174233947a88d, 0x33d26da63ef35afd,
+	 0x044f70e208739c86, 0x5c35babd62c8449e, 0x5ad6af91303089ea, 0xabe6356de60d286c,
+	 0x7d31b0156b380879, 0x598fa75fcc2b2406, 0x8e2ec217c3df6799, 0x32716b15fc38073c,
+	 0x1a13b4de36a844fd, 0x18265bd1b9602fd5, 0x8a7d8f03d519d8ce, 0x8611ab2066b77fb7,
+	 0xfa4544a6f6a2f3f8, 0xcbb172db75f405cb, 0xb1742728e49ed667, 0x6ef690eb88a3b264,
+	 0x33d2fccf4def7ee5, 0xbab9df6a5d385fd6, 0x1161eecc97db25c0, 0x1068ea8c8e573af9,
+	 0x18e7a668a24ae46e, 0x7a1406467326804a, 0xa3a31c9486dff031, 0x4b6a014af5e1dc70,
+	 0x1a43b65c78636b90, 0x198260c1cb1a19c0, 0xe19bc81fcf3af50c, 0x07b98950e3221d0f,
+	 0xa9aa101fee8b735a, 0xfd0aeb3e8652b7e5, 0x6c334a9e26f4c8db, 0x0c3f9cce7f0f1c92,
+	 0x269edf1dc4834a4e, 0xf2f1b1f6551a2795, 0xa3c8017b23bac2c2, 0x5db9a5fb643c1cb8,
+	 0xb5972aedd524de35, 0x32f50e883c8deb0b, 0x6d3dbda79ac1f152, 0x3ecdb3891e8ea7af,
+	 0x65d38380f3bc25ca, 0xbe65c0221d9fe136, 0x40af8b7cfadc1c1a, 0x92175ac244049502,
+	 0x5c225e6f7b4669c8, 0x326dc9711813f331, 0x65d76e8c9ea14681, 0x03c12258b97bfb7f,
+	 0xd472bb695f0c7c57, 0xc7787cd2a1c95f39, 0xb3426cabb5374740, 0x81a0201b32eb3114,
+	 0xdff968eba9304c13, 0x05ea5c2fd08bbb64, 0x3342ed366dfd4aa6, 0x325239d85c5b23df,
+	 0x0891322dbf980614, 0x5e2c38d4724f5105, 0xe91009c60cae4a02, 0xb45005a8d3b7397a,
+	 0x1ab6c2101c3b2898, 0x3def2519c9b62eec, 0xb08b47e4b330dfe7, 0x822bae775d65e461,
+	 0x01d404b01cc06767, 0x6701fc49811bb691, 0xd8871afb0a16dd04, 0x95b3362715819cd8,
+	 0x45aa1898809f3da5, 0x2b90186ecba2a928, 0xbc1f0f19ec76120b, 0x4c645ecaea5d247d,
+	 0xcdc2fa21dfd16d9b, 0x63c7cb3ce0947e27, 0xbd3c78e13bfb3ad8, 0x94254e08f714d4ea,
+	 0xf6ca8f67bb7bc44c, 0x0ce35a4aa52d4608, 0x1d255dad1dcc5388, 0x2781e038c28fcd53,
+	 0x98378659ee1de4b8, 0xc75e86f2bb219e94, 0x62b2178c410cd14f, 0x3467c5c2aeaa577f,
+	 0xba8c2537dc2e6ca2, 0xb1c23c252f802e76, 0xf86d896ac9eba865, 0x1dad5ed6b294a92d,
+	 0x93c8aeab9a60e82d, 0x9d573c2fdeab766f, 0x40bcb0820ee12832, 0xaeecdd81c64602db,
+	 0xe9219e35df5f2a9c, 0x8b15969a3bef4007, 0x108fe5e56d347ca6, 0x0fab2d68f95a4a11,
+	 0xd82e9e2edea3db6f, 0xd8f553cd8ba9d7da, 0xcf59f87132ae4204, 0x18f9d604e78a6101,
+	 0x3a12a55d525d655c, 0xd4cbe87f40b18b65, 0x7903db6c18b2c491, 0x315df8eec82749de,
+	 0x56e28b7b39fc13d4, 0x93822d0260f69771, 0xf30c0b63852ae9c1, 0x78e10ba2fc3a3ea2,
+	 0xc11aae404ab69d84, 0xcddcde4f4cf8ba39, 0x7767a492d70f895e, 0xa3bbfb27ffe2c771,
+	 0x79a2a2c37ed48040, 0xf2329fed21f900dd, 0xd147a3897aabefc5, 0x32995934b9c5b1c5,
+	 0x4caaa9fbe1b34644, 0xe7e4445da8841257, 0x0d424533e5d36c2d, 0x65c3a09611a3546e,
+	 0x2b66b0bcad983c9a, 0x78c6b78f710ddfb4, 0x5521219a13fde475, 0x31f168068cf24c6f,
+	 0x9b9342a520349914, 0x0915ed4ebe327e32, 0xeada15830dafc077, 0xb322311e5444fbcb,
+	 0x3f0927483b53034a, 0xe8fa966aec94fe05, 0x3b1dde364f922f9a, 0x712cdf4ff24d347a,
+	 0xceb7d245d6c05fd2, 0x9993c65e40a1bd0c, 0x9a9ad51f20416cbb, 0x20cc9eced10e780e,
+	 0xc009c6b73653fcd0, 0x13eb066ca6432621, 0x65d3dca5a70ea60a, 0x73dced013fe3dddb,
+	 0x2f0604eac34e4f1d, 0x64aec44199e99ef1, 0xa16b9f92f61dde8e, 0x7e16a41980eb971c,
+	 0xdd238e051176339f, 0x6e376b1259cf7131, 0x6241f540bf1de357, 0x88c90f6be8e042f5,
+	 0xeb383772aff92b0a, 0xb13c34e007eeec18, 0x5af53abc91fe602f, 0x80275903071fdbf5,
+	 0x960c5d8097d764d5, 0x454901ca393996f6, 0x3326617104b214f0, 0x2f49ebc6546e5c05,
+	 0xcec50969b5a19318, 0xcb984304a01adb32, 0xd051d1135658ff1d, 0x3f681539c6483520,
+	 0x55c01d03e809f781, 0x7ba132e225653161, 0x194b26650d8935a9, 0x5a25241ddb5f8c01,
+	 0x69032222c4faa536, 0x3312e520f0a71727, 0xfb5dd59f9c5e272a, 0x5fe2dc0e8a6f4005,
+	 0x8460d0c8b15035fa, 0x60ec2899bd3e9a61, 0xed374c9dd3b440d1, 0x6bc1decb8fd41711,
+	 0x6d3792b36b98bb30, 0xd482a8dcb1e23925, 0x3093f334941df611, 0x9ed0298a3cb60fa8,
+	 0xbc839f1529203865, 0x589118be7959c7e2, 0xa1d9e6cac358fb00, 0x52cb17500539b7b3,
+	 0xd71820034e670531, 0xe6fafb24960cd224, 0x5d6c6019bb4233fa, 0x3a5f8c129e756ffc,
+	 0xc07d8bc8ee50d7dd, 0x8a1ef1b0d882e90e, 0xd7569813f19dbe81, 0x0033c20c384bd53f,
+	 0xe8548e207b6efd28, 0xed847abfceefdd7b, 0xe7bfe7c60107a199, 0x81ecf220ac413dfa,
+	 0x13c2e8eaa7ba27d7, 0xc5b50a8bdc990e78, 0x0b0b8195497ec960, 0x4114b12988bc26a9,
+	 0xe35e8f8430906c56, 0x89ec123f07237e51, 0x44d4949cc6770b49, 0x1f5d6d60e5aaaa9c,
+	 0x388e5f95e5fc1bae, 0xe452e21078a59c7a, 0x131a7b09553c7d47, 0x864b13862a1d12e6,
+	 0x7e81a5a249e587a9, 0xedb428aa67df136d, 0x8a50985db9d68d8a, 0x6d5cbb078b2616ed,
+	 0x284921d0dfc799c3, 0x5f3ecc9c39f57655, 0x5960747091f85316, 0x6c596f0d003ad645,
+	 0x694f5ec852e752f9, 0xa9f5349477a221fc, 0x1652db221ebb9407, 0x7eda72f2c290f6cc,
+	 0xe1a9ae3a4a6cbfaf, 0xe9ade7d4820f9701, 0xf83e152a005dbbdd, 0x42ebe88fddfed868,
+	 0x173830857c5e7af9, 0x917d8a9a3b4f7253, 0x723bc247bc73f146, 0x56016d4a1a9f6f1c,
+	 0x32a762d6021ce2d1, 0x77c97ce241ac4c90, 0x8a12a276674d13c3, 0x767310f7aa8df06c,
+	 0x31ba55a853fab10d, 0xc305862642fd364b, 0x1f3c7da62193226a, 0x4bb91ac910af9b6f,
+	 0x4cc0a44d3ecead3e, 0x160362b3c212048c, 0xa4968d1d2ed5a193, 0x1b8721bba21da063,
+	 0x99d769870b79f513, 0xbd8eecce0226fa7a, 0x0eefb94cacaa103e, 0x11b4e746b0ec82f3,
+	 0x54848e19c51d7766, 0xcfa44ea0245df528, 0x9d594f86d366e7b6, 0x34a3bed8e163bc3d,
+	 0xe80ee820aa7bf331, 0x52005738f8c73a6c, 0x7ddf592e789d1e83, 0x06fa504485e262dc,
+	 0xa7902dc097755af1, 0x483203304ad0185a, 0x56c1ffe434a2c8bb, 0x12a0c767a078d15e,
+	 0xf77493d0fd4259f7, 0xeb27bb684da26c61, 0x3b16a21fd7dc7ed8, 0x364dd5ee0c89ea21,
+	 0x1127bba60bdf212c, 0x86a78d32d8dcfca4, 0x9ac25619b46d6b94, 0x91c50718c8f246a6,
+	 0xb1b9d1cdb9cac88c, 0xfd197da3eae0ad25, 0x32c91affd4da68a2, 0x9ac303cd98269c85,
+	 0x501cd449c7b40d2e, 0xfb1da5caeb8bef3c, 0x8d6675ecf5b74926, 0x8490271c4e70a3e9,
+	 0x04a425787f313b1b, 0x3d9117b70667adf8, 0x387ff91204b02d58, 0x339a95302775698a,
+	 0xc63c8a8cda2f2eac, 0x7d6a858fc7ab6e3c, 0x9411cda86e79efff, 0x2b466b10bd6d03d3,
+	 0x58cd30d5ec186311, 0x2c1588226da49762, 0x48eb5c6bb1c74dc5, 0x3d35b214d8aab9d5,
+	 0x82ee7c185c21217c, 0xe66335fe74f5016c, 0x8b99b4ed30fcfe77, 0x7180eb01247c452b,
+	 0xb2cb2d5fe5b8c01a, 0xf78abe3213399331, 0xf10c2084866faa75, 0x7a33f63ccf7510de,
+	 0x02ab5b826656774d, 0xa54305f9c3a8181b, 0xfde127267a762b1d, 0x4714b13f50cc1f30,
+	 0xd29e62675d10eb79, 0x512ad2d8fd01644f, 0x61f39365245372d0, 0x1ec27128eb88534d,
+	 0x608ebf5756f089f4, 0xb1d083da61efeb37, 0x70908a7d42dc9cf0, 0x59680950c59074e4,
+	 0xbb6875982936652e, 0xddfa44192abb22fe, 0xbf3c54accf96e203, 0x1afdb53271656f7b,
+	 0xa73cd1d9dc80351c, 0xc2703acc0198a8b1, 0x0891bd4e19ea54fa, 0x6ca0411a6c3d6289,
+	 0x1c272156a3637a3a, 0xd2a6ef81bd72b372, 0xed6b93a29f436798, 0x46b538c6d03b5e32,
+	 0x713242f29db6e1a0, 0x8d71a95bb2a00df6, 0x08b31e357164dcfd, 0x74b130b38e081dda,
+	 0x15c726d54e5079fd, 0xca612128e77bab26, 0x5faf15fccfe86481, 0x37078544e05b498a,
+	 0xeedbf5a198a3461b, 0x4c86502d2b99073b, 0x65feb816de5c804e, 0x910893d6e9bec23d,
+	 0xe4dbc32575c0b0ca, 0xc3a2aab1cf8dfdf2, 0xfb6933b78b610911, 0x6f58efbd1f032b0f,
+	 0x926d2f223a639ef5, 0x5439566d932e3312, 0x59da73a514c250d8, 0xab0b8a86cf56c323,
+	 0xba001051255deb00, 0x2c1a09c4620c35f3, 0xdc29fe090e0e7c6b, 0x3a0139c5c5f17ade,
+	 0x720a79af4b173279, 0xbbc696cb95aa97ea, 0x4801c1e607a177d4, 0x04d6620f68a525ef,
+	 0xf0452e98e21adc3a, 0x8948e8caf6c3b6ba, 0x16a67df23b2ec346, 0x88b3cab5917dcb81,
+	 0xa4fb5e2e12003819, 0xcb7c652d3cb5c3da, 0xcea826ae71a16bd6, 0x9fe1e7ad27272417,
+	 0x00126917131576dd, 0x96cc95a0b2acce58, 0x61086c8a16cbe36b, 0x21972970071e30b9,
+	 0xb637473779f09d04, 0x5f2642906b94152e, 0x0d341f4b4b0f404f, 0x52e93c08865c7dd8,
+	 0x0dcab37e4a43b86f, 0x0f1eb5bb72c34da5, 0xd22e7f52843d8699, 0xafc5428d4a017b40,
+	 0xac5d71109a822f81, 0x6b5e6bedd7e85dcd, 0x774e3e64f18404ad, 0xabb969a9e4f98040,
+	 0xbc2cfe43a514d055, 0x994d0d50921300b2, 0x3250d3b830ba5ad2, 0x0d8f31350528bd3e,
+	 0x8cb7a7e0a61e6fc3, 0x6656d66c5d5e6c06, 0xfa6fc7d6c12d7fa5, 0x5764177865cf2692,
+	 0x1307c636b0afa258, 0xcc7050cad785a303, 0xb942b870e47ae8ce, 0xa7f118fcd214ed4c,
+	 0xfda509fcb73ddf26, 0xd696fb8606741300, 0x2f7022aa15f452fe, 0xabec0b526aa413e8,
+	 0x6bd8ed2c0367a861, 0x9d3a9590cc93e1eb, 0xb08583c2e81d1d88, 0xa34c633ad9921e45,
+	 0x1d58be85bfbb7b35, 0x1b8475a4965286f6, 0x0e8847d0a53be753, 0x4a9e9d391a751ef3,
+	 0xf9449286e6810560, 0x46d2e8638f7e5f67, 0x709133fb82acf598, 0x0a716c6a51dab312,
+	 0x1ca7c152ed453a07, 0x712d0fe3a41e0ac1, 0x3044a3d41a7c2f98, 0x2bbe964e1236060c,
+	 0x592c4a4a854181d1, 0xa3e4ad6075476b9a, 0x4108fe8a40d4be7d, 0x951f12acce1353e7,
+	 0x369e06204df512ff, 0x5447898424ced6c9, 0x05677a91ea5efb5d, 0x07412436b5f6fcad,
+	 0xa50563695187c46c, 0x6516633b094cbd4e, 0xc39ff33bcc6380d3, 0x7355464acae45a84,
+	 0x21c8af0a473da007, 0x7dcd8ccc0fa96037, 0x18c8df9ba402f393, 0x9a7a42eb38f95199,
+	 0xfaa6c1e8d1b28551, 0xc1099beed1c5af60, 0xd80dca49d1eccf19, 0x86edfd3b3e174366,
+	 0x95192078be28041a, 0xf1c1978106ff8a66, 0x6389eba4d9b33b21, 0x44a216c80d4e65fb,
+	 0xfe585d4603b996a2, 0xbe3cc1c097c1b7fd, 0xc49ae82f3866001e, 0xa05cc01308a0bbf6,
+	 0x78f2f36c9519a636, 0xc2339cee789b3f9e, 0xc9d6b7599cf3dc64, 0x0f0ccd985785d29b,
+	 0xaa27ae581956cba3, 0xb0085acfaae5dade, 0xa173620a504edacf, 0x93efdad82eda7713,
+	 0xe3c3922b1240f065, 0xa1cd8b7e8c65962e, 0x351160be860d4bfe, 0x0b36be20fa2c2e8d,
+	 0x57e872105a8b89ea, 0x0d3bd21f7841a662, 0xd617624d60a2573d, 0x5f42b9f515b924ec,
+	 0x1de011f401f5d680, 0xf12a4f6ed6e801f9, 0x2c77068fdd6f162f, 0x65540dbdde6a8d69,
+	 0x84358232e3d90c80, 0xd5f2cf0a33cc4c21, 0x8683c90ddb43f531, 0x71745a44d25e983d,
+	 0x261e7bbfb780c968, 0x5f0fc5ceee463099, 0x578fbfd8e3c352f3, 0x15fcf8b042d70a86,
+	 0x78841e350fb7f74c, 0xe0b54eea2f1a3fa3, 0x3954cdd654dd7dcd, 0x59d0df945644a313,
+	 0x52c6031f5dbdb8fe, 0xf0bf47cf9fe79fa5, 0xbfeba88f25327602, 0x8ccabdc7878f5315,
+	 0xaa2404963dd16918, 0x64f1122405668dd2, 0x5e06bfc419c6399b, 0x461159e149011afd,
+	 0x7b591a3015b26c2d, 0x62d67c62b019a2b6, 0xc4f79728a63489d0, 0x9baccb5239b01265,
+	 0x64a13e374f60a18a, 0x7b8d2aa64589646d, 0x7e6d2247dcdb484a, 0x358c1ce185e2873b,
+	 0xefac4b97ec891777, 0x64fac0505a309ed8, 0xb463eaa734dda57c, 0x42e73728a2e07d5d,
+	 0x1ae2dae3fa2f141e, 0xe82d377e6f96b63d, 0xaf52534018f731bb, 0x056df36c33a3023d,
+	 0x471e0cbfe0a80c63, 0x6e1d45bd6fcc5f94, 0x14a7d0553fc46c21, 0x3dbe9f8c2afb2c95,
+	},
+	{
+	 0xda0b1ae395551818, 0x9b48150e5066d91f, 0x5cedd08f3ed14449, 0x3b2a92ab3cd6d2e6,
+	 0xaf3f9fccf31d0dda, 0x33f3f3791517083f, 0x806c9289baaaef5c, 0xb5e221c4b582e8a8,
+	 0x7115aceb49b7b705, 0xff36086f424450e4, 0x2ea8c7e09601f800, 0xa730cbe2efc6a18d,
+	 0x3bdea6591f2a3d60, 0xca986f118db2d3e8, 0x72f655a4fb290ebd, 0x5c264b8d6b54f9d4,
+	 0x8c14e653ef9792a4, 0x3436ea17d2031cde, 0x99e82c8cd1c074f0, 0xa02f449b778aa2ba,
+	 0x69449adc4e65e25a, 0x96e780e9bb24ab6f, 0x126335d49b464abf, 0x68895c29b0c4fbd4,
+	 0xb1c117078ce1628f, 0x640eff50cd3d9cc5, 0x19bda47c24b97b2c, 0xab55edd6da369dd9,
+	 0x0111b3c6bde53ac2, 0x8484c5e5a5ae7fe6, 0xe4eb22a23ca0baba, 0x09f014f8ffb42fff,
+	 0xd5bb17b8a5fae374, 0x7bbd650a76b6c659, 0x67440dcdf14fb7ad, 0x092bc1f3d0568bae,
+	 0x401753321d57d587, 0xde9d65a49a198d6f, 0x21d0b485676be97c, 0x6731c61f0ba44710,
+	 0xe0c2d4944508dd1b, 0xc9d779d5d0af9dc2, 0xa2f55cf51444f4a7, 0x61d178b7079e948a,
+	 0x98a814b2c7a9eed9, 0x332123b1f7cfff00, 0x23d7b06929e87cae, 0x2e286bcf875e5657,
+	 0xfb7e4523d6bbcb73, 0x7872d7de8ad87718, 0x52f313043f7eb432, 0xb1dd4c1beee003f0,
+	 0x8de44f33bdb0e006, 0x7270e96edaf27cec, 0xc6b718903722f469, 0x02eb1c814f1bde74,
+	 0x51d867ba4329f267, 0x3a998fbd3eb0537d, 0xb60f9b2329de17dd, 0x2dec9a20f897016d,
+	 0x5d14d80f21921488, 0x33de965692670759, 0x0db947c99b6d06b4, 0x2140fa66980eab0f,
+	 0x9b9f2526eb10fd1d, 0x5e1de02a4e763f56, 0x57a43a675d7e159d, 0x38b1bd3daa376272,
+	 0x03e87f01bddb2e7d, 0xfa0622a1fec0fb6a, 0xb99d15f7f2bf8ab3, 0x9abe3bbd69e4978b,
+	 0xe8e55545aa6e9d04, 0x0aed6aafab37aaf2, 0x53ca01020434b86d, 0x6aa7da0903e7ef87,
+	 0xee6ddc11365bb321, 0x0501ff577a25c020, 0xb2007d91ad8de02a, 0xa2e8dfa985f2d5d4,
+	 0x5292508d1b87a294, 0xf0a589c528be725d, 0x50833da29c4e2644, 0x2494bfba0353abf8,
+	 0x54ce55821422297f, 0x259ebe4dec800add, 0xbc6075d138bdec43, 0x99b04ab60253c0be,
+	 0x6b82a591a3a8ac1f, 0x02d2d140e12aacae, 0xdcfb21e0abcb177c, 0x6e26a25199361e10,
+	 0x92e61bded2652262, 0x4de53550afe9014d, 0xe4115dc8d29051f6, 0x046ca1a54c9b8569,
+	 0xe0f59bd54c91a666, 0xca9c0681d89a7506, 0xea46e947da4665af, 0x3ad2134b376bb5fe,
+	 0xe5a6ea07b7e45d16, 0xc34864ad5829d9ad, 0xf28aafb7ba38c679, 0xb3afbb44072495f2,
+	 0x2efcc16cd89be8de, 0x6a6b85d9e527fb14, 0x760a6262a4bf5c4c, 0x6ffc7448a2903d0d,
+	 0x3f4e96680e5024be, 0x683d2c64352d4076, 0x30d817c060b917df, 0x490480525b56b8fb,
+	 0x99efd4d39155317b, 0x32c76c69fd81edf1, 0x746ea72210b4376e, 0x880ca02e83a661c7,
+	 0xea7b578e135fb2e2, 0x001e9357952f8b19, 0x3404f4befb38ea00, 0x53dcb34e9f44b8e6,
+	 0xf19f718a6ff4d085, 0x98490a11d74ca51c, 0x2b4bd5bdeb51062a, 0x51f1c3402b2db996,
+	 0x46f85150b71bc192, 0xeeba6413de865373, 0x6ae77f85a98de3d5, 0x01bf1906750c2cf1,
+	 0xf9cd752e9d6565c6, 0x985764bf9fbf309a, 0x00a6772f51e55dc0, 0x4de2f3b6ad73909a,
+	 0xe8883eaf0c8d80b9, 0xe414820dac8db8ee, 0xd42ea6ce90b07be8, 0xa936f737f4412404,
+	 0x54515f99c4512fbf, 0xb9365a10e6aa3063, 0xe90a9421056890f8, 0xaacfdebfa48c4a28,
+	 0xb5679a811d0d88ac, 0xddaf85b70c6494ee, 0xcda27897e7ebdbca, 0x6521dd8c16d73c58,
+	 0xae9dc204b21a8ee8, 0x4755b6cd0e597b08, 0x119e2a395cadb069, 0x9a671483b78d5695,
+	 0x09c522853f924f2c, 0x7e0325537731bd4f, 0xbca6ed1cab600064, 0xaf9c4fdf8b837faa,
+	 0x73133b433bb757dd, 0xfa4a4fbb982b92dd, 0xf723d5e1c5b60734, 0x7c65d46330bec38b,
+	 0x37e021cf19e18734, 0x12b398de311cd148, 0x2eb8076605b1826d, 0x9df4a4e0b7c9a5f9,
+	 0xe0972069c3920264, 0x35339220f02563c7, 0xb5b03a06fcbf46bc, 0x69c27cd067f0c76a,
+	 0xe8902fee5e25ddfb, 0xae241acb50af8717, 0xe3825ac78c7d03fb, 0x5150fd5a4a115a6b,
+	 0x8474ee3468308249, 0xba556bfa5123e4df, 0x6f2577a041dd0bdd, 0x0831c44aa0810075,
+	 0xd9c97d150d7b584a, 0x2c7dfe2090c77a35, 0xf76475458c2a78a3, 0x9dc036cb984450f1,
+	 0xe868e1ca49751d9e, 0xfa5c26148b74abca, 0x9598faffc00d7216, 0x41bfdad8e4f828b6,
+	 0x00b57de0016b706d, 0x92f22e7e946bd9b1, 0x91bf559cdb3b1edd, 0x8e65d19c2047e079,
+	 0xd00f6d851d827f83, 0x08048f996923aff6, 0x44c18414cea471e8, 0xb28c5436f21807a1,
+	 0x01f06959a73c4539, 0x2f7c6b0361b8fb63, 0xb675f1b2002c6b50, 0x081fdc5c97ee88e5,
+	 0xf52f3d4e02512451, 0x0b3f77d6428b4ca1, 0x9cc448812f56fcf0, 0x0d14eeb9d4192ef3,
+	 0xd339e26fb7ba044c, 0xc8769597696a0c87, 0x8c96c6aecda363c1, 0x7583d9b3e845e4b1,
+	 0xc0002f163f6dcf1f, 0xc614496bfacb6abc, 0x11c1fbba66bcc208, 0x7ba9f4a0db40485d,
+	 0xdc6f2381ba9cf9dc, 0x08fc047d85a4f30d, 0xae65fc6f89a4c12d, 0x00c7edead9a3c14d,
+	 0x8a391457809ee02f, 0xb6aecfddca47cca8, 0x088884902d7e7af8, 0x1d6742db7f4e4aee,
+	 0x7bd911e8ebbf0397, 0x83521ac573ed136d, 0x7b64835c2f8e0c96, 0x264a2deb9859253e,
+	 0x9087952ba3fcf888, 0x6df87b2e9e3b5437, 0x425b29dd91e9be1e, 0xb2861fcc8af179f2,
+	 0x404d4b34b12f7cd6, 0x7112a1f2394b68cd, 0x5e9ac499078b4577, 0x5cc5c3e3c2760e26,
+	 0x2b48cff3568d87a9, 0xb1f244e16567b04e, 0x805b2036a8c44553, 0x6ae40beee800331e,
+	 0xa61b92791dde5ee7, 0x6112c1155ca211a5, 0x113fa7258549415b, 0x759b94b2768c3240,
+	 0x8b54fdb2726098bf, 0x4385ac5e065e08aa, 0xa61db9b84947ea5a, 0x2e41e8f2f6456fe7,
+	 0x4cc730c5f5865307, 0x6d5bfdfab825648d, 0xa92e3a2e3be3c4ec, 0x47c17ea67fe093ef,
+	 0xf6b54450fbf8731f, 0x9016210c73314979, 0x2e8787c84cbeee73, 0x5a05bb7690d6b856,
+	 0xaaa7908660d4afcb, 0x1a878fb06fbf07f4, 0x2566ab82d27c463e, 0x4bac694820fa458d,
+	 0x18dd8c5a4556adfc, 0x6358add1c67a9d97, 0xc67bd79ecc4fd3d9, 0x77dda4597cab0b44,
+	 0x992c6ab6641923a9, 0x12b7c310e09cceca, 0xb4df3ddda5ff2738, 0xb149eeabcf86ff12,
+	 0xac06ee883a540d75, 0xe131de7d783085de, 0xaa4934981f27da37, 0x53f0568e7c8aed39,
+	 0x03ff60b940d446b6, 0xff60f96f85cafb86, 0x79bad16f00b3a6a4, 0x0c7fbbae082d64cc,
+	 0x9052ce6a71d7555f, 0xca6657292bd3927c, 0xe9e49706788c6916, 0x2a8affa1f5a52b76,
+	 0xcf5c47b218d8677c, 0x95cd8543c7fba791, 0x96d9dc68fe64112f, 0x57f5eaf84529b889,
+	 0xacc77844442b77a0, 0xc0e513da1e73f93a, 0xe957823f0d97652f, 0x7658fbe6e1688f33,
+	 0xf8626529162eb9ac, 0x8c1852e8ddb9cd39, 0x03002cd4987ebfcd, 0x772fb79bb64328cf,
+	 0x37ec08fbbf1b33c4, 0x515f8d237033de59, 0x19492138877371f3, 0x29f79ebd4519b26d,
+	 0x7a8f25048bee7e3c, 0x9f07f2401cc2e82b, 0xdbf0317ccb526253, 0x67c825e6d8eda9fa,
+	 0x8f670f28fbc98759, 0x45a4ea5fb9d2e631, 0x1a4200de92416902, 0x1aa2def48b25d2df,
+	 0xb26a8630e2910f2b, 0x0ec49683d38dd22d, 0x7b0e866c48154571, 0x29844e3435d1e985,
+	 0x9920e4853b30287a, 0xf5ad4c421f262193, 0x034d640703513d17, 0x328bfcf5d0b0354d,
+	 0x654c0d9dd3fd40ad, 0x85544980138f6aef, 0x7dcb8704e75ace92, 0x656f87985e482bf9,
+	 0x9ee4b6cf277edf33, 0xc7826cd359a41dcb, 0x447721d891c81e08, 0x8a253cd88d613da9,
+	 0x4b630644b9c85ba4, 0x603bd6d1c8798ea5, 0x354bc8fa4285e4e4, 0x8df99105550be478,
+	 0x5c55bf8c6121ebcb, 0xa216d88fae300151, 0x835acb8b3e1b4a65, 0x2bcf0218480f8b7f,
+	 0x544c25020f23622c, 0x23acae16d59825f9, 0xb2738dfbf9adfd6d, 0x5ced9b8f65db106f,
+	 0x08b701d04557e193, 0x351c3c0c6305ef40, 0x3dbdf42ede552063, 0x26679c35518d9728,
+	 0xddf97c59cdc2a21a, 0xa0d51c9fe96cb994, 0x6c3a87aac172af1d, 0x3916f3ffd6a9c6fb,
+	 0xb360a9f66bee1041, 0xd2f1195e1018c02c, 0x88ec2293d1606f33, 0xa63f564ff286263f,
+	 0x78d50f6c0528ca16, 0x93a126a61e137cc2, 0xd1f4d3f9fceca3b9, 0x3afeb4ff244038db,
+	 0x7a9218ae70ce151d, 0x565aa37a7473c5c8, 0x2e05c4e2eaf4d49a, 0x61bb4d412ed3b864,
+	 0x63668419ccb255fb, 0x2d882262ade6d8c0, 0xfbcd046aa2e634a5, 0x25b334f920ff8bd4,
+	 0xa2759f94c4d9f36c, 0x0ed5b56b7fdc957e, 0x4a72af0f5d27204a, 0x1fdd1bc92973a2c4,
+	 0x53f3aa4bd9b34445, 0xd78ac99afd015bbf, 0xd230967c10c5e428, 0x8ce9ef1b7590a492,
+	 0x518e5686af53570d, 0xa920957f611a646c, 0xba60cfd1a3b3c02b, 0x2b30b7f24ffd6327,
+	 0x1f9b850c64764d41, 0xa2b92dbc2dcd8162, 0x3c327a04e6d60507, 0x1f3321ddf4db7f40,
+	 0xe2b77cb4e005858b, 0xe8acd88602099173, 0x68abfdd2709784e5, 0xb149122106596ad6,
+	 0x33333e449c04c64e, 0x50d61009a35ca6ca, 0x3d72a810cdacc9f5, 0x53494d665fa588d5,
+	 0x3c771e4f750eb87f, 0x527e7d782c6c061f, 0x69cd7746e2f1148d, 0x14d704c180a7a0f3,
+	 0x25d19329434b60f6, 0xb26f04f9e5934d30, 0x8212c369cad81268, 0xb59c00d1fbbde576,
+	 0x6181b2938a6e85ef, 0x6bfeedc27f4b53c5, 0x017af79c58dc1258, 0x86e854e0d939a9c6,
+	 0xf9cd0d8aa279e70f, 0xd680ec808213fd35, 0x2149b2befd024172, 0x24cf63eaf7be2019,
+	 0x9c4676eb47aeeb13, 0x4de4e9e0bdc71b42, 0x18d3f979cfc89b0a, 0x5236141666f37b6b,
+	 0x9693846694e95edd, 0x541275a89ae7cbc0, 0x97cb57a2086ba4dd, 0x255d6a7b766c389e,
+	 0x635cbaf312444103, 0x391399c09101e9d0, 0xccaaa7e433bfef1a, 0x16b0455dfcc8e5d9,
+	 0x5523bc940f4b99a1, 0xd3e24d000f567d81, 0x9c0e5a1f1b444f51, 0x08f3ba35ff6e56c2,
+	 0x3323d4daa19e7536, 0xa064b0585ee25f2e, 0x04193ac1f2814df9, 0x31cd681fb39a0b14,
+	 0xd83c03f353b54a2a, 0xa0c4739a323c47e5, 0x9aa958386ce1ba30, 0x1803600fbed4d2ec,
+	 0x59ad10fd7e069a87, 0x471de053a62731ae, 0x5e860d8505761ae7, 0x41e1fed2b74e9f16,
+	 0xc71bd3b69348cef7, 0x69563f79e87f6182, 0x67049bfccf77f764, 0x28029594763439a7,
+	 0x638dd5cd73a0a9f7, 0x81e4e57b2dfac10b, 0x607cc9d7f2bd4e44, 0x8f49ac87d843d1bf,
+	 0x0e798ae511061a2d, 0x7c7d605f4661ae75, 0x05f5cb6eaf1633ed, 0x9a1f9ac589db4143,
+	 0x63d937da349a1f2f, 0xd7d565bae610178b, 0xe52bd82c5d96d747, 0x6299709fd450482c,
+	 0x785f3008b33f904f, 0x50235c01d5aeb2ec, 0xa4f44ee0e61d0004, 0x2e485884fa6142d9,
+	 0x6fcee139c68159fb, 0xfa244187f76fa847, 0x813335e6ccd38a94, 0x7f501c3e20b1b4d1,
+	 0xaa98afbc422eab5e, 0x08e24a7531f65057, 0xb4846eba7ee0d441, 0x3563d8f51334f34b,
+	 0x9b5b599483858afe, 0x08731f769208eb7b, 0xa6dfe65333eb675a, 0x81883d6ef2d64a94,
+	 0xc2d95d0ef1a198bc, 0xeba18fb1a49673ca, 0x5a8115f4ae1803ca, 0x397bbc2cbdebe200,
+	 0xece4eeaba8b60e3e, 0xf9b9fa93d0372859, 0x4ecf2193cf47f493, 0x299fde039766f761,
+	 0x8e01073bf0a84f48, 0x6a2e971c4bb26043, 0xd14806d4ffbde310, 0x90ff170b32df2750,
+	 0x124d5116d6dc9b0e, 0x051ceb3a869168f8, 0x82091b1cafb62d6a, 0x61c9211470cb81ca,
+	 0xb3743d2db67164c8, 0x5dc5fa2c675f81d7, 0xc7c448a9d99351be, 0x5dfad62c00161d2b,
+	 0xcf41c93be37ca5fe, 0x70d3722fd6126735, 0x9a8bb71fcc62d0f2, 0x87ff79e6029fec0f,
+	 0x74241a6927cdba61, 0xf0f5712f05215c42, 0x25f13d07da85433a, 0x3f22ca5b3d1c55f3,
+	 0x32b434f9b834feea, 0xdd55da754f0d8708, 0xd2a630e0772038ec, 0xb2ca523a62fd2e2a,
+	 0xbc70ae60338da600, 0x4004ae13741b974b, 0x0d6ec9a34503796e, 0xb05ebe320fe5045b,
+	 0x0eaa2219c5f7a49d, 0x8b54f12d0c90d364, 0xad79b13882656464, 0x1db3200feca3d43e,
+	 0x7ecdefe6d6dc7f8e, 0x57af351f760efebf, 0x2b550fb5ec6fe941, 0xab1ca4cc48e3ce76,
+	 0xaa85645b6f940839, 0xd5769e30f84f9b22, 0x6302368dbe864623, 0x966cb4ddc3448745,
+	 0x545cbfe38f80a7d9, 0xe69b8601f978a30d, 0x8506d6680c25a63b, 0x8b1bc2c6fd270697,
+	 0xa9eaa942ca07e120, 0x238466744a039acb, 0x7e1a54a959fe2480, 0x42faaa621feaffaa,
+	 0xb1d8787cff1ff15a, 0xab372943f1dd9659, 0x8924974de51e1bd5, 0x13e108d59ca4be79,
+	 0xb24a710a83bc0e5c, 0x767d1ac0855f566a, 0xdab7822548ccedaa, 0x5ae1ec760a576f2c,
+	 0x09c489b48243a905, 0xae21f53c7565707c, 0x9b13e607f3563db7, 0x98332cd7199136e6,
+	 0xc2065be524ea3d70, 0xd185f2affdeb9c9b, 0xc8205fdb7793b366, 0x69a2c3f7dfeae4ec,
+	 0x801e169760885aae, 0xe788922f68c04569, 0x0af328597ce81b01, 0xa74c361b79ee2f9e,
+	 0xdd232ae7b66f62af, 0x36c71c979b1782b4, 0x87dfa3d39fb73b32, 0xb07eaf7da5a7fc57,
+	 0x934067154531eb77, 0x11601a8ce5895b58, 0x8f53f99e49fd5ba2, 0x6766e22920d3c498,
+	 0xbec1a6e7a949e706, 0xf512b60c953b215d, 0xc35771e717d58a6a, 0xb598fbd5efeca35f,
+	 0x50330f8a5862a8d6, 0xfe218aa1c4609344, 0x51dcfacdfed47f63, 0x68e3009d820f30c4,
+	 0x62e6766e13c04218, 0x698ee8ca1188d813, 0x0d6bbeb54383d306, 0xa244e1eb077eadc9,
+	 0xd1b67c75e2d30166, 0xf308446dd8b59fab, 0x37bf5db33db3ed43, 0xb5cb2b48144aabe6,
+	 0x74d2f2cd687121f9, 0xc5d98b277498d7a4, 0xaf02bdf6a044224a, 0x3f48bcda773a4b6a,
+	 0x63d7acb0612b25a0, 0x9acf53dc18955dbd, 0x5d090748f6163171, 0xade98316a3f52896,
+	 0x4ae4fe46813c3c94, 0xa78002f3cb3ee770, 0xbd4f4872c38324d4, 0x89df716d479ef775,
+	 0xb89f152241514294, 0x70603d399e9c807b, 0x9903ac95d67d66d0, 0x9ad2764e8a5684f2,
+	 0xafb677fdcbb0362b, 0x0ddb1e5807f9458b, 0x852d363a7d0e2495, 0x5cbb8dfa357efeaa,
+	 0x3107fece825723e8, 0xd2a201ba1f5d6734, 0x715b8202881306f6, 0x18fee02f1044ce86,
+	 0x23cc71235ad91f3c, 0xd171e2003a0f2c32, 0xda00b1db66ae2c00, 0x93ac4875828bf641,
+	 0xa58f7ab4c2c8eeaa, 0x9029d4987404be0f, 0x967cf4fe7738cd5e, 0x54dee4402fe48956,
+	 0x11ebaae08d6a5801, 0xf773b6efb016aed0, 0xe47761cdd5d38f73, 0x362ca533061d10e2,
+	 0x4836f69db4993f23, 0x3e6e028b3953d821, 0xf2e93aae364d9676, 0x3178821aabab67b3,
+	 0xf4a7026b497eecf2, 0xf0f86683319033c5, 0x713166beb330a90b, 0x9420291922d61622,
+	 0x9cf30cdd3505b034, 0x6de8ab34fb713c14, 0x1fcb1a8b65164e2b, 0x91630b8b56e4cbdf,
+	 0x751600c22c324f66, 0xb461c3a302e4f643, 0xaa488e6266290296, 0x0ab28330886f52b4,
+	 0x0edded3dd280336f, 0x61327ad6c5167c1a, 0xcd132a4c99696c9e, 0xa6b385decb0f5daa,
+	 0x1e7ce553f034322d, 0xe8b0c3a2ee92a745, 0xac97a990064b2aba, 0x10e000110be72194,
+	 0x2a97a1e5a97c8d0e, 0x58de697ce76643a3, 0x59b598dec5da9556, 0x14e77060bfd7dd44,
+	 0xab548849babd207a, 0x5ab8b5614eb27b79, 0x93216890465dbff5, 0x5ba003535d75a650,
+	 0x552fbd44d29dae54, 0xa3627a079d345c8d, 0x5ee04c1bcd47c0bd, 0x73a9b3fb44fbab00,
+	 0xc67246f58e324569, 0xd5e5e374524b787b, 0xe06653c4920ef5d8, 0x3dd3d1d05f2c92e8,
+	 0x304189545b50ad56, 0xd6a1d2f423923d55, 0x7a4a666a41edfdbd, 0x6ff2724bf95b8bac,
+	 0x847e906d728df65f, 0x3560b30c0ba90bc3, 0xaa307d7d64dadbf6, 0x9717fcee1d5150a1,
+	 0xb0b5674f068ab020, 0xd6a6128f69053977, 0x06ed160d323cf7f2, 0x6130f9bf40a74394,
+	 0xacd86c8c48a06482, 0xad634166870ae6a8, 0x679fb74ad71cdd2a, 0xa3db317033e2f2b2,
+	 0xc2382ec129f4db91, 0x8e04ac176e643c2f, 0x5110e0e34cd88d65, 0x5a93f4aca585d97a,
+	 0x022666f0058338d5, 0xc8562a31e1d60235, 0xb38854344c3f5a40, 0x6c99aed94b567fff,
+	 0x179df8bdf3d7540b, 0x5d39ae28e995d3ad, 0x5fe6c70a98e4991e, 0x0e5ceceab7876b07,
+	 0x93b5a1b32fe5f2d0, 0xf97f86a0afd98ed3, 0x221ab10e96c775f5, 0x20db8c36c9e9b691,
+	 0x54476064d6e9ccc5, 0x3704101807fd6d82, 0x32dcd0d50ffb4850, 0x4195c75070df88e0,
+	 0x7005865358eef2b5, 0x2d2fae126506ff54, 0x7312666f591e2c0a, 0x6e6e754cdafdddae,
+	 0x0f18137638eabf7f, 0x652e05c796f7f32d, 0x817de43379cef259, 0x70df80f4f9f155bf,
+	 0x91bf84909186eae1, 0x7c8a6367ec1c73c0, 0x57ed3f075cee67f6, 0xb51dd342ffee8bab,
+	 0x19379fd54c3531d5, 0x499df74a52f45dcc, 0xb9e308a1335e6b89, 0x6b10e8927bc1baf5,
+	 0xadaeee2f409df366, 0xed59dcaf2db9b273, 0xc17a68da14140672, 0x58f922cf6e8e543c,
+	 0x84c6cfc477e2d871, 0x6014f1eea6eb41b2, 0xcdb11fd6d090ad0d, 0x24c922274d79ba20,
+	 0xc00e45a767dd2cb5, 0x2d75f4084476f924, 0x8d30c2b1b33cf16b, 0x7d3c361198e99aa8,
+	 0x79a8d9fc33f695e0, 0x2b96ad3786062b70, 0xdb27156873b5a0f5, 0x683b15f7049a8ac6,
+	 0x0b0d5f0aa5a4b059, 0x9f8c259a6af77e23, 0x6824fea717d0d132, 0x34a5831ac7ef67f1,
+	 0x4064219e11594e2b, 0xbd49e6e7af3a103e, 0x72b6f0a01f149930, 0x5bea6aee04a2c69b,
+	 0x6d52efe4186f68cc, 0x31a608251c464437, 0x653f6106e65a3daa, 0x6a9c83a48b72cff1,
+	 0x65034288e5b82b2a, 0xa67837b8b6f9a65a, 0xc57487b6f99aa91d, 0xabe6aec75826b932,
+	 0xcc69a21433d02153, 0xb6850029805de837, 0xda1eb73f4f361134, 0x4660a16dadea4c66,
+	 0x0a8fd6142109d9af, 0x51a28c1a57bc5d33, 0x1b40e841f413203f, 0x3765661eb41febfd,
+	 0x333aa819edf96e58, 0x1623fd339a864ad1, 0xc0f08227c45fe707, 0x6e7801160702c954,
+	 0xe0eb98a029a6a9eb, 0x98109df315757507, 0xf3dbae1461971d29, 0x6d0d77e87491c63a,
+	 0x33febff9025928a2, 0x72a60f930b09dbbd, 0x82aa9f2d5b08ef72, 0x94b31a06b7d946c2,
+	 0x1b0e70dd21202f36, 0x340547af7218572e, 0x8c9fdad29f0c27d6, 0x1cd5b3ebc1bf4a56,
+	 0x3c754b3c57957f28, 0xad12d7f251812cf9, 0xc273ffea19aac69d, 0x142cb6a679a6c6bd,
+	 0xccf4ddc3d1fe2d10, 0x510bef26fcc98524, 0xd673272ba483b0b1, 0x06abc534a1c774bb,
+	 0x5fba2cb292985395, 0x10ff54238dd78af9, 0x1f2e87c730181de8, 0x2f7969193a540102,
+	 0xe03c0691748636d9, 0x4c7a71711fb4f275, 0xacbb814a89280ca8, 0x007479b45ff2c094,
+	 0x9a0fa8fe0d65625e, 0x720e73676903e0a6, 0xe8079ecf8f24fc35, 0x449bedaa75aa8e73,
+	 0x38dd50ef291247c0, 0xd861b73d6670d474, 0xd2eb00cab9746b7a, 0x53aabe261853feea,
+	 0x8804663570de620e, 0xf9928f153609717d, 0x2f9b31456a32d6a4, 0x53df53e84a12773b,
+	 0xbb799439bd94d529, 0xc9711929ed53e9c6, 0x6dfc13a8cd8dec18, 0x582f6e3ed4b6e82a,
+	 0xaf16175679c3092e, 0x30e5eb09059a411c, 0xebd987c70d4b20c3, 0x9381f00cf5d338ab,
+	 0x40601d4e67e1d257, 0x36d3c7265abae964, 0x7111660be88958e0, 0x03bf6cf37403b2a8,
+	 0xd297427620fd5b50, 0x89138fcf1614bb0b, 0x4f86004c90e6c37e, 0x7b2bcba60d6f1d19,
+	 0x3c0af897a8139853, 0x65ae73b26cd5b0fb, 0x6be57d7d8bd9f600, 0x6e01dd00d4ca3036,
+	 0x1857dbccd4cd87f0, 0xbd6065e71fe2ba9f, 0x35ba7862b4a91d1c, 0x293d0655f5f81bad,
+	 0x96456550334b934e, 0xf4dab1c918ae7f11, 0x9b9225cd10d2f9f5, 0x5c15c082071dd2bf,
+	 0xb06da9b55eb69704, 0x16862b7b9fba6591, 0x64a8bec294bbd55a, 0x9eb724424993a1a2,
+	 0xbac7f4a553b3b0c1, 0x9cabead9da89a734, 0xd6145577dd38dcc6, 0x519d11ac1705440d,
+	 0x5b458939923e1ed5, 0xee3b7c1e7af248b6, 0x2d8573e630708339, 0x00aae60f199c646b,
+	 0x789b785449eec0d4, 0xf80414e10e245441, 0xfb32e0a355677aa9, 0x54f8d1a55c06e0e0,
+	 0x3f7dfd2395306ae6, 0x74af635a852be00c, 0x51764a548ad0cf0d, 0x5f435071f0715836,
+	 0xff618be0ba560c39, 0x09ef941f596a4a6f, 0xd9f11f5d232a2dd1, 0x49c8aeb4222e5a0e,
+	 0xb72f277b67d06154, 0xca0deb2aeb159359, 0x74fce4ac8d49de99, 0x596cc5714cef275c,
+	 0xcf2ceba17e718106, 0xc31ec821d4a74142, 0xdb7d614a4aa65d69, 0x4657dcab5a634500,
+	 0xf3cc39183bdc69f9, 0xbfbaf9f04e23305b, 0x3f5522c6f9362ad6, 0x08c764cf77b3fd14,
+	 0x84d52733f7482959, 0x66dc8b8002f0fdc0, 0x9de85ef4b38f907d, 0x186262f28e5e3fa8,
+	 0x554736396f4b7672, 0x3c6eb7e012ea0a70, 0xa8dffe09a702336a, 0x610a27513360b57b,
+	 0x5b05a1d59333b3ee, 0x67ed7fdfd9d06b67, 0x1ba5c6e3169d80ef, 0x2fb06f3ce5adcbe2,
+	 0x2020cd705ec35a82, 0xd67887a0172eecbb, 0x9ac6850d3b715338, 0xb3a77036517c7836,
+	 0x237c004451a3da76, 0x1125099df5a2e366, 0x4d10db05d2140e81, 0x30caf34782f34194,
+	 0x8c162f9237e14db4, 0xf9bca9c0d2aa0750, 0xe4af8db227f21074, 0x92bf927544a35280,
+	 0xb62c0c607910a7fe, 0xa9942adccca96d72, 0xbe05351d4886384a, 0x956d538d5452afa2,
+	 0xfa77c91f42732630, 0x0722b1074cf01bfb, 0xb11aa12472437e78, 0x5649ae7ba0daf831,
+	 0x6e07b7d22e369ee4, 0x09553ae6e65eba66, 0x088b6d0943fe8fc9, 0xaccd4282c402e1c2,
+	 0xee9b98c2681b06e3, 0x563b0c952c44a9b9, 0x87a7fc34813b0d43, 0x4d8f05ca9c35aa2f,
+	 0xc020464b71e1ee20, 0x4153e00b451ed0fd, 0x5d58cd50505dcad0, 0x9443b34f7624d0af,
+	 0xfe3a873a59d42467, 0x62aff023e40259d2, 0x2a208405137f0de9, 0x15583084529bd509,
+	 0xf0cf014218214525, 0xcd4c1d9a2fb071dc, 0x43157adadb208012, 0x6adb3a8baa0bd8c5,
+	 0xcda10c627b817678, 0x513bdbfc7ad530fc, 0xc75281d9892c9e2a, 0x15842ad45967bf4a,
+	 0x20549cf0380d9e5b, 0xf9d3ad47eb8af2fd, 0x222fb27a8d1862b2, 0x6077ec0d70e59b27,
+	 0x66a121541a95a0f8, 0x0d700cc299af36d1, 0x7d29cc3ebb710a04, 0x8400b1fe55920725,
+	 0xdefca67481064f1b, 0x61520e9b4a2e7fd9, 0xf2c17220f5d91f87, 0x6adf2124c76aafc6,
+	 0x464479b9e0b32fb0, 0x0f1a56780e0e5837, 0xd404bea84a102bfa, 0x8e005196e4e91ba9,
+	 0xe8bfaf68b8c969d9, 0x1d5e98066c56ad3d, 0xb57e602b6a78eb7b, 0x5a3c74a3d92e497a,
+	 0x2c64a5749971c99f, 0x5aa4b057a5dd10ca, 0xa9ec4af4918c844b, 0xa061ce3fda4df728,
+	 0xf6492eb282077c0f, 0x8e75c1f5abaf6c9b, 0x9cacf75f5accdb00, 0x385e19d2fc89b466,
+	 0xfbb5a795010e23c1, 0x12ee72bbae1b8dfc, 0x94075a8557b7196a, 0x70783b732c7ca4a8,
+	 0x1dcd62a8ec82e7fa, 0x92b6bffda5fe4b63, 0xa88cf596c926591e, 0x0720fb0702ac232c,
+	 0x59302898e2e65f96, 0xd76e9e5c89f491bf, 0xd97c2f16d7db54df, 0x7cdd94be4f26fe4e,
+	 0x501f9f9d17518c93, 0x83557d1ad66707aa, 0x0748cfcf52d19506, 0x0ea638cdafdfef38,
+	 0x6f07e3cb7fc35294, 0x245698fb609c23ba, 0x30546b7d07e265bb, 0x1bb4db9d9c1e101f,
+	 0xd11d2ab7a4db7f04, 0x649856c654ee9b4c, 0xf21367cee2262357, 0x56a70c24873c51ad,
+	 0x83705fdba37b43bc, 0x37bfe7fc7ca8690f, 0x8fac23fde35c521e, 0x73ffb14addf1bbc1,
+	 0xa596d07307db5cc7, 0xca754eb82a4a3eaf, 0x30e8d49e6bbac86c, 0x3980e4a6ebb35fe7,
+	 0xce564ebf0ed439ed, 0x20c4befac37eeb0d, 0xaaa8cefcfecee03d, 0x0440c009f2a3e161,
+	 0x16ea58f36e222358, 0x18d41f081496e988, 0xaa74b35fc8a813d2, 0x57ac83bdbea38131,
+	 0x10ee4f97e817ec02, 0x3152fd98ce4515e2, 0x846c973fb6a1410e, 0x3fb416500a4b1d58,
+	 0x33b902fee90e7824, 0xe3225a27f4102178, 0xf4652e879477fbb7, 0x39e8a57694012b78,
+	 0xfdf8334b045be3d0, 0x88374e728973b1c0, 0x3ad714cd88516d7a, 0x43e64d9915524619,
+	 0xf7eb1f0577e281b4, 0x7be92a3f5d51579c, 0xc7888b76c4112f01, 0x155efbaa75138604,
+	 0x60f4f510c95cb08a, 0x04d28d0c4cc60f29, 0x4235269091d6e2a9, 0x4134f89a2a00c465,
+	 0xa709402e2054eca2, 0xbf288074739e801c, 0x2b6d32c065a74c73, 0xa63b7d82705db1c1,
+	 0x7045aaf650f15631, 0xc75f43ea9eb1a000, 0x43d2efd7123d292c, 0xad93f24b4ce5fac5,
+	 0xa1c2fe46c9fcef38, 0xd60eea8b78139e04, 0x175551728ec76ea9, 0x85200727b8d44daa,
+	 0xf803f0869ff220b1, 0xa8c7f17bd4a34e13, 0x880894533ca8f955, 0x1fe015046b5ddc1c,
+	 0x9ca33338a0005c52, 0x2fad7d855fd0d021, 0xb2f77fccc9940e0b, 0x0c9be9e7602b3b8c,
+	 0xa26fc8348944a090, 0x75b28c5873f71f57, 0x03e17c262c97dee3, 0xa3cf580cb3589ffe,
+	 0xf6e98188bacfc9fd, 0x71f75f7a13a0fa30, 0xae7fcaaed9221904, 0x9a11bb6c35845f92,
+	 0xc27b0828ba23d3ca, 0xc8ff85caf7c70bdc, 0x5e39c6b5c3ac90b3, 0x0fef29230331f018,
+	 0x2f84d9e0f795ec9b, 0xf22f8abeb405b7e8, 0xe80de1b12270e194, 0x0a2ee16b779f5490,
+	 0xfcfd3f6bad98d644, 0x2e8ac1013cc739e0, 0x75781d5879868c7e, 0x5e3649008c437092,
+	 0xf033a8f0adb3233c, 0x6cc1492d2aef3dec, 0x73324f4db4161fe7, 0x3c7e8c946b316e03,
+	 0x23fbf7ed88a3ae75, 0xb2ce9e6c567b9cad, 0x6dd9b0ba2545fc9a, 0x38b58dca39fc8f75,
+	 0x3c8a0a0bfcad2957, 0x1ec256a601f6e475, 0x0b1ba7ab061a1aae, 0xa969556dd06171e6,
+	 0x68579ef972144d53, 0xf95d75c147c1e80e, 0xf44bf7dcea17caa1, 0x47e73fcfddb4d663,
+	 0x76136c432b98dfac, 0x8dd180c2d2dad4f9, 0x232d4296cfa0b11b, 0x4831ae6f3f64e6f1,
+	},
+	{
+	 0x1a3b5e871e50e1f3, 0x1f22cfd868d2d5d0, 0x96a9a270f73dd423, 0xa423678421c8cef5,
+	 0xacb44f81afeac6af, 0x22e468b1e0625bf9, 0xe20c5efca29956f5, 0x7e281b83a347c811,
+	 0x2a7715a2f4f53ba0, 0x4e0e99712fa6befb, 0xbccb845d7eb7ca66, 0x991b4d060582a21d,
+	 0xdc4261a607509c9a, 0x7272b06751d63668, 0xe872050d4b4791ce, 0x2307c436b52cb652,
+	 0x55a9ad95c22836cc, 0x4113f665a449194c, 0x0149058a1561eef3, 0xb5361bc240b7b129,
+	 0x3b1bb1fc21904a86, 0x252cd27bbdf057f8, 0x0ec2728a7812a908, 0x3239e651cfe3a00b,
+	 0x325bc55be2258ecf, 0xee0f0c964ffd0da2, 0xed5e9e9bcba38076, 0x99de8cbcdaf9bd3f,
+	 0x85fc40ac6ec7f8e4, 0xe354f4c13fe4115a, 0xfc7feb0b0e6153a7, 0x6763cc4502b8c342,
+	 0x742ebba6218244e1, 0x436cf1a70fbc1e3f, 0x2c18485c60c7a3f2, 0x1c8355826eeee382,
+	 0x5cec52ff042d9fe4, 0xd516957dda462c79, 0x538a8f5163f266f0, 0x0cc062f8eaff1ca0,
+	 0xfaadc4f561ab2a5d, 0x0a500664601e0329, 0x2f797905b0d40a5f, 0x0afbdead4f6de12e,
+	 0xfcd6120af144a510, 0x6373677cca242909, 0xdba73a97a34e0aa8, 0x2d2e814be68c99f0,
+	 0x8a073617adfbeca7, 0x5030e2d1bde1e85a, 0x118d7f86fd259b6f, 0x5eaadfed75fa92b0,
+	 0x908a3aaf6d7bdce6, 0x0f277fe7a8a7d9fa, 0x0d9da1a2124db1a3, 0x86fc711211e0043d,
+	 0x14671a3d2aafcd96, 0xe17dffd67fca8fe6, 0x3cc9bd2c18c0e3c4, 0x8bb16a8466e727c7,
+	 0x050f4728c5eb7e85, 0x4084109aff7f0ea9, 0xcdefb29e2cae8705, 0x36f202f1877f2522,
+	 0xbdff6c5626070f81, 0x482d860567baf084, 0x22428f31550d2420, 0x13ac7ef7972f702d,
+	 0x4b48384403c869a1, 0x6077b06d8585e376, 0x20cc63f25f89e40c, 0x136bd1dc1b000858,
+	 0x62121e24876d9891, 0x9307294d418393aa, 0xa6a9a43ddf43e490, 0x1cc9523686ccc494,
+	 0x10efa90c0038fdd9, 0x997baa978ec314a7, 0xe77d9f6d5585f912, 0x33ffc31d7065b0f6,
+	 0xa6b9377ff4111db6, 0x1c8b77f4b1d375a3, 0xfaafa7d396d74ce7, 0x6dbc5d43aed37b6d,
+	 0xac7540f0b25ab41f, 0x5137df0d2e0504f4, 0xdc0857776242f42e, 0x439acbe1f9db68ec,
+	 0x12bc1bf7d71035c4, 0xb03dec5871c21fba, 0x0b243a69f957bc22, 0x2ae8e7aef81cc9a7,
+	 0x8f9e0d6ed2cb5e1b, 0xa9534b266ca4b207, 0x9bcb7d6f382ad15e, 0x32b6514eb2f03b7f,
+	 0xf025473f45e09465, 0x17147bd4e0c2199f, 0x0f79cb3d27db71c6, 0xafa424edc7da167c,
+	 0xf0320f05babf91d5, 0xdb93f98f68cd768c, 0xf2e7c93219d2cd53, 0x9f46c5c23ea73427,
+	 0x56c51f66fe3257eb, 0xb21911586ae1b310, 0xbb95c8ef6645dd83, 0x6da27b8f4ccb12e8,
+	 0xcd2f7009c67d8766, 0xb10228703a8d346f, 0xe7e5c1a9a03246d1, 0xae3c95c3368182e5,
+	 0x30219d7360d0fad9, 0xe3002e9c275e753d, 0x40eac95da27d3250, 0x75f2a2ece73cff5b,
+	 0x257ecd3204900dc6, 0x5166fc986a1b11c2, 0xd46991066e6137cb, 0x977fd65568565fb3,
+	 0x28402c4a56f8293f, 0x0d647a2dc6599463, 0xfe78fb6a17839b10, 0x0237c65967d0af11,
+	 0x337c9eb90d8a67b1, 0x73b05bdb49614521, 0xb04ba56a091a22e6, 0x2a348eb7c5a35ea7,
+	 0x4c0d3ba7d2013b4a, 0xc2203637e79d74f7, 0x007eeb573b710d50, 0xb5375982ac4e036b,
+	 0xfcad609ab816b4ce, 0x2a33b150106a7215, 0xa03414badc38819d, 0x124a06243d1042ae,
+	 0x84d9f9ba8e09aa4d, 0x356cf4363f7c69a0, 0xe9fbbbc8b33f3dfd, 0x0369e8091040068b,
+	 0x4f8437c06f2812eb, 0xf2513c5c40a0045e, 0x690f4f1e68f768c6, 0x58a724b5f3f92a44,
+	 0x2212907f11d9636e, 0xaa929d8eb4e311bf, 0x317ce35c26b832e4, 0x0620b164dbd090c5,
+	 0xe4697cec5428180b, 0x8ab4a6c0b846da6b, 0x57e50abcc3d690f6, 0x8bbfc4b08273b25c,
+	 0xfc87637d687e03b9, 0xa8e7366e6af1c31c, 0xfd529b69a08057a8, 0x12e0fb1d83ec1bf3,
+	 0x2fca70452c4a5362, 0xdf4df9b1064ab35c, 0x96c3db2e67fab065, 0x273795e651b5bc61,
+	 0xf7c118575249297e, 0x8d848e6bc38daf36, 0x6bf3653680218086, 0x6a00c591ed44012e,
+	 0x86ec400b19c2d5b6, 0xec420ff1c10c8f18, 0xc1a6343152a59733, 0x9d2249bbc1359926,
+	 0x8fcc640e6b2cbabb, 0x6139759652d05733, 0x66fb5c2537ffb269, 0x4e6a9049ea04e606,
+	 0xc2b8203656c67350, 0xa459bd6432da4f26, 0x79ed8df6e2c15d57, 0x0a4ce6377e3f4b14,
+	 0x2d6d973ef364c413, 0x4361f4be4bf76d87, 0x513795b5f946faeb, 0x52c6b4c5ad0db2e2,
+	 0x9bed433ac1d518d6, 0x7d754d10b85f3b62, 0x668a2cf943f62bf4, 0x351c59967c95f73e,
+	 0xefe90b9d0321567b, 0x6c0069d781ad3017, 0x1681acebfb5337b8, 0x58cfa7eee12af2f4,
+	 0xe1aa6b7d9470755d, 0x764f8f4e96193098, 0x77e6022430411463, 0x4e59788d856595cf,
+	 0x71b3b5e0d5e624e5, 0x5e1c0ed47a6d3892, 0x44d88635bbd1c206, 0x7c953445b8a4b8b9,
+	 0x7c0626521b949ae9, 0x9a60dd1ee03213b3, 0x7fa71a0baee39beb, 0x5380f620938452ac,
+	 0x85f484507d668a7d, 0xb633d59894f42247, 0x601fb150a4162846, 0x45674ccc4e0adf51,
+	 0x2a09eb040db516fd, 0x5b278e10867cbcaa, 0xc0ae335eac354c8f, 0x934017320c000b32,
+	 0x608ec22ff94eae87, 0xcbbcd2a82c54343e, 0xb97af0b3643d2a7a, 0x03413dd9417d1df7,
+	 0x8997b2c2aea51b15, 0x7213b7b3142b3044, 0x3c977751c0001ab8, 0xaaea1bdbd81baa77,
+	 0x3a63d8ee40748254, 0x98ddc1d2d5d49e14, 0xb4b5c34b99223947, 0x569c72f0aae59744,
+	 0x6045ac75f33405b6, 0x7fb5048c3d5f6e0c, 0x25de7405e34ced8d, 0x43e4542c11477677,
+	 0x7f2cf7fe55608492, 0x2936c7b643bca331, 0x0e8af245ce5fd90e, 0x50951b057b264bcf,
+	 0x5f2c814e7d77aac4, 0xa33a71ef5d4146b8, 0xfba9fc27020ef463, 0xb352e71c0170c95b,
+	 0x51093dfe4a8a7bf5, 0x97d40bda6d0b16b9, 0x0bcbefee1adad6a7, 0xb2fb3fb37aebb696,
+	 0xa21bddb9614fe800, 0xb76c61de98e37213, 0x1442de2ad715c96b, 0x95edcee1a0a3341d,
+	 0x28d611efeafc677d, 0x31f95ff1ba0da434, 0x6659c8b674e45f51, 0x3b769f2fe281c027,
+	 0x06d43bac33263677, 0xcd730ca4843749f9, 0x1909a28c87805bce, 0xa66e79c5fb06565d,
+	 0x715934c4c61a2885, 0xa8899055734acafb, 0xd63a3eaa6ee86323, 0x659e929968c9ee37,
+	 0xa75f2d6a0779a81e, 0x3e215e9492989f93, 0xc7648fbc30920d40, 0xa4e1735b8f5321cb,
+	 0x368215391c20ace3, 0x9c73104ebcd4f81b, 0x04ea1cf688a2bc25, 0x1f377748863edf82,
+	 0xb128437dcac795e3, 0x8a44946ec030546c, 0x20db3602d3c5518c, 0x6d42a534e74ef7e4,
+	 0x74becf9696a525af, 0x3a518e7af62241ee, 0x26cdc6a80dc344d3, 0x214e97e9da870dcd,
+	 0xd2e21d589a55fd28, 0xc1bfe7dd76df969c, 0xd54c69b1a978a0f9, 0x804220765057ff79,
+	 0x975e034f70e96855, 0x05988a6d9166cac2, 0x6a721129e00f7adc, 0x5e5a7656c383a3f1,
+	 0x17e0b6079eefce01, 0x1f6ebd88db639153, 0x19e13b3e89dc5fa7, 0x5d2035dbd02b6af7,
+	 0x027d8ce99a075dd1, 0x33e4aa94f7636ca7, 0x7c41da46e034d7ab, 0x72e4f8b6750fe85f,
+	 0x2bc8f0f0d04a65be, 0x736c1281ed82edb0, 0xe66497b36aa63265, 0x5ae7eb1107b9baec,
+	 0xd40d034f393f8ea7, 0xb40377f9bf96732a, 0x80caef98f85d0cb9, 0x4af2f3a63a77f68e,
+	 0xe9121d281e9e8aba, 0x49437411aed647dd, 0xeef27b152a4e6ad1, 0x55b5e2af7d745c4c,
+	 0xb457cd4ee6491f76, 0xdc640220a811b1d4, 0xcc0963523ada0968, 0x2cc4f3ba261b54a3,
+	 0xde1ece1ac0f0b758, 0xf8ff11dd6a100013, 0x44e099dd50958b5e, 0x95a96f3931b24977,
+	 0xdcc8370357e68b7f, 0x0606f9cbeb276bef, 0x727b2f24941e6807, 0x432780b5a2da09dd,
+	 0x0d0bcd877dc4d569, 0xbeca29ce25f36457, 0x767970c50ff20a1b, 0x9beec9425e014623,
+	 0x18de2b1d13d41fd9, 0x7e24c24b6355f623, 0x4e8a25f13937bc3d, 0x5ac217057efeac52,
+	 0xea6f311dbc6529c3, 0xb47709fec8988908, 0x94c16e14a42f9562, 0x98c539656e7175bb,
+	 0xf07c4229727e689b, 0xc69932d8ed031cac, 0xa05d64546ef4d841, 0x830a00a256434260,
+	 0xb75797869cfcb5ba, 0x4629e0eb48cc8786, 0xeb6f664cd4e5cc53, 0x3dd0906fd8a21cd9,
+	 0xb2ed80ca768451dd, 0xf52f03e0fdf27eea, 0x35dac37a36a3315b, 0x91e2ad3f9977b1fa,
+	 0xe6a613efaf799312, 0x5c65d0ea515aaf3e, 0xf531971a75025d3a, 0x2001b7ce6bb026bf,
+	 0xccb4526b156d88a2, 0xa1be5d214d2fd814, 0x0efaeee162a72115, 0xa4a24d7b96c20c65,
+	 0x516a21ec1bc41547, 0xb2ccae3a11a520a9, 0x6f55a67c610dfab1, 0x9716840ee7658c82,
+	 0x897569d17427bf6f, 0x411b280bebc75562, 0x632c7c6b756c8413, 0x1c89da913320f39a,
+	 0xc274640a5289fffb, 0x325a98be801f7231, 0x43380fc34493fece, 0x3bb56b2c2021be52,
+	 0xceae11340421b91d, 0xefe2d41ca9037fd0, 0xaa9e777e314bef34, 0x5c4500ccc591c357,
+	 0xa4e298b33c04c4a5, 0x57935131d5e21ea5, 0x81575a5bf25fca06, 0x3c43d9c2257ae6d4,
+	 0x5485a4d2ce469d99, 0xf8f7bca4a6142227, 0x159c8b05cca71a16, 0xa9750f0c7eda70f1,
+	 0x7eb4249e21e72698, 0xb1966a6f293d62a9, 0xd54ec2945a938988, 0x0911a598e33568cd,
+	 0xd3f2b83de1c5a810, 0xc3b6652fa97b3c5f, 0x358ed3d9f1faed0b, 0x5c0aa2f98bacce18,
+	 0x403b4952b5d03e30, 0x501b26d077222dcc, 0xc607812b261c6cd5, 0x94038088231bcef5,
+	 0xa99ddb606d17a58a, 0xcb3be6d3c2a91ed2, 0x1f1112715b8d9e97, 0x137560796b92a11c,
+	 0xa1e3c0b7680e93d6, 0xf1da10600b610b23, 0x3eebda6c0d5cb12b, 0x4f90720a4052d266,
+	 0x412eccc6d4e71c5f, 0x2ab9c5998517abf7, 0xdab5b6929fd281da, 0x833692b095485b9c,
+	 0x3dedfcd533f9fafe, 0x269e7a4a40cb035f, 0x3eb2d46b4141e802, 0xa184b82d88385e98,
+	 0xd3c07e870254f9f5, 0x7de485312367da28, 0xa820643c7bd847e9, 0x4285efe0121a12b6,
+	 0x823cba12e77b8c5d, 0xf5a3558796ec981a, 0x638e6f4987d477db, 0x02b2cedc6ef19d95,
+	 0xdc447d30c0fb6642, 0x59d4dc3139a8b491, 0xad6d47b40c6afe32, 0x9b92ed41be2a6625,
+	 0x81889e2a28719e79, 0xb928546515354b6b, 0x120f2bcb60faf093, 0x5700020260f3d558,
+	 0xb39bdd546d4b8ade, 0x5b72b1c38d506ad4, 0x94ab41b7ed82ecc2, 0x7cbbf539353bdebb,
+	 0xeda28c14f6ec7a60, 0xa33da66d6593c2f6, 0x5bb1a6c594b709de, 0x20ec4a84a820930c,
+	 0x504caa2d6d2c7a7b, 0x01b172fccaad1b58, 0xe37d13732b04c285, 0xa5a8e2ad9d6ef63a,
+	 0x1b325b0d3f6831f3, 0x4971323768846c1b, 0x7a08fc44d28619df, 0x51b235c3f481efe7,
+	 0x3795eee00fec3b75, 0xaab1ad9885d6859a, 0x7f82f9bdcdf7531f, 0xafeee7fa25d25314,
+	 0x88f7462f2ea4a778, 0x490de991881f9a3c, 0x4208d758f5a2b2c5, 0x098b3435c4209469,
+	 0xd5819b78c1d6479f, 0xbea72aa17feaa429, 0xdf4920600e3b58fd, 0x21a7489aa9de931a,
+	 0x1245121c1bb13176, 0x586bce07e84777a1, 0xbf30eb216a8a94f7, 0xa28c174328e6c730,
+	 0xe8e819cb2ef071e9, 0x2d12fd60bae39ac3, 0xfcf79ee0118d5622, 0x4a3efd57e7a4dd02,
+	 0x2f86e2ff0d49daff, 0xd7e75ea6f7a763de, 0xe7d04602378ce34c, 0x009d2f7f583895f5,
+	 0x8e796b0e0fe9312a, 0x9bdf60a7dfefd5b2, 0x6d063ef165529c8b, 0x747134ebac80470c,
+	 0xd4c307081b20c60e, 0xc9963052ea28bd66, 0xce0312facf2f2476, 0x5584a7423f592a77,
+	 0x571461922726c62d, 0x47da159fc87c37e6, 0x56b01c2b4ff1cd24, 0x5f6a1cf30ca1bdee,
+	 0x8b7e4bca84ceea3d, 0xb3179198cbec9c67, 0x82bb003bc2559515, 0x742e698e9b46a623,
+	 0x53b6f48838f73b07, 0x17d9a6bf730e082f, 0x4452168d4267473a, 0xa6cf2ef778f2d6c5,
+	 0xbf56db7a93ac8559, 0x9929a4a7c7ea1ece, 0xf380600766bfc825, 0x2584dc051fc4a433,
+	 0xbbfce89e27340205, 0xe9f910744233189e, 0x6705044d7b07aab4, 0x08b312fbfd5984d2,
+	 0x70a62fbccd0740f7, 0x12ffc5ccf49ffd5b, 0x4d91a2fb4a4db090, 0x07448219578aecde,
+	 0x8bc9b4549c53ff8b, 0x8d8cfcc0292281c5, 0x9676b5bcae9e5e9b, 0x2fca27d0b1c140cf,
+	 0x76c1abfd91471bcf, 0xf27a317342dee8f3, 0x29cc68799b70a1c8, 0x05fa36673adebecd,
+	 0x6dbe39b9689f88ba, 0xd8d5156570b3b09a, 0x431dc954c7660e72, 0xb626abaab2c1367e,
+	 0x01a3c9cdc0912159, 0xd9224effbeda3f56, 0x2d8169d0a457c19a, 0x85205b33df72c8f7,
+	 0x46e30d28be5d87a0, 0x9e6e3c7de2f3a161, 0x51ca0e1f7f33ba4c, 0x4ed89419152753ce,
+	 0xfdbf072483174bfa, 0x2ad1a283d8cf74a3, 0x0531eb91565152aa, 0x7e54e8f77fc34a61,
+	 0x471a4e493d88af42, 0xc1d2e8abb7123154, 0xa95553abb1e17d75, 0x15e85473694a1919,
+	 0x4877edd29596eaa2, 0x016da1beaaac82d4, 0x4a4d95ae62b53d3e, 0x4badf798e93711e5,
+	 0x5fcb5288256bebd3, 0x7a7938e6cd653af3, 0xb9db2ccaf105656f, 0x4b9a926d82ca8c20,
+	 0xa39e2c32752774c2, 0xb0bdb8df23f34048, 0xff3a99dd3b7f646a, 0x1bc38d47cf70270b,
+	 0x20e0c28ab93e187a, 0x988cb9a2054cdc2d, 0x5af7c0223d9f5c5d, 0x2b6844902addb91a,
+	 0x957090360ce21873, 0xc8a183f9fafd4555, 0xeaac3ee99a2b3d1b, 0x951037d4f8d17a02,
+	 0xfb25ee328c4927ce, 0x0a7541585b571ca3, 0x3f74bc02386a028f, 0x45176b16762a649b,
+	 0xa01e3669daef2294, 0xa96b14c91cd26595, 0x79cff5e07524d700, 0x47802730ca979a6a,
+	 0x2980a9e38f2c0e76, 0x277a07ac62184192, 0x1895a685979d6d8d, 0x5cd9b4d3a984a81c,
+	 0xa6a49ec43d618ea1, 0x11372cfe53c0df7b, 0xe25dce582082d44b, 0xa6b27a9433ba2566,
+	 0x30f52b2995200c16, 0x2fdcbecd70290aa0, 0x51ae7ab64956e72d, 0x05e7eac71318d027,
+	 0x98c5d423f924e4bd, 0x14bf1b84678eb063, 0x35006ad832d8b8aa, 0x2cc72a4dfc9fec5d,
+	 0x15a36b595b74d897, 0x314e9e87586b24c5, 0x4dc5f87a51dc0120, 0x6a7103e09ded558e,
+	 0x098d9922e2990321, 0xeaf15f5a0c11cb14, 0xeb94f5129f06da82, 0x74b4fcc9af0b7f79,
+	 0x3b00cc19162d6b3b, 0x05d1699bdb41242c, 0xa72421345b54bb50, 0x90228bbfba78e4e5,
+	 0xf53d4ca2ae9b9b66, 0x718384f4b2e38caf, 0x847d706064cc419a, 0x68e8b91eba5327e9,
+	 0x9e24b16f9145c982, 0xcaa1c4f038346b30, 0x7a6d56003fda7fa1, 0xa6e2bd50cc415adf,
+	 0xfb034d2b2de03b65, 0x245614e9384ac61a, 0x3fc34c0289f543c9, 0x76b4be8e1029eb67,
+	 0xfea58e6f8b939f26, 0xf398373250f948e7, 0x003f1267a4c755bd, 0xa40fca0a2ddb20c4,
+	 0x1788c868e4ee0d67, 0x9f6531d7fb6cc6a8, 0xdbcf59dbbe612dd8, 0x867ac75e6d75036e,
+	 0xf73990cd7812beb3, 0x75f56623abdc2388, 0xa14cddfd0c663019, 0x6b12c13f4e4fd7f2,
+	 0x224ec4dbcd53ef75, 0x357e6a6c260926bd, 0x13845bfe55746042, 0x6b503def8a8f44fe,
+	 0xc91c68b3b6e63c65, 0x1847905fe51bbe2d, 0x16cf60c1a6e362d6, 0x90b0289b583c3e03,
+	 0x280ffde65e559968, 0x7f49c40772c1b17a, 0x6c6b4172a79349be, 0x4f678ec446da7552,
+	 0x4e8777d6ccd508f4, 0xd3ce4a151229cf95, 0x58a5e4681da366cb, 0xb2ab6835960e134b,
+	 0x71b0ee4b4deba84c, 0xd786518284b2e054, 0xc56fa3cbcb284188, 0x5c2326d2d8e92ffd,
+	 0x2ccce8877d25e0f9, 0x557690f95f103833, 0xd1f7e8a146c36bae, 0x8736ba971dc1fe96,
+	 0xf1f5fc42eec27ba3, 0x5c84ce6e1baf8045, 0x0670c1b459f22495, 0x5b6013b0502e6c4a,
+	 0x1264643d42fdf817, 0xc3b571cc05f2ad40, 0xd6a30dd729000a25, 0xb37bf7e012f82d44,
+	 0xe68ddd4449030645, 0xbc0e1fba49dcc1ce, 0x60b52b028fa40a42, 0x9e3fa13f468c7d41,
+	 0x375cf3ec18583ad1, 0x77337ed93d8ef6c2, 0x12d0b2f2bdb6dff1, 0x3408cf2f0ed001dd,
+	 0xeaddee42541186f2, 0x094cbca302ab7c38, 0xfedaa722a69b2422, 0x50832a11018f90bc,
+	 0xcfee594e70507dbb, 0x9e473d445f519163, 0xd285430ddba1f9ff, 0x1861e6ba598ca56a,
+	 0xffbe0179fd1b83de, 0x55932995a89e177a, 0xcd7a289c2e789ac9, 0xb1358f6be7e9dc77,
+	 0xf3cdb054068938dd, 0x3d113ff7abfc18fc, 0xf0512021ae7b56e1, 0x6119ee3bbe9be80c,
+	 0x689fc8e40b4e44df, 0x689837e3f957f92b, 0xe9dcd8d787dcc1a9, 0xa142ad7f88dc328b,
+	 0x4bb368c594fa26fc, 0x71cf176b86842243, 0xc65b60b64efbc1f8, 0x8792c0f074153e92,
+	 0x4f1ca1f1dcd01667, 0x440ebf540d616d15, 0x8838372cf31b45c3, 0xac0c95dc9fd19587,
+	 0x89125095e353576b, 0xe620ee5e594566e8, 0xb54b0ad844a51e6f, 0x376deadbf113d425,
+	 0xdb94b4c7bf9e763f, 0x10303e8b7020ebbc, 0xf640c2f0cb658fc9, 0x97f49b57a72b15f0,
+	 0x5fcb5586ff612ae2, 0x8c936a74dfd11332, 0x76e4ead905ddf920, 0xa614748e87d2909f,
+	 0xa13ba92744868889, 0xb77295e91d2f6959, 0xc6c7e14d7edcc515, 0x6bb6cfd10e022127,
+	 0x920a1ad7c0361531, 0xe051ab41287aef60, 0x76d31256c31d7880, 0x7046fb87036d7f70,
+	 0xcd2f1fa95ce209aa, 0x13b719ad62a67421, 0xb19869639a49a79f, 0x1d20a0aa2b640dc0,
+	 0x72c091174e6e8c7a, 0xc5f924d9163647a8, 0x323515cc139f560d, 0x7fb3f45cd787e991,
+	 0x13dece6be0802a45, 0x389f56ef20f95bda, 0x06a2e22c919c5e25, 0x0e755fe965b56df9,
+	 0xc4b5237d6b90771f, 0xd58050aabd9e13b4, 0x6ed87ad402f6982c, 0x8f0972d202bb8f7b,
+	 0x966235b36346332e, 0x488c4dc672557e88, 0x91f2971458d6d5c3, 0x36bef62b2cdf5eb7,
+	 0x87c67cdeebe8d973, 0x0b42383036042380, 0x275240ed5f9609f4, 0x77bebf70c20dec7d,
+	 0x55b919fa3a90e52f, 0x918366a1d6f93bdd, 0x36d3b3f97f58a732, 0x7a84807f1dea70cb,
+	 0x7436cf0c9f8d528b, 0x71cf94ee15f0d39f, 0x73881e8b7c0a4351, 0x8231c412ac35c1cf,
+	 0xefd5f9678ff9dabc, 0x078586529c2c080e, 0x87047861f1eccedc, 0x515e3e1a7581250b,
+	 0x94f66df480555767, 0x6f94c114255023b4, 0x7c50769321d99317, 0x047cc7cdcbff5aed,
+	 0xbec73a1304d8f2a3, 0xfebb1330738e3cb5, 0x227bf50bbb888188, 0x8bb64e70b35f550c,
+	 0xe162e9be60e5bfe7, 0x288b68f411e72b23, 0xf04624172337839f, 0x5060369a1616591e,
+	 0x33cae5fcfd7118d1, 0x3dbfbcb1b095a596, 0xa9c364ce296db594, 0x7b8d33ce960aafd4,
+	 0x577750e17aaf0a48, 0x76171bdef341d0c9, 0x2b0762afb06fbc3d, 0x92db0211d0d48aac,
+	 0xa31fc1b9c1be9830, 0x7f242a9712c0c9f3, 0xee0d5c4959008d1b, 0x916b6b367a1b378a,
+	 0x2c6c958495fe31d1, 0x201720fd7dee2505, 0x92c2538944e154b0, 0x393b02da96a3e5c5,
+	 0x3c8aa263799ccce7, 0x84f0a17a0922da0c, 0x1ac8758fe83aec78, 0xa06f1830924fbe9b,
+	 0x177083b2be30263e, 0x798775cf6bf06bc5, 0x33851950f8eea58a, 0x95fe3e2630b36f45,
+	 0xccc7c6769309a7c4, 0xed3c2bb89bf930ef, 0x226b842d54276632, 0x7cbbaabe96a5eeee,
+	 0x3be6fafc086a704c, 0x46715e4eef3328a0, 0x3902ca40cf259f4e, 0x63be41d109760bb3,
+	 0x3a7072d2175d2e26, 0xf0442a4d8d2cabe1, 0x0081d3781e689e6e, 0x47a80e1426870508,
+	 0xa27b70c73d0d4bf3, 0x91f0cd72519fc37f, 0xdd7123088ea03d69, 0x432ec84146e2a4ba,
+	 0x56822b07b63a8e6d, 0x0a52bf5cc2111aec, 0x5cd79343d214188b, 0x687622ee82bb2773,
+	 0x95c8d0674788403f, 0xde8dfa20e4c41330, 0xc29da1da33518772, 0x77b4eec60aec3ca5,
+	 0x33bf036ec562a743, 0xd67306dcd1854026, 0x9ef8d29c68083654, 0x20b8ca9463339ee2,
+	 0xd8f56ab7800770be, 0x5b32ff7a2f805fda, 0x67ff32a7f829f221, 0x4274bf8c68c1020b,
+	 0x527f18b0c5a7d20d, 0x04fbbfb5287877b0, 0x72cb5f056dcfefe0, 0x1de31ea4e6e60c03,
+	 0x593afb269f8de549, 0x5d99598ec1003b5f, 0xcabc6168fe172cac, 0x3d9630fc355d3171,
+	 0x63d46fe1b616950c, 0x787f80542c30a139, 0x262e85ee05605138, 0x113ab8b28e02becd,
+	 0xee819285bff9afdd, 0x257cc306266468d1, 0x09bc38fd1700927a, 0x1b35ae31ef620051,
+	 0x6a0069897baa9e8d, 0x42a0e0cd89e8e279, 0x63a243341a603247, 0x5dbd0db5e7711dbe,
+	 0x267c0a7694e51a1b, 0x288ce84d34df0c8b, 0x7b260e1552b9f725, 0x1d9c02d162feec6a,
+	 0x95f8fa09a1edde6d, 0xbb406222daf1ae92, 0x877e7f96b5498654, 0x7774d4a39086aa53,
+	 0xbe0f892e16fb84ff, 0xd1b7833112641a5b, 0x60d5e26b7d632079, 0x7062e7ccb68f9487,
+	 0x54bce4d571e09710, 0x862256ac40857fdb, 0xc38ee334816589be, 0xafc4f12d625a8178,
+	 0xb951f2eb11fe6249, 0xe41a742f3d4daf08, 0x95b08b187381c826, 0x658961f8032451c6,
+	 0xf3138c0d04b9facb, 0x875528f415374b50, 0x48597b665a166e19, 0x91af536bbb0440b0,
+	 0x854f04ce4adf1e9b, 0x04721b73c17b7aaa, 0x017c470e6c13d0ab, 0x2e406cdc1fc7a683,
+	 0x731eb444a7c66e91, 0x8c5612e9d9704820, 0xcd7293d228f31ef1, 0x86a15d2434e39317,
+	 0x168aad268aa9cb47, 0xb2397656645c7222, 0xaa5edb9020eaa59f, 0xabefd0e176a25e3d,
+	 0x231770a92e92e4db, 0xaa23d73e05fa8d02, 0xde2beeaf09280c5c, 0x71b6d904fd7dd412,
+	 0x5ba67cfe5054fb08, 0x97c30d083671ef30, 0xbdcd3e9a78cdc24d, 0x2e6844596f63b4d4,
+	 0xa20d773aee22bd5a, 0x9404d4864a28a8dc, 0x80ac5ae084171777, 0x1c58c00ef0a354e6,
+	 0xc8eea9aa1a284e53, 0x2c8f4708213b1ffb, 0x236a445204fca03d, 0x4da8b1b44892fd84,
+	 0xe8afcc458dcadae6, 0x2e4932bf34dc81e8, 0xe9b6da94fda3986c, 0x2654a6b4258a0812,
+	 0x7ea477ec5c193610, 0x8a89a3ee5cd2c14b, 0x02cf9fb638cd5f22, 0x6227929f405748fd,
+	 0x2516f95e9cc1dcd2, 0xb8bca13b39403224, 0xf294614df48a5489, 0xa4fb508cf45ddc79,
+	 0x6353bc46602938cf, 0xf6e20d3ba5fc3283, 0x5d0d389ba2b2425e, 0x3b406f038882eb74,
+	 0x669bccf150b06ed5, 0xb5b1853361487f19, 0x86a733a7c32c08c2, 0x464c311624ca0725,
+	 0x0959e58a3a4c89e9, 0x3e677043c47c77aa, 0xb0b951cc09c14341, 0x978cb6411656f759,
+	 0xf5f8b8b7e0bc2ba2, 0x41ce794fc6595d61, 0x304d96b67ba95f06, 0x286a6f6e1a15cd75,
+	 0x8d7e5f5a34755013, 0x0cc0ee45018f5e0e, 0xd058a0055e53184d, 0x1a03dd5f1c237a06,
+	 0xd089a48d96aba751, 0x06646c1486c003cb, 0x33b8f0451528d478, 0x0bae29f4a7cff739,
+	 0xb693f6ce5dd2bd9b, 0xd8336f6427da867b, 0xcb73cbf3b9445bd9, 0x592e559475a3b2fc,
+	 0x0e5d2cbeb28e13da, 0x0d20c1a2af220e00, 0xce69801a08040931, 0x998b953ea36bcb69,
+	 0xebdf268ddf3171c8, 0x463b93a1a32657a7, 0xf49a62311aead96d, 0x526c3c8aae550a74,
+	 0xc7bdd5bf962f94d7, 0xb9dff398c596e585, 0xcda8681093b12b6d, 0x2a9fbf8da83a2f1e,
+	 0x428e9818d8927d34, 0x4fd24ba13225d0cf, 0x56d3c35b4eaabdc6, 0xa14e64fcafd9aad9,
+	 0x443c8f650eeeea26, 0xa5cae0da1a582a6e, 0xd09314faa2477ccf, 0x6a211eb7eaf5bf23,
+	 0x8541de5a750d074d, 0x76f61ac528fc9457, 0x4c886eb8175173ac, 0xa7308a89a22f7672,
+	 0xb63f3280aba33ddc, 0xe350e685173224e4, 0xbef0720d66b7e392, 0xa374953189d60831,
+	 0x37d6d7a8919b04f9, 0x30bab369fd22bdf5, 0x04706782ccaae1e0, 0x325ee56778e41cac,
+	 0x50aa218da387da88, 0x119e85bdbb461da0, 0xdf7ea0e3dfb9ca4b, 0x1e35b45512c1ab9d,
+	 0x27853cddc859e586, 0x4cc4bd8c2dea6760, 0x6817c278093f2dd7, 0x96ec79e9bc141a14,
+	 0x168a56e7cc8a9dfa, 0x66c2f0eddeb71549, 0xc79ce76437890a6f, 0x38b32e9179a22e14,
+	 0x1a6f69be3df41443, 0xc90a85bd05db2f60, 0x03a3ca476c46264a, 0x3e4b08b1bfcc1de1,
+	 0x70eda435c9ffc215, 0x888077004a0f1810, 0xea0400985bd102d1, 0x70d4db1ad006649c,
+	 0xec488e5daace9887, 0x81e1910f21fbefc1, 0x9ea7f435029832bf, 0x6b6ec9978d5d94d0,
+	 0xb777349cada2ec3a, 0xcec6c0589e01ff63, 0x233e39ba0b8c0f2f, 0x9aff8bce734141a2,
+	 0xb21bdb8e3bcf4a64, 0xc4c5fc84b4c8dfd5, 0x7c87e2e61d516f48, 0x0d750396550141c8,
+	 0xcc6ede7cd3149242, 0x4a353d0d33f4b5df, 0x325f19a27947d6b4, 0xa8f3b0f9a0951b81,
+	 0xcc8e88430f803f8b, 0xd57cba96d3696a2b, 0xde0e31bde8f8416e, 0x7d54d79680491dad,
+	 0x7634fd8fd547c3a3, 0xd1f4f997ebbd6d24, 0x746054998b23557f, 0x14fab323538a0f9c,
+	 0x5106fd2bc913966e, 0xc47c7b0531e17b65, 0x48fb4484d823eed2, 0x979d45e1bd12c4e3,
+	 0xefac72474a207399, 0x38319fdc0bb540b7, 0x3d8fa4cc6f044298, 0x2a2e8a3628bb2baa,
+	 0xe7cf095d6674664d, 0xebfa64f68374590d, 0xd1ebe942ede80d35, 0x2bbdc6837dbaab43,
+	 0x2e4b063be6703374, 0xa8c7c662dd6a9d31, 0xf951b4a3500feffc, 0x64c6da2e47a964a9,
+	 0x0668c71537e2c5f8, 0x522645d871c4b9bf, 0xfcc6a68dabb340ec, 0x8f1464d068399311,
+	 0x61b4ec7f1df0bd04, 0xaf6fc825c86e17ad, 0xa64a06fe4290eff3, 0xa26c01fd077fc18a,
+	 0x787193782a075d32, 0x8878266353e79b2c, 0xa90af92f6aac298f, 0x50a9fd7d921df7aa,
+	 0x1116036fb195fe4f, 0xbd11816313bede43, 0x85d1ee6301250abf, 0x0c1d20acc93f30d6,
+	 0x2da0eb663e391de9, 0xeffc6cb4d8fbd914, 0x34026d40e79c8b5d, 0x5ac4797b53a2c7a0,
+	 0xfc887becefd870cc, 0xff5a59d109dd9625, 0x6b471f84ce3385c2, 0xa6b410275bc4568e,
+	 0x66fc0f09c9d9e3ad, 0xeee7f5e0453218eb, 0x14e9c120204486c8, 0x11d102a2050c55dd,
+	 0x1598fb417390bd8d, 0xf8ad372d0dfb9ec5, 0x792644940fb94f72, 0x4e0d6528f6f9135c,
+	 0x265a35459d241369, 0x775373a63ef271ca, 0x725a4012268753ca, 0x4bb1fb3cef0f831e,
+	 0x18a375a0125aeef2, 0xb2fc10621861b357, 0x70eee7c9c8fb2d55, 0x8464ea6d118b70fc,
+	},
+	{
+	 0x98c10b3d8a032f75, 0x13ce84019fb8dcf2, 0xa79e7678d943145f, 0x9680eb14aa5fd817,
+	 0x22e89db4e568053d, 0x0cf4aa1a46eaab60, 0xf987243876b06feb, 0xa1319b27bf8d952b,
+	 0x4a85104fb93884ed, 0x5249c1410a88827c, 0xff5b5822609b6cdd, 0x113d6b3d0de2846d,
+	 0x9f7844b846aa8c52, 0x001b23738d8dadc7, 0x43099c8708ad4ba4, 0x6f368d2b9ff2e035,
+	 0x9e0672f2dc99d8ca, 0x393e42c9cba1b46d, 0xc512944b8b464e58, 0x0fcae8e2c00a7ff2,
+	 0x202e5f8a0b99f68e, 0xad2e07fcc9ceabe2, 0x68d4fbcd6ddde1f4, 0x11b2310c02361c64,
+	 0xa29bbd548b7ce6e7, 0x9e5f12c5b02f85b1, 0x8fe5e2cb5fbae4c7, 0x8de60d6b1d4a0902,
+	 0xa59cba62403964bf, 0xa1700ca13be70d20, 0x91bdb5a636ca3684, 0x5bf469ad7bde774a,
+	 0xf1c38e6bb38f8172, 0x143793325c1847ee, 0xf76f228315d7c7ab, 0x79eae05c3c55e9f1,
+	 0xd2f9a0666498062c, 0x95f0276e2d6d96b8, 0xadb44f90432fd37b, 0x2063398f7f40e609,
+	 0x32017166264c001d, 0xaa79c01b1664f51e, 0x423c5332970296a4, 0x1f2962ec98bbbb25,
+	 0xd84bf1d30682822c, 0x94a4e0c3f76c08eb, 0x7d8fe588c83be3f4, 0x7ba9be101bebc1b7,
+	 0x17efe91d8fb2209d, 0x8cf7a3f3e6e272ea, 0x774e7031a3e9f2af, 0x888bf5789ac89235,
+	 0x4fd540d071ce1f81, 0x30f7bde72d041054, 0x8648aaa3c245116e, 0x3d76d4fe71ca16e2,
+	 0xb90c80ed47b42950, 0x7b93c8678e672bcc, 0x12d232977692aa73, 0x1de813ef68825fd1,
+	 0x1ee7cb452d5a058a, 0x66de00125f02e088, 0x873abbb538085880, 0x9409df203ceb949d,
+	 0x9e175d8b0cb96702, 0xb53e4ea9da31af4c, 0x72b26a2c72b7862d, 0x55e5d17ac106aa24,
+	 0xf5fc362fd2383f0b, 0xa0cc58fa1aeb976e, 0xc819a3a441447915, 0x11077323ef2d96c5,
+	 0xea378c7d75e7c4c9, 0xdf29468ee4d8d8d2, 0x1aea481122967e3a, 0xa9aec61c0c8791b0,
+	 0x9d3438bcdafd0e02, 0xcaf0f9a681959cd8, 0x7ea0352985bcb6b6, 0x9850c437b11dd534,
+	 0x0a221bcd04a0a9f3, 0x2b4b08b7f9b24d55, 0x41d6f0d7861eb095, 0x94009bcbcc18682c,
+	 0xce51eca676a52fe5, 0x949c9e6addc7ed2a, 0x93b36b988d6cf410, 0x8503ac08c5de6af6,
+	 0x6d3c0355c5677ab9, 0xe1be61807a59b054, 0x235b1b5363f848fb, 0x16fd37424bf4193a,
+	 0x43d822ffd79c0e6f, 0x0bedc53743b7af46, 0x193efbec5e661d35, 0x503e42923474f5a4,
+	 0xedf879bf02f660ec, 0x304b5965bffc17a4, 0x6d5dd85eadb9cb0d, 0x235641fe096a0755,
+	 0x011ba2891cc19420, 0x5fd9ede1479db0e3, 0x6e136c5f76f07602, 0x5a1a1cf202a59ef2,
+	 0x26c50c13125706b5, 0x98f26be81e19b355, 0x4d659db6c1b4d524, 0xae1bc18aead5f1d2,
+	 0x2d6211f5d5ab5dde, 0x7e9dc484e223d05d, 0x87472ddce52da67c, 0x621eb391a9f79097,
+	 0xbd8e50a6d2f58c57, 0x14ae0a54376ea43a, 0x948566dc1cf9b148, 0x4688ca2a90f096c8,
+	 0xb84c9dc53c76e208, 0x291536a6aaa98757, 0xccdd8ed62302b216, 0x78592dd3ee7f9e25,
+	 0xbb98798b178f2cf4, 0xb023558393db4340, 0x6318cde63ce9e92b, 0x4635b325b3ed30c1,
+	 0x78acf151decbe9ef, 0xc5c3ba825c94dced, 0xb93c7590ec10866d, 0x49819b5fe939417b,
+	 0xd2524e7a2a06d86c, 0x803b76a35fa62bd4, 0x5d51fa1fa7a869cf, 0x1dad6fc75c491e43,
+	 0x9ff142a22bfab7c6, 0x0dccdb765516823b, 0x2db7c3a86b437956, 0x3dda46c36773d690,
+	 0xefa8abaa7470b84d, 0x199aad44212d321e, 0x9e1871189beb7fce, 0xb18a2996c86373c0,
+	 0x0c02b737f5bddb0c, 0x3973bcd9fffd5f7c, 0x68c94caf00faa35d, 0x13cf85c51dca1a9e,
+	 0x7865d76813529b55, 0xc7996d781f637cd9, 0x48fa0a1a85d10ccc, 0x5541c01ae80d4173,
+	 0x4e78e01f89421df1, 0x8e9e5ffc1820abeb, 0x78e81b47d74fdc36, 0x8061f61b66a0edb7,
+	 0x5f95787bb479d071, 0xcff01916cdeaa014, 0x2f9afc425e0bbe82, 0x2891e4e544b8c04f,
+	 0x159b15f03f009446, 0x7c7c6fa3bf52724d, 0x78bc57c03b3a3c75, 0xaafcb136fcc9efa2,
+	 0xa6f713b03cab36df, 0x7a6f31ff09c28994, 0x48159e7988aa587a, 0x55154950f7d09881,
+	 0x46bf24431301f0b1, 0xd0a54751ef5a738f, 0x43af0310520fc584, 0x64614c1990aded15,
+	 0x795e97c03da19a76, 0xdaf3383a51057d8b, 0x9c9e9db1dece457d, 0x8d4ee5951fcc933b,
+	 0xf71471d3a5ec3d3b, 0x5d35aae88f4a56d9, 0xd49ed4404012f5c5, 0x03213d459cdb6f08,
+	 0x1449ff594f96ae4f, 0xd35c8d77ff34ad97, 0x738624067150fdfa, 0x25225b9d1a6bce81,
+	 0x61e8cb01436e2282, 0x13d943196ac1f9d3, 0x1159560bd12c4fc5, 0xa8f62d817ad88947,
+	 0xde29fdc8191688e3, 0x5e20ca9900692974, 0x199f2dbe3655d860, 0x340d6c01e3fb873d,
+	 0x9a55ad5b587bf460, 0x3b0467d1e2b92a41, 0x811cef0607a30aba, 0x056ce43863bd3466,
+	 0xe2e1b87528cd5529, 0x6e4a3990bb627f24, 0xfc3e10cb2687d6a6, 0x0fb1ad8c89618dfb,
+	 0xf9cbde0de0099b3f, 0xcbf90782bea681a6, 0x56b7ee49cdb97fb1, 0x47329e92183d5eb5,
+	 0xe1770af2377c2c02, 0xd162b8d6c0aaa0aa, 0xbb91270d57863271, 0x82118b3b4d106182,
+	 0x93abf41cc6ad45a1, 0x14d2d45b50c194ae, 0x75012d2c58d6de00, 0x0c24ace7f7f1210e,
+	 0xb431bafaeb317c07, 0x32f03c4c17629395, 0x5854a5f32b8334bc, 0x57b8a3fcbd8c8f88,
+	 0x901c4a5e0711f463, 0xc92010f5165ec44f, 0xd116cef18a7dc9b4, 0x28e802c58cb52d6e,
+	 0x730b99ebefc2c61a, 0xe2a34a6c8b3d6e10, 0x9617bb4e22ab1c46, 0x430ddc2e390765c4,
+	 0xe31afa26ede636a9, 0x0055ab5cb7323f46, 0x64f5ac1ac357a430, 0x0f947b6c9510b758,
+	 0x9501fc78247e07cc, 0x8f44ee5bc5522869, 0x8202e6d6404af72b, 0x4a46380d9e7cc1df,
+	 0xee33bd5a50d99910, 0xb299b7346774d3e1, 0xcff889a7563801db, 0x028f28d981e7b337,
+	 0x38bb18c3d0f7f651, 0xc29aceac98eb88a0, 0x497eb0ecea3baa30, 0x6f597708d4db606a,
+	 0xa478eef01c72576e, 0xe2aa342cf0e7e11f, 0xc9d00947f559476e, 0x6e6a15e95ed95586,
+	 0x10a9cd11f27faa54, 0xa45cfefc022d2629, 0x8a5f024164d4dc1b, 0x77f770864d55de8a,
+	 0xc1597e047bcf3fc1, 0x1a506fb6adc0755c, 0xdaaabb0ed09052d1, 0x86dd672f2f15b55b,
+	 0x490ede8bf518b64b, 0x6a20233ab68d993d, 0x5f698c9d2aef80bf, 0x8cf7cb73611b8599,
+	 0xeef7faf6ef0e060c, 0x9066e9726f57755e, 0xdfaabd5dbf86b46c, 0x224ca13cfc6af7d3,
+	 0xb5563e1ea7a38e75, 0x0c2e733ac0f5671a, 0xb7b9ff12e6e2e5b2, 0x2441acfc71efcb05,
+	 0x5ccf139896909c33, 0x89233133f0d91d93, 0x769d5545d63d25e2, 0x867be8046852cc39,
+	 0x166d393162fa39d5, 0x5fae8d3de67a08fa, 0x58fc7383aa71c4c8, 0x450b4070e3440b12,
+	 0x8534e446e03bc1e7, 0xf622bf18e3a4b492, 0x514966eec0270ef2, 0xa27c2fe80ff1a7cc,
+	 0xd8fb867f1791dfa6, 0x234a90cd3119d93c, 0xfd2e98dd283d6e4f, 0x5869aafc76f8d6bd,
+	 0x485394e55af247cb, 0xdf0296c6d53c3c44, 0xcf88cbacb9d3d8f9, 0x5dacc89bb7d52e65,
+	 0x6be2611d2ecf70c5, 0x0761516fcf15f8e9, 0x370a046bb9720d81, 0x7901eca0d099e5a5,
+	 0x969f524126c77ba5, 0x2926354f32785dcd, 0xce80b9b5471c168a, 0x516e8391b86f75d3,
+	 0x0ef4d2aba2944c87, 0xeeb07e80b22ab8f0, 0x328095f5a4dfac9d, 0x29f16ff926663f31,
+	 0xbcadfb3033646930, 0x929d89527c85a260, 0xb7134295bd464e84, 0x3dd4ba67be478c47,
+	 0xad5267cbd5d340bf, 0xf8f70d486051140b, 0x18b94f8be9944b76, 0x5008dc989de7febc,
+	 0xeffa5cdf519d4c0d, 0x99ab25a1477eeb84, 0x6cabab7292319846, 0x607d02bf8eb54320,
+	 0x66d2fc415bfcf8c8, 0x970ef1f879ff80be, 0x29377764b2620a6f, 0x8354d918d73ad748,
+	 0x0fe822437c418106, 0xb4357a7ec091eead, 0x07a9c64827f9f523, 0x1239efb59a9e567c,
+	 0x6f0826b9319f0228, 0xafb64783dfdc82e3, 0x8b65e9cb8193bd3d, 0x0e7d6c2f2924d2fd,
+	 0x54fc25dbd7f28441, 0xf486956788fb7436, 0x1d86439bd8d2f687, 0x9d75bfd94f4f6f00,
+	 0x637f040ea077d209, 0x9fa0f2d5de8b61a2, 0xde53b5f65e32e3da, 0x7f5280d1adf2c270,
+	 0x61fc9180ba0243f0, 0xb002c29923151047, 0xb6c8e086fb7a8e7c, 0x574e07820ce08173,
+	 0xcf986130cb9e863b, 0xcc4e88a6463c3172, 0x37ce27f1dec45c44, 0x546b88e48825410e,
+	 0x46bc755338861e59, 0xec5974b00c781a7a, 0x3ba03ce064cfe084, 0x7eb1ebde8313fbb9,
+	 0xd1523d1032677c60, 0x791af73568491d3e, 0x82660e3c8ba2ef10, 0x7993d5acaef3c37f,
+	 0x0aa7e3a45f71ac37, 0xd917a9282c205a4d, 0xfd157e6930b5bad7, 0x0ecf9c6cca55a32e,
+	 0x49c2f07f71d90c81, 0xfa5748103ff41812, 0xddf1fa33c90a92a7, 0x0a3e9c6a6480fb2b,
+	 0x9ce467a701d12371, 0x64dd45182a59998a, 0x3f20b06f3da46db3, 0x68b5c3e4b6ebb851,
+	 0xafa1283e9578e061, 0x4cdea4dcb6a291ed, 0x4728231303b1134e, 0x9589785d875c170c,
+	 0xb6c9f5e9691576b9, 0x2d1760fe6ac41250, 0xb20fd9a61cd673c4, 0x895b1dc83247c027,
+	 0x500fe4e34a776d43, 0xa26dc98b381c64d9, 0x2cdeda4a69fbc756, 0x1324cdcbc0c55ba1,
+	 0x146a25bb64e7edfa, 0x9efcac33d4e757a2, 0x1e719e03594f4617, 0xaab184b6652b4d97,
+	 0x9473781f805c3644, 0x0c7db184757ec1d8, 0x0d57c269942ca0c6, 0x5e2b4956a0ba2d46,
+	 0xab22492fc63237ec, 0xe3ede1fd4cec3c1e, 0xa41089dc661f47ed, 0xa6d4d18bed080bc4,
+	 0x872dc80ca2e1d536, 0xb290dc232c46fc9c, 0xe59dccddc66f29af, 0x4206f73b963b9ef8,
+	 0x9b6d30010793b115, 0xb07c93c817bb2bfb, 0x34ce11a9eb6d0981, 0x682834e6be949221,
+	 0xd5b209b8aca1206d, 0x5ce4a988600de635, 0x97932f6b2d5a188c, 0x9c646ee75e7c0887,
+	 0xd7ed24f0d3e9b6f7, 0x820fbc1eadd7efb1, 0xdc7f47799c2cf01c, 0xb538b7c520fa3eea,
+	 0x186e301b638c5973, 0xebd5a041ce63a332, 0x5df1c208031ee0c1, 0x57bac4b82335c44d,
+	 0x8b3426d451ae8056, 0x6e432e5eee548960, 0x047c940d53897ac6, 0x1c8fae8ac6078da2,
+	 0xe8c9426e994b9a37, 0x8ab9fe392e503e73, 0x2a1abff519de1ccb, 0x4ca87463f238dade,
+	 0xa1c26f57d639e058, 0xc4d2e289a54e64a6, 0x81abf6800e1a7770, 0x25b480688159a51a,
+	 0xd01974004fe355ca, 0x2e60b156aae1f7b1, 0x4a5188d933e972d3, 0x92dd6af6065ec756,
+	 0x42b7806118fdc1f6, 0xaf2ac0758835f68e, 0xc04a87239605b607, 0x2817060c1f138c5f,
+	 0x370cd78cf24ee989, 0x0dd85a7938ace0eb, 0x74a2183b098e2ad9, 0x0303f0cfd3fdea65,
+	 0x9f417d02dd3e44c6, 0x04d61ced5662c4c6, 0x38ccd503f1fa500c, 0xa221bebb5c930473,
+	 0x1f61110190cb54c8, 0x5966b4862180ff63, 0xeb4ff6f7cf299570, 0x5ed38959dd7b3c15,
+	 0x2038ea7009b84976, 0x8b507efcc14a1eb8, 0xf04893d9b3cf7398, 0x94a1b290fe63cd0a,
+	 0xfa9a2568f035ada3, 0x18b8973681ac4c43, 0xc78bffb33cd0fc64, 0x6f12dc900aa5d976,
+	 0xb8f12473e4498e11, 0xbb729d39901f9df0, 0x191831131e90cf35, 0x1130faa75b52700e,
+	 0x7f048030b5eb0fa9, 0x85238c1041fb6887, 0x1a367a2d8b7e2923, 0x36f6b02e43ba914c,
+	 0x322361aa7c146151, 0xde09c44a4246d1f9, 0x11799e77ef69d017, 0x52e4bc64db2cb205,
+	 0x2ce6d8651794575f, 0xc5b2ac490bab5d92, 0x172c36af467ffbab, 0x53cf8ac56efdf1f4,
+	 0xf422a5cd885a74bc, 0xcfc5f25a8681b322, 0xba198b65d3ced002, 0xa6d87bb9306fb9ff,
+	 0x1e77a09fafee14ba, 0x4144ec8f84957195, 0x3deb2017189b635c, 0x364966518b73ad34,
+	 0x2f2cf37db3bab36f, 0x1290d22ab094fd8b, 0xb8b49873756cbc6c, 0x70a52c2f862e1eb3,
+	 0xad2102c27c1e4286, 0x8e5a4345c87ecae1, 0xa30fae09c4581d20, 0x5545164935bb7fc2,
+	 0x8aa3ff44d35773f0, 0x745f0e3700a02852, 0xea49b9233a00402f, 0x613d5bb908fcf862,
+	 0x2c797f30b46acaa0, 0xefd6168412efbde5, 0x62a9146c9eda08ff, 0x37000c1b29ab0c96,
+	 0xe7a0a672bd153b44, 0xff2312e871058574, 0x0e9fdf42a9e61961, 0x16b33fdbaee2fe72,
+	 0x99abdd6cb2aeeaba, 0xac08637e10aca8b0, 0xf6f726f03a51360d, 0x2616310645abef9b,
+	 0xef34dd32241bbe12, 0x0a631aa57c978134, 0x5a68bff2ebb3b7c0, 0x267408a468360575,
+	 0xd878fbd382a72a92, 0x25603b28ae03445b, 0xd1e8319ad257100b, 0x7ee2fdbe5a4dad97,
+	 0xd75745c0d0cbadcf, 0x87055199aa16d644, 0xe050d6b19be93ee5, 0xb04202b9ac93dc27,
+	 0xd185b1fbdb72bc6c, 0xd54d7b45ef140cb6, 0xdc1e76ff4598d0a0, 0x78cf31a689ea25a6,
+	 0xbfde204f84a53178, 0xfaed9db9b04fc41a, 0x4a891efe2e1e5ce9, 0xa2c468810ff9a71e,
+	 0x1676e3d7e7c0bd24, 0xa4a324ae321d5be4, 0xabf9809a5534d4bf, 0x64e5e540934ec72e,
+	 0xa33581fe7321e7bf, 0x8298cbf01f1d8a7c, 0x4e67616ad8498e5d, 0x0bd31f1277b3dcda,
+	 0xd49fd0c97de82e2c, 0x98a67ac9c09c326e, 0x83a79dd7dfafd04a, 0x70b5f7d99c3377c6,
+	 0xfde446ea351d46b6, 0xe292b0b97c1d616a, 0x12fb51903cc90ced, 0x46785aebcbd3553e,
+	 0x2d1a0e873d56fe9c, 0x391ecdbe3b61a78c, 0x86424a38565f0029, 0x6fb957f28767ab14,
+	 0x12f70b5e9ffbbc66, 0xfc2ece2c9444360a, 0x9a34974b3a8d9180, 0x06ff2e7d70786945,
+	 0x523593bd65a5924e, 0x7661a6ecc23f4bcb, 0xd20311c2aa15b7b1, 0x5e4566e2a6df66a0,
+	 0x0bda13e0626736b2, 0x98b6e7f72b83d4cd, 0x8c846f6b9f1f85fe, 0x20ad3dc73676a8b4,
+	 0xe3eb2b3f4cb854bc, 0x994e6813ea4f5fb5, 0x5da3f9ad1d00a3c5, 0xaf1bbb492f9635e2,
+	 0xe74c1951f157d391, 0xb144198c27fb9db0, 0xd0b69f785078560e, 0x57573a7fbd3f7b7e,
+	 0x3bcfb16af76880e0, 0xb41b6c4c911c7c6b, 0x7e4ea817af135d6e, 0x0db66f7c90d3735b,
+	 0x285c0b39fbcecc8e, 0xa7abdb803e5ee824, 0xb51bce552577a5b4, 0x28adc1dfa4aedd01,
+	 0x3ead06436fca6b20, 0x57b2dcab152a57d4, 0xaf5ca538db206f2c, 0x7b647e4d32613c9b,
+	 0x870ca896e601929e, 0x1d0afd32b64a0f3f, 0x8783e0e7e93b9bc9, 0x93a4c2d231df8ca8,
+	 0x09c4b31a0f95139d, 0x52b4b0a6b7326cbb, 0xbfaa74d9a91cf90c, 0x0548187bce14a537,
+	 0xbdcc9ee45392726d, 0x88be6f56aa43cf62, 0x472aea20ad948233, 0x1769e60faf42d130,
+	 0x84d6bb90b60bc9a5, 0x22265d48a0637e1c, 0x5d8952a09825e294, 0x526d90c3d3ca6bac,
+	 0xaddd1bb20ddc10c2, 0xc62ecf8d8665c00e, 0xc43642b9c24a26ac, 0x96041bb7a925aee5,
+	 0xf652035f943efdb2, 0x80e50347caa270e8, 0xeb75969400c3b30c, 0x675429ef872a7e4b,
+	 0x89bba0e14dba9464, 0x0b6b14e6263fdac2, 0x7cd3128560d3c76d, 0x01d4d72029f76e1c,
+	 0x2e3da759e11f1580, 0x0e7e5e0157f88d29, 0x99a7f6bc5f762f96, 0x647eeb16796aaeb9,
+	 0x6e2b8aa5c212e436, 0x6ed0898ed38e55fe, 0x6b397d210be42001, 0x3144e000503eb5f2,
+	 0xc2250bd2e0aea1c1, 0x0ed206a231e21223, 0xeeaf1be44381b7b6, 0x6e1216cab32cff11,
+	 0xcf472dce71df10a5, 0x95a1b773d682dfaa, 0x759a3c535ad06438, 0x67cbc9815e27f3e2,
+	 0x09d275aa305d5c4c, 0x2cf13d29fce57616, 0xf0d33d56f1fced7b, 0x6c2ec8d9dff00d85,
+	 0x6635c21565bda45b, 0x2e17c7310765cda3, 0x86b64e82e08241ae, 0x756c8b8f247328db,
+	 0x85acbe35a8e1a30a, 0x7fe3f3a59b6bb3bb, 0x8b76c6850c306df4, 0x1b6c9cdc51e7eb11,
+	 0x0ccef5d7bd76612e, 0x7c3a48cca003a223, 0xc893c045c86f5ea5, 0xa627acd39689d353,
+	 0x7cf30895e8d53ed9, 0x9a86abfac4455e2b, 0xaf967e7154f807f9, 0x987121c658708268,
+	 0xe8685ffa2f5657f9, 0xbd97f3c01211b207, 0x6223736a140a96ce, 0x6b78980ed918dbf0,
+	 0xdb18c6015cdc8910, 0x9f5bcdc0c88e40ca, 0xbfbee61b91056af4, 0x23737bc46923ffe1,
+	 0xd7b1e597269e175e, 0x99e7bd8341771b8e, 0x0d9acd10eaa73d64, 0x913a6d3c03d29c0c,
+	 0xb8a52851dfeafab6, 0x0beca13a67b2d8d9, 0x92e37a4fe06686fc, 0x7c2a35e0c877061d,
+	 0x02ef077dbc0b2fb7, 0xfcd9ff049162ce91, 0x079ec6853b689b80, 0x9122ac2d10f58937,
+	 0xcf00fed841dbc2a5, 0xa7ad4978509153b6, 0x1da48fdea6b2dcf7, 0x4e3ef9e2de5fead7,
+	 0x3b26211b0bbc287f, 0xdae8fcfcb855a512, 0x22579b9f7cab92e3, 0x9e4f1dbf096c2370,
+	 0x611c378577764a41, 0x942a1b2254bf93c4, 0x1c09c401d4fd615f, 0xab2210d7c1a8f726,
+	 0xd62248943d3bdd4e, 0xb5f6ce5bd1b0379f, 0x5fc163384ffaa018, 0x3e388666e262c163,
+	 0xd0aab9701049f39c, 0x61af1ae26e7065b6, 0xa58c83d27de79fd5, 0x5434bdd03cc59c26,
+	 0xeba9f3cca0dc3ce8, 0x9778af0e6e496461, 0xf3e59d9754346d03, 0x85aa3c605ffdb929,
+	 0x8ce6d0b553acff44, 0x815df250c9e7f868, 0x942579914eb549b8, 0x723c7a9f1a86297f,
+	 0xe9ab5ab07a452a06, 0x28efebd3db0f492e, 0x5edc8bd90932b77c, 0x57f51bbcfffaeca8,
+	 0xe17f414e6a2aabbc, 0x800a3686c7c55c37, 0x224ad98a8b756657, 0x138248e49711f005,
+	 0x292df4037651d216, 0x10e1ec67b0af28c9, 0x3004a129331869c9, 0x349e12ad36eb4cdb,
+	 0x07233870aa4be990, 0xe3bf2ddaaa24530f, 0x009e0ff9328923c4, 0x4bfa265e9353fe15,
+	 0x8a4dcd5446dbdaac, 0xc07f3229b7d01282, 0x9063856f30e4b02c, 0xa2426c4364843700,
+	 0xe99c5d64cac0162d, 0x056daf0b94f380e9, 0xbef44adcbdad34d3, 0x7686650619a311a8,
+	 0x2f7142130541932f, 0xe241731c9c274520, 0x010002d573e3026c, 0x1e9244fc53daf2d1,
+	 0x6e538bc0a84294e3, 0x506ebe851256c5d5, 0x6d2c200d23f52957, 0x46490a63f4a632a0,
+	 0x8ccbd6218042a3a1, 0x542702818e455fba, 0x224c0f8c431a8210, 0x60d09fe3e2b210c5,
+	 0xe9c32707a2a13190, 0x9d1f606488bca0c6, 0x3471663b0df796c5, 0x0a1cba4590e476cc,
+	 0x6a23294f0515311d, 0x8520caf73589ab5d, 0xb9ac21ddb556b0e9, 0x305c6424f6a11e4f,
+	 0x77da079eb00f5be5, 0x825031fbafdc8600, 0xcba7dd2bf71755d7, 0xa6fe2e60ef3e2c40,
+	 0x31fc4ac82a760030, 0x741ff4405eb290ad, 0x503400d74b6fb725, 0x51b1237bdff79bc6,
+	 0xb928c94e346d6898, 0xfe141aeaea663ef1, 0x8210570dca1a3364, 0x21d67a80fd4f7ad6,
+	 0x562a80fc10fda4bc, 0xeb7a58ffc23c4eb1, 0x0a80c3f30301b47d, 0x6226d53fd3454f70,
+	 0x82aebf8f3c57d44d, 0x8d950aebb7ecd475, 0x482d966101eeb017, 0x0035f900d847f261,
+	 0xf46eb2e2959e45ad, 0xef62cfe9ab444ed0, 0x920e650c671169eb, 0x7b89d2a0de64866f,
+	 0x2f96f98836c070ee, 0x27349e5635d48be7, 0xe297a8fa159785f6, 0x3bae9bae8de2224c,
+	 0x2ff07ba10153f7d6, 0xa38caaa0ac93a646, 0x582ba5b175026fc2, 0x0ead453a5491927c,
+	 0xb1ed0fd1ac4961fc, 0x16fa1f10c4b31518, 0xcf450edb89124899, 0x2425a47fe753014a,
+	 0x80eb60a84859d317, 0x126e00a634e301f7, 0xcc5b4cee4604130e, 0xa6511dfc4044b217,
+	 0x81fe6e31d4dd1a38, 0x4669aa3c8eeff284, 0x33c887fb372d64df, 0xb4e9e3ed19e40e0b,
+	 0xe9e6778628a506ac, 0x129558e300530580, 0xa18e3a24b74eca4f, 0xa47d6c6ed1a8a3f6,
+	 0xa92e32dd0b4b1b6d, 0x61c388d98e3b3e7f, 0x6cb651858f391f36, 0x6aaa2b64f4492adb,
+	 0x220d75a6375b11a8, 0x65672dfc93565ee4, 0xa620a92bcfda7f50, 0x91f5651776dd1fee,
+	 0xb9b532e2718f6b0d, 0x61bd6ed8eda4c8d9, 0x73da0a62b92dc0e7, 0x4323bdab1d605455,
+	 0x35396d267d5fba75, 0xb43c04c2bd01598b, 0xb6a02684db703861, 0x0464140f8ee9d228,
+	 0xc2cf7c5ff24ee751, 0x4a4935374f81719a, 0x9d0ff2d882622ad4, 0x847562788a8c3438,
+	 0x2ba76d21faa16b3a, 0x60560305833b17b3, 0x38ff1b25a6cc7ab2, 0x0ede1cff4ea9bd8f,
+	 0x7f131158543fe370, 0x695697efae330a07, 0xbfb23637af9950b4, 0x9655f80b1f054e43,
+	 0x006c8508e0b225e6, 0xd7f22c85400b986f, 0x77aff3f036e057e8, 0xac59b58da792a6c7,
+	 0x58d9c65cfd47cbcb, 0x22609f747de8e7b3, 0xd443fcd5d83824d2, 0x1bc7408d9ded6fd9,
+	 0x0c0dd4682e2949b0, 0x3584b52ce1e99f2d, 0x1167dbf0fcf85f6c, 0x401ceda2624cfa9f,
+	 0x4d13fe4b93b5220f, 0xf6cce0ae8ade38e1, 0xef60a4a4d5de3eac, 0x3d67064eccb9dfe8,
+	 0x4cdbcfc4784d4e4f, 0xa2aee3f41598a906, 0xe5f36529be4d7bf2, 0x64ec94bedba8e499,
+	 0x1d5cbb258d21026a, 0xff126f266deefe74, 0xe3d2c80a7c64cae2, 0x4c758b6a9117e2f0,
+	 0x395e811fc9c3616e, 0x9ed80cecf3fc77ef, 0xbae5cd37e88c7aa2, 0x1b15f4e478fc4cb7,
+	 0x05d503b9769a6ddd, 0x9b33618d265fd6f8, 0x020fbd018ff5022e, 0x7c2225ae7b5538fb,
+	 0xdfe8c5c247b883b4, 0xed1530b79bf4bc7a, 0xd6f557319ff9bbcd, 0x262b4b6c75033f55,
+	 0x10426401d12eab6a, 0x573c280e581b1fb9, 0x0432e85c43aeb4e5, 0x14c9890d964e12bc,
+	 0xff016594ea549e8b, 0xc0f1a82155a78903, 0xfefd7f880457d956, 0x899df7cbbf8963a7,
+	 0x0081f0edbfde458d, 0x5b13a982a11d93e4, 0x29cb193a7730ca48, 0x29170555657bce1f,
+	 0x86a8b1fd60b7d6bc, 0xf3acfcad3c744a2d, 0xeb0d09360d50fdee, 0x542e137720c8f0f9,
+	 0xa17172ddfa8bb83d, 0xd7f2be850fe777d3, 0xcf64de4e3330f49e, 0x9a4224520978d1da,
+	 0x4bd1e8643639746d, 0x9a9da16fc7c87c15, 0xa2e3c6bced44b1e0, 0x880b5a0f8ec1a381,
+	 0x0a265b643cf229d8, 0x2d77f3596c409b6b, 0xade93f987621e18e, 0xa5989fa55899f026,
+	 0xae8a1af1d9ba4a46, 0xe63c830268770961, 0xd87290b3aa826e38, 0x224909541af6f503,
+	 0x1212ecb38b3c9d07, 0x54b9854b86ceeba8, 0x34e964120ef59ae5, 0x246330268cd96d25,
+	 0x4cf34a1289795bee, 0xfb0c393e23156b4b, 0x2fbf27bfb3458a10, 0xa1577ee1e97d149e,
+	 0x9c8e4f8260bf2649, 0x72e2d0e67cd23331, 0x252dbd048ffe1714, 0x4860944205b2a529,
+	 0xa37e007d7e49fce1, 0x820f50e2880f190d, 0x3f3e56a0c5c4f039, 0x0ed63587795817ee,
+	 0x9e62be0488723951, 0x6a8bedc0a6303c7c, 0x40b65f4f153ad1af, 0x1de2f3927e9446fe,
+	 0xbc53cf65121a40e4, 0x454cb64c009352f2, 0x5d200ab3a5852ffb, 0x1dcfa2ae033eaaba,
+	 0xaf7a4613ff653946, 0x0ab6c2771fe0d8ff, 0x17613b17ae0a7db7, 0x60bf575f203bdd72,
+	 0xdab76da2acb135b6, 0xf14ae191b134b7a9, 0x7a37677382b4834a, 0x969cbf4b38605f9d,
+	 0x1d6baf40f8854cee, 0xcea8476867df92fd, 0x276ab30e0ba803bc, 0x2a812d26d17e8413,
+	 0x9c1c3cafe9b6bef2, 0x5f7ebaab0de124de, 0xff857409b17c27f8, 0x9aa68a9857bc3d8f,
+	 0x6cef22eda6f40372, 0x78f1d6504e55f70a, 0xbd32bdb646a01c96, 0x44007c56e5057ecd,
+	 0x23127247c5263051, 0x0ff085dd0edd3758, 0xfce903c0f5e4e102, 0x68c6a85b133f007b,
+	 0x749de084970187b1, 0xb4e407e41eda8b26, 0x61f0ad09da53eebd, 0xa7d997024ec649a0,
+	 0x4aadfc4b28919f5e, 0xf2bec20e2769ced1, 0x384d6549c37e4501, 0x57ca1314b869fbfb,
+	 0x24693547d91db5a0, 0x3ba43f05424cea54, 0x301267744cff3313, 0x793e0e1c23f0f957,
+	 0x8f99309f11e0a46a, 0x837ef345949452b0, 0xe9f29b8dcf39b93e, 0x37136a2dec43027b,
+	 0x0de1effa5dc2e9d5, 0xc97f931cd50e2edd, 0x6ad1432297ff59da, 0x91f6af011b70a1fa,
+	 0xe87ac7aea977afb0, 0x98a62160074dc0ea, 0xccf9f12e8b10bd3e, 0x2c3afbb53f14b1b0,
+	 0x75a8277f6e98c8ce, 0x4905d5a13b722987, 0x84bc75940308d87f, 0x3473d4663a98676d,
+	 0xd39ece52e49242d6, 0x965bd720187cbbcb, 0xee810178d42e59f8, 0x7900034562e07ae6,
+	 0xa486d62fddcf052a, 0x9884ac731afb8386, 0x836197d4d33e1c7b, 0x75100087feb1aa35,
+	 0x094de73fc0d75c44, 0x4c267067eba8ba36, 0x035f30c3ff45492b, 0x379cbf7a3e0e7ef9,
+	 0x27cc36281ba3103b, 0x08b74c55562fe48a, 0x3f7280cd000bbdc5, 0x9f9f2a2bc7c19e49,
+	 0xa1ca58205a8502ae, 0x9e3aa634ad516e86, 0x5404ec9230b63789, 0xa368528c06780066,
+	 0xb957217c359a8704, 0xa2ae8dc72ac08e71, 0x5defcd205241cfb3, 0x99d289e99f66d8af,
+	 0xe48d987c3ab459e3, 0x7d55f7a3e9cc4e83, 0x8e4f2cc3e849de20, 0x055c80808791cf16,
+	 0x207bf4eef24f53b2, 0xc3ae945ede9b6a73, 0xfb5a7912ff32d74b, 0x800228713940e105,
+	 0x819f243505d29a44, 0xddeb4cd2897ba111, 0xddf38e556634cf70, 0x513f2828251e2dbe,
+	 0x94f0a50a5ad370b3, 0x3b92e744e2461c58, 0x8d2b933e4df00a64, 0x3c123403ce1af8d3,
+	 0xcfcd4b04c696c3ce, 0x0ed5bfa338539028, 0xc25b6e65a491d12d, 0x6dc688889e0a0984,
+	 0xb506a4566a91100a, 0x43ead7a9eab057fb, 0x67481bdfd31ffa6a, 0x564405739919f233,
+	 0xc6bcb7b19c3aa7c3, 0x0d4cccf07d7ea894, 0x714b6ba1a2b0521b, 0x467390955520d842,
+	 0xe6fa3947562f1fa3, 0x674b5a897ea30de2, 0x1e9980a9cfed549f, 0x08b5db7144c3e8e4,
+	 0x825e11562848b16a, 0xa39ed8a2ee8a740d, 0x23e6e2e151bc3fd4, 0xb3c57eae2f0c5621,
+	 0x73371bf8a450c869, 0xf245968a5ca47679, 0x24bcfa766861cb7b, 0x469c0d516c663af4,
+	 0x792104f448beb7c1, 0xedf5982ebb1ea272, 0x9e39e2d1ca83a328, 0x2d225788737b37b6,
+	 0xfb98306e689950e3, 0x2a8b9f1bd1e88407, 0x5293c76cdd57e85a, 0x4a547c5f09dcd992,
+	 0x1789c2e83f0340be, 0xbb2cf3450749556c, 0xc2712f76da955432, 0x2bfad8bfc22cb75c,
+	 0xd7214a7992d7f0d8, 0x70b15bd67f7f8fb3, 0x66ca3d27435965e1, 0x56e2000cbc42ec34,
+	 0xe6aebf430d7e9163, 0x645f1566df43f2a0, 0xe9997c02247b4367, 0x256b4b9d4f671d66,
+	 0x4ed89d9dff393693, 0x9d896b11a00af9e2, 0xb52ebbbf6c642cc4, 0x807aa0c18eefc8f5,
+	 0x9de5dcfdf7f451c9, 0x14489b9858f29177, 0x4d40c4a3edb3b50e, 0x8965e03df2e30407,
+	},
+	{
+	 0x71473ac38357e3cc, 0xa4757e79ca6bf155, 0x66b779254d313c52, 0x80d91f58ae4d26e3,
+	 0xf042e69f568d2050, 0x1e0d6315c4ebb847, 0xef9aacefa09be150, 0x9ea3828d86decb83,
+	 0x391034b42abdf77b, 0x1644bfea6c8e310f, 0xc21bff2345e96836, 0x24240431764ab9cb,
+	 0xd9a9c6741ee9380d, 0xf6cada1a1b8a742d, 0x186d6ebc1d417d36, 0xac288be058abc283,
+	 0x6d0dd93010e1818c, 0x13bf915137c931ab, 0xc4ee5b8c89ce00d2, 0x0b20750c4053a703,
+	 0x2913fb79a511741b, 0x47e165a457640498, 0x5a63027b4ff24116, 0x6871e50de79e2564,
+	 0x56a7f8d6780898e6, 0xbbd977261323a6a7, 0xf0423a774f483d5f, 0x29f1467ef15447bc,
+	 0x95158ad8f7ff012c, 0x0b5051dafbac426a, 0x87bad73f6fdcfbb9, 0x98be3f66dd367f0e,
+	 0x46ba13492b16d665, 0x296a8ededede186f, 0x1af5c10eafea3f88, 0xad0f3292c48ee6f8,
+	 0xd39cd489efb622ea, 0xdc79aeed878ce38a, 0x80b0e330358c3c99, 0x0056d1a07ac0d193,
+	 0x10cd66929f543d81, 0x26d0e2e6ba2a7c3c, 0xafb883273bfe80c9, 0xa6c635e7205fa632,
+	 0x4ed0114de30ee6d7, 0xa4905600942aa31f, 0x03d33a01de1b60f8, 0x5bb1b804f95a3619,
+	 0xc8d83b367982cf7b, 0x77028f90a333b051, 0x9633668cc58c4956, 0x82cd30b4e1eaa013,
+	 0x9ffd90c9a1269c03, 0x2064761f9a601dcd, 0x7c10a6630b2f0de3, 0x44d7271d3b9edf76,
+	 0xe01eace97be26958, 0xfb68cd1725f205b6, 0xd64d46e79eb08ad8, 0xb34fa08254397fa1,
+	 0x5595db48f6670f67, 0x8bdde05970650bf5, 0xde89beaa46767365, 0x606a47bcff4aea23,
+	 0x6a6869071f558bca, 0x8d592dd8f74301f9, 0x460122b1a44aaff0, 0x0b9e2d071940c65a,
+	 0x7a615b7d1a723fb6, 0x335ae9aa92ee9e64, 0xafa22e128a37ff91, 0x80998de526183d2f,
+	 0x08caa0f0f1441dea, 0x2eca6c54c8762fc8, 0xfd8d6bf5bef146ad, 0x66bb1055ef73b21a,
+	 0x5a8efe8f8164dd8b, 0x1cec73e8ee7e77a3, 0x91085644719b3f1f, 0x70c06add28c19403,
+	 0xc91f0453f63994bb, 0xd9d48a452d05c03c, 0xf46e0c9f8e49d0ac, 0x670cf1575922caf9,
+	 0x1aadb4e003d95f93, 0x9cc0a5183c23ce43, 0x28c19744af93721d, 0xac906d6220e3615a,
+	 0x3ad681fd4c68631b, 0x1aa5ca56260d3fd2, 0x1accafd9f649ddae, 0x5227af207749276c,
+	 0x92cf8f8e95142ec3, 0xa446c70bfed69e37, 0xe510f923eafcdd5d, 0x6de7bc7981c0db97,
+	 0x2b83b87e37dcabc4, 0x50598e63dcb34d7e, 0x43b579ba9558d16f, 0x5be5d16ea273e3ab,
+	 0xb95d9ffc8eca7947, 0x12f510c02d7ebf6d, 0x80e08c43ba8f3309, 0x35aa26e13720911e,
+	 0xeca8539b654aa22e, 0x9d73f3cbe62b98e2, 0xf6b320ee91dedf4d, 0x42e2ecab9d6abc2b,
+	 0x33363736dab37db0, 0x95eef75921c13422, 0x17f611ca2ef98fd1, 0xafaca351857b5c5c,
+	 0xb6ed25991fb81321, 0x2a01b7ccc43d8c41, 0xa28e3a181492b714, 0xa5e65f31a6418ed4,
+	 0x1eff19a88f219ada, 0x735d61ad54b04001, 0x1c2bd19797b452e8, 0x8da070112f6da468,
+	 0x168f32aabbeb2d3c, 0x2dab518841a20be9, 0xe178be9c9f1f464d, 0x3da690625d771a83,
+	 0x91ae45c2cf9e69e8, 0x3f9a36b221412c83, 0x2d960208626e9fa0, 0xb4763d7cadb6399d,
+	 0xf6667d3e0acaa4f0, 0x8d45d7a943e2c208, 0x7fed077a2319b6de, 0xa0344d0d34514831,
+	 0x27a49fca731df8b5, 0xf7f30ed784967280, 0xe46f82d0418ab769, 0x67cd8194ee879db2,
+	 0xf8bdc76c96f25e90, 0x9439cc7450676bb3, 0xac05cf797c5607ca, 0x66d73a395cd2949f,
+	 0xa89e4842555ab5d0, 0xc2674125848d36f6, 0x59fedb94bf3dd5bc, 0xaef815934aa8f9ee,
+	 0xd99ee2aae28d6891, 0xb7e290aa43e6b24b, 0xce3fdf606f29bd21, 0x590ba695ff52b2a8,
+	 0xfadad1bcbcd75422, 0xb6437a40c010853d, 0x16cd71babcd47e1d, 0x655c98c0f961d8ef,
+	 0x658d8ef405e1a0d4, 0x1f2f74e7fb84a038, 0x17ed98e5cfe5e7d5, 0x8aaf62ef53716897,
+	 0xb8951178412cff00, 0xe44bc70697c96b19, 0x04170d2b4f18fe68, 0x86057ff0a59ce9f6,
+	 0xeb2b10e74515a861, 0x47ab3f112e33b5b0, 0x0defdc4afe006ecd, 0x554fcae49668bd1b,
+	 0xf188cff61a99b589, 0x99202178643e019a, 0x8d376c342caa25f3, 0x085f6a680a3ceb43,
+	 0x68bc4f6b20d6d6e5, 0x1e819b36b9e8c171, 0xf8ed2f1fba882055, 0x740770be33edd382,
+	 0x778309a5a37dd6c8, 0x651703d5ad079b94, 0x6f0abb058431a48d, 0xb0dc206b8b85649f,
+	 0x793c961789ac2c87, 0x68a0600bd889d5cc, 0x39413fdc60ab7f81, 0xaa3fbbb95e7dc78f,
+	 0x94a6911995f44724, 0xb6da2252b6e9bd77, 0xdd15e62c776d0c75, 0xa555f005421ea5b4,
+	 0x2b2bdadb102404fb, 0xc7d31af5d7ca2f8c, 0xff84866c4ff02840, 0x7103fd4e1f71233b,
+	 0x46dcb33f0ade5d52, 0x2d9533dee30dd7b6, 0xe3235f952ebcf917, 0xa72d34a9da2434c6,
+	 0x07e1dd9f9b73b5cc, 0xc0a15b60fc64b7ba, 0x645db043b2e8c912, 0x8207bf5b1e54c4fd,
+	 0xd1886a6a7b786848, 0x7fe7b9d671f73a1f, 0x7129a18e2352519e, 0x559d64e208ed0d3d,
+	 0x6ef94456730efad8, 0x50a0d4076ac10aa0, 0x14582626f0387c8e, 0x9a4c349e807cf69a,
+	 0xd6b58d278fd9e41d, 0x30d1d116dc2df646, 0xeb41711ada10e70d, 0x2dec408aea89bd38,
+	 0x433610b8973dbac4, 0x486fb122f3ed53a1, 0x8061c4e55edd146d, 0x22a9a28f873bc961,
+	 0xc8b3e159f4a5f63c, 0x8df247b704ebdcbc, 0xa903edd5e9e235b1, 0xa42d13dafcc67bc5,
+	 0x8c0f5ccf0a4ec59e, 0xb6976135be7fe8e7, 0x40a524313c9fcfd9, 0x3393a9d9b1b007db,
+	 0x535675241284bd21, 0xb061e655eeb3e360, 0x3f27a0d76c382f48, 0x8d9332fb5947b0f7,
+	 0x8e2f6aebdc4300d5, 0x5e0e5eec4c5d196b, 0x3f7342c5bbb6c3cf, 0x7a0221e6ad4f23a0,
+	 0x981d051705d23290, 0xac18b7ff85a4794a, 0x3b313537adf75029, 0x855a6190234a6cc0,
+	 0x9ed6fa6c047a921d, 0x1bde57bf06d6fd2a, 0xed72e48ff7a886e3, 0x2c19163471ec7d5a,
+	 0xc60aecb4c8c2f3c5, 0x98b6464159c0ae5c, 0x8422e21aa3451363, 0xa7132006299bfd70,
+	 0xec2dd793cec0f29e, 0xb4ef7e1dcdffba77, 0x67267332d2309df7, 0xa0138e5e47850aff,
+	 0x80921c57c884da55, 0xfbc4bc4d664b612b, 0xbcfc78799d4d9b0a, 0x18570a0ce409adda,
+	 0xea214035445a4c84, 0x7d0bcb92065b3277, 0xcd7386f331b47768, 0x20114228e037e86d,
+	 0x1aaa0364e60a854f, 0xe38b03e2386c10b0, 0x3e94bba64897e2bb, 0x26cff850de5ad109,
+	 0x4334b2f0393c1eab, 0x0a95ffcd58b5ca29, 0x3d137d0954f4990e, 0xb38470a526412335,
+	 0xba4234f46b1d5bba, 0xb47de302123ee1e2, 0xde7001ac0789dcf6, 0x104fbcf3186e6603,
+	 0x8ac6c9e2839b69e5, 0xac426ae21551590a, 0x312e29a34e842927, 0x670b627a6f2b5d36,
+	 0x46a1cc3431287fde, 0x54decdc67a4b517c, 0xd3d16bcd4f22a733, 0x490352500ec2ae79,
+	 0x066c9e541f0ce4bd, 0xb57e6c735c25535c, 0xd36f20766999a7c8, 0x3f2184ff5b2960b0,
+	 0x2ab5fd254bca91fc, 0x598169de7fd6b875, 0x4f0e7afb7dd9d677, 0x5ccf1db1b8b9c3c5,
+	 0x210a411c281f4b5f, 0x88654d776093ffe2, 0x1fb55b9b61f9414a, 0x9c9fd2c4804457d5,
+	 0xbc728953388c5d8f, 0xcf3e8c7b301f3462, 0x0f912d397c651734, 0x14862484ebe39ba4,
+	 0x0ece4ecde0293496, 0x0dc5fa52e1779e19, 0xf2a269eb7fb25104, 0x60e23f3fe3d7de8d,
+	 0x5b90350b342918e7, 0x93dc804a9e1dff24, 0x71f53e3af2f53b39, 0x602c6bc2ad924f8a,
+	 0x37c8e5572a7eb8ff, 0xe45c279d85855e80, 0x9d1671d34ce82449, 0x239f69e9eafae18d,
+	 0xd8c2fd50c70849ac, 0xfc826e1ee4724c79, 0x8874007a9b5401de, 0x64608822cf07191f,
+	 0x07a31839ac7736bd, 0x3754d4b7beedf9ee, 0x780764947589a1a5, 0x5de442d3645b1545,
+	 0x3627cda6da1f10a3, 0x4264f1f7223a2dee, 0xcd8fb1f86f8ca200, 0xb47baa7649b30505,
+	 0x328337defc009745, 0x16eff2a5de90b5e5, 0x26accdf688b4b881, 0x903a579aadde5f78,
+	 0xfa6923c6b1b9e87f, 0xb1ed9ea6184301c7, 0x3413119897d0a66b, 0x7928cd9ff0a848e5,
+	 0x4e27da002337fdda, 0x3a923120b9716110, 0xfad9adb7996af48e, 0xa442a1e07f62ce6c,
+	 0x4ac7a8b87fd98dbd, 0x9abe9ad4f56cdfb2, 0xddf9f7d8dd286cf2, 0x34b25b13a6fd43dc,
+	 0x169729cb4e2465b4, 0x47dac7a9fff1e9c8, 0xeedd7c8dcc2d58e3, 0x03991571b7f9765e,
+	 0xa50c952f08368228, 0xb09ade95017d0b29, 0x2e5755b7d725af8d, 0x8567f1991915df4e,
+	 0xd424dddb0cb02604, 0xa3d26b0d67872da4, 0x9bc14f79fc96277c, 0x83f0ae2a656aa963,
+	 0xcb8aa5e18d6b130c, 0x6aaf1d4eec8799a1, 0x331e8ce9b26a3175, 0x5d30d5e0c2ab98d6,
+	 0xe8c8813dbb30a369, 0x3725840220704602, 0x42913872d2cf742f, 0x32b3a7f4a0744f7d,
+	 0xc9362e44558cd6c2, 0xf7649e3f6f32de80, 0x87589b18ab572c81, 0x978a2ee77edba364,
+	 0x63b127d83f9d4321, 0x19fa494ee9ed5310, 0x08cff2e74ed4d2e6, 0xb5c2de2833a26a99,
+	 0xcceed61a0b2eb4f2, 0xcda45e37c490222c, 0x0f200ae9653a68f3, 0x73bdf61686ff3699,
+	 0x228de57c494a204a, 0x2c3305e53c99edcb, 0x59d6680d059044c4, 0x5e5a84cca734b7b9,
+	 0xff77c203c8a38bec, 0xea62a6c3804bd127, 0x518c5ad19baa2463, 0x2f8303a757ec6efc,
+	 0x2a9460c8ebd229cd, 0xf53fcb2a254627e0, 0xec7bfcaee6e976b1, 0x30609b1a94582a7a,
+	 0x995310ac82fb9a22, 0xdb59daa6442c8640, 0x1d69d22681b60992, 0x61d73263ac851017,
+	 0xb89e0a33c6dd705f, 0xf6a0ae8e00412831, 0x1e2dcd7791685953, 0xa993654e059a4631,
+	 0x3563ed54107a582a, 0x5195dd41fb153c5a, 0x2a833fb5c9c0817a, 0x04ac54de01589442,
+	 0x2f51d12775a15249, 0x051fc3fd156eddb4, 0xf3ccd9e37b34c45f, 0x271a4634e076b8ed,
+	 0x30b15a6ab55d52b8, 0x2917f1173dc475f1, 0x06271f959887eb5c, 0xb3439f7af6d79821,
+	 0x7b5cf040f456e74c, 0x684785a7c514805f, 0xc6cc797849c475ef, 0x315d11cb87cc1dc1,
+	 0x9195fe8017c05766, 0x7d95484f05792aed, 0x2f678614e3c6cc62, 0x3475068d83ab05c7,
+	 0x909e500bce2bb978, 0x61da83aeeecad11f, 0x00663730d45c1293, 0x5e3d193b4a7ba5e7,
+	 0x089666603533fc2a, 0x1452f6233afb0661, 0x2c02e27385a49055, 0x161820b4f7758164,
+	 0x10f97a312e24d760, 0x804f266824767c4c, 0x50c14412e1efefa8, 0x551d5e411a30599e,
+	 0xee59baa9acb852a2, 0x4e1dfb3c1d4db6c6, 0x2334246b2e6f6cf9, 0x80b3994c1c0f5821,
+	 0xdd100bea9cba5248, 0x4ce09f9a377862dd, 0x5d022895da1c0e85, 0x9e665349534b47eb,
+	 0x12784ed0db45accb, 0xa1183352d6678a4b, 0x223a3ba50d554c23, 0x98ce8030d14063b4,
+	 0x22493da732a79e73, 0x1c144e68a0aa46cd, 0x2dc71342e2b534d5, 0x4b45b55eae1650e7,
+	 0xdd10d2e037b85119, 0x37cac76fc049007c, 0x4943c8df4e683f75, 0x1fd478174a96bbe6,
+	 0xe43b77bfd9a20937, 0x67b754b37516bc2b, 0xd51df665e8282f02, 0x96e4474e018bec89,
+	 0x2729f82b4ca445fb, 0xadcdfe82c26824af, 0x3845af9aefcff190, 0x7b5bb82b3ccb09ac,
+	 0x472c5a9f3e7faaf0, 0x50d4045e8582e6ec, 0xe9fb7db901e7fc8d, 0xac73fa916bd0b7b1,
+	 0x5cbc6b452c2397cb, 0xe5630e78761b6e01, 0x92f56c6146c6f881, 0x738ebddfee086815,
+	 0xd56eed93640c27e3, 0x95c2c420d902bc4d, 0x7cbdbefd64041ba0, 0x91150b8e924d81ca,
+	 0x11274079a8a54cad, 0x614334a89a5995fe, 0x04da210e5263a933, 0x4d6fe92cc909dbff,
+	 0xac5dbbf236b10832, 0xd294e311fe29cc9a, 0xbe8556ceb36dd0eb, 0x9141d824b452b0aa,
+	 0x6376c08701f172a0, 0x5907d9fa16f6662f, 0x2efdb11d63ab8279, 0x59d016aaeb28ee42,
+	 0x07288a2e55e0f7b2, 0x8f451898f369704f, 0xd35b4f188d434a2b, 0x112314c4d0397cd2,
+	 0x120607638079152e, 0x4cba70cb405c3371, 0x5af03b1c95b36459, 0xa90d63fab3189571,
+	 0x3b216948020edd2f, 0x4620199297438160, 0xa9eb8cb5b72fabd2, 0x53342741e973e9c8,
+	 0xc96549452789b1ac, 0xceeac78d9f44242b, 0x19e2fe04d28bfdfa, 0x5de6ab9e7ff14c5c,
+	 0xf00c192464fec3cf, 0xf987cf5060153a44, 0x6d676eaa031e2d1e, 0xa76a98c2d0f73897,
+	 0x8bd1764128568aa9, 0x42336bb8f7efd989, 0x50d236903fb7d678, 0x87f291d5f3f45303,
+	 0x1c12c9dcf84917b2, 0x7a22b3e53f282cae, 0xf89e538699e08604, 0x4ba62250d2c4c1a4,
+	 0xda6e0163593c5572, 0xd44f4d91cea062ed, 0xa8566b7f413dcebb, 0x99e7772ad067f7a6,
+	 0x9f05f99452699c06, 0xba6d5766ea5bf930, 0xe51abad2ed88e404, 0x09a3cb8fa89ce867,
+	 0xa91a7ee5b081e13e, 0xa2c7b1a2e85e2346, 0xfadc604eca4c5f72, 0xb4a438b6e19fd52a,
+	 0x7aca3fe892b2c6b2, 0x51f295ef129cc7cb, 0x6fb3930ba84bb2f4, 0xadef9205aeeac167,
+	 0xd4ae7d326de30449, 0xbbc3b70447243869, 0x9ef6972b415a8e4a, 0x995a66c28a982781,
+	 0xf49232aef1830109, 0xa9d11de517d9a3f7, 0x8ab9358c44b972b8, 0xb5ee4f36de574b18,
+	 0xd9cbdd2f4b39df80, 0x674a27216ffd2d71, 0x1a9a6bf2cab727d0, 0xb19f9ed83adc7d5e,
+	 0x0e179b3834524d26, 0x2ffd3d6aa50b3811, 0xadc905792f818ee8, 0x7fd16c0844b382e3,
+	 0x65759a91396fac0e, 0xea2fa8ccc848826f, 0x1fd82dae8329f75f, 0x55ce09a1c82020ca,
+	 0x1c6359a15c5cecdc, 0x3c1ddeb9166664d2, 0x9b6c8c0917a0fb74, 0x9b20e84b02121fc2,
+	 0x7c164ed11379255f, 0x5f8e539523f51d08, 0xfe2b8fd91b8dfba0, 0x93fb3a00c20537ee,
+	 0x1b526bb76f9c5afd, 0xc3aa6a5dfa0be7f1, 0xf7640a8fc8689e64, 0x37a3bd0f170157d6,
+	 0x6c9e4329327c4850, 0xf8eb9f95978fc40f, 0x6fda41cf5975d8ae, 0x02371dd4300738ca,
+	 0x25e40b9dda899fe4, 0xef7e66e5ecbeafae, 0x2c94febbb99434fc, 0x5fbf9e8b3d162927,
+	 0x49d8ac97154f14f0, 0x92f704e8ea22357c, 0x80672e2e3bedc3d7, 0x1edf3349a4971935,
+	 0x6b06a4b5832c1774, 0x5b12caec1e4d5248, 0x5e469a0d7dbe3195, 0x553cbdcc84b4c3de,
+	 0x6677e9459044e39e, 0x0d24ff43b4e2be3a, 0xb8f307d27061f100, 0x8a126cb63d124d7c,
+	 0x99da1df13464da6b, 0xf5db590ff876d69e, 0x1a34bedc8f73835e, 0x35093db62ca3c0e3,
+	 0x37b83ad9d0e1138b, 0x19e775f299461742, 0x478b9a403de93d53, 0x0d7e6113de1ce2c6,
+	 0x9908b3b06de8fa8d, 0x207e607129ddffd1, 0xe18007aa31879172, 0x97d594d6b587b4d7,
+	 0x9d4b58657ce26d2a, 0xccdc563ca3218825, 0xc2c62934d38c5679, 0x04a0838fee0be92b,
+	 0x4dd5b3cf46f7af0a, 0xe23c10edd801efc8, 0x0a6c5e716877e704, 0x01f54f24c4d89825,
+	 0x4da6f4366f1112d9, 0x1ae0f621abc09d37, 0xcb5cf31375bdcffe, 0x7d7bdbd14897bdf2,
+	 0x670facf4b7058300, 0xf138de3d2205c66d, 0x17a0a16280c251d0, 0x406c3692ac3f79bb,
+	 0x7584ab6996417638, 0x2c908f2e60dea61b, 0xbdf50fb1b32281b3, 0x8b165c350f1a3b95,
+	 0x5ecaecf3f854a606, 0xca8d86946f115f07, 0x37690db48d9afb53, 0x42220bdf4d6a27cd,
+	 0x375cba50a1d65902, 0x9379d4677ba8ef70, 0xac4f04994a75b341, 0x55917a185c94d77f,
+	 0xab9bfc3b1e5b1534, 0xd5292c76cb67eaf1, 0x9ee4d4c8841ff3f5, 0x1b9a0dba28af2168,
+	 0x49619922b8cbd9e0, 0x7e3c52c31a1c2084, 0x5fb91535f0f29fea, 0x5a6807d20dce135d,
+	 0xbee0bd10235990c8, 0x126eefbbc84700b6, 0x8bf5e69383f9693e, 0x052db4290a09e9e3,
+	 0x9d431b250f35465e, 0x7cd203cbfec639e9, 0xae2d69c118438e1f, 0x649981c63fa11b5f,
+	 0x61214572149ccbd3, 0xc6cce99b454e0b9c, 0x5b49589ad4f068a7, 0x56420ed979175e15,
+	 0x140168e614a6e391, 0xe0dc4fc9f6d4f76a, 0x2890dc30f3de17a1, 0x5423c22d77279173,
+	 0xcdf05a62457c8788, 0x2f8ced313b7be886, 0xb9cc8965155eecd6, 0x408d21e43d0694a6,
+	 0x2b1cd73646449285, 0x3c537f1efcc596b0, 0xb4fdac4281316586, 0x3442a4f225595e26,
+	 0xf5241123662e1c8f, 0x2510380869bc451e, 0x7e93ec49e0da5bf1, 0x96873569b01f19ff,
+	 0xaad11a89349b511b, 0x0d6931396a3828f1, 0x5664aea8c85b0e18, 0x0920f0d2381983f9,
+	 0x3a832a87e28e51b9, 0xbd2d2c9788d8e505, 0x4ef07f9682334c4d, 0x1808ce13a66139a3,
+	 0x81d75d4efcfec179, 0x7160239f37fe0b85, 0x4f0c14c4056e23c6, 0x32758ef514fc9666,
+	 0x76ec872e20f14f61, 0x6da336656d85fa1b, 0xd61a1c2c250b80c3, 0x35d5f680968967b7,
+	 0x91bff8315e300ca7, 0x951809f3db903c70, 0x63ced0ceeb468511, 0x255f8e9e8334fb74,
+	 0xf35b810156f0fcc2, 0x5e45bfa53f78f248, 0x094c54c0cf1b111a, 0xa929ac08bbac1648,
+	 0xdcbca42c4ffa3a59, 0x0796cbeb0cef7749, 0x56c1b93709cc314b, 0x4c78fa52c09284ef,
+	 0x31acbfbcecea186d, 0xf64012ae4ddd5317, 0x2b61ad7bcc8373fa, 0x91fcaa70ea256ce9,
+	 0x2d5f85e932fb930b, 0x2e2b8d42df451ced, 0x962d6324332683da, 0xa9b1df584f26ab7e,
+	 0x7e95e5513e44a606, 0xd42c3dd3f145d3a7, 0xc56d4c97745f84e8, 0x65aaf5545a6ebcf7,
+	 0x7be67c15486ae84c, 0xe9a9fe601abb061c, 0x6e700ef74c8d3bed, 0x41023dc86094d5f2,
+	 0x6a59cc981c8ba3db, 0x2107798526236081, 0x73d6145de0cbc6d5, 0x1b9ecf4b1d7e22d5,
+	 0x9b61376ae1c7bd51, 0x02ab7b731d473a08, 0x2bf40aa17ec4a867, 0x42eab9b141daeea3,
+	 0xb8917575c12ce55a, 0x5c3a9456d4e19b73, 0x13aebbf6773b0eaa, 0xb481e7581438be0f,
+	 0xe14db9a8640b4a54, 0x674e1804e09df9b0, 0x9452c6fc072a7c3a, 0x5c74fb66a5a1956e,
+	 0xf48a42598189ff07, 0x7f731f8d44d14803, 0xc5dea04e29e8ec49, 0x0e56c07e85311ce6,
+	 0x60a864c38070765d, 0x0ff6f8862c256b35, 0xcc76b0ee4eee3445, 0x50cafefe69c15000,
+	 0x3764df7ef99b91e0, 0xd300bc26db390a1a, 0xe8322c39046af31a, 0x6d12a1bbf932f610,
+	 0xa1afd9f7a1187553, 0xc9e6468ae71afd8b, 0x87ded092f794ab45, 0x81d5e64b275ef7a7,
+	 0x4d327e85270eb58b, 0xbc483aeb8bf4ab78, 0x5ee981baef3634c4, 0x1d0f792ce4998678,
+	 0xab64b4e4b2db86e2, 0xc29fe2477fcab1e1, 0xe8690a6f73cb769a, 0x642c438bdf3b4da4,
+	 0xb903d25650150756, 0xb9b6bed7182124ad, 0x17150eb2b6d17c14, 0xb237fdc8862179a6,
+	 0x15d65e446c8b261f, 0xad552b217298a7bd, 0xb9ae7ca7e253fa51, 0x550f2d4ca1f172d3,
+	 0x14e78d900de3763f, 0x72efe52c1563a808, 0xd1402e7d76d6feeb, 0x0f9e76669f2a962d,
+	 0x967e93d2a56b5d58, 0xb2ba06146fa218b9, 0x050e8f53c43ccfa3, 0x5fd1df440bb25fc1,
+	 0x45190c0e8ee910dc, 0x79f94bb05d7bbd17, 0x74670bc237635b23, 0x75fe23d8a5373c7a,
+	 0xa42930dbec7be7a3, 0x04c6acf909304e45, 0xa1704ea86bd4a33a, 0x0fa99bfbdb46c61b,
+	 0x31d2f26529ac21b0, 0xb54df8f0bd6766fd, 0xda6987726f4b0975, 0x65eed8abc7b9a4ec,
+	 0xc1272ca777eb16f3, 0xc195205a7d6593e5, 0xed1cb9a6cdd4cb50, 0x4d00ecabf3773262,
+	 0x2ffeb1aa658bb12f, 0xc13c610dfc3628f3, 0x2ebbb212d01c2833, 0x5718951007bdf247,
+	 0x0c2f04c2bf07cd74, 0xf245cd5240fe9dcb, 0xf4a2ad15d3494ec7, 0x2964768c3e6965b1,
+	 0x3640ca5312e6275f, 0xced9838de5256633, 0x6b3f1a100cb9498c, 0x41068764ba63a171,
+	 0xa0d2c69eaca85289, 0xebe043318a430c53, 0x626b6da1e70cb9d9, 0x332bdb28b0652dda,
+	 0x804feb82c40368b2, 0xeb0114cde7dd248f, 0xc9770377af5d7bb1, 0x95452016216f2392,
+	 0x3643eefa30c461f8, 0x27db56ba0dbd1e38, 0x1287cf418c7d20a7, 0x23e644e0ae5d2d56,
+	 0xdff2dcec9cefa0e0, 0xf30079bc3821b72a, 0x82d1eeca8a15768e, 0xa4596217e5469d36,
+	 0x91a47b45b238bb65, 0x28b6d60518f8faa3, 0x26824297cdf69218, 0xb42d549628753d22,
+	 0xfff28c38e3b466ef, 0xa885e2273d9a5e23, 0x12024c9d775cbc16, 0x93ceadccd3ac1f29,
+	 0x6e0ba74d18da7cc2, 0xf23bbca1a6b956bf, 0x4b3341d94db2392c, 0xacbbbe91406a3f14,
+	 0x80574f69f1405cb0, 0x76f416be5998da06, 0x97e62be061cbfb55, 0x37d74c6c9ffd593c,
+	 0x38521558ff046553, 0x2edca9c76ebf3988, 0x7b91366b9a156ca4, 0x7b5437835fdd2ef2,
+	 0xb55c952a49f4204a, 0xc039b1a566a3f94c, 0xfe0490d79e82949a, 0x50a8523dba436d7a,
+	 0x274b902493326970, 0xf7bcdff01a8cf232, 0x83c09bb49fd56eab, 0xb62d1b18649e416a,
+	 0xb71f82bdbe9f9cf0, 0xbb9a8de1f06c0830, 0xe0fef2d236cb0de0, 0x84cb611127e75e24,
+	 0xbbc29a70f5e7f187, 0x4fe209b4e420afbe, 0xd0098a932a4d64ad, 0x27fbd29597fe252c,
+	 0x6876316bfbb5f895, 0x2939a70bf0fbc40a, 0x95a99c5bd9f0bfaf, 0x8cfaca6b085d6382,
+	 0x64c149d5d020aa0c, 0x3fc136a6c968927a, 0xe2badf0b4ab1191f, 0x85a3ce909fe887e9,
+	 0x3d646b2bc6f3c756, 0x9eadb1b118e116d5, 0xa9691dabac0ccaf1, 0x4e2b94161ed87636,
+	 0x798ad7dfff04045b, 0xd8586b0f179c29e3, 0xdf20d4eca65689c8, 0x33f81cf160d30eac,
+	 0xea1edb50bfd43996, 0x441dfd058a815972, 0x4347665887aeb3c6, 0xa744e6f5f1b011e9,
+	 0x1061fddc9e436266, 0xf6a9cbc90fd4bf84, 0xe2178b8ed4539cab, 0x2395355e06386583,
+	 0xe08cf287b4a4d644, 0xd63deea0e2857051, 0xfcbb94aa73ba3873, 0x11b4eaafda28728a,
+	 0xf39e3bc7fb2ed082, 0xd1fab2cd79c702e5, 0x7837d965691d220c, 0x94bbf887afdf8408,
+	 0xca1b44e99d2b6418, 0x622a11b7c29cc7d3, 0x9bfb7878daf42140, 0x6c8e206280fe62db,
+	 0x8f8da69948aa4e3c, 0x92edaa8dac734e52, 0xf258cbdee3cddf35, 0x1f8ea31f4b9b3ac9,
+	 0x092cf79b94f6c993, 0x81464b065cc33e1d, 0x325d654a553e5f71, 0x9b31b5b5a146880e,
+	 0x284d0bbb50b4dac2, 0x87bae7031f7b3b37, 0xe43874c4b018c0fe, 0x7ac0b2c82cbaeff7,
+	 0xf72d256304ec3723, 0xad3876d7597f4e1e, 0x433050af161a1ea1, 0x0f84db7a6b3424d9,
+	 0xcab093f6f5ff94a5, 0x026fb483a7624215, 0x3facb7cb83d86c16, 0x2cf36fc74dd0c232,
+	 0x4a151ea52ce2c2db, 0x7dda51a24ee09b79, 0x37331e4ea62cf418, 0x3da46fd9cd28be0a,
+	 0xd283cc5646bf625f, 0xae8d6c3ef0d82c5c, 0xab840c927c849631, 0x8ec86943c0cc5c7d,
+	 0xe90e34f9f4cf7189, 0x88b45af2d12c47a8, 0x1b0fa5a8e3483696, 0x08480589af7a4c48,
+	 0xffca71cc0a61c224, 0x8b080f98636c43a6, 0xe85a7a80e86e852a, 0x6bb0083510062a8c,
+	 0x80d6473074e8f880, 0x9d228a5eec1d5a67, 0x3f0fae7aded146b6, 0x34bc8f82723c8fb6,
+	 0xd48ab9e01e605be0, 0x2207ecfd7b13290c, 0xf83a88d2e695c438, 0x9891832aa845afed,
+	 0xc2f3e3f83db4617b, 0xd3094502e088f02a, 0xb332122bdf169015, 0x9fedb6a79ce7409c,
+	 0xa46f53fe8bf3410a, 0x1f561ca51464799b, 0x4a8c8e5540270ec1, 0xab1922d56d111a91,
+	 0x12727845a6308590, 0x1aa5be7dea4a7b59, 0x82c7cf2f612379b7, 0x2ebcae88561d3541,
+	 0x9b41d2b3525c8628, 0x59fe082f5df490d2, 0x98244db624b4f684, 0x51e4b13973aa6bf6,
+	 0x106d1477c396de54, 0x1d13cd8c7def6191, 0x02d231c0495711f6, 0x5ef24b403d524cf7,
+	 0x44afcedb34db31e0, 0x79fbcde94a7e97a4, 0xd1c3a7f2035fd32b, 0x62c58b67ac3215b2,
+	 0x003e4cbe208a9ea6, 0x7a9073600fb456fd, 0xebf3fd2682add420, 0x249992c5d78f99ff,
+	 0x315a283e81c57bdd, 0x7b72b204f815ea01, 0x91297e8f945c1c78, 0x9deb51d82155d19a,
+	 0x3bb6219147518bb9, 0x6e631063ebe53eac, 0x8de50a3a983cce9e, 0x630c6125aa392d15,
+	 0x9f120f9aa74c5c08, 0xf61ca67362f5547c, 0x414ec22208e38ad9, 0x1ba77522af4ad329,
+	 0x9c1bb30f922cf9af, 0x9021c1e98398287b, 0xd158e029b47476f2, 0x1d5ee6191e2a71ba,
+	 0xecede8cfb8441af3, 0xb8d4325a3dbc05cb, 0x9d76a45a2e959a12, 0x88c50e8805602c9a,
+	 0x24fe2e6745f362da, 0x6c593185914e07fc, 0x4fdba8a038a03298, 0x0d1c7805ff357ff8,
+	 0x42428bf4fe6043f9, 0xa083e210069decba, 0x1646d232db6c3fe8, 0x36f7dd8f71e3e4d5,
+	 0xf047eead301e9ec3, 0x871e6822addcd640, 0x6cc3f5089f11c8ec, 0x568653ed5d8c4124,
+	 0x66f2bbed13d24f30, 0x1d40f08c252ab2f7, 0xca8d5d5283ffc98d, 0x2761552520d021be,
+	 0xf9c1733d9584795e, 0xec0257b3d54726d5, 0xd028286548f68ab8, 0x5e6614e3a888a502,
+	 0xb4c9d51aa240ec80, 0x4120be83b2fcd454, 0x27eb7d02bd14ef67, 0x9fac013c53097a78,
+	 0x69196f2c19f1ce2f, 0xd2da6da2451653b7, 0xe347ad7075498400, 0x57e6604d222fa9d1,
+	 0x111e9404ccfb505d, 0x7036e23e64b813b0, 0xbbd5c9a6fd0ec07f, 0x63bbd2d97af7c406,
+	 0xe261492e060c8292, 0xd581469af72cbaaa, 0x4616ebf77b92aeb4, 0x1b3bc26c1a73c2cc,
+	 0x2c5242c4236871b4, 0xfac833abedcbeb86, 0x3a97d3dacdf7642b, 0xa36fb9457f1690b9,
+	 0x81993c85d020fd08, 0x4f54fa236722d7a4, 0x296c03cc1e071286, 0x421b8b4ac3b23dfc,
+	 0xd9bc60a657404e7a, 0x19931b0b4820f293, 0x9f84a6327dfa1f1a, 0xa962547cf33521e8,
+	 0x2171baa1ea7e8336, 0xf580219baeb59822, 0x1f20df7204d6328b, 0x811b9737ec3c2486,
+	 0x31696729b43ad2d7, 0x468b363e476d2cae, 0x2e50c1a3e469081c, 0x64bf0a09ef960a7e,
+	 0x75d0d94d8165ea19, 0x3f1d6e4775eae6f4, 0xb0c476f2a2ddd2ba, 0x41ad186f9cbef6a8,
+	 0xd239c4d0d7bb906f, 0x46c1b48e3cc8e089, 0xead2c4d7232d741d, 0x615d2cd5172b2122,
+	 0xffb0213c09086900, 0x9cf1e5fcdec71624, 0x017c33c6796aab8f, 0x754978223954fa7e,
+	 0x420a2a350b042989, 0x31347ec0ecabe13c, 0xe418f2467b68a5cd, 0xb6378742127b39ec,
+	 0x3c833f648846c9e6, 0x7ac831a347428c6b, 0x17fb0c48735f979c, 0x9c5f1c55eeb1633c,
+	 0x60b07ab8e74a10c5, 0xe80f3aaedbe1d1ed, 0x2613df81de1c6393, 0x084c2688528812bd,
+	},
+	{
+	 0xa8e66f3be2e07d7b, 0xe225e0c6458abc67, 0x1e6b6df172d53a0d, 0xa23d36e737ee634c,
+	 0x4af94146a53da311, 0xb9199d0927a766b7, 0xc367d57e5bd02b73, 0x769fb42a299100ad,
+	 0x9926eede12a2094b, 0x4b5ea7c333de0b15, 0xb7480f80a0f33449, 0x113a203c0017dee0,
+	 0x395ddeb692522e76, 0xf489787e12beab21, 0x18b2e808ef31c2f5, 0x2bb8a10aafe902a3,
+	 0x417097416ce3a9d1, 0x7e3bb2a12777b341, 0xec97336527fff265, 0x73e7958b5bae694c,
+	 0x34d41f1305eef936, 0xcdb219ad0266ad67, 0x82754061a386e2cb, 0x8a105df783098c79,
+	 0x35588e336175189c, 0xc4d34d18f6325a85, 0x463278c697a4f612, 0x21a28fafba96c535,
+	 0xb8c107c0c859ea0d, 0x2d02ab7a0e11d79c, 0xbc49b6c9dc9eee4e, 0x9715ff213944cade,
+	 0xe379f9612a464778, 0x9af92ca61a802469, 0x9ab61b12d7e9e9e1, 0x96cfe4d65f5be8eb,
+	 0xb9861d39c2371d1e, 0xc3105e23cb683194, 0x499fe32ec754044a, 0x230c9c90b790eb5b,
+	 0xcb7694c00bcf2233, 0xf9333819837c92b3, 0xdae3949482fb2254, 0x7cd2a8ac4ff93ee8,
+	 0xce7a484c02f919b4, 0x38121c766c3e0cba, 0xd1a116c56332b3fd, 0x8e1b678c251ab627,
+	 0xa75f8d7f4683dc68, 0xe7f114c37f909516, 0x0b46725985c668e9, 0x5fcbc82a96fe9676,
+	 0x7e356532bf748ce4, 0xdba5c37d1f9f697d, 0x66bf98bfef1cb229, 0x6a7c8f3741f9569d,
+	 0x6a22b029b5ad1e10, 0x9a74ec024600b8d6, 0x8dfb17ad88d4ef39, 0x7228b66e38088f3b,
+	 0x13fca13623ccd868, 0x41d5672192f99a6c, 0x9025aa9e3416af71, 0x33077cc5f839ba72,
+	 0x3c18270360569797, 0xfd95baa2e1b230a0, 0x73435e69cec834b5, 0x19ce7923cef9252e,
+	 0x29fea3c1347dfa6b, 0x39604f9c71056815, 0x64fcb89aadb3d12a, 0x87317e89df4f21f2,
+	 0x1ee9b572c557b155, 0x97f03f3d99d54116, 0x9b858ab1b6416111, 0x73ca75f313494827,
+	 0xe2d2fabe42c6f97b, 0x2c3b2d5ec4edf845, 0x107e6b30403ddf3e, 0x387958b83d5261da,
+	 0xaf1c51d928d59228, 0xcd5e51e8699d2b7f, 0xc8dc24d043eb2f2f, 0x07fd41b383663026,
+	 0xe7c787f7d36e647f, 0x409ace639ed3de3c, 0xd2c62f8d0e037765, 0x7248684022880bcc,
+	 0xc37ba2718614a456, 0x256b85d64e064ac2, 0xc79eae129e7df2a4, 0x0c3895c1d9922fc7,
+	 0x4a4234d1885bc791, 0xb0c674d2f410336e, 0xb5130183abb90a91, 0x0ec79e4dd8298eaf,
+	 0x7379b343d8b8aac4, 0x94b0c35b7d532640, 0x42df9a7954024bb1, 0xa66fb35a2d07c717,
+	 0xa1b5026dca83dc61, 0x7d2cb7390f8d26bb, 0x967dd67a0721aaff, 0x8bc797eb90439ad0,
+	 0x0bbbf2f0d4ba967d, 0x615d4eddd4b03ab2, 0xa6c021f928eafe8c, 0x342832e277318c42,
+	 0x567d84fa352e2393, 0xd7e86ca039ff3d09, 0xd4a4975571feb7f6, 0xad69f3fd74e9b82c,
+	 0x14a24892a02131bc, 0xebc6a6f8c44cb4bf, 0x205838ed8fc83c81, 0x48f3b431a93a9c44,
+	 0xcac99d2e674fb58f, 0xaec1e855a93ec7b5, 0x87a3ed1490988593, 0x71e335975a9c1c00,
+	 0x9cfeda2a338eee70, 0x71ef3b91c49f30d5, 0x0f94b5112fe60b40, 0x61d71859ed7b76b2,
+	 0xb1396061bed62a74, 0x565b05e31a052d08, 0x2c262d9b3f263c5e, 0xb3d918e94e34f9a7,
+	 0x31c6679f5160f5df, 0xad089a5e189e027f, 0xaeec4d4670fbdc59, 0x79a4a4d1d3a5695b,
+	 0x66d223755e6ab31e, 0xba34ee20e02d9626, 0xaf974ee4dccaa21b, 0x2bc616fdc3a5d44e,
+	 0x3044bc01c7b99db7, 0x3e406cb4d50bd341, 0x1d8c2e08b12edb65, 0x4a703686faba468d,
+	 0x4f1661c9b84d3b04, 0x4f8b594725245dcd, 0x54871991d43cde0b, 0x0a48a1163ef17d45,
+	 0xfbead059d0ce870e, 0x54d95141b95695d4, 0x37375399212ca32d, 0x286cab0d5cd3be74,
+	 0x1c0e10503cd8e60b, 0xeed2f2302f2f07ca, 0x2f592f7606923e05, 0x39f66939c1f203ee,
+	 0xd8862183c1734753, 0x6458e217ea143777, 0x17b2fd5aa81bdf98, 0x2f11f6e277959480,
+	 0xb3b6200db2e5ad9c, 0x5e20805a62124152, 0x745e34222dd44f6e, 0x93c28cdabecf2130,
+	 0x86c9849609b9d3ae, 0x86d4557f0aaef913, 0x716bdad30126b310, 0x23495c75b352107e,
+	 0xe07f0b0c87cb97b4, 0xb37893bb58333a35, 0xddb5f4dc2f2982e0, 0x54cf6dd1aa75e998,
+	 0xab892e854e85b281, 0x3834cb7be6a11518, 0x96ee1fb5f868a385, 0xa8d9d1cd4de43270,
+	 0x4811e5eb5d592299, 0xd52c81ffaf36b702, 0xdfa993b34592e7eb, 0x825495a7f1e8738c,
+	 0x8bb4d127cdb29b10, 0x26d8924707e8a351, 0x20dfbffb9d4c51c7, 0x2b8ab9b90671106c,
+	 0xd571c19c9ddb8ce4, 0x5005e34b5b9118ab, 0xab30013f31eea69e, 0x494d61725d85d523,
+	 0x03b6c5789da076bd, 0x70204d8609ad73a6, 0xe241950111203a65, 0x8da3f7a6d2f1c375,
+	 0xd326efc5e9c2dc74, 0xed99e00b1604aed2, 0xc228aec8117a0f80, 0x0ccb453513636c83,
+	 0x9004533186998682, 0xed19fc58dc9faeb6, 0x8903dd8dd4910f43, 0x0d91bc6ed65276b1,
+	 0xb4b94b69c09f5fbf, 0x52ab974e3c885b6c, 0x116c80061d4c538f, 0x8463310642edc146,
+	 0x7fb61ef266484430, 0x57b04860ce5239d6, 0x6936df91a7c58c95, 0x85db8410edf7c511,
+	 0x12c26d80e9b4e85e, 0x74da790100b5221d, 0x435db19d087cf517, 0x9b47720b9e806d91,
+	 0xd5df3c72d2e340e9, 0x4a131f0e65dc67a6, 0xd39d383b54f1a271, 0x0dd0e6f693f7fe52,
+	 0x6a5e74326c1ad67b, 0x97dec3b293b1488d, 0x8edb90d689afab85, 0x534fb814794e569f,
+	 0x821a6f516703009b, 0xcbf50490f240c6c4, 0x9ff0ff6979330be8, 0x3888c6effa71bf74,
+	 0xb1a932d5600ccc86, 0xa9d56f029ddd1203, 0x86ecdab4a636433d, 0x92e18a929e40e238,
+	 0x1522527489c67196, 0x221ea239f6e5fa4c, 0xea0aa29454bbf200, 0x2bae31fce4577496,
+	 0x7b406636fcf29575, 0xf9483d59432c45a0, 0xb41e79f99feffcf0, 0x0783ece1cc99e1eb,
+	 0x1b835eb5d5935004, 0x893226bd115e8633, 0xd24958bb45272dbf, 0x2ff917d3368dd70f,
+	 0xace5f2be665c608b, 0xe5c102e493ff7eb5, 0x0ae415a27709e4b3, 0x73ecfa506a196dd6,
+	 0x9b2c0842a10ea055, 0x0349fc0187b18b56, 0xd5abbe5af2ef5d7d, 0x652a1bad50e46a1b,
+	 0xb86760c7ae841b75, 0x5727de7d7ba97263, 0x4aa54359fbe0ff1f, 0x75b906ef50cebe16,
+	 0x7fe10ccb1d63f8df, 0xf7de5120ba516ac9, 0xecf421c1b4675d5b, 0x171c6bc9c9bc53bd,
+	 0x3028788c5cd7ee2e, 0x995b2b92e1fec544, 0x062066f4a7bd88de, 0x3867550e239ee1a2,
+	 0x174c4eda94b815d3, 0x5236a8900ddcea9e, 0xbdb73bfb75edf0f8, 0x757896306e9f70f2,
+	 0xf6d1ec2467649d1a, 0x59f353cd6d2b1228, 0x3795fbbf6236e4d6, 0x187d8b0fb72faef5,
+	 0x677e9d5291ced512, 0x4d8f4dba639598cf, 0x600f929b61c54f14, 0x48a7a2e8826ab0c6,
+	 0x929ae049772c314c, 0x909ab0ce72b259a5, 0x76702b44a9a0e1ae, 0xb22402df8f3a08fd,
+	 0x77ec76462c639f6f, 0x91897bef1678e428, 0x74f2f6c52d444f57, 0x83557c3b21117d21,
+	 0xbbb0fa02b05766fb, 0x253b2a8381aecfe6, 0xe52866d8f9ef1eb3, 0x5dbaf15b515fbb6f,
+	 0xb1e93e6fa7d7b0ee, 0x1bde218fc59a78f5, 0x26672692777bfb7d, 0x5a4e12c96f6493a8,
+	 0x6af8e76c47d5711e, 0xf31d2173c24512ae, 0x08f8caf6940f0c52, 0x247771db88dd8f84,
+	 0x9341a321f992181c, 0xc6b4534e66555a5c, 0xb13976c2965189c6, 0x35566ba57bea00ff,
+	 0x386044576c47cf12, 0x8f17c567d29fa834, 0xc803cc65888d0cd6, 0x4f17521b3660f9c7,
+	 0x70844080afe18867, 0xf00b37214691b586, 0x5adddb875c89fb36, 0x6053c49e3585ef66,
+	 0x097e0428b6c14bdc, 0x64ca3cd3be7bf9cd, 0x9dc305593d936a99, 0x616c8cffcdba2d75,
+	 0x1fbdfd6425c1b1d1, 0x811be0a08f1d9d38, 0xda670fd93e869f65, 0x46787941a6f57ad2,
+	 0x43b1861c5bf2cc2d, 0xfbe322ad5c8d1fa9, 0x8fbf0cd060679a4b, 0x226bf50751f145d2,
+	 0x527e3bbf1bef8c55, 0xf85b116712e3e72a, 0xf2ec2ccb850fe73b, 0x7c7996ba3f9403e9,
+	 0xadd15b7ac693fbac, 0x574f4da42182e0e4, 0x5e8a86d50b16806b, 0x024bdc7336a94ca9,
+	 0x9518a03cfc9dce62, 0xd43584e7a74bb2d5, 0xb4104e9cb818d722, 0x3e8182106dc66f2b,
+	 0x57e0c87f4d5dda40, 0x4f53565c64a7b847, 0xe0696041020ce59d, 0x88adfd2b0bed5400,
+	 0xc816fb9f1ffcba91, 0x19df6274322d38cd, 0xd58f9c36049812bb, 0x6b888e58dd6d9003,
+	 0x9f4d615bc42ba33b, 0xba24b70406f3d157, 0xf52d960d19d2d4ad, 0x834050859b52ca78,
+	 0xbbd1a699929d1014, 0xa3372ae7b163b02f, 0x07ae446e08404bd6, 0x3b1e9f55e8bb6ef6,
+	 0x1a9d26f9e4f6fe22, 0xb302ef14c3bede27, 0xf8eec8108f307da4, 0x0d7ec1bdbabafa3f,
+	 0xfeae5a8145268fe4, 0xd045c3ef36af208f, 0x163a43afba469613, 0x18576d32866ad9cf,
+	 0xbe9ed709302770ac, 0x8b37236e6564b3fa, 0xb788a2ce9454165b, 0x92c56668b8bc282c,
+	 0x5fb30a6de1614781, 0xeb156746d93ad242, 0xf7e73f345055de10, 0x53d1c5803d5843da,
+	 0x4e2c18e347ec882c, 0x132a0e8a3a42d798, 0xc2d45115ab1a5674, 0x37ca0c4e6f353d62,
+	 0xa788a144d6609b4f, 0x8c10370ca2670868, 0x9310e1d82b0b71a5, 0x49d025da9ac93199,
+	 0xb4fe226b73c9def2, 0xd98508ce731014e0, 0x6c1768f442083569, 0x76839fed4167c659,
+	 0x05a770d15839e839, 0xf3e488138634dae8, 0xb95d5b7dc882458b, 0x00be3fd8d17f5dcc,
+	 0x3cfbfd56590d6ba1, 0x56a12db7f982cc02, 0x82c3e424fdebbe6b, 0x7d81e224f9de8e61,
+	 0x9cdad14ed59abfb7, 0x53c6454ebe906b6d, 0x9279941a5ad80dda, 0x7caa6d9d4bd946d7,
+	 0x011b7e59bdea99c4, 0x4f85869318a12691, 0xa77e448b4d45cc67, 0xb4301afb7db519fa,
+	 0x85140dae3573b7e9, 0xeb6fc8c86a49b1f2, 0x5ec6728310bd56af, 0x05fff4459a8e4447,
+	 0xd34010b0020321a6, 0x70922bd24707c163, 0xd1d4a290ae61ad14, 0x6fd398dc168da493,
+	 0x3a2eb553573886c7, 0x8006219332b4fe46, 0xe81189a0da702c79, 0x46498029af6311d7,
+	 0x1e1cd3f8e6fb7d72, 0x1da45f6fb7acfbdb, 0x5f614100d6f0acfa, 0xa23fdf715fd61040,
+	 0xdad24427489bb453, 0x745b8a3dce8b48c9, 0xf640338df7f0d14a, 0xa3731a8bcd05e9d8,
+	 0x4714b39282e7c82e, 0x0f991d5d8808bf89, 0x7a2e9a7b9d2a7a73, 0x337e83c99a760ef9,
+	 0x9e0d5ce8980100d1, 0x52386d210ce16af4, 0x46c8cceb4696edb0, 0xb191d3e3ef0190e3,
+	 0xb4bb029bf1818d51, 0xa5185860d39362a5, 0x6fed904309d99682, 0x872283d8c7378344,
+	 0x776b69bfcad40bcd, 0x1ff0d6394f8f04b1, 0x3dfc63a37144e181, 0x64b5c6c524fb5e92,
+	 0x0b45a8164f3e4938, 0x3a828d20dc27e0ca, 0x0fe437cb7118ddbc, 0x68e0162115b0d550,
+	 0x354624a17c563763, 0x7704950528ac728c, 0xc360e10d3aab6c93, 0xa652872251e69ed8,
+	 0x7e0bb0aa96f855d0, 0xc59a5ac400381b65, 0xf5c8fbf01307cc53, 0x12e8938a3d0bccf4,
+	 0x56dcbb9654da0533, 0x7ac22eb8d9fd3619, 0xaef7be8652ba7603, 0x092bf01c7d64b061,
+	 0xbfd786e4e7c8039a, 0x47365bcd4e55c7ff, 0xd616c4f6dd9d3f0c, 0xb523443d842725dc,
+	 0x2e3f27c0ecdc557d, 0xb6b922081bf78faa, 0x0c3292cac4b911ae, 0xa0e70bcf927b1b0d,
+	 0xa28e96b4ba5f6f1a, 0x19e6476e16cf4b6d, 0x46ccb62ee8fcaa9b, 0x0c93779bb45cf6c3,
+	 0x5d99a5a78bcb37e9, 0x57e73d97e550fb8d, 0x3ab26cd4b8f34590, 0x7f00c47a119deac3,
+	 0x78f8eb6c58205877, 0x2132987da8679d19, 0xe4e5f99d09674ee8, 0x1a9a67e31c868e52,
+	 0xc6d2c3b15145f841, 0xbf4f6c94bfe4547d, 0x9f1cad75285a0dd9, 0x563b543ba31d7f69,
+	 0x272aeab073e12f3a, 0xc0f216611913630c, 0x8d19949ed6c42bf2, 0x08a43fbdd098f882,
+	 0x1f236bcfb42f0da5, 0x9f46905b021bbde1, 0xad5efec282bece9d, 0x2484acd21ba5b3e8,
+	 0xee063042c6ba7645, 0x506077bd770ae400, 0x76bafad0d1bffcab, 0x50adf47d35fb7594,
+	 0xa9ae4725f3a8c6c6, 0xdc6343473958d168, 0xd3ead4d1bcf4f512, 0x7c9cf829cc2c04be,
+	 0x7156e5a22d1b388a, 0x4b05bafffc78f8e4, 0xf4a6bd169c5ebf45, 0x5f5c708e5b8584db,
+	 0x2ec2cada0e7e1be8, 0x2036fc48018d0189, 0x35d523dd517d9d71, 0x7c0004269971c230,
+	 0xbbcf429c176a67e3, 0x38a87b3921f96cbf, 0xc802f9271e80579b, 0x68edd66e69268092,
+	 0x486dc8b949a10e5c, 0x029c7680641fe84b, 0x0ed7c6a53172aa5b, 0x5647b650e62adfef,
+	 0xc834b2605f91b763, 0x8d8c9c2a27d139db, 0x7863459ad8cdb9b0, 0x705e3f07c3fdef34,
+	 0xcd8be982043fc313, 0xc8c0481aebb010f9, 0xc10b7a8bd06be7f1, 0x16f1cb234b134151,
+	 0x13b3a01db7168084, 0x3720ae80fade185d, 0x19679ec508b30442, 0xacef734670dcda46,
+	 0xf8fb787f8f72658c, 0x299b8d3b4bac86db, 0x2bb4aa5f78691099, 0x6328d9f11ef58da6,
+	 0x6485ce260b6242d7, 0x6bf669738d00b4c9, 0x3b4fe949d396968f, 0x122d41bbc8044ad1,
+	 0xee7dd7f6db02e0c8, 0xe9940584aa516357, 0x99b41a46955edc36, 0x253b27275095cf66,
+	 0x18b161340d390397, 0x994b3182588667a3, 0xc3e3643867aed66b, 0x447204a0eb5d9e7c,
+	 0x0fbd325198d4399c, 0xc658f4d22316c7ca, 0xc0082f7c0dc0e218, 0x605cd5defc991e98,
+	 0xe9d636fd8f4ab33f, 0x4cd00d75705b3203, 0x1f704bcca87c8dae, 0x411fce5cc7702560,
+	 0xf085c951171c7d7f, 0x2bf881dc68b72165, 0x27b239b7d187fec6, 0x04879e4f0b56a458,
+	 0x5f67431365257ddc, 0x0dfd9e43aa68cba6, 0xb836248defd55dfc, 0x9728348b2a604149,
+	 0x484dd0e53b4a5ab4, 0xbf8b48e2a4834ed8, 0xb44014d2944e7ec8, 0xb54082896200a4f1,
+	 0x78c03074bfe97592, 0x187888edc8758583, 0x6d1a7b701877258b, 0x5b97f07fd31e4b59,
+	 0xe5247a9ddd57ea31, 0xb3c327a8afcb6d89, 0x198a8843d8dea1f4, 0x4047e630fea3e6b8,
+	 0x9fc661ac35532ff8, 0x07131aec63b19420, 0x0111f68b802bfa7e, 0x42a14b3a88274e95,
+	 0x38089c05dbf19314, 0xe4e763a8c2d15fea, 0x2cf331b7af8c797b, 0x0c3c118e9d9303e5,
+	 0x8f5b432d8b710a05, 0xf11a0a3f435ab7e2, 0x45459fcebf5d1e42, 0x62bf5e414b527222,
+	 0x1c280b8950272ef2, 0x67f1733aa0147797, 0xfec0088ac8cdaa87, 0x5e22cf113e29defa,
+	 0x6dd771d75b50c8be, 0x851bf241d7325770, 0x680998f52d45155f, 0xb0a773ad8378cd73,
+	 0x4743f83f5e296af6, 0xadb19d6f1795ef5e, 0xb3e3bc5e668149ca, 0x992f5d962518aa87,
+	 0x490b6e25fbc88cff, 0xc4242c622aff117b, 0x8850b76c3f97401d, 0x6a1667f5efa309c6,
+	 0x5a71621682412ef4, 0x88226ec1d984f760, 0xc06d8c18cd565ab7, 0x658cc6acca457c57,
+	 0x399eea5aafe75b09, 0x14e57a2aff4d341f, 0x7edf978b273a2012, 0x0f5438f35d852ebd,
+	 0x44ecc348243e6af5, 0xeb935023a93f0895, 0xf27640c68194b095, 0x37fa2ce38f10b075,
+	 0x2463831de115e750, 0x06eaa0a930e90927, 0xa43cb61236eebe95, 0x0f30520d97368157,
+	 0xf4975108cb2d4928, 0x8d254e3bd4b4a335, 0x834d13975c1475f0, 0x062e9540b0dd9e88,
+	 0xc9149472c4bf6073, 0xe4ec82ac961a1570, 0x3c89403170fd4afd, 0xb074fd8a84ee7988,
+	 0xf4c73d0ff16d88e4, 0x1c2346ddee458944, 0x47b1fc860d831ba7, 0x78051fcc5dad586a,
+	 0xebd5cd61a3f709f3, 0x2424d03d7a44c5e8, 0xbbad42e7e9ca7204, 0x36491c751a0c0824,
+	 0x509524beb73db680, 0x4bcfdd32ce648885, 0xae06612d87336041, 0x19bbaf1a55cba890,
+	 0x4a248f74d07907f1, 0x418c4a22340108a7, 0x6c70e8494a26126e, 0xb2f1affdf0278e27,
+	 0x0ea2048a38de4b78, 0x49ec2fbada017f1e, 0x0b60d569a3231d06, 0x58282e43a363ddb1,
+	 0xf56fad4859b5aab7, 0x022916b50ef65913, 0xe8ea39e03cce5d6d, 0x9e237b53f316a765,
+	 0xc50ec70e1460f6eb, 0xbdf0c7863b5a9569, 0xce36e22a8a1f46fe, 0x6c0e12509bc39a2a,
+	 0x83bd31eb8c6f0be3, 0xd89eef4a5189501e, 0x3d453f017447c6e4, 0xa5f3f016a260f714,
+	 0x4ddc5feb092f14ad, 0x66d368069d40723c, 0x1b4755f541c45109, 0x8baa56f001b04dc6,
+	 0x8396ce12ca3ca8fb, 0xd3acda8a7646cb29, 0x65dee02f7d8240af, 0x49ec6055b3e55829,
+	 0x18ce441a0d8436ed, 0x6f583edf04c17942, 0xb006e937a4d2debf, 0xaf06dc109f627b0b,
+	 0xedab60d48e4847d7, 0x9c64d4713ac0b8af, 0xd47057ccd5dd6360, 0x6cf1cd121258074c,
+	 0x0397917396ddf012, 0x80f798d66a93c7a2, 0xf0e350eea8f2eb08, 0x96fea1b6f50fae7e,
+	 0xb526f901e1853ccf, 0xc89bd3de99156317, 0x962eeca950162396, 0x8512220e4b6ef329,
+	 0xc3586c6d3ca7a471, 0x420d2ca080d99dcc, 0xe0dd7f04a52ae027, 0x51a7525a8913b697,
+	 0x9c07418ceefb7ea1, 0xdb8afc0e9aa81c4e, 0x0362583a3eded1b0, 0x2f693fd642b556e0,
+	 0x9bfb235e81e68fa2, 0x9c1f5258e3c793ba, 0xa62ca19911216888, 0x02289f92e8e81739,
+	 0x0124e8266ca654d0, 0x58662090cade6754, 0x7a9842ea0051a62e, 0x6c814b1f2b2730da,
+	 0x61f03a01aecc98ff, 0xed4cc581a3b64043, 0x9182c87732481138, 0x16cdad4113526574,
+	 0x62a16dd3f5078e46, 0xd1623a197807cd09, 0x7502a14a82974f1f, 0x03a6c42da7d61282,
+	 0x4831fc1e1ddeef85, 0x1e2ab941a033bf4a, 0x4442282934c29cd9, 0x22c7bde53ca43f52,
+	 0x0e4642f7ce67a4f8, 0xb0136a5f759e1a47, 0x52a4c35538135682, 0xa079f10b90982064,
+	 0x993ebb9d6882fdc1, 0xdbf37b33d508331c, 0x337f23d26e86cda1, 0x8ee2119c6e04e101,
+	 0x9645195b509ac8db, 0x437de93f94c4988b, 0x13a9927c93c82d2e, 0xb065cf42f6624b60,
+	 0x6e0f95298454b07f, 0x9e41aa9109a89faf, 0xafc89120c04231cb, 0x35e3afb0e3249b64,
+	 0x3551c41384c4cb90, 0xdbc9e5a7e32807d7, 0x39628195502cce70, 0x400b94cc277175a7,
+	 0x09b2db3451d5c9c0, 0x8136895f5bf04eae, 0xd02f0cd7a7a1d436, 0x276a7a274785990a,
+	 0x880188d142ec4f1d, 0x9e82d44a180d0a59, 0x1ab3aa79d4bf63ec, 0x0869b03a41ebbebc,
+	 0xd95f1acb51702233, 0x425467e50395312a, 0xdcd51114abe00c40, 0x8b155b46a5ed483b,
+	 0x50ed15650a569c73, 0x0e94ef3f268f59c4, 0xe517e872a92dfe45, 0x0ade947cf70c255e,
+	 0xb029fa966700f455, 0x734792434e5cebca, 0x4911d629ded66a6b, 0xb151cf8694c0bdb1,
+	 0xacead70725ea6b5b, 0x60a1152280bab66d, 0xa5a9867d3a87e4c6, 0x7c6dc44a22dc7e4b,
+	 0xe0cbfd01fc696a9c, 0x7b93a3179e7a65a6, 0xe36a80fb0a162b1b, 0x9b31146158d70a03,
+	 0x76385d11cff4a03c, 0x043ac1811344d9f9, 0x9a1f3dfeb0bd7e59, 0x61a704ab4ee65320,
+	 0x261226bfe80f3d7d, 0xa4ea28937be9de81, 0x5a42d89d603d471d, 0x3bf6aa2347a32ec7,
+	 0x6acd405286ea22a3, 0x8686b2e2754b4681, 0xff1aa6efb9f50803, 0x5909734b61b7a127,
+	 0xa1918354506571cd, 0xc0cd3f2aac60b980, 0x687d040f6bcf4eb1, 0x2fdb857677d4bebe,
+	 0x7fe2a5175f634d38, 0xd7c32064c2a8f28b, 0xb66256afd44fd8f5, 0xa17131176e13a423,
+	 0xc0325b29ead68093, 0xa89657ebc08bd1b8, 0xcfce62b979414f11, 0x4ecb8299478222e1,
+	 0xa70d1eb10834e047, 0x5820061139f93dba, 0xa1a7673224c30cb1, 0x212ae56a27e088b2,
+	 0xb9285270b91a8b3c, 0xa2e6b7504ffab92d, 0x48565835da9cbc6c, 0x25398ce5df5b5e5e,
+	 0x153876c093574e0c, 0x46ab6af6f6441ee2, 0x5c7a6657d1e9eb4c, 0x7b5e57e688c8b13a,
+	 0x4df3bf15dc6c0116, 0xc8c2f176657816f3, 0xc18bb825ca714fdf, 0x56e8663947cc33b2,
+	 0x5de5d928970dacc9, 0x579101a3ae97a673, 0x087423f16ccda7ce, 0x4e7c37ddc5ae274c,
+	 0xb5a0f64346065a0e, 0x1a1cee6a29b2bd86, 0x7f04b4fd62ea533c, 0x45cb728ddc75c37e,
+	 0xfb085eecc0365d1c, 0x1ded67208a466678, 0x25646ed6f355f0f3, 0x5a14d6f763663165,
+	 0x7c093514b4e9f7cf, 0x4185edd411001424, 0xb716d2a58cdbcead, 0x785294c6597821ec,
+	 0xc7e4554c9a680334, 0xc60042c89b85ed89, 0x97480877258d2083, 0x884f624dd86fff32,
+	 0x2ae908d04959755a, 0xeb27fab196951632, 0xbd9e5f2da62a93a2, 0x996995d2dc3145f1,
+	 0x463bb61288a1034c, 0x7fd632fb1bfa3f27, 0xda81cc6394bd6d64, 0x299980c4b55bcb4d,
+	 0x646e9073080bc4c9, 0x96f4c4072dc1c3eb, 0x5d10212161fe14cf, 0x3be2eb8a50dc9d32,
+	 0x1df8acc044d1876e, 0xc9ee15cfc5fc5b67, 0x6f8021ab2e275aac, 0x08166b4037438d41,
+	 0x6791518176e1c2e2, 0xd636a9d402000924, 0xcd981ba2fdc86b37, 0x6e283cb32dc7b94a,
+	 0x725a9c5f6eef0877, 0x5d9497c270f725e1, 0x4f1ebf252d883826, 0x961ad4f3c7781e19,
+	 0x9ffcfb47ed57feea, 0xb9f8a2c8cd425cbc, 0xfe9a628cdd5f3eb2, 0xadfdc42a8215b0f1,
+	 0x62f916ca26242787, 0x8634732a3857c270, 0xbabcb6a34a08ab5a, 0x9e898e6749912bf0,
+	 0x6878d5c7da8d22b5, 0xefc267de7101d1df, 0xc7e4831983b13985, 0x7c64b5472b4fdc02,
+	 0xf32440b1993fba9a, 0x7e97052e6d56909b, 0x7325998e995f1eec, 0x7efe4b8be1b378ed,
+	 0xfa386a324085ff48, 0x0bf36e1fa2cf1829, 0xbc14211949bda16a, 0x0194191c1ea18866,
+	 0xc55bacc641abb3c8, 0x647fce593e90fdcf, 0xd812e2390e769baf, 0x7a2cd9e0f061e422,
+	 0x4a50d480306d6d22, 0x2989074a02302401, 0xfd7edfe10bc529fe, 0x726e083245d16729,
+	 0x7ab1d4c8612ad9ec, 0x1180b4d86224e230, 0x727eb13a20487f9b, 0x059f0d6a4a28dbda,
+	 0x53105c2e0f5767c7, 0x94749e322f2514a5, 0x59e3756c9b81f2b1, 0x0b2a2bad9ff98070,
+	 0x06458a60a8f31e15, 0x5056009f792b2ada, 0xf99a3ed8b6994e09, 0x82cd20d4fa074eca,
+	 0x647c27a09a44c39c, 0x8eeb25f5f25a119e, 0xc4fad99e759641fb, 0x81947886402e4278,
+	 0x0005dbcb60342adb, 0xd734b619b93db991, 0x9379b9cef6e9712f, 0x2c545f3c610fd935,
+	 0xa81b35678afd6647, 0xd83f78f9cfb1e5aa, 0xaa16d31410703206, 0x78c86c573645b13c,
+	 0xa2a724e4b6abf272, 0x455a40b337c897f1, 0x26cfe6ea177bf633, 0x623d03d1d9d90f0d,
+	 0x44efccc4d2ac0a91, 0x7297d6d3981ae184, 0x332084ba93921871, 0x61ea7b84d758b3bf,
+	 0x999017af4a668fcb, 0xb5cfd845b92275ad, 0xd864f0a50eb3b497, 0x62f1adf7002f8fef,
+	 0x5e68307004f3c676, 0x516512c68b750be9, 0x52db70d6efad905c, 0x0e8e96216f9ab480,
+	 0xc6ed0b542ab40181, 0xe4429a6df93ee1a3, 0x7e8e55cc385a9d2c, 0x327e6a84ba79f30b,
+	 0x6a13cd79d4a4defa, 0x83c7a5ef1f4e6703, 0x83f60d6f7e87a8b7, 0x6b16f589a6e23379,
+	 0x6f28fac0b376d714, 0xd001f4c7536891c5, 0x021a934c13728ce8, 0x51beace0776986cf,
+	 0x276444934c8cee2a, 0x96d56b05c02c81c9, 0xd71a8a8cd07938ff, 0x94a53a43c7791c27,
+	 0xe4c91c3332246a04, 0x755a6e3d8724068a, 0x2008ea4a7e8535b8, 0x86bdff37b7765738,
+	 0x76d5d9cb07b0e75c, 0x59d7c52f20c7636c, 0x5c5110703e844f07, 0x01a7bb84c8e3a7fc,
+	 0x42f401a01d35342b, 0xb0725143ad932ba2, 0x2bac328bdde9d26c, 0x3af9df67a9a47f1a,
+	 0x4675a05b5dafb432, 0xbcecd45716a0b1fa, 0x09f011dd1f00b5c8, 0xa1a661fb77c7d6dc,
+	 0xad920862fb0bd580, 0x9c3d3db9ac80b014, 0x705b996397365be0, 0x88d09fe0fddef7a4,
+	 0xd1af8bd92dfc2da3, 0x9b739f667fdae982, 0x49d1e2ace007e453, 0xa4dc05733a62b54a,
+	 0xd07f9806aba9db7b, 0xc2eb43524ddb1e0a, 0xf4b74c9ea5ba17a9, 0x1dec3e3088102dcb,
+	 0xce35d08a18f31387, 0xfe6d5f9f8504e5c4, 0x44b533579f1b370b, 0x8e8514cf3e983fe8,
+	 0x3b6b59980d8ff478, 0x69209327e41a0dc7, 0x215b2db0ca678415, 0x4253ac449d027621,
+	 0x5b126f81420e8d4b, 0xdf892c1ed6550704, 0xd13eb662f02f63d5, 0x9a53a52bca4a8cc3,
+	 0x7cbe022c7a58fd41, 0xf5a40ca2353b97a7, 0xd4660985909e6c7d, 0x4ee61e52db0ec039,
+	 0x9db1b71cd3cb69dc, 0x503f8456d89a21cb, 0x8c68ccd02d4645e2, 0x53ae204d0547de39,
+	 0xb569dc28d67ee88d, 0xedb94f76ed673bae, 0x7d16643fb171cb1c, 0x332b41ed6c5700ab,
+	 0x78d5d0c822cef64c, 0xce1322329b5a0753, 0xcafffbf0bb539971, 0x71c967ac0198a8fa,
+	 0x2ad8b09f948f4de0, 0xf5ac4447222cad40, 0xbf9f8a4e4459965c, 0x6ea41a1c7151b5a5,
+	 0xbe207e9c66fda81b, 0x39fde12be475b379, 0x59dbbd11ba37ad1a, 0x2b4d3f41d7f79965,
+	 0x5e5ed52f68cc98ba, 0x41dfee58f406b64b, 0xa2045ce812ba337b, 0x5952c64e1c1e9be7,
+	 0xd723abcab06137a3, 0xcad542ca38c23a15, 0x5a61e800c11cd983, 0x244ed76f30d8c041,
+	 0xdc69dc5c92a89359, 0xc52b06d3ef390a9c, 0x311e5c1d924a065f, 0x753d0baec8f0c6ca,
+	 0xeb70848fec32b320, 0x1bdbe68137e329e0, 0x0a1e21acf5f4663e, 0x49982156064e38a8,
+	 0x4a6e2e9e982f7c8d, 0xd16e95804659e86d, 0x52434e85c4455638, 0x49e44422c200d616,
+	 0xad03d635ceb0a914, 0xd51b6d831fb2f8bd, 0xd58c3eb1f130f60a, 0x8005fa18843634f8,
+	 0x6331d8a66d19dfc9, 0xb9ee376afaf05209, 0x3a9264f3f69d20c4, 0x41a6b0f8465dc73b,
+	 0x2e633734c1b4ffff, 0xe7574b40b09324dc, 0x3e0b414925581b51, 0x2ab312967dfd4502,
+	 0x57f26ab89a15be15, 0x7793c8e95433d7b9, 0x2a3316ff8b48782c, 0xb1b19c3d71df0557,
+	 0x8cc5dbe3b584e057, 0x53f3d0fab017adf5, 0x0f433e48e3f84a96, 0x6b5d9f58a0c3eadb,
+	 0xa48bc3fdb7e14245, 0x04185d0e85c78957, 0x5ef2bc279e75265a, 0xadc64dee6fc4f330,
+	 0xa547acd9ff28e696, 0xdfb5f91799ed86fa, 0x7fc0ffd4080fbd95, 0x0c35317d0150171c,
+	 0x36d3ef49c8b488bc, 0xb66e2138b3fd3b27, 0x48129288c7232621, 0x50916e1b1987236b,
+	 0xc335985901abe156, 0x219116f6b2ca735e, 0xbed72b8efe69d056, 0x8165827ececd272b,
+	 0x9a563a868ee9374d, 0x72a3ed6444cbec1d, 0x007def33e64dbd2b, 0x8f447d90384dfb92,
+	},
+	{
+	 0x004b8c34be120428, 0xcf28de2be9d10346, 0x7b1b919665373d74, 0x92bc4a9117d19afb,
+	 0x63e6061ae1ca7c44, 0xe836c3e48c0840ff, 0xa7b6790015749143, 0x7d5de57ba1233605,
+	 0x1cae9513eb4c286d, 0xa0cd02e3edbf11cb, 0xef3ab9913db360b5, 0x141b110f84d4aeab,
+	 0xba625c3ecafadab9, 0xed9e9b7471c258a3, 0x922418a92036645c, 0x220d3b92e661bc0f,
+	 0x4683ad3f545b910d, 0x12f870a92910799e, 0x480aff9b0f547348, 0x2cee1b3ac7c823da,
+	 0xd32f72c348c91582, 0x5c41710ea1df02ae, 0x29f0b1f845e71d82, 0x3fa492feb2640d4e,
+	 0x42865e835640d084, 0xacfeb33bf1442adb, 0xc5568a4c7048f2c1, 0x86ed786cb3ae7278,
+	 0x708a216b5cbecb72, 0x80a594a96da61763, 0xd41e14bfd54f57d3, 0x543100ea260eb293,
+	 0xf10c727f31d8d6b0, 0x3644e28619ac7d9e, 0x6ab1fcb036eb1010, 0x0f1cbbb7f680b4b7,
+	 0x7afa64774329e97a, 0x1e9f1c65ce701a61, 0x839798b4f971fad4, 0x18f06687fa8ed767,
+	 0x7853005f5a7902d4, 0x406d798c6f4a4a3a, 0x64e2eee892836695, 0x5e8a7f8419a87639,
+	 0x064727d3eaa0096b, 0xf96acda1bb343fff, 0xfd66266173ead896, 0x1e86b81eaaedf36b,
+	 0x1956294fa662b946, 0x4f4af30451e2a2e1, 0xe9137b8d29d20583, 0xac2e15d5b60b8b78,
+	 0x6f3387a1b02c9c9e, 0x9b887642c32a8d9e, 0x1c7dbd380fbdc42d, 0x6609e885885cd975,
+	 0xa83292b4fb9dc8d5, 0x70c17c8f0718d49e, 0x8412a5365903a75b, 0x33fce3ec94c31e25,
+	 0x1142bf699628bd2e, 0x7d2bd765f8bc697f, 0x1bbdc3e3c85c1cf4, 0x0a80f50787c1e928,
+	 0xe243ccb5af721b4b, 0x1e3447e4fb843313, 0x80f3faa589953490, 0x80bfa5d17e68417d,
+	 0x1f7f3b9a27a54f06, 0x73fa6aee4063ec3b, 0x857baf3fd6177b90, 0x0206e2f65156770a,
+	 0x2bf7187bd49e2805, 0xc10525ae0e8e8c57, 0x9e734a7217023270, 0x07bc1983c83c355d,
+	 0x5ddcd4387c2bde7d, 0x2937ecd43c5e84f1, 0x336cf39fc8a4c209, 0x5702709e2c9a188d,
+	 0x4efdac04b5ed4b45, 0xbaac6a27af45e983, 0x2e568e32a1393da2, 0x6328cb7ec57e4bba,
+	 0x7ed3d1fb27cb6e74, 0x5afa812610388573, 0xa32aeedeba6e8c13, 0x817d5e86abcc1ec4,
+	 0x1c89f92da9b99c67, 0xc60c8c4d39fda91d, 0x4e8586080ae811c1, 0xad13a437c43052bb,
+	 0x85a854a5c263e3a9, 0xb459f440ea0fa054, 0xccb358f9ee18ff7d, 0x06a1468cc17fde35,
+	 0x1ca211a752845d3c, 0xef7bfe58d6b8f5af, 0x37fc9cb7641c2598, 0xb499587bbf3e8bc7,
+	 0x31096bb553cede69, 0x898ca399de4d10c5, 0xd41229a2addfde3d, 0x2cd836a0851a1ed4,
+	 0x1573915c1327df6d, 0x276a3f84b20589b3, 0xa5aa6a8a51b3f6c7, 0x36178f81a042aac1,
+	 0x023f7dc5c2179fac, 0x3801786a52cec7c3, 0x62118706dfe7adac, 0x192ebebbeb88e568,
+	 0x0ee59ce335bccbc9, 0x638e7875b268590a, 0x624c6c07813259be, 0xa0cf56ceb54e2416,
+	 0x3835721102d329a3, 0x103f4dbad86e4e2b, 0x593ca6868b4257b9, 0xae403029182c453e,
+	 0x6ed8b1f01a6de3aa, 0x8f594510dc1386f0, 0x67e14038c9f4b88c, 0x154807e52a04bae4,
+	 0x1e6582879b77a716, 0xcf56a1abb833fa84, 0x323d7923669277c4, 0x671740258e8e479d,
+	 0x3a2c886f2396f1ef, 0xbab17b9e67f35c9d, 0x814780f3649b4bce, 0x2d207cbe08562a0a,
+	 0xa826449a6249787a, 0x8584495d306fa35c, 0x805874346d02168d, 0x3c996796cc580488,
+	 0x02e29397b82da555, 0xf450c3d88b7a2669, 0x3535a5723181ddd2, 0x95fddd356a688f48,
+	 0xcc79f654f39af352, 0xbc00672d3e3e3d82, 0xecf604e8a72010c3, 0x619ab9517804438b,
+	 0xc44257582015c740, 0xcfca9730709c8550, 0x5f4ae693aafa80c0, 0x07ac0dae479b1ae3,
+	 0xf6bd0d4175addeb3, 0xe0676e33a0c968a0, 0xe958887b78b9c082, 0x05f16007239fe75b,
+	 0xfefd738dc5fbb9b5, 0x3ebe44f36d141a88, 0x83e761b2199fc232, 0xaf4299c9a755dc3e,
+	 0x17f248911179597c, 0xbde42e45f2fe82fd, 0x3a439c7b5c5c5af2, 0x7e56e9a626b8c41b,
+	 0xc8d4d83607694f5f, 0x98e3224de2b523e3, 0x997386812e6d391b, 0x6345f90f22bc8092,
+	 0xd6cf82ff0b89eaea, 0x347221c3ba99f8c2, 0xb4aeef2d0a30b1ca, 0x1ef99c935bae2720,
+	 0xf006d380f43f0950, 0x9e38bc2c241e10d2, 0x9a5bf02b74ad6d68, 0x29ce3e22c757dc06,
+	 0x98c80ff211d61768, 0x2ea22f30126b77c7, 0xd264b3b1749f4527, 0x72ddd606aaa99c9e,
+	 0xe8f7c51434e4eb17, 0x19731bd5e7944887, 0xa9846965ea56a961, 0x2e76856da22d55f0,
+	 0x0df7b43babbdf13f, 0xb523719039a6eaa0, 0x156711de487a1b80, 0xa2bb327a4cf06066,
+	 0x1336f1d8fef45c8f, 0xd69d102caad70b2a, 0x35f143b6fcfae71e, 0x770fc42090f58aad,
+	 0x6b9c4c479e5bc45f, 0xcaf5b8e1b32e5f0d, 0xbe3340d5f962ccea, 0x083c3e22207ea7ed,
+	 0x9b369fc579a31284, 0xe3dd64f539d497b0, 0xbc0f371911bc0912, 0x90fa4d67c85b4211,
+	 0x764ef0f7ce9d000f, 0x7e1af34422c0e6de, 0x1bc332577de413d6, 0x47c3a61db6885f2d,
+	 0xd28f11758397238b, 0xda41a2621141ecc2, 0x7b66b58b47ce9535, 0x40f9d7314b3f04d8,
+	 0x2127cee7972a6bce, 0xdd51fba2fb8d5b0b, 0x7e8fb2a3638b7567, 0xa1370c9a8d41f83f,
+	 0xeff1a1ceae35b665, 0x737f7abce1b0eb8c, 0xb7ce197c8620e301, 0x96eeb42a02bb447f,
+	 0xd55a5ac5f7005851, 0xd0b6fda7a9d73b93, 0x6dd8d42f0dad70f9, 0x51befedf3252bb64,
+	 0x541af7a1e2b03985, 0xf8b454403b040489, 0x84d41126812818e3, 0x3e74707df75e9651,
+	 0xf901ad213820acec, 0xc2256d5828365d0c, 0x2fba27f2302c2916, 0x4e7ab5eb1f1bcf17,
+	 0xaaf570b521e8f83f, 0xf729d11eb2eb548b, 0xec22c6011d25a8bb, 0x096aba2a160ee3cc,
+	 0xb802501913de57e1, 0x5d7eed4774df8292, 0x13813a5c79b9b981, 0xab269eda8f2550fb,
+	 0x5d391a2a05b838bb, 0x2a13ef4868026ed8, 0xad7486d101f6b38a, 0x0099aea0d6582291,
+	 0x5328333770122a31, 0x81918c7ce593706a, 0xda97132afcfba4e3, 0x5f3859ad90305c11,
+	 0xc840af46ff8e1524, 0x36e123aedac47005, 0xc55aff0714ae6af9, 0xa616c5d251e9225d,
+	 0x0464c3a7cb3f237c, 0x2de2a98866344200, 0x0028b55bf06dfd84, 0x6f50d73529ea4c82,
+	 0x3b6045935bfbb038, 0x909306c3a0912dfa, 0x9f658f5ca2159b8a, 0x60c2174d1b0cca2a,
+	 0x6f2ba53c39ec6d74, 0x14e1a435cd1ee2ef, 0x29128ce69589f25b, 0x1f8c2620dabf3b47,
+	 0xc1a41c44e67726f6, 0x5c623b833e7faf4f, 0xac64f18a036d5a6c, 0x7dea8fd4660ae5e4,
+	 0x86ed7a324c583f13, 0xd5b74ff589e11fbb, 0xd5e24976eab63389, 0x27ec19a2a3ab72cd,
+	 0x76fca3757d93012f, 0x2ffac6c958ff5728, 0x9364243c0f7c6907, 0x721432560dab4414,
+	 0x9a62987a7090d57c, 0x8e9cc3f18bf6fdfd, 0x48b4a1387317d3aa, 0x9a5ba41860447d36,
+	 0xe8829c64aacddf32, 0x9992bfc7216f905c, 0xa63844a2de3a4e77, 0x658cc5926a677577,
+	 0xef45cff53cb7de2f, 0x4c1241bf1bb74a60, 0x847523c3a3407989, 0x3ab8465542768633,
+	 0x5bd7dbc0d3d46dbb, 0x098c450428d60bd0, 0x6a275f6cfd7a0abb, 0x3c35b19dfa24a6f1,
+	 0xdd0508ad8027d915, 0xc040394336a43ed4, 0x38000c0d50071b4e, 0x1dfe2eeac3305821,
+	 0x87c00d92b89a9fee, 0x612ee49e094d4069, 0x8c61302da136f518, 0x48caaea04f33d076,
+	 0x2a73e35285aecb09, 0x17f3ceb72813875f, 0x7eff453f04cee854, 0x0905e62f536fe544,
+	 0x0e7908c43018b0f5, 0x6bd78d15306dc729, 0xa053a2375debe414, 0x40cde039a2c2207a,
+	 0xc3880d7456922aae, 0x346a82ea1e843b09, 0x34da65fffa8a4244, 0x1006b92471fc77e0,
+	 0x00db5cb589627190, 0x7819b5dca1436092, 0x639b4128a950d0e7, 0x19a4a15803bd3a76,
+	 0xdf7201479bfb0143, 0xaf674bf550094419, 0x08065f455c582c78, 0x10809fc163546c46,
+	 0x9a01090df21419b7, 0xfc78c41fec7dbe48, 0xa99cb3f636e971da, 0x2cc261035676c022,
+	 0x9dcaf53900db24a5, 0x5f752aeb8a8e2db5, 0xc4ac7f1ce297c627, 0x9298fadaba1574c2,
+	 0x4f0b95c0551fc71a, 0xe44f960870f3bb63, 0xc2a3aac69929331b, 0x94f95f4be45ec263,
+	 0x6f90fa275be37241, 0x6c93e7bf4fee9086, 0xadcd9663843e9b5c, 0x36dceeaf6f9657ac,
+	 0x838b52e4e8a17de4, 0xafe722521c609589, 0xaeb79603c13b1003, 0x1bbc313d7e7d426f,
+	 0xb4b61cac021ef541, 0x5a5feb6db3bc1233, 0xc4f22a3e760c4c97, 0x1dce09f1f3cf6054,
+	 0x2d237448d45f7415, 0x62f65e490aed07a3, 0x46d6104462b5df52, 0x787655a5d6c43c7a,
+	 0x24957ec66bd52550, 0x3a93e90b3a8380c0, 0x3dabe6f9a4a4d500, 0x24dbc53ba7862f6e,
+	 0x346580d5c7af6931, 0x8f1e99017bd0aaec, 0x391a866d22b8b0c3, 0x8fcf352bb04eb8ac,
+	 0x592604091708158e, 0x82f81b7c72f874db, 0x18204ee5e0b79c55, 0x5c9cb9dc34c27773,
+	 0x48e490991f3f6c68, 0x06c193dd1186f011, 0x7d2a57464e070d95, 0x3ddb354cf3716dda,
+	 0x512644cb22faca0c, 0xbdac6168c50c5351, 0x5cfbe25d60cbe8c3, 0x5e405b5221c3869c,
+	 0x403e2d5f63a4f440, 0xc5efb70291db316c, 0x33313bb753a72023, 0x17db763e6bb37498,
+	 0x66c2b47c8ec4198d, 0xaf16134a7ab26607, 0xb69b8d381401860e, 0x213c8cc884a5b404,
+	 0x1e5eb8909021304c, 0xec57c532859a4bad, 0x6aa74d1be6281741, 0x566faf5e32592cfa,
+	 0x2558f3380a4ce967, 0x3fb54e3d33833d50, 0x1c0c84a86670b3be, 0x77119a5b990abae7,
+	 0x2941fc3d5db204a1, 0xc0358c9508a7a8a9, 0x72e13f941cda1e37, 0x979a0fe1fd45d870,
+	 0xca2200f13c5aaf51, 0x63103d7287677ea1, 0x63f5f341d0c5d853, 0x9aa41df15fd4c015,
+	 0x16b683f51cd9ffae, 0xa10dc75e43d27456, 0x20bd631c22e6190b, 0x69c6ee4ae07fb58d,
+	 0x839e350ff4de40eb, 0xb396a2b008f34656, 0x17e5af22b8c15f24, 0x8294f37195919cd6,
+	 0x121ff68202a010eb, 0xdeb0c08e8a1b6192, 0xe0de7a40eadb9ab7, 0x624269e351044c56,
+	 0x6ab2472115763f4f, 0x939d1922c5a351fa, 0x7f133f4d9de40873, 0x18009f7c69b30a9f,
+	 0x332b0f75e8821077, 0x419f4239e3ea13ed, 0x42b5d792a2a10339, 0x0287ea204db23ae0,
+	 0x637f93f4c3acb0cb, 0xed45cb69a94c87d3, 0xce819ccc77104099, 0x1b4a32839d8c8c40,
+	 0xd2a0abc7c1bd46c8, 0x407942dbeb290f95, 0x28338fb9a9038e49, 0x76672ee7427e064c,
+	 0xece9455841a9c38a, 0xc5896f291a06afe9, 0xa4a0e6effa425ccf, 0x534da5342229d724,
+	 0xd524e82dc680f4e8, 0x57c8df345f340352, 0xa9b860352e5d3f69, 0x64bbeabaf7abb0a0,
+	 0x0203c5500a0d9da5, 0x2a509ebab17af89a, 0x1f7b9513ddd5c18a, 0x37af598bc424ef8b,
+	 0xd6b7695bf0c39818, 0x4857107ee07a2120, 0x1d97305dd6332c89, 0x3f7b95258034334a,
+	 0x3338e098779a75c4, 0x3d52a764710893ca, 0xe3d61b10d982123e, 0x1fd4953f172ea3d0,
+	 0x6678c0a3d72bf2a2, 0xffa37ffbd81395ac, 0xaeba0029caf31e7a, 0x91734b9487447f7d,
+	 0x8946e7eec3a2f4a2, 0x8146d730bf76b77a, 0xeb9b148ff010092f, 0x178a739b53791ceb,
+	 0xbfa37125baca2fa0, 0x723646955b8a3ac8, 0xa21aca4b8beeec3f, 0x0b60a1338edf45d8,
+	 0x71689216e74643b5, 0x43de8de1318fff03, 0xa8159f518ffc2141, 0x9ac2908eed327b76,
+	 0xcc005f3134c1e598, 0x761560adc7209e2e, 0xc58668d2219b913c, 0x669e097125eb784a,
+	 0x9249535c5e052386, 0x6ba0e0ed61d2c092, 0x18901d2119d496ed, 0x0f60cc762da35cb7,
+	 0x1c0ab05607da83df, 0x1538c56b0835859b, 0x6c31d11cdf3f277e, 0x0b8ad3173a18cd75,
+	 0xa87f52d41581fa89, 0x4eda462974c3d642, 0xed7b31e60bf2efa3, 0x02a31196a66c280a,
+	 0x108409647b9a53cc, 0x4d58a73bbf1780f4, 0xa3326285e691e607, 0x9a2349a285d21cdb,
+	 0x8a0713b7983ed89a, 0xbf61065639c88022, 0xd60f8533b8917797, 0x62b8c48ae4e778ac,
+	 0x20e1f92905cd6fc6, 0xacbb34f9150c826c, 0xc44b219bbc45fd68, 0x0390c378706b1707,
+	 0xd3982381de72ff75, 0x3904d74720b29868, 0x087eca6301ed58dd, 0x0370aa5b253153cd,
+	 0xa2ff1d992a296feb, 0x5c71eae84daa3dca, 0x4f8227b45b22cd3d, 0x82b8860020db71fb,
+	 0x558cd1e034fb8b2f, 0xb90b1c2fc7977a82, 0xa3ef0771c3e3631f, 0x13cd3878070ae44b,
+	 0x158e7f97fdf5799e, 0x056a391fbdf06418, 0x6ca38d469e4b2555, 0x60db8a51c41c7632,
+	 0x256244f3b53e1d5a, 0x22868adc7f988d91, 0xe884075f9ff89565, 0x6674f99a8c3f4fe1,
+	 0xe9b94c4cb6132e80, 0xe73036c27d780a1b, 0x7a62ed3524ec9768, 0x1f5003a3d42fcc9f,
+	 0x0e934185822a1675, 0x23d661d836b2baaa, 0x50f8c22e02e87407, 0x11d0029fdfe54a5f,
+	 0x9833296e7a876837, 0x8367664c93c497a5, 0x247c02db2d37c8fb, 0x27ca5dfc2c0b5465,
+	 0xd649f051d275a403, 0x4152964511ae9ad2, 0x5dd54a87388c2b35, 0x4832d2d9e7d1eb59,
+	 0x0f5b518e14293201, 0xae97c367ead4c6b4, 0x51ca9c644b1daf89, 0x9b52b82fbe3a7803,
+	 0x5b6a646ba6ec80e9, 0xdd2803c69319f3ca, 0xf22f671cc2d7259a, 0x2661a27ba8b4d95a,
+	 0xba11fcdd7ef7e7ac, 0x10a999eb9e4e60be, 0x93aefcabecd4b33f, 0x5c14deb9fa05749b,
+	 0x3739707783f581a4, 0xc11ccd2282cf20d5, 0xff9afe9927fbb022, 0x804c40acaacaa918,
+	 0x43f38ef644ebdf94, 0xf4483c6842dbd94b, 0x32a421fed43b416e, 0x9cef4757ab56910b,
+	 0x3dc1ebc59fb4c4bd, 0xfa76a10c4e8cd97e, 0x30ec34042a35062c, 0x85183c58274c80d8,
+	 0x757fd645749dee9e, 0xfc3f4b08374fa5cc, 0x95c9d8add21c7c24, 0x7abdd882dedca581,
+	 0x838f2959b6340f3d, 0xfb15598ef067dc7e, 0x2cda09f61d5f2c66, 0x885499dc08b78e81,
+	 0xa9771643f404cfa8, 0x86cd7601b9136fe9, 0xec4cfa943bf8a74c, 0x1dacaffcf20027b9,
+	 0x5d1410bbd4d90b0d, 0xadf1536f830533fa, 0x3f8d9d83fb067f8d, 0x889a41bf66f03ee7,
+	 0x230b333ed1e7b808, 0xa1ce81a26faa707e, 0xaac51f26e30e5188, 0xa74482241d65dada,
+	 0x736c7c2bf3650e66, 0x6cf210717778fc86, 0x843ba0bb1777f779, 0xae5e58237d430cdb,
+	 0xa566731c72007acc, 0x1c134bf6c3186faa, 0xd181c26bcb5128ab, 0x206b7befdf7721f6,
+	 0x7b4e13c36d475df7, 0x36bf8bc34638dae8, 0xe47683cd192a4a13, 0x09dc847101486721,
+	 0xad1d37c1bc7d114e, 0x265f318f885dca52, 0xdb003401ded864e4, 0x4893fb26780dc50d,
+	 0xe47963ad20d50cf5, 0xaffd94e6a3687ff5, 0x3f037923d768a2a4, 0x13199494bce3af9e,
+	 0xfcac4d96170ab51d, 0x4a2bb2aec4701ce9, 0xf7cd9a2ae7e1b2e7, 0x375f32839fcbdb3c,
+	 0x0786e762f8ab21bd, 0xcab3c88140222036, 0x2b76b212ba28ff83, 0x04b0ae5410788eea,
+	 0x47d015f86f0d9767, 0x46d9f66397acc160, 0xae2b59f3923df2c7, 0x241fea63faa57452,
+	 0x90e22b82092e0375, 0x1888d0b3ce92d0b9, 0xd38d17a504ed640b, 0x41b74a47bc6fdeb2,
+	 0x99bc5be37e3c125c, 0xd589fa13bff64869, 0x97599b310d8f3179, 0xa2861a15ce0ec693,
+	 0xef8c8bc55143af11, 0x49df3cf348779153, 0x1e4f367881d198d5, 0xa6ab1b653c1c3e20,
+	 0xace135877ac166c2, 0x1d6cffff1509ce1c, 0x901b94d050b621ee, 0x8047f1a387e2286d,
+	 0x8b4edf754b5b9876, 0x1f6e63f1be964aab, 0x174413361fb3b8df, 0x92a6feb561f58739,
+	 0xbf661c42a1edc25d, 0xa763aaafeb20b335, 0x945ffd53f2b250bf, 0x613d8a047f39d201,
+	 0x6ead60b950ef30a3, 0x24800843625dafda, 0x7e028e5590a7381f, 0x9365f2c11e59ee1f,
+	 0xaa2dc491291c93e8, 0xf34e206496a0dfce, 0xd7dd921d98949dbf, 0x4294198e05a83af0,
+	 0xf2fb4feca1f48b78, 0xfd134ec64031dabf, 0xa4800804bd1cfe73, 0x712296155f725242,
+	 0x984d868cba9beb55, 0xe95d0d2415204939, 0xe0eeea4393501203, 0x755182f3f74f8010,
+	 0xf642ba9653aabcd9, 0xa250b5ca5f10c4b3, 0x5985bbbd8fc65f51, 0x206918f531a88dbe,
+	 0xfb1a35429c2c66e4, 0x543ffc8f3ff60865, 0xea7190eadc65f105, 0x30b15f0df852f600,
+	 0xa392db4af0ffa7d3, 0x8e91a9203f19e34a, 0xfd6dc324ffb1b4c0, 0x3f31573467815faa,
+	 0xaae1fb097621a097, 0x05822b2241212fde, 0x07bc098df6803ae0, 0x56d0d54ff92794c1,
+	 0x5107686eef49199b, 0x91ba81b458753c9c, 0x373628af415b6954, 0x38560b6e6d562d76,
+	 0x348534670cfc6089, 0x008eab49a32ced8a, 0x9123c62e4e505a1d, 0x5fe2b60dc558556f,
+	 0xe63dbea5b28dcd78, 0x69165e94fe02d899, 0x75dc78023ac2ad65, 0x2fe032f3ed4d7269,
+	 0x7e8c9ad221f978b9, 0x0cf75bacfd0bbe19, 0xa47db0ae7048c5d9, 0x8bc8a7c84c3226b2,
+	 0x0f7a64c317316eaa, 0xaa53d775e2c59bd6, 0x585f389e77a64844, 0x9bdd23ce293a00c4,
+	 0xbc257a59bffceb9d, 0x7881bf6861ec5862, 0x22bb8df2a8457732, 0xa001d90b4352c3f4,
+	 0x9397643d764f9229, 0x486b05ec81162408, 0x5ec88d496db2cabb, 0xb5aaccc66bd181b0,
+	 0xf877d191938c0e89, 0x88c5fbb524cd0619, 0xca8eed6eaca4686e, 0xb2b725f4713dc421,
+	 0x5a64a1085aa51535, 0x94e232cc975ab73a, 0xd3dbbd636b8a26fa, 0x72bd0bdd4a6e1cce,
+	 0x3e67940ceaebf1fd, 0xa498020f3e529f8a, 0xc9fc9b94ff288dd7, 0x0dbbd4199e1e5089,
+	 0x30488284e57d02ec, 0xae83e0de765b5814, 0xf2a2543576114e0e, 0x6de38c21b16c5a47,
+	 0x222b2d4c79fa8eed, 0xa394d13431aa1b05, 0x9f5b4d6185784eb5, 0x52fc5c78b9fb95d9,
+	 0x22712732097e560a, 0x6ecd800890c38019, 0x9a3b37d9264a44f4, 0x0b8fcbe4fa8723ff,
+	 0x9eeb8d4ca1b384e0, 0x861632bf3f39c1d0, 0xb36bf98f1c8d31c0, 0x265009a73af01985,
+	 0xdcca6171738a7c6b, 0xc3ba971373e2145d, 0xc22e4f6128816e15, 0x18ccad98f2d927a1,
+	 0x2681c80c154bb3f2, 0xf3e3a32c81352b6f, 0x596c7f3778e5154a, 0x630693641c90c231,
+	 0xf97719a8ec4e3290, 0x0abd7319f0358a2b, 0x1ffe35a0e1ab8a50, 0x2ffe5c74eca24545,
+	 0xdfdf7c034ab08abe, 0xdf10f88302addf9a, 0x1b0988d57e69e293, 0x13d0420ba61970c4,
+	 0xe5627f980c105215, 0x5ab2965fa8090285, 0x42fff741b9743679, 0x20ee2b100b68fea9,
+	 0xb8fea02fbd8a22d4, 0xbbb3706b3955e79c, 0x2f8929b21a5fa1f9, 0x966c4b4b5c013514,
+	 0x1f4e172ea178478b, 0x7a248eed13dc9933, 0x258233bace1a5fe1, 0x9a69ed3bde4eff5c,
+	 0x2e25b213693a74c1, 0x9ec08dc31529525d, 0x8b3e27c29fc78eb7, 0x0a72719817ccd706,
+	 0xf93f0d1797b10568, 0xba52c4fbff4fb6e1, 0xe1b31bb21f430972, 0x42c50af50f73ce59,
+	 0xb99f340b20c66adf, 0x476c7874201fe23b, 0x0beffc9dc1f6d9d9, 0x0b355da3c554543e,
+	 0x29877fac3cb0e506, 0xf35a230f63b2cf0e, 0x95ce51fd531c10f0, 0x1a50f4b616ad45e4,
+	 0x272ba1ec078676bd, 0x5ea628cbb5aceef0, 0x525984badae7a8f8, 0x3d30fd386c583071,
+	 0xac7d5fc92cbcac21, 0x37c533cb5d19624e, 0xe40f3dfb8a7e7aa9, 0x0dbdd4bb4eef305d,
+	 0xd3a65bd398534873, 0x0b10c63862316663, 0x65ea78b57b4c5bed, 0x9656ecc0d3ee5cdc,
+	 0xfda8641a49d5b4d5, 0x4fa7f9ac26a7e894, 0xc6f990033105c543, 0x8fc358558c301430,
+	 0x9be41c6f486ccbc4, 0x4cee13d3da97d83e, 0xfa8e2b9ca8e2f303, 0xafe0b2e4d8370b8a,
+	 0xaeb518e74f684f25, 0xcc8bd0746c2acec0, 0x271d42ffc3c5ee84, 0x6a2669c1c7521a78,
+	 0xfd4da59102a99148, 0x5c2d456abb631f60, 0xf1ad8ce8c181d92f, 0x8eb4763ae966bf81,
+	 0x9f3af9bb725f43f6, 0xef535ba83befc4c2, 0x709bcc61183246a5, 0x2a67d378547c340b,
+	 0xf736bedd6fa81620, 0x696d0eb1ab8d4458, 0x849d697c0e04e20b, 0x86dfaa7a32b23503,
+	 0xf453062bfbd17eee, 0x62da1b3f691aa6f1, 0x03a088c51c60751a, 0xa5782e99ec0eed32,
+	 0xd720b968052cca08, 0xfd9b62b8d6e929da, 0x0441037af126f17d, 0xb49c185fd0153f69,
+	 0x443b4700c0309a07, 0x7b63faf1e0f05888, 0x4ad23e1902b93314, 0xacf7fbdcc251e82f,
+	 0x039588564d6c3179, 0xbcc91ac87981feb2, 0x1fa56f587ded11af, 0x234d7752a84c9ddb,
+	 0xec5259372eaeb78c, 0xe0aa3af7566353bb, 0x497c97924f359964, 0x7e483899d45a48a6,
+	 0x139d6a8522e4926b, 0x42024db7532dc7f9, 0x1b59d5e79a0d45dd, 0x3203cc48f9c4f674,
+	 0xffef5f14d5a6d904, 0x800a035448f29c2a, 0x0ad280821d5b2f7d, 0x02126f2f69d31ab6,
+	 0x6e13415f7f1ae72c, 0x86b7377ea64c0c56, 0xa5d8d4ef1aba0c13, 0xab37bee456084e6a,
+	 0x81786fe1859b2c7c, 0xe8d2ad8a76c34166, 0x0e44abbde9734e88, 0x075cf0d15b864aca,
+	 0x2e32350e566212da, 0x054e1b39b4db6f80, 0x4efd37f4cfadcc07, 0x7d4e792dd43092f3,
+	 0xafbd51a06f3ff38f, 0xd3d12944f87d2202, 0x5db6ecd54ff39f4e, 0x983240b31bf39976,
+	 0x225cff283d06b709, 0x6308a62f5bcae877, 0x8eddb1f68456bef9, 0x9bc2bdcf184fe4f6,
+	 0xd8e6a5cb1f44a639, 0xb976e7b7667b3e80, 0x105a5f662382c6fe, 0x3096fd91246ff3fe,
+	 0xb0e9288944d8885e, 0x1e1cfc4e51d81ca2, 0x7f5c8c80679a69f5, 0x7e388e4a72e3a417,
+	 0x3167f5c02dcfe6a3, 0xc813544a0da37f34, 0x5e4716d6805b8995, 0x0e7b7db779e92cbc,
+	 0x9adee67e8aba0220, 0xf4f3bb1791ddf9ab, 0xbb191382d9c0caa6, 0x284621c2c0f9f481,
+	 0x40840fb62e72d0ea, 0xa81e1c39b6f0d6ce, 0xd69563214501a0e0, 0x39ef1dfcc4576c77,
+	 0xfe23695539a17c92, 0xc23a6e9ff2eda70d, 0x6620211dcd369c1d, 0x6f135755a5feaf64,
+	 0xa0e47db88e9b6799, 0xb4815905ea333d15, 0x0dd3e8b899f960ea, 0x34dc3cde392fa9bd,
+	 0x16b5147abe95f1fa, 0x3383a861288a7a3d, 0x0d678b398c9c18f1, 0x0009046f91b7c9f6,
+	 0xde37cbe98bda8767, 0xd6a785b343079b86, 0x04ccaeca09d461d9, 0x528a251261b3d69e,
+	 0xec27712134f1f1aa, 0xce7655bd4abdedde, 0x3f17cd08354c8498, 0x218423a6da16f38c,
+	 0x9805465154ef7914, 0x0b2881efa48508ad, 0x559768f2f9707e52, 0x0d72e13977eea265,
+	 0x59ec04554817a676, 0x37404f9ba43f6780, 0x7e43eec76acc3d28, 0x09e3a4fdfea34605,
+	 0x3896d5eaf7c2c240, 0x884b2c2ba54b0fad, 0xf296d7e7f1be1bc0, 0x2a7825dc456590c5,
+	 0xcd99d6bd3f247999, 0xfc03d321c622f839, 0xcf16e4f791b47520, 0x01b32bd0e5c4e27c,
+	 0x63e3196f82963301, 0xc388268ac899f95c, 0x469b0199ca347473, 0x554e47d72954b8f9,
+	 0x440ce534829fc9f5, 0xf3d8af0cadb5ec4f, 0x233add48d4c9d8b1, 0x3c7f2d7ff7832d3c,
+	 0x2f88760ecb4d53bd, 0xf9faf1ea6bc56782, 0xca246f7fcd074f98, 0x704d324cfe0153e5,
+	 0xbac1db6a434b953f, 0xf5fc8d132d636d4c, 0x114c9eba16591774, 0x38f39f45429eea00,
+	 0xd82da0649327b456, 0x5611ba97fd3d9e23, 0x40d4ab2da802d76e, 0x67c8e724b2382037,
+	 0x2af6bf5a1b80013f, 0x176cbdfed9007aa4, 0x94ccf1960e74dc25, 0x8efd4169f6f07817,
+	 0x98200b995e37e7a1, 0x6ffdc4c53ba121f7, 0x99a163196084a266, 0x559b740cec280f95,
+	 0x08e419f620d38a17, 0x430bb9cb844a542c, 0xcfb24f72b2181543, 0xb3883725c8546479,
+	 0x19187af8fc2712c6, 0x621457418a6a1261, 0x412a2cd5cf5bef6c, 0x01eb8e49fa8f1db0,
+	 0x43ea9882f5e316bf, 0x634961ff2ee21e2a, 0x3a66a917c54ff732, 0xb5a8ce6d1802085b,
+	 0x907aeddcc3df388b, 0x86344eb929fcdb28, 0x6295119ce7f3356b, 0x7bb07e66ff150459,
+	 0xf90a0556b689b41a, 0x83247167beea9ac7, 0x83c87efb89be3f4f, 0x8eeac3d3cd72c7da,
+	 0x7bdd4968cd52ba09, 0x382e958235100162, 0x407288d41793e4a1, 0x6eb5cc758454fb9c,
+	 0xb432e23f0b5583f1, 0xe00d911c685c9013, 0x7baa7265fd30bad0, 0x31708c794d32b91e,
+	 0x80a2de566456f77e, 0xc16e37d19bd44dc2, 0x83ccd43391b2f616, 0x4ad42a994d1d354a,
+	 0xa77d7728ccbb61f4, 0xc41aacbce5c0ede4, 0xee1b50fca3ef88ad, 0x8eab97d437998f2e,
+	 0x67a613c708f070e2, 0xe60097b2b8d0448a, 0x1428f312e93f59dc, 0xa25cf665715ec72f,
+	 0xcf369301ef02f678, 0x7b86972c62c1cbc5, 0x2effc5d02027b4fb, 0x4f98b82640590526,
+	 0x71f97da19cf9c28e, 0xccf378b2fdacda08, 0xf6249d672c00ba5f, 0x84c50ccd8cc1e5d5,
+	 0x1146f228cb0dd4d9, 0x8b5fc6b5dccde78b, 0x1e2840f8a8ecdf79, 0x69a6205132513d82,
+	 0x9f720cfabe5f9afa, 0xfc274d4f14095c68, 0xeb9fe0daf9a795c4, 0x4abc7511e448bb83,
+	 0xa9cb896e731a19be, 0xcc168deab5c75cf1, 0xa3af0db395a67ca4, 0x169239253bec9813,
+	 0x54ad00364de23ae8, 0xf373832f779bc36c, 0x1599f6e52eda4b77, 0x0c07e03588ce0223,
+	 0x034e45c7e165cbc7, 0xe72a458937b6b469, 0xff4387c22be2eb6a, 0x8791b31328109ed4,
+	 0xf5853fff809854fb, 0xcdd6f7d69d2663f3, 0x3288b6772e529708, 0x488f2fa1f909cba2,
+	 0x72ba941944e5fc8f, 0x6e9ccdd85d082568, 0xca48d3f8ca0fd563, 0x132f288da4ea0a65,
+	 0xe78f367ee8cf8cee, 0xb035361dd51a7f08, 0x0f46951e6ce3c5a5, 0xb3d78462634af592,
+	 0x1ceffeffde1ed07f, 0x9b388e5ea68688ab, 0x4ce147e97ba4cf4d, 0x2f3d816a0bdb4c14,
+	 0xb5e033c6a756783f, 0x009684fc6b5f7a5f, 0x0342b97c4b8e3d21, 0xaf7fa444f891b1a1,
+	 0x01d5468e0c303676, 0xe7aa11759e4ce9e5, 0x8bed258b1615ce32, 0x3b84d803eb9e32c6,
+	 0xf5ca802f392b3fcf, 0x0c327adfc6bc6549, 0x1943cc88a7752b04, 0x010f6765586ba110,
+	 0x6698413a4e2f3b80, 0x4fcebc6bd174c162, 0x6b95acda8d6fcc22, 0x1369b3e210a5b251,
+	 0xbd734bf1f6db208d, 0x86da02555ba86de1, 0xcf15b1cb1352856b, 0x0c775296d856bb23,
+	 0x481c68a6df9144bf, 0x686558441dd2b856, 0x927e9ab26b49f40c, 0x0d5c8e27d4f38394,
+	 0xb1e38ae787445b6f, 0x028d9628a4024866, 0x4be1d63d8cb0938f, 0x6a9e60ea99c579f9,
+	},
+	{
+	 0xe10d16c5ae7b0609, 0x14a9316f6a67e0c6, 0x373a8faad9c440d4, 0x19d156630f898d38,
+	 0x7cc6c0b11923b73c, 0xe1affffe47af3ed4, 0xaf9aa70cff7561b3, 0x5b5e50329c2b2b7b,
+	 0x1bcbe81354e3df60, 0xcba0183b5aaf864b, 0xbbcfd73e97e664df, 0x6004f3be14ceecc3,
+	 0x34c4dfc6205a83b4, 0x86de6da435add220, 0x6d33a23588a82994, 0x8c7988a654462d00,
+	 0xe8460e93ae7551d7, 0xc9da2552b8eeaa82, 0x7106c284b0b93f0d, 0x68d5a4764af2d8c4,
+	 0x4eebd17e61e9a127, 0xe3e7fddac5c24d0c, 0xe8bd39ba9d81a76c, 0x6dd53a2c2e489a06,
+	 0x0d87655fef5a7aef, 0x47ad389f6e4d4344, 0xb58cd683e9cfceb0, 0x9ff68a248adc4ac7,
+	 0xf1c648445e8c2807, 0x83d11fe630d01d64, 0xcc919d7e2c435c64, 0x5c057dcec9303cf4,
+	 0xd3001218be6361aa, 0x963cd9acf28bc611, 0xe6693f581f0b0f34, 0x834ecb64a1f8c9e4,
+	 0x08ea39e3c720316e, 0x30459fe6d03ef369, 0x99784f7037a9149c, 0x63bfde2d69771641,
+	 0xe7db6db8d3978dce, 0x172a5397ca5a1742, 0x8217b1b9d811139c, 0x6cef0a3fde1c37d8,
+	 0x34f98e17ddc28019, 0x46cce851cdb3d257, 0xf4826556d5068fc6, 0x24b5b633b5b9c452,
+	 0x00fbc867233a3b71, 0xb7d0825ceb909a3a, 0xc778daf11174c0a0, 0x9c6b583f46e6f19e,
+	 0xa566662012f71672, 0x3896a9a66e2cf57b, 0x4086c64aab0cd080, 0xac87c01740450bcf,
+	 0xd6e5f2b349f4bbb8, 0xff00a6e050e6a8dd, 0xc04a499fb5525e53, 0x3555d1013acb9062,
+	 0xc41f0e0cdf40d1d4, 0x0ab2708522ddaa73, 0x12b61752421bd818, 0x52178bbd438aea46,
+	 0x14ff21080bf264d4, 0x201ca4c0aebc0116, 0x40824fc1180e7ab9, 0xb049951fe1d4db2a,
+	 0x548e647ae6f21e2a, 0x7cde3bb3706a85b3, 0x5355f210c8b16fdc, 0x8c0c4cf98acf200a,
+	 0x48f8d14873ad09e1, 0xe4c513c902c54b65, 0x25916431c9b25899, 0x43ce1e12b3268444,
+	 0xf49acb15c5524455, 0xc452c2c3b3c668bc, 0x84e6807e7ccae711, 0xabd3b488d677c601,
+	 0x882c431f96ccab63, 0xdf71bdea5b9ee8b0, 0xae63977eae140361, 0x898feeabdaed2860,
+	 0x300876a73d4af94d, 0xd8bb04e6cc868691, 0x85f8fb57e338ce25, 0x178eafe3ab8b0a8e,
+	 0xa8d102fa691def38, 0x7a4817d67dc36d0e, 0x5652b40637ece2bc, 0x815f653d5e003f8b,
+	 0x4b36471fbacf9396, 0xfb0e8629b11ed1fd, 0x5b150c44fa3e1032, 0x4ea6f63f20079478,
+	 0xeda9312517991521, 0xaca8fb376839d9c1, 0x0a11741d79bf4429, 0x1db94e0a7bf55519,
+	 0x27dde3cea3987be5, 0x17172e2a0f4e17ff, 0xb85f741f3c5b4009, 0x1cd0cbf3490a6340,
+	 0x28cc9be7fc3aced7, 0x6b133306992f9e67, 0xccfd071ac9867a0b, 0x98156a0e759e4afe,
+	 0x7fec36436c3fcbb7, 0xde741e7fdccaa52a, 0x6e9660f180ea746f, 0x1b6b629a83485961,
+	 0x623925f8b67953f1, 0xb9fb19c2b8f38be3, 0xb7f1c792379398c5, 0xaeb2db33d884182d,
+	 0xa413778d023896cf, 0x4112b19fa053e198, 0xee29cb13d2129168, 0x5e107406e9015ea0,
+	 0xc8b00c2be1c23f04, 0x42c5437b7d432c80, 0x45298e4b43e92fe3, 0x574ce49569d893c5,
+	 0x41810e451aaa4486, 0x6f772b4af883d8dd, 0x1e6758ba0bd926d5, 0x6c8b1e567a8c5bad,
+	 0x65d7d49b4c4a1d1f, 0x5eb5d8ade67a7c5a, 0x0231f91003242460, 0x5567a0d7816dff97,
+	 0x4957fbc70a68f5db, 0xe167eff86bf108f0, 0xc391e6042e58fbe0, 0x2c9bebb69e87d4fd,
+	 0xe4651d5c3fb782fc, 0xfa382a7a2c89096e, 0x4913820db41cdc1c, 0x80e060b7ebbbeb5f,
+	 0xea082da7b26aa9e2, 0xd82281cc195b095b, 0x021775b56bec146c, 0x4afc96e756619cac,
+	 0xda3c71f55cd0644a, 0xdd7764694ac06a1e, 0x107b388eb8f1ec8d, 0x942730042c80c253,
+	 0x03ae36239057b1ce, 0x9d4e94a6025c6a08, 0x939e5a34476b4e9f, 0x8608e3251952c970,
+	 0x39e99147e74f4181, 0x4300fc19c3e7b437, 0xd5661a232ac8e1de, 0x6741750d6ae418fd,
+	 0x15989eba5b7a58fe, 0x1e86a57d607f14da, 0x6e7493c5f362543c, 0x33508819e74875a1,
+	 0x19d65f14ee5e357d, 0xf940dca2f4bd2651, 0x183c41a11cee7c3d, 0x68d6934d29be94f9,
+	 0x0f4060ca8d31314f, 0x677675c7d41754b3, 0x480888bbc636ba0c, 0xacc98bf649bd8306,
+	 0x16ba9187015e850b, 0x2726ce9799555112, 0x612cbf88c9280338, 0x7dc3dca017cf9354,
+	 0xc25365fada45cf3e, 0x0a63b7f8bef7cb1e, 0xc633205dd9cc42e4, 0x9a3874dd9eecf035,
+	 0x61ef21b50360de94, 0x3f84de9afa86aa07, 0x94a0f50771be2b6c, 0x9f3200e3047abec2,
+	 0x299d15a2f417004d, 0x69e802b6c10fb776, 0x0785940de37b05ef, 0x7cc1e8567a094634,
+	 0x81df79c6da423ba7, 0x2f67d3a7814c4e12, 0xa3226873bfbdd88e, 0x7e19d7a7139c5246,
+	 0xeb683bc01534df4d, 0x9e2c496d0ed31245, 0x95699e616ef9b738, 0x83c303ef1b6b9f86,
+	 0x41ecfbf9c8bf90db, 0xbd259363b699b5cc, 0x7b930cbb42b14c7d, 0x4d0ec3b37eb69017,
+	 0x9313881d8b66f68f, 0x9191a2f8212ce821, 0xf244c7293ef10583, 0x47b8bf0fc4aee72f,
+	 0x56de9cab4641dd6d, 0xac196fd08562df67, 0x399d79066f5585a4, 0x0ed52921c2709020,
+	 0x60ee00fb2a7ad2bd, 0xa6fa4f4daed0bf33, 0x944538b14ba8db89, 0xaaa68961e8dd41f8,
+	 0x6a77d6a59f0d4cde, 0xdc6dc0a828bb2e0b, 0x8c8cd096a19c187c, 0x29ff1c29924b6ea2,
+	 0xfa735d22a512e3c3, 0x881975d5755eb531, 0xa2d0f0d2ee690220, 0x68c4138f33c68c01,
+	 0x6afbdd7ff8ebb841, 0x3319ea78965d1822, 0xb63ec167024491b7, 0x6904b5628d811553,
+	 0xd3272f42937b1206, 0x64342a4a4fa6c9c0, 0x98a41e876b8b5d88, 0x7bec6abb511ba8c0,
+	 0xc771075198f8747e, 0x823bd451e02b672d, 0xf94b5e9e18a7a3e4, 0x75a90aea6219b644,
+	 0x8406b1f5b241e68d, 0x43b4bc414d47da58, 0xd5c965ddcd057c8e, 0x3104c50ea66fd0f6,
+	 0x4d7d9f1b48d10202, 0x5c2f1dadbeec182c, 0xc799612be6ee3cf9, 0x566ba262f69d2bd6,
+	 0xb6b0f8d65ba4d163, 0x0e901cb904cfe3b5, 0x7e994a268db77b1f, 0x858e0e33c6fb3da3,
+	 0xa782cb884c4b2500, 0x6c20f169d9f225ae, 0x50ff92903273f188, 0x0118f2125c3b2a93,
+	 0x6d57d3104d587197, 0x143735591e64da2b, 0x356c12a27ec1d64f, 0xae8f63f5b3552083,
+	 0x5b5307cb0cea8a21, 0x239b00aabcd469b1, 0x218e631b4eb5fe97, 0x11d6d3d5a3ff0bb6,
+	 0x39448d621fc8c687, 0xecf7e8ff771e7261, 0x875a7d996dc74f11, 0x4467477c6069cdd2,
+	 0x17d4aed8c6e0746d, 0xb2bc9b3d30c70d93, 0xab56743483416836, 0x9c80fdc53397f0b7,
+	 0x8a73070579b80d3f, 0xe551ddf944d42913, 0x85b055ae0e34f32e, 0x494b72f92c3d3353,
+	 0xfd9b1e039e0d4cd0, 0xa8dcbfe707f4f042, 0x6e30afd22476f795, 0xae12d13f18350be7,
+	 0xf49172d90f543f11, 0x03d6091cde469d92, 0xe333f0e94d6c634e, 0x84ae4b1414bc661b,
+	 0x5113103fb61a691c, 0xebf7685c8186b310, 0x1c9933f6110a73c5, 0x533ff6564be05a34,
+	 0x5fd17d03a8a673c8, 0xa1856dbfb6dcb6c3, 0xc8b0f0b034696e6d, 0x93ab7cd5a062c254,
+	 0xf2eed05d366d0f8c, 0x9a31a754421f6b0b, 0x3771baca04a4ede4, 0x6badaeeecb5fedc0,
+	 0xbb3463e0fbb87753, 0xfa09f6a51ae3f300, 0xd08e2a01162e4188, 0x0096332265a76334,
+	 0x4f52d77f51fdf206, 0x9987144d4287b00f, 0xd9412f9a1d724a51, 0x0ce497e34fe80866,
+	 0xd747f1dd2e2d08c3, 0x7d4fe867f87b86d4, 0x8b7521ec67f4846b, 0xa8f62447eaf0d7a0,
+	 0x80097c5a86408ef5, 0x2b3cf90d29eeaaee, 0xebfc92e902d9e8b2, 0x1be87e32e088c12d,
+	 0x4ced0864ccffdc3e, 0xb23ef9c31d6773c4, 0x28148450dae30e51, 0x5fa8694a4471a5c7,
+	 0x083539d32f092697, 0x3c41052a868ad8e5, 0xe974c5b2d838fc9b, 0x8c57e95ee0e9a110,
+	 0xe8eb830c248bcbb4, 0x20758e2f541b02ae, 0x73a9e56afb310229, 0x830e2593a6c14cb3,
+	 0x98d4e9f991715997, 0xee6d66ee1dc91c7b, 0x907d3a35fce83255, 0x6772ce1a30d55ed1,
+	 0x285cc10b191f99b4, 0xc8d91decfdce34b8, 0x976cc9e7ae5f50bb, 0x176b73c4a903c395,
+	 0xe52583d274f38bdc, 0x49a91d1e8fe990ad, 0x3eadd919cb94fe00, 0x51b6bb312c64af64,
+	 0x48ca2c115dc0960f, 0xaafebe5764bb9f0e, 0xad3c88b7637d5f7c, 0x3a432dfe57bd7e04,
+	 0x5f82d8f965d8db18, 0x60954c67b2a10de7, 0xab8a2f1326c0f74d, 0x8c5c274790ac86c0,
+	 0x478cbc0abc637167, 0xfae727e108c62cfc, 0x1c407ef18e8c4cea, 0x530d07d6a874b418,
+	 0x10579b672d5a68f8, 0x4dd7bcef450bf932, 0xfa0b72a2cc267720, 0x84d467f1470d9ecd,
+	 0x4fe6daa29446510d, 0x64ce5942c2669355, 0x1e2910539454dfbe, 0x190d60ca6c0f0561,
+	 0x9f087cd4986cf9a4, 0xf6115108c2f2877e, 0x9b77b0ce4a446c42, 0x56da4d8ceaeb1876,
+	 0x72530e707cecff53, 0xfabc1fd3a5a2b6a2, 0xea90c0486e8b2eb0, 0x85259e15e83c2356,
+	 0x60f856e7bd45fb59, 0xbdcc1b56b8e36eb6, 0xa3194945cdcfbe22, 0x0620e028c91be881,
+	 0xd139b8ef4947b59e, 0x2af54bc65c8a41a3, 0xbb9a51d3b384a416, 0x8a15db534f692152,
+	 0x6b2b86f602e4db02, 0x873218dd25786bd9, 0xf3a9a3fc97714cc2, 0x3236b2fb1a498a96,
+	 0xb78007cdb188d411, 0xd9ddd944315b7a8c, 0x38c2d36b71b6d564, 0xa52d9e4819fb0cbc,
+	 0x983d362cdf1815f8, 0xf126363e2802e752, 0x67daaf688bd9465d, 0x42b54e1eaf1ce83f,
+	 0xfef87f5527ce0903, 0xf7212840cd24c95f, 0x8da9ba512e5348da, 0xa8aa312b2d813982,
+	 0xe21dfbed9618ce05, 0xbfbbddff8af622bd, 0x532428c504522eda, 0x57aa596852b906ae,
+	 0x447a8b065cef6649, 0x3137cc1b71a6afb3, 0x6381aa25cac45a87, 0x0c7c506b5ea542d4,
+	 0xb2de4fee178b0800, 0xe34ec83f0365483f, 0xc89f7160dfdd14a3, 0x093255a0a78487eb,
+	 0xe1449794299b719f, 0xa47206f5439c74c6, 0x57f23666b277518b, 0x442bbdae62ec4380,
+	 0x2ccf1a36d72415fc, 0x8351bd6c858e3f6d, 0xd0e0e7861b98f9c7, 0x883ea5ac84924998,
+	 0xb39348c6ed2d5c53, 0x1f64d2fb8ab1ccea, 0xb6df574cfa30e17e, 0x9b7d69d2adceca25,
+	 0x8734b6de52944298, 0xb4ede32b0ded73ec, 0x64838f91210c4be8, 0x20d7e3c49ad0fce3,
+	 0x4040bbc3bc9c894a, 0x9889779ff1bfd571, 0xce8332a2275b18f4, 0x43dc10c5b7b953bc,
+	 0x78856885ad2ff059, 0xfa4af8778e45bdeb, 0x2f05e3b554ab5e3c, 0x649961643cc35709,
+	 0x19820e0fa439d53b, 0xaafe0a8afb8c0a57, 0x8bbf6f41c0e718a3, 0x82bd91acb90b4902,
+	 0xd9308cd54fd26413, 0xbbd941eb1ec2ce47, 0xa53aeae56142279b, 0xb2d901d25f9f40b1,
+	 0x61c608004a0fa754, 0x1707e4d5f89d9df1, 0x380643fb9d5f098f, 0x90c94f83932cfe75,
+	 0x345f00516765f8f7, 0xd129f2df81d6b5a8, 0xa346747cf23e1e66, 0xaa8c21c2ce7bd420,
+	 0x43b8d8e6f2b6bcc4, 0x071cdb1ec4e0c530, 0xf6f7461868fc3a75, 0x7cdd24c6609a3384,
+	 0x640e2c0c943b3530, 0x34dea7a783d4bf89, 0x4a9af784ed13acba, 0x7afd1f1ce1fa8969,
+	 0x1ed88469b7ca42e6, 0x5d268614af6336d0, 0xd91bff6114fbc0ee, 0x11f93573ffd200bd,
+	 0xa9184490a476b48c, 0x2cfd9749f644c398, 0x6a88ccc1490263f7, 0x94a4d86f3a7957c1,
+	 0x64b822dbca2c8a0e, 0xd0788412d13320d3, 0xff2d6680eae22fdc, 0x956542c3bc57723e,
+	 0xfec908f2aa648d60, 0xe72c0041d6c66cb2, 0x8b2a910ff5444f90, 0x9ba7e82541011f7e,
+	 0x94e94ecbb1d3d800, 0x94f982d6cc701085, 0x674baac9a5884a42, 0x5c9fee1dcf7e35a5,
+	 0x72dc1d7b5afdc14f, 0xe3a4fc23ab6a7b68, 0xac4af1f4a4617249, 0x1d09ecf1ba9afd64,
+	 0x9677cda57e2e87e3, 0x76506695ecc5ae8a, 0xdf70653bc1bf9c6e, 0x5ac2faa053c8a524,
+	 0xc0c7f3e13538db3d, 0x6a5e0122b555681c, 0xed6854842d546b9f, 0x691dca14f743dfba,
+	 0xf2bb623fa3cd4d4c, 0x29a2ffc87cd32c14, 0x107424f9dff0c4dc, 0x42884a426e9b5f5a,
+	 0x69a8650aa8d843e5, 0x8b192abdc6677dc1, 0xaa490632e3ab1dab, 0x86ab226cdbf89b66,
+	 0xc284fcb6502dbdbc, 0x9eba866e37c7f3c2, 0x3e2b7d992713f782, 0xaf538af08b47b229,
+	 0xc0c1bd9142240647, 0x2eb032c4e3bba904, 0x9309652543d46387, 0x0b8e37949c9c70dd,
+	 0x433bb9eae4827cec, 0xca2ebea0667d6044, 0x4bea30a702dff3cf, 0x1d08003a2183f440,
+	 0xdf95ddde3b36c602, 0x1769193f8a6f9f61, 0xc507e3a4252ce5be, 0x3567efa759d3e174,
+	 0x2691006d2351a721, 0x8dcd1f5162f8cd62, 0x00f6ca248a357d72, 0x59e8623d86c3d567,
+	 0x4e52327913e151bd, 0x3f6492919d21c830, 0xb2207432f51fe057, 0xa0100d47212e2f67,
+	 0x6cea28b2d7309462, 0xb498a1d8feedbc89, 0x1309903343bd7f0e, 0x419ef3a78396d4c1,
+	 0xd21350f427a96c6c, 0xfe07d81bc9d26a6a, 0x1a0a50039c8b9291, 0x611c1feb3e1b35d7,
+	 0xaa471a1bf4c06dfd, 0x4e3f16138f7a443c, 0x9e593211aa5ce6a0, 0x182479e24a2abd55,
+	 0x1ed9d46fefd8b87e, 0x99937cb8ce270740, 0x9d45fd5c1067fb03, 0x68bc6fc890949d25,
+	 0xb028a275ce399f47, 0xa0edf7398e1e8c84, 0xa0b99601c89be13e, 0x1176f5c3813ee6b1,
+	 0x18005478a8da7bf3, 0x6f6e82539c44af1a, 0xdd05460cdc62aac7, 0x409e84a057bc697f,
+	 0x1a27e7356b9d055d, 0xe110746a54afbe7c, 0x54383a77f03e0407, 0x9b53e19dcedae26f,
+	 0x4bc49d951e0370e7, 0xaaf3fc7aa08c033b, 0x58b09803a353b783, 0x324f9a95229bbbcc,
+	 0xf5b1e1b34e3e4940, 0xbf3707148fa0df08, 0x873f260cee26527d, 0x48537c414d7e8ed5,
+	 0x30816324e0b0c276, 0x670e9f59dab732a4, 0xdff515bd7155882f, 0x50a5dab54bfb1f0b,
+	 0x177f175787f69d33, 0x85edeb88da2594ef, 0x11df878a5214ef4b, 0x431c63149f5ca30e,
+	 0xf9015e92a092184e, 0xd6cb7f9c7487f583, 0xf0492ddc160a5e6d, 0xaa89a8e094502318,
+	 0x7bba24b7f0e91e75, 0x1ec26322d20cd5ef, 0x2c491913794be007, 0x9f65f761a318cb29,
+	 0xcec732099789be98, 0x8354cda3d06b7a92, 0x09f6d6bccf08e432, 0x09b88cb164ddc3cd,
+	 0x5822d20ca0c47285, 0x52f3c6a99f15a577, 0xac239f9d5264e711, 0x25aa08ea3310fcf1,
+	 0x469aa75fe56604af, 0xe944769c93752f9f, 0x71bc24933919de39, 0x395c7de2a1ea56b3,
+	 0xae35b5055a82a410, 0xdc241adf299c265c, 0xf9a4a3723d4d1dc3, 0x036c099596045a4c,
+	 0x5555d294ad3fe07f, 0x5f4919a203c62c72, 0x7c2b1cc6952786ef, 0x1a270f2624b1c96d,
+	 0xf7809d7b108142ab, 0xb8cea4a1d1d85f4c, 0x3d9659aecb3838db, 0x0417a5d7352b8e54,
+	 0xb8646fce1813a0da, 0xf0526371ef91322e, 0xfe4e4360014aacc4, 0x746d3a1f1cc23a26,
+	 0x10e15bfb2484e159, 0xf328a24e54817350, 0xe548facef73569c7, 0x778300d443b7c923,
+	 0x5375a45da864ae65, 0xfdf7a78b3a73c7fa, 0x14b4e0828a4d2f78, 0xac5bcf26bab70357,
+	 0x55fc8fa74c332083, 0x3627011c45ef777f, 0x059f6b1ddd5d38df, 0x6232be64fc5b2894,
+	 0xaf6e2b59a1f2f7b9, 0x1a54f95d9e4923dc, 0xae9d30e5db89e74c, 0x06e52099b1acf4f8,
+	 0xbce6521b8a673897, 0x43893a579a4b05c8, 0xa970154d63691af8, 0x34d3c3cf3b634255,
+	 0x3ff6985b29d5e94e, 0x6a939dcfa1016fbb, 0x1ba8b74f92deee27, 0x1d066f47f9f71807,
+	 0xc876a37422bf2deb, 0x693f84b490ba8cf7, 0xe225fa00c969b2af, 0x8495eb56dedb35b4,
+	 0xbdfd04058d2888de, 0x8cb3b200f3e5cabd, 0xcd955f9128988ce4, 0xa2b75a36b0ce2bc7,
+	 0x362d4fb7fcdffc66, 0xac2b154b179348d4, 0x037973f687473c3c, 0x7bbd1db366b3cfa6,
+	 0xf042f764f51a2cf0, 0xce1ab195d2fde2e7, 0x35dbbecd3efc6fb2, 0x5004d7440793b189,
+	 0x2cb79766393d65ef, 0x7632b4f8b6f7e0ea, 0x54136e106a9c6849, 0x2199391e58d4db27,
+	 0xb845a5e23b2d6baf, 0x9bcc1b883824c017, 0x75040a664f5145a5, 0x5c45eb2b6d582683,
+	 0x53e80925d621c66e, 0x00b65aa0574afd31, 0xde7b2f75ef9f5535, 0x1853c53e4271b2af,
+	 0x94e920d3eb4ffc4c, 0x5fdc843841dedc5b, 0x0fe0c6b62c626250, 0x080094862290ed35,
+	 0x7d35c5bed9dc39bb, 0x24eb4c82c47ebb92, 0xc1243e66971206ed, 0xa9f03133975eafd6,
+	 0xc91ccd6f13f0fd80, 0x884acf200e3bc821, 0xe2e1601350a69150, 0x729e8bba8f23070d,
+	 0xed3ec8510544fd85, 0xe57666669cce2c63, 0x390be113f562139c, 0x5c833678b728a3b7,
+	 0xa9e62bdf54c25dbf, 0x8669cf6cd05f6e4f, 0x0b2f0073dec80986, 0x2ab03dc47353e2cb,
+	 0x01124fbad5c1669e, 0x7047bb6d7e42046a, 0x2542a10648f2a9aa, 0x14572fd5e74291c4,
+	 0xaf2860326c1edcc6, 0x7d61cf02282cfcfb, 0xc7798c67245741a7, 0x9b34687b82de23ea,
+	 0xad2db231b678367c, 0x815679d57852450e, 0x22d1645fa68cd5ee, 0x686ace8afdf38766,
+	 0x577d730a392405c9, 0x587286c74d9b2dd9, 0x2a0c2afc6fe1a8a5, 0x26437083b1fadac4,
+	 0xe4b2c3562a14e86a, 0xc6d78ac4c98ac6e9, 0x4e5adc47639e33e1, 0x54bc91c79bd753de,
+	 0xa398d4bc015fe544, 0xd3ca9dd12b6ce540, 0x1b9db248e67a50dc, 0x364e000df60e424b,
+	 0xd40cb3a33cd15ffd, 0x706271296c71d7a3, 0x920b78151c3586cb, 0x7c4a2a69b163625c,
+	 0x5d3e3d9b9408d918, 0xbb08e99cde5f227b, 0xef0a94b7e8cf73ec, 0x18e7f35654196cfe,
+	 0x6b165e3494938698, 0xb960e2037643cf8b, 0x8cd43eefb98a1782, 0x49d2516ca2b853c7,
+	 0x31ccb517ae0cce68, 0x05f554b77f6da386, 0x45ca3bbd7e111086, 0x7b540487c2c88912,
+	 0xed0be3ae930e5fe2, 0x2363b4b2da619565, 0x1d119686435f1351, 0x758135df25a81105,
+	 0x15d2fd94b4b92c3f, 0xe9da2caa76bfc8aa, 0xb4858606125644b6, 0x63748aa894806652,
+	 0x083d76ca414ce131, 0x723686eb124a2a0b, 0x22e09ba56fc2d8b3, 0x4f80a237019ec477,
+	 0x48e77fd413ff6fde, 0xaa8ec9a86841b66b, 0xffa17d95592c1dc6, 0x76cf997a80c3de11,
+	 0xf8df3b4b2e07c322, 0xbce220ba31506989, 0x4a0742384c1031c8, 0x69db92fa5e42fc7f,
+	 0xd69891708575657a, 0xf8c16465086a98c3, 0xd23e4d0571761439, 0x115c02d748821b21,
+	 0xe21ef5f65a581976, 0xb776be2637a97b84, 0x99fdd65f55858586, 0x72552e29c507fb33,
+	 0xe3ef9462cbfa91ca, 0xd40a28c9956ee159, 0xf50e6b361ab1b02d, 0x458fa9196428d237,
+	 0x6968438f627abb49, 0x50e9ba23ff57e053, 0xb2b6fc8b17e0b6c7, 0xb0ac729d207314f1,
+	 0xa88a1d58179186e2, 0xf9da96385363f187, 0x429cc572895abf98, 0x82886ed005a482ed,
+	 0xf038bf57cc904dc6, 0x0df545fd714577d7, 0x918b33ce0532504a, 0x9e4e205593d7fda4,
+	 0xf670a2558c7df13d, 0xfbaec4e19e62736c, 0x542e2bca133667d7, 0x08d106118de2107e,
+	 0xb32dc8f20950df9b, 0xc93489587f4e87b8, 0x2b231e16208d2b47, 0x4f3e0f595ce9b279,
+	 0xef347e3cb0260ae6, 0xbd680047dbbca89a, 0xe5cf0c0d07b8cc87, 0x313571efa9e2dda9,
+	 0x40e23c37e43afbb4, 0x8351f762f630c58f, 0x8e94a04085f49077, 0x1b9a1333756a9cfe,
+	 0xfb303df87ae0b7c4, 0xc0b1578708c4e416, 0x2a8d7dde87ba02ee, 0x4735d5084b9d6e76,
+	 0x5057ac54afaeb030, 0x1baaa23dce15d0e0, 0x097ad0bd3477166f, 0x46925f1bab0d7133,
+	 0x88ad69ca0c25f29e, 0x0b3a6576c57a41e0, 0x23aa502eeda2434c, 0x31eaec9e3607bd2b,
+	 0x7168543125cea5c6, 0x959a6c2b82c9b864, 0x61d5e4462b2298fd, 0x5648734c5f82c158,
+	 0xd7cb0c60a3d49fcf, 0x735c5213e8beadd9, 0x0ef306a068c6d2dc, 0x7fe1eb887b331d62,
+	 0x6cce9c51f5bae304, 0x40b5f79883ed401f, 0xeac203651fffe19a, 0x7f24aba13a5902eb,
+	 0x1182966b52744e9d, 0x60e1c420ae5acfd5, 0x0d9c51e0f4fc4339, 0x3ebcc0ce9b6d6fe2,
+	 0xe95021327c0c8399, 0xe6de7c594ac3f6fc, 0xd9f378c6c0a6c690, 0x3abec374c8fe76c8,
+	 0x6ae1fb66d7b70e66, 0x7b1aa6fc7b9b9043, 0xbd2f9b271cc463c8, 0x7a36580199aca9ec,
+	 0xbefad51ec4de4fe4, 0x02e3fb0b4ca5ff21, 0xf6cd00b8e50a23bd, 0x7a1719bf071fc69f,
+	 0xf7ed39f59b01abeb, 0x07d89962a25d942f, 0x4f73a405300f0739, 0x47fbf96a00a09986,
+	 0x157eac0127076d92, 0xfd135ac8578f799b, 0x1eb0e1a61c385207, 0x03b105439260bc1d,
+	 0xbc034ccc4c92b58f, 0xb8e4f08ebb569ee9, 0x21493a992dbeb35b, 0x3c61f0c6117bdc1e,
+	 0x52857dc8a273dfed, 0x04c046cf511e38c4, 0x815fa98e3dc6a092, 0x9253cb4b56af2c5c,
+	 0xa74e2de4b6767f43, 0xf7e4076e8084ee77, 0xd350f268c0d7e9c2, 0x3b4bc564b4805680,
+	 0xfca43d6d450d7c80, 0x0a0e876e405ea778, 0x2034bd34d17568b1, 0x300aab3c641b3d24,
+	 0x48c1e8cad73a4af7, 0x01eab4cdea2ce3cd, 0x47421a75b9125d23, 0x6be89db60785d451,
+	 0xa18923dae4e4efbf, 0x2e981e2642de248b, 0x80d1991cc26edb78, 0x44ba1fb318ae115a,
+	 0x87187df9c435f650, 0xf69b1f58c9aed20f, 0xcd8c338c4b5daeb1, 0x580ac319f23f00d7,
+	 0xdb0cc7ecc027c935, 0x6509b4dfce0b22c3, 0xf5be0ac2d74e4a77, 0x42026211c4a6c355,
+	 0x3ae1384452f87db4, 0xf15bc93b79860e91, 0x9d292e309ed66a64, 0x2afd78f409440c64,
+	 0xfe00f69e617b5f07, 0x1b7f3d529955a20d, 0x1cbc5c1ba68cac2b, 0x13601eefc271295a,
+	 0xcf859cbec46b1877, 0x057aab600f1eb8c8, 0x186314061b584142, 0x751b8b5832057ef6,
+	 0x59fcf243317a7132, 0xf759004a07521aaf, 0xce28035c5187de6f, 0x34239d44742672af,
+	 0x36e2a64249e42d06, 0x5f890fe609d41d41, 0xc9357f43b9ca07a0, 0xb0d5c4de5ce087b0,
+	 0x0670162ba74a5c7a, 0x334f7d5503b456f7, 0x96676954e450f3c4, 0x0fa322499e6e9a53,
+	 0x6ac715f518e3b47c, 0xbac64442327d4382, 0x8b2f60ff6ac5bb1b, 0x99cff125d3c3a754,
+	 0x6cc7eaa6ebd77905, 0xdf56a1481112e495, 0x6b45e57229a4713a, 0x84eaf7cf2461340b,
+	 0x177db4d16995747b, 0xf5344306cab02289, 0x1c3848ec530d596e, 0x464106151b7b4401,
+	 0xe9f5ff5d3fdb7028, 0x0ca69c4338190447, 0x31a8f8c927c0871c, 0x2461e730ce5fe4de,
+	 0xfea105b865a49cdb, 0xd38b8b8611a02950, 0x403c9c7d3168ddc6, 0x700b7afe3d2ac9c9,
+	 0xc41f1dd30c5a6f9a, 0x755ecb49fb2d5bd3, 0xe3e2b05039f0ee93, 0x7c0b1db70c0fa13c,
+	 0x11dc36228690cc4b, 0xadab493dd2c2b2b8, 0x14273f2a77ee54fb, 0x9c4dd0e92780ef34,
+	 0x1d274e1373e71b65, 0x1bc06242cff364e7, 0xd3a5915962ba2b57, 0x06c4d024b4f29b76,
+	 0x24a68cc0830c5d80, 0xfa5d395e642a6b9c, 0x231d524255b705ea, 0xafa6a1b78a3b1bfd,
+	 0xe8e5c4b63f99e94f, 0xc81411fd1d16c182, 0x972a4b27c7193032, 0xb3737772c211e1aa,
+	 0x630df67523ccc3c9, 0xbbde81e0ae5561a2, 0x7e8a66fe2e4277a3, 0x236a95e2a2171f08,
+	 0x2f86957283f8b28e, 0xc8c9ea94217fa697, 0xbe8e792f6ae87d2d, 0xb56ac913cdb6d940,
+	 0x87cb924a407252fa, 0x3ded2636f0f33a47, 0x632306b91015b9d5, 0x754783bf30ef8581,
+	 0x200aff986459ec1b, 0x200b5fedc7755357, 0x7687994c2ab67173, 0x00937e14b4d17fab,
+	 0x940e46343cbe48d7, 0xee6a1a850e56a259, 0x25fd8dfc808aaf36, 0x92808f5640af5dce,
+	 0x5b01e488e1caa61b, 0x304e1a08ac6645d2, 0x86a27ed060a73397, 0x011f13aa045048bb,
+	 0x7dfa1713600e493e, 0x4ab93e5810f45aed, 0x70d3174474bdccaf, 0x171fa55a9a0c88aa,
+	 0xfb7849b7720e9cc9, 0x6af9fbb33cb6885c, 0xcda88e5332dbab74, 0x892d3cedaf1b30e6,
+	 0xa18d7b9674d315a3, 0xdec193a0b51fabe3, 0x20a54e75f2576dc9, 0x03498ecabc80a999,
+	 0xd83d35a57d9b6ec3, 0x277305c1036d91cf, 0x393489f39810ea28, 0x73b5a6ccaf2bade7,
+	 0x6f02bbebaa209103, 0xcd31da81248e94a4, 0x1ab287010c931d5e, 0x18ad0bdc3ed67862,
+	 0xe6f3f63f42224249, 0x5b8284ace39130f7, 0x26a7c1471a36329a, 0x39b350c5ab5228fd,
+	 0x52c5b2261e015ad8, 0xb9fe2adb4ed6f9f6, 0x294c0687f5fc59bd, 0x86f2f69acfb56ac0,
+	 0xcf6340c0e53f2290, 0xb7d5d8ecf8987f83, 0x1a2d0c469adaad1a, 0x2b6e1dc1df6eb7dd,
+	 0xb01c5b0dbd80712e, 0xfb3239f1fcc1d2c6, 0x14d65cdb4260cfd6, 0x893425dd99b6a24c,
+	 0x92211c394c4bc6ae, 0x23d45971b0b45b78, 0x03937fc48f3ec58e, 0x2f9c259a3f93fbba,
+	 0x09ecc967add2a51f, 0xa1d836d947399d35, 0xf974347cfe5a13a3, 0x6c70db8a9ab8a33d,
+	 0x4488715d71097321, 0xb1ee58f84ea915cb, 0xcb39c17a454db3c1, 0x1ccbaef5ac8cc5a5,
+	 0x2c248db67249d39a, 0x77f8d9efed6b6879, 0xc8b3336a20c5b535, 0x19c47b7ba96f2fad,
+	 0xc78053856d3c1835, 0x17133066c0fa6a15, 0xa62690215390bef5, 0x6a5e0f8994e125c1,
+	 0x4a91c17b7e882305, 0x21c7704be5f83a2c, 0xc18ad196426c33b0, 0x6833be11b28aff0b,
+	 0xa20fd594745b3f4b, 0xebd76171b70ad387, 0x5ed6b631b9d2536a, 0x0f3ad9f25094bfef,
+	 0xd5a04d1c1154a36b, 0x60763299b23c1005, 0xb561bd27afc1dd50, 0x202e8b1b4aad6c10,
+	 0x4f2a581f0106832b, 0x502a05334d800f72, 0x0e740cfebde15ef7, 0x2dc4f6da1b7fd7ad,
+	 0xd44db76d90d98350, 0xd10819309df07b64, 0xe2bff9754745fe1b, 0x500e801555806934,
+	 0x5615cfc2cf5bb2a6, 0x5d8f0491c350808a, 0x794c3e21534a6635, 0x36723ebf5ef3cd53,
+	 0x845c338512842a37, 0xf7faa4b98262ab2e, 0x89686d81309e8d41, 0x1d1ca8d5e307d686,
+	 0xe0f2e7a22c814c72, 0x7d4edaab51c3761d, 0x2ea8387335bd0718, 0x2dfe1767bfba552f,
+	 0xb43e825d282afeda, 0x2dfc054bc4d900a3, 0x3248d291c1fd040a, 0x802150db354ff599,
+	 0xf2b18be6fd699e52, 0x461a29f7520e363b, 0x8e6e86bc1e9a9474, 0x8c67f40ddb8e577e,
+	 0x846d9583028c5558, 0xbaffc4f3a9c41023, 0xcf6a4bef6d0fdb08, 0xacd4c6be1f8ee645,
+	 0x4439b3c3d55ba06c, 0x0de3c0a7797dec9f, 0x7e578459f8324355, 0x0736d243b0735e5a,
+	},
+	{
+	 0xd34ebe02694dacaa, 0x6d86b95209ffc497, 0xd8e583b1da1d475b, 0x767525e5a5948ff0,
+	 0xee10f7456856e413, 0x6ed4141fa4d0cfa1, 0x3c3d9195f714cc94, 0x108d5dae33ce6a67,
+	 0x6bcf5b724b207c71, 0x2b5b8a1c3ee932c8, 0xa7764bebc6e3f334, 0x42b374a74d1368fd,
+	 0xf40008210a9f785a, 0x8828a581ce5ef146, 0xdf148181fc5421d4, 0x032b4fb2803ac0ad,
+	 0x8444d005d9e5c81d, 0xe7407ad765a3ed60, 0xd3dc4c5e38110fa2, 0x2e7ebb115b558fc9,
+	 0x4dd49398bf19a7e5, 0x0d15201c0f96bc4e, 0xb1bcd264c5fe552c, 0x6b720fe21f897f5c,
+	 0x42dfb12f0f5f22e3, 0xdf213d3ea1376710, 0x783394ffb18af3cf, 0x5038a736cea625f7,
+	 0xe61de1237e083731, 0xe9b488020d9dd425, 0x4892faeab80bf8b4, 0x7c71eed5d756a47b,
+	 0x081b2c768c8ce980, 0x35ca19e9254709e0, 0x125f1cdd2faecdcf, 0x1246f790f7b3be63,
+	 0xc3f90a384a4340da, 0x80f3c53ef73a044a, 0x4398bd75c7d98aa5, 0x8c7f44ae3ee1965b,
+	 0x7f737d40b1bd8baa, 0x5bdd69667db6359c, 0x41e5693e37375048, 0x02f56f8115890b05,
+	 0x09ec9d92380742e7, 0x506037fc04be4a88, 0xf099769983206093, 0x2c7aba9e188686de,
+	 0xe470aa9a87be3f50, 0xe547af530c197616, 0xdb0a23479196530c, 0x6bad341f7c2aab24,
+	 0x97ae3598b36e5b40, 0xbabf3d9946459bf7, 0x77c7ba2288c5177a, 0x8ee6fe378e33827f,
+	 0xd0c08b3262c8fe2d, 0x3849b76b387ec7c2, 0xe9b02e3cdd3a0993, 0x3e7e7986c27a4dc8,
+	 0x9f9d82d454cc44bd, 0x8538e04bbf39f88b, 0x1d6385c1f6d0c7d3, 0x8cfad44ed8b1d433,
+	 0xc824b089ceb62a2f, 0xf807b246b31d2da8, 0xb90e659bd61d6bfc, 0x06a2897f23de59b5,
+	 0x832960a5e53942b9, 0xea6e328c20c10ce2, 0x078ef118ed7ad927, 0x574d538208edbc39,
+	 0x73bd343a054c371d, 0xc6ba75ed24a78eff, 0x1a160742d4a8cf6a, 0x84c91207606bb15d,
+	 0x486758ac9bfbde7a, 0xcf4f5e4c15a8c0e5, 0x4cbe2c52e8173346, 0x44272175ef2dbd74,
+	 0x0240b96ddd02a498, 0x130ee17144d41e03, 0xb7a6c2f6b69182ff, 0x0cbb49a1e7ac173e,
+	 0x61cba2d29ecba1d3, 0x657ed7ff709a3a66, 0xc1aa8f627a5b0711, 0xae8007800c452a33,
+	 0xac67972d0d760f0d, 0x65e8fc7e5fb27427, 0x44f672247b42e05d, 0x0d95d2d7d5531bf6,
+	 0xbc9a1198fd6456cd, 0x23573c488ff8ca09, 0xf42efd7d67d5d92c, 0x209bdda835fbb53f,
+	 0x73f0a8e5a7cab560, 0x3781d1ed9067251a, 0x40976d5069af11e5, 0x7aafbc110248a3dc,
+	 0x358c9f4a837f1adb, 0x31a440c054fd0538, 0xf7446235981aac61, 0x76e2e25ec794602f,
+	 0x65d5a130c27e8346, 0x0b64236f45c6d7c3, 0xdd934282bdb538fe, 0x93a65a6862dc5146,
+	 0x097a74c5901b0488, 0x8afc88e8ff03b347, 0xd769385e9ae1fca5, 0x217b60c451cd7683,
+	 0xa53969ec56974f4c, 0x8b85e155291bdf72, 0x7155b308fade8f89, 0x42d8e0bbb5e25d24,
+	 0xdfd4ea5251c0a427, 0xec04d5024312a3fc, 0xd87d3e3770a29d43, 0x7709a5109499538e,
+	 0x949cfc3c96d09b94, 0x0071c2279ff975fd, 0xa76882c0251cfc8c, 0x930be3511619d463,
+	 0x06af6c953060e775, 0x0ca3ab1ebf245e8e, 0xaa438ff4a4698996, 0x6c53e090a0b534af,
+	 0x4f6bed3477128444, 0xa61dddffc80cea99, 0xff5504ccefcc7061, 0x304ac4206094e082,
+	 0xe3f190619914cb98, 0xb9c0e97a4579cb60, 0xbfd8ab5e7873be75, 0x0ceb80eb5c07a0bb,
+	 0x1b600db113e6c0d4, 0xe9bd27f48f8a0331, 0x6a80ac13c872308d, 0x558025e227249e0d,
+	 0x666efe9f9fa8853c, 0x41f32846f2a61803, 0x39ffc929cf4869d4, 0x677f956662dfc454,
+	 0x66c64bbb9e20aadb, 0x7899bcd926f42344, 0xf7ee80e4845bb062, 0x6dfb21e53a82ba23,
+	 0x1564b6c7b06eae4f, 0x81939a031f6ac511, 0xfb1f7b09ce591a64, 0x7fef7d03ac3b797f,
+	 0x447b39656338a666, 0xf2b3777facf3f72f, 0xd93ad3bfdd535654, 0xb03ef78f764c3a30,
+	 0xa4e724dfdf759b9c, 0xca4b292fef826ece, 0xe3ee44651002c206, 0x89b2084e60ecf335,
+	 0x44d266bebf485230, 0x1df11ebc5bce4c4e, 0xaafbb740a9f70b69, 0xa63db69d86ca6c74,
+	 0x2f780ee034bece94, 0xba2c994f528c573c, 0x400d5d5a6b642031, 0x2dc4ef5f5808619b,
+	 0x1da283dea03c093e, 0x8af53629ff3fef9f, 0x10108c3b99909004, 0x81b454462f92b3f5,
+	 0x88f86600d6e813e4, 0x6c801502445cc10d, 0xec3b8446476b430a, 0x2f0f91ca6598cf49,
+	 0x73ec6d13ad7bb7c5, 0x98d6a42b175ec752, 0x349f790aa5f2f92a, 0x0862b9fdb054611f,
+	 0xd0a9f215fcdfac32, 0x4b715a880ce1e4c2, 0x4f32bfab8de0f37d, 0x1ea6ff723fddb889,
+	 0xdf2bb65de650a836, 0x2a900c73c857c482, 0x3993da46802b3eba, 0x4deb9227b07581d5,
+	 0x33b84731d3ac1634, 0xdf132fe3be7791b4, 0x159a7733eb37ea9b, 0x5f7d4ba71544578e,
+	 0x627956033410db9c, 0xb0a56cb614ace946, 0x067064ff50b98e8f, 0xa8f3a7525b5d7d90,
+	 0x90165cdbf1e5e03c, 0x0cd60f8b6cb0f727, 0x8ad7fb3ed664d287, 0x2f3995abe4cc1993,
+	 0x4c87b35a2adee225, 0xd1ead51c4a30d733, 0xf296282e6e34e283, 0x632085b6cd6245e4,
+	 0x2ac907b05d8f70b0, 0x5e09777acbd54a20, 0xe2cec7d6a93341cd, 0x4500ea91327f183a,
+	 0xbc684a3b5279bbe7, 0xdf085a7d733c59f6, 0x035c1924d31df61c, 0x7a9f75b3d0e52c1a,
+	 0x0205f05e7c089164, 0xa0ced61fa3da5179, 0xa5cf1a68f962c1f3, 0x7516bff54e2c7f47,
+	 0x61236dbc9040194d, 0x594e2a8fee34f8f4, 0x497fcb7b192a2780, 0x1225c1bd423857c6,
+	 0x482b930f493cf98a, 0xefddb5911d62152e, 0x61c3cb7a6e136ea9, 0x1ee08c7638c1c6af,
+	 0xb1f94050fa31dc29, 0xfe16977c2bb20a1f, 0x59feddcd314f9c60, 0xa6baef9454ad59e2,
+	 0xc1805c566670855f, 0x97ccd4a03ac0add1, 0xe1cde09da3e49d4f, 0x5af174cde27a7981,
+	 0x48d14f0487caab21, 0x869d8fe6ffe0c8d0, 0x6c76cb694a7ab39f, 0x18534e8462d32294,
+	 0x818bb69a89e399dc, 0xb389ca5b9743236e, 0x87cc60723d2f4027, 0x367364824ace13ad,
+	 0xfee4b72ba23c93c1, 0xe5f8ea241ab5b59a, 0xcb45c28dcd829576, 0x33445eeab88f0792,
+	 0x8cef9595c2c81c79, 0x87bbf7b8cd09ba4e, 0x096b084d75877b71, 0x61d3b60cb58943c3,
+	 0xf35fe43775d761d3, 0x00e96da833c12a69, 0x1accbbc838bca88c, 0x6e9f893f4d3c186a,
+	 0xd973e39ebe211b34, 0x709151fd2d49b21f, 0xed4595a9e6786f49, 0x01483ed31e1b8f60,
+	 0xd009e968bfd2e6ed, 0x030fff1a2417db5d, 0xc89bb9751460fea3, 0x134b4f18aa734b80,
+	 0x0a72e9ce507263bd, 0x44c68031021114f2, 0x0423d1e8ce843829, 0x5260509741dad8b1,
+	 0x42c464b11010828c, 0x00f7695151e9af05, 0x3c363e43d6699fc2, 0xadbb5b99d3e9c275,
+	 0x984f283c58b27c59, 0x1b9492236300ecf9, 0xed05450da8859665, 0x2720aa4bffc493b9,
+	 0x070be77ee9d4309d, 0x1413e803c5ee065b, 0x68b7bfd2de56dc1e, 0x8713ab439d8c12f4,
+	 0xc64c8e06831e92c5, 0x3b7d0ad1309ff364, 0xaa4622e047a9ffdd, 0x3e1a4ab1f56e1d71,
+	 0x3a9961276a9129c3, 0x27c92a3d307ec8b1, 0x1b55ca6cb8322670, 0x471107044a7589da,
+	 0xa18344950618589f, 0xb48ad5333e867835, 0xcd24fa501bb798d2, 0x2e9d2b54202c141f,
+	 0xe2b4f7c7482e04b8, 0x64f702d00201139d, 0x7e4cdb4c645773f6, 0x003897328f9a792a,
+	 0xe6367afb3c9846f3, 0xd75004e0400b42ac, 0x2e297a9bc53dfd28, 0x6e6c327473a208c6,
+	 0x24f8d91726d3ac0e, 0xaf3ee7a3908ac86c, 0x6ab29663632d2bd8, 0x6fe9511a6e72144f,
+	 0xb95ef82403fbf3ec, 0x0e70a63fb539d6a3, 0x296f67f706cf6b88, 0x18c021686a17f013,
+	 0x346adfd82693930b, 0x568c06a3334ed7c8, 0x5bbb1d76cee810d3, 0x4e2447b1d71486fe,
+	 0x372b46fc0b1b30fc, 0x5daabaf5a85490b2, 0xbaae25b892491180, 0x03cf33fe3ab1b498,
+	 0x3897ce10f22c1acb, 0x5202978a2b7961aa, 0x0ad92434ce5ad6ce, 0x70e6a3192be959e0,
+	 0x3b75dcef2765d913, 0x4625186052d3da7e, 0x11527fa9000b335d, 0x5d4701a5d42de5ef,
+	 0xc6f83bd064a19bef, 0xf99c3f2537ffdd1a, 0x14d7488461fdf2a2, 0x683043618a7a68ea,
+	 0xb59c3993e41de253, 0x897d0fcf4a71b336, 0x3e6e10d408d0933c, 0x1a03fca99cc1fadb,
+	 0x5daf08164ed3fc0c, 0xe6de9f419e9ff161, 0x71bfe7f810fc6b31, 0x7163c2489bcfde56,
+	 0x4bf58959f8bb91c7, 0xc0d36ff24cd9fd2c, 0xd08d95ece37e9c8b, 0xb55b290e49426e5b,
+	 0xf6ad42270e0327be, 0x505bab66d9f9ba5e, 0xce6e0e67d643c58a, 0x077ea5bafd0e1961,
+	 0xcd3078d589b121ad, 0x13939a2492126015, 0x33df30545f0da1d0, 0x1ff2d5673770c56b,
+	 0x70a19843a7b12b69, 0xf183107dbd7f5c74, 0x4af5087da61cd835, 0xa5d22fcbec8e6f4c,
+	 0x9f78f4d20d80bad5, 0x1a1a504929c98380, 0xbcaf58adb07e9398, 0x26c081762021057a,
+	 0xa601523472722fa4, 0x03a025ff4384c8e1, 0x111729afe2c04ab1, 0x7b276eff890c77e6,
+	 0x5680bc7354f156ed, 0x5ff60dd6b1289d22, 0x27978daa08296e56, 0x308112648b4d69eb,
+	 0xd0e8d682588a9c07, 0x8c1ea11c58a14283, 0xbd3ef5192d0d3b69, 0x5ff873fa012090f0,
+	 0x20694fe25a689c51, 0x23cddcbc1c59b137, 0x86a1fabf29b8abd8, 0x2c01c1c9d36315ad,
+	 0xa247eb62e960c17f, 0x3a0892dd4027b313, 0x6fceff78b21c011a, 0x6171810ba31a03dd,
+	 0x84f0843426d912af, 0x944f083711668c64, 0xdd101ae852f76447, 0x700369c2d4ab3113,
+	 0x7d56badd2aa125fd, 0x0c99e0def39f216f, 0xdef03515f9b66873, 0x96fa4fbbce01558d,
+	 0x40aabd6c2ac845a7, 0xc6595330698a4584, 0x2da8b485be2ac522, 0x2111dd1fcc88e524,
+	 0xcfb467c8988918da, 0x7cc2e61f8e13c5a7, 0x275804b435a3ba5a, 0x54aaaaa55d9ae007,
+	 0x247f080542ffe437, 0x974924698cc25947, 0x928e6968e3e58c55, 0x7bbcf4ed78f84d55,
+	 0x4db2b40b632cb980, 0x07727639521cbd97, 0x46eb806b35ac4646, 0x66993f4d4414c361,
+	 0x66294ac72c47b67c, 0x45d1307ec5293fd0, 0x048eb1dc34f2e4b0, 0x4269d2c8af0538b7,
+	 0x44d5acd3a0b47df3, 0xc2a19773e98ac838, 0x2ca316e3a401a64e, 0x4ccc24f2ab79fa86,
+	 0xecb0d131c1cc1937, 0x6c7b17e7ae40d9ad, 0x75d20f1c307084d8, 0x09e970105991a58f,
+	 0x0cb5e4023046c063, 0x1d4055e973126bed, 0x5d4f586f1110626e, 0x0e78dc677bdbe190,
+	 0xcc2ac10c0ea035a6, 0x9368f76f6460f2ed, 0x193116cc9622daa1, 0x33d5705793d9f94f,
+	 0x2a2945049968287c, 0xd18d0d9c0baf52cc, 0xf993bd74d350597b, 0x61cd66c559a3235b,
+	 0xd5bc8251e717dc21, 0x23084bd721ca44a8, 0x52228ab8d31b46bc, 0x461fe74ac8c74e70,
+	 0x518f8edb9ff62bc6, 0xc3acf1d8c139ec82, 0x202e1f841b2b47c0, 0x42d3eb4ae3e5ca3a,
+	 0xaa741c10df7401f6, 0x63d90bc75426c94c, 0xf4f98f1ea9c2d674, 0x34758aa9cdaf5ce0,
+	 0xceb54e6a6a8497fa, 0x13a7ed7297caa9fe, 0xe396f92bf64b3353, 0x0405e1db78fbfe02,
+	 0xd327db667a965d37, 0xd736e8a82a7fd472, 0xe6ccd75264cd3523, 0x20947b6ff0f25986,
+	 0xc5dc28a312b4d50c, 0x23db7a51450de9d0, 0x80d8c71169217840, 0x8c6ad9617e6f0117,
+	 0xc284e73b9ef2f5b0, 0x93f15f370bca1dd3, 0x4a07fc8e06296861, 0x6b6fbed5eee64a31,
+	 0x84eaeebd46e3a1cd, 0x21edbcd8aa0e75fd, 0x05ac6e8efad5ebce, 0x8223891eca124d40,
+	 0x80de30e1f99a4f4e, 0x0b545e66f3bfa2f2, 0xc30a3a6d3bb7fbbe, 0x2d049c5bb722cbf3,
+	 0xe63793576aedf523, 0xc5eadb61beef6a20, 0x2d15cae843f421e7, 0x02b7f60258b536cf,
+	 0x56f9f943dc59c225, 0xae837babfeefdbd0, 0x61a7b7b119d509d4, 0x24d706255cb33e57,
+	 0x7ab7c36482f6508d, 0x2b7eee3efc71ad3f, 0x48a695f067dff5c0, 0xa01cb1cee97c0a8e,
+	 0x6da1f5a64011aaf7, 0x8a7db22030f3f2a2, 0xfc9e990b8e16dd57, 0x1ed41aaa430881f2,
+	 0x73b2b467c0c8847a, 0xa293c85b208a7936, 0x0f6f1639eab32fd5, 0x196fd4c3c303b95f,
+	 0x0cb24e9d4e43e3b7, 0xa33bf365f7e50dc0, 0x71722ce8e65a74ad, 0x986c2980e905959c,
+	 0x0cec278815d141d4, 0xae2e5bcce1b8af58, 0x609ec5e62f22fb24, 0x244f34527221a8d5,
+	 0xcf9415b23119deff, 0x736428b177abbcd1, 0x5122d312b2f35702, 0x0b811b8aa10ad8c3,
+	 0xc1db88b47863a143, 0x942a49ccff20212f, 0x4a5a1c34e25cf96f, 0x50760865cd45622f,
+	 0x3126392f5b1bab74, 0x8d67afb07f498a56, 0x670096c501f20aed, 0x3e03c00e9ef38c0a,
+	 0x8a48a1215e658c00, 0x378a355e949f7728, 0x30918ab5e0d8e015, 0x95e5b873b546fb8a,
+	 0x3f548debb201a503, 0x459cd2770eb78307, 0xd8aa31dcb0e1a802, 0x4506e62f8c26586d,
+	 0x85f62c39dcfc03e1, 0xa8f1fb9654e6cdf9, 0x45d7dd5dfe5281de, 0x49100606f5407822,
+	 0xe59d779b505da254, 0x0f325afb104ecdce, 0xb7d490e69fd51e4b, 0x6d22602ad48a2ecf,
+	 0xdc3750a7c955108f, 0x2a31f2619ee7ebdd, 0x4fbd02f47a568c90, 0x5bfa22d8ed23ec33,
+	 0x31546a8a99b5da24, 0x2d07439baa226800, 0xc5dd502e66bfec92, 0x428168647c38e519,
+	 0x0bfc5d7182433859, 0x49a3c2d94ca753a7, 0x6dd06277698540ad, 0x5638ad0076b84940,
+	 0x82cf9df543dc41d6, 0x21655049e7344e07, 0x10137cba8263595a, 0x1e5bfa5adc06db43,
+	 0xf15d98d6190030f6, 0x286a9ac860325a88, 0x0767b47f78f841b3, 0x65f762792767d81f,
+	 0x97b24282da45ced2, 0x9dc58c207fe6c4c5, 0x63b991c3da8743db, 0x605ebc994edede04,
+	 0xa2621e33b9bd4037, 0x7d83527f915e1599, 0x2ad42118b392f057, 0x041f7436de6908c2,
+	 0x80cd39177f2f055f, 0x9bc661ea45dca7bd, 0x169c5fae3c3a8160, 0x2abb320d70712708,
+	 0xac1992b5a0b49fa4, 0x64a404764257b5a3, 0x6a19b563db1feed6, 0x9d6b0132d75e6139,
+	 0xe95044627b0731b1, 0x2c8f550069c9b4d9, 0x07a0ad64fd83ce86, 0x457e715fcf63e29c,
+	 0x083e4348a71fa4c8, 0xcdb707a53efe9444, 0xc607019a521f6561, 0x38e5d30736ab0d2e,
+	 0x0e978592fc3b8bd1, 0xf379011be1789672, 0x516803c602ec8cb9, 0x35adac06d2d0d741,
+	 0x19f7513fe811b01d, 0x35f3a547b57e3c37, 0xdac5342dcb8e2829, 0x1b7186a2dc26eb1c,
+	 0x8445f217dd5d5845, 0xbea1c101facbfa58, 0x55b79ad620625da7, 0x9d5e0e27ddf18606,
+	 0x181b9388eeb86562, 0xbbc67abc9964f240, 0x8ddecbe1214fa8e2, 0xa4465e9d32d8d911,
+	 0xe309f42616f7ebf6, 0x66b7ceb871207507, 0x29611c9a75a2d94e, 0x87396928284a9f3f,
+	 0xed20284a6e624a08, 0x062e3bd10389a106, 0xc5e6917ad2aa4ec1, 0x1bf459e563411a02,
+	 0x6cceb58f3f12ac4e, 0x7e1dff19d8c045a8, 0x99503c4ee4b47dc0, 0x9d39cfc0234fec4d,
+	 0x8db13a54c5afb673, 0x7be35b3c243e2454, 0x61afb70b3d730323, 0x161aef9115ee9813,
+	 0x8a1ea78f7876c1be, 0xb909678d70489fd9, 0x72d091e6cc510618, 0x3aeb3d5c860f5c62,
+	 0x33c6d00461434e8f, 0x735e10762ccde26a, 0xe20e9a363dd0d6b9, 0x8631641b6e0d60d0,
+	 0x4d3bfad2b486ebcd, 0xa0e3bb2938d6ac99, 0xd8d117c703a05b2e, 0x5d0b219aa00c6900,
+	 0x84c02064d0a01e1b, 0x216785d938faed1a, 0x159529724dce1aad, 0x8c2a9308e95eb448,
+	 0x6e9b6b2dd5b471fb, 0xa2a2100600e47561, 0xb1a258104aa9ca32, 0x4bf4053647309703,
+	 0x4a8ffc06bb2904db, 0x923c31fe487e42a7, 0x1930ef6b72fcfd55, 0x35decf9babc1d101,
+	 0x035294edb08b37a8, 0x824e3a591681eba8, 0xde051fa546e3051f, 0x7a5a90cf7310a695,
+	 0xb7299dbbe4d66146, 0x4df2e940f415ffb5, 0xefa803bb3a359275, 0x9e922666e275f04e,
+	 0xcf3c41c7a908a7e9, 0x2b54ed875b855b66, 0xeb6f5b3b73e3ede7, 0xae3fec0c79363024,
+	 0xad6459582d30c3bf, 0xd4e4e01955c3bc01, 0xbf9811088904d547, 0x8d148225de79842f,
+	 0xb75f769be63110b9, 0x94923f5950932ee5, 0xc7dd02dbac47d8b6, 0xa12c97ab6ca5224d,
+	 0xae2be05fd905413b, 0x169656a32d0f1ba4, 0xda2b3d7faa7ad36c, 0x5b8924d7363bce4e,
+	 0x64f16ecc96412a88, 0x46609df0ba6e942c, 0x35587f8d3e2d4333, 0x38660fd5cd09a46a,
+	 0xdf0462ab7cf8efcc, 0xac21b40e4b727174, 0xcd82aa55556d506b, 0x498ebd1892bc9875,
+	 0x12a3e21fbb2a279c, 0xb2e047418428418b, 0x2df67a862eb7289b, 0x24b56103bddcb243,
+	 0x4a54ecc353d88665, 0x2b4010940f6ad627, 0xf3eb33985c41caad, 0x9e60c367336bba7a,
+	 0xea9743a0c2d09e4a, 0xc6fc3c8d20a66146, 0xe3d76308b5752460, 0x9125728e68d6c42a,
+	 0x10eaae10a7417176, 0xc16ad2808c2640f2, 0xb7c335b3f211a72b, 0x8ebe9bbf7d66e65d,
+	 0x330ed0433e4d23c9, 0xb6e286e3b59699c1, 0x1d8fd1e69f58efa3, 0x449523105c1f5d8b,
+	 0x8cdc390dba502ae1, 0xe490fafcafaf855b, 0x48268dff5a8feb3c, 0x4c6bd0e25a26ea1a,
+	 0xba2f5189560cae19, 0xaa4f4f84ba9b9133, 0x04b37fde98ff6794, 0x4394f5e4335a9d95,
+	 0x5bbf50dd611c2f2e, 0xa1d26223b65fdb1e, 0x898cb119cb9b1218, 0x2c1d3b9fe6cd5d0b,
+	 0x96a1719a014a1c02, 0xbbb929fd0e1c3382, 0xe01ca71116179540, 0x451bd935ada0d40b,
+	 0xa6030454c8e5f5b8, 0x8e2d5e61c94ea26c, 0x846e9aa55a74a30c, 0x067c0bf9e52e0a8f,
+	 0x3cb1c7863e4f4231, 0x7231048d67196b94, 0x13771dc4f54cb315, 0x82c1da5e4d199705,
+	 0x9778aae8b49355f2, 0x2476bc8a1a26dbe3, 0x97dd68eea1874cb1, 0x052edb18f6b3f245,
+	 0x3c261b213439b5af, 0xb9ed457a8bfc5fbf, 0x0c8c5a132c1107c9, 0x6348b7a818f0b32e,
+	 0xc3ee7b4a766b3f53, 0xe241e0b2cd90a892, 0x4506b2ab02520866, 0x88cef04dec872fec,
+	 0xaed10176479b219e, 0x1f4ce60c3de35142, 0x216777c1e71a77e9, 0x47f3de8e469ba4c5,
+	 0x5c02a98344cb6b90, 0xec3f56dbb93b15c7, 0x70e92cc87258b892, 0x61b56eff572ab7a8,
+	 0x716524b021f5fc2a, 0xb472a01e180ca2c0, 0xb36a36b8d3d690b5, 0x54655369ac82e747,
+	 0x57d4e8db0b1170ab, 0xe5bb933aec77273a, 0xd5a2cd256e42e848, 0x9cca1bf848c9251d,
+	 0x6f8738dc84df5612, 0xb5ff6afcbd4235b0, 0xe0469d094614d522, 0x5c684ba31f152c80,
+	 0xc775a7d18353aea9, 0x8640e76a94f3c61e, 0x6ddcfc68a2cd3d9f, 0x8d4662d6a8dda9d7,
+	 0xada3c03930ec4f84, 0xd734fc61175f5d90, 0x6872877205f6de38, 0x3b0cc76cfe37013c,
+	 0xe67c404a489cd77e, 0x75817b3d5e951073, 0xba3d6290d77088f9, 0xa3b8010763245241,
+	 0xfacc0827c05aede6, 0x62b5e915a17eb94a, 0x6a9e616d074f8843, 0x038629b758fae369,
+	 0xd286ac4e66bd5ac8, 0xd0fe95a7c2f6d4d7, 0x2fe310b5ebb09404, 0xaf44f0d283368e84,
+	 0xfc21ad54b998a7f7, 0x387e06a1d4e0f0ec, 0x16a5025c5b7301a9, 0x5865da40ddea6f26,
+	 0xb636d9d58af8d1ff, 0x55cb9afd1044f3fb, 0x74a31920014c4167, 0x3744a95e37d7b9dd,
+	 0xdceaeddbf2a94fb2, 0x614a9299afaf6d88, 0xfbc708284b994554, 0x6058e40005829f1b,
+	 0xda55d4cc8c1f9a26, 0x0949719d2102f3c9, 0xde78100af45a278e, 0x91553805fb5a2adb,
+	 0x16c3f16986137fc2, 0x9630560d6b4a973b, 0x172c77b19b539fb8, 0xb320fc8f6e6e860d,
+	 0xbfebc4f32fbad896, 0xdfbf2f86fc280fd5, 0x407d48f422c83923, 0x8e63792c3d79b051,
+	 0x12dd8f24bd1d7661, 0xe92f0f1894db8290, 0xaa890e9c6a114e67, 0x9c3439cab94064f9,
+	 0xe7d80ba8045ac992, 0x5d5eb3486cfff170, 0xb7c2ea8de067bd72, 0x44f83b54ca46662f,
+	 0xf8911c183e159599, 0x9336fef7684d0f1e, 0x71031f3ad8ef3642, 0x16330c7553ce9ec3,
+	 0x340ff7db186e17c8, 0xb703088fcf223e65, 0xfe216d8314687a7b, 0x6962a84913ee66e8,
+	 0x44e3d7a6ae7304fa, 0xd982ffc30b156b27, 0xd5f21280d825044c, 0x3616bfeb221da346,
+	 0xd7d4e762938a82b8, 0x7d4599c3a2f17fec, 0x76c6678527215ec9, 0xa6275c0b180642c4,
+	 0x80414d0942edb2a3, 0x930aae11f94d6614, 0x4160be3c45a87dee, 0x0f3782647606b70e,
+	 0x74a2d2176c2bc6ae, 0x576726464cce2735, 0x45d7ce275a35af10, 0xb22271ad8693ce79,
+	 0x2fe40ddcf1802804, 0xd184442bf736c8a7, 0x803697c4c8d06e7c, 0x5886996361a4b6fa,
+	 0xa2f538bd54623666, 0x5b61c5305c1f7a4c, 0x963a62694fa5cd1e, 0x1906598432105a8a,
+	 0xf8163f47a6fb14b0, 0xe4434a8b9ce67494, 0x43149973bcdaf414, 0x664a36942f2cac76,
+	 0x83b0565ad808353c, 0x6a9966a74bd09a94, 0xf043df942eb76e4c, 0x8e905d7ec781a9e4,
+	 0x9c29d7c023df3daa, 0x99f08f8eeafd3aae, 0x2e77255acd297544, 0x9daa72f9f6375f59,
+	 0x439adf49fcbcd035, 0x8db007b25f3a0d6e, 0x28c20e83b3bbb5a6, 0x0d9bee18e5f77087,
+	 0x82f809e3b930c470, 0x955ed6e703629441, 0xc19ab6e9405d9772, 0x8314306652b7a7bc,
+	 0xa69bef55cdd2acd3, 0x076e91e06b24dbee, 0x2979bfd7011fd31d, 0x17755eaf9c0371ec,
+	 0xd2493f2c5b775565, 0x26741df3d8786069, 0x8226dab261ed6011, 0x4a55caa0d4d403ea,
+	 0x1799ae778caeb31a, 0xa67ab791ad8dab79, 0xcd72d42bbf6f0b0a, 0x31425f7d6c394921,
+	 0xdb06b4f19b2160a3, 0x49e943d10767a42a, 0x564fd0cc16b60524, 0xae40448e2000d549,
+	 0xdbfd3154e0650fb3, 0x00bd13f4aea13907, 0x91ec3e47ffaae230, 0x464fc11c6c438ead,
+	 0x6a97b443f715c54c, 0x9399feff50d05e4f, 0xcf0e3f121e519833, 0x89ada1a2a25b5c8e,
+	 0x51000372fb08eddc, 0xc806272af12486ce, 0x37273daab4e18b38, 0x5a929f474c6a69f0,
+	 0x9347f32673b854a9, 0x08fa525034a13b3b, 0x6d51712ae902b8ac, 0x1e7059129b888554,
+	 0xe8e3d3707f7e1da2, 0x8c5d9484f10237dc, 0xc737f4b4c9718c0b, 0x71066d7a9159d04a,
+	 0xffce93aa239dc36b, 0x5617cc4fd42f383b, 0x71388e030450915f, 0x1ae3a61d686d19aa,
+	 0x98ad9127c05bd54a, 0x6ce5e33041ea42ea, 0x6b7d7c7b524983f7, 0x1b0939ad9a03f99d,
+	 0xdfbd05676c397160, 0xf6c9816b2d6e590a, 0x93ae9b25588be2ad, 0x871ac2544d72aedd,
+	 0x60be6ab6b182ad45, 0xcb30c16908d71515, 0xe51a87a46e676004, 0x1cc034441807fa54,
+	 0x889a445821631395, 0xe54a0c4f6fbfe846, 0x05bfd764aeca9292, 0x137ae5ee1f49d437,
+	 0x88d7d7d2d07e8dc2, 0x8319a5c23858f804, 0x583489b6238fa2dc, 0xa6f70fc953caa35e,
+	 0xa370da9af2e88cb9, 0x18ba66398f368b95, 0x0eab1bb82f70e8ac, 0x7a095c122432c232,
+	 0x3ff3e536fdce37da, 0x81c7de5fc26348cb, 0x8d3cf04fd96283bb, 0x1f69802ce95ae55d,
+	 0x063680ec493dba2b, 0x25dcf847ba9ccbd4, 0x0cd9f65cdde9e328, 0x4fdb19524e4e7683,
+	 0x556d2fb5f1c9f915, 0x0f3e0db42eb7c4e6, 0x35004e186aacf9f0, 0x425f73c725b77a93,
+	 0xf63adf065d4e86a2, 0xa49f31abffe4830f, 0xd7e8a1c47cfe4116, 0xa0336b78796fffc3,
+	 0x22aca88ad7fc3929, 0xa669693fff5c0c67, 0xfdc3b8fa47ca72a9, 0xac5e63d6e62520fb,
+	 0x3f5dd162c3d5e495, 0x7064af6ea739d331, 0x81c2c1f7be6e9d48, 0x9bfb4f2271081555,
+	 0x7ba6c417cf32063a, 0xfaf0641a8e3dda74, 0x3ea17624af6e111a, 0x8573ffa750359cd4,
+	 0xba732c087808900b, 0x6d28fcad2636bcd0, 0xd369c00a0a7c00a5, 0x00be8667c7914c3e,
+	 0x20cf1b4efe3f6712, 0x40784acaa1fcf7e4, 0x24595adeb5fba1af, 0x43b07f297019ca66,
+	 0xfd8206061d111ab3, 0x9267d5c0a2a78eac, 0x8966f3bc160bdae8, 0x3f9afae7f0c60145,
+	 0x45801e11f6a07515, 0x52bdfd4f03032341, 0x5456eff515830705, 0x209aeee6aa91e9b4,
+	 0x238773ea9f39f8b7, 0x5437f27b8615dac6, 0x3e0392fc69dccb92, 0x53f7360c255cbf0e,
+	 0x02f54aa6528e1919, 0xf067c6dd301ba9d7, 0xce5d8f70fa95e19c, 0x194323c4d67c4259,
+	 0x79dcefb8efdc677f, 0x2a96b510f5e345b3, 0x55c90d36454373a8, 0xaadf03dc4a76dfdd,
+	 0x2462d1a044011094, 0x7369011d772f8673, 0xf798994fa72b7788, 0x5716b4ce529f52c0,
+	 0x7971ff55101f38e0, 0x040d127846644079, 0xe46cc73efcd74007, 0x9ba3f7fc7019f912,
+	 0x635044479476cbc3, 0x7f4cd56279064eef, 0xda25df3351fa215a, 0x88b0cf3c5bfb55ad,
+	 0x8689d7018fdb9bd4, 0xe9868353e28d83f5, 0x3f94d66594410a3f, 0xa7929a02955acb30,
+	 0x695a2985ac191370, 0x9696288e72413f14, 0xb60b5b27f12ac965, 0x807f667fb4f65d11,
+	 0x86c47454dd510e4a, 0x356e132ac22f7f49, 0x262baa35b234cc66, 0x5231e6ef067229b2,
+	 0x76de51387b7f8d23, 0x28b0611940f40d50, 0x83ec918eb4be4174, 0x541919debc4f5a53,
+	 0x5f3c17d0a249fa59, 0x67929b1a431191fb, 0xffd6695ce79ce66e, 0x74c8fdddf6526514,
+	 0x81c74b276374fb36, 0xc8578f0ae84d0092, 0x9153e6bc2a42670a, 0x27629565a5911e67,
+	 0xf89973ecd1d49cb3, 0x1df43fa48672936d, 0x2391e888d69d6ac9, 0x13960ff0a4ed2022,
+	 0xf01a7b4b7def5188, 0x749d520b92d44de4, 0xdf5b9059090432cd, 0x95a0c631fa371751,
+	 0xa241aa494f9c28ca, 0x9caabb5672ced1fc, 0xb736f8e371ec5f94, 0xa1e0f5208f6aa629,
+	 0x2b3fe52aa0363515, 0xc36575bfe35c86fe, 0x6d07f8d781daa3d5, 0x4a3d54774cdb0434,
+	 0xca1122c008ad7685, 0xa0cabf5733d9e09a, 0x1fb36ecda04b514d, 0x0b1033a44491402b,
+	 0xae6a28092c10f982, 0x80c648016773decc, 0xb3c90811ed6dbada, 0x74a74e334998ca8d,
+	 0xe84dd3b828291d6a, 0x81cb41412c214bee, 0x92ce1756874ce389, 0x0e51b5ed11827c03,
+	 0xd66772f3c08ed26d, 0x30c2fed535affcc4, 0x17e905cd06b94dc3, 0x80cd944c6e4a75a1,
+	 0x47a3345adca3a0a1, 0x7f7172e9a358910f, 0x9298cc6c40131832, 0x13ec53846e20efcf,
+	 0x5572b0dc48309c9a, 0x7b06d4b8e0512aa2, 0x9405d3cb9611cbd7, 0x0a3934588b2b49e2,
+	 0x869ee24f5bd11296, 0x91be187833e17d7b, 0xdcea6f0bfd496633, 0x83a438aded4a06a1,
+	},
+	{
+	 0x864af97aaa1d8730, 0xcb744d595ac5da50, 0x728e112edf2b0a7d, 0x15b83306414155fa,
+	 0xc1a3a4d9d2eaec08, 0x339c89e66af54abe, 0x779b2b9ad8b39510, 0x2818a143d1eac0e1,
+	 0xfa96e949f9cc7b7c, 0xd73f4a2681f23c6a, 0x41fd4f6175341ce7, 0x3dbce6fc245224bd,
+	 0xcbe3d414bc0ef968, 0x1213d4816732c8b0, 0x8aed624907a0ceff, 0x4835f1e3b750e612,
+	 0x20eb582d7ae7dd4c, 0xd7a47b5ed84ef8c4, 0x26cf72acf790f3ba, 0x9dbe543c92764f7f,
+	 0x00ed011c988ef8f2, 0x0bc78b7af141460e, 0xca78d888253b24b0, 0x1b7c3a36bb5d5c7e,
+	 0x6fce4f3d986c5f42, 0x28142dada612503b, 0x73b4832a01b41a48, 0x9fbac1611f42fd82,
+	 0x5d6185a9656a7791, 0x118623054e8cd073, 0xbec0b1f8fda037e9, 0x367700b3ade566c9,
+	 0x6fea17620491b974, 0x87552e29916b41e7, 0xf9b277cb346439f3, 0x5c2a9e2d0c977f11,
+	 0x39ca70beaedecd38, 0x084ad0b547e8584c, 0xe34c0b8cd910b2b4, 0x8ed2a1bf7ed0acdc,
+	 0x0e0e502e3f7cf298, 0x463167827342dd09, 0x258aa92d0aa0d75c, 0x7b6ab8b3499a8267,
+	 0x9dff8cf3ad4f13b4, 0x9c739a99484fd35f, 0x0bd930dcaed35b1e, 0x0c5c94cf8398a690,
+	 0x2c79b884eec0fe66, 0x3d191852021b7624, 0xed8e5ddde0dd96ab, 0x8016d52b47d5c6eb,
+	 0x30fbba647c5e06cd, 0x828ae6314bc15969, 0x6878022c3f67b111, 0x011cdf1f13c0129f,
+	 0x858f6226d8c13e72, 0xdde8dfc67d239e1e, 0x838d2f05b098a54b, 0x140169c20e931ed8,
+	 0x358286bb4468aa0e, 0xe3cf4166c58183f7, 0x6ab015756fe6cefd, 0x0c977d4d7eca10cc,
+	 0x49253bf75fe38fd9, 0x6dbe484aa4f5d9fa, 0x5ac1b4dd5e1f27e1, 0xb25773b7e99a13f9,
+	 0xcef886de4f3aa61f, 0xa1d1d32f453a85a8, 0x0642f290857fd103, 0x6b8f91ad79541fe3,
+	 0x1156d99878688a16, 0x4655c2b2f1f173f3, 0x70c20db983002914, 0x9c475164da0edd41,
+	 0x3364faa2a4531ea1, 0xbc70ba92ce9c6d86, 0x2e41a2e4c93808d6, 0x0e55ea3b14088ccd,
+	 0x6d46b14f60024826, 0x81c068c53f58cd84, 0x99063abf98d0ac88, 0x9ae008ef25bb535a,
+	 0x8e8294a68cd78bda, 0x456a4ece7cb24e42, 0x6bd51af2a43851e0, 0x766a5020dad9a44b,
+	 0x8592848e363e5168, 0x277c8dc178bb728e, 0x9f3b2de4faabd29f, 0xb54ecd14d3a89fe8,
+	 0x0aa49ef3b1db4a40, 0xed69514c34d6dc12, 0x4c4133063f518bc9, 0xb1f99e330b19f0ef,
+	 0xd4df53199c50307d, 0xc911bdb46e4926a7, 0x10e7f836fd7f88ba, 0x2d412efe91f36eb2,
+	 0x0ac3831974376d73, 0x1b297a718b5c7b1d, 0xac923be14ba4e998, 0x342075d4f1c0b9ec,
+	 0xb715de63ccd80de9, 0xf8edf8d78c579ee9, 0x6b1132ccd5048764, 0x278b857e0c9aeef1,
+	 0x4bc5d8af6685d11c, 0xa54492331cdf18ff, 0xa91831fa1f4a1718, 0x5d6f1e0c633b5359,
+	 0x72757ac0b8df25c9, 0x5dcf099f6ab1cde2, 0x3bdcae7d6397c5fe, 0x2a807c0310d17fd4,
+	 0x331d5cfb42ef1fb5, 0xf7423e2f7aff313f, 0xdd189924b4eddbf7, 0x4cea34fe5445e221,
+	 0x7aecc1bec886fa6e, 0x8984b3cf41d85f92, 0x8a6c442bb04d8e81, 0x5ce0807c0413b9d5,
+	 0xf2ea41864c45b6b9, 0x2dd5e17e1c3f5278, 0xc16a9d6913c16284, 0x5e7fe7e87a8205ff,
+	 0xebaa8cfada1b6e6e, 0xe435652890a16d9c, 0xbe8e6f558ce2dc1c, 0x40ef31976789fef7,
+	 0x449df90f15638ad8, 0x72410c00f898ccca, 0xe2850f0660a7d69e, 0xa90168da3dc223f9,
+	 0x6dc04d5946ad1c7e, 0x96fc96dad8b96bc5, 0x7940692aeeb5816f, 0x6de21b736a7f7842,
+	 0x0029e89d2666b9b5, 0xfc70b2759951a8b2, 0x20fc062cf8a10b11, 0x740ab3f262f7dc81,
+	 0x19a5515d107abae7, 0x78492dc275ac9400, 0xaebb47bd77204989, 0x3e22bdea07efce65,
+	 0x0c1f6042729c0f00, 0xe3fb0f015bfd7656, 0xba972208bff16c4c, 0x6e1c30bc1d066558,
+	 0xaf679ebe63cb6a99, 0x8e8ff0a742275389, 0xe04b49463be2b7eb, 0x0425ca0440fde523,
+	 0x825c07416e064af2, 0x37b4752e5510be5b, 0x5bbbbf06ab41383f, 0x25274d2260bc705a,
+	 0x1ed395704cd82c06, 0x420d89603cbb4c20, 0x796a09c295db6f4e, 0x709f6e154c07dbb1,
+	 0x14e3e7af57449f75, 0x43ef2dbff5941c4b, 0xf4f473a3ed16ed75, 0x08746c95e5773bf4,
+	 0x6acbefac9a02436f, 0x0a5b45eb27a96219, 0xfbc87357d4f191bc, 0x20655fdbbf59f0ea,
+	 0x70bb4f3c27a8da56, 0x7924762f67bad935, 0x95fe24441fe63b0b, 0x7d9d699805e0e0dd,
+	 0x5b7cb28f9513de37, 0x491412a319f4c717, 0xac7ec8f37acca0a4, 0x0cc8a253b665f24e,
+	 0x835e6ce8597e451e, 0x085fbbe6d9f43cbb, 0x0b24ff475385c88d, 0x6b57f9790cbcc2be,
+	 0x919633199fb7e75c, 0xfe87e2141f921518, 0x830bfa495e4ee680, 0x5e04f1a7bd036729,
+	 0x0ed271b70d61a6c6, 0x588ed5d8ae980972, 0x71647e11a3121de4, 0xaa32d843369947e7,
+	 0x3c530a50191739de, 0x2dd90b6995752b5e, 0x2b6cfc45777f48e8, 0x74325d8c60c87720,
+	 0xa186e510621f81a2, 0x5badb147e25c30f7, 0xbe2281b54515d8dd, 0x79951557823a2cce,
+	 0x404fdcb912ba6c85, 0x6718e4cd98c14da3, 0xc6b108ad23c5fe1e, 0x45145b3925c8777c,
+	 0x4db591e92d35bbce, 0x1cee160c51691bc2, 0xb85725dc77aa0a19, 0x41ecc7bcf6fa2f57,
+	 0x5b49f1d5e2bf65b8, 0xb84762c12ccff911, 0x4b934214768ea1c0, 0x9199b511b5ef8232,
+	 0xb53ef986e7c45d91, 0x035193845769fc9e, 0x42caefcd47fe1f02, 0x827fc8540d8d6f88,
+	 0x7686fb69a4757d04, 0xb1e3bfc73c70b566, 0x1bb70bb72603f047, 0x6e7196b4c0041f0e,
+	 0x32ee6dc7cd0caf40, 0x99ad3e94b12b0499, 0xbbbd3e3837f5a742, 0x57c07ce105202cf4,
+	 0xf6c4c058e28c87c2, 0x8105d833207ba0d9, 0xb9150e4999a74406, 0x247dfe8f2c7a5347,
+	 0xf7838e97ea18478b, 0x2cb5fa8b0650055d, 0x6adc8c3d815f274f, 0x950d744fa2c0bd7b,
+	 0x289ba4830655a7ce, 0x71bbf73e693e8f0d, 0x16d83469b12ddb02, 0x7f94cc9ca8fdca6f,
+	 0x9ae95e489b0ba706, 0xa75106b31e4de061, 0xa4e5526836b08f7b, 0x834e0b9f2ec31afc,
+	 0xd822d93050918fec, 0xe1cd3b7d02334677, 0x91cf2c4f9bad3abf, 0x6bd7c4c8a691f67d,
+	 0x0e1a8768143e8a3c, 0x3fecad3c8379d522, 0xb02b44833ce16a98, 0x8cf176259ac6ab6a,
+	 0x8ab5bd3b2e99d5c5, 0x6785b13fcfd0725b, 0xd8db0f1c5eac7c21, 0x5a44299bc71c7257,
+	 0x94c694ec8acc3e0f, 0x68195983f24edf96, 0xb89f518ac5f89345, 0x8450c5022b9d97a3,
+	 0x5c3990cd6551eab5, 0x83bbb1fc3a911089, 0x0c02e0976baf32ec, 0xa90dc1884072d328,
+	 0xdcd8d62b9d0abcb9, 0x23233d414aeee11d, 0xfb439bf9d3f1fb1a, 0x9ebbf9102b923f10,
+	 0x167ae0ced09683c0, 0xc8a426c835fc7673, 0x35d9beba006fe3b4, 0x2aa5309deb6a063d,
+	 0x27c1f06ad2c4f939, 0x9733a60ac01df8cb, 0xcb33dab2e55d21d9, 0xab30a23b8918c7d9,
+	 0x331cbc743c8535df, 0x751ce5a1c936449e, 0x6a7e01723c740089, 0x1e4f662ce8deedb0,
+	 0x964f1377b6f2e414, 0x00bb4ea3af13c92f, 0xba64aa00d8f94db3, 0x1aeb8e906648c95f,
+	 0x39c26750eb9bd42e, 0xf849fa1f7fe39150, 0x36e956c2e3545b6f, 0x7114f3c7a2fb19cc,
+	 0xfaf224c664883ffd, 0xd452e464d6848957, 0x98d792a51e9f90d5, 0x69dd4d0dc9c1081c,
+	 0xc9bd17df4104b4c1, 0x7f89d409500324b4, 0xb352b7f12306f90e, 0x0ea129951b627969,
+	 0x17d9a58ebb2899aa, 0x63573fd12ae88441, 0x1680f4936295653c, 0x5e33c2e4f336a882,
+	 0xf56b298c46874f20, 0x568056b024ccedc5, 0x45c9dfa99b9a58eb, 0x547b6e09ee8f4897,
+	 0x925c306bcc76712b, 0xc15180b29740e34c, 0xcd6d76d5fab6f198, 0x8a2ecf3019dec10c,
+	 0xfc331db66ec3220e, 0x5adc9d11f99a9ad2, 0xfece3c09c38b4a75, 0x79a5da3e208c5ed7,
+	 0xa92d1f198c89dfc1, 0xc7e4904292655c3d, 0x3a3107023264bc2b, 0x7b3041fb9cb194f8,
+	 0xc955e43a515e3a1f, 0x660bcc746df778a3, 0x350c915d473d10cd, 0xa40ebdd1dbf2e167,
+	 0x3b57456900b1ba87, 0x9cf74c96ec904e51, 0x72bdccef347d0649, 0x2ce52c9b8e1a3934,
+	 0xcdecdd6c18d9db80, 0xe1bfea2935736e01, 0xa2ecbbbda4108ff9, 0x950b0ad69fca3b2b,
+	 0x4093308f7dbcebed, 0x07ed70fb263b97d1, 0x2fd11eebc9daca87, 0x879587a2d7cc31f4,
+	 0x4700b12e562ed68f, 0xc50e1e211ce01708, 0x626d329edf1c555e, 0x703eba0ed3f4eb98,
+	 0x713d13bd978c73d5, 0x6280d71a516c3ca2, 0x25b1588d1ade878f, 0x9fefac90b38acd69,
+	 0x6cb7cfaf237c8f76, 0x50bbafc62f2b357b, 0x6fcff3b3341d51a4, 0x7025dee660312233,
+	 0x9b61b983f9534bef, 0x8985c482c4506d48, 0x8d050aa3688b288c, 0xa9d5f817471307a3,
+	 0x29d5edd6a0bc122b, 0xdad3517b7191a8a4, 0xc3dfc34e79582798, 0x0afca9854df28787,
+	 0x459d79d00efb6c07, 0x17761ddb066bd085, 0x4832bcafd7a8315a, 0xae620e689ca7f50f,
+	 0xceb8e03250fa67bb, 0x9aa2bac773d8a301, 0xa6e68c40de502d70, 0x9e3a3f9e8f55e876,
+	 0xd1f4cedd26316917, 0x3ed84b344a602614, 0x741411cfbeef48d0, 0x465c9010f68ea7e1,
+	 0xa78c43b64f5e6d3c, 0x1fdf511ef9d149f6, 0x7333ec9e54dbbd5f, 0x030ef5848c0f6261,
+	 0x0f5113cec17a831b, 0xf7626096f00399f7, 0x122d372a74ef4ac4, 0x86d15639fa1af9c8,
+	 0x5704c7230211cc59, 0xf15e8bba803fb21a, 0xff82ef2107b96a19, 0x7f5749d7c1f17a82,
+	 0xe1572bedbf518748, 0x446d93d2cf7599a0, 0xd29485f560f77001, 0xaf2214c4dc4abfce,
+	 0x30cbd922943bf458, 0x623a3ecc46ffa8ed, 0xe1aa988a7fe9baa5, 0xaf963d8da2f66abe,
+	 0xaa4ae182f21f8c59, 0xc4c676658229109f, 0xd6f14dd8296257ef, 0x3fe2f6b5bacb70e2,
+	 0xc225d360be0c9084, 0x152976c565e892e1, 0xe36e23fa908dbc15, 0x4ec8cd846d479354,
+	 0xa32c98c146c9dc08, 0x3c38a0c06cddf9d9, 0x3f0a6b42599e069a, 0x296fd580638361e3,
+	 0x5b1af0aab0fcea1e, 0x011ba96d322f2684, 0x03055b77677c60f3, 0x411f51c6aafb1656,
+	 0x3fdc0101517af721, 0x6fac24670f11a4d0, 0x890c4fbd74ac5cf0, 0x8002762e5b560fae,
+	 0x4752f591789e72d8, 0x19c97b4989f87047, 0x18a350b2ae045d6c, 0x5fb39e46a80d7f7e,
+	 0xdd816e0ff7a264ab, 0xb723243a9e31398b, 0xa6940ef92cf3f680, 0x79c8e74347b7d980,
+	 0x41552117925b1825, 0x6c125e8731b3a01a, 0x2552dfc054764f30, 0xa64414feb484afcd,
+	 0x038ca6accf568f62, 0xf3de6b5e823f376b, 0xfb2d9729537741d6, 0x4eead0204f0dc928,
+	 0x314ef3ee26a2cc70, 0x3b250326970f2c77, 0x0ed3e3eb1c79b20d, 0xacc3f2f0bcd552db,
+	 0x611106c6c99c75b5, 0xfb96e89dfcadcb00, 0x473a4b245b80cacb, 0x835b0dcd2debb652,
+	 0x15bf696acbdee71f, 0x6eec0bfa5f07c1d3, 0x548524db6645515d, 0x8a042a0a8443f4cd,
+	 0x1f170a4f1d6688d9, 0xe2d37a74dbb626d5, 0xaeffff57e231051d, 0x247f4f9cf31b3972,
+	 0xc4efcad2215c508f, 0x5be3b1271daae8a1, 0x19c234d65c10f4bc, 0x67844407ec15e7b8,
+	 0xe079d846aaf83d27, 0x66a3d6c7502cc3aa, 0x12c15e83b617060e, 0x088b7b346e2547c4,
+	 0x9c75e994c1542d50, 0xd534a20e8b675e6a, 0x31aa15dac7c23f25, 0x31a8b4c04b6dcca8,
+	 0xbd5e8bc84e342644, 0x482ead7fb01eec92, 0xa4664bb07a1020af, 0x8f1e34c88f09919e,
+	 0xb21900a1c3505db6, 0x80a2688015858076, 0x20116e8eadef32a8, 0x5a9e9dc3ea22e6d7,
+	 0x40a04de50d048dd2, 0x86b2508d4d2494ec, 0x1572c86c544880f1, 0xb0cd68e52d123f35,
+	 0x91f3b78ed94ee486, 0xc4bba2db578f7a56, 0x5837978801342830, 0x3af18c2504aaba14,
+	 0xfcfbec1b715bc183, 0x46f968b226502fb1, 0x72be5f3e2d8ab659, 0x0505ed736f3b0b50,
+	 0xc15a3a5b19983e50, 0xef7312657dcaae32, 0xbec3dc5b6c80f092, 0x6174ea9001c3284b,
+	 0xb755cf46724d5553, 0x86c23cb83dd2b87d, 0xe3d6061454998fee, 0xa83041f38ebdd5d0,
+	 0x7c62a3a3e59f7277, 0x801fd755becd5477, 0x8506de8565b2edee, 0xb06fc725f06e6771,
+	 0x79d82f1338e1f0b7, 0x6d2a9c520fdaa3c2, 0x82fef2fe53170a15, 0x6cea4927a1bdc2df,
+	 0xe950b5359435b835, 0xdf0e1f8d988be844, 0x880c3dca525cccea, 0x2abbecdaba3820a6,
+	 0x4b373baeb2e0e255, 0xfa0977e37fed4277, 0xae2bd743d1ef3fc0, 0x3b7a9ac3d57aaea5,
+	 0xb9256432096c29ad, 0x7cf7187b7b93dfc7, 0x34d1a5d74a5b7441, 0x8526e6f386ed6332,
+	 0xb494b6fee1c33baf, 0x57512869609b70ef, 0x26ac8609f4bb4e88, 0x8e5dc0e32f3a2610,
+	 0x70117e0f460e307e, 0x92bbc6c2f4c5177d, 0x2c2938a5c5326a34, 0x3429f99b3d4a2dea,
+	 0x9097ed4c6f20a292, 0x7649c2312cc60ea1, 0xf307985cc2b966e3, 0x5a77c063bc373246,
+	 0xa184d508ab484354, 0x7450d33cb0d9c798, 0xbcff897b412a147f, 0xb2e64e1f8c2d6fd5,
+	 0xd9bcc1d52fc6e4e0, 0xf2de2446b13b99fd, 0x41e8304f6134ad0b, 0x804d6339fe124ab5,
+	 0xc52dff4747df2f81, 0x4f173dbaca5342c0, 0xa4bff296414464e0, 0x746a93ff69887ef7,
+	 0x8f76577dbd98e6b0, 0x43a1abb513642512, 0x4272a1362c287ac8, 0x67fc219e5e4244df,
+	 0x3b5ab1946a985aca, 0x7db5e96ec92f6ac3, 0x69b84249352dba32, 0x4f8bef1dbab16a64,
+	 0xed3e2d10873afa07, 0xd44843552e70a09a, 0xfc5bf51d691455db, 0x0604991b8d3dc794,
+	 0x3c739d543ce869e1, 0xe9103379ce644c6f, 0x70433f7d7454c5e4, 0x6efd3eabd591673d,
+	 0x08690f5e6d4ccdd2, 0x8319eded50674ba5, 0xd4d7f682e1b7d8a8, 0x807d41be8d6b6be0,
+	 0x864c9883d79d1daa, 0x38263e4a624d1544, 0x19fb09eda967522a, 0x86779a4fb8947123,
+	 0x7a573900955850bc, 0x9f2eec24f62854ab, 0x118a694e5be1a7e9, 0xae5233f4c823e6ac,
+	 0xf803158c693d0cf9, 0x80862f738efcd5f4, 0xfa7fb2741e402b2e, 0x98aef209c6eab8be,
+	 0x5ec5327f1f758060, 0xe34f12999406b9bb, 0x063614c3181f7f7d, 0x4bd0aeedad3046db,
+	 0x868f4985e8cea200, 0x3da1e09007c425e5, 0xdc4a210aabdb6e3c, 0x078b1ade5a6c6b38,
+	 0xc3badfa9b03cfb43, 0xfadf40d5022ae2cc, 0xb06c8aad77ebe5cb, 0x33acf44e7d8b30fb,
+	 0x901d5c6e185d18b4, 0xd401eb07a5654cba, 0x500eb564dc3d79e8, 0x3046cfc54c14fcce,
+	 0xd98ef185c3025f2a, 0xbd1ba23154660eda, 0x7c34b2abfe2591c4, 0x7ae2a823bb33cf5e,
+	 0x79e0ed251c47a0ab, 0x58dba1ffad090c62, 0x8d65eebd8d77cb69, 0x802c12a207fad9a6,
+	 0x5f516354d37ed3ac, 0x86fea5720e30c459, 0x8284fc073c353000, 0x26b748411f3e792f,
+	 0x8550e81b49785cdd, 0x8e048578b984c40f, 0xe1f0aa46b20a6211, 0xa6f104a517c88d8a,
+	 0x79e578e4e0d63f0a, 0x468c02516143dac4, 0xe31d59862990f8e8, 0x5b46a29a7385d45c,
+	 0xce2695e27e12d379, 0x66f85af3663597ec, 0xd26d24673bbfd9e3, 0x39abd50faccb1d9d,
+	 0x02140f820c487e4c, 0x80a80939d29c56c0, 0x2201a148d4c17850, 0xad4b93102fef7efa,
+	 0x615b578df8409faa, 0x4a4ac56d02197dc7, 0x69f0fe09354ff1e2, 0xb5d28994515bba8f,
+	 0xdc23754a455e1cff, 0x5666f2df54014c41, 0x85805e8403d45509, 0x31b770df8e64b97e,
+	 0x6f678e0e61a749f1, 0x992aa12fef1b08bb, 0x289b58a48d44b9de, 0x77d9982b3234cc8f,
+	 0x7c3013a23ad167ff, 0x816041f3928abb83, 0x2a59bd705d8a7da7, 0x7eb5f6d5cd90b17b,
+	 0xfca0a069423eca57, 0xa7f964522ae8bafc, 0x71b32a6c250d3b3d, 0x815a27dcf6145e46,
+	 0x74e1bc0cc9badd0c, 0x0ab8ac9e3e7c464b, 0x79bf0defab645ae7, 0x06bbcc1ac53d1442,
+	 0x19ee3f94244ddcfa, 0xb9b7e4247116b3a9, 0x74ad376c197c4a48, 0xb3ed50e0d45e24d0,
+	 0x0796783c3561a568, 0xa5affdf85ef3f58f, 0x4f8d6530f0221ad5, 0x65f23fe5abe986f6,
+	 0x712dee6a38e15909, 0xc7a61b89d77edc75, 0x221fec636b41a7c4, 0x36f8c906a2ec9b87,
+	 0x2669c8efa40a1d6e, 0x6dd38cd886cbbce7, 0x0933d4761f0df366, 0x2649754c2eae92d3,
+	 0xb609be00e026f17c, 0x4fafa96c2c06e613, 0x52974ee89e30b2c5, 0x7a7d8d2d4b870aec,
+	 0xb72b6ba7c56926a0, 0xca67038c5a0feb49, 0x14c6bae0e0c38ad0, 0x914f58ce56b3a54c,
+	 0xe787021941638f43, 0x1ca2533ce4dbfae8, 0xca9985396b02aa3d, 0x8ebf02e5ac809e72,
+	 0xfbab24b1bfa3ff01, 0xbbf805768b578dfd, 0x58c279f654a55f4f, 0x11ec3a8c0a6b50fa,
+	 0x3bc36291f0d9da16, 0x91e0fc152f76503f, 0x1a0aa877eeac5c32, 0x76de2616b82f860f,
+	 0xf688fe2c56f3d5b5, 0x1051bc2f16d0aeb1, 0xc53f0f9e97a87a1d, 0x957ac285f19afbca,
+	 0x21b4ed14bda502c9, 0x424ee91d6368c401, 0x6ec271a9ac189c5f, 0x4a992fb755c4cd08,
+	 0x70070fddaa74bebc, 0xec461a73ff90f275, 0x6dbe576ebc4733da, 0x6fe006ea642de7a3,
+	 0x19498686b39154ac, 0xb97b61ec0d78011e, 0xcee008a9ad557fb9, 0x6b31abc61264503a,
+	 0x19b097cc2e5c33a8, 0x68ded2599537731c, 0x061645bacdfbbf68, 0x4e3224f3dd2335cc,
+	 0x2d1ba36039c4d71e, 0xa17b824d6480630b, 0x3c034082d9ce588e, 0x9a75d446a6e1be03,
+	 0x6e9a0d65cc04ef44, 0xa73988cfaf2369ce, 0x6eb02b17f358298e, 0x6d38e4742971ad26,
+	 0x7d4f825325289d6e, 0xb709b062702fbef5, 0xb883aad84bcbdb30, 0x8df663929fb4294b,
+	 0xdd1916faf75389d9, 0x87cc3afff88ca8fb, 0xaeaf4b805c2d5572, 0xa7a36b4f7ad2609f,
+	 0x7d31389352491f86, 0x77f84da3d7f4c788, 0x82183ffc329e80c9, 0x8d06ae6039b4104d,
+	 0x3c5959da73de73b0, 0xdb6b60cb476ea24b, 0x588a99dbcd981766, 0x5754d3a47095bad8,
+	 0xd2d88112382f4fce, 0x3cb2101efbdeb639, 0xd9d6b8d199950400, 0x3c64a6f5581c00ed,
+	 0x48bb18ff518eeba3, 0x8e2a2001199b95c2, 0x223b3016f00d1912, 0x3c67f57e84bba3d3,
+	 0x7cec1668968fb71d, 0x48ae7eb5995de5df, 0x129976c37483865a, 0x237480bb678725dc,
+	 0x99dba151bdb3e945, 0x2a526a083a29f7a6, 0x3d8e20537b82a6e1, 0x9a2d7b2c64849f91,
+	 0x810efedee00edd8a, 0x522cf2cc14dabefd, 0x2a696d2e5b8ba7e2, 0x9417f6f0cab1ce21,
+	 0xff833e0ecc9313c8, 0x4e7248bf721705bd, 0xb9e95ac7ea945e9f, 0x3764da187c5bd0b9,
+	 0x7d7ac0a5e1fc71df, 0x724a064dfe93c225, 0x1a7cde6c7ba526a7, 0x774c19a91937b740,
+	 0x43e4f155e019ccbb, 0x29f226b955cb06fb, 0x8a1b7385897b2595, 0x750fcfd3d76e20ed,
+	 0x35bab118a288e1ba, 0xf8e7ebb2f079f848, 0xe634ce7ffe7e1cb7, 0x4904ca77b4439681,
+	 0x0bf310ead0559308, 0x42b4e75973bca429, 0x24be4e2b5e48efb2, 0x3e5f4ff74e77651a,
+	 0x96a7c03520d8d555, 0xc8fe855a30972f6e, 0xbc16d589ae2ea763, 0x6ff89c6e5ae31f2d,
+	 0x227234aa0b9ffd7a, 0xbe0b3eb551217898, 0x5731be9e257efb27, 0x3b80e634d63def0e,
+	 0x7b18d0641fa8da56, 0x7b3b75ed85ce041d, 0x40c04d5663b193b5, 0x63c701c38d2ed74f,
+	 0x2757de807639767c, 0xd291b044c9c944e2, 0xee3afb7d9f4bc4dd, 0x7af93ebb1a852137,
+	 0xeea5053d6500a3ca, 0x92acc4bd02e51125, 0xf0a3a6c74edf4920, 0x550626307ef8d9fe,
+	 0xf15d7142157390f0, 0x2c198ce4122b1c97, 0xe3450523ca323414, 0x34728fd50dde9183,
+	 0xea1be5e6f09c1844, 0x37f958f202aac6d3, 0x72b1df604c0ba18f, 0xb566f9d8f8d67bdc,
+	 0x4ad933cc09900704, 0xfaca929d748032c1, 0x6c71119b1c571c25, 0x04b2af302ea9a6ce,
+	 0xc5aa67bd0cb52006, 0xa44a42eb0d242ee1, 0x2da79fccb5b57325, 0x2735b7c57c51a159,
+	 0x8f05874fcc85e872, 0xd033efcbd07d2b76, 0x780d1ec45a324014, 0x56fff93036300b10,
+	 0x1496582de21dd48a, 0x957e6098c03da7bf, 0x27978e4cb99f0750, 0x04cf881270cd940f,
+	 0xab891b7558956c9a, 0xcd22aaa49ff395ec, 0x674680f800b114f2, 0x2c900bc52ef5c9eb,
+	 0x9b52ca7341b13cd4, 0x1df0d31a88154706, 0x2ac6ed968f41f6f8, 0x70ac94a4a8321646,
+	 0x5236133449acb91a, 0x1eb1acdc13302a56, 0x5cd7aef022d0afb9, 0x2c74e19d83d6cd27,
+	 0x03090e373f2ab2e3, 0x7326c54c869623bb, 0xd133e8ea4340e632, 0x5a4a583a58f202aa,
+	 0xa3fcefbdcc09edb6, 0x5ade59b476944765, 0x07b23f657f060821, 0x145730a88c768c39,
+	 0x42c4e15497f49dfb, 0x9da6887e6dcde83b, 0xd7b143c2fee81d75, 0x16a867e504386a7e,
+	 0xc25dc4f0dd38d037, 0xb7bd9c131bf3d4d9, 0x5ff075341adbf7f6, 0xafaed5f84d73f0aa,
+	 0x7125c1d2bfc122b5, 0x582b68f7aafeb6fa, 0x15f77476e233cf1a, 0x7b3444e7c10619b1,
+	 0x78e592a5cd45fc01, 0x1973d41bc7b40466, 0xcadabb66f5f8ffc8, 0x47854114d7108aa2,
+	 0x29519f3346806374, 0x5abad69f2d6b8892, 0x3338538bd9f70be7, 0x468d415107770650,
+	 0x11dd628632ca4426, 0xaef9e8c30b48f750, 0x7e9816f42e934ac6, 0x35ac4079bfe47bab,
+	 0xd564a49f44b0a718, 0xdc6ffd93c71a7dd9, 0x51c3708d58941ade, 0xa521593e609148f3,
+	 0x4c9fcefd9a5b66d9, 0xd07280fbd2c32e22, 0xe7f2b6de342049d6, 0x52f861292f82a499,
+	 0xbb76049de4261d9c, 0x10e4c8fdc47ea2d1, 0x565c91062a176a23, 0x4e009012b929f334,
+	 0x41291c127a62a421, 0xe2c14e829b32921d, 0xe76c60a9504b9ce4, 0x981ce57b179db508,
+	 0x11edc2bc3935df55, 0x9eee0f7616de51a1, 0x8dd086facacc97a0, 0x4ff97cdbfebb1cf3,
+	 0xab71882e6510551b, 0x37dd9a1d54cd76ce, 0xad2408e573a26d39, 0x29893e9fecfadf13,
+	 0xeeadec15022de272, 0x6490cf4aa04d9b33, 0x85c05cf18555d198, 0x49e2207306662bdc,
+	 0xf9bd7de30a5df1bb, 0x96e0213f0bd8883a, 0xf334fdd45503c94d, 0x262222859f2212d2,
+	 0xc7cc49d3efa3c458, 0x5acf0d34f2af2549, 0x94b0d84aca03612c, 0x267441c6fa4afec4,
+	 0xc9450ac8901868f2, 0x9773a2932286093a, 0x5a752daf07e64127, 0xa27ec2f01af0989f,
+	 0xd8145faae3194ccd, 0x8e8579e71fc29792, 0xd5d72ee2bf9794ed, 0x75f824e650f6bca6,
+	 0x95f57ef480a8ca67, 0xdaa58f447a6a2025, 0x4c619030bfdabfe1, 0x32aa0bf211464ad8,
+	 0xd897576fdfac5e37, 0x96ea873b45cfc375, 0xf132a5c70c9a6f86, 0x317028f949e4121b,
+	 0x19d5952f1b4a3269, 0xddaa256edaeb5089, 0x1a5b12562610c3cc, 0x43ef047f32e93198,
+	 0xacc8417f7628c46a, 0x22961744c9401b1b, 0xd2ca3f2b1447e646, 0x8a0f1b387b7a40c5,
+	 0x3022885a38551c4b, 0x1ce1b7e27ea3a818, 0x8838f0bf6d412ee5, 0x2d8b2291619a3110,
+	 0x09d0d9c6db547c32, 0xc73005e62acf07ad, 0x4e4b61e18da6f0e1, 0x90e15702ae7342e8,
+	 0x8cb1c1d3c5ca14ec, 0x41d1579815ac2864, 0x333d7f9026f8d577, 0x30ba4ceb5609231a,
+	 0x62da72cbdba869da, 0x460cf283623bda01, 0xfb5d63dd8ad2f882, 0x02e377306036b04c,
+	 0xf448f31118b7bb1a, 0x7cbcef0531c1bc08, 0xfb4848eaf1045b7f, 0x7aafafb6808451af,
+	 0xb2becdb4462b64d2, 0x1a0536c626f4366f, 0x036bc03e20bbd96e, 0x09057a51d83d238d,
+	 0x17214aaf1f54cdf4, 0xe6605f94a898e58e, 0xd9853f4021954905, 0x79e16aa8d1880025,
+	 0xf4a5e6ff9840573f, 0xab2d6ad30a3b88a1, 0x301cf1df0eab2ff4, 0x6a65df46d2a12856,
+	 0xe4d502991412ab51, 0x61e8192d0c671e00, 0x851d67d4cd87a749, 0x779599856c85e71a,
+	 0xf26360c56c5b5012, 0xbba7b64255f07394, 0x643a09b52672f291, 0x7a20db794b73c1f3,
+	 0xff5f10badf7e3a2f, 0xc3bf83cc84b0bb5e, 0xaada0b95104e7a41, 0x253d152c94e189ec,
+	 0xc7bd06f44c0fa89d, 0x329493da6d7ec721, 0x3dfa687f200896a5, 0xa776b409105e54bf,
+	 0xac5f311bc59c67c4, 0xa1ae8bb99e7e4440, 0x0831d00185b52a5d, 0x891ecdf7e8196ea0,
+	 0xdf997ba6c9ddda61, 0x634f746a12179d24, 0xc95617de1adad591, 0xb2846fb51e6b35db,
+	 0xc8f6c99cfd36e936, 0x330eb710175e1e30, 0x5aa64a576ab8d441, 0x98419a5d489b731b,
+	 0x6acfc6686e6b1d48, 0x0fb3c10c7539dd96, 0xe4b9f8584c60e24d, 0x6eacc579fe9e4e89,
+	 0x3ebed72aa5a7a4a7, 0xe6877d4f8245c214, 0x10a41ad45eaf2240, 0x064f98f83461c486,
+	 0x49e4048b50d7cbf3, 0xd2771d95dc8fa1b9, 0xaa05c625d9f543d8, 0x0196f2649becf31e,
+	 0x0180d312a71dcc59, 0x629c366f857f3981, 0x8d04d84f7be82ffe, 0x9cab676d35e52dd8,
+	 0x7cc3f168c85b3c8a, 0x845c7b09cdbc4d03, 0x1f34a30a6d3ed6d1, 0x4cfdb8f0849593b0,
+	 0x99c6f023c675f25d, 0x78b33693136d8775, 0x7a20d101d98a4be0, 0x69b06e775a7013c6,
+	 0x0afab3f1cc5cdd23, 0x618d722ee9735789, 0xd8d049b203ef60fe, 0x67a6290ef3a3de68,
+	 0x595b82dcbdb9ef2d, 0xaa48d68bf0372def, 0x1c1dbf321ff19f25, 0x73011ad9fa8ed042,
+	 0x3abe88594e99a597, 0x22103b92047687e9, 0x1f9fe8e0b607cc0e, 0x083aaaa4e2a7e1b3,
+	 0x3b2f9117d43dfee7, 0x239574e363827311, 0x462c49c3528f48fe, 0x45d42001950cbc5c,
+	 0xf2ab7dfcc882b404, 0xd299573a7bfd2156, 0x2bdc517905d7276a, 0x28ba6f19a5bec727,
+	 0x3bc1b8f4f6af034c, 0x1680713936e3a3ff, 0xbab0f05614f445db, 0x3779a2a462ae11b8,
+	 0x7cf26538e16aae45, 0x7bdc10fd53026a98, 0x87256193d00a00df, 0x3eac4642efe2d48f,
+	 0x8eef99a4f19cd214, 0x37fc39cfe08f39a6, 0x71614816ad36bfcb, 0x6f5cf3a8ebaa8c28,
+	 0x3cd038a5f9e96f9c, 0x9b3477e1073e3bf3, 0xcacd2633ee39155d, 0x8e59024dcca919b0,
+	 0xb11a9fbc53bb0fb7, 0xc3e96534cfe2ee88, 0x1506d01b192672c0, 0x584b893c60580acf,
+	 0xa38dea1a4b519c3a, 0xdadda9a781251782, 0xd0ccc17858d02937, 0xb33ba5e9ded99dae,
+	 0x9ae7b7ea2a6b5f56, 0x59a5f119ba2fbaa5, 0x52e75def6367c894, 0x87024884ed96f7ce,
+	 0x8d9956064213fb55, 0xdbfa88d44ca238c2, 0x54d54c275fc4669d, 0x78e56f3b78059f35,
+	 0x512166e7d009e29e, 0x421e34f0a9d1b4ce, 0xd3fa7ff8c8070b31, 0x7ec313ae5ea37c34,
+	},
+	{
+	 0x6ee0916e2e20b368, 0x3a33dd418abfabc6, 0x4e3ab4dbbee149c5, 0x716a5cbde81025e8,
+	 0x8b98a11b9a99bdaf, 0x8fdeb37b1d4c72df, 0x199c5ecd397b567c, 0x4438a1cafc7cc2d9,
+	 0xef5c51c82a87b6b2, 0x5260baefe236073a, 0x21f5d39d3107edf8, 0x6c06682400a15813,
+	 0xf84873002d974be1, 0x52ec602f2e8bc3e8, 0x5fee4719487e1526, 0xb51b78add33e0722,
+	 0x78131efbda694fdd, 0x489b58501b3f267f, 0x43272d9b6183bbf3, 0x856c423e02e8a964,
+	 0x7536c8f9f621501f, 0x1fe2e42172131bb9, 0x6c3e130eda9082e0, 0x4b23824b848b59fa,
+	 0xe435237d7a214cd9, 0xee6c12df54a5b7c7, 0x4363bad2e56f0bc5, 0x65bc49f33f81faa0,
+	 0x5edb6d367fbe20ce, 0x8088cd300dd06034, 0x409a61722ede1fc2, 0x91bfb2c63ac87f5e,
+	 0x4e77a3b53c8aa21b, 0xc36198d80e915749, 0x149ee63042a91ae1, 0xb4a6c38d0280094b,
+	 0x5bfc8961f1d72987, 0x14ce0bb059c8efc7, 0x1049ba348a666970, 0x4ef8591e40af77fd,
+	 0x086abbd0f3dc4b1d, 0x88b56a6c995f4f2a, 0x4d9f3205d6e7d262, 0x246236e31c25f962,
+	 0x259043e6d48a6fb7, 0x89f870157b87efa8, 0x529969103931ad2a, 0x1a1c20fb7362d7b3,
+	 0x167b34cee6b5973a, 0x50a2a9d5a36c5fbc, 0x7a8974bd0dc31a2f, 0x2698063fbf14d292,
+	 0x01e1a7f593c4529a, 0xc540b36754b61a2e, 0xf927f9b8baf51cf7, 0x7a460518ab3efd99,
+	 0xfc6c62c5be7fd552, 0x12580ec29c335786, 0xf793656b485fb91b, 0x88c593a5e832182c,
+	 0x367b7d87b0a3c96e, 0xe2f2b85edbacd205, 0x7e6829b85952bba6, 0x9fa78d95c04627e9,
+	 0xa647894dd03ea037, 0xd020c1a596bf53cf, 0xd3c945c03fde923f, 0x1494e7aeac353031,
+	 0x8a0cbcf3dc6c6a51, 0x649c6098896b20d3, 0x5eb5396b58965056, 0x2b9546296fe3f25e,
+	 0x1af3b2b81f3e7b28, 0x44a2cbeb1340bb59, 0xc566a3135046b9fc, 0x92fcd1bc9c92e8b9,
+	 0xc07f839f73998c27, 0xad86b9a874edade5, 0xb24ec7e6530f6f7d, 0x3bac38f7d7158acc,
+	 0xe90a02a635e81de8, 0xefc969a656200864, 0xb37e7373e2459ac8, 0x9beb6cedfae5621a,
+	 0x53045e18be1c5803, 0x057b170d0fb35b9e, 0x51ab655c69ce0916, 0x534fd49bc0b65d34,
+	 0x1d7a600a9ed77d7d, 0xa09e5ca1b507bf83, 0x5fe388e882d16dfe, 0x7d5c8ec2762dbf70,
+	 0x7af38dcc6355cfba, 0xd190cdffb584917a, 0x03e081a4ddaefa6c, 0x0929ffad7a351931,
+	 0x09c86a8adb26976f, 0x93f0ea08de6ffd93, 0x9c6c6f96746af090, 0x21b176cc54452ca3,
+	 0x275ac075c9392bbf, 0xccb7a44e78e3700a, 0xbd120912215a49c2, 0x862c3f5d540a4563,
+	 0x49c2c27fb3f4dc6d, 0xe701a54d4f118f10, 0x6754aab9943a5562, 0xb520e595400c489b,
+	 0xe5db5f8693d646ca, 0x83bf928ddec23365, 0x3b028ec4e8f68fd5, 0x73c314157144f40b,
+	 0x6c9a95c6b8173107, 0xc6b1b93b099e5baa, 0xeb88e41fbe0d2d51, 0x00c3ab80928c035f,
+	 0xa4fe0c828bb6ce3d, 0xddb6926662035a0f, 0x115e819aa0981921, 0x6133edfab36d8402,
+	 0x87460da2a8111ce9, 0x9a1111223482b179, 0x598e6407ec863e78, 0x31a1ba300f8b4768,
+	 0xf68e16ba241c98ed, 0x35322ff13032ef56, 0xfa6b1f11bbbc6744, 0x9fe58a278e89fbcd,
+	 0x95f6b19ebfe90f7e, 0x39064c617eb6def9, 0xa06dfc05d80de468, 0x8673fa004bf0a5bf,
+	 0xd523602c9f3c21af, 0xa7a5edd06f0d406f, 0x2e68a65053195057, 0x1e59b4beef34129a,
+	 0x7d2799343523518e, 0xa8bd22fada0a67e6, 0xe356c6a1c1f7f8a2, 0xafebad12e7133218,
+	 0x589fa481dcf672e4, 0xf69677fdd5009e29, 0x7c9442309bc56807, 0x968ea3574845c390,
+	 0xea7835bc1e547733, 0x4ddf00467d78649c, 0x7380207b53e06dd4, 0x978959b3cdd4514c,
+	 0x27a2a0dbea727228, 0x2d878f4814ddb59f, 0xc0854841b9410688, 0xa6e1264c34ae8e7c,
+	 0x21e9b8818ae776e7, 0xe22fe1cfd769348d, 0x146b9b4126d5b42d, 0x3e91704c46e91092,
+	 0x81f9dc05ba91023e, 0x9a10d1e28de6e590, 0x2cae2e3420373854, 0xaaf2af48093f4aed,
+	 0x589f2d64f32b69f1, 0xed6b9702fd9b5aa7, 0xd124c23911daf374, 0x92239cdc09f28ac0,
+	 0x45ea1c8719358881, 0x4a246869190cdcf8, 0xcb39c7c8bdb888a8, 0x2a2b143c3ebdb0d4,
+	 0x3210da993a41694e, 0x52de5a2e810ce3a1, 0x8bb2a62374b61f45, 0xb5b2805e84dce9b7,
+	 0x391f4216d724da0f, 0x99788ba47f445d38, 0x1e3a54e294bf606a, 0x9d8bdb3675dac07e,
+	 0xaedb26d134a5b4d0, 0x339d922f02e59ecc, 0xbad8b5b8dd3e6054, 0x2da252d59039fabf,
+	 0x70200861583070f4, 0xe73555508104488d, 0x5d225a38dfebdcbb, 0x150f5056a15e9ce9,
+	 0xcab064adb2de683f, 0x3c48413dbfdf5072, 0x3825d001ba0eeb18, 0x516c55e6171c8575,
+	 0x31e29aba0cf2e5f3, 0x3a67ed9434584440, 0xe7c0042cb64fb37d, 0x76cc5a82bdffc54a,
+	 0x1e8b16ed3f796382, 0xda1c357cb5eacfe5, 0x5802607f7c94f397, 0x4585fc696b785cb1,
+	 0xfa5d96d3a7cf67db, 0xff7c54f6957867ee, 0xbae033749ac3ed99, 0x9f271c73305e5603,
+	 0x5d55997e1d1484bb, 0xb90a2e5573c52a6c, 0xdce4c22445e3a4b6, 0x022aa2849db0eea1,
+	 0x15fede8d95cd76f3, 0x3c4a3af246d7d46a, 0xa3ef4722043d9c0e, 0xa71db2279e567680,
+	 0x49d8f6cfb5ad1b47, 0x600e6ea8fefbdec1, 0x59fe436f4d09fef9, 0x503ccafe7e13e918,
+	 0x5d67d055e44a2719, 0xa6b6e0692dcdf6b1, 0xc67744065944c31a, 0x12dbfa573d1f1a06,
+	 0x2a6b3c00d2648515, 0xdb8da1c998533d85, 0xb5db212dd0079d37, 0xaebd0245cd2168f3,
+	 0xb23d52bc1781a58f, 0xb49abf8cb31d72c1, 0x061627d39dd5b956, 0x7bbe7ace8234b4f6,
+	 0xf2068f29c7c1cf04, 0xd2849b3b877d9b2d, 0x185e520057049913, 0x501beaacd608c302,
+	 0x54ee00d397d6abba, 0x08c811ba7b1e2ced, 0x2d7470ce85da0ecd, 0xb125f9a78aa2e65f,
+	 0x1da590e1e121bc64, 0xaa32d5b7b611744c, 0x43ba8eedf4396b80, 0x30f6e8dbd858f344,
+	 0xce62a25ee5f4ec8c, 0x65bb93b2c2dc6b4f, 0xd9198c91072190c0, 0x8084731f5ac8495a,
+	 0x1faaa5cf66d0a152, 0x6219d596634bf915, 0x1fe282ed9fd37ef1, 0x9199c298695f2015,
+	 0xaacd8d37e8829c50, 0xd81fcb7eb96da5fd, 0xce240dbfa7483933, 0x18ff2b58e2647dab,
+	 0xcba3743fd7947f12, 0x48c59cb0025d60d1, 0xadbe953c277da813, 0x7ce86226ca0a1b7c,
+	 0xca618860d9f50dda, 0x8675640a396ba7ce, 0xb0ac93854b115e0f, 0x37bccb4161cc4e74,
+	 0xc0a8653c8a62e40c, 0x975bdef9beb35ee4, 0x7d37ba89936ef27e, 0x8b8585935b0a69e0,
+	 0xd274557c9ca1c38f, 0xc0bcf500129a11ed, 0x012f10d9aacb4174, 0xae2e865c38469635,
+	 0x2c8f33cfa7bbad2a, 0x83d04a3779a2cefc, 0xcff2098559eee7d3, 0x35a194aec8702635,
+	 0x755ec6140e50191a, 0xe2590fe85c120465, 0x617ff30c7dae212f, 0x08e1b265160ba910,
+	 0x7001328bca0c2ed9, 0x1c75bd155f6b05aa, 0x8cae6de22baa6abc, 0x79bfd087dd97c3c4,
+	 0x706afa7cb5d0fc58, 0xf3e936e1a377fd7a, 0x3c620740470396f0, 0x6ff7a6fefc9776d1,
+	 0x18ecdec44c21087e, 0x0a150467c9b4e68b, 0xf5b808d594bbff88, 0x8f6105b4fd5777a2,
+	 0x5b70d1430c045218, 0xfeeb0912533d85f3, 0x99ed97fdc61303f6, 0x2e2ca6fdb8957c42,
+	 0xa47ca3d108de5369, 0x2aeb4ec5d4801693, 0x7f7eca97e7e13945, 0x186041fc62357c36,
+	 0xe09ef2b3a57bc54e, 0xd1a7d85ad52718cc, 0x09eeaa3693ef1e5b, 0x10a166a48481af1b,
+	 0x2cfb343ef0df3ab9, 0x1251c13665a65799, 0xeb0941107983b6d5, 0x210aeea0836d9ff9,
+	 0x87492cbd655db2ff, 0x82182eb95e79e02a, 0x64c035b96d54ccd0, 0x2d6903c110e198b0,
+	 0xaee83fa54219b17a, 0x18ed129e37e24467, 0x393fed66ee97a0d7, 0xa2e37c23dd85424f,
+	 0x74e7d8a709ecef8d, 0xc98e57d5d76c15e1, 0x39eecc6efdd3ea86, 0x7ead9ec6d070a16a,
+	 0x81e8bb80be1f7027, 0x0c09948edcea66dc, 0x829542cc95fe4369, 0x2dc364b02b91e472,
+	 0x2d79cd5f76ac5efb, 0xe2c809bdefde8cdd, 0x1def91664a85d481, 0x1945cdf07cc78326,
+	 0xd5172c007d1ec4ad, 0x77a2de5641fb903f, 0xe4751c9fde40f0b7, 0x1c3fd549cb8947dd,
+	 0x54e4a2765d532748, 0x6bbcd4f7f1c78d4b, 0x06d4c1ad3e2d5827, 0x3c861b521545509c,
+	 0x4ece0f680de89470, 0xf0c0b8010279e5d1, 0xa7f96c49000cef59, 0x0dbb23186dc04c75,
+	 0x0796ac08700ec8e0, 0x445fa2c64049e41f, 0x1c3da5d5ebabbfb8, 0x57007f13683b5fec,
+	 0xf825eeff07a5dc2a, 0x3d1d5853eca0a31d, 0xe2ee8b88f9c6656c, 0x04eb4e737d0a2140,
+	 0x63fb6cda71178d7d, 0x95a210f08ab81c10, 0x4e70d17f1424a8d7, 0x5dc1171b4ba585eb,
+	 0x5d7a23c6a49cf7df, 0x239a9c12f2fbe83a, 0xf590030e65c50bbe, 0x7d300596511eaf26,
+	 0x3e414b9c399ca8ec, 0x9b09cebd5eb690e4, 0xee19ef19433cf32b, 0x8de6ad0c82b06b28,
+	 0xc4f06a2a0b3f3a7f, 0xfceed9801b618536, 0xec056581b3a6485b, 0x2f8ab13864e65978,
+	 0x23e9f1376e88c030, 0x5665b450c9edb854, 0x8814d1fdb6045e54, 0x2ecc6cb0ceadbc63,
+	 0xf9468a12ed9ff584, 0xc2ddbd1e104b7c79, 0xc7ee88f1f255432b, 0x4b1ecee6a3753162,
+	 0xfe5efb6432fe8ec2, 0xb08a83e6707e4bb7, 0xeb0e5fe901269e05, 0xb47c70e8ccca03d0,
+	 0x402b77b21a7523d2, 0xb27e6750ef0edf21, 0xeb6a0f6c376146e6, 0xb17c2330840030a9,
+	 0xf466367e8b168a21, 0xdc870b9a9fec0e5f, 0x6bcb4353e6e55d8a, 0x3b181df33f3d8861,
+	 0x692c41398d84a8f1, 0x61506c9ab204a887, 0xc22726bdaae906ec, 0x7125e409fe5087b4,
+	 0xea8c3a560bfaeec0, 0x027a7180bceb266f, 0x2bd93aab613ff76d, 0x137cb7c8d5c4b6c4,
+	 0xeb2b360338b6e620, 0x464ff4488779f47e, 0x5b8733f8db9bfbe0, 0x7485f655d3029714,
+	 0x7a5919651f4a8f19, 0x47b48be8ee6e7b25, 0x6e3fd9970acafd55, 0x1c5f7fe7a6772715,
+	 0x757881296001b0f9, 0xa9693da366dc6039, 0xa2a93b061737308c, 0x80e93c9b0e4ed93e,
+	 0x90a2fbab259dafa2, 0xdafeb88de6970726, 0x55cb2237b145d6cb, 0x6f0996f69e63bc7f,
+	 0xfec3b954f45aeef4, 0x4135c0c343109d26, 0x61264b34ee973148, 0x0b366d02a646a2ef,
+	 0x3daedb3a88b1887e, 0xf85df26bb98bd438, 0x9008950f1ab4bda2, 0x87fcb336675b4a56,
+	 0xed7650b801ccb18d, 0x16d044acec62b1e6, 0x2b0530256d932cd4, 0x86cdb135c8598245,
+	 0x8811f9c5a37dfe5a, 0x44463e9b9314c435, 0x2c3090444a8b37e2, 0x0b38ca4353157b94,
+	 0x7c9d84b2176e1c8e, 0xfadf461d14e75546, 0x86c64910563dcd21, 0xb30a388363e46a67,
+	 0x888bf0c67ef263fe, 0x0729ba7b0656f723, 0x2e6357fbed7c77e9, 0x5c5a34c6dce5e21a,
+	 0x57c36035de12cb27, 0x57594dfa8e0b554d, 0xe5c405f4b3d77466, 0x2ddc7280af7e39ec,
+	 0xb75d4a13986d9553, 0x699b050b570374ea, 0x19cdc42ca27c83e2, 0xaafc41a0e4f751f8,
+	 0x9ec1974d693b4e9b, 0x5ad600e1e712ec4f, 0x8fe9490f7bcb282b, 0x48a8f0848c76f1e1,
+	 0x3a418a46a70bfda1, 0x3e2a0ae79196de8b, 0xf26bca7482a698a6, 0x756625c99f3900fe,
+	 0xe07be1ff3f7fffa7, 0xa024a4b89c6f2c19, 0xc25c366f4bae751a, 0x9ac2a5de2c49c4d9,
+	 0x716fbd82ebc37e91, 0x5ad03752937e5cdb, 0x88d6e0187cbb5c67, 0x4530da46898d0f34,
+	 0x255d6c9c2e3338b9, 0x658bc4545f9dd976, 0xf4f134b23af6f96d, 0x59891dbd77e89eb1,
+	 0x4b31c24f28622d5d, 0xd895080a60eab2e9, 0xbabde21448b1b208, 0x242e0b25f6f69455,
+	 0x942690b8e35890c3, 0xa4beee04505e9132, 0x90610dd8380dc5e4, 0x8f0c8649c38226dc,
+	 0x599ff654d21ba24d, 0xb66ef6d22c9ba459, 0xcc242b08403ca59c, 0x8585e2b00d13e29c,
+	 0x7ed19ad038fd53d5, 0x0876cbf89660ee42, 0xf9564e7ab6230b20, 0x019097d8d4b22c12,
+	 0x34e2683e4db30e06, 0x9506eb9862ae8a0f, 0x063373b763b8146c, 0x03e35240504af5c2,
+	 0x2768d3c218c0187a, 0x114af91c0c7abbea, 0xe1bf37cb35277d97, 0x19c1f047942f9e30,
+	 0x0217a42e5861c343, 0x1255a1c9e73598ee, 0xdc4669011c5e189c, 0x46677dd721716640,
+	 0xb2e399b34154fc29, 0x28d008ad8cd0d6c4, 0x414b603e8c1ebf1f, 0xa2c26b8bef8ea51f,
+	 0x866bc5184b6030f3, 0x9863f017c8c0a1ef, 0xd0e210811ebb2ab2, 0x61f6ee61e0066c40,
+	 0x202e157ad97b0c67, 0x6ef17c5affefe69f, 0x59258c1481ea3328, 0x0bbab86c39c5ca10,
+	 0x2b9307db30735a82, 0xc475fba522c49abd, 0xaebe8c77fb1f4537, 0x1ae5ecb81e88877b,
+	 0x93b78bf225a4b2c5, 0x1187627644f3ad78, 0xa2b499b70af460ba, 0x7b76c7ac50ee1cfb,
+	 0x692c6f8d12ac89fd, 0xfbc7080e1fe1270c, 0x1730b4e7d66f0c80, 0x4ea65aa61ad0e5c0,
+	 0x79744c92a2a97386, 0x07d812142d585e21, 0x197e8f0affef09e2, 0x2843432438d01457,
+	 0x919efeb18350e92a, 0x5bc15667606e52e4, 0xefb962b1264fc8f0, 0x42cde577ad5dbabf,
+	 0x821b9fa6cc76bf1f, 0xe2eecb84a74e2ec1, 0xd8143917df5f50d1, 0x8dc61d5f8f306665,
+	 0xdcb3a9aaf0541fd8, 0x928f214ad8772c6c, 0x6fbbe5fdbc17d182, 0x7f54c10c13e0b939,
+	 0xcd9e487cf86482da, 0xde3e0f47b0baeaec, 0xe94860b44923c016, 0x2db72bdb4e87f69a,
+	 0xa2cf4f1394c8b139, 0x64f35d022fdce002, 0xf35127345d62daa5, 0x8592edf51dda6c03,
+	 0x8cc85fedc2f321b3, 0x9d4b7ce1b04d9d37, 0xc82280b469b7b462, 0x10553c65a1221260,
+	 0x175bb5d545c4b9b7, 0x5066704d51e81464, 0x27c40f2484f75e62, 0x199639be32130485,
+	 0xc617049cce831270, 0x63e06a50299b453d, 0x08eb4e9a099bf6d9, 0x521c5ff18da61d29,
+	 0x27fc9e347d63ff69, 0xd568fee72278eaf3, 0xf5b568db99ab3c09, 0x6e22b9e2577768de,
+	 0x448314182b5a88d8, 0xd6872abdab52a36d, 0x3c0a4f99a56d7c9d, 0xa4fadfc80aacf753,
+	 0x10a4be23a89d5b2c, 0xeb7ded63cc334644, 0xb96b47d224e068af, 0x4f470894970976a4,
+	 0x97d2ee243dee2a17, 0x24b80f7179d7cd85, 0x2c9c95f630ae7bb8, 0x4bead1f567f8cd88,
+	 0xdd3aa4103f1904fe, 0x0960c4262d8eeb75, 0x7b558e5c7b4e024f, 0x1cab1f522687a05c,
+	 0xc1bba2e99e850caf, 0x487dbb03a978b8ca, 0x12e4a33d1d3a8e34, 0x45e6c93061d5211d,
+	 0x26e942fefcb47d1c, 0xb0e0bfab6759e908, 0xaca89c174cc46c3e, 0x453dc18f81213c37,
+	 0xbf02018dc70ee282, 0x897c11db0ab0f589, 0x32be0877e53ce388, 0x0781ae31d17655ca,
+	 0x9a5f5f1d3a8d0a7d, 0xb7416f0f301dcb55, 0x73b2011846cd142e, 0x15dad9462d51f76e,
+	 0x2ad197bd71c04354, 0xb8da1bfd7b6ae80a, 0x233defe0df12522c, 0xad568d5111e51c64,
+	 0xafe416a2c4ebb045, 0xc290f73ece225ff5, 0xf7fe150e3d05a8d5, 0xb5d10adeb5f6606f,
+	 0x946696eaea7148e6, 0x14cffd442235b326, 0x01ee551b11169b34, 0x2ac9b48a87113b4f,
+	 0x1a1975ef356637df, 0xe3b49890805b6057, 0xf5032909ffdf5635, 0x5a951b73e77d865e,
+	 0xd9cb5b1c49a448d5, 0x94eb030909a61476, 0xa33af240b199b6a2, 0xa9604549c86e42a3,
+	 0x46a1f554083030d7, 0xd6dfa2d653a7f32d, 0x61c1b0220bb37fea, 0x595d0e6bea0bf189,
+	 0xa1be20a97c88290e, 0x7506d097f6b9ea15, 0x74ebfc687aee94e0, 0x33b9a8a9f98fb02e,
+	 0xe2455645689a91b0, 0xd80f534afd47c82a, 0x330121c2c272b5f4, 0x18894958fa59dda8,
+	 0xfe277b6255aef67c, 0xd53a6aa4a7cf550a, 0xc9022064349fadc5, 0xb63cdd1581f84dfc,
+	 0x1d3ccb4c52819ef7, 0x535acf68a1370148, 0x3d9758e336032eca, 0x8abd94c2524fde70,
+	 0xe8f1605d1b3eade0, 0x593d8fe53cc2a290, 0xe8240820a8cd8f89, 0x8040a0570334b826,
+	 0x6efd8c669324ae63, 0x4ef10be849488ed1, 0x288ad87047665285, 0xaece1281873143c6,
+	 0x147f3eabc5f1460d, 0x123ec31113314831, 0x530a4d4bbb1e5f3f, 0x2162f45089565962,
+	 0xc3165089e1a3ac1e, 0x7909b4f014d007f6, 0x5d84882c8be9ce44, 0x11d9072376f7d64c,
+	 0x9e9e26021da87919, 0xcb48fcf3126aa585, 0x93c6a93e3a62771c, 0x8503d502bc2aeaee,
+	 0x1ee51edbe97d41ab, 0x1d1fb3bfc476dc8a, 0x6844496a20d1b9b2, 0x8ea8391bf446346c,
+	 0x981d54a65e6ba246, 0xea66b820005751a6, 0xf111610d58b46b44, 0x138445b175fcd359,
+	 0x529d94ef089d2037, 0x9381351e51d036f1, 0x567a41d8583d6eff, 0x6a5c66359a00f495,
+	 0xa48fe82e7af2119f, 0x9ed35995d9389fe0, 0x1d8a477683a8d653, 0x664358fc8a82d684,
+	 0x62e16acdfde22ff5, 0x6fa7d757f05cbc15, 0xf2d58ca707a4d622, 0x206edabba8758e92,
+	 0x84f28941c236134d, 0xd7c07d7c966c7355, 0x9ce09bb4068e3880, 0x7146e99d7be28f72,
+	 0xf573e7d84d4e6220, 0xf1e8c11a4ec06aa2, 0x5bf0df0dac40ec12, 0x1b2590ceea500e52,
+	 0x020df30903f10a7c, 0x8695b257a4994f57, 0x2330c33743287cbe, 0x7899ae6fc0f5db32,
+	 0x591c689d51009618, 0x202ffef7aeb23270, 0xc666162a99dac8b6, 0xaef3d619623f94b4,
+	 0x3cce3aadc3d9656c, 0x1c0f81cdf11c8b0d, 0x1e56fdbdc28d1cd5, 0x2f40d7bac0a31c02,
+	 0x15cf73ff44bdeb13, 0xc450d00d7615859b, 0xc81755acbe6493cf, 0x24066bc3139d677c,
+	 0xa3f2f6cba1b7fd76, 0xb0fba743d425930f, 0xf59a888a92044aa3, 0xacf15aafda35dd0f,
+	 0x30ac853359600397, 0x2341ecbf65ad96f5, 0xdf1a77f53f548461, 0x9e5d886b5041a802,
+	 0xa46896ce4dbbe0e6, 0xdffb4f6876b9760d, 0xafad253ee97c089b, 0x2fe30f7fda3b9022,
+	 0x8d240832cbb5eb4b, 0xcab7b49776367019, 0xf9c5e4699ef7aab6, 0x7075abfb2ed7fa3b,
+	 0xcc36f3b9f3fe2c52, 0xb065d57c8be0565d, 0xffaa84095f2747f8, 0x1230f7d97b053b72,
+	 0x6fed07d520b396d2, 0xb75185379b353ab9, 0xbc6065609dfd4bd9, 0xb0fd95b914c363f8,
+	 0x8c10d22f520b171e, 0xc3a714060ee322d0, 0xcff6badff05ce4d2, 0x4e7ab41501dc2426,
+	 0xed64a32615c659d6, 0xeaae5862eddd93cd, 0xb503e7fdce696beb, 0x94bc36251d24be64,
+	 0x36f65910e5267cd0, 0xcc33fb4a2e0786f3, 0x1f6ae255c0eb5676, 0x7e243eaaf122e6d7,
+	 0xd0286065005aeb4a, 0x920038ec4abb0425, 0x618c5bdb3d22ad23, 0x75d27996b4aa50bf,
+	 0x34f6917c3828cc09, 0x126d847ef1f1aeea, 0x8cbd32b2fd3bfd74, 0x459e5696c1d6023a,
+	 0x0e093d307534abb7, 0x518d794824b84ba5, 0xf38bd00a6c5a990c, 0x564db60ed02209b8,
+	 0x26cae7f897724ae4, 0x58adebb632933c27, 0xfdd992dbc3c82566, 0x2020ac0967ce7ad1,
+	 0xb6dc71e728b82203, 0xe51a9bfaf9fb2f83, 0x58552db5dd86a009, 0x6f27ca4584c740c1,
+	 0x904cf626d1ae236a, 0x883fd7efd91ff4d0, 0xb4ec5c3f0e284746, 0x10871846fdd3a624,
+	 0x08477e6959402fd1, 0x32ef1fed0351395c, 0x2d6512f2d9789e2a, 0x6b30b660b341fbe3,
+	 0x53d3e1dfc86a3956, 0x0c30d3056bdbf77b, 0x6350599023011f16, 0x569cfb9cb6eb1773,
+	 0xde6b1d100268b943, 0xe2120a00814be24c, 0x5f41e87f9d3dac66, 0x9732dad20212250b,
+	 0x0f1e5c50ce53acd0, 0x6f3b5c976f9ff0c9, 0x336f9a409003c485, 0x6b436057b8e5944f,
+	 0xa47a58cf953b9259, 0xaefe6f34dfb4ceef, 0x4dd9e905171481b0, 0x99f5379e4a39760a,
+	 0x2506526743304aac, 0x9863232a95b678bc, 0x2551aa1a43e3c5c5, 0x40e12081602c042d,
+	 0xcf95fe31d52f97d8, 0x029b27991d9fd87d, 0x7248a2d12a5259c9, 0xb0b0418f544714c0,
+	 0x19054d51924d49de, 0x97bea04ad156d8fd, 0x836f5b1a7d00fdc2, 0x623e62e27c615ca9,
+	 0x75e62b0891b822ff, 0x9ad6f0743d1e1485, 0xced21e7c7cc7abdc, 0x928975ddfdd679db,
+	 0x9bb332a9c13bfe97, 0xd18f59deea6b6f41, 0x0b78ed5427a938e0, 0x36a35effcc7e0c39,
+	 0x77b1b1780f132af3, 0x4c2577bbdec95e07, 0x59915f4d956553df, 0x0943d108d39fdea5,
+	 0x79588159aae4f9aa, 0x787df73bca65fbd3, 0xacb83eaa18a689b3, 0x9dfcb8b5efd50087,
+	 0x225b39b4bb5e236f, 0x0b5fd64297755917, 0x0743c18afbf0ef99, 0x77819c4315296d0f,
+	 0x9ea9eeb2ccaaabd4, 0xd38b63fd41813efa, 0x94e626adb58f796b, 0x3ebd543f3689e3f5,
+	 0x617452c253594558, 0x2b11c50153485de8, 0x3e513bef57ae5b90, 0x40de10cc9707eaeb,
+	 0x7dad28d2aa3aa3c6, 0x84f16a9f00daedaf, 0xcd31bc3861d1d3ae, 0x66762f50f3d7cd60,
+	 0xd304cd1cfdba6997, 0xbb8864d88efd43b6, 0x826ace2cf2d58fb1, 0x6d5e78fbf6e3b621,
+	 0xa64f64adddc0758e, 0x009e52044598e7fe, 0xb5156d48adb40a82, 0x8123c4505ba8253d,
+	 0xc6964f41f9a29192, 0x07dcea9dd5b0ee2f, 0xa5059cdf443b28be, 0x870dfaa8ce741a72,
+	 0x9f29c25ac266dad9, 0x3b8bc93611b84b37, 0x9dda7cd28736606b, 0x7ab25a3568b70ddd,
+	 0xb77c53a8fe10af4f, 0xef9a5658eb14aa44, 0x3a34b38cab716d3a, 0x05d631214d945628,
+	 0x53cd6ba452ea7095, 0xc7d825b2694841a9, 0xd0a1123c1f5b62ba, 0x04d7afce464bb133,
+	 0xdaaf09da547ac60b, 0x2aaf047ffc81b62b, 0x25b5e1596bf6d715, 0x08600f7095ebe894,
+	 0xbeef51ced99c2dd1, 0xd5e9f13660d33535, 0xbae173419f38d151, 0x2cb6250717a1a0d0,
+	 0x3fc3e4f0e6f85914, 0x455f3f875439b36b, 0xfffe5ded6e46d990, 0x80aa279a93cec8ad,
+	 0x276d9b3e7cf8b45b, 0x0fe0a4c20d4188e3, 0xfbe28b873727b41c, 0x65cf6b067a54307a,
+	 0x5eae746d3c134f98, 0x2e149a09f97a11de, 0xdd2828a89509908a, 0x42fa8ccea09d0587,
+	 0x7af8a8968173e7aa, 0x23cce5933d41dfe3, 0x4fb7fc776e452974, 0x5575b0793790917a,
+	 0x070e7205eceda0ad, 0x7711d3dc06edf7de, 0xbbff2fbeef838b95, 0x79f36c14a9da8d5a,
+	 0x45e423e7c4760108, 0xf148a9b7049198d6, 0x780106e9262164db, 0x771e5784c2c5e52e,
+	 0xf95bcddb61816635, 0xadabe18f9f5be35a, 0xad7f6cdf5b8338a9, 0x04635b12faf91346,
+	 0x1a7c5a0e7e8843d3, 0x4a9d6c373832601e, 0x3c91f833f8041740, 0xb2163995335beeec,
+	 0x9572db3b8f085fb9, 0xb8e39224121bd62e, 0x22d422a8fd20aa31, 0x440997e286aa9a51,
+	 0x671d1e6a18b7600d, 0xa128ddc76842e635, 0x73b9d155d19d2824, 0x0f73cbf869ca70c0,
+	 0x0cfaf5d519c44579, 0x62e952e5634996e5, 0x5c583a8887cc7906, 0x23cc8d65be759a54,
+	 0xcf8f598af6de7320, 0x6377963cf1002db4, 0xfa29831af9dbeb28, 0xb22ff6719bfab3ec,
+	 0x4b5ddb6270a65f4c, 0x6909dcc8c563fc6d, 0x873e6740494fa659, 0x4ff5d93d31f8797f,
+	 0xb7a5dded4cc4c5ae, 0x4a5f7e37099c9719, 0x59c0e0fd669b96f4, 0x236a8113a3560ae0,
+	 0x6182333c92940178, 0xcc19fb3fbf789248, 0x6f2e7535f40f7f3d, 0x1ad23e50b2fceacb,
+	 0xde96c7342b1afc37, 0xfd96fd9d488c7339, 0xcf2d2a16728af66d, 0x46783c64cde31883,
+	 0x997e925db270dda4, 0xbf903013f67cc244, 0xdf2f059c13fe34c8, 0x319c957054a65c09,
+	 0x230f04985873dcb4, 0x0fb4dcb8a2ac792d, 0x59dd83d1ab1fbd38, 0x82e03c1605fa4c8d,
+	 0x98ddacc87a7cbd4e, 0xe1d2f6e65723c67f, 0x98f5040dda9329f5, 0x0e498bc2d721bcce,
+	 0x13ee0ce1a2857b33, 0xec8a570e5b4e4a01, 0xf551ae6df1fdf8e7, 0x5bc51d280fa1dff1,
+	 0x7bf74e3759753402, 0x068c898434b93536, 0xa12524ff12698623, 0xadb493af95099236,
+	 0x2150d4c9eb9052ff, 0x2bb53de155672bb5, 0xc8a7068d17e4b39b, 0x331050609c652f85,
+	 0xa67231f9ec2feef0, 0xef895d1b4f60ccbb, 0x0c7a79a64b4cf76c, 0x32b661fdfcd92291,
+	 0x9ce99a9d1c3c4582, 0x1a94ed021ec3c1de, 0x14a95eb94867bae1, 0xa861e11b55855213,
+	 0x8990e2382698b858, 0x294ddadf7d54149d, 0x89b8ec5f84ab6336, 0x414e49c6e5143b4e,
+	 0xdfd6bf160c5e2f89, 0x06f1525dcd895063, 0x62a255890abe3717, 0x4a6ea07c9b8d007f,
+	 0xcbeadaf2f34d5477, 0x904ae16a99d15ffd, 0x479f12e7b4630afa, 0x5392635d1ba8ef80,
+	 0x9659f9cb1594233f, 0xfc3166504cb41425, 0xd1411c97cb7e0724, 0x0a592a7414c95adf,
+	 0x670fca40064ec8a8, 0x3cdbe205aabe0faf, 0x0f1a977cbd150a8a, 0x38954237445d93e4,
+	 0x89e0f4e4c808acb4, 0x0efe32d46e12dc88, 0xb8f010a1fb1cecf7, 0xa680c09ee774d3fb,
+	 0x07e84e19473a46b1, 0x67709559f3f84693, 0xac323fa42d27b5c3, 0x2369ce31eedbe745,
+	 0x5f0f91f23c8b04de, 0x2115469f35538dd3, 0x6ffe3eee4166af53, 0x029ab7ad14cb6c54,
+	 0xd045d4eb383929d4, 0xec59e1e80dddd755, 0x48cdbae02482bc87, 0xb3ab8479ed886e60,
+	 0x9a8534cdeff17c83, 0xc56df86bc002fb33, 0x9776e3594e0b85dd, 0x9f6ba6763c75b13f,
+	 0xfdb05ab08fbfb25c, 0x0384a8cca7b878de, 0xdf7525a54fba1b6a, 0xa7c088757540795b,
+	 0x2ac61b467910ca5e, 0xece24ffca955c981, 0x4ae93845a90939cf, 0x40d61f98cdcab3a0,
+	 0xaebe518bf7180232, 0x9ca800878d05a8c2, 0x7d58ba7088285f80, 0x4e013595ab2faff6,
+	 0x147192d38c22acb3, 0x30bbff1b4d0878d6, 0x16a2103a36dcd779, 0x21f77ce08e7483ee,
+	 0x4e9667e23876b683, 0xcaaabbef25d863e2, 0xcdb0c6110e4bbe00, 0x2f18dcefbce6a4d2,
+	 0x7fdbfc2cf49658c5, 0xe1d10f6f0df974a8, 0xb2b7c0c2e0b4d25f, 0x37db1b7a83e138de,
+	 0xe0b1fa4ff1d7c8e1, 0xd1f91d7f678e1ecf, 0xb3ace8ebda172904, 0x5a13a97f2a53b93c,
+	 0x3279a812ce851139, 0x135b756c0c98a4d1, 0x626aa60c4143c173, 0x04e552c5671a3776,
+	 0x1cdf523b193f4b8e, 0xd6e65fbab1b69ce0, 0x5b9e040433a1a3a8, 0xa4f110f57f7cb31b,
+	 0x8ce5b5f9dac20217, 0x5c9a863ace158b45, 0x291552f57f053a3a, 0x9a710e9c09065ff8,
+	 0xc97be8ec3efef610, 0x740ce6b3927df809, 0x28b4073215b10cd9, 0x11360af700244976,
+	 0x8f59deab98b7e244, 0x6d000b9abb7cce2a, 0xd8c01d62545a2176, 0x4775afbcba4fdac9,
+	 0x53c45a118b282b7e, 0x27467c4558e973c0, 0xae19cea60d7c9115, 0x06a6740e0fb12f11,
+	},
+	{
+	 0xf23f52ae3eb3d8d7, 0xb13484cdd95da75b, 0xc0b159076623e9aa, 0x3ad478dde433f294,
+	 0xdd54034e7b724b8a, 0xb80c482e929a203e, 0x9eec69277e856999, 0x6f8ae7642ed805b5,
+	 0xe9c1dbc77b4db4f9, 0x921b22bcf792e2ad, 0xa202a7f87b22a7c8, 0x794fa3bff5078613,
+	 0x8d0d34c10c48cd68, 0xe7ad740bfeb315d1, 0xac4d816fa0cd416e, 0x7df618c7e19eb47e,
+	 0x8c08cc850a58e242, 0x44f480418b85031c, 0x329b0565c248cd12, 0x27c0ffaf97da0dba,
+	 0x75952a9b9f82adae, 0xa3e658817710bdd4, 0xcc291b6d7df9eebe, 0x378e3a27a27b3201,
+	 0xd614278d7077ea03, 0xf53932b707811f40, 0x8bb5fec8d4b1d4bb, 0x901fa4c450b8fdd5,
+	 0xb72433e009d51a6f, 0x057c104ea0b9be74, 0x7a2bd91efca4bb83, 0x95c7f5e3524e803e,
+	 0xa1034052cb686387, 0x16cfc4bd5b831a51, 0xb79e24afd5a71a0d, 0x156ec5687c039571,
+	 0x7d56821a28187470, 0xb804da3059ce4f73, 0x7e8b5df86c70b25b, 0x12a8e82b04bf4d40,
+	 0x5fd355875b6ca2f7, 0xfefc279d7d244a12, 0x6e247b6c8ba96e4c, 0x58bb5b16cf9c880c,
+	 0xecee770ddaea5f09, 0xe2bf07f68e983930, 0xceeea39aea627f6f, 0x7881e4a5493e5d4d,
+	 0x0c05d70b104ec0ab, 0x604254d6ba1f446a, 0x122a4288daa83356, 0x346444bd0d994640,
+	 0x6e663e223eac1cda, 0xe5561276831c4768, 0xe99f1b80c4639ccb, 0x18e76dd3de004cbf,
+	 0xc11654078e03e410, 0x23fcd92b4fd1281b, 0xe395df1276f085d1, 0x660414a308b2a8a4,
+	 0x1d7e3719771f573f, 0x3d35f612f063b5cf, 0x240901f05e444de8, 0x19de937254e9d725,
+	 0xd69fb8667cd4006a, 0x991c77a81b11d6aa, 0xe39e448158879cec, 0x3d54200c86bc9a3b,
+	 0x2227a5572d87c7ef, 0x411e51e35b6c8262, 0x730b2b20e7da7b39, 0x4ee3ad2868472388,
+	 0xa1cebc1d2db66ef3, 0x3a85b06f536179dc, 0x7f275751610ffe0f, 0x37d5d3db3ee2ccca,
+	 0x421c9ada0d2bbded, 0x219d02e6f3b18a02, 0xb901e7cf5e28aecc, 0x6fc0eee72b3e9226,
+	 0x7cde02c5dffd37ce, 0x86f32b182616d428, 0x42b25633d2125d6f, 0x3455148c64ae122e,
+	 0x94f62eca1f04584c, 0xf9cc1f02b0fa3d54, 0xa154c8610984a050, 0x79ffd145e87859b1,
+	 0x26e4585eb13d4521, 0x707fbf036057a7cd, 0x0ed81f3b2a25c425, 0xa26a76254c58854c,
+	 0xb3533dc644302714, 0x4c758476616ab012, 0xa750227e12b71d9a, 0xa3871410a7a07a47,
+	 0x9b560bdc67b46552, 0x98527c239d914d43, 0x085ae3d9e1040d44, 0x231de84c1c29e7fa,
+	 0xed9c8a01378e228d, 0x12099abdbcc5a2e4, 0x61873b713cb3ec4e, 0x341f8dfe032ab301,
+	 0x9b8c5ef92ef89ddd, 0x13abe47945e29c89, 0x41033f04d9a328a4, 0x26857b9aa1d29da4,
+	 0xefa1954cc079f47d, 0x7112973e8fa5de10, 0x9b20cfe7c024b39a, 0x0114df47ece08d66,
+	 0x3eacde47d544d614, 0x24d52b2579f64ffa, 0xdebf697ae148bc80, 0x2a787edda8718afa,
+	 0xfbe8f19828a59682, 0xd2214ae348e09702, 0xee827bacdf0e6d72, 0x6d7b10d75d8f59fe,
+	 0x83442de609befbd2, 0xd7b388159f9b3418, 0x42cb7a4d33033a5a, 0x70cc2092416193f9,
+	 0x1fb13f2dfc9e7f3d, 0xf7d7aeb91ff0470b, 0x5623f33f38336881, 0x9a032e78e016b03e,
+	 0xd85928820e2a9b8f, 0x5d4b6deafee0c9b3, 0xf75609c03f484e8f, 0x9b854d201d242858,
+	 0x6ac91f8b46535d58, 0xb60a6febce2e4556, 0xc72b97dec975508a, 0x76a43845c9a7032f,
+	 0xceb663ab9c43d572, 0x6a94279e4979c27d, 0x9adfaa440c6924fd, 0x55866401a0731982,
+	 0x1d802c57ad761bed, 0x3d66dd6e04cde684, 0x14cf7715148a9562, 0x95d27cbc78bb2f21,
+	 0xfe52640595fbc5af, 0x8b6ebb978a2bd5f0, 0x0ba81336c26a3d97, 0x7cbec7f456e144f9,
+	 0x746fd4956e14c540, 0xf0719a1832dccc79, 0x6be48d5698fe517f, 0x51b31020838fe106,
+	 0x33266dd41491261f, 0x843cc9a87edab5df, 0xec4623f6466231fc, 0x3f9e777f30eced0d,
+	 0x534f7509933af61a, 0x228836959cce78f6, 0x51aac16cf3c73a90, 0xb63ebd1688682b42,
+	 0x28ec380b7bc32931, 0x305abbb458cdbf53, 0x45b2c4e7bcfa7228, 0x49b4cee2ecf92959,
+	 0xdd2997a2f52c31e7, 0x960c4ea1ee94f0eb, 0x430e4ce9ad01a279, 0x0d30d6c36c7cf5df,
+	 0x9d5fdfb8bf726b9d, 0x11165ed3dcf3dd61, 0xdba8758700cf30e4, 0xb55582d1849eeb6f,
+	 0x77b6fac350ea7f6e, 0x1af56a141244119c, 0xcf1f85bb24b0fd58, 0xb390581b639d5720,
+	 0xb1e6b272679fab3a, 0x47753924b8cea39e, 0x12060aeb2f708d84, 0x2f7abf2e48624cbc,
+	 0xd490f2e2904305f3, 0x0cc347710721e7ac, 0xf41603d946529fe0, 0x707423cfc656d2e8,
+	 0x0ff6a9be1c162ff4, 0x2d9cf98e4b5698d8, 0x1ef865f0e07e9390, 0x160556cfd364ed3a,
+	 0xf2b38026cb50460b, 0xef501fbba92e127c, 0x93e583b2dee17d94, 0x468f0bed96e6f2b6,
+	 0xe7c7c8925eb40ff0, 0xd46b6c2cbf4623ba, 0xda0a8c1b8da08ed3, 0x444f90e5f1035732,
+	 0x3ed5d21ff5b64095, 0x6d0adee6f16777ea, 0x1ce2fed0bc66457e, 0x084b13d78a5a689e,
+	 0x46b635a3d8be4c6b, 0x4d8ab6c5377500d5, 0xca9bb2a24e21b9a2, 0x74426e227596a669,
+	 0xc58be75a64ad1c4f, 0x523d9131d3df4f1b, 0x4cdd1a58506c16b4, 0x1642d0caa58e0f0f,
+	 0x493f68bbfa5d61ec, 0x7941d7fbfdd22062, 0x7c0e2fda217cbb73, 0x9002801209b33b39,
+	 0x55d24101b7f927a1, 0xd6e81f7297d632bd, 0x2f464c9eb8ff4bb2, 0x57cd53918bc1d542,
+	 0x499eedaab4488268, 0x753dd6dafab2995a, 0x5546660ec7005eb1, 0xb5db627119111d6a,
+	 0x31c222e5c924808a, 0xd802f16e47b52b72, 0xa3fccceaf2854c42, 0x9685dfc6079c81e0,
+	 0xf6aba9cebfd12769, 0xc7d76a3428ad3d1f, 0x5d9e14f502d40457, 0x23fcad3e55b947e2,
+	 0x4af58d88819f8065, 0x284a23888f051564, 0x386ce87d27cbc709, 0x9bcfeb6562485e89,
+	 0x6f49becf894390d1, 0x5d063804d4bccc6f, 0xee37bcf512ee30a6, 0xaecd838f03b53569,
+	 0x462420f3978935c6, 0x9bbaa7fd430a9d25, 0xe2deb000db940ae8, 0x6b6f73fd5ebdbd19,
+	 0xcf63a35eb3570374, 0xce42f844d93330b9, 0x5dcbd9684cba54f2, 0xb487402ca9c09301,
+	 0xf5ddce3b26d89a81, 0x68d54ad37349ed02, 0x1790230111a6e8f5, 0x19679f303ca45af1,
+	 0x0abe4de4fe7ab927, 0x7e7e46dd3dbef909, 0x0495a6cb5e621d75, 0xa8cc15b8c810daf7,
+	 0x51f4729b6a79867c, 0x96e3d47f403a24ea, 0x01b0066f5efc6813, 0x5d3a123dc6f48492,
+	 0xae7c5b5042786fdf, 0xa9ba75b8bb2b8d5f, 0x3b37630e7e6c9733, 0x8f6bf574bd7baae6,
+	 0x7ce9c760d6a3f7c8, 0x77313530eeb381b7, 0xe71676f56b70cb37, 0x2ffd8b6a125c79c8,
+	 0xc4f479ba9a13a132, 0x5c3512489af24f54, 0xe8372f6138eeda29, 0x7054795a15659dae,
+	 0x24ecb7f083965a1b, 0xc21c5e14113b771d, 0xb7a6745638855713, 0x7bc62f63c3577836,
+	 0x609bf74094d6f16b, 0x210521c93570a43c, 0xa462ccd9862ea6a9, 0x399b9ababab3c5ca,
+	 0x9fa08d1486a9ff86, 0x81c62c0df9e86935, 0x2f9d7d1e48993a81, 0x4584ca141b2756d0,
+	 0x25d5adeba9a2ea44, 0x5ac2082bf98e3634, 0x891e4b95ebd6614f, 0x3c9933d1324a5ed3,
+	 0xc885c72694ccf30a, 0xd24846e6f00c66bd, 0x697084f7bc7f6ac0, 0xa2b4723253396d3d,
+	 0xc97208ebe5f2650e, 0xed3487a684df63fa, 0x0882cd6ef1776886, 0x37fab13ef5a1f61e,
+	 0xed834c0a3e314a3a, 0xd49402bb02b2b6db, 0xafea16944997c016, 0xb1fea6d537d5de76,
+	 0xb0c5157c63735bf6, 0x5d2643e006f1d118, 0xfc1a2fdc915e0593, 0x44ed0878dcfd30de,
+	 0xcb4a280a76f0249b, 0x5413ac9addffb300, 0xbb1ad487bb9eb40a, 0x5ac524fadde54915,
+	 0xc105c562d139e243, 0x99f28efdbda51baa, 0xac922763cb5f57d2, 0x9963abcce610e73a,
+	 0x90bf09c8f3a97d8b, 0xc05c8ba24983a990, 0xec74f47abbe781e9, 0x81580693ff14284d,
+	 0xc56759acce02e23f, 0x11a0b50c431f3c1f, 0xff6209eb25cb279b, 0x76b074be29b235dc,
+	 0x6385fcba6a4a6fe2, 0xeeedaaa37c18f0ba, 0x41a7316ef6477ab1, 0x2c332f33706ea72c,
+	 0x8b424c324ff5f38c, 0x1f4efb91451e40bb, 0x00cc6d1d96a9a74c, 0x7171a2281a1b67fa,
+	 0x66d79c15efd98fac, 0x99b2118f49f68305, 0x9527f665da1fc2cb, 0x506aaba23a6bb23f,
+	 0x39d9ad21782e36c2, 0x0fe57dd5120b9fdd, 0x5bbe251d81a7c094, 0x63295993749c7aef,
+	 0x4551ff8744b33c84, 0x26aebe615cf8367a, 0x8278b47bccfdd3f2, 0xaaa3e93e69a41ea6,
+	 0x44060d127f74ea3f, 0x67a1573737979369, 0x9ed315f40004cb9e, 0x9b72560b1e2a0fe7,
+	 0x9bf633d61c866265, 0x0ed1fa02ba52f9b4, 0x5a599f98be6f7560, 0x3ca5970ca8bcaa6c,
+	 0x0b8348155bfd78d0, 0x784b5c2ffadd27e4, 0xb06a0a1e037cff0b, 0xa1fa362fb36afa5e,
+	 0xee50df5fac9e653c, 0x87333fb4ea563070, 0xc2ed7f2635c73429, 0xb5460154a14c6e13,
+	 0x1fc2fc82e52e5182, 0xe9656dd89fba6b5b, 0x4cc1cc1f3218296f, 0x9390d7d639bd633f,
+	 0xd6b7b1102dd7027f, 0x3e3dabcc5ba4a8cb, 0x6162f9ec8dfa0e80, 0x1e934a7002840425,
+	 0x7a4748ba8cfe83a4, 0x6e8923a79f6fd72b, 0x0194ff678f25b0a3, 0x64d5e00ef3902365,
+	 0xc91ad0cbaacca9f6, 0x741997775a7caae2, 0x8fbbaed5b9a65b19, 0x14a4ead9ccf238e3,
+	 0xdd7a5cd27ae3b070, 0x8c542f82392521c7, 0x006e6b626c4f9614, 0x37fba823cfe8e01c,
+	 0xfd5b5c275afe740a, 0xd8735a05e7e494e8, 0xa27484684bc37317, 0x84b613d69ef06a0a,
+	 0xf8b850c1e086604a, 0x1edb6bc78a39df8d, 0x4bea39486bc8e853, 0x8ca4343eae5992b3,
+	 0xc1808e0168aa4c79, 0xba6e5016d8399f1e, 0xb504b27e4f86fb1f, 0x1de359090a7b49cc,
+	 0x1539b8a03bf209d2, 0xf41b02964d593892, 0x67bdcf3a9183eb80, 0x21e94b2e9553ef28,
+	 0xf08d710e43f6e23a, 0x22232ab040bc2707, 0x56eeb96fbd3d7333, 0x48c4fe5f9fafe658,
+	 0x4386369a16ec6b22, 0x7b1b571037868b32, 0xd0be888bebc13c96, 0xaad14ea6fdf70a05,
+	 0x042eda97d7f975ad, 0xb52c53bd5d073ece, 0x05d5fd89e7657ab7, 0x5e9c5dde3c110bbc,
+	 0xb9c5b937480a7287, 0xa1a28b101e4c45f7, 0xb675b9fa8540ee03, 0x7878c00f31951e7b,
+	 0x8fdaad059d201815, 0xf241bf80395e3081, 0x0a3b167cf0ca6fae, 0x560ff2e6c89513fc,
+	 0xbc9d59915f3372ab, 0xcaf66865698cc726, 0xa5a11262f52c1c66, 0x2acbdf9f9ff0da22,
+	 0x1eac3ade291e5a9b, 0x709cee60398d28b9, 0xd2683402cfc00bb0, 0x1e553886b177c40a,
+	 0xca386f11b9be681f, 0xebca1caa4cada6ec, 0xb58f806d8ad0aa61, 0x6a07c375072fac0c,
+	 0x8992c82ada3ade45, 0xa97309abdfeca927, 0x9cb5d4d71a4951dc, 0x73857d42d6dff609,
+	 0x60a4f8bbc97e465c, 0x7574bea753256d9b, 0x5f8ee45722b8c2e0, 0x6c927e1d5339f71e,
+	 0x56a3d0dfb72c8b44, 0x9ab693fa84b5e6f2, 0x1a3048133bcd6a96, 0x2895e57a6f9c7157,
+	 0x421119f6de39153c, 0x4f5c25b0954453df, 0x1a6ffedb410ffd58, 0x7057f50afcea366d,
+	 0xd269e8aecfd7c720, 0xec49f2d9ab8840a9, 0x2641cec507b60a7c, 0x6792456da25f9ab5,
+	 0x5d6d4d5566f993d6, 0xf2d16e057fea783f, 0x8b14970b58a8b5c1, 0x35ec5ea45dca5c11,
+	 0xfc605b9cb70ca0c1, 0x28a05487fe3e814f, 0xc191c0934c8f049b, 0x311a179f48c39494,
+	 0xfb9db6d80357fac2, 0x29acf564eb0cb87c, 0xdd98c49c564b1094, 0x421e6e3d395451d9,
+	 0x9621fbb90bbf9e30, 0x9c308a05d6f18371, 0xab16af7ef814a1e9, 0x3af66c7ada956025,
+	 0xe37fcf43a69f98c2, 0xc17cc4ece045bced, 0xc71d6683d89e8073, 0xa2797614479f0109,
+	 0x0d7e7e78a90fb9b9, 0xcc7a5cb490fd88dc, 0x633dda6dccf3cf1c, 0x8cb9b31c7f504b5e,
+	 0xd373b4f9b8792e27, 0x2969510159369895, 0xdcce7fb4c2594ea4, 0x3debe9aad7387d8e,
+	 0x6c5168928ad39c85, 0x7640e05531548ebd, 0x6606ec9041653074, 0x7816d184f60909f6,
+	 0xda4ec2dac9f2adb2, 0x2c59087f1113b840, 0xec705d763949b18f, 0x9b6924266a489125,
+	 0xd7dfe1e5c1567926, 0x14b0e67ecf835a2a, 0x68890a90264c9527, 0x9e22f406b2e0a84d,
+	 0xc621c4c114d2fce8, 0xe6bf44359acc1d68, 0x7d225cc5ce9c1edf, 0x783292f84044f5cd,
+	 0x94205bb424a64a69, 0x329a2d01ab27ff09, 0x8ab7087403442e9b, 0x06cdde422bc192c0,
+	 0x9f2b3027e22e1b61, 0x2cd9160689b87f14, 0x2152755cfd6f8371, 0x9998e71446aa90d3,
+	 0x05a8a171ecb78e11, 0xc45fc3b7fea1e978, 0x1c4a11541464b950, 0xb301022c47d96d79,
+	 0x0b713021ab96d3f9, 0xce7f479560a61aee, 0xcea7cf45ac002c42, 0x6a533572bc7550ce,
+	 0xd0f4fed748e1721e, 0xf4454a0aec693fcb, 0x42c28193e00f35b3, 0x7260db33852b435b,
+	 0x3967a19e77cac5a7, 0xefe575a1b23f7516, 0x4c25464fb1967493, 0x5c2fa3960194922a,
+	 0x843bab72c529dc77, 0x5b774738a3e54297, 0xea849732cce38da1, 0x58da097e8f5e862b,
+	 0xea6fafeb96afdf6d, 0x475bcda9073b436d, 0x9e43b17b8bbbeac9, 0x0153465686019669,
+	 0x6cd2742d2fb28e84, 0x9837b5270fcdf644, 0xd8f60bbf4563ec87, 0x4528494ed238185f,
+	 0x477401b3d5896d96, 0x1b5f93a24e8cc86d, 0xa6abf3f5a11a43db, 0x76c79a2b20b59040,
+	 0xc8fa809fdec39774, 0xf8b67ad4637b84e2, 0xb61da9eb92436f2b, 0x2311a467abe0d3bc,
+	 0xf97285ab5ec659eb, 0x5c7ae872b0d40631, 0x1dcb885346f261b0, 0x17104684eb1a7e7c,
+	 0x8ae941d124ad261b, 0x973f61e5acf27cd1, 0x505b5fe1a901cc61, 0x2f8ebbddfe19c46d,
+	 0xc43e2fad5d74adf2, 0x716df95bbf60ffbb, 0xd00f819429419497, 0x9d8f24806a7c49e0,
+	 0x86b9f9030678fc00, 0xdbe6fde019c1fd1a, 0xb407c85bf3a97c89, 0x5930958d2f5b4cb2,
+	 0x4b804cd7f1fd960b, 0x80a41675ec67dfa6, 0x9ade68e87221e3a1, 0x2c2727a7adfba160,
+	 0xa24319da8844fbf2, 0x2a586cd31bab9265, 0xf966e7f7f2d50c25, 0x3df7ad88cba73727,
+	 0x5bf09b50f26b0fdf, 0x2b2debda8da55fcc, 0xcf00140bbd801515, 0x5cae0b8881d8a174,
+	 0xd47fbc80452c5475, 0x86295bbb0f13dbb1, 0x9a0339bfbe6a02a2, 0x36a89ed21ddc9b9c,
+	 0x8a06d1ec271b8cf7, 0xb63fa3482c8819d1, 0xd05c08c463513a0b, 0x1225c4e8cd505cf3,
+	 0x97bfedb578f0d5dc, 0x420c28bf6182d96b, 0xc9cc9ed83318860d, 0xa03eee153126bf85,
+	 0xd4969647ceb5eea0, 0xaa6f70b8fc0416d9, 0x3d213209f8e14b57, 0x5c17994375cc0377,
+	 0xf33b1c25ae337757, 0x49842ea8aa58a719, 0x0b0dab19282ea862, 0x20f219e513349b41,
+	 0x93cb0972ca2455b6, 0xddb8b3e735e8e3d2, 0xe51f7be770cefd34, 0x8a653c65258387af,
+	 0xedc7560d6f011851, 0x5af4f579a6e7bf7a, 0x04cd5970c7539d57, 0x0f3f535321cd784f,
+	 0x913a5c96f41c21f2, 0x48ee6fbd0ee5bdf3, 0x90fa61256112da18, 0x6bad3d6a29f9342a,
+	 0x4d344a88c0038e25, 0xc127744146ee60ed, 0xf2e4701b0aa3d156, 0x7a84ed1effea3c89,
+	 0x9df88c2da6bf40fe, 0x75ee56eca8ec3e78, 0x3d3900498ef0bc84, 0x6e500c4ee3d79d10,
+	 0x9515e1fe2a5e1ef8, 0x02d9de00ab10936d, 0x7fe421188f9a86a1, 0x63da8a8042944dbd,
+	 0xfbb7c31a973ba624, 0xb5d5a518ed68f219, 0xe390f0b2c3d80c6f, 0x852821abb88704e5,
+	 0x22a8a968bdae5d5b, 0x541ca9fe1820d640, 0xbc398ee41098ec97, 0x3ea1e1f7553a5c6c,
+	 0x16cd87c7450ab303, 0x7359527581d496db, 0x4869ac0824f8780e, 0xa5bb36b8ab9102bb,
+	 0x9ed37a6a29395ce2, 0x9d9b0da193e7ce6e, 0x46f985ce69198d39, 0x4cf6862b89fb54f9,
+	 0x914a463ac5c9b1b5, 0xa25a166eeeb2e451, 0x150c91451aa026c6, 0x245008d0a0d3edf6,
+	 0xe118472600582006, 0x65ad41fd3781ee89, 0x38f46bdd7d6098be, 0x1ee984f64f69f537,
+	 0xad8cdb87f0602094, 0x0aa0dc08c59b23df, 0x048f838f37e4ae04, 0x8d457ec0976c9481,
+	 0x8f6d71074d5602d9, 0xabe05a974e4521c2, 0xf6fd95fa5d37fa6e, 0x78dd18a823118458,
+	 0x4faff18bdf4f548e, 0x242f5c783b08bfb3, 0x11f964b5c2eb91ff, 0x49d96e0ec5fad09c,
+	 0x81c01fc7de6fa1ff, 0x9cbc4361da016f4f, 0x24f1d4e856bd1cb8, 0x3813d5ce7a3a2887,
+	 0x29b5d2af4517425b, 0xfd964788a88b9b89, 0x6cba8cc662fb7383, 0x1bfd961326af2759,
+	 0xac677bb3011640ef, 0x0b0a14a4d92111fa, 0xeb4816781cfb2e2c, 0x028b6b6e0c354f22,
+	 0x387a8d7cd800cec8, 0x0aa8afa944e7ff63, 0x45d081685d1fcad6, 0x263bb3ed462f766d,
+	 0x7debf8975850fe6a, 0x150d9e340586465b, 0x0b3047940157d1f6, 0x392ab16d864227d4,
+	 0x0ce39074e028471b, 0x5f283b0976651a50, 0x59b7278e26c99b12, 0x5c08031a63f47756,
+	 0xcb80cd83d15e3f1d, 0x8adcb294f6ab352f, 0xeb7848b82bbc361b, 0x93d14677d32efd4b,
+	 0xebf83e553a5626f3, 0xcc95289268d2a1d8, 0xb3458aaf3ee500ab, 0xa9efa82290576633,
+	 0x2745038242c3153b, 0xcab3ede26e7b702f, 0x4c6dcd9b45d6779a, 0xa762abbfe2854e1a,
+	 0x4efde7b3a09e4b7b, 0x5cb0f909d23e3a8d, 0x69df3ea1625265f7, 0x52b483d82db89e46,
+	 0xcc408e7be78a05f8, 0xaf4b87249527f751, 0x96d392e6639a6df9, 0x2a35b904335f8e1d,
+	 0x5c4693d414dea92d, 0xcf7863635c22564e, 0x94a4b1e5c357c732, 0x0a97edefaffd6023,
+	 0x2c7301b13bb1b72d, 0x3b13fd12e1286300, 0x3048c086bddbae2b, 0x91493f70ea1bfdca,
+	 0x8e39467337089de5, 0x922c80c52f46a9a6, 0xe0a5c15f1d93b6d4, 0x57037cc69fa9fe63,
+	 0x3676dd8e5cb2aa19, 0xa2e4f0fccfba63f6, 0xb9738bd8e61de40e, 0x25b262a22b59d433,
+	 0x229072249d4baa49, 0x6e9f1e8a2e5be010, 0xa88633b0744a12bb, 0x9307ed6ce9a207be,
+	 0x9fd7e17fb8cce7b6, 0xec715d04a673b83e, 0xe5a492cb1c1817e9, 0x8bd6aa81eefcf904,
+	 0x30f6e2bf40ce52a0, 0xd5b6e307865a3dd5, 0x757c8dcbc1f16247, 0xaff87561e2ac0bf1,
+	 0x9edfb1f0282c943c, 0xabb90bee70ffa55d, 0x361dc8992e307eb6, 0x90adc4276bb3311a,
+	 0x7fff2ce8aa6d0a56, 0x95d1503b4ebeb439, 0x3fe8e93bf56f4ab2, 0x34c19aecfa85a9a3,
+	 0x3f30acabc0d621a1, 0x0def7421cb759ba6, 0xfc2ad96ec3849f37, 0x33b334905d66954b,
+	 0xae489569e466ba77, 0xef97761c0ecb810e, 0x3cb0d05422ea0aa1, 0x83f256e600151aa2,
+	 0xdbdf88f4360d5fb9, 0x3b63b92bdbd3e158, 0x0407cea61541b4fe, 0x27bdc7b8a6fe4ea7,
+	 0x58e42923daa3c34b, 0xf2215fab45d2e4fb, 0x33d5dd295df0a799, 0x208ef4b019297d22,
+	 0x454c6bc5e3440d4d, 0xaa5af02d6100fc2b, 0x07126e478058df83, 0x5c35e60298e163f5,
+	 0xed85d43f83c9a882, 0x80b46545cdeb9140, 0x3a0adc52c241479c, 0x211918c6227cb141,
+	 0xf9f4896b3488a2d9, 0x63ca211c89bf6a6f, 0x1495c0b02c24b2b6, 0x01bbcac5b2656819,
+	 0x798776b6d4e0815b, 0xd6b3c7cff6d14717, 0x60fff114dbefceed, 0x7696dcdf37fba041,
+	 0x1d335ca08b925d2f, 0x96d9e7a7fc9113dd, 0xb8e2c9f51572b513, 0x1ba618ceb30897e8,
+	 0x1e030c8478ca5eaa, 0xc7aa96a7068ca425, 0x6219ad09d0ef997c, 0x1f564584c3164fbe,
+	 0x76882898541ab452, 0xd26f33c43dff3385, 0x4edb234c22a01112, 0x4205d0e95f49696e,
+	 0xcf5d1edecbcef52e, 0x930bbffdcd079153, 0x6d3d5c2475a17ca5, 0xa6fba76bc729ecb5,
+	 0x498a04a54a2b8336, 0xc6369fad1da06f6f, 0x78ee081fa02b8a43, 0x206ca7b097d5c5aa,
+	 0x2626314e4f6aca47, 0xefe0ee3cc1efab41, 0xb91fa4c9652527b8, 0x228a25d23e0e90d6,
+	 0x438a94e6eb02543f, 0x795ce42f75f546c0, 0x938c11ae2ce81641, 0x22960db56458a773,
+	 0xfff22ef104c7d002, 0xb95a2ad2b475a9b1, 0xcc0109197b4c69ee, 0xb1c25fd73717d93f,
+	 0xe65b1f3dc06c8167, 0x07faaef389633432, 0xdd0c7279a3f8425c, 0x89adbb95a4c8f3fa,
+	 0xc088160856eb39d7, 0xb61733061cc5d613, 0x38ebae3dd11083f0, 0x678b94634fd8548f,
+	 0xbb92021f8c2166a6, 0xbdc1a91d764246fe, 0x501af0db188af1d9, 0x204005ddc813c01d,
+	 0xf14295a6edc4a639, 0xd886db5e977bdf4e, 0xad4be8912e9795f6, 0x10274a055c9c7638,
+	 0xec96c6d42faaaa46, 0xc2f9aee7e4779fc5, 0x43f9ac6d8ab609fd, 0x0a3a44d2946c3c23,
+	 0x34dc742f9464503c, 0x8654095c7d03d873, 0x21605e6afb568347, 0x7dfb62e64a35bd66,
+	 0x66f60ecb988562c7, 0x45a779ca9c9da8a0, 0x37443c310904bce2, 0x5bc0a8c968c65b7e,
+	 0xbf5531fce9dfec26, 0xc187f9653296a5bb, 0xdc7b2e3aacd5db9b, 0x14634b613e01324b,
+	 0xed63555f1308af13, 0x0eaab769a77dd171, 0x085e92bd7b43eb36, 0xb0d904ba63408c14,
+	 0x5d9eefa1c81ff343, 0x8a8ba23483d85627, 0x0211600f00c5f600, 0xa61c46c7cfc4e2f1,
+	 0x421861ec5b0c85de, 0x2ffefeb697e0711c, 0x05ec38b0422c6166, 0x592ef2afa37ce8c1,
+	 0x0153ef5a02de7027, 0x2722b08048457e91, 0xa2be563cc3e48106, 0xa6df321459bb33fb,
+	 0x13f5aba443fe621e, 0xddf7dfe4757844cd, 0xae559d2e87532e9e, 0x19215edad15f080b,
+	 0xd4008b246130c9c2, 0x5ca1c5816abe521b, 0x49297a7fe2e40b4a, 0x886fe626496e7ffe,
+	 0xe0bba9f33a0d49d1, 0x6e58c44f1d1a5af0, 0xe5202571f6570ab5, 0x88649f6a8f2a6cf1,
+	 0xe96613f8c27543f4, 0x7a9ce54ba89c0085, 0x1bcc90228910562e, 0x24743a2894dda7a2,
+	 0x9d4294f47fe0f4e4, 0x7b4728c85e5c9b0a, 0xcd2c2e2160352aab, 0x929dd9d7e4323f34,
+	 0xe682c972e995b571, 0xfdef5b9ed891158e, 0x1f97d5152e95bb6c, 0x0e47add8a19a7eb2,
+	 0xccc3267604de6e2c, 0x722d6b26bc67ccd9, 0x2791156052eed35d, 0x8858b7a712acf210,
+	 0xba3ac4c9a7afc1e1, 0x555a7e37ce42b5d7, 0xac92b5ce903345f5, 0x28984ae76b1259ff,
+	 0xead406da285f13d1, 0x5f8f20d7d9827191, 0x1fae3e1404539741, 0x6e7fbf4e5ad86f97,
+	 0x4294a37f7abf7c73, 0x8959fa8075848c84, 0x84d3b17f4358c070, 0x906eec87d4343690,
+	 0x518ea4c5fa4f7410, 0xd3367d64caa20bf6, 0xfbf96fe0061d27a3, 0x12e9554aabe77243,
+	 0xf8342240d9f4e419, 0x2cd54e64149eaf95, 0xd14b35d82220fab9, 0xafcb43799386c7ac,
+	 0xb803dc6536f215d1, 0xd04efb29989b92aa, 0x85f8147b8201abbb, 0x30a35b2502d78a8f,
+	 0xd5ef5becd7c2e87e, 0x07ecec017c865885, 0x08ef5b9d488998ba, 0xab13575afb774159,
+	 0x66d85d91d4d7edb7, 0xdaf2eee481aa86fa, 0xa2fe23bc2ced5b3a, 0x86d850df52640be1,
+	 0x9042b85fe7ae22f2, 0x82e8730cbb30fa31, 0xbd52618df00f1d94, 0x9455447cf6bb8180,
+	 0xf2966819c48243f1, 0xa63202d671540e14, 0xfd4c0f31d8212f10, 0x5159347989b8cce4,
+	 0x2f8a9ecc3e9b40ba, 0x21062524a651c218, 0x492bcf286627b810, 0x37ff256be33b1f34,
+	 0x3bd5fd2227a28d33, 0x6fe9e2c4804f00e5, 0xf2931530fe298813, 0x879d8792dd9411e2,
+	 0xca6aacc81fc52569, 0x82bd915ff1c50248, 0x4745802495c63eff, 0x5723548514653ce2,
+	 0x9cda0fa5ac49b0ca, 0x9a5bc95374fab3d1, 0x8261a74fd8ce8287, 0x726c2b35ec6b7f3b,
+	 0x30d940fd437b7ac0, 0xbece95b5a6d26b13, 0xb35af1a8499b99a3, 0x971a6759ed92f286,
+	 0x208c72e90ecbe8d1, 0xff96f1b9b4989907, 0x8ce3b7c0469965c3, 0x63939d75c144a71c,
+	 0x65a2bec911a76078, 0xff6b84f890db6dc1, 0x51f0726fbf25e19f, 0x487e31780536c79d,
+	 0xd69a5e6b7c31c697, 0x09f9a30d5736968e, 0xbecb2064ca55f8ee, 0x6eecd57ea567c8f6,
+	 0xc19a3dea8db13ca4, 0x796042c4934a138a, 0xe5032182a454edc7, 0x9aadeac4ea93b76f,
+	 0x896c3691e561d327, 0xfa099ca768f1627d, 0xa93080092d3d24b1, 0x7f5976677cb2efc0,
+	 0x770244718cdcf6c9, 0x1195c8e11e876efc, 0x0eb97d5eac2c9f9c, 0x313528c80c039c4b,
+	 0xc8e356d2af864bb3, 0x7c426a877ac7a7ae, 0x4401d1bf93d00d5a, 0x73b4e7762359da19,
+	 0xfa223b0021431347, 0x242860e3f784ab0f, 0x0466fbabe57a032c, 0x91b819a139a0d772,
+	 0xfb1ac4342909f17e, 0x4d6f0009fb85c336, 0x93d62885cd016195, 0x5f4b3071559297cf,
+	 0xae35e0f789608cc9, 0x56d7e4608d0069e4, 0x1d5c67aa2ed0c27f, 0x8d58a8f0757eff47,
+	 0x347bdab8617c197c, 0x15822222768b53ea, 0x665945c6655aab75, 0x272adae32f8e6355,
+	 0x9129af2720b06ea7, 0xadab05e0cad7a315, 0x56a4395e49b335c7, 0xa895a841e03a6b90,
+	 0x4c269bef19e0fb01, 0xfe8a94abe6c80b6c, 0xed0f2ded9e4b5002, 0x9f8678da6b6ab2a2,
+	 0x78824a214cfaf62e, 0x06d1025e1e751ace, 0x526f552378ae0a35, 0x6011a6d5ff788a12,
+	 0x33580ab39c249a31, 0x14f3713537cad1d3, 0x7791da64e5a9a00a, 0xa550a805220b5e8a,
+	 0xfe080f2bba61bf26, 0xaeb9ea5bb9f0ed12, 0x8f9c7bbf8c78e3d4, 0x7246dc24d6f761ee,
+	 0x8a4f419d50362336, 0x0f27b52614274c7d, 0xc4d5b087cdcf0334, 0x5931cbd891bb80ef,
+	 0xa41a23a486495511, 0x67857cc28f124af3, 0x461b6de9c2d75f1f, 0x527069da0c4bf4b3,
+	 0x9e9fedc77bc89ad9, 0x863b7f163ac3b886, 0x2fa8dfb5446f8b64, 0x49f26660d1198f8a,
+	 0x3af910f0e9f8d4e1, 0x8b90dce8cf0e2196, 0x2b1b3958adb0fd13, 0x03a9602024245930,
+	 0xbb8cb6268b422c7d, 0xaa9ac9857e72f56b, 0xfdc7f55c595332e3, 0x31a6ac44f514a77e,
+	 0xb9887d0e458516b6, 0x803edc0d4228effd, 0xe6ba497bae3f3476, 0x2ac1a33c7b610272,
+	 0xa9bd52eb71a4ddce, 0x7aa0f5a9cad53a91, 0x1172c245dc042ccb, 0xac3ec15e7d88b1f5,
+	 0x6790d2708829c992, 0x8cd1e19fbf76c7de, 0x3e4c45694bb985df, 0xa923baf7042075de,
+	 0x5d3106dfa0803460, 0x25ebd1f1c11b0647, 0xb14dc0d6be709c5b, 0x0b15cfff071e980d,
+	 0x1ee8404b6fe48056, 0x1db51e49132d24e5, 0x9776a3d473338ac3, 0x2a4a129ce2d54597,
+	 0xe56e42012b641d2b, 0x1e712f77d623aaff, 0x0137041d8684fdb1, 0x905ca95c334b6022,
+	},
+	{
+	 0x212688fbbccf180a, 0x7179fe0c05b06b69, 0xe9fdf4ddfe6677b9, 0x81f97fcc743ce547,
+	 0x1b09592a3f8323f6, 0x9af99ec65ad30f03, 0x782d139a4a846b97, 0x7ca24aaa1b39d7ea,
+	 0x727e43f7cfe72002, 0x5a30b940935802f3, 0xe6e2b3fb038fadfc, 0x50b4240da46e626c,
+	 0x8199ce8b5d32e294, 0xd67eb613163633b1, 0x093cbcaf66550d14, 0xb38f528803873a0f,
+	 0x4ad6b48df371e12a, 0xf66c5254c6e9a33c, 0x282fe0e98e09736c, 0x003033e315ed4c78,
+	 0x09872add6bcbcecf, 0x84444b43e9e7ba44, 0x62bbdd4e17f9f111, 0x20702e691e28aa25,
+	 0x7ae934d4a41646e6, 0x07cd805453e4ba29, 0x2d4c4ddbcaec7592, 0x61d8d2e92d232ac6,
+	 0x7630dff86feaf91f, 0x471efcc57e0b4626, 0xf8b953f075f06aed, 0x8ffba6cb2c316f5d,
+	 0x5d6cc4fa7b15b6b1, 0x0af5295f5c087629, 0x63d0e7d544e36526, 0xb6233ecc4214d5ec,
+	 0x253592e894bb7df9, 0xb832db470d0e0e40, 0xe64b9b18e5316480, 0xa23083e83960071b,
+	 0x93c651de2d83af3b, 0xbcc52290be8b4707, 0x79af705e101acda7, 0xb3c80ed827bd85dc,
+	 0x12f9e77575084838, 0x5116e476a17b73c7, 0xae9b2f4519b82267, 0x1803e5608bbf6d37,
+	 0x32ff11387ce6d0ce, 0x0f3a607978e030ce, 0x466e67611c3f9e2c, 0x4f8844532da9f8b4,
+	 0x66a7be9bd3023601, 0xb33c359c5805f487, 0xa54085007d928b74, 0xacd7200a785916f8,
+	 0xf1ebaaa7521f6592, 0xde328158b2621907, 0x0cabb0667337b844, 0x4cedf92ca1511e6a,
+	 0xd00108a28ba11207, 0xa0392ebe9a6c4fc5, 0x4110a11c68866e2b, 0xb175e2cc3b1a7694,
+	 0x8a40b89c068cdd7e, 0x6a2de38048ed7621, 0x11d33cc63cc96434, 0x6926f90d3505e621,
+	 0x5e66de6eca44f314, 0x0a8cdf81e8ec1d81, 0xea43ce3257362098, 0x72ef7d692bae2541,
+	 0xfdda91ffb8819023, 0x8f78b0d361976048, 0x284e4463e7b0a4af, 0x6ee78f1d5d446383,
+	 0x25afe87c472f6361, 0xa41b78f107549706, 0x8e86f99108a237f3, 0x665841e24904c763,
+	 0xdd8376832da130a2, 0x2f12a3b9e4b10952, 0x77f954d5e8324d5e, 0x19e721d72d13379a,
+	 0x8d64be6bfb60b919, 0x70739cd6dd0b5714, 0x4aef52e54c735acc, 0x6e13c5fc9a451265,
+	 0x038ed44d2083e370, 0x1d534ddcf01b3ff5, 0xd46b0178f5446c02, 0x72b74fa6650526c5,
+	 0x4aee01e97de0812a, 0xeec6e0c24e0119bc, 0xdf6e69a571b0b22e, 0xb476eeb7a33f0f57,
+	 0xfbdefe2bf7ab5be3, 0xe50b9d14cf92d1c3, 0xb231b5fbb38a7068, 0x21698b5a2d1f6a49,
+	 0x4399ee38ca0741b0, 0x0708404eb888a34c, 0x4621875bc15b143c, 0x869c3f7dd01a1604,
+	 0xce9c78c6c1f6368e, 0x010fb730008fd4ae, 0xcdd942f5af31eb4f, 0x99a35e8a2744e832,
+	 0xb36a5d90d816503c, 0xfe3460f1c69ac4c7, 0x7add2e52149f9493, 0x0d3a293e4ac388bd,
+	 0x9cbf9be98cb5312f, 0xa5ca693f5183dc9d, 0xe132a45e5e4dbca6, 0x1c6c7da2cadc9864,
+	 0x6f8d6c31c6471fa9, 0x5628df0233179ddd, 0xbf17489d297cb935, 0x88af13046abb222a,
+	 0x8d74489b18bd8128, 0x856dca518b0a57f9, 0x36de16291e9e9c1f, 0x7965539f57f0002e,
+	 0xd6bce70c298011ae, 0x35a88f63e791857f, 0xa8830317fe00499f, 0x60ac80f4f9ed1594,
+	 0xc58ab8420e73812e, 0x07c310aaa2481fd7, 0xb6545b6c6ae29c6e, 0x4561151a14304b51,
+	 0x35708e85700ea097, 0xd08b1a027b6c9987, 0xb261b64c4c116d54, 0x4eae4853e051b7d1,
+	 0xfcfba53c7255d546, 0x23f79013fe38bdba, 0xe2f2e7fe27a48b73, 0x996648fb59b17979,
+	 0x2939adde677bdc19, 0x7a956d049004f9f0, 0xc963b0f2add9cee9, 0xa3b6bccfa7ac07a0,
+	 0xf60b73eb942cbaa0, 0x2a38103efc09560a, 0x5fe2c39db1fe4c8d, 0x112cc0e9bd3918d6,
+	 0x9d4dd93dc30c0d13, 0x9a7e7c33f3e9bea6, 0xb582da11db914799, 0x21cc94429a09964b,
+	 0x74690c5fe52553be, 0x5e6c43e0f11f4055, 0x063b1723c8e0ec0b, 0x418e1b9e7e50962e,
+	 0x4003325c398fa750, 0xc51611f1a9f924f2, 0x271431299124d192, 0x93f3c7075239af01,
+	 0xac40fc881753ff2f, 0x07fc68df60374b84, 0x088709b10c5298cb, 0x7218c16e53b92b79,
+	 0x9e1809e4abae32ef, 0xca5c215c2e10a7dc, 0xb58593d757fad30a, 0x1d9c175615f6018e,
+	 0x4ce7d00d7ee3d0c1, 0x2bd5841098ede2c6, 0xbd977ff89f60b48f, 0x0b2d67bd2170270e,
+	 0x7b8ceb895603b64f, 0x68f4bd4ba3778a1d, 0xbf6c0b35bc3c1c9c, 0x0e76bb6b20fbaa85,
+	 0x85a323487b79725e, 0x49e63f5ae0509f0b, 0xb24948ac9c6b8fa7, 0x130daf3d2c5c64fa,
+	 0x98cff905533905fe, 0xf67a9d38ddfd88b6, 0x39ab71e54b802137, 0x145998b15af71217,
+	 0xb78bfad176e45bc8, 0xeb31d9882e5d67ff, 0x2cf3f3d7df8c0c2e, 0xa8639acee70e232c,
+	 0xbb34f824bf2ffe4d, 0xf4e308bade2d4d71, 0xca27de3e789042fd, 0x22d8d8ba86482a11,
+	 0x7248ade0987c6468, 0xaccad7428569cc32, 0x85abf0d6aadc86ad, 0x27baa4541e8c0cf1,
+	 0x049a601e4b2bd088, 0x19d0f9d4d9650023, 0xbe828c4fba5a40ef, 0x15237716f5c23cbb,
+	 0x962175f5b579453e, 0x560fcbdf7ffb4925, 0x611b36be6d98ca7e, 0x89a98acb75344858,
+	 0xb4e85349e882b66f, 0x7fd8faaa8c9d009d, 0xaed6732b8da22f66, 0x034b04a27851a5f3,
+	 0x311743c20db905f1, 0x3d975421f5abbb13, 0x366365b6a1ab9543, 0x11876bde09865008,
+	 0x957aa33e138fadde, 0x672791c3c425adb8, 0x00fd5be640054a12, 0x3922a96b9099bddc,
+	 0xafcc130982655982, 0xd2f920f28d370b12, 0x0936b8e4ccb9aaf4, 0x6a3eef80d6940eef,
+	 0xc33f3f4b720b6fe2, 0x4a747c5321d7305e, 0xb074534a585d5438, 0x7e2ff980564192de,
+	 0x5374454792a400c6, 0xfd1c6b09e68d317b, 0x7c01cd2c29d885ac, 0x7ec8fe4f86e20703,
+	 0x7b14c23d61be3aa6, 0x7630efa881e49859, 0xd068b0a888996f19, 0x84eac18145b0e7ed,
+	 0x7810d725264df207, 0xf2d933f590f683e4, 0xb4d8ada176198d5c, 0x5b0fdb86f713148e,
+	 0x48d99a3685d64cfa, 0x25d7ca7fd81343cd, 0x4a0137b77d541929, 0xaa73c71363056cfc,
+	 0xd740eee1d8c19d7a, 0x540c1a7e7438a79e, 0x7f1405a3e06e56d8, 0x691941aa937eb4ba,
+	 0x1d83792df41292b7, 0xe0a1283e1fe3ed74, 0x28749f4e4aebae27, 0xa12c8737c3c66c33,
+	 0xd68465988aa5f685, 0xe936b85ac1c5d18e, 0x4bbd8c0ac60b1655, 0xadbd91ec35410e7e,
+	 0x5f8757d2984eb541, 0x46f97e4e4863d2f2, 0x8907cd6cf8422f01, 0x65b972c42db777fe,
+	 0x024e0e87698b988a, 0xd9dc71197aa6c649, 0x1ff6cb82e3c4ac4a, 0x28bb7cb9fc095dec,
+	 0x7374abecc1a05821, 0x26313d42280f9bac, 0x7ce6998d44bdf70c, 0x6caebe1d50fab71c,
+	 0xde26559d4b97584e, 0xe3f56621d01e52bc, 0x6d94ce4842040ee7, 0x849c3377386f48e9,
+	 0xfd2ff92705ae7036, 0xda0eb86cc8f16e4f, 0x2049de6433d9a9e4, 0x56d2129085f60fb4,
+	 0x26b590b4306dc3d0, 0xc9c242ba46676f02, 0x21aed3c9ed1027d3, 0x525cb9ae65160fb0,
+	 0xff02bc7d48e575c5, 0x723949bc22c503b1, 0xfbea0a7939a7b29d, 0x2c32e436bd669110,
+	 0xb7e7acf86628903c, 0x7f3a20269cd675a8, 0xabff07ae5b8f1caa, 0x2c9f66ee0d408b0e,
+	 0x61a64e88a5bb870d, 0x4dd8f653a2dc7216, 0x2fa7b9c616a40ec3, 0xa3a25d34bedd5a19,
+	 0xc027f5be47ff5cf8, 0xad72fe13351c7b32, 0x3cdc8d2092545d3e, 0x2b0e58da64b94de7,
+	 0xa53a026c5cebf253, 0x3dfc07e446d7bbe9, 0x66a36d72908a8ad6, 0x0e05e67436eda99d,
+	 0x36f57495788f4b9b, 0xe9ed888cfead162a, 0xebd0ea31fadafeb1, 0x99d15dde87d757bf,
+	 0xf1eef37ea72777fc, 0xc51fc20db3542c2a, 0x8dfa34730b34b4bb, 0x99c27f46129f9ce3,
+	 0x79261efedb9657ef, 0x43dc86691e5f367d, 0xc3f81b81e8de24d5, 0x5954017cefb92757,
+	 0xfdf09a448f904861, 0xcebff1812b35128f, 0x6381fc1011b987ef, 0x911bed9aa0c6e2c7,
+	 0x5dfdb68ee6ad06b1, 0xdb8c92f389b170ef, 0xed92d1bd7ef5d78c, 0x9ed254a65de7e627,
+	 0xffe71c2caee56485, 0xdc342622ccfe3a16, 0x781af2a921100264, 0x30c346dfe86b1d74,
+	 0xb7687bc4d81cface, 0xc596a5beb9533449, 0x632d93537b18605a, 0x0ac3a17dde22fee3,
+	 0x388d760c02d459fc, 0xb78820972102e29f, 0xe5aab6e7cd893d83, 0x45fcbb69e91c7899,
+	 0xce1ea115c2a2a856, 0xa8c22f21c8d8ad8e, 0xc819805dac60d128, 0x0320fdd67b0b0b9d,
+	 0xd5b13b80f3719dc6, 0x893c145f2526776f, 0xd40d6dcc47d9edca, 0x7b51edc95c0e6442,
+	 0x095ccf7372884830, 0xe16a405cb74d06d3, 0x566d1287ded600cb, 0x44f8c869d2a093c2,
+	 0xfc18fd526fdc141d, 0x2918754cb54af834, 0xf07467d914bb5a9c, 0x3bb1af1d44e5523a,
+	 0xf08b20c60fffd795, 0xe2d1717e19aad81f, 0x7780e8b7156925a9, 0x7115f93557248493,
+	 0xc130f3f51935926c, 0x92f6e0559f1a6429, 0xf4ea7a1a51f28d70, 0xb0682bf2aedb83b1,
+	 0x1190510d21b990e1, 0x27ff25ffdfdcecba, 0xcc9a3f53b1c7e2fb, 0x9ed2e74b102ea51e,
+	 0x0ebe4ea1a2f2c6d5, 0xc193b591bd93dd09, 0xa1aad434e8b0a58b, 0xa1f09d4170746dfb,
+	 0x8e0b308e9f732bd3, 0x4ce14e98f92f45a0, 0x8d40665ea96e7eea, 0x8f6ea4d140a218aa,
+	 0x28a581bc22cbbaf1, 0x41efe08b4fc8157d, 0x8c2f5631acae4a54, 0x939b922a7381abfe,
+	 0x984ae5ea6ef0ce30, 0xe163f5e943598f37, 0x33423f1feba56251, 0x089a085bdfa24363,
+	 0xa42988ce177102d4, 0x25e3f438735f404f, 0x234630780e483b3c, 0x0b4ad7336e6f29b8,
+	 0x027ef1e3974a68aa, 0x2e7ee666e80abe74, 0xc2b2a824413329d5, 0xa6055d19f4537cb4,
+	 0x699c9835eaa6d9bc, 0x935101fcc1bf95e1, 0x0fc4791251796f73, 0x6d48df1297ffba5b,
+	 0x7973ae8f9b405575, 0x5a6fe020d6edec43, 0xa0174734083793ab, 0x0a090f980d0d2a6d,
+	 0x2014b4eccc03ae86, 0xb8a5b12ba90d3ea3, 0xcf27b07be8dd55b5, 0xaaae81b4755b7101,
+	 0x782fe186ece6db7b, 0x6275e3983f44c649, 0x72b41deeb44b6859, 0x6d6f829c94b5b820,
+	 0x9bded27609fb0b4b, 0x23e887867cc71d51, 0xb9997700cbf2ac6c, 0x6d4571bb92a644ec,
+	 0xc37422d05c71663a, 0x8d3b0818c394bd4d, 0xbd364f899575c71b, 0xa8ecabab2016ea1c,
+	 0x991199152ba3a08e, 0xa948b4dab937cd23, 0x2bf92ab11fbcebf2, 0x2a23029e9173e8e3,
+	 0xe6a4cb943c3cc054, 0xbe9eb9ee010bde88, 0xc5dda1203123047e, 0x1ad0b6f480e47659,
+	 0x588bf433be1f08b7, 0x7aea74c6e98a65cd, 0x8349846b703fdf3c, 0xb50298cb54cd2921,
+	 0xa6ff0d022968f851, 0xfdcfe044ab0607ee, 0x8a123143a79d0e1e, 0x030df012a78475bf,
+	 0x3c4235c342b5676d, 0x710abba428768a85, 0x733fc8272844a196, 0x5b7771f87720664b,
+	 0x152f5930f278cc73, 0x26105b00354683ca, 0x43ed9cf8dc028272, 0x238d7f7cfaf97f8e,
+	 0xfa275d0ab542790d, 0x16e35841e9ab5d23, 0x03912c1610e3aef6, 0xac7368aa3c545e18,
+	 0x89b3d04c63721303, 0x86d9bf45b8d08561, 0xe4cdf1723c6e25e1, 0x20e8a77ec5259d31,
+	 0x6e58dea0f098ffa4, 0xe45786e0493b5055, 0xb1be70723d22b812, 0x7325baf060bbbd2b,
+	 0x0119617723fcd07c, 0xec2e91d5c3338124, 0x73135fd6f8e794c0, 0x6dae537c6ae776d8,
+	 0x859357239245947b, 0x82333b177e2c4aec, 0x1b84c54ef6615930, 0x61a7934185e5e83f,
+	 0xffca9518baddddb4, 0x152f7bd27c9b355c, 0xc9a20d19607fb016, 0x9f74721a17e264c6,
+	 0x1199a036af80e0e5, 0x6afea83839aba744, 0x6e20cab97d394892, 0x984d864aff6167ca,
+	 0xee1b925adedf8fa1, 0xe9a5e3d922be4b1b, 0x61e8434bc9c54f01, 0x909403c812ac047f,
+	 0xdd277d3f9cd7bf4a, 0x253ccee04f866e37, 0x579672670dace8dc, 0x0ace5966100c386d,
+	 0x235f333b3cde4600, 0x6d2cdb66b35bf418, 0xc94b2af423d665d0, 0x144b1634cbe2c769,
+	 0xd9081ae42b76f1fb, 0xc82a96eaf44cfd73, 0xc22a9ab07ba768fc, 0xa818f087992f0c0b,
+	 0x391e0e6e31e58728, 0x5d2ad1a2ccd41795, 0xb4afed67fce59bba, 0x3d47ab32c8dad1fa,
+	 0xb88aa1f0c22b27f9, 0xfd99e870296460a6, 0x63723b5ecce0746d, 0x32310e64f2bb7fa2,
+	 0x815e8ca1a29eb522, 0xef21a29d97b448da, 0xc7f154f3592aa07e, 0x09bfee3ee95c84d0,
+	 0xa9619704d7a37d2d, 0xdab50ab2ae40dcbf, 0xa41033564f410f61, 0x50995bb820259168,
+	 0xb7da04d0199c47b0, 0x29fd1c99ea22381b, 0x17ee6d6e3f72363a, 0xb1270e199f80688b,
+	 0x91da5e3d3cd0d352, 0x69de87fd6f18082e, 0x252430cfafed2f00, 0x719e35fde24b252d,
+	 0x249b26fa4e4a9842, 0x1654f7b7fc25223b, 0xd32f37ea90300e94, 0x9fe905a2d9b25f22,
+	 0x20e91b486455c8bf, 0x6d7f7b566bf5df0e, 0xacb1339251fcc892, 0x34fba64e7b526aa9,
+	 0xcb34ba05ea62cf9b, 0x09117f4d988e924f, 0xcdc24650824f35b4, 0x710a1085b40b7658,
+	 0x2b5fdc004b61035d, 0x91a99899dc0a5c93, 0xa5c9413851022e75, 0x95beb8c070e509df,
+	 0x5c646e11a36355b4, 0xed98019d90f22dac, 0x91b63240dc02ce52, 0x969b5b4ac2eea75d,
+	 0xc2a6b6683ce29136, 0x148664997f81c984, 0x589fc235bfd365aa, 0xb10882e5382a9d3a,
+	 0x963b3cc5b6b02d49, 0xb1ba650e2c97e7cb, 0xbe5a79585ea0e878, 0x5ccc8268c5431b32,
+	 0x11d0a30f6a5fbe6c, 0xff7a747636d42ee9, 0x13914627669a1431, 0x03d718381a31e65b,
+	 0x1eb61ed75721ebfc, 0x0c8844b538aba537, 0x93e449389276b53f, 0x856f12ca15aabffd,
+	 0x92d31d32e2c2895c, 0x777f1e6002a5032b, 0xd76b9eb6ddb13b3f, 0x876f223895a9c8e9,
+	 0x2d8dc8b94a298387, 0x45c8785033254759, 0x4da4053b7b4596c6, 0xb192d57b76fef64b,
+	 0xb1754c41afd9e716, 0xf16d26d2d69e38d5, 0xbcaf7a3e8cd54007, 0xb02a956b8baa1914,
+	 0x5814ef0d6158e9f8, 0x9d01196ff657b410, 0x121658fabcc358ec, 0xab45f80bd372495d,
+	 0x757ff3ab015c76b4, 0x291e86d9b664e950, 0x8bc006333154d1af, 0xaec6458ac7ab153a,
+	 0xd473b990256f8980, 0x630739913786e76c, 0x78c5e29f45739ac0, 0x189f1db97a8297a7,
+	 0x52df128e9891659e, 0x8886de9201196453, 0x1ff0151a1ddba641, 0x87ddef88ccdd50e9,
+	 0xfbf72d254cafddc9, 0x4e3cd195e64607b9, 0x7012edba17f566df, 0x660a291ca422ea3d,
+	 0xf57f30ef7c5c60c5, 0xaaa27d39e8cfb591, 0x7b33d91c2c06eb59, 0x7abf0b2040158164,
+	 0xe9df7e8031e49580, 0xa50ff3dc5a6df9b1, 0xc2be2e920fd88bfc, 0x036808fcc1658e89,
+	 0x5f330c69a21aa6ae, 0x3886e8a001b76c73, 0x4c96b3dd1a1b60ce, 0x02c6f8a202004fb2,
+	 0xca9598524ba6c44f, 0x29afd88de4e080de, 0xf43f9bf2362f76b1, 0x54b99b56ee6918a0,
+	 0xa65814fb7a4685ba, 0x3053795dc1108526, 0x45c538f3bcdb2952, 0x2f28b86f4f356e18,
+	 0x6b682bf648ccfef1, 0xf230329472f09854, 0x8a8f02df7b4468a6, 0x676ab1eef19d14fc,
+	 0x3a13481c55ceea70, 0xe869fd5c2339751f, 0x1090e718f8167db7, 0x44704db4c5c8936d,
+	 0x2dcc56faac9a9762, 0x4bd6356abc791477, 0x803ea7c6f63d029a, 0x06d578446ead56f5,
+	 0xe5d29a6a82a508d4, 0xd1a656677f2ea338, 0x2724d99614a35276, 0x755e53467db991a8,
+	 0xe625b0ac8bcb8f1b, 0x90b14e9710346420, 0x285630ed7321696c, 0x2e10c73b276adafe,
+	 0xf95d83c485740f24, 0xf34aaeb79cc334b9, 0x34626b9d00c500bf, 0x2b622466f44c02bb,
+	 0x7335ac1aa09d8375, 0x2590b93bc09e9e38, 0x8fc41435d9a926b9, 0x1fd28a644bf25657,
+	 0x0c2aea87e60d0716, 0x7316a9b0e354eb88, 0xb7dbd74800b5c795, 0x420b4b52abf303e0,
+	 0x18d2375daa35f18a, 0x043e2c1b8f14a58e, 0x50412659d49dd978, 0x53fae864bc508659,
+	 0xdc1eea8092df48c5, 0xb83456a631f746e5, 0x404b2316743dd2ff, 0x536ed0233f3d8940,
+	 0x03df32acc63ba349, 0x68a4a6ad12c6b77a, 0x156c106e8650dc43, 0xaf147cf1d4a0c69e,
+	 0x46d7691d76b77aec, 0x7ad002def55b4177, 0xfc97a0da0e587272, 0x23abb5d52bf58c40,
+	 0x0743e2f82ee656fa, 0xf5ef0065b9f65c4f, 0xced33d8d5b52658c, 0x8e94d36c6044f1f5,
+	 0x5eb6c37b557f9750, 0x4bfcde35bb48e6bd, 0x64ab9b008098bee9, 0x39c6e4cfc2122aaf,
+	 0x3e36f5402c675e45, 0xcf4023822a94a95b, 0xc8561c3dc3b92079, 0x4cffdb3342a312cd,
+	 0x99cdd0baa04179bc, 0x607b8ebe566db259, 0xbbb2645500efae46, 0x144a66792d2ebc2b,
+	 0x978874540b32d2c7, 0x56c0c22b26d92154, 0x353abbe6d20a8aa5, 0xb3902c3a3757362b,
+	 0x9842755db22ca786, 0x945d77467b78738e, 0xc42f2ba7ed3cca28, 0x8830404f9dde4a51,
+	 0x6ef028d8053ec730, 0x59cff8d0abac41bb, 0xff4bba87112d505c, 0x6834d0ff7267f0eb,
+	 0x2ace97d150abf1af, 0xc7383b74ea874282, 0xfbf213f6d2e25201, 0x21ebefd3a179b973,
+	 0x9a6cb7baf142a3d5, 0x51d308de14f9d379, 0x37bc442407c7183a, 0x83c3ff53727608f7,
+	 0x65e8a657b5707579, 0xd412d7f0dcd31956, 0xc4d60bd26610e329, 0x2bca2cbc915ca7b3,
+	 0xaf25863b8b2f7884, 0xc68fa26e1c5f68c8, 0x704646dbd32f8b3c, 0xa0cd3b3d26bd3c51,
+	 0x681ae84755b98f0c, 0x0aa3e08ce8ffbc61, 0x93f715afa91797a9, 0x3ecc0c328777da3f,
+	 0x7216c78257763401, 0xd0679c84a62c57d6, 0xde23804ea8d8f032, 0x330d6b9bef357633,
+	 0xc4f4c862598c89aa, 0x352bbebcbe6a610b, 0x2feaea2d4326e34b, 0x6a66c45b564e2c48,
+	 0x2dd64e9893fe6204, 0xfe2837e965d32bd6, 0x34ddc14142b9e500, 0x15b4ed86943ce891,
+	 0xe10896393df07951, 0xe9d6db06a8cb16b1, 0x0d212439e2aec406, 0x0d88a1346c8ed000,
+	 0x05163f92c2d123db, 0x5a9794664ab77cac, 0xd237080a9c839e15, 0x266534baf4a79d8f,
+	 0xa09c0b72a3aca442, 0x6836d49ec315930f, 0xd431d467a102740f, 0xac56f759b9d2d490,
+	 0xa0262a0888c1869e, 0xbbeff20cbf82a1dd, 0xa4360fac0305eac5, 0x7468603a684dada4,
+	 0x1e9f32f5f80434c7, 0xb994a81130dca9bf, 0xaa83f206e0ae6d73, 0x841dabf7be19cc85,
+	 0xcf23175818227989, 0xed9ec2811284dd7f, 0x6ee4a383287a04dc, 0x2450c947f2d52b4c,
+	 0xc4b4676799935f44, 0x7615f2943790bb96, 0x9959e949cec53d61, 0x764c979b00ff0a40,
+	 0xcc2e802cdd753dab, 0x3c1d5d9e77d743a7, 0x0ee88e0b60c422dd, 0x0a34fce97cbcb7ac,
+	 0xc00e5a91a22b4e53, 0x3eaf6e8cdc012714, 0x31b21ae31801c44c, 0x4768fcb864cc774a,
+	 0x9b4ef7a47e75f13a, 0xc37fea7885128d9d, 0x03633188a1725781, 0xaac3a7edb269716b,
+	 0x965d24f69a2150a3, 0x2dd0be2afd19e8b8, 0x1765450f558d54ba, 0xa5dbe7d061b5837c,
+	 0x2a2afbb708e8cb09, 0x55686024145b88c9, 0xacd10cdb1b545888, 0x5bc0e7add1e4f3b8,
+	 0x5ea33618b296ded5, 0x968d441c4a3cfab6, 0xe2c97154620996ae, 0xaebcce4b8715be3e,
+	 0x21c4902c9dad70c5, 0x5d6baea28415ce29, 0xb6412a263f4e7e49, 0x217acdb21cc65e1a,
+	 0x86f4dc5b97f1695d, 0xce8385bde1048a06, 0xeb6629d06858eb5f, 0x98f5868cbb977a88,
+	 0xc31ec212abe35aff, 0x1b55732559cc1e52, 0x274b76a8fd8b0544, 0x1132707197f59bf6,
+	 0xc9420460ca6acabd, 0xb4ee24ea899679d6, 0x046d5163261d2afe, 0x92447272dfdccd49,
+	 0x31ed110d4dcccafa, 0x8a866dff57f1a184, 0x7c09f4b44600e2d9, 0x4a8b8fbe39a08ee1,
+	 0x5be49ea5c50f9fb1, 0xc9ea3ba0948e8aca, 0xb403ba564a6d0388, 0x95d9d65469e87795,
+	 0x84065f0fe718ca4b, 0x43006ce60167f8a4, 0x5d826ddb6f669d5a, 0x761875e07fdc45ec,
+	 0x2455ced225951489, 0x316fecd4b5704cbf, 0x46e8a54be63e2f57, 0x7bd653147b854bdb,
+	 0x5b0dbfd3860ad497, 0xe94b277eb68255ac, 0x694c77d11f786bcd, 0x7e68f3b0ed300cf1,
+	 0x13a92ebf5c21e03a, 0xce52a03ddeb415d8, 0x8873b4c8b2ef9db5, 0x7caca95090fad062,
+	 0xab0fb0ebb3135b29, 0xc98705318c54e045, 0x7f597a5581e1dc39, 0x23ed97934d94b894,
+	 0x98875c0183f382b2, 0xefbdeddf70afb4ff, 0xb2860daecacbd272, 0x6c061ed862829490,
+	 0x7e8ac6c67e3b9f26, 0x4cf6745b30668bda, 0xee8722a31d5e8a89, 0x3960741881065060,
+	 0xc8844841a70fd082, 0x6747bfdd2b3f3f53, 0xc221279611a208c5, 0x1fcef40a44035043,
+	 0x823270447a2e036a, 0x842e6644ffbc983d, 0xc55122510ba49092, 0xaaeb18dcece8234f,
+	 0x2e395304d9f18d10, 0xbe9a0053cf2152f8, 0x75d86f66a18d42ca, 0x940cc16f0b4f7f99,
+	 0x83cab7fed28e2061, 0x72e51d7cc4536014, 0x44e576f4194a16db, 0x765aa2af334fb393,
+	 0xadf46aaf4b574f26, 0x033ed52b9fd052ed, 0xb3655d0b485ed87c, 0x80486988343ec1db,
+	 0x0f5ff939b708dcdd, 0xf8cf95fca74229ee, 0x5d1ceee10765b2fc, 0xa75505c79d31a160,
+	 0x352c2c41b2707e9e, 0xded1fe8bea335a10, 0x0650cef80eff7dcf, 0x424d9262f6426b53,
+	 0xdbafcfeec0533f3e, 0xe6eb14630f7e5178, 0xfb8bb3043e53bf47, 0x498bcec968a5353b,
+	 0xb5b088fa05209ed4, 0x2a046fcbd083c4ed, 0x9056cb4063508a27, 0x72f292f21cc0e674,
+	 0xb922f1a60db0ca38, 0xfd479956c999dc69, 0x513248d063d39420, 0x29ac81600c0af9b8,
+	 0x87840d0f98985c06, 0x4a7eb5f8d4bcf4b5, 0x8d68af8aa4392c82, 0xb2d0c9ebbe9c3185,
+	 0xa37ae4771b4f430c, 0xcac17673d4852cb5, 0x2d39b3ea7ec5cd2f, 0x5d8e0e2fcf47aa71,
+	 0x57ba356b4e517b05, 0xece425fd9b493245, 0x4178911b0de2eb68, 0x7b3c95573af1fdee,
+	 0x277ca0dc74598cc9, 0x5d252bc7a3f9572c, 0xc42cc294559c769f, 0x01c90204cc7273a5,
+	 0x0df292b63c3b4be2, 0x4b09afbfdb4f81af, 0x8f78a4896aa59ef4, 0x7ca96daed4a12337,
+	 0xd42865d1abffc92d, 0xe7d63c96d8f397de, 0x9088ae0f60e76e2c, 0x03a10676298084cb,
+	 0xe9d1178bc3654eb8, 0x8cc6f9abd9b6e4fd, 0xe21772daa9e206f5, 0x2317636439d270d7,
+	 0xd07a08035b611120, 0x7971513046b64451, 0x5bbcd5ac2f0e0fba, 0x255468233baddf1c,
+	 0x7212122fa14584ec, 0x55dbdfaf748ca84e, 0x8b2230e366414ba7, 0x0ff591fb296e6a60,
+	 0x5e284be8e7264b04, 0xf79272fcc275ec2c, 0xd5ad3d731b46d32f, 0x4cbe89a93a360e8a,
+	 0x8a8a7b23410edc6a, 0x0749bf72473fe859, 0x2d3d947b3adf3c43, 0xb1a48c2efb838458,
+	 0xc18928379a500f60, 0x23c38e51288a9635, 0x893a6ddd077e5e56, 0x9c0b046466eec04b,
+	 0x83c5c86eb7ecf528, 0xb926015793058cff, 0x970f1894ee2f1fe2, 0x7dcb408ba86e7920,
+	 0x2a5d83e6fe83adad, 0xd79f7cebcca643dc, 0xe63d82c46609ad5a, 0x905ce146c33eef6c,
+	 0x11c56896ffebad1c, 0x4202426c558345b3, 0xe00a86b54901c6e1, 0x6dcc79a470bc07b9,
+	 0x8fe54a0df6a36a61, 0x612294ac92391eaf, 0x14992ba387fe850c, 0x081ac1181541ea8b,
+	 0x02c73bbe64510372, 0x00ce5b034bb871c5, 0x8cd52941e98160a5, 0x738250e18c80c34f,
+	 0x0e633eddf7ac5ec7, 0xf1cd02d20937c979, 0xd44e778cfdb68b86, 0x9b5456504c04d797,
+	 0xad51d659e3d8bc0e, 0xc795789882b558f7, 0x4003fbe9457ca5cc, 0x03522fb024169b00,
+	 0x5556b440647aa0a7, 0x8ab2be7551be40f3, 0xb83c6c6d67ba92b9, 0x3efd01d3a0fc247b,
+	 0xce5d2a2cac4cacda, 0xeab26b7a568aacd2, 0x1435f285508a0098, 0x28c690e3c3997e7f,
+	 0xbf29023d9ef5a63a, 0x62722270c3e4d5e2, 0x394acd28496241cd, 0x4942517d0af77373,
+	 0xa9d3d6bdf78bb787, 0xf76424b789c79be9, 0x2a77816a6bfa2631, 0x55844bdb4ebf097e,
+	 0xe0b582011394afa6, 0x61a0efd8e19b2eb7, 0x621fc45c28ecc8c9, 0x52d1993643cc1ba0,
+	 0x51c8546dc730d37e, 0xc836ccb1dba548f0, 0x3e7d2e612f9a3ee0, 0xb3cd6c531a27cfcc,
+	 0x0c7fa9f8c1bad83b, 0x9d26a8c839515ba2, 0x4561a22cb0797b58, 0xa2774f53334e6e65,
+	 0x55482f1f8e0f940a, 0xf39c649e4974f592, 0xbefbd26778502a72, 0x9e2cc195a29d9d21,
+	 0xc3352414654fe00c, 0xcf3335012fd7e0e8, 0x9a36700c524205a3, 0x03846eb35101908a,
+	 0x42ff21c960b6f2ea, 0x2c55760e1aafdf9c, 0x8142dd9b7c9fc71f, 0x29544e606f8b3107,
+	 0xdb723568022f4d89, 0xb1f2c86d68f0d3f1, 0x765538eacd217e03, 0xb3b9fc8c23c758e3,
+	 0xf2ee93456a9e7740, 0x0ab1109f7a2b3c49, 0xa6b0471fbeb11eff, 0x20a3891f059d11cf,
+	 0x1ed48017c95b468b, 0x46808711bee99418, 0xe69ff585cacbd599, 0x1da0479475bbba72,
+	 0xa87dafae25582078, 0x520033363a722568, 0x6f6cc9e03a26c022, 0x5793e05ddfd9f7c0,
+	 0x88fdef2a4f30c5d4, 0xb0e52da07209cded, 0xbb6b3461c5a21fe9, 0x492c9686c9b9d164,
+	 0x3ab3e9fa85884e74, 0x435c097227c3b088, 0x4ecf820bfaef0216, 0x8bf11a2b14479bf7,
+	 0x802370f379f4e574, 0x3af544f8e0d44eca, 0xb5466c7e72612698, 0x44eb9882355a4264,
+	 0x38ffabcd80f8c449, 0x86a683e3e74da33f, 0xdf900b816ac2b557, 0x020816c23a015082,
+	 0x3b4ae2627adccada, 0x197c7be21c149ebe, 0x554fbf4993a5b86e, 0xa9e91450a5099b8d,
+	 0xd82cd0fe153ca8ce, 0xee8d56504ece339e, 0xb3bf0c1ea4a89935, 0x82915f7238cf8d6e,
+	 0xc83fd47c3a846625, 0xb42966a903480421, 0x4db15bb1face16cd, 0x478e15498c09c013,
+	 0x3150dbc0cd7ca4d2, 0x16874a06c823f4e0, 0xa07f8d14b6cec72c, 0x56f8315176dd7343,
+	 0x9c7e65ffc23cd69f, 0xcaf3c31bd13f2186, 0xf7dfde311cdf01ee, 0x14cdb7228876e73c,
+	 0xf241e2f573ba05d5, 0xbac003b993ad675c, 0x630220479b1409cf, 0xa6a0709b9b2254df,
+	 0x7fa403d56e6e5b83, 0x278ad51cd3869979, 0xb885a76c3dac29cf, 0xab9a371908bce5ee,
+	 0x6578c57771cf1d30, 0xd780442eb98fd865, 0x5ec8d00202b4a5de, 0x71f73ceff331dca3,
+	 0x90e46ef2b1d66083, 0x574adb5f7a54343c, 0x0aafa25458669e3f, 0x3addd8f91b86658a,
+	 0x110e94090bb4dfd2, 0x1ad97ff2a1747012, 0x0a7818ab7159a227, 0x9942f42f7ffc75e5,
+	},
+	{
+	 0xde22dac45f2554e0, 0x98a5a755a1c98053, 0x0c56300c91f9b943, 0x0c8e1bff3b6bde03,
+	 0xcf06acfdd1d281de, 0x7ac7c8337a26eb07, 0xf2513eebb0e28c9b, 0x7818fca6c6c9bba3,
+	 0xcaa995071dfeeff4, 0xf4fa553c958769e7, 0xe8ee2309cbc4ba94, 0x0f013863bae95d08,
+	 0xcc7312976e75ca9b, 0x3818d00c871b97db, 0x1fc66e70b477355b, 0x4f6e4582d1e0bd96,
+	 0x6fd59fd80cf70183, 0xad23ba2161d298ae, 0x8296659d5d760bd0, 0x91e536de3454952d,
+	 0x3962cd5fa3c94e91, 0xdd5e13068074ae0b, 0x1ffa9b353e87cb37, 0x0f9ecd2fc62fec38,
+	 0x7def443229595445, 0xae4cc8598bf012a6, 0x3c3e7703a9a5239a, 0x314f200661a5fda3,
+	 0x6ac5694e1b1a1594, 0x1d320c4dc22beb7f, 0x08fd1394d8d53b74, 0x9d0578ee342014d7,
+	 0x721958bad0df1fea, 0x971b6c8b5d15f279, 0x5f1339519011e964, 0x6ceed442bbe60a29,
+	 0x7baef5db4e0ed771, 0x9b29e6e6ea3aa25c, 0x590307ab353d5b1e, 0x6c9bc3242a8f6da2,
+	 0xa25f426544236eef, 0x8fa6edabfd753bce, 0xebdc67c3420a8794, 0x1019b1f48e7cf54b,
+	 0x68d224ed775061c9, 0xd8d78904b4cbd4e1, 0x3fa60f2c27e1a674, 0x7b33f65824640f74,
+	 0xbd6a5ca9ba6cba69, 0x414e47efbec5be1a, 0xb21f67331cc756ab, 0x51ebc6d9dd083524,
+	 0x55c4bb48b02630aa, 0xe142f1c78cc95901, 0x22cadf2be560a747, 0x745701055545649f,
+	 0x7b2c51479dc899bf, 0x32463764acd59eb8, 0xe1a18e8c9b6497d0, 0x85c58b5d3c4feb5d,
+	 0xc0338c454b7099d9, 0x17cee5ef5ea61e3f, 0x7eb31d325c9c1913, 0x08bd26c92ada6ec3,
+	 0xbd48e42cd795e665, 0xf8afc932b56a87c5, 0x23b0c97360a06ae8, 0x9beba47f98f2911a,
+	 0xbb596a8f3d2060eb, 0x00619f1766e2fd25, 0x97eed8a9bd921963, 0x293c2c3759a38c35,
+	 0xee28ed2a2a2335e2, 0x931a8f00521adf18, 0x7cbfc7a4eb950a13, 0x370e41453788dd48,
+	 0xe5efda5c9492c15b, 0x756649631dcbc466, 0xc50d16eef6a97410, 0x06faae37e5d3e98f,
+	 0x6c5fc1063f786d50, 0xe3539e5a3571a1f4, 0x3e18980814409994, 0x54c75132cbe6b42a,
+	 0x4b13bfb02a14ca1f, 0x753c7173835d4fa8, 0x2e433af20f239814, 0x0a44163b0dd11e18,
+	 0x8c02a12d2d5a93f1, 0x84451f3416ef2679, 0x965eacefd5677b2f, 0x50cce27095d1fd01,
+	 0x59e9c172b045a80d, 0x773cea536e38dde0, 0xb94929a5bc0fdb0a, 0x9f672737f6ca547f,
+	 0x36a65d454dda0ba0, 0x6c31bcd1399f0a62, 0xd510a193d1a7e852, 0x444ccce769208b55,
+	 0x8b686b7c5ba98b0a, 0x39ab7722de265851, 0x59224c4df4ec1ae3, 0x4adcc3cca584f9f0,
+	 0x1a9cf2ade69042a9, 0x5ea76f59a5ec3712, 0x9b05d49ef3d6ab70, 0x2fb9e0b9d4c85304,
+	 0x1e48d5020ea0d7af, 0x4f89e63dd72c77d6, 0x2bb243735b30b08d, 0x52cafdde8b05906d,
+	 0x88fa4d1835ec1455, 0x7d7577850745f637, 0x47a8b64c21bb7dec, 0xb3622df7d7f6d944,
+	 0x68e6739853f58b49, 0x7a97753774ec2316, 0x08f4a564b91059bf, 0x0bc2edc76c8f9e63,
+	 0xd98ba379354660ac, 0x56f166906657ffeb, 0xb5efb6060e6f23d4, 0x2df6495d20cfea45,
+	 0xd68636a4971f4614, 0x91eed3c9216fac48, 0xf8411053e1640c31, 0xa5289948a4520bae,
+	 0xe359a1070ea45236, 0x509256859c7ade59, 0xd0ca8ef55f72b61f, 0x4a11ca79542d28d8,
+	 0x70f2e6c12c820241, 0xd59107b99cfc188c, 0x9220a11b5b5c4ec4, 0x51f7eb5f8db8b4d1,
+	 0x67617d89aaf7e01b, 0xfd40df1c0bf41735, 0x9730b82f320748b2, 0x617407fe93f8fd72,
+	 0x0cf622074b08caaa, 0xa2779fc43be402e8, 0x2b1c22541c0d1157, 0x5272dd94bff843d6,
+	 0x61ca522270274342, 0x7593d63fc932a939, 0x471bb9aa4eb81418, 0x2a5e6ea2cce87842,
+	 0x362a2f4e5309a195, 0xc32a9f71f666ba0f, 0xa5171fda60ac6f7b, 0x5c9cad8ac95d0af7,
+	 0xefe0a0dbc7dccd7d, 0x430ad3ee0efe9fbd, 0x7ea57aa564dab29c, 0x445029027130a69e,
+	 0x22589b466b56a185, 0xa0451b3ee1ce2a74, 0xaa51deea16084bbf, 0x6e3ba8815ae27946,
+	 0x43c0252413a16be6, 0xcc5277b21db1336d, 0xbb666ea991cfcdcc, 0x90be5380e911acbc,
+	 0x32455d922a04b662, 0xae0bb5df2c096dac, 0x8ddf8f29130303c6, 0x24e32cca94b395b5,
+	 0x43fd02c194c8b76e, 0xe81741e4742d8a7b, 0xdb3934e662945fdf, 0x93228ea63c28a83a,
+	 0x935056aa9fceb63c, 0xc639d866cbb77cbb, 0xcc5f73783b5cea06, 0x0255338f3679775d,
+	 0x851ff9ee1f9e18a7, 0x3bd1e0b1f9db2f68, 0x44dfe9fb86f5c19a, 0x947be2e674d4fc6f,
+	 0xc8459211cdbab3b2, 0x99f6984a8680645e, 0xec722d4527325150, 0x444879e519487158,
+	 0x088961c3d0f8c139, 0x452a3c1e726b3317, 0x0a8716ed3fe5c9b6, 0xa2be98a36dfb7c3f,
+	 0x67c16b69b43aef1b, 0x2f9609e9f61d63de, 0x38ee734f778d6f6b, 0x9549ef3da9813deb,
+	 0xe629232b30f64412, 0xf4e2598a1d523e4f, 0x1febb34108bc8129, 0xb0c8aebd91fcaf6a,
+	 0x98d6d191c4b11f3e, 0xb64576b9199f2e72, 0x41b632c198f36285, 0x029a81844189dc72,
+	 0xbbfcdc5adf95cf8d, 0x545436146e7c9bae, 0xacff575d0a53b153, 0x234e8885ca9bafe5,
+	 0xa991ae9763d04ce1, 0xc42225179bcbfd16, 0xe469e643ccf3c00e, 0x546f333610cef10f,
+	 0x4a6c52e56fe4ee25, 0x69b8988cccf41e83, 0x896e83640b4787ab, 0x17d6e479881d92d4,
+	 0xc067d5bf4f37fd8d, 0x0510463493ef22c9, 0xf3d27cdb9d4ddeab, 0x28924842e1b63ce6,
+	 0xe8a309a85c7d8d90, 0xf0b533ed00cdb480, 0xffd78ff2ac7c91b0, 0x2fbba655d7b0cb45,
+	 0xea647ad5c214a3fe, 0x5bb16b2c563522cb, 0x4c6bc2efd70e0ed4, 0x2f92e38e3ef770e1,
+	 0x6d57067a0e764289, 0xdf1e7b84813dd84a, 0xca4d82a6fc650f4b, 0x03ab824702eb83d4,
+	 0x583e4e34b94014d1, 0xe993455947f52b50, 0x26caad6f2876ada8, 0x65c63563c74aa8eb,
+	 0x091610d1dbbc6374, 0x774f8c781379ddf7, 0x129eee476636eb28, 0x18be899c6c842e46,
+	 0x99042a257f7cad5f, 0x2d8224daa0575ba8, 0xfd1bdc3359969cab, 0x2ddf710e0e54a790,
+	 0x033d84fed21ff40c, 0x82a7cb854d264be0, 0x5e9c40b4ae11c3a2, 0x1f47bce6a3c9e1ac,
+	 0x79c1626af44953e2, 0x297c63b77b0fd23e, 0xae7b4cf1fccb2acc, 0x631e3541b7436d99,
+	 0x9d8219b65c76c599, 0x7d69c5f38632e3da, 0xbb5b7e5d4c98d95f, 0x5756dcda6487f3b3,
+	 0x42a60a57d41af00f, 0x8ca67f6cde094e9d, 0x3a6bf6845d32ec0d, 0x19ad3dadf1105c92,
+	 0x4b7329d124efb373, 0x8130f8680645c748, 0x4ec8d13a55b20c40, 0x0ba5b4b6ae88f041,
+	 0xdb2b9786a9b88756, 0x2ec32f39b666fa53, 0xe8596c230fcb5342, 0x53f1f69b5be24211,
+	 0x5c1591b2e7e86bae, 0x24052e054db90b71, 0x32b7eb6122c43b56, 0x66d5b0cb1b48ce6c,
+	 0x1b980ef91ca48941, 0x6dbb944c12ed4d34, 0xab4caf290b4a8fa5, 0xafc924ae07fb1d7c,
+	 0xd328d0da97a3b474, 0x3785c0e6379aa202, 0x43173cf6e8442596, 0x346cc19d6335defa,
+	 0xb1c92036c2b73f76, 0x86817094f784d072, 0xfff7a3456b0e7c58, 0x8783ba6c876cc1b5,
+	 0xab2c0dc131898180, 0xf205c1f7371a189d, 0xa4adfb1192525df6, 0x601467f16ce7e98f,
+	 0x1144bb2f4e292933, 0x53ce6926c7681022, 0x39c5c5caead5e87e, 0x6be5e26ffcfe055b,
+	 0x3d44b2bdecbdff37, 0x50822f987c857bd8, 0xcfb105d03f343678, 0x55a9a9e6dd90bf1c,
+	 0xbddcf9f320aee63a, 0x7feb52fd51cc2685, 0xc8607ffeeee717af, 0x0429b5a0b0f1b71e,
+	 0x187b7d946c10439e, 0xdb56b58be3286e26, 0x3481c68ea7a1c80c, 0x8c4bc54d6fbab342,
+	 0xd42a29a375279705, 0xd9ecdf415121a973, 0x966d2e5b1beda203, 0x7a23779f8daa59ff,
+	 0x45e1ee6a7fbf8619, 0x080f8993953745ff, 0x641e7696209de7ff, 0x52c1de630a0ce211,
+	 0x8b58cd9d79364bb7, 0xc6cd723e91b1ed98, 0xd155f7d75e39f803, 0x80dd1ef0032ec4be,
+	 0xf6c52c5927635a0b, 0x0099ce0c21260f73, 0x70b71d9c6eaaad92, 0x21ed50abcc120cb1,
+	 0x1cf04934dbb08002, 0x240f1c0bdb85ca92, 0xce592a422db2b38a, 0x0f73dbcc8908cbce,
+	 0xbe3acaa31369f444, 0xbcc0ed0b306e2cdc, 0xc377a854d529c20f, 0x6f500970434c8d48,
+	 0xaee72bf8198d9ca6, 0x0b473ccfd9f78f97, 0x9e05b992107326bc, 0x1b0db91eca2c800a,
+	 0x305007c576cba033, 0xc94650f2c1a80ae4, 0xf5bdea1496bf7a26, 0x03a9f8ad78de3be7,
+	 0x5ff45a0e999cce4e, 0xfed23e9021339c3b, 0x6ce96a5ce954a96e, 0x7832f5fcfe2ce143,
+	 0xc6be3d6af5a1f119, 0x0fc4eb78f81af188, 0x423c4b4c5a778221, 0x8572c003c482aa0c,
+	 0xfb2f7dc39a4f487d, 0x3426c092c3f9a647, 0xadf95240a8b06aed, 0x4921d8549700e636,
+	 0x3c065b8fe4237a1a, 0x3952eed3bb2570fb, 0x418c27ce807bd992, 0x927728ddcf5ccbf0,
+	 0x89a9de26ae3fc41c, 0x6ee5ac8f70965b2b, 0x7d8a4d27030df281, 0x94588a15ee0b7031,
+	 0x165d4c5a27b8a5dd, 0x533d101533d6e4a0, 0xcff34d999baf481b, 0xa966e3ad9945e44b,
+	 0x65cebc17cbe47c34, 0xed7cd1726302fd67, 0x6c26a2952c4ae0ba, 0x1658788ad24546ab,
+	 0x43e87475bb38b5fe, 0xa89d7e1565196fbf, 0xb450e5f07aa24279, 0x54bd3f5f34c769bb,
+	 0x0ea344c8558aa75f, 0xd1289dd700b1339e, 0x4a1a0f97eee6c037, 0x8e58634d7a509265,
+	 0xa58aaf5611cc23e2, 0xec34dfb562d4ad33, 0xf9d54e7c0cedbf0b, 0x47bdc227566f96a6,
+	 0xa2c108205bdfd677, 0xcafb37b9a618b557, 0x7a1fa36ded8ac458, 0x07066ca2c7fbfcdf,
+	 0x1142e6a1a5261de4, 0xb470b2b7a87bc9a0, 0xb308703ebf7291e1, 0x084e0916031c48aa,
+	 0xd26601d1fcce4cb6, 0x8f4265c03d9fcc26, 0x9321183505347645, 0x1af358e8e7a47812,
+	 0xfa16532bb3dd14a7, 0x0e2f28ef8b78a482, 0xab610d113ede66e4, 0x9586472175a02efe,
+	 0x08d8b51ee8b8618d, 0xb53ef0d2109b36ab, 0x04e723ea72b50216, 0x525919073e03dab1,
+	 0xbe259f2a73982d44, 0x16c63833a52c0eb4, 0xa69af49e94fa30c9, 0x40cf2b78c4412050,
+	 0xf78c94c2bb8339c5, 0x8dd498758c80edda, 0x6ccdea0fcaf488e6, 0x9977a4b83d934a68,
+	 0x54a476b3aee6154b, 0x2baac183091794d2, 0x73a0c77850cdec70, 0x73b5bbaf048e3385,
+	 0x04d8fa4680529f4d, 0x11d2b6224db11854, 0x0302ff3c618589b7, 0x7afdb4acc455deee,
+	 0x936a61b844bbf873, 0x520bcba68253c010, 0x148ae05835c317dd, 0x318314cd0bb133f5,
+	 0xbb3cadd0d63572e8, 0x799aef983a88da4d, 0x4cbb69ed1a9e9ae1, 0x4bd9dbd83f4f25eb,
+	 0xdc7830cfbbab86eb, 0x4fc09dd6618b589d, 0xd0c10fb8705a6657, 0xa86be7686ec88782,
+	 0xc3372ac35a778ffa, 0xa4b3fabc86fe7491, 0x17c79d895265c70b, 0x113875da8eef319a,
+	 0xf2e45bf3444eab0c, 0xeeeb58f2a98569fb, 0xc63241c2169535ba, 0x4ba1436476472971,
+	 0xd6f612cb76627430, 0xd815d5a43978c0ba, 0x8b3b136dc9865482, 0x141c7f0ae78b77a0,
+	 0x2fcce25747d7c844, 0xaa0f37890f278c42, 0x277aa9338eb29b48, 0x43233cf470da4b45,
+	 0x01706ace049d60a9, 0xa6034ad623559c52, 0x664b245703024ab6, 0x0635d712cc8dc884,
+	 0x0e17edc8e29e0357, 0x539a45189aae3320, 0xcc0bf189cf4e05ab, 0x8375418ee39bfec5,
+	 0x3ec771200107537b, 0x08dd9f08b7ff9685, 0x52e7391baba0043d, 0x5672e762e520fce0,
+	 0x8d6f8a27c6fafc19, 0xef55411b9588d68d, 0x420822d502d95e53, 0x0a6b9dbb6e2b8f4a,
+	 0xd2c8bedbb0fafbd0, 0x016525c324d08a33, 0x5a39a6075f5f4219, 0x4464210b1982b4ae,
+	 0xdc719550bed7e1c1, 0x1b1c68ca78ec1650, 0x2d7519b624353440, 0x390e6f0620bb20e0,
+	 0xca415213165547ad, 0x570f18c3c2cac705, 0xdd870b43045d827b, 0x62de8c2c13d08e7a,
+	 0x4369e7a225252b52, 0xde5371fdc2970cf6, 0x98a84d3d158063f3, 0x76fc66d250797fd6,
+	 0xf15cb296fa0e7f70, 0x56d71790fae0be79, 0x16d19b6a4f0e64ed, 0x8c5c63b0aa6d8e0e,
+	 0xb8c880d95f5f05d5, 0x410bf9fc719dac98, 0x986f0a36ec1bc9ed, 0x4b71f76e0feadb1f,
+	 0x8b7a32688d298200, 0x7e05428ba77e8146, 0x40d92b3169884ff4, 0x0d172745a5778aac,
+	 0xaffeb83fa573ab7b, 0xd1bf1d1d3a6a4971, 0x3f988d44e30d7509, 0xb52df38cc3a46777,
+	 0x6f27f19c95090984, 0x458e4c997846aef9, 0x73891a4920b86dbf, 0x7f64c267a6a83d4d,
+	 0x18b41d681e540330, 0x7252eac377ae3874, 0x90e6dd358fa3a0a3, 0x1a5ad36bf474552b,
+	 0x6e7d5095ac18b413, 0x3aaaf0bde6b6a8ff, 0x23d581c05f2f70fb, 0x12d45e42da93305c,
+	 0x4e5fc8468239830b, 0x9488c5bbd7d58c6c, 0x4d968ca74563da07, 0x8dfe61efe6cfd452,
+	 0x1950384c2cdcc07f, 0x0f897e6447e2f34f, 0xfda537d9826ac28d, 0x0fa1dda25ea12407,
+	 0x003df09bc0b52680, 0x3e50e8056243f376, 0x1b6404a20a5dcdd0, 0x967554e5172b62ae,
+	 0xe435c7f2a7546c7d, 0x63de4b617bcdf618, 0x1f240685023135ed, 0x71faf3d815322fa0,
+	 0x326f4bd61023065c, 0xdf7f174e01bd4079, 0x6f957882aabf9fe6, 0x355422cf08ebb1d1,
+	 0xdbb3935a965fe7d6, 0x76e96553da19c82c, 0x36bd227aca21bd88, 0x337db3255d50f714,
+	 0x539c2e30dc696c68, 0xae62702fc9ab5c03, 0x9317485b73151bc9, 0x846027f1d87e75e1,
+	 0x99728228746afc1f, 0x57e9dbd478f8f853, 0xa98068b9c142efe0, 0x2fb9a4c373001308,
+	 0x36f2bfa0f0e60406, 0x4f72736e509c8e33, 0xf6e9b81452c275d6, 0x394a3e5e26602710,
+	 0x163d40e9577eb649, 0xcaac2ddc7b3b16f1, 0x56d7983f9ea7dead, 0x79c398b7c7c96a75,
+	 0xcd2c00b67d9f6265, 0x426e1e6356b16ba1, 0x09b192aa32bd7ee5, 0x6290babdd9fe7475,
+	 0x6825a5eeffd11b9a, 0x2ae024a5c4bd8421, 0xffe67d0ea8f7d608, 0xb5d67bd2658713d6,
+	 0x4c036b2f2e12c827, 0xca22389a11182732, 0xfa930663058d19ff, 0x419932fcca1d6031,
+	 0xdbe099dcf31d4c8e, 0xaf424a1b6181979f, 0x84fd8d00392f4b04, 0x3ef00b7aa89b5a4f,
+	 0x6d8b2b731f6f35dc, 0x4b43cddf870b39b6, 0xbf531c225bba7c40, 0x5497884c4e19ee7a,
+	 0xa337af0f08eaeb9b, 0x54ee51455f72ed60, 0xa0d4b941ede913c2, 0x604cd74f853dc6bb,
+	 0xb14966a54204f0d7, 0xbd61da36a6100fb7, 0x217a4fba6c8e1e91, 0x0dbcfa584d963a60,
+	 0x2aca1e489b38634f, 0xa629d0e362edf41f, 0x177025c1441391bb, 0xa411d4705224046c,
+	 0x7bd33bf52e256611, 0x91fd3358a0770b8e, 0xb05922c17ae0e6b1, 0x013ba590c6828ed0,
+	 0x41d3e057f14836c5, 0x152e172c6298a089, 0xc99be3c5e537f54e, 0x5f06d3128dc9a0af,
+	 0xce437b04693b47aa, 0xf231aa89dcd0ea1b, 0x19ea0ce36527cb49, 0x81c0690c318aed42,
+	 0x51f3dd44693f7296, 0xa19df43ad711fdff, 0x305d461014419113, 0x4b19b6a8c59ccb23,
+	 0x82fd387a5916df09, 0xb58c76ab6e288ab0, 0x3045fdf5704e2cd1, 0x4e6b390f59fa2415,
+	 0xe66602c17bdedf1f, 0xe6d983c12f4969ac, 0x7aa78dcf9f22a8bc, 0x3592e935b981e8ee,
+	 0x66afda4ca366f4b4, 0xa2b6593386001ecd, 0x52473ea8dc2734f1, 0x47313f42a23a1f04,
+	 0xe06af7487f4f9dec, 0x380d7cfc3e50fb38, 0xdebb43916b303a02, 0x7286e17dcdecae59,
+	 0x3ee68fb5a4dd74fd, 0x8622d27956e2e74a, 0xc76fd6bb866ae38a, 0x12c7522f9c136199,
+	 0xd4a36fa249bb64c6, 0x9b902b3992d4c917, 0x2bef60e254aa6ecf, 0x3fea3e333f84383a,
+	 0xa01a10a7e2de719f, 0xc0daff5f8dddb20b, 0x71f48ae6308b8968, 0x9afea94a58ec6182,
+	 0xdd5d5ff5aed80217, 0x347ee4c628e1a65f, 0xa8d3a16ae95bbc0d, 0x3abbabc70e5099a4,
+	 0xa01dcc678fabe2be, 0xe589e3a83fe6fea6, 0x19100707efd0385e, 0x69245cb89195a05d,
+	 0x7fdbafde76caaa1a, 0x2daa105b1aebc001, 0xfdf916374818a86f, 0x7d759ead830b020e,
+	 0xe08c02b5cdae94f2, 0xfde9984b94e4c34a, 0x8b36d956a4cf82d0, 0x47db131e57e74acc,
+	 0xb26bfe3606b05335, 0x3a41ac372276ba31, 0xa4fb6d51216fe26d, 0xa4a9b18435bd9a0d,
+	 0x35f0c8b3c0342e88, 0x950dce8148cd6ccb, 0x191aa8e6d4f392b4, 0xa314a2ea907830b8,
+	 0x09d01db8b0cc31f2, 0x22ebb6e3946dce38, 0xbfc171dee24aacf4, 0x06922dc2dbc8a66f,
+	 0xb06825257245d2bc, 0x0b80ac36d954f74b, 0xfef351341e246168, 0xac1878662b427480,
+	 0x2048afbe60376f0f, 0x01817173f5d6de6d, 0xe163adb221ac61fe, 0x4721b3f54a07b42e,
+	 0x82fe9901868b8b7c, 0xb5f8eceeec1967ad, 0x50242558294f0974, 0x202c057836aa5498,
+	 0x4f427c6db60b2661, 0x3f6cbace8886857f, 0x650e8ddf7ea54fa2, 0x64cfa5e224000212,
+	 0x786d19fb6ea7859d, 0x3ca74074fc7873da, 0xe91b3de08a6fea9c, 0x3bc7652ac3092b97,
+	 0xe96a86acdde9c15b, 0x6d1692249e40d89f, 0x7793ba0948d41222, 0x28aba887b8c4372a,
+	 0x6b5ddb18931258d8, 0x1318893102d0d940, 0x90e0ea01efdd6f90, 0x3008349f29fb162c,
+	 0x70f035710db7a848, 0xa0ba0cc8186ea7a1, 0x4310ba2339a9b8da, 0x0fc8f040f7607158,
+	 0x4c7ccd0cef2f470a, 0x4eee1705ec02245b, 0x3828907a36a6cc89, 0x9e1f18789138c5d4,
+	 0x22d1d9b24640b2d5, 0xd2383f4ec8a981b4, 0x9ad2b74f191182dc, 0x624ba579472a828c,
+	 0x0f3e4a0c768f30cf, 0x0ac695e3c09c1435, 0xfb9188a20437acc0, 0x928ef8b1be052fba,
+	 0x9609beb02f2818d3, 0x04543c6c998ad8b6, 0x9c1c23e0befd1f9e, 0x52df0b48a7dd4225,
+	 0x3c29e8390cb82169, 0x3ad2da329355c94c, 0xcc86868262157e6a, 0x7f784c05ff97608b,
+	 0x3be730c03f6ddd75, 0x2044652a70bf5e72, 0xba577a9454fd29c6, 0x1e9f4cfa34e4b025,
+	 0xb15669ad74d14ffa, 0xf3c6f804d6328109, 0x4213edb4c97a1fc8, 0x45837d9fc10b0adc,
+	 0xc856d4bb18d8ec4f, 0x2a6311e6a1e72c5d, 0x8161a0b7a5f4734d, 0x0ae2f5ca4af361e3,
+	 0x735508ec255ca9e4, 0x27f53bb011a062c7, 0xfe119c851ca2e6af, 0x458d20317591ddf6,
+	 0xb148bfc46d93fa63, 0xe8721023df319b30, 0x2b2bb36c0dcf5b84, 0xae8d8ef2666a5018,
+	 0x3fddfb9f6bb65826, 0xe8fc36e561167f59, 0x182b3ec67bc2ed0b, 0xad9ef2ec01bdb8d1,
+	 0xb6c87f6ded122966, 0xd92edc4facb1925d, 0x23bf46dffd0a64ca, 0xb3b593af6c81a348,
+	 0x794899e0d74f6c50, 0x4b7600efdb29fea2, 0xcb22be49715b061e, 0x8014daff6eb34879,
+	 0xc5a58c23dc1f6747, 0x40fc9c1c2e280954, 0xefaf48686f9078fa, 0x5af175163ce38bb6,
+	 0x4265d92e67700c63, 0xc0f500484970d5db, 0xcf8114a8e42255db, 0xa4440207ade92a65,
+	 0xbfdf7ba5f1718dc4, 0x129fb4e1d7c4133c, 0xb5e5cf2ec174c6b1, 0x7f141932f7fa0780,
+	 0xb79fa917eda9c37e, 0x6df3855300f0946a, 0x676813c02d8215c2, 0x407ffa83d93a83be,
+	 0xbf6270514f10157e, 0x323b8c87b70daa9f, 0xcc79572376f1410e, 0x769e4e1b4d874c57,
+	 0x14a453c377b46ef2, 0xcb6b408d8caf85b0, 0x07e38259b3a9a6a6, 0x8fa7dc54d00229e7,
+	 0xa38ff6a76c8d209b, 0x5710b89a19b2b925, 0x5f14234609b6a7e9, 0x51b22e0b20baebb6,
+	 0x8d9470c72afc2b42, 0x81cab637bfcc59c6, 0xfbdebbe43cad2be2, 0x1d18500be301ff52,
+	 0xeffec56f41b766cb, 0xc32a391b0aadab47, 0xb3923c72dd29ef55, 0xa839e29109b0e226,
+	 0x554abc69067a115f, 0xe5f522cf0bdf8656, 0xfcf6b50bf74da63a, 0x3b4ae733ca295f70,
+	 0x3f9f930f98e1255c, 0x75c264dd5da95f71, 0x01d3e562700075d2, 0x027b8dce1e67be03,
+	 0xf8f03ee2793505d6, 0xcf8d1ac421e9319c, 0x4a00850691dfb028, 0xad3acaccc1b802ed,
+	 0xbf0a59f5d5521aaf, 0x2f67b1d35230ee41, 0x3a04cf6c18e2bb48, 0x65212637260c868e,
+	 0x73b44e70853c97c3, 0x7e5b31b4ded02cd2, 0xb7b3f7b2352c85c4, 0x272d7cace3ffb7a8,
+	 0x073d535aa37efd9f, 0x5d890d00ecc247db, 0xac8be0d6b93d009c, 0x94b93da4a1db2f50,
+	 0x07e4d7db2943b12d, 0xf95820354362ce3a, 0x146d9b702ff9f5ef, 0x1a6064e210ce8717,
+	 0xde4d66024e5d82d8, 0xc75040b60c9d3e9c, 0x5ced0addc2873aca, 0x5b1dbef93dadf522,
+	 0x078490b6ea18a620, 0x7ad4d48c81cc9abb, 0x3a8014e011e06f98, 0x7d65f80603a2cf88,
+	 0x3c7a280c7196bf43, 0xb5d9084e7e9ec287, 0xfa210874eb47ae01, 0x8ae617391dcc1296,
+	 0x0949c74c950e78b4, 0x41255946a82c4301, 0x2da8a45a39aa0410, 0x5fa0bb1138efe249,
+	 0xea00cf5debf714d7, 0x844b7782a135646a, 0x5a58af08ff274387, 0x1bb59eff6e4433b7,
+	 0x0312089617d2b0fe, 0x268c088762e8a7fb, 0x864651100da9701b, 0x8788a2c27eec79fc,
+	 0x17e9b4c8f48576e2, 0xce876ac0a1e13164, 0x9aa4d8e07cae79f9, 0x61840a414e2416d9,
+	 0xfc1925b947e98558, 0x37b0528a23bf1d80, 0x209f7385c9385c3e, 0x169e729465384840,
+	 0xe04252ca46aedb4d, 0xccd3b54861224d8a, 0xb5cf6f79238d028a, 0xaf8a4a299ef9c4fc,
+	 0xcd4bbcbb6f6e8338, 0x677ac0f31abbec5b, 0xc5dfd091b005d36f, 0x61d61d13fc411007,
+	 0xbfc85ce2ddcc7403, 0xccc18e4965b7cdc0, 0xaa093049c7242a3f, 0x14a0d0437aa6834a,
+	 0x3fdda4c18b0bdf5b, 0x64c13d0b48003b2b, 0xd74898efcd10d453, 0x9b44318ca8187174,
+	 0xfe15612c8253089b, 0x21de701dc80a2892, 0x3b8b6aba835aeeb9, 0x326eb61350c4f709,
+	 0x3f93b814d0c981f8, 0x9220c422ca8e26ad, 0x4c1a8a35e4063969, 0x81e5ecfd846d1a33,
+	 0x61c8c71121a2a319, 0x5653d29dac602806, 0xf1f9acc87e8dda4d, 0x42a6b0fed90ff458,
+	 0xbad1e151fa0f1e73, 0x4fd6dac0855411a9, 0x1e87056dc0920e9e, 0x3499bb6a6626b507,
+	 0xee6db7eac2c2a242, 0x23bd56d4c808ff35, 0x204fe8fd48a11c72, 0x600aa38cd31f9e0a,
+	 0xf08fd5723e906ba0, 0xff6e143cabee4b3c, 0x8798a64d397cfdff, 0x5ae90a67a4dff456,
+	 0x950651e36bb60649, 0x41c73e5dd1d637c5, 0xecfffc289699f1b9, 0x24e5279226ac92d0,
+	 0x7e993abfb0ac2695, 0x3575543bbe2b03c0, 0xd95887b31c626316, 0x6ac3a03a7ae6424f,
+	 0x87f65018215c2c77, 0x850421ad265bd053, 0x70954811d2e7b716, 0x265d33f1400fe689,
+	 0x54608eff2b6b75f0, 0xd5484a223e7878a0, 0x8ee695e76865c80a, 0xa63b5c321e51d3e6,
+	 0x5fd17e78549d5349, 0x491140a3a123407f, 0x580733f2ace9cbf9, 0x97d3eff7b77a518f,
+	 0x263e538be1aaffdc, 0xb7e375fd2e6cc9d7, 0x8a36e587337558e8, 0x59bcd9e6e2079740,
+	 0xb298564dd37689f8, 0xe6a783ed77ae4824, 0x7270f0c4c11bb9da, 0x73acdb4d6105ee42,
+	 0x8a509061697e6c8d, 0x2c0302e058f73ad8, 0x4b5a99588c82b766, 0xa1e0af2fc28cebc6,
+	 0x4ca77e28fd3faa5d, 0x76f61229bf93a89a, 0x25d56b4fe5c99522, 0x739fe31a276b58ab,
+	 0xeb2adc565c91606d, 0x43289bfdac3cd891, 0x409e06d4c9084336, 0xa134c692de018bd5,
+	 0xfdb00f64cd93fcb5, 0x1a7396be0507593c, 0x0e3d254076edd326, 0x8dced4cc98729d8a,
+	 0xc10043869ddda432, 0xd8fc2f489ab562f3, 0x7c61439e54e275bb, 0x96e6840865259971,
+	 0x37651c6a828d6f97, 0x38f07c170430b490, 0xf344e4fc953394a7, 0x64d546b2a02b86dd,
+	 0xfd03b2a500f04ad3, 0xfafb24eb3a2ac663, 0x398c0c8cb4e69002, 0x47ce1a7e719fc962,
+	 0x5c313828cbdaee82, 0xd0a3cf2869f2f413, 0xbb18e81a71c250c1, 0x8100819593cb6f6f,
+	 0xd94dbe2d0efa40ea, 0x170653cedd7a9021, 0xcaff45daf8ed821a, 0x98d0b992b09e7b5f,
+	 0x37d155a9a01531f0, 0xed0b5129fc855cf0, 0xd481e531472c9abc, 0xa5b3af5493b06b26,
+	 0xdeff63bb68eb4d12, 0xb18f9fbd89e0cf29, 0x83692693995334ad, 0x0deb890b7f583a31,
+	 0xaf74435a083058c4, 0xac76ec03a620c646, 0x5d9394ec632ade09, 0x70850c90daf7559e,
+	 0x563e41432b88b74e, 0x69fddd3b8d024d5b, 0x4af34526831aa1bb, 0x599da68ee7fbe507,
+	 0xd0a18f9d63e834a1, 0x5114f54034669bc7, 0x73f3821dd80d6482, 0x1d94b4367e6e35ce,
+	 0xf0fdc44f4a755601, 0x8a89cadf1d8f0c55, 0x1ef1eeeca832a0ac, 0x5f7b1fb80b8ee3f2,
+	 0xe978f15715a4c1cb, 0x71ecd30a0a28e267, 0xe1c16cb8f3b104c3, 0x5f09df771848f5db,
+	 0xd7a8b4bdc39e9ce5, 0x3da11e75a8d04229, 0xb34b4e5e8d76c1cd, 0x03938ce6c3c8d207,
+	 0xbf419dff545c551b, 0xa79963980cfb6017, 0x0a0c8b6089948a8a, 0x5ed88426ff69329e,
+	 0x20f18a0d30795fce, 0x30c019528299325c, 0xd8c6d45d85e03198, 0x0feab21b044b8603,
+	 0x25224b06a81be0a5, 0xed28bccb8854ee76, 0x0fc48d664abf5b0a, 0xb2af51704f6cb268,
+	 0xf5638c95880ac398, 0x28aa9181f7803bb7, 0xaec2961f7a6cb91f, 0x8e767ac6e509403e,
+	 0x427237c7e9e66e5a, 0x95f472330355f827, 0xa498ba570d533480, 0x551fc37a316cfd69,
+	 0xad1aee376657d67e, 0x46193a5eaed5008c, 0xe64fab43571e6c7b, 0x923efd79d74bc102,
+	 0x6672bb4171f0feb7, 0xef6507f0c12cb97d, 0x25f9084d86978449, 0x76d2379f672a98e1,
+	 0x98f364186c6ed202, 0x9c083e7200b4d8c0, 0x309d45e0022b97e3, 0x8d47fe3b2d4660a4,
+	 0x4eedfb50ca9ab31c, 0x61112aa70d673c2d, 0x2a81a81e172c3bbc, 0x0005a0221b0cf610,
+	 0xb930b11b6860789c, 0x3a408e39af5bf0b9, 0xf8c2ee472b9f24d3, 0x253258a2a0851e50,
+	 0xa7729b7e414c4574, 0xc99fb1a8fb76f146, 0xb37e7db6af49ab40, 0x95682242edc13452,
+	 0x257d799779b592a9, 0xc83e16e5bcafebd9, 0xb71562b1a1c7cb30, 0x85154fb56f9a3fca,
+	 0xe8a7ea01daadc8a5, 0x15b10eeb7f0a1e6f, 0x4ed41aff038b4eff, 0x57996e18f0435977,
+	 0x5d7e8ecb2eedd25a, 0x8a0c68df5ef0826b, 0x93e48205907da9cf, 0x6ca0685f5c013a78,
+	 0x08ff6e4235bbb136, 0x9d1e59511afd372f, 0xd7ca6e99eecee1d7, 0x789794022606f73d,
+	 0x9273e515df210536, 0xe94884becebe565b, 0x3b43f38e713d4f29, 0x0418395608f96995,
+	 0xd277deeb4f5691cb, 0xc4f0cf30cd16817c, 0x09fc4d24c99a342b, 0x707692c6002ec37e,
+	},
+	{
+	 0xcf1a29f7a42f7faf, 0x2f69bb5debed5738, 0xfbb72fca2ad5c9e4, 0xad679b261f8b468f,
+	 0x727964a03bd64586, 0x915bb1d25008a628, 0xb1d3e4be1417878b, 0x75d0f000da235d01,
+	 0x17f0fc4e70e7741f, 0xbb6dd522e46e26dc, 0xd012252de32582a1, 0x526a546070ed8091,
+	 0xf2e84ae7196c70b3, 0x6ed76a4bac11edfc, 0x0c408336c8124eec, 0x57a711f368916885,
+	 0x027b987f951b91a2, 0xd698cb301d9457f5, 0x06d365332d9d0374, 0x0c7d94d9059390ce,
+	 0x1aeb277346b85a81, 0x2f8be0437566e275, 0xdd0393d2cc437e1e, 0x45eeb592a74ec0fb,
+	 0x3cc79d41cc2c693f, 0x9785c0888cc53027, 0x7d90870066d6006b, 0x7786c54d501fd38e,
+	 0x51616e4cfca9569f, 0xcfecd29cddd6f716, 0xd64e04e716914eb8, 0x7405a6aeafef170a,
+	 0x4baa8685f6d6dce6, 0xbe8cf4dcd4fa52b8, 0x421c4263fc99ca2e, 0x98de12fcc85ebb85,
+	 0xae30de299a1029c2, 0xc4f58dd015ddb77d, 0x1e8e96c543539445, 0x9909eec00cc574d4,
+	 0x1edd6b11f797f97e, 0xe4a4e3c4b2712dce, 0x4f2ce35fa6f86fc4, 0x69c6ef8c766a85eb,
+	 0x874947941522096b, 0x123009aa756e7503, 0xa674b88febde7512, 0x86aec9e64066f6c2,
+	 0x3ccaf919cc744bc7, 0x3f4e22a6d3c32fc7, 0x5e404171aa356b1c, 0xa5f822514c6ee32b,
+	 0x3ac96fb41ece2b78, 0xd39194241c684554, 0x004a04a73a14557d, 0xb31c321f7a39da9e,
+	 0x5dbd4095a5d8e204, 0x80e90cb5c3ba07f4, 0x01b0caa3a04854a4, 0x7d46ab0dd2b0d749,
+	 0x20481e1940d7454e, 0x86b6fde86fe43bca, 0xd788e410eaddeb9e, 0x72896ec66dd69ab1,
+	 0xe6d8849db73c13dd, 0xd8886fd2c0fc7822, 0x84cc30b357eec01f, 0x4c397cb1dff7699d,
+	 0x628515f5b447c081, 0x06389d91dd4bbe82, 0xdac0e7570e6cb1bf, 0x3f066ac6aea6c887,
+	 0x0b99246d9d8ed3d4, 0x40fe8fb1c403539a, 0xe16c18b7d49ab3a3, 0x06164e1030ba5ad6,
+	 0x735e6337a1a09899, 0xd38a529c07d7eb1b, 0x8681caa135e91c1a, 0x20fb0699694d4f64,
+	 0x765214d1d0d9e4a4, 0x55f11f93b11202d6, 0xea330f87b8cb6746, 0x8f5bac38dd1f0fe1,
+	 0xe052fa429e8540f5, 0xf780d4e5440bf0a0, 0x39928a1c7d037408, 0xae2db653cbfd753e,
+	 0xb54fc8c9f08c8270, 0x98d567a101dc15fb, 0xa45935543450f9e7, 0x62a3c5fdad9b9a4b,
+	 0xac02eed0de4f6dd2, 0xf452fd92219deb11, 0xbdb59fbd7707dc23, 0x5d0490a21100ed64,
+	 0xe73e4b8632fad654, 0x191452f63aeee6a9, 0x9a6b3e8029798847, 0x91262f98841590ef,
+	 0xc07f5d65dcd45f5b, 0x1b98f0a5d5a87215, 0x55b728807aa5ff26, 0x77f4ac3f21091459,
+	 0xe530d40dd8d6fc03, 0x815b37c976772598, 0xc49c8c9cc6482062, 0x8eb2a975b6dc9615,
+	 0xccb6357a2e46c5dd, 0x5b7db950ef7c9dfb, 0x65dc14721f2e7188, 0x13c831970963ad9f,
+	 0xb596762525a7c7b9, 0x27835240dd987a92, 0x553341cb9f312c45, 0x18ada8f46d2c259e,
+	 0x79c43cc6e5000fbf, 0x3b7fc4eaf6673a36, 0xda27c0af28b9a92c, 0xb395047e80bfcbd0,
+	 0x26e7cfaa5c15d94b, 0x79301e49ce93341c, 0x33489b08d7f43bfe, 0x2023ba2a851f9b9e,
+	 0x9b97b6accb788a03, 0x3c7fdba1fc08bbb0, 0x6c5a2291500d69e9, 0x636a995b0bc33a9d,
+	 0x572b2f0ccbe60ae9, 0xc4083490dea97aff, 0xbad629ab3f443e19, 0x1cf0ef6f5598b87b,
+	 0xedbcb601b8a591f4, 0x3dac844bbd45a9f9, 0x801cbe8f4ce71227, 0x8881aabf05e41f18,
+	 0xaf01a3bfa28c3903, 0xa0821c1d05d3de25, 0x006c6e15f7114149, 0x7f3a451b3cfdf3c6,
+	 0x3aa6c9f89ff34a14, 0x7cbf2c9ef1eec303, 0x628db3c1c3e0c5df, 0xab350f31aa817351,
+	 0x8983ff9372ba5b71, 0xcca5af806b94ac85, 0xcd7e2fadb131aad5, 0x0fe49c4031178256,
+	 0x2e59669a896cd9c7, 0xf4bb2eaf5d4dc4b3, 0xdec7b1e2391f85b2, 0x68390938c15abb20,
+	 0x7bef4ec6d5f18151, 0x6557bc30b1a9ed8a, 0x1e0487731b9f3cef, 0x321c8618caddb1fd,
+	 0x3e7da63eba853b84, 0x2f7c242e8d2b7b6a, 0x896f21785a68918c, 0xa6b30ade4648f53b,
+	 0x42a8a4add7f57f1a, 0xb5333e778627938a, 0xd126f963e2f6044e, 0x71186cfc83b66339,
+	 0xddaf9a8e195d700f, 0xd0071bb5f078e341, 0x4aa0071442093068, 0x0722eb47de6cee21,
+	 0xdc50170c30922cd0, 0x7b8daaed31f39483, 0x0ea7bdee21fea851, 0x8076227fb8b88491,
+	 0x1e19fc852563a61f, 0x2e2e58b8ea4790ae, 0x9404cf83a17ab218, 0x430a68f771fa8ccf,
+	 0x4b1bde5d1ce342cf, 0x610008e1184ccfd5, 0x6a4d504fe32c7b37, 0x30b73c324e94a559,
+	 0x51e0c81a0c0d43b6, 0xda4f18e01b004d7f, 0x9bee4a61dca68467, 0x8afbe960f52b2747,
+	 0x2a5216a412c28e60, 0xdd46267009b74e3f, 0x2f72c10ed2014e43, 0x32e78994454e0f3a,
+	 0x9e1e6cd4869583bc, 0x21e780f5d60d2aa9, 0x8ef78db7c3fe7982, 0x00d5499ec892b5cf,
+	 0x1fe01c39d9f3a286, 0x15bd4e38a8918358, 0x97157a5f929508a4, 0x611466069fec4500,
+	 0x851ef44fb9483994, 0xd23fa86e98020d96, 0x3f059d25735df204, 0x906bcbd489ea8a69,
+	 0x688f05bcae0a3bb5, 0xfbde6f809caa488a, 0xddebb8f2410531b1, 0x6b3e599afc0ab42c,
+	 0x90ad31e39b39d551, 0x4c0b5420d8c1ef97, 0x2ff41d7e653c763b, 0x8a638d8addcaaac9,
+	 0x4c987a1fe11a52cb, 0x503bcfd630c767e3, 0x54644e07aedc589d, 0x22ebe3ecc923119b,
+	 0x7213397f4331611c, 0x7b8c22d8d5e6a926, 0x5a8b6135ce124912, 0x16f46fa13755d56d,
+	 0x4b65a5144bea942a, 0x0ecbd6749b4154a7, 0x6c9c9f43e3f95931, 0x4007b42607f77abb,
+	 0x647bd9eb30e6440b, 0xdb6042733a2af8dc, 0x3be3b073e5bd3ab6, 0xafa44f493e20a64f,
+	 0xbd658fb8b91af781, 0x1820793ca115bc1d, 0xde5a05000f43202d, 0x018e2a885863e4a4,
+	 0xf5e23c27caf683f0, 0x84274e39788c3fd7, 0xa78ec1682b0ec1de, 0x1670747f094e74ba,
+	 0x015b878d0480e16c, 0x5942b2617734606f, 0x49dd6bb8e0add09f, 0x96bcfa4786c848f8,
+	 0x4b9ea64d2cdaecd6, 0x206125724416ea73, 0x0186162b260b7124, 0x1b97415a1820ff6c,
+	 0xd386eb1e3491b8ea, 0x3d426d99b156f290, 0x4f6429c61f673975, 0x64b69dfbabb69d99,
+	 0xcd72fd1794b11e3b, 0x3f319ed3f6729f63, 0xa5f7a3b10b94e2df, 0x4c07fdabaee1ade4,
+	 0xb82c872c3aa9e801, 0x02e045cddcf5de34, 0x88a23e66a8801b35, 0x665d24b5000df6f1,
+	 0xcafed9b711e8587c, 0xbcb92753415ccebf, 0x315b5f32f51042f8, 0x59816d2749dc1287,
+	 0x8b87e07c4de864a6, 0x194fcfcd36d79df1, 0x36f460f75190ee41, 0x288c978907f4a7fe,
+	 0xa65f9dcb453ae870, 0x25d2054d11d3051f, 0x1ff03dbf64aae406, 0xa6caf722e3dd35ce,
+	 0x8094e5e66e49e6ee, 0x9226cce1ebc815bc, 0x17991ddafe6f6624, 0x6bc448e5c629d690,
+	 0x5bb27fdf9a845286, 0xe908c15bcbd2551c, 0x577ca2f6a8bdcd45, 0x17456a286ce2e25b,
+	 0x2fb32b774e62b739, 0xbcfe7a58b6300e77, 0xfa67d5b9d04f36fd, 0x6339a48a262fa658,
+	 0x112b248b4e97ee19, 0x3f583afd4ba2583b, 0xefc2bf350740f0b4, 0x172191168af86b90,
+	 0x94d10d89573ea278, 0xd831085ebba820f9, 0x1b7f5342cd82dca3, 0x75cd1c4ffc5dafcb,
+	 0x150f2740780dffc8, 0xbf6a51b9f5bc6091, 0x736aff4edcf34065, 0x71196fc5c42bcd98,
+	 0x266ccaf009de3f67, 0x6aea283fa04b9403, 0x3d1b0d4f50c2281d, 0xa3b4468aab2f349b,
+	 0x1f01838359453804, 0xad2e8b865dcb0666, 0xdcc72a07cc2cbaa5, 0x9db824725f84b652,
+	 0x77f39027075c2aa0, 0xf18aa2ac743a3308, 0x212534a4dcdd8732, 0x04e5e69b7c2d44b4,
+	 0x6d9cebb4b5aa5838, 0xe408387ce036dab1, 0x27d9a97bef4535e5, 0x024ad9530661af75,
+	 0x533f638c621d9c5d, 0x61f192c26656a03d, 0xf8a7dd1b97323820, 0x585c8f7416adbc02,
+	 0xb864b22a7e2ed9e2, 0xc9bfbb4f9e205f27, 0x5e7ae78c37b78e1e, 0x2c6cf99f0865a9be,
+	 0xf68e6404574921f0, 0x7db0c5f7a265d60e, 0x0bf527f8c40fd6fa, 0x646773293d3857a0,
+	 0x4d9d015a1a60e3bc, 0xbf161d181e1c72c9, 0x768c9ba3b7e7b5cd, 0x6c6f85a0e1fb7d20,
+	 0xc3ff34d8a579b4b8, 0x11fb147084ed4146, 0x6749dcd48b61c06d, 0x4cddca08dca45556,
+	 0x146917aaa2ea9cc9, 0x4cdd4d4d2621d697, 0x9ff1c84b0b2be6d3, 0x7eab2a294c9663b1,
+	 0x4f0f7402d9ff8182, 0xe2a90fe9d7111a2a, 0xaf6b50fce7a0706d, 0x5c670898ea6b5e1f,
+	 0xe9c768985630ae9b, 0x4c0109dd066c8563, 0x5c720bb70ae24f7b, 0x1a13b064183de340,
+	 0x3b192928674a84b5, 0xe292278567942677, 0x303b7463cc7cfbc6, 0x2582db3df960cc21,
+	 0x8ae2f6cfc334e3d2, 0xfd25b26296cf0627, 0x7077d76845e69d07, 0x794ccf22ff3df948,
+	 0x55d69b9580d2ef24, 0x063258f646e248b9, 0x3db40a6f8084a650, 0x3b8b0c1e952737ac,
+	 0x75db3340e2287423, 0xdfc86f6af3b3261f, 0x1f86623317861e95, 0xa947ee850227b1fe,
+	 0xaf824cd94c89bd3c, 0x2a14b411e65e7ac0, 0xd88015bb1d5f50fc, 0x5f4504f724b0a255,
+	 0xcb73adc2b3ea4a9e, 0x0edde3963b819d6b, 0x8294ccc377541e15, 0xa383ed24bca0e1f8,
+	 0x5b95228ff31d1b47, 0xc211b308aab8fe9e, 0xc7e04a1a9d487b39, 0xa84b30c2453d44d9,
+	 0xb41e3f4928d287f0, 0x1e2ef577e40f309d, 0x4a6964389208ee77, 0xae3a2980296f645b,
+	 0xad3adb5572cb8187, 0x0eb3bfdea7a9c37b, 0x2c61eee61f6c22b7, 0x7a1dd4008bed50ba,
+	 0x6ac781572f1fbcf3, 0x450a35e23d7c03db, 0xe135a9f1efe4eac2, 0x5c6c300326615536,
+	 0x645adbc94ba80953, 0x4327d3adc181547b, 0x99288bac96713778, 0x9ed1e3bc86e5e285,
+	 0x0d3229b2f41584de, 0xdfba1859c8d9a37e, 0x996eb4da24ac3c53, 0x7703091be04291d8,
+	 0xd5078e1e8e88d3b1, 0x1a1e33284130fee0, 0x23da543766f23405, 0x1b7daacb6360037c,
+	 0x19a6e366394b72c3, 0x92130322de8ef9ab, 0x458e43a7c0806e8e, 0x919f2fc60d2f7064,
+	 0x1f6e486f820a56d1, 0x74b053374d56599a, 0x545d5452e914f830, 0xa7cb752c3308faa3,
+	 0x5665dc73081b0780, 0xd5c83330f37bcd0f, 0x10f9d72ab7f1404e, 0x3b34f4f6b5b8477a,
+	 0xa9694ac23bfff8c5, 0x8ca9d1c0107c38ff, 0xad6adbca3d320dfb, 0x9d0fac80cb41be2c,
+	 0x85f46fc31760b85c, 0xea39083cc94c2cd7, 0xee16efcef09f2e4d, 0x64836543c4d2d749,
+	 0x2c845c87025d0c56, 0x7f461f5a2cd229ec, 0xdd3905b135fa537b, 0x4f858c111e77bda7,
+	 0x8a420d991e9f468a, 0x1ec1c28ef7c4a81c, 0x4a72bc51f6517971, 0x4ddf6c1a8e3b0959,
+	 0xa9ec4adc9372d5f0, 0xd7279f43a8133bc4, 0xb73c60e459d5c4af, 0x32d1546613ae3d76,
+	 0xcfe2748307f8d555, 0x405b6a6a4a22e13d, 0x3e4b337f25b94823, 0x97325a8180a8371f,
+	 0xac2abefb2f776e53, 0xdc882fc967e04ab4, 0xb0f1d004d6d6e07a, 0xaa8ef17343adc889,
+	 0x0615f3d9d6755f22, 0x1603ab9f9f111f50, 0x789d53819c6b5ed1, 0xa92f88928685d5ee,
+	 0xc4c2bf68c60aeb44, 0xbac191c99f0f1b26, 0xb783723bc9729f84, 0x8ca97b255422fd20,
+	 0x2a85778407156a55, 0x2ca5964d9727112e, 0xa05d7b3a73c25e8d, 0x7724eb6213583e8e,
+	 0x175d248febdead89, 0x08bead2446085c4a, 0x89c07e73a6233a9a, 0x61256b3f9a57a6bd,
+	 0x4a47757699acdf80, 0x8b6a8ead6fb48fec, 0x41d7e7baf5fd6d65, 0xb49373f37a5f31b5,
+	 0xbb1edffc29903b54, 0x91ab4f4802a22e78, 0x0847a7c01b9f135f, 0x3f8a8e5d01fe39d3,
+	 0x484756211b0030e9, 0x196d43abb8e5de99, 0x822a56b73b618058, 0x8dbd3caa135994bf,
+	 0x2aa6d338a0bb56d4, 0x0f4c43e9904f2692, 0x27abd9d2c8334617, 0x9a7921d727167c44,
+	 0xd9f340014eaf4d15, 0x31a080b647fd189e, 0x3615f7d3d13b6301, 0x98d363dd6ce50a82,
+	 0x9fc1f1fb40a68495, 0xd8107d1511a630f5, 0x55076d9212ec9bbc, 0x136adc26c77c3dd6,
+	 0x7740211bcaf6fda4, 0x967ed982ff8d355b, 0xb76e60b17863ed99, 0x87d2358acb07f970,
+	 0xfe5126f3fd2dff08, 0xcc365f0e4d67271e, 0x4bf37684f8f2340b, 0x0154ec45af8d9885,
+	 0x476ab8e18fa09b27, 0xa7f1b730ae742f01, 0xf6b2b5a799d3e593, 0x3dafc3018b731cc7,
+	 0xb8449e628d94315b, 0x9786690fc53111b1, 0x1dbdab2de8f5f921, 0x760197257023e852,
+	 0xb8ba13b124c238ce, 0xe1e45b3464ffc5f7, 0x050c40080f093a57, 0x0adcc2bb040ccad4,
+	 0xd31c243c678a2c3a, 0x600eb7c3190ddbb9, 0x17d55565435b2c31, 0x03ddb32c9f2da7ba,
+	 0xd218a7332e5dff55, 0xab8c017120ac60f3, 0xbce307278476b39d, 0x6e531ffaf397266d,
+	 0xf3a901441ce74179, 0x236bdf8e4595b187, 0xf1c23dab188d7205, 0x8834165eadf04e3e,
+	 0x076354a80a48d5b1, 0xcc260f45b9c9c5e6, 0xdf4e8b4412164795, 0x114fb812c5e530bc,
+	 0xa060e4a1a117aef9, 0x9bd75db8b2908d46, 0x849819feb3f8bf1a, 0x80e675c776d83820,
+	 0x14bac52dd6bbc975, 0xb52f68be51fd1ccb, 0xea966716e29a6b2d, 0x918d14c2b223c089,
+	 0x312a6f86eafca552, 0xa89e9ad78de0cd2a, 0x28c9cdec02ce79ab, 0x6da432342b826547,
+	 0x65f9172091970b8c, 0xc04b89f9e348851e, 0x230969d5c1c05cb5, 0x3eeecb8cbac02036,
+	 0x2fea3eb551bc4a6e, 0xe0d8dc4e658d5c58, 0xe6762be6bca79cc7, 0x37299cff9d7ee023,
+	 0x81268060bab10142, 0xbbd194a902200117, 0x8d7d8398a315d4c4, 0x6a803171ec39746d,
+	 0x26bf6cc1e11d2ed4, 0xf3506b6795789e01, 0x45e95f62c2f3fb71, 0x90b29df3685261b6,
+	 0x20bffe9817a27b02, 0xb133c987250ff6d2, 0xc65a802c964b2678, 0x3dc53d83347c5800,
+	 0xc306afde396f2405, 0x049731f157cf12b6, 0x9535583ad51692c7, 0xa9bdb578c6228c8f,
+	 0x8a7424e61a196348, 0xafe0241d8071f1c0, 0xfa132ed93826717b, 0x74394182883530b9,
+	 0x65ed7bbfbffd4681, 0x617b2721d53c1347, 0x3c90412820ee6e91, 0x1c18197db543f781,
+	 0xd97a75f378b7fcd2, 0x8dced6719e97c59b, 0x46eb0203c6b02573, 0x855b1f57eddafc46,
+	 0xd9843fe64d522ba2, 0x411ede675733078e, 0x85dabe99c0b4916f, 0x9762a842b9c809f8,
+	 0x564d077ece3f2492, 0x7e53b320fb404be7, 0xac78823e17971e25, 0x78b479f0bbf4a513,
+	 0x1bbcb0fa25f1d961, 0xd827f93ecafc2e1b, 0x348708eac51f48a7, 0x0f38924184a0e115,
+	 0x6f5152bb86ce3b2c, 0x27067ad6c2ac1bad, 0x556dad12f4f15883, 0x3e2b17d8ca14f3fb,
+	 0x0d503de06bfa494d, 0x8d62073eec815dc0, 0xda6519028b7654ea, 0x0108ce5f6af0cc98,
+	 0x149b115e67f8b693, 0x5b28a991f8ed4f5a, 0xc9c392d7d5299e84, 0x2ee542ec1f99d30a,
+	 0xff83c03820a3f49d, 0x2880fc4024bf0c03, 0xab19f34e237fd616, 0x602251cf53c004ca,
+	 0xf6cd0c030ab51c89, 0xf3eed9c313789cf4, 0x97fe9d8231411ee6, 0x1323fec7f36ca326,
+	 0x93eb22bf34c853fd, 0x4cc21e5ba40c523e, 0xead3d41e9712e98e, 0x5c9096908cf48ea9,
+	 0xa813e7a85486f479, 0x352cdc1d2e8e8764, 0x4cdbcb53cfa22ab1, 0x4081da1dc396e6d2,
+	 0xd3de53a66388c2fe, 0x1dcb458ea9fa734f, 0x848cc63b8661c792, 0x03d31e2ca6e37f4a,
+	 0x044175a38da7229b, 0xf4c43875dcfe9fa6, 0x8fa236fd6f8aa2ea, 0x375458d02108bd88,
+	 0x7fc3dd8e9ae1bcdb, 0xfb9a089a181b7d1d, 0x2d23cdb890e3998a, 0x831391ae618eafeb,
+	 0x9e1406c67d5f8e2d, 0x5b7fa0e6ee00b7dc, 0x33693f80ebd27876, 0x994e20e7675bea23,
+	 0x6c806e92f0643e93, 0x1b311908f20e0b03, 0x17d02d10950d9cef, 0x52fe7218fbd8fd5d,
+	 0xf5e04c4a3bf2e98e, 0x8270f8369181f6e2, 0xfec55fc8e9c17926, 0xb35d862d44430b0d,
+	 0xf941f3c64963f0dd, 0x0d505d4bdb5c268f, 0x793a200083709381, 0x8239beb9056c0db9,
+	 0x873bb55a962790d8, 0x93132747c57abfef, 0x020dfc986c68ecf3, 0xa0de44988280f3da,
+	 0x93099489f8d5774c, 0xa0e3c3f78757937f, 0xd21c9e50f3655e3e, 0x5ef271f3c4923c00,
+	 0x4af2a7136fe5f11c, 0xeef586f710412e32, 0x92986d9f390ddd0b, 0x0c0991ebf21f40a5,
+	 0xd4066275d64ed556, 0x12c4ac4958cc713b, 0x0b8aeb5ce588fb47, 0x759deeea622fda68,
+	 0x8557da1b50f468cd, 0xb87ece728cd48940, 0x5a4340f2d99ce321, 0x810e265e570e9ad1,
+	 0x73386120b08d21f0, 0xff6ce0e030dd6dbe, 0x78b8efd0f77798f3, 0x5dc8c4458d056ea7,
+	 0xa70f190db97e9429, 0x10a86a0229b28041, 0x2ca2a614f6a166f4, 0x6cf9cfbecbd33bdc,
+	 0x880e6e697fff10ce, 0x81153e99483eee6e, 0x62c9c65899934503, 0x78190bec5ae5a542,
+	 0x542862f48e0f4a9e, 0x6d1ad45cb5544d3d, 0xc45950c43c8cfcc3, 0x77bf97c9f8ce1a38,
+	 0x782714b9dd2e6b28, 0x5b11a5c50e141473, 0xea3404e8bc2f39ca, 0x0bf7e9e6b403cd04,
+	 0xd9f1b86678fa2142, 0xed5b76385c364328, 0x88fb59515bb2ba17, 0x5367567cb97c7b24,
+	 0xba2031be4353d114, 0xd72242101fa0b7ce, 0x307d9db2ff228df1, 0xa322a1ad0aa55698,
+	 0x9ca0ed77c5ec18d3, 0xe9e77c79be0f0221, 0xea63344a2935969f, 0x8ce24c0feb7ea31e,
+	 0xb83b9949344b7ec8, 0x9e7c1e67d46ea9b4, 0x40b07befb378325c, 0x7511262a4eb91a92,
+	 0xd1c2f82640b1e793, 0xf92ac5aa30814cb8, 0x4b34aabff8f011a1, 0x25e1f72fab728ff5,
+	 0x671da4a4ee54f9e8, 0x99f55a78e6552640, 0x022ea782ae95156a, 0x79a010535ff07f1c,
+	 0x0bb3e6990c9ed494, 0xb50e670e6e48169f, 0x64eeda635f1f636c, 0x6b64fa03dceccdfe,
+	 0x3c3a494457dd6854, 0x148fd9bf380928d8, 0x36c7589142aa40f1, 0x178a3eed2c363439,
+	 0xdc555adec9c4857e, 0x4c7ddd677d64ffd4, 0x06648593a415d0df, 0x3696e4cca08ef255,
+	 0x00b6f52d8e60bdc8, 0xb66124839a845ebd, 0x0d64cb1f088e1bd6, 0x5c2c5d06ec25aced,
+	 0xee5d16e79e1eb6b4, 0x209eba4fcb0640bd, 0x4243e707a0290719, 0x09753c038ef603ba,
+	 0x87c5760a39cef9a6, 0xad0c56ec79a6c056, 0xd2458e608e71df2d, 0xafe1ef8dd54927c3,
+	 0xb2bfe18728b091f7, 0x8a76c73a435e4342, 0x05f759a0fc4c74d6, 0x1fe7716c6734ca46,
+	 0x7b09151a1ce35d8e, 0x06720ecbd4b4e336, 0x1dde585a3da44dda, 0x1f33525a59b338ff,
+	 0xb02b262035b05f90, 0x9a2c50a106c3c52c, 0x2e6437b20d40033c, 0x48171ee54d2c378a,
+	 0xc93e50fa7bf62327, 0x11c97902f1ecbd89, 0x1c76fd39e7d70e0f, 0x700c7c4c1ea9cf0d,
+	 0x475e3a58c6f6d923, 0xc6e55b7d1861f49f, 0xaca51d62f8abf31b, 0x5ec304895f43df86,
+	 0x552161b82278c40a, 0xefe6975c32b6e456, 0x61a3e57fe84820eb, 0x046cd4d4edf87859,
+	 0xc7c90a51350d17d5, 0x8bd6e7fef3a49d0a, 0xccd466056909d2b7, 0x0abdb11159bf732a,
+	 0x3608bbb104d6deda, 0xa8270da3d96bc934, 0x72c000e675504af2, 0x4f64081216e2be9a,
+	 0xd4b884f7ba3b834b, 0xff879ee05c2e4b61, 0x8848a7c2709e28f7, 0xae867951ea9b1fd8,
+	 0x7ec7c9303262a766, 0x2eeea733267b53fd, 0x93c2cbf98ff8c224, 0x8612ae5736cad64b,
+	 0xf9f990eddf1a5093, 0x018dcaf37b15b279, 0x75cea94b09a0fb08, 0x2ad91e23301ee607,
+	 0x86d31f2adb0374b2, 0xe90beef3a6dc0d99, 0x3ac6c153e659a3de, 0xb2877ca39b467636,
+	 0xc763e2c9c64cadd7, 0xfd8000f1382d0543, 0x10447332abd8ac09, 0x6b31e419e66247aa,
+	 0x99e882ea2735a3dc, 0x6c48c7700c57d622, 0xa8269e60a5bbb55e, 0x41b5b243d448e225,
+	 0x6084371b4d6d1aca, 0x57009770cfbceedf, 0x4dcf08f6229b641c, 0x3ac9e38d0561ff3a,
+	 0x7563bfae5b4964ca, 0xe544c04e804cb444, 0x88560f5cff0ceb77, 0x54eaa0cdf9fab3d1,
+	 0xf649451f8eacf02f, 0x3f245fe17d1517a8, 0x3af987b5b03b82d1, 0x4948dea76e365b78,
+	 0x1e1631330b8b549e, 0x429befed0ffdd084, 0xcdb23ce8f096cd0c, 0x9c892f4f74316804,
+	 0x98aa6dbd7d49fa54, 0xf1aab616e3653e96, 0xb7311defb34b7a9d, 0x515e96ebb1ded380,
+	 0x53fabd76593672ba, 0x19bfc66a040d3ab1, 0x3cc2ade9919e2ee6, 0x0394ca7693531d9a,
+	 0x17623ea8e76dce29, 0x6f5403529c9e66a6, 0x4a2275266fc16f1f, 0x631ce2663fe222a1,
+	 0x83cee36dcda4b593, 0x44c9159cd28fa1dd, 0x576a42272728a22b, 0x86609460f7dfd659,
+	 0x32f9e85fa578321b, 0x2febf4ed2658d7e6, 0xe7bedabde68660ba, 0x8763ba95af20b202,
+	 0x3909a9b639304177, 0xfc038d80a6137a33, 0xf3d5321297af7267, 0x57304d5714085d0f,
+	 0xc53cfc5b61bcc9ed, 0x4417f39d80c8c949, 0x0228911573d51ee9, 0x27f8d0663c563c0e,
+	 0xc531f9c8c95fd146, 0x89abb861483efe8c, 0x9b183355eedce323, 0x5c7b55143a5bd7f8,
+	 0x8ff46bfd9557b5e6, 0x957b7349d3007925, 0xedaa26e59ee8db44, 0x909c694543c813cc,
+	 0x36f8ca9721b53e8c, 0x3cf79a0c708c9190, 0xd206a0d168e29754, 0x04bbf4bafa914c03,
+	 0xc3525074a6039fde, 0x717e8bd460a80905, 0x83f2a26201dada6f, 0x048d47afb8559aff,
+	 0x801e798a1eb506dd, 0x5994b3f71d4414f5, 0x7d52355797ed2107, 0x166cc87db0158dcd,
+	 0x36e4005f755978c9, 0xb5c41141e3ff04a2, 0x2f0cca0dc1104fe0, 0x3f5300734f87e748,
+	 0x25169622b6372c61, 0x745d2c991a720fbc, 0xecd168cd5a0258ab, 0x07c63b8251a64185,
+	 0xa9f48230e0d18a9c, 0xf61c302c2dd92d8b, 0xa72215dee68d6556, 0x2798cb00e61623f5,
+	 0x2dc0d26e35d25ef4, 0x8bfd18273e35abbc, 0xae0aaad42a16d9bb, 0x67524297aef31c91,
+	 0xaf9c2356a6daf83f, 0xec8e4b4fa21e3a83, 0xdf680f4b8b33bb41, 0x9ea164dab3d60f0e,
+	 0xe22055a27e52d375, 0xdbf5e61b49873f68, 0xc1d44877398f7993, 0x118b5d2bdb2083e0,
+	 0xd204590511a0287b, 0x45fc7ca32c0c3814, 0x46ee3a6f04c37934, 0x8816d4e3ec9bf381,
+	 0x3d776465c6504404, 0xbb4c830acd4ffee8, 0xfdb8f2cc23f6b349, 0x8e4ab36a1cb9c908,
+	 0xfd4943654786bc3e, 0xac7554f03f4a7c42, 0x5ffb33c01d0d4116, 0x97dcc776beaafb95,
+	 0xe4097cd0c6071f26, 0x37ffcd744897d6c8, 0x5d0ff305a686ca24, 0x51462695116d1b6f,
+	 0xc7fef150594b517b, 0xec5ae4041e83ba72, 0xdc6af8f7f60be97e, 0x0271563249cae326,
+	 0x5097aec457723bbe, 0x1b55375561bafcd4, 0xa9d070439dae7ba1, 0xa9ae16bb55f549f0,
+	 0x1d8d88677e8b4c23, 0xbea75b2a945e21be, 0x1ddfefeb3e32b79f, 0x33e5b38d413b721f,
+	 0xf42cb20e0a6aa8f8, 0x8d0b6663c9b3ee8d, 0x4061deba4c4890a9, 0x8ab500f6236315c4,
+	 0x360d7d3df353fea6, 0x9c428aeef8a0c13c, 0xbea6964822f795b4, 0x102dd8dcc386e4f5,
+	 0x06e18f8fd577f593, 0x0a45d61403c9d8d4, 0xe96e0da4a50871bc, 0x2bafe2d81e75a7c0,
+	 0x641541218d90250c, 0xfaceb5285f3fa8c2, 0x3f433782c74b8e12, 0xab4ae444df783b11,
+	 0xfe313dca4437ed86, 0x16c4261499cd4d0c, 0x03c576fae11f2f4e, 0x041fdd1ba15769b9,
+	 0x00d4b78cb1e127c6, 0x000152af5a30e8d1, 0x57e2a99bff470048, 0x183f267ed180ec6e,
+	 0xd07d3380c8fb83f5, 0x5f3ec153427509ec, 0x7c2012f534240caf, 0x0199020ade8cd891,
+	 0x61e1402f14d16623, 0xef5112583a97bc30, 0xb96bcb9b894fcafe, 0x7be844a0c164a7df,
+	 0x7fbc6ba4deaada6f, 0x93c01af422b6e502, 0x4e2ff5f59ade0ce4, 0x7512031e93e4403c,
+	 0x0f1e7f5faeebc8d2, 0xf1065e645aaf5036, 0x1ec762940fb58c0c, 0x66a19efb739775b3,
+	 0x54262c208b49dbf5, 0x81e74ff3393da3e9, 0xa8557091252f02c1, 0x2b17993aed23b0f7,
+	 0x7bb3c38e37ed6b92, 0x124204b11e63590b, 0xac7e5c75586a9e08, 0xb37dbf9e6413c4e8,
+	 0x944136241e704b20, 0xe713fb479f2f0549, 0x2441f4238bf05f5e, 0xad649e7eaa21829d,
+	 0x1453c71761390d8f, 0x149c4980a19eae11, 0x97e5239596f2ffe1, 0x084d9162ce16ebd5,
+	 0xb1a951db554e15c9, 0x10d1ddfa3883563e, 0x52fd363e2b1db45f, 0x7ddf5a0a40b51ec1,
+	 0x37412ce21d15ee35, 0x0fa0f5bf1dbb8e84, 0x65c6efc3114df673, 0x169c36efe6f10c7c,
+	 0x1c36f732a273b481, 0x5c7c3fceaf30a19f, 0x217323d185919600, 0xa5bd9fc39d9a7f55,
+	 0x940e8e197fad235f, 0xb1158b8cd7e03890, 0x3e2a5eefa0cc3730, 0x48936d1a928db6a3,
+	 0x27660db55e66a31a, 0x76e50be88f011ce8, 0x1a1fc8ba60c6e778, 0x0b852304a625cf18,
+	 0x9054f6cd8f8ac505, 0x5bdfe856cb3205c9, 0xbad1b34e435a8e96, 0x17de2df9f3cca209,
+	 0x98e60854c5598220, 0x789f3e46fc00b949, 0x2e70f26b3c9af6ea, 0x7f0ac6d0c313e466,
+	 0x74e1b23b38dc139b, 0x23265dcccc1453fb, 0x6bd29f83dc7551f8, 0x1d51a6f313f6ad0a,
+	 0x518afb72b737c0d1, 0xfbf879b0f8f44d27, 0x47d8df5e1d2be172, 0x9b876225cfb363f1,
+	 0x5d5dc4894d9d17bc, 0xad5242ebee47bec8, 0x3f13a06cd4d4aee5, 0x102828859608355b,
+	 0x0bb97e3a523be8be, 0x2e3af5d3c72afaff, 0x4d3c4270574423c1, 0x95b5620cdd306b34,
+	 0x775e6d9a571100d7, 0xabf074d2f5d08d8d, 0x6706870287eef295, 0x9ef1ef9772e7c272,
+	 0x1736131e92c28e30, 0x1104977809cc7cb8, 0x84902f61845e1f52, 0x2b4bed663654e8da,
+	 0xf81e0dcdd774fb89, 0xbb74e2a21437c1a0, 0xfc2b105c20f89475, 0x414e3726a43f525e,
+	 0xfac62c836f1fb00e, 0xe04cb8c1385ad14d, 0x75cfffc364f632ea, 0x15d716e10e14379a,
+	 0x4ae259703dee1f6f, 0x352d2d40f5af2e43, 0xb5cfa8dfb2809e78, 0x3edef09e88139127,
+	 0x7904fcc4d5df52c7, 0x247dea6dc4566199, 0xc571d65fa9d220cf, 0x8231d7f126eb3bd2,
+	 0x05da17ab9d2839b4, 0xaf880503af313fd1, 0x3a023f0929ccb3f5, 0xb32d30692d5de19f,
+	 0x183e6c86348c129a, 0x8ca6c100af7d561a, 0xec9a9b366a699d3c, 0xaf9158e31ca7398f,
+	 0x783c6d427ed53720, 0x82b0e52eb90d5d9a, 0xf9fc0e282e6ae9d4, 0x8bbc5db2a69426ab,
+	 0x618d6b1805622e66, 0xc728daae0b4a76f1, 0xab35a9a9a155bb09, 0x100c2384d9ba53a8,
+	 0xfd00c985ba5045d9, 0xf6d6b63e8910f542, 0xe1cb0604eda278ba, 0x391669ac94971d32,
+	},
+	{
+	 0x7e8096d45b0d8542, 0xf01710dca704d2fa, 0x71d83308bd8f91e5, 0x6d17938d8eb84823,
+	 0xb5dc6dc50b5d8c57, 0x77ba225ef326935e, 0x88fd0331fa428441, 0x83334ba8f0a52260,
+	 0x4e5dc91236f982e4, 0x67dd78182ae57430, 0x5501143ddf0cfbe4, 0xb2cc9d054c26f98f,
+	 0x98623cacc796e856, 0x67ef55c00bfb2fa7, 0x7ba7a927f4e19dec, 0x88e88643b167bf13,
+	 0x9a83ed0b48183954, 0x12ee5d3f2284bda4, 0x436518e695e465ec, 0x238a09331c504292,
+	 0x5ef23d76afc7b165, 0xc47864f475a8b56d, 0x8997f5980073c824, 0xa1af0f0263257f76,
+	 0x29c0129cc24e1b2a, 0xd6ce327bc5c114db, 0x98b42d1186cf6088, 0x6258dff61e64f5bc,
+	 0x7af238f9b05f52f8, 0x7cabd0ea7cd598c2, 0x0a3abdf9c041c5c4, 0x74f84ca9a96bc555,
+	 0x1b18c4cd4b3fa1cf, 0x9fc08cf3436e25d0, 0x6dd00194c77821b1, 0x4ddcb51540ea20d0,
+	 0x5eb12a130c978aba, 0xb7f27b4dc54d6e78, 0x76df8233796b8ad8, 0xb55cc847f9543344,
+	 0xe67f7024feff8e55, 0x3b8865b598dbec42, 0x84a6f185e5c9ee99, 0x1868de144fca7565,
+	 0xd795622224214734, 0x3b3e177bea5a692d, 0xd259375db5fa98d3, 0x943b855e9a82044f,
+	 0x41ce265af5ef2af0, 0xc88a4a4b976e1467, 0xed518bad4c2f1959, 0x8e6de58b4d35ca7d,
+	 0xd78b6d5fd8e20c5f, 0xc14a89d2d2e33813, 0xea99c769f0adbea0, 0x526b3551fe8723a0,
+	 0xa6915dc9e612be52, 0x6b85690cab5356c0, 0x83536032408b8b30, 0x189f9a81a66e551d,
+	 0x0b3cfa6664761dd6, 0xcc7c6b2ea80b39c8, 0x0fc730dfa6d6baff, 0x905b4d3f7323f8ac,
+	 0x89e1181ad79e9e20, 0x4b39a56c4018850a, 0x58b1a893f4c3b4be, 0x68e488ce0849f154,
+	 0xc65c89a65d34a4d5, 0x2c66010aea9a52f2, 0x37e11920781c5ad7, 0x9653a2ef2c46d532,
+	 0x5fc949c3291379d4, 0xa1027a64dee920fc, 0x07f4f5d7ffa4c0c5, 0x5ab2cc9598fad4c1,
+	 0x4a453898f6336ca1, 0x621db5a83133bd71, 0x9454db1a21240a7c, 0x71f165c6ba7fd76d,
+	 0x305632f602588581, 0xc472f6f08b433ea9, 0xa7791ab52f7ac50f, 0x276fbc097c7dc8c2,
+	 0xfe986f3ae9475454, 0x1c6af10248f82a4c, 0x43ed42c668b709b0, 0x6d9bd69109438bf7,
+	 0xb384e01712f3fb5f, 0x2a3aab6acf83a0ee, 0xd2a3e14ea1b754be, 0xb22a3f7105430fe7,
+	 0x9fce2fb59faa75fd, 0x8aff94760c653c87, 0xb969730b5ffc2e5e, 0x190c583b2d049570,
+	 0x158b91a8d78df49c, 0x44798f29460c8843, 0x5d2a2454d98192db, 0x42d7b97c6f7253ea,
+	 0x232f8ae5ebf182e7, 0x24db5e9f77bd6b59, 0x673f6807338d4fdd, 0x87272f5a5e6eefc7,
+	 0x8f84568ec144a8a2, 0x69b955fa1bdd64c8, 0xbfee926a0e27f1e1, 0x39dbaa941d0b4314,
+	 0xc462f1840824512e, 0x3c65d518d66af7e0, 0x6c4d9bd84f55a752, 0x55fe3bcddf45f62e,
+	 0x5fc6ebe71fc205c1, 0xeaa5ca080d434639, 0xeb314389b2087b65, 0x1c02f2e1a591aaf4,
+	 0x7fa8011696f7f0b4, 0x9ab20b69c34b2a9d, 0x02b5f9b23bb582c3, 0x7bb303fda9f61120,
+	 0x943225b9fc565a7b, 0x15e2316f561ce8b1, 0x967f6264da8436cb, 0x50cc52fcccdb456c,
+	 0xa4f20b9696b9c1b5, 0x007f71b802072d59, 0x3153c69b8bb57944, 0x59cac863445048b7,
+	 0xc810dbff1dc05823, 0x526936edfae74883, 0x305cf227bac59b89, 0x15b551c50db48c7b,
+	 0x4591cd01338ea3f0, 0x24a4f43367c826cf, 0x50bf9173e0afca91, 0x64c4e4c278a4d154,
+	 0x37a34e8177d11cad, 0xf9bd9ca619491486, 0xe4ec11431e08c7d3, 0x2fb7275c1d9a89ee,
+	 0x1bf6154dec0dd6e5, 0xcfe79a47f0ac7879, 0xa7864f4d5c7ed48e, 0x48ac78669c4c28c1,
+	 0xa6b1f9669c263886, 0x246dc0c5c80e27bf, 0x0195a77f68be8a3f, 0x9b7a833bc2129693,
+	 0x8e35a963e61107c9, 0x9443f0eb1890ce11, 0x2ed0cfcca9682e2e, 0x3371c2320a47fb38,
+	 0x85ee458eecb1f892, 0x31017d98416b928e, 0x595eaf89242ea555, 0x8995823b710bc760,
+	 0x655638f15acbbfe1, 0xdc81997f6c39aec1, 0xa6bdbfa40c0eb240, 0x5f654e1a46bd3afc,
+	 0x41fcb01fcf7eceab, 0xd9880e5bb516e78e, 0x2e90828061cee90f, 0x0e99ee18650b61aa,
+	 0x6f5f0c743ffa796f, 0xae3040f560443508, 0xf2eeb0fbc1b31b0a, 0x845fa29c9f19cc98,
+	 0xb0304a452918dc92, 0xb699ba8ba6b9cfa5, 0x167226190f782300, 0x96e36b6a4444b63b,
+	 0xbe159cac46b7294a, 0xc068bf1f134f1593, 0x1ea466420c5c1417, 0x039a1475783eade9,
+	 0xc2a9bcc2a0409729, 0xe10cf8371e1f9e87, 0xd26a831cf3055889, 0xab1bc763cd12f0ce,
+	 0xe7c0f47048781d39, 0xa683d75678c90b13, 0x13a9aeaa1e47ead7, 0x3be1b169b3169e6f,
+	 0x3ba5c70bc852bf2c, 0xa21a3d1c9c9fd721, 0x7bbf653ac5645f9a, 0x9ac7fb92a7202ff6,
+	 0x77bd5328138b0e41, 0x37a6ac0a0e9a7d7f, 0x38e796a2e87cccab, 0x48b8c00734e8ae90,
+	 0xee5a7b4d59c07c98, 0x90ced251d820f150, 0x5016199ede117e19, 0x0823689406865ba2,
+	 0x692c990459ee4cf7, 0x199cb3f260c7abf8, 0x8209cf2d2ea13d46, 0x38fecdc9e5e8007a,
+	 0xa55eafaf56c4697e, 0xb0f61dde8d94140a, 0xaf0de5d03da8c8ff, 0x6a0f1e80476a1849,
+	 0xbf5385defd6731b5, 0x30ee228d7247a55a, 0xff79c7878ecf6782, 0x2924a0aeacfc29cf,
+	 0xce5f6c3372b51064, 0x308c03f1b0f3aca5, 0x781769b57ccc1217, 0x28ac11517e40a6b2,
+	 0xf9f889bc916646ed, 0xe88f980f475eb4fb, 0x0aa6651a8e741f96, 0x6039c0b35db86df2,
+	 0xf8064f13728c3d2e, 0x71b3769e49ddce85, 0x68e7359bd76f82c7, 0x6cbec33cd454e427,
+	 0x49ea76b238f305c8, 0x62eb325928031a83, 0x6ee3aa9cdfc45171, 0x2f8287b2161e4b1e,
+	 0xf5adf1459a354394, 0x661d4b142f4629e1, 0xf82f301f1f70100f, 0x5a5be6ffc632b285,
+	 0x15a1705003145957, 0xd8c4312fb8fde220, 0x70a632a9d162cbdc, 0x644cd8d4683a2e27,
+	 0x425c5390fea6be44, 0x2c4143f6346b611b, 0x5a6aa29dfeed3fee, 0x3fd41afe89953083,
+	 0xb4d37081b34d76f7, 0x70b92d8845b0b6ef, 0xa912de5199ae44b9, 0x755526ecdecf25c3,
+	 0xc9abc71e03bbb579, 0xd70ebc6691141968, 0xad2d8fd0bc6249b2, 0x71993880c1c47bf0,
+	 0x629febe6b62691ea, 0x821ddc97f008654d, 0x30a92b680f8c8379, 0x4660f2495380e9d8,
+	 0x3d2ec6c7907fc7fe, 0x645f8292e8e2ffee, 0x57bff6403f8935d6, 0x6e1f84364f7267e3,
+	 0xb25173b1790a98ee, 0x98efbe9f31047eca, 0x8ef288b123736d40, 0x5c21a7f5a049482b,
+	 0xa75d2d72060a72e8, 0xc7723c2cca0d67ab, 0x0ed8d74bd4c32779, 0x30a4aa32b2c075f4,
+	 0x91cfea393aa0659c, 0xdb3c5defd469123b, 0xbe1c3968c8ca79e2, 0x4799a5f968854271,
+	 0xb6de01d2db63ff06, 0xfb2301bed7ffd1f5, 0x521ef1b54ae16803, 0x9a895ba6e2b001cb,
+	 0xe249dca61b481486, 0x08fa15d53cb8b3a1, 0x7983bd63ae5ee27c, 0x8ef948bd8efb9747,
+	 0x0ebf3c879348427b, 0x9bd995abe223cb43, 0xe9ed2547b9aad5a5, 0xa8d98fcb45a3ca61,
+	 0x966fa58d5e282956, 0x262fe39429b1d3e5, 0x9764e5d4d0da828d, 0x1e4b3fda50c413d6,
+	 0x3eb1829535cf0118, 0x96a1043ff4a211aa, 0xf765a1f8a01d0cc9, 0x3fa808125bf6d914,
+	 0xeb25d8a105cffba1, 0xcc91f68958657b9d, 0xf7f8db6e82b251fd, 0x4dec7b5c45c48076,
+	 0xec7e17d90c02079c, 0xec2630cec1a8252c, 0xb3225ad4e7485075, 0x35fd5fcdaaa1fe85,
+	 0x531aaa89d2552126, 0x4c6ee5ca9b4dce3b, 0x39f5b73d7113d0da, 0x70fb60f8acc1bab4,
+	 0xfaf8d2591c0cd4b7, 0x5fc501d6b1b7bd34, 0xa34b60c0dcfb776d, 0x11d11cbbb972e3b0,
+	 0x267fd1a24d545e08, 0xedd23c0f747cffd8, 0x65b56a8351963ea4, 0x41ae802d3eba34d8,
+	 0xbdd89b8de5f38ef5, 0x51624dfce02c3f57, 0xddf7d16527a686e3, 0x01a933a9529f76df,
+	 0xf82d030a4ba74ddf, 0xc3499922cabb9a01, 0x376f3beeeebf59a0, 0x9c5a4c128cfe8e8b,
+	 0xd21014249ed76999, 0x774005ba98357dfd, 0x07c0d0dbdeaba537, 0x7fb65510fd14c3f7,
+	 0x1e8d842bda5a40ef, 0x7d51792543f3cb27, 0xc219e98bca8998bd, 0x41592407c7d6e9cb,
+	 0xa83c2982617156b2, 0x5b62ea96199ae0a6, 0xf8b80d571ff3c151, 0x06db50569de1d27c,
+	 0x0c46303386286818, 0xe17b3e3b1971a8cf, 0xb8570ecdbb61dbae, 0x22e4ab7851f29f7e,
+	 0xbfaf37faf49b7dc3, 0x9c24fd2607c2c23c, 0x35df3bd49944131a, 0x9ef5aa3a40e28a28,
+	 0xc5055f87a08db176, 0x3d6399d63512ba47, 0xbb0f03440ac917c7, 0x50e146d8190b6890,
+	 0x0289b436fdbd3dc5, 0xfe952ddca16d6273, 0x304f2a88540f2571, 0x201bf9a0d46f3061,
+	 0x56ed409694417df9, 0xfd3623640392b964, 0x32682a1beeb88c22, 0x4926718998b237e1,
+	 0x7bf59f4cc96e5b09, 0x4053fa2ba620622c, 0x3e9dec6979447ae1, 0x9c45834683fb8254,
+	 0x496249f10a6ebb3a, 0xffae402d81cf5845, 0x693019db9a43f96b, 0x2c020a9b98a5801b,
+	 0x58a49ad27341ab90, 0x8658947a833dafef, 0xf78f135a8c1a7d97, 0x30b5db2190a937a0,
+	 0xf944b9ea1c1368ac, 0xd2180dc1f709ee10, 0x0bb494d3042a4f81, 0x4471e8c662e154d8,
+	 0x1584a0ad346175a6, 0x1ac73b6d18de641a, 0x70ccade817db15fa, 0x72726123012f6d29,
+	 0x16c410da367d8b3a, 0x70de2a2a781b6d79, 0xf146b1f94ec976b5, 0xa32dae056493be22,
+	 0xfb2be2149dc92298, 0x005ad45e0dc26ca7, 0x1b716061f7295e89, 0x682b67801393e532,
+	 0xca662a01cd8b8881, 0x99210ee1e36e280e, 0x4dbc2d75d4d997f3, 0x4af3f2ee138ed165,
+	 0x0755c89f022cfaa0, 0xddb9c7e77d0e24e6, 0x89618b2c2ee472ff, 0x273863b2e9959825,
+	 0xf17a55078959495b, 0x69d4496c988ebcf5, 0x05f61b016bb3211e, 0x78460a304377f0fd,
+	 0x568a7f981cd1fbac, 0x16dc510faeb47f79, 0x09b64cfee2327811, 0x75a2a8fc42be8141,
+	 0xd9304b7e9d4beac7, 0x647a1cf3a5762533, 0xeeeece7668485c90, 0x91c2f40ebe96a369,
+	 0xa8cf70a128ac3117, 0xaa6772e5d06974b4, 0x20dfbd5383de5179, 0x9d195b7f9974b8c3,
+	 0x405692efc539a747, 0x8a9cb53676be38cb, 0xd623412607df129d, 0x7c38506b1c731438,
+	 0xb7a6fd5afe172631, 0xfe6d0973d54191ba, 0x0c79a041572bafe9, 0xa0a4c5cabc259dcf,
+	 0x864082e52d4d5c4d, 0xca54839d56022d50, 0x5b50791ecf220e0f, 0x22d7a9a3feeeb9bd,
+	 0x7aa5ce66f0bbd92c, 0x493635b2ec035adf, 0xba534b3e45cd9f80, 0x729df22a521ca473,
+	 0x819b1fcf11079309, 0x6e3fd1b55e0fff6c, 0x8a7b4642933ae7f9, 0x9f20635fd5410898,
+	 0xf0ddb0f9c5189bce, 0x147c031d8b7e7bd5, 0x7cd2440c1e3acb9e, 0x5e16e39b6cd20115,
+	 0x1617638681443c1f, 0xcce87136d69be95e, 0x69aaec8406732741, 0x6dcb1af5907559dd,
+	 0x8d21a61dd617e698, 0xe87b9314ac73c173, 0xf2eab558cc20d02f, 0xb38d2acf735feeda,
+	 0x478a9ed44ecac88f, 0xcf833dd4cc719c48, 0x847e6630b06ada23, 0x75663a23c2aef1f4,
+	 0x54ae8bc90a9e7306, 0xbce06ef2fa5eb955, 0x772101451611a5b4, 0x94a419fe52d6ddcf,
+	 0x36933823e80c7ddc, 0xe024d9d91cce492d, 0x45dd9be57b597499, 0x9e5b8b361d394a7e,
+	 0x31b67a82ee1255d7, 0xdcab9a0b9aeb6626, 0x437f20cee25ea39e, 0x7d05cc1ed5fdb1dc,
+	 0x9de3c68348541792, 0x92ddc9f5b531ba59, 0x0d6ec564086d6cd9, 0x0d1c274059137833,
+	 0x04d30045815edcc7, 0x36510268f5736c86, 0xa288c3780dbf6bbc, 0xafa40539868350af,
+	 0xf46391091d87abf4, 0x90cc3cb3c9ba7b6d, 0x6fde8d9a6fc3422a, 0x6ca137c9c5397744,
+	 0x2ea90f64d31ce1b4, 0x7c25c0ac33352d75, 0x545411050b10ce31, 0x7367c44742837a19,
+	 0xea3e02df0202a8a4, 0xa08de732b4675e9b, 0x3a40a1a4b0da6925, 0x9f77b858cc0af62b,
+	 0x1d2ac6759c59fe60, 0xd10989ba07c5c774, 0x8b4b45f3915e0fc1, 0x5dc557ed73cb5bc1,
+	 0xb6a1a1c2287482a7, 0xbdcd5c6b20d23db0, 0xc8d8e3ecd76bef52, 0x4c4d09a81ba44548,
+	 0xeb35284be34f9019, 0xd2fb4613d8cbd54c, 0x31c44a94acf53016, 0x7c7110a93775daca,
+	 0x1e3a16364f66cbd1, 0xbc19ab1fa61e893d, 0x32974dbc1c6010d2, 0x2f38c36ef003e772,
+	 0x975d19417f9028e6, 0xd67d9c00093e44b2, 0x2b53edef23ad8de3, 0x5315386343f7f6da,
+	 0x0819af477551b3cc, 0xa36784ec91947895, 0xe5ec92da4bba6b49, 0x15a6a6f1d41316c1,
+	 0x8522a75cb84e3762, 0x80ba02c587b79a75, 0x4e34adbfb6f44d50, 0xa54da679c76abe25,
+	 0x4e4fd2677996ce13, 0x6baba7b93429f7d7, 0x9af485405e7c7a32, 0x6d7ecc71010938b5,
+	 0xe71fc63b331d231d, 0x98c49ac4068e6c57, 0x0295db261168f3c0, 0x59674d3f61121c72,
+	 0x51d09c274674d9f7, 0x4d0c473f0890a52f, 0x72fdee5be515f5c1, 0x22ba98daf20d45bc,
+	 0x929d9e3aecb52744, 0x27e59f71cd8febfa, 0xca4284e04e7d8856, 0x0e30bb81e62b69d3,
+	 0xe17b0df171e844fd, 0xba89d0c23a457e24, 0xe1a2d9d1bd9be9f1, 0x567fa38ba812a576,
+	 0x508d548cd2448ff8, 0x4bc9baf84c9b03db, 0x622298a272c713be, 0x7c8af2f82cd393c8,
+	 0xaa22ba6117f13b65, 0x82dd651e9aa763b1, 0xcfdb46d8e09170fc, 0x09410d252d60c7cc,
+	 0x2ee38e9fe38e98e5, 0x59a93413e6f9eabd, 0x61dd6872806ef1c3, 0x8497b4b46bb51107,
+	 0xed042b30531e7674, 0x2b77b6d98e7c54a7, 0x5d4743a341b3615d, 0x7ca4716de81f25a3,
+	 0x6e390ab73212eb28, 0x9175737155e0f682, 0xd6d19b73cf7e5c26, 0x2d159ba1fb87fe5b,
+	 0xd7e556cccc334d01, 0x1d66e70a90fcf871, 0x98c40abb3e682d3d, 0x17b778f974a1b91e,
+	 0x67cb7ca3dc93981c, 0x95a11d9e8042859c, 0x3fc7d4eb5134330b, 0x5c44bd283006e35a,
+	 0x70821dd90c94ca30, 0x28b04b8312585c96, 0xc629ceb4082f806f, 0x25c03d0496358106,
+	 0x99cae0e7206b457a, 0x2e475cd1d8b06704, 0x4cb789effd899637, 0x310fb89e4cf16020,
+	 0x22356d9536d79f67, 0x0b42a671d800197b, 0xf52c74c0c25cbda5, 0x194610f61b6fd537,
+	 0x881dc8462d0674ab, 0x0c392378050d7121, 0xb4bae4d833711dd0, 0x149b159275654339,
+	 0x5746760a45f41686, 0x8d01432de79c9321, 0x83defa276280bc27, 0x99caa36f35e59d4e,
+	 0x04cb29dfdf649a73, 0xc13602216bf4e861, 0x9803c60d061c4ad2, 0x4ef769a3e4615cc7,
+	 0xa5ac00dcd73cac59, 0x58afea5861867c69, 0xd1b04c11ab9dcec5, 0x1b4036c30fe1f300,
+	 0x83252adbaec919a6, 0x0b40cecb32410445, 0xf7cb34aa31fc6abc, 0x9edb04112472c1d6,
+	 0xbe8bbe558cdfc4e8, 0x218d14b6ac3f9316, 0x3106659a01b8ec13, 0xb2d7321edf93d52c,
+	 0xa5cdbf16e7d4454d, 0xc57d0e1235905075, 0x1a9ef349c3feaff3, 0x986cf5942bd1ed5b,
+	 0x5ef5601b36543192, 0x83368f57a4fbab47, 0x7cb4b15a12708622, 0x79f606637e8d84d2,
+	 0x4d46a704442ed554, 0xb500a27b94f1a0ad, 0x730ddcb05848cedb, 0x00cd424d8d5f3d07,
+	 0x2f2bfc0e1c5d04b8, 0x30ea07a3f641fcf9, 0x1828245fc19c1e80, 0x83d8fd6b085f44a5,
+	 0x6b016468ec7d38de, 0xb7ec2cbad0a1b600, 0xf96162429b707e31, 0x8dbece4b6c57f289,
+	 0xa22aa5fca75e20a6, 0xbc2e7bd972ad5ca7, 0xe4db385e21abced7, 0x68518a725ca2dbaf,
+	 0x12bf8895ef76dcf1, 0xc6ed7bd9fb842038, 0x987fd5c909048cd4, 0x20a1be0bca61b0a9,
+	 0xd3ab43c11d27c599, 0x494c10f82a0737e1, 0xda05dd32e231387a, 0xa4110ee8b279d35f,
+	 0x1b773daa096b0301, 0xfb3f3a9c6f2e2eb5, 0xfd756148ef858ca1, 0x0cb749dc91f36949,
+	 0xb4a4d5e5236e3524, 0x6c9cd69146c7f12c, 0x92a7ba898ffd9b29, 0x62b75b7d3166a015,
+	 0x1e1fa4861b26cb76, 0xfe9b3e4c91130924, 0x9a5d856a06467a35, 0x5c0facc6c6308e09,
+	 0x7d89ca1684bb930b, 0x0d65e23fd0694039, 0x69ce83a077cbaafc, 0x6504c7510244aa0b,
+	 0x3c233949ecc46b6a, 0xc350e9d630b3991c, 0x2fcca4c36bb52ee7, 0x5025b459fabfdb35,
+	 0x52d65e090e208926, 0x7b8b1399d3b7c979, 0x6b268f908ca7bd94, 0x5c4a81a535df79d0,
+	 0x04c89305a63a0f28, 0x91bb09b3bf2eaf28, 0x3fc65d1e017d102b, 0x68aad2dcc1b3b96c,
+	 0xd19e757ea135ba12, 0xa790668b8d0be78d, 0xc41de356f427c892, 0x4b1937dbce28e0b3,
+	 0x09c43aaebe919663, 0x2aca874ca1be92de, 0x36723981c25f9a91, 0x81f38c6d87e9915b,
+	 0x0ce36a36a52db021, 0xb0101b348d49fec8, 0x198aa79e05f6c472, 0x57cb8e1cff41bd4f,
+	 0x5668bc5423a323e8, 0xe13ee1a29e14a489, 0xa1c3a218ca9d445d, 0x9eccc42cfc13b541,
+	 0xa055a7637d25c2a4, 0x801a49694a3aa0f9, 0x82dda398e4766210, 0x0e0fed54f9f0b9d0,
+	 0xc654ee1873f2c540, 0xd51354e5233b29e1, 0xcc6c12734de7647d, 0x45407d6549d4bad9,
+	 0x4d79016f67a9181a, 0x0f2dfd7809d37211, 0x2317c5b756ac9549, 0x8b55ee27dc304806,
+	 0x0b817db9b8cf8f65, 0x6ec471d7990d0b10, 0x1b907ab0fbc43613, 0x0aea1c7870230c88,
+	 0xd73ccdbd57b89450, 0x1149bc672ccaf86e, 0x3301cc3fd15aa37f, 0x934d1944415b3c17,
+	 0x21253c62a7426512, 0x4aa297e7add0bd6d, 0xffe5ca631a98954e, 0x0da9e452ab3198af,
+	 0x6b268bbd6286885f, 0xf9c02242e420beee, 0xde0f5921a51a03c5, 0x02443617b709a785,
+	 0x1a1a4709774ff2ec, 0xed88cf043d679129, 0x25bfd37b25cdf6ba, 0x9c998ba88b7ed066,
+	 0x7a9f6d42366a231e, 0x45d676acb1495249, 0xcbf3a624a0f16e14, 0x8dff59d3da423ccc,
+	 0xd2031ce8263b0f0f, 0x68bbaf7bc3c5284d, 0x9f35ffe4bf740f8d, 0x2be2b1f9066a26cc,
+	 0xedb478249582c98f, 0xe96ed5e2f759a621, 0x642b9ffe4cf38691, 0x7432069ad675654f,
+	 0x686c0e6f87d17c9b, 0x37b72d4314110b12, 0x63a1c8de7c8d404f, 0x104e27c2b97f44ac,
+	 0xdbd7cfc4569c4013, 0x737af3c28a7bf202, 0x1b1a62e1bfd50c56, 0x29220bd886f7a900,
+	 0xa0eaa2b20bdbff85, 0xfa7a9873b49764d5, 0xf8cb42530973bd41, 0x7350386fc6c9e53e,
+	 0x7149870ea4c9ea33, 0x204815e835eb1bdb, 0x5015edf961889695, 0xb083fb445000465c,
+	 0x169310996369bdc2, 0xbc05c1e8e556e217, 0xc3e7e75f6467020f, 0x798acddc30763976,
+	 0x4c5ef62a1fbbe80e, 0xdddae50132f19fe6, 0xb34e07c3e6943954, 0xaea5967999294cac,
+	 0x0ee6e82f58bb55df, 0xa25a2e11432f7401, 0x284dde6a942c3c3e, 0x105c0bb5616fdc51,
+	 0x687dc6e686fdd0b5, 0xe40192b0298933f6, 0x33a750e3a39db166, 0x35f03b3ea5d2c71a,
+	 0xb41722b62c3c3a3e, 0x3d42453e5fc42d9b, 0x119ef5649eaef9ba, 0x7b77de2792295573,
+	 0x143fcd03ba232888, 0x51cca3b506655f60, 0x688373a6e96ab8b5, 0x740c70e5ef988bb2,
+	 0x5bec438a5ef94c25, 0x579c2d5c910f09be, 0x9c97c80ac9d0dd3f, 0xa548426696f891aa,
+	 0xa501c7cb3a5726a0, 0xdf7ba2397bbf191d, 0xe06e486ac77727ed, 0x8542fc7e2fad6d70,
+	 0x42b2129e821827e3, 0x6a8826568d408322, 0x9f1a95e18048ded5, 0x6d4a0b325e373429,
+	 0x415d83739825887c, 0x50f2d86813eac66f, 0x7185d9eb70977acc, 0xa87cdc3ce7b4bc25,
+	 0xe4cd1931919161f4, 0xf8ba6d7ee3d0cf79, 0x094e5c8c28acc291, 0x4b9987af75a26efd,
+	 0x01a101e3c3db9b72, 0x34ab1b1cb6f568c7, 0x0741c336a4ef06e7, 0x22f8e888083a7e4c,
+	 0xd6eeb9d67e84c226, 0x7aecca830cf600b4, 0x384ea7d3be513e72, 0x860782f47ebf8dd4,
+	 0x50ce48ef1d46ec40, 0xec6c31ecd6585a1d, 0x0d0713c63fae2800, 0x0f5a597829dc2f43,
+	 0xef43efb62f89a460, 0x8e586a250196bcdc, 0xb70ee341137f17b8, 0xb39ab59f68430e5b,
+	 0xb76afd9b154edc8e, 0xab36ef947af56317, 0xc5e2fa773a0595aa, 0x6f000cc13b81f680,
+	 0x5a6dbf3b038580c0, 0xc3b0c38630047603, 0x52d870ef054855e6, 0x4b71fb6baa3c9071,
+	 0xece3f5c2fd7a7285, 0xf689cf7d12aa4503, 0xc8fda7391c5603b2, 0xa19121e84c4c973c,
+	 0xbe8d61e5fc2d7de8, 0x762614d30fb55b3c, 0x7b5ae7e6d185ab90, 0x9a07e98d993cf3f1,
+	 0xbe836fe42acafc66, 0x329141f907fa4ac6, 0xf05833599837cf9b, 0x4d465bfa4c4de5e3,
+	 0x58a84f2dfe61a98f, 0x9a4c90ed63328f38, 0xe8eaabc02e806e38, 0x90ecfb77c3378ba3,
+	 0x1a150acc8a357d20, 0x366aadae47420e7f, 0x057db9682031696f, 0x994233f5c5f64c38,
+	 0x88edc876a6970569, 0xd3613fdf4fa93f1f, 0x6b8db749c6e6de99, 0x0de38e580e46f2fd,
+	 0x70c524753090e13c, 0xfcd9f763db89cbe4, 0x40f93a3fe74e0aea, 0x342131e3f857f856,
+	 0xff4eb6014a3f75d6, 0x845d369094878c51, 0x638d90ee4f650eaa, 0x5d4202b7abb94495,
+	 0xb6cc5f9f675b7350, 0x3f27eb692db0891b, 0xe645ef252369728a, 0x4fd57615bf5c1671,
+	 0x17a0f0f8eedb0b76, 0x58864e5a1e53f870, 0xde4a513a5f92ac29, 0x19945abf020084d4,
+	 0xa60a0420b2725ca4, 0x887baaa54179fa44, 0x45034842edf4eaf6, 0x137051e3208bb4df,
+	 0x22f0099856d4b49e, 0x0ea02a1064c24df7, 0xd752254542885a69, 0x917f366576f6bb8d,
+	 0x08ab616f0125a4de, 0xb6286812bc31b354, 0x7c5b77bab5a39d16, 0x1a1c683ded3e68f2,
+	 0x553c6dc1a05b3004, 0x16ec86b22bdf5376, 0x57fb48d909ece4f4, 0x154d1a7acff11d6b,
+	 0xb9485ed20c179393, 0x473afe43be91d1d2, 0x972e995f879abcf4, 0xa4fc064d03959fee,
+	 0xa11b68ad5425ca57, 0x32fbb9876d076e2c, 0x809f6a513ea030b8, 0xa652fe941b26a1d3,
+	 0x6dbe33d01b59189b, 0xf7ac6a424e48fad9, 0x3c5283cbc16ca833, 0x12d1150b1e6c1798,
+	 0x25ed4fa84e11af7d, 0xfab11de221cf0139, 0x9399f25fedcdd7ad, 0x4f7df23285723535,
+	 0x246aae6108929166, 0x88fb866adda60cf8, 0xb3d553cc5cc0aba9, 0x7453aad67810e49b,
+	 0xa9c05bb441657a7b, 0xdd4affa3adfc1bb0, 0xf9c40a61a5191e58, 0x503f9400859fe8a3,
+	 0x03e6bf83af09a499, 0x677f95317bedd203, 0x70cdaff8cf2fe191, 0xabe0c5736d7aaa59,
+	 0x0b6ef39d1324a0aa, 0xa6a277ec6402f013, 0x12fed0da9686d435, 0x00178ce9a8ca155e,
+	 0x0589be0d950656a3, 0x243b1c8d25182f9c, 0x0bfc95d2d34a2525, 0x6c81960ce956091a,
+	 0xf245b4784650e841, 0x4b421ab267dc1573, 0x2174b68fa02bef22, 0x839adced7486a378,
+	 0x3563af95d50d6cbc, 0xb54f943a913e3b2c, 0x813b1dead3cacef1, 0x67afef35d0e0a7bb,
+	 0x46eb606d35a8b537, 0x5a8cfd848f494fca, 0x978385dc0001579e, 0x1860d8a5ec28df31,
+	 0x48334ea527be2a85, 0xc99c8eec64902215, 0x63aecf0b2bdc05cd, 0x5fd8246c63f6fd37,
+	 0x9dba8357b45df871, 0x865a3dd0485d010a, 0x8564e7ddcf219b93, 0x83629cc290ff9752,
+	 0x7eb6bff33474ec8d, 0xdbfc4b3c3bc7cd87, 0xcebf1074494c9187, 0x202913fcf7267eee,
+	 0x956e103eb00bb675, 0xa5d0defe419ab3b2, 0x7f3ecbe2ed209984, 0xa212c04da525a61c,
+	 0x5df64a352429c7b7, 0x6784865c82a78b93, 0x0e7ce2ff79a1e12c, 0xae7ff05c5810d078,
+	 0x99da21aa00e7f7f2, 0xbb8357e96c8f75ae, 0xeac8058c9a7f7e43, 0xb3f58856a7b384ba,
+	 0xb89fb1c162302f55, 0xdd7ba2c51a884a82, 0x5ed2acb1811a1717, 0x158cc99104d2dde2,
+	 0x30a9be4209235144, 0x2e81b86718416135, 0xf357be484ece3c5f, 0x9f9dbbaa76a0dc52,
+	 0x80debb3918980a48, 0xba476bbc68fc9efd, 0xc27a86ef5346efb0, 0x20338a7577def1f1,
+	 0x80e76285de63e9ce, 0x55963b8b8d2b4c86, 0x3b50b0d0384fd09b, 0xa0b8b2d98202d8ac,
+	 0xf61f4e92a71ff8c8, 0xafe216d62dbb2ea3, 0x2eebf4856633f220, 0x0432ba9a8b2b54b2,
+	 0x5136131e39272dcd, 0xeafdf2637e6846a3, 0xf208614eaeb758f1, 0x053d71c74249fd06,
+	 0x32213181f2306263, 0x09dd8f3796a1a76a, 0x6cee3fd911a772cd, 0x416e7dcdf13efc6c,
+	 0x004abeb84cb7306c, 0x602974a083c222c3, 0x06102f8dd124c872, 0x1dcc6bd69ecb9934,
+	 0x717372ac725da3b0, 0x922458f91c007f79, 0xe30f221b2ff46120, 0x2ccb8de2cf775705,
+	 0xd5425163399845b5, 0xfb9fb51854002728, 0x682ba5b8dd00c239, 0x9556b3ea78396edf,
+	 0xc07418cc20430595, 0xad0e0a76a7ed4d6f, 0x18b2d4a23ca38694, 0x6cee7a040167dfc9,
+	 0xae19528ad789ca33, 0x7d6e760e471ed35b, 0xfcb41887fa68a0f2, 0x631e9cc29ef2182c,
+	 0xdbe6e8c5f8da8bf6, 0x55790c6c45db3a0b, 0x71f598348926b84c, 0x5b6ef04631fe8fc5,
+	 0xaac013352253621c, 0x1ba16e185621de7d, 0x24cea40b1e329c31, 0x90edd46ba731ccf8,
+	 0xdeb7dfe5956e25df, 0x4de9eff0fa54cc35, 0xfb1076236a4c0f9a, 0x091922d44254b00f,
+	 0x1e19c6209722d9db, 0x6a086c399112cffc, 0x107304fe456c68de, 0x0722949a38c12bb1,
+	 0x16961d34ce3318b4, 0x8ae525c453ed3a4a, 0xf3f56b95ca27e516, 0x5653ebeefee6b559,
+	 0x9fa0f3d24eb1c101, 0x018bfe8b98c26de0, 0xa6a6fffcd3ef6af1, 0x817191cde074099f,
+	 0xaa3cebb0d624bc42, 0x8b18774ae43b16a7, 0x3cb8c59279aacc01, 0x5c852862f8c72ef7,
+	 0x7fd101bd935c8ec9, 0x729bb2f44507e154, 0xf85266a3dc7ef1bb, 0x59d04eea7eb18895,
+	 0xac9dc859ac032677, 0xfa82e8816cf2946c, 0xec07e44d1dbf5084, 0x4bebbc96b8d34909,
+	 0x46e1b06493f3cf78, 0xd8d6549aa08ac092, 0xc9f3fbf358684751, 0xb60101d5fedc67a5,
+	 0xeac284f9850591d7, 0xcaf414a46a6f8702, 0x24886a6ce4eaaf15, 0x47ffdf4f47afc617,
+	 0x367cfc543043cace, 0x33eeb9b4ebdf13d0, 0x9f921d3bab4e22c5, 0x9126a6994fee2c5b,
+	 0x4cbcbb08bd8cf4a8, 0x75e6905d1126afc9, 0x3c433dc41284e997, 0x43a509c6e97343ce,
+	 0x68e68df2cf5c6458, 0x6f0b05f4a83000aa, 0x05edf52041dc1128, 0xa2f34bcfa4f165c7,
+	 0xbfd1a02f868a8999, 0xcd9b1cadf40a1df4, 0x4ba8d0faec5983a6, 0x898a2469468ee985,
+	 0x20b983a1e1e118da, 0x7e058c59b511d822, 0x19c8c1ab480060e2, 0xa3f458c1a9229d70,
+	 0xcd7630d61af81348, 0x013dc88649f6cb33, 0x6bbdfcf55e00cb0b, 0x461a126f67d46763,
+	},
+	{
+	 0x6dad524b99d5b362, 0xb7c9744c2bf3ef14, 0xbcb4c1b94465f7ea, 0x4ebb274fd00b10d1,
+	 0x8c07b61d2648e639, 0x10d6019cc1117c52, 0xa0d28b6f5fb2c7ea, 0xaf4f2d84f8e90d99,
+	 0x2f2b95e1ca23c2be, 0x8db4ca10bdeadf6e, 0x25a71138491e0ca9, 0x9ef78f3d9b3e6e84,
+	 0x0e0d583483bd62c4, 0xa66664eec9bfe072, 0x39e464b029afb52e, 0x33f7db7a9fa0579a,
+	 0x641e7ef23d6d3f34, 0xeaf75a986dce93dc, 0x2768f394388c5574, 0x4450b4388689e6c6,
+	 0xa339e2ff0689a351, 0x375c2f0259cc7663, 0x3c9cf8ee38c1e769, 0x366853d7a3f9aeb8,
+	 0x84b25da337e6e7ad, 0x92949b412d4835e3, 0x23739a75d9d48811, 0x8e2b24de599fc0e4,
+	 0x703e469b880723a2, 0x31645affaea72f7b, 0x5dfd329c81feed2a, 0x33a71e5c35ed0a00,
+	 0xe8dc40ae2eb35e86, 0x0115ab12d4bd4aba, 0x4b2dff231c99abc2, 0x1f5a566465a51830,
+	 0x9cedf457f737da71, 0x7a564935dfcb0b4f, 0x0b6f5f9bc6e15668, 0x22d0040c0d34c584,
+	 0x577118e0ade219ae, 0x9124131a79081f0c, 0x09588ab1aadfc8fa, 0x2f70553f2521657b,
+	 0xa3c0eb9b0e3f2dcd, 0x3847ab1985e19bb5, 0xbede9d9dc94fb3ae, 0x309ade3a970bf6d2,
+	 0x413550b121cadb79, 0xc628c23443d60009, 0xd63cbbbb08b9df00, 0x38f835ac07595791,
+	 0x27a19ac7556720bf, 0x75c2d8dc5e0d21a6, 0xadcdb1a2cf415a62, 0x06b4eb775bcea215,
+	 0xa5faef197ae142f8, 0x9af7c9b87f22a2be, 0xc9dd6ec739c02ee3, 0xb22ff1c10de60fc3,
+	 0xd30bcf8f4062be47, 0xd44954fdf88edbbe, 0xe70fb03c84d5924e, 0x35e5cee51561368b,
+	 0x348fb2d680f8a24a, 0xeec5a3cf5f75ff28, 0xb7fc320c04a60cbd, 0x8d75cc3dbf8d1f18,
+	 0x0771780da4e85348, 0xd2ae5b4d5cbaa7e2, 0x439d59bdc6367f20, 0x3bf74c961db72425,
+	 0x0693501ec6c1a6bd, 0x79be4695dfce4a96, 0x81a11e9a8ba082b0, 0x96a2fc0e9b7a494a,
+	 0xfb25d1a90ff996af, 0x26b7bd64e22db777, 0xbc5fa8614fb01200, 0x239db575e7c7417a,
+	 0x2db3851cce9f12c9, 0xcdf4035866cb3c88, 0x7d317a7c77f99fd3, 0x27207f15c960dcee,
+	 0xe3067acc07fa53c7, 0xe05e8541db0dce9c, 0x4540e0d92db92f83, 0x9ec730d5742c22ad,
+	 0x18cd3be83dcb9649, 0x5790467a237b385e, 0xcc2d32839bf1072b, 0x6d71f35c639db471,
+	 0xf0251864e33da347, 0xb534ff3a62b3e563, 0xe33f50c6d93d00bc, 0x3b8d1404735bd5ef,
+	 0x741002b2158a1903, 0xd820bfece5facf4a, 0xead0091100d31a35, 0x003a00c1cbf73d33,
+	 0xcc0b5bf87ea8bf8b, 0x6cc120d9755988c5, 0x6a515322d511de61, 0x5c92b9ce79831bea,
+	 0xe0a7e7f13cf075b5, 0x60237ecd75532515, 0x44f777ecebf294a5, 0x5a5d86697200f081,
+	 0xc0eb7799fb0b847d, 0x9b2068d5a28a0927, 0xb7d31f1b3c5f6d3c, 0x4236956bb7731f01,
+	 0x0f9cdce62bf852a7, 0x4abdb587453cdce0, 0x12ca37d470d334c9, 0xa848865074dde48b,
+	 0x12f3f45f985948bd, 0xa1b90db1c4fb295a, 0xcd9c7e02df0ff12e, 0x28e7c66e1ec0d926,
+	 0x6a6d0d6418b200b4, 0xd7786dea637b186e, 0xc17dd9da297133cd, 0xa2f8f0c5f5ffe1b1,
+	 0xa667c18952a02212, 0x936495b3c1e85d4c, 0x3b11e489a158f9b2, 0x5b1e4612cf758427,
+	 0x95562c57c3d2f6a3, 0x035dd9b41ae11140, 0xca6d64fe7cf9aaa7, 0x264811f428c67b61,
+	 0x75f3d67935790975, 0x7bd4cd8467491c46, 0x5ee5e49809e0ce3d, 0xa5da6e5cd2c8f861,
+	 0xfd32ae685fcf050e, 0x4c59bb32188350b3, 0xc690a3a142930ae4, 0x98f904f4ffb1e8ff,
+	 0x79c783897a8a7989, 0xfcfd7e4b9370f766, 0x0cfd47baef122c28, 0x8d7afd2a8731673f,
+	 0xa54061eb4897ba9c, 0x51e40d23b1861b09, 0x562a15b19a252da5, 0x4a2727ec5514921e,
+	 0xa782ddf617c628cf, 0x06495a5d8e2d23e6, 0x9e032565856b4f05, 0x9f77aedc10d45fba,
+	 0x0b1ad6a82c305265, 0xbcd69040abe15c44, 0x100c1a94bb18fdcb, 0x5b8f29ffce86f43f,
+	 0x49b60eee32c128b1, 0x0958e519378675d9, 0xebda346890231d75, 0x502fe1d3e868d10c,
+	 0x6cc6db252cf7e9f6, 0xacab620ca0e7333e, 0xfb745537b84ff059, 0x1e0117be7f85745b,
+	 0x232891c8b4e34d8b, 0x210f8b24e4433727, 0xa0c5d9366cb69bec, 0x151a9cccef41132e,
+	 0x33fda38c09d85fa9, 0xf216fb3cf005d046, 0x0a4896e736058ffc, 0x3b04093c6964be97,
+	 0x64cf3757dcb9421c, 0x54782e6bf52f5a13, 0xb635ddaa87b4a64b, 0x5c3559ab2424e0ee,
+	 0x1900677f62fbd6a0, 0xed4ea3e14b858249, 0x4e3e94827119888b, 0x93e974116d40aeec,
+	 0x8da6f3fb8b4a77b2, 0x6d44525198d53b50, 0xe8a5851655d77b3b, 0x15d077b2f70d0919,
+	 0x186907e55b0627ac, 0x4bac7437cb213578, 0x471b4fece8b52698, 0x1642d0a681d678ea,
+	 0x626d1169365061a3, 0x6b13f0c542f6fe78, 0x8dd0953447de6721, 0x17255da56df8ac17,
+	 0xa196e9bfbfeb64a7, 0x3f5c92be4e03177d, 0x7ad7e46accdba21f, 0x02a4d58f36050b78,
+	 0x870ff88888b49301, 0x65a0817e9e862e2d, 0xe3550bc0a0a5fc2d, 0x92472deac51e9c85,
+	 0xe05cee6f9acb9b49, 0x241df6e5b8ffc8b9, 0x779cdc483a595bf7, 0x3eb1e7a65a365338,
+	 0xc7057b7eef7018b3, 0x0c628533301e23ab, 0x9638138d13901be7, 0x1e0356708514f447,
+	 0x2f082628476a3873, 0x8882a872e527c501, 0xf2b066f80f25f922, 0x265571233d2fbc09,
+	 0x687eecd934352f77, 0xf17d066958924ead, 0x92dbd2854f1fe73a, 0xa51beede2956ee5f,
+	 0x4056ffa47bd28dfa, 0x64649e14ade6f034, 0x4ba4099fd3651c4a, 0x099a4ee62fc9d72a,
+	 0x4397c8d3c336c412, 0x27269264e1d427ba, 0xf3d164e6e4e86500, 0x4ce1637ec4caf646,
+	 0x7f4f0517297ea6a2, 0x233155832771f829, 0x7214f732b33a1ea6, 0x4841a1bbc51856a4,
+	 0x6bea65e4168a5b8a, 0xa45a35bd62ba23b0, 0xe048b5bc30e6f2b0, 0xb05e05eef1790030,
+	 0x967423c67569c0c9, 0x2a0423f9bd12f521, 0x6b0ed82a804aad57, 0x57abdbc390b171dc,
+	 0x018b86638abe03d0, 0xb0c69c025ba6face, 0x7a132a211a0ef1cb, 0x0604b5755c9e33f8,
+	 0x51aa83a22c964ca4, 0x26c6126a54fdaced, 0xa0810367edc63c9d, 0x55f5d8f7fef6fd05,
+	 0xd6677a71ed670cca, 0x855b49286c1b925f, 0x811e696919f2a2d5, 0x369eff4ba25b8c2d,
+	 0x9309a74bca4fd003, 0x46f6c6fe45c5dc62, 0x116dba9a409427dd, 0x6cfa50416847486d,
+	 0x71a9f5335740228f, 0x073c15b50fa90eca, 0x267dc61994a71659, 0x8f11b0da00431506,
+	 0x23ecfaa48e312320, 0xe7bdafc104bf7cef, 0xfe30116d1402d1ad, 0x296395285f16c848,
+	 0x7afedea14b6bcd68, 0x3ce435558500d769, 0xf7412abdcd48bf54, 0x9ee4df69cb14e2c8,
+	 0x431e8ee5ff4afc21, 0xe5c0980c99d6b2d3, 0x3e6cd4b78b00addc, 0x510a876fa195d574,
+	 0xf1fd4d85a8658592, 0xea68dfbbe1a8bc9f, 0xb088fbc729ade56c, 0x40ded244c0c5a37c,
+	 0x7af7a3ad0d2893bd, 0xf6abf73e92d8416a, 0xa4a963590588a0ec, 0x8594e5a3f4c5d310,
+	 0x48b19382beafa260, 0xa4c3aff8394aabf4, 0x8683556aed527b8b, 0x48a16d8dd5025c10,
+	 0x813acbd2120cc770, 0x1146d3c1d5d6bd4c, 0x1f3c180f1386fae7, 0x52c2cb3ee084154c,
+	 0x322a8ffbed8734e2, 0xedc6918c88afa970, 0xf72879151654dd6a, 0x9a8c64f9209c1120,
+	 0x5ea5bbbbd31abca3, 0xb6861af88634bc8b, 0x386fe6fd8b191a46, 0x25bc3e48d5a9d75c,
+	 0x7eb7154c91d6423c, 0x1bda0e766cf3acf4, 0x8bad5a2aa4f785df, 0x69b2020642c0f6b2,
+	 0x22e10c0e0ff429eb, 0x059f912ab4b18f2d, 0xb81bfcaa840c0c5f, 0x3e6cf26e287ace67,
+	 0x3194a56c81ca4e42, 0xf39c8de01aa5575e, 0xc5b005170b88ef61, 0x17bd429484fcd2ac,
+	 0x1e34351eb0a8ed9a, 0x611fb33ac80e35b4, 0x1d69081e0e9d5f46, 0x5bc0c7c92cc6adf4,
+	 0x320b0a3f3e0cbe4c, 0xc504fdf5a8d2baa3, 0xa340fccb8b9b09d3, 0x3516ab1808f17511,
+	 0x0b6d4ebed5a7c70f, 0x98ee91bd34da563d, 0x255c1fdd62dd8db7, 0x600e7ddf43c71484,
+	 0xa5bb1f5e383def43, 0x2aaaadc0b8db0246, 0x19feb9144d7f803c, 0x91f7ae6f1acfa5f6,
+	 0x397dccf35d8ea385, 0xb97368db67488ab3, 0xa8e40a109c8d3eed, 0xb3ab7d948f17d49e,
+	 0x3ef43d110c0ad072, 0x9afdb10a562d07dd, 0xf16abe9fc259db9d, 0xaec33a0d10111a28,
+	 0xab716656d83760f3, 0xb3c2bdb7ed2c83bf, 0x780d7615d4bb67fc, 0x662c586801423c89,
+	 0xf2c46e2111f3698a, 0x342b14c87c74e367, 0x00b417287e121833, 0x77ed1002af8f9ee8,
+	 0xbcf2da589bfd0706, 0x61640be162454ed5, 0xc6819ec9af2724f7, 0x3b1ef03b344fa562,
+	 0x4babc927a378ef9d, 0xd3de30d7c0720d28, 0x08e25025084a225a, 0x583c5c4b08ccd532,
+	 0xb8b5329574155449, 0x48f04ff2a190a88a, 0x0f35163e5d542427, 0x1173629464d13761,
+	 0x5fa9e6cd70553926, 0x104ebeda91a44ea8, 0xb945e88ef9e33c0f, 0x95db5b683733ba25,
+	 0xe191639187f94c6f, 0x8b460439eecb133f, 0xf53072b5e849d501, 0x546ca99d6910f6af,
+	 0x2fdc426f30b50dd2, 0x7911fc9b53338b94, 0x37af40c77b62d4eb, 0x8449940b05d5e8cd,
+	 0x6cba386ca91da75d, 0x7e0e2d9f4d317f98, 0xafaf623734f47151, 0x8a7f7dadb27b7b22,
+	 0xe8bed68b11eb5ce6, 0xcad9624abe61df24, 0xf0c56f07a7d7afc5, 0x7c4174c20ba55a6e,
+	 0xa1b2f432d6d38b31, 0xb9b296c00e578e10, 0x838bfda809e1ca09, 0x2e3fa6c1df84daee,
+	 0x87f8b97941938287, 0xd91f3bcc4ff2e696, 0x09a86805765926a5, 0x0b94fb60dccceb17,
+	 0x04d8f6fd8c84ed2c, 0x6fd4eb85a338ce20, 0x4cb04e91f3779c7e, 0x3a3f5eb2fd0017d5,
+	 0x64cb572400acc62f, 0xf4520c88fc30e553, 0x5a900a1b16813cb6, 0x1ccb877129d4cd58,
+	 0x1084d1ba2ae20b34, 0x71aacc0c5328720b, 0x4e6abc6cbe7ad788, 0x37af10bd5c50af13,
+	 0x42fb28220d36f075, 0x36901db8b9ea5113, 0xce20d0530ebec539, 0x14fab6798aa1ace9,
+	 0xff7b128d53f1f39f, 0x0c79a990013f5251, 0x6dc62705d2346ded, 0x4f16d2fdbcbfe17a,
+	 0x043bb484dc3a958a, 0x29b18579a84a9d63, 0xf215ba6da9dead66, 0x0a51bf52e00f2cca,
+	 0xea582297c7db2fe3, 0xd744800f3a31186c, 0x3b8e7f76f7f38f15, 0x990ba93a18005d6d,
+	 0x550f8de378a79f4d, 0x9b1529681b50bca4, 0xe8e7ef13caf90d20, 0x9b56d9ca924713b3,
+	 0x10f6e85483831ca7, 0xfda785695a0357d1, 0xb9c8f93239f0359e, 0x34be21e4cb19a7e9,
+	 0xe3654db833d90214, 0xcf7f24a3bb33abaa, 0xebc9e754ab6c7dee, 0xaa5bca62f5f210d2,
+	 0x5e9fb9032e4f04e4, 0xd8950e7d89f5a5df, 0x45ebf32e97237a30, 0x6859eb5ead98413a,
+	 0x0792641de8300aaf, 0xe2c99617e5699ddf, 0x04723499956e006b, 0x409f775b5b1c8758,
+	 0x50c33964797bb64a, 0x067648436bbaaa20, 0xfa4a748eb9bfb332, 0x65b7eb984e8b2eb8,
+	 0x3f63be94dd14a13a, 0x7238c257c908074c, 0x08deb9184b6af23b, 0x2ab3d5227f83192f,
+	 0x1ad6ce3f4a569b2e, 0x36f3b6ffaeee7a1c, 0xaeac9edd5e4eb463, 0x3597e8f2b80fd9f4,
+	 0x60d9503b154828c9, 0x013f59e721974dca, 0x86fb552a6e7f0810, 0x99a32d492ea88022,
+	 0xcbf1920fc8139106, 0x13c5ed1d45f9dfc9, 0xedb1177caae3b972, 0xaaea882d10157e85,
+	 0x6f3a33b0e78d55b2, 0x4d4b2b58f36eb08f, 0x2cbd9d7b3ee1b2bc, 0x61f3568b4391c1bf,
+	 0x1d40bb9a61c0a41a, 0x960705b37f8aef39, 0x779c0d15b858c763, 0x8badb3c9083d632d,
+	 0x54e02dece1b4d860, 0x922eb9d9c3541b29, 0xbeab131a5b7d6f68, 0x03885976cae1510c,
+	 0x9be3ee3cdd641385, 0x0cf31d97fe8ed496, 0x0b2c4ace14729b3d, 0x5a6d378052272488,
+	 0xdd302c437b199227, 0xaf33d7d750fd80d8, 0xf128cde84238b2c8, 0x0833ce7abd9d036f,
+	 0x46bfb0ce8b07af4b, 0x06e523b2a1e97674, 0xa14152bb745caf6b, 0xb57793480bb20462,
+	 0x51145a276eae2625, 0x38bb3d26b8dc523f, 0x65cd16d2d95d200d, 0x7749bfb23cb88df2,
+	 0xae684e17a634080b, 0x85a38d4f00a36338, 0x979ee74b8506d334, 0x0843f5e8756e0476,
+	 0x7acaf68bc7a96450, 0x423cb98847f56fe5, 0x0deae865772e4ccc, 0x4c6d69b875683397,
+	 0x88d76ecb9299d40e, 0xccbcb974e31b3959, 0xff49d2272611105d, 0x74eb53b42c11e30b,
+	 0x77ee5e5caf5c16f8, 0x18d17469a24956bc, 0x9d42e60931c3a033, 0x73e7ee3674267c7e,
+	 0x08d94d6cfa7c3f2a, 0x5c6d496f8db89cb9, 0x822d658f7c438d7b, 0xb1a57c018e727022,
+	 0xa92c5ef443663e4a, 0xd999700c162480cf, 0x4b206a366c03f8c7, 0x10b464ce21a45897,
+	 0x503c3226b4452dc1, 0xe3377661b8366ec4, 0x232fe2fe84118484, 0x1712f13b312b28ad,
+	 0x130dd2dc827c460e, 0x853f1f58ee4f3a6c, 0x09819d702afc6aab, 0xb60c21acca4bc2cb,
+	 0x4ec92fb373005c1f, 0x37792b937b86773f, 0x607d27d9bda297c6, 0x9606b3cd3f95f512,
+	 0xa9a327a8d46cdcb8, 0x80ce5fbad6a26137, 0xb4e9da17853c5d8c, 0x51d7f3e16d4aeb4a,
+	 0x4466dce7d263b50f, 0x81f1898acd994063, 0x3d288871178f489b, 0x40bc888b5adeeabd,
+	 0xc3adf379ee982c43, 0x3a4df1ec2694eca1, 0x3df3aa993b990c1d, 0x31a93d9266bc72ec,
+	 0xdf4548c76728a2b9, 0x1b37690637008a4a, 0x37e9a50fb45c3397, 0xad2d991e2283f0db,
+	 0x64e165857053b4bf, 0xa9092aaf034d9675, 0x079333c7ecb3f5df, 0x87daa00e07bff1d8,
+	 0xc85a38e31a58dd43, 0x068c9e91df0a9ce3, 0x760b4a51be306149, 0x9ccbc67de2954ca2,
+	 0xc938f7ac5268e2db, 0x724920cfa98d521c, 0x609faff31b96202e, 0x3ad842d86192bb14,
+	 0x7a4ddb0157a5d045, 0x2690367d71b666e5, 0x9013b1a4fa655210, 0x593248b9e7013020,
+	 0x1e1efd804bba4e58, 0x7f2f1124db7c4b24, 0x1e437dd045352020, 0x21d9567888548bd5,
+	 0x70c15a930c672bf9, 0x0615352c7c046eba, 0x65d2f0df62bd70db, 0x73327b2f7ea77ea6,
+	 0x432d0f97fa430c5e, 0xcfc9c9294a420fe1, 0x6ffa8bff36216395, 0xb1cb2c9005253989,
+	 0x8d6944150c20c854, 0x53791e6e4e994634, 0x568eb4570531d165, 0x42771138be6e70a9,
+	 0x71bb23f664319d64, 0xf4f35db867c061a1, 0xd41f1a7cfb73a80c, 0x8d8202406bcbe720,
+	 0xea50469f0e4cfd4d, 0x30942943558dfa00, 0xf4ad6d2513beb9ba, 0x990af913763a3cea,
+	 0x37118db893a858e4, 0xf8eae93ca9bb38f0, 0xc191376848c1f1ea, 0x1d83034fb8faa7a7,
+	 0xfd3507faabd8856c, 0xc56fc33d92e15c77, 0xd488d7ed9596c358, 0xaf154f992e5ae12a,
+	 0x15633a8ab17f4113, 0x2707f934401ee42b, 0x874a3b6b31562fff, 0xa9d0f91a1360e5aa,
+	 0xe783706578ce7033, 0x87b2263c1d1ec89b, 0x27725f5d3670718e, 0xa9a9ce4c91257259,
+	 0x92036787b0d14c5d, 0xbbd73540d52944da, 0xb88901cb51b728fb, 0x1a2691dceaad9240,
+	 0x566e696770f089c0, 0xc3fdecad41f8c259, 0xea094536b659368e, 0x094a20cab059bd52,
+	 0xd5502bf3d5f1298f, 0x29e8fbbade109316, 0x9b603d46fdcf1bbc, 0x050a3e72851f296f,
+	 0x2f6d5c8b7b8fe020, 0xc4276f32b0ec4d93, 0xc10c69483b1b9e90, 0x88884c19461a098d,
+	 0xf60f7f42401eaf69, 0xc23e8fb12d186e87, 0x61015c5f41c89208, 0x0a7cbcbdee680c03,
+	 0x86467996c2dfac4b, 0x959e15ca2f4305c7, 0x3d8f587e03399678, 0x66570771dc4b2815,
+	 0x91e6f6fa672cc2d3, 0x0eb5e4ed22e56da3, 0x8359afdcbcdc8ef2, 0xacee6ea946a6831f,
+	 0x7f18ffb8ed143d06, 0x5bc92d2061f73072, 0x628444e8f5490e37, 0x429f823e4587dca2,
+	 0xbb3977f44f36377e, 0x80402628bdef71c2, 0x8dbe8b732b69113c, 0xab65e31ec022021f,
+	 0xf96f25fec9cbbd5d, 0x8918eda07224d343, 0xf076c11495ef598b, 0x7a4dd4cb39e21e70,
+	 0x7d6a868951f6c092, 0x105eeb794b37184a, 0x4c6a7e9443aee658, 0x623d419f16886701,
+	 0x7165575fd4b7a5bd, 0x7a5bf00507581170, 0xe61516a4153a116c, 0x2db1cb1582f8bae0,
+	 0x66870bdec79c7fb0, 0xa163a4431b30b45b, 0xbcd4d04dc5719f27, 0x611db60901bd508d,
+	 0xe335ab4827c39dc8, 0xce0e7ae1b55c216b, 0x1663ec2a2aba65ab, 0x013f4fe494998c47,
+	 0x7767a017e6485072, 0xd38ae8fa72ff9dab, 0x29f79b531d8b3d6a, 0x26647d1ec68219fd,
+	 0x8e75dd1380905a2b, 0x614194fa5fda0b9d, 0x011312222c9b4331, 0x8b75313637b4f90a,
+	 0xd7bad52f4a02c7b8, 0xee444dd8637cf062, 0x2a31199388bd8687, 0x069eeec2bff2c2d3,
+	 0x940001dda6e12400, 0x078188dd251f4d4a, 0xf4a2d3e7a4d9e174, 0x1739ed0046baa6ce,
+	 0x7cb27bc39c03d048, 0x8c284c430aeddabe, 0x629529de9d8b617d, 0x1187d8fbada255e4,
+	 0x7646585febbc7b57, 0x947bf2da12ce2f6e, 0xb5aca6f3ef625f4b, 0x1eaf5f55b43eb10e,
+	 0x5698ab2f1e5baaa3, 0x3332ab9b4a5a729f, 0xdda8ef9dd70c2302, 0xb4cea97adb534f8a,
+	 0x5073751310605493, 0xffd05f93ebb63d08, 0x44aee9f32c4f53f1, 0x8c306dfde7339440,
+	 0x12a68641d019705d, 0x9aaf231fcf100b21, 0xc1b10232e932ce74, 0x6ed714f1de375396,
+	 0x80f3eddee92ddaf7, 0xcf6faad4723f9796, 0x15b32f6d313c4b1e, 0x5a2e31c693153027,
+	 0xdc08974e120b5155, 0xdf44f2391fdca6ae, 0xaa71a6684c2624a5, 0x4aabf4a2ac51a6b3,
+	 0x6a80fdcf24ddd5c7, 0x4741ab2e2d4b71f6, 0x5afd7639dfa19721, 0x147599c50b53f0fb,
+	 0x72bf43538f8f3d72, 0xb3e9c2c89ee774f6, 0x29837b0e1addd497, 0x0c17f5232783754e,
+	 0x39bf07328f9a1e0b, 0xca9daa83da5b5550, 0x57858df97311c49c, 0x3de13c5aa1f7d241,
+	 0x79c16612ea8e72b9, 0x8a4e0c1624f83117, 0x788bc9849875c25e, 0x2e4b302d6d4b2b56,
+	 0xf6ee12f6dccf7fdc, 0x301c70989903b8b1, 0xfb73bd1b69a67115, 0x7da1a5ee567213e7,
+	 0x732c093badf31ce1, 0x45155a70e620d4c2, 0x2fe60d07ff4e9436, 0xab9ef4b009ae89b7,
+	 0x284280be1db44227, 0xf0de68463dcc0abc, 0x7517fa3b349ec2a4, 0x2e764c794e704d35,
+	 0x35e58c86fb2f4a72, 0x4c2706566df6dc83, 0xf2ef157f06e84225, 0x90b7b5700ae0cc49,
+	 0x352f40beec465f59, 0xd51e84a29297e312, 0x5502968486c4a328, 0x589b1a84add818f3,
+	 0x75cc8e9fcf34c73b, 0xb3c13be25f93323e, 0x4157b2a44dd2ccca, 0xa541035d4a197c34,
+	 0xd02aba267567b636, 0xdff77b61adb93fd9, 0x07a508ba68ecfcbf, 0x2e7bcfbdba0d6ec2,
+	 0xcf3a6bea0611db29, 0xd6f0f664a8e1e613, 0xd48db6eaa3d04527, 0xb61e92e50581efe3,
+	 0xdcebb4a72df65600, 0x94224228416564c1, 0xb45aa1786da48642, 0x177d9769e24f7054,
+	 0xcfa1ef875c638f41, 0xa745a3b0f7048e68, 0x9cfa6b10d1cd3b6b, 0x255aac174cb87f40,
+	 0xd3763b1cf7c888c0, 0x66968f9a3c63333b, 0x212dd8282c462904, 0xa48f60f0ca7d7e91,
+	 0x4b533990c161aa8c, 0x74e912456990e63c, 0x40afd2bd0aa51100, 0x8739c462393d5c9a,
+	 0x5a860c3cf3dbed5a, 0xe5fd18338e337e03, 0x5563169065615965, 0x1e713d3d708dcae7,
+	 0x52ee2caa57505506, 0x6dd88a78762e9662, 0x80eebe69f825d834, 0x98b679e6fe2a7349,
+	 0xc2a67d5ef993fc2f, 0x5ae98ddeac036316, 0x154b8d2270d1453e, 0xb5e1d94df28c2f1c,
+	 0x2b08571d13fb505a, 0x52dbe339da419583, 0xa4e176e2a8c2f970, 0x3c0811a7a99fcb03,
+	 0x291586f4ec15ac31, 0x8b09f909139ea164, 0x7747875bc73d9443, 0x5ce5813798e855eb,
+	 0x97acbd50ab8142ae, 0x304677ae34690470, 0x93e02590610316a8, 0x069544d58fe89dfe,
+	 0x64763b91c3fede86, 0x37735f9bf14b23db, 0x899be51245c6e37e, 0x4c35070f2c79ab2e,
+	 0x421ac8b23476ba82, 0xc97bb9a17dc8713c, 0x8c431cc39a07b34f, 0x33a04e274ff90e96,
+	 0x8c0ebf9ba7c190ba, 0x18de12a87335f590, 0x4ec175f11cfbbcb6, 0x5b51d4bc9f9a951b,
+	 0x6b6ec42be7f8f105, 0x79ff01de35fbee4e, 0x33f5e85178dda00b, 0x00c2d76c8867ab18,
+	 0x296bffbd597e6c09, 0x860aca66fd970b8d, 0x9d8eb6aecaae292a, 0x6224bf5422a66734,
+	 0xd4f89d0f23a6b161, 0x70e52553ec4607d9, 0x246338566b427e74, 0x9716e4e94bf032f7,
+	 0xe62ec816c07fd221, 0xf1cd0b28d4b1645b, 0xe6f0c343621f9776, 0x93d8583b6e5c6a4c,
+	 0xd204ad8520c730bb, 0x9a40ca6488420946, 0x4090bf12fb2eff52, 0x32a9e29455e9ebe2,
+	 0x55b766f65e2c3d7a, 0xe7d34af0bb649155, 0x8dd04a894af3b4eb, 0x443b0ece43baa5b7,
+	 0xec35e72c27d0ef0d, 0x3950fc00afd02a96, 0x5a4d30eab3015571, 0xb137eecb0115d553,
+	 0x43e1bb7a5a1c8a70, 0xd5544712c93dc463, 0xf6d508ff14b7a332, 0xa8a0b8d4ce14d63a,
+	 0x6f971a546a2c6756, 0x88c0dbed2d0cd4bc, 0xf6aebb1fbbf0831b, 0x2f8496840e752e64,
+	 0xbb31b71e0af914dd, 0x529b1ed1060620ec, 0x390613f13520decc, 0xaa362d9344e2083a,
+	 0x7a68aaeecd43a8a9, 0xae1be03f6b5e3b50, 0xf61775a33c530a6a, 0x089a5d39b4cdd3b8,
+	 0x08201650b9cfc9f9, 0x4d271ffe598c0779, 0xedb80679704ea0b2, 0xb4f98674a95259eb,
+	 0x775563537a6f0210, 0x03cd34f1a546741e, 0x2f68875ce8438018, 0x4d05d7144d177fc3,
+	 0xb5325287c75835b0, 0xbd7e87f0ab70f28a, 0xee21aeb516482f33, 0x1e89ba9766c6318e,
+	 0x0f17fcc8a16051cf, 0xe08726b2eeaff8ea, 0xca2d34d192c47e32, 0x34b8822b0574fec6,
+	 0x63f2912c477513a4, 0x7117cdecab9a4c93, 0x072a4fff96e6e732, 0x7b962cb50fb50902,
+	 0x7b1cd29cd330031e, 0x69396c85990509b9, 0x4db1544e838ef51e, 0x5904ade484eaf854,
+	 0x5a7a8c50632bbc19, 0xccc00b2511f676f9, 0x06c4f4c1dcee9bb1, 0xb5dda4c3cb136af2,
+	 0xd4ae396e26943d7c, 0xb228e33e8b794437, 0x444ed90b89caf739, 0x59cb46ab1172c571,
+	 0xb86602c49128efc8, 0x7b9e96897291c54d, 0x68688c19383fc8c7, 0x1a768c1bcdfe5ade,
+	 0x6c58a7565a1a7651, 0xc8a056bcd17f559f, 0x714e8d9b44139192, 0x7ae244f199a8ba99,
+	 0xa3bc8c72ca869b39, 0x24f124c2858fee55, 0xcb0d040bf19349a9, 0x435025dab43fd782,
+	 0x2b110d7b8a830346, 0x680e93ccd7fe527a, 0xfe7d7f13db346e76, 0x60927fc29de5dc03,
+	 0x2a8ef1b1cd457858, 0x771ef431bd8e2df9, 0xde457bfc88013803, 0x1b0ba8b4ba14e35f,
+	 0xe3aadc6e38cc32e0, 0x1d3e24e823e78a6f, 0x1c9b33f6d0054506, 0x202fd389d1d00b3b,
+	 0xecc0351a95906b72, 0xb5b49d4dc1ad1981, 0x7ae2efe0a6825e17, 0x8004139666297947,
+	 0x732696d7dbf86308, 0xd7bf9abea6c35372, 0xd5b0e70903f78c63, 0x52707ff38bd00ac2,
+	 0xc66e4c1149f9fa7f, 0xd8055d98141e3e2f, 0x6070e714195ecf80, 0xb273d4ea4624cb9f,
+	 0x8618e95beade05e2, 0x18a9c0ced78bd8fa, 0x194b672062ba3f75, 0x7ec59aa9eb07bf25,
+	 0x06d26b99638bfe9a, 0x888bb49c15d265ff, 0x63de8afe0a9f3799, 0x39716e365bd9e4b9,
+	 0x70cc958aa12b632b, 0x5c3c3db039e93799, 0x2d9f7f393b8b1107, 0x8509439af9c14cb7,
+	 0x06c0cfdd2558bc73, 0x4a124cf31f7f8cbd, 0x8b3878083dac5da0, 0xad64bf6ed87cb7e7,
+	 0xa089a7a58f2dd5af, 0x1a44ad61aae1b34a, 0xd1ef8df3ee3d758c, 0x84ba80b46cc940cd,
+	 0x4adc59c2e9eebc43, 0x202f7dc9ec7dd3b8, 0xc9e640740cdcd01c, 0x618133811eb2fe5c,
+	 0xe33e00ab4d2c8293, 0xcd12e3d68f8bfdb2, 0xdd9cd25de7248097, 0x11c39ad6bab229a7,
+	 0x05d8cfb4a1bfa259, 0xc4996613c6a56b5a, 0x72dbe3d9c70e0e8c, 0x36811d11464955eb,
+	 0x3e691aadcf88e879, 0x623207a2069a5914, 0x996b6fbd1cac1592, 0x987448bb4760715c,
+	 0x2b2bf47c710c82af, 0xd41ff0ad60518a2c, 0xccda1b859401a992, 0x08210da170a5df8a,
+	 0x69c560d626055565, 0xab01915e461ab95f, 0x493e2b93e4ad50e5, 0x8d17b78dc7fda976,
+	 0x2482527d8b30b41f, 0x9dcd51a70ca8846d, 0x60b0c7e2aa24df78, 0x3c96c5d8b7194da1,
+	 0xb241c05d6d6dada1, 0xde717b8643bab6b7, 0x9c8cebb0976cec9f, 0x2d7299154712ad91,
+	 0x65da4d11e4bc4cff, 0x17d27233ceee759d, 0x37efb559ae132c18, 0x41a10fa3a9cbfc1c,
+	 0x2efae31d819b13c9, 0x8709dfa572531c7a, 0x5b9b36b23b3b30ee, 0x8b4786ebd893b543,
+	 0x1fe4eaa868c0b0e7, 0xe076bc36bd63fd9a, 0xff02d3d2449be7ed, 0x9bcf2e662eb5dda6,
+	 0xc5175285d7b799fd, 0x8d21ecfed053b678, 0xbb191b65aa232f9a, 0x4afa930c54532a81,
+	 0xa4c5939c93bfcd78, 0x27c6c0f6fd40a274, 0x836fb9b6ff79dccc, 0x9c71149903600b38,
+	 0xdfba1dfe69f14b68, 0x7733ca05349ae742, 0xb22298509d1a6022, 0x94d19036493aa2b7,
+	 0xc189c35bcc91b071, 0x1cefe50cd10c7079, 0x8a569dce72f6515d, 0xa0d114906425ba51,
+	 0xc757baa39d135e6d, 0xe4bdc8c7e31620a4, 0xe32ab0fe8c2d42f7, 0x2a6d4a927c4960d1,
+	 0xef4e72ef566df66c, 0x1b3211a130fc77c3, 0xc3c984decc6f982e, 0x588a45afcbea683e,
+	 0xb766ae52d87ad811, 0x51dee322b151078c, 0xf115d1833faf9a2d, 0x250df8cdb7885225,
+	 0xb9e2675373bbf8b8, 0x849f3a88d4524efe, 0xb59f36b9968b0149, 0x4ed2eec10ae721a5,
+	 0x720422ec5e099c17, 0x89c5ead0024ca1cc, 0xe0df0523d6ee57ac, 0x479b5aedd344b104,
+	 0x6513c100daaa73f0, 0x8ba756cedf7e7245, 0xae2dda1395331887, 0x5f0e53fb97b6c746,
+	 0x18f9cdf55134091d, 0x102c8853ca4ac4c2, 0xda0eb376e63c2352, 0x5dd0ad707b8000e4,
+	 0x33099c3cd41d1056, 0x9feca99624e72c3c, 0xb7e697358fb89e39, 0xa95afd80f9e97a6f,
+	 0x2bb394c40027cff6, 0x7cf7f539400eee50, 0x897d5bf51677e8e5, 0x0b383c6d23a2c3b3,
+	 0x9bc6d6ed320e933d, 0xf3b339ccaee0eb37, 0x3ef84bcba533aa3f, 0x7ade9735b07a4b06,
+	 0xa3df27cd529e958c, 0x24eb4d6a36a01496, 0x6f5c13b680bafb16, 0x0e01470f40d7eadc,
+	 0xa0c9f1fd976ab584, 0x1a8c8c7584ff4b28, 0xf5b4482a8f4c1040, 0x663102c16319fa9b,
+	 0xb95a7ebc9d3e6523, 0x8a5780c5148af3a5, 0xf2d5311a1c3bdf1e, 0x794bd52858673530,
+	},
+	{
+	 0x6f190e9d50a3dec8, 0xd664ecea0527fdba, 0xe8d38311344f0d5d, 0xa368ba28e8b3d190,
+	 0x6532a27eddf9bb98, 0x8112b208f32fd7e6, 0xc8976cdbc0737413, 0x5c257e583c0e62c9,
+	 0x2c20ec67f63bd29c, 0x50bf75207d93bc08, 0x309817a49049533c, 0x3138c3ebe084c21c,
+	 0xafaec4781444c182, 0x5943e8cc33c012ec, 0x777c14a38da4659f, 0x92c62e711c0ad533,
+	 0xef4d7241929f44a8, 0x45312ee82469f69f, 0xbe90fa48e1dd6f38, 0x4343256effdbd7f4,
+	 0xf3313c707c264287, 0xeaa0e2584b610d99, 0xb001582768dfa966, 0x61c93d0f1b1b33af,
+	 0x89b6ced0ae2c6907, 0x61af5913b5e5fcb8, 0xd10d9b07ca43dff1, 0x514ded206f044b90,
+	 0x6d5cb67429c1edcb, 0xccad75521e3c9834, 0xf0e8438d3cc597c5, 0x0861a45d3bb3d3bf,
+	 0x7167b08bc8fb2517, 0xa8e8617f9fc34ec8, 0x4d9f498100e1f8d5, 0x9e79ccc5365f88cf,
+	 0xa52321a88b912f24, 0xc21b28096b1fb39d, 0x1c8307b57b75506f, 0x77aae5d88ac6df96,
+	 0x3f7f32cdd32082d8, 0x430aa5f75c30e6b7, 0x3672ec3ca84614cd, 0x406521c31b7d9632,
+	 0x75f583033d105e80, 0xe717985069f67316, 0xf442acfd923e4671, 0x30ca9fadca61480f,
+	 0x25a0766887582fe1, 0x00b95a1390291af8, 0xb583704b44575278, 0x1ccf9ef632644e3b,
+	 0x8fad19648a717c4e, 0x1b88cc0ce5cd4876, 0x1bf328239355b866, 0x2a32eea916776033,
+	 0x71a285ab4f074a20, 0xfe1a05c956aa79bb, 0xf24fd54b56adfeef, 0x5ef5a48837b5b069,
+	 0xed384da2716dc0c5, 0xb0bb818dead47f4c, 0x36e73308bd40a931, 0x13a0c38c89dd0770,
+	 0xd4e104c4717f3492, 0x0de59beb8eda7c38, 0x14104c2b29c29e09, 0x0cc780479f2bf98d,
+	 0x87d4df28ea2c8cb7, 0xc6b5dab69d317c67, 0xa30b0cd1ce8edf7e, 0x7ec9df5b688cf416,
+	 0xa1ea3715bf52efda, 0x7629b1e51fb80739, 0xa328056068c549c8, 0x10a5fbce4063063d,
+	 0x05498c4936ca4af9, 0xdc877b8954869564, 0xaecc74a8b815de7d, 0x27eb835197d51ed2,
+	 0x2606ad110e879b44, 0x5ba620e82696f668, 0xbc2aafb63b012dab, 0x71ca1886989b45c2,
+	 0xcf7abc5ea87d7ef9, 0xee5374e097451b08, 0xea3338cce73b62c1, 0x4396135ba6140fe6,
+	 0xdb8f78ab64e26fd8, 0x021a1123642d876e, 0x59117dc99bd8cf46, 0x07bd4021d07570a4,
+	 0x8439697199c43baa, 0x06b6a9d2a8d64589, 0x7c0baafc7982b3d7, 0x049ccf389e93be71,
+	 0xa4c73474c9a8bb9a, 0xba11ee33774d564f, 0x8a7271fe4c6fe208, 0x53dbc5f5717e739b,
+	 0x2f02ba67bcfcafcc, 0x98aafd6ede91b084, 0xd18362ab45da9542, 0x044c69e45f5b617e,
+	 0x034fc2c02b94f97a, 0x2041c66821a72322, 0x2a4f94ead724cc93, 0x94e79b771f86cc51,
+	 0x842322c4a5c3419e, 0x5481c87bad1b33c6, 0xecb8d4049f80d996, 0x08dafee3c37bed30,
+	 0xe2bb54213dad6baf, 0x052409e8b9459281, 0xf51771e8f5198a37, 0x69c3f8d97ff6106e,
+	 0xaf9dcfd6554c133c, 0xbd85f920d87848d6, 0x04b5002a7402b890, 0x296c8c0f38dd7d95,
+	 0x33685cd81b392302, 0xe76a4af2a81f1c12, 0xf3a4fed24a531a53, 0x314ce401ebcc82c7,
+	 0xe6d434c9f0f40c72, 0x74ff1fcfcb9a1bc8, 0xaba874d51b5735fc, 0x1e7751c949184e66,
+	 0x3cdc6c7c11b2486e, 0x507a7dafa6668d93, 0x097df5575e8071ae, 0x9052fdf2750516ad,
+	 0xe215b7bb2d509e95, 0xc9118d71eb16208c, 0x1f6b53c2753ba802, 0x03fade49f3ff2ddb,
+	 0xe3afb3509c79d37f, 0xf5ccb6fb4f0203df, 0x18dc3b6db2882c99, 0x7e2e9630dacb4021,
+	 0xbf22bce519c5542a, 0xfa46f9f8437b240b, 0x5a010f5ce7a4271a, 0x2405209228c7d5d9,
+	 0xc1b019af320eef52, 0x0663e76da1f5b694, 0x965842379345896c, 0x5dd3efec966c5bd2,
+	 0xb8c98f97f69be00e, 0xbd499bcfa069a06b, 0x83fa476c7b250f00, 0x5e6f9e4f89fd54f6,
+	 0xb6def27e4bb49106, 0x0b55a1db5a531ab7, 0x00e4f1e83077c4c0, 0x98a258616091fcc7,
+	 0x869c00a9915a9a8a, 0x75765931f4812a37, 0xb399e2b9e90e9445, 0x335448c110fe0205,
+	 0x03bd40fbe1b6a040, 0xba26d69e891329d3, 0xd824c0e0353b7e1e, 0x62f138ffe880ca0c,
+	 0x663c4e311c508b4d, 0xa08296d9e88b36cc, 0x78c93f4c1ec4892d, 0x2744981bb768e6c0,
+	 0x7505757abc3d952c, 0x51da0d94376693e1, 0xaee468ea7c9d97f8, 0x9abe13582a3d81ba,
+	 0x5ea43f1082d1a5b4, 0x19621255fbdac78d, 0x9e4232ec1f5e1170, 0x149d3ac19e9b8f9e,
+	 0x0429a64ef5f0034d, 0x55e5daa9124752c2, 0xd8cd3681f2324ce0, 0x8d0b7896c201a39f,
+	 0x3e9520663f0421bd, 0xa494317be054a281, 0x1a222029142aff86, 0x07de23a213c65c26,
+	 0xeb2b6fa9f38a3c50, 0x403ed1399b5a4c47, 0x5f0c822f25f910a1, 0x8dac2a5c48f73965,
+	 0x07fce07a993084bd, 0x87de407e7931f178, 0x11c79e6ebe0ce128, 0x793fcec9888f4f62,
+	 0xc6afd2b95aebdb78, 0x73dfaa155c2a854c, 0xe1b0d3fb6b68d356, 0x1abcafffa8833bee,
+	 0xdd8f22853ed95cea, 0x314f2d7b94e3f87e, 0x5867a5f64164a8b9, 0x81d6ddf55cc81bfe,
+	 0x3142eae35a5b1bd1, 0xf5c0895a3464ddd5, 0xeef79e093416aa3b, 0xa444329cfbc1d0c2,
+	 0xb449ea2b2bde063c, 0xacb1f9d00bd31502, 0x3568ab4c07a04fb8, 0x97dd262387f3e09d,
+	 0x2afb1238b40f97f1, 0x3cbc455549505653, 0x5025e44eee9d18d5, 0xae00fb20f9e7919b,
+	 0x1377fd0583c0b9ec, 0xc14dafcec9c232ee, 0x399b731aa6e7b3cd, 0x2846aac3add283e8,
+	 0x0c6f7e02e0d37306, 0x48418afd3a02fc18, 0x0a32b18f306142bf, 0x12542e841ff3abbd,
+	 0x3285f538eaf41455, 0x12fbbaac1de08b66, 0x0dc54f95aef64ee0, 0xaf157bac9c8409fa,
+	 0x16ee1d0a41d7f65f, 0x37e07b6f0c677f7e, 0x221f62f631f48f57, 0x39b1a7982da6bcd9,
+	 0xf9019499a3927e43, 0x1fa6adf5d27ee219, 0xf64708e9bb75a3e2, 0x587871bea5d458e8,
+	 0x9cb2df7e77b56fa7, 0xfe71820d3690b834, 0x18c324d1371b21ed, 0x0e933ebf03d3b1c5,
+	 0xd2d48c9caff57247, 0x8abda1ee9037510f, 0xabd75afaa405f275, 0x519c276c9e520fad,
+	 0x3fae50fcd61fb4e2, 0xdaa4953e3b0fd899, 0x55199899d32ccfeb, 0x5f0c41c4c6627f37,
+	 0x2115e850ba6dbdc2, 0x11273feba8644d06, 0xc9de1dba837e98bd, 0x8f82c46fbca81d46,
+	 0xf7b16ff3c21a1bae, 0xa8e97d485339b3ca, 0xc9de325f25fbf276, 0x58c3d9cbdd6b30b7,
+	 0x160e5bfdb96631ec, 0x6ea48e7c880ba490, 0x67f218b9b6730415, 0x8d536f979e3333f5,
+	 0xadb9f054d0b83aeb, 0xe9d6afc7455f1f7a, 0x2a56e5f1679ad6df, 0x1f21d590a2bc6890,
+	 0x28e5e2ecc3d6cfde, 0x08ad4407028de329, 0x7dcedb560420a461, 0x345611299168c7b5,
+	 0x35cf3fa8a5b3a34a, 0xdfdf0a848e00d5cb, 0x319294af59e6f20e, 0x6d8507aa8310d4d8,
+	 0xf504bce08474f5eb, 0x2e46a194cdaa450b, 0x97e717393c5823cd, 0xb52fc97be07b990f,
+	 0xcfbc58432887ae7d, 0xa1e3b3f3807766be, 0x19d7b1980457a53b, 0x4529e9e20e265d03,
+	 0xbd3ff30f612d89d8, 0x4d94b342b798bdc0, 0xd9cbd82316f51d72, 0x176e0dce12eafb41,
+	 0x94550974b4acc52f, 0x80b8d6c6bf12f585, 0xff70aac1380ed10b, 0x197a27af2d5bbb62,
+	 0x6eafaa026d3312b7, 0x8243a67c722acf1b, 0x3a2ff1f18751281f, 0xb6134cc86faa12d0,
+	 0x024e6f8314406392, 0x878c0fa6af17d4ab, 0x47cecc128171a422, 0x88c0af680b546e2b,
+	 0xcb61646641bbe825, 0x47cacb2520a525ac, 0xaa1e2b61ebecb103, 0x78b0bacb2abd27a2,
+	 0x32bfb672c7840622, 0x4e038bebad03afa1, 0x84c66e53863903a7, 0x0378161d4158a3f8,
+	 0x94a21b0e1fa6c061, 0x396ad7f8badd05b6, 0xca8ddf0f1dce2682, 0xa1a5aed9693134a9,
+	 0xc4676ceedcde95ab, 0xc9ba49b0b2c3b294, 0xfb73430e3e0c4e98, 0x31e6968cc7ef2045,
+	 0x8f7f7a9aa06a7512, 0xd629289a3e124fae, 0x1d8e3b14fac6ec44, 0x2d220abf12204784,
+	 0x8e54c80132aaf46b, 0x95cda8a690289e0b, 0xde42cebd34800e69, 0x905093d1367ef212,
+	 0x5d781966c88c8b10, 0xb6e3e2ff1bcc5434, 0x15ef0d6bb5a25655, 0x22f651f365c59775,
+	 0x9b639a1e285873ae, 0x6961aae13da63f68, 0x410b4b0e4b7307cb, 0x2d003c798c835d72,
+	 0xe5de285ab65529a8, 0xa22dd190ec4f85e1, 0xab975d3aa594174c, 0x5a1edb1c58d19b3c,
+	 0x12e44f3992a46667, 0xcfb00d87bb696981, 0x47cee40ee630875e, 0xa9676ea74f7ee27b,
+	 0xeae07c7d28ce088c, 0xbd51542d37886b67, 0xcfa75dfe1768b273, 0x65ffe82a1e4751e2,
+	 0x89edc286437c1277, 0x33a10868575da4ea, 0x70f25862336ffa2d, 0x8a5899d9818d2bc7,
+	 0x58c6848e01ab48a7, 0x4cd1132740022d36, 0x7181109ee587fc81, 0x4be31e12aae021e0,
+	 0x742982db80db08d6, 0xef4e2f6247bd180a, 0xebb01b8bdd59d856, 0x2c1c1cb58e3d61b6,
+	 0x6f0c33f09a2bf303, 0xbb4ff2766f4ad3c1, 0xd1cf795107bd8da9, 0x5d6d1c6cd66e2f4e,
+	 0x52ccc185a98bab7b, 0xc9b41ff62d6c1294, 0xf6a27d31ce034954, 0x8631ed9cc314bd6e,
+	 0x2cb8bc7282ec5192, 0xcc188a8e08bc5e79, 0x1fad17d80b73ed42, 0x092742a9d033eb7f,
+	 0x73f1dc46ca81d0bc, 0xe8a56e0c8ace20aa, 0x1029498228555def, 0xa7fe4e383ae580e9,
+	 0xbd00d3e5a4d0ddc6, 0xa01e00ec63174e70, 0x89b22d75e77472a2, 0x21045c0f58ecd4e3,
+	 0xdbb21f34ab749e13, 0xb4c1800b871298a1, 0xfdf006b0efff5330, 0x46ae9bb2c6ff7ecf,
+	 0xa0c92669504e7bbd, 0xbe95e18be96907db, 0x55c0d12f25bc5983, 0xa71fc9fb46a7fdf8,
+	 0xa44e52921bd73e3f, 0x48ea14e02f0e1635, 0x67c6bc5482b0edf3, 0x342614d74c50fc9d,
+	 0x7cb9a0f14ac867fc, 0x92c3b9dae8fe39ec, 0x42947f23fe9e305b, 0x75ed15dbfe3d60f6,
+	 0xdcc4fd4279de92fe, 0xaf741823c35e9e5c, 0x52ae77ed789ee0bf, 0x65b3a6353a2b5056,
+	 0xca8a65bca59515b3, 0xc1a7bf8aec3385f2, 0xe26d8e5027334530, 0x05679ad2eede606e,
+	 0xc73549db4fd1fa53, 0x3abe834145cc6941, 0xd56df5570cb7c024, 0x8c215e2b97ab5a1a,
+	 0x97dda7de27affe48, 0xf4b6fb07192382af, 0xa533119767ae8c28, 0x9a923ee5090ab433,
+	 0x6265896d7587bf5b, 0xe2baa6a5c6a09190, 0x38f0525b00fe3891, 0x4812f90e1273b651,
+	 0x11fae1c27a7f1039, 0xe695f36177571dd6, 0x66214be2b5c42253, 0x676abc4b32c7b4ed,
+	 0xcc6f2c329396e033, 0xe67c9282295fd960, 0x5cd7a9ded58555f9, 0x6b9b98ed0e96519f,
+	 0xd8eab7ed2ee22823, 0xb59f9aa5e607441f, 0xe26b4b988c5610b7, 0x369aaa317e67dbb7,
+	 0xd84472c61870cf7a, 0x41986366010961e3, 0x2be18bd636016219, 0x51a1f6e9629e32bf,
+	 0x9f1a0487132866d8, 0x43f771880a97a1a8, 0x3a65926e2e0584a3, 0x2d7ea973dc86347c,
+	 0x04a4519b8bef1462, 0xdf050e62fa80d752, 0xec53f257720967cc, 0x8cc18ff509a987fb,
+	 0x306435e7f37c30a7, 0x6ca30f2f3d7fee21, 0x82fbe79deff37c53, 0x7b071e307ec6be0c,
+	 0x03d2a14d8414fe98, 0x5cb7193db67b46bb, 0x985f9653e78a7b85, 0x5d1c534b0cfa28c5,
+	 0x7f4ddcd7eed26407, 0x7d8b19e8b4052610, 0x7bc17cb3066eefc0, 0x1688a9232cd2af33,
+	 0xd426ced96debc0e8, 0x9590fc973f2674bc, 0xaaa2416eae38dcb2, 0x9616b7eb0938351b,
+	 0x7dcfb9c503b3ca47, 0xe837c2eb1d8acc61, 0xa3aef612aed023b0, 0x470647c644b364ac,
+	 0x00a06b2769418049, 0xdafa526661c35475, 0xa6cee66a7f7c08bc, 0x1088bc89e8efe8bb,
+	 0x7aad2edfdf26f14a, 0x3e8bba731c10e505, 0x7efbed05964efc48, 0x814ab7f698495725,
+	 0x0e8944ae5c7d6835, 0x72d490c702ca8046, 0x784357ca84940cae, 0x7c3af5438300e905,
+	 0xbfc56f73d0e2d6ed, 0xe47923ea1c96cf6d, 0xe51d517213d1b248, 0xa11d3bacd2b865e1,
+	 0x1d03b20a5cb0a499, 0x1528ec946840a550, 0x20248a058433d8dc, 0x27f7ca4f82324187,
+	 0xb7a6fd6351127d21, 0x261667f1b01cb36b, 0xde1d52e3e3d87d86, 0x67f63efa4a2392e3,
+	 0x1cc051f603038837, 0xb8288bf4da58f763, 0x76d8d537d98caedd, 0x9ee90fdcbf08bb94,
+	 0x91bafdcf6e395aae, 0x2b65f01178d8eea7, 0xad4303eb61b202f9, 0x5c07ca249b1e8aac,
+	 0xc5354d31c25dcd0e, 0xc4cbf2c57383d4dc, 0x93e57d432f34acc2, 0x5a3ee913c1feba06,
+	 0x3ade3c28359380be, 0x9ac1eadbb538349b, 0x9393be080c6f1c01, 0x23a2672efffaabe6,
+	 0xe0d3017b1fdfb511, 0x412afb2999c256bc, 0xf5f888c976d2f717, 0x8762c00d8034c667,
+	 0xeabc93dd4418ee43, 0x6bbbde11fe85ac77, 0x573ccdcfe67627ee, 0x07281683ea575d97,
+	 0x7dfb60d5b425df1b, 0x30958c7491fe92bd, 0xc9fece1cd4131fca, 0xa1ba38c1310e9c4b,
+	 0xfe50d470ce437dc1, 0xba77c4fa9cc639bd, 0x9f920270c94f15bd, 0xaf42e920daf4c5a5,
+	 0x1df8515afab5a156, 0x634ac4c7d695cdad, 0x0cc4d14547dccc09, 0x1bb9c21ee9b1d69c,
+	 0xcb57886f3eb2dfa2, 0xd68ad7419d3103c1, 0xe196d94057ce7a6f, 0xae9669cdb2d43f09,
+	 0xcf77a20dddd4f066, 0x60f0c0033fd1efb6, 0xd4adf159b139f807, 0x98fefc5f9adacc14,
+	 0xc93b2c56bce86e79, 0xa7aa1b8ce870b181, 0x0c6c1b36d25b9832, 0x4cd01584399e3e69,
+	 0xfc279740ab485bed, 0x81391c88190a69de, 0xf9b5cdccde99f5f1, 0x7fac6d727467f687,
+	 0x23b62208237dd6e5, 0xfbda71a2251b74de, 0x2687e9abcb9adaf0, 0x5f77a72f2f999700,
+	 0xc1c76c511b29e309, 0x4d984053c35a2efc, 0xabf38a4f2dfac5a0, 0x35a1fddccfe0ec65,
+	 0x9fdc990ecb2743be, 0x7fc89c84c4729681, 0x0a7d1c2fed1a73cd, 0x9a6675540292398d,
+	 0x0d9a2de629db3a43, 0x52807b9df76de195, 0x8740336d310ae0a1, 0x1942b152a9d4fd20,
+	 0xe0e6cd3071ab2fae, 0xc5d23ab0d604e536, 0xb23daeac26dc79ae, 0x8ff6ffe5b10fb9ad,
+	 0x1a865a231b830519, 0xaa1ad4f88204b427, 0x8df47c3eb551d81c, 0x77b722da68656f3b,
+	 0xb7e6554fcd7a5098, 0x1752a8affcfd3898, 0xed4f6e3c78427598, 0x891e11ae0bbf775e,
+	 0xa6c2259c11fb0932, 0xba5b1ce2e60378e8, 0xeac2affeb2112378, 0x6589afe3a6e6b4c2,
+	 0xddfa52b2de21a3f6, 0x692e04923d4d8a64, 0x39d03d0a48fb8e80, 0x7b313d12761a704e,
+	 0x25484c54129361fb, 0x084c8b73c495b2fa, 0x13bc695ab3d21892, 0x6d5a1d0b3c4ba2e1,
+	 0xff2c8bf131a2c445, 0xc515faaa963a8246, 0x1adf043f03183088, 0x9ad1a50c3177f3a2,
+	 0x1d01de4f4526d2f6, 0x233e6249761a9cd3, 0x62b807e0d67289f1, 0x8c0e3b56686f0987,
+	 0xe864627937b12fcf, 0x0c1e487521473372, 0x20b8039a0e1a2fb4, 0x4de6ad0940e78f4e,
+	 0x7b7c246c3fd1f8fd, 0xc6048c1fec2eef17, 0xb1d23f6097b88ba0, 0x61ebbc59d229798c,
+	 0xb703b24e7f1e8d25, 0xed0f808844c5b9cc, 0x2342ad494c375d6b, 0x93433658aec1e689,
+	 0x5eefc1443bdc6670, 0x93981035c525590a, 0x3fe68228b3389d86, 0x50abb33cd1d6b87d,
+	 0x6d8666ba1e03a317, 0x5962b3ad884db4a5, 0x39a38bc0e01e51ff, 0x8fd7067bb235b6cb,
+	 0xd02b84db3020a3b6, 0x78e6aaf87ea6b3bd, 0xcb508ff19bed801f, 0xb5c2b60065e008e5,
+	 0x343a9a4d99e71937, 0xe92a377f4bb7948d, 0xdd35df732a5c704a, 0x9893339f6245f329,
+	 0x36661978efe23996, 0x97ae941488d36528, 0xfbc28d6cfbacce12, 0x4908423df76d4c1e,
+	 0x1a18fe390de9c7cc, 0x7412d926ec6da648, 0xd72b6cacfdf415f6, 0x348986c6666c8392,
+	 0xaae4e52f119e335f, 0x52ab8ce375d51065, 0x7d06984c58880534, 0x18bec770f8762094,
+	 0x9aebf9fbec23f38a, 0x353df53db058c134, 0x08b8a08a99122a54, 0x73af90037eb69ca4,
+	 0x0682879f3a212644, 0x3279dbbdd5d7d80e, 0x85c5aa5481a25e33, 0x7ac29f860af1c138,
+	 0x8a19e2e02bfc8f66, 0x7e456eb710ca791b, 0x9c8cb341e8e7ae61, 0xa194b7432a62696b,
+	 0x66c29ecb33d8c2d6, 0xad764ef5dee2ede5, 0xda9d977e5b5f7776, 0x1eec572151d43170,
+	 0x6fb6a37961b3de27, 0x20264b924e077736, 0x7493afd2f48a5341, 0x4ec7a8ff59659076,
+	 0x9b0d15f5148b8474, 0xe6608ba574c13603, 0x1a44e9ce99ff9a97, 0x20338569e31c0c5d,
+	 0xc239606e96a3d9d7, 0xb2171d4701a12e8d, 0xad18ad8058bb87c7, 0x7d96e8fa13bd76f0,
+	 0x3764071507c86c00, 0x183093947ba7b4db, 0xc0b89e0081f3ae15, 0x1b4edd1a3c30f167,
+	 0x9fed331e43d6cc95, 0xc982c3c7eff8066b, 0xa5bcadba6ce6d721, 0xa69924b879d7f15f,
+	 0xa5a87670448a17f5, 0xdb69fcf4a80e6b34, 0x62c723dcea176375, 0x82bd05fef7cf966d,
+	 0xa8f77b2e6855d414, 0x0d65af6b7bf69d6f, 0x13c68e89d543f445, 0xa7be7f28daacd9d0,
+	 0x8a40a63020c7172b, 0x1d1c48ad8c83a4c6, 0x387ef0cb63ee3db5, 0x19e4fc0364c86ee2,
+	 0x6af199b1d864ec19, 0xe8f6a20169d0e283, 0x70f8ce7a175f37e9, 0xaf019e21decebff4,
+	 0x08ca4fefbc74cc6f, 0x4c7a861d2b7c62ae, 0xd2383fb6f12fbd62, 0x849b4c49c9dc110f,
+	 0xb0cf4aa8f7986dba, 0x9d238f8b0feabb46, 0xe7f571e2e7a03b25, 0x042f1e1030151162,
+	 0xb764b4c7fae900ce, 0x028acdfbbc0e7f29, 0xcd3aaf9e8b1e8bf3, 0x048bbe486466a185,
+	 0xa0a081d18b70f9e6, 0xebe5eef3e01b7e9f, 0x9869f66c2aaec5f5, 0x1f1d3d484c2e0bef,
+	 0xe5db78f471eca51c, 0x96bdddab1bafeb0e, 0x28c0499fb92135cb, 0x6e5cb04ab3f37109,
+	 0xf3259aab3f427054, 0x5ca82971b56b273b, 0x1c2c73281b650c06, 0x1092af3dcf4bb738,
+	 0x561e7402b485eebf, 0xfb1606ad10206306, 0x85f94a0b0557505e, 0xae862cba8af72fd7,
+	 0x16a453c7023f3ee3, 0xd89790353f5ec04c, 0xdd1b8ff56a9d5d55, 0x94cce07139b25087,
+	 0x50e3f63938b63cd1, 0x0955ef2712201fcd, 0xe8182d920a47776d, 0x6ad12a0eba779755,
+	 0xfbce13566b2b995b, 0xe3ecc7829d307e33, 0xa20187cc96f01cf9, 0x20ac37e4cb61d8d4,
+	 0xd0fec58ed3014b12, 0xc77e7a44852f68f4, 0x08ec8805d7456410, 0x820facdcf6e65829,
+	 0xf9acbf9e5437b654, 0x325f5fb36ea111dc, 0x9dc62a236917a1e9, 0x386901cfe96f9633,
+	 0x4099e5046c61b0ec, 0x1ea64e2762f39a2d, 0xd90d8d7967ce2513, 0x110d21128c656561,
+	 0xdf26488b09097bdc, 0x8e995330e9e2ef7a, 0xf39525396dc0bab0, 0x1a2a5d0164f4fcd5,
+	 0x0a90233644d741b0, 0x30111723d8f63a24, 0x8992962d09733250, 0x604904c56e618e82,
+	 0xb1ac6b624cf0e421, 0x0dae4feb1d132874, 0x46a2ee525c9e3a6b, 0x7fc45b313a3373d1,
+	 0x3bbadb3b33acef4c, 0x7ca75423095e7e68, 0xc78f32dc1e81ee32, 0x1aee4a64ed8f494b,
+	 0xe403696591813cd1, 0x4bc3fc3a18e9d8e6, 0x6b4b8030ded848a2, 0x4afe9ea2670dd7db,
+	 0xd855d552a7bea748, 0x01a084ea85d74fba, 0xb6bea1b3797251ed, 0xa07efe47ab35e8c6,
+	 0x57428cd755364d12, 0x1b10328d6d35eb13, 0x2e3fa9f81771f774, 0x9c09f3a11e5f41e3,
+	 0x935257c53fd9244c, 0xbeab6cf350b7edd9, 0x2e9a257a04c35a29, 0x593575ec525e444f,
+	 0x546490bd99d80940, 0x4c9ffbb91067c5e7, 0x31e2b6c84898a911, 0x3b181f86a6cf9268,
+	 0x5fecc537466456e1, 0xa9d92690ace387ae, 0x67d270f5d24c172e, 0x1b12b93111fbb139,
+	 0xa36828ed3b5f4a72, 0x825b14ee80610097, 0x8af649db94e3feab, 0x2d88731b20c6b7c8,
+	 0xac929f12c1630c46, 0x703a48fd57695795, 0xa3ab4bda01e4abf1, 0x6b99a490bf5dbff0,
+	 0xf31aa3960ab41788, 0xe8f4b10b352653e7, 0x40c33d32cbb287ac, 0xa6fe597e1ed49de4,
+	 0x53c57828e9618165, 0x219838f0f34031d1, 0x00acee90b945a69c, 0x1993a7bf4fba4c4e,
+	 0x08bfc6aee90e4137, 0x356b29c7d92f2af4, 0xeeeb059a472acbe8, 0x6aa6449b497b4cdf,
+	 0xb36184a52e10f62d, 0xe14929828ba1b21e, 0xadfe64df69d77104, 0x7e8031f8fb210c85,
+	 0x8a9f5dcbe377493b, 0x8da782c5f0fb341c, 0x7e87dcce03e4e6f2, 0xa71ea5a67b482bf5,
+	 0x0cc91f6d38dd7d2b, 0xf290cff4990f6ecc, 0xcbde1cbcd9f45785, 0x9b5dc6c792dbf11b,
+	 0x3b65533f18318c50, 0xa81c4247ecf4d5b9, 0x40aad5b5a806cfe8, 0x21ec1afeb54221dc,
+	 0x466b00bcf924712a, 0x36236baf20548247, 0xb604a1ac1a822155, 0x77a6a27b2c0b0c41,
+	 0xf54540a474c652b4, 0x34472eebeb2aa115, 0x4ec39f543d0840df, 0x6dccde8807fdfe39,
+	 0x8e061a29a79b5501, 0x24dfb1b771b5d8cd, 0xe707779e54dca23a, 0x5e95f8762fe2ac35,
+	 0x5f00c3dab0d80c64, 0x72ab7e42ee504c33, 0x434269a5de035168, 0x9e68cbb4745e6dcb,
+	 0x1cb51287559c6391, 0xe1b969188f13a38e, 0x58023fbd7d66b7e4, 0x8089c6e9ce447ed1,
+	 0x4d018e1468962ac5, 0x6d801c78fd4e74e0, 0xb5bc5626ce5ee656, 0x81e289cdab4a7802,
+	 0xf3623c3ce032275f, 0x1d75eb88d19b1b6a, 0x54ff040a6461e018, 0x8d84b59c30f88c37,
+	 0x67d28f00d29f861b, 0xc29ff2f3a007caed, 0x76466e79441cfcf7, 0x6ef2f71c84fedc55,
+	 0xe05bc1d1876d941f, 0xce040c884a1da1d7, 0xbc4ac4794c77a257, 0xa869d586da77aa53,
+	 0x23eab467431f4c22, 0xe1163a6f1ab52a08, 0xb8af1c331e51852d, 0x99bbea42138e97a9,
+	 0x34835c183c03a922, 0x16680f039197cd9f, 0xa2419a86b8520a63, 0x423de7fb13f785fb,
+	 0x1956a53d496350ae, 0x63fbd433d98d46cc, 0x6ad39c9801634c07, 0xa9f8ac1d3c49f3d8,
+	 0xf0ebc05044650df8, 0x9d1c53d2efbc7ad3, 0x2a8e9f68c640bd59, 0x44b7bf7cef461729,
+	 0x9af4d71dfcf7e9aa, 0x7303b98b2bdf4e38, 0x166075644d57c957, 0x624f4d2e1613e7a9,
+	 0x153efaa7d539f8ec, 0x6811b87df99bf3ba, 0x9002afeaeb077bcc, 0x5d8a525e7fe6f1a2,
+	 0xa167363c0c6d2caa, 0x59e962a8f8d00a63, 0xb2f694266e2abcfa, 0x786b16af113de10d,
+	 0xec7176f8efe71df7, 0x851d78b83796c2ab, 0x5330d9c6d6acdf03, 0x3b42ad50efe12cea,
+	 0xb8d3d7a13867ec2d, 0xfa9906437f29eb31, 0xb216a9ff62fd19ee, 0x1ca489d04acf80a5,
+	 0x24a8950dca6c13ae, 0x00262df6e6fd07f1, 0x4c05a5497d5cca43, 0x488796a6f9438eb5,
+	 0x87c65666a3f455c8, 0xf8b75e4ec1d5916c, 0x0f84db01191663cb, 0x91440d1e4ad09284,
+	 0xac0208f496bb28d8, 0x7c5a5c82c91a421f, 0x7a0aaa96bd99c2ff, 0x8c2e8df7fa500a62,
+	 0xb60a79e20975e641, 0xdc106a3e9fbdaf75, 0xdf9d2cf1eee97385, 0x59d9d71e123d3989,
+	 0x6d7c9575b466830d, 0x06ac9f65b2ef2c47, 0x11e2f5da1dc79355, 0x125caa2420d7cc05,
+	 0x308e4f8128828202, 0x54d934e2f092f251, 0x42d8023dddde90aa, 0x6f86791838102e91,
+	 0x3c550a7a7e556b4c, 0xa7ba3adda00fb9b2, 0x13ef63b54d33a269, 0x443e8176730deb58,
+	 0xa43f6f801b3302ec, 0xe8b25e1c81f29b79, 0xa721c51775041bbb, 0x82d0b5c71f6d4f8f,
+	 0xc8d96b9198312dd0, 0x990e705cfd7b6849, 0x60cbca6f13b3ee60, 0x0df8caa8cc6f0619,
+	 0x6b7270dd922e5b86, 0x87852b37da701069, 0xac0f3f6c5ed565e7, 0x80e7da9990da5884,
+	 0x373654fbde0d426c, 0xa755ccf0824b9680, 0x1a5b96d7ea68ba7a, 0x45f1406149953c2b,
+	 0xe5f99476f7da384d, 0xe7c45df6bbab0ceb, 0x427118156f129db3, 0x1ac15254168a8360,
+	 0x168fd1302ca88a30, 0x54af71dc52cb88e6, 0x42e67e4348952233, 0x6d11622198f41303,
+	 0xd17f5a24f805ae59, 0x5847bddae8a0a91e, 0x4796304e11afc64b, 0x852ce635b60b0d33,
+	 0xaec3c30cdfd17660, 0xf89ec651b3976d26, 0x5480419247c0bea9, 0xaab27eb0e0fb14df,
+	 0x7cc70cc4ea35282d, 0x63455857882c5adb, 0xc6726d8010d12f28, 0x4686d4e342be7a4b,
+	 0x71fbad33638b8c25, 0x56ead3afe5176469, 0xbcdcc2ac63190a08, 0x5aa4671dbf0be8ef,
+	 0xbf08a276bdfc89b7, 0x60d88eeef27fe4b7, 0x106d56b94e3f91a8, 0x95ab4e4e23b5ea42,
+	 0x0de57da6b33ba2aa, 0xb6ceefb3dbd072e3, 0x95c8a8130986467d, 0x2b2e7c81e6b17f91,
+	 0x4c2bd74cfe45106c, 0xb302650dc9eba682, 0xf224a6fef8a12b27, 0x51c08316ae6682a5,
+	 0xf8af4c48ecf2f8c6, 0x1a7995c3e78a7fda, 0x04fc2b49a9bcdab3, 0x8fac788c6b1961ba,
+	 0x152d8d088f6a3cc2, 0x493044ec0c30781e, 0xaf8b2867eb30bdd8, 0x80b62b6fe9726891,
+	 0x26f29bc62a0ba4d7, 0x194da15ec6ac1db1, 0x2fe1a1ddc34baada, 0x2bbcef4214773116,
+	 0x1ba8aa37546931e8, 0x66c31f3114a0c545, 0x12b133a1e16db0c3, 0x11d177cacc1edf62,
+	 0x6a1651117effb88e, 0x9ecfd7d89f6f2746, 0x4b33b689dba96587, 0x06fef69bc4982fa3,
+	 0xfe2167de87032020, 0x76ff4498a0047376, 0xf9e1cbe567332db9, 0x8e25078155a7f728,
+	 0xc6503962d6e00e96, 0x97e73589c1dd6abc, 0xe4c5c8f71110c440, 0x89144b6b25287f26,
+	 0xa37f14b07ff8b715, 0xac5604d9b508ccc3, 0x330dfea236003404, 0x7a0161da9edec4c5,
+	 0xacf2320a9288074b, 0x7e566acfe4f82283, 0xec27ddf40de36ea9, 0x1d2322fe7972dd36,
+	 0x32adcf6d02faa3ac, 0xfb06629e2005878a, 0x5f812a948f1bcb8d, 0x0e0da85e597edd94,
+	 0x733cf4468eb89b7a, 0x20e1430d74d40627, 0x704dc07686e8362d, 0x0e41e6a5d81f5b0a,
+	 0xe859fa8973e8f990, 0x9371b9fa66b3b479, 0xf50209bb2e55bfd3, 0x85f4e832b590877e,
+	 0x2a909627e4bc89c4, 0x22e169cb7a35d2ce, 0x8a0eb2195574b134, 0x10d5e9fdfefdec76,
+	 0x8cf863b06a1371fe, 0x8ed76e5073072e9a, 0x9be65c86446dd803, 0x5efb7b9eea1c7031,
+	 0x711bd11d7a786564, 0xc3b2e59b705b4bc6, 0x27bbedda9e7bdb25, 0x0b295dee98351452,
+	 0xf3d3b1b6bd0c781f, 0xd68819e2b5411d5e, 0x9aed3985503af6a6, 0x07d38e57cbe65af0,
+	 0xc0116101798f7270, 0x21bd7df2af3bb560, 0xac6ed5083abb2b9d, 0x45b47b7fbcf1b646,
+	 0x703be1c4f0e98eaf, 0x9bcf709acf0aa456, 0xc34c4ad37486bd37, 0xb5cf7e47068bbc00,
+	 0x98d615f5affa60d4, 0x0fa0189822baa718, 0x2c97b7811728bf06, 0x67f4a1f668cd13a6,
+	 0xd4c31b0b994b7467, 0x963f00573ad962ae, 0x494210c9d804153a, 0xaa4f289352f081b1,
+	},
+	{
+	 0x5dad87734a4b9364, 0xe223addd19a02658, 0x3fe18a5c5c703569, 0x70cd2dcce4b2c564,
+	 0xaf358c677165c0cd, 0x537f89b3ed6076c4, 0xc223f3d2424e13e1, 0x11fcade7d33419f3,
+	 0x6ce46e5d20e16bb8, 0x2fa3f27b821c5110, 0xe61c9e841dba9295, 0x83167e51516f6430,
+	 0x3a809e80372e3dbf, 0x1a3e83dcb3e722c2, 0x70ef2455e232dd5e, 0xb40de1db8fac78db,
+	 0x7144d7093c42e70e, 0x3d12f43a429f5a76, 0x2e093e13f716f3a4, 0x6d267c689900cd51,
+	 0x0067332d59b556a2, 0x86bb98e335889b80, 0x8738254859fc5cff, 0xa82302626a4dd849,
+	 0xa42132eb792d080f, 0x3dc6bcc0f0a890b3, 0xcc227cc7d5d56f8a, 0x3ac3da21473d2d6e,
+	 0x224032da3e5ca835, 0x805cb614cb800952, 0xa8eaf1bf1d9a113d, 0x7a01b0ffa5ddc143,
+	 0x08c47ed55ded89d2, 0xf1d3e966c5282d9b, 0xc7ceacad5b2fe205, 0x13b618d32ccc1fde,
+	 0xbdc6842488cb9a84, 0x54e3d2114998a77d, 0x3e6f64f1e95b2fd4, 0x06f61741377657f6,
+	 0x88891ee170d659b7, 0xd756b4fdc44b480e, 0xb52b54f8675f3057, 0x0728c71da5996d7c,
+	 0x696fd22740c06d98, 0x1f4d2d137362cb73, 0xe33722e356b96755, 0xa118f6ff82a5b7ae,
+	 0xb46403c78001018f, 0x6c7af39534aefb5f, 0x50c29339684d929c, 0xa160b0b1e120378a,
+	 0x820cd8c18101b31f, 0x1f9faf64253f8bbb, 0x576177683d9bdff2, 0x082bc596b834a5fe,
+	 0x9aafefeeb63c0121, 0xc99e4205031ad138, 0xa068c549126ebe23, 0xa4f6a727b6b53939,
+	 0x934584e6a6e919a7, 0x1c80e4468d4cb8c2, 0x43710f0a63cc97b5, 0x25fc64d948ef042a,
+	 0xce4f106d053fa933, 0xd6913b4666e3857d, 0xdc56cd08e07948be, 0xa94f995f35038e72,
+	 0x839a75f38b71fd80, 0x89a549d93b72bc7b, 0xc7bc86170ed506f0, 0xaa320415043a6113,
+	 0xea170cd0aac4e77e, 0x055444b13c92740a, 0xb85380616e2e2917, 0x01b78f44c1594692,
+	 0x51676b6924f9852e, 0x8cf29b511b3dd561, 0x25418cf9f708d41b, 0x4449d72603635bf4,
+	 0xafb73642e7968147, 0x6fa022c46ba15c1d, 0x5e38459dfcb40ca5, 0x0f4c6dd724f8c08f,
+	 0x521302238f93bbcc, 0x3f96cc6138a050ad, 0x432f65d2422836a6, 0x67a8164375e8d068,
+	 0x1a5654929ee62cea, 0x97036cc8f8a8165b, 0xdc91d55f1433dca9, 0x5ead2a0163e0fbb5,
+	 0x6a7f5080f5f3811d, 0x1ce6491dd7b03220, 0x6da60e8558515cf7, 0x2ab095d65d4883f3,
+	 0xdb51c4d569ad6fa0, 0xc92498a92458d241, 0x589d8b39c2d338b6, 0x9c310134b18a9c3b,
+	 0x2e14e43c521666ed, 0x89042e90efed9232, 0xe74d874b1f1de665, 0x114b852cd84365fa,
+	 0x9332bbe2378248da, 0x7cd66508046b1f9e, 0xfee1370254e00164, 0x8a103ea421d52666,
+	 0x3c2ec2fea52d812e, 0xddf036030cf989aa, 0xe43b22d628c66ad8, 0x1052ff7b8db0f919,
+	 0x650b2460b863531b, 0x04453be24cd86cd6, 0x4dde7ab74bac48cf, 0x7d05ada4c0eb345c,
+	 0x8aa6885acf9b9ad5, 0xda48db1985e3327c, 0x315914e2b103528b, 0x0aadf339e39ee0f1,
+	 0xae4102981caf9524, 0x1ba8154a93863048, 0xa245c5ce0e2277e4, 0xa21d952a24d010cb,
+	 0x639301c46568790c, 0x4aac1cc90b558def, 0x7a03553743f81ee1, 0x4b84d4ce3d3ef045,
+	 0x6c654a053a5668a7, 0xd1020339ecc5109c, 0x8b279c7972bd6b10, 0x14033f354d8cd61d,
+	 0x26e100723aa7f9a1, 0xbdcee261864bff79, 0xbf7a407350a14143, 0x6fa2d5d14e2d3edb,
+	 0x9852f479115bba2c, 0xff973d1a0c4e7ec2, 0x5d31729e5315492d, 0x6c5dec08fe9911cc,
+	 0x6c644543c44e1061, 0x7053c72776114d04, 0xeb883f7e83cd0798, 0x9bd0299b1782deb9,
+	 0x40207b5221abdee4, 0xc04096bede98f2b3, 0xbed7a53accfc0f09, 0x103ba24e24e325c6,
+	 0x844468c14e724ac6, 0xd6e279ab7f9ff69a, 0x111b0f83b1345d45, 0x5ddf9bc49df03c5b,
+	 0x91976a7a728511ca, 0x73090e319a43bc03, 0xb8824709cfec921c, 0x1ced48f3e05291e3,
+	 0x2e3c73c95eda371c, 0x9ba5cc1c160e672e, 0xf29e55001bd70799, 0x5d06633de4edbf9b,
+	 0x11301eecab647860, 0x234e2cdaa3400fad, 0xe23b1f8530689a61, 0x986eb77aaaac6e4f,
+	 0xa639f4084a2b7db8, 0x260ac84349f03e4b, 0xade50027abf2391c, 0x9a860f8fa1245ae1,
+	 0x95c09b1fa8a3c4e9, 0x581ee8502dc90517, 0x311da6ebebe77da8, 0x024012a42d3e0d43,
+	 0x9b279eaffbad9843, 0x7f50c685c1eb060f, 0xab817a47f9291c17, 0x61cab6462c93ce8b,
+	 0x66e13ccdb08fb394, 0xa5de0d08d9a977a0, 0xf1e763e0519994e5, 0x499350f8a5e6f720,
+	 0x681f0743dadeeb2c, 0x3fea496b785ce539, 0xa7da2e5217152661, 0x6b6dd287cb527c1a,
+	 0x7ccacbe903c439bf, 0x7af23ee2282d728f, 0x8e94a77db0e5f92a, 0x8044dd5169baa233,
+	 0x55abc08f294ae3c3, 0x8bc10e92800143b2, 0x8d0c677104a02496, 0x30f2abb1b8eb5f31,
+	 0x31e84aaf798fddcc, 0x84eb2834d9152e1b, 0xc90b52f61ecc909f, 0x9b9b17ed621761ea,
+	 0xba9c33bd4b9e8934, 0xd9f05c18f8c65170, 0xd5580947cd7b6a53, 0x89218d5dafdb2456,
+	 0x104f6b53b13cab4f, 0xdf98671c085c8d04, 0xec2a92b949a30b99, 0xb4fb4113bce939a9,
+	 0x09b6367a7d0644a3, 0x0036fdd021b97a59, 0xc7d698696f84ff5c, 0x1bb6975b313ae8c3,
+	 0x4ac61bd7b506cdc6, 0x2daa616b237443fd, 0xd7d9ef5a812e4113, 0x7b9577e979528d49,
+	 0x0da42e9e117de4dd, 0x6acbd9b874524910, 0x98df7a25fcdbf4e5, 0x3bb70d38ce38565a,
+	 0x8c6e0bf1ee93ac83, 0xc35951360ba3bad5, 0xfd39ba4df09ce1a0, 0x28653edb8dacf372,
+	 0xe81e4ac55e38b006, 0xb17efdf0db0a6f4e, 0x32afc1b1b1672d97, 0x0b520362fe8bb995,
+	 0x3cc0fdba7cd9ca66, 0x6e029f6d1e7bb024, 0x9a7b06496173d9e5, 0x08a28da8555823fb,
+	 0x25228d3dde4249f7, 0x62addb2c3cefbe35, 0xe93ec9b7965dd703, 0x4eefe744b18f305a,
+	 0x039dffb22698269e, 0x59422f1dc8556c9c, 0x3b54b52bb7c510cf, 0x97b5ca697985ca83,
+	 0x519efe6033262f28, 0xacf6a3a917567305, 0xc66596b6391233d5, 0x35aaa68fe845b861,
+	 0xebc813b4f1c1919c, 0x191929a16931562a, 0xc30516e5e3322958, 0x7acb5758ff16bc33,
+	 0xadef4ef940b160ee, 0xc20540db87a65718, 0x9195ac8a9d478bba, 0x9c12bba1019a1b22,
+	 0x804ed3ff53a80422, 0x2d7f030e7511fc89, 0x9ea6e8c27a3238d2, 0x3331ed5195b6bac0,
+	 0x122f8105fe221cc2, 0x01f282b18f05dfdf, 0x0a33286d995ce356, 0xade037437227b771,
+	 0xbba7b59d2a3959e4, 0x7ea34daf5d187391, 0x6993877f31737cdf, 0xb61113da078880a0,
+	 0xcb8eefafeea8fb46, 0x61b95df151a0d195, 0x2c904f33d5ba3f2d, 0x945f6863f67a36ce,
+	 0x433de2eb41cb30b4, 0x46ed98cc9740073c, 0xb525a6810a734ac5, 0x96f4dd7f7f963f9d,
+	 0x3a99d305a356b3b6, 0xa771a95991998b44, 0xc96e77ef74069766, 0x60a12ff6d23ec049,
+	 0x79ed1b39637c50eb, 0xd78d474eb980224d, 0xfc1591469fb0ba96, 0x13c017e034acc422,
+	 0x7dd4376cf993c47f, 0xc47041f53f9a38f4, 0x8e664cf4e35f62d4, 0x64a72f0a5f5bdaa6,
+	 0x13edb5e2d37bfdae, 0xc532154602667cb4, 0xe4278aeb7a110599, 0x0449cdffae689651,
+	 0x5ad5859ac12e787c, 0x7fdcfb9683725a9b, 0x5483af014c92e50c, 0x27df18a94e0dca74,
+	 0x02085212dcf6790f, 0x6e9967172d7e55ed, 0x9640871cb31d9b7a, 0x9f28fc7bcb4eec69,
+	 0x7052b9b831fa25f7, 0x2db8cf87adf341ec, 0xb58f75f9503ee1a3, 0x96320f4275016149,
+	 0x51531089231a0d53, 0x9bc7560cc72ef9c4, 0xa10b46170d73dffb, 0x38917fb3a23029fd,
+	 0xb804cf3959c0d906, 0xcbf90eb5f6ace9a3, 0x9ed891146f0bd34b, 0x63065d9961c01929,
+	 0x59bafd7c00617b2e, 0x495d4eb919f370ef, 0x325cafb218c1e6d2, 0x7d637125f15f768e,
+	 0xe43fa89c384ddcad, 0x07cd1aa6613780c5, 0xd4e38bf088e357bf, 0x938525cb5a0c5689,
+	 0xcc821b63c3489516, 0x0681a4b167e9a875, 0xcf8adc58f560377b, 0x0e0b5407e638e1ec,
+	 0xf3a0b7d119576e96, 0xddf42bf755fc9819, 0xfc59cee0d1affb08, 0xaa2a685bda331d3f,
+	 0x3099be08d0808450, 0xde94871569139898, 0x1111ce53249f2b5c, 0xa24e27a954eb4b02,
+	 0x99267b6d2d7e8396, 0xa80c0e152fd4e779, 0x5dd5e85d5e90778d, 0xb4e1f0f84856fe9c,
+	 0x320f792d2f1b669c, 0xb989f02372b6e468, 0x52a3c204b9b8e707, 0x76279754b1e5f054,
+	 0x697ff4d52d190dc5, 0xa424c7757c34debc, 0x41cf8ec9c27156d2, 0xa770f4d5b58a118e,
+	 0xea9627914185c134, 0x4fcda92f9477fe10, 0x88140d20a8210edc, 0x6951406817f42bf8,
+	 0x7a04b2ffa76b2f58, 0xf85c8a7f0d19ebd4, 0xcab1aac0ddbe7f81, 0x8e7de42ade42dd54,
+	 0xe79a733ba9fc79dd, 0x279bb9d0baed263c, 0x46f5d58b6d50b43d, 0x74b9fa736cc05ab4,
+	 0x20267ee4e15cf1da, 0x514f0380833c44c5, 0x5782f713be765a3a, 0x678c37cf0b977787,
+	 0xe22b81ec82af81a2, 0x3d6deb05c09b4edc, 0x5060005f02d7ef0f, 0xb5884404b52c86fc,
+	 0xbbdc4bd8385393cb, 0x0b3bec4b257dc5ff, 0x87a0a10f6cb81c7a, 0x335c64f6e634e696,
+	 0xda14468bc578ad66, 0x96e6503d51a1a8ed, 0x09d6f4db9a42ffe0, 0x6051853b7f7bc832,
+	 0x727d55d7a9c365d1, 0xe1dbb8c6d08e52ed, 0x275ece73fec0dd35, 0x79590d1e24140d1c,
+	 0xe4e5e0bd84d33bcd, 0xe638447368d0e514, 0x2427d112952407dc, 0x01c67c8e23d5eeb0,
+	 0x97f4cdc4ff10b47e, 0x7a8f6b3e732e388a, 0xec206f5a9bf7cbf3, 0x89a3e7c2c1c9bbb4,
+	 0x4315e29576c683ba, 0x43ab20845c20f8fe, 0x1234c3eb07861c18, 0x3f69136176ba6fde,
+	 0xb41b263345afe86e, 0xe3d3b4ca1ef6b877, 0x5bd060a3fc7e1db8, 0x4d0a33129f5ba159,
+	 0x8eed32a9b999d0ca, 0xccb010a4f915f5c4, 0x9a38d92e68b706b4, 0x308667070be5f0f2,
+	 0x9580065a580f5502, 0x6d84bf40312a1b94, 0x0677fc523bcd015d, 0x9cacd7f4a6706011,
+	 0x96fc4654b22716b9, 0xba8c40fcfa2451a6, 0xf7992701ff08a695, 0x3ccd6f0126c17c88,
+	 0x9e716c91dbfe16b0, 0x2b36325b0a10fb0c, 0xaca4a3fe2fc5eb09, 0x1a0f4a7c7c4a963f,
+	 0xfb9f7ced7299962e, 0x8c4957f42b265504, 0x2f12274441c2527d, 0xb392145bb90fbcdf,
+	 0x7610eac715dc359a, 0x83d9828d767c9ee3, 0xfeafa13821ba5e3f, 0x908ec744291f27a9,
+	 0x385618327c05df35, 0xa56ff80158ff7e36, 0xa54639279fdef87f, 0x06497ff50a4c9b53,
+	 0x979f0e9039c7f69c, 0xee900ba5727741e9, 0xf974c39a8973c49f, 0xb5d3b11ec711505f,
+	 0xf3050e72a87d1b84, 0xcac75852a9cd95b3, 0xea3d0ff6902a41b4, 0x01ba591d1f5386c8,
+	 0x65961f51db5cb053, 0x6ababb0a7165ecdb, 0x1f6e7e70b53f2322, 0x9c9f895313f258d6,
+	 0xaa1f3641383f7369, 0x943d1eea1b34f464, 0xcfb16d49486efd03, 0x369b1d4c9aff6f61,
+	 0xe166d8614c0d9800, 0xd9a3cf0a98834576, 0xec71ff542924bd82, 0x04bf748537a5aad9,
+	 0x14599112d2d3e830, 0xe1daed6b690cab74, 0x585946cceaf3f736, 0x600bc5242a152b7a,
+	 0xd3898abe9723ca9b, 0xee623932a9c3b7fd, 0x519b7fa5aaa3d440, 0x1571a312cedb0f12,
+	 0xa7251ca2a92937bc, 0xf5555eb46bf14b28, 0x4ad80e739e49a3f3, 0x224e9dc69d7c00e8,
+	 0x6110e8bdc89eff2e, 0x63d0e7c8cc968b6f, 0xec4e832d07019e09, 0x38488fe95d3817d7,
+	 0x2c07e7ebe0a58dc1, 0x7e851672e9e60470, 0x66b79ddb5497d236, 0x45b4fdf6bef28029,
+	 0xf1f148858f588c4e, 0xa9384437507880a7, 0xfc9ce830548f2eb9, 0x3a353daf36aaaced,
+	 0xe60d72cfef62b6bd, 0x607ad90760a7df65, 0x3fa390dfaee3326a, 0xae78073e9c71ce33,
+	 0x9ef6da367f8dee1b, 0x8f24535bcc9e5c4c, 0x7f4979c11b28e4e1, 0x732fd60cad54fdcb,
+	 0x90ab29017678cd68, 0x6c57a77797bb667e, 0x91f259c22e5378df, 0x44ecdd96ef06b292,
+	 0x22c4a225ea1f2ca6, 0x5b3bb7b1d984e610, 0xb2461a725a292f1c, 0x3a884aad4a133988,
+	 0x459b442687c8c6ad, 0xb7e2a35a834b140e, 0x7d485327d4d03bfb, 0x407d18f20e724119,
+	 0x4abac413a0096f04, 0x029aac098323fb98, 0xea8cad2fff14d18e, 0x1e310b5e7c53190d,
+	 0x9be8482fd1fa6a28, 0x9b8e1fd600d45d67, 0xdbfc51cf597987fe, 0x1da36f4fa9e99ee8,
+	 0x21e1d09be09333f2, 0x0aa6c40aaa65d618, 0x6f53fa300df06e49, 0x512e29ef0ef22b85,
+	 0x67a3b3e8385723c7, 0x78401c0ee0589b1f, 0x4e691fc80b28ce09, 0x9c838745a21a5905,
+	 0x05d317458a7ad1a3, 0xfa46b8495d74cbe8, 0x9af47d2c87a9c9f2, 0x58d1424620e10d45,
+	 0x36cfd0d50259495d, 0x5a59280cb9c714be, 0x73e63c654aeb8a6f, 0xb2178b1251b35fc6,
+	 0x926c00eb5e2a9fe1, 0x1bab277ea3b50459, 0x1979ef0d7730f366, 0x291de8abc6e49a75,
+	 0xb582d052a074b11f, 0x46e3b34e631b2d6e, 0x60fe5138f85dc1fe, 0xa2df314b7a0bd752,
+	 0x96cebdd080b79eea, 0xc4e3c0c2b5935420, 0xd99f2b34f2850306, 0x43a33cb7c748c7b2,
+	 0x1c789aa6d8cc365e, 0x35f60efde3b995b4, 0xfb252b5a0b0ad5d8, 0xac40d49d51bf703c,
+	 0xef680a0089d6a75d, 0xc37e48695dad8b8b, 0xdea66a59c6350215, 0x1ba436be01e26ec1,
+	 0xe442f23269a4dcae, 0xf0e51b991c3388c9, 0xa5981f256a3cdd83, 0x5216c39892825699,
+	 0x1d0e4b8f149c95d0, 0x8f8e5968de744d86, 0x3238153cc7dcc4dc, 0x9ef7aa1c5e41b24f,
+	 0xbc48e4ff166e38a1, 0xe19bfa2ca38bc6bd, 0xc00cabcad79b6903, 0x10609ab5b73307e2,
+	 0x1d879077052c3074, 0xad8ed8fda2e4ef03, 0x74f2579b2de95aef, 0x4b143cd2c0229190,
+	 0xf61b3d030ecd83c1, 0xe9eaad6303cdff56, 0xba6c2a1165086d54, 0x2c03cddc7e0d8228,
+	 0xe7905c8775bcf707, 0x6d97c8921dce1a9b, 0xd825f0a3d86e590c, 0x10bfe81d59f99b12,
+	 0xe6d9fbd3fa7070ae, 0x893820801f5d0151, 0x7cb1f7100a26194f, 0x0d9fb55f3638bc7f,
+	 0xfe84a5ffc5fc5474, 0x2e69b679af6fdb29, 0xf3c52b1e2821af04, 0x9f28612c20f132d3,
+	 0x06a4be55e05aef07, 0x6c41b31b6d9a4f24, 0x62540bce9bcbd975, 0x4f6a4961932b7f17,
+	 0x0bf711ee4c31053a, 0xceee079809d105a1, 0x7357a975b0ddfc0c, 0xa4a20d277e2ac595,
+	 0x9662127455c6819b, 0x9263eb7abd567681, 0xd105c708a89d47ff, 0x2842bd86ec874f34,
+	 0x8195a6f0416e05cd, 0x2182d8ec63b598b5, 0x6a64cc316fd9888a, 0x47cd7b771a54675f,
+	 0x779bb34028dbf8a9, 0x5402032098c6b227, 0xf8d18f5625586b8d, 0x2933ddb892ba38fc,
+	 0x9f156f1870448ea4, 0x0a5eefcf62ce15ca, 0xfc287e5ef6d64dd4, 0x73162a1a856860e7,
+	 0x5edd88f08ae444ba, 0xe2908063bffbdff7, 0x7b7a61b8648d8a20, 0x25f019d35d3c7c8b,
+	 0xc38c061da218f49d, 0x7ca292c7552b1818, 0x1363abc2565183d8, 0x5f2500bf39fff87d,
+	 0xf8d79231a75bd0d4, 0x3aba9707562b5908, 0x6a44ae76ac348428, 0x5fd2ae67c6746526,
+	 0xf3f582ecef9acbbd, 0xecdd5eb0c981d1da, 0xd8aced7a8d072113, 0x4146821569bd0d42,
+	 0xca4a737b00e70628, 0xcb4504869ebbf27c, 0xa1fecc2f78674dca, 0x7c906a3269c32a98,
+	 0xf7ce5d3f8d28c897, 0xade43660562890de, 0x0859d107db969036, 0x1dc095fa266ae2fa,
+	 0x0db0c8b29d2e4582, 0xafd39c253ebb6964, 0xb7378adc926f8f29, 0xa50cb83ced384feb,
+	 0xa63bb4e9da276678, 0x28212a1803cc2ec3, 0x2a62a62dde850473, 0x7ee72977a5a3d855,
+	 0xbf692f5bccc83902, 0xcbdf68a8a0cf8e30, 0x1876f095f94197bd, 0x9f7599293af533ee,
+	 0x0d811be38035ad08, 0x0275d3c65e32cf76, 0xcb639d8aa0c4f7eb, 0x230e966eadd07cf6,
+	 0xf23cc86726dcb165, 0xbd3642ea099fbbbb, 0xaf0596d9321ec1ad, 0x9278418190889bdd,
+	 0x8af0e43a875f1d38, 0x96e05b85399fce97, 0x70ac1a18f4368200, 0x3796a13d0af0849e,
+	 0x230b0c0bff64c3e4, 0xa6dd03ad26282987, 0x97f6e77a1c48f360, 0x3ea30236ff1ac1d7,
+	 0x2f974441d7cd5478, 0xd88044da5d3fe515, 0x02f44f29e3bde2ab, 0x242013e3455f5dc9,
+	 0x07dff11d2dabdc03, 0x767fa497d7147d96, 0xaf9f3cacda54912d, 0x1bfeb55176749e57,
+	 0xd51401e81c3d2319, 0x24c54fd9ac963e53, 0x64c094340d7e8d0a, 0x51fa752399344177,
+	 0x670100bae2f60b7a, 0x77d517120640b585, 0x3e3f34c8fc950f2c, 0x569a08dcd2538c9f,
+	 0xf371ca2b8c642000, 0x37510e9f49764732, 0xf3d071091545e7e9, 0x2ac0dc40a846f542,
+	 0xd706040cdd8e9be5, 0x116e16eae49a1054, 0xed03ea82d2d70d8e, 0x3640e58b113b0eda,
+	 0x669a7717126495bb, 0xd68995962da67950, 0x0c1c93a35861d4c8, 0x799ff98c5278d681,
+	 0x4c3d62296c2b5c04, 0xa1c35b067111f986, 0x94bc174409964110, 0x5866662b5d52ec2f,
+	 0xcd3e79c5ac95a1a5, 0x6a708c48ade268c1, 0xa5dd7e677af27055, 0x767887bbf7f15a97,
+	 0x180b2faac1529378, 0x8d0eb914afc2952c, 0xb76455cc8890d50c, 0x9584782cf3bf4a65,
+	 0xdc334f4b1cc28d7b, 0x1c1bb1e1e0005d8f, 0xfe4d260887b8420d, 0x624e843c0353569f,
+	 0x978ceb1abb336c60, 0x28e19efcbcf13f02, 0x444e7d18d173d6b9, 0xa54189a8e0d4b6a1,
+	 0x6338a1a968644d0d, 0x3833214022f59dea, 0x40d6925dab164497, 0x63e204dc0f058404,
+	 0xf4ee423efc907ca6, 0xec20aad6f73b4621, 0x240052f08951b93f, 0x27420c3cc78307be,
+	 0x7ca100048775ec9d, 0xfc4705bb6badf822, 0x4b5f3cea148fc118, 0x7bb2b10f3b555115,
+	 0x8fbf4feca7c6bc1d, 0xfc77a041c2fc0fd5, 0xfa0e1c09ab5199d7, 0x3f31d703be55a121,
+	 0x854caa7e681e8bf6, 0xbc606b68711bb67e, 0xe18606a481b10a2b, 0x3c1b23cf732b93a9,
+	 0x0048176a3af2b7a2, 0x7c5c1123f0ce7476, 0x25e593ee6cb6a09c, 0x186b9448495504c2,
+	 0xdb241b041153ea83, 0x1c6b84bd1e8a7920, 0x439d6038eb8cf3d1, 0x653c5151c614cad0,
+	 0x7802b5202a21d3f1, 0x6f1e9404b2bf334d, 0x477824a79f340d51, 0x4e72b7e6614a877b,
+	 0x29a4c67164d12ad7, 0x2d168c60094bb0f5, 0xa6baf1474d27a07a, 0x841e5541b31ddf59,
+	 0xa8d421ac96c76bd4, 0xfcdb677c7798c2c2, 0xae0d5704b5c30aa2, 0xb2940b2fdffcb6b0,
+	 0x8a23a28b3eeac154, 0xba5e7a5553e6f80e, 0x99f516b7ba2b6c7d, 0x6597cf5597c18a4c,
+	 0x5c6505455f52fda3, 0x6a85778354b4955e, 0x741c78f9f8a68f06, 0xa7a38ac6959c4663,
+	 0x26614b8fa1b91795, 0x1f6379a9bdbaaea0, 0x7e2223a79c10d4ff, 0x75eb36b62374cbf6,
+	 0x29a8a89702a136ff, 0x991e26f3c0cea314, 0xb2b2938140728ec5, 0x2725f1e025172158,
+	 0x263faef74316250a, 0x3b07dc1ba0aea383, 0xd4821358a1916f3b, 0x799c4ce30b4dd26e,
+	 0x672f03d5bc8b8c28, 0x2881eb6c95b5e3bd, 0x6082005377699fda, 0xb2669bd51bf584ef,
+	 0xfe995f33bde7b269, 0xd3c3e7dc2495ab2d, 0xe67b0c6b440f3f61, 0x4c6c9a75cfe91c7c,
+	 0x9986d92e7ab278bf, 0xda1c752f010335df, 0x179a4bbb2bd4bfa3, 0x7cfa10fa59718713,
+	 0xb6584be1a23e584a, 0x7b253ad63f8f2964, 0x090e862d1402cf6f, 0x8c39b8ffd16ecb5e,
+	 0x6e697ed7174978a9, 0xbfd5b01862458190, 0x22a207cc303a2397, 0x045976d125334da0,
+	 0x9ea0c8d42070f41e, 0xa571d0b64a17e941, 0x08ee3e7c96b5c376, 0x08a62129330d309d,
+	 0x1efaf866d175fb27, 0x17e5b2575eeeb599, 0xdb944baa6b2d4721, 0x9fabd77303314a50,
+	 0xd856ba51ad4e6494, 0x3805d15550b8d2f6, 0x5130ca8cc22ff0f7, 0x820c4bb02871ba5e,
+	 0x79f46d20e98d3801, 0xc8365f31aab66fda, 0x48b65de519e1b90e, 0x89b4bec46c4bf935,
+	 0xfdfe838460e5647a, 0xecb45e4a169f595b, 0x38bc0bd70ce8537c, 0x0266210c461a92ae,
+	 0x7335c0038722e95d, 0xc6ec2bc17f76d907, 0x00a2756938bf0a26, 0x16699e943898a196,
+	 0x9abe208dc33ae527, 0x807c169589a3ac9b, 0x9330fe8fec41b821, 0x383a506b8cc2a06e,
+	 0xf9d6e3bd6cf454fe, 0x23be5268b55f237a, 0xda6870b53255c7d9, 0x018813a04305ac90,
+	 0x8c43df629779c942, 0x0b9ee1c2222bd5f8, 0x2b70d39be3e6ddb0, 0x4e6778121ce47822,
+	 0x6ab56d0c01d860c6, 0xbbabe761b20831c7, 0x3dc0d24caa86b080, 0x470943d3315ad570,
+	 0x168df1b8bd5737d5, 0xe0d669203e9e687d, 0x8c4be392bbdfed04, 0x9bb43ca644640cc9,
+	 0xf0e54d7983554817, 0x1f67ffb2c766080c, 0x1c0968de2054de61, 0x2136d7e625f94187,
+	 0xf947180412075493, 0x4e573921826b49ae, 0xb8bab59e87b9d009, 0x338d0fb0e43cb56d,
+	 0x8b09c770c4b40789, 0xb9e8d7b65ffd1f32, 0x5457fd0a47512f90, 0x7fe35c451f1c778b,
+	 0xb877708bd8c5c5dd, 0x178360b40b8a7640, 0x4f8c8565f756f242, 0x2c8bae252b0fc984,
+	 0x5b358cd2d758a23e, 0x59e0c7690eea48f4, 0xce352de49bfee66a, 0x4fc5b651fe8ca208,
+	 0xd25ed819c8d7ee82, 0x48315808976b71ce, 0x712a9d4c2010d295, 0x31d788af97be3b52,
+	 0xc92b7d18ef091902, 0x841bddc8ade815d2, 0xc3501ee3e4b8b2e7, 0x8321ccdefce350b0,
+	 0xd2eefdd342a2096b, 0xae6f5a7ff8d42e28, 0x5e9061382e1c8438, 0x5fd062f532e2395f,
+	 0x564e80a17735a465, 0x7bbda661a53e0b02, 0x866b819c4d2f0977, 0x5fac09f8f3e23adb,
+	 0xdb30911b80ad7601, 0xb72277afcc647413, 0x1470e11781d4f6c9, 0x08a841a19ca2b5f3,
+	 0xb4ee0b78d1626bbd, 0xb1e7fb962cd432a5, 0x007e32a45b5171de, 0x5babe2828a7ef0dc,
+	 0x04888f6d440b0926, 0x5b911c50399b8cb4, 0x1b5c0ee5e305e17e, 0x5e568b0a658e6151,
+	 0x3cbe31ef9a90e942, 0x468bffc415644c32, 0xca83ada1729dc346, 0x27806377d11e128e,
+	 0xf19539ac3aa741e8, 0x8befc784e45c84bb, 0x13f361a02787342d, 0x872ca7eae53dc34b,
+	 0x5cc3c2ad8e4f52ca, 0x3bbbb342da0e4c3a, 0xca59d9753c1e2b41, 0x3bb3dbcffe20cdd4,
+	 0x336c23334fd4e885, 0xa6837f644cfde00e, 0x2cd552c1c1c42bfc, 0x633dc0c16a9a31e7,
+	 0x1d429a442644d00a, 0x2132d0e5dc8ce491, 0x26b93387a5f9823f, 0x12f043f6cb6c9803,
+	 0x24ffdffdb79e49b3, 0xbe85daab89ee8c3d, 0xf31710b6de35384f, 0x28ab405e37e29e3e,
+	 0x9f2323f94215f26e, 0x3fd17f4d46890a60, 0x9d086bea9da2f335, 0x332e72360c47b518,
+	 0xea33784987c66bea, 0x5704e3589a609f83, 0x22099f418c9c1814, 0x4c13c44039420246,
+	 0xe994073027cbf4f2, 0x6bdb84d182765abd, 0x98a7cb40805428bd, 0x6867f2195d40676f,
+	 0x9f9f3034aa4c3548, 0xb0f8d28c523d30bb, 0x5d74762f2fb923cc, 0x8230842563c9800d,
+	 0x1a135a99a8f02833, 0xc17933ab0051c225, 0x2b16492ce95cff7a, 0xb329022fea2d8304,
+	 0xff7ce10b11af8a75, 0x625f2d85496d8c86, 0xb45326cdee193787, 0x96ddf51fc3484d5c,
+	 0x65957c3f803f4067, 0xbde192ef59c01fcd, 0x1dacdf3feb585051, 0x93d419733083aaf2,
+	 0x072b8f4a8ee04d9e, 0x51876e224960298a, 0xc5f7c252eb2bca57, 0x0b9ebd44655401ce,
+	 0x65dd5aca0d3268fd, 0x434382c06b5d130d, 0x9dd2e8dde33ea958, 0x08d07064adbac82f,
+	 0xa5b7140270e5becc, 0x32bf71d23339d82c, 0x9f973dcdc523a6b6, 0x83bb64a585cbc385,
+	 0x013abdb5b59f7c1f, 0x6953cf2782573371, 0xf394a4805193ec6c, 0x674f3825283bc2b8,
+	 0xe21ee6552f0268ce, 0x8ed5cdc86a53024e, 0xfa6f1c9fd74b2513, 0x26bbd106af10aed0,
+	 0x1c6b046fab1a35e1, 0x5eb43411317b6dbd, 0xaaa824818d1a7e85, 0x5a10b3f4e66fc97c,
+	 0x88dbbd460481bb90, 0xb867b7aa6afb37a5, 0xb52fe7d460935b39, 0x8f1f111b32bb68de,
+	 0x7861396c9cfd46ff, 0xb4b55d7a63277830, 0xe7b3c2160a396593, 0x9ab6b938247f1531,
+	 0x3aba899759c41797, 0xbc41864edeaeabb9, 0x48ac4bf152b175a7, 0x193443e8675b70e4,
+	 0xb03c83a422408ec0, 0xc30779d6a6d0efbf, 0xe056179cc3eefa82, 0xa21da967a64d1775,
+	 0x60ca8ff6ff932ccb, 0xd8da349e310251bf, 0x458c586d7dede621, 0x724746f8ff0d7cef,
+	 0xa7c63b58d3c6c750, 0xf586cb0609086087, 0xb60a427ec6fb7e65, 0x5ba5529fe323de42,
+	 0x85c3d15dc7b37ccd, 0xffa0f99b7531209d, 0x3f7cccdf469ad062, 0x9d8cf158aae708a8,
+	 0xc1959df97b84498b, 0x1b2c9887d356b330, 0xf02a0b76e6b71ad0, 0x74cb510780cf5834,
+	 0x4a814cb2f0e73799, 0x248bf8e4847a3323, 0xccee525a40c103ed, 0x842e1d876693b0e0,
+	 0xde85f2c69acb5f05, 0xb19cae40d7b6e17c, 0x063917e438dcb837, 0x805017b6c91c0ab3,
+	 0x729cbb8e995e71ab, 0xb403b3eb8bb2162b, 0xac29ebb42ace25df, 0x807b05ccd00ba887,
+	 0xfac308af30fd3595, 0xf8fd134f43960b30, 0xce06a44be70da3f0, 0x174e213ac7abfede,
+	 0x169c75e78fdb8def, 0x2a5ed0733f6f7b0a, 0x33aee2ad8fa50c12, 0x670712e7951c64e9,
+	 0x09806e9c351b791d, 0x9ceeed70c839f819, 0x648a93a852173c28, 0x229e1e6e73c42357,
+	 0xaf97e3078ca15268, 0x60cac788f4a3f3fe, 0xe0bd3f55e9361567, 0x8aefc1f1221d1252,
+	 0x77e30752f2570649, 0x343b020f7056874e, 0x2ffc827e802b85f0, 0x75c390b41c30974f,
+	 0xae7af510ce3c7235, 0x667855fef4ef48af, 0x1a6e9476df11016d, 0x62d69e61d2383a00,
+	 0x0eb4672da636b90f, 0x91ed8054f4b90541, 0x0a8dc56b3d457fff, 0x87de8ceb910d1d30,
+	 0x2e98a65702418b4a, 0x0f911c267f98ea74, 0x1c0e4d7d0a1a1784, 0x017bd86076c7faa0,
+	 0x2b1c7d400906120e, 0x37d6b7eb58efc8e1, 0x880e8012943d666e, 0x3ec7c1eba15110ef,
+	 0x79ec856396b5e927, 0xd17dbae3e7494d43, 0x50a1e946298aa9e9, 0x104d9bf048776e6d,
+	 0x6ac30e0c690909e8, 0xff2bb347ec5b84e2, 0xd5ffc38256028435, 0x7aa278444f8e2a29,
+	 0xcfce4d7f85a4a319, 0xef7c79b52d79f443, 0x54c9cd654c639f2c, 0x84162efd6f860292,
+	 0xb5f4701949848c7d, 0x900df009ec30e4d4, 0x903416a45fdb3571, 0x7882b308e72c3dae,
+	 0x88f1446af087056f, 0x6236d583d895fa54, 0xfc73039e9c329467, 0x1c14ee7ce2401ecd,
+	},
+	{
+	 0x48f874203dfdbf32, 0x5ebe6d0153f1f52b, 0x031ec155f4efb426, 0xaf73408b2691d4ef,
+	 0x6f6bd17ce793de71, 0x3484bcbe8f76f8c8, 0xa61c2c6d54cc8813, 0x2c89b62a234e9521,
+	 0x2b0e060010cfbaf3, 0x7bdc52d26ec8a222, 0x4b5ed6b8620e5b7b, 0x2ee06c61ca0fef25,
+	 0xdbce20d350dd8f43, 0x97e63ba3e1af94ec, 0xe9d81259e8bd30c4, 0x77fa5416ab95d109,
+	 0x2ba44ed03ee35ed6, 0xa86cb4d54d9a148b, 0xf11f63afcbea63e1, 0x2cb4d5ab244f20ce,
+	 0xc05bfb38450b4a57, 0xf03a3d3b632730bb, 0x3ef5db6124a47617, 0x0bbc12dc85847575,
+	 0x601ac7d53d056f70, 0x219deec50eedeae9, 0xa78c38d4aca8449d, 0x160bb5ba1ac4dc9d,
+	 0x8d770e3a2474be0b, 0xa9c10d6a3def5057, 0x414f2a1e0204b51f, 0xb3be31506dfa4867,
+	 0xc8b41f17675d0054, 0x3bea1844799930d1, 0xb8096df0cabbf9a3, 0x13669a157e82a7b4,
+	 0x101549e451333bb9, 0x1c55725e152eb833, 0xe2e7cefe07547eb5, 0x4e39f1d9e46b6a0c,
+	 0xd1a9d4128018c956, 0x7159ae229faa0516, 0x5a313c1f522dd104, 0x1976b7c83b334928,
+	 0x410bab95847a7aa6, 0xf89902614ca2f52b, 0xf6aebd0dc1a57bd6, 0x78829120a43300fc,
+	 0x6b729c5f3f15a03b, 0x34bede6a286b694e, 0x46f3a2fa405b789d, 0x2ff291c74e39cc3f,
+	 0x602c0c9c61743084, 0x097f99e2d85c57b8, 0xcb5568f1420e213b, 0x7a2b7a4924cf138a,
+	 0x35508152d6cf1c5b, 0x127766216c939f39, 0x0d3e271f5d0b0500, 0x712cebcb77f503d4,
+	 0xb82d4ff6e1375a51, 0xb84b06fca51a2537, 0x8b8c2edfff966149, 0x6098d390c02c98b3,
+	 0x054adfdd30f8d899, 0x7adddad7ffb9fdbb, 0x58d96704298af24f, 0x99478ba6db325b88,
+	 0x5002d995e569af27, 0x8d5691093e641cae, 0x78360cf78d2f6345, 0x2936f12ffcc240f1,
+	 0x1f86ce067d1ccaef, 0x810b8c1eb2ba0e33, 0xe8a956973df89ecb, 0x3ec373d58e9bb538,
+	 0xe3fa426434471b0b, 0x44e5eddca6da853b, 0xe3955616f03b1d18, 0x8d76ec682f100a08,
+	 0xd8e21aa285ce317b, 0xdf9dc33e6fa21268, 0x4b1b3f963ce3d402, 0xa5221ceb681182bf,
+	 0x8473e48d4d195e3e, 0xd4951a3031a794df, 0xbec43c1699b3cc92, 0x9aed0e676ee2427d,
+	 0x336738947a2e152c, 0x28b7bf78b450ede6, 0x9e7213ef9c3bf608, 0x0550206123b608ed,
+	 0xfba389840882530d, 0xa6aea51980c0902f, 0xeeadd985f9c393ea, 0x11571dd213a29646,
+	 0x36b3c32b84a342c7, 0x7ecfcd0d730ba59e, 0x313969301fadbdc9, 0x585cdeeac2256494,
+	 0x9ce9ae8d1b12da74, 0x6ed15a86587383ea, 0x96cf40589d3c4cb7, 0x2bb154815d306aaa,
+	 0x8831e2897a5d3759, 0x23d0155231103c77, 0xc658dae357a4cfe2, 0x89baa2bb7ba0c586,
+	 0x6128b3abb69cc4f4, 0x6f16c38016e5d20c, 0xfa318ce77ed7f987, 0x10f7ebe73e1f0379,
+	 0x4673ff0a4f64747a, 0xc35fdd6a0b236841, 0x4c6cd14902e37800, 0x803e3649943316bf,
+	 0x79c1947aa4dae080, 0x5a36f7ba6877922c, 0xbae3b115599c83e8, 0xa2ce112755e8536e,
+	 0x5493ff83802df89c, 0x03a26be94e5e1f48, 0xd398efb89869157b, 0x7eb65504be1a62c6,
+	 0x6dec620c69286959, 0xe84187aa6a791655, 0xebfe40b03e286ebf, 0xb10c00642f1f32d1,
+	 0xc6b2ce267aa7ebf8, 0x3ebcc89d9fae96cd, 0x375c30fe687d5e0d, 0x53df3125c4db8c99,
+	 0x3a61ad15a2d92190, 0xc7217ee8c627f9ef, 0x3a3b58f27c2107ca, 0x1d920f5dfe1dfa9e,
+	 0x83ef02fca3da57d7, 0xa92b2fb4c35bfe15, 0x87538708284973e4, 0xaf72a8cb84c190c0,
+	 0xe03ed7a9b37cced5, 0xb9189ecb4db4e466, 0x5e4ec669990831ea, 0x914633994c566f9d,
+	 0x4f5ed15d7f0edeaa, 0x2915acceb9e6e2aa, 0xe714416244960520, 0xa5db71f49d427f0a,
+	 0x480f3089bd9ab302, 0x12b3869514460b48, 0x0949f99d8a7bfdeb, 0x5ac79f146ef6b4b5,
+	 0x2e5b7fb415bb70d5, 0x35ea69514ddd0b15, 0x2d9768d6c171cede, 0x310681dc8c4bbcdb,
+	 0x5d058328af827567, 0xe1adcd8ccc2ada1a, 0x0a12eabab031b066, 0x0132825f41897a0a,
+	 0x99d47852cabd71e3, 0x35cf70afc300c92e, 0x859d8858b2b0a893, 0xb5541c182a4fd112,
+	 0x4726dafc686be98e, 0xd46fa3fd78aa1be8, 0x2918a04031a731b6, 0x1d374086afde6765,
+	 0xc05d8b210f2d2ca3, 0xbb490db7d4490b0e, 0x21a1eccce0e3dd83, 0x3fbaca5f342de5d1,
+	 0x97bed43580ca91a7, 0x0599688267aeafff, 0xded38bbd5be7354b, 0x98834cb96685f187,
+	 0x4a257a77fd83b90a, 0x2f153346ede55710, 0xe73d0a9e1b67b4f8, 0x529a0a610f52db4b,
+	 0x7afa5553f9beaa34, 0x7bf9a9e0c91d0604, 0x8a4c26214f4f889a, 0x72164fd84c4fef59,
+	 0x3a1c0361cc033c99, 0xd0e46375bfa66c95, 0xbdb2d2afb69adcdd, 0xaceb4afee97b9a16,
+	 0x0d9a0af1ca90858c, 0x02bb1f7807108f29, 0xfe0f37bc8864a7a6, 0x9d802e5c7f2f10ec,
+	 0x1eb91c7b279564ca, 0x339a1d03599674da, 0x9113c2acb00f83b3, 0x758aaddf014d03b7,
+	 0xecc7adcf627d5151, 0x2412bf4a936c80eb, 0xab95660195006875, 0x9f44b18736185111,
+	 0xa59dcade75c21122, 0x552b0ab09dbc94d5, 0x28a92808bc661986, 0x791dbab4541cb768,
+	 0x9b3b07e708ee9d77, 0xef774a8c1c9557de, 0x69e0efb564f4825e, 0x379ac0ec123a642f,
+	 0x99b1cfd6df001472, 0x1d9e1c22f5879257, 0xb447159f941214da, 0x835b43a160d8adf8,
+	 0x0aa55c06663534e3, 0xc7436edd46538091, 0x92a552c97c15b03e, 0x576eaa2727d074f4,
+	 0xb17d493a3ca209ed, 0xd5806fded0aaff44, 0x46ef7ab5f1a73465, 0x541533371fdeaf8f,
+	 0xf86aac80faa3acd8, 0x343627cadb0fc3a8, 0x30e550ee2e0301dc, 0x23dc447f88e4ff6f,
+	 0x08fa3dc248570601, 0xb2b380becc57b568, 0x8b22df4c929737b0, 0x84d26e4055381040,
+	 0xb0dde92e192a187f, 0xaed98e68e1e7449a, 0x1077d2186ba4acf5, 0x5832528ffabbb1ae,
+	 0x04471c5672958023, 0x09d1e79cddd98e17, 0x8bb6854a3fec8787, 0x0dfb55b61172f7ce,
+	 0x923e7a7f1a3f42f2, 0x36938843e49c3eb5, 0xd9b562a0ae1f89d2, 0xb07f3d44ae27fd04,
+	 0x84f2a2cab70a1070, 0x08cf8d04a3f73eae, 0xfd8c73d38bd96bea, 0xb4b809b50d469193,
+	 0x42a7b7e930ce755b, 0x6edad1022525df34, 0x3cf307ca69faae26, 0xabbb51272cb56241,
+	 0x812f03c253cc41c0, 0xf64e398a009a6637, 0xb30c753382f37e4f, 0x89fe0b68094eacaa,
+	 0xe70cc53dff05962c, 0x0e3a148cf2ac5eb6, 0x699c724b3a50710c, 0x9f377323fddd3506,
+	 0x417f68a72297b70c, 0x93b69df2cd636d18, 0x5b3733119f030826, 0x970b2745c2785972,
+	 0x8b175a4006de6760, 0xdf2b8d30432ae83d, 0x2414cc7f6efd4222, 0x314c04354535d328,
+	 0xdc5a7b29bfd03374, 0xc99fb5a2d54dfc72, 0xa6aff7ee1c920665, 0xa47d2577591fd6ff,
+	 0x0ff3dba062f2449d, 0xe7c71289ccf1d874, 0x582ad81e9c59ca8c, 0x701e02637fd6bcf1,
+	 0x64fc7fba21719ff3, 0xaedc68d34a52e307, 0x3861404b63fba934, 0x28b6d4dceee2b259,
+	 0x9f6e304a3bd2d685, 0x34d8787f7bed9566, 0x7738bf3521d2cc87, 0x25a53d0e14ff79ec,
+	 0xb747ffd34e9280e6, 0xe240b2ab141c9444, 0x78333c4c646a6a3d, 0x0f7a0c7290f125e2,
+	 0x0bafa31d2b610da6, 0xf8c93bf1c989f36f, 0x921a7f9f1554c136, 0x4d9a8732b8069b25,
+	 0xc7bca5b9fc3fb5f9, 0xdfdeb819b0ebf86a, 0x48c84e1730783ab1, 0x2e566f5205da24f2,
+	 0x5c102b928116134b, 0x42b9a5e4527bd6be, 0x95315d2dba2325fa, 0x543fb478f3d23e7d,
+	 0x1edb528d5ac36419, 0x446573027f59751b, 0x1fefc6ebd1d8c11a, 0x01288fc872d817e7,
+	 0x6a7689b40a662abd, 0x36ffac40701a9a07, 0x8ceb363095c41301, 0x3f78a861adbd3640,
+	 0xaba197cbcb07c94a, 0x261be4259ff487de, 0xcff807726e78db9e, 0x2be5468ec4c9527d,
+	 0xc581fa060fe592c2, 0x00f307dce44afdb5, 0x517e9e946332a8d1, 0x962ae17b3d2a4494,
+	 0x8525137ddaa902e3, 0xafb443f1ec3bf848, 0x734535ecd6e56da2, 0x58430e06451499ea,
+	 0x0f08a07ee659693e, 0x51fc22c1a524ca0c, 0x45422fa8698ab04e, 0xa0e042e4d3677071,
+	 0x5b680a2616cef981, 0x67cc1ee6c6cb8223, 0xe26b3740d35e324f, 0x61c35fd54f43e9f8,
+	 0x18b8dc4d0c093135, 0x621ad43f3dc1fdb2, 0x32901d4f39b70268, 0x941a664e4aedb6eb,
+	 0x309ba42a88061cd7, 0xc9f9eaca7c17bee6, 0x070c54a68fdfdeaf, 0x22a0691ce8959109,
+	 0xe3e0ca1d89fa6d84, 0x28ae86a4415f157c, 0xfba47bdf094e5cbe, 0x6df08cd9441564ca,
+	 0x682daa001143ccd8, 0x4a850b3f2a59ee42, 0xc869ba5b087fc244, 0x2b0bfd44e885dbb4,
+	 0x762f275a1f9c446f, 0x01915bea0d0d25fd, 0x7b216a5abf4be00d, 0x8d53ead9b2ac43e7,
+	 0x37cc66666997803f, 0xdc828c222f94feea, 0x5268d52bd74674ef, 0x93ba8bf7f42ae5c0,
+	 0x6375f92c6e39b4ad, 0x60d51c1f1e187ebf, 0x69e1e3c7dc510f6d, 0xac4883e0f22651f8,
+	 0xf6c27d341c73ac61, 0xc912a85f422990c3, 0x734c1cec8abf8de3, 0x8deecab068a1e20d,
+	 0x6800fbf3e3dbfa11, 0x6bcb23aa031a125f, 0x2465002b352cbcf2, 0x615dbb88e9edc955,
+	 0x1dd1343a94292d35, 0x3b843a0d873928f5, 0xe44da21397c4d3b9, 0x6314752470fe81ea,
+	 0xb4eeb0756e6483e7, 0xd676e6eac411e6d8, 0x62cd8bdc6c32caf4, 0x0e03241aa4f24d55,
+	 0x158fb48d7e57bda7, 0xd62125502113490e, 0xd47bb67c589df205, 0x57def42c84fd6ef3,
+	 0x135416eca0e7114b, 0x2d3b8e6726e64ede, 0x536b84197c2042d1, 0x5fcf244f0ab2b9a0,
+	 0xd1229095c5cbe627, 0xb749e18f8f9f09cb, 0x2534395c1538a1a1, 0xabe5f189b19efc0e,
+	 0x183edebde9e2ec54, 0x37c8868eedf3a167, 0x5873e30e99f3ee15, 0xa21dce0bda0e24f1,
+	 0xfe244c9c6dd3cd8f, 0x260b635bb10299c6, 0xb00bcf7374819634, 0x503b03d2700d3675,
+	 0x0c82bd358e48aefe, 0x69b8e82d453e9701, 0x376a688b349aeb24, 0x7f79ba69feded4d2,
+	 0x20e4012227c7da12, 0x90521e4c4306781d, 0xe8df22bfd17e394f, 0x4c14bb7e150f4ee0,
+	 0x19d69dba51eb7d56, 0x46d72214f55bc6ed, 0xe8841c5f10f1ae62, 0x114df4c2c868e867,
+	 0x9284c98eeb6fe1fd, 0x257e8b8c0bf21268, 0x9ce655ff6d6f6b64, 0x3a06e0bf20aae13c,
+	 0x7b3f25cdf11e645f, 0xbad1650f2bc3c2a6, 0x5378d88fb412b5ff, 0x2235470eb71a7938,
+	 0xe21d463b422a4f3a, 0x4019de595d758f28, 0xe2934ab13891a3e0, 0x67f0b8d54edcc1bc,
+	 0x3fc2deb001d9e2b3, 0xdf9d03549cad07c6, 0x88938d84ed07b170, 0x49c6a0bb101d2630,
+	 0x912a7d71bad6a3d3, 0xc0e79ffc3d346289, 0xdf9c9849f07f0c6d, 0x2962aad1120e8388,
+	 0x2f22c407826220ed, 0x3f706da88e0d9ee9, 0x932167fa41966c31, 0x57834eccdf389642,
+	 0xf2632806ee0e403c, 0xf470af3692c549f0, 0x3b00a8d9143d4084, 0x151fd5bf6a1f697a,
+	 0xf4b0030502bc2ecc, 0xc1502f58b49df3ec, 0x85323c0c728898f1, 0x1f3bc001b174e2d4,
+	 0x1bfa1d3807daeeca, 0xbe606a1c21444ad3, 0xd7223674ada49545, 0x1322af3c8817a4da,
+	 0x7f55867f54531758, 0x8a1c93312d5c97d3, 0x39d5dd64ed0e2fc2, 0x019f8fe1e3db53e6,
+	 0xee2f5db3fe27d673, 0x8b23fa22a43dbba8, 0x5a437abbbbc61c46, 0x93832cf90a1f80a9,
+	 0x180987f87ff38c2b, 0xb6b1be1b285e8e7e, 0xc9010e927797332a, 0xb00f8ca846ea0c91,
+	 0x980c8c0792b7766e, 0x5ecd2e4ceac3d68c, 0xcb17362ef426c566, 0x2f6145fea494b932,
+	 0xe7c68df8e928bf82, 0xae4707c8cd199265, 0x4c0472e75e6af855, 0x3195371aa439ac3a,
+	 0x15f347805540591d, 0xacd30ce7c3d244dc, 0x42369ae6c7dc6c80, 0x4f641667f7a9e789,
+	 0xad6cbd2651e9ba26, 0x36f1e244bc828975, 0x175983a6cc85d05d, 0x05d815c98bd6a8fa,
+	 0xe7338ea08eddc435, 0xa0fe210e8df408a4, 0x58083ae0aaf2c9b9, 0xb34c93d6a128b788,
+	 0x74306bc73b10ad76, 0x2ad4e7993bfbb46c, 0xe717eac102364945, 0x8c02d056e2adc53e,
+	 0xd693d5d51f114b4c, 0x996f8b47595caea0, 0x5098854272e7a888, 0x840fb89efc432885,
+	 0x4f50d4e0303b3100, 0xe220d62a9b99eddf, 0xda29d9e8d71f0838, 0x0649517de186a323,
+	 0xc14e0a8fb16ef0fc, 0x426d83d8685bb236, 0xf109c1ac523562b1, 0x43d3a7c5e9c4f4da,
+	 0x47f92f0383546844, 0x8854b00693c296df, 0xd4c7962c704a6738, 0xb509df3d6e5ec7e2,
+	 0xc3bca23fd936107d, 0xf4a8b29256a79e48, 0x1cd63d7137e5a030, 0xafc01f52556288b2,
+	 0x983204d8b5219ce3, 0x7461953d78c970b8, 0xfd5adc5983dbaf26, 0x1956cb2f924e6891,
+	 0x6cf11ddbcd61f20e, 0x1f0c7dabaa59d563, 0x79a9a074c9f45bd0, 0x810d06d654a64ee5,
+	 0x1f0b673bd060a74c, 0xf83edf6c9f3380d5, 0x4d77066344ad193f, 0x711a7648da285867,
+	 0xe16773912ab6ec00, 0x5d7b48b7c9100984, 0x55974c6fedbc6d44, 0x49bfcab88009e57e,
+	 0x37dbe4e86456ed7a, 0x91e4575ebe9a6390, 0xb7ca2ff43124cc82, 0xa9d089e1fece5408,
+	 0xb070759e87a9d50f, 0x24b470edadfafe29, 0x69ef1519973e7847, 0x23b0257665cae1c6,
+	 0x2016c4ddec345c36, 0xe3c4e0009e4aeb0d, 0x6a9829c08dcc6c9e, 0x3c8b5f01f2c18d30,
+	 0xc9fef6fe1bca3759, 0x927bdc85b56ea5df, 0x1536b4bc72d4b322, 0x19ff42e1fe10ec2a,
+	 0x211de32b7b15ac6b, 0x938924c63decd05b, 0x486508386115bb5b, 0x1e64cd145d8e5c3c,
+	 0xf7e072f16facdf0a, 0x3bd1042561b1cac5, 0x5dbd6d42c5048c44, 0x46cd0e0930011199,
+	 0xed9fd704ca63f4b7, 0x98283ba3593977ca, 0xccf9203450c6923f, 0x25e9dd8c23efabaf,
+	 0x75b27576539c1e59, 0x02afcfdc8fa5a596, 0xc7e6ee8acbdd0950, 0x69a8b9c31af8358b,
+	 0x4db6047bb22a89c5, 0x12691f127b8f312e, 0x58652ba24310eb16, 0x04b5defbb2c2c354,
+	 0xea68e04f9233cce0, 0xf9fb157aa1f3b443, 0x286caff540abd816, 0x7bad0023e232f6cc,
+	 0x27b753c4f1a21098, 0xe651fa1fd6cbe8a2, 0x0b8f909866047976, 0x639c7e84381fab8c,
+	 0x0d9c896eaee0a45f, 0x5c147171b4ff2245, 0x1307bea31a634bfd, 0xae11c181e4c9a088,
+	 0xb58fa99e66bad84b, 0x942356a71955458e, 0x0849aac50f967f18, 0x4fdeee659e129a00,
+	 0x1b2090af4e5e02f6, 0x02107db4ddbc8645, 0x9b3dc52330d71c1d, 0x9c5a013c8d66b11c,
+	 0x2709f8a2de0f2837, 0x57e8dde14eb712e9, 0x812c1d01d2018f63, 0x56e9168e93a99129,
+	 0x83b521659b897d87, 0xbce47d3859d62504, 0x8f005e07f6e3e163, 0x4cadc0282ab8b2b2,
+	 0xc7ed33f68bc01301, 0x254236ab52de8a05, 0x4483e406360eb820, 0x10ae62b5981aa08e,
+	 0x1f0a072945f83995, 0x10b140bdbd7d8783, 0xb2afbecfe21004ec, 0x9fa173860005fb12,
+	 0xe4c542075c41e726, 0xf661b7d973b4d568, 0x0b8f523bda53319f, 0x00e3cfc57fc5c062,
+	 0xd52707316b498177, 0x49e96b6d0a1b2808, 0xb3abc9e9072fda36, 0xb1869f0fe4ee3675,
+	 0xfa55235856833f2a, 0x4d5b152ce93a5af0, 0x9fa7098df95f9f08, 0x332697aa15d83e92,
+	 0x588292a4b918cdf5, 0xb6ad3b958a614c97, 0x824026dc2ca699c0, 0x0d89b2cb026ac5d2,
+	 0xac253146c5b0fe5a, 0xb2c90e3a05318a82, 0x2129530f97ede860, 0x05ce0277d6176a68,
+	 0x0e0db383ddaff5e5, 0x45b325bdc4b344b0, 0xa96100a7fc18b945, 0x2de4c5cf5e5c82a1,
+	 0x732cd06e5b114eee, 0x7bce67bde3eecb75, 0x4d98af407156ffcf, 0xb3589355083ea53d,
+	 0xa209629adf08f60a, 0x62d0e87b2843cc75, 0xd638dfdfbc3a431e, 0x4e91553053df6cf1,
+	 0x60888da9e9fd5acf, 0x2fbbf1810ac8b9f7, 0x2653bb1b0675cd95, 0x212da4bc54d27d53,
+	 0x5e804b57274e569a, 0x1219327d75e30cca, 0x6d82af433239ba48, 0x47fccc21d66138aa,
+	 0x2628283fd4c92924, 0xbd866ee2df1f1e9e, 0x0c1b57bc0ed1873e, 0x18f4135914d65a56,
+	 0x29de4e4b505731bd, 0x335e7a239bf34be8, 0xd2676b07e1f59248, 0x9d4600bdde868e31,
+	 0x0cdad23abbd8f724, 0x7642f28b3d6a6f24, 0xb40056394fd033b0, 0x05f365a7d8e96509,
+	 0x473e3951f920d5c0, 0x4bba03ef793947be, 0xbe897144f27cf4ce, 0x1a48ea4a3dd4ac9f,
+	 0x25743114543bda59, 0xb66c8908fad158ef, 0xb9198d6fe102787f, 0x5adf89dacdde9276,
+	 0xf42280ad576bfbd9, 0x2eef23c06c1f6094, 0xa2ecb8067901569c, 0x595823c88413b5c1,
+	 0x0fb773f7b9f70989, 0x3f0d472c05c2c741, 0x3af478b61298f4b2, 0x4ad461b554170293,
+	 0x11686dde4071d36b, 0x779a7904aa50f022, 0x35c33ba80fc082fc, 0x4cac5efd2a527ae6,
+	 0xeaa991877f4dd4a9, 0x4aa670e32a4029df, 0xd142669f49e9c9bf, 0xa274fc52c7bef18c,
+	 0x072ea4e3edb5aeff, 0x0310eaff01590bb4, 0x79af949560ea5807, 0x9b037638cff89503,
+	 0x73b60b70d8a422c0, 0xe65d107fc1385969, 0x5ffe3e7476a9e9ec, 0x6d254bcc2b4b1a0d,
+	 0x67b4558c7e060e44, 0xd17eba2478602b0c, 0x35b385df7c0cff6d, 0x463b867395a0c2a7,
+	 0xdf91e0156d7b8f1b, 0x74686c3817f32b1f, 0x4e89b66c931ea1d6, 0x105980a6b00c12bf,
+	 0x2a4dd6c7113c5d07, 0x6afabebe6fd2f66d, 0xca8cf939213571dd, 0x4e2e4f81b8f153d0,
+	 0xd0c37097cb94f9fb, 0xb24000a2d11351fd, 0x1f067653ae6848b6, 0xa3373b46644f77b8,
+	 0x7a474b3a84380522, 0x0c8698fdba8e7430, 0xe115c0b03cfe4b5c, 0xa4179aa8c5a6966d,
+	 0x1ddec04ad028b64a, 0x8d052de9d3bb4170, 0x63fdb6a6fff608db, 0x2e7008b3792cdbfe,
+	 0x4a8019d25e419ded, 0xd03ba5e90730c148, 0x8ea98e1ed5dd659e, 0x0db861defd1f755d,
+	 0xec7efb364fd542c0, 0x3cf4c12e39617444, 0x82c23ccfc3fc4003, 0x641f71df94caaf1a,
+	 0x62ce4a905356a1eb, 0x5b43653170d63870, 0x1507ef6bc9bd4307, 0x38d245fdcaeed3f5,
+	 0xa7be9fb2dea17cd0, 0x27c2127aa67650c6, 0xb67658e1e6e6488c, 0x35e3d077a8c3041f,
+	 0x43cac7076999c159, 0x1905eb1110b7d70d, 0x61f3926698b7653f, 0x01bbfdbc5b7358df,
+	 0x9ca1b8495b7f90f4, 0x8980de3900e59af5, 0x4f6914528918cddc, 0xb3c43bd7ac020dc1,
+	 0x8a3cd1d16152f35a, 0x32d825c7fc45ea7e, 0x72c1587e787a293c, 0x93e221048567e0e1,
+	 0xae7a28fbb2085667, 0xe3bfeed8a153af48, 0xbe2efc571ca39905, 0x4bb9983292ec65aa,
+	 0xfb83c0fbab8a8d37, 0xabe6c5345ea5a44b, 0x8c34618807875239, 0x9aae85fd3230987c,
+	 0x033b0150baa76df9, 0x8bdb8e9fdcd257d3, 0x5f96f591945d5156, 0x3009efb13c6e1a1f,
+	 0x6c50b551cd3cbfaa, 0x6af57c63789bd8cd, 0x7cb253cdfc2c0549, 0x58071ac24248be01,
+	 0x23bb9bcc1adbb994, 0x79134c770184048e, 0xc306f01b53af48ab, 0x0c4302bf9668b4d6,
+	 0xa70e9c532a243c68, 0x1151fed60b0d92f9, 0x2fc5977d00aa6727, 0x5f90a97e007604ad,
+	 0x6a34f64ddc60e0de, 0xb855afa4e4011644, 0xe53231791ddcf049, 0x9c11f4de721b2803,
+	 0x070b3c2cd1c7aadc, 0xfda8fb39e8889fed, 0xfc8f5d2f12a41d30, 0x4c5ca35c81116786,
+	 0x5595f05a42dffd33, 0x5d33959dd6a311c9, 0x6b9f3286ce503df0, 0x96c7839ef1cafcf6,
+	 0x0d68037c7262b381, 0x556b9abbe8fbc21d, 0x9440f4c89cbefa88, 0x472fcadae6884b7f,
+	 0xf01d15c4a1c13f41, 0x08d12ba89375d8cb, 0x4a4d5714c4da28ba, 0x018c1a9dbb79e6c6,
+	 0xc0cf138bd608a615, 0xc03f4aed4f747ebb, 0xfe3df4f028a8c680, 0x37c908acf6498a80,
+	 0x11a83d1c79c240cb, 0xf288599b7e8eec41, 0xf280d65be5f96dcf, 0x9099dd9b01020d05,
+	 0x04c3c318ab4c48e3, 0x384e4927d5fc955f, 0x0c0fa4a135ff92f7, 0x487b102f629d0d08,
+	 0x38124884500fe472, 0x1f9fc791d352c784, 0x61d2f9f7b32e9abf, 0x3ba5f8e79dce210d,
+	 0xafd2bca3bf31fff8, 0x34910cea56b5b29a, 0x375ca429cd1a58b0, 0x1c648dd13303862a,
+	 0x69ae5f390948ebd9, 0x4bb9a71b6a1c078d, 0x8551270c0a2c93dd, 0x2b46d2a854ac872e,
+	 0x5583f2baebe352f1, 0x9e5dec3d1290d0af, 0x0d62b3d844b92c2e, 0x0d821d95b7dbefc0,
+	 0x84bb8e0ff5fb394d, 0xbbfc0f3fcc313644, 0x752bcf625b1946e3, 0x03a2ceeb0d88c0b2,
+	 0x2f3569f9dd6a8d42, 0x7076d9da923eec2e, 0xa80c1dffe270305f, 0x62f61e7a537b3266,
+	 0xdaa818dbb02e0581, 0x9e3e21a631c864d2, 0xf22ba4e5dc857fa3, 0x24b3cbc01658525a,
+	 0x5ea738f4ac6ab473, 0x19866fa28102ef15, 0x33409c508f6c7d77, 0x05b3684649865c52,
+	 0x0397d38a351e9701, 0xe8b980d457596092, 0xa3cd7d3d43201999, 0x2317a2f40f4d2bdf,
+	 0xe286e3ef4fe0fada, 0x3d63b5794d0e56d0, 0x52c925a06b98b031, 0x5fbfcee1983b93e9,
+	 0xa38b0d575dc5fd6c, 0x4312b2746976efcc, 0x1dfbac886bac0843, 0x05cccb4da528c149,
+	 0x787aa365750ae3bf, 0xc19439bd6708c9b6, 0xe3b54140ec751fe5, 0x6062663d7916b88a,
+	 0x3596c62885f625a0, 0x4e0ec18ca04a6223, 0xf4616ea3db8c825f, 0x52070e57ee1a3cf4,
+	 0x70c93b4f1da91ac4, 0xb80a70aec6d3cbaa, 0x484da009aa7ad81e, 0x95f90d2f8ff27542,
+	 0x164e7ef6c5c5646f, 0x4909c6d0cf6df388, 0xd3ad207e22523363, 0x780d8ca37dbe7ac3,
+	 0x0e0397b9f3d3d4ac, 0x121d2e04e0b8e6c7, 0xebc66fae9945dfb4, 0x9c626484fcd43bbd,
+	 0x82822da1dcbd72b4, 0x7e8ca80f24d59748, 0xe76d3d3eca4bb8c4, 0x43625a56554faba5,
+	 0x27b16e5c0ea351a4, 0xfd0da454bdd842ab, 0xbe3206ce17a85405, 0x02eec4d52f29ab48,
+	 0x64e032af64e375d7, 0x6cb7ac8e715efea4, 0x9b2cde3871013324, 0xa1af6ba89ce30e28,
+	 0xd3325b685d8e78ed, 0x732ac01130e88a6f, 0xfe01ac22c689d0bf, 0x1054675d4495b42a,
+	 0x831130d261d534f5, 0x66d4daf3d4ad00f4, 0x24d00639c403056d, 0x01d2bce6d3a9a11f,
+	 0xac71dfa0133526a3, 0x3ce09f3f91538931, 0xb91ef2883ce7d5e0, 0x2b07010c3cbff738,
+	 0xe20482d357e60219, 0xdbee35386f6c6b09, 0xdf0c1ecfed91b385, 0x28f68825d7607806,
+	 0xfdf0eb523de2efce, 0x47570ef4b199063e, 0x4ac9d3f492e8d3dd, 0xb32487095934b90b,
+	 0xea2e6b4299429075, 0x783890712a001910, 0x6c145386cd537061, 0xa6f9f39638ab3d7a,
+	 0xf1ac460af47378e6, 0x97d11359305e0602, 0xb7418a5c89b7fb5d, 0x7c633178a149818c,
+	 0x70909252f3aba697, 0xbc2984623c18c12c, 0xbe05c18b930c4d0e, 0x02fda110dc16baa1,
+	 0x28e8c2f370b4e1f2, 0x5192e986947bb243, 0x6fccbc8db09adbfc, 0x604f26fcfb579dbb,
+	 0x8e76a6c1c9a56adb, 0x04aa4f4f2a483463, 0x95df45ce25275ce5, 0x98d65dade80d6b7e,
+	 0xf613f27a334c9656, 0xc3d9353b9d2c5555, 0xa5a43f0f54e64d62, 0x2cb888274c6eb26f,
+	 0xff612c0f98327245, 0x6dd4ed6c77ec50bf, 0x578a431f848bb0f7, 0x2bf7f0a16b686a5b,
+	 0xe7bca5876bb2fff6, 0xead10110cc28ca93, 0x10b6720d885279a1, 0x6d4f9c55e92a6ee2,
+	 0x8f1ee64e1e06c6bc, 0x08e6ad049e773196, 0xb7eb321bf3576bb0, 0x4557ad4853b98f0d,
+	 0x17fc8a00c27c65bd, 0x57c8b093472a40b6, 0x55bd0a5a32d9b497, 0x4eb78afd575eecf0,
+	 0x453c7f85c84e5b39, 0xf31119dac770fb53, 0x16aa613abbc3a501, 0x3f0224eda8874e13,
+	 0x27042b11971aefbc, 0xace66b429ad19819, 0xef586439dab5c212, 0x723f39699a5092d3,
+	 0xc5ede4b0a8e21ad1, 0x11032a497a562ab7, 0x543f78b7c1436135, 0x77323f21b917332e,
+	 0xfec98c401249772d, 0xf05328e30826af49, 0x3ab047f6b79e3f8b, 0x40c637b0c8de02ae,
+	 0x4fa29a2bb728db76, 0xbdd262a75529d731, 0xdaf77a8b050b793f, 0x1357c2fdcad840f7,
+	 0x0d47f591d3786ac6, 0x86067dd3792c5399, 0x5d24fc70cd56290d, 0x475eb027b97b8763,
+	 0x90a11e60477d40cb, 0x6dcfbe34b5d82968, 0x0228061221d66b9c, 0x1893e4aea03b3a50,
+	 0x2a0417c6d90d76ef, 0xe4ed246870137aff, 0x1fb55564f629f411, 0x969a28ff7c8aea0a,
+	 0xf600493a783afd0b, 0x18bd180a92cf06cf, 0x7035d5dd02ab19b3, 0x74d9caf9a44c758b,
+	 0xe9dd1c1d51623b9a, 0x697a54c7e08c4f38, 0xdecf876af91e8e12, 0x4c19baf6a3ef3edf,
+	 0x47d7427dbe1d3adb, 0x3eada60bda8b51d3, 0x7f1c949038a09408, 0x006d387db3c5a24c,
+	 0xbb75cff43cf928db, 0x2491025b0e83f272, 0xc8ffa656794c26fd, 0x1779cc8d13bb374b,
+	 0x20a08b3c61264459, 0x30047e16117ecdb2, 0x08ffe4b5d30f86cc, 0x08d6bcef3036fd4f,
+	 0xd52c9c96dae490b4, 0x36d7e8b472cd0a02, 0x143b47524a3d8bdc, 0x85a9a8690201057c,
+	 0xf420e601a7118543, 0xe27a14f981fb9b11, 0x4421f5a9a8dfb492, 0xb21b1b98b6f86746,
+	 0xdce371d77dc03302, 0x25866d65aa3fe649, 0x079fca8c2fd51529, 0x18f6c124b858ebf0,
+	 0x873d9f27166df57a, 0x19101c24bb80d839, 0x76f9fb12c7aa2cb6, 0xad912ba662510a08,
+	 0x927f99142c85c044, 0xe2feddb04cfda028, 0x7563b7e6d9163cdc, 0x37ef254d11f5728f,
+	 0xd8b8aa0eb9c8622a, 0x0a9bc96987cd9849, 0xfadb864a2dc027d5, 0x2d736b83202b6d3a,
+	 0x55c27c9c8856e819, 0xe44aa5d1c1f713d5, 0x6eb47c7ac80fd5b2, 0x299d6d91495c3ee6,
+	 0xc7aa487b6cadc4da, 0x664ac945b0b23b49, 0xa9e00f070dbcb476, 0x26f1eaee41c38538,
+	 0x64ab2abb02564e16, 0x167a25a70ed3d765, 0x868d8761a546a3d1, 0x9754257dd8105716,
+	 0x0f43769bb63e5bb8, 0x6db897c2e0877a75, 0x56643fbb317f3216, 0x482ce0ecd42fbc41,
+	 0xd297b80b0d5467a5, 0x99e1e9d02ac06566, 0xd6cbc2934300559e, 0x7c192a54ee993d7d,
+	 0xbf5af0617a1202e3, 0x9156d75485fa8be4, 0x7acba118d0bcb88a, 0x9c15035192e10e55,
+	 0xbb380665b000c4f6, 0xa0792f0823eeba2a, 0xc48e0f4813734fdb, 0x5395d985150e6c22,
+	 0x43694eca700d620c, 0xa53485b89b827983, 0x3b7037d146474ded, 0x8153d070ca33e364,
+	 0x41246486b03b083e, 0x0ee63440148ad73d, 0xf8bbd41905bd359e, 0xa5378ec3dc9188e3,
+	 0x48b800ece81e0034, 0x35cec7694be8267c, 0x5a2d643d277418e5, 0x07605e9d614a3e2d,
+	},
+	{
+	 0x5f443f5a149f94aa, 0xeb6b6e9b7613e317, 0xf4cd6d87cc4635c5, 0x4f3e13ee17dc0716,
+	 0x448d539a8866255e, 0x346e895f2a231dbb, 0xd61017bc1ed31538, 0x81370b94acfd3f7c,
+	 0xaba1d83900311e15, 0xdbacceb9890d48ad, 0x7b6e8b7e75bf818b, 0xb5ce5139478238f7,
+	 0x040c6605f9862216, 0x4f759ed88cac1e4b, 0xe81fdfcae672fbd2, 0x7be7ab962a10ed69,
+	 0x2963ba57f84bb900, 0x68e450a9721a8be7, 0xd1a3bf110d32faf5, 0xa3b5a98fe812ecdb,
+	 0x355a9579af39175a, 0x2aac883f8d5731e6, 0xc8b7149435031d13, 0x041afe06046c5c65,
+	 0xe4b07d454f377bbc, 0x6178ff38d1d0e92b, 0xbd7bcdbfa69a614e, 0x4bfe7268e01eb83c,
+	 0xb69a9387387e40af, 0x61f0d8d7235bb248, 0x3abfc0d597512762, 0x4c217ea0b419eefb,
+	 0x8b793e14d93305a7, 0x176330ed373a327e, 0xdf3967ac65e71124, 0xb1a5b0b43d131103,
+	 0x1e36f254da5308c8, 0x50856b4ad6268192, 0x7acb482ae071d781, 0x1d35c3e39926ddb9,
+	 0x73dc810881854040, 0xdda793863e411a33, 0x8edd002bc8f9ef05, 0x977bd46b802d6ec7,
+	 0x893cb30ff1cd8363, 0xb4a089798c553a2b, 0xb5a75a7fa1766924, 0x94cc5dd78a5c3d13,
+	 0x5d2ec267c55e3218, 0x32324ae237638e6a, 0xc3bbe6ec06856744, 0x909d43fa12f1e76c,
+	 0xa6dfde3b8e13b4d7, 0xefae1772f22027b3, 0x3e24b68c42d25f01, 0x36999bc53201bdbf,
+	 0x5a0b032fb59b17ac, 0x3ffb022357ea0e9c, 0xcec22d17606c5a15, 0x6e9ae477b3f10ea5,
+	 0x560863ff64550ab4, 0x02b244771ac72775, 0x7c5fc76a6f885afc, 0x697e596f4fde4279,
+	 0xa533444fa47394c2, 0x4ddc8e3ad3f8c6ce, 0x1a4e09ce4c9e3c45, 0x9f3f1cb62131a2c7,
+	 0x025993a5205b80a1, 0x1e72f823c0fdbb6a, 0xa164fa2667d98300, 0x8c9caebab4bf0670,
+	 0x6f5e578b9a7ec169, 0xb1e38aa0b2315a42, 0x05797d7e459d653f, 0x4444e5ad2a569bd0,
+	 0x9c473d4bc98b2650, 0x26b49b730ce168aa, 0x29d3ba9f89d8da24, 0xa75506d948065819,
+	 0xc6502295c2a06259, 0x3c7f33492ad83afb, 0xbabed1cef897d3e3, 0x869fae9a381f0a27,
+	 0xbcc28c54281d38fb, 0xadc0f7a20ff436eb, 0x4b950518eddc88fc, 0x0423e1b94fad9c15,
+	 0x84280845e4cee472, 0x8636a3dceee620f2, 0x8b18d29c2ae7531c, 0x6706e25e8ccd8ba9,
+	 0x5fa0046cdaf5f5b2, 0x26a72719fba60463, 0x4c93c7f9ac60076e, 0x21666d04dab51781,
+	 0x7b2fdd990ed608a9, 0xb536eb75ac96cc81, 0x2e2ba34ab524e174, 0x3fa8a58529f430d4,
+	 0x1f68c3beabd184c8, 0xf494a1c0aef273b4, 0x984c3b40efeef9a9, 0x3a267e2a6113fa13,
+	 0x3af09a6f9ce417c8, 0x9f4e5445d6a38273, 0x9d9e3c4d50b4558c, 0x5642d7e33dc5fe7c,
+	 0xee64d4b097fa8361, 0xab0462b97f63623c, 0xfc25e9ad4833e405, 0xa4fb898f26e83c94,
+	 0x9b9855520848a490, 0x4d9a0ae6766d4387, 0x6e9fc7c41e540a6a, 0x201f34c36c1772e4,
+	 0x9a11d1b16f2e787b, 0x6fb5a5f99568a2f4, 0x5fbdac243d40f842, 0x95091d387590bdba,
+	 0x2410cf4366ec16e0, 0x7ca296414895126d, 0x8eeabbaa1df13883, 0x78e9b9d6e7d82e1a,
+	 0x463e3ffec61e6613, 0xaa7588c4e0744f5d, 0xe6107670794e0353, 0x42dd629a177a742f,
+	 0x5827e007eb0dd2bf, 0x2e0a49602e222243, 0x5cf70413d018a8cd, 0x2df4784b3f9704ec,
+	 0x5fe257357bdd3cbf, 0x8d3570c6a27b3bf4, 0x32b837a365643bf9, 0x535e4311948d0157,
+	 0xf1a0940219f4d853, 0xc8be908aad059529, 0xe17a0baa00b99503, 0x6454b6b2e996a98c,
+	 0xa32773144858f273, 0x33ee3a35a8c05249, 0xd5492b5aacf98cfa, 0x77dfbf73c707c32d,
+	 0xb9ff8a4113aef8fd, 0x5c3e5704203c557c, 0xf3aeb2b586c1bbeb, 0x57778d4fc9c55d0c,
+	 0xec5077c0699ca412, 0xf5d6bb336780b73c, 0xb57b341769172bb4, 0x7364c8aac833b5d8,
+	 0x965b0d745d6da9d1, 0x0edb812d6a81c2f5, 0x82fc13c75aeb5ef6, 0xa8a04705dd95bd58,
+	 0x5190c62054fb7c6e, 0xe1aa2994dea56a53, 0xcedcaae707472c90, 0x1c55734421c4e307,
+	 0x15ea4fcd06043741, 0x8f62e4860bc78ef5, 0xb85ca321eff01cad, 0x3a536d94c6d0ecba,
+	 0xe6d51b6e247bfb16, 0xf5437b9e15ef3b8f, 0xbb0845f11d54d824, 0x567d3a5239d3d6e9,
+	 0x6e6829525e1ed0e1, 0xcaef19ba3b13f527, 0x89231185f0e1f5c0, 0x6c40e885d5d852db,
+	 0xe3c3f9a5cc007794, 0x12b644380ba74f19, 0xd883e3257133f871, 0x2a7ac9fd575612f6,
+	 0x977fca6377c29e6c, 0xa2311d89735b587f, 0x382595ef3d9870b2, 0x8eb41d03c3d9bfcb,
+	 0x6b9e8cbaa5a92379, 0x05788276f208af00, 0xb0d8723a19a0aff2, 0x4444e3dd24672cf0,
+	 0xdd52255ec507697d, 0x8c7ae9c9589dbb17, 0xad332343f37b2e97, 0x924b043e1c131db0,
+	 0xde083ba0a1441a90, 0xc27c917d3d2c6e94, 0x4cf2b96cf7198458, 0x404dc590810913a0,
+	 0x3102f60b43a46473, 0x2201ce49526ef420, 0xad3d47186856f092, 0x615208ac29dcc86e,
+	 0xbd47ef83462fb066, 0xd06868b85433413f, 0x5bb607d2c99eb20b, 0x3220400624e14885,
+	 0x522126ac9ec390b7, 0x5845a249bfdfd45b, 0x6c37e95ceaffe7de, 0x710d12d7d90d7a4d,
+	 0xa33cc4d99c255eb4, 0x046a7f3dee9ea9e3, 0x566df6caa9302b30, 0x3b7ba0a6f5faefe9,
+	 0x3f971675b117b711, 0x2d6c897154cbeaff, 0xea06f167d0030ff3, 0x26972d7b542dc6bb,
+	 0xb7503e8485c8a904, 0x4547674c06f52637, 0xdf96874ab6aa97cb, 0x94ec94d134ba8d51,
+	 0xab12523a66017be1, 0x6a5a0891beb589ff, 0x5b95fe3b65e43fc1, 0x20755fbd93f68092,
+	 0x444fc62d7a13b0b7, 0xf207388727e8af11, 0xeab80b78616bbaed, 0x7c738fe45171c14a,
+	 0x0de21f7764eb936c, 0x5f2f6ef3357c6294, 0xbeab11746eea15fb, 0x8225368d1a5128d4,
+	 0x7b3e91c48592c1a1, 0x496d2bf1020ad4cd, 0x3c1c12543d851fc4, 0x2f8f1e2a080b36cd,
+	 0xdab3413e2acae8b6, 0x0b18c9bc6a350858, 0x6c24cff4c35d5b63, 0x4b8fb8427e072b5b,
+	 0x868ed1b39d07038d, 0x116b0400236009ea, 0x49709cf7219fe4d5, 0x288409fc5cbb4219,
+	 0xbe3468f9c3066a95, 0xba17a20d68d9ea82, 0xc42feb5bddc51cd5, 0x1a9f3b62b6448986,
+	 0xb0871248f8bd3a0f, 0x0971b0274c8f73ce, 0x0aad9701fe824e75, 0x35878f3ea6049d73,
+	 0x8df7b99f9696a532, 0x9f74c76267f7266c, 0x797aa17c91544293, 0x12866e3aa0c31374,
+	 0x11c14629c0fdb810, 0x8c0b8078868dd4c3, 0x0f925ede3a44502e, 0x1c2ff964c8005c15,
+	 0xdc3bdb456da9bf2c, 0x3607e77294d1f32f, 0x0f006cfa698966a2, 0xa329f4e88184b4d1,
+	 0x6fe0a787f11ef54b, 0x741f7e9a5fdc5a83, 0xa48799a3195fcb53, 0x344f4f5cccee5b2a,
+	 0xc3d8c6f6b563c9fd, 0x193b4bebb35e6711, 0x7748d43046f57f4b, 0x879145e50685161b,
+	 0xa57a6637fc5547fc, 0x689f777a7910fc1e, 0x437e03d4f2ce9ea7, 0x5a0cfa592a415c8b,
+	 0x045c5c4c682093dd, 0x74fa5612fff0c8e4, 0x2702968977203f9f, 0x4253a448f5a5b27b,
+	 0x5e7181cd020e8134, 0xc0c2ae79213f2151, 0xf5574097fe96f67d, 0x3ea27cff905f56ab,
+	 0x3e204e45e4ac678d, 0x67c7f6ef3dc7b55d, 0xecf1b78bff796368, 0x887d784b3d74abd7,
+	 0x02fe31f173ea47ee, 0x14ffa9a5108078e4, 0xf27c23f5f4e5d435, 0x8b2e8bea698786a0,
+	 0xc3b03ff0c60cc9e7, 0x3e4dfff9886bda03, 0x7b830ce324254599, 0x68f201b49742a2b5,
+	 0xaa19902bc41625c0, 0xd881d5ab9b7ee4af, 0xd3a7ed7f5ab79794, 0x403f7ade5adf96b9,
+	 0xb25c582a05082c79, 0xb7296d9b14d875e1, 0xd6afa590bd54359e, 0x3717ff4dbcc646fc,
+	 0xd0c2dd7aec28a9cd, 0x68f6886940815ca6, 0x690f862a7db7c1e5, 0x5de9b4f46cd45787,
+	 0xab6c83b02a616434, 0x6e9b1b8442fa0506, 0x5ef8f105b2510725, 0xa08742956849e8ac,
+	 0x88d46d4cc4182f2a, 0xab7bad38098b7db5, 0x8a5fc262d0a41cb2, 0x0a5e3a847849bd5a,
+	 0x5845cd3c84ae3861, 0x21ae6d817da9166f, 0x83bfb46f1127dc0b, 0x904ee8ca20cea94a,
+	 0xa65a1e105f1101c0, 0x43bf3b37c9f1a5b5, 0xae1a21099204f5a3, 0xa1ab2f6037599ae5,
+	 0xd6299cc0279e82b1, 0x5b602fc94411aa9e, 0x14e2ccae9853c7cc, 0xb157b0750cb53f3b,
+	 0x8d36255146aac4bb, 0xbbbce4ac12291701, 0x26ccc0d9a11b30cf, 0x9bbedbd6fedb4e6a,
+	 0xf9ab329594a25e14, 0xc514397dbbe603f2, 0x6109fb0169598af8, 0x77ed1d651cd8d5f0,
+	 0x4c1a8f5b3d846131, 0xf95788be4ecbf192, 0xd8579eb4a058beb0, 0x7b0103eace9e9eb3,
+	 0x8574c120363206ce, 0xadd15944da827ee9, 0x5772107c7f8f445b, 0x206675501d892bb2,
+	 0xd79557dbf3ac5517, 0xfe2c78cf2022b3e7, 0x209797b5db3f0b0b, 0x2e6331c2d6fc38e1,
+	 0xd2c2a9e95e05b6e7, 0xcc0757509e12075d, 0xa9c2c63d72cb2b0b, 0xad48055353723dd2,
+	 0x0bf0e6ffcdae85f9, 0xc1ffeca196f5e2e4, 0x4990e8862bcbcc4a, 0x618652fb670f366f,
+	 0xed8b77e45761be5d, 0x1a64ce6f149d10b2, 0xa544785274822d5b, 0xa9f418c8456b6d80,
+	 0x897fb837059c0d69, 0x7cfeb88fba12ece5, 0x8606d75ea88bab10, 0x4d0cf7052f3f5cdb,
+	 0x56e4664f82536e2f, 0xefecb56a1200a279, 0xc05ab76dfe4e3f15, 0x380a3e0a54867622,
+	 0xa2133b38f4079066, 0x01049cbf77a68e32, 0xd9638b49f36d8cc0, 0x89569d0e7eff8291,
+	 0xdfc6d8bfba9cbce4, 0x0a243ecafddc2ebe, 0xb821f0d17892b9d3, 0x809e61d97deb8249,
+	 0x688ab07691f5dba2, 0x4dab9b5543d9b5b0, 0x905319b712364af1, 0x118d3b209d2ab21b,
+	 0x6790a64cfa4d7c37, 0x735eb64e4a46c3bd, 0x9cfa2363e879b3bc, 0x6fa24b40d5265fb0,
+	 0x4378058229a1e071, 0x3bb29666e31c5d03, 0x86a33cc19f435fa2, 0x94e3249a46c353e6,
+	 0xd3e62bb11a6884a2, 0xeff228d000c6e9bc, 0x50bbb6a636c02688, 0x805b30bb5a76f163,
+	 0x2429e3d8183182ea, 0x5d5651324e007e0a, 0xa8c3b7edf5ee35da, 0x105c5cb17c464b36,
+	 0xe312921249a53da8, 0x4e1110ed9fee135f, 0xb9e487c79017bca6, 0x7bc3a2730650ff71,
+	 0xfc460338598f1c8f, 0x0274c58de15e18fb, 0xc744a3df0372c632, 0x0971d35a2401b9f7,
+	 0x5b5a6c99d484ccfb, 0xab817e70f723b4cc, 0x2c7095d3832a2835, 0x81e8424b2440af7c,
+	 0xec901e3e2fface24, 0x9ad31a6dac732be4, 0x885b5b312ae20980, 0x386b57224a9411ca,
+	 0xab920bc04efdfc72, 0x98eb3657727c56f7, 0xbf5cc6ec22e95dc3, 0x0bd5a221f2c8bf47,
+	 0x3a72926b1843b0b6, 0x8575162246bdc8b1, 0xe150aad3ddb18f1c, 0x6da41b5e6b617fbc,
+	 0x8f2b999d424e2757, 0xe505552311b0799a, 0xf9a3d1e396cf0c14, 0x62f072588b7cc94c,
+	 0x0f85382914e7dad8, 0x7fcb83bd656cdb1a, 0x3f110e043bf3c62f, 0x4bd9196452d4d82c,
+	 0xa838c4bc60a1e64a, 0xe3c47b5c30c01271, 0x565d95069d309090, 0x845fb3d588da6a54,
+	 0x19b45d8f903ebaa0, 0x8faf08f76752cf7a, 0x40dc48dea3d9dd6c, 0x004ddcc4417d25ee,
+	 0x98870c2d31af58d4, 0xda15d95a8913bb1b, 0xc053fbd849c02c60, 0x1170be39e94007ca,
+	 0x0bcbc08b6b2e6fda, 0x8c952931e4261bba, 0xdc1522edb7ac06bc, 0x0c3a4df9d9855b23,
+	 0x7831dc0316f8be00, 0xbd43525d39b5bd14, 0x66dbb46c0c0a6b5b, 0x65228e91c2221848,
+	 0xa98fd5e48714f4a9, 0xc905135d45103375, 0x7f4f0e893f59a0b5, 0x152abc6c268870f7,
+	 0x4fe3a459267d9de1, 0x42c53deff3d5102b, 0xdef28cd69ae5f833, 0x80db0449c5dfc6ab,
+	 0x77ec55ad09d2c3dc, 0x92ebaed9e28f1771, 0x44f3263693641422, 0x4eb6ffacf9883a1c,
+	 0x39ea4e1c82223300, 0x5865b59d2b1187b0, 0x2233f780c4091b6d, 0x05ac9cf5923fbf86,
+	 0xa455e4122361a758, 0x06d1a3ad16b1450d, 0x4f0b83f5994f8230, 0x06b83621703bb43c,
+	 0x20dd6683831b3a96, 0x1631ced2c39a423d, 0x14ab292f2b01f1be, 0x3cf45eb0314acf8f,
+	 0x614c36483c349d06, 0x7ed41f5c1e3eaf1b, 0x55e449edc6eebb4f, 0x6fd2ac5a21c57464,
+	 0x4de4f9d2d79cb7bd, 0x18acdbf90bd3a591, 0x07ab4c047519ad06, 0x17e630a98d099d46,
+	 0x597c07b3225447e8, 0x5c79f4216db78d7a, 0x8132306a00ee7d77, 0x90266bf5ebaafebe,
+	 0xa838b4b2ccbc5420, 0xf2c608072070564d, 0x65706cbf3408558c, 0x7885d05d04284b9a,
+	 0x4be1f9f51e2f5b0d, 0xa86343c827130747, 0xb272fa223372bafd, 0xb63e7e4ff9c7f6f2,
+	 0xb5b728298d3a1816, 0x1e847b78d89784a8, 0x9282e7e8ea70db48, 0x0fa4f2f65dc68d40,
+	 0x9e799a1880ff8c27, 0x487b9485a14d275f, 0x8d3cbb08e31cf07d, 0x994d01f630c748be,
+	 0xcce655c8d6ba0f65, 0x2eb24f990d4e895d, 0xbbd0763cebf2bcf8, 0x5977eb473189b76c,
+	 0x552e5378f278a52d, 0xe34c6552ea0eb2b5, 0xe6c8bef616f45139, 0x30e4e0fac79558a5,
+	 0x2973b04a982d569a, 0x37a596733f2a2ba3, 0x91bf980f43ae3fa5, 0x06553451a9136ea8,
+	 0x53b3f1bf985872cd, 0x817669938fca6a88, 0x7e29b12bda03eef9, 0x55cdd12f86910ebb,
+	 0xe47e88d0c7874062, 0xa38936b0d3d690f5, 0x55b9a763014b0864, 0x22e77b1c67263bdb,
+	 0x016a61a00755eb30, 0xd496d33d3e344dcc, 0x98a8ff7c8f10e866, 0x24e520afca672e02,
+	 0x0d6b5dbf5d7f2ca9, 0xf076c002ec6a490e, 0xad2919af8b2d0c5c, 0x6170449ae0e55984,
+	 0xd2602b45db90453b, 0x500c254891513b73, 0x98f45cb1f29b2cd0, 0x36fce2a4924834bb,
+	 0xb3c1631b6bcc4158, 0x619cffb5f13ee5cd, 0xd70045c64e0ed605, 0x7c9cfb248506ab0f,
+	 0xd9c3f2b40fa13b83, 0x8d468a14ce51441b, 0x9919cb4a154ee668, 0x18bf1481424dc527,
+	 0xbaa94a47825908f9, 0x3142a73f49f4517b, 0xb4903a5aa51d89a3, 0x3e66b79bfda2bbc8,
+	 0x9a35dfc8f596019b, 0x90e8e6f145ae0fcb, 0xc7f77d9dff4bfc3c, 0x8f499ea8c24c69d1,
+	 0xd47440a7af8a53d9, 0x398359a849f08252, 0x1ab9f8903ffdbf4e, 0x061f5b732586df13,
+	 0xc4db70b9fc47594f, 0x8ca49483b252c8d0, 0x3cee2abccf16a8b1, 0x4167d2134c874521,
+	 0x465c5dcce52ea32c, 0x4271c63b1cba0d5e, 0x64725b6bd0e78337, 0x0d17a36b41564356,
+	 0xd420f2e4f2852dd3, 0x954324771dff8f34, 0x253203cae7f16c15, 0xb05329d7f925c6a3,
+	 0x6a5bf847ffe789ca, 0xea99aa3adb383c2d, 0x98cae960335222d0, 0x93ce172eba13e337,
+	 0xa18d36457eee5f46, 0x4c9ae28ad6f3d535, 0xe21ccf152ebb3365, 0x588e70f4ebd3a494,
+	 0x06ef23730ac1d32f, 0xcfff8087bbed9402, 0xdf2c30b4e141eab9, 0x4455a2430056fec7,
+	 0x0898222cddac3a6f, 0x3cad4a2ca74ee34e, 0xf86bac9d3afe583c, 0x1ac02ab422cbb063,
+	 0xd5a8f0d535b6fe71, 0x4bd4feabfe051dba, 0xdf8338ff6066a215, 0x75ff3be8eb93a96e,
+	 0x75ca77259c565021, 0xf35a8246a0b46f12, 0x5d27d6d7e2301026, 0x4e75767d7c7d09c6,
+	 0x2e056ac838f6ee00, 0xc1efa5792b2d8d28, 0x7106d8b8378a59bc, 0x09000594cd2ce0f2,
+	 0xf6a6f5ce61e4ef17, 0x7dc14a785e0be3b3, 0xfda05578a90b8c75, 0x07e78c82c38bc242,
+	 0xb7093a23fe49b6d6, 0x341a2fe48e0a58e6, 0xfa1577a43989607c, 0x15fcbdb8847a14e8,
+	 0xe7e5dc519b5c3cdd, 0xb5759ec6e423b027, 0x82f3b30110ab2dce, 0x75faa5f03e53c5e1,
+	 0x78202900556d93df, 0x138464170ab0c775, 0xa6596113b134c04d, 0x5ae50e3bed07a5de,
+	 0x3fdc8262d5e3ebbe, 0x40a9d74e22514245, 0xc9ccddff209dbdd8, 0xa5e9c27e2f20e727,
+	 0xbd1f18b7fdf757a6, 0xb7b32fdf7c9009fe, 0xc561a589bcc2376e, 0xa21571cdd81d3196,
+	 0x7c9c48fa20618583, 0xee3ed1afee362f4f, 0x4686a46a028948e9, 0x72940f5b12290698,
+	 0xb9effceecea19c57, 0xef7872be7627342f, 0x6fa6e68679b50173, 0x2e7678081fa0c787,
+	 0x79032fc70f6b7f27, 0x2e5355fd7dee9519, 0xca1adea30b9b971d, 0x18595fb176ff92e2,
+	 0xa4d088fea267db32, 0x546fac7d22a5d274, 0xa3b3923168f78ded, 0x3593928c2b23facd,
+	 0x190336232b6121f0, 0xa10df5a8f13b1e82, 0x5346be10f8e0b036, 0x4490b2cb7054a87a,
+	 0x449ba75ed99d2331, 0x17ccbda2f0f1f181, 0xfedde6132e92d6ef, 0xb23fa4001ec3587c,
+	 0x5874c8aeaf11bf9b, 0x71e6366898c58630, 0x4f2662b3392df438, 0x7a5da3efd7e2f186,
+	 0x575df8132c551e27, 0xb26cf6da32cf7c42, 0x672c0f7a98f91c7f, 0x28f44ef5b2deea13,
+	 0x141875966aa870c7, 0xcab144647e2ea42d, 0x75253800e883db11, 0x92cff925efd140d2,
+	 0x17d05f6f2b2bd3bc, 0x49738a4301774c02, 0xe43c65d6db97b615, 0xa50143c0815dc2b9,
+	 0x1c6a4f34c27f163f, 0xc7a35a084e14bbb7, 0x41892f9f134bc6fc, 0x7c5e7af92da46bfd,
+	 0xe8d56d1daf53491a, 0x6e1f6e44bb309ef4, 0xb536f2da8a95b47c, 0x30c335c6a6b03b3d,
+	 0x54bc7264ba2b6df9, 0xd1e7246b7440c488, 0xbc8984748df25f4a, 0x74ea3e2ab93500fd,
+	 0x444ae273eee0fdde, 0x3556a43d72ff0592, 0xa831bd42c9a02d00, 0x76c11c1cd4bd8e8d,
+	 0x8e63a666f546ce75, 0x543ae48f9bcbb0f9, 0x8ee1afc56008a637, 0x71f69467571e8374,
+	 0xbbced64753011a25, 0x17153dd04ce0f913, 0x203466dcdff44d5a, 0x7ecf8e30393048a3,
+	 0x7517145658efc9bf, 0xc11e38b332ae1893, 0xe38079c95d32e200, 0x4afc879ba1b3e164,
+	 0x331655ee6be1e5bc, 0x0ebdf07bec357320, 0xaf65ff93d80a4fec, 0xa90fb171bbe960c5,
+	 0xbb6479c6ad4fd5e0, 0x7da11d7aecfae600, 0x36d1388f2a615645, 0x9318d3b473b73884,
+	 0xc2aa94c362a5bf99, 0xaec7b37ffc524e14, 0x0e05635cd100512a, 0x80c7570f097cd039,
+	 0x0b7213da1a0a506a, 0x25cd927d8930679c, 0x5922216a1b05b548, 0x1f2aefd68e32d682,
+	 0xce81a04971f31083, 0x95e00d857e83cb47, 0x541097d9d9dde577, 0x983e0ef46ae1ac17,
+	 0xb084e3378a2ec510, 0x6f9d69956d80f68f, 0x9be35ae633a98c05, 0x21fc2e0f28c4769e,
+	 0x4e89808b5ab1f056, 0xcd0d6934f004fba1, 0x39de4897b531c2f8, 0x0035e114cbf28f02,
+	 0x176ca415e6b1fe62, 0x9f2d3eb379b6a80b, 0x442ae95814209a06, 0x5a213beae6e4f4c8,
+	 0x15227ed8e843b9e8, 0x7500ede8c8cfcf0e, 0x4c3ed7dcdd60ef0f, 0x03587c36ce1a78ac,
+	 0x03ece66af19fd18e, 0x280ce0922a73095a, 0xc4145992ce47ebe0, 0x00626a545a10a585,
+	 0x2a15200547da0160, 0x2a291963783ffa14, 0x832d88402dc6fad8, 0x71196fed899d3e75,
+	 0x03f08ba53a904780, 0x7a1521e237d49cf4, 0x8c1750886643f469, 0x9b47a0f8cf60483f,
+	 0x65feb2f1f3a684ab, 0xbb2d67f9567ef2d9, 0x6ccad7a7ef4e4474, 0xa85cf3f739715e65,
+	 0xe6b7fafbb571bc37, 0xbf2c73ef20cb5e8e, 0x728f70c6c327e3eb, 0x9cdf1ea9fc6a8e00,
+	 0x6923302abb7829f3, 0xa22c0ad093ffa9ed, 0xbdfd459fe4239ab2, 0x5fab119d7f83ef69,
+	 0xabd444796fc0ed77, 0x1111332e0e6970ce, 0x18a351abeab5b1e3, 0x42bc61453dbd3d2c,
+	 0x17b6e1eeaaa5f6d1, 0x4780b047263a8de1, 0xa598c5678536ea27, 0x3a3289d6892ebb31,
+	 0xe96fe4b3dfd9fcd3, 0x9c85de5ffc73bcb4, 0x211a3133df312ee5, 0x9bf6e7c79fcb77c7,
+	 0x40bf1e7b0c3e19a3, 0x2eebb4fbafe7b734, 0x00af002e3260f92c, 0x66869f1316227fee,
+	 0x2c50b11109478770, 0xd7570cdabd12790d, 0xa710a9a9e57b3654, 0x8e2e45d06ebd38a1,
+	 0x6028ba9fa1fbf7a9, 0x35162a09b40dc942, 0xc0dc9926f9280b00, 0x6789f594806bcd56,
+	 0x698bab665695124b, 0x8329c373cfc8448b, 0x67fce684fc3cb624, 0x7c43779e4dec5513,
+	 0xd65ec04da6407edf, 0xfc7399b9d9462b7a, 0x1fcd04568ae5c0a0, 0x55aa23e4742e96d4,
+	 0x0b57be8dfbb819bd, 0x4e60ad67b3227874, 0x667d0d0be8bf3d28, 0x796e0e592ab0b531,
+	 0x1852bcc56294c5a9, 0x5a065eb361983620, 0xf25d63f5704c0791, 0x8addbebf615009e9,
+	 0xf02a06063bcd3104, 0x20278f2df4664649, 0xfec8a6bae7050260, 0x37ffb8445a1ec185,
+	 0x2df252e16ad12293, 0x14c6220cf51cb3a8, 0x63f39c97ad18eac9, 0x17ae9b7fd8ca8273,
+	 0x82ab3fadd6b1d715, 0x68e4bcacac9b9150, 0xb99c03de6a27027e, 0x22c84be738316fb8,
+	 0x1a469408bd65ea18, 0x8968373a0d73ffac, 0x001014e3197cf316, 0x07bd38f7475398fc,
+	 0x8658b406d2dd54ca, 0xf510f04dab2f7f77, 0x9d394ed4b64cec57, 0x5a92c5e5c37da540,
+	 0x1ee91b5b2a23234f, 0x81c5587da6118aec, 0xd02c872a32c3f59d, 0x3949afc5c507813c,
+	 0x7b6d606aebe3f070, 0xa17d7fb28316702e, 0x14bf4e4d896a364e, 0x5a5ebfda1054d722,
+	 0xa991f05c8c165dc0, 0xb37db1b493a7e327, 0x7c211266b730713e, 0x02e194f1d7f52667,
+	 0x4d724697985004ff, 0x1ed659e1d5522468, 0x88d6ff12e6cca7d8, 0x65e35ee9ea1a70c2,
+	 0x299b1d7a2d3cdede, 0x4faf11912984a94a, 0x4e5b849ce6531438, 0x001a999d503523a2,
+	 0x4c34b24f2b84a6af, 0x4917871f3731f8e1, 0x52490eb9933d6166, 0x0926c8b62ea0c07d,
+	 0xaebc8733c73c4473, 0x18c87dc5fc9fba86, 0x59d8d4b31a572500, 0x9d59ffe16b1c1d0b,
+	 0xe72cd60eb12742eb, 0x90fa7e04b4d7e69c, 0xce86c6f4c5a401f8, 0x0d82d753e964a42d,
+	 0x662fb38a8ae6c961, 0xb7e8e84eb31ad0ad, 0x8d1a212878ccefc9, 0x913e9b9fdca53c98,
+	 0x69442488d45aad3e, 0xcd4d83d0b81e796a, 0x8da0896b1f196c43, 0x5cf34faeaaa669a2,
+	 0xd7957921b0e9c4b8, 0xfbb9f249a1419435, 0xeae1e0eb3ebad9be, 0x907c6836c629a5f3,
+	 0x6fbdd57a1ca1cebc, 0xa018ddec03d4fffc, 0x4b9bda3c8bfe3d82, 0x8bfc4fd82c10c7ff,
+	 0x60a26a7b4788c4e6, 0x766b7954009aab65, 0x21d990fdae860ffb, 0x258545cfb2afa127,
+	 0x28c57d025ac7f317, 0xd6da03ff517f3ab4, 0x1d9133c6be6671ec, 0x0d5eba68db8b6dc2,
+	 0xe1bc0c5edb69e758, 0xa5089c635c7d473a, 0x33f4125598a7c125, 0x5094221302ee8a2f,
+	 0x9a2e5eb103b3a5f6, 0x96ac52919c0d276d, 0x38fb59c59d8b040a, 0x19159ef86a8c3285,
+	 0x99c101a04fcbb251, 0xf46bb7aba39f8c25, 0x266f33b0c16f7fb9, 0x6f44c2c20ef49821,
+	 0x419940f757039fa2, 0x8e686551b606a1a6, 0x450b2c637e15eb79, 0x61eca86f0622b4cf,
+	 0xab648089d3886c10, 0x605b7631cdcdfcb9, 0xbd3d7665306e629c, 0xb62e5b781bcbc6ed,
+	 0xc5405c5abee2707e, 0x1165525269710adb, 0x545963524021a595, 0x1de64e3f2382afaf,
+	 0xdde970ca1956e431, 0xf4ae07e90d07cffb, 0x65b329db20bc25e7, 0x6aeb913d28f861e9,
+	 0x47ce7f547533e91c, 0xb359a719033b8a52, 0x85df12086195fdaf, 0x17014ae5a5a9b4a5,
+	 0x01c363f277737e22, 0xf8652a06b944f209, 0xd64459b31bc23c1a, 0x678989a7e2f1931f,
+	 0x1d23b5ad6db8bac2, 0x2301e9c74322a016, 0x8d8b10f2d8e44a78, 0xa8b203ed90472f08,
+	 0x0c4c1e75df5bb38e, 0x50a7f3be7d12f400, 0xd5c0b0ae6c11b68e, 0x7ed6a2c76d0a385c,
+	 0x28875f5acd3b5236, 0x8cbd12e804a6545c, 0xb6f5348a1aef5546, 0x37891dc3f20981cd,
+	 0x0fc57fd491896e9a, 0x688fe71ba25062c4, 0x3a7a250686a56b6a, 0x0668ec0e8d4d3034,
+	 0x8b1bbfa5638b6432, 0xd9f78d59b8ced414, 0x3d532e7215bc7441, 0x7897e60ca11da135,
+	 0x4ee0aae71e1e1639, 0x885b0b7799f06929, 0x16027cb2049d12f8, 0x2b2a55408c46d9de,
+	 0xb6f40f01da5b71cd, 0x1835e9effbec7c29, 0xf5cdcaf82381ee3d, 0x0b86796d4d7d0b0f,
+	 0x29d9584d73533381, 0x15cbfba144bbc340, 0x0a6f7678bfc0c1ff, 0xa9433a863b017a9f,
+	 0x5ae4149ed3f89469, 0x0f5316cbff111b68, 0xc186b797a039bce3, 0x863d2063abc752c0,
+	 0xa7b347780dccd11e, 0x4719644f1c9f5346, 0x23104bd168bc1f95, 0x556318f4fafb67df,
+	 0x162a35748d76ffd7, 0xc0c54f6226b17c31, 0x6f9f908826843f49, 0x10c6ede611bf2076,
+	 0x0bbeeab70c5883c5, 0x4ab02dd648b2480c, 0xd2ff99bccab30fa3, 0x2289705bab4eefdb,
+	 0x633fde41b593a8e4, 0xdeead0d0e977a139, 0xf7159e5b97cd83dd, 0xada9640224e74112,
+	 0xe1194a9a90c10407, 0xc505a61f30b0b0a9, 0x335d47607215ccea, 0x5d24efe534c0813c,
+	 0xe38e6c61f23d56ce, 0xd1995cb549c4cf49, 0x6ea98b6d69e848a1, 0x80c12d38aed25199,
+	 0x0762d9c171debf18, 0xdcbf89f2f91bf65e, 0x352f03e82962ec67, 0x249c125e59d48b94,
+	 0x633262d5d1ecb303, 0xb9d6082ac6b6b97b, 0x2066ac1699df1a6a, 0x86364c700be57905,
+	 0x66b5466adf7730b9, 0x04592200851fbd24, 0xad9b01c66cba168c, 0x5d587b33dec1e40b,
+	 0xa45f56e7f516eb7f, 0xb72b64d5f6aa6724, 0x549577fa474e15d3, 0xabb48dbd5bd4a7e5,
+	 0x35a6e0eb8b58184c, 0x290b2d1719c6009a, 0xb2b63da0e3989218, 0x7913b1dc3373e4b4,
+	 0x41553c98e0a5f37f, 0x31bf57ab52d247a5, 0x080e9e05c72da2af, 0xafea05531e3882e3,
+	 0x6ae01336102e021f, 0x21873a89da224047, 0xf9453a846eb8daee, 0x54921999c2a2d845,
+	 0xc8fcba2e8e6d5cb7, 0x6f7765dfd8ce6ceb, 0xfe6acd9421a490b1, 0x2058d39ccd3e3370,
+	 0x12dfe9ed855bef55, 0x4f5509ff15eb4131, 0x459a13965a1cb0cc, 0x210b0be4bedc518c,
+	 0x6021bcd7ae0b8023, 0xc8218cffdeca1056, 0x93913dc15f4a1a94, 0x70d339baf5059416,
+	 0x6153a22704515498, 0x6d0ff9176498a597, 0x4ab758c86d5d109b, 0x5fe609afd8b1bbe4,
+	 0x265653613610eb1a, 0xfa4d60a5291c0a8f, 0x0563b22e8e7f89ce, 0x4b247d0660b218b8,
+	 0xfd43160fd2909a53, 0xb6afce227cb4413d, 0x0dff9f7f3a876905, 0x3428d0ed54401edc,
+	 0x487877a5dd649e28, 0x23d3d08c106a4acf, 0xd5734b87442d0b57, 0x3ad88a6122da0c7d,
+	 0x256efe1c8f9bc776, 0x255f7d8bfe7b54b1, 0x2d8eb828d2f81f65, 0x18b27328c76f12ae,
+	 0xd7b0bf3e34b53478, 0x324b7f54a51f0ec2, 0x66a072a35ddfff3d, 0xafd54cc441ab6d4d,
+	 0xd98e1aa3f4444c4c, 0x22debf7bec2b90a6, 0x3c9f9aedededcef6, 0x40abc774114320dd,
+	 0x3fb88f39a2bb45a8, 0xe150cd5d0fc7aba8, 0xfba795b6dbebef8a, 0x0c12053eb491557b,
+	},
+	{
+	 0xbf4c860ddeee1781, 0x571fb6eed4f0eca4, 0x283fab171e0c2480, 0x999ef7827fed452e,
+	 0x6fa24e2d061ada4c, 0x8119a3db932783dd, 0xa9bc269b69a479f0, 0x66ca0e85cd9f96e9,
+	 0xbfd62609f59becb0, 0x7fa301d6944cd543, 0xcfa68c8a96bb9bed, 0xb11d830a1e265983,
+	 0x276c42e2ce9dd591, 0xc969a2368d0e1121, 0x71128f10abd434e7, 0xb272295b7874ba8a,
+	 0xc878fc8e2e9f7fb2, 0xed87041065de4295, 0xe9384f132b0ff42e, 0x87873f004e406405,
+	 0xce8b0ef38f43e31b, 0x4a303b3b7274f63b, 0x177cc6ec27a67389, 0x0f9c479a54f74255,
+	 0xa1515cd584417913, 0x2d6f9137ae470d42, 0x8a001a2922a0a7a5, 0x3a447cf58c291857,
+	 0xd832643d537d3241, 0xdbf3d058890475b9, 0x4bcc408d92d81f26, 0x09d11ec3a448a14d,
+	 0x18a4a544bbb5e590, 0x23e0e9b02143d6b7, 0x2149fa1d452f97cc, 0x9dd78b590ddfe19f,
+	 0x0d93b8ea53a836d8, 0xf3ea1c97103502b1, 0xc7e9448dc0adc461, 0x1a0a473577337e4d,
+	 0xb14fc4f06b557151, 0x634d51a43e724eba, 0xb62c08c32d74cd4e, 0x7144a70f56b943ad,
+	 0xc110101d3b19f9b4, 0x3158999497581b1b, 0x21a8f517df163c18, 0x4cfe940557b33489,
+	 0x26787f2ee1b15553, 0x7ad171d94b38eb78, 0xcaebbbf180493a00, 0x311c030497ea3704,
+	 0x20a39640d0782166, 0x51714d704b476a0a, 0xa7e05efcb22cf694, 0x6f7985591d6f81e0,
+	 0xc5ccec48ca91ea5c, 0x1de531732f2f2aa7, 0x20f91b5e30d7c174, 0x02c42c1b3a514008,
+	 0xb8a4b86651386c50, 0x36eab55f5c03fd0f, 0xfc4cc33cce3da7e1, 0x5aad7b0f0a1555ff,
+	 0xda5b593d7f7378d8, 0xa2fb21b55e8092f8, 0x1ba5081a8daba3bb, 0x87e687e7a3dc3e28,
+	 0x05a22367ddba5c7f, 0xa6faca72023cc915, 0x02e23de3376966d7, 0x1e8d7a4b4e1f1864,
+	 0xb729ede1b13e49e3, 0x32e8daf09d3779e4, 0x61dad6d6d8fa8c71, 0x24f018ae35a0384d,
+	 0x2fc152506a9ef7dd, 0x6bcf5c7394c227eb, 0xa6fc31695cbe9531, 0x98a8895b512583a7,
+	 0x2847b0ca9e6af119, 0xe5f90cc42deadfa3, 0xf6907c0fd859d885, 0x322fa97788a150df,
+	 0x8e9bd50f84391d24, 0x232d7286cd534da2, 0xf89a9cab4fe67cf9, 0x4f31599434388739,
+	 0x0c5e3b15c1709f56, 0x6df60f4e078b611d, 0x5baa804d6c0652b8, 0x1da72beedfd55e5d,
+	 0x45389541ab7693ba, 0xdeffc079654f67aa, 0x0463cb16cba7fcac, 0x38b2e48ec6d389f4,
+	 0xb7c27026d4081cd2, 0x55dc30579f2a54ad, 0x87a4ac56c0ef3305, 0x2ffac5b7c599a9e0,
+	 0x9b41cd832c54ff74, 0xac9cc2e14dfb534a, 0xf626dab7f67f74da, 0x49892035f7977844,
+	 0xb531e4c503a8f286, 0xae69915b677c4582, 0x2d83b9e91efb1acd, 0x35052653008a9572,
+	 0xedab59863bd8ae3e, 0x8afeeae72d2a0ada, 0x90198005a22a0039, 0x992ba41626741fc6,
+	 0x1751d2ca04389bf2, 0x3ca39daea9c6aa94, 0x6d54b2b6938f5e09, 0x27c69faaa164fdbb,
+	 0xc8d5ccdb51f7bc62, 0x7ce3da4bde4f56d5, 0x6ceeb9921973db2d, 0xb5fd765315d4e179,
+	 0x5058bbf9614fb78e, 0x921f8585ec4dae3b, 0xbf4762bc99faccfe, 0x70d8c35461f250a3,
+	 0xdcabe82162307758, 0x7f28143bf944cd48, 0x047032d437cd556b, 0x9b7a55f2ad3688b7,
+	 0xcc7db56d7fb2283f, 0x514f31f6228efc70, 0x8fdd66716a2e90b3, 0xa387d4f331a71424,
+	 0xf742d8b9ec8d23a9, 0xade354d82842e8f0, 0x2fdc57ff73069109, 0x378800c4a16d58e9,
+	 0xce4960a21d6e2f73, 0xb36228d9389b4888, 0xaa0c14b07a5e1fa3, 0xb52194e9da6ecdbc,
+	 0x7845bc69044a7f5b, 0xd623158aa4cce729, 0xaea3aa7c6bde2d79, 0x2949428db359ce9c,
+	 0x907cbfe4ff5f6671, 0xcd69d33090476354, 0xde906c6f4d64da47, 0x807fa31d5087d370,
+	 0xd3a4efed4d17024d, 0x16fb25e09ae5aa6c, 0x6da9f31bf65f6a47, 0x009481395acc9a4e,
+	 0x6fcf374743160e7e, 0x4c118802eb6336e2, 0xd0c4290d88faec82, 0x0b4443bf55dbd9ca,
+	 0xb3f70333f2120b84, 0x306abeda53abc4b4, 0x9d294f0be46cfdff, 0x5523669ed9b85818,
+	 0xe771466f57fcee69, 0xa41c4697046f59aa, 0x4998ef9a1f19ab0b, 0x55a5d61b010b40d7,
+	 0x2534a6f839818c8b, 0xaff8373471971021, 0x16c344105b0e812f, 0x1282cba08aada7de,
+	 0xf0dcb969531076b0, 0x13317fd49383e07a, 0x497b710fde150e85, 0x2c2c4253c1444eea,
+	 0xe55b77053d492872, 0xbbaeb93898fd8cf0, 0x9fa4090f38c956a0, 0x3a0cb3dd6704e454,
+	 0x0838e2cf851c46fb, 0x0b9538b2bbc3a2a5, 0xb467eb352fde4450, 0x769a81f59ebecdeb,
+	 0x01b2d37595cd2eb1, 0x728fa73a58f0d8bd, 0xf24791c441dcdaa6, 0xacb0cfe5f1320d28,
+	 0x7bbf67fbfe337524, 0xa500aea02281d45f, 0x7035a1682e5f7042, 0x08d739f78f62bf24,
+	 0x5a5c121f31dfd3a7, 0xe743a3345692e70a, 0x21dc2f0434f1777d, 0x9d61c2a852625231,
+	 0x285578bb974c77a2, 0x9e7776844cd7ff3a, 0x7fbc2d89da4d35f7, 0xa77488b619fc0e71,
+	 0x71a5ea7b2f994bca, 0xe4a4182a77d1e2ab, 0x32d489a7ddddb82f, 0xad81491becca7fe9,
+	 0x57120f9eadc68d16, 0x91923e00f2cafdd4, 0xa8fc0a322199ddcc, 0x52cb6c6df3ae3e09,
+	 0xfbf78645bc96c0d3, 0xce6c4062dda085ff, 0x5b0575abbd124e74, 0x3f047361d34802c5,
+	 0x952e268f9c5cf1ba, 0x12340e40bc431c2b, 0xca8f47f07066a2cd, 0x2e27750fbfc84aa8,
+	 0x1b31805c9d3ddcd0, 0xea2ba6a398e834ac, 0x3d773db66f0b10fd, 0x81e26ccd4cf83df6,
+	 0xfae164467dfdc8b0, 0xac013dfcf49fb132, 0x7cd227aacdfeedda, 0x5d6728370e3b9b88,
+	 0xcaf761cfe213eaa3, 0x1aac76b4ba515a77, 0xbd93c3225319dace, 0xae80d49835e19a24,
+	 0x25fe9185dfbd3bff, 0x0851f017b1df2a52, 0x8cbd454318678e72, 0x0838dcc5e3e8e6cf,
+	 0x9def90f37b54cca1, 0x1f6c3e7214519aba, 0x27cbebe640e7832b, 0x6abd6f25f28e1b80,
+	 0xce431e01aa97947b, 0x924eace029746914, 0x908c7cea3dfd0b54, 0x2871f592b2367b0c,
+	 0x8c79af644557ff54, 0x64a9dcff9280783d, 0x2d5fa41d82cc898b, 0x6d24fe1cb86b7092,
+	 0x828e555c21db1fd5, 0x3758b1fb5de1446f, 0x7b1c5f248241144a, 0x16ef1be60b6ededa,
+	 0x2b0bd74b275a4383, 0x0f12f9a466353515, 0xe933f0fa332fd93c, 0xafaa1fa311e6b54a,
+	 0xe4ee2672783d6c4a, 0xcea0cbce600f6c75, 0x353d570d68b6bf9f, 0xada5f8ef19fbb481,
+	 0x8470c60bf59926ed, 0xa8c25cfa6b9ae262, 0x5fb05ede8480bdf8, 0x6cf9b6deee570caa,
+	 0x1cf9f6c48c0edd9f, 0x795b72d88bfb090c, 0x9ae74799843d5a09, 0x394db707923f31fa,
+	 0x3017311732ee7726, 0x1fcd8b5bec690943, 0xa5bf2ce5f5f5e18b, 0x4020dcb50d005258,
+	 0x3bf9e6df8131adf4, 0xc8daa915d71c7814, 0x84c0441c63e1e7ad, 0x56a6e6beeb27527b,
+	 0x5056657044aa27fc, 0x978de88e90497f2f, 0xc6f756482dcafdd5, 0x0bf8bb896458fda7,
+	 0x24bd77352f0d8d5c, 0x50faeae97dc8c572, 0x6656df34dee80ddd, 0x2c94b2dfca6f0cf4,
+	 0x94d23cb214eced84, 0x975ac19e2824108e, 0x7b4f5a67079ae64a, 0x9d4f8ec8500000c6,
+	 0xa4ca3bcb9b445b9d, 0x491ac3c1c71d84a4, 0xc618850fe259d6d3, 0x7bcec1ffd1e530b8,
+	 0xce09aa132d9408bb, 0x9dec711cfc7c9e13, 0x7bd852959fea581e, 0x02bffcf7f0b9e249,
+	 0x6413bc68d1bd0858, 0x7de58546077fd358, 0x769b293cc7473c8a, 0x52ec9fd6110b5665,
+	 0xac65cb8d40aefc45, 0x7b6227dc866edee0, 0x28fb2cd7d1f0f9c0, 0x2881078850332577,
+	 0xd38714d37495fbf8, 0x7ea821fb72b16e05, 0xdfe6593a31ed0ffa, 0x4a72fb0965d93d26,
+	 0x612b00ec75ee0838, 0x7e2d8429e3e6bc95, 0xc98d20e4935cdcf2, 0x3be24c42ae1786b5,
+	 0xf394bc6f44041cf8, 0x4c38096981f22afa, 0xbd3a58cb5fe7d337, 0x0fa3f5610ad3f1a7,
+	 0x5c7fb793aa26bba5, 0xe5cf3b17319c50f8, 0x54cf8b4f1f3f5c4e, 0x0a59bfbbea770b2b,
+	 0x13955e852ed65da5, 0xbdd2c333c3365190, 0x7452333b8633a07d, 0x2098ef35f3fa92d8,
+	 0x64f887ccaa961173, 0x29916cd1a0f36b67, 0x926be6b92514799c, 0x8b00df60cd92f950,
+	 0xa402afe1fd58787d, 0x64f1106e4d621ad9, 0x08ac99f8c70e2047, 0x23416f43c2e3589a,
+	 0xbfd3e77dc3d283b0, 0x7cab151952542d7a, 0x7b82d9f8c494185e, 0x935f4eaa3b3cf240,
+	 0x9c3ce010e391cfd7, 0x5153a25c3b89b4bb, 0x3286dd40d7cbffd1, 0x7483e1bd264071fb,
+	 0x1f3f648578e76729, 0x3147061993ea1285, 0x6a972fa0ba8655fd, 0xb63b6e2957cffeaa,
+	 0x8ba5f4d4a574825d, 0xe75c39cf562902cf, 0xcba79dcc88d29dbe, 0x968d8b8e91587a1c,
+	 0x8bf253272f0c8d96, 0x84f7ceeb13a1a7a7, 0xe293b74e6d5c343a, 0x4f9dd7174128702b,
+	 0xc27af4fd63683221, 0xf6cf2d7c381a4ebd, 0xfc43d8eb932253f9, 0xa127642764716b85,
+	 0x00dc0d720cd2f066, 0x7aa3db27e15f3355, 0x2b5f21a0c2a637da, 0x1e30d16c62e818fd,
+	 0x89e2b95242995543, 0x6ab866d18d48ab1f, 0x4b2773755ecc7102, 0xb0de3f013396dde0,
+	 0x16f211f55bda7c49, 0x07134b78d8f6d8cf, 0x00db31d7163680fb, 0x444e0cbded171fbc,
+	 0x282077fdbdd04a90, 0x5c539fc67f8d9c65, 0x141ae23f44c7076a, 0xb0ffdc1b7fddc07e,
+	 0x4dd8ef54daa0dbfd, 0x424a15fa52b7059d, 0xc68786d1b1d537da, 0x3d3d69cb82f2005d,
+	 0x2d16506057eec6df, 0x3579f5b063ac540a, 0x436c318391bd9ec2, 0x57f9dcc0c28a3dee,
+	 0x29da2b025030a1ed, 0x532e531096474dbe, 0x8b00e04ef7d54f08, 0x36d75bf062b02907,
+	 0x38cc35b99ebf70e3, 0xf1cb06017329bc95, 0x4c21772a320c5ddc, 0x18f02706f36c0e43,
+	 0x6f8523b777460f22, 0x2875766a7dd1aa53, 0x8e25ba48b99ad2a2, 0x28ecbd9c796f38d9,
+	 0x4499eab19f62a64a, 0x3edfbc72dab9c72d, 0x5bf3c69031500127, 0xae83a93a3ae60d8a,
+	 0xc5ffcc447d132031, 0xc7830fc9fa1697bd, 0x6a6a26ed5bab93cc, 0x21de7ebe1b582e91,
+	 0xe6cabbd227ede721, 0x133428257ea72228, 0xf2b82f02c06d0a73, 0x3dae751030608739,
+	 0x9f8982d83d1bee34, 0x8e5bde45b359bd0e, 0xd16ec9286b13f841, 0x2896d01bfadbbf36,
+	 0xa6c6524485adffe0, 0x80bf2ffa6ab32734, 0x1b4b4410c7f90a44, 0x860d182374fba472,
+	 0x8d192d8ea5030f43, 0xd916bdcec932e6ae, 0xc04318c12b7d0d63, 0x77792be29542bc01,
+	 0x8b411909f63dc9ba, 0x41e6e57146f20b7e, 0x98ebf70d1d4a4373, 0x7a834ef387b48955,
+	 0xf8398ff104daa1b9, 0x42908c5fe2f9d33b, 0x768aef53f7e263db, 0x3ae15d89b1acfd9d,
+	 0xd500ecaa9d507acf, 0xc2bb2120e6cf24a1, 0xd7a9176f7eb045ef, 0x2772753bdb703c7e,
+	 0x03ce42b2e2d9d74e, 0x04cad710c9882d22, 0x0fe41c01f231ea13, 0x06eacbe222dd450c,
+	 0xb80f4c64b819384d, 0xebf867b0c554b244, 0x78d51f34e1ccb642, 0x4bb773b7828bfa28,
+	 0x0bf11189a64a3edf, 0xf97ea15c13380b00, 0x186b0035addd7490, 0x1a995e47d91cdcaa,
+	 0x506111dc0f7e3c7e, 0x03d141c8b2de43ba, 0xdaa8d8da02c813c3, 0x516b920e536c1987,
+	 0xedf3ff84d5614934, 0xfef759dbaf09c431, 0xf1bf19eb85fc7450, 0x11bec88e98aa0948,
+	 0x862767b8a0e0496b, 0xaa2174356b732741, 0x12cb5ffe75d4360d, 0x66d6fc1f4a54c979,
+	 0x4c1fef27b3f3c804, 0xf12ab6c7d7e38f54, 0xcbecff6708d18116, 0xb59c066b3fc9d50e,
+	 0x1300bf99bf0b27c4, 0x90ecf8eb3f5ff9a1, 0xe3737682193dcc12, 0xaa25de4485b3f672,
+	 0xc998afcfe08eaf2f, 0xfb4c0fbb260d228c, 0xc789e13c0dd7cc4c, 0x50e96beb1d8dedde,
+	 0xc6c18d078a7ede1a, 0xfd7e829aa7a115a6, 0x23d2e0610a774e8d, 0x6d2abd8fc625dbcd,
+	 0x842077cb2bfd58ae, 0xb088cfe7d076f081, 0x6b741c19cb06e29b, 0xb052447549595e07,
+	 0x276badbfc261ffdc, 0x7fb1d03e0ecacab1, 0x0d2bea8364fecd18, 0xb2e5133f3280c945,
+	 0x0cfe80f4976765f7, 0xe9ff527e4fed9c67, 0x1e03374cc3368c72, 0xaa63573e6ffd33e0,
+	 0x69b8e3f06ffd62c2, 0x3453d729aaaf8b55, 0xc0292dad69cc3e29, 0x77bd9f368c76767a,
+	 0xf1280c1b3fce3d7b, 0x66525b89d94429d2, 0x47307531dd466251, 0xa69703929c163420,
+	 0x8e86fd66014a8b27, 0xca5ebca8081d287f, 0xf60aa2d8345d8ead, 0x724216334383b2c5,
+	 0xe26c68a0236d4a33, 0x013bb6aae9bc550b, 0x463ef8fdb21c1d72, 0x9ca6114ef6a482f3,
+	 0xe0b186068c494279, 0x2b6d2fbbabde49bc, 0x5029757d2356e04e, 0x24ac940190d25d7f,
+	 0xa33d6e1a32302f8c, 0x833f3c2875c5303a, 0xa5c858b3ff5badde, 0x0465df163a02a319,
+	 0xed23b7964800d44e, 0x62c0ead96a5ff6f8, 0xfe9223df10140e42, 0x41be66b0a41f9100,
+	 0x8eaa6130b3bcd090, 0x308a8900aed642db, 0x1eeeca8cb778df35, 0xb6282e7f1ff2e64d,
+	 0xeff534ed47d585df, 0x5fd21b0bc1a8ed73, 0x7028060c1849671b, 0x4c0b134aaa1d034e,
+	 0xade2e05858d27ed5, 0x6d227604b4773e73, 0xde596c35e9c1cef7, 0x317786d43f6401e4,
+	 0x2467ec55ff6202e2, 0x5d61e959e85f848a, 0xece6baa2cd60ddad, 0x5c788c42c48bab7c,
+	 0xf9c18b5387e64be8, 0xa1d65a7150574778, 0xca8641c612f0e634, 0xaa3fe26261d95eb4,
+	 0x089d08d150f03104, 0xb7e2245bd374b89c, 0x21d099fa4161c319, 0x32341be96305da4b,
+	 0xe155a2047527d97e, 0x668ae8b64e5846b8, 0x28b454b7aa801764, 0x2ca85025b2308727,
+	 0xfd1ceacff07e5cde, 0x0c89f3a776f5cb5b, 0x0b288369d754af5d, 0x8c783604ca44a3e9,
+	 0x47fb3d933666b4b6, 0xbd5bc08728f498f5, 0x56d5a8969a880421, 0x00e1b8776ec774a5,
+	 0xc4efa53bcb571cb5, 0x0f0e169e95598f6e, 0x8f9ca167e13853a1, 0x278d5cf2e9989f9a,
+	 0x2b8b27ae5c63e652, 0x4013bb8fbc134f47, 0x002a84c314d31685, 0x2a141db2df9d3c20,
+	 0x42c266d10a822050, 0x24d9917ea54a94a0, 0x8d893594d92bda1c, 0x547c8966ce218173,
+	 0x9305fba2e149d9bc, 0x46ba2fd83ed3e479, 0x60c880d4d5b7a017, 0x9554cf61a3794b51,
+	 0xd0687e5f8072dccb, 0xcb8e7c142e3de715, 0x653d8a4f12e82731, 0x37acc1d8987d33b5,
+	 0x215987f123f34165, 0x8843604ee98c836e, 0xc76b0b7381160880, 0x58c64962e306792a,
+	 0xff807b6e0986d301, 0x66e40f7301a11dbd, 0x75b03342b3cef5d8, 0xa126082f56b3ed43,
+	 0xe6203586f9bdb112, 0x2cd88e20be89a2df, 0xdc8534eff220f1cb, 0xa96225f2ef767471,
+	 0xc5bef1c54fd02bd5, 0x6bcded71ffc5679f, 0xbdbd6d0a3fa4e30b, 0x51c91a4d8b92693e,
+	 0x8767a36369c0cc2b, 0xfec527ec7f6c6af5, 0xeefd4a9431645656, 0x84c9921e13971d87,
+	 0xf2e9f7d6f1d59209, 0x3ce1225bbef2561d, 0x64063a59c069ee92, 0xb1b5f75ecbf9bc58,
+	 0xd302bd1de233b82e, 0xcb97349b4d5e32c1, 0x31728ae14b5328fb, 0x2658c3dc4723eea2,
+	 0x2b38d5cb73e7fd84, 0x3d306dbe5b46a478, 0x1d397535116d5f0a, 0x2dc3d2dc873a4bae,
+	 0x51ca0680b0032e70, 0xb17635b52b8fdcb2, 0x12a1aa585be10cea, 0x33bac0631bf17c6d,
+	 0x4da09bae4738945a, 0x1296b6e1af977087, 0x6176e4573a2d94e3, 0x5aa8500566108fa2,
+	 0x0650dc56b6844c51, 0x7e349084333bf33e, 0xb61da0d343ecfdab, 0x65be270e4601022c,
+	 0x9e06fbfd0a5ab369, 0xc781980278dedf1a, 0xbf7a13afe7440087, 0x84d7cd2c1156d983,
+	 0x38baf207632218e6, 0x42706021f91f86e2, 0xd2bd45feedf0f7e5, 0x08797235fe566b67,
+	 0xcc34b82fa069c97f, 0xffb26878967460eb, 0x39f574c77fe5aca3, 0x470913998426ad54,
+	 0x92f643ed815eb989, 0x940f68f1dfb922bc, 0x36e3cbf7e45c3144, 0xa998bb71c43f0020,
+	 0x3a6745aef09e8748, 0xefe0f311c2b125d8, 0x5e59ff0bc31897a3, 0x6cf5dee2813acfe0,
+	 0x7f5b4c0504806ca1, 0x81d155f8b0264981, 0xcdfa973f67d9236e, 0x048e4c12649eb272,
+	 0x0f3fd66bb704578d, 0xd31904353529a0dd, 0xa6614e465d790b00, 0x7afd8c5fbc8fbada,
+	 0x07fa518093d26cfb, 0x971a9e3f67ed2bc2, 0x8cc9c12305fd1c78, 0x9d78b1d1f987f76f,
+	 0xa77653d5089cf7a5, 0x912b3276128b9c9c, 0x5e6296b293141842, 0x7a402b1a4f3043ac,
+	 0xd66b59139a64e8db, 0xfe6bdc35663be597, 0xa36defb08af502c8, 0xb07398426ad4d9e9,
+	 0x485347c867e65e31, 0xfdfd0d2267ad32c8, 0xd5a66a891b7b19ea, 0x65c2f99919065833,
+	 0x0fe23f2370f8d2b1, 0x8298e60bffaaf9f2, 0x2882a304942710df, 0x4f2e9e92245ceb73,
+	 0xdcbe4e6a062c0dec, 0xcedfa8271632e375, 0x8b8f4c5670f4dd86, 0x4e59e55676b1c0ee,
+	 0x45d9ba44f499e4e6, 0x5b5990e7aeaa1136, 0x98a3f0684a952e69, 0x1c8be9fda72f8197,
+	 0x7fe9323bfc63a372, 0x2dae73c9edec52d4, 0xd22449881becd4b6, 0x90ce4932932d3b9d,
+	 0xc39e0e2dc0fe385a, 0x6ad0e78bde1416b5, 0x639cdc732282e436, 0x9e5a03d8e7ae445e,
+	 0x230979e8de7fbc65, 0x14b3874984325ad1, 0xf9be8a043d2edbfe, 0x6f5ad5da0ff51f27,
+	 0x970895166c9d744b, 0x3fd4a9183d9e818e, 0x4e58ab3f5e8ba895, 0x1a86a0d4b4e0c45a,
+	 0x655f26e33b8f2163, 0xfb98e155819419f9, 0x154a54c7eb5bbaca, 0x610cd4a855405b16,
+	 0xfe77f724fe45cc20, 0x11f530ba61eda171, 0x2862716b85f19410, 0xa57dfe3a9c7c5fe7,
+	 0x84b4fb698df89fea, 0x08ad7b35da909717, 0x47f5ff92f726640f, 0x0b85d33aa70bface,
+	 0x8e5f1c3791699bf0, 0xb18ab929eefc1393, 0x59778c7ecb5f5384, 0x9c1b997f1b1c43ee,
+	 0x5700afc04fe35dc8, 0x3884bced60ce6e10, 0x0a6690028c41d3e5, 0x13caab419a902906,
+	 0x65b9499f0b7e1d23, 0x1b921a9919debc4f, 0xde5d09e24fa8ca48, 0x13bacf6e5b116b11,
+	 0x56b698131fb6c38d, 0xd91ff8d69f5b624d, 0x795d075e20d39fb3, 0x5cda1d4d97a305aa,
+	 0x778fd7a123318d02, 0x5e9adba2a9af9887, 0x5db020ae658f94d5, 0x850097500855a697,
+	 0xf3dd30dd08b0e6eb, 0xf06b1550b30be956, 0xe08934d2d69963de, 0x7fc4cbc4ff315b2a,
+	 0xd96569381e889267, 0x5f5f6e3b0a7a2785, 0x876e70bb204a746d, 0x2fedba09e2838afc,
+	 0x920539d878107b45, 0xa7b70f98334de7fd, 0x3901a23213c21e08, 0x7d08fe365a2270c6,
+	 0x6622be440a059374, 0x10697cb1af7521fc, 0x8ce39072cb15b17c, 0x99abf3f5d9958ea6,
+	 0xdfcbeb475f211ef2, 0x1eb8c54f4fd98f36, 0x4519576161205df2, 0x174e75dee80bf8ea,
+	 0xd66305c61f942fca, 0xa357ff159dbf137d, 0xded85726e8a0fd06, 0x51ee34cd3733b38a,
+	 0xd8a41ba7ef9b5c00, 0x1071e037f77c352b, 0xaaaa95a4ddca3eca, 0x5068f8b61cab0f07,
+	 0x84d998d28ed50a6a, 0x0cac89ccbc12b8d0, 0x4ce1a82276723f8e, 0xa7d5af6163f51700,
+	 0x43c9f86adbb5287d, 0x2d683ea85fac6f15, 0xe90d843bce1f47ff, 0x16918b418a53d026,
+	 0x70f91df7ed0b53a7, 0x52fe6d4ef1dfb00b, 0x56ec2de1aff27f3d, 0xa7e35b24157fbc37,
+	 0x983b8b0148a13e84, 0x3b54ebce701fbfff, 0x7b18b3a009582484, 0x5f74d1e782460529,
+	 0xfe2653955f8d6ed9, 0xdb098a05a2fc221e, 0x733eecdde9e1cc0f, 0x6c9892d36e1f2faf,
+	 0x880f67c54a50e32b, 0x72038ac26c82db8d, 0x9d3a8c01758fdf33, 0x65388af2c8ade999,
+	 0x7d0d1958f01cda63, 0xfec4e8d6fa1626bb, 0x7f4435ec8fa23a82, 0x0a972a36fe85f7f9,
+	 0x4d6b7259cbbaa61e, 0xa61dfadf61a87fcf, 0x908cc3725c2d6102, 0xaf96be4ebd882706,
+	 0x2ccead65e051a383, 0x92491dc5e498af6b, 0xc8a321d82d3f0df4, 0x34d871c3654be811,
+	 0x50b57ba31868fb55, 0xc93e3817f5d58fb3, 0xc8e0b2c74966f829, 0xa2d517b251d60063,
+	 0x30ddd18e558bd8d5, 0xb403fbdde3a3e916, 0x738c2f2afbd3e3c1, 0x315aa4be590dcef9,
+	 0xfbcf5c9c104ca5f1, 0x0d3cd91431e70b93, 0xd0284f019f4d8b6f, 0x65201eabc2cedd5f,
+	 0x4cf3ac6ffe8f5d58, 0x1b68fa2831b6e3b1, 0xbd7aa5e7dd4ca4f2, 0x1e44871c91e0ffa6,
+	 0xd17a5a53003f0a39, 0xd3335b82dcebe6ad, 0x63434b86947f60c8, 0xa5a2244ed4da7213,
+	 0x9ea66d277bd9a974, 0xf015c739ca0f295e, 0xa505d9720b82721a, 0xb273ab5af01f27c1,
+	 0x8db28d779bc3a733, 0x0906c2a9f55a041b, 0x4554aca86bd1eeaa, 0xb0d586c2d9ab7709,
+	 0x9c4dee16176be3c0, 0xfd44755880676e7a, 0x02ba7e4def145bd3, 0x2c2c8a20cf13e76f,
+	 0x26084ae0c49b94e0, 0xa3ee9828a0a703f9, 0xb35292aa7e7448e4, 0x399a283c8d8edd5e,
+	 0x4e489af2ea23d873, 0x7d0c05722c0de60a, 0xdc6864b027d72a2f, 0xa5dd8fb79a68b7f3,
+	 0x0773f42382f6555c, 0xd8aba57f03d2e803, 0xc29632d15907ee90, 0x9aabb8205ac69487,
+	 0x9d9a5607849943b3, 0x2f54240880337625, 0x19f0e7a859aec2e7, 0x116870373575cba9,
+	 0xe41788f6029199b8, 0x90a2b259699fac68, 0x3388fc6a5c5a340b, 0x48411a41e84ccfdf,
+	 0x98f39932111836cf, 0x66c68a7a7f29c15d, 0x5462bdae7bc4ab02, 0x1fbedc286d854020,
+	 0x972928e3c7ce17c4, 0x8b859dc688c4d9d7, 0x6760602dbf8e2524, 0x561bb5f35b398992,
+	 0x5fc91127c1e421d9, 0x6f02bde80e3d9a51, 0x0a17960ff10a3246, 0x44dd1a770a3faad2,
+	 0x3b2d65f34c49d25a, 0x6589ee41b13cf2a7, 0x05acc45ccbeb31b4, 0x11a5b0d26f06c2ad,
+	 0xa92d94c5497f996f, 0x05dc9219d74bfc48, 0x97d612294ee6ca6f, 0xb5d4e0f7747f8025,
+	 0x2ef47b81627ecb66, 0x1d35dde0a35aced2, 0x641e64f4a51a960d, 0x8da05e8ed9cbd3d4,
+	 0xcc49ddb275575a43, 0xe644a0c312fb6e69, 0x35ecff70bad90b89, 0x2dcbebaf788e291b,
+	 0x44f924f90674a811, 0x5672011b1b71f88d, 0x6fc3d8d6d04a0f34, 0x8906f615acc93a1f,
+	 0x3d46e9d4917e3045, 0x386a4d30d07b7aae, 0x0499053d3862a6a1, 0x8a5c0079bd404dd9,
+	 0x906ba38553a152dc, 0x8843bffd4227ea7d, 0x980ee82ed672034a, 0x3958ece6e2cdde7e,
+	 0x049c91ff057aec94, 0x93de7f06f95bada3, 0x5b9628464a6266f4, 0x86af9c27f2252269,
+	 0xc5dfd7cfdca7eae9, 0xe62d87b4afa9170e, 0x0c4b4ce6f287956c, 0x4ab0afc0c08988e0,
+	 0x2c01e590541d4c41, 0xfbbefc369af9b50f, 0x3c070743b0d1eac9, 0x43e0313c0a837b29,
+	 0xdc0424d615bff9b2, 0x8710e290184563be, 0x005c417e74c85ffa, 0x34133f26479f91c4,
+	 0x9b9ebd3f49ff9cf0, 0xda489f4054b35b7b, 0xa6e3481660fe9be6, 0x569205c21d4c28ca,
+	 0x3a374a7837947842, 0xc7bbfb7c00003bff, 0xe98ea037c751116f, 0x42a14e54863f2a23,
+	 0x835555af3b9bd208, 0x98a6abc77db0049e, 0xf60ea00643e5fbfe, 0x3bb6c8ccd4ef7a7a,
+	 0xcdf32422d77eb2ce, 0x201afaa7ded0a780, 0x64de3a55ba4f51cc, 0x14d1a93a2e1c8462,
+	 0x4fec5cba22b9a6f3, 0xf74f3f5a5503f20e, 0x0a504e5dec3fc183, 0x66cb253e2ce8ba85,
+	 0x0cde4c4088ede63b, 0x61d5bfc322255692, 0xf953a7ad321fadb6, 0x0fc6e259e935b6fd,
+	 0x0a5fd84e4f47a3c2, 0x0d00158c25c42546, 0x14469cd5d1db2bd1, 0x7a1ba4f2a5db21ea,
+	 0x9fbe693e9c4a0dcd, 0x35f43346af3a0ac2, 0x9ea5f6e5e7503db6, 0x5f862c5a63875d81,
+	 0x880c2357746c9ab4, 0xa5777a82c33d5ac7, 0xd81dbd40026dca20, 0x73a1803623e95183,
+	 0x6f368728fc468884, 0x62923405d0683274, 0xb8e3908c66aef56f, 0x05eda49a610f071d,
+	 0x06647281c21e6f35, 0x62f76707446c16b6, 0x03952ae752e45db9, 0x69e3973b5bea2914,
+	 0x01d6d5e9dc716118, 0xebb7c2cbc8dd3552, 0xed6b2f92d1c8b65b, 0x7db8278929a23cc9,
+	 0x6784b7d9dfcca193, 0x2e32b8504e42bb2e, 0xa4640f63a90ad26a, 0x15c205b5c80dc444,
+	 0x6284ab7f5149a7fb, 0xf3ee777edde92ab1, 0x5ef3fe6d2c3ea393, 0x6732861a7f9922c2,
+	 0x0dcb30ce5c8980c9, 0x4016ef6f2aad24ec, 0x40bf369a2a6a62d1, 0x2e593ad88b6da44c,
+	 0x72aaddc3080ac63b, 0x305dbe9cf13f3277, 0x0e66c500daff0705, 0xb2de666addeeb951,
+	 0x17e09e755df6459c, 0x2cc00f0d8f1e834b, 0xa93ecd0b992b5d0a, 0x5c25bf2216065e5d,
+	 0xf7fe64d9dfb8c14e, 0x72709ca799180616, 0x86d388317f4ba6e5, 0x90eaeabc6cd597d3,
+	 0xe64008f6a6496cc0, 0x9a148bc0bac1ded6, 0xdccfbad64798d462, 0x918f6d092718cec1,
+	 0x1edba6abd421fd75, 0xb0227eef2f1b1bfb, 0x275ca9a29b5e578a, 0x51710e18de9afddb,
+	 0x60c95f8aa975133f, 0x6e7a4a473c3b00cf, 0x6f093fb49cdb6591, 0xb1ba43d593d96f18,
+	 0x3c671c43f0092ce0, 0x532cf58275992a1d, 0x8f55273e37122d5e, 0x5fd48bf2629b5781,
+	 0x48dca4488ac87578, 0x313bd07a137f6cba, 0x2fca00fd6cfa24df, 0x126e71aa28555c50,
+	 0x5099fe6d59eb3e57, 0x6b9f2174c381865d, 0x357d4a1a4cb280d9, 0x43d0f35b09ce1c3a,
+	 0x96507c1c8bcfbe25, 0x9053e0daa453e6cd, 0xd575c7a1aa57d10b, 0x14e43d1297fcdbde,
+	 0x8dd30fa646fd53c0, 0x197c0e9562490884, 0xcafadb1cd968f149, 0x0ce693fc84fd131e,
+	 0xec2e016d90cbe2ba, 0x52e1eaad7d912770, 0x065a27f396e1aef9, 0x5d58e14ec14dd982,
+	 0x632aef70f95327e8, 0xefc1d4a99936510a, 0xe31538d0425d244c, 0x2a752db1e8d5772a,
+	 0xa1b45bb9869004e0, 0x81e61fa5cef3e2ef, 0xe06b5971517e83e5, 0x8b80a685b5c5b6a2,
+	 0x8adb2fa172eb47fe, 0xa4d96dee6d63c0d4, 0x97c3f51856c65f6e, 0x0ab49529d0745335,
+	 0x482324a318e9ffd4, 0xc2c1cead251d0610, 0xb6e47f76b8747544, 0xa0d4a995f159fce8,
+	 0xfb0ea42161dc19f0, 0x11893e0c948d8949, 0xa0f09c292850370b, 0x34eccb9659768993,
+	 0x0725b017f86ada1f, 0x6e10d6cae1587bb3, 0x8281331305fb2f69, 0x1a7ae18ca2755044,
+	 0xd0b4617610060ccc, 0xaabbdf4c35ce2a5f, 0xe006e58962c717f3, 0x78e128c8e407f5ab,
+	 0xf64bdc40feeac5f9, 0xc7c3038a84cd2b79, 0x123ec7d5891f9565, 0x5c91a83e0e67d9a8,
+	 0xf788876a788f1548, 0x9e3d727be1674583, 0x84b6fa62514721b9, 0x99ff25c39cc2095b,
+	 0xaa48961c5d0030c8, 0x44b34a04ae3db099, 0x508446addcb5a0bd, 0x36aa09e5626142ad,
+	},
+	{
+	 0x405993263ad5d4ae, 0xe05f2a1d66ef2cc6, 0xea2c2e61fcbecefe, 0x6fce7778140ddbb3,
+	 0xab40fca2078da415, 0x077b78b3f6d54d37, 0x809f0d0bf897e24d, 0x05e4347e433e4014,
+	 0x8e541905166cedc5, 0x64634dec1afb2175, 0xaf6ffd0dc6c89745, 0x48ff89c5a63951d1,
+	 0x5a7b19ba09e24341, 0x5be469e46dec1d8d, 0xbcd048f3fdc1f4b2, 0x3e7a22dd6c68505c,
+	 0xc588b37d848bca35, 0xc15de26426a478c1, 0x39392cc78ceea9cf, 0x04b0db6c7c483b12,
+	 0xbca83be24f4a73bd, 0xb242d7c34ad9f706, 0xa7c405ce2544cb35, 0x2b93eb770c28c4ed,
+	 0xdeb793afb59514cd, 0x3cab6dd41220e997, 0xef184bbaae60a3d0, 0x2112fb3bfba3a07b,
+	 0x0ddfb4c28ee91a33, 0x7611188539de9ea1, 0x86ad9af1d4450290, 0x518d6a6557915b5f,
+	 0x3eeccf1b46830d98, 0xb1630025e66e9e20, 0x1f6b041bfb32df85, 0x8a0b9a3559fc7c33,
+	 0x0b0acd698a7a877d, 0x868ce58be60a228e, 0x5149e19906127409, 0x53c21621868c0df7,
+	 0x8d5c8bc2d8b7abc6, 0x6c5b420272542052, 0xe569ce5ef01d0219, 0x57b56b7f6caf5836,
+	 0x0738d462c7d80ea1, 0x4e41d08af60cb2e5, 0x9d9f55292c642b74, 0x8ec814d537fea4d1,
+	 0x91006feffb74ed8a, 0x09b850b448514952, 0x2e0f49b9c73e7a38, 0x87a91caf8895d2bc,
+	 0x067d2f83411a3f9b, 0x68820d01887ad3f9, 0x3b621aa5c5473d02, 0x112b1995d7d0a365,
+	 0xcfedb01e188cd5d3, 0x1c5261c5227d61f0, 0xead0038238197f1d, 0x1afa1c8840ae67ff,
+	 0x430575a364961c6e, 0xc1f5a80d8b0d0c42, 0x5072405b5a9e9069, 0x36297b481514c937,
+	 0xb822ed3f46ed03d0, 0xf58e421ee3214c0a, 0xebd3c36b9d8e8ea8, 0x84edf7db867502d8,
+	 0xc6e29158cb14e2c8, 0x2e183b951b40ac40, 0x3e066b25524a3bd4, 0x004eaa70491c1f82,
+	 0xbc813b924f25357d, 0x29c54d1f503e2110, 0x3da710f0a2c7bd09, 0xac14ce67458f3ed4,
+	 0x53440bd79e8e8a09, 0x2a9bfd88c70f9ad7, 0x95201de08d4522b4, 0x3df9c52ea9ae999e,
+	 0xbfd361e84f28e67b, 0x63bbd29351a6cd5d, 0x6202c8182b6528a3, 0x53fbfcc653c06d34,
+	 0x38dab12361a6f007, 0x2192cf1a2f0c4e65, 0xe01fc4126638d7c8, 0x83007e371e40a283,
+	 0x9b5981aaebba096f, 0xe84ff2b60a2c614c, 0x89ad79d0d7bd5837, 0xa6236fb96bf22b3f,
+	 0xafe1246838e1091f, 0xb25fcd32585aa687, 0x6fe25defc521278d, 0x23c0966a9bb54493,
+	 0xb729a5b06ef5476f, 0xa7a7d3b616992113, 0xf0f5dee546782ffc, 0x9de83d28b90b364f,
+	 0x3fcde4420060957c, 0x01666956014865bd, 0x8c1fbcde1546f83c, 0x078dac9479e41f59,
+	 0x856bacce1448f900, 0xe2bd0b1246daa8e1, 0xca328331370c9ae6, 0x80cb2a069626782e,
+	 0xb7d1524ae5e59939, 0x2796430c09d619bf, 0xe5fe91b2be6088c7, 0x1723cc649d9db2d4,
+	 0xd8063caecc1bcc60, 0xe4923f99d022d9c0, 0xae228bab43654e3f, 0x90c1bf43de49d6e2,
+	 0x39dc5f4d406cb04a, 0x986d2df9fa6b8d3f, 0x63f7c7d032dfbc73, 0x81ea3eeb81800261,
+	 0x4db432bd058dc871, 0xce1838ae212a17e4, 0xe9ab52886633cea0, 0x150c7705f2441755,
+	 0x0e1b66936478139e, 0x1a60653eff3bfe5a, 0x84d452f86c6be08b, 0x69187710ad6d3bbf,
+	 0x5563bfaf1aa3d05c, 0xf3063d46445e3a6a, 0x0f9de72aaf58f5a0, 0x65ca7d6ff58d9d82,
+	 0x5b508a09d39efbc8, 0x4be7f0fd95f7af03, 0x5506baa312f79dcb, 0x561ad9f8ff82ce89,
+	 0x72f6db06bac3c55d, 0xadb87c0c4f00e795, 0x996a54d386bfd8f4, 0x83ba3a42f322d360,
+	 0xba7e774ccfc93e1c, 0xb6ceec62dc0cfe64, 0x61d336a62e917f14, 0xa603f60ec26f84f7,
+	 0x02ecdcb1d2102c03, 0xbdd5e650f1c830bc, 0xf70959ea436720d5, 0x6af6a0c2405a74b9,
+	 0xaccb7ffe5d472194, 0xefe3892a423e5c74, 0x668b5ad29f9acf4e, 0x9df44897770db6b5,
+	 0xcf855d1db92ea57d, 0xa28b351c778d7e93, 0x48ca0b9924e4a81e, 0x217452a10c9230ac,
+	 0x25089dab38a4d97b, 0x4c1587932be027e5, 0x2d2556d1b204777b, 0x99efd238248a29c3,
+	 0x1f8bc8e1a4b7fb41, 0xef7fc55ca2d03195, 0xc8bb91050a20cee3, 0x7430d8e9f551427f,
+	 0x5c9affa9f6fa2e5a, 0x2e1aeca95949661f, 0xbbbe65a0d377c315, 0x5769313508f87046,
+	 0x058ee5d4797a046f, 0xb592704085906765, 0xd626caf5a0a76a0f, 0x0ac3b3ae70a95c6b,
+	 0x38f8fe7a8e4f473b, 0x2c832589b7bf516a, 0x19cfd382a6093353, 0x2f21f8dd7bc3b4a8,
+	 0x36bf5e9131af7db3, 0x036ace77e0694b98, 0x402512b32efbce84, 0x2683677148757603,
+	 0x02576ae8e411e97c, 0x15ce6fe02ad39578, 0x33ceb14d0fa1b935, 0x15dc9f8aa0e1cfe1,
+	 0xfe66fa6f68ecd9b9, 0xddb3c4b2f593c9a9, 0x2d67ccbb1899876d, 0x09f446953f5cfb58,
+	 0x43fff62ead07efb7, 0x1b8a5770acf8a793, 0x5858a094690e5c93, 0x33493fc8a3b10fe7,
+	 0xfa11dee277bcfe31, 0x9bfda9753ab81b7e, 0x2c4cbf352d427d8e, 0x79a85733b625f9bf,
+	 0xa4099f74ce14e8e3, 0xfa1b1ee3c156b23f, 0xd6efd0020f7f8125, 0x6570bd64e6f4ee23,
+	 0x0ee3857fbdec577d, 0xb281fac3a6edeb3b, 0xee86c8c3496a3f26, 0xa9d3d273508b471a,
+	 0xeaa3946ffac9ed8d, 0x403c818a204198bf, 0x008540979b4b19db, 0xa88d6ca89d083001,
+	 0x02986ac79e226df3, 0x7ba1cf972a5f79ae, 0x888077801d3f7660, 0x1fa73d2f7540bbfe,
+	 0xa3ebe8ca8496810b, 0xbb94c36ced837b83, 0x0ffbc62788e2dc46, 0x45c117a94bcfae99,
+	 0x0d3d15fc31e6b101, 0x6f9b692a1f96ca58, 0x176254b2f41111a5, 0x14815a9e68520e5e,
+	 0x11072f643662d7a9, 0xd46d2d3cfa27d71e, 0x0fd22fe907d24980, 0x9367e7fda0962261,
+	 0xa0dc39976c4df7ca, 0xcba1744deb7108c2, 0x939bb423a87c13f1, 0x993b9063886744bc,
+	 0xd9ae2c87cea96862, 0x2cc48da8c5b65062, 0x97cbc9ef552bd259, 0xb63b9bf0b2786eed,
+	 0xe6202858049c7f6c, 0x7a0e8e98daca3975, 0x642df880771963c6, 0x2001b96779ecea7a,
+	 0x0d9135fa96088e16, 0xd805d5f21dadbdba, 0x8f520979a2e6fef5, 0x6c68e13e24f96f28,
+	 0xacfc071aa68703cb, 0xad1e8b1aab5a2d72, 0xf6aa4fba0a0145ac, 0xa232e46cd922b6d5,
+	 0x3ad8a05ab016c4ee, 0x8ef026994b3659f4, 0x8d01e88e570c4853, 0x58c3a73a2f043afb,
+	 0x96c6cda52e73fb20, 0x457b13f416a278a5, 0xe729ea8073f4d4a5, 0x4fcf28f34140c454,
+	 0xacc1f1776af76665, 0x8c30379c115af87d, 0x04e6f4b881a9cf20, 0x27b5d0b3d2d5f69c,
+	 0xc3789d28b2f6a51a, 0x02a0187d779e5e1b, 0xa2285c6fe03b8260, 0x7a44a07b375e3c91,
+	 0xa770fcd56ff1120b, 0x85414c0bb59fb6dc, 0x6d037744a434868b, 0x22473c5eae8dd622,
+	 0xe5ff37d99d19611d, 0x1faa4e5081c0ba8a, 0xabccd1be531e33fd, 0xae9b71c115b69ad1,
+	 0x5b4eb04e51b363e0, 0x90069094851582ef, 0x4bc975a790d39ea3, 0x46df0f39da28916d,
+	 0x1cebe66ce5e7b7a8, 0x8f4bf028c5c634b8, 0x0d63a856518ff1cf, 0xa5cd03c2e24203dd,
+	 0xa842e465d4000121, 0x09810344ea32e066, 0x38382976abd860b6, 0x77aae47f585acb9e,
+	 0x03cba3bc0840f4b7, 0x6defdcac31fd618a, 0x06f512dc874c1e84, 0xa3b6a23efe64213c,
+	 0xd0a7e4c6ccd4ce42, 0x1ef1e85d4c3683be, 0x09880986e76bcbc1, 0x3fa579689c10dafd,
+	 0x388888d8d680dc1b, 0x4ea0946adbe8d5a1, 0x3d5e3a3072e99955, 0x04afb7c9bf833f75,
+	 0x3f4ac07101d13e3b, 0xbc2adf713239f847, 0x75fbc13aaab71b93, 0x751584b54a2f6193,
+	 0xa0414044d1c93dfc, 0x1f0b23d6d5333694, 0x57c419b1036ec0fa, 0x97b23f90e59380bc,
+	 0x949d890b87a2d14c, 0x5af5dc2f0dc32fbe, 0x04ad60cd7d53cf9b, 0x47a38086e64d7ecc,
+	 0x67ce0796c48307b0, 0xa44282b034404e14, 0xd6df52689a95ab07, 0x9e38c40ce8583693,
+	 0x38352a63140385ec, 0xf4393b378a02c7ce, 0xe38269e7a8bfc1dd, 0x3088a773843afd9e,
+	 0xca8dcf7d0878b069, 0x7cab46d00110287e, 0x75764b784cd30b1a, 0x8c8729015d965487,
+	 0x17c2d9de61fbec2b, 0x66bef97932b23a33, 0x9b1f12bdef219a92, 0xa85369900ec94ca4,
+	 0x95371c42b0fe2c94, 0xcb41faddbabedcdd, 0x0aa76c6d4cfd6ed3, 0x1fe2a69f257a426a,
+	 0x7e84a2d4200b140f, 0xa267d83d62007e6f, 0x3ee20afeda41c5f3, 0x0381abcc4abe4e52,
+	 0x441bb831c4adbf6c, 0xb61e091c6617f41c, 0x3dd46b5298dc624b, 0x736f80b96423b689,
+	 0x83c02d4807ad10c7, 0x43bd7e884d826b9c, 0xecdbb59cce86a2cb, 0x5e4cc7e545356a7e,
+	 0x1a0cf12b03700086, 0xe40827c7939325e7, 0x0d8de0ad2153ffc7, 0x7374f3ca0774cc92,
+	 0x274064d433445e3f, 0x23723375e636aca0, 0x3bafb0a221400105, 0x24bc16dff277096d,
+	 0x6f159a45358dc3b0, 0xe9752462cf161b4a, 0x28dd861204ae05cf, 0x0dc6d0419054b9e0,
+	 0xe5f66e30448ce96f, 0x6980f53f3f86de35, 0x2ed172ebf65869d3, 0x48d72940c7cb81e2,
+	 0xaae443c83d8147bd, 0xe0f6579427050f6b, 0x6df8c86edd98d8e5, 0x10cde9fbc54b2c2a,
+	 0x741fd586f49380a3, 0xdc06c1a95c8c2766, 0x626eedd74064a8cf, 0x4fd714e6991ad23a,
+	 0xcf186fed90093cf7, 0x49b967ace5a64af9, 0xe7f5586d662b8ec9, 0x60923c7d46a9d696,
+	 0x3178b7c6d49a0d43, 0x52f9ae3905cf14aa, 0x41101eaf95de4d77, 0x44abae560cc08f75,
+	 0xc60e46c562debb3b, 0x4c641ca1bb657632, 0xc33f4b83ab5b16c4, 0x25b6c1b23c4cf7c1,
+	 0xae0639d7b4cee3d1, 0x524f167b18ccb046, 0x1d420744bc8899ff, 0x0716f6559ba0e482,
+	 0x36968665ec15237a, 0xf243fa885fe90ae9, 0x0544631fb745f9b7, 0x1ca778d18f41ea47,
+	 0x8a9f45920abda486, 0xbadbfb4b14c0c4b2, 0x1d6e18567086d623, 0x3f8b8d80798135cc,
+	 0x3b62c950fd11200b, 0x99be8f90ed6642ac, 0x1ab48e3d835208f6, 0x5fbd430c0eaa04a3,
+	 0xcddb06dd1fcc323a, 0xa7c6354a145caaf2, 0x1e8b0ceb7836965f, 0x5e5df8dd56592f07,
+	 0xae358cb2f7b1ac9c, 0x5f3db45258e7935a, 0x21ff121af6b7562f, 0x257b512a94946d3c,
+	 0xb15f0b4adfc0f655, 0xee96bab8e46da2c6, 0xb7004af464b8c346, 0x7c774dd142b716da,
+	 0x5bcd6b508f2d5c68, 0x6021bd8b95dee02e, 0xb392061af4d35690, 0xa3f7771e5f8c5cd2,
+	 0xa6a6515cbe640960, 0x2c0d79b7645b8e4d, 0x347954cb38c16e17, 0x7980375ef9800510,
+	 0x0991d40a014ebfa7, 0xbe7cecd36c0d7232, 0x2ba6c20b90789def, 0x4c6a84964620638a,
+	 0x93f3b41f53a880ee, 0x6e595c805df40325, 0x85f4163a66b65c24, 0x29b56b63584274da,
+	 0x3159dead10ddf066, 0x2a0b17962df3e9b4, 0x0b62de1a0c2e0539, 0x74b2d584a35675a3,
+	 0x70dccda957d13858, 0xdf53b77ebaeb3b68, 0x436e63db7c498fa7, 0x58034126199d3f2d,
+	 0x8da0c01600340af5, 0x68eb960ab69a0671, 0xbf320138f541a297, 0x21d307b836733028,
+	 0x013f0944bcbf088f, 0xbd7cbe34a4c9d98f, 0x3355905d2b558853, 0x9f51bb910fa54a8a,
+	 0xfc4bc2da8ea31c28, 0xa9e7758ace7cbaf9, 0x7972c430f056b848, 0x36c1c059ee5b2472,
+	 0xf9a099629563e861, 0x22f844fadf8aed99, 0xbdefc0192c132de9, 0x9a7302a40ccbc2f5,
+	 0xd23a39a2387309b4, 0x67887093837918b4, 0xb13148a7137ca310, 0x47d50ca39d111b9b,
+	 0xe77bafb890a9b48b, 0x1696772ac0638abe, 0xd1d6d278dad8dc43, 0x3ba6db051e871787,
+	 0x7d9cd3c36f926b4b, 0x5509d2b364254002, 0x08ee3878e72784cc, 0x7564db4b0c53a015,
+	 0x4583e8bd3d13ca7b, 0x8aa36423c811fbaf, 0x9e59ca7d99f10952, 0x13b74416ec0c9340,
+	 0xf4c8d9237674fe14, 0x66cdef87732c0e60, 0x5010d4633546df75, 0x7a48dda138118f17,
+	 0xd2bce90da295b3e1, 0x763e09f1246023b5, 0x4b98771888960ef4, 0x257836ca1846465a,
+	 0xd172cf57fe829fd6, 0x63d3541cd78f5bf1, 0x56ee9ca94a8f9a89, 0x7406445e7f69cbd0,
+	 0x67bf96f3a9f86a0a, 0x444e4fdb167ca117, 0xc00a9e5a3bc5ef0c, 0xa2ef9f3ecd1ac5e6,
+	 0xfd5a910a2f788fbe, 0x4672021991ae42b5, 0x79f096278b731284, 0x7c63082bbcf01589,
+	 0xdb7c8202d312199a, 0x234c03e5d7b2a6f8, 0xd769fe6a1705f36c, 0x022f1a07f6fe6e66,
+	 0xaa59a2e48507bd5c, 0xa88cf90b110d2feb, 0xaeafa628de990cc4, 0xa9f4ee17c68b4add,
+	 0xc2c91a70b177dff9, 0xc529f908ecc2296e, 0x33b3523628845b03, 0x7cf9adc4ae83441c,
+	 0x6271ac99cae865bb, 0x810eff405f3d5bae, 0x0db38e0729a2fc49, 0x2a78f59db205ea87,
+	 0x2450eb0c3851077d, 0x995f75dff74f75fc, 0x01a3d1f70c022a88, 0xa573281772c3a62c,
+	 0x5c48312087231c2c, 0xde697f758cbf4aac, 0xa567d58ac48c7d02, 0x4207d4fc85004479,
+	 0xcdf90e74d9338864, 0x20d9e927270408e4, 0xc39a603b541cae7e, 0x01d839ca25080a3b,
+	 0x19f172ab1aea95f9, 0x2ac9ae9aee4e78fa, 0x553e210bf4a87149, 0x728ec67278bbea84,
+	 0x53b0bb1ee9e1d997, 0xb435e39512fd1aa3, 0xec861ed62a08b7d4, 0x702037e6ace55fbc,
+	 0x99985ab7e0c8a70c, 0x17eb765c2ef01a18, 0x0d9165fa03e3d90f, 0x261fadba98095c8c,
+	 0x12762b1d7a5d59d9, 0x511fe994f29b17dd, 0x6bf2b9414fdcaf5e, 0x7b9f43d2243cad3c,
+	 0xd8680a79a0a2f131, 0x047fc9597fd9a7bc, 0xbf453f2ae660226d, 0x7778caeca07bf9a9,
+	 0x6a60bc3125e7d934, 0x249380f006d579ab, 0xf8b1589d44695275, 0xb2a8950db2eb309d,
+	 0xd0ca7b5743ce3c6d, 0xb421b1069736c3a0, 0x4e4e88d9d341e287, 0x390cd432beabe931,
+	 0x98cc6e68ca948465, 0x8140e80b30f29477, 0x5615981b1363c54e, 0x96a54320d2664f81,
+	 0x3e6f007b18e46ba4, 0x26566b141d8dc814, 0xe98bec6c94caf4cc, 0x0d5d50a645e7a6ed,
+	 0x9096a2d521d3d647, 0x2fb7030d398d8398, 0x45db1280f10a11a6, 0x07dad20f7051694f,
+	 0x9e1b77163080b70e, 0xfb0a9e0fc7f01cf3, 0x9c26ae17e4f4a9f7, 0x59e1ab0e8770a379,
+	 0x9950f5269eed7e0e, 0x0d13d4f38dce09fc, 0x4bfdb5ea7b0ff698, 0x01a1a77567630f53,
+	 0x83554a77bdc37df6, 0xc4c51c0e394ea33d, 0xaa20d64149be03ce, 0x00214c5c62712193,
+	 0x751a27da731c2e8e, 0x2ab2536b481cb6ca, 0x3865cc7377e8187a, 0x4b9e73302e8b86f9,
+	 0x7cae01a3bcba0e41, 0x5192200ec5bb38dd, 0x792ec173336b2671, 0x5c9df6552b2baba4,
+	 0xda172580d43da4b4, 0x8c52e2e32638a2a3, 0xba799ea70e24f535, 0x42cd6b5048e46c8e,
+	 0x81f8d8fd8f1367e6, 0x406b08499880ef34, 0x539179c50787145b, 0x70c163a3c997ebb1,
+	 0x1f32da10f8004976, 0xc9d89c0b4b61c7a1, 0x74b929abbd8f0b2f, 0x83e5f9ece05a1119,
+	 0xdf09f29777deebac, 0x7cd3fef524cd55fd, 0x58039aeb9645dfb5, 0xb499a5f59518b1ce,
+	 0x3fac4727f49327f2, 0x58bcbd913e757e34, 0x33b0a13c7dfb45b9, 0x6c08c4f9db4f55fa,
+	 0xafba9c4197e9b1ce, 0x81b2c415bf917e31, 0x2da2641721b45ef4, 0x1645fddd3ba2f1c5,
+	 0x78e245eff9c912e0, 0x22d71274838d87be, 0x87c43281d7cf46ab, 0x7264732646f0228c,
+	 0x8a77874f94437039, 0x720903b4d1772a77, 0xda87ab5dbf7cc85b, 0x2f0261986f87c8dd,
+	 0x7345e9bf7ced95c8, 0x709d6f2598a4ab58, 0x903dc1b6044609af, 0x94eabd9a02689f7c,
+	 0x7f786b32e0781e68, 0x5b39fe15b90a75d7, 0x3eb952ee5934bfb3, 0x1c9111f42b453c7d,
+	 0xb21fd8289e6292a9, 0x685c392305dff3c0, 0x150f3c763642de52, 0x15ddaebd6effc878,
+	 0x50985fda0bc72c65, 0x3d962833cd3163f5, 0xb627bb82c39ac593, 0x208559989e99daa1,
+	 0x1cd1566b92ad73f1, 0xd019c5ba88de1890, 0x87e20b712d0d3ae7, 0x75fcdd205213d4df,
+	 0x753577a316190dba, 0xbfb8013318982fa4, 0x5a0892c3b1de82dc, 0xb5655fad82ff63d5,
+	 0xecf752d93d259619, 0x313d7a0fc72804c2, 0x8431fea915919e69, 0x6f822b5d5b9a98b5,
+	 0xb1251af93f9a751d, 0xcd47722415602676, 0xc357491802fc9849, 0x7ed03a42270b3395,
+	 0xd284e0dd3185cc7f, 0x139bf6295b549cef, 0xc90b845275546cc4, 0x96c0b7cae520c932,
+	 0x89ab31e30e8bac61, 0x649c7fe9ee482432, 0x92091be02c90e2b5, 0x7e432751191a4359,
+	 0xa9c8d3c0be99c5e3, 0x13257329206fc565, 0xacc5688b5a5f2561, 0xad5b378a91d90aa8,
+	 0x2af1b32080a26660, 0xb140cfb459d1aa6c, 0x77803b90c310c326, 0x3a4af6a5073b8836,
+	 0xbc1c2a160fab06a7, 0x343ab6c790e43ede, 0xb57084ac6af0e127, 0xa97c3d93d6d41456,
+	 0x0c4189e63d44559e, 0xd40663498a4ce4a5, 0xe9bbfb2a25db7be0, 0x8924096c7dd3c236,
+	 0xaf7003a1dc54ee2c, 0xcd7946b3d47af50a, 0x89789d9f3bb9dfc4, 0x987e3b2cf9f1d6f8,
+	 0x6f65431c96c5beda, 0x902183ba4ef0c725, 0xe69b39337edac0f2, 0x26c8a10cd04b1a4c,
+	 0x09fccdb3ae0c218b, 0x18589950e770ace3, 0xee541b449ebc0a7c, 0x92fe8759efb9d5b0,
+	 0x48b6cc78419d3a80, 0x1a35091f8df86056, 0x7496de62e91a2794, 0x1441a4d471eb77bc,
+	 0xf6b0c50dbfe30685, 0x5da1d03fc0d8d6a6, 0x2bb18a825033e557, 0xb2b2525582f8e556,
+	 0x5210462bf406416f, 0xc14d575ce807b379, 0x23fc913170a65201, 0x894348e441834066,
+	 0x82f20ca2052e3fd5, 0x69022bcf374fc9e2, 0xdaf4cf674086430d, 0x5cfd9c9e8f50f526,
+	 0x179f514a26f58e2b, 0x7b8993413508fac0, 0x7520f8294f192eef, 0x57c3b0bf375b9dda,
+	 0xa183e0a742896e03, 0xc229dd0cb861c57d, 0x9105ba8289d9c359, 0x5439c3f2740daa0f,
+	 0x1e02fd218c1a45d5, 0x82cb98f33e036575, 0x18cf2f94b67dc0b9, 0x116f0e8e2cb54288,
+	 0xdacfd42fd57c175d, 0x9758d021e8c7670d, 0xed9c41cf1e8dc1cc, 0x6e6132f8b9a3cd15,
+	 0x393831843176f234, 0x4ccbb01f024ef241, 0x3fef3f00e7bee361, 0x06af370b76148789,
+	 0x1940311f615474c8, 0x1cb5285e992f0325, 0x23cde36191e6f542, 0x92d5d9baeea15f5f,
+	 0x178e337e710d8d1e, 0xa29883c3658ebbc0, 0x35000a57b9b0131f, 0xa46473e81cc9d9ae,
+	 0x600117304b0ddf8b, 0x0d127f4d3dc495bf, 0xce508c1dd8b93ad1, 0x7034953136a0cd48,
+	 0x5730bc9ac5d830cf, 0x74d8d182add9c858, 0x470c102d696b5e26, 0x55c60a7ef36fcde2,
+	 0x5a499c69703f39ac, 0x6fce13d2d7348636, 0xd2632c790facc5bf, 0x28ca14aa665b5917,
+	 0xc9de8f05600de263, 0x529b6aa9c8fab1e6, 0xdb4503c9fd6247a7, 0x703dfd18f1e875c4,
+	 0x05437bd71317a10f, 0x43671057ad8634b0, 0xda35e6db124bdf85, 0x9cbee6b8d080adab,
+	 0x956bc05178da4ce7, 0x858e809ea4cf9290, 0x48fc6f8b5cd0e7ab, 0x98d888f8217ae738,
+	 0x6c8d856025aef8ad, 0x53acfdd8dfaaca51, 0x845934d91cc7c4e4, 0x08a50f657ea7ae7a,
+	 0xc7f69eb8659ef934, 0x2b976672481e148a, 0x66b1fb3522066186, 0xa0acfc31ccac814b,
+	 0xd4affa1f27832165, 0x2337ccd787db937f, 0x59632d64da1ea8ad, 0x6b4ae903f857af96,
+	 0xf535fc193786198a, 0x225048ca46005bdc, 0xd5b53a5145e9db53, 0x55b23edc9dab4b2c,
+	 0xf13b041169252634, 0xcbc6538e243ced54, 0xe7d41250af8b22f1, 0xa52b29edea5043d3,
+	 0x807ac8388c72da82, 0x6511ae1cacf06939, 0xa0ee4fa8fed574d6, 0x4358b7458d3d641a,
+	 0x800cb0a3cb497cf5, 0xd2f30d4f0f11d58d, 0xef78061c6a3cea31, 0x6b19520a89705a08,
+	 0xca234c48dc60b5a4, 0xb0652d6b951dadf8, 0x70fe1594232e209a, 0x021c9a2648c1f0cf,
+	 0x4fc97977f1fd9f7b, 0xa155eff2785d34de, 0xa7a4fe8f66a6162f, 0x9c532cdcbb1371e6,
+	 0xf60346dfc4c01692, 0xfe6352d6d6070853, 0x1df61e116897bb98, 0x98c071ca1ff4f057,
+	 0xde2fc2e94bdfa057, 0xc6ca162c46aa3cba, 0x85d94f16f5cb0b9b, 0x68ed705a38bb15d4,
+	 0x85050c077c071512, 0x38e276def086b6d4, 0xd9bd7a7cb8ff669f, 0x0499822fe5e2f343,
+	 0x8aa1d4553974e526, 0x0fdd6e2db7ed093d, 0xe5b8e7df731099db, 0x967348243ce2946c,
+	 0x806469dc9f2f0b34, 0x205408d8f6126cd0, 0x21e74d2e8308743e, 0x716842c0bdd302e5,
+	 0x4cd95a97ee8e4452, 0x894617532e91b3d4, 0x543b2324c4122962, 0x13055b3e1b676d25,
+	 0x1844948c31989687, 0xf9378d6c2867677b, 0xcb7bfd35cc9f0423, 0x3d1e32e7b88f5ecb,
+	 0x2a8aac120c60601e, 0x27851552c09c0cc1, 0x0506f25b13d95777, 0x3a2e53a2df7f8d64,
+	 0x7f2eaf3901f7c7ea, 0x1a65fce4ba56d8e2, 0xdbc2bbfb1d078740, 0x5aa8a7b9b234be94,
+	 0xecf2c049c3558ee5, 0x22ddfe224445206b, 0x54011caec037a510, 0x233ce4407a2c5073,
+	 0x5f851d64d544ce0e, 0x631be1de2c6061c6, 0xacf3b657a244aae9, 0x17b85ae7cca8ffba,
+	 0x0813f80c0cb0ca14, 0x1da2b5d449ed8cb0, 0xdde1ffb235eb8a8f, 0x6cc5aad2c45b7b5d,
+	 0x7b33e1674098440f, 0xe0e785b286f0a082, 0x37918035fca771df, 0x305c91087289c8a1,
+	 0x8465d3e79d2ab3ba, 0x9b871ba331e400d0, 0xad38a40131842ecc, 0xb306c2c71b1a5b1e,
+	 0xee26489d0ffbce56, 0xeca8bab01c312109, 0x6009938c2d99fa9f, 0x6ba718a146749556,
+	 0xe031ba217fc42674, 0x9f8dd4b9dc6e4f62, 0x5bce313d26f176cb, 0x8fe8969e0e46bf33,
+	 0xa33f8f1031d28c94, 0x9b84fe38b104a04c, 0x4fe71a89d896e358, 0x25b41cd1e323cb55,
+	 0x45763232d2cb5ff9, 0x30e162ee4b0dc15c, 0xca8d3f664f3a41ae, 0x94867bc3b9415674,
+	 0x4c8d6a4ea0a27eb0, 0x0dd46fdfa8736b83, 0x1ba0524c433fd6e2, 0x5f87c64e22220136,
+	 0xb24b648ace5ce24f, 0xd79f8deb2db24104, 0x03f1d00011376aac, 0x01ff4c02dcefabea,
+	 0x45a430bcc63288df, 0xcdbbdbebdf4ba7ce, 0x939dfd5813c300d8, 0xb5198b7b8b6f9691,
+	 0xd3da03062a5b0337, 0xd031a55c8d696c17, 0xdc1467fca4a04d00, 0x46dc858d5f76ca88,
+	 0xbc4339c9976e9a1c, 0xd1d5bd0f9199fd79, 0x664dd1265aa554eb, 0xb4037b1f17511854,
+	 0xa7045b6da0d60e30, 0x70a38f42973725f9, 0x81286ef87882b42e, 0x1af78ab7504d0d00,
+	 0x8366039aaf10fb7d, 0x465b0382fb9134ad, 0xea70a2cb044b2b3a, 0x713299afb22505e8,
+	 0xe147b352dcefe9ad, 0x50f1c77c9f471114, 0x0a88e09c85f058d3, 0x35bbcd9f60330e2f,
+	 0xf7c61d4fae99a243, 0x815f098ad18dd6af, 0x45f0d9efb3c1c0ee, 0x895cd98c3e6bd21c,
+	 0x8192620517d9e47a, 0xda910c1f5e7da1f3, 0x413dcfa2d51fa28c, 0x17a61f92267c1ee5,
+	 0xfb1f2d638c802607, 0xc6d83d20e15cd320, 0xccfe3810a1a9cf4a, 0x869e56b395ebd134,
+	 0xa02612f0b085d6b8, 0x3133387a99a5b335, 0xa216c81ad7786c8c, 0x656dd5c7ad7d7ba0,
+	 0xcaa6fbdd7f57741c, 0x760c523b2aa00744, 0xe3d732e8da2e93ec, 0x2d76c4c2d3c18e2a,
+	 0x363363dc5b3fd4ab, 0x3f994355da096a3c, 0x53558ad4f68f7b88, 0xa2317fe22e6a95f4,
+	 0xe905e3813db5a8b5, 0xe21742354669afa7, 0x1628dc7abb2eaeb8, 0x1b33844837e48c98,
+	 0x571208709e1492dd, 0x9bfe6f2b932f751b, 0x04b38543b028cc8a, 0x5c0f4b6eb3042c76,
+	 0x08badd43c906ff8a, 0x81e41de8441e27a9, 0xd01c16481ce2cc07, 0x6e7435adf078e297,
+	 0x7e693116e62be598, 0x52a25ea527b1ea7a, 0x5aa552c065b94503, 0x67f62e7e293e1646,
+	 0x3ab1fa09912b2662, 0xb642b2ed2687be15, 0x63ebbda875483307, 0x5ce3f9e1d55f27cc,
+	 0x42bd22dcabe96d36, 0xc893d652b7ee4011, 0x3976d251436629b0, 0x398db27317c9f853,
+	 0x95aa8ade047acdda, 0x97a552cd3995e26e, 0x648f57d9567b3d9e, 0x46a4c749556ed6f9,
+	 0xb7e580ade1547233, 0xfe8e0d8c37af8e49, 0x4cec8de6ddb2d437, 0x8bbb4de977c9784a,
+	 0xe15efb1d5a90b88f, 0x3b3ee65a3d94b207, 0x397ecbc54575ee13, 0xaa9645121b2571f9,
+	 0x667714b1a93eb9e6, 0x72362af386cd45d2, 0xd49f77b2169c991e, 0xaa03c326a1b2b517,
+	 0x58cac11e05d5f97e, 0x5c934698359dcf41, 0x5a0eebb5b1af8b53, 0x7b24559aca612f2f,
+	 0x7342fd4b5e928d63, 0x469c74671cc8209c, 0x2c64438a604541e5, 0x6d22957a15d63e81,
+	 0xe96bf11f6297811a, 0xc7b4ed9187d84bc6, 0x60de88592c07f989, 0x9cf0e5cc43586dac,
+	 0xbb83af040867ce50, 0x288e5d374210d6fe, 0x842baed1377dba28, 0x367841c79c3a0845,
+	 0xefbe5c8ad1d7fecb, 0x5f0357eceaaac98d, 0x35e9c7eb2ee20128, 0x1355971d76cb482a,
+	 0x960af9f583291cd0, 0xc6df61d634f8fb0f, 0x635811e1c11c5365, 0x61e6998d9c3e97f1,
+	 0x87f4ed82081fa55f, 0x3f26a83d03a261c1, 0xa3474343a7b17bc5, 0x624b68bc1c6a74da,
+	 0xe7ec1a6fd3bcbc38, 0xa464b622e97e12ff, 0x77cea4e8bf7335cb, 0x23d465a5383911a6,
+	 0xec796e81b9a4e79c, 0xa2d4268df07234cb, 0x499c5886377fd904, 0x29ff31bf1dae5493,
+	 0xcbe7e9cf9fcf0a09, 0xd84b1434b331c5a9, 0x2fb19f6bff451d4b, 0x559ab25ac8b22cd4,
+	 0x4913cc8964107a37, 0x8ea5e486e3e7ac41, 0x7f77d93f0a5b2f67, 0x403b9ae1abe52f35,
+	 0xe71fcb18517278d8, 0xee761aedcd11d3a2, 0x46ca2a8886ef12ce, 0x5fae77c9f8e7b94a,
+	 0x901b31815a8e9146, 0x8c51bd9a21ab8f2f, 0x5ec8f7c1d7e22355, 0x1b1c39e5f6cccde1,
+	 0x966e4a722d342c39, 0xdddf9372a50cf758, 0xe0dfac1cdc7634a8, 0x8d6d8518305d6491,
+	 0x3cc22ae720eacc0a, 0xe32a9ab9cac1a899, 0x1a3f496fd79545e5, 0x2e4050ba03c7de59,
+	 0x74bae52ee208ea7f, 0xa781d216dbc37e62, 0x5dd37a3c7f166911, 0x272a00419aa73dbf,
+	 0x2f5f0dca418939c7, 0xd702cbd809dddf74, 0x978da673790e1179, 0x0177920bc1dd6ef0,
+	 0xc57486fa2643dcb7, 0xeae2ca8544d320af, 0x95ca34a379c27b61, 0x93d1ddcd5b629593,
+	 0x4b9c63c58143de38, 0x62fa07b4b7176d93, 0x18937ca123a79973, 0x5216b2ea3477c645,
+	 0x5d3815d3798e8b75, 0x8dae10c33b537ec7, 0xdde1afb860b90888, 0x3b8837ccfab96375,
+	 0xcecd35ace0b58f58, 0xe72aedd33469703e, 0x6b08c023f172a5d4, 0x6ee593a0a117c940,
+	 0xba98a6be8e88e9ed, 0xdffe86cb41c65ee4, 0x34fbd4bbf37e3d78, 0x24f51af54e50ecf3,
+	},
+	{
+	 0x3b7639456b2a4167, 0x44686e6d11faf413, 0xc2f8a913f3b16c9c, 0x4cff6bca0242ef29,
+	 0x7e2918ab38fa8051, 0xd7d43a0d733dc51d, 0x9a1768ee02097d51, 0x7e43628c07a91056,
+	 0x6a49ae0edfb19507, 0xf999bdb613d88d46, 0x86cc05dbd4d4d8de, 0x59b45d9d03e66387,
+	 0x1b7366f58273dd88, 0xbb4169c68d108c66, 0x53d6ecc92869f237, 0x9c87aefa75f82542,
+	 0x9b9d3755bc4b4422, 0xa79610443078e9d8, 0xdbc4bd374013a907, 0x1e2fc06213904ff7,
+	 0x54e55cd39c1ac4ce, 0xdd6d56a0e78fa42d, 0x014ab8d526f58ca7, 0xa50e3e2ea7287767,
+	 0xa8365ae332d22e09, 0xa3626574369d3e03, 0x58c316ee151fd5ed, 0x645527bc67c45bb0,
+	 0x970993e135b22b9c, 0x4f80d07fc172ccdc, 0x7a1fd762237403ac, 0x0e433bfbb4ba75ea,
+	 0xe2fe7871aabedbbb, 0xd09ab88dfd3b0d5e, 0x21bf4064f1bb0788, 0x8daadf4627cac598,
+	 0x338cbd19e0f9bdae, 0x7274e22025405cea, 0x64f90e2fafb9047a, 0x0fb0fa940626cecc,
+	 0xfee9e76975f116e5, 0x65c810e0d5836722, 0xae93880afc0c0fbc, 0x4d24b86a35145cce,
+	 0xf1f2cce57e0ea3aa, 0x41ae93880086d9f7, 0x32c51c43a2b3660b, 0x9e0b19e53806f5cc,
+	 0x85f00a40fb60edc6, 0x1386323870c2a485, 0x4a08d5c92d41fc07, 0xadbdad65b419dde0,
+	 0xf7b106d744ceacbc, 0x1dc14713cd6ce21d, 0x790d1d4e82c49a8d, 0x8825387f7121403c,
+	 0xf574b0c24868d965, 0xcb30fb831ec1b5bc, 0x5b9591a72d665404, 0xa994a0480c1ce23f,
+	 0x2c2c474e1333e061, 0x535c610286ef17bb, 0xb217d0687a925400, 0x4e20dd4bac4afa23,
+	 0x10655f73c63dc915, 0xcd5271f8aef4d2ff, 0xf21ff09d13f074e2, 0x19fa9c87cc06cb81,
+	 0xff34082e6c4c4207, 0x1eef5607f258d249, 0xfdc570612df4c312, 0x289be7f6fce0a962,
+	 0x4395522106f538db, 0x7f3317d4c95f8f2e, 0x539a1c07d9486c0d, 0x2bdb07601859c12c,
+	 0xbdb3d46f5086f210, 0x3797e01445d3f64b, 0x58656c6238cb7215, 0x22e07e13fc3c2816,
+	 0xc581db8172421019, 0xc920b2bb84bb8479, 0xd4cc7015304a5ff6, 0x90c1c59f526e0864,
+	 0x53be106da97e0b28, 0x3d2051f210b57af5, 0xd463d1140ba906e9, 0x0334ad6b92d97e34,
+	 0xcd3fb7d9a6e3e8dd, 0xd20cbdbae35cb823, 0x0c4617c9e5b2a4ce, 0x1467c5d8b7125699,
+	 0x823e84be3e682511, 0x12e23304f62d8d00, 0x95d907547ac2bd62, 0x268198fb0a8fb481,
+	 0x3206ae5a39103bf7, 0x0baffb4d5f80999f, 0xb8f27317dc727cdb, 0xa2378a82db8a0f32,
+	 0xa4b9521fed981db0, 0x16d7ac44115327fd, 0x6f6a68018065ae7a, 0x1cb4fe786d42be5c,
+	 0xa13445b347f7961c, 0xddbd6b4f07f878c6, 0xb9c22d8400fdd7bc, 0x041ce65120c284fc,
+	 0x476461fdf3320e41, 0xeef84176326710f2, 0x89646ae87801fff9, 0x145fde89fc7ee492,
+	 0x0d3419b33dfa5c49, 0xcedd0d05da47398a, 0x036dc60fa0e673c1, 0x764513a260ca9bae,
+	 0x0519e26200107198, 0x41ae49e2b3e0c1c1, 0x12d142c7e8288f5c, 0xaafb1f39429bf4bc,
+	 0x5a06b447c49846e1, 0xd5f43e8bc73f818c, 0xc0eb8be28dce3d5b, 0x5acb37ecc90b7a90,
+	 0x1b961ccaf48f5f12, 0x2aefdb294e1df335, 0xb87aa0ea324bea9f, 0x4fc5f01030b391f3,
+	 0x9ffd828ecb538589, 0x54459d0985a551dc, 0x57fd6bb9b296ad98, 0x2cd0d40ea086e90c,
+	 0xd9f31fe07f3fb21c, 0xd0ea73d0cea82d10, 0x534a709c8ac1cdac, 0x9ad852a19ba80477,
+	 0x4842fd8af3634af2, 0x4e989cbf5d5e67a8, 0x7c96fd6d8d1ed3f0, 0x76d7448f33396356,
+	 0xef7bb0c460d7054b, 0x48ea16b8e82b757f, 0x3a3e02f4269eb488, 0x18de92836f35f8c6,
+	 0x9acf0b83781545c6, 0x0c57a917ff8606c6, 0x4c2d2ce5cfef5a75, 0x0f5f59393230f567,
+	 0x18da02bfaee6f6ec, 0xe604ab57660067da, 0xc88e940d7633e677, 0xab9170f4eb6b5b2f,
+	 0x0b27ecb009ced439, 0xe12f08b12e42e382, 0x4619a312273f3588, 0x30e194b1001b3cbe,
+	 0xba3c7bd8e40f0cc9, 0x45ac00f1b2912fb1, 0x8689e9e06d1a6d8b, 0x293f7893743f83d2,
+	 0xc85c775527b9570d, 0xb9f10f8d6af396ce, 0x7a2ebc16b054c88c, 0x4024b0ab2fe393f6,
+	 0x38f41555ed0204b3, 0xf3dcdfe21915721d, 0x46f96af55f4cdfa6, 0x7ab9264f1aab3ba8,
+	 0x174abe211f4b8df1, 0xf20e43415082d328, 0x7416d95cab7815a4, 0x0e1cd06446649f55,
+	 0xf5e772ad7b23ad53, 0x19a65e75430d1b01, 0x1767c6781418cc29, 0x44b65e712f153a46,
+	 0x578a408e08467093, 0xa38ccf2a67fbcf33, 0xe95f235593ec1380, 0xb25a90758c0244f6,
+	 0x1adf97c9dc8b250c, 0x3553427db5800c53, 0xdd8dd7bd220af1b7, 0xaa0cd4b9c7e46f8d,
+	 0x39ae95b10985e856, 0x480f74b6ce976b36, 0x0a9c0961463cc2dc, 0x7b5a77c2341469f4,
+	 0x11697d586e8bae42, 0xe72aff46a4fe34e1, 0x8f07049a14db3d71, 0x3d0b06066a44bf8b,
+	 0xacd2749be084efda, 0x35d3497e123c1be6, 0x184a28ce017617aa, 0x2fe78948a9042a86,
+	 0x71d25b5d8f02eca6, 0x5eb90d68ade8bab1, 0x223307f619c53d50, 0x50b3425a5ef63216,
+	 0xfd2f43d72424d2b5, 0x6184164fa6b27b9e, 0x3ca2b40f6a1f9e41, 0x7f6c86ea518b1801,
+	 0x9de3c2f02b1361c0, 0x733bea33c5148a50, 0x650a6037f37d0903, 0x3a27e54fd91983a5,
+	 0xf40ba07eabb54104, 0x499701a54840b9bb, 0xea6cf49976659ce2, 0x865915597e036202,
+	 0xf4df6c87a20e220f, 0xe905c07d246ab0ab, 0x125cbbf5353b8468, 0x99860250c8884287,
+	 0x074043e2a73a4ada, 0xda54a8895a519a4b, 0x463213503d6b826d, 0x9cc578c0a797f6b2,
+	 0xf1013186aeab7c9f, 0x3c16d7395491c558, 0xb46ff42c1d656d7b, 0x25d40ea6d653e547,
+	 0xce1308a5fd2d6c5b, 0x77453c9177183df4, 0x1f728101317abf5f, 0x988cdc9f5dd16ab0,
+	 0x967a08d32986d0a1, 0x63efaf88cff6dcb9, 0xf4f75c4d6a5c0926, 0x8f1f2d1203414f7c,
+	 0x0b6e721dbb415cde, 0x74230c55f7eeb2e9, 0xefa69c28d5331487, 0x309b67e26de1138d,
+	 0xf46ba07477a4af1a, 0xd6d0bad13c721337, 0x3b255aeac2f44577, 0x4b8c96b37fa2ef72,
+	 0x8ff8ba062111ed85, 0xa1246f9205c5d957, 0x8f8b7b443b6a3f30, 0x7e280d47f097483d,
+	 0xbc44d1047d813776, 0xd43a2942d7c5bb56, 0xeb894036b1e0a8b9, 0x6f8dbcbb5ba92eb8,
+	 0x874c61c11aa57698, 0xcd7891d7aba6d81f, 0xc4317403be70f1a2, 0x35cebb6d42917377,
+	 0xfa3039e507defbad, 0xce487dd6f135cd54, 0x249104c1d729265e, 0x461b5c78f80754c5,
+	 0xe962544f75a9318d, 0xcc9bd96c6d7eae14, 0x966de678d00bd011, 0x59cb2c050cb8c58d,
+	 0xcd4edfecef49a23d, 0x9a902b289eb1d60e, 0xd92c57cfbd11a3d2, 0x57717bb68708128b,
+	 0xa7cc52d8eabb7d61, 0x8d87ebe42652898e, 0x81cf674054922a88, 0xa77f1d4f658b6b02,
+	 0x011e6641c24ddcb0, 0x949bcddf701cbb5b, 0xc4afeddad48d4c87, 0x3a9d9d0aac2e58c6,
+	 0x715f89328f85d918, 0x01c0d74c4c1fba19, 0xd624bb15420378e5, 0x2d7eb787e20e991e,
+	 0x854b489dc98316e6, 0x63b8279ab4f60a7c, 0x1db13c5f42c16ae5, 0x7691ea6807144e4f,
+	 0xc267cbbe963753bd, 0x2a43665d24becda3, 0x1eb6ae6963defaee, 0x9d3ab7fb630099c2,
+	 0xd23da37a0ca0234f, 0x9b3f9002d7ad81cd, 0xe76b1beeb86df5b4, 0xaf0fa5d628b93106,
+	 0xa66a3c14d05e22ec, 0x9cf68dd99c375350, 0x0a7e01425333e852, 0x7c3fb603730ff0c3,
+	 0x9f33ca453ecbab85, 0x00044b59452c0862, 0xc0690e670306d0bb, 0x10123aff688122d7,
+	 0x409ed13b243af5c2, 0x46d80530bdd72fdd, 0x05aae4e51c2c69ce, 0x574e4b7ee621304a,
+	 0xe5b7c5926f61cbaa, 0x4d603fae56eb158e, 0x7b3e9d201e89413e, 0x6e1b977eadd8fabd,
+	 0xeccadc75f86708c0, 0x2ed1a622b46ec17b, 0x56cf5d34ba19bbf0, 0x2b32d4acfb8c8b1f,
+	 0x8ce45729eeef42bc, 0xef21d106f25e6b57, 0x0a273ab3b169aa15, 0x0c5713919a888871,
+	 0xc170f1f3ee154dd5, 0x3f9dcc181f88e5e2, 0x201b19575e0ced9a, 0x7ac5f05bfb7198e7,
+	 0x58e2bd58c123fe4d, 0x0b7c5eb993911c69, 0xd05f60e5401c5064, 0xb5f2f6c7eecbf829,
+	 0x20cfa2c394124d75, 0xab84d796bdb6c71a, 0x05eff41ecba83d6d, 0x4332ad18e0204783,
+	 0xd8a5e0fcd1de813b, 0x5746c742f1115476, 0x5646a363aa3b3d64, 0x2dc2d3a4552013ce,
+	 0xbc4bc17acf62be3e, 0x8b6b4465e778bf49, 0xef3c42af324dd8b7, 0x80340b4913cebd49,
+	 0xc0140a005d6da033, 0x6283286a964f5665, 0x74a42748c3ca0237, 0x77695082b06f4cd8,
+	 0xd40028439e6ae21c, 0xf9e346e254d33eaa, 0x96eef0563e8a5813, 0x677b2f7a4cf2a6ee,
+	 0x57177e6c58633929, 0x29566588b9c649d3, 0xfa7857556f9f26ba, 0x13d9ed73eb5ce9bc,
+	 0xb8a93e903592be8d, 0x8347fe9ded15e072, 0xd3097226dec58b5a, 0x5514ff85bb84c2f5,
+	 0x9e1fcf0ec87d38b9, 0xeeb3d64dfd319f0d, 0x154cd202f90015b4, 0x539e9139505cd370,
+	 0x6cc720930b9619dd, 0x751b738996d209c7, 0x98a062d5566795a2, 0x190f79d226624bc6,
+	 0x384bb0ea9022534e, 0xb703b61b41795804, 0x74f73b6af825d9cb, 0xa6fdbaeafe642c5c,
+	 0xfe86a5e993a20ee0, 0xabdd33c14eb75f83, 0xf6351ef772e4e4c8, 0x6a0d5c0ecb79dd2c,
+	 0xee31a405b05daca5, 0x1f0413a5ce9b5e40, 0x4382a4038f729042, 0x9c4f26c6b52562ff,
+	 0xa0dccf22a284a465, 0x37d555a7ac553fde, 0xa1228bbb84e6fe85, 0x3e55df4060b9dfe8,
+	 0x67ab310f5ca692f0, 0x545946582e2070d8, 0xc3d118a146ab62ac, 0xb36e12d38c3caf7c,
+	 0x16737717c16210bc, 0xc6533f2542d4f2ae, 0xf998a86dca2a18f3, 0x068c54f10fa5da84,
+	 0x06f72c207b934f23, 0x29388563e9b3562c, 0x685b3f6b10b29466, 0x8362d2c37a763178,
+	 0xf2138524cb5d53a8, 0x35e0324245bcee3b, 0x48f7530ad5ee8e02, 0x08720b905394d97b,
+	 0x5d04930b390ecd82, 0x26a54fff72f4d3cc, 0x088cf48031e72932, 0x33a894699321cec1,
+	 0x8d6de31c8ac379a0, 0x00d6cd3cdb96b05c, 0xcce3d94036395cc1, 0x26cfb48c0c96f77e,
+	 0x733c7d25c64b40cd, 0x762cb0bb0cd61c05, 0x4a9257946c525dd5, 0x3d600a2a7f2e3ed4,
+	 0x38d853026391cccd, 0x6977b17dacc1548d, 0x2c8785292f9e3d88, 0xa7e3d3cc9d60df62,
+	 0x10439455dfe2d903, 0x1ca217b3c9480a36, 0x3a85f323edf04043, 0x2990b66961b47337,
+	 0x6df78fb709ea27f6, 0xfc397add9b7ebb9a, 0x9ad71dab21650c4d, 0xa253a05eb77285a8,
+	 0xfd2b439f89c076cb, 0xe8bfb906f15018d1, 0x03a6e08c861ede35, 0x229cfea4c7d9b770,
+	 0xd11d8712b81e072e, 0xa811a7c139a61b6a, 0x9fd5242a94e72a55, 0x5363aee5faf0e5e2,
+	 0x2349cdd04926235e, 0x549ebb3d9cce4058, 0x8609c3689b603280, 0x44ed391ea7c73c56,
+	 0x606910f57efc3526, 0x16673f02270e6767, 0xe84a051a0db92450, 0x6fbaadec054ff7b0,
+	 0x21acbe78d13561bf, 0xaca24ed9ab18c742, 0x27451caedb907ab7, 0x6ddf777761b7370f,
+	 0x3f06fc8f24e7256b, 0xd109d06242437faa, 0xee14dbcaf648c2fd, 0x64868fb5bddf0122,
+	 0x6ded48f30872f14f, 0x009d05797bf8f198, 0x86aebd605e69cd64, 0xaeff34cd6fbcd4e8,
+	 0x1f172be76827dd91, 0x375b5968ef2f5831, 0xcf2c1d240e4ed85a, 0x2980dc149fb8c0e6,
+	 0xfb1ca52d50ef833a, 0xa674674918d977e9, 0xf85dda137a8a4f68, 0x60e4c3d39c1c5b7b,
+	 0x10cf9b55da316868, 0x7c8a217c1c1ea791, 0x4f0e6ec8eeeac658, 0xb03f469d31f00e9f,
+	 0x22f74c10716863b5, 0x38ebd23a4821f6b1, 0x5b03f7f5be6ea7c7, 0x383258500720b156,
+	 0x52fc71b701de2ce3, 0xa2a7968744cd018a, 0x6108a7dfb53dc060, 0x5599c1efcca1fa02,
+	 0xfaa637f333462182, 0xb05a58b03e54c49d, 0xf8ff34bb3e57b7bd, 0x7cb9539382a4e72e,
+	 0x1dee0754120afa97, 0x49dfaf48790c34b0, 0x594ba69d1b5f24a4, 0x9e0f665a6fa2ebff,
+	 0xcabc1822915ffdf7, 0x70894e099a0bd104, 0x5d3a3c9451724c77, 0x17d2a9586da902a4,
+	 0x1dc0ae47d990751d, 0x06851bf2ccf70110, 0xd03a935a197e790a, 0x8b9e2e55bf108654,
+	 0x897239696e1190e8, 0xe764e839f7093383, 0x86bb0a353784a002, 0x54c839bd7d6433c0,
+	 0x06d6f23c49495db3, 0x781702d4d21973b7, 0x27cb73db81893b1e, 0x92b0c1c18fd354ab,
+	 0x708bc767971663a9, 0xc7a95e961fa48a6f, 0x27f924d833379cfe, 0x1c17ffcc0fc5145b,
+	 0x66b686063358a1a4, 0x77121e732a1afa4e, 0xc552943a679df51e, 0x347d7a8649de691e,
+	 0x33ca21462ece7cc1, 0x4224da75f28bcc0d, 0xedf06989bda392af, 0x511ad72fe4921d3e,
+	 0x9b52b947eb73955e, 0x842eec5c1097ceae, 0x17005b5adbc0db24, 0x490ed7230c16b1f2,
+	 0x2d11d316e90477af, 0x74dc9985335deafb, 0x7fd3643817f25a4e, 0x39f17239301d1e1c,
+	 0xb411324d5a52ce65, 0x52ba09769cfc596e, 0xe5c262e8242fa624, 0x7338227b0adde5ae,
+	 0xda60527a4c87b000, 0x79bc6c452edf347c, 0xf4f9f0b244a519ab, 0xa0cc2a238057af51,
+	 0xd6595e7863f46218, 0x34a3e8a361c43480, 0xf4bc88cf3880522d, 0x2bc1c6404066b8af,
+	 0x5131b8a7593e3116, 0xfe1ed77db7ff6a2d, 0x127f0052b53bd391, 0x32a2368a8da1dd79,
+	 0xee72764ed7d3a68a, 0x79fbc7d9b753441f, 0x7e4928a8fe2aedf1, 0x5071be6e2c65c019,
+	 0x564a2c094b8031df, 0xcbd97767435d6b2a, 0x88b0d651f348706b, 0x6bb2cfdfe0503a35,
+	 0xd2c4acb1e73bbf81, 0x927c530872cf1472, 0xc694ec4083ab7738, 0xad7360aa3e7dee6b,
+	 0xc6bfdc561068785f, 0x2fd34b0d3a48d444, 0xcf12b45445d1cb0f, 0x1724bba39eca13f4,
+	 0x431a8a10b44c1151, 0xc246c16e885de15a, 0xd4c061831501788b, 0x30777912ceac03c2,
+	 0x22b2cfef3b24c45b, 0xa75990bd4b64a400, 0x3857793ae1375918, 0x7cda6cf59102aca3,
+	 0x96c991c78c25529d, 0xd1639752c02ecfa1, 0x98ca719316a8d746, 0x26d84e2f9a57ef68,
+	 0xea40ef632a2aafda, 0x809cc7c288cd7c72, 0x733087199ab724ef, 0x3e0ce2dd24e1922c,
+	 0x552106849d330d95, 0xad6a6d066d06adb1, 0x1e6910376660e073, 0x2f2538fcd8c9662a,
+	 0xe901734714b03c6c, 0x1df4afa51e1ad714, 0x454915e3179fdd7a, 0xac33e4206c0f56f2,
+	 0x00a8b20f236e9389, 0x15879ae115c8865f, 0x2d7d8d6861643ab6, 0xa051395c1c29bacf,
+	 0x0738d092af91908e, 0xf5c093da2d473899, 0xb8360b12ac3f1078, 0x2b6161f91602ccc4,
+	 0x553587ab91e7fdbc, 0x41978adfb36e379d, 0xaabe19c2028a8c17, 0x44a100240fcceb07,
+	 0x4a63662195ffc067, 0x07ce0d38d09f3635, 0xb1839c841ac3b033, 0x07a849d5e181ff7b,
+	 0x6565d8df77137ffa, 0x9d0b71fc6265f593, 0x7629c81857bc9556, 0x05ee19a5188ebb20,
+	 0x840145c0bed45668, 0xf887e1f6783facd0, 0xe17a96acea17c892, 0x6511bc494acc96d2,
+	 0xb096391cefdfdb93, 0x222fa76ee67d58cb, 0xfbd8906b6180683f, 0x969ed5cea72a0158,
+	 0x7f919a6abf1c3745, 0x96f25e29b0cba1f2, 0xa595cc29c9ec0d63, 0x6426bd17d8eb2f7b,
+	 0x3a0710e1496af28c, 0xd7577e6f1c927ec7, 0xd9b0451632f607b8, 0x40a3f93b6dc06ed3,
+	 0x56dc60090d14ab5f, 0x1307f1d8de5cd109, 0x40691ae29be52e10, 0x943658aa957428bf,
+	 0x4b4f26bac5cfb0b0, 0x55fdb0fbcb43a3d8, 0xc8dd1283ac3aa8d2, 0x5cd180a6ef2673d8,
+	 0x1a1cc17deac022e1, 0x58d0b821ac265c6f, 0x9adb22fa9110948b, 0x3ed5e70e193e8bce,
+	 0xf2453a92cb765309, 0x1f58b7e705d03ecb, 0xaa049c0cca26caab, 0x965151ee7094ffba,
+	 0x81bb701d91a8b122, 0x970d25e3677c3fe4, 0x33f2be16f9d96f4c, 0xa2cc9cc21d02290e,
+	 0x24f715550311388e, 0x19a3003fcf35c252, 0x0878bc5ef1f23290, 0x0c24ebd5b7d8ac1f,
+	 0x0541e59f11dfd997, 0x7ed3dc6c60435fc7, 0xc0cb7293d4248417, 0x45429f8b3dad243c,
+	 0x0d4812317616679d, 0x7b8bf0b9a5b2a791, 0xf3d80964ea1f8014, 0x7f10f30a38e60a56,
+	 0x746ae40fb7e99a05, 0x37a72f93941ffaa0, 0xfd12909e0ae260f7, 0x9ceff03ba053c21b,
+	 0x10bfba7e0cf63794, 0xb23f849a5f2b1ba7, 0xa2cac29a192bb754, 0x4b1282cfefbc6a14,
+	 0xd2c03173dbe3b029, 0x44904c65f98f3816, 0x8c0a8ac0dfe712ff, 0x3411587e04ca1e7d,
+	 0xb49b6ab22a2b8dfe, 0xfe7b43c94af4127e, 0x1cea9c2706dacffa, 0x1f2e5ffe83092e54,
+	 0x0386ffeab2bf740e, 0x80c449f0ed2a1e53, 0xf185f3afaccdb208, 0x3b48737466855538,
+	 0xa6984588ef9ec728, 0x5fda71f7938a2370, 0x250f03bd7f083fcb, 0x5fb58e2f054b7a63,
+	 0x7a0464bde0352314, 0x9f670b1577c701d6, 0xdfade119da7008e9, 0x90791e287669fa7a,
+	 0x0c4a6ba8d1417447, 0xba69be7c1b0b66f7, 0x36ba5fa30b6ebbf9, 0x4df725988203c560,
+	 0xe3526d4a8d1d12e3, 0x80c00f2dbad7c4a9, 0x477744461079e82b, 0x6e6f2babe2450a44,
+	 0x00d79a266f146ee3, 0x110b9ab4239ce38d, 0xb7d90a12a160fbe7, 0x1805c45ed677a6dd,
+	 0x644bd3ac5fed01ed, 0x6ebe747a52be16c7, 0x3930b64f48c0b12c, 0x282d72aa63eb7867,
+	 0xbb87223c96b350c5, 0x528abe9b43ca51d0, 0xac83d3eba7746c60, 0x39a421d227aa1d0d,
+	 0x743dea625754e5b7, 0xe02b3d30bf0c0dd3, 0xd159760a5d8f02c7, 0x9f293bebc64bcbb1,
+	 0xd3f4148194fe294b, 0x686fbc0f70a8717a, 0x117ad16188e05fb0, 0x5cd182ff802d1ed3,
+	 0xeb41d4b16d42897f, 0x63f1bb5fd14e186a, 0x3769626c2ecbc154, 0x2b2f45749e47dade,
+	 0x70a3b52ba436cbe3, 0x17e9f85862d0c96a, 0x51a67f2f751d0118, 0x0206cf4bb74d7435,
+	 0x85f0873c04a3f37a, 0x1b3240ced43da896, 0x58f83b73b47ef2bb, 0x412b39461408d2b7,
+	 0x07a89d57ff7bb1b8, 0x44ef1db8fb51ea1e, 0x84a63f229cd08f30, 0x6ffb9dcf2b848100,
+	 0xcbc784ebef01d5f1, 0x42859f583ca2f112, 0x88d149cd7854aac9, 0x22d81905b654e373,
+	 0x51a7a67ea3a1d69e, 0x184f760b91531471, 0x83340bda9333ce56, 0x1a4107d15e793054,
+	 0x4cdffdf380965455, 0x713eab438645ca5b, 0xbdf30fc1aa8b12fc, 0x676edccea513322a,
+	 0xdeb8c8586ba1acbd, 0xf2b4d22d1ad8ad55, 0xb8952f775755e69f, 0xaf53d6687ebbccf7,
+	 0x8fac9634b93b34ed, 0x55114cf5cc5b7a29, 0xa673f77b35083129, 0x587f950590e5186d,
+	 0xaba0c5c4f5a92742, 0xb8b2f6904820d939, 0xada1cff538185b4c, 0x8cf1701f1230a39d,
+	 0x147cb2eda6e28651, 0x8a4b3e79520fb442, 0xd951ef90abcc17e1, 0xafdd3f172d04a364,
+	 0xb0293189f63942c1, 0x363a6d72c4a1519e, 0x041b4decce76c9ee, 0x54fe68008255ef24,
+	 0x6dc935544707b415, 0x2d9ab6e5a7b0ce26, 0x7dc1275af71cfa30, 0x8c9ac96df1463102,
+	 0xcc49e3519deaea67, 0x1d651934e110eff1, 0x2a866455c6f1e8f5, 0x5b8a0a1fd89696b9,
+	 0x538b7981bfe9e8bd, 0xa262bc22e35997bc, 0xb5db16b81d67df2c, 0x0dec248e81addba0,
+	 0x0e41f1aed4da14af, 0x408e7df1528557a3, 0x685e6be4e6bf60b9, 0x9b3ab8d36c01a391,
+	 0x49090a9048eb4aa3, 0xf4fd31c14300264e, 0x2c2a06b506aadb32, 0x5881ebe123c09b25,
+	 0x7bb6be7b32d010f0, 0x6f255069b445a79e, 0x0d6c843118d98cf7, 0xb512ce416f56b263,
+	 0x8618030d7a6be343, 0x5139051829d9c6b0, 0x0aa2c75646b4c895, 0xa41eee65f48f16b5,
+	 0x7c5fc1e5edcd0daf, 0x587d997df8dd12c7, 0x9d20de777d1949fc, 0x01816af8d696d185,
+	 0x8f090987a13cb5b6, 0x12e782b6bfd051cb, 0x5cb6b33d25e1c9d0, 0x05c13dc0c4e09b62,
+	 0x164743a0d48fcff7, 0xc0b2a0795084bec8, 0x679084246fe8a615, 0x4f67532264fcf70e,
+	 0xeb764e8350546215, 0x1cf7bf9448991e03, 0x8709ed1cbc42cb25, 0x9d081cb5ba819941,
+	 0x37744decbce29ff1, 0x2a73a5e0a93d4aaf, 0xbaf4aa8932e1f72e, 0x2b6633fda2445f6a,
+	 0x1bda12435a51a82d, 0x4ce75d800f128442, 0x778844f2aa34500f, 0x951eca1262274d28,
+	 0xf5b06dd5e2d85451, 0x773855b784694179, 0xc67b6509889739f2, 0xb22fb232eaeeed88,
+	 0x366dde1c6f78fbc4, 0x714d7966e8f83970, 0xd221325c8372415c, 0x980cdbe05db03fac,
+	 0x78b437f048e81681, 0x475e5c31dca932db, 0xc7d367c031a9beab, 0x732897f497ae8b40,
+	 0x483ab2adf26079fb, 0xfc77286a89f6817e, 0x7e15be8bc3e49bdc, 0x955cf78ce7c5573b,
+	 0xb6010c22d382576f, 0x82c351c253be672c, 0xc46bd1e104666091, 0x2524c399402cb6c8,
+	 0x3b4d337c552c017e, 0x6acbe444a6e8ccff, 0x1ba4cab16697ca25, 0x4faab1abe96d7994,
+	 0xb0b39748e671c37c, 0x0f4ef908ebf251f1, 0x6231db2698cc54a4, 0x121bfba1325ad0d9,
+	 0x5f5429e8eede9690, 0x674b86acb97b5426, 0x95d305a55dda82bc, 0x01d10888d0186f92,
+	 0x3abfbcc68d70e793, 0x4d0f8bfb2bb28a92, 0x42edb1e172078fb9, 0x52cb14b45df9695e,
+	 0x03d6781c6683b3b8, 0xd43dbcafbe0ef153, 0x460b8a3b06ccaf9c, 0x7fe8aceeeefa0523,
+	 0x9b6bdddce846e700, 0x46c26b7c17f52a66, 0xf16078784914af2c, 0x3ee0a5dacbb3a59b,
+	 0xa3a893e1dfe6b702, 0xc0655bb0cc1e0f16, 0x1daa665ab0d6e3e4, 0xb61875b57029bc3c,
+	 0x8ad31176a425e3dd, 0x8d2dd4e43a38e824, 0x8134c1250f6205c1, 0x7beb191329fcafac,
+	 0x350698901b4138fc, 0x2ed16ca596de71cc, 0x3192f7d4fccae0e3, 0x8dbace6fc83b366e,
+	 0xb0ea152c53d95d13, 0x1ff98e1c2804ca21, 0x1c32a8eb352a9d6b, 0x7cc2623af05a43d7,
+	 0x768bb703bd146018, 0xf318c24fb21d4e96, 0xa99b91de40e0af90, 0x71b6801a44d9a152,
+	 0xf84e999511a4ff36, 0x3949a1757a179739, 0x1ac0c2192fcf76e1, 0x17cfb16c5ce13bbd,
+	 0x834940d0abe012ab, 0xce7ec97a368e2183, 0x8bdbda78b3e0ab09, 0x72b8cd22ed5fa327,
+	 0x81ed74cdfc963ab6, 0x18c5decce7025142, 0x8eb114178e2e7302, 0x340b0d3d4ae3645c,
+	 0x3874483a80fc3de9, 0x64f9a0c8f727f9f3, 0xf4d383c0b4bc4d58, 0x46f2063fa6101e2c,
+	 0x1cd827193b3abdc5, 0x9b9217b05524fbf0, 0x785a7b2c6ae001d5, 0x1dfe54e5da1f1954,
+	 0xaf9bbefa5301fdbe, 0xcc9f62bcb41bfb2a, 0x07473bd77c254e3c, 0x527a1a9ff1a66f98,
+	 0x8b4da1f5e4511674, 0xb1d028a4c8359bc3, 0x4d6f7e9b8d8f5dce, 0x69d30f8d73d01299,
+	 0xb280b02d208e4348, 0x5e79e079ba4f02b5, 0xf1397f8a2f015554, 0x47ee4cf945946917,
+	 0x719a5dc357a43c05, 0x628fe655401031cc, 0xed6d5a337e75afb1, 0x37820a0f6a80ac12,
+	 0x33bfc836d74e79ec, 0xdd93b4b5c2f31215, 0x9f47640b34382a6d, 0x0cec0dfbc85915c5,
+	 0x9f9c574f5317d591, 0x827f585a5c11acea, 0xf25e9171b1fce0b8, 0x6a39caa4e0fba94d,
+	 0x00d9af10539278eb, 0xc73d4f71249dbaca, 0x4e3331904086064a, 0xaa8404c343ff3a8f,
+	 0x63c3fd03a832a588, 0xa842a43df1d02c59, 0x29dba306fa599fa0, 0x22f0cfaf73190402,
+	 0x90dd03db4d90ce7a, 0x4172d61bf00a7594, 0x35cbd7baf76a7108, 0x3f09b52e90be46e7,
+	 0xa8bea9a3dfbb9d1f, 0x3c767506f05fc5f3, 0x17db64c60bea5108, 0x03f427ad1251e7b3,
+	 0x6584510315ab50cc, 0x34873032cccd5892, 0x4b69ec8a2fef6400, 0x0f7555c6017fc73f,
+	 0x09d4b45d9f0975e4, 0xa8a5227df2ec7f1e, 0x1e2fbef666d074e0, 0x59b7fe84b0eb942a,
+	 0xed707f1d544e7c0e, 0x7f380a8e819cdab7, 0x55246926d5187249, 0x14eca0a53e3b99c8,
+	 0xde36be4079b86a40, 0x207ab71bbf74b6bf, 0xfd3df4a6f981bb78, 0x1d2b2a494a4001ef,
+	 0x500e23087a6169e1, 0x841e4afd53b1d222, 0x45a18dad19ad7911, 0xa144081b3938ca2c,
+	 0xd9dc17f2bbdeed75, 0xf31e3e9d3cc1929e, 0xbd117609aab3305b, 0x873abaeeae916881,
+	 0xc637772e910a6eac, 0xb07344dcb17e424c, 0x32da1cfefeaa0ccb, 0x65a1600beaf8547f,
+	 0xe3a971a32971fe09, 0xc0589e5b91b653e3, 0xa4ce20178ff961dc, 0xb0f5ac6a62b7b1f5,
+	 0x6805777979394776, 0x1ae56715e9db9f8f, 0x60b870173b55eced, 0xb24d95a54ce3aa6a,
+	 0x77ac108f0649f838, 0x62b223aa43885a50, 0xfb000d1ada464eae, 0xa0b4adaf48baf016,
+	 0x4c3bb8f6097eb073, 0x2dc8160e0973f7e0, 0xbb78c89cf6ddb8d0, 0x4ddc61c35049d31f,
+	 0x990092559080e8a1, 0xb4ddc7c29c94540e, 0x61001679550aee9d, 0x786f4ca7ff4948d6,
+	 0xd4cf3dba53f09c29, 0x689521ea35fdb297, 0xeb82fba921a49c03, 0x3f91ffd92dfbdf2c,
+	 0xdc530f81f8f3caab, 0x4d2713cfa85af629, 0x479f5d7952e830a7, 0x471a4d66bfeace40,
+	 0x6a41f492c321d412, 0xee2d4cb63658f7fc, 0x93c3da093db7d3fd, 0x1cab412a066f1e33,
+	 0xd2ac4cd6e4ce4df4, 0x712a6d2bef714f8e, 0x3c5efcdd0829316a, 0x755d115e37f597fd,
+	 0xce228e54e28e4eff, 0x4fcbc1e23c7d0424, 0xbcfb66fc7673c24c, 0x7a3fb167b068660b,
+	 0xdd71aab07702668f, 0xf297527e164dd989, 0x2a7a57179773b0d8, 0x6ea257f1e3aad674,
+	 0x67008efa2c616bd2, 0x8e70e1840071538e, 0x9378586c39879cc0, 0x3f86c8b0bacf6b51,
+	 0xdefcfce9ac914942, 0x1de5d2a68691e7e1, 0xf3f298f41b1fe1f3, 0x304a2949438af9d0,
+	 0xfea184648854a0ef, 0xffa6347da8ba01fb, 0x96909cc90c939a49, 0x514ae02cbce95364,
+	 0xc6195fce1b05a34a, 0xa1d5d93dce24cdbc, 0x4bf39539299a4933, 0x5c9014136155df39,
+	 0x0468797ace4d3435, 0xe7f72e974075130a, 0x8962b6317b390d17, 0x9b9f2dded55e7efd,
+	 0xf0be2c6b12a76959, 0x90a4ac6ee6705286, 0x2652ac9050619d63, 0x45790beafe869104,
+	 0x7eee63ea7a17a54b, 0x1025cdfd9a2c14f6, 0xa4458becc570c3b9, 0x6c3de08c6a9b7e78,
+	 0x75b09a13c1c3bcf2, 0x8123046bc20a4afe, 0x0df131fad823304a, 0x1b1a954b55f7fadb,
+	 0xc88ffbfe70b93bf4, 0x85bf1c0ef60b5c1d, 0x6ff38936ae6d8900, 0x8a14f5b73641efcd,
+	 0x6bec44e71595d6ff, 0x38bb62ac3113bc51, 0x31a655cbc9f977af, 0x35720a2c5495ebde,
+	 0x77296352caa620f0, 0x12dacec86d16ed6e, 0x075ee0d94e8c8b31, 0x88cf23c3249e6c4c,
+	},
+	{
+	 0xd5b618b0ef820577, 0xde144d0d24f75657, 0x9742989039ca12ab, 0x5541e30043dbf215,
+	 0x3f065707a66c4d59, 0xab08aa0652c168db, 0xc722e12740c43490, 0x3d290ecdc2be5cb3,
+	 0x08fd0aac37808f92, 0x811ac9878345874d, 0xb91986aefa9f5b34, 0x244e88baae736068,
+	 0xfbd02d081fb89608, 0x58a1807447cef37e, 0xe34d32b6e4ec262d, 0x67c4266ffb20d21a,
+	 0x0863a866f884ef98, 0x2ea9811d4bf18d02, 0x4bcdfdd56f102cbd, 0x5c653cbf2fe42482,
+	 0x945279f1db2307a0, 0x064e7c597f659751, 0x006f6b1c2bede554, 0x0bac652c6e734d24,
+	 0x16c9acb6050c274c, 0x4b954f1246b77952, 0x14187eee1dbc1db7, 0x9f837d7eb95b6b8c,
+	 0xba11fe905cdd6892, 0x189924984fdb890c, 0x1c1e1668490e5d5b, 0x297566e31f95a5fd,
+	 0x3e660475dc833b3c, 0x687900d81117f365, 0xe480b1c153bfed65, 0x0886c6a96fc3a0eb,
+	 0x0c9f2a55d440d9e7, 0x027a7184b920af6a, 0x45c441d7e9f2d06b, 0xb33933b5396f64f5,
+	 0x822694c5371f8527, 0xef0e53cfb48b0c1d, 0xb9557842a0129cff, 0x855296b7fb7db34d,
+	 0x85da66712cf1947a, 0x3a14b6c4fe85335b, 0xa29630a631fbb1a3, 0x8f891090a9256e36,
+	 0x1b324101401f982b, 0x9edab95878947baa, 0xa49125787e5de63b, 0x656086262d4e07e5,
+	 0x1c3bd8273b6bcedc, 0x2c9e6618734bcfa0, 0x45ea971ef3c74ade, 0x3214adc5dc63e791,
+	 0xbc3c3d176acd654a, 0x9916055143376a95, 0xcbff8c148542e319, 0x2123927347d503b2,
+	 0x3017ae86475bd4e2, 0xa49a62fca184f98e, 0x9f034ee66d530d45, 0x7309c052fb7d1344,
+	 0x087ceb87548885e9, 0xa0144e3d00df6a22, 0x5205b1010865b30e, 0x0ba9f41b7e08a285,
+	 0x3289e6d497fc1621, 0x8bed2021b6011556, 0x77f5e6de221ce666, 0x5c47f1271bc88d8b,
+	 0x1c85df54c8062dbf, 0x64a09e36d652023d, 0xf4b9ad47bd1b6746, 0x07f4a6aace87f552,
+	 0xda41bfdf5b06975b, 0x1d7783c753f59958, 0x198baa266d232436, 0x40e1e0799645a20f,
+	 0x115eced555345b5c, 0x460c5b7372f4ede0, 0x3bbee4f09d1740e9, 0xaa0ab25270fadbce,
+	 0x9b8787e8a528f347, 0x2edd6f392addbf97, 0x8e2b58b40c647f76, 0x377cc5d2922615d3,
+	 0x89c86389c6d1e34f, 0xe3f37045257c933d, 0x23d933aeb2efb3ab, 0xb05b7ff7ce3c5766,
+	 0x542f9dfe152421f9, 0xa33c1409a50ada70, 0x6de4fee76aa0e331, 0x0d73c58da5e78c18,
+	 0xb419179dc4470a17, 0x3a0df8f46c3f5b66, 0x4eb0b896798ce4ce, 0x40d31c57a21d6aa0,
+	 0x17ab1eea022b3af6, 0x85cc1adfd9b8e4b3, 0x31502e023a4c3ebf, 0x8c330f373e62228e,
+	 0x752d01f35a982f82, 0x57f608512754db08, 0xb3520f439e6a3e25, 0x7951cc00a0a0b894,
+	 0x929f035471e545ac, 0xc4fa227db144f9da, 0x9324500e29a01a04, 0xa7b4c757484e6a7d,
+	 0x96dba8a261b3a87d, 0x9bd9dbd9c1cd1912, 0x3c026df1a3ad48ed, 0x9871a8688c77246e,
+	 0xb71eee4eea01f432, 0x202e0edb979f5c7d, 0x7fc0416b3fab0220, 0x84b920ba2898e139,
+	 0x29d5f634f0e75e66, 0xa36db396834b8e68, 0xcdad7e1180016c79, 0x9d13adda64d43a90,
+	 0x4f8aeb2fe8677d26, 0xe247a7ff4742d3b0, 0x5107ae840a65f932, 0x7a72f932686df05d,
+	 0x232b52967504381e, 0xe7bb8293b4d26fb4, 0x9fbd9303c29f2332, 0x487ed604e7eca3b9,
+	 0x8b6b3edf1d649549, 0x0490234ae1c0b0f1, 0x665a4700193c967e, 0x5d5240d6c73690fc,
+	 0x95c8260e6e4d54fd, 0x639af4269ac95710, 0xb83b7ab655b25a77, 0x8d1cb2ada3e4e24e,
+	 0x7177f2253f085e14, 0x6d35b9bb08b08759, 0xe049ae282b2e53b8, 0x081ac5e4cc0844f3,
+	 0x540b5e61320684dd, 0x3829775ebcac9196, 0x3d7ec71695cbdc69, 0x04dc611d5d5d1ec3,
+	 0x2cb9244f37007775, 0x4f459f26e8300343, 0x847d06eac5bd72dd, 0x9596eae2d0bce561,
+	 0x342d384dccf8983e, 0x98f7f0494b23e141, 0x14de6dd612492885, 0xa8e6002981846497,
+	 0x6d6ee245f76f02ec, 0x6ad3861b645bc97d, 0xc2d106c7d1df9309, 0x513110e93f646ee0,
+	 0x37300d10187f6ee0, 0xaf1917962a85be9c, 0x9f71f38bebf3df64, 0x5fa72654b8d6d05f,
+	 0x7690343a670c6ae2, 0x09e2e53a48fcfd54, 0xf98946d91f6fa0c8, 0x30b343bba91e3a63,
+	 0xde8423a383ff589b, 0x2dd80a4603f6ed38, 0x4d54988c2f1d50c8, 0x06699649bf9cc848,
+	 0x0722f27bd4dc6bec, 0x5d90d848920de3a3, 0x0acb4efc31979b24, 0x080b42c2821aac05,
+	 0x4e3152c58e7314b9, 0x42883dc026640235, 0x1445a6f736916901, 0x87662da4378ff641,
+	 0x5562ccc8025b5657, 0x9533264dff92d873, 0x4d6c0ac9b680a1fa, 0x3085387a37279e03,
+	 0x0bf9496126de16c3, 0x7477d8d1e528abd3, 0x946d0131752b3eca, 0xae036044a2bfee01,
+	 0xa4e62a5081dbac73, 0x9e47fbcd8e97d59c, 0x974a9e87607ca954, 0x0883bd0dbe4191bf,
+	 0xb6e3d3c9f6a7ca2a, 0xf94d59b71d29878b, 0x0b19e8d4faf215a7, 0xaf4a89764440c6d3,
+	 0xe03b704dbf87856c, 0xd09292b7996c326d, 0xc42a24ccd39bf68a, 0x41c5e6765f68badc,
+	 0x9813f647055f1832, 0x7392f6e6edb972fb, 0x47a5b94c38398928, 0x8adb4a89039a774f,
+	 0x27dc8985f67c8a6c, 0x2d84fba57edf0726, 0xdb15623166dcab78, 0x3e4f621129b237ed,
+	 0x664a90d642227d6e, 0x90b9c304db070b77, 0xa05fa4abd66a9bee, 0x8179d2c7bb6ba15d,
+	 0x8a17305cbd9d1335, 0xede1f04b9edd9a78, 0xfd329b85cd57889e, 0x88ab555c35e046c3,
+	 0xc4856ea476e5222e, 0x9ca3964a6469f24d, 0xee042fd3b25cb84c, 0x3f6765066ee85af5,
+	 0xbd7068f898e6998b, 0x2ec0709b7b1795ee, 0x97872ff740cfa6c2, 0x83fd191842ca3cc4,
+	 0x911eed5e883cea62, 0xa3bbef24b3cbbd73, 0x5607b80fc59ff734, 0x6797e842f9139220,
+	 0x5c63cb9d8d77f2e7, 0x6baa215b0b8358f7, 0xd4f49d894309d92a, 0x0c868b3dcec53384,
+	 0xe0f6df6bcd82d7e0, 0xb9b709a9635794aa, 0x870f778b7183150d, 0x9ea6e0ec05449a13,
+	 0x9e01063644bb633f, 0x08b8f8b26c4f72bf, 0xb8adb0a83dfbf790, 0x43301a96626ddc53,
+	 0xfab72ffbbe163a90, 0xe4f984417cc842f2, 0xd7924983bf93e774, 0x08e85393e7af748a,
+	 0x7319b1b39358a9e5, 0x9e0b2e304b7246f7, 0x8f2066f76901c3ce, 0x89d4a1311ed830a1,
+	 0xd842e296137f3b4f, 0x6c115a6498c1313b, 0x0874830126a1ba64, 0x5d7100f9ff7ecd2f,
+	 0xe484adcd51acbec1, 0x23273a42ba9351d0, 0x09d93b587e8f6dae, 0x6a664579c0cddf1b,
+	 0x08e8bbeab5353c13, 0x342f5cfa4604aa75, 0x575cde3b62817562, 0x3cab494b4670c240,
+	 0x7d4303a24a0d7428, 0x82def83ed092d44e, 0x247d2a7a75cf0776, 0x4fbf41f18c0e7700,
+	 0xd0228ee120c46733, 0xf4d2211e8c7106bb, 0x51aebb26383c998d, 0x3162b21e4617c394,
+	 0x2693c4b4fd466819, 0x41a57dd1c5f4e42d, 0x7c5a3762c7f3fbb3, 0x98d0c83cd837ebc1,
+	 0x98ccd55f1e5dd226, 0x4f0f35ddc64efa70, 0x92a630fe9c169113, 0x15b9b2c423847e88,
+	 0xa4bc1646b5b2f58d, 0x93c827771c76ae17, 0xe413d06a3e439ca1, 0x04a1dba3c43ce168,
+	 0x18237352d75d9041, 0xaf16835de1846979, 0x71f5f6c47044b4bf, 0x6974f3bf714e4b8d,
+	 0x0cbb81b9f80567ab, 0xb26a54309bf10f97, 0xe3dcc27a9ab56739, 0x827d16f0f0fa0d81,
+	 0x91a83273475090db, 0xa53a274c5c4d0240, 0x37d65c497e84816a, 0xb264b087b6fe6bd6,
+	 0x67fee2ebd7e65553, 0x617e2a65c98f0a51, 0x35354373b0775bc8, 0xb4d292d33ef52380,
+	 0xd225186849c0a4f4, 0x55837ecb3ab27d88, 0x3a09bb5389af6853, 0x913f651de0feee69,
+	 0x323ee555e4ae945f, 0xc4671ce5b1ecb824, 0xae2619c841dc7c78, 0x11c0dcae659aaf88,
+	 0xf7b062de19b8fc3a, 0x2ea376016db8fb56, 0x207f6784832b79a5, 0x72c29d7e19a5c583,
+	 0x830e84f9bb94a3d4, 0x8870cedfd2c89e3c, 0x3c32f33530f7f942, 0x41c17077fdf797f4,
+	 0xd67e5e75f54e7ad3, 0xfdf234bd55fc4750, 0xfca770163256f1e0, 0xae1652a17ee396f3,
+	 0xf30ecfe125d35cc4, 0xbe8d8d167d183ba9, 0x9f25b07266078a60, 0x495f6a64bef14087,
+	 0x05b1cb713e05eefd, 0x0c5f7554824784dc, 0xb1657c888f5d91ad, 0x29f7ef629e20d856,
+	 0xa41d175713aa8417, 0xd3bedea8402c5df5, 0xcb0d4f3b76fc107e, 0xaeaa9f64c08a4862,
+	 0x29988aa349bc6784, 0x0f84f665711d1a12, 0x9ffed7b6751b997a, 0x95ed94c8b98fa7fa,
+	 0xe619e4197e1f79a8, 0x8a846e9fa4c9b545, 0x04c91cca829a3b94, 0x2c08a32e24b04227,
+	 0x7f96e1aec497a832, 0x81615ac7fc26b3af, 0x728f1edd249795b7, 0x86474b94f0911d6d,
+	 0x2bd3108a6faefada, 0x4561fe91b87d972f, 0xc306a79abade49e7, 0x674b85f2718c2ee1,
+	 0xfc08064850a18adf, 0xeb2b419facbaed4d, 0x04f2af0d7f919290, 0x1fd987f116b4d002,
+	 0x7386aae1e1ab11e6, 0x3195cb69b9f6a94f, 0xb3c5967d9b64af34, 0x4b4c97dd8474dad6,
+	 0x8ae14876ea74d316, 0x5a09dd720597a933, 0x1df0a17473c5ecb5, 0x9c992e3a22d58a86,
+	 0xd10a7e02c8834ebf, 0xf61fb8986f298d58, 0x237783f08da08e2e, 0x0cf4c5d5fcc14a98,
+	 0x1bbf07da3ba723e6, 0x7223505761568d04, 0xc6e504aac0218c4b, 0x46ed19c6e252a1df,
+	 0x2049a5c00215f943, 0x8bb46d2a91ef15fe, 0xf0782080935bdc60, 0xb2876aa6ad13a73f,
+	 0x12890ff2444d70f6, 0xc41f1866a6861320, 0xdd30590c893372b1, 0x2b08a650ac1b4465,
+	 0x859603cc04796b17, 0xc43a55d04c39f529, 0x4c01b5fd57a27629, 0x5ee3f7d99f6cf5e7,
+	 0x86dd4e9d6b1318e6, 0xd470ccc775e302a2, 0xe10376ca4c36b00a, 0x75b1906a40f52baf,
+	 0xfda83bd1223168cd, 0x30909342c6757b7f, 0x6a70770f1c50973b, 0x03871c6730c3cea1,
+	 0xb7b593c99f1702bf, 0x43e9be60825251ca, 0xece584b646acac50, 0x73c1e05c732b0d60,
+	 0x8fe555316b0d0211, 0x567cd5f39ba7c422, 0x369efb18e586e481, 0x03f37c3ae5897969,
+	 0x722fda9307f2bcdd, 0xae94f994daf76005, 0xfb0a5cea03497ad7, 0x93c555ff608f8efa,
+	 0x19d15dd07609d7f9, 0x91f75c8ba55e39f4, 0xa9c7258953737c55, 0x1c0bded84e825198,
+	 0x83a50691338a9f65, 0x8c876598311b7d83, 0xb3476da9e74e7001, 0x057f69ccd4fc1c19,
+	 0x00c14cea65a14b30, 0x22a13e11ae6dabd1, 0x15dab84a0d1a5c96, 0x346f19628f54444e,
+	 0xac8a14d78d0c704f, 0x905fe4b7c4196481, 0x55bf49f25a09a37e, 0x3146d334dcc6f8e7,
+	 0x77791c82a09ba673, 0x4b4651b466924169, 0xa808beaa28baa63f, 0x6315b1d9b52bd47d,
+	 0xcf8fe865b2e49ea3, 0xb91b30a3da612b46, 0x319dd49c08ab2589, 0x1da836c235060778,
+	 0xe2e57b3ef75e9c54, 0x240998aa081983e8, 0x579be38a9af5f1bb, 0xaf864135887bbcf6,
+	 0x039aa8393066c07e, 0x2a4b3bfc8a8eb942, 0xed76c24ba9acb25f, 0x6919e73c2000b987,
+	 0x91cb1848799b931a, 0xcb6ca106f4ebc777, 0x082e3b85c05850fa, 0x4bf42e809c588605,
+	 0x8435ecbfa4c6a78b, 0x974cc0d6320fb222, 0x3a451a701710211f, 0x64ee7d8a8710be42,
+	 0xb74e2bb68ad1ac89, 0x3442dafddf770baf, 0xa2868dd1c8ce8cca, 0x6ffc77312c5ac283,
+	 0x7518b148c2e682f1, 0x210c5a3f53fd9f55, 0x8c73011c60de369d, 0xaab675b793878b88,
+	 0x03a39558b73811bb, 0x71050e5eed17f5f3, 0x859175c2cc656b85, 0x560f5660ad5af3a8,
+	 0x2dd150c77aaa188f, 0x208dd180bbe0fe9a, 0xa48cb297c6813b77, 0xa5937e1771474875,
+	 0x1a5a2f828b45a080, 0x120e8e87ba2f353c, 0xa717048db16ca80f, 0x11f8c10c6bd97431,
+	 0xbd7d563f5515f2c8, 0x5c1bef1c0ac5ddb5, 0x3be3bacced386d56, 0x6c8bfcf7104db7f7,
+	 0xfe37995dbe64ca7f, 0xaf9b175c014bb9a8, 0xdf39643b47421ea0, 0x54a09547f03ab8ba,
+	 0x9985f809108b2756, 0xefe75b5dd218c4f2, 0x511f38e92c9b6f72, 0x20e25c28ee6e8f2d,
+	 0xa622813268293a15, 0xeb2c5c065030444f, 0x76a8ff68adb8ae42, 0x1f924b8776ca6783,
+	 0x6294b50894d77d3b, 0x868daec4a09f47c0, 0xf07151cbcf3b0596, 0x9130c7bb87f1dcaf,
+	 0x7b895cf300779c6b, 0x28afd79df64b7dbd, 0x1b260722d20d6d4f, 0xa7ee8276e1981503,
+	 0x6b79f06d43d602c7, 0x41bae7a0c17c57b2, 0xae30dc5192861d7e, 0x4adfd3db4d833485,
+	 0x912084c428c12e36, 0xc5f41b0fa253c484, 0x3bef0708dadc4283, 0x627dd1ecd0b29f59,
+	 0x198bdc1e680f3ad2, 0x4a8ee6ccba038b53, 0xde1bddac6b0c1f98, 0x6cbad6eb5a8ba26f,
+	 0xc3d4a952258aa743, 0x2ed46395ee3fe373, 0x8cb6291c9a74795e, 0x0a74859530065228,
+	 0x8b92c0de9c08e62f, 0xee84963e76933d49, 0x0470d6f58ab86672, 0xa76e28d9849e5fe0,
+	 0x302ff237ddce2906, 0x3b108496c7774496, 0x4533065fed2ab8e4, 0x963584260d93385f,
+	 0x12d08be0b0e7fcdf, 0xb80f535650546fc1, 0xf58acbfe12815a47, 0x61e48a13c5fdf9a1,
+	 0x4c8cb14f1e4a5e2c, 0x16d298a9f983783f, 0x39b0d5416a3a3ec1, 0x98f41e77afad7290,
+	 0x0579c54db8bc65b5, 0x29e65a9635591cde, 0x94c39120860f5a60, 0xaec24f1ccc91fade,
+	 0x0b91fa3afc900df2, 0x4e03d8dd4a6ff960, 0xb04db86ef0067d7f, 0x5316561b66638812,
+	 0xe64f9e75528e740c, 0xc18474f7b04955b7, 0xf7e10b90e0099bd9, 0xa8a050d436fdf75c,
+	 0x5535d908fba6184a, 0xa82dc87f66382e2d, 0x142f0bff7f067982, 0xa583c565c72110e9,
+	 0x45dbdd97503a2aac, 0x90c5d18b2b401269, 0x87be0b0f32ae6d77, 0x6f93edb32a5e94c7,
+	 0xe1578a4749d7be9a, 0x9bcf5c55b548c5ac, 0x2a008c2e4a50a50a, 0x2498bf49c75e0514,
+	 0x80a1823e09cb14f4, 0x015f7b881168af26, 0xf45fc007d4ae7004, 0x5fdb0dc5020c3750,
+	 0xfce14a9441d68d08, 0x88261015185b8bd0, 0xb1179fe10eb67a4a, 0x45a492f0682a5a5b,
+	 0x966b21e981ed9913, 0xc13d7f0fe9098dbf, 0x4c630db0b81e111b, 0x34a76ed6c18ace33,
+	 0xe34b8e98c70e7b30, 0xc446b3798c92d59f, 0x04d6a1c68cccf960, 0x06165c49f12b0b4a,
+	 0x911a73f7b74c9b24, 0x99cf370d3fdb01ba, 0xc967711e6112e946, 0x2f2109f33d38764e,
+	 0xaeeec3e3a796c8f6, 0xb21eaeed9edb6ea8, 0x332fb28d9e7879f8, 0xae50bd6042aa2b8e,
+	 0xe476ce4dbfd5f970, 0x0e448ee038c915fe, 0x10219f071e9e3b5d, 0x1d4b681b9673044f,
+	 0xec7981f476af2d7e, 0x69a986bbd0398f95, 0x971f6e9422cbaf0a, 0x4ac41d0a1f24775f,
+	 0x7eb6e0e8868e9a86, 0x08893e771261d806, 0x7ec37dd635a586a5, 0x2c9ee70e9b58973d,
+	 0x6188aa8b796efc68, 0xca82519cb9ce94ed, 0x2575980bcde3330a, 0x3d0bad994ee9f189,
+	 0x4dc5f0b8de476b07, 0xb5707872628027f8, 0x4435092f62598d63, 0x41293735fcb1beef,
+	 0xa71e87651e6e99b4, 0x171395e693bb8c75, 0x011213d0107bba67, 0xb251ca2db9301b82,
+	 0xa2794f67f7f2bf53, 0x1cd5419fddac0d26, 0x4dd5aa7495856e48, 0x76541d7ccf02333c,
+	 0x5f79126324fbece7, 0x472ec45578bec384, 0xf755e83d23dab944, 0x847f3e36b5f9a90f,
+	 0x39da0d1cb79ae7a5, 0xf8dda3d9cfec7305, 0x767b8e7f6852a177, 0x8a12674622cf19ed,
+	 0x0df3827baae6bddc, 0xe3c4e2a37bd5fe21, 0xe0d5e058313fa9d9, 0x84300a56b4397d0c,
+	 0x83d1a8f178654312, 0x71678071956b77f4, 0x6a0c11a59429497d, 0x29fe7b226489891f,
+	 0x9770463083fe1839, 0x7a30532e056a9e72, 0x88742d530552446b, 0xaaea8a3ad79d4d98,
+	 0x3a801a73ec5c1fd2, 0x52b277d5cf120e5e, 0x2325a961903c7792, 0x93ec64b5fab8b9c4,
+	 0x9c7f12e3db2d5a8a, 0xbe578869a4845d39, 0xbac85d774d8dcaff, 0x544c221ad9c07ec4,
+	 0xea0eb0b0871e51e1, 0x9b3709156f0ea4eb, 0x743372743cd50b31, 0x04d18fbd898530d8,
+	 0x027cd23d58c6f160, 0xee5cb1fe73247c0c, 0x55b80aee43113b0b, 0xaf840053ed6c2616,
+	 0x719b5d1ccd41b40a, 0xcf2d57adf83048fb, 0x56b548b0bb1f54c3, 0x952bd36c9bbc7776,
+	 0xab1489d7e35f372c, 0x7fb22fd6599e104f, 0xf0eaea00e3047381, 0xb396a5b1bd7a7ed1,
+	 0xd7fadeac648567e9, 0xef8ec3901b8e376e, 0xe258735b85a07baf, 0x98a4cb497e3b5f04,
+	 0x3bb3897a855850e4, 0xe27d4d7c77ec66ca, 0xa1fbd87757bcbf1a, 0x2a1780d97eb1fb46,
+	 0x58e1f9e7f973dbb6, 0x76bcfbeebac2a5a1, 0xb77a7f43a73cc4df, 0x7cb89bcd2e82c92f,
+	 0x8864c221f714f09a, 0x975d73d40fc53c3e, 0xb7f26d78ad5444d5, 0x870171518a5fbd50,
+	 0x62202887b917e23a, 0xb5977d95177a76d1, 0x8bebe232ee1283ff, 0xb58b8b7d9194da65,
+	 0x3886148a459bbeb4, 0xcda47fed25180c1c, 0x8f25af5b8692289b, 0x73104bd1933f7c64,
+	 0x9b90613ede18776f, 0x2f66c8aeb9b4130d, 0x5656cdcab190cc39, 0x5fbeaff1ef6f2837,
+	 0x592d458d7a70af73, 0x180735f46faa7069, 0xa592591dc9d5545d, 0x750eafe02ada11d0,
+	 0xdbb2a3cf22c3cafa, 0x65321eec37732078, 0x94fe922cbd56e0ed, 0xaa5077993faffe24,
+	 0x0c17c33327d48ab8, 0x8bc8a88083166473, 0xf14c6360a5845cca, 0x0d707c5294674b8c,
+	 0x4c63c9e167120021, 0x4e99850390a36697, 0x941c05ba8f687236, 0x7385b3d4ca2d77c4,
+	 0xc8c01239399e2e54, 0x3f5074d8394ea9fb, 0x99f931507bdf5975, 0x2d611df29868388b,
+	 0x0c7653dee4c55cba, 0x9a2c215b788cb860, 0xdd2e55752f138f26, 0x320fc3942b693747,
+	 0x3267735c5721825d, 0xea99fd59bdd13c4f, 0xfbea08ff70c98920, 0x51dddabe426a9d2b,
+	 0x45d7509a065ee6d8, 0x55ea9f4d6fa1bd54, 0xbce1589cb3791066, 0x0ee6e15ee92af473,
+	 0x9599151018928336, 0xbcdcdf625ebdccdf, 0x4717aa4b93b3c2d6, 0x825c391252aa97e3,
+	 0x5c43e7fff51e175c, 0x679a801a7b0d42f1, 0x67e44392911b8fbc, 0x58e61203660e4dda,
+	 0x1595e0db47267bee, 0x6762a39652b6b5dc, 0x1ca8c6187163f411, 0x979da58326073f62,
+	 0x07c2fdc6d5206e48, 0x971dca1bebd8b708, 0xfb338f0715453f2f, 0x68bea3c895c71273,
+	 0xb196b2be7726a1cd, 0x81734da008bab099, 0x10f85e4cf2be5f1d, 0x4e7e0e3d0f5ccf2f,
+	 0x679871590e405b6a, 0x0aaabd30a80e6de6, 0x38ea65048886c107, 0x83f9ce89ceca1799,
+	 0x2c675761cd3ea622, 0xac12d4e088037b08, 0xb94d014b1adc995a, 0x08ad6f8cb3969d85,
+	 0x32a65c848176d2b9, 0x601e0f324a731eeb, 0x27318f5fd3f3ec9f, 0x6ca9821f16fc820a,
+	 0x8ec7499dc9ebb062, 0x59cad2b21dfd54b8, 0xb0bf6e785e4ed0f9, 0x6cf77bd36dbb7b1a,
+	 0xec7b72319c4c6807, 0x0e6d54e0650161b9, 0xcf45b625b3fa3874, 0x34b51f5945d37aed,
+	 0x5af1b6d95fe076db, 0xe399e8d1245a7171, 0xed1180590a8ee269, 0x4af2a54116d91474,
+	 0xe014618e101f34ad, 0x3fc161db6ca98ed8, 0x14d6c6620866faa4, 0xa251c0d5b4188daa,
+	 0xddca6adc6054c72d, 0x7ebfb1384dd585fa, 0x56a81c0f8a800a26, 0xa96aa73743567a77,
+	 0xf486dbc5a04214cc, 0x9051b5ceb2f50b77, 0x82f22ceb35644b83, 0x09600eb23ba9376f,
+	 0x5835072b90fe44ee, 0x9d4497acbae8c7bd, 0xbdc7b8457425cfb7, 0xa1148feb02ac4be0,
+	 0x16b4c9be0f411b39, 0x6429308f192520c1, 0xe74e767b4b8b9bf4, 0x3085be882e017a74,
+	 0x1cf8b8477df15c26, 0x525b3ef823efe349, 0x5b12a9615d11eb16, 0x1f6c760a95c5e308,
+	 0x7c69d8c6525bae93, 0xd7884d44de74e203, 0x968ee479baf3bb41, 0x82c53c4e8d521516,
+	 0xfe7824bc91d01c30, 0x6c0f25d5fde122c3, 0x0f790f028b62b5d9, 0x72e8df9dbada10b9,
+	 0x782adf3dd6cb71f4, 0xdd6620a10e442310, 0x093cb7d2043513fa, 0x99ae4b537211f7ba,
+	 0xb2a4dd3f0b94c423, 0x2fa6eaf3fa21b0cf, 0x22cb10593d4ce0c4, 0x70ec3e7fbeb3777f,
+	 0x57348c84394f762a, 0xfe87b7863a1252f6, 0x2103c05a9401ec11, 0x6956342dcdbac163,
+	 0x8f5e5e601389fe8c, 0x1845561aadd574b0, 0x8bfcb28fe0793f69, 0x2a5cb2dbd3898f4e,
+	 0x0efc442c628da147, 0xe7d52cb9c2d9254e, 0x07c6d0fb597f9da2, 0x4fa5124608699f96,
+	 0x81a6ab6188d72432, 0xb6abb1df9fd59120, 0x0b10b14a4936bd9c, 0x27a210d40d3fb793,
+	 0xb0c1142a24a3cafd, 0x1799c800e58033a6, 0x7108e84b8d41447c, 0x5c73eeb21d97a0b3,
+	 0xcc724690655a258f, 0xe0cb26140439d82b, 0x199e0cae7fc5c10a, 0x98939e1dbd5ed975,
+	 0x5a544a4c6ea4e2eb, 0xfdefe655dbf63662, 0x781d83a5ff76270c, 0x917135863a8c581c,
+	 0x353603064992deee, 0x277238f5e9509eb0, 0x6b27fdc12961c0b0, 0x0fe8dcd0420aa253,
+	 0xd7537b051dcf9cce, 0x1d894accb2377cb7, 0xe80893b10c955dc6, 0x218c42ccc58c7200,
+	 0x515bbe6d56bb50d1, 0x5b067fde4467f9ea, 0xbd437185937c8f9b, 0x7d37dc552e4707e4,
+	 0x3ba80a44b23a6612, 0x1bcd49a5a5006f83, 0xb39b201b07a53d47, 0x1da6ae0f4de74ff5,
+	 0xcbb64b92e448de93, 0x1aa80d0858d3a998, 0xe70e50df7b1569cf, 0x2569103dd795bb32,
+	 0x90736bc7701b7b66, 0xc0669d588b20a15f, 0xe05bfb79dd972c52, 0x21904a68adf1545d,
+	 0x264efc04ac4e6472, 0x1daa2effc6826774, 0xb54c2b621e567571, 0x39eadba475a8405f,
+	 0x069f7bb49b1b9fb1, 0x3bea5c5a06391197, 0x34df5d023c386d82, 0x3f43137ec3864ba0,
+	 0xec392270269c90e1, 0xf36d6fd18496c198, 0x6f81bd5b278049b4, 0xaa7411257ec731f8,
+	 0x244b3f1d21715823, 0x2bf142b9045d0ac6, 0xd715061a8c741336, 0x4cecafe4a7b897a5,
+	 0x35b665e50cf10975, 0xa257cb4d32a442be, 0xdc46bdae8aa5f146, 0x1891472d8f77e67a,
+	 0x0a1ef51565a3ee04, 0x92215b3a4eb7da32, 0x94d61471770ed405, 0x3d22a4cc73d44d86,
+	 0x4eed3bf65d1e1b16, 0x3ab38d46ee060a3a, 0x933c24a9c4deb66a, 0x9405e242522e9052,
+	 0x7a032dce68eb111d, 0x1ebcf8a70425b902, 0x66d03fb150c24667, 0x1120ae9611a5dae9,
+	 0xa9efc19ff179c4b4, 0xafae1da4d1de4396, 0x3002ef1a69260994, 0x16b712b93397dc9d,
+	 0x1a22081545cb8a4b, 0xb1735695eb953e4d, 0x49d2fbd123538ba0, 0x1013f9fc01a466d1,
+	 0xa8d51470c4858b87, 0x4805a201bb6e92f6, 0x66a3f916f355efbe, 0x27894646eda66cef,
+	 0x4515236331615c58, 0x0ffe6ae1e0a0dc56, 0xb7ec298d487611f9, 0x5467dfa41d436cd5,
+	 0xd3b4d812af1f54bc, 0xd14b97b65581cbf4, 0x9d52f7b98ac8055f, 0xa87b7969c0371585,
+	 0xa1843f2fc6d156d9, 0x94987f71f5f6c83f, 0xa196ee157c552bc9, 0x0776a96f4a05334b,
+	 0x844745e3e42bddd3, 0x5528babc4179a9e1, 0xd0ceb9641c31c14e, 0x2134efed23681026,
+	 0x1e6c3f7ee15535cd, 0xd9850fe1c305395a, 0x8eab182f7578fd01, 0x341ccd8f6bd5679e,
+	 0x1f6bc86f9a1d4275, 0xc256345e045f61a9, 0xe3ed4f18484d4069, 0x673fa62a480194db,
+	 0xee4bd7a6927cab62, 0xc0e40f3360de9a5f, 0x3219482b756b3f08, 0x8e50ea05c7b96136,
+	 0xecc419ddb842b82f, 0xacafa7a0513f4e9f, 0xa4631f0a7938945d, 0x3a13a22d986c470c,
+	 0x2003b3c02b665020, 0x47781553dd6d9769, 0xf935b68ccec5171e, 0x07844adbbe784e29,
+	 0x499016e946023d2c, 0x51360afd2c45f37b, 0x8ec28fb97ed2254b, 0xa4f16cb4e7efff66,
+	 0x99e9e35dd95bf9cd, 0x09e1f1a03e856d76, 0x350aa3c5012f7d44, 0xb01e00aad48d7ca9,
+	 0x02d905bbbb8d4124, 0x6519286c2b761934, 0x749d8bea98f164f9, 0x542121bf2e2daacd,
+	 0x366a2a143c3dff71, 0x9b51cb138944031e, 0x0a2205bb8342178f, 0x03676a9993b6e407,
+	 0x65969fae1a883a31, 0x81b0c788e3799f87, 0x79f7613d12a0c571, 0x659d151e3141c040,
+	 0x8592c53662e55254, 0x0030891770a444a4, 0xc676a5afcf18accd, 0x4b7936c4d7ce5428,
+	 0xf8a9bce3d613c08c, 0xe7ea82eb228385c5, 0xbd3b3f0c27db4310, 0x70bc390a8943039a,
+	 0x60d5ea2a1f1dc32a, 0xfdbdb4606ba4d1e0, 0x9b98fd324f20090c, 0xac991c80c3b00dfa,
+	 0x3b17895a8c12ce18, 0x7aa4328e11df5519, 0xfa1944b8c488eaff, 0x36dc94f013b5ce14,
+	 0x00af69a06167c256, 0x043612c1ae8d676e, 0x8cca13434c24e669, 0x01c8f2e45584fef2,
+	 0x69cee082e80ec2c4, 0x1adf836115445815, 0xd3233d033851a624, 0x1943791549757219,
+	 0x4023a35ee8c4de1b, 0x10bbcf23c86ef4e5, 0xa4ef69c9373fa24a, 0xb20c8c6ea0af624c,
+	 0x731c11cbde34f3c4, 0x1216a568c387b8ac, 0x32076708191b628d, 0x09cfad1812925813,
+	 0xe3cf3718d80a5c2d, 0x634d44912bf019b3, 0x8e8ea470b426b3a3, 0x50d054a2d7131dc3,
+	 0x992d99a2ce146aab, 0xcb9026964d7dfd85, 0x41323fdfe13358a8, 0x1585139d68836929,
+	 0x2a4ca02e2b8e84ec, 0xd6692b91034edd80, 0xd40474bdad1bf0e7, 0x7a002b89b75b918a,
+	 0x5eb62f0b593a94b5, 0x2533dacd97cc2e29, 0xfb7e07b5be11833e, 0x3cff3c24c836f925,
+	 0x890e2f1e402ddf71, 0x94c870d3f6abd5e4, 0x5b021a959206be87, 0x1c7851915f937165,
+	 0xe71f5d0d99002a77, 0x942c4cc821b7b1a9, 0x5b1655e37bbfaec6, 0x9536a082ebd0f718,
+	 0x427a90bc25bc10e4, 0xdf0742fefb84d01e, 0x25b4f68b27496900, 0x15daae56631109f4,
+	 0x415ab4feb6cb6f74, 0x10b6731c04bb13b9, 0xa3c2a0035c56a028, 0xa1369588eafe6dca,
+	 0xfe180d3f8f0099f5, 0xc28f951a1f2f2899, 0x48716b772ba6fd47, 0xb31b90e44b0c597e,
+	 0x7e586a16eacef5ec, 0xd00701b0147bbccd, 0x9110bf4f5e8337df, 0x6035260aabab6702,
+	 0xcd6736bb92d2876b, 0xad22bd93bc071a7c, 0x339d82838d63336c, 0x5893c2e4fad478c9,
+	 0x047d118642700b04, 0xcdca171c6f2ed541, 0xac4e0da259a7ecf6, 0x30c0ee69889da75a,
+	 0xb047b98919d02bc9, 0x84b86ed777e6be37, 0x6a1acfea1b52e8cb, 0xa29e6849a6fd2694,
+	 0x19c1841fb41e52f7, 0x29b5717b6d14a6bd, 0xb746023c21f2b0ec, 0x0e9603434aa76e3f,
+	 0x6da9509c95310be6, 0x477834833ea90475, 0x2869bd659e1d1226, 0x365b0e0fec6cabac,
+	 0x779bb230eb5e6865, 0x56863d3d009593b2, 0x55d9e5941e24ca81, 0x8db445a3cc9ec055,
+	},
+};
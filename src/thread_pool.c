@@ -0,0 +1,417 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#ifdef __linux__
+#define _GNU_SOURCE
+#include <sched.h>
+#endif
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/numa.h>
+#include <gmssl/thread_pool.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef HANDLE pool_thread_t;
+typedef LONG64 pool_atomic_t;
+static SRWLOCK pool_lock = SRWLOCK_INIT;
+static CONDITION_VARIABLE pool_work = CONDITION_VARIABLE_INIT;
+static CONDITION_VARIABLE pool_finished = CONDITION_VARIABLE_INIT;
+#define pool_mutex_lock()	AcquireSRWLockExclusive(&pool_lock)
+#define pool_mutex_unlock()	ReleaseSRWLockExclusive(&pool_lock)
+#define pool_cond_wait(c)	SleepConditionVariableSRW(c, &pool_lock, INFINITE, 0)
+#define pool_cond_signal(c)	WakeConditionVariable(c)
+#define pool_cond_broadcast(c)	WakeAllConditionVariable(c)
+#define pool_load(p)		InterlockedCompareExchange64((p), 0, 0)
+#define pool_fetch_add(p,v)	InterlockedExchangeAdd64((p), (v))
+#else
+#include <unistd.h>
+#include <pthread.h>
+typedef pthread_t pool_thread_t;
+typedef int64_t pool_atomic_t;
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t pool_work = PTHREAD_COND_INITIALIZER;
+static pthread_cond_t pool_finished = PTHREAD_COND_INITIALIZER;
+#define pool_mutex_lock()	pthread_mutex_lock(&pool_lock)
+#define pool_mutex_unlock()	pthread_mutex_unlock(&pool_lock)
+#define pool_cond_wait(c)	pthread_cond_wait(c, &pool_lock)
+#define pool_cond_signal(c)	pthread_cond_signal(c)
+#define pool_cond_broadcast(c)	pthread_cond_broadcast(c)
+#define pool_load(p)		__atomic_load_n((p), __ATOMIC_ACQUIRE)
+#define pool_fetch_add(p,v)	__atomic_fetch_add((p), (v), __ATOMIC_ACQ_REL)
+#endif
+
+
+/*
+ * The items of a call are claimed one at a time with an atomic add on `next`,
+ * by the caller and by every worker that found the call in the list. The
+ * call is freed by the last of them to leave it, as an executor may start a
+ * helper after the caller has returned.
+ */
+typedef struct POOL_CALL_st {
+	GMSSL_TASK task;
+	uint8_t *args;
+	size_t arg_size;
+	int64_t n;
+	pool_atomic_t next;
+	pool_atomic_t done;
+	int refs; // under pool_lock
+	int queued; // in pool.calls
+	struct POOL_CALL_st *next_call;
+} POOL_CALL;
+
+static struct {
+	int threads; // 0 for one per online CPU
+	int cpus[GMSSL_THREAD_POOL_MAX_THREADS];
+	size_t cpus_cnt;
+	GMSSL_EXECUTOR executor;
+	void *executor_arg;
+
+	int running;
+	int stop;
+	int workers_cnt;
+	pool_thread_t workers[GMSSL_THREAD_POOL_MAX_THREADS];
+	int worker_cpus[GMSSL_THREAD_POOL_MAX_THREADS];
+	POOL_CALL *calls; // calls with items left, newest first
+} pool;
+
+static int online_cpus(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#endif
+}
+
+// under pool_lock
+static int pool_threads(void)
+{
+	int threads = pool.threads ? pool.threads : online_cpus();
+	return threads < GMSSL_THREAD_POOL_MAX_THREADS ? threads : GMSSL_THREAD_POOL_MAX_THREADS;
+}
+
+static void pool_call_work(POOL_CALL *call)
+{
+	int64_t i;
+
+	while ((i = pool_fetch_add(&call->next, 1)) < call->n) {
+		call->task(call->args + call->arg_size * (size_t)i);
+		if (pool_fetch_add(&call->done, 1) + 1 == call->n) {
+			pool_mutex_lock();
+			pool_cond_broadcast(&pool_finished);
+			pool_mutex_unlock();
+		}
+	}
+}
+
+// under pool_lock
+static void pool_call_release(POOL_CALL *call)
+{
+	if (--call->refs == 0) {
+		free(call);
+	}
+}
+
+// under pool_lock, the calls with all items claimed are taken off the list
+static POOL_CALL *pool_call_next(void)
+{
+	POOL_CALL *call;
+
+	while ((call = pool.calls) != NULL) {
+		if (pool_load(&call->next) < call->n) {
+			return call;
+		}
+		pool.calls = call->next_call;
+		call->queued = 0;
+	}
+	return NULL;
+}
+
+// under pool_lock
+static void pool_call_unqueue(POOL_CALL *call)
+{
+	POOL_CALL **pp;
+
+	for (pp = &pool.calls; *pp; pp = &(*pp)->next_call) {
+		if (*pp == call) {
+			*pp = call->next_call;
+			break;
+		}
+	}
+	call->queued = 0;
+}
+
+static void pool_worker_run(const int *cpu)
+{
+	POOL_CALL *call;
+
+	if (*cpu >= 0) {
+#ifdef __linux__
+		cpu_set_t set;
+		CPU_ZERO(&set);
+		CPU_SET(*cpu, &set);
+		if (sched_setaffinity(0, sizeof(set), &set) == 0) {
+			gmssl_numa_set_thread_node(gmssl_numa_node_of_cpu(*cpu));
+		}
+#elif defined(_WIN32)
+		if (*cpu < 64) {
+			SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << *cpu);
+		}
+#endif
+	}
+
+	pool_mutex_lock();
+	for (;;) {
+		while (!pool.stop && !(call = pool_call_next())) {
+			pool_cond_wait(&pool_work);
+		}
+		if (pool.stop) {
+			break;
+		}
+		call->refs++;
+		pool_mutex_unlock();
+		pool_call_work(call);
+		pool_mutex_lock();
+		pool_call_release(call);
+	}
+	pool_mutex_unlock();
+}
+
+#ifdef _WIN32
+static unsigned __stdcall pool_worker_thread(void *arg)
+{
+	pool_worker_run((const int *)arg);
+	return 0;
+}
+#else
+static void *pool_worker_thread(void *arg)
+{
+	pool_worker_run((const int *)arg);
+	return NULL;
+}
+#endif
+
+// the helper of a call run by the executor
+static void pool_executor_task(void *arg)
+{
+	POOL_CALL *call = (POOL_CALL *)arg;
+
+	pool_call_work(call);
+	pool_mutex_lock();
+	pool_call_release(call);
+	pool_mutex_unlock();
+}
+
+// under pool_lock, the calling thread is one of the threads
+static void pool_start(void)
+{
+	int threads = pool_threads();
+	int i;
+
+	pool.running = 1;
+	if (pool.executor) {
+		return;
+	}
+	for (i = 0; i < threads - 1; i++) {
+		pool.worker_cpus[i] = pool.cpus_cnt ? pool.cpus[i % pool.cpus_cnt] : -1;
+#ifdef _WIN32
+		if (!(pool.workers[i] = (HANDLE)_beginthreadex(NULL, 0, pool_worker_thread, &pool.worker_cpus[i], 0, NULL))) {
+#else
+		if (pthread_create(&pool.workers[i], NULL, pool_worker_thread, &pool.worker_cpus[i]) != 0) {
+#endif
+			// the calls still run, on fewer threads
+			error_print();
+			break;
+		}
+		pool.workers_cnt++;
+	}
+}
+
+// under pool_lock, which is released while the workers exit
+static void pool_stop(void)
+{
+	int i;
+
+	pool.stop = 1;
+	pool_cond_broadcast(&pool_work);
+	pool_mutex_unlock();
+	for (i = 0; i < pool.workers_cnt; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(pool.workers[i], INFINITE);
+		CloseHandle(pool.workers[i]);
+#else
+		pthread_join(pool.workers[i], NULL);
+#endif
+	}
+	pool_mutex_lock();
+	pool.workers_cnt = 0;
+	pool.stop = 0;
+	pool.running = 0;
+}
+
+int gmssl_thread_pool_init(int threads, const int *cpus, size_t cpus_cnt)
+{
+	size_t i;
+
+	if (threads > GMSSL_THREAD_POOL_MAX_THREADS || cpus_cnt > GMSSL_THREAD_POOL_MAX_THREADS) {
+		error_print();
+		return -1;
+	}
+	if (cpus_cnt && !cpus) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < cpus_cnt; i++) {
+		if (cpus[i] < 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	pool_mutex_lock();
+	if (pool.running) {
+		pool_stop();
+	}
+	pool.threads = threads > 0 ? threads : 0;
+	if (cpus_cnt) {
+		memcpy(pool.cpus, cpus, sizeof(int) * cpus_cnt);
+	}
+	pool.cpus_cnt = cpus_cnt;
+	pool.executor = NULL;
+	pool.executor_arg = NULL;
+	pool_start();
+	pool_mutex_unlock();
+	return 1;
+}
+
+int gmssl_thread_pool_set_executor(GMSSL_EXECUTOR executor, void *executor_arg, int threads)
+{
+	if (executor && (threads <= 0 || threads > GMSSL_THREAD_POOL_MAX_THREADS)) {
+		error_print();
+		return -1;
+	}
+
+	pool_mutex_lock();
+	if (pool.running) {
+		pool_stop();
+	}
+	pool.executor = executor;
+	pool.executor_arg = executor_arg;
+	pool.threads = executor ? threads : 0;
+	pool.cpus_cnt = 0;
+	pool_mutex_unlock();
+	return 1;
+}
+
+void gmssl_thread_pool_cleanup(void)
+{
+	pool_mutex_lock();
+	if (pool.running) {
+		pool_stop();
+	}
+	pool.threads = 0;
+	pool.cpus_cnt = 0;
+	pool.executor = NULL;
+	pool.executor_arg = NULL;
+	pool_mutex_unlock();
+}
+
+int gmssl_thread_pool_size(void)
+{
+	int threads;
+
+	pool_mutex_lock();
+	threads = pool_threads();
+	pool_mutex_unlock();
+	return threads;
+}
+
+int gmssl_thread_pool_run(GMSSL_TASK task, void *args, size_t arg_size, size_t n)
+{
+	POOL_CALL *call;
+	GMSSL_EXECUTOR executor;
+	void *executor_arg;
+	size_t helpers;
+	size_t i;
+
+	if (!task || (!args && n)) {
+		error_print();
+		return -1;
+	}
+	if (n <= 1 || !(call = (POOL_CALL *)calloc(1, sizeof(*call)))) {
+		// nothing to share, or the calling thread does all of it
+		for (i = 0; i < n; i++) {
+			task((uint8_t *)args + arg_size * i);
+		}
+		return 1;
+	}
+	call->task = task;
+	call->args = (uint8_t *)args;
+	call->arg_size = arg_size;
+	call->n = (int64_t)n;
+	call->refs = 1;
+
+	pool_mutex_lock();
+	if (!pool.running) {
+		pool_start();
+	}
+	executor = pool.executor;
+	executor_arg = pool.executor_arg;
+	helpers = (size_t)(executor ? pool_threads() - 1 : pool.workers_cnt);
+	if (helpers > n - 1) {
+		helpers = n - 1;
+	}
+	if (!executor && helpers) {
+		call->next_call = pool.calls;
+		call->queued = 1;
+		pool.calls = call;
+		if (helpers == (size_t)pool.workers_cnt) {
+			pool_cond_broadcast(&pool_work);
+		} else {
+			for (i = 0; i < helpers; i++) {
+				pool_cond_signal(&pool_work);
+			}
+		}
+	}
+	pool_mutex_unlock();
+
+	// the executor may run the helper before returning, so the lock is not held
+	for (i = 0; executor && i < helpers; i++) {
+		pool_mutex_lock();
+		call->refs++;
+		pool_mutex_unlock();
+		if (executor(executor_arg, pool_executor_task, call) != 1) {
+			pool_mutex_lock();
+			call->refs--;
+			pool_mutex_unlock();
+			break;
+		}
+	}
+
+	pool_call_work(call);
+
+	pool_mutex_lock();
+	while (pool_load(&call->done) < call->n) {
+		pool_cond_wait(&pool_finished);
+	}
+	if (call->queued) {
+		pool_call_unqueue(call);
+	}
+	pool_call_release(call);
+	pool_mutex_unlock();
+	return 1;
+}
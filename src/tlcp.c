@@ -109,6 +109,93 @@ int tlcp_record_get_handshake_server_key_exchange_pke(const uint8_t *record,
 	return 1;
 }
 
+// unknown extensions are ignored, only status_request is answered
+static int tlcp_process_client_hello_exts(TLS_CONNECT *conn, const uint8_t *exts, size_t exts_len)
+{
+	while (exts_len) {
+		int ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+		int rv;
+
+		if (tls_ext_from_bytes(&ext_type, &ext_data, &ext_datalen, &exts, &exts_len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (ext_type == TLS_extension_status_request) {
+			if ((rv = tls_process_status_request(ext_data, ext_datalen)) < 0) {
+				error_print();
+				return -1;
+			}
+			conn->hs.ocsp_requested = conn->ocsp_stapler && rv;
+		}
+	}
+	return 1;
+}
+
+// the server may only echo an empty status_request or server_name, and the record size limits
+static int tlcp_process_server_hello_exts(TLS_CONNECT *conn, const uint8_t *exts, size_t exts_len)
+{
+	int server_name = 0;
+	uint16_t record_size_limit = 0;
+	int max_fragment_length = 0;
+
+	while (exts_len) {
+		int ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_ext_from_bytes(&ext_type, &ext_data, &ext_datalen, &exts, &exts_len) != 1) {
+			error_print();
+			return -1;
+		}
+		switch (ext_type) {
+		case TLS_extension_record_size_limit:
+			if (record_size_limit
+				|| tls_process_record_size_limit(ext_data, ext_datalen, &record_size_limit) != 1) {
+				error_print();
+				return -1;
+			}
+			continue;
+		case TLS_extension_max_fragment_length:
+			if (max_fragment_length
+				|| tls_process_max_fragment_length(ext_data, ext_datalen, &max_fragment_length) != 1) {
+				error_print();
+				return -1;
+			}
+			continue;
+		}
+		if (ext_datalen) {
+			error_print();
+			return -1;
+		}
+		switch (ext_type) {
+		case TLS_extension_status_request:
+			if (!conn->ocsp_stapling || conn->hs.ocsp_requested) {
+				error_print();
+				return -1;
+			}
+			conn->hs.ocsp_requested = 1;
+			break;
+		case TLS_extension_server_name:
+			if (!conn->server_name[0] || server_name) {
+				error_print();
+				return -1;
+			}
+			server_name = 1;
+			break;
+		default:
+			error_print();
+			return -1;
+		}
+	}
+	if (tls_process_record_size(conn, record_size_limit, max_fragment_length) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int tlcp_server_key_exchange_pke_print(FILE *fp, const uint8_t *data, size_t datalen, int format, int indent)
 {
 	const uint8_t *sig;
@@ -131,12 +218,13 @@ int tlcp_server_key_exchange_pke_print(FILE *fp, const uint8_t *data, size_t dat
 int tlcp_do_connect(TLS_CONNECT *conn)
 {
 	int ret = -1;
+	int rv;
+	TLS_HANDSHAKE *hs = &conn->hs;
+	ARENA_MARK arena_mark;
 	uint8_t *record = conn->record;
 	uint8_t finished_record[TLS_FINISHED_RECORD_BUF_SIZE];
 	size_t recordlen, finished_record_len;
 
-	uint8_t client_random[32];
-	uint8_t server_random[32];
 	int protocol;
 	int cipher_suite;
 	const uint8_t *random;
@@ -144,9 +232,13 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	size_t session_id_len;
 	const uint8_t *exts;
 	size_t exts_len;
+	uint8_t *client_exts;
+	size_t client_exts_len = 0;
+	const uint8_t *ocsp_resp;
+	size_t ocsp_resp_len;
+	int alert;
 
 	SM2_KEY server_sign_key;
-	SM2_KEY server_enc_key;
 	SM2_VERIFY_CTX verify_ctx;
 	SM2_SIGN_CTX sign_ctx;
 	const uint8_t *sig;
@@ -154,7 +246,6 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	uint8_t pre_master_secret[48];
 	uint8_t enced_pre_master_secret[SM2_MAX_CIPHERTEXT_SIZE];
 	size_t enced_pre_master_secret_len;
-	SM3_CTX sm3_ctx;
 	SM3_CTX tmp_sm3_ctx;
 	uint8_t sm3_hash[32];
 	const uint8_t *verify_data;
@@ -170,39 +261,68 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	size_t len;
 
 	int depth = 5;
-	int alert = 0;
 	int verify_result;
-
+	uint64_t phase_time;
+
+	tls_conn_arena_begin(conn, &arena_mark);
+
+	switch (hs->state) {
+	case TLS_state_client_hello: break;
+	case TLS_state_server_hello: goto server_hello;
+	case TLS_state_server_certificate: goto server_certificate;
+	case TLS_state_certificate_status: goto certificate_status;
+	case TLS_state_server_key_exchange: goto server_key_exchange;
+	case TLS_state_certificate_request: goto certificate_request;
+	case TLS_state_server_hello_done: goto server_hello_done;
+	case TLS_state_change_cipher_spec: goto change_cipher_spec;
+	case TLS_state_finished: goto finished;
+	case TLS_state_handshake_done: goto handshake_done;
+	default:
+		error_print();
+		return -1;
+	}
 
 	// 初始化记录缓冲
 	tls_record_set_protocol(record, TLS_protocol_tlcp);
-	tls_record_set_protocol(finished_record, TLS_protocol_tlcp);
 
 	// 准备Finished Context（和ClientVerify）
-	sm3_init(&sm3_ctx);
+	sm3_init(&hs->sm3_ctx);
 
-	// send ClientHello
-	tls_random_generate(client_random);
+	// send ClientHello, offer the session of tls_set_session()
+	tls_random_generate(hs->client_random);
+	if (!(client_exts = (uint8_t *)arena_alloc(&conn->arena, TLS_MAX_EXTENSIONS_SIZE))) {
+		error_print();
+		goto end;
+	}
+	p = client_exts;
+	if (conn->ocsp_stapling) {
+		tls_status_request_ext_to_bytes(&p, &client_exts_len);
+	}
+	if (conn->server_name[0]) {
+		tls_server_name_ext_to_bytes(conn->server_name, &p, &client_exts_len);
+	}
+	tls_record_size_exts_to_bytes(conn, &p, &client_exts_len);
 	if (tls_record_set_handshake_client_hello(record, &recordlen,
-		TLS_protocol_tlcp, client_random, NULL, 0,
-		tlcp_ciphers, tlcp_ciphers_count, NULL, 0) != 1) {
+		TLS_protocol_tlcp, hs->client_random,
+		conn->session.session_id_len ? conn->session.session_id : NULL, conn->session.session_id_len,
+		tlcp_ciphers, tlcp_ciphers_count,
+		client_exts_len ? client_exts : NULL, client_exts_len) != 1) {
 		error_print();
 		goto end;
 	}
 	tls_trace("send ClientHello\n");
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
-
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+	hs->state = TLS_state_server_hello;
+server_hello:
 	// recv ServerHello
 	tls_trace("recv ServerHello\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
 	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
@@ -227,50 +347,117 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		error_print();
 		goto end;
 	}
-	if (exts) {
+	if (exts && tlcp_process_server_hello_exts(conn, exts, exts_len) != 1) {
 		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
+		tls_send_alert(conn, TLS_alert_unsupported_extension);
 		goto end;
 	}
-	memcpy(server_random, random, 32);
+	memcpy(hs->server_random, random, 32);
 	memcpy(conn->session_id, session_id, session_id_len);
+	conn->session_id_len = session_id_len;
 	conn->cipher_suite = cipher_suite;
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
+	// the server echoes the offered session ID to resume it
+	if (session_id_len && session_id_len == conn->session.session_id_len
+		&& memcmp(session_id, conn->session.session_id, session_id_len) == 0) {
+		if (cipher_suite != conn->session.cipher_suite) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_illegal_parameter);
+			goto end;
+		}
+		tls_trace("resume session\n");
+		memcpy(conn->master_secret, conn->session.master_secret, 48);
+		phase_time = tls_handshake_phase_begin(conn);
+		if (tls_prf(conn->master_secret, 48, "key expansion",
+			hs->server_random, 32, hs->client_random, 32,
+			96, conn->key_block) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
+		sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
+		sm4_set_encrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
+		sm4_set_decrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
+		conn->session_reused = 1;
+		hs->state = TLS_state_change_cipher_spec;
+		goto change_cipher_spec;
+	}
+	hs->state = TLS_state_server_certificate;
+server_certificate:
 	// recv ServerCertificate
 	tls_trace("recv ServerCertificate\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
 
-	if (tls_record_get_handshake_certificate(record,
+	if (tls_conn_certs_reserve(&conn->server_certs, recordlen) != 1
+		|| tls_record_get_handshake_certificate(record,
 		conn->server_certs, &conn->server_certs_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// verify ServerCertificate
 	if (conn->ca_certs_len) {
 		// 只有提供了CA证书才验证服务器证书链
 		// FIXME: 逻辑需要再检查
-		if (x509_certs_verify_tlcp(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-			conn->ca_certs, conn->ca_certs_len, depth, &verify_result) != 1) {
+		phase_time = tls_handshake_phase_begin(conn);
+		if (x509_certs_verify_tlcp_ex(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
+			conn->ca_certs, conn->ca_certs_len, conn->ca_store, depth, &verify_result) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
 	}
-
+	if (!hs->ocsp_requested) {
+		if (conn->ocsp_stapling && tls_process_ocsp_response(conn, NULL, 0, &alert) != 1) {
+			error_print();
+			tls_send_alert(conn, alert);
+			goto end;
+		}
+		hs->state = TLS_state_server_key_exchange;
+		goto server_key_exchange;
+	}
+	hs->state = TLS_state_certificate_status;
+certificate_status:
+	// recv CertificateStatus
+	tls_trace("recv CertificateStatus\n");
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	tlcp_record_trace(stderr, record, recordlen, 0, 0);
+	if (tls_record_protocol(record) != TLS_protocol_tlcp
+		|| tls_record_get_handshake_certificate_status(record, &ocsp_resp, &ocsp_resp_len) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_unexpected_message);
+		goto end;
+	}
+	if (tls_process_ocsp_response(conn, ocsp_resp, ocsp_resp_len, &alert) != 1) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+	hs->state = TLS_state_server_key_exchange;
+server_key_exchange:
 	// recv ServerKeyExchange
 	tls_trace("recv ServerKeyExchange\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -281,13 +468,13 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// verify ServerKeyExchange
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 0, &cp, &len) != 1
 		|| x509_cert_get_subject_public_key(cp, len, &server_sign_key) != 1
 		|| x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 1, &server_enc_cert, &server_enc_cert_len) != 1
-		|| x509_cert_get_subject_public_key(server_enc_cert, server_enc_cert_len, &server_enc_key) != 1) {
+		|| x509_cert_get_subject_public_key(server_enc_cert, server_enc_cert_len, &hs->server_enc_key) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
@@ -295,29 +482,40 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	p = server_enc_cert_lenbuf; len = 0;
 	tls_uint24_to_bytes((uint24_t)server_enc_cert_len, &p, &len);
 	if (sm2_verify_init(&verify_ctx, &server_sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
-		|| sm2_verify_update(&verify_ctx, client_random, 32) != 1
-		|| sm2_verify_update(&verify_ctx, server_random, 32) != 1
+		|| sm2_verify_update(&verify_ctx, hs->client_random, 32) != 1
+		|| sm2_verify_update(&verify_ctx, hs->server_random, 32) != 1
 		|| sm2_verify_update(&verify_ctx, server_enc_cert_lenbuf, 3) != 1
 		|| sm2_verify_update(&verify_ctx, server_enc_cert, server_enc_cert_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	phase_time = tls_handshake_phase_begin(conn);
 	if (sm2_verify_finish(&verify_ctx, sig, siglen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
-
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+	hs->state = TLS_state_certificate_request;
+certificate_request:
 	// recv CertificateRequest or ServerHelloDone
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp
 		|| tls_record_get_handshake(record, &handshake_type, &cp, &len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	if (handshake_type == TLS_handshake_certificate_request) {
+	if (handshake_type != TLS_handshake_certificate_request) {
+		// 这个得处理一下
+		conn->client_certs_len = 0;
+		conn->sign_key = NULL;
+		//client_sign_key = NULL;
+		goto recv_server_hello_done;
+	} else {
 		const uint8_t *cert_types;
 		size_t cert_types_len;
 		const uint8_t *ca_names;
@@ -343,21 +541,20 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unsupported_certificate);
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
-
-		// recv ServerHelloDone
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
-			|| tls_record_protocol(record) != TLS_protocol_tlcp) {
-			error_print();
-			tls_send_alert(conn, TLS_alert_unexpected_message);
-			goto end;
-		}
-	} else {
-		// 这个得处理一下
-		conn->client_certs_len = 0;
-		gmssl_secure_clear(&conn->sign_key, sizeof(SM2_KEY));
-		//client_sign_key = NULL;
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+	}
+	hs->state = TLS_state_server_hello_done;
+server_hello_done:
+	// recv ServerHelloDone
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
 	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_unexpected_message);
+		goto end;
+	}
+recv_server_hello_done:
 	tls_trace("recv ServerHelloDone\n");
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
 	if (tls_record_get_handshake_server_hello_done(record) != 1) {
@@ -365,37 +562,39 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// send ClientCertificate
 	if (conn->client_certs_len) {
 		tls_trace("send ClientCertificate\n");
-		if (tls_record_set_handshake_certificate(record, &recordlen, conn->client_certs, conn->client_certs_len) != 1) {
+		if (tls_conn_set_handshake_certificate(conn, record, &recordlen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
 		tlcp_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_send(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 	}
 
 	// generate MASTER_SECRET
 	tls_trace("generate secrets\n");
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_pre_master_secret_generate(pre_master_secret, TLS_protocol_tlcp) != 1
 		|| tls_prf(pre_master_secret, 48, "master secret",
-			client_random, 32, server_random, 32,
+			hs->client_random, 32, hs->server_random, 32,
 			48, conn->master_secret) != 1
 		|| tls_prf(conn->master_secret, 48, "key expansion",
-			server_random, 32, client_random, 32,
+			hs->server_random, 32, hs->client_random, 32,
 			96, conn->key_block) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
 	sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
 	sm4_set_encrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
@@ -403,7 +602,7 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	/*
 	tls_secrets_print(stderr,
 		pre_master_secret, 48,
-		client_random, server_random,
+		hs->client_random, hs->server_random,
 		conn->master_secret,
 		conn->key_block, 96,
 		0, 4);
@@ -411,7 +610,8 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 
 	// send ClientKeyExchange
 	tls_trace("send ClientKeyExchange\n");
-	if (sm2_encrypt(&server_enc_key, pre_master_secret, 48,
+	phase_time = tls_handshake_phase_begin(conn);
+	if (sm2_encrypt(&hs->server_enc_key, pre_master_secret, 48,
 			enced_pre_master_secret, &enced_pre_master_secret_len) != 1
 		|| tls_record_set_handshake_client_key_exchange_pke(record, &recordlen,
 			enced_pre_master_secret, enced_pre_master_secret_len) != 1) {
@@ -419,42 +619,46 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// send CertificateVerify
 	if (conn->client_certs_len) {
 		tls_trace("send CertificateVerify\n");
 
-		SM3_CTX cert_verify_sm3_ctx = sm3_ctx;
+		SM3_CTX cert_verify_sm3_ctx = hs->sm3_ctx;
 		uint8_t cert_verify_hash[SM3_DIGEST_SIZE];
 		uint8_t sigbuf[SM2_MAX_SIGNATURE_SIZE];
 
 		sm3_finish(&cert_verify_sm3_ctx, cert_verify_hash);
-		if (sm2_sign_init(&sign_ctx, &conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		phase_time = tls_handshake_phase_begin(conn);
+		if (sm2_sign_init(&sign_ctx, conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
 			|| sm2_sign_update(&sign_ctx, cert_verify_hash, SM3_DIGEST_SIZE) != 1
 			|| sm2_sign_finish(&sign_ctx, sigbuf, &siglen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 		if (tls_record_set_handshake_certificate_verify(record, &recordlen, sigbuf, siglen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
 		tlcp_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_send(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 	}
 
+send_change_cipher_spec:
 	// send [ChangeCipherSpec]
 	tls_trace("send [ChangeCipherSpec]\n");
 	if (tls_record_set_change_cipher_spec(record, &recordlen) !=1) {
@@ -463,15 +667,17 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
 
 	// send Client Finished
 	tls_trace("send Finished\n");
-	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(sm3_ctx));
+	tls_record_set_protocol(finished_record, TLS_protocol_tlcp);
+	memcpy(&tmp_sm3_ctx, &hs->sm3_ctx, sizeof(SM3_CTX));
 	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "client finished",
 			sm3_hash, 32, NULL, 0, sizeof(local_verify_data), local_verify_data) != 1
 		|| tls_record_set_handshake_finished(finished_record, &finished_record_len,
@@ -480,8 +686,9 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	tlcp_record_trace(stderr, finished_record, finished_record_len, 0, 0);
-	sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
+	sm3_update(&hs->sm3_ctx, finished_record + 5, finished_record_len - 5);
 
 	// encrypt Client Finished
 	if (tls_record_encrypt(&conn->client_write_mac_ctx, &conn->client_write_enc_key,
@@ -492,15 +699,23 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 	}
 	tls_encrypted_record_trace(stderr, record, recordlen, (1<<24), 0); // 强制打印密文原数据
 	tls_seq_num_incr(conn->client_seq_num);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-
+	if (conn->session_reused) {
+		// the abbreviated handshake ends with the client Finished
+		hs->state = TLS_state_handshake_done;
+		goto handshake_done;
+	}
+	hs->state = TLS_state_change_cipher_spec;
+change_cipher_spec:
 	// [ChangeCipherSpec]
 	tls_trace("recv [ChangeCipherSpec]\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -511,11 +726,14 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-
+	hs->state = TLS_state_finished;
+finished:
 	// Finished
 	tls_trace("recv Finished\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -544,37 +762,80 @@ int tlcp_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	sm3_finish(&sm3_ctx, sm3_hash);
+	memcpy(&tmp_sm3_ctx, &hs->sm3_ctx, sizeof(SM3_CTX));
+	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "server finished",
 		sm3_hash, 32, NULL, 0, sizeof(local_verify_data), local_verify_data) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (memcmp(verify_data, local_verify_data, sizeof(local_verify_data)) != 0) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
+	if (conn->session_reused) {
+		// client Finished covers the server Finished
+		sm3_update(&hs->sm3_ctx, finished_record + 5, finished_record_len - 5);
+		goto send_change_cipher_spec;
+	}
+	if (tls_session_save(conn) < 0) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	hs->state = TLS_state_handshake_done;
+handshake_done:
+	if ((rv = tls_flush(conn)) != 1) {
+		goto wait;
+	}
 
 	if (!conn->quiet)
 		fprintf(stderr, "Connection established!\n");
 
 
 	conn->protocol = TLS_protocol_tlcp;
-	conn->cipher_suite = cipher_suite;
 
 	ret = 1;
+	goto end;
 
+wait:
+	if (rv == TLS_ERROR_WANT_READ || rv == TLS_ERROR_WANT_WRITE) {
+		tls_conn_arena_end(conn, &arena_mark, 0);
+		return rv;
+	}
+	error_print();
+	tls_send_alert(conn, TLS_alert_unexpected_message);
 end:
+	tls_conn_arena_end(conn, &arena_mark, 1);
 	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
 	gmssl_secure_clear(pre_master_secret, sizeof(pre_master_secret));
+	gmssl_secure_clear(hs, sizeof(TLS_HANDSHAKE));
 	return ret;
 }
 
+// keep the job of a TLS_ERROR_WANT_ASYNC return for the next call
+static int tlcp_key_method_result(TLS_CONNECT *conn, int rv, void *job)
+{
+	if (rv == TLS_ERROR_WANT_ASYNC) {
+		conn->hs.async_pending = 1;
+		conn->hs.async_job = job;
+		return rv;
+	}
+	conn->hs.async_pending = 0;
+	conn->hs.async_job = NULL;
+	return rv == 1 ? 1 : -1;
+}
+
 int tlcp_do_accept(TLS_CONNECT *conn)
 {
 	int ret = -1;
+	int rv;
+	TLS_HANDSHAKE *hs = &conn->hs;
+	ARENA_MARK arena_mark;
 
 	int client_verify = 0;
 
@@ -584,16 +845,19 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	const int server_ciphers[] = { TLS_cipher_ecc_sm4_cbc_sm3 }; // 未来应该支持GCM/CBC两个套件
 
 	// ClientHello, ServerHello
-	uint8_t client_random[32];
-	uint8_t server_random[32];
 	int protocol;
 	const uint8_t *random;
-	const uint8_t *session_id; // TLCP服务器忽略客户端SessionID，也不主动设置SessionID
+	const uint8_t *session_id; // 设置了会话缓存时才恢复或分配SessionID
 	size_t session_id_len;
 	const uint8_t *client_ciphers;
 	size_t client_ciphers_len;
 	const uint8_t *exts;
 	size_t exts_len;
+	uint8_t server_exts[24];
+	size_t server_exts_len = 0;
+	int alert;
+	uint8_t *ocsp_resp = NULL;
+	size_t ocsp_resp_len = 0;
 
 	// ServerKeyExchange
 	const uint8_t *server_enc_cert;
@@ -609,6 +873,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	const uint8_t *sig;
 	const int verify_depth = 5;
 	int verify_result;
+	uint64_t phase_time;
 
 	// ClientKeyExchange
 	const uint8_t *enced_pms;
@@ -617,7 +882,6 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	size_t pre_master_secret_len;
 
 	// Finished
-	SM3_CTX sm3_ctx;
 	SM3_CTX tmp_sm3_ctx;
 	uint8_t sm3_hash[32];
 	uint8_t local_verify_data[12];
@@ -633,16 +897,27 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	if (conn->ca_certs_len)
 		client_verify = 1;
 
-	// 初始化Finished和客户端验证环境
-	sm3_init(&sm3_ctx);
+	tls_conn_arena_begin(conn, &arena_mark);
 
+	switch (hs->state) {
+	case TLS_state_client_hello: break;
+	case TLS_state_server_key_exchange: goto server_key_exchange;
+	case TLS_state_client_certificate: goto client_certificate;
+	case TLS_state_client_key_exchange: goto client_key_exchange;
+	case TLS_state_client_key_exchange_decrypt: goto client_key_exchange_decrypt;
+	case TLS_state_certificate_verify: goto certificate_verify;
+	case TLS_state_change_cipher_spec: goto change_cipher_spec;
+	case TLS_state_finished: goto finished;
+	case TLS_state_handshake_done: goto handshake_done;
+	default:
+		error_print();
+		return -1;
+	}
 
 	// recv ClientHello
 	tls_trace("recv ClientHello\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
 	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
@@ -663,7 +938,7 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_protocol_version);
 		goto end;
 	}
-	memcpy(client_random, random, 32);
+	memcpy(hs->client_random, random, 32);
 	if (tls_cipher_suites_select(client_ciphers, client_ciphers_len,
 		server_ciphers, sizeof(server_ciphers)/sizeof(server_ciphers[0]),
 		&conn->cipher_suite) != 1) {
@@ -671,47 +946,138 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_insufficient_security);
 		goto end;
 	}
-	if (exts) {
-		// 忽略客户端扩展错误可以兼容错误的TLCP客户端实现
+	// the certificates, the keys and the OCSP stapler of the requested host
+	if (exts && tls_select_server_name(conn, exts, exts_len, &alert) < 0) {
 		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	if (exts && tls_select_record_size(conn, exts, exts_len, &alert) != 1) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	if (exts && tlcp_process_client_hello_exts(conn, exts, exts_len) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_decode_error);
+		goto end;
+	}
+	// 初始化Finished和客户端验证环境
+	sm3_init(&hs->sm3_ctx);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+
+	// resume the cached session, client authentication always needs a full handshake
+	if (!client_verify) {
+		if ((rv = tls_session_resume(conn, session_id, session_id_len)) < 0) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+	}
+	if (!conn->session_reused && conn->session_cache) {
+		if (rand_bytes(conn->session_id, 32) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		conn->session_id_len = 32;
+	}
+
+	// the status_request is acknowledged only with a response to staple
+	p = server_exts;
+	if (hs->ocsp_requested && !conn->session_reused
+		&& (ocsp_resp = (uint8_t *)arena_alloc(&conn->arena, TLS_OCSP_MAX_RESPONSE_SIZE)) != NULL
+		&& tls_ocsp_stapler_get(conn->ocsp_stapler, ocsp_resp, &ocsp_resp_len, TLS_OCSP_MAX_RESPONSE_SIZE) == 1) {
+		tls_uint16_to_bytes(TLS_extension_status_request, &p, &server_exts_len);
+		tls_uint16_to_bytes(0, &p, &server_exts_len);
+	}
+	// a resumed session has no server_name
+	if (conn->host_ctx && !conn->session_reused) {
+		tls_server_name_ext_to_bytes(NULL, &p, &server_exts_len);
+	}
+	if (hs->record_size_limit) {
+		tls_record_size_limit_ext_to_bytes(hs->record_size_limit, &p, &server_exts_len);
+	}
+	if (hs->max_fragment_length) {
+		tls_max_fragment_length_ext_to_bytes(hs->max_fragment_length, &p, &server_exts_len);
+	}
+
+	// TLCP has no retry to ask for a cookie, a full handshake is admitted before the ServerKeyExchange signature
+	if (!conn->session_reused && tls_handshake_key_op_begin(conn) != 1) {
+		error_puts("too many handshakes in progress");
+		tls_send_alert(conn, TLS_alert_handshake_failure);
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 
 	// send ServerHello
 	tls_trace("send ServerHello\n");
-	tls_random_generate(server_random);
+	tls_random_generate(hs->server_random);
 	if (tls_record_set_handshake_server_hello(record, &recordlen,
-		TLS_protocol_tlcp, server_random, NULL, 0,
-		conn->cipher_suite, NULL, 0) != 1) {
+		TLS_protocol_tlcp, hs->server_random,
+		conn->session_id_len ? conn->session_id : NULL, conn->session_id_len,
+		conn->cipher_suite, server_exts_len ? server_exts : NULL, server_exts_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+
+	if (conn->session_reused) {
+		tls_trace("resume session\n");
+		phase_time = tls_handshake_phase_begin(conn);
+		if (tls_prf(conn->master_secret, 48, "key expansion",
+			hs->server_random, 32, hs->client_random, 32,
+			96, conn->key_block) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
+		sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
+		sm4_set_decrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
+		sm4_set_encrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
+		goto send_change_cipher_spec;
+	}
 
 	// send ServerCertificate
 	tls_trace("send ServerCertificate\n");
-	if (tls_record_set_handshake_certificate(record, &recordlen,
-		conn->server_certs, conn->server_certs_len) != 1) {
+	if (tls_conn_set_handshake_certificate(conn, record, &recordlen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+
+	// send CertificateStatus
+	if (ocsp_resp_len) {
+		tls_trace("send CertificateStatus\n");
+		if (tls_record_set_handshake_certificate_status(record, &recordlen, ocsp_resp, ocsp_resp_len) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tlcp_record_trace(stderr, record, recordlen, 0, 0);
+		if (tls_conn_record_send(conn, record, recordlen) != 1) {
+			error_print();
+			goto end;
+		}
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+	}
 
 	// send ServerKeyExchange
+	hs->state = TLS_state_server_key_exchange;
+server_key_exchange:
 	tls_trace("send ServerKeyExchange\n");
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 1,
 		&server_enc_cert, &server_enc_cert_len) != 1) {
@@ -720,9 +1086,48 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	}
 	p = server_enc_cert_lenbuf; len = 0;
 	tls_uint24_to_bytes((uint24_t)server_enc_cert_len, &p, &len);
-	if (sm2_sign_init(&sign_ctx, &conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
-		|| sm2_sign_update(&sign_ctx, client_random, 32) != 1
-		|| sm2_sign_update(&sign_ctx, server_random, 32) != 1
+	phase_time = tls_handshake_phase_begin(conn);
+	if (conn->key_method) {
+		const TLS_PRIVATE_KEY_METHOD *method = conn->key_method;
+		void *job = hs->async_job;
+
+		if (hs->async_pending) {
+			rv = method->complete(method->arg, job, sigbuf, &siglen);
+		} else {
+			uint8_t z[32];
+			uint8_t dgst[32];
+
+			job = NULL;
+			if (sm2_compute_z(z, &conn->sign_key->public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+				error_print();
+				tls_send_alert(conn, TLS_alert_internal_error);
+				goto end;
+			}
+			sm3_init(&tmp_sm3_ctx);
+			sm3_update(&tmp_sm3_ctx, z, sizeof(z));
+			sm3_update(&tmp_sm3_ctx, hs->client_random, 32);
+			sm3_update(&tmp_sm3_ctx, hs->server_random, 32);
+			sm3_update(&tmp_sm3_ctx, server_enc_cert_lenbuf, 3);
+			sm3_update(&tmp_sm3_ctx, server_enc_cert, server_enc_cert_len);
+			sm3_finish(&tmp_sm3_ctx, dgst);
+			rv = method->sign(method->arg, conn->sign_key, dgst, sigbuf, &siglen, &job);
+		}
+		if ((rv = tlcp_key_method_result(conn, rv, job)) == TLS_ERROR_WANT_ASYNC) {
+			// ServerHello and Certificate go out while the job runs
+			if (tls_flush(conn) == -1) {
+				error_print();
+				goto end;
+			}
+			goto wait;
+		}
+		if (rv != 1 || siglen > sizeof(sigbuf)) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+	} else if (sm2_sign_init(&sign_ctx, conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		|| sm2_sign_update(&sign_ctx, hs->client_random, 32) != 1
+		|| sm2_sign_update(&sign_ctx, hs->server_random, 32) != 1
 		|| sm2_sign_update(&sign_ctx, server_enc_cert_lenbuf, 3) != 1
 		|| sm2_sign_update(&sign_ctx, server_enc_cert, server_enc_cert_len) != 1
 		|| sm2_sign_finish(&sign_ctx, sigbuf, &siglen) != 1) {
@@ -730,113 +1135,179 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+	tls_handshake_key_op_end(conn);
 	if (tlcp_record_set_handshake_server_key_exchange_pke(record, &recordlen, sigbuf, siglen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// send CertificateRequest
 	if (client_verify) {
-		const uint8_t cert_types[] = { TLS_cert_type_ecdsa_sign };
-		uint8_t ca_names[TLS_MAX_CA_NAMES_SIZE] = {0}; // TODO: 根据客户端验证CA证书列计算缓冲大小，或直接输出到record缓冲
-		size_t ca_names_len = 0;
-
 		tls_trace("send CertificateRequest\n");
-		if (tls_authorities_from_certs(ca_names, &ca_names_len, sizeof(ca_names),
-			conn->ca_certs, conn->ca_certs_len) != 1) {
-			error_print();
-			goto end;
-		}
-		if (tls_record_set_handshake_certificate_request(record, &recordlen,
-			cert_types, sizeof(cert_types),
-			ca_names, ca_names_len) != 1) {
+		if (tls_conn_set_handshake_certificate_request(conn, record, &recordlen) != 1) {
 			error_print();
 			goto end;
 		}
 		tlcp_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_send(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 	}
 
 	// send ServerHelloDone
 	tls_trace("send ServerHelloDone\n");
 	tls_record_set_handshake_server_hello_done(record, &recordlen);
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 
 	// recv ClientCertificate
 	if (conn->ca_certs_len) {
+		hs->state = TLS_state_client_certificate;
+client_certificate:
 		tls_trace("recv ClientCertificate\n");
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
-			|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+		if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+			goto wait;
+		}
+		if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
 		tlcp_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_get_handshake_certificate(record, conn->client_certs, &conn->client_certs_len) != 1) {
+		if (tls_conn_certs_reserve(&conn->client_certs, recordlen) != 1
+			|| tls_record_get_handshake_certificate(record, conn->client_certs, &conn->client_certs_len) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, verify_depth, &verify_result) != 1) {
+		phase_time = tls_handshake_phase_begin(conn);
+		if (x509_certs_verify_ex(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
+			conn->ca_certs, conn->ca_certs_len, conn->ca_store, verify_depth, &verify_result) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+		tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 	}
 
 	// ClientKeyExchange
+	hs->state = TLS_state_client_key_exchange;
+client_key_exchange:
 	tls_trace("recv ClientKeyExchange\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
+
+	// the record stays in conn->record while the decryption job runs
+	hs->state = TLS_state_client_key_exchange_decrypt;
+client_key_exchange_decrypt:
+	recordlen = tls_record_length(record);
 	if (tls_record_get_handshake_client_key_exchange_pke(record, &enced_pms, &enced_pms_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	if (sm2_decrypt(&conn->kenc_key, enced_pms, enced_pms_len,
+	// the client has come back, still the decryptions in progress are bounded
+	if (tls_handshake_key_op_begin(conn) != 1) {
+		error_puts("too many handshakes in progress");
+		tls_send_alert(conn, TLS_alert_handshake_failure);
+		goto end;
+	}
+	phase_time = tls_handshake_phase_begin(conn);
+	if (conn->key_method) {
+		const TLS_PRIVATE_KEY_METHOD *method = conn->key_method;
+		void *job = hs->async_job;
+
+		if (hs->async_pending) {
+			rv = method->complete(method->arg, job, pre_master_secret, &pre_master_secret_len);
+		} else {
+			job = NULL;
+			rv = method->decrypt(method->arg, conn->kenc_key, enced_pms, enced_pms_len,
+				pre_master_secret, &pre_master_secret_len, &job);
+		}
+		if ((rv = tlcp_key_method_result(conn, rv, job)) == TLS_ERROR_WANT_ASYNC) {
+			goto wait;
+		}
+		if (rv != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_decrypt_error);
+			goto end;
+		}
+	} else if (sm2_decrypt(conn->kenc_key, enced_pms, enced_pms_len,
 		pre_master_secret, &pre_master_secret_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	tls_handshake_key_op_end(conn);
 	if (pre_master_secret_len != 48) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
-	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
+	sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
+
+	// generate secrets
+	tls_trace("generate secrets\n");
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_prf(pre_master_secret, 48, "master secret",
+			hs->client_random, 32, hs->server_random, 32,
+			48, conn->master_secret) != 1
+		|| tls_prf(conn->master_secret, 48, "key expansion",
+			hs->server_random, 32, hs->client_random, 32,
+			96, conn->key_block) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+	sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
+	sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
+	sm4_set_decrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
+	sm4_set_encrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
+	/*
+	tls_secrets_print(stderr,
+		pre_master_secret, 48,
+		client_random, server_random,
+		conn->master_secret,
+		conn->key_block, 96,
+		0, 4);
+	*/
 
 	// recv CertificateVerify
 	if (client_verify) {
-		tls_trace("recv CertificateVerify\n");
-		SM3_CTX cert_verify_sm3_ctx = sm3_ctx;
+		SM3_CTX cert_verify_sm3_ctx;
 		uint8_t cert_verify_hash[SM3_DIGEST_SIZE];
 
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
-			|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+		hs->state = TLS_state_certificate_verify;
+certificate_verify:
+		tls_trace("recv CertificateVerify\n");
+		if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+			goto wait;
+		}
+		if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			error_print();
 			goto end;
@@ -854,7 +1325,9 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 			goto end;
 		}
 
+		cert_verify_sm3_ctx = hs->sm3_ctx;
 		sm3_finish(&cert_verify_sm3_ctx, cert_verify_hash);
+		phase_time = tls_handshake_phase_begin(conn);
 		if (sm2_verify_init(&verify_ctx, &client_sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
 			|| sm2_verify_update(&verify_ctx, cert_verify_hash, SM3_DIGEST_SIZE) != 1
 			|| sm2_verify_finish(&verify_ctx, sig, siglen) != 1) {
@@ -862,38 +1335,18 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_decrypt_error);
 			goto end;
 		}
-		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
-	}
-
-	// generate secrets
-	tls_trace("generate secrets\n");
-	if (tls_prf(pre_master_secret, 48, "master secret",
-			client_random, 32, server_random, 32,
-			48, conn->master_secret) != 1
-		|| tls_prf(conn->master_secret, 48, "key expansion",
-			server_random, 32, client_random, 32,
-			96, conn->key_block) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_internal_error);
-		goto end;
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+		sm3_update(&hs->sm3_ctx, record + 5, recordlen - 5);
 	}
-	sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
-	sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
-	sm4_set_decrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
-	sm4_set_encrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
-	/*
-	tls_secrets_print(stderr,
-		pre_master_secret, 48,
-		client_random, server_random,
-		conn->master_secret,
-		conn->key_block, 96,
-		0, 4);
-	*/
 
 	// recv [ChangeCipherSpec]
+	hs->state = TLS_state_change_cipher_spec;
+change_cipher_spec:
 	tls_trace("recv [ChangeCipherSpec]\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -906,9 +1359,13 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	}
 
 	// recv ClientFinished
+	hs->state = TLS_state_finished;
+finished:
 	tls_trace("recv Finished\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
-		|| tls_record_protocol(record) != TLS_protocol_tlcp) {
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls_record_protocol(record) != TLS_protocol_tlcp) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -942,21 +1399,28 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	}
 
 	// verify ClientFinished
-	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(SM3_CTX));
-	sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
+	memcpy(&tmp_sm3_ctx, &hs->sm3_ctx, sizeof(SM3_CTX));
+	sm3_update(&hs->sm3_ctx, finished_record + 5, finished_record_len - 5);
 	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "client finished", sm3_hash, 32, NULL, 0,
 		sizeof(local_verify_data), local_verify_data) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (memcmp(verify_data, local_verify_data, sizeof(local_verify_data)) != 0) {
 		error_puts("client_finished.verify_data verification failure");
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
+	if (conn->session_reused) {
+		hs->state = TLS_state_handshake_done;
+		goto handshake_done;
+	}
 
+send_change_cipher_spec:
 	// send [ChangeCipherSpec]
 	tls_trace("send [ChangeCipherSpec]\n");
 	if (tls_record_set_change_cipher_spec(record, &recordlen) != 1) {
@@ -965,14 +1429,17 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		goto end;
 	}
 	tlcp_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
 
 	// send ServerFinished
 	tls_trace("send Finished\n");
-	sm3_finish(&sm3_ctx, sm3_hash);
+	tls_record_set_protocol(finished_record, TLS_protocol_tlcp);
+	memcpy(&tmp_sm3_ctx, &hs->sm3_ctx, sizeof(SM3_CTX));
+	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "server finished", sm3_hash, 32, NULL, 0,
 			sizeof(local_verify_data), local_verify_data) != 1
 		|| tls_record_set_handshake_finished(finished_record, &finished_record_len,
@@ -981,7 +1448,9 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	tlcp_record_trace(stderr, finished_record, finished_record_len, 0, 0);
+	sm3_update(&hs->sm3_ctx, finished_record + 5, finished_record_len - 5);
 	if (tls_record_encrypt(&conn->server_write_mac_ctx, &conn->server_write_enc_key,
 		conn->server_seq_num, finished_record, finished_record_len, record, &recordlen) != 1) {
 		error_print();
@@ -990,10 +1459,26 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 	}
 	tls_encrypted_record_trace(stderr, record, recordlen, 0, 0);
 	tls_seq_num_incr(conn->server_seq_num);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
+	if (conn->session_reused) {
+		// the abbreviated handshake ends with the client Finished
+		hs->state = TLS_state_change_cipher_spec;
+		goto change_cipher_spec;
+	}
+	if (tls_session_save(conn) < 0) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+
+	hs->state = TLS_state_handshake_done;
+handshake_done:
+	if ((rv = tls_flush(conn)) != 1) {
+		goto wait;
+	}
 
 	conn->protocol = TLS_protocol_tlcp;
 
@@ -1001,9 +1486,20 @@ int tlcp_do_accept(TLS_CONNECT *conn)
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
+	goto end;
 
+wait:
+	if (rv == TLS_ERROR_WANT_READ || rv == TLS_ERROR_WANT_WRITE || rv == TLS_ERROR_WANT_ASYNC) {
+		tls_conn_arena_end(conn, &arena_mark, 0);
+		return rv;
+	}
+	error_print();
+	tls_send_alert(conn, TLS_alert_unexpected_message);
 end:
+	tls_handshake_key_op_end(conn);
+	tls_conn_arena_end(conn, &arena_mark, 1);
 	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
 	gmssl_secure_clear(pre_master_secret, sizeof(pre_master_secret));
+	gmssl_secure_clear(hs, sizeof(TLS_HANDSHAKE));
 	return ret;
 }
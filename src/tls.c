@@ -17,13 +17,19 @@
 #include <string.h>
 #include <gmssl/rand.h>
 #include <gmssl/x509.h>
+#include <gmssl/x509_ocsp.h>
 #include <gmssl/error.h>
 #include <gmssl/mem.h>
+#include <gmssl/endian.h>
+#include <gmssl/file.h>
 #include <gmssl/sm2.h>
 #include <gmssl/sm3.h>
 #include <gmssl/sm4.h>
+#include <gmssl/sm4_cbc_sm3_hmac.h>
 #include <gmssl/pem.h>
 #include <gmssl/tls.h>
+#include <gmssl/metrics.h>
+#include <gmssl/thread_pool.h>
 
 
 void tls_uint8_to_bytes(uint8_t a, uint8_t **out, size_t *outlen)
@@ -280,6 +286,7 @@ int tls_cbc_encrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *enc_key,
 		error_print();
 		return -1;
 	}
+	METRICS_ADD(METRICS_tls_sm4_cbc_sm3_encrypt_bytes, inlen);
 	if (inlen > (1 << 14)) {
 		error_print_msg("invalid tls record data length %zu\n", inlen);
 		return -1;
@@ -293,10 +300,22 @@ int tls_cbc_encrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *enc_key,
 	memcpy(last_blocks, in + inlen - rem, rem);
 	mac = last_blocks + rem;
 
+	if (rand_bytes(iv, 16) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(out, iv, 16);
+	out += 16;
+
+	// the full blocks are hashed while they are encrypted, out may equal in
 	memcpy(&hmac_ctx, inited_hmac_ctx, sizeof(SM3_HMAC_CTX));
 	sm3_hmac_update(&hmac_ctx, seq_num, 8);
 	sm3_hmac_update(&hmac_ctx, header, 5);
-	sm3_hmac_update(&hmac_ctx, in, inlen);
+	if (inlen >= 16) {
+		sm4_cbc_encrypt_sm3_update(enc_key, iv, in, inlen/16, out, &hmac_ctx.sm3_ctx);
+		out += inlen - rem;
+	}
+	sm3_hmac_update(&hmac_ctx, last_blocks, rem);
 	sm3_hmac_finish(&hmac_ctx, mac);
 
 	padding = mac + 32;
@@ -305,34 +324,143 @@ int tls_cbc_encrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *enc_key,
 		padding[i] = (uint8_t)padding_len;
 	}
 
-	if (rand_bytes(iv, 16) != 1) {
-		error_print();
-		return -1;
-	}
-	memcpy(out, iv, 16);
-	out += 16;
-
-	if (inlen >= 16) {
-		sm4_cbc_encrypt_blocks(enc_key, iv, in, inlen/16, out);
-		out += inlen - rem;
-	}
 	sm4_cbc_encrypt_blocks(enc_key, iv, last_blocks, sizeof(last_blocks)/16, out);
 	*outlen = 16 + inlen - rem + sizeof(last_blocks);
 	return 1;
 }
 
+/*
+ * Constant-time CBC record check
+ *
+ * The padding length is in the plaintext, so the data length, the MAC offset
+ * and the SM3 padding of the HMAC input are all secret. Every decision below
+ * is a mask, every memory access depends only on the record length, and the
+ * padding and MAC failures are not told apart (Lucky Thirteen).
+ */
+
+// all ones if a < b, else zero
+static uint32_t tls_ct_lt(uint32_t a, uint32_t b)
+{
+	return 0 - ((a ^ ((a ^ b) | ((a - b) ^ b))) >> 31);
+}
+
+// all ones if a == b, else zero
+static uint32_t tls_ct_eq(uint32_t a, uint32_t b)
+{
+	uint32_t x = a ^ b;
+	return 0 - ((~x & (x - 1)) >> 31);
+}
+
+#define TLS_CBC_MAX_PADDING	256 // padding_len and its own byte
+
+/*
+ * Finish the inner hash of the MAC over `rec[hashed .. datalen)`, where
+ * `hashed` bytes are already in `sm3_ctx` and `datalen` is secret but at
+ * most `rec_len - SM3_HMAC_SIZE - 1`. All the candidate final blocks are
+ * compressed, the chaining value after the real one is kept.
+ */
+static void tls_cbc_inner_digest(const SM3_CTX *sm3_ctx, const uint8_t *rec, size_t rec_len,
+	size_t hashed, size_t datalen, uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	uint32_t digest[8];
+	uint32_t result[8] = {0};
+	uint8_t block[SM3_BLOCK_SIZE];
+	uint64_t nbits;
+	size_t num = sm3_ctx->num;
+	size_t max_len = num + rec_len - SM3_HMAC_SIZE - 1 - hashed;
+	uint32_t len = (uint32_t)(num + datalen - hashed);
+	uint32_t final_block = (len + 8) / SM3_BLOCK_SIZE;
+	size_t nblocks = (max_len + 8) / SM3_BLOCK_SIZE + 1;
+	size_t i, j;
+
+	nbits = ((uint64_t)sm3_ctx->nblocks * SM3_BLOCK_SIZE + len) << 3;
+	memcpy(digest, sm3_ctx->digest, sizeof(digest));
+
+	for (i = 0; i < nblocks; i++) {
+		uint32_t is_final = tls_ct_eq((uint32_t)i, final_block);
+
+		for (j = 0; j < SM3_BLOCK_SIZE; j++) {
+			uint32_t pos = (uint32_t)(SM3_BLOCK_SIZE * i + j);
+			uint32_t b = 0;
+
+			if (pos < num) {
+				b = sm3_ctx->block[pos];
+			} else if (hashed + pos - num < rec_len) {
+				b = rec[hashed + pos - num];
+			}
+			b &= tls_ct_lt(pos, len);
+			b |= 0x80 & tls_ct_eq(pos, len);
+			if (j >= SM3_BLOCK_SIZE - 8) {
+				b |= (uint32_t)(nbits >> (8 * (SM3_BLOCK_SIZE - 1 - j))) & is_final;
+			}
+			block[j] = (uint8_t)b;
+		}
+		sm3_compress_blocks(digest, block, 1);
+		for (j = 0; j < 8; j++) {
+			result[j] |= digest[j] & is_final;
+		}
+	}
+	for (j = 0; j < 8; j++) {
+		PUTU32(dgst + 4 * j, result[j]);
+	}
+	gmssl_secure_clear(digest, sizeof(digest));
+	gmssl_secure_clear(block, sizeof(block));
+}
+
+// copy the MAC at secret offset `mac_start` of `rec`, scanning every possible position
+static void tls_cbc_copy_mac(const uint8_t *rec, size_t rec_len, size_t mac_start,
+	uint8_t mac[SM3_HMAC_SIZE])
+{
+	uint8_t rotated[SM3_HMAC_SIZE] = {0};
+	size_t scan_start = 0;
+	uint32_t offset;
+	size_t i, j;
+
+	if (rec_len > SM3_HMAC_SIZE + TLS_CBC_MAX_PADDING) {
+		scan_start = rec_len - SM3_HMAC_SIZE - TLS_CBC_MAX_PADDING;
+	}
+	for (i = scan_start, j = 0; i < rec_len; i++) {
+		uint32_t in_mac = tls_ct_lt((uint32_t)(i - scan_start), (uint32_t)(mac_start - scan_start))
+			^ tls_ct_lt((uint32_t)(i - scan_start), (uint32_t)(mac_start - scan_start + SM3_HMAC_SIZE));
+		rotated[j] |= rec[i] & in_mac;
+		j = (j + 1) % SM3_HMAC_SIZE;
+	}
+
+	offset = (uint32_t)((mac_start - scan_start) % SM3_HMAC_SIZE);
+	for (i = 0; i < SM3_HMAC_SIZE; i++) {
+		uint32_t b = 0;
+		uint32_t k = (uint32_t)((i + offset) % SM3_HMAC_SIZE);
+		for (j = 0; j < SM3_HMAC_SIZE; j++) {
+			b |= rotated[j] & tls_ct_eq((uint32_t)j, k);
+		}
+		mac[i] = (uint8_t)b;
+	}
+}
+
+/*
+ * The record is decrypted with the (vectorized) `sm4_cbc_decrypt_blocks` in
+ * one pass that also hashes the data that is certainly not padding, the last
+ * few SM3 blocks whose content depends on the padding length are finished by
+ * `tls_cbc_inner_digest`.
+ */
 int tls_cbc_decrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *dec_key,
 	const uint8_t seq_num[8], const uint8_t enced_header[5],
 	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
 {
 	SM3_HMAC_CTX hmac_ctx;
 	uint8_t iv[16];
-	const uint8_t *padding;
-	const uint8_t *mac;
+	uint8_t last_iv[16];
+	uint8_t last_block[16];
 	uint8_t header[5];
-	int padding_len;
 	uint8_t hmac[32];
-	int i;
+	uint8_t mac[32];
+	uint32_t padding_len;
+	uint32_t good;
+	uint32_t diff = 0;
+	size_t datalen;
+	size_t min_datalen = 0;
+	size_t hashed = 0;
+	size_t i;
 
 	if (!inited_hmac_ctx || !dec_key || !seq_num || !enced_header || !in || !inlen || !out || !outlen) {
 		error_print();
@@ -344,44 +472,64 @@ int tls_cbc_decrypt(const SM3_HMAC_CTX *inited_hmac_ctx, const SM4_KEY *dec_key,
 		error_print_msg("invalid tls cbc ciphertext length %zu\n", inlen);
 		return -1;
 	}
+	METRICS_ADD(METRICS_tls_sm4_cbc_sm3_decrypt_bytes, inlen);
 
 	memcpy(iv, in, 16);
 	in += 16;
 	inlen -= 16;
 
-	sm4_cbc_decrypt_blocks(dec_key, iv, in, inlen/16, out);
-
-	padding_len = out[inlen - 1];
-	padding = out + inlen - padding_len - 1;
-	if (padding < out + 32) {
-		error_print();
-		return -1;
-	}
-	for (i = 0; i < padding_len; i++) {
-		if (padding[i] != padding_len) {
-			error_puts("tls ciphertext cbc-padding check failure");
-			return -1;
-		}
-	}
-
-	*outlen = inlen - 32 - padding_len - 1;
+	// the last block gives the (secret) data length, a bad padding length is taken as 0
+	memcpy(last_iv, in + inlen - 32, 16);
+	sm4_cbc_decrypt_blocks(dec_key, last_iv, in + inlen - 16, 1, last_block);
+	padding_len = last_block[15];
+	good = ~tls_ct_lt((uint32_t)inlen, padding_len + 1 + 32);
+	padding_len &= good;
+	datalen = inlen - 32 - 1 - padding_len;
 
 	header[0] = enced_header[0];
 	header[1] = enced_header[1];
 	header[2] = enced_header[2];
-	header[3] = (uint8_t)((*outlen) >> 8);
-	header[4] = (uint8_t)(*outlen);
-	mac = padding - 32;
+	header[3] = (uint8_t)(datalen >> 8);
+	header[4] = (uint8_t)(datalen);
+
+	// only whole SM3 blocks of data before any possible padding are hashed in the decrypt pass
+	if (inlen > 32 + TLS_CBC_MAX_PADDING) {
+		min_datalen = inlen - 32 - TLS_CBC_MAX_PADDING;
+	}
+	if (min_datalen + 13 >= SM3_BLOCK_SIZE) {
+		hashed = ((min_datalen + 13) / SM3_BLOCK_SIZE) * SM3_BLOCK_SIZE - 13;
+	}
 
 	memcpy(&hmac_ctx, inited_hmac_ctx, sizeof(SM3_HMAC_CTX));
 	sm3_hmac_update(&hmac_ctx, seq_num, 8);
 	sm3_hmac_update(&hmac_ctx, header, 5);
-	sm3_hmac_update(&hmac_ctx, out, *outlen);
-	sm3_hmac_finish(&hmac_ctx, hmac);
-	if (gmssl_secure_memcmp(mac, hmac, sizeof(hmac)) != 0) {
-		error_puts("tls ciphertext mac check failure\n");
+	sm4_cbc_decrypt_sm3_update(dec_key, iv, in, inlen/16, out, &hmac_ctx.sm3_ctx, hashed);
+
+	for (i = 1; i < TLS_CBC_MAX_PADDING && i < inlen; i++) {
+		uint32_t in_padding = ~tls_ct_lt(padding_len, (uint32_t)i);
+		good &= ~in_padding | tls_ct_eq(out[inlen - 1 - i], padding_len);
+	}
+
+	// outer hash, see `sm3_hmac_finish`
+	tls_cbc_inner_digest(&hmac_ctx.sm3_ctx, out, inlen, hashed, datalen, hmac);
+	memcpy(hmac_ctx.sm3_ctx.digest, hmac_ctx.opad_digest, sizeof(hmac_ctx.opad_digest));
+	hmac_ctx.sm3_ctx.nblocks = 1;
+	hmac_ctx.sm3_ctx.num = 0;
+	sm3_update(&hmac_ctx.sm3_ctx, hmac, sizeof(hmac));
+	sm3_finish(&hmac_ctx.sm3_ctx, hmac);
+
+	tls_cbc_copy_mac(out, inlen, datalen, mac);
+	for (i = 0; i < sizeof(mac); i++) {
+		diff |= mac[i] ^ hmac[i];
+	}
+	good &= tls_ct_eq(diff, 0);
+	gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+
+	if (!good) {
+		error_puts("tls ciphertext cbc-padding or mac check failure");
 		return -1;
 	}
+	*outlen = datalen;
 	return 1;
 }
 
@@ -426,6 +574,57 @@ int tls_record_decrypt(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
 	return 1;
 }
 
+// the IV is written just before the data, so the CBC output overlaps the input exactly
+int tls_record_encrypt_in_place(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
+	const uint8_t seq_num[8], uint8_t *record, size_t datalen, size_t *recordlen)
+{
+	size_t enced_len;
+
+	if (!record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	if (datalen > TLS_MAX_PLAINTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	record[3] = (uint8_t)(datalen >> 8);
+	record[4] = (uint8_t)(datalen);
+
+	if (tls_cbc_encrypt(hmac_ctx, cbc_key, seq_num, record,
+		record + TLS_CBC_HEADROOM, datalen,
+		record + TLS_RECORD_HEADER_SIZE, &enced_len) != 1) {
+		error_print();
+		return -1;
+	}
+	record[3] = (uint8_t)(enced_len >> 8);
+	record[4] = (uint8_t)(enced_len);
+	*recordlen = TLS_RECORD_HEADER_SIZE + enced_len;
+	return 1;
+}
+
+int tls_record_decrypt_in_place(const SM3_HMAC_CTX *hmac_ctx, const SM4_KEY *cbc_key,
+	const uint8_t seq_num[8], uint8_t *record, size_t recordlen,
+	uint8_t **data, size_t *datalen)
+{
+	if (!record || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (recordlen < TLS_RECORD_HEADER_SIZE || tls_record_length(record) != recordlen) {
+		error_print();
+		return -1;
+	}
+	if (tls_cbc_decrypt(hmac_ctx, cbc_key, seq_num, record,
+		record + TLS_RECORD_HEADER_SIZE, recordlen - TLS_RECORD_HEADER_SIZE,
+		record + TLS_CBC_HEADROOM, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	*data = record + TLS_CBC_HEADROOM;
+	return 1;
+}
+
 int tls_random_generate(uint8_t random[32])
 {
 	uint32_t gmt_unix_time = (uint32_t)time(NULL);
@@ -740,7 +939,7 @@ int tls_record_set_handshake_client_hello(uint8_t *record, size_t *recordlen,
 	tls_uint8_to_bytes((uint8_t)TLS_compression_null, &p, &len);
 	if (exts) {
 		size_t tmp_len = len;
-		if (protocol < TLS_protocol_tls12) {
+		if (protocol < TLS_protocol_tls12 && protocol != TLS_protocol_tlcp) {
 			error_print();
 			return -1;
 		}
@@ -878,7 +1077,7 @@ int tls_record_set_handshake_server_hello(uint8_t *record, size_t *recordlen,
 	tls_uint16_to_bytes((uint16_t)cipher_suite, &p, &len);
 	tls_uint8_to_bytes((uint8_t)TLS_compression_null, &p, &len);
 	if (exts) {
-		if (protocol < TLS_protocol_tls12) {
+		if (protocol < TLS_protocol_tls12 && protocol != TLS_protocol_tlcp) {
 			error_print();
 			return -1;
 		}
@@ -1054,54 +1253,34 @@ int tls_record_get_handshake_certificate(const uint8_t *record, uint8_t *certs,
 	return 1;
 }
 
-int tls_record_set_handshake_certificate_request(uint8_t *record, size_t *recordlen,
-	const uint8_t *cert_types, size_t cert_types_len,
-	const uint8_t *ca_names, size_t ca_names_len)
+int tls_record_set_handshake_certificate_status(uint8_t *record, size_t *recordlen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len)
 {
-	int type = TLS_handshake_certificate_request;
+	int type = TLS_handshake_certificate_status;
 	uint8_t *p;
-	size_t len =0;
-	size_t datalen = 0;
+	size_t len = 0;
 
-	if (!record || !recordlen) {
+	if (!record || !recordlen || !ocsp_resp || !ocsp_resp_len) {
 		error_print();
 		return -1;
 	}
-	if (cert_types) {
-		if (cert_types_len == 0 || cert_types_len > TLS_MAX_CERTIFICATE_TYPES) {
-			error_print();
-			return -1;
-		}
-	}
-	if (ca_names) {
-		if (ca_names_len == 0 || ca_names_len > TLS_MAX_CA_NAMES_SIZE) {
-			error_print();
-			return -1;
-		}
-	}
-	tls_uint8array_to_bytes(cert_types, cert_types_len, NULL, &datalen);
-	tls_uint16array_to_bytes(ca_names, ca_names_len, NULL, &datalen);
-	if (datalen > TLS_MAX_HANDSHAKE_DATA_SIZE) {
+	p = tls_handshake_data(tls_record_data(record));
+	if (tls_certificate_status_to_bytes(ocsp_resp, ocsp_resp_len, &p, &len) != 1) {
 		error_print();
 		return -1;
 	}
-	p = tls_handshake_data(tls_record_data(record));
-	tls_uint8array_to_bytes(cert_types, cert_types_len, &p, &len);
-	tls_uint16array_to_bytes(ca_names, ca_names_len, &p, &len);
-	tls_record_set_handshake(record, recordlen, type, NULL, datalen);
+	tls_record_set_handshake(record, recordlen, type, NULL, len);
 	return 1;
 }
 
-int tls_record_get_handshake_certificate_request(const uint8_t *record,
-	const uint8_t **cert_types, size_t *cert_types_len,
-	const uint8_t **ca_names, size_t *ca_names_len)
+int tls_record_get_handshake_certificate_status(const uint8_t *record,
+	const uint8_t **ocsp_resp, size_t *ocsp_resp_len)
 {
 	int type;
 	const uint8_t *cp;
 	size_t len;
-	size_t i;
 
-	if (!record || !cert_types || !cert_types_len || !ca_names || !ca_names_len) {
+	if (!record || !ocsp_resp || !ocsp_resp_len) {
 		error_print();
 		return -1;
 	}
@@ -1109,137 +1288,511 @@ int tls_record_get_handshake_certificate_request(const uint8_t *record,
 		error_print();
 		return -1;
 	}
-	if (type != TLS_handshake_certificate_request) {
+	if (type != TLS_handshake_certificate_status) {
 		error_print();
 		return -1;
 	}
-	if (tls_uint8array_from_bytes(cert_types, cert_types_len, &cp, &len) != 1
-		|| tls_uint16array_from_bytes(ca_names, ca_names_len, &cp, &len) != 1
+	if (tls_certificate_status_from_bytes(ocsp_resp, ocsp_resp_len, &cp, &len) != 1
 		|| tls_length_is_zero(len) != 1) {
 		error_print();
 		return -1;
 	}
+	return 1;
+}
 
-	if (*cert_types == NULL) {
+/*
+The stapled response is checked against the server certificate and its issuer,
+taken from the server chain or the CA certificates. NULL `ocsp_resp` means the
+server sent none.
+*/
+int tls_process_ocsp_response(TLS_CONNECT *conn, const uint8_t *ocsp_resp, size_t ocsp_resp_len, int *alert)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *cacert;
+	size_t cacertlen;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *chain;
+	size_t chainlen;
+	time_t this_update;
+	time_t next_update;
+	int cert_status;
+	int ret;
+
+	conn->ocsp_status = -1;
+	if (!ocsp_resp) {
+		if (conn->ocsp_stapling == TLS_ocsp_stapling_require) {
+			error_puts("no OCSP response stapled");
+			*alert = TLS_alert_bad_certificate_status_response;
+			return -1;
+		}
+		return 1;
+	}
+
+	chain = conn->server_certs;
+	chainlen = conn->server_certs_len;
+	if (x509_cert_from_der(&cert, &certlen, &chain, &chainlen) != 1
+		|| x509_cert_get_issuer(cert, certlen, &issuer, &issuer_len) != 1) {
 		error_print();
+		*alert = TLS_alert_internal_error;
 		return -1;
 	}
-	for (i = 0; i < *cert_types_len; i++) {
-		if (!tls_cert_type_name((*cert_types)[i])) {
-			error_print();
-			return -1;
-		}
+	if ((ret = x509_certs_get_cert_by_subject(chain, chainlen, issuer, issuer_len, &cacert, &cacertlen)) == 0
+		&& conn->ca_certs_len) {
+		ret = x509_certs_get_cert_by_subject(conn->ca_certs, conn->ca_certs_len,
+			issuer, issuer_len, &cacert, &cacertlen);
 	}
-	if (*ca_names) {
-		const uint8_t *names = *ca_names;
-		size_t nameslen = *ca_names_len;
-		while (nameslen) {
-			if (tls_uint16array_from_bytes(&cp, &len, &names, &nameslen) != 1) {
-				error_print();
-				return -1;
-			}
-		}
+	if (ret != 1) {
+		error_print();
+		*alert = TLS_alert_bad_certificate_status_response;
+		return -1;
+	}
+	if (x509_ocsp_response_verify(ocsp_resp, ocsp_resp_len, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, time(NULL),
+		&cert_status, &this_update, &next_update) != 1) {
+		error_print();
+		*alert = TLS_alert_bad_certificate_status_response;
+		return -1;
+	}
+	conn->ocsp_status = cert_status;
+
+	if (cert_status == X509_ocsp_cert_revoked) {
+		error_puts("server certificate revoked");
+		*alert = TLS_alert_certificate_revoked;
+		return -1;
+	}
+	if (cert_status != X509_ocsp_cert_good && conn->ocsp_stapling == TLS_ocsp_stapling_require) {
+		error_puts("server certificate status unknown");
+		*alert = TLS_alert_bad_certificate_status_response;
+		return -1;
 	}
 	return 1;
 }
 
-int tls_record_set_handshake_server_hello_done(uint8_t *record, size_t *recordlen)
+int tls_get_ocsp_status(const TLS_CONNECT *conn)
 {
-	int type = TLS_handshake_server_hello_done;
-	if (!record || !recordlen) {
+	if (!conn) {
 		error_print();
 		return -1;
 	}
-	tls_record_set_handshake(record, recordlen, type, NULL, 0);
-	return 1;
+	return conn->ocsp_status;
 }
 
-int tls_record_get_handshake_server_hello_done(const uint8_t *record)
+int tls_set_server_name(TLS_CONNECT *conn, const char *host)
 {
-	int type;
-	const uint8_t *p;
-	size_t len;
+	size_t hostlen;
 
-	if (!record) {
+	if (!conn || !host) {
 		error_print();
 		return -1;
 	}
-	if (tls_record_get_handshake(record, &type, &p, &len) != 1
-		|| type != TLS_handshake_server_hello_done) {
-		error_print();
+	if (!conn->is_client || conn->protocol == TLS_protocol_tls12) {
+		error_puts("server_name is sent by the TLS 1.3 and TLCP client");
 		return -1;
 	}
-	if (p != NULL || len != 0) {
+	if (!(hostlen = strlen(host)) || hostlen > TLS_MAX_SERVER_NAME_SIZE) {
 		error_print();
 		return -1;
 	}
+	memcpy(conn->server_name, host, hostlen + 1);
 	return 1;
 }
 
-int tls_record_set_handshake_client_key_exchange_pke(uint8_t *record, size_t *recordlen,
-	const uint8_t *enced_pms, size_t enced_pms_len)
+const char *tls_get_server_name(const TLS_CONNECT *conn)
 {
-	int type = TLS_handshake_client_key_exchange;
-	uint8_t *p;
-	size_t len = 0;
-
-	if (!record || !recordlen || !enced_pms || !enced_pms_len) {
-		error_print();
-		return -1;
-	}
-	if (enced_pms_len > TLS_MAX_HANDSHAKE_DATA_SIZE - tls_uint16_size()) {
+	if (!conn) {
 		error_print();
-		return -1;
+		return NULL;
 	}
-	p = tls_handshake_data(tls_record_data(record));
-	tls_uint16array_to_bytes(enced_pms, enced_pms_len, &p, &len);
-	tls_record_set_handshake(record, recordlen, type, NULL, len);
-	return 1;
+	return conn->server_name[0] ? conn->server_name : NULL;
 }
 
-int tls_record_get_handshake_client_key_exchange_pke(const uint8_t *record,
-	const uint8_t **enced_pms, size_t *enced_pms_len)
+int tls_select_server_name(TLS_CONNECT *conn, const uint8_t *exts, size_t extslen, int *alert)
 {
-	int type;
-	const uint8_t *cp;
-	size_t len;
+	TLS_CTX *host_ctx = NULL;
+	int rv;
 
-	if (!record || !enced_pms || !enced_pms_len) {
-		error_print();
-		return -1;
+	*alert = TLS_alert_decode_error;
+	while (extslen) {
+		int ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_ext_from_bytes(&ext_type, &ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (ext_type == TLS_extension_server_name) {
+			if ((rv = tls_process_server_name(ext_data, ext_datalen, conn->server_name)) < 0) {
+				error_print();
+				return -1;
+			}
+			break;
+		}
 	}
-	if (tls_record_get_handshake(record, &type, &cp, &len) != 1) {
-		error_print();
-		return -1;
+	if (!conn->server_name[0] || !conn->server_name_callback) {
+		return 0;
 	}
-	if (type != TLS_handshake_client_key_exchange) {
+
+	if ((rv = conn->server_name_callback(conn->server_name_callback_arg, conn->server_name, &host_ctx)) != 1) {
+		if (rv < 0) {
+			error_puts("server_name not recognized");
+			*alert = TLS_alert_unrecognized_name;
+			return -1;
+		}
+		return 0;
+	}
+	if (!host_ctx) {
 		error_print();
+		*alert = TLS_alert_internal_error;
 		return -1;
 	}
-	if (tls_uint16array_from_bytes(enced_pms, enced_pms_len, &cp, &len) != 1
-		|| tls_length_is_zero(len) != 1) {
-		error_print();
+	if (host_ctx->protocol != conn->protocol || host_ctx->is_client
+		|| !host_ctx->certslen || host_ctx->certslen > TLS_MAX_CERTIFICATES_SIZE) {
+		error_puts("TLS_CTX of the server_name does not fit the connection");
+		tls_ctx_free(host_ctx);
+		*alert = TLS_alert_internal_error;
 		return -1;
 	}
+	conn->host_ctx = host_ctx;
+	conn->server_certs = host_ctx->certs;
+	conn->server_certs_len = host_ctx->certslen;
+	conn->certificate_msg = host_ctx->certificate_msg;
+	conn->certificate_msg_len = host_ctx->certificate_msg_len;
+	conn->sign_key = &host_ctx->signkey;
+	conn->kenc_key = &host_ctx->kenckey;
+	conn->ocsp_stapler = host_ctx->ocsp_stapler;
 	return 1;
 }
 
-int tls_record_set_handshake_certificate_verify(uint8_t *record, size_t *recordlen,
-	const uint8_t *sig, size_t siglen)
+// the record_size_limit of TLS 1.3 counts the content type byte of the inner plaintext
+static size_t tls_record_size_limit_overhead(int protocol)
 {
-	int type = TLS_handshake_certificate_verify;
-	uint8_t *p;
-	size_t len = 0;
+	return protocol == TLS_protocol_tls13 ? 1 : 0;
+}
 
-	if (!record || !recordlen || !sig || !siglen) {
+static size_t tls_max_fragment_length_size(int code)
+{
+	return (size_t)1 << (8 + code);
+}
+
+int tls_record_size_exts_to_bytes(const TLS_CONNECT *conn, uint8_t **out, size_t *outlen)
+{
+	if (!conn || !outlen) {
 		error_print();
 		return -1;
 	}
-	if (siglen > TLS_MAX_SIGNATURE_SIZE) {
-		error_print();
-		return -1;
+	if (conn->record_size_limit) {
+		if (tls_record_size_limit_ext_to_bytes((uint16_t)(conn->record_size_limit
+			+ tls_record_size_limit_overhead(conn->protocol)), out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
 	}
-	p = tls_handshake_data(tls_record_data(record));
+	if (conn->max_fragment_length) {
+		if (tls_max_fragment_length_ext_to_bytes(conn->max_fragment_length, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int tls_select_record_size(TLS_CONNECT *conn, const uint8_t *exts, size_t extslen, int *alert)
+{
+	uint16_t record_size_limit = 0;
+	int max_fragment_length = 0;
+	size_t overhead = tls_record_size_limit_overhead(conn->protocol);
+
+	*alert = TLS_alert_decode_error;
+	while (extslen) {
+		int ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_ext_from_bytes(&ext_type, &ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		switch (ext_type) {
+		case TLS_extension_record_size_limit:
+			if (tls_process_record_size_limit(ext_data, ext_datalen, &record_size_limit) != 1) {
+				error_print();
+				*alert = TLS_alert_illegal_parameter;
+				return -1;
+			}
+			break;
+		case TLS_extension_max_fragment_length:
+			// an unknown value is ignored
+			if (tls_process_max_fragment_length(ext_data, ext_datalen, &max_fragment_length) < 0) {
+				error_print();
+				*alert = TLS_alert_illegal_parameter;
+				return -1;
+			}
+			break;
+		}
+	}
+
+	// max_fragment_length is not used when record_size_limit is offered too
+	if (record_size_limit) {
+		if (record_size_limit - overhead < conn->max_send_fragment) {
+			conn->max_send_fragment = record_size_limit - overhead;
+		}
+		if (conn->record_size_limit) {
+			conn->max_recv_fragment = conn->record_size_limit;
+		}
+		conn->hs.record_size_limit = (uint16_t)(conn->max_recv_fragment + overhead);
+	} else if (max_fragment_length) {
+		conn->max_send_fragment = tls_max_fragment_length_size(max_fragment_length);
+		conn->max_recv_fragment = conn->max_send_fragment;
+		conn->hs.max_fragment_length = max_fragment_length;
+	}
+	return 1;
+}
+
+int tls_process_record_size(TLS_CONNECT *conn, uint16_t record_size_limit, int max_fragment_length)
+{
+	size_t overhead = tls_record_size_limit_overhead(conn->protocol);
+
+	if (record_size_limit) {
+		if (!conn->record_size_limit || record_size_limit < TLS_MIN_RECORD_SIZE_LIMIT) {
+			error_print();
+			return -1;
+		}
+		if (record_size_limit - overhead < conn->max_send_fragment) {
+			conn->max_send_fragment = record_size_limit - overhead;
+		}
+		if (conn->record_size_limit) {
+			conn->max_recv_fragment = conn->record_size_limit;
+		}
+	}
+	if (max_fragment_length) {
+		if (max_fragment_length != conn->max_fragment_length || record_size_limit) {
+			error_print();
+			return -1;
+		}
+		conn->max_send_fragment = tls_max_fragment_length_size(max_fragment_length);
+		conn->max_recv_fragment = conn->max_send_fragment;
+	}
+	return 1;
+}
+
+size_t tls_send_fragment_size(TLS_CONNECT *conn, size_t len)
+{
+	size_t max_len = conn->max_send_fragment;
+
+	if (conn->dynamic_record_sizing) {
+		time_t now = time(NULL);
+
+		// the congestion window of an idle connection is back to a few segments
+		if (now - conn->dynamic_record_time >= TLS_DYNAMIC_RECORD_IDLE_TIMEOUT) {
+			conn->dynamic_record_bytes = 0;
+		}
+		conn->dynamic_record_time = now;
+		if (conn->dynamic_record_bytes < TLS_DYNAMIC_RECORD_RAMP_BYTES
+			&& max_len > TLS_DYNAMIC_RECORD_SMALL_SIZE) {
+			max_len = TLS_DYNAMIC_RECORD_SMALL_SIZE;
+		}
+	}
+	if (len > max_len) {
+		len = max_len;
+	}
+	conn->dynamic_record_bytes += len;
+	return len;
+}
+
+size_t tls_get_max_send_fragment(const TLS_CONNECT *conn)
+{
+	return conn->max_send_fragment;
+}
+
+int tls_record_set_handshake_certificate_request(uint8_t *record, size_t *recordlen,
+	const uint8_t *cert_types, size_t cert_types_len,
+	const uint8_t *ca_names, size_t ca_names_len)
+{
+	int type = TLS_handshake_certificate_request;
+	uint8_t *p;
+	size_t len =0;
+	size_t datalen = 0;
+
+	if (!record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	if (cert_types) {
+		if (cert_types_len == 0 || cert_types_len > TLS_MAX_CERTIFICATE_TYPES) {
+			error_print();
+			return -1;
+		}
+	}
+	if (ca_names) {
+		if (ca_names_len == 0 || ca_names_len > TLS_MAX_CA_NAMES_SIZE) {
+			error_print();
+			return -1;
+		}
+	}
+	tls_uint8array_to_bytes(cert_types, cert_types_len, NULL, &datalen);
+	tls_uint16array_to_bytes(ca_names, ca_names_len, NULL, &datalen);
+	if (datalen > TLS_MAX_HANDSHAKE_DATA_SIZE) {
+		error_print();
+		return -1;
+	}
+	p = tls_handshake_data(tls_record_data(record));
+	tls_uint8array_to_bytes(cert_types, cert_types_len, &p, &len);
+	tls_uint16array_to_bytes(ca_names, ca_names_len, &p, &len);
+	tls_record_set_handshake(record, recordlen, type, NULL, datalen);
+	return 1;
+}
+
+int tls_record_get_handshake_certificate_request(const uint8_t *record,
+	const uint8_t **cert_types, size_t *cert_types_len,
+	const uint8_t **ca_names, size_t *ca_names_len)
+{
+	int type;
+	const uint8_t *cp;
+	size_t len;
+	size_t i;
+
+	if (!record || !cert_types || !cert_types_len || !ca_names || !ca_names_len) {
+		error_print();
+		return -1;
+	}
+	if (tls_record_get_handshake(record, &type, &cp, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (type != TLS_handshake_certificate_request) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint8array_from_bytes(cert_types, cert_types_len, &cp, &len) != 1
+		|| tls_uint16array_from_bytes(ca_names, ca_names_len, &cp, &len) != 1
+		|| tls_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (*cert_types == NULL) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < *cert_types_len; i++) {
+		if (!tls_cert_type_name((*cert_types)[i])) {
+			error_print();
+			return -1;
+		}
+	}
+	if (*ca_names) {
+		const uint8_t *names = *ca_names;
+		size_t nameslen = *ca_names_len;
+		while (nameslen) {
+			if (tls_uint16array_from_bytes(&cp, &len, &names, &nameslen) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+	return 1;
+}
+
+int tls_record_set_handshake_server_hello_done(uint8_t *record, size_t *recordlen)
+{
+	int type = TLS_handshake_server_hello_done;
+	if (!record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	tls_record_set_handshake(record, recordlen, type, NULL, 0);
+	return 1;
+}
+
+int tls_record_get_handshake_server_hello_done(const uint8_t *record)
+{
+	int type;
+	const uint8_t *p;
+	size_t len;
+
+	if (!record) {
+		error_print();
+		return -1;
+	}
+	if (tls_record_get_handshake(record, &type, &p, &len) != 1
+		|| type != TLS_handshake_server_hello_done) {
+		error_print();
+		return -1;
+	}
+	if (p != NULL || len != 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_record_set_handshake_client_key_exchange_pke(uint8_t *record, size_t *recordlen,
+	const uint8_t *enced_pms, size_t enced_pms_len)
+{
+	int type = TLS_handshake_client_key_exchange;
+	uint8_t *p;
+	size_t len = 0;
+
+	if (!record || !recordlen || !enced_pms || !enced_pms_len) {
+		error_print();
+		return -1;
+	}
+	if (enced_pms_len > TLS_MAX_HANDSHAKE_DATA_SIZE - tls_uint16_size()) {
+		error_print();
+		return -1;
+	}
+	p = tls_handshake_data(tls_record_data(record));
+	tls_uint16array_to_bytes(enced_pms, enced_pms_len, &p, &len);
+	tls_record_set_handshake(record, recordlen, type, NULL, len);
+	return 1;
+}
+
+int tls_record_get_handshake_client_key_exchange_pke(const uint8_t *record,
+	const uint8_t **enced_pms, size_t *enced_pms_len)
+{
+	int type;
+	const uint8_t *cp;
+	size_t len;
+
+	if (!record || !enced_pms || !enced_pms_len) {
+		error_print();
+		return -1;
+	}
+	if (tls_record_get_handshake(record, &type, &cp, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (type != TLS_handshake_client_key_exchange) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16array_from_bytes(enced_pms, enced_pms_len, &cp, &len) != 1
+		|| tls_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_record_set_handshake_certificate_verify(uint8_t *record, size_t *recordlen,
+	const uint8_t *sig, size_t siglen)
+{
+	int type = TLS_handshake_certificate_verify;
+	uint8_t *p;
+	size_t len = 0;
+
+	if (!record || !recordlen || !sig || !siglen) {
+		error_print();
+		return -1;
+	}
+	if (siglen > TLS_MAX_SIGNATURE_SIZE) {
+		error_print();
+		return -1;
+	}
+	p = tls_handshake_data(tls_record_data(record));
 	tls_uint16array_to_bytes(sig, siglen, &p, &len);
 	tls_record_set_handshake(record, recordlen, type, NULL, len);
 	return 1;
@@ -1453,25 +2006,111 @@ int tls_cipher_suite_in_list(int cipher, const int *list, size_t list_count)
 	return 0;
 }
 
-int tls_record_send(const uint8_t *record, size_t recordlen, tls_socket_t sock)
+// the socket is passed by value in `arg`
+static tls_ret_t socket_transport_send(void *arg, const uint8_t *buf, size_t len)
 {
-	tls_ret_t n;
+	return tls_socket_send((tls_socket_t)(intptr_t)arg, buf, len, 0);
+}
 
-	if (!record) {
-		error_print();
-		return -1;
-	}
-	if (recordlen < TLS_RECORD_HEADER_SIZE) {
+static tls_ret_t socket_transport_recv(void *arg, uint8_t *buf, size_t len)
+{
+	return tls_socket_recv((tls_socket_t)(intptr_t)arg, buf, len, 0);
+}
+
+int tls_transport_init_socket(TLS_TRANSPORT *transport, tls_socket_t sock)
+{
+	if (!transport) {
 		error_print();
 		return -1;
 	}
-	if (tls_record_length(record) != recordlen) {
+	transport->send = socket_transport_send;
+	transport->recv = socket_transport_recv;
+	transport->arg = (void *)(intptr_t)sock;
+	return 1;
+}
+
+int tls_transport_is_socket(const TLS_TRANSPORT *transport)
+{
+	return transport && transport->send == socket_transport_send;
+}
+
+tls_ret_t tls_conn_transport_send(TLS_CONNECT *conn, const uint8_t *buf, size_t len)
+{
+	if (!conn->transport.send) {
+		error_print();
+		return -1;
+	}
+	return conn->transport.send(conn->transport.arg, buf, len);
+}
+
+tls_ret_t tls_conn_transport_recv(TLS_CONNECT *conn, uint8_t *buf, size_t len)
+{
+	if (!conn->transport.recv) {
+		error_print();
+		return -1;
+	}
+	return conn->transport.recv(conn->transport.arg, buf, len);
+}
+
+// with read-ahead one recv() fills readbuf, the records are then copied out of it
+static tls_ret_t tls_conn_read(TLS_CONNECT *conn, uint8_t *buf, size_t len)
+{
+	tls_ret_t n;
+
+	if (!conn->read_ahead) {
+		return tls_conn_transport_recv(conn, buf, len);
+	}
+	if (conn->readbuf_offset == conn->readbuf_len) {
+		if (!conn->readbuf && !(conn->readbuf = tls_buffer_get())) {
+			error_print();
+			errno = ENOMEM;
+			return -1;
+		}
+		if ((n = tls_conn_transport_recv(conn, conn->readbuf,
+			conn->readbuf_size ? conn->readbuf_size : TLS_MAX_RECORD_SIZE)) <= 0) {
+			return n;
+		}
+		conn->readbuf_len = (size_t)n;
+		conn->readbuf_offset = 0;
+	}
+	if (len > conn->readbuf_len - conn->readbuf_offset) {
+		len = conn->readbuf_len - conn->readbuf_offset;
+	}
+	memcpy(buf, conn->readbuf + conn->readbuf_offset, len);
+	conn->readbuf_offset += len;
+	return (tls_ret_t)len;
+}
+
+// blocking record I/O on the socket `sock`, or on the transport of `conn` if given
+static tls_ret_t record_io_send(TLS_CONNECT *conn, tls_socket_t sock, const uint8_t *buf, size_t len)
+{
+	return conn ? tls_conn_transport_send(conn, buf, len) : tls_socket_send(sock, buf, len, 0);
+}
+
+static tls_ret_t record_io_recv(TLS_CONNECT *conn, tls_socket_t sock, uint8_t *buf, size_t len)
+{
+	return conn ? tls_conn_read(conn, buf, len) : tls_socket_recv(sock, buf, len, 0);
+}
+
+static int record_send(TLS_CONNECT *conn, tls_socket_t sock, const uint8_t *record, size_t recordlen)
+{
+	tls_ret_t n;
+
+	if (!record) {
+		error_print();
+		return -1;
+	}
+	if (recordlen < TLS_RECORD_HEADER_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (tls_record_length(record) != recordlen) {
 		error_print();
 		return -1;
 	}
 
 	while (recordlen) {
-		if ((n = tls_socket_send(sock, record, recordlen, 0)) > 0) {
+		if ((n = record_io_send(conn, sock, record, recordlen)) > 0) {
 			record += n;
 			recordlen -= n;
 
@@ -1494,7 +2133,7 @@ int tls_record_send(const uint8_t *record, size_t recordlen, tls_socket_t sock)
 	return 1;
 }
 
-int tls_record_recv(uint8_t *record, size_t *recordlen, tls_socket_t sock)
+static int record_recv(TLS_CONNECT *conn, tls_socket_t sock, uint8_t *record, size_t *recordlen)
 {
 	uint8_t *p = record;
 	size_t len;
@@ -1502,7 +2141,7 @@ int tls_record_recv(uint8_t *record, size_t *recordlen, tls_socket_t sock)
 
 	len = 5;
 	while (len) {
-		if ((n = tls_socket_recv(sock, p, len, 0)) > 0) {
+		if ((n = record_io_recv(conn, sock, p, len)) > 0) {
 			p += n;
 			len -= n;
 		} else if (n == 0) {
@@ -1540,7 +2179,7 @@ int tls_record_recv(uint8_t *record, size_t *recordlen, tls_socket_t sock)
 	}
 
 	while (len) {
-		if ((n = tls_socket_recv(sock, p, len, 0)) > 0) {
+		if ((n = record_io_recv(conn, sock, p, len)) > 0) {
 			p += n;
 			len -= n;
 		} else if (n == 0) {
@@ -1561,15 +2200,241 @@ int tls_record_recv(uint8_t *record, size_t *recordlen, tls_socket_t sock)
 	return 1;
 }
 
+int tls_record_send(const uint8_t *record, size_t recordlen, tls_socket_t sock)
+{
+	return record_send(NULL, sock, record, recordlen);
+}
+
+int tls_record_recv(uint8_t *record, size_t *recordlen, tls_socket_t sock)
+{
+	return record_recv(NULL, sock, record, recordlen);
+}
+
+// blocking, waits until the queued records are sent
+int tls_conn_record_flush(TLS_CONNECT *conn)
+{
+	int ret;
+
+	while ((ret = tls_flush(conn)) == TLS_ERROR_WANT_WRITE) {
+		tls_socket_wait();
+	}
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// the records of a flight are queued and sent with one send() before the response is read
+int tls_conn_record_write(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen)
+{
+	if (conn->sendbuf_len && recordlen > TLS_MAX_RECORD_SIZE - (conn->sendbuf_len - conn->sendbuf_offset)) {
+		if (tls_conn_record_flush(conn) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_conn_record_read(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen)
+{
+	if (tls_conn_record_flush(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	return record_recv(conn, conn->sock, record, recordlen);
+}
+
+int tls_flush(TLS_CONNECT *conn)
+{
+	tls_ret_t n;
+
+	while (conn->sendbuf_offset < conn->sendbuf_len) {
+		if ((n = tls_conn_transport_send(conn, conn->sendbuf + conn->sendbuf_offset,
+			conn->sendbuf_len - conn->sendbuf_offset)) > 0) {
+			conn->sendbuf_offset += n;
+		} else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			return TLS_ERROR_WANT_WRITE;
+		} else {
+			error_print();
+			return -1;
+		}
+	}
+	conn->sendbuf_len = 0;
+	conn->sendbuf_offset = 0;
+	return 1;
+}
+
+int tls_conn_record_send(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen)
+{
+	uint8_t *p;
+
+	if (!conn || !record) {
+		error_print();
+		return -1;
+	}
+	if (recordlen < TLS_RECORD_HEADER_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (tls_record_length(record) != recordlen) {
+		error_print();
+		return -1;
+	}
+	if (conn->quic) {
+		return tls_quic_record_send(conn->quic, record, recordlen);
+	}
+
+	if (!(p = tls_conn_record_reserve(conn, recordlen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, record, recordlen);
+	conn->sendbuf_len += recordlen;
+	return 1;
+}
+
+// free space of at least `len` bytes at the end of sendbuf, add the bytes written to sendbuf_len
+uint8_t *tls_conn_record_reserve(TLS_CONNECT *conn, size_t len)
+{
+	if (!conn->sendbuf && !(conn->sendbuf = tls_buffer_get())) {
+		error_print();
+		return NULL;
+	}
+	if (conn->sendbuf_offset) {
+		conn->sendbuf_len -= conn->sendbuf_offset;
+		memmove(conn->sendbuf, conn->sendbuf + conn->sendbuf_offset, conn->sendbuf_len);
+		conn->sendbuf_offset = 0;
+	}
+	// a handshake flight always fits
+	if (len > TLS_MAX_RECORD_SIZE - conn->sendbuf_len) {
+		error_print();
+		return NULL;
+	}
+	return conn->sendbuf + conn->sendbuf_len;
+}
+
+// send from `record` when nothing is queued, only the unsent tail is copied into sendbuf
+int tls_conn_record_send_direct(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen)
+{
+	uint8_t *p;
+	tls_ret_t n;
+
+	if (!conn || !record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	if (conn->sendbuf_len) {
+		if (tls_conn_record_send(conn, record, recordlen) != 1) {
+			error_print();
+			return -1;
+		}
+		return tls_flush(conn);
+	}
+
+	while (recordlen) {
+		if ((n = tls_conn_transport_send(conn, record, recordlen)) > 0) {
+			record += n;
+			recordlen -= n;
+		} else if (n < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			break;
+		} else {
+			error_print();
+			return -1;
+		}
+	}
+	if (!recordlen) {
+		return 1;
+	}
+
+	if (!(p = tls_conn_record_reserve(conn, recordlen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, record, recordlen);
+	conn->sendbuf_len = recordlen;
+	return TLS_ERROR_WANT_WRITE;
+}
+
+// the partial record is kept in `record`, pass the same buffer until it returns 1
+int tls_conn_record_recv(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen)
+{
+	size_t len;
+	tls_ret_t n;
+
+	if (!conn || !record || !recordlen) {
+		error_print();
+		return -1;
+	}
+
+	for (;;) {
+		len = TLS_RECORD_HEADER_SIZE;
+		if (conn->recv_offset >= TLS_RECORD_HEADER_SIZE) {
+			if (!tls_record_type_name(tls_record_type(record))
+				|| !tls_protocol_name(tls_record_protocol(record))) {
+				conn->recv_offset = 0;
+				error_print();
+				return -1;
+			}
+			len = tls_record_length(record);
+			if (len > TLS_MAX_RECORD_SIZE) {
+				conn->recv_offset = 0;
+				error_print();
+				return -1;
+			}
+			if (conn->recv_offset == len) {
+				break;
+			}
+		}
+
+		if ((n = tls_conn_read(conn, record + conn->recv_offset, len - conn->recv_offset)) > 0) {
+			conn->recv_offset += n;
+		} else if (n == 0) {
+			tls_trace("TCP connection closed");
+			conn->recv_offset = 0;
+			*recordlen = 0;
+			return 0;
+		} else if (errno == EAGAIN || errno == EWOULDBLOCK) {
+			return TLS_ERROR_WANT_READ;
+		} else {
+			perror("recv");
+			conn->recv_offset = 0;
+			error_print();
+			return -1;
+		}
+	}
+
+	conn->recv_offset = 0;
+	*recordlen = len;
+	return 1;
+}
+
+// the queued flight is sent before its response is read
+int tls_handshake_recv(TLS_CONNECT *conn, uint8_t *record, size_t *recordlen)
+{
+	int ret;
+
+	if ((ret = tls_flush(conn)) != 1) {
+		return ret;
+	}
+	return tls_conn_record_recv(conn, record, recordlen);
+}
+
 int tls_seq_num_incr(uint8_t seq_num[8])
 {
 	int i;
-	for (i = 7; i > 0; i--) {
+	for (i = 7; i >= 0; i--) {
 		seq_num[i]++;
-		if (seq_num[i]) break;
+		if (seq_num[i]) return 1;
 	}
-	// FIXME: check overflow
-	return 1;
+	// wrapped, a TLS 1.3 connection updates its keys long before
+	error_print();
+	return -1;
 }
 
 int tls_compression_methods_has_null_compression(const uint8_t *meths, size_t methslen)
@@ -1600,7 +2465,9 @@ int tls_send_alert(TLS_CONNECT *conn, int alert)
 	tls_record_set_protocol(record, conn->protocol == TLS_protocol_tls13 ? TLS_protocol_tls12 : conn->protocol);
 	tls_record_set_alert(record, &recordlen, TLS_alert_level_fatal, alert);
 
-	if (tls_record_send(record, sizeof(record), conn->sock) != 1) {
+	// best effort, on a non-blocking socket the alert might stay queued
+	if (tls_conn_record_send(conn, record, sizeof(record)) != 1
+		|| tls_flush(conn) < 0) {
 		error_print();
 		return -1;
 	}
@@ -1625,6 +2492,7 @@ int tls_alert_level(int alert)
 	case TLS_alert_insufficient_security:
 	case TLS_alert_internal_error:
 	case TLS_alert_unsupported_extension:
+	case TLS_alert_bad_certificate_status_response:
 		return TLS_alert_level_fatal;
 	case TLS_alert_user_canceled:
 	case TLS_alert_no_renegotiation:
@@ -1649,7 +2517,9 @@ int tls_send_warning(TLS_CONNECT *conn, int alert)
 	tls_record_set_protocol(record, conn->protocol == TLS_protocol_tls13 ? TLS_protocol_tls12 : conn->protocol);
 	tls_record_set_alert(record, &recordlen, TLS_alert_level_warning, alert);
 
-	if (tls_record_send(record, sizeof(record), conn->sock) != 1) {
+	// best effort, on a non-blocking socket the alert might stay queued
+	if (tls_conn_record_send(conn, record, sizeof(record)) != 1
+		|| tls_flush(conn) < 0) {
 		error_print();
 		return -1;
 	}
@@ -1657,11 +2527,14 @@ int tls_send_warning(TLS_CONNECT *conn, int alert)
 	return 1;
 }
 
+// the plaintext is copied once, into sendbuf, and encrypted there
 static int tls_encrypt_send(TLS_CONNECT *conn, int record_type, const uint8_t *in, size_t inlen, size_t *sentlen)
 {
+	int ret;
 	const SM3_HMAC_CTX *hmac_ctx;
 	const SM4_KEY *enc_key;
 	uint8_t *seq_num;
+	uint8_t *record;
 	size_t recordlen;
 
 	if (!conn) {
@@ -1673,14 +2546,7 @@ static int tls_encrypt_send(TLS_CONNECT *conn, int record_type, const uint8_t *i
 		return -1;
 	}
 
-	if (inlen > TLS_MAX_PLAINTEXT_SIZE) {
-		inlen = TLS_MAX_PLAINTEXT_SIZE;
-	}
-
-	if (conn->datalen) {
-		error_puts("recv all buffered data before send");
-		return -1;
-	}
+	inlen = tls_send_fragment_size(conn, inlen);
 
 	if (conn->is_client) {
 		hmac_ctx = &conn->client_write_mac_ctx;
@@ -1692,29 +2558,32 @@ static int tls_encrypt_send(TLS_CONNECT *conn, int record_type, const uint8_t *i
 		seq_num = conn->server_seq_num;
 	}
 
-	if (tls_record_set_type(conn->databuf, record_type) != 1
-		|| tls_record_set_protocol(conn->databuf, conn->protocol) != 1
-		|| tls_record_set_data(conn->databuf, in, inlen) != 1) {
+	if (!(record = tls_conn_record_reserve(conn, TLS_CBC_HEADROOM + inlen + TLS_CBC_TAILROOM))) {
 		error_print();
 		return -1;
 	}
-	tls_record_trace(stderr, conn->databuf, tls_record_length(conn->databuf), 0, 0);
-
-	if (tls_record_encrypt(hmac_ctx, enc_key, seq_num,
-		conn->databuf, tls_record_length(conn->databuf),
-		conn->record, &recordlen) != 1) {
+	if (tls_record_set_type(record, record_type) != 1
+		|| tls_record_set_protocol(record, conn->protocol) != 1) {
 		error_print();
 		return -1;
 	}
-	tls_seq_num_incr(seq_num);
+	memcpy(record + TLS_CBC_HEADROOM, in, inlen);
 
-	if (tls_record_send(conn->record, recordlen, conn->sock) != 1) {
+	if (tls_record_encrypt_in_place(hmac_ctx, enc_key, seq_num,
+		record, inlen, &recordlen) != 1) {
 		error_print();
 		return -1;
 	}
-	tls_encrypted_record_trace(stderr, conn->record, recordlen, 0, 0);
+	tls_seq_num_incr(seq_num);
+	conn->sendbuf_len += recordlen;
+	tls_encrypted_record_trace(stderr, record, recordlen, 0, 0);
 
+	// the record is queued even if TLS_ERROR_WANT_WRITE is returned
 	*sentlen = inlen;
+	if ((ret = tls_flush(conn)) != 1) {
+		if (ret != TLS_ERROR_WANT_WRITE) error_print();
+		return ret;
+	}
 	return 1;
 }
 
@@ -1739,8 +2608,8 @@ int tls_decrypt_recv(TLS_CONNECT *conn)
 	}
 
 	tls_trace("recv Encrypted Record\n");
-	if ((ret = tls_record_recv(record, &recordlen, conn->sock)) != 1) {
-		if (ret < 0 && ret != -EAGAIN) error_print();
+	if ((ret = tls_conn_record_recv(conn, record, &recordlen)) != 1) {
+		if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
 		return ret;
 	}
 	tls_encrypted_record_trace(stderr, record, recordlen, 0, 0);
@@ -1755,29 +2624,50 @@ int tls_decrypt_recv(TLS_CONNECT *conn)
 
 	conn->data = tls_record_data(conn->databuf);
 	conn->datalen = tls_record_data_length(conn->databuf);
+	if (tls_record_type(conn->databuf) == TLS_record_application_data
+		&& conn->datalen > conn->max_recv_fragment) {
+		error_puts("record larger than the negotiated limit");
+		tls_send_alert(conn, TLS_alert_record_overflow);
+		conn->datalen = 0;
+		return -1;
+	}
 
 	tls_record_trace(stderr, conn->databuf, tls_record_length(conn->databuf), 0, 0);
 
 	return 1;
 }
 
-int tls_send(TLS_CONNECT *conn, const uint8_t *in, size_t inlen, size_t *sentlen)
+static int tls_conn_send(TLS_CONNECT *conn, const uint8_t *in, size_t inlen, size_t *sentlen)
 {
+	int ret;
+
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the record was queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		return 1;
+	}
+
 	tls_trace("send ApplicationData\n");
-	return tls_encrypt_send(conn, TLS_record_application_data, in, inlen, sentlen);
+	if ((ret = tls_encrypt_send(conn, TLS_record_application_data, in, inlen, sentlen)) != 1) {
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = *sentlen;
+		}
+		return ret;
+	}
+	return 1;
 }
 
-int tls_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+static int tls_conn_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
 {
-	if (!conn || !out || !outlen || !recvlen) {
-		error_print();
-		return -1;
-	}
-
 	if (conn->datalen == 0) {
 		int ret;
 		if ((ret = tls_decrypt_recv(conn)) != 1) {
-			if (ret < 0 && ret != -EAGAIN) error_print();
+			if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
 			return ret;
 		}
 
@@ -1814,7 +2704,7 @@ int tls_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
 	return 1;
 }
 
-int tls_shutdown(TLS_CONNECT *conn)
+static int tls_conn_shutdown(TLS_CONNECT *conn)
 {
 	int ret;
 	size_t recordlen;
@@ -1822,23 +2712,18 @@ int tls_shutdown(TLS_CONNECT *conn)
 	alert[0] = TLS_alert_level_fatal;
 	alert[1] = TLS_alert_close_notify;
 
-	if (!conn) {
-		error_print();
-		return -1;
-	}
-
 	tls_trace("send Alert.close_notify\n");
 
-	if (tls_encrypt_send(conn, TLS_record_alert, alert, sizeof(alert), &recordlen) != 1) {
-		error_print();
-		return -1;
+	if ((ret = tls_encrypt_send(conn, TLS_record_alert, alert, sizeof(alert), &recordlen)) != 1) {
+		if (ret != TLS_ERROR_WANT_WRITE) error_print();
+		return ret;
 	}
 
 	tls_trace("recv Alert.close_notify\n");
 
 	if ((ret = tls_decrypt_recv(conn)) != 1) {
 		if (ret == 0) tls_trace("Connection closed by remote without close_notify\n");
-		else if (ret == -EAGAIN) tls_trace("-EAGAIN\n");
+		else if (ret == TLS_ERROR_WANT_READ) tls_trace("TLS_ERROR_WANT_READ\n");
 		else error_print();
 		return -1;
 	}
@@ -1846,517 +2731,2026 @@ int tls_shutdown(TLS_CONNECT *conn)
 	return 1;
 }
 
-int tls_authorities_from_certs(uint8_t *names, size_t *nameslen, size_t maxlen, const uint8_t *certs, size_t certslen)
+int tls_send(TLS_CONNECT *conn, const uint8_t *in, size_t inlen, size_t *sentlen)
 {
-	const uint8_t *cert;
-	size_t certlen;
-	const uint8_t *name;
-	size_t namelen;
+	int ret;
 
-	*nameslen = 0;
-	while (certslen) {
-		size_t alen = 0;
-		if (x509_cert_from_der(&cert, &certlen, &certs, &certslen) != 1
-			|| x509_cert_get_subject(cert, certlen, &name, &namelen) != 1
-			|| asn1_sequence_to_der(name, namelen, NULL, &alen) != 1) {
-			error_print();
-			return -1;
-		}
-		if (tls_uint16_size() + alen > maxlen) {
-			error_print();
-			return -1;
-		}
-		if (alen > UINT16_MAX) {
-			error_print();
+	if (!conn || !sentlen) {
+		error_print();
+		return -1;
+	}
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls_conn_send(conn, in, inlen, sentlen);
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
+int tls_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+{
+	int ret;
+
+	if (!conn || !out || !outlen || !recvlen) {
+		error_print();
+		return -1;
+	}
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls_conn_recv(conn, out, outlen, recvlen);
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
+size_t tls_pending(const TLS_CONNECT *conn)
+{
+	if (!conn) {
+		return 0;
+	}
+	return conn->datalen + (conn->readbuf_len - conn->readbuf_offset);
+}
+
+// the next application data is returned without reading from the transport
+static int tls_conn_data_ready(const TLS_CONNECT *conn)
+{
+	const uint8_t *record;
+	size_t len;
+
+	if (conn->datalen) {
+		return 1;
+	}
+	len = conn->readbuf_len - conn->readbuf_offset;
+	if (conn->recv_offset || len < TLS_RECORD_HEADER_SIZE) {
+		return 0;
+	}
+	// a TLS 1.3 alert or post-handshake message is hidden in application_data
+	record = conn->readbuf + conn->readbuf_offset;
+	return tls_record_type(record) == TLS_record_application_data
+		&& tls_record_length(record) <= len;
+}
+
+int tls_recv_batch(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+{
+	size_t len;
+	int ret;
+
+	if (!conn || !out || !outlen || !recvlen) {
+		error_print();
+		return -1;
+	}
+
+	*recvlen = 0;
+	do {
+		if (conn->protocol == TLS_protocol_tls13) {
+			ret = tls13_recv(conn, out, outlen, &len);
+		} else {
+			ret = tls_recv(conn, out, outlen, &len);
+		}
+		if (ret != 1) {
+			if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
+			return ret;
+		}
+		out += len;
+		outlen -= len;
+		*recvlen += len;
+	} while (outlen && tls_conn_data_ready(conn));
+
+	return 1;
+}
+
+typedef struct {
+	const TLS_CONNECT *conn;
+	const uint8_t *record;
+	size_t recordlen;
+	uint8_t seq_num[8];
+	uint8_t *out;
+	size_t outlen;
+	int record_type;
+	int ret;
+} TLS_RECV_PIPELINE_ITEM;
+
+// one record, the keys of the connection are only read
+static void tls_recv_pipeline_task(void *arg)
+{
+	TLS_RECV_PIPELINE_ITEM *item = (TLS_RECV_PIPELINE_ITEM *)arg;
+	const TLS_CONNECT *conn = item->conn;
+
+	if (conn->protocol == TLS_protocol_tls13) {
+		item->ret = tls13_gcm_decrypt(conn->is_client ? &conn->server_write_key : &conn->client_write_key,
+			conn->is_client ? conn->server_write_iv : conn->client_write_iv, item->seq_num,
+			item->record + TLS_RECORD_HEADER_SIZE, item->recordlen - TLS_RECORD_HEADER_SIZE,
+			&item->record_type, item->out, &item->outlen);
+	} else {
+		item->record_type = tls_record_type(item->record);
+		item->ret = tls_cbc_decrypt(conn->is_client ? &conn->server_write_mac_ctx : &conn->client_write_mac_ctx,
+			conn->is_client ? &conn->server_write_enc_key : &conn->client_write_enc_key, item->seq_num,
+			item->record, item->record + TLS_RECORD_HEADER_SIZE, item->recordlen - TLS_RECORD_HEADER_SIZE,
+			item->out, &item->outlen);
+	}
+}
+
+// move the unread bytes to the front of the pipeline buffer and recv() into the rest of it once
+static tls_ret_t tls_recv_pipeline_fill(TLS_CONNECT *conn)
+{
+	size_t size = TLS_RECV_PIPELINE_RECORDS * TLS_MAX_RECORD_SIZE;
+	size_t len = conn->readbuf_len - conn->readbuf_offset;
+	tls_ret_t n;
+
+	if (conn->readbuf_size != size) {
+		uint8_t *buf;
+
+		if (!(buf = (uint8_t *)malloc(size))) {
+			error_print();
+			errno = ENOMEM;
 			return -1;
 		}
-		tls_uint16_to_bytes((uint16_t)alen, &names, nameslen);
-		if (asn1_sequence_to_der(name, namelen, &names, nameslen) != 1) {
+		if (len) {
+			memcpy(buf, conn->readbuf + conn->readbuf_offset, len);
+		}
+		tls_conn_readbuf_put(conn);
+		conn->readbuf = buf;
+		conn->readbuf_size = size;
+	} else if (conn->readbuf_offset) {
+		memmove(conn->readbuf, conn->readbuf + conn->readbuf_offset, len);
+	}
+	conn->readbuf_len = len;
+	conn->readbuf_offset = 0;
+
+	if ((n = tls_conn_transport_recv(conn, conn->readbuf + len, size - len)) > 0) {
+		conn->readbuf_len += (size_t)n;
+	}
+	return n;
+}
+
+// the whole application data records in readbuf, each with its ciphertext length of `out`
+static size_t tls_recv_pipeline_records(const TLS_CONNECT *conn, TLS_RECV_PIPELINE_ITEM *items,
+	uint8_t *out, size_t outlen)
+{
+	const uint8_t *record = conn->readbuf + conn->readbuf_offset;
+	size_t len = conn->readbuf_len - conn->readbuf_offset;
+	size_t n = 0;
+
+	while (n < TLS_RECV_PIPELINE_RECORDS && len >= TLS_RECORD_HEADER_SIZE) {
+		size_t recordlen = tls_record_length(record);
+		size_t maxlen;
+
+		// IV or tag
+		if (tls_record_type(record) != TLS_record_application_data
+			|| recordlen > len || recordlen > TLS_MAX_RECORD_SIZE
+			|| recordlen < TLS_RECORD_HEADER_SIZE + 16) {
+			break;
+		}
+		maxlen = recordlen - TLS_RECORD_HEADER_SIZE - 16;
+		if (maxlen > outlen) {
+			break;
+		}
+		items[n].conn = conn;
+		items[n].record = record;
+		items[n].recordlen = recordlen;
+		items[n].out = out;
+		items[n].outlen = maxlen;
+		out += maxlen;
+		outlen -= maxlen;
+		record += recordlen;
+		len -= recordlen;
+		n++;
+	}
+	return n;
+}
+
+int tls_recv_pipelined(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+{
+	TLS_RECV_PIPELINE_ITEM items[TLS_RECV_PIPELINE_RECORDS];
+	uint8_t *seq_num;
+	size_t len;
+	size_t used;
+	size_t n;
+	size_t i;
+	tls_ret_t ret;
+
+	if (!conn || !out || !outlen || !recvlen) {
+		error_print();
+		return -1;
+	}
+	if (conn->datalen || conn->recv_offset || !conn->read_ahead
+#ifdef ENABLE_KTLS
+		|| (conn->ktls & TLS_KTLS_RX)
+#endif
+		) {
+		return tls_recv_batch(conn, out, outlen, recvlen);
+	}
+
+	// only the first record may wait for the socket
+	len = conn->readbuf_len - conn->readbuf_offset;
+	if (len < TLS_RECORD_HEADER_SIZE || tls_record_length(conn->readbuf + conn->readbuf_offset) > len) {
+		if ((ret = tls_recv_pipeline_fill(conn)) == 0) {
+			tls_trace("TCP connection closed");
+			tls_conn_buffers_put(conn);
+			return 0;
+		} else if (ret < 0) {
+			if (errno == EAGAIN || errno == EWOULDBLOCK) {
+				return TLS_ERROR_WANT_READ;
+			}
+			perror("recv");
+			error_print();
+			return -1;
+		}
+	}
+
+	if ((n = tls_recv_pipeline_records(conn, items, out, outlen)) < 2) {
+		return tls_recv_batch(conn, out, outlen, recvlen);
+	}
+
+	tls_trace("recv ApplicationData\n");
+	seq_num = conn->is_client ? conn->server_seq_num : conn->client_seq_num;
+	memcpy(items[0].seq_num, seq_num, 8);
+	for (i = 1; i < n; i++) {
+		memcpy(items[i].seq_num, items[i - 1].seq_num, 8);
+		tls_seq_num_incr(items[i].seq_num);
+	}
+	used = (size_t)(items[n - 1].out - out) + items[n - 1].outlen;
+	gmssl_thread_pool_run(tls_recv_pipeline_task, items, sizeof(items[0]), n);
+
+	// the records are taken in order up to the first one the serial path has to see
+	*recvlen = 0;
+	for (i = 0; i < n; i++) {
+		if (items[i].ret != 1
+			|| items[i].record_type != TLS_record_application_data
+			|| items[i].outlen > conn->max_recv_fragment) {
+			break;
+		}
+		memmove(out + *recvlen, items[i].out, items[i].outlen);
+		*recvlen += items[i].outlen;
+		conn->readbuf_offset += items[i].recordlen;
+		tls_seq_num_incr(seq_num);
+	}
+	// MACs, paddings and the records not taken
+	gmssl_secure_clear(out + *recvlen, used - *recvlen);
+	if (!i) {
+		return tls_recv_batch(conn, out, outlen, recvlen);
+	}
+	tls_conn_buffers_put(conn);
+	return 1;
+}
+
+int tls_shutdown(TLS_CONNECT *conn)
+{
+	int ret;
+
+	if (!conn) {
+		error_print();
+		return -1;
+	}
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls_conn_shutdown(conn);
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
+int tls_send_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t datalen, size_t *sentlen)
+{
+	int ret;
+	const SM3_HMAC_CTX *hmac_ctx;
+	const SM4_KEY *enc_key;
+	uint8_t *seq_num;
+	size_t recordlen;
+
+	if (!conn || !buf || !sentlen) {
+		error_print();
+		return -1;
+	}
+
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the tail was queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		tls_conn_buffers_put(conn);
+		return 1;
+	}
+
+	if (!datalen || datalen > conn->max_send_fragment
+		|| buflen < TLS_RECORD_HEADROOM + datalen + TLS_RECORD_TAILROOM) {
+		error_print();
+		return -1;
+	}
+
+	if (conn->is_client) {
+		hmac_ctx = &conn->client_write_mac_ctx;
+		enc_key = &conn->client_write_enc_key;
+		seq_num = conn->client_seq_num;
+	} else {
+		hmac_ctx = &conn->server_write_mac_ctx;
+		enc_key = &conn->server_write_enc_key;
+		seq_num = conn->server_seq_num;
+	}
+
+	tls_trace("send ApplicationData\n");
+	if (tls_record_set_type(buf, TLS_record_application_data) != 1
+		|| tls_record_set_protocol(buf, conn->protocol) != 1
+		|| tls_record_encrypt_in_place(hmac_ctx, enc_key, seq_num, buf, datalen, &recordlen) != 1) {
+		error_print();
+		return -1;
+	}
+	tls_seq_num_incr(seq_num);
+	tls_encrypted_record_trace(stderr, buf, recordlen, 0, 0);
+
+	*sentlen = datalen;
+	if ((ret = tls_conn_record_send_direct(conn, buf, recordlen)) != 1) {
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = datalen;
+		} else {
+			error_print();
+		}
+		return ret;
+	}
+	tls_conn_buffers_put(conn);
+	return 1;
+}
+
+int tls_recv_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, uint8_t **data, size_t *datalen)
+{
+	int ret;
+	const SM3_HMAC_CTX *hmac_ctx;
+	const SM4_KEY *dec_key;
+	uint8_t *seq_num;
+	size_t recordlen;
+
+	if (!conn || !buf || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (buflen < TLS_MAX_RECORD_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (conn->datalen) {
+		error_puts("recv all buffered data before tls_recv_in_place");
+		return -1;
+	}
+
+	if (conn->is_client) {
+		hmac_ctx = &conn->server_write_mac_ctx;
+		dec_key = &conn->server_write_enc_key;
+		seq_num = conn->server_seq_num;
+	} else {
+		hmac_ctx = &conn->client_write_mac_ctx;
+		dec_key = &conn->client_write_enc_key;
+		seq_num = conn->client_seq_num;
+	}
+
+	tls_trace("recv Encrypted Record\n");
+	if ((ret = tls_conn_record_recv(conn, buf, &recordlen)) != 1) {
+		if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
+		return ret;
+	}
+	tls_encrypted_record_trace(stderr, buf, recordlen, 0, 0);
+
+	if (tls_record_decrypt_in_place(hmac_ctx, dec_key, seq_num, buf, recordlen, data, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	tls_seq_num_incr(seq_num);
+
+	switch (tls_record_type(buf)) {
+	case TLS_record_application_data:
+		if (*datalen > conn->max_recv_fragment) {
+			error_puts("record larger than the negotiated limit");
+			tls_send_alert(conn, TLS_alert_record_overflow);
+			return -1;
+		}
+		break;
+	case TLS_record_alert:
+		if (*datalen == 2 && (*data)[1] == TLS_alert_close_notify) {
+			tls_trace("recv Alert.close_notify\n");
+			*datalen = 0;
+			return 0;
+		}
+		tls_trace("alert received\n");
+		return -1;
+	default:
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// copy up to `outlen` bytes and advance the vector, zero-length entries are skipped
+size_t tls_iovec_copy(const TLS_IOVEC **iov, size_t *iovcnt, size_t *offset, uint8_t *out, size_t outlen)
+{
+	size_t copied = 0;
+	size_t len;
+
+	while (outlen && *iovcnt) {
+		len = (*iov)->len - *offset;
+		if (len > outlen) {
+			len = outlen;
+		}
+		if (len) {
+			memcpy(out, (const uint8_t *)(*iov)->base + *offset, len);
+		}
+		out += len;
+		outlen -= len;
+		copied += len;
+		*offset += len;
+		if (*offset == (*iov)->len) {
+			(*iov)++;
+			(*iovcnt)--;
+			*offset = 0;
+		}
+	}
+	return copied;
+}
+
+int tls_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen)
+{
+	int ret;
+	const SM3_HMAC_CTX *hmac_ctx;
+	const SM4_KEY *enc_key;
+	uint8_t *seq_num;
+	uint8_t *record;
+	size_t recordlen;
+	size_t offset = 0;
+	size_t left = 0;
+	size_t len, i;
+
+	if (!conn || (!iov && iovcnt) || !sentlen) {
+		error_print();
+		return -1;
+	}
+
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the records were queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		tls_conn_buffers_put(conn);
+		return 1;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].base && iov[i].len) {
 			error_print();
 			return -1;
 		}
-		maxlen -= alen;
+		left += iov[i].len;
+	}
+	if (!left) {
+		error_print();
+		return -1;
+	}
+
+	if (conn->is_client) {
+		hmac_ctx = &conn->client_write_mac_ctx;
+		enc_key = &conn->client_write_enc_key;
+		seq_num = conn->client_seq_num;
+	} else {
+		hmac_ctx = &conn->server_write_mac_ctx;
+		enc_key = &conn->server_write_enc_key;
+		seq_num = conn->server_seq_num;
+	}
+
+	tls_trace("send ApplicationData\n");
+	*sentlen = 0;
+	while (left) {
+		len = tls_send_fragment_size(conn, left);
+
+		// flush only when the next record does not fit behind the queued ones
+		if (conn->sendbuf_len - conn->sendbuf_offset
+			> TLS_MAX_RECORD_SIZE - (TLS_CBC_HEADROOM + len + TLS_CBC_TAILROOM)) {
+			if ((ret = tls_flush(conn)) != 1) {
+				goto end;
+			}
+		}
+		if (!(record = tls_conn_record_reserve(conn, TLS_CBC_HEADROOM + len + TLS_CBC_TAILROOM))) {
+			error_print();
+			return -1;
+		}
+		if (tls_record_set_type(record, TLS_record_application_data) != 1
+			|| tls_record_set_protocol(record, conn->protocol) != 1
+			|| tls_iovec_copy(&iov, &iovcnt, &offset, record + TLS_CBC_HEADROOM, len) != len
+			|| tls_record_encrypt_in_place(hmac_ctx, enc_key, seq_num, record, len, &recordlen) != 1) {
+			error_print();
+			return -1;
+		}
+		tls_seq_num_incr(seq_num);
+		conn->sendbuf_len += recordlen;
+		tls_encrypted_record_trace(stderr, record, recordlen, 0, 0);
+
+		*sentlen += len;
+		left -= len;
+	}
+	ret = tls_flush(conn);
+
+end:
+	if (ret != 1) {
+		// the sealed records stay queued
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = *sentlen;
+		} else {
+			error_print();
+		}
+		return ret;
+	}
+	tls_conn_buffers_put(conn);
+	return 1;
+}
+
+// CBC encryption of the in-place record (see tls_record_encrypt_in_place) whose MAC is already computed
+static int tls_record_encrypt_in_place_with_mac(const SM4_KEY *cbc_key, const uint8_t mac[32],
+	uint8_t *record, size_t datalen, size_t *recordlen)
+{
+	uint8_t *in = record + TLS_CBC_HEADROOM;
+	uint8_t last_blocks[32 + 16];
+	uint8_t iv[16];
+	size_t rem = datalen % 16;
+	size_t padding_len = 16 - rem - 1;
+	size_t enced_len;
+	size_t i;
+
+	memcpy(last_blocks, in + datalen - rem, rem);
+	memcpy(last_blocks + rem, mac, 32);
+	for (i = 0; i <= padding_len; i++) {
+		last_blocks[rem + 32 + i] = (uint8_t)padding_len;
+	}
+	if (rand_bytes(iv, 16) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(record + TLS_RECORD_HEADER_SIZE, iv, 16);
+	sm4_cbc_encrypt_blocks(cbc_key, iv, in, datalen / 16, in);
+	sm4_cbc_encrypt_blocks(cbc_key, iv, last_blocks, sizeof(last_blocks) / 16, in + datalen - rem);
+
+	enced_len = 16 + datalen - rem + sizeof(last_blocks);
+	record[3] = (uint8_t)(enced_len >> 8);
+	record[4] = (uint8_t)(enced_len);
+	*recordlen = TLS_RECORD_HEADER_SIZE + enced_len;
+	return 1;
+}
+
+typedef struct {
+	TLS_SEND_JOB *job;
+	uint8_t *record;
+	size_t datalen;
+} TLS_SEND_BATCH_RECORD;
+
+// seal the records with the MACs of all of them computed in the lanes, then flush each connection
+static void tls_send_batch_seal(TLS_SEND_BATCH_RECORD *records, size_t cnt)
+{
+	const SM3_HMAC_CTX *hmac_ctxs[TLS_SEND_BATCH_SIZE] = { NULL };
+	const uint8_t *datas[TLS_SEND_BATCH_SIZE] = { NULL };
+	size_t datalens[TLS_SEND_BATCH_SIZE] = { 0 };
+	uint8_t macs[TLS_SEND_BATCH_SIZE][SM3_HMAC_SIZE];
+	size_t i;
+
+	// the MAC input seq_num || header || data is made contiguous in the IV field
+	for (i = 0; i < cnt; i++) {
+		TLS_CONNECT *conn = records[i].job->conn;
+		uint8_t *mac_input = records[i].record + TLS_CBC_HEADROOM - 13;
+
+		hmac_ctxs[i] = conn->is_client ? &conn->client_write_mac_ctx : &conn->server_write_mac_ctx;
+		memcpy(mac_input, conn->is_client ? conn->client_seq_num : conn->server_seq_num, 8);
+		memcpy(mac_input + 8, records[i].record, TLS_RECORD_HEADER_SIZE);
+		datas[i] = mac_input;
+		datalens[i] = 13 + records[i].datalen;
+	}
+	sm3_hmac_batch(hmac_ctxs, datas, datalens, cnt, macs);
+
+	for (i = 0; i < cnt; i++) {
+		TLS_SEND_JOB *job = records[i].job;
+		TLS_CONNECT *conn = job->conn;
+		size_t recordlen;
+		int ret;
+
+		if (tls_record_encrypt_in_place_with_mac(conn->is_client ? &conn->client_write_enc_key : &conn->server_write_enc_key,
+			macs[i], records[i].record, records[i].datalen, &recordlen) != 1) {
+			error_print();
+			job->ret = -1;
+			tls_conn_buffers_put(conn);
+			continue;
+		}
+		tls_seq_num_incr(conn->is_client ? conn->client_seq_num : conn->server_seq_num);
+		conn->sendbuf_len += recordlen;
+		tls_encrypted_record_trace(stderr, records[i].record, recordlen, 0, 0);
+
+		job->sentlen = records[i].datalen;
+		if ((ret = tls_flush(conn)) == TLS_ERROR_WANT_WRITE) {
+			// the sealed record stays queued, the retry is a tls_send_batch() or tls_send() of the same data
+			conn->send_pending = job->sentlen;
+		} else {
+			if (ret != 1) error_print();
+			tls_conn_buffers_put(conn);
+		}
+		job->ret = ret;
+	}
+	gmssl_secure_clear(macs, sizeof(macs));
+}
+
+int tls_send_batch(TLS_SEND_JOB *jobs, size_t jobs_cnt)
+{
+	TLS_SEND_BATCH_RECORD records[TLS_SEND_BATCH_SIZE];
+	size_t cnt = 0;
+	size_t i, k;
+
+	if (!jobs && jobs_cnt) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < jobs_cnt; i++) {
+		TLS_SEND_JOB *job = &jobs[i];
+		TLS_CONNECT *conn = job->conn;
+		uint8_t *record;
+		size_t len;
+		int ret;
+
+		job->sentlen = 0;
+		if (!conn || !job->data || !job->datalen) {
+			error_print();
+			job->ret = -1;
+			continue;
+		}
+		if (conn->protocol == TLS_protocol_tls13) {
+			job->ret = tls13_send(conn, job->data, job->datalen, &job->sentlen);
+			continue;
+		}
+		// a retry after TLS_ERROR_WANT_WRITE only flushes
+		if (conn->send_pending) {
+			job->ret = tls_send(conn, job->data, job->datalen, &job->sentlen);
+			continue;
+		}
+		// one record of a connection in a batch, its sendbuf is reserved until sealed
+		for (k = 0; k < cnt; k++) {
+			if (records[k].job->conn == conn) {
+				break;
+			}
+		}
+		if (k < cnt || cnt == TLS_SEND_BATCH_SIZE) {
+			tls_send_batch_seal(records, cnt);
+			cnt = 0;
+		}
+
+		if (tls_conn_buffers_get(conn) != 1) {
+			error_print();
+			job->ret = -1;
+			continue;
+		}
+		len = tls_send_fragment_size(conn, job->datalen);
+		if (conn->sendbuf_len - conn->sendbuf_offset
+			> TLS_MAX_RECORD_SIZE - (TLS_CBC_HEADROOM + len + TLS_CBC_TAILROOM)) {
+			if ((ret = tls_flush(conn)) != 1) {
+				job->ret = ret;
+				tls_conn_buffers_put(conn);
+				continue;
+			}
+		}
+		if (!(record = tls_conn_record_reserve(conn, TLS_CBC_HEADROOM + len + TLS_CBC_TAILROOM))
+			|| tls_record_set_type(record, TLS_record_application_data) != 1
+			|| tls_record_set_protocol(record, conn->protocol) != 1) {
+			error_print();
+			job->ret = -1;
+			tls_conn_buffers_put(conn);
+			continue;
+		}
+		record[3] = (uint8_t)(len >> 8);
+		record[4] = (uint8_t)(len);
+		memcpy(record + TLS_CBC_HEADROOM, job->data, len);
+		records[cnt].job = job;
+		records[cnt].record = record;
+		records[cnt].datalen = len;
+		cnt++;
+	}
+	tls_send_batch_seal(records, cnt);
+	return 1;
+}
+
+int tls_authorities_from_certs(uint8_t *names, size_t *nameslen, size_t maxlen, const uint8_t *certs, size_t certslen)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *name;
+	size_t namelen;
+
+	*nameslen = 0;
+	while (certslen) {
+		size_t alen = 0;
+		if (x509_cert_from_der(&cert, &certlen, &certs, &certslen) != 1
+			|| x509_cert_get_subject(cert, certlen, &name, &namelen) != 1
+			|| asn1_sequence_to_der(name, namelen, NULL, &alen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (tls_uint16_size() + alen > maxlen) {
+			error_print();
+			return -1;
+		}
+		if (alen > UINT16_MAX) {
+			error_print();
+			return -1;
+		}
+		tls_uint16_to_bytes((uint16_t)alen, &names, nameslen);
+		if (asn1_sequence_to_der(name, namelen, &names, nameslen) != 1) {
+			error_print();
+			return -1;
+		}
+		maxlen -= tls_uint16_size() + alen;
+	}
+	return 1;
+}
+
+int tls_authorities_issued_certificate(const uint8_t *ca_names, size_t ca_names_len, const uint8_t *certs, size_t certslen)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *issuer;
+	size_t issuer_len;
+
+	if (x509_certs_get_last(certs, certslen, &cert, &certlen) != 1
+		|| x509_cert_get_issuer(cert, certlen, &issuer, &issuer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	while (ca_names_len) {
+		const uint8_t *p;
+		size_t len;
+		const uint8_t *name;
+		size_t namelen;
+
+		if (tls_uint16array_from_bytes(&p, &len, &ca_names, &ca_names_len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (asn1_sequence_from_der(&name, &namelen, &p, &len) != 1
+			|| asn1_length_is_zero(len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (x509_name_equ(name, namelen, issuer, issuer_len) == 1) {
+			return 1;
+		}
+	}
+	error_print();
+	return 0;
+}
+
+int tls_cert_types_accepted(const uint8_t *types, size_t types_len, const uint8_t *client_certs, size_t client_certs_len)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	int sig_alg;
+	size_t i;
+
+	if (x509_certs_get_cert_by_index(client_certs, client_certs_len, 0, &cert, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((sig_alg = tls_cert_type_from_oid(OID_sm2sign_with_sm3)) < 0) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < types_len; i++) {
+		if (sig_alg == types[i]) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+int tls_client_verify_init(TLS_CLIENT_VERIFY_CTX *ctx)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(TLS_CLIENT_VERIFY_CTX));
+	return 1;
+}
+
+int tls_client_verify_update(TLS_CLIENT_VERIFY_CTX *ctx, const uint8_t *handshake, size_t handshake_len)
+{
+	uint8_t *buf;
+	if (!ctx || !handshake || !handshake_len) {
+		error_print();
+		return -1;
+	}
+	if (ctx->index < 0 || ctx->index > 7) {
+		error_print();
+		return -1;
+	}
+	if (!(buf = malloc(handshake_len))) {
+		error_print();
+		return -1;
+	}
+	memcpy(buf, handshake, handshake_len);
+	ctx->handshake[ctx->index] = buf;
+	ctx->handshake_len[ctx->index] = handshake_len;
+	ctx->index++;
+	return 1;
+}
+
+int tls_client_verify_finish(TLS_CLIENT_VERIFY_CTX *ctx, const uint8_t *sig, size_t siglen, const SM2_KEY *public_key)
+{
+	int ret;
+	SM2_VERIFY_CTX verify_ctx;
+	int i;
+
+	if (!ctx || !sig || !siglen || !public_key) {
+		error_print();
+		return -1;
+	}
+
+	if (ctx->index != 8) {
+		error_print();
+		return -1;
+	}
+	if (sm2_verify_init(&verify_ctx, public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 8; i++) {
+		if (sm2_verify_update(&verify_ctx, ctx->handshake[i], ctx->handshake_len[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if ((ret = sm2_verify_finish(&verify_ctx, sig, siglen)) < 0) {
+		error_print();
+		return -1;
+	}
+	return ret;
+}
+
+void tls_client_verify_cleanup(TLS_CLIENT_VERIFY_CTX *ctx)
+{
+	if (ctx) {
+		int i;
+		for (i = 0; i< ctx->index; i++) {
+			if (ctx->handshake[i]) {
+				free(ctx->handshake[i]);
+				ctx->handshake[i] = NULL;
+				ctx->handshake_len[i] = 0;
+			}
+		}
+	}
+}
+
+int tls_cipher_suites_select(const uint8_t *client_ciphers, size_t client_ciphers_len,
+	const int *server_ciphers, size_t server_ciphers_cnt,
+	int *selected_cipher)
+{
+	if (!client_ciphers || !client_ciphers_len
+		|| !server_ciphers || !server_ciphers_cnt || !selected_cipher) {
+		error_print();
+		return -1;
+	}
+	while (server_ciphers_cnt--) {
+		const uint8_t *p = client_ciphers;
+		size_t len = client_ciphers_len;
+		while (len) {
+			uint16_t cipher;
+			if (tls_uint16_from_bytes(&cipher, &p, &len) != 1) {
+				error_print();
+				return -1;
+			}
+			if (cipher == *server_ciphers) {
+				*selected_cipher = *server_ciphers;
+				return 1;
+			}
+		}
+		server_ciphers++;
+	}
+	return 0;
+}
+
+static void tls_ctx_compressed_certs_cleanup(TLS_CTX *ctx)
+{
+	size_t i;
+	for (i = 0; i < TLS_MAX_CERT_COMPRESSION_ALGORS; i++) {
+		if (ctx->compressed_certs[i]) free(ctx->compressed_certs[i]);
+		ctx->compressed_certs[i] = NULL;
+		ctx->compressed_certs_len[i] = 0;
+	}
+}
+
+static void tls_ctx_handshake_messages_cleanup(TLS_CTX *ctx)
+{
+	if (ctx->certificate_msg) free(ctx->certificate_msg);
+	if (ctx->certificate_request_msg) free(ctx->certificate_request_msg);
+	ctx->certificate_msg = NULL;
+	ctx->certificate_msg_len = 0;
+	ctx->certificate_request_msg = NULL;
+	ctx->certificate_request_msg_len = 0;
+}
+
+void tls_ctx_cleanup(TLS_CTX *ctx)
+{
+	if (ctx) {
+		gmssl_secure_clear(&ctx->signkey, sizeof(SM2_KEY));
+		gmssl_secure_clear(&ctx->kenckey, sizeof(SM2_KEY));
+		gmssl_secure_clear(ctx->session_ticket_key, sizeof(ctx->session_ticket_key));
+		if (ctx->certs) free(ctx->certs);
+		if (ctx->ca_snapshot) file_unmap(ctx->ca_snapshot, ctx->ca_snapshot_len);
+		else if (ctx->cacerts) free(ctx->cacerts);
+		x509_store_cleanup(&ctx->ca_store);
+		tls_ctx_compressed_certs_cleanup(ctx);
+		tls_ctx_handshake_messages_cleanup(ctx);
+		memset(ctx, 0, sizeof(TLS_CTX));
+	}
+}
+
+int tls_ctx_init(TLS_CTX *ctx, int protocol, int is_client)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	memset(ctx, 0, sizeof(*ctx));
+
+	switch (protocol) {
+	case TLS_protocol_tlcp:
+	case TLS_protocol_tls12:
+	case TLS_protocol_tls13:
+		ctx->protocol = protocol;
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+	ctx->is_client = is_client ? 1 : 0;
+	ctx->read_ahead = 1;
+	return 1;
+}
+
+int tls_ctx_set_cipher_suites(TLS_CTX *ctx, const int *cipher_suites, size_t cipher_suites_cnt)
+{
+	size_t i;
+
+	if (!ctx || !cipher_suites || !cipher_suites_cnt) {
+		error_print();
+		return -1;
+	}
+	if (cipher_suites_cnt < 1 || cipher_suites_cnt > TLS_MAX_CIPHER_SUITES_COUNT) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < cipher_suites_cnt; i++) {
+		if (!tls_cipher_suite_name(cipher_suites[i])) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < cipher_suites_cnt; i++) {
+		ctx->cipher_suites[i] = cipher_suites[i];
+	}
+	ctx->cipher_suites_cnt = cipher_suites_cnt;
+	return 1;
+}
+
+int tls_ctx_set_ca_certificates(TLS_CTX *ctx, const char *cacertsfile, int depth)
+{
+	if (!ctx || !cacertsfile) {
+		error_print();
+		return -1;
+	}
+	if (depth < 0 || depth > TLS_MAX_VERIFY_DEPTH) {
+		error_print();
+		return -1;
+	}
+	if (!tls_protocol_name(ctx->protocol)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->cacerts) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_new_from_file(&ctx->cacerts, &ctx->cacertslen, cacertsfile) != 1) {
+		error_print();
+		return -1;
+	}
+	if (ctx->cacertslen == 0
+		|| x509_store_init(&ctx->ca_store, ctx->cacerts, ctx->cacertslen) != 1) {
+		free(ctx->cacerts);
+		ctx->cacerts = NULL;
+		ctx->cacertslen = 0;
+		error_print();
+		return -1;
+	}
+
+	ctx->verify_depth = depth;
+	if (!ctx->is_client && tls_ctx_cache_handshake_messages(ctx) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_ctx_set_ca_snapshot(TLS_CTX *ctx, const char *snapshotfile, int depth)
+{
+	const uint8_t *certs;
+	size_t certslen;
+
+	if (!ctx || !snapshotfile) {
+		error_print();
+		return -1;
+	}
+	if (depth < 0 || depth > TLS_MAX_VERIFY_DEPTH) {
+		error_print();
+		return -1;
+	}
+	if (!tls_protocol_name(ctx->protocol)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->cacerts) {
+		error_print();
+		return -1;
+	}
+	if (file_map(snapshotfile, &ctx->ca_snapshot, &ctx->ca_snapshot_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_store_init_from_snapshot(&ctx->ca_store,
+			ctx->ca_snapshot, ctx->ca_snapshot_len, &certs, &certslen) != 1
+		|| certslen == 0) {
+		x509_store_cleanup(&ctx->ca_store);
+		file_unmap(ctx->ca_snapshot, ctx->ca_snapshot_len);
+		ctx->ca_snapshot = NULL;
+		ctx->ca_snapshot_len = 0;
+		error_print();
+		return -1;
+	}
+	// only read, the mapping is not writable
+	ctx->cacerts = (uint8_t *)certs;
+	ctx->cacertslen = certslen;
+
+	ctx->verify_depth = depth;
+	if (!ctx->is_client && tls_ctx_cache_handshake_messages(ctx) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
+	const char *keyfile, const char *keypass)
+{
+	int ret = -1;
+	uint8_t *certs = NULL;
+	size_t certslen;
+	FILE *keyfp = NULL;
+	SM2_KEY key;
+	const uint8_t *cert;
+	size_t certlen;
+	SM2_KEY public_key;
+
+	if (!ctx || !chainfile || !keyfile || !keypass) {
+		error_print();
+		return -1;
+	}
+	if (!tls_protocol_name(ctx->protocol)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->certs) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_certs_new_from_file(&certs, &certslen, chainfile) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(keyfp = fopen(keyfile, "r"))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_private_key_info_decrypt_from_pem(&key, keypass, keyfp) != 1) {
+		error_print();
+		goto end;
+	}
+	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
+		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_public_key_equ(&key, &public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	ctx->certs = certs;
+	ctx->certslen = certslen;
+	ctx->signkey = key;
+	certs = NULL;
+	if (tls_ctx_cache_handshake_messages(ctx) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	gmssl_secure_clear(&key, sizeof(key));
+	if (certs) free(certs);
+	if (keyfp) fclose(keyfp);
+	return ret;
+}
+
+int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chainfile,
+	const char *signkeyfile, const char *signkeypass,
+	const char *kenckeyfile, const char *kenckeypass)
+{
+	int ret = -1;
+	uint8_t *certs = NULL;
+	size_t certslen;
+	FILE *signkeyfp = NULL;
+	FILE *kenckeyfp = NULL;
+	SM2_KEY signkey;
+	SM2_KEY kenckey;
+
+	const uint8_t *cert;
+	size_t certlen;
+	SM2_KEY public_key;
+
+	if (!ctx || !chainfile || !signkeyfile || !signkeypass || !kenckeyfile || !kenckeypass) {
+		error_print();
+		return -1;
+	}
+	if (!tls_protocol_name(ctx->protocol)) {
+		error_print();
+		return -1;
+	}
+	if (ctx->certs) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_certs_new_from_file(&certs, &certslen, chainfile) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (!(signkeyfp = fopen(signkeyfile, "r"))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_private_key_info_decrypt_from_pem(&signkey, signkeypass, signkeyfp) != 1) {
+		error_print();
+		goto end;
+	}
+	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
+		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+		|| sm2_public_key_equ(&signkey, &public_key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (!(kenckeyfp = fopen(kenckeyfile, "r"))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_private_key_info_decrypt_from_pem(&kenckey, kenckeypass, kenckeyfp) != 1) {
+		error_print();
+		goto end;
 	}
-	return 1;
+	if (x509_certs_get_cert_by_index(certs, certslen, 1, &cert, &certlen) != 1
+		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
+		|| sm2_public_key_equ(&kenckey, &public_key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	ctx->certs = certs;
+	ctx->certslen = certslen;
+	ctx->signkey = signkey;
+	ctx->kenckey = kenckey;
+	certs = NULL;
+	if (tls_ctx_cache_handshake_messages(ctx) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	gmssl_secure_clear(&signkey, sizeof(signkey));
+	gmssl_secure_clear(&kenckey, sizeof(kenckey));
+	if (certs) free(certs);
+	if (signkeyfp) fclose(signkeyfp);
+	if (kenckeyfp) fclose(kenckeyfp);
+	return ret;
 }
 
-int tls_authorities_issued_certificate(const uint8_t *ca_names, size_t ca_names_len, const uint8_t *certs, size_t certslen)
+// TLS 1.3 server issues session tickets once the ticket key is set, a NULL key is generated
+int tls_ctx_set_session_ticket_key(TLS_CTX *ctx, const uint8_t *key, size_t keylen)
 {
-	const uint8_t *cert;
-	size_t certlen;
-	const uint8_t *issuer;
-	size_t issuer_len;
-
-	if (x509_certs_get_last(certs, certslen, &cert, &certlen) != 1
-		|| x509_cert_get_issuer(cert, certlen, &issuer, &issuer_len) != 1) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	while (ca_names_len) {
-		const uint8_t *p;
-		size_t len;
-		const uint8_t *name;
-		size_t namelen;
-
-		if (tls_uint16array_from_bytes(&p, &len, &ca_names, &ca_names_len) != 1) {
+	if (ctx->is_client) {
+		error_print();
+		return -1;
+	}
+	if (key) {
+		if (keylen != TLS13_SESSION_TICKET_KEY_SIZE) {
 			error_print();
 			return -1;
 		}
-		if (asn1_sequence_from_der(&name, &namelen, &p, &len) != 1
-			|| asn1_length_is_zero(len) != 1) {
+		memcpy(ctx->session_ticket_key, key, TLS13_SESSION_TICKET_KEY_SIZE);
+	} else {
+		if (rand_bytes(ctx->session_ticket_key, TLS13_SESSION_TICKET_KEY_SIZE) != 1) {
 			error_print();
 			return -1;
 		}
-		if (x509_name_equ(name, namelen, issuer, issuer_len) == 1) {
-			return 1;
-		}
 	}
-	error_print();
-	return 0;
+	ctx->session_ticket_key_set = 1;
+	return 1;
 }
 
-int tls_cert_types_accepted(const uint8_t *types, size_t types_len, const uint8_t *client_certs, size_t client_certs_len)
+// TLCP and TLS 1.2 servers resume sessions from the cache, it must outlive the connections
+int tls_ctx_set_session_cache(TLS_CTX *ctx, TLS_SESSION_CACHE *cache)
 {
-	const uint8_t *cert;
-	size_t certlen;
-	int sig_alg;
-	size_t i;
-
-	if (x509_certs_get_cert_by_index(client_certs, client_certs_len, 0, &cert, &certlen) != 1) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if ((sig_alg = tls_cert_type_from_oid(OID_sm2sign_with_sm3)) < 0) {
+	if (ctx->is_client) {
 		error_print();
 		return -1;
 	}
-	for (i = 0; i < types_len; i++) {
-		if (sig_alg == types[i]) {
-			return 1;
-		}
+	ctx->session_cache = cache;
+	return 1;
+}
+
+// TLS 1.3 connections try to move the record layer into the kernel after the handshake
+int tls_ctx_enable_ktls(TLS_CTX *ctx, int enable)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
 	}
-	return 0;
+#ifndef ENABLE_KTLS
+	if (enable) {
+		error_puts("built without ENABLE_KTLS");
+		return -1;
+	}
+#endif
+	ctx->ktls = enable ? 1 : 0;
+	return 1;
 }
 
-int tls_client_verify_init(TLS_CLIENT_VERIFY_CTX *ctx)
+// NULL method goes back to the keys of the TLS_CTX
+int tls_ctx_set_private_key_method(TLS_CTX *ctx, const TLS_PRIVATE_KEY_METHOD *method)
 {
 	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	memset(ctx, 0, sizeof(TLS_CLIENT_VERIFY_CTX));
+	if (!method) {
+		memset(&ctx->key_method, 0, sizeof(ctx->key_method));
+		ctx->key_method_set = 0;
+		return 1;
+	}
+	if (ctx->protocol != TLS_protocol_tlcp || ctx->is_client) {
+		error_puts("private key method is only used by the TLCP server");
+		return -1;
+	}
+	if (!method->sign || !method->decrypt || !method->complete) {
+		error_print();
+		return -1;
+	}
+	ctx->key_method = *method;
+	ctx->key_method_set = 1;
 	return 1;
 }
 
-int tls_client_verify_update(TLS_CLIENT_VERIFY_CTX *ctx, const uint8_t *handshake, size_t handshake_len)
+int tls_ctx_set_early_data(TLS_CTX *ctx, uint32_t max_early_data_size, TLS_REPLAY_CACHE *replay_cache)
 {
-	uint8_t *buf;
-	if (!ctx || !handshake || !handshake_len) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (ctx->index < 0 || ctx->index > 7) {
+	if (ctx->protocol != TLS_protocol_tls13 || ctx->is_client) {
+		error_puts("early data is only accepted by the TLS 1.3 server");
+		return -1;
+	}
+	if (max_early_data_size > TLS13_MAX_EARLY_DATA_SIZE) {
 		error_print();
 		return -1;
 	}
-	if (!(buf = malloc(handshake_len))) {
+	// 0-RTT is never accepted without replay protection
+	if (max_early_data_size && !replay_cache) {
 		error_print();
 		return -1;
 	}
-	memcpy(buf, handshake, handshake_len);
-	ctx->handshake[ctx->index] = buf;
-	ctx->handshake_len[ctx->index] = handshake_len;
-	ctx->index++;
+	ctx->max_early_data_size = max_early_data_size;
+	ctx->replay_cache = max_early_data_size ? replay_cache : NULL;
 	return 1;
 }
 
-int tls_client_verify_finish(TLS_CLIENT_VERIFY_CTX *ctx, const uint8_t *sig, size_t siglen, const SM2_KEY *public_key)
+int tls_ctx_set_ocsp_stapler(TLS_CTX *ctx, TLS_OCSP_STAPLER *stapler)
 {
-	int ret;
-	SM2_VERIFY_CTX verify_ctx;
-	int i;
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (ctx->is_client || ctx->protocol == TLS_protocol_tls12) {
+		error_puts("OCSP responses are stapled by the TLS 1.3 and TLCP server");
+		return -1;
+	}
+	ctx->ocsp_stapler = stapler;
+	return 1;
+}
 
-	if (!ctx || !sig || !siglen || !public_key) {
+int tls_ctx_set_ocsp_stapling(TLS_CTX *ctx, int mode)
+{
+	if (!ctx) {
+		error_print();
+		return -1;
+	}
+	if (!ctx->is_client || ctx->protocol == TLS_protocol_tls12) {
+		error_puts("OCSP stapling is requested by the TLS 1.3 and TLCP client");
+		return -1;
+	}
+	switch (mode) {
+	case TLS_ocsp_stapling_off:
+	case TLS_ocsp_stapling_request:
+	case TLS_ocsp_stapling_require:
+		break;
+	default:
 		error_print();
 		return -1;
 	}
+	ctx->ocsp_stapling = mode;
+	return 1;
+}
 
-	if (ctx->index != 8) {
+int tls_ctx_set_certificate_compression(TLS_CTX *ctx, const int *algors, size_t algors_cnt)
+{
+	uint8_t *cert_msg = NULL;
+	size_t cert_msg_len = 0;
+	uint8_t *p;
+	size_t i;
+
+	if (!ctx || (algors_cnt && !algors)) {
 		error_print();
 		return -1;
 	}
-	if (sm2_verify_init(&verify_ctx, public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+	if (ctx->protocol != TLS_protocol_tls13) {
+		error_puts("certificate compression is a TLS 1.3 feature");
+		return -1;
+	}
+	if (algors_cnt > TLS_MAX_CERT_COMPRESSION_ALGORS) {
 		error_print();
 		return -1;
 	}
-	for (i = 0; i < 8; i++) {
-		if (sm2_verify_update(&verify_ctx, ctx->handshake[i], ctx->handshake_len[i]) != 1) {
-			error_print();
+	for (i = 0; i < algors_cnt; i++) {
+		if (tls_cert_compression_supported(algors[i]) != 1) {
+			error_puts("certificate compression algorithm not supported");
 			return -1;
 		}
 	}
-	if ((ret = sm2_verify_finish(&verify_ctx, sig, siglen)) < 0) {
-		error_print();
+	if (!ctx->is_client && algors_cnt && !ctx->certslen) {
+		error_puts("set the certificates before the compression");
 		return -1;
 	}
-	return ret;
+
+	tls_ctx_compressed_certs_cleanup(ctx);
+	ctx->cert_compression_algors_cnt = 0;
+
+	// the server Certificate body, an empty certificate_request_context and the chain
+	if (!ctx->is_client && algors_cnt) {
+		cert_msg_len = 1;
+		if (tls13_certificate_list_to_bytes(ctx->certs, ctx->certslen, NULL, 0, NULL, &cert_msg_len) != 1
+			|| !(cert_msg = (uint8_t *)malloc(cert_msg_len))) {
+			error_print();
+			return -1;
+		}
+		p = cert_msg;
+		cert_msg_len = 0;
+		tls_uint8array_to_bytes(NULL, 0, &p, &cert_msg_len);
+		tls13_certificate_list_to_bytes(ctx->certs, ctx->certslen, NULL, 0, &p, &cert_msg_len);
+	}
+	for (i = 0; i < algors_cnt; i++) {
+		ctx->cert_compression_algors[i] = algors[i];
+		if (!cert_msg) {
+			continue;
+		}
+		if (!(ctx->compressed_certs[i] = (uint8_t *)malloc(TLS_MAX_HANDSHAKE_DATA_SIZE))) {
+			error_print();
+			goto err;
+		}
+		switch (tls13_compress_certificate(algors[i], cert_msg, cert_msg_len,
+			ctx->compressed_certs[i], &ctx->compressed_certs_len[i], TLS_MAX_HANDSHAKE_DATA_SIZE)) {
+		case 1:
+			break;
+		case 0:
+			// the plain Certificate is sent
+			free(ctx->compressed_certs[i]);
+			ctx->compressed_certs[i] = NULL;
+			ctx->compressed_certs_len[i] = 0;
+			break;
+		default:
+			error_print();
+			goto err;
+		}
+	}
+	ctx->cert_compression_algors_cnt = algors_cnt;
+	if (cert_msg) free(cert_msg);
+	return 1;
+
+err:
+	tls_ctx_compressed_certs_cleanup(ctx);
+	free(cert_msg);
+	return -1;
 }
 
-void tls_client_verify_cleanup(TLS_CLIENT_VERIFY_CTX *ctx)
+// keep a copy of the handshake body of `record`
+static int tls_handshake_body_dup(const uint8_t *record, size_t recordlen, uint8_t **body, size_t *bodylen)
 {
-	if (ctx) {
-		int i;
-		for (i = 0; i< ctx->index; i++) {
-			if (ctx->handshake[i]) {
-				free(ctx->handshake[i]);
-				ctx->handshake[i] = NULL;
-				ctx->handshake_len[i] = 0;
-			}
-		}
+	*bodylen = recordlen - TLS_RECORD_HEADER_SIZE - TLS_HANDSHAKE_HEADER_SIZE;
+	if (!(*body = (uint8_t *)malloc(*bodylen ? *bodylen : 1))) {
+		error_print();
+		return -1;
 	}
+	memcpy(*body, record + TLS_RECORD_HEADER_SIZE + TLS_HANDSHAKE_HEADER_SIZE, *bodylen);
+	return 1;
 }
 
-int tls_cipher_suites_select(const uint8_t *client_ciphers, size_t client_ciphers_len,
-	const int *server_ciphers, size_t server_ciphers_cnt,
-	int *selected_cipher)
+int tls_ctx_cache_handshake_messages(TLS_CTX *ctx)
 {
-	if (!client_ciphers || !client_ciphers_len
-		|| !server_ciphers || !server_ciphers_cnt || !selected_cipher) {
+	const uint8_t cert_types[] = { TLS_cert_type_ecdsa_sign };
+	uint8_t ca_names[TLS_MAX_CA_NAMES_SIZE];
+	size_t ca_names_len = 0;
+	uint8_t *record;
+	size_t recordlen;
+	int ret = -1;
+
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	while (server_ciphers_cnt--) {
-		const uint8_t *p = client_ciphers;
-		size_t len = client_ciphers_len;
-		while (len) {
-			uint16_t cipher;
-			if (tls_uint16_from_bytes(&cipher, &p, &len) != 1) {
+	tls_ctx_handshake_messages_cleanup(ctx);
+
+	if (!(record = tls_buffer_get())) {
+		error_print();
+		return -1;
+	}
+	tls_record_set_protocol(record, ctx->protocol == TLS_protocol_tls13 ? TLS_protocol_tls12 : ctx->protocol);
+
+	if (ctx->certslen) {
+		if (ctx->protocol == TLS_protocol_tls13) {
+			if (tls13_record_set_handshake_certificate(record, &recordlen, NULL, 0,
+				ctx->certs, ctx->certslen, NULL, 0) != 1) {
 				error_print();
-				return -1;
+				goto end;
 			}
-			if (cipher == *server_ciphers) {
-				*selected_cipher = *server_ciphers;
-				return 1;
+		} else {
+			if (tls_record_set_handshake_certificate(record, &recordlen, ctx->certs, ctx->certslen) != 1) {
+				error_print();
+				goto end;
 			}
 		}
-		server_ciphers++;
+		if (tls_handshake_body_dup(record, recordlen, &ctx->certificate_msg, &ctx->certificate_msg_len) != 1) {
+			error_print();
+			goto end;
+		}
 	}
-	return 0;
+
+	if (!ctx->is_client) {
+		if (ctx->protocol == TLS_protocol_tls13) {
+			if (tls13_record_set_handshake_certificate_request_default(record, &recordlen) != 1) {
+				error_print();
+				goto end;
+			}
+		} else if (ctx->cacertslen) {
+			if (tls_authorities_from_certs(ca_names, &ca_names_len, sizeof(ca_names),
+					ctx->cacerts, ctx->cacertslen) != 1
+				|| tls_record_set_handshake_certificate_request(record, &recordlen,
+					cert_types, sizeof(cert_types), ca_names, ca_names_len) != 1) {
+				error_print();
+				goto end;
+			}
+		} else {
+			recordlen = 0;
+		}
+		if (recordlen && tls_handshake_body_dup(record, recordlen,
+			&ctx->certificate_request_msg, &ctx->certificate_request_msg_len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+
+end:
+	if (ret != 1) tls_ctx_handshake_messages_cleanup(ctx);
+	tls_buffer_put(record);
+	return ret;
 }
 
-void tls_ctx_cleanup(TLS_CTX *ctx)
+int tls_conn_set_handshake_certificate(const TLS_CONNECT *conn, uint8_t *record, size_t *recordlen)
 {
-	if (ctx) {
-		gmssl_secure_clear(&ctx->signkey, sizeof(SM2_KEY));
-		gmssl_secure_clear(&ctx->kenckey, sizeof(SM2_KEY));
-		if (ctx->certs) free(ctx->certs);
-		if (ctx->cacerts) free(ctx->cacerts);
-		memset(ctx, 0, sizeof(TLS_CTX));
+	const uint8_t *certs = conn->is_client ? conn->client_certs : conn->server_certs;
+	size_t certslen = conn->is_client ? conn->client_certs_len : conn->server_certs_len;
+
+	if (conn->certificate_msg) {
+		return tls_record_set_handshake(record, recordlen, TLS_handshake_certificate,
+			conn->certificate_msg, conn->certificate_msg_len);
 	}
+	if (conn->protocol == TLS_protocol_tls13) {
+		return tls13_record_set_handshake_certificate(record, recordlen, NULL, 0, certs, certslen, NULL, 0);
+	}
+	return tls_record_set_handshake_certificate(record, recordlen, certs, certslen);
 }
 
-int tls_ctx_init(TLS_CTX *ctx, int protocol, int is_client)
+int tls_conn_set_handshake_certificate_request(const TLS_CONNECT *conn, uint8_t *record, size_t *recordlen)
 {
-	if (!ctx) {
-		error_print();
-		return -1;
-	}
-	memset(ctx, 0, sizeof(*ctx));
+	const uint8_t cert_types[] = { TLS_cert_type_ecdsa_sign };
+	uint8_t ca_names[TLS_MAX_CA_NAMES_SIZE];
+	size_t ca_names_len = 0;
 
-	switch (protocol) {
-	case TLS_protocol_tlcp:
-	case TLS_protocol_tls12:
-	case TLS_protocol_tls13:
-		ctx->protocol = protocol;
-		break;
-	default:
+	if (conn->certificate_request_msg) {
+		return tls_record_set_handshake(record, recordlen, TLS_handshake_certificate_request,
+			conn->certificate_request_msg, conn->certificate_request_msg_len);
+	}
+	if (conn->protocol == TLS_protocol_tls13) {
+		return tls13_record_set_handshake_certificate_request_default(record, recordlen);
+	}
+	if (tls_authorities_from_certs(ca_names, &ca_names_len, sizeof(ca_names),
+		conn->ca_certs, conn->ca_certs_len) != 1) {
 		error_print();
 		return -1;
 	}
-	ctx->is_client = is_client ? 1 : 0;
-	return 1;
+	return tls_record_set_handshake_certificate_request(record, recordlen,
+		cert_types, sizeof(cert_types), ca_names, ca_names_len);
 }
 
-int tls_ctx_set_cipher_suites(TLS_CTX *ctx, const int *cipher_suites, size_t cipher_suites_cnt)
+int tls_ctx_set_server_name_callback(TLS_CTX *ctx, TLS_SERVER_NAME_CALLBACK callback, void *arg)
 {
-	size_t i;
-
-	if (!ctx || !cipher_suites || !cipher_suites_cnt) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (cipher_suites_cnt < 1 || cipher_suites_cnt > TLS_MAX_CIPHER_SUITES_COUNT) {
-		error_print();
+	if (ctx->is_client || ctx->protocol == TLS_protocol_tls12) {
+		error_puts("server_name is selected by the TLS 1.3 and TLCP server");
 		return -1;
 	}
-	for (i = 0; i < cipher_suites_cnt; i++) {
-		if (!tls_cipher_suite_name(cipher_suites[i])) {
-			error_print();
-			return -1;
-		}
-	}
-	for (i = 0; i < cipher_suites_cnt; i++) {
-		ctx->cipher_suites[i] = cipher_suites[i];
-	}
-	ctx->cipher_suites_cnt = cipher_suites_cnt;
+	ctx->server_name_callback = callback;
+	ctx->server_name_callback_arg = arg;
 	return 1;
 }
 
-int tls_ctx_set_ca_certificates(TLS_CTX *ctx, const char *cacertsfile, int depth)
+int tls_ctx_set_record_size_limit(TLS_CTX *ctx, size_t limit)
 {
-	if (!ctx || !cacertsfile) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (depth < 0 || depth > TLS_MAX_VERIFY_DEPTH) {
-		error_print();
+	if (ctx->protocol == TLS_protocol_tls12) {
+		error_puts("record_size_limit is supported by TLS 1.3 and TLCP");
 		return -1;
 	}
-	if (!tls_protocol_name(ctx->protocol)) {
+	if (limit < TLS_MIN_RECORD_SIZE_LIMIT || limit > TLS_MAX_PLAINTEXT_SIZE) {
 		error_print();
 		return -1;
 	}
-	if (ctx->cacerts) {
+	ctx->record_size_limit = limit;
+	return 1;
+}
+
+int tls_ctx_set_max_fragment_length(TLS_CTX *ctx, size_t len)
+{
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (x509_certs_new_from_file(&ctx->cacerts, &ctx->cacertslen, cacertsfile) != 1) {
-		error_print();
+	if (!ctx->is_client || ctx->protocol == TLS_protocol_tls12) {
+		error_puts("max_fragment_length is requested by the TLS 1.3 and TLCP client");
 		return -1;
 	}
-	if (ctx->cacertslen == 0) {
+	switch (len) {
+	case 512: ctx->max_fragment_length = TLS_max_fragment_length_512; break;
+	case 1024: ctx->max_fragment_length = TLS_max_fragment_length_1024; break;
+	case 2048: ctx->max_fragment_length = TLS_max_fragment_length_2048; break;
+	case 4096: ctx->max_fragment_length = TLS_max_fragment_length_4096; break;
+	default:
 		error_print();
 		return -1;
 	}
-
-	ctx->verify_depth = depth;
 	return 1;
 }
 
-int tls_ctx_set_certificate_and_key(TLS_CTX *ctx, const char *chainfile,
-	const char *keyfile, const char *keypass)
+int tls_ctx_set_dynamic_record_sizing(TLS_CTX *ctx, int enable)
 {
-	int ret = -1;
-	uint8_t *certs = NULL;
-	size_t certslen;
-	FILE *keyfp = NULL;
-	SM2_KEY key;
-	const uint8_t *cert;
-	size_t certlen;
-	SM2_KEY public_key;
-
-	if (!ctx || !chainfile || !keyfile || !keypass) {
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (!tls_protocol_name(ctx->protocol)) {
+	ctx->dynamic_record_sizing = enable ? 1 : 0;
+	return 1;
+}
+
+int tls_ctx_set_read_ahead(TLS_CTX *ctx, int enable)
+{
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
-	if (ctx->certs) {
+	ctx->read_ahead = enable ? 1 : 0;
+	return 1;
+}
+
+int tls_ctx_set_handshake_guard(TLS_CTX *ctx, TLS_HANDSHAKE_GUARD *guard)
+{
+	if (!ctx) {
 		error_print();
 		return -1;
 	}
+	if (ctx->is_client || (ctx->protocol != TLS_protocol_tls13 && ctx->protocol != TLS_protocol_tlcp)) {
+		error_puts("the handshake guard is used by the TLS 1.3 and TLCP server");
+		return -1;
+	}
+	ctx->handshake_guard = guard;
+	return 1;
+}
 
-	if (x509_certs_new_from_file(&certs, &certslen, chainfile) != 1) {
+#ifdef ENABLE_SM2_KEY_POOL
+int tls_ctx_set_ecdhe_key_pool(TLS_CTX *ctx, SM2_KEY_POOL *pool)
+{
+	if (!ctx) {
 		error_print();
-		goto end;
+		return -1;
 	}
-	if (!(keyfp = fopen(keyfile, "r"))) {
-		error_print();
-		goto end;
+	if (ctx->protocol == TLS_protocol_tlcp) {
+		error_puts("TLCP does not use ECDHE keys");
+		return -1;
 	}
-	if (sm2_private_key_info_decrypt_from_pem(&key, keypass, keyfp) != 1) {
-		error_print();
-		goto end;
+	ctx->ecdhe_key_pool = pool;
+	return 1;
+}
+#endif
+
+int tls_init(TLS_CONNECT *conn, const TLS_CTX *ctx)
+{
+	size_t i;
+	memset(conn, 0, sizeof(*conn));
+
+	conn->protocol = ctx->protocol;
+	conn->is_client = ctx->is_client;
+	for (i = 0; i < ctx->cipher_suites_cnt; i++) {
+		conn->cipher_suites[i] = ctx->cipher_suites[i];
 	}
-	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1) {
+	conn->cipher_suites_cnt = ctx->cipher_suites_cnt;
+
+
+	if (ctx->certslen > TLS_MAX_CERTIFICATES_SIZE) {
 		error_print();
 		return -1;
 	}
-	if (sm2_public_key_equ(&key, &public_key) != 1) {
-		error_print();
-		return -1;
+	if (ctx->certslen) {
+		if (conn->is_client) {
+			conn->client_certs = ctx->certs;
+			conn->client_certs_len = ctx->certslen;
+		} else {
+			conn->server_certs = ctx->certs;
+			conn->server_certs_len = ctx->certslen;
+		}
 	}
-	ctx->certs = certs;
-	ctx->certslen = certslen;
-	ctx->signkey = key;
-	certs = NULL;
-	ret = 1;
 
-end:
-	gmssl_secure_clear(&key, sizeof(key));
-	if (certs) free(certs);
-	if (keyfp) fclose(keyfp);
-	return ret;
+	// trust anchors are read-only and shared by all the connections of the context
+	if (ctx->cacertslen) {
+		conn->ca_certs = ctx->cacerts;
+		conn->ca_certs_len = ctx->cacertslen;
+		conn->ca_store = ctx->ca_store.entries ? &ctx->ca_store : NULL;
+	}
+	conn->certificate_msg = ctx->certificate_msg;
+	conn->certificate_msg_len = ctx->certificate_msg_len;
+	conn->certificate_request_msg = ctx->certificate_request_msg;
+	conn->certificate_request_msg_len = ctx->certificate_request_msg_len;
+
+	conn->sign_key = &ctx->signkey;
+	conn->kenc_key = &ctx->kenckey;
+
+	if (ctx->session_ticket_key_set) {
+		memcpy(conn->session_ticket_key, ctx->session_ticket_key, TLS13_SESSION_TICKET_KEY_SIZE);
+		conn->session_ticket_key_set = 1;
+	}
+	conn->session_cache = ctx->session_cache;
+	conn->ecdhe_key_pool = ctx->ecdhe_key_pool;
+	conn->max_early_data_size = ctx->max_early_data_size;
+	conn->replay_cache = ctx->replay_cache;
+	conn->ocsp_stapler = ctx->ocsp_stapler;
+	conn->ocsp_stapling = ctx->ocsp_stapling;
+	conn->ocsp_status = -1;
+	for (i = 0; i < ctx->cert_compression_algors_cnt; i++) {
+		conn->cert_compression_algors[i] = ctx->cert_compression_algors[i];
+		conn->compressed_certs[i] = ctx->compressed_certs[i];
+		conn->compressed_certs_len[i] = ctx->compressed_certs_len[i];
+	}
+	conn->cert_compression_algors_cnt = ctx->cert_compression_algors_cnt;
+	conn->server_name_callback = ctx->server_name_callback;
+	conn->server_name_callback_arg = ctx->server_name_callback_arg;
+	conn->max_send_fragment = TLS_MAX_PLAINTEXT_SIZE;
+	conn->max_recv_fragment = TLS_MAX_PLAINTEXT_SIZE;
+	conn->record_size_limit = ctx->record_size_limit;
+	conn->max_fragment_length = ctx->max_fragment_length;
+	conn->dynamic_record_sizing = ctx->dynamic_record_sizing;
+	conn->read_ahead = ctx->read_ahead;
+	conn->ktls_requested = ctx->ktls;
+	if (ctx->key_method_set) {
+		conn->key_method = &ctx->key_method;
+	}
+	conn->handshake_guard = ctx->handshake_guard;
+
+	conn->quiet = ctx->quiet;
+
+	if (ctx->refs) {
+		conn->ctx = tls_ctx_up_ref((TLS_CTX *)ctx);
+	}
+	return 1;
 }
 
-int tls_ctx_set_tlcp_server_certificate_and_keys(TLS_CTX *ctx, const char *chainfile,
-	const char *signkeyfile, const char *signkeypass,
-	const char *kenckeyfile, const char *kenckeypass)
+void tls_cleanup(TLS_CONNECT *conn)
 {
-	int ret = -1;
-	uint8_t *certs = NULL;
-	size_t certslen;
-	FILE *signkeyfp = NULL;
-	FILE *kenckeyfp = NULL;
-	SM2_KEY signkey;
-	SM2_KEY kenckey;
-
-	const uint8_t *cert;
-	size_t certlen;
-	SM2_KEY public_key;
+	if (conn->hs.async_pending && conn->key_method && conn->key_method->cancel) {
+		conn->key_method->cancel(conn->key_method->arg, conn->hs.async_job);
+	}
+	tls_handshake_key_op_end(conn);
+	arena_cleanup(&conn->arena);
+	tls_buffer_put(conn->enced_record);
+	tls_buffer_put(conn->record);
+	tls_buffer_put(conn->databuf);
+	tls_buffer_put(conn->sendbuf);
+	tls_conn_readbuf_put(conn);
+	// only the chain of the peer is owned
+	if (conn->is_client) {
+		free(conn->server_certs);
+	} else {
+		free(conn->client_certs);
+	}
+	if (conn->early_data) {
+		gmssl_secure_clear(conn->early_data, conn->early_data_len);
+		free(conn->early_data);
+	}
+	if (conn->host_ctx) {
+		tls_ctx_free((TLS_CTX *)conn->host_ctx);
+	}
+	if (conn->ctx) {
+		tls_ctx_free((TLS_CTX *)conn->ctx);
+	}
+	gmssl_secure_clear(conn, sizeof(TLS_CONNECT));
+}
 
-	if (!ctx || !chainfile || !signkeyfile || !signkeypass || !kenckeyfile || !kenckeypass) {
+// client offers the session in the next TLS 1.3 handshake
+int tls_set_session(TLS_CONNECT *conn, const TLS_SESSION *session)
+{
+	if (!conn || !session) {
 		error_print();
 		return -1;
 	}
-	if (!tls_protocol_name(ctx->protocol)) {
+	if (!conn->is_client || session->protocol != conn->protocol) {
 		error_print();
 		return -1;
 	}
-	if (ctx->certs) {
-		error_print();
-		return -1;
+	if (conn->protocol == TLS_protocol_tls13) {
+		if (!session->ticketlen || session->ticketlen > sizeof(session->ticket)) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (!session->session_id_len || session->session_id_len > sizeof(session->session_id)) {
+			error_print();
+			return -1;
+		}
 	}
+	conn->session = *session;
+	return 1;
+}
 
-	if (x509_certs_new_from_file(&certs, &certslen, chainfile) != 1) {
+// return 0 if no ticket or session ID has been received
+int tls_get_session(const TLS_CONNECT *conn, TLS_SESSION *session)
+{
+	if (!conn || !session) {
 		error_print();
 		return -1;
 	}
-
-	if (!(signkeyfp = fopen(signkeyfile, "r"))) {
-		error_print();
-		goto end;
-	}
-	if (sm2_private_key_info_decrypt_from_pem(&signkey, signkeypass, signkeyfp) != 1) {
-		error_print();
-		goto end;
-	}
-	if (x509_certs_get_cert_by_index(certs, certslen, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
-		|| sm2_public_key_equ(&signkey, &public_key) != 1) {
-		error_print();
-		goto end;
+	if (!conn->session.ticketlen && !conn->session.session_id_len) {
+		return 0;
 	}
+	*session = conn->session;
+	return 1;
+}
 
-	if (!(kenckeyfp = fopen(kenckeyfile, "r"))) {
-		error_print();
-		goto end;
+int tls_session_reused(const TLS_CONNECT *conn)
+{
+	return conn->session_reused;
+}
+
+// TLCP/TLS 1.2 server, return 1 and restore the master secret if the ClientHello session is cached
+int tls_session_resume(TLS_CONNECT *conn, const uint8_t *session_id, size_t session_id_len)
+{
+	TLS_SESSION session;
+	int ret;
+
+	if (!conn->session_cache || !session_id_len) {
+		return 0;
 	}
-	if (sm2_private_key_info_decrypt_from_pem(&kenckey, kenckeypass, kenckeyfp) != 1) {
-		error_print();
-		goto end;
+	if ((ret = tls_session_cache_get(conn->session_cache, session_id, session_id_len, &session)) != 1) {
+		METRICS_ADD(METRICS_tls_session_cache_misses, 1);
+		return ret;
 	}
-	if (x509_certs_get_cert_by_index(certs, certslen, 1, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &public_key) != 1
-		|| sm2_public_key_equ(&kenckey, &public_key) != 1) {
-		error_print();
+	METRICS_ADD(METRICS_tls_session_cache_hits, 1);
+	if (session.protocol != conn->protocol || session.cipher_suite != conn->cipher_suite) {
+		ret = 0;
 		goto end;
 	}
-
-	ctx->certs = certs;
-	ctx->certslen = certslen;
-	ctx->signkey = signkey;
-	ctx->kenckey = kenckey;
-	certs = NULL;
+	memcpy(conn->session_id, session.session_id, session.session_id_len);
+	conn->session_id_len = session.session_id_len;
+	memcpy(conn->master_secret, session.master_secret, 48);
+	conn->session = session;
+	conn->session_reused = 1;
 	ret = 1;
-
 end:
-	gmssl_secure_clear(&signkey, sizeof(signkey));
-	gmssl_secure_clear(&kenckey, sizeof(kenckey));
-	if (certs) free(certs);
-	if (signkeyfp) fclose(signkeyfp);
-	if (kenckeyfp) fclose(kenckeyfp);
+	gmssl_secure_clear(&session, sizeof(session));
 	return ret;
 }
 
-int tls_init(TLS_CONNECT *conn, const TLS_CTX *ctx)
+// TLCP/TLS 1.2, keep the session of a full handshake, the server also adds it to the cache
+int tls_session_save(TLS_CONNECT *conn)
 {
-	size_t i;
-	memset(conn, 0, sizeof(*conn));
-
-	conn->protocol = ctx->protocol;
-	conn->is_client = ctx->is_client;
-	for (i = 0; i < ctx->cipher_suites_cnt; i++) {
-		conn->cipher_suites[i] = ctx->cipher_suites[i];
+	if (!conn->session_id_len) {
+		return 0;
+	}
+	gmssl_secure_clear(&conn->session, sizeof(TLS_SESSION));
+	conn->session.protocol = conn->protocol;
+	conn->session.cipher_suite = conn->cipher_suite;
+	memcpy(conn->session.session_id, conn->session_id, conn->session_id_len);
+	conn->session.session_id_len = conn->session_id_len;
+	memcpy(conn->session.master_secret, conn->master_secret, 48);
+	time(&conn->session.time);
+
+	if (!conn->is_client && conn->session_cache) {
+		if (tls_session_cache_add(conn->session_cache, &conn->session) != 1) {
+			error_print();
+			return -1;
+		}
 	}
-	conn->cipher_suites_cnt = ctx->cipher_suites_cnt;
+	return 1;
+}
 
+int tls_set_socket(TLS_CONNECT *conn, tls_socket_t sock)
+{
+	// non-blocking sockets are supported, see TLS_ERROR_WANT_READ
+	conn->sock = sock;
+	return tls_transport_init_socket(&conn->transport, sock);
+}
 
-	if (ctx->certslen > TLS_MAX_CERTIFICATES_SIZE) {
+int tls_set_transport(TLS_CONNECT *conn, const TLS_TRANSPORT *transport)
+{
+	if (!conn || !transport || !transport->send || !transport->recv) {
 		error_print();
 		return -1;
 	}
-	if (conn->is_client) {
-		memcpy(conn->client_certs, ctx->certs, ctx->certslen);
-		conn->client_certs_len = ctx->certslen;
-	} else {
-		memcpy(conn->server_certs, ctx->certs, ctx->certslen);
-		conn->server_certs_len = ctx->certslen;
-	}
+	conn->transport = *transport;
+	return 1;
+}
 
-	if (ctx->cacertslen > TLS_MAX_CERTIFICATES_SIZE) {
+int tls_set_handshake_stats(TLS_CONNECT *conn, TLS_HANDSHAKE_STATS *stats)
+{
+	if (!conn) {
 		error_print();
 		return -1;
 	}
-	memcpy(conn->ca_certs, ctx->cacerts, ctx->cacertslen);
-	conn->ca_certs_len = ctx->cacertslen;
-
-	conn->sign_key = ctx->signkey;
-	conn->kenc_key = ctx->kenckey;
+	conn->stats = stats;
+	return 1;
+}
 
-	conn->quiet = ctx->quiet;
+const char *tls_handshake_phase_name(int phase)
+{
+	switch (phase) {
+	case TLS_phase_key_exchange: return "key_exchange";
+	case TLS_phase_signature: return "signature";
+	case TLS_phase_certificate_verify: return "certificate_verify";
+	case TLS_phase_key_schedule: return "key_schedule";
+	}
+	return NULL;
+}
 
+int tls_handshake_key_op_begin(TLS_CONNECT *conn)
+{
+	if (!conn->handshake_guard || conn->hs.key_op_admitted) {
+		return 1;
+	}
+	if (tls_handshake_guard_admit(conn->handshake_guard) != 1) {
+		return 0;
+	}
+	conn->hs.key_op_admitted = 1;
 	return 1;
 }
 
-void tls_cleanup(TLS_CONNECT *conn)
+void tls_handshake_key_op_end(TLS_CONNECT *conn)
 {
-	gmssl_secure_clear(conn, sizeof(TLS_CONNECT));
+	if (conn->hs.key_op_admitted) {
+		tls_handshake_guard_release(conn->handshake_guard);
+		conn->hs.key_op_admitted = 0;
+	}
 }
 
-int tls_set_socket(TLS_CONNECT *conn, tls_socket_t sock)
+// the clock is only read when the connection has stats
+uint64_t tls_handshake_phase_begin(const TLS_CONNECT *conn)
 {
-	int flags;
-#ifdef WIN32
-    	if( ioctlsocket(sock, FIONBIO, &flags) != 0)   {
-		error_puts("socket in non-blocking mode");
-		//nginx will pass a socket in non-blocking mode
-		//return -1;
+	METRICS_PROBE1(tls_phase_begin, conn);
+#ifndef ENABLE_METRICS
+	if (!conn->stats) {
+		return 0;
 	}
-#else
-	if ((flags = fcntl(sock, F_GETFL)) == -1) {
-		error_print();
-		perror("fcntl error");
-		return -1;
+#endif
+	return metrics_nsec();
+}
+
+void tls_handshake_phase_end(TLS_CONNECT *conn, int phase, uint64_t begin)
+{
+	uint64_t nsec;
+
+#ifndef ENABLE_METRICS
+	if (!conn->stats) {
+		return;
+	}
+#endif
+	nsec = metrics_nsec() - begin;
+	if (conn->stats) {
+		conn->stats->nsec[phase] += nsec;
 	}
-	if (flags & O_NONBLOCK) {
-		error_puts("socket in non-blocking mode");
-		//nginx will pass a socket in non-blocking mode
-		//return -1;
+	METRICS_ADD(METRICS_tls_key_exchange_nsec + phase, nsec);
+	METRICS_PROBE3(tls_phase_end, conn, phase, nsec);
+}
+
+int tls_ecdhe_key_generate(TLS_CONNECT *conn, SM2_KEY *key)
+{
+#ifdef ENABLE_SM2_KEY_POOL
+	if (conn->ecdhe_key_pool) {
+		return sm2_key_pool_get(conn->ecdhe_key_pool, key);
 	}
 #endif
-	conn->sock = sock;
-	return 1;
+	return sm2_key_generate(key);
 }
 
 int tls_do_handshake(TLS_CONNECT *conn)
 {
+	int ret;
+
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
 	switch (conn->protocol) {
 	case TLS_protocol_tlcp:
-		if (conn->is_client) return tlcp_do_connect(conn);
-		else return tlcp_do_accept(conn);
+		ret = conn->is_client ? tlcp_do_connect(conn) : tlcp_do_accept(conn);
+		break;
 	case TLS_protocol_tls12:
-		if (conn->is_client) return tls12_do_connect(conn);
-		else return tls12_do_accept(conn);
+		ret = conn->is_client ? tls12_do_connect(conn) : tls12_do_accept(conn);
+		break;
 	case TLS_protocol_tls13:
-		if (conn->is_client) return tls13_do_connect(conn);
-		else return tls13_do_accept(conn);
+		if (!conn->enced_record && !(conn->enced_record = tls_buffer_get())) {
+			error_print();
+			return -1;
+		}
+		ret = conn->is_client ? tls13_do_connect(conn) : tls13_do_accept(conn);
+		break;
+	default:
+		error_print();
+		ret = -1;
 	}
-	error_print();
-	return -1;
+	tls_conn_buffers_put(conn);
+
+	if (ret == 1) {
+#ifdef ENABLE_METRICS
+		int id = conn->protocol == TLS_protocol_tlcp ? METRICS_tlcp_full_handshakes
+			: conn->protocol == TLS_protocol_tls12 ? METRICS_tls12_full_handshakes
+			: METRICS_tls13_full_handshakes;
+		METRICS_ADD(id + (conn->session_reused ? 1 : 0), 1);
+#endif
+		METRICS_PROBE3(tls_handshake_done, conn, conn->protocol, conn->session_reused);
+	} else if (ret == -1) {
+		METRICS_ADD(METRICS_tls_handshake_failures, 1);
+		METRICS_PROBE2(tls_handshake_failed, conn, conn->protocol);
+	}
+	return ret;
+}
+
+int tls_ktls_enabled(const TLS_CONNECT *conn)
+{
+	return conn->ktls;
 }
 
 int tls_get_verify_result(TLS_CONNECT *conn, int *result)
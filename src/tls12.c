@@ -189,7 +189,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	const uint8_t *session_id;
 	size_t session_id_len;
 
-	uint8_t client_exts[TLS_MAX_EXTENSIONS_SIZE];
+	uint8_t *client_exts;
 	size_t client_exts_len = 0;
 	const uint8_t *server_exts;
 	size_t server_exts_len;
@@ -205,6 +205,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	const uint8_t *sig;
 	size_t siglen;
 	uint8_t pre_master_secret[48];
+	sm2_z256_t ecdhe_x;
 	SM3_CTX sm3_ctx;
 	SM3_CTX tmp_sm3_ctx;
 	uint8_t sm3_hash[32];
@@ -220,6 +221,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	int depth = 5;
 	int alert = 0;
 	int verify_result;
+	uint64_t phase_time;
 
 
 	// 初始化记录缓冲
@@ -229,7 +231,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	// 准备Finished Context（和ClientVerify）
 	sm3_init(&sm3_ctx);
 	if (conn->client_certs_len)
-		sm2_sign_init(&sign_ctx, &conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH);
+		sm2_sign_init(&sign_ctx, conn->sign_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH);
 
 
 	// send ClientHello
@@ -242,6 +244,10 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	size_t signature_algors_cnt = 1;
 
 
+	if (!(client_exts = (uint8_t *)arena_alloc(&conn->arena, TLS_MAX_EXTENSIONS_SIZE))) {
+		error_print();
+		goto end;
+	}
 	p = client_exts;
 	client_exts_len = 0;
 
@@ -250,7 +256,8 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	tls_signature_algorithms_ext_to_bytes(signature_algors, signature_algors_cnt, &p, &client_exts_len);
 
 	if (tls_record_set_handshake_client_hello(record, &recordlen,
-		conn->protocol, client_random, NULL, 0,
+		conn->protocol, client_random,
+		conn->session.session_id_len ? conn->session.session_id : NULL, conn->session.session_id_len,
 		tls12_ciphers, tls12_ciphers_count,
 		client_exts, client_exts_len) != 1) {
 		error_print();
@@ -258,7 +265,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	}
 	tls_trace("send ClientHello\n");
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -268,7 +275,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 
 	// recv ServerHello
 	tls_trace("recv ServerHello\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
+	if (tls_conn_record_read(conn, record, &recordlen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -312,14 +319,42 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	}
 	memcpy(server_random, random, 32);
 	memcpy(conn->session_id, session_id, session_id_len);
+	conn->session_id_len = session_id_len;
 	conn->cipher_suite = cipher_suite;
 	sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 	if (conn->client_certs_len)
 		sm2_sign_update(&sign_ctx, record + 5, recordlen - 5);
 
+	// the server echoes the offered session ID to resume it
+	if (session_id_len && session_id_len == conn->session.session_id_len
+		&& memcmp(session_id, conn->session.session_id, session_id_len) == 0) {
+		if (cipher_suite != conn->session.cipher_suite) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_illegal_parameter);
+			goto end;
+		}
+		tls_trace("resume session\n");
+		memcpy(conn->master_secret, conn->session.master_secret, 48);
+		phase_time = tls_handshake_phase_begin(conn);
+		if (tls_prf(conn->master_secret, 48, "key expansion",
+			server_random, 32, client_random, 32,
+			96, conn->key_block) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
+		sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
+		sm4_set_encrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
+		sm4_set_decrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
+		conn->session_reused = 1;
+		goto recv_change_cipher_spec;
+	}
+
 	// recv ServerCertificate
 	tls_trace("recv ServerCertificate\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -327,7 +362,8 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
 
-	if (tls_record_get_handshake_certificate(record,
+	if (tls_conn_certs_reserve(&conn->server_certs, recordlen) != 1
+		|| tls_record_get_handshake_certificate(record,
 		conn->server_certs, &conn->server_certs_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -338,16 +374,18 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		sm2_sign_update(&sign_ctx, record + 5, recordlen - 5);
 
 	// verify ServerCertificate
-	if (x509_certs_verify(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-		conn->ca_certs, conn->ca_certs_len, depth, &verify_result) != 1) {
+	phase_time = tls_handshake_phase_begin(conn);
+	if (x509_certs_verify_ex(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
+		conn->ca_certs, conn->ca_certs_len, conn->ca_store, depth, &verify_result) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
 
 	// recv ServerKeyExchange
 	tls_trace("recv ServerKeyExchange\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -378,15 +416,17 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
 	}
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_verify_server_ecdh_params(&server_sign_key, // 这应该是签名公钥
 		client_random, server_random, curve, &server_ecdhe_public, sig, siglen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 
 	// recv CertificateRequest or ServerHelloDone
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol
 		|| tls_record_get_handshake(record, &handshake_type, &cp, &len) != 1) {
 		error_print();
@@ -423,7 +463,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		sm2_sign_update(&sign_ctx, record + 5, recordlen - 5);
 
 		// recv ServerHelloDone
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
+		if (tls_conn_record_read(conn, record, &recordlen) != 1
 			|| tls_record_protocol(record) != conn->protocol) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -432,7 +472,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	} else {
 		// 这个得处理一下
 		conn->client_certs_len = 0;
-		gmssl_secure_clear(&conn->sign_key, sizeof(SM2_KEY));
+		conn->sign_key = NULL;
 	}
 	tls_trace("recv ServerHelloDone\n");
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
@@ -448,13 +488,13 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	// send ClientCertificate
 	if (conn->client_certs_len) {
 		tls_trace("send ClientCertificate\n");
-		if (tls_record_set_handshake_certificate(record, &recordlen, conn->client_certs, conn->client_certs_len) != 1) {
+		if (tls_conn_set_handshake_certificate(conn, record, &recordlen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
 		tls12_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_write(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
@@ -465,11 +505,19 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	// generate MASTER_SECRET
 	tls_trace("generate secrets\n");
 	SM2_KEY client_ecdh;
-	sm2_key_generate(&client_ecdh);
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_ecdhe_key_generate(conn, &client_ecdh) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
 	sm2_do_ecdh(&client_ecdh, &server_ecdhe_public, &server_ecdhe_public);
-	memcpy(pre_master_secret, &server_ecdhe_public, 32); // 这个做法很不优雅
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	sm2_z256_point_get_xy(&server_ecdhe_public, ecdhe_x, NULL);
+	sm2_z256_to_bytes(ecdhe_x, pre_master_secret); // the x-coordinate of the shared point
 	// ECDHE和ECC的PMS结构是不一样的吗？
 
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(pre_master_secret, 32, "master secret",
 			client_random, 32, server_random, 32,
 			48, conn->master_secret) != 1
@@ -480,6 +528,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
 	sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
 	sm4_set_encrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
@@ -501,7 +550,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -513,20 +562,23 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	if (conn->client_certs_len) {
 		tls_trace("send CertificateVerify\n");
 		uint8_t sigbuf[SM2_MAX_SIGNATURE_SIZE];
+		phase_time = tls_handshake_phase_begin(conn);
 		if (sm2_sign_finish(&sign_ctx, sigbuf, &siglen) != 1
 			|| tls_record_set_handshake_certificate_verify(record, &recordlen, sigbuf, siglen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 		tls12_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_write(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
 		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 	}
 
+send_change_cipher_spec:
 	// send [ChangeCipherSpec]
 	tls_trace("send [ChangeCipherSpec]\n");
 	if (tls_record_set_change_cipher_spec(record, &recordlen) !=1) {
@@ -535,7 +587,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -544,6 +596,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	tls_trace("send Finished\n");
 	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(sm3_ctx));
 	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "client finished",
 			sm3_hash, 32, NULL, 0, sizeof(local_verify_data), local_verify_data) != 1
 		|| tls_record_set_handshake_finished(finished_record, &finished_record_len,
@@ -552,6 +605,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	tls12_record_trace(stderr, finished_record, finished_record_len, 0, 0);
 	sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
 
@@ -565,14 +619,19 @@ int tls12_do_connect(TLS_CONNECT *conn)
 	}
 	tls12_record_trace(stderr, record, recordlen, (1<<24), 0); // 强制打印密文原数据
 	tls_seq_num_incr(conn->client_seq_num);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
+	if (conn->session_reused) {
+		// the abbreviated handshake ends with the client Finished
+		goto established;
+	}
 
+recv_change_cipher_spec:
 	// [ChangeCipherSpec]
 	tls_trace("recv [ChangeCipherSpec]\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -587,7 +646,7 @@ int tls12_do_connect(TLS_CONNECT *conn)
 
 	// Finished
 	tls_trace("recv Finished\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -618,28 +677,44 @@ int tls12_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	sm3_finish(&sm3_ctx, sm3_hash);
+	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(sm3_ctx));
+	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "server finished",
 		sm3_hash, 32, NULL, 0, sizeof(local_verify_data), local_verify_data) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (memcmp(verify_data, local_verify_data, sizeof(local_verify_data)) != 0) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
+	if (conn->session_reused) {
+		// client Finished covers the server Finished
+		sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
+		goto send_change_cipher_spec;
+	}
+	if (tls_session_save(conn) < 0) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
 
+established:
+	if (tls_conn_record_flush(conn) != 1) {
+		error_print();
+		goto end;
+	}
 	if (!conn->quiet)
 		fprintf(stderr, "Connection established!\n");
 
-	conn->protocol = conn->protocol;
-	conn->cipher_suite = cipher_suite;
-
 	ret = 1;
 
 end:
+	arena_cleanup(&conn->arena);
 	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
 	gmssl_secure_clear(pre_master_secret, sizeof(pre_master_secret));
 	return ret;
@@ -663,14 +738,14 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	uint8_t server_random[32];
 	int protocol;
 	const uint8_t *random;
-	const uint8_t *session_id; // TLCP服务器忽略客户端SessionID，也不主动设置SessionID
+	const uint8_t *session_id; // 设置了会话缓存时才恢复或分配SessionID
 	size_t session_id_len;
 	const uint8_t *client_ciphers;
 	size_t client_ciphers_len;
 	const uint8_t *client_exts;
 	size_t client_exts_len;
-	uint8_t server_exts[TLS_MAX_EXTENSIONS_SIZE];
-	size_t server_exts_len;
+	uint8_t *server_exts = NULL;
+	size_t server_exts_len = 0;
 	int curve = TLS_curve_sm2p256v1; // 这个是否应该在conn中设置？		
 
 	// ServerKeyExchange
@@ -685,10 +760,12 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	const uint8_t *sig;
 	const int verify_depth = 5;
 	int verify_result;
+	uint64_t phase_time;
 
 	// ClientKeyExchange
 	SM2_Z256_POINT client_ecdhe_point;
 	uint8_t pre_master_secret[SM2_MAX_PLAINTEXT_SIZE]; // sm2_decrypt 保证输出不会溢出
+	sm2_z256_t ecdhe_x;
 
 	// Finished
 	SM3_CTX sm3_ctx;
@@ -714,7 +791,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	// recv ClientHello
 	tls_trace("recv ClientHello\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
+	if (tls_conn_record_read(conn, record, &recordlen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
@@ -748,10 +825,15 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		goto end;
 	}
 	if (client_exts) {
+		if (!(server_exts = (uint8_t *)arena_alloc(&conn->arena, TLS_MAX_EXTENSIONS_SIZE))) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
 		server_exts_len = 0;
 		curve = TLS_curve_sm2p256v1;
 
-		tls_process_client_hello_exts(client_exts, client_exts_len, server_exts, &server_exts_len, sizeof(server_exts));
+		tls_process_client_hello_exts(client_exts, client_exts_len, server_exts, &server_exts_len, TLS_MAX_EXTENSIONS_SIZE);
 
 
 
@@ -760,20 +842,37 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	if (client_verify)
 		tls_client_verify_update(&client_verify_ctx, record + 5, recordlen - 5);
 
+	// resume the cached session, client authentication always needs a full handshake
+	if (!client_verify) {
+		if (tls_session_resume(conn, session_id, session_id_len) < 0) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+	}
+	if (!conn->session_reused && conn->session_cache) {
+		if (rand_bytes(conn->session_id, 32) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		conn->session_id_len = 32;
+	}
 
 	// send ServerHello
 	tls_trace("send ServerHello\n");
 	tls_random_generate(server_random);
 	tls_record_set_protocol(record, conn->protocol);
 	if (tls_record_set_handshake_server_hello(record, &recordlen,
-		conn->protocol, server_random, NULL, 0,
+		conn->protocol, server_random,
+		conn->session_id_len ? conn->session_id : NULL, conn->session_id_len,
 		conn->cipher_suite, server_exts, server_exts_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -781,16 +880,33 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	if (client_verify)
 		tls_client_verify_update(&client_verify_ctx, record + 5, recordlen - 5);
 
+	if (conn->session_reused) {
+		tls_trace("resume session\n");
+		phase_time = tls_handshake_phase_begin(conn);
+		if (tls_prf(conn->master_secret, 48, "key expansion",
+			server_random, 32, client_random, 32,
+			96, conn->key_block) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
+		sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
+		sm4_set_decrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
+		sm4_set_encrypt_key(&conn->server_write_enc_key, conn->key_block + 80);
+		goto send_change_cipher_spec;
+	}
+
 	// send ServerCertificate
 	tls_trace("send ServerCertificate\n");
-	if (tls_record_set_handshake_certificate(record, &recordlen,
-		conn->server_certs, conn->server_certs_len) != 1) {
+	if (tls_conn_set_handshake_certificate(conn, record, &recordlen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -800,14 +916,22 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	// send ServerKeyExchange
 	tls_trace("send ServerKeyExchange\n");
-	sm2_key_generate(&server_ecdhe_key);
-	if (tls_sign_server_ecdh_params(&conn->sign_key,
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_ecdhe_key_generate(conn, &server_ecdhe_key) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_sign_server_ecdh_params(conn->sign_key,
 		client_random, server_random, TLS_curve_sm2p256v1, &server_ecdhe_key.public_key,
 		sigbuf, &siglen) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		return -1;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 	if (tls_record_set_handshake_server_key_exchange_ecdhe(record, &recordlen,
 		curve, &server_ecdhe_key.public_key, sigbuf, siglen) != 1) {
 		error_print();
@@ -815,7 +939,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -825,24 +949,13 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	// send CertificateRequest
 	if (client_verify) {
-		const uint8_t cert_types[] = { TLS_cert_type_ecdsa_sign };
-		uint8_t ca_names[TLS_MAX_CA_NAMES_SIZE] = {0}; // TODO: 根据客户端验证CA证书列计算缓冲大小，或直接输出到record缓冲
-		size_t ca_names_len = 0;
-
 		tls_trace("send CertificateRequest\n");
-		if (tls_authorities_from_certs(ca_names, &ca_names_len, sizeof(ca_names),
-			conn->ca_certs, conn->ca_certs_len) != 1) {
-			error_print();
-			goto end;
-		}
-		if (tls_record_set_handshake_certificate_request(record, &recordlen,
-			cert_types, sizeof(cert_types),
-			ca_names, ca_names_len) != 1) {
+		if (tls_conn_set_handshake_certificate_request(conn, record, &recordlen) != 1) {
 			error_print();
 			goto end;
 		}
 		tls12_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_send(record, recordlen, conn->sock) != 1) {
+		if (tls_conn_record_write(conn, record, recordlen) != 1) {
 			error_print();
 			goto end;
 		}
@@ -854,7 +967,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	tls_trace("send ServerHelloDone\n");
 	tls_record_set_handshake_server_hello_done(record, &recordlen);
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -865,31 +978,34 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	// recv ClientCertificate
 	if (conn->ca_certs_len) {
 		tls_trace("recv ClientCertificate\n");
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
+		if (tls_conn_record_read(conn, record, &recordlen) != 1
 			|| tls_record_protocol(record) != conn->protocol) { // protocol检查应该在trace之后
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
 		tls12_record_trace(stderr, record, recordlen, 0, 0);
-		if (tls_record_get_handshake_certificate(record, conn->client_certs, &conn->client_certs_len) != 1) {
+		if (tls_conn_certs_reserve(&conn->client_certs, recordlen) != 1
+			|| tls_record_get_handshake_certificate(record, conn->client_certs, &conn->client_certs_len) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, verify_depth, &verify_result) != 1) {
+		phase_time = tls_handshake_phase_begin(conn);
+		if (x509_certs_verify_ex(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
+			conn->ca_certs, conn->ca_certs_len, conn->ca_store, verify_depth, &verify_result) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
 		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 		tls_client_verify_update(&client_verify_ctx, record + 5, recordlen - 5);
 	}
 
 	// recv ClientKeyExchange
 	tls_trace("recv ClientKeyExchange\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -909,7 +1025,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	// recv CertificateVerify
 	if (client_verify) {
 		tls_trace("recv CertificateVerify\n");
-		if (tls_record_recv(record, &recordlen, conn->sock) != 1
+		if (tls_conn_record_read(conn, record, &recordlen) != 1
 			|| tls_record_protocol(record) != conn->protocol) {
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			error_print();
@@ -927,24 +1043,31 @@ int tls12_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
 		}
+		phase_time = tls_handshake_phase_begin(conn);
 		if (tls_client_verify_finish(&client_verify_ctx, sig, siglen, &client_sign_key) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_decrypt_error);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 		sm3_update(&sm3_ctx, record + 5, recordlen - 5);
 	}
 
 	// generate secrets
 	tls_trace("generate secrets\n");
+	phase_time = tls_handshake_phase_begin(conn);
 	sm2_do_ecdh(&server_ecdhe_key, &client_ecdhe_point, &client_ecdhe_point);
-	memcpy(pre_master_secret, (uint8_t *)&client_ecdhe_point, 32); // 这里应该修改一下表示方式，比如get_xy()
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	sm2_z256_point_get_xy(&client_ecdhe_point, ecdhe_x, NULL);
+	sm2_z256_to_bytes(ecdhe_x, pre_master_secret); // the x-coordinate of the shared point
+	phase_time = tls_handshake_phase_begin(conn);
 	tls_prf(pre_master_secret, 32, "master secret",
 		client_random, 32, server_random, 32,
 		48, conn->master_secret);
 	tls_prf(conn->master_secret, 48, "key expansion",
 		server_random, 32, client_random, 32,
 		96, conn->key_block);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	sm3_hmac_init(&conn->client_write_mac_ctx, conn->key_block, 32);
 	sm3_hmac_init(&conn->server_write_mac_ctx, conn->key_block + 32, 32);
 	sm4_set_decrypt_key(&conn->client_write_enc_key, conn->key_block + 64);
@@ -954,9 +1077,10 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		conn->master_secret, conn->key_block, 96, 0, 4);
 	*/
 
+recv_change_cipher_spec:
 	// recv [ChangeCipherSpec]
 	tls_trace("recv [ChangeCipherSpec]\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -971,7 +1095,7 @@ int tls12_do_accept(TLS_CONNECT *conn)
 
 	// recv ClientFinished
 	tls_trace("recv Finished\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1
+	if (tls_conn_record_read(conn, record, &recordlen) != 1
 		|| tls_record_protocol(record) != conn->protocol) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
@@ -1009,18 +1133,24 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(SM3_CTX));
 	sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
 	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "client finished", sm3_hash, 32, NULL, 0,
 		sizeof(local_verify_data), local_verify_data) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (memcmp(verify_data, local_verify_data, sizeof(local_verify_data)) != 0) {
 		error_puts("client_finished.verify_data verification failure");
 		tls_send_alert(conn, TLS_alert_decrypt_error);
 		goto end;
 	}
+	if (conn->session_reused) {
+		goto established;
+	}
 
+send_change_cipher_spec:
 	// send [ChangeCipherSpec]
 	tls_trace("send [ChangeCipherSpec]\n");
 	if (tls_record_set_change_cipher_spec(record, &recordlen) != 1) {
@@ -1029,14 +1159,17 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls12_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
 
 	// send ServerFinished
 	tls_trace("send Finished\n");
-	sm3_finish(&sm3_ctx, sm3_hash);
+	tls_record_set_protocol(finished_record, conn->protocol);
+	memcpy(&tmp_sm3_ctx, &sm3_ctx, sizeof(SM3_CTX));
+	sm3_finish(&tmp_sm3_ctx, sm3_hash);
+	phase_time = tls_handshake_phase_begin(conn);
 	if (tls_prf(conn->master_secret, 48, "server finished", sm3_hash, 32, NULL, 0,
 			sizeof(local_verify_data), local_verify_data) != 1
 		|| tls_record_set_handshake_finished(finished_record, &finished_record_len,
@@ -1045,7 +1178,9 @@ int tls12_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	tls12_record_trace(stderr, finished_record, finished_record_len, 0, 0);
+	sm3_update(&sm3_ctx, finished_record + 5, finished_record_len - 5);
 	if (tls_record_encrypt(&conn->server_write_mac_ctx, &conn->server_write_enc_key,
 		conn->server_seq_num, finished_record, finished_record_len, record, &recordlen) != 1) {
 		error_print();
@@ -1055,19 +1190,32 @@ int tls12_do_accept(TLS_CONNECT *conn)
 	tls_trace("encrypt Finished\n");
 	tls12_record_trace(stderr, record, recordlen, (1<<24), 0); // 强制打印密文原数据
 	tls_seq_num_incr(conn->server_seq_num);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_write(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
+	if (conn->session_reused) {
+		// the abbreviated handshake ends with the client Finished
+		goto recv_change_cipher_spec;
+	}
+	if (tls_session_save(conn) < 0) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
 
-	conn->protocol = conn->protocol;
-
+established:
+	if (tls_conn_record_flush(conn) != 1) {
+		error_print();
+		goto end;
+	}
 	if (!conn->quiet)
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
 
 end:
+	arena_cleanup(&conn->arena);
 	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
 	gmssl_secure_clear(pre_master_secret, sizeof(pre_master_secret));
 	if (client_verify) tls_client_verify_cleanup(&client_verify_ctx);
@@ -21,12 +21,19 @@
 #include <gmssl/sm4.h>
 #include <gmssl/pem.h>
 #include <gmssl/tls.h>
+#include <gmssl/metrics.h>
 #include <gmssl/digest.h>
 #include <gmssl/hmac.h>
 #include <gmssl/hkdf.h>
 #include <gmssl/mem.h>
+#include <gmssl/endian.h>
 
-static const int tls13_ciphers[] = { TLS_cipher_sm4_gcm_sm3 };
+static const int tls13_ciphers[] = {
+	TLS_cipher_sm4_gcm_sm3,
+#if defined(ENABLE_CHACHA20) && defined(ENABLE_SHA2)
+	TLS_cipher_chacha20_poly1305_sha256,
+#endif
+};
 static size_t tls13_ciphers_count = sizeof(tls13_ciphers)/sizeof(int);
 
 /*
@@ -44,24 +51,15 @@ static int tls13_client_hello_exts[] = {
 	TLS_extension_padding,
 };
 
-// FIXME: remove block_cipher.h
+/*
+ * The AEAD of the negotiated suite is bound to the key by its BLOCK_CIPHER when
+ * the traffic keys are set, every record makes a single indirect call.
+ */
 int gcm_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	uint8_t *out, size_t taglen, uint8_t *tag)
 {
-	if (key->cipher == BLOCK_CIPHER_sm4()) {
-		if (sm4_gcm_encrypt(&(key->u.sm4_key), iv, ivlen, aad, aadlen,  in, inlen, out, taglen, tag) != 1) {
-			error_print();
-			return -1;
-		}
-#ifdef ENABLE_AES
-	} else if (key->cipher == BLOCK_CIPHER_aes128()) {
-		if (aes_gcm_encrypt(&(key->u.aes_key), iv, ivlen, aad, aadlen,  in, inlen, out, taglen, tag) != 1) {
-			error_print();
-			return -1;
-		}
-#endif
-	} else {
+	if (!key->cipher || key->cipher->aead_encrypt(key, iv, ivlen, aad, aadlen, in, inlen, out, taglen, tag) != 1) {
 		error_print();
 		return -1;
 	}
@@ -72,19 +70,7 @@ int gcm_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t *iv, size_t ivlen,
 	const uint8_t *aad, size_t aadlen, const uint8_t *in, size_t inlen,
 	const uint8_t *tag, size_t taglen, uint8_t *out)
 {
-	if (key->cipher == BLOCK_CIPHER_sm4()) {
-		if (sm4_gcm_decrypt(&(key->u.sm4_key), iv, ivlen, aad, aadlen,  in, inlen, tag, taglen, out) != 1) {
-			error_print();
-			return -1;
-		}
-#ifdef ENABLE_AES
-	} else if (key->cipher == BLOCK_CIPHER_aes128()) {
-		if (aes_gcm_decrypt(&(key->u.aes_key), iv, ivlen, aad, aadlen,  in, inlen, tag, taglen, out) != 1) {
-			error_print();
-			return -1;
-		}
-#endif
-	} else {
+	if (!key->cipher || key->cipher->aead_decrypt(key, iv, ivlen, aad, aadlen, in, inlen, tag, taglen, out) != 1) {
 		error_print();
 		return -1;
 	}
@@ -114,23 +100,21 @@ int tls13_gcm_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	uint8_t nonce[12];
 	uint8_t aad[5];
 	uint8_t *gmac;
-	uint8_t *mbuf = NULL; // FIXME: update gcm_encrypt API
 	size_t mlen, clen;
 
-	if (!(mbuf = malloc(inlen + 256))) {
-		error_print();
-		return -1;
-	}
-
 	// nonce = (zeros|seq_num) xor (iv)
 	nonce[0] = nonce[1] = nonce[2] = nonce[3] = 0;
 	memcpy(nonce + 4, seq_num, 8);
 	gmssl_memxor(nonce, nonce, iv, 12);
 
-	// TLSInnerPlaintext
-	memcpy(mbuf, in, inlen);
-	mbuf[inlen] = record_type;
-	memset(mbuf + inlen + 1, 0, padding_len);
+	METRICS_ADD(METRICS_tls_sm4_gcm_encrypt_bytes, inlen);
+
+	// TLSInnerPlaintext is built in `out` and encrypted in place
+	if (out != in) {
+		memmove(out, in, inlen);
+	}
+	out[inlen] = record_type;
+	memset(out + inlen + 1, 0, padding_len);
 	mlen = inlen + 1 + padding_len;
 	clen = mlen + GHASH_SIZE;
 
@@ -142,14 +126,11 @@ int tls13_gcm_encrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	aad[4] = (uint8_t)(clen);
 
 	gmac = out + mlen;
-	if (gcm_encrypt(key, nonce, sizeof(nonce), aad, sizeof(aad), mbuf, mlen, out, 16, gmac) != 1) {
+	if (gcm_encrypt(key, nonce, sizeof(nonce), aad, sizeof(aad), out, mlen, out, 16, gmac) != 1) {
 		error_print();
-		free(mbuf);
 		return -1;
 	}
 	*outlen = clen;
-	free(mbuf);
-
 	return 1;
 }
 
@@ -180,6 +161,7 @@ int tls13_gcm_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	}
 	mlen = inlen - GHASH_SIZE;
 	gmac = in + mlen;
+	METRICS_ADD(METRICS_tls_sm4_gcm_decrypt_bytes, inlen);
 
 	if (gcm_decrypt(key, nonce, 12, aad, 5, in, mlen, gmac, GHASH_SIZE, out) != 1) {
 		error_print();
@@ -247,15 +229,221 @@ int tls13_record_decrypt(const BLOCK_CIPHER_KEY *key, const uint8_t iv[12],
 	return 1;
 }
 
-int tls13_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen)
+/*
+KeyUpdate
+
+  enum {
+	update_not_requested(0), update_requested(1), (255)
+  } KeyUpdateRequest;
+
+  struct {
+	KeyUpdateRequest request_update;
+  } KeyUpdate;
+
+  application_traffic_secret_N+1 =
+	HKDF-Expand-Label(application_traffic_secret_N, "traffic upd", "", Hash.length)
+*/
+
+int tls13_record_set_handshake_key_update(uint8_t *record, size_t *recordlen, int request_update)
+{
+	uint8_t data[1];
+
+	if (!record || !recordlen) {
+		error_print();
+		return -1;
+	}
+	if (request_update != TLS_key_update_not_requested
+		&& request_update != TLS_key_update_requested) {
+		error_print();
+		return -1;
+	}
+	data[0] = (uint8_t)request_update;
+	tls_record_set_protocol(record, TLS_protocol_tls12);
+	if (tls_record_set_handshake(record, recordlen, TLS_handshake_key_update, data, sizeof(data)) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_record_get_handshake_key_update(const uint8_t *record, int *request_update)
+{
+	int type;
+	const uint8_t *p;
+	size_t len;
+	uint8_t val;
+
+	if (tls_record_get_handshake(record, &type, &p, &len) != 1
+		|| type != TLS_handshake_key_update) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint8_from_bytes(&val, &p, &len) != 1
+		|| tls_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (val != TLS_key_update_not_requested && val != TLS_key_update_requested) {
+		error_print();
+		return -1;
+	}
+	*request_update = val;
+	return 1;
+}
+
+// ratchet the client or the server application traffic secret, reset its sequence number
+static int tls13_update_traffic_key(TLS_CONNECT *conn, int client)
+{
+	const DIGEST *digest;
+	const BLOCK_CIPHER *cipher;
+	uint8_t *secret;
+	BLOCK_CIPHER_KEY *key;
+	uint8_t *iv;
+	uint8_t *seq_num;
+	uint8_t next_secret[32];
+	uint8_t write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
+
+	if (tls13_cipher_suite_get(conn->cipher_suite, &digest, &cipher) != 1) {
+		error_print();
+		return -1;
+	}
+	if (client) {
+		secret = conn->client_application_traffic_secret;
+		key = &conn->client_write_key;
+		iv = conn->client_write_iv;
+		seq_num = conn->client_seq_num;
+	} else {
+		secret = conn->server_application_traffic_secret;
+		key = &conn->server_write_key;
+		iv = conn->server_write_iv;
+		seq_num = conn->server_seq_num;
+	}
+	if (tls13_hkdf_expand_label(digest, secret, "traffic upd", NULL, 0, 32, next_secret) != 1
+		|| tls13_hkdf_expand_key_iv(digest, next_secret, cipher->key_size, write_key, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(secret, next_secret, 32);
+	block_cipher_set_encrypt_key(key, cipher, write_key);
+	memset(seq_num, 0, 8);
+
+	gmssl_secure_clear(next_secret, sizeof(next_secret));
+	gmssl_secure_clear(write_key, sizeof(write_key));
+	return 1;
+}
+
+// the KeyUpdate is sealed under the old key into sendbuf, then the sending key is updated
+static int tls13_queue_key_update(TLS_CONNECT *conn, int request_update)
+{
+	uint8_t record[TLS_RECORD_HEADER_SIZE + TLS_HANDSHAKE_HEADER_SIZE + 1];
+	size_t recordlen;
+	uint8_t *enced_record;
+	size_t enced_recordlen;
+	int ret = -1;
+
+	if (conn->ktls) {
+		error_puts("KeyUpdate is not supported with kTLS");
+		return -1;
+	}
+	tls_trace("send {KeyUpdate}\n");
+	if (tls13_record_set_handshake_key_update(record, &recordlen, request_update) != 1
+		|| !(enced_record = tls_conn_record_reserve(conn, recordlen + TLS13_GCM_TAILROOM))) {
+		error_print();
+		return -1;
+	}
+	tls13_record_trace(stderr, record, recordlen, 0, 0);
+	if (conn->is_client) {
+		ret = tls13_record_encrypt(&conn->client_write_key, conn->client_write_iv,
+			conn->client_seq_num, record, recordlen, 0, enced_record, &enced_recordlen);
+	} else {
+		ret = tls13_record_encrypt(&conn->server_write_key, conn->server_write_iv,
+			conn->server_seq_num, record, recordlen, 0, enced_record, &enced_recordlen);
+	}
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	conn->sendbuf_len += enced_recordlen;
+	if (tls13_update_traffic_key(conn, conn->is_client) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_key_update(TLS_CONNECT *conn, int request_update)
+{
+	int ret;
+
+	if (!conn) {
+		error_print();
+		return -1;
+	}
+	if (conn->protocol != TLS_protocol_tls13 || !conn->cipher_suite
+		|| conn->hs.state != TLS_state_client_hello) {
+		error_puts("KeyUpdate is sent by a TLS 1.3 connection after the handshake");
+		return -1;
+	}
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((ret = tls13_queue_key_update(conn, request_update)) == 1) {
+		if ((ret = tls_flush(conn)) != 1 && ret != TLS_ERROR_WANT_WRITE) {
+			error_print();
+		}
+	}
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
+// the sending key is updated well before the GCM limit, a few records of one call may follow
+static int tls13_key_update_if_needed(TLS_CONNECT *conn)
+{
+	const uint8_t *seq_num = conn->is_client ? conn->client_seq_num : conn->server_seq_num;
+
+	if (GETU64(seq_num) < TLS13_KEY_UPDATE_RECORDS || conn->ktls) {
+		return 1;
+	}
+	if (TLS_MAX_RECORD_SIZE - (conn->sendbuf_len - conn->sendbuf_offset)
+		< TLS_RECORD_HEADER_SIZE + TLS_HANDSHAKE_HEADER_SIZE + 1 + TLS13_GCM_TAILROOM) {
+		// retried when the queued records are sent
+		return 1;
+	}
+	if (tls13_queue_key_update(conn, TLS_key_update_not_requested) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int tls13_conn_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen)
 {
+	int ret;
 	const BLOCK_CIPHER_KEY *key;
 	const uint8_t *iv;
 	uint8_t *seq_num;
-	uint8_t *record = conn->record;
+	uint8_t *record;
 	size_t recordlen;
 	size_t padding_len = 0; //FIXME: 在conn中设置是否加随机填充，及设置该值
 
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the record was queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		return 1;
+	}
+
+	if (tls13_key_update_if_needed(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	datalen = tls_send_fragment_size(conn, datalen);
+
 	tls_trace("send {ApplicationData}\n");
 
 	if (conn->is_client) {
@@ -268,6 +456,12 @@ int tls13_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *s
 		seq_num = conn->server_seq_num;
 	}
 
+	// encrypted in sendbuf, the data is copied only once
+	if (!(record = tls_conn_record_reserve(conn,
+		TLS_RECORD_HEADER_SIZE + datalen + padding_len + TLS13_GCM_TAILROOM))) {
+		error_print();
+		return -1;
+	}
 	if (tls13_gcm_encrypt(key, iv,
 		seq_num, TLS_record_application_data, data, datalen, padding_len,
 		record + 5, &recordlen) != 1) {
@@ -282,16 +476,45 @@ int tls13_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *s
 	record[4] = (uint8_t)(recordlen);
 	recordlen += 5;
 
-	tls_record_send(record, recordlen, conn->sock);
+	conn->sendbuf_len += recordlen;
 	tls_record_trace(stderr, record, tls_record_length(record), 0, 0);
 
 	tls_seq_num_incr(seq_num);
 
 	*sentlen = datalen;
-
+	if ((ret = tls_flush(conn)) != 1) {
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = datalen;
+		} else {
+			error_print();
+		}
+		return ret;
+	}
 	return 1;
 }
 
+int tls13_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen)
+{
+	int ret;
+
+	if (!conn || !sentlen) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_KTLS
+	if (conn->ktls & TLS_KTLS_TX) {
+		return tls13_ktls_send(conn, data, datalen, sentlen);
+	}
+#endif
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls13_conn_send(conn, data, datalen, sentlen);
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
 /*
 int tls13_recv(TLS_CONNECT *conn, uint8_t *data, size_t *datalen)
 {
@@ -315,7 +538,7 @@ int tls13_recv(TLS_CONNECT *conn, uint8_t *data, size_t *datalen)
 		seq_num = conn->client_seq_num;
 	}
 
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
+	if (tls_conn_record_read(conn, record, &recordlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -342,6 +565,140 @@ int tls13_recv(TLS_CONNECT *conn, uint8_t *data, size_t *datalen)
 }
 */
 
+static int tls13_process_new_session_ticket(TLS_CONNECT *conn, const uint8_t *record)
+{
+	const DIGEST *digest;
+	const BLOCK_CIPHER *cipher;
+	uint32_t ticket_lifetime;
+	uint32_t ticket_age_add;
+	const uint8_t *ticket_nonce;
+	size_t ticket_nonce_len;
+	const uint8_t *ticket;
+	size_t ticketlen;
+	uint32_t max_early_data_size;
+
+	tls_trace("recv [NewSessionTicket]\n");
+	tls13_record_trace(stderr, record, tls_record_length(record), 0, 0);
+	if (tls13_record_get_handshake_new_session_ticket(record,
+		&ticket_lifetime, &ticket_age_add, &ticket_nonce, &ticket_nonce_len,
+		&ticket, &ticketlen, &max_early_data_size) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!ticket_lifetime || ticketlen > sizeof(conn->session.ticket)) {
+		// not cached
+		return 1;
+	}
+	if (tls13_cipher_suite_get(conn->cipher_suite, &digest, &cipher) != 1) {
+		error_print();
+		return -1;
+	}
+	tls13_hkdf_expand_label(digest, conn->resumption_master_secret, "resumption",
+		ticket_nonce, ticket_nonce_len, 32, conn->session.psk);
+	conn->session.protocol = TLS_protocol_tls13;
+	conn->session.cipher_suite = conn->cipher_suite;
+	memcpy(conn->session.ticket, ticket, ticketlen);
+	conn->session.ticketlen = ticketlen;
+	conn->session.ticket_lifetime = ticket_lifetime;
+	conn->session.ticket_age_add = ticket_age_add;
+	conn->session.max_early_data_size = max_early_data_size;
+	time(&conn->session.time);
+	return 1;
+}
+
+// post-handshake messages, NewSessionTicket to the client and KeyUpdate
+static int tls13_process_post_handshake(TLS_CONNECT *conn, const uint8_t *record)
+{
+	int type;
+	const uint8_t *data;
+	size_t datalen;
+	int request_update;
+	int ret;
+
+	if (tls_record_get_handshake(record, &type, &data, &datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	switch (type) {
+	case TLS_handshake_new_session_ticket:
+		if (!conn->is_client) {
+			error_print();
+			return -1;
+		}
+		return tls13_process_new_session_ticket(conn, record);
+	case TLS_handshake_key_update:
+		tls_trace("recv {KeyUpdate}\n");
+		tls13_record_trace(stderr, record, tls_record_length(record), 0, 0);
+		if (conn->ktls) {
+			error_puts("KeyUpdate is not supported with kTLS");
+			return -1;
+		}
+		if (tls13_record_get_handshake_key_update(record, &request_update) != 1
+			|| tls13_update_traffic_key(conn, !conn->is_client) != 1) {
+			error_print();
+			return -1;
+		}
+		if (request_update == TLS_key_update_requested) {
+			if (tls13_queue_key_update(conn, TLS_key_update_not_requested) != 1) {
+				error_print();
+				return -1;
+			}
+			// left in sendbuf for the next send if the transport is busy
+			if ((ret = tls_flush(conn)) != 1 && ret != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				return -1;
+			}
+		}
+		return 1;
+	default:
+		error_print();
+		return -1;
+	}
+}
+
+#ifdef ENABLE_KTLS
+// the kernel has decrypted the record, `buf` keeps TLS_RECORD_HEADER_SIZE bytes in front of the data
+static int tls13_ktls_do_recv(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t *datalen)
+{
+	int ret;
+	int record_type;
+
+	for (;;) {
+		if ((ret = tls13_ktls_recv(conn, buf + 5, buflen - 5, &record_type, datalen)) != 1) {
+			if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
+			return ret;
+		}
+
+		switch (record_type) {
+		case TLS_record_application_data:
+			return 1;
+		case TLS_record_handshake:
+			buf[0] = TLS_record_handshake;
+			buf[1] = TLS_protocol_tls12 >> 8;
+			buf[2] = TLS_protocol_tls12 & 0xff;
+			buf[3] = (uint8_t)((*datalen) >> 8);
+			buf[4] = (uint8_t)(*datalen);
+			if (tls13_process_post_handshake(conn, buf) != 1) {
+				error_print();
+				return -1;
+			}
+			break;
+		case TLS_record_alert:
+			if (*datalen == 2 && buf[5 + 1] == TLS_alert_close_notify) {
+				tls_trace("recv Alert.close_notify\n");
+				*datalen = 0;
+				return 0;
+			}
+			error_print();
+			return -1;
+		default:
+			error_print();
+			return -1;
+		}
+	}
+}
+#endif
+
 int tls13_do_recv(TLS_CONNECT *conn)
 {
 	int ret;
@@ -362,9 +719,22 @@ int tls13_do_recv(TLS_CONNECT *conn)
 		seq_num = conn->client_seq_num;
 	}
 
+#ifdef ENABLE_KTLS
+	if (conn->ktls & TLS_KTLS_RX) {
+		// databuf is kept while data is left
+		if ((ret = tls13_ktls_do_recv(conn, conn->databuf, TLS_MAX_RECORD_SIZE, &conn->datalen)) != 1) {
+			conn->datalen = 0;
+			return ret;
+		}
+		conn->data = conn->databuf + 5;
+		return 1;
+	}
+#endif
+
+recv_record:
 	tls_trace("recv ApplicationData\n");
-	if ((ret = tls_record_recv(record, &recordlen, conn->sock)) != 1) {
-		if (ret < 0) error_print();
+	if ((ret = tls_conn_record_recv(conn, record, &recordlen)) != 1) {
+		if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
 		return ret;
 	}
 	tls_record_trace(stderr, record, recordlen, 0, 0);
@@ -380,6 +750,18 @@ int tls13_do_recv(TLS_CONNECT *conn)
 	tls_seq_num_incr(seq_num);
 
 	tls_record_set_data(record, conn->data, conn->datalen);
+
+	// post-handshake NewSessionTicket or KeyUpdate
+	if (record_type == TLS_record_handshake) {
+		record[0] = TLS_record_handshake;
+		conn->datalen = 0;
+		if (tls13_process_post_handshake(conn, record) != 1) {
+			error_print();
+			return -1;
+		}
+		goto recv_record;
+	}
+
 	tls_trace("decrypt ApplicationData\n");
 	tls_record_trace(stderr, record, tls_record_length(record), 0, 0);
 
@@ -388,19 +770,21 @@ int tls13_do_recv(TLS_CONNECT *conn)
 		error_print();
 		return -1;
 	}
-	return 1;
+	if (conn->datalen > conn->max_recv_fragment) {
+		error_puts("record larger than the negotiated limit");
+		tls_send_alert(conn, TLS_alert_record_overflow);
+		conn->datalen = 0;
+		return -1;
+	}
+	return 1;
 }
 
-int tls13_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+static int tls13_conn_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
 {
-	if (!conn || !out || !outlen || !recvlen) {
-		error_print();
-		return -1;
-	}
 	if (conn->datalen == 0) {
 		int ret;
 		if ((ret = tls13_do_recv(conn)) != 1) {
-			if (ret) error_print();
+			if (ret && ret != TLS_ERROR_WANT_READ) error_print();
 			return ret;
 		}
 	}
@@ -411,6 +795,293 @@ int tls13_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
 	return 1;
 }
 
+int tls13_recv(TLS_CONNECT *conn, uint8_t *out, size_t outlen, size_t *recvlen)
+{
+	int ret;
+
+	if (!conn || !out || !outlen || !recvlen) {
+		error_print();
+		return -1;
+	}
+	if (tls_conn_buffers_get(conn) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls13_conn_recv(conn, out, outlen, recvlen);
+	tls_conn_buffers_put(conn);
+	return ret;
+}
+
+// the record starts TLS_RECORD_HEADER_SIZE bytes before the data, the rest of the headroom is unused
+int tls13_send_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t datalen, size_t *sentlen)
+{
+	int ret;
+	const BLOCK_CIPHER_KEY *key;
+	const uint8_t *iv;
+	uint8_t *seq_num;
+	uint8_t *record;
+	size_t recordlen;
+
+	if (!conn || !buf || !sentlen) {
+		error_print();
+		return -1;
+	}
+
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the tail was queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		tls_conn_buffers_put(conn);
+		return 1;
+	}
+
+	if (!datalen || datalen > conn->max_send_fragment
+		|| buflen < TLS_RECORD_HEADROOM + datalen + TLS_RECORD_TAILROOM) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_KTLS
+	if (conn->ktls & TLS_KTLS_TX) {
+		return tls13_ktls_send(conn, buf + TLS_RECORD_HEADROOM, datalen, sentlen);
+	}
+#endif
+	if (tls13_key_update_if_needed(conn) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (conn->is_client) {
+		key = &conn->client_write_key;
+		iv = conn->client_write_iv;
+		seq_num = conn->client_seq_num;
+	} else {
+		key = &conn->server_write_key;
+		iv = conn->server_write_iv;
+		seq_num = conn->server_seq_num;
+	}
+
+	tls_trace("send {ApplicationData}\n");
+	record = buf + TLS_RECORD_HEADROOM - TLS_RECORD_HEADER_SIZE;
+	if (tls13_gcm_encrypt(key, iv, seq_num, TLS_record_application_data,
+		record + 5, datalen, 0, record + 5, &recordlen) != 1) {
+		error_print();
+		return -1;
+	}
+	record[0] = TLS_record_application_data;
+	record[1] = TLS_protocol_tls12 >> 8;
+	record[2] = TLS_protocol_tls12 & 0xff;
+	record[3] = (uint8_t)(recordlen >> 8);
+	record[4] = (uint8_t)(recordlen);
+	recordlen += 5;
+	tls_seq_num_incr(seq_num);
+
+	*sentlen = datalen;
+	if ((ret = tls_conn_record_send_direct(conn, record, recordlen)) != 1) {
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = datalen;
+		} else {
+			error_print();
+		}
+		return ret;
+	}
+	tls_conn_buffers_put(conn);
+	return 1;
+}
+
+int tls13_recv_in_place(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, uint8_t **data, size_t *datalen)
+{
+	int ret;
+	const BLOCK_CIPHER_KEY *key;
+	const uint8_t *iv;
+	uint8_t *seq_num;
+	size_t recordlen;
+	int record_type;
+
+	if (!conn || !buf || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (buflen < TLS_MAX_RECORD_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (conn->datalen) {
+		error_puts("recv all buffered data before tls13_recv_in_place");
+		return -1;
+	}
+
+	if (conn->is_client) {
+		key = &conn->server_write_key;
+		iv = conn->server_write_iv;
+		seq_num = conn->server_seq_num;
+	} else {
+		key = &conn->client_write_key;
+		iv = conn->client_write_iv;
+		seq_num = conn->client_seq_num;
+	}
+
+#ifdef ENABLE_KTLS
+	if (conn->ktls & TLS_KTLS_RX) {
+		if ((ret = tls13_ktls_do_recv(conn, buf, buflen, datalen)) != 1) {
+			return ret;
+		}
+		*data = buf + 5;
+		return 1;
+	}
+#endif
+
+recv_record:
+	tls_trace("recv ApplicationData\n");
+	if ((ret = tls_conn_record_recv(conn, buf, &recordlen)) != 1) {
+		if (ret < 0 && ret != TLS_ERROR_WANT_READ) error_print();
+		return ret;
+	}
+	if (tls13_gcm_decrypt(key, iv, seq_num, buf + 5, recordlen - 5,
+		&record_type, buf + 5, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	tls_seq_num_incr(seq_num);
+
+	// post-handshake NewSessionTicket or KeyUpdate
+	if (record_type == TLS_record_handshake) {
+		buf[0] = TLS_record_handshake;
+		buf[3] = (uint8_t)((*datalen) >> 8);
+		buf[4] = (uint8_t)(*datalen);
+		if (tls13_process_post_handshake(conn, buf) != 1) {
+			error_print();
+			return -1;
+		}
+		goto recv_record;
+	}
+	if (record_type != TLS_record_application_data) {
+		error_print();
+		return -1;
+	}
+	if (*datalen > conn->max_recv_fragment) {
+		error_puts("record larger than the negotiated limit");
+		tls_send_alert(conn, TLS_alert_record_overflow);
+		return -1;
+	}
+	*data = buf + 5;
+	return 1;
+}
+
+int tls13_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen)
+{
+	int ret;
+	const BLOCK_CIPHER_KEY *key;
+	const uint8_t *iv;
+	uint8_t *seq_num;
+	uint8_t *record;
+	size_t recordlen;
+	size_t offset = 0;
+	size_t left = 0;
+	size_t len, i;
+
+	if (!conn || (!iov && iovcnt) || !sentlen) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_KTLS
+	if (conn->ktls & TLS_KTLS_TX) {
+		return tls13_ktls_sendv(conn, iov, iovcnt, sentlen);
+	}
+#endif
+
+	// retry of a call returned TLS_ERROR_WANT_WRITE, the records were queued
+	if (conn->send_pending) {
+		if ((ret = tls_flush(conn)) != 1) {
+			if (ret != TLS_ERROR_WANT_WRITE) error_print();
+			return ret;
+		}
+		*sentlen = conn->send_pending;
+		conn->send_pending = 0;
+		tls_conn_buffers_put(conn);
+		return 1;
+	}
+
+	for (i = 0; i < iovcnt; i++) {
+		if (!iov[i].base && iov[i].len) {
+			error_print();
+			return -1;
+		}
+		left += iov[i].len;
+	}
+	if (!left) {
+		error_print();
+		return -1;
+	}
+
+	if (conn->is_client) {
+		key = &conn->client_write_key;
+		iv = conn->client_write_iv;
+		seq_num = conn->client_seq_num;
+	} else {
+		key = &conn->server_write_key;
+		iv = conn->server_write_iv;
+		seq_num = conn->server_seq_num;
+	}
+
+	if (tls13_key_update_if_needed(conn) != 1) {
+		error_print();
+		return -1;
+	}
+
+	tls_trace("send {ApplicationData}\n");
+	*sentlen = 0;
+	while (left) {
+		len = tls_send_fragment_size(conn, left);
+
+		// flush only when the next record does not fit behind the queued ones
+		if (conn->sendbuf_len - conn->sendbuf_offset
+			> TLS_MAX_RECORD_SIZE - (TLS_RECORD_HEADER_SIZE + len + TLS13_GCM_TAILROOM)) {
+			if ((ret = tls_flush(conn)) != 1) {
+				goto end;
+			}
+		}
+		if (!(record = tls_conn_record_reserve(conn, TLS_RECORD_HEADER_SIZE + len + TLS13_GCM_TAILROOM))) {
+			error_print();
+			return -1;
+		}
+		if (tls_iovec_copy(&iov, &iovcnt, &offset, record + 5, len) != len
+			|| tls13_gcm_encrypt(key, iv, seq_num, TLS_record_application_data,
+				record + 5, len, 0, record + 5, &recordlen) != 1) {
+			error_print();
+			return -1;
+		}
+		record[0] = TLS_record_application_data;
+		record[1] = TLS_protocol_tls12 >> 8;
+		record[2] = TLS_protocol_tls12 & 0xff;
+		record[3] = (uint8_t)(recordlen >> 8);
+		record[4] = (uint8_t)(recordlen);
+		recordlen += 5;
+		tls_seq_num_incr(seq_num);
+		conn->sendbuf_len += recordlen;
+
+		*sentlen += len;
+		left -= len;
+	}
+	ret = tls_flush(conn);
+
+end:
+	if (ret != 1) {
+		// the sealed records stay queued
+		if (ret == TLS_ERROR_WANT_WRITE) {
+			conn->send_pending = *sentlen;
+		} else {
+			error_print();
+		}
+		return ret;
+	}
+	tls_conn_buffers_put(conn);
+	return 1;
+}
+
 
 
 /*
@@ -439,35 +1110,180 @@ int tls13_hkdf_extract(const DIGEST *digest, const uint8_t salt[32], const uint8
 	return 1;
 }
 
+/*
+ * Encoded `opaque label<7..255>` of the HkdfLabel for the labels used by the
+ * key schedule, so that only the length and the context are written per call.
+ */
+typedef struct {
+	const char *label;
+	uint8_t len;
+	const char *tls13_label;
+} TLS13_HKDF_LABEL;
+
+#define TLS13_HKDF_LABEL_ENTRY(l)	{ l, (uint8_t)(sizeof("tls13 " l) - 1), "tls13 " l }
+
+static const TLS13_HKDF_LABEL tls13_hkdf_labels[] = {
+	TLS13_HKDF_LABEL_ENTRY("key"),
+	TLS13_HKDF_LABEL_ENTRY("iv"),
+	TLS13_HKDF_LABEL_ENTRY("finished"),
+	TLS13_HKDF_LABEL_ENTRY("derived"),
+	TLS13_HKDF_LABEL_ENTRY("c hs traffic"),
+	TLS13_HKDF_LABEL_ENTRY("s hs traffic"),
+	TLS13_HKDF_LABEL_ENTRY("c ap traffic"),
+	TLS13_HKDF_LABEL_ENTRY("s ap traffic"),
+	TLS13_HKDF_LABEL_ENTRY("c e traffic"),
+	TLS13_HKDF_LABEL_ENTRY("res binder"),
+	TLS13_HKDF_LABEL_ENTRY("res master"),
+	TLS13_HKDF_LABEL_ENTRY("resumption"),
+	TLS13_HKDF_LABEL_ENTRY("traffic upd"),
+};
+
+static int tls13_hkdf_label_encode(size_t outlen, const char *label,
+	const uint8_t *context, size_t context_len, uint8_t *hkdf_label, size_t *hkdf_label_len)
+{
+	uint8_t *p = hkdf_label;
+	size_t i;
+
+	*hkdf_label_len = 0;
+	if (outlen > 0xffff || context_len > 255) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes((uint16_t)outlen, &p, hkdf_label_len);
+
+	for (i = 0; i < sizeof(tls13_hkdf_labels)/sizeof(tls13_hkdf_labels[0]); i++) {
+		if (strcmp(label, tls13_hkdf_labels[i].label) == 0) {
+			tls_uint8array_to_bytes((uint8_t *)tls13_hkdf_labels[i].tls13_label,
+				tls13_hkdf_labels[i].len, &p, hkdf_label_len);
+			break;
+		}
+	}
+	if (i == sizeof(tls13_hkdf_labels)/sizeof(tls13_hkdf_labels[0])) {
+		size_t label_len = strlen(label);
+		if (label_len > 255 - strlen("tls13 ")) {
+			error_print();
+			return -1;
+		}
+		tls_uint8_to_bytes((uint8_t)(strlen("tls13 ") + label_len), &p, hkdf_label_len);
+		tls_array_to_bytes((uint8_t *)"tls13 ", strlen("tls13 "), &p, hkdf_label_len);
+		tls_array_to_bytes((uint8_t *)label, label_len, &p, hkdf_label_len);
+	}
+	tls_uint8array_to_bytes(context, context_len, &p, hkdf_label_len);
+	return 1;
+}
+
+int tls13_hkdf_expand_label_with_key(const SM3_HMAC_KEY *key,
+	const char *label, const uint8_t *context, size_t context_len,
+	size_t outlen, uint8_t *out)
+{
+	uint8_t hkdf_label[2 + 256 + 256];
+	size_t hkdf_label_len;
+	SM3_HMAC_CTX hmac_ctx;
+	uint8_t counter = 0x01;
+	uint8_t T[SM3_HMAC_SIZE];
+
+	// HKDF-Expand is a single HMAC when the output is not longer than the hash
+	if (outlen > SM3_HMAC_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (tls13_hkdf_label_encode(outlen, label, context, context_len, hkdf_label, &hkdf_label_len) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_hmac_init_with_key(&hmac_ctx, key);
+	sm3_hmac_update(&hmac_ctx, hkdf_label, hkdf_label_len);
+	sm3_hmac_update(&hmac_ctx, &counter, 1);
+	sm3_hmac_finish(&hmac_ctx, T);
+	memcpy(out, T, outlen);
+
+	gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+	gmssl_secure_clear(T, sizeof(T));
+	return 1;
+}
+
 int tls13_hkdf_expand_label(const DIGEST *digest, const uint8_t secret[32],
 	const char *label, const uint8_t *context, size_t context_len,
 	size_t outlen, uint8_t *out)
 {
-	uint8_t label_len;
 	uint8_t hkdf_label[2 + 256 + 256];
-	uint8_t *p = hkdf_label;
-	size_t hkdf_label_len = 0;
+	size_t hkdf_label_len;
 
-	label_len = (uint8_t)(strlen("tls13 ") + strlen(label)); //FIXME: check length < 255
-	tls_uint16_to_bytes((uint16_t)outlen, &p, &hkdf_label_len);
-	tls_uint8_to_bytes(label_len, &p, &hkdf_label_len);
-	tls_array_to_bytes((uint8_t *)"tls13 ", strlen("tls13 "), &p, &hkdf_label_len);
-	tls_array_to_bytes((uint8_t *)label, strlen(label), &p, &hkdf_label_len);
-	tls_uint8array_to_bytes(context, context_len, &p, &hkdf_label_len);
+	if (digest == DIGEST_sm3() && outlen <= SM3_HMAC_SIZE) {
+		SM3_HMAC_KEY key;
+		int ret;
 
-	hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, outlen, out);
+		sm3_hmac_set_key(&key, secret, 32);
+		ret = tls13_hkdf_expand_label_with_key(&key, label, context, context_len, outlen, out);
+		gmssl_secure_clear(&key, sizeof(key));
+		return ret;
+	}
 
+	if (tls13_hkdf_label_encode(outlen, label, context, context_len, hkdf_label, &hkdf_label_len) != 1
+		|| hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, outlen, out) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_hkdf_expand_key_iv(const DIGEST *digest, const uint8_t secret[32],
+	size_t key_len, uint8_t *key, uint8_t iv[12])
+{
+	if (digest == DIGEST_sm3()) {
+		SM3_HMAC_KEY hmac_key;
+		int ret = 1;
+
+		// (K ^ ipad) and (K ^ opad) are compressed once for both labels
+		sm3_hmac_set_key(&hmac_key, secret, 32);
+		if (tls13_hkdf_expand_label_with_key(&hmac_key, "key", NULL, 0, key_len, key) != 1
+			|| tls13_hkdf_expand_label_with_key(&hmac_key, "iv", NULL, 0, 12, iv) != 1) {
+			error_print();
+			ret = -1;
+		}
+		gmssl_secure_clear(&hmac_key, sizeof(hmac_key));
+		return ret;
+	}
+
+	if (tls13_hkdf_expand_label(digest, secret, "key", NULL, 0, key_len, key) != 1
+		|| tls13_hkdf_expand_label(digest, secret, "iv", NULL, 0, 12, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_transcript_hash(const DIGEST_CTX *dgst_ctx, uint8_t dgst[DIGEST_MAX_SIZE], size_t *dgstlen)
+{
+	DIGEST_CTX ctx;
+
+	// snapshot only the chaining state of the active digest, not the whole union
+	if (dgst_ctx->digest == DIGEST_sm3()) {
+		SM3_CTX sm3_ctx = dgst_ctx->u.sm3_ctx;
+		sm3_finish(&sm3_ctx, dgst);
+		*dgstlen = SM3_DIGEST_SIZE;
+		return 1;
+	}
+	if (!dgst_ctx->digest) {
+		error_print();
+		return -1;
+	}
+	memcpy(&ctx.u, &dgst_ctx->u, dgst_ctx->digest->ctx_size);
+	ctx.digest = dgst_ctx->digest;
+	if (digest_finish(&ctx, dgst, dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
 int tls13_derive_secret(const uint8_t secret[32], const char *label, const DIGEST_CTX *dgst_ctx, uint8_t out[32])
 {
-	DIGEST_CTX ctx = *dgst_ctx;
 	uint8_t dgst[64];
 	size_t dgstlen;
 
-	if (digest_finish(&ctx, dgst, &dgstlen) != 1
-		|| tls13_hkdf_expand_label(dgst_ctx->digest, secret, label, dgst, 32, dgstlen, out) != 1) {
+	if (tls13_transcript_hash(dgst_ctx, dgst, &dgstlen) != 1
+		|| tls13_hkdf_expand_label(dgst_ctx->digest, secret, label, dgst, dgstlen, dgstlen, out) != 1) {
 		error_print();
 		return -1;
 	}
@@ -488,7 +1304,6 @@ int tls13_sign_certificate_verify(int tls_mode,
 	uint8_t prefix[64];
 	const uint8_t *context_str_and_zero;
 	size_t context_str_and_zero_len;
-	DIGEST_CTX dgst_ctx;
 	uint8_t dgst[64];
 	size_t dgstlen;
 
@@ -508,8 +1323,10 @@ int tls13_sign_certificate_verify(int tls_mode,
 		return -1;
 	}
 
-	dgst_ctx = *tbs_dgst_ctx;
-	digest_finish(&dgst_ctx, dgst, &dgstlen);
+	if (tls13_transcript_hash(tbs_dgst_ctx, dgst, &dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
 
 	sm2_sign_init(&sign_ctx, key, signer_id, signer_id_len);
 	sm2_sign_update(&sign_ctx, prefix, 64);
@@ -530,7 +1347,6 @@ int tls13_verify_certificate_verify(int tls_mode,
 	uint8_t prefix[64];
 	const uint8_t *context_str_and_zero;
 	size_t context_str_and_zero_len;
-	DIGEST_CTX dgst_ctx;
 	uint8_t dgst[64];
 	size_t dgstlen;
 
@@ -550,8 +1366,10 @@ int tls13_verify_certificate_verify(int tls_mode,
 		return -1;
 	}
 
-	dgst_ctx = *tbs_dgst_ctx;
-	digest_finish(&dgst_ctx, dgst, &dgstlen);
+	if (tls13_transcript_hash(tbs_dgst_ctx, dgst, &dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
 
 	sm2_verify_init(&verify_ctx, public_key, signer_id, signer_id_len);
 	sm2_verify_update(&verify_ctx, prefix, 64);
@@ -587,20 +1405,33 @@ int tls13_verify_certificate_verify(int tls_mode,
 int tls13_compute_verify_data(const uint8_t *handshake_traffic_secret,
 	const DIGEST_CTX *dgst_ctx, uint8_t *verify_data, size_t *verify_data_len)
 {
-	DIGEST_CTX temp_dgst_ctx;
 	uint8_t dgst[64];
 	size_t dgstlen;
 	uint8_t finished_key[64];
 	size_t finished_key_len;
 
-	temp_dgst_ctx = *dgst_ctx;
-	digest_finish(&temp_dgst_ctx, dgst, &dgstlen);
+	if (tls13_transcript_hash(dgst_ctx, dgst, &dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
 	finished_key_len = dgstlen;
 
-	tls13_hkdf_expand_label(dgst_ctx->digest, handshake_traffic_secret,
-		"finished", NULL, 0, finished_key_len, finished_key);
-
-	hmac(dgst_ctx->digest, finished_key, finished_key_len, dgst, dgstlen, verify_data, verify_data_len);
+	if (tls13_hkdf_expand_label(dgst_ctx->digest, handshake_traffic_secret,
+		"finished", NULL, 0, finished_key_len, finished_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (dgst_ctx->digest == DIGEST_sm3()) {
+		SM3_HMAC_CTX hmac_ctx;
+		sm3_hmac_init(&hmac_ctx, finished_key, finished_key_len);
+		sm3_hmac_update(&hmac_ctx, dgst, dgstlen);
+		sm3_hmac_finish(&hmac_ctx, verify_data);
+		*verify_data_len = SM3_HMAC_SIZE;
+		gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+	} else {
+		hmac(dgst_ctx->digest, finished_key, finished_key_len, dgst, dgstlen, verify_data, verify_data_len);
+	}
+	gmssl_secure_clear(finished_key, sizeof(finished_key));
 	return 1;
 }
 
@@ -741,9 +1572,12 @@ int tls_client_key_shares_from_bytes(SM2_Z256_POINT *sm2_point, const uint8_t **
 }
 
 // 这个函数不是太正确，应该也是一个process
-int tls13_server_hello_extensions_get(const uint8_t *exts, size_t extslen, SM2_Z256_POINT *sm2_point)
+int tls13_server_hello_extensions_get(const uint8_t *exts, size_t extslen, SM2_Z256_POINT *sm2_point,
+	int *selected_identity)
 {
 	uint16_t version;
+
+	*selected_identity = -1;
 	while (extslen) {
 		uint16_t ext_type;
 		const uint8_t *ext_data;
@@ -770,6 +1604,12 @@ int tls13_server_hello_extensions_get(const uint8_t *exts, size_t extslen, SM2_Z
 				return -1;
 			}
 			break;
+		case TLS_extension_pre_shared_key:
+			if (tls13_process_server_pre_shared_key(ext_data, ext_datalen, selected_identity) != 1) {
+				error_print();
+				return -1;
+			}
+			break;
 		//default:
 			// FIXME: 还有几个扩展没有处理！
 			//error_print();
@@ -795,6 +1635,7 @@ static int tls13_encrypted_exts[] = {
 	TLS_extension_client_certificate_type,
 	TLS_extension_server_certificate_type,
 	TLS_extension_early_data,
+	TLS_extension_record_size_limit,
 };
 
 int tls13_encrypted_extensions_print(FILE *fp, int fmt, int ind, const uint8_t *data, size_t datalen)
@@ -819,7 +1660,8 @@ int tls13_encrypted_extensions_print(FILE *fp, int fmt, int ind, const uint8_t *
 	return 1;
 }
 
-int tls13_record_set_handshake_encrypted_extensions(uint8_t *record, size_t *recordlen)
+int tls13_record_set_handshake_encrypted_extensions(uint8_t *record, size_t *recordlen, int early_data, int server_name,
+	uint16_t record_size_limit, int max_fragment_length)
 {
 	int type = TLS_handshake_encrypted_extensions;
 	uint8_t *p = record + 5 + 4;
@@ -830,6 +1672,18 @@ int tls13_record_set_handshake_encrypted_extensions(uint8_t *record, size_t *rec
 	const int supported_groups[] = { TLS_curve_sm2p256v1 };
 
 	tls_supported_groups_ext_to_bytes(supported_groups, sizeof(supported_groups)/sizeof(int), &pexts, &extslen);
+	if (early_data) {
+		tls13_early_data_ext_to_bytes(NULL, &pexts, &extslen);
+	}
+	if (server_name) {
+		tls_server_name_ext_to_bytes(NULL, &pexts, &extslen);
+	}
+	if (record_size_limit) {
+		tls_record_size_limit_ext_to_bytes(record_size_limit, &pexts, &extslen);
+	}
+	if (max_fragment_length) {
+		tls_max_fragment_length_ext_to_bytes(max_fragment_length, &pexts, &extslen);
+	}
 
 	tls_uint16array_to_bytes(exts, extslen, &p, &len);
 	tls_record_set_handshake(record, recordlen, type, NULL, len);
@@ -837,7 +1691,9 @@ int tls13_record_set_handshake_encrypted_extensions(uint8_t *record, size_t *rec
 	return 1;
 }
 
-int tls13_record_get_handshake_encrypted_extensions(const uint8_t *record)
+// `early_data` is set if the server accepts the 0-RTT, the record size limits are 0 if not sent
+int tls13_record_get_handshake_encrypted_extensions(const uint8_t *record, int *early_data,
+	uint16_t *record_size_limit, int *max_fragment_length)
 {
 	int type;
 	const uint8_t *p;
@@ -853,11 +1709,37 @@ int tls13_record_get_handshake_encrypted_extensions(const uint8_t *record)
 		error_print();
 		return -1;
 	}
-	// 当前实现不需要在EncryptedExtensions提供扩展
-	if (exts_datalen) {
-		// FIXME: 实际上supported_groups是放在这里的，应该加以处理		
-		//error_print();
-		//return -1;
+	// FIXME: 实际上supported_groups是放在这里的，应该加以处理
+	*early_data = 0;
+	*record_size_limit = 0;
+	*max_fragment_length = 0;
+	while (exts_datalen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts_data, &exts_datalen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts_data, &exts_datalen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (ext_type == TLS_extension_early_data) {
+			if (tls13_process_early_data(ext_data, ext_datalen, NULL) != 1) {
+				error_print();
+				return -1;
+			}
+			*early_data = 1;
+		} else if (ext_type == TLS_extension_record_size_limit) {
+			if (tls_process_record_size_limit(ext_data, ext_datalen, record_size_limit) != 1) {
+				error_print();
+				return -1;
+			}
+		} else if (ext_type == TLS_extension_max_fragment_length) {
+			if (tls_process_max_fragment_length(ext_data, ext_datalen, max_fragment_length) != 1) {
+				error_print();
+				return -1;
+			}
+		}
 	}
 	return 1;
 }
@@ -1146,7 +2028,9 @@ int tls13_certificate_verify_print(FILE *fp, int fmt, int ind, const uint8_t *d,
 	return 1;
 }
 
+// the OCSP response is stapled to the first CertificateEntry
 int tls13_certificate_list_to_bytes(const uint8_t *certs, size_t certslen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len,
 	uint8_t **out, size_t *outlen)
 {
 	uint8_t *p = NULL;
@@ -1158,7 +2042,6 @@ int tls13_certificate_list_to_bytes(const uint8_t *certs, size_t certslen,
 	while (certslen) {
 		const uint8_t *cert;
 		size_t certlen;
-		const uint8_t *entry_exts = NULL;
 		size_t entry_exts_len = 0;
 
 		if (x509_cert_from_der(&cert, &certlen, &certs, &certslen) != 1) {
@@ -1166,17 +2049,33 @@ int tls13_certificate_list_to_bytes(const uint8_t *certs, size_t certslen,
 			return -1;
 		}
 		tls_uint24array_to_bytes(cert, certlen, &p, &cert_list_len);
-		tls_uint16array_to_bytes(entry_exts, entry_exts_len, &p, &cert_list_len);
-
+		if (ocsp_resp) {
+			if (tls13_certificate_status_ext_to_bytes(ocsp_resp, ocsp_resp_len, NULL, &entry_exts_len) != 1) {
+				error_print();
+				return -1;
+			}
+			tls_uint16_to_bytes((uint16_t)entry_exts_len, &p, &cert_list_len);
+			tls13_certificate_status_ext_to_bytes(ocsp_resp, ocsp_resp_len, &p, &cert_list_len);
+			ocsp_resp = NULL;
+		} else {
+			tls_uint16array_to_bytes(NULL, 0, &p, &cert_list_len);
+		}
 	}
 	tls_uint24array_to_bytes(NULL, cert_list_len, out, outlen);
 	return 1;
 }
 
+// a status_request of the first entry is accepted only with non-NULL `ocsp_resp`, set to NULL if none
 int tls13_process_certificate_list(const uint8_t *cert_list, size_t cert_list_len,
-	uint8_t *certs, size_t *certs_len)
+	uint8_t *certs, size_t *certs_len, const uint8_t **ocsp_resp, size_t *ocsp_resp_len)
 {
+	int first = 1;
+
 	*certs_len = 0;
+	if (ocsp_resp) {
+		*ocsp_resp = NULL;
+		*ocsp_resp_len = 0;
+	}
 
 	while (cert_list_len) {
 		const uint8_t *cert_data;
@@ -1209,6 +2108,16 @@ int tls13_process_certificate_list(const uint8_t *cert_list, size_t cert_list_le
 			}
 			switch (ext_type) {
 			case TLS_extension_status_request:
+				if (!ocsp_resp || !first || *ocsp_resp) {
+					error_print();
+					return -1;
+				}
+				if (tls_certificate_status_from_bytes(ocsp_resp, ocsp_resp_len, &ext_data, &ext_data_len) != 1
+					|| tls_length_is_zero(ext_data_len) != 1) {
+					error_print();
+					return -1;
+				}
+				break;
 			case TLS_extension_signed_certificate_timestamp:
 				error_print();
 				return -1;
@@ -1217,13 +2126,15 @@ int tls13_process_certificate_list(const uint8_t *cert_list, size_t cert_list_le
 				return -1;
 			}
 		}
+		first = 0;
 	}
 	return 1;
 }
 
 int tls13_record_set_handshake_certificate(uint8_t *record, size_t *recordlen,
 	const uint8_t *request_context, size_t request_context_len,
-	const uint8_t *certs, size_t certslen)
+	const uint8_t *certs, size_t certslen,
+	const uint8_t *ocsp_resp, size_t ocsp_resp_len)
 {
 	int type = TLS_handshake_certificate;
 	uint8_t *data;
@@ -1236,7 +2147,10 @@ int tls13_record_set_handshake_certificate(uint8_t *record, size_t *recordlen,
 
 	datalen = 0;
 	tls_uint8array_to_bytes(request_context, request_context_len, NULL, &datalen);
-	tls13_certificate_list_to_bytes(certs, certslen, NULL, &datalen);
+	if (tls13_certificate_list_to_bytes(certs, certslen, ocsp_resp, ocsp_resp_len, NULL, &datalen) != 1) {
+		error_print();
+		return -1;
+	}
 	if (datalen > TLS_MAX_HANDSHAKE_DATA_SIZE) {
 		error_print();
 		return -1;
@@ -1245,89 +2159,410 @@ int tls13_record_set_handshake_certificate(uint8_t *record, size_t *recordlen,
 	data = tls_handshake_data(tls_record_data(record));
 	datalen = 0;
 	tls_uint8array_to_bytes(request_context, request_context_len, &data, &datalen);
-	tls13_certificate_list_to_bytes(certs, certslen, &data, &datalen);
+	tls13_certificate_list_to_bytes(certs, certslen, ocsp_resp, ocsp_resp_len, &data, &datalen);
 	tls_record_set_handshake(record, recordlen, type, NULL, datalen);
 
 	return 1;
 }
 
-int tls13_record_get_handshake_certificate(const uint8_t *record,
-	const uint8_t **cert_request_context, size_t *cert_request_context_len,
-	const uint8_t **cert_list, size_t *cert_list_len)
+static int tls13_certificate_from_bytes(
+	const uint8_t **cert_request_context, size_t *cert_request_context_len,
+	const uint8_t **cert_list, size_t *cert_list_len, const uint8_t *p, size_t len)
+{
+	if (tls_uint8array_from_bytes(cert_request_context, cert_request_context_len, &p, &len) != 1
+		|| tls_uint24array_from_bytes(cert_list, cert_list_len, &p, &len) != 1
+		|| tls_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (*cert_list == NULL) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_record_get_handshake_certificate(const uint8_t *record,
+	const uint8_t **cert_request_context, size_t *cert_request_context_len,
+	const uint8_t **cert_list, size_t *cert_list_len)
+{
+	int type;
+	const uint8_t *p;
+	size_t len;
+
+	if (tls_record_get_handshake(record, &type, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (type != TLS_handshake_certificate) {
+		error_print();
+		return -1;
+	}
+	if (tls13_certificate_from_bytes(cert_request_context, cert_request_context_len,
+		cert_list, cert_list_len, p, len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+/*
+struct {
+	CertificateCompressionAlgorithm algorithm;
+	uint24 uncompressed_length;
+	opaque compressed_certificate_message<1..2^24-1>;
+} CompressedCertificate;
+*/
+int tls13_compress_certificate(int algor, const uint8_t *cert_msg, size_t cert_msg_len,
+	uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	size_t header_len = tls_uint16_size() + tls_uint24_size() + tls_uint24_size();
+	size_t compressed_len;
+	uint8_t *p = out;
+	size_t len = 0;
+	int ret;
+
+	if (!cert_msg || !cert_msg_len || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (cert_msg_len > TLS_MAX_CERTIFICATE_MESSAGE_SIZE) {
+		error_print();
+		return -1;
+	}
+	// not worth it unless smaller than the Certificate
+	if (maxlen > cert_msg_len) {
+		maxlen = cert_msg_len;
+	}
+	if (maxlen <= header_len) {
+		return 0;
+	}
+	if ((ret = tls_cert_compress(algor, cert_msg, cert_msg_len,
+		out + header_len, &compressed_len, maxlen - header_len)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	tls_uint16_to_bytes((uint16_t)algor, &p, &len);
+	tls_uint24_to_bytes((uint24_t)cert_msg_len, &p, &len);
+	tls_uint24_to_bytes((uint24_t)compressed_len, &p, &len);
+	*outlen = len + compressed_len;
+	return 1;
+}
+
+int tls13_decompress_certificate(const uint8_t *data, size_t datalen, const int *algors, size_t algors_cnt,
+	uint8_t **cert_msg, size_t *cert_msg_len)
+{
+	uint16_t algor;
+	uint24_t uncompressed_len;
+	const uint8_t *compressed;
+	size_t compressed_len;
+	size_t i;
+
+	if (!cert_msg || !cert_msg_len) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16_from_bytes(&algor, &data, &datalen) != 1
+		|| tls_uint24_from_bytes(&uncompressed_len, &data, &datalen) != 1
+		|| tls_uint24array_from_bytes(&compressed, &compressed_len, &data, &datalen) != 1
+		|| tls_length_is_zero(datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < algors_cnt; i++) {
+		if (algors[i] == algor) {
+			break;
+		}
+	}
+	if (i == algors_cnt) {
+		error_puts("certificate compressed with an algorithm not offered");
+		return -1;
+	}
+	if (!compressed_len || !uncompressed_len || uncompressed_len > TLS_MAX_CERTIFICATE_MESSAGE_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!(*cert_msg = (uint8_t *)malloc(uncompressed_len))) {
+		error_print();
+		return -1;
+	}
+	if (tls_cert_decompress(algor, compressed, compressed_len, *cert_msg, uncompressed_len) != 1) {
+		free(*cert_msg);
+		*cert_msg = NULL;
+		error_print();
+		return -1;
+	}
+	*cert_msg_len = uncompressed_len;
+	return 1;
+}
+
+int tls13_compressed_certificate_print(FILE *fp, int fmt, int ind, const uint8_t *d, size_t dlen)
+{
+	uint16_t algor;
+	uint24_t uncompressed_len;
+	const uint8_t *compressed;
+	size_t compressed_len;
+	const char *name;
+
+	format_print(fp, fmt, ind, "CompressedCertificate\n");
+	ind += 4;
+	if (tls_uint16_from_bytes(&algor, &d, &dlen) != 1
+		|| tls_uint24_from_bytes(&uncompressed_len, &d, &dlen) != 1
+		|| tls_uint24array_from_bytes(&compressed, &compressed_len, &d, &dlen) != 1
+		|| tls_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	name = tls_cert_compression_name(algor);
+	format_print(fp, fmt, ind, "algorithm: %s (%d)\n", name ? name : "unknown", algor);
+	format_print(fp, fmt, ind, "uncompressed_length: %u\n", (unsigned int)uncompressed_len);
+	format_print(fp, fmt, ind, "compressed_certificate_message: %zu bytes\n", compressed_len);
+	return 1;
+}
+
+
+
+/*
+finished_key = HKDF-Expand-Label(BaseKey, "finished", "", Hash.length)
+
+struct {
+          opaque verify_data[Hash.length];
+} Finished;
+
+verify_data = HMAC(finished_key, Hash(Handshake Context, Certificate*, CertificateVerify*))
+Hash = SM3, SHA256 or SHA384
+*/
+
+
+int tls13_record_set_handshake_finished(uint8_t *record, size_t *recordlen,
+	const uint8_t *verify_data, size_t verify_data_len)
+{
+	int type = TLS_handshake_finished;
+	if (!record || !recordlen || !verify_data) {
+		error_print();
+		return -1;
+	}
+	tls_record_set_handshake(record, recordlen, type, verify_data, verify_data_len);
+	return 1;
+}
+
+int tls13_record_get_handshake_finished(const uint8_t *record,
+	const uint8_t **verify_data, size_t *verify_data_len)
+{
+	int type;
+
+	if (tls_record_get_handshake(record, &type, verify_data, verify_data_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (type != TLS_handshake_finished) {
+		error_print();
+		return -1;
+	}
+	if (*verify_data_len != SM3_DIGEST_SIZE
+		&& *verify_data_len != SHA384_DIGEST_SIZE) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+
+/*
+NewSessionTicket
+
+struct {
+	uint32 ticket_lifetime;
+	uint32 ticket_age_add;
+	opaque ticket_nonce<0..255>;
+	opaque ticket<1..2^16-1>;
+	Extension extensions<0..2^16-2>;
+} NewSessionTicket;
+
+PSK = HKDF-Expand-Label(resumption_master_secret, "resumption", ticket_nonce, Hash.length)
+
+The only extension is early_data with the max_early_data_size, omitted if 0.
+*/
+
+int tls13_record_set_handshake_new_session_ticket(uint8_t *record, size_t *recordlen,
+	uint32_t ticket_lifetime, uint32_t ticket_age_add,
+	const uint8_t *ticket_nonce, size_t ticket_nonce_len,
+	const uint8_t *ticket, size_t ticketlen, uint32_t max_early_data_size)
+{
+	int type = TLS_handshake_new_session_ticket;
+	uint8_t *p;
+	size_t len = 0;
+	uint8_t exts[8];
+	uint8_t *pexts = exts;
+	size_t extslen = 0;
+
+	if (!record || !recordlen || !ticket || !ticketlen) {
+		error_print();
+		return -1;
+	}
+	if (ticket_nonce_len > 255 || ticketlen > 1024) {
+		error_print();
+		return -1;
+	}
+	p = tls_handshake_data(tls_record_data(record));
+	tls_uint32_to_bytes(ticket_lifetime, &p, &len);
+	tls_uint32_to_bytes(ticket_age_add, &p, &len);
+	tls_uint8array_to_bytes(ticket_nonce, ticket_nonce_len, &p, &len);
+	tls_uint16array_to_bytes(ticket, ticketlen, &p, &len);
+	if (max_early_data_size) {
+		tls13_early_data_ext_to_bytes(&max_early_data_size, &pexts, &extslen);
+	}
+	tls_uint16array_to_bytes(exts, extslen, &p, &len);
+	tls_record_set_handshake(record, recordlen, type, NULL, len);
+	return 1;
+}
+
+int tls13_record_get_handshake_new_session_ticket(const uint8_t *record,
+	uint32_t *ticket_lifetime, uint32_t *ticket_age_add,
+	const uint8_t **ticket_nonce, size_t *ticket_nonce_len,
+	const uint8_t **ticket, size_t *ticketlen, uint32_t *max_early_data_size)
 {
 	int type;
 	const uint8_t *p;
 	size_t len;
+	const uint8_t *exts;
+	size_t extslen;
 
+	if (!ticket_lifetime || !ticket_age_add || !ticket_nonce || !ticket_nonce_len
+		|| !ticket || !ticketlen || !max_early_data_size) {
+		error_print();
+		return -1;
+	}
 	if (tls_record_get_handshake(record, &type, &p, &len) != 1) {
 		error_print();
 		return -1;
 	}
-	if (type != TLS_handshake_certificate) {
+	if (type != TLS_handshake_new_session_ticket) {
 		error_print();
 		return -1;
 	}
-	if (tls_uint8array_from_bytes(cert_request_context, cert_request_context_len, &p, &len) != 1
-		|| tls_uint24array_from_bytes(cert_list, cert_list_len, &p, &len) != 1
+	if (tls_uint32_from_bytes(ticket_lifetime, &p, &len) != 1
+		|| tls_uint32_from_bytes(ticket_age_add, &p, &len) != 1
+		|| tls_uint8array_from_bytes(ticket_nonce, ticket_nonce_len, &p, &len) != 1
+		|| tls_uint16array_from_bytes(ticket, ticketlen, &p, &len) != 1
+		|| tls_uint16array_from_bytes(&exts, &extslen, &p, &len) != 1
 		|| tls_length_is_zero(len) != 1) {
 		error_print();
 		return -1;
 	}
-	if (*cert_list == NULL) {
+	if (!*ticketlen) {
 		error_print();
 		return -1;
 	}
+	*max_early_data_size = 0;
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (ext_type == TLS_extension_early_data
+			&& tls13_process_early_data(ext_data, ext_datalen, max_early_data_size) != 1) {
+			error_print();
+			return -1;
+		}
+	}
 	return 1;
 }
 
-
-
 /*
-finished_key = HKDF-Expand-Label(BaseKey, "finished", "", Hash.length)
+SessionTicket, opaque to the client
 
-struct {
-          opaque verify_data[Hash.length];
-} Finished;
+	key_name[16] || iv[12] || SM4-GCM(cipher_suite[2] || issue_time[4] || ticket_age_add[4] || psk[32]) || tag[16]
 
-verify_data = HMAC(finished_key, Hash(Handshake Context, Certificate*, CertificateVerify*))
-Hash = SM3, SHA256 or SHA384
+The key_name is authenticated as AAD.
 */
 
+#define TLS13_SESSION_TICKET_PLAINTEXT_SIZE	42
 
-int tls13_record_set_handshake_finished(uint8_t *record, size_t *recordlen,
-	const uint8_t *verify_data, size_t verify_data_len)
+int tls13_session_ticket_encrypt(const uint8_t key[TLS13_SESSION_TICKET_KEY_SIZE],
+	int cipher_suite, uint32_t issue_time, uint32_t ticket_age_add, const uint8_t psk[32],
+	uint8_t *ticket, size_t *ticketlen)
 {
-	int type = TLS_handshake_finished;
-	if (!record || !recordlen || !verify_data) {
+	SM4_KEY sm4_key;
+	uint8_t buf[TLS13_SESSION_TICKET_PLAINTEXT_SIZE];
+	uint8_t *p = buf;
+	size_t len = 0;
+	uint8_t *iv = ticket + 16;
+
+	if (!key || !psk || !ticket || !ticketlen) {
 		error_print();
 		return -1;
 	}
-	tls_record_set_handshake(record, recordlen, type, verify_data, verify_data_len);
-	return 1;
-}
+	tls_uint16_to_bytes((uint16_t)cipher_suite, &p, &len);
+	tls_uint32_to_bytes(issue_time, &p, &len);
+	tls_uint32_to_bytes(ticket_age_add, &p, &len);
+	tls_array_to_bytes(psk, 32, &p, &len);
 
-int tls13_record_get_handshake_finished(const uint8_t *record,
-	const uint8_t **verify_data, size_t *verify_data_len)
-{
-	int type;
-
-	if (tls_record_get_handshake(record, &type, verify_data, verify_data_len) != 1) {
+	memcpy(ticket, key, 16);
+	if (rand_bytes(iv, 12) != 1) {
 		error_print();
 		return -1;
 	}
-	if (type != TLS_handshake_finished) {
+	sm4_set_encrypt_key(&sm4_key, key + 16);
+	if (sm4_gcm_encrypt(&sm4_key, iv, 12, ticket, 16, buf, sizeof(buf),
+		ticket + 28, 16, ticket + 28 + sizeof(buf)) != 1) {
+		gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+		gmssl_secure_clear(buf, sizeof(buf));
 		error_print();
 		return -1;
 	}
-	if (*verify_data_len != SM3_DIGEST_SIZE
-		&& *verify_data_len != SHA384_DIGEST_SIZE) {
+	*ticketlen = TLS13_SESSION_TICKET_SIZE;
+
+	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+	gmssl_secure_clear(buf, sizeof(buf));
+	return 1;
+}
+
+// return 0 if the ticket is not sealed by this key
+int tls13_session_ticket_decrypt(const uint8_t key[TLS13_SESSION_TICKET_KEY_SIZE],
+	const uint8_t *ticket, size_t ticketlen,
+	int *cipher_suite, uint32_t *issue_time, uint32_t *ticket_age_add, uint8_t psk[32])
+{
+	SM4_KEY sm4_key;
+	uint8_t buf[TLS13_SESSION_TICKET_PLAINTEXT_SIZE];
+	const uint8_t *p = buf;
+	size_t len = sizeof(buf);
+	uint16_t suite;
+	const uint8_t *psk_ptr;
+	int ret;
+
+	if (!key || !ticket || !cipher_suite || !issue_time || !ticket_age_add || !psk) {
 		error_print();
 		return -1;
 	}
+	if (ticketlen != TLS13_SESSION_TICKET_SIZE
+		|| memcmp(ticket, key, 16) != 0) {
+		return 0;
+	}
+	sm4_set_encrypt_key(&sm4_key, key + 16);
+	ret = sm4_gcm_decrypt(&sm4_key, ticket + 16, 12, ticket, 16,
+		ticket + 28, sizeof(buf), ticket + 28 + sizeof(buf), 16, buf);
+	gmssl_secure_clear(&sm4_key, sizeof(sm4_key));
+	if (ret != 1) {
+		return 0;
+	}
+
+	tls_uint16_from_bytes(&suite, &p, &len);
+	tls_uint32_from_bytes(issue_time, &p, &len);
+	tls_uint32_from_bytes(ticket_age_add, &p, &len);
+	tls_array_from_bytes(&psk_ptr, 32, &p, &len);
+	*cipher_suite = suite;
+	memcpy(psk, psk_ptr, 32);
+
+	gmssl_secure_clear(buf, sizeof(buf));
 	return 1;
 }
 
-
 int tls13_padding_len_rand(size_t *padding_len)
 {
 	uint8_t val;
@@ -1350,6 +2585,12 @@ int tls13_cipher_suite_get(int cipher_suite, const DIGEST **digest, const BLOCK_
 		*digest = DIGEST_sha256();
 		*cipher = BLOCK_CIPHER_aes128();
 		break;
+#endif
+#if defined(ENABLE_CHACHA20) && defined(ENABLE_SHA2)
+	case TLS_cipher_chacha20_poly1305_sha256:
+		*digest = DIGEST_sha256();
+		*cipher = BLOCK_CIPHER_chacha20();
+		break;
 #endif
 	default:
 		error_print();
@@ -1358,6 +2599,186 @@ int tls13_cipher_suite_get(int cipher_suite, const DIGEST **digest, const BLOCK_
 	return 1;
 }
 
+int tls13_set_early_data(TLS_CONNECT *conn, const uint8_t *data, size_t datalen)
+{
+	uint8_t *buf;
+
+	if (!conn || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (!conn->is_client || conn->protocol != TLS_protocol_tls13 || conn->hs.state != TLS_state_client_hello) {
+		error_print();
+		return -1;
+	}
+	if (!conn->session.ticketlen || datalen > conn->session.max_early_data_size) {
+		error_puts("the session ticket does not allow this early data");
+		return -1;
+	}
+	if (!(buf = (uint8_t *)malloc(datalen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(buf, data, datalen);
+	if (conn->early_data) {
+		gmssl_secure_clear(conn->early_data, conn->early_data_len);
+		free(conn->early_data);
+	}
+	conn->early_data = buf;
+	conn->early_data_len = datalen;
+	return 1;
+}
+
+int tls13_early_data_status(const TLS_CONNECT *conn)
+{
+	if (!conn) {
+		error_print();
+		return -1;
+	}
+	return conn->early_data_status;
+}
+
+int tls13_get_early_data(const TLS_CONNECT *conn, const uint8_t **data, size_t *datalen)
+{
+	if (!conn || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (conn->is_client || conn->early_data_status != TLS_early_data_accepted) {
+		*data = NULL;
+		*datalen = 0;
+		return 0;
+	}
+	*data = conn->early_data;
+	*datalen = conn->early_data_len;
+	return 1;
+}
+
+static int tls13_set_early_data_key(TLS_CONNECT *conn, const DIGEST *digest, const BLOCK_CIPHER *cipher,
+	BLOCK_CIPHER_KEY *key, uint8_t iv[12])
+{
+	uint8_t write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
+
+	tls13_hkdf_expand_key_iv(digest, conn->hs.client_early_traffic_secret, cipher->key_size, write_key, iv);
+	block_cipher_set_encrypt_key(key, cipher, write_key);
+	gmssl_secure_clear(write_key, sizeof(write_key));
+	return 1;
+}
+
+// records of a rejected 0-RTT do not decrypt under the handshake key, the server skips them
+static int tls13_skip_early_data(TLS_CONNECT *conn, const uint8_t *enced_record, size_t enced_recordlen)
+{
+	if (conn->is_client || !conn->hs.early_data_offered
+		|| conn->early_data_status == TLS_early_data_accepted
+		|| tls_record_type(enced_record) != TLS_record_application_data) {
+		return 0;
+	}
+	conn->hs.early_data_skipped += enced_recordlen - TLS_RECORD_HEADER_SIZE;
+	if (conn->hs.early_data_skipped > TLS13_MAX_EARLY_DATA_SIZE + TLS_MAX_RECORD_SIZE) {
+		error_print();
+		return 0;
+	}
+	tls_trace("skip [EarlyData]\n");
+	return 1;
+}
+
+// a ServerHello with this random is a HelloRetryRequest, SHA-256("HelloRetryRequest")
+static const uint8_t tls13_hello_retry_request_random[32] = {
+	0xcf, 0x21, 0xad, 0x74, 0xe5, 0x9a, 0x61, 0x11, 0xbe, 0x1d, 0x8c, 0x02, 0x1e, 0x65, 0xb8, 0x91,
+	0xc2, 0xa2, 0x11, 0x16, 0x7a, 0xbb, 0x8c, 0x5e, 0x07, 0x9e, 0x09, 0xe2, 0xc8, 0xa8, 0x33, 0x9c,
+};
+
+// asks for the cookie if cookielen is not 0 and for the share of `group` if it is not 0
+static int tls13_record_set_hello_retry_request(uint8_t *record, size_t *recordlen,
+	int cipher_suite, const uint8_t *cookie, size_t cookielen, int group)
+{
+	int protocols[] = { TLS_protocol_tls13 };
+	uint8_t exts[24 + TLS13_MAX_COOKIE_SIZE];
+	uint8_t *p = exts;
+	size_t extslen = 0;
+
+	tls_record_set_protocol(record, TLS_protocol_tls12);
+	if (tls13_supported_versions_ext_to_bytes(TLS_handshake_hello_retry_request, protocols, 1, &p, &extslen) != 1
+		|| (group && tls13_hello_retry_request_key_share_ext_to_bytes(group, &p, &extslen) != 1)
+		|| (cookielen && tls13_cookie_ext_to_bytes(cookie, cookielen, &p, &extslen) != 1)
+		|| tls_record_set_handshake_server_hello(record, recordlen, TLS_protocol_tls12,
+			tls13_hello_retry_request_random, NULL, 0, cipher_suite, exts, extslen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int tls13_process_hello_retry_request_exts(const uint8_t *exts, size_t extslen,
+	uint8_t cookie[TLS13_MAX_COOKIE_SIZE], size_t *cookielen)
+{
+	uint16_t version;
+	const uint8_t *p;
+	size_t len;
+	int group;
+
+	*cookielen = 0;
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		switch (ext_type) {
+		case TLS_extension_supported_versions:
+			if (tls_uint16_from_bytes(&version, &ext_data, &ext_datalen) != 1
+				|| ext_datalen
+				|| version != TLS_protocol_tls13) {
+				error_print();
+				return -1;
+			}
+			break;
+		case TLS_extension_cookie:
+			if (tls13_process_cookie(ext_data, ext_datalen, &p, &len) != 1
+				|| len > TLS13_MAX_COOKIE_SIZE) {
+				error_print();
+				return -1;
+			}
+			memcpy(cookie, p, len);
+			*cookielen = len;
+			break;
+		case TLS_extension_key_share:
+			if (tls13_process_hello_retry_request_key_share(ext_data, ext_datalen, &group) != 1) {
+				error_print();
+				return -1;
+			}
+			// sm2p256v1 is the only group offered and its share is already sent, RFC 8446 4.1.4
+			error_print();
+			return -1;
+		default:
+			error_print();
+			return -1;
+		}
+	}
+	// a retry changing nothing in the ClientHello
+	if (!*cookielen) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// the transcript restarts as message_hash(ClientHello1) || HelloRetryRequest, RFC 8446 4.4.1
+static void tls13_hello_retry_transcript(DIGEST_CTX *dgst_ctx, const DIGEST *digest,
+	const uint8_t *client_hello_hash, size_t hashlen, const uint8_t *hello_retry_request, size_t len)
+{
+	uint8_t message_hash[4] = { TLS_handshake_message_hash, 0, 0, (uint8_t)hashlen };
+
+	digest_init(dgst_ctx, digest);
+	digest_update(dgst_ctx, message_hash, sizeof(message_hash));
+	digest_update(dgst_ctx, client_hello_hash, hashlen);
+	digest_update(dgst_ctx, hello_retry_request, len);
+}
+
 
 
 /*
@@ -1465,6 +2886,9 @@ TLS 1.3的区别：
 int tls13_do_connect(TLS_CONNECT *conn)
 {
 	int ret = -1;
+	int rv;
+	TLS_HANDSHAKE *hs = &conn->hs;
+	ARENA_MARK arena_mark;
 	uint8_t *record = conn->record;
 	uint8_t *enced_record = conn->enced_record;
 	size_t recordlen;
@@ -1477,8 +2901,6 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	size_t datalen;
 
 	int protocol;
-	uint8_t client_random[32];
-	uint8_t server_random[32];
 	int cipher_suite;
 	const uint8_t *random;
 	const uint8_t *session_id;
@@ -1488,10 +2910,21 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	int supported_groups[] = { TLS_curve_sm2p256v1 };
 	int sign_algors[] = { TLS_sig_sm2sig_sm3 };
 
-	uint8_t client_exts[TLS_MAX_EXTENSIONS_SIZE];
+	uint8_t *client_exts = NULL;
 	size_t client_exts_len;
 	const uint8_t *server_exts;
 	size_t server_exts_len;
+	int psk_modes[] = { TLS_psk_dhe_ke };
+	size_t psk_exts_len = 0;
+	uint32_t obfuscated_ticket_age;
+	uint8_t binder_key[32];
+	int selected_identity;
+	uint8_t *p;
+	const DIGEST *early_digest = NULL;
+	const BLOCK_CIPHER *early_cipher = NULL;
+	int early_data_accepted;
+	uint16_t record_size_limit;
+	int max_fragment_length;
 
 	uint8_t sig[TLS_MAX_SIGNATURE_SIZE];
 	size_t siglen = sizeof(sig);
@@ -1504,27 +2937,21 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	const uint8_t *server_verify_data;
 	size_t server_verify_data_len;
 
-	SM2_KEY client_ecdhe;
 	SM2_Z256_POINT server_ecdhe_public;
-	SM2_KEY server_sign_key;
 
-	const DIGEST *digest = DIGEST_sm3();
-	DIGEST_CTX dgst_ctx; // secret generation过程中需要ClientHello等数据输入的
-	DIGEST_CTX null_dgst_ctx; // secret generation过程中不需要握手数据的
-	const BLOCK_CIPHER *cipher = NULL;
 	size_t padding_len;
 
 	uint8_t zeros[32] = {0};
+	uint64_t phase_time;
 	uint8_t psk[32] = {0};
+	sm2_z256_t ecdhe_x;
+	uint8_t ecdhe_secret[32];
 	uint8_t early_secret[32];
 	uint8_t handshake_secret[32];
-	uint8_t master_secret[32];
-	uint8_t client_handshake_traffic_secret[32];
-	uint8_t server_handshake_traffic_secret[32];
 	uint8_t client_application_traffic_secret[32];
 	uint8_t server_application_traffic_secret[32];
-	uint8_t client_write_key[16];
-	uint8_t server_write_key[16];
+	uint8_t client_write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
+	uint8_t server_write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
 
 
 	const uint8_t *request_context;
@@ -1535,39 +2962,189 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	size_t cert_list_len;
 	const uint8_t *cert;
 	size_t certlen;
-
+	const uint8_t *ocsp_resp;
+	size_t ocsp_resp_len;
+	uint8_t *cert_msg = NULL;
+	size_t cert_msg_len;
+	int handshake_type;
+	const uint8_t *handshake_data;
+	size_t handshake_datalen;
+	int alert;
+
+
+	tls_conn_arena_begin(conn, &arena_mark);
+
+	switch (hs->state) {
+	case TLS_state_client_hello: break;
+	case TLS_state_early_data: goto early_data;
+	case TLS_state_server_hello: goto server_hello;
+	case TLS_state_encrypted_extensions: goto encrypted_extensions;
+	case TLS_state_certificate_request: goto certificate_request;
+	case TLS_state_server_certificate: goto server_certificate;
+	case TLS_state_certificate_verify: goto certificate_verify;
+	case TLS_state_finished: goto finished;
+	case TLS_state_handshake_done: goto handshake_done;
+	default:
+		error_print();
+		return -1;
+	}
 
 	conn->is_client = 1;
 	tls_record_set_protocol(enced_record, TLS_protocol_tls12);
 
-	digest_init(&dgst_ctx, digest);
-	null_dgst_ctx = dgst_ctx;
+	hs->digest = DIGEST_sm3();
+	digest_init(&hs->dgst_ctx, hs->digest);
+	hs->null_dgst_ctx = hs->dgst_ctx;
 
 
-	// send ClientHello
+	rand_bytes(hs->client_random, 32); // TLS 1.3 Random 不再包含 UNIX Time
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_ecdhe_key_generate(conn, &hs->ecdhe_key) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+
+	// send ClientHello, again with the same random and key_share after a HelloRetryRequest
+client_hello:
 	tls_trace("send ClientHello\n");
+	if (!client_exts
+		&& !(client_exts = (uint8_t *)arena_alloc(&conn->arena, TLS_MAX_EXTENSIONS_SIZE))) {
+		error_print();
+		goto end;
+	}
 	tls_record_set_protocol(record, TLS_protocol_tls1);
-	rand_bytes(client_random, 32); // TLS 1.3 Random 不再包含 UNIX Time
-	sm2_key_generate(&client_ecdhe);
-	tls13_client_hello_exts_set(client_exts, &client_exts_len, sizeof(client_exts), &(client_ecdhe.public_key));
+	psk_exts_len = 0;
+	tls13_client_hello_exts_set(client_exts, &client_exts_len, TLS_MAX_EXTENSIONS_SIZE, &(hs->ecdhe_key.public_key));
+	if (conn->ocsp_stapling) {
+		p = client_exts + client_exts_len;
+		tls_status_request_ext_to_bytes(&p, &client_exts_len);
+	}
+	if (conn->server_name[0]) {
+		p = client_exts + client_exts_len;
+		tls_server_name_ext_to_bytes(conn->server_name, &p, &client_exts_len);
+	}
+	p = client_exts + client_exts_len;
+	tls_record_size_exts_to_bytes(conn, &p, &client_exts_len);
+	if (conn->cert_compression_algors_cnt) {
+		p = client_exts + client_exts_len;
+		tls13_compress_certificate_ext_to_bytes(conn->cert_compression_algors,
+			conn->cert_compression_algors_cnt, &p, &client_exts_len);
+	}
+	if (hs->cookie_len) {
+		if (client_exts_len + 6 + hs->cookie_len > TLS_MAX_EXTENSIONS_SIZE) {
+			error_print();
+			goto end;
+		}
+		p = client_exts + client_exts_len;
+		tls13_cookie_ext_to_bytes(hs->cookie, hs->cookie_len, &p, &client_exts_len);
+	}
+	if (conn->early_data_len) {
+		conn->early_data_status = TLS_early_data_rejected;
+	}
+	if (conn->session.ticketlen
+		&& time(NULL) - conn->session.time < (time_t)conn->session.ticket_lifetime) {
+		// 0-RTT is under the cipher suite of the ticket, its hash is the one of the binder
+		if (conn->early_data_len && !hs->hello_retry
+			&& conn->early_data_len <= conn->session.max_early_data_size
+			&& tls13_cipher_suite_get(conn->session.cipher_suite, &early_digest, &early_cipher) == 1
+			&& early_digest == hs->digest) {
+			hs->early_data_offered = 1;
+			tls13_early_data_ext_to_bytes(NULL, NULL, &psk_exts_len);
+		}
+		// offer the session ticket, pre_shared_key must be the last extension
+		obfuscated_ticket_age = (uint32_t)((time(NULL) - conn->session.time) * 1000)
+			+ conn->session.ticket_age_add;
+		tls13_psk_key_exchange_modes_ext_to_bytes(psk_modes, 1, NULL, &psk_exts_len);
+		tls13_client_pre_shared_key_ext_to_bytes(conn->session.ticket, conn->session.ticketlen,
+			obfuscated_ticket_age, zeros, 32, NULL, &psk_exts_len);
+		if (client_exts_len + psk_exts_len > TLS_MAX_EXTENSIONS_SIZE) {
+			error_print();
+			goto end;
+		}
+		p = client_exts + client_exts_len;
+		if (hs->early_data_offered) {
+			tls13_early_data_ext_to_bytes(NULL, &p, &client_exts_len);
+		}
+		tls13_psk_key_exchange_modes_ext_to_bytes(psk_modes, 1, &p, &client_exts_len);
+		tls13_client_pre_shared_key_ext_to_bytes(conn->session.ticket, conn->session.ticketlen,
+			obfuscated_ticket_age, zeros, 32, &p, &client_exts_len);
+		hs->psk_offered = 1;
+	}
 	tls_record_set_handshake_client_hello(record, &recordlen,
-		TLS_protocol_tls12, client_random, NULL, 0,
+		TLS_protocol_tls12, hs->client_random, NULL, 0,
 		tls13_ciphers, sizeof(tls13_ciphers)/sizeof(tls13_ciphers[0]),
 		client_exts, client_exts_len);
+	if (hs->psk_offered) {
+		// binder = HMAC over the transcript and the ClientHello truncated before binders<2> || binder<1> || 32 bytes
+		DIGEST_CTX binder_dgst_ctx = hs->dgst_ctx;
+		phase_time = tls_handshake_phase_begin(conn);
+		/* [1] */ tls13_hkdf_extract(hs->digest, zeros, conn->session.psk, early_secret);
+		/* [2] */ tls13_derive_secret(early_secret, "res binder", &hs->null_dgst_ctx, binder_key);
+		digest_update(&binder_dgst_ctx, record + 5, recordlen - 5 - (2 + 1 + 32));
+		tls13_compute_verify_data(binder_key, &binder_dgst_ctx, record + recordlen - 32, &verify_data_len);
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		gmssl_secure_clear(binder_key, sizeof(binder_key));
+	}
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	// 此时尚未确定digest算法，因此无法digest_update
+	// 目前只支持SM3，ServerHello确定的digest算法与此相同
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+
+	if (hs->early_data_offered) {
+		phase_time = tls_handshake_phase_begin(conn);
+		/* [3] */ tls13_derive_secret(early_secret, "c e traffic", &hs->dgst_ctx, hs->client_early_traffic_secret);
+		tls13_set_early_data_key(conn, early_digest, early_cipher, &conn->client_write_key, conn->client_write_iv);
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		memset(conn->client_seq_num, 0, 8);
+	}
+
+
+	// send [EarlyData], in the flight of ClientHello as long as it fits
+	hs->state = TLS_state_early_data;
+early_data:
+	while (hs->early_data_offered && hs->early_data_sent < conn->early_data_len) {
+		size_t len = conn->early_data_len - hs->early_data_sent;
+		uint8_t *enced;
+
+		if (len > TLS_MAX_PLAINTEXT_SIZE) {
+			len = TLS_MAX_PLAINTEXT_SIZE;
+		}
+		if (TLS_RECORD_HEADER_SIZE + len + TLS13_GCM_TAILROOM
+			> TLS_MAX_RECORD_SIZE - (conn->sendbuf_len - conn->sendbuf_offset)) {
+			if ((rv = tls_flush(conn)) != 1) {
+				goto wait;
+			}
+		}
+		tls_trace("send [EarlyData]\n");
+		if (!(enced = tls_conn_record_reserve(conn, TLS_RECORD_HEADER_SIZE + len + TLS13_GCM_TAILROOM))
+			|| tls13_gcm_encrypt(&conn->client_write_key, conn->client_write_iv, conn->client_seq_num,
+				TLS_record_application_data, conn->early_data + hs->early_data_sent, len, 0,
+				enced + 5, &enced_recordlen) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		enced[0] = TLS_record_application_data;
+		enced[1] = TLS_protocol_tls12 >> 8;
+		enced[2] = TLS_protocol_tls12 & 0xff;
+		enced[3] = (uint8_t)(enced_recordlen >> 8);
+		enced[4] = (uint8_t)(enced_recordlen);
+		conn->sendbuf_len += TLS_RECORD_HEADER_SIZE + enced_recordlen;
+		tls_seq_num_incr(conn->client_seq_num);
+		hs->early_data_sent += len;
+	}
 
 
 	// recv ServerHello
+	hs->state = TLS_state_server_hello;
+server_hello:
 	tls_trace("recv ServerHello\n");
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	tls13_record_trace(stderr, enced_record, enced_recordlen, 0, 0);
 	if (tls_record_get_handshake_server_hello(enced_record,
@@ -1582,29 +3159,67 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_protocol_version);
 		goto end;
 	}
-	memcpy(server_random, random, 32);
+	if (memcmp(random, tls13_hello_retry_request_random, 32) == 0) {
+		uint8_t dgst[DIGEST_MAX_SIZE];
+		size_t dgstlen;
+
+		tls_trace("recv HelloRetryRequest\n");
+		// a single retry, asking for the cookie of a stateless server
+		if (hs->hello_retry
+			|| tls_cipher_suite_in_list(cipher_suite,
+				tls13_ciphers, sizeof(tls13_ciphers)/sizeof(tls13_ciphers[0])) != 1
+			|| tls13_process_hello_retry_request_exts(server_exts, server_exts_len,
+				hs->cookie, &hs->cookie_len) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_illegal_parameter);
+			goto end;
+		}
+		conn->cipher_suite = cipher_suite;
+		digest_finish(&hs->dgst_ctx, dgst, &dgstlen);
+		tls13_hello_retry_transcript(&hs->dgst_ctx, hs->digest, dgst, dgstlen,
+			enced_record + 5, enced_recordlen - 5);
+		hs->hello_retry = 1;
+		// 0-RTT already sent is rejected, the second ClientHello does not offer it
+		hs->early_data_offered = 0;
+		hs->psk_offered = 0;
+		goto client_hello;
+	}
+	memcpy(hs->server_random, random, 32);
 	memcpy(conn->session_id, session_id, session_id_len);
 	conn->session_id_len = session_id_len;
 	if (tls_cipher_suite_in_list(cipher_suite,
-		tls13_ciphers, sizeof(tls13_ciphers)/sizeof(tls13_ciphers[0])) != 1) {
+		tls13_ciphers, sizeof(tls13_ciphers)/sizeof(tls13_ciphers[0])) != 1
+		|| (hs->hello_retry && cipher_suite != conn->cipher_suite)) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_handshake_failure);
 		goto end;
 	}
 	conn->cipher_suite = cipher_suite;
-	if (tls13_server_hello_extensions_get(server_exts, server_exts_len, &server_ecdhe_public) != 1) {
+	if (tls13_server_hello_extensions_get(server_exts, server_exts_len, &server_ecdhe_public,
+		&selected_identity) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_handshake_failure);
 		goto end;
 	}
+	if (selected_identity >= 0) {
+		if (!hs->psk_offered || selected_identity != 0
+			|| cipher_suite != conn->session.cipher_suite) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_illegal_parameter);
+			goto end;
+		}
+		hs->psk_accepted = 1;
+		conn->session_reused = 1;
+		memcpy(psk, conn->session.psk, 32);
+	}
 	conn->protocol = TLS_protocol_tls13;
+	// the handshake key replaces the early key, which is needed again for EndOfEarlyData
+	memcpy(hs->early_seq_num, conn->client_seq_num, 8);
 
-	tls13_cipher_suite_get(conn->cipher_suite, &digest, &cipher);
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
-	digest_update(&dgst_ctx, enced_record + 5, enced_recordlen - 5);
+	tls13_cipher_suite_get(conn->cipher_suite, &hs->digest, &hs->cipher);
+	digest_update(&hs->dgst_ctx, enced_record + 5, enced_recordlen - 5);
 
 
-	printf("generate handshake secrets\n");
 	/*
 	generate handshake keys
 		uint8_t client_write_key[32]
@@ -1612,24 +3227,28 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		uint8_t client_write_iv[12]
 		uint8_t server_write_iv[12]
 	*/
-	sm2_do_ecdh(&client_ecdhe, &server_ecdhe_public, &server_ecdhe_public);
-	/* [1]  */ tls13_hkdf_extract(digest, zeros, psk, early_secret);
-	/* [5]  */ tls13_derive_secret(early_secret, "derived", &null_dgst_ctx, handshake_secret);
-	/* [6]  */ tls13_hkdf_extract(digest, handshake_secret, (uint8_t *)&server_ecdhe_public, handshake_secret);
-	/* [7]  */ tls13_derive_secret(handshake_secret, "c hs traffic", &dgst_ctx, client_handshake_traffic_secret);
-	/* [8]  */ tls13_derive_secret(handshake_secret, "s hs traffic", &dgst_ctx, server_handshake_traffic_secret);
-	/* [9]  */ tls13_derive_secret(handshake_secret, "derived", &null_dgst_ctx, master_secret);
-	/* [10] */ tls13_hkdf_extract(digest, master_secret, zeros, master_secret);
+	phase_time = tls_handshake_phase_begin(conn);
+	sm2_do_ecdh(&hs->ecdhe_key, &server_ecdhe_public, &server_ecdhe_public);
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	sm2_z256_point_get_xy(&server_ecdhe_public, ecdhe_x, NULL);
+	sm2_z256_to_bytes(ecdhe_x, ecdhe_secret);
+	phase_time = tls_handshake_phase_begin(conn);
+	/* [1]  */ tls13_hkdf_extract(hs->digest, zeros, psk, early_secret);
+	/* [5]  */ tls13_derive_secret(early_secret, "derived", &hs->null_dgst_ctx, handshake_secret);
+	/* [6]  */ tls13_hkdf_extract(hs->digest, handshake_secret, ecdhe_secret, handshake_secret);
+	/* [7]  */ tls13_derive_secret(handshake_secret, "c hs traffic", &hs->dgst_ctx, hs->client_handshake_traffic_secret);
+	/* [8]  */ tls13_derive_secret(handshake_secret, "s hs traffic", &hs->dgst_ctx, hs->server_handshake_traffic_secret);
+	/* [9]  */ tls13_derive_secret(handshake_secret, "derived", &hs->null_dgst_ctx, hs->master_secret);
+	/* [10] */ tls13_hkdf_extract(hs->digest, hs->master_secret, zeros, hs->master_secret);
 	//[sender]_write_key = HKDF-Expand-Label(Secret, "key", "", key_length)
 	//[sender]_write_iv  = HKDF-Expand-Label(Secret, "iv", "", iv_length)
 	//[sender] in {server, client}
-	tls13_hkdf_expand_label(digest, server_handshake_traffic_secret, "key", NULL, 0, 16, server_write_key);
-	tls13_hkdf_expand_label(digest, server_handshake_traffic_secret, "iv", NULL, 0, 12, conn->server_write_iv);
-	block_cipher_set_encrypt_key(&conn->server_write_key, cipher, server_write_key);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->server_handshake_traffic_secret, hs->cipher->key_size, server_write_key, conn->server_write_iv);
+	block_cipher_set_encrypt_key(&conn->server_write_key, hs->cipher, server_write_key);
 	memset(conn->server_seq_num, 0, 8);
-	tls13_hkdf_expand_label(digest, client_handshake_traffic_secret, "key", NULL, 0, 16, client_write_key);
-	tls13_hkdf_expand_label(digest, client_handshake_traffic_secret, "iv", NULL, 0, 12, conn->client_write_iv);
-	block_cipher_set_encrypt_key(&conn->client_write_key, cipher, client_write_key);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->client_handshake_traffic_secret, hs->cipher->key_size, client_write_key, conn->client_write_iv);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+	block_cipher_set_encrypt_key(&conn->client_write_key, hs->cipher, client_write_key);
 	memset(conn->client_seq_num, 0, 8);
 	/*
 	format_bytes(stderr, 0, 4, "client_write_key", client_write_key, 16);
@@ -1640,11 +3259,10 @@ int tls13_do_connect(TLS_CONNECT *conn)
 	*/
 
 	// recv {EncryptedExtensions}
-	printf("recv {EncryptedExtensions}\n");
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_handshake_failure);
-		goto end;
+	hs->state = TLS_state_encrypted_extensions;
+encrypted_extensions:
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
 		conn->server_seq_num, enced_record, enced_recordlen,
@@ -1654,20 +3272,41 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls13_record_get_handshake_encrypted_extensions(record) != 1) {
+	if (tls13_record_get_handshake_encrypted_extensions(record, &early_data_accepted,
+		&record_size_limit, &max_fragment_length) != 1) {
 		tls_send_alert(conn, TLS_alert_handshake_failure);
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	if (tls_process_record_size(conn, record_size_limit, max_fragment_length) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_illegal_parameter);
+		goto end;
+	}
+	if (early_data_accepted) {
+		if (!hs->early_data_offered || !hs->psk_accepted) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_illegal_parameter);
+			goto end;
+		}
+		conn->early_data_status = TLS_early_data_accepted;
+	}
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
+	if (hs->psk_accepted) {
+		// resumed handshake is authenticated by the PSK, no certificates
+		conn->client_certs_len = 0;
+		hs->state = TLS_state_finished;
+		goto finished;
+	}
+
 
 	// recv {CertififcateRequest*} or {Certificate}
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_handshake_failure);
-		goto end;
+	hs->state = TLS_state_certificate_request;
+certificate_request:
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
 		conn->server_seq_num, enced_record, enced_recordlen,
@@ -1686,74 +3325,105 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		tls13_record_trace(stderr, record, recordlen, 0, 0);
 		if (tls13_record_get_handshake_certificate_request(record,
 			&request_context, &request_context_len,
-			&cert_request_exts, &cert_request_extslen) != 1) {
-			error_print();
-			tls_send_alert(conn, TLS_alert_handshake_failure);
-			goto end;
-		}
-		// 当前忽略 request_context 和 cert_request_exts
-		// request_context 应该为空，当前实现中不支持Post-Handshake Auth
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
-		tls_seq_num_incr(conn->server_seq_num);
-
-
-		// recv {Certificate}
-		if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
+			&cert_request_exts, &cert_request_extslen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_handshake_failure);
 			goto end;
 		}
-		if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
-			conn->server_seq_num, enced_record, enced_recordlen,
-			record, &recordlen) != 1) {
-			error_print();
-			tls_send_alert(conn, TLS_alert_bad_record_mac);
-			goto end;
-		}
+		// 当前忽略 request_context 和 cert_request_exts
+		// request_context 应该为空，当前实现中不支持Post-Handshake Auth
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+		tls_seq_num_incr(conn->server_seq_num);
 	} else {
 		conn->client_certs_len = 0;
 		// 清空客户端签名密钥
+		goto recv_server_certificate;
 	}
 
 	// recv {Certificate}
+	hs->state = TLS_state_server_certificate;
+server_certificate:
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
+	}
+	if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
+		conn->server_seq_num, enced_record, enced_recordlen,
+		record, &recordlen) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_bad_record_mac);
+		goto end;
+	}
+recv_server_certificate:
 	tls_trace("recv {Certificate}\n");
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls13_record_get_handshake_certificate(record,
+	if (tls_record_get_handshake(record, &handshake_type, &handshake_data, &handshake_datalen) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_unexpected_message);
+		goto end;
+	}
+	if (handshake_type == TLS_handshake_compressed_certificate && conn->cert_compression_algors_cnt) {
+		if (tls13_decompress_certificate(handshake_data, handshake_datalen,
+			conn->cert_compression_algors, conn->cert_compression_algors_cnt,
+			&cert_msg, &cert_msg_len) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_bad_certificate);
+			goto end;
+		}
+		if (tls13_certificate_from_bytes(&request_context, &request_context_len,
+			&cert_list, &cert_list_len, cert_msg, cert_msg_len) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_bad_certificate);
+			goto end;
+		}
+	} else if (tls13_record_get_handshake_certificate(record,
 		&request_context, &request_context_len,
 		&cert_list, &cert_list_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	if (tls13_process_certificate_list(cert_list, cert_list_len, conn->server_certs, &conn->server_certs_len) != 1) {
+	if (tls_conn_certs_reserve(&conn->server_certs, cert_list_len) != 1
+		|| tls13_process_certificate_list(cert_list, cert_list_len, conn->server_certs, &conn->server_certs_len,
+			conn->ocsp_stapling ? &ocsp_resp : NULL, &ocsp_resp_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
 	if (x509_certs_get_cert_by_index(conn->server_certs, conn->server_certs_len, 0, &cert, &certlen) != 1
-		|| x509_cert_get_subject_public_key(cert, certlen, &server_sign_key) != 1) {
+		|| x509_cert_get_subject_public_key(cert, certlen, &hs->peer_sign_key) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 	// verify ServerCertificate
 	int verify_result = 0; // TODO: maybe remove this arg from x509_certs_verify()
-	if (x509_certs_verify(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
-		conn->ca_certs, conn->ca_certs_len, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+	phase_time = tls_handshake_phase_begin(conn);
+	if (x509_certs_verify_ex(conn->server_certs, conn->server_certs_len, X509_cert_chain_server,
+		conn->ca_certs, conn->ca_certs_len, conn->ca_store, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_certificate);
 		goto end;
 	}
+	if (conn->ocsp_stapling
+		&& tls_process_ocsp_response(conn, ocsp_resp, ocsp_resp_len, &alert) != 1) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	// the certificates are copied and the OCSP response is processed
+	free(cert_msg);
+	cert_msg = NULL;
+	tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
 
 	// recv {CertificateVerify}
+	hs->state = TLS_state_certificate_verify;
+certificate_verify:
 	tls_trace("recv {CertificateVerify}\n");
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
 		conn->server_seq_num, enced_record, enced_recordlen,
@@ -1774,25 +3444,22 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	if (tls13_verify_certificate_verify(TLS_server_mode, &server_sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &dgst_ctx, server_sig, server_siglen) != 1) {
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls13_verify_certificate_verify(TLS_server_mode, &hs->peer_sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &hs->dgst_ctx, server_sig, server_siglen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 
-	// use Transcript-Hash(Handshake Context, Certificate*, CertificateVerify*)
-	tls13_compute_verify_data(server_handshake_traffic_secret,
-		&dgst_ctx, verify_data, &verify_data_len);
-
-
 	// recv {Finished}
+	hs->state = TLS_state_finished;
+finished:
 	tls_trace("recv {Finished}\n");
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	if (tls13_record_decrypt(&conn->server_write_key, conn->server_write_iv,
 		conn->server_seq_num, enced_record, enced_recordlen,
@@ -1808,20 +3475,29 @@ int tls13_do_connect(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
+	// use Transcript-Hash(Handshake Context, Certificate*, CertificateVerify*)
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_compute_verify_data(hs->server_handshake_traffic_secret,
+		&hs->dgst_ctx, verify_data, &verify_data_len);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (server_verify_data_len != verify_data_len
 		|| memcmp(server_verify_data, verify_data, verify_data_len) != 0) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 
 	// generate server_application_traffic_secret
-	/* [12] */ tls13_derive_secret(master_secret, "s ap traffic", &dgst_ctx, server_application_traffic_secret);
+	phase_time = tls_handshake_phase_begin(conn);
+	/* [12] */ tls13_derive_secret(hs->master_secret, "s ap traffic", &hs->dgst_ctx, server_application_traffic_secret);
 	// generate client_application_traffic_secret
-	/* [11] */ tls13_derive_secret(master_secret, "c ap traffic", &dgst_ctx, client_application_traffic_secret);
+	/* [11] */ tls13_derive_secret(hs->master_secret, "c ap traffic", &hs->dgst_ctx, client_application_traffic_secret);
+	memcpy(conn->client_application_traffic_secret, client_application_traffic_secret, 32);
+	memcpy(conn->server_application_traffic_secret, server_application_traffic_secret, 32);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 
 
 	if (conn->client_certs_len) {
@@ -1831,9 +3507,7 @@ int tls13_do_connect(TLS_CONNECT *conn)
 
 		// send client {Certificate*}
 		tls_trace("send {Certificate*}\n");
-		if (tls13_record_set_handshake_certificate(record, &recordlen,
-			NULL, 0, // certificate_request_context
-			conn->client_certs, conn->client_certs_len) != 1) {
+		if (tls_conn_set_handshake_certificate(conn, record, &recordlen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
@@ -1847,123 +3521,580 @@ int tls13_do_connect(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
-		if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+		if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 		tls_seq_num_incr(conn->client_seq_num);
 
 
 		// send {CertificateVerify*}
 		tls_trace("send {CertificateVerify*}\n");
 		client_sign_algor = TLS_sig_sm2sig_sm3; // FIXME: 应该放在conn里面
-		tls13_sign_certificate_verify(TLS_client_mode, &conn->sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &dgst_ctx, sig, &siglen);
+		phase_time = tls_handshake_phase_begin(conn);
+		tls13_sign_certificate_verify(TLS_client_mode, conn->sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &hs->dgst_ctx, sig, &siglen);
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
 		if (tls13_record_set_handshake_certificate_verify(record, &recordlen,
 			client_sign_algor, sig, siglen) != 1) {
 			error_print();
-			tls_send_alert(conn, TLS_alert_internal_error);
-			goto end;
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls13_record_trace(stderr, record, recordlen, 0, 0);
+		tls13_padding_len_rand(&padding_len);
+		if (tls13_record_encrypt(&conn->client_write_key, conn->client_write_iv,
+			conn->client_seq_num, record, recordlen, padding_len,
+			enced_record, &enced_recordlen) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
+			error_print();
+			goto end;
+		}
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+		tls_seq_num_incr(conn->client_seq_num);
+	}
+
+	// send (EndOfEarlyData), the last record under the early key
+	if (conn->early_data_status == TLS_early_data_accepted) {
+		BLOCK_CIPHER_KEY early_write_key;
+		uint8_t early_write_iv[12];
+
+		tls_trace("send (EndOfEarlyData)\n");
+		tls13_set_early_data_key(conn, hs->digest, hs->cipher, &early_write_key, early_write_iv);
+		tls_record_set_handshake(record, &recordlen, TLS_handshake_end_of_early_data, NULL, 0);
+		tls13_record_trace(stderr, record, recordlen, 0, 0);
+		tls13_padding_len_rand(&padding_len);
+		rv = tls13_record_encrypt(&early_write_key, early_write_iv,
+			hs->early_seq_num, record, recordlen, padding_len,
+			enced_record, &enced_recordlen);
+		gmssl_secure_clear(&early_write_key, sizeof(early_write_key));
+		if (rv != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
+			error_print();
+			goto end;
+		}
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+	}
+
+	// send Client {Finished}
+	tls_trace("send {Finished}\n");
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_compute_verify_data(hs->client_handshake_traffic_secret, &hs->dgst_ctx, verify_data, &verify_data_len);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+	if (tls_record_set_handshake_finished(record, &recordlen, verify_data, verify_data_len) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	tls13_record_trace(stderr, record, recordlen, 0, 0);
+	tls13_padding_len_rand(&padding_len);
+	if (tls13_record_encrypt(&conn->client_write_key, conn->client_write_iv,
+		conn->client_seq_num, record, recordlen, padding_len,
+		enced_record, &enced_recordlen) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
+		error_print();
+		goto end;
+	}
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+	tls_seq_num_incr(conn->client_seq_num);
+
+	// for the PSK of a later NewSessionTicket
+	phase_time = tls_handshake_phase_begin(conn);
+	/* [14] */ tls13_derive_secret(hs->master_secret, "res master", &hs->dgst_ctx, conn->resumption_master_secret);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+
+
+	// update server_write_key, server_write_iv, reset server_seq_num
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_hkdf_expand_key_iv(hs->digest, server_application_traffic_secret, hs->cipher->key_size, server_write_key, conn->server_write_iv);
+	block_cipher_set_encrypt_key(&conn->server_write_key, hs->cipher, server_write_key);
+	memset(conn->server_seq_num, 0, 8);
+	/*
+	format_print(stderr, 0, 0, "update server secrets\n");
+	format_bytes(stderr, 0, 4, "server_write_key", server_write_key, 16);
+	format_bytes(stderr, 0, 4, "server_write_iv", conn->server_write_iv, 12);
+	format_print(stderr, 0, 0, "\n");
+	*/
+
+	//update client_write_key, client_write_iv, reset client_seq_num
+	tls13_hkdf_expand_key_iv(hs->digest, client_application_traffic_secret, hs->cipher->key_size, client_write_key, conn->client_write_iv);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+	block_cipher_set_encrypt_key(&conn->client_write_key, hs->cipher, client_write_key);
+	memset(conn->client_seq_num, 0, 8);
+	if (conn->ktls_requested) {
+		memcpy(hs->client_write_key, client_write_key, 16);
+		memcpy(hs->server_write_key, server_write_key, 16);
+	}
+
+	/*
+	format_print(stderr, 0, 0, "update client secrets\n");
+	format_bytes(stderr, 0, 4, "client_write_key", client_write_key, 16);
+	format_bytes(stderr, 0, 4, "client_write_iv", conn->client_write_iv, 12);
+	format_print(stderr, 0, 0, "\n");
+	*/
+
+	hs->state = TLS_state_handshake_done;
+handshake_done:
+	if ((rv = tls_flush(conn)) != 1) {
+		goto wait;
+	}
+#ifdef ENABLE_KTLS
+	if (conn->ktls_requested
+		&& tls13_ktls_enable(conn, hs->client_write_key, hs->server_write_key) < 0) {
+		error_print();
+		goto end;
+	}
+#endif
+
+	if (!conn->quiet)
+		fprintf(stderr, "Connection established\n");
+
+	ret = 1;
+	goto end;
+
+wait:
+	if (rv == TLS_ERROR_WANT_READ || rv == TLS_ERROR_WANT_WRITE) {
+		tls_conn_arena_end(conn, &arena_mark, 0);
+		return rv;
+	}
+	error_print();
+	tls_send_alert(conn, TLS_alert_unexpected_message);
+end:
+	if (cert_msg) free(cert_msg);
+	tls_conn_arena_end(conn, &arena_mark, 1);
+	gmssl_secure_clear(hs, sizeof(TLS_HANDSHAKE));
+	gmssl_secure_clear(psk, sizeof(psk));
+	gmssl_secure_clear(early_secret, sizeof(early_secret));
+	gmssl_secure_clear(handshake_secret, sizeof(handshake_secret));
+	gmssl_secure_clear(client_application_traffic_secret, sizeof(client_application_traffic_secret));
+	gmssl_secure_clear(server_application_traffic_secret, sizeof(server_application_traffic_secret));
+	gmssl_secure_clear(client_write_key, sizeof(client_write_key));
+	gmssl_secure_clear(server_write_key, sizeof(server_write_key));
+	return ret;
+}
+
+static int tls13_client_hello_has_early_data(const uint8_t *exts, size_t extslen)
+{
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			return 0;
+		}
+		if (ext_type == TLS_extension_early_data) {
+			return tls13_process_early_data(ext_data, ext_datalen, NULL) == 1;
+		}
+	}
+	return 0;
+}
+
+static int tls13_client_hello_has_status_request(const uint8_t *exts, size_t extslen)
+{
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			return 0;
+		}
+		if (ext_type == TLS_extension_status_request) {
+			return tls_process_status_request(ext_data, ext_datalen) == 1;
+		}
+	}
+	return 0;
+}
+
+// the algorithm to compress the server Certificate, 0 if none
+static int tls13_client_hello_get_cert_compression(const TLS_CONNECT *conn, const uint8_t *exts, size_t extslen)
+{
+	int algor;
+
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			return 0;
+		}
+		if (ext_type == TLS_extension_compress_certificate) {
+			if (tls13_process_compress_certificate(ext_data, ext_datalen,
+				conn->cert_compression_algors, conn->cert_compression_algors_cnt, &algor) != 1) {
+				return 0;
+			}
+			return algor;
+		}
+	}
+	return 0;
+}
+
+// replace the Certificate in `record` by a CompressedCertificate, return 0 if it does not pay
+// the default chain without a stapled response is compressed by tls_ctx_set_certificate_compression()
+static int tls13_record_compress_certificate(const TLS_CONNECT *conn, int algor, int compress_now,
+	uint8_t *record, size_t *recordlen)
+{
+	uint8_t *buf;
+	size_t len;
+	size_t i;
+	int ret;
+
+	if (!compress_now) {
+		for (i = 0; i < conn->cert_compression_algors_cnt; i++) {
+			if (conn->cert_compression_algors[i] == algor) {
+				break;
+			}
+		}
+		if (i == conn->cert_compression_algors_cnt || !conn->compressed_certs[i]) {
+			return 0;
+		}
+		if (tls_record_set_handshake(record, recordlen, TLS_handshake_compressed_certificate,
+			conn->compressed_certs[i], conn->compressed_certs_len[i]) != 1) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+
+	if (!(buf = tls_buffer_get())) {
+		error_print();
+		return -1;
+	}
+	ret = tls13_compress_certificate(algor,
+		record + TLS_RECORD_HEADER_SIZE + TLS_HANDSHAKE_HEADER_SIZE,
+		*recordlen - TLS_RECORD_HEADER_SIZE - TLS_HANDSHAKE_HEADER_SIZE,
+		buf, &len, TLS_MAX_HANDSHAKE_DATA_SIZE);
+	if (ret == 1 && tls_record_set_handshake(record, recordlen,
+		TLS_handshake_compressed_certificate, buf, len) != 1) {
+		ret = -1;
+	}
+	tls_buffer_put(buf);
+	if (ret < 0) {
+		error_print();
+		return -1;
+	}
+	return ret;
+}
+
+/*
+ * Group of the share to ask in a HelloRetryRequest, 0 if the ClientHello has
+ * a sm2p256v1 share, or if sm2p256v1 is not supported and a retry can not help.
+ * A share of another group is ignored as long as the sm2p256v1 one is present.
+ */
+static int tls13_client_hello_key_share_group(const uint8_t *exts, size_t extslen)
+{
+	int has_share = 0;
+	int supported = 0;
+
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+		const uint8_t *groups;
+		size_t groups_len;
+		uint16_t group;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			return 0;
+		}
+		switch (ext_type) {
+		case TLS_extension_key_share:
+			has_share = tls13_client_key_share_has_group(ext_data, ext_datalen, TLS_curve_sm2p256v1) == 1;
+			break;
+		case TLS_extension_supported_groups:
+			if (tls_uint16array_from_bytes(&groups, &groups_len, &ext_data, &ext_datalen) != 1) {
+				return 0;
+			}
+			while (tls_uint16_from_bytes(&group, &groups, &groups_len) == 1) {
+				if (group == TLS_curve_sm2p256v1) {
+					supported = 1;
+				}
+			}
+			break;
+		}
+	}
+	return (supported && !has_share) ? TLS_curve_sm2p256v1 : 0;
+}
+
+/*
+ * HelloRetryRequest asking for the cookie of the handshake guard, for the
+ * sm2p256v1 share missing in the ClientHello, or for both. The retry state is
+ * the cipher suite, the asked group and the hash of the first ClientHello. It
+ * is carried by the cookie of a stateless retry, or kept in the handshake if
+ * only the share is asked. Return 1 to go on with the ClientHello, after
+ * restarting the transcript if it is the second one, or 0 when a
+ * HelloRetryRequest is queued.
+ */
+static int tls13_server_hello_retry(TLS_CONNECT *conn, const uint8_t *record, size_t recordlen,
+	const uint8_t *exts, size_t extslen, int *alert)
+{
+	TLS_HANDSHAKE *hs = &conn->hs;
+	const uint8_t *client_exts = exts;
+	size_t client_exts_len = extslen;
+	const uint8_t *cookie = NULL;
+	size_t cookielen = 0;
+	const uint8_t *data;
+	size_t datalen;
+	uint16_t cipher_suite;
+	uint16_t selected_group;
+	int group;
+	int cookie_required;
+	uint8_t state[4 + DIGEST_MAX_SIZE]; // cipher_suite || selected_group || Hash(ClientHello1)
+	uint8_t *p = state;
+	size_t len = 0;
+	size_t dgstlen;
+	DIGEST_CTX dgst_ctx;
+	uint8_t buf[TLS13_MAX_COOKIE_SIZE];
+	uint8_t hello_retry_request[64 + TLS13_MAX_COOKIE_SIZE];
+	size_t hello_retry_request_len;
+
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			*alert = TLS_alert_decode_error;
+			return -1;
+		}
+		// a server without the guard never sends a cookie
+		if (ext_type == TLS_extension_cookie && conn->handshake_guard
+			&& tls13_process_cookie(ext_data, ext_datalen, &cookie, &cookielen) != 1) {
+			error_print();
+			*alert = TLS_alert_decode_error;
+			return -1;
+		}
+	}
+	group = tls13_client_hello_key_share_group(client_exts, client_exts_len);
+
+	if (cookie || hs->hello_retry) {
+		if (cookie) {
+			if (tls_handshake_guard_open_cookie(conn->handshake_guard, cookie, cookielen, &data, &datalen) != 1) {
+				error_print();
+				*alert = TLS_alert_illegal_parameter;
+				return -1;
+			}
+		} else if (hs->hello_retry_state_len) {
+			data = hs->hello_retry_state;
+			datalen = hs->hello_retry_state_len;
+		} else {
+			// the second ClientHello without the cookie
+			error_print();
+			*alert = TLS_alert_illegal_parameter;
+			return -1;
 		}
-		tls13_record_trace(stderr, record, recordlen, 0, 0);
-		tls13_padding_len_rand(&padding_len);
-		if (tls13_record_encrypt(&conn->client_write_key, conn->client_write_iv,
-			conn->client_seq_num, record, recordlen, padding_len,
-			enced_record, &enced_recordlen) != 1) {
+		if (tls_uint16_from_bytes(&cipher_suite, &data, &datalen) != 1
+			|| cipher_suite != conn->cipher_suite
+			|| tls_uint16_from_bytes(&selected_group, &data, &datalen) != 1
+			|| group // still without the sm2p256v1 share
+			|| datalen != hs->digest->digest_size
+			|| hs->early_data_offered) {
 			error_print();
-			tls_send_alert(conn, TLS_alert_internal_error);
-			goto end;
+			*alert = TLS_alert_illegal_parameter;
+			return -1;
 		}
-		if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+		if (tls13_record_set_hello_retry_request(hello_retry_request, &hello_retry_request_len,
+			conn->cipher_suite, cookie, cookielen, selected_group) != 1) {
 			error_print();
-			goto end;
+			*alert = TLS_alert_internal_error;
+			return -1;
 		}
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
-		tls_seq_num_incr(conn->client_seq_num);
+		tls13_hello_retry_transcript(&hs->dgst_ctx, hs->digest, data, datalen,
+			hello_retry_request + 5, hello_retry_request_len - 5);
+		hs->hello_retry = 1;
+		hs->hello_retry_state_len = 0;
+		return 1;
+	}
+	cookie_required = conn->handshake_guard
+		&& tls_handshake_guard_cookie_required(conn->handshake_guard);
+	if (!cookie_required && !group) {
+		return 1;
 	}
 
-	// send Client {Finished}
-	tls_trace("send {Finished}\n");
-	tls13_compute_verify_data(client_handshake_traffic_secret, &dgst_ctx, verify_data, &verify_data_len);
-	if (tls_record_set_handshake_finished(record, &recordlen, verify_data, verify_data_len) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_internal_error);
-		goto end;
+	tls_trace("send HelloRetryRequest\n");
+	dgst_ctx = hs->null_dgst_ctx;
+	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	tls_uint16_to_bytes((uint16_t)conn->cipher_suite, &p, &len);
+	tls_uint16_to_bytes((uint16_t)group, &p, &len);
+	digest_finish(&dgst_ctx, p, &dgstlen);
+	len += dgstlen;
+	if (cookie_required) {
+		if (tls_handshake_guard_seal_cookie(conn->handshake_guard, state, len, buf, &cookielen, sizeof(buf)) != 1) {
+			error_print();
+			*alert = TLS_alert_internal_error;
+			return -1;
+		}
+	} else {
+		memcpy(hs->hello_retry_state, state, len);
+		hs->hello_retry_state_len = len;
 	}
-	tls13_record_trace(stderr, record, recordlen, 0, 0);
-	tls13_padding_len_rand(&padding_len);
-	if (tls13_record_encrypt(&conn->client_write_key, conn->client_write_iv,
-		conn->client_seq_num, record, recordlen, padding_len,
-		enced_record, &enced_recordlen) != 1) {
+	if (tls13_record_set_hello_retry_request(hello_retry_request, &hello_retry_request_len,
+		conn->cipher_suite, buf, cookielen, group) != 1) {
 		error_print();
-		tls_send_alert(conn, TLS_alert_internal_error);
-		goto end;
+		*alert = TLS_alert_internal_error;
+		return -1;
 	}
-	if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+	tls13_record_trace(stderr, hello_retry_request, hello_retry_request_len, 0, 0);
+	if (tls_conn_record_send(conn, hello_retry_request, hello_retry_request_len) != 1) {
 		error_print();
-		goto end;
+		*alert = TLS_alert_internal_error;
+		return -1;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
-	tls_seq_num_incr(conn->client_seq_num);
-
-
+	hs->hello_retry = 1;
+	if (hs->early_data_offered) {
+		// skipped until the second ClientHello
+		conn->early_data_status = TLS_early_data_rejected;
+	}
+	return 0;
+}
 
-	// update server_write_key, server_write_iv, reset server_seq_num
-	tls13_hkdf_expand_label(digest, server_application_traffic_secret, "key", NULL, 0, 16, server_write_key);
-	block_cipher_set_encrypt_key(&conn->server_write_key, cipher, server_write_key);
-	tls13_hkdf_expand_label(digest, server_application_traffic_secret, "iv", NULL, 0, 12, conn->server_write_iv);
-	memset(conn->server_seq_num, 0, 8);
-	/*
-	format_print(stderr, 0, 0, "update server secrets\n");
-	format_bytes(stderr, 0, 4, "server_write_key", server_write_key, 16);
-	format_bytes(stderr, 0, 4, "server_write_iv", conn->server_write_iv, 12);
-	format_print(stderr, 0, 0, "\n");
-	*/
+// return 1 if the ticket in ClientHello is accepted, 0 for a full handshake
+// the offered 0-RTT is accepted if the ticket age is in the window and the binder is fresh
+static int tls13_process_client_hello_psk(TLS_CONNECT *conn, const DIGEST_CTX *transcript,
+	const uint8_t *record, size_t recordlen, const uint8_t *exts, size_t extslen,
+	uint8_t psk[32], int *early_data)
+{
+	int psk_dhe_ke = 0;
+	const uint8_t *identity = NULL;
+	size_t identitylen;
+	uint32_t obfuscated_ticket_age;
+	const uint8_t *binder;
+	size_t binderlen;
+	size_t binders_size;
+	int cipher_suite;
+	uint32_t issue_time;
+	uint32_t ticket_age_add;
+	DIGEST_CTX dgst_ctx;
+	uint8_t zeros[32] = {0};
+	uint64_t phase_time;
+	uint8_t early_secret[32];
+	uint8_t binder_key[32];
+	uint8_t verify_data[32];
+	size_t verify_data_len;
+	int64_t age_diff;
+	int ret;
 
-	//update client_write_key, client_write_iv, reset client_seq_num
-	tls13_hkdf_expand_label(digest, client_application_traffic_secret, "key", NULL, 0, 16, client_write_key);
-	tls13_hkdf_expand_label(digest, client_application_traffic_secret, "iv", NULL, 0, 12, conn->client_write_iv);
-	block_cipher_set_encrypt_key(&conn->client_write_key, cipher, client_write_key);
-	memset(conn->client_seq_num, 0, 8);
+	*early_data = 0;
 
-	/*
-	format_print(stderr, 0, 0, "update client secrets\n");
-	format_bytes(stderr, 0, 4, "client_write_key", client_write_key, 16);
-	format_bytes(stderr, 0, 4, "client_write_iv", conn->client_write_iv, 12);
-	format_print(stderr, 0, 0, "\n");
-	*/
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
 
-	if (!conn->quiet)
-		fprintf(stderr, "Connection established\n");
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		switch (ext_type) {
+		case TLS_extension_psk_key_exchange_modes:
+			if ((psk_dhe_ke = tls13_process_client_psk_key_exchange_modes(ext_data, ext_datalen, TLS_psk_dhe_ke)) < 0) {
+				error_print();
+				return -1;
+			}
+			break;
+		case TLS_extension_pre_shared_key:
+			if (extslen) {
+				// must be the last extension
+				error_print();
+				return -1;
+			}
+			if (tls13_process_client_pre_shared_key(ext_data, ext_datalen,
+				&identity, &identitylen, &obfuscated_ticket_age,
+				&binder, &binderlen, &binders_size) != 1) {
+				error_print();
+				return -1;
+			}
+			break;
+		}
+	}
+	if (!identity || psk_dhe_ke != 1) {
+		return 0;
+	}
 
-	ret = 1;
+	if ((ret = tls13_session_ticket_decrypt(conn->session_ticket_key, identity, identitylen,
+		&cipher_suite, &issue_time, &ticket_age_add, psk)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (cipher_suite != conn->cipher_suite
+		|| (uint32_t)time(NULL) - issue_time > TLS13_SESSION_TICKET_LIFETIME) {
+		gmssl_secure_clear(psk, 32);
+		return 0;
+	}
 
-end:
-	gmssl_secure_clear(&client_ecdhe, sizeof(client_ecdhe));
-	gmssl_secure_clear(&server_sign_key, sizeof(server_sign_key));
-	gmssl_secure_clear(psk, sizeof(psk));
+	// binder of the ClientHello truncated before the binders
+	if (binders_size > recordlen - 5) {
+		error_print();
+		return -1;
+	}
+	dgst_ctx = *transcript;
+	digest_update(&dgst_ctx, record + 5, recordlen - 5 - binders_size);
+	phase_time = tls_handshake_phase_begin(conn);
+	/* 1 */ tls13_hkdf_extract(conn->hs.digest, zeros, psk, early_secret);
+	/* 2 */ tls13_derive_secret(early_secret, "res binder", &conn->hs.null_dgst_ctx, binder_key);
+	tls13_compute_verify_data(binder_key, &dgst_ctx, verify_data, &verify_data_len);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	gmssl_secure_clear(early_secret, sizeof(early_secret));
-	gmssl_secure_clear(handshake_secret, sizeof(handshake_secret));
-	gmssl_secure_clear(master_secret, sizeof(master_secret));
-	gmssl_secure_clear(client_handshake_traffic_secret, sizeof(client_handshake_traffic_secret));
-	gmssl_secure_clear(server_handshake_traffic_secret, sizeof(server_handshake_traffic_secret));
-	gmssl_secure_clear(client_application_traffic_secret, sizeof(client_application_traffic_secret));
-	gmssl_secure_clear(server_application_traffic_secret, sizeof(server_application_traffic_secret));
-	gmssl_secure_clear(client_write_key, sizeof(client_write_key));
-	gmssl_secure_clear(server_write_key, sizeof(server_write_key));
-	return ret;
+	gmssl_secure_clear(binder_key, sizeof(binder_key));
+	if (binderlen != verify_data_len
+		|| gmssl_secure_memcmp(binder, verify_data, verify_data_len) != 0) {
+		gmssl_secure_clear(psk, 32);
+		error_print();
+		return -1;
+	}
+
+	// the ticket age in milliseconds against the server clock, then the binder is remembered
+	// within the window so a replayed ClientHello gets a full 1-RTT handshake
+	if (conn->hs.early_data_offered && conn->max_early_data_size && conn->replay_cache) {
+		age_diff = (int64_t)(uint32_t)(obfuscated_ticket_age - ticket_age_add)
+			- (int64_t)((uint32_t)time(NULL) - issue_time) * 1000;
+		if (age_diff >= -TLS13_EARLY_DATA_AGE_WINDOW && age_diff <= TLS13_EARLY_DATA_AGE_WINDOW
+			&& tls_replay_cache_add(conn->replay_cache, binder, binderlen) == 1) {
+			*early_data = 1;
+		}
+	}
+	return 1;
 }
 
 int tls13_do_accept(TLS_CONNECT *conn)
 {
 	int ret = -1;
+	int rv;
+	TLS_HANDSHAKE *hs = &conn->hs;
+	ARENA_MARK arena_mark;
 	uint8_t *record = conn->record;
 	size_t recordlen;
-	uint8_t enced_record[25600];
-	size_t enced_recordlen = sizeof(enced_record);
+	uint8_t *enced_record = conn->enced_record;
+	size_t enced_recordlen;
 
-	int server_ciphers[] = { TLS_cipher_sm4_gcm_sm3 };
+	int server_ciphers[] = {
+		TLS_cipher_sm4_gcm_sm3,
+#if defined(ENABLE_CHACHA20) && defined(ENABLE_SHA2)
+		TLS_cipher_chacha20_poly1305_sha256,
+#endif
+	};
 
 
 	int protocol;
@@ -1973,20 +4104,12 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	const uint8_t *client_exts;
 	size_t client_exts_len;
 
-	uint8_t client_random[32];
-	uint8_t server_random[32];
 	const uint8_t *client_ciphers;
 	size_t client_ciphers_len;
-	uint8_t server_exts[TLS_MAX_EXTENSIONS_SIZE];
+	uint8_t *server_exts = NULL;
 	size_t server_exts_len;
 
-	SM2_KEY server_ecdhe;
 	SM2_Z256_POINT client_ecdhe_public;
-	SM2_KEY client_sign_key;
-	const BLOCK_CIPHER *cipher;
-	const DIGEST *digest;
-	DIGEST_CTX dgst_ctx;
-	DIGEST_CTX null_dgst_ctx;
 	size_t padding_len;
 
 
@@ -1999,18 +4122,16 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	const uint8_t *client_verify_data;
 	size_t client_verify_data_len;
 
-	uint8_t client_write_key[16];
-	uint8_t server_write_key[16];
+	uint8_t client_write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
+	uint8_t server_write_key[BLOCK_CIPHER_MAX_KEY_SIZE];
 
 	uint8_t zeros[32] = {0};
+	uint64_t phase_time;
 	uint8_t psk[32] = {0};
+	sm2_z256_t ecdhe_x;
+	uint8_t ecdhe_secret[32];
 	uint8_t early_secret[32];
 	uint8_t handshake_secret[32];
-	uint8_t client_handshake_traffic_secret[32];
-	uint8_t server_handshake_traffic_secret[32];
-	uint8_t client_application_traffic_secret[32];
-	uint8_t server_application_traffic_secret[32];
-	uint8_t master_secret[32];
 
 	const uint8_t *request_context;
 	size_t request_context_len;
@@ -2018,19 +4139,43 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	size_t cert_list_len;
 	const uint8_t *cert;
 	size_t certlen;
+	int early_data = 0;
+	uint8_t *ocsp_resp = NULL;
+	size_t ocsp_resp_len = 0;
+	int alert;
+	int handshake_type;
+	const uint8_t *handshake_data;
+	size_t handshake_datalen;
+	DIGEST_CTX binder_dgst_ctx;
 
 
 	int client_verify = 0;
 	if (conn->ca_certs_len)
 		client_verify = 1;
 
+	tls_conn_arena_begin(conn, &arena_mark);
+
+	switch (hs->state) {
+	case TLS_state_client_hello: break;
+	case TLS_state_end_of_early_data: goto end_of_early_data;
+	case TLS_state_client_certificate: goto client_certificate;
+	case TLS_state_certificate_verify: goto certificate_verify;
+	case TLS_state_finished: goto finished;
+	case TLS_state_handshake_done: goto handshake_done;
+	default:
+		error_print();
+		return -1;
+	}
 
 	// 1. Recv ClientHello
+client_hello:
 	tls_trace("recv ClientHello\n");
-	if (tls_record_recv(record, &recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, record, &recordlen)) != 1) {
+		goto wait;
+	}
+	// 0-RTT sent with the first ClientHello before the HelloRetryRequest
+	if (hs->hello_retry && tls13_skip_early_data(conn, record, recordlen)) {
+		goto client_hello;
 	}
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
 	if (tls_record_get_handshake_client_hello(record,
@@ -2047,7 +4192,7 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_protocol_version);
 		goto end;
 	}
-	memcpy(client_random, random, 32);
+	memcpy(hs->client_random, random, 32);
 	if (tls_cipher_suites_select(client_ciphers, client_ciphers_len,
 		server_ciphers, sizeof(server_ciphers)/sizeof(int),
 		&conn->cipher_suite) != 1) {
@@ -2059,26 +4204,107 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		error_print();
 		goto end;
 	}
-	tls13_cipher_suite_get(conn->cipher_suite, &digest, &cipher); // 这个函数是否应该放到tls_里面？
-	digest_init(&dgst_ctx, digest);
-	null_dgst_ctx = dgst_ctx; // 在密钥导出函数中可能输入的消息为空，因此需要一个空的dgst_ctx，这里不对了，应该在tls13_derive_secret里面直接支持NULL！
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	tls13_cipher_suite_get(conn->cipher_suite, &hs->digest, &hs->cipher); // 这个函数是否应该放到tls_里面？
+	digest_init(&hs->dgst_ctx, hs->digest);
+	hs->null_dgst_ctx = hs->dgst_ctx; // 在密钥导出函数中可能输入的消息为空，因此需要一个空的dgst_ctx，这里不对了，应该在tls13_derive_secret里面直接支持NULL！
+	hs->early_data_offered = tls13_client_hello_has_early_data(client_exts, client_exts_len);
+	if ((rv = tls13_server_hello_retry(conn, record, recordlen,
+		client_exts, client_exts_len, &alert)) < 0) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	if (rv == 0) {
+		goto client_hello;
+	}
+	binder_dgst_ctx = hs->dgst_ctx;
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+	// the certificates, the keys and the OCSP stapler of the requested host
+	if (tls_select_server_name(conn, client_exts, client_exts_len, &alert) < 0) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	if (tls_select_record_size(conn, client_exts, client_exts_len, &alert) != 1) {
+		error_print();
+		tls_send_alert(conn, alert);
+		goto end;
+	}
+	hs->ocsp_requested = conn->ocsp_stapler && tls13_client_hello_has_status_request(client_exts, client_exts_len);
+	hs->cert_compression_algor = tls13_client_hello_get_cert_compression(conn, client_exts, client_exts_len);
+
+	// resumption is not offered to servers requiring client certificates
+	if (conn->session_ticket_key_set && !client_verify) {
+		if ((rv = tls13_process_client_hello_psk(conn, &binder_dgst_ctx, record, recordlen,
+			client_exts, client_exts_len, psk, &early_data)) < 0) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_decrypt_error);
+			goto end;
+		}
+		hs->psk_accepted = rv;
+		conn->session_reused = rv;
+	}
+	if (hs->psk_accepted && early_data) {
+		if (!(conn->early_data = (uint8_t *)malloc(conn->max_early_data_size))) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		conn->early_data_len = 0;
+		phase_time = tls_handshake_phase_begin(conn);
+		/* 1 */ tls13_hkdf_extract(hs->digest, zeros, psk, early_secret);
+		/* 3 */ tls13_derive_secret(early_secret, "c e traffic", &hs->dgst_ctx, hs->client_early_traffic_secret);
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		conn->early_data_status = TLS_early_data_accepted;
+	} else if (hs->early_data_offered) {
+		conn->early_data_status = TLS_early_data_rejected;
+	}
+
+	// a full handshake is admitted before the ECDHE and the signature
+	if (!hs->psk_accepted && tls_handshake_key_op_begin(conn) != 1) {
+		error_puts("too many handshakes in progress");
+		tls_send_alert(conn, TLS_alert_handshake_failure);
+		goto end;
+	}
 
 
 	// 2. Send ServerHello
 	tls_trace("send ServerHello\n");
-	rand_bytes(server_random, 32);
-	sm2_key_generate(&server_ecdhe);
+	rand_bytes(hs->server_random, 32);
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls_ecdhe_key_generate(conn, &hs->ecdhe_key) != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	if (!(server_exts = (uint8_t *)arena_alloc(&conn->arena, TLS_MAX_EXTENSIONS_SIZE))) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
 	if (tls13_process_client_hello_exts(client_exts, client_exts_len,
-		&server_ecdhe, &client_ecdhe_public,
-		server_exts, &server_exts_len, sizeof(server_exts)) != 1) {
+		&hs->ecdhe_key, &client_ecdhe_public,
+		server_exts, &server_exts_len, TLS_MAX_EXTENSIONS_SIZE) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
+	if (hs->psk_accepted) {
+		uint8_t *p = server_exts + server_exts_len;
+		size_t len = 0;
+
+		tls13_server_pre_shared_key_ext_to_bytes(0, NULL, &len);
+		if (server_exts_len + len > TLS_MAX_EXTENSIONS_SIZE) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls13_server_pre_shared_key_ext_to_bytes(0, &p, &server_exts_len);
+	}
 	tls_record_set_protocol(record, TLS_protocol_tls12);
 	if (tls_record_set_handshake_server_hello(record, &recordlen,
-		TLS_protocol_tls12, server_random,
+		TLS_protocol_tls12, hs->server_random,
 		NULL, 0, // openssl的兼容模式在ClientHello中发送SessionID并检查在ServerHello是否返回，用`-no_middlebox`可关闭兼容模式
 		conn->cipher_suite, server_exts, server_exts_len) != 1) {
 		error_print();
@@ -2086,31 +4312,39 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		goto end;
 	}
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
-	if (tls_record_send(record, recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, record, recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
-
-
-	sm2_do_ecdh(&server_ecdhe, &client_ecdhe_public, &client_ecdhe_public);
-	/* 1  */ tls13_hkdf_extract(digest, zeros, psk, early_secret);
-	/* 5  */ tls13_derive_secret(early_secret, "derived", &null_dgst_ctx, handshake_secret);
-	/* 6  */ tls13_hkdf_extract(digest, handshake_secret, (uint8_t *)&client_ecdhe_public, handshake_secret);
-	/* 7  */ tls13_derive_secret(handshake_secret, "c hs traffic", &dgst_ctx, client_handshake_traffic_secret);
-	/* 8  */ tls13_derive_secret(handshake_secret, "s hs traffic", &dgst_ctx, server_handshake_traffic_secret);
-	/* 9  */ tls13_derive_secret(handshake_secret, "derived", &null_dgst_ctx, master_secret);
-	/* 10 */ tls13_hkdf_extract(digest, master_secret, zeros, master_secret);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+
+
+	phase_time = tls_handshake_phase_begin(conn);
+	sm2_do_ecdh(&hs->ecdhe_key, &client_ecdhe_public, &client_ecdhe_public);
+	tls_handshake_phase_end(conn, TLS_phase_key_exchange, phase_time);
+	sm2_z256_point_get_xy(&client_ecdhe_public, ecdhe_x, NULL);
+	sm2_z256_to_bytes(ecdhe_x, ecdhe_secret);
+	phase_time = tls_handshake_phase_begin(conn);
+	/* 1  */ tls13_hkdf_extract(hs->digest, zeros, psk, early_secret);
+	/* 5  */ tls13_derive_secret(early_secret, "derived", &hs->null_dgst_ctx, handshake_secret);
+	/* 6  */ tls13_hkdf_extract(hs->digest, handshake_secret, ecdhe_secret, handshake_secret);
+	/* 7  */ tls13_derive_secret(handshake_secret, "c hs traffic", &hs->dgst_ctx, hs->client_handshake_traffic_secret);
+	/* 8  */ tls13_derive_secret(handshake_secret, "s hs traffic", &hs->dgst_ctx, hs->server_handshake_traffic_secret);
+	/* 9  */ tls13_derive_secret(handshake_secret, "derived", &hs->null_dgst_ctx, hs->master_secret);
+	/* 10 */ tls13_hkdf_extract(hs->digest, hs->master_secret, zeros, hs->master_secret);
 	// generate server_write_key, server_write_iv, reset server_seq_num
-	tls13_hkdf_expand_label(digest, server_handshake_traffic_secret, "key", NULL, 0, 16, server_write_key);
-	block_cipher_set_encrypt_key(&conn->server_write_key, cipher, server_write_key);
-	tls13_hkdf_expand_label(digest, server_handshake_traffic_secret, "iv", NULL, 0, 12, conn->server_write_iv);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->server_handshake_traffic_secret, hs->cipher->key_size, server_write_key, conn->server_write_iv);
+	block_cipher_set_encrypt_key(&conn->server_write_key, hs->cipher, server_write_key);
 	memset(conn->server_seq_num, 0, 8);
 	// generate client_write_key, client_write_iv, reset client_seq_num
-	tls13_hkdf_expand_label(digest, client_handshake_traffic_secret, "key", NULL, 0, 16, client_write_key);
-	block_cipher_set_encrypt_key(&conn->client_write_key, cipher, client_write_key);
-	tls13_hkdf_expand_label(digest, client_handshake_traffic_secret, "iv", NULL, 0, 12, conn->client_write_iv);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->client_handshake_traffic_secret, hs->cipher->key_size, client_write_key, conn->client_write_iv);
+	block_cipher_set_encrypt_key(&conn->client_write_key, hs->cipher, client_write_key);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	memset(conn->client_seq_num, 0, 8);
+	if (conn->early_data_status == TLS_early_data_accepted) {
+		// client records are under the early key until EndOfEarlyData
+		tls13_set_early_data_key(conn, hs->digest, hs->cipher, &conn->client_write_key, conn->client_write_iv);
+	}
 	/*
 	format_print(stderr, 0, 0, "generate handshake secrets\n");
 	format_bytes(stderr, 0, 4, "server_write_key", server_write_key, 16);
@@ -2123,7 +4357,9 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	// 3. Send {EncryptedExtensions}
 	tls_trace("send {EncryptedExtensions}\n");
 	tls_record_set_protocol(record, TLS_protocol_tls12);
-	tls13_record_set_handshake_encrypted_extensions(record, &recordlen);
+	tls13_record_set_handshake_encrypted_extensions(record, &recordlen,
+		conn->early_data_status == TLS_early_data_accepted, conn->host_ctx != NULL,
+		hs->record_size_limit, hs->max_fragment_length);
 	tls13_record_trace(stderr, record, recordlen, 0, 0);
 	tls13_padding_len_rand(&padding_len);
 	if (tls13_record_encrypt(&conn->server_write_key, conn->server_write_iv,
@@ -2135,11 +4371,11 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	}
 	// FIXME: tls13_record_encrypt需要支持握手消息
 	// tls_record_data(enced_record)[0] = TLS_handshake_encrypted_extensions;
-	if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 
@@ -2147,8 +4383,7 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	if (client_verify) {
 		tls_trace("send {CertificateRequest*}\n");
 
-		// TODO: 设置certificate_request中的extensions!
-		if (tls13_record_set_handshake_certificate_request_default(record, &recordlen) != 1) {
+		if (tls_conn_set_handshake_certificate_request(conn, record, &recordlen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
@@ -2162,17 +4397,40 @@ int tls13_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_internal_error);
 			goto end;
 		}
-		if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+		if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 			error_print();
 			goto end;
 		}
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 		tls_seq_num_incr(conn->server_seq_num);
 	}
 
+	if (hs->psk_accepted) {
+		// resumed handshake is authenticated by the PSK, no certificates
+		goto send_finished;
+	}
+
 	// send Server {Certificate}
 	tls_trace("send {Certificate}\n");
-	if (tls13_record_set_handshake_certificate(record, &recordlen, NULL, 0, conn->server_certs, conn->server_certs_len) != 1) {
+	if (hs->ocsp_requested
+		&& (!(ocsp_resp = (uint8_t *)arena_alloc(&conn->arena, TLS_OCSP_MAX_RESPONSE_SIZE))
+			|| tls_ocsp_stapler_get(conn->ocsp_stapler, ocsp_resp, &ocsp_resp_len, TLS_OCSP_MAX_RESPONSE_SIZE) != 1)) {
+		ocsp_resp_len = 0;
+	}
+	if (ocsp_resp_len) {
+		rv = tls13_record_set_handshake_certificate(record, &recordlen, NULL, 0,
+			conn->server_certs, conn->server_certs_len, ocsp_resp, ocsp_resp_len);
+	} else {
+		rv = tls_conn_set_handshake_certificate(conn, record, &recordlen);
+	}
+	if (rv != 1) {
+		error_print();
+		tls_send_alert(conn, TLS_alert_internal_error);
+		goto end;
+	}
+	if (hs->cert_compression_algor
+		&& tls13_record_compress_certificate(conn, hs->cert_compression_algor,
+			ocsp_resp_len != 0 || conn->host_ctx, record, &recordlen) < 0) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
@@ -2186,17 +4444,20 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
-	if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 
 	// send Server {CertificateVerify}
 	tls_trace("send {CertificateVerify}\n");
-	tls13_sign_certificate_verify(TLS_server_mode, &conn->sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &dgst_ctx, sig, &siglen);
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_sign_certificate_verify(TLS_server_mode, conn->sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &hs->dgst_ctx, sig, &siglen);
+	tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+	tls_handshake_key_op_end(conn);
 	if (tls13_record_set_handshake_certificate_verify(record, &recordlen,
 		TLS_sig_sm2sig_sm3, sig, siglen) != 1) {
 		error_print();
@@ -2212,20 +4473,23 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
-	if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
 
 	// Send Server {Finished}
+send_finished:
 	tls_trace("send {Finished}\n");
 
 	// compute server verify_data before digest_update()
-	tls13_compute_verify_data(server_handshake_traffic_secret,
-		&dgst_ctx, verify_data, &verify_data_len);
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_compute_verify_data(hs->server_handshake_traffic_secret,
+		&hs->dgst_ctx, verify_data, &verify_data_len);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (tls13_record_set_handshake_finished(record, &recordlen, verify_data, verify_data_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
@@ -2240,30 +4504,85 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
-	if (tls_record_send(enced_record, enced_recordlen, conn->sock) != 1) {
+	if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
 		error_print();
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->server_seq_num);
 
-	// generate server_application_traffic_secret
-	/* 12 */ tls13_derive_secret(master_secret, "s ap traffic", &dgst_ctx, server_application_traffic_secret);
-	// Generate client_application_traffic_secret
-	/* 11 */ tls13_derive_secret(master_secret, "c ap traffic", &dgst_ctx, client_application_traffic_secret);
+	// generate hs->server_application_traffic_secret
+	phase_time = tls_handshake_phase_begin(conn);
+	/* 12 */ tls13_derive_secret(hs->master_secret, "s ap traffic", &hs->dgst_ctx, hs->server_application_traffic_secret);
+	// Generate hs->client_application_traffic_secret
+	/* 11 */ tls13_derive_secret(hs->master_secret, "c ap traffic", &hs->dgst_ctx, hs->client_application_traffic_secret);
+	memcpy(conn->client_application_traffic_secret, hs->client_application_traffic_secret, 32);
+	memcpy(conn->server_application_traffic_secret, hs->server_application_traffic_secret, 32);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	// 因为后面还要解密握手消息，因此client application key, iv 等到握手结束之后再更新
 
-	// Recv Client {Certificate*}
-	if (client_verify) {
-		tls_trace("recv {Certificate*}\n");
-		if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
+	// Recv [EarlyData], then (EndOfEarlyData)
+	if (conn->early_data_status == TLS_early_data_accepted) {
+		hs->state = TLS_state_end_of_early_data;
+end_of_early_data:
+		if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+			goto wait;
+		}
+		if (tls13_record_decrypt(&conn->client_write_key, conn->client_write_iv,
+			conn->client_seq_num, enced_record, enced_recordlen,
+			record, &recordlen) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_bad_record_mac);
+			goto end;
+		}
+		tls_seq_num_incr(conn->client_seq_num);
+		if (tls_record_type(record) == TLS_record_application_data) {
+			tls_trace("recv [EarlyData]\n");
+			if (recordlen - 5 > conn->max_early_data_size - conn->early_data_len) {
+				error_print();
+				tls_send_alert(conn, TLS_alert_unexpected_message);
+				goto end;
+			}
+			memcpy(conn->early_data + conn->early_data_len, record + 5, recordlen - 5);
+			conn->early_data_len += recordlen - 5;
+			goto end_of_early_data;
+		}
+		tls_trace("recv (EndOfEarlyData)\n");
+		tls13_record_trace(stderr, record, recordlen, 0, 0);
+		if (tls_record_type(record) != TLS_record_handshake
+			|| tls_record_get_handshake(record, &handshake_type, &handshake_data, &handshake_datalen) != 1
+			|| handshake_type != TLS_handshake_end_of_early_data
+			|| handshake_datalen != 0) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
+
+		// the rest of the client flight is under the handshake key
+		phase_time = tls_handshake_phase_begin(conn);
+		tls13_hkdf_expand_key_iv(hs->digest, hs->client_handshake_traffic_secret, hs->cipher->key_size, client_write_key, conn->client_write_iv);
+		block_cipher_set_encrypt_key(&conn->client_write_key, hs->cipher, client_write_key);
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		memset(conn->client_seq_num, 0, 8);
+	}
+
+	// Recv Client {Certificate*}
+	if (client_verify) {
+		int verify_result;
+
+		hs->state = TLS_state_client_certificate;
+client_certificate:
+		tls_trace("recv {Certificate*}\n");
+		if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+			goto wait;
+		}
 		if (tls13_record_decrypt(&conn->client_write_key, conn->client_write_iv,
 			conn->client_seq_num, enced_record, enced_recordlen,
 			record, &recordlen) != 1) {
+			if (tls13_skip_early_data(conn, enced_record, enced_recordlen)) {
+				goto client_certificate;
+			}
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_record_mac);
 			goto end;
@@ -2277,7 +4596,8 @@ int tls13_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (tls13_process_certificate_list(cert_list, cert_list_len, conn->client_certs, &conn->client_certs_len) != 1) {
+		if (tls_conn_certs_reserve(&conn->client_certs, cert_list_len) != 1
+			|| tls13_process_certificate_list(cert_list, cert_list_len, conn->client_certs, &conn->client_certs_len, NULL, NULL) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
@@ -2287,22 +4607,23 @@ int tls13_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (x509_cert_get_subject_public_key(cert, certlen, &client_sign_key) != 1) {
+		if (x509_cert_get_subject_public_key(cert, certlen, &hs->peer_sign_key) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 		tls_seq_num_incr(conn->client_seq_num);
 
 		// verify client Certificate
-		int verify_result;
-		if (x509_certs_verify(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
-			conn->ca_certs, conn->ca_certs_len, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
+		phase_time = tls_handshake_phase_begin(conn);
+		if (x509_certs_verify_ex(conn->client_certs, conn->client_certs_len, X509_cert_chain_client,
+			conn->ca_certs, conn->ca_certs_len, conn->ca_store, X509_MAX_VERIFY_DEPTH, &verify_result) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_bad_certificate);
 			goto end;
 		}
+		tls_handshake_phase_end(conn, TLS_phase_certificate_verify, phase_time);
 	}
 
 	// Recv client {CertificateVerify*}
@@ -2311,11 +4632,11 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		const uint8_t *client_sig;
 		size_t client_siglen;
 
+		hs->state = TLS_state_certificate_verify;
+certificate_verify:
 		tls_trace("recv Client {CertificateVerify*}\n");
-		if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-			error_print();
-			tls_send_alert(conn, TLS_alert_unexpected_message);
-			goto end;
+		if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+			goto wait;
 		}
 		if (tls13_record_decrypt(&conn->client_write_key, conn->client_write_iv,
 			conn->client_seq_num, enced_record, enced_recordlen, record, &recordlen) != 1) {
@@ -2330,26 +4651,30 @@ int tls13_do_accept(TLS_CONNECT *conn)
 			tls_send_alert(conn, TLS_alert_unexpected_message);
 			goto end;
 		}
-		if (tls13_verify_certificate_verify(TLS_client_mode, &client_sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &dgst_ctx, client_sig, client_siglen) != 1) {
+		phase_time = tls_handshake_phase_begin(conn);
+		if (tls13_verify_certificate_verify(TLS_client_mode, &hs->peer_sign_key, TLS13_SM2_ID, TLS13_SM2_ID_LENGTH, &hs->dgst_ctx, client_sig, client_siglen) != 1) {
 			error_print();
 			tls_send_alert(conn, TLS_alert_decrypt_error);
 			goto end;
 		}
-		digest_update(&dgst_ctx, record + 5, recordlen - 5);
+		tls_handshake_phase_end(conn, TLS_phase_signature, phase_time);
+		digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 		tls_seq_num_incr(conn->client_seq_num);
 	}
 
 	// 12. Recv Client {Finished}
-
+	hs->state = TLS_state_finished;
+finished:
 	tls_trace("recv {Finished}\n");
-	if (tls_record_recv(enced_record, &enced_recordlen, conn->sock) != 1) {
-		error_print();
-		tls_send_alert(conn, TLS_alert_unexpected_message);
-		goto end;
+	if ((rv = tls_handshake_recv(conn, enced_record, &enced_recordlen)) != 1) {
+		goto wait;
 	}
 	if (tls13_record_decrypt(&conn->client_write_key, conn->client_write_iv,
 		conn->client_seq_num, enced_record, enced_recordlen,
 		record, &recordlen) != 1) {
+		if (tls13_skip_early_data(conn, enced_record, enced_recordlen)) {
+			goto finished;
+		}
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_record_mac);
 		goto end;
@@ -2360,18 +4685,20 @@ int tls13_do_accept(TLS_CONNECT *conn)
 		tls_send_alert(conn, TLS_alert_unexpected_message);
 		goto end;
 	}
-	if (tls13_compute_verify_data(client_handshake_traffic_secret, &dgst_ctx, verify_data, &verify_data_len) != 1) {
+	phase_time = tls_handshake_phase_begin(conn);
+	if (tls13_compute_verify_data(hs->client_handshake_traffic_secret, &hs->dgst_ctx, verify_data, &verify_data_len) != 1) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_internal_error);
 		goto end;
 	}
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
 	if (client_verify_data_len != verify_data_len
 		|| memcmp(client_verify_data, verify_data, verify_data_len) != 0) {
 		error_print();
 		tls_send_alert(conn, TLS_alert_bad_record_mac);
 		goto end;
 	}
-	digest_update(&dgst_ctx, record + 5, recordlen - 5);
+	digest_update(&hs->dgst_ctx, record + 5, recordlen - 5);
 	tls_seq_num_incr(conn->client_seq_num);
 
 
@@ -2379,9 +4706,9 @@ int tls13_do_accept(TLS_CONNECT *conn)
 
 
 	// update server_write_key, server_write_iv, reset server_seq_num
-	tls13_hkdf_expand_label(digest, server_application_traffic_secret, "key", NULL, 0, 16, server_write_key);
-	tls13_hkdf_expand_label(digest, server_application_traffic_secret, "iv", NULL, 0, 12, conn->server_write_iv);
-	block_cipher_set_encrypt_key(&conn->server_write_key, cipher, server_write_key);
+	phase_time = tls_handshake_phase_begin(conn);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->server_application_traffic_secret, hs->cipher->key_size, server_write_key, conn->server_write_iv);
+	block_cipher_set_encrypt_key(&conn->server_write_key, hs->cipher, server_write_key);
 	memset(conn->server_seq_num, 0, 8);
 	/*
 	format_print(stderr, 0, 0, "update server secrets\n");
@@ -2392,10 +4719,14 @@ int tls13_do_accept(TLS_CONNECT *conn)
 
 	// update client_write_key, client_write_iv
 	// reset client_seq_num
-	tls13_hkdf_expand_label(digest, client_application_traffic_secret, "key", NULL, 0, 16, client_write_key);
-	tls13_hkdf_expand_label(digest, client_application_traffic_secret, "iv", NULL, 0, 12, conn->client_write_iv);
-	block_cipher_set_encrypt_key(&conn->client_write_key, cipher, client_write_key);
+	tls13_hkdf_expand_key_iv(hs->digest, hs->client_application_traffic_secret, hs->cipher->key_size, client_write_key, conn->client_write_iv);
+	tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+	block_cipher_set_encrypt_key(&conn->client_write_key, hs->cipher, client_write_key);
 	memset(conn->client_seq_num, 0, 8);
+	if (conn->ktls_requested) {
+		memcpy(hs->client_write_key, client_write_key, 16);
+		memcpy(hs->server_write_key, server_write_key, 16);
+	}
 	/*
 	format_print(stderr, 0, 0, "update client secrets\n");
 	format_bytes(stderr, 0, 4, "client_write_key", client_write_key, 16);
@@ -2403,21 +4734,79 @@ int tls13_do_accept(TLS_CONNECT *conn)
 	format_print(stderr, 0, 0, "\n");
 	*/
 
+	// send [NewSessionTicket]
+	if (conn->session_ticket_key_set && !client_verify) {
+		uint8_t ticket_nonce[1] = { 0 }; // one ticket per connection
+		uint8_t ticket[TLS13_SESSION_TICKET_SIZE];
+		size_t ticketlen;
+		uint32_t ticket_age_add;
+
+		tls_trace("send [NewSessionTicket]\n");
+		phase_time = tls_handshake_phase_begin(conn);
+		/* 14 */ tls13_derive_secret(hs->master_secret, "res master", &hs->dgst_ctx, conn->resumption_master_secret);
+		tls13_hkdf_expand_label(hs->digest, conn->resumption_master_secret, "resumption",
+			ticket_nonce, sizeof(ticket_nonce), 32, psk);
+		tls_handshake_phase_end(conn, TLS_phase_key_schedule, phase_time);
+		if (rand_bytes((uint8_t *)&ticket_age_add, sizeof(ticket_age_add)) != 1
+			|| tls13_session_ticket_encrypt(conn->session_ticket_key, conn->cipher_suite,
+				(uint32_t)time(NULL), ticket_age_add, psk, ticket, &ticketlen) != 1
+			|| tls13_record_set_handshake_new_session_ticket(record, &recordlen,
+				TLS13_SESSION_TICKET_LIFETIME, ticket_age_add,
+				ticket_nonce, sizeof(ticket_nonce), ticket, ticketlen,
+				conn->max_early_data_size) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		tls13_record_trace(stderr, record, recordlen, 0, 0);
+		tls13_padding_len_rand(&padding_len);
+		if (tls13_record_encrypt(&conn->server_write_key, conn->server_write_iv,
+			conn->server_seq_num, record, recordlen, padding_len,
+			enced_record, &enced_recordlen) != 1) {
+			error_print();
+			tls_send_alert(conn, TLS_alert_internal_error);
+			goto end;
+		}
+		if (tls_conn_record_send(conn, enced_record, enced_recordlen) != 1) {
+			error_print();
+			goto end;
+		}
+		tls_seq_num_incr(conn->server_seq_num);
+	}
+
+	hs->state = TLS_state_handshake_done;
+handshake_done:
+	if ((rv = tls_flush(conn)) != 1) {
+		goto wait;
+	}
+#ifdef ENABLE_KTLS
+	if (conn->ktls_requested
+		&& tls13_ktls_enable(conn, hs->client_write_key, hs->server_write_key) < 0) {
+		error_print();
+		goto end;
+	}
+#endif
+
 	if (!conn->quiet)
 		fprintf(stderr, "Connection Established!\n\n");
 
 	ret = 1;
+	goto end;
+
+wait:
+	if (rv == TLS_ERROR_WANT_READ || rv == TLS_ERROR_WANT_WRITE) {
+		tls_conn_arena_end(conn, &arena_mark, 0);
+		return rv;
+	}
+	error_print();
+	tls_send_alert(conn, TLS_alert_unexpected_message);
 end:
-	gmssl_secure_clear(&server_ecdhe, sizeof(server_ecdhe));
-	gmssl_secure_clear(&client_sign_key, sizeof(client_sign_key));
+	tls_handshake_key_op_end(conn);
+	tls_conn_arena_end(conn, &arena_mark, 1);
+	gmssl_secure_clear(hs, sizeof(TLS_HANDSHAKE));
 	gmssl_secure_clear(psk, sizeof(psk));
 	gmssl_secure_clear(early_secret, sizeof(early_secret));
 	gmssl_secure_clear(handshake_secret, sizeof(handshake_secret));
-	gmssl_secure_clear(master_secret, sizeof(master_secret));
-	gmssl_secure_clear(client_handshake_traffic_secret, sizeof(client_handshake_traffic_secret));
-	gmssl_secure_clear(server_handshake_traffic_secret, sizeof(server_handshake_traffic_secret));
-	gmssl_secure_clear(client_application_traffic_secret, sizeof(client_application_traffic_secret));
-	gmssl_secure_clear(server_application_traffic_secret, sizeof(server_application_traffic_secret));
 	gmssl_secure_clear(client_write_key, sizeof(client_write_key));
 	gmssl_secure_clear(server_write_key, sizeof(server_write_key));
 	return ret;
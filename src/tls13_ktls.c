@@ -0,0 +1,233 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <sys/sendfile.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <linux/tls.h>
+#include <gmssl/mem.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifndef SOL_TLS
+#define SOL_TLS		282
+#endif
+#ifndef TCP_ULP
+#define TCP_ULP		31
+#endif
+
+// longer vectors are sent in part, as writev(2) does beyond IOV_MAX
+#define TLS_KTLS_MAX_IOV	64
+
+
+// the kernel builds the TLS 1.3 nonce from salt|iv xor rec_seq, as tls13_gcm_encrypt() does
+static int ktls_set_crypto_info(int sock, int direction,
+	const uint8_t key[16], const uint8_t iv[12], const uint8_t seq_num[8])
+{
+	struct tls12_crypto_info_sm4_gcm info;
+	int ret;
+
+	memset(&info, 0, sizeof(info));
+	info.info.version = TLS_1_3_VERSION;
+	info.info.cipher_type = TLS_CIPHER_SM4_GCM;
+	memcpy(info.key, key, TLS_CIPHER_SM4_GCM_KEY_SIZE);
+	memcpy(info.salt, iv, TLS_CIPHER_SM4_GCM_SALT_SIZE);
+	memcpy(info.iv, iv + TLS_CIPHER_SM4_GCM_SALT_SIZE, TLS_CIPHER_SM4_GCM_IV_SIZE);
+	memcpy(info.rec_seq, seq_num, TLS_CIPHER_SM4_GCM_REC_SEQ_SIZE);
+
+	ret = setsockopt(sock, SOL_TLS, direction, &info, sizeof(info));
+	gmssl_secure_clear(&info, sizeof(info));
+	return ret == 0 ? 1 : 0;
+}
+
+// return 0 if the kernel takes neither direction, e.g. no `tls` module or not a TCP socket
+int tls13_ktls_enable(TLS_CONNECT *conn, const uint8_t client_write_key[16], const uint8_t server_write_key[16])
+{
+	const uint8_t *tx_key, *rx_key;
+	const uint8_t *tx_iv, *rx_iv;
+	const uint8_t *tx_seq_num, *rx_seq_num;
+
+	if (!conn || !client_write_key || !server_write_key) {
+		error_print();
+		return -1;
+	}
+	if (conn->protocol != TLS_protocol_tls13
+		|| conn->cipher_suite != TLS_cipher_sm4_gcm_sm3) {
+		return 0;
+	}
+	// the kernel only takes over a socket transport
+	if (!tls_transport_is_socket(&conn->transport)) {
+		return 0;
+	}
+	// the kernel continues the record stream, nothing may be left in user space
+	if (conn->sendbuf_len || conn->recv_offset) {
+		error_print();
+		return -1;
+	}
+
+	if (conn->is_client) {
+		tx_key = client_write_key;
+		tx_iv = conn->client_write_iv;
+		tx_seq_num = conn->client_seq_num;
+		rx_key = server_write_key;
+		rx_iv = conn->server_write_iv;
+		rx_seq_num = conn->server_seq_num;
+	} else {
+		tx_key = server_write_key;
+		tx_iv = conn->server_write_iv;
+		tx_seq_num = conn->server_seq_num;
+		rx_key = client_write_key;
+		rx_iv = conn->client_write_iv;
+		rx_seq_num = conn->client_seq_num;
+	}
+
+	if (setsockopt(conn->sock, IPPROTO_TCP, TCP_ULP, "tls", sizeof("tls")) != 0) {
+		return 0;
+	}
+	if (ktls_set_crypto_info(conn->sock, TLS_TX, tx_key, tx_iv, tx_seq_num) == 1) {
+		conn->ktls |= TLS_KTLS_TX;
+	}
+	// records already in the read-ahead buffer are decrypted in user space
+	if (conn->readbuf_offset == conn->readbuf_len
+		&& ktls_set_crypto_info(conn->sock, TLS_RX, rx_key, rx_iv, rx_seq_num) == 1) {
+		conn->ktls |= TLS_KTLS_RX;
+	}
+	return conn->ktls ? 1 : 0;
+}
+
+int tls13_ktls_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen)
+{
+	tls_ret_t n;
+
+	if (!conn || (!data && datalen) || !sentlen) {
+		error_print();
+		return -1;
+	}
+	if ((n = tls_socket_send(conn->sock, data, datalen, 0)) >= 0) {
+		*sentlen = (size_t)n;
+		return 1;
+	}
+	if (errno == EAGAIN || errno == EWOULDBLOCK) {
+		return TLS_ERROR_WANT_WRITE;
+	}
+	perror("send");
+	error_print();
+	return -1;
+}
+
+// one sendmsg() for the whole vector, the kernel cuts the records
+int tls13_ktls_sendv(TLS_CONNECT *conn, const TLS_IOVEC *iov, size_t iovcnt, size_t *sentlen)
+{
+	struct iovec vec[TLS_KTLS_MAX_IOV];
+	struct msghdr msg;
+	ssize_t n;
+	size_t i;
+
+	if (!conn || (!iov && iovcnt) || !sentlen) {
+		error_print();
+		return -1;
+	}
+	if (iovcnt > TLS_KTLS_MAX_IOV) {
+		iovcnt = TLS_KTLS_MAX_IOV;
+	}
+	for (i = 0; i < iovcnt; i++) {
+		vec[i].iov_base = (void *)iov[i].base;
+		vec[i].iov_len = iov[i].len;
+	}
+	memset(&msg, 0, sizeof(msg));
+	msg.msg_iov = vec;
+	msg.msg_iovlen = iovcnt;
+
+	if ((n = sendmsg(conn->sock, &msg, 0)) >= 0) {
+		*sentlen = (size_t)n;
+		return 1;
+	}
+	if (errno == EAGAIN || errno == EWOULDBLOCK) {
+		return TLS_ERROR_WANT_WRITE;
+	}
+	perror("sendmsg");
+	error_print();
+	return -1;
+}
+
+// one call returns application data or a single record of another type
+int tls13_ktls_recv(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, int *record_type, size_t *recvlen)
+{
+	uint8_t cbuf[CMSG_SPACE(sizeof(unsigned char))];
+	struct msghdr msg;
+	struct iovec iov;
+	struct cmsghdr *cmsg;
+	ssize_t n;
+
+	if (!conn || !buf || !buflen || !record_type || !recvlen) {
+		error_print();
+		return -1;
+	}
+
+	memset(&msg, 0, sizeof(msg));
+	iov.iov_base = buf;
+	iov.iov_len = buflen;
+	msg.msg_iov = &iov;
+	msg.msg_iovlen = 1;
+	msg.msg_control = cbuf;
+	msg.msg_controllen = sizeof(cbuf);
+
+	if ((n = recvmsg(conn->sock, &msg, 0)) < 0) {
+		if (errno == EAGAIN || errno == EWOULDBLOCK) {
+			return TLS_ERROR_WANT_READ;
+		}
+		// EBADMSG on a bad tag
+		perror("recvmsg");
+		error_print();
+		return -1;
+	}
+	if (n == 0) {
+		tls_trace("TCP connection closed");
+		*recvlen = 0;
+		return 0;
+	}
+
+	*record_type = TLS_record_application_data;
+	if ((cmsg = CMSG_FIRSTHDR(&msg)) != NULL
+		&& cmsg->cmsg_level == SOL_TLS && cmsg->cmsg_type == TLS_GET_RECORD_TYPE) {
+		*record_type = *(unsigned char *)CMSG_DATA(cmsg);
+	}
+	*recvlen = (size_t)n;
+	return 1;
+}
+
+// `offset` as sendfile(2), short sends are returned in `sentlen`
+int tls13_sendfile(TLS_CONNECT *conn, int fd, off_t *offset, size_t count, size_t *sentlen)
+{
+	ssize_t n;
+
+	if (!conn || fd < 0 || !sentlen) {
+		error_print();
+		return -1;
+	}
+	if (!(conn->ktls & TLS_KTLS_TX)) {
+		error_puts("tls13_sendfile() needs kTLS transmit offload");
+		return -1;
+	}
+	if ((n = sendfile(conn->sock, fd, offset, count)) >= 0) {
+		*sentlen = (size_t)n;
+		return 1;
+	}
+	if (errno == EAGAIN || errno == EWOULDBLOCK) {
+		return TLS_ERROR_WANT_WRITE;
+	}
+	perror("sendfile");
+	error_print();
+	return -1;
+}
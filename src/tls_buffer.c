@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK pool_lock = SRWLOCK_INIT;
+#define pool_mutex_lock()	AcquireSRWLockExclusive(&pool_lock)
+#define pool_mutex_unlock()	ReleaseSRWLockExclusive(&pool_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t pool_lock = PTHREAD_MUTEX_INITIALIZER;
+#define pool_mutex_lock()	pthread_mutex_lock(&pool_lock)
+#define pool_mutex_unlock()	pthread_mutex_unlock(&pool_lock)
+#endif
+
+
+// free buffers are chained through their first bytes
+static uint8_t *pool_head = NULL;
+static size_t pool_count = 0;
+
+uint8_t *tls_buffer_get(void)
+{
+	uint8_t *buf;
+
+	pool_mutex_lock();
+	if ((buf = pool_head) != NULL) {
+		memcpy(&pool_head, buf, sizeof(uint8_t *));
+		pool_count--;
+	}
+	pool_mutex_unlock();
+
+	if (!buf && !(buf = (uint8_t *)malloc(TLS_MAX_RECORD_SIZE))) {
+		error_print();
+		return NULL;
+	}
+	return buf;
+}
+
+void tls_buffer_put(uint8_t *buf)
+{
+	if (!buf) {
+		return;
+	}
+	// might hold decrypted data
+	gmssl_secure_clear(buf, TLS_MAX_RECORD_SIZE);
+
+	pool_mutex_lock();
+	if (pool_count < TLS_BUFFER_POOL_MAX_FREE) {
+		memcpy(buf, &pool_head, sizeof(uint8_t *));
+		pool_head = buf;
+		pool_count++;
+		buf = NULL;
+	}
+	pool_mutex_unlock();
+
+	free(buf);
+}
+
+size_t tls_buffer_pool_free_count(void)
+{
+	size_t count;
+
+	pool_mutex_lock();
+	count = pool_count;
+	pool_mutex_unlock();
+	return count;
+}
+
+void tls_buffer_pool_cleanup(void)
+{
+	uint8_t *buf;
+
+	pool_mutex_lock();
+	while ((buf = pool_head) != NULL) {
+		memcpy(&pool_head, buf, sizeof(uint8_t *));
+		free(buf);
+	}
+	pool_count = 0;
+	pool_mutex_unlock();
+}
+
+static int tls_conn_buffer_get(uint8_t **buf)
+{
+	if (!*buf && !(*buf = tls_buffer_get())) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_conn_buffers_get(TLS_CONNECT *conn)
+{
+	if (tls_conn_buffer_get(&conn->record) != 1
+		|| tls_conn_buffer_get(&conn->databuf) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// keep only the buffers holding state between calls
+void tls_conn_buffers_put(TLS_CONNECT *conn)
+{
+	int handshake = conn->hs.state != TLS_state_client_hello;
+
+	if (!handshake && conn->enced_record) {
+		tls_buffer_put(conn->enced_record);
+		conn->enced_record = NULL;
+	}
+	if (!handshake && !conn->recv_offset && conn->record) {
+		tls_buffer_put(conn->record);
+		conn->record = NULL;
+	}
+	if (!handshake && !conn->datalen && conn->databuf) {
+		tls_buffer_put(conn->databuf);
+		conn->databuf = NULL;
+		conn->data = NULL;
+	}
+	if (!conn->sendbuf_len && conn->sendbuf) {
+		tls_buffer_put(conn->sendbuf);
+		conn->sendbuf = NULL;
+	}
+	if (conn->readbuf_offset == conn->readbuf_len && conn->readbuf) {
+		tls_conn_readbuf_put(conn);
+	}
+}
+
+// the larger buffer of tls_recv_pipelined() only holds ciphertext and is not pooled
+void tls_conn_readbuf_put(TLS_CONNECT *conn)
+{
+	if (conn->readbuf_size) {
+		free(conn->readbuf);
+	} else {
+		tls_buffer_put(conn->readbuf);
+	}
+	conn->readbuf = NULL;
+	conn->readbuf_len = 0;
+	conn->readbuf_offset = 0;
+	conn->readbuf_size = 0;
+}
+
+/*
+ * conn->arena holds the temporaries of a handshake. A handshake driver calls
+ * tls_conn_arena_begin() on entry and tls_conn_arena_end() on return: when it
+ * returns to wait for I/O or an asynchronous key operation (`done` is 0) only
+ * the allocations of this call are released, the ones of the earlier calls
+ * are kept; when the handshake ends or fails all of the arena is freed.
+ */
+void tls_conn_arena_begin(TLS_CONNECT *conn, ARENA_MARK *mark)
+{
+	arena_get_mark(&conn->arena, mark);
+}
+
+void tls_conn_arena_end(TLS_CONNECT *conn, const ARENA_MARK *mark, int done)
+{
+	if (done) {
+		arena_cleanup(&conn->arena);
+	} else {
+		arena_release(&conn->arena, mark);
+	}
+}
+
+// `len` is an upper bound of the certificates, e.g. the length of the Certificate message
+int tls_conn_certs_reserve(uint8_t **certs, size_t len)
+{
+	uint8_t *p;
+
+	if (!(p = (uint8_t *)realloc(*certs, len ? len : 1))) {
+		error_print();
+		return -1;
+	}
+	*certs = p;
+	return 1;
+}
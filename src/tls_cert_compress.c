@@ -0,0 +1,232 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+#ifdef ENABLE_TLS_CERT_ZLIB
+#include <zlib.h>
+#endif
+#ifdef ENABLE_TLS_CERT_BROTLI
+#include <brotli/encode.h>
+#include <brotli/decode.h>
+#endif
+
+
+const char *tls_cert_compression_name(int algor)
+{
+	switch (algor) {
+	case TLS_cert_compression_zlib: return "zlib";
+	case TLS_cert_compression_brotli: return "brotli";
+	case TLS_cert_compression_zstd: return "zstd";
+	case TLS_cert_compression_zlib_sm: return "zlib_sm";
+	}
+	return NULL;
+}
+
+int tls_cert_compression_supported(int algor)
+{
+	switch (algor) {
+#ifdef ENABLE_TLS_CERT_ZLIB
+	case TLS_cert_compression_zlib:
+	case TLS_cert_compression_zlib_sm:
+		return 1;
+#endif
+#ifdef ENABLE_TLS_CERT_BROTLI
+	case TLS_cert_compression_brotli:
+		return 1;
+#endif
+	}
+	return 0;
+}
+
+#ifdef ENABLE_TLS_CERT_ZLIB
+/*
+DER fragments found in most SM2 certificates, zlib finds the strings nearer to
+the end of the dictionary with shorter distances, so the signature algorithm
+and the public key header come last.
+*/
+static const uint8_t tls_cert_sm_dictionary[] = {
+	// UTF-8 words of Chinese distinguished names
+	0xe5,0x8c,0x97,0xe4,0xba,0xac, // 北京
+	0xe4,0xb8,0x8a,0xe6,0xb5,0xb7, // 上海
+	0xe5,0xb9,0xbf,0xe4,0xb8,0x9c, // 广东
+	0xe6,0xb7,0xb1,0xe5,0x9c,0xb3, // 深圳
+	0xe9,0x93,0xb6,0xe8,0xa1,0x8c, // 银行
+	0xe8,0x82,0xa1,0xe4,0xbb,0xbd, // 股份
+	0xe6,0x95,0xb0,0xe5,0xad,0x97,0xe8,0xaf,0x81,0xe4,0xb9,0xa6, // 数字证书
+	0xe8,0xae,0xa4,0xe8,0xaf,0x81,0xe4,0xb8,0xad,0xe5,0xbf,0x83, // 认证中心
+	0xe6,0x9c,0x89,0xe9,0x99,0x90,0xe5,0x85,0xac,0xe5,0x8f,0xb8, // 有限公司
+	0xe4,0xb8,0xad,0xe5,0x9b,0xbd, // 中国
+	// CRL distribution point and authority info access URIs
+	'h','t','t','p',':','/','/','c','r','l','.',
+	'/','c','r','l','.','c','r','l',
+	0x06,0x08,0x2b,0x06,0x01,0x05,0x05,0x07,0x30,0x02, // id-ad-caIssuers
+	0x06,0x08,0x2b,0x06,0x01,0x05,0x05,0x07,0x30,0x01, // id-ad-ocsp
+	0x06,0x08,0x2b,0x06,0x01,0x05,0x05,0x07,0x01,0x01, // id-pe-authorityInfoAccess
+	0x06,0x03,0x55,0x1d,0x1f, // cRLDistributionPoints
+	// extended key usage serverAuth, clientAuth
+	0x06,0x03,0x55,0x1d,0x25,0x04,0x16,0x30,0x14,
+	0x06,0x08,0x2b,0x06,0x01,0x05,0x05,0x07,0x03,0x01,
+	0x06,0x08,0x2b,0x06,0x01,0x05,0x05,0x07,0x03,0x02,
+	// basicConstraints, keyUsage
+	0x30,0x0f,0x06,0x03,0x55,0x1d,0x13,0x01,0x01,0xff,0x04,0x05,0x30,0x03,0x01,0x01,0xff,
+	0x30,0x0e,0x06,0x03,0x55,0x1d,0x0f,0x01,0x01,0xff,0x04,0x04,0x03,0x02,
+	// authorityKeyIdentifier, subjectKeyIdentifier
+	0x30,0x1f,0x06,0x03,0x55,0x1d,0x23,0x04,0x18,0x30,0x16,0x80,0x14,
+	0x30,0x1d,0x06,0x03,0x55,0x1d,0x0e,0x04,0x16,0x04,0x14,
+	0xa3,0x82, // extensions
+	// name attributes
+	0x06,0x03,0x55,0x04,0x07,0x0c, // localityName
+	0x06,0x03,0x55,0x04,0x08,0x0c, // stateOrProvinceName
+	0x06,0x03,0x55,0x04,0x0b,0x0c, // organizationalUnitName
+	0x06,0x03,0x55,0x04,0x0a,0x0c, // organizationName
+	0x06,0x03,0x55,0x04,0x03,0x0c, // commonName
+	0x31,0x0b,0x30,0x09,0x06,0x03,0x55,0x04,0x06,0x13,0x02,'C','N', // countryName CN
+	// validity
+	0x30,0x1e,0x17,0x0d,0x32,
+	// SM2 SubjectPublicKeyInfo header
+	0x30,0x59,0x30,0x13,0x06,0x07,0x2a,0x86,0x48,0xce,0x3d,0x02,0x01,
+	0x06,0x08,0x2a,0x81,0x1c,0xcf,0x55,0x01,0x82,0x2d,0x03,0x42,0x00,0x04,
+	// version v3, sm2sign-with-sm3
+	0xa0,0x03,0x02,0x01,0x02,
+	0x30,0x0a,0x06,0x08,0x2a,0x81,0x1c,0xcf,0x55,0x01,0x83,0x75,
+};
+
+static int tls_cert_zlib_compress(const uint8_t *dict, size_t dictlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	z_stream zs;
+	int rv;
+
+	memset(&zs, 0, sizeof(zs));
+	if (deflateInit(&zs, Z_BEST_COMPRESSION) != Z_OK) {
+		error_print();
+		return -1;
+	}
+	if (dict && deflateSetDictionary(&zs, dict, (uInt)dictlen) != Z_OK) {
+		deflateEnd(&zs);
+		error_print();
+		return -1;
+	}
+	zs.next_in = (Bytef *)in;
+	zs.avail_in = (uInt)inlen;
+	zs.next_out = out;
+	zs.avail_out = (uInt)maxlen;
+	rv = deflate(&zs, Z_FINISH);
+	*outlen = zs.total_out;
+	deflateEnd(&zs);
+	if (rv == Z_OK || rv == Z_BUF_ERROR) {
+		return 0;
+	}
+	if (rv != Z_STREAM_END) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int tls_cert_zlib_decompress(const uint8_t *dict, size_t dictlen,
+	const uint8_t *in, size_t inlen, uint8_t *out, size_t outlen)
+{
+	z_stream zs;
+	int rv;
+
+	memset(&zs, 0, sizeof(zs));
+	if (inflateInit(&zs) != Z_OK) {
+		error_print();
+		return -1;
+	}
+	zs.next_in = (Bytef *)in;
+	zs.avail_in = (uInt)inlen;
+	zs.next_out = out;
+	zs.avail_out = (uInt)outlen;
+	rv = inflate(&zs, Z_FINISH);
+	if (rv == Z_NEED_DICT && dict) {
+		if (inflateSetDictionary(&zs, dict, (uInt)dictlen) != Z_OK) {
+			inflateEnd(&zs);
+			error_print();
+			return -1;
+		}
+		rv = inflate(&zs, Z_FINISH);
+	}
+	// the whole input must give exactly the announced length
+	if (rv != Z_STREAM_END || zs.avail_in || zs.total_out != outlen) {
+		inflateEnd(&zs);
+		error_print();
+		return -1;
+	}
+	inflateEnd(&zs);
+	return 1;
+}
+#endif
+
+// return 0 if the output does not fit in maxlen
+int tls_cert_compress(int algor, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen, size_t maxlen)
+{
+	if (!in || !inlen || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	switch (algor) {
+#ifdef ENABLE_TLS_CERT_ZLIB
+	case TLS_cert_compression_zlib:
+		return tls_cert_zlib_compress(NULL, 0, in, inlen, out, outlen, maxlen);
+	case TLS_cert_compression_zlib_sm:
+		return tls_cert_zlib_compress(tls_cert_sm_dictionary, sizeof(tls_cert_sm_dictionary),
+			in, inlen, out, outlen, maxlen);
+#endif
+#ifdef ENABLE_TLS_CERT_BROTLI
+	case TLS_cert_compression_brotli:
+		*outlen = maxlen;
+		if (BrotliEncoderCompress(BROTLI_MAX_QUALITY, BROTLI_DEFAULT_WINDOW, BROTLI_MODE_GENERIC,
+			inlen, in, outlen, out) != BROTLI_TRUE) {
+			// also the result of a too small output buffer
+			return 0;
+		}
+		return 1;
+#endif
+	}
+	error_print();
+	return -1;
+}
+
+int tls_cert_decompress(int algor, const uint8_t *in, size_t inlen, uint8_t *out, size_t outlen)
+{
+	if (!in || !inlen || !out || !outlen) {
+		error_print();
+		return -1;
+	}
+	switch (algor) {
+#ifdef ENABLE_TLS_CERT_ZLIB
+	case TLS_cert_compression_zlib:
+		return tls_cert_zlib_decompress(NULL, 0, in, inlen, out, outlen);
+	case TLS_cert_compression_zlib_sm:
+		return tls_cert_zlib_decompress(tls_cert_sm_dictionary, sizeof(tls_cert_sm_dictionary),
+			in, inlen, out, outlen);
+#endif
+#ifdef ENABLE_TLS_CERT_BROTLI
+	case TLS_cert_compression_brotli:
+	{
+		size_t len = outlen;
+		if (BrotliDecoderDecompress(inlen, in, &len, out) != BROTLI_DECODER_RESULT_SUCCESS
+			|| len != outlen) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+#endif
+	}
+	error_print();
+	return -1;
+}
@@ -0,0 +1,438 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/mem.h>
+#include <gmssl/tls.h>
+#include <gmssl/socket.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <ws2tcpip.h>
+typedef CRITICAL_SECTION pool_mutex_t;
+#define pool_mutex_init(m)	InitializeCriticalSection(m)
+#define pool_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pool_mutex_lock(m)	EnterCriticalSection(m)
+#define pool_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+#include <sys/time.h>
+#include <sys/select.h>
+typedef pthread_mutex_t pool_mutex_t;
+#define pool_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pool_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pool_mutex_lock(m)	pthread_mutex_lock(m)
+#define pool_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+// TLS_CONNECT first, so that the TLS_CONNECT of the caller leads back to it
+typedef struct TLS_CLIENT_POOL_CONN_st {
+	TLS_CONNECT conn;
+	const TLS_CTX *ctx;
+	char host[TLS_MAX_SERVER_NAME_SIZE + 1];
+	int port;
+	tls_socket_t sock;
+	time_t idle_since;
+	struct TLS_CLIENT_POOL_CONN_st *next;
+} TLS_CLIENT_POOL_CONN;
+
+typedef struct {
+	const TLS_CTX *ctx;
+	char host[TLS_MAX_SERVER_NAME_SIZE + 1];
+	int port;
+	TLS_SESSION session;
+	time_t used;
+} TLS_CLIENT_POOL_SESSION;
+
+// idle connections, the most recently released first
+struct TLS_CLIENT_POOL_st {
+	pool_mutex_t mutex;
+	int timeout;
+	size_t max_idle;
+	TLS_CLIENT_POOL_CONN *idle;
+	size_t idle_cnt;
+	TLS_CLIENT_POOL_SESSION sessions[TLS_CLIENT_POOL_MAX_SESSIONS];
+	size_t sessions_cnt;
+	TLS_CLIENT_POOL_STATS stats;
+};
+
+static int tls_client_pool_match(const TLS_CTX *ctx, const char *host, int port,
+	const TLS_CTX *ctx2, const char *host2, int port2)
+{
+	return ctx == ctx2 && port == port2 && strcmp(host, host2) == 0;
+}
+
+static void tls_client_pool_conn_free(TLS_CLIENT_POOL_CONN *pc, int shutdown)
+{
+	if (shutdown) {
+		tls_shutdown(&pc->conn);
+	}
+	tls_cleanup(&pc->conn);
+	tls_socket_close(pc->sock);
+	free(pc);
+}
+
+// an idle connection is dead if the peer sent FIN or an alert, the records it sent otherwise are left to the caller
+static int tls_client_pool_conn_alive(TLS_CLIENT_POOL_CONN *pc)
+{
+	fd_set fds;
+	struct timeval tv = { 0, 0 };
+	uint8_t type;
+
+	FD_ZERO(&fds);
+	FD_SET(pc->sock, &fds);
+	if (select((int)pc->sock + 1, &fds, NULL, NULL, &tv) <= 0) {
+		return 1;
+	}
+	if (tls_socket_recv(pc->sock, &type, 1, MSG_PEEK) != 1 || type == TLS_record_alert) {
+		return 0;
+	}
+	return 1;
+}
+
+// with the lock held
+static TLS_CLIENT_POOL_SESSION *tls_client_pool_find_session(TLS_CLIENT_POOL *pool,
+	const TLS_CTX *ctx, const char *host, int port)
+{
+	size_t i;
+
+	for (i = 0; i < pool->sessions_cnt; i++) {
+		TLS_CLIENT_POOL_SESSION *s = &pool->sessions[i];
+		if (tls_client_pool_match(s->ctx, s->host, s->port, ctx, host, port)) {
+			return s;
+		}
+	}
+	return NULL;
+}
+
+// the least recently used session is replaced when the table is full
+static void tls_client_pool_save_session(TLS_CLIENT_POOL *pool, TLS_CLIENT_POOL_CONN *pc)
+{
+	TLS_CLIENT_POOL_SESSION *s;
+	TLS_SESSION session;
+	size_t i;
+
+	if (tls_get_session(&pc->conn, &session) != 1) {
+		return;
+	}
+	pool_mutex_lock(&pool->mutex);
+	if (!(s = tls_client_pool_find_session(pool, pc->ctx, pc->host, pc->port))) {
+		if (pool->sessions_cnt < TLS_CLIENT_POOL_MAX_SESSIONS) {
+			s = &pool->sessions[pool->sessions_cnt++];
+		} else {
+			s = &pool->sessions[0];
+			for (i = 1; i < pool->sessions_cnt; i++) {
+				if (pool->sessions[i].used < s->used) {
+					s = &pool->sessions[i];
+				}
+			}
+		}
+		s->ctx = pc->ctx;
+		memcpy(s->host, pc->host, sizeof(s->host));
+		s->port = pc->port;
+	}
+	s->session = session;
+	s->used = time(NULL);
+	pool_mutex_unlock(&pool->mutex);
+	gmssl_secure_clear(&session, sizeof(session));
+}
+
+static void tls_client_pool_remove_session(TLS_CLIENT_POOL *pool, const TLS_CTX *ctx, const char *host, int port)
+{
+	TLS_CLIENT_POOL_SESSION *s;
+
+	pool_mutex_lock(&pool->mutex);
+	if ((s = tls_client_pool_find_session(pool, ctx, host, port)) != NULL) {
+		*s = pool->sessions[--pool->sessions_cnt];
+		gmssl_secure_clear(&pool->sessions[pool->sessions_cnt], sizeof(TLS_CLIENT_POOL_SESSION));
+	}
+	pool_mutex_unlock(&pool->mutex);
+}
+
+// return 1 with an idle connection, 0 if there is none
+static int tls_client_pool_take(TLS_CLIENT_POOL *pool, const TLS_CTX *ctx, const char *host, int port,
+	TLS_CLIENT_POOL_CONN **out)
+{
+	TLS_CLIENT_POOL_CONN *dead = NULL;
+	TLS_CLIENT_POOL_CONN **pp;
+	time_t now = time(NULL);
+
+	*out = NULL;
+
+	pool_mutex_lock(&pool->mutex);
+	pp = &pool->idle;
+	while (*pp) {
+		TLS_CLIENT_POOL_CONN *pc = *pp;
+
+		if (now - pc->idle_since >= TLS_CLIENT_POOL_IDLE_SECONDS || now < pc->idle_since) {
+			*pp = pc->next;
+			pool->idle_cnt--;
+			pc->next = dead;
+			dead = pc;
+			continue;
+		}
+		if (tls_client_pool_match(pc->ctx, pc->host, pc->port, ctx, host, port)) {
+			*pp = pc->next;
+			pool->idle_cnt--;
+			if (tls_client_pool_conn_alive(pc)) {
+				*out = pc;
+				pool->stats.reused++;
+				break;
+			}
+			pc->next = dead;
+			dead = pc;
+			continue;
+		}
+		pp = &pc->next;
+	}
+	pool_mutex_unlock(&pool->mutex);
+
+	// closed out of the lock
+	while (dead) {
+		TLS_CLIENT_POOL_CONN *pc = dead;
+		dead = pc->next;
+		tls_client_pool_conn_free(pc, 0);
+	}
+	return *out ? 1 : 0;
+}
+
+static int tls_client_pool_socket_connect(const char *host, int port, int timeout, tls_socket_t *sock)
+{
+	struct addrinfo hints;
+	struct addrinfo *res = NULL;
+	char service[16];
+#ifdef _WIN32
+	DWORD tv = (DWORD)timeout * 1000;
+#else
+	struct timeval tv;
+#endif
+
+	memset(&hints, 0, sizeof(hints));
+	hints.ai_family = AF_INET;
+	hints.ai_socktype = SOCK_STREAM;
+	snprintf(service, sizeof(service), "%d", port);
+	if (getaddrinfo(host, service, &hints, &res) != 0 || !res) {
+		error_print();
+		return -1;
+	}
+	if (tls_socket_create(sock, AF_INET, SOCK_STREAM, 0) != 1) {
+		freeaddrinfo(res);
+		error_print();
+		return -1;
+	}
+#ifndef _WIN32
+	tv.tv_sec = timeout;
+	tv.tv_usec = 0;
+#endif
+	if (setsockopt(*sock, SOL_SOCKET, SO_RCVTIMEO, (const char *)&tv, sizeof(tv)) != 0
+		|| setsockopt(*sock, SOL_SOCKET, SO_SNDTIMEO, (const char *)&tv, sizeof(tv)) != 0
+		|| tls_socket_connect(*sock, (const struct sockaddr_in *)res->ai_addr) != 1) {
+		freeaddrinfo(res);
+		tls_socket_close(*sock);
+		error_print();
+		return -1;
+	}
+	freeaddrinfo(res);
+	return 1;
+}
+
+static int tls_client_pool_handshake(TLS_CLIENT_POOL *pool, TLS_CLIENT_POOL_CONN *pc)
+{
+	TLS_CLIENT_POOL_SESSION *s;
+	TLS_SESSION session;
+	int has_session = 0;
+
+	if (tls_init(&pc->conn, pc->ctx) != 1
+		|| tls_set_socket(&pc->conn, pc->sock) != 1
+		|| (pc->ctx->protocol != TLS_protocol_tls12 && tls_set_server_name(&pc->conn, pc->host) != 1)) {
+		error_print();
+		return -1;
+	}
+	pool_mutex_lock(&pool->mutex);
+	if ((s = tls_client_pool_find_session(pool, pc->ctx, pc->host, pc->port)) != NULL) {
+		session = s->session;
+		s->used = time(NULL);
+		has_session = 1;
+	}
+	pool_mutex_unlock(&pool->mutex);
+
+	if (has_session) {
+		int ret = tls_set_session(&pc->conn, &session);
+		gmssl_secure_clear(&session, sizeof(session));
+		if (ret != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (tls_do_handshake(&pc->conn) != 1) {
+		// the session might be what the server does not take
+		if (has_session) {
+			tls_client_pool_remove_session(pool, pc->ctx, pc->host, pc->port);
+		}
+		error_print();
+		return -1;
+	}
+
+	pool_mutex_lock(&pool->mutex);
+	pool->stats.connects++;
+	if (tls_session_reused(&pc->conn)) {
+		pool->stats.resumed++;
+	}
+	pool_mutex_unlock(&pool->mutex);
+
+	tls_client_pool_save_session(pool, pc);
+	return 1;
+}
+
+TLS_CLIENT_POOL *tls_client_pool_new(size_t max_idle, int timeout)
+{
+	TLS_CLIENT_POOL *pool;
+
+	if (timeout <= 0) {
+		error_print();
+		return NULL;
+	}
+	if (tls_socket_lib_init() != 1) {
+		error_print();
+		return NULL;
+	}
+	if (!(pool = (TLS_CLIENT_POOL *)calloc(1, sizeof(*pool)))) {
+		tls_socket_lib_cleanup();
+		error_print();
+		return NULL;
+	}
+	pool->max_idle = max_idle ? max_idle : TLS_CLIENT_POOL_MAX_IDLE;
+	pool->timeout = timeout;
+	pool_mutex_init(&pool->mutex);
+	return pool;
+}
+
+void tls_client_pool_free(TLS_CLIENT_POOL *pool)
+{
+	if (!pool) {
+		return;
+	}
+	while (pool->idle) {
+		TLS_CLIENT_POOL_CONN *pc = pool->idle;
+		pool->idle = pc->next;
+		tls_client_pool_conn_free(pc, 1);
+	}
+	pool_mutex_destroy(&pool->mutex);
+	gmssl_secure_clear(pool->sessions, sizeof(pool->sessions));
+	free(pool);
+	tls_socket_lib_cleanup();
+}
+
+int tls_client_pool_connect(TLS_CLIENT_POOL *pool, const TLS_CTX *ctx, const char *host, int port,
+	TLS_CONNECT **conn)
+{
+	TLS_CLIENT_POOL_CONN *pc;
+
+	if (!pool || !ctx || !host || !conn) {
+		error_print();
+		return -1;
+	}
+	if (!ctx->is_client || !host[0] || strlen(host) > TLS_MAX_SERVER_NAME_SIZE || port <= 0 || port > 65535) {
+		error_print();
+		return -1;
+	}
+	*conn = NULL;
+
+	if (tls_client_pool_take(pool, ctx, host, port, &pc) == 1) {
+		*conn = &pc->conn;
+		return 1;
+	}
+
+	if (!(pc = (TLS_CLIENT_POOL_CONN *)calloc(1, sizeof(*pc)))) {
+		error_print();
+		return -1;
+	}
+	pc->ctx = ctx;
+	strcpy(pc->host, host);
+	pc->port = port;
+	if (tls_client_pool_socket_connect(host, port, pool->timeout, &pc->sock) != 1) {
+		free(pc);
+		error_print();
+		return -1;
+	}
+	if (tls_client_pool_handshake(pool, pc) != 1) {
+		tls_client_pool_conn_free(pc, 0);
+		error_print();
+		return -1;
+	}
+	*conn = &pc->conn;
+	return 1;
+}
+
+void tls_client_pool_release(TLS_CLIENT_POOL *pool, TLS_CONNECT *conn, int reusable)
+{
+	TLS_CLIENT_POOL_CONN *pc = (TLS_CLIENT_POOL_CONN *)conn;
+	TLS_CLIENT_POOL_CONN *evicted = NULL;
+	TLS_CLIENT_POOL_CONN **pp;
+	size_t n;
+
+	if (!pool || !conn) {
+		return;
+	}
+	// a TLS 1.3 ticket comes with the records after the handshake
+	tls_client_pool_save_session(pool, pc);
+
+	if (!reusable) {
+		tls_client_pool_conn_free(pc, 0);
+		return;
+	}
+
+	pool_mutex_lock(&pool->mutex);
+	pc->idle_since = time(NULL);
+	pc->next = pool->idle;
+	pool->idle = pc;
+	pool->idle_cnt++;
+	if (pool->idle_cnt > pool->max_idle) {
+		// drop the least recently released one, the last of the list
+		for (pp = &pool->idle, n = 1; n < pool->idle_cnt; n++) {
+			pp = &(*pp)->next;
+		}
+		evicted = *pp;
+		*pp = NULL;
+		pool->idle_cnt--;
+	}
+	pool_mutex_unlock(&pool->mutex);
+
+	if (evicted) {
+		tls_client_pool_conn_free(evicted, 1);
+	}
+}
+
+size_t tls_client_pool_idle_count(TLS_CLIENT_POOL *pool)
+{
+	size_t cnt;
+
+	pool_mutex_lock(&pool->mutex);
+	cnt = pool->idle_cnt;
+	pool_mutex_unlock(&pool->mutex);
+	return cnt;
+}
+
+int tls_client_pool_get_stats(TLS_CLIENT_POOL *pool, TLS_CLIENT_POOL_STATS *stats)
+{
+	if (!pool || !stats) {
+		error_print();
+		return -1;
+	}
+	pool_mutex_lock(&pool->mutex);
+	*stats = pool->stats;
+	pool_mutex_unlock(&pool->mutex);
+	return 1;
+}
@@ -0,0 +1,156 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK refs_lock = SRWLOCK_INIT;
+#define refs_mutex_lock()	AcquireSRWLockExclusive(&refs_lock)
+#define refs_mutex_unlock()	ReleaseSRWLockExclusive(&refs_lock)
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+static pthread_mutex_t refs_lock = PTHREAD_MUTEX_INITIALIZER;
+#define refs_mutex_lock()	pthread_mutex_lock(&refs_lock)
+#define refs_mutex_unlock()	pthread_mutex_unlock(&refs_lock)
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+TLS_CTX *tls_ctx_new(int protocol, int is_client)
+{
+	TLS_CTX *ctx;
+
+	if (!(ctx = (TLS_CTX *)malloc(sizeof(TLS_CTX)))) {
+		error_print();
+		return NULL;
+	}
+	if (tls_ctx_init(ctx, protocol, is_client) != 1) {
+		free(ctx);
+		error_print();
+		return NULL;
+	}
+	ctx->refs = 1;
+	return ctx;
+}
+
+TLS_CTX *tls_ctx_up_ref(TLS_CTX *ctx)
+{
+	if (!ctx || !ctx->refs) {
+		error_print();
+		return NULL;
+	}
+	refs_mutex_lock();
+	ctx->refs++;
+	refs_mutex_unlock();
+	return ctx;
+}
+
+void tls_ctx_free(TLS_CTX *ctx)
+{
+	int refs;
+
+	if (!ctx) {
+		return;
+	}
+	if (!ctx->refs) {
+		error_puts("not a TLS_CTX from tls_ctx_new()");
+		return;
+	}
+	refs_mutex_lock();
+	refs = --ctx->refs;
+	refs_mutex_unlock();
+	if (refs == 0) {
+		tls_ctx_cleanup(ctx);
+		free(ctx);
+	}
+}
+
+struct TLS_CTX_SLOT_st {
+	cache_mutex_t mutex;
+	TLS_CTX *ctx;
+};
+
+TLS_CTX_SLOT *tls_ctx_slot_new(TLS_CTX *ctx)
+{
+	TLS_CTX_SLOT *slot;
+
+	if (!ctx || !ctx->refs) {
+		error_print();
+		return NULL;
+	}
+	if (!(slot = (TLS_CTX_SLOT *)calloc(1, sizeof(*slot)))) {
+		error_print();
+		return NULL;
+	}
+	cache_mutex_init(&slot->mutex);
+	slot->ctx = ctx;
+	return slot;
+}
+
+TLS_CTX *tls_ctx_slot_get(TLS_CTX_SLOT *slot)
+{
+	TLS_CTX *ctx;
+
+	if (!slot) {
+		error_print();
+		return NULL;
+	}
+	// the reference is taken before a concurrent tls_ctx_slot_set() can release the context
+	cache_mutex_lock(&slot->mutex);
+	ctx = tls_ctx_up_ref(slot->ctx);
+	cache_mutex_unlock(&slot->mutex);
+	return ctx;
+}
+
+int tls_ctx_slot_set(TLS_CTX_SLOT *slot, TLS_CTX *ctx)
+{
+	TLS_CTX *old;
+
+	if (!slot || !ctx || !ctx->refs) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock(&slot->mutex);
+	if (ctx->protocol != slot->ctx->protocol || ctx->is_client != slot->ctx->is_client) {
+		cache_mutex_unlock(&slot->mutex);
+		error_puts("the new TLS_CTX must have the protocol and the mode of the old one");
+		return -1;
+	}
+	old = slot->ctx;
+	slot->ctx = ctx;
+	cache_mutex_unlock(&slot->mutex);
+
+	// freed here or by tls_cleanup() of the last connection using it
+	tls_ctx_free(old);
+	return 1;
+}
+
+void tls_ctx_slot_free(TLS_CTX_SLOT *slot)
+{
+	if (slot) {
+		tls_ctx_free(slot->ctx);
+		cache_mutex_destroy(&slot->mutex);
+		free(slot);
+	}
+}
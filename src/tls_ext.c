@@ -758,6 +758,694 @@ int tls13_process_client_key_share(const uint8_t *ext_data, size_t ext_datalen,
 	return -1;
 }
 
+int tls13_client_key_share_has_group(const uint8_t *ext_data, size_t ext_datalen, int group)
+{
+	const uint8_t *client_shares;
+	size_t client_shares_len;
+
+	if (tls_uint16array_from_bytes(&client_shares, &client_shares_len, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	while (client_shares_len) {
+		uint16_t share_group;
+		const uint8_t *key_exchange;
+		size_t key_exchange_len;
+
+		if (tls_uint16_from_bytes(&share_group, &client_shares, &client_shares_len) != 1
+			|| tls_uint16array_from_bytes(&key_exchange, &key_exchange_len, &client_shares, &client_shares_len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (share_group == group) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+key_share in HelloRetryRequest
+
+  struct {
+	NamedGroup selected_group;
+  } KeyShareHelloRetryRequest;
+*/
+
+int tls13_hello_retry_request_key_share_ext_to_bytes(int group, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_key_share;
+
+	if (!tls_curve_name(group) || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)tls_uint16_size(), out, outlen);
+	tls_uint16_to_bytes((uint16_t)group, out, outlen);
+	return 1;
+}
+
+int tls13_process_hello_retry_request_key_share(const uint8_t *ext_data, size_t ext_datalen, int *group)
+{
+	uint16_t selected_group;
+
+	if (!group) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16_from_bytes(&selected_group, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!tls_curve_name(selected_group)) {
+		error_print();
+		return -1;
+	}
+	*group = selected_group;
+	return 1;
+}
+
+/*
+psk_key_exchange_modes
+
+  enum { psk_ke(0), psk_dhe_ke(1), (255) } PskKeyExchangeMode;
+
+  struct {
+	PskKeyExchangeMode ke_modes<1..255>;
+  } PskKeyExchangeModes;
+*/
+
+int tls13_psk_key_exchange_modes_ext_to_bytes(const int *modes, size_t modes_cnt, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_psk_key_exchange_modes;
+	size_t i;
+
+	if (!modes || !modes_cnt || modes_cnt > 255 || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(1 + modes_cnt), out, outlen);
+	tls_uint8_to_bytes((uint8_t)modes_cnt, out, outlen);
+	for (i = 0; i < modes_cnt; i++) {
+		tls_uint8_to_bytes((uint8_t)modes[i], out, outlen);
+	}
+	return 1;
+}
+
+// return 1 if `mode` is offered by the client, 0 if not
+int tls13_process_client_psk_key_exchange_modes(const uint8_t *ext_data, size_t ext_datalen, int mode)
+{
+	const uint8_t *ke_modes;
+	size_t ke_modes_len;
+
+	if (tls_uint8array_from_bytes(&ke_modes, &ke_modes_len, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1
+		|| !ke_modes_len) {
+		error_print();
+		return -1;
+	}
+	while (ke_modes_len--) {
+		if (*ke_modes++ == mode) {
+			return 1;
+		}
+	}
+	return 0;
+}
+
+/*
+pre_shared_key
+
+  struct {
+	opaque identity<1..2^16-1>;
+	uint32 obfuscated_ticket_age;
+  } PskIdentity;
+
+  opaque PskBinderEntry<32..255>;
+
+  struct {
+	PskIdentity identities<7..2^16-1>;
+	PskBinderEntry binders<33..2^16-1>;
+  } OfferedPsks;
+
+  struct {
+	select (Handshake.msg_type) {
+	case client_hello: OfferedPsks;
+	case server_hello: uint16 selected_identity;
+	};
+  } PreSharedKeyExtension;
+
+The extension must be the last one of ClientHello, the binders are computed
+over the ClientHello truncated before the binders field.
+*/
+
+int tls13_client_pre_shared_key_ext_to_bytes(const uint8_t *identity, size_t identitylen,
+	uint32_t obfuscated_ticket_age, const uint8_t *binder, size_t binderlen,
+	uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_pre_shared_key;
+	size_t identities_len = 0;
+	size_t binders_len = 0;
+
+	if (!identity || !identitylen || !binder || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (identitylen > 1024 || binderlen < 32 || binderlen > 255) {
+		error_print();
+		return -1;
+	}
+	tls_uint16array_to_bytes(identity, identitylen, NULL, &identities_len);
+	tls_uint32_to_bytes(obfuscated_ticket_age, NULL, &identities_len);
+	tls_uint8array_to_bytes(binder, binderlen, NULL, &binders_len);
+
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(2 + identities_len + 2 + binders_len), out, outlen);
+	tls_uint16_to_bytes((uint16_t)identities_len, out, outlen);
+	tls_uint16array_to_bytes(identity, identitylen, out, outlen);
+	tls_uint32_to_bytes(obfuscated_ticket_age, out, outlen);
+	tls_uint16_to_bytes((uint16_t)binders_len, out, outlen);
+	tls_uint8array_to_bytes(binder, binderlen, out, outlen);
+	return 1;
+}
+
+// only the first identity is used, `binders_size` is the size of the binders field
+int tls13_process_client_pre_shared_key(const uint8_t *ext_data, size_t ext_datalen,
+	const uint8_t **identity, size_t *identitylen, uint32_t *obfuscated_ticket_age,
+	const uint8_t **binder, size_t *binderlen, size_t *binders_size)
+{
+	const uint8_t *identities;
+	size_t identities_len;
+	const uint8_t *binders;
+	size_t binders_len;
+
+	if (!identity || !identitylen || !obfuscated_ticket_age || !binder || !binderlen || !binders_size) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16array_from_bytes(&identities, &identities_len, &ext_data, &ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	*binders_size = ext_datalen;
+	if (tls_uint16array_from_bytes(&binders, &binders_len, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16array_from_bytes(identity, identitylen, &identities, &identities_len) != 1
+		|| tls_uint32_from_bytes(obfuscated_ticket_age, &identities, &identities_len) != 1
+		|| tls_uint8array_from_bytes(binder, binderlen, &binders, &binders_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!*identitylen || *binderlen < 32) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_server_pre_shared_key_ext_to_bytes(int selected_identity, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_pre_shared_key;
+
+	if (selected_identity < 0 || selected_identity > 0xffff || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes(2, out, outlen);
+	tls_uint16_to_bytes((uint16_t)selected_identity, out, outlen);
+	return 1;
+}
+
+int tls13_process_server_pre_shared_key(const uint8_t *ext_data, size_t ext_datalen, int *selected_identity)
+{
+	uint16_t identity;
+
+	if (!selected_identity) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16_from_bytes(&identity, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	*selected_identity = identity;
+	return 1;
+}
+
+/*
+early_data
+
+  struct {} Empty;
+
+  struct {
+	select (Handshake.msg_type) {
+	case new_session_ticket:   uint32 max_early_data_size;
+	case client_hello:         Empty;
+	case encrypted_extensions: Empty;
+	};
+  } EarlyDataIndication;
+
+`max_early_data_size` is only given for NewSessionTicket, NULL otherwise.
+*/
+
+int tls13_early_data_ext_to_bytes(const uint32_t *max_early_data_size, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_early_data;
+
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	if (max_early_data_size) {
+		tls_uint16_to_bytes(4, out, outlen);
+		tls_uint32_to_bytes(*max_early_data_size, out, outlen);
+	} else {
+		tls_uint16_to_bytes(0, out, outlen);
+	}
+	return 1;
+}
+
+int tls13_process_early_data(const uint8_t *ext_data, size_t ext_datalen, uint32_t *max_early_data_size)
+{
+	if (max_early_data_size) {
+		if (tls_uint32_from_bytes(max_early_data_size, &ext_data, &ext_datalen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+/*
+cookie
+
+  struct {
+	opaque cookie<1..2^16-1>;
+  } Cookie;
+*/
+int tls13_cookie_ext_to_bytes(const uint8_t *cookie, size_t cookielen, uint8_t **out, size_t *outlen)
+{
+	if (!cookie || !cookielen || cookielen > TLS13_MAX_COOKIE_SIZE || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(TLS_extension_cookie, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(tls_uint16_size() + cookielen), out, outlen);
+	tls_uint16array_to_bytes(cookie, cookielen, out, outlen);
+	return 1;
+}
+
+int tls13_process_cookie(const uint8_t *ext_data, size_t ext_datalen, const uint8_t **cookie, size_t *cookielen)
+{
+	if (tls_uint16array_from_bytes(cookie, cookielen, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1
+		|| !*cookielen) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+/*
+status_request
+
+  struct {
+	CertificateStatusType status_type; -- ocsp(1)
+	select (status_type) {
+	case ocsp: OCSPStatusRequest;
+	} request;
+  } CertificateStatusRequest;
+
+  struct {
+	ResponderID responder_id_list<0..2^16-1>;
+	Extensions  request_extensions; -- opaque <0..2^16-1>
+  } OCSPStatusRequest;
+
+  struct {
+	CertificateStatusType status_type;
+	select (status_type) {
+	case ocsp: OCSPResponse; -- opaque <1..2^24-1>
+	} response;
+  } CertificateStatus;
+
+The client sends an empty OCSPStatusRequest, the TLCP ServerHello echoes an
+empty extension, the TLS 1.3 server sends the CertificateStatus as the
+extension of the first CertificateEntry.
+*/
+
+int tls_status_request_ext_to_bytes(uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_status_request;
+
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes(5, out, outlen);
+	tls_uint8_to_bytes(TLS_certificate_status_ocsp, out, outlen);
+	tls_uint16array_to_bytes(NULL, 0, out, outlen);
+	tls_uint16array_to_bytes(NULL, 0, out, outlen);
+	return 1;
+}
+
+int tls_process_status_request(const uint8_t *ext_data, size_t ext_datalen)
+{
+	uint8_t status_type;
+	const uint8_t *responder_id_list;
+	size_t responder_id_list_len;
+	const uint8_t *request_exts;
+	size_t request_exts_len;
+
+	if (tls_uint8_from_bytes(&status_type, &ext_data, &ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (status_type != TLS_certificate_status_ocsp) {
+		return 0;
+	}
+	// responders and request extensions are not supported, the response is always about the server
+	if (tls_uint16array_from_bytes(&responder_id_list, &responder_id_list_len, &ext_data, &ext_datalen) != 1
+		|| tls_uint16array_from_bytes(&request_exts, &request_exts_len, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_certificate_status_to_bytes(const uint8_t *ocsp_resp, size_t ocsp_resp_len, uint8_t **out, size_t *outlen)
+{
+	if (!ocsp_resp || !ocsp_resp_len || ocsp_resp_len > TLS_OCSP_MAX_RESPONSE_SIZE || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint8_to_bytes(TLS_certificate_status_ocsp, out, outlen);
+	tls_uint24array_to_bytes(ocsp_resp, ocsp_resp_len, out, outlen);
+	return 1;
+}
+
+int tls_certificate_status_from_bytes(const uint8_t **ocsp_resp, size_t *ocsp_resp_len, const uint8_t **in, size_t *inlen)
+{
+	uint8_t status_type;
+
+	if (!ocsp_resp || !ocsp_resp_len) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint8_from_bytes(&status_type, in, inlen) != 1
+		|| tls_uint24array_from_bytes(ocsp_resp, ocsp_resp_len, in, inlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (status_type != TLS_certificate_status_ocsp || !*ocsp_resp_len) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls13_certificate_status_ext_to_bytes(const uint8_t *ocsp_resp, size_t ocsp_resp_len, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_status_request;
+
+	if (!ocsp_resp || !ocsp_resp_len || ocsp_resp_len > TLS_OCSP_MAX_RESPONSE_SIZE || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(1 + 3 + ocsp_resp_len), out, outlen);
+	return tls_certificate_status_to_bytes(ocsp_resp, ocsp_resp_len, out, outlen);
+}
+
+/*
+compress_certificate
+
+  enum {
+	zlib(1),
+	brotli(2),
+	zstd(3),
+	(65535)
+  } CertificateCompressionAlgorithm;
+
+  struct {
+	CertificateCompressionAlgorithm algorithms<2..2^8-2>;
+  } CertificateCompressionAlgorithms;
+*/
+
+int tls13_compress_certificate_ext_to_bytes(const int *algors, size_t algors_cnt, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_compress_certificate;
+	size_t i;
+
+	if (!algors || !algors_cnt || algors_cnt > TLS_MAX_CERT_COMPRESSION_ALGORS || !outlen) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(1 + 2 * algors_cnt), out, outlen);
+	tls_uint8_to_bytes((uint8_t)(2 * algors_cnt), out, outlen);
+	for (i = 0; i < algors_cnt; i++) {
+		tls_uint16_to_bytes((uint16_t)algors[i], out, outlen);
+	}
+	return 1;
+}
+
+int tls13_process_compress_certificate(const uint8_t *ext_data, size_t ext_datalen,
+	const int *algors, size_t algors_cnt, int *algor)
+{
+	const uint8_t *p;
+	size_t len;
+	size_t i;
+
+	if (!algor) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint8array_from_bytes(&p, &len, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1
+		|| len < 2 || len % 2) {
+		error_print();
+		return -1;
+	}
+	*algor = 0;
+	for (i = 0; i < algors_cnt; i++) {
+		const uint8_t *cp = p;
+		size_t cplen = len;
+		while (cplen) {
+			uint16_t offered;
+			tls_uint16_from_bytes(&offered, &cp, &cplen);
+			if (offered == algors[i]) {
+				*algor = algors[i];
+				return 1;
+			}
+		}
+	}
+	return 0;
+}
+
+/*
+server_name
+
+  struct {
+	NameType name_type;
+	select (name_type) {
+		case host_name: HostName;
+	} name;
+  } ServerName;
+
+  enum {
+	host_name(0), (255)
+  } NameType;
+
+  opaque HostName<1..2^16-1>;
+
+  struct {
+	ServerName server_name_list<1..2^16-1>
+  } ServerNameList;
+
+The server acknowledges a used server_name with empty extension_data.
+*/
+
+// `host` NULL for the empty server_name of the server
+int tls_server_name_ext_to_bytes(const char *host, uint8_t **out, size_t *outlen)
+{
+	uint16_t ext_type = TLS_extension_server_name;
+	size_t hostlen;
+
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	if (!host) {
+		tls_uint16_to_bytes(ext_type, out, outlen);
+		tls_uint16_to_bytes(0, out, outlen);
+		return 1;
+	}
+	hostlen = strlen(host);
+	if (!hostlen || hostlen > TLS_MAX_SERVER_NAME_SIZE) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(ext_type, out, outlen);
+	tls_uint16_to_bytes((uint16_t)(2 + 1 + 2 + hostlen), out, outlen);
+	tls_uint16_to_bytes((uint16_t)(1 + 2 + hostlen), out, outlen);
+	tls_uint8_to_bytes(TLS_server_name_host_name, out, outlen);
+	tls_uint16array_to_bytes((const uint8_t *)host, hostlen, out, outlen);
+	return 1;
+}
+
+// the host_name in lower case, other name types are skipped, return 0 without a host_name
+int tls_process_server_name(const uint8_t *ext_data, size_t ext_datalen, char host[TLS_MAX_SERVER_NAME_SIZE + 1])
+{
+	const uint8_t *list;
+	size_t listlen;
+
+	if (!host) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16array_from_bytes(&list, &listlen, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1
+		|| !listlen) {
+		error_print();
+		return -1;
+	}
+	while (listlen) {
+		uint8_t name_type;
+		const uint8_t *name;
+		size_t namelen;
+		size_t i;
+
+		if (tls_uint8_from_bytes(&name_type, &list, &listlen) != 1
+			|| tls_uint16array_from_bytes(&name, &namelen, &list, &listlen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (name_type != TLS_server_name_host_name) {
+			continue;
+		}
+		if (!namelen || namelen > TLS_MAX_SERVER_NAME_SIZE) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < namelen; i++) {
+			if (!name[i]) {
+				error_print();
+				return -1;
+			}
+			host[i] = (name[i] >= 'A' && name[i] <= 'Z') ? (char)(name[i] + ('a' - 'A')) : (char)name[i];
+		}
+		host[namelen] = 0;
+		return 1;
+	}
+	return 0;
+}
+
+/*
+max_fragment_length (RFC 6066)
+
+  enum {
+	2^9(1), 2^10(2), 2^11(3), 2^12(4), (255)
+  } MaxFragmentLength;
+
+The server echoes the value of the client.
+*/
+
+int tls_max_fragment_length_ext_to_bytes(int code, uint8_t **out, size_t *outlen)
+{
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	if (code < TLS_max_fragment_length_512 || code > TLS_max_fragment_length_4096) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(TLS_extension_max_fragment_length, out, outlen);
+	tls_uint16_to_bytes(1, out, outlen);
+	tls_uint8_to_bytes((uint8_t)code, out, outlen);
+	return 1;
+}
+
+// return 0 for an unknown value
+int tls_process_max_fragment_length(const uint8_t *ext_data, size_t ext_datalen, int *code)
+{
+	uint8_t val;
+
+	if (!code) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint8_from_bytes(&val, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (val < TLS_max_fragment_length_512 || val > TLS_max_fragment_length_4096) {
+		*code = 0;
+		return 0;
+	}
+	*code = val;
+	return 1;
+}
+
+/*
+record_size_limit (RFC 8449)
+
+  uint16 RecordSizeLimit;
+
+The largest record the sender is willing to receive, the content type and the
+padding of a TLS 1.3 record are counted in. Both ends send their own limit.
+*/
+
+int tls_record_size_limit_ext_to_bytes(uint16_t limit, uint8_t **out, size_t *outlen)
+{
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	if (limit < TLS_MIN_RECORD_SIZE_LIMIT) {
+		error_print();
+		return -1;
+	}
+	tls_uint16_to_bytes(TLS_extension_record_size_limit, out, outlen);
+	tls_uint16_to_bytes(2, out, outlen);
+	tls_uint16_to_bytes(limit, out, outlen);
+	return 1;
+}
+
+int tls_process_record_size_limit(const uint8_t *ext_data, size_t ext_datalen, uint16_t *limit)
+{
+	if (!limit) {
+		error_print();
+		return -1;
+	}
+	if (tls_uint16_from_bytes(limit, &ext_data, &ext_datalen) != 1
+		|| tls_length_is_zero(ext_datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (*limit < TLS_MIN_RECORD_SIZE_LIMIT) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 /*
 certificate_authorities
 
@@ -931,6 +1619,7 @@ static int tls13_encrypted_extensions_exts[] = {
 	TLS_extension_client_certificate_type,
 	TLS_extension_server_certificate_type,
 	TLS_extension_early_data,
+	TLS_extension_record_size_limit,
 };
 
 static int tls13_certificate_exts[] = {
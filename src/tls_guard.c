@@ -0,0 +1,228 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <time.h>
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/tls.h>
+#include <gmssl/sm3.h>
+#include <gmssl/mem.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION guard_mutex_t;
+#define guard_mutex_init(m)	InitializeCriticalSection(m)
+#define guard_mutex_destroy(m)	DeleteCriticalSection(m)
+#define guard_mutex_lock(m)	EnterCriticalSection(m)
+#define guard_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t guard_mutex_t;
+#define guard_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define guard_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define guard_mutex_lock(m)	pthread_mutex_lock(m)
+#define guard_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+#define TLS_COOKIE_KEY_SIZE	32
+
+struct TLS_HANDSHAKE_GUARD_st {
+	guard_mutex_t mutex;
+	int cookie_mode;
+	size_t max_key_ops;
+	size_t key_ops;
+	// the keys of the current and the previous period, generated when first used
+	uint8_t cookie_keys[2][TLS_COOKIE_KEY_SIZE];
+	uint32_t cookie_key_periods[2];
+	int cookie_keys_set[2];
+};
+
+TLS_HANDSHAKE_GUARD *tls_handshake_guard_new(int cookie_mode, size_t max_key_ops)
+{
+	TLS_HANDSHAKE_GUARD *guard;
+
+	switch (cookie_mode) {
+	case TLS_cookie_off:
+	case TLS_cookie_always:
+		break;
+	case TLS_cookie_under_load:
+		if (!max_key_ops) {
+			error_puts("the load of TLS_cookie_under_load is measured against max_key_ops");
+			return NULL;
+		}
+		break;
+	default:
+		error_print();
+		return NULL;
+	}
+	if (!(guard = (TLS_HANDSHAKE_GUARD *)calloc(1, sizeof(*guard)))) {
+		error_print();
+		return NULL;
+	}
+	guard_mutex_init(&guard->mutex);
+	guard->cookie_mode = cookie_mode;
+	guard->max_key_ops = max_key_ops;
+	return guard;
+}
+
+void tls_handshake_guard_free(TLS_HANDSHAKE_GUARD *guard)
+{
+	if (guard) {
+		guard_mutex_destroy(&guard->mutex);
+		gmssl_secure_clear(guard, sizeof(*guard));
+		free(guard);
+	}
+}
+
+int tls_handshake_guard_cookie_required(TLS_HANDSHAKE_GUARD *guard)
+{
+	int ret;
+
+	switch (guard->cookie_mode) {
+	case TLS_cookie_always:
+		return 1;
+	case TLS_cookie_under_load:
+		guard_mutex_lock(&guard->mutex);
+		ret = guard->key_ops * 2 >= guard->max_key_ops;
+		guard_mutex_unlock(&guard->mutex);
+		return ret;
+	}
+	return 0;
+}
+
+// copy the key of `period`, a new one for the current period, 0 if it has been rotated out
+static int tls_handshake_guard_cookie_key(TLS_HANDSHAKE_GUARD *guard, uint32_t period, int is_new,
+	uint8_t key[TLS_COOKIE_KEY_SIZE])
+{
+	int i = period & 1;
+	int ret = 1;
+
+	guard_mutex_lock(&guard->mutex);
+	if (!guard->cookie_keys_set[i] || guard->cookie_key_periods[i] != period) {
+		if (!is_new || rand_bytes(guard->cookie_keys[i], TLS_COOKIE_KEY_SIZE) != 1) {
+			ret = is_new ? -1 : 0;
+			goto end;
+		}
+		guard->cookie_key_periods[i] = period;
+		guard->cookie_keys_set[i] = 1;
+	}
+	memcpy(key, guard->cookie_keys[i], TLS_COOKIE_KEY_SIZE);
+end:
+	guard_mutex_unlock(&guard->mutex);
+	return ret;
+}
+
+static void tls_cookie_mac(const uint8_t key[TLS_COOKIE_KEY_SIZE],
+	const uint8_t *cookie, size_t len, uint8_t mac[SM3_HMAC_SIZE])
+{
+	SM3_HMAC_CTX hmac_ctx;
+
+	sm3_hmac_init(&hmac_ctx, key, TLS_COOKIE_KEY_SIZE);
+	sm3_hmac_update(&hmac_ctx, cookie, len);
+	sm3_hmac_finish(&hmac_ctx, mac);
+	gmssl_secure_clear(&hmac_ctx, sizeof(hmac_ctx));
+}
+
+/*
+struct {
+	uint32 period;
+	opaque data[datalen];
+	opaque mac[32]; // SM3-HMAC of the above under the key of the period
+} Cookie;
+*/
+int tls_handshake_guard_seal_cookie(TLS_HANDSHAKE_GUARD *guard, const uint8_t *data, size_t datalen,
+	uint8_t *cookie, size_t *cookielen, size_t maxlen)
+{
+	uint32_t period = (uint32_t)(time(NULL) / TLS_HANDSHAKE_COOKIE_LIFETIME);
+	uint8_t key[TLS_COOKIE_KEY_SIZE];
+	uint8_t *p = cookie;
+	size_t len = 0;
+
+	if (!guard || !data || !cookie || !cookielen) {
+		error_print();
+		return -1;
+	}
+	if (4 + datalen + SM3_HMAC_SIZE > maxlen) {
+		error_print();
+		return -1;
+	}
+	if (tls_handshake_guard_cookie_key(guard, period, 1, key) != 1) {
+		error_print();
+		return -1;
+	}
+	tls_uint32_to_bytes(period, &p, &len);
+	tls_array_to_bytes(data, datalen, &p, &len);
+	tls_cookie_mac(key, cookie, len, p);
+	*cookielen = len + SM3_HMAC_SIZE;
+	gmssl_secure_clear(key, sizeof(key));
+	return 1;
+}
+
+int tls_handshake_guard_open_cookie(TLS_HANDSHAKE_GUARD *guard, const uint8_t *cookie, size_t cookielen,
+	const uint8_t **data, size_t *datalen)
+{
+	uint32_t now = (uint32_t)(time(NULL) / TLS_HANDSHAKE_COOKIE_LIFETIME);
+	uint32_t period;
+	const uint8_t *p = cookie;
+	size_t len = cookielen;
+	uint8_t key[TLS_COOKIE_KEY_SIZE];
+	uint8_t mac[SM3_HMAC_SIZE];
+	int ret;
+
+	if (!guard || !cookie || !data || !datalen) {
+		error_print();
+		return -1;
+	}
+	if (cookielen < 4 + SM3_HMAC_SIZE) {
+		return 0;
+	}
+	tls_uint32_from_bytes(&period, &p, &len);
+	if (period != now && period + 1 != now) {
+		return 0;
+	}
+	if ((ret = tls_handshake_guard_cookie_key(guard, period, 0, key)) != 1) {
+		return ret;
+	}
+	tls_cookie_mac(key, cookie, cookielen - SM3_HMAC_SIZE, mac);
+	gmssl_secure_clear(key, sizeof(key));
+	if (gmssl_secure_memcmp(mac, cookie + cookielen - SM3_HMAC_SIZE, SM3_HMAC_SIZE) != 0) {
+		return 0;
+	}
+	*data = p;
+	*datalen = len - SM3_HMAC_SIZE;
+	return 1;
+}
+
+int tls_handshake_guard_admit(TLS_HANDSHAKE_GUARD *guard)
+{
+	int ret = 1;
+
+	guard_mutex_lock(&guard->mutex);
+	if (guard->max_key_ops && guard->key_ops >= guard->max_key_ops) {
+		ret = 0;
+	} else {
+		guard->key_ops++;
+	}
+	guard_mutex_unlock(&guard->mutex);
+	return ret;
+}
+
+void tls_handshake_guard_release(TLS_HANDSHAKE_GUARD *guard)
+{
+	guard_mutex_lock(&guard->mutex);
+	if (guard->key_ops) {
+		guard->key_ops--;
+	}
+	guard_mutex_unlock(&guard->mutex);
+}
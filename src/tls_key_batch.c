@@ -0,0 +1,248 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/tls.h>
+#include <gmssl/sm2.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#include <gmssl/metrics.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION batch_mutex_t;
+#define batch_mutex_init(m)	InitializeCriticalSection(m)
+#define batch_mutex_destroy(m)	DeleteCriticalSection(m)
+#define batch_mutex_lock(m)	EnterCriticalSection(m)
+#define batch_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t batch_mutex_t;
+#define batch_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define batch_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define batch_mutex_lock(m)	pthread_mutex_lock(m)
+#define batch_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+typedef struct {
+	uint8_t in[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t inlen;
+	uint8_t out[SM2_MAX_PLAINTEXT_SIZE];
+	size_t outlen;
+	int done;
+	int ret;
+} TLS_DECRYPT_JOB;
+
+struct TLS_DECRYPT_BATCH_st {
+	batch_mutex_t mutex;
+	size_t max_jobs;
+	uint64_t window_nsec;
+	const SM2_KEY *key; // of the queued jobs
+	uint64_t first_time; // of the oldest queued job
+	size_t jobs_cnt;
+	TLS_DECRYPT_JOB *jobs[1]; // max_jobs
+};
+
+TLS_DECRYPT_BATCH *tls_decrypt_batch_new(size_t max_jobs, uint64_t window_nsec)
+{
+	TLS_DECRYPT_BATCH *batch;
+
+	if (!max_jobs) {
+		error_print();
+		return NULL;
+	}
+	if (!(batch = (TLS_DECRYPT_BATCH *)calloc(1, sizeof(*batch) + (max_jobs - 1) * sizeof(TLS_DECRYPT_JOB *)))) {
+		error_print();
+		return NULL;
+	}
+	batch_mutex_init(&batch->mutex);
+	batch->max_jobs = max_jobs;
+	batch->window_nsec = window_nsec;
+	return batch;
+}
+
+// the queued jobs are owned by their connections, tls_cleanup() cancels them
+void tls_decrypt_batch_free(TLS_DECRYPT_BATCH *batch)
+{
+	if (batch) {
+		batch_mutex_destroy(&batch->mutex);
+		free(batch);
+	}
+}
+
+// decrypt the queued jobs, the mutex is held
+static size_t tls_decrypt_batch_run_locked(TLS_DECRYPT_BATCH *batch)
+{
+	const uint8_t *ins[SM2_DECRYPT_BATCH_SIZE];
+	size_t inlens[SM2_DECRYPT_BATCH_SIZE];
+	uint8_t *outs[SM2_DECRYPT_BATCH_SIZE];
+	size_t outlens[SM2_DECRYPT_BATCH_SIZE];
+	int results[SM2_DECRYPT_BATCH_SIZE];
+	size_t cnt = batch->jobs_cnt;
+	size_t i, j, n;
+
+	for (i = 0; i < cnt; i += n) {
+		n = cnt - i < SM2_DECRYPT_BATCH_SIZE ? cnt - i : SM2_DECRYPT_BATCH_SIZE;
+		for (j = 0; j < n; j++) {
+			ins[j] = batch->jobs[i + j]->in;
+			inlens[j] = batch->jobs[i + j]->inlen;
+			outs[j] = batch->jobs[i + j]->out;
+		}
+		if (sm2_decrypt_batch(batch->key, ins, inlens, n, outs, outlens, results) < 0) {
+			error_print();
+			for (j = 0; j < n; j++) {
+				results[j] = -1;
+			}
+		}
+		for (j = 0; j < n; j++) {
+			TLS_DECRYPT_JOB *job = batch->jobs[i + j];
+			job->outlen = results[j] == 1 ? outlens[j] : 0;
+			job->ret = results[j];
+			job->done = 1;
+		}
+	}
+	batch->jobs_cnt = 0;
+	batch->key = NULL;
+	return cnt;
+}
+
+size_t tls_decrypt_batch_run(TLS_DECRYPT_BATCH *batch)
+{
+	size_t cnt;
+
+	if (!batch) {
+		error_print();
+		return 0;
+	}
+	batch_mutex_lock(&batch->mutex);
+	cnt = tls_decrypt_batch_run_locked(batch);
+	batch_mutex_unlock(&batch->mutex);
+	return cnt;
+}
+
+// the result of a done job, which is freed
+static int tls_decrypt_job_result(TLS_DECRYPT_JOB *job, uint8_t *out, size_t *outlen)
+{
+	int ret = job->ret;
+
+	if (ret == 1) {
+		memcpy(out, job->out, job->outlen);
+		*outlen = job->outlen;
+	}
+	gmssl_secure_clear(job, sizeof(*job));
+	free(job);
+	return ret;
+}
+
+// the ServerKeyExchange signature is not batched
+static int tls_decrypt_batch_sign(void *arg, const SM2_KEY *key, const uint8_t dgst[32],
+	uint8_t *sig, size_t *siglen, void **job)
+{
+	SM2_SIGNATURE signature;
+
+	*siglen = 0;
+	if (sm2_do_sign(key, dgst, &signature) != 1
+		|| sm2_signature_to_der(&signature, &sig, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int tls_decrypt_batch_decrypt(void *arg, const SM2_KEY *key, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t *outlen, void **job)
+{
+	TLS_DECRYPT_BATCH *batch = (TLS_DECRYPT_BATCH *)arg;
+	TLS_DECRYPT_JOB *j;
+
+	if (inlen > SM2_MAX_CIPHERTEXT_SIZE) {
+		error_print();
+		return -1;
+	}
+	if (!(j = (TLS_DECRYPT_JOB *)calloc(1, sizeof(*j)))) {
+		error_print();
+		return -1;
+	}
+	memcpy(j->in, in, inlen);
+	j->inlen = inlen;
+
+	batch_mutex_lock(&batch->mutex);
+	// a batch is under one key, the jobs of another key start a new one
+	if (batch->jobs_cnt && batch->key != key) {
+		tls_decrypt_batch_run_locked(batch);
+	}
+	if (!batch->jobs_cnt) {
+		batch->key = key;
+		batch->first_time = metrics_nsec();
+	}
+	batch->jobs[batch->jobs_cnt++] = j;
+	if (batch->jobs_cnt == batch->max_jobs) {
+		tls_decrypt_batch_run_locked(batch);
+	}
+	batch_mutex_unlock(&batch->mutex);
+
+	if (j->done) {
+		return tls_decrypt_job_result(j, out, outlen);
+	}
+	*job = j;
+	return TLS_ERROR_WANT_ASYNC;
+}
+
+static int tls_decrypt_batch_complete(void *arg, void *job, uint8_t *out, size_t *outlen)
+{
+	TLS_DECRYPT_BATCH *batch = (TLS_DECRYPT_BATCH *)arg;
+	TLS_DECRYPT_JOB *j = (TLS_DECRYPT_JOB *)job;
+	int done;
+
+	batch_mutex_lock(&batch->mutex);
+	if (!j->done && metrics_nsec() - batch->first_time >= batch->window_nsec) {
+		tls_decrypt_batch_run_locked(batch);
+	}
+	done = j->done;
+	batch_mutex_unlock(&batch->mutex);
+
+	if (!done) {
+		return TLS_ERROR_WANT_ASYNC;
+	}
+	return tls_decrypt_job_result(j, out, outlen);
+}
+
+static void tls_decrypt_batch_cancel(void *arg, void *job)
+{
+	TLS_DECRYPT_BATCH *batch = (TLS_DECRYPT_BATCH *)arg;
+	TLS_DECRYPT_JOB *j = (TLS_DECRYPT_JOB *)job;
+	size_t i;
+
+	batch_mutex_lock(&batch->mutex);
+	for (i = 0; i < batch->jobs_cnt; i++) {
+		if (batch->jobs[i] == j) {
+			memmove(&batch->jobs[i], &batch->jobs[i + 1], (batch->jobs_cnt - i - 1) * sizeof(j));
+			batch->jobs_cnt--;
+			break;
+		}
+	}
+	batch_mutex_unlock(&batch->mutex);
+
+	gmssl_secure_clear(j, sizeof(*j));
+	free(j);
+}
+
+void tls_decrypt_batch_key_method(TLS_DECRYPT_BATCH *batch, TLS_PRIVATE_KEY_METHOD *method)
+{
+	memset(method, 0, sizeof(*method));
+	method->sign = tls_decrypt_batch_sign;
+	method->decrypt = tls_decrypt_batch_decrypt;
+	method->complete = tls_decrypt_batch_complete;
+	method->cancel = tls_decrypt_batch_cancel;
+	method->arg = batch;
+}
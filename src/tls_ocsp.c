@@ -0,0 +1,268 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ocsp.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+struct TLS_OCSP_STAPLER_st {
+	cache_mutex_t mutex;
+	uint8_t *cert;
+	size_t certlen;
+	uint8_t *cacert;
+	size_t cacertlen;
+	TLS_OCSP_FETCH fetch;
+	void *fetch_arg;
+	uint8_t resp[TLS_OCSP_MAX_RESPONSE_SIZE];
+	size_t resplen; // 0 if there is no response
+	time_t expires;
+	time_t refresh_at;
+	time_t last_fetch;
+	int refreshing;
+	int refs; // the owner and a running background refresh
+};
+
+static int tls_ocsp_default_fetch(void *arg, const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, uint8_t **resp, size_t *resplen)
+{
+	int ret;
+	(void)arg;
+	if ((ret = x509_ocsp_response_new_from_cert(resp, resplen, cert, certlen, cacert, cacertlen)) != 1) {
+		if (!ret) error_puts("no OCSP URI in the certificate");
+		return -1;
+	}
+	return 1;
+}
+
+static void tls_ocsp_stapler_unref(TLS_OCSP_STAPLER *stapler)
+{
+	int refs;
+
+	cache_mutex_lock(&stapler->mutex);
+	refs = --stapler->refs;
+	cache_mutex_unlock(&stapler->mutex);
+	if (refs == 0) {
+		cache_mutex_destroy(&stapler->mutex);
+		free(stapler->cert);
+		free(stapler->cacert);
+		free(stapler);
+	}
+}
+
+TLS_OCSP_STAPLER *tls_ocsp_stapler_new(const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, TLS_OCSP_FETCH fetch, void *fetch_arg)
+{
+	TLS_OCSP_STAPLER *stapler;
+
+	if (!cert || !certlen || !cacert || !cacertlen) {
+		error_print();
+		return NULL;
+	}
+	if (!(stapler = (TLS_OCSP_STAPLER *)calloc(1, sizeof(*stapler)))) {
+		error_print();
+		return NULL;
+	}
+	if (!(stapler->cert = (uint8_t *)malloc(certlen))
+		|| !(stapler->cacert = (uint8_t *)malloc(cacertlen))) {
+		free(stapler->cert);
+		free(stapler);
+		error_print();
+		return NULL;
+	}
+	memcpy(stapler->cert, cert, certlen);
+	stapler->certlen = certlen;
+	memcpy(stapler->cacert, cacert, cacertlen);
+	stapler->cacertlen = cacertlen;
+	stapler->fetch = fetch ? fetch : tls_ocsp_default_fetch;
+	stapler->fetch_arg = fetch_arg;
+	stapler->refs = 1;
+	cache_mutex_init(&stapler->mutex);
+	return stapler;
+}
+
+// a refresh still running frees the stapler when it is done
+void tls_ocsp_stapler_free(TLS_OCSP_STAPLER *stapler)
+{
+	if (stapler) {
+		tls_ocsp_stapler_unref(stapler);
+	}
+}
+
+// with the lock held, the refresh starts in the last quarter of the validity
+static void tls_ocsp_stapler_set_times(TLS_OCSP_STAPLER *stapler, time_t this_update, time_t next_update, time_t now)
+{
+	time_t begin;
+
+	if (next_update >= 0) {
+		begin = this_update < now ? this_update : now;
+		stapler->expires = next_update;
+	} else {
+		begin = now;
+		stapler->expires = now + TLS_OCSP_DEFAULT_TTL;
+	}
+	stapler->refresh_at = stapler->expires - (stapler->expires - begin)/4;
+}
+
+int tls_ocsp_stapler_set_response(TLS_OCSP_STAPLER *stapler, const uint8_t *resp, size_t resplen)
+{
+	int cert_status;
+	time_t this_update;
+	time_t next_update;
+	time_t now;
+
+	if (!stapler || !resp || !resplen) {
+		error_print();
+		return -1;
+	}
+	if (resplen > TLS_OCSP_MAX_RESPONSE_SIZE) {
+		error_print();
+		return -1;
+	}
+	// the stapled response is only replaced by a valid one
+	time(&now);
+	if (x509_ocsp_response_verify(resp, resplen, stapler->cert, stapler->certlen,
+		stapler->cacert, stapler->cacertlen, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now,
+		&cert_status, &this_update, &next_update) != 1) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock(&stapler->mutex);
+	memcpy(stapler->resp, resp, resplen);
+	stapler->resplen = resplen;
+	tls_ocsp_stapler_set_times(stapler, this_update, next_update, now);
+	cache_mutex_unlock(&stapler->mutex);
+	return 1;
+}
+
+int tls_ocsp_stapler_refresh(TLS_OCSP_STAPLER *stapler)
+{
+	uint8_t *resp = NULL;
+	size_t resplen;
+	int ret;
+
+	if (!stapler) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock(&stapler->mutex);
+	stapler->last_fetch = time(NULL);
+	cache_mutex_unlock(&stapler->mutex);
+
+	if (stapler->fetch(stapler->fetch_arg, stapler->cert, stapler->certlen,
+		stapler->cacert, stapler->cacertlen, &resp, &resplen) != 1) {
+		error_print();
+		return -1;
+	}
+	ret = tls_ocsp_stapler_set_response(stapler, resp, resplen);
+	free(resp);
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static void tls_ocsp_stapler_background_refresh(TLS_OCSP_STAPLER *stapler)
+{
+	(void)tls_ocsp_stapler_refresh(stapler);
+	cache_mutex_lock(&stapler->mutex);
+	stapler->refreshing = 0;
+	cache_mutex_unlock(&stapler->mutex);
+	tls_ocsp_stapler_unref(stapler);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI tls_ocsp_stapler_thread(LPVOID arg)
+{
+	tls_ocsp_stapler_background_refresh((TLS_OCSP_STAPLER *)arg);
+	return 0;
+}
+
+static int tls_ocsp_stapler_refresh_start(TLS_OCSP_STAPLER *stapler)
+{
+	HANDLE thread;
+	if (!(thread = CreateThread(NULL, 0, tls_ocsp_stapler_thread, stapler, 0, NULL))) {
+		return -1;
+	}
+	CloseHandle(thread);
+	return 1;
+}
+#else
+static void *tls_ocsp_stapler_thread(void *arg)
+{
+	tls_ocsp_stapler_background_refresh((TLS_OCSP_STAPLER *)arg);
+	return NULL;
+}
+
+static int tls_ocsp_stapler_refresh_start(TLS_OCSP_STAPLER *stapler)
+{
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, tls_ocsp_stapler_thread, stapler) != 0) {
+		return -1;
+	}
+	pthread_detach(thread);
+	return 1;
+}
+#endif
+
+int tls_ocsp_stapler_get(TLS_OCSP_STAPLER *stapler, uint8_t *resp, size_t *resplen, size_t maxlen)
+{
+	time_t now;
+	int ret = 0;
+
+	if (!stapler || !resp || !resplen) {
+		error_print();
+		return -1;
+	}
+	*resplen = 0;
+	time(&now);
+
+	cache_mutex_lock(&stapler->mutex);
+	if ((!stapler->resplen || now >= stapler->refresh_at) && !stapler->refreshing
+		&& now - stapler->last_fetch >= TLS_OCSP_RETRY_SECONDS) {
+		stapler->refs++;
+		stapler->refreshing = 1;
+		stapler->last_fetch = now;
+		if (tls_ocsp_stapler_refresh_start(stapler) != 1) {
+			error_print();
+			stapler->refs--;
+			stapler->refreshing = 0;
+		}
+	}
+	if (stapler->resplen && now < stapler->expires && stapler->resplen <= maxlen) {
+		memcpy(resp, stapler->resp, stapler->resplen);
+		*resplen = stapler->resplen;
+		ret = 1;
+	}
+	cache_mutex_unlock(&stapler->mutex);
+	return ret;
+}
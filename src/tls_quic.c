@@ -0,0 +1,626 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+/*
+ * The handshake of tls13.c still builds and protects TLS records. The records
+ * it sends are taken by tls_conn_record_send() and opened with the write key
+ * and sequence number they were just sealed with, the handshake messages they
+ * hold go to the CRYPTO data of their level. The messages received are given
+ * back to the handshake as records sealed with the read key it expects next,
+ * one message per record, so the keys of the records always follow the ones
+ * of the connection.
+ */
+
+static const uint8_t zeros[32];
+
+static void tls_quic_set_secrets(TLS_QUIC *quic, int level,
+	const uint8_t client_secret[32], const uint8_t server_secret[32])
+{
+	int client_is_write = quic->conn->is_client ? 1 : 0;
+
+	if (!quic->secrets_set[level][client_is_write] && memcmp(client_secret, zeros, 32)) {
+		memcpy(quic->secrets[level][client_is_write], client_secret, 32);
+		quic->secrets_set[level][client_is_write] = 1;
+	}
+	if (!quic->secrets_set[level][!client_is_write] && memcmp(server_secret, zeros, 32)) {
+		memcpy(quic->secrets[level][!client_is_write], server_secret, 32);
+		quic->secrets_set[level][!client_is_write] = 1;
+	}
+}
+
+// the handshake secrets are only kept in conn->hs until the handshake is done
+static void tls_quic_update_secrets(TLS_QUIC *quic)
+{
+	TLS_CONNECT *conn = quic->conn;
+
+	tls_quic_set_secrets(quic, TLS_QUIC_handshake,
+		conn->hs.client_handshake_traffic_secret, conn->hs.server_handshake_traffic_secret);
+	tls_quic_set_secrets(quic, TLS_QUIC_application,
+		conn->client_application_traffic_secret, conn->server_application_traffic_secret);
+}
+
+static int tls_quic_buffer_append(uint8_t **buf, size_t *buflen, const uint8_t *data, size_t datalen)
+{
+	if (datalen > TLS_QUIC_MAX_DATA_SIZE - *buflen) {
+		error_print();
+		return -1;
+	}
+	if (!*buf && !(*buf = (uint8_t *)malloc(TLS_QUIC_MAX_DATA_SIZE))) {
+		error_print();
+		return -1;
+	}
+	memcpy(*buf + *buflen, data, datalen);
+	*buflen += datalen;
+	return 1;
+}
+
+static tls_ret_t tls_quic_transport_send(void *arg, const uint8_t *buf, size_t len)
+{
+	// everything goes through tls_quic_record_send()
+	(void)arg;
+	(void)buf;
+	(void)len;
+	errno = EINVAL;
+	return -1;
+}
+
+// the next complete message of the lowest level, sealed as the handshake expects
+static int tls_quic_next_record(TLS_QUIC *quic)
+{
+	TLS_CONNECT *conn = quic->conn;
+	uint8_t *record = quic->record;
+	uint8_t *plain_record = NULL;
+	size_t msglen = 0;
+	int level;
+	int ret = -1;
+
+	for (level = 0; level < TLS_QUIC_LEVELS; level++) {
+		if (quic->inlen[level] >= TLS_HANDSHAKE_HEADER_SIZE) {
+			msglen = TLS_HANDSHAKE_HEADER_SIZE + (((size_t)quic->in[level][1] << 16)
+				| ((size_t)quic->in[level][2] << 8) | quic->in[level][3]);
+			if (msglen > TLS_MAX_PLAINTEXT_SIZE) {
+				error_print();
+				return -1;
+			}
+			if (msglen <= quic->inlen[level]) {
+				break;
+			}
+		}
+	}
+	if (level == TLS_QUIC_LEVELS) {
+		return 0;
+	}
+
+	if (level == TLS_QUIC_initial) {
+		plain_record = record;
+	} else if (!(plain_record = tls_buffer_get())) {
+		error_print();
+		return -1;
+	}
+	plain_record[0] = TLS_record_handshake;
+	plain_record[1] = TLS_protocol_tls12 >> 8;
+	plain_record[2] = TLS_protocol_tls12 & 0xff;
+	plain_record[3] = (uint8_t)(msglen >> 8);
+	plain_record[4] = (uint8_t)msglen;
+	memcpy(plain_record + TLS_RECORD_HEADER_SIZE, quic->in[level], msglen);
+	quic->recordlen = TLS_RECORD_HEADER_SIZE + msglen;
+
+	if (level != TLS_QUIC_initial) {
+		const BLOCK_CIPHER_KEY *key = conn->is_client ? &conn->server_write_key : &conn->client_write_key;
+		const uint8_t *iv = conn->is_client ? conn->server_write_iv : conn->client_write_iv;
+		const uint8_t *seq_num = conn->is_client ? conn->server_seq_num : conn->client_seq_num;
+
+		if (tls13_record_encrypt(key, iv, seq_num, plain_record, quic->recordlen, 0,
+			record, &quic->recordlen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	quic->inlen[level] -= msglen;
+	memmove(quic->in[level], quic->in[level] + msglen, quic->inlen[level]);
+	quic->record_offset = 0;
+	ret = 1;
+
+end:
+	if (plain_record && plain_record != record) {
+		gmssl_secure_clear(plain_record, TLS_MAX_RECORD_SIZE);
+		tls_buffer_put(plain_record);
+	}
+	return ret;
+}
+
+static tls_ret_t tls_quic_transport_recv(void *arg, uint8_t *buf, size_t len)
+{
+	TLS_QUIC *quic = (TLS_QUIC *)arg;
+	int ret;
+
+	tls_quic_update_secrets(quic);
+
+	if (quic->record_offset == quic->recordlen) {
+		if (!quic->record && !(quic->record = (uint8_t *)malloc(TLS_MAX_RECORD_SIZE))) {
+			error_print();
+			errno = ENOMEM;
+			return -1;
+		}
+		if ((ret = tls_quic_next_record(quic)) != 1) {
+			if (ret < 0) {
+				error_print();
+				errno = EPROTO;
+			} else {
+				errno = EAGAIN;
+			}
+			return -1;
+		}
+	}
+	if (len > quic->recordlen - quic->record_offset) {
+		len = quic->recordlen - quic->record_offset;
+	}
+	memcpy(buf, quic->record + quic->record_offset, len);
+	quic->record_offset += len;
+	return (tls_ret_t)len;
+}
+
+int tls_quic_init(TLS_QUIC *quic, TLS_CONNECT *conn)
+{
+	TLS_TRANSPORT transport;
+
+	if (!quic || !conn) {
+		error_print();
+		return -1;
+	}
+	if (conn->protocol != TLS_protocol_tls13) {
+		error_print();
+		return -1;
+	}
+
+	memset(quic, 0, sizeof(TLS_QUIC));
+	quic->conn = conn;
+	quic->write_level = TLS_QUIC_handshake;
+	quic->alert = -1;
+
+	transport.send = tls_quic_transport_send;
+	transport.recv = tls_quic_transport_recv;
+	transport.arg = quic;
+	if (tls_set_transport(conn, &transport) != 1) {
+		error_print();
+		return -1;
+	}
+	conn->quic = quic;
+	return 1;
+}
+
+void tls_quic_cleanup(TLS_QUIC *quic)
+{
+	int level;
+
+	if (!quic) {
+		return;
+	}
+	if (quic->conn && quic->conn->quic == quic) {
+		quic->conn->quic = NULL;
+	}
+	for (level = 0; level < TLS_QUIC_LEVELS; level++) {
+		if (quic->in[level]) {
+			gmssl_secure_clear(quic->in[level], TLS_QUIC_MAX_DATA_SIZE);
+			free(quic->in[level]);
+		}
+		if (quic->out[level]) {
+			gmssl_secure_clear(quic->out[level], TLS_QUIC_MAX_DATA_SIZE);
+			free(quic->out[level]);
+		}
+	}
+	if (quic->record) {
+		gmssl_secure_clear(quic->record, TLS_MAX_RECORD_SIZE);
+		free(quic->record);
+	}
+	gmssl_secure_clear(quic, sizeof(TLS_QUIC));
+}
+
+int tls_quic_provide_data(TLS_QUIC *quic, int level, const uint8_t *data, size_t datalen)
+{
+	if (!quic || (!data && datalen)) {
+		error_print();
+		return -1;
+	}
+	if (level < 0 || level >= TLS_QUIC_LEVELS) {
+		error_print();
+		return -1;
+	}
+	if (tls_quic_buffer_append(&quic->in[level], &quic->inlen[level], data, datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_quic_record_send(TLS_QUIC *quic, const uint8_t *record, size_t recordlen)
+{
+	TLS_CONNECT *conn = quic->conn;
+	uint8_t *plain_record = NULL;
+	const uint8_t *data;
+	size_t datalen;
+	int type;
+	int level;
+	int ret = -1;
+
+	tls_quic_update_secrets(quic);
+
+	if (tls_record_type(record) == TLS_record_application_data) {
+		const BLOCK_CIPHER_KEY *key = conn->is_client ? &conn->client_write_key : &conn->server_write_key;
+		const uint8_t *iv = conn->is_client ? conn->client_write_iv : conn->server_write_iv;
+		const uint8_t *seq_num = conn->is_client ? conn->client_seq_num : conn->server_seq_num;
+
+		if (!(plain_record = tls_buffer_get())) {
+			error_print();
+			return -1;
+		}
+		if (tls13_record_decrypt(key, iv, seq_num, record, recordlen, plain_record, &datalen) != 1) {
+			error_print();
+			goto end;
+		}
+		type = plain_record[0];
+		data = plain_record + TLS_RECORD_HEADER_SIZE;
+		datalen -= TLS_RECORD_HEADER_SIZE;
+		level = quic->write_level;
+	} else {
+		type = tls_record_type(record);
+		data = record + TLS_RECORD_HEADER_SIZE;
+		datalen = recordlen - TLS_RECORD_HEADER_SIZE;
+		level = TLS_QUIC_initial;
+	}
+
+	switch (type) {
+	case TLS_record_handshake:
+		if (tls_quic_buffer_append(&quic->out[level], &quic->outlen[level], data, datalen) != 1) {
+			error_print();
+			goto end;
+		}
+		// the messages after our Finished are sent with the application keys
+		if (level == TLS_QUIC_handshake) {
+			while (datalen >= TLS_HANDSHAKE_HEADER_SIZE) {
+				size_t msglen = TLS_HANDSHAKE_HEADER_SIZE
+					+ (((size_t)data[1] << 16) | ((size_t)data[2] << 8) | data[3]);
+				if (data[0] == TLS_handshake_finished) {
+					quic->write_level = TLS_QUIC_application;
+				}
+				if (msglen > datalen) {
+					break;
+				}
+				data += msglen;
+				datalen -= msglen;
+			}
+		}
+		break;
+	case TLS_record_alert:
+		if (datalen != 2) {
+			error_print();
+			goto end;
+		}
+		quic->alert = data[1];
+		break;
+	default:
+		// QUIC carries the application data in its own frames
+		error_print();
+		goto end;
+	}
+	ret = 1;
+
+end:
+	if (plain_record) {
+		gmssl_secure_clear(plain_record, TLS_MAX_RECORD_SIZE);
+		tls_buffer_put(plain_record);
+	}
+	return ret;
+}
+
+int tls_quic_do_handshake(TLS_QUIC *quic)
+{
+	int ret;
+
+	if (!quic || !quic->conn || quic->conn->quic != quic) {
+		error_print();
+		return -1;
+	}
+	ret = tls_do_handshake(quic->conn);
+	tls_quic_update_secrets(quic);
+
+	// the packet protection is SM4-GCM with SM3 keys
+	if (ret == 1 && quic->conn->cipher_suite != TLS_cipher_sm4_gcm_sm3) {
+		error_print();
+		return -1;
+	}
+	return ret;
+}
+
+int tls_quic_process_post_handshake(TLS_QUIC *quic)
+{
+	uint8_t buf[1];
+	size_t len;
+
+	if (!quic || !quic->conn || quic->conn->quic != quic) {
+		error_print();
+		return -1;
+	}
+	// no application data comes in records, it returns once the messages given are processed
+	if (tls13_recv(quic->conn, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_quic_get_data(TLS_QUIC *quic, int level, uint8_t *out, size_t outlen, size_t *len)
+{
+	if (!quic || !out || !len) {
+		error_print();
+		return -1;
+	}
+	if (level < 0 || level >= TLS_QUIC_LEVELS) {
+		error_print();
+		return -1;
+	}
+	*len = quic->outlen[level] < outlen ? quic->outlen[level] : outlen;
+	if (*len) {
+		memcpy(out, quic->out[level], *len);
+		quic->outlen[level] -= *len;
+		memmove(quic->out[level], quic->out[level] + *len, quic->outlen[level]);
+	}
+	return 1;
+}
+
+int tls_quic_get_secret(const TLS_QUIC *quic, int level, int is_write, uint8_t secret[32])
+{
+	if (!quic || !secret) {
+		error_print();
+		return -1;
+	}
+	// the initial keys come from the QUIC version and the connection ID
+	if (level <= TLS_QUIC_initial || level >= TLS_QUIC_LEVELS) {
+		error_print();
+		return -1;
+	}
+	is_write = is_write ? 1 : 0;
+	if (!quic->secrets_set[level][is_write]) {
+		return 0;
+	}
+	memcpy(secret, quic->secrets[level][is_write], 32);
+	return 1;
+}
+
+int tls_quic_get_alert(const TLS_QUIC *quic)
+{
+	return quic->alert;
+}
+
+/*
+ * Packet protection
+ *
+ * key = HKDF-Expand-Label(secret, "quic key", "", 16)
+ * iv  = HKDF-Expand-Label(secret, "quic iv", "", 12)
+ * hp  = HKDF-Expand-Label(secret, "quic hp", "", 16)
+ * nonce = iv xor packet_number
+ * mask = SM4(hp, sample), sample = the 16 bytes 4 bytes after the packet number offset
+ */
+int tls_quic_key_init(TLS_QUIC_KEY *key, const uint8_t secret[32])
+{
+	uint8_t buf[16];
+
+	if (!key || !secret) {
+		error_print();
+		return -1;
+	}
+	if (tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic key", NULL, 0, 16, buf) != 1
+		|| tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic iv", NULL, 0, 12, key->iv) != 1) {
+		gmssl_secure_clear(buf, sizeof(buf));
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&key->key, buf);
+	if (tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic hp", NULL, 0, 16, buf) != 1) {
+		gmssl_secure_clear(buf, sizeof(buf));
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&key->hp_key, buf);
+	gmssl_secure_clear(buf, sizeof(buf));
+	return 1;
+}
+
+int tls_quic_key_update(TLS_QUIC_KEY *key, uint8_t secret[32])
+{
+	uint8_t buf[16];
+
+	if (!key || !secret) {
+		error_print();
+		return -1;
+	}
+	if (tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic ku", NULL, 0, 32, secret) != 1
+		|| tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic key", NULL, 0, 16, buf) != 1
+		|| tls13_hkdf_expand_label(DIGEST_sm3(), secret, "quic iv", NULL, 0, 12, key->iv) != 1) {
+		gmssl_secure_clear(buf, sizeof(buf));
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&key->key, buf);
+	gmssl_secure_clear(buf, sizeof(buf));
+	return 1;
+}
+
+void tls_quic_key_cleanup(TLS_QUIC_KEY *key)
+{
+	if (key) {
+		gmssl_secure_clear(key, sizeof(TLS_QUIC_KEY));
+	}
+}
+
+static void tls_quic_nonce(const TLS_QUIC_KEY *key, uint64_t pn, uint8_t nonce[12])
+{
+	int i;
+
+	memcpy(nonce, key->iv, 12);
+	for (i = 0; i < 8; i++) {
+		nonce[11 - i] ^= (uint8_t)(pn >> (8 * i));
+	}
+}
+
+static void tls_quic_header_mask(uint8_t *packet, size_t pn_offset, size_t pn_len, const uint8_t mask[16])
+{
+	size_t i;
+
+	packet[0] ^= mask[0] & ((packet[0] & 0x80) ? 0x0f : 0x1f);
+	for (i = 0; i < pn_len; i++) {
+		packet[pn_offset + i] ^= mask[1 + i];
+	}
+}
+
+// seal the payload, return the offset of the sample
+static int tls_quic_packet_encrypt(const TLS_QUIC_KEY *key, TLS_QUIC_PACKET *p, size_t *sample_offset)
+{
+	uint8_t nonce[12];
+	uint8_t *payload;
+
+	if (!p->packet || p->pn_len < 1 || p->pn_len > TLS_QUIC_MAX_PN_SIZE
+		|| p->header_len < 1 + p->pn_len
+		|| (size_t)(p->packet[0] & 0x03) + 1 != p->pn_len) {
+		error_print();
+		return -1;
+	}
+	if (p->pn_len + p->payload_len < TLS_QUIC_MAX_PN_SIZE) {
+		error_print();
+		return -1;
+	}
+	payload = p->packet + p->header_len;
+	tls_quic_nonce(key, p->pn, nonce);
+	if (sm4_gcm_encrypt(&key->key, nonce, sizeof(nonce), p->packet, p->header_len,
+		payload, p->payload_len, payload, TLS_QUIC_TAG_SIZE, payload + p->payload_len) != 1) {
+		error_print();
+		return -1;
+	}
+	*sample_offset = p->header_len - p->pn_len + TLS_QUIC_MAX_PN_SIZE;
+	return 1;
+}
+
+int tls_quic_packet_seal(const TLS_QUIC_KEY *key, TLS_QUIC_PACKET *packet)
+{
+	size_t sample_offset;
+	uint8_t mask[16];
+
+	if (!key || !packet) {
+		error_print();
+		return -1;
+	}
+	if (tls_quic_packet_encrypt(key, packet, &sample_offset) != 1) {
+		error_print();
+		return -1;
+	}
+	sm4_encrypt(&key->hp_key, packet->packet + sample_offset, mask);
+	tls_quic_header_mask(packet->packet, packet->header_len - packet->pn_len, packet->pn_len, mask);
+	return 1;
+}
+
+#define TLS_QUIC_SEAL_BATCH	64
+
+int tls_quic_packets_seal(const TLS_QUIC_KEY *key, TLS_QUIC_PACKET *packets, size_t packets_cnt)
+{
+	uint8_t samples[TLS_QUIC_SEAL_BATCH * 16];
+	uint8_t masks[TLS_QUIC_SEAL_BATCH * 16];
+	size_t sample_offset;
+	size_t n, i, j;
+
+	if (!key || (!packets && packets_cnt)) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < packets_cnt; i += n) {
+		n = packets_cnt - i < TLS_QUIC_SEAL_BATCH ? packets_cnt - i : TLS_QUIC_SEAL_BATCH;
+		for (j = 0; j < n; j++) {
+			if (tls_quic_packet_encrypt(key, &packets[i + j], &sample_offset) != 1) {
+				error_print();
+				return -1;
+			}
+			memcpy(samples + 16 * j, packets[i + j].packet + sample_offset, 16);
+		}
+		sm4_encrypt_blocks(&key->hp_key, samples, n, masks);
+		for (j = 0; j < n; j++) {
+			TLS_QUIC_PACKET *p = &packets[i + j];
+			tls_quic_header_mask(p->packet, p->header_len - p->pn_len, p->pn_len, masks + 16 * j);
+		}
+	}
+	return 1;
+}
+
+// RFC 9000 Appendix A.3
+static uint64_t tls_quic_decode_pn(int64_t largest_pn, uint64_t truncated_pn, size_t pn_len)
+{
+	uint64_t expected = (uint64_t)(largest_pn + 1);
+	uint64_t win = (uint64_t)1 << (8 * pn_len);
+	uint64_t hwin = win / 2;
+	uint64_t candidate = (expected & ~(win - 1)) | truncated_pn;
+
+	if (candidate + hwin <= expected && candidate < ((uint64_t)1 << 62) - win) {
+		return candidate + win;
+	}
+	if (candidate > expected + hwin && candidate >= win) {
+		return candidate - win;
+	}
+	return candidate;
+}
+
+int tls_quic_packet_open(const TLS_QUIC_KEY *key, uint8_t *packet, size_t packetlen, size_t pn_offset,
+	int64_t largest_pn, uint64_t *pn, uint8_t **payload, size_t *payload_len)
+{
+	uint8_t mask[16];
+	uint8_t nonce[12];
+	uint64_t truncated_pn = 0;
+	size_t pn_len;
+	size_t header_len;
+	size_t i;
+
+	if (!key || !packet || !pn || !payload || !payload_len) {
+		error_print();
+		return -1;
+	}
+	if (pn_offset < 1 || pn_offset > packetlen
+		|| packetlen - pn_offset < TLS_QUIC_MAX_PN_SIZE + TLS_QUIC_SAMPLE_SIZE) {
+		return 0;
+	}
+	sm4_encrypt(&key->hp_key, packet + pn_offset + TLS_QUIC_MAX_PN_SIZE, mask);
+	packet[0] ^= mask[0] & ((packet[0] & 0x80) ? 0x0f : 0x1f);
+	pn_len = (packet[0] & 0x03) + 1;
+	for (i = 0; i < pn_len; i++) {
+		packet[pn_offset + i] ^= mask[1 + i];
+		truncated_pn = (truncated_pn << 8) | packet[pn_offset + i];
+	}
+	header_len = pn_offset + pn_len;
+	if (packetlen - header_len < TLS_QUIC_TAG_SIZE) {
+		return 0;
+	}
+	*pn = tls_quic_decode_pn(largest_pn, truncated_pn, pn_len);
+	*payload = packet + header_len;
+	*payload_len = packetlen - header_len - TLS_QUIC_TAG_SIZE;
+
+	tls_quic_nonce(key, *pn, nonce);
+	if (sm4_gcm_decrypt(&key->key, nonce, sizeof(nonce), packet, header_len,
+		*payload, *payload_len, *payload + *payload_len, TLS_QUIC_TAG_SIZE, *payload) != 1) {
+		return 0;
+	}
+	return 1;
+}
@@ -0,0 +1,178 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/sm3.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+// about 1% false positives with 10 bits and 7 hashes per entry
+#define REPLAY_FILTER_BITS_PER_ENTRY	10
+#define REPLAY_FILTER_HASHES		7
+#define TLS_REPLAY_CACHE_MAX_ENTRIES	(1 << 24)
+
+struct TLS_REPLAY_CACHE_st {
+	cache_mutex_t mutex;
+	uint8_t *filters[2]; // current, previous
+	size_t filter_size; // bytes
+	size_t bits_mask;
+	size_t max_entries;
+	size_t count; // entries of the current filter
+	time_t rotated; // when the current filter was started
+	time_t refused_until; // set when the clock went back
+};
+
+TLS_REPLAY_CACHE *tls_replay_cache_new(size_t max_entries)
+{
+	TLS_REPLAY_CACHE *cache;
+	size_t nbits = 64;
+
+	if (!max_entries || max_entries > TLS_REPLAY_CACHE_MAX_ENTRIES) {
+		error_print();
+		return NULL;
+	}
+	while (nbits < max_entries * REPLAY_FILTER_BITS_PER_ENTRY) {
+		nbits <<= 1;
+	}
+	if (!(cache = (TLS_REPLAY_CACHE *)calloc(1, sizeof(*cache)))) {
+		error_print();
+		return NULL;
+	}
+	cache->filter_size = nbits / 8;
+	if (!(cache->filters[0] = (uint8_t *)calloc(1, cache->filter_size))
+		|| !(cache->filters[1] = (uint8_t *)calloc(1, cache->filter_size))) {
+		free(cache->filters[0]);
+		free(cache);
+		error_print();
+		return NULL;
+	}
+	cache->bits_mask = nbits - 1;
+	cache->max_entries = max_entries;
+	cache->rotated = time(NULL);
+	cache_mutex_init(&cache->mutex);
+	return cache;
+}
+
+void tls_replay_cache_free(TLS_REPLAY_CACHE *cache)
+{
+	if (!cache) {
+		return;
+	}
+	cache_mutex_destroy(&cache->mutex);
+	free(cache->filters[0]);
+	free(cache->filters[1]);
+	free(cache);
+}
+
+static int replay_filter_test(const TLS_REPLAY_CACHE *cache, const uint8_t *filter, const size_t bits[REPLAY_FILTER_HASHES])
+{
+	int i;
+
+	for (i = 0; i < REPLAY_FILTER_HASHES; i++) {
+		if (!(filter[bits[i] >> 3] & (1 << (bits[i] & 7)))) {
+			return 0;
+		}
+	}
+	return 1;
+}
+
+// return 0 if 0-RTT is refused
+static int replay_cache_rotate(TLS_REPLAY_CACHE *cache, time_t now)
+{
+	uint8_t *filter;
+
+	if (now < cache->rotated) {
+		// the clock went back, the filters are kept and nothing is taken for a window
+		cache->rotated = now;
+		cache->refused_until = now + TLS13_EARLY_DATA_REPLAY_WINDOW;
+	}
+	if (now < cache->refused_until) {
+		return 0;
+	}
+	if (now - cache->rotated < TLS13_EARLY_DATA_REPLAY_WINDOW) {
+		return 1;
+	}
+	if (now - cache->rotated < 2 * TLS13_EARLY_DATA_REPLAY_WINDOW) {
+		filter = cache->filters[1];
+		cache->filters[1] = cache->filters[0];
+		cache->filters[0] = filter;
+	} else {
+		// idle for two windows
+		memset(cache->filters[1], 0, cache->filter_size);
+	}
+	memset(cache->filters[0], 0, cache->filter_size);
+	cache->count = 0;
+	cache->rotated = now;
+	return 1;
+}
+
+int tls_replay_cache_add(TLS_REPLAY_CACHE *cache, const uint8_t *id, size_t idlen)
+{
+	return tls_replay_cache_add_at(cache, id, idlen, time(NULL));
+}
+
+int tls_replay_cache_add_at(TLS_REPLAY_CACHE *cache, const uint8_t *id, size_t idlen, time_t now)
+{
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	size_t bits[REPLAY_FILTER_HASHES];
+	int ret = 1;
+	int i;
+
+	if (!cache || !id || !idlen) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, id, idlen);
+	sm3_finish(&sm3_ctx, dgst);
+	for (i = 0; i < REPLAY_FILTER_HASHES; i++) {
+		bits[i] = (((size_t)dgst[4*i] << 24) | ((size_t)dgst[4*i + 1] << 16)
+			| ((size_t)dgst[4*i + 2] << 8) | dgst[4*i + 3]) & cache->bits_mask;
+	}
+
+	cache_mutex_lock(&cache->mutex);
+	if (replay_cache_rotate(cache, now) != 1) {
+		ret = 0;
+	} else if (replay_filter_test(cache, cache->filters[0], bits)
+		|| replay_filter_test(cache, cache->filters[1], bits)) {
+		ret = 0;
+	} else if (cache->count >= cache->max_entries) {
+		// a full filter can not tell new from seen
+		ret = 0;
+	} else {
+		for (i = 0; i < REPLAY_FILTER_HASHES; i++) {
+			cache->filters[0][bits[i] >> 3] |= (uint8_t)(1 << (bits[i] & 7));
+		}
+		cache->count++;
+	}
+	cache_mutex_unlock(&cache->mutex);
+	return ret;
+}
@@ -0,0 +1,517 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#define _GNU_SOURCE
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <unistd.h>
+#include <sched.h>
+#include <pthread.h>
+#include <sys/epoll.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <gmssl/mem.h>
+#include <gmssl/numa.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+#define SERVER_MAX_EVENTS	64
+
+// the counters of a worker are only changed by its loop, and read by tls_server_get_stats()
+#define server_stat_add(p,v)	__atomic_fetch_add((p), (v), __ATOMIC_RELAXED)
+#define server_stat_sub(p,v)	__atomic_fetch_sub((p), (v), __ATOMIC_RELAXED)
+#define server_stat_load(p)	__atomic_load_n((p), __ATOMIC_RELAXED)
+
+typedef struct SERVER_CONN_st {
+	TLS_CONNECT conn;
+	int established;
+	size_t outlen;
+	size_t outsent;
+	struct SERVER_CONN_st *prev;
+	struct SERVER_CONN_st *next;
+	uint8_t in[TLS_MAX_PLAINTEXT_SIZE];
+	uint8_t out[TLS_MAX_PLAINTEXT_SIZE];
+} SERVER_CONN;
+
+typedef struct {
+	TLS_SERVER *server;
+	pthread_t thread;
+	int started;
+	int cpu;
+	int listen_sock;
+	int epfd;
+	SERVER_CONN *conns;
+	TLS_SERVER_STATS stats;
+} SERVER_WORKER;
+
+struct TLS_SERVER_st {
+	const TLS_CTX *ctx;
+	TLS_CTX_SLOT *ctx_slot; // not owned, replaces `ctx` if set
+	TLS_SERVER_HANDLER handler;
+	void *handler_arg;
+	int port;
+	int stop_pipe[2];
+	int running;
+	size_t workers_cnt;
+	SERVER_WORKER *workers;
+};
+
+// data.ptr of the epoll events, connections use their SERVER_CONN
+#define EVENT_LISTEN	NULL
+#define EVENT_STOP(server)	((void *)(server))
+
+
+static int server_listen(int *sock, int *port)
+{
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	int on = 1;
+
+	if ((*sock = socket(AF_INET, SOCK_STREAM | SOCK_NONBLOCK, 0)) < 0) {
+		perror("socket");
+		error_print();
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons(*port);
+
+	// every worker binds the same port, the kernel spreads the connections
+	if (setsockopt(*sock, SOL_SOCKET, SO_REUSEADDR, &on, sizeof(on)) != 0
+		|| setsockopt(*sock, SOL_SOCKET, SO_REUSEPORT, &on, sizeof(on)) != 0
+		|| bind(*sock, (struct sockaddr *)&addr, sizeof(addr)) != 0
+		|| listen(*sock, SOMAXCONN) != 0
+		|| getsockname(*sock, (struct sockaddr *)&addr, &addrlen) != 0) {
+		perror("listen");
+		close(*sock);
+		*sock = -1;
+		error_print();
+		return -1;
+	}
+	*port = ntohs(addr.sin_port);
+	return 1;
+}
+
+static void server_conn_close(SERVER_WORKER *worker, SERVER_CONN *c)
+{
+	epoll_ctl(worker->epfd, EPOLL_CTL_DEL, c->conn.sock, NULL);
+	close(c->conn.sock);
+	tls_cleanup(&c->conn);
+
+	if (c->prev) c->prev->next = c->next;
+	else worker->conns = c->next;
+	if (c->next) c->next->prev = c->prev;
+	free(c);
+	server_stat_sub(&worker->stats.connections_active, 1);
+}
+
+// run the connection until it would block, return 0 when it is closed
+static int server_conn_drive(SERVER_WORKER *worker, SERVER_CONN *c)
+{
+	const TLS_SERVER *server = worker->server;
+	TLS_CONNECT *conn = &c->conn;
+	int tls13 = conn->protocol == TLS_protocol_tls13;
+	size_t len;
+	int ret;
+
+	if (!c->established) {
+		if ((ret = tls_do_handshake(conn)) != 1) {
+			if (ret == TLS_ERROR_WANT_READ || ret == TLS_ERROR_WANT_WRITE) {
+				return 1;
+			}
+			server_stat_add(&worker->stats.errors, 1);
+			return 0;
+		}
+		c->established = 1;
+		server_stat_add(&worker->stats.handshakes, 1);
+	}
+
+	for (;;) {
+		while (c->outsent < c->outlen) {
+			ret = tls13 ? tls13_send(conn, c->out + c->outsent, c->outlen - c->outsent, &len)
+				: tls_send(conn, c->out + c->outsent, c->outlen - c->outsent, &len);
+			if (ret == TLS_ERROR_WANT_WRITE) {
+				return 1;
+			} else if (ret != 1) {
+				server_stat_add(&worker->stats.errors, 1);
+				return 0;
+			}
+			c->outsent += len;
+			server_stat_add(&worker->stats.records_sent, 1);
+			server_stat_add(&worker->stats.bytes_sent, len);
+		}
+
+		ret = tls13 ? tls13_recv(conn, c->in, sizeof(c->in), &len)
+			: tls_recv(conn, c->in, sizeof(c->in), &len);
+		if (ret == TLS_ERROR_WANT_READ || ret == TLS_ERROR_WANT_WRITE) {
+			return 1;
+		} else if (ret == 0) {
+			return 0;
+		} else if (ret != 1) {
+			server_stat_add(&worker->stats.errors, 1);
+			return 0;
+		}
+		if (!len) {
+			continue;
+		}
+		server_stat_add(&worker->stats.records_received, 1);
+		server_stat_add(&worker->stats.bytes_received, len);
+
+		c->outsent = 0;
+		if (server->handler) {
+			c->outlen = sizeof(c->out);
+			if ((ret = server->handler(server->handler_arg, c->in, len, c->out, &c->outlen)) != 1) {
+				if (ret < 0) server_stat_add(&worker->stats.errors, 1);
+				return 0;
+			}
+			if (c->outlen > sizeof(c->out)) {
+				error_print();
+				server_stat_add(&worker->stats.errors, 1);
+				return 0;
+			}
+		} else {
+			memcpy(c->out, c->in, len);
+			c->outlen = len;
+		}
+	}
+}
+
+static void server_accept(SERVER_WORKER *worker)
+{
+	struct epoll_event event;
+	SERVER_CONN *c;
+	TLS_CTX *slot_ctx;
+	int sock;
+	int on = 1;
+	int rv;
+
+	while ((sock = accept4(worker->listen_sock, NULL, NULL, SOCK_NONBLOCK)) >= 0) {
+		setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+
+		if (!(c = (SERVER_CONN *)malloc(sizeof(SERVER_CONN)))) {
+			error_print();
+			close(sock);
+			server_stat_add(&worker->stats.errors, 1);
+			continue;
+		}
+		// the connection keeps its own reference of the current context
+		if (worker->server->ctx_slot) {
+			slot_ctx = tls_ctx_slot_get(worker->server->ctx_slot);
+			rv = slot_ctx ? tls_init(&c->conn, slot_ctx) : -1;
+			tls_ctx_free(slot_ctx);
+		} else {
+			rv = tls_init(&c->conn, worker->server->ctx);
+		}
+		if (rv != 1
+			|| tls_set_socket(&c->conn, sock) != 1) {
+			error_print();
+			tls_cleanup(&c->conn);
+			free(c);
+			close(sock);
+			server_stat_add(&worker->stats.errors, 1);
+			continue;
+		}
+		c->conn.quiet = 1;
+		c->established = 0;
+		c->outlen = c->outsent = 0;
+
+		// edge-triggered, server_conn_drive() always runs until EAGAIN
+		event.events = EPOLLIN | EPOLLOUT | EPOLLRDHUP | EPOLLET;
+		event.data.ptr = c;
+		if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD, sock, &event) != 0) {
+			perror("epoll_ctl");
+			tls_cleanup(&c->conn);
+			free(c);
+			close(sock);
+			server_stat_add(&worker->stats.errors, 1);
+			continue;
+		}
+		c->prev = NULL;
+		c->next = worker->conns;
+		if (worker->conns) worker->conns->prev = c;
+		worker->conns = c;
+		server_stat_add(&worker->stats.connections, 1);
+		server_stat_add(&worker->stats.connections_active, 1);
+
+		if (server_conn_drive(worker, c) != 1) {
+			server_conn_close(worker, c);
+		}
+	}
+	if (errno != EAGAIN && errno != EWOULDBLOCK && errno != EINTR && errno != ECONNABORTED) {
+		perror("accept4");
+		server_stat_add(&worker->stats.errors, 1);
+	}
+}
+
+static void *server_worker_loop(void *arg)
+{
+	SERVER_WORKER *worker = (SERVER_WORKER *)arg;
+	struct epoll_event events[SERVER_MAX_EVENTS];
+	cpu_set_t cpus;
+	int n, i;
+
+	// one event loop per core, ignored where affinity is not allowed
+	CPU_ZERO(&cpus);
+	CPU_SET(worker->cpu, &cpus);
+	pthread_setaffinity_np(pthread_self(), sizeof(cpus), &cpus);
+	// generator tables are read from a copy on the node of the core
+	gmssl_numa_set_thread_node(gmssl_numa_node_of_cpu(worker->cpu));
+
+	for (;;) {
+		if ((n = epoll_wait(worker->epfd, events, SERVER_MAX_EVENTS, -1)) < 0) {
+			if (errno == EINTR) {
+				continue;
+			}
+			perror("epoll_wait");
+			error_print();
+			break;
+		}
+		for (i = 0; i < n; i++) {
+			void *ptr = events[i].data.ptr;
+
+			if (ptr == EVENT_STOP(worker->server)) {
+				goto end;
+			} else if (ptr == EVENT_LISTEN) {
+				server_accept(worker);
+			} else if (server_conn_drive(worker, (SERVER_CONN *)ptr) != 1) {
+				server_conn_close(worker, (SERVER_CONN *)ptr);
+			}
+		}
+	}
+end:
+	while (worker->conns) {
+		server_conn_close(worker, worker->conns);
+	}
+	return NULL;
+}
+
+TLS_SERVER *tls_server_new(const TLS_CTX *ctx, int port, size_t threads)
+{
+	TLS_SERVER *server;
+	struct epoll_event event;
+	long ncpus;
+	size_t i;
+
+	if (!ctx || port < 0 || port > 65535) {
+		error_print();
+		return NULL;
+	}
+	if (ctx->is_client) {
+		error_print();
+		return NULL;
+	}
+	// tls12_do_accept() has no resumable states
+	if (ctx->protocol != TLS_protocol_tlcp && ctx->protocol != TLS_protocol_tls13) {
+		error_puts("tls_server needs a non-blocking handshake, only TLCP and TLS 1.3 have one");
+		return NULL;
+	}
+	if ((ncpus = sysconf(_SC_NPROCESSORS_ONLN)) < 1) {
+		ncpus = 1;
+	}
+	if (!threads) {
+		threads = (size_t)ncpus;
+	}
+
+	if (!(server = (TLS_SERVER *)calloc(1, sizeof(TLS_SERVER)))
+		|| !(server->workers = (SERVER_WORKER *)calloc(threads, sizeof(SERVER_WORKER)))) {
+		free(server);
+		error_print();
+		return NULL;
+	}
+	server->ctx = ctx;
+	server->port = port;
+	server->stop_pipe[0] = server->stop_pipe[1] = -1;
+	server->workers_cnt = threads;
+	for (i = 0; i < threads; i++) {
+		server->workers[i].server = server;
+		server->workers[i].cpu = (int)(i % (size_t)ncpus);
+		server->workers[i].listen_sock = -1;
+		server->workers[i].epfd = -1;
+	}
+
+	if (pipe(server->stop_pipe) != 0) {
+		perror("pipe");
+		goto err;
+	}
+	for (i = 0; i < threads; i++) {
+		SERVER_WORKER *worker = &server->workers[i];
+
+		// with port 0 the first worker picks the port for the others
+		if (server_listen(&worker->listen_sock, &server->port) != 1
+			|| (worker->epfd = epoll_create1(0)) < 0) {
+			goto err;
+		}
+		event.events = EPOLLIN;
+		event.data.ptr = EVENT_LISTEN;
+		if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD, worker->listen_sock, &event) != 0) {
+			perror("epoll_ctl");
+			goto err;
+		}
+		// never read, a single byte wakes every loop
+		event.events = EPOLLIN;
+		event.data.ptr = EVENT_STOP(server);
+		if (epoll_ctl(worker->epfd, EPOLL_CTL_ADD, server->stop_pipe[0], &event) != 0) {
+			perror("epoll_ctl");
+			goto err;
+		}
+	}
+	return server;
+
+err:
+	error_print();
+	tls_server_free(server);
+	return NULL;
+}
+
+int tls_server_set_handler(TLS_SERVER *server, TLS_SERVER_HANDLER handler, void *arg)
+{
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	if (server->running) {
+		error_puts("tls_server_set_handler() called after tls_server_start()");
+		return -1;
+	}
+	server->handler = handler;
+	server->handler_arg = arg;
+	return 1;
+}
+
+int tls_server_set_ctx_slot(TLS_SERVER *server, TLS_CTX_SLOT *slot)
+{
+	TLS_CTX *ctx;
+	int ret = 1;
+
+	if (!server || !slot) {
+		error_print();
+		return -1;
+	}
+	if (server->running) {
+		error_puts("tls_server_set_ctx_slot() called after tls_server_start()");
+		return -1;
+	}
+	if (!(ctx = tls_ctx_slot_get(slot))) {
+		error_print();
+		return -1;
+	}
+	if (ctx->protocol != server->ctx->protocol || ctx->is_client) {
+		error_puts("the TLS_CTX_SLOT has another protocol than the server");
+		ret = -1;
+	} else {
+		server->ctx_slot = slot;
+	}
+	tls_ctx_free(ctx);
+	return ret;
+}
+
+int tls_server_get_port(const TLS_SERVER *server)
+{
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	return server->port;
+}
+
+int tls_server_start(TLS_SERVER *server)
+{
+	size_t i;
+
+	if (!server || server->running) {
+		error_print();
+		return -1;
+	}
+	server->running = 1;
+	for (i = 0; i < server->workers_cnt; i++) {
+		SERVER_WORKER *worker = &server->workers[i];
+		if (pthread_create(&worker->thread, NULL, server_worker_loop, worker) != 0) {
+			error_print();
+			tls_server_stop(server);
+			return -1;
+		}
+		worker->started = 1;
+	}
+	return 1;
+}
+
+int tls_server_stop(TLS_SERVER *server)
+{
+	size_t i;
+
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	if (!server->running) {
+		return 1;
+	}
+	if (write(server->stop_pipe[1], "", 1) != 1) {
+		perror("write");
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < server->workers_cnt; i++) {
+		SERVER_WORKER *worker = &server->workers[i];
+		if (worker->started) {
+			pthread_join(worker->thread, NULL);
+			worker->started = 0;
+		}
+	}
+	server->running = 0;
+	return 1;
+}
+
+// counters of running loops are read one by one, the sums are approximate
+int tls_server_get_stats(const TLS_SERVER *server, TLS_SERVER_STATS *stats)
+{
+	size_t i;
+
+	if (!server || !stats) {
+		error_print();
+		return -1;
+	}
+	memset(stats, 0, sizeof(*stats));
+	for (i = 0; i < server->workers_cnt; i++) {
+		const TLS_SERVER_STATS *s = &server->workers[i].stats;
+		stats->connections += server_stat_load(&s->connections);
+		stats->connections_active += server_stat_load(&s->connections_active);
+		stats->handshakes += server_stat_load(&s->handshakes);
+		stats->records_received += server_stat_load(&s->records_received);
+		stats->records_sent += server_stat_load(&s->records_sent);
+		stats->bytes_received += server_stat_load(&s->bytes_received);
+		stats->bytes_sent += server_stat_load(&s->bytes_sent);
+		stats->errors += server_stat_load(&s->errors);
+	}
+	return 1;
+}
+
+void tls_server_free(TLS_SERVER *server)
+{
+	size_t i;
+
+	if (!server) {
+		return;
+	}
+	tls_server_stop(server);
+	for (i = 0; i < server->workers_cnt; i++) {
+		if (server->workers[i].epfd >= 0) close(server->workers[i].epfd);
+		if (server->workers[i].listen_sock >= 0) close(server->workers[i].listen_sock);
+	}
+	if (server->stop_pipe[0] >= 0) close(server->stop_pipe[0]);
+	if (server->stop_pipe[1] >= 0) close(server->stop_pipe[1]);
+	free(server->workers);
+	free(server);
+}
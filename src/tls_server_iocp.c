@@ -0,0 +1,776 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * TLS server engine on an I/O completion port (Windows)
+ *
+ * The TLS_SERVER of tls_server.c with overlapped I/O in place of the epoll
+ * loops. Every connection has a TLS_TRANSPORT over two buffers: completed
+ * WSARecv() fill `rbuf`, which the records are read from, and the records
+ * written to `wbuf` are sent by WSASend(). The non-blocking state machine
+ * sees EAGAIN when `rbuf` is empty or `wbuf` is full, so it is driven again
+ * by the next completion. One completion port is shared by all the threads,
+ * a connection is handled by one thread at a time under its lock, and the
+ * listening socket always has SERVER_ACCEPTS_PER_THREAD AcceptEx() posted for
+ * every thread.
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <winsock2.h>
+#include <ws2tcpip.h>
+#include <mswsock.h>
+#include <windows.h>
+#include <process.h>
+#include <gmssl/mem.h>
+#include <gmssl/numa.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+#define SERVER_ACCEPTS_PER_THREAD	4
+#define SERVER_BUF_SIZE			8192
+#define SERVER_ADDR_SIZE		(sizeof(struct sockaddr_in) + 16)
+
+enum {
+	SERVER_IO_accept,
+	SERVER_IO_recv,
+	SERVER_IO_send,
+};
+
+typedef struct {
+	OVERLAPPED overlapped;
+	int op;
+} SERVER_IO;
+
+typedef struct SERVER_CONN_st {
+	TLS_CONNECT conn;
+	SOCKET sock; // INVALID_SOCKET once closed, the pending I/O is then aborted
+	CRITICAL_SECTION lock;
+	int established;
+	int closing; // close after `wbuf` is sent
+	int eof;
+	int ios; // pending overlapped I/O
+	size_t outlen;
+	size_t outsent;
+	SERVER_IO recv_io;
+	SERVER_IO send_io;
+	int recv_pending;
+	int send_pending;
+	size_t rpos;
+	size_t rlen;
+	size_t wpos;
+	size_t wlen;
+	struct SERVER_CONN_st *prev;
+	struct SERVER_CONN_st *next;
+	uint8_t rbuf[SERVER_BUF_SIZE];
+	uint8_t wbuf[SERVER_BUF_SIZE];
+	uint8_t in[TLS_MAX_PLAINTEXT_SIZE];
+	uint8_t out[TLS_MAX_PLAINTEXT_SIZE];
+} SERVER_CONN;
+
+typedef struct {
+	SERVER_IO io;
+	SOCKET sock;
+	uint8_t addrs[SERVER_ADDR_SIZE * 2];
+} SERVER_ACCEPT;
+
+typedef struct {
+	TLS_SERVER *server;
+	HANDLE thread;
+	int cpu;
+	TLS_SERVER_STATS stats;
+} SERVER_WORKER;
+
+struct TLS_SERVER_st {
+	const TLS_CTX *ctx;
+	TLS_CTX_SLOT *ctx_slot; // not owned, replaces `ctx` if set
+	TLS_SERVER_HANDLER handler;
+	void *handler_arg;
+	int port;
+	int running;
+	volatile LONG stopping;
+	volatile LONG ios; // pending overlapped I/O, plus one while running
+	HANDLE iocp;
+	SOCKET listen_sock;
+	CRITICAL_SECTION lock; // of `conns`
+	SERVER_CONN *conns;
+	size_t accepts_cnt;
+	SERVER_ACCEPT *accepts;
+	size_t workers_cnt;
+	SERVER_WORKER *workers;
+};
+
+// completion keys, connections use their SERVER_CONN
+#define KEY_LISTEN	((ULONG_PTR)0)
+#define KEY_STOP	((ULONG_PTR)1)
+
+
+static tls_ret_t server_conn_transport_send(void *arg, const uint8_t *buf, size_t len)
+{
+	SERVER_CONN *c = (SERVER_CONN *)arg;
+	size_t n = sizeof(c->wbuf) - c->wlen;
+
+	if (!n) {
+		errno = EAGAIN;
+		return -1;
+	}
+	if (n > len) {
+		n = len;
+	}
+	// bytes in flight are never moved, new ones are appended after them
+	memcpy(c->wbuf + c->wlen, buf, n);
+	c->wlen += n;
+	return (tls_ret_t)n;
+}
+
+static tls_ret_t server_conn_transport_recv(void *arg, uint8_t *buf, size_t len)
+{
+	SERVER_CONN *c = (SERVER_CONN *)arg;
+	size_t n = c->rlen - c->rpos;
+
+	if (!n) {
+		if (c->eof) {
+			return 0;
+		}
+		errno = EAGAIN;
+		return -1;
+	}
+	if (n > len) {
+		n = len;
+	}
+	memcpy(buf, c->rbuf + c->rpos, n);
+	c->rpos += n;
+	return (tls_ret_t)n;
+}
+
+static int server_listen(SOCKET *sock, int *port)
+{
+	struct sockaddr_in addr;
+	int addrlen = sizeof(addr);
+	BOOL on = TRUE;
+
+	if ((*sock = WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED)) == INVALID_SOCKET) {
+		fprintf(stderr, "WSASocket: %d\n", WSAGetLastError());
+		error_print();
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_ANY);
+	addr.sin_port = htons((u_short)*port);
+
+	// one listening socket, the completions spread the connections
+	if (setsockopt(*sock, SOL_SOCKET, SO_EXCLUSIVEADDRUSE, (const char *)&on, sizeof(on)) != 0
+		|| bind(*sock, (struct sockaddr *)&addr, sizeof(addr)) != 0
+		|| listen(*sock, SOMAXCONN) != 0
+		|| getsockname(*sock, (struct sockaddr *)&addr, &addrlen) != 0) {
+		fprintf(stderr, "listen: %d\n", WSAGetLastError());
+		closesocket(*sock);
+		*sock = INVALID_SOCKET;
+		error_print();
+		return -1;
+	}
+	*port = ntohs(addr.sin_port);
+	return 1;
+}
+
+// drop the I/O of a completion, after the last one the running threads are stopped
+static void server_io_done(TLS_SERVER *server)
+{
+	size_t i;
+
+	if (InterlockedDecrement(&server->ios) == 0) {
+		for (i = 0; i < server->workers_cnt; i++) {
+			PostQueuedCompletionStatus(server->iocp, 0, KEY_STOP, NULL);
+		}
+	}
+}
+
+static int server_post_accept(TLS_SERVER *server, SERVER_ACCEPT *a)
+{
+	DWORD len;
+
+	if ((a->sock = WSASocketW(AF_INET, SOCK_STREAM, IPPROTO_TCP, NULL, 0, WSA_FLAG_OVERLAPPED)) == INVALID_SOCKET) {
+		error_print();
+		return -1;
+	}
+	memset(&a->io.overlapped, 0, sizeof(a->io.overlapped));
+	a->io.op = SERVER_IO_accept;
+	InterlockedIncrement(&server->ios);
+	if (!AcceptEx(server->listen_sock, a->sock, a->addrs, 0, SERVER_ADDR_SIZE, SERVER_ADDR_SIZE,
+		&len, &a->io.overlapped) && WSAGetLastError() != ERROR_IO_PENDING) {
+		InterlockedDecrement(&server->ios);
+		closesocket(a->sock);
+		a->sock = INVALID_SOCKET;
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// under c->lock, the counters of c->ios and server->ios are taken by the caller
+static int server_conn_post_recv(SERVER_CONN *c)
+{
+	WSABUF buf;
+	DWORD flags = 0;
+
+	buf.buf = (char *)c->rbuf;
+	buf.len = (ULONG)sizeof(c->rbuf);
+	memset(&c->recv_io.overlapped, 0, sizeof(c->recv_io.overlapped));
+	c->recv_io.op = SERVER_IO_recv;
+	if (WSARecv(c->sock, &buf, 1, NULL, &flags, &c->recv_io.overlapped, NULL) != 0
+		&& WSAGetLastError() != WSA_IO_PENDING) {
+		return -1;
+	}
+	c->rpos = c->rlen = 0;
+	c->recv_pending = 1;
+	return 1;
+}
+
+static int server_conn_post_send(SERVER_CONN *c)
+{
+	WSABUF buf;
+
+	buf.buf = (char *)c->wbuf + c->wpos;
+	buf.len = (ULONG)(c->wlen - c->wpos);
+	memset(&c->send_io.overlapped, 0, sizeof(c->send_io.overlapped));
+	c->send_io.op = SERVER_IO_send;
+	if (WSASend(c->sock, &buf, 1, NULL, 0, &c->send_io.overlapped, NULL) != 0
+		&& WSAGetLastError() != WSA_IO_PENDING) {
+		return -1;
+	}
+	c->send_pending = 1;
+	return 1;
+}
+
+// under c->lock, run the connection until it waits for I/O, return 0 when it is done
+static int server_conn_drive(SERVER_WORKER *worker, SERVER_CONN *c)
+{
+	const TLS_SERVER *server = worker->server;
+	TLS_CONNECT *conn = &c->conn;
+	int tls13 = conn->protocol == TLS_protocol_tls13;
+	size_t len;
+	int ret;
+
+	if (!c->established) {
+		if ((ret = tls_do_handshake(conn)) != 1) {
+			if (ret == TLS_ERROR_WANT_READ || ret == TLS_ERROR_WANT_WRITE) {
+				return 1;
+			}
+			worker->stats.errors++;
+			return 0;
+		}
+		c->established = 1;
+		worker->stats.handshakes++;
+	}
+
+	for (;;) {
+		while (c->outsent < c->outlen) {
+			ret = tls13 ? tls13_send(conn, c->out + c->outsent, c->outlen - c->outsent, &len)
+				: tls_send(conn, c->out + c->outsent, c->outlen - c->outsent, &len);
+			if (ret == TLS_ERROR_WANT_WRITE) {
+				return 1;
+			} else if (ret != 1) {
+				worker->stats.errors++;
+				return 0;
+			}
+			c->outsent += len;
+			worker->stats.records_sent++;
+			worker->stats.bytes_sent += len;
+		}
+
+		ret = tls13 ? tls13_recv(conn, c->in, sizeof(c->in), &len)
+			: tls_recv(conn, c->in, sizeof(c->in), &len);
+		if (ret == TLS_ERROR_WANT_READ || ret == TLS_ERROR_WANT_WRITE) {
+			return 1;
+		} else if (ret == 0) {
+			return 0;
+		} else if (ret != 1) {
+			worker->stats.errors++;
+			return 0;
+		}
+		if (!len) {
+			continue;
+		}
+		worker->stats.records_received++;
+		worker->stats.bytes_received += len;
+
+		c->outsent = 0;
+		if (server->handler) {
+			c->outlen = sizeof(c->out);
+			if ((ret = server->handler(server->handler_arg, c->in, len, c->out, &c->outlen)) != 1) {
+				if (ret < 0) worker->stats.errors++;
+				return 0;
+			}
+			if (c->outlen > sizeof(c->out)) {
+				error_print();
+				worker->stats.errors++;
+				return 0;
+			}
+		} else {
+			memcpy(c->out, c->in, len);
+			c->outlen = len;
+		}
+	}
+}
+
+// under c->lock, post the I/O the connection waits for, or close it
+static void server_conn_schedule(SERVER_WORKER *worker, SERVER_CONN *c)
+{
+	TLS_SERVER *server = worker->server;
+
+	if (c->sock == INVALID_SOCKET) {
+		return;
+	}
+	if (server->stopping) {
+		c->closing = 1;
+	} else if (c->wpos < c->wlen && !c->send_pending) {
+		c->ios++;
+		InterlockedIncrement(&server->ios);
+		if (server_conn_post_send(c) != 1) {
+			c->ios--;
+			InterlockedDecrement(&server->ios);
+			worker->stats.errors++;
+			c->closing = 1;
+			c->wpos = c->wlen = 0;
+		}
+	}
+	if (!c->closing && !c->eof && !c->recv_pending && c->rpos == c->rlen) {
+		c->ios++;
+		InterlockedIncrement(&server->ios);
+		if (server_conn_post_recv(c) != 1) {
+			c->ios--;
+			InterlockedDecrement(&server->ios);
+			worker->stats.errors++;
+			c->closing = 1;
+		}
+	}
+	// the last records are sent before the socket is closed, unless the server stops
+	if (c->closing && (!c->send_pending || server->stopping)) {
+		closesocket(c->sock);
+		c->sock = INVALID_SOCKET;
+	}
+}
+
+// the connection is no longer in any completion
+static void server_conn_free(SERVER_WORKER *worker, SERVER_CONN *c)
+{
+	TLS_SERVER *server = worker->server;
+
+	EnterCriticalSection(&server->lock);
+	if (c->prev) c->prev->next = c->next;
+	else server->conns = c->next;
+	if (c->next) c->next->prev = c->prev;
+	LeaveCriticalSection(&server->lock);
+
+	tls_cleanup(&c->conn);
+	DeleteCriticalSection(&c->lock);
+	free(c);
+	worker->stats.connections_active--;
+}
+
+static void server_conn_complete(SERVER_WORKER *worker, SERVER_CONN *c, SERVER_IO *io, BOOL ok, DWORD bytes)
+{
+	int done;
+
+	EnterCriticalSection(&c->lock);
+	c->ios--;
+	if (io->op == SERVER_IO_recv) {
+		c->recv_pending = 0;
+		if (!ok || !bytes) {
+			c->eof = 1;
+		}
+		c->rlen = ok ? bytes : 0;
+	} else {
+		c->send_pending = 0;
+		if (!ok) {
+			c->closing = 1;
+			c->wpos = c->wlen = 0;
+		} else if ((c->wpos += bytes) == c->wlen) {
+			c->wpos = c->wlen = 0;
+		}
+	}
+	if (!c->closing && c->sock != INVALID_SOCKET) {
+		if (server_conn_drive(worker, c) != 1) {
+			c->closing = 1;
+		}
+	}
+	server_conn_schedule(worker, c);
+	done = c->sock == INVALID_SOCKET && !c->ios;
+	LeaveCriticalSection(&c->lock);
+
+	if (done) {
+		server_conn_free(worker, c);
+	}
+}
+
+static void server_accept_complete(SERVER_WORKER *worker, SERVER_ACCEPT *a, BOOL ok)
+{
+	TLS_SERVER *server = worker->server;
+	SERVER_CONN *c = NULL;
+	TLS_CTX *slot_ctx;
+	TLS_TRANSPORT transport;
+	SOCKET sock = a->sock;
+	BOOL on = TRUE;
+	int rv;
+
+	// reposted under the lock, so tls_server_stop() cancels every pending one
+	a->sock = INVALID_SOCKET;
+	EnterCriticalSection(&server->lock);
+	if (!server->stopping && server_post_accept(server, a) != 1) {
+		worker->stats.errors++;
+	}
+	LeaveCriticalSection(&server->lock);
+	if (!ok) {
+		// cancelled, or reset by the client before it was accepted
+		closesocket(sock);
+		return;
+	}
+
+	if (setsockopt(sock, SOL_SOCKET, SO_UPDATE_ACCEPT_CONTEXT,
+			(const char *)&server->listen_sock, sizeof(server->listen_sock)) != 0
+		|| setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, (const char *)&on, sizeof(on)) != 0) {
+		error_print();
+		goto err;
+	}
+	if (!(c = (SERVER_CONN *)malloc(sizeof(SERVER_CONN)))) {
+		error_print();
+		goto err;
+	}
+	// the connection keeps its own reference of the current context
+	if (server->ctx_slot) {
+		slot_ctx = tls_ctx_slot_get(server->ctx_slot);
+		rv = slot_ctx ? tls_init(&c->conn, slot_ctx) : -1;
+		tls_ctx_free(slot_ctx);
+	} else {
+		rv = tls_init(&c->conn, server->ctx);
+	}
+	transport.send = server_conn_transport_send;
+	transport.recv = server_conn_transport_recv;
+	transport.arg = c;
+	if (rv != 1
+		|| tls_set_transport(&c->conn, &transport) != 1) {
+		error_print();
+		tls_cleanup(&c->conn);
+		goto err;
+	}
+	c->conn.quiet = 1;
+	c->sock = sock;
+	c->established = 0;
+	c->closing = 0;
+	c->eof = 0;
+	c->ios = 0;
+	c->outlen = c->outsent = 0;
+	c->recv_pending = c->send_pending = 0;
+	c->rpos = c->rlen = 0;
+	c->wpos = c->wlen = 0;
+	InitializeCriticalSection(&c->lock);
+
+	if (!CreateIoCompletionPort((HANDLE)sock, server->iocp, (ULONG_PTR)c, 0)) {
+		error_print();
+		tls_cleanup(&c->conn);
+		DeleteCriticalSection(&c->lock);
+		goto err;
+	}
+	EnterCriticalSection(&server->lock);
+	c->prev = NULL;
+	c->next = server->conns;
+	if (server->conns) server->conns->prev = c;
+	server->conns = c;
+	LeaveCriticalSection(&server->lock);
+	worker->stats.connections++;
+	worker->stats.connections_active++;
+
+	// the first flight is from the client, this only posts the first WSARecv()
+	EnterCriticalSection(&c->lock);
+	server_conn_schedule(worker, c);
+	rv = c->sock == INVALID_SOCKET && !c->ios;
+	LeaveCriticalSection(&c->lock);
+	if (rv) {
+		server_conn_free(worker, c);
+	}
+	return;
+
+err:
+	free(c);
+	closesocket(sock);
+	worker->stats.errors++;
+}
+
+static unsigned __stdcall server_worker_thread(void *arg)
+{
+	SERVER_WORKER *worker = (SERVER_WORKER *)arg;
+	TLS_SERVER *server = worker->server;
+	OVERLAPPED *overlapped;
+	ULONG_PTR key;
+	DWORD bytes;
+	BOOL ok;
+
+	// the threads are pinned as the epoll loops, a connection moves between them
+	if (worker->cpu < 64) {
+		SetThreadAffinityMask(GetCurrentThread(), (DWORD_PTR)1 << worker->cpu);
+	}
+	gmssl_numa_set_thread_node(gmssl_numa_node_of_cpu(worker->cpu));
+
+	for (;;) {
+		ok = GetQueuedCompletionStatus(server->iocp, &bytes, &key, &overlapped, INFINITE);
+		if (!overlapped) {
+			if (key == KEY_STOP) {
+				break;
+			}
+			fprintf(stderr, "GetQueuedCompletionStatus: %lu\n", GetLastError());
+			error_print();
+			break;
+		}
+		if (key == KEY_LISTEN) {
+			server_accept_complete(worker,
+				CONTAINING_RECORD(overlapped, SERVER_ACCEPT, io.overlapped), ok);
+		} else {
+			server_conn_complete(worker, (SERVER_CONN *)key,
+				CONTAINING_RECORD(overlapped, SERVER_IO, overlapped), ok, bytes);
+		}
+		server_io_done(server);
+	}
+	return 0;
+}
+
+TLS_SERVER *tls_server_new(const TLS_CTX *ctx, int port, size_t threads)
+{
+	TLS_SERVER *server;
+	SYSTEM_INFO info;
+	size_t ncpus;
+	size_t i;
+
+	if (!ctx || port < 0 || port > 65535) {
+		error_print();
+		return NULL;
+	}
+	if (ctx->is_client) {
+		error_print();
+		return NULL;
+	}
+	// tls12_do_accept() has no resumable states
+	if (ctx->protocol != TLS_protocol_tlcp && ctx->protocol != TLS_protocol_tls13) {
+		error_puts("tls_server needs a non-blocking handshake, only TLCP and TLS 1.3 have one");
+		return NULL;
+	}
+	if (tls_socket_lib_init() != 1) {
+		error_print();
+		return NULL;
+	}
+	GetSystemInfo(&info);
+	if ((ncpus = info.dwNumberOfProcessors) < 1) {
+		ncpus = 1;
+	}
+	if (!threads) {
+		threads = ncpus;
+	}
+
+	if (!(server = (TLS_SERVER *)calloc(1, sizeof(TLS_SERVER)))
+		|| !(server->workers = (SERVER_WORKER *)calloc(threads, sizeof(SERVER_WORKER)))
+		|| !(server->accepts = (SERVER_ACCEPT *)calloc(threads * SERVER_ACCEPTS_PER_THREAD, sizeof(SERVER_ACCEPT)))) {
+		if (server) free(server->workers);
+		free(server);
+		error_print();
+		return NULL;
+	}
+	server->ctx = ctx;
+	server->port = port;
+	server->listen_sock = INVALID_SOCKET;
+	InitializeCriticalSection(&server->lock);
+	server->accepts_cnt = threads * SERVER_ACCEPTS_PER_THREAD;
+	for (i = 0; i < server->accepts_cnt; i++) {
+		server->accepts[i].sock = INVALID_SOCKET;
+	}
+	server->workers_cnt = threads;
+	for (i = 0; i < threads; i++) {
+		server->workers[i].server = server;
+		server->workers[i].cpu = (int)(i % ncpus);
+	}
+
+	// at most `threads` of them run the completions at the same time
+	if (!(server->iocp = CreateIoCompletionPort(INVALID_HANDLE_VALUE, NULL, 0, (DWORD)threads))) {
+		fprintf(stderr, "CreateIoCompletionPort: %lu\n", GetLastError());
+		goto err;
+	}
+	if (server_listen(&server->listen_sock, &server->port) != 1
+		|| !CreateIoCompletionPort((HANDLE)server->listen_sock, server->iocp, KEY_LISTEN, 0)) {
+		goto err;
+	}
+	return server;
+
+err:
+	error_print();
+	tls_server_free(server);
+	return NULL;
+}
+
+int tls_server_set_handler(TLS_SERVER *server, TLS_SERVER_HANDLER handler, void *arg)
+{
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	if (server->running) {
+		error_puts("tls_server_set_handler() called after tls_server_start()");
+		return -1;
+	}
+	server->handler = handler;
+	server->handler_arg = arg;
+	return 1;
+}
+
+int tls_server_set_ctx_slot(TLS_SERVER *server, TLS_CTX_SLOT *slot)
+{
+	TLS_CTX *ctx;
+	int ret = 1;
+
+	if (!server || !slot) {
+		error_print();
+		return -1;
+	}
+	if (server->running) {
+		error_puts("tls_server_set_ctx_slot() called after tls_server_start()");
+		return -1;
+	}
+	if (!(ctx = tls_ctx_slot_get(slot))) {
+		error_print();
+		return -1;
+	}
+	if (ctx->protocol != server->ctx->protocol || ctx->is_client) {
+		error_puts("the TLS_CTX_SLOT has another protocol than the server");
+		ret = -1;
+	} else {
+		server->ctx_slot = slot;
+	}
+	tls_ctx_free(ctx);
+	return ret;
+}
+
+int tls_server_get_port(const TLS_SERVER *server)
+{
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	return server->port;
+}
+
+int tls_server_start(TLS_SERVER *server)
+{
+	size_t i;
+
+	if (!server || server->running) {
+		error_print();
+		return -1;
+	}
+	server->running = 1;
+	server->stopping = 0;
+	server->ios = 1;
+	for (i = 0; i < server->workers_cnt; i++) {
+		SERVER_WORKER *worker = &server->workers[i];
+		if (!(worker->thread = (HANDLE)_beginthreadex(NULL, 0, server_worker_thread, worker, 0, NULL))) {
+			error_print();
+			tls_server_stop(server);
+			return -1;
+		}
+	}
+	for (i = 0; i < server->accepts_cnt; i++) {
+		if (server_post_accept(server, &server->accepts[i]) != 1) {
+			tls_server_stop(server);
+			return -1;
+		}
+	}
+	return 1;
+}
+
+/*
+ * The pending AcceptEx() are cancelled and the sockets closed, the threads
+ * exit after the completions of the aborted I/O have freed the connections.
+ */
+int tls_server_stop(TLS_SERVER *server)
+{
+	SERVER_CONN *c;
+	size_t i;
+
+	if (!server) {
+		error_print();
+		return -1;
+	}
+	if (!server->running) {
+		return 1;
+	}
+	EnterCriticalSection(&server->lock);
+	InterlockedExchange(&server->stopping, 1);
+	CancelIoEx((HANDLE)server->listen_sock, NULL);
+	for (c = server->conns; c; c = c->next) {
+		EnterCriticalSection(&c->lock);
+		if (c->sock != INVALID_SOCKET) {
+			closesocket(c->sock);
+			c->sock = INVALID_SOCKET;
+		}
+		LeaveCriticalSection(&c->lock);
+	}
+	LeaveCriticalSection(&server->lock);
+
+	// drop the reference of the running server
+	server_io_done(server);
+
+	for (i = 0; i < server->workers_cnt; i++) {
+		SERVER_WORKER *worker = &server->workers[i];
+		if (worker->thread) {
+			WaitForSingleObject(worker->thread, INFINITE);
+			CloseHandle(worker->thread);
+			worker->thread = NULL;
+		}
+	}
+	server->running = 0;
+	return 1;
+}
+
+// counters of running threads are read without locks, the sums are approximate
+int tls_server_get_stats(const TLS_SERVER *server, TLS_SERVER_STATS *stats)
+{
+	size_t i;
+
+	if (!server || !stats) {
+		error_print();
+		return -1;
+	}
+	memset(stats, 0, sizeof(*stats));
+	for (i = 0; i < server->workers_cnt; i++) {
+		const TLS_SERVER_STATS *s = &server->workers[i].stats;
+		stats->connections += s->connections;
+		stats->connections_active += s->connections_active;
+		stats->handshakes += s->handshakes;
+		stats->records_received += s->records_received;
+		stats->records_sent += s->records_sent;
+		stats->bytes_received += s->bytes_received;
+		stats->bytes_sent += s->bytes_sent;
+		stats->errors += s->errors;
+	}
+	return 1;
+}
+
+void tls_server_free(TLS_SERVER *server)
+{
+	if (!server) {
+		return;
+	}
+	tls_server_stop(server);
+	if (server->listen_sock != INVALID_SOCKET) closesocket(server->listen_sock);
+	if (server->iocp) CloseHandle(server->iocp);
+	DeleteCriticalSection(&server->lock);
+	free(server->accepts);
+	free(server->workers);
+	free(server);
+}
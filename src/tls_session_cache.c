@@ -0,0 +1,378 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+#define NIL	((size_t)-1)
+
+typedef struct {
+	TLS_SESSION session;
+	size_t hash_next;
+	size_t lru_prev;
+	size_t lru_next; // also links the free list
+} SESSION_ENTRY;
+
+/*
+ * Entries live in a fixed array, indices link the hash chains and the LRU
+ * list (head is the most recently used), nothing is allocated after new().
+ */
+typedef struct {
+	cache_mutex_t mutex;
+	SESSION_ENTRY *entries;
+	size_t capacity;
+	size_t count;
+	size_t *buckets;
+	size_t buckets_mask;
+	size_t lru_head;
+	size_t lru_tail;
+	size_t free_head;
+} SESSION_SHARD;
+
+struct TLS_SESSION_CACHE_st {
+	SESSION_SHARD shards[TLS_SESSION_CACHE_SHARDS];
+	time_t timeout;
+	TLS_SESSION_STORE store;
+	int store_set;
+};
+
+// FNV-1a, the IDs are chosen by the server but looked up with the client's bytes
+static uint32_t session_id_hash(const uint8_t *id, size_t idlen)
+{
+	uint32_t h = 2166136261U;
+	while (idlen--) {
+		h ^= *id++;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+static SESSION_SHARD *session_cache_shard(TLS_SESSION_CACHE *cache, uint32_t hash)
+{
+	return &cache->shards[hash % TLS_SESSION_CACHE_SHARDS];
+}
+
+static size_t *shard_bucket(SESSION_SHARD *shard, uint32_t hash)
+{
+	return &shard->buckets[(hash / TLS_SESSION_CACHE_SHARDS) & shard->buckets_mask];
+}
+
+static size_t shard_find(SESSION_SHARD *shard, uint32_t hash, const uint8_t *id, size_t idlen)
+{
+	size_t i = *shard_bucket(shard, hash);
+
+	while (i != NIL) {
+		const TLS_SESSION *session = &shard->entries[i].session;
+		if (session->session_id_len == idlen && memcmp(session->session_id, id, idlen) == 0) {
+			return i;
+		}
+		i = shard->entries[i].hash_next;
+	}
+	return NIL;
+}
+
+static void shard_lru_unlink(SESSION_SHARD *shard, size_t i)
+{
+	SESSION_ENTRY *e = &shard->entries[i];
+
+	if (e->lru_prev != NIL) shard->entries[e->lru_prev].lru_next = e->lru_next;
+	else shard->lru_head = e->lru_next;
+	if (e->lru_next != NIL) shard->entries[e->lru_next].lru_prev = e->lru_prev;
+	else shard->lru_tail = e->lru_prev;
+}
+
+static void shard_lru_push_front(SESSION_SHARD *shard, size_t i)
+{
+	SESSION_ENTRY *e = &shard->entries[i];
+
+	e->lru_prev = NIL;
+	e->lru_next = shard->lru_head;
+	if (shard->lru_head != NIL) shard->entries[shard->lru_head].lru_prev = i;
+	else shard->lru_tail = i;
+	shard->lru_head = i;
+}
+
+static void shard_remove(SESSION_SHARD *shard, size_t i)
+{
+	SESSION_ENTRY *e = &shard->entries[i];
+	uint32_t hash = session_id_hash(e->session.session_id, e->session.session_id_len);
+	size_t *link = shard_bucket(shard, hash);
+
+	while (*link != i) {
+		link = &shard->entries[*link].hash_next;
+	}
+	*link = e->hash_next;
+	shard_lru_unlink(shard, i);
+
+	gmssl_secure_clear(&e->session, sizeof(TLS_SESSION));
+	e->lru_next = shard->free_head;
+	shard->free_head = i;
+	shard->count--;
+}
+
+static void shard_insert(SESSION_SHARD *shard, uint32_t hash, const TLS_SESSION *session)
+{
+	size_t *bucket;
+	size_t i;
+
+	if ((i = shard_find(shard, hash, session->session_id, session->session_id_len)) != NIL) {
+		shard->entries[i].session = *session;
+		shard_lru_unlink(shard, i);
+		shard_lru_push_front(shard, i);
+		return;
+	}
+	if (shard->free_head == NIL) {
+		shard_remove(shard, shard->lru_tail);
+	}
+	i = shard->free_head;
+	shard->free_head = shard->entries[i].lru_next;
+
+	shard->entries[i].session = *session;
+	bucket = shard_bucket(shard, hash);
+	shard->entries[i].hash_next = *bucket;
+	*bucket = i;
+	shard_lru_push_front(shard, i);
+	shard->count++;
+}
+
+static int session_expired(const TLS_SESSION_CACHE *cache, const TLS_SESSION *session)
+{
+	time_t now = time(NULL);
+	return now < session->time || now - session->time >= cache->timeout;
+}
+
+TLS_SESSION_CACHE *tls_session_cache_new(size_t max_entries, time_t timeout)
+{
+	TLS_SESSION_CACHE *cache;
+	size_t capacity;
+	size_t nbuckets;
+	size_t i, j;
+
+	if (!max_entries || timeout <= 0) {
+		error_print();
+		return NULL;
+	}
+	if (!(cache = (TLS_SESSION_CACHE *)calloc(1, sizeof(*cache)))) {
+		error_print();
+		return NULL;
+	}
+	cache->timeout = timeout;
+
+	capacity = (max_entries + TLS_SESSION_CACHE_SHARDS - 1) / TLS_SESSION_CACHE_SHARDS;
+	nbuckets = 1;
+	while (nbuckets < capacity) {
+		nbuckets <<= 1;
+	}
+
+	for (i = 0; i < TLS_SESSION_CACHE_SHARDS; i++) {
+		SESSION_SHARD *shard = &cache->shards[i];
+
+		if (!(shard->entries = (SESSION_ENTRY *)calloc(capacity, sizeof(SESSION_ENTRY)))
+			|| !(shard->buckets = (size_t *)malloc(nbuckets * sizeof(size_t)))) {
+			free(shard->entries);
+			while (i--) {
+				cache_mutex_destroy(&cache->shards[i].mutex);
+				free(cache->shards[i].entries);
+				free(cache->shards[i].buckets);
+			}
+			free(cache);
+			error_print();
+			return NULL;
+		}
+		shard->capacity = capacity;
+		shard->buckets_mask = nbuckets - 1;
+		for (j = 0; j < nbuckets; j++) {
+			shard->buckets[j] = NIL;
+		}
+		for (j = 0; j < capacity; j++) {
+			shard->entries[j].lru_next = j + 1 < capacity ? j + 1 : NIL;
+		}
+		shard->free_head = 0;
+		shard->lru_head = shard->lru_tail = NIL;
+		cache_mutex_init(&shard->mutex);
+	}
+	return cache;
+}
+
+void tls_session_cache_free(TLS_SESSION_CACHE *cache)
+{
+	size_t i;
+
+	if (!cache) {
+		return;
+	}
+	for (i = 0; i < TLS_SESSION_CACHE_SHARDS; i++) {
+		SESSION_SHARD *shard = &cache->shards[i];
+
+		cache_mutex_destroy(&shard->mutex);
+		gmssl_secure_clear(shard->entries, sizeof(SESSION_ENTRY) * shard->capacity);
+		free(shard->entries);
+		free(shard->buckets);
+	}
+	free(cache);
+}
+
+int tls_session_cache_set_store(TLS_SESSION_CACHE *cache, const TLS_SESSION_STORE *store)
+{
+	if (!cache) {
+		error_print();
+		return -1;
+	}
+	if (store) {
+		if (!store->get || !store->put || !store->remove) {
+			error_print();
+			return -1;
+		}
+		cache->store = *store;
+		cache->store_set = 1;
+	} else {
+		memset(&cache->store, 0, sizeof(cache->store));
+		cache->store_set = 0;
+	}
+	return 1;
+}
+
+int tls_session_cache_add(TLS_SESSION_CACHE *cache, const TLS_SESSION *session)
+{
+	SESSION_SHARD *shard;
+	uint32_t hash;
+
+	if (!cache || !session) {
+		error_print();
+		return -1;
+	}
+	if (!session->session_id_len || session->session_id_len > sizeof(session->session_id)) {
+		error_print();
+		return -1;
+	}
+	hash = session_id_hash(session->session_id, session->session_id_len);
+	shard = session_cache_shard(cache, hash);
+
+	cache_mutex_lock(&shard->mutex);
+	shard_insert(shard, hash, session);
+	cache_mutex_unlock(&shard->mutex);
+
+	// the store is called without the shard lock
+	if (cache->store_set && cache->store.put(cache->store.arg, session) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int tls_session_cache_get(TLS_SESSION_CACHE *cache, const uint8_t *session_id, size_t session_id_len,
+	TLS_SESSION *session)
+{
+	SESSION_SHARD *shard;
+	uint32_t hash;
+	size_t i;
+	int ret;
+
+	if (!cache || !session_id || !session) {
+		error_print();
+		return -1;
+	}
+	if (!session_id_len || session_id_len > sizeof(session->session_id)) {
+		return 0;
+	}
+	hash = session_id_hash(session_id, session_id_len);
+	shard = session_cache_shard(cache, hash);
+
+	cache_mutex_lock(&shard->mutex);
+	if ((i = shard_find(shard, hash, session_id, session_id_len)) != NIL) {
+		if (session_expired(cache, &shard->entries[i].session)) {
+			shard_remove(shard, i);
+		} else {
+			*session = shard->entries[i].session;
+			shard_lru_unlink(shard, i);
+			shard_lru_push_front(shard, i);
+			cache_mutex_unlock(&shard->mutex);
+			return 1;
+		}
+	}
+	cache_mutex_unlock(&shard->mutex);
+
+	if (!cache->store_set) {
+		return 0;
+	}
+	if ((ret = cache->store.get(cache->store.arg, session_id, session_id_len, session)) != 1) {
+		return ret < 0 ? -1 : 0;
+	}
+	if (session->session_id_len != session_id_len
+		|| memcmp(session->session_id, session_id, session_id_len) != 0
+		|| session_expired(cache, session)) {
+		gmssl_secure_clear(session, sizeof(TLS_SESSION));
+		return 0;
+	}
+	cache_mutex_lock(&shard->mutex);
+	shard_insert(shard, hash, session);
+	cache_mutex_unlock(&shard->mutex);
+	return 1;
+}
+
+int tls_session_cache_remove(TLS_SESSION_CACHE *cache, const uint8_t *session_id, size_t session_id_len)
+{
+	SESSION_SHARD *shard;
+	uint32_t hash;
+	size_t i;
+
+	if (!cache || !session_id) {
+		error_print();
+		return -1;
+	}
+	hash = session_id_hash(session_id, session_id_len);
+	shard = session_cache_shard(cache, hash);
+
+	cache_mutex_lock(&shard->mutex);
+	if ((i = shard_find(shard, hash, session_id, session_id_len)) != NIL) {
+		shard_remove(shard, i);
+	}
+	cache_mutex_unlock(&shard->mutex);
+
+	if (cache->store_set && cache->store.remove(cache->store.arg, session_id, session_id_len) < 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+size_t tls_session_cache_count(TLS_SESSION_CACHE *cache)
+{
+	size_t count = 0;
+	size_t i;
+
+	for (i = 0; i < TLS_SESSION_CACHE_SHARDS; i++) {
+		cache_mutex_lock(&cache->shards[i].mutex);
+		count += cache->shards[i].count;
+		cache_mutex_unlock(&cache->shards[i].mutex);
+	}
+	return count;
+}
@@ -0,0 +1,396 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION cache_mutex_t;
+#define cache_mutex_init(m)	InitializeCriticalSection(m)
+#define cache_mutex_destroy(m)	DeleteCriticalSection(m)
+#define cache_mutex_lock(m)	EnterCriticalSection(m)
+#define cache_mutex_unlock(m)	LeaveCriticalSection(m)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t cache_mutex_t;
+#define cache_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define cache_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define cache_mutex_lock(m)	pthread_mutex_lock(m)
+#define cache_mutex_unlock(m)	pthread_mutex_unlock(m)
+#endif
+
+
+#define NIL	((size_t)-1)
+
+// the names and the passwords are not changed after add(), they are read without the lock
+typedef struct {
+	char *host;
+	char *chainfile;
+	char *signkeyfile;
+	char *signkeypass;
+	char *kenckeyfile; // tlcp
+	char *kenckeypass;
+	TLS_CTX *ctx; // NULL until loaded
+	size_t hash_next;
+	size_t lru_prev;
+	size_t lru_next;
+} SNI_ENTRY;
+
+/*
+ * Entries live in a fixed array, indices link the hash chains and the LRU
+ * list of the loaded contexts (head is the most recently used).
+ */
+struct TLS_SNI_TABLE_st {
+	cache_mutex_t mutex;
+	int protocol;
+	SNI_ENTRY *entries;
+	size_t capacity;
+	size_t count;
+	size_t *buckets;
+	size_t buckets_mask;
+	size_t lru_head;
+	size_t lru_tail;
+	size_t loaded;
+	size_t max_loaded;
+};
+
+// FNV-1a of the lower case name
+static uint32_t sni_host_hash(const char *host)
+{
+	uint32_t h = 2166136261U;
+	while (*host) {
+		h ^= (uint8_t)*host++;
+		h *= 16777619U;
+	}
+	return h;
+}
+
+static size_t sni_find(const TLS_SNI_TABLE *table, const char *host)
+{
+	size_t i = table->buckets[sni_host_hash(host) & table->buckets_mask];
+
+	while (i != NIL) {
+		if (strcmp(table->entries[i].host, host) == 0) {
+			return i;
+		}
+		i = table->entries[i].hash_next;
+	}
+	return NIL;
+}
+
+static void sni_lru_unlink(TLS_SNI_TABLE *table, size_t i)
+{
+	SNI_ENTRY *e = &table->entries[i];
+
+	if (e->lru_prev != NIL) table->entries[e->lru_prev].lru_next = e->lru_next;
+	else table->lru_head = e->lru_next;
+	if (e->lru_next != NIL) table->entries[e->lru_next].lru_prev = e->lru_prev;
+	else table->lru_tail = e->lru_prev;
+}
+
+static void sni_lru_push_front(TLS_SNI_TABLE *table, size_t i)
+{
+	SNI_ENTRY *e = &table->entries[i];
+
+	e->lru_prev = NIL;
+	e->lru_next = table->lru_head;
+	if (table->lru_head != NIL) table->entries[table->lru_head].lru_prev = i;
+	else table->lru_tail = i;
+	table->lru_head = i;
+}
+
+// with the lock held, running connections keep their own references
+static void sni_evict(TLS_SNI_TABLE *table, size_t max_loaded)
+{
+	while (table->loaded > max_loaded) {
+		size_t i = table->lru_tail;
+		sni_lru_unlink(table, i);
+		tls_ctx_free(table->entries[i].ctx);
+		table->entries[i].ctx = NULL;
+		table->loaded--;
+	}
+}
+
+TLS_SNI_TABLE *tls_sni_table_new(int protocol, size_t max_hosts, size_t max_loaded)
+{
+	TLS_SNI_TABLE *table;
+	size_t nbuckets = 1;
+	size_t i;
+
+	if (protocol != TLS_protocol_tlcp && protocol != TLS_protocol_tls13) {
+		error_puts("server_name is supported by TLS 1.3 and TLCP");
+		return NULL;
+	}
+	if (!max_hosts || !max_loaded) {
+		error_print();
+		return NULL;
+	}
+	while (nbuckets < max_hosts) {
+		nbuckets <<= 1;
+	}
+	if (!(table = (TLS_SNI_TABLE *)calloc(1, sizeof(*table)))) {
+		error_print();
+		return NULL;
+	}
+	if (!(table->entries = (SNI_ENTRY *)calloc(max_hosts, sizeof(SNI_ENTRY)))
+		|| !(table->buckets = (size_t *)malloc(nbuckets * sizeof(size_t)))) {
+		free(table->entries);
+		free(table);
+		error_print();
+		return NULL;
+	}
+	for (i = 0; i < nbuckets; i++) {
+		table->buckets[i] = NIL;
+	}
+	table->protocol = protocol;
+	table->capacity = max_hosts;
+	table->buckets_mask = nbuckets - 1;
+	table->lru_head = table->lru_tail = NIL;
+	table->max_loaded = max_loaded;
+	cache_mutex_init(&table->mutex);
+	return table;
+}
+
+static char *sni_strdup(const char *s)
+{
+	size_t len = strlen(s) + 1;
+	char *p;
+
+	if ((p = (char *)malloc(len)) != NULL) {
+		memcpy(p, s, len);
+	}
+	return p;
+}
+
+static void sni_entry_cleanup(SNI_ENTRY *e)
+{
+	free(e->host);
+	free(e->chainfile);
+	free(e->signkeyfile);
+	if (e->signkeypass) {
+		gmssl_secure_clear(e->signkeypass, strlen(e->signkeypass));
+		free(e->signkeypass);
+	}
+	free(e->kenckeyfile);
+	if (e->kenckeypass) {
+		gmssl_secure_clear(e->kenckeypass, strlen(e->kenckeypass));
+		free(e->kenckeypass);
+	}
+	memset(e, 0, sizeof(*e));
+}
+
+static int sni_table_add(TLS_SNI_TABLE *table, const char *host, const char *chainfile,
+	const char *signkeyfile, const char *signkeypass,
+	const char *kenckeyfile, const char *kenckeypass)
+{
+	SNI_ENTRY e;
+	size_t hostlen;
+	size_t i;
+	size_t *bucket;
+
+	if (!(hostlen = strlen(host)) || hostlen > TLS_MAX_SERVER_NAME_SIZE) {
+		error_print();
+		return -1;
+	}
+	memset(&e, 0, sizeof(e));
+	if (!(e.host = sni_strdup(host))
+		|| !(e.chainfile = sni_strdup(chainfile))
+		|| !(e.signkeyfile = sni_strdup(signkeyfile))
+		|| !(e.signkeypass = sni_strdup(signkeypass))
+		|| (kenckeyfile && !(e.kenckeyfile = sni_strdup(kenckeyfile)))
+		|| (kenckeypass && !(e.kenckeypass = sni_strdup(kenckeypass)))) {
+		sni_entry_cleanup(&e);
+		error_print();
+		return -1;
+	}
+	// names are matched in lower case
+	for (i = 0; i < hostlen; i++) {
+		if (e.host[i] >= 'A' && e.host[i] <= 'Z') {
+			e.host[i] += 'a' - 'A';
+		}
+	}
+	e.ctx = NULL;
+	e.lru_prev = e.lru_next = NIL;
+
+	cache_mutex_lock(&table->mutex);
+	if (sni_find(table, e.host) != NIL) {
+		cache_mutex_unlock(&table->mutex);
+		sni_entry_cleanup(&e);
+		error_puts("host already in the table");
+		return -1;
+	}
+	if (table->count >= table->capacity) {
+		cache_mutex_unlock(&table->mutex);
+		sni_entry_cleanup(&e);
+		error_puts("table is full");
+		return -1;
+	}
+	i = table->count++;
+	bucket = &table->buckets[sni_host_hash(e.host) & table->buckets_mask];
+	e.hash_next = *bucket;
+	table->entries[i] = e;
+	*bucket = i;
+	cache_mutex_unlock(&table->mutex);
+	return 1;
+}
+
+int tls_sni_table_add(TLS_SNI_TABLE *table, const char *host,
+	const char *chainfile, const char *keyfile, const char *keypass)
+{
+	if (!table || !host || !chainfile || !keyfile || !keypass) {
+		error_print();
+		return -1;
+	}
+	if (table->protocol != TLS_protocol_tls13) {
+		error_puts("use tls_sni_table_add_tlcp() for TLCP");
+		return -1;
+	}
+	return sni_table_add(table, host, chainfile, keyfile, keypass, NULL, NULL);
+}
+
+int tls_sni_table_add_tlcp(TLS_SNI_TABLE *table, const char *host, const char *chainfile,
+	const char *signkeyfile, const char *signkeypass,
+	const char *kenckeyfile, const char *kenckeypass)
+{
+	if (!table || !host || !chainfile || !signkeyfile || !signkeypass || !kenckeyfile || !kenckeypass) {
+		error_print();
+		return -1;
+	}
+	if (table->protocol != TLS_protocol_tlcp) {
+		error_puts("use tls_sni_table_add() for TLS 1.3");
+		return -1;
+	}
+	return sni_table_add(table, host, chainfile, signkeyfile, signkeypass, kenckeyfile, kenckeypass);
+}
+
+static TLS_CTX *sni_entry_load(const TLS_SNI_TABLE *table, const SNI_ENTRY *e)
+{
+	TLS_CTX *ctx;
+	int ret;
+
+	if (!(ctx = tls_ctx_new(table->protocol, TLS_server_mode))) {
+		error_print();
+		return NULL;
+	}
+	if (table->protocol == TLS_protocol_tlcp) {
+		ret = tls_ctx_set_tlcp_server_certificate_and_keys(ctx, e->chainfile,
+			e->signkeyfile, e->signkeypass, e->kenckeyfile, e->kenckeypass);
+	} else {
+		ret = tls_ctx_set_certificate_and_key(ctx, e->chainfile, e->signkeyfile, e->signkeypass);
+	}
+	if (ret != 1) {
+		tls_ctx_free(ctx);
+		error_print();
+		return NULL;
+	}
+	return ctx;
+}
+
+// a TLS_SERVER_NAME_CALLBACK, keys are decrypted out of the lock
+int tls_sni_table_lookup(void *arg, const char *host, TLS_CTX **ctx)
+{
+	TLS_SNI_TABLE *table = (TLS_SNI_TABLE *)arg;
+	char wildcard[TLS_MAX_SERVER_NAME_SIZE + 2];
+	const char *dot;
+	TLS_CTX *loaded;
+	size_t i;
+
+	if (!table || !host || !ctx) {
+		error_print();
+		return -1;
+	}
+	*ctx = NULL;
+
+	cache_mutex_lock(&table->mutex);
+	if ((i = sni_find(table, host)) == NIL
+		&& (dot = strchr(host, '.')) != NULL && strlen(dot) <= TLS_MAX_SERVER_NAME_SIZE) {
+		wildcard[0] = '*';
+		strcpy(wildcard + 1, dot);
+		i = sni_find(table, wildcard);
+	}
+	if (i == NIL) {
+		cache_mutex_unlock(&table->mutex);
+		return 0;
+	}
+	if (table->entries[i].ctx) {
+		sni_lru_unlink(table, i);
+		sni_lru_push_front(table, i);
+		*ctx = tls_ctx_up_ref(table->entries[i].ctx);
+		cache_mutex_unlock(&table->mutex);
+		return 1;
+	}
+	cache_mutex_unlock(&table->mutex);
+
+	if (!(loaded = sni_entry_load(table, &table->entries[i]))) {
+		error_print();
+		return -1;
+	}
+
+	cache_mutex_lock(&table->mutex);
+	if (table->entries[i].ctx) {
+		// loaded by another thread meanwhile
+		tls_ctx_free(loaded);
+		sni_lru_unlink(table, i);
+	} else {
+		table->entries[i].ctx = loaded;
+		table->loaded++;
+	}
+	sni_lru_push_front(table, i);
+	*ctx = tls_ctx_up_ref(table->entries[i].ctx);
+	sni_evict(table, table->max_loaded);
+	cache_mutex_unlock(&table->mutex);
+	return 1;
+}
+
+size_t tls_sni_table_loaded_count(TLS_SNI_TABLE *table)
+{
+	size_t loaded;
+
+	if (!table) {
+		error_print();
+		return 0;
+	}
+	cache_mutex_lock(&table->mutex);
+	loaded = table->loaded;
+	cache_mutex_unlock(&table->mutex);
+	return loaded;
+}
+
+void tls_sni_table_evict(TLS_SNI_TABLE *table, size_t max_loaded)
+{
+	if (table) {
+		cache_mutex_lock(&table->mutex);
+		sni_evict(table, max_loaded);
+		cache_mutex_unlock(&table->mutex);
+	}
+}
+
+void tls_sni_table_free(TLS_SNI_TABLE *table)
+{
+	size_t i;
+
+	if (table) {
+		for (i = 0; i < table->count; i++) {
+			if (table->entries[i].ctx) {
+				tls_ctx_free(table->entries[i].ctx);
+			}
+			sni_entry_cleanup(&table->entries[i]);
+		}
+		cache_mutex_destroy(&table->mutex);
+		free(table->entries);
+		free(table->buckets);
+		free(table);
+	}
+}
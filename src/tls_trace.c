@@ -231,6 +231,8 @@ const char *tls_alert_description_text(int description)
 	case TLS_alert_user_canceled: return "user_canceled";
 	case TLS_alert_no_renegotiation: return "no_renegotiation";
 	case TLS_alert_unsupported_extension: return "unsupported_extension";
+	case TLS_alert_unrecognized_name: return "unrecognized_name";
+	case TLS_alert_bad_certificate_status_response: return "bad_certificate_status_response";
 	case TLS_alert_unsupported_site2site: return "unsupported_site2site";
 	case TLS_alert_no_area: return "no_area";
 	case TLS_alert_unsupported_areatype: return "unsupported_areatype";
@@ -883,6 +885,7 @@ int tls13_handshake_print(FILE *fp, int fmt, int ind, const uint8_t *handshake,
 	case TLS_handshake_certificate:
 	case TLS_handshake_certificate_request:
 	case TLS_handshake_certificate_verify:
+	case TLS_handshake_compressed_certificate:
 		format_print(fp, fmt, ind, "Handshake\n");
 		ind += 4;
 		format_print(fp, fmt, ind, "Type: %s (%d)\n", tls_handshake_type_name(type), type);
@@ -896,6 +899,8 @@ int tls13_handshake_print(FILE *fp, int fmt, int ind, const uint8_t *handshake,
 		return tls13_certificate_request_print(fp, fmt, ind, data, datalen);
 	case TLS_handshake_certificate_verify:
 		return tls13_certificate_verify_print(fp, fmt, ind, data, datalen);
+	case TLS_handshake_compressed_certificate:
+		return tls13_compressed_certificate_print(fp, fmt, ind, data, datalen);
 	}
 
 	return tls_handshake_print(fp, p, len, fmt, ind);
@@ -944,6 +949,9 @@ int tls_handshake_print(FILE *fp, const uint8_t *handshake, size_t handshakelen,
 	case TLS_handshake_certificate:
 		if (tls_certificate_print(fp, data, datalen, format, indent) != 1)
 			{ error_print(); return -1; } break;
+	case TLS_handshake_certificate_status:
+		if (tls_certificate_status_print(fp, data, datalen, format, indent) != 1)
+			{ error_print(); return -1; } break;
 	case TLS_handshake_server_key_exchange:
 		if (tls_server_key_exchange_print(fp, data, datalen, format, indent) != 1)
 			{ error_print(); return -1; } break;
@@ -969,6 +977,26 @@ int tls_handshake_print(FILE *fp, const uint8_t *handshake, size_t handshakelen,
 	return 1;
 }
 
+int tls_certificate_status_print(FILE *fp, const uint8_t *data, size_t datalen, int format, int indent)
+{
+	const uint8_t *ocsp_resp;
+	size_t ocsp_resp_len;
+
+	format_print(fp, format, indent, "CertificateStatus\n");
+	indent += 4;
+	if (tls_certificate_status_from_bytes(&ocsp_resp, &ocsp_resp_len, &data, &datalen) != 1) {
+		error_print();
+		return -1;
+	}
+	format_print(fp, format, indent, "status_type: ocsp (%d)\n", TLS_certificate_status_ocsp);
+	format_bytes(fp, format, indent, "response", ocsp_resp, ocsp_resp_len);
+	if (datalen) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int tls_alert_print(FILE *fp, const uint8_t *data, size_t datalen, int format, int indent)
 {
 	if (datalen != 2) {
@@ -0,0 +1,195 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+typedef CRITICAL_SECTION pair_mutex_t;
+typedef CONDITION_VARIABLE pair_cond_t;
+#define pair_mutex_init(m)	InitializeCriticalSection(m)
+#define pair_mutex_destroy(m)	DeleteCriticalSection(m)
+#define pair_mutex_lock(m)	EnterCriticalSection(m)
+#define pair_mutex_unlock(m)	LeaveCriticalSection(m)
+#define pair_cond_init(c)	InitializeConditionVariable(c)
+#define pair_cond_destroy(c)
+#define pair_cond_wait(c,m)	SleepConditionVariableCS(c, m, INFINITE)
+#define pair_cond_broadcast(c)	WakeAllConditionVariable(c)
+#else
+#include <pthread.h>
+typedef pthread_mutex_t pair_mutex_t;
+typedef pthread_cond_t pair_cond_t;
+#define pair_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define pair_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define pair_mutex_lock(m)	pthread_mutex_lock(m)
+#define pair_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define pair_cond_init(c)	pthread_cond_init(c, NULL)
+#define pair_cond_destroy(c)	pthread_cond_destroy(c)
+#define pair_cond_wait(c,m)	pthread_cond_wait(c, m)
+#define pair_cond_broadcast(c)	pthread_cond_broadcast(c)
+#endif
+
+
+// bytes sent by one end, buf[head..head + len) is not received yet
+typedef struct {
+	uint8_t *buf;
+	size_t size;
+	size_t head;
+	size_t len;
+	int closed;
+} PAIR_PIPE;
+
+typedef struct {
+	TLS_MEMORY_PAIR *pair;
+	int end;
+} PAIR_END;
+
+struct TLS_MEMORY_PAIR_st {
+	pair_mutex_t mutex;
+	pair_cond_t cond;
+	int blocking;
+	PAIR_PIPE pipes[2]; // pipes[i] is sent by the end i
+	PAIR_END ends[2];
+};
+
+static tls_ret_t memory_pair_send(void *arg, const uint8_t *buf, size_t len)
+{
+	PAIR_END *end = (PAIR_END *)arg;
+	TLS_MEMORY_PAIR *pair = end->pair;
+	PAIR_PIPE *pipe = &pair->pipes[end->end];
+	tls_ret_t ret = (tls_ret_t)len;
+
+	pair_mutex_lock(&pair->mutex);
+	if (pipe->closed) {
+		errno = EPIPE;
+		ret = -1;
+		goto end;
+	}
+	if (pipe->head) {
+		memmove(pipe->buf, pipe->buf + pipe->head, pipe->len);
+		pipe->head = 0;
+	}
+	if (len > pipe->size - pipe->len) {
+		size_t size = pipe->size ? pipe->size : TLS_MAX_RECORD_SIZE;
+		uint8_t *p;
+		while (size - pipe->len < len) {
+			size *= 2;
+		}
+		if (!(p = (uint8_t *)realloc(pipe->buf, size))) {
+			errno = ENOMEM;
+			ret = -1;
+			goto end;
+		}
+		pipe->buf = p;
+		pipe->size = size;
+	}
+	memcpy(pipe->buf + pipe->len, buf, len);
+	pipe->len += len;
+	pair_cond_broadcast(&pair->cond);
+end:
+	pair_mutex_unlock(&pair->mutex);
+	return ret;
+}
+
+static tls_ret_t memory_pair_recv(void *arg, uint8_t *buf, size_t len)
+{
+	PAIR_END *end = (PAIR_END *)arg;
+	TLS_MEMORY_PAIR *pair = end->pair;
+	PAIR_PIPE *pipe = &pair->pipes[!end->end];
+	tls_ret_t ret;
+
+	pair_mutex_lock(&pair->mutex);
+	while (!pipe->len) {
+		if (pipe->closed) {
+			ret = 0;
+			goto end;
+		}
+		if (!pair->blocking) {
+			errno = EAGAIN;
+			ret = -1;
+			goto end;
+		}
+		pair_cond_wait(&pair->cond, &pair->mutex);
+	}
+	if (len > pipe->len) {
+		len = pipe->len;
+	}
+	memcpy(buf, pipe->buf + pipe->head, len);
+	pipe->head += len;
+	pipe->len -= len;
+	if (!pipe->len) {
+		pipe->head = 0;
+	}
+	ret = (tls_ret_t)len;
+end:
+	pair_mutex_unlock(&pair->mutex);
+	return ret;
+}
+
+TLS_MEMORY_PAIR *tls_memory_pair_new(int blocking)
+{
+	TLS_MEMORY_PAIR *pair;
+
+	if (!(pair = (TLS_MEMORY_PAIR *)malloc(sizeof(*pair)))) {
+		error_print();
+		return NULL;
+	}
+	memset(pair, 0, sizeof(*pair));
+	pair_mutex_init(&pair->mutex);
+	pair_cond_init(&pair->cond);
+	pair->blocking = blocking;
+	pair->ends[0].pair = pair;
+	pair->ends[0].end = 0;
+	pair->ends[1].pair = pair;
+	pair->ends[1].end = 1;
+	return pair;
+}
+
+int tls_memory_pair_get_transport(TLS_MEMORY_PAIR *pair, int end, TLS_TRANSPORT *transport)
+{
+	if (!pair || !transport) {
+		error_print();
+		return -1;
+	}
+	if (end != 0 && end != 1) {
+		error_print();
+		return -1;
+	}
+	transport->send = memory_pair_send;
+	transport->recv = memory_pair_recv;
+	transport->arg = &pair->ends[end];
+	return 1;
+}
+
+void tls_memory_pair_close(TLS_MEMORY_PAIR *pair, int end)
+{
+	if (pair && (end == 0 || end == 1)) {
+		pair_mutex_lock(&pair->mutex);
+		pair->pipes[end].closed = 1;
+		pair_cond_broadcast(&pair->cond);
+		pair_mutex_unlock(&pair->mutex);
+	}
+}
+
+void tls_memory_pair_free(TLS_MEMORY_PAIR *pair)
+{
+	if (pair) {
+		if (pair->pipes[0].buf) free(pair->pipes[0].buf);
+		if (pair->pipes[1].buf) free(pair->pipes[1].buf);
+		pair_cond_destroy(&pair->cond);
+		pair_mutex_destroy(&pair->mutex);
+		free(pair);
+	}
+}
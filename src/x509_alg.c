@@ -88,14 +88,14 @@ from RFC 5758 Internet X.509 Public Key Infrastructure:
 int x509_digest_algor_to_der(int oid, uint8_t **out, size_t *outlen)
 {
 	const ASN1_OID_INFO *info;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (!(info = asn1_oid_info_from_oid(x509_digest_algors, x509_digest_algors_count, oid))) {
 		error_print();
 		return -1;
 	}
-	if (asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
-		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out,  outlen) != 1) {
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out,  outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -178,17 +178,16 @@ int x509_encryption_algor_to_der(int oid, const uint8_t *iv, size_t ivlen,
 	uint8_t **out, size_t *outlen)
 {
 	const ASN1_OID_INFO *info;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (!(info = asn1_oid_info_from_oid(x509_enc_algors, x509_enc_algors_count, oid))) {
 		error_print();
 		return -1;
 	}
-	if (asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, NULL, &len) != 1
-		|| asn1_octet_string_to_der(iv, ivlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out, outlen) != 1
-		|| asn1_octet_string_to_der(iv, ivlen, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(iv, ivlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -373,16 +372,15 @@ int x509_signature_algor_from_name(const char *name)
 int x509_signature_algor_to_der(int oid, uint8_t **out, size_t *outlen)
 {
 	const ASN1_OID_INFO *info;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (!(info = asn1_oid_info_from_oid(x509_sign_algors, x509_sign_algors_count, oid))) {
 		error_print();
 		return -1;
 	}
-	if (asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, NULL, &len) != 1
-		|| (info->flags && asn1_null_to_der(NULL, &len) != 1)
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out, outlen) != 1
-		|| (info->flags && asn1_null_to_der(out, outlen) != 1)) {
+		|| (info->flags && asn1_null_to_der(out, outlen) != 1)
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -487,7 +485,7 @@ int x509_public_key_encryption_algor_from_name(const char *name)
 int x509_public_key_encryption_algor_to_der(int oid, uint8_t **out, size_t *outlen)
 {
 	const ASN1_OID_INFO *info;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (oid != OID_sm2encrypt) {
 		error_print();
@@ -497,9 +495,9 @@ int x509_public_key_encryption_algor_to_der(int oid, uint8_t **out, size_t *outl
 		error_print();
 		return -1;
 	}
-	if (asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
-		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out, outlen) != 1) {
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| asn1_object_identifier_to_der(info->nodes, info->nodes_cnt, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -589,25 +587,23 @@ int x509_public_key_algor_from_name(const char *name)
 
 int x509_public_key_algor_to_der(int oid, int curve_or_null, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	switch (oid) {
 	case OID_ec_public_key:
-		if (asn1_object_identifier_to_der(oid_ec_public_key, sizeof(oid_ec_public_key)/sizeof(int), NULL, &len) != 1
-			|| ec_named_curve_to_der(curve_or_null, NULL, &len) != 1
-			|| asn1_sequence_header_to_der(len, out, outlen) != 1
+		if (asn1_sequence_begin(&hdr, out, outlen) != 1
 			|| asn1_object_identifier_to_der(oid_ec_public_key, sizeof(oid_ec_public_key)/sizeof(int), out, outlen) != 1
-			|| ec_named_curve_to_der(curve_or_null, out, outlen) != 1) {
+			|| ec_named_curve_to_der(curve_or_null, out, outlen) != 1
+			|| asn1_header_end(&hdr, out, outlen) != 1) {
 			error_print();
 			return -1;
 		}
 		break;
 	case OID_rsa_encryption:
-		if (asn1_object_identifier_to_der(oid_rsa_encryption, sizeof(oid_rsa_encryption)/sizeof(int), NULL, &len) != 1
-			|| asn1_null_to_der(NULL, &len) != 1
-			|| asn1_sequence_header_to_der(len, out, outlen) != 1
+		if (asn1_sequence_begin(&hdr, out, outlen) != 1
 			|| asn1_object_identifier_to_der(oid_rsa_encryption, sizeof(oid_rsa_encryption)/sizeof(int), out, outlen) != 1
-			|| asn1_null_to_der(out, outlen) != 1) {
+			|| asn1_null_to_der(out, outlen) != 1
+			|| asn1_header_end(&hdr, out, outlen) != 1) {
 			error_print();
 			return -1;
 		}
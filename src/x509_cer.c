@@ -38,7 +38,7 @@ const char *x509_version_name(int version)
 
 int x509_explicit_version_to_der(int index, int version, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (version == -1) {
 		return 0;
@@ -47,9 +47,9 @@ int x509_explicit_version_to_der(int index, int version, uint8_t **out, size_t *
 		error_print();
 		return -1;
 	}
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| asn1_explicit_header_to_der(index, len, out, outlen) != 1
-		|| asn1_int_to_der(version, out, outlen) != 1) {
+	if (asn1_explicit_begin(&hdr, index, out, outlen) != 1
+		|| asn1_int_to_der(version, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -145,12 +145,11 @@ int x509_validity_add_days(time_t *not_after, time_t not_before, int days)
 
 int x509_validity_to_der(time_t not_before, time_t not_after, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_time_to_der(not_before, NULL, &len) != 1
-		|| x509_time_to_der(not_after, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_time_to_der(not_before, out, outlen) != 1
-		|| x509_time_to_der(not_after, out, outlen) != 1) {
+		|| x509_time_to_der(not_after, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -491,17 +490,16 @@ int x509_attr_type_and_value_check(int oid, int tag, const uint8_t *val, size_t
 int x509_attr_type_and_value_to_der(int oid, int tag, const uint8_t *val, size_t vlen,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (vlen == 0) {
 		return 0;
 	}
 	if (x509_attr_type_and_value_check(oid, tag, val, vlen) != 1
-		|| x509_name_type_to_der(oid, NULL, &len) != 1
-		|| x509_directory_name_to_der(tag, val, vlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+		|| asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_name_type_to_der(oid, out, outlen) != 1
-		|| x509_directory_name_to_der(tag, val, vlen, out, outlen) != 1) {
+		|| x509_directory_name_to_der(tag, val, vlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -597,7 +595,7 @@ int x509_rdn_to_der(int oid, int tag, const uint8_t *val, size_t vlen,
 	const uint8_t *more, size_t morelen,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (vlen == 0 && morelen == 0) {
 		return 0;
@@ -606,11 +604,10 @@ int x509_rdn_to_der(int oid, int tag, const uint8_t *val, size_t vlen,
 		error_print();
 		return -1;
 	}
-	if (x509_attr_type_and_value_to_der(oid, tag, val, vlen, NULL, &len) < 0
-		|| asn1_data_to_der(more, morelen, NULL, &len) < 0
-		|| asn1_set_header_to_der(len, out, outlen) != 1
+	if (asn1_set_begin(&hdr, out, outlen) != 1
 		|| x509_attr_type_and_value_to_der(oid, tag, val, vlen, out, outlen) < 0
-		|| asn1_data_to_der(more, morelen, out, outlen) < 0) {
+		|| asn1_data_to_der(more, morelen, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -940,14 +937,14 @@ err:
 
 int x509_explicit_exts_to_der(int index, const uint8_t *d, size_t dlen, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (dlen == 0) {
 		return 0;
 	}
-	if (asn1_sequence_to_der(d, dlen, NULL, &len) != 1
-		|| asn1_explicit_header_to_der(index, len, out, outlen) != 1
-		|| asn1_sequence_to_der(d, dlen, out, outlen) != 1) {
+	if (asn1_explicit_begin(&hdr, index, out, outlen) != 1
+		|| asn1_sequence_to_der(d, dlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -989,18 +986,8 @@ int x509_tbs_cert_to_der(
 	const uint8_t *exts, size_t exts_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_explicit_version_to_der(0, version, NULL, &len) < 0
-		|| asn1_integer_to_der(serial, serial_len, NULL, &len) != 1
-		|| x509_signature_algor_to_der(signature_algor, NULL, &len) != 1
-		|| asn1_sequence_to_der(issuer, issuer_len, NULL, &len) != 1
-		|| x509_validity_to_der(not_before, not_after, NULL, &len) != 1
-		|| asn1_sequence_to_der(subject, subject_len, NULL, &len) != 1
-		|| x509_public_key_info_to_der(subject_public_key, NULL, &len) != 1
-		|| asn1_implicit_bit_octets_to_der(1, issuer_unique_id, issuer_unique_id_len, NULL, &len) < 0
-		|| asn1_implicit_bit_octets_to_der(2, subject_unique_id, subject_unique_id_len, NULL, &len) < 0
-		|| x509_explicit_exts_to_der(3, exts, exts_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_explicit_version_to_der(0, version, out, outlen) < 0
 		|| asn1_integer_to_der(serial, serial_len, out, outlen) != 1
 		|| x509_signature_algor_to_der(signature_algor, out, outlen) != 1
@@ -1010,7 +997,8 @@ int x509_tbs_cert_to_der(
 		|| x509_public_key_info_to_der(subject_public_key, out, outlen) != 1
 		|| asn1_implicit_bit_octets_to_der(1, issuer_unique_id, issuer_unique_id_len, out, outlen) < 0
 		|| asn1_implicit_bit_octets_to_der(2, subject_unique_id, subject_unique_id_len, out, outlen) < 0
-		|| x509_explicit_exts_to_der(3, exts, exts_len, out, outlen) < 0) {
+		|| x509_explicit_exts_to_der(3, exts, exts_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1105,27 +1093,13 @@ int x509_cert_sign_to_der(
 	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	uint8_t *tbs;
+	ASN1_HEADER hdr;
+	uint8_t *tbs = NULL;
 	int sig_alg = OID_sm2sign_with_sm3;
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen = SM2_signature_typical_size;
 
-	if (x509_tbs_cert_to_der(
-		version,
-		serial, serial_len,
-		signature_algor,
-		issuer, issuer_len,
-		not_before, not_after,
-		subject, subject_len,
-		subject_public_key,
-		issuer_unique_id, issuer_unique_id_len,
-		subject_unique_id, subject_unique_id_len,
-		exts, exts_len,
-		NULL, &len) != 1
-		|| x509_signature_algor_to_der(sig_alg, NULL, &len) != 1
-		|| asn1_bit_octets_to_der(sig, siglen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1) {
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1149,7 +1123,7 @@ int x509_cert_sign_to_der(
 		return -1;
 	}
 
-	if (out && *out) {
+	if (tbs) {
 		SM2_SIGN_CTX sign_ctx;
 		if (sm2_sign_init(&sign_ctx, sign_key, signer_id, signer_id_len) != 1
 			|| sm2_sign_update(&sign_ctx, tbs, *out - tbs) != 1
@@ -1162,7 +1136,8 @@ int x509_cert_sign_to_der(
 	}
 
 	if (x509_signature_algor_to_der(sig_alg, out, outlen) != 1
-		|| asn1_bit_octets_to_der(sig, siglen, out, outlen) != 1) {
+		|| asn1_bit_octets_to_der(sig, siglen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1262,10 +1237,17 @@ int x509_cert_verify_by_ca_cert(const uint8_t *a, size_t alen,
 	return 1;
 }
 
+// decode every field, the x509_cert_get_ accessors only parse the one asked for
+static int x509_cert_check_der(const uint8_t *a, size_t alen)
+{
+	return x509_cert_get_details(a, alen, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL,
+		NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL);
+}
+
 int x509_cert_to_der(const uint8_t *a, size_t alen, uint8_t **out, size_t *outlen)
 {
 	int ret;
-	if (x509_cert_get_subject(a, alen, NULL, NULL) != 1) {
+	if (x509_cert_check_der(a, alen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1283,7 +1265,7 @@ int x509_cert_from_der(const uint8_t **a, size_t *alen, const uint8_t **in, size
 		if (ret < 0) error_print();
 		return ret;
 	}
-	if (x509_cert_get_subject(*a, *alen, NULL, NULL) != 1) {
+	if (x509_cert_check_der(*a, *alen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1292,7 +1274,7 @@ int x509_cert_from_der(const uint8_t **a, size_t *alen, const uint8_t **in, size
 
 int x509_cert_to_pem(const uint8_t *a, size_t alen, FILE *fp)
 {
-	if (x509_cert_get_subject(a, alen, NULL, NULL) != 1) {
+	if (x509_cert_check_der(a, alen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1311,7 +1293,7 @@ int x509_cert_from_pem(uint8_t *a, size_t *alen, size_t maxlen, FILE *fp)
 		else *alen = 0;
 		return ret;
 	}
-	if (x509_cert_get_subject(a, *alen, NULL, NULL) != 1) {
+	if (x509_cert_check_der(a, *alen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1456,98 +1438,227 @@ int x509_cert_get_details(const uint8_t *a, size_t alen,
 	return 1;
 }
 
+int x509_cert_index_init(X509_CERT_INDEX *idx, const uint8_t *a, size_t alen)
+{
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *tbs;
+	size_t tbslen;
+
+	if (!idx || !a || !alen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_sequence_from_der(&d, &dlen, &a, &alen) != 1
+		|| asn1_length_is_zero(alen) != 1
+		|| asn1_sequence_from_der(&tbs, &tbslen, &d, &dlen) != 1
+		|| asn1_cursor_init(&idx->tbs, tbs, tbslen) != 1) {
+		error_print();
+		return -1;
+	}
+	idx->serial_number = (idx->tbs.fields_cnt && idx->tbs.fields[0].tag == ASN1_TAG_EXPLICIT(0)) ? 1 : 0;
+
+	// serialNumber, signature, issuer, validity, subject and subjectPublicKeyInfo are required
+	if (idx->tbs.fields_cnt < idx->serial_number + 6) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_cert_index_get_field(const X509_CERT_INDEX *idx, size_t offset, int tag,
+	const uint8_t **d, size_t *dlen)
+{
+	int field_tag;
+
+	if (!idx || !d || !dlen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_cursor_get(&idx->tbs, idx->serial_number + offset, &field_tag, d, dlen) != 1
+		|| field_tag != tag) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_serial_number(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen)
+{
+	const uint8_t *a;
+	size_t alen;
+
+	// the leading zero octet is removed by asn1_integer_from_der()
+	if (!idx || asn1_cursor_get_tlv(&idx->tbs, idx->serial_number, &a, &alen) != 1
+		|| asn1_integer_from_der(d, dlen, &a, &alen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_issuer(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen)
+{
+	if (x509_cert_index_get_field(idx, 2, ASN1_TAG_SEQUENCE, d, dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_validity(const X509_CERT_INDEX *idx, time_t *not_before, time_t *not_after)
+{
+	const uint8_t *a;
+	size_t alen;
+
+	if (!idx || asn1_cursor_get_tlv(&idx->tbs, idx->serial_number + 3, &a, &alen) != 1
+		|| x509_validity_from_der(not_before, not_after, &a, &alen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_subject(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen)
+{
+	if (x509_cert_index_get_field(idx, 4, ASN1_TAG_SEQUENCE, d, dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_subject_public_key(const X509_CERT_INDEX *idx, SM2_KEY *public_key)
+{
+	const uint8_t *a;
+	size_t alen;
+
+	if (!idx || asn1_cursor_get_tlv(&idx->tbs, idx->serial_number + 5, &a, &alen) != 1
+		|| x509_public_key_info_from_der(public_key, &a, &alen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_cert_index_get_exts(const X509_CERT_INDEX *idx, const uint8_t **d, size_t *dlen)
+{
+	const uint8_t *a;
+	size_t alen;
+	size_t i;
+
+	if (!idx || !d || !dlen) {
+		error_print();
+		return -1;
+	}
+	// after the optional issuerUniqueID and subjectUniqueID
+	for (i = idx->serial_number + 6; i < idx->tbs.fields_cnt; i++) {
+		if (idx->tbs.fields[i].tag == ASN1_TAG_EXPLICIT(3)) {
+			if (asn1_cursor_get_tlv(&idx->tbs, i, &a, &alen) != 1
+				|| x509_explicit_exts_from_der(3, d, dlen, &a, &alen) != 1) {
+				error_print();
+				return -1;
+			}
+			return 1;
+		}
+	}
+	*d = NULL;
+	*dlen = 0;
+	return 0;
+}
+
 int x509_cert_get_issuer_and_serial_number(const uint8_t *a, size_t alen,
 	const uint8_t **issuer, size_t *issuer_len,
 	const uint8_t **serial_number, size_t *serial_number_len)
 {
-	return x509_cert_get_details(a, alen,
-		NULL, // version
-		serial_number, serial_number_len, // serial
-		NULL, // signature_algor
-		issuer, issuer_len, // issuer
-		NULL, NULL, // validity
-		NULL, NULL, // subject
-		NULL, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		NULL, NULL, // extensions
-		NULL, // signature_algor
-		NULL, NULL); // signature
+	X509_CERT_INDEX idx;
+
+	if (x509_cert_index_init(&idx, a, alen) != 1
+		|| (issuer && x509_cert_index_get_issuer(&idx, issuer, issuer_len) != 1)
+		|| (serial_number && x509_cert_index_get_serial_number(&idx, serial_number, serial_number_len) != 1)) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
 int x509_cert_get_subject_public_key(const uint8_t *a, size_t alen, SM2_KEY *public_key)
 {
-	return x509_cert_get_details(a, alen,
-		NULL, // version
-		NULL, NULL, // serial
-		NULL, // signature_algor
-		NULL, NULL, // issuer
-		NULL, NULL, // validity
-		NULL, NULL, // subject
-		public_key, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		NULL, NULL, // extensions
-		NULL, // signature_algor
-		NULL, NULL); // signature
+	X509_CERT_INDEX idx;
+
+	if (x509_cert_index_init(&idx, a, alen) != 1
+		|| x509_cert_index_get_subject_public_key(&idx, public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
 int x509_cert_get_subject(const uint8_t *a, size_t alen, const uint8_t **d, size_t *dlen)
 {
-	return x509_cert_get_details(a, alen,
-		NULL, // version
-		NULL, NULL, // serial
-		NULL, // signature_algor
-		NULL, NULL, // issuer
-		NULL, NULL, // validity
-		d, dlen, // subject
-		NULL, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		NULL, NULL, // extensions
-		NULL, // signature_algor
-		NULL, NULL); // signature
+	X509_CERT_INDEX idx;
+
+	if (x509_cert_index_init(&idx, a, alen) != 1
+		|| x509_cert_index_get_subject(&idx, d, dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
 int x509_cert_get_issuer(const uint8_t *a, size_t alen, const uint8_t **d, size_t *dlen)
 {
-	return x509_cert_get_details(a, alen,
-		NULL, // version
-		NULL, NULL, // serial
-		NULL, // signature_algor
-		d, dlen, // issuer
-		NULL, NULL, // validity
-		NULL, NULL, // subject
-		NULL, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		NULL, NULL, // extensions
-		NULL, // signature_algor
-		NULL, NULL); // signature
+	X509_CERT_INDEX idx;
+
+	if (x509_cert_index_init(&idx, a, alen) != 1
+		|| x509_cert_index_get_issuer(&idx, d, dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
 int x509_cert_get_exts(const uint8_t *a, size_t alen, const uint8_t **d, size_t *dlen)
 {
-	if (x509_cert_get_details(a, alen,
-		NULL, // version
-		NULL, NULL, // serial
-		NULL, // signature_algor
-		NULL, NULL, // issuer
-		NULL, NULL, // validity
-		NULL, NULL, // subject
-		NULL, // subject_public_key
-		NULL, NULL, // issuer_unique_id
-		NULL, NULL, // subject_unique_id
-		d, dlen, // extensions
-		NULL, // signature_algor
-		NULL, NULL // signature
-		) != 1) {
+	X509_CERT_INDEX idx;
+	int ret;
+
+	if (x509_cert_index_init(&idx, a, alen) != 1
+		|| (ret = x509_cert_index_get_exts(&idx, d, dlen)) < 0) {
 		error_print();
 		return -1;
 	}
-	if (!d || !dlen) {
+	return ret;
+}
+
+int x509_cert_get_subject_key_identifier(const uint8_t *a, size_t alen, const uint8_t **key_id, size_t *key_id_len)
+{
+	const uint8_t *exts;
+	size_t extslen;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+	int ret;
+
+	if ((ret = x509_cert_get_exts(a, alen, &exts, &extslen)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (ret == 1 && (ret = x509_exts_get_ext_by_oid(exts, extslen, OID_ce_subject_key_identifier,
+		&critical, &val, &vlen)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (ret == 0) {
+		*key_id = NULL;
+		*key_id_len = 0;
 		return 0;
 	}
+	if (asn1_octet_string_from_der(key_id, key_id_len, &val, &vlen) != 1
+		|| asn1_length_is_zero(vlen) != 1) {
+		error_print();
+		return -1;
+	}
 	return 1;
 }
 
@@ -1660,6 +1771,34 @@ int x509_certs_get_cert_by_subject(const uint8_t *d, size_t dlen,
 	return 0;
 }
 
+int x509_certs_get_cert_by_subject_and_key_identifier(const uint8_t *d, size_t dlen,
+	const uint8_t *subject, size_t subject_len,
+	const uint8_t *key_id, size_t key_id_len,
+	const uint8_t **cert, size_t *certlen)
+{
+	const uint8_t *subj;
+	size_t subj_len;
+	const uint8_t *id;
+	size_t idlen;
+	int ret;
+
+	while (dlen) {
+		if (x509_cert_from_der(cert, certlen, &d, &dlen) != 1
+			|| x509_cert_get_subject(*cert, *certlen, &subj, &subj_len) != 1
+			|| (ret = x509_cert_get_subject_key_identifier(*cert, *certlen, &id, &idlen)) < 0) {
+			error_print();
+			return -1;
+		}
+		if (ret == 1 && x509_name_equ(subj, subj_len, subject, subject_len) == 1
+			&& idlen == key_id_len && memcmp(id, key_id, key_id_len) == 0) {
+			return 1;
+		}
+	}
+	*cert = NULL;
+	*certlen = 0;
+	return 0;
+}
+
 int x509_certs_get_cert_by_issuer_and_serial_number(const uint8_t *d, size_t dlen,
 	const uint8_t *issuer, size_t issuer_len, const uint8_t *serial, size_t serial_len,
 	const uint8_t **cert, size_t *cert_len)
@@ -1763,8 +1902,19 @@ int x509_cert_check(const uint8_t *cert, size_t certlen, int cert_type,
 	return 1;
 }
 
-int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
-	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result)
+// the issuer of the last certificate of the chain is found in `store` or in `rootcerts`
+static int x509_certs_get_root_cert(const uint8_t *rootcerts, size_t rootcertslen, const X509_STORE *store,
+	const uint8_t *name, size_t namelen, const uint8_t **cacert, size_t *cacertlen)
+{
+	if (store) {
+		return x509_store_get_cert_by_subject(store, name, namelen, cacert, cacertlen);
+	}
+	return x509_certs_get_cert_by_subject(rootcerts, rootcertslen, name, namelen, cacert, cacertlen);
+}
+
+int x509_certs_verify_ex(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, const X509_STORE *store,
+	int depth, int *verify_result)
 {
 	int entity_cert_type;
 	const uint8_t *cert;
@@ -1824,7 +1974,7 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 			return -1;
 		}
 
-		if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+		if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
@@ -1839,7 +1989,7 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 		error_print();
 		return -1;
 	}
-	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, name, namelen,
+	if (x509_certs_get_root_cert(rootcerts, rootcertslen, store, name, namelen,
 		&cacert, &cacertlen) != 1) {
 		error_print();
 		return -1;
@@ -1854,7 +2004,7 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 		error_print();
 		return -1;
 	}
-	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+	if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
 		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 		error_print();
 		return -1;
@@ -1863,8 +2013,9 @@ int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
 	return 1;
 }
 
-int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type,
-	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result)
+int x509_certs_verify_tlcp_ex(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, const X509_STORE *store,
+	int depth, int *verify_result)
 {
 	int sign_cert_type;
 	int kenc_cert_type;
@@ -1931,7 +2082,7 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 			}
 
 			// verify entity key encipherment cert
-			if (x509_cert_verify_by_ca_cert(kenc_cert, kenc_certlen, cacert, cacertlen,
+			if (x509_cert_verify_by_ca_cert_cached(kenc_cert, kenc_certlen, cacert, cacertlen,
 				SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 				error_print();
 				return -1;
@@ -1943,7 +2094,7 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 			return -1;
 		}
 
-		if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+		if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
@@ -1959,7 +2110,7 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 		error_print();
 		return -1;
 	}
-	if (x509_certs_get_cert_by_subject(rootcerts, rootcertslen, name, namelen, &cacert, &cacertlen) != 1) {
+	if (x509_certs_get_root_cert(rootcerts, rootcertslen, store, name, namelen, &cacert, &cacertlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1975,14 +2126,14 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 
 	// when no mid CA certs
 	if (path_len == 0) {
-		if (x509_cert_verify_by_ca_cert(kenc_cert, kenc_certlen, cacert, cacertlen,
+		if (x509_cert_verify_by_ca_cert_cached(kenc_cert, kenc_certlen, cacert, cacertlen,
 			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 			error_print();
 			return -1;
 		}
 	}
 
-	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen,
+	if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
 		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
 		error_print();
 		return -1;
@@ -1990,6 +2141,20 @@ int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type
 	return 1;
 }
 
+int x509_certs_verify(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result)
+{
+	return x509_certs_verify_ex(certs, certslen, certs_type,
+		rootcerts, rootcertslen, NULL, depth, verify_result);
+}
+
+int x509_certs_verify_tlcp(const uint8_t *certs, size_t certslen, int certs_type,
+	const uint8_t *rootcerts, size_t rootcertslen, int depth, int *verify_result)
+{
+	return x509_certs_verify_tlcp_ex(certs, certslen, certs_type,
+		rootcerts, rootcertslen, NULL, depth, verify_result);
+}
+
 int x509_certs_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen)
 {
 	const uint8_t *p;
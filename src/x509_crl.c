@@ -194,18 +194,16 @@ int x509_crl_entry_ext_critical_check(int oid, int critical)
 
 int x509_crl_entry_ext_to_der(int oid, int critical, const uint8_t *val, size_t vlen, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (vlen == 0) {
 		return 0;
 	}
-	if (x509_crl_entry_ext_id_to_der(oid, NULL, &len) != 1
-		|| asn1_boolean_to_der(critical, NULL, &len) < 0
-		|| asn1_octet_string_to_der(val, vlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_crl_entry_ext_id_to_der(oid, out, outlen) != 1
 		|| asn1_boolean_to_der(critical, out, outlen) < 0
-		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -408,17 +406,15 @@ int x509_crl_entry_exts_to_der(
 	int reason, time_t invalid_date, const uint8_t *cert_issuer, size_t cert_issuer_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (reason == -1 && invalid_date == -1 && cert_issuer_len == 0) {
 		return 0;
 	}
-	if (x509_crl_reason_ext_to_der(-1, reason, NULL, &len) < 0
-		|| x509_invalidity_date_ext_to_der(-1, invalid_date, NULL, &len) < 0
-		|| x509_cert_issuer_ext_to_der(X509_critical, cert_issuer, cert_issuer_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_crl_reason_ext_to_der(-1, reason, out, outlen) < 0
 		|| x509_invalidity_date_ext_to_der(-1, invalid_date, out, outlen) < 0
-		|| x509_cert_issuer_ext_to_der(X509_critical, cert_issuer, cert_issuer_len, out, outlen) < 0) {
+		|| x509_cert_issuer_ext_to_der(X509_critical, cert_issuer, cert_issuer_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -521,17 +517,15 @@ int x509_revoked_cert_to_der(
 	const uint8_t *crl_entry_exts, size_t crl_entry_exts_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (serial_len == 0 && revoke_date == -1 && crl_entry_exts_len == 0) {
 		return 0;
 	}
-	if (asn1_integer_to_der(serial, serial_len, NULL, &len) != 1
-		|| asn1_generalized_time_to_der(revoke_date, NULL, &len) != 1
-		|| asn1_sequence_to_der(crl_entry_exts, crl_entry_exts_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_integer_to_der(serial, serial_len, out, outlen) != 1
 		|| asn1_generalized_time_to_der(revoke_date, out, outlen) != 1
-		|| asn1_sequence_to_der(crl_entry_exts, crl_entry_exts_len, out, outlen) < 0) {
+		|| asn1_sequence_to_der(crl_entry_exts, crl_entry_exts_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -543,18 +537,16 @@ int x509_revoked_cert_to_der_ex(
 	int reason, time_t invalid_date, const uint8_t *cert_issuer, size_t cert_issuer_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (serial_len ==0 && revoke_date == -1
 		&& reason == -1 && invalid_date == -1 && cert_issuer_len == 0) {
 		return 0;
 	}
-	if (asn1_integer_to_der(serial, serial_len, NULL, &len) != 1
-		|| asn1_generalized_time_to_der(revoke_date, NULL, &len) != 1
-		|| x509_crl_entry_exts_to_der(reason, invalid_date, cert_issuer, cert_issuer_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_integer_to_der(serial, serial_len, out, outlen) != 1
 		|| asn1_generalized_time_to_der(revoke_date, out, outlen) != 1
-		|| x509_crl_entry_exts_to_der(reason, invalid_date, cert_issuer, cert_issuer_len, out, outlen) < 0) {
+		|| x509_crl_entry_exts_to_der(reason, invalid_date, cert_issuer, cert_issuer_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -601,7 +593,7 @@ int x509_revoked_cert_from_der_ex(
 	}
 	if (asn1_integer_from_der(serial, serial_len, &d, &dlen) != 1
 		|| x509_time_from_der(revoke_date, &d, &dlen) != 1
-		|| asn1_sequence_from_der(&crl_entry_exts, &crl_entry_exts_len, &d, &dlen) != 1
+		|| asn1_sequence_from_der(&crl_entry_exts, &crl_entry_exts_len, &d, &dlen) < 0
 		|| asn1_length_is_zero(dlen) != 1) {
 		error_print();
 		return -1;
@@ -790,7 +782,7 @@ int x509_issuing_distribution_point_to_der(
 	int only_contains_attr_certs,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (dist_point_uri_len == 0
 		&& only_contains_user_certs == -1
 		&& only_contains_ca_certs == -1
@@ -799,19 +791,14 @@ int x509_issuing_distribution_point_to_der(
 		&& only_contains_attr_certs == -1) {
 		return 0;
 	}
-	if (x509_uri_as_explicit_distribution_point_name_to_der(0, dist_point_uri, dist_point_uri_len, NULL, &len) < 0
-		|| asn1_implicit_boolean_to_der(1, only_contains_user_certs, NULL, &len) < 0
-		|| asn1_implicit_boolean_to_der(2, only_contains_ca_certs, NULL, &len) < 0
-		|| asn1_implicit_bits_to_der(3, only_some_reasons, NULL, &len) < 0 // TODO: create a new type, instead of use bits		
-		|| asn1_implicit_boolean_to_der(4, indirect_crl, NULL, &len) < 0
-		|| asn1_implicit_boolean_to_der(5, only_contains_attr_certs, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_uri_as_explicit_distribution_point_name_to_der(0, dist_point_uri, dist_point_uri_len, out, outlen) < 0
 		|| asn1_implicit_boolean_to_der(1, only_contains_user_certs, out, outlen) < 0
 		|| asn1_implicit_boolean_to_der(2, only_contains_ca_certs, out, outlen) < 0
 		|| asn1_implicit_bits_to_der(3, only_some_reasons, out, outlen) < 0 // TODO: create a new type, instead of use bits              
 		|| asn1_implicit_boolean_to_der(4, indirect_crl, out, outlen) < 0
-		|| asn1_implicit_boolean_to_der(5, only_contains_attr_certs, out, outlen) < 0) {
+		|| asn1_implicit_boolean_to_der(5, only_contains_attr_certs, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -924,18 +911,16 @@ int x509_crl_ext_critical_check(int oid, int critical)
 int x509_crl_ext_to_der(int oid, int critical, const uint8_t *val, size_t vlen,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (vlen == 0) {
 		return 0;
 	}
-	if (x509_crl_ext_id_to_der(oid, NULL, &len) != 1
-		|| asn1_boolean_to_der(critical, NULL, &len) < 0
-		|| asn1_octet_string_to_der(val, vlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_crl_ext_id_to_der(oid, out, outlen) != 1
 		|| asn1_boolean_to_der(critical, out, outlen) < 0
-		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1219,7 +1204,8 @@ int x509_crl_exts_check(const uint8_t *d, size_t dlen)
 			error_print();
 			return -1;
 		}
-		if (critical == X509_critical) {
+		// the DeltaCRLIndicator is processed by x509_crl_index_add_delta
+		if (critical == X509_critical && oid != OID_ce_delta_crl_indicator) {
 			error_print();
 			return -1;
 		}
@@ -1245,6 +1231,45 @@ int x509_crl_exts_print(FILE *fp, int fmt, int ind, const char *label, const uin
 	return 1;
 }
 
+int x509_crl_exts_get_crl_number(const uint8_t *d, size_t dlen, int *crl_number, int *delta_crl_indicator)
+{
+	int oid;
+	uint32_t nodes[32];
+	size_t nodes_cnt;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+	int num;
+
+	if (!crl_number || !delta_crl_indicator) {
+		error_print();
+		return -1;
+	}
+	*crl_number = -1;
+	*delta_crl_indicator = -1;
+
+	while (dlen) {
+		if (x509_crl_ext_from_der_ex(&oid, nodes, &nodes_cnt, &critical, &val, &vlen, &d, &dlen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (oid != OID_ce_crl_number && oid != OID_ce_delta_crl_indicator) {
+			continue;
+		}
+		if (asn1_int_from_der(&num, &val, &vlen) != 1
+			|| asn1_length_is_zero(vlen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (oid == OID_ce_crl_number) {
+			*crl_number = num;
+		} else {
+			*delta_crl_indicator = num;
+		}
+	}
+	return 1;
+}
+
 int x509_tbs_crl_to_der(
 	int version,
 	int signature_algor,
@@ -1254,22 +1279,16 @@ int x509_tbs_crl_to_der(
 	const uint8_t *exts, size_t exts_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_int_to_der(version, NULL, &len) < 0
-		|| x509_signature_algor_to_der(signature_algor, NULL, &len) != 1
-		|| x509_name_to_der(issuer, issuer_len, NULL, &len) != 1
-		|| x509_time_to_der(this_update, NULL, &len) != 1
-		|| x509_time_to_der(next_update, NULL, &len) < 0
-		|| asn1_sequence_to_der(revoked_certs, revoked_certs_len, NULL, &len) < 0
-		|| x509_explicit_exts_to_der(0, exts, exts_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) < 0
 		|| x509_signature_algor_to_der(signature_algor, out, outlen) != 1
 		|| x509_name_to_der(issuer, issuer_len, out, outlen) != 1
 		|| x509_time_to_der(this_update, out, outlen) != 1
 		|| x509_time_to_der(next_update, out, outlen) < 0
 		|| asn1_sequence_to_der(revoked_certs, revoked_certs_len, out, outlen) < 0
-		|| x509_explicit_exts_to_der(0, exts, exts_len, out, outlen) < 0) {
+		|| x509_explicit_exts_to_der(0, exts, exts_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1399,6 +1418,34 @@ int x509_crl_from_der(const uint8_t **a, size_t *alen, const uint8_t **in, size_
 	return 1;
 }
 
+int x509_crl_to_pem(const uint8_t *a, size_t alen, FILE *fp)
+{
+	if (x509_crl_get_issuer(a, alen, NULL, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	if (pem_write(fp, "X509 CRL", a, alen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_crl_from_pem(uint8_t *a, size_t *alen, size_t maxlen, FILE *fp)
+{
+	int ret;
+	if ((ret = pem_read(fp, "X509 CRL", a, alen, maxlen)) != 1) {
+		if (ret < 0) error_print();
+		else *alen = 0;
+		return ret;
+	}
+	if (x509_crl_get_issuer(a, *alen, NULL, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
 int x509_crl_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *a, size_t alen)
 {
 	const uint8_t *d;
@@ -1678,6 +1725,520 @@ int x509_crl_find_revoked_cert_by_serial_number(const uint8_t *a, size_t alen,
 	return ret;
 }
 
+int x509_crl_get_crl_number(const uint8_t *a, size_t alen, int *crl_number, int *delta_crl_indicator)
+{
+	const uint8_t *exts;
+	size_t exts_len;
+
+	if (x509_crl_get_details(a, alen,
+		NULL, // version
+		NULL, // inner_sig_alg
+		NULL, NULL, // issuer, issuer_len
+		NULL, NULL, // this_update, next_update
+		NULL, NULL, // revoked_certs, revoked_certs_len
+		&exts, &exts_len,
+		NULL, NULL, NULL // sig_alg, sig, siglen
+		) != 1
+		|| x509_crl_exts_get_crl_number(exts, exts_len, crl_number, delta_crl_indicator) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int crl_index_entry_cmp(const void *a, const void *b)
+{
+	const X509_CRL_INDEX_ENTRY *x = (const X509_CRL_INDEX_ENTRY *)a;
+	const X509_CRL_INDEX_ENTRY *y = (const X509_CRL_INDEX_ENTRY *)b;
+
+	// DER integers are minimal, equal values have equal lengths
+	if (x->serial_len != y->serial_len) {
+		return x->serial_len < y->serial_len ? -1 : 1;
+	}
+	return memcmp(x->serial, y->serial, x->serial_len);
+}
+
+// parse a list of RevokedCertificate into a new array of `*cnt` entries
+static int crl_index_entries_new(const uint8_t *d, size_t dlen,
+	X509_CRL_INDEX_ENTRY **entries, size_t *cnt)
+{
+	const uint8_t *p;
+	size_t len;
+	const uint8_t *serial;
+	size_t serial_len;
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+	size_t i;
+
+	*entries = NULL;
+	*cnt = 0;
+
+	// size the array with one pass over the TLVs
+	p = d;
+	len = dlen;
+	while (len) {
+		if (asn1_any_from_der(&serial, &serial_len, &p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		(*cnt)++;
+	}
+	if (!*cnt) {
+		return 1;
+	}
+	if (!(*entries = (X509_CRL_INDEX_ENTRY *)malloc(sizeof(X509_CRL_INDEX_ENTRY) * (*cnt)))) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < *cnt; i++) {
+		const uint8_t *entry = d;
+		size_t entry_len = dlen;
+
+		if (x509_revoked_cert_from_der(&serial, &serial_len, &revoke_date,
+			&exts, &exts_len, &d, &dlen) != 1) {
+			error_print();
+			free(*entries);
+			*entries = NULL;
+			return -1;
+		}
+		(*entries)[i].serial = serial;
+		(*entries)[i].serial_len = serial_len;
+		(*entries)[i].revoked_cert = entry;
+		(*entries)[i].revoked_cert_len = entry_len - dlen;
+	}
+	return 1;
+}
+
+// sort unless sorted already, as lists from X509_CRL_BUILDER are
+static void crl_index_entries_sort(X509_CRL_INDEX_ENTRY *entries, size_t cnt)
+{
+	size_t i;
+
+	for (i = 1; i < cnt; i++) {
+		if (crl_index_entry_cmp(&entries[i - 1], &entries[i]) > 0) {
+			qsort(entries, cnt, sizeof(X509_CRL_INDEX_ENTRY), crl_index_entry_cmp);
+			return;
+		}
+	}
+}
+
+static int crl_builder_reserve(X509_CRL_BUILDER *builder, size_t len, size_t cnt)
+{
+	size_t maxlen;
+
+	if (builder->revoked_certs_len + len > builder->revoked_certs_maxlen) {
+		uint8_t *buf;
+
+		maxlen = builder->revoked_certs_maxlen ? builder->revoked_certs_maxlen * 2 : 4096;
+		if (maxlen < builder->revoked_certs_len + len) {
+			maxlen = builder->revoked_certs_len + len;
+		}
+		if (!(buf = (uint8_t *)realloc(builder->revoked_certs, maxlen))) {
+			error_print();
+			return -1;
+		}
+		builder->revoked_certs = buf;
+		builder->revoked_certs_maxlen = maxlen;
+	}
+	if (builder->entries_cnt + cnt > builder->entries_maxcnt) {
+		size_t *offsets;
+
+		maxlen = builder->entries_maxcnt ? builder->entries_maxcnt * 2 : 64;
+		if (maxlen < builder->entries_cnt + cnt) {
+			maxlen = builder->entries_cnt + cnt;
+		}
+		if (!(offsets = (size_t *)realloc(builder->offsets, sizeof(size_t) * maxlen))) {
+			error_print();
+			return -1;
+		}
+		builder->offsets = offsets;
+		builder->entries_maxcnt = maxlen;
+	}
+	return 1;
+}
+
+int x509_crl_builder_init(X509_CRL_BUILDER *builder, const uint8_t *revoked_certs, size_t revoked_certs_len)
+{
+	X509_CRL_INDEX_ENTRY *entries = NULL;
+	size_t cnt;
+	size_t i;
+
+	if (!builder || (revoked_certs_len && !revoked_certs)) {
+		error_print();
+		return -1;
+	}
+	memset(builder, 0, sizeof(*builder));
+	if (!revoked_certs_len) {
+		return 1;
+	}
+
+	if (crl_index_entries_new(revoked_certs, revoked_certs_len, &entries, &cnt) != 1) {
+		error_print();
+		return -1;
+	}
+	crl_index_entries_sort(entries, cnt);
+	for (i = 1; i < cnt; i++) {
+		if (crl_index_entry_cmp(&entries[i - 1], &entries[i]) == 0) {
+			error_print();
+			goto err;
+		}
+	}
+	if (crl_builder_reserve(builder, revoked_certs_len, cnt) != 1) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < cnt; i++) {
+		builder->offsets[i] = builder->revoked_certs_len;
+		memcpy(builder->revoked_certs + builder->revoked_certs_len,
+			entries[i].revoked_cert, entries[i].revoked_cert_len);
+		builder->revoked_certs_len += entries[i].revoked_cert_len;
+	}
+	builder->entries_cnt = cnt;
+	free(entries);
+	return 1;
+
+err:
+	free(entries);
+	x509_crl_builder_cleanup(builder);
+	return -1;
+}
+
+static int crl_builder_get_entry(const X509_CRL_BUILDER *builder, size_t i, X509_CRL_INDEX_ENTRY *entry)
+{
+	const uint8_t *d = builder->revoked_certs + builder->offsets[i];
+	size_t dlen = (i + 1 < builder->entries_cnt ? builder->offsets[i + 1] : builder->revoked_certs_len)
+		- builder->offsets[i];
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+
+	entry->revoked_cert = d;
+	entry->revoked_cert_len = dlen;
+	if (x509_revoked_cert_from_der(&entry->serial, &entry->serial_len, &revoke_date,
+		&exts, &exts_len, &d, &dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_crl_builder_add_revoked_cert(X509_CRL_BUILDER *builder, const uint8_t *revoked_cert, size_t revoked_cert_len)
+{
+	X509_CRL_INDEX_ENTRY key;
+	X509_CRL_INDEX_ENTRY entry;
+	const uint8_t *d = revoked_cert;
+	size_t dlen = revoked_cert_len;
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+	size_t lo, hi, mid;
+	size_t offset;
+	size_t i;
+	int cmp;
+
+	if (!builder || !revoked_cert || !revoked_cert_len) {
+		error_print();
+		return -1;
+	}
+	if (x509_revoked_cert_from_der(&key.serial, &key.serial_len, &revoke_date,
+			&exts, &exts_len, &d, &dlen) != 1
+		|| asn1_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// serial numbers mostly increase, try the end first
+	lo = 0;
+	hi = builder->entries_cnt;
+	if (hi) {
+		if (crl_builder_get_entry(builder, hi - 1, &entry) != 1) {
+			error_print();
+			return -1;
+		}
+		if ((cmp = crl_index_entry_cmp(&entry, &key)) == 0) {
+			return 0;
+		}
+		if (cmp < 0) {
+			lo = hi;
+		}
+	}
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;
+		if (crl_builder_get_entry(builder, mid, &entry) != 1) {
+			error_print();
+			return -1;
+		}
+		if ((cmp = crl_index_entry_cmp(&entry, &key)) == 0) {
+			return 0;
+		}
+		if (cmp < 0) {
+			lo = mid + 1;
+		} else {
+			hi = mid;
+		}
+	}
+
+	if (crl_builder_reserve(builder, revoked_cert_len, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	offset = lo < builder->entries_cnt ? builder->offsets[lo] : builder->revoked_certs_len;
+	memmove(builder->revoked_certs + offset + revoked_cert_len, builder->revoked_certs + offset,
+		builder->revoked_certs_len - offset);
+	memcpy(builder->revoked_certs + offset, revoked_cert, revoked_cert_len);
+	builder->revoked_certs_len += revoked_cert_len;
+
+	for (i = builder->entries_cnt; i > lo; i--) {
+		builder->offsets[i] = builder->offsets[i - 1] + revoked_cert_len;
+	}
+	builder->offsets[lo] = offset;
+	builder->entries_cnt++;
+	return 1;
+}
+
+void x509_crl_builder_cleanup(X509_CRL_BUILDER *builder)
+{
+	if (builder) {
+		free(builder->revoked_certs);
+		free(builder->offsets);
+		memset(builder, 0, sizeof(*builder));
+	}
+}
+
+int x509_crl_index_init(X509_CRL_INDEX *index, const uint8_t *crl, size_t crl_len)
+{
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *exts;
+	size_t exts_len;
+	int delta_crl_indicator;
+
+	if (!index || !crl || !crl_len) {
+		error_print();
+		return -1;
+	}
+	memset(index, 0, sizeof(*index));
+
+	if (x509_crl_get_details(crl, crl_len,
+		NULL, // version
+		NULL, // inner_sig_alg
+		&index->issuer, &index->issuer_len,
+		NULL, NULL, // this_update, next_update
+		&d, &dlen, // revoked_certs, revoked_certs_len
+		&exts, &exts_len,
+		NULL, NULL, NULL // sig_alg, sig, siglen
+		) != 1
+		|| x509_crl_exts_get_crl_number(exts, exts_len, &index->crl_number, &delta_crl_indicator) != 1) {
+		error_print();
+		return -1;
+	}
+	index->delta_crl_number = -1;
+
+	if (crl_index_entries_new(d, dlen, &index->entries, &index->entries_cnt) != 1) {
+		error_print();
+		return -1;
+	}
+	crl_index_entries_sort(index->entries, index->entries_cnt);
+
+	index->crl = crl;
+	index->crl_len = crl_len;
+	return 1;
+}
+
+int x509_crl_index_add_delta(X509_CRL_INDEX *index, const uint8_t *delta_crl, size_t delta_crl_len)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *exts;
+	size_t exts_len;
+	int crl_number;
+	int base_crl_number;
+	X509_CRL_INDEX_ENTRY *delta_entries = NULL;
+	size_t delta_cnt;
+	X509_CRL_INDEX_ENTRY *entries = NULL;
+	size_t cnt = 0;
+	size_t i = 0, j = 0;
+	int cmp;
+
+	if (!index || !index->crl || !delta_crl || !delta_crl_len) {
+		error_print();
+		return -1;
+	}
+	if (index->delta_crl) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_get_details(delta_crl, delta_crl_len,
+		NULL, // version
+		NULL, // inner_sig_alg
+		&issuer, &issuer_len,
+		NULL, NULL, // this_update, next_update
+		&d, &dlen, // revoked_certs, revoked_certs_len
+		&exts, &exts_len,
+		NULL, NULL, NULL // sig_alg, sig, siglen
+		) != 1
+		|| x509_crl_exts_get_crl_number(exts, exts_len, &crl_number, &base_crl_number) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_name_equ(issuer, issuer_len, index->issuer, index->issuer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	// a delta is issued after the complete CRL it is based on or a former one
+	if (base_crl_number < 0 || index->crl_number < base_crl_number
+		|| crl_number <= index->crl_number) {
+		error_print();
+		return -1;
+	}
+
+	if (crl_index_entries_new(d, dlen, &delta_entries, &delta_cnt) != 1) {
+		error_print();
+		return -1;
+	}
+	crl_index_entries_sort(delta_entries, delta_cnt);
+	if (index->entries_cnt + delta_cnt
+		&& !(entries = (X509_CRL_INDEX_ENTRY *)malloc(sizeof(X509_CRL_INDEX_ENTRY) * (index->entries_cnt + delta_cnt)))) {
+		error_print();
+		free(delta_entries);
+		return -1;
+	}
+
+	// merge the sorted lists, the delta wins
+	while (i < index->entries_cnt || j < delta_cnt) {
+		const uint8_t *sn;
+		size_t sn_len;
+		time_t revoke_date;
+		int reason;
+		time_t invalid_date;
+		const uint8_t *cert_issuer;
+		size_t cert_issuer_len;
+
+		if (j == delta_cnt) {
+			cmp = -1;
+		} else if (i == index->entries_cnt) {
+			cmp = 1;
+		} else {
+			cmp = crl_index_entry_cmp(&index->entries[i], &delta_entries[j]);
+		}
+		if (cmp < 0) {
+			entries[cnt++] = index->entries[i++];
+			continue;
+		}
+		if (cmp == 0) {
+			i++;
+		}
+
+		d = delta_entries[j].revoked_cert;
+		dlen = delta_entries[j].revoked_cert_len;
+		if (x509_revoked_cert_from_der_ex(&sn, &sn_len, &revoke_date,
+			&reason, &invalid_date, &cert_issuer, &cert_issuer_len, &d, &dlen) != 1) {
+			error_print();
+			free(entries);
+			free(delta_entries);
+			return -1;
+		}
+		if (reason != X509_cr_remove_from_crl) {
+			entries[cnt++] = delta_entries[j];
+		}
+		j++;
+	}
+	free(delta_entries);
+
+	if (index->entries) {
+		free(index->entries);
+	}
+	index->entries = entries;
+	index->entries_cnt = cnt;
+	index->delta_crl = delta_crl;
+	index->delta_crl_len = delta_crl_len;
+	index->delta_crl_number = crl_number;
+	return 1;
+}
+
+int x509_crl_index_find_revoked_cert_by_serial_number(const X509_CRL_INDEX *index,
+	const uint8_t *serial, size_t serial_len, time_t *revoke_date,
+	const uint8_t **crl_entry_exts, size_t *crl_entry_exts_len)
+{
+	X509_CRL_INDEX_ENTRY key;
+	const X509_CRL_INDEX_ENTRY *found;
+	const uint8_t *sn;
+	size_t sn_len;
+	const uint8_t *d;
+	size_t dlen;
+
+	if (!index || !serial || !serial_len || !revoke_date || !crl_entry_exts || !crl_entry_exts_len) {
+		error_print();
+		return -1;
+	}
+
+	key.serial = serial;
+	key.serial_len = serial_len;
+	if (!index->entries_cnt
+		|| !(found = (const X509_CRL_INDEX_ENTRY *)bsearch(&key, index->entries, index->entries_cnt,
+			sizeof(X509_CRL_INDEX_ENTRY), crl_index_entry_cmp))) {
+		*revoke_date = -1;
+		*crl_entry_exts = NULL;
+		*crl_entry_exts_len = 0;
+		return 0;
+	}
+
+	d = found->revoked_cert;
+	dlen = found->revoked_cert_len;
+	if (x509_revoked_cert_from_der(&sn, &sn_len, revoke_date,
+		crl_entry_exts, crl_entry_exts_len, &d, &dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// return -1 if the certificate is revoked or not covered by this CRL
+int x509_cert_check_crl_index(const uint8_t *cert, size_t certlen, const X509_CRL_INDEX *index)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	time_t revoke_date;
+	const uint8_t *crl_entry_exts;
+	size_t crl_entry_exts_len;
+	int ret;
+
+	if (!cert || !certlen || !index || !index->crl) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_get_issuer_and_serial_number(cert, certlen, &issuer, &issuer_len, &serial, &serial_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_name_equ(issuer, issuer_len, index->issuer, index->issuer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((ret = x509_crl_index_find_revoked_cert_by_serial_number(index, serial, serial_len,
+		&revoke_date, &crl_entry_exts, &crl_entry_exts_len)) != 0) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+void x509_crl_index_cleanup(X509_CRL_INDEX *index)
+{
+	if (index) {
+		if (index->entries) {
+			free(index->entries);
+		}
+		memset(index, 0, sizeof(*index));
+	}
+}
+
 int x509_crls_print(FILE *fp, int fmt, int ind, const char *label, const uint8_t *d, size_t dlen)
 {
 	const uint8_t *p;
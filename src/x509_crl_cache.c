@@ -0,0 +1,458 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/sm3.h>
+#include <gmssl/http.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK cache_lock = SRWLOCK_INIT;
+#define cache_mutex_lock()	AcquireSRWLockExclusive(&cache_lock)
+#define cache_mutex_unlock()	ReleaseSRWLockExclusive(&cache_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define cache_mutex_lock()	pthread_mutex_lock(&cache_lock)
+#define cache_mutex_unlock()	pthread_mutex_unlock(&cache_lock)
+#endif
+
+
+// immutable once fetched except `verified`, shared by the cache and the callers
+typedef struct {
+	X509_CRL_INDEX index; // must be the first member
+	uint8_t *crl;
+	size_t crl_len;
+	time_t this_update;
+	time_t next_update; // -1 if not present
+	uint8_t cacert_dgst[SM3_DIGEST_SIZE]; // CA certificate the CRL is verified by
+	int verified;
+	int refs;
+} CRL_CACHE_ENTRY;
+
+typedef struct {
+	char *uri; // NULL for a free slot
+	CRL_CACHE_ENTRY *entry;
+	HTTP_VALIDATORS validators;
+	time_t expires;
+	time_t refresh_at;
+	time_t last_fetch;
+	int refreshing;
+	uint64_t used;
+} CRL_CACHE_SLOT;
+
+static CRL_CACHE_SLOT cache[X509_CRL_CACHE_SIZE];
+static uint64_t cache_clock = 0;
+static size_t cache_hits = 0;
+static size_t cache_misses = 0;
+static size_t cache_refreshes = 0;
+static int cache_disabled = 0;
+static int cache_retry_seconds = X509_CRL_CACHE_RETRY_SECONDS;
+
+
+static void crl_cache_entry_free(CRL_CACHE_ENTRY *entry)
+{
+	x509_crl_index_cleanup(&entry->index);
+	free(entry->crl);
+	free(entry);
+}
+
+// with the lock held
+static void crl_cache_entry_unref(CRL_CACHE_ENTRY *entry)
+{
+	if (entry && --entry->refs == 0) {
+		crl_cache_entry_free(entry);
+	}
+}
+
+// return 1 with a new entry, 0 if not modified since `validators`
+static int crl_cache_fetch(const char *uri, HTTP_VALIDATORS *validators, CRL_CACHE_ENTRY **out)
+{
+	CRL_CACHE_ENTRY *entry;
+	uint8_t *buf = NULL;
+	size_t buflen;
+	const uint8_t *p;
+	size_t len;
+	const uint8_t *crl;
+	size_t crl_len;
+	int ret;
+
+	if ((ret = http_get_new(uri, validators, &buf, &buflen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	p = buf;
+	len = buflen;
+	if (x509_crl_from_der(&crl, &crl_len, &p, &len) != 1
+		|| len != 0) {
+		error_print();
+		free(buf);
+		return -1;
+	}
+	if (!(entry = (CRL_CACHE_ENTRY *)calloc(1, sizeof(CRL_CACHE_ENTRY)))) {
+		error_print();
+		free(buf);
+		return -1;
+	}
+	entry->crl = buf;
+	entry->crl_len = buflen;
+	if (x509_crl_get_details(entry->crl, entry->crl_len, NULL, NULL, NULL, NULL,
+			&entry->this_update, &entry->next_update,
+			NULL, NULL, NULL, NULL, NULL, NULL, NULL) != 1
+		|| x509_crl_index_init(&entry->index, entry->crl, entry->crl_len) != 1) {
+		error_print();
+		crl_cache_entry_free(entry);
+		return -1;
+	}
+	entry->refs = 1;
+	*out = entry;
+	return 1;
+}
+
+// with the lock held
+static CRL_CACHE_SLOT *crl_cache_find(const char *uri)
+{
+	int i;
+	for (i = 0; i < X509_CRL_CACHE_SIZE; i++) {
+		if (cache[i].uri && strcmp(cache[i].uri, uri) == 0) {
+			return &cache[i];
+		}
+	}
+	return NULL;
+}
+
+// with the lock held, the refresh starts in the last quarter of the lifetime
+static void crl_cache_slot_set_times(CRL_CACHE_SLOT *slot, time_t now)
+{
+	time_t begin;
+
+	if (slot->entry->next_update >= 0) {
+		begin = slot->entry->this_update;
+		slot->expires = slot->entry->next_update;
+	} else {
+		begin = now;
+		slot->expires = now + X509_CRL_CACHE_TTL;
+	}
+	slot->refresh_at = begin < slot->expires ? slot->expires - (slot->expires - begin)/4 : slot->expires;
+}
+
+// with the lock held, the cache takes a reference of `entry`
+static int crl_cache_install(const char *uri, CRL_CACHE_ENTRY *entry,
+	const HTTP_VALIDATORS *validators, time_t now)
+{
+	CRL_CACHE_SLOT *slot;
+	int i;
+
+	if (!(slot = crl_cache_find(uri))) {
+		slot = &cache[0];
+		for (i = 0; i < X509_CRL_CACHE_SIZE; i++) {
+			if (!cache[i].uri) {
+				slot = &cache[i];
+				break;
+			}
+			// a slot being refreshed in the background is kept
+			if (!cache[i].refreshing && (slot->refreshing || cache[i].used < slot->used)) {
+				slot = &cache[i];
+			}
+		}
+		if (slot->refreshing) {
+			return 0;
+		}
+		if (slot->uri) {
+			free(slot->uri);
+			crl_cache_entry_unref(slot->entry);
+		}
+		memset(slot, 0, sizeof(CRL_CACHE_SLOT));
+		if (!(slot->uri = strdup(uri))) {
+			error_print();
+			return -1;
+		}
+	} else {
+		crl_cache_entry_unref(slot->entry);
+	}
+	entry->refs++;
+	slot->entry = entry;
+	slot->validators = *validators;
+	slot->last_fetch = now;
+	slot->used = ++cache_clock;
+	crl_cache_slot_set_times(slot, now);
+	return 1;
+}
+
+typedef struct {
+	char *uri;
+	HTTP_VALIDATORS validators;
+} CRL_CACHE_REFRESH;
+
+static void crl_cache_refresh(CRL_CACHE_REFRESH *refresh)
+{
+	CRL_CACHE_ENTRY *entry = NULL;
+	CRL_CACHE_SLOT *slot;
+	time_t now;
+	int ret;
+
+	ret = crl_cache_fetch(refresh->uri, &refresh->validators, &entry);
+	time(&now);
+
+	cache_mutex_lock();
+	if ((slot = crl_cache_find(refresh->uri)) != NULL) {
+		slot->refreshing = 0;
+		if (ret == 1) {
+			crl_cache_install(refresh->uri, entry, &refresh->validators, now);
+		} else if (ret == 0 && slot->entry) {
+			crl_cache_slot_set_times(slot, now);
+		}
+	}
+	if (ret >= 0) {
+		cache_refreshes++;
+	}
+	if (entry) {
+		crl_cache_entry_unref(entry);
+	}
+	cache_mutex_unlock();
+
+	free(refresh->uri);
+	free(refresh);
+}
+
+#ifdef _WIN32
+static DWORD WINAPI crl_cache_refresh_thread(LPVOID arg)
+{
+	crl_cache_refresh((CRL_CACHE_REFRESH *)arg);
+	return 0;
+}
+
+static int crl_cache_refresh_start(CRL_CACHE_REFRESH *refresh)
+{
+	HANDLE thread;
+	if (!(thread = CreateThread(NULL, 0, crl_cache_refresh_thread, refresh, 0, NULL))) {
+		return -1;
+	}
+	CloseHandle(thread);
+	return 1;
+}
+#else
+static void *crl_cache_refresh_thread(void *arg)
+{
+	crl_cache_refresh((CRL_CACHE_REFRESH *)arg);
+	return NULL;
+}
+
+static int crl_cache_refresh_start(CRL_CACHE_REFRESH *refresh)
+{
+	pthread_t thread;
+	if (pthread_create(&thread, NULL, crl_cache_refresh_thread, refresh) != 0) {
+		return -1;
+	}
+	pthread_detach(thread);
+	return 1;
+}
+#endif
+
+// with the lock held, a failure is left to the next lookup after cache_retry_seconds
+static void crl_cache_slot_refresh(CRL_CACHE_SLOT *slot, time_t now)
+{
+	CRL_CACHE_REFRESH *refresh;
+
+	slot->last_fetch = now;
+	if (!(refresh = (CRL_CACHE_REFRESH *)malloc(sizeof(CRL_CACHE_REFRESH)))) {
+		return;
+	}
+	if (!(refresh->uri = strdup(slot->uri))) {
+		free(refresh);
+		return;
+	}
+	refresh->validators = slot->validators;
+	if (crl_cache_refresh_start(refresh) != 1) {
+		error_print();
+		free(refresh->uri);
+		free(refresh);
+		return;
+	}
+	slot->refreshing = 1;
+}
+
+int x509_crl_cache_get(const char *uri, size_t urilen, const X509_CRL_INDEX **index)
+{
+	int ret = -1;
+	char *uristr = NULL;
+	CRL_CACHE_SLOT *slot;
+	CRL_CACHE_ENTRY *entry = NULL;
+	HTTP_VALIDATORS validators;
+	time_t now;
+
+	if (!uri || !urilen || !index) {
+		error_print();
+		return -1;
+	}
+	if (!(uristr = (char *)malloc(urilen + 1))) {
+		error_print();
+		return -1;
+	}
+	memcpy(uristr, uri, urilen);
+	uristr[urilen] = 0;
+	memset(&validators, 0, sizeof(validators));
+	time(&now);
+
+	cache_mutex_lock();
+	if (!cache_disabled && (slot = crl_cache_find(uristr)) != NULL && slot->entry) {
+		if (now < slot->expires) {
+			if (now >= slot->refresh_at && !slot->refreshing
+				&& now - slot->last_fetch >= cache_retry_seconds) {
+				crl_cache_slot_refresh(slot, now);
+			}
+			slot->used = ++cache_clock;
+			slot->entry->refs++;
+			*index = &slot->entry->index;
+			cache_hits++;
+			cache_mutex_unlock();
+			free(uristr);
+			return 1;
+		}
+		validators = slot->validators;
+	}
+	if (!cache_disabled) {
+		cache_misses++;
+	}
+	cache_mutex_unlock();
+
+	if ((ret = crl_cache_fetch(uristr, &validators, &entry)) == 0) {
+		// not modified, the expired entry is still the latest CRL
+		cache_mutex_lock();
+		if ((slot = crl_cache_find(uristr)) != NULL && slot->entry) {
+			crl_cache_slot_set_times(slot, now);
+			slot->last_fetch = now;
+			slot->entry->refs++;
+			*index = &slot->entry->index;
+			ret = 1;
+		}
+		cache_mutex_unlock();
+		if (ret == 0) {
+			memset(&validators, 0, sizeof(validators));
+			ret = crl_cache_fetch(uristr, &validators, &entry);
+		}
+	}
+	if (ret < 0) {
+		error_print();
+		goto end;
+	}
+	if (entry) {
+		cache_mutex_lock();
+		if (!cache_disabled) {
+			crl_cache_install(uristr, entry, &validators, now);
+		}
+		cache_mutex_unlock();
+		*index = &entry->index;
+	}
+	ret = 1;
+end:
+	free(uristr);
+	return ret;
+}
+
+void x509_crl_cache_put(const X509_CRL_INDEX *index)
+{
+	if (index) {
+		cache_mutex_lock();
+		crl_cache_entry_unref((CRL_CACHE_ENTRY *)index);
+		cache_mutex_unlock();
+	}
+}
+
+int x509_crl_cache_verify_by_ca_cert(const X509_CRL_INDEX *index, const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len)
+{
+	CRL_CACHE_ENTRY *entry = (CRL_CACHE_ENTRY *)index;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	SM3_CTX sm3_ctx;
+	int verified;
+
+	if (!index || !cacert || !cacertlen || !signer_id) {
+		error_print();
+		return -1;
+	}
+
+	// the kept result is for the default ID only
+	if (signer_id_len != SM2_DEFAULT_ID_LENGTH || memcmp(signer_id, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 0) {
+		return x509_crl_verify_by_ca_cert(entry->crl, entry->crl_len, cacert, cacertlen, signer_id, signer_id_len);
+	}
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, cacert, cacertlen);
+	sm3_finish(&sm3_ctx, dgst);
+
+	cache_mutex_lock();
+	verified = entry->verified && memcmp(entry->cacert_dgst, dgst, sizeof(dgst)) == 0;
+	cache_mutex_unlock();
+	if (verified) {
+		return 1;
+	}
+
+	if (x509_crl_verify_by_ca_cert(entry->crl, entry->crl_len, cacert, cacertlen, signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	cache_mutex_lock();
+	memcpy(entry->cacert_dgst, dgst, sizeof(dgst));
+	entry->verified = 1;
+	cache_mutex_unlock();
+	return 1;
+}
+
+// the background refreshes still running find no slot and drop their results
+void x509_crl_cache_clear(void)
+{
+	int i;
+
+	cache_mutex_lock();
+	for (i = 0; i < X509_CRL_CACHE_SIZE; i++) {
+		if (cache[i].uri) {
+			free(cache[i].uri);
+			crl_cache_entry_unref(cache[i].entry);
+		}
+	}
+	memset(cache, 0, sizeof(cache));
+	cache_hits = 0;
+	cache_misses = 0;
+	cache_refreshes = 0;
+	cache_mutex_unlock();
+}
+
+void x509_crl_cache_set_enabled(int enabled)
+{
+	if (!enabled) {
+		x509_crl_cache_clear();
+	}
+	cache_mutex_lock();
+	cache_disabled = enabled ? 0 : 1;
+	cache_mutex_unlock();
+}
+
+void x509_crl_cache_set_retry_seconds(int seconds)
+{
+	cache_mutex_lock();
+	cache_retry_seconds = seconds > 0 ? seconds : 0;
+	cache_mutex_unlock();
+}
+
+void x509_crl_cache_get_stats(size_t *hits, size_t *misses, size_t *refreshes)
+{
+	cache_mutex_lock();
+	if (hits) *hits = cache_hits;
+	if (misses) *misses = cache_misses;
+	if (refreshes) *refreshes = cache_refreshes;
+	cache_mutex_unlock();
+}
@@ -128,18 +128,16 @@ int x509_ext_id_from_der(int *oid, uint32_t *nodes, size_t *nodes_cnt, const uin
 
 int x509_ext_to_der(int oid, int critical, const uint8_t *val, size_t vlen, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (vlen == 0) {
 		return 0;
 	}
-	if (x509_ext_id_to_der(oid, NULL, &len) != 1
-		|| asn1_boolean_to_der(critical, NULL, &len) < 0
-		|| asn1_octet_string_to_der(val, vlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_ext_id_to_der(oid, out, outlen) != 1
 		|| asn1_boolean_to_der(critical, out, outlen) < 0
-		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1) {
+		|| asn1_octet_string_to_der(val, vlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -149,7 +147,7 @@ int x509_ext_to_der(int oid, int critical, const uint8_t *val, size_t vlen, uint
 int x509_ext_to_der_ex(int oid, int critical, const uint8_t *d, size_t dlen, uint8_t **out, size_t *outlen)
 {
 	size_t vlen = 0;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (dlen == 0) {
 		return 0;
@@ -158,17 +156,13 @@ int x509_ext_to_der_ex(int oid, int critical, const uint8_t *d, size_t dlen, uin
 		error_print();
 		return -1;
 	}
-	if (x509_ext_id_to_der(oid, NULL, &len) != 1
-		|| asn1_boolean_to_der(critical, NULL, &len) < 0
-		|| asn1_tag_to_der(ASN1_TAG_OCTET_STRING, NULL, &len) != 1
-		|| asn1_length_to_der(vlen, NULL, &len) != 1
-		|| asn1_sequence_to_der(d, dlen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_ext_id_to_der(oid, out, outlen) != 1
 		|| asn1_boolean_to_der(critical, out, outlen) < 0
 		|| asn1_tag_to_der(ASN1_TAG_OCTET_STRING, out, outlen) != 1
 		|| asn1_length_to_der(vlen, out, outlen) != 1
-		|| asn1_sequence_to_der(d, dlen, out, outlen) != 1) {
+		|| asn1_sequence_to_der(d, dlen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -709,16 +703,15 @@ int x509_other_name_to_der(
 	const uint8_t *value_a, size_t value_alen,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (type_nodes_cnt == 0 && value_alen == 0) {
 		return 0;
 	}
-	if (asn1_object_identifier_to_der(type_nodes, type_nodes_cnt, NULL, &len) != 1
-		|| asn1_explicit_to_der(0, value_a, value_alen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_object_identifier_to_der(type_nodes, type_nodes_cnt, out, outlen) != 1
-		|| asn1_explicit_to_der(0, value_a, value_alen, out, outlen) != 1) {
+		|| asn1_explicit_to_der(0, value_a, value_alen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -773,16 +766,15 @@ int x509_edi_party_name_to_der(
 	int party_name_choice, const uint8_t *party_name, size_t party_name_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (assigner_len == 0 && party_name_len == 0) {
 		return 0;
 	}
-	if (x509_explicit_directory_name_to_der(0, assigner_choice, assigner, assigner_len, NULL, &len) < 0
-		|| x509_explicit_directory_name_to_der(1, party_name_choice, party_name, party_name_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_explicit_directory_name_to_der(0, assigner_choice, assigner, assigner_len, out, outlen) < 0
-		|| x509_explicit_directory_name_to_der(1, party_name_choice, party_name, party_name_len, out, outlen) != 1) {
+		|| x509_explicit_directory_name_to_der(1, party_name_choice, party_name, party_name_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1073,14 +1065,14 @@ int x509_uri_as_general_names_to_der_ex(int tag, const char *uri, size_t urilen,
 	uint8_t **out, size_t *outlen)
 {
 	int choice = X509_gn_uniform_resource_identifier;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (!urilen) {
 		return 0;
 	}
-	if (x509_general_name_to_der(choice, (uint8_t *)uri, urilen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der_ex(tag, len, out, outlen) != 1
-		|| x509_general_name_to_der(choice, (uint8_t *)uri, urilen, out, outlen) != 1) {
+	if (asn1_header_begin(&hdr, tag, out, outlen) != 1
+		|| x509_general_name_to_der(choice, (uint8_t *)uri, urilen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1135,18 +1127,16 @@ int x509_authority_key_identifier_to_der(
 	const uint8_t *serial, size_t serial_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (keyid_len == 0 && issuer_len == 0 && serial_len == 0) {
 		return 0;
 	}
-	if (asn1_implicit_octet_string_to_der(0, keyid, keyid_len, NULL, &len) < 0
-		|| asn1_implicit_sequence_to_der(1, issuer, issuer_len, NULL, &len) < 0
-		|| asn1_implicit_integer_to_der(2, serial, serial_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_implicit_octet_string_to_der(0, keyid, keyid_len, out, outlen) < 0
 		|| asn1_implicit_sequence_to_der(1, issuer, issuer_len, out, outlen) < 0
-		|| asn1_implicit_integer_to_der(2, serial, serial_len, out, outlen) < 0) {
+		|| asn1_implicit_integer_to_der(2, serial, serial_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1393,16 +1383,15 @@ int x509_notice_reference_to_der(
 	const int *notice_numbers, size_t notice_numbers_cnt,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (org_len == 0 && notice_numbers_cnt == 0) {
 		return 0;
 	}
-	if (x509_display_text_to_der(org_tag, org, org_len, NULL, &len) != 1
-		|| asn1_sequence_of_int_to_der(notice_numbers, notice_numbers_cnt, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_display_text_to_der(org_tag, org, org_len, out, outlen) != 1
-		|| asn1_sequence_of_int_to_der(notice_numbers, notice_numbers_cnt, out, outlen) != 1) {
+		|| asn1_sequence_of_int_to_der(notice_numbers, notice_numbers_cnt, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1458,23 +1447,19 @@ int x509_user_notice_to_der(
 	int explicit_text_tag, const uint8_t *explicit_text, size_t explicit_text_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (notice_ref_org_len == 0
 		&& notice_ref_notice_numbers_cnt == 0
 		&& explicit_text_len == 0) {
 		return 0;
 	}
-	if (x509_notice_reference_to_der(
-			notice_ref_org_tag, notice_ref_org, notice_ref_org_len,
-			notice_ref_notice_numbers, notice_ref_notice_numbers_cnt,
-			NULL, &len) < 0
-		|| x509_display_text_to_der(explicit_text_tag, explicit_text, explicit_text_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_notice_reference_to_der(
 			notice_ref_org_tag, notice_ref_org, notice_ref_org_len,
 			notice_ref_notice_numbers, notice_ref_notice_numbers_cnt,
 			out, outlen) < 0
-		|| x509_display_text_to_der(explicit_text_tag, explicit_text, explicit_text_len, out, outlen) < 0) {
+		|| x509_display_text_to_der(explicit_text_tag, explicit_text, explicit_text_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1593,15 +1578,14 @@ int x509_policy_qualifier_info_to_der(
 	const uint8_t *qualifier, size_t qualifier_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (qualifier_len == 0) {
 		return 0;
 	}
-	if (x509_qualifier_id_to_der(oid, NULL, &len) != 1
-		|| asn1_any_to_der(qualifier, qualifier_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_qualifier_id_to_der(oid, out, outlen) != 1
-		|| asn1_any_to_der(qualifier, qualifier_len, out, outlen) != 1) {
+		|| asn1_any_to_der(qualifier, qualifier_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1728,12 +1712,11 @@ int x509_policy_information_to_der(
 	const uint8_t *qualifiers, size_t qualifiers_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_cert_policy_id_to_der(oid, nodes, nodes_cnt, NULL, &len) != 1
-		|| asn1_sequence_to_der(qualifiers, qualifiers_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_cert_policy_id_to_der(oid, nodes, nodes_cnt, out, outlen) != 1
-		|| asn1_sequence_to_der(qualifiers, qualifiers_len, out, outlen) < 0) {
+		|| asn1_sequence_to_der(qualifiers, qualifiers_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1821,19 +1804,16 @@ int x509_policy_mapping_to_der(
 	int subject_policy_oid, const uint32_t *subject_policy_nodes, size_t subject_policy_nodes_cnt,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (issuer_policy_oid == -1 && subject_policy_oid == -1) {
 		return 0;
 	}
-	if (x509_cert_policy_id_to_der(issuer_policy_oid,
-			issuer_policy_nodes, issuer_policy_nodes_cnt, NULL, &len) != 1
-		|| x509_cert_policy_id_to_der(subject_policy_oid,
-			subject_policy_nodes, subject_policy_nodes_cnt, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_cert_policy_id_to_der(issuer_policy_oid,
 			issuer_policy_nodes, issuer_policy_nodes_cnt, out, outlen) != 1
 		|| x509_cert_policy_id_to_der(subject_policy_oid,
-			subject_policy_nodes, subject_policy_nodes_cnt, out, outlen) != 1) {
+			subject_policy_nodes, subject_policy_nodes_cnt, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1907,12 +1887,11 @@ int x509_attribute_to_der(
 	const uint8_t *values, size_t values_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_object_identifier_to_der(nodes, nodes_cnt, NULL, &len) != 1
-		|| asn1_set_to_der(values, values_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_object_identifier_to_der(nodes, nodes_cnt, out, outlen) != 1
-		|| asn1_set_to_der(values, values_len, out, outlen) != 1) {
+		|| asn1_set_to_der(values, values_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -1987,17 +1966,16 @@ int x509_attributes_print(FILE *fp, int fmt, int ind, const char *label, const u
 
 int x509_basic_constraints_to_der(int ca, int path_len_cons, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (ca == -1 && path_len_cons == -1) {
 		error_print();
 		return -1;
 	}
-	if (asn1_boolean_to_der(ca, NULL, &len) < 0
-		|| asn1_int_to_der(path_len_cons, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_boolean_to_der(ca, out, outlen) < 0
-		|| asn1_int_to_der(path_len_cons, out, outlen) < 0) {
+		|| asn1_int_to_der(path_len_cons, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2099,14 +2077,12 @@ int x509_general_subtree_to_der(
 	int maximum,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_general_name_to_der(base_choice, base, base_len, NULL, &len) != 1
-		|| asn1_implicit_int_to_der(0, minimum, NULL, &len) < 0
-		|| asn1_implicit_int_to_der(1, maximum, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_general_name_to_der(base_choice, base, base_len, out, outlen) != 1
 		|| asn1_implicit_int_to_der(0, minimum, out, outlen) < 0
-		|| asn1_implicit_int_to_der(1, maximum, out, outlen) < 0) {
+		|| asn1_implicit_int_to_der(1, maximum, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2191,12 +2167,11 @@ int x509_name_constraints_to_der(
 	const uint8_t *excluded_subtrees, size_t excluded_subtrees_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (asn1_implicit_sequence_to_der(0, permitted_subtrees, permitted_subtrees_len, NULL, &len) < 0
-		|| asn1_implicit_sequence_to_der(1, excluded_subtrees, excluded_subtrees_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_implicit_sequence_to_der(0, permitted_subtrees, permitted_subtrees_len, out, outlen) < 0
-		|| asn1_implicit_sequence_to_der(1, excluded_subtrees, excluded_subtrees_len, out, outlen) < 0) {
+		|| asn1_implicit_sequence_to_der(1, excluded_subtrees, excluded_subtrees_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2254,17 +2229,16 @@ int x509_policy_constraints_to_der(
 	int inhibit_policy_mapping,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (require_explicit_policy == -1 && inhibit_policy_mapping == -1) {
 		error_print();
 		return -1;
 	}
-	if (asn1_implicit_int_to_der(0, require_explicit_policy, NULL, &len) < 0
-		|| asn1_implicit_int_to_der(1, inhibit_policy_mapping, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_implicit_int_to_der(0, require_explicit_policy, out, outlen) < 0
-		|| asn1_implicit_int_to_der(1, inhibit_policy_mapping, out, outlen) < 0) {
+		|| asn1_implicit_int_to_der(1, inhibit_policy_mapping, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2646,14 +2620,14 @@ int x509_distribution_point_name_print(FILE *fp, int fmt, int ind, const char *l
 int x509_uri_as_explicit_distribution_point_name_to_der(int index,
 	const char *uri, size_t urilen, uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (!urilen) {
 		return 0;
 	}
-	if (x509_uri_as_distribution_point_name_to_der(uri, urilen, NULL, &len) != 1
-		|| asn1_explicit_header_to_der(index, len, out, outlen) != 1
-		|| x509_uri_as_distribution_point_name_to_der(uri, urilen, out, outlen) != 1) {
+	if (asn1_explicit_begin(&hdr, index, out, outlen) != 1
+		|| x509_uri_as_distribution_point_name_to_der(uri, urilen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2683,14 +2657,12 @@ int x509_uri_as_distribution_point_to_der(const char *uri, size_t urilen,
 	int reasons, const uint8_t *crl_issuer, size_t crl_issuer_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_uri_as_explicit_distribution_point_name_to_der(0, uri, urilen, NULL, &len) != 1
-		|| x509_revoke_reason_flags_to_der(reasons, NULL, &len) < 0
-		|| x509_general_names_to_der(crl_issuer, crl_issuer_len, NULL, &len) < 0
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_uri_as_explicit_distribution_point_name_to_der(0, uri, urilen, out, outlen) != 1
 		|| x509_revoke_reason_flags_to_der(reasons, out, outlen) < 0
-		|| x509_general_names_to_der(crl_issuer, crl_issuer_len, out, outlen) < 0) {
+		|| x509_general_names_to_der(crl_issuer, crl_issuer_len, out, outlen) < 0
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -2748,10 +2720,10 @@ int x509_uri_as_distribution_points_to_der(const char *uri, size_t urilen,
 	int reasons, const uint8_t *crl_issuer, size_t crl_issuer_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
-	if (x509_uri_as_distribution_point_to_der(uri, urilen, reasons, crl_issuer, crl_issuer_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
-		|| x509_uri_as_distribution_point_to_der(uri, urilen, reasons, crl_issuer, crl_issuer_len, out, outlen) != 1) {
+	ASN1_HEADER hdr;
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| x509_uri_as_distribution_point_to_der(uri, urilen, reasons, crl_issuer, crl_issuer_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -3013,7 +2985,7 @@ int x509_access_method_from_der(int *oid, const uint8_t **in, size_t *inlen)
 int x509_access_description_to_der(int oid, const char *uri, size_t urilen, uint8_t **out, size_t *outlen)
 {
 	const int uri_choice = X509_gn_uniform_resource_identifier;
-	size_t len = 0;
+	ASN1_HEADER hdr;
 
 	if (oid != OID_ad_ocsp && oid != OID_ad_ca_issuers) {
 		error_print();
@@ -3023,11 +2995,10 @@ int x509_access_description_to_der(int oid, const char *uri, size_t urilen, uint
 		error_print();
 		return -1;
 	}
-	if (x509_access_method_to_der(oid, NULL, &len) != 1
-		|| x509_general_name_to_der(uri_choice, (const uint8_t *)uri, urilen, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| x509_access_method_to_der(oid, out, outlen) != 1
-		|| x509_general_name_to_der(uri_choice, (const uint8_t *)uri, urilen, out, outlen) != 1) {
+		|| x509_general_name_to_der(uri_choice, (const uint8_t *)uri, urilen, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
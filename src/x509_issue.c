@@ -0,0 +1,351 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/asn1.h>
+#include <gmssl/x509_alg.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_cer.h>
+#include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
+
+
+
+static int x509_cert_issuer_init_common(X509_CERT_ISSUER *issuer,
+	const uint8_t *issuer_name, size_t issuer_name_len,
+	const uint8_t *exts, size_t exts_len, int subject_key_identifier,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len)
+{
+	uint8_t *p;
+
+	if (!issuer || !issuer_name || !issuer_name_len || !sign_key) {
+		error_print();
+		return -1;
+	}
+	if (issuer_name_len > X509_CERT_ISSUER_MAX_NAME_SIZE
+		|| exts_len > X509_CERT_ISSUER_MAX_EXTS_SIZE
+		|| (exts_len && !exts)) {
+		error_print();
+		return -1;
+	}
+	if (signer_id && (!signer_id_len || signer_id_len > SM2_MAX_ID_LENGTH)) {
+		error_print();
+		return -1;
+	}
+	memset(issuer, 0, sizeof(*issuer));
+
+	p = issuer->alg_and_issuer;
+	if (x509_signature_algor_to_der(OID_sm2sign_with_sm3, &p, &issuer->alg_and_issuer_len) != 1
+		|| asn1_sequence_to_der(issuer_name, issuer_name_len, &p, &issuer->alg_and_issuer_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (exts_len) {
+		memcpy(issuer->exts, exts, exts_len);
+	}
+	issuer->exts_len = exts_len;
+	issuer->subject_key_identifier = subject_key_identifier;
+
+	sm3_init(&issuer->sm3_ctx);
+	if (signer_id) {
+		uint8_t z[SM3_DIGEST_SIZE];
+		sm2_compute_z(z, &sign_key->public_key, signer_id, signer_id_len);
+		sm3_update(&issuer->sm3_ctx, z, sizeof(z));
+	}
+	sm2_fast_sign_compute_key(sign_key, issuer->fast_sign_private);
+	return 1;
+}
+
+int x509_cert_issuer_init(X509_CERT_ISSUER *issuer,
+	const uint8_t *issuer_name, size_t issuer_name_len,
+	const uint8_t *exts, size_t exts_len, int subject_key_identifier,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len)
+{
+	if (x509_cert_issuer_init_common(issuer, issuer_name, issuer_name_len,
+		exts, exts_len, subject_key_identifier,
+		sign_key, signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+#ifdef ENABLE_SM2_SIGN_POOL
+int x509_cert_issuer_init_ex(X509_CERT_ISSUER *issuer,
+	const uint8_t *issuer_name, size_t issuer_name_len,
+	const uint8_t *exts, size_t exts_len, int subject_key_identifier,
+	const SM2_KEY *sign_key, const char *signer_id, size_t signer_id_len,
+	SM2_SIGN_POOL *pool)
+{
+	if (!pool) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_issuer_init_common(issuer, issuer_name, issuer_name_len,
+		exts, exts_len, subject_key_identifier,
+		sign_key, signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	issuer->pool = pool;
+	return 1;
+}
+#endif
+
+void x509_cert_issuer_cleanup(X509_CERT_ISSUER *issuer)
+{
+	if (issuer) {
+		gmssl_secure_clear(issuer, sizeof(*issuer));
+	}
+}
+
+typedef struct {
+	const X509_CERT_ISSUER *issuer;
+	const X509_CERT_ISSUE_ITEM *items;
+	size_t count;
+	uint8_t *certs;
+	size_t maxcertlen;
+	size_t *certlens;
+	SM2_SIGN_PRE_COMP pre_comp[SM2_SIGN_PRE_COMP_COUNT];
+	unsigned int num_pre_comp;
+	int ret;
+} X509_CERT_ISSUE_JOB;
+
+static int x509_cert_issue_sign(X509_CERT_ISSUE_JOB *job, const uint8_t *tbs, size_t tbslen,
+	uint8_t *sig, size_t *siglen)
+{
+	const X509_CERT_ISSUER *issuer = job->issuer;
+	SM3_CTX sm3_ctx = issuer->sm3_ctx;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	SM2_SIGNATURE signature;
+
+	sm3_update(&sm3_ctx, tbs, tbslen);
+	sm3_finish(&sm3_ctx, dgst);
+
+#ifdef ENABLE_SM2_SIGN_POOL
+	if (issuer->pool) {
+		SM2_SIGN_PRE_COMP pre_comp;
+		int ret;
+
+		if (sm2_sign_pool_get(issuer->pool, &pre_comp) != 1) {
+			error_print();
+			return -1;
+		}
+		ret = sm2_fast_sign(issuer->fast_sign_private, &pre_comp, dgst, &signature);
+		gmssl_secure_clear(&pre_comp, sizeof(pre_comp));
+		if (ret != 1) {
+			error_print();
+			return -1;
+		}
+	} else
+#endif
+	{
+		if (job->num_pre_comp == 0) {
+			if (sm2_fast_sign_pre_compute(job->pre_comp) != 1) {
+				error_print();
+				return -1;
+			}
+			job->num_pre_comp = SM2_SIGN_PRE_COMP_COUNT;
+		}
+		job->num_pre_comp--;
+		if (sm2_fast_sign(issuer->fast_sign_private, &job->pre_comp[job->num_pre_comp],
+			dgst, &signature) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	*siglen = 0;
+	if (sm2_signature_to_der(&signature, &sig, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// without output the signature is counted as SM2_MAX_SIGNATURE_SIZE bytes
+static int x509_cert_issue_to_der(X509_CERT_ISSUE_JOB *job, const X509_CERT_ISSUE_ITEM *item,
+	uint8_t **out, size_t *outlen)
+{
+	const X509_CERT_ISSUER *issuer = job->issuer;
+	ASN1_HEADER cert_hdr;
+	ASN1_HEADER tbs_hdr;
+	ASN1_HEADER exts_hdr;
+	ASN1_HEADER exts_seq_hdr;
+	uint8_t *tbs = NULL;
+	uint8_t ski[64];
+	size_t skilen = 0;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen = SM2_MAX_SIGNATURE_SIZE;
+
+	if (issuer->subject_key_identifier
+		&& x509_exts_add_subject_key_identifier_ex(ski, &skilen, sizeof(ski),
+			-1, item->subject_public_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (asn1_sequence_begin(&cert_hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (out && *out) {
+		tbs = *out;
+	}
+	if (asn1_sequence_begin(&tbs_hdr, out, outlen) != 1
+		|| x509_explicit_version_to_der(0, X509_version_v3, out, outlen) != 1
+		|| asn1_integer_to_der(item->serial, item->serial_len, out, outlen) != 1
+		|| asn1_data_to_der(issuer->alg_and_issuer, issuer->alg_and_issuer_len, out, outlen) != 1
+		|| x509_validity_to_der(item->not_before, item->not_after, out, outlen) != 1
+		|| asn1_sequence_to_der(item->subject, item->subject_len, out, outlen) != 1
+		|| x509_public_key_info_to_der(item->subject_public_key, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (issuer->exts_len || skilen) {
+		if (asn1_explicit_begin(&exts_hdr, 3, out, outlen) != 1
+			|| asn1_sequence_begin(&exts_seq_hdr, out, outlen) != 1
+			|| asn1_data_to_der(issuer->exts, issuer->exts_len, out, outlen) < 0
+			|| asn1_data_to_der(ski, skilen, out, outlen) < 0
+			|| asn1_header_end(&exts_seq_hdr, out, outlen) != 1
+			|| asn1_header_end(&exts_hdr, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_header_end(&tbs_hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (tbs) {
+		if (x509_cert_issue_sign(job, tbs, *out - tbs, sig, &siglen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (x509_signature_algor_to_der(OID_sm2sign_with_sm3, out, outlen) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, out, outlen) != 1
+		|| asn1_header_end(&cert_hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static void x509_cert_issue_items(X509_CERT_ISSUE_JOB *job)
+{
+	const X509_CERT_ISSUE_ITEM *item;
+	uint8_t *cert;
+	size_t certlen;
+	size_t i;
+
+	job->num_pre_comp = 0;
+	job->ret = 1;
+
+	for (i = 0; i < job->count; i++) {
+		item = &job->items[i];
+		cert = job->certs + job->maxcertlen * i;
+		job->certlens[i] = 0;
+
+		if (!item->serial || !item->subject || !item->subject_public_key) {
+			error_print();
+			job->ret = -1;
+			continue;
+		}
+		certlen = 0;
+		if (x509_cert_issue_to_der(job, item, NULL, &certlen) != 1
+			|| certlen > job->maxcertlen) {
+			error_print();
+			job->ret = -1;
+			continue;
+		}
+		certlen = 0;
+		if (x509_cert_issue_to_der(job, item, &cert, &certlen) != 1) {
+			error_print();
+			job->ret = -1;
+			continue;
+		}
+		job->certlens[i] = certlen;
+	}
+	gmssl_secure_clear(job->pre_comp, sizeof(job->pre_comp));
+}
+
+static void x509_cert_issue_task(void *arg)
+{
+	x509_cert_issue_items((X509_CERT_ISSUE_JOB *)arg);
+}
+
+// every thread gets at least X509_CERT_ISSUE_THREAD_MIN_COUNT certificates
+#define X509_CERT_ISSUE_THREAD_MIN_COUNT	16
+
+int x509_cert_issuer_issue(const X509_CERT_ISSUER *issuer,
+	const X509_CERT_ISSUE_ITEM *items, size_t count,
+	uint8_t *certs, size_t maxcertlen, size_t *certlens, int threads)
+{
+	X509_CERT_ISSUE_JOB *jobs;
+	size_t max_threads;
+	size_t first;
+	int ret = 1;
+	int i;
+
+	if (!issuer || !items || !certs || !maxcertlen || !certlens) {
+		error_print();
+		return -1;
+	}
+	if (!count) {
+		return 1;
+	}
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > X509_CERT_ISSUER_MAX_THREADS) {
+		threads = X509_CERT_ISSUER_MAX_THREADS;
+	}
+	max_threads = count / X509_CERT_ISSUE_THREAD_MIN_COUNT;
+	if ((size_t)threads > max_threads) {
+		threads = max_threads ? (int)max_threads : 1;
+	}
+
+	// every job keeps its own (k, x1) pairs, too large for the stack
+	if (!(jobs = (X509_CERT_ISSUE_JOB *)malloc(sizeof(X509_CERT_ISSUE_JOB) * threads))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < threads; i++) {
+		first = count * i / threads;
+		jobs[i].issuer = issuer;
+		jobs[i].items = items + first;
+		jobs[i].count = count * (i + 1) / threads - first;
+		jobs[i].certs = certs + maxcertlen * first;
+		jobs[i].maxcertlen = maxcertlen;
+		jobs[i].certlens = certlens + first;
+	}
+	gmssl_thread_pool_run(x509_cert_issue_task, jobs, sizeof(jobs[0]), (size_t)threads);
+
+	for (i = 0; i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	gmssl_secure_clear(jobs, sizeof(X509_CERT_ISSUE_JOB) * threads);
+	free(jobs);
+	if (ret != 1) {
+		error_print();
+	}
+	return ret;
+}
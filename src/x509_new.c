@@ -28,60 +28,129 @@
 #include <errno.h>
 #include <sys/stat.h>
 
-int x509_cert_new_from_file(uint8_t **out, size_t *outlen, const char *file)
+// PEM blocks or a single DER object, decoded from a mapping of the file
+static int x509_objects_new_from_file(uint8_t **out, size_t *outlen, const char *file,
+	const char *pem_name, int (*check)(const uint8_t *a, size_t alen), int single)
 {
 	int ret = -1;
-	FILE *fp = NULL;
-	size_t fsize;
+	const uint8_t *data = NULL;
+	size_t datalen = 0;
+	const uint8_t *p;
+	size_t len;
 	uint8_t *buf = NULL;
-	size_t buflen;
+	size_t buflen = 0;
+	size_t maxlen;
+	const uint8_t *a;
+	size_t alen;
+	int rv;
 
-	if (!(fp = fopen(file, "r"))
-		|| file_size(fp, &fsize) != 1
-		|| (buflen = (fsize * 3)/4 + 1) < 0
-		|| (buf = malloc((fsize * 3)/4 + 1)) == NULL) {
+	if (!out || !outlen || !file) {
 		error_print();
-		goto end;
+		return -1;
 	}
-	if (x509_cert_from_pem(buf, outlen, buflen, fp) != 1) {
+	if (file_map(file, &data, &datalen) != 1 || !datalen) {
 		error_print();
 		goto end;
 	}
+
+	if (data[0] == ASN1_TAG_SEQUENCE) {
+		p = data;
+		len = datalen;
+		if (asn1_any_from_der(&a, &alen, &p, &len) != 1
+			|| asn1_length_is_zero(len) != 1
+			|| check(a, alen) != 1
+			|| !(buf = malloc(alen))) {
+			error_print();
+			goto end;
+		}
+		memcpy(buf, a, alen);
+		buflen = alen;
+	} else {
+		maxlen = (datalen * 3)/4 + 1;
+		if (!(buf = malloc(maxlen))) {
+			error_print();
+			goto end;
+		}
+		p = data;
+		len = datalen;
+		for (;;) {
+			if ((rv = pem_decode(pem_name, &p, &len, buf + buflen, &alen, maxlen - buflen)) < 0
+				|| (rv == 1 && check(buf + buflen, alen) != 1)) {
+				error_print();
+				goto end;
+			}
+			if (rv == 0) {
+				break;
+			}
+			buflen += alen;
+			if (single) {
+				break;
+			}
+		}
+		if (!buflen) {
+			error_print();
+			goto end;
+		}
+	}
 	*out = buf;
+	*outlen = buflen;
 	buf = NULL;
 	ret = 1;
 end:
-	if (fp) fclose(fp);
+	file_unmap(data, datalen);
 	if (buf) free(buf);
 	return ret;
 }
 
-int x509_certs_new_from_file(uint8_t **out, size_t *outlen, const char *file)
+static int x509_cert_check_one(const uint8_t *a, size_t alen)
 {
-	int ret = -1;
-	FILE *fp = NULL;
-	size_t fsize;
-	uint8_t *buf = NULL;
-	size_t buflen;
+	const uint8_t *cert;
+	size_t certlen;
+	if (x509_cert_from_der(&cert, &certlen, &a, &alen) != 1
+		|| asn1_length_is_zero(alen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
 
-	if (!(fp = fopen(file, "r"))
-		|| file_size(fp, &fsize) != 1
-		|| (buflen = (fsize * 3)/4 + 1) < 0
-		|| (buf = malloc((fsize * 3)/4 + 1)) == NULL) {
+static int x509_crl_check_one(const uint8_t *a, size_t alen)
+{
+	const uint8_t *crl;
+	size_t crl_len;
+	if (x509_crl_from_der(&crl, &crl_len, &a, &alen) != 1
+		|| asn1_length_is_zero(alen) != 1) {
 		error_print();
-		goto end;
+		return -1;
 	}
-	if (x509_certs_from_pem(buf, outlen, buflen, fp) != 1) {
+	return 1;
+}
+
+int x509_cert_new_from_file(uint8_t **out, size_t *outlen, const char *file)
+{
+	if (x509_objects_new_from_file(out, outlen, file, "CERTIFICATE", x509_cert_check_one, 1) != 1) {
 		error_print();
-		goto end;
+		return -1;
 	}
-	*out = buf;
-	buf = NULL;
-	ret = 1;
-end:
-	if (fp) fclose(fp);
-	if (buf) free(buf);
-	return ret;
+	return 1;
+}
+
+int x509_certs_new_from_file(uint8_t **out, size_t *outlen, const char *file)
+{
+	if (x509_objects_new_from_file(out, outlen, file, "CERTIFICATE", x509_cert_check_one, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_crl_new_from_file(uint8_t **crl, size_t *crl_len, const char *file)
+{
+	if (x509_objects_new_from_file(crl, crl_len, file, "X509 CRL", x509_crl_check_one, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
 }
 
 int x509_req_new_from_pem(uint8_t **out, size_t *outlen, FILE *fp)
@@ -144,19 +213,7 @@ int x509_crl_new_from_uri(uint8_t **crl, size_t *crl_len, const char *uri, size_
 	memcpy(uristr, uri, urilen);
 	uristr[urilen] = 0;
 
-	if (http_get(uristr, NULL, &buflen, 0) < 0) {
-		error_print();
-		goto end;
-	}
-	if (!buflen) {
-		error_print();
-		goto end;
-	}
-	if (!(buf = malloc(buflen))) {
-		error_print();
-		goto end;
-	}
-	if (http_get(uristr, buf, &buflen, buflen) != 1) {
+	if (http_get_new(uristr, NULL, &buf, &buflen) != 1) {
 		error_print();
 		goto end;
 	}
@@ -173,7 +230,8 @@ end:
 	return ret;
 }
 
-int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert, size_t certlen)
+// return 0 if the certificate has no CRL distribution point URI
+static int x509_cert_get_crl_uri(const uint8_t *cert, size_t certlen, const char **uri, size_t *urilen)
 {
 	int ret;
 	const uint8_t *exts;
@@ -183,8 +241,6 @@ int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert,
 	const uint8_t *val;
 	size_t vlen;
 
-	const char *uri;
-	size_t urilen;
 	int reason;
 	const uint8_t *crl_issuer;
 	size_t crl_issuer_len;
@@ -198,16 +254,26 @@ int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert,
 		if (ret < 0) error_print();
 		return ret;
 	}
-	if (x509_uri_as_distribution_points_from_der(&uri, &urilen,
+	if (x509_uri_as_distribution_points_from_der(uri, urilen,
 		&reason, &crl_issuer, &crl_issuer_len, &val, &vlen) != 1
 		|| asn1_length_is_zero(vlen) != 1) {
 		error_print();
 		return -1;
 	}
-	if (!uri) {
+	return *uri ? 1 : 0;
+}
+
+int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert, size_t certlen)
+{
+	int ret;
+	const char *uri;
+	size_t urilen;
+
+	if ((ret = x509_cert_get_crl_uri(cert, certlen, &uri, &urilen)) != 1) {
+		if (ret < 0) error_print();
 		*crl = NULL;
 		*crl_len = 0;
-		return 0;
+		return ret;
 	}
 	if (x509_crl_new_from_uri(crl, crl_len, uri, urilen) != 1) {
 		error_print();
@@ -216,14 +282,14 @@ int x509_crl_new_from_cert(uint8_t **crl, size_t *crl_len, const uint8_t *cert,
 	return 1;
 }
 
+// the CRL is taken from the process-wide CRL cache
 int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
 	const char *ca_signer_id, size_t ca_signer_id_len)
 {
 	int ret = -1;
-	uint8_t *crl = NULL;
-	size_t crl_len = 0;
-	const uint8_t *crl_issuer;
-	size_t crl_issuer_len;
+	const char *uri;
+	size_t urilen;
+	const X509_CRL_INDEX *index = NULL;
 
 	const uint8_t *issuer;
 	size_t issuer_len;
@@ -234,12 +300,13 @@ int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cace
 	const uint8_t *crl_entry_exts;
 	size_t crl_entry_exts_len;
 
-	// download CRL and do basic validation
-	if (x509_crl_new_from_cert(&crl, &crl_len, cert, certlen) != 1) {
+	// get (or download) CRL and do basic validation
+	if (x509_cert_get_crl_uri(cert, certlen, &uri, &urilen) != 1
+		|| x509_crl_cache_get(uri, urilen, &index) != 1) {
 		error_print();
 		return -1;
 	}
-	if (x509_crl_check(crl, crl_len, time(NULL)) != 1) {
+	if (x509_crl_check(index->crl, index->crl_len, time(NULL)) != 1) {
 		error_print();
 		goto end;
 	}
@@ -250,23 +317,19 @@ int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cace
 	}
 
 	// make sure CRL's issuer is the certificate issuer
-	if (x509_crl_get_issuer(crl, crl_len, &crl_issuer, &crl_issuer_len) != 1) {
-		error_print();
-		goto end;
-	}
-	if (x509_name_equ(issuer, issuer_len, crl_issuer, crl_issuer_len) != 1) {
+	if (x509_name_equ(issuer, issuer_len, index->issuer, index->issuer_len) != 1) {
 		error_print();
 		goto end;
 	}
 
 	// verify CRL
-	if (x509_crl_verify_by_ca_cert(crl, crl_len, cacert, cacertlen, ca_signer_id, ca_signer_id_len) != 1) {
+	if (x509_crl_cache_verify_by_ca_cert(index, cacert, cacertlen, ca_signer_id, ca_signer_id_len) != 1) {
 		error_print();
 		goto end;
 	}
 
 	// check if the certificate in the CRL
-	if ((ret = x509_crl_find_revoked_cert_by_serial_number(crl, crl_len, serial, serial_len,
+	if ((ret = x509_crl_index_find_revoked_cert_by_serial_number(index, serial, serial_len,
 		&revoke_date, &crl_entry_exts, &crl_entry_exts_len)) < 0) {
 		error_print();
 		goto end;
@@ -279,6 +342,6 @@ int x509_cert_check_crl(const uint8_t *cert, size_t certlen, const uint8_t *cace
 	ret = 1;
 
 end:
-	if (crl) free(crl);
+	x509_crl_cache_put(index);
 	return ret;
 }
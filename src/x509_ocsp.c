@@ -0,0 +1,667 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/oid.h>
+#include <gmssl/asn1.h>
+#include <gmssl/digest.h>
+#include <gmssl/base64.h>
+#include <gmssl/http.h>
+#include <gmssl/x509_alg.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ocsp.h>
+#include <gmssl/error.h>
+
+
+#define oid_pkix_ocsp	1,3,6,1,5,5,7,48,1
+static const uint32_t oid_pkix_ocsp_basic[] = { oid_pkix_ocsp,1 };
+#define oid_pkix_ocsp_basic_cnt (sizeof(oid_pkix_ocsp_basic)/sizeof(oid_pkix_ocsp_basic[0]))
+
+enum {
+	X509_ocsp_successful = 0,
+};
+
+
+const char *x509_ocsp_cert_status_name(int status)
+{
+	switch (status) {
+	case X509_ocsp_cert_good: return "good";
+	case X509_ocsp_cert_revoked: return "revoked";
+	case X509_ocsp_cert_unknown: return "unknown";
+	}
+	return NULL;
+}
+
+static const DIGEST *x509_ocsp_digest(int oid)
+{
+	switch (oid) {
+	case OID_sm3: return DIGEST_sm3();
+#ifdef ENABLE_SHA1
+	case OID_sha1: return DIGEST_sha1();
+#endif
+	}
+	return NULL;
+}
+
+// issuerNameHash over the DER Name, issuerKeyHash over the uncompressed point of the CA
+static int x509_ocsp_issuer_hashes(const DIGEST *algor, const uint8_t *cacert, size_t cacertlen,
+	uint8_t name_hash[DIGEST_MAX_SIZE], uint8_t key_hash[DIGEST_MAX_SIZE], size_t *dgstlen)
+{
+	const uint8_t *name;
+	size_t namelen;
+	SM2_KEY ca_key;
+	uint8_t header[8];
+	uint8_t *p = header;
+	size_t headerlen = 0;
+	uint8_t octets[65];
+	DIGEST_CTX ctx;
+
+	if (x509_cert_get_subject(cacert, cacertlen, &name, &namelen) != 1
+		|| x509_cert_get_subject_public_key(cacert, cacertlen, &ca_key) != 1
+		|| asn1_sequence_header_to_der(namelen, &p, &headerlen) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_point_to_uncompressed_octets(&ca_key.public_key, octets);
+	if (!algor
+		|| digest_init(&ctx, algor) != 1
+		|| digest_update(&ctx, header, headerlen) != 1
+		|| digest_update(&ctx, name, namelen) != 1
+		|| digest_finish(&ctx, name_hash, dgstlen) != 1
+		|| digest(algor, octets, sizeof(octets), key_hash, dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_ocsp_cert_id_to_der_ex(int digest_oid,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	uint8_t **out, size_t *outlen)
+{
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *subject;
+	size_t subject_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	uint8_t name_hash[DIGEST_MAX_SIZE];
+	uint8_t key_hash[DIGEST_MAX_SIZE];
+	size_t dgstlen;
+	ASN1_HEADER hdr;
+
+	if (x509_cert_get_issuer_and_serial_number(cert, certlen, &issuer, &issuer_len, &serial, &serial_len) != 1
+		|| x509_cert_get_subject(cacert, cacertlen, &subject, &subject_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_name_equ(issuer, issuer_len, subject, subject_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_ocsp_issuer_hashes(x509_ocsp_digest(digest_oid), cacert, cacertlen,
+			name_hash, key_hash, &dgstlen) != 1
+		|| asn1_sequence_begin(&hdr, out, outlen) != 1
+		|| x509_digest_algor_to_der(digest_oid, out, outlen) != 1
+		|| asn1_octet_string_to_der(name_hash, dgstlen, out, outlen) != 1
+		|| asn1_octet_string_to_der(key_hash, dgstlen, out, outlen) != 1
+		|| asn1_integer_to_der(serial, serial_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_ocsp_cert_id_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	uint8_t **out, size_t *outlen)
+{
+	if (!cert || !certlen || !cacert || !cacertlen || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (x509_ocsp_cert_id_to_der_ex(OID_sm3, cert, certlen, cacert, cacertlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// return 1 if the CertID is of `cert`, 0 if not
+static int x509_ocsp_cert_id_match(const uint8_t *d, size_t dlen,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen)
+{
+	int digest_oid;
+	const DIGEST *digest;
+	const uint8_t *name_hash;
+	size_t name_hash_len;
+	const uint8_t *key_hash;
+	size_t key_hash_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	const uint8_t *cert_serial;
+	size_t cert_serial_len;
+	uint8_t name_dgst[DIGEST_MAX_SIZE];
+	uint8_t key_dgst[DIGEST_MAX_SIZE];
+	size_t dgstlen;
+
+	if (x509_digest_algor_from_der(&digest_oid, &d, &dlen) != 1
+		|| asn1_octet_string_from_der(&name_hash, &name_hash_len, &d, &dlen) != 1
+		|| asn1_octet_string_from_der(&key_hash, &key_hash_len, &d, &dlen) != 1
+		|| asn1_integer_from_der(&serial, &serial_len, &d, &dlen) != 1
+		|| asn1_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(digest = x509_ocsp_digest(digest_oid))) {
+		return 0;
+	}
+	if (x509_cert_get_issuer_and_serial_number(cert, certlen, NULL, NULL, &cert_serial, &cert_serial_len) != 1
+		|| x509_ocsp_issuer_hashes(digest, cacert, cacertlen, name_dgst, key_dgst, &dgstlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (serial_len != cert_serial_len || memcmp(serial, cert_serial, serial_len) != 0
+		|| name_hash_len != dgstlen || memcmp(name_hash, name_dgst, dgstlen) != 0
+		|| key_hash_len != dgstlen || memcmp(key_hash, key_dgst, dgstlen) != 0) {
+		return 0;
+	}
+	return 1;
+}
+
+int x509_ocsp_request_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	uint8_t **out, size_t *outlen)
+{
+	ASN1_HEADER request;
+	ASN1_HEADER tbs_request;
+	ASN1_HEADER request_list;
+	ASN1_HEADER req;
+
+	if (!cert || !certlen || !cacert || !cacertlen || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_sequence_begin(&request, out, outlen) != 1
+		|| asn1_sequence_begin(&tbs_request, out, outlen) != 1
+		|| asn1_sequence_begin(&request_list, out, outlen) != 1
+		|| asn1_sequence_begin(&req, out, outlen) != 1
+		|| x509_ocsp_cert_id_to_der_ex(OID_sm3, cert, certlen, cacert, cacertlen, out, outlen) != 1
+		|| asn1_header_end(&req, out, outlen) != 1
+		|| asn1_header_end(&request_list, out, outlen) != 1
+		|| asn1_header_end(&tbs_request, out, outlen) != 1
+		|| asn1_header_end(&request, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_ocsp_response_data_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	int cert_status, time_t revocation_time, time_t this_update, time_t next_update,
+	uint8_t **out, size_t *outlen)
+{
+	uint8_t name_hash[DIGEST_MAX_SIZE];
+	uint8_t key_hash[DIGEST_MAX_SIZE];
+	size_t dgstlen;
+	ASN1_HEADER response_data;
+	ASN1_HEADER responder_id;
+	ASN1_HEADER responses;
+	ASN1_HEADER single_response;
+	ASN1_HEADER hdr;
+
+	// responderID byKey
+	if (x509_ocsp_issuer_hashes(DIGEST_sm3(), cacert, cacertlen, name_hash, key_hash, &dgstlen) != 1
+		|| asn1_sequence_begin(&response_data, out, outlen) != 1
+		|| asn1_explicit_begin(&responder_id, 2, out, outlen) != 1
+		|| asn1_octet_string_to_der(key_hash, dgstlen, out, outlen) != 1
+		|| asn1_header_end(&responder_id, out, outlen) != 1
+		|| asn1_generalized_time_to_der(this_update, out, outlen) != 1
+		|| asn1_sequence_begin(&responses, out, outlen) != 1
+		|| asn1_sequence_begin(&single_response, out, outlen) != 1
+		|| x509_ocsp_cert_id_to_der_ex(OID_sm3, cert, certlen, cacert, cacertlen, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	switch (cert_status) {
+	case X509_ocsp_cert_good:
+	case X509_ocsp_cert_unknown:
+		if (asn1_header_to_der(ASN1_TAG_IMPLICIT(cert_status), 0, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		break;
+	case X509_ocsp_cert_revoked:
+		if (asn1_explicit_begin(&hdr, 1, out, outlen) != 1
+			|| asn1_generalized_time_to_der(revocation_time, out, outlen) != 1
+			|| asn1_header_end(&hdr, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		break;
+	default:
+		error_print();
+		return -1;
+	}
+	if (asn1_generalized_time_to_der(this_update, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (next_update >= 0) {
+		if (asn1_explicit_begin(&hdr, 0, out, outlen) != 1
+			|| asn1_generalized_time_to_der(next_update, out, outlen) != 1
+			|| asn1_header_end(&hdr, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (asn1_header_end(&single_response, out, outlen) != 1
+		|| asn1_header_end(&responses, out, outlen) != 1
+		|| asn1_header_end(&response_data, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_ocsp_response_sign_to_der(const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	int cert_status, time_t revocation_time, time_t this_update, time_t next_update,
+	const SM2_KEY *ca_key, const char *signer_id, size_t signer_id_len,
+	uint8_t **out, size_t *outlen)
+{
+	ASN1_HEADER response;
+	ASN1_HEADER response_bytes;
+	ASN1_HEADER bytes;
+	ASN1_HEADER basic;
+	ASN1_HEADER basic_response;
+	uint8_t *tbs = NULL;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen = SM2_signature_typical_size;
+
+	if (!cert || !certlen || !cacert || !cacertlen || !ca_key || !signer_id || !outlen) {
+		error_print();
+		return -1;
+	}
+	if (asn1_sequence_begin(&response, out, outlen) != 1
+		|| asn1_enumerated_to_der(X509_ocsp_successful, out, outlen) != 1
+		|| asn1_explicit_begin(&response_bytes, 0, out, outlen) != 1
+		|| asn1_sequence_begin(&bytes, out, outlen) != 1
+		|| asn1_object_identifier_to_der(oid_pkix_ocsp_basic, oid_pkix_ocsp_basic_cnt, out, outlen) != 1
+		|| asn1_header_begin(&basic, ASN1_TAG_OCTET_STRING, out, outlen) != 1
+		|| asn1_sequence_begin(&basic_response, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (out && *out) {
+		tbs = *out;
+	}
+	if (x509_ocsp_response_data_to_der(cert, certlen, cacert, cacertlen,
+		cert_status, revocation_time, this_update, next_update, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (tbs) {
+		SM2_SIGN_CTX sign_ctx;
+		if (sm2_sign_init(&sign_ctx, ca_key, signer_id, signer_id_len) != 1
+			|| sm2_sign_update(&sign_ctx, tbs, *out - tbs) != 1
+			|| sm2_sign_finish_fixlen(&sign_ctx, siglen, sig) != 1) {
+			gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+			error_print();
+			return -1;
+		}
+		gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
+	}
+	if (x509_signature_algor_to_der(OID_sm2sign_with_sm3, out, outlen) != 1
+		|| asn1_bit_octets_to_der(sig, siglen, out, outlen) != 1
+		|| asn1_header_end(&basic_response, out, outlen) != 1
+		|| asn1_header_end(&basic, out, outlen) != 1
+		|| asn1_header_end(&bytes, out, outlen) != 1
+		|| asn1_header_end(&response_bytes, out, outlen) != 1
+		|| asn1_header_end(&response, out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int x509_ocsp_signed_verify(const uint8_t *tbs, size_t tbslen, int sig_alg,
+	const uint8_t *sig, size_t siglen, const SM2_KEY *key, const char *signer_id, size_t signer_id_len)
+{
+	SM2_VERIFY_CTX verify_ctx;
+
+	if (sig_alg != OID_sm2sign_with_sm3) {
+		error_print();
+		return -1;
+	}
+	if (sm2_verify_init(&verify_ctx, key, signer_id, signer_id_len) != 1
+		|| sm2_verify_update(&verify_ctx, tbs, tbslen) != 1) {
+		error_print();
+		return -1;
+	}
+	return sm2_verify_finish(&verify_ctx, sig, siglen) == 1 ? 1 : 0;
+}
+
+// a delegated responder certificate is issued by the CA for OCSPSigning
+static int x509_ocsp_responder_cert_check(const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, const char *signer_id, size_t signer_id_len)
+{
+	const uint8_t *exts;
+	size_t extslen;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+	int oids[16];
+	size_t oids_cnt;
+	size_t i;
+
+	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen, signer_id, signer_id_len) != 1
+		|| x509_cert_get_exts(cert, certlen, &exts, &extslen) != 1
+		|| x509_exts_get_ext_by_oid(exts, extslen, OID_ce_ext_key_usage, &critical, &val, &vlen) != 1
+		|| x509_ext_key_usage_from_der(oids, &oids_cnt, sizeof(oids)/sizeof(oids[0]), &val, &vlen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < oids_cnt; i++) {
+		if (oids[i] == OID_kp_ocsp_signing) {
+			return 1;
+		}
+	}
+	error_print();
+	return -1;
+}
+
+int x509_ocsp_response_verify(const uint8_t *resp, size_t resplen,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len, time_t now,
+	int *cert_status, time_t *this_update, time_t *next_update)
+{
+	const uint8_t *d;
+	size_t dlen;
+	int response_status;
+	const uint8_t *response_bytes;
+	size_t response_bytes_len;
+	uint32_t nodes[32];
+	size_t nodes_cnt;
+	const uint8_t *basic;
+	size_t basiclen;
+	const uint8_t *tbs;
+	size_t tbslen;
+	int sig_alg;
+	const uint8_t *sig;
+	size_t siglen;
+	const uint8_t *certs = NULL;
+	size_t certslen = 0;
+	SM2_KEY ca_key;
+	const uint8_t *version;
+	size_t versionlen;
+	int tag;
+	const uint8_t *responder_id;
+	size_t responder_id_len;
+	time_t produced_at;
+	const uint8_t *responses;
+	size_t responseslen;
+	int ret;
+
+	if (!resp || !resplen || !cert || !certlen || !cacert || !cacertlen || !signer_id
+		|| !cert_status || !this_update || !next_update) {
+		error_print();
+		return -1;
+	}
+
+	// OCSPResponse
+	if (asn1_sequence_from_der(&d, &dlen, &resp, &resplen) != 1
+		|| asn1_length_is_zero(resplen) != 1
+		|| asn1_enumerated_from_der(&response_status, &d, &dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (response_status != X509_ocsp_successful) {
+		error_print();
+		return -1;
+	}
+	if (asn1_explicit_from_der(0, &response_bytes, &response_bytes_len, &d, &dlen) != 1
+		|| asn1_length_is_zero(dlen) != 1
+		|| asn1_sequence_from_der(&d, &dlen, &response_bytes, &response_bytes_len) != 1
+		|| asn1_length_is_zero(response_bytes_len) != 1
+		|| asn1_object_identifier_from_der(nodes, &nodes_cnt, &d, &dlen) != 1
+		|| asn1_object_identifier_equ(nodes, nodes_cnt, oid_pkix_ocsp_basic, oid_pkix_ocsp_basic_cnt) != 1
+		|| asn1_octet_string_from_der(&basic, &basiclen, &d, &dlen) != 1
+		|| asn1_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// BasicOCSPResponse
+	if (asn1_sequence_from_der(&d, &dlen, &basic, &basiclen) != 1
+		|| asn1_length_is_zero(basiclen) != 1
+		|| asn1_any_from_der(&tbs, &tbslen, &d, &dlen) != 1
+		|| x509_signature_algor_from_der(&sig_alg, &d, &dlen) != 1
+		|| asn1_bit_octets_from_der(&sig, &siglen, &d, &dlen) != 1
+		|| asn1_explicit_from_der(0, &certs, &certslen, &d, &dlen) < 0
+		|| asn1_length_is_zero(dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_get_subject_public_key(cacert, cacertlen, &ca_key) != 1
+		|| (ret = x509_ocsp_signed_verify(tbs, tbslen, sig_alg, sig, siglen, &ca_key, signer_id, signer_id_len)) < 0) {
+		error_print();
+		return -1;
+	}
+	if (!ret) {
+		const uint8_t *responder;
+		size_t responderlen;
+		SM2_KEY responder_key;
+
+		if (!certs
+			|| asn1_sequence_of_from_der(&d, &dlen, &certs, &certslen) != 1
+			|| x509_cert_from_der(&responder, &responderlen, &d, &dlen) != 1
+			|| x509_ocsp_responder_cert_check(responder, responderlen, cacert, cacertlen,
+				signer_id, signer_id_len) != 1
+			|| x509_cert_get_subject_public_key(responder, responderlen, &responder_key) != 1
+			|| x509_ocsp_signed_verify(tbs, tbslen, sig_alg, sig, siglen, &responder_key,
+				signer_id, signer_id_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// ResponseData
+	if (asn1_sequence_from_der(&d, &dlen, &tbs, &tbslen) != 1
+		|| asn1_explicit_from_der(0, &version, &versionlen, &d, &dlen) < 0
+		|| asn1_any_type_from_der(&tag, &responder_id, &responder_id_len, &d, &dlen) != 1
+		|| (tag != ASN1_TAG_EXPLICIT(1) && tag != ASN1_TAG_EXPLICIT(2))
+		|| asn1_generalized_time_from_der(&produced_at, &d, &dlen) != 1
+		|| asn1_sequence_of_from_der(&responses, &responseslen, &d, &dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	// responseExtensions (nonce) are not used
+
+	while (responseslen) {
+		const uint8_t *single;
+		size_t singlelen;
+		const uint8_t *cert_id;
+		size_t cert_id_len;
+		const uint8_t *status;
+		size_t statuslen;
+		time_t revocation_time;
+		const uint8_t *next;
+		size_t nextlen;
+
+		if (asn1_sequence_from_der(&single, &singlelen, &responses, &responseslen) != 1
+			|| asn1_sequence_from_der(&cert_id, &cert_id_len, &single, &singlelen) != 1) {
+			error_print();
+			return -1;
+		}
+		if ((ret = x509_ocsp_cert_id_match(cert_id, cert_id_len, cert, certlen, cacert, cacertlen)) != 1) {
+			if (ret < 0) {
+				error_print();
+				return -1;
+			}
+			continue;
+		}
+		if (asn1_any_type_from_der(&tag, &status, &statuslen, &single, &singlelen) != 1) {
+			error_print();
+			return -1;
+		}
+		switch (tag) {
+		case ASN1_TAG_IMPLICIT(X509_ocsp_cert_good):
+			*cert_status = X509_ocsp_cert_good;
+			break;
+		case ASN1_TAG_EXPLICIT(X509_ocsp_cert_revoked):
+			if (asn1_generalized_time_from_der(&revocation_time, &status, &statuslen) != 1) {
+				error_print();
+				return -1;
+			}
+			*cert_status = X509_ocsp_cert_revoked;
+			break;
+		case ASN1_TAG_IMPLICIT(X509_ocsp_cert_unknown):
+			*cert_status = X509_ocsp_cert_unknown;
+			break;
+		default:
+			error_print();
+			return -1;
+		}
+		if (asn1_generalized_time_from_der(this_update, &single, &singlelen) != 1
+			|| (ret = asn1_explicit_from_der(0, &next, &nextlen, &single, &singlelen)) < 0
+			|| (ret && asn1_generalized_time_from_der(next_update, &next, &nextlen) != 1)) {
+			error_print();
+			return -1;
+		}
+		if (!ret) {
+			*next_update = -1;
+		}
+		if (*this_update > now + X509_OCSP_MAX_CLOCK_SKEW
+			|| (*next_update >= 0 && *next_update < now)) {
+			error_print();
+			return -1;
+		}
+		return 1;
+	}
+
+	// no response for the certificate
+	error_print();
+	return -1;
+}
+
+// return 0 if the certificate has no OCSP URI
+static int x509_cert_get_ocsp_uri(const uint8_t *cert, size_t certlen, const char **uri, size_t *urilen)
+{
+	int ret;
+	const uint8_t *exts;
+	size_t extslen;
+	int critical;
+	const uint8_t *val;
+	size_t vlen;
+	const char *ca_issuers_uri;
+	size_t ca_issuers_urilen;
+
+	if ((ret = x509_cert_get_exts(cert, certlen, &exts, &extslen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if ((ret = x509_exts_get_ext_by_oid(exts, extslen,
+		OID_pe_authority_info_access, &critical, &val, &vlen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (x509_authority_info_access_from_der(&ca_issuers_uri, &ca_issuers_urilen,
+		uri, urilen, &val, &vlen) != 1
+		|| asn1_length_is_zero(vlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return *uri ? 1 : 0;
+}
+
+// RFC 5019 GET, the URL-encoded base64 of the DER request is appended to the URI
+int x509_ocsp_response_new_from_cert(uint8_t **resp, size_t *resplen,
+	const uint8_t *cert, size_t certlen, const uint8_t *cacert, size_t cacertlen)
+{
+	int ret;
+	const char *uri;
+	size_t urilen;
+	uint8_t req[512];
+	uint8_t *p = req;
+	size_t reqlen = 0;
+	uint8_t b64[BASE64_ENCODE_LENGTH(sizeof(req))];
+	int b64len;
+	char *uristr = NULL;
+	size_t len;
+	int i;
+	uint8_t *buf = NULL;
+	size_t buflen;
+	const uint8_t *cp;
+	const uint8_t *d;
+	size_t dlen;
+
+	if (!resp || !resplen || !cert || !certlen || !cacert || !cacertlen) {
+		error_print();
+		return -1;
+	}
+	*resp = NULL;
+	*resplen = 0;
+
+	if ((ret = x509_cert_get_ocsp_uri(cert, certlen, &uri, &urilen)) != 1) {
+		if (ret < 0) error_print();
+		return ret;
+	}
+	if (x509_ocsp_request_to_der(cert, certlen, cacert, cacertlen, NULL, &reqlen) != 1
+		|| reqlen > sizeof(req)) {
+		error_print();
+		return -1;
+	}
+	reqlen = 0;
+	x509_ocsp_request_to_der(cert, certlen, cacert, cacertlen, &p, &reqlen);
+	b64len = base64_encode_block(b64, req, (int)reqlen);
+
+	// '+', '/' and '=' are escaped
+	if (!(uristr = (char *)malloc(urilen + 1 + (size_t)b64len * 3 + 1))) {
+		error_print();
+		return -1;
+	}
+	memcpy(uristr, uri, urilen);
+	len = urilen;
+	if (!urilen || uri[urilen - 1] != '/') {
+		uristr[len++] = '/';
+	}
+	for (i = 0; i < b64len; i++) {
+		if (b64[i] == '+' || b64[i] == '/' || b64[i] == '=') {
+			len += sprintf(uristr + len, "%%%02X", b64[i]);
+		} else {
+			uristr[len++] = (char)b64[i];
+		}
+	}
+	uristr[len] = 0;
+
+	if (http_get_new(uristr, NULL, &buf, &buflen) != 1) {
+		error_print();
+		free(uristr);
+		return -1;
+	}
+	free(uristr);
+
+	cp = buf;
+	len = buflen;
+	if (asn1_sequence_from_der(&d, &dlen, &cp, &len) != 1
+		|| asn1_length_is_zero(len) != 1) {
+		error_print();
+		free(buf);
+		return -1;
+	}
+	*resp = buf;
+	*resplen = buflen;
+	return 1;
+}
@@ -33,20 +33,17 @@ int x509_request_info_to_der(
 	const uint8_t *attrs, size_t attrs_len,
 	uint8_t **out, size_t *outlen)
 {
-	size_t len = 0;
+	ASN1_HEADER hdr;
 	if (version != X509_version_v1) {
 		error_print();
 		return -1;
 	}
-	if (asn1_int_to_der(version, NULL, &len) != 1
-		|| asn1_sequence_to_der(subject, subject_len, NULL, &len) != 1
-		|| x509_public_key_info_to_der(subject_public_key, NULL, &len) != 1
-		|| asn1_implicit_set_to_der(0, attrs, attrs_len, NULL, &len) != 1
-		|| asn1_sequence_header_to_der(len, out, outlen) != 1
+	if (asn1_sequence_begin(&hdr, out, outlen) != 1
 		|| asn1_int_to_der(version, out, outlen) != 1
 		|| asn1_sequence_to_der(subject, subject_len, out, outlen) != 1
 		|| x509_public_key_info_to_der(subject_public_key, out, outlen) != 1
-		|| asn1_implicit_set_to_der(0, attrs, attrs_len, out, outlen) != 1) {
+		|| asn1_implicit_set_to_der(0, attrs, attrs_len, out, outlen) != 1
+		|| asn1_header_end(&hdr, out, outlen) != 1) {
 		error_print();
 		return -1;
 	}
@@ -0,0 +1,1059 @@
+/*
+ *  Copyright 2014-2023 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/mem.h>
+#include <gmssl/asn1.h>
+#include <gmssl/pem.h>
+#include <gmssl/file.h>
+#include <gmssl/x509_cer.h>
+#include <gmssl/x509_scan.h>
+#include <gmssl/error.h>
+
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+typedef CRITICAL_SECTION scan_mutex_t;
+typedef CONDITION_VARIABLE scan_cond_t;
+typedef HANDLE scan_thread_t;
+#define scan_mutex_init(m)	InitializeCriticalSection(m)
+#define scan_mutex_destroy(m)	DeleteCriticalSection(m)
+#define scan_mutex_lock(m)	EnterCriticalSection(m)
+#define scan_mutex_unlock(m)	LeaveCriticalSection(m)
+#define scan_cond_init(c)	InitializeConditionVariable(c)
+#define scan_cond_destroy(c)
+#define scan_cond_wait(c, m)	SleepConditionVariableCS(c, m, INFINITE)
+#define scan_cond_signal(c)	WakeConditionVariable(c)
+#define scan_cond_broadcast(c)	WakeAllConditionVariable(c)
+#else
+#include <unistd.h>
+#include <pthread.h>
+typedef pthread_mutex_t scan_mutex_t;
+typedef pthread_cond_t scan_cond_t;
+typedef pthread_t scan_thread_t;
+#define scan_mutex_init(m)	pthread_mutex_init(m, NULL)
+#define scan_mutex_destroy(m)	pthread_mutex_destroy(m)
+#define scan_mutex_lock(m)	pthread_mutex_lock(m)
+#define scan_mutex_unlock(m)	pthread_mutex_unlock(m)
+#define scan_cond_init(c)	pthread_cond_init(c, NULL)
+#define scan_cond_destroy(c)	pthread_cond_destroy(c)
+#define scan_cond_wait(c, m)	pthread_cond_wait(c, m)
+#define scan_cond_signal(c)	pthread_cond_signal(c)
+#define scan_cond_broadcast(c)	pthread_cond_broadcast(c)
+#endif
+
+
+static const char *x509_scan_field_names[] = {
+	"serial",
+	"issuer",
+	"subject",
+	"not_before",
+	"not_after",
+	"sig_alg",
+	"key_alg",
+	"key_param",
+	"gm",
+};
+
+#define X509_SCAN_FIELDS_CNT	(sizeof(x509_scan_field_names)/sizeof(x509_scan_field_names[0]))
+
+int x509_scan_fields_from_names(const char *names, int *fields)
+{
+	const char *p = names;
+	size_t len;
+	size_t i;
+
+	if (!names || !fields) {
+		error_print();
+		return -1;
+	}
+	*fields = 0;
+	while (*p) {
+		len = strcspn(p, ",");
+		if (len == 3 && !memcmp(p, "all", 3)) {
+			*fields |= X509_SCAN_ALL_FIELDS;
+		} else {
+			for (i = 0; i < X509_SCAN_FIELDS_CNT; i++) {
+				if (strlen(x509_scan_field_names[i]) == len
+					&& !memcmp(p, x509_scan_field_names[i], len)) {
+					*fields |= 1 << i;
+					break;
+				}
+			}
+			if (i == X509_SCAN_FIELDS_CNT) {
+				error_print();
+				return -1;
+			}
+		}
+		p += len;
+		if (*p == ',') {
+			p++;
+		}
+	}
+	if (!*fields) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_scan_print_header(FILE *fp, int fields, int out_format)
+{
+	int first = 1;
+	size_t i;
+
+	if (out_format != X509_SCAN_CSV) {
+		return 1;
+	}
+	for (i = 0; i < X509_SCAN_FIELDS_CNT; i++) {
+		if (fields & (1 << i)) {
+			fprintf(fp, "%s%s", first ? "" : ",", x509_scan_field_names[i]);
+			first = 0;
+		}
+	}
+	fprintf(fp, "\n");
+	return 1;
+}
+
+
+typedef struct {
+	uint8_t *p;
+	size_t len;
+	size_t maxlen;
+} X509_SCAN_BUF;
+
+static int scan_buf_reserve(X509_SCAN_BUF *b, size_t n)
+{
+	size_t maxlen;
+	uint8_t *p;
+
+	if (b->maxlen - b->len >= n) {
+		return 1;
+	}
+	maxlen = b->maxlen ? b->maxlen * 2 : 4096;
+	while (maxlen - b->len < n) {
+		maxlen *= 2;
+	}
+	if (!(p = (uint8_t *)realloc(b->p, maxlen))) {
+		error_print();
+		return -1;
+	}
+	b->p = p;
+	b->maxlen = maxlen;
+	return 1;
+}
+
+static int scan_buf_put(X509_SCAN_BUF *b, const void *d, size_t dlen)
+{
+	if (scan_buf_reserve(b, dlen) != 1) {
+		return -1;
+	}
+	memcpy(b->p + b->len, d, dlen);
+	b->len += dlen;
+	return 1;
+}
+
+static int scan_buf_puts(X509_SCAN_BUF *b, const char *s)
+{
+	return scan_buf_put(b, s, strlen(s));
+}
+
+static int scan_buf_putc(X509_SCAN_BUF *b, uint8_t c)
+{
+	return scan_buf_put(b, &c, 1);
+}
+
+static int scan_put_utf8(X509_SCAN_BUF *b, uint32_t c)
+{
+	uint8_t u[4];
+	size_t n;
+
+	if (c < 0x80) {
+		u[0] = (uint8_t)c;
+		n = 1;
+	} else if (c < 0x800) {
+		u[0] = (uint8_t)(0xc0 | (c >> 6));
+		u[1] = (uint8_t)(0x80 | (c & 0x3f));
+		n = 2;
+	} else if (c < 0x10000) {
+		u[0] = (uint8_t)(0xe0 | (c >> 12));
+		u[1] = (uint8_t)(0x80 | ((c >> 6) & 0x3f));
+		u[2] = (uint8_t)(0x80 | (c & 0x3f));
+		n = 3;
+	} else if (c < 0x110000) {
+		u[0] = (uint8_t)(0xf0 | (c >> 18));
+		u[1] = (uint8_t)(0x80 | ((c >> 12) & 0x3f));
+		u[2] = (uint8_t)(0x80 | ((c >> 6) & 0x3f));
+		u[3] = (uint8_t)(0x80 | (c & 0x3f));
+		n = 4;
+	} else {
+		u[0] = '?';
+		n = 1;
+	}
+	return scan_buf_put(b, u, n);
+}
+
+// BMPString and UniversalString are converted to UTF-8, other non-UTF8 strings are taken as Latin-1
+static int scan_put_string(X509_SCAN_BUF *b, int tag, const uint8_t *d, size_t dlen)
+{
+	size_t i;
+
+	switch (tag) {
+	case ASN1_TAG_UTF8String:
+		return scan_buf_put(b, d, dlen);
+	case ASN1_TAG_BMPString:
+		for (i = 0; i + 1 < dlen; i += 2) {
+			if (scan_put_utf8(b, ((uint32_t)d[i] << 8) | d[i + 1]) != 1) {
+				return -1;
+			}
+		}
+		return 1;
+	case ASN1_TAG_UniversalString:
+		for (i = 0; i + 3 < dlen; i += 4) {
+			if (scan_put_utf8(b, ((uint32_t)d[i] << 24) | ((uint32_t)d[i + 1] << 16)
+				| ((uint32_t)d[i + 2] << 8) | d[i + 3]) != 1) {
+				return -1;
+			}
+		}
+		return 1;
+	}
+	for (i = 0; i < dlen; i++) {
+		if (scan_put_utf8(b, d[i]) != 1) {
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int scan_put_oid(X509_SCAN_BUF *b, const uint32_t *nodes, size_t nodes_cnt)
+{
+	char s[16];
+	size_t i;
+
+	for (i = 0; i < nodes_cnt; i++) {
+		snprintf(s, sizeof(s), i ? ".%u" : "%u", (unsigned int)nodes[i]);
+		if (scan_buf_puts(b, s) != 1) {
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int scan_put_time(X509_SCAN_BUF *b, time_t t)
+{
+	// days to civil date, proleptic Gregorian, no gmtime() for the worker threads
+	int64_t days = (int64_t)t / 86400;
+	int64_t secs = (int64_t)t % 86400;
+	int64_t z, era, doe, yoe, doy, mp, y, m, d;
+	char s[64];
+
+	if (secs < 0) {
+		secs += 86400;
+		days--;
+	}
+	z = days + 719468;
+	era = (z >= 0 ? z : z - 146096) / 146097;
+	doe = z - era * 146097;
+	yoe = (doe - doe/1460 + doe/36524 - doe/146096) / 365;
+	doy = doe - (365*yoe + yoe/4 - yoe/100);
+	mp = (5*doy + 2) / 153;
+	d = doy - (153*mp + 2)/5 + 1;
+	m = mp < 10 ? mp + 3 : mp - 9;
+	y = yoe + era * 400 + (m <= 2);
+
+	snprintf(s, sizeof(s), "%04d-%02d-%02dT%02d:%02d:%02dZ", (int)y, (int)m, (int)d,
+		(int)(secs / 3600), (int)(secs / 60 % 60), (int)(secs % 60));
+	return scan_buf_puts(b, s);
+}
+
+static const char *scan_attr_type_name(const uint32_t *nodes, size_t nodes_cnt)
+{
+	static const uint32_t email[] = { 1,2,840,113549,1,9,1 };
+	static const uint32_t dc[] = { 0,9,2342,19200300,100,1,25 };
+
+	if (nodes_cnt == 4 && nodes[0] == 2 && nodes[1] == 5 && nodes[2] == 4) {
+		switch (nodes[3]) {
+		case 3: return "CN";
+		case 4: return "SN";
+		case 5: return "serialNumber";
+		case 6: return "C";
+		case 7: return "L";
+		case 8: return "ST";
+		case 9: return "street";
+		case 10: return "O";
+		case 11: return "OU";
+		case 12: return "title";
+		case 42: return "GN";
+		}
+	}
+	if (nodes_cnt == 7 && !memcmp(nodes, email, sizeof(email))) {
+		return "emailAddress";
+	}
+	if (nodes_cnt == 7 && !memcmp(nodes, dc, sizeof(dc))) {
+		return "DC";
+	}
+	return NULL;
+}
+
+// Name as "C=CN,O=...,CN=..." in DER order, "+" between the values of a multi-valued RDN
+static int scan_put_name(X509_SCAN_BUF *b, const uint8_t *d, size_t dlen)
+{
+	const uint8_t *rdn;
+	size_t rdnlen;
+	const uint8_t *atv;
+	size_t atvlen;
+	uint32_t nodes[ASN1_OID_MAX_NODES];
+	size_t nodes_cnt;
+	const char *name;
+	int tag;
+	const uint8_t *val;
+	size_t vlen;
+	size_t start = b->len;
+	int first;
+
+	while (dlen) {
+		if (asn1_set_from_der(&rdn, &rdnlen, &d, &dlen) != 1) {
+			error_print();
+			return -1;
+		}
+		first = 1;
+		while (rdnlen) {
+			if (asn1_sequence_from_der(&atv, &atvlen, &rdn, &rdnlen) != 1
+				|| asn1_object_identifier_from_der(nodes, &nodes_cnt, &atv, &atvlen) != 1
+				|| asn1_any_type_from_der(&tag, &val, &vlen, &atv, &atvlen) != 1
+				|| asn1_length_is_zero(atvlen) != 1) {
+				error_print();
+				return -1;
+			}
+			if (b->len > start && scan_buf_putc(b, first ? ',' : '+') != 1) {
+				return -1;
+			}
+			if ((name = scan_attr_type_name(nodes, nodes_cnt)) != NULL) {
+				if (scan_buf_puts(b, name) != 1) {
+					return -1;
+				}
+			} else if (scan_put_oid(b, nodes, nodes_cnt) != 1) {
+				return -1;
+			}
+			if (scan_buf_putc(b, '=') != 1
+				|| scan_put_string(b, tag, val, vlen) != 1) {
+				return -1;
+			}
+			first = 0;
+		}
+	}
+	return 1;
+}
+
+// one value of a line, `val` is NULL for the JSON null and `quoted` is 0 for JSON literals
+static int scan_put_value(X509_SCAN_BUF *out, int out_format, int first, const char *name,
+	const uint8_t *val, size_t vlen, int quoted)
+{
+	char esc[8];
+	size_t i;
+
+	if (out_format == X509_SCAN_CSV) {
+		if (!first && scan_buf_putc(out, ',') != 1) {
+			return -1;
+		}
+		for (i = 0; i < vlen; i++) {
+			if (val[i] == ',' || val[i] == '"' || val[i] == '\n' || val[i] == '\r') {
+				break;
+			}
+		}
+		if (i == vlen) {
+			return vlen ? scan_buf_put(out, val, vlen) : 1;
+		}
+		if (scan_buf_putc(out, '"') != 1) {
+			return -1;
+		}
+		for (i = 0; i < vlen; i++) {
+			if ((val[i] == '"' && scan_buf_putc(out, '"') != 1)
+				|| scan_buf_putc(out, val[i]) != 1) {
+				return -1;
+			}
+		}
+		return scan_buf_putc(out, '"');
+	}
+
+	if (scan_buf_puts(out, first ? "{\"" : ",\"") != 1
+		|| scan_buf_puts(out, name) != 1
+		|| scan_buf_puts(out, "\":") != 1) {
+		return -1;
+	}
+	if (!val) {
+		return scan_buf_puts(out, "null");
+	}
+	if (!quoted) {
+		return scan_buf_put(out, val, vlen);
+	}
+	if (scan_buf_putc(out, '"') != 1) {
+		return -1;
+	}
+	for (i = 0; i < vlen; i++) {
+		if (val[i] == '"' || val[i] == '\\') {
+			esc[0] = '\\';
+			esc[1] = (char)val[i];
+			esc[2] = 0;
+		} else if (val[i] < 0x20) {
+			snprintf(esc, sizeof(esc), "\\u%04x", val[i]);
+		} else {
+			if (scan_buf_putc(out, val[i]) != 1) {
+				return -1;
+			}
+			continue;
+		}
+		if (scan_buf_puts(out, esc) != 1) {
+			return -1;
+		}
+	}
+	return scan_buf_putc(out, '"');
+}
+
+static int scan_oid_is_gm(const uint32_t *nodes, size_t nodes_cnt)
+{
+	static const uint32_t gm[] = { 1,2,156,10197 };
+	return nodes_cnt >= 4 && !memcmp(nodes, gm, sizeof(gm));
+}
+
+typedef struct {
+	uint32_t nodes[ASN1_OID_MAX_NODES];
+	size_t nodes_cnt; // 0 when absent
+} X509_SCAN_OID;
+
+static int scan_get_algors(const X509_CERT_INDEX *idx,
+	X509_SCAN_OID *sig_alg, X509_SCAN_OID *key_alg, X509_SCAN_OID *key_param)
+{
+	int tag;
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *alg;
+	size_t alglen;
+
+	if (asn1_cursor_get(&idx->tbs, idx->serial_number + 1, &tag, &d, &dlen) != 1
+		|| asn1_check(tag == ASN1_TAG_SEQUENCE) != 1
+		|| asn1_object_identifier_from_der(sig_alg->nodes, &sig_alg->nodes_cnt, &d, &dlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (asn1_cursor_get(&idx->tbs, idx->serial_number + 5, &tag, &d, &dlen) != 1
+		|| asn1_check(tag == ASN1_TAG_SEQUENCE) != 1
+		|| asn1_sequence_from_der(&alg, &alglen, &d, &dlen) != 1
+		|| asn1_object_identifier_from_der(key_alg->nodes, &key_alg->nodes_cnt, &alg, &alglen) != 1) {
+		error_print();
+		return -1;
+	}
+	key_param->nodes_cnt = 0;
+	if (alglen && alg[0] == ASN1_TAG_OBJECT_IDENTIFIER
+		&& asn1_object_identifier_from_der(key_param->nodes, &key_param->nodes_cnt, &alg, &alglen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// append the line of one certificate to `out`, nothing is appended on error
+static int x509_scan_cert(const uint8_t *cert, size_t certlen, int fields, int out_format,
+	X509_SCAN_BUF *out, X509_SCAN_BUF *val)
+{
+	X509_CERT_INDEX idx;
+	X509_SCAN_OID algors[3]; // signature, public key, public key parameter
+	int have_algors = 0;
+	size_t mark = out->len;
+	int first = 1;
+	int tag;
+	const uint8_t *d;
+	size_t dlen;
+	time_t t;
+	size_t i;
+
+	if (x509_cert_index_init(&idx, cert, certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < X509_SCAN_FIELDS_CNT; i++) {
+		int field = 1 << i;
+		const uint8_t *v;
+		int quoted = 1;
+
+		if (!(fields & field)) {
+			continue;
+		}
+		if ((field & (X509_SCAN_SIGNATURE_ALGOR|X509_SCAN_PUBLIC_KEY_ALGOR
+			|X509_SCAN_PUBLIC_KEY_PARAM|X509_SCAN_GM)) && !have_algors) {
+			if (scan_get_algors(&idx, &algors[0], &algors[1], &algors[2]) != 1) {
+				goto err;
+			}
+			have_algors = 1;
+		}
+
+		val->len = 0;
+		switch (field) {
+		case X509_SCAN_SERIAL_NUMBER:
+			if (asn1_cursor_get(&idx.tbs, idx.serial_number, &tag, &d, &dlen) != 1
+				|| asn1_check(tag == ASN1_TAG_INTEGER && dlen > 0) != 1) {
+				error_print();
+				goto err;
+			}
+			if (dlen > 1 && d[0] == 0) {
+				d++;
+				dlen--;
+			}
+			if (scan_buf_reserve(val, dlen * 2) != 1) {
+				goto err;
+			}
+			for (; dlen; d++, dlen--) {
+				val->p[val->len++] = "0123456789ABCDEF"[*d >> 4];
+				val->p[val->len++] = "0123456789ABCDEF"[*d & 0x0f];
+			}
+			break;
+		case X509_SCAN_ISSUER:
+			if (x509_cert_index_get_issuer(&idx, &d, &dlen) != 1
+				|| scan_put_name(val, d, dlen) != 1) {
+				goto err;
+			}
+			break;
+		case X509_SCAN_SUBJECT:
+			if (x509_cert_index_get_subject(&idx, &d, &dlen) != 1
+				|| scan_put_name(val, d, dlen) != 1) {
+				goto err;
+			}
+			break;
+		case X509_SCAN_NOT_BEFORE:
+		case X509_SCAN_NOT_AFTER:
+			// not x509_validity_from_der(), notBefore >= notAfter is reported, not rejected
+			if (asn1_cursor_get(&idx.tbs, idx.serial_number + 3, &tag, &d, &dlen) != 1
+				|| asn1_check(tag == ASN1_TAG_SEQUENCE) != 1
+				|| x509_time_from_der(&t, &d, &dlen) != 1
+				|| (field == X509_SCAN_NOT_AFTER && x509_time_from_der(&t, &d, &dlen) != 1)
+				|| scan_put_time(val, t) != 1) {
+				error_print();
+				goto err;
+			}
+			break;
+		case X509_SCAN_SIGNATURE_ALGOR:
+		case X509_SCAN_PUBLIC_KEY_ALGOR:
+		case X509_SCAN_PUBLIC_KEY_PARAM:
+			{
+				const X509_SCAN_OID *oid = &algors[field == X509_SCAN_SIGNATURE_ALGOR ? 0
+					: (field == X509_SCAN_PUBLIC_KEY_ALGOR ? 1 : 2)];
+				if (scan_put_oid(val, oid->nodes, oid->nodes_cnt) != 1) {
+					goto err;
+				}
+			}
+			break;
+		case X509_SCAN_GM:
+			quoted = 0;
+			if (scan_oid_is_gm(algors[0].nodes, algors[0].nodes_cnt)
+				|| scan_oid_is_gm(algors[1].nodes, algors[1].nodes_cnt)
+				|| scan_oid_is_gm(algors[2].nodes, algors[2].nodes_cnt)) {
+				if (scan_buf_puts(val, out_format == X509_SCAN_CSV ? "1" : "true") != 1) goto err;
+			} else {
+				if (scan_buf_puts(val, out_format == X509_SCAN_CSV ? "0" : "false") != 1) goto err;
+			}
+			break;
+		}
+
+		v = val->p ? val->p : (const uint8_t *)"";
+		if (field == X509_SCAN_PUBLIC_KEY_PARAM && !algors[2].nodes_cnt) {
+			v = NULL;
+		}
+		if (scan_put_value(out, out_format, first, x509_scan_field_names[i], v, val->len, quoted) != 1) {
+			goto err;
+		}
+		first = 0;
+	}
+	if (scan_buf_puts(out, out_format == X509_SCAN_CSV ? "\n" : "}\n") != 1) {
+		goto err;
+	}
+	return 1;
+err:
+	out->len = mark;
+	return -1;
+}
+
+
+static const char x509_scan_pem_begin[] = "-----BEGIN CERTIFICATE-----";
+static const char x509_scan_pem_end[] = "-----END CERTIFICATE-----";
+
+static const uint8_t *scan_find(const uint8_t *p, const uint8_t *end, const char *s, size_t slen)
+{
+	while ((size_t)(end - p) >= slen) {
+		if (!(p = memchr(p, s[0], (size_t)(end - p) - slen + 1))) {
+			return NULL;
+		}
+		if (memcmp(p, s, slen) == 0) {
+			return p;
+		}
+		p++;
+	}
+	return NULL;
+}
+
+// Return 1 with the next record at in + *off, 0 if no complete record is left with *off bytes
+// that can be skipped, -1 if the DER framing is broken. Only the headers are read.
+static int x509_scan_next_record(const uint8_t *in, size_t inlen, int in_format, size_t *off, size_t *len)
+{
+	if (in_format == X509_SCAN_DER) {
+		size_t hlen, dlen = 0;
+		size_t i, n;
+
+		*off = 0;
+		if (inlen < 2) {
+			return 0;
+		}
+		if (in[0] != ASN1_TAG_SEQUENCE) {
+			error_print();
+			return -1;
+		}
+		if (in[1] < 0x80) {
+			hlen = 2;
+			dlen = in[1];
+		} else {
+			if ((n = in[1] & 0x7f) < 1 || n > 4) {
+				error_print();
+				return -1;
+			}
+			if (inlen < 2 + n) {
+				return 0;
+			}
+			for (i = 0; i < n; i++) {
+				dlen = (dlen << 8) | in[2 + i];
+			}
+			hlen = 2 + n;
+		}
+		if (dlen > inlen - hlen) {
+			return 0;
+		}
+		*len = hlen + dlen;
+		return 1;
+	} else {
+		const uint8_t *end = in + inlen;
+		const uint8_t *begin;
+		const uint8_t *p;
+
+		if (!(begin = scan_find(in, end, x509_scan_pem_begin, sizeof(x509_scan_pem_begin) - 1))) {
+			// keep a tail that is the start of a BEGIN line
+			size_t k = inlen < sizeof(x509_scan_pem_begin) - 2 ? inlen : sizeof(x509_scan_pem_begin) - 2;
+			while (k && memcmp(end - k, x509_scan_pem_begin, k) != 0) {
+				k--;
+			}
+			*off = inlen - k;
+			return 0;
+		}
+		*off = begin - in;
+		if (!(p = scan_find(begin, end, x509_scan_pem_end, sizeof(x509_scan_pem_end) - 1))) {
+			return 0;
+		}
+		*len = (p + sizeof(x509_scan_pem_end) - 1) - begin;
+		return 1;
+	}
+}
+
+
+enum {
+	X509_SCAN_CHUNK_EMPTY,
+	X509_SCAN_CHUNK_READY,
+	X509_SCAN_CHUNK_DONE,
+};
+
+typedef struct {
+	size_t start;
+	size_t end;
+	X509_SCAN_BUF out;
+	size_t certs;
+	size_t errors;
+	int ret;
+	int state;
+} X509_SCAN_CHUNK;
+
+typedef struct {
+	const uint8_t *in;
+	int in_format;
+	int fields;
+	int out_format;
+	X509_SCAN_CHUNK *ring;
+	size_t ring_size;
+	size_t head; // chunks split
+	size_t next; // chunks taken by the workers
+	int done; // no more chunks
+	scan_mutex_t mutex;
+	scan_cond_t work; // head or done changed
+	scan_cond_t ready; // a chunk is done
+} X509_SCAN_POOL;
+
+static void x509_scan_chunk(const X509_SCAN_POOL *pool, X509_SCAN_CHUNK *chunk,
+	X509_SCAN_BUF *val, uint8_t *cert_buf)
+{
+	const uint8_t *p = pool->in + chunk->start;
+	size_t len = chunk->end - chunk->start;
+	size_t off, reclen;
+
+	chunk->out.len = 0;
+	chunk->certs = 0;
+	chunk->errors = 0;
+	chunk->ret = 1;
+
+	while (x509_scan_next_record(p, len, pool->in_format, &off, &reclen) == 1) {
+		const uint8_t *cert = p + off;
+		size_t certlen = reclen;
+
+		p += off + reclen;
+		len -= off + reclen;
+
+		if (pool->in_format == X509_SCAN_PEM) {
+			const uint8_t *rec = cert;
+			size_t recl = reclen;
+			if (pem_decode("CERTIFICATE", &rec, &recl, cert_buf, &certlen, X509_SCAN_MAX_CERT_SIZE) != 1) {
+				chunk->errors++;
+				continue;
+			}
+			cert = cert_buf;
+		}
+		if (x509_scan_cert(cert, certlen, pool->fields, pool->out_format, &chunk->out, val) != 1) {
+			chunk->errors++;
+			continue;
+		}
+		chunk->certs++;
+	}
+	if (!chunk->out.p && scan_buf_reserve(&chunk->out, 1) != 1) {
+		chunk->ret = -1;
+	}
+}
+
+// a chunk of whole records of about X509_SCAN_CHUNK_SIZE bytes from *pos, return 0 when nothing is left
+static int x509_scan_split(const uint8_t *in, size_t inlen, int in_format, size_t *pos, X509_SCAN_CHUNK *chunk)
+{
+	size_t off, reclen;
+	int ret;
+
+	chunk->start = *pos;
+	while (*pos - chunk->start < X509_SCAN_CHUNK_SIZE) {
+		if ((ret = x509_scan_next_record(in + *pos, inlen - *pos, in_format, &off, &reclen)) < 0) {
+			error_print();
+			return -1;
+		}
+		if (!ret) {
+			*pos += off;
+			break;
+		}
+		*pos += off + reclen;
+	}
+	chunk->end = *pos;
+	return chunk->end > chunk->start ? 1 : 0;
+}
+
+#ifdef _WIN32
+static unsigned __stdcall x509_scan_worker(void *arg)
+#else
+static void *x509_scan_worker(void *arg)
+#endif
+{
+	X509_SCAN_POOL *pool = (X509_SCAN_POOL *)arg;
+	X509_SCAN_BUF val = {0};
+	uint8_t *cert_buf = NULL;
+	X509_SCAN_CHUNK *chunk;
+	int ret = 1;
+
+	if (pool->in_format == X509_SCAN_PEM && !(cert_buf = (uint8_t *)malloc(X509_SCAN_MAX_CERT_SIZE))) {
+		error_print();
+		ret = -1;
+	}
+
+	scan_mutex_lock(&pool->mutex);
+	for (;;) {
+		while (pool->next == pool->head && !pool->done) {
+			scan_cond_wait(&pool->work, &pool->mutex);
+		}
+		if (pool->next == pool->head) {
+			break;
+		}
+		chunk = &pool->ring[pool->next++ % pool->ring_size];
+		scan_mutex_unlock(&pool->mutex);
+
+		if (ret == 1) {
+			x509_scan_chunk(pool, chunk, &val, cert_buf);
+		} else {
+			chunk->ret = -1;
+		}
+
+		scan_mutex_lock(&pool->mutex);
+		chunk->state = X509_SCAN_CHUNK_DONE;
+		scan_cond_broadcast(&pool->ready);
+	}
+	scan_mutex_unlock(&pool->mutex);
+
+	free(val.p);
+	free(cert_buf);
+#ifdef _WIN32
+	return 0;
+#else
+	return NULL;
+#endif
+}
+
+static int online_cpus(void)
+{
+#ifdef _WIN32
+	SYSTEM_INFO info;
+	GetSystemInfo(&info);
+	return (int)info.dwNumberOfProcessors;
+#else
+	long n = sysconf(_SC_NPROCESSORS_ONLN);
+	return n > 0 ? (int)n : 1;
+#endif
+}
+
+static int x509_scan_write(X509_SCAN_CHUNK *chunk, FILE *out, size_t *certs_cnt, size_t *errors_cnt)
+{
+	if (chunk->ret != 1) {
+		error_print();
+		return -1;
+	}
+	if (chunk->out.len && fwrite(chunk->out.p, 1, chunk->out.len, out) != chunk->out.len) {
+		error_print();
+		return -1;
+	}
+	*certs_cnt += chunk->certs;
+	*errors_cnt += chunk->errors;
+	return 1;
+}
+
+int x509_certs_scan(const uint8_t *in, size_t inlen, int in_format,
+	int fields, int out_format, FILE *out, int threads,
+	size_t *consumed, size_t *certs_cnt, size_t *errors_cnt)
+{
+	X509_SCAN_POOL pool;
+	scan_thread_t tids[X509_SCAN_MAX_THREADS];
+	int started = 0;
+	size_t tail = 0;
+	int split_ret = 1;
+	int ret = 1;
+	size_t i;
+
+	if ((!in && inlen) || !out || !consumed || !certs_cnt || !errors_cnt
+		|| (in_format != X509_SCAN_DER && in_format != X509_SCAN_PEM)
+		|| (out_format != X509_SCAN_CSV && out_format != X509_SCAN_JSON)
+		|| !(fields & X509_SCAN_ALL_FIELDS)) {
+		error_print();
+		return -1;
+	}
+	*consumed = 0;
+	*certs_cnt = 0;
+	*errors_cnt = 0;
+	if (!inlen) {
+		return 1;
+	}
+
+	if (threads <= 0) {
+		threads = online_cpus();
+	}
+	if (threads > X509_SCAN_MAX_THREADS) {
+		threads = X509_SCAN_MAX_THREADS;
+	}
+
+	memset(&pool, 0, sizeof(pool));
+	pool.in = in;
+	pool.in_format = in_format;
+	pool.fields = fields;
+	pool.out_format = out_format;
+	pool.ring_size = (size_t)threads * 4;
+	if (!(pool.ring = (X509_SCAN_CHUNK *)calloc(pool.ring_size, sizeof(X509_SCAN_CHUNK)))) {
+		error_print();
+		return -1;
+	}
+
+	// a single thread splits, scans and writes one chunk at a time
+	if (threads == 1) {
+		X509_SCAN_BUF val = {0};
+		uint8_t *cert_buf = NULL;
+
+		if (in_format == X509_SCAN_PEM && !(cert_buf = (uint8_t *)malloc(X509_SCAN_MAX_CERT_SIZE))) {
+			error_print();
+			ret = -1;
+		}
+		while (ret == 1 && (split_ret = x509_scan_split(in, inlen, in_format, consumed, &pool.ring[0])) == 1) {
+			x509_scan_chunk(&pool, &pool.ring[0], &val, cert_buf);
+			if (x509_scan_write(&pool.ring[0], out, certs_cnt, errors_cnt) != 1) {
+				ret = -1;
+			}
+		}
+		free(val.p);
+		free(cert_buf);
+		goto end;
+	}
+
+	scan_mutex_init(&pool.mutex);
+	scan_cond_init(&pool.work);
+	scan_cond_init(&pool.ready);
+	for (i = 0; i < (size_t)threads; i++) {
+#ifdef _WIN32
+		if (!(tids[i] = (HANDLE)_beginthreadex(NULL, 0, x509_scan_worker, &pool, 0, NULL))) {
+			break;
+		}
+#else
+		if (pthread_create(&tids[i], NULL, x509_scan_worker, &pool) != 0) {
+			break;
+		}
+#endif
+		started++;
+	}
+	if (!started) {
+		error_print();
+		ret = -1;
+		pool.done = 1;
+	}
+
+	// the calling thread keeps the ring filled and writes the chunks in order
+	scan_mutex_lock(&pool.mutex);
+	while (!pool.done || tail < pool.head) {
+		X509_SCAN_CHUNK *chunk;
+
+		if (tail < pool.head && pool.ring[tail % pool.ring_size].state == X509_SCAN_CHUNK_DONE) {
+			chunk = &pool.ring[tail % pool.ring_size];
+			scan_mutex_unlock(&pool.mutex);
+			if (ret == 1 && x509_scan_write(chunk, out, certs_cnt, errors_cnt) != 1) {
+				ret = -1;
+			}
+			scan_mutex_lock(&pool.mutex);
+			chunk->state = X509_SCAN_CHUNK_EMPTY;
+			tail++;
+			continue;
+		}
+		if (!pool.done && pool.head - tail < pool.ring_size) {
+			// the slot is not seen by the workers before head is moved
+			chunk = &pool.ring[pool.head % pool.ring_size];
+			scan_mutex_unlock(&pool.mutex);
+			split_ret = ret == 1 ? x509_scan_split(in, inlen, in_format, consumed, chunk) : 0;
+			scan_mutex_lock(&pool.mutex);
+			if (split_ret == 1) {
+				chunk->state = X509_SCAN_CHUNK_READY;
+				pool.head++;
+			} else {
+				pool.done = 1;
+			}
+			scan_cond_broadcast(&pool.work);
+			continue;
+		}
+		scan_cond_wait(&pool.ready, &pool.mutex);
+	}
+	scan_mutex_unlock(&pool.mutex);
+
+	for (i = 0; i < (size_t)started; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(tids[i], INFINITE);
+		CloseHandle(tids[i]);
+#else
+		pthread_join(tids[i], NULL);
+#endif
+	}
+	scan_cond_destroy(&pool.ready);
+	scan_cond_destroy(&pool.work);
+	scan_mutex_destroy(&pool.mutex);
+
+end:
+	for (i = 0; i < pool.ring_size; i++) {
+		free(pool.ring[i].out.p);
+	}
+	free(pool.ring);
+	if (split_ret < 0) {
+		error_print();
+		ret = -1;
+	}
+	return ret;
+}
+
+// records split across the chunks of the reader are completed in `carry`,
+// at most X509_SCAN_BRIDGE_SIZE bytes of the next chunk are copied to find their end
+#define X509_SCAN_BRIDGE_SIZE	(2 * X509_SCAN_MAX_CERT_SIZE)
+
+int x509_certs_scan_fp(FILE *in, int in_format,
+	int fields, int out_format, FILE *out, int threads,
+	size_t *certs_cnt, size_t *errors_cnt)
+{
+	int ret = -1;
+	FILE_READER reader;
+	X509_SCAN_BUF carry = {0};
+	const uint8_t *data;
+	size_t datalen;
+	size_t consumed, certs, errors;
+	int rv;
+
+	if (!in || !out || !certs_cnt || !errors_cnt) {
+		error_print();
+		return -1;
+	}
+	*certs_cnt = 0;
+	*errors_cnt = 0;
+	if (file_read_init(&reader, in, 0) != 1) {
+		error_print();
+		return -1;
+	}
+
+	while ((rv = file_read_next(&reader, &data, &datalen)) == 1) {
+		if (carry.len) {
+			size_t old = carry.len;
+			size_t n = datalen < X509_SCAN_BRIDGE_SIZE ? datalen : X509_SCAN_BRIDGE_SIZE;
+
+			if (scan_buf_put(&carry, data, n) != 1
+				|| x509_certs_scan(carry.p, carry.len, in_format, fields, out_format, out, 1,
+					&consumed, &certs, &errors) != 1) {
+				error_print();
+				goto end;
+			}
+			*certs_cnt += certs;
+			*errors_cnt += errors;
+			if (consumed < old) {
+				// still incomplete, keep the whole chunk
+				memmove(carry.p, carry.p + consumed, carry.len - consumed);
+				carry.len -= consumed;
+				if (scan_buf_put(&carry, data + n, datalen - n) != 1) {
+					goto end;
+				}
+				continue;
+			}
+			carry.len = 0;
+			data += consumed - old;
+			datalen -= consumed - old;
+		}
+
+		if (x509_certs_scan(data, datalen, in_format, fields, out_format, out, threads,
+			&consumed, &certs, &errors) != 1) {
+			error_print();
+			goto end;
+		}
+		*certs_cnt += certs;
+		*errors_cnt += errors;
+		if (scan_buf_put(&carry, data + consumed, datalen - consumed) != 1) {
+			goto end;
+		}
+	}
+	if (rv < 0) {
+		error_print();
+		goto end;
+	}
+
+	// a truncated certificate at the end of input
+	if (carry.len) {
+		if (in_format == X509_SCAN_DER
+			|| scan_find(carry.p, carry.p + carry.len, x509_scan_pem_begin, sizeof(x509_scan_pem_begin) - 1)) {
+			(*errors_cnt)++;
+		}
+	}
+	ret = 1;
+
+end:
+	free(carry.p);
+	file_read_cleanup(&reader);
+	return ret;
+}
@@ -0,0 +1,479 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/x509.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+
+
+// FNV-1a, the inputs are DER encodings from the trusted configuration
+static size_t store_hash(const uint8_t *a, size_t alen, const uint8_t *b, size_t blen)
+{
+	uint32_t h = 2166136261u;
+	size_t i;
+
+	for (i = 0; i < alen; i++) {
+		h = (h ^ a[i]) * 16777619u;
+	}
+	for (i = 0; i < blen; i++) {
+		h = (h ^ b[i]) * 16777619u;
+	}
+	return (size_t)h;
+}
+
+int x509_store_init(X509_STORE *store, const uint8_t *certs, size_t certslen)
+{
+	const uint8_t *d = certs;
+	size_t dlen = certslen;
+	const uint8_t *cert;
+	size_t certlen;
+	X509_STORE_ENTRY *e;
+	size_t cnt = 0;
+	size_t mask, h;
+	size_t i;
+	int ret;
+
+	if (!store || (!certs && certslen)) {
+		error_print();
+		return -1;
+	}
+	memset(store, 0, sizeof(*store));
+
+	while (dlen) {
+		if (x509_cert_from_der(&cert, &certlen, &d, &dlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cnt++;
+	}
+
+	store->buckets_cnt = 16;
+	while (store->buckets_cnt < cnt) {
+		store->buckets_cnt <<= 1;
+	}
+	if (!(store->entries = (X509_STORE_ENTRY *)calloc(cnt ? cnt : 1, sizeof(X509_STORE_ENTRY)))
+		|| !(store->subject_buckets = (size_t *)calloc(store->buckets_cnt, sizeof(size_t)))
+		|| !(store->key_id_buckets = (size_t *)calloc(store->buckets_cnt, sizeof(size_t)))
+		|| !(store->issuer_serial_buckets = (size_t *)calloc(store->buckets_cnt, sizeof(size_t)))) {
+		x509_store_cleanup(store);
+		error_print();
+		return -1;
+	}
+
+	d = certs;
+	dlen = certslen;
+	for (i = 0; i < cnt; i++) {
+		e = &store->entries[i];
+		if (asn1_any_from_der(&e->cert, &e->certlen, &d, &dlen) != 1
+			|| x509_cert_get_subject(e->cert, e->certlen, &e->subject, &e->subject_len) != 1
+			|| x509_cert_get_issuer_and_serial_number(e->cert, e->certlen,
+				&e->issuer, &e->issuer_len, &e->serial, &e->serial_len) != 1
+			|| (ret = x509_cert_get_subject_key_identifier(e->cert, e->certlen,
+				&e->key_id, &e->key_id_len)) < 0) {
+			x509_store_cleanup(store);
+			error_print();
+			return -1;
+		}
+	}
+	store->entries_cnt = cnt;
+
+	// pushed to the bucket heads in reverse order, so the first certificate wins a tie
+	mask = store->buckets_cnt - 1;
+	for (i = cnt; i > 0; i--) {
+		e = &store->entries[i - 1];
+
+		h = store_hash(e->subject, e->subject_len, NULL, 0) & mask;
+		e->subject_next = store->subject_buckets[h];
+		store->subject_buckets[h] = i;
+
+		if (e->key_id) {
+			h = store_hash(e->key_id, e->key_id_len, NULL, 0) & mask;
+			e->key_id_next = store->key_id_buckets[h];
+			store->key_id_buckets[h] = i;
+		}
+
+		h = store_hash(e->issuer, e->issuer_len, e->serial, e->serial_len) & mask;
+		e->issuer_serial_next = store->issuer_serial_buckets[h];
+		store->issuer_serial_buckets[h] = i;
+	}
+	return 1;
+}
+
+size_t x509_store_get_count(const X509_STORE *store)
+{
+	return store ? store->entries_cnt : 0;
+}
+
+static const X509_STORE_ENTRY *store_find_subject(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len)
+{
+	const X509_STORE_ENTRY *e;
+	size_t i;
+
+	if (store->entries_cnt) {
+		i = store->subject_buckets[store_hash(subject, subject_len, NULL, 0) & (store->buckets_cnt - 1)];
+		for (; i; i = e->subject_next) {
+			e = &store->entries[i - 1];
+			if (x509_name_equ(e->subject, e->subject_len, subject, subject_len) == 1) {
+				return e;
+			}
+		}
+	}
+	return NULL;
+}
+
+int x509_store_get_cert_by_subject(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len,
+	const uint8_t **cert, size_t *certlen)
+{
+	const X509_STORE_ENTRY *e;
+
+	if (!store || !subject || !cert || !certlen) {
+		error_print();
+		return -1;
+	}
+	if ((e = store_find_subject(store, subject, subject_len)) != NULL) {
+		*cert = e->cert;
+		*certlen = e->certlen;
+		return 1;
+	}
+	*cert = NULL;
+	*certlen = 0;
+	return 0;
+}
+
+int x509_store_get_public_key_by_subject(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len, SM2_KEY *public_key)
+{
+	const X509_STORE_ENTRY *e;
+	SM2_Z256_POINT point;
+
+	if (!store || !subject || !public_key) {
+		error_print();
+		return -1;
+	}
+	if (!(e = store_find_subject(store, subject, subject_len))) {
+		return 0;
+	}
+	if (e->public_key) {
+		if (sm2_z256_point_from_bytes(&point, e->public_key) != 1
+			|| sm2_key_set_public_key(public_key, &point) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (x509_cert_get_subject_public_key(e->cert, e->certlen, public_key) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+int x509_store_get_cert_by_subject_and_key_identifier(const X509_STORE *store,
+	const uint8_t *subject, size_t subject_len,
+	const uint8_t *key_id, size_t key_id_len,
+	const uint8_t **cert, size_t *certlen)
+{
+	const X509_STORE_ENTRY *e;
+	size_t i;
+
+	if (!store || !subject || !key_id || !cert || !certlen) {
+		error_print();
+		return -1;
+	}
+	if (store->entries_cnt) {
+		i = store->key_id_buckets[store_hash(key_id, key_id_len, NULL, 0) & (store->buckets_cnt - 1)];
+		for (; i; i = e->key_id_next) {
+			e = &store->entries[i - 1];
+			if (e->key_id_len == key_id_len && memcmp(e->key_id, key_id, key_id_len) == 0
+				&& x509_name_equ(e->subject, e->subject_len, subject, subject_len) == 1) {
+				*cert = e->cert;
+				*certlen = e->certlen;
+				return 1;
+			}
+		}
+	}
+	*cert = NULL;
+	*certlen = 0;
+	return 0;
+}
+
+int x509_store_get_cert_by_issuer_and_serial_number(const X509_STORE *store,
+	const uint8_t *issuer, size_t issuer_len,
+	const uint8_t *serial, size_t serial_len,
+	const uint8_t **cert, size_t *certlen)
+{
+	const X509_STORE_ENTRY *e;
+	size_t i;
+
+	if (!store || !issuer || !serial || !cert || !certlen) {
+		error_print();
+		return -1;
+	}
+	if (store->entries_cnt) {
+		i = store->issuer_serial_buckets[store_hash(issuer, issuer_len, serial, serial_len) & (store->buckets_cnt - 1)];
+		for (; i; i = e->issuer_serial_next) {
+			e = &store->entries[i - 1];
+			if (e->serial_len == serial_len && memcmp(e->serial, serial, serial_len) == 0
+				&& x509_name_equ(e->issuer, e->issuer_len, issuer, issuer_len) == 1) {
+				*cert = e->cert;
+				*certlen = e->certlen;
+				return 1;
+			}
+		}
+	}
+	*cert = NULL;
+	*certlen = 0;
+	return 0;
+}
+
+void x509_store_cleanup(X509_STORE *store)
+{
+	if (store) {
+		free(store->entries);
+		free(store->subject_buckets);
+		free(store->key_id_buckets);
+		free(store->issuer_serial_buckets);
+		memset(store, 0, sizeof(*store));
+	}
+}
+
+
+#define SNAPSHOT_MAGIC		"GMSSLCAS"
+#define SNAPSHOT_HEADER_SIZE	(8 + 4 * 4)
+#define SNAPSHOT_ENTRY_SIZE	(4 * 14 + 64)
+
+static uint8_t *snapshot_put_u32(uint8_t *p, size_t a)
+{
+	PUTU32(p, (uint32_t)a);
+	return p + 4;
+}
+
+static uint8_t *snapshot_put_field(uint8_t *p, const uint8_t *base, const uint8_t *field, size_t len)
+{
+	p = snapshot_put_u32(p, field ? (size_t)(field - base) : 0);
+	return snapshot_put_u32(p, len);
+}
+
+int x509_store_snapshot(const uint8_t *certs, size_t certslen, uint8_t *out, size_t *outlen)
+{
+	X509_STORE store;
+	const X509_STORE_ENTRY *e;
+	SM2_KEY public_key;
+	SM3_CTX sm3_ctx;
+	uint8_t *p = out;
+	size_t len;
+	size_t i;
+
+	if (!outlen) {
+		error_print();
+		return -1;
+	}
+	if (certslen > UINT32_MAX) {
+		error_print();
+		return -1;
+	}
+	if (x509_store_init(&store, certs, certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (store.entries_cnt > X509_STORE_SNAPSHOT_MAX_CERTS) {
+		x509_store_cleanup(&store);
+		error_print();
+		return -1;
+	}
+	len = SNAPSHOT_HEADER_SIZE
+		+ SNAPSHOT_ENTRY_SIZE * store.entries_cnt
+		+ 4 * 3 * store.buckets_cnt
+		+ certslen
+		+ SM3_DIGEST_SIZE;
+	if (!out) {
+		x509_store_cleanup(&store);
+		*outlen = len;
+		return 1;
+	}
+
+	memcpy(p, SNAPSHOT_MAGIC, 8);
+	p += 8;
+	p = snapshot_put_u32(p, X509_STORE_SNAPSHOT_VERSION);
+	p = snapshot_put_u32(p, store.entries_cnt);
+	p = snapshot_put_u32(p, store.buckets_cnt);
+	p = snapshot_put_u32(p, certslen);
+
+	for (i = 0; i < store.entries_cnt; i++) {
+		e = &store.entries[i];
+		p = snapshot_put_field(p, certs, e->cert, e->certlen);
+		p = snapshot_put_field(p, certs, e->subject, e->subject_len);
+		p = snapshot_put_field(p, certs, e->key_id, e->key_id_len);
+		p = snapshot_put_field(p, certs, e->issuer, e->issuer_len);
+		p = snapshot_put_field(p, certs, e->serial, e->serial_len);
+		p = snapshot_put_u32(p, e->subject_next);
+		p = snapshot_put_u32(p, e->key_id_next);
+		p = snapshot_put_u32(p, e->issuer_serial_next);
+		// certificates of other key types are kept, without a decoded key
+		if (x509_cert_get_subject_public_key(e->cert, e->certlen, &public_key) == 1) {
+			p = snapshot_put_u32(p, 1);
+			sm2_z256_point_to_bytes(&public_key.public_key, p);
+		} else {
+			p = snapshot_put_u32(p, 0);
+			memset(p, 0, 64);
+		}
+		p += 64;
+	}
+	for (i = 0; i < store.buckets_cnt; i++) {
+		p = snapshot_put_u32(p, store.subject_buckets[i]);
+	}
+	for (i = 0; i < store.buckets_cnt; i++) {
+		p = snapshot_put_u32(p, store.key_id_buckets[i]);
+	}
+	for (i = 0; i < store.buckets_cnt; i++) {
+		p = snapshot_put_u32(p, store.issuer_serial_buckets[i]);
+	}
+	if (certslen) {
+		memcpy(p, certs, certslen);
+		p += certslen;
+	}
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, out, p - out);
+	sm3_finish(&sm3_ctx, p);
+
+	x509_store_cleanup(&store);
+	*outlen = len;
+	return 1;
+}
+
+static int snapshot_get_field(const uint8_t **field, size_t *len, const uint8_t *base, size_t baselen,
+	const uint8_t *in, int optional)
+{
+	size_t offset = GETU32(in);
+
+	*len = GETU32(in + 4);
+	if (optional && !*len) {
+		*field = NULL;
+		return 1;
+	}
+	if (offset > baselen || *len > baselen - offset) {
+		error_print();
+		return -1;
+	}
+	*field = base + offset;
+	return 1;
+}
+
+// a chain only goes to the later entries, as built by x509_store_init(), so every lookup ends
+static int snapshot_get_next(size_t *next, const uint8_t *in, size_t index, size_t cnt)
+{
+	*next = GETU32(in);
+	if (*next && (*next <= index || *next > cnt)) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+int x509_store_init_from_snapshot(X509_STORE *store, const uint8_t *snapshot, size_t snapshot_len,
+	const uint8_t **certs, size_t *certslen)
+{
+	const uint8_t *p = snapshot;
+	const uint8_t *entries;
+	const uint8_t *buckets;
+	X509_STORE_ENTRY *e;
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	size_t cnt, buckets_cnt, len;
+	size_t i;
+
+	if (!store || !snapshot || !certs || !certslen) {
+		error_print();
+		return -1;
+	}
+	memset(store, 0, sizeof(*store));
+
+	if (snapshot_len < SNAPSHOT_HEADER_SIZE + SM3_DIGEST_SIZE
+		|| memcmp(p, SNAPSHOT_MAGIC, 8) != 0) {
+		error_print();
+		return -1;
+	}
+	if (GETU32(p + 8) != X509_STORE_SNAPSHOT_VERSION) {
+		error_print();
+		return -1;
+	}
+	cnt = GETU32(p + 12);
+	buckets_cnt = GETU32(p + 16);
+	len = GETU32(p + 20);
+	if (cnt > X509_STORE_SNAPSHOT_MAX_CERTS
+		|| buckets_cnt < 16 || buckets_cnt > 2 * X509_STORE_SNAPSHOT_MAX_CERTS
+		|| (buckets_cnt & (buckets_cnt - 1))) {
+		error_print();
+		return -1;
+	}
+	if (len > snapshot_len
+		|| snapshot_len != SNAPSHOT_HEADER_SIZE + SNAPSHOT_ENTRY_SIZE * cnt
+		+ 4 * 3 * buckets_cnt + len + SM3_DIGEST_SIZE) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, snapshot, snapshot_len - SM3_DIGEST_SIZE);
+	sm3_finish(&sm3_ctx, dgst);
+	if (memcmp(dgst, snapshot + snapshot_len - SM3_DIGEST_SIZE, SM3_DIGEST_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+	entries = p + SNAPSHOT_HEADER_SIZE;
+	buckets = entries + SNAPSHOT_ENTRY_SIZE * cnt;
+	*certs = buckets + 4 * 3 * buckets_cnt;
+	*certslen = len;
+
+	store->buckets_cnt = buckets_cnt;
+	if (!(store->entries = (X509_STORE_ENTRY *)calloc(cnt ? cnt : 1, sizeof(X509_STORE_ENTRY)))
+		|| !(store->subject_buckets = (size_t *)calloc(buckets_cnt, sizeof(size_t)))
+		|| !(store->key_id_buckets = (size_t *)calloc(buckets_cnt, sizeof(size_t)))
+		|| !(store->issuer_serial_buckets = (size_t *)calloc(buckets_cnt, sizeof(size_t)))) {
+		x509_store_cleanup(store);
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < cnt; i++) {
+		e = &store->entries[i];
+		p = entries + SNAPSHOT_ENTRY_SIZE * i;
+		if (snapshot_get_field(&e->cert, &e->certlen, *certs, len, p, 0) != 1
+			|| snapshot_get_field(&e->subject, &e->subject_len, *certs, len, p + 8, 0) != 1
+			|| snapshot_get_field(&e->key_id, &e->key_id_len, *certs, len, p + 16, 1) != 1
+			|| snapshot_get_field(&e->issuer, &e->issuer_len, *certs, len, p + 24, 0) != 1
+			|| snapshot_get_field(&e->serial, &e->serial_len, *certs, len, p + 32, 0) != 1
+			|| snapshot_get_next(&e->subject_next, p + 40, i + 1, cnt) != 1
+			|| snapshot_get_next(&e->key_id_next, p + 44, i + 1, cnt) != 1
+			|| snapshot_get_next(&e->issuer_serial_next, p + 48, i + 1, cnt) != 1) {
+			x509_store_cleanup(store);
+			error_print();
+			return -1;
+		}
+		e->public_key = GETU32(p + 52) ? p + 56 : NULL;
+	}
+	for (i = 0; i < buckets_cnt; i++) {
+		if ((store->subject_buckets[i] = GETU32(buckets + 4 * i)) > cnt
+			|| (store->key_id_buckets[i] = GETU32(buckets + 4 * (buckets_cnt + i))) > cnt
+			|| (store->issuer_serial_buckets[i] = GETU32(buckets + 4 * (2 * buckets_cnt + i))) > cnt) {
+			x509_store_cleanup(store);
+			error_print();
+			return -1;
+		}
+	}
+	store->entries_cnt = cnt;
+	return 1;
+}
@@ -0,0 +1,277 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/error.h>
+#include <gmssl/thread_pool.h>
+
+
+
+int x509_chain_from_der(const uint8_t **chain, size_t *chainlen, const uint8_t **in, size_t *inlen)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *next;
+	size_t nextlen;
+	const uint8_t *subject;
+	size_t subject_len;
+	const uint8_t *p;
+	size_t len;
+
+	if (!chain || !chainlen || !in || !(*in) || !inlen) {
+		error_print();
+		return -1;
+	}
+	if (!(*inlen)) {
+		return 0;
+	}
+	*chain = *in;
+	if (x509_cert_from_der(&cert, &certlen, in, inlen) != 1) {
+		error_print();
+		return -1;
+	}
+	while (*inlen) {
+		p = *in;
+		len = *inlen;
+		if (x509_cert_from_der(&next, &nextlen, &p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		// a certificate that can not be parsed ends the chain, it is reported by the verification
+		if (x509_cert_get_issuer(cert, certlen, &issuer, &issuer_len) != 1
+			|| x509_cert_get_subject(next, nextlen, &subject, &subject_len) != 1
+			|| x509_name_equ(issuer, issuer_len, subject, subject_len) != 1) {
+			break;
+		}
+		cert = next;
+		certlen = nextlen;
+		*in = p;
+		*inlen = len;
+	}
+	*chainlen = (size_t)(*in - *chain);
+	return 1;
+}
+
+int x509_batch_verifier_init(X509_BATCH_VERIFIER *verifier,
+	const uint8_t *cacerts, size_t cacertslen, const uint8_t *crl, size_t crl_len,
+	const char *signer_id, size_t signer_id_len)
+{
+	const uint8_t *cacert;
+	size_t cacertlen;
+
+	if (!verifier || !cacerts || !cacertslen) {
+		error_print();
+		return -1;
+	}
+	if (!signer_id) {
+		signer_id = SM2_DEFAULT_ID;
+		signer_id_len = SM2_DEFAULT_ID_LENGTH;
+	}
+	if (signer_id_len > SM2_MAX_ID_LENGTH) {
+		error_print();
+		return -1;
+	}
+
+	memset(verifier, 0, sizeof(*verifier));
+	memcpy(verifier->signer_id, signer_id, signer_id_len);
+	verifier->signer_id_len = signer_id_len;
+
+	if (x509_store_init(&verifier->store, cacerts, cacertslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (crl) {
+		if (x509_crl_index_init(&verifier->crl_index, crl, crl_len) != 1) {
+			error_print();
+			goto err;
+		}
+		verifier->has_crl = 1;
+		if (x509_store_get_cert_by_subject(&verifier->store,
+				verifier->crl_index.issuer, verifier->crl_index.issuer_len, &cacert, &cacertlen) != 1
+			|| x509_crl_verify_by_ca_cert(crl, crl_len, cacert, cacertlen,
+				verifier->signer_id, verifier->signer_id_len) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	return 1;
+err:
+	x509_batch_verifier_cleanup(verifier);
+	return -1;
+}
+
+static int x509_batch_verify_chain(const X509_BATCH_VERIFIER *verifier, const uint8_t *chain, size_t chainlen)
+{
+	const uint8_t *cert;
+	size_t certlen;
+	const uint8_t *cacert;
+	size_t cacertlen;
+	const uint8_t *entity;
+	size_t entity_len;
+	const uint8_t *issuer;
+	size_t issuer_len;
+	const uint8_t *serial;
+	size_t serial_len;
+	time_t revoke_date;
+	const uint8_t *entry_exts;
+	size_t entry_exts_len;
+	int rv;
+
+	if (x509_cert_from_der(&cert, &certlen, &chain, &chainlen) != 1) {
+		return X509_BATCH_PARSE_ERROR;
+	}
+	entity = cert;
+	entity_len = certlen;
+
+	while (chainlen) {
+		if (x509_cert_from_der(&cacert, &cacertlen, &chain, &chainlen) != 1) {
+			return X509_BATCH_PARSE_ERROR;
+		}
+		if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
+			verifier->signer_id, verifier->signer_id_len) != 1) {
+			return X509_BATCH_BAD_SIGNATURE;
+		}
+		cert = cacert;
+		certlen = cacertlen;
+	}
+	if (x509_cert_get_issuer(cert, certlen, &issuer, &issuer_len) != 1) {
+		return X509_BATCH_PARSE_ERROR;
+	}
+	if (x509_store_get_cert_by_subject(&verifier->store, issuer, issuer_len, &cacert, &cacertlen) != 1) {
+		return X509_BATCH_UNKNOWN_ISSUER;
+	}
+	if (x509_cert_verify_by_ca_cert_cached(cert, certlen, cacert, cacertlen,
+		verifier->signer_id, verifier->signer_id_len) != 1) {
+		return X509_BATCH_BAD_SIGNATURE;
+	}
+
+	if (verifier->has_crl) {
+		if (x509_cert_get_issuer_and_serial_number(entity, entity_len,
+			&issuer, &issuer_len, &serial, &serial_len) != 1) {
+			return X509_BATCH_PARSE_ERROR;
+		}
+		if (x509_name_equ(issuer, issuer_len,
+			verifier->crl_index.issuer, verifier->crl_index.issuer_len) == 1) {
+			if ((rv = x509_crl_index_find_revoked_cert_by_serial_number(&verifier->crl_index,
+				serial, serial_len, &revoke_date, &entry_exts, &entry_exts_len)) < 0) {
+				return X509_BATCH_PARSE_ERROR;
+			}
+			if (rv) {
+				return X509_BATCH_REVOKED;
+			}
+		}
+	}
+	return X509_BATCH_VERIFIED;
+}
+
+typedef struct {
+	const X509_BATCH_VERIFIER *verifier;
+	X509_BATCH_RESULT *results;
+	size_t first;
+	size_t last;
+} X509_BATCH_JOB;
+
+static void x509_batch_job_run(X509_BATCH_JOB *job)
+{
+	size_t i;
+
+	for (i = job->first; i < job->last; i++) {
+		job->results[i].result = x509_batch_verify_chain(job->verifier,
+			job->results[i].chain, job->results[i].chainlen);
+	}
+}
+
+static void x509_batch_job_task(void *arg)
+{
+	x509_batch_job_run((X509_BATCH_JOB *)arg);
+}
+
+int x509_batch_verify(const X509_BATCH_VERIFIER *verifier, const uint8_t *certs, size_t certslen,
+	X509_BATCH_RESULT *results, size_t *results_cnt, size_t max_results, int threads)
+{
+	X509_BATCH_JOB jobs[X509_BATCH_MAX_THREADS];
+	const uint8_t *chain;
+	size_t chainlen;
+	size_t num = 0;
+	int rv;
+	int i;
+
+	if (!verifier || (!certs && certslen) || !results_cnt) {
+		error_print();
+		return -1;
+	}
+	while ((rv = x509_chain_from_der(&chain, &chainlen, &certs, &certslen)) == 1) {
+		if (results) {
+			if (num >= max_results) {
+				error_print();
+				return -1;
+			}
+			results[num].chain = chain;
+			results[num].chainlen = chainlen;
+			results[num].result = X509_BATCH_PARSE_ERROR;
+		}
+		num++;
+	}
+	if (rv < 0) {
+		error_print();
+		return -1;
+	}
+	*results_cnt = num;
+	if (!results || !num) {
+		return 1;
+	}
+
+	if (threads <= 0) {
+		threads = gmssl_thread_pool_size();
+	}
+	if (threads > X509_BATCH_MAX_THREADS) {
+		threads = X509_BATCH_MAX_THREADS;
+	}
+	if ((size_t)threads > num) {
+		threads = (int)num;
+	}
+
+	for (i = 0; i < threads; i++) {
+		jobs[i].verifier = verifier;
+		jobs[i].results = results;
+		jobs[i].first = (num * i) / threads;
+		jobs[i].last = (num * (i + 1)) / threads;
+	}
+	gmssl_thread_pool_run(x509_batch_job_task, jobs, sizeof(jobs[0]), (size_t)threads);
+	return 1;
+}
+
+const char *x509_batch_result_name(int result)
+{
+	switch (result) {
+	case X509_BATCH_VERIFIED: return "verified";
+	case X509_BATCH_PARSE_ERROR: return "parse_error";
+	case X509_BATCH_UNKNOWN_ISSUER: return "unknown_issuer";
+	case X509_BATCH_BAD_SIGNATURE: return "bad_signature";
+	case X509_BATCH_REVOKED: return "revoked";
+	}
+	return NULL;
+}
+
+void x509_batch_verifier_cleanup(X509_BATCH_VERIFIER *verifier)
+{
+	if (verifier) {
+		x509_store_cleanup(&verifier->store);
+		x509_crl_index_cleanup(&verifier->crl_index);
+		memset(verifier, 0, sizeof(*verifier));
+	}
+}
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm3.h>
+#include <gmssl/x509.h>
+#include <gmssl/error.h>
+#include <gmssl/metrics.h>
+
+#ifdef _WIN32
+#include <windows.h>
+static SRWLOCK cache_lock = SRWLOCK_INIT;
+#define cache_mutex_lock()	AcquireSRWLockExclusive(&cache_lock)
+#define cache_mutex_unlock()	ReleaseSRWLockExclusive(&cache_lock)
+#else
+#include <pthread.h>
+static pthread_mutex_t cache_lock = PTHREAD_MUTEX_INITIALIZER;
+#define cache_mutex_lock()	pthread_mutex_lock(&cache_lock)
+#define cache_mutex_unlock()	pthread_mutex_unlock(&cache_lock)
+#endif
+
+
+typedef struct {
+	uint8_t cert_dgst[SM3_DIGEST_SIZE];
+	uint8_t cacert_dgst[SM3_DIGEST_SIZE];
+	time_t not_before; // the later of the two certificates
+	time_t not_after; // the earlier of the two
+	uint64_t used; // 0 for a free way
+} VERIFY_CACHE_ENTRY;
+
+// set associative, the least recently used way of a set is replaced
+static VERIFY_CACHE_ENTRY cache[X509_VERIFY_CACHE_SETS][X509_VERIFY_CACHE_WAYS];
+static uint64_t cache_clock = 0;
+static size_t cache_hits = 0;
+static size_t cache_misses = 0;
+static int cache_disabled = 0;
+
+static VERIFY_CACHE_ENTRY *cache_set(const uint8_t cert_dgst[32], const uint8_t cacert_dgst[32])
+{
+	// the digests are uniform, a few bytes of each are enough
+	uint32_t h = ((uint32_t)cert_dgst[0] << 8 | cert_dgst[1]) ^ ((uint32_t)cacert_dgst[0] << 8 | cacert_dgst[1]);
+	return cache[h % X509_VERIFY_CACHE_SETS];
+}
+
+int x509_verify_cache_lookup(const uint8_t cert_dgst[32], const uint8_t cacert_dgst[32], time_t now)
+{
+	VERIFY_CACHE_ENTRY *set;
+	int ret = 0;
+	int i;
+
+	if (!cert_dgst || !cacert_dgst) {
+		error_print();
+		return -1;
+	}
+	set = cache_set(cert_dgst, cacert_dgst);
+
+	cache_mutex_lock();
+	if (!cache_disabled) {
+		for (i = 0; i < X509_VERIFY_CACHE_WAYS; i++) {
+			if (set[i].used
+				&& memcmp(set[i].cert_dgst, cert_dgst, 32) == 0
+				&& memcmp(set[i].cacert_dgst, cacert_dgst, 32) == 0) {
+				if (now >= set[i].not_before && now <= set[i].not_after) {
+					set[i].used = ++cache_clock;
+					ret = 1;
+				} else {
+					set[i].used = 0;
+				}
+				break;
+			}
+		}
+		if (ret) cache_hits++;
+		else cache_misses++;
+		METRICS_ADD(ret ? METRICS_x509_verify_cache_hits : METRICS_x509_verify_cache_misses, 1);
+	}
+	cache_mutex_unlock();
+	return ret;
+}
+
+int x509_verify_cache_add(const uint8_t cert_dgst[32], const uint8_t cacert_dgst[32],
+	time_t not_before, time_t not_after)
+{
+	VERIFY_CACHE_ENTRY *set;
+	VERIFY_CACHE_ENTRY *e;
+	int i;
+
+	if (!cert_dgst || !cacert_dgst || not_before > not_after) {
+		error_print();
+		return -1;
+	}
+	set = cache_set(cert_dgst, cacert_dgst);
+
+	cache_mutex_lock();
+	if (!cache_disabled) {
+		e = &set[0];
+		for (i = 0; i < X509_VERIFY_CACHE_WAYS; i++) {
+			if (set[i].used
+				&& memcmp(set[i].cert_dgst, cert_dgst, 32) == 0
+				&& memcmp(set[i].cacert_dgst, cacert_dgst, 32) == 0) {
+				e = &set[i];
+				break;
+			}
+			if (set[i].used < e->used) {
+				e = &set[i];
+			}
+		}
+		memcpy(e->cert_dgst, cert_dgst, 32);
+		memcpy(e->cacert_dgst, cacert_dgst, 32);
+		e->not_before = not_before;
+		e->not_after = not_after;
+		e->used = ++cache_clock;
+	}
+	cache_mutex_unlock();
+	return 1;
+}
+
+void x509_verify_cache_clear(void)
+{
+	cache_mutex_lock();
+	memset(cache, 0, sizeof(cache));
+	cache_hits = 0;
+	cache_misses = 0;
+	cache_mutex_unlock();
+}
+
+void x509_verify_cache_set_enabled(int enabled)
+{
+	cache_mutex_lock();
+	cache_disabled = enabled ? 0 : 1;
+	if (cache_disabled) {
+		memset(cache, 0, sizeof(cache));
+	}
+	cache_mutex_unlock();
+}
+
+void x509_verify_cache_get_stats(size_t *hits, size_t *misses)
+{
+	cache_mutex_lock();
+	if (hits) *hits = cache_hits;
+	if (misses) *misses = cache_misses;
+	cache_mutex_unlock();
+}
+
+static void cert_digest(const uint8_t *cert, size_t certlen, uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	SM3_CTX sm3_ctx;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, cert, certlen);
+	sm3_finish(&sm3_ctx, dgst);
+}
+
+int x509_cert_verify_by_ca_cert_cached(const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen,
+	const char *signer_id, size_t signer_id_len)
+{
+	uint8_t cert_dgst[SM3_DIGEST_SIZE];
+	uint8_t cacert_dgst[SM3_DIGEST_SIZE];
+	time_t not_before, not_after;
+	time_t ca_not_before, ca_not_after;
+	time_t now;
+	int ret;
+
+	// the cached links were verified with the default ID only
+	if (signer_id_len != SM2_DEFAULT_ID_LENGTH || memcmp(signer_id, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 0) {
+		return x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen, signer_id, signer_id_len);
+	}
+
+	cert_digest(cert, certlen, cert_dgst);
+	cert_digest(cacert, cacertlen, cacert_dgst);
+	time(&now);
+	if ((ret = x509_verify_cache_lookup(cert_dgst, cacert_dgst, now)) != 0) {
+		return ret;
+	}
+
+	if (x509_cert_verify_by_ca_cert(cert, certlen, cacert, cacertlen, signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_get_details(cert, certlen, NULL, NULL, NULL, NULL, NULL, NULL,
+			&not_before, &not_after, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) != 1
+		|| x509_cert_get_details(cacert, cacertlen, NULL, NULL, NULL, NULL, NULL, NULL,
+			&ca_not_before, &ca_not_after, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_verify_cache_add(cert_dgst, cacert_dgst,
+		not_before > ca_not_before ? not_before : ca_not_before,
+		not_after < ca_not_after ? not_after : ca_not_after) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
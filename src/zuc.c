@@ -12,6 +12,7 @@
 #include <string.h>
 #include <gmssl/zuc.h>
 #include <gmssl/mem.h>
+#include <gmssl/cpu.h>
 #include <gmssl/endian.h>
 
 
@@ -147,21 +148,25 @@ static const uint8_t S1[256] = {
 	(X0 ^ R1) + R2;					\
 	F_(X1, X2)
 
-void zuc_init(ZUC_STATE *state, const uint8_t *user_key, const uint8_t *iv)
+void zuc_load_key(ZUC_STATE *state, const uint8_t *user_key, const uint8_t *iv)
 {
-	ZUC_UINT31 *LFSR = state->LFSR;
-	uint32_t R1, R2;
-	uint32_t X0, X1, X2;
-	uint32_t W, W1, W2, U, V;
 	int i;
 
-
 	for (i = 0; i < 16; i++) {
-		LFSR[i] = MAKEU31(user_key[i], KD[i], iv[i]);
+		state->LFSR[i] = MAKEU31(user_key[i], KD[i], iv[i]);
 	}
+	state->R1 = 0;
+	state->R2 = 0;
+}
 
-	R1 = 0;
-	R2 = 0;
+static void zuc_init_rounds(ZUC_STATE *state)
+{
+	ZUC_UINT31 *LFSR = state->LFSR;
+	uint32_t R1 = state->R1;
+	uint32_t R2 = state->R2;
+	uint32_t X0, X1, X2;
+	uint32_t W, W1, W2, U, V;
+	int i;
 
 	for (i = 0; i < 32; i++) {
 		BitReconstruction3(X0, X1, X2);
@@ -177,6 +182,12 @@ void zuc_init(ZUC_STATE *state, const uint8_t *user_key, const uint8_t *iv)
 	state->R2 = R2;
 }
 
+void zuc_init(ZUC_STATE *state, const uint8_t *user_key, const uint8_t *iv)
+{
+	zuc_load_key(state, user_key, iv);
+	zuc_init_rounds(state);
+}
+
 uint32_t zuc_generate_keyword(ZUC_STATE *state)
 {
 	ZUC_UINT31 *LFSR = state->LFSR;
@@ -358,17 +369,46 @@ void zuc_mac_init(ZUC_MAC_CTX *ctx, const uint8_t key[16], const uint8_t iv[16])
 	ctx->K0 = zuc_generate_keyword((ZUC_STATE *)ctx);
 }
 
+static ZUC_UINT32 zuc_mac_words_generic(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream)
+{
+	ZUC_UINT32 T = 0;
+	ZUC_UINT32 M;
+	uint64_t K;
+	size_t j;
+	int i;
+
+	for (j = 0; j < nwords; j++) {
+		M = GETU32(data + 4 * j);
+		K = ((uint64_t)keystream[j] << 32) | keystream[j + 1];
+		for (i = 0; i < 32; i++) {
+			T ^= (ZUC_UINT32)(K >> (32 - i)) & ((ZUC_UINT32)0 - (M >> 31));
+			M <<= 1;
+		}
+	}
+	return T;
+}
+
+ZUC_UINT32 zuc_mac_words(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream)
+{
+#if defined(ENABLE_ZUC_PCLMUL)
+	if ((gmssl_cpu_features() & (GMSSL_CPU_PCLMUL|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_PCLMUL|GMSSL_CPU_SSSE3)) {
+		return zuc_mac_words_pclmul(data, nwords, keystream);
+	}
+#elif defined(ENABLE_ZUC_PMULL)
+	if (gmssl_cpu_features() & GMSSL_CPU_ARM_PMULL) {
+		return zuc_mac_words_pmull(data, nwords, keystream);
+	}
+#endif
+	return zuc_mac_words_generic(data, nwords, keystream);
+}
+
+// message words hashed per keystream chunk
+#define ZUC_MAC_CHUNK	64
+
 void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len)
 {
-	ZUC_UINT32 T = ctx->T;
-	ZUC_UINT32 K0 = ctx->K0;
-	ZUC_UINT32 K1, M;
-	ZUC_UINT31 *LFSR = ctx->LFSR;
-	ZUC_UINT32 R1 = ctx->R1;
-	ZUC_UINT32 R2 = ctx->R2;
-	ZUC_UINT32 X0, X1, X2, X3;
-	ZUC_UINT32 W1, W2, U, V;
-	size_t i;
+	ZUC_UINT32 keystream[1 + ZUC_MAC_CHUNK];
+	size_t nwords;
 
 	if (!data || !len) {
 		return;
@@ -383,54 +423,34 @@ void zuc_mac_update(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t len)
 		}
 
 		memcpy(ctx->buf + ctx->buflen, data, num);
-		M = GETU32(ctx->buf);
 		ctx->buflen = 0;
 
-		BitReconstruction4(X0, X1, X2, X3);
-		K1 = X3 ^ F(X0, X1, X2);
-		LFSRWithWorkMode();
-
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				T ^= K0;
-			}
-			M <<= 1;
-			K0 = (K0 << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
+		keystream[0] = ctx->K0;
+		keystream[1] = zuc_generate_keyword((ZUC_STATE *)ctx);
+		ctx->T ^= zuc_mac_words(ctx->buf, 1, keystream);
+		ctx->K0 = keystream[1];
 
 		data += num;
 		len -= num;
 	}
 
+	// K0 is the keystream word of the next message word
 	while (len >= 4) {
-		M = GETU32(data);
-
-		BitReconstruction4(X0, X1, X2, X3);
-		K1 = X3 ^ F(X0, X1, X2);
-		LFSRWithWorkMode();
-
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				T ^= K0;
-			}
-			M <<= 1;
-			K0 = (K0 << 1) | (K1 >> 31);
-			K1 <<= 1;
-		}
-
-		data += 4;
-		len -= 4;
+		nwords = len/4 < ZUC_MAC_CHUNK ? len/4 : ZUC_MAC_CHUNK;
+		keystream[0] = ctx->K0;
+		zuc_generate_keystream((ZUC_STATE *)ctx, nwords, keystream + 1);
+		ctx->T ^= zuc_mac_words(data, nwords, keystream);
+		ctx->K0 = keystream[nwords];
+
+		data += 4 * nwords;
+		len -= 4 * nwords;
 	}
 
 	if (len) {
 		memcpy(ctx->buf, data, len);
 		ctx->buflen = len;
 	}
-	ctx->R1 = R1;
-	ctx->R2 = R2;
-	ctx->K0 = K0;
-	ctx->T = T;
+	gmssl_secure_clear(keystream, sizeof(keystream));
 }
 
 void zuc_mac_finish(ZUC_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t mac[4])
@@ -514,15 +534,11 @@ static const ZUC_UINT7 ZUC256_D[][16] = {
 	  (uint32_t)(d))
 
 
-static void zuc256_set_mac_key(ZUC_STATE *key, const uint8_t K[32],
+static void zuc256_load_mac_key(ZUC_STATE *key, const uint8_t K[32],
 	const uint8_t IV[23], int macbits)
 {
 	ZUC_UINT31 *LFSR = key->LFSR;
-	uint32_t R1, R2;
-	uint32_t X0, X1, X2;
-	uint32_t W, W1, W2, U, V;
 	const ZUC_UINT7 *D;
-	int i;
 
 	ZUC_UINT6 IV17 = IV[17] >> 2;
 	ZUC_UINT6 IV18 = ((IV[17] & 0x3) << 4) | (IV[18] >> 4);
@@ -551,21 +567,20 @@ static void zuc256_set_mac_key(ZUC_STATE *key, const uint8_t K[32],
 	LFSR[14] = ZUC256_MAKEU31(K[14], (D[14] | (K[31] >> 4)), IV[16], IV[9]);
 	LFSR[15] = ZUC256_MAKEU31(K[15], (D[15] | (K[31] & 0x0F)), K[30], K[29]);
 
-	R1 = 0;
-	R2 = 0;
-
-	for (i = 0; i < 32; i++) {
-		BitReconstruction3(X0, X1, X2);
-		W = F(X0, X1, X2);
-		LFSRWithInitialisationMode(W >> 1);
-	}
+	key->R1 = 0;
+	key->R2 = 0;
+}
 
-	BitReconstruction2(X1, X2);
-	F_(X1, X2);
-	LFSRWithWorkMode();
+static void zuc256_set_mac_key(ZUC_STATE *key, const uint8_t K[32],
+	const uint8_t IV[23], int macbits)
+{
+	zuc256_load_mac_key(key, K, IV, macbits);
+	zuc_init_rounds(key);
+}
 
-	key->R1 = R1;
-	key->R2 = R2;
+void zuc256_load_key(ZUC256_STATE *key, const uint8_t K[32], const uint8_t IV[23])
+{
+	zuc256_load_mac_key(key, K, IV, 0);
 }
 
 void zuc256_init(ZUC_STATE *key, const uint8_t K[32],
@@ -598,14 +613,16 @@ void zuc256_mac_init(ZUC256_MAC_CTX *ctx, const uint8_t key[32],
 
 void zuc256_mac_update(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t len)
 {
-	ZUC_UINT32 K1, M;
+	ZUC_UINT32 keystream[4 + ZUC_MAC_CHUNK];
 	size_t n = ctx->macbits / 32;
-	size_t i, j;
+	size_t nwords;
+	size_t j;
 
 	if (!data || !len) {
 		return;
 	}
 
+	// the j-th word of the tag takes the windows starting j words later
 	if (ctx->buflen) {
 		size_t num = sizeof(ctx->buf) - ctx->buflen;
 		if (len < num) {
@@ -615,55 +632,37 @@ void zuc256_mac_update(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t len)
 		}
 
 		memcpy(ctx->buf + ctx->buflen, data, num);
-		M = GETU32(ctx->buf);
 		ctx->buflen = 0;
 
-		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
-
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				for (j = 0; j < n; j++) {
-					ctx->T[j] ^= ctx->K0[j];
-				}
-			}
-			M <<= 1;
-			for (j = 0; j < n - 1; j++) {
-				ctx->K0[j] = (ctx->K0[j] << 1) | (ctx->K0[j + 1] >> 31);
-			}
-			ctx->K0[j] = (ctx->K0[j] << 1) | (K1 >> 31);
-			K1 <<= 1;
+		memcpy(keystream, ctx->K0, 4 * n);
+		keystream[n] = zuc256_generate_keyword((ZUC256_STATE *)ctx);
+		for (j = 0; j < n; j++) {
+			ctx->T[j] ^= zuc_mac_words(ctx->buf, 1, keystream + j);
 		}
+		memcpy(ctx->K0, keystream + 1, 4 * n);
 
 		data += num;
 		len -= num;
 	}
 
 	while (len >= 4) {
-		M = GETU32(data);
-		K1 = zuc256_generate_keyword((ZUC256_STATE *)ctx);
-
-		for (i = 0; i < 32; i++) {
-			if (M & 0x80000000) {
-				for (j = 0; j < n; j++) {
-					ctx->T[j] ^= ctx->K0[j];
-				}
-			}
-			M <<= 1;
-			for (j = 0; j < n - 1; j++) {
-				ctx->K0[j] = (ctx->K0[j] << 1) | (ctx->K0[j + 1] >> 31);
-			}
-			ctx->K0[j] = (ctx->K0[j] << 1) | (K1 >> 31);
-			K1 <<= 1;
+		nwords = len/4 < ZUC_MAC_CHUNK ? len/4 : ZUC_MAC_CHUNK;
+		memcpy(keystream, ctx->K0, 4 * n);
+		zuc256_generate_keystream((ZUC256_STATE *)ctx, nwords, keystream + n);
+		for (j = 0; j < n; j++) {
+			ctx->T[j] ^= zuc_mac_words(data, nwords, keystream + j);
 		}
+		memcpy(ctx->K0, keystream + nwords, 4 * n);
 
-		data += 4;
-		len -= 4;
+		data += 4 * nwords;
+		len -= 4 * nwords;
 	}
 
 	if (len) {
 		memcpy(ctx->buf, data, len);
 		ctx->buflen = len;
 	}
+	gmssl_secure_clear(keystream, sizeof(keystream));
 }
 
 void zuc256_mac_finish(ZUC256_MAC_CTX *ctx, const uint8_t *data, size_t nbits, uint8_t *mac)
@@ -0,0 +1,198 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <string.h>
+#include <immintrin.h>
+#include <gmssl/zuc.h>
+#include <gmssl/mem.h>
+#include <gmssl/zuc_x16_avx512.h>
+
+
+/*
+ * ZUC in the 16 lanes of AVX-512F, as the AVX2 version with VPROLD for the
+ * rotations and VPTERNLOGD for the three input XORs.
+ */
+
+// 3 zero bytes on both sides, a gather at S0 + i - k returns S0[i] in byte k
+static const uint8_t S0_[3 + 256 + 3] = {
+	0x00,0x00,0x00,
+	0x3e,0x72,0x5b,0x47,0xca,0xe0,0x00,0x33,0x04,0xd1,0x54,0x98,0x09,0xb9,0x6d,0xcb,
+	0x7b,0x1b,0xf9,0x32,0xaf,0x9d,0x6a,0xa5,0xb8,0x2d,0xfc,0x1d,0x08,0x53,0x03,0x90,
+	0x4d,0x4e,0x84,0x99,0xe4,0xce,0xd9,0x91,0xdd,0xb6,0x85,0x48,0x8b,0x29,0x6e,0xac,
+	0xcd,0xc1,0xf8,0x1e,0x73,0x43,0x69,0xc6,0xb5,0xbd,0xfd,0x39,0x63,0x20,0xd4,0x38,
+	0x76,0x7d,0xb2,0xa7,0xcf,0xed,0x57,0xc5,0xf3,0x2c,0xbb,0x14,0x21,0x06,0x55,0x9b,
+	0xe3,0xef,0x5e,0x31,0x4f,0x7f,0x5a,0xa4,0x0d,0x82,0x51,0x49,0x5f,0xba,0x58,0x1c,
+	0x4a,0x16,0xd5,0x17,0xa8,0x92,0x24,0x1f,0x8c,0xff,0xd8,0xae,0x2e,0x01,0xd3,0xad,
+	0x3b,0x4b,0xda,0x46,0xeb,0xc9,0xde,0x9a,0x8f,0x87,0xd7,0x3a,0x80,0x6f,0x2f,0xc8,
+	0xb1,0xb4,0x37,0xf7,0x0a,0x22,0x13,0x28,0x7c,0xcc,0x3c,0x89,0xc7,0xc3,0x96,0x56,
+	0x07,0xbf,0x7e,0xf0,0x0b,0x2b,0x97,0x52,0x35,0x41,0x79,0x61,0xa6,0x4c,0x10,0xfe,
+	0xbc,0x26,0x95,0x88,0x8a,0xb0,0xa3,0xfb,0xc0,0x18,0x94,0xf2,0xe1,0xe5,0xe9,0x5d,
+	0xd0,0xdc,0x11,0x66,0x64,0x5c,0xec,0x59,0x42,0x75,0x12,0xf5,0x74,0x9c,0xaa,0x23,
+	0x0e,0x86,0xab,0xbe,0x2a,0x02,0xe7,0x67,0xe6,0x44,0xa2,0x6c,0xc2,0x93,0x9f,0xf1,
+	0xf6,0xfa,0x36,0xd2,0x50,0x68,0x9e,0x62,0x71,0x15,0x3d,0xd6,0x40,0xc4,0xe2,0x0f,
+	0x8e,0x83,0x77,0x6b,0x25,0x05,0x3f,0x0c,0x30,0xea,0x70,0xb7,0xa1,0xe8,0xa9,0x65,
+	0x8d,0x27,0x1a,0xdb,0x81,0xb3,0xa0,0xf4,0x45,0x7a,0x19,0xdf,0xee,0x78,0x34,0x60,
+	0x00,0x00,0x00,
+};
+
+static const uint8_t S1_[3 + 256 + 3] = {
+	0x00,0x00,0x00,
+	0x55,0xc2,0x63,0x71,0x3b,0xc8,0x47,0x86,0x9f,0x3c,0xda,0x5b,0x29,0xaa,0xfd,0x77,
+	0x8c,0xc5,0x94,0x0c,0xa6,0x1a,0x13,0x00,0xe3,0xa8,0x16,0x72,0x40,0xf9,0xf8,0x42,
+	0x44,0x26,0x68,0x96,0x81,0xd9,0x45,0x3e,0x10,0x76,0xc6,0xa7,0x8b,0x39,0x43,0xe1,
+	0x3a,0xb5,0x56,0x2a,0xc0,0x6d,0xb3,0x05,0x22,0x66,0xbf,0xdc,0x0b,0xfa,0x62,0x48,
+	0xdd,0x20,0x11,0x06,0x36,0xc9,0xc1,0xcf,0xf6,0x27,0x52,0xbb,0x69,0xf5,0xd4,0x87,
+	0x7f,0x84,0x4c,0xd2,0x9c,0x57,0xa4,0xbc,0x4f,0x9a,0xdf,0xfe,0xd6,0x8d,0x7a,0xeb,
+	0x2b,0x53,0xd8,0x5c,0xa1,0x14,0x17,0xfb,0x23,0xd5,0x7d,0x30,0x67,0x73,0x08,0x09,
+	0xee,0xb7,0x70,0x3f,0x61,0xb2,0x19,0x8e,0x4e,0xe5,0x4b,0x93,0x8f,0x5d,0xdb,0xa9,
+	0xad,0xf1,0xae,0x2e,0xcb,0x0d,0xfc,0xf4,0x2d,0x46,0x6e,0x1d,0x97,0xe8,0xd1,0xe9,
+	0x4d,0x37,0xa5,0x75,0x5e,0x83,0x9e,0xab,0x82,0x9d,0xb9,0x1c,0xe0,0xcd,0x49,0x89,
+	0x01,0xb6,0xbd,0x58,0x24,0xa2,0x5f,0x38,0x78,0x99,0x15,0x90,0x50,0xb8,0x95,0xe4,
+	0xd0,0x91,0xc7,0xce,0xed,0x0f,0xb4,0x6f,0xa0,0xcc,0xf0,0x02,0x4a,0x79,0xc3,0xde,
+	0xa3,0xef,0xea,0x51,0xe6,0x6b,0x18,0xec,0x1b,0x2c,0x80,0xf7,0x74,0xe7,0xff,0x21,
+	0x5a,0x6a,0x54,0x1e,0x41,0x31,0x92,0x35,0xc4,0x33,0x07,0x0a,0xba,0x7e,0x0e,0x34,
+	0x88,0xb1,0x98,0x7c,0xf3,0x3d,0x60,0x6c,0x7b,0xca,0xd3,0x1f,0x32,0x65,0x04,0x28,
+	0x64,0xbe,0x85,0x9b,0x2f,0x59,0x8a,0xd7,0xb0,0x25,0xac,0xaf,0x12,0x03,0xe2,0xf2,
+	0x00,0x00,0x00,
+};
+
+#define S0 (S0_ + 3)
+#define S1 (S1_ + 3)
+
+#define AND(a,b)	_mm512_and_si512((a), (b))
+#define OR(a,b)		_mm512_or_si512((a), (b))
+#define XOR(a,b)	_mm512_xor_si512((a), (b))
+#define ADD(a,b)	_mm512_add_epi32((a), (b))
+#define SLL(a,n)	_mm512_slli_epi32((a), (n))
+#define SRL(a,n)	_mm512_srli_epi32((a), (n))
+#define SET1(x)		_mm512_set1_epi32((int)(x))
+#define ROL(x,n)	_mm512_rol_epi32((x), (n))
+#define XOR3(x,y,z)	_mm512_ternarylogic_epi32((x), (y), (z), 0x96)
+#define GATHER(t,i)	_mm512_i32gather_epi32((i), (const void *)(t), 1)
+
+#define L1(x)	XOR3(XOR((x), ROL((x), 2)), XOR(ROL((x), 10), ROL((x), 18)), ROL((x), 24))
+#define L2(x)	XOR3(XOR((x), ROL((x), 8)), XOR(ROL((x), 14), ROL((x), 22)), ROL((x), 30))
+
+#define ROT31(a,k)	AND(OR(SLL((a), (k)), SRL((a), 31 - (k))), M31)
+#define ADD31(a,b)	a = ADD((a), (b)); a = ADD(AND((a), M31), SRL((a), 31))
+
+#define SBOX(x)								\
+	OR(OR(AND(GATHER(S0 - 3, SRL((x), 24)), SET1(0xff000000)),	\
+	      AND(GATHER(S1 - 2, AND(SRL((x), 16), FF)), SET1(0x00ff0000))), \
+	   OR(AND(GATHER(S0 - 1, AND(SRL((x), 8), FF)), SET1(0x0000ff00)), \
+	      AND(GATHER(S1, AND((x), FF)), FF)))
+
+// the LFSR is not shifted, s[(k + i) % 16] is the k-th cell in the i-th step
+#define LFSR(i,k)	s[((k) + (i)) & 15]
+
+#define BITRECONSTRUCTION(i)						\
+	X0 = OR(SLL(AND(LFSR(i, 15), SET1(0x7fff8000)), 1), AND(LFSR(i, 14), SET1(0xffff))); \
+	X1 = OR(SLL(LFSR(i, 11), 16), SRL(LFSR(i, 9), 15));			\
+	X2 = OR(SLL(LFSR(i, 7), 16), SRL(LFSR(i, 5), 15))
+
+#define FSM()								\
+	W1 = ADD(R1, X1);						\
+	W2 = XOR(R2, X2);						\
+	U = L1(OR(SLL(W1, 16), SRL(W2, 16)));				\
+	V = L2(OR(SLL(W2, 16), SRL(W1, 16)));				\
+	R1 = SBOX(U);							\
+	R2 = SBOX(V)
+
+#define LFSR_FEEDBACK(i)						\
+	V = LFSR(i, 0);							\
+	ADD31(V, ROT31(LFSR(i, 0), 8));					\
+	ADD31(V, ROT31(LFSR(i, 4), 20));					\
+	ADD31(V, ROT31(LFSR(i, 10), 21));					\
+	ADD31(V, ROT31(LFSR(i, 13), 17));					\
+	ADD31(V, ROT31(LFSR(i, 15), 15))
+
+#define INIT_STEP(i)							\
+	BITRECONSTRUCTION(i);						\
+	W = ADD(XOR(X0, R1), R2);					\
+	FSM();								\
+	LFSR_FEEDBACK(i);						\
+	ADD31(V, SRL(W, 1));						\
+	LFSR(i, 0) = V
+
+#define KEYSTREAM_STEP(i)						\
+	BITRECONSTRUCTION(i);						\
+	W = OR(SLL(LFSR(i, 2), 16), SRL(LFSR(i, 0), 15));			\
+	_mm512_storeu_si512((__m512i *)(keystream + 16 * (n + (i))), XOR(W, ADD(XOR(X0, R1), R2))); \
+	FSM();								\
+	LFSR_FEEDBACK(i);						\
+	LFSR(i, 0) = V
+
+#define STEPS16(STEP)							\
+	STEP(0); STEP(1); STEP(2); STEP(3);				\
+	STEP(4); STEP(5); STEP(6); STEP(7);				\
+	STEP(8); STEP(9); STEP(10); STEP(11);				\
+	STEP(12); STEP(13); STEP(14); STEP(15)
+
+// after a single step the cells are moved back to s[0..15]
+#define LFSR_SHIFT()							\
+	do {								\
+		int j;							\
+		V = s[0];						\
+		for (j = 0; j < 15; j++) s[j] = s[j + 1];		\
+		s[15] = V;						\
+	} while (0)
+
+void zuc_x16_generate_keystream_lanes(ZUC_STATE state[16], int init, size_t nwords, uint32_t *keystream)
+{
+	const __m512i M31 = SET1(0x7fffffff);
+	const __m512i FF = SET1(0xff);
+	const __m512i idx = _mm512_mullo_epi32(_mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7,
+		8, 9, 10, 11, 12, 13, 14, 15), SET1(sizeof(ZUC_STATE)));
+	__m512i s[16];
+	__m512i R1, R2, X0, X1, X2, W, W1, W2, U, V;
+	uint32_t buf[16];
+	size_t n = 0;
+	int k, j;
+
+	for (k = 0; k < 16; k++) {
+		s[k] = GATHER(&state[0].LFSR[k], idx);
+	}
+	R1 = GATHER(&state[0].R1, idx);
+	R2 = GATHER(&state[0].R2, idx);
+
+	if (init) {
+		STEPS16(INIT_STEP);
+		STEPS16(INIT_STEP);
+		BITRECONSTRUCTION(0);
+		FSM();
+		LFSR_FEEDBACK(0);
+		s[0] = V;
+		LFSR_SHIFT();
+	}
+
+	for (; n + 16 <= nwords; n += 16) {
+		STEPS16(KEYSTREAM_STEP);
+	}
+	for (; n < nwords; n++) {
+		KEYSTREAM_STEP(0);
+		LFSR_SHIFT();
+	}
+
+	for (k = 0; k < 16; k++) {
+		_mm512_storeu_si512((__m512i *)buf, s[k]);
+		for (j = 0; j < 16; j++) {
+			state[j].LFSR[k] = buf[j];
+		}
+	}
+	_mm512_storeu_si512((__m512i *)buf, R1);
+	for (j = 0; j < 16; j++) {
+		state[j].R1 = buf[j];
+	}
+	_mm512_storeu_si512((__m512i *)buf, R2);
+	for (j = 0; j < 16; j++) {
+		state[j].R2 = buf[j];
+	}
+	gmssl_secure_clear(buf, sizeof(buf));
+}
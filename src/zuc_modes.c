@@ -13,19 +13,34 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/zuc.h>
+#include <gmssl/cpu.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
 #include <gmssl/endian.h>
+#ifdef ENABLE_ZUC_AVX2
+#include <gmssl/zuc_x8_avx2.h>
+#endif
+#ifdef ENABLE_ZUC_AVX512
+#include <gmssl/zuc_x16_avx512.h>
+#endif
 
 
-static void zuc_set_eea_key(ZUC_STATE *key, const uint8_t user_key[16],
-	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+static void zuc_set_eea_iv(uint8_t iv[16], ZUC_UINT32 count, ZUC_UINT5 bearer,
+	ZUC_BIT direction)
 {
-	uint8_t iv[16] = {0};
+	memset(iv, 0, 16);
 	iv[0] = iv[8] = count >> 24;
 	iv[1] = iv[9] = count >> 16;
 	iv[2] = iv[10] = count >> 8;
 	iv[3] = iv[11] = count;
 	iv[4] = iv[12] = ((bearer << 1) | (direction & 1)) << 2;
+}
+
+static void zuc_set_eea_key(ZUC_STATE *key, const uint8_t user_key[16],
+	ZUC_UINT32 count, ZUC_UINT5 bearer, ZUC_BIT direction)
+{
+	uint8_t iv[16];
+	zuc_set_eea_iv(iv, count, bearer, direction);
 	zuc_init(key, user_key, iv);
 }
 
@@ -74,6 +89,245 @@ ZUC_UINT32 zuc_eia_generate_mac(const ZUC_UINT32 *data, size_t nbits,
 	return GETU32(mac);
 }
 
+/*
+ * The batch functions run the ZUC states of LANES jobs in the SIMD lanes, the
+ * keystream comes out ZUC_LANES_CHUNK words at a time. The idle lanes of the
+ * last group repeat the state of its first job, their words are dropped.
+ */
+#define ZUC_LANES_MAX		16
+#define ZUC_LANES_CHUNK		32
+
+typedef void (*ZUC_LANES_FUNC)(ZUC_STATE *state, int init, size_t nwords, uint32_t *keystream);
+
+enum {
+	ZUC_LANES_EEA,
+	ZUC_LANES_EIA,
+	ZUC256_LANES_ENCRYPT,
+};
+
+typedef struct {
+	const ZUC_PACKET *packet;
+	ZUC_UINT32 *mac;
+	const uint8_t *in;
+	size_t inlen;
+	uint8_t *out;
+	ZUC_UINT32 T;
+	ZUC_UINT32 K0;
+} ZUC_LANE;
+
+static int zuc_lanes_func(ZUC_LANES_FUNC *func)
+{
+#ifdef ENABLE_ZUC_AVX512
+	if (gmssl_cpu_features() & GMSSL_CPU_AVX512F) {
+		*func = zuc_x16_generate_keystream_lanes;
+		return 16;
+	}
+#endif
+#ifdef ENABLE_ZUC_AVX2
+	if (gmssl_cpu_features() & GMSSL_CPU_AVX2) {
+		*func = zuc_x8_generate_keystream_lanes;
+		return 8;
+	}
+#endif
+	(void)func;
+	return 0;
+}
+
+// the loaded state and the number of keystream words of a job
+static size_t zuc_lane_load(int mode, const ZUC_LANE *lane, const uint8_t *key, const uint8_t *iv,
+	ZUC_STATE *state)
+{
+	const ZUC_PACKET *packet = lane->packet;
+	uint8_t pkt_iv[16];
+
+	switch (mode) {
+	case ZUC_LANES_EEA:
+		zuc_set_eea_iv(pkt_iv, packet->count, packet->bearer, packet->direction);
+		zuc_load_key(state, packet->key, pkt_iv);
+		return ZUC_EEA_ENCRYPT_NWORDS(packet->nbits);
+	case ZUC_LANES_EIA:
+		zuc_set_eia_iv(pkt_iv, packet->count, packet->bearer, packet->direction);
+		zuc_load_key(state, packet->key, pkt_iv);
+		// K0 before the message and the final word after it
+		return ZUC_EEA_ENCRYPT_NWORDS(packet->nbits) + 2;
+	default:
+		zuc256_load_key(state, key, iv);
+		return (lane->inlen + 3)/4;
+	}
+}
+
+static void zuc_lane_consume(int mode, ZUC_LANE *lane, size_t w, ZUC_UINT32 Z)
+{
+	const ZUC_PACKET *packet = lane->packet;
+	size_t nwords;
+
+	switch (mode) {
+	case ZUC_LANES_EEA:
+		nwords = ZUC_EEA_ENCRYPT_NWORDS(packet->nbits);
+		packet->out[w] = packet->in[w] ^ Z;
+		if (w == nwords - 1 && packet->nbits % 32) {
+			packet->out[w] &= 0xffffffff << (32 - packet->nbits % 32);
+		}
+		break;
+
+	case ZUC_LANES_EIA:
+		// K0 keeps the previous keystream word, the message is read as bytes
+		nwords = ZUC_EEA_ENCRYPT_NWORDS(packet->nbits);
+		if (w == 0) {
+			lane->T = nwords ? 0 : Z;
+		} else if (w <= nwords) {
+			ZUC_UINT32 keystream[2];
+			ZUC_UINT32 M = GETU32((const uint8_t *)packet->in + 4 * (w - 1));
+			uint8_t word[4];
+			size_t r = packet->nbits % 32;
+
+			if (w == nwords && r) {
+				M &= 0xffffffff << (32 - r);
+			}
+			PUTU32(word, M);
+			keystream[0] = lane->K0;
+			keystream[1] = Z;
+			lane->T ^= zuc_mac_words(word, 1, keystream);
+			if (w == nwords) {
+				// the window at bit nbits
+				lane->T ^= r ? (lane->K0 << r) | (Z >> (32 - r)) : Z;
+			}
+		} else {
+			*lane->mac = lane->T ^ Z;
+		}
+		lane->K0 = Z;
+		break;
+
+	default:
+		if (4 * w + 4 <= lane->inlen) {
+			PUTU32(lane->out + 4 * w, Z ^ GETU32(lane->in + 4 * w));
+		} else {
+			uint8_t word[4];
+			size_t i;
+
+			PUTU32(word, Z);
+			for (i = 4 * w; i < lane->inlen; i++) {
+				lane->out[i] = lane->in[i] ^ word[i - 4 * w];
+			}
+		}
+	}
+}
+
+static void zuc_lanes_run(ZUC_LANES_FUNC func, size_t nlanes, int mode, ZUC_LANE *lanes, size_t num,
+	const uint8_t *const *keys, const uint8_t *const *ivs)
+{
+	ZUC_STATE state[ZUC_LANES_MAX];
+	size_t nwords[ZUC_LANES_MAX];
+	uint32_t keystream[ZUC_LANES_CHUNK * ZUC_LANES_MAX];
+	size_t i, j, m, w, pos, n, maxwords;
+
+	for (i = 0; i < num; i += nlanes) {
+		m = num - i < nlanes ? num - i : nlanes;
+		maxwords = 0;
+		for (j = 0; j < m; j++) {
+			nwords[j] = zuc_lane_load(mode, &lanes[i + j],
+				keys ? keys[i + j] : NULL, ivs ? ivs[i + j] : NULL, &state[j]);
+			if (nwords[j] > maxwords) {
+				maxwords = nwords[j];
+			}
+		}
+		for (; j < nlanes; j++) {
+			state[j] = state[0];
+		}
+
+		for (pos = 0; pos < maxwords; pos += n) {
+			n = maxwords - pos < ZUC_LANES_CHUNK ? maxwords - pos : ZUC_LANES_CHUNK;
+			func(state, pos == 0, n, keystream);
+			for (j = 0; j < m; j++) {
+				for (w = pos; w < pos + n && w < nwords[j]; w++) {
+					zuc_lane_consume(mode, &lanes[i + j], w, keystream[nlanes * (w - pos) + j]);
+				}
+			}
+		}
+	}
+	gmssl_secure_clear(state, sizeof(state));
+	gmssl_secure_clear(keystream, sizeof(keystream));
+}
+
+void zuc_eea_encrypt_packets(const ZUC_PACKET *packets, size_t npackets)
+{
+	ZUC_LANES_FUNC func;
+	ZUC_LANE lanes[ZUC_LANES_MAX];
+	size_t nlanes = zuc_lanes_func(&func);
+	size_t i, j, n;
+
+	if (!nlanes) {
+		for (i = 0; i < npackets; i++) {
+			zuc_eea_encrypt(packets[i].in, packets[i].out, packets[i].nbits,
+				packets[i].key, packets[i].count, packets[i].bearer, packets[i].direction);
+		}
+		return;
+	}
+	for (i = 0; i < npackets; i += n) {
+		n = npackets - i < ZUC_LANES_MAX ? npackets - i : ZUC_LANES_MAX;
+		memset(lanes, 0, sizeof(lanes));
+		for (j = 0; j < n; j++) {
+			lanes[j].packet = &packets[i + j];
+		}
+		zuc_lanes_run(func, nlanes, ZUC_LANES_EEA, lanes, n, NULL, NULL);
+	}
+}
+
+void zuc_eia_generate_mac_packets(const ZUC_PACKET *packets, size_t npackets, ZUC_UINT32 *macs)
+{
+	ZUC_LANES_FUNC func;
+	ZUC_LANE lanes[ZUC_LANES_MAX];
+	size_t nlanes = zuc_lanes_func(&func);
+	size_t i, j, n;
+
+	if (!nlanes) {
+		for (i = 0; i < npackets; i++) {
+			macs[i] = zuc_eia_generate_mac(packets[i].in, packets[i].nbits,
+				packets[i].key, packets[i].count, packets[i].bearer, packets[i].direction);
+		}
+		return;
+	}
+	for (i = 0; i < npackets; i += n) {
+		n = npackets - i < ZUC_LANES_MAX ? npackets - i : ZUC_LANES_MAX;
+		memset(lanes, 0, sizeof(lanes));
+		for (j = 0; j < n; j++) {
+			lanes[j].packet = &packets[i + j];
+			lanes[j].mac = &macs[i + j];
+		}
+		zuc_lanes_run(func, nlanes, ZUC_LANES_EIA, lanes, n, NULL, NULL);
+	}
+	gmssl_secure_clear(lanes, sizeof(lanes));
+}
+
+void zuc256_encrypt_batch(const uint8_t *const *keys, const uint8_t *const *ivs,
+	const uint8_t *const *ins, const size_t *inlens, uint8_t *const *outs, size_t num)
+{
+	ZUC_LANES_FUNC func;
+	ZUC_LANE lanes[ZUC_LANES_MAX];
+	size_t nlanes = zuc_lanes_func(&func);
+	size_t i, j, n;
+
+	if (!nlanes) {
+		ZUC256_STATE state;
+		for (i = 0; i < num; i++) {
+			zuc256_init(&state, keys[i], ivs[i]);
+			zuc_encrypt(&state, ins[i], inlens[i], outs[i]);
+		}
+		gmssl_secure_clear(&state, sizeof(state));
+		return;
+	}
+	for (i = 0; i < num; i += n) {
+		n = num - i < ZUC_LANES_MAX ? num - i : ZUC_LANES_MAX;
+		memset(lanes, 0, sizeof(lanes));
+		for (j = 0; j < n; j++) {
+			lanes[j].in = ins[i + j];
+			lanes[j].inlen = inlens[i + j];
+			lanes[j].out = outs[i + j];
+		}
+		zuc_lanes_run(func, nlanes, ZUC256_LANES_ENCRYPT, lanes, n, keys + i, ivs + i);
+	}
+}
+
 #define ZUC_BLOCK_SIZE 4
 
 int zuc_encrypt_init(ZUC_CTX *ctx, const uint8_t key[ZUC_KEY_SIZE], const uint8_t iv[ZUC_IV_SIZE])
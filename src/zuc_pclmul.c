@@ -0,0 +1,81 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+#include <gmssl/zuc.h>
+#include <immintrin.h>
+
+
+/*
+ * EIA3 word by word with PCLMULQDQ. For a message word M = m_0 .. m_31 (m_0 the
+ * most significant bit) and the keystream words Z_j, Z_j+1, the MAC xors
+ *
+ *	sum m_i * ((Z_j || Z_j+1) >> (32 - i)) mod 2^32
+ *
+ * which are the bits 32..63 of the carry-less product of the bit-reversed M
+ * and Z_j || Z_j+1. Each byte of the message is bit-reversed with PSHUFB, a
+ * little-endian load of the bytes then gives the reversed word. The products
+ * are xor-ed unreduced and the bits 32..63 taken once.
+ */
+
+static inline __m128i bitrev_bytes(__m128i x)
+{
+	const __m128i rev_lo = _mm_setr_epi8(
+		0x00, 0x80, 0x40, 0xc0, 0x20, 0xa0, 0x60, 0xe0,
+		0x10, 0x90, 0x50, 0xd0, 0x30, 0xb0, 0x70, 0xf0);
+	const __m128i rev_hi = _mm_setr_epi8(
+		0x00, 0x08, 0x04, 0x0c, 0x02, 0x0a, 0x06, 0x0e,
+		0x01, 0x09, 0x05, 0x0d, 0x03, 0x0b, 0x07, 0x0f);
+	const __m128i mask = _mm_set1_epi8(0x0f);
+
+	return _mm_or_si128(
+		_mm_shuffle_epi8(rev_lo, _mm_and_si128(x, mask)),
+		_mm_shuffle_epi8(rev_hi, _mm_and_si128(_mm_srli_epi16(x, 4), mask)));
+}
+
+ZUC_UINT32 zuc_mac_words_pclmul(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream)
+{
+	const __m128i zero = _mm_setzero_si128();
+	__m128i acc = zero;
+	__m128i x, m01, m23, z, k01, k23;
+	uint32_t word;
+
+	for (; nwords >= 4; nwords -= 4) {
+		x = bitrev_bytes(_mm_loadu_si128((const __m128i *)data));
+		m01 = _mm_unpacklo_epi32(x, zero);
+		m23 = _mm_unpackhi_epi32(x, zero);
+
+		// (Z_j || Z_j+1, Z_j+1 || Z_j+2) and (Z_j+2 || Z_j+3, Z_j+3 || Z_j+4)
+		z = _mm_loadu_si128((const __m128i *)keystream);
+		k01 = _mm_shuffle_epi32(z, _MM_SHUFFLE(1, 2, 0, 1));
+		k23 = _mm_shuffle_epi32(_mm_alignr_epi8(_mm_cvtsi32_si128((int)keystream[4]), z, 8),
+			_MM_SHUFFLE(1, 2, 0, 1));
+
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(m01, k01, 0x00));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(m01, k01, 0x11));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(m23, k23, 0x00));
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(m23, k23, 0x11));
+
+		data += 16;
+		keystream += 4;
+	}
+	for (; nwords; nwords--) {
+		memcpy(&word, data, 4);
+		x = bitrev_bytes(_mm_cvtsi32_si128((int)word));
+		k01 = _mm_set_epi32(0, 0, (int)keystream[0], (int)keystream[1]);
+		acc = _mm_xor_si128(acc, _mm_clmulepi64_si128(x, k01, 0x00));
+
+		data += 4;
+		keystream++;
+	}
+
+	return (ZUC_UINT32)_mm_cvtsi128_si32(_mm_srli_si128(acc, 4));
+}
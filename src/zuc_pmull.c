@@ -0,0 +1,48 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdint.h>
+#include <string.h>
+#include <gmssl/zuc.h>
+#include <gmssl/endian.h>
+#include <arm_neon.h>
+#include <arm_acle.h>
+
+
+/*
+ * EIA3 word by word with ARMv8 PMULL, the same formulation as zuc_pclmul.c,
+ * RBIT reverses the message word.
+ */
+
+#define PMULL_ACC(m, z0, z1)						\
+	acc = veorq_u8(acc, vreinterpretq_u8_p128(vmull_p64(		\
+		(poly64_t)__rbit(m),					\
+		(poly64_t)(((uint64_t)(z0) << 32) | (z1)))))
+
+ZUC_UINT32 zuc_mac_words_pmull(const uint8_t *data, size_t nwords, const ZUC_UINT32 *keystream)
+{
+	uint8x16_t acc = vdupq_n_u8(0);
+
+	for (; nwords >= 4; nwords -= 4) {
+		PMULL_ACC(GETU32(data     ), keystream[0], keystream[1]);
+		PMULL_ACC(GETU32(data +  4), keystream[1], keystream[2]);
+		PMULL_ACC(GETU32(data +  8), keystream[2], keystream[3]);
+		PMULL_ACC(GETU32(data + 12), keystream[3], keystream[4]);
+		data += 16;
+		keystream += 4;
+	}
+	for (; nwords; nwords--) {
+		PMULL_ACC(GETU32(data), keystream[0], keystream[1]);
+		data += 4;
+		keystream++;
+	}
+
+	return vgetq_lane_u32(vreinterpretq_u32_u8(acc), 1);
+}
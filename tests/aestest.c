@@ -14,7 +14,10 @@
 #include <stdlib.h>
 #include <gmssl/aes.h>
 #include <gmssl/hex.h>
+#include <gmssl/mem.h>
 #include <gmssl/error.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
 
 
 int test_aes(void)
@@ -341,7 +344,8 @@ int test_aes_gcm(void)
 		aes_gcm_encrypt(&aes_key, IV, IVlen, A, Alen, P, Plen, out, Tlen, tag);
 
 		printf("aes gcm test %d ", i + 1);
-		if (aes_gcm_decrypt(&aes_key, IV, IVlen, A, Alen, out, Plen, tag, Tlen, buf) != 1
+		if (memcmp(out, C, Clen) != 0 || memcmp(tag, T, Tlen) != 0
+			|| aes_gcm_decrypt(&aes_key, IV, IVlen, A, Alen, out, Plen, tag, Tlen, buf) != 1
 			|| memcmp(buf, P, Plen) != 0) {
 			printf("failed\n");
 			format_print(stdout, 0, 2, "K = %s\n", aes_gcm_tests[i].K);
@@ -362,11 +366,121 @@ int test_aes_gcm(void)
 	return 1;
 }
 
+typedef void (*aes_blocks_func)(const AES_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+typedef void (*aes_ctr32_blocks_func)(const AES_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+
+// the multi-block paths are compared with `aes_encrypt`, which is checked against FIPS-197 by test_aes
+static int check_aes_kernel(const char *name, aes_blocks_func encrypt_blocks,
+	aes_blocks_func decrypt_blocks, aes_ctr32_blocks_func ctr32_encrypt_blocks)
+{
+	const uint8_t key[32] = {
+		0x60, 0x3d, 0xeb, 0x10, 0x15, 0xca, 0x71, 0xbe, 0x2b, 0x73, 0xae, 0xf0, 0x85, 0x7d, 0x77, 0x81,
+		0x1f, 0x35, 0x2c, 0x07, 0x3b, 0x61, 0x08, 0xd7, 0x2d, 0x98, 0x10, 0xa3, 0x09, 0x14, 0xdf, 0xf4,
+	};
+	size_t keylens[3] = { 16, 24, 32 };
+	AES_KEY enc_key;
+	AES_KEY dec_key;
+	uint8_t in[16 * 37];
+	uint8_t out[16 * 37];
+	uint8_t buf[16 * 37];
+	uint8_t ctr[16];
+	uint8_t ctr_ref[16];
+	uint8_t block[16];
+	size_t nblocks[] = { 1, 7, 8, 15, 16, 17, 37 };
+	size_t i, j, k;
+
+	for (i = 0; i < sizeof(in); i++) {
+		in[i] = (uint8_t)(i * 31 + 7);
+	}
+
+	for (k = 0; k < 3; k++) {
+		aes_set_encrypt_key(&enc_key, key, keylens[k]);
+		aes_set_decrypt_key(&dec_key, key, keylens[k]);
+
+		for (i = 0; i < sizeof(nblocks)/sizeof(nblocks[0]); i++) {
+			encrypt_blocks(&enc_key, in, nblocks[i], out);
+			for (j = 0; j < nblocks[i]; j++) {
+				aes_encrypt(&enc_key, in + 16 * j, block);
+				if (memcmp(out + 16 * j, block, 16) != 0) {
+					fprintf(stderr, "%s: aes-%zu encrypt_blocks(%zu) failed\n", name, keylens[k] * 8, nblocks[i]);
+					return -1;
+				}
+			}
+
+			decrypt_blocks(&dec_key, out, nblocks[i], buf);
+			if (memcmp(buf, in, 16 * nblocks[i]) != 0) {
+				fprintf(stderr, "%s: aes-%zu decrypt_blocks(%zu) failed\n", name, keylens[k] * 8, nblocks[i]);
+				return -1;
+			}
+
+			// the 32-bit counter wraps around in the middle of the batch
+			memset(ctr, 0xab, 16);
+			PUTU32(ctr + 12, 0xfffffffc);
+			memcpy(ctr_ref, ctr, 16);
+			ctr32_encrypt_blocks(&enc_key, ctr, in, nblocks[i], out);
+			for (j = 0; j < nblocks[i]; j++) {
+				aes_encrypt(&enc_key, ctr_ref, block);
+				gmssl_memxor(block, block, in + 16 * j, 16);
+				PUTU32(ctr_ref + 12, GETU32(ctr_ref + 12) + 1);
+				if (memcmp(out + 16 * j, block, 16) != 0) {
+					fprintf(stderr, "%s: aes-%zu ctr32_encrypt_blocks(%zu) failed\n", name, keylens[k] * 8, nblocks[i]);
+					return -1;
+				}
+			}
+			if (memcmp(ctr, ctr_ref, 16) != 0) {
+				fprintf(stderr, "%s: aes-%zu ctr32_encrypt_blocks(%zu) counter failed\n", name, keylens[k] * 8, nblocks[i]);
+				return -1;
+			}
+		}
+	}
+
+	printf("%s: ok\n", name);
+	return 1;
+}
+
+int test_aes_blocks_kernels(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+
+	(void)cpu;
+
+	if (check_aes_kernel("dispatch", aes_encrypt_blocks, aes_decrypt_blocks, aes_ctr32_encrypt_blocks) != 1) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_AES_AESNI
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)
+		&& check_aes_kernel("aesni", aes_aesni_encrypt_blocks, aes_aesni_decrypt_blocks, aes_aesni_ctr32_encrypt_blocks) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+#if defined(ENABLE_AES_VAES) && defined(ENABLE_AES_AESNI)
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_VAES))
+		== (GMSSL_CPU_AESNI|GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_VAES)
+		&& check_aes_kernel("vaes", aes_vaes_encrypt_blocks, aes_aesni_decrypt_blocks, aes_vaes_ctr32_encrypt_blocks) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+#ifdef ENABLE_AES_CE
+	if ((cpu & GMSSL_CPU_ARM_AES)
+		&& check_aes_kernel("ce", aes_ce_encrypt_blocks, aes_ce_decrypt_blocks, aes_ce_ctr32_encrypt_blocks) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_aes() != 1) goto err;
 	if (test_aes_ctr() != 1) goto err;
 	if (test_aes_gcm() != 1) goto err;
+	if (test_aes_blocks_kernels() != 1) goto err;
 	printf("%s all tests passed!\n", __FILE__);
 	return 0;
 err:
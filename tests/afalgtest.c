@@ -0,0 +1,291 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/afalg.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+// the small one stays on the CPU, the large one is split into several kernel operations
+static const size_t test_lens[] = { 100, 200000 };
+
+
+static void sm3_digest(const uint8_t *data, size_t datalen, uint8_t dgst[32])
+{
+	SM3_CTX sm3_ctx;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, data, datalen);
+	sm3_finish(&sm3_ctx, dgst);
+}
+
+static int test_sm3_afalg(void)
+{
+	SM3_AFALG_CTX ctx;
+	uint8_t *buf;
+	uint8_t dgst[32];
+	uint8_t afalg_dgst[32];
+	size_t i;
+
+	if (!(buf = (uint8_t *)malloc(200000))) {
+		error_print();
+		return -1;
+	}
+	rand_bytes(buf, 200000);
+
+	if (sm3_afalg_init(&ctx) != 1) {
+		error_print();
+		free(buf);
+		return -1;
+	}
+	afalg_set_threshold(&ctx.alg, 1);
+
+	for (i = 0; i < sizeof(test_lens)/sizeof(test_lens[0]); i++) {
+		sm3_digest(buf, test_lens[i], dgst);
+		if (sm3_afalg_digest(&ctx, buf, test_lens[i], afalg_dgst) != 1
+			|| memcmp(afalg_dgst, dgst, 32) != 0) {
+			error_print();
+			sm3_afalg_cleanup(&ctx);
+			free(buf);
+			return -1;
+		}
+	}
+	// the same context hashes again from the start
+	sm3_digest(buf, 0, dgst);
+	if (sm3_afalg_digest(&ctx, buf, 0, afalg_dgst) != 1
+		|| memcmp(afalg_dgst, dgst, 32) != 0) {
+		error_print();
+		sm3_afalg_cleanup(&ctx);
+		free(buf);
+		return -1;
+	}
+
+	printf("%s() ok (%s)\n", __FUNCTION__, afalg_is_offloaded(&ctx.alg) ? "kernel" : "cpu");
+	sm3_afalg_cleanup(&ctx);
+	free(buf);
+	return 1;
+}
+
+static int test_sm4_afalg_cbc_ctr(void)
+{
+	SM4_AFALG_CTX cbc_ctx;
+	SM4_AFALG_CTX ctr_ctx;
+	SM4_KEY enc_key;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t iv1[16];
+	uint8_t iv2[16];
+	uint8_t *plain = NULL;
+	uint8_t *cipher = NULL;
+	uint8_t *buf = NULL;
+	size_t len = 200000;
+	size_t nblocks = len / SM4_BLOCK_SIZE;
+	int ret = -1;
+
+	rand_bytes(key, sizeof(key));
+	if (sm4_afalg_init(&cbc_ctx, SM4_AFALG_cbc, key, sizeof(key)) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm4_afalg_init(&ctr_ctx, SM4_AFALG_ctr, key, sizeof(key)) != 1) {
+		error_print();
+		sm4_afalg_cleanup(&cbc_ctx);
+		return -1;
+	}
+	afalg_set_threshold(&cbc_ctx.alg, 1);
+	afalg_set_threshold(&ctr_ctx.alg, 1);
+
+	if (!(plain = (uint8_t *)malloc(len))
+		|| !(cipher = (uint8_t *)malloc(len))
+		|| !(buf = (uint8_t *)malloc(len))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(plain, len);
+	sm4_set_encrypt_key(&enc_key, key);
+
+	// cbc, two calls chain the iv
+	memcpy(iv1, iv, 16);
+	sm4_cbc_encrypt_blocks(&enc_key, iv1, plain, nblocks, cipher);
+	memcpy(iv2, iv, 16);
+	if (sm4_afalg_cbc_encrypt_blocks(&cbc_ctx, iv2, plain, 5, buf) != 1
+		|| sm4_afalg_cbc_encrypt_blocks(&cbc_ctx, iv2, plain + 80, nblocks - 5, buf + 80) != 1
+		|| memcmp(buf, cipher, nblocks * 16) != 0
+		|| memcmp(iv2, iv1, 16) != 0) {
+		error_print();
+		goto end;
+	}
+	// in place
+	memcpy(iv2, iv, 16);
+	if (sm4_afalg_cbc_decrypt_blocks(&cbc_ctx, iv2, buf, nblocks, buf) != 1
+		|| memcmp(buf, plain, nblocks * 16) != 0
+		|| memcmp(iv2, iv1, 16) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// ctr, with a counter carrying out of the low 64 bits
+	memset(iv, 0xff, 12);
+	memcpy(iv1, iv, 16);
+	sm4_ctr_encrypt(&enc_key, iv1, plain, len, cipher);
+	memcpy(iv2, iv, 16);
+	if (sm4_afalg_ctr_encrypt(&ctr_ctx, iv2, plain, len, buf) != 1
+		|| memcmp(buf, cipher, len) != 0
+		|| memcmp(iv2, iv1, 16) != 0) {
+		error_print();
+		goto end;
+	}
+	memcpy(iv2, iv, 16);
+	if (sm4_afalg_ctr_encrypt(&ctr_ctx, iv2, buf, len, buf) != 1
+		|| memcmp(buf, plain, len) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok (%s)\n", __FUNCTION__, afalg_is_offloaded(&cbc_ctx.alg) ? "kernel" : "cpu");
+	ret = 1;
+end:
+	sm4_afalg_cleanup(&cbc_ctx);
+	sm4_afalg_cleanup(&ctr_ctx);
+	if (plain) free(plain);
+	if (cipher) free(cipher);
+	if (buf) free(buf);
+	return ret;
+}
+
+static int test_sm4_afalg_gcm(void)
+{
+	SM4_AFALG_CTX ctx;
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t iv[12];
+	uint8_t aad[20];
+	uint8_t tag[16];
+	uint8_t afalg_tag[16];
+	uint8_t *plain = NULL;
+	uint8_t *cipher = NULL;
+	uint8_t *buf = NULL;
+	size_t i;
+	int ret = -1;
+
+	rand_bytes(key, sizeof(key));
+	if (sm4_afalg_init(&ctx, SM4_AFALG_gcm, key, sizeof(key)) != 1) {
+		error_print();
+		return -1;
+	}
+	afalg_set_threshold(&ctx.alg, 1);
+
+	if (!(plain = (uint8_t *)malloc(200000))
+		|| !(cipher = (uint8_t *)malloc(200000))
+		|| !(buf = (uint8_t *)malloc(200000))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(aad, sizeof(aad));
+	rand_bytes(plain, 200000);
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	for (i = 0; i < sizeof(test_lens)/sizeof(test_lens[0]); i++) {
+		size_t len = test_lens[i];
+
+		if (sm4_gcm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad), plain, len, cipher, 16, tag) != 1
+			|| sm4_afalg_gcm_encrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), plain, len, buf, 16, afalg_tag) != 1
+			|| memcmp(buf, cipher, len) != 0
+			|| memcmp(afalg_tag, tag, 16) != 0) {
+			error_print();
+			goto end;
+		}
+		if (sm4_afalg_gcm_decrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), buf, len, tag, 16, buf) != 1
+			|| memcmp(buf, plain, len) != 0) {
+			error_print();
+			goto end;
+		}
+		tag[0] ^= 1;
+		if (sm4_afalg_gcm_decrypt(&ctx, iv, sizeof(iv), aad, sizeof(aad), cipher, len, tag, 16, buf) == 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok (%s)\n", __FUNCTION__, afalg_is_offloaded(&ctx.alg) ? "kernel" : "cpu");
+	ret = 1;
+end:
+	sm4_afalg_cleanup(&ctx);
+	if (plain) free(plain);
+	if (cipher) free(cipher);
+	if (buf) free(buf);
+	return ret;
+}
+
+#ifdef ENABLE_SM4_XTS
+static int test_sm4_afalg_xts(void)
+{
+	SM4_AFALG_CTX ctx;
+	SM4_KEY key1;
+	SM4_KEY key2;
+	uint8_t key[32];
+	uint8_t tweak[16];
+	uint8_t plain[4096 + 5];
+	uint8_t cipher[sizeof(plain)];
+	uint8_t buf[sizeof(plain)];
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(tweak, sizeof(tweak));
+	rand_bytes(plain, sizeof(plain));
+
+	if (sm4_afalg_init(&ctx, SM4_AFALG_xts, key, sizeof(key)) != 1) {
+		error_print();
+		return -1;
+	}
+	afalg_set_threshold(&ctx.alg, 1);
+
+	sm4_set_encrypt_key(&key1, key);
+	sm4_set_encrypt_key(&key2, key + 16);
+	if (sm4_xts_encrypt(&key1, &key2, tweak, plain, sizeof(plain), cipher) != 1
+		|| sm4_afalg_xts_encrypt(&ctx, tweak, plain, sizeof(plain), buf) != 1
+		|| memcmp(buf, cipher, sizeof(plain)) != 0) {
+		error_print();
+		sm4_afalg_cleanup(&ctx);
+		return -1;
+	}
+	if (sm4_afalg_xts_decrypt(&ctx, tweak, cipher, sizeof(cipher), buf) != 1
+		|| memcmp(buf, plain, sizeof(plain)) != 0) {
+		error_print();
+		sm4_afalg_cleanup(&ctx);
+		return -1;
+	}
+
+	printf("%s() ok (%s)\n", __FUNCTION__, afalg_is_offloaded(&ctx.alg) ? "kernel" : "cpu");
+	sm4_afalg_cleanup(&ctx);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+	if (test_sm3_afalg() != 1) goto err;
+	if (test_sm4_afalg_cbc_ctr() != 1) goto err;
+	if (test_sm4_afalg_gcm() != 1) goto err;
+#ifdef ENABLE_SM4_XTS
+	if (test_sm4_afalg_xts() != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
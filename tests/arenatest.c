@@ -0,0 +1,84 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/arena.h>
+#include <gmssl/error.h>
+
+
+static int test_arena(void)
+{
+	ARENA arena;
+	ARENA_MARK mark;
+	uint8_t *a, *b, *c, *big;
+	uint8_t *p;
+
+	arena_init(&arena, 256);
+
+	if (!(a = (uint8_t *)arena_alloc(&arena, 1))
+		|| !(b = (uint8_t *)arena_alloc(&arena, 100))
+		|| ((uintptr_t)a % ARENA_ALIGN) || ((uintptr_t)b % ARENA_ALIGN)
+		|| b != a + ARENA_ALIGN) {
+		error_print();
+		return -1;
+	}
+	memset(b, 0xff, 100);
+
+	// scoped temporaries, in the current block and in new ones
+	arena_get_mark(&arena, &mark);
+	if (!(c = (uint8_t *)arena_alloc(&arena, 100))
+		|| !(big = (uint8_t *)arena_alloc(&arena, 1000))
+		|| !arena_alloc(&arena, 200)) {
+		error_print();
+		return -1;
+	}
+	memset(c, 0xff, 100);
+	memset(big, 0xff, 1000);
+	arena_release(&arena, &mark);
+	if (!(p = (uint8_t *)arena_alloc(&arena, 100))
+		|| p != c
+		|| p[0] != 0 || p[99] != 0
+		|| b[99] != 0xff) {
+		error_print();
+		return -1;
+	}
+
+	// the first block is kept
+	arena_reset(&arena);
+	if (!(p = (uint8_t *)arena_alloc(&arena, 10)) || p != a) {
+		error_print();
+		return -1;
+	}
+	arena_cleanup(&arena);
+
+	// a zeroed arena is usable
+	memset(&arena, 0, sizeof(arena));
+	if (!(p = (uint8_t *)arena_alloc(&arena, ARENA_DEFAULT_BLOCK_SIZE + 1))) {
+		error_print();
+		return -1;
+	}
+	memset(p, 0, ARENA_DEFAULT_BLOCK_SIZE + 1);
+	arena_cleanup(&arena);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_arena() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
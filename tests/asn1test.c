@@ -367,6 +367,130 @@ static int test_asn1_object_identifier(void)
 	return 1;
 }
 
+static uint32_t oid_info_test_nodes[][6] = {
+	{ 1,2,156,10197,1,301 },
+	{ 1,2,156,10197,1,401 },
+	{ 1,2,156,10197,1,104 },
+	{ 1,2,840,10045,2,1 },
+	{ 1,2,156,10197,1,301 }, // duplicated nodes, the first entry should be found
+};
+
+static const ASN1_OID_INFO oid_info_test_infos[] = {
+	{ 1, "sm2", oid_info_test_nodes[0], 6, 0, NULL },
+	{ 2, "sm3", oid_info_test_nodes[1], 6, 0, NULL },
+	{ 3, "sm4-cbc", oid_info_test_nodes[2], 6, 0, NULL },
+	{ 4, "ecPublicKey", oid_info_test_nodes[3], 6, 0, NULL },
+	{ 5, "sm2-dup", oid_info_test_nodes[4], 6, 0, NULL },
+	{ 2, "sm3-dup", oid_info_test_nodes[1], 6, 0, NULL }, // duplicated oid
+	{ 6, "sm4-prefix", oid_info_test_nodes[2], 5, 0, NULL },
+};
+
+static int test_asn1_oid_info(void)
+{
+	const size_t count = sizeof(oid_info_test_infos)/sizeof(oid_info_test_infos[0]);
+	const ASN1_OID_INFO *info;
+	uint32_t unknown[] = { 1,2,156,10197,1,999 };
+	ASN1_OID_INFO reused[4];
+	uint32_t nodes[ASN1_OID_MAX_NODES];
+	size_t nodes_cnt;
+	uint8_t buf[64];
+	uint8_t *p;
+	const uint8_t *cp;
+	size_t len;
+	size_t i, j;
+
+	// looked up twice, the second time from the built index
+	for (j = 0; j < 2; j++) {
+		for (i = 0; i < count; i++) {
+			const ASN1_OID_INFO *expect = &oid_info_test_infos[i];
+
+			if (i == 5) expect = &oid_info_test_infos[1];
+			if (asn1_oid_info_from_oid(oid_info_test_infos, count, oid_info_test_infos[i].oid) != expect) {
+				error_print();
+				return -1;
+			}
+
+			p = buf;
+			len = 0;
+			if (asn1_object_identifier_to_der(oid_info_test_infos[i].nodes,
+					oid_info_test_infos[i].nodes_cnt, &p, &len) != 1) {
+				error_print();
+				return -1;
+			}
+			cp = buf;
+			if (i == 4) expect = &oid_info_test_infos[0];
+			if (asn1_oid_info_from_der_ex(&info, nodes, &nodes_cnt,
+					oid_info_test_infos, count, &cp, &len) != 1
+				|| info != expect
+				|| len != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	if (asn1_oid_info_from_oid(oid_info_test_infos, count, 7) != NULL) {
+		error_print();
+		return -1;
+	}
+	p = buf;
+	len = 0;
+	if (asn1_object_identifier_to_der(unknown, sizeof(unknown)/sizeof(unknown[0]), &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	cp = buf;
+	if (asn1_oid_info_from_der_ex(&info, nodes, &nodes_cnt, oid_info_test_infos, count, &cp, &len) != 1
+		|| info != NULL) {
+		error_print();
+		return -1;
+	}
+
+	// a prefix of the table is another table
+	if (asn1_oid_info_from_oid(oid_info_test_infos, 3, 4) != NULL
+		|| asn1_oid_info_from_oid(oid_info_test_infos, 4, 4) != &oid_info_test_infos[3]) {
+		error_print();
+		return -1;
+	}
+
+	// another table at the address of an indexed one, as after free() and malloc()
+	memcpy(reused, oid_info_test_infos, sizeof(reused));
+	if (asn1_oid_info_from_oid(reused, 4, 3) != &reused[2]) {
+		error_print();
+		return -1;
+	}
+	reused[0] = oid_info_test_infos[3];
+	reused[1].oid = 8;
+	reused[3] = oid_info_test_infos[0];
+	p = buf;
+	len = 0;
+	if (asn1_object_identifier_to_der(oid_info_test_nodes[0], 6, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	cp = buf;
+	if (asn1_oid_info_from_oid(reused, 4, 1) != &reused[3]
+		|| asn1_oid_info_from_oid(reused, 4, 8) != &reused[1]
+		|| asn1_oid_info_from_oid(reused, 4, 2) != NULL
+		|| asn1_oid_info_from_der_ex(&info, nodes, &nodes_cnt, reused, 4, &cp, &len) != 1
+		|| info != &reused[3]) {
+		error_print();
+		return -1;
+	}
+
+	// indexed again after the cleanup
+	asn1_oid_index_cleanup();
+	if (asn1_oid_info_from_oid(oid_info_test_infos, count, 4) != &oid_info_test_infos[3]
+		|| asn1_oid_info_from_oid(reused, 4, 8) != &reused[1]) {
+		error_print();
+		return -1;
+	}
+	asn1_oid_index_cleanup();
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_asn1_printable_string(void)
 {
 	char *tests[] = {
@@ -607,6 +731,65 @@ static int test_asn1_time(void)
 	return 1;
 }
 
+static int test_asn1_time_calendar(void)
+{
+	struct {
+		char *str;
+		time_t ts;
+	} tests[] = {
+		{ "19720229000000Z", 68169600 },
+		{ "20000229235959Z", 951868799 },
+		{ "20000301000000Z", 951868800 },
+		{ "20380119031408Z", 2147483648LL },
+		{ "21000301000000Z", 4107542400LL },
+		{ "99991231235959Z", 253402300799LL },
+	};
+	char *invalid[] = {
+		"19690101000000Z",
+		"19700230000000Z",
+		"19000229000000Z",
+		"21000229000000Z",
+		"20230431000000Z",
+		"20231301000000Z",
+		"20231200000000Z",
+		"20231231240000Z",
+		"20231231236000Z",
+		"20231231235960Z",
+	};
+	time_t ts;
+	char str[16] = {0};
+	size_t i;
+
+	for (i = 0; i < sizeof(tests)/sizeof(tests[0]); i++) {
+		if (asn1_time_from_str(0, &ts, tests[i].str) != 1
+			|| ts != tests[i].ts
+			|| asn1_time_to_str(0, ts, str) != 1
+			|| strcmp(str, tests[i].str) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < sizeof(invalid)/sizeof(invalid[0]); i++) {
+		if (asn1_time_from_str(0, &ts, invalid[i]) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// every day of the GeneralizedTime range, at a varying time of day
+	for (i = 0; i <= 253402300799LL/86400; i++) {
+		time_t t = (time_t)i * 86400 + (i * 3661) % 86400;
+		if (asn1_time_to_str(0, t, str) != 1
+			|| asn1_time_from_str(0, &ts, str) != 1
+			|| ts != t) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_asn1_time_limits(void)
 {
 	char *tests[] = {
@@ -803,6 +986,266 @@ static int test_asn1_from_der_null_args(void)
 	return 1;
 }
 
+static int test_asn1_cursor(void)
+{
+	uint8_t buf[128];
+	uint8_t *p = buf;
+	size_t len = 0;
+	ASN1_CURSOR cur;
+	int tag;
+	const uint8_t *d;
+	size_t dlen;
+	const uint8_t *a;
+	size_t alen;
+	int val;
+
+	if (asn1_int_to_der(7, &p, &len) != 1
+		|| asn1_null_to_der(&p, &len) != 1
+		|| asn1_ia5_string_to_der("abc", 3, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (asn1_cursor_init(&cur, buf, len) != 1
+		|| cur.fields_cnt != 3
+		|| asn1_cursor_get(&cur, 2, &tag, &d, &dlen) != 1
+		|| tag != ASN1_TAG_IA5String || dlen != 3 || memcmp(d, "abc", 3) != 0
+		|| asn1_cursor_get(&cur, 3, &tag, &d, &dlen) != 0
+		|| asn1_cursor_get_tlv(&cur, 0, &a, &alen) != 1
+		|| a != buf || alen != 3
+		|| asn1_int_from_der(&val, &a, &alen) != 1 || val != 7) {
+		error_print();
+		return -1;
+	}
+	// truncated
+	if (asn1_cursor_init(&cur, buf, len - 1) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// SEQUENCE { [0] { OCTET STRING }, NULL } around the length boundaries, written
+// into a buffer of exactly the final size, as the two-pass encoding
+static int test_asn1_header_begin(void)
+{
+	size_t lens[] = { 0, 1, 120, 123, 124, 127, 128, 250, 255, 256, 65530, 65535, 65536, 70000 };
+	uint8_t *data = NULL;
+	uint8_t *ref = NULL;
+	uint8_t *buf = NULL;
+	uint8_t *p;
+	ASN1_HEADER seq, tagged;
+	size_t len, reflen, outlen, i;
+	int ret = -1;
+
+	if (!(data = (uint8_t *)malloc(70000))
+		|| !(ref = (uint8_t *)malloc(70100))) {
+		error_print();
+		goto end;
+	}
+	memset(data, 0x5a, 70000);
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		len = 0;
+		if (asn1_octet_string_to_der(data, lens[i], NULL, &len) < 0) {
+			error_print();
+			goto end;
+		}
+		reflen = len;
+		if (asn1_explicit_header_to_der(0, len, NULL, &reflen) != 1
+			|| asn1_null_to_der(NULL, &reflen) != 1) {
+			error_print();
+			goto end;
+		}
+		p = ref;
+		outlen = 0;
+		if (asn1_sequence_header_to_der(reflen, &p, &outlen) != 1
+			|| asn1_explicit_header_to_der(0, len, &p, &outlen) != 1
+			|| asn1_octet_string_to_der(data, lens[i], &p, &outlen) < 0
+			|| asn1_null_to_der(&p, &outlen) != 1) {
+			error_print();
+			goto end;
+		}
+		reflen = outlen;
+
+		// only the length
+		outlen = 0;
+		if (asn1_sequence_begin(&seq, NULL, &outlen) != 1
+			|| asn1_explicit_begin(&tagged, 0, NULL, &outlen) != 1
+			|| asn1_octet_string_to_der(data, lens[i], NULL, &outlen) < 0
+			|| asn1_header_end(&tagged, NULL, &outlen) != 1
+			|| asn1_null_to_der(NULL, &outlen) != 1
+			|| asn1_header_end(&seq, NULL, &outlen) != 1
+			|| outlen != reflen) {
+			error_print();
+			goto end;
+		}
+
+		if (!(buf = (uint8_t *)malloc(reflen))) {
+			error_print();
+			goto end;
+		}
+		p = buf;
+		outlen = 0;
+		if (asn1_sequence_begin(&seq, &p, &outlen) != 1
+			|| asn1_explicit_begin(&tagged, 0, &p, &outlen) != 1
+			|| asn1_octet_string_to_der(data, lens[i], &p, &outlen) < 0
+			|| asn1_header_end(&tagged, &p, &outlen) != 1
+			|| asn1_null_to_der(&p, &outlen) != 1
+			|| asn1_header_end(&seq, &p, &outlen) != 1
+			|| outlen != reflen
+			|| p != buf + reflen
+			|| memcmp(buf, ref, reflen) != 0) {
+			error_print();
+			goto end;
+		}
+		free(buf);
+		buf = NULL;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(data);
+	free(ref);
+	free(buf);
+	return ret;
+}
+
+// walk nested SEQUENCEs down to the INTEGER inside
+static int walk_nested(const uint8_t *in, size_t inlen)
+{
+	const uint8_t *d;
+	size_t dlen;
+	int val;
+	int ret;
+
+	if ((ret = asn1_sequence_from_der(&d, &dlen, &in, &inlen)) < 0) {
+		return -1;
+	}
+	if (ret == 1) {
+		return walk_nested(d, dlen);
+	}
+	if (asn1_int_from_der(&val, &in, &inlen) != 1 || val != 7) {
+		return -1;
+	}
+	return 1;
+}
+
+static int test_asn1_parse_ctx(void)
+{
+	ASN1_PARSE_CTX ctx;
+	uint8_t buf[512];
+	uint8_t data[256] = {0};
+	uint8_t *p;
+	const uint8_t *cp;
+	const uint8_t *d;
+	size_t len, dlen, i;
+	int val;
+
+	// 20 nested SEQUENCEs, the INTEGER is at depth 21
+	p = buf;
+	len = 0;
+	asn1_int_to_der(7, &p, &len);
+	for (i = 0; i < 20; i++) {
+		uint8_t hdr[8];
+		size_t hdrlen = 0;
+		p = hdr;
+		asn1_sequence_header_to_der(len, &p, &hdrlen);
+		memmove(buf + hdrlen, buf, len);
+		memcpy(buf, hdr, hdrlen);
+		len += hdrlen;
+	}
+	p = buf;
+	if (walk_nested(p, len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	asn1_parse_ctx_init(&ctx, 20, 0, 0);
+	if (asn1_parse_ctx_set(&ctx) != NULL
+		|| walk_nested(p, len) != -1
+		|| asn1_parse_ctx_exhausted(&ctx) != 1) {
+		error_print();
+		return -1;
+	}
+	asn1_parse_ctx_init(&ctx, 21, 0, 0);
+	if (walk_nested(p, len) != 1
+		|| asn1_parse_ctx_exhausted(&ctx) != 0
+		|| ctx.elements != 21) {
+		error_print();
+		return -1;
+	}
+
+	// 100 sibling SEQUENCEs of one INTEGER, each INTEGER at depth 3
+	p = buf;
+	len = 0;
+	asn1_sequence_header_to_der(100 * 5, &p, &len);
+	for (i = 0; i < 100; i++) {
+		asn1_sequence_header_to_der(3, &p, &len);
+		asn1_int_to_der(7, &p, &len);
+	}
+	for (i = 0; i < 2; i++) {
+		// 201 elements, over the budget of 150 in the first round
+		asn1_parse_ctx_init(&ctx, 3, i ? 0 : 150, 0);
+		cp = buf;
+		len = p - buf;
+		if (asn1_sequence_from_der(&d, &dlen, &cp, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		while (dlen) {
+			const uint8_t *item;
+			size_t itemlen;
+			if (asn1_sequence_from_der(&item, &itemlen, &d, &dlen) != 1
+				|| asn1_int_from_der(&val, &item, &itemlen) != 1) {
+				break;
+			}
+		}
+		if ((dlen == 0) != i || asn1_parse_ctx_exhausted(&ctx) != !i) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the byte budget
+	p = buf;
+	len = 0;
+	asn1_octet_string_to_der(data, sizeof(data), &p, &len);
+	asn1_parse_ctx_init(&ctx, 0, 0, sizeof(data) - 1);
+	cp = buf;
+	if (asn1_octet_string_from_der(&d, &dlen, &cp, &len) != -1
+		|| asn1_parse_ctx_exhausted(&ctx) != 1) {
+		error_print();
+		return -1;
+	}
+	// no decoding after the budget is exhausted, until reset
+	asn1_parse_ctx_init(&ctx, 0, 0, sizeof(data));
+	ctx.exhausted = 1;
+	cp = buf;
+	len = p - buf;
+	if (asn1_octet_string_from_der(&d, &dlen, &cp, &len) != -1) {
+		error_print();
+		return -1;
+	}
+	asn1_parse_ctx_reset(&ctx);
+	cp = buf;
+	len = p - buf;
+	if (asn1_octet_string_from_der(&d, &dlen, &cp, &len) != 1
+		|| ctx.bytes != sizeof(data)) {
+		error_print();
+		return -1;
+	}
+
+	if (asn1_parse_ctx_set(NULL) != &ctx) {
+		error_print();
+		return -1;
+	}
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_asn1_tag() != 1) goto err;
@@ -812,15 +1255,20 @@ int main(void)
 	if (test_asn1_bits() != 1) goto err;
 	if (test_asn1_null() != 1) goto err;
 	if (test_asn1_object_identifier() != 1) goto err;
+	if (test_asn1_oid_info() != 1) goto err;
 	if (test_asn1_printable_string() != 1) goto err;
 	if (test_asn1_printable_string_case_ignore_match() != 1) goto err;
 	if (test_asn1_utf8_string() != 1) goto err;
 	if (test_asn1_ia5_string() != 1) goto err;
 	if (test_asn1_time() != 1) goto err;
 	if (test_asn1_time_limits() != 1) goto err;
+	if (test_asn1_time_calendar() != 1) goto err;
 	if (test_asn1_utc_time() != 1) goto err;
 	if (test_asn1_generalized_time() != 1) goto err;
 	if (test_asn1_from_der_null_args() != 1) goto err;
+	if (test_asn1_cursor() != 1) goto err;
+	if (test_asn1_header_begin() != 1) goto err;
+	if (test_asn1_parse_ctx() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -12,6 +12,8 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <gmssl/cpu.h>
+#include <gmssl/rand.h>
 #include <gmssl/base64.h>
 #include <gmssl/error.h>
 
@@ -61,9 +63,73 @@ static int test_base64(void)
 	return 1;
 }
 
+static int test_base64_block(void)
+{
+	const char *alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+	uint8_t bin[300];
+	uint8_t buf[450];
+	uint8_t ref[450];
+	uint8_t dec[300];
+	uint8_t chars[96];
+	size_t i, j;
+	int len;
+
+	rand_bytes(bin, 256);
+	rand_bytes(bin + 256, sizeof(bin) - 256);
+
+	// every length, so that the bulk kernels and the scalar tails are both hit
+	for (i = 0; i <= sizeof(bin); i++) {
+		uint8_t *r = ref;
+		for (j = 0; j < i; j += 3) {
+			uint32_t l = (uint32_t)bin[j] << 16;
+			if (j + 1 < i) l |= (uint32_t)bin[j + 1] << 8;
+			if (j + 2 < i) l |= bin[j + 2];
+			*r++ = alphabet[(l >> 18) & 0x3f];
+			*r++ = alphabet[(l >> 12) & 0x3f];
+			*r++ = j + 1 < i ? alphabet[(l >> 6) & 0x3f] : '=';
+			*r++ = j + 2 < i ? alphabet[l & 0x3f] : '=';
+		}
+		len = base64_encode_block(buf, bin, (int)i);
+		if (len != r - ref || memcmp(buf, ref, len) != 0) {
+			error_print();
+			return -1;
+		}
+		if (base64_decode_block(dec, buf, len) != (int)((i + 2) / 3 * 3)
+			|| memcmp(dec, bin, i) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// a char out of the alphabet stops the run at its group
+	for (i = 0; i < sizeof(chars); i++) {
+		chars[i] = alphabet[(i * 7) % 64];
+	}
+	for (j = 0; j < 256; j++) {
+		int valid = strchr(alphabet, (int)j) && j;
+		for (i = 0; i < sizeof(chars); i += 5) {
+			uint8_t save = chars[i];
+			chars[i] = (uint8_t)j;
+			if (base64_decode_run(dec, chars, sizeof(chars)) != (valid ? sizeof(chars) : i / 4 * 4)) {
+				error_print();
+				return -1;
+			}
+			chars[i] = save;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_base64() != 1) goto err;
+	if (test_base64_block() != 1) goto err;
+	// again with the scalar code only
+	gmssl_cpu_disable_features(GMSSL_CPU_AVX2|GMSSL_CPU_NEON);
+	if (test_base64() != 1) goto err;
+	if (test_base64_block() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
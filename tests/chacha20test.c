@@ -12,10 +12,15 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <gmssl/hex.h>
+#include <gmssl/cpu.h>
+#include <gmssl/error.h>
+#include <gmssl/endian.h>
 #include <gmssl/chacha20.h>
+#include <gmssl/poly1305.h>
 
 
-int main(void)
+static int test_chacha20(void)
 {
 	int err = 0;
 	const unsigned char key[] = {
@@ -53,6 +58,210 @@ int main(void)
 		printf("ok\n");
 	}
 
-	return err;
+	return err ? -1 : 1;
+}
+
+// the RFC 8439 block function, word by word
+static void chacha20_block_ref(const uint32_t in[16], uint8_t out[64])
+{
+	uint32_t x[16];
+	int i;
+
+#define QR(a, b, c, d) \
+	x[a] += x[b]; x[d] ^= x[a]; x[d] = ROL32(x[d], 16); \
+	x[c] += x[d]; x[b] ^= x[c]; x[b] = ROL32(x[b], 12); \
+	x[a] += x[b]; x[d] ^= x[a]; x[d] = ROL32(x[d],  8); \
+	x[c] += x[d]; x[b] ^= x[c]; x[b] = ROL32(x[b],  7)
+
+	memcpy(x, in, sizeof(x));
+	for (i = 0; i < 10; i++) {
+		QR(0, 4,  8, 12); QR(1, 5,  9, 13); QR(2, 6, 10, 14); QR(3, 7, 11, 15);
+		QR(0, 5, 10, 15); QR(1, 6, 11, 12); QR(2, 7,  8, 13); QR(3, 4,  9, 14);
+	}
+	for (i = 0; i < 16; i++) {
+		PUTU32_LE(out + 4 * i, x[i] + in[i]);
+	}
+#undef QR
+}
+
+typedef void (*chacha20_keystream_func)(CHACHA20_STATE *state, size_t counts, uint8_t *out);
+
+static int check_chacha20_keystream(const char *name, chacha20_keystream_func generate_keystream)
+{
+	uint8_t key[32];
+	uint8_t nonce[12];
+	uint8_t buf[64 * 19];
+	uint8_t block[64];
+	size_t counts[] = { 1, 3, 4, 5, 8, 9, 19 };
+	CHACHA20_STATE state;
+	uint32_t ref[16];
+	size_t i, j;
+
+	for (i = 0; i < sizeof(key); i++) {
+		key[i] = (uint8_t)(i * 13 + 1);
+	}
+	memset(nonce, 0x5a, sizeof(nonce));
+
+	for (i = 0; i < sizeof(counts)/sizeof(counts[0]); i++) {
+		// start next to 2^32 so the 32-bit counter wraps inside the batch
+		chacha20_init(&state, key, nonce, 0xfffffffc);
+		memcpy(ref, state.d, sizeof(ref));
+
+		generate_keystream(&state, counts[i], buf);
+		for (j = 0; j < counts[i]; j++) {
+			chacha20_block_ref(ref, block);
+			if (memcmp(buf + 64 * j, block, 64) != 0) {
+				fprintf(stderr, "%s: chacha20 keystream(%zu) block %zu failed\n", name, counts[i], j);
+				return -1;
+			}
+			ref[12]++;
+		}
+		if (state.d[12] != ref[12]) {
+			fprintf(stderr, "%s: chacha20 keystream(%zu) counter failed\n", name, counts[i]);
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int test_chacha20_keystream_kernels(void)
+{
+	uint64_t cpu = gmssl_cpu_features();
+
+	(void)cpu;
+
+	if (check_chacha20_keystream("dispatch", chacha20_generate_keystream) != 1) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_CHACHA20_AVX2
+	if ((cpu & GMSSL_CPU_AVX2)
+		&& check_chacha20_keystream("avx2", chacha20_avx2_generate_keystream) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+#ifdef ENABLE_CHACHA20_NEON
+	if ((cpu & GMSSL_CPU_NEON)
+		&& check_chacha20_keystream("neon", chacha20_neon_generate_keystream) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// RFC 8439 2.5.2
+static int test_poly1305(void)
+{
+	const char *key_hex = "85d6be7857556d337f4452fe42d506a80103808afb0db2fd4abff6af4149f51b";
+	const char *tag_hex = "a8061dc1305136c6c22b8baf0c0127a9";
+	const char *msg = "Cryptographic Forum Research Group";
+	uint8_t key[32];
+	uint8_t tag[16];
+	uint8_t buf[16];
+	size_t len;
+	POLY1305_CTX ctx;
+	size_t i;
+
+	hex_to_bytes(key_hex, strlen(key_hex), key, &len);
+	hex_to_bytes(tag_hex, strlen(tag_hex), tag, &len);
+
+	poly1305_init(&ctx, key);
+	poly1305_update(&ctx, (const uint8_t *)msg, strlen(msg));
+	poly1305_finish(&ctx, buf);
+	if (memcmp(buf, tag, sizeof(tag)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// byte by byte through the partial block buffer
+	poly1305_init(&ctx, key);
+	for (i = 0; i < strlen(msg); i++) {
+		poly1305_update(&ctx, (const uint8_t *)msg + i, 1);
+	}
+	poly1305_finish(&ctx, buf);
+	if (memcmp(buf, tag, sizeof(tag)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// RFC 8439 2.8.2
+static int test_chacha20_poly1305(void)
+{
+	const char *key_hex = "808182838485868788898a8b8c8d8e8f909192939495969798999a9b9c9d9e9f";
+	const char *iv_hex = "070000004041424344454647";
+	const char *aad_hex = "50515253c0c1c2c3c4c5c6c7";
+	const char *plaintext = "Ladies and Gentlemen of the class of '99: "
+		"If I could offer you only one tip for the future, sunscreen would be it.";
+	const char *ciphertext_hex =
+		"d31a8d34648e60db7b86afbc53ef7ec2a4aded51296e08fea9e2b5a736ee62d6"
+		"3dbea45e8ca9671282fafb69da92728b1a71de0a9e060b2905d6a5b67ecd3b36"
+		"92ddbd7f2d778b8c9803aee328091b58fab324e4fad675945585808b4831d7bc"
+		"3ff4def08e4b7a9de576d26586cec64b6116";
+	const char *tag_hex = "1ae10b594f09e26a7e902ecbd0600691";
+	uint8_t key[32];
+	uint8_t iv[12];
+	uint8_t aad[12];
+	uint8_t C[114];
+	uint8_t T[16];
+	uint8_t out[114];
+	uint8_t tag[16];
+	uint8_t buf[114];
+	size_t len;
+
+	hex_to_bytes(key_hex, strlen(key_hex), key, &len);
+	hex_to_bytes(iv_hex, strlen(iv_hex), iv, &len);
+	hex_to_bytes(aad_hex, strlen(aad_hex), aad, &len);
+	hex_to_bytes(ciphertext_hex, strlen(ciphertext_hex), C, &len);
+	hex_to_bytes(tag_hex, strlen(tag_hex), T, &len);
+
+	if (chacha20_poly1305_encrypt(key, iv, sizeof(iv), aad, sizeof(aad),
+		(const uint8_t *)plaintext, strlen(plaintext), out, sizeof(tag), tag) != 1) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(out, C, sizeof(C)) != 0 || memcmp(tag, T, sizeof(T)) != 0) {
+		error_print();
+		return -1;
+	}
+	if (chacha20_poly1305_decrypt(key, iv, sizeof(iv), aad, sizeof(aad),
+		out, sizeof(out), tag, sizeof(tag), buf) != 1) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(buf, plaintext, sizeof(buf)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	tag[0] ^= 1;
+	if (chacha20_poly1305_decrypt(key, iv, sizeof(iv), aad, sizeof(aad),
+		out, sizeof(out), tag, sizeof(tag), buf) == 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_chacha20() != 1) goto err;
+	if (test_chacha20_keystream_kernels() != 1) goto err;
+	if (test_poly1305() != 1) goto err;
+	if (test_chacha20_poly1305() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
 }
 
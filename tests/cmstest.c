@@ -978,6 +978,356 @@ static int test_cms_key_agreement_info(void)
 	return 1;
 }
 
+static int test_cms_stream(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t serial[20];
+	uint8_t name[256];
+	size_t namelen = 0;
+	time_t not_before, not_after;
+	uint8_t cert[1024];
+	size_t certlen = 0;
+	CMS_CERTS_AND_KEY signer;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t data[10000];
+	uint8_t cms[16384];
+	size_t cmslen;
+	uint8_t out[16384];
+	size_t outlen;
+	size_t header_len, content_len, trailer_len;
+	size_t len, i;
+	uint8_t *p;
+
+	p = cert;
+	if (sm2_key_generate(&sm2_key) != 1
+		|| rand_bytes(serial, sizeof(serial)) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", "Alice") != 1
+		|| time(&not_before) == -1
+		|| x509_validity_add_days(&not_after, not_before, 365) != 1
+		|| x509_cert_sign_to_der(X509_version_v3, serial, sizeof(serial), OID_sm2sign_with_sm3,
+			name, namelen, not_before, not_after, name, namelen,
+			&sm2_key, NULL, 0, NULL, 0, NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	signer.certs = cert;
+	signer.certs_len = certlen;
+	signer.sign_key = &sm2_key;
+	for (i = 0; i < sizeof(data); i++) {
+		data[i] = (uint8_t)(i * 7);
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+
+	// streamed SignedData is read by cms_verify()
+	{
+		CMS_SIGN_CTX sign_ctx;
+		int content_type;
+		const uint8_t *content;
+		const uint8_t *certs, *crls, *signer_infos;
+		size_t certs_len, crls_len, signer_infos_len;
+
+		if (cms_sign_init(&sign_ctx, &signer, 1, NULL, 0, sizeof(data), cms, &cmslen, sizeof(cms)) != 1) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < sizeof(data); i += len) {
+			len = sizeof(data) - i < 333 ? sizeof(data) - i : 333;
+			if (cms_sign_update(&sign_ctx, data + i, len) != 1) {
+				error_print();
+				return -1;
+			}
+			memcpy(cms + cmslen, data + i, len);
+			cmslen += len;
+		}
+		if (cms_sign_update(&sign_ctx, data, 1) != -1
+			|| cms_sign_finish(&sign_ctx, cms + cmslen, &len, sizeof(cms) - cmslen) != 1) {
+			error_print();
+			return -1;
+		}
+		cmslen += len;
+
+		if (cms_verify(cms, cmslen, NULL, 0, NULL, 0, &content_type, &content, &content_len,
+				&certs, &certs_len, &crls, &crls_len, &signer_infos, &signer_infos_len) != 1
+			|| content_type != OID_cms_data) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// and cms_sign() output is read by streamed verification
+	{
+		CMS_VERIFY_CTX verify_ctx;
+		const uint8_t *certs, *crls, *signer_infos;
+		size_t certs_len, crls_len, signer_infos_len;
+		int tamper;
+
+		if (cms_sign(cms, &cmslen, &signer, 1, OID_cms_data, data, sizeof(data), NULL, 0) != 1) {
+			error_print();
+			return -1;
+		}
+		for (tamper = 0; tamper < 2; tamper++) {
+			// the header is parsed from a prefix of the input
+			if (cms_verify_init(&verify_ctx, cms, 256, &header_len, &content_len, &trailer_len) != 1
+				|| content_len != sizeof(data)
+				|| header_len + content_len + trailer_len != cmslen
+				|| memcmp(cms + header_len, data, sizeof(data)) != 0) {
+				error_print();
+				return -1;
+			}
+			cms[header_len + 5000] ^= tamper;
+			for (i = 0; i < content_len; i += len) {
+				len = content_len - i < 1000 ? content_len - i : 1000;
+				if (cms_verify_update(&verify_ctx, cms + header_len + i, len) != 1) {
+					error_print();
+					return -1;
+				}
+			}
+			if (cms_verify_finish(&verify_ctx, cms + header_len + content_len, trailer_len,
+				&certs, &certs_len, &crls, &crls_len, &signer_infos, &signer_infos_len) != (tamper ? -1 : 1)) {
+				error_print();
+				return -1;
+			}
+			cms[header_len + 5000] ^= tamper;
+		}
+	}
+
+	// streamed EnvelopedData is read by cms_deenvelop()
+	{
+		CMS_ENVELOP_CTX envelop_ctx;
+		int content_type;
+		const uint8_t *rcpt_infos, *shared_info1, *shared_info2;
+		size_t rcpt_infos_len, shared_info1_len, shared_info2_len;
+
+		if (cms_envelop_init(&envelop_ctx, cert, certlen, OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
+			NULL, 0, (uint8_t *)"info", 4, sizeof(data), cms, &cmslen, sizeof(cms)) != 1) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < sizeof(data); i += len) {
+			len = sizeof(data) - i < 333 ? sizeof(data) - i : 333;
+			if (cms_envelop_update(&envelop_ctx, data + i, len, cms + cmslen, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			cmslen += outlen;
+		}
+		if (cms_envelop_finish(&envelop_ctx, cms + cmslen, &len, sizeof(cms) - cmslen) != 1) {
+			error_print();
+			return -1;
+		}
+		cmslen += len;
+
+		if (cms_deenvelop(cms, cmslen, &sm2_key, cert, certlen, &content_type, out, &outlen,
+				&rcpt_infos, &rcpt_infos_len, &shared_info1, &shared_info1_len,
+				&shared_info2, &shared_info2_len) != 1
+			|| outlen != sizeof(data)
+			|| memcmp(out, data, sizeof(data)) != 0
+			|| shared_info1 != NULL
+			|| shared_info2_len != 4) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// and cms_envelop() output is read by streamed deenveloping
+	{
+		CMS_DEENVELOP_CTX deenvelop_ctx;
+		const uint8_t *shared_info1, *shared_info2;
+		size_t shared_info1_len, shared_info2_len;
+		size_t total = 0;
+
+		if (cms_envelop(cms, &cmslen, cert, certlen, OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
+				OID_cms_data, data, sizeof(data), (uint8_t *)"info", 4, NULL, 0) != 1
+			|| cms_deenvelop_init(&deenvelop_ctx, cms, 512, &sm2_key, cert, certlen,
+				&header_len, &content_len, &trailer_len) != 1
+			|| header_len + content_len + trailer_len != cmslen) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < content_len; i += len) {
+			len = content_len - i < 1000 ? content_len - i : 1000;
+			if (cms_deenvelop_update(&deenvelop_ctx, cms + header_len + i, len, out + total, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			total += outlen;
+		}
+		if (cms_deenvelop_finish(&deenvelop_ctx, cms + header_len + content_len, trailer_len,
+				out + total, &outlen, &shared_info1, &shared_info1_len, &shared_info2, &shared_info2_len) != 1
+			|| total + outlen != sizeof(data)
+			|| memcmp(out, data, sizeof(data)) != 0
+			|| shared_info1_len != 4
+			|| shared_info2 != NULL) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+
+static int test_cms_envelop_multi(void)
+{
+	SM2_KEY sm2_keys[8];
+	const uint8_t *certs_ptr[8];
+	size_t certs_lens[8];
+	uint8_t serial[20];
+	uint8_t name[256];
+	size_t namelen;
+	time_t not_before, not_after;
+	uint8_t certs[8 * 1024];
+	size_t certslen = 0;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t data[1000];
+	uint8_t cms[16384];
+	size_t cmslen;
+	size_t len;
+	uint8_t out[1024];
+	size_t outlen;
+	int content_type;
+	const uint8_t *rcpt_infos, *shared_info1, *shared_info2;
+	size_t rcpt_infos_len, shared_info1_len, shared_info2_len;
+	uint8_t *p = certs;
+	size_t i;
+
+	if (time(&not_before) == -1
+		|| x509_validity_add_days(&not_after, not_before, 365) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(sm2_keys)/sizeof(sm2_keys[0]); i++) {
+		certs_ptr[i] = p;
+		certs_lens[i] = certslen;
+		if (sm2_key_generate(&sm2_keys[i]) != 1
+			|| rand_bytes(serial, sizeof(serial)) != 1
+			|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", "Alice") != 1
+			|| x509_cert_sign_to_der(X509_version_v3, serial, sizeof(serial), OID_sm2sign_with_sm3,
+				name, namelen, not_before, not_after, name, namelen,
+				&sm2_keys[i], NULL, 0, NULL, 0, NULL, 0,
+				&sm2_keys[i], SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &certslen) != 1) {
+			error_print();
+			return -1;
+		}
+		certs_lens[i] = certslen - certs_lens[i];
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(data, sizeof(data));
+
+	if (cms_envelop_multi(NULL, &len, certs, certslen, OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
+			OID_cms_data, data, sizeof(data), (uint8_t *)"info", 4, NULL, 0, 3) != 1
+		|| cms_envelop_multi(cms, &cmslen, certs, certslen, OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
+			OID_cms_data, data, sizeof(data), (uint8_t *)"info", 4, NULL, 0, 3) != 1
+		|| cmslen != len) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(sm2_keys)/sizeof(sm2_keys[0]); i++) {
+		if (cms_deenvelop(cms, cmslen, &sm2_keys[i], certs_ptr[i], certs_lens[i],
+				&content_type, out, &outlen, &rcpt_infos, &rcpt_infos_len,
+				&shared_info1, &shared_info1_len, &shared_info2, &shared_info2_len) != 1
+			|| content_type != OID_cms_data
+			|| outlen != sizeof(data)
+			|| memcmp(out, data, sizeof(data)) != 0
+			|| shared_info1_len != 4
+			|| shared_info2 != NULL) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_cms_sign_digest(void)
+{
+	SM2_KEY sm2_keys[3];
+	uint8_t certs[3][1024];
+	CMS_CERTS_AND_KEY signers[3];
+	uint8_t serial[20];
+	uint8_t name[256];
+	size_t namelen;
+	time_t not_before, not_after;
+	uint8_t data[1000];
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[32];
+	uint8_t cms[8192];
+	size_t cmslen;
+	size_t len;
+	const uint8_t *certs_der, *crls, *signer_infos;
+	size_t certs_len, crls_len, signer_infos_len;
+	uint8_t *p;
+	size_t i;
+
+	if (time(&not_before) == -1
+		|| x509_validity_add_days(&not_after, not_before, 365) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(signers)/sizeof(signers[0]); i++) {
+		p = certs[i];
+		signers[i].certs = certs[i];
+		signers[i].certs_len = 0;
+		signers[i].sign_key = &sm2_keys[i];
+		if (sm2_key_generate(&sm2_keys[i]) != 1
+			|| rand_bytes(serial, sizeof(serial)) != 1
+			|| x509_name_set(name, &namelen, sizeof(name), "CN", "Beijing", "Haidian", "PKU", "CS", "Alice") != 1
+			|| x509_cert_sign_to_der(X509_version_v3, serial, sizeof(serial), OID_sm2sign_with_sm3,
+				name, namelen, not_before, not_after, name, namelen,
+				&sm2_keys[i], NULL, 0, NULL, 0, NULL, 0,
+				&sm2_keys[i], SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &signers[i].certs_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	rand_bytes(data, sizeof(data));
+
+	if (cms_content_digest_init(&sm3_ctx, OID_cms_data, sizeof(data)) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_update(&sm3_ctx, data, 100);
+	sm3_update(&sm3_ctx, data + 100, sizeof(data) - 100);
+	sm3_finish(&sm3_ctx, dgst);
+
+	// the digest verifies cms_sign() output without the content being read
+	if (cms_sign(cms, &cmslen, signers, 1, OID_cms_data, data, sizeof(data), NULL, 0) != 1
+		|| cms_verify_digest(cms, cmslen, NULL, 0, OID_cms_data, dgst,
+			&certs_der, &certs_len, &crls, &crls_len, &signer_infos, &signer_infos_len, 1) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// detached SignedData with several SignerInfos
+	if (cms_sign_digest(NULL, &len, signers, 3, OID_cms_data, dgst, NULL, 0) != 1
+		|| cms_sign_digest(cms, &cmslen, signers, 3, OID_cms_data, dgst, NULL, 0) != 1
+		|| cmslen != len
+		|| cms_verify_digest(cms, cmslen, NULL, 0, OID_cms_data, dgst,
+			&certs_der, &certs_len, &crls, &crls_len, &signer_infos, &signer_infos_len, 2) != 1) {
+		error_print();
+		return -1;
+	}
+	cms_print(stderr, 0, 0, "CMS", cms, cmslen);
+
+	dgst[0] ^= 1;
+	if (cms_verify_digest(cms, cmslen, NULL, 0, OID_cms_data, dgst,
+			&certs_der, &certs_len, &crls, &crls_len, &signer_infos, &signer_infos_len, 2) == 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+
 int main(int argc, char **argv)
 {
 	if (test_cms_content_type() != 1) goto err;
@@ -993,6 +1343,9 @@ int main(int argc, char **argv)
 	if (test_cms_recipient_info() != 1) goto err;
 	if (test_cms_enveloped_data() != 1) goto err;
 	if (test_cms_key_agreement_info() != 1) goto err;
+	if (test_cms_stream() != 1) goto err;
+	if (test_cms_envelop_multi() != 1) goto err;
+	if (test_cms_sign_digest() != 1) goto err;
 
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -46,5 +46,28 @@ int main(void)
 		printf("\n");
 	}
 
+	// the vectored update equals the contiguous one, with and without a native updatev
+	for (i = 0; i < sizeof(digests)/sizeof(digests[0]); i++) {
+		const DIGEST *algor = digest_from_name(digests[i]);
+		uint8_t msg[300];
+		uint8_t ref[64];
+		size_t reflen;
+		DIGEST_IOVEC iov[3] = { { msg, 1 }, { msg + 1, 200 }, { msg + 201, 99 } };
+		DIGEST_CTX ctx;
+
+		for (j = 0; j < sizeof(msg); j++) {
+			msg[j] = (uint8_t)j;
+		}
+		if (digest(algor, msg, sizeof(msg), ref, &reflen) != 1
+			|| digest_init(&ctx, algor) != 1
+			|| digest_updatev(&ctx, iov, 3) != 1
+			|| digest_finish(&ctx, dgst, &dgstlen) != 1
+			|| dgstlen != reflen
+			|| memcmp(dgst, ref, reflen) != 0) {
+			fprintf(stderr, "digest_updatev %s failed\n", digests[i]);
+			return 1;
+		}
+	}
+
 	return 0;
 }
@@ -0,0 +1,326 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/rand.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+static int test_dtls_replay_window(void)
+{
+	DTLS_REPLAY_WINDOW window;
+
+	dtls_replay_window_init(&window);
+	if (dtls_replay_window_check(&window, 5) != 1) {
+		error_print();
+		return -1;
+	}
+	dtls_replay_window_update(&window, 5);
+	dtls_replay_window_update(&window, 3);
+	dtls_replay_window_update(&window, 100);
+	if (dtls_replay_window_check(&window, 5) != 0 // out of the window now
+		|| dtls_replay_window_check(&window, 100) != 0
+		|| dtls_replay_window_check(&window, 99) != 1
+		|| dtls_replay_window_check(&window, 100 - DTLS_REPLAY_WINDOW_SIZE + 1) != 1
+		|| dtls_replay_window_check(&window, 100 - DTLS_REPLAY_WINDOW_SIZE) != 0
+		|| dtls_replay_window_check(&window, 101) != 1) {
+		error_print();
+		return -1;
+	}
+	dtls_replay_window_update(&window, 99);
+	if (dtls_replay_window_check(&window, 99) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_dtls_record(int protocol)
+{
+	DTLS_RECORD_CTX client;
+	DTLS_RECORD_CTX server;
+	uint8_t secret[32];
+	uint8_t msg[100];
+	uint8_t rec[3][sizeof(msg) + DTLS_RECORD_HEADER_SIZE + DTLS_RECORD_TAG_SIZE];
+	size_t reclen[3];
+	uint8_t buf[sizeof(rec[0])];
+	size_t len;
+	uint16_t epoch;
+	uint64_t seq;
+	int type;
+	int i;
+
+	rand_bytes(secret, sizeof(secret));
+	rand_bytes(msg, sizeof(msg));
+	if (dtls_record_init(&client, protocol) != 1
+		|| dtls_record_init(&server, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// epoch 0 in the clear
+	if (dtls_record_seal(&client, 0, TLS_record_handshake, msg, sizeof(msg), rec[0], &reclen[0]) != 1
+		|| reclen[0] != DTLS_RECORD_HEADER_SIZE + sizeof(msg)
+		|| memcmp(rec[0] + DTLS_RECORD_HEADER_SIZE, msg, sizeof(msg)) != 0
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 1
+		|| type != TLS_record_handshake || epoch != 0 || seq != 0
+		|| len != sizeof(msg) || memcmp(buf, msg, sizeof(msg)) != 0
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// epoch 2 with the same secret on both sides, unknown to the server first
+	if (dtls13_record_set_traffic_secret(&client, 1, 2, secret) != 1
+		|| dtls_record_seal(&client, 2, TLS_record_handshake, msg, sizeof(msg), rec[0], &reclen[0]) != 1
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 0
+		|| dtls13_record_set_traffic_secret(&server, 0, 2, secret) != 1
+		|| dtls13_record_set_traffic_secret(&server, 0, 1, secret) != -1) {
+		error_print();
+		return -1;
+	}
+	for (i = 1; i < 3; i++) {
+		if (dtls_record_seal(&client, 2, TLS_record_handshake, msg, sizeof(msg), rec[i], &reclen[i]) != 1
+			|| reclen[i] != DTLS_RECORD_HEADER_SIZE + sizeof(msg) + DTLS_RECORD_TAG_SIZE) {
+			error_print();
+			return -1;
+		}
+	}
+	// reordered, then replayed
+	if (dtls_record_open(&server, rec[2], reclen[2], &type, &epoch, &seq, buf, &len) != 1
+		|| epoch != 2 || seq != 2
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 1
+		|| seq != 0 || len != sizeof(msg) || memcmp(buf, msg, sizeof(msg)) != 0
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 0) {
+		error_print();
+		return -1;
+	}
+	// a forged record does not move the window
+	rec[1][DTLS_RECORD_HEADER_SIZE] ^= 1;
+	if (dtls_record_open(&server, rec[1], reclen[1], &type, &epoch, &seq, buf, &len) != 0) {
+		error_print();
+		return -1;
+	}
+	rec[1][DTLS_RECORD_HEADER_SIZE] ^= 1;
+
+	// epoch 3, records of epoch 2 still come in, in place
+	if (dtls13_record_set_traffic_secret(&client, 1, 3, secret) != 1
+		|| dtls13_record_set_traffic_secret(&server, 0, 3, secret) != 1
+		|| dtls_record_seal(&client, 3, TLS_record_application_data, msg, sizeof(msg), rec[0], &reclen[0]) != 1
+		|| dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 1
+		|| type != TLS_record_application_data || epoch != 3 || seq != 0
+		|| dtls_record_open(&server, rec[1], reclen[1], &type, &epoch, &seq,
+			rec[1] + DTLS_RECORD_HEADER_SIZE, &len) != 1
+		|| epoch != 2 || seq != 1
+		|| memcmp(rec[1] + DTLS_RECORD_HEADER_SIZE, msg, sizeof(msg)) != 0
+		|| dtls_record_seal(&client, 0, TLS_record_handshake, msg, sizeof(msg), rec[0], &reclen[0]) != -1) {
+		error_print();
+		return -1;
+	}
+
+	// the other protocol is dropped
+	rec[0][1] ^= 0xff;
+	if (dtls_record_open(&server, rec[0], reclen[0], &type, &epoch, &seq, buf, &len) != 0) {
+		error_print();
+		return -1;
+	}
+
+	dtls_record_cleanup(&client);
+	dtls_record_cleanup(&server);
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	return 1;
+}
+
+typedef struct {
+	uint8_t datagrams[8][DTLS_MAX_DATAGRAM_SIZE];
+	size_t lens[8];
+	size_t cnt;
+} DATAGRAMS;
+
+static tls_ret_t datagrams_send(void *arg, const uint8_t *buf, size_t len)
+{
+	DATAGRAMS *d = (DATAGRAMS *)arg;
+	if (d->cnt >= 8 || len > DTLS_MAX_DATAGRAM_SIZE) {
+		return -1;
+	}
+	memcpy(d->datagrams[d->cnt], buf, len);
+	d->lens[d->cnt++] = len;
+	return (tls_ret_t)len;
+}
+
+// open all the records of the datagrams, return the number opened
+static int datagrams_open(DTLS_RECORD_CTX *ctx, DATAGRAMS *d)
+{
+	uint8_t buf[DTLS_MAX_DATAGRAM_SIZE];
+	const uint8_t *p;
+	const uint8_t *rec;
+	size_t plen, reclen, len;
+	uint16_t epoch;
+	uint64_t seq;
+	int type;
+	int opened = 0;
+	size_t i;
+
+	for (i = 0; i < d->cnt; i++) {
+		p = d->datagrams[i];
+		plen = d->lens[i];
+		while (dtls_record_next(&p, &plen, &rec, &reclen) == 1) {
+			if (dtls_record_open(ctx, rec, reclen, &type, &epoch, &seq, buf, &len) == 1) {
+				opened++;
+			}
+		}
+	}
+	d->cnt = 0;
+	return opened;
+}
+
+static int test_dtls_flight(void)
+{
+	DTLS_RECORD_CTX client;
+	DTLS_RECORD_CTX server;
+	DTLS_FLIGHT *flight;
+	DATAGRAMS sent;
+	TLS_TRANSPORT transport;
+	uint8_t secret[32] = {1};
+	uint8_t msg[600] = {2};
+	uint64_t now = 5000;
+
+	if (!(flight = (DTLS_FLIGHT *)malloc(sizeof(DTLS_FLIGHT)))) {
+		error_print();
+		return -1;
+	}
+	dtls_flight_init(flight);
+	memset(&sent, 0, sizeof(sent));
+	transport.send = datagrams_send;
+	transport.recv = NULL;
+	transport.arg = &sent;
+
+	if (dtls_record_init(&client, TLS_protocol_dtls12) != 1
+		|| dtls_record_init(&server, TLS_protocol_dtls12) != 1
+		|| dtls13_record_set_traffic_secret(&server, 1, 2, secret) != 1
+		|| dtls13_record_set_traffic_secret(&client, 0, 2, secret) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// ServerHello in the clear, then two protected messages, in 2 datagrams of at most 1200 bytes
+	if (dtls_flight_add(flight, 0, TLS_record_handshake, msg, 100) != 1
+		|| dtls_flight_add(flight, 2, TLS_record_handshake, msg, sizeof(msg)) != 1
+		|| dtls_flight_add(flight, 2, TLS_record_handshake, msg, sizeof(msg)) != 1
+		|| dtls_flight_timeout(flight, now) != -1
+		|| dtls_flight_send(flight, &server, 1200, &transport, now) != 1
+		|| sent.cnt != 2
+		|| datagrams_open(&client, &sent) != 3) {
+		error_print();
+		return -1;
+	}
+
+	// lost, sent again after the timer with new record numbers, then after twice the time
+	if (dtls_flight_timeout(flight, now + 400) != DTLS_FLIGHT_INITIAL_TIMEOUT - 400
+		|| dtls_flight_retransmit(flight, &server, 1200, &transport, now + 400) != 0
+		|| dtls_flight_retransmit(flight, &server, 1200, &transport, now + DTLS_FLIGHT_INITIAL_TIMEOUT) != 1
+		|| datagrams_open(&client, &sent) != 3) {
+		error_print();
+		return -1;
+	}
+	now += DTLS_FLIGHT_INITIAL_TIMEOUT;
+	if (dtls_flight_timeout(flight, now) != 2 * DTLS_FLIGHT_INITIAL_TIMEOUT
+		|| dtls_flight_retransmit(flight, &server, 1200, &transport, now + 2 * DTLS_FLIGHT_INITIAL_TIMEOUT) != 1
+		|| flight->retransmissions != 2) {
+		error_print();
+		return -1;
+	}
+	sent.cnt = 0;
+
+	// the timeout is capped
+	while (flight->timeout < DTLS_FLIGHT_MAX_TIMEOUT) {
+		now += flight->timeout;
+		if (dtls_flight_retransmit(flight, &server, 1200, &transport, now + 2 * DTLS_FLIGHT_INITIAL_TIMEOUT) != 1) {
+			error_print();
+			return -1;
+		}
+		sent.cnt = 0;
+	}
+	if (flight->timeout != DTLS_FLIGHT_MAX_TIMEOUT) {
+		error_print();
+		return -1;
+	}
+
+	// answered, the next flight replaces this one
+	dtls_flight_ack(flight);
+	if (dtls_flight_timeout(flight, now) != -1
+		|| dtls_flight_add(flight, 2, TLS_record_handshake, msg, 10) != 1
+		|| flight->messages_cnt != 1
+		|| dtls_flight_send(flight, &server, 1200, &transport, now) != 1
+		|| flight->timeout != DTLS_FLIGHT_INITIAL_TIMEOUT
+		|| datagrams_open(&client, &sent) != 1) {
+		error_print();
+		return -1;
+	}
+	// a message that does not fit the MTU
+	dtls_flight_ack(flight);
+	if (dtls_flight_add(flight, 2, TLS_record_handshake, msg, sizeof(msg)) != 1
+		|| dtls_flight_send(flight, &server, 500, &transport, now) != -1) {
+		error_print();
+		return -1;
+	}
+
+	free(flight);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_dtls_cookie(void)
+{
+	uint8_t secret[32];
+	uint8_t addr[6] = { 192, 168, 1, 1, 0x1f, 0x90 };
+	uint8_t client_random[32];
+	uint8_t cookie[DTLS_COOKIE_SIZE];
+	uint32_t now = 1700000000;
+
+	rand_bytes(secret, sizeof(secret));
+	rand_bytes(client_random, sizeof(client_random));
+	if (dtls_cookie_generate(secret, addr, sizeof(addr), client_random, now, cookie) != 1
+		|| dtls_cookie_verify(secret, addr, sizeof(addr), client_random, now + 10, 60, cookie, sizeof(cookie)) != 1
+		|| dtls_cookie_verify(secret, addr, sizeof(addr), client_random, now + 61, 60, cookie, sizeof(cookie)) != 0
+		|| dtls_cookie_verify(secret, addr, sizeof(addr), client_random, now - 1, 60, cookie, sizeof(cookie)) != 0
+		|| dtls_cookie_verify(secret, addr, sizeof(addr) - 1, client_random, now, 60, cookie, sizeof(cookie)) != 0
+		|| dtls_cookie_verify(secret, addr, sizeof(addr), client_random, now, 60, cookie, sizeof(cookie) - 1) != 0) {
+		error_print();
+		return -1;
+	}
+	client_random[0] ^= 1;
+	if (dtls_cookie_verify(secret, addr, sizeof(addr), client_random, now, 60, cookie, sizeof(cookie)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_dtls_replay_window() != 1) goto err;
+	if (test_dtls_record(TLS_protocol_dtls12) != 1) goto err;
+	if (test_dtls_record(TLS_protocol_tlcp) != 1) goto err;
+	if (test_dtls_flight() != 1) goto err;
+	if (test_dtls_cookie() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
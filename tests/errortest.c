@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/error.h>
+
+
+static int test_error_queue(void)
+{
+	const char *file;
+	const char *func;
+	const char *msg;
+	int line;
+	uint64_t count = error_count();
+
+	error_queue_clear();
+	error_queue_push(__FILE__, 1, __FUNCTION__, NULL);
+	error_queue_push_msg(__FILE__, 2, __FUNCTION__, "length %d\n", 5);
+
+	if (error_count() != count + 2
+		|| error_queue_get(&file, &line, &func, &msg) != 1
+		|| strcmp(file, __FILE__) != 0 || line != 1 || strcmp(func, __FUNCTION__) != 0 || msg != NULL
+		|| error_queue_get(&file, &line, &func, &msg) != 1
+		|| line != 2 || strcmp(msg, "length 5\n") != 0
+		|| error_queue_get(&file, &line, &func, &msg) != 0) {
+		fprintf(stderr, "%s:%d: failed\n", __FILE__, __LINE__);
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// only the newest ERROR_QUEUE_SIZE errors are kept
+static int test_error_queue_overflow(void)
+{
+	int line;
+	int i;
+
+	error_queue_clear();
+	for (i = 0; i < ERROR_QUEUE_SIZE + 3; i++) {
+		error_queue_push(__FILE__, i, __FUNCTION__, "overflow");
+	}
+	for (i = 3; i < ERROR_QUEUE_SIZE + 3; i++) {
+		if (error_queue_get(NULL, &line, NULL, NULL) != 1 || line != i) {
+			fprintf(stderr, "%s:%d: failed\n", __FILE__, __LINE__);
+			return -1;
+		}
+	}
+	if (error_queue_get(NULL, NULL, NULL, NULL) != 0) {
+		fprintf(stderr, "%s:%d: failed\n", __FILE__, __LINE__);
+		return -1;
+	}
+
+	error_queue_push(__FILE__, __LINE__, __FUNCTION__, "printed");
+	error_queue_print(stdout);
+	if (error_queue_get(NULL, NULL, NULL, NULL) != 0) {
+		fprintf(stderr, "%s:%d: failed\n", __FILE__, __LINE__);
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_error_queue() != 1) goto err;
+	if (test_error_queue_overflow() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	return -1;
+}
@@ -12,9 +12,11 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/ghash.h>
+#include <gmssl/cpu.h>
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
+#include <gmssl/endian.h>
 
 
 struct {
@@ -107,6 +109,7 @@ int test_ghash(void)
 			format_print(stderr, 0, 2, "C = %s\n", ghash_tests[i].C);
 			format_bytes(stderr, 0, 2, "GHASH(H,A,C) = ", out, 16);
 			format_print(stderr, 0, 2, "             = %s\n\n", ghash_tests[i].T);
+			return -1;
 		}
 	}
 
@@ -114,6 +117,90 @@ int test_ghash(void)
 	return 1;
 }
 
+// bitwise GHASH with gf128_mul only
+static void ghash_ref(const uint8_t h[16], const uint8_t *aad, size_t aadlen,
+	const uint8_t *c, size_t clen, uint8_t out[16])
+{
+	gf128_t H, X, B;
+	uint8_t block[16];
+	size_t len;
+
+	gf128_from_bytes(H, h);
+	gf128_set_zero(X);
+
+	for (len = 0; len < aadlen; len += 16) {
+		memset(block, 0, 16);
+		memcpy(block, aad + len, aadlen - len < 16 ? aadlen - len : 16);
+		gf128_from_bytes(B, block);
+		gf128_add(X, X, B);
+		gf128_mul(X, X, H);
+	}
+	for (len = 0; len < clen; len += 16) {
+		memset(block, 0, 16);
+		memcpy(block, c + len, clen - len < 16 ? clen - len : 16);
+		gf128_from_bytes(B, block);
+		gf128_add(X, X, B);
+		gf128_mul(X, X, H);
+	}
+	PUTU64(block, (uint64_t)aadlen << 3);
+	PUTU64(block + 8, (uint64_t)clen << 3);
+	gf128_from_bytes(B, block);
+	gf128_add(X, X, B);
+	gf128_mul(X, X, H);
+	gf128_to_bytes(X, out);
+}
+
+static int test_ghash_blocks(void)
+{
+	uint8_t H[16];
+	uint8_t A[200];
+	uint8_t C[16 * 40];
+	uint8_t ref[16];
+	uint8_t out[16];
+	GHASH_CTX ctx;
+	size_t aadlen, clen, i;
+
+	rand_bytes(H, sizeof(H));
+	rand_bytes(A, sizeof(A));
+	for (i = 0; i < sizeof(C); i += 16) {
+		rand_bytes(C + i, 16);
+	}
+
+	for (aadlen = 0; aadlen <= sizeof(A); aadlen += 13) {
+		for (clen = 0; clen <= sizeof(C); clen += 37) {
+			ghash_ref(H, A, aadlen, C, clen, ref);
+
+			ghash(H, A, aadlen, C, clen, out);
+			if (memcmp(out, ref, 16) != 0) {
+				error_print();
+				return -1;
+			}
+
+			// split updates exercise the partial block buffer
+			ghash_init(&ctx, H, A, aadlen);
+			ghash_update(&ctx, C, clen / 3);
+			ghash_update(&ctx, C + clen / 3, clen - clen / 3);
+			ghash_finish(&ctx, out);
+			if (memcmp(out, ref, 16) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	// h and out alias, as called by the GCM modes
+	ghash_ref(H, A, 20, C, 300, ref);
+	memcpy(out, H, 16);
+	ghash(out, A, 20, C, 300, out);
+	if (memcmp(out, ref, 16) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 #if 0
 int test_gcm(void)
 {
@@ -181,9 +268,26 @@ int test_gcm(void)
 #endif
 
 
+// the 4-bit table path of the builds and CPUs without a carry-less multiply or SIMD128
+static int test_ghash_4bit(void)
+{
+	gmssl_cpu_disable_features(GMSSL_CPU_PCLMUL|GMSSL_CPU_ARM_PMULL|GMSSL_CPU_WASM_SIMD128);
+
+	if (test_ghash() != 1
+		|| test_ghash_blocks() != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(int argc, char **argv)
 {
 	if (test_ghash() != 1) goto err;
+	if (test_ghash_blocks() != 1) goto err;
+	if (test_ghash_4bit() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
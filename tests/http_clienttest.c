@@ -0,0 +1,279 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/http.h>
+#include <gmssl/socket.h>
+#include <gmssl/error.h>
+#include "test_server.h"
+
+#ifndef WIN32
+#include <pthread.h>
+
+
+/*
+ * A local keep-alive server with the resources
+ *	/len		Content-Length body
+ *	/chunked	chunked body
+ *	/close		body ending with the connection, then the connection is closed
+ *	/bye		Content-Length body with "Connection: close"
+ */
+static pthread_mutex_t server_lock = PTHREAD_MUTEX_INITIALIZER;
+static int server_accepts = 0;
+static uint8_t server_body[10000];
+
+static int server_send(tls_socket_t conn, const void *buf, size_t len)
+{
+	return tls_socket_send(conn, buf, len, 0) == (tls_ret_t)len ? 1 : -1;
+}
+
+static void server_conn(tls_socket_t conn)
+{
+	char req[1024];
+	size_t reqlen = 0;
+	char rsp[256];
+	int rsplen;
+	char *end;
+	int close_conn;
+	size_t off;
+
+	pthread_mutex_lock(&server_lock);
+	server_accepts++;
+	pthread_mutex_unlock(&server_lock);
+
+	req[0] = 0;
+	for (;;) {
+		while (!(end = strstr(req, "\r\n\r\n"))) {
+			tls_ret_t n;
+			if (reqlen >= sizeof(req) - 1
+				|| (n = tls_socket_recv(conn, req + reqlen, sizeof(req) - 1 - reqlen, 0)) <= 0) {
+				goto end;
+			}
+			reqlen += n;
+			req[reqlen] = 0;
+		}
+		close_conn = 0;
+
+		if (strncmp(req, "GET /len ", 9) == 0) {
+			rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.1 200 OK\r\nContent-Length: %zu\r\nETag: \"len\"\r\n\r\n",
+				sizeof(server_body));
+			server_send(conn, rsp, rsplen);
+			server_send(conn, server_body, sizeof(server_body));
+
+		} else if (strncmp(req, "GET /chunked ", 13) == 0) {
+			rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.1 200 OK\r\nTransfer-Encoding: chunked\r\n\r\n");
+			server_send(conn, rsp, rsplen);
+			for (off = 0; off < sizeof(server_body); off += 3000) {
+				size_t len = sizeof(server_body) - off < 3000 ? sizeof(server_body) - off : 3000;
+				rsplen = snprintf(rsp, sizeof(rsp), "%zX;ext=1\r\n", len);
+				server_send(conn, rsp, rsplen);
+				server_send(conn, server_body + off, len);
+				server_send(conn, "\r\n", 2);
+			}
+			rsplen = snprintf(rsp, sizeof(rsp), "0\r\nX-Trailer: 1\r\n\r\n");
+			server_send(conn, rsp, rsplen);
+
+		} else if (strncmp(req, "GET /close ", 11) == 0) {
+			rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.1 200 OK\r\nConnection: close\r\n\r\n");
+			server_send(conn, rsp, rsplen);
+			server_send(conn, server_body, sizeof(server_body));
+			close_conn = 1;
+
+		} else if (strncmp(req, "GET /bye ", 9) == 0) {
+			rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.1 200 OK\r\nContent-Length: 3\r\nConnection: close\r\n\r\nbye");
+			server_send(conn, rsp, rsplen);
+			close_conn = 1;
+
+		} else {
+			rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n");
+			server_send(conn, rsp, rsplen);
+		}
+		if (close_conn) {
+			break;
+		}
+		end += 4;
+		reqlen -= end - req;
+		memmove(req, end, reqlen + 1);
+	}
+end:
+	tls_socket_close(conn);
+}
+
+static int server_start(int *port)
+{
+	size_t i;
+
+	for (i = 0; i < sizeof(server_body); i++) {
+		server_body[i] = (uint8_t)(i * 7 + 1);
+	}
+	if (test_server_start(server_conn, port) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int server_get_accepts(void)
+{
+	int ret;
+	pthread_mutex_lock(&server_lock);
+	ret = server_accepts;
+	pthread_mutex_unlock(&server_lock);
+	return ret;
+}
+
+static int get_and_check(HTTP_CLIENT *client, int port, const char *path,
+	const uint8_t *expected, size_t expected_len)
+{
+	char uri[64];
+	HTTP_VALIDATORS validators;
+	uint8_t *content = NULL;
+	size_t contentlen;
+
+	memset(&validators, 0, sizeof(validators));
+	snprintf(uri, sizeof(uri), "http://127.0.0.1:%d%s", port, path);
+	if (http_client_get_new(client, uri, &validators, &content, &contentlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (contentlen != expected_len || memcmp(content, expected, expected_len) != 0) {
+		free(content);
+		error_print();
+		return -1;
+	}
+	free(content);
+	return 1;
+}
+
+static int test_http_client_keep_alive(int port)
+{
+	HTTP_CLIENT *client;
+	int accepts = server_get_accepts();
+	int ret = -1;
+
+	if (!(client = http_client_new(5))) {
+		error_print();
+		return -1;
+	}
+
+	// one connection for all the GETs of Content-Length and chunked bodies
+	if (get_and_check(client, port, "/len", server_body, sizeof(server_body)) != 1
+		|| get_and_check(client, port, "/chunked", server_body, sizeof(server_body)) != 1
+		|| get_and_check(client, port, "/len", server_body, sizeof(server_body)) != 1) {
+		error_print();
+		goto end;
+	}
+	if (http_client_connect_count(client) != 1
+		|| http_client_idle_count(client) != 1
+		|| server_get_accepts() != accepts + 1) {
+		error_print();
+		goto end;
+	}
+
+	// the connection is not pooled after "Connection: close"
+	if (get_and_check(client, port, "/bye", (uint8_t *)"bye", 3) != 1
+		|| http_client_idle_count(client) != 0
+		|| get_and_check(client, port, "/close", server_body, sizeof(server_body)) != 1
+		|| http_client_idle_count(client) != 0
+		|| get_and_check(client, port, "/len", server_body, sizeof(server_body)) != 1
+		|| http_client_connect_count(client) != 3) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	http_client_free(client);
+	return ret;
+}
+
+static int test_http_client_no_pool(int port)
+{
+	int accepts = server_get_accepts();
+
+	if (get_and_check(NULL, port, "/chunked", server_body, sizeof(server_body)) != 1
+		|| get_and_check(NULL, port, "/len", server_body, sizeof(server_body)) != 1
+		|| server_get_accepts() != accepts + 2) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int count_bytes(void *arg, size_t content_length, const uint8_t *data, size_t datalen)
+{
+	size_t *cnt = (size_t *)arg;
+	if (content_length != HTTP_LENGTH_UNKNOWN) {
+		return -1;
+	}
+	*cnt += datalen;
+	return 1;
+}
+
+static int test_http_client_get(int port)
+{
+	HTTP_CLIENT *client;
+	char uri[64];
+	size_t cnt = 0;
+	int ret = -1;
+
+	if (!(client = http_client_new(5))) {
+		error_print();
+		return -1;
+	}
+	snprintf(uri, sizeof(uri), "http://127.0.0.1:%d/chunked", port);
+	if (http_client_get(client, uri, NULL, count_bytes, &cnt) != 1
+		|| cnt != sizeof(server_body)) {
+		error_print();
+		goto end;
+	}
+	// the callback can stop the transfer
+	snprintf(uri, sizeof(uri), "http://127.0.0.1:%d/len", port);
+	if (http_client_get(client, uri, NULL, count_bytes, &cnt) != -1) {
+		error_print();
+		goto end;
+	}
+	snprintf(uri, sizeof(uri), "http://127.0.0.1:%d/none", port);
+	if (http_client_get(client, uri, NULL, count_bytes, &cnt) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	http_client_free(client);
+	return ret;
+}
+#endif
+
+int main(void)
+{
+#ifndef WIN32
+	int port;
+
+	if (server_start(&port) != 1) goto err;
+	if (test_http_client_keep_alive(port) != 1) goto err;
+	if (test_http_client_no_pool(port) != 1) goto err;
+	if (test_http_client_get(port) != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+#ifndef WIN32
+err:
+	error_print();
+	return 1;
+#endif
+}
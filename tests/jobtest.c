@@ -0,0 +1,472 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm9.h>
+#include <gmssl/job.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#ifndef _WIN32
+#include <sys/select.h>
+#endif
+
+
+#define JOBS_CNT 40
+
+static int test_job_sm3(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB jobs[JOBS_CNT];
+	GMSSL_JOB *job;
+	uint8_t data[JOBS_CNT][100];
+	uint8_t dgsts[JOBS_CNT][32];
+	uint8_t dgst[32];
+	SM3_CTX ctx;
+	size_t i, n = 0;
+
+	if (!(queue = gmssl_job_queue_new(8))) {
+		error_print();
+		return -1;
+	}
+	memset(jobs, 0, sizeof(jobs));
+	for (i = 0; i < JOBS_CNT; i++) {
+		memset(data[i], (int)i, sizeof(data[i]));
+		jobs[i].op = GMSSL_JOB_sm3_digest;
+		jobs[i].in = data[i];
+		jobs[i].inlen = i;
+		jobs[i].out = dgsts[i];
+		if (gmssl_job_submit(queue, &jobs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	while (gmssl_job_wait(queue, &job) == 1) {
+		i = job - jobs;
+		sm3_init(&ctx);
+		sm3_update(&ctx, data[i], i);
+		sm3_finish(&ctx, dgst);
+		if (job->ret != 1 || memcmp(job->out, dgst, 32) != 0) {
+			error_print();
+			return -1;
+		}
+		n++;
+	}
+	if (n != JOBS_CNT || gmssl_job_poll(queue, &job) != 0) {
+		error_print();
+		return -1;
+	}
+	gmssl_job_queue_free(queue);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_job_sm2(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB sign[JOBS_CNT];
+	GMSSL_JOB verify[JOBS_CNT];
+	GMSSL_JOB *job;
+	SM2_KEY key;
+	uint8_t dgsts[JOBS_CNT][32];
+	uint8_t sigs[JOBS_CNT][SM2_MAX_SIGNATURE_SIZE];
+	size_t i, n;
+
+	if (sm2_key_generate(&key) != 1
+		|| rand_bytes(dgsts[0], sizeof(dgsts)) != 1
+		|| !(queue = gmssl_job_queue_new(0))) {
+		error_print();
+		return -1;
+	}
+	memset(sign, 0, sizeof(sign));
+	for (i = 0; i < JOBS_CNT; i++) {
+		sign[i].op = GMSSL_JOB_sm2_sign;
+		sign[i].key = &key;
+		sign[i].dgst = dgsts[i];
+		sign[i].out = sigs[i];
+		if (gmssl_job_submit(queue, &sign[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	for (n = 0; gmssl_job_wait(queue, &job) == 1; n++) {
+		if (job->ret != 1 || sm2_verify(&key, job->dgst, job->out, job->outlen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (n != JOBS_CNT) {
+		error_print();
+		return -1;
+	}
+
+	// the last one is checked against a wrong digest, the one before is not DER
+	memset(verify, 0, sizeof(verify));
+	for (i = 0; i < JOBS_CNT; i++) {
+		verify[i].op = GMSSL_JOB_sm2_verify;
+		verify[i].key = &key;
+		verify[i].dgst = dgsts[i == JOBS_CNT - 1 ? 0 : i];
+		verify[i].in = sigs[i];
+		verify[i].inlen = i == JOBS_CNT - 2 ? 8 : sign[i].outlen;
+		if (gmssl_job_submit(queue, &verify[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	for (n = 0; gmssl_job_wait(queue, &job) == 1; n++) {
+		i = job - verify;
+		if (job->ret != (i >= JOBS_CNT - 2 ? -1 : 1)) {
+			error_print();
+			return -1;
+		}
+	}
+	if (n != JOBS_CNT) {
+		error_print();
+		return -1;
+	}
+	gmssl_job_queue_free(queue);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_job_sm4_sm9(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB jobs[4];
+	GMSSL_JOB *job;
+	SM4_KEY sm4_key;
+	SM9_ENC_MASTER_KEY master;
+	SM9_ENC_KEY sm9_key;
+	const char *id = "Alice";
+	uint8_t raw_key[16] = {0};
+	uint8_t iv[12] = {0};
+	uint8_t msg[100] = {1, 2, 3};
+	uint8_t buf[100];
+	uint8_t plain[100];
+	uint8_t tag[16];
+	uint8_t sm9_buf[SM9_MAX_CIPHERTEXT_SIZE];
+	uint8_t sm9_plain[SM9_MAX_PLAINTEXT_SIZE];
+	size_t i;
+
+	sm4_set_encrypt_key(&sm4_key, raw_key);
+	if (sm9_enc_master_key_generate(&master) != 1
+		|| sm9_enc_master_key_extract_key(&master, id, strlen(id), &sm9_key) != 1
+		|| !(queue = gmssl_job_queue_new(0))) {
+		error_print();
+		return -1;
+	}
+	memset(jobs, 0, sizeof(jobs));
+	jobs[0].op = GMSSL_JOB_sm4_gcm_encrypt;
+	jobs[0].key = &sm4_key;
+	jobs[0].iv = iv;
+	jobs[0].ivlen = sizeof(iv);
+	jobs[0].in = msg;
+	jobs[0].inlen = sizeof(msg);
+	jobs[0].out = buf;
+	jobs[0].tag = tag;
+	jobs[0].taglen = sizeof(tag);
+	jobs[1].op = GMSSL_JOB_sm9_encrypt;
+	jobs[1].key = &master;
+	jobs[1].id = id;
+	jobs[1].idlen = strlen(id);
+	jobs[1].in = msg;
+	jobs[1].inlen = sizeof(msg);
+	jobs[1].out = sm9_buf;
+	for (i = 0; i < 2; i++) {
+		if (gmssl_job_submit(queue, &jobs[i]) != 1
+			|| gmssl_job_wait(queue, &job) != 1
+			|| job != &jobs[i]
+			|| job->ret != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	jobs[2] = jobs[0];
+	jobs[2].op = GMSSL_JOB_sm4_gcm_decrypt;
+	jobs[2].in = buf;
+	jobs[2].out = plain;
+	jobs[3].op = GMSSL_JOB_sm9_decrypt;
+	jobs[3].key = &sm9_key;
+	jobs[3].id = id;
+	jobs[3].idlen = strlen(id);
+	jobs[3].in = sm9_buf;
+	jobs[3].inlen = jobs[1].outlen;
+	jobs[3].out = sm9_plain;
+	if (gmssl_job_submit(queue, &jobs[2]) != 1
+		|| gmssl_job_submit(queue, &jobs[3]) != 1
+		|| gmssl_job_wait(queue, &job) != 1
+		|| gmssl_job_wait(queue, &job) != 1
+		|| gmssl_job_wait(queue, &job) != 0
+		|| jobs[2].ret != 1
+		|| memcmp(plain, msg, sizeof(msg)) != 0
+		|| jobs[3].ret != 1
+		|| jobs[3].outlen != sizeof(msg)
+		|| memcmp(sm9_plain, msg, sizeof(msg)) != 0) {
+		error_print();
+		return -1;
+	}
+	gmssl_job_queue_free(queue);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_job_sm2_sm4_bulk(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB jobs[5];
+	GMSSL_JOB *job;
+	SM2_KEY key;
+	SM2_KEY peer;
+	SM4_KEY sm4_key;
+	uint8_t raw_key[16];
+	uint8_t iv[16];
+	uint8_t ctr[16];
+	uint8_t msg[160];
+	uint8_t cbc_buf[160];
+	uint8_t ctr_buf[150];
+	uint8_t buf[160];
+	uint8_t ciphertext[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t ciphertext_len;
+	uint8_t plain[SM2_MAX_PLAINTEXT_SIZE];
+	uint8_t peer_public[65];
+	uint8_t key_public[65];
+	uint8_t shared[64];
+	uint8_t ecdh[64];
+	size_t i;
+
+	rand_bytes(raw_key, sizeof(raw_key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(msg, sizeof(msg));
+	if (sm2_key_generate(&key) != 1
+		|| sm2_key_generate(&peer) != 1
+		|| sm2_encrypt(&key, msg, 48, ciphertext, &ciphertext_len) != 1
+		|| !(queue = gmssl_job_queue_new(0))) {
+		error_print();
+		return -1;
+	}
+	peer_public[0] = 0x04;
+	sm2_z256_point_to_bytes(&peer.public_key, peer_public + 1);
+
+	memset(jobs, 0, sizeof(jobs));
+	jobs[0].op = GMSSL_JOB_sm2_decrypt;
+	jobs[0].key = &key;
+	jobs[0].in = ciphertext;
+	jobs[0].inlen = ciphertext_len;
+	jobs[0].out = plain;
+	jobs[1].op = GMSSL_JOB_sm2_ecdh;
+	jobs[1].key = &key;
+	jobs[1].in = peer_public;
+	jobs[1].inlen = sizeof(peer_public);
+	jobs[1].out = ecdh;
+	jobs[2].op = GMSSL_JOB_sm4_cbc_encrypt;
+	jobs[2].key = raw_key;
+	jobs[2].iv = iv;
+	jobs[2].in = msg;
+	jobs[2].inlen = sizeof(msg);
+	jobs[2].out = cbc_buf;
+	jobs[3].op = GMSSL_JOB_sm4_ctr_encrypt;
+	jobs[3].key = raw_key;
+	jobs[3].iv = iv;
+	jobs[3].in = msg;
+	jobs[3].inlen = sizeof(ctr_buf);
+	jobs[3].out = ctr_buf;
+	jobs[4] = jobs[2];
+	jobs[4].inlen = 15;
+	for (i = 0; i < 5; i++) {
+		if (gmssl_job_submit(queue, &jobs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	while (gmssl_job_wait(queue, &job) == 1) {
+	}
+
+	if (jobs[0].ret != 1 || jobs[0].outlen != 48 || memcmp(plain, msg, 48) != 0) {
+		error_print();
+		return -1;
+	}
+	key_public[0] = 0x04;
+	sm2_z256_point_to_bytes(&key.public_key, key_public + 1);
+	if (sm2_ecdh(&peer, key_public, sizeof(key_public), shared) != 1
+		|| jobs[1].ret != 1
+		|| memcmp(ecdh, shared, 64) != 0) {
+		error_print();
+		return -1;
+	}
+	sm4_set_encrypt_key(&sm4_key, raw_key);
+	memcpy(ctr, iv, 16);
+	sm4_cbc_encrypt_blocks(&sm4_key, ctr, msg, sizeof(msg)/16, buf);
+	if (jobs[2].ret != 1 || memcmp(cbc_buf, buf, sizeof(msg)) != 0) {
+		error_print();
+		return -1;
+	}
+	memcpy(ctr, iv, 16);
+	sm4_ctr_encrypt(&sm4_key, ctr, msg, sizeof(ctr_buf), buf);
+	if (jobs[3].ret != 1 || memcmp(ctr_buf, buf, sizeof(ctr_buf)) != 0) {
+		error_print();
+		return -1;
+	}
+	// not a multiple of the block size
+	if (jobs[4].ret != -1) {
+		error_print();
+		return -1;
+	}
+
+	jobs[2].op = GMSSL_JOB_sm4_cbc_decrypt;
+	jobs[2].in = cbc_buf;
+	jobs[2].out = buf;
+	if (gmssl_job_submit(queue, &jobs[2]) != 1
+		|| gmssl_job_wait(queue, &job) != 1
+		|| job->ret != 1
+		|| memcmp(buf, msg, sizeof(msg)) != 0) {
+		error_print();
+		return -1;
+	}
+	gmssl_job_queue_free(queue);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int custom_func(void *arg)
+{
+	int *val = (int *)arg;
+	(*val)++;
+	return 1;
+}
+
+static void custom_callback(GMSSL_JOB *job)
+{
+	int *called = (int *)job->callback_arg;
+	(*called) += job->ret;
+}
+
+static int test_job_custom(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB jobs[JOBS_CNT];
+	GMSSL_JOB *job;
+	int vals[JOBS_CNT] = {0};
+	int called = 0;
+	size_t i;
+
+	if (!(queue = gmssl_job_queue_new(4))) {
+		error_print();
+		return -1;
+	}
+	memset(jobs, 0, sizeof(jobs));
+	jobs[0].op = GMSSL_JOB_custom;
+	if (gmssl_job_submit(queue, &jobs[0]) != -1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < JOBS_CNT; i++) {
+		jobs[i].op = GMSSL_JOB_custom;
+		jobs[i].func = custom_func;
+		jobs[i].arg = &vals[i];
+		jobs[i].callback = custom_callback;
+		jobs[i].callback_arg = &called;
+		if (gmssl_job_submit(queue, &jobs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// jobs with callbacks are never returned
+	if (gmssl_job_wait(queue, &job) != 0) {
+		error_print();
+		return -1;
+	}
+	// the queue finishes the submitted jobs before it is freed
+	gmssl_job_queue_free(queue);
+	if (called != JOBS_CNT) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < JOBS_CNT; i++) {
+		if (vals[i] != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifndef _WIN32
+static int test_job_queue_fd(void)
+{
+	GMSSL_JOB_QUEUE *queue;
+	GMSSL_JOB job;
+	GMSSL_JOB *done;
+	uint8_t dgst[32];
+	struct timeval tv = {0, 0};
+	fd_set fds;
+	int fd;
+
+	if (!(queue = gmssl_job_queue_new(0))
+		|| (fd = gmssl_job_queue_fd(queue)) < 0) {
+		error_print();
+		return -1;
+	}
+	memset(&job, 0, sizeof(job));
+	job.op = GMSSL_JOB_sm3_digest;
+	job.out = dgst;
+	if (gmssl_job_submit(queue, &job) != 1) {
+		error_print();
+		return -1;
+	}
+
+	FD_ZERO(&fds);
+	FD_SET(fd, &fds);
+	if (select(fd + 1, &fds, NULL, NULL, NULL) != 1
+		|| gmssl_job_poll(queue, &done) != 1
+		|| done != &job) {
+		error_print();
+		return -1;
+	}
+	// not readable once the finished jobs are returned
+	FD_ZERO(&fds);
+	FD_SET(fd, &fds);
+	if (select(fd + 1, &fds, NULL, NULL, &tv) != 0) {
+		error_print();
+		return -1;
+	}
+	gmssl_job_queue_free(queue);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+	if (test_job_sm3() != 1) goto err;
+	if (test_job_sm2() != 1) goto err;
+	if (test_job_sm4_sm9() != 1) goto err;
+	if (test_job_sm2_sm4_bulk() != 1) goto err;
+	if (test_job_custom() != 1) goto err;
+#ifndef _WIN32
+	if (test_job_queue_fd() != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
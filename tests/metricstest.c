@@ -0,0 +1,125 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#include <gmssl/sm2.h>
+#include <gmssl/metrics.h>
+#ifndef WIN32
+#include <pthread.h>
+#endif
+
+
+static int sign_and_verify(int count)
+{
+	SM2_KEY sm2_key;
+	uint8_t dgst[32];
+	SM2_SIGNATURE sig;
+	int i;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		rand_bytes(dgst, sizeof(dgst));
+		if (sm2_do_sign(&sm2_key, dgst, &sig) != 1
+			|| sm2_do_verify(&sm2_key, dgst, &sig) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int test_metrics_sm2(void)
+{
+	METRICS before;
+	METRICS after;
+
+	if (metrics_snapshot(&before) != 1
+		|| sign_and_verify(5) != 1
+		|| metrics_snapshot(&after) != 1) {
+		error_print();
+		return -1;
+	}
+	if (after.values[METRICS_sm2_signs] - before.values[METRICS_sm2_signs] != 5
+		|| after.values[METRICS_sm2_verifies] - before.values[METRICS_sm2_verifies] != 5
+		|| after.values[METRICS_sm2_sign_nsec] <= before.values[METRICS_sm2_sign_nsec]
+		|| after.values[METRICS_sm2_verify_nsec] <= before.values[METRICS_sm2_verify_nsec]) {
+		error_print();
+		return -1;
+	}
+	metrics_print(stderr, 0, 0, "metrics", &after);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifndef WIN32
+static void *sign_thread(void *arg)
+{
+	*(int *)arg = sign_and_verify(3);
+	return NULL;
+}
+
+// the counters of an exited thread are kept
+static int test_metrics_thread_exit(void)
+{
+	METRICS before;
+	METRICS after;
+	pthread_t tid;
+	int ret = -1;
+
+	if (metrics_snapshot(&before) != 1
+		|| pthread_create(&tid, NULL, sign_thread, &ret) != 0) {
+		error_print();
+		return -1;
+	}
+	pthread_join(tid, NULL);
+	if (ret != 1
+		|| metrics_snapshot(&after) != 1
+		|| after.values[METRICS_sm2_signs] - before.values[METRICS_sm2_signs] != 3) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+static int test_metrics_name(void)
+{
+	if (strcmp(metrics_name(METRICS_tlcp_full_handshakes), "tlcp_full_handshakes") != 0
+		|| strcmp(metrics_name(METRICS_rand_reseeds), "rand_reseeds") != 0
+		|| metrics_name(METRICS_COUNT) != NULL) {
+		error_print();
+		return -1;
+	}
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_metrics_sm2() != 1) goto err;
+#ifndef WIN32
+	if (test_metrics_thread_exit() != 1) goto err;
+#endif
+	if (test_metrics_name() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return -1;
+}
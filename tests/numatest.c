@@ -0,0 +1,126 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/numa.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/error.h>
+
+
+static int test_numa_topology(void)
+{
+	int nodes = gmssl_numa_nodes();
+	int node;
+
+	if (nodes < 1 || nodes > GMSSL_NUMA_MAX_NODES) {
+		error_print();
+		return -1;
+	}
+	node = gmssl_numa_node_of_cpu(0);
+	if (node < 0 || node >= nodes
+		|| gmssl_numa_node_of_cpu(-1) != 0) {
+		error_print();
+		return -1;
+	}
+	if (gmssl_numa_thread_node() != -1
+		|| gmssl_numa_bind_thread(nodes) != -1
+		|| gmssl_numa_set_thread_node(-2) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_numa_replica(void)
+{
+	static GMSSL_NUMA_REPLICA replica;
+	static const uint8_t data[5000] = { 1, 2, 3 };
+	const uint8_t *p;
+	const uint8_t *q;
+
+	// unbound threads read the shared data
+	if (gmssl_numa_replica(&replica, data, sizeof(data)) != data) {
+		error_print();
+		return -1;
+	}
+
+	if (gmssl_numa_bind_thread(gmssl_numa_node_of_cpu(0)) != 1
+		|| gmssl_numa_thread_node() != gmssl_numa_node_of_cpu(0)) {
+		error_print();
+		return -1;
+	}
+	p = gmssl_numa_replica(&replica, data, sizeof(data));
+	q = gmssl_numa_replica(&replica, data, sizeof(data));
+	if (p != q || memcmp(p, data, sizeof(data)) != 0) {
+		error_print();
+		return -1;
+	}
+	// a single node has no copies
+	if (gmssl_numa_nodes() == 1 && p != data) {
+		error_print();
+		return -1;
+	}
+
+	if (gmssl_numa_set_thread_node(-1) != 1
+		|| gmssl_numa_replica(&replica, data, sizeof(data)) != data) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_numa_generator_table(void)
+{
+	const char *hex_G =
+		"32c4ae2c1f1981195f9904466a39c9948fe30bbff2660be1715a4589334c74c7"
+		"bc3736a2f4f6779c59bdcee36b692153d0a9877cc62a474002df32e52139f0a0";
+	SM2_Z256_POINT G;
+	SM2_Z256_POINT P;
+	SM2_Z256_POINT Q;
+	sm2_z256_t k;
+	int i;
+
+	sm2_z256_point_from_hex(&G, hex_G);
+	if (gmssl_numa_bind_thread(gmssl_numa_node_of_cpu(0)) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 4; i++) {
+		sm2_z256_rand_range(k, sm2_z256_order());
+		sm2_z256_point_mul_generator(&P, k);
+		sm2_z256_point_mul(&Q, k, &G);
+		if (sm2_z256_point_equ(&P, &Q) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	gmssl_numa_set_thread_node(-1);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_numa_topology() != 1) goto err;
+	if (test_numa_replica() != 1) goto err;
+	if (test_numa_generator_table() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -235,11 +235,67 @@ static int test_pem_windows_style_without_last_newline(void)
 	return 1;
 }
 
+static int test_pem_decode(void)
+{
+	const char *texts[] = { pem_unix_style, pem_windows_style, };
+	char text[4096];
+	const uint8_t *p;
+	size_t len;
+	uint8_t bin[1024];
+	size_t binlen;
+	uint8_t buf[1024];
+	size_t buflen;
+	size_t i;
+
+	hex_to_bytes(pem_bin_hex, strlen(pem_bin_hex), bin, &binlen);
+
+	for (i = 0; i < sizeof(texts)/sizeof(texts[0]); i++) {
+		// leading text, two blocks and one without the last newline
+		snprintf(text, sizeof(text), "subject=/C=CN/O=NRCAC\n%s%s", texts[i], texts[i]);
+		p = (const uint8_t *)text;
+		len = strlen(text) - 1;
+
+		if (pem_decode("CERTIFICATE", &p, &len, buf, &buflen, sizeof(buf)) != 1
+			|| buflen != binlen || memcmp(buf, bin, binlen) != 0) {
+			error_print();
+			return -1;
+		}
+		if (pem_decode("CERTIFICATE", &p, &len, buf, &buflen, sizeof(buf)) != 1
+			|| buflen != binlen || memcmp(buf, bin, binlen) != 0) {
+			error_print();
+			return -1;
+		}
+		if (pem_decode("CERTIFICATE", &p, &len, buf, &buflen, sizeof(buf)) != 0 || len) {
+			error_print();
+			return -1;
+		}
+		// output buffer too small
+		p = (const uint8_t *)text;
+		len = strlen(text);
+		if (pem_decode("CERTIFICATE", &p, &len, buf, &buflen, binlen - 1) != -1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// other block names are skipped
+	p = (const uint8_t *)pem_unix_style;
+	len = strlen(pem_unix_style);
+	if (pem_decode("X509 CRL", &p, &len, buf, &buflen, sizeof(buf)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_pem_unix_style() != 1) { error_print(); return 1; }
 	if (test_pem_unix_style_without_last_newline() != 1) { error_print(); return 1; }
 	if (test_pem_windows_style() != 1) { error_print(); return 1; }
 	if (test_pem_windows_style_without_last_newline() != 1) { error_print(); return 1; }
+	if (test_pem_decode() != 1) { error_print(); return 1; }
 	return 0;
 }
@@ -0,0 +1,217 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/job.h>
+#include <gmssl/qat.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+#define JOBS_CNT 100
+
+static int test_qat_jobs(QAT_ENGINE *qat)
+{
+	GMSSL_JOB jobs[JOBS_CNT];
+	GMSSL_JOB cpu_jobs[JOBS_CNT];
+	GMSSL_JOB *job;
+	SM2_KEY key;
+	uint8_t raw_key[16];
+	uint8_t iv[16];
+	uint8_t dgst[32];
+	uint8_t data[4096];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t ciphertext[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t ciphertext_len;
+	uint8_t peer_public[65];
+	static uint8_t outs[JOBS_CNT][4096];
+	static uint8_t cpu_outs[JOBS_CNT][4096];
+	size_t i, n = 0;
+
+	rand_bytes(raw_key, sizeof(raw_key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(dgst, sizeof(dgst));
+	rand_bytes(data, sizeof(data));
+	if (sm2_key_generate(&key) != 1
+		|| sm2_sign(&key, dgst, sig, &siglen) != 1
+		|| sm2_encrypt(&key, data, 48, ciphertext, &ciphertext_len) != 1) {
+		error_print();
+		return -1;
+	}
+	peer_public[0] = 0x04;
+	sm2_z256_point_to_bytes(&key.public_key, peer_public + 1);
+
+	memset(jobs, 0, sizeof(jobs));
+	for (i = 0; i < JOBS_CNT; i++) {
+		GMSSL_JOB *j = &jobs[i];
+
+		switch (i % 8) {
+		case 0:
+			j->op = GMSSL_JOB_sm3_digest;
+			j->in = data;
+			j->inlen = 40 * i;
+			break;
+		case 1:
+			j->op = GMSSL_JOB_sm2_sign;
+			j->key = &key;
+			j->dgst = dgst;
+			break;
+		case 2:
+			j->op = GMSSL_JOB_sm2_verify;
+			j->key = &key;
+			j->dgst = dgst;
+			j->in = sig;
+			j->inlen = siglen;
+			break;
+		case 3:
+			j->op = GMSSL_JOB_sm2_decrypt;
+			j->key = &key;
+			j->in = ciphertext;
+			j->inlen = ciphertext_len;
+			break;
+		case 4:
+			j->op = GMSSL_JOB_sm2_ecdh;
+			j->key = &key;
+			j->in = peer_public;
+			j->inlen = sizeof(peer_public);
+			break;
+		default:
+			j->op = i % 8 == 5 ? GMSSL_JOB_sm4_cbc_encrypt
+				: (i % 8 == 6 ? GMSSL_JOB_sm4_cbc_decrypt : GMSSL_JOB_sm4_ctr_encrypt);
+			j->key = raw_key;
+			j->iv = iv;
+			j->in = data;
+			j->inlen = j->op == GMSSL_JOB_sm4_ctr_encrypt ? sizeof(data) - i : sizeof(data);
+		}
+		j->out = outs[i];
+		cpu_jobs[i] = *j;
+		cpu_jobs[i].out = cpu_outs[i];
+		if (qat_job_submit(qat, j) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	while (qat_job_wait(qat, &job) == 1) {
+		i = job - jobs;
+		if (job->ret != 1 || gmssl_job_run(&cpu_jobs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+		// the signatures are randomized, they are verified instead
+		if (job->op == GMSSL_JOB_sm2_sign) {
+			if (sm2_verify(&key, dgst, job->out, job->outlen) != 1) {
+				error_print();
+				return -1;
+			}
+		} else if (job->op == GMSSL_JOB_sm3_digest) {
+			if (memcmp(job->out, cpu_jobs[i].out, 32) != 0) {
+				error_print();
+				return -1;
+			}
+		} else if (job->op != GMSSL_JOB_sm2_verify) {
+			if (job->outlen != cpu_jobs[i].outlen
+				|| memcmp(job->out, cpu_jobs[i].out, job->outlen) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+		n++;
+	}
+	if (n != JOBS_CNT) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_qat_key_method(QAT_ENGINE *qat)
+{
+	TLS_PRIVATE_KEY_METHOD method;
+	SM2_KEY key;
+	uint8_t dgst[32];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t msg[48];
+	uint8_t ciphertext[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t ciphertext_len;
+	uint8_t plain[SM2_MAX_PLAINTEXT_SIZE];
+	size_t plainlen;
+	void *job;
+	int ret;
+
+	rand_bytes(dgst, sizeof(dgst));
+	rand_bytes(msg, sizeof(msg));
+	if (sm2_key_generate(&key) != 1
+		|| sm2_encrypt(&key, msg, sizeof(msg), ciphertext, &ciphertext_len) != 1) {
+		error_print();
+		return -1;
+	}
+	qat_key_method(qat, &method);
+
+	if (method.sign(method.arg, &key, dgst, sig, &siglen, &job) != TLS_ERROR_WANT_ASYNC) {
+		error_print();
+		return -1;
+	}
+	while ((ret = method.complete(method.arg, job, sig, &siglen)) == TLS_ERROR_WANT_ASYNC) {
+	}
+	if (ret != 1 || sm2_verify(&key, dgst, sig, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (method.decrypt(method.arg, &key, ciphertext, ciphertext_len, plain, &plainlen, &job) != TLS_ERROR_WANT_ASYNC) {
+		error_print();
+		return -1;
+	}
+	while ((ret = method.complete(method.arg, job, plain, &plainlen)) == TLS_ERROR_WANT_ASYNC) {
+	}
+	if (ret != 1 || plainlen != sizeof(msg) || memcmp(plain, msg, sizeof(msg)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// a cancelled job is freed by the engine
+	if (method.sign(method.arg, &key, dgst, sig, &siglen, &job) != TLS_ERROR_WANT_ASYNC) {
+		error_print();
+		return -1;
+	}
+	method.cancel(method.arg, job);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	QAT_ENGINE *qat;
+
+	if (!(qat = qat_engine_new(NULL, 0))) {
+		printf("%s no QAT crypto instance, skipped\n", __FILE__);
+		return 0;
+	}
+	printf("%zu QAT crypto instances\n", qat_engine_instances(qat));
+	if (test_qat_jobs(qat) != 1) goto err;
+	if (test_qat_key_method(qat) != 1) goto err;
+	qat_engine_free(qat);
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	qat_engine_free(qat);
+	return 1;
+}
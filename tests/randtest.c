@@ -0,0 +1,278 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#ifndef _WIN32
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/wait.h>
+#endif
+
+
+static int test_rand_get_entropy(void)
+{
+	uint8_t buf[RAND_BYTES_MAX_SIZE];
+	uint8_t zeros[RAND_BYTES_MAX_SIZE] = {0};
+
+	if (rand_get_entropy(buf, sizeof(buf)) != 1) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(buf, zeros, sizeof(buf)) == 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_rand_bytes(void)
+{
+	size_t lens[] = { 1, 7, 32, 255, 256, 257, 1000, 4096, 10000, 100000 };
+	uint8_t *a = NULL;
+	uint8_t *b = NULL;
+	size_t i, j, n;
+	int ret = -1;
+
+	if (!(a = (uint8_t *)malloc(100000)) || !(b = (uint8_t *)malloc(100000))) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		memset(a, 0, lens[i]);
+		memset(b, 0, lens[i]);
+		if (rand_bytes(a, lens[i]) != 1
+			|| rand_bytes(b, lens[i]) != 1) {
+			error_print();
+			goto end;
+		}
+		// a run of 16 zero bytes would be a buffer not filled
+		for (j = 0, n = 0; j < lens[i] && n < 16; j++) {
+			n = a[j] ? 0 : n + 1;
+		}
+		if (n >= 16 || (lens[i] >= 16 && memcmp(a, b, lens[i]) == 0)) {
+			error_print();
+			goto end;
+		}
+	}
+	if (rand_bytes(a, 0) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(a);
+	free(b);
+	return ret;
+}
+
+#ifndef _WIN32
+// the child of fork() must not repeat the output of the parent
+static int test_rand_bytes_fork(void)
+{
+	uint8_t buf[32];
+	uint8_t parent[32];
+	uint8_t child[32];
+	int fds[2];
+	pid_t pid;
+	int status;
+
+	// leave bytes in the buffer of this thread
+	if (rand_bytes(buf, sizeof(buf)) != 1) {
+		error_print();
+		return -1;
+	}
+	if (pipe(fds) != 0) {
+		error_print();
+		return -1;
+	}
+	if ((pid = fork()) < 0) {
+		error_print();
+		return -1;
+	}
+	if (pid == 0) {
+		close(fds[0]);
+		if (rand_bytes(child, sizeof(child)) != 1
+			|| write(fds[1], child, sizeof(child)) != sizeof(child)) {
+			_exit(1);
+		}
+		_exit(0);
+	}
+	close(fds[1]);
+	if (rand_bytes(parent, sizeof(parent)) != 1
+		|| read(fds[0], child, sizeof(child)) != sizeof(child)) {
+		close(fds[0]);
+		error_print();
+		return -1;
+	}
+	close(fds[0]);
+	if (waitpid(pid, &status, 0) != pid || !WIFEXITED(status) || WEXITSTATUS(status) != 0) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(parent, child, sizeof(child)) == 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+#ifndef _WIN32
+// every 32-bit word of the fake device is (call << 12) | index, so no word is served twice
+static uint32_t pool_fill_calls = 0;
+
+static int pool_fill(void *fill_arg, uint8_t *buf, size_t len)
+{
+	uint32_t call = __atomic_fetch_add(&pool_fill_calls, 1, __ATOMIC_RELAXED);
+	size_t i;
+
+	for (i = 0; i < len / 4; i++) {
+		uint32_t w = (call << 12) | (uint32_t)i;
+		memcpy(buf + i * 4, &w, 4);
+	}
+	return 1;
+}
+
+static int pool_fill_fail(void *fill_arg, uint8_t *buf, size_t len)
+{
+	return -1;
+}
+
+#define POOL_TEST_THREADS	4
+#define POOL_TEST_WORDS		(RAND_POOL_SLOT_SIZE * RAND_POOL_SLOTS / 4 * 3)
+
+typedef struct {
+	RAND_POOL *pool;
+	uint32_t *words;
+	int ret;
+} POOL_TEST_JOB;
+
+static void *pool_test_thread(void *arg)
+{
+	POOL_TEST_JOB *job = (POOL_TEST_JOB *)arg;
+	size_t i, n;
+
+	job->ret = 1;
+	for (i = 0; i < POOL_TEST_WORDS; i += n) {
+		n = (i % 61) + 1;
+		if (n > POOL_TEST_WORDS - i) {
+			n = POOL_TEST_WORDS - i;
+		}
+		if (rand_pool_get(job->pool, (uint8_t *)(job->words + i), n * 4) != 1) {
+			job->ret = -1;
+			break;
+		}
+	}
+	return NULL;
+}
+
+static int cmp_words(const void *a, const void *b)
+{
+	uint32_t x = *(const uint32_t *)a;
+	uint32_t y = *(const uint32_t *)b;
+	return x < y ? -1 : x > y;
+}
+
+static int test_rand_pool(void)
+{
+	RAND_POOL *pool = NULL;
+	RAND_POOL *fail_pool = NULL;
+	POOL_TEST_JOB jobs[POOL_TEST_THREADS];
+	pthread_t tids[POOL_TEST_THREADS];
+	uint32_t *words = NULL;
+	uint8_t buf[5000];
+	size_t i;
+	int ret = -1;
+
+	if (!(words = (uint32_t *)malloc(sizeof(uint32_t) * POOL_TEST_WORDS * POOL_TEST_THREADS))
+		|| !(pool = rand_pool_new(pool_fill, NULL))) {
+		error_print();
+		goto end;
+	}
+
+	// concurrent readers get disjoint bytes
+	for (i = 0; i < POOL_TEST_THREADS; i++) {
+		jobs[i].pool = pool;
+		jobs[i].words = words + POOL_TEST_WORDS * i;
+		jobs[i].ret = -1;
+		if (pthread_create(&tids[i], NULL, pool_test_thread, &jobs[i]) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	for (i = 0; i < POOL_TEST_THREADS; i++) {
+		pthread_join(tids[i], NULL);
+		if (jobs[i].ret != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	qsort(words, POOL_TEST_WORDS * POOL_TEST_THREADS, sizeof(uint32_t), cmp_words);
+	for (i = 1; i < POOL_TEST_WORDS * POOL_TEST_THREADS; i++) {
+		if (words[i] == words[i - 1]) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// rand_bytes() mixes the pool in, and fails with the device
+	if (rand_set_pool(pool) != 1
+		|| rand_bytes(buf, sizeof(buf)) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(fail_pool = rand_pool_new(pool_fill_fail, NULL))
+		|| rand_set_pool(fail_pool) != 1
+		|| rand_bytes(buf, sizeof(buf)) != -1) {
+		error_print();
+		goto end;
+	}
+	if (rand_set_pool(NULL) != 1
+		|| rand_bytes(buf, sizeof(buf)) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	rand_set_pool(NULL);
+	rand_pool_free(pool);
+	rand_pool_free(fail_pool);
+	free(words);
+	return ret;
+}
+#endif
+
+int main(void)
+{
+	if (test_rand_get_entropy() != 1) goto err;
+	if (test_rand_bytes() != 1) goto err;
+#ifndef _WIN32
+	if (test_rand_bytes_fork() != 1) goto err;
+	if (test_rand_pool() != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
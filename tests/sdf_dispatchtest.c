@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sdf.h>
+#include <gmssl/error.h>
+
+
+static int test_sdf_dispatch_policy(void)
+{
+	SDF_DISPATCH_POLICY policy;
+	size_t cpu, device;
+
+	sdf_dispatch_get_policy(&policy);
+	if (policy.sm3_device_min_size != SDF_DISPATCH_DEFAULT_SM3_MIN_SIZE
+		|| policy.sm4_device_min_size != SDF_DISPATCH_DEFAULT_SM4_MIN_SIZE
+		|| policy.sm2_public_on_device != 0
+		|| policy.device_max_inflight != SDF_DISPATCH_DEFAULT_MAX_INFLIGHT) {
+		error_print();
+		return -1;
+	}
+
+	sdf_dispatch_reset_stats();
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm3, 32) != 0
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm3, SDF_DISPATCH_DEFAULT_SM3_MIN_SIZE) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm4_cbc, 16) != 0
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm4_cbc, 1024 * 1024) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_verify, 0) != 0
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_encrypt, 32) != 0
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_sign, 0) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_decrypt, 32) != 1
+		|| sdf_dispatch_begin(0, 0) != -1) {
+		error_print();
+		return -1;
+	}
+	sdf_dispatch_end();
+	sdf_dispatch_end();
+	sdf_dispatch_end();
+	sdf_dispatch_end();
+	sdf_dispatch_get_stats(&cpu, &device, NULL);
+	if (cpu != 4 || device != 4) {
+		error_print();
+		return -1;
+	}
+
+	policy.sm2_public_on_device = 1;
+	if (sdf_dispatch_set_policy(&policy) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_verify, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	sdf_dispatch_end();
+
+	policy.sm2_public_on_device = 0;
+	sdf_dispatch_set_policy(&policy);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the device operations beyond the limit spill to the CPU, except the ones of a device key
+static int test_sdf_dispatch_spill(void)
+{
+	SDF_DISPATCH_POLICY policy;
+	SDF_DISPATCH_POLICY saved;
+	size_t cpu, device, spilled;
+
+	sdf_dispatch_get_policy(&saved);
+	policy = saved;
+	policy.device_max_inflight = 2;
+	if (sdf_dispatch_set_policy(&policy) != 1) {
+		error_print();
+		return -1;
+	}
+
+	sdf_dispatch_reset_stats();
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm4_cbc, 1024 * 1024) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm3, 1024 * 1024) != 1
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm4_cbc, 1024 * 1024) != 0
+		|| sdf_dispatch_begin(SDF_DISPATCH_sm2_sign, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	sdf_dispatch_get_stats(&cpu, &device, &spilled);
+	if (cpu != 1 || device != 3 || spilled != 1) {
+		error_print();
+		return -1;
+	}
+
+	// a finished operation makes room for the next one
+	sdf_dispatch_end();
+	sdf_dispatch_end();
+	if (sdf_dispatch_begin(SDF_DISPATCH_sm3, 1024 * 1024) != 1) {
+		error_print();
+		return -1;
+	}
+	sdf_dispatch_end();
+	sdf_dispatch_end();
+
+	sdf_dispatch_set_policy(&saved);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sdf_dispatch_policy() != 1) goto err;
+	if (test_sdf_dispatch_spill() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
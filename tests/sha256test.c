@@ -15,6 +15,8 @@
 #include <stdint.h>
 #include <gmssl/hex.h>
 #include <gmssl/sha2.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
 
 
 #define TEST1	"abc"
@@ -58,6 +60,41 @@ struct {
 	{TEST7, sizeof(TEST7) - 1, 1,       DGST7},
 };
 
+#if defined(ENABLE_SHA2_SHANI) || defined(ENABLE_SHA2_CE)
+// TEST4 * 10 is a whole number of blocks, the kernel gets the padding block as the last one
+static int test_sha256_compress_blocks(const char *name,
+	void (*compress_blocks)(uint32_t state[8], const uint8_t *data, size_t blocks))
+{
+	SHA256_CTX ctx;
+	uint8_t data[10 * 64 + SHA256_BLOCK_SIZE] = {0};
+	uint8_t dgst[SHA256_DIGEST_SIZE];
+	uint8_t dgstbuf[SHA256_DIGEST_SIZE];
+	size_t dgstlen;
+	size_t i;
+
+	for (i = 0; i < 10; i++) {
+		memcpy(data + 64 * i, TEST4, 64);
+	}
+	data[640] = 0x80;
+	data[sizeof(data) - 2] = (640 * 8) >> 8;
+	data[sizeof(data) - 1] = (640 * 8) & 0xff;
+
+	sha256_init(&ctx);
+	compress_blocks(ctx.state, data, sizeof(data)/SHA256_BLOCK_SIZE);
+	for (i = 0; i < 8; i++) {
+		PUTU32(dgst + 4 * i, ctx.state[i]);
+	}
+
+	hex_to_bytes(DGST4, strlen(DGST4), dgstbuf, &dgstlen);
+	if (memcmp(dgst, dgstbuf, sizeof(dgst)) != 0) {
+		printf("%s failed\n", name);
+		return 1;
+	}
+	printf("%s ok\n", name);
+	return 0;
+}
+#endif
+
 int main(int argc, char **argv)
 {
 	int err = 0;
@@ -89,5 +126,16 @@ int main(int argc, char **argv)
 		}
 	}
 
+#ifdef ENABLE_SHA2_SHANI
+	if (gmssl_cpu_features() & GMSSL_CPU_SHA) {
+		err += test_sha256_compress_blocks("sha256_shani_compress_blocks", sha256_shani_compress_blocks);
+	}
+#endif
+#ifdef ENABLE_SHA2_CE
+	if (gmssl_cpu_features() & GMSSL_CPU_ARM_SHA2) {
+		err += test_sha256_compress_blocks("sha256_ce_compress_blocks", sha256_ce_compress_blocks);
+	}
+#endif
+
 	return err;
 }
@@ -15,6 +15,8 @@
 #include <stdint.h>
 #include <gmssl/hex.h>
 #include <gmssl/sha2.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
 
 
 #define TEST1	"abc"
@@ -65,6 +67,41 @@ struct {
 	{TEST7, sizeof(TEST7) - 1, 1,       DGST7},
 };
 
+#ifdef ENABLE_SHA2_CE
+// TEST4 * 10 is a whole number of blocks, the kernel gets the padding block as the last one
+static int test_sha512_compress_blocks(const char *name,
+	void (*compress_blocks)(uint64_t state[8], const uint8_t *data, size_t blocks))
+{
+	SHA512_CTX ctx;
+	uint8_t data[10 * 64 + SHA512_BLOCK_SIZE] = {0};
+	uint8_t dgst[SHA512_DIGEST_SIZE];
+	uint8_t dgstbuf[SHA512_DIGEST_SIZE];
+	size_t dgstlen;
+	size_t i;
+
+	for (i = 0; i < 10; i++) {
+		memcpy(data + 64 * i, TEST4, 64);
+	}
+	data[640] = 0x80;
+	data[sizeof(data) - 2] = (640 * 8) >> 8;
+	data[sizeof(data) - 1] = (640 * 8) & 0xff;
+
+	sha512_init(&ctx);
+	compress_blocks(ctx.state, data, sizeof(data)/SHA512_BLOCK_SIZE);
+	for (i = 0; i < 8; i++) {
+		PUTU64(dgst + 8 * i, ctx.state[i]);
+	}
+
+	hex_to_bytes(DGST4, strlen(DGST4), dgstbuf, &dgstlen);
+	if (memcmp(dgst, dgstbuf, sizeof(dgst)) != 0) {
+		printf("%s failed\n", name);
+		return 1;
+	}
+	printf("%s ok\n", name);
+	return 0;
+}
+#endif
+
 int main(void)
 {
 	int err = 0;
@@ -96,5 +133,11 @@ int main(void)
 		}
 	}
 
+#ifdef ENABLE_SHA2_CE
+	if (gmssl_cpu_features() & GMSSL_CPU_ARM_SHA512) {
+		err += test_sha512_compress_blocks("sha512_ce_compress_blocks", sha512_ce_compress_blocks);
+	}
+#endif
+
 	return err;
 }
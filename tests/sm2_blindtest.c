@@ -12,7 +12,9 @@
 #include <stdlib.h>
 #include <assert.h>
 #include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
 #include <gmssl/sm2_blind.h>
+#include <gmssl/rand.h>
 #include <gmssl/error.h>
 
 
@@ -22,7 +24,7 @@ static int test_sm2_blind_sign(void)
 
 	// signer
 	SM2_KEY key;
-	SM2_Fn k;
+	sm2_z256_t k;
 	uint8_t commit[65];
 	size_t commitlen;
 
@@ -36,7 +38,7 @@ static int test_sm2_blind_sign(void)
 	size_t siglen;
 
 	// verifier
-	SM2_SIGN_CTX verify_ctx;
+	SM2_VERIFY_CTX verify_ctx;
 
 
 	// signer
@@ -93,8 +95,114 @@ end:
 	return r;
 }
 
+static int test_sm2_blind_sign_batch(void)
+{
+	SM2_KEY key;
+	SM2_KEY public_key;
+	size_t count = SM2_BLIND_SIGN_BATCH_SIZE * 2 + 3;
+	sm2_z256_t *k = NULL;
+	uint8_t (*commits)[33] = NULL;
+	uint8_t (*blinded_r)[32] = NULL;
+	uint8_t (*blinded_s)[32] = NULL;
+	SM2_BLIND_SIGN_CTX sign_ctx;
+	SM2_VERIFY_CTX verify_ctx;
+	SM2_Z256_POINT K;
+	uint8_t commit[33];
+	uint8_t blinded_sig_s[32];
+	uint8_t msg[32] = {0};
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	size_t i;
+	int threads;
+	int ret = -1;
+
+	if (!(k = malloc(sizeof(*k) * count))
+		|| !(commits = malloc(sizeof(*commits) * count))
+		|| !(blinded_r = malloc(sizeof(*blinded_r) * count))
+		|| !(blinded_s = malloc(sizeof(*blinded_s) * count))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_key_generate(&key) != 1
+		|| sm2_key_set_public_key(&public_key, &key.public_key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	for (threads = 1; threads <= 2; threads++) {
+		if (sm2_blind_sign_commit_batch(k, commits, count, threads) != 1) {
+			error_print();
+			goto end;
+		}
+		// commits[i] = k[i] * G
+		for (i = 0; i < count; i++) {
+			sm2_z256_point_mul_generator(&K, k[i]);
+			if (sm2_z256_point_to_compressed_octets(&K, commit) != 1
+				|| memcmp(commit, commits[i], sizeof(commit)) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+
+		if (rand_bytes((uint8_t *)blinded_r, sizeof(*blinded_r) * count) != 1
+			|| sm2_blind_sign_batch(&key, (const sm2_z256_t *)k,
+				(const uint8_t (*)[32])blinded_r, blinded_s, count, threads) != 1) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < count; i++) {
+			if (sm2_blind_sign(&key, k[i], blinded_r[i], blinded_sig_s) != 1
+				|| memcmp(blinded_sig_s, blinded_s[i], 32) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+
+	// complete issuance of a few of the batch
+	for (i = 0; i < count; i += SM2_BLIND_SIGN_BATCH_SIZE) {
+		msg[0] = (uint8_t)i;
+		if (sm2_blind_sign_init(&sign_ctx, &public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_blind_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+			|| sm2_blind_sign_finish(&sign_ctx, commits[i], 33, blinded_r[i]) != 1) {
+			error_print();
+			goto end;
+		}
+		if (sm2_blind_sign_batch(&key, (const sm2_z256_t *)&k[i],
+				(const uint8_t (*)[32])&blinded_r[i], &blinded_s[i], 1, 1) != 1
+			|| sm2_blind_sign_unblind(&sign_ctx, blinded_s[i], sig, &siglen) != 1) {
+			error_print();
+			goto end;
+		}
+		if (sm2_verify_init(&verify_ctx, &public_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, sig, siglen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	if (sm2_blind_sign_commit_batch(k, commits, 0, 1) != 1
+		|| sm2_blind_sign_commit_batch(NULL, commits, count, 1) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (k) gmssl_secure_clear(k, sizeof(*k) * count);
+	gmssl_secure_clear(&key, sizeof(key));
+	free(k);
+	free(commits);
+	free(blinded_r);
+	free(blinded_s);
+	return ret;
+}
+
 int main(void)
 {
 	if (test_sm2_blind_sign() != 1) { error_print(); return -1; }
+	if (test_sm2_blind_sign_batch() != 1) { error_print(); return -1; }
 	return 0;
 }
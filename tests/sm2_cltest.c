@@ -0,0 +1,103 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm2_cl.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+// valid and tampered signatures of a few keys, not a multiple of the work group size
+static int test_sm2_cl_verify_batch(void)
+{
+	SM2_CL_CTX ctx;
+	SM2_KEY keys[4];
+	const SM2_KEY *key_ptrs[77];
+	uint8_t dgsts[77][32];
+	SM2_SIGNATURE sigs[77];
+	uint8_t bitmap[(77 + 7)/8];
+	size_t count = 77;
+	size_t i;
+	int expect = 1;
+	int ret = -1;
+
+	for (i = 0; i < sizeof(keys)/sizeof(keys[0]); i++) {
+		if (sm2_key_generate(&keys[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < count; i++) {
+		key_ptrs[i] = &keys[i % 4];
+		rand_bytes(dgsts[i], 32);
+		if (sm2_do_sign(key_ptrs[i], dgsts[i], &sigs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// a digest >= n, a wrong digest, a wrong s, r = 0 and a signature under another key
+	memset(dgsts[5], 0xff, 32);
+	if (sm2_do_sign(key_ptrs[5], dgsts[5], &sigs[5]) != 1) {
+		error_print();
+		return -1;
+	}
+	dgsts[9][0] ^= 1;
+	sigs[40].s[31] ^= 1;
+	memset(sigs[41].r, 0, 32);
+	key_ptrs[76] = &keys[1];
+
+	if (sm2_cl_init(&ctx, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_cl_verify_batch(&ctx, key_ptrs, dgsts, sigs, count, bitmap) != 0) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < count; i++) {
+		int ok = sm2_do_verify(key_ptrs[i], dgsts[i], &sigs[i]) == 1;
+		if (((bitmap[i/8] >> (i % 8)) & 1) != ok) {
+			error_print();
+			goto end;
+		}
+		if (!ok) {
+			expect = 0;
+		}
+	}
+	if (expect) {
+		error_print();
+		goto end;
+	}
+
+	// all valid
+	if (sm2_cl_verify_batch(&ctx, key_ptrs, dgsts, sigs, 5, bitmap) != 1
+		|| bitmap[0] != 0x1f) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm2_cl_cleanup(&ctx);
+	return ret;
+}
+
+int main(void)
+{
+	if (test_sm2_cl_verify_batch() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -34,6 +34,10 @@ static int test_sm2_commit(void)
 
 	ret = sm2_commit_open(x, r, commit, commitlen);
 	printf("open commitment: %s\n", ret == 1 ? "success" : "failure");
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
 
 
 	sm2_commit_vector_generate(&x, 1, r, commit, &commitlen);
@@ -42,18 +46,89 @@ static int test_sm2_commit(void)
 
 	ret = sm2_commit_vector_open(&x, 1, r, commit, commitlen);
 	printf("open commitment: %s\n", ret == 1 ? "success" : "failure");
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
 
 
 	rand_bytes(xvec[0], sizeof(xvec));
 	sm2_commit_vector_generate(xvec, 8, r, commit, &commitlen);
 	ret = sm2_commit_vector_open(xvec, 8, r, commit, commitlen);
 	printf("open commitment: %s\n", ret == 1 ? "success" : "failure");
+	if (ret != 1) {
+		error_print();
+		return -1;
+	}
 
+	// open with another value
+	xvec[3][0] ^= 1;
+	if (sm2_commit_vector_open(xvec, 8, r, commit, commitlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the cached and the chained generators against C = rG + sum x[i]H[i] from the hash chain
+static int test_sm2_commit_vector_generators(void)
+{
+	const char *seed = "GmSSL SM2 Pederson Commitment Generator H";
+	const size_t count = SM2_COMMIT_TABLE_GENERATORS + 2;
+	uint8_t x[SM2_COMMIT_TABLE_GENERATORS + 2][32];
+	uint8_t r[32];
+	uint8_t commit[65];
+	size_t commitlen;
+	uint8_t buf[64];
+	SM2_Z256_POINT H, C, C_, xH;
+	sm2_z256_t k;
+	size_t i;
+
+	rand_bytes(x[0], sizeof(x));
+	memset(x[1], 0, sizeof(x[1]));
+	if (sm2_commit_vector_generate(x, count, r, commit, &commitlen) != 1
+		|| sm2_z256_point_from_octets(&C, commit, commitlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	sm2_z256_from_bytes(k, r);
+	sm2_z256_point_mul_generator(&C_, k);
+	for (i = 0; i < count; i++) {
+		if (i == 0) {
+			sm2_z256_point_from_hash(&H, (uint8_t *)seed, strlen(seed), 0);
+		} else {
+			sm2_z256_point_to_bytes(&H, buf);
+			sm2_z256_point_from_hash(&H, buf, sizeof(buf), 0);
+		}
+		sm2_z256_from_bytes(k, x[i]);
+		sm2_z256_point_mul(&xH, k, &H);
+		sm2_z256_point_add(&C_, &C_, &xH);
+	}
+	if (sm2_z256_point_equ(&C, &C_) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (sm2_commit_vector_open(x, count, r, commit, commitlen) != 1) {
+		error_print();
+		return -1;
+	}
+	x[count - 1][31] ^= 1;
+	if (sm2_commit_vector_open(x, count, r, commit, commitlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
 int main(void)
 {
 	if (test_sm2_commit() != 1) { error_print(); return -1; }
+	if (test_sm2_commit_vector_generators() != 1) { error_print(); return -1; }
 	return 0;
 }
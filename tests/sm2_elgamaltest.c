@@ -13,10 +13,227 @@
 #include <assert.h>
 #include <gmssl/sm2.h>
 #include <gmssl/sm2_elgamal.h>
+#include <gmssl/rand.h>
 #include <gmssl/error.h>
 
 
+static int test_sm2_elgamal_do_encrypt(void)
+{
+	SM2_KEY sm2_key;
+	SM2_ELGAMAL_CIPHERTEXT C;
+	uint32_t plaintexts[] = {
+		0,
+		1,
+		65535,
+		65536,
+		131073,
+		0, // random
+		0xffffffff,
+	};
+	uint32_t m;
+	size_t i;
+
+	if (rand_bytes((uint8_t *)&plaintexts[5], sizeof(uint32_t)) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(plaintexts)/sizeof(plaintexts[0]); i++) {
+		if (sm2_elgamal_do_encrypt(&sm2_key, plaintexts[i], &C) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_elgamal_do_decrypt(&sm2_key, &C, &m) != 1) {
+			error_print();
+			return -1;
+		}
+		if (m != plaintexts[i]) {
+			fprintf(stderr, "%s: %u != %u\n", __FUNCTION__, m, plaintexts[i]);
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_elgamal_encrypt(void)
+{
+	SM2_KEY sm2_key;
+	SM2_ELGAMAL_CIPHERTEXT A, B, R;
+	uint8_t buf[256];
+	size_t len;
+	uint8_t scalar[32] = {0};
+	uint32_t m;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// DER ciphertext
+	if (sm2_elgamal_encrypt(&sm2_key, 100000, buf, &len) != 1
+		|| sm2_elgamal_decrypt(&sm2_key, buf, len, &m) != 1
+		|| m != 100000) {
+		error_print();
+		return -1;
+	}
+
+	// 1000 + 2345
+	if (sm2_elgamal_do_encrypt(&sm2_key, 1000, &A) != 1
+		|| sm2_elgamal_do_encrypt(&sm2_key, 2345, &B) != 1
+		|| sm2_elgamal_ciphertext_add(&R, &A, &B, &sm2_key) != 1
+		|| sm2_elgamal_do_decrypt(&sm2_key, &R, &m) != 1
+		|| m != 3345) {
+		error_print();
+		return -1;
+	}
+
+	// 2345 - 1000
+	if (sm2_elgamal_cipehrtext_sub(&R, &B, &A, &sm2_key) != 1
+		|| sm2_elgamal_do_decrypt(&sm2_key, &R, &m) != 1
+		|| m != 1345) {
+		error_print();
+		return -1;
+	}
+
+	// -(-1000) = 1000
+	if (sm2_elgamal_cipehrtext_neg(&R, &A, &sm2_key) != 1
+		|| sm2_elgamal_cipehrtext_neg(&R, &R, &sm2_key) != 1
+		|| sm2_elgamal_do_decrypt(&sm2_key, &R, &m) != 1
+		|| m != 1000) {
+		error_print();
+		return -1;
+	}
+
+	// 7 * 2345
+	scalar[31] = 7;
+	if (sm2_elgamal_ciphertext_scalar_mul(&R, scalar, &B, &sm2_key) != 1
+		|| sm2_elgamal_do_decrypt(&sm2_key, &R, &m) != 1
+		|| m != 7 * 2345) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_elgamal_ciphertext_sum(void)
+{
+	SM2_KEY sm2_key;
+	SM2_ELGAMAL_CIPHERTEXT *C = NULL;
+	SM2_ELGAMAL_CIPHERTEXT R;
+	size_t nums[] = { 0, 1, 2, 3000 };
+	int threads[] = { 1, 0, 3, 4 };
+	uint32_t sum = 0;
+	uint32_t m;
+	size_t i, j;
+	int ret = -1;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(C = (SM2_ELGAMAL_CIPHERTEXT *)malloc(sizeof(SM2_ELGAMAL_CIPHERTEXT) * 3000))) {
+		error_print();
+		return -1;
+	}
+	// the same ciphertext twice in the sum for the doubling case
+	if (sm2_elgamal_do_encrypt(&sm2_key, 7, &C[0]) != 1) {
+		error_print();
+		goto end;
+	}
+	C[1] = C[0];
+	for (i = 2; i < 3000; i++) {
+		if (sm2_elgamal_do_encrypt(&sm2_key, (uint32_t)i, &C[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	for (i = 0; i < sizeof(nums)/sizeof(nums[0]); i++) {
+		for (sum = 0, j = 0; j < nums[i]; j++) {
+			sum += j < 2 ? 7 : (uint32_t)j;
+		}
+		if (sm2_elgamal_ciphertext_sum(&R, C, nums[i], &sm2_key, threads[i]) != 1
+			|| sm2_elgamal_do_decrypt(&sm2_key, &R, &m) != 1
+			|| m != sum) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(C);
+	return ret;
+}
+
+static int test_sm2_elgamal_table(void)
+{
+	SM2_ELGAMAL_TABLE *table = NULL;
+	SM2_ELGAMAL_TABLE *tmp = NULL;
+	FILE *fp = NULL;
+	int ret = -1;
+
+	if (!(table = (SM2_ELGAMAL_TABLE *)malloc(sizeof(SM2_ELGAMAL_TABLE)))
+		|| !(tmp = (SM2_ELGAMAL_TABLE *)malloc(sizeof(SM2_ELGAMAL_TABLE)))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_elgamal_table_generate(table) != 1
+		|| sm2_elgamal_table_check(table) != 1) {
+		error_print();
+		goto end;
+	}
+	if (!(fp = tmpfile())) {
+		error_print();
+		goto end;
+	}
+	if (sm2_elgamal_table_to_file(table, fp) != 1) {
+		error_print();
+		goto end;
+	}
+	rewind(fp);
+	if (sm2_elgamal_table_from_file(tmp, fp) != 1) {
+		error_print();
+		goto end;
+	}
+	if (memcmp(tmp, table, sizeof(SM2_ELGAMAL_TABLE)) != 0) {
+		error_print();
+		goto end;
+	}
+
+	tmp->byte_order = 0x0807060504030201ULL;
+	if (sm2_elgamal_table_check(tmp) == 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (fp) fclose(fp);
+	if (table) free(table);
+	if (tmp) free(tmp);
+	return ret;
+}
+
 int main(void)
 {
+	if (test_sm2_elgamal_do_encrypt() != 1) goto err;
+	if (test_sm2_elgamal_encrypt() != 1) goto err;
+	if (test_sm2_elgamal_ciphertext_sum() != 1) goto err;
+	if (test_sm2_elgamal_table() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
 	return 0;
+err:
+	error_print();
+	return 1;
 }
@@ -282,6 +282,129 @@ static int test_sm2_encrypt(void)
 	return 1;
 }
 
+// more entries than one chunk, one of them tampered with
+static int test_sm2_decrypt_batch(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t msg[SM2_MAX_PLAINTEXT_SIZE];
+	static uint8_t cbufs[20][SM2_MAX_CIPHERTEXT_SIZE];
+	static uint8_t mbufs[20][SM2_MAX_PLAINTEXT_SIZE];
+	const uint8_t *ins[20];
+	size_t inlens[20];
+	uint8_t *outs[20];
+	size_t outlens[20];
+	size_t lens[20];
+	int results[20];
+	size_t i;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	rand_bytes(msg, sizeof(msg));
+
+	for (i = 0; i < 20; i++) {
+		lens[i] = (i % 4 == 0) ? SM2_MAX_PLAINTEXT_SIZE : 1 + i * 5;
+		if (sm2_encrypt(&sm2_key, msg, lens[i], cbufs[i], &inlens[i]) != 1) {
+			error_print();
+			return -1;
+		}
+		ins[i] = cbufs[i];
+		outs[i] = mbufs[i];
+	}
+	cbufs[7][inlens[7] - 1] ^= 1;
+
+	if (sm2_decrypt_batch(&sm2_key, ins, inlens, 20, outs, outlens, results) != 0) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 20; i++) {
+		if (i == 7) {
+			if (results[i] != -1) {
+				error_print();
+				return -1;
+			}
+			continue;
+		}
+		if (results[i] != 1
+			|| outlens[i] != lens[i]
+			|| memcmp(mbufs[i], msg, lens[i]) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_enc_key(void)
+{
+	SM2_KEY sm2_key;
+	SM2_ENC_KEY ekey;
+	SM2_ENC_PRE_COMP pre_comp[SM2_ENC_PRE_COMP_NUM];
+	SM2_ENC_CTX enc_ctx;
+	SM2_CIPHERTEXT ciphertext;
+	SM2_CIPHERTEXT ciphertext_ex;
+	uint8_t plaintext[] = "Hello World!";
+	uint8_t plainbuf[SM2_MAX_CIPHERTEXT_SIZE];
+	uint8_t cipherbuf[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t plainlen, cipherlen;
+	int i;
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| sm2_enc_key_init(&ekey, &sm2_key) != 1
+		|| sm2_encrypt_pre_compute(pre_comp) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// the comb table gives the same k * P_B as sm2_z256_point_mul
+	memset(&ciphertext, 0, sizeof(ciphertext));
+	memset(&ciphertext_ex, 0, sizeof(ciphertext_ex));
+	for (i = 0; i < SM2_ENC_PRE_COMP_NUM; i++) {
+		if (sm2_do_encrypt_ex(&sm2_key, &pre_comp[i], plaintext, sizeof(plaintext), &ciphertext) != 1
+			|| sm2_enc_key_do_encrypt_ex(&ekey, &pre_comp[i], plaintext, sizeof(plaintext), &ciphertext_ex) != 1
+			|| memcmp(&ciphertext_ex, &ciphertext, sizeof(ciphertext)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	for (i = 0; i < TEST_COUNT; i++) {
+		if (sm2_enc_key_do_encrypt(&ekey, plaintext, sizeof(plaintext), &ciphertext) != 1
+			|| sm2_do_decrypt(&sm2_key, &ciphertext, plainbuf, &plainlen) != 1
+			|| plainlen != sizeof(plaintext)
+			|| memcmp(plainbuf, plaintext, sizeof(plaintext)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (sm2_enc_key_encrypt(&ekey, plaintext, sizeof(plaintext), cipherbuf, &cipherlen) != 1
+		|| sm2_decrypt(&sm2_key, cipherbuf, cipherlen, plainbuf, &plainlen) != 1
+		|| plainlen != sizeof(plaintext)
+		|| memcmp(plainbuf, plaintext, sizeof(plaintext)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	if (sm2_encrypt_init(&enc_ctx) != 1
+		|| sm2_encrypt_update(&enc_ctx, plaintext, sizeof(plaintext)) != 1
+		|| sm2_encrypt_finish_ex(&enc_ctx, &ekey, cipherbuf, &cipherlen) != 1
+		|| sm2_decrypt(&sm2_key, cipherbuf, cipherlen, plainbuf, &plainlen) != 1
+		|| plainlen != sizeof(plaintext)
+		|| memcmp(plainbuf, plaintext, sizeof(plaintext)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	sm2_enc_key_cleanup(&ekey);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm2_encrypt_ctx_speed(void)
 {
 	SM2_KEY sm2_key;
@@ -327,6 +450,8 @@ int main(void)
 	if (test_sm2_do_encrypt_fixlen() != 1) goto err;
 	if (test_sm2_encrypt() != 1) goto err;
 	if (test_sm2_encrypt_fixlen() != 1) goto err;
+	if (test_sm2_decrypt_batch() != 1) goto err;
+	if (test_sm2_enc_key() != 1) goto err;
 	if (test_sm2_encrypt_ctx_speed() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
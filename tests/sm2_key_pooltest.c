@@ -0,0 +1,151 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/error.h>
+#include <gmssl/sm2.h>
+
+
+// the public key must match the private key, and ECDH must agree with a fresh key
+static int check_key(const SM2_KEY *key)
+{
+	SM2_KEY peer;
+	SM2_Z256_POINT P;
+	SM2_Z256_POINT Q;
+
+	sm2_z256_point_mul_generator(&P, key->private_key);
+	if (sm2_z256_point_equ(&P, &key->public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_generate(&peer) != 1
+		|| sm2_do_ecdh(key, &peer.public_key, &P) != 1
+		|| sm2_do_ecdh(&peer, &key->public_key, &Q) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_z256_point_equ(&P, &Q) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int test_sm2_key_pool_refill(void)
+{
+	SM2_KEY_POOL *pool;
+	SM2_KEY keys[3];
+	int i;
+
+	// capacity not a multiple of the batch size
+	if (!(pool = sm2_key_pool_new(100, 0))) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_pool_count(pool) != 0) {
+		error_print();
+		goto err;
+	}
+	if (sm2_key_pool_refill(pool) != 1
+		|| sm2_key_pool_count(pool) != 100) {
+		error_print();
+		goto err;
+	}
+	if (sm2_key_pool_get(pool, &keys[0]) != 1
+		|| sm2_key_pool_get(pool, &keys[1]) != 1
+		|| sm2_key_pool_count(pool) != 98) {
+		error_print();
+		goto err;
+	}
+	// single use
+	if (memcmp(keys[0].private_key, keys[1].private_key, sizeof(sm2_z256_t)) == 0) {
+		error_print();
+		goto err;
+	}
+	if (check_key(&keys[0]) != 1 || check_key(&keys[1]) != 1) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < 98; i++) {
+		if (sm2_key_pool_get(pool, &keys[2]) != 1
+			|| check_key(&keys[2]) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	if (sm2_key_pool_count(pool) != 0) {
+		error_print();
+		goto err;
+	}
+
+	// drained pool generates keys inline
+	if (sm2_key_pool_get(pool, &keys[2]) != 1
+		|| sm2_key_pool_count(pool) != 0
+		|| check_key(&keys[2]) != 1) {
+		error_print();
+		goto err;
+	}
+
+	sm2_key_pool_free(pool);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_key_pool_free(pool);
+	return -1;
+}
+
+static int test_sm2_key_pool_background(void)
+{
+	SM2_KEY_POOL *pool;
+	SM2_KEY key;
+	int i;
+
+	if (!(pool = sm2_key_pool_new(128, 1))) {
+		error_print();
+		return -1;
+	}
+	// consumes faster or slower than the worker, both must give valid keys
+	for (i = 0; i < 200; i++) {
+		if (sm2_key_pool_get(pool, &key) != 1
+			|| check_key(&key) != 1) {
+			error_print();
+			sm2_key_pool_free(pool);
+			return -1;
+		}
+	}
+	if (sm2_key_pool_count(pool) > 128) {
+		error_print();
+		sm2_key_pool_free(pool);
+		return -1;
+	}
+	sm2_key_pool_free(pool);
+
+	// free while the worker is still filling
+	if (!(pool = sm2_key_pool_new(4096, 1))) {
+		error_print();
+		return -1;
+	}
+	sm2_key_pool_free(pool);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sm2_key_pool_refill() != 1) goto err;
+	if (test_sm2_key_pool_background() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return -1;
+}
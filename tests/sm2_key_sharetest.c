@@ -37,7 +37,8 @@ static int test_sm2_key_share_args(size_t k, size_t n)
 		error_print();
 		return -1;
 	}
-	if (memcmp(&key_, &key, sizeof(SM2_KEY)) != 0) {
+	if (sm2_z256_cmp(key_.private_key, key.private_key) != 0
+		|| sm2_z256_point_equ(&key_.public_key, &key.public_key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -48,7 +49,8 @@ static int test_sm2_key_share_args(size_t k, size_t n)
 		error_print();
 		return -1;
 	}
-	if (memcmp(&key_, &key, sizeof(SM2_KEY)) != 0) {
+	if (sm2_z256_cmp(key_.private_key, key.private_key) != 0
+		|| sm2_z256_point_equ(&key_.public_key, &key.public_key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -65,6 +67,8 @@ static int test_sm2_key_share(void)
 	if (test_sm2_key_share_args(5, 5) != 1) { error_print(); return -1; }
 	if (test_sm2_key_share_args(11, 12) != 1) { error_print(); return -1; }
 	if (test_sm2_key_share_args(12, 12) != 1) { error_print(); return -1; }
+	if (test_sm2_key_share_args(13, 20) != 1) { error_print(); return -1; }
+	if (test_sm2_key_share_args(100, SM2_KEY_MAX_SHARES) != 1) { error_print(); return -1; }
 	return 1;
 }
 
@@ -90,7 +94,54 @@ static int test_sm2_key_share_file(void)
 	return 1;
 }
 
+static int test_sm2_key_share_verify(void)
+{
+	SM2_KEY key;
+	SM2_KEY_SHARE shares[7];
+	SM2_Z256_POINT commits[4];
+	size_t i;
+
+	if (sm2_key_generate(&key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_split_ex(&key, 4, 7, shares, commits) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_z256_point_equ(&commits[0], &key.public_key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 7; i++) {
+		if (sm2_key_share_verify(&shares[i], commits, 4) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// a share of another polynomial
+	if (sm2_key_split(&key, 4, 7, shares) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_share_verify(&shares[3], commits, 4) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
+	if (test_sm2_key_share() != 1) goto err;
+	if (test_sm2_key_share_verify() != 1) goto err;
+	if (test_sm2_key_share_file() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
 	return 0;
+err:
+	error_print();
+	return 1;
 }
@@ -170,12 +170,279 @@ static int test_sm2_enced_private_key_info(void)
 	return 1;
 }
 
+static int test_sm2_enced_private_key_info_batch(void)
+{
+	const char *passes[] = { "P@ssw0rd", "Password", "P@ssw0rd", "123456", "Password" };
+	SM2_KEY keys[5];
+	SM2_KEY tmp_keys[5];
+	uint8_t bufs[5][512];
+	const uint8_t *ins[5];
+	size_t inlens[5];
+	uint8_t *p;
+	const uint8_t *cp;
+	const uint8_t *attrs;
+	size_t attrs_len;
+	size_t hits, misses;
+	size_t i;
+
+	for (i = 0; i < 5; i++) {
+		p = bufs[i];
+		inlens[i] = 0;
+		if (sm2_key_generate(&keys[i]) != 1
+			|| sm2_private_key_info_encrypt_to_der(&keys[i], passes[i], &p, &inlens[i]) != 1) {
+			error_print();
+			return -1;
+		}
+		ins[i] = bufs[i];
+	}
+
+	if (sm2_private_key_info_decrypt_from_der_batch(tmp_keys, passes, ins, inlens, 5) != 1
+		|| memcmp(tmp_keys, keys, sizeof(keys)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// the second load is served from the cache
+	pkcs8_key_cache_set_enabled(1);
+	pkcs8_key_cache_clear();
+	if (sm2_private_key_info_decrypt_from_der_batch(tmp_keys, passes, ins, inlens, 5) != 1) {
+		error_print();
+		return -1;
+	}
+	pkcs8_key_cache_get_stats(&hits, &misses);
+	if (hits != 0 || misses != 5) {
+		error_print();
+		return -1;
+	}
+	memset(tmp_keys, 0, sizeof(tmp_keys));
+	if (sm2_private_key_info_decrypt_from_der_batch(tmp_keys, passes, ins, inlens, 5) != 1
+		|| memcmp(tmp_keys, keys, sizeof(keys)) != 0) {
+		error_print();
+		return -1;
+	}
+	pkcs8_key_cache_get_stats(&hits, &misses);
+	if (hits != 5 || misses != 5) {
+		error_print();
+		return -1;
+	}
+
+	// a cached key does not match another password
+	cp = ins[1];
+	if (sm2_private_key_info_decrypt_from_der(&tmp_keys[1], &attrs, &attrs_len, "password", &cp, &inlens[1]) == 1) {
+		error_print();
+		return -1;
+	}
+
+	pkcs8_key_cache_set_enabled(0);
+	pkcs8_key_cache_get_stats(&hits, &misses);
+	if (hits != 5 || misses != 6) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// a partial batch on each of 3 threads
+static int test_sm2_key_generate_batch(void)
+{
+	size_t num = 3 * SM2_KEY_GENERATE_BATCH_SIZE + 5;
+	SM2_KEY *keys;
+	SM2_Z256_POINT P;
+	uint8_t a[64], b[64];
+	size_t i;
+	int ret = -1;
+
+	if (!(keys = (SM2_KEY *)malloc(sizeof(SM2_KEY) * num))) {
+		error_print();
+		return -1;
+	}
+	if (sm2_key_generate_batch(keys, num, 3) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < num; i++) {
+		if (sm2_z256_is_zero(keys[i].private_key)
+			|| sm2_z256_cmp(keys[i].private_key, sm2_z256_order_minus_one()) >= 0) {
+			error_print();
+			goto end;
+		}
+		sm2_z256_point_mul_generator(&P, keys[i].private_key);
+		if (sm2_z256_point_to_bytes(&P, a) != 1
+			|| sm2_z256_point_to_bytes(&keys[i].public_key, b) != 1
+			|| memcmp(a, b, 64) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	if (sm2_z256_cmp(keys[0].private_key, keys[num - 1].private_key) == 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(keys);
+	return ret;
+}
+
+static int check_fast_private(const SM2_KEY *key)
+{
+	sm2_z256_t t;
+
+	sm2_z256_modn_add(t, key->private_key, sm2_z256_one());
+	sm2_z256_modn_mul(t, t, key->fast_private);
+	return sm2_z256_equ(t, sm2_z256_one()) ? 1 : -1;
+}
+
+static int test_sm2_key_fast_private(void)
+{
+	SM2_KEY keys[5];
+	SM2_KEY key;
+	uint8_t buf[512];
+	uint8_t *p = buf;
+	const uint8_t *cp = buf;
+	size_t len = 0;
+	uint8_t dgst[32] = {1, 2, 3};
+	SM2_SIGNATURE sig;
+	size_t i;
+
+	if (sm2_key_generate(&key) != 1
+		|| check_fast_private(&key) != 1
+		|| sm2_key_generate_batch(keys, sizeof(keys)/sizeof(keys[0]), 1) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(keys)/sizeof(keys[0]); i++) {
+		if (check_fast_private(&keys[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the decoders go through sm2_key_set_private_key
+	if (sm2_private_key_to_der(&keys[0], &p, &len) != 1
+		|| sm2_private_key_from_der(&key, &cp, &len) != 1
+		|| check_fast_private(&key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// a stale cache still gives valid signatures
+	sm2_z256_copy(key.private_key, keys[1].private_key);
+	key.public_key = keys[1].public_key;
+	if (check_fast_private(&key) == 1
+		|| sm2_do_sign(&key, dgst, &sig) != 1
+		|| sm2_do_verify(&keys[1], dgst, &sig) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// public keys have no cache
+	if (sm2_key_set_public_key(&key, &keys[2].public_key) != 1
+		|| !sm2_z256_is_zero(key.fast_private)) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_ecdh_batch(void)
+{
+	enum { PEERS = SM2_ECDH_THREAD_MIN_PEERS * 2 + SM2_ECDH_BATCH_SIZE / 2 + 1 };
+	SM2_KEY key;
+	SM2_KEY *peers = NULL;
+	SM2_Z256_POINT *points = NULL;
+	SM2_Z256_POINT *outs = NULL;
+	uint8_t (*octets)[65] = NULL;
+	const uint8_t *octets_ptrs[PEERS];
+	size_t octets_lens[PEERS];
+	uint8_t (*bytes)[64] = NULL;
+	uint8_t expected[64];
+	int results[PEERS];
+	SM2_Z256_POINT P;
+	size_t i;
+	int threads;
+	int ret = -1;
+
+	if (!(peers = (SM2_KEY *)malloc(sizeof(SM2_KEY) * PEERS))
+		|| !(points = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * PEERS))
+		|| !(outs = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * PEERS))
+		|| !(octets = malloc(65 * PEERS))
+		|| !(bytes = malloc(64 * PEERS))) {
+		error_print();
+		goto end;
+	}
+	if (sm2_key_generate(&key) != 1
+		|| sm2_key_generate_batch(peers, PEERS, 1) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < PEERS; i++) {
+		points[i] = peers[i].public_key;
+		if (i % 2) {
+			sm2_z256_point_to_uncompressed_octets(&points[i], octets[i]);
+			octets_lens[i] = 65;
+		} else {
+			sm2_z256_point_to_compressed_octets(&points[i], octets[i]);
+			octets_lens[i] = 33;
+		}
+		octets_ptrs[i] = octets[i];
+	}
+
+	for (threads = 1; threads <= 2; threads++) {
+		if (sm2_do_ecdh_batch(&key, points, PEERS, outs, results, threads) != 1
+			|| sm2_ecdh_batch(&key, octets_ptrs, octets_lens, PEERS, bytes, NULL, threads) != 1) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < PEERS; i++) {
+			if (sm2_do_ecdh(&key, &points[i], &P) != 1
+				|| sm2_z256_point_to_bytes(&P, expected) != 1
+				|| results[i] != 1
+				|| sm2_z256_point_equ(&outs[i], &P) != 1
+				|| memcmp(bytes[i], expected, 64) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+
+	// a point at infinity and a bad encoding do not stop the others
+	memset(&points[3], 0, sizeof(SM2_Z256_POINT));
+	octets_lens[PEERS - 1] = 64;
+	if (sm2_do_ecdh_batch(&key, points, PEERS, outs, results, 2) != 0
+		|| results[3] != -1 || results[2] != 1 || results[PEERS - 1] != 1
+		|| sm2_ecdh_batch(&key, octets_ptrs, octets_lens, PEERS, bytes, results, 2) != 0
+		|| results[PEERS - 1] != -1 || results[3] != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(peers);
+	free(points);
+	free(outs);
+	free(octets);
+	free(bytes);
+	return ret;
+}
 
 int main(void)
 {
 	if (test_sm2_private_key() != 1) goto err;
 	if (test_sm2_private_key_info() != 1) goto err;
 	if (test_sm2_enced_private_key_info() != 1) goto err;
+	if (test_sm2_enced_private_key_info_batch() != 1) goto err;
+	if (test_sm2_key_generate_batch() != 1) goto err;
+	if (test_sm2_key_fast_private() != 1) goto err;
+	if (test_sm2_ecdh_batch() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include <gmssl/sm2.h>
 #include <gmssl/sm2_recover.h>
+#include <gmssl/rand.h>
 #include <gmssl/error.h>
 
 
@@ -21,24 +22,213 @@ static int test_sm2_signature_to_public_key_points(void)
 	SM2_KEY key;
 	uint8_t dgst[32] = {1,2,3,4};
 	SM2_SIGNATURE sig;
-	SM2_POINT points[4];
+	SM2_SIGNATURE conj;
+	SM2_Z256_POINT points[4];
 	size_t points_cnt, i;
+	int found;
+	int j;
 
-	sm2_key_generate(&key);
-	sm2_do_sign(&key, dgst, &sig);
-	sm2_signature_to_public_key_points(&sig, dgst, points, &points_cnt);
+	for (j = 0; j < 8; j++) {
+		dgst[31] = (uint8_t)j;
+		if (sm2_key_generate(&key) != 1
+			|| sm2_do_sign(&key, dgst, &sig) != 1
+			|| sm2_signature_to_public_key_points(&sig, dgst, points, &points_cnt) != 1) {
+			error_print();
+			return -1;
+		}
+		if (points_cnt != 2 && points_cnt != 4) {
+			error_print();
+			return -1;
+		}
 
-	for (i = 0; i < points_cnt; i++) {
-		int vr;
-		sm2_point_print(stderr, 0, 0, "point", &points[i]);
-		vr = sm2_do_verify((SM2_KEY *)&points[1], dgst, &sig);
-		printf("verify = %d\n", vr);
+		// every candidate verifies, one of them is the signer
+		found = 0;
+		for (i = 0; i < points_cnt; i++) {
+			SM2_KEY pub;
+			if (sm2_z256_point_is_at_infinity(&points[i])) {
+				continue;
+			}
+			if (sm2_key_set_public_key(&pub, &points[i]) != 1
+				|| sm2_do_verify(&pub, dgst, &sig) != 1) {
+				error_print();
+				return -1;
+			}
+			if (sm2_z256_point_equ(&points[i], &key.public_key) == 1) {
+				found = 1;
+			}
+		}
+		if (!found) {
+			error_print();
+			return -1;
+		}
 	}
+
+	if (sm2_signature_conjugate(&sig, &conj) != 1
+		|| sm2_signature_conjugate(&conj, &conj) != 1
+		|| memcmp(&conj, &sig, sizeof(sig)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_sign_compact(void)
+{
+	SM2_KEY key;
+	SM2_Z256_POINT P;
+	uint8_t dgst[32];
+	uint8_t sig[SM2_COMPACT_SIGNATURE_SIZE];
+	int i;
+
+	if (sm2_key_generate(&key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 8; i++) {
+		rand_bytes(dgst, sizeof(dgst));
+		if (sm2_sign_compact(&key, dgst, sig) != 1
+			|| sig[64] > 3
+			|| sm2_compact_signature_recover(sig, dgst, &P) != 1
+			|| sm2_z256_point_equ(&P, &key.public_key) != 1) {
+			error_print();
+			return -1;
+		}
+		// r || s is an ordinary signature
+		if (sm2_do_verify(&key, dgst, (SM2_SIGNATURE *)sig) != 1) {
+			error_print();
+			return -1;
+		}
+		// the other y parity gives another key
+		sig[64] ^= 1;
+		if (sm2_compact_signature_recover(sig, dgst, &P) == 1
+			&& sm2_z256_point_equ(&P, &key.public_key) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+	sig[64] = 4;
+	if (sm2_compact_signature_recover(sig, dgst, &P) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
+static int test_sm2_verify_recover(void)
+{
+	enum { KEYS = 20, SIGS = SM2_RECOVER_BATCH_SIZE + 9 };
+	SM2_KEY keys[KEYS];
+	uint8_t fingerprints[KEYS][SM2_KEY_FINGERPRINT_SIZE];
+	SM2_KEY_INDEX index;
+	SM2_KEY stranger;
+	SM2_SIGNATURE sig;
+	uint8_t dgsts[SIGS][32];
+	uint8_t sigs[SIGS][SM2_COMPACT_SIGNATURE_SIZE];
+	size_t key_ids[SIGS];
+	int results[SIGS];
+	size_t key_id;
+	size_t i;
+	int ret = -1;
+
+	if (sm2_key_generate_batch(keys, KEYS, 1) != 1
+		|| sm2_key_generate(&stranger) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < KEYS; i++) {
+		if (sm2_public_key_fingerprint(&keys[i].public_key, fingerprints[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (sm2_key_index_init(&index, (const uint8_t (*)[SM2_KEY_FINGERPRINT_SIZE])fingerprints, KEYS) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < KEYS; i++) {
+		if (sm2_key_index_find(&index, fingerprints[i], &key_id) != 1 || key_id != i) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// DER signatures try all the candidates
+	rand_bytes(dgsts[0], 32);
+	if (sm2_do_sign(&keys[7], dgsts[0], &sig) != 1
+		|| sm2_verify_recover(&index, dgsts[0], &sig, &key_id) != 1
+		|| key_id != 7) {
+		error_print();
+		goto end;
+	}
+	dgsts[0][0] ^= 1;
+	if (sm2_verify_recover(&index, dgsts[0], &sig, &key_id) != 0) {
+		error_print();
+		goto end;
+	}
+
+	for (i = 0; i < SIGS; i++) {
+		rand_bytes(dgsts[i], 32);
+		if (sm2_sign_compact(&keys[i % KEYS], dgsts[i], sigs[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (sm2_verify_compact_batch(&index, (const uint8_t (*)[32])dgsts,
+		(const uint8_t (*)[SM2_COMPACT_SIGNATURE_SIZE])sigs, SIGS, key_ids, results) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < SIGS; i++) {
+		if (results[i] != 1 || key_ids[i] != i % KEYS) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// a stranger, a tampered digest and a bad recovery id in one batch
+	if (sm2_sign_compact(&stranger, dgsts[3], sigs[3]) != 1) {
+		error_print();
+		goto end;
+	}
+	dgsts[SM2_RECOVER_BATCH_SIZE + 1][5] ^= 0x80;
+	sigs[SIGS - 1][64] = 0xff;
+	if (sm2_verify_compact_batch(&index, (const uint8_t (*)[32])dgsts,
+		(const uint8_t (*)[SM2_COMPACT_SIGNATURE_SIZE])sigs, SIGS, key_ids, results) != 0) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < SIGS; i++) {
+		int expected = (i == 3 || i == SM2_RECOVER_BATCH_SIZE + 1 || i == SIGS - 1) ? -1 : 1;
+		if (results[i] != expected) {
+			error_print();
+			goto end;
+		}
+	}
+	if (sm2_verify_compact(&index, dgsts[4], sigs[4], &key_id) != 1 || key_id != 4
+		|| sm2_verify_compact(&index, dgsts[3], sigs[3], &key_id) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm2_key_index_cleanup(&index);
+	return ret;
+}
+
 int main(void)
 {
-	if (test_sm2_signature_to_public_key_points() != 1) { error_print(); return -1; }
+	if (test_sm2_signature_to_public_key_points() != 1) goto err;
+	if (test_sm2_sign_compact() != 1) goto err;
+	if (test_sm2_verify_recover() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
 	return 0;
+err:
+	error_print();
+	return 1;
 }
@@ -19,7 +19,7 @@
 static int test_sm2_ring_do_sign(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_keys[5];
+	SM2_Z256_POINT public_keys[5];
 	size_t public_keys_count = sizeof(public_keys)/sizeof(public_keys[0]);
 	size_t sign_index, i;
 	uint8_t dgst[32];
@@ -31,7 +31,7 @@ static int test_sm2_ring_do_sign(void)
 		for (i = 0; i < public_keys_count; i++) {
 			SM2_KEY key;
 			sm2_key_generate(&key);
-			memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_POINT));
+			memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_Z256_POINT));
 
 			if (i == sign_index) {
 				memcpy(&sign_key, &key, sizeof(SM2_KEY));
@@ -54,7 +54,7 @@ static int test_sm2_ring_do_sign(void)
 static int test_sm2_ring_sign(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_keys[5];
+	SM2_Z256_POINT public_keys[5];
 	size_t public_keys_count = sizeof(public_keys)/sizeof(public_keys[0]);
 	size_t sign_index = 2, i;
 	uint8_t dgst[32];
@@ -64,7 +64,7 @@ static int test_sm2_ring_sign(void)
 	for (i = 0; i < public_keys_count; i++) {
 		SM2_KEY key;
 		sm2_key_generate(&key);
-		memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_POINT));
+		memcpy(&public_keys[i], &(key.public_key), sizeof(SM2_Z256_POINT));
 
 		if (i == sign_index) {
 			memcpy(&sign_key, &key, sizeof(SM2_KEY));
@@ -86,7 +86,7 @@ static int test_sm2_ring_sign(void)
 static int test_sm2_ring_sign_crosscheck(void)
 {
 	SM2_KEY sign_key;
-	SM2_POINT public_key;
+	SM2_Z256_POINT public_key;
 	uint8_t dgst[32];
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen = 0;
@@ -164,11 +164,62 @@ static int test_sm2_ring_sign_update(void)
 	return 1;
 }
 
+static int test_sm2_ring_do_sign_ex(void)
+{
+	SM2_KEY keys[100];
+	SM2_Z256_POINT public_keys[100];
+	size_t public_keys_count = sizeof(public_keys)/sizeof(public_keys[0]);
+	SM2_RING ring;
+	uint8_t dgst[32] = { 1, 2, 3 };
+	uint8_t r[32];
+	sm2_bn_t s[sizeof(public_keys)/sizeof(public_keys[0])];
+	size_t i;
+
+	if (sm2_key_generate_batch(keys, public_keys_count, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < public_keys_count; i++) {
+		public_keys[i] = keys[i].public_key;
+	}
+	if (sm2_ring_init(&ring, public_keys, public_keys_count) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// signatures with and without the tables verify both ways
+	if (sm2_ring_do_sign_ex(&keys[37], &ring, dgst, r, s) != 1
+		|| sm2_ring_do_verify(public_keys, public_keys_count, dgst, r, s) != 1
+		|| sm2_ring_do_verify_ex(&ring, dgst, r, s) != 1) {
+		error_print();
+		goto err;
+	}
+	if (sm2_ring_do_sign(&keys[99], public_keys, public_keys_count, dgst, r, s) != 1
+		|| sm2_ring_do_verify_ex(&ring, dgst, r, s) != 1) {
+		error_print();
+		goto err;
+	}
+
+	dgst[0] ^= 1;
+	if (sm2_ring_do_verify_ex(&ring, dgst, r, s) != 0) {
+		error_print();
+		goto err;
+	}
+
+	sm2_ring_cleanup(&ring);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_ring_cleanup(&ring);
+	return -1;
+}
+
 int main(void)
 {
 	if (test_sm2_ring_do_sign() != 1) { error_print(); return -1; }
 	if (test_sm2_ring_sign() != 1) { error_print(); return -1; }
 	if (test_sm2_ring_sign_crosscheck() != 1) { error_print(); return -1; }
 	if (test_sm2_ring_sign_update() != 1) { error_print(); return -1; }
+	if (test_sm2_ring_do_sign_ex() != 1) { error_print(); return -1; }
 	return 0;
 }
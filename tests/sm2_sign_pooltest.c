@@ -0,0 +1,226 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#include <gmssl/sm2.h>
+
+
+static int sign_and_verify(SM2_SIGN_POOL *pool, const SM2_KEY *sm2_key, int count)
+{
+	SM2_SIGN_CTX sign_ctx;
+	SM2_VERIFY_CTX verify_ctx;
+	uint8_t msg[64];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	int i;
+
+	if (sm2_sign_init_ex(&sign_ctx, sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, pool) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		rand_bytes(msg, sizeof(msg));
+		sm2_sign_reset(&sign_ctx);
+		if (sm2_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+			|| sm2_sign_finish(&sign_ctx, sig, &siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_verify_init(&verify_ctx, sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, sig, siglen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int test_sm2_sign_pool_refill(void)
+{
+	SM2_SIGN_POOL *pool;
+	SM2_KEY sm2_key;
+	SM2_SIGN_PRE_COMP pre_comps[3];
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	// capacity not a multiple of the batch size
+	if (!(pool = sm2_sign_pool_new(40, 0))) {
+		error_print();
+		return -1;
+	}
+	if (sm2_sign_pool_count(pool) != 0) {
+		error_print();
+		goto err;
+	}
+	if (sm2_sign_pool_refill(pool) != 1
+		|| sm2_sign_pool_count(pool) != 40) {
+		error_print();
+		goto err;
+	}
+	if (sm2_sign_pool_get(pool, &pre_comps[0]) != 1
+		|| sm2_sign_pool_get(pool, &pre_comps[1]) != 1
+		|| sm2_sign_pool_count(pool) != 38) {
+		error_print();
+		goto err;
+	}
+	if (memcmp(pre_comps[0].k, pre_comps[1].k, sizeof(sm2_z256_t)) == 0) {
+		error_print();
+		goto err;
+	}
+	if (sign_and_verify(pool, &sm2_key, 38) != 1
+		|| sm2_sign_pool_count(pool) != 0) {
+		error_print();
+		goto err;
+	}
+
+	// drained pool computes pairs inline
+	if (sm2_sign_pool_get(pool, &pre_comps[2]) != 1
+		|| sm2_sign_pool_count(pool) != 0) {
+		error_print();
+		goto err;
+	}
+	if (sign_and_verify(pool, &sm2_key, 3) != 1) {
+		error_print();
+		goto err;
+	}
+
+	sm2_sign_pool_free(pool);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_sign_pool_free(pool);
+	return -1;
+}
+
+static int test_sm2_sign_pool_background(void)
+{
+	SM2_SIGN_POOL *pool;
+	SM2_KEY sm2_key;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(pool = sm2_sign_pool_new(64, 1))) {
+		error_print();
+		return -1;
+	}
+	// consumes faster or slower than the worker, both must give valid signatures
+	if (sign_and_verify(pool, &sm2_key, 100) != 1) {
+		error_print();
+		sm2_sign_pool_free(pool);
+		return -1;
+	}
+	if (sm2_sign_pool_count(pool) > 64) {
+		error_print();
+		sm2_sign_pool_free(pool);
+		return -1;
+	}
+	sm2_sign_pool_free(pool);
+
+	// free while the worker is still filling
+	if (!(pool = sm2_sign_pool_new(1024, 1))) {
+		error_print();
+		return -1;
+	}
+	sm2_sign_pool_free(pool);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_sign_pool_default(void)
+{
+	SM2_SIGN_POOL *pool;
+	SM2_KEY sm2_key;
+	SM2_SIGNATURE sig;
+	SM2_SIGN_CTX sign_ctx;
+	SM2_VERIFY_CTX verify_ctx;
+	uint8_t dgst[32];
+	uint8_t msg[64] = {0};
+	uint8_t der[SM2_MAX_SIGNATURE_SIZE];
+	size_t derlen;
+	int i;
+
+	if (sm2_key_generate(&sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(pool = sm2_sign_pool_new(40, 0))
+		|| sm2_sign_pool_refill(pool) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_sign_pool_set_default(pool);
+	if (sm2_sign_pool_get_default() != pool) {
+		error_print();
+		goto err;
+	}
+
+	// sm2_do_sign and sm2_sign_init without a pool take the pairs of the default one
+	for (i = 0; i < 10; i++) {
+		rand_bytes(dgst, sizeof(dgst));
+		if (sm2_do_sign(&sm2_key, dgst, &sig) != 1
+			|| sm2_do_verify(&sm2_key, dgst, &sig) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	if (sm2_sign_pool_count(pool) != 30) {
+		error_print();
+		goto err;
+	}
+	if (sm2_sign_init(&sign_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		|| sm2_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+		|| sm2_sign_finish(&sign_ctx, der, &derlen) != 1
+		|| sm2_sign_pool_count(pool) != 29) {
+		error_print();
+		goto err;
+	}
+	if (sm2_verify_init(&verify_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+		|| sm2_verify_finish(&verify_ctx, der, derlen) != 1) {
+		error_print();
+		goto err;
+	}
+
+	sm2_sign_pool_set_default(NULL);
+	if (sm2_do_sign(&sm2_key, dgst, &sig) != 1
+		|| sm2_sign_pool_count(pool) != 29) {
+		error_print();
+		goto err;
+	}
+	sm2_sign_pool_free(pool);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_sign_pool_set_default(NULL);
+	sm2_sign_pool_free(pool);
+	return -1;
+}
+
+int main(void)
+{
+	if (test_sm2_sign_pool_refill() != 1) goto err;
+	if (test_sm2_sign_pool_background() != 1) goto err;
+	if (test_sm2_sign_pool_default() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return -1;
+}
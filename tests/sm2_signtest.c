@@ -102,6 +102,55 @@ static int test_sm2_do_sign(void)
 	return 1;
 }
 
+static int test_sm2_do_verify_batch(void)
+{
+	SM2_KEY sm2_keys[3];
+	const SM2_KEY *keys[20];
+	uint8_t dgsts[20][32];
+	SM2_SIGNATURE sigs[20];
+	int results[20];
+	size_t i;
+
+	for (i = 0; i < 3; i++) {
+		if (sm2_key_generate(&sm2_keys[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	for (i = 0; i < 20; i++) {
+		keys[i] = &sm2_keys[i % 3];
+		rand_bytes(dgsts[i], 32);
+		if (sm2_do_sign(keys[i], dgsts[i], &sigs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (sm2_do_verify_batch(keys, dgsts, sigs, 20, results) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// wrong digest, wrong key, s out of range
+	dgsts[3][0] ^= 1;
+	keys[7] = &sm2_keys[0];
+	memset(sigs[11].s, 0xff, 32);
+	if (sm2_do_verify_batch(keys, dgsts, sigs, 20, results) != 0) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 20; i++) {
+		int expect = (i == 3 || i == 7 || i == 11) ? -1 : 1;
+		if (results[i] != expect || sm2_do_verify(keys[i], dgsts[i], &sigs[i]) != expect) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm2_fast_sign(void)
 {
 	SM2_KEY sm2_key;
@@ -109,6 +158,8 @@ static int test_sm2_fast_sign(void)
 	SM2_SIGN_PRE_COMP pre_comp[32];
 	uint8_t dgst[32];
 	SM2_SIGNATURE sig;
+	sm2_z256_t e;
+	sm2_z256_t r;
 	size_t i;
 
 	if (sm2_key_generate(&sm2_key) != 1) {
@@ -138,6 +189,32 @@ static int test_sm2_fast_sign(void)
 		}
 	}
 
+	// e = H(M) mod n, r = e + x1
+	sm2_z256_from_bytes(e, dgst);
+	if (sm2_z256_cmp(e, sm2_z256_order()) >= 0) {
+		sm2_z256_sub(e, e, sm2_z256_order());
+	}
+	sm2_z256_modn_add(r, e, pre_comp[0].x1_modn);
+
+	// r + k == n
+	sm2_z256_modn_neg(pre_comp[0].k, r);
+	if (sm2_fast_sign(fast_private, &pre_comp[0], dgst, &sig) != 0) {
+		error_print();
+		return -1;
+	}
+	// s == (k + r) * d' - r == 0 with k = r * d
+	sm2_z256_modn_mul(pre_comp[0].k, r, sm2_key.private_key);
+	if (sm2_fast_sign(fast_private, &pre_comp[0], dgst, &sig) != 0) {
+		error_print();
+		return -1;
+	}
+	// r == 0
+	sm2_z256_modn_neg(pre_comp[0].x1_modn, e);
+	if (sm2_fast_sign(fast_private, &pre_comp[0], dgst, &sig) != 0) {
+		error_print();
+		return -1;
+	}
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
@@ -172,6 +249,105 @@ static int test_sm2_sign(void)
 	return 1;
 }
 
+static int test_sm2_verify_key(void)
+{
+	SM2_KEY sm2_key;
+	SM2_VERIFY_KEY vkey;
+	SM2_SIGN_CTX sign_ctx;
+	SM2_VERIFY_CTX verify_ctx;
+	uint8_t msg[100];
+	uint8_t dgst[32];
+	SM2_SIGNATURE sig;
+	uint8_t sigbuf[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	int i;
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| sm2_verify_key_init(&vkey, &sm2_key) != 1) {
+		error_print();
+		return -1;
+	}
+	rand_bytes(msg, sizeof(msg));
+
+	if (sm2_sign_init(&sign_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		|| sm2_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+		|| sm2_sign_finish(&sign_ctx, sigbuf, &siglen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// the comb table is built by the first verification and reused
+	if (sm2_verify_init_ex(&verify_ctx, &vkey, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 3; i++) {
+		if (sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, sigbuf, siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_verify_reset(&verify_ctx);
+	}
+	msg[0] ^= 1;
+	if (sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+		|| sm2_verify_finish(&verify_ctx, sigbuf, siglen) == 1) {
+		error_print();
+		return -1;
+	}
+
+	msg[0] ^= 1;
+
+	// a cached ID, an uncached ID and a cached ID used with another signer ID
+	if (sm2_verify_key_add_id(&vkey, "alice@pku.edu.cn", 16) != 1
+		|| sm2_verify_key_add_id(&vkey, "alice@pku.edu.cn", 16) != 1
+		|| vkey.num_ids != 2) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 2; i++) {
+		const char *id = i ? "bob@pku.edu.cn" : "alice@pku.edu.cn";
+
+		if (sm2_sign_init(&sign_ctx, &sm2_key, id, strlen(id)) != 1
+			|| sm2_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+			|| sm2_sign_finish(&sign_ctx, sigbuf, &siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_verify_init_ex(&verify_ctx, &vkey, id, strlen(id)) != 1
+			|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, sigbuf, siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_verify_init_ex(&verify_ctx, &vkey, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, sigbuf, siglen) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	for (i = 0; i < TEST_COUNT; i++) {
+		rand_bytes(dgst, sizeof(dgst));
+		if (sm2_do_sign(&sm2_key, dgst, &sig) != 1
+			|| sm2_verify_key_do_verify(&vkey, dgst, &sig) != 1) {
+			error_print();
+			return -1;
+		}
+		dgst[0] ^= 1;
+		if (sm2_verify_key_do_verify(&vkey, dgst, &sig) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	sm2_verify_key_cleanup(&vkey);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm2_sign_ctx_speed(void)
 {
 	SM2_KEY sm2_key;
@@ -332,14 +508,176 @@ static int test_sm2_sign_reset(void)
 	return 1;
 }
 
+// empty, short, exactly one buffer and multi-buffer files verify as sm2_verify_update of the same data
+static int test_sm2_sign_file(void)
+{
+	size_t lens[] = {
+		0, 100,
+		SM2_SIGN_FILE_BUF_SIZE,
+		SM2_SIGN_FILE_BUF_SIZE * (SM2_SIGN_FILE_BUFS + 2) + 3,
+	};
+	size_t maxlen = SM2_SIGN_FILE_BUF_SIZE * (SM2_SIGN_FILE_BUFS + 2) + 3;
+	SM2_KEY sm2_key;
+	SM2_VERIFY_CTX vrfy_ctx;
+	uint8_t *data = NULL;
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	FILE *fp = NULL;
+	size_t i;
+	int ret = -1;
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| !(data = (uint8_t *)malloc(maxlen))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(data, maxlen);
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		if (!(fp = tmpfile())
+			|| fwrite(data, 1, lens[i], fp) != lens[i]) {
+			error_print();
+			goto end;
+		}
+		rewind(fp);
+		if (sm2_sign_file(&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, fp, sig, &siglen) != 1) {
+			error_print();
+			goto end;
+		}
+		fclose(fp);
+		fp = NULL;
+
+		if (sm2_verify_init(&vrfy_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_verify_update(&vrfy_ctx, data, lens[i]) != 1
+			|| sm2_verify_finish(&vrfy_ctx, sig, siglen) != 1) {
+			error_print();
+			goto end;
+		}
+		// the last byte is signed
+		if (lens[i]) {
+			data[lens[i] - 1] ^= 1;
+			if (sm2_verify_init(&vrfy_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+				|| sm2_verify_update(&vrfy_ctx, data, lens[i]) != 1
+				|| sm2_verify_finish(&vrfy_ctx, sig, siglen) == 1) {
+				error_print();
+				goto end;
+			}
+			data[lens[i] - 1] ^= 1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (fp) fclose(fp);
+	free(data);
+	return ret;
+}
+
+static int test_sm2_verify_cache(void)
+{
+	SM2_KEY sm2_key;
+	SM2_KEY other_key;
+	SM2_SIGN_CTX sign_ctx;
+	SM2_VERIFY_CTX verify_ctx;
+	uint8_t msg[100];
+	uint8_t dgst[32];
+	uint8_t sigbuf[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t msg_sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t msg_siglen;
+	size_t hits, misses;
+	int i;
+
+	rand_bytes(dgst, sizeof(dgst));
+	rand_bytes(msg, sizeof(msg));
+	if (sm2_key_generate(&sm2_key) != 1
+		|| sm2_key_generate(&other_key) != 1
+		|| sm2_sign(&sm2_key, dgst, sigbuf, &siglen) != 1
+		|| sm2_sign_init(&sign_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+		|| sm2_sign_update(&sign_ctx, msg, sizeof(msg)) != 1
+		|| sm2_sign_finish(&sign_ctx, msg_sig, &msg_siglen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	sm2_verify_cache_set_ttl(60);
+	for (i = 0; i < 3; i++) {
+		if (sm2_verify(&sm2_key, dgst, sigbuf, siglen) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	sm2_verify_cache_get_stats(&hits, &misses);
+	if (hits != 2 || misses != 1) {
+		error_print();
+		goto err;
+	}
+
+	// failures are not cached, another key or digest is another entry
+	if (sm2_verify(&other_key, dgst, sigbuf, siglen) == 1
+		|| sm2_verify(&other_key, dgst, sigbuf, siglen) == 1) {
+		error_print();
+		goto err;
+	}
+	dgst[0] ^= 1;
+	if (sm2_verify(&sm2_key, dgst, sigbuf, siglen) == 1) {
+		error_print();
+		goto err;
+	}
+	dgst[0] ^= 1;
+	sm2_verify_cache_get_stats(&hits, &misses);
+	if (hits != 2 || misses != 4) {
+		error_print();
+		goto err;
+	}
+
+	// the streaming verification shares the cache
+	for (i = 0; i < 2; i++) {
+		if (sm2_verify_init(&verify_ctx, &sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1
+			|| sm2_verify_update(&verify_ctx, msg, sizeof(msg)) != 1
+			|| sm2_verify_finish(&verify_ctx, msg_sig, msg_siglen) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+	sm2_verify_cache_get_stats(&hits, &misses);
+	if (hits != 3 || misses != 5) {
+		error_print();
+		goto err;
+	}
+
+	// turned off, nothing is looked up
+	sm2_verify_cache_set_ttl(0);
+	if (sm2_verify(&sm2_key, dgst, sigbuf, siglen) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_verify_cache_get_stats(&hits, &misses);
+	if (hits != 0 || misses != 0 || sm2_verify_cache_enabled()) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_verify_cache_set_ttl(0);
+	return -1;
+}
+
 int main(void)
 {
 	if (test_sm2_signature() != 1) goto err;
 	if (test_sm2_do_sign() != 1) goto err;
+	if (test_sm2_do_verify_batch() != 1) goto err;
 	if (test_sm2_fast_sign() != 1) goto err;
 	if (test_sm2_sign() != 1) goto err;
 	if (test_sm2_sign_ctx() != 1) goto err;
 	if (test_sm2_sign_reset() != 1) goto err;
+	if (test_sm2_sign_file() != 1) goto err;
+	if (test_sm2_verify_key() != 1) goto err;
+	if (test_sm2_verify_cache() != 1) goto err;
 	if (test_sm2_sign_ctx_speed() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -17,6 +17,12 @@
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
+#if defined(ENABLE_SM2_IFMA) || defined(ENABLE_SM2_AMD64)
+#include <gmssl/cpu.h>
+#endif
+#ifdef ENABLE_SM2_IFMA
+#include <gmssl/sm2_z256_x8_ifma.h>
+#endif
 
 
 // TODO:		
@@ -124,6 +130,112 @@ static int test_sm2_z256_modp_mont_sqrt(void)
 	return 1;
 }
 
+static int test_sm2_z256_mont_inv(void)
+{
+	sm2_z256_t a;
+	sm2_z256_t r;
+	sm2_z256_t r_;
+	int i;
+
+	for (i = 0; i < 64; i++) {
+		// 1, 2 and n - 1 cover the extreme divstep paths, p - 1 is only in the modp range
+		sm2_z256_set_zero(a);
+		if (i < 2) {
+			a[0] = i + 1;
+		} else if (i == 2) {
+			sm2_z256_copy(a, sm2_z256_order_minus_one());
+		} else if (sm2_z256_rand_range(a, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+
+		sm2_z256_modp_mont_inv(r, a);
+		sm2_z256_modp_mont_inv_exp(r_, a);
+		if (sm2_z256_cmp(r, r_) != 0) {
+			error_print();
+			return -1;
+		}
+		if (i == 3) {
+			sm2_z256_sub(a, sm2_z256_prime(), sm2_z256_one());
+			sm2_z256_modp_mont_inv(r, a);
+			sm2_z256_modp_mont_inv_exp(r_, a);
+			if (sm2_z256_cmp(r, r_) != 0) {
+				error_print();
+				return -1;
+			}
+			continue;
+		}
+
+		sm2_z256_modn_mont_inv(r, a);
+		sm2_z256_modn_mont_inv_exp(r_, a);
+		if (sm2_z256_cmp(r, r_) != 0) {
+			error_print();
+			return -1;
+		}
+
+		sm2_z256_modn_inv(r, a);
+		sm2_z256_modn_mul(r, r, a);
+		if (sm2_z256_cmp(r, sm2_z256_one()) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_z256_modp_vartime(void)
+{
+	sm2_z256_t a;
+	sm2_z256_t mont_a;
+	sm2_z256_t r;
+	sm2_z256_t r_;
+	int i, jacobi;
+
+	for (i = 0; i < 32; i++) {
+		if (i == 0) {
+			sm2_z256_copy(a, sm2_z256_one());
+		} else if (sm2_z256_rand_range(a, sm2_z256_prime()) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_z256_is_zero(a)) {
+			continue;
+		}
+		sm2_z256_modp_to_mont(a, mont_a);
+
+		sm2_z256_modp_mont_inv(r, mont_a);
+		sm2_z256_modp_mont_inv_vartime(r_, mont_a);
+		if (sm2_z256_cmp(r, r_) != 0) {
+			error_print();
+			return -1;
+		}
+
+		// a square, then a or -a is not as p = 3 (mod 4)
+		sm2_z256_modp_mont_sqr(r, mont_a);
+		if (sm2_z256_modp_mont_jacobi_vartime(r) != 1) {
+			error_print();
+			return -1;
+		}
+		jacobi = sm2_z256_modp_mont_jacobi_vartime(mont_a);
+		sm2_z256_modp_neg(r, mont_a);
+		if (jacobi != (sm2_z256_modp_mont_sqrt(r_, mont_a) == 1 ? 1 : -1)
+			|| sm2_z256_modp_mont_jacobi_vartime(r) != -jacobi) {
+			error_print();
+			return -1;
+		}
+	}
+	sm2_z256_set_zero(a);
+	if (sm2_z256_modp_mont_jacobi_vartime(a) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm2_z256_modp(void)
 {
 	struct {
@@ -914,6 +1026,502 @@ static int test_sm2_z256_point_equ(void)
 	return 1;
 }
 
+// the comb of any SM2_Z256_GENERATOR_WINDOW against the variable base multiplication
+static int test_sm2_z256_point_mul_generator_vs_mul(void)
+{
+	SM2_Z256_POINT G;
+	SM2_Z256_POINT P;
+	SM2_Z256_POINT Q;
+	uint64_t k[4];
+	int i;
+
+	sm2_z256_point_from_hex(&G,
+		"32C4AE2C1F1981195F9904466A39C9948FE30BBFF2660BE1715A4589334C74C7"
+		"BC3736A2F4F6779C59BDCEE36B692153D0A9877CC62A474002DF32E52139F0A0");
+
+	for (i = 0; i < 32; i++) {
+		if (i == 0) {
+			sm2_z256_copy(k, sm2_z256_order_minus_one());
+		} else if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_generator(&P, k);
+		sm2_z256_point_mul(&Q, k, &G);
+		if (sm2_z256_point_equ(&P, &Q) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// P[5] is the point at infinity
+static int test_sm2_z256_point_mul_vartime(void)
+{
+	SM2_Z256_POINT P;
+	SM2_Z256_POINT Q;
+	SM2_Z256_POINT R;
+	SM2_Z256_POINT S;
+	uint64_t k[4];
+	uint64_t s[4];
+	int i;
+
+	if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+		error_print();
+		return -1;
+	}
+	sm2_z256_point_mul_generator(&P, k);
+
+	for (i = 0; i < 40; i++) {
+		// small scalars, n - 1 and around the window sizes
+		if (i < 20) {
+			sm2_z256_set_zero(k);
+			k[0] = i;
+		} else if (i == 20) {
+			sm2_z256_copy(k, sm2_z256_order_minus_one());
+		} else if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul(&Q, k, &P);
+		sm2_z256_point_mul_vartime(&R, k, &P);
+		if (sm2_z256_point_is_at_infinity(&Q) ? !sm2_z256_point_is_at_infinity(&R)
+			: sm2_z256_point_equ(&Q, &R) != 1) {
+			error_print();
+			return -1;
+		}
+
+		if (sm2_z256_rand_range(s, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_sum(&Q, k, &P, s);
+		sm2_z256_point_mul_sum_vartime(&R, k, &P, s);
+		if (sm2_z256_point_equ(&Q, &R) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the doubling in the additions of a small order multiple, k * P = (k/2 + k/2) * P
+	sm2_z256_set_zero(k);
+	k[0] = 2;
+	sm2_z256_point_dbl(&S, &P);
+	sm2_z256_point_mul_vartime(&R, k, &P);
+	if (sm2_z256_point_equ(&S, &R) != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_z256_point_multi_mul(void)
+{
+	SM2_Z256_POINT P[7];
+	sm2_z256_t k[7];
+	SM2_Z256_POINT R;
+	SM2_Z256_POINT S;
+	SM2_Z256_POINT T;
+	size_t n, i;
+
+	for (i = 0; i < 7; i++) {
+		if (sm2_z256_rand_range(k[i], sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_generator(&P[i], k[i]);
+		if (sm2_z256_rand_range(k[i], sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// a zero scalar and a repeated point
+	sm2_z256_set_zero(k[2]);
+	P[4] = P[3];
+
+	for (n = 0; n <= 7; n++) {
+		sm2_z256_point_set_infinity(&S);
+		for (i = 0; i < n; i++) {
+			sm2_z256_point_mul(&T, k[i], &P[i]);
+			sm2_z256_point_add(&S, &S, &T);
+		}
+		if (sm2_z256_point_multi_mul(&R, k, P, n) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm2_z256_point_is_at_infinity(&S)) {
+			if (!sm2_z256_point_is_at_infinity(&R)) {
+				error_print();
+				return -1;
+			}
+		} else if (sm2_z256_point_equ(&R, &S) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the methods agree with each other, with zero and repeated and opposite points
+static int test_sm2_z256_point_multi_mul_pippenger(void)
+{
+	size_t n = 2 * SM2_Z256_MSM_THREAD_MIN_POINTS + 3;
+	SM2_Z256_POINT *P = NULL;
+	sm2_z256_t *k = NULL;
+	SM2_Z256_POINT S;
+	SM2_Z256_POINT R;
+	size_t ns[] = { 0, 1, 2, 7, 100, 300 };
+	int window_sizes[] = { 0, 2, 5, 9 };
+	size_t i, j;
+	int ret = -1;
+
+	if (!(P = (SM2_Z256_POINT *)malloc(sizeof(SM2_Z256_POINT) * n))
+		|| !(k = (sm2_z256_t *)malloc(sizeof(sm2_z256_t) * n))) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < n; i++) {
+		if (sm2_z256_rand_range(k[i], sm2_z256_order()) != 1) {
+			error_print();
+			goto end;
+		}
+		sm2_z256_point_mul_generator(&P[i], k[i]);
+		if (sm2_z256_rand_range(k[i], sm2_z256_order()) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	sm2_z256_set_zero(k[3]);
+	P[5] = P[4];
+	sm2_z256_copy(k[5], k[4]);
+	// cancels k[0] * P[0]
+	sm2_z256_point_neg(&P[6], &P[0]);
+	sm2_z256_copy(k[6], k[0]);
+
+	for (i = 0; i < sizeof(ns)/sizeof(ns[0]); i++) {
+		if (sm2_z256_point_multi_mul_straus(&S, k, P, ns[i]) != 1) {
+			error_print();
+			goto end;
+		}
+		for (j = 0; j < sizeof(window_sizes)/sizeof(window_sizes[0]); j++) {
+			if (sm2_z256_point_multi_mul_pippenger(&R, k, P, ns[i], window_sizes[j]) != 1) {
+				error_print();
+				goto end;
+			}
+			if (sm2_z256_point_is_at_infinity(&S) ? !sm2_z256_point_is_at_infinity(&R)
+				: sm2_z256_point_equ(&R, &S) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+	if (sm2_z256_point_multi_mul(&S, k, P, n) != 1
+		|| sm2_z256_point_multi_mul_threads(&R, k, P, n, 2) != 1
+		|| sm2_z256_point_equ(&R, &S) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(P);
+	free(k);
+	return ret;
+}
+
+static int test_sm2_z256_points_get_affine_batch(void)
+{
+	SM2_Z256_POINT P[9];
+	SM2_Z256_AFFINE_POINT A[9];
+	uint64_t k[4];
+	uint64_t x[4], y[4];
+	uint64_t ax[4], ay[4];
+	int i;
+
+	for (i = 0; i < 9; i++) {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_generator(&P[i], k);
+	}
+	sm2_z256_point_set_infinity(&P[5]);
+
+	if (sm2_z256_points_get_affine_batch(P, 9, A) != 0) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 9; i++) {
+		if (i == 5) {
+			if (!sm2_z256_is_zero(A[i].x) || !sm2_z256_is_zero(A[i].y)) {
+				error_print();
+				return -1;
+			}
+			continue;
+		}
+		sm2_z256_point_get_xy(&P[i], x, y);
+		sm2_z256_modp_from_mont(ax, A[i].x);
+		sm2_z256_modp_from_mont(ay, A[i].y);
+		if (sm2_z256_cmp(ax, x) != 0 || sm2_z256_cmp(ay, y) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	if (sm2_z256_points_get_affine_batch(P, 5, A) != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm2_z256_points_from_octets_batch(void)
+{
+	SM2_Z256_POINT Q[11];
+	SM2_Z256_POINT P[11];
+	SM2_Z256_POINT R;
+	uint8_t octets[11][65];
+	const uint8_t *in[11];
+	size_t inlen[11];
+	int ok[11];
+	uint64_t k[4];
+	int i;
+
+	// compressed and uncompressed points, more than one group of square roots
+	for (i = 0; i < 11; i++) {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_generator(&Q[i], k);
+		if (i % 3 == 2) {
+			sm2_z256_point_to_uncompressed_octets(&Q[i], octets[i]);
+			inlen[i] = 65;
+		} else {
+			sm2_z256_point_to_compressed_octets(&Q[i], octets[i]);
+			inlen[i] = 33;
+		}
+		in[i] = octets[i];
+	}
+	if (sm2_z256_points_from_octets_batch(P, in, inlen, 11, ok) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 11; i++) {
+		if (ok[i] != 1 || sm2_z256_point_equ(&P[i], &Q[i]) != 1
+			|| sm2_z256_point_from_octets(&R, in[i], inlen[i]) != 1
+			|| sm2_z256_point_equ(&R, &P[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// x without a point, x >= p, wrong length, bad prefix, point not on the curve
+	memset(octets[1] + 1, 0xff, 4);
+	for (i = 2; i < 33; i++) {
+		octets[3][i] = 0;
+	}
+	// the first x without a point
+	do {
+		octets[3][32]++;
+	} while (sm2_z256_point_from_x_bytes(&R, octets[3] + 1, 0) == 1);
+	inlen[4] = 32;
+	octets[6][0] = 0x05;
+	octets[8][64] ^= 1;
+	if (sm2_z256_points_from_octets_batch(P, in, inlen, 11, ok) != 0) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 11; i++) {
+		int bad = (i == 1 || i == 3 || i == 4 || i == 6 || i == 8);
+		if (ok[i] != !bad
+			|| (bad && !sm2_z256_point_is_at_infinity(&P[i]))
+			|| (!bad && sm2_z256_point_equ(&P[i], &Q[i]) != 1)) {
+			fprintf(stderr, "point %d\n", i);
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifdef ENABLE_SM2_IFMA
+// lane 1 has t = 0, lane 2 has s = t = 0, lane 3 doubles in the first window
+static int test_sm2_z256_point_mul_sum_x8(void)
+{
+	const uint64_t ifma = GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512IFMA;
+	SM2_Z256_POINT G;
+	SM2_Z256_POINT P[8];
+	SM2_Z256_POINT G_table[16];
+	SM2_Z256_POINT tables[8][16];
+	const SM2_Z256_POINT *P_tables[8];
+	SM2_Z256_POINT R[8];
+	SM2_Z256_POINT Q;
+	uint64_t s[8][4];
+	uint64_t t[8][4];
+	uint64_t k[4];
+	unsigned int bad;
+	int i;
+
+	if ((gmssl_cpu_features() & ifma) != ifma) {
+		printf("%s() skipped, no AVX512 IFMA\n", __FUNCTION__);
+		return 1;
+	}
+
+	sm2_z256_point_mul_generator(&G, sm2_z256_one());
+	sm2_z256_point_mul_pre_compute(&G, G_table);
+	for (i = 0; i < 8; i++) {
+		if (sm2_z256_rand_range(k, sm2_z256_order()) != 1
+			|| sm2_z256_rand_range(s[i], sm2_z256_order()) != 1
+			|| sm2_z256_rand_range(t[i], sm2_z256_order()) != 1) {
+			error_print();
+			return -1;
+		}
+		sm2_z256_point_mul_generator(&P[i], k);
+	}
+	sm2_z256_copy(s[0], sm2_z256_order_minus_one());
+	sm2_z256_set_zero(t[1]);
+	sm2_z256_set_zero(s[2]);
+	sm2_z256_set_zero(t[2]);
+	P[3] = G;
+	sm2_z256_copy(t[3], s[3]);
+	for (i = 0; i < 8; i++) {
+		sm2_z256_point_mul_pre_compute(&P[i], tables[i]);
+		P_tables[i] = tables[i];
+	}
+
+	bad = sm2_z256_point_mul_sum_x8(R, (const uint64_t (*)[4])s, (const uint64_t (*)[4])t, G_table, P_tables);
+	if (bad != (1 << 3)) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 8; i++) {
+		if (i == 3) {
+			continue;
+		}
+		sm2_z256_point_mul_sum(&Q, t[i], &P[i], s[i]);
+		if (i == 2) {
+			if (sm2_z256_point_is_at_infinity(&R[i]) != 1) {
+				error_print();
+				return -1;
+			}
+		} else if (sm2_z256_point_equ(&R[i], &Q) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_SM2_AMD64
+// the MULX/ADCX/ADOX results against MUL/ADC, at the largest values and random ones
+static int test_sm2_z256_amd64(void)
+{
+	const uint64_t mulx = GMSSL_CPU_BMI2|GMSSL_CPU_ADX;
+	const sm2_z256_t one = {1,0,0,0};
+	sm2_z256_t a[32], b[32], r[4][32], t;
+	SM2_Z256_POINT P, Q[3], R;
+	SM2_Z256_AFFINE_POINT A;
+	sm2_z256_t k;
+	size_t i;
+
+	if ((gmssl_cpu_features() & mulx) != mulx) {
+		printf("%s() skipped\n", __FUNCTION__);
+		return 1;
+	}
+
+	for (i = 0; i < 32; i++) {
+		sm2_z256_rand_range(a[i], sm2_z256_order());
+		sm2_z256_rand_range(b[i], sm2_z256_order());
+	}
+	sm2_z256_sub(a[0], sm2_z256_order(), one);
+	sm2_z256_copy(b[0], a[0]);
+	sm2_z256_sub(a[1], sm2_z256_prime(), one);
+	sm2_z256_copy(b[1], a[1]);
+	sm2_z256_rand_range(k, sm2_z256_order());
+
+	sm2_z256_amd64_set_mulx(1);
+	for (i = 0; i < 32; i++) {
+		sm2_z256_modp_mont_mul(r[0][i], a[i], b[i]);
+		sm2_z256_modp_mont_sqr(r[1][i], a[i]);
+		if (i != 1) {
+			sm2_z256_modn_mont_mul(r[2][i], a[i], b[i]);
+			sm2_z256_modn_mont_sqr(r[3][i], a[i]);
+		}
+	}
+	sm2_z256_point_mul_generator(&P, k);
+	sm2_z256_point_dbl(&Q[0], &P);
+	sm2_z256_point_add(&Q[1], &Q[0], &P);
+	sm2_z256_point_get_xy(&P, A.x, A.y);
+	sm2_z256_modp_to_mont(A.x, A.x);
+	sm2_z256_modp_to_mont(A.y, A.y);
+	sm2_z256_point_add_affine(&Q[2], &Q[1], &A);
+
+	sm2_z256_amd64_set_mulx(0);
+	for (i = 0; i < 32; i++) {
+		sm2_z256_modp_mont_mul(t, a[i], b[i]);
+		if (sm2_z256_cmp(t, r[0][i]) != 0) {
+			error_print();
+			goto err;
+		}
+		sm2_z256_modp_mont_sqr(t, a[i]);
+		if (sm2_z256_cmp(t, r[1][i]) != 0) {
+			error_print();
+			goto err;
+		}
+		if (i == 1) {
+			continue;
+		}
+		sm2_z256_modn_mont_mul(t, a[i], b[i]);
+		if (sm2_z256_cmp(t, r[2][i]) != 0) {
+			error_print();
+			goto err;
+		}
+		sm2_z256_modn_mont_sqr(t, a[i]);
+		if (sm2_z256_cmp(t, r[3][i]) != 0) {
+			error_print();
+			goto err;
+		}
+	}
+	sm2_z256_point_dbl(&R, &P);
+	if (memcmp(&R, &Q[0], sizeof(R)) != 0) {
+		error_print();
+		goto err;
+	}
+	sm2_z256_point_add(&R, &Q[0], &P);
+	if (memcmp(&R, &Q[1], sizeof(R)) != 0) {
+		error_print();
+		goto err;
+	}
+	sm2_z256_point_add_affine(&R, &Q[1], &A);
+	if (memcmp(&R, &Q[2], sizeof(R)) != 0) {
+		error_print();
+		goto err;
+	}
+
+	sm2_z256_amd64_set_mulx(1);
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	sm2_z256_amd64_set_mulx(1);
+	return -1;
+}
+#endif
+
 static int test_sm2_z256_point_from_hash(void)
 {
 	SM2_Z256_POINT P;
@@ -951,13 +1559,27 @@ int main(void)
 
 	if (test_sm2_z256_modp() != 1) goto err;
 	if (test_sm2_z256_modp_mont_sqrt() != 1) goto err;
+	if (test_sm2_z256_modp_vartime() != 1) goto err;
+	if (test_sm2_z256_mont_inv() != 1) goto err;
 	if (test_sm2_z256_modn() != 1) goto err;
+#ifdef ENABLE_SM2_AMD64
+	if (test_sm2_z256_amd64() != 1) goto err;
+#endif
 
 	if (test_sm2_z256_point_is_on_curve() != 1) goto err;
 	if (test_sm2_z256_point_equ() != 1) goto err;
 	if (test_sm2_z256_point_get_xy() != 1) goto err;
 	if (test_sm2_z256_point_add_conjugate() != 1) goto err;
 	if (test_sm2_z256_point_mul_generator() != 1) goto err;
+	if (test_sm2_z256_point_mul_generator_vs_mul() != 1) goto err;
+	if (test_sm2_z256_point_mul_vartime() != 1) goto err;
+	if (test_sm2_z256_point_multi_mul() != 1) goto err;
+	if (test_sm2_z256_point_multi_mul_pippenger() != 1) goto err;
+	if (test_sm2_z256_points_get_affine_batch() != 1) goto err;
+	if (test_sm2_z256_points_from_octets_batch() != 1) goto err;
+#ifdef ENABLE_SM2_IFMA
+	if (test_sm2_z256_point_mul_sum_x8() != 1) goto err;
+#endif
 	if (test_sm2_z256_point_from_hash() != 1) goto err;
 	if (test_sm2_z256_point_from_x_bytes() != 1) goto err;
 
@@ -0,0 +1,196 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#include <gmssl/sm3_cdc.h>
+
+
+#define DATA_SIZE	(1024 * 1024)
+#define MAX_CHUNKS	1024
+
+typedef struct {
+	SM3_CDC_CHUNK chunks[MAX_CHUNKS];
+	size_t count;
+	const uint8_t *stream; // the whole input, to check the chunk data
+	int error;
+} CHUNK_LIST;
+
+static int chunk_cb(void *arg, const SM3_CDC_CHUNK *chunk, const uint8_t *data)
+{
+	CHUNK_LIST *list = (CHUNK_LIST *)arg;
+	SM3_CTX sm3_ctx;
+	uint8_t dgst[32];
+	uint64_t offset = list->count ? list->chunks[list->count - 1].offset + list->chunks[list->count - 1].len : 0;
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, data, chunk->len);
+	sm3_finish(&sm3_ctx, dgst);
+	if (list->count == MAX_CHUNKS
+		|| chunk->offset != offset
+		|| memcmp(data, list->stream + chunk->offset, chunk->len) != 0
+		|| memcmp(dgst, chunk->fingerprint, 32) != 0) {
+		list->error = 1;
+		return 0;
+	}
+	list->chunks[list->count++] = *chunk;
+	return 1;
+}
+
+static int chunk_all(const uint8_t *data, size_t datalen, size_t step, CHUNK_LIST *list)
+{
+	SM3_CDC_CTX ctx;
+	size_t len;
+
+	memset(list, 0, sizeof(*list));
+	list->stream = data;
+	if (sm3_cdc_init(&ctx, 0, 0, 0, chunk_cb, list) != 1) {
+		error_print();
+		return -1;
+	}
+	while (datalen) {
+		len = datalen < step ? datalen : step;
+		if (sm3_cdc_update(&ctx, data, len) != 1) {
+			sm3_cdc_cleanup(&ctx);
+			error_print();
+			return -1;
+		}
+		data += len;
+		datalen -= len;
+	}
+	if (sm3_cdc_finish(&ctx) != 1) {
+		sm3_cdc_cleanup(&ctx);
+		error_print();
+		return -1;
+	}
+	sm3_cdc_cleanup(&ctx);
+	return 1;
+}
+
+static int test_sm3_cdc(void)
+{
+	static CHUNK_LIST list;
+	static CHUNK_LIST list2;
+	uint8_t *data;
+	size_t steps[] = { 1, 1000, 65536, 100000 };
+	size_t total;
+	size_t i;
+
+	if (!(data = (uint8_t *)malloc(DATA_SIZE))) {
+		error_print();
+		return -1;
+	}
+	rand_bytes(data, DATA_SIZE);
+
+	if (chunk_all(data, DATA_SIZE, DATA_SIZE, &list) != 1 || list.error) {
+		error_print();
+		goto err;
+	}
+	total = 0;
+	for (i = 0; i < list.count; i++) {
+		if (list.chunks[i].len > SM3_CDC_DEFAULT_MAX_SIZE
+			|| (i < list.count - 1 && list.chunks[i].len <= SM3_CDC_DEFAULT_MIN_SIZE)) {
+			error_print();
+			goto err;
+		}
+		total += list.chunks[i].len;
+	}
+	// about 10K per chunk, with the bytes skipped before min_size
+	if (total != DATA_SIZE || list.count < DATA_SIZE / 20000 || list.count > DATA_SIZE / 5000) {
+		error_print();
+		goto err;
+	}
+
+	// the same cut points, however the stream is split
+	for (i = 0; i < sizeof(steps)/sizeof(steps[0]); i++) {
+		if (chunk_all(data, DATA_SIZE, steps[i], &list2) != 1 || list2.error
+			|| list2.count != list.count
+			|| memcmp(list2.chunks, list.chunks, sizeof(SM3_CDC_CHUNK) * list.count) != 0) {
+			error_print();
+			goto err;
+		}
+	}
+
+	// zeros never match a mask, they are cut at max_size
+	memset(data, 0, 3 * SM3_CDC_DEFAULT_MAX_SIZE);
+	if (chunk_all(data, 3 * SM3_CDC_DEFAULT_MAX_SIZE + 5, 7777, &list2) != 1 || list2.error
+		|| list2.count != 4
+		|| list2.chunks[0].len != SM3_CDC_DEFAULT_MAX_SIZE
+		|| list2.chunks[3].len != 5) {
+		error_print();
+		goto err;
+	}
+
+	free(data);
+	printf("%s() ok, %zu chunks\n", __FUNCTION__, list.count);
+	return 1;
+err:
+	free(data);
+	return -1;
+}
+
+// an inserted byte only changes the chunks around it
+static int test_sm3_cdc_shift(void)
+{
+	static CHUNK_LIST list;
+	static CHUNK_LIST list2;
+	uint8_t *data;
+	size_t i, j, shared = 0;
+
+	if (!(data = (uint8_t *)malloc(DATA_SIZE + 1))) {
+		error_print();
+		return -1;
+	}
+	rand_bytes(data + 1, DATA_SIZE);
+	if (chunk_all(data + 1, DATA_SIZE, DATA_SIZE, &list) != 1 || list.error) {
+		error_print();
+		free(data);
+		return -1;
+	}
+	data[0] = 0x5a;
+	if (chunk_all(data, DATA_SIZE + 1, DATA_SIZE, &list2) != 1 || list2.error) {
+		error_print();
+		free(data);
+		return -1;
+	}
+	free(data);
+
+	for (i = 0; i < list2.count; i++) {
+		for (j = 0; j < list.count; j++) {
+			if (memcmp(list2.chunks[i].fingerprint, list.chunks[j].fingerprint, 32) == 0) {
+				shared++;
+				break;
+			}
+		}
+	}
+	if (shared + 3 < list.count) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sm3_cdc() != 1) goto err;
+	if (test_sm3_cdc_shift() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -0,0 +1,205 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3_cl.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+
+
+static void sm3_digest(const uint8_t *msg, size_t msglen, uint8_t dgst[SM3_DIGEST_SIZE])
+{
+	SM3_CTX sm3_ctx;
+
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, msg, msglen);
+	sm3_finish(&sm3_ctx, dgst);
+}
+
+// lengths around the padding boundaries, not a multiple of the work group size
+static int test_sm3_cl_digest_batch(void)
+{
+	SM3_CL_CTX ctx;
+	size_t msglens[] = { 0, 3, 55, 56, 64, 119, 4096 };
+	size_t nmsgs = 33;
+	uint8_t *msgs = NULL;
+	uint8_t dgsts[33][SM3_DIGEST_SIZE];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	size_t i, j;
+	int ret = -1;
+
+	if (!(msgs = (uint8_t *)malloc(4096 * nmsgs))) {
+		error_print();
+		return -1;
+	}
+	if (sm3_cl_init(&ctx, NULL) != 1) {
+		error_print();
+		free(msgs);
+		return -1;
+	}
+	for (i = 0; i < sizeof(msglens)/sizeof(msglens[0]); i++) {
+		for (j = 0; j < msglens[i] * nmsgs; j += 256) {
+			rand_bytes(msgs + j, msglens[i] * nmsgs - j < 256 ? msglens[i] * nmsgs - j : 256);
+		}
+		if (sm3_cl_digest_batch(&ctx, msgs, msglens[i], nmsgs, dgsts) != 1) {
+			error_print();
+			goto end;
+		}
+		for (j = 0; j < nmsgs; j++) {
+			sm3_digest(msgs + msglens[i] * j, msglens[i], dgst);
+			if (memcmp(dgsts[j], dgst, SM3_DIGEST_SIZE) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm3_cl_cleanup(&ctx);
+	free(msgs);
+	return ret;
+}
+
+static void prf(const uint8_t seed[32], const uint8_t adrs[32], uint8_t out[32])
+{
+	SM3_CTX sm3_ctx;
+	uint8_t hash_id[32] = {0};
+
+	hash_id[31] = 3;
+	sm3_init(&sm3_ctx);
+	sm3_update(&sm3_ctx, hash_id, 32);
+	sm3_update(&sm3_ctx, seed, 32);
+	sm3_update(&sm3_ctx, adrs, 32);
+	sm3_finish(&sm3_ctx, out);
+}
+
+// the chain steps computed as in sm3_xmss
+static int test_sm3_cl_wots_chains(void)
+{
+	SM3_CL_CTX ctx;
+	uint8_t seed[32];
+	uint8_t adrs[67][32];
+	uint8_t x[67][32];
+	uint8_t cl_x[67][32];
+	uint8_t a[32];
+	uint8_t key[32];
+	uint8_t bm[32];
+	uint8_t f_in[96];
+	int start = 3, steps = 9;
+	int i, s, k;
+	int ret = -1;
+
+	rand_bytes(seed, sizeof(seed));
+	rand_bytes(x[0], sizeof(x));
+	memcpy(cl_x, x, sizeof(x));
+	for (i = 0; i < 67; i++) {
+		memset(adrs[i], 0, 32);
+		adrs[i][15] = 0; // type = OTS
+		adrs[i][19] = 5; // ots address
+		adrs[i][23] = (uint8_t)i; // chain address
+	}
+
+	for (i = 0; i < 67; i++) {
+		memcpy(a, adrs[i], 32);
+		for (s = start; s < start + steps; s++) {
+			a[27] = (uint8_t)s;
+			a[31] = 0;
+			prf(seed, a, key);
+			a[31] = 1;
+			prf(seed, a, bm);
+			memset(f_in, 0, 32);
+			memcpy(f_in + 32, key, 32);
+			for (k = 0; k < 32; k++) {
+				f_in[64 + k] = x[i][k] ^ bm[k];
+			}
+			sm3_digest(f_in, sizeof(f_in), x[i]);
+		}
+	}
+
+	if (sm3_cl_init(&ctx, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm3_cl_wots_chains(&ctx, seed, (const uint8_t (*)[32])adrs, cl_x, 67, start, steps) != 1) {
+		error_print();
+		goto end;
+	}
+	if (memcmp(cl_x, x, sizeof(x)) != 0) {
+		error_print();
+		goto end;
+	}
+	if (sm3_cl_wots_chains(&ctx, seed, (const uint8_t (*)[32])adrs, cl_x, 67, 10, 6) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm3_cl_cleanup(&ctx);
+	return ret;
+}
+
+// the context and queue of an SM4_CL_CTX
+static int test_sm3_cl_share_sm4_cl(void)
+{
+	SM4_CL_CTX sm4_ctx;
+	SM3_CL_CTX ctx;
+	uint8_t key[16] = {0};
+	uint8_t msgs[2][100];
+	uint8_t dgsts[2][SM3_DIGEST_SIZE];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	int ret = -1;
+
+	rand_bytes(msgs[0], sizeof(msgs));
+	if (sm4_cl_set_encrypt_key(&sm4_ctx, key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (sm3_cl_init(&ctx, &sm4_ctx) != 1) {
+		error_print();
+		sm4_cl_cleanup(&sm4_ctx);
+		return -1;
+	}
+	// the shared context outlives the SM4_CL_CTX
+	sm4_cl_cleanup(&sm4_ctx);
+
+	if (sm3_cl_digest_batch(&ctx, msgs[0], sizeof(msgs[0]), 2, dgsts) != 1) {
+		error_print();
+		goto end;
+	}
+	sm3_digest(msgs[1], sizeof(msgs[1]), dgst);
+	if (memcmp(dgsts[1], dgst, sizeof(dgst)) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm3_cl_cleanup(&ctx);
+	return ret;
+}
+
+int main(void)
+{
+	if (test_sm3_cl_digest_batch() != 1) goto err;
+	if (test_sm3_cl_wots_chains() != 1) goto err;
+	if (test_sm3_cl_share_sm4_cl() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
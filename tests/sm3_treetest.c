@@ -0,0 +1,391 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm3.h>
+#include <gmssl/rand.h>
+#include <gmssl/endian.h>
+#include <gmssl/error.h>
+#include <gmssl/sm3_tree.h>
+
+
+#define LEAF_SIZE	1024
+
+static void root_from_top(const uint8_t top[32], uint64_t count, uint8_t root[32])
+{
+	uint8_t prefix[13] = { 0x02 };
+	SM3_CTX ctx;
+
+	PUTU32(prefix + 1, LEAF_SIZE);
+	PUTU64(prefix + 5, count);
+	sm3_init(&ctx);
+	sm3_update(&ctx, prefix, sizeof(prefix));
+	sm3_update(&ctx, top, 32);
+	sm3_finish(&ctx, root);
+}
+
+// the tree shapes of 1, 3 and 5 leaves spelled out
+static int test_sm3_tree_shape(void)
+{
+	uint8_t data[LEAF_SIZE * 4 + 1];
+	uint8_t leaves[5][32];
+	uint8_t dgst[32];
+	uint8_t a[32], b[32], c[32];
+	uint8_t root[32];
+	uint8_t ref[32];
+	const uint8_t prefix = 0x00;
+	SM3_CTX ctx;
+	size_t i;
+
+	rand_bytes(data, sizeof(data));
+
+	// leaf(i) = SM3(0x00 || SM3(leaf data))
+	for (i = 0; i < 5; i++) {
+		sm3_init(&ctx);
+		sm3_update(&ctx, data + LEAF_SIZE * i, i < 4 ? LEAF_SIZE : 1);
+		sm3_finish(&ctx, dgst);
+		sm3_init(&ctx);
+		sm3_update(&ctx, &prefix, 1);
+		sm3_update(&ctx, dgst, 32);
+		sm3_finish(&ctx, leaves[i]);
+	}
+	if (sm3_tree_hash_leaves(data, LEAF_SIZE, LEAF_SIZE, &a, 1) != 1
+		|| memcmp(a, leaves[0], 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// one leaf
+	root_from_top(leaves[0], 1, ref);
+	if (sm3_tree_root((const uint8_t (*)[32])leaves, 1, LEAF_SIZE, root) != 1
+		|| memcmp(root, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// node(node(l0, l1), l2)
+	sm3_tree_node_hash(leaves[0], leaves[1], a);
+	sm3_tree_node_hash(a, leaves[2], b);
+	root_from_top(b, 3, ref);
+	if (sm3_tree_root((const uint8_t (*)[32])leaves, 3, LEAF_SIZE, root) != 1
+		|| memcmp(root, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// node(node(node(l0, l1), node(l2, l3)), l4)
+	sm3_tree_node_hash(leaves[2], leaves[3], b);
+	sm3_tree_node_hash(a, b, c);
+	sm3_tree_node_hash(c, leaves[4], c);
+	root_from_top(c, 5, ref);
+	if (sm3_tree_root((const uint8_t (*)[32])leaves, 5, LEAF_SIZE, root) != 1
+		|| memcmp(root, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// sm3_tree_update in any pieces, on any threads, gives the root of the leaf hashes
+static int test_sm3_tree_update(void)
+{
+	size_t lens[] = { 0, 1, LEAF_SIZE, LEAF_SIZE * 300, LEAF_SIZE * 1000 + 17 };
+	size_t pieces[] = { 1, 100, LEAF_SIZE - 1, LEAF_SIZE * 3 + 5, LEAF_SIZE * 1001 };
+	int threads[] = { 1, 4, 0 };
+	size_t maxlen = LEAF_SIZE * 1001;
+	uint8_t *data = NULL;
+	uint8_t (*hashes)[32] = NULL;
+	uint8_t ref[32];
+	uint8_t root[32];
+	SM3_TREE_CTX ctx;
+	size_t count, off, n;
+	size_t i, j, k;
+	int ret = -1;
+
+	if (!(data = (uint8_t *)malloc(maxlen))
+		|| !(hashes = malloc(32 * 1001))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(data, maxlen);
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		if (lens[i]) {
+			if (sm3_tree_hash_leaves(data, lens[i], LEAF_SIZE, hashes, 1) != 1) {
+				error_print();
+				goto end;
+			}
+			count = (lens[i] + LEAF_SIZE - 1) / LEAF_SIZE;
+		} else {
+			sm3_tree_leaf_hash(data, 0, hashes[0]);
+			count = 1;
+		}
+		if (sm3_tree_root((const uint8_t (*)[32])hashes, count, LEAF_SIZE, ref) != 1) {
+			error_print();
+			goto end;
+		}
+
+		for (j = 0; j < sizeof(threads)/sizeof(threads[0]); j++) {
+			for (k = 0; k < sizeof(pieces)/sizeof(pieces[0]); k++) {
+				if (sm3_tree_init(&ctx, LEAF_SIZE, threads[j]) != 1) {
+					error_print();
+					goto end;
+				}
+				for (off = 0; off < lens[i]; off += n) {
+					n = lens[i] - off < pieces[k] ? lens[i] - off : pieces[k];
+					if (sm3_tree_update(&ctx, data + off, n) != 1) {
+						error_print();
+						goto end;
+					}
+				}
+				if (sm3_tree_finish(&ctx, root) != 1
+					|| memcmp(root, ref, 32) != 0) {
+					error_print();
+					goto end;
+				}
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(data);
+	free(hashes);
+	return ret;
+}
+
+// every leaf of trees of 1 to 33 leaves verifies with its audit path, nothing else does
+static int test_sm3_tree_prove(void)
+{
+	uint8_t hashes[33][32];
+	uint8_t path[SM3_TREE_MAX_HEIGHT][32];
+	uint8_t root[32];
+	size_t pathlen;
+	size_t count, i;
+
+	rand_bytes((uint8_t *)hashes, sizeof(hashes));
+
+	for (count = 1; count <= 33; count++) {
+		if (sm3_tree_root((const uint8_t (*)[32])hashes, count, LEAF_SIZE, root) != 1) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < count; i++) {
+			if (sm3_tree_prove((const uint8_t (*)[32])hashes, count, i, path, &pathlen) != 1) {
+				error_print();
+				return -1;
+			}
+			if (sm3_tree_verify(root, LEAF_SIZE, count, i, hashes[i],
+				(const uint8_t (*)[32])path, pathlen) != 1) {
+				error_print();
+				return -1;
+			}
+			// another leaf, another position, another tree size
+			if (sm3_tree_verify(root, LEAF_SIZE, count, i, hashes[(i + 1) % 33],
+				(const uint8_t (*)[32])path, pathlen) != 0) {
+				error_print();
+				return -1;
+			}
+			if (count > 1 && sm3_tree_verify(root, LEAF_SIZE, count, (i + 1) % count, hashes[i],
+				(const uint8_t (*)[32])path, pathlen) != 0) {
+				error_print();
+				return -1;
+			}
+			if (sm3_tree_verify(root, LEAF_SIZE, count + 1, i, hashes[i],
+				(const uint8_t (*)[32])path, pathlen) == 1) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the frontier root after each append is the MTH of all the leaves, leaf(i) = SM3(0x00 || entry)
+static int test_sm3_log_append(void)
+{
+	uint8_t entries[100][40];
+	const uint8_t *entry_ptrs[100];
+	size_t entry_lens[100];
+	uint8_t hashes[100][32];
+	uint8_t hash[32];
+	uint8_t root[32];
+	uint8_t ref[32];
+	const uint8_t prefix = 0x00;
+	SM3_LOG log;
+	SM3_CTX ctx;
+	size_t i;
+
+	rand_bytes((uint8_t *)entries, sizeof(entries));
+	for (i = 0; i < 100; i++) {
+		entry_ptrs[i] = entries[i];
+		entry_lens[i] = i % 41;
+	}
+	if (sm3_log_hash_leaves(entry_ptrs, entry_lens, 100, hashes) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 100; i++) {
+		sm3_init(&ctx);
+		sm3_update(&ctx, &prefix, 1);
+		sm3_update(&ctx, entries[i], entry_lens[i]);
+		sm3_finish(&ctx, ref);
+		sm3_log_leaf_hash(entries[i], entry_lens[i], hash);
+		if (memcmp(hashes[i], ref, 32) != 0 || memcmp(hash, ref, 32) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the empty log
+	sm3_log_init(&log);
+	sm3_init(&ctx);
+	sm3_finish(&ctx, ref);
+	if (sm3_log_root(&log, root) != 1 || memcmp(root, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < 100; i++) {
+		if (sm3_log_append(&log, (const uint8_t (*)[32])&hashes[i], 1) != 1
+			|| sm3_log_root(&log, root) != 1
+			|| sm3_log_tree_root((const uint8_t (*)[32])hashes, i + 1, ref) != 1
+			|| memcmp(root, ref, 32) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	// node(node(l0, l1), l2)
+	sm3_tree_node_hash(hashes[0], hashes[1], hash);
+	sm3_tree_node_hash(hash, hashes[2], hash);
+	if (sm3_log_tree_root((const uint8_t (*)[32])hashes, 3, root) != 1
+		|| memcmp(root, hash, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm3_log_proofs(void)
+{
+	uint8_t hashes[33][32];
+	uint8_t roots[34][32];
+	uint8_t proof[SM3_LOG_MAX_PROOF_SIZE][32];
+	uint8_t nodes[33 * SM3_TREE_MAX_HEIGHT][32];
+	uint8_t leaf_hashes[33][32];
+	uint64_t indexes[33];
+	size_t prooflen, nodes_cnt, n;
+	size_t size, old_size, i;
+
+	rand_bytes((uint8_t *)hashes, sizeof(hashes));
+	for (size = 1; size <= 33; size++) {
+		sm3_log_tree_root((const uint8_t (*)[32])hashes, size, roots[size]);
+	}
+
+	for (size = 1; size <= 33; size++) {
+		for (i = 0; i < size; i++) {
+			if (sm3_log_prove_inclusion((const uint8_t (*)[32])hashes, size, i, proof, &prooflen) != 1
+				|| sm3_log_verify_inclusion(roots[size], size, i, hashes[i],
+					(const uint8_t (*)[32])proof, prooflen) != 1
+				|| sm3_log_verify_inclusion(roots[size], size, i, hashes[(i + 1) % 33],
+					(const uint8_t (*)[32])proof, prooflen) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+
+		for (old_size = 1; old_size <= size; old_size++) {
+			if (sm3_log_prove_consistency((const uint8_t (*)[32])hashes, size, old_size, proof, &prooflen) != 1
+				|| sm3_log_verify_consistency(roots[old_size], old_size, roots[size], size,
+					(const uint8_t (*)[32])proof, prooflen) != 1) {
+				error_print();
+				return -1;
+			}
+			// another old root
+			if (old_size < size
+				&& sm3_log_verify_consistency(roots[old_size + 1], old_size, roots[size], size,
+					(const uint8_t (*)[32])proof, prooflen) != 0) {
+				error_print();
+				return -1;
+			}
+			proof[0][0] ^= 1;
+			if (prooflen && sm3_log_verify_consistency(roots[old_size], old_size, roots[size], size,
+					(const uint8_t (*)[32])proof, prooflen) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+
+		// every third leaf and the last one, the shared nodes are sent once
+		for (n = 0, i = 0; i < size; i++) {
+			if (i % 3 == 0 || i == size - 1) {
+				indexes[n] = i;
+				memcpy(leaf_hashes[n], hashes[i], 32);
+				n++;
+			}
+		}
+		if (sm3_log_prove_batch((const uint8_t (*)[32])hashes, size, indexes, n, nodes, &nodes_cnt) != 1
+			|| nodes_cnt > n * SM3_TREE_MAX_HEIGHT
+			|| sm3_log_verify_batch(roots[size], size, indexes, (const uint8_t (*)[32])leaf_hashes, n,
+				(const uint8_t (*)[32])nodes, nodes_cnt) != 1) {
+			error_print();
+			return -1;
+		}
+		leaf_hashes[n - 1][0] ^= 1;
+		if (sm3_log_verify_batch(roots[size], size, indexes, (const uint8_t (*)[32])leaf_hashes, n,
+			(const uint8_t (*)[32])nodes, nodes_cnt) != 0) {
+			error_print();
+			return -1;
+		}
+		if (sm3_log_verify_batch(roots[size], size + 1, indexes, (const uint8_t (*)[32])hashes, n,
+			(const uint8_t (*)[32])nodes, nodes_cnt) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// all the leaves, no other hash is needed
+	for (i = 0; i < 33; i++) {
+		indexes[i] = i;
+	}
+	if (sm3_log_prove_batch((const uint8_t (*)[32])hashes, 33, indexes, 33, nodes, &nodes_cnt) != 1
+		|| nodes_cnt != 0
+		|| sm3_log_verify_batch(roots[33], 33, indexes, (const uint8_t (*)[32])hashes, 33, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_sm3_tree_shape() != 1) goto err;
+	if (test_sm3_tree_update() != 1) goto err;
+	if (test_sm3_tree_prove() != 1) goto err;
+	if (test_sm3_log_append() != 1) goto err;
+	if (test_sm3_log_proofs() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -180,6 +180,38 @@ static int test_sm3_xmss_derive_root(void)
 }
 
 
+static int test_sm3_xmss_derive_root_threads(void)
+{
+	uint8_t xmss_secret[32];
+	uint8_t seed[32];
+	int height = 8;
+	hash256_bytes_t *tree = malloc(32 * (1<<height) * 2);
+	hash256_bytes_t *tree_mt = malloc(32 * (1<<height) * 2);
+	uint8_t xmss_root[32];
+	uint8_t xmss_root_mt[32];
+	int threads[] = { 0, 3, 16, XMSS_MAX_THREADS + 1 };
+	size_t i;
+
+	memset(xmss_secret, 0x12, 32);
+	memset(seed, 0xab, 32);
+
+	// the leaves are split among the threads, the tree is the same
+	sm3_xmss_derive_root_ex(xmss_secret, height, seed, 1, tree, xmss_root);
+	for (i = 0; i < sizeof(threads)/sizeof(threads[0]); i++) {
+		sm3_xmss_derive_root_ex(xmss_secret, height, seed, threads[i], tree_mt, xmss_root_mt);
+		if (memcmp(xmss_root_mt, xmss_root, 32) != 0
+			|| memcmp(tree_mt, tree, 32 * ((1<<(height + 1)) - 1)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	free(tree);
+	free(tree_mt);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm3_xmss_do_sign(void)
 {
 	uint8_t xmss_secret[32];
@@ -216,6 +248,63 @@ static int test_sm3_xmss_do_sign(void)
 	return 1;
 }
 
+static int test_sm3_xmss_bds(void)
+{
+	uint8_t xmss_secret[32];
+	uint8_t seed[32];
+	uint8_t adrs[32] = {0};
+	uint8_t dgst[32] = {0};
+	uint8_t xmss_root[32];
+	uint8_t bds_root[32];
+	hash256_bytes_t wots_sig[67];
+	hash256_bytes_t bds_wots_sig[67];
+	hash256_bytes_t auth_path[8];
+	hash256_bytes_t bds_auth_path[8];
+	hash256_bytes_t *tree = malloc(32 * (1<<8) * 2);
+	SM3_XMSS_BDS bds;
+	int heights[] = { 1, 2, 5, 8 };
+	uint32_t index;
+	size_t i;
+
+	memset(xmss_secret, 0x12, 32);
+	memset(seed, 0xab, 32);
+
+	// the BDS auth path of every leaf is the same as from the full tree
+	for (i = 0; i < sizeof(heights)/sizeof(heights[0]); i++) {
+		int h = heights[i];
+
+		sm3_xmss_derive_root(xmss_secret, h, seed, tree, xmss_root);
+		if (sm3_xmss_bds_init(&bds, xmss_secret, h, seed, 0, bds_root) != 1
+			|| memcmp(bds_root, xmss_root, 32) != 0) {
+			error_print();
+			return -1;
+		}
+		for (index = 0; index < (1U<<h); index++) {
+			dgst[0] = (uint8_t)index;
+			sm3_xmss_do_sign(xmss_secret, index, seed, adrs, h, tree, dgst, wots_sig, auth_path);
+			sm3_xmss_bds_do_sign(xmss_secret, seed, adrs, &bds, dgst, bds_wots_sig, bds_auth_path);
+			if (bds.index != index
+				|| memcmp(bds_wots_sig, wots_sig, sizeof(wots_sig)) != 0
+				|| memcmp(bds_auth_path, auth_path, 32 * h) != 0) {
+				error_print();
+				return -1;
+			}
+			if (index + 1 < (1U<<h) && sm3_xmss_bds_next(&bds, xmss_secret, seed) != 1) {
+				error_print();
+				return -1;
+			}
+		}
+		if (sm3_xmss_bds_next(&bds, xmss_secret, seed) != -1) {
+			error_print();
+			return -1;
+		}
+	}
+	free(tree);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm3_xmss_sign(void)
 {
 #if defined(ENABLE_SHA2) && defined(ENABLE_SM3_XMSS_CROSSCHECK)
@@ -255,14 +344,87 @@ static int test_sm3_xmss_sign(void)
 	return 1;
 }
 
+static int test_sm3_xmss_sign_bds(void)
+{
+#if defined(ENABLE_SHA2) && defined(ENABLE_SM3_XMSS_CROSSCHECK)
+	uint32_t oid = XMSS_SHA256_10;
+#else
+	uint32_t oid = XMSS_SM3_10;
+#endif
+	SM3_XMSS_KEY key;
+	SM3_XMSS_KEY key2;
+	SM3_XMSS_SIGN_CTX sign_ctx;
+	uint8_t sig[sizeof(SM3_XMSS_SIGNATURE)];
+	uint8_t sig2[sizeof(SM3_XMSS_SIGNATURE)];
+	size_t siglen, siglen2;
+	uint8_t msg[100] = {0};
+	uint8_t *buf = NULL;
+	size_t buflen;
+	int i;
+
+	if (sm3_xmss_key_generate_bds(&key, oid) != 1 || key.tree) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < 5; i++) {
+		sm3_xmss_sign_init(&sign_ctx, &key);
+		sm3_xmss_sign_update(&sign_ctx, msg, sizeof(msg));
+		if (sm3_xmss_sign_finish(&sign_ctx, &key, sig, &siglen) != 1) {
+			error_print();
+			return -1;
+		}
+
+		sm3_xmss_verify_init(&sign_ctx, &key, sig, siglen);
+		sm3_xmss_verify_update(&sign_ctx, msg, sizeof(msg));
+		if (sm3_xmss_verify_finish(&sign_ctx, &key, sig, siglen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (sm3_xmss_key_update(&key) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the BDS state is saved with the key
+	if (sm3_xmss_key_to_bytes(&key, NULL, &buflen) != 1
+		|| !(buf = malloc(buflen))
+		|| sm3_xmss_key_to_bytes(&key, buf, &buflen) != 1
+		|| sm3_xmss_key_from_bytes(&key2, buf, buflen) != 1
+		|| !key2.bds || key2.index != 5) {
+		error_print();
+		return -1;
+	}
+	sm3_xmss_sign_init(&sign_ctx, &key);
+	sm3_xmss_sign_update(&sign_ctx, msg, sizeof(msg));
+	sm3_xmss_sign_finish(&sign_ctx, &key, sig, &siglen);
+	sm3_xmss_sign_init(&sign_ctx, &key2);
+	sm3_xmss_sign_update(&sign_ctx, msg, sizeof(msg));
+	sm3_xmss_sign_finish(&sign_ctx, &key2, sig2, &siglen2);
+	if (siglen2 != siglen || memcmp(sig2, sig, siglen) != 0) {
+		error_print();
+		return -1;
+	}
+	free(buf);
+	sm3_xmss_key_cleanup(&key);
+	sm3_xmss_key_cleanup(&key2);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm3_wots_derive_sk() != 1) goto err;
 	if (test_sm3_wots_derive_pk() != 1) goto err;
 	if (test_sm3_wots_do_sign() != 1) goto err;
 	if (test_sm3_xmss_derive_root() != 1) goto err;
+	if (test_sm3_xmss_derive_root_threads() != 1) goto err;
 	if (test_sm3_xmss_do_sign() != 1) goto err;
+	if (test_sm3_xmss_bds() != 1) goto err;
 	if (test_sm3_xmss_sign() != 1) goto err;
+	if (test_sm3_xmss_sign_bds() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
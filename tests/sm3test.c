@@ -12,10 +12,16 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
-#include <time.h>
 #include <gmssl/sm3.h>
+#include <gmssl/hmac.h>
 #include <gmssl/hex.h>
+#include <gmssl/rand.h>
+#include <gmssl/cpu.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
+#ifdef ENABLE_SM3_AVX512
+#include <gmssl/sm3_x16_avx512.h>
+#endif
 
 
 static int test_sm3(void)
@@ -176,38 +182,609 @@ static int test_sm3(void)
 	return 1;
 }
 
-static int test_sm3_speed(void)
+static int test_sm3_kdf(void)
+{
+	uint8_t z[200];
+	uint8_t out[600];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	uint8_t counter_be[4];
+	size_t zlens[] = { 0, 5, 59, 60, 64, 65, 127, 200 };
+	size_t outlens[] = { 1, 32, 33, 64, 255, 256, 257, 600 };
+	SM3_KDF_CTX kdf_ctx;
+	SM3_CTX sm3_ctx;
+	size_t i, j, k, len;
+
+	rand_bytes(z, sizeof(z));
+
+	// the multi-lane path starts above one digest, Z covers the buffered tails of the prefix
+	for (i = 0; i < sizeof(zlens)/sizeof(zlens[0]); i++) {
+		for (j = 0; j < sizeof(outlens)/sizeof(outlens[0]); j++) {
+			sm3_kdf_init(&kdf_ctx, outlens[j]);
+			sm3_kdf_update(&kdf_ctx, z, zlens[i]);
+			sm3_kdf_finish(&kdf_ctx, out);
+
+			for (k = 0; k * SM3_DIGEST_SIZE < outlens[j]; k++) {
+				PUTU32(counter_be, (uint32_t)(k + 1));
+				sm3_init(&sm3_ctx);
+				sm3_update(&sm3_ctx, z, zlens[i]);
+				sm3_update(&sm3_ctx, counter_be, sizeof(counter_be));
+				sm3_finish(&sm3_ctx, dgst);
+
+				len = outlens[j] - k * SM3_DIGEST_SIZE;
+				if (len > SM3_DIGEST_SIZE) {
+					len = SM3_DIGEST_SIZE;
+				}
+				if (memcmp(out + k * SM3_DIGEST_SIZE, dgst, len) != 0) {
+					error_print();
+					return -1;
+				}
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm3_digest_batch(void)
 {
+	uint8_t data[1024];
+	const uint8_t *datas[50];
+	size_t lens[50];
+	uint8_t dgsts[50][SM3_DIGEST_SIZE];
+	uint8_t dgst[SM3_DIGEST_SIZE];
 	SM3_CTX sm3_ctx;
-	uint8_t blocks[4096];
+	size_t i;
+	int pass;
+
+	for (i = 0; i < sizeof(data); i += 256) {
+		rand_bytes(data + i, 256);
+	}
+	// mixed lengths around the 1 and 2 padding block boundaries
+	for (i = 0; i < 50; i++) {
+		lens[i] = (i * 37) % 300;
+		datas[i] = data + (i * 13) % (sizeof(data) - 300);
+	}
+	lens[0] = 0;
+	lens[1] = 55;
+	lens[2] = 56;
+	lens[3] = 64;
+	lens[4] = 1000;
+	datas[4] = data;
+
+	// dispatched kernel, then the scalar lanes
+	for (pass = 0; pass < 2; pass++) {
+		if (pass) {
+			gmssl_cpu_disable_features(GMSSL_CPU_AVX2);
+		}
+		memset(dgsts, 0, sizeof(dgsts));
+		sm3_digest_batch(datas, lens, 50, dgsts);
+
+		for (i = 0; i < 50; i++) {
+			sm3_init(&sm3_ctx);
+			sm3_update(&sm3_ctx, datas[i], lens[i]);
+			sm3_finish(&sm3_ctx, dgst);
+			if (memcmp(dgsts[i], dgst, SM3_DIGEST_SIZE) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifdef ENABLE_SM3_AVX512
+static int test_sm3_x16_compress_lanes(void)
+{
+	const uint64_t avx512 = GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW;
+	uint8_t data[16][3 * SM3_BLOCK_SIZE];
+	const uint8_t *datas[16];
+	uint32_t lanes[8][16];
+	uint32_t digest[16][8];
+	int i, w;
+
+	if ((gmssl_cpu_features() & avx512) != avx512) {
+		printf("%s() skipped\n", __FUNCTION__);
+		return 1;
+	}
+
+	// every lane from its own state and data, lane 15 shares the data of lane 0
+	for (i = 0; i < 16; i++) {
+		rand_bytes(data[i], sizeof(data[i]) / 2);
+		rand_bytes(data[i] + sizeof(data[i]) / 2, sizeof(data[i]) / 2);
+		rand_bytes((uint8_t *)digest[i], sizeof(digest[i]));
+	}
+	for (i = 0; i < 16; i++) {
+		datas[i] = data[i == 15 ? 0 : i];
+		for (w = 0; w < 8; w++) {
+			lanes[w][i] = digest[i][w];
+		}
+	}
+	sm3_x16_compress_lanes(lanes, datas, 3);
+
+	for (i = 0; i < 16; i++) {
+		sm3_compress_blocks(digest[i], datas[i], 3);
+		for (w = 0; w < 8; w++) {
+			if (lanes[w][i] != digest[i][w]) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_SM3_WASM
+static int test_sm3_x4_compress_lanes(void)
+{
+	uint8_t data[4][3 * SM3_BLOCK_SIZE];
+	const uint8_t *datas[4];
+	uint32_t lanes[8][4];
+	uint32_t digest[4][8];
+	int i, w;
+
+	if (!(gmssl_cpu_features() & GMSSL_CPU_WASM_SIMD128)) {
+		printf("%s() skipped\n", __FUNCTION__);
+		return 1;
+	}
+
+	// every lane from its own state and data, lane 3 shares the data of lane 0
+	for (i = 0; i < 4; i++) {
+		rand_bytes(data[i], sizeof(data[i]));
+		rand_bytes((uint8_t *)digest[i], sizeof(digest[i]));
+	}
+	for (i = 0; i < 4; i++) {
+		datas[i] = data[i == 3 ? 0 : i];
+		for (w = 0; w < 8; w++) {
+			lanes[w][i] = digest[i][w];
+		}
+	}
+	sm3_x4_compress_lanes(lanes, datas, 3);
+
+	for (i = 0; i < 4; i++) {
+		sm3_compress_blocks(digest[i], datas[i], 3);
+		for (w = 0; w < 8; w++) {
+			if (lanes[w][i] != digest[i][w]) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+// against the generic HMAC, a SM3_HMAC_KEY serves any number of messages
+static int test_sm3_hmac(void)
+{
+	SM3_HMAC_KEY hmac_key;
+	SM3_HMAC_CTX ctx;
+	uint8_t key[100];
+	uint8_t msg[200];
+	uint8_t mac[SM3_HMAC_SIZE];
+	uint8_t ref[HMAC_MAX_SIZE];
+	size_t keylens[] = { 1, 32, 64, 65, 100 };
+	size_t msglens[] = { 1, 32, 55, 56, 64, 200 };
+	size_t reflen;
+	size_t i, j;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(msg, sizeof(msg));
+
+	for (i = 0; i < sizeof(keylens)/sizeof(keylens[0]); i++) {
+		sm3_hmac_set_key(&hmac_key, key, keylens[i]);
+
+		for (j = 0; j < sizeof(msglens)/sizeof(msglens[0]); j++) {
+			if (hmac(DIGEST_sm3(), key, keylens[i], msg, msglens[j], ref, &reflen) != 1) {
+				error_print();
+				return -1;
+			}
+
+			sm3_hmac_init(&ctx, key, keylens[i]);
+			sm3_hmac_update(&ctx, msg, msglens[j]);
+			sm3_hmac_finish(&ctx, mac);
+			if (memcmp(mac, ref, SM3_HMAC_SIZE) != 0) {
+				error_print();
+				return -1;
+			}
+
+			sm3_hmac_init_with_key(&ctx, &hmac_key);
+			sm3_hmac_update(&ctx, msg, msglens[j]);
+			sm3_hmac_finish(&ctx, mac);
+			if (memcmp(mac, ref, SM3_HMAC_SIZE) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// different keys in the lanes, e.g. the MACs of the records of many connections
+static int test_sm3_hmac_batch(void)
+{
+	uint8_t key[20 * 16];
+	uint8_t data[16384 + 13];
+	SM3_HMAC_CTX ctxs[20];
+	const SM3_HMAC_CTX *ctx_ptrs[20];
+	const uint8_t *datas[20];
+	size_t lens[20];
+	uint8_t macs[20][SM3_HMAC_SIZE];
+	uint8_t mac[SM3_HMAC_SIZE];
+	SM3_HMAC_CTX ctx;
+	size_t i;
+
+	rand_bytes(key, sizeof(key));
+	for (i = 0; i < sizeof(data); i += 256) {
+		rand_bytes(data + i, sizeof(data) - i < 256 ? sizeof(data) - i : 256);
+	}
+	for (i = 0; i < 20; i++) {
+		sm3_hmac_init(&ctxs[i], key + 16 * i, 16);
+		ctx_ptrs[i] = &ctxs[i];
+		lens[i] = 13 + (i * 997) % 2000;
+		datas[i] = data + i;
+	}
+	lens[0] = 0;
+	lens[1] = 55;
+	lens[2] = 56;
+	lens[3] = sizeof(data);
+	datas[3] = data;
+
+	sm3_hmac_batch(ctx_ptrs, datas, lens, 20, macs);
+
+	for (i = 0; i < 20; i++) {
+		sm3_hmac_init(&ctx, key + 16 * i, 16);
+		sm3_hmac_update(&ctx, datas[i], lens[i]);
+		sm3_hmac_finish(&ctx, mac);
+		if (memcmp(macs[i], mac, SM3_HMAC_SIZE) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the one block fast path of the iterations against a plain HMAC chain
+static int test_sm3_pbkdf2(void)
+{
+	char pass[] = "password";
+	uint8_t salt[] = "salt";
+	uint8_t out[40];
+	uint8_t ref[64];
+	uint8_t u[HMAC_MAX_SIZE];
+	uint8_t in[sizeof(salt) - 1 + 4];
+	size_t ulen;
+	size_t count = 5;
+	size_t i, j, k;
+
+	if (sm3_pbkdf2(pass, strlen(pass), salt, sizeof(salt) - 1, count, sizeof(out), out) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 2; i++) {
+		memcpy(in, salt, sizeof(salt) - 1);
+		in[sizeof(in) - 4] = 0;
+		in[sizeof(in) - 3] = 0;
+		in[sizeof(in) - 2] = 0;
+		in[sizeof(in) - 1] = (uint8_t)(i + 1);
+		hmac(DIGEST_sm3(), (uint8_t *)pass, strlen(pass), in, sizeof(in), u, &ulen);
+		memcpy(ref + 32 * i, u, 32);
+		for (j = 1; j < count; j++) {
+			hmac(DIGEST_sm3(), (uint8_t *)pass, strlen(pass), u, 32, u, &ulen);
+			for (k = 0; k < 32; k++) {
+				ref[32 * i + k] ^= u[k];
+			}
+		}
+	}
+	if (memcmp(out, ref, sizeof(out)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// more passwords and output blocks than lanes, every one as sm3_pbkdf2 alone
+static int test_sm3_pbkdf2_batch(void)
+{
+	char passes[11][16];
+	uint8_t salts[11][8];
+	const char *pass_ptrs[11];
+	size_t passlens[11];
+	const uint8_t *salt_ptrs[11];
+	size_t saltlens[11];
+	uint8_t outs[11][70];
+	uint8_t *out_ptrs[11];
+	uint8_t out[70];
+	size_t count = 7;
+	size_t i;
+
+	for (i = 0; i < 11; i++) {
+		snprintf(passes[i], sizeof(passes[i]), "pass%zu", i * 37);
+		rand_bytes(salts[i], sizeof(salts[i]));
+		pass_ptrs[i] = passes[i];
+		passlens[i] = strlen(passes[i]);
+		salt_ptrs[i] = salts[i];
+		saltlens[i] = sizeof(salts[i]) - (i % 3);
+		out_ptrs[i] = outs[i];
+	}
+	if (sm3_pbkdf2_batch(pass_ptrs, passlens, salt_ptrs, saltlens, count,
+		sizeof(outs[0]), out_ptrs, 11) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 11; i++) {
+		if (sm3_pbkdf2(passes[i], passlens[i], salts[i], saltlens[i], count, sizeof(out), out) != 1
+			|| memcmp(out, outs[i], sizeof(out)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifdef ENABLE_SM3_CE
+// "abcd" x 16 of GB/T 32905-2016 with the padding block, compressed by the kernel itself
+static int test_sm3_ce_compress_blocks(void)
+{
+	const char *dgsthex = "debe9ff92275b8a138604889c18e5a4d6fdb70e5387e5765293dcba39c0c5732";
+	uint32_t digest[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	uint8_t blocks[128] = {0};
 	uint8_t dgst[32];
-	clock_t start, end;
-	double seconds;
-	int i;
+	uint8_t ref[32];
+	size_t reflen;
+	size_t i;
 
-	for (i = 0; i < 4096; i++) {
-		sm3_update(&sm3_ctx, blocks, sizeof(blocks));
+	if (!(gmssl_cpu_features() & GMSSL_CPU_ARM_SM3)) {
+		return 1;
 	}
-	start = clock();
-	sm3_init(&sm3_ctx);
-	for (i = 0; i < 4096; i++) {
-		sm3_update(&sm3_ctx, blocks, sizeof(blocks));
+
+	for (i = 0; i < 64; i += 4) {
+		memcpy(blocks + i, "abcd", 4);
 	}
-	sm3_finish(&sm3_ctx, dgst);
-	end = clock();
+	blocks[64] = 0x80;
+	PUTU32(blocks + 124, 512);
 
-	seconds = (double)(end - start)/CLOCKS_PER_SEC;
+	sm3_ce_compress_blocks(digest, blocks, 2);
+	for (i = 0; i < 8; i++) {
+		PUTU32(dgst + 4 * i, digest[i]);
+	}
+	hex_to_bytes(dgsthex, strlen(dgsthex), ref, &reflen);
+	if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+		error_print();
+		return -1;
+	}
 
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
+#endif
+
+#ifdef ENABLE_SM3_AVX2
+// "abcd" x 16 with the padding block as a pair of blocks and as two odd blocks
+static int test_sm3_avx2_compress_blocks(void)
+{
+	const char *dgsthex = "debe9ff92275b8a138604889c18e5a4d6fdb70e5387e5765293dcba39c0c5732";
+	const uint32_t iv[8] = {
+		0x7380166F, 0x4914B2B9, 0x172442D7, 0xDA8A0600,
+		0xA96F30BC, 0x163138AA, 0xE38DEE4D, 0xB0FB0E4E,
+	};
+	void (*funcs[2])(uint32_t digest[8], const uint8_t *data, size_t blocks) = {
+		sm3_avx2_compress_blocks, NULL };
+	uint8_t blocks[128] = {0};
+	uint32_t digest[8];
+	uint8_t dgst[32];
+	uint8_t ref[32];
+	size_t reflen;
+	size_t i;
+	int f;
+
+	if ((gmssl_cpu_features() & (GMSSL_CPU_AVX2|GMSSL_CPU_BMI2)) != (GMSSL_CPU_AVX2|GMSSL_CPU_BMI2)) {
+		printf("%s() skipped\n", __FUNCTION__);
+		return 1;
+	}
+#ifdef ENABLE_SM3_AVX512
+	if ((gmssl_cpu_features() & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512VL)) == (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512VL)) {
+		funcs[1] = sm3_avx512_compress_blocks;
+	}
+#endif
+
+	for (i = 0; i < 64; i += 4) {
+		memcpy(blocks + i, "abcd", 4);
+	}
+	blocks[64] = 0x80;
+	PUTU32(blocks + 124, 512);
+	hex_to_bytes(dgsthex, strlen(dgsthex), ref, &reflen);
 
+	for (f = 0; f < 2 && funcs[f]; f++) {
+		memcpy(digest, iv, sizeof(iv));
+		funcs[f](digest, blocks, 2);
+		for (i = 0; i < 8; i++) {
+			PUTU32(dgst + 4 * i, digest[i]);
+		}
+		if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+			error_print();
+			return -1;
+		}
+
+		memcpy(digest, iv, sizeof(iv));
+		funcs[f](digest, blocks, 1);
+		funcs[f](digest, blocks + 64, 1);
+		for (i = 0; i < 8; i++) {
+			PUTU32(dgst + 4 * i, digest[i]);
+		}
+		if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+// fragment layouts across the block and the staging boundaries, after some buffered bytes
+static int test_sm3_updatev(void)
+{
+	static const size_t layouts[][6] = {
+		{ 0, 0, 0, 0, 0, 0 },
+		{ 1, 2, 3, 4, 5, 6 },
+		{ 64, 64, 1, 63, 128, 0 },
+		{ 63, 65, 1000, 1, 1024, 2000 },
+		{ 10, 1100, 30, 0, 4000, 5 },
+	};
+	size_t prefixes[] = { 0, 7, 64 };
+	uint8_t msg[8192];
+	uint8_t key[32];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	uint8_t ref[SM3_DIGEST_SIZE];
+	SM3_IOVEC iov[6];
+	SM3_CTX ctx;
+	SM3_HMAC_CTX hmac_ctx;
+	size_t i, j, k, off;
+
+	rand_bytes(msg, sizeof(msg));
+	rand_bytes(key, sizeof(key));
+
+	for (i = 0; i < sizeof(layouts)/sizeof(layouts[0]); i++) {
+		for (k = 0; k < sizeof(prefixes)/sizeof(prefixes[0]); k++) {
+			off = prefixes[k];
+			for (j = 0; j < 6; j++) {
+				iov[j].base = msg + off;
+				iov[j].len = layouts[i][j];
+				off += layouts[i][j];
+			}
+
+			sm3_init(&ctx);
+			sm3_update(&ctx, msg, off);
+			sm3_finish(&ctx, ref);
+			sm3_init(&ctx);
+			sm3_update(&ctx, msg, prefixes[k]);
+			sm3_updatev(&ctx, iov, 6);
+			sm3_finish(&ctx, dgst);
+			if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+				error_print();
+				return -1;
+			}
+
+			sm3_hmac_init(&hmac_ctx, key, sizeof(key));
+			sm3_hmac_update(&hmac_ctx, msg, off);
+			sm3_hmac_finish(&hmac_ctx, ref);
+			sm3_hmac_init(&hmac_ctx, key, sizeof(key));
+			sm3_hmac_update(&hmac_ctx, msg, prefixes[k]);
+			sm3_hmac_updatev(&hmac_ctx, iov, 6);
+			sm3_hmac_finish(&hmac_ctx, dgst);
+			if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm3_digest_fixed(void)
+{
+	void (*funcs[3])(const uint8_t *in, uint8_t dgst[32]) = {
+		sm3_digest32, sm3_digest64, sm3_digest96 };
+	void (*funcs_x8[3])(const uint8_t *const in[8], uint8_t dgst[8][32]) = {
+		sm3_digest32_x8, sm3_digest64_x8, sm3_digest96_x8 };
+	uint8_t msg[8][96];
+	const uint8_t *in[8];
+	uint8_t dgsts[8][SM3_DIGEST_SIZE];
+	uint8_t dgst[SM3_DIGEST_SIZE];
+	uint8_t ref[SM3_DIGEST_SIZE];
+	SM3_CTX ctx;
+	size_t i, j, len;
+
+	rand_bytes(msg[0], sizeof(msg));
+	for (i = 0; i < 8; i++) {
+		in[i] = msg[i];
+	}
+
+	for (j = 0; j < 3; j++) {
+		len = 32 * (j + 1);
+
+		sm3_init(&ctx);
+		sm3_update(&ctx, msg[0], len);
+		sm3_finish(&ctx, ref);
+		funcs[j](msg[0], dgst);
+		if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+			error_print();
+			return -1;
+		}
+
+		funcs_x8[j](in, dgsts);
+		for (i = 0; i < 8; i++) {
+			sm3_init(&ctx);
+			sm3_update(&ctx, msg[i], len);
+			sm3_finish(&ctx, ref);
+			if (memcmp(dgsts[i], ref, sizeof(ref)) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	// continued from the state after 1 and 2 blocks
+	for (j = 1; j <= 2; j++) {
+		sm3_init(&ctx);
+		sm3_update(&ctx, msg[1], 64 * j);
+		sm3_finish32(ctx.digest, ctx.nblocks, msg[2], dgst);
+		sm3_update(&ctx, msg[2], 32);
+		sm3_finish(&ctx, ref);
+		if (memcmp(dgst, ref, sizeof(ref)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
 
 int main(void)
 {
 	if (test_sm3() != 1) goto err;
-#if ENABLE_TEST_SPEED
-	if (test_sm3_speed() != 1) goto err;
+	if (test_sm3_updatev() != 1) goto err;
+	if (test_sm3_digest_fixed() != 1) goto err;
+#ifdef ENABLE_SM3_AVX2
+	if (test_sm3_avx2_compress_blocks() != 1) goto err; // before AVX2 is disabled
+#endif
+	if (test_sm3_kdf() != 1) goto err;
+	if (test_sm3_digest_batch() != 1) goto err;
+	if (test_sm3_hmac() != 1) goto err;
+	if (test_sm3_hmac_batch() != 1) goto err;
+	if (test_sm3_pbkdf2() != 1) goto err;
+	if (test_sm3_pbkdf2_batch() != 1) goto err;
+#ifdef ENABLE_SM3_AVX512
+	if (test_sm3_x16_compress_lanes() != 1) goto err;
+#endif
+#ifdef ENABLE_SM3_CE
+	if (test_sm3_ce_compress_blocks() != 1) goto err;
+#endif
+#ifdef ENABLE_SM3_WASM
+	if (test_sm3_x4_compress_lanes() != 1) goto err;
 #endif
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -13,6 +13,7 @@
 #include <assert.h>
 #include <gmssl/mem.h>
 #include <gmssl/rand.h>
+#include <gmssl/hex.h>
 #include <gmssl/error.h>
 #include <gmssl/sm4_cbc_mac.h>
 
@@ -83,8 +84,126 @@ static int test_sm4_cbc_mac(void)
 	return 1;
 }
 
+static int test_sm4_cmac(void)
+{
+	struct {
+		char *label;
+		char *key;
+		char *m;
+		char *mac;
+	} tests[] = {
+		{
+			"empty message",
+			"2b7e151628aed2a6abf7158809cf4f3c",
+			"",
+			"399a9c930964a3d4e38c59da47f0b309",
+		},
+		{
+			"one full block",
+			"2b7e151628aed2a6abf7158809cf4f3c",
+			"6bc1bee22e409f96e93d7e117393172a",
+			"4e4c2a4417e567fef081e0fab55a5762",
+		},
+		{
+			"partial last block",
+			"2b7e151628aed2a6abf7158809cf4f3c",
+			"6bc1bee22e409f96e93d7e117393172a"
+			"ae2d8a571e03ac9c9eb76fac45af8e51"
+			"30c81c46a35ce411",
+			"8e31701927d50b28d53787513b69dd75",
+		},
+	};
+	SM4_CMAC_CTX ctx;
+	uint8_t key[16];
+	uint8_t m[64];
+	uint8_t mac[16];
+	uint8_t buf[16];
+	size_t key_len, m_len, mac_len;
+	size_t i, step;
+
+	for (i = 0; i < sizeof(tests)/sizeof(tests[0]); i++) {
+		hex_to_bytes(tests[i].key, strlen(tests[i].key), key, &key_len);
+		hex_to_bytes(tests[i].m, strlen(tests[i].m), m, &m_len);
+		hex_to_bytes(tests[i].mac, strlen(tests[i].mac), mac, &mac_len);
+
+		for (step = 1; step <= 17; step += 8) {
+			const uint8_t *p = m;
+			size_t left = m_len;
+
+			sm4_cmac_init(&ctx, key);
+			while (left) {
+				size_t len = left < step ? left : step;
+				sm4_cmac_update(&ctx, p, len);
+				p += len;
+				left -= len;
+			}
+			sm4_cmac_finish(&ctx, buf);
+			if (memcmp(buf, mac, 16)) {
+				fprintf(stderr, "%s: %s\n", __FUNCTION__, tests[i].label);
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_sm4_mac_batch(void)
+{
+	SM4_CBC_MAC_CTX cbc_mac_ctx;
+	SM4_CMAC_CTX cmac_ctx;
+	uint8_t key[16];
+	uint8_t data[2000];
+	const uint8_t *msgs[50];
+	size_t msglens[50];
+	uint8_t macs[50 * 16];
+	uint8_t mac[16];
+	size_t cnt = sizeof(msgs)/sizeof(msgs[0]);
+	size_t i;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(data, sizeof(data));
+
+	// lengths 0, 16, 32 and ragged ones so that the lanes finish at different rounds
+	for (i = 0; i < cnt; i++) {
+		msgs[i] = data + i;
+		msglens[i] = (i % 3 == 0) ? (i % 4) * 16 : i * 37 % 500;
+	}
+
+	sm4_cbc_mac_init(&cbc_mac_ctx, key);
+	sm4_cbc_mac_batch(&cbc_mac_ctx.key, msgs, msglens, cnt, macs);
+	for (i = 0; i < cnt; i++) {
+		sm4_cbc_mac_init(&cbc_mac_ctx, key);
+		sm4_cbc_mac_update(&cbc_mac_ctx, msgs[i], msglens[i]);
+		sm4_cbc_mac_finish(&cbc_mac_ctx, mac);
+		if (memcmp(macs + 16 * i, mac, 16)) {
+			error_print();
+			return -1;
+		}
+	}
+
+	sm4_cmac_init(&cmac_ctx, key);
+	sm4_cmac_batch(&cmac_ctx, msgs, msglens, cnt, macs);
+	for (i = 0; i < cnt; i++) {
+		sm4_cmac_init(&cmac_ctx, key);
+		sm4_cmac_update(&cmac_ctx, msgs[i], msglens[i]);
+		sm4_cmac_finish(&cmac_ctx, mac);
+		if (memcmp(macs + 16 * i, mac, 16)) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4_cbc_mac() != 1) { error_print(); return -1; }
+	if (test_sm4_cmac() != 1) { error_print(); return -1; }
+	if (test_sm4_mac_batch() != 1) { error_print(); return -1; }
 	return 0;
 }
@@ -12,7 +12,6 @@
 #include <string.h>
 #include <stdlib.h>
 #include <stdint.h>
-#include <time.h>
 #include <gmssl/sm4.h>
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
@@ -86,6 +85,15 @@ static int test_sm4_ccm_test_vectors(void)
 		"aaaaaaaaaaaaaaaabbbbbbbbbbbbbbbbccccccccccccccccddddddddddddddddeeeeeeeeeeeeeeeeffffffffffffffffeeeeeeeeeeeeeeeeaaaaaaaaaaaaaaaa",
 		"48af93501fa62adbcd414cce6034d895dda1bf8f132f042098661572e7483094fd12e518ce062c98acee28d95df4416bed31a2f04476c18bb40c84a74b97dc5b",
 		},
+		{
+		"aad of 14 bytes, the (L(a) || a) block is not padded",
+		"0123456789abcdeffedcba9876543210",
+		"00001234567800000000abcd",
+		"000102030405060708090a0b0c0d",
+		"47460cf5ffa39aa70fd10b4f2b653c88",
+		"202122232425262728292a2b2c2d2e2f30313233",
+		"c2241bd99129a6565ed3dd5ef7a24d01215c4170",
+		},
 	};
 
 	uint8_t key[16];
@@ -175,32 +183,112 @@ static int test_sm4_ccm_test_vectors(void)
 	return 1;
 }
 
-static int speed_sm4_ccm_encrypt(void)
+static int test_sm4_ccm_ctx(void)
 {
 	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t iv[12];
-	uint8_t aad[16];
-	uint8_t tag[16];
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
+	SM4_CCM_CTX ctx;
+	uint8_t key[16];
+	uint8_t iv[SM4_CCM_MAX_IV_SIZE];
+	uint8_t aad[20];
+	uint8_t plaintext[5000];
+	uint8_t ciphertext[sizeof(plaintext) + SM4_CCM_MAX_TAG_SIZE];
+	uint8_t encrypted[sizeof(ciphertext)];
+	uint8_t decrypted[sizeof(plaintext)];
+	size_t lens[] = { 0, 1, 16, 33, 1024, 1027, sizeof(plaintext) };
+	size_t steps[] = { 1, 5, 16, 100, 2000 };
+	size_t taglen = SM4_CCM_DEFAULT_TAG_SIZE;
+	size_t ivlen = SM4_CCM_MIN_IV_SIZE;
+	size_t i, j, k, len, outlen;
+	uint8_t *out;
 
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(aad, sizeof(aad));
+	rand_bytes(plaintext, sizeof(plaintext));
 	sm4_set_encrypt_key(&sm4_key, key);
 
-	for (i = 0; i < 4096; i++) {
-		sm4_ccm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad), (uint8_t *)buf, sizeof(buf), (uint8_t *)buf, 16, tag);
-	}
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_ccm_encrypt(&sm4_key, iv, sizeof(iv), aad, sizeof(aad), (uint8_t *)buf, sizeof(buf), (uint8_t *)buf, 16, tag);
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		len = lens[i];
+		if (sm4_ccm_encrypt(&sm4_key, iv, ivlen, aad, sizeof(aad),
+			plaintext, len, ciphertext, taglen, ciphertext + len) != 1) {
+			error_print();
+			return -1;
+		}
+
+		for (j = 0; j < sizeof(steps)/sizeof(steps[0]); j++) {
+			if (sm4_ccm_encrypt_init(&ctx, key, sizeof(key), iv, ivlen, aad, sizeof(aad), len, taglen) != 1) {
+				error_print();
+				return -1;
+			}
+			out = encrypted;
+			for (k = 0; k < len; k += steps[j]) {
+				size_t n = len - k < steps[j] ? len - k : steps[j];
+				if (sm4_ccm_encrypt_update(&ctx, plaintext + k, n, out, &outlen) != 1) {
+					error_print();
+					return -1;
+				}
+				out += outlen;
+			}
+			if (sm4_ccm_encrypt_finish(&ctx, out, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			out += outlen;
+			if ((size_t)(out - encrypted) != len + taglen
+				|| memcmp(encrypted, ciphertext, len + taglen) != 0) {
+				error_print();
+				return -1;
+			}
+
+			// the tag is split across the updates too
+			if (sm4_ccm_decrypt_init(&ctx, key, sizeof(key), iv, ivlen, aad, sizeof(aad), len, taglen) != 1) {
+				error_print();
+				return -1;
+			}
+			out = decrypted;
+			for (k = 0; k < len + taglen; k += steps[j]) {
+				size_t n = len + taglen - k < steps[j] ? len + taglen - k : steps[j];
+				if (sm4_ccm_decrypt_update(&ctx, ciphertext + k, n, out, &outlen) != 1) {
+					error_print();
+					return -1;
+				}
+				out += outlen;
+			}
+			if (sm4_ccm_decrypt_finish(&ctx, out, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			out += outlen;
+			if ((size_t)(out - decrypted) != len
+				|| memcmp(decrypted, plaintext, len) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+
+		// modified tag
+		ciphertext[len] ^= 1;
+		if (sm4_ccm_decrypt(&sm4_key, iv, ivlen, aad, sizeof(aad),
+			ciphertext, len, ciphertext + len, taglen, decrypted) != -1) {
+			error_print();
+			return -1;
+		}
+		if (sm4_ccm_decrypt_init(&ctx, key, sizeof(key), iv, ivlen, aad, sizeof(aad), len, taglen) != 1
+			|| sm4_ccm_decrypt_update(&ctx, ciphertext, len + taglen, decrypted, &outlen) != 1
+			|| sm4_ccm_decrypt_finish(&ctx, decrypted + outlen, &outlen) != -1) {
+			error_print();
+			return -1;
+		}
 	}
-	end = clock();
 
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
+	// more payload than declared
+	if (sm4_ccm_encrypt_init(&ctx, key, sizeof(key), iv, ivlen, NULL, 0, 16, taglen) != 1
+		|| sm4_ccm_encrypt_update(&ctx, plaintext, 17, encrypted, &outlen) != -1) {
+		error_print();
+		return -1;
+	}
 
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
@@ -208,9 +296,7 @@ int main(void)
 {
 	if (test_sm4_ccm() != 1) goto err;
 	if (test_sm4_ccm_test_vectors() != 1) goto err;
-#if ENABLE_TEST_SPEED
-	if (speed_sm4_ccm_encrypt() != 1) goto err;
-#endif
+	if (test_sm4_ccm_ctx() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -260,11 +260,59 @@ static int test_sm4_cfb_ctx(void)
 	return 1;
 }
 
+// the 128-bit segment decryption runs in parallel, check it against the serial encryption
+static int test_sm4_cfb128_decrypt(void)
+{
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t state_iv[16];
+	uint8_t plaintext[16 * 150 + 5];
+	uint8_t encrypted[sizeof(plaintext)];
+	uint8_t decrypted[sizeof(plaintext)];
+	uint8_t next_iv[16];
+	size_t lens[] = { 16, 16 + 5, 16 * 8, 16 * 64, 16 * 65 + 1, sizeof(plaintext) };
+	size_t i;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(plaintext, sizeof(plaintext));
+
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		memcpy(state_iv, iv, sizeof(iv));
+		sm4_cfb_encrypt(&sm4_key, SM4_CFB_128, state_iv, plaintext, lens[i], encrypted);
+		memcpy(next_iv, state_iv, sizeof(state_iv));
+
+		memcpy(state_iv, iv, sizeof(iv));
+		sm4_cfb_decrypt(&sm4_key, SM4_CFB_128, state_iv, encrypted, lens[i], decrypted);
+		if (memcmp(decrypted, plaintext, lens[i]) != 0
+			|| memcmp(state_iv, next_iv, sizeof(next_iv)) != 0) {
+			error_print();
+			return -1;
+		}
+
+		// in place
+		memcpy(state_iv, iv, sizeof(iv));
+		sm4_cfb_decrypt(&sm4_key, SM4_CFB_128, state_iv, encrypted, lens[i], encrypted);
+		if (memcmp(encrypted, plaintext, lens[i]) != 0
+			|| memcmp(state_iv, next_iv, sizeof(next_iv)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4_cfb() != 1) goto err;
 	if (test_sm4_cfb_test_vectors() != 1) goto err;
 	if (test_sm4_cfb_ctx() != 1) goto err;
+	if (test_sm4_cfb128_decrypt() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
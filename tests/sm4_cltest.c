@@ -11,7 +11,6 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
 #include <gmssl/sm4_cl.h>
 #include <gmssl/hex.h>
 #include <gmssl/rand.h>
@@ -75,67 +74,361 @@ end:
 	return ret;
 }
 
-static int speed_sm4_cl_ctr32_encrypt_blocks(void)
+// nblocks not a multiple of the work group size
+static int test_sm4_cl_ctr32_encrypt_blocks_any_nblocks(void)
 {
-	const uint8_t key[16] = {
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-	};
-	const uint8_t plaintext[16] = {
-		0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef,
-		0xfe, 0xdc, 0xba, 0x98, 0x76, 0x54, 0x32, 0x10,
-	};
-	const uint8_t ciphertext[16] = {
-		0x68, 0x1e, 0xdf, 0x34, 0xd2, 0x06, 0x96, 0x5e,
-		0x86, 0xb3, 0xe9, 0x4f, 0x53, 0x6e, 0x42, 0x46,
-	};
+	SM4_CL_CTX ctx;
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t ctr[16];
+	uint8_t cl_ctr[16];
+	uint8_t buf[16 * 65];
+	uint8_t cpu_buf[16 * 65];
+	uint8_t cl_buf[16 * 65];
+	size_t nblocks[] = { 1, 31, 33, 65 };
+	size_t i;
+	int ret = -1;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	if (sm4_cl_set_encrypt_key(&ctx, key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(nblocks)/sizeof(nblocks[0]); i++) {
+		rand_bytes(buf, sizeof(buf));
+		memcpy(ctr, iv, 16);
+		memcpy(cl_ctr, iv, 16);
+		sm4_ctr32_encrypt_blocks(&sm4_key, ctr, buf, nblocks[i], cpu_buf);
+		if (sm4_cl_ctr32_encrypt_blocks(&ctx, cl_ctr, buf, nblocks[i], cl_buf) != 1) {
+			error_print();
+			goto end;
+		}
+		if (memcmp(cl_buf, cpu_buf, 16 * nblocks[i]) != 0 || memcmp(cl_ctr, ctr, 16) != 0) {
+			error_print();
+			goto end;
+		}
+	}
 
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm4_cl_cleanup(&ctx);
+	return ret;
+}
 
+// the second context loads the cached binary, the third one shares the program of the first
+static int test_sm4_cl_program_cache(void)
+{
+	SM4_CL_CTX ctx[3];
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t key2[16];
+	uint8_t iv[16];
+	uint8_t ctr[16];
+	uint8_t buf[16 * 33];
+	uint8_t cpu_buf[16 * 33];
+	uint8_t cl_buf[16 * 33];
+	size_t nblocks = 33;
+	size_t i;
 	int ret = -1;
+
+	memset(ctx, 0, sizeof(ctx));
+	rand_bytes(key, sizeof(key));
+	rand_bytes(key2, sizeof(key2));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(buf, sizeof(buf));
+
+	if (gmssl_cl_set_cache_dir(".") != 1
+		|| sm4_cl_set_encrypt_key(&ctx[0], key) != 1
+		|| sm4_cl_set_encrypt_key(&ctx[1], key) != 1
+		|| sm4_cl_set_encrypt_key_share(&ctx[2], key2, &ctx[0]) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 3; i++) {
+		sm4_set_encrypt_key(&sm4_key, i < 2 ? key : key2);
+		memcpy(ctr, iv, 16);
+		sm4_ctr32_encrypt_blocks(&sm4_key, ctr, buf, nblocks, cpu_buf);
+		memcpy(ctr, iv, 16);
+		if (sm4_cl_ctr32_encrypt_blocks(&ctx[i], ctr, buf, nblocks, cl_buf) != 1
+			|| memcmp(cl_buf, cpu_buf, 16 * nblocks) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	// the shared program outlives the first context
+	sm4_cl_cleanup(&ctx[0]);
+	memcpy(ctr, iv, 16);
+	if (sm4_cl_ctr32_encrypt_blocks(&ctx[2], ctr, buf, nblocks, cl_buf) != 1
+		|| memcmp(cl_buf, cpu_buf, 16 * nblocks) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	gmssl_cl_set_cache_dir(NULL);
+	for (i = 0; i < 3; i++) {
+		sm4_cl_cleanup(&ctx[i]);
+	}
+	return ret;
+}
+
+typedef struct {
+	uint8_t *out;
+	size_t outlen;
+} STREAM_OUTPUT;
+
+static int stream_output(void *cb_arg, const uint8_t *out, size_t outlen)
+{
+	STREAM_OUTPUT *output = (STREAM_OUTPUT *)cb_arg;
+	memcpy(output->out + output->outlen, out, outlen);
+	output->outlen += outlen;
+	return 1;
+}
+
+static int test_sm4_cl_ctr32_stream(void)
+{
 	SM4_CL_CTX ctx;
+	SM4_CL_STREAM stream;
+	SM4_KEY sm4_key;
+	STREAM_OUTPUT output;
+	uint8_t key[16];
+	uint8_t iv[16];
 	uint8_t ctr[16];
-	size_t nblocks = 1024*1024;
-	uint8_t *buf = NULL;
-	clock_t begin, end;
-	double seconds;
-	size_t i;
+	uint8_t cl_ctr[16];
+	size_t chunk_size = 4096;
+	size_t len = 5 * 4096 + 1000 + 7; // more chunks than slots and a partial block
+	uint8_t *in = NULL;
+	uint8_t *out = NULL;
+	size_t off, n;
+	int ret = -1;
 
-	if (!(buf = (uint8_t *)malloc(16  * nblocks))) {
+	memset(&stream, 0, sizeof(stream));
+	if (!(in = (uint8_t *)malloc(len)) || !(out = (uint8_t *)malloc(len * 2))) {
 		error_print();
-		return -1;
+		goto end;
 	}
-	for (i = 0; i < nblocks; i++) {
-		memcpy(buf + 16 * i, plaintext, 16);
+	for (off = 0; off < len; off += n) {
+		n = len - off < 256 ? len - off : 256;
+		rand_bytes(in + off, n);
 	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
 
 	if (sm4_cl_set_encrypt_key(&ctx, key) != 1) {
 		error_print();
 		goto end;
 	}
+	output.out = out + len;
+	output.outlen = 0;
+	if (sm4_cl_ctr32_stream_init(&stream, &ctx, iv, chunk_size, stream_output, &output) != 1) {
+		error_print();
+		sm4_cl_cleanup(&ctx);
+		goto end;
+	}
+	// odd pieces across the chunks
+	for (off = 0; off < len; off += n) {
+		n = len - off < 1234 ? len - off : 1234;
+		if (sm4_cl_ctr32_stream_update(&stream, in + off, n) != 1) {
+			error_print();
+			goto cleanup;
+		}
+	}
+	if (sm4_cl_ctr32_stream_finish(&stream, cl_ctr) != 1) {
+		error_print();
+		goto cleanup;
+	}
 
-	begin = clock();
-	if (sm4_cl_ctr32_encrypt_blocks(&ctx, ctr, buf, nblocks, buf) != 1) {
+	sm4_set_encrypt_key(&sm4_key, key);
+	memcpy(ctr, iv, 16);
+	sm4_ctr32_encrypt(&sm4_key, ctr, in, len, out);
+	if (output.outlen != len || memcmp(output.out, out, len) != 0 || memcmp(cl_ctr, ctr, 16) != 0) {
+		error_print();
+		goto cleanup;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+cleanup:
+	sm4_cl_ctr32_stream_cleanup(&stream);
+	sm4_cl_cleanup(&ctx);
+end:
+	if (in) free(in);
+	if (out) free(out);
+	return ret;
+}
+
+static int test_sm4_cl_multi_xts(SM4_CL_MULTI *multi)
+{
+	SM4_KEY key1, key2, dec_key1;
+	uint8_t key[32];
+	uint8_t tweak[16];
+	size_t sector_size = 4096;
+	size_t nsectors[] = { 1, 100, 4096 + 3 }; // the last one is shared by the devices
+	size_t len = sector_size * (4096 + 3);
+	uint8_t *in = NULL;
+	uint8_t *out = NULL;
+	uint8_t *buf = NULL;
+	size_t off, n, i;
+	int ret = -1;
+
+	if (!(in = (uint8_t *)malloc(len)) || !(out = (uint8_t *)malloc(len)) || !(buf = (uint8_t *)malloc(len))) {
 		error_print();
 		goto end;
 	}
-	end = clock();
+	for (off = 0; off < len; off += n) {
+		n = len - off < 256 ? len - off : 256;
+		rand_bytes(in + off, n);
+	}
+	rand_bytes(key, sizeof(key));
+	memset(tweak, 0xff, 8); // carry into the high half
+	rand_bytes(tweak + 8, 8);
+	sm4_set_encrypt_key(&key1, key);
+	sm4_set_decrypt_key(&dec_key1, key);
+	sm4_set_encrypt_key(&key2, key + 16);
+
+	for (i = 0; i < sizeof(nsectors)/sizeof(nsectors[0]); i++) {
+		size_t datalen = sector_size * nsectors[i];
 
-	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f-MiB per seconds\n", __FUNCTION__, 16/seconds);
+		sm4_xts_encrypt_sectors(&key1, &key2, tweak, sector_size, in, nsectors[i], out, 1);
+		if (sm4_cl_multi_xts_encrypt_sectors(multi, &key1, &key2, tweak, sector_size, in, nsectors[i], buf) != 1
+			|| memcmp(buf, out, datalen) != 0) {
+			error_print();
+			goto end;
+		}
+		// in place
+		if (sm4_cl_multi_xts_decrypt_sectors(multi, &dec_key1, &key2, tweak, sector_size, buf, nsectors[i], buf) != 1
+			|| memcmp(buf, in, datalen) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	if (sm4_cl_multi_xts_encrypt_sectors(multi, &key1, &key2, tweak, 100, in, 1, buf) != -1) {
+		error_print();
+		goto end;
+	}
 
+	printf("%s() ok\n", __FUNCTION__);
 	ret = 1;
 end:
+	if (in) free(in);
+	if (out) free(out);
 	if (buf) free(buf);
-	sm4_cl_cleanup(&ctx);
+	return ret;
+}
+
+static int test_sm4_cl_multi_gcm(SM4_CL_MULTI *multi)
+{
+	SM4_KEY sm4_key;
+	uint8_t key[16];
+	uint8_t iv[64];
+	uint8_t aad[100];
+	uint8_t tag[16];
+	uint8_t cl_tag[16];
+	size_t ivlens[] = { 12, 64 };
+	size_t inlens[] = { 0, 15, SM4_CL_GHASH_CHUNK_SIZE + 33, 16 * 1024 * 1024 + 7 };
+	size_t len = 16 * 1024 * 1024 + 7;
+	uint8_t *in = NULL;
+	uint8_t *out = NULL;
+	uint8_t *buf = NULL;
+	size_t off, n, i, j;
+	int ret = -1;
+
+	if (!(in = (uint8_t *)malloc(len)) || !(out = (uint8_t *)malloc(len)) || !(buf = (uint8_t *)malloc(len))) {
+		error_print();
+		goto end;
+	}
+	for (off = 0; off < len; off += n) {
+		n = len - off < 256 ? len - off : 256;
+		rand_bytes(in + off, n);
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(aad, sizeof(aad));
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	for (i = 0; i < sizeof(ivlens)/sizeof(ivlens[0]); i++) {
+		for (j = 0; j < sizeof(inlens)/sizeof(inlens[0]); j++) {
+			sm4_gcm_encrypt(&sm4_key, iv, ivlens[i], aad, sizeof(aad), in, inlens[j], out, sizeof(tag), tag);
+			if (sm4_cl_multi_gcm_encrypt(multi, &sm4_key, iv, ivlens[i], aad, sizeof(aad),
+					in, inlens[j], buf, sizeof(cl_tag), cl_tag) != 1
+				|| memcmp(buf, out, inlens[j]) != 0
+				|| memcmp(cl_tag, tag, sizeof(tag)) != 0) {
+				error_print();
+				goto end;
+			}
+			if (sm4_cl_multi_gcm_decrypt(multi, &sm4_key, iv, ivlens[i], aad, sizeof(aad),
+					buf, inlens[j], tag, sizeof(tag), buf) != 1
+				|| memcmp(buf, in, inlens[j]) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+
+	// a wrong tag and the plaintext is not released
+	tag[0] ^= 1;
+	if (sm4_cl_multi_gcm_decrypt(multi, &sm4_key, iv, 12, aad, sizeof(aad), out, len, tag, sizeof(tag), buf) != -1
+		|| buf[0] != 0 || buf[len - 1] != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (in) free(in);
+	if (out) free(out);
+	if (buf) free(buf);
+	return ret;
+}
+
+static int test_sm4_cl_multi(void)
+{
+	SM4_CL_MULTI multi;
+	size_t i;
+	int ret = -1;
+
+	if (sm4_cl_multi_init(&multi, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < multi.num_devices; i++) {
+		if (multi.devices[i].rate[SM4_CL_MULTI_XTS] <= 0 || multi.devices[i].rate[SM4_CL_MULTI_GCM] <= 0) {
+			error_print();
+			goto end;
+		}
+	}
+	if (multi.cpu_rate[SM4_CL_MULTI_XTS] <= 0 || multi.cpu_rate[SM4_CL_MULTI_GCM] <= 0) {
+		error_print();
+		goto end;
+	}
+	if (test_sm4_cl_multi_xts(&multi) != 1
+		|| test_sm4_cl_multi_gcm(&multi) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm4_cl_multi_cleanup(&multi);
 	return ret;
 }
 
 int main(void)
 {
 	if (test_sm4_cl_ctr32_encrypt_blocks() != 1) goto err;
-#if ENABLE_TEST_SPEED
-	if (speed_sm4_cl_ctr32_encrypt_blocks() != 1) goto err;
-#endif
+	if (test_sm4_cl_ctr32_encrypt_blocks_any_nblocks() != 1) goto err;
+	if (test_sm4_cl_program_cache() != 1) goto err;
+	if (test_sm4_cl_ctr32_stream() != 1) goto err;
+	if (test_sm4_cl_multi() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
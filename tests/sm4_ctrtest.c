@@ -356,6 +356,60 @@ static int test_sm4_ctr_ctx_multi_updates(void)
 	return 1;
 }
 
+// the update lengths run across the look-ahead keystream and past SM4_CTR_KEYSTREAM_BLOCKS
+static int test_sm4_ctr32_ctx_multi_updates(void)
+{
+	SM4_KEY sm4_key;
+	SM4_CTR_CTX ctx;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t ctr[16];
+	uint8_t mbuf[16 * 150];
+	uint8_t cbuf[16 * 151];
+	uint8_t buf[16 * 150];
+	size_t lens[] = { 1, 5, 17, 80, 300, 3, 256, 16, 7, 512, 200, 1000 };
+	size_t mlen = 0;
+	size_t clen = 0;
+	size_t len;
+	int i;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(mbuf, sizeof(mbuf));
+	// the 32-bit counter wraps in the middle of the data
+	iv[12] = iv[13] = iv[14] = 0xff;
+	iv[15] = 0xf0;
+
+	if (sm4_ctr32_encrypt_init(&ctx, key, iv) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]) && mlen + lens[i] <= sizeof(mbuf); i++) {
+		if (sm4_ctr32_encrypt_update(&ctx, mbuf + mlen, lens[i], cbuf + clen, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		mlen += lens[i];
+		clen += len;
+	}
+	if (sm4_ctr32_encrypt_finish(&ctx, cbuf + clen, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	clen += len;
+
+	sm4_set_encrypt_key(&sm4_key, key);
+	memcpy(ctr, iv, sizeof(iv));
+	sm4_ctr32_encrypt(&sm4_key, ctr, mbuf, mlen, buf);
+	if (clen != mlen || memcmp(cbuf, buf, mlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4_ctr() != 1) goto err;
@@ -363,6 +417,7 @@ int main(void)
 	if (test_sm4_ctr_with_carray() != 1) goto err;
 	if (test_sm4_ctr_ctx() != 1) goto err;
 	if (test_sm4_ctr_ctx_multi_updates() != 1) goto err;
+	if (test_sm4_ctr32_ctx_multi_updates() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
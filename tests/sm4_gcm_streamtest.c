@@ -0,0 +1,210 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/sm4.h>
+#include <gmssl/rand.h>
+#include <gmssl/error.h>
+#include <gmssl/sm4_gcm_stream.h>
+
+
+#define SEGMENT_SIZE	4096
+#define SEGLEN		(SEGMENT_SIZE + SM4_GCM_STREAM_TAG_SIZE)
+
+// the whole stream at once on 1, 4 and all threads, and in runs of 7 segments, give the same container
+static int test_sm4_gcm_stream(void)
+{
+	uint8_t key[16];
+	uint8_t header[SM4_GCM_STREAM_HEADER_SIZE];
+	SM4_GCM_STREAM_CTX enc_ctx;
+	SM4_GCM_STREAM_CTX dec_ctx;
+	size_t lens[] = { 0, 1, SEGMENT_SIZE, SEGMENT_SIZE * 300, SEGMENT_SIZE * 300 + 100 };
+	int threads[] = { 1, 4, 0 };
+	size_t maxlen = SEGMENT_SIZE * 301;
+	uint8_t *plaintext = NULL;
+	uint8_t *encrypted = NULL;
+	uint8_t *buf = NULL;
+	uint8_t *decrypted = NULL;
+	size_t encryptedlen, outlen, len, off, run;
+	uint64_t plainlen;
+	size_t i, j;
+	int ret = -1;
+
+	if (!(plaintext = (uint8_t *)malloc(maxlen))
+		|| !(encrypted = (uint8_t *)malloc(maxlen + SM4_GCM_STREAM_TAG_SIZE * 302))
+		|| !(buf = (uint8_t *)malloc(maxlen + SM4_GCM_STREAM_TAG_SIZE * 302))
+		|| !(decrypted = (uint8_t *)malloc(maxlen))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(plaintext, maxlen);
+
+	for (i = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		if (sm4_gcm_stream_encrypt_init(&enc_ctx, key, SEGMENT_SIZE, header) != 1
+			|| sm4_gcm_stream_decrypt_init(&dec_ctx, key, header) != 1) {
+			error_print();
+			goto end;
+		}
+		if (sm4_gcm_stream_encrypt_segments(&enc_ctx, 0, plaintext, lens[i], 1, encrypted, &encryptedlen, 1) != 1
+			|| sm4_gcm_stream_plaintext_size(SEGMENT_SIZE, encryptedlen, &plainlen) != 1
+			|| plainlen != lens[i]) {
+			error_print();
+			goto end;
+		}
+
+		for (j = 0; j < sizeof(threads)/sizeof(threads[0]); j++) {
+			if (sm4_gcm_stream_encrypt_segments(&enc_ctx, 0, plaintext, lens[i], 1, buf, &outlen, threads[j]) != 1
+				|| outlen != encryptedlen
+				|| memcmp(buf, encrypted, encryptedlen) != 0) {
+				error_print();
+				goto end;
+			}
+			if (sm4_gcm_stream_decrypt_segments(&dec_ctx, 0, encrypted, encryptedlen, 1, decrypted, &outlen, threads[j]) != 1
+				|| outlen != lens[i]
+				|| memcmp(decrypted, plaintext, lens[i]) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+
+		// runs of whole segments, the final run ends the stream
+		for (off = 0, len = 0; ; off += run, len += outlen) {
+			run = SEGMENT_SIZE * 7;
+			if (run >= lens[i] - off) {
+				run = lens[i] - off;
+				if (sm4_gcm_stream_encrypt_segments(&enc_ctx, off / SEGMENT_SIZE, plaintext + off, run, 1,
+					buf + len, &outlen, 0) != 1) {
+					error_print();
+					goto end;
+				}
+				len += outlen;
+				break;
+			}
+			if (sm4_gcm_stream_encrypt_segments(&enc_ctx, off / SEGMENT_SIZE, plaintext + off, run, 0,
+				buf + len, &outlen, 0) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		if (len != encryptedlen || memcmp(buf, encrypted, encryptedlen) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(plaintext);
+	free(encrypted);
+	free(buf);
+	free(decrypted);
+	return ret;
+}
+
+// a wrong key, a modified header, a flipped bit, truncation and reordering are all rejected
+static int test_sm4_gcm_stream_tamper(void)
+{
+	uint8_t key[16];
+	uint8_t header[SM4_GCM_STREAM_HEADER_SIZE];
+	uint8_t bad_header[SM4_GCM_STREAM_HEADER_SIZE];
+	SM4_GCM_STREAM_CTX ctx;
+	size_t nsegs = 20;
+	size_t len = SEGMENT_SIZE * nsegs + 10;
+	uint8_t *plaintext = NULL;
+	uint8_t *encrypted = NULL;
+	uint8_t *decrypted = NULL;
+	size_t encryptedlen, outlen;
+	int ret = -1;
+
+	if (!(plaintext = (uint8_t *)malloc(len))
+		|| !(encrypted = (uint8_t *)malloc(len + SM4_GCM_STREAM_TAG_SIZE * (nsegs + 1)))
+		|| !(decrypted = (uint8_t *)malloc(len))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(plaintext, len);
+
+	if (sm4_gcm_stream_encrypt_init(&ctx, key, SEGMENT_SIZE, header) != 1
+		|| sm4_gcm_stream_encrypt_segments(&ctx, 0, plaintext, len, 1, encrypted, &encryptedlen, 0) != 1) {
+		error_print();
+		goto end;
+	}
+
+	memcpy(bad_header, header, sizeof(header));
+	bad_header[10] ^= 1; // segment size
+	if (sm4_gcm_stream_decrypt_init(&ctx, key, bad_header) == 1) {
+		error_print();
+		goto end;
+	}
+	key[0] ^= 1;
+	if (sm4_gcm_stream_decrypt_init(&ctx, key, header) == 1) {
+		error_print();
+		goto end;
+	}
+	key[0] ^= 1;
+	if (sm4_gcm_stream_decrypt_init(&ctx, key, header) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// random access to segments 5..9
+	if (sm4_gcm_stream_decrypt_segments(&ctx, 5, encrypted + SEGLEN * 5, SEGLEN * 5, 0, decrypted, &outlen, 0) != 1
+		|| outlen != SEGMENT_SIZE * 5
+		|| memcmp(decrypted, plaintext + SEGMENT_SIZE * 5, outlen) != 0) {
+		error_print();
+		goto end;
+	}
+	// segments 5..9 at another index
+	if (sm4_gcm_stream_decrypt_segments(&ctx, 4, encrypted + SEGLEN * 5, SEGLEN * 5, 0, decrypted, &outlen, 0) == 1) {
+		error_print();
+		goto end;
+	}
+	// truncated at a segment boundary
+	if (sm4_gcm_stream_decrypt_segments(&ctx, 0, encrypted, SEGLEN * nsegs, 1, decrypted, &outlen, 0) == 1) {
+		error_print();
+		goto end;
+	}
+	// the final, short segment alone
+	if (sm4_gcm_stream_decrypt_segments(&ctx, nsegs, encrypted + SEGLEN * nsegs, encryptedlen - SEGLEN * nsegs, 1,
+		decrypted, &outlen, 0) != 1 || outlen != 10) {
+		error_print();
+		goto end;
+	}
+	encrypted[SEGLEN * 13 + 7] ^= 0x80;
+	if (sm4_gcm_stream_decrypt_segments(&ctx, 0, encrypted, encryptedlen, 1, decrypted, &outlen, 0) == 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(plaintext);
+	free(encrypted);
+	free(decrypted);
+	return ret;
+}
+
+int main(void)
+{
+	if (test_sm4_gcm_stream() != 1) goto err;
+	if (test_sm4_gcm_stream_tamper() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
@@ -246,11 +246,73 @@ static int test_sm4_ofb_ctx(void)
 	return 1;
 }
 
+static int test_sm4_ofb_stream(void)
+{
+	SM4_KEY sm4_key;
+	SM4_OFB_STREAM *stream;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t state_iv[16];
+	uint8_t plaintext[16 * 100];
+	uint8_t encrypted[sizeof(plaintext)];
+	uint8_t buf[sizeof(plaintext)];
+	size_t lens[] = { 1, 15, 16, 33, 100, 7, 300, 256, 5, 16 * 30 };
+	int background;
+	size_t len;
+	size_t i;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(plaintext, sizeof(plaintext));
+
+	sm4_set_encrypt_key(&sm4_key, key);
+	memcpy(state_iv, iv, sizeof(iv));
+	sm4_ofb_encrypt(&sm4_key, state_iv, plaintext, sizeof(plaintext), encrypted);
+
+	if (sm4_ofb_stream_new(key, iv, SM4_OFB_STREAM_MIN_BLOCKS - 1, 0) != NULL) {
+		error_print();
+		return -1;
+	}
+
+	for (background = 0; background <= 1; background++) {
+		if (!(stream = sm4_ofb_stream_new(key, iv, SM4_OFB_STREAM_MIN_BLOCKS, background))) {
+			error_print();
+			return -1;
+		}
+		if (!background) {
+			if (sm4_ofb_stream_available(stream) != 0
+				|| sm4_ofb_stream_refill(stream) != 1
+				|| sm4_ofb_stream_available(stream) != 16 * SM4_OFB_STREAM_MIN_BLOCKS) {
+				error_print();
+				return -1;
+			}
+		}
+
+		// with no refill the ring runs dry and the rest is generated inline
+		for (i = 0, len = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+			if (sm4_ofb_stream_encrypt(stream, plaintext + len, lens[i], buf + len) != 1) {
+				error_print();
+				return -1;
+			}
+			len += lens[i];
+		}
+		if (len > sizeof(plaintext) || memcmp(buf, encrypted, len) != 0) {
+			error_print();
+			return -1;
+		}
+		sm4_ofb_stream_free(stream);
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
 	if (test_sm4_ofb() != 1) goto err;
 	if (test_sm4_ofb_test_vectors() != 1) goto err;
 	if (test_sm4_ofb_ctx() != 1) goto err;
+	if (test_sm4_ofb_stream() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -11,13 +11,72 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <stdint.h>
+#include <gmssl/sm4.h>
 #include <gmssl/sm4_rng.h>
 #include <gmssl/error.h>
 
 
+static void be_incr(uint8_t a[16])
+{
+	int i;
+	for (i = 15; i >= 0; i--) {
+		a[i]++;
+		if (a[i]) break;
+	}
+}
+
+// the output should be sm4(K, V + 1) || sm4(K, V + 2) || ... of the state before the request
+static int test_sm4_rng_generate(void)
+{
+	SM4_RNG rng;
+	SM4_KEY sm4_key;
+	uint8_t V[16];
+	uint8_t block[16];
+	uint8_t out[SM4_RNG_MAX_GENERATE_SIZE];
+	size_t outlens[] = { 1, 15, 16, 17, 255, 256, 1000, SM4_RNG_MAX_GENERATE_SIZE };
+	size_t i, j;
+
+	if (sm4_rng_init(&rng, (uint8_t *)"nonce", 5, (uint8_t *)"label", 5) != 1) {
+		error_print();
+		return -1;
+	}
+
+	for (i = 0; i < sizeof(outlens)/sizeof(outlens[0]) * 2; i++) {
+		size_t outlen = outlens[i % (sizeof(outlens)/sizeof(outlens[0]))];
+
+		// the second round crosses the wrap of the low 32 bits of V
+		if (i >= sizeof(outlens)/sizeof(outlens[0])) {
+			memset(rng.V + 8, 0xff, 8);
+			rng.V[15] = 0xf0;
+		}
+
+		sm4_set_encrypt_key(&sm4_key, rng.K);
+		memcpy(V, rng.V, 16);
+
+		if (sm4_rng_generate(&rng, NULL, 0, out, outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		for (j = 0; j < outlen; j += 16) {
+			be_incr(V);
+			sm4_encrypt(&sm4_key, V, block);
+			if (memcmp(out + j, block, outlen - j < 16 ? outlen - j : 16) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 int main(void)
 {
+	if (test_sm4_rng_generate() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
 	error_print();
 	return 1;
 }
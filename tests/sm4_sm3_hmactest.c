@@ -138,6 +138,179 @@ static int test_sm4_cbc_sm3_hmac(void)
 	return 1;
 }
 
+// the stitched functions against separate CBC and SM3 passes, out of place and in place
+static int test_sm4_cbc_sm3_stitch(void)
+{
+	SM4_KEY sm4_key;
+	SM3_CTX sm3_ctx;
+	SM3_CTX ref_ctx;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t iv1[16];
+	uint8_t iv2[16];
+	uint8_t prefix[63];
+	uint8_t plain[1600];
+	uint8_t cipher[1600 + 16 + 32];
+	uint8_t buf[1600];
+	uint8_t dgst[32];
+	uint8_t ref_dgst[32];
+	size_t prefixlens[] = { 0, 1, 13, 63 };
+	size_t nblocks[] = { 1, 11, 12, 13, 16, 37, 100 };
+	size_t i, j, k;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(prefix, sizeof(prefix));
+	rand_bytes(plain, sizeof(plain));
+	sm4_set_encrypt_key(&sm4_key, key);
+
+	// the kernel itself, hashing data the same chunk overwrites
+	{
+		uint32_t digest[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+		uint32_t ref_digest[8] = { 1, 2, 3, 4, 5, 6, 7, 8 };
+
+		memcpy(iv1, iv, 16);
+		sm4_cbc_encrypt_blocks(&sm4_key, iv1, plain, 100, cipher);
+		sm3_compress_blocks(ref_digest, plain, 25);
+
+		memcpy(buf, plain, sizeof(plain));
+		memcpy(iv2, iv, 16);
+		sm4_cbc_encrypt_sm3_compress(&sm4_key, iv2, buf, 25, buf, digest, buf);
+		if (memcmp(buf, cipher, 1600) != 0 || memcmp(iv2, iv1, 16) != 0
+			|| memcmp(digest, ref_digest, sizeof(digest)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	for (i = 0; i < sizeof(prefixlens)/sizeof(prefixlens[0]); i++) {
+		for (j = 0; j < sizeof(nblocks)/sizeof(nblocks[0]); j++) {
+			size_t len = nblocks[j] * 16;
+
+			memcpy(iv1, iv, 16);
+			sm4_cbc_encrypt_blocks(&sm4_key, iv1, plain, nblocks[j], cipher);
+
+			// hash the plaintext
+			for (k = 0; k < 2; k++) {
+				if (k) memcpy(buf, plain, len);
+				else memset(buf, 0, sizeof(buf));
+
+				sm3_init(&sm3_ctx);
+				sm3_update(&sm3_ctx, prefix, prefixlens[i]);
+				memcpy(iv2, iv, 16);
+				sm4_cbc_encrypt_sm3_update(&sm4_key, iv2, k ? buf : plain, nblocks[j], buf, &sm3_ctx);
+				sm3_finish(&sm3_ctx, dgst);
+
+				sm3_init(&ref_ctx);
+				sm3_update(&ref_ctx, prefix, prefixlens[i]);
+				sm3_update(&ref_ctx, plain, len);
+				sm3_finish(&ref_ctx, ref_dgst);
+
+				if (memcmp(buf, cipher, len) != 0 || memcmp(iv2, iv1, 16) != 0
+					|| memcmp(dgst, ref_dgst, 32) != 0) {
+					error_print();
+					return -1;
+				}
+			}
+
+			// hash the ciphertext
+			for (k = 0; k < 2; k++) {
+				if (k) memcpy(buf, plain, len);
+				else memset(buf, 0, sizeof(buf));
+
+				sm3_init(&sm3_ctx);
+				sm3_update(&sm3_ctx, prefix, prefixlens[i]);
+				memcpy(iv2, iv, 16);
+				sm4_cbc_encrypt_then_sm3_update(&sm4_key, iv2, k ? buf : plain, nblocks[j], buf, &sm3_ctx);
+				sm3_finish(&sm3_ctx, dgst);
+
+				sm3_init(&ref_ctx);
+				sm3_update(&ref_ctx, prefix, prefixlens[i]);
+				sm3_update(&ref_ctx, cipher, len);
+				sm3_finish(&ref_ctx, ref_dgst);
+
+				if (memcmp(buf, cipher, len) != 0 || memcmp(iv2, iv1, 16) != 0
+					|| memcmp(dgst, ref_dgst, 32) != 0) {
+					error_print();
+					return -1;
+				}
+			}
+		}
+	}
+
+	// decrypt and hash a prefix of the plaintext
+	sm4_set_decrypt_key(&sm4_key, key);
+	for (j = 0; j < sizeof(nblocks)/sizeof(nblocks[0]); j++) {
+		size_t len = nblocks[j] * 16;
+		size_t sm3_len = len - len / 3;
+
+		memcpy(buf, cipher, len);
+		memcpy(iv2, iv, 16);
+		sm3_init(&sm3_ctx);
+		sm4_cbc_decrypt_sm3_update(&sm4_key, iv2, buf, nblocks[j], buf, &sm3_ctx, sm3_len);
+		sm3_finish(&sm3_ctx, dgst);
+
+		sm3_init(&ref_ctx);
+		sm3_update(&ref_ctx, plain, sm3_len);
+		sm3_finish(&ref_ctx, ref_dgst);
+
+		if (memcmp(buf, plain, len) != 0 || memcmp(dgst, ref_dgst, 32) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	// the AEAD context takes the stitched path for large updates
+	{
+		SM4_CBC_SM3_HMAC_CTX aead_ctx;
+		SM3_HMAC_CTX sm3_hmac_ctx;
+		uint8_t aead_key[48];
+		uint8_t tmp[1600 + 16 + 32];
+		uint8_t *out = cipher;
+		size_t tmplen;
+		size_t outlen;
+		size_t cipherlen;
+		size_t inlens[] = { 1000, 7, 593 };
+
+		rand_bytes(aead_key, sizeof(aead_key));
+		if (sm4_cbc_sm3_hmac_encrypt_init(&aead_ctx, aead_key, iv, NULL, 0) != 1) {
+			error_print();
+			return -1;
+		}
+		for (i = 0, k = 0; k < sizeof(inlens)/sizeof(inlens[0]); i += inlens[k], k++) {
+			if (sm4_cbc_sm3_hmac_encrypt_update(&aead_ctx, plain + i, inlens[k], out, &outlen) != 1) {
+				error_print();
+				return -1;
+			}
+			out += outlen;
+		}
+		cipherlen = out - cipher;
+		if (sm4_cbc_sm3_hmac_encrypt_finish(&aead_ctx, out, &outlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cipherlen += outlen;
+
+		sm4_set_encrypt_key(&sm4_key, aead_key);
+		if (sm4_cbc_padding_encrypt(&sm4_key, iv, plain, sizeof(plain), tmp, &tmplen) != 1) {
+			error_print();
+			return -1;
+		}
+		sm3_hmac_init(&sm3_hmac_ctx, aead_key + 16, 32);
+		sm3_hmac_update(&sm3_hmac_ctx, tmp, tmplen);
+		sm3_hmac_finish(&sm3_hmac_ctx, tmp + tmplen);
+		tmplen += 32;
+
+		if (cipherlen != tmplen || memcmp(cipher, tmp, tmplen) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm4_ctr_sm3_hmac(void)
 {
 	SM4_CTR_SM3_HMAC_CTX aead_ctx;
@@ -263,6 +436,7 @@ static int test_sm4_ctr_sm3_hmac(void)
 int main(void)
 {
 	if (test_sm4_cbc_sm3_hmac() != 1) goto err;
+	if (test_sm4_cbc_sm3_stitch() != 1) goto err;
 	if (test_sm4_ctr_sm3_hmac() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
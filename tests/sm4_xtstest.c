@@ -156,10 +156,88 @@ static int test_sm4_xts_test_vectors(void)
 	return 1;
 }
 
+// the sectors one by one with sm4_xts_encrypt(), the tweak carries across bytes
+static int test_sm4_xts_sectors(void)
+{
+	SM4_KEY enc_key1;
+	SM4_KEY dec_key1;
+	SM4_KEY key2;
+	uint8_t key[32];
+	uint8_t tweak[16];
+	uint8_t T[16];
+	size_t sector_size = 512;
+	size_t nsectors = 2048 + 3; // more than one thread gets
+	size_t len = sector_size * nsectors;
+	uint8_t *plaintext = NULL;
+	uint8_t *encrypted = NULL;
+	uint8_t *buf = NULL;
+	int threads[] = { 1, 4, 0 };
+	size_t i, j;
+	int ret = -1;
+
+	if (!(plaintext = (uint8_t *)malloc(len))
+		|| !(encrypted = (uint8_t *)malloc(len))
+		|| !(buf = (uint8_t *)malloc(len))) {
+		error_print();
+		goto end;
+	}
+	rand_bytes(key, sizeof(key));
+	rand_bytes(plaintext, len);
+	memset(tweak, 0, sizeof(tweak));
+	tweak[0] = 0xfe;
+	tweak[1] = 0xff;
+	tweak[2] = 0x12;
+
+	sm4_set_encrypt_key(&enc_key1, key);
+	sm4_set_decrypt_key(&dec_key1, key);
+	sm4_set_encrypt_key(&key2, key + 16);
+
+	memcpy(T, tweak, 16);
+	for (i = 0; i < nsectors; i++) {
+		sm4_xts_encrypt(&enc_key1, &key2, T, plaintext + sector_size * i, sector_size, encrypted + sector_size * i);
+		for (j = 0; j < 16; j++) {
+			if (++T[j]) break;
+		}
+	}
+
+	for (i = 0; i < sizeof(threads)/sizeof(threads[0]); i++) {
+		if (sm4_xts_encrypt_sectors(&enc_key1, &key2, tweak, sector_size, plaintext, nsectors, buf, threads[i]) != 1) {
+			error_print();
+			goto end;
+		}
+		if (memcmp(buf, encrypted, len) != 0) {
+			error_print();
+			goto end;
+		}
+		// in place
+		if (sm4_xts_decrypt_sectors(&dec_key1, &key2, tweak, sector_size, buf, nsectors, buf, threads[i]) != 1) {
+			error_print();
+			goto end;
+		}
+		if (memcmp(buf, plaintext, len) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	if (sm4_xts_encrypt_sectors(&enc_key1, &key2, tweak, 16 + 8, plaintext, 1, buf, 1) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (plaintext) free(plaintext);
+	if (encrypted) free(encrypted);
+	if (buf) free(buf);
+	return ret;
+}
+
 int main(void)
 {
 	if (test_sm4_xts() != 1) goto err;
 	if (test_sm4_xts_test_vectors() != 1) goto err;
+	if (test_sm4_xts_sectors() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
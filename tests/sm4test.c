@@ -12,11 +12,12 @@
 #include <string.h>
 #include <stdlib.h>
 #include <assert.h>
-#include <time.h>
 #include <gmssl/hex.h>
 #include <gmssl/sm4.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
 #include <gmssl/rand.h>
+#include <gmssl/cpu.h>
 
 
 static int test_sm4(void)
@@ -181,169 +182,262 @@ static int test_sm4_ctr32_encrypt_blocks(void)
 }
 
 
+typedef void (*encrypt_blocks_func)(const SM4_KEY *key, const uint8_t *in, size_t nblocks, uint8_t *out);
+typedef void (*ctr32_encrypt_blocks_func)(const SM4_KEY *key, uint8_t ctr[16], const uint8_t *in, size_t nblocks, uint8_t *out);
 
-
-
-static int speed_sm4_encrypt(void)
+// compare a bulk kernel with `sm4_encrypt` for every length covering the parallel and tail paths
+static int check_sm4_blocks_kernel(const char *name, encrypt_blocks_func encrypt_blocks,
+	ctr32_encrypt_blocks_func ctr32_encrypt_blocks)
 {
 	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t buf[16];
-	size_t nbytes = 16 * 1024 * 1024;
-	clock_t begin, end;
-	double seconds;
-	size_t i;
+	uint8_t key[16];
+	uint8_t buf[16 * 136];
+	uint8_t out[16 * 136];
+	uint8_t ref[16 * 136];
+	uint8_t ctr[16];
+	uint8_t ctr_ref[16];
+	size_t nblocks, i, j;
 
-	sm4_set_encrypt_key(&sm4_key, key);
-	for (i = 0; i < nbytes/sizeof(buf); i++) {
-		sm4_encrypt(&sm4_key, buf, buf);
+	rand_bytes(key, sizeof(key));
+	for (i = 0; i < sizeof(buf); i += 16) {
+		rand_bytes(buf + i, 16);
 	}
+	sm4_set_encrypt_key(&sm4_key, key);
 
-	begin = clock();
-	for (i = 0; i < nbytes/sizeof(buf); i++) {
-		sm4_encrypt(&sm4_key, buf, buf);
+	for (nblocks = 0; nblocks <= 136; nblocks++) {
+		for (i = 0; i < nblocks; i++) {
+			sm4_encrypt(&sm4_key, buf + 16 * i, ref + 16 * i);
+		}
+		encrypt_blocks(&sm4_key, buf, nblocks, out);
+		if (memcmp(out, ref, 16 * nblocks) != 0) {
+			fprintf(stderr, "%s: encrypt_blocks(nblocks = %zu) failed\n", name, nblocks);
+			return -1;
+		}
+
+		// counter wraps around 2^32 inside the parallel path
+		memset(ctr, 0xa5, 12);
+		PUTU32(ctr + 12, 0xfffffff0);
+		memcpy(ctr_ref, ctr, 16);
+		for (i = 0; i < nblocks; i++) {
+			sm4_encrypt(&sm4_key, ctr_ref, ref + 16 * i);
+			for (j = 0; j < 16; j++) {
+				ref[16 * i + j] ^= buf[16 * i + j];
+			}
+			PUTU32(ctr_ref + 12, GETU32(ctr_ref + 12) + 1);
+		}
+		memcpy(out, buf, sizeof(buf));
+		ctr32_encrypt_blocks(&sm4_key, ctr, out, nblocks, out); // in-place
+		if (memcmp(out, ref, 16 * nblocks) != 0 || memcmp(ctr, ctr_ref, 16) != 0) {
+			fprintf(stderr, "%s: ctr32_encrypt_blocks(nblocks = %zu) failed\n", name, nblocks);
+			return -1;
+		}
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, nbytes/(1024 * 1024 *seconds));
-
 	return 1;
 }
 
-static int speed_sm4_encrypt_blocks(void)
+typedef void (*cbc_decrypt_blocks_func)(const SM4_KEY *key, uint8_t iv[16], const uint8_t *in, size_t nblocks, uint8_t *out);
+
+static int check_sm4_cbc_decrypt_kernel(const char *name, cbc_decrypt_blocks_func cbc_decrypt_blocks)
 {
 	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
+	uint8_t key[16];
+	uint8_t buf[16 * 136];
+	uint8_t out[16 * 136];
+	uint8_t ref[16 * 136];
+	uint8_t iv[16];
+	uint8_t iv_ref[16];
+	size_t nblocks, i, j;
 
-	sm4_set_encrypt_key(&sm4_key, key);
-	for (i = 0; i < 4096; i++) {
-		sm4_encrypt_blocks(&sm4_key, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	for (i = 0; i < sizeof(buf); i += 16) {
+		rand_bytes(buf + i, 16);
 	}
+	sm4_set_decrypt_key(&sm4_key, key);
 
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_encrypt_blocks(&sm4_key, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+	for (nblocks = 0; nblocks <= 136; nblocks++) {
+		memcpy(iv_ref, iv, 16);
+		for (i = 0; i < nblocks; i++) {
+			sm4_encrypt(&sm4_key, buf + 16 * i, ref + 16 * i);
+			for (j = 0; j < 16; j++) {
+				ref[16 * i + j] ^= i ? buf[16 * (i - 1) + j] : iv_ref[j];
+			}
+		}
+		if (nblocks) {
+			memcpy(iv_ref, buf + 16 * (nblocks - 1), 16);
+		}
+
+		memcpy(out, buf, sizeof(buf));
+		cbc_decrypt_blocks(&sm4_key, iv, out, nblocks, out); // in-place
+		if (memcmp(out, ref, 16 * nblocks) != 0 || memcmp(iv, iv_ref, 16) != 0) {
+			fprintf(stderr, "%s: cbc_decrypt_blocks(nblocks = %zu) failed\n", name, nblocks);
+			return -1;
+		}
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
-
 	return 1;
 }
 
-static int speed_sm4_cbc_encrypt_blocks(void)
+static int test_sm4_encrypt_blocks_kernels(void)
 {
-	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t iv[16];
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
+	uint64_t cpu = gmssl_cpu_features();
 
-	sm4_set_encrypt_key(&sm4_key, key);
+	(void)cpu;
 
-	for (i = 0; i < 4096; i++) {
-		sm4_cbc_encrypt_blocks(&sm4_key, iv, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+	if (check_sm4_blocks_kernel("dispatch", sm4_encrypt_blocks, sm4_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("dispatch", sm4_cbc_decrypt_blocks) != 1) {
+		error_print();
+		return -1;
 	}
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_cbc_encrypt_blocks(&sm4_key, iv, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+#ifdef ENABLE_SM4_BITSLICE
+	if (check_sm4_blocks_kernel("bitslice", sm4_bitslice_encrypt_blocks, sm4_bitslice_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("bitslice", sm4_bitslice_cbc_decrypt_blocks) != 1) {
+		error_print();
+		return -1;
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
-
-	return 1;
-}
-
-static int speed_sm4_cbc_decrypt_blocks(void)
-{
-	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t iv[16];
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
-
-	sm4_set_decrypt_key(&sm4_key, key);
-
-	for (i = 0; i < 4096; i++) {
-		sm4_cbc_decrypt_blocks(&sm4_key, iv, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+#endif
+#ifdef ENABLE_SM4_AESNI
+	if ((cpu & (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)) == (GMSSL_CPU_AESNI|GMSSL_CPU_SSSE3)
+		&& (check_sm4_blocks_kernel("aesni", sm4_aesni_encrypt_blocks, sm4_aesni_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("aesni", sm4_aesni_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
 	}
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_cbc_decrypt_blocks(&sm4_key, iv, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+#endif
+#ifdef ENABLE_SM4_AVX2
+	if ((cpu & GMSSL_CPU_AVX2)
+		&& (check_sm4_blocks_kernel("avx2", sm4_avx2_encrypt_blocks, sm4_avx2_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("avx2", sm4_avx2_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
-
-	return 1;
-}
-
-static int speed_sm4_ctr_encrypt_blocks(void)
-{
-	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t ctr[16];
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
-
-	sm4_set_encrypt_key(&sm4_key, key);
-	rand_bytes(ctr, sizeof(ctr));
-
-	for (i = 0; i < 4096; i++) {
-		sm4_ctr_encrypt_blocks(&sm4_key, ctr, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+#endif
+#ifdef ENABLE_SM4_AVX512
+	if ((cpu & (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_GFNI)) == (GMSSL_CPU_AVX512F|GMSSL_CPU_AVX512BW|GMSSL_CPU_GFNI)
+		&& (check_sm4_blocks_kernel("avx512", sm4_avx512_encrypt_blocks, sm4_avx512_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("avx512", sm4_avx512_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
 	}
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_ctr_encrypt_blocks(&sm4_key, ctr, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+#endif
+#ifdef ENABLE_SM4_ARM64
+	if ((cpu & GMSSL_CPU_NEON)
+		&& (check_sm4_blocks_kernel("arm64", sm4_arm64_encrypt_blocks, sm4_arm64_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("arm64", sm4_arm64_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
+#endif
+#ifdef ENABLE_SM4_CE
+	if ((cpu & GMSSL_CPU_ARM_SM4)
+		&& (check_sm4_blocks_kernel("ce", sm4_ce_encrypt_blocks, sm4_ce_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("ce", sm4_ce_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
+	}
+#endif
+#ifdef ENABLE_SM4_RISCV
+	if ((cpu & GMSSL_CPU_RISCV_ZKSED)
+		&& (check_sm4_blocks_kernel("riscv", sm4_riscv_encrypt_blocks, sm4_riscv_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("riscv", sm4_riscv_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
+	}
+#endif
+#ifdef ENABLE_SM4_WASM
+	if ((cpu & GMSSL_CPU_WASM_SIMD128)
+		&& (check_sm4_blocks_kernel("wasm", sm4_wasm_encrypt_blocks, sm4_wasm_ctr32_encrypt_blocks) != 1
+		|| check_sm4_cbc_decrypt_kernel("wasm", sm4_wasm_cbc_decrypt_blocks) != 1)) {
+		error_print();
+		return -1;
+	}
+#endif
 
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
-static int speed_sm4_ctr32_encrypt_blocks(void)
+
+static int test_sm4_multi_key(void)
 {
-	SM4_KEY sm4_key;
-	uint8_t key[16] = {0};
-	uint8_t ctr[16];
-	uint32_t buf[1024];
-	clock_t begin, end;
-	double seconds;
-	int i;
+	uint64_t cpu = gmssl_cpu_features();
+	uint8_t user_keys[16 * 37];
+	SM4_KEY keys[37];
+	SM4_KEY key;
+	SM4_MULTI_KEY_JOB jobs[37];
+	uint8_t in[16 * 4 * 37];
+	uint8_t out[16 * 4 * 37];
+	uint8_t buf[16 * 4 * 37];
+	size_t nblocks = 0;
+	size_t i;
 
-	sm4_set_encrypt_key(&sm4_key, key);
-	rand_bytes(ctr, sizeof(ctr));
+	(void)cpu;
+
+	rand_bytes(user_keys, sizeof(user_keys));
+	rand_bytes(in, sizeof(in));
 
-	for (i = 0; i < 4096; i++) {
-		sm4_ctr32_encrypt_blocks(&sm4_key, ctr, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+	sm4_set_encrypt_key_multi(keys, user_keys, 37);
+	for (i = 0; i < 37; i++) {
+		sm4_set_encrypt_key(&key, user_keys + 16 * i);
+		if (memcmp(&keys[i], &key, sizeof(SM4_KEY)) != 0) {
+			error_print();
+			return -1;
+		}
 	}
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		sm4_ctr32_encrypt_blocks(&sm4_key, ctr, (uint8_t *)buf, sizeof(buf)/16, (uint8_t *)buf);
+
+	// jobs of 0 to 4 blocks, the last one in place
+	for (i = 0; i < 37; i++) {
+		jobs[i].key = &keys[i];
+		jobs[i].in = in + 16 * nblocks;
+		jobs[i].out = out + 16 * nblocks;
+		jobs[i].nblocks = i % 5;
+		nblocks += i % 5;
+	}
+	memcpy(out + 16 * (nblocks - jobs[36].nblocks), jobs[36].in, 16 * jobs[36].nblocks);
+	jobs[36].in = jobs[36].out;
+
+	sm4_encrypt_multi_key(jobs, 37);
+	nblocks = 0;
+	for (i = 0; i < 37; i++) {
+		sm4_encrypt_blocks(&keys[i], in + 16 * nblocks, jobs[i].nblocks, buf);
+		if (memcmp(jobs[i].out, buf, 16 * jobs[i].nblocks) != 0) {
+			error_print();
+			return -1;
+		}
+		nblocks += jobs[i].nblocks;
 	}
-	end = clock();
 
-	seconds = (double)(end - begin)/ CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f MiB per second\n", __FUNCTION__, 16/seconds);
+#ifdef ENABLE_SM4_AVX2
+	if (cpu & GMSSL_CPU_AVX2) {
+		SM4_KEY *key_ptrs[8];
+		const uint8_t *user_key_ptrs[8];
+		const SM4_KEY *enc_key_ptrs[8];
+		const uint8_t *in_ptrs[8];
+		uint8_t *out_ptrs[8];
+
+		for (i = 0; i < 8; i++) {
+			key_ptrs[i] = &keys[7 - i];
+			user_key_ptrs[i] = user_keys + 16 * (7 - i);
+			enc_key_ptrs[i] = &keys[i];
+			in_ptrs[i] = in + 16 * 3 * i;
+			out_ptrs[i] = out + 16 * i;
+		}
+		memset(keys, 0, sizeof(SM4_KEY) * 8);
+		sm4_avx2_set_encrypt_key_multi(key_ptrs, user_key_ptrs);
+		sm4_avx2_encrypt_multi_key(enc_key_ptrs, in_ptrs, out_ptrs);
+
+		for (i = 0; i < 8; i++) {
+			sm4_set_encrypt_key(&key, user_keys + 16 * i);
+			sm4_encrypt(&key, in + 16 * 3 * i, buf);
+			if (memcmp(&keys[i], &key, sizeof(SM4_KEY)) != 0
+				|| memcmp(out + 16 * i, buf, 16) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+#endif
 
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
@@ -354,14 +448,8 @@ int main(void)
 	if (test_sm4() != 1) goto err;
 	if (test_sm4_encrypt_blocks() != 1) goto err;
 	if (test_sm4_ctr32_encrypt_blocks() != 1) goto err;
-#if ENABLE_TEST_SPEED
-	if (speed_sm4_encrypt() != 1) goto err;
-	if (speed_sm4_encrypt_blocks() != 1) goto err;
-	if (speed_sm4_cbc_encrypt_blocks() != 1) goto err;
-	if (speed_sm4_cbc_decrypt_blocks() != 1) goto err;
-	if (speed_sm4_ctr_encrypt_blocks() != 1) goto err;
-	if (speed_sm4_ctr32_encrypt_blocks() != 1) goto err;
-#endif
+	if (test_sm4_encrypt_blocks_kernels() != 1) goto err;
+	if (test_sm4_multi_key() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
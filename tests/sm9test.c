@@ -73,6 +73,7 @@ int test_sm9_z256_fp() {
 	sm9_z256_modp_from_mont(y, y);
 	sm9_z256_modp_mont_pow(r, x, y); sm9_z256_modp_from_mont(r, r); if (!sm9_z256_equ_hex(r, hex_fp_pow)) goto err; ++j;
 	sm9_z256_modp_mont_inv(r, x);    sm9_z256_modp_from_mont(r, r); if (!sm9_z256_equ_hex(r, hex_fp_inv)) goto err; ++j;
+	sm9_z256_modp_mont_inv_exp(r, x); sm9_z256_modp_from_mont(r, r); if (!sm9_z256_equ_hex(r, hex_fp_inv)) goto err; ++j;
 
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
@@ -107,6 +108,7 @@ int test_sm9_z256_fn() {
 	sm9_z256_modn_mul(r, x, y); if (!sm9_z256_equ_hex(r, hex_fn_mul)) goto err; ++j;
 	sm9_z256_modn_pow(r, x, y); if (!sm9_z256_equ_hex(r, hex_fn_pow)) goto err; ++j;
 	sm9_z256_modn_inv(r, x);    if (!sm9_z256_equ_hex(r, hex_fn_inv)) goto err; ++j;
+	sm9_z256_modn_inv_exp(r, x); if (!sm9_z256_equ_hex(r, hex_fn_inv)) goto err; ++j;
 
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
@@ -339,6 +341,7 @@ int test_sm9_z256_fp12() {
 	sm9_z256_fp12_t y;
 	sm9_z256_fp12_t r;
 	sm9_z256_fp12_t s;
+	sm9_z256_fp12_t T[SM9_Z256_FP12_COMB_TABLE_SIZE];
 	sm9_z256_t k;
 	int j = 1;
 
@@ -354,6 +357,8 @@ int test_sm9_z256_fp12() {
 	sm9_z256_fp12_sqr(r, x);    sm9_z256_fp12_from_hex(s, hex_fp12_sqr); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
 	sm9_z256_fp12_inv(r, x);    sm9_z256_fp12_from_hex(s, hex_fp12_inv); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
 	sm9_z256_fp12_pow(r, x, k); sm9_z256_fp12_from_hex(s, hex_fp12_pow); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
+	sm9_z256_fp12_pow_comb_pre_compute(T, x);
+	sm9_z256_fp12_pow_comb(r, T, k); if (!sm9_z256_fp12_equ(r, s)) goto err; ++j;
 
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
@@ -497,6 +502,35 @@ err:
 	return -1;
 }
 
+// the Booth windows of the fixed-base table against the generic multiplication
+static int test_sm9_z256_twist_point_mul_generator(void)
+{
+	SM9_Z256_TWIST_POINT R;
+	SM9_Z256_TWIST_POINT S;
+	sm9_z256_t k;
+	int i;
+
+	for (i = 0; i < 8; i++) {
+		switch (i) {
+		case 0: sm9_z256_set_zero(k); break;
+		case 1: sm9_z256_set_one(k); break;
+		case 2: sm9_z256_sub(k, sm9_z256_order(), k); break; // n - 1
+		case 3: sm9_z256_set_zero(k); k[0] = 64; break; // largest digit of the first window
+		default: sm9_z256_rand_range(k, sm9_z256_order());
+		}
+		sm9_z256_twist_point_mul_generator(&R, k);
+		sm9_z256_twist_point_mul(&S, k, sm9_z256_twist_generator());
+		if (!sm9_z256_twist_point_equ(&R, &S)) {
+			printf("%s test %d failed\n", __FUNCTION__, i);
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 #define hex_pairing1 \
 	"4e378fb5561cd0668f906b731ac58fee25738edf09cadc7a29c0abc0177aea6d\n" \
 	"28b3404a61908f5d6198815c99af1990c8af38655930058c28c21bb539ce0000\n" \
@@ -554,6 +588,109 @@ err:
 	"934FDDA6D3AB48C8571CE2354B79742AA498CB8CDDE6BD1FA5946345A1A652F6"
 
 
+// more pairs than SM9_Z256_PAIRING_MULTI_MAX
+static int test_sm9_z256_pairing_multi(void)
+{
+	SM9_Z256_TWIST_POINT Q[SM9_Z256_PAIRING_MULTI_MAX + 1];
+	SM9_Z256_POINT P[SM9_Z256_PAIRING_MULTI_MAX + 1];
+	sm9_z256_t k;
+	sm9_z256_fp12_t r, s, t;
+	size_t n = SM9_Z256_PAIRING_MULTI_MAX + 1;
+	size_t i;
+
+	sm9_z256_fp12_set_one(s);
+	for (i = 0; i < n; i++) {
+		sm9_z256_rand_range(k, sm9_z256_order());
+		sm9_z256_twist_point_mul_generator(&Q[i], k);
+		sm9_z256_rand_range(k, sm9_z256_order());
+		sm9_z256_point_mul_generator(&P[i], k);
+
+		sm9_z256_pairing(t, &Q[i], &P[i]);
+		sm9_z256_fp12_mul(s, s, t);
+	}
+
+	sm9_z256_pairing_multi(r, Q, P, n);
+	if (!sm9_z256_fp12_equ(r, s)) {
+		error_print();
+		return -1;
+	}
+	sm9_z256_pairing_multi(r, Q, P, 1);
+	sm9_z256_pairing(s, &Q[0], &P[0]);
+	if (!sm9_z256_fp12_equ(r, s)) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// the cyclotomic operations on a pairing value match the generic ones
+static int test_sm9_z256_fp12_cyclotomic(void)
+{
+	SM9_Z256_POINT P;
+	sm9_z256_t k;
+	sm9_z256_fp12_t g, r, s;
+	sm9_z256_fp12_t T[SM9_Z256_FP12_COMB_TABLE_SIZE];
+
+	sm9_z256_rand_range(k, sm9_z256_order());
+	sm9_z256_point_mul_generator(&P, k);
+	sm9_z256_pairing(g, sm9_z256_twist_generator(), &P);
+
+	sm9_z256_fp12_sqr(r, g);
+	sm9_z256_fp12_cyclotomic_sqr(s, g);
+	if (!sm9_z256_fp12_equ(r, s)) {
+		error_print();
+		return -1;
+	}
+
+	sm9_z256_rand_range(k, sm9_z256_order());
+	sm9_z256_fp12_pow(r, g, k);
+	sm9_z256_fp12_cyclotomic_pow(s, g, k);
+	if (!sm9_z256_fp12_equ(r, s)) {
+		error_print();
+		return -1;
+	}
+	sm9_z256_fp12_pow_comb_pre_compute(T, g);
+	sm9_z256_fp12_cyclotomic_pow_comb(s, T, k);
+	if (!sm9_z256_fp12_equ(r, s)) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// lines precomputed for Q, including Q not in affine form
+static int test_sm9_z256_pairing_prepared(void)
+{
+	SM9_Z256_TWIST_POINT Q;
+	SM9_Z256_PREPARED_TWIST_POINT prep;
+	SM9_Z256_POINT P;
+	sm9_z256_t k;
+	sm9_z256_fp12_t r, s;
+	int i;
+
+	for (i = 0; i < 4; i++) {
+		sm9_z256_rand_range(k, sm9_z256_order());
+		sm9_z256_twist_point_mul_generator(&Q, k);
+		sm9_z256_rand_range(k, sm9_z256_order());
+		sm9_z256_point_mul_generator(&P, k);
+
+		sm9_z256_twist_point_prepare(&prep, &Q);
+		sm9_z256_pairing_prepared(r, &prep, &P);
+		sm9_z256_pairing(s, &Q, &P);
+		if (!sm9_z256_fp12_equ(r, s)) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_sm9_z256_pairing_speed(void)
 {
 	SM9_Z256_TWIST_POINT Ppubs = {
@@ -568,6 +705,7 @@ static int test_sm9_z256_pairing_speed(void)
 		{0x0c464cd70a3ea616, 0x1c1c00cbfa602435, 0x631065125c395bbc, 0x21fe8dda4f21e607},
 		{1,0,0,0},
 	};
+	SM9_Z256_PREPARED_TWIST_POINT prep;
 	sm9_z256_fp12_t r;
 
 	clock_t begin, end;
@@ -593,6 +731,16 @@ static int test_sm9_z256_pairing_speed(void)
 	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
 
 	printf("%s: %d pairings per seconds\n", __FUNCTION__, (int)(256/seconds));
+
+	sm9_z256_twist_point_prepare(&prep, &Ppubs);
+	begin = clock();
+	for (i = 0; i < 256; i++) {
+		sm9_z256_pairing_prepared(r, &prep, &P1);
+	}
+	end = clock();
+	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
+
+	printf("%s: %d prepared pairings per seconds\n", __FUNCTION__, (int)(256/seconds));
 	return 1;
 }
 
@@ -695,6 +843,20 @@ int test_sm9_z256_sign()
 	sm9_verify_update(&ctx, data, sizeof(data));
 	if (sm9_verify_finish(&ctx, sig, siglen, &mpk, (char *)IDA, sizeof(IDA)) != 1) goto err; ++j;
 
+	// cached g = e(P1, Ppubs) on mpk, cross-check with the uncached key
+	if (sm9_sign_master_key_pre_compute(&mpk) != 1) goto err; ++j;
+	sm9_verify_init(&ctx);
+	sm9_verify_update(&ctx, data, sizeof(data));
+	if (sm9_verify_finish(&ctx, sig, siglen, &mpk, (char *)IDA, sizeof(IDA)) != 1) goto err; ++j;
+
+	memset(&key.g_Ppubs, 0, sizeof(key.g_Ppubs));
+	sm9_sign_init(&ctx);
+	sm9_sign_update(&ctx, data, sizeof(data));
+	if (sm9_sign_finish(&ctx, &key, sig, &siglen) < 0) goto err; ++j;
+	sm9_verify_init(&ctx);
+	sm9_verify_update(&ctx, data, sizeof(data));
+	if (sm9_verify_finish(&ctx, sig, siglen, &mpk, (char *)IDA, sizeof(IDA)) != 1) goto err; ++j;
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 err:
@@ -746,6 +908,315 @@ err:
 }
 
 
+#ifdef ENABLE_SM9_AMD64
+#include <gmssl/cpu.h>
+
+// the MULX/ADX and the MULQ Montgomery multiplications agree, including p - 1
+static int test_sm9_z256_modp_amd64(void)
+{
+	const sm9_z256_t one = {1,0,0,0};
+	sm9_z256_t a[64], b[64], r[64], t;
+	size_t i;
+
+	for (i = 0; i < 64; i++) {
+		sm9_z256_rand_range(a[i], sm9_z256_prime());
+		sm9_z256_rand_range(b[i], sm9_z256_prime());
+	}
+	sm9_z256_sub(a[0], sm9_z256_prime(), one);
+	sm9_z256_copy(b[0], a[0]);
+	sm9_z256_copy(b[1], a[0]);
+
+	for (i = 0; i < 64; i++) {
+		sm9_z256_modp_mont_mul(r[i], a[i], b[i]);
+	}
+	gmssl_cpu_disable_features(GMSSL_CPU_BMI2|GMSSL_CPU_ADX);
+	for (i = 0; i < 64; i++) {
+		sm9_z256_modp_mont_mul(t, a[i], b[i]);
+		if (sm9_z256_cmp(t, r[i]) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	if (test_sm9_z256_fp() != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+// more ids than one batch in two threads, checked against the single key extraction
+static int test_sm9_master_key_extract_keys(void)
+{
+	SM9_SIGN_MASTER_KEY sign_msk;
+	SM9_ENC_MASTER_KEY enc_msk;
+	SM9_SIGN_KEY *sign_keys = NULL;
+	SM9_ENC_KEY *enc_keys = NULL;
+	SM9_SIGN_KEY sign_key;
+	SM9_ENC_KEY enc_key;
+	char names[SM9_EXTRACT_BATCH_SIZE * 2 + 3][16];
+	const char *ids[SM9_EXTRACT_BATCH_SIZE * 2 + 3];
+	size_t idlens[SM9_EXTRACT_BATCH_SIZE * 2 + 3];
+	size_t num = SM9_EXTRACT_BATCH_SIZE * 2 + 3;
+	size_t checks[] = { 0, 1, SM9_EXTRACT_BATCH_SIZE, SM9_EXTRACT_BATCH_SIZE * 2 + 2 };
+	size_t i, j;
+	int ret = -1;
+
+	for (i = 0; i < num; i++) {
+		snprintf(names[i], sizeof(names[i]), "user%zu", i);
+		ids[i] = names[i];
+		idlens[i] = strlen(names[i]);
+	}
+	if (!(sign_keys = (SM9_SIGN_KEY *)malloc(sizeof(SM9_SIGN_KEY) * num))
+		|| !(enc_keys = (SM9_ENC_KEY *)malloc(sizeof(SM9_ENC_KEY) * num))) {
+		error_print();
+		goto end;
+	}
+	if (sm9_sign_master_key_generate(&sign_msk) != 1
+		|| sm9_enc_master_key_generate(&enc_msk) != 1) {
+		error_print();
+		goto end;
+	}
+	if (sm9_sign_master_key_extract_keys(&sign_msk, ids, idlens, num, sign_keys, 2) != 1
+		|| sm9_enc_master_key_extract_keys(&enc_msk, ids, idlens, num, enc_keys, 2) != 1) {
+		error_print();
+		goto end;
+	}
+
+	for (j = 0; j < sizeof(checks)/sizeof(checks[0]); j++) {
+		i = checks[j];
+		if (sm9_sign_master_key_extract_key(&sign_msk, ids[i], idlens[i], &sign_key) != 1
+			|| sm9_enc_master_key_extract_key(&enc_msk, ids[i], idlens[i], &enc_key) != 1) {
+			error_print();
+			goto end;
+		}
+		if (!sm9_z256_point_equ(&sign_keys[i].ds, &sign_key.ds)
+			|| !sm9_z256_twist_point_equ(&sign_keys[i].Ppubs, &sign_key.Ppubs)
+			|| memcmp(sign_keys[i].g_table, sign_key.g_table, sizeof(sign_key.g_table)) != 0) {
+			error_print();
+			goto end;
+		}
+		if (!sm9_z256_twist_point_equ(&enc_keys[i].de, &enc_key.de)
+			|| !sm9_z256_point_equ(&enc_keys[i].Ppube, &enc_key.Ppube)
+			|| memcmp(&enc_keys[i].prepared_de, &enc_keys[i].de, sizeof(SM9_Z256_TWIST_POINT)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	free(sign_keys);
+	free(enc_keys);
+	return ret;
+}
+
+static int test_sm9_id_cache(void)
+{
+	SM9_SIGN_MASTER_KEY sign_msk;
+	SM9_ENC_MASTER_KEY enc_msk;
+	SM9_SIGN_KEY sign_key;
+	SM9_ENC_KEY enc_key;
+	SM9_ID_CACHE *cache = NULL;
+	SM9_ID_PUBLIC pub;
+	SM9_ID_PUBLIC pub2;
+	SM9_Z256_POINT C;
+	SM9_SIGN_CTX ctx;
+	const char *id = "Alice";
+	size_t idlen = strlen(id);
+	uint8_t msg[] = "hello";
+	uint8_t sig[SM9_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t out[SM9_MAX_CIPHERTEXT_SIZE];
+	size_t outlen;
+	uint8_t dec[sizeof(msg)];
+	size_t declen;
+	int pre_compute;
+	int i;
+	int ret = -1;
+
+	for (pre_compute = 0; pre_compute <= 1; pre_compute++) {
+		if (!(cache = sm9_id_cache_new(4, pre_compute))) {
+			error_print();
+			return -1;
+		}
+		if (sm9_sign_master_key_generate(&sign_msk) != 1
+			|| sm9_enc_master_key_generate(&enc_msk) != 1
+			|| sm9_sign_master_key_extract_key(&sign_msk, id, idlen, &sign_key) != 1
+			|| sm9_enc_master_key_extract_key(&enc_msk, id, idlen, &enc_key) != 1
+			|| sm9_sign_master_key_set_id_cache(&sign_msk, cache) != 1
+			|| sm9_enc_master_key_set_id_cache(&enc_msk, cache) != 1) {
+			error_print();
+			goto end;
+		}
+
+		// the second round is served by the cache, (hid, ID) keys one sign and one enc entry
+		for (i = 0; i < 2; i++) {
+			if (sm9_sign_init(&ctx) != 1
+				|| sm9_sign_update(&ctx, msg, sizeof(msg)) != 1
+				|| sm9_sign_finish(&ctx, &sign_key, sig, &siglen) != 1
+				|| sm9_verify_init(&ctx) != 1
+				|| sm9_verify_update(&ctx, msg, sizeof(msg)) != 1
+				|| sm9_verify_finish(&ctx, sig, siglen, &sign_msk, id, idlen) != 1) {
+				error_print();
+				goto end;
+			}
+			if (sm9_verify_init(&ctx) != 1
+				|| sm9_verify_update(&ctx, msg, sizeof(msg) - 1) != 1
+				|| sm9_verify_finish(&ctx, sig, siglen, &sign_msk, id, idlen) != 0) {
+				error_print();
+				goto end;
+			}
+			if (sm9_encrypt(&enc_msk, id, idlen, msg, sizeof(msg), out, &outlen) != 1
+				|| sm9_decrypt(&enc_key, id, idlen, out, outlen, dec, &declen) != 1
+				|| declen != sizeof(msg) || memcmp(dec, msg, sizeof(msg)) != 0) {
+				error_print();
+				goto end;
+			}
+			if (sm9_id_cache_count(cache) != 2) {
+				error_print();
+				goto end;
+			}
+		}
+
+		// cached and computed public points are the same
+		if (sm9_sign_id_cache_get(cache, &sign_msk, id, idlen, &pub) != 1
+			|| pub.hid != SM9_HID_SIGN || pub.pre_computed != pre_compute) {
+			error_print();
+			goto end;
+		}
+		if (sm9_sign_id_public_init(&pub2, &sign_msk, id, idlen, 0) != 1
+			|| !sm9_z256_twist_point_equ(&pub.Qs, &pub2.Qs)) {
+			error_print();
+			goto end;
+		}
+
+		// a public object of another master key or kind is rejected
+		if (sm9_kem_encrypt_id_public(&enc_msk, &pub, id, idlen, 16, out, &C) != -1) {
+			error_print();
+			goto end;
+		}
+
+		// the entries of an old master public key are replaced
+		if (sm9_sign_master_key_generate(&sign_msk) != 1
+			|| sm9_sign_master_key_extract_key(&sign_msk, id, idlen, &sign_key) != 1
+			|| sm9_sign_master_key_set_id_cache(&sign_msk, cache) != 1
+			|| sm9_sign_init(&ctx) != 1
+			|| sm9_sign_update(&ctx, msg, sizeof(msg)) != 1
+			|| sm9_sign_finish(&ctx, &sign_key, sig, &siglen) != 1
+			|| sm9_verify_init(&ctx) != 1
+			|| sm9_verify_update(&ctx, msg, sizeof(msg)) != 1
+			|| sm9_verify_finish(&ctx, sig, siglen, &sign_msk, id, idlen) != 1
+			|| sm9_id_cache_count(cache) != 2) {
+			error_print();
+			goto end;
+		}
+
+		sm9_id_cache_free(cache);
+		cache = NULL;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm9_id_cache_free(cache);
+	return ret;
+}
+
+// the batch matches sm9_do_verify with and without the cached g table and identities
+static int test_sm9_do_verify_batch(void)
+{
+	SM9_SIGN_MASTER_KEY msk;
+	SM9_SIGN_KEY keys[3];
+	SM9_ID_CACHE *cache = NULL;
+	const char *names[3] = { "Alice", "Bob", "Carol" };
+	const char *ids[20];
+	size_t idlens[20];
+	SM3_CTX sm3_ctxs[20];
+	SM9_SIGNATURE sigs[20];
+	int results[20];
+	uint8_t msg[4] = { 0 };
+	size_t count = sizeof(sigs)/sizeof(sigs[0]);
+	size_t i;
+	int round;
+	int ret = -1;
+
+	if (sm9_sign_master_key_generate(&msk) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 3; i++) {
+		if (sm9_sign_master_key_extract_key(&msk, names[i], strlen(names[i]), &keys[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// Alice and Bob sign more than once, Carol only the last message
+	for (i = 0; i < count; i++) {
+		size_t who = i == count - 1 ? 2 : i % 2;
+
+		ids[i] = names[who];
+		idlens[i] = strlen(names[who]);
+		msg[0] = (uint8_t)i;
+		sm3_init(&sm3_ctxs[i]);
+		sm3_update(&sm3_ctxs[i], msg, sizeof(msg));
+		if (sm9_do_sign(&keys[who], &sm3_ctxs[i], &sigs[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	for (round = 0; round < 3; round++) {
+		if (round == 1) {
+			// g is computed by the batch
+			memset(&msk.g_Ppubs, 0, sizeof(msk.g_Ppubs));
+		} else if (round == 2) {
+			if (sm9_sign_master_key_pre_compute(&msk) != 1
+				|| !(cache = sm9_id_cache_new(4, 1))
+				|| sm9_sign_master_key_set_id_cache(&msk, cache) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+
+		if (sm9_do_verify_batch(&msk, ids, idlens, sm3_ctxs, sigs, count, results) != 1) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < count; i++) {
+			if (results[i] != 1) {
+				error_print();
+				goto end;
+			}
+		}
+
+		// a signature of another message is rejected alone
+		sigs[17].h[0] ^= 1;
+		if (sm9_do_verify_batch(&msk, ids, idlens, sm3_ctxs, sigs, count, results) != 0) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < count; i++) {
+			int expected = sm9_do_verify(&msk, ids[i], idlens[i], &sm3_ctxs[i], &sigs[i]) == 1 ? 1 : -1;
+			if (results[i] != expected || results[i] != (i == 17 ? -1 : 1)) {
+				error_print();
+				goto end;
+			}
+		}
+		sigs[17].h[0] ^= 1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sm9_sign_master_key_set_id_cache(&msk, NULL);
+	sm9_id_cache_free(cache);
+	return ret;
+}
+
 int test_sm9_z256_encrypt()
 {
 	SM9_ENC_MASTER_KEY msk;
@@ -770,6 +1241,12 @@ int test_sm9_z256_encrypt()
 	if (sm9_decrypt(&key, (char *)IDB, sizeof(IDB), out, outlen, dec, &declen) < 0) goto err; ++j;
 	if (memcmp(data, dec, sizeof(data)) != 0) goto err; ++j;
 
+	// cached g = e(Ppube, P2)
+	if (sm9_enc_master_key_pre_compute(&msk) != 1) goto err; ++j;
+	if (sm9_encrypt(&msk, (char *)IDB, sizeof(IDB), data, sizeof(data), out, &outlen) < 0) goto err; ++j;
+	if (sm9_decrypt(&key, (char *)IDB, sizeof(IDB), out, outlen, dec, &declen) < 0) goto err; ++j;
+	if (memcmp(data, dec, sizeof(data)) != 0) goto err; ++j;
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 err:
@@ -824,6 +1301,13 @@ int test_sm9_z256_exchange()
 		}
 	} ++j;
 
+	// cached g = e(Ppube, P2) gives the same session key
+	if (sm9_enc_master_key_pre_compute(&msk) != 1) goto err; ++j;
+	if (sm9_exch_step_1A(&msk, (char *)idB, sizeof(idB), &RA, rA) < 0) goto err; ++j;
+	if (sm9_exch_step_1B(&msk, (char *)idA, sizeof(idA), (char *)idB, sizeof(idB), &keyB, &RA, &RB, skB, klen) < 0) goto err; ++j;
+	if (sm9_exch_step_2A(&msk, (char *)idA, sizeof(idA), (char *)idB, sizeof(idB), &keyA, rA, &RA, &RB, skA, klen) < 0) goto err; ++j;
+	if (memcmp(skA, skB, klen) != 0) goto err; ++j;
+
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 err:
@@ -840,12 +1324,22 @@ int main(void) {
 	if (test_sm9_z256_fp12() != 1) goto err;
 	if (test_sm9_z256_point() != 1) goto err;
 	if (test_sm9_z256_twist_point() != 1) goto err;
+	if (test_sm9_z256_twist_point_mul_generator() != 1) goto err;
 	if (test_sm9_z256_pairing() != 1) goto err;
+	if (test_sm9_z256_pairing_prepared() != 1) goto err;
+	if (test_sm9_z256_pairing_multi() != 1) goto err;
+	if (test_sm9_z256_fp12_cyclotomic() != 1) goto err;
 	if (test_sm9_z256_sign() != 1) goto err;
 	if (test_sm9_z256_ciphertext() != 1) goto err;
 	if (test_sm9_z256_encrypt() != 1) goto err;
+	if (test_sm9_master_key_extract_keys() != 1) goto err;
+	if (test_sm9_id_cache() != 1) goto err;
+	if (test_sm9_do_verify_batch() != 1) goto err;
 	if (test_sm9_z256_exchange() != 1) goto err;
 	if (test_sm9_z256_pairing_speed() != 1) goto err;
+#ifdef ENABLE_SM9_AMD64
+	if (test_sm9_z256_modp_amd64() != 1) goto err;
+#endif
 
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
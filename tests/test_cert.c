@@ -0,0 +1,74 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509.h>
+#include <gmssl/error.h>
+#include "test_cert.h"
+
+
+int test_cert_generate(const char *cn, const SM2_KEY *key, const char *ca_cn, const SM2_KEY *ca_key,
+	const uint8_t *serial, size_t serial_len, time_t not_before, int key_usage, int flags,
+	uint8_t **out, size_t *outlen)
+{
+	uint8_t name[256];
+	uint8_t issuer[256];
+	size_t namelen = 0;
+	size_t issuerlen = 0;
+	uint8_t exts[512];
+	size_t extslen = 0;
+	time_t not_after;
+	static const uint8_t default_serial[4] = { 1, 2, 3, 4 };
+
+	if (!serial) {
+		serial = default_serial;
+		serial_len = sizeof(default_serial);
+	}
+	if (!ca_key) {
+		ca_key = key;
+		ca_cn = cn;
+	}
+	if (!not_before) {
+		time(&not_before);
+	}
+	if (x509_validity_add_days(&not_after, not_before, 1) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", NULL, NULL, "GmSSL", NULL, cn) != 1
+		|| x509_name_set(issuer, &issuerlen, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, ca_cn) != 1) {
+		error_print();
+		return -1;
+	}
+	if (key_usage
+		&& x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, key_usage) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((flags & TEST_CERT_SKID)
+		&& x509_exts_add_subject_key_identifier_ex(exts, &extslen, sizeof(exts), X509_non_critical, key) != 1) {
+		error_print();
+		return -1;
+	}
+	if ((flags & TEST_CERT_CA)
+		&& x509_exts_add_basic_constraints(exts, &extslen, sizeof(exts), X509_critical, 1, -1) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_sign_to_der(X509_version_v3, serial, serial_len, OID_sm2sign_with_sm3,
+		issuer, issuerlen, not_before, not_after, name, namelen, key,
+		NULL, 0, NULL, 0, extslen ? exts : NULL, extslen, ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+		out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
@@ -0,0 +1,40 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_TEST_CERT_H
+#define GMSSL_TEST_CERT_H
+
+#include <time.h>
+#include <stdint.h>
+#include <gmssl/sm2.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+// certificate factory of the X.509 and TLS tests, linked by CMakeLists.txt
+#define TEST_CERT_CA	1 // basicConstraints with cA
+#define TEST_CERT_SKID	2 // subjectKeyIdentifier of `key`
+
+/*
+ * SM2 certificate of "C=CN,O=GmSSL,CN=`cn`" valid for one day from
+ * `not_before`, or from now if it is 0. It is self-signed if `ca_key` is
+ * NULL, the serial number is 01020304 if `serial` is NULL, keyUsage is added
+ * if `key_usage` is not 0.
+ */
+int test_cert_generate(const char *cn, const SM2_KEY *key, const char *ca_cn, const SM2_KEY *ca_key,
+	const uint8_t *serial, size_t serial_len, time_t not_before, int key_usage, int flags,
+	uint8_t **out, size_t *outlen);
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
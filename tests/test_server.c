@@ -0,0 +1,82 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/socket.h>
+#include <gmssl/error.h>
+#include "test_server.h"
+
+#ifndef WIN32
+#include <pthread.h>
+
+
+static tls_socket_t server_sock;
+static void (*server_handler)(tls_socket_t conn) = NULL;
+
+static void *server_conn_thread(void *arg)
+{
+	server_handler((tls_socket_t)(size_t)arg);
+	return NULL;
+}
+
+static void *server_thread(void *arg)
+{
+	tls_socket_t conn;
+	struct sockaddr_in addr;
+	pthread_t tid;
+
+	(void)arg;
+	for (;;) {
+		if (tls_socket_accept(server_sock, &addr, &conn) != 1) {
+			break;
+		}
+		if (pthread_create(&tid, NULL, server_conn_thread, (void *)(size_t)conn) != 0) {
+			tls_socket_close(conn);
+			continue;
+		}
+		pthread_detach(tid);
+	}
+	return NULL;
+}
+
+int test_server_start(void (*handler)(tls_socket_t conn), int *port)
+{
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	pthread_t tid;
+
+	if (!handler || !port || server_handler) {
+		error_print();
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = 0;
+
+	if (tls_socket_create(&server_sock, AF_INET, SOCK_STREAM, 0) != 1
+		|| tls_socket_bind(server_sock, &addr) != 1
+		|| getsockname(server_sock, (struct sockaddr *)&addr, &addrlen) != 0
+		|| tls_socket_listen(server_sock, 8) != 1) {
+		error_print();
+		return -1;
+	}
+	server_handler = handler;
+	if (pthread_create(&tid, NULL, server_thread, NULL) != 0) {
+		error_print();
+		return -1;
+	}
+	pthread_detach(tid);
+	*port = ntohs(addr.sin_port);
+	return 1;
+}
+#endif
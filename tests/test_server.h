@@ -0,0 +1,34 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+#ifndef GMSSL_TEST_SERVER_H
+#define GMSSL_TEST_SERVER_H
+
+#include <gmssl/socket.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+#ifndef WIN32
+/*
+ * Loopback TCP server of the HTTP tests, linked by CMakeLists.txt. Listens
+ * on an ephemeral port of 127.0.0.1 returned in `port`, every accepted
+ * connection is passed to `handler` in a detached thread, the handler
+ * closes it. One server per process.
+ */
+int test_server_start(void (*handler)(tls_socket_t conn), int *port);
+#endif
+
+
+#ifdef __cplusplus
+}
+#endif
+#endif
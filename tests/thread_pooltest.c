@@ -0,0 +1,246 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm3.h>
+#include <gmssl/thread_pool.h>
+#include <gmssl/error.h>
+
+
+typedef struct {
+	size_t index;
+	int runs;
+	uint8_t dgst[SM3_DIGEST_SIZE];
+} ITEM;
+
+static void item_task(void *arg)
+{
+	ITEM *item = (ITEM *)arg;
+	SM3_CTX ctx;
+	uint8_t buf[64];
+	int i;
+
+	memset(buf, (int)item->index, sizeof(buf));
+	for (i = 0; i < 100; i++) {
+		sm3_init(&ctx);
+		sm3_update(&ctx, buf, sizeof(buf));
+		sm3_finish(&ctx, item->dgst);
+		memcpy(buf, item->dgst, sizeof(item->dgst));
+	}
+	item->runs++;
+}
+
+static int check_items(ITEM *items, size_t n)
+{
+	ITEM item;
+	size_t i;
+
+	for (i = 0; i < n; i++) {
+		memset(&item, 0, sizeof(item));
+		item.index = i;
+		item_task(&item);
+		if (items[i].runs != 1
+			|| memcmp(items[i].dgst, item.dgst, sizeof(item.dgst)) != 0) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int run_items(size_t n)
+{
+	ITEM *items;
+	size_t i;
+	int ret = -1;
+
+	if (!(items = (ITEM *)calloc(n ? n : 1, sizeof(ITEM)))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < n; i++) {
+		items[i].index = i;
+	}
+	if (gmssl_thread_pool_run(item_task, items, sizeof(ITEM), n) != 1
+		|| check_items(items, n) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+end:
+	free(items);
+	return ret;
+}
+
+static int test_thread_pool_run(void)
+{
+	size_t n[] = { 0, 1, 2, 3, 100, 1000 };
+	size_t i;
+
+	if (gmssl_thread_pool_size() < 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(n)/sizeof(n[0]); i++) {
+		if (run_items(n[i]) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (gmssl_thread_pool_run(NULL, NULL, 0, 1) != -1
+		|| gmssl_thread_pool_run(item_task, NULL, sizeof(ITEM), 1) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+typedef struct {
+	int ret;
+} NESTED;
+
+static void nested_task(void *arg)
+{
+	NESTED *nested = (NESTED *)arg;
+	nested->ret = run_items(50);
+}
+
+static int test_thread_pool_nested(void)
+{
+	NESTED nested[16];
+	size_t i;
+
+	// workers even with a single CPU
+	if (gmssl_thread_pool_init(4, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	memset(nested, 0, sizeof(nested));
+	if (gmssl_thread_pool_run(nested_task, nested, sizeof(NESTED), 16) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 16; i++) {
+		if (nested[i].ret != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	gmssl_thread_pool_cleanup();
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_thread_pool_init(void)
+{
+	int cpus[] = { 0 };
+
+	if (gmssl_thread_pool_init(GMSSL_THREAD_POOL_MAX_THREADS + 1, NULL, 0) != -1
+		|| gmssl_thread_pool_init(2, NULL, 1) != -1) {
+		error_print();
+		return -1;
+	}
+
+	if (gmssl_thread_pool_init(3, cpus, 1) != 1
+		|| gmssl_thread_pool_size() != 3
+		|| run_items(200) != 1) {
+		error_print();
+		return -1;
+	}
+	// the calling thread only
+	if (gmssl_thread_pool_init(1, NULL, 0) != 1
+		|| gmssl_thread_pool_size() != 1
+		|| run_items(200) != 1) {
+		error_print();
+		return -1;
+	}
+
+	gmssl_thread_pool_cleanup();
+	if (run_items(200) != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+typedef struct {
+	int calls;
+	int accept;
+} EXECUTOR;
+
+// runs the helper at once, before the caller works on the items
+static int inline_executor(void *executor_arg, GMSSL_TASK task, void *arg)
+{
+	EXECUTOR *executor = (EXECUTOR *)executor_arg;
+
+	executor->calls++;
+	if (!executor->accept) {
+		return 0;
+	}
+	task(arg);
+	return 1;
+}
+
+static int test_thread_pool_executor(void)
+{
+	EXECUTOR executor;
+
+	if (gmssl_thread_pool_set_executor(inline_executor, &executor, 0) != -1) {
+		error_print();
+		return -1;
+	}
+
+	memset(&executor, 0, sizeof(executor));
+	executor.accept = 1;
+	if (gmssl_thread_pool_set_executor(inline_executor, &executor, 4) != 1
+		|| gmssl_thread_pool_size() != 4
+		|| run_items(100) != 1
+		|| executor.calls != 3) {
+		error_print();
+		return -1;
+	}
+	// a refused helper leaves the items to the caller
+	memset(&executor, 0, sizeof(executor));
+	if (run_items(100) != 1
+		|| executor.calls != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (gmssl_thread_pool_set_executor(NULL, NULL, 0) != 1
+		|| run_items(100) != 1) {
+		error_print();
+		return -1;
+	}
+	gmssl_thread_pool_cleanup();
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_thread_pool_run() != 1) goto err;
+	if (test_thread_pool_nested() != 1) goto err;
+	if (test_thread_pool_init() != 1) goto err;
+	if (test_thread_pool_executor() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
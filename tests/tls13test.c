@@ -20,11 +20,11 @@
 #include <gmssl/sm4.h>
 
 
-static int test_tls13_gcm(void)
+static int test_tls13_gcm_cipher(const BLOCK_CIPHER *cipher)
 {
 
 	BLOCK_CIPHER_KEY block_key;
-	uint8_t key[16];
+	uint8_t key[BLOCK_CIPHER_MAX_KEY_SIZE];
 	uint8_t iv[12];
 	uint8_t seq_num[8] = {0,0,0,0,0,0,0,1};
 	int record_type = TLS_record_handshake;
@@ -44,7 +44,7 @@ static int test_tls13_gcm(void)
 	memset(buf, 1, sizeof(buf));
 	buflen = 0;
 
-	if (block_cipher_set_encrypt_key(&block_key, BLOCK_CIPHER_sm4(), key) != 1) {
+	if (block_cipher_set_encrypt_key(&block_key, cipher, key) != 1) {
 		error_print();
 		return -1;
 	}
@@ -66,6 +66,27 @@ static int test_tls13_gcm(void)
 		error_print();
 		return -1;
 	}
+	return 1;
+}
+
+static int test_tls13_gcm(void)
+{
+	if (test_tls13_gcm_cipher(BLOCK_CIPHER_sm4()) != 1) {
+		error_print();
+		return -1;
+	}
+#ifdef ENABLE_AES
+	if (test_tls13_gcm_cipher(BLOCK_CIPHER_aes128()) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
+#ifdef ENABLE_CHACHA20
+	if (test_tls13_gcm_cipher(BLOCK_CIPHER_chacha20()) != 1) {
+		error_print();
+		return -1;
+	}
+#endif
 	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
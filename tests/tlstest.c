@@ -18,6 +18,19 @@
 #include <gmssl/tls.h>
 #include <gmssl/sm3.h>
 #include <gmssl/sm4.h>
+#include <gmssl/hkdf.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_ocsp.h>
+#ifndef WIN32
+#include <time.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/socket.h>
+#include <netinet/in.h>
+#include <arpa/inet.h>
+#include <pthread.h>
+#endif
+#include "test_cert.h"
 
 static int test_tls_encode(void)
 {
@@ -95,6 +108,137 @@ static int test_tls_cbc(void)
 	return 1;
 }
 
+static int test_tls_record_in_place(void)
+{
+	uint8_t key[32] = {1};
+	SM3_HMAC_CTX hmac_ctx;
+	SM4_KEY enc_key;
+	SM4_KEY dec_key;
+	uint8_t seq_num[8] = { 0,0,0,0,0,0,0,1 };
+	uint8_t record[TLS_CBC_HEADROOM + 1000 + TLS_CBC_TAILROOM];
+	uint8_t plain[5 + 1000];
+	uint8_t buf[5 + 1000 + TLS_CBC_TAILROOM];
+	uint8_t *data;
+	size_t datalen;
+	size_t recordlen;
+	size_t len;
+	size_t i;
+
+	sm3_hmac_init(&hmac_ctx, key, 32);
+	sm4_set_encrypt_key(&enc_key, key);
+	sm4_set_decrypt_key(&dec_key, key);
+
+	for (len = 0; len <= 1000; len += 37) {
+		for (i = 0; i < len; i++) {
+			record[TLS_CBC_HEADROOM + i] = (uint8_t)i;
+		}
+		record[0] = TLS_record_application_data;
+		tls_record_set_protocol(record, TLS_protocol_tlcp);
+
+		// in-place output is a normal record
+		if (tls_record_encrypt_in_place(&hmac_ctx, &enc_key, seq_num, record, len, &recordlen) != 1
+			|| recordlen != tls_record_length(record)
+			|| tls_record_decrypt(&hmac_ctx, &dec_key, seq_num, record, recordlen, buf, &datalen) != 1
+			|| tls_record_data_length(buf) != len) {
+			error_print();
+			return -1;
+		}
+		for (i = 0; i < len; i++) {
+			if (buf[5 + i] != (uint8_t)i) {
+				error_print();
+				return -1;
+			}
+		}
+
+		// and a normal record is decrypted in place
+		tls_record_set_type(plain, TLS_record_application_data);
+		tls_record_set_protocol(plain, TLS_protocol_tlcp);
+		tls_record_set_data(plain, buf + 5, len);
+		if (tls_record_encrypt(&hmac_ctx, &enc_key, seq_num, plain, 5 + len, record, &recordlen) != 1
+			|| tls_record_decrypt_in_place(&hmac_ctx, &dec_key, seq_num, record, recordlen, &data, &datalen) != 1
+			|| data != record + TLS_CBC_HEADROOM || datalen != len
+			|| memcmp(data, plain + 5, len) != 0) {
+			error_print();
+			return -1;
+		}
+
+		// tampered
+		tls_record_encrypt(&hmac_ctx, &enc_key, seq_num, plain, 5 + len, record, &recordlen);
+		record[recordlen - 20] ^= 1;
+		if (tls_record_decrypt_in_place(&hmac_ctx, &dec_key, seq_num, record, recordlen, &data, &datalen) == 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// records with every padding length a peer may send, and with a broken padding byte
+static int test_tls_cbc_padding(void)
+{
+	uint8_t key[32] = {2};
+	SM3_HMAC_CTX hmac_ctx;
+	SM3_HMAC_CTX ctx;
+	SM4_KEY enc_key;
+	SM4_KEY dec_key;
+	uint8_t seq_num[8] = { 0,0,0,0,0,0,0,7 };
+	uint8_t header[5] = { TLS_record_application_data, 1, 1, 0, 0 };
+	uint8_t plain[16 + 1000 + 32 + 256];
+	uint8_t record[16 + 16 + 1000 + 32 + 256];
+	uint8_t buf[16 + 1000 + 32 + 256];
+	uint8_t iv[16] = {0};
+	size_t datalens[] = { 0, 1, 50, 51, 300, 1000 };
+	size_t datalen, padding_len, len, outlen;
+	size_t i, j;
+
+	sm3_hmac_init(&hmac_ctx, key, 32);
+	sm4_set_encrypt_key(&enc_key, key);
+	sm4_set_decrypt_key(&dec_key, key);
+
+	for (i = 0; i < sizeof(datalens)/sizeof(datalens[0]); i++) {
+		datalen = datalens[i];
+		for (padding_len = 15 - (datalen + 32) % 16; padding_len < 256; padding_len += 16) {
+			len = datalen + 32 + padding_len + 1;
+			for (j = 0; j < datalen; j++) {
+				plain[j] = (uint8_t)(j * 7);
+			}
+			header[3] = (uint8_t)(datalen >> 8);
+			header[4] = (uint8_t)datalen;
+			memcpy(&ctx, &hmac_ctx, sizeof(ctx));
+			sm3_hmac_update(&ctx, seq_num, 8);
+			sm3_hmac_update(&ctx, header, 5);
+			sm3_hmac_update(&ctx, plain, datalen);
+			sm3_hmac_finish(&ctx, plain + datalen);
+			memset(plain + datalen + 32, (int)padding_len, padding_len + 1);
+
+			memcpy(record, iv, 16);
+			memcpy(buf, iv, 16);
+			sm4_cbc_encrypt_blocks(&enc_key, buf, plain, len/16, record + 16);
+			if (tls_cbc_decrypt(&hmac_ctx, &dec_key, seq_num, header, record, 16 + len, buf, &outlen) != 1
+				|| outlen != datalen
+				|| memcmp(buf, plain, datalen) != 0) {
+				error_print();
+				return -1;
+			}
+
+			if (padding_len) {
+				plain[datalen + 32] ^= 1;
+				memcpy(buf, iv, 16);
+				sm4_cbc_encrypt_blocks(&enc_key, buf, plain, len/16, record + 16);
+				if (tls_cbc_decrypt(&hmac_ctx, &dec_key, seq_num, header, record, 16 + len, buf, &outlen) == 1) {
+					error_print();
+					return -1;
+				}
+			}
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
 static int test_tls_random(void)
 {
 	uint8_t random[32];
@@ -320,10 +464,3690 @@ static int test_tls_application_data(void)
 	return 1;
 }
 
+// the SM3 fast paths of the key schedule against the generic HKDF and digest
+static int test_tls13_key_schedule(void)
+{
+	const DIGEST *digest = DIGEST_sm3();
+	uint8_t secret[32];
+	DIGEST_CTX dgst_ctx;
+	DIGEST_CTX ctx;
+	uint8_t dgst[64];
+	uint8_t transcript[64];
+	size_t dgstlen, len;
+	uint8_t hkdf_label[64];
+	uint8_t *p;
+	size_t hkdf_label_len;
+	uint8_t out[32];
+	uint8_t ref[32];
+	uint8_t key[16], iv[12];
+	uint8_t ref_key[16], ref_iv[12];
+
+	rand_bytes(secret, sizeof(secret));
+	digest_init(&dgst_ctx, digest);
+	digest_update(&dgst_ctx, (uint8_t *)"ClientHello ServerHello", 23);
+
+	ctx = dgst_ctx;
+	digest_finish(&ctx, dgst, &dgstlen);
+	if (tls13_transcript_hash(&dgst_ctx, transcript, &len) != 1
+		|| len != dgstlen || memcmp(transcript, dgst, len) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// HkdfLabel { uint16 length = 32; "tls13 c hs traffic"; Transcript-Hash }
+	p = hkdf_label;
+	hkdf_label_len = 0;
+	tls_uint16_to_bytes(32, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes((uint8_t *)"tls13 c hs traffic", 18, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes(dgst, dgstlen, &p, &hkdf_label_len);
+	if (hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, 32, ref) != 1
+		|| tls13_derive_secret(secret, "c hs traffic", &dgst_ctx, out) != 1
+		|| memcmp(out, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// a label not in the table is encoded at run time
+	p = hkdf_label;
+	hkdf_label_len = 0;
+	tls_uint16_to_bytes(32, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes((uint8_t *)"tls13 exp master", 16, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes(dgst, dgstlen, &p, &hkdf_label_len);
+	if (hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, 32, ref) != 1
+		|| tls13_derive_secret(secret, "exp master", &dgst_ctx, out) != 1
+		|| memcmp(out, ref, 32) != 0) {
+		error_print();
+		return -1;
+	}
+
+	p = hkdf_label;
+	hkdf_label_len = 0;
+	tls_uint16_to_bytes(16, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes((uint8_t *)"tls13 key", 9, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes(NULL, 0, &p, &hkdf_label_len);
+	if (hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, 16, ref_key) != 1) {
+		error_print();
+		return -1;
+	}
+	p = hkdf_label;
+	hkdf_label_len = 0;
+	tls_uint16_to_bytes(12, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes((uint8_t *)"tls13 iv", 8, &p, &hkdf_label_len);
+	tls_uint8array_to_bytes(NULL, 0, &p, &hkdf_label_len);
+	if (hkdf_expand(digest, secret, 32, hkdf_label, hkdf_label_len, 12, ref_iv) != 1
+		|| tls13_hkdf_expand_key_iv(digest, secret, sizeof(key), key, iv) != 1
+		|| memcmp(key, ref_key, sizeof(key)) != 0
+		|| memcmp(iv, ref_iv, sizeof(iv)) != 0) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+#ifndef WIN32
+static uint8_t test_cacert[1024];
+static size_t test_cacertlen;
+static uint8_t test_certs[2048];
+static size_t test_certslen;
+static SM2_KEY test_sign_key;
+static SM2_KEY test_enc_key;
+static SM2_KEY test_ca_key;
+
+// CA certificate for the client, server signing (and TLCP encryption) certificate
+static int test_certs_generate(int protocol)
+{
+	uint8_t *p;
+
+	test_cacertlen = 0;
+	test_certslen = 0;
+	p = test_cacert;
+	if (sm2_key_generate(&test_ca_key) != 1
+		|| test_cert_generate("CA", &test_ca_key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN|X509_KU_CRL_SIGN, TEST_CERT_CA,
+			&p, &test_cacertlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = test_certs;
+	if (sm2_key_generate(&test_sign_key) != 1
+		|| test_cert_generate("server", &test_sign_key, "CA", &test_ca_key,
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, 0, &p, &test_certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (protocol == TLS_protocol_tlcp) {
+		if (sm2_key_generate(&test_enc_key) != 1
+			|| test_cert_generate("server-enc", &test_enc_key, "CA", &test_ca_key,
+				NULL, 0, 0, X509_KU_KEY_ENCIPHERMENT|X509_KU_DATA_ENCIPHERMENT|X509_KU_KEY_AGREEMENT, 0,
+				&p, &test_certslen) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int test_ctx_init(TLS_CTX *client_ctx, TLS_CTX *server_ctx, int protocol)
+{
+	if (tls_ctx_init(client_ctx, protocol, TLS_client_mode) != 1
+		|| tls_ctx_init(server_ctx, protocol, TLS_server_mode) != 1) {
+		error_print();
+		return -1;
+	}
+	if (protocol != TLS_protocol_tlcp) {
+		client_ctx->cacerts = test_cacert;
+		client_ctx->cacertslen = test_cacertlen;
+	}
+	client_ctx->quiet = 1;
+	server_ctx->certs = test_certs;
+	server_ctx->certslen = test_certslen;
+	server_ctx->signkey = test_sign_key;
+	server_ctx->kenckey = test_enc_key;
+	server_ctx->quiet = 1;
+	return 1;
+}
+
+// client and server share one thread over a non-blocking socketpair
+static int test_handshake_init(TLS_CONNECT *client, const TLS_CTX *client_ctx, const TLS_SESSION *session,
+	TLS_CONNECT *server, const TLS_CTX *server_ctx, int sock[2])
+{
+	fcntl(sock[0], F_SETFL, fcntl(sock[0], F_GETFL) | O_NONBLOCK);
+	fcntl(sock[1], F_SETFL, fcntl(sock[1], F_GETFL) | O_NONBLOCK);
+
+	if (tls_init(client, client_ctx) != 1
+		|| tls_init(server, server_ctx) != 1
+		|| tls_set_socket(client, sock[0]) != 1
+		|| tls_set_socket(server, sock[1]) != 1) {
+		error_print();
+		return -1;
+	}
+	if (session && tls_set_session(client, session) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int test_handshake_run(TLS_CONNECT *client, TLS_CONNECT *server, int *want_read)
+{
+	int client_done = 0;
+	int server_done = 0;
+	int rv;
+	int i;
+
+	*want_read = 0;
+	for (i = 0; i < 100 && !(client_done && server_done); i++) {
+		if (!client_done) {
+			if ((rv = tls_do_handshake(client)) == 1) {
+				client_done = 1;
+			} else if (rv == TLS_ERROR_WANT_READ) {
+				*want_read = 1;
+			} else if (rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				return -1;
+			}
+		}
+		if (!server_done) {
+			if ((rv = tls_do_handshake(server)) == 1) {
+				server_done = 1;
+			} else if (rv == TLS_ERROR_WANT_READ) {
+				*want_read = 1;
+			} else if (rv != TLS_ERROR_WANT_WRITE && rv != TLS_ERROR_WANT_ASYNC) {
+				error_print();
+				return -1;
+			}
+		}
+	}
+	if (!client_done || !server_done) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// handshake over the connected sockets
+static int test_handshake_on(TLS_CONNECT *client, const TLS_CTX *client_ctx, const TLS_SESSION *session,
+	TLS_CONNECT *server, const TLS_CTX *server_ctx, int sock[2], int *want_read)
+{
+	if (test_handshake_init(client, client_ctx, session, server, server_ctx, sock) != 1) {
+		error_print();
+		return -1;
+	}
+	return test_handshake_run(client, server, want_read);
+}
+
+static int test_handshake(TLS_CONNECT *client, const TLS_CTX *client_ctx, const TLS_SESSION *session,
+	TLS_CONNECT *server, const TLS_CTX *server_ctx, int sock[2], int *want_read)
+{
+	memset(client, 0, sizeof(*client));
+	memset(server, 0, sizeof(*server));
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0) {
+		error_print();
+		return -1;
+	}
+	return test_handshake_on(client, client_ctx, session, server, server_ctx, sock, want_read);
+}
+
+static int test_tls_non_blocking(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| !want_read
+		|| !tls_transport_is_socket(&client.transport)
+		// the handshake temporaries are freed at its end
+		|| client.arena.block || server.arena.block) {
+		error_print();
+		goto end;
+	}
+
+	if (protocol == TLS_protocol_tls13) {
+		if (tls13_recv(&server, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ
+			|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1 || len != 5
+			|| tls13_recv(&server, buf, sizeof(buf), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	} else {
+		if (tls_recv(&server, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ
+			|| tls_send(&client, (uint8_t *)"hello", 5, &len) != 1 || len != 5
+			|| tls_recv(&server, buf, sizeof(buf), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// idle connections give their record buffers back to the pool
+	if (client.record || client.databuf || client.sendbuf || client.enced_record
+		|| server.record || server.databuf || server.sendbuf || server.enced_record
+		|| !tls_buffer_pool_free_count()) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// handshake over a non-blocking memory pair, the server stats get every phase it runs
+static int test_tls_memory_transport(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_MEMORY_PAIR *pair = NULL;
+	TLS_TRANSPORT transport;
+	TLS_HANDSHAKE_STATS client_stats;
+	TLS_HANDSHAKE_STATS server_stats;
+	int client_done = 0;
+	int server_done = 0;
+	uint8_t buf[64];
+	size_t len;
+	int rv;
+	int i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	memset(&client_stats, 0, sizeof(client_stats));
+	memset(&server_stats, 0, sizeof(server_stats));
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| !(pair = tls_memory_pair_new(0))
+		|| tls_init(&client, &client_ctx) != 1
+		|| tls_init(&server, &server_ctx) != 1
+		|| tls_memory_pair_get_transport(pair, 0, &transport) != 1
+		|| tls_set_transport(&client, &transport) != 1
+		|| tls_memory_pair_get_transport(pair, 1, &transport) != 1
+		|| tls_set_transport(&server, &transport) != 1
+		|| tls_set_handshake_stats(&client, &client_stats) != 1
+		|| tls_set_handshake_stats(&server, &server_stats) != 1
+		|| tls_transport_is_socket(&server.transport)) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 100 && !(client_done && server_done); i++) {
+		if (!client_done) {
+			if ((rv = tls_do_handshake(&client)) == 1) {
+				client_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				goto end;
+			}
+		}
+		if (!server_done) {
+			if ((rv = tls_do_handshake(&server)) == 1) {
+				server_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+	if (!client_done || !server_done) {
+		error_print();
+		goto end;
+	}
+	if (!client_stats.nsec[TLS_phase_key_exchange]
+		|| !client_stats.nsec[TLS_phase_key_schedule]
+		|| !server_stats.nsec[TLS_phase_key_exchange]
+		|| !server_stats.nsec[TLS_phase_signature]
+		|| !server_stats.nsec[TLS_phase_key_schedule]) {
+		error_print();
+		goto end;
+	}
+
+	if (protocol == TLS_protocol_tls13) {
+		if (tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+			|| tls13_recv(&server, buf, sizeof(buf), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	} else {
+		if (tls_send(&client, (uint8_t *)"hello", 5, &len) != 1
+			|| tls_recv(&server, buf, sizeof(buf), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// the peer has closed and the pipe is drained
+	tls_memory_pair_close(pair, 0);
+	tls_memory_pair_get_transport(pair, 1, &transport);
+	if (transport.recv(transport.arg, buf, sizeof(buf)) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	tls_memory_pair_free(pair);
+	return ret;
+}
+
+static int test_tls_in_place(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	static uint8_t bigbuf[TLS_RECORD_HEADROOM + TLS_MAX_PLAINTEXT_SIZE + TLS_RECORD_TAILROOM];
+	uint8_t sendbuf[TLS_RECORD_HEADROOM + 3000 + TLS_RECORD_TAILROOM];
+	uint8_t *recvbuf = NULL;
+	uint8_t buf[64];
+	uint8_t *data;
+	size_t datalen;
+	size_t len;
+	size_t i, n;
+	int tls13 = protocol == TLS_protocol_tls13;
+	int pending;
+	int rv = -1;
+	int ret = -1;
+
+	if (!(recvbuf = (uint8_t *)malloc(TLS_MAX_RECORD_SIZE))) {
+		error_print();
+		return -1;
+	}
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		free(recvbuf);
+		return -1;
+	}
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// in-place send, in-place recv
+	for (i = 0; i < 3000; i++) {
+		sendbuf[TLS_RECORD_HEADROOM + i] = (uint8_t)i;
+	}
+	if ((tls13 ? tls13_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)
+			: tls_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)) != TLS_ERROR_WANT_READ
+		|| (tls13 ? tls13_send_in_place(&client, sendbuf, sizeof(sendbuf), 3000, &len)
+			: tls_send_in_place(&client, sendbuf, sizeof(sendbuf), 3000, &len)) != 1
+		|| len != 3000
+		|| (tls13 ? tls13_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)
+			: tls_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)) != 1
+		|| datalen != 3000 || data < recvbuf || data + datalen > recvbuf + TLS_MAX_RECORD_SIZE) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 3000; i++) {
+		if (data[i] != (uint8_t)i) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// interoperates with the copying calls
+	memcpy(sendbuf + TLS_RECORD_HEADROOM, "hello", 5);
+	if ((tls13 ? tls13_send_in_place(&server, sendbuf, sizeof(sendbuf), 5, &len)
+			: tls_send_in_place(&server, sendbuf, sizeof(sendbuf), 5, &len)) != 1
+		|| (tls13 ? tls13_recv(&client, buf, sizeof(buf), &len)
+			: tls_recv(&client, buf, sizeof(buf), &len)) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0
+		|| (tls13 ? tls13_send(&client, (uint8_t *)"world", 5, &len)
+			: tls_send(&client, (uint8_t *)"world", 5, &len)) != 1
+		|| (tls13 ? tls13_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)
+			: tls_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)) != 1
+		|| datalen != 5 || memcmp(data, "world", 5) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// fill the socket, the unsent tail is queued and flushed by the retry
+	for (n = 0; n < 64; n++) {
+		memset(bigbuf + TLS_RECORD_HEADROOM, (int)n, TLS_MAX_PLAINTEXT_SIZE);
+		if ((rv = tls13 ? tls13_send_in_place(&client, bigbuf, sizeof(bigbuf), TLS_MAX_PLAINTEXT_SIZE, &len)
+				: tls_send_in_place(&client, bigbuf, sizeof(bigbuf), TLS_MAX_PLAINTEXT_SIZE, &len)) != 1) {
+			break;
+		}
+	}
+	if (rv != TLS_ERROR_WANT_WRITE || !client.sendbuf_len) {
+		error_print();
+		goto end;
+	}
+	pending = 1;
+	for (i = 0; i <= n; ) {
+		rv = tls13 ? tls13_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen)
+			: tls_recv_in_place(&server, recvbuf, TLS_MAX_RECORD_SIZE, &data, &datalen);
+		if (rv == 1) {
+			if (datalen != TLS_MAX_PLAINTEXT_SIZE || data[0] != (uint8_t)i || data[datalen - 1] != (uint8_t)i) {
+				error_print();
+				goto end;
+			}
+			i++;
+		} else if (rv != TLS_ERROR_WANT_READ || !pending) {
+			error_print();
+			goto end;
+		}
+		if (pending) {
+			rv = tls13 ? tls13_send_in_place(&client, bigbuf, sizeof(bigbuf), TLS_MAX_PLAINTEXT_SIZE, &len)
+				: tls_send_in_place(&client, bigbuf, sizeof(bigbuf), TLS_MAX_PLAINTEXT_SIZE, &len);
+			if (rv == 1) {
+				if (len != TLS_MAX_PLAINTEXT_SIZE) {
+					error_print();
+					goto end;
+				}
+				pending = 0;
+			} else if (rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+
+	// no room for the tag
+	if ((tls13 ? tls13_send_in_place(&client, sendbuf, TLS_RECORD_HEADROOM + 5, 5, &len)
+			: tls_send_in_place(&client, sendbuf, TLS_RECORD_HEADROOM + 5, 5, &len)) != -1) {
+		error_print();
+		goto end;
+	}
+	if (client.record || client.databuf || client.sendbuf
+		|| server.record || server.databuf || server.sendbuf) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	free(recvbuf);
+	return ret;
+}
+
+static int test_tls_sendv(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	static uint8_t msg[45000];
+	static uint8_t buf[45000];
+	TLS_IOVEC iov[101];
+	size_t lens[] = { 10000, 0, 20000, 15000 };
+	size_t len, total;
+	size_t i, n;
+	int tls13 = protocol == TLS_protocol_tls13;
+	int rv;
+	int ret = -1;
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(msg); i++) {
+		msg[i] = (uint8_t)(i * 7);
+	}
+
+	// small messages are packed into one record
+	for (i = 0; i < 100; i++) {
+		iov[i].base = msg + i * 10;
+		iov[i].len = 10;
+	}
+	iov[100].base = NULL;
+	iov[100].len = 0;
+	if ((tls13 ? tls13_sendv(&client, iov, 101, &len) : tls_sendv(&client, iov, 101, &len)) != 1
+		|| len != 1000
+		|| (tls13 ? tls13_recv(&server, buf, sizeof(buf), &len)
+			: tls_recv(&server, buf, sizeof(buf), &len)) != 1
+		|| len != 1000 || memcmp(buf, msg, 1000) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// large vectors are cut into full records regardless of the entry boundaries
+	for (i = 0, total = 0; i < sizeof(lens)/sizeof(lens[0]); i++) {
+		iov[i].base = msg + total;
+		iov[i].len = lens[i];
+		total += lens[i];
+	}
+	if ((tls13 ? tls13_sendv(&client, iov, i, &len) : tls_sendv(&client, iov, i, &len)) != 1
+		|| len != total) {
+		error_print();
+		goto end;
+	}
+	for (n = 0; n < total; n += len) {
+		rv = tls13 ? tls13_recv(&server, buf + n, sizeof(buf) - n, &len)
+			: tls_recv(&server, buf + n, sizeof(buf) - n, &len);
+		if (rv != 1 || len != (total - n < TLS_MAX_PLAINTEXT_SIZE ? total - n : TLS_MAX_PLAINTEXT_SIZE)) {
+			error_print();
+			goto end;
+		}
+	}
+	if (memcmp(buf, msg, total) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// nothing to send
+	if ((tls13 ? tls13_sendv(&client, iov, 0, &len) : tls_sendv(&client, iov, 0, &len)) != -1
+		|| (tls13 ? tls13_sendv(&client, iov + 100, 1, &len) : tls_sendv(&client, iov + 100, 1, &len)) != -1) {
+		error_print();
+		goto end;
+	}
+	if (client.record || client.databuf || client.sendbuf
+		|| server.record || server.databuf || server.sendbuf) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// records of several connections sealed together, one connection may have more than one job
+static int test_tls_send_batch(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT clients[3];
+	TLS_CONNECT servers[3];
+	int socks[3][2] = { { -1, -1 }, { -1, -1 }, { -1, -1 } };
+	int want_read;
+	static uint8_t msg[20000];
+	static uint8_t buf[20000];
+	TLS_SEND_JOB jobs[5];
+	size_t lens[5] = { 1, 100, 5000, 19000, 0 };
+	size_t conns[5] = { 0, 1, 0, 2, 1 };
+	int tls13 = protocol == TLS_protocol_tls13;
+	size_t len, i;
+	int ret = -1;
+
+	memset(clients, 0, sizeof(clients));
+	memset(servers, 0, sizeof(servers));
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 3; i++) {
+		if (test_handshake(&clients[i], &client_ctx, NULL, &servers[i], &server_ctx, socks[i], &want_read) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	for (i = 0; i < sizeof(msg); i++) {
+		msg[i] = (uint8_t)(i * 3);
+	}
+
+	for (i = 0; i < 5; i++) {
+		jobs[i].conn = &clients[conns[i]];
+		jobs[i].data = msg + i;
+		jobs[i].datalen = lens[i];
+	}
+	if (tls_send_batch(jobs, 5) != 1) {
+		error_print();
+		goto end;
+	}
+	// one record per job, the empty job fails
+	for (i = 0; i < 5; i++) {
+		if (!lens[i]) {
+			if (jobs[i].ret == 1) {
+				error_print();
+				goto end;
+			}
+			continue;
+		}
+		len = lens[i] < TLS_MAX_PLAINTEXT_SIZE ? lens[i] : TLS_MAX_PLAINTEXT_SIZE;
+		if (jobs[i].ret != 1 || jobs[i].sentlen != len) {
+			error_print();
+			goto end;
+		}
+		if ((tls13 ? tls13_recv(&servers[conns[i]], buf, sizeof(buf), &len)
+			: tls_recv(&servers[conns[i]], buf, sizeof(buf), &len)) != 1
+			|| len != jobs[i].sentlen || memcmp(buf, msg + i, len) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	for (i = 0; i < 3; i++) {
+		if (clients[i].sendbuf || clients[i].record || clients[i].databuf) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	for (i = 0; i < 3; i++) {
+		tls_cleanup(&clients[i]);
+		tls_cleanup(&servers[i]);
+		if (socks[i][0] >= 0) close(socks[i][0]);
+		if (socks[i][1] >= 0) close(socks[i][1]);
+	}
+	return ret;
+}
+
+#ifdef ENABLE_TLS_SERVER
+static int test_server_upper(void *arg, const uint8_t *in, size_t inlen, uint8_t *out, size_t *outlen)
+{
+	size_t i;
+
+	if (inlen == 4 && memcmp(in, "quit", 4) == 0) {
+		return 0;
+	}
+	for (i = 0; i < inlen; i++) {
+		out[i] = (in[i] >= 'a' && in[i] <= 'z') ? in[i] - 'a' + 'A' : in[i];
+	}
+	*outlen = inlen;
+	(*(int *)arg)++;
+	return 1;
+}
+
+typedef struct {
+	TLS_SERVER *server;
+	int done;
+	int ret;
+	size_t reads;
+} TEST_STATS_READER;
+
+// read while the loops count, the counters only grow
+static void *test_server_stats_reader(void *arg)
+{
+	TEST_STATS_READER *reader = (TEST_STATS_READER *)arg;
+	TLS_SERVER_STATS stats;
+	TLS_SERVER_STATS last;
+
+	memset(&last, 0, sizeof(last));
+	reader->ret = 1;
+	while (!__atomic_load_n(&reader->done, __ATOMIC_ACQUIRE)) {
+		if (tls_server_get_stats(reader->server, &stats) != 1
+			|| stats.connections < last.connections
+			|| stats.handshakes < last.handshakes
+			|| stats.records_received < last.records_received
+			|| stats.bytes_sent < last.bytes_sent) {
+			error_print();
+			reader->ret = -1;
+			break;
+		}
+		last = stats;
+		reader->reads++;
+	}
+	return NULL;
+}
+
+static int test_tls_server(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX tls12_ctx;
+	TLS_CONNECT client;
+	TLS_SERVER *server = NULL;
+	TLS_SERVER_STATS stats;
+	struct sockaddr_in addr;
+	int tls13 = protocol == TLS_protocol_tls13;
+	int calls = 0;
+	int sock = -1;
+	TEST_STATS_READER reader;
+	pthread_t reader_thread;
+	int reader_started = 0;
+	uint8_t buf[64];
+	size_t len, n;
+	int i, rv;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&reader, 0, sizeof(reader));
+	if (tls_ctx_init(&tls12_ctx, TLS_protocol_tls12, TLS_server_mode) != 1
+		|| tls_server_new(&tls12_ctx, 0, 1) != NULL) {
+		error_print();
+		return -1;
+	}
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| !(server = tls_server_new(&server_ctx, 0, 2))
+		|| tls_server_set_handler(server, test_server_upper, &calls) != 1
+		|| tls_server_start(server) != 1
+		|| tls_server_set_handler(server, NULL, NULL) != -1) {
+		error_print();
+		goto end;
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	addr.sin_port = htons(tls_server_get_port(server));
+
+	reader.server = server;
+	if (pthread_create(&reader_thread, NULL, test_server_stats_reader, &reader) != 0) {
+		error_print();
+		goto end;
+	}
+	reader_started = 1;
+
+	for (i = 0; i < 4; i++) {
+		if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0
+			|| connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0
+			|| tls_init(&client, &client_ctx) != 1
+			|| tls_set_socket(&client, sock) != 1
+			|| tls_do_handshake(&client) != 1) {
+			error_print();
+			goto end;
+		}
+		for (n = 0; n < 3; n++) {
+			if ((tls13 ? tls13_send(&client, (uint8_t *)"hello", 5, &len)
+					: tls_send(&client, (uint8_t *)"hello", 5, &len)) != 1
+				|| (tls13 ? tls13_recv(&client, buf, sizeof(buf), &len)
+					: tls_recv(&client, buf, sizeof(buf), &len)) != 1
+				|| len != 5 || memcmp(buf, "HELLO", 5) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+		// the handler closes the connection
+		if (i == 3) {
+			if ((tls13 ? tls13_send(&client, (uint8_t *)"quit", 4, &len)
+					: tls_send(&client, (uint8_t *)"quit", 4, &len)) != 1
+				|| (tls13 ? tls13_recv(&client, buf, sizeof(buf), &len)
+					: tls_recv(&client, buf, sizeof(buf), &len)) != 0) {
+				error_print();
+				goto end;
+			}
+		}
+		tls_cleanup(&client);
+		close(sock);
+		sock = -1;
+	}
+
+	// the loops see the closes asynchronously
+	for (i = 0; i < 1000; i++) {
+		if (tls_server_get_stats(server, &stats) != 1) {
+			error_print();
+			goto end;
+		}
+		if (!stats.connections_active) {
+			break;
+		}
+		usleep(1000);
+	}
+	__atomic_store_n(&reader.done, 1, __ATOMIC_RELEASE);
+	pthread_join(reader_thread, NULL);
+	reader_started = 0;
+	if (reader.ret != 1 || !reader.reads) {
+		error_print();
+		goto end;
+	}
+	if (stats.connections != 4 || stats.connections_active || stats.handshakes != 4
+		|| stats.records_received != 13 || stats.records_sent != 12
+		|| stats.bytes_sent != 60 || stats.errors || calls != 12) {
+		error_print();
+		goto end;
+	}
+	if ((rv = tls_server_stop(server)) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	if (reader_started) {
+		__atomic_store_n(&reader.done, 1, __ATOMIC_RELEASE);
+		pthread_join(reader_thread, NULL);
+	}
+	tls_cleanup(&client);
+	if (sock >= 0) close(sock);
+	tls_server_free(server);
+	return ret;
+}
+
+static int test_pool_request(TLS_CONNECT *conn, const char *msg)
+{
+	int tls13 = conn->protocol == TLS_protocol_tls13;
+	uint8_t buf[64];
+	size_t len, i;
+
+	if ((tls13 ? tls13_send(conn, (uint8_t *)msg, strlen(msg), &len)
+			: tls_send(conn, (uint8_t *)msg, strlen(msg), &len)) != 1
+		|| (tls13 ? tls13_recv(conn, buf, sizeof(buf), &len)
+			: tls_recv(conn, buf, sizeof(buf), &len)) != 1
+		|| len != strlen(msg)) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < len; i++) {
+		if (buf[i] != (msg[i] >= 'a' && msg[i] <= 'z' ? msg[i] - 'a' + 'A' : msg[i])) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+typedef struct {
+	TLS_CLIENT_POOL *pool;
+	const TLS_CTX *ctx;
+	int port;
+	int ret;
+} TEST_POOL_THREAD;
+
+static void *test_pool_thread(void *arg)
+{
+	TEST_POOL_THREAD *t = (TEST_POOL_THREAD *)arg;
+	TLS_CONNECT *conn;
+	int i;
+
+	t->ret = -1;
+	for (i = 0; i < 20; i++) {
+		if (tls_client_pool_connect(t->pool, t->ctx, "localhost", t->port, &conn) != 1) {
+			error_print();
+			return NULL;
+		}
+		if (test_pool_request(conn, "hello") != 1) {
+			tls_client_pool_release(t->pool, conn, 0);
+			error_print();
+			return NULL;
+		}
+		tls_client_pool_release(t->pool, conn, 1);
+	}
+	t->ret = 1;
+	return NULL;
+}
+
+static int test_tls_client_pool(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_SESSION_CACHE *cache = NULL;
+	TLS_SERVER *server = NULL;
+	TLS_CLIENT_POOL *pool = NULL;
+	TLS_CLIENT_POOL_STATS stats;
+	TLS_CONNECT *conn;
+	TLS_CONNECT *conn2;
+	TEST_POOL_THREAD threads[2];
+	pthread_t tids[2];
+	fd_set fds;
+	struct timeval tv;
+	size_t len;
+	int calls = 0;
+	int port;
+	int i;
+	int ret = -1;
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+	if (protocol == TLS_protocol_tls13) {
+		if (tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (!(cache = tls_session_cache_new(64, TLS_SESSION_CACHE_TIMEOUT))
+			|| tls_ctx_set_session_cache(&server_ctx, cache) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (!(server = tls_server_new(&server_ctx, 0, 2))
+		|| tls_server_set_handler(server, test_server_upper, &calls) != 1
+		|| tls_server_start(server) != 1
+		|| !(pool = tls_client_pool_new(4, 5))) {
+		error_print();
+		goto end;
+	}
+	port = tls_server_get_port(server);
+
+	// full handshake, then the released connection is taken again
+	if (tls_client_pool_connect(pool, &client_ctx, "localhost", port, &conn) != 1
+		|| tls_session_reused(conn)
+		|| test_pool_request(conn, "hello") != 1) {
+		error_print();
+		goto end;
+	}
+	tls_client_pool_release(pool, conn, 1);
+	if (tls_client_pool_idle_count(pool) != 1
+		|| tls_client_pool_connect(pool, &client_ctx, "localhost", port, &conn2) != 1
+		|| conn2 != conn
+		|| tls_client_pool_idle_count(pool) != 0
+		|| test_pool_request(conn, "world") != 1) {
+		error_print();
+		goto end;
+	}
+
+	// the server closes the idle connection, the next one resumes the session
+	if ((protocol == TLS_protocol_tls13 ? tls13_send(conn, (uint8_t *)"quit", 4, &len)
+			: tls_send(conn, (uint8_t *)"quit", 4, &len)) != 1) {
+		error_print();
+		goto end;
+	}
+	FD_ZERO(&fds);
+	FD_SET(conn->sock, &fds);
+	tv.tv_sec = 5;
+	tv.tv_usec = 0;
+	if (select(conn->sock + 1, &fds, NULL, NULL, &tv) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_client_pool_release(pool, conn, 1);
+	if (tls_client_pool_connect(pool, &client_ctx, "localhost", port, &conn) != 1
+		|| !tls_session_reused(conn)
+		|| test_pool_request(conn, "again") != 1) {
+		error_print();
+		goto end;
+	}
+	tls_client_pool_release(pool, conn, 1);
+
+	// threads share the pool
+	for (i = 0; i < 2; i++) {
+		threads[i].pool = pool;
+		threads[i].ctx = &client_ctx;
+		threads[i].port = port;
+		threads[i].ret = -1;
+		if (pthread_create(&tids[i], NULL, test_pool_thread, &threads[i]) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+	for (i = 0; i < 2; i++) {
+		pthread_join(tids[i], NULL);
+		if (threads[i].ret != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (tls_client_pool_get_stats(pool, &stats) != 1
+		|| stats.connects + stats.reused != 43
+		|| stats.resumed != stats.connects - 1
+		|| tls_client_pool_idle_count(pool) != stats.connects - 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_client_pool_free(pool);
+	tls_server_free(server);
+	tls_session_cache_free(cache);
+	return ret;
+}
+#endif
+
+#ifdef ENABLE_KTLS
+static int test_tcp_pair(int sock[2])
+{
+	struct sockaddr_in addr;
+	socklen_t addrlen = sizeof(addr);
+	int listener;
+
+	if ((listener = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+		error_print();
+		return -1;
+	}
+	memset(&addr, 0, sizeof(addr));
+	addr.sin_family = AF_INET;
+	addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+	if (bind(listener, (struct sockaddr *)&addr, sizeof(addr)) != 0
+		|| listen(listener, 1) != 0
+		|| getsockname(listener, (struct sockaddr *)&addr, &addrlen) != 0
+		|| (sock[0] = socket(AF_INET, SOCK_STREAM, 0)) < 0
+		|| connect(sock[0], (struct sockaddr *)&addr, sizeof(addr)) != 0
+		|| (sock[1] = accept(listener, NULL, NULL)) < 0) {
+		close(listener);
+		error_print();
+		return -1;
+	}
+	close(listener);
+	return 1;
+}
+
+// the kernel might not have the `tls` module, then the records stay in user space
+static int test_tls13_ktls(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[256];
+	TLS_IOVEC iov[2];
+	size_t len;
+	FILE *fp = NULL;
+	off_t offset = 0;
+	int i;
+	int ret = -1;
+
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1
+		|| tls_ctx_enable_ktls(&client_ctx, 1) != 1
+		|| tls_ctx_enable_ktls(&server_ctx, 1) != 1
+		|| test_tcp_pair(sock) != 1) {
+		error_print();
+		return -1;
+	}
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_handshake_on(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// the client reads the NewSessionTicket before the data
+	if (tls13_send(&server, (uint8_t *)"hello", 5, &len) != 1 || len != 5) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 1000 && (ret = tls13_recv(&client, buf, sizeof(buf), &len)) == TLS_ERROR_WANT_READ; i++) {
+		usleep(1000);
+	}
+	if (ret != 1 || len != 5 || memcmp(buf, "hello", 5) != 0 || !client.session.ticketlen) {
+		error_print();
+		ret = -1;
+		goto end;
+	}
+	ret = -1;
+
+	// one sendmsg() when offloaded
+	iov[0].base = "hello ";
+	iov[0].len = 6;
+	iov[1].base = "world";
+	iov[1].len = 5;
+	if (tls13_sendv(&server, iov, 2, &len) != 1 || len != 11) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 1000 && (ret = tls13_recv(&client, buf, sizeof(buf), &len)) == TLS_ERROR_WANT_READ; i++) {
+		usleep(1000);
+	}
+	if (ret != 1 || len != 11 || memcmp(buf, "hello world", 11) != 0) {
+		error_print();
+		ret = -1;
+		goto end;
+	}
+	ret = -1;
+
+	if (tls_ktls_enabled(&server) & TLS_KTLS_TX) {
+		if (!(fp = tmpfile())
+			|| fwrite("static content", 1, 14, fp) != 14
+			|| fflush(fp) != 0
+			|| tls13_sendfile(&server, fileno(fp), &offset, 14, &len) != 1 || len != 14) {
+			error_print();
+			goto end;
+		}
+		for (i = 0; i < 1000 && (ret = tls13_recv(&client, buf, sizeof(buf), &len)) == TLS_ERROR_WANT_READ; i++) {
+			usleep(1000);
+		}
+		if (ret != 1 || len != 14 || memcmp(buf, "static content", 14) != 0) {
+			error_print();
+			ret = -1;
+			goto end;
+		}
+		ret = -1;
+	} else if (tls13_sendfile(&server, 0, NULL, 1, &len) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok, kernel tx %d rx %d\n", __FUNCTION__,
+		(tls_ktls_enabled(&server) & TLS_KTLS_TX) != 0, (tls_ktls_enabled(&server) & TLS_KTLS_RX) != 0);
+	ret = 1;
+end:
+	if (fp) fclose(fp);
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+#endif
+
+static int test_tls13_resumption(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_SESSION session;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// full handshake, the client reads the NewSessionTicket with the next record
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_session_reused(&client) || tls_session_reused(&server)
+		|| tls13_recv(&client, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ
+		|| tls_get_session(&client, &session) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// resumed handshake, the client does not need the CA certificate
+	client_ctx.cacerts = NULL;
+	client_ctx.cacertslen = 0;
+	if (test_handshake(&client, &client_ctx, &session, &server, &server_ctx, sock, &want_read) != 1
+		|| !tls_session_reused(&client) || !tls_session_reused(&server)
+		|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a server with a new ticket key falls back to a full handshake
+	client_ctx.cacerts = test_cacert;
+	client_ctx.cacertslen = test_cacertlen;
+	if (tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1
+		|| test_handshake(&client, &client_ctx, &session, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_session_reused(&client) || tls_session_reused(&server)) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+static int test_tls_replay_cache(void)
+{
+	TLS_REPLAY_CACHE *cache;
+	uint8_t id[32] = {0};
+	time_t now = time(NULL);
+	int i;
+	int ret = -1;
+
+	if (!(cache = tls_replay_cache_new(16))) {
+		error_print();
+		return -1;
+	}
+	if (tls_replay_cache_add(cache, id, sizeof(id)) != 1
+		|| tls_replay_cache_add(cache, id, sizeof(id)) != 0) {
+		error_print();
+		goto end;
+	}
+	// a full cache rejects, the client falls back to 1-RTT
+	for (i = 1; i < 16; i++) {
+		id[0] = (uint8_t)i;
+		if (tls_replay_cache_add(cache, id, sizeof(id)) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	id[0] = 16;
+	if (tls_replay_cache_add(cache, id, sizeof(id)) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_replay_cache_free(cache);
+
+	// the clock goes back, nothing is forgotten and nothing is taken for a window
+	if (!(cache = tls_replay_cache_new(16))) {
+		error_print();
+		return -1;
+	}
+	id[0] = 0;
+	if (tls_replay_cache_add_at(cache, id, sizeof(id), now) != 1) {
+		error_print();
+		goto end;
+	}
+	now -= 100;
+	id[0] = 1;
+	if (tls_replay_cache_add_at(cache, id, sizeof(id), now) != 0
+		|| tls_replay_cache_add_at(cache, id, sizeof(id), now + TLS13_EARLY_DATA_REPLAY_WINDOW - 1) != 0) {
+		error_print();
+		goto end;
+	}
+	now += TLS13_EARLY_DATA_REPLAY_WINDOW;
+	if (tls_replay_cache_add_at(cache, id, sizeof(id), now) != 1) {
+		error_print();
+		goto end;
+	}
+	id[0] = 0;
+	if (tls_replay_cache_add_at(cache, id, sizeof(id), now) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_replay_cache_free(cache);
+	return ret;
+}
+
+static int test_tls13_early_data(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_SESSION session;
+	TLS_REPLAY_CACHE *cache = NULL;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t early_data[40000];
+	const uint8_t *data;
+	size_t datalen;
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	rand_bytes(early_data, sizeof(early_data));
+
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1
+		|| !(cache = tls_replay_cache_new(1024))) {
+		error_print();
+		goto end;
+	}
+	if (tls_ctx_set_early_data(&client_ctx, sizeof(early_data), cache) != -1
+		|| tls_ctx_set_early_data(&server_ctx, sizeof(early_data), NULL) != -1
+		|| tls_ctx_set_early_data(&server_ctx, TLS13_MAX_EARLY_DATA_SIZE + 1, cache) != -1
+		|| tls_ctx_set_early_data(&server_ctx, sizeof(early_data), cache) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// full handshake, the ticket allows early data
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls13_set_early_data(&client, early_data, 16) != -1
+		|| tls13_recv(&client, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ
+		|| tls_get_session(&client, &session) != 1
+		|| session.max_early_data_size != sizeof(early_data)) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// resumed handshake with 0-RTT over several records
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+		|| test_handshake_init(&client, &client_ctx, &session, &server, &server_ctx, sock) != 1
+		|| tls13_set_early_data(&client, early_data, sizeof(early_data) + 1) != -1
+		|| tls13_set_early_data(&client, early_data, sizeof(early_data)) != 1
+		|| test_handshake_run(&client, &server, &want_read) != 1
+		|| !tls_session_reused(&client) || !tls_session_reused(&server)
+		|| tls13_early_data_status(&client) != TLS_early_data_accepted
+		|| tls13_early_data_status(&server) != TLS_early_data_accepted
+		|| tls13_get_early_data(&server, &data, &datalen) != 1
+		|| datalen != sizeof(early_data) || memcmp(data, early_data, datalen) != 0
+		|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a ticket age out of the window falls back to 1-RTT, the server skips the early data
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	session.time -= 100;
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+		|| test_handshake_init(&client, &client_ctx, &session, &server, &server_ctx, sock) != 1
+		|| tls13_set_early_data(&client, early_data, sizeof(early_data)) != 1
+		|| test_handshake_run(&client, &server, &want_read) != 1
+		|| !tls_session_reused(&server)
+		|| tls13_early_data_status(&client) != TLS_early_data_rejected
+		|| tls13_early_data_status(&server) != TLS_early_data_rejected
+		|| tls13_get_early_data(&server, &data, &datalen) != 0
+		|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_replay_cache_free(cache);
+	return ret;
+}
+
+// the OCSP responder, signs the status given in `arg` with the test CA key
+static int test_ocsp_fetch(void *arg, const uint8_t *cert, size_t certlen,
+	const uint8_t *cacert, size_t cacertlen, uint8_t **resp, size_t *resplen)
+{
+	int cert_status = *(int *)arg;
+	time_t now = time(NULL);
+	uint8_t *p;
+
+	*resplen = 0;
+	if (x509_ocsp_response_sign_to_der(cert, certlen, cacert, cacertlen, cert_status, now - 60, now, now + 3600,
+		&test_ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, NULL, resplen) != 1
+		|| !(*resp = (uint8_t *)malloc(*resplen))) {
+		error_print();
+		return -1;
+	}
+	p = *resp;
+	*resplen = 0;
+	if (x509_ocsp_response_sign_to_der(cert, certlen, cacert, cacertlen, cert_status, now - 60, now, now + 3600,
+		&test_ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, resplen) != 1) {
+		error_print();
+		free(*resp);
+		return -1;
+	}
+	return 1;
+}
+
+static int test_tls_ocsp_stapling(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_OCSP_STAPLER *stapler = NULL;
+	int cert_status = X509_ocsp_cert_good;
+	const uint8_t *cert;
+	size_t certlen;
+	uint8_t resp[TLS_OCSP_MAX_RESPONSE_SIZE];
+	size_t resplen;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| x509_certs_get_cert_by_index(test_certs, test_certslen, 0, &cert, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	// the issuer of the server certificate is looked up in the CA certificates
+	client_ctx.cacerts = test_cacert;
+	client_ctx.cacertslen = test_cacertlen;
+
+	// no response before the first fetch
+	if (!(stapler = tls_ocsp_stapler_new(cert, certlen, test_cacert, test_cacertlen,
+			test_ocsp_fetch, &cert_status))
+		|| tls_ocsp_stapler_refresh(stapler) != 1
+		|| tls_ocsp_stapler_get(stapler, resp, &resplen, sizeof(resp)) != 1
+		|| tls_ctx_set_ocsp_stapler(&server_ctx, stapler) != 1
+		|| tls_ctx_set_ocsp_stapling(&client_ctx, TLS_ocsp_stapling_require) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// stapled good response
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_ocsp_status(&client) != X509_ocsp_cert_good) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a client not asking gets no response
+	client_ctx.ocsp_stapling = TLS_ocsp_stapling_off;
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_ocsp_status(&client) != -1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a revoked certificate fails the handshake
+	cert_status = X509_ocsp_cert_revoked;
+	client_ctx.ocsp_stapling = TLS_ocsp_stapling_request;
+	if (tls_ocsp_stapler_refresh(stapler) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != -1
+		|| tls_get_ocsp_status(&client) != X509_ocsp_cert_revoked) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// without a stapler the response is only required by TLS_ocsp_stapling_require
+	server_ctx.ocsp_stapler = NULL;
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_ocsp_status(&client) != -1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	client_ctx.ocsp_stapling = TLS_ocsp_stapling_require;
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_ocsp_stapler_free(stapler);
+	return ret;
+}
+
+static int test_tls13_cert_compression(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_OCSP_STAPLER *stapler = NULL;
+	int cert_status = X509_ocsp_cert_good;
+	int algors[] = {
+		TLS_cert_compression_zlib_sm,
+		TLS_cert_compression_brotli,
+		TLS_cert_compression_zlib,
+	};
+	int zlib = TLS_cert_compression_zlib;
+	int zlib_sm = TLS_cert_compression_zlib_sm;
+	int zstd = TLS_cert_compression_zstd;
+	const uint8_t *cert;
+	size_t certlen;
+	uint8_t buf[1024];
+	uint8_t out[1024];
+	size_t len;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	size_t i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| x509_certs_get_cert_by_index(test_certs, test_certslen, 0, &cert, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!tls_cert_compression_supported(TLS_cert_compression_zlib)) {
+		printf("%s() skipped, built without zlib\n", __FUNCTION__);
+		return 1;
+	}
+
+	// the dictionary is required by the zlib_sm data
+	if (tls_cert_compress(TLS_cert_compression_zlib_sm, cert, certlen, buf, &len, sizeof(buf)) != 1
+		|| tls_cert_decompress(TLS_cert_compression_zlib_sm, buf, len, out, certlen) != 1
+		|| memcmp(out, cert, certlen) != 0
+		|| tls_cert_decompress(TLS_cert_compression_zlib, buf, len, out, certlen) != -1
+		|| tls_cert_decompress(TLS_cert_compression_zlib_sm, buf, len, out, certlen - 1) != -1) {
+		error_print();
+		return -1;
+	}
+	if (tls_ctx_set_certificate_compression(&server_ctx, &zstd, 1) != -1) {
+		error_print();
+		return -1;
+	}
+
+	// each algorithm in the order of the server
+	for (i = 0; i < sizeof(algors)/sizeof(algors[0]); i++) {
+		if (!tls_cert_compression_supported(algors[i])) {
+			continue;
+		}
+		if (tls_ctx_set_certificate_compression(&client_ctx, &algors[i], 1) != 1
+			|| tls_ctx_set_certificate_compression(&server_ctx, &algors[i], 1) != 1
+			|| !server_ctx.compressed_certs[0]
+			|| server_ctx.compressed_certs_len[0] >= test_certslen) {
+			error_print();
+			goto end;
+		}
+		if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+			|| client.server_certs_len != test_certslen
+			|| memcmp(client.server_certs, test_certs, test_certslen) != 0) {
+			error_print();
+			goto end;
+		}
+		tls_cleanup(&client);
+		tls_cleanup(&server);
+		close(sock[0]);
+		close(sock[1]);
+	}
+
+	// no common algorithm, the Certificate is not compressed
+	if (tls_ctx_set_certificate_compression(&client_ctx, &zlib, 1) != 1
+		|| tls_ctx_set_certificate_compression(&server_ctx, &zlib_sm, 1) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// the chain with a stapled OCSP response is compressed in the handshake
+	client_ctx.cacerts = test_cacert;
+	client_ctx.cacertslen = test_cacertlen;
+	if (!(stapler = tls_ocsp_stapler_new(cert, certlen, test_cacert, test_cacertlen,
+			test_ocsp_fetch, &cert_status))
+		|| tls_ocsp_stapler_refresh(stapler) != 1
+		|| tls_ctx_set_ocsp_stapler(&server_ctx, stapler) != 1
+		|| tls_ctx_set_ocsp_stapling(&client_ctx, TLS_ocsp_stapling_require) != 1
+		|| tls_ctx_set_certificate_compression(&client_ctx, &zlib_sm, 1) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_ocsp_status(&client) != X509_ocsp_cert_good) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_ocsp_stapler_free(stapler);
+	free(server_ctx.compressed_certs[0]);
+	return ret;
+}
+
+// the context owns its certificates, freed by tls_ctx_free()
+static TLS_CTX *test_server_ctx_new(int protocol)
+{
+	TLS_CTX *ctx;
+
+	if (!(ctx = tls_ctx_new(protocol, TLS_server_mode))) {
+		error_print();
+		return NULL;
+	}
+	if (!(ctx->certs = (uint8_t *)malloc(test_certslen))) {
+		tls_ctx_free(ctx);
+		error_print();
+		return NULL;
+	}
+	memcpy(ctx->certs, test_certs, test_certslen);
+	ctx->certslen = test_certslen;
+	ctx->signkey = test_sign_key;
+	ctx->kenckey = test_enc_key;
+	ctx->quiet = 1;
+	return ctx;
+}
+
+static int test_tls_ctx_slot(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX *ctx = NULL;
+	TLS_CTX *new_ctx = NULL;
+	TLS_CTX *client_heap_ctx = NULL;
+	TLS_CTX_SLOT *slot = NULL;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(ctx = test_server_ctx_new(protocol))
+		|| !(slot = tls_ctx_slot_new(ctx))) {
+		tls_ctx_free(ctx);
+		error_print();
+		return -1;
+	}
+
+	// the connection points to the keys and the chain of the context
+	if (!(ctx = tls_ctx_slot_get(slot))
+		|| socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+		|| test_handshake_init(&client, &client_ctx, NULL, &server, ctx, sock) != 1
+		|| server.ctx != ctx
+		|| server.sign_key != &ctx->signkey
+		|| server.server_certs != ctx->certs
+		|| ctx->refs != 3) {
+		error_print();
+		goto end;
+	}
+	tls_ctx_free(ctx);
+
+	// rotated in the middle of the handshake, the old context lives until tls_cleanup()
+	if (!(new_ctx = test_server_ctx_new(protocol))
+		|| tls_ctx_slot_set(slot, new_ctx) != 1
+		|| ctx->refs != 1) {
+		error_print();
+		goto end;
+	}
+	if (test_handshake_run(&client, &server, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// new connections get the new context
+	if (!(ctx = tls_ctx_slot_get(slot))
+		|| ctx != new_ctx
+		|| test_handshake(&client, &client_ctx, NULL, &server, ctx, sock, &want_read) != 1
+		|| server.ctx != new_ctx) {
+		error_print();
+		goto end;
+	}
+	tls_ctx_free(ctx);
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// the slot keeps the protocol and the mode
+	if (!(client_heap_ctx = tls_ctx_new(protocol, TLS_client_mode))
+		|| tls_ctx_slot_set(slot, client_heap_ctx) != -1) {
+		error_print();
+		goto end;
+	}
+	if (new_ctx->refs != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_ctx_free(client_heap_ctx);
+	tls_ctx_slot_free(slot);
+	return ret;
+}
+
+// a context of another host under the test CA
+static TLS_CTX *test_host_ctx_new(int protocol, const char *cn)
+{
+	TLS_CTX *ctx;
+	uint8_t *p;
+
+	if (!(ctx = tls_ctx_new(protocol, TLS_server_mode))
+		|| !(ctx->certs = (uint8_t *)malloc(sizeof(test_certs)))) {
+		tls_ctx_free(ctx);
+		error_print();
+		return NULL;
+	}
+	p = ctx->certs;
+	if (sm2_key_generate(&ctx->signkey) != 1
+		|| test_cert_generate(cn, &ctx->signkey, "CA", &test_ca_key,
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, 0, &p, &ctx->certslen) != 1
+		|| (protocol == TLS_protocol_tlcp && (sm2_key_generate(&ctx->kenckey) != 1
+			|| test_cert_generate(cn, &ctx->kenckey, "CA", &test_ca_key, NULL, 0, 0,
+				X509_KU_KEY_ENCIPHERMENT|X509_KU_DATA_ENCIPHERMENT|X509_KU_KEY_AGREEMENT, 0,
+				&p, &ctx->certslen) != 1))) {
+		tls_ctx_free(ctx);
+		error_print();
+		return NULL;
+	}
+	ctx->quiet = 1;
+	return ctx;
+}
+
+static int test_server_name_callback(void *arg, const char *host, TLS_CTX **ctx)
+{
+	if (strcmp(host, "tenant.example.com") == 0) {
+		*ctx = tls_ctx_up_ref((TLS_CTX *)arg);
+		return 1;
+	}
+	if (strcmp(host, "blocked.example.com") == 0) {
+		return -1;
+	}
+	return 0;
+}
+
+static int test_server_name_handshake(TLS_CONNECT *client, const TLS_CTX *client_ctx,
+	TLS_CONNECT *server, const TLS_CTX *server_ctx, const char *host, int sock[2])
+{
+	int want_read;
+
+	memset(client, 0, sizeof(*client));
+	memset(server, 0, sizeof(*server));
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+		|| test_handshake_init(client, client_ctx, NULL, server, server_ctx, sock) != 1
+		|| (host && tls_set_server_name(client, host) != 1)) {
+		error_print();
+		return -1;
+	}
+	return test_handshake_run(client, server, &want_read);
+}
+
+static int test_tls_server_name(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX *host_ctx = NULL;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	const char *name;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| !(host_ctx = test_host_ctx_new(protocol, "tenant"))
+		|| tls_ctx_set_server_name_callback(&server_ctx, test_server_name_callback, host_ctx) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// the host certificates, the name is matched in lower case
+	if (test_server_name_handshake(&client, &client_ctx, &server, &server_ctx, "Tenant.Example.COM", sock) != 1
+		|| server.host_ctx != host_ctx
+		|| !(name = tls_get_server_name(&server))
+		|| strcmp(name, "tenant.example.com") != 0
+		|| client.server_certs_len != host_ctx->certslen
+		|| memcmp(client.server_certs, host_ctx->certs, host_ctx->certslen) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// other and missing names get the default certificates
+	if (test_server_name_handshake(&client, &client_ctx, &server, &server_ctx, "other.example.com", sock) != 1
+		|| server.host_ctx
+		|| client.server_certs_len != test_certslen
+		|| memcmp(client.server_certs, test_certs, test_certslen) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	if (test_server_name_handshake(&client, &client_ctx, &server, &server_ctx, NULL, sock) != 1
+		|| tls_get_server_name(&server) != NULL
+		|| client.server_certs_len != test_certslen) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// rejected by the callback
+	if (test_server_name_handshake(&client, &client_ctx, &server, &server_ctx, "blocked.example.com", sock) != -1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_ctx_free(host_ctx);
+	return ret;
+}
+
+static int test_record_send(TLS_CONNECT *conn, const uint8_t *data, size_t datalen, size_t *sentlen)
+{
+	if (conn->protocol == TLS_protocol_tls13) {
+		return tls13_send(conn, data, datalen, sentlen);
+	}
+	return tls_send(conn, data, datalen, sentlen);
+}
+
+static int test_record_recv(TLS_CONNECT *conn, uint8_t *buf, size_t buflen, size_t *len)
+{
+	if (conn->protocol == TLS_protocol_tls13) {
+		return tls13_recv(conn, buf, buflen, len);
+	}
+	return tls_recv(conn, buf, buflen, len);
+}
+
+static int test_tls_record_size(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t data[4096];
+	uint8_t buf[8192];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	memset(data, 'A', sizeof(data));
+
+	// the client receives records of at most 512 bytes, the server takes full ones
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| tls_ctx_set_record_size_limit(&client_ctx, 63) != -1
+		|| tls_ctx_set_max_fragment_length(&server_ctx, 1024) != -1
+		|| tls_ctx_set_record_size_limit(&client_ctx, 512) != 1
+		|| tls_ctx_set_max_fragment_length(&client_ctx, 1024) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_max_send_fragment(&server) != 512
+		|| tls_get_max_send_fragment(&client) != TLS_MAX_PLAINTEXT_SIZE
+		|| test_record_send(&server, data, 2000, &len) != 1 || len != 512
+		|| test_record_recv(&client, buf, sizeof(buf), &len) != 1 || len != 512
+		|| test_record_send(&client, data, 2000, &len) != 1 || len != 2000
+		|| test_record_recv(&server, buf, sizeof(buf), &len) != 1 || len != 2000) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// max_fragment_length without record_size_limit limits both directions
+	client_ctx.record_size_limit = 0;
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_max_send_fragment(&server) != 1024
+		|| tls_get_max_send_fragment(&client) != 1024
+		|| test_record_send(&client, data, 2000, &len) != 1 || len != 1024
+		|| test_record_recv(&server, buf, sizeof(buf), &len) != 1 || len != 1024) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// dynamic sizing starts with small records
+	client_ctx.max_fragment_length = 0;
+	if (tls_ctx_set_dynamic_record_sizing(&server_ctx, 1) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_get_max_send_fragment(&server) != TLS_MAX_PLAINTEXT_SIZE
+		|| test_record_send(&server, data, sizeof(data), &len) != 1 || len != TLS_DYNAMIC_RECORD_SMALL_SIZE
+		|| test_record_recv(&client, buf, sizeof(buf), &len) != 1 || len != TLS_DYNAMIC_RECORD_SMALL_SIZE) {
+		error_print();
+		goto end;
+	}
+	server.dynamic_record_bytes = TLS_DYNAMIC_RECORD_RAMP_BYTES;
+	if (test_record_send(&server, data, sizeof(data), &len) != 1 || len != sizeof(data)
+		|| test_record_recv(&client, buf, sizeof(buf), &len) != 1 || len != sizeof(data)) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// move the CRYPTO data of every level from one end to the other
+static int test_quic_transfer(TLS_QUIC *from, TLS_QUIC *to, size_t *transferred)
+{
+	uint8_t buf[1024];
+	size_t len;
+	int level;
+
+	*transferred = 0;
+	for (level = 0; level < TLS_QUIC_LEVELS; level++) {
+		do {
+			if (tls_quic_get_data(from, level, buf, sizeof(buf), &len) != 1
+				|| tls_quic_provide_data(to, level, buf, len) != 1) {
+				error_print();
+				return -1;
+			}
+			*transferred += len;
+		} while (len);
+	}
+	return 1;
+}
+
+static int test_quic_handshake(TLS_QUIC *client, TLS_QUIC *server)
+{
+	int client_done = 0;
+	int server_done = 0;
+	size_t len;
+	int rv;
+	int i;
+
+	for (i = 0; i < 10 && !(client_done && server_done); i++) {
+		if (!client_done) {
+			if ((rv = tls_quic_do_handshake(client)) == 1) {
+				client_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ) {
+				error_print();
+				return -1;
+			}
+		}
+		if (test_quic_transfer(client, server, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		if (!server_done) {
+			if ((rv = tls_quic_do_handshake(server)) == 1) {
+				server_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ) {
+				error_print();
+				return -1;
+			}
+		}
+		if (test_quic_transfer(server, client, &len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (!client_done || !server_done) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// 1-RTT packet: short header, 8-byte connection ID and a 2-byte packet number
+static size_t test_quic_packet(uint8_t *packet, uint64_t pn, const uint8_t *payload, size_t payload_len)
+{
+	memset(packet, 0xcc, 9);
+	packet[0] = 0x40 | 0x01;
+	packet[9] = (uint8_t)(pn >> 8);
+	packet[10] = (uint8_t)pn;
+	memcpy(packet + 11, payload, payload_len);
+	return 11;
+}
+
+static int test_tls13_quic(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_QUIC client_quic;
+	TLS_QUIC server_quic;
+	TLS_SESSION session;
+	TLS_QUIC_KEY write_key;
+	TLS_QUIC_KEY read_key;
+	TLS_QUIC_PACKET packets[100];
+	uint8_t client_secret[32];
+	uint8_t server_secret[32];
+	uint8_t buf[100][64 + TLS_QUIC_TAG_SIZE];
+	uint8_t sealed[64 + TLS_QUIC_TAG_SIZE];
+	uint8_t payload[40];
+	uint8_t *data;
+	size_t datalen;
+	uint64_t pn;
+	size_t len;
+	int level;
+	int i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	memset(&client_quic, 0, sizeof(client_quic));
+	memset(&server_quic, 0, sizeof(server_quic));
+	rand_bytes(payload, sizeof(payload));
+
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1
+		|| tls_init(&client, &client_ctx) != 1
+		|| tls_init(&server, &server_ctx) != 1
+		|| tls_quic_init(&client_quic, &client) != 1
+		|| tls_quic_init(&server_quic, &server) != 1
+		|| tls_quic_get_secret(&client_quic, TLS_QUIC_handshake, 1, client_secret) != 0) {
+		error_print();
+		goto end;
+	}
+	if (test_quic_handshake(&client_quic, &server_quic) != 1
+		|| tls_quic_get_alert(&client_quic) != -1
+		|| tls_quic_get_alert(&server_quic) != -1) {
+		error_print();
+		goto end;
+	}
+
+	// the write secrets of one end are the read secrets of the other
+	for (level = TLS_QUIC_handshake; level < TLS_QUIC_LEVELS; level++) {
+		if (tls_quic_get_secret(&client_quic, level, 1, client_secret) != 1
+			|| tls_quic_get_secret(&server_quic, level, 0, server_secret) != 1
+			|| memcmp(client_secret, server_secret, 32) != 0
+			|| tls_quic_get_secret(&client_quic, level, 0, client_secret) != 1
+			|| tls_quic_get_secret(&server_quic, level, 1, server_secret) != 1
+			|| memcmp(client_secret, server_secret, 32) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// NewSessionTicket in the application level CRYPTO data
+	if (!client_quic.inlen[TLS_QUIC_application]
+		|| tls_quic_process_post_handshake(&client_quic) != 1
+		|| tls_get_session(&client, &session) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// 1-RTT packets from the server
+	if (tls_quic_key_init(&write_key, server_secret) != 1
+		|| tls_quic_key_init(&read_key, client_secret) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 100; i++) {
+		packets[i].packet = buf[i];
+		packets[i].header_len = test_quic_packet(buf[i], 1000 + i, payload, sizeof(payload));
+		packets[i].pn_len = 2;
+		packets[i].payload_len = sizeof(payload);
+		packets[i].pn = 1000 + i;
+	}
+	if (tls_quic_packets_seal(&write_key, packets, 100) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 100; i++) {
+		TLS_QUIC_PACKET packet = packets[i];
+		size_t packetlen = packet.header_len + packet.payload_len + TLS_QUIC_TAG_SIZE;
+
+		// the batch seals as the packets one by one
+		packet.packet = sealed;
+		test_quic_packet(sealed, packet.pn, payload, sizeof(payload));
+		if (tls_quic_packet_seal(&write_key, &packet) != 1
+			|| memcmp(sealed, buf[i], packetlen) != 0) {
+			error_print();
+			goto end;
+		}
+		if (tls_quic_packet_open(&read_key, buf[i], packetlen, 9, 999 + i, &pn, &data, &datalen) != 1
+			|| pn != 1000 + (uint64_t)i
+			|| datalen != sizeof(payload)
+			|| memcmp(data, payload, sizeof(payload)) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// RFC 9000 A.3, the packet number 0xa82f9b32 sent in 2 bytes
+	packets[0].packet = buf[0];
+	packets[0].header_len = test_quic_packet(buf[0], 0x9b32, payload, sizeof(payload));
+	packets[0].pn = 0xa82f9b32;
+	len = packets[0].header_len + packets[0].payload_len + TLS_QUIC_TAG_SIZE;
+	if (tls_quic_packet_seal(&write_key, &packets[0]) != 1) {
+		error_print();
+		goto end;
+	}
+	memcpy(sealed, buf[0], len);
+	if (tls_quic_packet_open(&read_key, buf[0], len, 9, 0xa82f30ea, &pn, &data, &datalen) != 1
+		|| pn != 0xa82f9b32) {
+		error_print();
+		goto end;
+	}
+
+	// a modified packet or a packet of the old keys is dropped
+	sealed[len - 1] ^= 1;
+	if (tls_quic_packet_open(&read_key, sealed, len, 9, 0xa82f30ea, &pn, &data, &datalen) != 0
+		|| tls_quic_packet_open(&read_key, sealed, 20, 9, -1, &pn, &data, &datalen) != 0) {
+		error_print();
+		goto end;
+	}
+	packets[0].header_len = test_quic_packet(buf[0], 1, payload, sizeof(payload));
+	packets[0].pn = 1;
+	if (tls_quic_key_update(&write_key, server_secret) != 1
+		|| tls_quic_packet_seal(&write_key, &packets[0]) != 1) {
+		error_print();
+		goto end;
+	}
+	memcpy(sealed, buf[0], len);
+	if (tls_quic_packet_open(&read_key, sealed, len, 9, 0, &pn, &data, &datalen) != 0
+		|| tls_quic_key_update(&read_key, client_secret) != 1
+		|| tls_quic_packet_open(&read_key, buf[0], len, 9, 0, &pn, &data, &datalen) != 1
+		|| pn != 1 || memcmp(data, payload, sizeof(payload)) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_quic_key_cleanup(&write_key);
+	tls_quic_key_cleanup(&read_key);
+	tls_quic_cleanup(&client_quic);
+	tls_quic_cleanup(&server_quic);
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	return ret;
+}
+
+static int test_tls13_key_update(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t client_secret[32];
+	uint8_t server_secret[32];
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+	memcpy(client_secret, client.client_application_traffic_secret, 32);
+	memcpy(server_secret, client.server_application_traffic_secret, 32);
+
+	// the server answers the requested update before its next data
+	if (tls13_key_update(&client, 2) != -1
+		|| tls13_key_update(&client, TLS_key_update_requested) != 1
+		|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0
+		|| tls13_send(&server, (uint8_t *)"world", 5, &len) != 1
+		|| tls13_recv(&client, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "world", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	if (memcmp(client.client_application_traffic_secret, server.client_application_traffic_secret, 32) != 0
+		|| memcmp(client.server_application_traffic_secret, server.server_application_traffic_secret, 32) != 0
+		|| memcmp(client.client_application_traffic_secret, client_secret, 32) == 0
+		|| memcmp(client.server_application_traffic_secret, server_secret, 32) == 0) {
+		error_print();
+		goto end;
+	}
+
+	// the sending key is updated when the sequence number reaches the limit
+	memcpy(client_secret, client.client_application_traffic_secret, 32);
+	memset(client.client_seq_num, 0, 8);
+	client.client_seq_num[4] = 1;
+	memcpy(server.client_seq_num, client.client_seq_num, 8);
+	if (tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0
+		|| memcmp(client.client_application_traffic_secret, client_secret, 32) == 0
+		|| client.client_seq_num[7] != 1 || client.client_seq_num[4] != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// counts the send() and recv() calls on the socket
+typedef struct {
+	int sock;
+	int send_calls;
+	int recv_calls;
+} TEST_COUNTING_SOCKET;
+
+static tls_ret_t test_counting_send(void *arg, const uint8_t *buf, size_t len)
+{
+	TEST_COUNTING_SOCKET *counting = (TEST_COUNTING_SOCKET *)arg;
+	counting->send_calls++;
+	return send(counting->sock, buf, len, 0);
+}
+
+static tls_ret_t test_counting_recv(void *arg, uint8_t *buf, size_t len)
+{
+	TEST_COUNTING_SOCKET *counting = (TEST_COUNTING_SOCKET *)arg;
+	counting->recv_calls++;
+	return recv(counting->sock, buf, len, 0);
+}
+
+static int test_tls_read_ahead(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_TRANSPORT transport;
+	TEST_COUNTING_SOCKET counting;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t data[100];
+	uint8_t buf[4096];
+	size_t len;
+	int read_ahead;
+	int i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	memset(data, 'A', sizeof(data));
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1) {
+		error_print();
+		return -1;
+	}
+
+	for (read_ahead = 1; read_ahead >= 0; read_ahead--) {
+		if (tls_ctx_set_read_ahead(&server_ctx, read_ahead) != 1
+			|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+			error_print();
+			goto end;
+		}
+		counting.sock = sock[1];
+		counting.recv_calls = 0;
+		transport.send = test_counting_send;
+		transport.recv = test_counting_recv;
+		transport.arg = &counting;
+		if (tls_set_transport(&server, &transport) != 1) {
+			error_print();
+			goto end;
+		}
+
+		for (i = 0; i < 8; i++) {
+			if (test_record_send(&client, data, sizeof(data), &len) != 1 || len != sizeof(data)) {
+				error_print();
+				goto end;
+			}
+		}
+
+		// all the records in one recv(), or one record in two
+		if (tls_recv_batch(&server, buf, sizeof(buf), &len) != 1) {
+			error_print();
+			goto end;
+		}
+		if (read_ahead) {
+			if (len != 8 * sizeof(data) || counting.recv_calls != 1 || tls_pending(&server) != 0) {
+				error_print();
+				goto end;
+			}
+		} else {
+			if (len != sizeof(data) || counting.recv_calls != 2) {
+				error_print();
+				goto end;
+			}
+		}
+
+		// a partial batch leaves the rest buffered
+		if (read_ahead) {
+			for (i = 0; i < 2; i++) {
+				if (test_record_send(&client, data, sizeof(data), &len) != 1) {
+					error_print();
+					goto end;
+				}
+			}
+			if (tls_recv_batch(&server, buf, sizeof(data) + 10, &len) != 1 || len != sizeof(data) + 10
+				|| tls_pending(&server) != sizeof(data) - 10
+				|| tls_recv_batch(&server, buf, sizeof(buf), &len) != 1 || len != sizeof(data) - 10
+				|| counting.recv_calls != 2) {
+				error_print();
+				goto end;
+			}
+		}
+		tls_cleanup(&client);
+		tls_cleanup(&server);
+		close(sock[0]);
+		close(sock[1]);
+		sock[0] = sock[1] = -1;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	if (sock[0] >= 0) {
+		tls_cleanup(&client);
+		tls_cleanup(&server);
+		close(sock[0]);
+		close(sock[1]);
+	}
+	return ret;
+}
+
+// the records of one recv() are decrypted together and returned in order
+static int test_tls_recv_pipelined(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_TRANSPORT transport;
+	TEST_COUNTING_SOCKET counting;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t data[8][1000];
+	uint8_t buf[sizeof(data) + 1024];
+	size_t buflen;
+	size_t len;
+	int i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	for (i = 0; i < 8; i++) {
+		memset(data[i], 'a' + i, sizeof(data[i]));
+	}
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1) {
+		error_print();
+		goto end;
+	}
+	counting.sock = sock[1];
+	counting.recv_calls = 0;
+	transport.send = test_counting_send;
+	transport.recv = test_counting_recv;
+	transport.arg = &counting;
+	if (tls_set_transport(&server, &transport) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// all of them in one call
+	for (i = 0; i < 8; i++) {
+		if (test_record_send(&client, data[i], sizeof(data[i]), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (tls_recv_pipelined(&server, buf, sizeof(buf), &len) != 1
+		|| len != sizeof(data) || memcmp(buf, data, sizeof(data)) != 0
+		|| counting.recv_calls != 1 || tls_pending(&server) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// room for the ciphertexts of 3 records, the rest is left buffered
+	for (i = 0; i < 8; i++) {
+		if (test_record_send(&client, data[i], sizeof(data[i]), &len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (tls_recv_pipelined(&server, buf, 3 * 1100, &len) != 1 || len != 3 * sizeof(data[0])) {
+		error_print();
+		goto end;
+	}
+	for (buflen = len; buflen < sizeof(data); buflen += len) {
+		if (tls_recv_pipelined(&server, buf + buflen, sizeof(buf) - buflen, &len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (buflen != sizeof(data) || memcmp(buf, data, sizeof(data)) != 0 || counting.recv_calls != 2) {
+		error_print();
+		goto end;
+	}
+
+	// the records after a KeyUpdate are decrypted again under the new key
+	if (protocol == TLS_protocol_tls13) {
+		for (i = 0; i < 6; i++) {
+			if ((i == 3 && tls13_key_update(&client, TLS_key_update_not_requested) != 1)
+				|| test_record_send(&client, data[i], sizeof(data[i]), &len) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		for (buflen = 0; buflen < 6 * sizeof(data[0]); buflen += len) {
+			if (tls_recv_pipelined(&server, buf + buflen, sizeof(buf) - buflen, &len) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		if (buflen != 6 * sizeof(data[0]) || memcmp(buf, data, buflen) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	if (sock[0] >= 0) close(sock[0]);
+	if (sock[1] >= 0) close(sock[1]);
+	return ret;
+}
+
+static int test_tls12_accept_ret;
+
+static void *test_tls12_accept_thread(void *arg)
+{
+	test_tls12_accept_ret = tls_do_handshake((TLS_CONNECT *)arg);
+	return NULL;
+}
+
+// the blocking TLS 1.2 handshake sends each flight with one send()
+static int test_tls12_flights(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_TRANSPORT client_transport;
+	TLS_TRANSPORT server_transport;
+	TEST_COUNTING_SOCKET client_counting = { -1, 0, 0 };
+	TEST_COUNTING_SOCKET server_counting = { -1, 0, 0 };
+	int sock[2] = { -1, -1 };
+	pthread_t tid;
+	uint8_t buf[16];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+
+	if (test_certs_generate(TLS_protocol_tls12) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls12) != 1
+		|| socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0) {
+		error_print();
+		return -1;
+	}
+	client_counting.sock = sock[0];
+	server_counting.sock = sock[1];
+	client_transport.send = server_transport.send = test_counting_send;
+	client_transport.recv = server_transport.recv = test_counting_recv;
+	client_transport.arg = &client_counting;
+	server_transport.arg = &server_counting;
+
+	if (tls_init(&client, &client_ctx) != 1
+		|| tls_init(&server, &server_ctx) != 1
+		|| tls_set_socket(&client, sock[0]) != 1
+		|| tls_set_socket(&server, sock[1]) != 1
+		|| tls_set_transport(&client, &client_transport) != 1
+		|| tls_set_transport(&server, &server_transport) != 1) {
+		error_print();
+		goto end;
+	}
+	if (pthread_create(&tid, NULL, test_tls12_accept_thread, &server) != 0) {
+		error_print();
+		goto end;
+	}
+	if (tls_do_handshake(&client) != 1) {
+		error_print();
+		shutdown(sock[0], SHUT_RDWR);
+		pthread_join(tid, NULL);
+		goto end;
+	}
+	pthread_join(tid, NULL);
+	if (test_tls12_accept_ret != 1) {
+		error_print();
+		goto end;
+	}
+
+	// ClientHello, ClientKeyExchange to Finished; ServerHello to ServerHelloDone, ChangeCipherSpec and Finished
+	if (client_counting.send_calls != 2 || server_counting.send_calls != 2) {
+		error_print();
+		goto end;
+	}
+	if (tls_send(&client, (uint8_t *)"hello", 5, &len) != 1 || len != 5
+		|| tls_recv(&server, buf, sizeof(buf), &len) != 1 || len != 5
+		|| memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// the cached Certificate and CertificateRequest are those encoded in the handshake
+static int test_tls_handshake_messages(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t client_cert[1024];
+	size_t client_certlen = 0;
+	SM2_KEY client_key;
+	uint8_t *p = client_cert;
+	uint8_t record[TLS_MAX_RECORD_SIZE];
+	size_t recordlen;
+	uint8_t buf[16];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| sm2_key_generate(&client_key) != 1
+		|| test_cert_generate("client", &client_key, "CA", &test_ca_key,
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, 0, &p, &client_certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	client_ctx.certs = client_cert;
+	client_ctx.certslen = client_certlen;
+	client_ctx.signkey = client_key;
+	server_ctx.cacerts = test_cacert;
+	server_ctx.cacertslen = test_cacertlen;
+
+	if (tls_ctx_cache_handshake_messages(&client_ctx) != 1
+		|| tls_ctx_cache_handshake_messages(&server_ctx) != 1
+		|| !client_ctx.certificate_msg
+		|| client_ctx.certificate_request_msg
+		|| !server_ctx.certificate_msg
+		|| !server_ctx.certificate_request_msg) {
+		error_print();
+		goto end;
+	}
+
+	tls_record_set_protocol(record, protocol == TLS_protocol_tls13 ? TLS_protocol_tls12 : protocol);
+	if (protocol == TLS_protocol_tls13) {
+		if (tls13_record_set_handshake_certificate(record, &recordlen, NULL, 0,
+			test_certs, test_certslen, NULL, 0) != 1) {
+			error_print();
+			goto end;
+		}
+	} else {
+		if (tls_record_set_handshake_certificate(record, &recordlen, test_certs, test_certslen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (server_ctx.certificate_msg_len != recordlen - 9
+		|| memcmp(server_ctx.certificate_msg, record + 9, recordlen - 9) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// with client authentication
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| server.client_certs_len != client_certlen
+		|| test_record_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| test_record_recv(&server, buf, sizeof(buf), &len) != 1 || len != 5) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	if (sock[0] >= 0) {
+		close(sock[0]);
+		close(sock[1]);
+	}
+	free(client_ctx.certificate_msg);
+	free(server_ctx.certificate_msg);
+	free(server_ctx.certificate_request_msg);
+	return ret;
+}
+
+static int test_tls_handshake_guard(int protocol)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_HANDSHAKE_GUARD *guard = NULL;
+	TLS_SESSION session;
+	TLS_REPLAY_CACHE *cache = NULL;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t cookie[TLS13_MAX_COOKIE_SIZE];
+	size_t cookielen;
+	const uint8_t *data;
+	size_t datalen;
+	uint8_t buf[16];
+	size_t len;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+
+	if (test_certs_generate(protocol) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, protocol) != 1
+		|| !(guard = tls_handshake_guard_new(protocol == TLS_protocol_tls13 ? TLS_cookie_always : TLS_cookie_off, 2))) {
+		error_print();
+		goto end;
+	}
+	if (tls_ctx_set_handshake_guard(&client_ctx, guard) != -1
+		|| tls_ctx_set_handshake_guard(&server_ctx, guard) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// a cookie is only opened by its guard, untouched
+	if (tls_handshake_guard_seal_cookie(guard, (uint8_t *)"state", 5, cookie, &cookielen, sizeof(cookie)) != 1
+		|| tls_handshake_guard_open_cookie(guard, cookie, cookielen, &data, &datalen) != 1
+		|| datalen != 5 || memcmp(data, "state", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	cookie[4] ^= 1;
+	if (tls_handshake_guard_open_cookie(guard, cookie, cookielen, &data, &datalen) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// all the slots are taken, the handshake is refused
+	if (tls_handshake_guard_admit(guard) != 1
+		|| tls_handshake_guard_admit(guard) != 1
+		|| tls_handshake_guard_admit(guard) != 0
+		|| test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) == 1) {
+		error_print();
+		goto end;
+	}
+	tls_handshake_guard_release(guard);
+	tls_handshake_guard_release(guard);
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// TLS 1.3 goes through a HelloRetryRequest, the slot is given back
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| test_record_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| test_record_recv(&server, buf, sizeof(buf), &len) != 1 || len != 5
+		|| tls_handshake_guard_admit(guard) != 1
+		|| tls_handshake_guard_admit(guard) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_handshake_guard_release(guard);
+	tls_handshake_guard_release(guard);
+
+	if (protocol == TLS_protocol_tls13) {
+		// the binder of the second ClientHello covers the HelloRetryRequest, the 0-RTT is skipped
+		if (tls_ctx_set_session_ticket_key(&server_ctx, NULL, 0) != 1
+			|| !(cache = tls_replay_cache_new(16))
+			|| tls_ctx_set_early_data(&server_ctx, 1024, cache) != 1) {
+			error_print();
+			goto end;
+		}
+		tls_cleanup(&client);
+		tls_cleanup(&server);
+		close(sock[0]);
+		close(sock[1]);
+		if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+			|| tls13_recv(&client, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ
+			|| tls_get_session(&client, &session) != 1) {
+			error_print();
+			goto end;
+		}
+		tls_cleanup(&client);
+		tls_cleanup(&server);
+		close(sock[0]);
+		close(sock[1]);
+		memset(&client, 0, sizeof(client));
+		memset(&server, 0, sizeof(server));
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+			|| test_handshake_init(&client, &client_ctx, &session, &server, &server_ctx, sock) != 1
+			|| tls13_set_early_data(&client, (uint8_t *)"early", 5) != 1
+			|| test_handshake_run(&client, &server, &want_read) != 1
+			|| !tls_session_reused(&client) || !tls_session_reused(&server)
+			|| tls13_early_data_status(&client) != TLS_early_data_rejected
+			|| tls13_early_data_status(&server) != TLS_early_data_rejected
+			|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+			|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+			|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s(%s) ok\n", __FUNCTION__, tls_protocol_name(protocol));
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	if (sock[0] >= 0) {
+		close(sock[0]);
+		close(sock[1]);
+	}
+	tls_replay_cache_free(cache);
+	tls_handshake_guard_free(guard);
+	return ret;
+}
+
+// ClientHello offering x25519 and sm2p256v1, with a x25519 share and the sm2p256v1 one if `sm2_share` is set
+static int test_client_hello_write(int fd, const SM2_Z256_POINT *sm2_share)
+{
+	int protocols[] = { TLS_protocol_tls13 };
+	int groups[] = { TLS_curve_x25519, TLS_curve_sm2p256v1 };
+	int sig_algs[] = { TLS_sig_sm2sig_sm3 };
+	int cipher_suites[] = { TLS_cipher_sm4_gcm_sm3 };
+	uint8_t random[32];
+	uint8_t x25519_share[32];
+	uint8_t shares[128];
+	uint8_t *q = shares;
+	size_t shares_len = 0;
+	uint8_t exts[256];
+	uint8_t *p = exts;
+	size_t extslen = 0;
+	uint8_t record[512];
+	size_t recordlen;
+
+	rand_bytes(random, sizeof(random));
+	rand_bytes(x25519_share, sizeof(x25519_share));
+	tls_uint16_to_bytes(TLS_curve_x25519, &q, &shares_len);
+	tls_uint16array_to_bytes(x25519_share, sizeof(x25519_share), &q, &shares_len);
+	if (sm2_share) {
+		tls13_key_share_entry_to_bytes(sm2_share, &q, &shares_len);
+	}
+
+	tls13_supported_versions_ext_to_bytes(TLS_client_mode, protocols, 1, &p, &extslen);
+	tls_supported_groups_ext_to_bytes(groups, 2, &p, &extslen);
+	tls_signature_algorithms_ext_to_bytes(sig_algs, 1, &p, &extslen);
+	tls_uint16_to_bytes(TLS_extension_key_share, &p, &extslen);
+	tls_uint16_to_bytes((uint16_t)(2 + shares_len), &p, &extslen);
+	tls_uint16array_to_bytes(shares, shares_len, &p, &extslen);
+
+	tls_record_set_protocol(record, TLS_protocol_tls12);
+	if (tls_record_set_handshake_client_hello(record, &recordlen, TLS_protocol_tls12, random, NULL, 0,
+			cipher_suites, 1, exts, extslen) != 1
+		|| write(fd, record, recordlen) != (ssize_t)recordlen) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// return 1 for a ServerHello, 2 for a HelloRetryRequest, with the selected_group of its key_share
+static int test_server_hello_read(int fd, int *selected_group)
+{
+	static const uint8_t hello_retry_request_random[4] = { 0xcf, 0x21, 0xad, 0x74 };
+	uint8_t record[TLS_MAX_RECORD_SIZE];
+	size_t recordlen = 0;
+	int protocol;
+	const uint8_t *random;
+	const uint8_t *session_id;
+	size_t session_id_len;
+	int cipher_suite;
+	const uint8_t *exts;
+	size_t extslen;
+	ssize_t n;
+
+	*selected_group = 0;
+	while (recordlen < 5 || recordlen < 5 + (size_t)((record[3] << 8) | record[4])) {
+		size_t want = recordlen < 5 ? 5 - recordlen : 5 + ((record[3] << 8) | record[4]) - recordlen;
+		if ((n = read(fd, record + recordlen, want)) <= 0) {
+			error_print();
+			return -1;
+		}
+		recordlen += n;
+	}
+	if (tls_record_get_handshake_server_hello(record, &protocol, &random, &session_id, &session_id_len,
+		&cipher_suite, &exts, &extslen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (memcmp(random, hello_retry_request_random, sizeof(hello_retry_request_random)) != 0) {
+		return 1;
+	}
+	while (extslen) {
+		uint16_t ext_type;
+		const uint8_t *ext_data;
+		size_t ext_datalen;
+
+		if (tls_uint16_from_bytes(&ext_type, &exts, &extslen) != 1
+			|| tls_uint16array_from_bytes(&ext_data, &ext_datalen, &exts, &extslen) != 1) {
+			error_print();
+			return -1;
+		}
+		if (ext_type == TLS_extension_key_share
+			&& tls13_process_hello_retry_request_key_share(ext_data, ext_datalen, selected_group) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 2;
+}
+
+static int test_server_step(TLS_CONNECT *server)
+{
+	int rv;
+	int i;
+
+	for (i = 0; i < 10; i++) {
+		if ((rv = tls_do_handshake(server)) != TLS_ERROR_WANT_WRITE && rv != TLS_ERROR_WANT_ASYNC) {
+			return rv;
+		}
+	}
+	return rv;
+}
+
+static int test_tls13_key_share_retry(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT server;
+	SM2_KEY key;
+	int sock[2] = { -1, -1 };
+	int group;
+	int i;
+	int ret = -1;
+
+	memset(&server, 0, sizeof(server));
+
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| sm2_key_generate(&key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	for (i = 0; i < 3; i++) {
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0) {
+			error_print();
+			goto end;
+		}
+		fcntl(sock[1], F_SETFL, fcntl(sock[1], F_GETFL) | O_NONBLOCK);
+		if (tls_init(&server, &server_ctx) != 1
+			|| tls_set_socket(&server, sock[1]) != 1) {
+			error_print();
+			goto end;
+		}
+
+		// a sm2p256v1 share next to the x25519 one is taken without a retry
+		if (i == 0) {
+			if (test_client_hello_write(sock[0], &key.public_key) != 1
+				|| test_server_step(&server) != TLS_ERROR_WANT_READ
+				|| test_server_hello_read(sock[0], &group) != 1) {
+				error_print();
+				goto end;
+			}
+		} else {
+			// only the x25519 share, the sm2p256v1 one is asked
+			if (test_client_hello_write(sock[0], NULL) != 1
+				|| test_server_step(&server) != TLS_ERROR_WANT_READ
+				|| test_server_hello_read(sock[0], &group) != 2
+				|| group != TLS_curve_sm2p256v1) {
+				error_print();
+				goto end;
+			}
+			// the second ClientHello has it, or it is refused
+			if (test_client_hello_write(sock[0], i == 1 ? &key.public_key : NULL) != 1) {
+				error_print();
+				goto end;
+			}
+			if (i == 1) {
+				if (test_server_step(&server) != TLS_ERROR_WANT_READ
+					|| test_server_hello_read(sock[0], &group) != 1) {
+					error_print();
+					goto end;
+				}
+			} else if (test_server_step(&server) != -1) {
+				error_print();
+				goto end;
+			}
+		}
+		tls_cleanup(&server);
+		memset(&server, 0, sizeof(server));
+		close(sock[0]);
+		close(sock[1]);
+		sock[0] = sock[1] = -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&server);
+	if (sock[0] >= 0) {
+		close(sock[0]);
+		close(sock[1]);
+	}
+	return ret;
+}
+
+static int test_tls_sni_table(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX *host_ctx = NULL;
+	TLS_CTX *ctx = NULL;
+	TLS_SNI_TABLE *table = NULL;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	FILE *fp;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| !(host_ctx = test_host_ctx_new(TLS_protocol_tls13, "tenant"))) {
+		error_print();
+		goto end;
+	}
+	if (!(fp = fopen("sni_chain.pem", "w"))
+		|| x509_certs_to_pem(host_ctx->certs, host_ctx->certslen, fp) != 1
+		|| fclose(fp) != 0
+		|| !(fp = fopen("sni_key.pem", "w"))
+		|| sm2_private_key_info_encrypt_to_pem(&host_ctx->signkey, "P@ssw0rd", fp) != 1
+		|| fclose(fp) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// nothing is loaded before the first lookup
+	if (!(table = tls_sni_table_new(TLS_protocol_tls13, 4, 1))
+		|| tls_sni_table_add(table, "A.example.com", "sni_chain.pem", "sni_key.pem", "P@ssw0rd") != 1
+		|| tls_sni_table_add(table, "*.example.org", "sni_chain.pem", "sni_key.pem", "P@ssw0rd") != 1
+		|| tls_sni_table_add(table, "a.example.com", "sni_chain.pem", "sni_key.pem", "P@ssw0rd") != -1
+		|| tls_sni_table_add(table, "bad.example.com", "sni_chain.pem", "sni_key.pem", "wrong") != 1
+		|| tls_sni_table_add_tlcp(table, "c.example.com", "sni_chain.pem",
+			"sni_key.pem", "P@ssw0rd", "sni_key.pem", "P@ssw0rd") != -1
+		|| tls_sni_table_loaded_count(table) != 0) {
+		error_print();
+		goto end;
+	}
+	if (tls_sni_table_lookup(table, "a.example.com", &ctx) != 1
+		|| ctx->certslen != host_ctx->certslen
+		|| memcmp(ctx->certs, host_ctx->certs, host_ctx->certslen) != 0
+		|| tls_sni_table_loaded_count(table) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_ctx_free(ctx);
+	ctx = NULL;
+
+	// the wildcard matches a single label, the least recently used context is released
+	if (tls_sni_table_lookup(table, "www.example.org", &ctx) != 1
+		|| tls_sni_table_loaded_count(table) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_ctx_free(ctx);
+	ctx = NULL;
+	if (tls_sni_table_lookup(table, "example.org", &ctx) != 0
+		|| tls_sni_table_lookup(table, "a.b.example.org", &ctx) != 0
+		|| tls_sni_table_lookup(table, "unknown.example.com", &ctx) != 0
+		|| tls_sni_table_lookup(table, "bad.example.com", &ctx) != -1) {
+		error_print();
+		goto end;
+	}
+
+	// the table as the server_name callback, eviction leaves the connection running
+	if (tls_ctx_set_server_name_callback(&server_ctx, tls_sni_table_lookup, table) != 1
+		|| socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0
+		|| test_handshake_init(&client, &client_ctx, NULL, &server, &server_ctx, sock) != 1
+		|| tls_set_server_name(&client, "www.example.org") != 1) {
+		error_print();
+		goto end;
+	}
+	tls_sni_table_evict(table, 0);
+	if (tls_sni_table_loaded_count(table) != 0) {
+		error_print();
+		goto end;
+	}
+	if (test_handshake_run(&client, &server, &want_read) != 1
+		|| !server.host_ctx
+		|| memcmp(client.server_certs, host_ctx->certs, host_ctx->certslen) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_sni_table_free(table);
+	tls_ctx_free(host_ctx);
+	remove("sni_chain.pem");
+	remove("sni_key.pem");
+	return ret;
+}
+
+#ifdef ENABLE_SM2_KEY_POOL
+static int test_tls13_ecdhe_key_pool(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX tlcp_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	SM2_KEY_POOL *pool;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	if (!(pool = sm2_key_pool_new(4, 0))) {
+		error_print();
+		return -1;
+	}
+	if (tls_ctx_init(&tlcp_ctx, TLS_protocol_tlcp, TLS_server_mode) != 1
+		|| tls_ctx_set_ecdhe_key_pool(&tlcp_ctx, pool) != -1) {
+		error_print();
+		sm2_key_pool_free(pool);
+		return -1;
+	}
+	tls_ctx_cleanup(&tlcp_ctx);
+
+	// both ends take their ephemeral key from one shared pool
+	if (sm2_key_pool_refill(pool) != 1
+		|| test_certs_generate(TLS_protocol_tls13) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tls13) != 1
+		|| tls_ctx_set_ecdhe_key_pool(&client_ctx, pool) != 1
+		|| tls_ctx_set_ecdhe_key_pool(&server_ctx, pool) != 1) {
+		error_print();
+		sm2_key_pool_free(pool);
+		return -1;
+	}
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| sm2_key_pool_count(pool) != 2
+		|| tls13_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls13_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| sm2_key_pool_count(pool) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a drained pool falls back to inline generation
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| sm2_key_pool_count(pool) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	sm2_key_pool_free(pool);
+	return ret;
+}
+#endif
+
+typedef struct {
+	uint8_t out[SM2_MAX_PLAINTEXT_SIZE];
+	size_t outlen;
+	int ret;
+	int polls;
+} TEST_KEY_JOB;
+
+typedef struct {
+	const SM2_KEY *sign_key;
+	const SM2_KEY *enc_key;
+	TEST_KEY_JOB job;
+	int signs;
+	int decrypts;
+	int completes;
+	int cancels;
+} TEST_KEY_METHOD;
+
+// the result is computed at once, complete() reports it on the second poll
+static int test_key_sign(void *arg, const SM2_KEY *key, const uint8_t dgst[32], uint8_t *sig, size_t *siglen, void **job)
+{
+	TEST_KEY_METHOD *m = (TEST_KEY_METHOD *)arg;
+	SM2_SIGNATURE signature;
+	uint8_t *p = m->job.out;
+
+	m->signs++;
+	m->job.outlen = 0;
+	m->job.polls = 0;
+	m->job.ret = (memcmp(&key->public_key, &m->sign_key->public_key, sizeof(SM2_Z256_POINT)) == 0
+		&& sm2_do_sign(m->sign_key, dgst, &signature) == 1
+		&& sm2_signature_to_der(&signature, &p, &m->job.outlen) == 1) ? 1 : -1;
+	*job = &m->job;
+	return TLS_ERROR_WANT_ASYNC;
+}
+
+static int test_key_decrypt(void *arg, const SM2_KEY *key, const uint8_t *in, size_t inlen,
+	uint8_t *out, size_t *outlen, void **job)
+{
+	TEST_KEY_METHOD *m = (TEST_KEY_METHOD *)arg;
+
+	m->decrypts++;
+	m->job.polls = 0;
+	m->job.ret = sm2_decrypt(m->enc_key, in, inlen, m->job.out, &m->job.outlen) == 1 ? 1 : -1;
+	*job = &m->job;
+	return TLS_ERROR_WANT_ASYNC;
+}
+
+static int test_key_complete(void *arg, void *job, uint8_t *out, size_t *outlen)
+{
+	TEST_KEY_METHOD *m = (TEST_KEY_METHOD *)arg;
+	TEST_KEY_JOB *j = (TEST_KEY_JOB *)job;
+
+	m->completes++;
+	if (j != &m->job) {
+		return -1;
+	}
+	if (!j->polls++) {
+		return TLS_ERROR_WANT_ASYNC;
+	}
+	memcpy(out, j->out, j->outlen);
+	*outlen = j->outlen;
+	return j->ret;
+}
+
+static void test_key_cancel(void *arg, void *job)
+{
+	((TEST_KEY_METHOD *)arg)->cancels++;
+}
+
+static int test_tlcp_private_key_method(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CTX tls13_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_PRIVATE_KEY_METHOD method;
+	TEST_KEY_METHOD m;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[16];
+	size_t len;
+	int i, rv;
+	int ret = -1;
+
+	memset(&m, 0, sizeof(m));
+	memset(&method, 0, sizeof(method));
+	method.sign = test_key_sign;
+	method.decrypt = test_key_decrypt;
+	method.complete = test_key_complete;
+	method.cancel = test_key_cancel;
+	method.arg = &m;
+
+	if (tls_ctx_init(&tls13_ctx, TLS_protocol_tls13, TLS_server_mode) != 1
+		|| tls_ctx_set_private_key_method(&tls13_ctx, &method) != -1) {
+		error_print();
+		return -1;
+	}
+	if (test_certs_generate(TLS_protocol_tlcp) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tlcp) != 1
+		|| tls_ctx_set_private_key_method(&server_ctx, &method) != 1) {
+		error_print();
+		return -1;
+	}
+	// the server holds only the public keys
+	m.sign_key = &test_sign_key;
+	m.enc_key = &test_enc_key;
+	memset(server_ctx.signkey.private_key, 0, sizeof(server_ctx.signkey.private_key));
+	memset(server_ctx.kenckey.private_key, 0, sizeof(server_ctx.kenckey.private_key));
+
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| m.signs != 1 || m.decrypts != 1 || m.completes != 4 || m.cancels) {
+		error_print();
+		goto end;
+	}
+	if (tls_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a connection closed while the job is submitted cancels it
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, sock) != 0) {
+		error_print();
+		return -1;
+	}
+	fcntl(sock[0], F_SETFL, fcntl(sock[0], F_GETFL) | O_NONBLOCK);
+	fcntl(sock[1], F_SETFL, fcntl(sock[1], F_GETFL) | O_NONBLOCK);
+	if (tls_init(&client, &client_ctx) != 1
+		|| tls_init(&server, &server_ctx) != 1
+		|| tls_set_socket(&client, sock[0]) != 1
+		|| tls_set_socket(&server, sock[1]) != 1
+		|| tls_do_handshake(&client) != TLS_ERROR_WANT_READ) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 10 && (rv = tls_do_handshake(&server)) != TLS_ERROR_WANT_ASYNC; i++) {
+	}
+	if (rv != TLS_ERROR_WANT_ASYNC || m.signs != 2) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&server);
+	if (m.cancels != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	return ret;
+}
+
+// two handshakes whose ClientKeyExchanges are decrypted in one batch
+static int test_tlcp_decrypt_batch(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT clients[2];
+	TLS_CONNECT servers[2];
+	TLS_PRIVATE_KEY_METHOD method;
+	TLS_DECRYPT_BATCH *batch;
+	int socks[2][2] = { { -1, -1 }, { -1, -1 } };
+	int done[2][2] = { { 0, 0 }, { 0, 0 } };
+	int waits = 0;
+	uint8_t buf[16];
+	size_t len;
+	int i, k, rv;
+	int ret = -1;
+
+	memset(clients, 0, sizeof(clients));
+	memset(servers, 0, sizeof(servers));
+	// never timed out, only a full queue or tls_decrypt_batch_run() decrypts
+	if (!(batch = tls_decrypt_batch_new(2, (uint64_t)3600 * 1000000000))) {
+		error_print();
+		return -1;
+	}
+	tls_decrypt_batch_key_method(batch, &method);
+	if (test_certs_generate(TLS_protocol_tlcp) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tlcp) != 1
+		|| tls_ctx_set_private_key_method(&server_ctx, &method) != 1) {
+		error_print();
+		goto end;
+	}
+	for (k = 0; k < 2; k++) {
+		if (socketpair(AF_UNIX, SOCK_STREAM, 0, socks[k]) != 0
+			|| test_handshake_init(&clients[k], &client_ctx, NULL, &servers[k], &server_ctx, socks[k]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	for (i = 0; i < 100 && !(done[0][0] && done[0][1] && done[1][0] && done[1][1]); i++) {
+		for (k = 0; k < 2; k++) {
+			if (!done[k][0]) {
+				if ((rv = tls_do_handshake(&clients[k])) == 1) {
+					done[k][0] = 1;
+				} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+					error_print();
+					goto end;
+				}
+			}
+			if (!done[k][1]) {
+				if ((rv = tls_do_handshake(&servers[k])) == 1) {
+					done[k][1] = 1;
+				} else if (rv == TLS_ERROR_WANT_ASYNC) {
+					waits++;
+				} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+					error_print();
+					goto end;
+				}
+			}
+		}
+	}
+	// the first handshake waited for the second one
+	if (!(done[0][0] && done[0][1] && done[1][0] && done[1][1]) || !waits) {
+		error_print();
+		goto end;
+	}
+	for (k = 0; k < 2; k++) {
+		if (tls_send(&clients[k], (uint8_t *)"hello", 5, &len) != 1
+			|| tls_recv(&servers[k], buf, sizeof(buf), &len) != 1
+			|| len != 5 || memcmp(buf, "hello", 5) != 0) {
+			error_print();
+			goto end;
+		}
+		tls_cleanup(&clients[k]);
+		tls_cleanup(&servers[k]);
+		close(socks[k][0]);
+		close(socks[k][1]);
+		socks[k][0] = socks[k][1] = -1;
+	}
+
+	// a single handshake is decrypted by tls_decrypt_batch_run()
+	if (socketpair(AF_UNIX, SOCK_STREAM, 0, socks[0]) != 0
+		|| test_handshake_init(&clients[0], &client_ctx, NULL, &servers[0], &server_ctx, socks[0]) != 1
+		|| tls_do_handshake(&clients[0]) != TLS_ERROR_WANT_READ) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 20 && (rv = tls_do_handshake(&servers[0])) != TLS_ERROR_WANT_ASYNC; i++) {
+		tls_do_handshake(&clients[0]);
+	}
+	if (rv != TLS_ERROR_WANT_ASYNC
+		|| tls_do_handshake(&servers[0]) != TLS_ERROR_WANT_ASYNC
+		|| tls_decrypt_batch_run(batch) != 1
+		|| test_handshake_run(&clients[0], &servers[0], &rv) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	for (k = 0; k < 2; k++) {
+		tls_cleanup(&clients[k]);
+		tls_cleanup(&servers[k]);
+		if (socks[k][0] >= 0) close(socks[k][0]);
+		if (socks[k][1] >= 0) close(socks[k][1]);
+	}
+	tls_decrypt_batch_free(batch);
+	return ret;
+}
+
+static int test_tlcp_resumption(void)
+{
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_SESSION_CACHE *cache = NULL;
+	TLS_SESSION session;
+	int sock[2] = { -1, -1 };
+	int want_read;
+	uint8_t buf[64];
+	size_t len;
+	int ret = -1;
+
+	if (test_certs_generate(TLS_protocol_tlcp) != 1
+		|| test_ctx_init(&client_ctx, &server_ctx, TLS_protocol_tlcp) != 1
+		|| !(cache = tls_session_cache_new(64, TLS_SESSION_CACHE_TIMEOUT))
+		|| tls_ctx_set_session_cache(&server_ctx, cache) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// full handshake, the server assigns and caches the session ID
+	if (test_handshake(&client, &client_ctx, NULL, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_session_reused(&client) || tls_session_reused(&server)
+		|| tls_get_session(&client, &session) != 1
+		|| session.session_id_len != 32
+		|| tls_session_cache_count(cache) != 1) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// abbreviated handshake
+	if (test_handshake(&client, &client_ctx, &session, &server, &server_ctx, sock, &want_read) != 1
+		|| !tls_session_reused(&client) || !tls_session_reused(&server)
+		|| tls_send(&client, (uint8_t *)"hello", 5, &len) != 1
+		|| tls_recv(&server, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "hello", 5) != 0
+		|| tls_send(&server, (uint8_t *)"world", 5, &len) != 1
+		|| tls_recv(&client, buf, sizeof(buf), &len) != 1
+		|| len != 5 || memcmp(buf, "world", 5) != 0) {
+		error_print();
+		goto end;
+	}
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+
+	// a removed session falls back to a full handshake
+	if (tls_session_cache_remove(cache, session.session_id, session.session_id_len) != 1
+		|| test_handshake(&client, &client_ctx, &session, &server, &server_ctx, sock, &want_read) != 1
+		|| tls_session_reused(&client) || tls_session_reused(&server)) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	close(sock[0]);
+	close(sock[1]);
+	tls_session_cache_free(cache);
+	return ret;
+}
+#endif
+
+// external store with a single slot
+static TLS_SESSION test_store_session;
+static int test_store_puts;
+
+static int test_store_get(void *arg, const uint8_t *session_id, size_t session_id_len, TLS_SESSION *session)
+{
+	if (!test_store_session.session_id_len
+		|| session_id_len != test_store_session.session_id_len
+		|| memcmp(session_id, test_store_session.session_id, session_id_len) != 0) {
+		return 0;
+	}
+	*session = test_store_session;
+	return 1;
+}
+
+static int test_store_put(void *arg, const TLS_SESSION *session)
+{
+	test_store_session = *session;
+	test_store_puts++;
+	return 1;
+}
+
+static int test_store_remove(void *arg, const uint8_t *session_id, size_t session_id_len)
+{
+	memset(&test_store_session, 0, sizeof(test_store_session));
+	return 1;
+}
+
+static int test_tls_session_cache(void)
+{
+	TLS_SESSION_CACHE *cache = NULL;
+	TLS_SESSION_CACHE *cache2 = NULL;
+	TLS_SESSION_STORE store = { test_store_get, test_store_put, test_store_remove, NULL };
+	TLS_SESSION session;
+	TLS_SESSION out;
+	size_t i;
+	int ret = -1;
+
+	memset(&session, 0, sizeof(session));
+	session.protocol = TLS_protocol_tlcp;
+	session.cipher_suite = TLS_cipher_ecc_sm4_cbc_sm3;
+	session.session_id_len = 32;
+	time(&session.time);
+
+	if (!(cache = tls_session_cache_new(32, 100))) {
+		error_print();
+		return -1;
+	}
+
+	// bounded, the most recent sessions are kept
+	for (i = 0; i < 200; i++) {
+		memset(session.session_id, 0, 32);
+		memcpy(session.session_id, &i, sizeof(i));
+		memset(session.master_secret, (int)i, 48);
+		if (tls_session_cache_add(cache, &session) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (tls_session_cache_count(cache) > 32
+		|| tls_session_cache_get(cache, session.session_id, 32, &out) != 1
+		|| memcmp(&out, &session, sizeof(session)) != 0) {
+		error_print();
+		goto end;
+	}
+	memset(session.session_id, 0, 32);
+	if (tls_session_cache_get(cache, session.session_id, 32, &out) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// expired sessions are dropped
+	session.session_id[0] = 0xff;
+	session.time -= 100;
+	if (tls_session_cache_add(cache, &session) != 1
+		|| tls_session_cache_get(cache, session.session_id, 32, &out) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// another cache finds the session in the shared store
+	time(&session.time);
+	if (!(cache2 = tls_session_cache_new(32, 100))
+		|| tls_session_cache_set_store(cache, &store) != 1
+		|| tls_session_cache_set_store(cache2, &store) != 1
+		|| tls_session_cache_add(cache, &session) != 1
+		|| test_store_puts != 1
+		|| tls_session_cache_get(cache2, session.session_id, 32, &out) != 1
+		|| memcmp(&out, &session, sizeof(session)) != 0
+		|| tls_session_cache_count(cache2) != 1
+		|| tls_session_cache_remove(cache, session.session_id, 32) != 1
+		|| tls_session_cache_get(cache, session.session_id, 32, &out) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	tls_session_cache_free(cache);
+	tls_session_cache_free(cache2);
+	return ret;
+}
+
 int main(void)
 {
 	if (test_tls_encode() != 1) goto err;
 	if (test_tls_cbc() != 1) goto err;
+	if (test_tls_record_in_place() != 1) goto err;
+	if (test_tls_cbc_padding() != 1) goto err;
 	if (test_tls_random() != 1) goto err;
 	if (test_tls_client_hello() != 1) goto err;
 	if (test_tls_server_hello() != 1) goto err;
@@ -334,6 +4158,60 @@ int main(void)
 	if (test_tls_alert() != 1) goto err;
 	if (test_tls_change_cipher_spec() != 1) goto err;
 	if (test_tls_application_data() != 1) goto err;
+	if (test_tls13_key_schedule() != 1) goto err;
+#ifndef WIN32
+	if (test_tls_non_blocking(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_non_blocking(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_memory_transport(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_memory_transport(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_in_place(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_in_place(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_sendv(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_sendv(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_send_batch(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_send_batch(TLS_protocol_tls13) != 1) goto err;
+#ifdef ENABLE_TLS_SERVER
+	if (test_tls_server(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_server(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_client_pool(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_client_pool(TLS_protocol_tls13) != 1) goto err;
+#endif
+	if (test_tls13_resumption() != 1) goto err;
+	if (test_tls_replay_cache() != 1) goto err;
+	if (test_tls13_early_data() != 1) goto err;
+	if (test_tls_ocsp_stapling(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_ocsp_stapling(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls13_cert_compression() != 1) goto err;
+	if (test_tls_ctx_slot(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_ctx_slot(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_server_name(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_server_name(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_record_size(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_record_size(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_sni_table() != 1) goto err;
+	if (test_tls13_key_update() != 1) goto err;
+	if (test_tls13_quic() != 1) goto err;
+	if (test_tls_read_ahead(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_read_ahead(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_recv_pipelined(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_recv_pipelined(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls12_flights() != 1) goto err;
+	if (test_tls_handshake_messages(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_handshake_messages(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls_handshake_guard(TLS_protocol_tlcp) != 1) goto err;
+	if (test_tls_handshake_guard(TLS_protocol_tls13) != 1) goto err;
+	if (test_tls13_key_share_retry() != 1) goto err;
+#ifdef ENABLE_SM2_KEY_POOL
+	if (test_tls13_ecdhe_key_pool() != 1) goto err;
+#endif
+#ifdef ENABLE_KTLS
+	if (test_tls13_ktls() != 1) goto err;
+#endif
+	if (test_tlcp_resumption() != 1) goto err;
+	if (test_tlcp_private_key_method() != 1) goto err;
+	if (test_tlcp_decrypt_batch() != 1) goto err;
+#endif
+	if (test_tls_session_cache() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -0,0 +1,304 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/x509.h>
+#include <gmssl/http.h>
+#include <gmssl/socket.h>
+#include <gmssl/error.h>
+#include "test_server.h"
+
+#ifndef WIN32
+#include <pthread.h>
+
+
+// a local HTTP server of one CRL with the ETag "v1"
+static pthread_mutex_t server_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t server_crl[512];
+static size_t server_crl_len;
+static int server_requests = 0;
+static int server_conditional_requests = 0;
+
+static void server_conn(tls_socket_t conn)
+{
+	char req[1024];
+	char rsp[1024];
+	size_t reqlen = 0;
+	int rsplen;
+
+	while (reqlen < sizeof(req) - 1) {
+		tls_ret_t n = tls_socket_recv(conn, req + reqlen, sizeof(req) - 1 - reqlen, 0);
+		if (n <= 0) break;
+		reqlen += n;
+		req[reqlen] = 0;
+		if (strstr(req, "\r\n\r\n")) break;
+	}
+	req[reqlen] = 0;
+
+	pthread_mutex_lock(&server_lock);
+	server_requests++;
+	if (strstr(req, "If-None-Match: \"v1\"\r\n")) {
+		server_conditional_requests++;
+		rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.0 304 Not Modified\r\nETag: \"v1\"\r\n\r\n");
+		tls_socket_send(conn, rsp, rsplen, 0);
+	} else {
+		rsplen = snprintf(rsp, sizeof(rsp), "HTTP/1.0 200 OK\r\nContent-Length: %zu\r\netag: \"v1\"\r\n\r\n",
+			server_crl_len);
+		tls_socket_send(conn, rsp, rsplen, 0);
+		tls_socket_send(conn, server_crl, server_crl_len, 0);
+	}
+	pthread_mutex_unlock(&server_lock);
+	tls_socket_close(conn);
+}
+
+static int server_start(char *uri, size_t urimax)
+{
+	int port;
+
+	if (test_server_start(server_conn, &port) != 1) {
+		error_print();
+		return -1;
+	}
+	snprintf(uri, urimax, "http://127.0.0.1:%d/ca.crl", port);
+	return 1;
+}
+
+static int server_set_crl(time_t this_update, time_t next_update)
+{
+	SM2_KEY sm2_key;
+	uint8_t issuer[256];
+	size_t issuer_len;
+	uint8_t revoked_certs[64];
+	size_t revoked_certs_len = 0;
+	uint8_t serial[2] = { 0x01, 0x02 };
+	uint8_t *p = revoked_certs;
+	size_t len = 0;
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, "CA") != 1
+		|| x509_revoked_cert_to_der(serial, sizeof(serial), this_update, NULL, 0, &p, &revoked_certs_len) != 1) {
+		error_print();
+		return -1;
+	}
+	pthread_mutex_lock(&server_lock);
+	p = server_crl;
+	server_crl_len = 0;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			this_update, next_update, revoked_certs, revoked_certs_len, NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, NULL, &len) != 1
+		|| len > sizeof(server_crl)
+		|| x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			this_update, next_update, revoked_certs, revoked_certs_len, NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &server_crl_len) != 1) {
+		pthread_mutex_unlock(&server_lock);
+		error_print();
+		return -1;
+	}
+	server_requests = 0;
+	server_conditional_requests = 0;
+	pthread_mutex_unlock(&server_lock);
+	return 1;
+}
+
+static int server_get_requests(int *conditional)
+{
+	int ret;
+	pthread_mutex_lock(&server_lock);
+	ret = server_requests;
+	if (conditional) *conditional = server_conditional_requests;
+	pthread_mutex_unlock(&server_lock);
+	return ret;
+}
+
+static int test_http_get_new(const char *uri)
+{
+	HTTP_VALIDATORS validators;
+	uint8_t *content = NULL;
+	size_t contentlen;
+
+	memset(&validators, 0, sizeof(validators));
+	if (server_set_crl(time(NULL), time(NULL) + 3600) != 1
+		|| http_get_new(uri, &validators, &content, &contentlen) != 1
+		|| contentlen != server_crl_len
+		|| memcmp(content, server_crl, contentlen) != 0
+		|| strcmp(validators.etag, "\"v1\"") != 0) {
+		error_print();
+		return -1;
+	}
+	free(content);
+
+	// conditional
+	if (http_get_new(uri, &validators, &content, &contentlen) != 0
+		|| server_get_requests(NULL) != 2) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_x509_crl_cache(const char *uri)
+{
+	time_t now = time(NULL);
+	const X509_CRL_INDEX *index = NULL;
+	const X509_CRL_INDEX *index2 = NULL;
+	uint8_t serial[2] = { 0x01, 0x02 };
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+	size_t hits, misses;
+
+	x509_crl_cache_clear();
+	if (server_set_crl(now - 60, now + 3600) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_cache_get(uri, strlen(uri), &index) != 1
+		|| x509_crl_cache_get(uri, strlen(uri), &index2) != 1
+		|| index != index2
+		|| server_get_requests(NULL) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_index_find_revoked_cert_by_serial_number(index, serial, sizeof(serial),
+		&revoke_date, &exts, &exts_len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// the references are kept after the cache is cleared
+	x509_crl_cache_clear();
+	if (index->entries_cnt != 1) {
+		error_print();
+		return -1;
+	}
+	x509_crl_cache_put(index);
+	x509_crl_cache_put(index2);
+
+	if (x509_crl_cache_get(uri, strlen(uri), &index) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_crl_cache_put(index);
+	x509_crl_cache_get_stats(&hits, &misses, NULL);
+	if (hits != 0 || misses != 1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+// a lookup in the last quarter of the lifetime is a hit and starts a conditional refresh
+static int test_x509_crl_cache_refresh(const char *uri)
+{
+	time_t now = time(NULL);
+	const X509_CRL_INDEX *index = NULL;
+	size_t refreshes = 0;
+	int conditional;
+	int i;
+
+	x509_crl_cache_clear();
+	x509_crl_cache_set_retry_seconds(0);
+	if (server_set_crl(now - 3000, now + 100) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_crl_cache_get(uri, strlen(uri), &index) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_crl_cache_put(index);
+	if (x509_crl_cache_get(uri, strlen(uri), &index) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_crl_cache_put(index);
+
+	for (i = 0; i < 500 && !refreshes; i++) {
+		usleep(10000);
+		x509_crl_cache_get_stats(NULL, NULL, &refreshes);
+	}
+	if (refreshes != 1
+		|| server_get_requests(&conditional) != 2
+		|| conditional != 1) {
+		error_print();
+		return -1;
+	}
+
+	// no other refresh within the retry seconds
+	x509_crl_cache_set_retry_seconds(X509_CRL_CACHE_RETRY_SECONDS);
+	if (x509_crl_cache_get(uri, strlen(uri), &index) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_crl_cache_put(index);
+	if (server_get_requests(NULL) != 2) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_x509_crl_cache_disabled(const char *uri)
+{
+	const X509_CRL_INDEX *index = NULL;
+	int i;
+
+	x509_crl_cache_set_enabled(0);
+	if (server_set_crl(time(NULL), time(NULL) + 3600) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 2; i++) {
+		if (x509_crl_cache_get(uri, strlen(uri), &index) != 1) {
+			error_print();
+			return -1;
+		}
+		x509_crl_cache_put(index);
+	}
+	x509_crl_cache_set_enabled(1);
+	if (server_get_requests(NULL) != 2) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+#endif
+
+int main(void)
+{
+#ifndef WIN32
+	char uri[64];
+
+	if (server_start(uri, sizeof(uri)) != 1) goto err;
+	if (test_http_get_new(uri) != 1) goto err;
+	if (test_x509_crl_cache(uri) != 1) goto err;
+	if (test_x509_crl_cache_refresh(uri) != 1) goto err;
+	if (test_x509_crl_cache_disabled(uri) != 1) goto err;
+#endif
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+#ifndef WIN32
+err:
+	error_print();
+	return 1;
+#endif
+}
@@ -437,6 +437,322 @@ static int test_x509_cert_revoke(void)
 	return 1;
 }
 
+static int test_x509_crl_index(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t issuer[256];
+	size_t issuer_len;
+	uint8_t *revoked_certs = NULL;
+	size_t revoked_certs_len = 0;
+	uint8_t *crl = NULL;
+	size_t crl_len = 0;
+	uint8_t serial[3] = { 0x01, 0x00, 0x00 };
+	time_t now = time(NULL);
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+	X509_CRL_INDEX index;
+	uint8_t *p;
+	int i;
+	int ret = -1;
+
+	memset(&index, 0, sizeof(index));
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, "CA") != 1) {
+		error_print();
+		return -1;
+	}
+
+	// descending even serial numbers, the index must not depend on the CRL order
+	if (!(revoked_certs = (uint8_t *)malloc(1000 * 64))) {
+		error_print();
+		return -1;
+	}
+	p = revoked_certs;
+	for (i = 999; i >= 0; i--) {
+		serial[1] = (uint8_t)((i * 2) >> 8);
+		serial[2] = (uint8_t)(i * 2);
+		if (x509_revoked_cert_to_der(serial, sizeof(serial), now - i, NULL, 0, &p, &revoked_certs_len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			now, now + 86400, revoked_certs, revoked_certs_len, NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, NULL, &crl_len) != 1
+		|| !(crl = (uint8_t *)malloc(crl_len))) {
+		error_print();
+		goto end;
+	}
+	p = crl;
+	crl_len = 0;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			now, now + 86400, revoked_certs, revoked_certs_len, NULL, 0,
+			&sm2_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &crl_len) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (x509_crl_index_init(&index, crl, crl_len) != 1
+		|| index.entries_cnt != 1000) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 2000; i++) {
+		serial[1] = (uint8_t)(i >> 8);
+		serial[2] = (uint8_t)i;
+		if (x509_crl_index_find_revoked_cert_by_serial_number(&index, serial, sizeof(serial),
+			&revoke_date, &exts, &exts_len) != (i % 2 ? 0 : 1)) {
+			error_print();
+			goto end;
+		}
+		if (i % 2 == 0 && revoke_date != now - i/2) {
+			error_print();
+			goto end;
+		}
+	}
+	// a shorter encoding of another value
+	if (x509_crl_index_find_revoked_cert_by_serial_number(&index, serial, 2,
+		&revoke_date, &exts, &exts_len) != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	x509_crl_index_cleanup(&index);
+	if (crl) free(crl);
+	if (revoked_certs) free(revoked_certs);
+	return ret;
+}
+
+static int revoked_cert_to_der(uint8_t sn, int reason, uint8_t **out, size_t *outlen)
+{
+	uint8_t serial[2] = { 0x01, sn };
+	return x509_revoked_cert_to_der_ex(serial, sizeof(serial), 1700000000 + sn,
+		reason, -1, NULL, 0, out, outlen);
+}
+
+static int test_x509_crl_builder(void)
+{
+	X509_CRL_BUILDER builder;
+	uint8_t sorted[512];
+	size_t sorted_len = 0;
+	uint8_t buf[512];
+	size_t len = 0;
+	uint8_t *p;
+	int order[] = { 5, 1, 3, 2, 4 };
+	int i;
+
+	p = sorted;
+	for (i = 1; i <= 5; i++) {
+		if (revoked_cert_to_der((uint8_t)i, -1, &p, &sorted_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (x509_crl_builder_init(&builder, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < sizeof(order)/sizeof(order[0]); i++) {
+		p = buf;
+		len = 0;
+		if (revoked_cert_to_der((uint8_t)order[i], -1, &p, &len) != 1
+			|| x509_crl_builder_add_revoked_cert(&builder, buf, len) != 1) {
+			error_print();
+			x509_crl_builder_cleanup(&builder);
+			return -1;
+		}
+	}
+	// already revoked
+	if (x509_crl_builder_add_revoked_cert(&builder, buf, len) != 0
+		|| builder.entries_cnt != 5
+		|| builder.revoked_certs_len != sorted_len
+		|| memcmp(builder.revoked_certs, sorted, sorted_len) != 0) {
+		error_print();
+		x509_crl_builder_cleanup(&builder);
+		return -1;
+	}
+	x509_crl_builder_cleanup(&builder);
+
+	// an unsorted initial list is sorted
+	p = buf;
+	len = 0;
+	for (i = 5; i >= 1; i--) {
+		if (revoked_cert_to_der((uint8_t)i, -1, &p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	if (x509_crl_builder_init(&builder, buf, len) != 1
+		|| builder.revoked_certs_len != sorted_len
+		|| memcmp(builder.revoked_certs, sorted, sorted_len) != 0) {
+		error_print();
+		x509_crl_builder_cleanup(&builder);
+		return -1;
+	}
+	x509_crl_builder_cleanup(&builder);
+
+	// duplicated serial numbers
+	if (revoked_cert_to_der(3, -1, &p, &len) != 1
+		|| x509_crl_builder_init(&builder, buf, len) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int crl_sign_new(const SM2_KEY *key, const uint8_t *issuer, size_t issuer_len,
+	const uint8_t *revoked_certs, size_t revoked_certs_len, int crl_number, int base_crl_number,
+	uint8_t **crl, size_t *crl_len)
+{
+	uint8_t exts[64];
+	size_t extslen = 0;
+	time_t now = time(NULL);
+	uint8_t *p;
+
+	if (x509_crl_exts_add_crl_number(exts, &extslen, sizeof(exts), -1, crl_number) != 1
+		|| x509_crl_exts_add_delta_crl_indicator(exts, &extslen, sizeof(exts), X509_critical, base_crl_number) < 0) {
+		error_print();
+		return -1;
+	}
+	*crl_len = 0;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			now, now + 86400, revoked_certs, revoked_certs_len, exts, extslen,
+			key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, NULL, crl_len) != 1
+		|| !(*crl = (uint8_t *)malloc(*crl_len))) {
+		error_print();
+		return -1;
+	}
+	p = *crl;
+	*crl_len = 0;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, issuer, issuer_len,
+			now, now + 86400, revoked_certs, revoked_certs_len, exts, extslen,
+			key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, crl_len) != 1) {
+		error_print();
+		free(*crl);
+		*crl = NULL;
+		return -1;
+	}
+	return 1;
+}
+
+static int test_x509_crl_index_add_delta(void)
+{
+	SM2_KEY sm2_key;
+	uint8_t issuer[256];
+	size_t issuer_len;
+	uint8_t revoked_certs[512];
+	size_t revoked_certs_len = 0;
+	uint8_t delta_certs[512];
+	size_t delta_certs_len = 0;
+	uint8_t *base = NULL;
+	size_t base_len;
+	uint8_t *delta = NULL;
+	size_t delta_len;
+	uint8_t *newer_delta = NULL;
+	size_t newer_delta_len;
+	X509_CRL_INDEX index;
+	uint8_t serial[2] = { 0x01, 0x00 };
+	time_t revoke_date;
+	const uint8_t *exts;
+	size_t exts_len;
+	int crl_number, delta_crl_indicator;
+	int found[] = { 0, 1, 1, 0, 1, 1, 0, 1 };
+	uint8_t *p;
+	int i;
+	int ret = -1;
+
+	memset(&index, 0, sizeof(index));
+
+	if (sm2_key_generate(&sm2_key) != 1
+		|| x509_name_set(issuer, &issuer_len, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, "CA") != 1) {
+		error_print();
+		return -1;
+	}
+	p = revoked_certs;
+	for (i = 1; i <= 5; i++) {
+		if (revoked_cert_to_der((uint8_t)i, -1, &p, &revoked_certs_len) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	// 2 is superseded, 3 is released from hold and 7 is newly revoked
+	p = delta_certs;
+	if (revoked_cert_to_der(7, X509_cr_key_compromise, &p, &delta_certs_len) != 1
+		|| revoked_cert_to_der(3, X509_cr_remove_from_crl, &p, &delta_certs_len) != 1
+		|| revoked_cert_to_der(2, X509_cr_superseded, &p, &delta_certs_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (crl_sign_new(&sm2_key, issuer, issuer_len, revoked_certs, revoked_certs_len, 10, -1, &base, &base_len) != 1
+		|| crl_sign_new(&sm2_key, issuer, issuer_len, delta_certs, delta_certs_len, 11, 10, &delta, &delta_len) != 1
+		|| crl_sign_new(&sm2_key, issuer, issuer_len, delta_certs, delta_certs_len, 12, 11, &newer_delta, &newer_delta_len) != 1) {
+		error_print();
+		goto end;
+	}
+	if (x509_crl_get_crl_number(delta, delta_len, &crl_number, &delta_crl_indicator) != 1
+		|| crl_number != 11
+		|| delta_crl_indicator != 10
+		|| x509_crl_check(delta, delta_len, time(NULL)) != 1) {
+		error_print();
+		goto end;
+	}
+
+	if (x509_crl_index_init(&index, base, base_len) != 1
+		|| index.crl_number != 10
+		|| x509_crl_index_add_delta(&index, delta, delta_len) != 1
+		|| index.delta_crl_number != 11
+		|| index.entries_cnt != 5) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < sizeof(found)/sizeof(found[0]); i++) {
+		serial[1] = (uint8_t)i;
+		if (x509_crl_index_find_revoked_cert_by_serial_number(&index, serial, sizeof(serial),
+			&revoke_date, &exts, &exts_len) != found[i]) {
+			error_print();
+			goto end;
+		}
+	}
+	serial[1] = 2;
+	if (x509_crl_index_find_revoked_cert_by_serial_number(&index, serial, sizeof(serial),
+			&revoke_date, &exts, &exts_len) != 1
+		|| !exts_len) {
+		error_print();
+		goto end;
+	}
+	// only one delta
+	if (x509_crl_index_add_delta(&index, delta, delta_len) != -1) {
+		error_print();
+		goto end;
+	}
+	x509_crl_index_cleanup(&index);
+
+	// based on a complete CRL newer than the indexed one
+	if (x509_crl_index_init(&index, base, base_len) != 1
+		|| x509_crl_index_add_delta(&index, newer_delta, newer_delta_len) != -1
+		|| index.entries_cnt != 5) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	x509_crl_index_cleanup(&index);
+	if (base) free(base);
+	if (delta) free(delta);
+	if (newer_delta) free(newer_delta);
+	return ret;
+}
+
 /*
 	http://mscrl.microsoft.com/pki/mscorp/crl/Microsoft%20RSA%20TLS%20CA%2002.crl
 	http://crl.microsoft.com/pki/mscorp/crl/Microsoft%20RSA%20TLS%20CA%2002.crl
@@ -454,6 +770,9 @@ int main(void)
 	if (test_x509_issuing_distribution_point() != 1) goto err;
 	if (test_x509_issuing_distribution_point_from_der() != 1) goto err;
 	if (test_x509_crl_exts() != 1) goto err;
+	if (test_x509_crl_index() != 1) goto err;
+	if (test_x509_crl_builder() != 1) goto err;
+	if (test_x509_crl_index_add_delta() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
@@ -0,0 +1,196 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ocsp.h>
+#include <gmssl/error.h>
+#include "test_cert.h"
+
+
+static int test_x509_ocsp_request(void)
+{
+	SM2_KEY ca_key, key;
+	uint8_t cacert[512];
+	uint8_t cert[512];
+	uint8_t buf[512];
+	size_t cacertlen = 0, certlen = 0, len = 0;
+	uint8_t *p;
+	const uint8_t *cp;
+	const uint8_t *d;
+	size_t dlen;
+
+	p = cacert;
+	if (sm2_key_generate(&ca_key) != 1
+		|| test_cert_generate("CA", &ca_key, NULL, NULL,
+			(const uint8_t *)"\x01\x02\x03\x01", 4, 0, 0, 0, &p, &cacertlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = cert;
+	if (sm2_key_generate(&key) != 1
+		|| test_cert_generate("server", &key, "CA", &ca_key,
+			(const uint8_t *)"\x01\x02\x03\x02", 4, 0, 0, 0, &p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	p = buf;
+	if (x509_ocsp_request_to_der(cert, certlen, cacert, cacertlen, &p, &len) != 1) {
+		error_print();
+		return -1;
+	}
+	cp = buf;
+	if (asn1_sequence_from_der(&d, &dlen, &cp, &len) != 1
+		|| asn1_length_is_zero(len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// the CA certificate is not the issuer of itself as a server certificate
+	len = 0;
+	p = buf;
+	if (x509_ocsp_cert_id_to_der(cacert, cacertlen, cert, certlen, &p, &len) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_x509_ocsp_response(void)
+{
+	SM2_KEY ca_key, key, other_key;
+	uint8_t cacert[512];
+	uint8_t cert[512];
+	uint8_t other_cert[512];
+	uint8_t resp[1024];
+	size_t cacertlen = 0, certlen = 0, other_certlen = 0, resplen;
+	uint8_t *p;
+	time_t now = time(NULL);
+	int cert_status;
+	time_t this_update, next_update;
+
+	p = cacert;
+	if (sm2_key_generate(&ca_key) != 1
+		|| test_cert_generate("CA", &ca_key, NULL, NULL,
+			(const uint8_t *)"\x01\x02\x03\x01", 4, 0, 0, 0, &p, &cacertlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = cert;
+	if (sm2_key_generate(&key) != 1
+		|| test_cert_generate("server", &key, "CA", &ca_key,
+			(const uint8_t *)"\x01\x02\x03\x02", 4, 0, 0, 0, &p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = other_cert;
+	if (sm2_key_generate(&other_key) != 1
+		|| test_cert_generate("other", &other_key, "CA", &ca_key,
+			(const uint8_t *)"\x01\x02\x03\x03", 4, 0, 0, 0, &p, &other_certlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// good
+	p = resp;
+	resplen = 0;
+	if (x509_ocsp_response_sign_to_der(cert, certlen, cacert, cacertlen,
+		X509_ocsp_cert_good, -1, now - 60, now + 3600,
+		&ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &resplen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_ocsp_response_verify(resp, resplen, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now, &cert_status, &this_update, &next_update) != 1) {
+		error_print();
+		return -1;
+	}
+	if (cert_status != X509_ocsp_cert_good
+		|| this_update != now - 60
+		|| next_update != now + 3600) {
+		error_print();
+		return -1;
+	}
+
+	// not for another certificate
+	if (x509_ocsp_response_verify(resp, resplen, other_cert, other_certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now, &cert_status, &this_update, &next_update) != -1) {
+		error_print();
+		return -1;
+	}
+	// expired
+	if (x509_ocsp_response_verify(resp, resplen, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now + 7200, &cert_status, &this_update, &next_update) != -1) {
+		error_print();
+		return -1;
+	}
+	// tampered
+	resp[resplen - 1] ^= 1;
+	if (x509_ocsp_response_verify(resp, resplen, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now, &cert_status, &this_update, &next_update) != -1) {
+		error_print();
+		return -1;
+	}
+
+	// revoked without nextUpdate
+	p = resp;
+	resplen = 0;
+	if (x509_ocsp_response_sign_to_der(cert, certlen, cacert, cacertlen,
+		X509_ocsp_cert_revoked, now - 3600, now, -1,
+		&ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &resplen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_ocsp_response_verify(resp, resplen, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now, &cert_status, &this_update, &next_update) != 1) {
+		error_print();
+		return -1;
+	}
+	if (cert_status != X509_ocsp_cert_revoked || next_update != -1) {
+		error_print();
+		return -1;
+	}
+
+	// signed by a key other than the CA
+	p = resp;
+	resplen = 0;
+	if (x509_ocsp_response_sign_to_der(cert, certlen, cacert, cacertlen,
+		X509_ocsp_cert_good, -1, now, now + 3600,
+		&other_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &resplen) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_ocsp_response_verify(resp, resplen, cert, certlen, cacert, cacertlen,
+		SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, now, &cert_status, &this_update, &next_update) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+int main(void)
+{
+	if (test_x509_ocsp_request() != 1) goto err;
+	if (test_x509_ocsp_response() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
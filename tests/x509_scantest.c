@@ -0,0 +1,220 @@
+/*
+ *  Copyright 2014-2023 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/oid.h>
+#include <gmssl/pem.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_scan.h>
+#include <gmssl/error.h>
+#include "test_cert.h"
+
+
+#define TEST_CERTS_CNT	5
+
+static uint8_t certs[TEST_CERTS_CNT * 1024];
+static size_t certs_len = 0;
+static size_t cert_offsets[TEST_CERTS_CNT];
+
+static int gen_certs(void)
+{
+	SM2_KEY key;
+	uint8_t serial[2] = { 0x80, 0x00 };
+	time_t not_before = 1700000000;
+	uint8_t *p = certs;
+	size_t len;
+	int i;
+
+	if (sm2_key_generate(&key) != 1) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < TEST_CERTS_CNT; i++) {
+		serial[1] = (uint8_t)i;
+		cert_offsets[i] = certs_len;
+		len = 0;
+		// the comma and quotes need CSV quoting and JSON escaping
+		if (test_cert_generate("node, \"1\"", &key, NULL, NULL,
+			serial, sizeof(serial), not_before, 0, 0, &p, &len) != 1) {
+			error_print();
+			return -1;
+		}
+		certs_len += len;
+	}
+	return 1;
+}
+
+static size_t count_lines(FILE *fp, const char *expect, size_t *matches)
+{
+	char line[1024];
+	size_t n = 0;
+
+	*matches = 0;
+	rewind(fp);
+	while (fgets(line, sizeof(line), fp)) {
+		n++;
+		if (strstr(line, expect)) {
+			(*matches)++;
+		}
+	}
+	return n;
+}
+
+static int test_x509_certs_scan_der(void)
+{
+	const char *expect = "8000,\"C=CN,O=GmSSL,CN=node, \"\"1\"\"\",";
+	const char *expect_tail = ",2023-11-14T22:13:20Z,2023-11-15T22:13:20Z,"
+		"1.2.156.10197.1.501,1.2.840.10045.2.1,1.2.156.10197.1.301,1\n";
+	FILE *fp;
+	size_t consumed, certs_cnt, errors_cnt, matches;
+
+	if (!(fp = tmpfile())) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_scan(certs, certs_len, X509_SCAN_DER, X509_SCAN_ALL_FIELDS, X509_SCAN_CSV,
+		fp, 2, &consumed, &certs_cnt, &errors_cnt) != 1
+		|| consumed != certs_len
+		|| certs_cnt != TEST_CERTS_CNT
+		|| errors_cnt != 0) {
+		error_print();
+		fclose(fp);
+		return -1;
+	}
+	if (count_lines(fp, expect, &matches) != TEST_CERTS_CNT || matches != 1
+		|| count_lines(fp, expect_tail, &matches) != TEST_CERTS_CNT || matches != TEST_CERTS_CNT) {
+		error_print();
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+
+	// a truncated certificate is left for the next call
+	if (!(fp = tmpfile())) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_scan(certs, certs_len - 10, X509_SCAN_DER, X509_SCAN_SERIAL_NUMBER, X509_SCAN_CSV,
+		fp, 1, &consumed, &certs_cnt, &errors_cnt) != 1
+		|| consumed != cert_offsets[TEST_CERTS_CNT - 1]
+		|| certs_cnt != TEST_CERTS_CNT - 1) {
+		error_print();
+		fclose(fp);
+		return -1;
+	}
+	fclose(fp);
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+}
+
+static int test_x509_certs_scan_pem(void)
+{
+	const char *expect = "{\"serial\":\"8001\",\"subject\":\"C=CN,O=GmSSL,CN=node, \\\"1\\\"\",\"gm\":true}\n";
+	FILE *pem_fp;
+	FILE *fp;
+	uint8_t *pem = NULL;
+	size_t pemlen;
+	size_t consumed, certs_cnt, errors_cnt, matches;
+	int fields;
+	int i;
+	int ret = -1;
+
+	if (x509_scan_fields_from_names("serial,subject,gm", &fields) != 1
+		|| fields != (X509_SCAN_SERIAL_NUMBER|X509_SCAN_SUBJECT|X509_SCAN_GM)
+		|| x509_scan_fields_from_names("serial,unknown", &fields) != -1) {
+		error_print();
+		return -1;
+	}
+	if (x509_scan_fields_from_names("serial,subject,gm", &fields) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (!(pem_fp = tmpfile()) || !(fp = tmpfile())) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < TEST_CERTS_CNT; i++) {
+		size_t len = (i + 1 < TEST_CERTS_CNT ? cert_offsets[i + 1] : certs_len) - cert_offsets[i];
+		fprintf(pem_fp, "junk line %d\n", i);
+		if (pem_write(pem_fp, "CERTIFICATE", certs + cert_offsets[i], len) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	pemlen = (size_t)ftell(pem_fp);
+	if (!(pem = (uint8_t *)malloc(pemlen))) {
+		error_print();
+		goto end;
+	}
+	rewind(pem_fp);
+	if (fread(pem, 1, pemlen, pem_fp) != pemlen) {
+		error_print();
+		goto end;
+	}
+
+	if (x509_certs_scan(pem, pemlen, X509_SCAN_PEM, fields, X509_SCAN_JSON,
+		fp, 3, &consumed, &certs_cnt, &errors_cnt) != 1
+		|| consumed != pemlen
+		|| certs_cnt != TEST_CERTS_CNT
+		|| errors_cnt != 0) {
+		error_print();
+		goto end;
+	}
+	if (count_lines(fp, expect, &matches) != TEST_CERTS_CNT || matches != 1) {
+		error_print();
+		goto end;
+	}
+
+	// streaming input, with a truncated certificate at the end
+	fclose(fp);
+	if (!(fp = tmpfile())) {
+		error_print();
+		goto end;
+	}
+	fseek(pem_fp, 0, SEEK_END);
+	fprintf(pem_fp, "-----BEGIN CERTIFICATE-----\nMIIB\n");
+	rewind(pem_fp);
+	if (x509_certs_scan_fp(pem_fp, X509_SCAN_PEM, fields, X509_SCAN_JSON,
+		fp, 2, &certs_cnt, &errors_cnt) != 1
+		|| certs_cnt != TEST_CERTS_CNT
+		|| errors_cnt != 1) {
+		error_print();
+		goto end;
+	}
+	if (count_lines(fp, expect, &matches) != TEST_CERTS_CNT || matches != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	if (pem) free(pem);
+	fclose(pem_fp);
+	fclose(fp);
+	return ret;
+}
+
+int main(void)
+{
+	if (gen_certs() != 1) goto err;
+	if (test_x509_certs_scan_der() != 1) goto err;
+	if (test_x509_certs_scan_pem() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
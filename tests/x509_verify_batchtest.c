@@ -0,0 +1,188 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/x509.h>
+#include <gmssl/error.h>
+#include "test_cert.h"
+
+
+static int test_x509_batch_verify(void)
+{
+	SM2_KEY root_key;
+	SM2_KEY sub_key;
+	SM2_KEY other_key;
+	SM2_KEY key;
+	uint8_t cacerts[2048];
+	size_t cacertslen = 0;
+	uint8_t sub_cert[1024];
+	size_t sub_certlen = 0;
+	uint8_t certs[8192];
+	size_t certslen = 0;
+	uint8_t revoked_certs[64];
+	size_t revoked_certs_len = 0;
+	uint8_t crl[1024];
+	size_t crl_len = 0;
+	uint8_t sub_name[256];
+	size_t sub_namelen = 0;
+	uint8_t revoked_serial = 0x11;
+	X509_BATCH_VERIFIER verifier;
+	X509_BATCH_RESULT results[8];
+	size_t results_cnt;
+	time_t now;
+	uint8_t *p;
+	int expected[] = {
+		X509_BATCH_VERIFIED,
+		X509_BATCH_REVOKED,
+		X509_BATCH_VERIFIED,
+		X509_BATCH_BAD_SIGNATURE,
+		X509_BATCH_UNKNOWN_ISSUER,
+	};
+	size_t i;
+
+	if (sm2_key_generate(&root_key) != 1
+		|| sm2_key_generate(&sub_key) != 1
+		|| sm2_key_generate(&other_key) != 1
+		|| sm2_key_generate(&key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// trust store: Root and its subordinate CA Sub
+	p = cacerts;
+	if (test_cert_generate("Root", &root_key, "Root", &root_key,
+		(const uint8_t *)"\x01", 1, 0, 0, TEST_CERT_CA, &p, &cacertslen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = sub_cert;
+	if (test_cert_generate("Sub", &sub_key, "Root", &root_key,
+		(const uint8_t *)"\x02", 1, 0, 0, TEST_CERT_CA, &p, &sub_certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(cacerts + cacertslen, sub_cert, sub_certlen);
+	cacertslen += sub_certlen;
+
+	// chains: [E0 Sub] [E1 Sub] [E2] [E3 Sub] [E4]
+	p = certs;
+	if (test_cert_generate("E0", &key, "Sub", &sub_key,
+		(const uint8_t *)"\x10", 1, 0, 0, 0, &p, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, sub_cert, sub_certlen);
+	p += sub_certlen;
+	certslen += sub_certlen;
+	if (test_cert_generate("E1", &key, "Sub", &sub_key,
+		&revoked_serial, 1, 0, 0, 0, &p, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, sub_cert, sub_certlen);
+	p += sub_certlen;
+	certslen += sub_certlen;
+	if (test_cert_generate("E2", &key, "Root", &root_key,
+		(const uint8_t *)"\x12", 1, 0, 0, 0, &p, &certslen) != 1
+		// issued in the name of Sub with another key
+		|| test_cert_generate("E3", &key, "Sub", &other_key,
+			(const uint8_t *)"\x13", 1, 0, 0, 0, &p, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+	memcpy(p, sub_cert, sub_certlen);
+	p += sub_certlen;
+	certslen += sub_certlen;
+	if (test_cert_generate("E4", &key, "Other", &other_key,
+		(const uint8_t *)"\x14", 1, 0, 0, 0, &p, &certslen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// CRL of Sub revoking E1
+	time(&now);
+	p = revoked_certs;
+	if (x509_name_set(sub_name, &sub_namelen, sizeof(sub_name), "CN", NULL, NULL, "GmSSL", NULL, "Sub") != 1
+		|| x509_revoked_cert_to_der(&revoked_serial, 1, now, NULL, 0, &p, &revoked_certs_len) != 1) {
+		error_print();
+		return -1;
+	}
+	p = crl;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, sub_name, sub_namelen,
+		now, now + 86400, revoked_certs, revoked_certs_len, NULL, 0,
+		&sub_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &crl_len) != 1) {
+		error_print();
+		return -1;
+	}
+
+	if (x509_batch_verifier_init(&verifier, cacerts, cacertslen, crl, crl_len, NULL, 0) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_batch_verify(&verifier, certs, certslen, NULL, &results_cnt, 0, 0) != 1
+		|| results_cnt != sizeof(expected)/sizeof(expected[0])) {
+		error_print();
+		goto err;
+	}
+	if (x509_batch_verify(&verifier, certs, certslen, results, &results_cnt,
+			sizeof(results)/sizeof(results[0]), 3) != 1
+		|| results_cnt != sizeof(expected)/sizeof(expected[0])) {
+		error_print();
+		goto err;
+	}
+	for (i = 0; i < results_cnt; i++) {
+		if (results[i].result != expected[i]) {
+			fprintf(stderr, "chain %zu: %s\n", i, x509_batch_result_name(results[i].result));
+			error_print();
+			goto err;
+		}
+	}
+	if (results[0].chain != certs || results[0].chainlen <= sub_certlen) {
+		error_print();
+		goto err;
+	}
+	x509_batch_verifier_cleanup(&verifier);
+
+	// the CRL must be signed by a CA in the store
+	p = crl;
+	crl_len = 0;
+	if (x509_crl_sign_to_der(X509_version_v2, OID_sm2sign_with_sm3, sub_name, sub_namelen,
+		now, now + 86400, revoked_certs, revoked_certs_len, NULL, 0,
+		&other_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &crl_len) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_batch_verifier_init(&verifier, cacerts, cacertslen, crl, crl_len, NULL, 0) != -1) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 1;
+err:
+	x509_batch_verifier_cleanup(&verifier);
+	return -1;
+}
+
+int main(void)
+{
+	if (test_x509_batch_verify() != 1) goto err;
+	printf("%s all tests passed\n", __FILE__);
+	return 0;
+err:
+	error_print();
+	return 1;
+}
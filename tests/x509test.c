@@ -13,9 +13,11 @@
 #include <stdlib.h>
 #include <gmssl/oid.h>
 #include <gmssl/x509_alg.h>
+#include <gmssl/x509_ext.h>
 #include <gmssl/x509.h>
 #include <gmssl/rand.h>
 #include <gmssl/error.h>
+#include "test_cert.h"
 
 
 static int test_x509_version(void)
@@ -383,6 +385,519 @@ static int test_x509_cert(void)
 	return 0;
 }
 
+static int test_x509_verify_cache(void)
+{
+	SM2_KEY ca_key;
+	SM2_KEY key;
+	SM2_KEY forged_key;
+	uint8_t cacert[1024];
+	uint8_t forged_cacert[1024];
+	uint8_t cert[1024];
+	size_t cacertlen = 0, forged_cacertlen = 0, certlen = 0;
+	uint8_t *p;
+	uint8_t dgst[32] = {0};
+	size_t hits, misses;
+	int verify_result;
+
+	p = cacert;
+	if (sm2_key_generate(&ca_key) != 1
+		|| test_cert_generate("CA", &ca_key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA,
+			&p, &cacertlen) != 1) {
+		error_print();
+		return -1;
+	}
+	p = cert;
+	if (sm2_key_generate(&key) != 1
+		|| test_cert_generate("server", &key, "CA", &ca_key,
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, TEST_CERT_SKID, &p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	// same subject name, different key
+	p = forged_cacert;
+	if (sm2_key_generate(&forged_key) != 1
+		|| test_cert_generate("CA", &forged_key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA,
+			&p, &forged_cacertlen) != 1) {
+		error_print();
+		return -1;
+	}
+
+	x509_verify_cache_clear();
+	if (x509_certs_verify(cert, certlen, X509_cert_chain_server, cacert, cacertlen, 1, &verify_result) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_verify_cache_get_stats(&hits, &misses);
+	if (hits != 0 || misses != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_certs_verify(cert, certlen, X509_cert_chain_server, cacert, cacertlen, 1, &verify_result) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_verify_cache_get_stats(&hits, &misses);
+	if (hits != 1 || misses != 1) {
+		error_print();
+		return -1;
+	}
+
+	// a cached link does not vouch for another issuer
+	if (x509_certs_verify(cert, certlen, X509_cert_chain_server, forged_cacert, forged_cacertlen, 1, &verify_result) == 1) {
+		error_print();
+		return -1;
+	}
+
+	// entries are bound to the validity period
+	if (x509_verify_cache_add(dgst, dgst, 1000, 2000) != 1
+		|| x509_verify_cache_lookup(dgst, dgst, 1500) != 1
+		|| x509_verify_cache_lookup(dgst, dgst, 2001) != 0
+		|| x509_verify_cache_lookup(dgst, dgst, 1500) != 0) {
+		error_print();
+		return -1;
+	}
+
+	x509_verify_cache_set_enabled(0);
+	if (x509_certs_verify(cert, certlen, X509_cert_chain_server, cacert, cacertlen, 1, &verify_result) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_verify_cache_set_enabled(1);
+	if (x509_certs_verify(cert, certlen, X509_cert_chain_server, cacert, cacertlen, 1, &verify_result) != 1) {
+		error_print();
+		return -1;
+	}
+	x509_verify_cache_get_stats(&hits, &misses);
+	if (hits != 2 || misses != 5) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+}
+
+static int test_x509_cert_issuer(void)
+{
+	SM2_KEY ca_key;
+	uint8_t cacert[1024];
+	size_t cacertlen = 0;
+	const uint8_t *ca_name;
+	size_t ca_namelen;
+	uint8_t exts[256];
+	size_t extslen = 0;
+	X509_CERT_ISSUER issuer;
+	X509_CERT_ISSUE_ITEM items[40];
+	SM2_KEY keys[40];
+	uint8_t serials[40][8];
+	uint8_t names[40][256];
+	size_t namelens[40];
+	uint8_t *certs = NULL;
+	size_t certlens[40];
+	uint8_t cert[1024];
+	size_t certlen = 0;
+	const uint8_t *tbs, *ref_tbs, *sig;
+	size_t tbslen, ref_tbslen, siglen;
+	const uint8_t *cp;
+	size_t len;
+	int sig_alg;
+	time_t not_before, not_after;
+	char cn[16];
+	uint8_t *p;
+	size_t i;
+	int ret = -1;
+
+	p = cacert;
+	if (sm2_key_generate(&ca_key) != 1
+		|| test_cert_generate("CA", &ca_key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA, &p, &cacertlen) != 1
+		|| x509_cert_get_subject(cacert, cacertlen, &ca_name, &ca_namelen) != 1
+		|| x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, X509_KU_DIGITAL_SIGNATURE) != 1
+		|| x509_cert_issuer_init(&issuer, ca_name, ca_namelen, exts, extslen, 1,
+			&ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+		error_print();
+		return -1;
+	}
+
+	time(&not_before);
+	x509_validity_add_days(&not_after, not_before, 1);
+	for (i = 0; i < sizeof(items)/sizeof(items[0]); i++) {
+		snprintf(cn, sizeof(cn), "device-%zu", i);
+		if (sm2_key_generate(&keys[i]) != 1
+			|| rand_bytes(serials[i], sizeof(serials[i])) != 1
+			|| x509_name_set(names[i], &namelens[i], sizeof(names[i]), "CN", NULL, NULL, "GmSSL", NULL, cn) != 1) {
+			error_print();
+			goto end;
+		}
+		serials[i][0] = (serials[i][0] & 0x7f) | 0x01;
+		items[i].serial = serials[i];
+		items[i].serial_len = sizeof(serials[i]);
+		items[i].not_before = not_before;
+		items[i].not_after = not_after;
+		items[i].subject = names[i];
+		items[i].subject_len = namelens[i];
+		items[i].subject_public_key = &keys[i];
+	}
+	if (!(certs = (uint8_t *)malloc(sizeof(cert) * 40))) {
+		error_print();
+		goto end;
+	}
+	if (x509_cert_issuer_issue(&issuer, items, 40, certs, sizeof(cert), certlens, 4) != 1) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 40; i++) {
+		if (x509_cert_verify_by_ca_cert(certs + sizeof(cert) * i, certlens[i], cacert, cacertlen,
+			SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// the same TBSCertificate as x509_cert_sign_to_der
+	if (x509_exts_add_subject_key_identifier_ex(exts, &extslen, sizeof(exts), -1, &keys[0]) != 1) {
+		error_print();
+		goto end;
+	}
+	p = cert;
+	if (x509_cert_sign_to_der(X509_version_v3, serials[0], sizeof(serials[0]), OID_sm2sign_with_sm3,
+		ca_name, ca_namelen, not_before, not_after, names[0], namelens[0], &keys[0],
+		NULL, 0, NULL, 0, exts, extslen, &ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+		&p, &certlen) != 1) {
+		error_print();
+		goto end;
+	}
+	cp = cert;
+	len = certlen;
+	if (x509_signed_from_der(&ref_tbs, &ref_tbslen, &sig_alg, &sig, &siglen, &cp, &len) != 1) {
+		error_print();
+		goto end;
+	}
+	cp = certs;
+	len = certlens[0];
+	if (x509_signed_from_der(&tbs, &tbslen, &sig_alg, &sig, &siglen, &cp, &len) != 1
+		|| tbslen != ref_tbslen
+		|| memcmp(tbs, ref_tbs, tbslen) != 0) {
+		error_print();
+		goto end;
+	}
+
+	// too small an output fails the certificate only
+	if (x509_cert_issuer_issue(&issuer, items, 1, certs, 64, certlens, 1) != -1
+		|| certlens[0] != 0) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 0;
+end:
+	x509_cert_issuer_cleanup(&issuer);
+	free(certs);
+	return ret;
+}
+
+static int test_x509_cert_index(void)
+{
+	SM2_KEY key;
+	uint8_t cert[1024];
+	size_t certlen = 0;
+	uint8_t *p = cert;
+	X509_CERT_INDEX idx;
+	const uint8_t *serial, *issuer, *subject, *exts;
+	size_t serial_len, issuer_len, subject_len, exts_len;
+	time_t not_before, not_after;
+	SM2_KEY public_key;
+	const uint8_t *d;
+	size_t dlen;
+	time_t t1, t2;
+	SM2_KEY pub;
+	uint8_t name[256];
+
+	if (sm2_key_generate(&key) != 1
+		|| test_cert_generate("Alice", &key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA, &p, &certlen) != 1
+		|| x509_cert_get_details(cert, certlen, NULL, &serial, &serial_len, NULL, &issuer, &issuer_len,
+			&not_before, &not_after, &subject, &subject_len, &public_key,
+			NULL, NULL, NULL, NULL, &exts, &exts_len, NULL, NULL, NULL) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// lazy accessors return the same fields as the eager parsing
+	if (x509_cert_index_init(&idx, cert, certlen) != 1
+		|| x509_cert_index_get_serial_number(&idx, &d, &dlen) != 1
+		|| d != serial || dlen != serial_len
+		|| x509_cert_index_get_issuer(&idx, &d, &dlen) != 1
+		|| d != issuer || dlen != issuer_len
+		|| x509_cert_index_get_subject(&idx, &d, &dlen) != 1
+		|| d != subject || dlen != subject_len
+		|| x509_cert_index_get_exts(&idx, &d, &dlen) != 1
+		|| d != exts || dlen != exts_len
+		|| x509_cert_index_get_validity(&idx, &t1, &t2) != 1
+		|| t1 != not_before || t2 != not_after
+		|| x509_cert_index_get_subject_public_key(&idx, &pub) != 1
+		|| sm2_public_key_equ(&pub, &public_key) != 1) {
+		error_print();
+		return -1;
+	}
+
+	// truncated certificate
+	if (x509_cert_index_init(&idx, cert, certlen - 1) == 1) {
+		error_print();
+		return -1;
+	}
+
+	// no version and no extensions
+	memcpy(name, subject, subject_len);
+	p = cert;
+	certlen = 0;
+	if (x509_cert_sign_to_der(-1, (uint8_t *)"\x01", 1, OID_sm2sign_with_sm3,
+			name, subject_len, not_before, not_after, name, subject_len, &key,
+			NULL, 0, NULL, 0, NULL, 0, &key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH, &p, &certlen) != 1
+		|| x509_cert_index_init(&idx, cert, certlen) != 1
+		|| idx.serial_number != 0
+		|| x509_cert_index_get_exts(&idx, &d, &dlen) != 0
+		|| x509_cert_get_exts(cert, certlen, &d, &dlen) != 0
+		|| x509_cert_get_subject(cert, certlen, &d, &dlen) != 1
+		|| dlen != subject_len) {
+		error_print();
+		return -1;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+}
+
+static int test_x509_store(void)
+{
+	SM2_KEY keys[40];
+	uint8_t certs[40 * 1024];
+	size_t certslen = 0;
+	const uint8_t *cert_ptrs[40];
+	size_t cert_lens[40];
+	uint8_t server_cert[1024];
+	size_t server_certlen = 0;
+	SM2_KEY server_key;
+	X509_STORE store;
+	char cn[16];
+	uint8_t name[256];
+	size_t namelen;
+	const uint8_t *subject, *issuer, *serial, *key_id;
+	size_t subject_len, issuer_len, serial_len, key_id_len;
+	uint8_t dgst[32];
+	const uint8_t *cert;
+	size_t certlen;
+	uint8_t *p;
+	int verify_result;
+	int i;
+
+	for (i = 0; i < 40; i++) {
+		p = certs + certslen;
+		cert_ptrs[i] = p;
+		snprintf(cn, sizeof(cn), "CA-%d", i);
+		certlen = 0;
+		if (sm2_key_generate(&keys[i]) != 1
+			|| test_cert_generate(cn, &keys[i], NULL, NULL,
+				NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA,
+				&p, &certlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cert_lens[i] = certlen;
+		certslen += certlen;
+	}
+	// the same subject again, the first one is returned
+	p = certs + certslen;
+	certlen = 0;
+	if (sm2_key_generate(&server_key) != 1
+		|| test_cert_generate("CA-7", &server_key, NULL, NULL,
+			NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA, &p, &certlen) != 1) {
+		error_print();
+		return -1;
+	}
+	certslen += certlen;
+
+	if (x509_store_init(&store, certs, certslen) != 1
+		|| x509_store_get_count(&store) != 41) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 40; i++) {
+		if (x509_cert_get_subject(cert_ptrs[i], cert_lens[i], &subject, &subject_len) != 1
+			|| x509_cert_get_issuer_and_serial_number(cert_ptrs[i], cert_lens[i],
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| x509_cert_get_subject_key_identifier(cert_ptrs[i], cert_lens[i], &key_id, &key_id_len) != 1
+			|| sm2_public_key_digest(&keys[i], dgst) != 1
+			|| key_id_len != 32 || memcmp(key_id, dgst, 32) != 0) {
+			error_print();
+			return -1;
+		}
+		if (x509_store_get_cert_by_subject(&store, subject, subject_len, &cert, &certlen) != 1
+			|| cert != cert_ptrs[i] || certlen != cert_lens[i]
+			|| x509_store_get_cert_by_subject_and_key_identifier(&store, subject, subject_len,
+				key_id, key_id_len, &cert, &certlen) != 1
+			|| cert != cert_ptrs[i]
+			|| x509_store_get_cert_by_issuer_and_serial_number(&store, issuer, issuer_len,
+				serial, serial_len, &cert, &certlen) != 1
+			|| cert != cert_ptrs[i]) {
+			error_print();
+			return -1;
+		}
+		// the linear lookup agrees
+		if (x509_certs_get_cert_by_subject_and_key_identifier(certs, certslen, subject, subject_len,
+			key_id, key_id_len, &cert, &certlen) != 1
+			|| cert != cert_ptrs[i]) {
+			error_print();
+			return -1;
+		}
+	}
+
+	if (x509_name_set(name, &namelen, sizeof(name), "CN", NULL, NULL, "GmSSL", NULL, "CA-40") != 1
+		|| x509_store_get_cert_by_subject(&store, name, namelen, &cert, &certlen) != 0
+		|| x509_store_get_cert_by_subject_and_key_identifier(&store, name, namelen, dgst, 32, &cert, &certlen) != 0) {
+		error_print();
+		return -1;
+	}
+
+	// chains are completed from the store
+	p = server_cert;
+	if (sm2_key_generate(&server_key) != 1
+		|| test_cert_generate("server", &server_key, "CA-29", &keys[29],
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, TEST_CERT_SKID, &p, &server_certlen) != 1
+		|| x509_certs_verify_ex(server_cert, server_certlen, X509_cert_chain_server,
+			NULL, 0, &store, 1, &verify_result) != 1
+		|| x509_certs_verify_ex(server_cert, server_certlen, X509_cert_chain_server,
+			cert_ptrs[0], cert_lens[0], NULL, 1, &verify_result) == 1) {
+		error_print();
+		return -1;
+	}
+
+	x509_store_cleanup(&store);
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+}
+
+static int test_x509_store_snapshot(void)
+{
+	SM2_KEY keys[20];
+	uint8_t certs[20 * 1024];
+	size_t certslen = 0;
+	const uint8_t *cert_ptrs[20];
+	size_t cert_lens[20];
+	uint8_t server_cert[1024];
+	size_t server_certlen = 0;
+	SM2_KEY server_key;
+	SM2_KEY public_key;
+	X509_STORE store;
+	uint8_t *snapshot = NULL;
+	size_t snapshot_len;
+	const uint8_t *snapshot_certs;
+	size_t snapshot_certslen;
+	const uint8_t *subject, *issuer, *serial, *key_id;
+	size_t subject_len, issuer_len, serial_len, key_id_len;
+	const uint8_t *cert;
+	size_t certlen;
+	uint8_t *p;
+	char cn[16];
+	int verify_result;
+	int i;
+
+	for (i = 0; i < 20; i++) {
+		p = certs + certslen;
+		cert_ptrs[i] = p;
+		snprintf(cn, sizeof(cn), "CA-%d", i);
+		certlen = 0;
+		if (sm2_key_generate(&keys[i]) != 1
+			|| test_cert_generate(cn, &keys[i], NULL, NULL,
+				NULL, 0, 0, X509_KU_KEY_CERT_SIGN, TEST_CERT_SKID|TEST_CERT_CA,
+				&p, &certlen) != 1) {
+			error_print();
+			return -1;
+		}
+		cert_lens[i] = certlen;
+		certslen += certlen;
+	}
+
+	if (x509_store_snapshot(certs, certslen, NULL, &snapshot_len) != 1
+		|| !(snapshot = (uint8_t *)malloc(snapshot_len))
+		|| x509_store_snapshot(certs, certslen, snapshot, &snapshot_len) != 1
+		|| x509_store_init_from_snapshot(&store, snapshot, snapshot_len,
+			&snapshot_certs, &snapshot_certslen) != 1) {
+		error_print();
+		free(snapshot);
+		return -1;
+	}
+	if (x509_store_get_count(&store) != 20
+		|| snapshot_certslen != certslen
+		|| memcmp(snapshot_certs, certs, certslen) != 0) {
+		error_print();
+		goto err;
+	}
+
+	// the lookups return the certificates inside the snapshot
+	for (i = 0; i < 20; i++) {
+		if (x509_cert_get_subject(cert_ptrs[i], cert_lens[i], &subject, &subject_len) != 1
+			|| x509_cert_get_issuer_and_serial_number(cert_ptrs[i], cert_lens[i],
+				&issuer, &issuer_len, &serial, &serial_len) != 1
+			|| x509_cert_get_subject_key_identifier(cert_ptrs[i], cert_lens[i], &key_id, &key_id_len) != 1) {
+			error_print();
+			goto err;
+		}
+		if (x509_store_get_cert_by_subject(&store, subject, subject_len, &cert, &certlen) != 1
+			|| cert != snapshot_certs + (cert_ptrs[i] - certs) || certlen != cert_lens[i]
+			|| x509_store_get_cert_by_subject_and_key_identifier(&store, subject, subject_len,
+				key_id, key_id_len, &cert, &certlen) != 1
+			|| cert != snapshot_certs + (cert_ptrs[i] - certs)
+			|| x509_store_get_cert_by_issuer_and_serial_number(&store, issuer, issuer_len,
+				serial, serial_len, &cert, &certlen) != 1
+			|| cert != snapshot_certs + (cert_ptrs[i] - certs)) {
+			error_print();
+			goto err;
+		}
+		if (x509_store_get_public_key_by_subject(&store, subject, subject_len, &public_key) != 1
+			|| sm2_public_key_equ(&public_key, &keys[i]) != 1) {
+			error_print();
+			goto err;
+		}
+	}
+
+	p = server_cert;
+	if (sm2_key_generate(&server_key) != 1
+		|| test_cert_generate("server", &server_key, "CA-11", &keys[11],
+			NULL, 0, 0, X509_KU_DIGITAL_SIGNATURE, TEST_CERT_SKID, &p, &server_certlen) != 1
+		|| x509_certs_verify_ex(server_cert, server_certlen, X509_cert_chain_server,
+			NULL, 0, &store, 1, &verify_result) != 1) {
+		error_print();
+		goto err;
+	}
+	x509_store_cleanup(&store);
+
+	// any changed byte is caught by the digest
+	snapshot[snapshot_len / 2] ^= 1;
+	if (x509_store_init_from_snapshot(&store, snapshot, snapshot_len,
+		&snapshot_certs, &snapshot_certslen) == 1) {
+		error_print();
+		goto err;
+	}
+	snapshot[snapshot_len / 2] ^= 1;
+	if (x509_store_init_from_snapshot(&store, snapshot, snapshot_len - 1,
+		&snapshot_certs, &snapshot_certslen) == 1) {
+		error_print();
+		goto err;
+	}
+
+	free(snapshot);
+	printf("%s() ok\n", __FUNCTION__);
+	return 0;
+err:
+	x509_store_cleanup(&store);
+	free(snapshot);
+	return -1;
+}
+
 int main(void)
 {
 	int err = 0;
@@ -394,5 +909,10 @@ int main(void)
 	err += test_x509_public_key_info();
 	err += test_x509_tbs_cert();
 	err += test_x509_cert();
+	err += test_x509_verify_cache();
+	err += test_x509_cert_issuer();
+	err += test_x509_cert_index();
+	err += test_x509_store();
+	err += test_x509_store_snapshot();
 	return err;
 }
@@ -11,8 +11,10 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
-#include <time.h>
 #include <gmssl/zuc.h>
+#include <gmssl/cpu.h>
+#include <gmssl/rand.h>
+#include <gmssl/endian.h>
 #include <gmssl/error.h>
 
 
@@ -467,61 +469,153 @@ static int test_zuc256_mac(void)
 	return 1;
 }
 
-static int speed_zuc_generate_keystream(void)
+// lengths around the word and chunk boundaries, not a multiple of the lanes
+static int test_zuc_packets(void)
 {
-	ZUC_STATE zuc_state;
-	uint8_t key[16];
-	uint8_t iv[16];
-	uint32_t buf[1024]; // aligned
-	clock_t begin, end;
-	double seconds;
-	int i;
-
-	zuc_init(&zuc_state, key, iv);
-	for (i = 0; i < 4096; i++) {
-		zuc_generate_keystream(&zuc_state, 1024, buf);
+	enum { NPACKETS = 37, MAX_NWORDS = 1024 };
+	static uint32_t in[NPACKETS][MAX_NWORDS];
+	static uint32_t out[NPACKETS][MAX_NWORDS];
+	static uint32_t buf[MAX_NWORDS];
+	uint8_t keys[NPACKETS][32];
+	uint8_t ivs[NPACKETS][ZUC256_IV_SIZE];
+	ZUC_PACKET packets[NPACKETS];
+	ZUC_UINT32 macs[NPACKETS];
+	const uint8_t *key_ptrs[NPACKETS];
+	const uint8_t *iv_ptrs[NPACKETS];
+	const uint8_t *in_ptrs[NPACKETS];
+	uint8_t *out_ptrs[NPACKETS];
+	size_t inlens[NPACKETS];
+	ZUC256_STATE state;
+	size_t i;
+	int pass;
+
+	rand_bytes((uint8_t *)in, sizeof(in));
+	rand_bytes(keys[0], sizeof(keys));
+	rand_bytes(ivs[0], sizeof(ivs));
+	for (i = 0; i < NPACKETS; i++) {
+		packets[i].key = keys[i];
+		packets[i].count = (ZUC_UINT32)(0x398a59b4 + i * 0x01010101);
+		packets[i].bearer = (ZUC_UINT5)(i % 32);
+		packets[i].direction = (ZUC_BIT)(i & 1);
+		packets[i].in = in[i];
+		packets[i].out = out[i];
+		packets[i].nbits = (i * 389) % 3000;
+		key_ptrs[i] = keys[i];
+		iv_ptrs[i] = ivs[i];
+		in_ptrs[i] = (uint8_t *)in[i];
+		out_ptrs[i] = (uint8_t *)out[i];
+		inlens[i] = (i * 97) % 400;
 	}
+	packets[0].nbits = 0;
+	packets[1].nbits = 1;
+	packets[2].nbits = 32;
+	packets[3].nbits = 33;
+	packets[4].nbits = 32 * MAX_NWORDS;
+	inlens[4] = 4 * MAX_NWORDS;
+
+	// dispatched kernel, the AVX2 lanes, then the scalar fallback
+	for (pass = 0; pass < 3; pass++) {
+		if (pass == 1) {
+			gmssl_cpu_disable_features(GMSSL_CPU_AVX512F);
+		} else if (pass == 2) {
+			gmssl_cpu_disable_features(GMSSL_CPU_AVX2);
+		}
 
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		zuc_generate_keystream(&zuc_state, 1024, buf);
-	}
-	end = clock();
+		memset(out, 0, sizeof(out));
+		zuc_eea_encrypt_packets(packets, NPACKETS);
+		for (i = 0; i < NPACKETS; i++) {
+			size_t nwords = ZUC_EEA_ENCRYPT_NWORDS(packets[i].nbits);
+			zuc_eea_encrypt(in[i], buf, packets[i].nbits, keys[i],
+				packets[i].count, packets[i].bearer, packets[i].direction);
+			if (memcmp(out[i], buf, nwords * 4) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+
+		zuc_eia_generate_mac_packets(packets, NPACKETS, macs);
+		for (i = 0; i < NPACKETS; i++) {
+			if (macs[i] != zuc_eia_generate_mac(in[i], packets[i].nbits, keys[i],
+				packets[i].count, packets[i].bearer, packets[i].direction)) {
+				error_print();
+				return -1;
+			}
+		}
 
-	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f-MiB per second\n", __FUNCTION__, 16/seconds);
+		memset(out, 0, sizeof(out));
+		zuc256_encrypt_batch(key_ptrs, iv_ptrs, in_ptrs, inlens, out_ptrs, NPACKETS);
+		for (i = 0; i < NPACKETS; i++) {
+			zuc256_init(&state, keys[i], ivs[i]);
+			zuc_encrypt(&state, (uint8_t *)in[i], inlens[i], (uint8_t *)buf);
+			if (memcmp(out[i], buf, inlens[i]) != 0) {
+				error_print();
+				return -1;
+			}
+		}
+	}
 
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
-static int speed_zuc_encrypt(void)
+static ZUC_UINT32 zuc_window(const ZUC_UINT32 *keystream, size_t i)
+{
+	uint64_t K = ((uint64_t)keystream[i/32] << 32) | keystream[i/32 + 1];
+	return (ZUC_UINT32)(K >> (32 - i % 32));
+}
+
+// EIA3 of the specification bit by bit, against the word-parallel MAC with and without PCLMULQDQ
+static int test_zuc_mac_words(void)
 {
-	ZUC_STATE zuc_state;
 	uint8_t key[16];
 	uint8_t iv[16];
-	uint32_t align_buf[1024];
-	uint8_t *buf = (uint8_t *)align_buf;
-	clock_t begin, end;
-	double seconds;
-	int i;
-
-	zuc_init(&zuc_state, key, iv);
-	for (i = 0; i < 4096; i++) {
-		zuc_encrypt(&zuc_state, buf, 4096, buf);
-	}
-
-	begin = clock();
-	for (i = 0; i < 4096; i++) {
-		zuc_encrypt(&zuc_state, buf, 4096, buf);
+	uint8_t msg[700];
+	ZUC_UINT32 keystream[ZUC_EEA_ENCRYPT_NWORDS(sizeof(msg) * 8) + 2];
+	ZUC_STATE state;
+	ZUC_MAC_CTX ctx;
+	ZUC_UINT32 T;
+	uint8_t mac[4];
+	size_t nbits, i;
+	int pass;
+
+	rand_bytes(key, sizeof(key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(msg, sizeof(msg));
+
+	for (pass = 0; pass < 2; pass++) {
+		if (pass) {
+			gmssl_cpu_disable_features(GMSSL_CPU_PCLMUL);
+		}
+		for (nbits = 0; nbits <= sizeof(msg) * 8; nbits += 157) {
+			size_t L = ZUC_EEA_ENCRYPT_NWORDS(nbits) + 2;
+
+			zuc_init(&state, key, iv);
+			zuc_generate_keystream(&state, L, keystream);
+			T = 0;
+			for (i = 0; i < nbits; i++) {
+				if ((msg[i/8] >> (7 - i % 8)) & 1) {
+					T ^= zuc_window(keystream, i);
+				}
+			}
+			T ^= zuc_window(keystream, nbits);
+			T ^= keystream[L - 1];
+
+			// split at an odd byte offset to run the buffered path
+			zuc_mac_init(&ctx, key, iv);
+			zuc_mac_update(&ctx, msg, (nbits/8) / 3);
+			zuc_mac_finish(&ctx, msg + (nbits/8) / 3, nbits - 8 * ((nbits/8) / 3), mac);
+			if (GETU32(mac) != T) {
+				error_print();
+				return -1;
+			}
+		}
 	}
-	end = clock();
-
-	seconds = (double)(end - begin)/CLOCKS_PER_SEC;
-	fprintf(stderr, "%s: %f-MiB per second\n", __FUNCTION__, 16/seconds);
 
+	printf("%s() ok\n", __FUNCTION__);
 	return 1;
 }
 
+// 64-byte packets, each with its own key, count and bearer
 int main(void)
 {
 	if (test_zuc() != 1) goto err;
@@ -529,10 +623,8 @@ int main(void)
 	if (test_zuc_eia() != 1) goto err;
 	if (test_zuc256() != 1) goto err;
 	if (test_zuc256_mac() != 1) goto err;
-#if ENABLE_TEST_SPEED
-	if (speed_zuc_generate_keystream() != 1) goto err;
-	if (speed_zuc_encrypt() != 1) goto err;
-#endif
+	if (test_zuc_packets() != 1) goto err;
+	if (test_zuc_mac_words() != 1) goto err;
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
 err:
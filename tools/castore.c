@@ -0,0 +1,123 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/x509.h>
+
+
+static const char *options = "-in pem -out file";
+
+static char *usage =
+"Options\n"
+"\n"
+"    -in pem                Trusted CA certificates in PEM format\n"
+"    -out file              Output trust store snapshot\n"
+"\n"
+"    The snapshot holds the certificates with their subject, key identifier\n"
+"    and issuer indexes and the decoded public keys. It is loaded without\n"
+"    parsing by tls_ctx_set_ca_snapshot(), and is rebuilt when the CA\n"
+"    certificates change.\n"
+"\n"
+"Examples\n"
+"\n"
+"    gmssl castore -in cacerts.pem -out cacerts.store\n"
+"\n";
+
+int castore_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *infile = NULL;
+	char *outfile = NULL;
+	FILE *outfp = NULL;
+	uint8_t *certs = NULL;
+	size_t certslen;
+	uint8_t *out = NULL;
+	size_t outlen;
+	X509_STORE store;
+	const uint8_t *store_certs;
+	size_t store_certslen;
+
+	argc--;
+	argv++;
+
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, options);
+		return 1;
+	}
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, options);
+			printf("%s\n", usage);
+			goto end;
+		} else if (!strcmp(*argv, "-in")) {
+			if (--argc < 1) goto bad;
+			infile = *(++argv);
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+		} else {
+			fprintf(stderr, "%s: illegal option `%s`\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "%s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	if (!infile) {
+		fprintf(stderr, "%s: `-in` option required\n", prog);
+		goto end;
+	}
+	if (!outfile) {
+		fprintf(stderr, "%s: `-out` option required\n", prog);
+		goto end;
+	}
+	if (x509_certs_new_from_file(&certs, &certslen, infile) != 1 || !certslen) {
+		fprintf(stderr, "%s: read certificates from '%s' failure\n", prog, infile);
+		goto end;
+	}
+	if (x509_store_snapshot(certs, certslen, NULL, &outlen) != 1
+		|| !(out = (uint8_t *)malloc(outlen))
+		|| x509_store_snapshot(certs, certslen, out, &outlen) != 1) {
+		fprintf(stderr, "%s: build snapshot failure\n", prog);
+		goto end;
+	}
+	// loaded back, so a snapshot the TLS context would reject is never written
+	if (x509_store_init_from_snapshot(&store, out, outlen, &store_certs, &store_certslen) != 1) {
+		fprintf(stderr, "%s: check snapshot failure\n", prog);
+		goto end;
+	}
+	fprintf(stderr, "%s: %zu certificates\n", prog, x509_store_get_count(&store));
+	x509_store_cleanup(&store);
+
+	if (!(outfp = fopen(outfile, "wb"))) {
+		fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+		goto end;
+	}
+	if (fwrite(out, 1, outlen, outfp) != outlen) {
+		fprintf(stderr, "%s: write '%s' failure\n", prog, outfile);
+		goto end;
+	}
+	ret = 0;
+
+end:
+	if (certs) free(certs);
+	if (out) free(out);
+	if (outfp) fclose(outfp);
+	return ret;
+}
@@ -37,7 +37,8 @@ static const char *options =
 	" [-crl_http_uri uri] [-crl_ldap_uri uri]"
 	" [-inhibit_any_policy num]"
 	" [-ca_issuers_uri uri] [-ocsp_uri uri uri]"
-	" [-out pem]";
+	" [-out pem]"
+	" [-batch csv -cacert pem [-threads num]]";
 
 static char *usage =
 "Options\n"
@@ -54,6 +55,15 @@ static char *usage =
 "                                   the default string '1234567812345678' is used\n"
 "    -out file                    Output certificate file in PEM format\n"
 "\n"
+"  Batch options\n"
+"\n"
+"    -batch file                  Issue a certificate for every line `CN,public_key_pem_file`\n"
+"                                 of the CSV manifest, lines starting with '#' are skipped.\n"
+"                                 `-C`, `-ST`, `-L`, `-O`, `-OU` and the extension options\n"
+"                                 apply to all the certificates, `-CN` is not used\n"
+"    -cacert pem                  Issuer CA certificate, must match `-key`\n"
+"    -threads num                 Signing threads, default one per CPU\n"
+"\n"
 "  Subject and Issuer options\n"
 "\n"
 "    -C  str                      Country\n"
@@ -112,6 +122,10 @@ static char *usage =
 "          -crl_http_uri http://pku.edu.cn/ca.crl \\\n"
 "          -ca_issuers_uri http://pku.edu.cn/ca.crt -ocsp_uri http://ocsp.pku.edu.cn \\\n"
 "          -out rootcacert.pem\n"
+"\n"
+"    gmssl certgen -batch devices.csv -cacert cacert.pem -key cakey.pem -pass P@ssw0rd \\\n"
+"          -C CN -O PKU -days 30 -gen_subject_key_id -key_usage digitalSignature \\\n"
+"          -out devicecerts.pem\n"
 "\n";
 
 
@@ -126,6 +140,119 @@ static int ext_key_usage_set(int *usages, const char *usage_name)
 	return 1;
 }
 
+// manifest lines issued by one x509_cert_issuer_issue call
+#define CERTGEN_BATCH_SIZE	1024
+#define CERTGEN_BATCH_MAX_CERT_SIZE	(2048 + X509_CERT_ISSUER_MAX_EXTS_SIZE)
+
+typedef struct {
+	X509_CERT_ISSUE_ITEM items[CERTGEN_BATCH_SIZE];
+	SM2_KEY keys[CERTGEN_BATCH_SIZE];
+	uint8_t serials[CERTGEN_BATCH_SIZE][20];
+	uint8_t names[CERTGEN_BATCH_SIZE][256];
+	size_t certlens[CERTGEN_BATCH_SIZE];
+	uint8_t certs[CERTGEN_BATCH_SIZE * CERTGEN_BATCH_MAX_CERT_SIZE];
+} CERTGEN_BATCH;
+
+static int certgen_batch_issue(const char *prog, const X509_CERT_ISSUER *issuer, CERTGEN_BATCH *batch,
+	size_t count, int threads, FILE *outfp)
+{
+	size_t i;
+
+	if (x509_cert_issuer_issue(issuer, batch->items, count,
+		batch->certs, CERTGEN_BATCH_MAX_CERT_SIZE, batch->certlens, threads) != 1) {
+		fprintf(stderr, "%s: certificate generation failure\n", prog);
+		return -1;
+	}
+	for (i = 0; i < count; i++) {
+		if (x509_cert_to_pem(batch->certs + CERTGEN_BATCH_MAX_CERT_SIZE * i, batch->certlens[i], outfp) != 1) {
+			fprintf(stderr, "%s: output certificate failed\n", prog);
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int certgen_batch(const char *prog, FILE *manifest_fp, const X509_CERT_ISSUER *issuer,
+	const char *country, const char *state, const char *locality, const char *org, const char *org_unit,
+	int serial_len, time_t not_before, time_t not_after, int threads, FILE *outfp)
+{
+	int ret = -1;
+	CERTGEN_BATCH *batch;
+	char line[1024];
+	char *common_name;
+	char *keyfile;
+	FILE *keyfp;
+	size_t lineno = 0;
+	size_t count = 0;
+	size_t namelen;
+
+	if (!(batch = (CERTGEN_BATCH *)malloc(sizeof(CERTGEN_BATCH)))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		return -1;
+	}
+
+	while (fgets(line, sizeof(line), manifest_fp)) {
+		lineno++;
+		line[strcspn(line, "\r\n")] = 0;
+		if (!line[0] || line[0] == '#') {
+			continue;
+		}
+		common_name = line;
+		if (!(keyfile = strchr(line, ',')) || keyfile == line || !keyfile[1]) {
+			fprintf(stderr, "%s: manifest line %zu: need `CN,public_key_pem_file`\n", prog, lineno);
+			goto end;
+		}
+		*keyfile++ = 0;
+
+		if (!(keyfp = fopen(keyfile, "rb"))) {
+			fprintf(stderr, "%s: manifest line %zu: open '%s' failure : %s\n", prog, lineno, keyfile, strerror(errno));
+			goto end;
+		}
+		if (sm2_public_key_info_from_pem(&batch->keys[count], keyfp) != 1) {
+			fprintf(stderr, "%s: manifest line %zu: load public key '%s' failure\n", prog, lineno, keyfile);
+			fclose(keyfp);
+			goto end;
+		}
+		fclose(keyfp);
+		if (x509_name_set(batch->names[count], &namelen, sizeof(batch->names[count]),
+			country, state, locality, org, org_unit, common_name) != 1) {
+			fprintf(stderr, "%s: manifest line %zu: set Subject Name error\n", prog, lineno);
+			goto end;
+		}
+		if (rand_bytes(batch->serials[count], serial_len) != 1) {
+			fprintf(stderr, "%s: RNG error\n", prog);
+			goto end;
+		}
+
+		batch->items[count].serial = batch->serials[count];
+		batch->items[count].serial_len = serial_len;
+		batch->items[count].not_before = not_before;
+		batch->items[count].not_after = not_after;
+		batch->items[count].subject = batch->names[count];
+		batch->items[count].subject_len = namelen;
+		batch->items[count].subject_public_key = &batch->keys[count];
+
+		if (++count == CERTGEN_BATCH_SIZE) {
+			if (certgen_batch_issue(prog, issuer, batch, count, threads, outfp) != 1) {
+				goto end;
+			}
+			count = 0;
+		}
+	}
+	if (ferror(manifest_fp)) {
+		fprintf(stderr, "%s: read manifest failure\n", prog);
+		goto end;
+	}
+	if (count && certgen_batch_issue(prog, issuer, batch, count, threads, outfp) != 1) {
+		goto end;
+	}
+	ret = 1;
+
+end:
+	free(batch);
+	return ret;
+}
+
 int certgen_main(int argc, char **argv)
 {
 	int ret = 1;
@@ -204,6 +331,18 @@ int certgen_main(int argc, char **argv)
 	char *ca_issuers_uri = NULL;
 	char *ocsp_uri = NULL;
 
+	// Batch
+	FILE *batchfp = NULL;
+	uint8_t *cacert = NULL;
+	size_t cacertlen;
+	const uint8_t *issuer_name;
+	size_t issuer_name_len;
+	SM2_KEY issuer_public_key;
+	X509_CERT_ISSUER issuer;
+	int threads = 0;
+#ifdef ENABLE_SM2_SIGN_POOL
+	SM2_SIGN_POOL *pool = NULL;
+#endif
 
 	argc--;
 	argv++;
@@ -355,6 +494,28 @@ int certgen_main(int argc, char **argv)
 			if (--argc < 1) goto bad;
 			ocsp_uri = *(++argv);
 
+		} else if (!strcmp(*argv, "-batch")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (!(batchfp = fopen(str, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, str, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (x509_cert_new_from_file(&cacert, &cacertlen, str) != 1) {
+				fprintf(stderr, "%s: load ca certificate '%s' failure\n", prog, str);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
+			if (threads < 0) {
+				fprintf(stderr, "%s: invalid `-threads` value\n", prog);
+				goto end;
+			}
+
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -374,7 +535,7 @@ bad:
 		argv++;
 	}
 
-	if (!common_name) {
+	if (!common_name && !batchfp) {
 		fprintf(stderr, "%s: option `-CN` required\n", prog);
 		printf("usage: gmssl %s %s\n\n", prog, options);
 		goto end;
@@ -403,6 +564,21 @@ bad:
 		strcpy(signer_id, SM2_DEFAULT_ID);
 		signer_id_len = strlen(SM2_DEFAULT_ID);
 	}
+	if (batchfp && !cacert) {
+		fprintf(stderr, "%s: option `-cacert` required by `-batch`\n", prog);
+		goto end;
+	}
+	if (batchfp) {
+		if (x509_cert_get_subject(cacert, cacertlen, &issuer_name, &issuer_name_len) != 1
+			|| x509_cert_get_subject_public_key(cacert, cacertlen, &issuer_public_key) != 1) {
+			fprintf(stderr, "%s: parse CA certificate failure\n", prog);
+			goto end;
+		}
+		if (sm2_public_key_equ(&sm2_key, &issuer_public_key) != 1) {
+			fprintf(stderr, "%s: private key and CA certificate not match\n", prog);
+			goto end;
+		}
+	}
 
 	// Serial
 	if (rand_bytes(serial, sizeof(serial)) != 1) {
@@ -410,8 +586,9 @@ bad:
 		goto end;
 	}
 
-	// Issuer, Subject
-	if (x509_name_set(name, &namelen, sizeof(name), country, state, locality, org, org_unit, common_name) != 1) {
+	// Issuer, Subject, in batch mode the Subject is of every manifest line
+	if (!batchfp
+		&& x509_name_set(name, &namelen, sizeof(name), country, state, locality, org, org_unit, common_name) != 1) {
 		fprintf(stderr, "%s: set Issuer/Subject Name error\n", prog);
 		goto end;
 	}
@@ -430,7 +607,8 @@ bad:
 			goto end;
 		}
 	}
-	if (gen_subject_key_id) {
+	// in batch mode the SubjectKeyIdentifier is of every subject key
+	if (gen_subject_key_id && !batchfp) {
 		if (x509_exts_add_subject_key_identifier_ex(exts, &extslen, sizeof(exts), -1, &sm2_key) != 1) {
 			fprintf(stderr, "%s: set SubjectKeyIdentifier extension failure\n", prog);
 			goto end;
@@ -500,6 +678,30 @@ bad:
 		}
 	}
 
+	if (batchfp) {
+#ifdef ENABLE_SM2_SIGN_POOL
+		if (!(pool = sm2_sign_pool_new(CERTGEN_BATCH_SIZE, 1))
+			|| x509_cert_issuer_init_ex(&issuer, issuer_name, issuer_name_len,
+				exts, extslen, gen_subject_key_id,
+				&sm2_key, signer_id, signer_id_len, pool) != 1) {
+#else
+		if (x509_cert_issuer_init(&issuer, issuer_name, issuer_name_len,
+			exts, extslen, gen_subject_key_id,
+			&sm2_key, signer_id, signer_id_len) != 1) {
+#endif
+			fprintf(stderr, "%s: certificate generation failure\n", prog);
+			goto end;
+		}
+		if (certgen_batch(prog, batchfp, &issuer, country, state, locality, org, org_unit,
+			serial_len, not_before, not_after, threads, outfp) != 1) {
+			x509_cert_issuer_cleanup(&issuer);
+			goto end;
+		}
+		x509_cert_issuer_cleanup(&issuer);
+		ret = 0;
+		goto end;
+	}
+
 	if (x509_cert_sign_to_der(
 		X509_version_v3,
 		serial, serial_len,
@@ -547,7 +749,12 @@ bad:
 end:
 	gmssl_secure_clear(&sm2_key, sizeof(SM2_KEY));
 	if (cert) free(cert);
+	if (cacert) free(cacert);
 	if (keyfp) fclose(keyfp);
+	if (batchfp) fclose(batchfp);
+#ifdef ENABLE_SM2_SIGN_POOL
+	if (pool) sm2_sign_pool_free(pool);
+#endif
 	if (outfile && outfp) fclose(outfp);
 	return ret;
 }
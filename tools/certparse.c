@@ -14,9 +14,10 @@
 #include <stdlib.h>
 #include <gmssl/pem.h>
 #include <gmssl/x509.h>
+#include <gmssl/x509_scan.h>
 
 
-static const char *options = "[-in pem] [-out file]";
+static const char *options = "[-in pem] [-out file] [-scan [-inform der|pem] [-fields names] [-format csv|json] [-threads num]]";
 
 static char *usage =
 "Options\n"
@@ -25,10 +26,20 @@ static char *usage =
 "                           This command supports continuous multiple certificates\n"
 "                           Do not include blank line or comments between PEM data\n"
 "    [-out file]stdout      Output file\n"
+"    -scan                  Output one line per certificate instead of the full text\n"
+"                           Malformed certificates are counted and skipped\n"
+"    -inform der|pem        Scan input format, default pem\n"
+"                           DER input is concatenated DER certificates\n"
+"    -fields names          Comma separated fields to output, default all\n"
+"                           serial, issuer, subject, not_before, not_after,\n"
+"                           sig_alg, key_alg, key_param, gm\n"
+"    -format csv|json       CSV with a header line or JSON lines, default csv\n"
+"    -threads num           Scan threads, default one per CPU\n"
 "\n"
 "Examples\n"
 "\n"
 "    gmssl certparse -in certs.pem\n"
+"    gmssl certparse -scan -inform der -in certs.der -fields serial,subject,gm -format json\n"
 "\n";
 
 int certparse_main(int argc, char **argv)
@@ -41,6 +52,12 @@ int certparse_main(int argc, char **argv)
 	FILE *outfp = stdout;
 	uint8_t cert[18192];
 	size_t certlen;
+	int scan = 0;
+	int in_format = X509_SCAN_PEM;
+	int fields = X509_SCAN_ALL_FIELDS;
+	int out_format = X509_SCAN_CSV;
+	int threads = 0;
+	size_t certs_cnt, errors_cnt;
 
 	argc--;
 	argv++;
@@ -64,6 +81,40 @@ int certparse_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-scan")) {
+			scan = 1;
+		} else if (!strcmp(*argv, "-inform")) {
+			if (--argc < 1) goto bad;
+			argv++;
+			if (!strcmp(*argv, "der")) {
+				in_format = X509_SCAN_DER;
+			} else if (!strcmp(*argv, "pem")) {
+				in_format = X509_SCAN_PEM;
+			} else {
+				fprintf(stderr, "%s: invalid `-inform` value '%s'\n", prog, *argv);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-fields")) {
+			if (--argc < 1) goto bad;
+			argv++;
+			if (x509_scan_fields_from_names(*argv, &fields) != 1) {
+				fprintf(stderr, "%s: invalid `-fields` value '%s'\n", prog, *argv);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-format")) {
+			if (--argc < 1) goto bad;
+			argv++;
+			if (!strcmp(*argv, "csv")) {
+				out_format = X509_SCAN_CSV;
+			} else if (!strcmp(*argv, "json")) {
+				out_format = X509_SCAN_JSON;
+			} else {
+				fprintf(stderr, "%s: invalid `-format` value '%s'\n", prog, *argv);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
 		} else {
 			fprintf(stderr, "%s: illegal option `%s`\n", prog, *argv);
 			goto end;
@@ -76,6 +127,18 @@ bad:
 		argv++;
 	}
 
+	if (scan) {
+		x509_scan_print_header(outfp, fields, out_format);
+		if (x509_certs_scan_fp(infp, in_format, fields, out_format, outfp, threads,
+			&certs_cnt, &errors_cnt) != 1) {
+			fprintf(stderr, "%s: scan certificates failure\n", prog);
+			goto end;
+		}
+		fprintf(stderr, "%s: %zu certificates, %zu errors\n", prog, certs_cnt, errors_cnt);
+		ret = 0;
+		goto end;
+	}
+
 	for (;;) {
 		int rv;
 		if ((rv = x509_cert_from_pem(cert, &certlen, sizeof(cert), infp)) != 1) {
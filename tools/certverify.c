@@ -13,6 +13,7 @@
 #include <string.h>
 #include <stdlib.h>
 #include <gmssl/hex.h>
+#include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/x509_crl.h>
 #include <gmssl/error.h>
@@ -20,9 +21,10 @@
 
 static const char *usage =
 	" -in pem [-double_certs]"
-	" [-check_crl]"
+	" [-check_crl | -crl der]"
 	" -cacert pem"
 	" [-sm2_id str | -sm2_id_hex hex]"
+	" [-batch [-threads num]]"
 	"\n";
 
 static const char *options =
@@ -31,6 +33,7 @@ static const char *options =
 "    -in pem             Input certificate chain file in PEM format\n"
 "    -double_certs       The first two certificates are SM2 signing and encryption entity certificate\n"
 "    -check_crl          If the entity certificate has CRLDistributionPoints extension, Download and check againt the CRL\n"
+"    -crl der            Check the entity certificate(s) against a local CRL file in DER format\n"
 "    -cacert pem         CA certificate\n"
 "    -sm2_id str         Signer's ID in SM2 signature algorithm\n"
 "    -sm2_id_hex hex     Signer's ID in hex format\n"
@@ -38,8 +41,151 @@ static const char *options =
 "                          must use the same ID in other commands explicitly.\n"
 "                        If neither `-sm2_id` nor `-sm2_id_hex` is specified,\n"
 "                          the default string '1234567812345678' is used\n"
+"    -batch              Verify every chain of the input, one result line per chain\n"
+"                        A chain is an entity certificate followed by its CA certificates,\n"
+"                          it ends at a certificate not followed by its issuer\n"
+"                        The last certificate of a chain is verified by `-cacert`,\n"
+"                          which can hold any number of CA certificates\n"
+"                        The entity certificates are checked against the `-crl` of their issuer\n"
+"                        Input is stdin without `-in`\n"
+"    -threads num        Verification threads of `-batch`, default one per CPU\n"
 "\n";
 
+// the CRL is indexed once and verified by the issuer of the entity certificate
+static int check_crl_index(const uint8_t *cert, size_t certlen, const X509_CRL_INDEX *index,
+	const uint8_t *cacert, size_t cacertlen, const char *signer_id, size_t signer_id_len)
+{
+	if (x509_crl_verify_by_ca_cert(index->crl, index->crl_len, cacert, cacertlen,
+		signer_id, signer_id_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return x509_cert_check_crl_index(cert, certlen, index);
+}
+
+#define CERTVERIFY_BATCH_SIZE	(1024 * 1024)
+#define CERTVERIFY_MAX_CERT_SIZE	18192
+
+// output lines: index,serialNumber,result
+static int certverify_batch(const char *prog, FILE *infp, const char *cacertfile,
+	const uint8_t *crl, size_t crl_len, const char *signer_id, size_t signer_id_len, int threads)
+{
+	int ret = 1;
+	uint8_t *cacerts = NULL;
+	size_t cacertslen;
+	X509_BATCH_VERIFIER verifier;
+	uint8_t *certs = NULL;
+	size_t certslen = 0;
+	size_t batchlen;
+	X509_BATCH_RESULT *results = NULL;
+	size_t results_cnt;
+	size_t max_results = 0;
+	size_t chains_cnt = 0;
+	size_t failures_cnt = 0;
+	int eof = 0;
+	size_t i, j;
+	int rv;
+
+	memset(&verifier, 0, sizeof(verifier));
+
+	if (x509_certs_new_from_file(&cacerts, &cacertslen, cacertfile) != 1) {
+		fprintf(stderr, "%s: load CA certificates failure\n", prog);
+		goto end;
+	}
+	if (x509_batch_verifier_init(&verifier, cacerts, cacertslen, crl, crl_len,
+		signer_id, signer_id_len) != 1) {
+		fprintf(stderr, "%s: CA certificates or CRL invalid\n", prog);
+		goto end;
+	}
+	if (!(certs = (uint8_t *)malloc(CERTVERIFY_BATCH_SIZE + CERTVERIFY_MAX_CERT_SIZE))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
+
+	while (!eof || certslen) {
+		while (!eof && certslen < CERTVERIFY_BATCH_SIZE) {
+			size_t len;
+			if ((rv = x509_cert_from_pem(certs + certslen, &len, CERTVERIFY_MAX_CERT_SIZE, infp)) != 1) {
+				if (rv < 0) {
+					fprintf(stderr, "%s: read certificate failure\n", prog);
+					goto end;
+				}
+				eof = 1;
+				break;
+			}
+			certslen += len;
+		}
+
+		// the last chain may continue in the input
+		batchlen = certslen;
+		if (!eof) {
+			const uint8_t *p = certs;
+			size_t len = certslen;
+			const uint8_t *chain;
+			size_t chainlen;
+
+			while (x509_chain_from_der(&chain, &chainlen, &p, &len) == 1) {
+				if (chain > certs) {
+					batchlen = (size_t)(chain - certs);
+				}
+			}
+		}
+
+		if (x509_batch_verify(&verifier, certs, batchlen, NULL, &results_cnt, 0, threads) != 1) {
+			fprintf(stderr, "%s: parse certificates failure\n", prog);
+			goto end;
+		}
+		if (results_cnt > max_results) {
+			X509_BATCH_RESULT *r;
+			if (!(r = (X509_BATCH_RESULT *)realloc(results, sizeof(X509_BATCH_RESULT) * results_cnt))) {
+				fprintf(stderr, "%s: malloc failure\n", prog);
+				goto end;
+			}
+			results = r;
+			max_results = results_cnt;
+		}
+		if (x509_batch_verify(&verifier, certs, batchlen, results, &results_cnt, max_results, threads) != 1) {
+			fprintf(stderr, "%s: verify certificates failure\n", prog);
+			goto end;
+		}
+
+		for (i = 0; i < results_cnt; i++) {
+			const uint8_t *chain = results[i].chain;
+			size_t chainlen = results[i].chainlen;
+			const uint8_t *cert;
+			size_t certlen;
+			const uint8_t *serial;
+			size_t serial_len;
+
+			printf("%zu,", chains_cnt++);
+			if (x509_cert_from_der(&cert, &certlen, &chain, &chainlen) == 1
+				&& x509_cert_get_issuer_and_serial_number(cert, certlen,
+					NULL, NULL, &serial, &serial_len) == 1) {
+				for (j = 0; j < serial_len; j++) {
+					printf("%02X", serial[j]);
+				}
+			}
+			printf(",%s\n", x509_batch_result_name(results[i].result));
+			if (results[i].result != X509_BATCH_VERIFIED) {
+				failures_cnt++;
+			}
+		}
+
+		memmove(certs, certs + batchlen, certslen - batchlen);
+		certslen -= batchlen;
+	}
+
+	fprintf(stderr, "%s: %zu chains, %zu failed\n", prog, chains_cnt, failures_cnt);
+	if (!failures_cnt) {
+		ret = 0;
+	}
+end:
+	x509_batch_verifier_cleanup(&verifier);
+	if (results) free(results);
+	if (certs) free(certs);
+	if (cacerts) free(cacerts);
+	return ret;
+}
 
 int certverify_main(int argc, char **argv)
 {
@@ -79,6 +225,14 @@ int certverify_main(int argc, char **argv)
 
 	int check_crl = 0;
 	int crl_ret;
+	uint8_t *crl = NULL;
+	size_t crl_len;
+	X509_CRL_INDEX crl_index;
+
+	int batch = 0;
+	int threads = 0;
+
+	memset(&crl_index, 0, sizeof(crl_index));
 
 	argc--;
 	argv++;
@@ -105,6 +259,14 @@ int certverify_main(int argc, char **argv)
 			double_certs = 1;
 		} else if (!strcmp(*argv, "-check_crl")) {
 			check_crl = 1;
+		} else if (!strcmp(*argv, "-crl")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (file_read_all(str, &crl, &crl_len) != 1) {
+				fprintf(stderr, "%s: read '%s' failure : %s\n", prog, str, strerror(errno));
+				goto end;
+			}
+			check_crl = 1;
 		} else if (!strcmp(*argv, "-cacert")) {
 			if (--argc < 1) goto bad;
 			cacertfile = *(++argv);
@@ -132,6 +294,11 @@ int certverify_main(int argc, char **argv)
 				fprintf(stderr, "%s: invalid `-sm2_id_hex` value\n", prog);
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-batch")) {
+			batch = 1;
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
 		} else {
 			fprintf(stderr, "%s: illegal option '%s'\n", prog, *argv);
 			goto end;
@@ -145,7 +312,7 @@ bad:
 	}
 
 
-	if (!infile) {
+	if (!infile && !batch) {
 		fprintf(stderr, "%s: '-in' option required\n", prog);
 		goto end;
 	}
@@ -157,6 +324,21 @@ bad:
 		strcpy(signer_id, SM2_DEFAULT_ID);
 		signer_id_len = strlen(SM2_DEFAULT_ID);
 	}
+	if (batch) {
+		if (crl && x509_crl_check(crl, crl_len, time(NULL)) != 1) {
+			fprintf(stderr, "%s: invalid CRL data or format\n", prog);
+			goto end;
+		}
+		ret = certverify_batch(prog, infp, cacertfile, crl, crl_len, signer_id, signer_id_len, threads);
+		goto end;
+	}
+	if (crl) {
+		if (x509_crl_check(crl, crl_len, time(NULL)) != 1
+			|| x509_crl_index_init(&crl_index, crl, crl_len) != 1) {
+			fprintf(stderr, "%s: invalid CRL data or format\n", prog);
+			goto end;
+		}
+	}
 
 	// read first to be verified certificate
 	if (x509_cert_from_pem(cert, &certlen, sizeof(cert), infp) != 1
@@ -200,8 +382,8 @@ bad:
 		format_print(stdout, 0, 4, "Verification success\n");
 
 		if (check_crl) {
-			if ((crl_ret = x509_cert_check_crl(cert, certlen, cacert, cacertlen,
-				signer_id, signer_id_len)) < 0) {
+			if ((crl_ret = crl ? check_crl_index(cert, certlen, &crl_index, cacert, cacertlen, signer_id, signer_id_len)
+				: x509_cert_check_crl(cert, certlen, cacert, cacertlen, signer_id, signer_id_len)) < 0) {
 				fprintf(stderr, "%s: Certificate has been revoked\n", prog);
 				goto end;
 			}
@@ -220,8 +402,8 @@ bad:
 			x509_name_print(stdout, 0, 4, "subject", enc_subject, enc_subject_len);
 			format_print(stdout, 0, 4, "Verification success\n");
 			if (check_crl) {
-				if ((crl_ret = x509_cert_check_crl(enc_cert, enc_cert_len, cacert, cacertlen,
-					signer_id, signer_id_len)) < 0) {
+				if ((crl_ret = crl ? check_crl_index(enc_cert, enc_cert_len, &crl_index, cacert, cacertlen, signer_id, signer_id_len)
+					: x509_cert_check_crl(enc_cert, enc_cert_len, cacert, cacertlen, signer_id, signer_id_len)) < 0) {
 					fprintf(stderr, "%s: Certificate has been revoked\n", prog);
 					goto end;
 				}
@@ -262,8 +444,8 @@ final:
 	format_print(stdout, 0, 4, "Verification success\n");
 
 	if (check_crl) {
-		if ((crl_ret = x509_cert_check_crl(cert, certlen, cacert, cacertlen,
-			signer_id, signer_id_len)) < 0) {
+		if ((crl_ret = crl ? check_crl_index(cert, certlen, &crl_index, cacert, cacertlen, signer_id, signer_id_len)
+			: x509_cert_check_crl(cert, certlen, cacert, cacertlen, signer_id, signer_id_len)) < 0) {
 			fprintf(stderr, "%s: certificate has been revoked\n", prog);
 			goto end;
 		}
@@ -283,8 +465,8 @@ final:
 		format_print(stdout, 0, 4, "Verification success\n");
 
 		if (check_crl) {
-			if ((crl_ret = x509_cert_check_crl(enc_cert, enc_cert_len, cacert, cacertlen,
-				signer_id, signer_id_len)) < 0) {
+			if ((crl_ret = crl ? check_crl_index(enc_cert, enc_cert_len, &crl_index, cacert, cacertlen, signer_id, signer_id_len)
+				: x509_cert_check_crl(enc_cert, enc_cert_len, cacert, cacertlen, signer_id, signer_id_len)) < 0) {
 				fprintf(stderr, "%s: certificate has been revoked\n", prog);
 				goto end;
 			}
@@ -306,6 +488,8 @@ final:
 
 	ret = 0;
 end:
+	x509_crl_index_cleanup(&crl_index);
+	if (crl) free(crl);
 	if (infile && infp) fclose(infp);
 	if (cacertfp) fclose(cacertfp);
 	return ret;
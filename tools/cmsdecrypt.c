@@ -15,6 +15,7 @@
 #include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
 
 
 
@@ -35,18 +36,22 @@ int cmsdecrypt_main(int argc, char **argv)
 	FILE *outfp = stdout;
 	uint8_t cert[1024];
 	size_t certlen;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
+	uint8_t buf[16384];
+	size_t buflen = 0;
+	uint8_t out[sizeof(buf) + SM4_BLOCK_SIZE];
+	size_t outlen;
+	size_t header_len, content_len, trailer_len;
+	size_t content_left, trailer_nbytes = 0;
+	uint8_t *trailer = NULL;
+	const uint8_t *p;
+	size_t len;
 	SM2_KEY key;
-	int content_type;
-	uint8_t *content = NULL;
-	size_t content_len;
-	const uint8_t *rcpt_infos;
-	size_t rcpt_infos_len;
 	const uint8_t *shared_info1;
 	const uint8_t *shared_info2;
 	size_t shared_info1_len, shared_info2_len;
+	PEM_CTX pem_ctx;
+	CMS_DEENVELOP_CTX deenvelop_ctx;
+	int rv = 0;
 
 	argc--;
 	argv++;
@@ -130,40 +135,71 @@ bad:
 		goto end;
 	}
 
-	if (file_size(infp, &inlen) != 1) {
-		fprintf(stderr, "%s: get input length failed\n", prog);
+	// the header is parsed from the first decoded bytes, the content is streamed
+	if (pem_read_init(&pem_ctx, infp, PEM_CMS) != 1) {
+		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-	cms_maxlen = (inlen * 3)/4 + 1;
-	if (!(cms = malloc(cms_maxlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
+	while (buflen + PEM_READ_MIN_SIZE <= sizeof(buf)
+		&& (rv = pem_read_update(&pem_ctx, buf + buflen, &len, sizeof(buf) - buflen)) == 1) {
+		buflen += len;
 	}
-	if (cms_from_pem(cms, &cmslen, cms_maxlen, infp) != 1) {
+	if (rv < 0) {
 		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-
-	if (!(content = malloc(cmslen))) {
+	if (cms_deenvelop_init(&deenvelop_ctx, buf, buflen, &key, cert, certlen,
+		&header_len, &content_len, &trailer_len) != 1) {
+		fprintf(stderr, "%s: decryption failure\n", prog);
+		goto end;
+	}
+	if (!(trailer = malloc(trailer_len + 1))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
 
-	if (cms_deenvelop(cms, cmslen,
-		&key, cert, certlen,
-		&content_type, content, &content_len,
-		&rcpt_infos, &rcpt_infos_len,
-		&shared_info1, &shared_info1_len,
-		&shared_info2, &shared_info2_len) != 1) {
-		fprintf(stderr, "%s: decryption failure\n", prog);
-		goto end;
+	p = buf + header_len;
+	len = buflen - header_len;
+	content_left = content_len;
+	for (;;) {
+		if (content_left) {
+			size_t n = len < content_left ? len : content_left;
+			if (cms_deenvelop_update(&deenvelop_ctx, p, n, out, &outlen) != 1) {
+				fprintf(stderr, "%s: decryption failure\n", prog);
+				goto end;
+			}
+			if (fwrite(out, 1, outlen, outfp) != outlen) {
+				fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
+				goto end;
+			}
+			content_left -= n;
+			p += n;
+			len -= n;
+		}
+		if (!content_left) {
+			if (len > trailer_len - trailer_nbytes) {
+				fprintf(stderr, "%s: invalid CMS\n", prog);
+				goto end;
+			}
+			memcpy(trailer + trailer_nbytes, p, len);
+			trailer_nbytes += len;
+			if (trailer_nbytes == trailer_len) {
+				break;
+			}
+		}
+		if (pem_read_update(&pem_ctx, buf, &len, sizeof(buf)) != 1) {
+			fprintf(stderr, "%s: read CMS failure\n", prog);
+			goto end;
+		}
+		p = buf;
 	}
-	if (content_type != OID_cms_data) {
-		fprintf(stderr, "%s: invalid CMS content type: %s\n", prog, cms_content_type_name(content_type));
+
+	if (cms_deenvelop_finish(&deenvelop_ctx, trailer, trailer_len, out, &outlen,
+		&shared_info1, &shared_info1_len, &shared_info2, &shared_info2_len) != 1) {
+		fprintf(stderr, "%s: decryption failure\n", prog);
 		goto end;
 	}
-
-	if (fwrite(content, 1, content_len, outfp) != content_len) {
+	if (fwrite(out, 1, outlen, outfp) != outlen) {
 		fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
 		goto end;
 	}
@@ -174,7 +210,6 @@ end:
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (keyfile && keyfp) fclose(keyfp);
-	if (cms) free(cms);
-	if (content) free(content);
+	if (trailer) free(trailer);
 	return ret;
 }
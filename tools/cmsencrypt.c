@@ -16,6 +16,7 @@
 #include <gmssl/cms.h>
 #include <gmssl/x509.h>
 #include <gmssl/rand.h>
+#include <gmssl/pem.h>
 
 
 static const char *options = "-encrypt (-rcptcert pem)* -in file -out file";
@@ -73,11 +74,16 @@ int cmsencrypt_main(int argc, char **argv)
 	size_t rcpt_certs_len;
 	uint8_t key[16];
 	uint8_t iv[16];
-	uint8_t *inbuf = NULL;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen;
+	uint8_t buf[4096];
+	uint8_t out[sizeof(buf) + SM4_BLOCK_SIZE];
+	size_t inlen, len, outlen, nbytes;
+	uint8_t *header = NULL;
+	size_t header_len;
+	uint8_t *trailer = NULL;
+	size_t trailer_len;
 	uint8_t *cert;
+	CMS_ENVELOP_CTX envelop_ctx;
+	PEM_CTX pem_ctx;
 
 	if (argc < 2) {
 		fprintf(stderr, "usage: %s %s\n", prog, options);
@@ -106,10 +112,6 @@ int cmsencrypt_main(int argc, char **argv)
 		fprintf(stderr, "%s: invalid input length\n", prog);
 		goto end;
 	}
-	if (!(inbuf = malloc(inlen))) {
-		fprintf(stderr, "%s: %s\n", prog, strerror(errno));
-		goto end;
-	}
 
 	argc--;
 	argv++;
@@ -143,10 +145,6 @@ int cmsencrypt_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, infile, strerror(errno));
 				goto end;
 			}
-			if ((inlen = fread(inbuf, 1, inlen, infp)) <= 0) {
-				fprintf(stderr, "%s: read data error: %s\n", prog, strerror(errno));
-				goto end;
-			}
 		} else if (!strcmp(*argv, "-out")) {
 			if (--argc < 1) goto bad;
 			outfile = *(++argv);
@@ -168,25 +166,49 @@ bad:
 
 	rcpt_certs_len = cert - rcpt_certs;
 
+	// each RecipientInfo is an IssuerAndSerialNumber and a SM2 ciphertext
+	if (!(header = malloc(rcpt_certs_len + 4096))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
 	if (rand_bytes(key, sizeof(key)) != 1
 		|| rand_bytes(iv, sizeof(iv)) != 1
-		|| cms_envelop(NULL, &cmslen, rcpt_certs, rcpt_certs_len,
+		|| cms_envelop_init(&envelop_ctx, rcpt_certs, rcpt_certs_len,
 			OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
-			OID_cms_data, inbuf, inlen, NULL, 0, NULL, 0) != 1) {
+			NULL, 0, NULL, 0, inlen, header, &header_len, rcpt_certs_len + 4096) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	if (!(cms = malloc(cmslen))) {
+	if (pem_write_init(&pem_ctx, outfp, PEM_CMS) != 1
+		|| pem_write_update(&pem_ctx, header, header_len) != 1) {
+		fprintf(stderr, "%s: output CMS failure\n", prog);
+		goto end;
+	}
+	for (nbytes = 0; nbytes < inlen; nbytes += len) {
+		len = inlen - nbytes < sizeof(buf) ? inlen - nbytes : sizeof(buf);
+		if (fread(buf, 1, len, infp) != len) {
+			fprintf(stderr, "%s: read data error: %s\n", prog, strerror(errno));
+			goto end;
+		}
+		if (cms_envelop_update(&envelop_ctx, buf, len, out, &outlen) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+		if (pem_write_update(&pem_ctx, out, outlen) != 1) {
+			fprintf(stderr, "%s: output CMS failure\n", prog);
+			goto end;
+		}
+	}
+	if (!(trailer = malloc(envelop_ctx.trailer_len))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	if (cms_envelop(cms, &cmslen, rcpt_certs, rcpt_certs_len,
-		OID_sm4_cbc, key, sizeof(key), iv, sizeof(iv),
-		OID_cms_data, inbuf, inlen, NULL, 0, NULL, 0) != 1) {
+	if (cms_envelop_finish(&envelop_ctx, trailer, &trailer_len, envelop_ctx.trailer_len) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	if (cms_to_pem(cms, cmslen, outfp) != 1) {
+	if (pem_write_update(&pem_ctx, trailer, trailer_len) != 1
+		|| pem_write_finish(&pem_ctx) != 1) {
 		fprintf(stderr, "%s: output CMS failure\n", prog);
 		goto end;
 	}
@@ -197,7 +219,7 @@ end:
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (rcpt_certs) free(rcpt_certs);
-	if (inbuf) free(inbuf);
-	if (cms) free(cms);
+	if (header) free(header);
+	if (trailer) free(trailer);
 	return ret;
 }
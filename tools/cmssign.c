@@ -15,6 +15,7 @@
 #include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
 #include <gmssl/error.h>
 
 
@@ -46,11 +47,15 @@ int cmssign_main(int argc, char **argv)
 	SM2_KEY key;
 	uint8_t cert[1024];
 	size_t certlen;
-	uint8_t *in = NULL;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
+	uint8_t buf[4096];
+	FILE_READER reader;
+	const uint8_t *data;
+	size_t inlen, len, nbytes;
+	uint8_t *trailer = NULL;
+	size_t trailer_len;
 	CMS_CERTS_AND_KEY cert_and_key;
+	CMS_SIGN_CTX sign_ctx;
+	PEM_CTX pem_ctx;
 
 	argc--;
 	argv++;
@@ -153,27 +158,46 @@ bad:
 		fprintf(stderr, "%s: get input length failed\n", prog);
 		goto end;
 	}
-	if (!(in = malloc(inlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
+
+	// the content is streamed, only the header and the trailer are buffered
+	if (cms_sign_init(&sign_ctx, &cert_and_key, 1, NULL, 0, inlen, buf, &len, sizeof(buf)) != 1
+		|| pem_write_init(&pem_ctx, outfp, PEM_CMS) != 1
+		|| pem_write_update(&pem_ctx, buf, len) != 1) {
+		fprintf(stderr, "%s: sign failure\n", prog);
 		goto end;
 	}
-	if (fread(in, 1, inlen, infp) != inlen) {
-		fprintf(stderr, "%s: read file error : %s\n",  prog, strerror(errno));
+	if (file_read_init(&reader, infp, 0) != 1) {
+		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-
-	cms_maxlen = (inlen * 4)/3 + 4096; // SignerInfos decide DN length		
-	if (!(cms = malloc(cms_maxlen))) {
+	for (nbytes = 0; nbytes < inlen; nbytes += len) {
+		if (file_read_next(&reader, &data, &len) != 1) {
+			fprintf(stderr, "%s: read file error : %s\n",  prog, strerror(errno));
+			file_read_cleanup(&reader);
+			goto end;
+		}
+		// the content length is fixed by the header
+		if (len > inlen - nbytes) {
+			len = inlen - nbytes;
+		}
+		if (cms_sign_update(&sign_ctx, data, len) != 1
+			|| pem_write_update(&pem_ctx, data, len) != 1) {
+			fprintf(stderr, "%s: sign failure\n", prog);
+			file_read_cleanup(&reader);
+			goto end;
+		}
+	}
+	file_read_cleanup(&reader);
+	if (!(trailer = malloc(sign_ctx.trailer_len))) {
 		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-
-	if (cms_sign(cms, &cmslen, &cert_and_key, 1, OID_cms_data, in, inlen, NULL, 0) != 1) {
+	if (cms_sign_finish(&sign_ctx, trailer, &trailer_len, sign_ctx.trailer_len) != 1) {
 		fprintf(stderr, "%s: sign failure\n", prog);
 		goto end;
 	}
-
-	if (cms_to_pem(cms, cmslen, outfp) != 1) {
+	if (pem_write_update(&pem_ctx, trailer, trailer_len) != 1
+		|| pem_write_finish(&pem_ctx) != 1) {
 		fprintf(stderr, "%s: output failure\n", prog);
 		goto end;
 	}
@@ -184,7 +208,6 @@ end:
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	if (keyfile && keyfp) fclose(keyfp);
-	if (cms) free(cms);
-	if (in) free(in);
+	if (trailer) free(trailer);
 	return ret;
 }
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <gmssl/file.h>
 #include <gmssl/cms.h>
+#include <gmssl/pem.h>
 #include <gmssl/x509.h>
 #include <gmssl/rand.h>
 
@@ -29,19 +30,22 @@ int cmsverify_main(int argc, char **argv)
 	char *outfile = NULL;
 	FILE *infp = NULL;
 	FILE *outfp = NULL;
-	size_t inlen;
-	uint8_t *cms = NULL;
-	size_t cmslen, cms_maxlen;
-	int content_type;
-	const uint8_t *content;
-	size_t content_len;
+	uint8_t buf[16384];
+	size_t buflen = 0;
+	size_t header_len, content_len, trailer_len;
+	size_t content_left, trailer_nbytes = 0;
+	uint8_t *trailer = NULL;
+	const uint8_t *p;
+	size_t len;
 	const uint8_t *certs;
 	size_t certslen;
 	const uint8_t *crls;
 	size_t crlslen;
 	const uint8_t *signer_infos;
 	size_t signer_infos_len;
-	int rv;
+	PEM_CTX pem_ctx;
+	CMS_VERIFY_CTX verify_ctx;
+	int rv = 0;
 
 	argc--;
 	argv++;
@@ -86,56 +90,73 @@ bad:
 		fprintf(stderr, "%s: '-in' option required\n", prog);
 		goto end;
 	}
-	if (file_size(infp, &inlen) != 1) {
-		fprintf(stderr, "%s: get input length failed\n", prog);
+
+	// the header is parsed from the first decoded bytes, the content is streamed
+	if (pem_read_init(&pem_ctx, infp, PEM_CMS) != 1) {
+		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-	cms_maxlen = (inlen * 3)/4 + 1;
-	if (!(cms = malloc(cms_maxlen))) {
-		fprintf(stderr, "%s: malloc failure\n", prog);
-		goto end;
+	while (buflen + PEM_READ_MIN_SIZE <= sizeof(buf)
+		&& (rv = pem_read_update(&pem_ctx, buf + buflen, &len, sizeof(buf) - buflen)) == 1) {
+		buflen += len;
 	}
-	if (cms_from_pem(cms, &cmslen, cms_maxlen, infp) != 1) {
+	if (rv < 0) {
 		fprintf(stderr, "%s: read CMS failure\n", prog);
 		goto end;
 	}
-
-	if ((rv = cms_verify(cms, cmslen, NULL, 0, NULL, 0,
-		&content_type, &content, &content_len,
-		&certs, &certslen, &crls, &crlslen,
-		&signer_infos, &signer_infos_len)) < 0) {
-		fprintf(stderr, "%s: verify error\n", prog);
+	if (cms_verify_init(&verify_ctx, buf, buflen, &header_len, &content_len, &trailer_len) != 1) {
+		fprintf(stderr, "%s: invalid CMS\n", prog);
+		goto end;
+	}
+	if (!(trailer = malloc(trailer_len))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
 		goto end;
 	}
-	printf("verify %s\n", rv ? "success" : "failure");
-	ret = rv ? 0 : 1;
-
-	if (outfile) {
-		const uint8_t *p;
-		size_t len;
 
-		if (content_type == OID_cms_data) {
-			if (asn1_octet_string_from_der(&p, &len, &content, &content_len) != 1
-				|| asn1_length_is_zero(content_len) != 1) {
-				fprintf(stderr, "%s: invalid CMS\n", prog);
+	p = buf + header_len;
+	len = buflen - header_len;
+	content_left = content_len;
+	for (;;) {
+		if (content_left) {
+			size_t n = len < content_left ? len : content_left;
+			if (cms_verify_update(&verify_ctx, p, n) != 1) {
+				fprintf(stderr, "%s: verify error\n", prog);
 				goto end;
 			}
-			if (len != fwrite(p, 1, len, outfp)) {
+			if (outfile && fwrite(p, 1, n, outfp) != n) {
 				fprintf(stderr, "%s: output error : %s\n", prog, strerror(errno));
 				goto end;
 			}
-		} else {
-			fprintf(stderr, "%s: error\n", prog);
+			content_left -= n;
+			p += n;
+			len -= n;
+		}
+		if (!content_left) {
+			if (len > trailer_len - trailer_nbytes) {
+				fprintf(stderr, "%s: invalid CMS\n", prog);
+				goto end;
+			}
+			memcpy(trailer + trailer_nbytes, p, len);
+			trailer_nbytes += len;
+			if (trailer_nbytes == trailer_len) {
+				break;
+			}
+		}
+		if (pem_read_update(&pem_ctx, buf, &len, sizeof(buf)) != 1) {
+			fprintf(stderr, "%s: read CMS failure\n", prog);
 			goto end;
 		}
-
+		p = buf;
 	}
 
-
+	rv = cms_verify_finish(&verify_ctx, trailer, trailer_len,
+		&certs, &certslen, &crls, &crlslen, &signer_infos, &signer_infos_len);
+	printf("verify %s\n", rv == 1 ? "success" : "failure");
+	ret = rv == 1 ? 0 : 1;
 
 end:
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
-	if (cms) free(cms);
+	if (trailer) free(trailer);
 	return ret;
 }
@@ -28,6 +28,7 @@ static const char *usage =
 	" [-gen_authority_key_id]"
 	" [-crl_num num]"
 	" [-delta_crl_indicator num]"
+	" [-base_crl der [-delta]]"
 	" [-ca_issuers_uri uri]"
 	" [-ocsp_uri uri]"
 	" [-out der]\n";
@@ -48,12 +49,17 @@ static const char *options =
 "                           If neither `-sm2_id` nor `-sm2_id_hex` is specified,\n"
 "                             the default string '1234567812345678' is used\n"
 "    -next_update time      Optional CRL attribute\n"
+"    -base_crl der          The last complete CRL, the revoked certificates of `-in` are added to its\n"
+"                           list without re-encoding it. `-crl_num` is the CRLNumber of it plus 1 by default\n"
+"    -delta                 Output a delta CRL of `-base_crl` with the revoked certificates of `-in` only,\n"
+"                           the DeltaCRLIndicator is the CRLNumber of `-base_crl`\n"
 "    -out der | stdout      Output CRL in DER-encoding\n"
 "\n"
 "Examples\n"
 "\n"
 "    gmssl crlgen -in revoked_certs.der -cacert cacert.pem -key cakey.pem -pass P@ssw0rd -gen_authority_key_id -crl_num 1\n"
 "    gmssl crlgen -in revoked_certs.der -cacert cacert.pem -key cakey.pem -pass P@ssw0rd -gen_authority_key_id -crl_num 2\n"
+"    gmssl crlgen -in new_revoked_certs.der -base_crl 2.crl -delta -cacert cacert.pem -key cakey.pem -pass P@ssw0rd\n"
 "\n";
 
 int crlgen_main(int argc, char **argv)
@@ -94,6 +100,18 @@ int crlgen_main(int argc, char **argv)
 	char *ca_issuers_uri = NULL;
 	char *ocsp_uri = NULL;
 
+	uint8_t *base_crl = NULL;
+	size_t base_crl_len = 0;
+	int delta = 0;
+	X509_CRL_BUILDER builder;
+	const uint8_t *base_issuer;
+	size_t base_issuer_len;
+	const uint8_t *base_revoked_certs;
+	size_t base_revoked_certs_len;
+	int base_crl_num;
+	int base_delta_crl_indicator;
+
+	memset(&builder, 0, sizeof(builder));
 
 	argc--;
 	argv++;
@@ -173,6 +191,15 @@ int crlgen_main(int argc, char **argv)
 		} else if (!strcmp(*argv, "-delta_crl_indicator")) {
 			if (--argc < 1) goto bad;
 			delta_crl_indicator = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-base_crl")) {
+			if (--argc < 1) goto bad;
+			str = *(++argv);
+			if (x509_crl_new_from_file(&base_crl, &base_crl_len, str) != 1) {
+				fprintf(stderr, "%s: open CRL '%s' failure\n", prog, str);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-delta")) {
+			delta = 1;
 		} else if (!strcmp(*argv, "-http_uri")) {
 			if (--argc < 1) goto bad;
 			http_uri = *(++argv);
@@ -248,6 +275,61 @@ bad:
 		goto end;
 	}
 
+	if (delta && !base_crl) {
+		fprintf(stderr, "%s: `-delta` requires `-base_crl`\n", prog);
+		goto end;
+	}
+	if (base_crl) {
+		const uint8_t *d = revoked_certs;
+		size_t dlen = revoked_certs_len;
+		const uint8_t *entry;
+		size_t entry_len;
+
+		if (x509_crl_get_issuer(base_crl, base_crl_len, &base_issuer, &base_issuer_len) != 1
+			|| x509_crl_get_revoked_certs(base_crl, base_crl_len, &base_revoked_certs, &base_revoked_certs_len) != 1
+			|| x509_crl_get_crl_number(base_crl, base_crl_len, &base_crl_num, &base_delta_crl_indicator) != 1) {
+			fprintf(stderr, "%s: parse base CRL failure\n", prog);
+			goto end;
+		}
+		if (x509_name_equ(base_issuer, base_issuer_len, issuer, issuer_len) != 1) {
+			fprintf(stderr, "%s: base CRL not issued by the CA certificate\n", prog);
+			goto end;
+		}
+		if (base_delta_crl_indicator >= 0) {
+			fprintf(stderr, "%s: base CRL is a delta CRL\n", prog);
+			goto end;
+		}
+		if (delta) {
+			if (base_crl_num < 0) {
+				fprintf(stderr, "%s: base CRL has no CRLNumber\n", prog);
+				goto end;
+			}
+			delta_crl_indicator = base_crl_num;
+		}
+		if (crl_num < 0 && base_crl_num >= 0) {
+			crl_num = base_crl_num + 1;
+		}
+
+		if (x509_crl_builder_init(&builder, delta ? NULL : base_revoked_certs,
+			delta ? 0 : base_revoked_certs_len) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+		while (dlen) {
+			if (asn1_any_from_der(&entry, &entry_len, &d, &dlen) != 1) {
+				fprintf(stderr, "%s: invalid input\n", prog);
+				goto end;
+			}
+			if (x509_crl_builder_add_revoked_cert(&builder, entry, entry_len) < 0) {
+				fprintf(stderr, "%s: invalid input\n", prog);
+				goto end;
+			}
+		}
+		free(revoked_certs);
+		revoked_certs = NULL;
+		revoked_certs_len = 0;
+	}
+
 	// Extensions
 	if (gen_authority_key_id) {
 		if (x509_crl_exts_add_default_authority_key_identifier(exts, &extslen, sizeof(exts), &sign_key) != 1) {
@@ -285,7 +367,8 @@ bad:
 		OID_sm2sign_with_sm3,
 		issuer, issuer_len,
 		this_update, next_update,
-		revoked_certs, revoked_certs_len,
+		base_crl ? builder.revoked_certs : revoked_certs,
+		base_crl ? builder.revoked_certs_len : revoked_certs_len,
 		extslen ? exts : NULL, extslen,
 		&sign_key, signer_id, signer_id_len,
 		NULL, &outlen) != 1) {
@@ -303,7 +386,8 @@ bad:
 		OID_sm2sign_with_sm3,
 		issuer, issuer_len,
 		this_update, next_update,
-		revoked_certs, revoked_certs_len,
+		base_crl ? builder.revoked_certs : revoked_certs,
+		base_crl ? builder.revoked_certs_len : revoked_certs_len,
 		extslen ? exts : NULL, extslen,
 		&sign_key, signer_id, signer_id_len,
 		&out, &outlen) != 1) {
@@ -318,6 +402,8 @@ bad:
 
 end:
 	if (revoked_certs) free(revoked_certs);
+	if (base_crl) free(base_crl);
+	x509_crl_builder_cleanup(&builder);
 	if (keyfp) fclose(keyfp);
 	if (cacert) free(cacert);
 	if (outfile && outfp) fclose(outfp);
@@ -16,9 +16,10 @@
 #include <gmssl/file.h>
 #include <gmssl/x509.h>
 #include <gmssl/x509_crl.h>
+#include <gmssl/error.h>
 
 
-static const char *usage = " -in der -cacert pem [-req_sm2_id str | -req_sm2_id_hex hex]\n";
+static const char *usage = " -in der -cacert pem [-req_sm2_id str | -req_sm2_id_hex hex] [-cert pem]\n";
 static const char *options =
 "Options\n"
 "\n"
@@ -30,10 +31,12 @@ static const char *options =
 "                                   must use the same ID in other commands explicitly.\n"
 "                                 If neither `-sm2_id` nor `-sm2_id_hex` is specified,\n"
 "                                   the default string '1234567812345678' is used\n"
+"    -cert pem                    Certificates in PEM format to check against the verified CRL\n"
 "\n"
 "Examples\n"
 "\n"
 "    gmssl certverify -in crl.der -cacert cacert.pem\n"
+"    gmssl crlverify -in crl.der -cacert cacert.pem -cert certs.pem\n"
 "\n";
 
 int crlverify_main(int argc, char **argv)
@@ -48,8 +51,17 @@ int crlverify_main(int argc, char **argv)
 	size_t cacertlen;
 	char signer_id[SM2_MAX_ID_LENGTH + 1] = SM2_DEFAULT_ID;
 	size_t signer_id_len = strlen(SM2_DEFAULT_ID);
+	char *certfile = NULL;
+	FILE *certfp = NULL;
+	uint8_t cert[4096];
+	size_t certlen;
+	const uint8_t *serial;
+	size_t serial_len;
+	X509_CRL_INDEX index;
 	int rv;
 
+	memset(&index, 0, sizeof(index));
+
 	argc--;
 	argv++;
 
@@ -97,6 +109,9 @@ int crlverify_main(int argc, char **argv)
 				fprintf(stderr, "%s: invalid `-sm2_id_hex` value\n", prog);
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-cert")) {
+			if (--argc < 1) goto bad;
+			certfile = *(++argv);
 		} else {
 			fprintf(stderr, "%s: illegal option `%s`\n", prog, *argv);
 			goto end;
@@ -128,9 +143,39 @@ bad:
 	}
 
 	printf("Verification %s\n", rv ? "success" : "failure");
-	if (rv == 1) ret = 0;
+	if (rv != 1) {
+		goto end;
+	}
+
+	if (certfile) {
+		// index once, then every certificate is a binary search
+		if (!(certfp = fopen(certfile, "rb"))) {
+			fprintf(stderr, "%s: open '%s' failure : %s\n", prog, certfile, strerror(errno));
+			goto end;
+		}
+		if (x509_crl_index_init(&index, crl, crl_len) != 1) {
+			fprintf(stderr, "%s: parse CRL failure\n", prog);
+			goto end;
+		}
+		while ((rv = x509_cert_from_pem(cert, &certlen, sizeof(cert), certfp)) == 1) {
+			if (x509_cert_get_issuer_and_serial_number(cert, certlen, NULL, NULL, &serial, &serial_len) != 1) {
+				fprintf(stderr, "%s: parse certificate failure\n", prog);
+				goto end;
+			}
+			format_bytes(stdout, 0, 0, "serialNumber", serial, serial_len);
+			printf("    Revocation status: %s\n",
+				x509_cert_check_crl_index(cert, certlen, &index) == 1 ? "Not revoked by CRL" : "Revoked or not covered by CRL");
+		}
+		if (rv < 0) {
+			fprintf(stderr, "%s: read certificate failure\n", prog);
+			goto end;
+		}
+	}
+	ret = 0;
 
 end:
+	x509_crl_index_cleanup(&index);
+	if (certfp) fclose(certfp);
 	if (crl) free(crl);
 	if (cacert) free(cacert);
 	return ret;
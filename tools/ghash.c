@@ -15,6 +15,7 @@
 #include <gmssl/ghash.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "[-in_str str|-in file] [-hex|-bin] [-out file]";
@@ -161,12 +162,23 @@ bad:
 		ghash_update(&ghash_ctx, (uint8_t *)in_str, strlen(in_str));
 
 	} else {
-		uint8_t buf[4096];
+		FILE_READER reader;
+		const uint8_t *buf;
 		size_t len;
-		while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+		int rv;
+
+		if (file_read_init(&reader, infp, 0) != 1) {
+			error_print();
+			goto end;
+		}
+		while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 			ghash_update(&ghash_ctx, buf, len);
 		}
-		memset(buf, 0, sizeof(buf));
+		file_read_cleanup(&reader);
+		if (rv < 0) {
+			error_print();
+			goto end;
+		}
 	}
 	ghash_finish(&ghash_ctx, dgst);
 	memset(&ghash_ctx, 0, sizeof(ghash_ctx));
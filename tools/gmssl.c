@@ -16,6 +16,7 @@
 extern int version_main(int argc, char **argv);
 extern int rand_main(int argc, char **argv);
 extern int certgen_main(int argc, char **argv);
+extern int castore_main(int argc, char **argv);
 extern int certparse_main(int argc, char **argv);
 extern int certverify_main(int argc, char **argv);
 extern int certrevoke_main(int argc, char **argv);
@@ -43,11 +44,14 @@ extern int sm4_ofb_main(int argc, char **argv);
 extern int sm4_ccm_main(int argc, char **argv);
 extern int sm4_gcm_main(int argc, char **argv);
 extern int sm4_xts_main(int argc, char **argv);
+extern int sm4_gcm_stream_main(int argc, char **argv);
 extern int sm4_cbc_sm3_hmac_main(int argc, char **argv);
 extern int sm4_ctr_sm3_hmac_main(int argc, char **argv);
 extern int sm4_cbc_mac_main(int argc, char **argv);
 extern int zuc_main(int argc, char **argv);
 extern int ghash_main(int argc, char **argv);
+extern int speed_main(int argc, char **argv);
+extern int tls_speed_main(int argc, char **argv);
 extern int sm9setup_main(int argc, char **argv);
 extern int sm9keygen_main(int argc, char **argv);
 extern int sm9sign_main(int argc, char **argv);
@@ -65,6 +69,16 @@ extern int tls12_client_main(int argc, char **argv);
 extern int tls12_server_main(int argc, char **argv);
 extern int tls13_client_main(int argc, char **argv);
 extern int tls13_server_main(int argc, char **argv);
+#ifdef ENABLE_TLS_SERVER
+extern int tls_server_main(int argc, char **argv);
+#ifndef _WIN32
+extern int tls_bench_main(int argc, char **argv);
+#endif
+#endif
+#ifdef ENABLE_SERVE
+extern int serve_main(int argc, char **argv);
+extern int serve_client_main(int argc, char **argv);
+#endif
 #ifdef ENABLE_SDF
 extern int sdfutil_main(int argc, char **argv);
 extern int sdftest_main(int argc, char **argv);
@@ -98,11 +112,14 @@ static const char *options =
 	"  sm4_ccm           Encrypt or decrypt with SM4 CCM\n"
 	"  sm4_gcm           Encrypt or decrypt with SM4 GCM\n"
 	"  sm4_xts           Encrypt or decrypt with SM4 XTS\n"
+	"  sm4_gcm_stream    Encrypt or decrypt a segmented SM4-GCM container with all CPUs\n"
 	"  sm4_cbc_sm3_hmac  Encrypt or decrypt with SM4 CBC with SM3-HMAC\n"
 	"  sm4_ctr_sm3_hmac  Encrypt or decrypt with SM4 CTR with SM3-HMAC\n"
 	"  sm4_cbc_mac       Generate SM4 CBC-MAC\n"
 	"  ghash             Generate GHASH\n"
 	"  zuc               Encrypt or decrypt with ZUC\n"
+	"  speed             Benchmark the algorithms\n"
+	"  tls_speed         Benchmark the TLCP, TLS 1.2 and TLS 1.3 handshakes\n"
 	"  sm9setup          Generate SM9 master secret\n"
 	"  sm9keygen         Generate SM9 private key\n"
 	"  sm9sign           Generate SM9 signature\n"
@@ -117,6 +134,7 @@ static const char *options =
 	"  crlverify         Verify a CRL with issuer's certificate\n"
 	"  crlparse          Parse and print CRL\n"
 	"  certgen           Generate a self-signed certificate\n"
+	"  castore           Build a trust store snapshot of CA certificates\n"
 	"  certparse         Parse and print certificates\n"
 	"  certverify        Verify certificate chain\n"
 	"  certrevoke        Revoke certificate and output RevokedCertificate record\n"
@@ -138,6 +156,16 @@ static const char *options =
 	"  tls12_server      TLS 1.2 server\n"
 	"  tls13_client      TLS 1.3 client\n"
 	"  tls13_server      TLS 1.3 server\n"
+#ifdef ENABLE_TLS_SERVER
+	"  tls_server        Multi-threaded TLCP/TLS 1.3 server\n"
+#ifndef _WIN32
+	"  tls_bench         TLCP/TLS 1.3 handshake and record load generator\n"
+#endif
+#endif
+#ifdef ENABLE_SERVE
+	"  serve             Keep keys resident and serve requests over a Unix socket\n"
+	"  serve_client      Send one request to `gmssl serve`\n"
+#endif
 	"\n"
 	"run `gmssl <command> -help` to print help of the given command\n"
 	"\n";
@@ -166,6 +194,8 @@ int main(int argc, char **argv)
 			return rand_main(argc, argv);
 		} else if (!strcmp(*argv, "certgen")) {
 			return certgen_main(argc, argv);
+		} else if (!strcmp(*argv, "castore")) {
+			return castore_main(argc, argv);
 		} else if (!strcmp(*argv, "certparse")) {
 			return certparse_main(argc, argv);
 		} else if (!strcmp(*argv, "certverify")) {
@@ -229,6 +259,10 @@ int main(int argc, char **argv)
 #if ENABLE_SM4_XTS
 		} else if (!strcmp(*argv, "sm4_xts")) {
 			return sm4_xts_main(argc, argv);
+#endif
+#if ENABLE_SM4_GCM_STREAM
+		} else if (!strcmp(*argv, "sm4_gcm_stream")) {
+			return sm4_gcm_stream_main(argc, argv);
 #endif
 		} else if (!strcmp(*argv, "sm4_cbc_sm3_hmac")) {
 			return sm4_cbc_sm3_hmac_main(argc, argv);
@@ -242,6 +276,10 @@ int main(int argc, char **argv)
 #endif
 		} else if (!strcmp(*argv, "zuc")) {
 			return zuc_main(argc, argv);
+		} else if (!strcmp(*argv, "speed")) {
+			return speed_main(argc, argv);
+		} else if (!strcmp(*argv, "tls_speed")) {
+			return tls_speed_main(argc, argv);
 		} else if (!strcmp(*argv, "sm9setup")) {
 			return sm9setup_main(argc, argv);
 		} else if (!strcmp(*argv, "sm9keygen")) {
@@ -276,6 +314,20 @@ int main(int argc, char **argv)
 			return tls13_client_main(argc, argv);
 		} else if (!strcmp(*argv, "tls13_server")) {
 			return tls13_server_main(argc, argv);
+#ifdef ENABLE_TLS_SERVER
+		} else if (!strcmp(*argv, "tls_server")) {
+			return tls_server_main(argc, argv);
+#ifndef _WIN32
+		} else if (!strcmp(*argv, "tls_bench")) {
+			return tls_bench_main(argc, argv);
+#endif
+#endif
+#ifdef ENABLE_SERVE
+		} else if (!strcmp(*argv, "serve")) {
+			return serve_main(argc, argv);
+		} else if (!strcmp(*argv, "serve_client")) {
+			return serve_client_main(argc, argv);
+#endif
 #ifdef ENABLE_SDF
 		} else if (!strcmp(*argv, "sdfutil")) {
 			return sdfutil_main(argc, argv);
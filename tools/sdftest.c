@@ -15,6 +15,7 @@
 #include <gmssl/hex.h>
 #include <gmssl/sm2.h>
 #include <gmssl/rand.h>
+#include <gmssl/sdf.h>
 #include <gmssl/error.h>
 #include "../src/sdf/sdf.h"
 #include "../src/sdf/sdf_ext.h"
@@ -1314,6 +1315,188 @@ static int test_SDF_InternalEncrypt_ECC(int key, char *pass)
 	return 1;
 }
 
+static int test_sdf_pool(int key, char *pass)
+{
+	SDF_DEVICE dev;
+	SDF_POOL *pool = NULL;
+	SM2_KEY public_key;
+	uint8_t sm4_key[16];
+	uint8_t iv[16];
+	uint8_t dgst[32];
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	uint8_t plain[32];
+	uint8_t cipher[32];
+	uint8_t buf[32];
+	int i;
+	int ret = -1;
+
+	rand_bytes(sm4_key, sizeof(sm4_key));
+	rand_bytes(iv, sizeof(iv));
+	rand_bytes(plain, sizeof(plain));
+
+	if (sdf_open_device(&dev) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(pool = sdf_pool_new(&dev, key, pass, sm4_key, 4))
+		|| sdf_pool_get_public_key(pool, &public_key) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// more calls than sessions, every session is used more than once
+	for (i = 0; i < 8; i++) {
+		rand_bytes(dgst, sizeof(dgst));
+		if (sdf_pool_sign(pool, dgst, sig, &siglen) != 1
+			|| sm2_verify(&public_key, dgst, sig, siglen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+
+	// the encryption key pair is at the same index
+	if (sdf_pool_sm4_cbc_encrypt_blocks(pool, iv, plain, 2, cipher) != 1
+		|| sdf_pool_sm4_cbc_decrypt_blocks(pool, iv, cipher, 2, buf) != 1
+		|| memcmp(buf, plain, sizeof(plain)) != 0) {
+		error_print();
+		goto end;
+	}
+
+	if (sdf_pool_check(pool) != 1) {
+		error_print();
+		goto end;
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sdf_pool_free(pool);
+	sdf_close_device(&dev);
+	return ret;
+}
+
+static void sdf_job_done(SDF_JOB *job)
+{
+	*(int *)job->arg = 1;
+}
+
+static int test_sdf_job_queue(int key, char *pass)
+{
+	SDF_DEVICE dev;
+	SDF_POOL *pool = NULL;
+	SDF_JOB_QUEUE *queue = NULL;
+	uint8_t sm4_key[16];
+	uint8_t plain[8][64];
+	uint8_t cipher[8][64];
+	uint8_t buf[8][64];
+	SDF_IOVEC in[8][2];
+	SDF_IOVEC out[8][3];
+	SDF_IOVEC dec_in[8];
+	SDF_IOVEC dec_out[8];
+	SDF_JOB jobs[8];
+	SDF_JOB dec_jobs[8];
+	SDF_JOB *done[8];
+	int called[8] = {0};
+	int ndone = 0;
+	int n;
+	int i;
+	int ret = -1;
+
+	rand_bytes(sm4_key, sizeof(sm4_key));
+	if (sdf_open_device(&dev) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(pool = sdf_pool_new(&dev, key, pass, sm4_key, 4))
+		|| !(queue = sdf_job_queue_new(pool, 4))) {
+		error_print();
+		goto end;
+	}
+
+	// gathered from 2 and scattered to 3 buffers, half of the jobs with callback
+	memset(jobs, 0, sizeof(jobs));
+	for (i = 0; i < 8; i++) {
+		rand_bytes(plain[i], sizeof(plain[i]));
+		in[i][0].base = plain[i];
+		in[i][0].len = 16;
+		in[i][1].base = plain[i] + 16;
+		in[i][1].len = 48;
+		out[i][0].base = cipher[i];
+		out[i][0].len = 20;
+		out[i][1].base = cipher[i] + 20;
+		out[i][1].len = 4;
+		out[i][2].base = cipher[i] + 24;
+		out[i][2].len = 40;
+
+		jobs[i].op = SDF_JOB_sm4_cbc_encrypt;
+		rand_bytes(jobs[i].iv, 16);
+		jobs[i].in = in[i];
+		jobs[i].in_cnt = 2;
+		jobs[i].out = out[i];
+		jobs[i].out_cnt = 3;
+		if (i % 2) {
+			jobs[i].callback = sdf_job_done;
+			jobs[i].arg = &called[i];
+		}
+		if (sdf_job_submit(queue, &jobs[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	while ((n = sdf_job_queue_poll(queue, done, 8, 1)) > 0) {
+		ndone += n;
+	}
+	if (n < 0 || ndone != 4) {
+		error_print();
+		goto end;
+	}
+
+	memset(dec_jobs, 0, sizeof(dec_jobs));
+	for (i = 0; i < 8; i++) {
+		if (jobs[i].status != 1 || called[i] != i % 2) {
+			error_print();
+			goto end;
+		}
+		dec_in[i].base = cipher[i];
+		dec_in[i].len = 64;
+		dec_out[i].base = buf[i];
+		dec_out[i].len = 64;
+		dec_jobs[i].op = SDF_JOB_sm4_cbc_decrypt;
+		memcpy(dec_jobs[i].iv, jobs[i].iv, 16);
+		dec_jobs[i].in = &dec_in[i];
+		dec_jobs[i].in_cnt = 1;
+		dec_jobs[i].out = &dec_out[i];
+		dec_jobs[i].out_cnt = 1;
+		if (sdf_job_submit(queue, &dec_jobs[i]) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ndone = 0;
+	while ((n = sdf_job_queue_poll(queue, done, 8, 1)) > 0) {
+		ndone += n;
+	}
+	if (ndone != 8) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < 8; i++) {
+		if (dec_jobs[i].status != 1 || memcmp(buf[i], plain[i], 64) != 0) {
+			error_print();
+			goto end;
+		}
+	}
+
+	printf("%s() ok\n", __FUNCTION__);
+	ret = 1;
+end:
+	sdf_job_queue_free(queue);
+	sdf_pool_free(pool);
+	sdf_close_device(&dev);
+	return ret;
+}
+
 int sdftest_main(int argc, char **argv)
 {
 	int ret = 1;
@@ -1399,6 +1582,8 @@ bad:
 	if (test_SDF_ExternalEncrypt_ECC() != 1) goto err; //FIXME: test this before any ECCCipher used
 	if (test_SDF_InternalSign_ECC(key, pass) != 1) goto err;
 	if (test_SDF_InternalEncrypt_ECC(key, pass) != 1) goto err;
+	if (test_sdf_pool(key, pass) != 1) goto err;
+	if (test_sdf_job_queue(key, pass) != 1) goto err;
 
 	printf("%s all tests passed\n", __FILE__);
 	return 0;
@@ -0,0 +1,883 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <signal.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include <sys/socket.h>
+#include <sys/un.h>
+#include <gmssl/mem.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm3.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_crl.h>
+#include <gmssl/error.h>
+
+
+/*
+ * Request:  length (4 bytes, big-endian, of the rest) || op (1 byte) || data
+ * Response: length (4 bytes, big-endian, of the rest) || status (1 byte) || data
+ *
+ *	sm3		data = message, response = 32-byte digest
+ *	sm2sign		data = message, response = DER signature
+ *	sm2verify	data = signature length (2 bytes) || DER signature || message
+ *	certverify	data = DER certificate chains, response = one X509_BATCH_* per chain
+ *
+ * A connection sends a request after the response of the last one.
+ */
+#define SERVE_MAX_REQUEST_SIZE	(1024 * 1024)
+#define SERVE_MAX_BATCH		256
+
+enum {
+	SERVE_OP_SM3 = 1,
+	SERVE_OP_SM2SIGN = 2,
+	SERVE_OP_SM2VERIFY = 3,
+	SERVE_OP_CERTVERIFY = 4,
+};
+
+enum {
+	SERVE_OK = 0,
+	SERVE_FAILED = 1, // invalid signature or certificate chain
+	SERVE_ERROR = 2, // malformed request or operation not configured
+};
+
+static const struct {
+	const char *name;
+	int op;
+} serve_ops[] = {
+	{ "sm3", SERVE_OP_SM3 },
+	{ "sm2sign", SERVE_OP_SM2SIGN },
+	{ "sm2verify", SERVE_OP_SM2VERIFY },
+	{ "certverify", SERVE_OP_CERTVERIFY },
+};
+
+static int serve_read(int sock, uint8_t *buf, size_t len)
+{
+	ssize_t n;
+
+	while (len) {
+		if ((n = read(sock, buf, len)) <= 0) {
+			if (n < 0 && errno == EINTR) {
+				continue;
+			}
+			return n == 0 ? 0 : -1;
+		}
+		buf += n;
+		len -= (size_t)n;
+	}
+	return 1;
+}
+
+static int serve_write(int sock, const uint8_t *buf, size_t len)
+{
+	ssize_t n;
+
+	while (len) {
+		if ((n = write(sock, buf, len)) <= 0) {
+			if (n < 0 && errno == EINTR) {
+				continue;
+			}
+			return -1;
+		}
+		buf += n;
+		len -= (size_t)n;
+	}
+	return 1;
+}
+
+// return 0 on a clean end of stream
+static int serve_read_message(int sock, uint8_t *type, uint8_t **data, size_t *datalen)
+{
+	uint8_t hdr[5];
+	size_t len;
+	int rv;
+
+	if ((rv = serve_read(sock, hdr, sizeof(hdr))) != 1) {
+		return rv;
+	}
+	len = ((size_t)hdr[0] << 24) | ((size_t)hdr[1] << 16) | ((size_t)hdr[2] << 8) | hdr[3];
+	if (len < 1 || len - 1 > SERVE_MAX_REQUEST_SIZE) {
+		error_print();
+		return -1;
+	}
+	*type = hdr[4];
+	*datalen = len - 1;
+	if (!(*data = (uint8_t *)malloc(*datalen ? *datalen : 1))) {
+		error_print();
+		return -1;
+	}
+	if (serve_read(sock, *data, *datalen) != 1) {
+		free(*data);
+		*data = NULL;
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int serve_write_message(int sock, uint8_t type, const uint8_t *data, size_t datalen)
+{
+	uint8_t hdr[5];
+	size_t len = datalen + 1;
+
+	hdr[0] = (uint8_t)(len >> 24);
+	hdr[1] = (uint8_t)(len >> 16);
+	hdr[2] = (uint8_t)(len >> 8);
+	hdr[3] = (uint8_t)len;
+	hdr[4] = type;
+	if (serve_write(sock, hdr, sizeof(hdr)) != 1
+		|| serve_write(sock, data, datalen) != 1) {
+		return -1;
+	}
+	return 1;
+}
+
+
+typedef struct SERVE_REQUEST_st {
+	int op;
+	uint8_t *data;
+	size_t datalen;
+	int status;
+	uint8_t *out;
+	size_t outlen;
+	int done;
+	struct SERVE_REQUEST_st *next;
+} SERVE_REQUEST;
+
+typedef struct {
+	int has_key;
+	SM2_SIGN_CTX sign_ctx; // SM3 state after Z
+	int has_verify_key;
+	SM2_KEY verify_key;
+	SM2_VERIFY_CTX verify_ctx;
+	int has_cacerts;
+	X509_BATCH_VERIFIER verifier;
+	int threads;
+
+	pthread_mutex_t mutex;
+	pthread_cond_t queued;
+	pthread_cond_t done;
+	SERVE_REQUEST *head;
+	SERVE_REQUEST *tail;
+	int stop;
+} SERVE_CTX;
+
+static volatile sig_atomic_t serve_stopped = 0;
+
+static void serve_on_signal(int sig)
+{
+	(void)sig;
+	serve_stopped = 1;
+}
+
+static void serve_set_output(SERVE_REQUEST *req, const uint8_t *data, size_t datalen)
+{
+	if (!(req->out = (uint8_t *)malloc(datalen ? datalen : 1))) {
+		req->status = SERVE_ERROR;
+		return;
+	}
+	memcpy(req->out, data, datalen);
+	req->outlen = datalen;
+	req->status = SERVE_OK;
+}
+
+static void serve_sm3_batch(SERVE_REQUEST **reqs, size_t cnt)
+{
+	const uint8_t *datas[SERVE_MAX_BATCH];
+	size_t datalens[SERVE_MAX_BATCH];
+	uint8_t dgsts[SERVE_MAX_BATCH][SM3_DIGEST_SIZE];
+	size_t i;
+
+	for (i = 0; i < cnt; i++) {
+		datas[i] = reqs[i]->data;
+		datalens[i] = reqs[i]->datalen;
+	}
+	sm3_digest_batch(datas, datalens, cnt, dgsts);
+	for (i = 0; i < cnt; i++) {
+		serve_set_output(reqs[i], dgsts[i], SM3_DIGEST_SIZE);
+	}
+}
+
+// the (k, x1) pairs come from the default signing pool
+static void serve_sm2sign_batch(SERVE_CTX *ctx, SERVE_REQUEST **reqs, size_t cnt)
+{
+	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
+	size_t siglen;
+	size_t i;
+
+	for (i = 0; i < cnt; i++) {
+		if (!ctx->has_key
+			|| sm2_sign_reset(&ctx->sign_ctx) != 1
+			|| sm2_sign_update(&ctx->sign_ctx, reqs[i]->data, reqs[i]->datalen) != 1
+			|| sm2_sign_finish(&ctx->sign_ctx, sig, &siglen) != 1) {
+			reqs[i]->status = SERVE_ERROR;
+			continue;
+		}
+		serve_set_output(reqs[i], sig, siglen);
+	}
+}
+
+static void serve_sm2verify_batch(SERVE_CTX *ctx, SERVE_REQUEST **reqs, size_t cnt)
+{
+	const SM2_KEY *keys[SERVE_MAX_BATCH];
+	uint8_t dgsts[SERVE_MAX_BATCH][32];
+	SM2_SIGNATURE sigs[SERVE_MAX_BATCH];
+	int results[SERVE_MAX_BATCH];
+	SERVE_REQUEST *valid[SERVE_MAX_BATCH];
+	size_t n = 0;
+	size_t i;
+
+	for (i = 0; i < cnt; i++) {
+		SERVE_REQUEST *req = reqs[i];
+		const uint8_t *p = req->data + 2;
+		size_t siglen;
+		size_t len;
+
+		req->status = SERVE_ERROR;
+		if (!ctx->has_verify_key || req->datalen < 2) {
+			continue;
+		}
+		siglen = ((size_t)req->data[0] << 8) | req->data[1];
+		if (siglen > req->datalen - 2) {
+			continue;
+		}
+		len = siglen;
+		if (sm2_signature_from_der(&sigs[n], &p, &len) != 1 || len) {
+			req->status = SERVE_FAILED;
+			continue;
+		}
+		sm2_verify_reset(&ctx->verify_ctx);
+		sm3_update(&ctx->verify_ctx.sm3_ctx, p, req->datalen - 2 - siglen);
+		sm3_finish(&ctx->verify_ctx.sm3_ctx, dgsts[n]);
+		keys[n] = &ctx->verify_key;
+		valid[n++] = req;
+	}
+	if (!n) {
+		return;
+	}
+	if (sm2_do_verify_batch(keys, (const uint8_t (*)[32])dgsts, sigs, n, results) < 0) {
+		return;
+	}
+	for (i = 0; i < n; i++) {
+		valid[i]->status = results[i] == 1 ? SERVE_OK : SERVE_FAILED;
+	}
+}
+
+static void serve_certverify(SERVE_CTX *ctx, SERVE_REQUEST *req)
+{
+	X509_BATCH_RESULT *results = NULL;
+	size_t results_cnt;
+	size_t i;
+
+	req->status = SERVE_ERROR;
+	if (!ctx->has_cacerts
+		|| x509_batch_verify(&ctx->verifier, req->data, req->datalen, NULL, &results_cnt, 0, ctx->threads) != 1
+		|| !results_cnt
+		|| !(results = (X509_BATCH_RESULT *)malloc(sizeof(X509_BATCH_RESULT) * results_cnt))
+		|| x509_batch_verify(&ctx->verifier, req->data, req->datalen, results, &results_cnt, results_cnt, ctx->threads) != 1
+		|| !(req->out = (uint8_t *)malloc(results_cnt))) {
+		free(results);
+		return;
+	}
+	req->status = SERVE_OK;
+	for (i = 0; i < results_cnt; i++) {
+		req->out[i] = (uint8_t)results[i].result;
+		if (results[i].result != X509_BATCH_VERIFIED) {
+			req->status = SERVE_FAILED;
+		}
+	}
+	req->outlen = results_cnt;
+	free(results);
+}
+
+static void serve_process(SERVE_CTX *ctx, SERVE_REQUEST *list)
+{
+	SERVE_REQUEST *reqs[SERVE_MAX_BATCH];
+	size_t cnt;
+	int op;
+
+	for (op = SERVE_OP_SM3; op <= SERVE_OP_CERTVERIFY; op++) {
+		SERVE_REQUEST *req;
+
+		cnt = 0;
+		for (req = list; req; req = req->next) {
+			if (req->op == op) {
+				reqs[cnt++] = req;
+			}
+		}
+		if (!cnt) {
+			continue;
+		}
+		switch (op) {
+		case SERVE_OP_SM3:
+			serve_sm3_batch(reqs, cnt);
+			break;
+		case SERVE_OP_SM2SIGN:
+			serve_sm2sign_batch(ctx, reqs, cnt);
+			break;
+		case SERVE_OP_SM2VERIFY:
+			serve_sm2verify_batch(ctx, reqs, cnt);
+			break;
+		case SERVE_OP_CERTVERIFY:
+			while (cnt) {
+				serve_certverify(ctx, reqs[--cnt]);
+			}
+			break;
+		}
+	}
+}
+
+// takes everything queued since the last batch, so busy clients share one batch
+static void *serve_dispatch_thread(void *arg)
+{
+	SERVE_CTX *ctx = (SERVE_CTX *)arg;
+	SERVE_REQUEST *list;
+	SERVE_REQUEST *req;
+	size_t cnt;
+
+	for (;;) {
+		pthread_mutex_lock(&ctx->mutex);
+		while (!ctx->head && !ctx->stop) {
+			pthread_cond_wait(&ctx->queued, &ctx->mutex);
+		}
+		if (!ctx->head) {
+			pthread_mutex_unlock(&ctx->mutex);
+			break;
+		}
+		list = ctx->head;
+		for (req = list, cnt = 1; req->next && cnt < SERVE_MAX_BATCH; req = req->next, cnt++) {
+		}
+		ctx->head = req->next;
+		if (!ctx->head) {
+			ctx->tail = NULL;
+		}
+		req->next = NULL;
+		pthread_mutex_unlock(&ctx->mutex);
+
+		serve_process(ctx, list);
+
+		pthread_mutex_lock(&ctx->mutex);
+		for (req = list; req; req = req->next) {
+			req->done = 1;
+		}
+		pthread_cond_broadcast(&ctx->done);
+		pthread_mutex_unlock(&ctx->mutex);
+	}
+	return NULL;
+}
+
+typedef struct {
+	SERVE_CTX *ctx;
+	int sock;
+} SERVE_CONN;
+
+static void *serve_conn_thread(void *arg)
+{
+	SERVE_CONN *conn = (SERVE_CONN *)arg;
+	SERVE_CTX *ctx = conn->ctx;
+	SERVE_REQUEST req;
+	uint8_t op;
+	int rv;
+
+	for (;;) {
+		memset(&req, 0, sizeof(req));
+		if ((rv = serve_read_message(conn->sock, &op, &req.data, &req.datalen)) != 1) {
+			break;
+		}
+		if (op < SERVE_OP_SM3 || op > SERVE_OP_CERTVERIFY) {
+			req.status = SERVE_ERROR;
+		} else {
+			req.op = op;
+			pthread_mutex_lock(&ctx->mutex);
+			if (ctx->tail) {
+				ctx->tail->next = &req;
+			} else {
+				ctx->head = &req;
+			}
+			ctx->tail = &req;
+			pthread_cond_signal(&ctx->queued);
+			while (!req.done) {
+				pthread_cond_wait(&ctx->done, &ctx->mutex);
+			}
+			pthread_mutex_unlock(&ctx->mutex);
+		}
+		free(req.data);
+		rv = serve_write_message(conn->sock, (uint8_t)req.status, req.out, req.out ? req.outlen : 0);
+		free(req.out);
+		if (rv != 1) {
+			break;
+		}
+	}
+	close(conn->sock);
+	free(conn);
+	return NULL;
+}
+
+static const char *serve_usage =
+	"-socket path [-key pem -pass str] [-pubkey pem] [-id str] [-cacert pem] [-threads num]";
+
+static const char *serve_help =
+"Options\n"
+"\n"
+"    -socket path        Unix domain socket to listen on, only the owner can connect\n"
+"    -key pem            SM2 private key of 'sm2sign', its public key is used by 'sm2verify'\n"
+"    -pass str           Password of the private key, only asked once\n"
+"    -pubkey pem         SM2 public key of 'sm2verify'\n"
+"    -id str             Signer's ID, '1234567812345678' by default\n"
+"    -cacert pem         CA certificates of 'certverify'\n"
+"    -threads num        Verification threads of 'certverify', default one per CPU\n"
+"\n"
+"  The keys, the Z of the ID, the SM2 signing pool and the indexed CA certificates\n"
+"  are kept in memory. Concurrent requests of the clients are run as one batch\n"
+"  of SM3 hashes or SM2 verifications. Stop with SIGINT or SIGTERM.\n"
+"\n"
+"Examples\n"
+"\n"
+"  gmssl serve -socket /tmp/gmssl.sock -key sm2.pem -pass P@ssw0rd -cacert cacert.pem &\n"
+"  echo -n 'message' | gmssl serve_client -socket /tmp/gmssl.sock -op sm2sign -out sm2.sig\n"
+"  echo -n 'message' | gmssl serve_client -socket /tmp/gmssl.sock -op sm2verify -sig sm2.sig\n"
+"  gmssl serve_client -socket /tmp/gmssl.sock -op certverify -in certs.pem\n"
+"\n";
+
+int serve_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *sockpath = NULL;
+	char *keyfile = NULL;
+	char *pass = NULL;
+	char *pubkeyfile = NULL;
+	char *id = SM2_DEFAULT_ID;
+	char *cacertfile = NULL;
+	FILE *fp = NULL;
+	SM2_KEY key;
+	uint8_t *cacerts = NULL;
+	size_t cacertslen;
+	SERVE_CTX ctx;
+	struct sockaddr_un addr;
+	struct sigaction sa;
+	pthread_t dispatcher;
+	int dispatcher_started = 0;
+	int listen_sock = -1;
+	int sock;
+	mode_t old_mask;
+#ifdef ENABLE_SM2_SIGN_POOL
+	SM2_SIGN_POOL *sign_pool = NULL;
+#endif
+
+	memset(&ctx, 0, sizeof(ctx));
+	memset(&key, 0, sizeof(key));
+	pthread_mutex_init(&ctx.mutex, NULL);
+	pthread_cond_init(&ctx.queued, NULL);
+	pthread_cond_init(&ctx.done, NULL);
+
+	argc--;
+	argv++;
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, serve_usage);
+		goto end;
+	}
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, serve_usage);
+			printf("%s\n", serve_help);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-socket")) {
+			if (--argc < 1) goto bad;
+			sockpath = *(++argv);
+		} else if (!strcmp(*argv, "-key")) {
+			if (--argc < 1) goto bad;
+			keyfile = *(++argv);
+		} else if (!strcmp(*argv, "-pass")) {
+			if (--argc < 1) goto bad;
+			pass = *(++argv);
+		} else if (!strcmp(*argv, "-pubkey")) {
+			if (--argc < 1) goto bad;
+			pubkeyfile = *(++argv);
+		} else if (!strcmp(*argv, "-id")) {
+			if (--argc < 1) goto bad;
+			id = *(++argv);
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			cacertfile = *(++argv);
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			ctx.threads = atoi(*(++argv));
+		} else {
+			fprintf(stderr, "gmssl %s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "gmssl %s: '%s' option value missing\n", prog, *argv);
+			goto end;
+		}
+		argc--;
+		argv++;
+	}
+	if (!sockpath) {
+		fprintf(stderr, "gmssl %s: '-socket' option required\n", prog);
+		goto end;
+	}
+	if (strlen(sockpath) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "gmssl %s: socket path too long\n", prog);
+		goto end;
+	}
+	if (keyfile && !pass) {
+		fprintf(stderr, "gmssl %s: '-pass' option required\n", prog);
+		goto end;
+	}
+	if (!keyfile && !pubkeyfile && !cacertfile) {
+		fprintf(stderr, "gmssl %s: '-key', '-pubkey' or '-cacert' option required\n", prog);
+		goto end;
+	}
+
+	if (keyfile) {
+		if (!(fp = fopen(keyfile, "rb"))) {
+			fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, keyfile, strerror(errno));
+			goto end;
+		}
+		if (sm2_private_key_info_decrypt_from_pem(&key, pass, fp) != 1) {
+			fprintf(stderr, "gmssl %s: private key decryption failure\n", prog);
+			goto end;
+		}
+		fclose(fp);
+		fp = NULL;
+		if (sm2_sign_init(&ctx.sign_ctx, &key, id, strlen(id)) != 1) {
+			fprintf(stderr, "gmssl %s: inner error\n", prog);
+			goto end;
+		}
+		ctx.has_key = 1;
+		if (sm2_key_set_public_key(&ctx.verify_key, &key.public_key) != 1) {
+			fprintf(stderr, "gmssl %s: inner error\n", prog);
+			goto end;
+		}
+		ctx.has_verify_key = 1;
+	}
+	if (pubkeyfile) {
+		if (!(fp = fopen(pubkeyfile, "rb"))) {
+			fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, pubkeyfile, strerror(errno));
+			goto end;
+		}
+		if (sm2_public_key_info_from_pem(&ctx.verify_key, fp) != 1) {
+			fprintf(stderr, "gmssl %s: parse public key failure\n", prog);
+			goto end;
+		}
+		fclose(fp);
+		fp = NULL;
+		ctx.has_verify_key = 1;
+	}
+	if (ctx.has_verify_key) {
+		if (sm2_verify_init(&ctx.verify_ctx, &ctx.verify_key, id, strlen(id)) != 1) {
+			fprintf(stderr, "gmssl %s: inner error\n", prog);
+			goto end;
+		}
+	}
+	if (cacertfile) {
+		if (x509_certs_new_from_file(&cacerts, &cacertslen, cacertfile) != 1
+			|| x509_batch_verifier_init(&ctx.verifier, cacerts, cacertslen, NULL, 0, id, strlen(id)) != 1) {
+			fprintf(stderr, "gmssl %s: load CA certificates failure\n", prog);
+			goto end;
+		}
+		ctx.has_cacerts = 1;
+	}
+#ifdef ENABLE_SM2_SIGN_POOL
+	if (ctx.has_key) {
+		if (!(sign_pool = sm2_sign_pool_new(SERVE_MAX_BATCH * 4, 1))) {
+			fprintf(stderr, "gmssl %s: inner error\n", prog);
+			goto end;
+		}
+		sm2_sign_pool_set_default(sign_pool);
+	}
+#endif
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, sockpath);
+	unlink(sockpath);
+	if ((listen_sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0) {
+		fprintf(stderr, "gmssl %s: create socket failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
+	old_mask = umask(0077);
+	if (bind(listen_sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		umask(old_mask);
+		fprintf(stderr, "gmssl %s: bind '%s' failure : %s\n", prog, sockpath, strerror(errno));
+		goto end;
+	}
+	umask(old_mask);
+	if (listen(listen_sock, 128) != 0) {
+		fprintf(stderr, "gmssl %s: listen failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
+
+	// accept() returns EINTR on SIGINT and SIGTERM
+	memset(&sa, 0, sizeof(sa));
+	sa.sa_handler = serve_on_signal;
+	sigemptyset(&sa.sa_mask);
+	sigaction(SIGINT, &sa, NULL);
+	sigaction(SIGTERM, &sa, NULL);
+	signal(SIGPIPE, SIG_IGN);
+
+	if (pthread_create(&dispatcher, NULL, serve_dispatch_thread, &ctx) != 0) {
+		fprintf(stderr, "gmssl %s: inner error\n", prog);
+		goto end;
+	}
+	dispatcher_started = 1;
+	fprintf(stderr, "gmssl %s: listening on %s\n", prog, sockpath);
+
+	while (!serve_stopped) {
+		SERVE_CONN *conn;
+		pthread_t tid;
+
+		if ((sock = accept(listen_sock, NULL, NULL)) < 0) {
+			if (errno == EINTR || errno == ECONNABORTED) {
+				continue;
+			}
+			fprintf(stderr, "gmssl %s: accept failure : %s\n", prog, strerror(errno));
+			break;
+		}
+		if (!(conn = (SERVE_CONN *)malloc(sizeof(*conn)))) {
+			close(sock);
+			continue;
+		}
+		conn->ctx = &ctx;
+		conn->sock = sock;
+		if (pthread_create(&tid, NULL, serve_conn_thread, conn) != 0) {
+			close(sock);
+			free(conn);
+			continue;
+		}
+		pthread_detach(tid);
+	}
+	ret = 0;
+
+end:
+	if (listen_sock >= 0) {
+		close(listen_sock);
+		unlink(sockpath);
+	}
+	// connections still open are cut off by the exit
+	if (dispatcher_started) {
+		pthread_mutex_lock(&ctx.mutex);
+		ctx.stop = 1;
+		pthread_cond_signal(&ctx.queued);
+		pthread_mutex_unlock(&ctx.mutex);
+		pthread_join(dispatcher, NULL);
+	}
+#ifdef ENABLE_SM2_SIGN_POOL
+	if (sign_pool) {
+		sm2_sign_pool_set_default(NULL);
+		sm2_sign_pool_free(sign_pool);
+	}
+#endif
+	if (ctx.has_cacerts) x509_batch_verifier_cleanup(&ctx.verifier);
+	if (cacerts) free(cacerts);
+	gmssl_secure_clear(&ctx.sign_ctx, sizeof(ctx.sign_ctx));
+	gmssl_secure_clear(&key, sizeof(key));
+	if (fp) fclose(fp);
+	return ret;
+}
+
+
+static const char *serve_client_usage =
+	"-socket path -op sm3|sm2sign|sm2verify|certverify [-sig file] [-in file] [-out file]";
+
+static const char *serve_client_help =
+"Options\n"
+"\n"
+"    -socket path        Unix domain socket of `gmssl serve`\n"
+"    -op name            sm3, sm2sign, sm2verify or certverify\n"
+"    -sig file           DER signature of 'sm2verify'\n"
+"    -in file | stdin    Message, or PEM certificate chains of 'certverify'\n"
+"    -out file | stdout  Digest or signature in binary, results of 'certverify' in text\n"
+"\n"
+"  The exit status is 0 on success, and 1 on a verification failure or error.\n"
+"\n";
+
+int serve_client_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *sockpath = NULL;
+	char *opname = NULL;
+	char *sigfile = NULL;
+	char *infile = NULL;
+	char *outfile = NULL;
+	FILE *sigfp = NULL;
+	FILE *infp = stdin;
+	FILE *outfp = stdout;
+	int op = 0;
+	uint8_t *buf = NULL;
+	size_t buflen = 0;
+	size_t len;
+	uint8_t *resp = NULL;
+	size_t resplen;
+	uint8_t status;
+	struct sockaddr_un addr;
+	int sock = -1;
+	size_t i;
+
+	argc--;
+	argv++;
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, serve_client_usage);
+		return 1;
+	}
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, serve_client_usage);
+			printf("%s\n", serve_client_help);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-socket")) {
+			if (--argc < 1) goto bad;
+			sockpath = *(++argv);
+		} else if (!strcmp(*argv, "-op")) {
+			if (--argc < 1) goto bad;
+			opname = *(++argv);
+		} else if (!strcmp(*argv, "-sig")) {
+			if (--argc < 1) goto bad;
+			sigfile = *(++argv);
+			if (!(sigfp = fopen(sigfile, "rb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, sigfile, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-in")) {
+			if (--argc < 1) goto bad;
+			infile = *(++argv);
+			if (!(infp = fopen(infile, "rb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, infile, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "gmssl %s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "gmssl %s: '%s' option value missing\n", prog, *argv);
+			goto end;
+		}
+		argc--;
+		argv++;
+	}
+	if (!sockpath || !opname) {
+		fprintf(stderr, "gmssl %s: '-socket' and '-op' options required\n", prog);
+		goto end;
+	}
+	if (strlen(sockpath) >= sizeof(addr.sun_path)) {
+		fprintf(stderr, "gmssl %s: socket path too long\n", prog);
+		goto end;
+	}
+	for (i = 0; i < sizeof(serve_ops)/sizeof(serve_ops[0]); i++) {
+		if (!strcmp(opname, serve_ops[i].name)) {
+			op = serve_ops[i].op;
+		}
+	}
+	if (!op) {
+		fprintf(stderr, "gmssl %s: invalid op '%s'\n", prog, opname);
+		goto end;
+	}
+	if (op == SERVE_OP_SM2VERIFY && !sigfile) {
+		fprintf(stderr, "gmssl %s: '-sig' option required by sm2verify\n", prog);
+		goto end;
+	}
+
+	if (!(buf = (uint8_t *)malloc(SERVE_MAX_REQUEST_SIZE))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+	if (op == SERVE_OP_SM2VERIFY) {
+		len = fread(buf + 2, 1, SM2_MAX_SIGNATURE_SIZE + 1, sigfp);
+		if (!len || len > SM2_MAX_SIGNATURE_SIZE) {
+			fprintf(stderr, "gmssl %s: invalid signature file\n", prog);
+			goto end;
+		}
+		buf[0] = (uint8_t)(len >> 8);
+		buf[1] = (uint8_t)len;
+		buflen = 2 + len;
+	}
+	if (op == SERVE_OP_CERTVERIFY) {
+		if (x509_certs_from_pem(buf, &buflen, SERVE_MAX_REQUEST_SIZE, infp) != 1) {
+			fprintf(stderr, "gmssl %s: read certificates failure\n", prog);
+			goto end;
+		}
+	} else {
+		while ((len = fread(buf + buflen, 1, SERVE_MAX_REQUEST_SIZE - buflen, infp)) > 0) {
+			buflen += len;
+			if (buflen == SERVE_MAX_REQUEST_SIZE) {
+				// at most SERVE_MAX_REQUEST_SIZE bytes in one request
+				if (fgetc(infp) != EOF) {
+					fprintf(stderr, "gmssl %s: input too long\n", prog);
+					goto end;
+				}
+				break;
+			}
+		}
+		if (ferror(infp)) {
+			fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+	}
+
+	memset(&addr, 0, sizeof(addr));
+	addr.sun_family = AF_UNIX;
+	strcpy(addr.sun_path, sockpath);
+	if ((sock = socket(AF_UNIX, SOCK_STREAM, 0)) < 0
+		|| connect(sock, (struct sockaddr *)&addr, sizeof(addr)) != 0) {
+		fprintf(stderr, "gmssl %s: connect '%s' failure : %s\n", prog, sockpath, strerror(errno));
+		goto end;
+	}
+	if (serve_write_message(sock, (uint8_t)op, buf, buflen) != 1
+		|| serve_read_message(sock, &status, &resp, &resplen) != 1) {
+		fprintf(stderr, "gmssl %s: request failure\n", prog);
+		goto end;
+	}
+
+	switch (status) {
+	case SERVE_OK:
+	case SERVE_FAILED:
+		break;
+	default:
+		fprintf(stderr, "gmssl %s: server error\n", prog);
+		goto end;
+	}
+	if (op == SERVE_OP_CERTVERIFY) {
+		for (i = 0; i < resplen; i++) {
+			fprintf(outfp, "%zu,%s\n", i, x509_batch_result_name(resp[i]));
+		}
+	} else if (op == SERVE_OP_SM2VERIFY) {
+		fprintf(outfp, "verify : %s\n", status == SERVE_OK ? "success" : "failure");
+	} else if (fwrite(resp, 1, resplen, outfp) != resplen) {
+		fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
+	if (status == SERVE_OK) {
+		ret = 0;
+	}
+end:
+	if (sock >= 0) close(sock);
+	if (buf) free(buf);
+	if (resp) free(resp);
+	if (sigfp) fclose(sigfp);
+	if (infile && infp) fclose(infp);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
@@ -16,7 +16,7 @@
 #include <gmssl/sm2.h>
 
 
-static const char *usage = "-pass str [-out pem] [-pubout pem]\n";
+static const char *usage = "-pass str [-out pem] [-pubout pem] [-count num]\n";
 
 static const char *options =
 "Options\n"
@@ -24,11 +24,13 @@ static const char *options =
 "    -pass pass                  Password to encrypt the private key\n"
 "    -out pem                    Output password-encrypted PKCS #8 private key in PEM format\n"
 "    -pubout pem                 Output public key in PEM format\n"
+"    -count num                  Generate num key pairs, the PEM blocks are written one after another\n"
 "\n"
 "Examples\n"
 "\n"
 "    $ gmssl sm2keygen -pass P@ssw0rd -out sm2.pem\n"
 "    $ gmssl sm2keygen -pass P@ssw0rd -out sm2.pem -pubout sm2pub.pem\n"
+"    $ gmssl sm2keygen -pass P@ssw0rd -out keys.pem -pubout pubs.pem -count 1000\n"
 "\n";
 
 int sm2keygen_main(int argc, char **argv)
@@ -40,7 +42,9 @@ int sm2keygen_main(int argc, char **argv)
 	char *puboutfile = NULL;
 	FILE *outfp = stdout;
 	FILE *puboutfp = stdout;
-	SM2_KEY key;
+	int count = 1;
+	SM2_KEY *keys = NULL;
+	int i;
 
 	argc--;
 	argv++;
@@ -66,6 +70,13 @@ int sm2keygen_main(int argc, char **argv)
 				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-count")) {
+			if (--argc < 1) goto bad;
+			count = atoi(*(++argv));
+			if (count < 1) {
+				fprintf(stderr, "gmssl %s: invalid `-count` value\n", prog);
+				goto end;
+			}
 		} else if (!strcmp(*argv, "-pubout")) {
 			if (--argc < 1) goto bad;
 			puboutfile = *(++argv);
@@ -90,16 +101,28 @@ bad:
 		goto end;
 	}
 
-	if (sm2_key_generate(&key) != 1
-		|| sm2_private_key_info_encrypt_to_pem(&key, pass, outfp) != 1
-		|| sm2_public_key_info_to_pem(&key, puboutfp) != 1) {
+	if (!(keys = (SM2_KEY *)malloc(sizeof(SM2_KEY) * count))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+	if (sm2_key_generate_batch(keys, count, 0) != 1) {
 		fprintf(stderr, "gmssl %s: inner failure\n", prog);
 		goto end;
 	}
+	for (i = 0; i < count; i++) {
+		if (sm2_private_key_info_encrypt_to_pem(&keys[i], pass, outfp) != 1
+			|| sm2_public_key_info_to_pem(&keys[i], puboutfp) != 1) {
+			fprintf(stderr, "gmssl %s: inner failure\n", prog);
+			goto end;
+		}
+	}
 	ret = 0;
 
 end:
-	gmssl_secure_clear(&key, sizeof(key));
+	if (keys) {
+		gmssl_secure_clear(keys, sizeof(SM2_KEY) * count);
+		free(keys);
+	}
 	if (outfile && outfp) fclose(outfp);
 	if (puboutfile && puboutfp) fclose(puboutfp);
 	return ret;
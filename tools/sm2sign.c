@@ -49,9 +49,6 @@ int sm2sign_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	SM2_KEY key;
-	SM2_SIGN_CTX sign_ctx;
-	uint8_t buf[4096];
-	size_t len;
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen;
 
@@ -121,18 +118,13 @@ bad:
 		goto end;
 	}
 
-	if (sm2_sign_init(&sign_ctx, &key, id, strlen(id)) != 1) {
-		fprintf(stderr, "gmssl %s: inner error\n", prog);
-		goto end;
-	}
-	while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
-		if (sm2_sign_update(&sign_ctx, buf, len) != 1) {
+	// reading, hashing and the signing pre-computation overlap
+	if (sm2_sign_file(&key, id, strlen(id), infp, sig, &siglen) != 1) {
+		if (ferror(infp)) {
+			fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		} else {
 			fprintf(stderr, "gmssl %s: inner error\n", prog);
-			goto end;
 		}
-	}
-	if (sm2_sign_finish(&sign_ctx, sig, &siglen) != 1) {
-		fprintf(stderr, "gmssl %s: inner error\n", prog);
 		goto end;
 	}
 	if (fwrite(sig, 1, siglen, outfp) != siglen) {
@@ -142,7 +134,6 @@ bad:
 	ret = 0;
 end:
 	gmssl_secure_clear(&key, sizeof(key));
-	gmssl_secure_clear(&sign_ctx, sizeof(sign_ctx));
 	if (keyfp) fclose(keyfp);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <gmssl/sm2.h>
 #include <gmssl/x509.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "(-pubkey pem | -cert pem) [-id str] [-in file] -sig file";
@@ -53,8 +54,10 @@ int sm2verify_main(int argc, char **argv)
 	SM2_VERIFY_CTX verify_ctx;
 	uint8_t cert[1024];
 	size_t certlen;
-	uint8_t buf[4096];
+	FILE_READER reader;
+	const uint8_t *buf;
 	size_t len;
+	int rv;
 	uint8_t sig[SM2_MAX_SIGNATURE_SIZE];
 	size_t siglen;
 	int vr;
@@ -155,12 +158,22 @@ bad:
 		fprintf(stderr, "gmssl %s: inner error\n", prog);
 		goto end;
 	}
-	while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+	if (file_read_init(&reader, infp, 0) != 1) {
+		fprintf(stderr, "gmssl %s: inner error\n", prog);
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 		if (sm2_verify_update(&verify_ctx, buf, len) != 1) {
 			fprintf(stderr, "gmssl %s: inner error\n", prog);
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 	if ((vr = sm2_verify_finish(&verify_ctx, sig, siglen)) < 0) {
 		fprintf(stderr, "gmssl %s: inner error\n", prog);
 		goto end;
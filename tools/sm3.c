@@ -15,9 +15,12 @@
 #include <gmssl/sm2.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
+#include <gmssl/file.h>
+#include <gmssl/sm3_tree.h>
 
 
-static const char *usage = "[-hex|-bin] [-pubkey pem [-id str]] [-in file|-in_str str] [-out file]";
+static const char *usage = "[-hex|-bin] [-pubkey pem [-id str]] [-in file|-in_str str] [-out file]\n"
+	"       [-tree [-leaf_size num] [-threads num] [-leaves file] [-check index -root hex]]";
 
 static const char *help =
 "Options\n"
@@ -37,6 +40,12 @@ static const char *help =
 "                           `-in_str` and `-in` should not be used together\n"
 "                           If neither `-in` nor `-in_str` specified, read from stdin\n"
 "    -out file | stdout     Output file path. If not specified, output to stdout\n"
+"    -tree                  Output the SM3 tree hash root, the leaves are hashed on all CPUs\n"
+"    -leaf_size num         Tree leaf size in bytes, default 1048576\n"
+"    -threads num           Tree hashing threads, default one per online CPU\n"
+"    -leaves file           Write the leaf hashes to file, or read them with `-check`\n"
+"    -check index           Check that the input is leaf `index` of the tree in `-leaves`\n"
+"    -root hex              Root the `-leaves` file of `-check` should match\n"
 "\n"
 "Examples\n"
 "\n"
@@ -48,6 +57,10 @@ static const char *help =
 "\n"
 "    gmssl sm3 -pubkey sm2pubkey.pem -id alice -in /path/to/file -bin\n"
 "\n"
+"    gmssl sm3 -tree -in image.iso -leaves image.leaves\n"
+"\n"
+"    gmssl sm3 -tree -check 42 -leaves image.leaves -root $ROOT -in leaf42.bin\n"
+"\n"
 "  When reading from stdin, make sure the trailing newline character is removed\n"
 "\n"
 "  Linux/Mac:\n"
@@ -57,6 +70,146 @@ static const char *help =
 "    C:\\> echo |set/p=\"abc\" | gmssl sm3\n"
 "\n";
 
+// tree leaves read and hashed per round
+#define TREE_BATCH_SIZE	(64 * 1024 * 1024)
+
+static int read_full(FILE *fp, uint8_t *buf, size_t len, size_t *rlen)
+{
+	size_t n;
+
+	*rlen = 0;
+	while (*rlen < len) {
+		if (!(n = fread(buf + *rlen, 1, len - *rlen, fp))) {
+			return ferror(fp) ? -1 : 0;
+		}
+		*rlen += n;
+	}
+	return 1;
+}
+
+// whole leaves are read into one buffer, hashed together and optionally written to `leavesfp`
+static int sm3_tree_hash_file(FILE *infp, size_t leaf_size, int threads, FILE *leavesfp, uint8_t root[32])
+{
+	int ret = -1;
+	SM3_TREE_CTX ctx;
+	size_t batch_leaves = TREE_BATCH_SIZE / leaf_size ? TREE_BATCH_SIZE / leaf_size : 1;
+	uint8_t *buf = NULL;
+	uint8_t (*hashes)[SM3_DIGEST_SIZE] = NULL;
+	size_t len, n;
+	uint64_t count = 0;
+	int rv;
+
+	if (sm3_tree_init(&ctx, leaf_size, threads) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!(buf = malloc(leaf_size * batch_leaves))
+		|| !(hashes = malloc(SM3_DIGEST_SIZE * batch_leaves))) {
+		error_print();
+		goto end;
+	}
+	do {
+		if ((rv = read_full(infp, buf, leaf_size * batch_leaves, &len)) < 0) {
+			error_print();
+			goto end;
+		}
+		if (!len) {
+			// an empty input is one empty leaf
+			if (count) {
+				break;
+			}
+			sm3_tree_leaf_hash(buf, 0, hashes[0]);
+			n = 1;
+		} else {
+			if (sm3_tree_hash_leaves(buf, len, leaf_size, hashes, threads) != 1) {
+				error_print();
+				goto end;
+			}
+			n = (len + leaf_size - 1) / leaf_size;
+		}
+		if (leavesfp && fwrite(hashes, SM3_DIGEST_SIZE, n, leavesfp) != n) {
+			error_print();
+			goto end;
+		}
+		if (sm3_tree_append_leaves(&ctx, (const uint8_t (*)[SM3_DIGEST_SIZE])hashes, n) != 1) {
+			error_print();
+			goto end;
+		}
+		count += n;
+	} while (rv == 1);
+
+	if (sm3_tree_finish(&ctx, root) != 1) {
+		error_print();
+		goto end;
+	}
+	ret = 1;
+end:
+	free(buf);
+	free(hashes);
+	return ret;
+}
+
+// the input is leaf `index`, the leaf hashes in `leavesfp` have the tree root `root`
+static int sm3_tree_check_leaf(FILE *infp, size_t leaf_size, FILE *leavesfp, uint64_t index,
+	const uint8_t root[32])
+{
+	int ret = -1;
+	uint8_t (*hashes)[SM3_DIGEST_SIZE] = NULL;
+	uint8_t *buf = NULL;
+	uint8_t hash[SM3_DIGEST_SIZE];
+	size_t count = 0;
+	size_t len;
+
+	if (fseek(leavesfp, 0, SEEK_END) != 0 || ftell(leavesfp) <= 0
+		|| ftell(leavesfp) % SM3_DIGEST_SIZE != 0) {
+		fprintf(stderr, "sm3: invalid `-leaves` file\n");
+		return -1;
+	}
+	count = (size_t)ftell(leavesfp) / SM3_DIGEST_SIZE;
+	rewind(leavesfp);
+	if (!(hashes = malloc(SM3_DIGEST_SIZE * count))
+		|| !(buf = malloc(leaf_size + 1))) {
+		error_print();
+		goto end;
+	}
+	if (fread(hashes, SM3_DIGEST_SIZE, count, leavesfp) != count) {
+		fprintf(stderr, "sm3: read `-leaves` failure\n");
+		goto end;
+	}
+	if (sm3_tree_root((const uint8_t (*)[SM3_DIGEST_SIZE])hashes, count, leaf_size, hash) != 1
+		|| memcmp(hash, root, SM3_DIGEST_SIZE) != 0) {
+		fprintf(stderr, "sm3: the leaf hashes do not match the root\n");
+		ret = 0;
+		goto end;
+	}
+	if (index >= count) {
+		fprintf(stderr, "sm3: `-check` index out of range, the tree has %zu leaves\n", count);
+		goto end;
+	}
+
+	if (read_full(infp, buf, leaf_size + 1, &len) < 0) {
+		fprintf(stderr, "sm3: read input failure\n");
+		goto end;
+	}
+	// only the last leaf can be short, and only the leaf of an empty input empty
+	if (len > leaf_size || (index + 1 < count && len != leaf_size) || (!len && count > 1)) {
+		fprintf(stderr, "sm3: the input is not a leaf of %zu bytes\n", leaf_size);
+		ret = 0;
+		goto end;
+	}
+	sm3_tree_leaf_hash(buf, len, hash);
+	if (memcmp(hash, hashes[index], SM3_DIGEST_SIZE) != 0) {
+		fprintf(stderr, "sm3: leaf %llu does not match\n", (unsigned long long)index);
+		ret = 0;
+		goto end;
+	}
+	ret = 1;
+end:
+	free(hashes);
+	free(buf);
+	return ret;
+}
+
 
 int sm3_main(int argc, char **argv)
 {
@@ -76,6 +229,15 @@ int sm3_main(int argc, char **argv)
 	size_t id_bin_len;
 	SM3_DIGEST_CTX sm3_ctx;
 	uint8_t dgst[32];
+	int tree = 0;
+	long leaf_size = SM3_TREE_DEFAULT_LEAF_SIZE;
+	int threads = 0;
+	char *leavesfile = NULL;
+	FILE *leavesfp = NULL;
+	long long check_index = -1;
+	char *roothex = NULL;
+	uint8_t root[32];
+	size_t rootlen;
 	int i;
 
 	argc--;
@@ -153,6 +315,41 @@ int sm3_main(int argc, char **argv)
 				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
 				goto end;
 			}
+		} else if (!strcmp(*argv, "-tree")) {
+			tree = 1;
+		} else if (!strcmp(*argv, "-leaf_size")) {
+			if (--argc < 1) goto bad;
+			leaf_size = atol(*(++argv));
+			if (leaf_size < SM3_TREE_MIN_LEAF_SIZE || leaf_size > SM3_TREE_MAX_LEAF_SIZE) {
+				fprintf(stderr, "%s: `-leaf_size` should be in [%d, %d]\n", prog,
+					SM3_TREE_MIN_LEAF_SIZE, SM3_TREE_MAX_LEAF_SIZE);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
+			if (threads < 1 || threads > SM3_TREE_MAX_THREADS) {
+				fprintf(stderr, "%s: `-threads` should be in [1, %d]\n", prog, SM3_TREE_MAX_THREADS);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-leaves")) {
+			if (--argc < 1) goto bad;
+			leavesfile = *(++argv);
+		} else if (!strcmp(*argv, "-check")) {
+			if (--argc < 1) goto bad;
+			check_index = atoll(*(++argv));
+			if (check_index < 0) {
+				fprintf(stderr, "%s: `-check` invalid integer argument\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-root")) {
+			if (--argc < 1) goto bad;
+			roothex = *(++argv);
+			if (strlen(roothex) != sizeof(root) * 2
+				|| hex_to_bytes(roothex, strlen(roothex), root, &rootlen) != 1) {
+				fprintf(stderr, "%s: invalid `-root` value\n", prog);
+				goto end;
+			}
 		} else {
 			fprintf(stderr, "%s: illegal option '%s'\n", prog, *argv);
 			goto end;
@@ -170,6 +367,58 @@ bad:
 		goto end;
 	}
 
+	if (tree) {
+		if (pubkeyfile) {
+			fprintf(stderr, "%s: `-tree` and `-pubkey` should not be used together\n", prog);
+			goto end;
+		}
+		if (check_index >= 0) {
+			if (!leavesfile || !roothex) {
+				fprintf(stderr, "%s: `-check` needs `-leaves` and `-root`\n", prog);
+				goto end;
+			}
+			if (!(leavesfp = fopen(leavesfile, "rb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, leavesfile, strerror(errno));
+				goto end;
+			}
+			if (in_str) {
+				fprintf(stderr, "%s: `-check` reads the leaf from `-in`\n", prog);
+				goto end;
+			}
+			if (sm3_tree_check_leaf(infp, (size_t)leaf_size, leavesfp, (uint64_t)check_index, root) != 1) {
+				goto end;
+			}
+			fprintf(outfp, "leaf %lld ok\n", check_index);
+			ret = 0;
+			goto end;
+		}
+		if (leavesfile && in_str) {
+			fprintf(stderr, "%s: `-leaves` is only written for `-in` input\n", prog);
+			goto end;
+		}
+		if (leavesfile && !(leavesfp = fopen(leavesfile, "wb"))) {
+			fprintf(stderr, "%s: open '%s' failure : %s\n", prog, leavesfile, strerror(errno));
+			goto end;
+		}
+		if (in_str) {
+			SM3_TREE_CTX tree_ctx;
+
+			if (sm3_tree_init(&tree_ctx, (size_t)leaf_size, threads) != 1
+				|| sm3_tree_update(&tree_ctx, (uint8_t *)in_str, strlen(in_str)) != 1
+				|| sm3_tree_finish(&tree_ctx, dgst) != 1) {
+				fprintf(stderr, "%s: inner error\n", prog);
+				goto end;
+			}
+		} else if (sm3_tree_hash_file(infp, (size_t)leaf_size, threads, leavesfp, dgst) != 1) {
+			fprintf(stderr, "%s: tree hash failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+		goto output;
+	} else if (leavesfile || check_index >= 0 || roothex) {
+		fprintf(stderr, "%s: `-leaves`, `-check` and `-root` should be used with `-tree`\n", prog);
+		goto end;
+	}
+
 	if (sm3_digest_init(&sm3_ctx, NULL, 0) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
@@ -206,15 +455,27 @@ bad:
 		}
 
 	} else {
-		uint8_t buf[4096];
+		FILE_READER reader;
+		const uint8_t *buf;
 		size_t len;
-		while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+		int rv;
+
+		if (file_read_init(&reader, infp, 0) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+		while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 			if (sm3_digest_update(&sm3_ctx, buf, len) != 1) {
 				fprintf(stderr, "%s: inner error\n", prog);
+				file_read_cleanup(&reader);
 				goto end;
 			}
 		}
-		memset(buf, 0, sizeof(buf));
+		file_read_cleanup(&reader);
+		if (rv < 0) {
+			fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
 	}
 	if (sm3_digest_finish(&sm3_ctx, dgst) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
@@ -222,6 +483,7 @@ bad:
 	}
 	memset(&sm3_ctx, 0, sizeof(sm3_ctx));
 
+output:
 	if (outformat > 1) {
 		if (fwrite(dgst, 1, sizeof(dgst), outfp) != sizeof(dgst)) {
 			fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
@@ -236,6 +498,7 @@ bad:
 	ret = 0;
 end:
 	if (pubkeyfp) fclose(pubkeyfp);
+	if (leavesfp) fclose(leavesfp);
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;
@@ -15,6 +15,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/hex.h>
 #include <gmssl/sm3.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "-key hex [-in file | -in_str str] [-bin|-hex] [-out file]";
@@ -153,15 +154,27 @@ bad:
 			goto end;
 		}
 	} else {
-		uint8_t buf[4096];
+		FILE_READER reader;
+		const uint8_t *buf;
 		size_t len;
-		while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+		int rv;
+
+		if (file_read_init(&reader, infp, 0) != 1) {
+			fprintf(stderr, "%s: inner error\n", prog);
+			goto end;
+		}
+		while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 			if (sm3_digest_update(&ctx, buf, len) != 1) {
 				fprintf(stderr, "%s: inner error\n", prog);
+				file_read_cleanup(&reader);
 				goto end;
 			}
 		}
-		memset(buf, 0, sizeof(buf));
+		file_read_cleanup(&reader);
+		if (rv < 0) {
+			fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
 	}
 	if (sm3_digest_finish(&ctx, mac) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
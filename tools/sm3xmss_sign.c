@@ -14,6 +14,7 @@
 #include <stdlib.h>
 #include <gmssl/error.h>
 #include <gmssl/sm3_xmss.h>
+#include <gmssl/file.h>
 
 static const char *usage = "-key file [-in file] [-out file]\n";
 
@@ -36,6 +37,10 @@ int sm3xmss_sign_main(int argc, char **argv)
 	FILE *outfp = stdout;
 	SM3_XMSS_KEY key;
 	SM3_XMSS_SIGN_CTX sign_ctx;
+	FILE_READER reader;
+	const uint8_t *buf;
+	size_t len;
+	int rv;
 	uint8_t *sigbuf = NULL;
 	size_t siglen;
 
@@ -106,17 +111,22 @@ bad:
 		goto end;
 	}
 
-	while (1) {
-		uint8_t buf[1024];
-		size_t len = fread(buf, 1, sizeof(buf), infp);
-		if (len == 0) {
-			break;
-		}
+	if (file_read_init(&reader, infp, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 		if (sm3_xmss_sign_update(&sign_ctx, buf, len) != 1) {
 			error_print();
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 
 	if (sm3_xmss_sign_finish(&sign_ctx, &key, NULL, &siglen) != 1) {
 		error_print();
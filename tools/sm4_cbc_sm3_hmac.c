@@ -16,6 +16,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/hex.h>
 #include <gmssl/error.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "{-encrypt|-decrypt} -key hex -iv hex [-aad str| -aad_hex hex] [-in file] [-out file]";
@@ -61,8 +62,11 @@ int sm4_cbc_sm3_hmac_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	SM4_CBC_SM3_HMAC_CTX ctx;
-	uint8_t buf[4096];
+	FILE_READER reader;
+	const uint8_t *inbuf;
+	uint8_t *buf = NULL;
 	size_t inlen;
+	int rv;
 	size_t outlen;
 
 	argc--;
@@ -188,23 +192,39 @@ bad:
 		}
 	}
 
-	while ((inlen = fread(buf, 1, sizeof(buf), infp)) > 0) {
+	if (!(buf = malloc(FILE_CIPHER_OUTBUF_SIZE))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+	if (file_read_init(&reader, infp, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &inbuf, &inlen)) == 1) {
 		if (enc) {
-			if (sm4_cbc_sm3_hmac_encrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+			if (sm4_cbc_sm3_hmac_encrypt_update(&ctx, inbuf, inlen, buf, &outlen) != 1) {
 				error_print();
+				file_read_cleanup(&reader);
 				goto end;
 			}
 		} else {
-			if (sm4_cbc_sm3_hmac_decrypt_update(&ctx, buf, inlen, buf, &outlen) != 1) {
+			if (sm4_cbc_sm3_hmac_decrypt_update(&ctx, inbuf, inlen, buf, &outlen) != 1) {
 				error_print();
+				file_read_cleanup(&reader);
 				goto end;
 			}
 		}
 		if (fwrite(buf, 1, outlen, outfp) != outlen) {
 			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 
 	if (enc) {
 		if (sm4_cbc_sm3_hmac_encrypt_finish(&ctx, buf, &outlen) != 1) {
@@ -228,7 +248,10 @@ end:
 	gmssl_secure_clear(key, sizeof(key));
 	gmssl_secure_clear(iv, sizeof(iv));
 	gmssl_secure_clear(&ctx, sizeof(ctx));
-	gmssl_secure_clear(buf, sizeof(buf));
+	if (buf) {
+		gmssl_secure_clear(buf, FILE_CIPHER_OUTBUF_SIZE);
+		free(buf);
+	}
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;
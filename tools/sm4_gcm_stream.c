@@ -0,0 +1,358 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <gmssl/sm4.h>
+#include <gmssl/mem.h>
+#include <gmssl/hex.h>
+#include <gmssl/error.h>
+#include <gmssl/sm4_gcm_stream.h>
+
+#ifdef _WIN32
+#define fseeko _fseeki64
+#define ftello _ftelli64
+#endif
+
+
+// segments read, sealed in parallel and written per round
+#define BATCH_SIZE	(16 * 1024 * 1024)
+
+
+static const char *usage =
+	"{-encrypt|-decrypt} -key hex [-segment_size num] [-threads num]"
+	" [-offset num] [-length num] [-in file] [-out file]";
+
+static const char *options =
+"Options\n"
+"\n"
+"    -encrypt            Encrypt into a segmented SM4-GCM container\n"
+"    -decrypt            Decrypt a segmented SM4-GCM container\n"
+"    -key hex            Symmetric key in HEX format, 16 bytes\n"
+"    -segment_size num   Plaintext bytes per segment, default 65536\n"
+"    -threads num        Worker threads, default one per online CPU\n"
+"    -offset num         Decrypt only from this plaintext offset, `-in` must be a file\n"
+"    -length num         Decrypt only this many plaintext bytes, `-in` must be a file\n"
+"    -in file | stdin    Input data\n"
+"    -out file | stdout  Output data\n"
+"\n"
+"Examples\n"
+"\n"
+"  $ KEY=`gmssl rand -outlen 16 -hex`\n"
+"  $ gmssl sm4_gcm_stream -encrypt -key $KEY -in data.bin -out data.sgcm\n"
+"  $ gmssl sm4_gcm_stream -decrypt -key $KEY -in data.sgcm -out data.bin\n"
+"  $ gmssl sm4_gcm_stream -decrypt -key $KEY -in data.sgcm -offset 1048576 -length 4096\n"
+"\n";
+
+// 1 when `buf` is filled, 0 when the input ends first, -1 on error
+static int read_full(FILE *fp, uint8_t *buf, size_t len, size_t *rlen)
+{
+	size_t n;
+
+	*rlen = 0;
+	while (*rlen < len) {
+		if (!(n = fread(buf + *rlen, 1, len - *rlen, fp))) {
+			return ferror(fp) ? -1 : 0;
+		}
+		*rlen += n;
+	}
+	return 1;
+}
+
+// 1 if the input has no more bytes
+static int at_eof(FILE *fp)
+{
+	int c;
+
+	if ((c = getc(fp)) == EOF) {
+		return 1;
+	}
+	ungetc(c, fp);
+	return 0;
+}
+
+int sm4_gcm_stream_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	int enc = -1;
+	char *keyhex = NULL;
+	long segment_size = SM4_GCM_STREAM_DEFAULT_SEGMENT_SIZE;
+	int threads = 0;
+	long long offset = -1;
+	long long length = -1;
+	char *infile = NULL;
+	char *outfile = NULL;
+	uint8_t key[SM4_KEY_SIZE];
+	size_t keylen;
+	FILE *infp = stdin;
+	FILE *outfp = stdout;
+	SM4_GCM_STREAM_CTX ctx;
+	uint8_t header[SM4_GCM_STREAM_HEADER_SIZE];
+	size_t seglen;
+	size_t batch_segs;
+	uint8_t *inbuf = NULL;
+	uint8_t *outbuf = NULL;
+	size_t inbuf_size = 0;
+	size_t outbuf_size = 0;
+	size_t inlen;
+	size_t outlen;
+	uint64_t index = 0;
+	int is_last;
+	int rv;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	argc--;
+	argv++;
+
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, usage);
+		return 1;
+	}
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n", prog, usage);
+			printf("%s\n", options);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-encrypt")) {
+			if (enc == 0) {
+				fprintf(stderr, "gmssl %s: `-encrypt` `-decrypt` should not be used together\n", prog);
+				goto end;
+			}
+			enc = 1;
+		} else if (!strcmp(*argv, "-decrypt")) {
+			if (enc == 1) {
+				fprintf(stderr, "gmssl %s: `-encrypt` `-decrypt` should not be used together\n", prog);
+				goto end;
+			}
+			enc = 0;
+		} else if (!strcmp(*argv, "-key")) {
+			if (--argc < 1) goto bad;
+			keyhex = *(++argv);
+			if (strlen(keyhex) != sizeof(key) * 2) {
+				fprintf(stderr, "gmssl %s: invalid key length\n", prog);
+				goto end;
+			}
+			if (hex_to_bytes(keyhex, strlen(keyhex), key, &keylen) != 1) {
+				fprintf(stderr, "gmssl %s: invalid key hex digits\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-segment_size")) {
+			if (--argc < 1) goto bad;
+			segment_size = atol(*(++argv));
+			if (segment_size < SM4_GCM_STREAM_MIN_SEGMENT_SIZE
+				|| segment_size > SM4_GCM_STREAM_MAX_SEGMENT_SIZE) {
+				fprintf(stderr, "gmssl %s: `-segment_size` should be in [%d, %d]\n", prog,
+					SM4_GCM_STREAM_MIN_SEGMENT_SIZE, SM4_GCM_STREAM_MAX_SEGMENT_SIZE);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
+			if (threads < 1 || threads > SM4_GCM_STREAM_MAX_THREADS) {
+				fprintf(stderr, "gmssl %s: `-threads` should be in [1, %d]\n", prog, SM4_GCM_STREAM_MAX_THREADS);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-offset")) {
+			if (--argc < 1) goto bad;
+			offset = atoll(*(++argv));
+			if (offset < 0) {
+				fprintf(stderr, "gmssl %s: `-offset` invalid integer argument\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-length")) {
+			if (--argc < 1) goto bad;
+			length = atoll(*(++argv));
+			if (length < 0) {
+				fprintf(stderr, "gmssl %s: `-length` invalid integer argument\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-in")) {
+			if (--argc < 1) goto bad;
+			infile = *(++argv);
+			if (!(infp = fopen(infile, "rb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, infile, strerror(errno));
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "gmssl %s: illegal option `%s`\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "gmssl %s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	if (enc < 0) {
+		fprintf(stderr, "gmssl %s: option -encrypt or -decrypt should be set\n", prog);
+		goto end;
+	}
+	if (!keyhex) {
+		fprintf(stderr, "gmssl %s: option `-key` missing\n", prog);
+		goto end;
+	}
+	if ((offset >= 0 || length >= 0) && (enc || !infile)) {
+		fprintf(stderr, "gmssl %s: `-offset` and `-length` need `-decrypt` and an `-in` file\n", prog);
+		goto end;
+	}
+
+	if (enc) {
+		if (sm4_gcm_stream_encrypt_init(&ctx, key, (size_t)segment_size, header) != 1) {
+			error_print();
+			goto end;
+		}
+		if (fwrite(header, 1, sizeof(header), outfp) != sizeof(header)) {
+			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+	} else {
+		if (read_full(infp, header, sizeof(header), &inlen) != 1) {
+			fprintf(stderr, "gmssl %s: read header failure\n", prog);
+			goto end;
+		}
+		if (sm4_gcm_stream_decrypt_init(&ctx, key, header) != 1) {
+			fprintf(stderr, "gmssl %s: invalid header or wrong key\n", prog);
+			goto end;
+		}
+	}
+
+	seglen = ctx.segment_size + SM4_GCM_STREAM_TAG_SIZE;
+	batch_segs = BATCH_SIZE / ctx.segment_size;
+	inbuf_size = batch_segs * (enc ? ctx.segment_size : seglen);
+	outbuf_size = batch_segs * (enc ? seglen : ctx.segment_size);
+	if (!(inbuf = malloc(inbuf_size)) || !(outbuf = malloc(outbuf_size))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+
+	// random access: decrypt only the segments covering [offset, offset + length)
+	if (offset >= 0 || length >= 0) {
+		long long cipher_size;
+		uint64_t plain_size;
+		uint64_t last_index;
+		uint64_t end_index;
+		uint64_t start, stop;
+		size_t skip;
+
+		if (fseeko(infp, 0, SEEK_END) != 0
+			|| (cipher_size = (long long)ftello(infp)) < SM4_GCM_STREAM_HEADER_SIZE) {
+			fprintf(stderr, "gmssl %s: `-in` is not a seekable container file\n", prog);
+			goto end;
+		}
+		cipher_size -= SM4_GCM_STREAM_HEADER_SIZE;
+		if (sm4_gcm_stream_plaintext_size(ctx.segment_size, (uint64_t)cipher_size, &plain_size) != 1) {
+			fprintf(stderr, "gmssl %s: truncated container\n", prog);
+			goto end;
+		}
+		start = offset >= 0 ? (uint64_t)offset : 0;
+		if (start > plain_size) {
+			start = plain_size;
+		}
+		stop = length >= 0 && (uint64_t)length < plain_size - start ? start + (uint64_t)length : plain_size;
+		if (start == stop) {
+			ret = 0;
+			goto end;
+		}
+
+		last_index = ((uint64_t)cipher_size - 1) / seglen;
+		index = start / ctx.segment_size;
+		end_index = (stop - 1) / ctx.segment_size;
+		skip = (size_t)(start - index * ctx.segment_size);
+		if (fseeko(infp, SM4_GCM_STREAM_HEADER_SIZE + index * seglen, SEEK_SET) != 0) {
+			fprintf(stderr, "gmssl %s: seek failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+
+		while (index <= end_index) {
+			size_t nsegs = end_index - index + 1 < batch_segs ? (size_t)(end_index - index + 1) : batch_segs;
+
+			is_last = (index + nsegs - 1 == last_index);
+			if ((rv = read_full(infp, inbuf, nsegs * seglen, &inlen)) < 0 || (rv == 0 && !is_last)) {
+				fprintf(stderr, "gmssl %s: read input failure\n", prog);
+				goto end;
+			}
+			if (sm4_gcm_stream_decrypt_segments(&ctx, index, inbuf, inlen, is_last,
+				outbuf, &outlen, threads) != 1) {
+				fprintf(stderr, "gmssl %s: segment authentication failure\n", prog);
+				goto end;
+			}
+			if ((uint64_t)(index + nsegs) * ctx.segment_size > stop) {
+				outlen = (size_t)(stop - index * ctx.segment_size);
+			}
+			if (fwrite(outbuf + skip, 1, outlen - skip, outfp) != outlen - skip) {
+				fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
+				goto end;
+			}
+			skip = 0;
+			index += nsegs;
+		}
+		ret = 0;
+		goto end;
+	}
+
+	// a round that does not fill the buffer, or leaves nothing behind, ends the stream
+	for (is_last = 0; !is_last; index += batch_segs) {
+		if ((rv = read_full(infp, inbuf, inbuf_size, &inlen)) < 0) {
+			fprintf(stderr, "gmssl %s: read input failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+		is_last = (rv == 0 || at_eof(infp));
+
+		if (enc) {
+			if (sm4_gcm_stream_encrypt_segments(&ctx, index, inbuf, inlen, is_last,
+				outbuf, &outlen, threads) != 1) {
+				error_print();
+				goto end;
+			}
+		} else {
+			if (sm4_gcm_stream_decrypt_segments(&ctx, index, inbuf, inlen, is_last,
+				outbuf, &outlen, threads) != 1) {
+				fprintf(stderr, "gmssl %s: segment authentication failure\n", prog);
+				goto end;
+			}
+		}
+		if (fwrite(outbuf, 1, outlen, outfp) != outlen) {
+			fprintf(stderr, "gmssl %s: output failure : %s\n", prog, strerror(errno));
+			goto end;
+		}
+	}
+
+	ret = 0;
+
+end:
+	gmssl_secure_clear(key, sizeof(key));
+	gmssl_secure_clear(&ctx, sizeof(ctx));
+	if (inbuf) {
+		gmssl_secure_clear(inbuf, inbuf_size);
+		free(inbuf);
+	}
+	if (outbuf) {
+		gmssl_secure_clear(outbuf, outbuf_size);
+		free(outbuf);
+	}
+	if (infile && infp) fclose(infp);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
@@ -14,6 +14,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/sm9.h>
 #include <gmssl/error.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "-key pem -pass str [-in file] [-out file]";
@@ -48,8 +49,10 @@ int sm9sign_main(int argc, char **argv)
 	FILE *outfp = stdout;
 	SM9_SIGN_KEY key;
 	SM9_SIGN_CTX ctx;
-	uint8_t buf[4096];
+	FILE_READER reader;
+	const uint8_t *buf;
 	size_t len;
+	int rv;
 	uint8_t sig[SM9_SIGNATURE_SIZE];
 	size_t siglen;
 
@@ -114,12 +117,22 @@ bad:
 		error_print();
 		goto end;
 	}
-	while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+	if (file_read_init(&reader, infp, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 		if (sm9_sign_update(&ctx, buf, len) != 1) {
 			error_print();
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		error_print();
+		goto end;
+	}
 	if (sm9_sign_finish(&ctx, &key, sig, &siglen) != 1) {
 		error_print();
 		goto end;
@@ -137,7 +150,6 @@ bad:
 end:
 	gmssl_secure_clear(&key, sizeof(key));
 	gmssl_secure_clear(&ctx, sizeof(ctx));
-	gmssl_secure_clear(buf, sizeof(buf));
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;
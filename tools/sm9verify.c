@@ -13,6 +13,7 @@
 #include <stdlib.h>
 #include <gmssl/sm9.h>
 #include <gmssl/error.h>
+#include <gmssl/file.h>
 
 
 static const char *usage = "[-in file] -pubmaster file -id str -sig file";
@@ -47,8 +48,10 @@ int sm9verify_main(int argc, char **argv)
 	FILE *sigfp = NULL;
 	SM9_SIGN_MASTER_KEY mpk;
 	SM9_SIGN_CTX ctx;
-	uint8_t buf[4096];
+	FILE_READER reader;
+	const uint8_t *buf;
 	size_t len;
+	int rv;
 	uint8_t sig[SM9_SIGNATURE_SIZE];
 	size_t siglen;
 
@@ -118,12 +121,22 @@ bad:
 		error_print();
 		goto end;
 	}
-	while ((len = fread(buf, 1, sizeof(buf), infp)) > 0) {
+	if (file_read_init(&reader, infp, 0) != 1) {
+		error_print();
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &buf, &len)) == 1) {
 		if (sm9_verify_update(&ctx, buf, len) != 1) {
 			error_print();
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		error_print();
+		goto end;
+	}
 	if ((ret = sm9_verify_finish(&ctx, sig, siglen, &mpk, id, strlen(id))) != 1) {
 		error_print();
 		goto end;
@@ -0,0 +1,1046 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#include <gmssl/cpu.h>
+#include <gmssl/rand.h>
+#include <gmssl/sm2.h>
+#include <gmssl/sm2_z256.h>
+#include <gmssl/sm3.h>
+#include <gmssl/sm4.h>
+#include <gmssl/sm4_cbc_mac.h>
+#include <gmssl/sm9.h>
+#include <gmssl/zuc.h>
+#include <gmssl/ghash.h>
+#include <gmssl/version.h>
+#ifdef ENABLE_SM4_CL
+#include <gmssl/sm4_cl.h>
+#endif
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#endif
+#ifdef __linux__
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__) || defined(_M_X64) || defined(_M_IX86)
+# ifdef _MSC_VER
+#  include <intrin.h>
+# else
+#  include <x86intrin.h>
+# endif
+# define SPEED_HAVE_RDTSC
+#endif
+
+
+static const char *usage =
+	"[-alg name]... [-sizes list] [-seconds num] [-warmup num] [-threads list] [-json] [-out file] [-list]\n";
+
+static const char *options =
+"Options\n"
+"\n"
+"    -alg name                   Run the algorithm `name`, or all the algorithms `name_*`, e.g. sm4, sm4_gcm\n"
+"                                Repeat it or separate names by commas, default all\n"
+"    -sizes list                 Message sizes in bytes for the symmetric algorithms\n"
+"                                Default 16,64,256,1024,8192,16384\n"
+"    -seconds num                Measured time of every run in seconds, default 1\n"
+"    -warmup num                 Untimed run before every measured run in seconds, default 0.2\n"
+"    -threads list               Thread counts of the scaling runs, e.g. 1,2,4,8, default 1\n"
+"                                Every thread runs the same operation on its own keys and buffers\n"
+"    -json                       Output results as JSON\n"
+"    -out file                   Output file, default stdout\n"
+"    -list                       List the algorithms\n"
+"\n"
+"Cycles are counted with the CPU cycle counter of the perf events on Linux, or the\n"
+"time stamp counter (reference cycles) on x86 when the perf events are unavailable.\n"
+"\n"
+"Examples\n"
+"\n"
+"    $ gmssl speed\n"
+"    $ gmssl speed -alg sm4_gcm,sm3 -sizes 64,1500,16384 -seconds 3\n"
+"    $ gmssl speed -alg sm2_sign,sm2_verify -threads 1,2,4,8\n"
+"    $ gmssl speed -json -out bench.json\n"
+"\n";
+
+
+#define SPEED_MAX_SIZES		32
+#define SPEED_MAX_THREADS	256
+#define SPEED_ZUC_PACKETS	16
+
+typedef struct {
+	uint8_t *in;
+	uint8_t *out;
+	size_t buflen;
+	uint8_t key[16];
+	uint8_t iv[16];
+	uint8_t dgst[32];
+	SM4_KEY sm4_enc_key;
+	SM4_KEY sm4_dec_key;
+	SM4_KEY sm4_tweak_key;
+	SM3_HMAC_KEY hmac_key;
+	ZUC_STATE zuc_state;
+	ZUC_PACKET zuc_packets[SPEED_ZUC_PACKETS];
+	SM2_KEY sm2_key;
+	SM2_SIGNATURE sm2_sig;
+	uint8_t sm2_ciphertext[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t sm2_ciphertext_len;
+	SM9_SIGN_MASTER_KEY sm9_master;
+	SM9_SIGN_KEY sm9_key;
+	SM9_SIGNATURE sm9_sig;
+	SM3_CTX sm9_sm3_ctx;
+#ifdef ENABLE_SM4_CL
+	SM4_CL_CTX sm4_cl_ctx;
+	int sm4_cl_inited;
+#endif
+} SPEED_STATE;
+
+// one operation on a len-byte message, *nbytes is the number of bytes processed
+typedef int (*SPEED_RUN)(SPEED_STATE *st, size_t len, size_t *nbytes);
+typedef int (*SPEED_INIT)(SPEED_STATE *st);
+
+typedef struct {
+	const char *name;
+	int sized; // 1 for a message size sweep, 0 for an operation of fixed size
+	SPEED_INIT init;
+	SPEED_RUN run;
+} SPEED_ALG;
+
+
+static int init_sm4(SPEED_STATE *st)
+{
+	sm4_set_encrypt_key(&st->sm4_enc_key, st->key);
+	sm4_set_decrypt_key(&st->sm4_dec_key, st->key);
+	sm4_set_encrypt_key(&st->sm4_tweak_key, st->iv);
+	return 1;
+}
+
+static int run_sm3(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM3_CTX ctx;
+	sm3_init(&ctx);
+	sm3_update(&ctx, st->in, len);
+	sm3_finish(&ctx, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+static int init_sm3_hmac(SPEED_STATE *st)
+{
+	sm3_hmac_set_key(&st->hmac_key, st->key, sizeof(st->key));
+	return 1;
+}
+
+static int run_sm3_hmac(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM3_HMAC_CTX ctx;
+	sm3_hmac_init_with_key(&ctx, &st->hmac_key);
+	sm3_hmac_update(&ctx, st->in, len);
+	sm3_hmac_finish(&ctx, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+static int run_sm4_ecb_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_encrypt_blocks(&st->sm4_enc_key, st->in, len/16, st->out);
+	*nbytes = len - len % 16;
+	return 1;
+}
+
+static int run_sm4_cbc_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_cbc_encrypt_blocks(&st->sm4_enc_key, st->iv, st->in, len/16, st->out);
+	*nbytes = len - len % 16;
+	return 1;
+}
+
+static int run_sm4_cbc_decrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_cbc_decrypt_blocks(&st->sm4_dec_key, st->iv, st->in, len/16, st->out);
+	*nbytes = len - len % 16;
+	return 1;
+}
+
+static int run_sm4_ctr(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_ctr_encrypt_blocks(&st->sm4_enc_key, st->iv, st->in, len/16, st->out);
+	*nbytes = len - len % 16;
+	return 1;
+}
+
+static int run_sm4_ctr32(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_ctr32_encrypt_blocks(&st->sm4_enc_key, st->iv, st->in, len/16, st->out);
+	*nbytes = len - len % 16;
+	return 1;
+}
+
+static int run_sm4_gcm_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	uint8_t tag[16];
+	if (sm4_gcm_encrypt(&st->sm4_enc_key, st->iv, 12, NULL, 0, st->in, len, st->out, sizeof(tag), tag) != 1) {
+		error_print();
+		return -1;
+	}
+	*nbytes = len;
+	return 1;
+}
+
+#ifdef ENABLE_SM4_OFB
+static int run_sm4_ofb(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_ofb_encrypt(&st->sm4_enc_key, st->iv, st->in, len, st->out);
+	*nbytes = len;
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_SM4_CFB
+static int run_sm4_cfb_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm4_cfb_encrypt(&st->sm4_enc_key, 16, st->iv, st->in, len, st->out);
+	*nbytes = len;
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_SM4_CCM
+static int run_sm4_ccm_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	uint8_t tag[16];
+	if (sm4_ccm_encrypt(&st->sm4_enc_key, st->iv, 12, NULL, 0, st->in, len, st->out, sizeof(tag), tag) != 1) {
+		error_print();
+		return -1;
+	}
+	*nbytes = len;
+	return 1;
+}
+#endif
+
+#ifdef ENABLE_SM4_XTS
+static int run_sm4_xts_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	if (len < 16) {
+		*nbytes = 0;
+		return 1;
+	}
+	if (sm4_xts_encrypt(&st->sm4_enc_key, &st->sm4_tweak_key, st->iv, st->in, len, st->out) != 1) {
+		error_print();
+		return -1;
+	}
+	*nbytes = len;
+	return 1;
+}
+#endif
+
+static int run_sm4_cbc_mac(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM4_CBC_MAC_CTX ctx;
+	sm4_cbc_mac_init(&ctx, st->key);
+	sm4_cbc_mac_update(&ctx, st->in, len);
+	sm4_cbc_mac_finish(&ctx, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+static int run_sm4_cmac(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM4_CMAC_CTX ctx;
+	sm4_cmac_init(&ctx, st->key);
+	sm4_cmac_update(&ctx, st->in, len);
+	sm4_cmac_finish(&ctx, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+// SM4_MAC_BATCH_LANES messages of `len` bytes each
+static int run_sm4_cbc_mac_batch(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	const uint8_t *msgs[SM4_MAC_BATCH_LANES];
+	size_t msglens[SM4_MAC_BATCH_LANES];
+	uint8_t macs[SM4_MAC_BATCH_LANES * 16];
+	int i;
+
+	for (i = 0; i < SM4_MAC_BATCH_LANES; i++) {
+		msgs[i] = st->in;
+		msglens[i] = len;
+	}
+	sm4_cbc_mac_batch(&st->sm4_enc_key, msgs, msglens, SM4_MAC_BATCH_LANES, macs);
+	*nbytes = len * SM4_MAC_BATCH_LANES;
+	return 1;
+}
+
+#ifdef ENABLE_SM4_CL
+static int init_sm4_cl(SPEED_STATE *st)
+{
+	if (sm4_cl_set_encrypt_key(&st->sm4_cl_ctx, st->key) != 1) {
+		error_print();
+		return -1;
+	}
+	st->sm4_cl_inited = 1;
+	return 1;
+}
+
+static int run_sm4_cl_ctr32(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	if (sm4_cl_ctr32_encrypt_blocks(&st->sm4_cl_ctx, st->iv, st->in, len/16, st->out) != 1) {
+		error_print();
+		return -1;
+	}
+	*nbytes = len - len % 16;
+	return 1;
+}
+#endif
+
+static int run_ghash(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	ghash(st->key, NULL, 0, st->in, len, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+static int init_zuc(SPEED_STATE *st)
+{
+	zuc_init(&st->zuc_state, st->key, st->iv);
+	return 1;
+}
+
+static int run_zuc(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	zuc_encrypt(&st->zuc_state, st->in, len, st->out);
+	*nbytes = len;
+	return 1;
+}
+
+// SPEED_ZUC_PACKETS packets of len bytes, every one with its own count and bearer
+static int run_zuc_eea_packets(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	size_t words = (len / 4) / SPEED_ZUC_PACKETS;
+	int i;
+
+	for (i = 0; i < SPEED_ZUC_PACKETS; i++) {
+		st->zuc_packets[i].key = st->key;
+		st->zuc_packets[i].count = i;
+		st->zuc_packets[i].bearer = i % 32;
+		st->zuc_packets[i].direction = 0;
+		st->zuc_packets[i].in = (const ZUC_UINT32 *)st->in + words * i;
+		st->zuc_packets[i].out = (ZUC_UINT32 *)st->out + words * i;
+		st->zuc_packets[i].nbits = words * 32;
+	}
+	zuc_eea_encrypt_packets(st->zuc_packets, SPEED_ZUC_PACKETS);
+	*nbytes = words * 4 * SPEED_ZUC_PACKETS;
+	return 1;
+}
+
+static int init_sm2(SPEED_STATE *st)
+{
+	if (sm2_key_generate(&st->sm2_key) != 1
+		|| sm2_do_sign(&st->sm2_key, st->dgst, &st->sm2_sig) != 1
+		|| sm2_encrypt(&st->sm2_key, st->key, 16, st->sm2_ciphertext, &st->sm2_ciphertext_len) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm2_point_mul_generator(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM2_Z256_POINT P;
+	sm2_z256_point_mul_generator(&P, st->sm2_key.private_key);
+	return 1;
+}
+
+// the inversions take the private key as a field element
+static int run_sm2_modp_inv(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm2_z256_t r;
+	sm2_z256_modp_mont_inv(r, st->sm2_key.private_key);
+	return 1;
+}
+
+static int run_sm2_modp_inv_exp(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm2_z256_t r;
+	sm2_z256_modp_mont_inv_exp(r, st->sm2_key.private_key);
+	return 1;
+}
+
+static int run_sm2_modn_inv(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm2_z256_t r;
+	sm2_z256_modn_mont_inv(r, st->sm2_key.private_key);
+	return 1;
+}
+
+static int run_sm2_modn_inv_exp(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm2_z256_t r;
+	sm2_z256_modn_mont_inv_exp(r, st->sm2_key.private_key);
+	return 1;
+}
+
+static int run_sm2_keygen(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM2_KEY key;
+	if (sm2_key_generate(&key) != 1) {
+		error_print();
+		return -1;
+	}
+	gmssl_secure_clear(&key, sizeof(key));
+	return 1;
+}
+
+static int run_sm2_sign(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM2_SIGNATURE sig;
+	if (sm2_do_sign(&st->sm2_key, st->dgst, &sig) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm2_verify(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	if (sm2_do_verify(&st->sm2_key, st->dgst, &st->sm2_sig) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm2_encrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	uint8_t out[SM2_MAX_CIPHERTEXT_SIZE];
+	size_t outlen;
+	if (sm2_encrypt(&st->sm2_key, st->key, 16, out, &outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm2_decrypt(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	uint8_t out[SM2_MAX_PLAINTEXT_SIZE];
+	size_t outlen;
+	if (sm2_decrypt(&st->sm2_key, st->sm2_ciphertext, st->sm2_ciphertext_len, out, &outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm2_ecdh(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM2_Z256_POINT P;
+	if (sm2_do_ecdh(&st->sm2_key, &st->sm2_key.public_key, &P) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int init_sm9(SPEED_STATE *st)
+{
+	if (sm9_sign_master_key_generate(&st->sm9_master) != 1
+		|| sm9_sign_master_key_extract_key(&st->sm9_master, "Alice", 5, &st->sm9_key) != 1) {
+		error_print();
+		return -1;
+	}
+	sm3_init(&st->sm9_sm3_ctx);
+	sm3_update(&st->sm9_sm3_ctx, st->key, sizeof(st->key));
+	if (sm9_do_sign(&st->sm9_key, &st->sm9_sm3_ctx, &st->sm9_sig) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm9_modp_inv(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm9_z256_t r;
+	sm9_z256_modp_mont_inv(r, st->sm9_key.ds.X);
+	return 1;
+}
+
+static int run_sm9_modp_inv_exp(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	sm9_z256_t r;
+	sm9_z256_modp_mont_inv_exp(r, st->sm9_key.ds.X);
+	return 1;
+}
+
+static int run_sm9_sign(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	SM9_SIGNATURE sig;
+	if (sm9_do_sign(&st->sm9_key, &st->sm9_sm3_ctx, &sig) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int run_sm9_verify(SPEED_STATE *st, size_t len, size_t *nbytes)
+{
+	if (sm9_do_verify(&st->sm9_master, "Alice", 5, &st->sm9_sm3_ctx, &st->sm9_sig) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static const SPEED_ALG speed_algs[] = {
+	{ "sm3", 1, NULL, run_sm3 },
+	{ "sm3_hmac", 1, init_sm3_hmac, run_sm3_hmac },
+	{ "sm4_ecb_encrypt", 1, init_sm4, run_sm4_ecb_encrypt },
+	{ "sm4_cbc_encrypt", 1, init_sm4, run_sm4_cbc_encrypt },
+	{ "sm4_cbc_decrypt", 1, init_sm4, run_sm4_cbc_decrypt },
+	{ "sm4_ctr", 1, init_sm4, run_sm4_ctr },
+	{ "sm4_ctr32", 1, init_sm4, run_sm4_ctr32 },
+	{ "sm4_gcm_encrypt", 1, init_sm4, run_sm4_gcm_encrypt },
+#ifdef ENABLE_SM4_OFB
+	{ "sm4_ofb", 1, init_sm4, run_sm4_ofb },
+#endif
+#ifdef ENABLE_SM4_CFB
+	{ "sm4_cfb_encrypt", 1, init_sm4, run_sm4_cfb_encrypt },
+#endif
+#ifdef ENABLE_SM4_CCM
+	{ "sm4_ccm_encrypt", 1, init_sm4, run_sm4_ccm_encrypt },
+#endif
+#ifdef ENABLE_SM4_XTS
+	{ "sm4_xts_encrypt", 1, init_sm4, run_sm4_xts_encrypt },
+#endif
+	{ "sm4_cbc_mac", 1, NULL, run_sm4_cbc_mac },
+	{ "sm4_cbc_mac_batch", 1, init_sm4, run_sm4_cbc_mac_batch },
+	{ "sm4_cmac", 1, NULL, run_sm4_cmac },
+#ifdef ENABLE_SM4_CL
+	{ "sm4_cl_ctr32", 1, init_sm4_cl, run_sm4_cl_ctr32 },
+#endif
+	{ "ghash", 1, NULL, run_ghash },
+	{ "zuc", 1, init_zuc, run_zuc },
+	{ "zuc_eea_packets", 1, NULL, run_zuc_eea_packets },
+	{ "sm2_point_mul_generator", 0, init_sm2, run_sm2_point_mul_generator },
+	{ "sm2_keygen", 0, NULL, run_sm2_keygen },
+	{ "sm2_sign", 0, init_sm2, run_sm2_sign },
+	{ "sm2_verify", 0, init_sm2, run_sm2_verify },
+	{ "sm2_encrypt", 0, init_sm2, run_sm2_encrypt },
+	{ "sm2_decrypt", 0, init_sm2, run_sm2_decrypt },
+	{ "sm2_ecdh", 0, init_sm2, run_sm2_ecdh },
+	{ "sm2_modp_inv", 0, init_sm2, run_sm2_modp_inv },
+	{ "sm2_modp_inv_exp", 0, init_sm2, run_sm2_modp_inv_exp },
+	{ "sm2_modn_inv", 0, init_sm2, run_sm2_modn_inv },
+	{ "sm2_modn_inv_exp", 0, init_sm2, run_sm2_modn_inv_exp },
+	{ "sm9_sign", 0, init_sm9, run_sm9_sign },
+	{ "sm9_verify", 0, init_sm9, run_sm9_verify },
+	{ "sm9_modp_inv", 0, init_sm9, run_sm9_modp_inv },
+	{ "sm9_modp_inv_exp", 0, init_sm9, run_sm9_modp_inv_exp },
+};
+
+#define SPEED_ALGS_COUNT	(sizeof(speed_algs)/sizeof(speed_algs[0]))
+
+
+static double speed_now(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+enum {
+	SPEED_CYCLES_NONE = 0,
+	SPEED_CYCLES_PERF,
+	SPEED_CYCLES_RDTSC,
+};
+
+static const char *speed_cycles_name(int source)
+{
+	switch (source) {
+	case SPEED_CYCLES_PERF: return "perf";
+	case SPEED_CYCLES_RDTSC: return "rdtsc";
+	}
+	return "none";
+}
+
+// cycles of the calling thread, perf events first
+static int speed_cycles_open(int *fd)
+{
+#ifdef __linux__
+	struct perf_event_attr attr;
+
+	memset(&attr, 0, sizeof(attr));
+	attr.type = PERF_TYPE_HARDWARE;
+	attr.size = sizeof(attr);
+	attr.config = PERF_COUNT_HW_CPU_CYCLES;
+	attr.exclude_kernel = 1;
+	attr.exclude_hv = 1;
+	if ((*fd = (int)syscall(SYS_perf_event_open, &attr, 0, -1, -1, 0)) >= 0) {
+		return SPEED_CYCLES_PERF;
+	}
+#endif
+	*fd = -1;
+#ifdef SPEED_HAVE_RDTSC
+	return SPEED_CYCLES_RDTSC;
+#else
+	return SPEED_CYCLES_NONE;
+#endif
+}
+
+static uint64_t speed_cycles_read(int source, int fd)
+{
+#ifdef __linux__
+	if (source == SPEED_CYCLES_PERF) {
+		uint64_t count = 0;
+		if (read(fd, &count, sizeof(count)) != sizeof(count)) {
+			return 0;
+		}
+		return count;
+	}
+#endif
+#ifdef SPEED_HAVE_RDTSC
+	if (source == SPEED_CYCLES_RDTSC) {
+		return (uint64_t)__rdtsc();
+	}
+#endif
+	return 0;
+}
+
+static void speed_cycles_close(int fd)
+{
+#ifdef __linux__
+	if (fd >= 0) {
+		close(fd);
+	}
+#endif
+}
+
+typedef struct {
+	const SPEED_ALG *alg;
+	size_t len;
+	double warmup;
+	double seconds;
+	int ret;
+	uint64_t ops;
+	uint64_t bytes;
+	double elapsed;
+	uint64_t cycles;
+	int cycles_source;
+} SPEED_JOB;
+
+static void speed_job(SPEED_JOB *job)
+{
+	SPEED_STATE *st = NULL;
+	size_t nbytes = 0;
+	uint64_t batch = 1;
+	uint64_t i;
+	uint64_t c0, c1;
+	double start, t, last;
+	int fd = -1;
+
+	job->ret = -1;
+	if (!(st = (SPEED_STATE *)malloc(sizeof(SPEED_STATE)))) {
+		error_print();
+		return;
+	}
+	memset(st, 0, sizeof(SPEED_STATE));
+	st->buflen = job->len ? job->len : 16;
+	if (!(st->in = (uint8_t *)malloc(st->buflen))
+		|| !(st->out = (uint8_t *)malloc(st->buflen))) {
+		error_print();
+		goto end;
+	}
+	if (rand_bytes(st->in, st->buflen) != 1
+		|| rand_bytes(st->key, sizeof(st->key)) != 1
+		|| rand_bytes(st->iv, sizeof(st->iv)) != 1
+		|| rand_bytes(st->dgst, sizeof(st->dgst)) != 1) {
+		error_print();
+		goto end;
+	}
+	if (job->alg->init && job->alg->init(st) != 1) {
+		error_print();
+		goto end;
+	}
+
+	// warm-up for the caches, branch predictors and clock frequency
+	start = speed_now();
+	do {
+		if (job->alg->run(st, job->len, &nbytes) != 1) {
+			error_print();
+			goto end;
+		}
+	} while (speed_now() - start < job->warmup);
+
+	// the clock is read once a batch, the batch grows until it takes 1 ms
+	job->cycles_source = speed_cycles_open(&fd);
+	c0 = speed_cycles_read(job->cycles_source, fd);
+	start = last = speed_now();
+	do {
+		for (i = 0; i < batch; i++) {
+			if (job->alg->run(st, job->len, &nbytes) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		job->ops += batch;
+		job->bytes += (uint64_t)nbytes * batch;
+		t = speed_now();
+		if (t - last < 0.001) {
+			batch *= 2;
+		}
+		last = t;
+	} while (t - start < job->seconds);
+	c1 = speed_cycles_read(job->cycles_source, fd);
+
+	job->elapsed = t - start;
+	job->cycles = c1 - c0;
+	job->ret = 1;
+
+end:
+	speed_cycles_close(fd);
+#ifdef ENABLE_SM4_CL
+	if (st->sm4_cl_inited) {
+		sm4_cl_cleanup(&st->sm4_cl_ctx);
+	}
+#endif
+	if (st->in) free(st->in);
+	if (st->out) free(st->out);
+	gmssl_secure_clear(st, sizeof(SPEED_STATE));
+	free(st);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall speed_thread(void *arg)
+{
+	speed_job((SPEED_JOB *)arg);
+	return 0;
+}
+#else
+static void *speed_thread(void *arg)
+{
+	speed_job((SPEED_JOB *)arg);
+	return NULL;
+}
+#endif
+
+// run `threads` jobs at the same time, the calling thread runs jobs[0]
+static int speed_run_threads(SPEED_JOB *jobs, int threads)
+{
+#ifdef _WIN32
+	HANDLE tids[SPEED_MAX_THREADS];
+#else
+	pthread_t tids[SPEED_MAX_THREADS];
+#endif
+	int started = 0;
+	int ret = 1;
+	int i;
+
+	for (i = 1; i < threads; i++) {
+#ifdef _WIN32
+		if (!(tids[i] = (HANDLE)_beginthreadex(NULL, 0, speed_thread, &jobs[i], 0, NULL))) {
+			break;
+		}
+#else
+		if (pthread_create(&tids[i], NULL, speed_thread, &jobs[i]) != 0) {
+			break;
+		}
+#endif
+		started = i;
+	}
+	if (started != threads - 1) {
+		// a partial run would not measure the requested scaling
+		error_print();
+		ret = -1;
+	} else {
+		speed_job(&jobs[0]);
+	}
+	for (i = 1; i <= started; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(tids[i], INFINITE);
+		CloseHandle(tids[i]);
+#else
+		pthread_join(tids[i], NULL);
+#endif
+	}
+	for (i = 0; ret == 1 && i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+static int speed_parse_list(const char *str, size_t *vals, size_t maxvals, size_t *nvals)
+{
+	char *end;
+
+	*nvals = 0;
+	while (*str) {
+		unsigned long v = strtoul(str, &end, 10);
+		if (end == str || !v || *nvals >= maxvals) {
+			return -1;
+		}
+		vals[(*nvals)++] = (size_t)v;
+		if (*end == ',') {
+			end++;
+		} else if (*end) {
+			return -1;
+		}
+		str = end;
+	}
+	return *nvals ? 1 : -1;
+}
+
+// `name` selects itself and the algorithms `name_*`
+static int speed_alg_selected(const char *alg, const char *names)
+{
+	const char *p = names;
+
+	while (*p) {
+		size_t n = strcspn(p, ",");
+		if (n && !strncmp(alg, p, n) && (alg[n] == 0 || alg[n] == '_')) {
+			return 1;
+		}
+		p += n;
+		if (*p == ',') {
+			p++;
+		}
+	}
+	return 0;
+}
+
+int speed_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *names[SPEED_ALGS_COUNT];
+	int names_cnt = 0;
+	size_t sizes[SPEED_MAX_SIZES] = { 16, 64, 256, 1024, 8192, 16384 };
+	size_t sizes_cnt = 6;
+	size_t threads[SPEED_MAX_SIZES] = { 1 };
+	size_t threads_cnt = 1;
+	double seconds = 1;
+	double warmup = 0.2;
+	int json = 0;
+	char *outfile = NULL;
+	FILE *outfp = stdout;
+	SPEED_JOB *jobs = NULL;
+	int first = 1;
+	size_t a, s, t;
+	int i;
+
+	argc--;
+	argv++;
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n", prog, usage);
+			printf("%s\n", options);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-list")) {
+			for (a = 0; a < SPEED_ALGS_COUNT; a++) {
+				printf("%s\n", speed_algs[a].name);
+			}
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-alg")) {
+			if (--argc < 1) goto bad;
+			if (names_cnt >= (int)SPEED_ALGS_COUNT) {
+				fprintf(stderr, "gmssl %s: too many `-alg` options\n", prog);
+				goto end;
+			}
+			names[names_cnt++] = *(++argv);
+		} else if (!strcmp(*argv, "-sizes")) {
+			if (--argc < 1) goto bad;
+			if (speed_parse_list(*(++argv), sizes, SPEED_MAX_SIZES, &sizes_cnt) != 1) {
+				fprintf(stderr, "gmssl %s: invalid `-sizes` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			if (speed_parse_list(*(++argv), threads, SPEED_MAX_SIZES, &threads_cnt) != 1) {
+				fprintf(stderr, "gmssl %s: invalid `-threads` value\n", prog);
+				goto end;
+			}
+			for (t = 0; t < threads_cnt; t++) {
+				if (threads[t] > SPEED_MAX_THREADS) {
+					fprintf(stderr, "gmssl %s: `-threads` value should be at most %d\n", prog, SPEED_MAX_THREADS);
+					goto end;
+				}
+			}
+		} else if (!strcmp(*argv, "-seconds")) {
+			if (--argc < 1) goto bad;
+			seconds = atof(*(++argv));
+			if (seconds <= 0) {
+				fprintf(stderr, "gmssl %s: invalid `-seconds` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-warmup")) {
+			if (--argc < 1) goto bad;
+			warmup = atof(*(++argv));
+			if (warmup < 0) {
+				fprintf(stderr, "gmssl %s: invalid `-warmup` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-json")) {
+			json = 1;
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "gmssl %s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "gmssl %s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	for (i = 0; i < names_cnt; i++) {
+		for (a = 0; a < SPEED_ALGS_COUNT; a++) {
+			if (speed_alg_selected(speed_algs[a].name, names[i])) {
+				break;
+			}
+		}
+		if (a == SPEED_ALGS_COUNT) {
+			fprintf(stderr, "gmssl %s: unknown algorithm '%s', see `-list`\n", prog, names[i]);
+			goto end;
+		}
+	}
+
+	if (!(jobs = (SPEED_JOB *)malloc(sizeof(SPEED_JOB) * SPEED_MAX_THREADS))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+
+	if (json) {
+		fprintf(outfp, "{\n");
+		fprintf(outfp, "  \"version\": \"%s\",\n", gmssl_version_str());
+		fprintf(outfp, "  \"cpu_features\": \"0x%016llx\",\n", (unsigned long long)gmssl_cpu_features());
+		fprintf(outfp, "  \"seconds\": %g,\n", seconds);
+		fprintf(outfp, "  \"warmup\": %g,\n", warmup);
+		fprintf(outfp, "  \"results\": [");
+	} else {
+		fprintf(outfp, "%-24s %8s %7s %14s %12s %12s\n",
+			"algorithm", "size", "threads", "ops/s", "MB/s", "cycles");
+	}
+
+	for (a = 0; a < SPEED_ALGS_COUNT; a++) {
+		const SPEED_ALG *alg = &speed_algs[a];
+		int selected = names_cnt ? 0 : 1;
+
+		for (i = 0; i < names_cnt; i++) {
+			if (speed_alg_selected(alg->name, names[i])) {
+				selected = 1;
+			}
+		}
+		if (!selected) {
+			continue;
+		}
+
+		for (s = 0; s < (alg->sized ? sizes_cnt : 1); s++) {
+			for (t = 0; t < threads_cnt; t++) {
+				double ops_per_sec = 0;
+				double bytes_per_sec = 0;
+				uint64_t ops = 0;
+				uint64_t bytes = 0;
+				uint64_t cycles = 0;
+				double per_unit;
+
+				memset(jobs, 0, sizeof(SPEED_JOB) * threads[t]);
+				for (i = 0; i < (int)threads[t]; i++) {
+					jobs[i].alg = alg;
+					jobs[i].len = alg->sized ? sizes[s] : 0;
+					jobs[i].warmup = warmup;
+					jobs[i].seconds = seconds;
+				}
+				if (speed_run_threads(jobs, (int)threads[t]) != 1) {
+					fprintf(stderr, "gmssl %s: %s failure\n", prog, alg->name);
+					goto end;
+				}
+				for (i = 0; i < (int)threads[t]; i++) {
+					ops_per_sec += jobs[i].ops / jobs[i].elapsed;
+					bytes_per_sec += jobs[i].bytes / jobs[i].elapsed;
+					ops += jobs[i].ops;
+					bytes += jobs[i].bytes;
+					cycles += jobs[i].cycles;
+				}
+				// cycles per byte, or per operation of the public key algorithms
+				per_unit = alg->sized ? (bytes ? (double)cycles / bytes : 0) : (double)cycles / ops;
+
+				if (json) {
+					fprintf(outfp, "%s\n    {\"alg\": \"%s\", ", first ? "" : ",", alg->name);
+					if (alg->sized) {
+						fprintf(outfp, "\"size\": %zu, ", sizes[s]);
+					}
+					fprintf(outfp, "\"threads\": %zu, \"ops\": %llu, \"ops_per_sec\": %.1f, ",
+						threads[t], (unsigned long long)ops, ops_per_sec);
+					if (alg->sized) {
+						fprintf(outfp, "\"mb_per_sec\": %.2f, ", bytes_per_sec / 1e6);
+					}
+					fprintf(outfp, "\"cycles_source\": \"%s\", \"%s\": %.2f}",
+						speed_cycles_name(jobs[0].cycles_source),
+						alg->sized ? "cycles_per_byte" : "cycles_per_op", per_unit);
+					first = 0;
+				} else {
+					char size[32] = "-";
+					char mbps[32] = "-";
+					char cyc[32] = "-";
+					if (alg->sized) {
+						snprintf(size, sizeof(size), "%zu", sizes[s]);
+						snprintf(mbps, sizeof(mbps), "%.2f", bytes_per_sec / 1e6);
+					}
+					if (jobs[0].cycles_source != SPEED_CYCLES_NONE) {
+						snprintf(cyc, sizeof(cyc), alg->sized ? "%.2f/B" : "%.0f/op", per_unit);
+					}
+					fprintf(outfp, "%-24s %8s %7zu %14.1f %12s %12s\n",
+						alg->name, size, threads[t], ops_per_sec, mbps, cyc);
+				}
+				fflush(outfp);
+			}
+		}
+	}
+
+	if (json) {
+		fprintf(outfp, "\n  ]\n}\n");
+	}
+	ret = 0;
+
+end:
+	if (jobs) free(jobs);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
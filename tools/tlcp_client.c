@@ -71,6 +71,10 @@ int tlcp_client_main(int argc, char *argv[])
 	char send_buf[1024] = {0};
 	int read_stdin = 1;
 
+	// tls_cleanup() frees the buffers of conn
+	memset(&ctx, 0, sizeof(ctx));
+	memset(&conn, 0, sizeof(conn));
+
 	argc--;
 	argv++;
 	if (argc < 1) {
@@ -235,8 +239,8 @@ bad:
 			} else if (rv == 0) {
 				fprintf(stderr, "%s: TLCP connection is closed by remote host\n", prog);
 				goto end;
-			} else if (rv == -EAGAIN) {
-				// when timeout, tls_recv return -EAGAIN (-11)
+			} else if (rv == TLS_ERROR_WANT_READ) {
+				// when timeout, tls_recv return TLS_ERROR_WANT_READ
 				tls_shutdown(&conn);
 				ret = 0;
 				goto end;
@@ -294,7 +298,7 @@ bad:
 			} else if (rv == 0) {
 				fprintf(stderr, "Connection closed by remote host\n");
 				goto end;
-			} else if (rv == -EAGAIN) {
+			} else if (rv == TLS_ERROR_WANT_READ) {
 				// should not happen
 				error_print();
 				goto end;
@@ -309,7 +313,7 @@ bad:
 end:
 	// FIXME: clean ctx and connection ASAP, as Ctrl-C is not handled
 	if (sock != -1) tls_socket_close(sock);
-	tls_ctx_cleanup(&ctx);
 	tls_cleanup(&conn);
+	tls_ctx_cleanup(&ctx);
 	return ret;
 }
@@ -209,7 +209,7 @@ bad:
 
 end:
 	if (sock != -1) tls_socket_close(sock);
-	tls_ctx_cleanup(&ctx);
 	tls_cleanup(&conn);
+	tls_ctx_cleanup(&ctx);
 	return 0;
 }
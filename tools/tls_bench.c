@@ -0,0 +1,280 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <netdb.h>
+#include <netinet/in.h>
+#include <netinet/tcp.h>
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+static const char *usage =
+	"-protocol tlcp|tls13 -host str [-port num] [-cacert file]"
+	" [-threads num] [-duration seconds] [-records num] [-size num]";
+
+static const char *help =
+"Options\n"
+"\n"
+"    -protocol tlcp|tls13   Protocol of the server\n"
+"    -host str              Domain name or IP address of the server\n"
+"    -port num              Port number of the server, default 443\n"
+"    -cacert file           Trusted CA certificate(s), the server is not verified without it\n"
+"    -threads num           Client threads, each with one connection at a time, default 1\n"
+"    -duration seconds      Test time, default 10\n"
+"    -records num           Records echoed over every connection, default 1\n"
+"    -size num              Record payload size, default 1024, at most 16384\n"
+"\n"
+"  Connections are opened, handshaked, used for the records and closed in a loop,\n"
+"  the handshakes/s and records/s are reported when the time is up. Use\n"
+"  `-records 0` to measure full handshakes only, a large `-records` for the\n"
+"  record layer only.\n"
+"\n"
+"Examples\n"
+"\n"
+"  gmssl tls_bench -protocol tlcp -host 127.0.0.1 -port 4433 -threads 8 -records 0\n"
+"  gmssl tls_bench -protocol tls13 -host 127.0.0.1 -port 4433 -records 100000 -size 16384\n"
+"\n";
+
+typedef struct {
+	const TLS_CTX *ctx;
+	struct sockaddr_in addr;
+	int records;
+	size_t size;
+	double deadline;
+	pthread_t thread;
+	size_t handshakes;
+	size_t records_echoed;
+	size_t errors;
+} BENCH_THREAD;
+
+static double bench_now(void)
+{
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static int bench_connection(BENCH_THREAD *t, uint8_t *out, uint8_t *in)
+{
+	TLS_CONNECT conn;
+	int tls13 = t->ctx->protocol == TLS_protocol_tls13;
+	int sock;
+	int on = 1;
+	size_t len, n;
+	int i;
+	int ret = -1;
+
+	memset(&conn, 0, sizeof(conn));
+	if ((sock = socket(AF_INET, SOCK_STREAM, 0)) < 0) {
+		perror("socket");
+		return -1;
+	}
+	setsockopt(sock, IPPROTO_TCP, TCP_NODELAY, &on, sizeof(on));
+	if (connect(sock, (struct sockaddr *)&t->addr, sizeof(t->addr)) != 0) {
+		perror("connect");
+		goto end;
+	}
+	if (tls_init(&conn, t->ctx) != 1
+		|| tls_set_socket(&conn, sock) != 1
+		|| tls_do_handshake(&conn) != 1) {
+		goto end;
+	}
+	t->handshakes++;
+
+	for (i = 0; i < t->records && bench_now() < t->deadline; i++) {
+		if ((tls13 ? tls13_send(&conn, out, t->size, &len) : tls_send(&conn, out, t->size, &len)) != 1
+			|| len != t->size) {
+			goto end;
+		}
+		for (n = 0; n < t->size; n += len) {
+			if ((tls13 ? tls13_recv(&conn, in + n, t->size - n, &len)
+				: tls_recv(&conn, in + n, t->size - n, &len)) != 1) {
+				goto end;
+			}
+		}
+		if (memcmp(in, out, t->size) != 0) {
+			goto end;
+		}
+		t->records_echoed++;
+	}
+	ret = 1;
+end:
+	tls_cleanup(&conn);
+	close(sock);
+	return ret;
+}
+
+static void *bench_thread(void *arg)
+{
+	BENCH_THREAD *t = (BENCH_THREAD *)arg;
+	uint8_t out[TLS_MAX_PLAINTEXT_SIZE];
+	uint8_t in[TLS_MAX_PLAINTEXT_SIZE];
+
+	memset(out, 'A', sizeof(out));
+	while (bench_now() < t->deadline) {
+		if (bench_connection(t, out, in) != 1) {
+			t->errors++;
+		}
+	}
+	return NULL;
+}
+
+int tls_bench_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	int protocol = 0;
+	char *host = NULL;
+	int port = 443;
+	char *cacertfile = NULL;
+	int threads = 1;
+	int duration = 10;
+	int records = 1;
+	int size = 1024;
+	int tlcp_ciphers[] = { TLS_cipher_ecc_sm4_cbc_sm3, };
+	int tls13_ciphers[] = { TLS_cipher_sm4_gcm_sm3, };
+	TLS_CTX ctx;
+	struct hostent *hp;
+	BENCH_THREAD *t = NULL;
+	size_t handshakes = 0;
+	size_t records_echoed = 0;
+	size_t errors = 0;
+	double start, elapsed;
+	int i;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	argc--;
+	argv++;
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, usage);
+		return 1;
+	}
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, usage);
+			printf("%s\n", help);
+			return 0;
+		} else if (!strcmp(*argv, "-protocol")) {
+			if (--argc < 1) goto bad;
+			argv++;
+			if (!strcmp(*argv, "tlcp")) {
+				protocol = TLS_protocol_tlcp;
+			} else if (!strcmp(*argv, "tls13")) {
+				protocol = TLS_protocol_tls13;
+			} else {
+				fprintf(stderr, "%s: invalid protocol '%s'\n", prog, *argv);
+				return 1;
+			}
+		} else if (!strcmp(*argv, "-host")) {
+			if (--argc < 1) goto bad;
+			host = *(++argv);
+		} else if (!strcmp(*argv, "-port")) {
+			if (--argc < 1) goto bad;
+			port = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			cacertfile = *(++argv);
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-duration")) {
+			if (--argc < 1) goto bad;
+			duration = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-records")) {
+			if (--argc < 1) goto bad;
+			records = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-size")) {
+			if (--argc < 1) goto bad;
+			size = atoi(*(++argv));
+		} else {
+			fprintf(stderr, "%s: invalid option '%s'\n", prog, *argv);
+			return 1;
+bad:
+			fprintf(stderr, "%s: option '%s' argument required\n", prog, *argv);
+			return 1;
+		}
+		argc--;
+		argv++;
+	}
+	if (!protocol || !host) {
+		fprintf(stderr, "%s: '-protocol' and '-host' options required\n", prog);
+		return 1;
+	}
+	if (threads < 1 || duration < 1 || records < 0 || size < 1 || size > TLS_MAX_PLAINTEXT_SIZE) {
+		fprintf(stderr, "%s: invalid '-threads', '-duration', '-records' or '-size'\n", prog);
+		return 1;
+	}
+	if (!(hp = gethostbyname(host))) {
+		fprintf(stderr, "%s: invalid host '%s'\n", prog, host);
+		return 1;
+	}
+
+	if (tls_ctx_init(&ctx, protocol, TLS_client_mode) != 1
+		|| (protocol == TLS_protocol_tlcp
+			? tls_ctx_set_cipher_suites(&ctx, tlcp_ciphers, sizeof(tlcp_ciphers)/sizeof(int))
+			: tls_ctx_set_cipher_suites(&ctx, tls13_ciphers, sizeof(tls13_ciphers)/sizeof(int))) != 1) {
+		error_print();
+		goto end;
+	}
+	if (cacertfile) {
+		if (tls_ctx_set_ca_certificates(&ctx, cacertfile, TLS_DEFAULT_VERIFY_DEPTH) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ctx.quiet = 1;
+
+	if (!(t = (BENCH_THREAD *)calloc((size_t)threads, sizeof(BENCH_THREAD)))) {
+		error_print();
+		goto end;
+	}
+	start = bench_now();
+	for (i = 0; i < threads; i++) {
+		t[i].ctx = &ctx;
+		t[i].addr.sin_family = AF_INET;
+		t[i].addr.sin_port = htons(port);
+		memcpy(&t[i].addr.sin_addr, hp->h_addr_list[0], sizeof(t[i].addr.sin_addr));
+		t[i].records = records;
+		t[i].size = (size_t)size;
+		t[i].deadline = start + duration;
+		if (pthread_create(&t[i].thread, NULL, bench_thread, &t[i]) != 0) {
+			fprintf(stderr, "%s: create thread failure\n", prog);
+			threads = i;
+			break;
+		}
+	}
+	for (i = 0; i < threads; i++) {
+		pthread_join(t[i].thread, NULL);
+		handshakes += t[i].handshakes;
+		records_echoed += t[i].records_echoed;
+		errors += t[i].errors;
+	}
+	elapsed = bench_now() - start;
+
+	printf("%s %d threads, %.2f seconds\n", tls_protocol_name(protocol), threads, elapsed);
+	printf("handshakes   %zu (%.1f/s)\n", handshakes, handshakes / elapsed);
+	printf("records      %zu (%.1f/s, %.2f MB/s each way)\n", records_echoed, records_echoed / elapsed,
+		(double)records_echoed * size / elapsed / 1e6);
+	printf("errors       %zu\n", errors);
+	ret = errors ? 1 : 0;
+
+end:
+	free(t);
+	tls_ctx_cleanup(&ctx);
+	return ret;
+}
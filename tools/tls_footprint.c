@@ -0,0 +1,728 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+/*
+ * Memory footprint of TLS connections, the companion of `gmssl tls_speed`.
+ * It is a program of its own because it replaces malloc() and friends of the
+ * whole process with counting wrappers of the glibc allocator.
+ */
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#include <gmssl/sm2.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/tls.h>
+#include <gmssl/version.h>
+
+
+static const char *usage =
+	"[-protocol name]... [-json] [-out file]\n";
+
+static const char *options =
+"Options\n"
+"\n"
+"    -protocol name              tlcp, tls12 or tls13, repeat it or separate names by commas, default all\n"
+"    -json                       Output results as JSON\n"
+"    -out file                   Output file, default stdout\n"
+"\n"
+"Every handshake runs the client and the server in two threads over an in-memory\n"
+"transport. The columns of each side are\n"
+"\n"
+"    stack      Peak stack depth of the handshake, from the painted thread stack\n"
+"    allocs     malloc/calloc/realloc calls of the handshake\n"
+"    bytes      Bytes requested by these calls\n"
+"    peak       Peak heap held during the handshake\n"
+"    idle       sizeof(TLS_CONNECT) plus the heap an established connection keeps\n"
+"\n"
+"The measured handshakes follow one warm-up handshake of every protocol. The\n"
+"chain rows are one verification of the server certificate chain.\n"
+"\n";
+
+
+/*
+ * Counting allocator, the counters are per thread so that the client and the
+ * server threads see their own. Memory freed by another thread than the one
+ * that allocated it lowers the live bytes of the freeing thread.
+ */
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t nmemb, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void *__libc_memalign(size_t alignment, size_t size);
+extern void __libc_free(void *ptr);
+
+typedef struct {
+	uint64_t allocs;
+	uint64_t bytes;
+	int64_t live;
+	int64_t peak;
+} FOOTPRINT_HEAP;
+
+static __thread FOOTPRINT_HEAP footprint_heap;
+
+static void footprint_heap_add(void *ptr, size_t size)
+{
+	if (ptr) {
+		footprint_heap.allocs++;
+		footprint_heap.bytes += size;
+		footprint_heap.live += (int64_t)malloc_usable_size(ptr);
+		if (footprint_heap.live > footprint_heap.peak) {
+			footprint_heap.peak = footprint_heap.live;
+		}
+	}
+}
+
+static void footprint_heap_sub(void *ptr)
+{
+	if (ptr) {
+		footprint_heap.live -= (int64_t)malloc_usable_size(ptr);
+	}
+}
+
+void *malloc(size_t size)
+{
+	void *ptr = __libc_malloc(size);
+	footprint_heap_add(ptr, size);
+	return ptr;
+}
+
+void *calloc(size_t nmemb, size_t size)
+{
+	void *ptr = __libc_calloc(nmemb, size);
+	footprint_heap_add(ptr, nmemb * size);
+	return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+	size_t old_size = ptr ? malloc_usable_size(ptr) : 0;
+	void *new_ptr = __libc_realloc(ptr, size);
+
+	if (new_ptr) {
+		footprint_heap.live -= (int64_t)old_size;
+		footprint_heap_add(new_ptr, size);
+	}
+	return new_ptr;
+}
+
+void *memalign(size_t alignment, size_t size)
+{
+	void *ptr = __libc_memalign(alignment, size);
+	footprint_heap_add(ptr, size);
+	return ptr;
+}
+
+void *aligned_alloc(size_t alignment, size_t size)
+{
+	return memalign(alignment, size);
+}
+
+int posix_memalign(void **memptr, size_t alignment, size_t size)
+{
+	void *ptr;
+
+	if (!alignment || (alignment & (alignment - 1)) || alignment % sizeof(void *)) {
+		return EINVAL;
+	}
+	if (!(ptr = memalign(alignment, size))) {
+		return ENOMEM;
+	}
+	*memptr = ptr;
+	return 0;
+}
+
+void free(void *ptr)
+{
+	footprint_heap_sub(ptr);
+	__libc_free(ptr);
+}
+
+
+/*
+ * Threads on a painted stack, the untouched paint below the deepest frame
+ * tells the peak depth. The depth is counted from the first frame of the
+ * thread, so the TCB and TLS blocks glibc puts on top of the stack are not.
+ */
+#define FOOTPRINT_STACK_SIZE	(2 * 1024 * 1024)
+#define FOOTPRINT_STACK_PAINT	0xa5
+
+typedef struct {
+	pthread_t tid;
+	uint8_t *stack;
+	volatile uintptr_t entry;
+	void (*func)(void *arg);
+	void *arg;
+	size_t stack_used;
+} FOOTPRINT_THREAD;
+
+static void *footprint_thread_main(void *arg)
+{
+	FOOTPRINT_THREAD *t = (FOOTPRINT_THREAD *)arg;
+	volatile uint8_t marker = 0;
+
+	t->entry = (uintptr_t)&marker;
+	t->func(t->arg);
+	return NULL;
+}
+
+static int footprint_thread_start(FOOTPRINT_THREAD *t, void (*func)(void *), void *arg)
+{
+	pthread_attr_t attr;
+	void *stack;
+	int rv;
+
+	memset(t, 0, sizeof(*t));
+	if (posix_memalign(&stack, 4096, FOOTPRINT_STACK_SIZE) != 0) {
+		error_print();
+		return -1;
+	}
+	t->stack = (uint8_t *)stack;
+	t->func = func;
+	t->arg = arg;
+	memset(t->stack, FOOTPRINT_STACK_PAINT, FOOTPRINT_STACK_SIZE);
+
+	if (pthread_attr_init(&attr) != 0) {
+		free(t->stack);
+		error_print();
+		return -1;
+	}
+	rv = pthread_attr_setstack(&attr, t->stack, FOOTPRINT_STACK_SIZE);
+	if (rv == 0) {
+		rv = pthread_create(&t->tid, &attr, footprint_thread_main, t);
+	}
+	pthread_attr_destroy(&attr);
+	if (rv != 0) {
+		free(t->stack);
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static void footprint_thread_join(FOOTPRINT_THREAD *t)
+{
+	size_t i;
+
+	pthread_join(t->tid, NULL);
+	for (i = 0; i < FOOTPRINT_STACK_SIZE && t->stack[i] == FOOTPRINT_STACK_PAINT; i++) {
+	}
+	t->stack_used = t->entry - (uintptr_t)(t->stack + i);
+	free(t->stack);
+	t->stack = NULL;
+}
+
+
+typedef struct {
+	const char *name;
+	int protocol;
+	int cipher_suite;
+} FOOTPRINT_SUITE;
+
+static const FOOTPRINT_SUITE footprint_suites[] = {
+	{ "tlcp", TLS_protocol_tlcp, TLS_cipher_ecc_sm4_cbc_sm3 },
+	{ "tls12", TLS_protocol_tls12, TLS_cipher_ecdhe_sm4_cbc_sm3 },
+	{ "tls13", TLS_protocol_tls13, TLS_cipher_sm4_gcm_sm3 },
+};
+
+#define FOOTPRINT_SUITES_COUNT	(sizeof(footprint_suites)/sizeof(footprint_suites[0]))
+
+typedef struct {
+	uint8_t cacert[1024];
+	size_t cacertlen;
+	uint8_t certs[2048];
+	size_t certslen;
+	SM2_KEY sign_key;
+	SM2_KEY enc_key;
+} FOOTPRINT_CERTS;
+
+typedef struct {
+	size_t stack;
+	uint64_t allocs;
+	uint64_t bytes;
+	int64_t peak;
+	int64_t idle;
+} FOOTPRINT_RESULT;
+
+struct FOOTPRINT_JOB_st;
+
+typedef struct {
+	struct FOOTPRINT_JOB_st *job;
+	int is_client;
+	TLS_CONNECT conn; // not on the measured stack
+	FOOTPRINT_RESULT result;
+	int ret;
+} FOOTPRINT_SIDE;
+
+typedef struct FOOTPRINT_JOB_st {
+	const FOOTPRINT_SUITE *suite;
+	const FOOTPRINT_CERTS *certs;
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_SESSION_CACHE *cache;
+	TLS_SESSION session;
+	const TLS_SESSION *resume;
+	int get_session;
+	TLS_MEMORY_PAIR *pair;
+	FOOTPRINT_SIDE sides[2];
+} FOOTPRINT_JOB;
+
+static int footprint_gen_cert(const char *cn, SM2_KEY *key, const SM2_KEY *ca_key, const char *ca_cn,
+	int is_ca, int key_usage, uint8_t **out, size_t *outlen)
+{
+	uint8_t serial[4] = { 1, 2, 3, 4 };
+	uint8_t name[256];
+	uint8_t issuer[256];
+	size_t namelen, issuerlen;
+	uint8_t exts[512];
+	size_t extslen = 0;
+	time_t not_before, not_after;
+
+	if (sm2_key_generate(key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!ca_key) {
+		ca_key = key;
+		ca_cn = cn;
+	}
+	time(&not_before);
+	if (x509_validity_add_days(&not_after, not_before, 1) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", NULL, NULL, "GmSSL", NULL, cn) != 1
+		|| x509_name_set(issuer, &issuerlen, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, ca_cn) != 1
+		|| x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, key_usage) != 1) {
+		error_print();
+		return -1;
+	}
+	if (is_ca && x509_exts_add_basic_constraints(exts, &extslen, sizeof(exts), X509_critical, 1, -1) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_sign_to_der(X509_version_v3, serial, sizeof(serial), OID_sm2sign_with_sm3,
+		issuer, issuerlen, not_before, not_after, name, namelen, key,
+		NULL, 0, NULL, 0, exts, extslen, ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+		out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int footprint_certs_generate(FOOTPRINT_CERTS *certs, int protocol)
+{
+	SM2_KEY ca_key;
+	uint8_t *p;
+	int ret = -1;
+
+	memset(certs, 0, sizeof(*certs));
+	p = certs->cacert;
+	if (footprint_gen_cert("CA", &ca_key, NULL, NULL, 1,
+		X509_KU_KEY_CERT_SIGN|X509_KU_CRL_SIGN, &p, &certs->cacertlen) != 1) {
+		error_print();
+		goto end;
+	}
+	p = certs->certs;
+	if (footprint_gen_cert("server", &certs->sign_key, &ca_key, "CA", 0,
+		X509_KU_DIGITAL_SIGNATURE, &p, &certs->certslen) != 1) {
+		error_print();
+		goto end;
+	}
+	if (protocol == TLS_protocol_tlcp) {
+		if (footprint_gen_cert("server-enc", &certs->enc_key, &ca_key, "CA", 0,
+			X509_KU_KEY_ENCIPHERMENT|X509_KU_DATA_ENCIPHERMENT|X509_KU_KEY_AGREEMENT,
+			&p, &certs->certslen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+end:
+	gmssl_secure_clear(&ca_key, sizeof(ca_key));
+	return ret;
+}
+
+static int footprint_ctx_init(FOOTPRINT_JOB *job)
+{
+	const FOOTPRINT_SUITE *suite = job->suite;
+	const FOOTPRINT_CERTS *certs = job->certs;
+
+	if (tls_ctx_init(&job->client_ctx, suite->protocol, TLS_client_mode) != 1
+		|| tls_ctx_init(&job->server_ctx, suite->protocol, TLS_server_mode) != 1
+		|| tls_ctx_set_cipher_suites(&job->client_ctx, &suite->cipher_suite, 1) != 1
+		|| tls_ctx_set_cipher_suites(&job->server_ctx, &suite->cipher_suite, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	// TLCP clients do not verify the server certificates
+	if (suite->protocol != TLS_protocol_tlcp) {
+		if (!(job->client_ctx.cacerts = (uint8_t *)malloc(certs->cacertlen))) {
+			error_print();
+			return -1;
+		}
+		memcpy(job->client_ctx.cacerts, certs->cacert, certs->cacertlen);
+		job->client_ctx.cacertslen = certs->cacertlen;
+	}
+	if (!(job->server_ctx.certs = (uint8_t *)malloc(certs->certslen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(job->server_ctx.certs, certs->certs, certs->certslen);
+	job->server_ctx.certslen = certs->certslen;
+	job->server_ctx.signkey = certs->sign_key;
+	job->server_ctx.kenckey = certs->enc_key;
+	job->client_ctx.quiet = 1;
+	job->server_ctx.quiet = 1;
+
+	if (suite->protocol == TLS_protocol_tls13) {
+		if (tls_ctx_set_session_ticket_key(&job->server_ctx, NULL, 0) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (!(job->cache = tls_session_cache_new(64, TLS_SESSION_CACHE_TIMEOUT))
+			|| tls_ctx_set_session_cache(&job->server_ctx, job->cache) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static void footprint_side_run(void *arg)
+{
+	FOOTPRINT_SIDE *side = (FOOTPRINT_SIDE *)arg;
+	FOOTPRINT_JOB *job = side->job;
+	TLS_CONNECT *conn = &side->conn;
+	TLS_TRANSPORT transport;
+	int tls13 = job->suite->protocol == TLS_protocol_tls13;
+	uint8_t buf[16];
+	size_t len;
+
+	side->ret = -1;
+	memset(&footprint_heap, 0, sizeof(footprint_heap));
+
+	if (tls_init(conn, side->is_client ? &job->client_ctx : &job->server_ctx) != 1
+		|| tls_memory_pair_get_transport(job->pair, side->is_client ? 0 : 1, &transport) != 1
+		|| tls_set_transport(conn, &transport) != 1
+		|| (side->is_client && job->resume && tls_set_session(conn, job->resume) != 1)
+		|| tls_do_handshake(conn) != 1) {
+		error_print();
+		goto end;
+	}
+	side->result.allocs = footprint_heap.allocs;
+	side->result.bytes = footprint_heap.bytes;
+	side->result.peak = footprint_heap.peak;
+	side->result.idle = (int64_t)sizeof(TLS_CONNECT) + footprint_heap.live;
+
+	if (job->get_session) {
+		// the TLS 1.3 client reads the NewSessionTicket before the record after it
+		if (tls13) {
+			if (side->is_client) {
+				if (tls13_recv(conn, buf, sizeof(buf), &len) != 1) {
+					error_print();
+					goto end;
+				}
+			} else if (tls13_send(conn, (uint8_t *)"x", 1, &len) != 1) {
+				error_print();
+				goto end;
+			}
+		}
+		if (side->is_client && tls_get_session(conn, &job->session) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	side->ret = 1;
+end:
+	tls_cleanup(conn);
+	// a failed side ends the handshake of the other one
+	if (side->ret != 1) {
+		tls_memory_pair_close(job->pair, side->is_client ? 0 : 1);
+	}
+}
+
+static int footprint_handshake(FOOTPRINT_JOB *job, const TLS_SESSION *resume, int get_session)
+{
+	FOOTPRINT_THREAD threads[2];
+	int started = 0;
+	int ret = -1;
+	int i;
+
+	job->resume = resume;
+	job->get_session = get_session;
+	if (!(job->pair = tls_memory_pair_new(1))) {
+		error_print();
+		return -1;
+	}
+	for (i = 0; i < 2; i++) {
+		memset(&job->sides[i], 0, sizeof(FOOTPRINT_SIDE));
+		job->sides[i].job = job;
+		job->sides[i].is_client = (i == 0);
+		if (footprint_thread_start(&threads[i], footprint_side_run, &job->sides[i]) != 1) {
+			error_print();
+			tls_memory_pair_close(job->pair, 0);
+			tls_memory_pair_close(job->pair, 1);
+			break;
+		}
+		started++;
+	}
+	for (i = 0; i < started; i++) {
+		footprint_thread_join(&threads[i]);
+		job->sides[i].result.stack = threads[i].stack_used;
+	}
+	if (started == 2 && job->sides[0].ret == 1 && job->sides[1].ret == 1) {
+		ret = 1;
+	}
+	tls_memory_pair_free(job->pair);
+	job->pair = NULL;
+	return ret;
+}
+
+typedef struct {
+	const FOOTPRINT_SUITE *suite;
+	const FOOTPRINT_CERTS *certs;
+	FOOTPRINT_RESULT result;
+	int ret;
+} FOOTPRINT_CHAIN;
+
+static void footprint_chain_run(void *arg)
+{
+	FOOTPRINT_CHAIN *chain = (FOOTPRINT_CHAIN *)arg;
+	const FOOTPRINT_CERTS *certs = chain->certs;
+	int verify_result;
+	int rv;
+
+	memset(&footprint_heap, 0, sizeof(footprint_heap));
+	if (chain->suite->protocol == TLS_protocol_tlcp) {
+		rv = x509_certs_verify_tlcp(certs->certs, certs->certslen, X509_cert_chain_server,
+			certs->cacert, certs->cacertlen, X509_MAX_VERIFY_DEPTH, &verify_result);
+	} else {
+		rv = x509_certs_verify(certs->certs, certs->certslen, X509_cert_chain_server,
+			certs->cacert, certs->cacertlen, X509_MAX_VERIFY_DEPTH, &verify_result);
+	}
+	chain->ret = rv == 1 ? 1 : -1;
+	chain->result.allocs = footprint_heap.allocs;
+	chain->result.bytes = footprint_heap.bytes;
+	chain->result.peak = footprint_heap.peak;
+}
+
+static int footprint_chain(FOOTPRINT_CHAIN *chain)
+{
+	FOOTPRINT_THREAD thread;
+
+	chain->ret = -1;
+	if (footprint_thread_start(&thread, footprint_chain_run, chain) != 1) {
+		error_print();
+		return -1;
+	}
+	footprint_thread_join(&thread);
+	chain->result.stack = thread.stack_used;
+	return chain->ret;
+}
+
+static int footprint_protocol_selected(const char *name, const char *names)
+{
+	const char *p = names;
+
+	while (*p) {
+		size_t n = strcspn(p, ",");
+		if (n == strlen(name) && !strncmp(name, p, n)) {
+			return 1;
+		}
+		p += n;
+		if (*p == ',') {
+			p++;
+		}
+	}
+	return 0;
+}
+
+static void footprint_print(FILE *outfp, int json, int *first, const FOOTPRINT_SUITE *suite,
+	const char *mode, const char *side, const FOOTPRINT_RESULT *r, int has_idle)
+{
+	if (json) {
+		fprintf(outfp, "%s\n    {\"protocol\": \"%s\", \"cipher_suite\": \"%s\", \"mode\": \"%s\", \"side\": \"%s\", "
+			"\"stack\": %zu, \"allocs\": %llu, \"bytes\": %llu, \"peak\": %lld",
+			*first ? "" : ",", suite->name, tls_cipher_suite_name(suite->cipher_suite), mode, side,
+			r->stack, (unsigned long long)r->allocs, (unsigned long long)r->bytes, (long long)r->peak);
+		if (has_idle) {
+			fprintf(outfp, ", \"idle\": %lld", (long long)r->idle);
+		}
+		fprintf(outfp, "}");
+		*first = 0;
+	} else {
+		char idle[24] = "-";
+		if (has_idle) {
+			snprintf(idle, sizeof(idle), "%lld", (long long)r->idle);
+		}
+		fprintf(outfp, "%-6s %-24s %-8s %-6s %8zu %7llu %9llu %9lld %9s\n",
+			suite->name, tls_cipher_suite_name(suite->cipher_suite), mode, side,
+			r->stack, (unsigned long long)r->allocs, (unsigned long long)r->bytes,
+			(long long)r->peak, idle);
+	}
+	fflush(outfp);
+}
+
+int main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *names[FOOTPRINT_SUITES_COUNT * 2];
+	int names_cnt = 0;
+	int json = 0;
+	char *outfile = NULL;
+	FILE *outfp = stdout;
+	FOOTPRINT_CERTS certs;
+	FOOTPRINT_JOB *job = NULL;
+	FOOTPRINT_CHAIN chain;
+	int first = 1;
+	size_t s;
+	int i;
+
+	memset(&certs, 0, sizeof(certs));
+
+	argc--;
+	argv++;
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: %s %s\n", prog, usage);
+			printf("%s\n", options);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-protocol")) {
+			if (--argc < 1) goto bad;
+			if (names_cnt >= (int)(sizeof(names)/sizeof(names[0]))) {
+				fprintf(stderr, "%s: too many `-protocol` options\n", prog);
+				goto end;
+			}
+			names[names_cnt++] = *(++argv);
+		} else if (!strcmp(*argv, "-json")) {
+			json = 1;
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "%s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "%s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "%s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	for (i = 0; i < names_cnt; i++) {
+		for (s = 0; s < FOOTPRINT_SUITES_COUNT; s++) {
+			if (footprint_protocol_selected(footprint_suites[s].name, names[i])) {
+				break;
+			}
+		}
+		if (s == FOOTPRINT_SUITES_COUNT) {
+			fprintf(stderr, "%s: unknown protocol '%s'\n", prog, names[i]);
+			goto end;
+		}
+	}
+
+	if (!(job = (FOOTPRINT_JOB *)malloc(sizeof(FOOTPRINT_JOB)))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
+
+	if (json) {
+		fprintf(outfp, "{\n");
+		fprintf(outfp, "  \"version\": \"%s\",\n", gmssl_version_str());
+		fprintf(outfp, "  \"sizeof_tls_connect\": %zu,\n", sizeof(TLS_CONNECT));
+		fprintf(outfp, "  \"results\": [");
+	} else {
+		fprintf(outfp, "sizeof(TLS_CONNECT) = %zu\n", sizeof(TLS_CONNECT));
+		fprintf(outfp, "%-6s %-24s %-8s %-6s %8s %7s %9s %9s %9s\n",
+			"proto", "cipher_suite", "mode", "side", "stack", "allocs", "bytes", "peak", "idle");
+	}
+
+	for (s = 0; s < FOOTPRINT_SUITES_COUNT; s++) {
+		const FOOTPRINT_SUITE *suite = &footprint_suites[s];
+		int selected = names_cnt ? 0 : 1;
+		int rv;
+
+		for (i = 0; i < names_cnt; i++) {
+			if (footprint_protocol_selected(suite->name, names[i])) {
+				selected = 1;
+			}
+		}
+		if (!selected) {
+			continue;
+		}
+		if (footprint_certs_generate(&certs, suite->protocol) != 1) {
+			fprintf(stderr, "%s: certificate generation failure\n", prog);
+			goto end;
+		}
+
+		memset(job, 0, sizeof(FOOTPRINT_JOB));
+		job->suite = suite;
+		job->certs = &certs;
+		rv = footprint_ctx_init(job);
+		// the first handshake fills the tables the process builds once
+		if (rv == 1) {
+			rv = footprint_handshake(job, NULL, 0);
+		}
+		// the full handshake also gets the session of the resumed one
+		if (rv == 1 && (rv = footprint_handshake(job, NULL, 1)) == 1) {
+			footprint_print(outfp, json, &first, suite, "full", "client", &job->sides[0].result, 1);
+			footprint_print(outfp, json, &first, suite, "full", "server", &job->sides[1].result, 1);
+			rv = footprint_handshake(job, &job->session, 0);
+		}
+		if (rv == 1) {
+			footprint_print(outfp, json, &first, suite, "resumed", "client", &job->sides[0].result, 1);
+			footprint_print(outfp, json, &first, suite, "resumed", "server", &job->sides[1].result, 1);
+		}
+		tls_session_cache_free(job->cache);
+		tls_ctx_cleanup(&job->client_ctx);
+		tls_ctx_cleanup(&job->server_ctx);
+		gmssl_secure_clear(&job->session, sizeof(job->session));
+		if (rv != 1) {
+			fprintf(stderr, "%s: %s handshake failure\n", prog, suite->name);
+			goto end;
+		}
+
+		memset(&chain, 0, sizeof(chain));
+		chain.suite = suite;
+		chain.certs = &certs;
+		if (footprint_chain(&chain) != 1) {
+			fprintf(stderr, "%s: %s certificate chain verification failure\n", prog, suite->name);
+			goto end;
+		}
+		footprint_print(outfp, json, &first, suite, "chain", "client", &chain.result, 0);
+	}
+
+	if (json) {
+		fprintf(outfp, "\n  ]\n}\n");
+	}
+	ret = 0;
+
+end:
+	gmssl_secure_clear(&certs, sizeof(certs));
+	if (job) free(job);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
@@ -0,0 +1,203 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#ifdef _WIN32
+#include <windows.h>
+#define sleep(seconds)	Sleep((seconds) * 1000)
+#else
+#include <unistd.h>
+#endif
+#include <gmssl/tls.h>
+#include <gmssl/error.h>
+
+
+static const char *usage =
+	"-protocol tlcp|tls13 [-port num] -cert file -key file -pass str"
+	" [-ex_key file -ex_pass str] [-cacert file] [-threads num] [-duration seconds]";
+
+static const char *help =
+"Options\n"
+"\n"
+"    -protocol tlcp|tls13   Protocol of the server\n"
+"    -port num              Listening port, default 443\n"
+"    -cert file             Server certificate(s) in PEM format, TLCP signing and encryption certificates\n"
+"    -key file              Private key of the (signing) certificate\n"
+"    -pass str              Password of the encrypted private key\n"
+"    -ex_key file           TLCP encryption private key\n"
+"    -ex_pass str           Password of the TLCP encryption private key\n"
+"    -cacert file           CA certificate(s) to verify client certificates\n"
+"    -threads num           Event loops, default one per online CPU\n"
+"    -duration seconds      Stop after the given time, default run forever\n"
+"\n"
+"  Every connection echoes the received records. The numbers of handshakes and\n"
+"  records per second are printed every second.\n"
+"\n"
+"Examples\n"
+"\n"
+"  gmssl tls_server -protocol tlcp -port 4433 -cert certs.pem -key signkey.pem -pass P@ssw0rd \\\n"
+"      -ex_key enckey.pem -ex_pass P@ssw0rd\n"
+"  gmssl tls_bench -protocol tlcp -host 127.0.0.1 -port 4433 -threads 4 -duration 10\n"
+"\n";
+
+int tls_server_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	int protocol = 0;
+	int port = 443;
+	char *certfile = NULL;
+	char *keyfile = NULL;
+	char *pass = NULL;
+	char *enckeyfile = NULL;
+	char *encpass = NULL;
+	char *cacertfile = NULL;
+	int threads = 0;
+	int duration = 0;
+	int tlcp_ciphers[] = { TLS_cipher_ecc_sm4_cbc_sm3, };
+	int tls13_ciphers[] = { TLS_cipher_sm4_gcm_sm3, };
+	TLS_CTX ctx;
+	TLS_SERVER *server = NULL;
+	TLS_SERVER_STATS stats;
+	TLS_SERVER_STATS last;
+	int seconds;
+
+	memset(&ctx, 0, sizeof(ctx));
+
+	argc--;
+	argv++;
+	if (argc < 1) {
+		fprintf(stderr, "usage: gmssl %s %s\n", prog, usage);
+		return 1;
+	}
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n\n", prog, usage);
+			printf("%s\n", help);
+			return 0;
+		} else if (!strcmp(*argv, "-protocol")) {
+			if (--argc < 1) goto bad;
+			argv++;
+			if (!strcmp(*argv, "tlcp")) {
+				protocol = TLS_protocol_tlcp;
+			} else if (!strcmp(*argv, "tls13")) {
+				protocol = TLS_protocol_tls13;
+			} else {
+				fprintf(stderr, "%s: invalid protocol '%s'\n", prog, *argv);
+				return 1;
+			}
+		} else if (!strcmp(*argv, "-port")) {
+			if (--argc < 1) goto bad;
+			port = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-cert")) {
+			if (--argc < 1) goto bad;
+			certfile = *(++argv);
+		} else if (!strcmp(*argv, "-key")) {
+			if (--argc < 1) goto bad;
+			keyfile = *(++argv);
+		} else if (!strcmp(*argv, "-pass")) {
+			if (--argc < 1) goto bad;
+			pass = *(++argv);
+		} else if (!strcmp(*argv, "-ex_key")) {
+			if (--argc < 1) goto bad;
+			enckeyfile = *(++argv);
+		} else if (!strcmp(*argv, "-ex_pass")) {
+			if (--argc < 1) goto bad;
+			encpass = *(++argv);
+		} else if (!strcmp(*argv, "-cacert")) {
+			if (--argc < 1) goto bad;
+			cacertfile = *(++argv);
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			threads = atoi(*(++argv));
+		} else if (!strcmp(*argv, "-duration")) {
+			if (--argc < 1) goto bad;
+			duration = atoi(*(++argv));
+		} else {
+			fprintf(stderr, "%s: invalid option '%s'\n", prog, *argv);
+			return 1;
+bad:
+			fprintf(stderr, "%s: option '%s' argument required\n", prog, *argv);
+			return 1;
+		}
+		argc--;
+		argv++;
+	}
+	if (!protocol) {
+		fprintf(stderr, "%s: '-protocol' option required\n", prog);
+		return 1;
+	}
+	if (!certfile || !keyfile || !pass) {
+		fprintf(stderr, "%s: '-cert', '-key' and '-pass' options required\n", prog);
+		return 1;
+	}
+	if (protocol == TLS_protocol_tlcp && (!enckeyfile || !encpass)) {
+		fprintf(stderr, "%s: '-ex_key' and '-ex_pass' options required by TLCP\n", prog);
+		return 1;
+	}
+	if (threads < 0 || duration < 0) {
+		fprintf(stderr, "%s: invalid '-threads' or '-duration'\n", prog);
+		return 1;
+	}
+
+	if (protocol == TLS_protocol_tlcp) {
+		if (tls_ctx_init(&ctx, TLS_protocol_tlcp, TLS_server_mode) != 1
+			|| tls_ctx_set_cipher_suites(&ctx, tlcp_ciphers, sizeof(tlcp_ciphers)/sizeof(int)) != 1
+			|| tls_ctx_set_tlcp_server_certificate_and_keys(&ctx, certfile, keyfile, pass, enckeyfile, encpass) != 1) {
+			error_print();
+			goto end;
+		}
+	} else {
+		if (tls_ctx_init(&ctx, TLS_protocol_tls13, TLS_server_mode) != 1
+			|| tls_ctx_set_cipher_suites(&ctx, tls13_ciphers, sizeof(tls13_ciphers)/sizeof(int)) != 1
+			|| tls_ctx_set_certificate_and_key(&ctx, certfile, keyfile, pass) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	if (cacertfile) {
+		if (tls_ctx_set_ca_certificates(&ctx, cacertfile, TLS_DEFAULT_VERIFY_DEPTH) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ctx.quiet = 1;
+
+	if (!(server = tls_server_new(&ctx, port, (size_t)threads))
+		|| tls_server_start(server) != 1) {
+		fprintf(stderr, "%s: start server failure\n", prog);
+		goto end;
+	}
+	fprintf(stderr, "%s: listening on port %d\n", prog, tls_server_get_port(server));
+
+	memset(&last, 0, sizeof(last));
+	for (seconds = 1; !duration || seconds <= duration; seconds++) {
+		sleep(1);
+		if (tls_server_get_stats(server, &stats) != 1) {
+			error_print();
+			goto end;
+		}
+		printf("%4ds  handshakes/s %6zu  records/s %8zu  active %6zu  errors %zu\n", seconds,
+			stats.handshakes - last.handshakes,
+			(stats.records_received + stats.records_sent) - (last.records_received + last.records_sent),
+			stats.connections_active, stats.errors);
+		fflush(stdout);
+		last = stats;
+	}
+	ret = 0;
+
+end:
+	tls_server_free(server);
+	tls_ctx_cleanup(&ctx);
+	return ret;
+}
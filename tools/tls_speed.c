@@ -0,0 +1,811 @@
+/*
+ *  Copyright 2014-2024 The GmSSL Project. All Rights Reserved.
+ *
+ *  Licensed under the Apache License, Version 2.0 (the License); you may
+ *  not use this file except in compliance with the License.
+ *
+ *  http://www.apache.org/licenses/LICENSE-2.0
+ */
+
+
+#include <stdio.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <time.h>
+#include <gmssl/mem.h>
+#include <gmssl/error.h>
+#include <gmssl/sm2.h>
+#include <gmssl/oid.h>
+#include <gmssl/x509.h>
+#include <gmssl/x509_ext.h>
+#include <gmssl/tls.h>
+#include <gmssl/version.h>
+#ifdef _WIN32
+#include <windows.h>
+#include <process.h>
+#else
+#include <pthread.h>
+#endif
+
+
+static const char *usage =
+	"[-protocol name]... [-full] [-resumed] [-seconds num] [-threads list] [-json] [-out file]\n";
+
+static const char *options =
+"Options\n"
+"\n"
+"    -protocol name              tlcp, tls12 or tls13, repeat it or separate names by commas, default all\n"
+"    -full                       Run the full handshakes only\n"
+"    -resumed                    Run the resumed handshakes only\n"
+"    -seconds num                Measured time of every run in seconds, default 1\n"
+"    -threads list               Thread counts of the scaling runs, e.g. 1,2,4,8, default 1\n"
+"    -json                       Output results as JSON\n"
+"    -out file                   Output file, default stdout\n"
+"\n"
+"The client and the server of every handshake run in the same process over an\n"
+"in-memory transport, the handshakes/s of one thread is the rate of one core doing\n"
+"both sides. The phase columns are the microseconds per handshake spent by the\n"
+"client/server in the key exchange, signatures, certificate chain verification\n"
+"and key schedule, the rest is message encoding, hashing and record processing.\n"
+"TLS 1.2 handshakes are blocking, their server runs in a second thread.\n"
+"\n"
+"Examples\n"
+"\n"
+"    $ gmssl tls_speed\n"
+"    $ gmssl tls_speed -protocol tlcp,tls13 -resumed -threads 1,2,4\n"
+"    $ gmssl tls_speed -json -out tls_bench.json\n"
+"\n";
+
+
+#define TLS_SPEED_MAX_THREADS	256
+#define TLS_SPEED_MAX_ROUNDS	1000 // tls_do_handshake() calls of a non-blocking handshake
+
+typedef struct {
+	const char *name;
+	int protocol;
+	int cipher_suite;
+} TLS_SPEED_SUITE;
+
+// the cipher suites implemented by every protocol
+static const TLS_SPEED_SUITE tls_speed_suites[] = {
+	{ "tlcp", TLS_protocol_tlcp, TLS_cipher_ecc_sm4_cbc_sm3 },
+	{ "tls12", TLS_protocol_tls12, TLS_cipher_ecdhe_sm4_cbc_sm3 },
+	{ "tls13", TLS_protocol_tls13, TLS_cipher_sm4_gcm_sm3 },
+};
+
+#define TLS_SPEED_SUITES_COUNT	(sizeof(tls_speed_suites)/sizeof(tls_speed_suites[0]))
+
+// CA certificate of the client, server signing (and TLCP encryption) certificate
+typedef struct {
+	uint8_t cacert[1024];
+	size_t cacertlen;
+	uint8_t certs[2048];
+	size_t certslen;
+	SM2_KEY sign_key;
+	SM2_KEY enc_key;
+} TLS_SPEED_CERTS;
+
+typedef struct {
+	const TLS_SPEED_SUITE *suite;
+	const TLS_SPEED_CERTS *certs;
+	int resumed;
+	double seconds;
+
+	TLS_CTX client_ctx;
+	TLS_CTX server_ctx;
+	TLS_SESSION_CACHE *cache;
+	TLS_SESSION session;
+
+	// blocking TLS 1.2, the server thread handles a handshake for every byte 1 received
+	TLS_MEMORY_PAIR *pair;
+	int server_ret;
+
+	uint64_t handshakes;
+	double elapsed;
+	TLS_HANDSHAKE_STATS client_stats;
+	TLS_HANDSHAKE_STATS server_stats;
+	int ret;
+} TLS_SPEED_JOB;
+
+
+static double tls_speed_now(void)
+{
+#ifdef _WIN32
+	LARGE_INTEGER freq, counter;
+	QueryPerformanceFrequency(&freq);
+	QueryPerformanceCounter(&counter);
+	return (double)counter.QuadPart / (double)freq.QuadPart;
+#else
+	struct timespec ts;
+	clock_gettime(CLOCK_MONOTONIC, &ts);
+	return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+#endif
+}
+
+static int tls_speed_gen_cert(const char *cn, SM2_KEY *key, const SM2_KEY *ca_key, const char *ca_cn,
+	int is_ca, int key_usage, uint8_t **out, size_t *outlen)
+{
+	uint8_t serial[4] = { 1, 2, 3, 4 };
+	uint8_t name[256];
+	uint8_t issuer[256];
+	size_t namelen, issuerlen;
+	uint8_t exts[512];
+	size_t extslen = 0;
+	time_t not_before, not_after;
+
+	if (sm2_key_generate(key) != 1) {
+		error_print();
+		return -1;
+	}
+	if (!ca_key) {
+		ca_key = key;
+		ca_cn = cn;
+	}
+	time(&not_before);
+	if (x509_validity_add_days(&not_after, not_before, 1) != 1
+		|| x509_name_set(name, &namelen, sizeof(name), "CN", NULL, NULL, "GmSSL", NULL, cn) != 1
+		|| x509_name_set(issuer, &issuerlen, sizeof(issuer), "CN", NULL, NULL, "GmSSL", NULL, ca_cn) != 1
+		|| x509_exts_add_key_usage(exts, &extslen, sizeof(exts), X509_critical, key_usage) != 1) {
+		error_print();
+		return -1;
+	}
+	if (is_ca && x509_exts_add_basic_constraints(exts, &extslen, sizeof(exts), X509_critical, 1, -1) != 1) {
+		error_print();
+		return -1;
+	}
+	if (x509_cert_sign_to_der(X509_version_v3, serial, sizeof(serial), OID_sm2sign_with_sm3,
+		issuer, issuerlen, not_before, not_after, name, namelen, key,
+		NULL, 0, NULL, 0, exts, extslen, ca_key, SM2_DEFAULT_ID, SM2_DEFAULT_ID_LENGTH,
+		out, outlen) != 1) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+static int tls_speed_certs_generate(TLS_SPEED_CERTS *certs, int protocol)
+{
+	SM2_KEY ca_key;
+	uint8_t *p;
+	int ret = -1;
+
+	memset(certs, 0, sizeof(*certs));
+	p = certs->cacert;
+	if (tls_speed_gen_cert("CA", &ca_key, NULL, NULL, 1,
+		X509_KU_KEY_CERT_SIGN|X509_KU_CRL_SIGN, &p, &certs->cacertlen) != 1) {
+		error_print();
+		goto end;
+	}
+	p = certs->certs;
+	if (tls_speed_gen_cert("server", &certs->sign_key, &ca_key, "CA", 0,
+		X509_KU_DIGITAL_SIGNATURE, &p, &certs->certslen) != 1) {
+		error_print();
+		goto end;
+	}
+	if (protocol == TLS_protocol_tlcp) {
+		if (tls_speed_gen_cert("server-enc", &certs->enc_key, &ca_key, "CA", 0,
+			X509_KU_KEY_ENCIPHERMENT|X509_KU_DATA_ENCIPHERMENT|X509_KU_KEY_AGREEMENT,
+			&p, &certs->certslen) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	ret = 1;
+end:
+	gmssl_secure_clear(&ca_key, sizeof(ca_key));
+	return ret;
+}
+
+static int tls_speed_ctx_init(TLS_SPEED_JOB *job)
+{
+	const TLS_SPEED_SUITE *suite = job->suite;
+	const TLS_SPEED_CERTS *certs = job->certs;
+
+	if (tls_ctx_init(&job->client_ctx, suite->protocol, TLS_client_mode) != 1
+		|| tls_ctx_init(&job->server_ctx, suite->protocol, TLS_server_mode) != 1
+		|| tls_ctx_set_cipher_suites(&job->client_ctx, &suite->cipher_suite, 1) != 1
+		|| tls_ctx_set_cipher_suites(&job->server_ctx, &suite->cipher_suite, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	// TLCP clients do not verify the server certificates
+	if (suite->protocol != TLS_protocol_tlcp) {
+		if (!(job->client_ctx.cacerts = (uint8_t *)malloc(certs->cacertlen))) {
+			error_print();
+			return -1;
+		}
+		memcpy(job->client_ctx.cacerts, certs->cacert, certs->cacertlen);
+		job->client_ctx.cacertslen = certs->cacertlen;
+	}
+	if (!(job->server_ctx.certs = (uint8_t *)malloc(certs->certslen))) {
+		error_print();
+		return -1;
+	}
+	memcpy(job->server_ctx.certs, certs->certs, certs->certslen);
+	job->server_ctx.certslen = certs->certslen;
+	job->server_ctx.signkey = certs->sign_key;
+	job->server_ctx.kenckey = certs->enc_key;
+	job->client_ctx.quiet = 1;
+	job->server_ctx.quiet = 1;
+
+	if (suite->protocol == TLS_protocol_tls13) {
+		if (tls_ctx_set_session_ticket_key(&job->server_ctx, NULL, 0) != 1) {
+			error_print();
+			return -1;
+		}
+	} else {
+		if (!(job->cache = tls_session_cache_new(64, TLS_SESSION_CACHE_TIMEOUT))
+			|| tls_ctx_set_session_cache(&job->server_ctx, job->cache) != 1) {
+			error_print();
+			return -1;
+		}
+	}
+	return 1;
+}
+
+static int tls_speed_conn_init(TLS_CONNECT *conn, const TLS_CTX *ctx,
+	TLS_MEMORY_PAIR *pair, int end, TLS_HANDSHAKE_STATS *stats)
+{
+	TLS_TRANSPORT transport;
+
+	memset(conn, 0, sizeof(*conn));
+	if (tls_init(conn, ctx) != 1
+		|| tls_memory_pair_get_transport(pair, end, &transport) != 1
+		|| tls_set_transport(conn, &transport) != 1
+		|| (stats && tls_set_handshake_stats(conn, stats) != 1)) {
+		error_print();
+		return -1;
+	}
+	return 1;
+}
+
+// TLCP and TLS 1.3, the client and the server take turns in the calling thread
+static int tls_speed_handshake_non_blocking(TLS_SPEED_JOB *job, const TLS_SESSION *session,
+	int get_session, int *reused)
+{
+	TLS_MEMORY_PAIR *pair = NULL;
+	TLS_CONNECT client;
+	TLS_CONNECT server;
+	TLS_HANDSHAKE_STATS *client_stats = get_session ? NULL : &job->client_stats;
+	TLS_HANDSHAKE_STATS *server_stats = get_session ? NULL : &job->server_stats;
+	int client_done = 0;
+	int server_done = 0;
+	int rv;
+	int i;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	memset(&server, 0, sizeof(server));
+	if (!(pair = tls_memory_pair_new(0))
+		|| tls_speed_conn_init(&client, &job->client_ctx, pair, 0, client_stats) != 1
+		|| tls_speed_conn_init(&server, &job->server_ctx, pair, 1, server_stats) != 1
+		|| (session && tls_set_session(&client, session) != 1)) {
+		error_print();
+		goto end;
+	}
+	for (i = 0; i < TLS_SPEED_MAX_ROUNDS && !(client_done && server_done); i++) {
+		if (!client_done) {
+			if ((rv = tls_do_handshake(&client)) == 1) {
+				client_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				goto end;
+			}
+		}
+		if (!server_done) {
+			if ((rv = tls_do_handshake(&server)) == 1) {
+				server_done = 1;
+			} else if (rv != TLS_ERROR_WANT_READ && rv != TLS_ERROR_WANT_WRITE) {
+				error_print();
+				goto end;
+			}
+		}
+	}
+	if (!client_done || !server_done) {
+		error_print();
+		goto end;
+	}
+	if (get_session) {
+		// the TLS 1.3 client reads the NewSessionTicket with the next record
+		if (job->suite->protocol == TLS_protocol_tls13) {
+			uint8_t buf[16];
+			size_t len;
+			if (tls13_recv(&client, buf, sizeof(buf), &len) != TLS_ERROR_WANT_READ) {
+				error_print();
+				goto end;
+			}
+		}
+		if (tls_get_session(&client, &job->session) != 1) {
+			error_print();
+			goto end;
+		}
+	}
+	*reused = tls_session_reused(&client) && tls_session_reused(&server);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	tls_cleanup(&server);
+	tls_memory_pair_free(pair);
+	return ret;
+}
+
+static void tls_speed_server_loop(TLS_SPEED_JOB *job)
+{
+	TLS_TRANSPORT transport;
+	TLS_CONNECT server;
+	uint8_t cmd = 1;
+
+	job->server_ret = -1;
+	tls_memory_pair_get_transport(job->pair, 1, &transport);
+	while (transport.recv(transport.arg, &cmd, 1) == 1 && cmd == 1) {
+		// the first handshake only gets the session for the resumed handshakes
+		TLS_HANDSHAKE_STATS *stats = job->server_ret == -1 && job->resumed ? NULL : &job->server_stats;
+		int rv;
+
+		if (tls_speed_conn_init(&server, &job->server_ctx, job->pair, 1, stats) != 1) {
+			error_print();
+			break;
+		}
+		rv = tls_do_handshake(&server);
+		tls_cleanup(&server);
+		if (rv != 1) {
+			error_print();
+			break;
+		}
+		job->server_ret = 0;
+	}
+	if (cmd == 0) {
+		job->server_ret = 1;
+	}
+	// a failed server ends the client handshake
+	tls_memory_pair_close(job->pair, 1);
+}
+
+#ifdef _WIN32
+static unsigned __stdcall tls_speed_server_thread(void *arg)
+{
+	tls_speed_server_loop((TLS_SPEED_JOB *)arg);
+	return 0;
+}
+#else
+static void *tls_speed_server_thread(void *arg)
+{
+	tls_speed_server_loop((TLS_SPEED_JOB *)arg);
+	return NULL;
+}
+#endif
+
+// TLS 1.2, the server handshake runs in the server thread
+static int tls_speed_handshake_blocking(TLS_SPEED_JOB *job, const TLS_SESSION *session,
+	int get_session, int *reused)
+{
+	TLS_TRANSPORT transport;
+	TLS_CONNECT client;
+	uint8_t cmd = 1;
+	int ret = -1;
+
+	memset(&client, 0, sizeof(client));
+	if (tls_memory_pair_get_transport(job->pair, 0, &transport) != 1
+		|| transport.send(transport.arg, &cmd, 1) != 1) {
+		error_print();
+		return -1;
+	}
+	if (tls_speed_conn_init(&client, &job->client_ctx, job->pair, 0,
+			get_session ? NULL : &job->client_stats) != 1
+		|| (session && tls_set_session(&client, session) != 1)
+		|| tls_do_handshake(&client) != 1) {
+		error_print();
+		goto end;
+	}
+	if (get_session && tls_get_session(&client, &job->session) != 1) {
+		error_print();
+		goto end;
+	}
+	// the server reuses the session if the client does
+	*reused = tls_session_reused(&client);
+	ret = 1;
+end:
+	tls_cleanup(&client);
+	return ret;
+}
+
+static int tls_speed_handshake(TLS_SPEED_JOB *job, const TLS_SESSION *session, int get_session, int *reused)
+{
+	if (job->pair) {
+		return tls_speed_handshake_blocking(job, session, get_session, reused);
+	} else {
+		return tls_speed_handshake_non_blocking(job, session, get_session, reused);
+	}
+}
+
+static void tls_speed_job_run(TLS_SPEED_JOB *job)
+{
+	const TLS_SESSION *session = NULL;
+	double begin;
+	int reused;
+
+	if (job->resumed) {
+		if (tls_speed_handshake(job, NULL, 1, &reused) != 1) {
+			error_print();
+			return;
+		}
+		session = &job->session;
+	}
+	begin = tls_speed_now();
+	do {
+		if (tls_speed_handshake(job, session, 0, &reused) != 1) {
+			error_print();
+			return;
+		}
+		if (reused != job->resumed) {
+			error_print();
+			return;
+		}
+		job->handshakes++;
+		job->elapsed = tls_speed_now() - begin;
+	} while (job->elapsed < job->seconds);
+	job->ret = 1;
+}
+
+static void tls_speed_job(TLS_SPEED_JOB *job)
+{
+#ifdef _WIN32
+	HANDLE tid;
+#else
+	pthread_t tid;
+#endif
+	int started = 0;
+
+	job->ret = -1;
+	if (tls_speed_ctx_init(job) != 1) {
+		error_print();
+		goto end;
+	}
+	if (job->suite->protocol == TLS_protocol_tls12) {
+		if (!(job->pair = tls_memory_pair_new(1))) {
+			error_print();
+			goto end;
+		}
+#ifdef _WIN32
+		if (!(tid = (HANDLE)_beginthreadex(NULL, 0, tls_speed_server_thread, job, 0, NULL))) {
+#else
+		if (pthread_create(&tid, NULL, tls_speed_server_thread, job) != 0) {
+#endif
+			error_print();
+			goto end;
+		}
+		started = 1;
+	}
+
+	tls_speed_job_run(job);
+
+	if (started) {
+		TLS_TRANSPORT transport;
+		uint8_t cmd = 0;
+
+		tls_memory_pair_get_transport(job->pair, 0, &transport);
+		transport.send(transport.arg, &cmd, 1);
+		tls_memory_pair_close(job->pair, 0);
+#ifdef _WIN32
+		WaitForSingleObject(tid, INFINITE);
+		CloseHandle(tid);
+#else
+		pthread_join(tid, NULL);
+#endif
+		if (job->server_ret != 1) {
+			job->ret = -1;
+		}
+	}
+end:
+	tls_memory_pair_free(job->pair);
+	job->pair = NULL;
+	tls_session_cache_free(job->cache);
+	job->cache = NULL;
+	tls_ctx_cleanup(&job->client_ctx);
+	tls_ctx_cleanup(&job->server_ctx);
+	gmssl_secure_clear(&job->session, sizeof(job->session));
+}
+
+#ifdef _WIN32
+static unsigned __stdcall tls_speed_thread(void *arg)
+{
+	tls_speed_job((TLS_SPEED_JOB *)arg);
+	return 0;
+}
+#else
+static void *tls_speed_thread(void *arg)
+{
+	tls_speed_job((TLS_SPEED_JOB *)arg);
+	return NULL;
+}
+#endif
+
+// run `threads` jobs at the same time, the calling thread runs jobs[0]
+static int tls_speed_run_threads(TLS_SPEED_JOB *jobs, int threads)
+{
+#ifdef _WIN32
+	HANDLE tids[TLS_SPEED_MAX_THREADS];
+#else
+	pthread_t tids[TLS_SPEED_MAX_THREADS];
+#endif
+	int started = 0;
+	int ret = 1;
+	int i;
+
+	for (i = 1; i < threads; i++) {
+#ifdef _WIN32
+		if (!(tids[i] = (HANDLE)_beginthreadex(NULL, 0, tls_speed_thread, &jobs[i], 0, NULL))) {
+			break;
+		}
+#else
+		if (pthread_create(&tids[i], NULL, tls_speed_thread, &jobs[i]) != 0) {
+			break;
+		}
+#endif
+		started = i;
+	}
+	if (started != threads - 1) {
+		error_print();
+		ret = -1;
+	} else {
+		tls_speed_job(&jobs[0]);
+	}
+	for (i = 1; i <= started; i++) {
+#ifdef _WIN32
+		WaitForSingleObject(tids[i], INFINITE);
+		CloseHandle(tids[i]);
+#else
+		pthread_join(tids[i], NULL);
+#endif
+	}
+	for (i = 0; ret == 1 && i < threads; i++) {
+		if (jobs[i].ret != 1) {
+			ret = -1;
+		}
+	}
+	return ret;
+}
+
+static int tls_speed_parse_list(const char *str, size_t *vals, size_t maxvals, size_t *nvals)
+{
+	char *end;
+
+	*nvals = 0;
+	while (*str) {
+		unsigned long v = strtoul(str, &end, 10);
+		if (end == str || !v || *nvals >= maxvals) {
+			return -1;
+		}
+		vals[(*nvals)++] = (size_t)v;
+		if (*end == ',') {
+			end++;
+		} else if (*end) {
+			return -1;
+		}
+		str = end;
+	}
+	return *nvals ? 1 : -1;
+}
+
+static int tls_speed_protocol_selected(const char *name, const char *names)
+{
+	const char *p = names;
+
+	while (*p) {
+		size_t n = strcspn(p, ",");
+		if (n == strlen(name) && !strncmp(name, p, n)) {
+			return 1;
+		}
+		p += n;
+		if (*p == ',') {
+			p++;
+		}
+	}
+	return 0;
+}
+
+int tls_speed_main(int argc, char **argv)
+{
+	int ret = 1;
+	char *prog = argv[0];
+	char *names[TLS_SPEED_SUITES_COUNT * 2];
+	int names_cnt = 0;
+	int run_full = 1;
+	int run_resumed = 1;
+	size_t threads[16] = { 1 };
+	size_t threads_cnt = 1;
+	double seconds = 1;
+	int json = 0;
+	char *outfile = NULL;
+	FILE *outfp = stdout;
+	TLS_SPEED_CERTS certs;
+	TLS_SPEED_JOB *jobs = NULL;
+	int first = 1;
+	size_t s, t;
+	int resumed;
+	int i, j;
+
+	argc--;
+	argv++;
+
+	while (argc > 0) {
+		if (!strcmp(*argv, "-help")) {
+			printf("usage: gmssl %s %s\n", prog, usage);
+			printf("%s\n", options);
+			ret = 0;
+			goto end;
+		} else if (!strcmp(*argv, "-protocol")) {
+			if (--argc < 1) goto bad;
+			if (names_cnt >= (int)(sizeof(names)/sizeof(names[0]))) {
+				fprintf(stderr, "gmssl %s: too many `-protocol` options\n", prog);
+				goto end;
+			}
+			names[names_cnt++] = *(++argv);
+		} else if (!strcmp(*argv, "-full")) {
+			run_full = 1;
+			run_resumed = 0;
+		} else if (!strcmp(*argv, "-resumed")) {
+			run_full = 0;
+			run_resumed = 1;
+		} else if (!strcmp(*argv, "-threads")) {
+			if (--argc < 1) goto bad;
+			if (tls_speed_parse_list(*(++argv), threads, sizeof(threads)/sizeof(threads[0]), &threads_cnt) != 1) {
+				fprintf(stderr, "gmssl %s: invalid `-threads` value\n", prog);
+				goto end;
+			}
+			for (t = 0; t < threads_cnt; t++) {
+				if (threads[t] > TLS_SPEED_MAX_THREADS) {
+					fprintf(stderr, "gmssl %s: `-threads` value should be at most %d\n", prog, TLS_SPEED_MAX_THREADS);
+					goto end;
+				}
+			}
+		} else if (!strcmp(*argv, "-seconds")) {
+			if (--argc < 1) goto bad;
+			seconds = atof(*(++argv));
+			if (seconds <= 0) {
+				fprintf(stderr, "gmssl %s: invalid `-seconds` value\n", prog);
+				goto end;
+			}
+		} else if (!strcmp(*argv, "-json")) {
+			json = 1;
+		} else if (!strcmp(*argv, "-out")) {
+			if (--argc < 1) goto bad;
+			outfile = *(++argv);
+			if (!(outfp = fopen(outfile, "wb"))) {
+				fprintf(stderr, "gmssl %s: open '%s' failure : %s\n", prog, outfile, strerror(errno));
+				goto end;
+			}
+		} else {
+			fprintf(stderr, "gmssl %s: illegal option '%s'\n", prog, *argv);
+			goto end;
+bad:
+			fprintf(stderr, "gmssl %s: `%s` option value missing\n", prog, *argv);
+			goto end;
+		}
+
+		argc--;
+		argv++;
+	}
+
+	for (i = 0; i < names_cnt; i++) {
+		for (s = 0; s < TLS_SPEED_SUITES_COUNT; s++) {
+			if (tls_speed_protocol_selected(tls_speed_suites[s].name, names[i])) {
+				break;
+			}
+		}
+		if (s == TLS_SPEED_SUITES_COUNT) {
+			fprintf(stderr, "gmssl %s: unknown protocol '%s'\n", prog, names[i]);
+			goto end;
+		}
+	}
+
+	if (!(jobs = (TLS_SPEED_JOB *)malloc(sizeof(TLS_SPEED_JOB) * TLS_SPEED_MAX_THREADS))) {
+		fprintf(stderr, "gmssl %s: malloc failure\n", prog);
+		goto end;
+	}
+
+	if (json) {
+		fprintf(outfp, "{\n");
+		fprintf(outfp, "  \"version\": \"%s\",\n", gmssl_version_str());
+		fprintf(outfp, "  \"seconds\": %g,\n", seconds);
+		fprintf(outfp, "  \"results\": [");
+	} else {
+		fprintf(outfp, "%-6s %-24s %-8s %7s %12s", "proto", "cipher_suite", "mode", "threads", "handshakes/s");
+		for (j = 0; j < TLS_HANDSHAKE_PHASES; j++) {
+			fprintf(outfp, " %19s", tls_handshake_phase_name(j));
+		}
+		fprintf(outfp, "\n");
+	}
+
+	for (s = 0; s < TLS_SPEED_SUITES_COUNT; s++) {
+		const TLS_SPEED_SUITE *suite = &tls_speed_suites[s];
+		int selected = names_cnt ? 0 : 1;
+
+		for (i = 0; i < names_cnt; i++) {
+			if (tls_speed_protocol_selected(suite->name, names[i])) {
+				selected = 1;
+			}
+		}
+		if (!selected) {
+			continue;
+		}
+		if (tls_speed_certs_generate(&certs, suite->protocol) != 1) {
+			fprintf(stderr, "gmssl %s: certificate generation failure\n", prog);
+			goto end;
+		}
+
+		for (resumed = 0; resumed <= 1; resumed++) {
+			if ((resumed && !run_resumed) || (!resumed && !run_full)) {
+				continue;
+			}
+			for (t = 0; t < threads_cnt; t++) {
+				double per_sec = 0;
+				uint64_t handshakes = 0;
+				double client_usec[TLS_HANDSHAKE_PHASES] = {0};
+				double server_usec[TLS_HANDSHAKE_PHASES] = {0};
+
+				memset(jobs, 0, sizeof(TLS_SPEED_JOB) * threads[t]);
+				for (i = 0; i < (int)threads[t]; i++) {
+					jobs[i].suite = suite;
+					jobs[i].certs = &certs;
+					jobs[i].resumed = resumed;
+					jobs[i].seconds = seconds;
+				}
+				if (tls_speed_run_threads(jobs, (int)threads[t]) != 1) {
+					fprintf(stderr, "gmssl %s: %s %s handshake failure\n", prog,
+						suite->name, resumed ? "resumed" : "full");
+					goto end;
+				}
+				for (i = 0; i < (int)threads[t]; i++) {
+					per_sec += jobs[i].handshakes / jobs[i].elapsed;
+					handshakes += jobs[i].handshakes;
+					for (j = 0; j < TLS_HANDSHAKE_PHASES; j++) {
+						client_usec[j] += jobs[i].client_stats.nsec[j] * 1e-3;
+						server_usec[j] += jobs[i].server_stats.nsec[j] * 1e-3;
+					}
+				}
+				for (j = 0; j < TLS_HANDSHAKE_PHASES; j++) {
+					client_usec[j] /= handshakes;
+					server_usec[j] /= handshakes;
+				}
+
+				if (json) {
+					fprintf(outfp, "%s\n    {\"protocol\": \"%s\", \"cipher_suite\": \"%s\", \"mode\": \"%s\", "
+						"\"threads\": %zu, \"handshakes\": %llu, \"handshakes_per_sec\": %.1f, \"usec_per_handshake\": {",
+						first ? "" : ",", suite->name, tls_cipher_suite_name(suite->cipher_suite),
+						resumed ? "resumed" : "full", threads[t], (unsigned long long)handshakes, per_sec);
+					for (j = 0; j < TLS_HANDSHAKE_PHASES; j++) {
+						fprintf(outfp, "%s\"%s\": {\"client\": %.1f, \"server\": %.1f}", j ? ", " : "",
+							tls_handshake_phase_name(j), client_usec[j], server_usec[j]);
+					}
+					fprintf(outfp, "}}");
+					first = 0;
+				} else {
+					fprintf(outfp, "%-6s %-24s %-8s %7zu %12.1f", suite->name,
+						tls_cipher_suite_name(suite->cipher_suite), resumed ? "resumed" : "full",
+						threads[t], per_sec);
+					for (j = 0; j < TLS_HANDSHAKE_PHASES; j++) {
+						char usec[32];
+						snprintf(usec, sizeof(usec), "%.0f/%.0f", client_usec[j], server_usec[j]);
+						fprintf(outfp, " %19s", usec);
+					}
+					fprintf(outfp, "\n");
+				}
+				fflush(outfp);
+			}
+		}
+	}
+
+	if (json) {
+		fprintf(outfp, "\n  ]\n}\n");
+	}
+	ret = 0;
+
+end:
+	gmssl_secure_clear(&certs, sizeof(certs));
+	if (jobs) free(jobs);
+	if (outfile && outfp) fclose(outfp);
+	return ret;
+}
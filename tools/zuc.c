@@ -15,6 +15,7 @@
 #include <gmssl/mem.h>
 #include <gmssl/zuc.h>
 #include <gmssl/hex.h>
+#include <gmssl/file.h>
 
 
 static const char *options = "-key hex -iv hex [-in file] [-out file]";
@@ -34,9 +35,11 @@ int zuc_main(int argc, char **argv)
 	FILE *infp = stdin;
 	FILE *outfp = stdout;
 	ZUC_CTX zuc_ctx;
-	uint8_t inbuf[4096];
+	FILE_READER reader;
+	const uint8_t *inbuf;
 	size_t inlen;
-	uint8_t outbuf[4196];
+	int rv;
+	uint8_t *outbuf = NULL;
 	size_t outlen;
 
 	argc--;
@@ -113,16 +116,31 @@ bad:
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
 	}
-	while ((inlen = fread(inbuf, 1, sizeof(inbuf), infp)) > 0) {
+	if (!(outbuf = malloc(FILE_CIPHER_OUTBUF_SIZE))) {
+		fprintf(stderr, "%s: malloc failure\n", prog);
+		goto end;
+	}
+	if (file_read_init(&reader, infp, 0) != 1) {
+		fprintf(stderr, "%s: inner error\n", prog);
+		goto end;
+	}
+	while ((rv = file_read_next(&reader, &inbuf, &inlen)) == 1) {
 		if (zuc_encrypt_update(&zuc_ctx, inbuf, inlen, outbuf, &outlen) != 1) {
 			fprintf(stderr, "%s: inner error\n", prog);
+			file_read_cleanup(&reader);
 			goto end;
 		}
 		if (fwrite(outbuf, 1, outlen, outfp) != outlen) {
 			fprintf(stderr, "%s: output failure : %s\n", prog, strerror(errno));
+			file_read_cleanup(&reader);
 			goto end;
 		}
 	}
+	file_read_cleanup(&reader);
+	if (rv < 0) {
+		fprintf(stderr, "%s: read input failure : %s\n", prog, strerror(errno));
+		goto end;
+	}
 	if (zuc_encrypt_finish(&zuc_ctx, outbuf, &outlen) != 1) {
 		fprintf(stderr, "%s: inner error\n", prog);
 		goto end;
@@ -136,8 +154,10 @@ end:
 	gmssl_secure_clear(&zuc_ctx, sizeof(zuc_ctx));
 	gmssl_secure_clear(key, sizeof(key));
 	gmssl_secure_clear(iv, sizeof(iv));
-	gmssl_secure_clear(inbuf, sizeof(inbuf));
-	gmssl_secure_clear(outbuf, sizeof(outbuf));
+	if (outbuf) {
+		gmssl_secure_clear(outbuf, FILE_CIPHER_OUTBUF_SIZE);
+		free(outbuf);
+	}
 	if (infile && infp) fclose(infp);
 	if (outfile && outfp) fclose(outfp);
 	return ret;